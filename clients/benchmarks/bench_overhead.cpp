@@ -0,0 +1,230 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// hipblas-bench --overhead: the host time of calls that return without launching anything, through
+// hipBLAS and straight to the backend library, for the cost of the hipBLAS layer
+
+#include "argument_model.hpp"
+#include "clients_common.hpp"
+#include "hipblas_test.hpp"
+#include "utility.h"
+
+#include <chrono>
+#include <iostream>
+
+#ifndef WIN32
+#include <dlfcn.h>
+#endif
+
+namespace
+{
+    // the backend functions are called with the hipBLAS handle, which is the backend's handle, and
+    // int for the backend enums
+    using scal_t = int (*)(void*, int, const float*, float*, int);
+    using axpy_t = int (*)(void*, int, const float*, const float*, int, float*, int);
+    using dot_t  = int (*)(void*, int, const float*, int, const float*, int, float*);
+    using gemv_t = int (*)(void*,
+                           int,
+                           int,
+                           int,
+                           const float*,
+                           const float*,
+                           int,
+                           const float*,
+                           int,
+                           const float*,
+                           float*,
+                           int);
+    using gemm_t = int (*)(void*,
+                           int,
+                           int,
+                           int,
+                           int,
+                           int,
+                           const float*,
+                           const float*,
+                           int,
+                           const float*,
+                           int,
+                           const float*,
+                           float*,
+                           int);
+    using trsm_t = int (*)(void*,
+                           int,
+                           int,
+                           int,
+                           int,
+                           int,
+                           int,
+                           const float*,
+                           const float*,
+                           int,
+                           float*,
+                           int);
+
+#ifdef __HIP_PLATFORM_NVIDIA__
+    const char* const backend_libraries[] = {"libcublas.so", "libcublas.so.12", "libcublas.so.11"};
+    const char* const backend_functions[]
+        = {"cublasSscal_v2", "cublasSaxpy_v2", "cublasSdot_v2",
+           "cublasSgemv_v2", "cublasSgemm_v2", "cublasStrsm_v2"};
+    constexpr int op_n = 0, side_left = 0, fill_lower = 0, diag_non_unit = 0;
+#else
+    const char* const backend_libraries[] = {"librocblas.so", "librocblas.so.4"};
+    const char* const backend_functions[]
+        = {"rocblas_sscal", "rocblas_saxpy", "rocblas_sdot",
+           "rocblas_sgemv", "rocblas_sgemm", "rocblas_strsm"};
+    constexpr int op_n = 111, side_left = 141, fill_lower = 122, diag_non_unit = 131;
+#endif
+
+    // the functions of the backend library, or nullptrs if it can't be loaded
+    struct backend_functions_t
+    {
+        scal_t scal = nullptr;
+        axpy_t axpy = nullptr;
+        dot_t  dot  = nullptr;
+        gemv_t gemv = nullptr;
+        gemm_t gemm = nullptr;
+        trsm_t trsm = nullptr;
+    };
+
+    backend_functions_t load_backend()
+    {
+        backend_functions_t backend;
+#ifndef WIN32
+        void* library = nullptr;
+        for(const char* name : backend_libraries)
+            if((library = dlopen(name, RTLD_NOW | RTLD_LOCAL)))
+                break;
+        if(!library)
+            return backend;
+
+        backend.scal = reinterpret_cast<scal_t>(dlsym(library, backend_functions[0]));
+        backend.axpy = reinterpret_cast<axpy_t>(dlsym(library, backend_functions[1]));
+        backend.dot  = reinterpret_cast<dot_t>(dlsym(library, backend_functions[2]));
+        backend.gemv = reinterpret_cast<gemv_t>(dlsym(library, backend_functions[3]));
+        backend.gemm = reinterpret_cast<gemm_t>(dlsym(library, backend_functions[4]));
+        backend.trsm = reinterpret_cast<trsm_t>(dlsym(library, backend_functions[5]));
+#endif
+        return backend;
+    }
+
+    template <typename F>
+    double ns_per_call(int calls, F&& f)
+    {
+        // one call first, so that lazy initialization isn't timed
+        f();
+        auto start = std::chrono::steady_clock::now();
+        for(int i = 0; i < calls; i++)
+            f();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count() / calls;
+    }
+}
+
+int run_bench_overhead(const Arguments& arg, int calls)
+{
+    hipblasLocalHandle handle(arg);
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    void* h = static_cast<void*>(static_cast<hipblasHandle_t>(handle));
+
+    backend_functions_t backend = load_backend();
+
+    // the sizes are 0, so that the calls return before launching, but the pointers are valid
+    float  alpha = 1, beta = 1, result = 0;
+    float* d;
+    CHECK_HIP_ERROR(hipMalloc(&d, 4 * sizeof(float)));
+    float *x = d, *y = d + 1, *A = d + 2, *B = d + 3;
+
+    char version[128] = "";
+    (void)hipblasGetBackendVersionString(version, sizeof(version));
+    std::cout << "backend: " << version << "\n\n"
+              << "function,calls,hipblas-ns,backend-ns,overhead-ns" << std::endl;
+
+    auto report = [&](const char* name, double hipblas_ns, double backend_ns) {
+        std::cout << name << ", " << calls << ", " << hipblas_ns << ", "
+                  << (backend_ns ? backend_ns : ArgumentLogging::NA_value) << ", "
+                  << (backend_ns ? hipblas_ns - backend_ns : ArgumentLogging::NA_value)
+                  << std::endl;
+    };
+
+    auto hipblas_scal = [&] { hipblasSscal(handle, 0, &alpha, x, 1); };
+    auto backend_scal = [&] { backend.scal(h, 0, &alpha, x, 1); };
+    report("scal",
+           ns_per_call(calls, hipblas_scal),
+           backend.scal ? ns_per_call(calls, backend_scal) : 0);
+
+    auto hipblas_axpy = [&] { hipblasSaxpy(handle, 0, &alpha, x, 1, y, 1); };
+    auto backend_axpy = [&] { backend.axpy(h, 0, &alpha, x, 1, y, 1); };
+    report("axpy",
+           ns_per_call(calls, hipblas_axpy),
+           backend.axpy ? ns_per_call(calls, backend_axpy) : 0);
+
+    auto hipblas_dot = [&] { hipblasSdot(handle, 0, x, 1, y, 1, &result); };
+    auto backend_dot = [&] { backend.dot(h, 0, x, 1, y, 1, &result); };
+    report("dot",
+           ns_per_call(calls, hipblas_dot),
+           backend.dot ? ns_per_call(calls, backend_dot) : 0);
+
+    auto hipblas_gemv = [&] {
+        hipblasSgemv(handle, HIPBLAS_OP_N, 0, 0, &alpha, A, 1, x, 1, &beta, y, 1);
+    };
+    auto backend_gemv = [&] { backend.gemv(h, op_n, 0, 0, &alpha, A, 1, x, 1, &beta, y, 1); };
+    report("gemv",
+           ns_per_call(calls, hipblas_gemv),
+           backend.gemv ? ns_per_call(calls, backend_gemv) : 0);
+
+    auto hipblas_gemm = [&] {
+        hipblasSgemm(
+            handle, HIPBLAS_OP_N, HIPBLAS_OP_N, 0, 0, 0, &alpha, A, 1, B, 1, &beta, y, 1);
+    };
+    auto backend_gemm = [&] {
+        backend.gemm(h, op_n, op_n, 0, 0, 0, &alpha, A, 1, B, 1, &beta, y, 1);
+    };
+    report("gemm",
+           ns_per_call(calls, hipblas_gemm),
+           backend.gemm ? ns_per_call(calls, backend_gemm) : 0);
+
+    auto hipblas_trsm = [&] {
+        hipblasStrsm(handle,
+                     HIPBLAS_SIDE_LEFT,
+                     HIPBLAS_FILL_MODE_LOWER,
+                     HIPBLAS_OP_N,
+                     HIPBLAS_DIAG_NON_UNIT,
+                     0,
+                     0,
+                     &alpha,
+                     A,
+                     1,
+                     B,
+                     1);
+    };
+    auto backend_trsm = [&] {
+        backend.trsm(h, side_left, fill_lower, op_n, diag_non_unit, 0, 0, &alpha, A, 1, B, 1);
+    };
+    report("trsm",
+           ns_per_call(calls, hipblas_trsm),
+           backend.trsm ? ns_per_call(calls, backend_trsm) : 0);
+
+    CHECK_HIP_ERROR(hipFree(d));
+    return 0;
+}
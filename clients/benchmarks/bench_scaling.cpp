@@ -0,0 +1,228 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// hipblas-bench --thread_scaling: how the handle functions and tiny calls of hipBLAS scale with
+// the number of host threads, each with a handle and a stream of its own, as a server with a
+// thread per request would run them. Global locks in hipBLAS, the backend or the runtime show up
+// as throughput that stops growing with the threads and as long tails of the latencies.
+
+#include "argument_model.hpp"
+#include "clients_common.hpp"
+#include "hipblas_test.hpp"
+#include "utility.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using scaling_clock = std::chrono::steady_clock;
+
+    // the phases, in the order the threads run them, each started by all threads together. The
+    // create and destroy calls alternate, so they share a phase and are reported apart.
+    enum scaling_phase
+    {
+        PHASE_CREATE,
+        PHASE_DESTROY,
+        PHASE_SET_STREAM,
+        PHASE_QUICK_RETURN,
+        PHASE_TINY,
+        PHASE_COUNT
+    };
+
+    const char* const phase_names[PHASE_COUNT]
+        = {"create", "destroy", "set_stream", "quick_return", "tiny_axpy"};
+
+    // the elements of the axpy of the tiny phase, one block
+    constexpr int tiny_n = 256;
+
+    // a barrier for the threads of a run, reusable across the phases
+    class scaling_barrier
+    {
+    public:
+        explicit scaling_barrier(int parties)
+            : m_parties(parties)
+        {
+        }
+
+        void wait()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            int                          generation = m_generation;
+            if(++m_waiting == m_parties)
+            {
+                m_waiting = 0;
+                m_generation++;
+                m_condition.notify_all();
+            }
+            else
+                m_condition.wait(lock, [&] { return generation != m_generation; });
+        }
+
+    private:
+        std::mutex              m_mutex;
+        std::condition_variable m_condition;
+        int                     m_parties;
+        int                     m_waiting    = 0;
+        int                     m_generation = 0;
+    };
+
+    // the latencies of the calls of a thread in each phase, and when it began and ended each
+    struct scaling_samples
+    {
+        std::vector<double>       ns[PHASE_COUNT];
+        scaling_clock::time_point begin[PHASE_COUNT], end[PHASE_COUNT];
+    };
+
+    void scaling_thread(int device, int calls, scaling_barrier& barrier, scaling_samples& samples)
+    {
+        CHECK_HIP_ERROR(hipSetDevice(device));
+
+        // the stream and the operands are set up before the first phase, and aren't timed
+        hipStream_t stream;
+        float*      d;
+        float       alpha = 1;
+        CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+        CHECK_HIP_ERROR(hipMalloc(&d, 2 * tiny_n * sizeof(float)));
+        CHECK_HIP_ERROR(hipMemset(d, 0, 2 * tiny_n * sizeof(float)));
+
+        auto elapsed_ns = [](scaling_clock::time_point start) {
+            return std::chrono::duration<double, std::nano>(scaling_clock::now() - start).count();
+        };
+
+        // runs f(i) for the calls of a phase, with begin and end around them all
+        auto run_phase = [&](scaling_phase phase, auto&& f) {
+            barrier.wait();
+            samples.begin[phase] = scaling_clock::now();
+            for(int i = 0; i < calls; i++)
+                f(i);
+            if(phase == PHASE_TINY)
+                CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+            samples.end[phase] = scaling_clock::now();
+        };
+
+        for(auto& ns : samples.ns)
+            ns.resize(calls);
+
+        run_phase(PHASE_CREATE, [&](int i) {
+            hipblasHandle_t handle;
+            auto            start = scaling_clock::now();
+            CHECK_HIPBLAS_ERROR(hipblasCreate(&handle));
+            samples.ns[PHASE_CREATE][i] = elapsed_ns(start);
+
+            start = scaling_clock::now();
+            CHECK_HIPBLAS_ERROR(hipblasDestroy(handle));
+            samples.ns[PHASE_DESTROY][i] = elapsed_ns(start);
+        });
+        samples.begin[PHASE_DESTROY] = samples.begin[PHASE_CREATE];
+        samples.end[PHASE_DESTROY]   = samples.end[PHASE_CREATE];
+
+        // the handle of the other phases
+        hipblasHandle_t handle;
+        CHECK_HIPBLAS_ERROR(hipblasCreate(&handle));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        auto timed = [&](scaling_phase phase, auto&& f) {
+            run_phase(phase, [&](int i) {
+                auto start = scaling_clock::now();
+                f();
+                samples.ns[phase][i] = elapsed_ns(start);
+            });
+        };
+        timed(PHASE_SET_STREAM, [&] { CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, stream)); });
+        timed(PHASE_QUICK_RETURN, [&] {
+            CHECK_HIPBLAS_ERROR(hipblasSaxpy(handle, 0, &alpha, d, 1, d + tiny_n, 1));
+        });
+        timed(PHASE_TINY, [&] {
+            CHECK_HIPBLAS_ERROR(hipblasSaxpy(handle, tiny_n, &alpha, d, 1, d + tiny_n, 1));
+        });
+
+        CHECK_HIPBLAS_ERROR(hipblasDestroy(handle));
+        CHECK_HIP_ERROR(hipFree(d));
+        CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    }
+
+    // the latency of fraction p of the sorted latencies
+    double percentile(const std::vector<double>& sorted, double p)
+    {
+        return sorted[std::min(sorted.size() - 1, size_t(p * sorted.size()))];
+    }
+}
+
+int run_bench_thread_scaling(const Arguments& arg, const std::vector<int64_t>& thread_counts)
+{
+    int device;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+    int calls = std::max(arg.iters, 1);
+
+    std::cout << "threads,phase,calls,window-us,calls/s,ns-per-call-p50,ns-per-call-p95,"
+                 "ns-per-call-p99,ns-per-call-max"
+              << std::endl;
+
+    // a run of one thread first, so that lazy initialization isn't timed
+    scaling_barrier warm_barrier(1);
+    scaling_samples warm_samples;
+    scaling_thread(device, 1, warm_barrier, warm_samples);
+
+    for(int64_t threads : thread_counts)
+    {
+        if(threads < 1)
+            continue;
+
+        scaling_barrier              barrier{int(threads)};
+        std::vector<scaling_samples> samples(threads);
+        std::vector<std::thread>     pool;
+        for(int64_t t = 0; t < threads; t++)
+            pool.emplace_back(
+                scaling_thread, device, calls, std::ref(barrier), std::ref(samples[t]));
+        for(auto& thread : pool)
+            thread.join();
+
+        // the throughput of each phase over the window from its first begin to its last end
+        for(int phase = 0; phase < PHASE_COUNT; phase++)
+        {
+            std::vector<double>       ns;
+            scaling_clock::time_point begin = samples[0].begin[phase], end = samples[0].end[phase];
+            for(auto& s : samples)
+            {
+                ns.insert(ns.end(), s.ns[phase].begin(), s.ns[phase].end());
+                begin = std::min(begin, s.begin[phase]);
+                end   = std::max(end, s.end[phase]);
+            }
+            std::sort(ns.begin(), ns.end());
+
+            double window_us = std::chrono::duration<double, std::micro>(end - begin).count();
+            std::cout << threads << ", " << phase_names[phase] << ", " << ns.size() << ", "
+                      << window_us << ", "
+                      << (window_us > 0 ? ns.size() / window_us * 1e6 : ArgumentLogging::NA_value)
+                      << ", " << percentile(ns, 0.5) << ", " << percentile(ns, 0.95) << ", "
+                      << percentile(ns, 0.99) << ", " << ns.back() << std::endl;
+        }
+    }
+    return 0;
+}
@@ -27,9 +27,12 @@
 
 #include "argument_model.hpp"
 #include "clients_common.hpp"
+#include "hipblas_baseline.hpp"
+#include "hipblas_counters.hpp"
 #include "hipblas_data.hpp"
 #include "hipblas_datatype2string.hpp"
 #include "hipblas_parse_data.hpp"
+#include "hipblas_telemetry.hpp"
 #include "hipblas_test.hpp"
 #include "test_cleanup.hpp"
 #include "type_dispatch.hpp"
@@ -37,6 +40,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <cstdio>
 #include <cstring>
 #include <iostream>
@@ -45,14 +49,67 @@
 #include <string>
 #include <thread>
 #include <type_traits>
+#include <vector>
 
 using namespace roc; // For emulated program_options
 
-int hipblas_bench_datafile()
+// How the cases of a data file are run to keep the GPU from heating up over the file: rounds of
+// every case in turn, a pause before each case, and a drop of the shader clock during a case, in
+// percent, above which the case is flagged
+struct hipblas_bench_thermal
 {
-    int ret = 0;
+    int    rounds      = 1;
+    int    cooldown_ms = 0;
+    double clock_drop  = 0;
+};
+
+int hipblas_bench_datafile(bool report_percentiles, const hipblas_bench_thermal& thermal)
+{
+    std::vector<Arguments> cases;
     for(Arguments arg : HipBLAS_TestData())
-        ret |= run_bench_test(arg, 0, 1);
+    {
+        arg.report_percentiles |= report_percentiles;
+        cases.push_back(arg);
+    }
+
+    int device = 0;
+    if(thermal.clock_drop > 0)
+        CHECK_HIP_ERROR(hipGetDevice(&device));
+
+    int ret = 0, throttled = 0;
+    for(int round = 0; round < thermal.rounds; round++)
+    {
+        for(Arguments arg : cases)
+        {
+            if(thermal.cooldown_ms > 0)
+                std::this_thread::sleep_for(std::chrono::milliseconds(thermal.cooldown_ms));
+
+            double sclk_before = thermal.clock_drop > 0 ? hipblas_telemetry::sclk_mhz(device) : -1;
+
+            ret |= run_bench_test(arg, 0, 1);
+
+            if(sclk_before > 0)
+            {
+                double sclk_after = hipblas_telemetry::sclk_mhz(device);
+                double drop       = (sclk_before - sclk_after) / sclk_before * 100;
+                if(sclk_after > 0 && drop > thermal.clock_drop)
+                {
+                    throttled++;
+                    std::cerr << "warning: the sclk dropped by " << drop << "% from "
+                              << sclk_before << " to " << sclk_after << " MHz while running "
+                              << arg.function;
+                    if(thermal.rounds > 1)
+                        std::cerr << " in round " << round + 1;
+                    std::cerr << ", its times may be throttled" << std::endl;
+                }
+            }
+        }
+    }
+
+    if(throttled)
+        std::cerr << "warning: " << throttled << " of " << cases.size() * thermal.rounds
+                  << " runs had the sclk drop, consider a longer --cooldown_ms" << std::endl;
+
     test_cleanup::cleanup();
     return ret;
 }
@@ -71,7 +128,7 @@ void thread_init_device(int id, const Arguments& arg)
     run_bench_test(a, 0, 1);
 }
 
-void thread_run_bench(int id, const Arguments& arg)
+void thread_run_bench(int id, hipStream_t stream, const Arguments& arg, ArgumentModel_perf* perf)
 {
     int count;
     CHECK_HIP_ERROR(hipGetDeviceCount(&count));
@@ -79,39 +136,201 @@ void thread_run_bench(int id, const Arguments& arg)
     if(id < count)
         CHECK_HIP_ERROR(hipSetDevice(id));
 
+    hipblas_set_thread_stream(stream);
+
     Arguments a(arg);
+    ArgumentModel_set_last_perf({});
     run_bench_test(a, 0, 1);
+
+    // a run that returned before its timing loop mustn't hold up the others
+    hipblas_bench_window::leave();
+    *perf = ArgumentModel_get_last_perf();
 }
 
-int run_bench_multi_gpu_test(int parallel_devices, Arguments& arg)
+// runs arg from threads threads on each of devices devices starting with first_device, at the same
+// time. With streams, the threads of a device share that many streams, otherwise each thread with
+// others on its device has a stream of its own
+int run_bench_multi_gpu_test(int        first_device,
+                             int        devices,
+                             int        threads,
+                             int        streams,
+                             Arguments& arg)
 {
     int count;
     CHECK_HIP_ERROR(hipGetDeviceCount(&count));
 
-    if(parallel_devices > count || parallel_devices < 1)
+    if(first_device + devices > count || devices < 1 || threads < 1 || streams < 0)
         return 1;
 
+    Arguments a(arg);
+    a.own_stream = arg.own_stream || threads > 1 || streams;
+
     // initialization
-    auto thread_init = std::make_unique<std::thread[]>(parallel_devices);
+    auto thread_init = std::make_unique<std::thread[]>(devices);
+
+    for(int d = 0; d < devices; ++d)
+        thread_init[d] = std::thread(::thread_init_device, first_device + d, a);
 
-    for(int id = 0; id < parallel_devices; ++id)
-        thread_init[id] = std::thread(::thread_init_device, id, arg);
+    for(int d = 0; d < devices; ++d)
+        thread_init[d].join();
 
-    for(int id = 0; id < parallel_devices; ++id)
-        thread_init[id].join();
+    std::vector<hipStream_t> stream(size_t(devices) * streams);
+    for(size_t i = 0; i < stream.size(); ++i)
+    {
+        CHECK_HIP_ERROR(hipSetDevice(first_device + int(i) / streams));
+        CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream[i], hipStreamNonBlocking));
+    }
+    CHECK_HIP_ERROR(hipSetDevice(first_device));
+
+    // synchronized launch of cold & hot calls: the hot calls of all threads start together after
+    // the cold calls, and are timed over the window until the last of them ends
+    int                             parties = devices * threads;
+    std::vector<ArgumentModel_perf> perf(parties);
+    auto                            thread = std::make_unique<std::thread[]>(parties);
 
-    // synchronzied launch of cold & hot calls
-    auto thread = std::make_unique<std::thread[]>(parallel_devices);
+    hipblas_bench_window::open(parties);
+
+    for(int t = 0; t < parties; ++t)
+    {
+        int         d = t / threads;
+        hipStream_t s = streams ? stream[d * streams + t % threads % streams] : nullptr;
+        thread[t]     = std::thread(::thread_run_bench, first_device + d, s, a, &perf[t]);
+    }
 
-    for(int id = 0; id < parallel_devices; ++id)
-        thread[id] = std::thread(::thread_run_bench, id, arg);
+    for(int t = 0; t < parties; ++t)
+        thread[t].join();
 
-    for(int id = 0; id < parallel_devices; ++id)
-        thread[id].join();
+    double window_us = hipblas_bench_window::close();
+
+    for(auto s : stream)
+        CHECK_HIP_ERROR(hipStreamDestroy(s));
+
+    // the work of each device over the shared window, and the time per call of its threads
+    auto rate = [&](double work) {
+        return window_us > 0 ? work / window_us * 1e6 : ArgumentLogging::NA_value;
+    };
+
+    int    hot_calls   = std::max(arg.iters, 1);
+    double total_gflop = 0, total_gbyte = 0, total_calls = 0;
+
+    std::cout << "\ndevices,threads,streams,window-us\n"
+              << devices << ", " << threads << ", " << (streams ? streams : threads) << ", "
+              << window_us << "\n\n"
+              << "device,hipblas-Gflops,hipblas-GB/s,calls/s,hipblas-us-per-call-mean,"
+                 "hipblas-us-per-call-max\n";
+    for(int d = 0; d < devices; ++d)
+    {
+        double gflop = 0, gbyte = 0, calls = 0, us_sum = 0, us_max = 0;
+        for(int t = d * threads; t < (d + 1) * threads; ++t)
+        {
+            gflop += perf[t].gflops * perf[t].gpu_us * 1e-6;
+            gbyte += perf[t].GBps * perf[t].gpu_us * 1e-6;
+            if(perf[t].gpu_us > 0)
+                calls += hot_calls;
+            us_sum += perf[t].gpu_us / hot_calls;
+            us_max = std::max(us_max, perf[t].gpu_us / hot_calls);
+        }
+        total_gflop += gflop;
+        total_gbyte += gbyte;
+        total_calls += calls;
+        std::cout << first_device + d << ", " << rate(gflop) << ", " << rate(gbyte) << ", "
+                  << rate(calls) << ", " << us_sum / threads << ", " << us_max << "\n";
+    }
+    std::cout << "total, " << rate(total_gflop) << ", " << rate(total_gbyte) << ", "
+              << rate(total_calls) << std::endl;
 
     return 0;
 }
 
+// The sizes of --sizes, --m_range, --n_range, --k_range and --batch_range: first:last:step, with
+// step xf for sizes that grow by a factor f and +s or s for sizes that grow by s, or a single size
+std::vector<int64_t> parse_range(const std::string& range, const std::string& option)
+{
+    auto invalid = [&] {
+        return std::invalid_argument("Invalid value for --" + option + " " + range);
+    };
+
+    std::vector<std::string> fields;
+    for(size_t begin = 0, end; begin <= range.size(); begin = end + 1)
+    {
+        end = std::min(range.find(':', begin), range.size());
+        fields.push_back(range.substr(begin, end - begin));
+    }
+    if(fields.size() != 1 && fields.size() != 3)
+        throw invalid();
+
+    try
+    {
+        int64_t first = std::stoll(fields[0]);
+        if(fields.size() == 1)
+            return {first};
+
+        int64_t     last     = std::stoll(fields[1]);
+        std::string step     = fields[2];
+        bool        multiply = !step.empty() && step[0] == 'x';
+        bool        sign     = !step.empty() && step[0] == '+';
+        double      by       = std::stod(step.substr(multiply || sign));
+        if(first < 0 || last < first || (multiply ? by <= 1 || first < 1 : by < 1))
+            throw invalid();
+
+        std::vector<int64_t> sizes;
+        for(double size = first; size <= last; size = multiply ? size * by : size + by)
+            if(sizes.empty() || int64_t(size) != sizes.back())
+                sizes.push_back(int64_t(size));
+        return sizes;
+    }
+    catch(const std::logic_error&)
+    {
+        throw invalid();
+    }
+}
+
+// runs arg for each size of sizes as M, N and K, or else for each combination of the sizes of ms,
+// ns and ks, with each batch count of batch_counts, in this process. The leading dimensions grow
+// with the sizes when they're too small
+int run_bench_sweep(Arguments&                  arg,
+                    const std::vector<int64_t>& sizes,
+                    const std::vector<int64_t>& ms,
+                    const std::vector<int64_t>& ns,
+                    const std::vector<int64_t>& ks,
+                    const std::vector<int64_t>& batch_counts)
+{
+    auto run_batch = [&](int64_t m, int64_t n, int64_t k, int64_t batch_count) {
+        Arguments a(arg);
+        a.M           = m;
+        a.N           = n;
+        a.K           = k;
+        a.batch_count = batch_count;
+
+        int64_t ld = std::max({m, n, k, int64_t(1)});
+        a.lda      = std::max(a.lda, ld);
+        a.ldb      = std::max(a.ldb, ld);
+        a.ldc      = std::max(a.ldc, ld);
+        a.ldd      = std::max(a.ldd, ld);
+        return run_bench_test(a, 0, 1);
+    };
+    auto run = [&](int64_t m, int64_t n, int64_t k) {
+        int ret = 0;
+        for(int64_t batch_count : batch_counts)
+            ret |= run_batch(m, n, k, batch_count);
+        return ret;
+    };
+
+    int ret = 0;
+    if(!sizes.empty())
+    {
+        for(int64_t size : sizes)
+            ret |= run(size, size, size);
+        return ret;
+    }
+
+    for(int64_t m : ms)
+        for(int64_t n : ns)
+            for(int64_t k : ks)
+                ret |= run(m, n, k);
+    return ret;
+}
+
 // Replace --batch with --batch_count for backward compatibility
 void fix_batch(int argc, char* argv[])
 {
@@ -142,13 +361,35 @@ try
     std::string compute_type;
     std::string compute_type_gemm;
     std::string initialization;
+    std::string input_file;
+    std::string timing;
+    std::string verify;
+    std::string counters;
+    std::string output;
+    std::string output_file;
+    std::string baseline;
+    bool        compare;
+    double      regression_threshold;
+    double      significance;
+    std::string sizes;
+    std::string m_range;
+    std::string n_range;
+    std::string k_range;
+    std::string batch_range;
     int         device_id;
     int         parallel_devices;
+    int         threads;
+    int         overhead;
+    std::string thread_scaling;
+
+    hipblas_bench_thermal thermal;
+    int         streams;
     int32_t     api     = 0;
     bool        fortran = false;
 
     bool datafile            = hipblas_parse_data(argc, argv);
     bool atomics_not_allowed = false;
+    bool reproducible        = false;
     bool log_function_name   = false;
     bool log_datatype        = false;
 
@@ -182,6 +423,27 @@ try
          "Specific matrix size: ku is only applicable to BLAS-2: The number of super-diagonals "
          "of the banded matrix A.")
 
+        ("sizes",
+         value<std::string>(&sizes)->default_value(""),
+         "Sweep m, n and k together over first:last:step in this process, with step xf for a "
+         "geometric range, such as 32:8192:x2, or +s for a linear one, such as 256:4096:+256")
+
+        ("m_range",
+         value<std::string>(&m_range)->default_value(""),
+         "Sweep m over first:last:step. With n_range or k_range, every combination is run")
+
+        ("n_range",
+         value<std::string>(&n_range)->default_value(""),
+         "Sweep n over first:last:step")
+
+        ("k_range",
+         value<std::string>(&k_range)->default_value(""),
+         "Sweep k over first:last:step")
+
+        ("batch_range",
+         value<std::string>(&batch_range)->default_value(""),
+         "Sweep batch_count over first:last:step, for each of the sizes of the other sweeps")
+
         ("lda",
          value<int64_t>(&arg.lda)->default_value(128),
          "Leading dimension of matrix A, is only applicable to BLAS-2 & BLAS-3.")
@@ -285,6 +547,14 @@ try
          "Intialize with random integers, trig functions sin and cos, or hpl-like input. "
          "Options: rand_int, trig_float, hpl")
 
+        ("input_file",
+         value<std::string>(&input_file)->default_value(""),
+         "Memory-mapped files of A, B and C, separated by commas, which initialize them instead "
+         "of --initialization, for gemm, gemm_strided_batched, gemm_ex and "
+         "gemm_strided_batched_ex. A .npy file of 1, 2 or 3 dimensions is converted to the "
+         "type of its matrix and tiled over it, any other file is raw column-major data of that "
+         "type. An empty entry keeps --initialization")
+
         ("transposeA",
          value<char>(&arg.transA)->default_value('N'),
          "N = no transpose, T = transpose, C = conjugate transpose")
@@ -314,8 +584,10 @@ try
          "Whether or not to use the in place version of the algorithm. Only applicable to trmm routines")
 
         ("verify,v",
-         value<int>(&arg.norm_check)->default_value(0),
-         "Validate GPU results with CPU? 0 = No, 1 = Yes (default: No)")
+         value<std::string>(&verify)->default_value("0"),
+         "Validate GPU results with CPU? 0 = No, 1 = Yes, probabilistic = multiply both sides of "
+         "C = alpha * op(A) * op(B) + beta * C by random vectors on the device, in O(n^2) rather "
+         "than O(n^3). Probabilistic checks are used by gemm (default: No)")
 
         ("iters,i",
          value<int>(&arg.iters)->default_value(10),
@@ -325,13 +597,107 @@ try
          value<int>(&arg.cold_iters)->default_value(2),
          "Cold Iterations to run before entering the timing loop")
 
+        ("timing",
+         value<std::string>(&timing)->default_value("sync"),
+         "How the timing loop is timed: sync = host clock around a synchronize over all iterations, "
+         "events = GPU time of each iteration from hip events, host = host time of each call "
+         "without synchronizing, the API overhead")
+
+        ("report_percentiles",
+         bool_switch(&arg.report_percentiles)->default_value(false),
+         "Also report the min, median, p95, p99 and coefficient of variation of the iteration times. "
+         "With --timing sync, each iteration is synchronized")
+
+        ("rotating",
+         value<int>(&arg.rotating)->default_value(0),
+         "Cycle the iterations through copies of the operands that add up to at least this many MB, "
+         "so that they aren't cache resident. Used by the BLAS 1 axpy, asum, copy, dot, nrm2, scal "
+         "and swap, gemv, gemm and gemm_ex")
+
+        ("overhead",
+         value<int>(&overhead)->default_value(0),
+         "Instead of the function, time this many calls of scal, axpy, dot, gemv, gemm and trsm "
+         "with sizes of 0, through hipBLAS and straight to the backend library, for the host "
+         "time hipBLAS adds to each call")
+
+        ("thread_scaling",
+         value<std::string>(&thread_scaling)->default_value(""),
+         "Instead of the function, run hipblasCreate, hipblasSetStream, a quick return saxpy, a "
+         "tiny saxpy and hipblasDestroy --iters times from each of these numbers of threads at "
+         "once, given as first:last:step like --sizes, and report calls/s and latency percentiles")
+
+        ("interleave",
+         value<int>(&thermal.rounds)->default_value(1),
+         "With a data file, run this many rounds of all of its cases in turn, rather than each "
+         "case once after the other, so that no case always runs on a GPU heated by the cases "
+         "before it")
+
+        ("cooldown_ms",
+         value<int>(&thermal.cooldown_ms)->default_value(0),
+         "With a data file, sleep this many milliseconds before each case, to let the GPU cool")
+
+        ("clock_check",
+         value<double>(&thermal.clock_drop)->default_value(0),
+         "With a data file, read the shader clock before and after each case and warn about the "
+         "cases it dropped by more than this many percent over, as their times may be throttled. "
+         "Needs ROCm SMI or NVML, like --telemetry")
+
+        ("graph",
+         bool_switch(&arg.graph)->default_value(false),
+         "Capture the hot iterations into a HIP graph, and report the mean time of its replays. "
+         "The handle is in HIPBLAS_GRAPH_CAPTURE_SAFE mode, and a call that can't be captured "
+         "fails the run")
+
+        ("device_reference",
+         bool_switch(&arg.device_reference)->default_value(false),
+         "With -v or -u, compute the reference on the device in double precision and reduce the "
+         "error there, instead of copying the results to a host BLAS. Used by gemm, "
+         "gemm_strided_batched and trsm")
+
+        ("pad_ld",
+         bool_switch(&arg.pad_ld)->default_value(false),
+         "Pad lda, ldb, ldc and ldd of the gemm functions to hipblasGetOptimalLeadingDimension, "
+         "so the device matrices are allocated as hipblasMallocMatrix would")
+
+        ("flush_cache",
+         bool_switch(&arg.flush_cache)->default_value(false),
+         "Overwrite a buffer larger than the last level cache before each iteration, outside of "
+         "its time. With --timing sync, each iteration is synchronized")
+
+        ("roofline",
+         bool_switch(&arg.roofline)->default_value(false),
+         "Also report the peak Gflops of the data type and the copy bandwidth of the device, the "
+         "arithmetic intensity and the percentages of the peaks and of the roofline reached")
+
+        ("telemetry",
+         bool_switch(&arg.telemetry)->default_value(false),
+         "Also sample the power, clocks and temperature of the device during the hot iterations, "
+         "through ROCm SMI or NVML, and report the mean power, the energy per call and Gflops/W")
+
+        ("counters",
+         value<std::string>(&counters)->default_value(""),
+         "Also collect these comma separated hardware counters over the hot iterations, through "
+         "rocprofiler-sdk on AMD devices, and report each per call next to the flops and bytes "
+         "per call of the models")
+
+        ("memory_footprint",
+         bool_switch(&arg.memory_footprint)->default_value(false),
+         "Also report the device memory of the operands, the workspace the call asks for, the "
+         "growth of the used device memory during the calls and the resulting footprint")
+
+        ("device_memory_limit",
+         value<double>(&arg.device_memory_limit)->default_value(0),
+         "Cap the device workspace of the handle at this many GB with hipblasSetWorkspaceLimit, "
+         "to see the fallbacks and the performance of devices with less memory. 0 for no limit")
+
         ("algo",
          value<uint32_t>(&arg.algo)->default_value(0),
          "extended precision gemm algorithm")
 
         ("solution_index",
          value<int32_t>(&arg.solution_index)->default_value(0),
-         "extended precision gemm solution index")
+         "extended precision gemm solution index from hipblasGemmExGetSolutions, "
+         "0 for the default. Used by gemm_ex with hipblas_v2-bench")
 
         ("flags",
          value<uint32_t>(&arg.flags)->default_value(0),
@@ -341,13 +707,27 @@ try
          bool_switch(&atomics_not_allowed)->default_value(false),
          "Atomic operations with non-determinism in results are not allowed")
 
+        ("reproducible",
+         bool_switch(&reproducible)->default_value(false),
+         "Results are the same bits from run to run (HIPBLAS_REPRODUCIBILITY_BITWISE)")
+
         ("device",
          value<int>(&device_id)->default_value(0),
          "Set default device to be used for subsequent program runs")
 
         ("parallel_devices",
          value<int>(&parallel_devices)->default_value(0),
-         "Set number of devices used for parallel runs (device 0 to parallel_devices-1)")
+         "Set number of devices used for parallel runs (device 0 to parallel_devices-1). Their "
+         "timing loops start together, and a total over the shared window follows their output")
+
+        ("threads",
+         value<int>(&threads)->default_value(1),
+         "The number of threads that run the function at the same time on the device, or on each "
+         "of parallel_devices, each with a handle of its own")
+
+        ("streams",
+         value<int>(&streams)->default_value(0),
+         "The number of streams that the threads of a device share, 0 for a stream per thread")
 
         // ("c_noalias_d",
         //  bool_switch(&arg.c_noalias_d)->default_value(false),
@@ -361,6 +741,36 @@ try
          bool_switch(&log_datatype)->default_value(false),
          "Include datatypes used in output.")
 
+        ("output",
+         value<std::string>(&output)->default_value(""),
+         "Also write each run as one record to --output_file, json = a JSON object per line, "
+         "csv = a header and a line per run. Records have every argument, the results and the "
+         "device, driver, backend and hipBLAS versions")
+
+        ("output_file",
+         value<std::string>(&output_file)->default_value(""),
+         "The file that --output records are written to")
+
+        ("baseline",
+         value<std::string>(&baseline)->default_value(""),
+         "Also write each run with the time of each of its hot iterations to this file, as a JSON "
+         "object per line. With --compare, rerun the runs of the file instead")
+
+        ("compare",
+         bool_switch(&compare)->default_value(false),
+         "Rerun the runs of --baseline, compare the times of their iterations with the recorded "
+         "ones, and exit with an error if any run regressed")
+
+        ("regression_threshold",
+         value<double>(&regression_threshold)->default_value(0.05),
+         "With --compare, the slowdown of the median iteration time, as a fraction, beyond which a "
+         "significant slowdown is a regression")
+
+        ("significance",
+         value<double>(&significance)->default_value(0.01),
+         "With --compare, the significance level of the one-sided Mann-Whitney U test of the "
+         "iteration times")
+
         ("fortran",
          bool_switch(&fortran)->default_value(false),
          "Run using Fortran interface")
@@ -393,9 +803,38 @@ try
     //     return 0;
     // }
 
+    // the profiler attaches before the HIP runtime initializes
+    if(!counters.empty())
+        hipblas_counters::select(counters);
+
     // transfer local variable state
 
     arg.atomics_mode = atomics_not_allowed ? HIPBLAS_ATOMICS_NOT_ALLOWED : HIPBLAS_ATOMICS_ALLOWED;
+    arg.reproducibility_mode
+        = reproducible ? HIPBLAS_REPRODUCIBILITY_BITWISE : HIPBLAS_REPRODUCIBILITY_DEFAULT;
+
+    if(timing == "sync")
+        arg.timing_mode = TIMING_SYNC;
+    else if(timing == "events")
+        arg.timing_mode = TIMING_EVENTS;
+    else if(timing == "host")
+        arg.timing_mode = TIMING_HOST;
+    else
+        throw std::invalid_argument("Invalid value for --timing " + timing);
+
+    if(verify == "probabilistic")
+    {
+        arg.norm_check          = 1;
+        arg.probabilistic_check = true;
+    }
+    else if(verify == "0" || verify == "1")
+        arg.norm_check = verify == "1";
+    else
+        throw std::invalid_argument("Invalid value for --verify " + verify);
+
+    // the null stream can't be captured
+    if(arg.graph)
+        arg.own_stream = true;
 
     if(api)
         arg.api = hipblas_client_api(api);
@@ -406,6 +845,9 @@ try
 
     ArgumentModel_set_log_datatype(log_datatype);
 
+    if(!output.empty())
+        ArgumentModel_set_output(output, output_file);
+
     // Device Query
     int device_count = query_device_property();
 
@@ -414,8 +856,32 @@ try
         throw std::invalid_argument("Invalid Device ID");
     set_device(device_id);
 
+    if(compare)
+    {
+        if(baseline.empty())
+            throw std::invalid_argument("--compare requires --baseline");
+        return hipblas_baseline_compare(baseline, regression_threshold, significance) ? 1 : 0;
+    }
+
+    // the samples of --compare are the times of each iteration
+    if(!baseline.empty())
+    {
+        ArgumentModel_set_baseline(baseline);
+        arg.report_percentiles = true;
+    }
+
     if(datafile)
-        return hipblas_bench_datafile();
+    {
+        if(thermal.rounds < 1)
+            throw std::invalid_argument("--interleave must be at least 1");
+        return hipblas_bench_datafile(!baseline.empty(), thermal);
+    }
+
+    if(overhead > 0)
+        return run_bench_overhead(arg, overhead);
+
+    if(!thread_scaling.empty())
+        return run_bench_thread_scaling(arg, parse_range(thread_scaling, "thread_scaling"));
 
     std::transform(precision.begin(), precision.end(), precision.begin(), ::tolower);
     auto prec = string2hipblas_datatype(precision);
@@ -459,10 +925,34 @@ try
     if(copied <= 0 || copied >= sizeof(arg.function))
         throw std::invalid_argument("Invalid value for --function");
 
-    if(!parallel_devices)
-        return run_bench_test(arg, 0, 1);
+    copied = snprintf(arg.input_file, sizeof(arg.input_file), "%s", input_file.c_str());
+    if(copied < 0 || copied >= sizeof(arg.input_file))
+        throw std::invalid_argument("Invalid value for --input_file");
+
+    if(!sizes.empty() || !m_range.empty() || !n_range.empty() || !k_range.empty()
+       || !batch_range.empty())
+    {
+        if(parallel_devices || threads > 1 || streams)
+            throw std::invalid_argument("Sweeps can't be combined with --parallel_devices, "
+                                        "--threads or --streams");
+
+        auto range = [&](const std::string& r, const char* option, int64_t size) {
+            return r.empty() ? std::vector<int64_t>{size} : parse_range(r, option);
+        };
+        return run_bench_sweep(arg,
+                               sizes.empty() ? std::vector<int64_t>{} : parse_range(sizes, "sizes"),
+                               range(m_range, "m_range", arg.M),
+                               range(n_range, "n_range", arg.N),
+                               range(k_range, "k_range", arg.K),
+                               range(batch_range, "batch_range", arg.batch_count));
+    }
+
+    if(parallel_devices)
+        return run_bench_multi_gpu_test(0, parallel_devices, threads, streams, arg);
+    else if(threads > 1 || streams)
+        return run_bench_multi_gpu_test(device_id, 1, threads, streams, arg);
     else
-        return run_bench_multi_gpu_test(parallel_devices, arg);
+        return run_bench_test(arg, 0, 1);
 }
 catch(const std::invalid_argument& exp)
 {
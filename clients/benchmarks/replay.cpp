@@ -0,0 +1,584 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// hipblas-replay: reissues the calls of a trace written with HIPBLAS_TRACE_FILE, in their order and
+// on streams that stand for the traced ones, for the time of a recorded call sequence rather than
+// of each of its shapes alone
+
+#include "program_options.hpp"
+
+#include "device_alloc.hpp"
+#include "hipblas.h"
+#include "hipblas_datatype2string.hpp"
+#include "test_cleanup.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace roc; // For emulated program_options
+
+namespace
+{
+    // a call of the trace, with the fields of its hipblas-bench line and the stream and GPU time
+    // of its comment
+    struct replay_call
+    {
+        std::map<std::string, std::string> fields;
+        std::string                        stream;
+        double                             traced_us = -1;
+    };
+
+    // issues a call with its operands at the start of the arena of its stream
+    struct replay_issue
+    {
+        size_t                                                 bytes = 0;
+        std::function<hipblasStatus_t(hipblasHandle_t, char*)> issue;
+    };
+
+    std::string trim(const std::string& str)
+    {
+        size_t begin = str.find_first_not_of(" \t\r");
+        size_t end   = str.find_last_not_of(" \t\r");
+        return begin == std::string::npos ? "" : str.substr(begin, end - begin + 1);
+    }
+
+    // parses a line of the trace, returning false if it isn't a call
+    bool parse_line(const std::string& line, replay_call& call)
+    {
+        size_t begin = line.find_first_not_of(" \t");
+        if(begin == std::string::npos || line.compare(begin, 3, "- {") != 0)
+            return false;
+
+        size_t end = line.find('}', begin);
+        if(end == std::string::npos)
+            return false;
+
+        std::string body = line.substr(begin + 3, end - begin - 3);
+        for(size_t pos = 0; pos < body.size();)
+        {
+            size_t      comma = std::min(body.find(',', pos), body.size());
+            std::string field = body.substr(pos, comma - pos);
+            size_t      colon = field.find(':');
+            if(colon != std::string::npos)
+                call.fields[trim(field.substr(0, colon))] = trim(field.substr(colon + 1));
+            pos = comma + 1;
+        }
+
+        // # <hipBLAS function>, stream <pointer>[, fallback][, <time> us]
+        size_t comment = line.find('#', end);
+        if(comment != std::string::npos)
+        {
+            std::string rest = line.substr(comment + 1);
+            for(size_t pos = 0; pos < rest.size();)
+            {
+                size_t      comma = std::min(rest.find(',', pos), rest.size());
+                std::string item  = trim(rest.substr(pos, comma - pos));
+                if(item.compare(0, 7, "stream ") == 0)
+                    call.stream = item.substr(7);
+                else if(item.size() > 3 && item.compare(item.size() - 3, 3, " us") == 0)
+                    call.traced_us = strtod(item.c_str(), nullptr);
+                pos = comma + 1;
+            }
+        }
+        return call.fields.count("function") != 0;
+    }
+
+    int64_t field(const replay_call& call, const char* name, int64_t value = 0)
+    {
+        auto it = call.fields.find(name);
+        return it == call.fields.end() ? value : strtoll(it->second.c_str(), nullptr, 10);
+    }
+
+    std::string field(const replay_call& call, const char* name, const char* value)
+    {
+        auto it = call.fields.find(name);
+        return it == call.fields.end() ? value : it->second;
+    }
+
+    // the compute type of the calls traced with a datatype as their compute type
+    hipblasComputeType_t compute_type(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_16F:
+        case HIP_C_16F:
+            return HIPBLAS_COMPUTE_16F;
+        case HIP_R_64F:
+        case HIP_C_64F:
+            return HIPBLAS_COMPUTE_64F;
+        case HIP_R_32I:
+            return HIPBLAS_COMPUTE_32I;
+        default:
+            return HIPBLAS_COMPUTE_32F;
+        }
+    }
+
+    // alpha of 1 and beta of 0 in the scalar type of the compute type, as hipblas-bench uses
+    struct replay_scalars
+    {
+        alignas(16) unsigned char alpha[16] = {};
+        alignas(16) unsigned char beta[16]  = {};
+
+        replay_scalars(hipblasComputeType_t compute)
+        {
+            if(compute == HIPBLAS_COMPUTE_16F || compute == HIPBLAS_COMPUTE_16F_PEDANTIC)
+            {
+                const uint16_t one = 0x3c00;
+                memcpy(alpha, &one, sizeof(one));
+            }
+            else if(compute == HIPBLAS_COMPUTE_64F || compute == HIPBLAS_COMPUTE_64F_PEDANTIC)
+            {
+                const double one = 1;
+                memcpy(alpha, &one, sizeof(one));
+            }
+            else if(compute == HIPBLAS_COMPUTE_32I || compute == HIPBLAS_COMPUTE_32I_PEDANTIC)
+            {
+                const int32_t one = 1;
+                memcpy(alpha, &one, sizeof(one));
+            }
+            else
+            {
+                const float one = 1;
+                memcpy(alpha, &one, sizeof(one));
+            }
+        }
+    };
+
+    // operands are placed 256 bytes apart
+    size_t align(size_t bytes)
+    {
+        return (bytes + 255) / 256 * 256;
+    }
+
+    bool fits_int(std::initializer_list<int64_t> values)
+    {
+        for(int64_t value : values)
+        {
+            if(value < INT32_MIN || value > INT32_MAX)
+                return false;
+        }
+        return true;
+    }
+
+    // the gemm functions, which are issued through hipblasGemmEx and hipblasGemmStridedBatchedEx
+    bool gemm_issue(const replay_call& call, replay_issue& replay)
+    {
+        const std::string function = field(call, "function", "");
+        const bool        strided  = function.find("strided_batched") != std::string::npos;
+
+        hipDataType a_type = string2hipblas_datatype(field(call, "a_type", "f32_r"));
+        hipDataType b_type = string2hipblas_datatype(field(call, "b_type", "f32_r"));
+        hipDataType c_type = string2hipblas_datatype(field(call, "c_type", "f32_r"));
+        size_t      a_size = hipblas_datatype_size(a_type);
+        size_t      b_size = hipblas_datatype_size(b_type);
+        size_t      c_size = hipblas_datatype_size(c_type);
+        if(!a_size || !b_size || !c_size)
+            return false;
+
+        hipblasComputeType_t compute
+            = call.fields.count("compute_type_gemm")
+                  ? string2hipblas_computetype(field(call, "compute_type_gemm", ""))
+                  : compute_type(string2hipblas_datatype(field(call, "compute_type", "f32_r")));
+
+        hipblasOperation_t transA = char2hipblas_operation(field(call, "transA", "N")[0]);
+        hipblasOperation_t transB = char2hipblas_operation(field(call, "transB", "N")[0]);
+
+        int64_t M        = field(call, "M");
+        int64_t N        = field(call, "N");
+        int64_t K        = field(call, "K");
+        int64_t lda      = field(call, "lda");
+        int64_t ldb      = field(call, "ldb");
+        int64_t ldc      = field(call, "ldc");
+        int64_t stride_a = field(call, "stride_a");
+        int64_t stride_b = field(call, "stride_b");
+        int64_t stride_c = field(call, "stride_c");
+        int64_t batch    = strided ? field(call, "batch_count", 1) : 1;
+        if(!fits_int({M, N, K, lda, ldb, ldc, batch}) || M < 0 || N < 0 || K < 0 || batch < 0)
+            return false;
+
+        // the operands of the last problem of the batch end a stride per problem further
+        int64_t last    = std::max<int64_t>(batch - 1, 0);
+        int64_t a_cols  = transA == HIPBLAS_OP_N ? K : M;
+        int64_t b_cols  = transB == HIPBLAS_OP_N ? N : K;
+        size_t  a_bytes = align((lda * a_cols + stride_a * last) * a_size);
+        size_t  b_bytes = align((ldb * b_cols + stride_b * last) * b_size);
+        size_t  c_bytes = align((ldc * N + stride_c * last) * c_size);
+
+        replay.bytes = a_bytes + b_bytes + c_bytes;
+
+        replay_scalars scalars(compute);
+        replay.issue = [=](hipblasHandle_t handle, char* arena) {
+            char* A = arena;
+            char* B = A + a_bytes;
+            char* C = B + b_bytes;
+            if(strided)
+                return hipblasGemmStridedBatchedEx(handle,
+                                                   transA,
+                                                   transB,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   scalars.alpha,
+                                                   A,
+                                                   a_type,
+                                                   lda,
+                                                   stride_a,
+                                                   B,
+                                                   b_type,
+                                                   ldb,
+                                                   stride_b,
+                                                   scalars.beta,
+                                                   C,
+                                                   c_type,
+                                                   ldc,
+                                                   stride_c,
+                                                   batch,
+                                                   compute,
+                                                   HIPBLAS_GEMM_DEFAULT);
+            return hipblasGemmEx(handle,
+                                 transA,
+                                 transB,
+                                 M,
+                                 N,
+                                 K,
+                                 scalars.alpha,
+                                 A,
+                                 a_type,
+                                 lda,
+                                 B,
+                                 b_type,
+                                 ldb,
+                                 scalars.beta,
+                                 C,
+                                 c_type,
+                                 ldc,
+                                 compute,
+                                 HIPBLAS_GEMM_DEFAULT);
+        };
+        return true;
+    }
+
+    // the real axpy, scal, dot and gemv
+    template <typename T>
+    struct level12_functions
+    {
+        hipblasStatus_t (*axpy)(hipblasHandle_t, int, const T*, const T*, int, T*, int);
+        hipblasStatus_t (*scal)(hipblasHandle_t, int, const T*, T*, int);
+        hipblasStatus_t (*dot)(hipblasHandle_t, int, const T*, int, const T*, int, T*);
+        hipblasStatus_t (*gemv)(hipblasHandle_t,
+                                hipblasOperation_t,
+                                int,
+                                int,
+                                const T*,
+                                const T*,
+                                int,
+                                const T*,
+                                int,
+                                const T*,
+                                T*,
+                                int);
+    };
+
+    const level12_functions<float> level12_s
+        = {hipblasSaxpy, hipblasSscal, hipblasSdot, hipblasSgemv};
+    const level12_functions<double> level12_d
+        = {hipblasDaxpy, hipblasDscal, hipblasDdot, hipblasDgemv};
+
+    template <typename T>
+    bool level12_issue(const replay_call& call, replay_issue& replay, level12_functions<T> blas)
+    {
+        const std::string  function = field(call, "function", "");
+        hipblasOperation_t trans    = char2hipblas_operation(field(call, "transA", "N")[0]);
+
+        int64_t M    = field(call, "M");
+        int64_t N    = field(call, "N");
+        int64_t lda  = field(call, "lda");
+        int64_t incx = field(call, "incx", 1);
+        int64_t incy = field(call, "incy", 1);
+        if(!fits_int({M, N, lda, incx, incy}) || M < 0 || N < 0)
+            return false;
+
+        // gemv reads x of the size of the columns of op(A) and writes y of its rows
+        int64_t x_len   = function == "gemv" ? (trans == HIPBLAS_OP_N ? N : M) : N;
+        int64_t y_len   = function == "gemv" ? (trans == HIPBLAS_OP_N ? M : N) : N;
+        size_t  a_bytes = function == "gemv" ? align(lda * N * sizeof(T)) : 0;
+        size_t  x_bytes = align(std::max<int64_t>(x_len * std::abs(incx), 1) * sizeof(T));
+        size_t  y_bytes = align(std::max<int64_t>(y_len * std::abs(incy), 1) * sizeof(T));
+
+        // dot writes its result after y
+        replay.bytes = a_bytes + x_bytes + y_bytes + align(sizeof(T));
+
+        const T one = 1, zero = 0;
+        if(function == "axpy")
+            replay.issue = [=](hipblasHandle_t handle, char* arena) {
+                return blas.axpy(handle, N, &one, (T*)arena, incx, (T*)(arena + x_bytes), incy);
+            };
+        else if(function == "scal")
+            replay.issue = [=](hipblasHandle_t handle, char* arena) {
+                return blas.scal(handle, N, &one, (T*)arena, incx);
+            };
+        else if(function == "dot")
+            // the result is left on the device, so that the call doesn't synchronize the stream
+            replay.issue = [=](hipblasHandle_t handle, char* arena) {
+                hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+                T*              x      = (T*)arena;
+                T*              y      = (T*)(arena + x_bytes);
+                T*              result = (T*)(arena + x_bytes + y_bytes);
+                hipblasStatus_t status = blas.dot(handle, N, x, incx, y, incy, result);
+                hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+                return status;
+            };
+        else if(function == "gemv")
+            replay.issue = [=](hipblasHandle_t handle, char* arena) {
+                T* A = (T*)arena;
+                T* x = (T*)(arena + a_bytes);
+                T* y = (T*)(arena + a_bytes + x_bytes);
+                return blas.gemv(handle, trans, M, N, &one, A, lda, x, incx, &zero, y, incy);
+            };
+        else
+            return false;
+        return true;
+    }
+
+    // sets the issue of a call, returning false if hipblas-replay doesn't replay its function
+    bool replay_issue_of(const replay_call& call, replay_issue& replay)
+    {
+        const std::string function = field(call, "function", "");
+        const std::string a_type   = field(call, "a_type", "");
+
+        if(function == "gemm" || function == "gemm_ex" || function == "gemm_strided_batched"
+           || function == "gemm_strided_batched_ex")
+            return gemm_issue(call, replay);
+        if(a_type == "f32_r")
+            return level12_issue(call, replay, level12_s);
+        if(a_type == "f64_r")
+            return level12_issue(call, replay, level12_d);
+        return false;
+    }
+
+    // a traced stream, with the handle and arena its calls are replayed with
+    struct replay_stream
+    {
+        hipStream_t     stream = nullptr;
+        hipblasHandle_t handle = nullptr;
+        char*           arena  = nullptr;
+        size_t          bytes  = 0;
+    };
+
+    void check(hipError_t status, const char* what)
+    {
+        if(status != hipSuccess)
+            throw std::runtime_error(std::string(what) + ": " + hipGetErrorString(status));
+    }
+
+    void check(hipblasStatus_t status, const char* what)
+    {
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            throw std::runtime_error(std::string(what) + ": " + hipblasStatusToString(status));
+    }
+}
+
+int main(int argc, char* argv[])
+try
+{
+    std::string trace;
+    int         device_id;
+    int         iters;
+    int         cold_iters;
+
+    options_description desc("hipblas-replay command line options");
+
+    // clang-format off
+    desc.add_options()
+        ("trace",
+         value<std::string>(&trace),
+         "Trace written by hipBLAS with HIPBLAS_TRACE_FILE")
+
+        ("device",
+         value<int>(&device_id)->default_value(0),
+         "Set default device to be used for subsequent program runs")
+
+        ("iters,i",
+         value<int>(&iters)->default_value(10),
+         "Timed replays of the trace")
+
+        ("cold_iters,j",
+         value<int>(&cold_iters)->default_value(2),
+         "Untimed replays of the trace before the timed ones")
+
+        ("help,h", "produces this help message");
+    // clang-format on
+
+    variables_map vm;
+    store(parse_command_line(argc, argv, desc), vm);
+    notify(vm);
+
+    if(trace.empty() || vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    if(iters < 1 || cold_iters < 0)
+        throw std::invalid_argument("Invalid value for --iters or --cold_iters");
+
+    std::ifstream file(trace);
+    if(!file)
+        throw std::invalid_argument("Cannot open --trace " + trace);
+
+    check(hipSetDevice(device_id), "hipSetDevice");
+
+    // the calls in their order, with the stream each is replayed on, and the functions that
+    // aren't replayed
+    std::vector<std::pair<replay_issue, size_t>> calls;
+    std::vector<replay_stream>                   streams;
+    std::map<std::string, size_t>                stream_ids;
+    std::map<std::string, size_t>                skipped;
+    size_t                                       traced_calls = 0, timed_calls = 0;
+    double                                       traced_us    = 0;
+
+    std::string line;
+    while(std::getline(file, line))
+    {
+        replay_call call;
+        if(!parse_line(line, call))
+            continue;
+        traced_calls++;
+
+        replay_issue replay;
+        if(!replay_issue_of(call, replay))
+        {
+            skipped[call.fields["function"]]++;
+            continue;
+        }
+
+        if(call.traced_us >= 0)
+        {
+            timed_calls++;
+            traced_us += call.traced_us;
+        }
+
+        auto it = stream_ids.emplace(call.stream, streams.size()).first;
+        if(it->second == streams.size())
+            streams.emplace_back();
+        replay_stream& stream = streams[it->second];
+        stream.bytes          = std::max(stream.bytes, replay.bytes);
+        calls.emplace_back(std::move(replay), it->second);
+    }
+
+    // Each traced stream gets a stream of its own, except the null stream which is replayed on
+    // the null stream, and an arena from the device pool that is sized for its largest call. The
+    // calls of a stream share its arena, as the calls of the application would its buffers.
+    // The arenas are filled with bytes of 0x3c, which are finite and normal numbers in each
+    // floating point type, so that no call runs on zeros, denormals or NaNs.
+    size_t arena_bytes = 0;
+    for(auto& id : stream_ids)
+    {
+        replay_stream& stream = streams[id.second];
+        if(id.first != "(nil)" && id.first != "0" && id.first != "0x0" && !id.first.empty())
+            check(hipStreamCreate(&stream.stream), "hipStreamCreate");
+        check(hipblasCreate(&stream.handle), "hipblasCreate");
+        check(hipblasSetStream(stream.handle, stream.stream), "hipblasSetStream");
+        check(device_pool_malloc((void**)&stream.arena, std::max<size_t>(stream.bytes, 1)),
+              "device_pool_malloc");
+        check(hipMemset(stream.arena, 0x3c, stream.bytes), "hipMemset");
+        arena_bytes += stream.bytes;
+    }
+    check(hipDeviceSynchronize(), "hipDeviceSynchronize");
+
+    char summary[256];
+    snprintf(summary,
+             sizeof(summary),
+             "%zu calls, %zu replayed on %zu streams with %.1f MiB of arenas",
+             traced_calls,
+             calls.size(),
+             streams.size(),
+             arena_bytes / double(1 << 20));
+    std::cout << trace << ": " << summary << std::endl;
+    for(auto& function : skipped)
+        std::cout << "  skipped " << function.second << " calls of " << function.first
+                  << std::endl;
+
+    std::vector<double> pass_us;
+    for(int pass = 0; pass < cold_iters + iters; pass++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for(auto& call : calls)
+        {
+            replay_stream& stream = streams[call.second];
+            check(call.first.issue(stream.handle, stream.arena), "replayed call");
+        }
+        check(hipDeviceSynchronize(), "hipDeviceSynchronize");
+        auto stop = std::chrono::steady_clock::now();
+
+        if(pass >= cold_iters)
+            pass_us.push_back(std::chrono::duration<double, std::micro>(stop - start).count());
+    }
+
+    std::sort(pass_us.begin(), pass_us.end());
+    size_t n      = pass_us.size();
+    double median = n % 2 ? pass_us[n / 2] : (pass_us[n / 2 - 1] + pass_us[n / 2]) / 2;
+
+    snprintf(summary,
+             sizeof(summary),
+             "replay: median %.3f us, min %.3f us, max %.3f us over %d passes",
+             median,
+             pass_us.front(),
+             pass_us.back(),
+             iters);
+    std::cout << summary << std::endl;
+    if(timed_calls)
+    {
+        snprintf(summary,
+                 sizeof(summary),
+                 "traced: %.3f us of GPU time in %zu timed calls of the replayed functions",
+                 traced_us,
+                 timed_calls);
+        std::cout << summary << std::endl;
+    }
+
+    for(auto& stream : streams)
+    {
+        device_pool_free(stream.arena);
+        hipblasDestroy(stream.handle);
+        if(stream.stream)
+            hipStreamDestroy(stream.stream);
+    }
+    test_cleanup::cleanup();
+    return 0;
+}
+catch(const std::exception& e)
+{
+    std::cerr << e.what() << std::endl;
+    return -1;
+}
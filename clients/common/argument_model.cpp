@@ -21,6 +21,28 @@
  * ************************************************************************ */
 
 #include "argument_model.hpp"
+#include "hipblas_telemetry.hpp"
+
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifndef WIN32
+#include <sys/utsname.h>
+#include <unistd.h>
+#endif
 
 // this should have been a member variable but due to the complex variadic template this singleton allows global control
 
@@ -47,3 +69,593 @@ bool ArgumentModel_get_log_datatype()
 {
     return log_datatype;
 }
+
+static thread_local ArgumentModel_perf last_perf;
+
+void ArgumentModel_set_last_perf(const ArgumentModel_perf& perf)
+{
+    last_perf = perf;
+}
+
+ArgumentModel_perf ArgumentModel_get_last_perf()
+{
+    return last_perf;
+}
+
+void ArgumentModel_log_iteration_statistics(std::stringstream& name_line,
+                                            std::stringstream& val_line)
+{
+    const std::vector<double>& iteration_times = hipblas_iteration_timer::last_iteration_us();
+
+    name_line << "hipblas-us-min,hipblas-us-median,hipblas-us-p95,hipblas-us-p99,hipblas-us-cv,";
+    if(iteration_times.empty())
+    {
+        for(int i = 0; i < 5; i++)
+            val_line << ArgumentLogging::NA_value << ", ";
+        return;
+    }
+
+    std::vector<double> t(iteration_times);
+    std::sort(t.begin(), t.end());
+    size_t n = t.size();
+
+    // nearest rank percentiles
+    auto percentile = [&](double p) { return t[size_t(std::ceil(p * n)) - 1]; };
+
+    double median = n % 2 ? t[n / 2] : (t[n / 2 - 1] + t[n / 2]) / 2;
+
+    double mean = 0;
+    for(double x : t)
+        mean += x;
+    mean /= n;
+    double variance = 0;
+    for(double x : t)
+        variance += (x - mean) * (x - mean);
+    variance /= n;
+    double cv = mean > 0 ? std::sqrt(variance) / mean : 0;
+
+    val_line << t[0] << ", " << median << ", " << percentile(0.95) << ", " << percentile(0.99)
+             << ", " << cv << ", ";
+}
+
+namespace
+{
+    // the peak of the data type of arg, the arithmetic intensity and the percentages of the peaks
+    // and of the roofline that the rates reach
+    struct roofline_percentages
+    {
+        double peak_gflops, intensity, gflops, GBps, roofline;
+    };
+
+    roofline_percentages roofline_of(const hipblas_device_roofline& roofline,
+                                     const Arguments&               arg,
+                                     double                         hipblas_gflops,
+                                     double                         hipblas_GBps,
+                                     double                         gflops,
+                                     double                         gbytes)
+    {
+        double peak_gflops = roofline.peak_gflops(arg.a_type);
+        double intensity   = gbytes > 0 ? gflops / gbytes : ArgumentLogging::NA_value;
+
+        // the roofline is the lower of the compute peak and what the bandwidth can feed
+        double attainable = peak_gflops;
+        if(peak_gflops > 0 && gbytes > 0)
+            attainable = std::min(peak_gflops, intensity * roofline.GBps);
+
+        auto percent = [](double rate, double peak) {
+            return peak > 0 ? 100 * rate / peak : ArgumentLogging::NA_value;
+        };
+
+        return {peak_gflops > 0 ? peak_gflops : ArgumentLogging::NA_value,
+                intensity,
+                percent(hipblas_gflops, peak_gflops),
+                percent(hipblas_GBps, roofline.GBps),
+                percent(hipblas_gflops, attainable)};
+    }
+}
+
+void ArgumentModel_log_roofline(std::stringstream& name_line,
+                                std::stringstream& val_line,
+                                const Arguments&   arg,
+                                double             hipblas_gflops,
+                                double             hipblas_GBps,
+                                double             gflops,
+                                double             gbytes)
+{
+    const hipblas_device_roofline& roofline = hipblas_device_roofline::current();
+    roofline_percentages           percentages
+        = roofline_of(roofline, arg, hipblas_gflops, hipblas_GBps, gflops, gbytes);
+
+    name_line << "arch,peak-Gflops,peak-GB/s,flops/byte,hipblas-%peak-Gflops,hipblas-%peak-GB/s,"
+                 "hipblas-%roofline,";
+    val_line << roofline.arch << ", " << percentages.peak_gflops << ", " << roofline.GBps << ", "
+             << percentages.intensity << ", " << percentages.gflops << ", " << percentages.GBps
+             << ", " << percentages.roofline << ", ";
+}
+
+void ArgumentModel_check_perf_threshold(const Arguments& arg,
+                                        double           hipblas_gflops,
+                                        double           hipblas_GBps,
+                                        double           gflops,
+                                        double           gbytes)
+{
+    const hipblas_device_roofline& roofline = hipblas_device_roofline::current();
+    roofline_percentages           percentages
+        = roofline_of(roofline, arg, hipblas_gflops, hipblas_GBps, gflops, gbytes);
+
+    // without a peak for the type of arg, or a model of the bytes, there is nothing to compare with
+    double percent = percentages.roofline;
+    if(percent == ArgumentLogging::NA_value || !std::isfinite(percent))
+        return;
+
+#ifdef GOOGLE_TEST
+    EXPECT_GE(percent, arg.perf_threshold)
+        << arg.function << " reached " << percent << "% of the roofline of " << roofline.arch
+        << ", below the threshold of " << arg.perf_threshold << "%";
+#else
+    if(percent < arg.perf_threshold)
+        std::cerr << "warning: " << arg.function << " reached " << percent
+                  << "% of the roofline of " << roofline.arch << ", below the threshold of "
+                  << arg.perf_threshold << "%" << std::endl;
+#endif
+}
+
+namespace
+{
+    // the telemetry fields, with NA_value for what wasn't sampled
+    struct telemetry_fields
+    {
+        double watts, mJ_per_call, gflops_per_watt, sclk_mhz, mclk_mhz, max_temp_c;
+    };
+
+    telemetry_fields telemetry_of(double hipblas_gflops, double us_per_call)
+    {
+        const hipblas_telemetry_summary& summary = hipblas_telemetry::last();
+
+        bool watts = summary.watts > 0;
+        return {watts ? summary.watts : ArgumentLogging::NA_value,
+                watts ? summary.watts * us_per_call * 1e-3 : ArgumentLogging::NA_value,
+                watts ? hipblas_gflops / summary.watts : ArgumentLogging::NA_value,
+                summary.sclk_mhz,
+                summary.mclk_mhz,
+                summary.max_temp_c};
+    }
+}
+
+void ArgumentModel_log_telemetry(std::stringstream& name_line,
+                                 std::stringstream& val_line,
+                                 double             hipblas_gflops,
+                                 double             us_per_call)
+{
+    telemetry_fields fields = telemetry_of(hipblas_gflops, us_per_call);
+
+    name_line << "power-W,energy-mJ-per-call,Gflops/W,sclk-MHz,mclk-MHz,temp-max-C,";
+    val_line << fields.watts << ", " << fields.mJ_per_call << ", " << fields.gflops_per_watt << ", "
+             << fields.sclk_mhz << ", " << fields.mclk_mhz << ", " << fields.max_temp_c << ", ";
+}
+
+namespace
+{
+    // the memory fields in bytes, with NA_value for what wasn't measured
+    struct memory_fields
+    {
+        double operands, workspace, growth, footprint;
+    };
+
+    memory_fields memory_of()
+    {
+        const hipblas_memory_footprint& last = hipblas_iteration_timer::last_memory_footprint();
+
+        auto field = [](int64_t bytes) {
+            return bytes >= 0 ? double(bytes) : ArgumentLogging::NA_value;
+        };
+        double footprint = ArgumentLogging::NA_value;
+        if(last.operand_bytes >= 0)
+            footprint = double(last.operand_bytes
+                               + std::max({last.workspace_bytes, last.growth_bytes, int64_t(0)}));
+        return {field(last.operand_bytes),
+                field(last.workspace_bytes),
+                field(last.growth_bytes),
+                footprint};
+    }
+}
+
+void ArgumentModel_log_memory_footprint(std::stringstream& name_line, std::stringstream& val_line)
+{
+    memory_fields fields = memory_of();
+
+    name_line << "operand-bytes,workspace-bytes,growth-bytes,footprint-bytes,";
+    val_line << fields.operands << ", " << fields.workspace << ", " << fields.growth << ", "
+             << fields.footprint << ", ";
+}
+
+namespace
+{
+    // the models per call and the counters, with NA_value for the counters that weren't
+    // collected, and for the bytes the counters measured when FETCH_SIZE or WRITE_SIZE wasn't
+    struct counters_fields
+    {
+        double                                      model_gflop, model_gbyte, gbyte, gbyte_ratio;
+        std::vector<std::pair<std::string, double>> values;
+    };
+
+    counters_fields counters_of(double hipblas_gflops, double hipblas_GBps, double us_per_call)
+    {
+        counters_fields fields{hipblas_gflops * us_per_call * 1e-6,
+                               hipblas_GBps * us_per_call * 1e-6,
+                               ArgumentLogging::NA_value,
+                               ArgumentLogging::NA_value,
+                               hipblas_counters::last()};
+
+        // the kilobytes read from and written to device memory
+        double fetch_kb = -1, write_kb = -1;
+        for(auto& counter : fields.values)
+        {
+            if(counter.first == "FETCH_SIZE")
+                fetch_kb = counter.second;
+            else if(counter.first == "WRITE_SIZE")
+                write_kb = counter.second;
+        }
+        if(fetch_kb >= 0 && write_kb >= 0)
+        {
+            fields.gbyte = (fetch_kb + write_kb) * 1024 * 1e-9;
+            if(fields.model_gbyte > 0)
+                fields.gbyte_ratio = fields.gbyte / fields.model_gbyte;
+        }
+        return fields;
+    }
+}
+
+void ArgumentModel_log_counters(std::stringstream& name_line,
+                                std::stringstream& val_line,
+                                double             hipblas_gflops,
+                                double             hipblas_GBps,
+                                double             us_per_call)
+{
+    counters_fields fields = counters_of(hipblas_gflops, hipblas_GBps, us_per_call);
+
+    name_line << "model-Gflop-per-call,model-GB-per-call,";
+    val_line << fields.model_gflop << ", " << fields.model_gbyte << ", ";
+    for(auto& counter : fields.values)
+    {
+        name_line << counter.first << ",";
+        val_line << counter.second << ", ";
+    }
+    name_line << "counted-GB-per-call,counted/model-GB,";
+    val_line << fields.gbyte << ", " << fields.gbyte_ratio << ", ";
+}
+
+namespace
+{
+    std::string   output_format;
+    std::ofstream output_file;
+    std::ofstream baseline_file;
+    bool          output_header = false;
+    std::mutex    output_mutex;
+
+    // the (name, value) fields of a record, with whether each value is a string
+    class record
+    {
+        std::vector<std::pair<std::string, std::pair<std::string, bool>>> m_fields;
+
+        template <typename T>
+        void number(const char* name, T value)
+        {
+            std::ostringstream value_str;
+            value_str.precision(std::is_floating_point<T>{} ? 10 : 6);
+            value_str << value;
+            m_fields.push_back({name, {value_str.str(), false}});
+        }
+
+    public:
+        void add(const char* name, const std::string& value)
+        {
+            m_fields.push_back({name, {value, true}});
+        }
+
+        // char arrays of Arguments, such as gpu_arch, aren't always null terminated
+        template <size_t N>
+        void add(const char* name, const char (&value)[N])
+        {
+            add(name, std::string(value, strnlen(value, N)));
+        }
+
+        void add(const char* name, char value)
+        {
+            add(name, std::string(1, value));
+        }
+
+        void add(const char* name, bool value)
+        {
+            m_fields.push_back({name, {value ? "true" : "false", false}});
+        }
+
+        void add(const char* name, hipblasDatatype_t value)
+        {
+            add(name, std::string(hipblas_datatype2string(value)));
+        }
+
+        void add(const char* name, hipblasComputeType_t value)
+        {
+            add(name, std::string(hipblas_computetype2string(value)));
+        }
+
+        void add(const char* name, const std::vector<double>& values)
+        {
+            std::ostringstream value_str;
+            value_str.precision(10);
+            value_str << "[";
+            for(size_t i = 0; i < values.size(); i++)
+                value_str << (i ? ", " : "") << values[i];
+            value_str << "]";
+            m_fields.push_back({name, {value_str.str(), false}});
+        }
+
+        void add(const char* name, hipblas_initialization value)
+        {
+            std::ostringstream value_str;
+            value_str << value;
+            add(name, value_str.str());
+        }
+
+        template <typename T, std::enable_if_t<std::is_arithmetic<T>{}, int> = 0>
+        void add(const char* name, T value)
+        {
+            number(name, value);
+        }
+
+        template <typename T, std::enable_if_t<std::is_enum<T>{}, int> = 0>
+        void add(const char* name, T value)
+        {
+            number(name, int64_t(value));
+        }
+
+        void write_json(std::ostream& os) const
+        {
+            auto quote = [&](const std::string& str) {
+                os << '"';
+                for(char c : str)
+                {
+                    if(c == '"' || c == '\\')
+                        os << '\\';
+                    os << c;
+                }
+                os << '"';
+            };
+
+            const char* delim = "{";
+            for(auto& field : m_fields)
+            {
+                os << delim;
+                quote(field.first);
+                os << ": ";
+                if(field.second.second)
+                    quote(field.second.first);
+                else
+                    os << field.second.first;
+                delim = ", ";
+            }
+            os << "}\n";
+        }
+
+        void write_csv(std::ostream& os, bool header) const
+        {
+            auto quote = [&](const std::string& str) {
+                if(str.find_first_of(",\"\n") == std::string::npos)
+                {
+                    os << str;
+                    return;
+                }
+                os << '"';
+                for(char c : str)
+                {
+                    if(c == '"')
+                        os << '"';
+                    os << c;
+                }
+                os << '"';
+            };
+
+            if(header)
+            {
+                for(size_t i = 0; i < m_fields.size(); i++)
+                {
+                    os << (i ? "," : "");
+                    quote(m_fields[i].first);
+                }
+                os << "\n";
+            }
+            for(size_t i = 0; i < m_fields.size(); i++)
+            {
+                os << (i ? "," : "");
+                quote(m_fields[i].second.first);
+            }
+            os << "\n";
+        }
+    };
+
+    // the environment of the records of a device, queried once
+    const record& environment(int device)
+    {
+        static std::map<int, record> environments;
+
+        auto found = environments.find(device);
+        if(found != environments.end())
+            return found->second;
+
+        record          env;
+        hipDeviceProp_t props;
+        int             driver = 0, runtime = 0;
+        char            backend[256] = "";
+        (void)hipGetDeviceProperties(&props, device);
+        (void)hipDriverGetVersion(&driver);
+        (void)hipRuntimeGetVersion(&runtime);
+        (void)hipblasGetBackendVersionString(backend, sizeof(backend));
+
+        // the host part of what scripts/performance/blas/getspecs.py collects
+        std::string host_name, host_kernel;
+        int64_t     host_memory = 0;
+#ifndef WIN32
+        struct utsname host;
+        if(!uname(&host))
+        {
+            host_name   = host.nodename;
+            host_kernel = std::string(host.sysname) + " " + host.release;
+        }
+        host_memory = int64_t(sysconf(_SC_PHYS_PAGES)) * sysconf(_SC_PAGESIZE);
+#endif
+
+        env.add("device", device);
+        env.add("device_name", props.name);
+        env.add("device_arch", props.gcnArchName);
+        env.add("compute_units", props.multiProcessorCount);
+        env.add("clock_khz", props.clockRate);
+        env.add("memory_clock_khz", props.memoryClockRate);
+        env.add("memory_bus_width", props.memoryBusWidth);
+        env.add("memory_bytes", props.totalGlobalMem);
+        env.add("l2_cache_bytes", props.l2CacheSize);
+        env.add("pci_bus_id", props.pciBusID);
+        env.add("driver_version", driver);
+        env.add("hip_runtime_version", runtime);
+#ifdef __HIP_PLATFORM_NVIDIA__
+        env.add("backend", "cuBLAS");
+#else
+        env.add("backend", "rocBLAS");
+#endif
+        env.add("backend_version", backend);
+        env.add("host_name", host_name);
+        env.add("host_kernel", host_kernel);
+        env.add("host_memory_bytes", host_memory);
+        env.add("hipblas_version",
+                std::to_string(hipblasVersionMajor) + "." + std::to_string(hipblasVersionMinor)
+                    + "." + std::to_string(hipblasVersionPatch));
+#ifdef hipblasVersionCommitId
+        env.add("hipblas_commit", hipblasVersionCommitId);
+#else
+        env.add("hipblas_commit", "");
+#endif
+
+        return environments.emplace(device, env).first->second;
+    }
+}
+
+void ArgumentModel_set_output(const std::string& format, const std::string& path)
+{
+    if(format != "json" && format != "csv")
+        throw std::invalid_argument("Invalid value for --output " + format);
+
+    output_file.open(path);
+    if(!output_file)
+        throw std::invalid_argument("Cannot open --output_file " + path);
+    output_format = format;
+}
+
+void ArgumentModel_set_baseline(const std::string& path)
+{
+    baseline_file.open(path);
+    if(!baseline_file)
+        throw std::invalid_argument("Cannot open --baseline " + path);
+}
+
+void ArgumentModel_log_record(const Arguments& arg,
+                              double           us,
+                              double           hipblas_gflops,
+                              double           hipblas_GBps,
+                              double           gflops,
+                              double           gbytes,
+                              double           norm1,
+                              double           norm2)
+{
+    if(output_format.empty() && !baseline_file.is_open())
+        return;
+
+    int device = 0;
+    (void)hipGetDevice(&device);
+
+    // hipblas-bench --parallel_devices logs from a thread per device
+    std::lock_guard<std::mutex> lock(output_mutex);
+
+    record rec(environment(device));
+#define RECORD_ARGUMENT(NAME) rec.add(#NAME, arg.NAME)
+    FOR_EACH_ARGUMENT(RECORD_ARGUMENT, ;);
+#undef RECORD_ARGUMENT
+
+    rec.add("hipblas-us", us);
+    rec.add("hipblas-Gflops", hipblas_gflops);
+    rec.add("hipblas-GB/s", hipblas_GBps);
+    rec.add("norm_error_host_ptr", arg.norm_check ? norm1 : ArgumentLogging::NA_value);
+    rec.add("norm_error_device_ptr", arg.norm_check ? norm2 : ArgumentLogging::NA_value);
+
+    // the fields are there without --roofline too, so that the csv columns don't change
+    roofline_percentages percentages{ArgumentLogging::NA_value,
+                                     ArgumentLogging::NA_value,
+                                     ArgumentLogging::NA_value,
+                                     ArgumentLogging::NA_value,
+                                     ArgumentLogging::NA_value};
+    double               peak_GBps = ArgumentLogging::NA_value;
+    if(arg.roofline)
+    {
+        const hipblas_device_roofline& roofline = hipblas_device_roofline::current();
+        percentages = roofline_of(roofline, arg, hipblas_gflops, hipblas_GBps, gflops, gbytes);
+        peak_GBps   = roofline.GBps;
+    }
+    rec.add("peak-Gflops", percentages.peak_gflops);
+    rec.add("peak-GB/s", peak_GBps);
+    rec.add("flops/byte", percentages.intensity);
+    rec.add("hipblas-%peak-Gflops", percentages.gflops);
+    rec.add("hipblas-%peak-GB/s", percentages.GBps);
+    rec.add("hipblas-%roofline", percentages.roofline);
+
+    telemetry_fields telemetry{ArgumentLogging::NA_value,
+                               ArgumentLogging::NA_value,
+                               ArgumentLogging::NA_value,
+                               ArgumentLogging::NA_value,
+                               ArgumentLogging::NA_value,
+                               ArgumentLogging::NA_value};
+    if(arg.telemetry)
+        telemetry = telemetry_of(hipblas_gflops, us);
+    rec.add("power-W", telemetry.watts);
+    rec.add("energy-mJ-per-call", telemetry.mJ_per_call);
+    rec.add("Gflops/W", telemetry.gflops_per_watt);
+    rec.add("sclk-MHz", telemetry.sclk_mhz);
+    rec.add("mclk-MHz", telemetry.mclk_mhz);
+    rec.add("temp-max-C", telemetry.max_temp_c);
+
+    memory_fields memory{ArgumentLogging::NA_value,
+                         ArgumentLogging::NA_value,
+                         ArgumentLogging::NA_value,
+                         ArgumentLogging::NA_value};
+    if(arg.memory_footprint)
+        memory = memory_of();
+    rec.add("operand-bytes", memory.operands);
+    rec.add("workspace-bytes", memory.workspace);
+    rec.add("growth-bytes", memory.growth);
+    rec.add("footprint-bytes", memory.footprint);
+
+    if(hipblas_counters::selected())
+    {
+        counters_fields fields = counters_of(hipblas_gflops, hipblas_GBps, us);
+        rec.add("model-Gflop-per-call", fields.model_gflop);
+        rec.add("model-GB-per-call", fields.model_gbyte);
+        for(auto& counter : fields.values)
+            rec.add(counter.first.c_str(), counter.second);
+        rec.add("counted-GB-per-call", fields.gbyte);
+        rec.add("counted/model-GB", fields.gbyte_ratio);
+    }
+
+    if(output_format == "json")
+        rec.write_json(output_file);
+    else if(output_format == "csv")
+    {
+        rec.write_csv(output_file, !output_header);
+        output_header = true;
+    }
+    output_file.flush();
+
+    if(baseline_file.is_open())
+    {
+        rec.add("hipblas-us-iterations", hipblas_iteration_timer::last_iteration_us());
+        rec.write_json(baseline_file);
+        baseline_file.flush();
+    }
+}
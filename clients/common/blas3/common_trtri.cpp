@@ -0,0 +1,45 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "blas3/testing_trtri.hpp"
+#include "blas3/testing_trtri_batched.hpp"
+#include "blas3/testing_trtri_strided_batched.hpp"
+
+// The testing templates of this family for the types that hipblas-bench runs them with. The
+// testing headers declare them extern, so that the other sources don't instantiate them again
+
+template void testing_trtri<float>(const Arguments&);
+template void testing_trtri_batched<float>(const Arguments&);
+template void testing_trtri_strided_batched<float>(const Arguments&);
+
+template void testing_trtri<double>(const Arguments&);
+template void testing_trtri_batched<double>(const Arguments&);
+template void testing_trtri_strided_batched<double>(const Arguments&);
+
+template void testing_trtri<hipblasComplex>(const Arguments&);
+template void testing_trtri_batched<hipblasComplex>(const Arguments&);
+template void testing_trtri_strided_batched<hipblasComplex>(const Arguments&);
+
+template void testing_trtri<hipblasDoubleComplex>(const Arguments&);
+template void testing_trtri_batched<hipblasDoubleComplex>(const Arguments&);
+template void testing_trtri_strided_batched<hipblasDoubleComplex>(const Arguments&);
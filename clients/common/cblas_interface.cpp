@@ -49,6 +49,138 @@ void dpotrf_(char* uplo, int* m, double* A, int* lda, int* info);
 void cpotrf_(char* uplo, int* m, hipblasComplex* A, int* lda, int* info);
 void zpotrf_(char* uplo, int* m, hipblasDoubleComplex* A, int* lda, int* info);
 
+void spotrs_(char* uplo, int* n, int* nrhs, float* A, int* lda, float* B, int* ldb, int* info);
+void dpotrs_(char* uplo, int* n, int* nrhs, double* A, int* lda, double* B, int* ldb, int* info);
+void cpotrs_(char*           uplo,
+             int*            n,
+             int*            nrhs,
+             hipblasComplex* A,
+             int*            lda,
+             hipblasComplex* B,
+             int*            ldb,
+             int*            info);
+void zpotrs_(char*                 uplo,
+             int*                  n,
+             int*                  nrhs,
+             hipblasDoubleComplex* A,
+             int*                  lda,
+             hipblasDoubleComplex* B,
+             int*                  ldb,
+             int*                  info);
+
+void spotri_(char* uplo, int* n, float* A, int* lda, int* info);
+void dpotri_(char* uplo, int* n, double* A, int* lda, int* info);
+void cpotri_(char* uplo, int* n, hipblasComplex* A, int* lda, int* info);
+void zpotri_(char* uplo, int* n, hipblasDoubleComplex* A, int* lda, int* info);
+
+void ssyevd_(char*  jobz,
+             char*  uplo,
+             int*   n,
+             float* A,
+             int*   lda,
+             float* W,
+             float* work,
+             int*   lwork,
+             int*   iwork,
+             int*   liwork,
+             int*   info);
+void dsyevd_(char*   jobz,
+             char*   uplo,
+             int*    n,
+             double* A,
+             int*    lda,
+             double* W,
+             double* work,
+             int*    lwork,
+             int*    iwork,
+             int*    liwork,
+             int*    info);
+void cheevd_(char*           jobz,
+             char*           uplo,
+             int*            n,
+             hipblasComplex* A,
+             int*            lda,
+             float*          W,
+             hipblasComplex* work,
+             int*            lwork,
+             float*          rwork,
+             int*            lrwork,
+             int*            iwork,
+             int*            liwork,
+             int*            info);
+void zheevd_(char*                 jobz,
+             char*                 uplo,
+             int*                  n,
+             hipblasDoubleComplex* A,
+             int*                  lda,
+             double*               W,
+             hipblasDoubleComplex* work,
+             int*                  lwork,
+             double*               rwork,
+             int*                  lrwork,
+             int*                  iwork,
+             int*                  liwork,
+             int*                  info);
+
+void sgesvd_(char*  jobu,
+             char*  jobvt,
+             int*   m,
+             int*   n,
+             float* A,
+             int*   lda,
+             float* S,
+             float* U,
+             int*   ldu,
+             float* V,
+             int*   ldv,
+             float* work,
+             int*   lwork,
+             int*   info);
+void dgesvd_(char*   jobu,
+             char*   jobvt,
+             int*    m,
+             int*    n,
+             double* A,
+             int*    lda,
+             double* S,
+             double* U,
+             int*    ldu,
+             double* V,
+             int*    ldv,
+             double* work,
+             int*    lwork,
+             int*    info);
+void cgesvd_(char*           jobu,
+             char*           jobvt,
+             int*            m,
+             int*            n,
+             hipblasComplex* A,
+             int*            lda,
+             float*          S,
+             hipblasComplex* U,
+             int*            ldu,
+             hipblasComplex* V,
+             int*            ldv,
+             hipblasComplex* work,
+             int*            lwork,
+             float*          rwork,
+             int*            info);
+void zgesvd_(char*                 jobu,
+             char*                 jobvt,
+             int*                  m,
+             int*                  n,
+             hipblasDoubleComplex* A,
+             int*                  lda,
+             double*               S,
+             hipblasDoubleComplex* U,
+             int*                  ldu,
+             hipblasDoubleComplex* V,
+             int*                  ldv,
+             hipblasDoubleComplex* work,
+             int*                  lwork,
+             double*               rwork,
+             int*                  info);
+
 void sgetrf_(int* m, int* n, float* A, int* lda, int* ipiv, int* info);
 void dgetrf_(int* m, int* n, double* A, int* lda, int* ipiv, int* info);
 void cgetrf_(int* m, int* n, hipblasComplex* A, int* lda, int* ipiv, int* info);
@@ -4017,6 +4149,160 @@ int ref_potrf(char uplo, int m, hipblasDoubleComplex* A, int lda)
     return info;
 }
 
+// potrs
+template <>
+int ref_potrs<float>(char uplo, int n, int nrhs, float* A, int lda, float* B, int ldb)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+
+    info_64 = LAPACKE_spotrs(LAPACK_COL_MAJOR, uplo, n, nrhs, A, lda, B, ldb);
+    info    = info_64;
+#else
+    spotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_potrs<double>(char uplo, int n, int nrhs, double* A, int lda, double* B, int ldb)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+
+    info_64 = LAPACKE_dpotrs(LAPACK_COL_MAJOR, uplo, n, nrhs, A, lda, B, ldb);
+    info    = info_64;
+#else
+    dpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_potrs<hipblasComplex>(
+    char uplo, int n, int nrhs, hipblasComplex* A, int lda, hipblasComplex* B, int ldb)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+
+    info_64 = LAPACKE_cpotrs(LAPACK_COL_MAJOR,
+                             uplo,
+                             n,
+                             nrhs,
+                             (lapack_complex_float*)A,
+                             lda,
+                             (lapack_complex_float*)B,
+                             ldb);
+    info    = info_64;
+#else
+    cpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_potrs<hipblasDoubleComplex>(
+    char uplo, int n, int nrhs, hipblasDoubleComplex* A, int lda, hipblasDoubleComplex* B, int ldb)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+
+    info_64 = LAPACKE_zpotrs(LAPACK_COL_MAJOR,
+                             uplo,
+                             n,
+                             nrhs,
+                             (lapack_complex_double*)A,
+                             lda,
+                             (lapack_complex_double*)B,
+                             ldb);
+    info    = info_64;
+#else
+    zpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+#endif
+
+    return info;
+}
+
+// potri
+template <>
+int ref_potri<float>(char uplo, int n, float* A, int lda)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+
+    info_64 = LAPACKE_spotri(LAPACK_COL_MAJOR, uplo, n, A, lda);
+    info    = info_64;
+#else
+    spotri_(&uplo, &n, A, &lda, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_potri<double>(char uplo, int n, double* A, int lda)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+
+    info_64 = LAPACKE_dpotri(LAPACK_COL_MAJOR, uplo, n, A, lda);
+    info    = info_64;
+#else
+    dpotri_(&uplo, &n, A, &lda, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_potri<hipblasComplex>(char uplo, int n, hipblasComplex* A, int lda)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+
+    info_64 = LAPACKE_cpotri(LAPACK_COL_MAJOR, uplo, n, (lapack_complex_float*)A, lda);
+    info    = info_64;
+#else
+    cpotri_(&uplo, &n, A, &lda, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_potri<hipblasDoubleComplex>(char uplo, int n, hipblasDoubleComplex* A, int lda)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+
+    info_64 = LAPACKE_zpotri(LAPACK_COL_MAJOR, uplo, n, (lapack_complex_double*)A, lda);
+    info    = info_64;
+#else
+    zpotri_(&uplo, &n, A, &lda, &info);
+#endif
+
+    return info;
+}
+
 // getrf
 template <>
 int ref_getrf<float>(int m, int n, float* A, int lda, int* ipiv)
@@ -4500,4 +4786,321 @@ int ref_gels<hipblasDoubleComplex>(char                  trans,
     return info;
 }
 
+// syevd, heevd
+template <>
+int ref_syevd<float>(char jobz, char uplo, int n, float* A, int lda, float* W)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+
+    info_64 = LAPACKE_ssyevd(LAPACK_COL_MAJOR, jobz, uplo, n, A, lda, W);
+    info    = info_64;
+#else
+    // workspace query
+    float work_size;
+    int   iwork_size;
+    int   lwork  = -1;
+    int   liwork = -1;
+    ssyevd_(&jobz, &uplo, &n, A, &lda, W, &work_size, &lwork, &iwork_size, &liwork, &info);
+
+    lwork  = int(work_size);
+    liwork = iwork_size;
+    host_vector<float> work(lwork);
+    host_vector<int>   iwork(liwork);
+    ssyevd_(&jobz, &uplo, &n, A, &lda, W, work, &lwork, iwork, &liwork, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_syevd<double>(char jobz, char uplo, int n, double* A, int lda, double* W)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+
+    info_64 = LAPACKE_dsyevd(LAPACK_COL_MAJOR, jobz, uplo, n, A, lda, W);
+    info    = info_64;
+#else
+    // workspace query
+    double work_size;
+    int    iwork_size;
+    int    lwork  = -1;
+    int    liwork = -1;
+    dsyevd_(&jobz, &uplo, &n, A, &lda, W, &work_size, &lwork, &iwork_size, &liwork, &info);
+
+    lwork  = int(work_size);
+    liwork = iwork_size;
+    host_vector<double> work(lwork);
+    host_vector<int>    iwork(liwork);
+    dsyevd_(&jobz, &uplo, &n, A, &lda, W, work, &lwork, iwork, &liwork, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_syevd<hipblasComplex>(char jobz, char uplo, int n, hipblasComplex* A, int lda, float* W)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+
+    info_64 = LAPACKE_cheevd(LAPACK_COL_MAJOR, jobz, uplo, n, (lapack_complex_float*)A, lda, W);
+    info    = info_64;
+#else
+    // workspace query
+    hipblasComplex work_size;
+    float          rwork_size;
+    int            iwork_size;
+    int            lwork  = -1;
+    int            lrwork = -1;
+    int            liwork = -1;
+    cheevd_(&jobz,
+            &uplo,
+            &n,
+            A,
+            &lda,
+            W,
+            &work_size,
+            &lwork,
+            &rwork_size,
+            &lrwork,
+            &iwork_size,
+            &liwork,
+            &info);
+
+    lwork  = int(std::real(work_size));
+    lrwork = int(rwork_size);
+    liwork = iwork_size;
+    host_vector<hipblasComplex> work(lwork);
+    host_vector<float>          rwork(lrwork);
+    host_vector<int>            iwork(liwork);
+    cheevd_(
+        &jobz, &uplo, &n, A, &lda, W, work, &lwork, rwork, &lrwork, iwork, &liwork, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_syevd<hipblasDoubleComplex>(
+    char jobz, char uplo, int n, hipblasDoubleComplex* A, int lda, double* W)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+
+    info_64 = LAPACKE_zheevd(LAPACK_COL_MAJOR, jobz, uplo, n, (lapack_complex_double*)A, lda, W);
+    info    = info_64;
+#else
+    // workspace query
+    hipblasDoubleComplex work_size;
+    double               rwork_size;
+    int                  iwork_size;
+    int                  lwork  = -1;
+    int                  lrwork = -1;
+    int                  liwork = -1;
+    zheevd_(&jobz,
+            &uplo,
+            &n,
+            A,
+            &lda,
+            W,
+            &work_size,
+            &lwork,
+            &rwork_size,
+            &lrwork,
+            &iwork_size,
+            &liwork,
+            &info);
+
+    lwork  = int(std::real(work_size));
+    lrwork = int(rwork_size);
+    liwork = iwork_size;
+    host_vector<hipblasDoubleComplex> work(lwork);
+    host_vector<double>               rwork(lrwork);
+    host_vector<int>                  iwork(liwork);
+    zheevd_(
+        &jobz, &uplo, &n, A, &lda, W, work, &lwork, rwork, &lrwork, iwork, &liwork, &info);
+#endif
+
+    return info;
+}
+
+// gesvd
+template <>
+int ref_gesvd<float>(char   jobu,
+                     char   jobvt,
+                     int    m,
+                     int    n,
+                     float* A,
+                     int    lda,
+                     float* S,
+                     float* U,
+                     int    ldu,
+                     float* V,
+                     int    ldv)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t            info_64;
+    host_vector<float> superb(std::max(std::min(m, n) - 1, 1));
+
+    info_64 = LAPACKE_sgesvd(
+        LAPACK_COL_MAJOR, jobu, jobvt, m, n, A, lda, S, U, ldu, V, ldv, superb);
+    info    = info_64;
+#else
+    // workspace query
+    float work_size;
+    int   lwork = -1;
+    sgesvd_(&jobu, &jobvt, &m, &n, A, &lda, S, U, &ldu, V, &ldv, &work_size, &lwork, &info);
+
+    lwork = int(work_size);
+    host_vector<float> work(lwork);
+    sgesvd_(&jobu, &jobvt, &m, &n, A, &lda, S, U, &ldu, V, &ldv, work, &lwork, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_gesvd<double>(char    jobu,
+                      char    jobvt,
+                      int     m,
+                      int     n,
+                      double* A,
+                      int     lda,
+                      double* S,
+                      double* U,
+                      int     ldu,
+                      double* V,
+                      int     ldv)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t             info_64;
+    host_vector<double> superb(std::max(std::min(m, n) - 1, 1));
+
+    info_64 = LAPACKE_dgesvd(
+        LAPACK_COL_MAJOR, jobu, jobvt, m, n, A, lda, S, U, ldu, V, ldv, superb);
+    info    = info_64;
+#else
+    // workspace query
+    double work_size;
+    int    lwork = -1;
+    dgesvd_(&jobu, &jobvt, &m, &n, A, &lda, S, U, &ldu, V, &ldv, &work_size, &lwork, &info);
+
+    lwork = int(work_size);
+    host_vector<double> work(lwork);
+    dgesvd_(&jobu, &jobvt, &m, &n, A, &lda, S, U, &ldu, V, &ldv, work, &lwork, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_gesvd<hipblasComplex>(char            jobu,
+                              char            jobvt,
+                              int             m,
+                              int             n,
+                              hipblasComplex* A,
+                              int             lda,
+                              float*          S,
+                              hipblasComplex* U,
+                              int             ldu,
+                              hipblasComplex* V,
+                              int             ldv)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t            info_64;
+    host_vector<float> superb(std::max(std::min(m, n) - 1, 1));
+
+    info_64 = LAPACKE_cgesvd(LAPACK_COL_MAJOR,
+                             jobu,
+                             jobvt,
+                             m,
+                             n,
+                             (lapack_complex_float*)A,
+                             lda,
+                             S,
+                             (lapack_complex_float*)U,
+                             ldu,
+                             (lapack_complex_float*)V,
+                             ldv,
+                             superb);
+    info    = info_64;
+#else
+    // workspace query
+    hipblasComplex     work_size;
+    host_vector<float> rwork(5 * std::max(std::min(m, n), 1));
+    int                lwork = -1;
+    cgesvd_(&jobu, &jobvt, &m, &n, A, &lda, S, U, &ldu, V, &ldv, &work_size, &lwork, rwork, &info);
+
+    lwork = int(std::real(work_size));
+    host_vector<hipblasComplex> work(lwork);
+    cgesvd_(&jobu, &jobvt, &m, &n, A, &lda, S, U, &ldu, V, &ldv, work, &lwork, rwork, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_gesvd<hipblasDoubleComplex>(char                  jobu,
+                                    char                  jobvt,
+                                    int                   m,
+                                    int                   n,
+                                    hipblasDoubleComplex* A,
+                                    int                   lda,
+                                    double*               S,
+                                    hipblasDoubleComplex* U,
+                                    int                   ldu,
+                                    hipblasDoubleComplex* V,
+                                    int                   ldv)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t             info_64;
+    host_vector<double> superb(std::max(std::min(m, n) - 1, 1));
+
+    info_64 = LAPACKE_zgesvd(LAPACK_COL_MAJOR,
+                             jobu,
+                             jobvt,
+                             m,
+                             n,
+                             (lapack_complex_double*)A,
+                             lda,
+                             S,
+                             (lapack_complex_double*)U,
+                             ldu,
+                             (lapack_complex_double*)V,
+                             ldv,
+                             superb);
+    info    = info_64;
+#else
+    // workspace query
+    hipblasDoubleComplex work_size;
+    host_vector<double>  rwork(5 * std::max(std::min(m, n), 1));
+    int                  lwork = -1;
+    zgesvd_(&jobu, &jobvt, &m, &n, A, &lda, S, U, &ldu, V, &ldv, &work_size, &lwork, rwork, &info);
+
+    lwork = int(std::real(work_size));
+    host_vector<hipblasDoubleComplex> work(lwork);
+    zgesvd_(&jobu, &jobvt, &m, &n, A, &lda, S, U, &ldu, V, &ldv, work, &lwork, rwork, &info);
+#endif
+
+    return info;
+}
+
 #endif
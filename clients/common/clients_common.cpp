@@ -227,7 +227,12 @@
 #include "solver/testing_gels_strided_batched.hpp"
 #include "solver/testing_geqrf.hpp"
 #include "solver/testing_geqrf_batched.hpp"
+#include "solver/testing_geqrf_batched_strided_tau.hpp"
 #include "solver/testing_geqrf_strided_batched.hpp"
+#include "solver/testing_gesv_batched.hpp"
+#include "solver/testing_gesv_strided_batched.hpp"
+#include "solver/testing_gesvdj_batched.hpp"
+#include "solver/testing_gesvdj_strided_batched.hpp"
 #include "solver/testing_getrf.hpp"
 #include "solver/testing_getrf_batched.hpp"
 #include "solver/testing_getrf_npvt.hpp"
@@ -239,6 +244,19 @@
 #include "solver/testing_getrs.hpp"
 #include "solver/testing_getrs_batched.hpp"
 #include "solver/testing_getrs_strided_batched.hpp"
+#include "solver/testing_potrf.hpp"
+#include "solver/testing_potrf_batched.hpp"
+#include "solver/testing_potrf_strided_batched.hpp"
+#include "solver/testing_potri.hpp"
+#include "solver/testing_potri_batched.hpp"
+#include "solver/testing_potri_strided_batched.hpp"
+#include "solver/testing_potrs.hpp"
+#include "solver/testing_potrs_batched.hpp"
+#include "solver/testing_potrs_strided_batched.hpp"
+#include "solver/testing_syevd.hpp"
+#include "solver/testing_syevj.hpp"
+#include "solver/testing_syevj_batched.hpp"
+#include "solver/testing_syevj_strided_batched.hpp"
 #endif
 
 #include "utility.h"
@@ -462,7 +480,12 @@ void get_test_name(const Arguments& arg, std::string& name)
 #ifdef __HIP_PLATFORM_SOLVER__
         {"geqrf", testname_geqrf},
         {"geqrf_batched", testname_geqrf_batched},
+        {"geqrf_batched_strided_tau", testname_geqrf_batched_strided_tau},
         {"geqrf_strided_batched", testname_geqrf_strided_batched},
+        {"gesv_batched", testname_gesv_batched},
+        {"gesv_strided_batched", testname_gesv_strided_batched},
+        {"gesvdj_batched", testname_gesvdj_batched},
+        {"gesvdj_strided_batched", testname_gesvdj_strided_batched},
         {"getrf", testname_getrf},
         {"getrf_batched", testname_getrf_batched},
         {"getrf_strided_batched", testname_getrf_strided_batched},
@@ -477,6 +500,23 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"gels", testname_gels},
         {"gels_batched", testname_gels_batched},
         {"gels_strided_batched", testname_gels_strided_batched},
+        {"potrf", testname_potrf},
+        {"potrf_batched", testname_potrf_batched},
+        {"potrf_strided_batched", testname_potrf_strided_batched},
+        {"potri", testname_potri},
+        {"potri_batched", testname_potri_batched},
+        {"potri_strided_batched", testname_potri_strided_batched},
+        {"potrs", testname_potrs},
+        {"potrs_batched", testname_potrs_batched},
+        {"potrs_strided_batched", testname_potrs_strided_batched},
+        {"syevj", testname_syevj},
+        {"syevj_batched", testname_syevj_batched},
+        {"syevj_strided_batched", testname_syevj_strided_batched},
+        {"syevd", testname_syevd},
+        {"heevj", testname_syevj},
+        {"heevj_batched", testname_syevj_batched},
+        {"heevj_strided_batched", testname_syevj_strided_batched},
+        {"heevd", testname_syevd},
 #endif
 
         // Aux
@@ -680,7 +720,12 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
 #ifdef __HIP_PLATFORM_SOLVER__
             {"geqrf", testing_geqrf<T>},
             {"geqrf_batched", testing_geqrf_batched<T>},
+            {"geqrf_batched_strided_tau", testing_geqrf_batched_strided_tau<T>},
             {"geqrf_strided_batched", testing_geqrf_strided_batched<T>},
+            {"gesv_batched", testing_gesv_batched<T>},
+            {"gesv_strided_batched", testing_gesv_strided_batched<T>},
+            {"gesvdj_batched", testing_gesvdj_batched<T>},
+            {"gesvdj_strided_batched", testing_gesvdj_strided_batched<T>},
             {"getrf", testing_getrf<T>},
             {"getrf_batched", testing_getrf_batched<T>},
             {"getrf_strided_batched", testing_getrf_strided_batched<T>},
@@ -695,6 +740,19 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"gels", testing_gels<T>},
             {"gels_batched", testing_gels_batched<T>},
             {"gels_strided_batched", testing_gels_strided_batched<T>},
+            {"potrf", testing_potrf<T>},
+            {"potrf_batched", testing_potrf_batched<T>},
+            {"potrf_strided_batched", testing_potrf_strided_batched<T>},
+            {"potri", testing_potri<T>},
+            {"potri_batched", testing_potri_batched<T>},
+            {"potri_strided_batched", testing_potri_strided_batched<T>},
+            {"potrs", testing_potrs<T>},
+            {"potrs_batched", testing_potrs_batched<T>},
+            {"potrs_strided_batched", testing_potrs_strided_batched<T>},
+            {"syevj", testing_syevj<T>},
+            {"syevj_batched", testing_syevj_batched<T>},
+            {"syevj_strided_batched", testing_syevj_strided_batched<T>},
+            {"syevd", testing_syevd<T>},
 #endif
 
             // Aux
@@ -902,7 +960,12 @@ struct perf_blas<
 #ifdef __HIP_PLATFORM_SOLVER__
             {"geqrf", testing_geqrf<T>},
             {"geqrf_batched", testing_geqrf_batched<T>},
+            {"geqrf_batched_strided_tau", testing_geqrf_batched_strided_tau<T>},
             {"geqrf_strided_batched", testing_geqrf_strided_batched<T>},
+            {"gesv_batched", testing_gesv_batched<T>},
+            {"gesv_strided_batched", testing_gesv_strided_batched<T>},
+            {"gesvdj_batched", testing_gesvdj_batched<T>},
+            {"gesvdj_strided_batched", testing_gesvdj_strided_batched<T>},
             {"getrf", testing_getrf<T>},
             {"getrf_batched", testing_getrf_batched<T>},
             {"getrf_strided_batched", testing_getrf_strided_batched<T>},
@@ -917,6 +980,19 @@ struct perf_blas<
             {"gels", testing_gels<T>},
             {"gels_batched", testing_gels_batched<T>},
             {"gels_strided_batched", testing_gels_strided_batched<T>},
+            {"potrf", testing_potrf<T>},
+            {"potrf_batched", testing_potrf_batched<T>},
+            {"potrf_strided_batched", testing_potrf_strided_batched<T>},
+            {"potri", testing_potri<T>},
+            {"potri_batched", testing_potri_batched<T>},
+            {"potri_strided_batched", testing_potri_strided_batched<T>},
+            {"potrs", testing_potrs<T>},
+            {"potrs_batched", testing_potrs_batched<T>},
+            {"potrs_strided_batched", testing_potrs_strided_batched<T>},
+            {"heevj", testing_syevj<T>},
+            {"heevj_batched", testing_syevj_batched<T>},
+            {"heevj_strided_batched", testing_syevj_strided_batched<T>},
+            {"heevd", testing_syevd<T>},
 #endif
         };
         run_function(map, arg);
@@ -1189,6 +1265,44 @@ struct perf_blas_scal_ex<
     }
 };
 
+// --pad_ld: the leading dimensions of the gemm functions, raised to their minimum, are padded as
+// hipblasGetOptimalLeadingDimension advises. The strided batched tests derive their strides from
+// the leading dimensions, so they are padded too.
+static void hipblas_bench_pad_ld(Arguments& arg, const char* function)
+{
+    if(strncmp(function, "gemm", 4))
+        return;
+
+    hipblasHandle_t handle;
+    if(hipblasCreate(&handle) != HIPBLAS_STATUS_SUCCESS)
+        return;
+
+    // The advice only depends on the size of the column in bytes, so it is asked for as bytes
+    auto pad = [&](const char* name, int64_t& ld, int64_t min_ld, hipblasDatatype_t type) {
+        size_t  size = hipblas_datatype_size(type);
+        int64_t padded;
+        if(!size
+           || hipblasGetOptimalLeadingDimension(
+                  handle, std::max(ld, min_ld) * size, HIP_R_8I, &padded)
+                  != HIPBLAS_STATUS_SUCCESS)
+            return;
+        padded /= size;
+        if(padded != ld)
+            std::cout << "hipblas-bench INFO: --pad_ld, set " << name << " = " << padded
+                      << std::endl;
+        ld = padded;
+    };
+
+    // The gemm functions without _ex have one type, a_type
+    bool ex = strstr(function, "_ex") != nullptr;
+    pad("lda", arg.lda, arg.transA == 'N' ? arg.M : arg.K, arg.a_type);
+    pad("ldb", arg.ldb, arg.transB == 'N' ? arg.K : arg.N, ex ? arg.b_type : arg.a_type);
+    pad("ldc", arg.ldc, arg.M, ex ? arg.c_type : arg.a_type);
+    pad("ldd", arg.ldd, arg.M, ex ? arg.d_type : arg.a_type);
+
+    hipblasDestroy(handle);
+}
+
 int run_bench_test(Arguments& arg, int unit_check, int timing)
 {
     //hipblas_initialize(); // Initialize rocBLAS
@@ -1208,6 +1322,9 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
     if(!strncmp(function, prefix, sizeof(prefix) - 1))
         function += sizeof(prefix) - 1;
 
+    if(arg.pad_ld)
+        hipblas_bench_pad_ld(arg, function);
+
     if(!strcmp(function, "gemm") || !strcmp(function, "gemm_batched"))
     {
         // adjust dimension for GEMM routines
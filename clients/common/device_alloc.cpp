@@ -0,0 +1,188 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <map>
+#include <mutex>
+#include <stdlib.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "device_alloc.hpp"
+#include "test_cleanup.hpp"
+
+// cache of freed device blocks by device and size class, and the blocks in use
+struct device_pool_block
+{
+    int    device;
+    size_t size;
+};
+
+static std::unordered_map<void*, device_pool_block>        pool_in_use;
+static std::map<std::pair<int, size_t>, std::vector<void*>> pool_cached;
+static size_t                                               pool_cached_bytes{0};
+static std::mutex                                           pool_mutex;
+
+inline bool device_pool_enabled()
+{
+    static const bool enabled = !getenv("HIPBLAS_CLIENT_NO_DEVICE_POOL");
+    return enabled;
+}
+
+// Frees the cached blocks of one device, or of all devices if device is negative.
+// pool_mutex must be held
+static hipError_t device_pool_release_locked(int device)
+{
+    hipError_t status = hipSuccess;
+    for(auto it = pool_cached.begin(); it != pool_cached.end();)
+    {
+        if(device >= 0 && it->first.first != device)
+        {
+            ++it;
+            continue;
+        }
+        for(void* ptr : it->second)
+        {
+            hipError_t free_status = (hipFree)(ptr);
+            if(status == hipSuccess)
+                status = free_status;
+            pool_cached_bytes -= it->first.second;
+        }
+        it = pool_cached.erase(it);
+    }
+    return status;
+}
+
+// Releases the cache when test_cleanup::cleanup() deletes it
+struct device_pool_cleanup
+{
+    ~device_pool_cleanup()
+    {
+        (void)device_pool_release();
+    }
+};
+
+hipError_t device_pool_malloc(void** ptr, size_t size)
+{
+    if(!device_pool_enabled())
+        return (hipMalloc)(ptr, size);
+
+    int        device;
+    hipError_t status = hipGetDevice(&device);
+    if(status != hipSuccess)
+        return status;
+
+    size_t                      bytes = pool_size_class(size);
+    std::lock_guard<std::mutex> lock(pool_mutex);
+
+    auto& cached = pool_cached[{device, bytes}];
+    if(!cached.empty())
+    {
+        *ptr = cached.back();
+        cached.pop_back();
+        pool_cached_bytes -= bytes;
+    }
+    else
+    {
+        status = (hipMalloc)(ptr, bytes);
+
+        // the cache may hold the memory that is missing, so free it and try again
+        if(status == hipErrorOutOfMemory && pool_cached_bytes)
+        {
+            (void)hipGetLastError();
+            (void)device_pool_release_locked(device);
+            status = (hipMalloc)(ptr, bytes);
+        }
+        if(status != hipSuccess)
+            return status;
+    }
+
+    static device_pool_cleanup* cleanup = nullptr;
+    if(!cleanup)
+        cleanup = test_cleanup::allocate(&cleanup);
+
+    pool_in_use[*ptr] = {device, bytes};
+    return hipSuccess;
+}
+
+hipError_t device_pool_free(void* ptr)
+{
+    if(!device_pool_enabled() || !ptr)
+        return (hipFree)(ptr);
+
+    std::unique_lock<std::mutex> lock(pool_mutex);
+
+    auto it = pool_in_use.find(ptr);
+    if(it == pool_in_use.end())
+        return (hipFree)(ptr);
+
+    device_pool_block block = it->second;
+    pool_in_use.erase(it);
+    lock.unlock();
+
+    // the next user of the block may be on another stream, so wait for the work that uses it
+    int        current = block.device;
+    hipError_t status  = hipGetDevice(&current);
+    if(status == hipSuccess && current != block.device)
+        status = hipSetDevice(block.device);
+    if(status == hipSuccess)
+        status = hipDeviceSynchronize();
+    if(current != block.device)
+        (void)hipSetDevice(current);
+
+    lock.lock();
+    if(status != hipSuccess)
+    {
+        (void)(hipFree)(ptr);
+        return status;
+    }
+
+    pool_cached[{block.device, block.size}].push_back(ptr);
+    pool_cached_bytes += block.size;
+    return hipSuccess;
+}
+
+hipError_t device_pool_release()
+{
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    return device_pool_release_locked(-1);
+}
+
+size_t device_pool_bytes_cached()
+{
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    return pool_cached_bytes;
+}
+
+int64_t device_pool_bytes_in_use(int device)
+{
+    if(!device_pool_enabled())
+        return -1;
+
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    int64_t                     bytes = 0;
+    for(auto& block : pool_in_use)
+        if(block.second.device == device)
+            bytes += block.second.size;
+    return bytes;
+}
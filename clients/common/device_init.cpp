@@ -0,0 +1,217 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <hip/hip_runtime.h>
+
+#include <algorithm>
+
+#include "device_init.hpp"
+#include "hipblas_philox.hpp"
+
+namespace
+{
+    constexpr int hipblas_init_threads = 256;
+
+    template <hipblas_device_init_type TYPE>
+    __device__ void hipblas_init_device_element(
+        void* A, size_t offset, const hipblas_philox& rng, bool hpl, bool negate)
+    {
+        float sign = negate ? -1.0f : 1.0f;
+        if constexpr(TYPE == hipblas_device_init_type::f32)
+        {
+            float value                    = hpl ? rng.hpl_float(0) : float(rng.rand_int(0, 10));
+            static_cast<float*>(A)[offset] = sign * value;
+        }
+        else if constexpr(TYPE == hipblas_device_init_type::f64)
+        {
+            double value                    = hpl ? rng.hpl_double() : double(rng.rand_int(0, 10));
+            static_cast<double*>(A)[offset] = sign * value;
+        }
+        else if constexpr(TYPE == hipblas_device_init_type::f16)
+        {
+            float value                       = hpl ? rng.hpl_float(0) : float(rng.rand_int(0, 3));
+            static_cast<uint16_t*>(A)[offset] = hipblas_philox_half_bits(sign * value);
+        }
+        else if constexpr(TYPE == hipblas_device_init_type::bf16)
+        {
+            float value                       = hpl ? rng.hpl_float(0) : float(rng.rand_int(0, 3));
+            static_cast<uint16_t*>(A)[offset] = hipblas_philox_bfloat16_bits(sign * value);
+        }
+        else if constexpr(TYPE == hipblas_device_init_type::c32)
+        {
+            // The hpl data of complex types is real, as on the host
+            float* z = static_cast<float*>(A) + 2 * offset;
+            z[0]     = sign * (hpl ? rng.hpl_float(0) : float(rng.rand_int(0, 10)));
+            z[1]     = hpl ? 0.0f : sign * float(rng.rand_int(1, 10));
+        }
+        else if constexpr(TYPE == hipblas_device_init_type::c64)
+        {
+            double* z = static_cast<double*>(A) + 2 * offset;
+            z[0]      = sign * (hpl ? rng.hpl_double() : double(rng.rand_int(0, 10)));
+            z[1]      = hpl ? 0.0 : sign * double(rng.rand_int(1, 10));
+        }
+        else
+        {
+            // An hpl value truncates to 0, as on the host
+            static_cast<int8_t*>(A)[offset] = hpl ? 0 : int8_t(sign * rng.rand_int(0, 10));
+        }
+    }
+
+    template <hipblas_device_init_type TYPE>
+    __device__ void hipblas_init_device_zero(void* A, size_t offset)
+    {
+        if constexpr(TYPE == hipblas_device_init_type::f32)
+            static_cast<float*>(A)[offset] = 0.0f;
+        else if constexpr(TYPE == hipblas_device_init_type::f64)
+            static_cast<double*>(A)[offset] = 0.0;
+        else if constexpr(TYPE == hipblas_device_init_type::f16
+                          || TYPE == hipblas_device_init_type::bf16)
+            static_cast<uint16_t*>(A)[offset] = 0;
+        else if constexpr(TYPE == hipblas_device_init_type::c32)
+            static_cast<float*>(A)[2 * offset] = static_cast<float*>(A)[2 * offset + 1] = 0.0f;
+        else if constexpr(TYPE == hipblas_device_init_type::c64)
+            static_cast<double*>(A)[2 * offset] = static_cast<double*>(A)[2 * offset + 1] = 0.0;
+        else
+            static_cast<int8_t*>(A)[offset] = 0;
+    }
+
+    // The diagonal of a hermitian matrix is real, and the lower triangle of a full one is the
+    // conjugate of the upper triangle
+    template <hipblas_device_init_type TYPE>
+    __device__ void hipblas_init_device_hermitian(void* A, size_t offset, bool diagonal)
+    {
+        if constexpr(TYPE == hipblas_device_init_type::c32)
+        {
+            float* z = static_cast<float*>(A) + 2 * offset;
+            z[1]     = diagonal ? 0.0f : -z[1];
+        }
+        else if constexpr(TYPE == hipblas_device_init_type::c64)
+        {
+            double* z = static_cast<double*>(A) + 2 * offset;
+            z[1]      = diagonal ? 0.0 : -z[1];
+        }
+    }
+
+    // Element (i, j) of matrix b is drawn from the counter (i + j * M, b), so the data doesn't
+    // depend on lda, stride or the launch. Both triangles of a symmetric or hermitian matrix
+    // are drawn from the counter of the upper one, as on the host.
+    template <hipblas_device_init_type TYPE>
+    __global__ void __launch_bounds__(hipblas_init_threads)
+        hipblas_init_device_kernel(void*                      A,
+                                   int64_t                    M,
+                                   int64_t                    N,
+                                   int64_t                    lda,
+                                   hipblasStride              stride,
+                                   int64_t                    batch_count,
+                                   uint64_t                   seed,
+                                   bool                       hpl,
+                                   bool                       alternating_sign,
+                                   hipblas_device_init_matrix matrix,
+                                   char                       uplo)
+    {
+        int64_t size = M * N;
+        for(int64_t b = blockIdx.y; b < batch_count; b += gridDim.y)
+            for(int64_t idx = int64_t(blockIdx.x) * blockDim.x + threadIdx.x; idx < size;
+                idx += int64_t(gridDim.x) * blockDim.x)
+            {
+                int64_t i      = idx % M;
+                int64_t j      = idx / M;
+                size_t  offset = i + j * lda + b * stride;
+                bool    negate = alternating_sign && !((i ^ j) & 1);
+
+                if(matrix == hipblas_device_init_matrix::general)
+                {
+                    hipblas_init_device_element<TYPE>(
+                        A, offset, hipblas_philox(seed, idx, b), hpl, negate);
+                    continue;
+                }
+
+                bool full   = uplo != 'U' && uplo != 'L'
+                            && matrix != hipblas_device_init_matrix::triangular;
+                bool stored = full || (uplo == 'U' ? i <= j : i >= j);
+                if(!stored)
+                {
+                    hipblas_init_device_zero<TYPE>(A, offset);
+                    continue;
+                }
+
+                if(matrix == hipblas_device_init_matrix::triangular)
+                {
+                    hipblas_init_device_element<TYPE>(
+                        A, offset, hipblas_philox(seed, idx, b), hpl, negate);
+                    continue;
+                }
+
+                int64_t low  = i < j ? i : j;
+                int64_t high = i < j ? j : i;
+                hipblas_init_device_element<TYPE>(
+                    A, offset, hipblas_philox(seed, low + high * M, b), hpl, false);
+                if(matrix == hipblas_device_init_matrix::hermitian
+                   && (i == j || (i > j && full)))
+                    hipblas_init_device_hermitian<TYPE>(A, offset, i == j);
+            }
+    }
+}
+
+hipError_t hipblas_init_device_data(void*                      A,
+                                    hipblas_device_init_type   type,
+                                    int64_t                    M,
+                                    int64_t                    N,
+                                    int64_t                    lda,
+                                    hipblasStride              stride,
+                                    int64_t                    batch_count,
+                                    uint64_t                   seed,
+                                    bool                       hpl,
+                                    bool                       alternating_sign,
+                                    hipblas_device_init_matrix matrix,
+                                    char                       uplo)
+{
+    if(M <= 0 || N <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    int64_t blocks = (M * N - 1) / hipblas_init_threads + 1;
+    dim3    grid(std::min(blocks, int64_t(1) << 16), std::min(batch_count, int64_t(1) << 15));
+    dim3    threads(hipblas_init_threads);
+
+#define HIPBLAS_INIT_DEVICE_LAUNCH(TYPE_)                                               \
+    case hipblas_device_init_type::TYPE_:                                               \
+        hipblas_init_device_kernel<hipblas_device_init_type::TYPE_><<<grid, threads>>>( \
+            A, M, N, lda, stride, batch_count, seed, hpl, alternating_sign, matrix, uplo); \
+        break
+
+    switch(type)
+    {
+        HIPBLAS_INIT_DEVICE_LAUNCH(f32);
+        HIPBLAS_INIT_DEVICE_LAUNCH(f64);
+        HIPBLAS_INIT_DEVICE_LAUNCH(f16);
+        HIPBLAS_INIT_DEVICE_LAUNCH(bf16);
+        HIPBLAS_INIT_DEVICE_LAUNCH(c32);
+        HIPBLAS_INIT_DEVICE_LAUNCH(c64);
+        HIPBLAS_INIT_DEVICE_LAUNCH(i8);
+    }
+
+#undef HIPBLAS_INIT_DEVICE_LAUNCH
+
+    hipError_t status = hipGetLastError();
+    return status != hipSuccess ? status : hipDeviceSynchronize();
+}
@@ -0,0 +1,932 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <hip/hip_runtime.h>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#include "device_reference.hpp"
+
+namespace
+{
+    constexpr int hipblas_reference_threads = 256;
+
+    struct hipblas_wide
+    {
+        double re;
+        double im;
+    };
+
+    __device__ hipblas_wide operator+(hipblas_wide a, hipblas_wide b)
+    {
+        return {a.re + b.re, a.im + b.im};
+    }
+
+    __device__ hipblas_wide operator-(hipblas_wide a, hipblas_wide b)
+    {
+        return {a.re - b.re, a.im - b.im};
+    }
+
+    __device__ hipblas_wide operator*(hipblas_wide a, hipblas_wide b)
+    {
+        return {a.re * b.re - a.im * b.im, a.re * b.im + a.im * b.re};
+    }
+
+    __device__ hipblas_wide operator/(hipblas_wide a, hipblas_wide b)
+    {
+        double scale = 1.0 / (b.re * b.re + b.im * b.im);
+        return {(a.re * b.re + a.im * b.im) * scale, (a.im * b.re - a.re * b.im) * scale};
+    }
+
+    constexpr bool hipblas_reference_complex(hipblas_device_init_type type)
+    {
+        return type == hipblas_device_init_type::c32 || type == hipblas_device_init_type::c64;
+    }
+
+    // The type of the references computed for type
+    constexpr hipblas_device_init_type hipblas_reference_wide(hipblas_device_init_type type)
+    {
+        return hipblas_reference_complex(type) ? hipblas_device_init_type::c64
+                                               : hipblas_device_init_type::f64;
+    }
+
+    // The epsilon of the float or double that the unit checks compare elements of type as
+    constexpr double hipblas_reference_unit_epsilon(hipblas_device_init_type type)
+    {
+        return type == hipblas_device_init_type::f64 || type == hipblas_device_init_type::c64
+                   ? 2.220446049250313e-16
+                   : type == hipblas_device_init_type::i8 ? 0.0 : 1.1920928955078125e-07;
+    }
+
+    template <hipblas_device_init_type TYPE>
+    __device__ hipblas_wide hipblas_reference_load(const void* A, size_t offset)
+    {
+        if constexpr(TYPE == hipblas_device_init_type::f32)
+            return {static_cast<const float*>(A)[offset], 0.0};
+        else if constexpr(TYPE == hipblas_device_init_type::f64)
+            return {static_cast<const double*>(A)[offset], 0.0};
+        else if constexpr(TYPE == hipblas_device_init_type::f16)
+            return {hipblas_philox_half_float(static_cast<const uint16_t*>(A)[offset]), 0.0};
+        else if constexpr(TYPE == hipblas_device_init_type::bf16)
+            return {hipblas_philox_bfloat16_float(static_cast<const uint16_t*>(A)[offset]), 0.0};
+        else if constexpr(TYPE == hipblas_device_init_type::c32)
+        {
+            const float* z = static_cast<const float*>(A) + 2 * offset;
+            return {z[0], z[1]};
+        }
+        else if constexpr(TYPE == hipblas_device_init_type::c64)
+        {
+            const double* z = static_cast<const double*>(A) + 2 * offset;
+            return {z[0], z[1]};
+        }
+        else
+            return {double(static_cast<const int8_t*>(A)[offset]), 0.0};
+    }
+
+    // Element (i, j) of op(A), with A stored column major from offset
+    template <hipblas_device_init_type TYPE>
+    __device__ hipblas_wide hipblas_reference_op(hipblasOperation_t trans,
+                                                 const void*        A,
+                                                 size_t             offset,
+                                                 int64_t            lda,
+                                                 int64_t            i,
+                                                 int64_t            j)
+    {
+        if(trans == HIPBLAS_OP_N)
+            return hipblas_reference_load<TYPE>(A, offset + i + j * lda);
+
+        hipblas_wide a = hipblas_reference_load<TYPE>(A, offset + j + i * lda);
+        if(trans == HIPBLAS_OP_C)
+            a.im = -a.im;
+        return a;
+    }
+
+    // ref holds elements of the wide type of TYPE
+    template <hipblas_device_init_type TYPE>
+    __device__ hipblas_wide hipblas_reference_get(const void* ref, size_t offset)
+    {
+        return hipblas_reference_load<hipblas_reference_wide(TYPE)>(ref, offset);
+    }
+
+    template <hipblas_device_init_type TYPE>
+    __device__ void hipblas_reference_set(void* ref, size_t offset, hipblas_wide value)
+    {
+        double* z = static_cast<double*>(ref);
+        if constexpr(hipblas_reference_complex(TYPE))
+        {
+            z[2 * offset]     = value.re;
+            z[2 * offset + 1] = value.im;
+        }
+        else
+            z[offset] = value.re;
+    }
+
+    // One thread per element of the result, with the rows of a column in consecutive threads
+    template <hipblas_device_init_type TYPE>
+    __global__ void __launch_bounds__(hipblas_reference_threads)
+        hipblas_reference_gemm_kernel(hipblasOperation_t    transA,
+                                      hipblasOperation_t    transB,
+                                      int64_t               M,
+                                      int64_t               N,
+                                      int64_t               K,
+                                      hipblas_device_scalar alpha,
+                                      const void*           A,
+                                      int64_t               lda,
+                                      hipblasStride         strideA,
+                                      const void*           B,
+                                      int64_t               ldb,
+                                      hipblasStride         strideB,
+                                      hipblas_device_scalar beta,
+                                      const void*           C,
+                                      int64_t               ldc,
+                                      hipblasStride         strideC,
+                                      int64_t               batch_count,
+                                      void*                 ref)
+    {
+        int64_t i = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+        if(i >= M)
+            return;
+
+        hipblas_wide a_scale = {alpha.real, alpha.imag};
+        hipblas_wide b_scale = {beta.real, beta.imag};
+        bool         beta_0  = beta.real == 0 && beta.imag == 0;
+
+        for(int64_t b = blockIdx.z; b < batch_count; b += gridDim.z)
+            for(int64_t j = blockIdx.y; j < N; j += gridDim.y)
+            {
+                hipblas_wide sum = {0.0, 0.0};
+                for(int64_t k = 0; k < K; k++)
+                    sum = sum
+                          + hipblas_reference_op<TYPE>(transA, A, b * strideA, lda, i, k)
+                                * hipblas_reference_op<TYPE>(transB, B, b * strideB, ldb, k, j);
+
+                hipblas_wide value = a_scale * sum;
+                if(!beta_0)
+                    value = value
+                            + b_scale * hipblas_reference_load<TYPE>(C, b * strideC + i + j * ldc);
+
+                hipblas_reference_set<TYPE>(ref, b * M * N + i + j * M, value);
+            }
+    }
+
+    // Substitution in double, one thread per column of X for the left side and per row for the
+    // right side. X is built in ref, where each thread reads back only the elements it wrote.
+    template <hipblas_device_init_type TYPE>
+    __global__ void __launch_bounds__(hipblas_reference_threads)
+        hipblas_reference_trsm_kernel(hipblasSideMode_t     side,
+                                      hipblasFillMode_t     uplo,
+                                      hipblasOperation_t    transA,
+                                      hipblasDiagType_t     diag,
+                                      int64_t               M,
+                                      int64_t               N,
+                                      hipblas_device_scalar alpha,
+                                      const void*           A,
+                                      int64_t               lda,
+                                      hipblasStride         strideA,
+                                      const void*           B,
+                                      int64_t               ldb,
+                                      hipblasStride         strideB,
+                                      int64_t               batch_count,
+                                      void*                 ref)
+    {
+        bool    left   = side == HIPBLAS_SIDE_LEFT;
+        int64_t vector = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+        int64_t n      = left ? M : N;
+        if(vector >= (left ? N : M))
+            return;
+
+        // op(A) is lower triangular when A is lower and not transposed, or upper and transposed
+        bool    lower  = (uplo == HIPBLAS_FILL_MODE_LOWER) == (transA == HIPBLAS_OP_N);
+        bool    unit   = diag == HIPBLAS_DIAG_UNIT;
+        bool    first  = left == lower;
+        int64_t step_x = left ? 1 : M;
+
+        hipblas_wide a_scale = {alpha.real, alpha.imag};
+
+        for(int64_t b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            size_t  offset_A = b * strideA;
+            size_t  offset_x = b * M * N + (left ? vector * M : vector);
+            size_t  offset_B = b * strideB + (left ? vector * ldb : vector);
+            int64_t step_B   = left ? 1 : ldb;
+
+            // The left side solves op(A) * x = alpha * b, forwards when op(A) is lower, and the
+            // right side solves x * op(A) = alpha * b, forwards when op(A) is upper
+            for(int64_t s = 0; s < n; s++)
+            {
+                int64_t t = first ? s : n - 1 - s;
+
+                hipblas_wide value
+                    = a_scale * hipblas_reference_load<TYPE>(B, offset_B + t * step_B);
+                for(int64_t u = first ? 0 : t + 1; u < (first ? t : n); u++)
+                {
+                    hipblas_wide a
+                        = left ? hipblas_reference_op<TYPE>(transA, A, offset_A, lda, t, u)
+                               : hipblas_reference_op<TYPE>(transA, A, offset_A, lda, u, t);
+                    value = value - a * hipblas_reference_get<TYPE>(ref, offset_x + u * step_x);
+                }
+
+                if(!unit)
+                    value = value / hipblas_reference_op<TYPE>(transA, A, offset_A, lda, t, t);
+
+                hipblas_reference_set<TYPE>(ref, offset_x + t * step_x, value);
+            }
+        }
+    }
+
+    __device__ double hipblas_reference_abs(hipblas_wide a, bool frobenius)
+    {
+        return frobenius ? a.re * a.re + a.im * a.im : hypot(a.re, a.im);
+    }
+
+    // A max that keeps NaNs
+    __device__ double hipblas_reference_max(double a, double b)
+    {
+        return a >= b ? a : b != b ? b : a != a ? a : b;
+    }
+
+    // One block per column, which sums the squares of the differences and of ref for the
+    // Frobenius norm or their absolute values for the one norm into columns
+    template <hipblas_device_init_type TYPE, hipblas_device_init_type REF_TYPE>
+    __global__ void __launch_bounds__(hipblas_reference_threads)
+        hipblas_norm_column_kernel(bool          frobenius,
+                                   int64_t       M,
+                                   int64_t       N,
+                                   const void*   ref,
+                                   int64_t       ldref,
+                                   hipblasStride strideref,
+                                   const void*   res,
+                                   int64_t       ldres,
+                                   hipblasStride strideres,
+                                   int64_t       batch_count,
+                                   double*       columns)
+    {
+        __shared__ double diff_shared[hipblas_reference_threads];
+        __shared__ double ref_shared[hipblas_reference_threads];
+
+        for(int64_t b = blockIdx.y; b < batch_count; b += gridDim.y)
+            for(int64_t j = blockIdx.x; j < N; j += gridDim.x)
+            {
+                double diff_sum = 0.0;
+                double ref_sum  = 0.0;
+                for(int64_t i = threadIdx.x; i < M; i += blockDim.x)
+                {
+                    hipblas_wide r
+                        = hipblas_reference_load<REF_TYPE>(ref, b * strideref + i + j * ldref);
+                    hipblas_wide d
+                        = r - hipblas_reference_load<TYPE>(res, b * strideres + i + j * ldres);
+
+                    diff_sum += hipblas_reference_abs(d, frobenius);
+                    ref_sum += hipblas_reference_abs(r, frobenius);
+                }
+
+                diff_shared[threadIdx.x] = diff_sum;
+                ref_shared[threadIdx.x]  = ref_sum;
+                __syncthreads();
+
+                for(unsigned half = hipblas_reference_threads / 2; half > 0; half /= 2)
+                {
+                    if(threadIdx.x < half)
+                    {
+                        diff_shared[threadIdx.x] += diff_shared[threadIdx.x + half];
+                        ref_shared[threadIdx.x] += ref_shared[threadIdx.x + half];
+                    }
+                    __syncthreads();
+                }
+
+                if(threadIdx.x == 0)
+                {
+                    columns[2 * (b * N + j)]     = diff_shared[0];
+                    columns[2 * (b * N + j) + 1] = ref_shared[0];
+                }
+                __syncthreads();
+            }
+    }
+
+    // One thread per batch, for the error of the batch from the sums of its columns
+    __global__ void __launch_bounds__(hipblas_reference_threads) hipblas_norm_batch_kernel(
+        bool frobenius, int64_t N, int64_t batch_count, const double* columns, double* errors)
+    {
+        int64_t b = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+        if(b >= batch_count)
+            return;
+
+        double diff = 0.0;
+        double norm = 0.0;
+        for(int64_t j = 0; j < N; j++)
+        {
+            const double* column = columns + 2 * (b * N + j);
+            diff = frobenius ? diff + column[0] : hipblas_reference_max(diff, column[0]);
+            norm = frobenius ? norm + column[1] : hipblas_reference_max(norm, column[1]);
+        }
+
+        if(frobenius)
+        {
+            diff = sqrt(diff);
+            norm = sqrt(norm);
+        }
+        errors[b] = norm > 0 ? diff / norm : diff;
+    }
+
+    // The errors of the batches are added up for the Frobenius norm, as on the host
+    __global__ void hipblas_norm_error_kernel(bool          frobenius,
+                                              int64_t       batch_count,
+                                              const double* errors,
+                                              double*       error)
+    {
+        double total = 0.0;
+        for(int64_t b = 0; b < batch_count; b++)
+            total = frobenius ? total + errors[b] : hipblas_reference_max(total, errors[b]);
+        *error = total;
+    }
+
+    // The state of a near check on the device
+    struct hipblas_near_check_state
+    {
+        unsigned long long max_error; // the bits of a double that isn't negative
+        unsigned long long mismatches;
+        unsigned long long first[hipblas_device_check_result::max_reported];
+    };
+
+    constexpr unsigned long long hipblas_near_check_empty = ~0ull;
+
+    // Whether the part r of the reference and g of the result match, and their error
+    __device__ bool hipblas_near_check_part(
+        double r, double g, double abs_error, double unit_epsilon, bool unit, double& max_error)
+    {
+        if(r != r)
+            return g != g;
+
+        double error = fabs(r - g);
+        max_error    = hipblas_reference_max(max_error, error);
+        return error <= (unit ? 4 * unit_epsilon * fabs(r) : abs_error);
+    }
+
+    // Keep the lowest indices of the mismatches in first, in order: each slot keeps the lowest
+    // index that reaches it, and passes the other one down
+    __device__ void hipblas_near_check_report(unsigned long long* first, unsigned long long index)
+    {
+        for(int slot = 0; slot < hipblas_device_check_result::max_reported; slot++)
+        {
+            unsigned long long old = atomicMin(first + slot, index);
+            if(old == hipblas_near_check_empty)
+                return;
+            index = old > index ? old : index;
+        }
+    }
+
+    template <hipblas_device_init_type TYPE, hipblas_device_init_type REF_TYPE>
+    __global__ void __launch_bounds__(hipblas_reference_threads)
+        hipblas_near_check_kernel(int64_t                   M,
+                                  int64_t                   N,
+                                  const void*               ref,
+                                  int64_t                   ldref,
+                                  hipblasStride             strideref,
+                                  const void*               res,
+                                  int64_t                   ldres,
+                                  hipblasStride             strideres,
+                                  int64_t                   batch_count,
+                                  double                    abs_error,
+                                  bool                      unit,
+                                  hipblas_near_check_state* state)
+    {
+        constexpr double unit_epsilon = hipblas_reference_unit_epsilon(TYPE);
+
+        double             max_error  = 0.0;
+        unsigned long long mismatches = 0;
+
+        int64_t size = M * N;
+        for(int64_t b = blockIdx.y; b < batch_count; b += gridDim.y)
+            for(int64_t idx = int64_t(blockIdx.x) * blockDim.x + threadIdx.x; idx < size;
+                idx += int64_t(gridDim.x) * blockDim.x)
+            {
+                int64_t      i = idx % M;
+                int64_t      j = idx / M;
+                hipblas_wide r
+                    = hipblas_reference_load<REF_TYPE>(ref, b * strideref + i + j * ldref);
+                hipblas_wide g = hipblas_reference_load<TYPE>(res, b * strideres + i + j * ldres);
+
+                bool re_ok = hipblas_near_check_part(
+                    r.re, g.re, abs_error, unit_epsilon, unit, max_error);
+                bool im_ok = hipblas_near_check_part(
+                    r.im, g.im, abs_error, unit_epsilon, unit, max_error);
+                if(!re_ok || !im_ok)
+                {
+                    mismatches++;
+                    hipblas_near_check_report(state->first, b * size + idx);
+                }
+            }
+
+        // The order of non-negative doubles is the order of their bits, with NaNs above all
+        atomicMax(&state->max_error, (unsigned long long)__double_as_longlong(max_error));
+        if(mismatches)
+            atomicAdd(&state->mismatches, mismatches);
+    }
+
+    // An entry of the random vector of seed of a probabilistic gemm check, 1 or -1 so that the
+    // products with it are exact
+    __device__ double hipblas_probabilistic_sign(uint64_t seed, int64_t j, int64_t batch)
+    {
+        return hipblas_philox(seed, j, batch).r[0] & 1 ? 1.0 : -1.0;
+    }
+
+    // One thread per row k of op(B), for op(B) * x and the sums of the absolute values of the
+    // row, in t as three doubles per row
+    template <hipblas_device_init_type TYPE>
+    __global__ void __launch_bounds__(hipblas_reference_threads)
+        hipblas_probabilistic_b_kernel(hipblasOperation_t transB,
+                                       int64_t            K,
+                                       int64_t            N,
+                                       const void*        B,
+                                       int64_t            ldb,
+                                       hipblasStride      strideB,
+                                       int64_t            batch_count,
+                                       uint64_t           seed,
+                                       double*            t)
+    {
+        int64_t k = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+        if(k >= K)
+            return;
+
+        for(int64_t b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            hipblas_wide sum     = {0.0, 0.0};
+            double       abs_sum = 0.0;
+            for(int64_t j = 0; j < N; j++)
+            {
+                hipblas_wide e = hipblas_reference_op<TYPE>(transB, B, b * strideB, ldb, k, j);
+                double       x = hipblas_probabilistic_sign(seed, j, b);
+                sum            = sum + hipblas_wide{e.re * x, e.im * x};
+                abs_sum += hipblas_reference_abs(e, false);
+            }
+
+            double* row = t + 3 * (b * K + k);
+            row[0]      = sum.re;
+            row[1]      = sum.im;
+            row[2]      = abs_sum;
+        }
+    }
+
+    // One thread per row i of C, for the residual r = alpha * op(A) * (op(B) * x) + beta * C0 * x
+    // - C * x, relative to the same sums of absolute values, which bound the rounding errors of
+    // a correct C. C0 isn't read when beta is 0.
+    template <hipblas_device_init_type TYPE>
+    __global__ void __launch_bounds__(hipblas_reference_threads)
+        hipblas_probabilistic_c_kernel(hipblasOperation_t    transA,
+                                       int64_t               M,
+                                       int64_t               N,
+                                       int64_t               K,
+                                       hipblas_device_scalar alpha,
+                                       const void*           A,
+                                       int64_t               lda,
+                                       hipblasStride         strideA,
+                                       const double*         t,
+                                       hipblas_device_scalar beta,
+                                       const void*           C0,
+                                       int64_t               ldc0,
+                                       hipblasStride         strideC0,
+                                       const void*           C,
+                                       int64_t               ldc,
+                                       hipblasStride         strideC,
+                                       int64_t               batch_count,
+                                       uint64_t              seed,
+                                       unsigned long long*   max_error)
+    {
+        int64_t i = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+        if(i >= M)
+            return;
+
+        hipblas_wide a_scale = {alpha.real, alpha.imag};
+        hipblas_wide b_scale = {beta.real, beta.imag};
+        bool         beta_0  = beta.real == 0 && beta.imag == 0;
+
+        double error = 0.0;
+        for(int64_t b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            hipblas_wide ab     = {0.0, 0.0};
+            double       ab_abs = 0.0;
+            for(int64_t k = 0; k < K; k++)
+            {
+                hipblas_wide  a   = hipblas_reference_op<TYPE>(transA, A, b * strideA, lda, i, k);
+                const double* row = t + 3 * (b * K + k);
+                ab                = ab + a * hipblas_wide{row[0], row[1]};
+                ab_abs += hipblas_reference_abs(a, false) * row[2];
+            }
+
+            hipblas_wide c0 = {0.0, 0.0}, c = {0.0, 0.0};
+            double       c0_abs = 0.0, c_abs = 0.0;
+            for(int64_t j = 0; j < N; j++)
+            {
+                double x = hipblas_probabilistic_sign(seed, j, b);
+                if(!beta_0)
+                {
+                    hipblas_wide e = hipblas_reference_load<TYPE>(C0, b * strideC0 + i + j * ldc0);
+                    c0             = c0 + hipblas_wide{e.re * x, e.im * x};
+                    c0_abs += hipblas_reference_abs(e, false);
+                }
+                hipblas_wide e = hipblas_reference_load<TYPE>(C, b * strideC + i + j * ldc);
+                c              = c + hipblas_wide{e.re * x, e.im * x};
+                c_abs += hipblas_reference_abs(e, false);
+            }
+
+            hipblas_wide r = a_scale * ab - c;
+            if(!beta_0)
+                r = r + b_scale * c0;
+            double bound = hipblas_reference_abs(a_scale, false) * ab_abs
+                           + hipblas_reference_abs(b_scale, false) * c0_abs + c_abs;
+            double e     = hipblas_reference_abs(r, false);
+            error        = hipblas_reference_max(error, bound > 0 ? e / bound : e);
+        }
+
+        // The order of non-negative doubles is the order of their bits, with NaNs above all
+        atomicMax(max_error, (unsigned long long)__double_as_longlong(error));
+    }
+
+    constexpr int64_t hipblas_reference_grid_max = int64_t(1) << 15;
+}
+
+#define HIPBLAS_REFERENCE_SWITCH(LAUNCH_) \
+    switch(type)                          \
+    {                                     \
+        LAUNCH_(f32);                     \
+        LAUNCH_(f64);                     \
+        LAUNCH_(f16);                     \
+        LAUNCH_(bf16);                    \
+        LAUNCH_(c32);                     \
+        LAUNCH_(c64);                     \
+        LAUNCH_(i8);                      \
+    }
+
+hipError_t hipblas_device_reference_gemm_data(hipblas_device_init_type type,
+                                              hipblasOperation_t       transA,
+                                              hipblasOperation_t       transB,
+                                              int64_t                  M,
+                                              int64_t                  N,
+                                              int64_t                  K,
+                                              hipblas_device_scalar    alpha,
+                                              const void*              A,
+                                              int64_t                  lda,
+                                              hipblasStride            strideA,
+                                              const void*              B,
+                                              int64_t                  ldb,
+                                              hipblasStride            strideB,
+                                              hipblas_device_scalar    beta,
+                                              const void*              C,
+                                              int64_t                  ldc,
+                                              hipblasStride            strideC,
+                                              int64_t                  batch_count,
+                                              void*                    ref)
+{
+    if(M <= 0 || N <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    dim3 grid((M - 1) / hipblas_reference_threads + 1,
+              std::min(N, hipblas_reference_grid_max),
+              std::min(batch_count, hipblas_reference_grid_max));
+    dim3 threads(hipblas_reference_threads);
+
+#define HIPBLAS_REFERENCE_GEMM_LAUNCH(TYPE_)                                                    \
+    case hipblas_device_init_type::TYPE_:                                                       \
+        hipblas_reference_gemm_kernel<hipblas_device_init_type::TYPE_><<<grid, threads>>>(      \
+            transA, transB, M, N, K, alpha, A, lda, strideA, B, ldb, strideB, beta, C, ldc,     \
+            strideC, batch_count, ref);                                                         \
+        break
+
+    HIPBLAS_REFERENCE_SWITCH(HIPBLAS_REFERENCE_GEMM_LAUNCH)
+
+#undef HIPBLAS_REFERENCE_GEMM_LAUNCH
+
+    hipError_t status = hipGetLastError();
+    return status != hipSuccess ? status : hipDeviceSynchronize();
+}
+
+hipError_t hipblas_device_reference_trsm_data(hipblas_device_init_type type,
+                                              hipblasSideMode_t        side,
+                                              hipblasFillMode_t        uplo,
+                                              hipblasOperation_t       transA,
+                                              hipblasDiagType_t        diag,
+                                              int64_t                  M,
+                                              int64_t                  N,
+                                              hipblas_device_scalar    alpha,
+                                              const void*              A,
+                                              int64_t                  lda,
+                                              hipblasStride            strideA,
+                                              const void*              B,
+                                              int64_t                  ldb,
+                                              hipblasStride            strideB,
+                                              int64_t                  batch_count,
+                                              void*                    ref)
+{
+    if(M <= 0 || N <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    int64_t vectors = side == HIPBLAS_SIDE_LEFT ? N : M;
+    dim3    grid((vectors - 1) / hipblas_reference_threads + 1,
+              std::min(batch_count, hipblas_reference_grid_max));
+    dim3    threads(hipblas_reference_threads);
+
+#define HIPBLAS_REFERENCE_TRSM_LAUNCH(TYPE_)                                                    \
+    case hipblas_device_init_type::TYPE_:                                                       \
+        hipblas_reference_trsm_kernel<hipblas_device_init_type::TYPE_><<<grid, threads>>>(      \
+            side, uplo, transA, diag, M, N, alpha, A, lda, strideA, B, ldb, strideB,            \
+            batch_count, ref);                                                                  \
+        break
+
+    HIPBLAS_REFERENCE_SWITCH(HIPBLAS_REFERENCE_TRSM_LAUNCH)
+
+#undef HIPBLAS_REFERENCE_TRSM_LAUNCH
+
+    hipError_t status = hipGetLastError();
+    return status != hipSuccess ? status : hipDeviceSynchronize();
+}
+
+// The checks compare with a reference of the type of the results or of its wide type
+#define HIPBLAS_CHECK_LAUNCH(KERNEL_, TYPE_, ...)                                              \
+    case hipblas_device_init_type::TYPE_:                                                      \
+        if(ref_type == type)                                                                   \
+            KERNEL_<hipblas_device_init_type::TYPE_, hipblas_device_init_type::TYPE_>          \
+                <<<grid, threads>>>(__VA_ARGS__);                                              \
+        else                                                                                   \
+            KERNEL_<hipblas_device_init_type::TYPE_,                                           \
+                    hipblas_reference_wide(hipblas_device_init_type::TYPE_)>                   \
+                <<<grid, threads>>>(__VA_ARGS__);                                              \
+        break
+
+hipError_t hipblas_device_norm_error_data(char                     norm_type,
+                                          hipblas_device_init_type type,
+                                          int64_t                  M,
+                                          int64_t                  N,
+                                          hipblas_device_init_type ref_type,
+                                          const void*              ref,
+                                          int64_t                  ldref,
+                                          hipblasStride            strideref,
+                                          const void*              res,
+                                          int64_t                  ldres,
+                                          hipblasStride            strideres,
+                                          int64_t                  batch_count,
+                                          double*                  error)
+{
+    bool frobenius = norm_type == 'F' || norm_type == 'f';
+    if((!frobenius && norm_type != 'O' && norm_type != 'o')
+       || (ref_type != type && ref_type != hipblas_reference_wide(type)))
+        return hipErrorInvalidValue;
+
+    *error = 0.0;
+    if(M <= 0 || N <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    // res may have been written on the stream of a handle
+    hipError_t status = hipDeviceSynchronize();
+    if(status != hipSuccess)
+        return status;
+
+    // The sums of the columns, then the errors of the batches and the error
+    double* sums;
+    status = hipMalloc(&sums, sizeof(double) * (2 * N * batch_count + batch_count + 1));
+    if(status != hipSuccess)
+        return status;
+
+    double* errors = sums + 2 * N * batch_count;
+    {
+        dim3 grid(std::min(N, hipblas_reference_grid_max),
+                  std::min(batch_count, hipblas_reference_grid_max));
+        dim3 threads(hipblas_reference_threads);
+
+#define HIPBLAS_NORM_COLUMN_LAUNCH(TYPE_)          \
+    HIPBLAS_CHECK_LAUNCH(hipblas_norm_column_kernel, \
+                         TYPE_,                      \
+                         frobenius,                  \
+                         M,                          \
+                         N,                          \
+                         ref,                        \
+                         ldref,                      \
+                         strideref,                  \
+                         res,                        \
+                         ldres,                      \
+                         strideres,                  \
+                         batch_count,                \
+                         sums)
+
+        HIPBLAS_REFERENCE_SWITCH(HIPBLAS_NORM_COLUMN_LAUNCH)
+
+#undef HIPBLAS_NORM_COLUMN_LAUNCH
+    }
+
+    hipblas_norm_batch_kernel<<<(batch_count - 1) / hipblas_reference_threads + 1,
+                                hipblas_reference_threads>>>(
+        frobenius, N, batch_count, sums, errors);
+    hipblas_norm_error_kernel<<<1, 1>>>(frobenius, batch_count, errors, errors + batch_count);
+
+    status = hipGetLastError();
+    if(status == hipSuccess)
+        status = hipMemcpy(error, errors + batch_count, sizeof(double), hipMemcpyDeviceToHost);
+
+    hipError_t free_status = hipFree(sums);
+    return status != hipSuccess ? status : free_status;
+}
+
+hipError_t hipblas_device_near_check_data(hipblas_device_init_type     type,
+                                          int64_t                      M,
+                                          int64_t                      N,
+                                          hipblas_device_init_type     ref_type,
+                                          const void*                  ref,
+                                          int64_t                      ldref,
+                                          hipblasStride                strideref,
+                                          const void*                  res,
+                                          int64_t                      ldres,
+                                          hipblasStride                strideres,
+                                          int64_t                      batch_count,
+                                          double                       abs_error,
+                                          bool                         unit,
+                                          hipblas_device_check_result* result)
+{
+    if(ref_type != type && ref_type != hipblas_reference_wide(type))
+        return hipErrorInvalidValue;
+
+    hipblas_near_check_state state = {0, 0, {}};
+    std::fill(std::begin(state.first), std::end(state.first), hipblas_near_check_empty);
+
+    hipError_t status = hipSuccess;
+    if(M > 0 && N > 0 && batch_count > 0)
+    {
+        // res may have been written on the stream of a handle
+        status = hipDeviceSynchronize();
+        if(status != hipSuccess)
+            return status;
+
+        hipblas_near_check_state* d_state;
+        status = hipMalloc(&d_state, sizeof(state));
+        if(status != hipSuccess)
+            return status;
+
+        status = hipMemcpy(d_state, &state, sizeof(state), hipMemcpyHostToDevice);
+        if(status == hipSuccess)
+        {
+            int64_t blocks = (M * N - 1) / hipblas_reference_threads + 1;
+            dim3    grid(std::min(blocks, int64_t(1) << 10),
+                      std::min(batch_count, hipblas_reference_grid_max));
+            dim3    threads(hipblas_reference_threads);
+
+#define HIPBLAS_NEAR_CHECK_LAUNCH(TYPE_)          \
+    HIPBLAS_CHECK_LAUNCH(hipblas_near_check_kernel, \
+                         TYPE_,                     \
+                         M,                         \
+                         N,                         \
+                         ref,                       \
+                         ldref,                     \
+                         strideref,                 \
+                         res,                       \
+                         ldres,                     \
+                         strideres,                 \
+                         batch_count,               \
+                         abs_error,                 \
+                         unit,                      \
+                         d_state)
+
+            HIPBLAS_REFERENCE_SWITCH(HIPBLAS_NEAR_CHECK_LAUNCH)
+
+#undef HIPBLAS_NEAR_CHECK_LAUNCH
+
+            status = hipGetLastError();
+            if(status == hipSuccess)
+                status = hipMemcpy(&state, d_state, sizeof(state), hipMemcpyDeviceToHost);
+        }
+
+        hipError_t free_status = hipFree(d_state);
+        if(status == hipSuccess)
+            status = free_status;
+        if(status != hipSuccess)
+            return status;
+    }
+
+    std::memcpy(&result->max_error, &state.max_error, sizeof(double));
+    result->mismatches = int64_t(state.mismatches);
+    result->reported   = 0;
+    for(unsigned long long index : state.first)
+    {
+        if(index == hipblas_near_check_empty)
+            break;
+
+        int64_t offset = int64_t(index % uint64_t(M * N));
+        int64_t k      = result->reported++;
+
+        result->batch[k] = int64_t(index / uint64_t(M * N));
+        result->row[k]   = offset % M;
+        result->col[k]   = offset / M;
+    }
+    return hipSuccess;
+}
+
+hipError_t hipblas_device_probabilistic_gemm_error_data(hipblas_device_init_type type,
+                                                       hipblasOperation_t       transA,
+                                                       hipblasOperation_t       transB,
+                                                       int64_t                  M,
+                                                       int64_t                  N,
+                                                       int64_t                  K,
+                                                       hipblas_device_scalar    alpha,
+                                                       const void*              A,
+                                                       int64_t                  lda,
+                                                       hipblasStride            strideA,
+                                                       const void*              B,
+                                                       int64_t                  ldb,
+                                                       hipblasStride            strideB,
+                                                       hipblas_device_scalar    beta,
+                                                       const void*              C0,
+                                                       int64_t                  ldc0,
+                                                       hipblasStride            strideC0,
+                                                       const void*              C,
+                                                       int64_t                  ldc,
+                                                       hipblasStride            strideC,
+                                                       int64_t                  batch_count,
+                                                       int                      vectors,
+                                                       double*                  error)
+{
+    *error = 0.0;
+    if(M <= 0 || N <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    // C may have been written on the stream of a handle
+    hipError_t status = hipDeviceSynchronize();
+    if(status != hipSuccess)
+        return status;
+
+    // op(B) * x, then the largest relative residual
+    double* t;
+    status = hipMalloc(&t, sizeof(double) * (3 * std::max<int64_t>(K, 1) * batch_count + 1));
+    if(status != hipSuccess)
+        return status;
+
+    unsigned long long* d_error = reinterpret_cast<unsigned long long*>(
+        t + 3 * std::max<int64_t>(K, 1) * batch_count);
+    status = hipMemset(d_error, 0, sizeof(*d_error));
+
+    dim3 threads(hipblas_reference_threads);
+    for(int v = 0; v < vectors && status == hipSuccess; v++)
+    {
+        uint64_t seed = 0x9E3779B97F4A7C15ull + v;
+        if(K > 0)
+        {
+            dim3 grid((K - 1) / hipblas_reference_threads + 1,
+                      std::min(batch_count, hipblas_reference_grid_max));
+
+#define HIPBLAS_PROBABILISTIC_B_LAUNCH(TYPE_)                                                  \
+    case hipblas_device_init_type::TYPE_:                                                      \
+        hipblas_probabilistic_b_kernel<hipblas_device_init_type::TYPE_>                        \
+            <<<grid, threads>>>(transB, K, N, B, ldb, strideB, batch_count, seed, t);          \
+        break
+
+            HIPBLAS_REFERENCE_SWITCH(HIPBLAS_PROBABILISTIC_B_LAUNCH)
+
+#undef HIPBLAS_PROBABILISTIC_B_LAUNCH
+        }
+
+        dim3 grid((M - 1) / hipblas_reference_threads + 1,
+                  std::min(batch_count, hipblas_reference_grid_max));
+
+#define HIPBLAS_PROBABILISTIC_C_LAUNCH(TYPE_)                                                  \
+    case hipblas_device_init_type::TYPE_:                                                      \
+        hipblas_probabilistic_c_kernel<hipblas_device_init_type::TYPE_><<<grid, threads>>>(    \
+            transA, M, N, K, alpha, A, lda, strideA, t, beta, C0, ldc0, strideC0, C, ldc,      \
+            strideC, batch_count, seed, d_error);                                              \
+        break
+
+        HIPBLAS_REFERENCE_SWITCH(HIPBLAS_PROBABILISTIC_C_LAUNCH)
+
+#undef HIPBLAS_PROBABILISTIC_C_LAUNCH
+
+        status = hipGetLastError();
+    }
+
+    unsigned long long bits = 0;
+    if(status == hipSuccess)
+        status = hipMemcpy(&bits, d_error, sizeof(bits), hipMemcpyDeviceToHost);
+    std::memcpy(error, &bits, sizeof(double));
+
+    hipError_t free_status = hipFree(t);
+    return status != hipSuccess ? status : free_status;
+}
+
+#undef HIPBLAS_CHECK_LAUNCH
+#undef HIPBLAS_REFERENCE_SWITCH
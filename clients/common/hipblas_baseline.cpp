@@ -0,0 +1,309 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas_baseline.hpp"
+#include "clients_common.hpp"
+#include "hipblas_datatype2string.hpp"
+#include "utility.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+    // the values of a JSON record written by ArgumentModel_log_record, by name. Numbers, true and
+    // false are kept as they are written, and arrays as their list of numbers
+    struct baseline_record
+    {
+        std::map<std::string, std::string>         values;
+        std::map<std::string, std::vector<double>> arrays;
+    };
+
+    // parses a flat JSON object, returning false if line isn't one
+    bool parse_record(const std::string& line, baseline_record& rec)
+    {
+        const char* p = line.c_str();
+
+        auto skip = [&] {
+            while(*p == ' ' || *p == '\t' || *p == '\r')
+                ++p;
+        };
+
+        auto string = [&](std::string& str) {
+            if(*p++ != '"')
+                return false;
+            for(; *p && *p != '"'; ++p)
+            {
+                if(*p == '\\' && p[1])
+                    ++p;
+                str += *p;
+            }
+            return *p++ == '"';
+        };
+
+        skip();
+        if(*p++ != '{')
+            return false;
+
+        for(skip(); *p != '}';)
+        {
+            std::string name;
+            skip();
+            if(!string(name))
+                return false;
+            skip();
+            if(*p++ != ':')
+                return false;
+            skip();
+
+            if(*p == '"')
+            {
+                if(!string(rec.values[name]))
+                    return false;
+            }
+            else if(*p == '[')
+            {
+                auto& array = rec.arrays[name];
+                for(++p, skip(); *p != ']'; skip())
+                {
+                    char* end;
+                    array.push_back(strtod(p, &end));
+                    if(end == p)
+                        return false;
+                    p = end;
+                    skip();
+                    if(*p == ',')
+                        ++p;
+                }
+                ++p;
+            }
+            else
+            {
+                const char* begin = p;
+                while(*p && *p != ',' && *p != '}' && *p != ' ')
+                    ++p;
+                if(p == begin)
+                    return false;
+                rec.values[name].assign(begin, p);
+            }
+
+            skip();
+            if(*p == ',')
+                ++p;
+            else if(*p != '}')
+                return false;
+            skip();
+        }
+        return true;
+    }
+
+    // sets the Arguments fields from the strings that ArgumentModel_log_record writes for them
+    template <size_t N>
+    void set_field(char (&field)[N], const std::string& value)
+    {
+        memset(field, 0, N);
+        memcpy(field, value.data(), std::min(N, value.size()));
+    }
+
+    void set_field(char& field, const std::string& value)
+    {
+        field = value.empty() ? 0 : value[0];
+    }
+
+    void set_field(bool& field, const std::string& value)
+    {
+        field = value == "true";
+    }
+
+    void set_field(hipblasDatatype_t& field, const std::string& value)
+    {
+        field = string2hipblas_datatype(value);
+    }
+
+    void set_field(hipblasComputeType_t& field, const std::string& value)
+    {
+        field = string2hipblas_computetype(value);
+    }
+
+    void set_field(hipblas_initialization& field, const std::string& value)
+    {
+        field = string2hipblas_initialization(value);
+    }
+
+    template <typename T, std::enable_if_t<std::is_floating_point<T>{}, int> = 0>
+    void set_field(T& field, const std::string& value)
+    {
+        field = T(strtod(value.c_str(), nullptr));
+    }
+
+    template <typename T, std::enable_if_t<std::is_integral<T>{} || std::is_enum<T>{}, int> = 0>
+    void set_field(T& field, const std::string& value)
+    {
+        field = T(strtoll(value.c_str(), nullptr, 10));
+    }
+
+    double median(std::vector<double> t)
+    {
+        if(t.empty())
+            return 0;
+        std::sort(t.begin(), t.end());
+        size_t n = t.size();
+        return n % 2 ? t[n / 2] : (t[n / 2 - 1] + t[n / 2]) / 2;
+    }
+}
+
+std::vector<hipblas_baseline_case> hipblas_baseline_read(const std::string& path)
+{
+    std::ifstream file(path);
+    if(!file)
+        throw std::invalid_argument("Cannot open --baseline " + path);
+
+    std::vector<hipblas_baseline_case> cases;
+    std::string                        line;
+    for(size_t line_no = 1; std::getline(file, line); line_no++)
+    {
+        if(line.find_first_not_of(" \t\r") == std::string::npos)
+            continue;
+
+        baseline_record rec;
+        if(!parse_record(line, rec) || !rec.arrays.count("hipblas-us-iterations"))
+            throw std::invalid_argument("Invalid --baseline record at " + path + ":"
+                                        + std::to_string(line_no));
+
+        // fields missing from the record, such as those added since it was written, keep their
+        // defaults
+        hipblas_baseline_case c;
+        c.iteration_us = rec.arrays["hipblas-us-iterations"];
+#define SET_ARGUMENT(NAME)                        \
+    do                                            \
+    {                                             \
+        auto found = rec.values.find(#NAME);      \
+        if(found != rec.values.end())             \
+            set_field(c.arg.NAME, found->second); \
+    } while(0)
+        FOR_EACH_ARGUMENT(SET_ARGUMENT, ;);
+#undef SET_ARGUMENT
+        cases.push_back(std::move(c));
+    }
+    return cases;
+}
+
+double hipblas_mann_whitney_p(const std::vector<double>& baseline,
+                              const std::vector<double>& current)
+{
+    double n1 = baseline.size(), n2 = current.size(), n = n1 + n2;
+    if(!n1 || !n2)
+        return 1;
+
+    // the samples in ascending order, with whether each is one of current
+    std::vector<std::pair<double, bool>> all;
+    for(double t : baseline)
+        all.push_back({t, false});
+    for(double t : current)
+        all.push_back({t, true});
+    std::sort(all.begin(), all.end());
+
+    // the rank sum of current, with tied samples sharing their mean rank, and the tie correction
+    double rank_sum = 0, ties = 0;
+    for(size_t i = 0, j; i < all.size(); i = j)
+    {
+        j = i + 1;
+        while(j < all.size() && all[j].first == all[i].first)
+            j++;
+        double rank = (i + 1 + j) / 2.0;
+        for(size_t k = i; k < j; k++)
+            rank_sum += all[k].second ? rank : 0;
+        double t = j - i;
+        ties += t * t * t - t;
+    }
+
+    // U counts the pairs in which the current time is the larger, ties counting half
+    double u        = rank_sum - n2 * (n2 + 1) / 2;
+    double mean     = n1 * n2 / 2;
+    double variance = n1 * n2 / 12 * ((n + 1) - ties / (n * (n - 1)));
+    if(variance <= 0)
+        return 1;
+
+    // continuity corrected normal approximation
+    double z = (u - mean - 0.5) / std::sqrt(variance);
+    return 0.5 * std::erfc(z / std::sqrt(2.0));
+}
+
+int hipblas_baseline_compare(const std::string& path, double threshold, double significance)
+{
+    std::vector<hipblas_baseline_case> cases = hipblas_baseline_read(path);
+
+    int regressions = 0, failures = 0;
+    for(size_t i = 0; i < cases.size(); i++)
+    {
+        Arguments& arg = cases[i].arg;
+
+        // time each hot iteration, for the samples of the test
+        arg.report_percentiles = true;
+        if(run_bench_test(arg, 0, 1))
+        {
+            std::cout << "baseline run " << i << " (" << arg.function << ") failed\n" << std::endl;
+            failures++;
+            continue;
+        }
+
+        const std::vector<double>& iteration_us = hipblas_iteration_timer::last_iteration_us();
+
+        double base_median = median(cases[i].iteration_us);
+        double cur_median  = median(iteration_us);
+        double change      = base_median > 0 ? cur_median / base_median - 1 : 0;
+        double p           = hipblas_mann_whitney_p(cases[i].iteration_us, iteration_us);
+        bool   regression  = change > threshold && p < significance;
+        bool   improvement = change < -threshold
+                           && hipblas_mann_whitney_p(iteration_us, cases[i].iteration_us)
+                                  < significance;
+
+        char line[256];
+        snprintf(line,
+                 sizeof(line),
+                 "baseline run %zu (%s): median %.3f us, baseline %.3f us, %+.2f%%, p %.3g, %s",
+                 i,
+                 arg.function,
+                 cur_median,
+                 base_median,
+                 change * 100,
+                 p,
+                 regression ? "REGRESSION" : improvement ? "improvement" : "no change");
+        std::cout << line << "\n" << std::endl;
+
+        regressions += regression;
+    }
+
+    std::cout << cases.size() << " baseline runs, " << regressions << " regressions, " << failures
+              << " failures" << std::endl;
+    return regressions + failures;
+}
@@ -0,0 +1,337 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas_counters.hpp"
+
+#include <hip/hip_runtime_api.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+
+#ifndef WIN32
+#include <dlfcn.h>
+#if !defined(__HIP_PLATFORM_NVIDIA__) && __has_include(<rocprofiler-sdk/device_counting_service.h>)
+#include <rocprofiler-sdk/registration.h>
+#include <rocprofiler-sdk/rocprofiler.h>
+#define HIPBLAS_COUNTERS_ROCPROFILER
+#endif
+#endif
+
+namespace
+{
+    std::vector<std::string> selected_names;
+
+    thread_local std::vector<std::pair<std::string, double>> last_counters;
+
+#if defined(HIPBLAS_COUNTERS_ROCPROFILER)
+    // the records of one sample, enough for the instances of a few dozen raw counters
+    constexpr size_t max_records = size_t(1) << 16;
+
+    // a device counting context for each GPU agent that has some of the selected counters. The
+    // contexts are configured when rocprofiler-sdk initializes the tool, the only time it allows
+    // that, and started and sampled around the timing loops
+    class profiler
+    {
+        struct agent
+        {
+            rocprofiler_agent_id_t          id;
+            uint32_t                        domain;
+            uint32_t                        location;
+            rocprofiler_context_id_t        context{};
+            rocprofiler_profile_config_id_t config{};
+            std::map<uint64_t, size_t>      index; // counter id to index in selected_names
+        };
+
+        std::mutex         m_mutex;
+        std::vector<agent> m_agents;
+
+        decltype(&rocprofiler_query_available_agents)            m_query_available_agents = nullptr;
+        decltype(&rocprofiler_iterate_agent_supported_counters)  m_iterate_counters       = nullptr;
+        decltype(&rocprofiler_query_counter_info)                m_query_counter_info     = nullptr;
+        decltype(&rocprofiler_create_profile_config)             m_create_profile_config  = nullptr;
+        decltype(&rocprofiler_create_context)                    m_create_context         = nullptr;
+        decltype(&rocprofiler_configure_device_counting_service) m_configure_counting     = nullptr;
+        decltype(&rocprofiler_start_context)                     m_start_context          = nullptr;
+        decltype(&rocprofiler_stop_context)                      m_stop_context           = nullptr;
+        decltype(&rocprofiler_sample_device_counting_service)    m_sample                 = nullptr;
+        decltype(&rocprofiler_query_record_counter_id)           m_query_record_counter   = nullptr;
+
+        static int initialize(rocprofiler_client_finalize_t, void*)
+        {
+            get().configure();
+            return 0;
+        }
+
+        static void finalize(void*) {}
+
+        static rocprofiler_tool_configure_result_t*
+            configure_tool(uint32_t, const char*, uint32_t, rocprofiler_client_id_t* client)
+        {
+            static rocprofiler_tool_configure_result_t result{
+                sizeof(rocprofiler_tool_configure_result_t), &initialize, &finalize, nullptr};
+            client->name = "hipblas-bench";
+            return &result;
+        }
+
+        void configure()
+        {
+            m_query_available_agents(
+                ROCPROFILER_AGENT_INFO_VERSION_0,
+                [](rocprofiler_agent_version_t, const void** agents, size_t count, void* data) {
+                    auto& self = *static_cast<profiler*>(data);
+                    for(size_t i = 0; i < count; i++)
+                    {
+                        auto* a = static_cast<const rocprofiler_agent_v0_t*>(agents[i]);
+                        if(a->type == ROCPROFILER_AGENT_TYPE_GPU)
+                            self.m_agents.push_back({a->id, a->domain, a->location_id});
+                    }
+                    return ROCPROFILER_STATUS_SUCCESS;
+                },
+                sizeof(rocprofiler_agent_v0_t),
+                this);
+
+            // the contexts point at their agent, so m_agents doesn't grow from here
+            std::vector<bool> found(selected_names.size(), false);
+            for(auto& a : m_agents)
+            {
+                std::vector<rocprofiler_counter_id_t> supported, ids;
+                m_iterate_counters(
+                    a.id,
+                    [](rocprofiler_agent_id_t, rocprofiler_counter_id_t* c, size_t n, void* data) {
+                        static_cast<std::vector<rocprofiler_counter_id_t>*>(data)->assign(c, c + n);
+                        return ROCPROFILER_STATUS_SUCCESS;
+                    },
+                    &supported);
+
+                for(auto id : supported)
+                {
+                    rocprofiler_counter_info_v0_t info;
+                    if(m_query_counter_info(id, ROCPROFILER_COUNTER_INFO_VERSION_0, &info)
+                       != ROCPROFILER_STATUS_SUCCESS)
+                        continue;
+                    for(size_t n = 0; n < selected_names.size(); n++)
+                        if(selected_names[n] == info.name)
+                        {
+                            a.index[id.handle] = n;
+                            found[n]           = true;
+                            ids.push_back(id);
+                        }
+                }
+
+                if(ids.empty()
+                   || m_create_profile_config(a.id, ids.data(), ids.size(), &a.config)
+                          != ROCPROFILER_STATUS_SUCCESS
+                   || m_create_context(&a.context) != ROCPROFILER_STATUS_SUCCESS
+                   || m_configure_counting(
+                          a.context,
+                          {0},
+                          a.id,
+                          [](rocprofiler_context_id_t                 context,
+                             rocprofiler_agent_id_t,
+                             rocprofiler_agent_set_profile_callback_t set_config,
+                             void*                                    data) {
+                              set_config(context, static_cast<agent*>(data)->config);
+                          },
+                          &a)
+                          != ROCPROFILER_STATUS_SUCCESS)
+                    a.index.clear();
+            }
+
+            for(size_t n = 0; n < selected_names.size(); n++)
+                if(!found[n])
+                    std::cerr << "hipblas-bench: the devices have no counter " << selected_names[n]
+                              << std::endl;
+        }
+
+    public:
+        static profiler& get()
+        {
+            static profiler instance;
+            return instance;
+        }
+
+        // loads rocprofiler-sdk and registers the tool, true if it could. The library is loaded
+        // global, so that the runtime finds it when it initializes
+        bool attach()
+        {
+            void* library = nullptr;
+            for(const char* name :
+                {"librocprofiler-sdk.so", "librocprofiler-sdk.so.1", "librocprofiler-sdk.so.0"})
+                if((library = dlopen(name, RTLD_NOW | RTLD_GLOBAL)))
+                    break;
+            if(!library)
+                return false;
+
+            auto symbol = [&](auto& function, const char* name) {
+                function = reinterpret_cast<std::remove_reference_t<decltype(function)>>(
+                    dlsym(library, name));
+                return function != nullptr;
+            };
+
+            decltype(&rocprofiler_force_configure) force_configure = nullptr;
+            return symbol(force_configure, "rocprofiler_force_configure")
+                   && symbol(m_query_available_agents, "rocprofiler_query_available_agents")
+                   && symbol(m_iterate_counters, "rocprofiler_iterate_agent_supported_counters")
+                   && symbol(m_query_counter_info, "rocprofiler_query_counter_info")
+                   && symbol(m_create_profile_config, "rocprofiler_create_profile_config")
+                   && symbol(m_create_context, "rocprofiler_create_context")
+                   && symbol(m_configure_counting, "rocprofiler_configure_device_counting_service")
+                   && symbol(m_start_context, "rocprofiler_start_context")
+                   && symbol(m_stop_context, "rocprofiler_stop_context")
+                   && symbol(m_sample, "rocprofiler_sample_device_counting_service")
+                   && symbol(m_query_record_counter, "rocprofiler_query_record_counter_id")
+                   && force_configure(&configure_tool) == ROCPROFILER_STATUS_SUCCESS;
+        }
+
+        // starts the context of the agent at the PCI location of the HIP device, and returns its
+        // index for end, or -1 if none of its counters are selected
+        int begin(int device)
+        {
+            hipDeviceProp_t props;
+            if(hipGetDeviceProperties(&props, device) != hipSuccess)
+                return -1;
+
+            // the location is the bus, device and function, from bit 8, 3 and 0
+            uint32_t location = uint32_t(props.pciBusID) << 8 | uint32_t(props.pciDeviceID) << 3;
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for(size_t i = 0; i < m_agents.size(); i++)
+            {
+                agent& a = m_agents[i];
+                if(!a.index.empty() && a.domain == uint32_t(props.pciDomainID)
+                   && (a.location & ~7u) == location)
+                    return m_start_context(a.context) == ROCPROFILER_STATUS_SUCCESS ? int(i) : -1;
+            }
+            return -1;
+        }
+
+        // samples the counters of the agent since begin, sums the instances of each and stops
+        // the context
+        void end(int index, std::vector<double>& values)
+        {
+            std::vector<rocprofiler_record_counter_t> records(max_records);
+            size_t                                    count = records.size();
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            agent&                      a = m_agents[index];
+
+            rocprofiler_status_t status = m_sample(a.context,
+                                                   rocprofiler_user_data_t{},
+                                                   ROCPROFILER_COUNTER_FLAG_NONE,
+                                                   records.data(),
+                                                   &count);
+            m_stop_context(a.context);
+            if(status != ROCPROFILER_STATUS_SUCCESS)
+                return;
+
+            for(auto& selected : a.index)
+                values[selected.second] = 0;
+            for(size_t r = 0; r < count; r++)
+            {
+                rocprofiler_counter_id_t id;
+                if(m_query_record_counter(records[r].id, &id) != ROCPROFILER_STATUS_SUCCESS)
+                    continue;
+                auto selected = a.index.find(id.handle);
+                if(selected != a.index.end())
+                    values[selected->second] += records[r].counter_value;
+            }
+        }
+    };
+#endif
+}
+
+hipblas_counters::~hipblas_counters()
+{
+    stop(1);
+}
+
+void hipblas_counters::select(const std::string& list)
+{
+    std::istringstream names(list);
+    std::string        name;
+    while(std::getline(names, name, ','))
+    {
+        name.erase(0, name.find_first_not_of(' '));
+        name.erase(name.find_last_not_of(' ') + 1);
+        if(!name.empty())
+            selected_names.push_back(name);
+    }
+    if(selected_names.empty())
+        throw std::invalid_argument("Invalid value for --counters " + list);
+
+#if defined(HIPBLAS_COUNTERS_ROCPROFILER)
+    if(!profiler::get().attach())
+        std::cerr << "hipblas-bench: the counters need rocprofiler-sdk, and can't be collected"
+                  << std::endl;
+#else
+    std::cerr << "hipblas-bench: the counters are collected through rocprofiler-sdk on AMD devices "
+                 "only, and can't be collected"
+              << std::endl;
+#endif
+}
+
+bool hipblas_counters::selected()
+{
+    return !selected_names.empty();
+}
+
+void hipblas_counters::start(int device)
+{
+    stop(1);
+
+    m_started = true;
+#if defined(HIPBLAS_COUNTERS_ROCPROFILER)
+    m_context = profiler::get().begin(device);
+#endif
+}
+
+void hipblas_counters::stop(int calls)
+{
+    if(!m_started)
+        return;
+    m_started = false;
+
+    // -1 for the counters that weren't collected
+    std::vector<double> values(selected_names.size(), -1.0);
+#if defined(HIPBLAS_COUNTERS_ROCPROFILER)
+    if(m_context >= 0)
+        profiler::get().end(m_context, values);
+#endif
+    m_context = -1;
+
+    last_counters.clear();
+    for(size_t n = 0; n < selected_names.size(); n++)
+        last_counters.emplace_back(selected_names[n],
+                                   values[n] >= 0 ? values[n] / std::max(calls, 1) : -1.0);
+}
+
+const std::vector<std::pair<std::string, double>>& hipblas_counters::last()
+{
+    return last_counters;
+}
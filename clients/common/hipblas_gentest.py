@@ -25,6 +25,7 @@ import sys
 import os
 import argparse
 import ctypes
+import hashlib
 from fnmatch import fnmatchcase
 try:  # Import either the C or pure-Python YAML parser
     from yaml import CLoader as Loader
@@ -50,8 +51,36 @@ param = {}
 
 def main():
     args.update(parse_args().__dict__)
-    for doc in get_yaml_docs():
-        process_doc(doc)
+    source = get_yaml_source()
+
+    # The output is only regenerated when the content hash of the YAML inputs,
+    # of this script and of the options differs from the hash of the last run
+    outname = args['outfile']
+    digest = source_digest(source)
+    stamp = outname and outname + '.sha256'
+    if stamp and os.path.exists(outname) and os.path.exists(stamp):
+        with open(stamp, 'r') as f:
+            if f.read().strip() == digest:
+                os.utime(outname)
+                return
+
+    if not outname:
+        args['outfile'] = sys.stdout.buffer
+        for doc in get_yaml_docs(source):
+            process_doc(doc)
+        return
+
+    # Write to a temporary file which replaces the output when it is complete,
+    # so that concurrent runs and readers never see a partial output
+    if os.path.exists(stamp):
+        os.remove(stamp)
+    tmpname = outname + '.' + str(os.getpid())
+    with open(tmpname, 'wb') as args['outfile']:
+        for doc in get_yaml_docs(source):
+            process_doc(doc)
+    os.replace(tmpname, outname)
+    with open(stamp, 'w') as f:
+        f.write(digest + '\n')
 
 
 def process_doc(doc):
@@ -105,8 +134,7 @@ Expand hipBLAS YAML test data file into binary Arguments records
                         default=sys.stdin)
     parser.add_argument('-o', '--out',
                         dest='outfile',
-                        type=argparse.FileType('wb'),
-                        default=sys.stdout)
+                        default=None)
     parser.add_argument('-I',
                         help="Add include path",
                         action='append',
@@ -147,13 +175,29 @@ def read_yaml_file(file):
     return source
 
 
-def get_yaml_docs():
-    """Parse the YAML file"""
+def get_yaml_source():
+    """Read the YAML file and the template, with their includes"""
     source = read_yaml_file(args['infile'])
 
     if args.get('template'):
         source = read_yaml_file(args['template']) + source
 
+    return source
+
+
+def source_digest(source):
+    """Content hash of the YAML source, of this script and of the options"""
+    sha = hashlib.sha256()
+    with open(os.path.realpath(__file__), 'rb') as f:
+        sha.update(f.read())
+    sha.update(str(args['hipblas_v2']).encode())
+    for line in source:
+        sha.update(line[0].encode())
+    return sha.hexdigest()
+
+
+def get_yaml_docs(source):
+    """Parse the YAML file"""
     source_str = ''.join([line[0] for line in source])
 
     def mark_str(mark):
@@ -0,0 +1,288 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas_input_file.hpp"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+std::string hipblas_input_file_path(const Arguments& arg, char operand)
+{
+    std::string list(arg.input_file);
+    size_t      begin = 0;
+    for(char entry = 'A'; begin <= list.size(); entry++)
+    {
+        size_t end = list.find(',', begin);
+        if(end == std::string::npos)
+            end = list.size();
+        if(entry == operand)
+            return list.substr(begin, end - begin);
+        begin = end + 1;
+    }
+    return "";
+}
+
+hipblas_input_file::hipblas_input_file(const std::string& path, char kind, size_t elem_size)
+    : m_path(path)
+    , m_kind(kind)
+    , m_elem_size(elem_size)
+{
+#ifndef WIN32
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if(fd == -1)
+        throw std::invalid_argument("Can't open --input_file " + path);
+
+    struct stat st;
+    if(!fstat(fd, &st) && S_ISREG(st.st_mode) && st.st_size > 0)
+    {
+        void* addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(addr != MAP_FAILED)
+        {
+            m_map  = static_cast<char*>(addr);
+            m_size = st.st_size;
+        }
+    }
+    close(fd);
+
+    if(!m_map)
+        throw std::invalid_argument("Can't map --input_file " + path);
+#else
+    std::ifstream file(path, std::ios::binary);
+    if(!file)
+        throw std::invalid_argument("Can't open --input_file " + path);
+    m_buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    m_map  = m_buffer.data();
+    m_size = m_buffer.size();
+#endif
+
+    if(m_size >= 6 && !memcmp(m_map, "\x93NUMPY", 6))
+        parse_npy();
+    else
+    {
+        m_data  = m_map;
+        m_count = m_size / m_elem_size;
+    }
+
+    if(!m_count)
+        throw std::invalid_argument("No elements in --input_file " + path);
+}
+
+hipblas_input_file::~hipblas_input_file()
+{
+#ifndef WIN32
+    if(m_pinned)
+        (void)hipHostUnregister(m_map);
+    munmap(m_map, m_size);
+#endif
+}
+
+// The header of a .npy file is the repr of a dict with the keys 'descr', 'fortran_order' and
+// 'shape', such as {'descr': '<f4', 'fortran_order': False, 'shape': (64, 128), }
+void hipblas_input_file::parse_npy()
+{
+    auto error = [&](const char* what) {
+        return std::invalid_argument(std::string("Invalid .npy ") + what + " in --input_file "
+                                     + m_path);
+    };
+
+    if(m_size < 10)
+        throw error("header");
+
+    size_t header_len, offset;
+    auto   bytes = reinterpret_cast<const unsigned char*>(m_map);
+    if(bytes[6] == 1)
+    {
+        header_len = bytes[8] | bytes[9] << 8;
+        offset     = 10;
+    }
+    else
+    {
+        if(m_size < 12)
+            throw error("header");
+        header_len = bytes[8] | bytes[9] << 8 | bytes[10] << 16 | size_t(bytes[11]) << 24;
+        offset     = 12;
+    }
+    if(offset + header_len > m_size)
+        throw error("header");
+
+    std::string header(m_map + offset, header_len);
+    auto        value = [&](const char* key) {
+        size_t pos = header.find(key);
+        if(pos == std::string::npos)
+            throw error(key);
+        pos = header.find(':', pos);
+        if(pos == std::string::npos)
+            throw error(key);
+        return header.find_first_not_of(" ", pos + 1);
+    };
+
+    // descr is '<', '|' or '=' for the byte order, the kind and the size in bytes
+    size_t descr = value("'descr'") + 1;
+    if(descr + 2 >= header.size() || header[descr] == '>')
+        throw error("descr, it must be a little endian number");
+    m_kind      = header[descr + 1];
+    m_elem_size = std::strtoul(header.c_str() + descr + 2, nullptr, 10);
+    bool sized   = m_elem_size == 1 || m_elem_size == 2 || m_elem_size == 4 || m_elem_size == 8;
+    bool integer = (m_kind == 'i' || m_kind == 'u') && sized;
+    bool real    = m_kind == 'f' && sized && m_elem_size > 1;
+    bool complex = m_kind == 'c' && (m_elem_size == 8 || m_elem_size == 16);
+    if(!integer && !real && !complex)
+        throw error("descr, it must be an integer, float or complex number");
+
+    bool fortran_order = !header.compare(value("'fortran_order'"), 4, "True");
+
+    std::vector<int64_t> shape;
+    size_t               pos = value("'shape'") + 1;
+    while(pos < header.size() && header[pos] != ')')
+    {
+        char*   end;
+        int64_t dim = std::strtoll(header.c_str() + pos, &end, 10);
+        if(end == header.c_str() + pos)
+            break;
+        shape.push_back(dim);
+        pos = header.find_first_not_of(", ", end - header.c_str());
+    }
+    if(shape.empty() || shape.size() > 3)
+        throw error("shape, it must have 1, 2 or 3 dimensions");
+
+    m_count = 1;
+    for(auto dim : shape)
+        m_count *= dim;
+    m_data = m_map + offset + header_len;
+    if(m_data + m_count * m_elem_size > m_map + m_size)
+        throw error("size, the file is shorter than its shape");
+
+    if(shape.size() == 1)
+        return;
+
+    // The strides in elements of the rows, columns and batches of the matrices
+    m_shaped  = true;
+    m_batches = shape.size() == 3 ? shape[0] : 1;
+    m_rows    = shape[shape.size() - 2];
+    m_cols    = shape[shape.size() - 1];
+    if(fortran_order)
+    {
+        m_batch_stride = 1;
+        m_row_stride   = m_batches;
+        m_col_stride   = m_batches * m_rows;
+    }
+    else
+    {
+        m_col_stride   = 1;
+        m_row_stride   = m_cols;
+        m_batch_stride = m_rows * m_cols;
+    }
+}
+
+size_t hipblas_input_file::index(int64_t i, int64_t j, int64_t b, int64_t m, int64_t n) const
+{
+    if(m_shaped)
+        return (b % m_batches) * m_batch_stride + (i % m_rows) * m_row_stride
+               + (j % m_cols) * m_col_stride;
+    return size_t(b * m * n + j * m + i) % m_count;
+}
+
+bool hipblas_input_file::contiguous(int64_t m, int64_t n, int64_t batch_count) const
+{
+    if(!m_shaped)
+        return m_count >= size_t(m * n * batch_count);
+    return m_rows == m && m_cols == n && m_row_stride == 1 && m_col_stride == m
+           && (batch_count == 1 || (m_batches >= batch_count && m_batch_stride == m * n));
+}
+
+std::pair<double, double> hipblas_input_file::value(size_t k) const
+{
+    const char* p = m_data + k * m_elem_size;
+    auto        load = [&](auto x, size_t offset = 0) {
+        std::memcpy(&x, p + offset, sizeof(x));
+        return x;
+    };
+
+    switch(m_kind)
+    {
+    case 'f':
+        if(m_elem_size == 2)
+            return {half_to_float(load(hipblasHalf{})), 0};
+        if(m_elem_size == 4)
+            return {load(float{}), 0};
+        return {load(double{}), 0};
+    case 'b':
+        return {bfloat16_to_float(load(hipblasBfloat16{})), 0};
+    case 'c':
+        if(m_elem_size == 8)
+            return {load(float{}), load(float{}, 4)};
+        return {load(double{}), load(double{}, 8)};
+    case 'i':
+        switch(m_elem_size)
+        {
+        case 1:
+            return {load(int8_t{}), 0};
+        case 2:
+            return {load(int16_t{}), 0};
+        case 4:
+            return {load(int32_t{}), 0};
+        default:
+            return {double(load(int64_t{})), 0};
+        }
+    default:
+        switch(m_elem_size)
+        {
+        case 1:
+            return {load(uint8_t{}), 0};
+        case 2:
+            return {load(uint16_t{}), 0};
+        case 4:
+            return {load(uint32_t{}), 0};
+        default:
+            return {double(load(uint64_t{})), 0};
+        }
+    }
+}
+
+bool hipblas_input_file::pin()
+{
+#ifndef WIN32
+    if(!m_pinned)
+    {
+#ifdef hipHostRegisterReadOnly
+        unsigned int flags = hipHostRegisterReadOnly;
+#else
+        unsigned int flags = hipHostRegisterDefault;
+#endif
+        m_pinned = hipHostRegister(m_map, m_size, flags) == hipSuccess;
+        if(!m_pinned)
+            (void)hipGetLastError();
+    }
+#endif
+    return m_pinned;
+}
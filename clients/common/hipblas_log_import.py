@@ -0,0 +1,319 @@
+#!/usr/bin/env python3
+"""Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+"""
+
+# Turns the API logs of an application run on rocBLAS or cuBLAS into a hipblas-bench YAML, and
+# scores a hipblas-bench run of that YAML by the call counts of the log.
+#
+#   ROCBLAS_LAYER=2 ./app 2> rocblas.log         (rocblas-bench command lines)
+#   CUBLAS_LOGINFO_DBG=1 CUBLAS_LOGDEST_DBG=cublas.log ./app
+#
+#   hipblas_log_import.py convert rocblas.log cublas.log -o workload.yaml
+#   ./hipblas-bench --yaml workload.yaml --output csv --output_file run.csv
+#   hipblas_log_import.py score workload.yaml run.csv
+#
+# convert writes one line per distinct call, most frequent first, with the number of calls in a
+# trailing comment. score multiplies the hipblas-us column of each run by that count, so the total
+# is the expected time the application spends in hipBLAS, and two library builds can be compared
+# by their totals.
+
+import re
+import sys
+import shlex
+import argparse
+from collections import Counter
+
+# rocblas-bench options and the hipblas-bench fields they map to
+ROCBLAS_OPTIONS = {
+    '-f': 'function', '--function': 'function',
+    '-r': 'precision', '--precision': 'precision',
+    '-m': 'M', '--sizem': 'M', '-n': 'N', '--sizen': 'N', '-k': 'K', '--sizek': 'K',
+    '--kl': 'KL', '--ku': 'KU',
+    '--lda': 'lda', '--ldb': 'ldb', '--ldc': 'ldc', '--ldd': 'ldd',
+    '--stride_a': 'stride_a', '--stride_b': 'stride_b', '--stride_c': 'stride_c',
+    '--stride_d': 'stride_d', '--stride_x': 'stride_x', '--stride_y': 'stride_y',
+    '--incx': 'incx', '--incy': 'incy', '--batch_count': 'batch_count',
+    '--transposeA': 'transA', '--transposeB': 'transB',
+    '--side': 'side', '--uplo': 'uplo', '--diag': 'diag',
+    '--alpha': 'alpha', '--alphai': 'alphai', '--beta': 'beta', '--betai': 'betai',
+    '--a_type': 'a_type', '--b_type': 'b_type', '--c_type': 'c_type', '--d_type': 'd_type',
+    '--compute_type': 'compute_type',
+}
+
+# hipDataType of the ex compute type to the hipblasComputeType_t spelling of hipblas-bench
+COMPUTE_TYPE_GEMM = {
+    'f16_r': 'c16f', 'f32_r': 'c32f', 'f64_r': 'c64f', 'i32_r': 'c32i',
+    'f32_c': 'c32f', 'f64_c': 'c64f',
+}
+
+# cuBLAS argument names to hipblas-bench fields
+CUBLAS_ARGS = {
+    'm': 'M', 'n': 'N', 'k': 'K', 'kl': 'KL', 'ku': 'KU',
+    'lda': 'lda', 'ldb': 'ldb', 'ldc': 'ldc', 'incx': 'incx', 'incy': 'incy',
+    'batchCount': 'batch_count',
+    'trans': 'transA', 'transa': 'transA', 'transA': 'transA',
+    'transb': 'transB', 'transB': 'transB',
+    'side': 'side', 'uplo': 'uplo', 'diag': 'diag',
+    'strideA': 'stride_a', 'strideB': 'stride_b', 'strideC': 'stride_c',
+    'stridex': 'stride_x', 'stridey': 'stride_y',
+    'Atype': 'a_type', 'Btype': 'b_type', 'Ctype': 'c_type',
+    'computeType': 'compute_type_gemm',
+}
+
+CUBLAS_VALUES = {
+    'CUBLAS_OP_N': 'N', 'CUBLAS_OP_T': 'T', 'CUBLAS_OP_C': 'C',
+    'CUBLAS_SIDE_LEFT': 'L', 'CUBLAS_SIDE_RIGHT': 'R',
+    'CUBLAS_FILL_MODE_UPPER': 'U', 'CUBLAS_FILL_MODE_LOWER': 'L', 'CUBLAS_FILL_MODE_FULL': 'F',
+    'CUBLAS_DIAG_UNIT': 'U', 'CUBLAS_DIAG_NON_UNIT': 'N',
+    'CUDA_R_16F': 'f16_r', 'CUDA_R_32F': 'f32_r', 'CUDA_R_64F': 'f64_r',
+    'CUDA_C_16F': 'f16_c', 'CUDA_C_32F': 'f32_c', 'CUDA_C_64F': 'f64_c',
+    'CUDA_R_16BF': 'bf16_r', 'CUDA_R_8I': 'i8_r', 'CUDA_R_32I': 'i32_r',
+    'CUBLAS_COMPUTE_16F': 'c16f', 'CUBLAS_COMPUTE_16F_PEDANTIC': 'c16f_pedantic',
+    'CUBLAS_COMPUTE_32F': 'c32f', 'CUBLAS_COMPUTE_32F_PEDANTIC': 'c32f_pedantic',
+    'CUBLAS_COMPUTE_32F_FAST_16F': 'c32f_fast_16f',
+    'CUBLAS_COMPUTE_32F_FAST_16BF': 'c32f_fast_16bf',
+    'CUBLAS_COMPUTE_32F_FAST_TF32': 'c32f_fast_tf32',
+    'CUBLAS_COMPUTE_64F': 'c64f', 'CUBLAS_COMPUTE_64F_PEDANTIC': 'c64f_pedantic',
+    'CUBLAS_COMPUTE_32I': 'c32i', 'CUBLAS_COMPUTE_32I_PEDANTIC': 'c32i_pedantic',
+}
+
+PRECISIONS = {'S': 'f32_r', 'D': 'f64_r', 'C': 'f32_c', 'Z': 'f64_c', 'H': 'f16_r'}
+
+# Field order of the lines written, the order of the hipblas traces
+FIELD_ORDER = ['function', 'a_type', 'b_type', 'c_type', 'd_type', 'compute_type',
+               'compute_type_gemm', 'transA', 'transB', 'side', 'uplo', 'diag', 'M', 'N', 'K',
+               'KL', 'KU', 'lda', 'ldb', 'ldc', 'ldd', 'incx', 'incy', 'stride_a', 'stride_b',
+               'stride_c', 'stride_d', 'stride_x', 'stride_y', 'batch_count', 'alpha', 'alphai',
+               'beta', 'betai', 'api']
+
+BENCH_FIELDS = 'timing: 1, unit_check: 0, norm_check: 0'
+
+
+def snake_case(name):
+    return re.sub(r'(?<=[a-z0-9])([A-Z])', r'_\1', name).lower()
+
+
+def parse_cublas_function(name):
+    """Maps a cuBLAS entry point such as cublasSgemmStridedBatched_64 to its hipblas-bench
+    function and precision, or None for the functions hipblas-bench doesn't run."""
+    fields = {'api': 'C'}
+    name = re.sub(r'^cublas', '', name)
+    if name.endswith('_64'):
+        name = name[:-3]
+        fields['api'] = 'C_64'
+    name = re.sub(r'_v2$', '', name)
+    if name.startswith('Lt') or name in ('Create', 'Destroy', 'SetStream', 'GetStream',
+                                         'SetMathMode', 'GetMathMode', 'SetWorkspace',
+                                         'SetPointerMode', 'GetPointerMode'):
+        return None
+
+    suffix = ''
+    for tail, snake in (('StridedBatched', '_strided_batched'), ('Batched', '_batched')):
+        if name.endswith(tail):
+            name, suffix = name[:-len(tail)], snake
+            break
+    if name.endswith('Ex'):
+        name, suffix = name[:-2], '_ex' + suffix
+
+    if name[0] in PRECISIONS and len(name) > 1 and name[1].islower():
+        fields['precision'] = PRECISIONS[name[0]]
+        name = name[1:]
+        # The mixed complex-real functions, such as Csscal and Zdrot, take their scalar type next
+        if fields['precision'].endswith('_c') and name[0] in 'sd' and name[1:] in (
+                'scal', 'rot', 'rotg', 'rotm'):
+            name = name[1:]
+
+    name = snake_case(name)
+    if name == 'dotu':
+        name = 'dot'
+    fields['function'] = name + suffix
+    return fields
+
+
+def expand_precision(fields):
+    precision = fields.pop('precision', None)
+    if precision is not None:
+        for key in ('a_type', 'b_type', 'c_type', 'd_type', 'compute_type'):
+            fields.setdefault(key, precision)
+    return fields
+
+
+def parse_rocblas_line(line):
+    """Parses a rocblas-bench command line of a ROCBLAS_LAYER=2 log."""
+    try:
+        tokens = shlex.split(line[line.index('rocblas-bench'):])[1:]
+    except ValueError:
+        return None
+
+    fields = {'api': 'C'}
+    i = 0
+    while i < len(tokens):
+        key = ROCBLAS_OPTIONS.get(tokens[i])
+        if key is not None and i + 1 < len(tokens):
+            fields[key] = tokens[i + 1]
+            i += 2
+            continue
+        if tokens[i] == '--api' and i + 1 < len(tokens):
+            fields['api'] = 'C_64' if tokens[i + 1] == 'C_64' else 'C'
+            i += 2
+            continue
+        i += 1
+    if 'function' not in fields:
+        return None
+
+    # rocBLAS spells the gemm_ex compute type as a data type
+    if fields['function'].startswith('gemm') and '_ex' in fields['function']:
+        compute = fields.pop('compute_type', None)
+        if compute in COMPUTE_TYPE_GEMM:
+            fields['compute_type_gemm'] = COMPUTE_TYPE_GEMM[compute]
+    return expand_precision(fields)
+
+
+def parse_cublas_call(name, args):
+    fields = parse_cublas_function(name)
+    if fields is None:
+        return None
+    for arg, value in args:
+        key = CUBLAS_ARGS.get(arg)
+        if key is None:
+            continue
+        fields[key] = CUBLAS_VALUES.get(value, value)
+    # tbmv takes its order as n, which hipblas-bench reads from M
+    if fields['function'].startswith('tbmv') and 'N' in fields and 'M' not in fields:
+        fields['M'] = fields.pop('N')
+    if 'compute_type_gemm' in fields and 'a_type' in fields:
+        for key in ('b_type', 'c_type', 'd_type', 'compute_type'):
+            fields.setdefault(key, fields['c_type' if key == 'd_type' else 'a_type'])
+    return expand_precision(fields)
+
+
+CUBLAS_HEADER = re.compile(r'\b(cublas\w+)\(.*\)\s*called')
+CUBLAS_ARG = re.compile(r'^\s*i!\s+(\w+)\s*:\s*type=[^;]*;\s*val=(\S+)')
+
+
+def parse_logs(paths):
+    """Yields the hipblas-bench fields of each call in the logs, skipping the calls that can't be
+    converted."""
+    for path in paths:
+        with open(path, errors='replace') as log:
+            name, args = None, []
+            for line in log:
+                header = CUBLAS_HEADER.search(line)
+                if header:
+                    if name is not None:
+                        call = parse_cublas_call(name, args)
+                        if call is not None:
+                            yield call
+                    name, args = header.group(1), []
+                    continue
+                arg = CUBLAS_ARG.match(line)
+                if name is not None and arg:
+                    args.append((arg.group(1), re.sub(r'\(\d+\)$', '', arg.group(2).rstrip(';,'))))
+                    continue
+                if 'rocblas-bench' in line:
+                    call = parse_rocblas_line(line)
+                    if call is not None:
+                        yield call
+            if name is not None:
+                call = parse_cublas_call(name, args)
+                if call is not None:
+                    yield call
+
+
+def format_call(fields):
+    keys = [key for key in FIELD_ORDER if key in fields]
+    keys += sorted(key for key in fields if key not in FIELD_ORDER)
+    return '- { ' + ', '.join(f'{key}: {fields[key]}' for key in keys) + ', ' + BENCH_FIELDS + ' }'
+
+
+def convert(args):
+    counts = Counter(format_call(call) for call in parse_logs(args.logs))
+    out = open(args.output, 'w') if args.output else sys.stdout
+    total = sum(counts.values())
+    out.write(f'# {len(counts)} distinct calls of {total} logged, weighted by their call counts\n')
+    for line, count in counts.most_common():
+        out.write(f'{line} # {count} calls\n')
+    if out is not sys.stdout:
+        out.close()
+    print(f'{total} calls, {len(counts)} distinct', file=sys.stderr)
+
+
+def read_weights(path):
+    weights = []
+    with open(path) as yaml:
+        for line in yaml:
+            match = re.match(r'^- \{.*\}\s*#\s*(\d+) calls', line)
+            if match:
+                weights.append((line[:line.index('}') + 1], int(match.group(1))))
+    return weights
+
+
+def read_times(path):
+    times = []
+    with open(path) as csv:
+        header = None
+        for line in csv:
+            cells = [cell.strip() for cell in line.strip().split(',')]
+            if 'hipblas-us' in cells:
+                header = cells.index('hipblas-us')
+            elif header is not None and len(cells) > header:
+                times.append(float(cells[header]))
+    return times
+
+
+def score(args):
+    weights = read_weights(args.yaml)
+    times = read_times(args.csv)
+    if len(weights) != len(times):
+        sys.exit(f'{args.yaml} has {len(weights)} calls, {args.csv} has {len(times)} runs')
+
+    scored = sorted(((count * us, count, us, line) for (line, count), us in zip(weights, times)),
+                    reverse=True)
+    total = sum(entry[0] for entry in scored)
+    for weighted, count, us, line in scored[:args.top]:
+        print(f'{weighted:14.1f} us {100 * weighted / total if total else 0:6.2f}% '
+              f'{count:8d} x {us:10.3f} us  {line}')
+    print(f'total: {total:.1f} us over {sum(entry[1] for entry in scored)} calls')
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Converts rocBLAS and cuBLAS API logs to hipblas-bench YAML, and scores '
+        'hipblas-bench runs of it by the call counts of the logs')
+    commands = parser.add_subparsers(dest='command', required=True)
+
+    parse = commands.add_parser('convert', help='convert rocblas-bench lines and cuBLAS logs')
+    parse.add_argument('logs', nargs='+', help='ROCBLAS_LAYER=2 or CUBLAS_LOGINFO_DBG logs')
+    parse.add_argument('-o', '--output', help='YAML to write, stdout by default')
+    parse.set_defaults(run=convert)
+
+    parse = commands.add_parser('score', help='weigh a hipblas-bench csv by the call counts')
+    parse.add_argument('yaml', help='YAML written by convert')
+    parse.add_argument('csv', help='hipblas-bench --output csv --output_file of the YAML')
+    parse.add_argument('--top', type=int, default=20, help='calls to list, 20 by default')
+    parse.set_defaults(run=score)
+
+    args = parser.parse_args()
+    args.run(args)
+
+
+if __name__ == '__main__':
+    main()
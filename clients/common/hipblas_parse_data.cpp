@@ -28,15 +28,63 @@
 #include <cstdlib>
 #include <cstring>
 #include <fcntl.h>
+#include <fstream>
+#include <functional>
 #include <iostream>
 #include <string>
 #include <sys/types.h>
 
+#ifndef WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Path of the cached expansion of the YAML file, or empty if it isn't cached.
+// hipblas_gentest.py keeps a content hash of the YAML inputs next to its output, and only expands
+// them again when the hash changes, so a large --yaml file is expanded once and not at every run.
+// HIPBLAS_CLIENT_YAML_CACHE sets the cache directory, and an empty value disables the cache.
+static std::string hipblas_yaml_cache_name(const std::string& yaml)
+{
+    if(yaml == "/dev/stdin")
+        return "";
+
+    std::error_code ec;
+    fs::path        dir;
+    if(const char* env = getenv("HIPBLAS_CLIENT_YAML_CACHE"))
+        dir = env;
+    else
+        dir = fs::temp_directory_path(ec) / "hipblas-yaml-cache";
+
+    if(dir.empty() || ec)
+        return "";
+
+    fs::create_directories(dir, ec);
+    if(ec)
+        return "";
+
+    auto path = fs::absolute(yaml, ec);
+    if(ec)
+        return "";
+
+    char key[32];
+    snprintf(key, sizeof(key), "-%016zx", std::hash<std::string>{}(path.string()));
+#ifdef HIPBLAS_V2
+    return (dir / (path.stem().string() + key + "-v2.bin")).string();
+#else
+    return (dir / (path.stem().string() + key + ".bin")).string();
+#endif
+}
+
 // Parse YAML data
-static std::string hipblas_parse_yaml(const std::string& yaml)
+static std::string hipblas_parse_yaml(const std::string& yaml, bool& cached)
 {
-    std::string tmp     = hipblas_tempname();
-    auto        exepath = hipblas_exepath();
+    std::string tmp = hipblas_yaml_cache_name(yaml);
+    cached          = !tmp.empty();
+    if(!cached)
+        tmp = hipblas_tempname();
+
+    auto exepath = hipblas_exepath();
 #ifdef HIPBLAS_V2
     auto cmd = exepath + "hipblas_gentest.py --hipblas_v2 --template " + exepath
                + "hipblas_template.yaml -o " + tmp + " " + yaml;
@@ -112,14 +160,100 @@ bool hipblas_parse_data(int& argc, char** argv, const std::string& default_file)
     else if(filename == "")
         filename = default_file;
 
+    bool cached = false;
     if(yaml)
-        filename = hipblas_parse_yaml(filename);
+        filename = hipblas_parse_yaml(filename, cached);
 
     if(filename != "")
     {
-        HipBLAS_TestData::set_filename(filename, yaml);
+        HipBLAS_TestData::set_filename(filename, yaml && !cached);
         return true;
     }
 
     return false;
 }
+
+namespace
+{
+    // Stream buffer over a read-only memory mapping of a regular file
+    class hipblas_mapped_buf : public std::streambuf
+    {
+        char*  data = nullptr;
+        size_t size = 0;
+
+    public:
+        // Map the file, leaving the buffer unmapped if it is not a regular file or can't be mapped
+        explicit hipblas_mapped_buf(const std::string& filename)
+        {
+#ifndef WIN32
+            int fd = open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+            if(fd == -1)
+                return;
+
+            struct stat st;
+            if(!fstat(fd, &st) && S_ISREG(st.st_mode) && st.st_size > 0)
+            {
+                void* addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if(addr != MAP_FAILED)
+                {
+                    madvise(addr, st.st_size, MADV_SEQUENTIAL);
+                    data = static_cast<char*>(addr);
+                    size = st.st_size;
+                    setg(data, data, data + size);
+                }
+            }
+            close(fd);
+#endif
+        }
+
+        ~hipblas_mapped_buf()
+        {
+#ifndef WIN32
+            if(data)
+                munmap(data, size);
+#endif
+        }
+
+        bool mapped() const
+        {
+            return data != nullptr;
+        }
+
+    protected:
+        pos_type seekoff(off_type                off,
+                         std::ios_base::seekdir  dir,
+                         std::ios_base::openmode which) override
+        {
+            off_type base = dir == std::ios_base::beg   ? 0
+                            : dir == std::ios_base::cur ? gptr() - eback()
+                                                        : off_type(size);
+            return seekpos(base + off, which);
+        }
+
+        pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+        {
+            if(!(which & std::ios_base::in) || off_type(pos) < 0 || off_type(pos) > off_type(size))
+                return pos_type(off_type(-1));
+            setg(data, data + off_type(pos), data + size);
+            return pos;
+        }
+    };
+}
+
+hipblas_data_stream::hipblas_data_stream(const std::string& filename)
+    : std::istream(nullptr)
+{
+    auto mapped = std::make_unique<hipblas_mapped_buf>(filename);
+    if(mapped->mapped())
+        buf = std::move(mapped);
+    else
+    {
+        // Pipes, such as --data -, and empty files are read through a file buffer
+        auto file = std::make_unique<std::filebuf>();
+        if(file->open(filename, std::ios_base::in | std::ios_base::binary))
+            buf = std::move(file);
+    }
+
+    // A null buffer sets badbit, which the caller reports as a failure to open the file
+    rdbuf(buf.get());
+}
@@ -0,0 +1,340 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas_telemetry.hpp"
+
+#include <hip/hip_runtime_api.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <map>
+
+#ifndef WIN32
+#include <dlfcn.h>
+#if defined(__HIP_PLATFORM_NVIDIA__) && __has_include(<nvml.h>)
+#include <nvml.h>
+#define HIPBLAS_TELEMETRY_NVML
+#elif !defined(__HIP_PLATFORM_NVIDIA__) && __has_include(<rocm_smi/rocm_smi.h>)
+#include <rocm_smi/rocm_smi.h>
+#define HIPBLAS_TELEMETRY_RSMI
+#endif
+#endif
+
+namespace
+{
+    // much shorter than the loops worth sampling, and about as often as the sensors update
+    constexpr auto sample_interval = std::chrono::milliseconds(5);
+
+    double now_us()
+    {
+        auto now = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::micro>(now.time_since_epoch()).count();
+    }
+
+    // the sensors of the devices, read through the management library of the platform, which is
+    // loaded with dlopen the first time they are asked for
+    class sensors
+    {
+        std::mutex         m_mutex;
+        std::map<int, int> m_index;
+
+#if defined(HIPBLAS_TELEMETRY_RSMI)
+        decltype(&rsmi_num_monitor_devices)  m_num_devices      = nullptr;
+        decltype(&rsmi_dev_pci_id_get)       m_pci_id_get       = nullptr;
+        decltype(&rsmi_dev_power_ave_get)    m_power_ave_get    = nullptr;
+        decltype(&rsmi_dev_gpu_clk_freq_get) m_gpu_clk_freq_get = nullptr;
+        decltype(&rsmi_dev_temp_metric_get)  m_temp_metric_get  = nullptr;
+
+        // MI300 devices only report the power of the socket, through a function of newer releases
+        rsmi_status_t (*m_current_socket_power_get)(uint32_t, uint64_t*) = nullptr;
+
+        sensors()
+        {
+            void* library = nullptr;
+            for(const char* name : {"librocm_smi64.so", "librocm_smi64.so.7", "librocm_smi64.so.6"})
+                if((library = dlopen(name, RTLD_NOW | RTLD_LOCAL)))
+                    break;
+            if(!library)
+                return;
+
+            auto init = reinterpret_cast<decltype(&rsmi_init)>(dlsym(library, "rsmi_init"));
+            if(!init || init(0) != RSMI_STATUS_SUCCESS)
+                return;
+
+            m_num_devices = reinterpret_cast<decltype(m_num_devices)>(
+                dlsym(library, "rsmi_num_monitor_devices"));
+            m_pci_id_get = reinterpret_cast<decltype(m_pci_id_get)>(
+                dlsym(library, "rsmi_dev_pci_id_get"));
+            m_power_ave_get = reinterpret_cast<decltype(m_power_ave_get)>(
+                dlsym(library, "rsmi_dev_power_ave_get"));
+            m_gpu_clk_freq_get = reinterpret_cast<decltype(m_gpu_clk_freq_get)>(
+                dlsym(library, "rsmi_dev_gpu_clk_freq_get"));
+            m_temp_metric_get = reinterpret_cast<decltype(m_temp_metric_get)>(
+                dlsym(library, "rsmi_dev_temp_metric_get"));
+            m_current_socket_power_get = reinterpret_cast<decltype(m_current_socket_power_get)>(
+                dlsym(library, "rsmi_dev_current_socket_power_get"));
+        }
+
+        // the ROCm SMI index of the device with the PCI location of the HIP device
+        int find(int device)
+        {
+            hipDeviceProp_t props;
+            uint32_t        count = 0;
+            if(!m_num_devices || !m_pci_id_get
+               || hipGetDeviceProperties(&props, device) != hipSuccess
+               || m_num_devices(&count) != RSMI_STATUS_SUCCESS)
+                return -1;
+
+            // the BDF id is the domain, bus, device and function, from bit 32, 8, 3 and 0
+            uint64_t location = uint64_t(props.pciDomainID) << 32 | uint64_t(props.pciBusID) << 8
+                                | uint64_t(props.pciDeviceID) << 3;
+            for(uint32_t index = 0; index < count; index++)
+            {
+                uint64_t bdfid;
+                if(m_pci_id_get(index, &bdfid) == RSMI_STATUS_SUCCESS
+                   && (bdfid & ~7ull) == location)
+                    return index;
+            }
+            return -1;
+        }
+
+    public:
+        void read(int index, double& watts, double& sclk_mhz, double& mclk_mhz, double& temp_c)
+        {
+            uint64_t microwatts;
+            if(m_power_ave_get && m_power_ave_get(index, 0, &microwatts) == RSMI_STATUS_SUCCESS)
+                watts = microwatts * 1e-6;
+            else if(m_current_socket_power_get
+                    && m_current_socket_power_get(index, &microwatts) == RSMI_STATUS_SUCCESS)
+                watts = microwatts * 1e-6;
+
+            auto clock_mhz = [&](rsmi_clk_type_t type, double& mhz) {
+                rsmi_frequencies_t frequencies;
+                if(m_gpu_clk_freq_get
+                   && m_gpu_clk_freq_get(index, type, &frequencies) == RSMI_STATUS_SUCCESS
+                   && frequencies.current < frequencies.num_supported)
+                    mhz = frequencies.frequency[frequencies.current] * 1e-6;
+            };
+            clock_mhz(RSMI_CLK_TYPE_SYS, sclk_mhz);
+            clock_mhz(RSMI_CLK_TYPE_MEM, mclk_mhz);
+
+            // the junction temperature, or the edge temperature of the devices without it
+            int64_t millidegrees;
+            for(auto sensor : {RSMI_TEMP_TYPE_JUNCTION, RSMI_TEMP_TYPE_EDGE})
+                if(m_temp_metric_get
+                   && m_temp_metric_get(index, sensor, RSMI_TEMP_CURRENT, &millidegrees)
+                          == RSMI_STATUS_SUCCESS)
+                {
+                    temp_c = millidegrees * 1e-3;
+                    break;
+                }
+        }
+#elif defined(HIPBLAS_TELEMETRY_NVML)
+        decltype(&nvmlDeviceGetHandleByPciBusId_v2) m_handle_by_pci_bus_id = nullptr;
+        decltype(&nvmlDeviceGetPowerUsage)          m_power_usage          = nullptr;
+        decltype(&nvmlDeviceGetClockInfo)           m_clock_info           = nullptr;
+        decltype(&nvmlDeviceGetTemperature)         m_temperature          = nullptr;
+        std::vector<nvmlDevice_t>                   m_devices;
+
+        sensors()
+        {
+            void* library = nullptr;
+            for(const char* name : {"libnvidia-ml.so.1", "libnvidia-ml.so"})
+                if((library = dlopen(name, RTLD_NOW | RTLD_LOCAL)))
+                    break;
+            if(!library)
+                return;
+
+            auto init = reinterpret_cast<decltype(&nvmlInit_v2)>(dlsym(library, "nvmlInit_v2"));
+            if(!init || init() != NVML_SUCCESS)
+                return;
+
+            m_handle_by_pci_bus_id = reinterpret_cast<decltype(m_handle_by_pci_bus_id)>(
+                dlsym(library, "nvmlDeviceGetHandleByPciBusId_v2"));
+            m_power_usage = reinterpret_cast<decltype(m_power_usage)>(
+                dlsym(library, "nvmlDeviceGetPowerUsage"));
+            m_clock_info = reinterpret_cast<decltype(m_clock_info)>(
+                dlsym(library, "nvmlDeviceGetClockInfo"));
+            m_temperature = reinterpret_cast<decltype(m_temperature)>(
+                dlsym(library, "nvmlDeviceGetTemperature"));
+        }
+
+        // the index in m_devices of the NVML handle of the device at the PCI location of the HIP
+        // device
+        int find(int device)
+        {
+            char         bus_id[64];
+            nvmlDevice_t handle;
+            if(!m_handle_by_pci_bus_id
+               || hipDeviceGetPCIBusId(bus_id, sizeof(bus_id), device) != hipSuccess
+               || m_handle_by_pci_bus_id(bus_id, &handle) != NVML_SUCCESS)
+                return -1;
+            m_devices.push_back(handle);
+            return int(m_devices.size()) - 1;
+        }
+
+    public:
+        void read(int index, double& watts, double& sclk_mhz, double& mclk_mhz, double& temp_c)
+        {
+            nvmlDevice_t handle;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                handle = m_devices[index];
+            }
+
+            unsigned int value;
+            if(m_power_usage && m_power_usage(handle, &value) == NVML_SUCCESS)
+                watts = value * 1e-3;
+            if(m_clock_info && m_clock_info(handle, NVML_CLOCK_SM, &value) == NVML_SUCCESS)
+                sclk_mhz = value;
+            if(m_clock_info && m_clock_info(handle, NVML_CLOCK_MEM, &value) == NVML_SUCCESS)
+                mclk_mhz = value;
+            if(m_temperature && m_temperature(handle, NVML_TEMPERATURE_GPU, &value) == NVML_SUCCESS)
+                temp_c = value;
+        }
+#else
+        sensors() = default;
+
+        int find(int)
+        {
+            return -1;
+        }
+
+    public:
+        void read(int, double&, double&, double&, double&) {}
+#endif
+
+        static sensors& get()
+        {
+            static sensors instance;
+            return instance;
+        }
+
+        // the index of the HIP device for read, or -1 if its sensors can't be read
+        int index(int device)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            auto found = m_index.find(device);
+            if(found == m_index.end())
+                found = m_index.emplace(device, find(device)).first;
+            return found->second;
+        }
+    };
+
+    thread_local hipblas_telemetry_summary last_summary;
+}
+
+hipblas_telemetry::~hipblas_telemetry()
+{
+    stop();
+}
+
+void hipblas_telemetry::sample_loop(int index)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for(;;)
+    {
+        // a last sample is read after stop, so the samples span the whole loop
+        bool stopping = m_stop;
+        lock.unlock();
+
+        sample s{now_us(), -1.0, -1.0, -1.0, -1.0};
+        sensors::get().read(index, s.watts, s.sclk_mhz, s.mclk_mhz, s.temp_c);
+
+        lock.lock();
+        m_samples.push_back(s);
+        if(stopping)
+            return;
+        m_wake.wait_for(lock, sample_interval, [&] { return m_stop; });
+    }
+}
+
+void hipblas_telemetry::start(int device)
+{
+    stop();
+
+    m_samples.clear();
+    m_started = true;
+    m_stop    = false;
+    int index = sensors::get().index(device);
+    if(index >= 0)
+        m_thread = std::thread(&hipblas_telemetry::sample_loop, this, index);
+}
+
+void hipblas_telemetry::stop()
+{
+    if(!m_started)
+        return;
+    m_started = false;
+
+    if(m_thread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_one();
+        m_thread.join();
+    }
+
+    // the means over time, and -1 for what isn't reported
+    auto mean = [&](double sample::*value) {
+        double sum = 0, us = 0;
+        for(size_t i = 0; i < m_samples.size(); i++)
+        {
+            if(m_samples[i].*value < 0)
+                return -1.0;
+            if(i)
+            {
+                double dt = m_samples[i].us - m_samples[i - 1].us;
+                sum += (m_samples[i].*value + m_samples[i - 1].*value) / 2 * dt;
+                us += dt;
+            }
+        }
+        return us > 0 ? sum / us : m_samples.empty() ? -1.0 : m_samples[0].*value;
+    };
+
+    last_summary.samples    = int(m_samples.size());
+    last_summary.watts      = mean(&sample::watts);
+    last_summary.sclk_mhz   = mean(&sample::sclk_mhz);
+    last_summary.mclk_mhz   = mean(&sample::mclk_mhz);
+    last_summary.max_temp_c = -1.0;
+    for(auto& s : m_samples)
+        last_summary.max_temp_c = std::max(last_summary.max_temp_c, s.temp_c);
+}
+
+const hipblas_telemetry_summary& hipblas_telemetry::last()
+{
+    return last_summary;
+}
+
+double hipblas_telemetry::sclk_mhz(int device)
+{
+    double watts = -1.0, sclk_mhz = -1.0, mclk_mhz = -1.0, temp_c = -1.0;
+    int    index = sensors::get().index(device);
+    if(index >= 0)
+        sensors::get().read(index, watts, sclk_mhz, mclk_mhz, temp_c);
+    return sclk_mhz;
+}
@@ -14107,6 +14107,49 @@ hipblasStatus_t hipblasZgeqrfBatchedCast(hipblasHandle_t             handle,
                                 batchCount);
 }
 
+// geqrf_batched_strided_tau
+hipblasStatus_t hipblasCgeqrfBatchedStridedTauCast(hipblasHandle_t       handle,
+                                                   const int             m,
+                                                   const int             n,
+                                                   hipblasComplex* const A[],
+                                                   const int             lda,
+                                                   hipblasComplex*       tau,
+                                                   const hipblasStride   strideT,
+                                                   int*                  info,
+                                                   const int             batchCount)
+{
+    return hipblasCgeqrfBatchedStridedTau(handle,
+                                          m,
+                                          n,
+                                          (hipComplex* const*)A,
+                                          lda,
+                                          (hipComplex*)tau,
+                                          strideT,
+                                          info,
+                                          batchCount);
+}
+
+hipblasStatus_t hipblasZgeqrfBatchedStridedTauCast(hipblasHandle_t             handle,
+                                                   const int                   m,
+                                                   const int                   n,
+                                                   hipblasDoubleComplex* const A[],
+                                                   const int                   lda,
+                                                   hipblasDoubleComplex*       tau,
+                                                   const hipblasStride         strideT,
+                                                   int*                        info,
+                                                   const int                   batchCount)
+{
+    return hipblasZgeqrfBatchedStridedTau(handle,
+                                          m,
+                                          n,
+                                          (hipDoubleComplex* const*)A,
+                                          lda,
+                                          (hipDoubleComplex*)tau,
+                                          strideT,
+                                          info,
+                                          batchCount);
+}
+
 // geqrf_strided_batched
 hipblasStatus_t hipblasCgeqrfStridedBatchedCast(hipblasHandle_t     handle,
                                                 const int           m,
@@ -14306,5 +14349,763 @@ hipblasStatus_t hipblasZgelsStridedBatchedCast(hipblasHandle_t       handle,
                                       batchCount);
 }
 
+// potrf
+hipblasStatus_t hipblasCpotrfCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasComplex*         A,
+                                  const int               lda,
+                                  int*                    info)
+{
+    return hipblasCpotrf(handle, uplo, n, (hipComplex*)A, lda, info);
+}
+
+hipblasStatus_t hipblasZpotrfCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasDoubleComplex*   A,
+                                  const int               lda,
+                                  int*                    info)
+{
+    return hipblasZpotrf(handle, uplo, n, (hipDoubleComplex*)A, lda, info);
+}
+
+hipblasStatus_t hipblasCpotrfBatchedCast(hipblasHandle_t         handle,
+                                         const hipblasFillMode_t uplo,
+                                         const int               n,
+                                         hipblasComplex* const   A[],
+                                         const int               lda,
+                                         int*                    info,
+                                         const int               batchCount)
+{
+    return hipblasCpotrfBatched(handle, uplo, n, (hipComplex* const*)A, lda, info, batchCount);
+}
+
+hipblasStatus_t hipblasZpotrfBatchedCast(hipblasHandle_t             handle,
+                                         const hipblasFillMode_t     uplo,
+                                         const int                   n,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         int*                        info,
+                                         const int                   batchCount)
+{
+    return hipblasZpotrfBatched(
+        handle, uplo, n, (hipDoubleComplex* const*)A, lda, info, batchCount);
+}
+
+hipblasStatus_t hipblasCpotrfStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasComplex*         A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                int*                    info,
+                                                const int               batchCount)
+{
+    return hipblasCpotrfStridedBatched(
+        handle, uplo, n, (hipComplex*)A, lda, strideA, info, batchCount);
+}
+
+hipblasStatus_t hipblasZpotrfStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasDoubleComplex*   A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                int*                    info,
+                                                const int               batchCount)
+{
+    return hipblasZpotrfStridedBatched(
+        handle, uplo, n, (hipDoubleComplex*)A, lda, strideA, info, batchCount);
+}
+
+// potrs
+hipblasStatus_t hipblasCpotrsCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  const int               nrhs,
+                                  hipblasComplex*         A,
+                                  const int               lda,
+                                  hipblasComplex*         B,
+                                  const int               ldb,
+                                  int*                    info)
+{
+    return hipblasCpotrs(handle, uplo, n, nrhs, (hipComplex*)A, lda, (hipComplex*)B, ldb, info);
+}
+
+hipblasStatus_t hipblasZpotrsCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  const int               nrhs,
+                                  hipblasDoubleComplex*   A,
+                                  const int               lda,
+                                  hipblasDoubleComplex*   B,
+                                  const int               ldb,
+                                  int*                    info)
+{
+    return hipblasZpotrs(
+        handle, uplo, n, nrhs, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)B, ldb, info);
+}
+
+hipblasStatus_t hipblasCpotrsBatchedCast(hipblasHandle_t         handle,
+                                         const hipblasFillMode_t uplo,
+                                         const int               n,
+                                         const int               nrhs,
+                                         hipblasComplex* const   A[],
+                                         const int               lda,
+                                         hipblasComplex* const   B[],
+                                         const int               ldb,
+                                         int*                    info,
+                                         const int               batchCount)
+{
+    return hipblasCpotrsBatched(handle,
+                                uplo,
+                                n,
+                                nrhs,
+                                (hipComplex* const*)A,
+                                lda,
+                                (hipComplex* const*)B,
+                                ldb,
+                                info,
+                                batchCount);
+}
+
+hipblasStatus_t hipblasZpotrsBatchedCast(hipblasHandle_t             handle,
+                                         const hipblasFillMode_t     uplo,
+                                         const int                   n,
+                                         const int                   nrhs,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         hipblasDoubleComplex* const B[],
+                                         const int                   ldb,
+                                         int*                        info,
+                                         const int                   batchCount)
+{
+    return hipblasZpotrsBatched(handle,
+                                uplo,
+                                n,
+                                nrhs,
+                                (hipDoubleComplex* const*)A,
+                                lda,
+                                (hipDoubleComplex* const*)B,
+                                ldb,
+                                info,
+                                batchCount);
+}
+
+hipblasStatus_t hipblasCpotrsStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                const int               nrhs,
+                                                hipblasComplex*         A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                hipblasComplex*         B,
+                                                const int               ldb,
+                                                const hipblasStride     strideB,
+                                                int*                    info,
+                                                const int               batchCount)
+{
+    return hipblasCpotrsStridedBatched(handle,
+                                       uplo,
+                                       n,
+                                       nrhs,
+                                       (hipComplex*)A,
+                                       lda,
+                                       strideA,
+                                       (hipComplex*)B,
+                                       ldb,
+                                       strideB,
+                                       info,
+                                       batchCount);
+}
+
+hipblasStatus_t hipblasZpotrsStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                const int               nrhs,
+                                                hipblasDoubleComplex*   A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                hipblasDoubleComplex*   B,
+                                                const int               ldb,
+                                                const hipblasStride     strideB,
+                                                int*                    info,
+                                                const int               batchCount)
+{
+    return hipblasZpotrsStridedBatched(handle,
+                                       uplo,
+                                       n,
+                                       nrhs,
+                                       (hipDoubleComplex*)A,
+                                       lda,
+                                       strideA,
+                                       (hipDoubleComplex*)B,
+                                       ldb,
+                                       strideB,
+                                       info,
+                                       batchCount);
+}
+
+// potri
+hipblasStatus_t hipblasCpotriCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasComplex*         A,
+                                  const int               lda,
+                                  int*                    info)
+{
+    return hipblasCpotri(handle, uplo, n, (hipComplex*)A, lda, info);
+}
+
+hipblasStatus_t hipblasZpotriCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasDoubleComplex*   A,
+                                  const int               lda,
+                                  int*                    info)
+{
+    return hipblasZpotri(handle, uplo, n, (hipDoubleComplex*)A, lda, info);
+}
+
+hipblasStatus_t hipblasCpotriBatchedCast(hipblasHandle_t         handle,
+                                         const hipblasFillMode_t uplo,
+                                         const int               n,
+                                         hipblasComplex* const   A[],
+                                         const int               lda,
+                                         int*                    info,
+                                         const int               batchCount)
+{
+    return hipblasCpotriBatched(handle, uplo, n, (hipComplex* const*)A, lda, info, batchCount);
+}
+
+hipblasStatus_t hipblasZpotriBatchedCast(hipblasHandle_t             handle,
+                                         const hipblasFillMode_t     uplo,
+                                         const int                   n,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         int*                        info,
+                                         const int                   batchCount)
+{
+    return hipblasZpotriBatched(
+        handle, uplo, n, (hipDoubleComplex* const*)A, lda, info, batchCount);
+}
+
+hipblasStatus_t hipblasCpotriStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasComplex*         A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                int*                    info,
+                                                const int               batchCount)
+{
+    return hipblasCpotriStridedBatched(
+        handle, uplo, n, (hipComplex*)A, lda, strideA, info, batchCount);
+}
+
+hipblasStatus_t hipblasZpotriStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasDoubleComplex*   A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                int*                    info,
+                                                const int               batchCount)
+{
+    return hipblasZpotriStridedBatched(
+        handle, uplo, n, (hipDoubleComplex*)A, lda, strideA, info, batchCount);
+}
+
+
+// syevj, syevd
+hipblasStatus_t hipblasCheevjCast(hipblasHandle_t         handle,
+                                  const hipblasEvect_t    evect,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasComplex*         A,
+                                  const int               lda,
+                                  const float             abstol,
+                                  float*                  residual,
+                                  const int               maxSweeps,
+                                  int*                    nSweeps,
+                                  float*                  W,
+                                  int*                    info)
+{
+    return hipblasCheevj(
+        handle, evect, uplo, n, (hipComplex*)A, lda, abstol, residual, maxSweeps, nSweeps, W, info);
+}
+
+hipblasStatus_t hipblasZheevjCast(hipblasHandle_t         handle,
+                                  const hipblasEvect_t    evect,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasDoubleComplex*   A,
+                                  const int               lda,
+                                  const double            abstol,
+                                  double*                 residual,
+                                  const int               maxSweeps,
+                                  int*                    nSweeps,
+                                  double*                 W,
+                                  int*                    info)
+{
+    return hipblasZheevj(handle,
+                         evect,
+                         uplo,
+                         n,
+                         (hipDoubleComplex*)A,
+                         lda,
+                         abstol,
+                         residual,
+                         maxSweeps,
+                         nSweeps,
+                         W,
+                         info);
+}
+
+hipblasStatus_t hipblasCheevjBatchedCast(hipblasHandle_t         handle,
+                                         const hipblasEvect_t    evect,
+                                         const hipblasFillMode_t uplo,
+                                         const int               n,
+                                         hipblasComplex* const   A[],
+                                         const int               lda,
+                                         const float             abstol,
+                                         float*                  residual,
+                                         const int               maxSweeps,
+                                         int*                    nSweeps,
+                                         float*                  W,
+                                         const hipblasStride     strideW,
+                                         int*                    info,
+                                         const int               batchCount)
+{
+    return hipblasCheevjBatched(handle,
+                                evect,
+                                uplo,
+                                n,
+                                (hipComplex* const*)A,
+                                lda,
+                                abstol,
+                                residual,
+                                maxSweeps,
+                                nSweeps,
+                                W,
+                                strideW,
+                                info,
+                                batchCount);
+}
+
+hipblasStatus_t hipblasZheevjBatchedCast(hipblasHandle_t             handle,
+                                         const hipblasEvect_t        evect,
+                                         const hipblasFillMode_t     uplo,
+                                         const int                   n,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         const double                abstol,
+                                         double*                     residual,
+                                         const int                   maxSweeps,
+                                         int*                        nSweeps,
+                                         double*                     W,
+                                         const hipblasStride         strideW,
+                                         int*                        info,
+                                         const int                   batchCount)
+{
+    return hipblasZheevjBatched(handle,
+                                evect,
+                                uplo,
+                                n,
+                                (hipDoubleComplex* const*)A,
+                                lda,
+                                abstol,
+                                residual,
+                                maxSweeps,
+                                nSweeps,
+                                W,
+                                strideW,
+                                info,
+                                batchCount);
+}
+
+hipblasStatus_t hipblasCheevjStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasEvect_t    evect,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasComplex*         A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                const float             abstol,
+                                                float*                  residual,
+                                                const int               maxSweeps,
+                                                int*                    nSweeps,
+                                                float*                  W,
+                                                const hipblasStride     strideW,
+                                                int*                    info,
+                                                const int               batchCount)
+{
+    return hipblasCheevjStridedBatched(handle,
+                                       evect,
+                                       uplo,
+                                       n,
+                                       (hipComplex*)A,
+                                       lda,
+                                       strideA,
+                                       abstol,
+                                       residual,
+                                       maxSweeps,
+                                       nSweeps,
+                                       W,
+                                       strideW,
+                                       info,
+                                       batchCount);
+}
+
+hipblasStatus_t hipblasZheevjStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasEvect_t    evect,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasDoubleComplex*   A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                const double            abstol,
+                                                double*                 residual,
+                                                const int               maxSweeps,
+                                                int*                    nSweeps,
+                                                double*                 W,
+                                                const hipblasStride     strideW,
+                                                int*                    info,
+                                                const int               batchCount)
+{
+    return hipblasZheevjStridedBatched(handle,
+                                       evect,
+                                       uplo,
+                                       n,
+                                       (hipDoubleComplex*)A,
+                                       lda,
+                                       strideA,
+                                       abstol,
+                                       residual,
+                                       maxSweeps,
+                                       nSweeps,
+                                       W,
+                                       strideW,
+                                       info,
+                                       batchCount);
+}
+
+hipblasStatus_t hipblasCheevdCast(hipblasHandle_t         handle,
+                                  const hipblasEvect_t    evect,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasComplex*         A,
+                                  const int               lda,
+                                  float*                  D,
+                                  float*                  E,
+                                  int*                    info)
+{
+    return hipblasCheevd(handle, evect, uplo, n, (hipComplex*)A, lda, D, E, info);
+}
+
+hipblasStatus_t hipblasZheevdCast(hipblasHandle_t         handle,
+                                  const hipblasEvect_t    evect,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasDoubleComplex*   A,
+                                  const int               lda,
+                                  double*                 D,
+                                  double*                 E,
+                                  int*                    info)
+{
+    return hipblasZheevd(handle, evect, uplo, n, (hipDoubleComplex*)A, lda, D, E, info);
+}
+
+// gesvdj
+hipblasStatus_t hipblasCgesvdjBatchedCast(hipblasHandle_t       handle,
+                                          const hipblasSvect_t  leftSvect,
+                                          const hipblasSvect_t  rightSvect,
+                                          const int             m,
+                                          const int             n,
+                                          hipblasComplex* const A[],
+                                          const int             lda,
+                                          const float           abstol,
+                                          float*                residual,
+                                          const int             maxSweeps,
+                                          int*                  nSweeps,
+                                          float*                S,
+                                          const hipblasStride   strideS,
+                                          hipblasComplex*       U,
+                                          const int             ldu,
+                                          const hipblasStride   strideU,
+                                          hipblasComplex*       V,
+                                          const int             ldv,
+                                          const hipblasStride   strideV,
+                                          int*                  info,
+                                          const int             batchCount)
+{
+    return hipblasCgesvdjBatched(handle,
+                                 leftSvect,
+                                 rightSvect,
+                                 m,
+                                 n,
+                                 (hipComplex* const*)A,
+                                 lda,
+                                 abstol,
+                                 residual,
+                                 maxSweeps,
+                                 nSweeps,
+                                 S,
+                                 strideS,
+                                 (hipComplex*)U,
+                                 ldu,
+                                 strideU,
+                                 (hipComplex*)V,
+                                 ldv,
+                                 strideV,
+                                 info,
+                                 batchCount);
+}
+
+hipblasStatus_t hipblasZgesvdjBatchedCast(hipblasHandle_t             handle,
+                                          const hipblasSvect_t        leftSvect,
+                                          const hipblasSvect_t        rightSvect,
+                                          const int                   m,
+                                          const int                   n,
+                                          hipblasDoubleComplex* const A[],
+                                          const int                   lda,
+                                          const double                abstol,
+                                          double*                     residual,
+                                          const int                   maxSweeps,
+                                          int*                        nSweeps,
+                                          double*                     S,
+                                          const hipblasStride         strideS,
+                                          hipblasDoubleComplex*       U,
+                                          const int                   ldu,
+                                          const hipblasStride         strideU,
+                                          hipblasDoubleComplex*       V,
+                                          const int                   ldv,
+                                          const hipblasStride         strideV,
+                                          int*                        info,
+                                          const int                   batchCount)
+{
+    return hipblasZgesvdjBatched(handle,
+                                 leftSvect,
+                                 rightSvect,
+                                 m,
+                                 n,
+                                 (hipDoubleComplex* const*)A,
+                                 lda,
+                                 abstol,
+                                 residual,
+                                 maxSweeps,
+                                 nSweeps,
+                                 S,
+                                 strideS,
+                                 (hipDoubleComplex*)U,
+                                 ldu,
+                                 strideU,
+                                 (hipDoubleComplex*)V,
+                                 ldv,
+                                 strideV,
+                                 info,
+                                 batchCount);
+}
+
+hipblasStatus_t hipblasCgesvdjStridedBatchedCast(hipblasHandle_t      handle,
+                                                 const hipblasSvect_t leftSvect,
+                                                 const hipblasSvect_t rightSvect,
+                                                 const int            m,
+                                                 const int            n,
+                                                 hipblasComplex*      A,
+                                                 const int            lda,
+                                                 const hipblasStride  strideA,
+                                                 const float          abstol,
+                                                 float*               residual,
+                                                 const int            maxSweeps,
+                                                 int*                 nSweeps,
+                                                 float*               S,
+                                                 const hipblasStride  strideS,
+                                                 hipblasComplex*      U,
+                                                 const int            ldu,
+                                                 const hipblasStride  strideU,
+                                                 hipblasComplex*      V,
+                                                 const int            ldv,
+                                                 const hipblasStride  strideV,
+                                                 int*                 info,
+                                                 const int            batchCount)
+{
+    return hipblasCgesvdjStridedBatched(handle,
+                                        leftSvect,
+                                        rightSvect,
+                                        m,
+                                        n,
+                                        (hipComplex*)A,
+                                        lda,
+                                        strideA,
+                                        abstol,
+                                        residual,
+                                        maxSweeps,
+                                        nSweeps,
+                                        S,
+                                        strideS,
+                                        (hipComplex*)U,
+                                        ldu,
+                                        strideU,
+                                        (hipComplex*)V,
+                                        ldv,
+                                        strideV,
+                                        info,
+                                        batchCount);
+}
+
+hipblasStatus_t hipblasZgesvdjStridedBatchedCast(hipblasHandle_t       handle,
+                                                 const hipblasSvect_t  leftSvect,
+                                                 const hipblasSvect_t  rightSvect,
+                                                 const int             m,
+                                                 const int             n,
+                                                 hipblasDoubleComplex* A,
+                                                 const int             lda,
+                                                 const hipblasStride   strideA,
+                                                 const double          abstol,
+                                                 double*               residual,
+                                                 const int             maxSweeps,
+                                                 int*                  nSweeps,
+                                                 double*               S,
+                                                 const hipblasStride   strideS,
+                                                 hipblasDoubleComplex* U,
+                                                 const int             ldu,
+                                                 const hipblasStride   strideU,
+                                                 hipblasDoubleComplex* V,
+                                                 const int             ldv,
+                                                 const hipblasStride   strideV,
+                                                 int*                  info,
+                                                 const int             batchCount)
+{
+    return hipblasZgesvdjStridedBatched(handle,
+                                        leftSvect,
+                                        rightSvect,
+                                        m,
+                                        n,
+                                        (hipDoubleComplex*)A,
+                                        lda,
+                                        strideA,
+                                        abstol,
+                                        residual,
+                                        maxSweeps,
+                                        nSweeps,
+                                        S,
+                                        strideS,
+                                        (hipDoubleComplex*)U,
+                                        ldu,
+                                        strideU,
+                                        (hipDoubleComplex*)V,
+                                        ldv,
+                                        strideV,
+                                        info,
+                                        batchCount);
+}
+
+// gesv
+hipblasStatus_t hipblasCgesvBatchedCast(hipblasHandle_t       handle,
+                                        const int             n,
+                                        const int             nrhs,
+                                        hipblasComplex* const A[],
+                                        const int             lda,
+                                        int*                  ipiv,
+                                        hipblasComplex* const B[],
+                                        const int             ldb,
+                                        int*                  info,
+                                        const int             batchCount)
+{
+    return hipblasCgesvBatched(handle,
+                               n,
+                               nrhs,
+                               (hipComplex* const*)A,
+                               lda,
+                               ipiv,
+                               (hipComplex* const*)B,
+                               ldb,
+                               info,
+                               batchCount);
+}
+
+hipblasStatus_t hipblasZgesvBatchedCast(hipblasHandle_t             handle,
+                                        const int                   n,
+                                        const int                   nrhs,
+                                        hipblasDoubleComplex* const A[],
+                                        const int                   lda,
+                                        int*                        ipiv,
+                                        hipblasDoubleComplex* const B[],
+                                        const int                   ldb,
+                                        int*                        info,
+                                        const int                   batchCount)
+{
+    return hipblasZgesvBatched(handle,
+                               n,
+                               nrhs,
+                               (hipDoubleComplex* const*)A,
+                               lda,
+                               ipiv,
+                               (hipDoubleComplex* const*)B,
+                               ldb,
+                               info,
+                               batchCount);
+}
+
+hipblasStatus_t hipblasCgesvStridedBatchedCast(hipblasHandle_t     handle,
+                                               const int           n,
+                                               const int           nrhs,
+                                               hipblasComplex*     A,
+                                               const int           lda,
+                                               const hipblasStride strideA,
+                                               int*                ipiv,
+                                               const hipblasStride strideP,
+                                               hipblasComplex*     B,
+                                               const int           ldb,
+                                               const hipblasStride strideB,
+                                               int*                info,
+                                               const int           batchCount)
+{
+    return hipblasCgesvStridedBatched(handle,
+                                      n,
+                                      nrhs,
+                                      (hipComplex*)A,
+                                      lda,
+                                      strideA,
+                                      ipiv,
+                                      strideP,
+                                      (hipComplex*)B,
+                                      ldb,
+                                      strideB,
+                                      info,
+                                      batchCount);
+}
+
+hipblasStatus_t hipblasZgesvStridedBatchedCast(hipblasHandle_t       handle,
+                                               const int             n,
+                                               const int             nrhs,
+                                               hipblasDoubleComplex* A,
+                                               const int             lda,
+                                               const hipblasStride   strideA,
+                                               int*                  ipiv,
+                                               const hipblasStride   strideP,
+                                               hipblasDoubleComplex* B,
+                                               const int             ldb,
+                                               const hipblasStride   strideB,
+                                               int*                  info,
+                                               const int             batchCount)
+{
+    return hipblasZgesvStridedBatched(handle,
+                                      n,
+                                      nrhs,
+                                      (hipDoubleComplex*)A,
+                                      lda,
+                                      strideA,
+                                      ipiv,
+                                      strideP,
+                                      (hipDoubleComplex*)B,
+                                      ldb,
+                                      strideB,
+                                      info,
+                                      batchCount);
+}
+
 #endif // solver
 #endif // HIPBLAS_V2
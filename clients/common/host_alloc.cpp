@@ -30,44 +30,150 @@
 #include <string.h>
 #endif
 
+#include <atomic>
+#include <cstdint>
 #include <map>
 #include <mutex>
 #include <stdlib.h>
+#include <unordered_map>
+#include <vector>
 
+#include "device_alloc.hpp"
 #include "hipblas_test.hpp"
 #include "host_alloc.hpp"
+#include "test_cleanup.hpp"
 
-// light weight memory tracking for threshold limit on total use
-static size_t                  mem_used{0};
-static std::map<void*, size_t> mem_allocated;
-static std::mutex              mem_mutex;
+// light weight memory tracking for threshold limit on total use, sharded by the address so that
+// threads allocating at the same time rarely wait for each other
+struct host_alloc_block
+{
+    size_t size;
+    size_t pinned; // size class of a block of the pinned pool, or 0 if allocated with malloc
+};
+
+struct host_alloc_shard
+{
+    std::mutex                                  mutex;
+    std::unordered_map<void*, host_alloc_block> allocated;
+};
+
+static constexpr int       mem_shard_bits = 6;
+static host_alloc_shard    mem_shards[1 << mem_shard_bits];
+static std::atomic<size_t> mem_used{0};
+
+inline host_alloc_shard& mem_shard(void* ptr)
+{
+    // Fibonacci hashing, as the low bits of large blocks are all 0
+    return mem_shards[(uint64_t(uintptr_t(ptr)) * 0x9E3779B97F4A7C15ull) >> (64 - mem_shard_bits)];
+}
 
-inline void alloc_ptr_use(void* ptr, size_t size)
+inline void alloc_ptr_use(void* ptr, size_t size, size_t pinned = 0)
 {
-    std::lock_guard<std::mutex> lock(mem_mutex);
     if(ptr)
     {
-        mem_allocated[ptr] = size;
+        auto&                       shard = mem_shard(ptr);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.allocated[ptr] = {size, pinned};
         mem_used += size;
     }
 }
 
-inline void free_ptr_use(void* ptr)
+// Returns the pinned size class of the block, or 0 if it isn't pinned or isn't tracked
+inline size_t free_ptr_use(void* ptr)
 {
-    std::lock_guard<std::mutex> lock(mem_mutex);
-    if(ptr && mem_allocated[ptr])
-    {
-        mem_used -= mem_allocated[ptr];
-        mem_allocated.erase(ptr);
-    }
+    if(!ptr)
+        return 0;
+
+    auto&                       shard = mem_shard(ptr);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.allocated.find(ptr);
+    if(it == shard.allocated.end())
+        return 0;
+
+    size_t pinned = it->second.pinned;
+    mem_used -= it->second.size;
+    shard.allocated.erase(it);
+    return pinned;
 }
 
 size_t host_bytes_allocated()
 {
-    std::lock_guard<std::mutex> lock(mem_mutex);
     return mem_used;
 }
 
+// cache of freed pinned blocks by size class
+static std::map<size_t, std::vector<void*>> pinned_cached;
+static std::mutex                           pinned_mutex;
+
+inline bool host_pinned_enabled()
+{
+    static const bool enabled = getenv("HIPBLAS_CLIENT_PINNED_HOST") != nullptr;
+    return enabled;
+}
+
+// pinned_mutex must be held
+static void host_pinned_release_locked()
+{
+    for(auto& cached : pinned_cached)
+        for(void* ptr : cached.second)
+            (void)hipHostFree(ptr);
+    pinned_cached.clear();
+}
+
+// Releases the pinned cache when test_cleanup::cleanup() deletes it
+struct host_pinned_cleanup
+{
+    ~host_pinned_cleanup()
+    {
+        std::lock_guard<std::mutex> lock(pinned_mutex);
+        host_pinned_release_locked();
+    }
+};
+
+//!
+//! @brief Allocates a pinned block of the size class of size from the cache, or with
+//!        hipHostMalloc. Returns nullptr and the class in bytes.
+//!
+static void* host_pinned_malloc(size_t size, size_t& bytes)
+{
+    bytes = pool_size_class(size);
+
+    std::lock_guard<std::mutex> lock(pinned_mutex);
+
+    static host_pinned_cleanup* cleanup = nullptr;
+    if(!cleanup)
+        cleanup = test_cleanup::allocate(&cleanup);
+
+    auto& cached = pinned_cached[bytes];
+    if(!cached.empty())
+    {
+        void* ptr = cached.back();
+        cached.pop_back();
+        return ptr;
+    }
+
+    void* ptr = nullptr;
+    if(hipHostMalloc(&ptr, bytes, hipHostMallocDefault) != hipSuccess)
+    {
+        // the cache may hold the memory the driver can't pin, so free it and try again
+        (void)hipGetLastError();
+        host_pinned_release_locked();
+        if(hipHostMalloc(&ptr, bytes, hipHostMallocDefault) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            ptr = nullptr;
+        }
+    }
+    return ptr;
+}
+
+static void host_pinned_free(void* ptr, size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(pinned_mutex);
+    pinned_cached[bytes].push_back(ptr);
+}
+
 //!
 //! @brief Memory free helper.  Returns kB or -1 if unknown.
 //!
@@ -184,7 +290,8 @@ void* host_malloc(size_t size)
 {
     if(host_mem_safe(size))
     {
-        void* ptr = malloc(size);
+        size_t pinned = 0;
+        void*  ptr    = host_pinned_enabled() ? host_pinned_malloc(size, pinned) : malloc(size);
 
         static int value = -1;
 
@@ -202,7 +309,7 @@ void* host_malloc(size_t size)
         if(value != -1 && ptr)
             memset(ptr, value, size);
 
-        alloc_ptr_use(ptr, size);
+        alloc_ptr_use(ptr, size, pinned);
 
         return ptr;
     }
@@ -214,8 +321,21 @@ void* host_calloc(size_t nmemb, size_t size)
 {
     if(host_mem_safe(nmemb * size))
     {
-        void* ptr = calloc(nmemb, size);
-        alloc_ptr_use(ptr, size);
+        void* ptr;
+        if(host_pinned_enabled())
+        {
+            // blocks of the pinned pool are reused, so clear them here
+            size_t pinned;
+            ptr = host_pinned_malloc(nmemb * size, pinned);
+            if(ptr)
+                memset(ptr, 0, nmemb * size);
+            alloc_ptr_use(ptr, nmemb * size, pinned);
+        }
+        else
+        {
+            ptr = calloc(nmemb, size);
+            alloc_ptr_use(ptr, nmemb * size);
+        }
         return ptr;
     }
     else
@@ -224,6 +344,9 @@ void* host_calloc(size_t nmemb, size_t size)
 
 void host_free(void* ptr)
 {
-    free(ptr);
-    free_ptr_use(ptr);
+    size_t pinned = free_ptr_use(ptr);
+    if(pinned)
+        host_pinned_free(ptr, pinned);
+    else
+        free(ptr);
 }
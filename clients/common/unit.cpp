@@ -144,6 +144,12 @@ void unit_check_general(
 #endif
 }
 
+template <>
+void unit_check_general(int64_t M, int64_t N, int64_t lda, int8_t* hCPU, int8_t* hGPU)
+{
+    UNIT_CHECK(M, N, 1, lda, 0, hCPU, hGPU, ASSERT_EQ);
+}
+
 template <>
 void unit_check_general(int64_t M, int64_t N, int64_t lda, int* hCPU, int* hGPU)
 {
@@ -28,12 +28,19 @@
 #include <random>
 #endif
 
+#include "device_alloc.hpp"
 #include "hipblas.h"
+#include "hipblas_counters.hpp"
+#include "hipblas_telemetry.hpp"
 #include "hipblas_test.hpp"
 #include "utility.h"
+#include <algorithm>
 #include <chrono>
+#include <condition_variable>
 #include <cstdlib>
 #include <cstring>
+#include <map>
+#include <mutex>
 #include <stdexcept>
 #include <stdlib.h>
 
@@ -65,6 +72,8 @@ void d_vector_set_pad_length(size_t pad)
 hipblas_rng_t hipblas_rng(69069);
 hipblas_rng_t hipblas_seed(hipblas_rng);
 
+thread_local uint64_t hipblas_counter_seed = 0;
+
 int64_t c_i32_overflow = int64_t(std::numeric_limits<int32_t>::max()) + 1; // 2147483648
 
 template <>
@@ -188,6 +197,14 @@ std::string hipblas_tempname()
  * local handles *
  *****************/
 
+static thread_local hipStream_t     thread_stream  = nullptr;
+static thread_local hipblasHandle_t current_handle = nullptr;
+
+void hipblas_set_thread_stream(hipStream_t stream)
+{
+    thread_stream = stream;
+}
+
 hipblasLocalHandle::hipblasLocalHandle()
 {
     auto status = hipblasCreate(&m_handle);
@@ -205,6 +222,9 @@ hipblasLocalHandle::hipblasLocalHandle(const Arguments& arg)
 
     if(mode != hipblasAtomicsMode_t(arg.atomics_mode))
         status = hipblasSetAtomicsMode(m_handle, hipblasAtomicsMode_t(arg.atomics_mode));
+    auto reproducibility_mode = hipblasReproducibilityMode_t(arg.reproducibility_mode);
+    if(status == HIPBLAS_STATUS_SUCCESS && reproducibility_mode != HIPBLAS_REPRODUCIBILITY_DEFAULT)
+        status = hipblasSetReproducibilityMode(m_handle, reproducibility_mode);
     if(status == HIPBLAS_STATUS_SUCCESS)
     {
         /*
@@ -222,12 +242,49 @@ hipblasLocalHandle::hipblasLocalHandle(const Arguments& arg)
         throw std::runtime_error(hipblasStatusToString(status));
     }
 
+    // hipblas-bench --device_memory_limit emulates a device with less memory
+    if(arg.device_memory_limit > 0)
+    {
+        status = hipblasSetWorkspaceLimit(m_handle, size_t(arg.device_memory_limit * 1e9));
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            throw std::runtime_error(hipblasStatusToString(status));
+    }
+
     // memory guard control, with multi-threading should not change values across threads
     d_vector_set_pad_length(arg.pad);
+
+    // hipblas-bench --graph checks that the calls are capture safe
+    if(arg.graph)
+    {
+        status = hipblasSetGraphCaptureMode(m_handle, HIPBLAS_GRAPH_CAPTURE_SAFE);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            throw std::runtime_error(hipblasStatusToString(status));
+    }
+
+    // the handles of hipblas-bench --threads don't share the null stream
+    if(arg.own_stream)
+    {
+        hipStream_t stream = thread_stream;
+        if(!stream)
+        {
+            auto hipStatus = hipStreamCreateWithFlags(&m_stream, hipStreamNonBlocking);
+            if(hipStatus != hipSuccess)
+                throw std::runtime_error(hipGetErrorString(hipStatus));
+            stream = m_stream;
+        }
+        status = hipblasSetStream(m_handle, stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            throw std::runtime_error(hipblasStatusToString(status));
+    }
+
+    current_handle = m_handle;
 }
 
 hipblasLocalHandle::~hipblasLocalHandle()
 {
+    if(current_handle == m_handle)
+        current_handle = nullptr;
+
     if(m_memory)
     {
         // m_memory never used currently
@@ -246,6 +303,545 @@ hipblasLocalHandle::~hipblasLocalHandle()
         EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
 #endif
     }
+    if(m_stream)
+        (void)hipStreamDestroy(m_stream);
+}
+
+hipblasHandle_t hipblasLocalHandle::current()
+{
+    return current_handle;
+}
+
+/*************************
+ * benchmark loop timers *
+ ************************/
+
+static double host_time_us()
+{
+    auto now = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(now.time_since_epoch()).count();
+}
+
+static thread_local std::vector<double>      last_iteration_times;
+static thread_local hipblas_memory_footprint last_footprint;
+
+static void check_bench_error(hipError_t status)
+{
+    if(status != hipSuccess)
+        throw std::runtime_error(hipGetErrorString(status));
+}
+
+hipblas_iteration_timer::hipblas_iteration_timer(const Arguments& arg, hipStream_t stream)
+    : m_mode(arg.timing_mode)
+    , m_cold_iters(arg.cold_iters)
+    , m_iters(arg.iters)
+    , m_graph(arg.graph)
+    , m_each_iteration(arg.report_percentiles || arg.flush_cache || arg.timing_mode != TIMING_SYNC)
+    , m_stream(stream)
+    , m_memory(arg.memory_footprint)
+    , m_handle(arg.memory_footprint ? hipblasLocalHandle::current() : nullptr)
+{
+    int iters = std::max(arg.iters, 0);
+    m_iteration_us.reserve(iters);
+    if(m_mode == TIMING_EVENTS && !m_graph)
+    {
+        m_events.resize(2 * size_t(iters));
+        for(auto& event : m_events)
+            check_bench_error(hipEventCreate(&event));
+    }
+
+    if(arg.flush_cache && !m_graph)
+    {
+        // the L2 cache size doesn't count the infinity cache of the devices that have one, so the
+        // buffer is at least 512 MiB
+        int device, l2_bytes = 0;
+        check_bench_error(hipGetDevice(&device));
+        check_bench_error(hipDeviceGetAttribute(&l2_bytes, hipDeviceAttributeL2CacheSize, device));
+        m_flush_bytes = std::max(size_t(l2_bytes) * 4, size_t(512) << 20);
+        check_bench_error(hipMalloc(&m_flush, m_flush_bytes));
+    }
+
+    if(arg.telemetry || arg.memory_footprint || hipblas_counters::selected())
+        check_bench_error(hipGetDevice(&m_device));
+    if(arg.telemetry)
+        m_telemetry = std::make_unique<hipblas_telemetry>();
+    if(hipblas_counters::selected())
+        m_counters = std::make_unique<hipblas_counters>();
+}
+
+hipblas_iteration_timer::~hipblas_iteration_timer()
+{
+    for(auto event : m_events)
+        (void)hipEventDestroy(event);
+    if(m_flush)
+        (void)hipFree(m_flush);
+    if(m_graph_exec)
+        (void)hipGraphExecDestroy(m_graph_exec);
+
+    size_t bytes;
+    if(m_querying)
+        (void)hipblasStopWorkspaceQuery(m_handle, &bytes);
+}
+
+void hipblas_iteration_timer::memory_begin()
+{
+    size_t total;
+    m_footprint               = {};
+    m_footprint.operand_bytes = device_pool_bytes_in_use(m_device);
+    if(hipMemGetInfo(&m_free_start, &total) != hipSuccess)
+        m_free_start = 0;
+    m_free_min = m_free_start;
+
+    // the first cold call only reports the workspace it needs
+    m_querying = m_handle && m_cold_iters > 0
+                 && hipblasStartWorkspaceQuery(m_handle) == HIPBLAS_STATUS_SUCCESS;
+}
+
+void hipblas_iteration_timer::memory_sample(int iter)
+{
+    size_t bytes, total;
+    if(m_querying && iter == 0)
+    {
+        m_querying = false;
+        if(hipblasStopWorkspaceQuery(m_handle, &bytes) == HIPBLAS_STATUS_SUCCESS)
+            m_footprint.workspace_bytes = bytes;
+    }
+
+    // the library allocates on the host thread of the calls, so the memory is taken once they
+    // return
+    if(m_free_start && hipMemGetInfo(&bytes, &total) == hipSuccess)
+        m_free_min = std::min(m_free_min, bytes);
+}
+
+void hipblas_iteration_timer::start(int iter)
+{
+    if(m_memory && iter == 0)
+        memory_begin();
+    if(iter < m_cold_iters)
+        return;
+    int hot = iter - m_cold_iters;
+    if(m_graph)
+    {
+        if(!hot)
+            check_bench_error(hipStreamBeginCapture(m_stream, hipStreamCaptureModeThreadLocal));
+        return;
+    }
+    if(!hot)
+    {
+        hipblas_bench_window::arrive(m_stream);
+        if(m_telemetry)
+            m_telemetry->start(m_device);
+        if(m_counters)
+            m_counters->start(m_device);
+    }
+    if(m_flush)
+    {
+        check_bench_error(hipMemsetAsync(m_flush, hot & 0xff, m_flush_bytes, m_stream));
+        if(m_mode == TIMING_HOST)
+            (void)hipStreamSynchronize(m_stream);
+    }
+    switch(m_mode)
+    {
+    case TIMING_EVENTS:
+        check_bench_error(hipEventRecord(m_events[2 * hot], m_stream));
+        break;
+    case TIMING_HOST:
+        // the cold iterations must not be queued ahead of the first timed call
+        if(!hot)
+            (void)hipStreamSynchronize(m_stream);
+        m_start_us = host_time_us();
+        break;
+    default:
+        if(!hot || m_each_iteration)
+            m_start_us = get_time_us_sync(m_stream);
+        break;
+    }
+}
+
+void hipblas_iteration_timer::stop(int iter)
+{
+    if(m_memory && iter < m_cold_iters)
+        memory_sample(iter);
+    if(iter < m_cold_iters)
+        return;
+    int hot = iter - m_cold_iters;
+    if(m_graph)
+    {
+        if(hot == m_iters - 1)
+        {
+            hipGraph_t graph;
+            hipError_t status = hipStreamEndCapture(m_stream, &graph);
+            if(status != hipSuccess)
+                throw std::runtime_error(std::string("the calls can't be captured in a graph: ")
+                                         + hipGetErrorString(status));
+            status = hipGraphInstantiate(&m_graph_exec, graph, nullptr, nullptr, 0);
+            (void)hipGraphDestroy(graph);
+            check_bench_error(status);
+        }
+        return;
+    }
+    switch(m_mode)
+    {
+    case TIMING_EVENTS:
+        check_bench_error(hipEventRecord(m_events[2 * hot + 1], m_stream));
+        break;
+    case TIMING_HOST:
+        m_iteration_us.push_back(host_time_us() - m_start_us);
+        break;
+    default:
+        if(m_each_iteration)
+            m_iteration_us.push_back(get_time_us_sync(m_stream) - m_start_us);
+        break;
+    }
+}
+
+double hipblas_iteration_timer::elapsed_us()
+{
+    if(m_memory)
+    {
+        memory_sample(-1);
+        m_footprint.growth_bytes = m_free_start ? int64_t(m_free_start - m_free_min) : -1;
+        last_footprint           = m_footprint;
+    }
+
+    if(m_graph)
+    {
+        last_iteration_times.clear();
+        if(!m_graph_exec)
+            return 0;
+
+        // the first launch uploads the graph, and isn't timed
+        check_bench_error(hipGraphLaunch(m_graph_exec, m_stream));
+        hipblas_bench_window::arrive(m_stream);
+
+        constexpr int replays = 10;
+        hipEvent_t    start, stop;
+        check_bench_error(hipEventCreate(&start));
+        check_bench_error(hipEventCreate(&stop));
+        check_bench_error(hipEventRecord(start, m_stream));
+        if(m_telemetry)
+            m_telemetry->start(m_device);
+        if(m_counters)
+            m_counters->start(m_device);
+        for(int r = 0; r < replays; r++)
+            check_bench_error(hipGraphLaunch(m_graph_exec, m_stream));
+        check_bench_error(hipEventRecord(stop, m_stream));
+        hipblas_bench_window::finish(m_stream);
+        if(m_telemetry || m_counters)
+            (void)hipEventSynchronize(stop);
+        if(m_telemetry)
+            m_telemetry->stop();
+        if(m_counters)
+            m_counters->stop(replays);
+
+        float ms = 0;
+        check_bench_error(hipEventElapsedTime(&ms, start, stop));
+        (void)hipEventDestroy(start);
+        (void)hipEventDestroy(stop);
+        return ms * 1000.0 / replays;
+    }
+
+    hipblas_bench_window::finish(m_stream);
+
+    if(!m_each_iteration)
+    {
+        last_iteration_times.clear();
+        double total_us = get_time_us_sync(m_stream) - m_start_us;
+        if(m_telemetry)
+            m_telemetry->stop();
+        if(m_counters)
+            m_counters->stop(m_iters);
+        return total_us;
+    }
+
+    if(m_mode == TIMING_EVENTS)
+    {
+        (void)hipStreamSynchronize(m_stream);
+        m_iteration_us.clear();
+        for(size_t i = 0; i < m_events.size(); i += 2)
+        {
+            float ms = 0;
+            check_bench_error(hipEventElapsedTime(&ms, m_events[i], m_events[i + 1]));
+            m_iteration_us.push_back(ms * 1000.0);
+        }
+    }
+    else if(m_mode == TIMING_HOST)
+    {
+        // the calls of host timing are still queued
+        (void)hipStreamSynchronize(m_stream);
+    }
+
+    if(m_telemetry)
+        m_telemetry->stop();
+    if(m_counters)
+        m_counters->stop(m_iters);
+
+    double total_us = 0;
+    for(double us : m_iteration_us)
+        total_us += us;
+    last_iteration_times = m_iteration_us;
+    return total_us;
+}
+
+const std::vector<double>& hipblas_iteration_timer::last_iteration_us()
+{
+    return last_iteration_times;
+}
+
+const hipblas_memory_footprint& hipblas_iteration_timer::last_memory_footprint()
+{
+    return last_footprint;
+}
+
+namespace
+{
+    struct bench_window_state
+    {
+        std::mutex              mutex;
+        std::condition_variable released;
+        bool                    open     = false;
+        int                     parties  = 0;
+        int                     arrived  = 0;
+        double                  start_us = 0;
+        double                  end_us   = 0;
+    } bench_window;
+
+    // 0 before the first timing loop of the party, 1 in it and 2 after it or after leaving
+    thread_local int bench_window_stage = 0;
+}
+
+void hipblas_bench_window::open(int parties)
+{
+    std::lock_guard<std::mutex> lock(bench_window.mutex);
+    bench_window.open     = true;
+    bench_window.parties  = parties;
+    bench_window.arrived  = 0;
+    bench_window.start_us = 0;
+    bench_window.end_us   = 0;
+}
+
+double hipblas_bench_window::close()
+{
+    std::lock_guard<std::mutex> lock(bench_window.mutex);
+    bench_window.open = false;
+    return bench_window.end_us > bench_window.start_us ? bench_window.end_us - bench_window.start_us
+                                                       : 0;
+}
+
+void hipblas_bench_window::arrive(hipStream_t stream)
+{
+    if(bench_window_stage)
+        return;
+
+    // the cold iterations don't spill into the window
+    (void)hipStreamSynchronize(stream);
+
+    std::unique_lock<std::mutex> lock(bench_window.mutex);
+    if(!bench_window.open)
+        return;
+    bench_window_stage = 1;
+    if(++bench_window.arrived >= bench_window.parties)
+    {
+        bench_window.start_us = host_time_us();
+        bench_window.released.notify_all();
+    }
+    else
+        bench_window.released.wait(lock,
+                                   [] { return bench_window.arrived >= bench_window.parties; });
+}
+
+void hipblas_bench_window::finish(hipStream_t stream)
+{
+    if(bench_window_stage != 1)
+        return;
+    bench_window_stage = 2;
+
+    (void)hipStreamSynchronize(stream);
+    double end_us = host_time_us();
+
+    std::lock_guard<std::mutex> lock(bench_window.mutex);
+    bench_window.end_us = std::max(bench_window.end_us, end_us);
+}
+
+void hipblas_bench_window::leave()
+{
+    int stage          = bench_window_stage;
+    bench_window_stage = 0;
+    if(stage)
+        return;
+
+    std::lock_guard<std::mutex> lock(bench_window.mutex);
+    if(!bench_window.open)
+        return;
+    if(--bench_window.parties == bench_window.arrived && bench_window.arrived)
+    {
+        bench_window.start_us = host_time_us();
+        bench_window.released.notify_all();
+    }
+}
+
+void hipblas_rotating_buffers::allocate(const Arguments& arg)
+{
+    size_t bytes = 0;
+    for(auto& op : m_operands)
+    {
+        op.offset = bytes;
+        bytes += (op.bytes + 255) / 256 * 256;
+    }
+    if(arg.rotating <= 0 || !bytes)
+        return;
+
+    size_t copies = ((size_t(arg.rotating) << 20) + bytes - 1) / bytes;
+    for(size_t c = 1; c < copies; c++)
+    {
+        char* copy;
+        check_bench_error(hipMalloc(&copy, bytes));
+        m_copies.push_back(copy);
+        for(auto& op : m_operands)
+            check_bench_error(
+                hipMemcpy(copy + op.offset, op.data, op.bytes, hipMemcpyDeviceToDevice));
+    }
+}
+
+hipblas_rotating_buffers::~hipblas_rotating_buffers()
+{
+    for(auto copy : m_copies)
+        (void)hipFree(copy);
+}
+
+void* hipblas_rotating_buffers::copy_of(const void* data, int iter) const
+{
+    size_t c = iter % (m_copies.size() + 1);
+    if(!c)
+        return const_cast<void*>(data);
+    for(auto& op : m_operands)
+        if(op.data == data)
+            return m_copies[c - 1] + op.offset;
+    throw std::invalid_argument("operand isn't one of the rotating buffers");
+}
+
+namespace
+{
+    // dense flops per clock per compute unit of fp64, fp32, fp16, bf16 and int8, with the matrix
+    // cores of the architectures that have them
+    struct arch_rate
+    {
+        const char* arch;
+        double      fp64, fp32, fp16, bf16, int8;
+    };
+
+    constexpr arch_rate arch_rates[] = {
+        {"gfx906", 64, 128, 256, 0, 512},
+        {"gfx908", 64, 256, 1024, 512, 1024},
+        {"gfx90a", 256, 256, 1024, 1024, 1024},
+        {"gfx940", 256, 256, 2048, 2048, 4096},
+        {"gfx941", 256, 256, 2048, 2048, 4096},
+        {"gfx942", 256, 256, 2048, 2048, 4096},
+        {"gfx950", 128, 256, 4096, 4096, 8192},
+        {"gfx1030", 8, 128, 256, 0, 512},
+        {"gfx1100", 4, 256, 512, 512, 512},
+        {"gfx1101", 4, 256, 512, 512, 512},
+        {"gfx1102", 4, 256, 512, 512, 512},
+        {"sm_80", 128, 128, 2048, 2048, 4096},
+        {"sm_90", 256, 256, 4096, 4096, 8192},
+    };
+
+    double measure_copy_GBps(const hipDeviceProp_t& props)
+    {
+        size_t bytes = std::min(size_t(256) << 20, props.totalGlobalMem / 16);
+        int    reps  = 20;
+
+        void*       src;
+        void*       dst;
+        hipStream_t stream;
+        hipEvent_t  start, stop;
+        check_bench_error(hipMalloc(&src, bytes));
+        check_bench_error(hipMalloc(&dst, bytes));
+        check_bench_error(hipStreamCreate(&stream));
+        check_bench_error(hipEventCreate(&start));
+        check_bench_error(hipEventCreate(&stop));
+
+        check_bench_error(hipMemsetAsync(src, 0, bytes, stream));
+        check_bench_error(hipMemcpyAsync(dst, src, bytes, hipMemcpyDeviceToDevice, stream));
+        check_bench_error(hipEventRecord(start, stream));
+        for(int i = 0; i < reps; i++)
+            check_bench_error(hipMemcpyAsync(dst, src, bytes, hipMemcpyDeviceToDevice, stream));
+        check_bench_error(hipEventRecord(stop, stream));
+        check_bench_error(hipEventSynchronize(stop));
+
+        float ms = 0;
+        check_bench_error(hipEventElapsedTime(&ms, start, stop));
+
+        (void)hipEventDestroy(start);
+        (void)hipEventDestroy(stop);
+        (void)hipStreamDestroy(stream);
+        (void)hipFree(src);
+        (void)hipFree(dst);
+
+        // each copy reads and writes bytes
+        return ms > 0 ? 2.0 * bytes * reps / (ms * 1e6) : 0;
+    }
+}
+
+double hipblas_device_roofline::peak_gflops(hipblasDatatype_t a_type) const
+{
+    switch(a_type)
+    {
+    case HIPBLAS_R_64F:
+    case HIPBLAS_C_64F:
+        return fp64_gflops;
+    case HIPBLAS_R_32F:
+    case HIPBLAS_C_32F:
+        return fp32_gflops;
+    case HIPBLAS_R_16F:
+        return fp16_gflops;
+    case HIPBLAS_R_16B:
+        return bf16_gflops;
+    case HIPBLAS_R_8I:
+        return int8_gops;
+    default:
+        return 0;
+    }
+}
+
+const hipblas_device_roofline& hipblas_device_roofline::current()
+{
+    static std::mutex                             mutex;
+    static std::map<int, hipblas_device_roofline> rooflines;
+
+    int device;
+    check_bench_error(hipGetDevice(&device));
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto                        found = rooflines.find(device);
+    if(found != rooflines.end())
+        return found->second;
+
+    hipDeviceProp_t props;
+    check_bench_error(hipGetDeviceProperties(&props, device));
+
+    hipblas_device_roofline roofline;
+    std::string             name(props.gcnArchName);
+    roofline.arch = name.substr(0, name.find(":"));
+    if(roofline.arch.empty())
+        roofline.arch = "sm_" + std::to_string(props.major) + std::to_string(props.minor);
+
+    // clockRate is the peak clock in kHz
+    double cu_ghz = props.multiProcessorCount * (props.clockRate * 1e-6);
+    for(auto& rate : arch_rates)
+    {
+        if(roofline.arch == rate.arch)
+        {
+            roofline.fp64_gflops = rate.fp64 * cu_ghz;
+            roofline.fp32_gflops = rate.fp32 * cu_ghz;
+            roofline.fp16_gflops = rate.fp16 * cu_ghz;
+            roofline.bf16_gflops = rate.bf16 * cu_ghz;
+            roofline.int8_gops   = rate.int8 * cu_ghz;
+        }
+    }
+    roofline.GBps = measure_copy_GBps(props);
+
+    return rooflines.emplace(device, roofline).first->second;
 }
 
 /*******************************************************************************
@@ -36,4 +36,14 @@ namespace
                          hipblasStatusToString(HIPBLAS_STATUS_ALLOC_FAILED)));
     }
 
+    TEST(hipblas_auxiliary, backendVersionString)
+    {
+        char version[128];
+        EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasGetBackendVersionString(version, sizeof(version)));
+        EXPECT_TRUE(!strncmp(version, "rocBLAS ", 8) || !strncmp(version, "cuBLAS ", 7));
+
+        EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, hipblasGetBackendVersionString(version, 4));
+        EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, hipblasGetBackendVersionString(nullptr, 128));
+    }
+
 } // namespace
@@ -20,9 +20,35 @@
  *
  * ************************************************************************ */
 
+#include "auxil/testing_handle_pool.hpp"
+#include "auxil/testing_compute_partition.hpp"
+#include "auxil/testing_concurrent_group.hpp"
+#include "auxil/testing_deferred_batch.hpp"
+#include "auxil/testing_xt_gemm.hpp"
+#include "auxil/testing_dist_gemm.hpp"
+#include "auxil/testing_graph_region.hpp"
+#include "auxil/testing_optimal_leading_dimension.hpp"
+#include "auxil/testing_persistent_gemv.hpp"
+#include "auxil/testing_rank1_accumulator.hpp"
+#include "auxil/testing_stream_priority.hpp"
+#include "auxil/testing_set_get_matrix_ex.hpp"
+#include "auxil/testing_copy_matrix_peer.hpp"
 #include "auxil/testing_set_get_atomics_mode.hpp"
+#include "auxil/testing_set_get_batch_layout.hpp"
+#include "auxil/testing_set_get_shape_dispatch.hpp"
+#include "auxil/testing_set_get_graph_capture_mode.hpp"
+#include "auxil/testing_set_get_host_dispatch_mode.hpp"
+#include "auxil/testing_set_get_gemm_backend.hpp"
+#include "auxil/testing_set_get_managed_prefetch_mode.hpp"
+#include "auxil/testing_set_get_info_mode.hpp"
 #include "auxil/testing_set_get_math_mode.hpp"
 #include "auxil/testing_set_get_pointer_mode.hpp"
+#include "auxil/testing_set_get_reproducibility_mode.hpp"
+#include "auxil/testing_set_get_rounding_mode.hpp"
+#include "auxil/testing_set_get_statistics_mode.hpp"
+#include "auxil/testing_set_get_workspace.hpp"
+#include "auxil/testing_warmup.hpp"
+#include "auxil/testing_workspace_query.hpp"
 #include "hipblas_data.hpp"
 #include "hipblas_test.hpp"
 #include "type_dispatch.hpp"
@@ -35,6 +61,32 @@ namespace
         SG_POINTER,
         SG_ATOMICS,
         SG_MATH,
+        SG_WORKSPACE,
+        WORKSPACE_QUERY,
+        SG_GRAPH_CAPTURE,
+        SG_INFO,
+        SG_REPRODUCIBILITY,
+        SG_HOST_DISPATCH,
+        SG_MANAGED_PREFETCH,
+        SG_GEMM_BACKEND,
+        SG_BATCH_LAYOUT,
+        SG_SHAPE_DISPATCH,
+        SG_ROUNDING,
+        SG_STATISTICS,
+        HANDLE_POOL,
+        CONCURRENT_GROUP,
+        DEFERRED_BATCH,
+        GRAPH_REGION,
+        RANK1_ACCUMULATOR,
+        PERSISTENT_GEMV,
+        STREAM_PRIORITY,
+        XT_GEMM,
+        DIST_GEMM,
+        SG_MATRIX_EX,
+        COPY_MATRIX_PEER,
+        WARMUP,
+        COMPUTE_PARTITION,
+        OPTIMAL_LD,
     };
 
     // aux test template
@@ -72,6 +124,58 @@ namespace
                 return !strcmp(arg.function, "set_get_atomics_mode");
             case SG_MATH:
                 return !strcmp(arg.function, "set_get_math_mode");
+            case SG_WORKSPACE:
+                return !strcmp(arg.function, "set_get_workspace");
+            case WORKSPACE_QUERY:
+                return !strcmp(arg.function, "workspace_query");
+            case SG_GRAPH_CAPTURE:
+                return !strcmp(arg.function, "set_get_graph_capture_mode");
+            case SG_INFO:
+                return !strcmp(arg.function, "set_get_info_mode");
+            case SG_REPRODUCIBILITY:
+                return !strcmp(arg.function, "set_get_reproducibility_mode");
+            case SG_HOST_DISPATCH:
+                return !strcmp(arg.function, "set_get_host_dispatch_mode");
+            case SG_MANAGED_PREFETCH:
+                return !strcmp(arg.function, "set_get_managed_prefetch_mode");
+            case SG_GEMM_BACKEND:
+                return !strcmp(arg.function, "set_get_gemm_backend");
+            case SG_BATCH_LAYOUT:
+                return !strcmp(arg.function, "set_get_batch_layout");
+            case SG_SHAPE_DISPATCH:
+                return !strcmp(arg.function, "set_get_shape_dispatch_mode");
+            case SG_ROUNDING:
+                return !strcmp(arg.function, "set_get_rounding_mode");
+            case SG_STATISTICS:
+                return !strcmp(arg.function, "set_get_statistics_mode");
+            case HANDLE_POOL:
+                return !strcmp(arg.function, "handle_pool");
+            case CONCURRENT_GROUP:
+                return !strcmp(arg.function, "concurrent_group");
+            case DEFERRED_BATCH:
+                return !strcmp(arg.function, "deferred_batch");
+            case GRAPH_REGION:
+                return !strcmp(arg.function, "graph_region");
+            case RANK1_ACCUMULATOR:
+                return !strcmp(arg.function, "rank1_accumulator");
+            case PERSISTENT_GEMV:
+                return !strcmp(arg.function, "persistent_gemv");
+            case STREAM_PRIORITY:
+                return !strcmp(arg.function, "stream_priority");
+            case XT_GEMM:
+                return !strcmp(arg.function, "xt_gemm");
+            case DIST_GEMM:
+                return !strcmp(arg.function, "dist_gemm");
+            case SG_MATRIX_EX:
+                return !strcmp(arg.function, "set_get_matrix_ex");
+            case COPY_MATRIX_PEER:
+                return !strcmp(arg.function, "copy_matrix_peer");
+            case WARMUP:
+                return !strcmp(arg.function, "warmup");
+            case COMPUTE_PARTITION:
+                return !strcmp(arg.function, "compute_partition");
+            case OPTIMAL_LD:
+                return !strcmp(arg.function, "optimal_leading_dimension");
             }
             return false;
         }
@@ -86,6 +190,58 @@ namespace
                 testname_set_get_atomics_mode(arg, name);
             else if constexpr(AUX_TYPE == SG_MATH)
                 testname_set_get_math_mode(arg, name);
+            else if constexpr(AUX_TYPE == SG_WORKSPACE)
+                testname_set_get_workspace(arg, name);
+            else if constexpr(AUX_TYPE == WORKSPACE_QUERY)
+                testname_workspace_query(arg, name);
+            else if constexpr(AUX_TYPE == SG_GRAPH_CAPTURE)
+                testname_set_get_graph_capture_mode(arg, name);
+            else if constexpr(AUX_TYPE == SG_INFO)
+                testname_set_get_info_mode(arg, name);
+            else if constexpr(AUX_TYPE == SG_REPRODUCIBILITY)
+                testname_set_get_reproducibility_mode(arg, name);
+            else if constexpr(AUX_TYPE == SG_HOST_DISPATCH)
+                testname_set_get_host_dispatch_mode(arg, name);
+            else if constexpr(AUX_TYPE == SG_MANAGED_PREFETCH)
+                testname_set_get_managed_prefetch_mode(arg, name);
+            else if constexpr(AUX_TYPE == SG_GEMM_BACKEND)
+                testname_set_get_gemm_backend(arg, name);
+            else if constexpr(AUX_TYPE == SG_BATCH_LAYOUT)
+                testname_set_get_batch_layout(arg, name);
+            else if constexpr(AUX_TYPE == SG_SHAPE_DISPATCH)
+                testname_set_get_shape_dispatch_mode(arg, name);
+            else if constexpr(AUX_TYPE == SG_ROUNDING)
+                testname_set_get_rounding_mode(arg, name);
+            else if constexpr(AUX_TYPE == SG_STATISTICS)
+                testname_set_get_statistics_mode(arg, name);
+            else if constexpr(AUX_TYPE == HANDLE_POOL)
+                testname_handle_pool(arg, name);
+            else if constexpr(AUX_TYPE == CONCURRENT_GROUP)
+                testname_concurrent_group(arg, name);
+            else if constexpr(AUX_TYPE == DEFERRED_BATCH)
+                testname_deferred_batch(arg, name);
+            else if constexpr(AUX_TYPE == GRAPH_REGION)
+                testname_graph_region(arg, name);
+            else if constexpr(AUX_TYPE == RANK1_ACCUMULATOR)
+                testname_rank1_accumulator(arg, name);
+            else if constexpr(AUX_TYPE == PERSISTENT_GEMV)
+                testname_persistent_gemv(arg, name);
+            else if constexpr(AUX_TYPE == STREAM_PRIORITY)
+                testname_stream_priority(arg, name);
+            else if constexpr(AUX_TYPE == XT_GEMM)
+                testname_xt_gemm(arg, name);
+            else if constexpr(AUX_TYPE == DIST_GEMM)
+                testname_dist_gemm(arg, name);
+            else if constexpr(AUX_TYPE == SG_MATRIX_EX)
+                testname_set_get_matrix_ex(arg, name);
+            else if constexpr(AUX_TYPE == COPY_MATRIX_PEER)
+                testname_copy_matrix_peer(arg, name);
+            else if constexpr(AUX_TYPE == WARMUP)
+                testname_warmup(arg, name);
+            else if constexpr(AUX_TYPE == COMPUTE_PARTITION)
+                testname_compute_partition(arg, name);
+            else if constexpr(AUX_TYPE == OPTIMAL_LD)
+                testname_optimal_leading_dimension(arg, name);
 
             return std::move(name);
         }
@@ -102,6 +258,58 @@ namespace
                 testing_set_get_atomics_mode(arg);
             else if(!strcmp(arg.function, "set_get_math_mode"))
                 testing_set_get_math_mode(arg);
+            else if(!strcmp(arg.function, "set_get_workspace"))
+                testing_set_get_workspace(arg);
+            else if(!strcmp(arg.function, "workspace_query"))
+                testing_workspace_query(arg);
+            else if(!strcmp(arg.function, "set_get_graph_capture_mode"))
+                testing_set_get_graph_capture_mode(arg);
+            else if(!strcmp(arg.function, "set_get_info_mode"))
+                testing_set_get_info_mode(arg);
+            else if(!strcmp(arg.function, "set_get_reproducibility_mode"))
+                testing_set_get_reproducibility_mode(arg);
+            else if(!strcmp(arg.function, "set_get_host_dispatch_mode"))
+                testing_set_get_host_dispatch_mode(arg);
+            else if(!strcmp(arg.function, "set_get_managed_prefetch_mode"))
+                testing_set_get_managed_prefetch_mode(arg);
+            else if(!strcmp(arg.function, "set_get_gemm_backend"))
+                testing_set_get_gemm_backend(arg);
+            else if(!strcmp(arg.function, "set_get_batch_layout"))
+                testing_set_get_batch_layout(arg);
+            else if(!strcmp(arg.function, "set_get_shape_dispatch_mode"))
+                testing_set_get_shape_dispatch_mode(arg);
+            else if(!strcmp(arg.function, "set_get_rounding_mode"))
+                testing_set_get_rounding_mode(arg);
+            else if(!strcmp(arg.function, "set_get_statistics_mode"))
+                testing_set_get_statistics_mode(arg);
+            else if(!strcmp(arg.function, "handle_pool"))
+                testing_handle_pool(arg);
+            else if(!strcmp(arg.function, "concurrent_group"))
+                testing_concurrent_group(arg);
+            else if(!strcmp(arg.function, "deferred_batch"))
+                testing_deferred_batch(arg);
+            else if(!strcmp(arg.function, "graph_region"))
+                testing_graph_region(arg);
+            else if(!strcmp(arg.function, "rank1_accumulator"))
+                testing_rank1_accumulator(arg);
+            else if(!strcmp(arg.function, "persistent_gemv"))
+                testing_persistent_gemv(arg);
+            else if(!strcmp(arg.function, "stream_priority"))
+                testing_stream_priority(arg);
+            else if(!strcmp(arg.function, "xt_gemm"))
+                testing_xt_gemm(arg);
+            else if(!strcmp(arg.function, "dist_gemm"))
+                testing_dist_gemm(arg);
+            else if(!strcmp(arg.function, "set_get_matrix_ex"))
+                testing_set_get_matrix_ex(arg);
+            else if(!strcmp(arg.function, "copy_matrix_peer"))
+                testing_copy_matrix_peer(arg);
+            else if(!strcmp(arg.function, "warmup"))
+                testing_warmup(arg);
+            else if(!strcmp(arg.function, "compute_partition"))
+                testing_compute_partition(arg);
+            else if(!strcmp(arg.function, "optimal_leading_dimension"))
+                testing_optimal_leading_dimension(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -128,4 +336,186 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(set_get_math);
 
+    using set_get_workspace = aux_mode_template<aux_mode_testing, SG_WORKSPACE>;
+    TEST_P(set_get_workspace, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(set_get_workspace);
+
+    using workspace_query = aux_mode_template<aux_mode_testing, WORKSPACE_QUERY>;
+    TEST_P(workspace_query, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(workspace_query);
+
+    using set_get_graph_capture = aux_mode_template<aux_mode_testing, SG_GRAPH_CAPTURE>;
+    TEST_P(set_get_graph_capture, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(set_get_graph_capture);
+
+    using set_get_info = aux_mode_template<aux_mode_testing, SG_INFO>;
+    TEST_P(set_get_info, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(set_get_info);
+
+    using set_get_reproducibility = aux_mode_template<aux_mode_testing, SG_REPRODUCIBILITY>;
+    TEST_P(set_get_reproducibility, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(set_get_reproducibility);
+
+    using set_get_host_dispatch = aux_mode_template<aux_mode_testing, SG_HOST_DISPATCH>;
+    TEST_P(set_get_host_dispatch, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(set_get_host_dispatch);
+
+    using set_get_managed_prefetch = aux_mode_template<aux_mode_testing, SG_MANAGED_PREFETCH>;
+    TEST_P(set_get_managed_prefetch, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(set_get_managed_prefetch);
+
+    using set_get_gemm_backend = aux_mode_template<aux_mode_testing, SG_GEMM_BACKEND>;
+    TEST_P(set_get_gemm_backend, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(set_get_gemm_backend);
+
+    using set_get_batch_layout = aux_mode_template<aux_mode_testing, SG_BATCH_LAYOUT>;
+    TEST_P(set_get_batch_layout, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(set_get_batch_layout);
+
+    using set_get_shape_dispatch = aux_mode_template<aux_mode_testing, SG_SHAPE_DISPATCH>;
+    TEST_P(set_get_shape_dispatch, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(set_get_shape_dispatch);
+
+    using set_get_rounding = aux_mode_template<aux_mode_testing, SG_ROUNDING>;
+    TEST_P(set_get_rounding, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(set_get_rounding);
+
+    using set_get_statistics = aux_mode_template<aux_mode_testing, SG_STATISTICS>;
+    TEST_P(set_get_statistics, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(set_get_statistics);
+
+    using handle_pool = aux_mode_template<aux_mode_testing, HANDLE_POOL>;
+    TEST_P(handle_pool, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(handle_pool);
+
+    using concurrent_group = aux_mode_template<aux_mode_testing, CONCURRENT_GROUP>;
+    TEST_P(concurrent_group, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(concurrent_group);
+
+    using deferred_batch = aux_mode_template<aux_mode_testing, DEFERRED_BATCH>;
+    TEST_P(deferred_batch, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(deferred_batch);
+
+    using graph_region = aux_mode_template<aux_mode_testing, GRAPH_REGION>;
+    TEST_P(graph_region, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(graph_region);
+
+    using rank1_accumulator = aux_mode_template<aux_mode_testing, RANK1_ACCUMULATOR>;
+    TEST_P(rank1_accumulator, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(rank1_accumulator);
+
+    using persistent_gemv = aux_mode_template<aux_mode_testing, PERSISTENT_GEMV>;
+    TEST_P(persistent_gemv, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(persistent_gemv);
+
+    using stream_priority = aux_mode_template<aux_mode_testing, STREAM_PRIORITY>;
+    TEST_P(stream_priority, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(stream_priority);
+
+    using xt_gemm = aux_mode_template<aux_mode_testing, XT_GEMM>;
+    TEST_P(xt_gemm, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(xt_gemm);
+
+    using dist_gemm = aux_mode_template<aux_mode_testing, DIST_GEMM>;
+    TEST_P(dist_gemm, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(dist_gemm);
+
+    using set_get_matrix_ex = aux_mode_template<aux_mode_testing, SG_MATRIX_EX>;
+    TEST_P(set_get_matrix_ex, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(set_get_matrix_ex);
+
+    using copy_matrix_peer = aux_mode_template<aux_mode_testing, COPY_MATRIX_PEER>;
+    TEST_P(copy_matrix_peer, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(copy_matrix_peer);
+
+    using warmup = aux_mode_template<aux_mode_testing, WARMUP>;
+    TEST_P(warmup, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(warmup);
+
+    using compute_partition = aux_mode_template<aux_mode_testing, COMPUTE_PARTITION>;
+    TEST_P(compute_partition, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(compute_partition);
+
+    using optimal_leading_dimension = aux_mode_template<aux_mode_testing, OPTIMAL_LD>;
+    TEST_P(optimal_leading_dimension, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(optimal_leading_dimension);
+
 } // namespace
@@ -23,6 +23,7 @@
 
 #include "blas1/testing_rot.hpp"
 #include "blas1/testing_rot_batched.hpp"
+#include "blas1/testing_rot_sequence.hpp"
 #include "blas1/testing_rot_strided_batched.hpp"
 #include "blas1/testing_rotg.hpp"
 #include "blas1/testing_rotg_batched.hpp"
@@ -96,6 +97,8 @@ namespace
                 testname_rotmg_batched(arg, name);
             else if constexpr(BLAS1 == blas1::rotmg_strided_batched)
                 testname_rotmg_strided_batched(arg, name);
+            else if constexpr(BLAS1 == blas1::rot_sequence)
+                testname_rot_sequence(arg, name);
             return std::move(name);
         }
     };
@@ -123,7 +126,7 @@ namespace
                          hipblasDoubleComplex> && std::is_same_v<To, double> && std::is_same_v<Tc, double>)))
 
                 || ((BLAS1 == blas1::rotg || BLAS1 == blas1::rotg_batched
-                     || BLAS1 == blas1::rotg_strided_batched)
+                     || BLAS1 == blas1::rotg_strided_batched || BLAS1 == blas1::rot_sequence)
                     && std::
                         is_same_v<
                             To,
@@ -200,5 +203,6 @@ namespace
     BLAS1_TESTING(rotmg, ARG1)
     BLAS1_TESTING(rotmg_batched, ARG1)
     BLAS1_TESTING(rotmg_strided_batched, ARG1)
+    BLAS1_TESTING(rot_sequence, ARG1)
 
 } // namespace
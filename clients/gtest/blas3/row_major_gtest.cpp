@@ -0,0 +1,134 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "blas3/testing_row_major.hpp"
+#include "hipblas_data.hpp"
+#include "hipblas_test.hpp"
+#include "type_dispatch.hpp"
+
+namespace
+{
+    // possible row-major test cases
+    enum row_major_test_type
+    {
+        ROW_MAJOR,
+    };
+
+    // row-major test template
+    template <template <typename...> class FILTER, row_major_test_type ROW_MAJOR_TYPE>
+    struct row_major_template : HipBLAS_Test<row_major_template<FILTER, ROW_MAJOR_TYPE>, FILTER>
+    {
+        template <typename... T>
+        struct type_filter_functor
+        {
+            bool operator()(const Arguments& args)
+            {
+                // additional global filters applied first
+                if(!hipblas_client_global_filters(args))
+                    return false;
+
+                // type filters
+                return static_cast<bool>(FILTER<T...>{});
+            }
+        };
+
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return hipblas_simple_dispatch<row_major_template::template type_filter_functor>(
+                arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(ROW_MAJOR_TYPE)
+            {
+            case ROW_MAJOR:
+                return !strncmp(arg.function, "row_major_", 10);
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            std::string name;
+            if constexpr(ROW_MAJOR_TYPE == ROW_MAJOR)
+                testname_row_major(arg, name);
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename, typename = void>
+    struct row_major_testing : hipblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    template <typename T>
+    struct row_major_testing<
+        T,
+        std::enable_if_t<
+            std::is_same_v<
+                T,
+                float> || std::is_same_v<T, double> || std::is_same_v<T, hipblasComplex> || std::is_same_v<T, hipblasDoubleComplex>>>
+        : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            using op = hipblas_row_major_op;
+            if(!strcmp(arg.function, "row_major_gemm"))
+                testing_row_major<op::gemm, T>(arg);
+            else if(!strcmp(arg.function, "row_major_symm"))
+                testing_row_major<op::symm, T>(arg);
+            else if(!strcmp(arg.function, "row_major_hemm"))
+                testing_row_major<op::hemm, T>(arg);
+            else if(!strcmp(arg.function, "row_major_trsm"))
+                testing_row_major<op::trsm, T>(arg);
+            else if(!strcmp(arg.function, "row_major_trmm"))
+                testing_row_major<op::trmm, T>(arg);
+            else if(!strcmp(arg.function, "row_major_syrk"))
+                testing_row_major<op::syrk, T>(arg);
+            else if(!strcmp(arg.function, "row_major_herk"))
+                testing_row_major<op::herk, T>(arg);
+            else if(!strcmp(arg.function, "row_major_syr2k"))
+                testing_row_major<op::syr2k, T>(arg);
+            else if(!strcmp(arg.function, "row_major_her2k"))
+                testing_row_major<op::her2k, T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using row_major = row_major_template<row_major_testing, ROW_MAJOR>;
+    TEST_P(row_major, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<row_major_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(row_major);
+
+} // namespace
@@ -22,6 +22,7 @@
 
 #include "blas3/testing_trsm.hpp"
 #include "blas3/testing_trsm_batched.hpp"
+#include "blas3/testing_trsm_interleaved.hpp"
 #include "blas3/testing_trsm_strided_batched.hpp"
 #include "hipblas_data.hpp"
 #include "hipblas_test.hpp"
@@ -35,6 +36,7 @@ namespace
         TRSM,
         TRSM_BATCHED,
         TRSM_STRIDED_BATCHED,
+        TRSM_INTERLEAVED,
     };
 
     // trsm test template
@@ -74,6 +76,8 @@ namespace
             case TRSM_STRIDED_BATCHED:
                 return !strcmp(arg.function, "trsm_strided_batched")
                        || !strcmp(arg.function, "trsm_strided_batched_bad_arg");
+            case TRSM_INTERLEAVED:
+                return !strcmp(arg.function, "trsm_interleaved");
             }
             return false;
         }
@@ -88,6 +92,8 @@ namespace
                 testname_trsm_batched(arg, name);
             else if constexpr(TRSM_TYPE == TRSM_STRIDED_BATCHED)
                 testname_trsm_strided_batched(arg, name);
+            else if constexpr(TRSM_TYPE == TRSM_INTERLEAVED)
+                testname_trsm_interleaved(arg, name);
             return std::move(name);
         }
     };
@@ -124,6 +130,8 @@ namespace
                 testing_trsm_strided_batched<T>(arg);
             else if(!strcmp(arg.function, "trsm_strided_batched_bad_arg"))
                 testing_trsm_strided_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "trsm_interleaved"))
+                testing_trsm_interleaved<T>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -150,4 +158,11 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(trsm_strided_batched);
 
+    using trsm_interleaved = trsm_template<trsm_testing, TRSM_INTERLEAVED>;
+    TEST_P(trsm_interleaved, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(hipblas_simple_dispatch<trsm_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(trsm_interleaved);
+
 } // namespace
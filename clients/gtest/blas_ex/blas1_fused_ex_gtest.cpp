@@ -0,0 +1,336 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "blas_ex/testing_axpy_dot_ex.hpp"
+#include "blas_ex/testing_axpy_dot_strided_batched_ex.hpp"
+#include "blas_ex/testing_iamax_with_value_ex.hpp"
+#include "blas_ex/testing_multi_dot_ex.hpp"
+#include "blas_ex/testing_multi_nrm2_ex.hpp"
+#include "blas_ex/testing_normalize_ex.hpp"
+#include "blas_ex/testing_segmented_ex.hpp"
+#include "blas_ex/testing_waxpby_ex.hpp"
+#include "blas_ex/testing_waxpby_strided_batched_ex.hpp"
+#include "blas_ex/testing_xpay_ex.hpp"
+#include "blas_ex/testing_xpay_strided_batched_ex.hpp"
+#include "hipblas_data.hpp"
+#include "hipblas_test.hpp"
+#include "type_dispatch.hpp"
+
+namespace
+{
+    // possible fused BLAS 1 test cases
+    enum blas1_fused_ex_test_type
+    {
+        ASUM_SEGMENTED_EX,
+        AXPY_DOT_EX,
+        AXPY_DOT_STRIDED_BATCHED_EX,
+        DOT_SEGMENTED_EX,
+        DOTC_SEGMENTED_EX,
+        IAMAX_WITH_VALUE_EX,
+        MULTI_DOT_EX,
+        MULTI_NRM2_EX,
+        NORMALIZE_EX,
+        NRM2_SEGMENTED_EX,
+        WAXPBY_EX,
+        WAXPBY_STRIDED_BATCHED_EX,
+        XPAY_EX,
+        XPAY_STRIDED_BATCHED_EX,
+    };
+
+    // a_type is the type of the vectors and compute_type the type of the computation: half and
+    // bfloat16 computed in float, complex computed in real for the norms, or the other types
+    // computed in their own type
+    template <template <typename...> class TEST>
+    auto blas1_fused_ex_dispatch(const Arguments& arg)
+    {
+        if(arg.compute_type == HIPBLAS_R_32F && arg.a_type == HIPBLAS_R_16F)
+            return TEST<hipblasHalf, float>{}(arg);
+        else if(arg.compute_type == HIPBLAS_R_32F && arg.a_type == HIPBLAS_R_16B)
+            return TEST<hipblasBfloat16, float>{}(arg);
+        else if(arg.compute_type == HIPBLAS_R_32F && arg.a_type == HIPBLAS_C_32F)
+            return TEST<hipblasComplex, float>{}(arg);
+        else if(arg.compute_type == HIPBLAS_R_64F && arg.a_type == HIPBLAS_C_64F)
+            return TEST<hipblasDoubleComplex, double>{}(arg);
+        else if(arg.compute_type == arg.a_type)
+            return hipblas_simple_dispatch<TEST>(arg);
+        return TEST<void>{}(arg);
+    }
+
+    // fused BLAS 1 test template
+    template <template <typename...> class FILTER, blas1_fused_ex_test_type BLAS1_FUSED_EX_TYPE>
+    struct blas1_fused_ex_template
+        : HipBLAS_Test<blas1_fused_ex_template<FILTER, BLAS1_FUSED_EX_TYPE>, FILTER>
+    {
+        template <typename... T>
+        struct type_filter_functor
+        {
+            bool operator()(const Arguments& args)
+            {
+                // additional global filters applied first
+                if(!hipblas_client_global_filters(args))
+                    return false;
+
+#ifdef HIPBLAS_V2
+                // type filters
+                return static_cast<bool>(FILTER<T...>{});
+#else
+                // the fused BLAS 1 functions only have the hipDataType interface
+                return false;
+#endif
+            }
+        };
+
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return blas1_fused_ex_dispatch<blas1_fused_ex_template::template type_filter_functor>(
+                arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            const char* name = nullptr;
+            switch(BLAS1_FUSED_EX_TYPE)
+            {
+            case ASUM_SEGMENTED_EX:
+                name = "asum_segmented_ex";
+                break;
+            case AXPY_DOT_EX:
+                name = "axpy_dot_ex";
+                break;
+            case AXPY_DOT_STRIDED_BATCHED_EX:
+                name = "axpy_dot_strided_batched_ex";
+                break;
+            case DOT_SEGMENTED_EX:
+                name = "dot_segmented_ex";
+                break;
+            case DOTC_SEGMENTED_EX:
+                name = "dotc_segmented_ex";
+                break;
+            case IAMAX_WITH_VALUE_EX:
+                name = "iamax_with_value_ex";
+                break;
+            case MULTI_DOT_EX:
+                name = "multi_dot_ex";
+                break;
+            case MULTI_NRM2_EX:
+                name = "multi_nrm2_ex";
+                break;
+            case NORMALIZE_EX:
+                name = "normalize_ex";
+                break;
+            case NRM2_SEGMENTED_EX:
+                name = "nrm2_segmented_ex";
+                break;
+            case WAXPBY_EX:
+                name = "waxpby_ex";
+                break;
+            case WAXPBY_STRIDED_BATCHED_EX:
+                name = "waxpby_strided_batched_ex";
+                break;
+            case XPAY_EX:
+                name = "xpay_ex";
+                break;
+            case XPAY_STRIDED_BATCHED_EX:
+                name = "xpay_strided_batched_ex";
+                break;
+            }
+            return !strcmp(arg.function, name)
+                   || !strcmp(arg.function, (std::string(name) + "_bad_arg").c_str());
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            std::string name;
+            if constexpr(BLAS1_FUSED_EX_TYPE == ASUM_SEGMENTED_EX)
+                testname_asum_segmented_ex(arg, name);
+            else if constexpr(BLAS1_FUSED_EX_TYPE == AXPY_DOT_EX)
+                testname_axpy_dot_ex(arg, name);
+            else if constexpr(BLAS1_FUSED_EX_TYPE == AXPY_DOT_STRIDED_BATCHED_EX)
+                testname_axpy_dot_strided_batched_ex(arg, name);
+            else if constexpr(BLAS1_FUSED_EX_TYPE == DOT_SEGMENTED_EX)
+                testname_dot_segmented_ex(arg, name);
+            else if constexpr(BLAS1_FUSED_EX_TYPE == DOTC_SEGMENTED_EX)
+                testname_dotc_segmented_ex(arg, name);
+            else if constexpr(BLAS1_FUSED_EX_TYPE == IAMAX_WITH_VALUE_EX)
+                testname_iamax_with_value_ex(arg, name);
+            else if constexpr(BLAS1_FUSED_EX_TYPE == MULTI_DOT_EX)
+                testname_multi_dot_ex(arg, name);
+            else if constexpr(BLAS1_FUSED_EX_TYPE == MULTI_NRM2_EX)
+                testname_multi_nrm2_ex(arg, name);
+            else if constexpr(BLAS1_FUSED_EX_TYPE == NORMALIZE_EX)
+                testname_normalize_ex(arg, name);
+            else if constexpr(BLAS1_FUSED_EX_TYPE == NRM2_SEGMENTED_EX)
+                testname_nrm2_segmented_ex(arg, name);
+            else if constexpr(BLAS1_FUSED_EX_TYPE == WAXPBY_EX)
+                testname_waxpby_ex(arg, name);
+            else if constexpr(BLAS1_FUSED_EX_TYPE == WAXPBY_STRIDED_BATCHED_EX)
+                testname_waxpby_strided_batched_ex(arg, name);
+            else if constexpr(BLAS1_FUSED_EX_TYPE == XPAY_EX)
+                testname_xpay_ex(arg, name);
+            else if constexpr(BLAS1_FUSED_EX_TYPE == XPAY_STRIDED_BATCHED_EX)
+                testname_xpay_strided_batched_ex(arg, name);
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename T, typename Tex = T, typename = void>
+    struct blas1_fused_ex_testing : hipblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    template <typename T, typename Tex>
+    struct blas1_fused_ex_testing<
+        T,
+        Tex,
+        std::enable_if_t<
+            (std::is_same_v<T, Tex>
+             && (std::is_same_v<T, float> || std::is_same_v<T, double>
+                 || std::is_same_v<T, hipblasComplex> || std::is_same_v<T, hipblasDoubleComplex>))
+            || ((std::is_same_v<T, hipblasHalf> || std::is_same_v<T, hipblasBfloat16>)
+                && std::is_same_v<Tex, float>)>> : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "axpy_dot_ex"))
+                testing_axpy_dot_ex<T, Tex>(arg);
+            else if(!strcmp(arg.function, "axpy_dot_ex_bad_arg"))
+                testing_axpy_dot_ex_bad_arg<T, Tex>(arg);
+            else if(!strcmp(arg.function, "axpy_dot_strided_batched_ex"))
+                testing_axpy_dot_strided_batched_ex<T, Tex>(arg);
+            else if(!strcmp(arg.function, "axpy_dot_strided_batched_ex_bad_arg"))
+                testing_axpy_dot_strided_batched_ex_bad_arg<T, Tex>(arg);
+            else if(!strcmp(arg.function, "dot_segmented_ex"))
+                testing_dot_segmented_ex<T, Tex>(arg);
+            else if(!strcmp(arg.function, "dot_segmented_ex_bad_arg"))
+                testing_dot_segmented_ex_bad_arg<T, Tex>(arg);
+            else if(!strcmp(arg.function, "dotc_segmented_ex"))
+                testing_dotc_segmented_ex<T, Tex>(arg);
+            else if(!strcmp(arg.function, "dotc_segmented_ex_bad_arg"))
+                testing_dotc_segmented_ex_bad_arg<T, Tex>(arg);
+            else if(!strcmp(arg.function, "iamax_with_value_ex"))
+                testing_iamax_with_value_ex<T, Tex>(arg);
+            else if(!strcmp(arg.function, "iamax_with_value_ex_bad_arg"))
+                testing_iamax_with_value_ex_bad_arg<T, Tex>(arg);
+            else if(!strcmp(arg.function, "multi_dot_ex"))
+                testing_multi_dot_ex<T, Tex>(arg);
+            else if(!strcmp(arg.function, "multi_dot_ex_bad_arg"))
+                testing_multi_dot_ex_bad_arg<T, Tex>(arg);
+            else if(!strcmp(arg.function, "waxpby_ex"))
+                testing_waxpby_ex<T, Tex>(arg);
+            else if(!strcmp(arg.function, "waxpby_ex_bad_arg"))
+                testing_waxpby_ex_bad_arg<T, Tex>(arg);
+            else if(!strcmp(arg.function, "waxpby_strided_batched_ex"))
+                testing_waxpby_strided_batched_ex<T, Tex>(arg);
+            else if(!strcmp(arg.function, "waxpby_strided_batched_ex_bad_arg"))
+                testing_waxpby_strided_batched_ex_bad_arg<T, Tex>(arg);
+            else if(!strcmp(arg.function, "xpay_ex"))
+                testing_xpay_ex<T, Tex>(arg);
+            else if(!strcmp(arg.function, "xpay_ex_bad_arg"))
+                testing_xpay_ex_bad_arg<T, Tex>(arg);
+            else if(!strcmp(arg.function, "xpay_strided_batched_ex"))
+                testing_xpay_strided_batched_ex<T, Tex>(arg);
+            else if(!strcmp(arg.function, "xpay_strided_batched_ex_bad_arg"))
+                testing_xpay_strided_batched_ex_bad_arg<T, Tex>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    // The norms of asum_segmented_ex, multi_nrm2_ex, normalize_ex and nrm2_segmented_ex are of
+    // the real type of the vectors
+    template <typename T, typename Tr = T, typename = void>
+    struct multi_nrm2_ex_testing : hipblas_test_invalid
+    {
+    };
+
+    template <typename T, typename Tr>
+    struct multi_nrm2_ex_testing<
+        T,
+        Tr,
+        std::enable_if_t<
+            (std::is_same_v<Tr, float>
+             && (std::is_same_v<T, float> || std::is_same_v<T, hipblasHalf>
+                 || std::is_same_v<T, hipblasBfloat16> || std::is_same_v<T, hipblasComplex>))
+            || (std::is_same_v<Tr, double>
+                && (std::is_same_v<T, double> || std::is_same_v<T, hipblasDoubleComplex>))>>
+        : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "asum_segmented_ex"))
+                testing_asum_segmented_ex<T, Tr>(arg);
+            else if(!strcmp(arg.function, "asum_segmented_ex_bad_arg"))
+                testing_asum_segmented_ex_bad_arg<T, Tr>(arg);
+            else if(!strcmp(arg.function, "multi_nrm2_ex"))
+                testing_multi_nrm2_ex<T, Tr>(arg);
+            else if(!strcmp(arg.function, "multi_nrm2_ex_bad_arg"))
+                testing_multi_nrm2_ex_bad_arg<T, Tr>(arg);
+            else if(!strcmp(arg.function, "normalize_ex"))
+                testing_normalize_ex<T, Tr>(arg);
+            else if(!strcmp(arg.function, "normalize_ex_bad_arg"))
+                testing_normalize_ex_bad_arg<T, Tr>(arg);
+            else if(!strcmp(arg.function, "nrm2_segmented_ex"))
+                testing_nrm2_segmented_ex<T, Tr>(arg);
+            else if(!strcmp(arg.function, "nrm2_segmented_ex_bad_arg"))
+                testing_nrm2_segmented_ex_bad_arg<T, Tr>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+#define BLAS1_FUSED_EX_TEST(NAME, TESTING, TYPE)                                          \
+    using NAME = blas1_fused_ex_template<TESTING, TYPE>;                                  \
+    TEST_P(NAME, blas1_ex)                                                                \
+    {                                                                                     \
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(                                         \
+            blas1_fused_ex_dispatch<TESTING>(GetParam()));                                \
+    }                                                                                     \
+    INSTANTIATE_TEST_CATEGORIES(NAME)
+
+    BLAS1_FUSED_EX_TEST(asum_segmented_ex, multi_nrm2_ex_testing, ASUM_SEGMENTED_EX)
+    BLAS1_FUSED_EX_TEST(axpy_dot_ex, blas1_fused_ex_testing, AXPY_DOT_EX)
+    BLAS1_FUSED_EX_TEST(axpy_dot_strided_batched_ex,
+                        blas1_fused_ex_testing,
+                        AXPY_DOT_STRIDED_BATCHED_EX)
+    BLAS1_FUSED_EX_TEST(dot_segmented_ex, blas1_fused_ex_testing, DOT_SEGMENTED_EX)
+    BLAS1_FUSED_EX_TEST(dotc_segmented_ex, blas1_fused_ex_testing, DOTC_SEGMENTED_EX)
+    BLAS1_FUSED_EX_TEST(iamax_with_value_ex, blas1_fused_ex_testing, IAMAX_WITH_VALUE_EX)
+    BLAS1_FUSED_EX_TEST(multi_dot_ex, blas1_fused_ex_testing, MULTI_DOT_EX)
+    BLAS1_FUSED_EX_TEST(multi_nrm2_ex, multi_nrm2_ex_testing, MULTI_NRM2_EX)
+    BLAS1_FUSED_EX_TEST(normalize_ex, multi_nrm2_ex_testing, NORMALIZE_EX)
+    BLAS1_FUSED_EX_TEST(nrm2_segmented_ex, multi_nrm2_ex_testing, NRM2_SEGMENTED_EX)
+    BLAS1_FUSED_EX_TEST(waxpby_ex, blas1_fused_ex_testing, WAXPBY_EX)
+    BLAS1_FUSED_EX_TEST(waxpby_strided_batched_ex,
+                        blas1_fused_ex_testing,
+                        WAXPBY_STRIDED_BATCHED_EX)
+    BLAS1_FUSED_EX_TEST(xpay_ex, blas1_fused_ex_testing, XPAY_EX)
+    BLAS1_FUSED_EX_TEST(xpay_strided_batched_ex, blas1_fused_ex_testing, XPAY_STRIDED_BATCHED_EX)
+
+} // namespace
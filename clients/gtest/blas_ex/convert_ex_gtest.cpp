@@ -0,0 +1,155 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "blas_ex/testing_convert_ex.hpp"
+#include "hipblas_data.hpp"
+#include "hipblas_test.hpp"
+#include "type_dispatch.hpp"
+
+namespace
+{
+    // x is of a_type and y of b_type
+    template <template <typename...> class TEST, typename Tx>
+    auto convert_ex_dispatch_y(const Arguments& arg)
+    {
+        switch(arg.b_type)
+        {
+        case HIPBLAS_R_16F:
+            return TEST<Tx, hipblasHalf>{}(arg);
+        case HIPBLAS_R_16B:
+            return TEST<Tx, hipblasBfloat16>{}(arg);
+        case HIPBLAS_R_32F:
+            return TEST<Tx, float>{}(arg);
+        case HIPBLAS_R_64F:
+            return TEST<Tx, double>{}(arg);
+        case HIPBLAS_C_32F:
+            return TEST<Tx, hipblasComplex>{}(arg);
+        case HIPBLAS_C_64F:
+            return TEST<Tx, hipblasDoubleComplex>{}(arg);
+        default:
+            return TEST<void>{}(arg);
+        }
+    }
+
+    template <template <typename...> class TEST>
+    auto convert_ex_dispatch(const Arguments& arg)
+    {
+        switch(arg.a_type)
+        {
+        case HIPBLAS_R_16F:
+            return convert_ex_dispatch_y<TEST, hipblasHalf>(arg);
+        case HIPBLAS_R_16B:
+            return convert_ex_dispatch_y<TEST, hipblasBfloat16>(arg);
+        case HIPBLAS_R_32F:
+            return convert_ex_dispatch_y<TEST, float>(arg);
+        case HIPBLAS_R_64F:
+            return convert_ex_dispatch_y<TEST, double>(arg);
+        case HIPBLAS_C_32F:
+            return convert_ex_dispatch_y<TEST, hipblasComplex>(arg);
+        case HIPBLAS_C_64F:
+            return convert_ex_dispatch_y<TEST, hipblasDoubleComplex>(arg);
+        default:
+            return TEST<void>{}(arg);
+        }
+    }
+
+    // convert_ex test template
+    template <template <typename...> class FILTER>
+    struct convert_ex_template : HipBLAS_Test<convert_ex_template<FILTER>, FILTER>
+    {
+        template <typename... T>
+        struct type_filter_functor
+        {
+            bool operator()(const Arguments& args)
+            {
+                // additional global filters applied first
+                if(!hipblas_client_global_filters(args))
+                    return false;
+
+#ifdef HIPBLAS_V2
+                // type filters
+                return static_cast<bool>(FILTER<T...>{});
+#else
+                // convertEx only has the hipDataType interface
+                return false;
+#endif
+            }
+        };
+
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return convert_ex_dispatch<convert_ex_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "convert_ex")
+                   || !strcmp(arg.function, "convert_ex_bad_arg");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            std::string name;
+            testname_convert_ex(arg, name);
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed third parameter is used for enable_if_t below.
+    template <typename Tx, typename Ty = Tx, typename = void>
+    struct convert_ex_testing : hipblas_test_invalid
+    {
+    };
+
+    // Real vectors convert to real vectors, and complex vectors to complex vectors
+    template <typename Tx, typename Ty>
+    struct convert_ex_testing<Tx,
+                              Ty,
+                              std::enable_if_t<!std::is_void_v<Tx>
+                                               && is_complex<Tx> == is_complex<Ty>>>
+        : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "convert_ex"))
+                testing_convert_ex<Tx, Ty>(arg);
+            else if(!strcmp(arg.function, "convert_ex_bad_arg"))
+                testing_convert_ex_bad_arg<Tx, Ty>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using convert_ex = convert_ex_template<convert_ex_testing>;
+    TEST_P(convert_ex, blas1_ex)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            convert_ex_dispatch<convert_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(convert_ex);
+
+} // namespace
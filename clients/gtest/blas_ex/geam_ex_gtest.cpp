@@ -0,0 +1,180 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "blas_ex/testing_geam_batched_ex.hpp"
+#include "blas_ex/testing_geam_ex.hpp"
+#include "blas_ex/testing_geam_strided_batched_ex.hpp"
+#include "hipblas_data.hpp"
+#include "hipblas_test.hpp"
+#include "type_dispatch.hpp"
+
+namespace
+{
+    // possible geam_ex test cases
+    enum geam_ex_test_type
+    {
+        GEAM_EX,
+        GEAM_BATCHED_EX,
+        GEAM_STRIDED_BATCHED_EX,
+    };
+
+    // The types of hipblas_gemm_dispatch, and conversions between float and the 16-bit types
+    template <template <typename...> class TEST>
+    auto geam_ex_dispatch(const Arguments& arg)
+    {
+        if(arg.b_type == arg.a_type && arg.d_type == arg.c_type
+           && arg.compute_type == HIPBLAS_R_32F)
+        {
+            if(arg.a_type == HIPBLAS_R_32F && arg.c_type == HIPBLAS_R_16F)
+                return TEST<float, hipblasHalf, float>{}(arg);
+            else if(arg.a_type == HIPBLAS_R_32F && arg.c_type == HIPBLAS_R_16B)
+                return TEST<float, hipblasBfloat16, float>{}(arg);
+            else if(arg.a_type == HIPBLAS_R_16F && arg.c_type == HIPBLAS_R_32F)
+                return TEST<hipblasHalf, float, float>{}(arg);
+            else if(arg.a_type == HIPBLAS_R_16B && arg.c_type == HIPBLAS_R_32F)
+                return TEST<hipblasBfloat16, float, float>{}(arg);
+        }
+        return hipblas_gemm_dispatch<TEST>(arg);
+    }
+
+    // geam_ex test template
+    template <template <typename...> class FILTER, geam_ex_test_type GEAM_EX_TYPE>
+    struct geam_ex_template : HipBLAS_Test<geam_ex_template<FILTER, GEAM_EX_TYPE>, FILTER>
+    {
+        template <typename... T>
+        struct type_filter_functor
+        {
+            bool operator()(const Arguments& args)
+            {
+                // additional global filters applied first
+                if(!hipblas_client_global_filters(args))
+                    return false;
+
+#ifdef HIPBLAS_V2
+                // type filters
+                return static_cast<bool>(FILTER<T...>{});
+#else
+                // geam_ex only has the hipDataType interface
+                return false;
+#endif
+            }
+        };
+
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return geam_ex_dispatch<geam_ex_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(GEAM_EX_TYPE)
+            {
+            case GEAM_EX:
+                return !strcmp(arg.function, "geam_ex") || !strcmp(arg.function, "geam_ex_bad_arg");
+            case GEAM_BATCHED_EX:
+                return !strcmp(arg.function, "geam_batched_ex")
+                       || !strcmp(arg.function, "geam_batched_ex_bad_arg");
+            case GEAM_STRIDED_BATCHED_EX:
+                return !strcmp(arg.function, "geam_strided_batched_ex")
+                       || !strcmp(arg.function, "geam_strided_batched_ex_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            std::string name;
+            if constexpr(GEAM_EX_TYPE == GEAM_EX)
+                testname_geam_ex(arg, name);
+            else if constexpr(GEAM_EX_TYPE == GEAM_BATCHED_EX)
+                testname_geam_batched_ex(arg, name);
+            else if constexpr(GEAM_EX_TYPE == GEAM_STRIDED_BATCHED_EX)
+                testname_geam_strided_batched_ex(arg, name);
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+    struct geam_ex_testing : hipblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    // The 16-bit types are only supported with float computation.
+    template <typename Ti, typename To, typename Tc>
+    struct geam_ex_testing<
+        Ti,
+        To,
+        Tc,
+        std::enable_if_t<
+            !std::is_same_v<Ti, void> && !std::is_same_v<Ti, int8_t>
+            && !(std::is_same_v<Tc, hipblasHalf> || std::is_same_v<Tc, hipblasBfloat16>)>>
+        : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "geam_ex"))
+                testing_geam_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "geam_ex_bad_arg"))
+                testing_geam_ex_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "geam_batched_ex"))
+                testing_geam_batched_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "geam_batched_ex_bad_arg"))
+                testing_geam_batched_ex_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "geam_strided_batched_ex"))
+                testing_geam_strided_batched_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "geam_strided_batched_ex_bad_arg"))
+                testing_geam_strided_batched_ex_bad_arg<Ti, To, Tc>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using geam_ex = geam_ex_template<geam_ex_testing, GEAM_EX>;
+    TEST_P(geam_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(geam_ex_dispatch<geam_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(geam_ex);
+
+    using geam_batched_ex = geam_ex_template<geam_ex_testing, GEAM_BATCHED_EX>;
+    TEST_P(geam_batched_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(geam_ex_dispatch<geam_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(geam_batched_ex);
+
+    using geam_strided_batched_ex = geam_ex_template<geam_ex_testing, GEAM_STRIDED_BATCHED_EX>;
+    TEST_P(geam_strided_batched_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(geam_ex_dispatch<geam_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(geam_strided_batched_ex);
+
+} // namespace
@@ -21,8 +21,28 @@
  * ************************************************************************ */
 
 #include "blas_ex/testing_gemm_batched_ex.hpp"
+#include "blas_ex/testing_gemm_batched_ex_pointer_array.hpp"
+#include "blas_ex/testing_gemm_complex_half_ex.hpp"
 #include "blas_ex/testing_gemm_ex.hpp"
+#include "blas_ex/testing_gemm_ex_emulated.hpp"
+#include "blas_ex/testing_gemm_ex_get_solutions.hpp"
+#include "blas_ex/testing_gemm_ex_out_of_place.hpp"
+#include "blas_ex/testing_gemm_ex_sparse.hpp"
+#include "blas_ex/testing_gemm_ex_with_epilogue.hpp"
+#include "blas_ex/testing_gemm_ex_with_quant_weights.hpp"
+#include "blas_ex/testing_gemm_ex_with_diagonal_scales.hpp"
+#include "blas_ex/testing_gemm_planar_complex_ex.hpp"
+#include "blas_ex/testing_gemm_real_complex_ex.hpp"
+#include "blas_ex/testing_gemm_ex_with_requant.hpp"
+#include "blas_ex/testing_gemm_ex_with_scales.hpp"
+#include "blas_ex/testing_gemm_grouped_batched_ex.hpp"
+#include "blas_ex/testing_gemm_plan.hpp"
+#include "blas_ex/testing_gemm_strided_batched_2d_ex.hpp"
+#include "blas_ex/testing_gemm_batch_reduce_ex.hpp"
+#include "blas_ex/testing_gemm_kron_ex.hpp"
 #include "blas_ex/testing_gemm_strided_batched_ex.hpp"
+#include "blas_ex/testing_gemm_strided_batched_ex_scalar_arrays.hpp"
+#include "blas_ex/testing_matmul_tensor.hpp"
 #include "hipblas_data.hpp"
 #include "hipblas_test.hpp"
 #include "type_dispatch.hpp"
@@ -35,6 +55,9 @@ namespace
         GEMM_EX,
         GEMM_BATCHED_EX,
         GEMM_STRIDED_BATCHED_EX,
+        GEMM_GROUPED_BATCHED_EX,
+        GEMM_COMPLEX_HALF_EX,
+        GEMM_STRIDED_BATCHED_COMPLEX_HALF_EX,
     };
 
     // gemm test template
@@ -56,6 +79,20 @@ namespace
                 if(args.api == hipblas_client_api::C_64
                    || args.api == hipblas_client_api::FORTRAN_64)
                     return false;
+
+                // solution enumeration, epilogue, requant, quantized weight, sparse, scaled,
+                // out-of-place, grouped, plan and pointer array APIs only have the hipDataType
+                // interface
+                if(strstr(args.function, "get_solutions") || strstr(args.function, "epilogue")
+                   || strstr(args.function, "requant") || strstr(args.function, "quant_weights")
+                   || strstr(args.function, "sparse")
+                   || strstr(args.function, "scales") || strstr(args.function, "out_of_place")
+                   || strstr(args.function, "grouped") || strstr(args.function, "plan")
+                   || strstr(args.function, "scalar_arrays") || strstr(args.function, "2d")
+                   || strstr(args.function, "pointer_array")
+                   || strstr(args.function, "batch_reduce") || strstr(args.function, "kron")
+                   || strstr(args.function, "complex_half"))
+                    return false;
 #endif
 
                 // type filters
@@ -66,7 +103,13 @@ namespace
         // Filter for which types apply to this suite
         static bool type_filter(const Arguments& arg)
         {
-            return hipblas_simple_dispatch<gemm_ex_template::template type_filter_functor>(arg);
+            if constexpr(GEMM_EX_TYPE == GEMM_COMPLEX_HALF_EX
+                         || GEMM_EX_TYPE == GEMM_STRIDED_BATCHED_COMPLEX_HALF_EX)
+                return hipblas_gemm_complex_half_dispatch<
+                    gemm_ex_template::template type_filter_functor>(arg);
+            else
+                return hipblas_simple_dispatch<gemm_ex_template::template type_filter_functor>(
+                    arg);
         }
 
         // Filter for which functions apply to this suite
@@ -75,13 +118,54 @@ namespace
             switch(GEMM_EX_TYPE)
             {
             case GEMM_EX:
-                return !strcmp(arg.function, "gemm_ex") || !strcmp(arg.function, "gemm_ex_bad_arg");
+                return !strcmp(arg.function, "gemm_ex") || !strcmp(arg.function, "gemm_ex_bad_arg")
+                       || !strcmp(arg.function, "gemm_ex_get_solutions")
+                       || !strcmp(arg.function, "gemm_ex_get_solutions_bad_arg")
+                       || !strcmp(arg.function, "gemm_ex_with_epilogue")
+                       || !strcmp(arg.function, "gemm_ex_with_epilogue_bad_arg")
+                       || !strcmp(arg.function, "gemm_ex_with_requant")
+                       || !strcmp(arg.function, "gemm_ex_with_requant_bad_arg")
+                       || !strcmp(arg.function, "gemm_ex_with_diagonal_scales")
+                       || !strcmp(arg.function, "gemm_ex_with_diagonal_scales_bad_arg")
+                       || !strcmp(arg.function, "gemm_real_complex_ex")
+                       || !strcmp(arg.function, "gemm_real_complex_ex_bad_arg")
+                       || !strcmp(arg.function, "gemm_planar_complex_ex")
+                       || !strcmp(arg.function, "matmul_tensor")
+                       || !strcmp(arg.function, "gemm_ex_with_quant_weights")
+                       || !strcmp(arg.function, "gemm_ex_with_quant_weights_bad_arg")
+                       || !strcmp(arg.function, "gemm_ex_sparse")
+                       || !strcmp(arg.function, "gemm_ex_sparse_bad_arg")
+                       || !strcmp(arg.function, "gemm_ex_emulated")
+                       || !strcmp(arg.function, "gemm_ex_emulated_bad_arg")
+                       || !strcmp(arg.function, "gemm_ex_with_scales")
+                       || !strcmp(arg.function, "gemm_ex_with_scales_bad_arg")
+                       || !strcmp(arg.function, "gemm_ex_out_of_place")
+                       || !strcmp(arg.function, "gemm_ex_out_of_place_bad_arg");
             case GEMM_BATCHED_EX:
                 return !strcmp(arg.function, "gemm_batched_ex")
-                       || !strcmp(arg.function, "gemm_batched_ex_bad_arg");
+                       || !strcmp(arg.function, "gemm_batched_ex_bad_arg")
+                       || !strcmp(arg.function, "gemm_batched_ex_pointer_array")
+                       || !strcmp(arg.function, "gemm_batched_ex_pointer_array_bad_arg");
             case GEMM_STRIDED_BATCHED_EX:
                 return !strcmp(arg.function, "gemm_strided_batched_ex")
-                       || !strcmp(arg.function, "gemm_strided_batched_ex_bad_arg");
+                       || !strcmp(arg.function, "gemm_strided_batched_ex_bad_arg")
+                       || !strcmp(arg.function, "gemm_plan")
+                       || !strcmp(arg.function, "gemm_plan_bad_arg")
+                       || !strcmp(arg.function, "gemm_strided_batched_ex_scalar_arrays")
+                       || !strcmp(arg.function, "gemm_strided_batched_ex_scalar_arrays_bad_arg")
+                       || !strcmp(arg.function, "gemm_strided_batched_2d_ex")
+                       || !strcmp(arg.function, "gemm_strided_batched_2d_ex_bad_arg")
+                       || !strcmp(arg.function, "gemm_batch_reduce_ex")
+                       || !strcmp(arg.function, "gemm_batch_reduce_ex_bad_arg")
+                       || !strcmp(arg.function, "gemm_kron_ex")
+                       || !strcmp(arg.function, "gemm_kron_ex_bad_arg");
+            case GEMM_GROUPED_BATCHED_EX:
+                return !strcmp(arg.function, "gemm_grouped_batched_ex")
+                       || !strcmp(arg.function, "gemm_grouped_batched_ex_bad_arg");
+            case GEMM_COMPLEX_HALF_EX:
+                return !strcmp(arg.function, "gemm_complex_half_ex");
+            case GEMM_STRIDED_BATCHED_COMPLEX_HALF_EX:
+                return !strcmp(arg.function, "gemm_strided_batched_complex_half_ex");
             }
             return false;
         }
@@ -91,11 +175,54 @@ namespace
         {
             std::string name;
             if constexpr(GEMM_EX_TYPE == GEMM_EX)
-                testname_gemm_ex(arg, name);
+            {
+                if(strstr(arg.function, "requant"))
+                    testname_gemm_ex_with_requant(arg, name);
+                else if(strstr(arg.function, "diagonal_scales"))
+                    testname_gemm_ex_with_diagonal_scales(arg, name);
+                else if(strstr(arg.function, "real_complex"))
+                    testname_gemm_real_complex_ex(arg, name);
+                else if(strstr(arg.function, "planar_complex"))
+                    testname_gemm_planar_complex_ex(arg, name);
+                else if(strstr(arg.function, "matmul_tensor"))
+                    testname_matmul_tensor(arg, name);
+                else if(strstr(arg.function, "quant_weights"))
+                    testname_gemm_ex_with_quant_weights(arg, name);
+                else if(strstr(arg.function, "sparse"))
+                    testname_gemm_ex_sparse(arg, name);
+                else if(strstr(arg.function, "emulated"))
+                    testname_gemm_ex_emulated(arg, name);
+                else
+                    testname_gemm_ex(arg, name);
+            }
             else if constexpr(GEMM_EX_TYPE == GEMM_BATCHED_EX)
-                testname_gemm_batched_ex(arg, name);
+            {
+                if(strstr(arg.function, "pointer_array"))
+                    testname_gemm_batched_ex_pointer_array(arg, name);
+                else
+                    testname_gemm_batched_ex(arg, name);
+            }
             else if constexpr(GEMM_EX_TYPE == GEMM_STRIDED_BATCHED_EX)
-                testname_gemm_strided_batched_ex(arg, name);
+            {
+                if(strstr(arg.function, "plan"))
+                    testname_gemm_plan(arg, name);
+                else if(strstr(arg.function, "scalar_arrays"))
+                    testname_gemm_strided_batched_ex_scalar_arrays(arg, name);
+                else if(strstr(arg.function, "2d"))
+                    testname_gemm_strided_batched_2d_ex(arg, name);
+                else if(strstr(arg.function, "batch_reduce"))
+                    testname_gemm_batch_reduce_ex(arg, name);
+                else if(strstr(arg.function, "kron"))
+                    testname_gemm_kron_ex(arg, name);
+                else
+                    testname_gemm_strided_batched_ex(arg, name);
+            }
+            else if constexpr(GEMM_EX_TYPE == GEMM_GROUPED_BATCHED_EX)
+                testname_gemm_grouped_batched_ex(arg, name);
+            else if constexpr(GEMM_EX_TYPE == GEMM_COMPLEX_HALF_EX)
+                testname_gemm_complex_half_ex(arg, name);
+            else if constexpr(GEMM_EX_TYPE == GEMM_STRIDED_BATCHED_COMPLEX_HALF_EX)
+                testname_gemm_strided_batched_complex_half_ex(arg, name);
             return std::move(name);
         }
     };
@@ -126,14 +253,111 @@ namespace
                 testing_gemm_ex<Ti, To, Tc>(arg);
             else if(!strcmp(arg.function, "gemm_ex_bad_arg"))
                 testing_gemm_ex_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_ex_get_solutions"))
+                testing_gemm_ex_get_solutions<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_ex_get_solutions_bad_arg"))
+                testing_gemm_ex_get_solutions_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_ex_with_epilogue"))
+                testing_gemm_ex_with_epilogue<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_ex_with_epilogue_bad_arg"))
+                testing_gemm_ex_with_epilogue_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_ex_with_requant"))
+                testing_gemm_ex_with_requant<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_ex_with_requant_bad_arg"))
+                testing_gemm_ex_with_requant_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_ex_with_diagonal_scales"))
+                testing_gemm_ex_with_diagonal_scales<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_ex_with_diagonal_scales_bad_arg"))
+                testing_gemm_ex_with_diagonal_scales_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_real_complex_ex"))
+                testing_gemm_real_complex_ex<Ti>(arg);
+            else if(!strcmp(arg.function, "gemm_real_complex_ex_bad_arg"))
+                testing_gemm_real_complex_ex_bad_arg<Ti>(arg);
+            else if(!strcmp(arg.function, "gemm_planar_complex_ex"))
+                testing_gemm_planar_complex_ex<Ti>(arg);
+            else if(!strcmp(arg.function, "matmul_tensor"))
+                testing_matmul_tensor<Ti>(arg);
+            else if(!strcmp(arg.function, "gemm_ex_with_quant_weights"))
+                testing_gemm_ex_with_quant_weights<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_ex_with_quant_weights_bad_arg"))
+                testing_gemm_ex_with_quant_weights_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_ex_sparse"))
+                testing_gemm_ex_sparse<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_ex_sparse_bad_arg"))
+                testing_gemm_ex_sparse_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_ex_emulated"))
+                testing_gemm_ex_emulated<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_ex_emulated_bad_arg"))
+                testing_gemm_ex_emulated_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_ex_with_scales"))
+                testing_gemm_ex_with_scales<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_ex_with_scales_bad_arg"))
+                testing_gemm_ex_with_scales_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_ex_out_of_place"))
+                testing_gemm_ex_out_of_place<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_ex_out_of_place_bad_arg"))
+                testing_gemm_ex_out_of_place_bad_arg<Ti, To, Tc>(arg);
             else if(!strcmp(arg.function, "gemm_batched_ex"))
                 testing_gemm_batched_ex<Ti, To, Tc>(arg);
             else if(!strcmp(arg.function, "gemm_batched_ex_bad_arg"))
                 testing_gemm_batched_ex_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_batched_ex_pointer_array"))
+                testing_gemm_batched_ex_pointer_array<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_batched_ex_pointer_array_bad_arg"))
+                testing_gemm_batched_ex_pointer_array_bad_arg<Ti, To, Tc>(arg);
             else if(!strcmp(arg.function, "gemm_strided_batched_ex"))
                 testing_gemm_strided_batched_ex<Ti, To, Tc>(arg);
             else if(!strcmp(arg.function, "gemm_strided_batched_ex_bad_arg"))
                 testing_gemm_strided_batched_ex_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_strided_batched_ex_scalar_arrays"))
+                testing_gemm_strided_batched_ex_scalar_arrays<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_strided_batched_ex_scalar_arrays_bad_arg"))
+                testing_gemm_strided_batched_ex_scalar_arrays_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_strided_batched_2d_ex"))
+                testing_gemm_strided_batched_2d_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_strided_batched_2d_ex_bad_arg"))
+                testing_gemm_strided_batched_2d_ex_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_batch_reduce_ex"))
+                testing_gemm_batch_reduce_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_batch_reduce_ex_bad_arg"))
+                testing_gemm_batch_reduce_ex_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_kron_ex"))
+                testing_gemm_kron_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_kron_ex_bad_arg"))
+                testing_gemm_kron_ex_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_plan"))
+                testing_gemm_plan<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_plan_bad_arg"))
+                testing_gemm_plan_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_grouped_batched_ex"))
+                testing_gemm_grouped_batched_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_grouped_batched_ex_bad_arg"))
+                testing_gemm_grouped_batched_ex_bad_arg<Ti, To, Tc>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    // complex half and bfloat16 gemm_ex, of the types of hipblas_gemm_complex_half_dispatch
+    template <typename, typename = void, typename = void>
+    struct gemm_complex_half_ex_testing : hipblas_test_invalid
+    {
+    };
+
+    template <typename Th, typename To>
+    struct gemm_complex_half_ex_testing<
+        Th,
+        To,
+        std::enable_if_t<(std::is_same_v<Th, hipblasHalf> || std::is_same_v<Th, hipblasBfloat16>)
+                         && (std::is_same_v<To, Th> || std::is_same_v<To, float>)>>
+        : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemm_complex_half_ex"))
+                testing_gemm_complex_half_ex<Th, To>(arg);
+            else if(!strcmp(arg.function, "gemm_strided_batched_complex_half_ex"))
+                testing_gemm_strided_batched_complex_half_ex<Th, To>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -163,4 +387,30 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(gemm_strided_batched_ex);
 
+    using gemm_grouped_batched_ex = gemm_ex_template<gemm_ex_testing, GEMM_GROUPED_BATCHED_EX>;
+    TEST_P(gemm_grouped_batched_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_gemm_dispatch<gemm_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_grouped_batched_ex);
+
+    using gemm_complex_half_ex
+        = gemm_ex_template<gemm_complex_half_ex_testing, GEMM_COMPLEX_HALF_EX>;
+    TEST_P(gemm_complex_half_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_gemm_complex_half_dispatch<gemm_complex_half_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_complex_half_ex);
+
+    using gemm_strided_batched_complex_half_ex
+        = gemm_ex_template<gemm_complex_half_ex_testing, GEMM_STRIDED_BATCHED_COMPLEX_HALF_EX>;
+    TEST_P(gemm_strided_batched_complex_half_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_gemm_complex_half_dispatch<gemm_complex_half_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_strided_batched_complex_half_ex);
+
 } // namespace
@@ -0,0 +1,172 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "blas_ex/testing_gemv_batched_ex.hpp"
+#include "blas_ex/testing_gemv_ex.hpp"
+#include "blas_ex/testing_gemv_planar_complex_ex.hpp"
+#include "blas_ex/testing_gemv_strided_batched_ex.hpp"
+#include "hipblas_data.hpp"
+#include "hipblas_test.hpp"
+#include "type_dispatch.hpp"
+
+namespace
+{
+    // possible gemv_ex test cases
+    enum gemv_ex_test_type
+    {
+        GEMV_EX,
+        GEMV_BATCHED_EX,
+        GEMV_STRIDED_BATCHED_EX,
+    };
+
+    // gemv_ex test template
+    template <template <typename...> class FILTER, gemv_ex_test_type GEMV_EX_TYPE>
+    struct gemv_ex_template : HipBLAS_Test<gemv_ex_template<FILTER, GEMV_EX_TYPE>, FILTER>
+    {
+        template <typename... T>
+        struct type_filter_functor
+        {
+            bool operator()(const Arguments& args)
+            {
+                // additional global filters applied first
+                if(!hipblas_client_global_filters(args))
+                    return false;
+
+#ifdef HIPBLAS_V2
+                // type filters
+                return static_cast<bool>(FILTER<T...>{});
+#else
+                // gemv_ex only has the hipDataType interface
+                return false;
+#endif
+            }
+        };
+
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return hipblas_gemm_dispatch<gemv_ex_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(GEMV_EX_TYPE)
+            {
+            case GEMV_EX:
+                return !strcmp(arg.function, "gemv_ex") || !strcmp(arg.function, "gemv_ex_bad_arg")
+                       || !strcmp(arg.function, "gemv_planar_complex_ex");
+            case GEMV_BATCHED_EX:
+                return !strcmp(arg.function, "gemv_batched_ex")
+                       || !strcmp(arg.function, "gemv_batched_ex_bad_arg");
+            case GEMV_STRIDED_BATCHED_EX:
+                return !strcmp(arg.function, "gemv_strided_batched_ex")
+                       || !strcmp(arg.function, "gemv_strided_batched_ex_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            std::string name;
+            if constexpr(GEMV_EX_TYPE == GEMV_EX)
+            {
+                if(strstr(arg.function, "planar_complex"))
+                    testname_gemv_planar_complex_ex(arg, name);
+                else
+                    testname_gemv_ex(arg, name);
+            }
+            else if constexpr(GEMV_EX_TYPE == GEMV_BATCHED_EX)
+                testname_gemv_batched_ex(arg, name);
+            else if constexpr(GEMV_EX_TYPE == GEMV_STRIDED_BATCHED_EX)
+                testname_gemv_strided_batched_ex(arg, name);
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+    struct gemv_ex_testing : hipblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    // The 16-bit types are only supported with float computation.
+    template <typename Ti, typename To, typename Tc>
+    struct gemv_ex_testing<
+        Ti,
+        To,
+        Tc,
+        std::enable_if_t<
+            !std::is_same_v<Ti, void> && !std::is_same_v<Ti, int8_t>
+            && !(std::is_same_v<Tc, hipblasHalf> || std::is_same_v<Tc, hipblasBfloat16>)>>
+        : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemv_ex"))
+                testing_gemv_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemv_ex_bad_arg"))
+                testing_gemv_ex_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemv_planar_complex_ex"))
+                testing_gemv_planar_complex_ex<Ti>(arg);
+            else if(!strcmp(arg.function, "gemv_batched_ex"))
+                testing_gemv_batched_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemv_batched_ex_bad_arg"))
+                testing_gemv_batched_ex_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemv_strided_batched_ex"))
+                testing_gemv_strided_batched_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemv_strided_batched_ex_bad_arg"))
+                testing_gemv_strided_batched_ex_bad_arg<Ti, To, Tc>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using gemv_ex = gemv_ex_template<gemv_ex_testing, GEMV_EX>;
+    TEST_P(gemv_ex, blas2)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_gemm_dispatch<gemv_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemv_ex);
+
+    using gemv_batched_ex = gemv_ex_template<gemv_ex_testing, GEMV_BATCHED_EX>;
+    TEST_P(gemv_batched_ex, blas2)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_gemm_dispatch<gemv_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemv_batched_ex);
+
+    using gemv_strided_batched_ex = gemv_ex_template<gemv_ex_testing, GEMV_STRIDED_BATCHED_EX>;
+    TEST_P(gemv_strided_batched_ex, blas2)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_gemm_dispatch<gemv_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemv_strided_batched_ex);
+
+} // namespace
@@ -0,0 +1,192 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "blas_ex/testing_gemmt_ex.hpp"
+#include "blas_ex/testing_herk_ex.hpp"
+#include "blas_ex/testing_syr2k_ex.hpp"
+#include "blas_ex/testing_syrk_ex.hpp"
+#include "hipblas_data.hpp"
+#include "hipblas_test.hpp"
+#include "type_dispatch.hpp"
+
+namespace
+{
+    // possible syrk_ex test cases
+    enum syrk_ex_test_type
+    {
+        SYRK_EX,
+        HERK_EX,
+        SYR2K_EX,
+        GEMMT_EX,
+    };
+
+    // The types of hipblas_gemm_dispatch, and 16-bit A with float C, the Gram matrix case
+    template <template <typename...> class TEST>
+    auto syrk_ex_dispatch(const Arguments& arg)
+    {
+        if(arg.b_type == arg.a_type && arg.d_type == arg.c_type && arg.c_type == HIPBLAS_R_32F
+           && arg.compute_type == HIPBLAS_R_32F)
+        {
+            if(arg.a_type == HIPBLAS_R_16F)
+                return TEST<hipblasHalf, float, float>{}(arg);
+            else if(arg.a_type == HIPBLAS_R_16B)
+                return TEST<hipblasBfloat16, float, float>{}(arg);
+        }
+        return hipblas_gemm_dispatch<TEST>(arg);
+    }
+
+    // syrk_ex test template
+    template <template <typename...> class FILTER, syrk_ex_test_type SYRK_EX_TYPE>
+    struct syrk_ex_template : HipBLAS_Test<syrk_ex_template<FILTER, SYRK_EX_TYPE>, FILTER>
+    {
+        template <typename... T>
+        struct type_filter_functor
+        {
+            bool operator()(const Arguments& args)
+            {
+                // additional global filters applied first
+                if(!hipblas_client_global_filters(args))
+                    return false;
+
+#ifdef HIPBLAS_V2
+                // type filters
+                return static_cast<bool>(FILTER<T...>{});
+#else
+                // syrk_ex only has the hipDataType interface
+                return false;
+#endif
+            }
+        };
+
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return syrk_ex_dispatch<syrk_ex_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(SYRK_EX_TYPE)
+            {
+            case SYRK_EX:
+                return !strcmp(arg.function, "syrk_ex") || !strcmp(arg.function, "syrk_ex_bad_arg");
+            case HERK_EX:
+                return !strcmp(arg.function, "herk_ex") || !strcmp(arg.function, "herk_ex_bad_arg");
+            case SYR2K_EX:
+                return !strcmp(arg.function, "syr2k_ex")
+                       || !strcmp(arg.function, "syr2k_ex_bad_arg");
+            case GEMMT_EX:
+                return !strcmp(arg.function, "gemmt_ex")
+                       || !strcmp(arg.function, "gemmt_ex_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            std::string name;
+            if constexpr(SYRK_EX_TYPE == SYRK_EX)
+                testname_syrk_ex(arg, name);
+            else if constexpr(SYRK_EX_TYPE == HERK_EX)
+                testname_herk_ex(arg, name);
+            else if constexpr(SYRK_EX_TYPE == SYR2K_EX)
+                testname_syr2k_ex(arg, name);
+            else if constexpr(SYRK_EX_TYPE == GEMMT_EX)
+                testname_gemmt_ex(arg, name);
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+    struct syrk_ex_testing : hipblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    // The 16-bit types are only supported with float computation.
+    template <typename Ti, typename To, typename Tc>
+    struct syrk_ex_testing<
+        Ti,
+        To,
+        Tc,
+        std::enable_if_t<
+            !std::is_same_v<Ti, void> && !std::is_same_v<Ti, int8_t>
+            && !(std::is_same_v<Tc, hipblasHalf> || std::is_same_v<Tc, hipblasBfloat16>)>>
+        : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "syrk_ex"))
+                testing_syrk_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "syrk_ex_bad_arg"))
+                testing_syrk_ex_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "syr2k_ex"))
+                testing_syr2k_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "syr2k_ex_bad_arg"))
+                testing_syr2k_ex_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "herk_ex"))
+                testing_herk_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "herk_ex_bad_arg"))
+                testing_herk_ex_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemmt_ex"))
+                testing_gemmt_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemmt_ex_bad_arg"))
+                testing_gemmt_ex_bad_arg<Ti, To, Tc>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using syrk_ex = syrk_ex_template<syrk_ex_testing, SYRK_EX>;
+    TEST_P(syrk_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(syrk_ex_dispatch<syrk_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(syrk_ex);
+
+    using herk_ex = syrk_ex_template<syrk_ex_testing, HERK_EX>;
+    TEST_P(herk_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(syrk_ex_dispatch<syrk_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(herk_ex);
+
+    using syr2k_ex = syrk_ex_template<syrk_ex_testing, SYR2K_EX>;
+    TEST_P(syr2k_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(syrk_ex_dispatch<syrk_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(syr2k_ex);
+
+    using gemmt_ex = syrk_ex_template<syrk_ex_testing, GEMMT_EX>;
+    TEST_P(gemmt_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(syrk_ex_dispatch<syrk_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemmt_ex);
+
+} // namespace
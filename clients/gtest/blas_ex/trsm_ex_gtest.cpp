@@ -22,6 +22,7 @@
 
 #include "blas_ex/testing_trsm_batched_ex.hpp"
 #include "blas_ex/testing_trsm_ex.hpp"
+#include "blas_ex/testing_trsm_prepared.hpp"
 #include "blas_ex/testing_trsm_strided_batched_ex.hpp"
 #include "hipblas_data.hpp"
 #include "hipblas_test.hpp"
@@ -35,6 +36,7 @@ namespace
         TRSM_EX,
         TRSM_BATCHED_EX,
         TRSM_STRIDED_BATCHED_EX,
+        TRSM_PREPARED,
     };
 
     // trsm_ex test template
@@ -74,6 +76,9 @@ namespace
             case TRSM_STRIDED_BATCHED_EX:
                 return !strcmp(arg.function, "trsm_strided_batched_ex")
                        || !strcmp(arg.function, "trsm_strided_batched_ex_bad_arg");
+            case TRSM_PREPARED:
+                return !strcmp(arg.function, "trsm_prepared")
+                       || !strcmp(arg.function, "trsm_prepared_bad_arg");
             }
             return false;
         }
@@ -88,6 +93,8 @@ namespace
                 testname_trsm_batched_ex(arg, name);
             else if constexpr(TRSM_EX_TYPE == TRSM_STRIDED_BATCHED_EX)
                 testname_trsm_strided_batched_ex(arg, name);
+            else if constexpr(TRSM_EX_TYPE == TRSM_PREPARED)
+                testname_trsm_prepared(arg, name);
             return std::move(name);
         }
     };
@@ -124,6 +131,10 @@ namespace
                 testing_trsm_strided_batched_ex<T>(arg);
             else if(!strcmp(arg.function, "trsm_strided_batched_ex_bad_arg"))
                 testing_trsm_strided_batched_ex_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "trsm_prepared"))
+                testing_trsm_prepared<T>(arg);
+            else if(!strcmp(arg.function, "trsm_prepared_bad_arg"))
+                testing_trsm_prepared_bad_arg<T>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -153,4 +164,12 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(trsm_strided_batched_ex);
 
+    using trsm_prepared = trsm_ex_template<trsm_ex_testing, TRSM_PREPARED>;
+    TEST_P(trsm_prepared, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<trsm_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(trsm_prepared);
+
 } // namespace
@@ -0,0 +1,162 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "blas_ex/testing_gemm_vbatched.hpp"
+#include "blas_ex/testing_gemv_vbatched.hpp"
+#include "blas_ex/testing_trsm_vbatched.hpp"
+#include "hipblas_data.hpp"
+#include "hipblas_test.hpp"
+#include "type_dispatch.hpp"
+
+namespace
+{
+    // possible vbatched test cases
+    enum vbatched_test_type
+    {
+        GEMV_VBATCHED,
+        GEMM_VBATCHED,
+        TRSM_VBATCHED,
+    };
+
+    // vbatched test template
+    template <template <typename...> class FILTER, vbatched_test_type VBATCHED_TYPE>
+    struct vbatched_template : HipBLAS_Test<vbatched_template<FILTER, VBATCHED_TYPE>, FILTER>
+    {
+        template <typename... T>
+        struct type_filter_functor
+        {
+            bool operator()(const Arguments& args)
+            {
+                // additional global filters applied first
+                if(!hipblas_client_global_filters(args))
+                    return false;
+
+#ifdef HIPBLAS_V2
+                // type filters
+                return static_cast<bool>(FILTER<T...>{});
+#else
+                // the vbatched functions only have the hipDataType interface
+                return false;
+#endif
+            }
+        };
+
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return hipblas_simple_dispatch<vbatched_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(VBATCHED_TYPE)
+            {
+            case GEMV_VBATCHED:
+                return !strcmp(arg.function, "gemv_vbatched")
+                       || !strcmp(arg.function, "gemv_vbatched_bad_arg");
+            case GEMM_VBATCHED:
+                return !strcmp(arg.function, "gemm_vbatched")
+                       || !strcmp(arg.function, "gemm_vbatched_bad_arg");
+            case TRSM_VBATCHED:
+                return !strcmp(arg.function, "trsm_vbatched")
+                       || !strcmp(arg.function, "trsm_vbatched_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            std::string name;
+            if constexpr(VBATCHED_TYPE == GEMV_VBATCHED)
+                testname_gemv_vbatched(arg, name);
+            else if constexpr(VBATCHED_TYPE == GEMM_VBATCHED)
+                testname_gemm_vbatched(arg, name);
+            else if constexpr(VBATCHED_TYPE == TRSM_VBATCHED)
+                testname_trsm_vbatched(arg, name);
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename, typename = void>
+    struct vbatched_testing : hipblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    template <typename T>
+    struct vbatched_testing<
+        T,
+        std::enable_if_t<
+            std::is_same_v<
+                T,
+                float> || std::is_same_v<T, double> || std::is_same_v<T, hipblasComplex> || std::is_same_v<T, hipblasDoubleComplex>>>
+        : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemv_vbatched"))
+                testing_gemv_vbatched<T>(arg);
+            else if(!strcmp(arg.function, "gemv_vbatched_bad_arg"))
+                testing_gemv_vbatched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "gemm_vbatched"))
+                testing_gemm_vbatched<T>(arg);
+            else if(!strcmp(arg.function, "gemm_vbatched_bad_arg"))
+                testing_gemm_vbatched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "trsm_vbatched"))
+                testing_trsm_vbatched<T>(arg);
+            else if(!strcmp(arg.function, "trsm_vbatched_bad_arg"))
+                testing_trsm_vbatched_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using gemv_vbatched = vbatched_template<vbatched_testing, GEMV_VBATCHED>;
+    TEST_P(gemv_vbatched, blas2)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<vbatched_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemv_vbatched);
+
+    using gemm_vbatched = vbatched_template<vbatched_testing, GEMM_VBATCHED>;
+    TEST_P(gemm_vbatched, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<vbatched_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_vbatched);
+
+    using trsm_vbatched = vbatched_template<vbatched_testing, TRSM_VBATCHED>;
+    TEST_P(trsm_vbatched, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<vbatched_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(trsm_vbatched);
+
+} // namespace
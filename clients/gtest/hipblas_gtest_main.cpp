@@ -46,11 +46,18 @@
 #include "hipblas_test.hpp"
 
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
 #include <string>
 
 #include <gtest/gtest.h>
 
+#ifndef WIN32
+#include <spawn.h>
+#include <sys/wait.h>
+extern char** environ;
+#endif
+
 #include <hipblas.h>
 
 #include "clients_common.hpp"
@@ -288,8 +295,10 @@ static void hipblas_print_args(const std::string& args)
 
 static void hipblas_set_test_device()
 {
-    int device_id    = 0;
-    int device_count = query_device_property();
+    // the --devices launcher gives each of its workers a device
+    auto* test_device  = getenv("HIPBLAS_TEST_DEVICE");
+    int   device_id    = test_device ? atoi(test_device) : 0;
+    int   device_count = query_device_property();
     if(device_count <= 0)
     {
         std::cerr << "Error: No devices found" << std::endl;
@@ -298,13 +307,263 @@ static void hipblas_set_test_device()
     set_device(device_id);
 }
 
+// Scan and remove a --devices option, whose value is all, a number of devices, or a comma
+// separated list of device IDs. Returns the devices, or an empty list if there is no option
+static std::vector<int> hipblas_parse_devices(int& argc, char** argv)
+{
+    std::string spec;
+    char**      argv_p = argv + 1;
+
+    for(int i = 1; argv[i]; ++i)
+    {
+        if(!strcmp(argv[i], "--devices"))
+        {
+            if(!argv[i + 1] || !argv[i + 1][0])
+            {
+                std::cerr << "The --devices option requires an argument" << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            spec = argv[++i];
+        }
+        else
+            *argv_p++ = argv[i];
+    }
+    *argv_p = nullptr;
+    argc    = argv_p - argv;
+
+    std::vector<int> devices;
+    if(spec.empty())
+        return devices;
+
+    int device_count = 0;
+    if(hipGetDeviceCount(&device_count) != hipSuccess || device_count <= 0)
+    {
+        std::cerr << "Error: No devices found" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    if(spec == "all" || spec.find(',') == std::string::npos)
+    {
+        int count = spec == "all" ? device_count : std::min(atoi(spec.c_str()), device_count);
+        for(int device = 0; device < count; device++)
+            devices.push_back(device);
+    }
+    else
+    {
+        std::istringstream list(spec);
+        for(std::string id; std::getline(list, id, ',');)
+            devices.push_back(atoi(id.c_str()));
+    }
+
+    for(int device : devices)
+    {
+        if(device < 0 || device >= device_count)
+        {
+            std::cerr << "Error: --devices " << spec << " names a device that doesn't exist"
+                      << std::endl;
+            exit(EXIT_FAILURE);
+        }
+    }
+    if(devices.empty())
+    {
+        std::cerr << "Error: --devices " << spec << " names no devices" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    return devices;
+}
+
+// Value of a numeric field of the root of a gtest report, the attribute name="value" of xml or
+// the member "name": value of json, which come before those of the test suites
+static double hipblas_report_field(const std::string& report, const std::string& name, bool xml)
+{
+    std::string key = xml ? " " + name + "=\"" : "\"" + name + "\": ";
+    size_t      pos = report.find(key);
+    if(pos == std::string::npos)
+        return 0;
+    pos += key.size();
+    if(report[pos] == '"')
+        pos++;
+    return strtod(report.c_str() + pos, nullptr);
+}
+
+// Merge the gtest reports of the workers into one report at path, with the sums of the counts of
+// the tests and the longest time. Returns false if a report is missing
+static bool hipblas_merge_reports(const std::string&              path,
+                                  bool                            xml,
+                                  const std::vector<std::string>& worker_paths)
+{
+    const char* fields[] = {"tests", "failures", "disabled", "errors"};
+    double      counts[4] = {}, time = 0;
+    std::string suites;
+    bool        complete = true, json_suites = false;
+
+    for(auto& worker_path : worker_paths)
+    {
+        std::ifstream      file(worker_path);
+        std::ostringstream contents;
+        contents << file.rdbuf();
+        std::string report = contents.str();
+
+        // the suites are inside <testsuites ...> and </testsuites>, or "testsuites": [ and ]
+        size_t begin = xml ? report.find('>', report.find("<testsuites"))
+                           : report.find('[', report.find("\"testsuites\""));
+        size_t end   = xml ? report.rfind("</testsuites>") : report.rfind(']');
+        if(!file || begin == std::string::npos || end == std::string::npos || end < begin)
+        {
+            std::cerr << "Error: missing or incomplete report " << worker_path << std::endl;
+            complete = false;
+            continue;
+        }
+
+        for(int i = 0; i < 4; i++)
+            counts[i] += hipblas_report_field(report, fields[i], xml);
+        time = std::max(time, hipblas_report_field(report, "time", xml));
+
+        // json suites are separated by commas, and a worker may have run none
+        std::string worker_suites = report.substr(begin + 1, end - begin - 1);
+        if(!xml && worker_suites.find('{') != std::string::npos)
+        {
+            if(json_suites)
+                suites += ",";
+            json_suites = true;
+        }
+        suites += worker_suites;
+        file.close();
+        std::remove(worker_path.c_str());
+    }
+
+    std::ofstream out(path);
+    if(xml)
+    {
+        out << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<testsuites";
+        for(int i = 0; i < 4; i++)
+            out << " " << fields[i] << "=\"" << int64_t(counts[i]) << "\"";
+        out << " time=\"" << time << "\" name=\"AllTests\">" << suites << "</testsuites>\n";
+    }
+    else
+    {
+        out << "{\n";
+        for(int i = 0; i < 4; i++)
+            out << "  \"" << fields[i] << "\": " << int64_t(counts[i]) << ",\n";
+        out << "  \"time\": \"" << time << "s\",\n  \"name\": \"AllTests\",\n  \"testsuites\": ["
+            << suites << "]\n}\n";
+    }
+    return complete && bool(out);
+}
+
+// Run the tests in one worker process for each device, which each run a gtest shard of the tests
+// on their device, and merge the xml or json reports of --gtest_output into one
+static int hipblas_test_devices(int argc, char** argv, const std::vector<int>& devices)
+{
+#ifdef WIN32
+    std::cerr << "Error: --devices isn't supported on Windows" << std::endl;
+    return EXIT_FAILURE;
+#else
+    std::vector<std::string> worker_args(argv, argv + argc);
+
+    // the workers read the data file that the yaml was expanded into, instead of expanding it again
+    const std::string& data = HipBLAS_TestData::get_filename();
+    if(!data.empty())
+    {
+        worker_args.push_back("--data");
+        worker_args.push_back(data);
+    }
+
+    // --gtest_output=xml[:path] or json[:path] is written by each worker to a file of its own
+    std::string output_path, output_format;
+    size_t      output_arg = 0;
+    for(size_t i = 1; i < worker_args.size(); i++)
+    {
+        const std::string option = "--gtest_output=";
+        if(worker_args[i].compare(0, option.size(), option))
+            continue;
+        std::string value = worker_args[i].substr(option.size());
+        output_format     = value.substr(0, value.find(':'));
+        output_path       = value.size() > output_format.size() + 1
+                                ? value.substr(output_format.size() + 1)
+                                : "";
+        if(output_path.empty() || output_path.back() == '/')
+            output_path += "test_detail." + output_format;
+        output_arg = i;
+    }
+    if(output_arg && output_format != "xml" && output_format != "json")
+    {
+        std::cerr << "Error: --gtest_output=" << output_format
+                  << " can't be merged, use xml or json" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::vector<pid_t>       workers;
+    std::vector<std::string> worker_paths;
+    int                      status = EXIT_SUCCESS;
+    for(size_t shard = 0; shard < devices.size(); shard++)
+    {
+        std::vector<std::string> args(worker_args);
+        if(output_arg)
+        {
+            size_t dot = output_path.rfind('.');
+            worker_paths.push_back(output_path.substr(0, dot) + ".device"
+                                   + std::to_string(devices[shard]) + output_path.substr(dot));
+            args[output_arg] = "--gtest_output=" + output_format + ":" + worker_paths.back();
+        }
+
+        std::vector<std::string> env;
+        for(char** var = environ; *var; ++var)
+            if(strncmp(*var, "GTEST_TOTAL_SHARDS=", 19) && strncmp(*var, "GTEST_SHARD_INDEX=", 18)
+               && strncmp(*var, "HIPBLAS_TEST_DEVICE=", 20))
+                env.push_back(*var);
+        env.push_back("GTEST_TOTAL_SHARDS=" + std::to_string(devices.size()));
+        env.push_back("GTEST_SHARD_INDEX=" + std::to_string(shard));
+        env.push_back("HIPBLAS_TEST_DEVICE=" + std::to_string(devices[shard]));
+
+        std::vector<char*> args_p, env_p;
+        for(auto& arg : args)
+            args_p.push_back(&arg[0]);
+        args_p.push_back(nullptr);
+        for(auto& var : env)
+            env_p.push_back(&var[0]);
+        env_p.push_back(nullptr);
+
+        pid_t pid;
+        if(posix_spawnp(&pid, argv[0], nullptr, nullptr, args_p.data(), env_p.data()))
+        {
+            std::cerr << "Error: cannot start the worker for device " << devices[shard]
+                      << std::endl;
+            status = EXIT_FAILURE;
+            break;
+        }
+        workers.push_back(pid);
+        std::cout << "hipblas-test INFO: shard " << shard << " of " << devices.size()
+                  << " runs on device " << devices[shard] << " in process " << pid << std::endl;
+    }
+
+    for(size_t shard = 0; shard < workers.size(); shard++)
+    {
+        int worker_status;
+        if(waitpid(workers[shard], &worker_status, 0) < 0 || !WIFEXITED(worker_status)
+           || WEXITSTATUS(worker_status))
+        {
+            std::cerr << "hipblas-test: the worker for device " << devices[shard] << " failed"
+                      << std::endl;
+            status = EXIT_FAILURE;
+        }
+    }
+
+    if(output_arg && !hipblas_merge_reports(output_path, output_format == "xml", worker_paths))
+        status = EXIT_FAILURE;
+
+    return status;
+#endif
+}
+
 /* =====================================================================
       Main function:
 =================================================================== */
 
 int main(int argc, char** argv)
 {
-    std::string args = hipblas_capture_args(argc, argv);
+    std::string      args    = hipblas_capture_args(argc, argv);
+    std::vector<int> devices = hipblas_parse_devices(argc, argv);
 
     auto* no_signal_handling = getenv("HIPBLAS_TEST_NO_SIGACTION");
     if(no_signal_handling)
@@ -319,8 +578,9 @@ int main(int argc, char** argv)
 
     print_version_info();
 
-    // Set test device
-    hipblas_set_test_device();
+    // Set test device, unless the tests are run in a worker for each device
+    if(devices.empty())
+        hipblas_set_test_device();
 
     hipblas_print_usage_warning();
 
@@ -330,6 +590,9 @@ int main(int argc, char** argv)
     bool datafile = hipblas_parse_data(argc, argv, hipblas_exepath() + "hipblas_gtest.data");
 #endif
 
+    if(!devices.empty())
+        return hipblas_test_devices(argc, argv, devices);
+
     ::testing::InitGoogleTest(&argc, argv);
 
     // Set Google Test listener
@@ -353,6 +616,9 @@ int main(int argc, char** argv)
         status = RUN_ALL_TESTS();
     }
 
+    // Free the data file stream and the cached device memory
+    test_cleanup::cleanup();
+
     print_version_info(); // redundant, but convenient when tests fail
 
     hipblas_print_args(args);
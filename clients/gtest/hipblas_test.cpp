@@ -245,7 +245,7 @@ std::string HipBLAS_TestName_to_string(std::unordered_map<std::string, size_t>&
 }
 
 static const char* const validCategories[]
-    = {"quick", "pre_checkin", "nightly", "multi_gpu", "HMM", "known_bug", NULL};
+    = {"quick", "pre_checkin", "nightly", "multi_gpu", "HMM", "known_bug", "perf", NULL};
 
 static bool valid_category(const char* category)
 {
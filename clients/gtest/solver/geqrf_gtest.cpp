@@ -24,7 +24,10 @@
 #include "hipblas_test.hpp"
 #include "solver/testing_geqrf.hpp"
 #include "solver/testing_geqrf_batched.hpp"
+#include "solver/testing_geqrf_batched_strided_tau.hpp"
 #include "solver/testing_geqrf_strided_batched.hpp"
+#include "solver/testing_geqrf_tall_skinny.hpp"
+#include "solver/testing_larf.hpp"
 #include "type_dispatch.hpp"
 
 namespace
@@ -35,6 +38,9 @@ namespace
         GEQRF,
         GEQRF_BATCHED,
         GEQRF_STRIDED_BATCHED,
+        GEQRF_BATCHED_STRIDED_TAU,
+        GEQRF_TALL_SKINNY,
+        LARF,
     };
 
     //geqrf test template
@@ -74,6 +80,14 @@ namespace
             case GEQRF_STRIDED_BATCHED:
                 return !strcmp(arg.function, "geqrf_strided_batched")
                        || !strcmp(arg.function, "geqrf_strided_batched_bad_arg");
+            case GEQRF_BATCHED_STRIDED_TAU:
+                return !strcmp(arg.function, "geqrf_batched_strided_tau")
+                       || !strcmp(arg.function, "geqrf_batched_strided_tau_bad_arg");
+            case GEQRF_TALL_SKINNY:
+                return !strcmp(arg.function, "geqrf_tall_skinny")
+                       || !strcmp(arg.function, "geqrf_tall_skinny_bad_arg");
+            case LARF:
+                return !strcmp(arg.function, "larf") || !strcmp(arg.function, "larf_bad_arg");
             }
             return false;
         }
@@ -88,6 +102,12 @@ namespace
                 testname_geqrf_batched(arg, name);
             else if constexpr(GEQRF_TYPE == GEQRF_STRIDED_BATCHED)
                 testname_geqrf_strided_batched(arg, name);
+            else if constexpr(GEQRF_TYPE == GEQRF_BATCHED_STRIDED_TAU)
+                testname_geqrf_batched_strided_tau(arg, name);
+            else if constexpr(GEQRF_TYPE == GEQRF_TALL_SKINNY)
+                testname_geqrf_tall_skinny(arg, name);
+            else if constexpr(GEQRF_TYPE == LARF)
+                testname_larf(arg, name);
             return std::move(name);
         }
     };
@@ -124,6 +144,18 @@ namespace
                 testing_geqrf_strided_batched<T>(arg);
             else if(!strcmp(arg.function, "geqrf_strided_batched_bad_arg"))
                 testing_geqrf_strided_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "geqrf_batched_strided_tau"))
+                testing_geqrf_batched_strided_tau<T>(arg);
+            else if(!strcmp(arg.function, "geqrf_batched_strided_tau_bad_arg"))
+                testing_geqrf_batched_strided_tau_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "geqrf_tall_skinny"))
+                testing_geqrf_tall_skinny<T>(arg);
+            else if(!strcmp(arg.function, "geqrf_tall_skinny_bad_arg"))
+                testing_geqrf_tall_skinny_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "larf"))
+                testing_larf<T>(arg);
+            else if(!strcmp(arg.function, "larf_bad_arg"))
+                testing_larf_bad_arg<T>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -153,4 +185,28 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(geqrf_strided_batched);
 
+    using geqrf_batched_strided_tau = geqrf_template<geqrf_testing, GEQRF_BATCHED_STRIDED_TAU>;
+    TEST_P(geqrf_batched_strided_tau, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<geqrf_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(geqrf_batched_strided_tau);
+
+    using geqrf_tall_skinny = geqrf_template<geqrf_testing, GEQRF_TALL_SKINNY>;
+    TEST_P(geqrf_tall_skinny, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<geqrf_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(geqrf_tall_skinny);
+
+    using larf = geqrf_template<geqrf_testing, LARF>;
+    TEST_P(larf, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<geqrf_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(larf);
+
 } // namespace
@@ -22,8 +22,10 @@
 
 #include "hipblas_data.hpp"
 #include "hipblas_test.hpp"
+#include "solver/testing_band.hpp"
 #include "solver/testing_getrf.hpp"
 #include "solver/testing_getrf_batched.hpp"
+#include "solver/testing_getrf_interleaved.hpp"
 #include "solver/testing_getrf_npvt.hpp"
 #include "solver/testing_getrf_npvt_batched.hpp"
 #include "solver/testing_getrf_npvt_strided_batched.hpp"
@@ -40,7 +42,9 @@ namespace
         GETRF_STRIDED_BATCHED,
         GETRF_NPVT,
         GETRF_NPVT_BATCHED,
-        GETRF_NPVT_STRIDED_BATCHED
+        GETRF_NPVT_STRIDED_BATCHED,
+        BAND,
+        GETRF_INTERLEAVED,
     };
 
     //getrf test template
@@ -89,6 +93,10 @@ namespace
             case GETRF_NPVT_STRIDED_BATCHED:
                 return !strcmp(arg.function, "getrf_npvt_strided_batched")
                        || !strcmp(arg.function, "getrf_npvt_strided_batched_bad_arg");
+            case BAND:
+                return !strcmp(arg.function, "band") || !strcmp(arg.function, "band_bad_arg");
+            case GETRF_INTERLEAVED:
+                return !strcmp(arg.function, "getrf_interleaved");
             }
             return false;
         }
@@ -109,6 +117,10 @@ namespace
                 testname_getrf_npvt_batched(arg, name);
             else if constexpr(GETRF_TYPE == GETRF_NPVT_STRIDED_BATCHED)
                 testname_getrf_npvt_strided_batched(arg, name);
+            else if constexpr(GETRF_TYPE == BAND)
+                testname_band(arg, name);
+            else if constexpr(GETRF_TYPE == GETRF_INTERLEAVED)
+                testname_getrf_interleaved(arg, name);
             return std::move(name);
         }
     };
@@ -157,6 +169,12 @@ namespace
                 testing_getrf_npvt_strided_batched<T>(arg);
             else if(!strcmp(arg.function, "getrf_npvt_strided_batched_bad_arg"))
                 testing_getrf_npvt_strided_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "band"))
+                testing_band<T>(arg);
+            else if(!strcmp(arg.function, "band_bad_arg"))
+                testing_band_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "getrf_interleaved"))
+                testing_getrf_interleaved<T>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -210,4 +228,20 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(getrf_npvt_strided_batched);
 
+    using band = getrf_template<getrf_testing, BAND>;
+    TEST_P(band, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<getrf_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(band);
+
+    using getrf_interleaved = getrf_template<getrf_testing, GETRF_INTERLEAVED>;
+    TEST_P(getrf_interleaved, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<getrf_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(getrf_interleaved);
+
 } // namespace
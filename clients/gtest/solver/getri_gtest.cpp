@@ -24,6 +24,8 @@
 #include "hipblas_test.hpp"
 #include "solver/testing_getri_batched.hpp"
 #include "solver/testing_getri_npvt_batched.hpp"
+#include "solver/testing_matinv_batched.hpp"
+#include "solver/testing_matinv_strided_batched.hpp"
 #include "type_dispatch.hpp"
 
 namespace
@@ -32,7 +34,9 @@ namespace
     enum getri_test_type
     {
         GETRI_BATCHED,
-        GETRI_NPVT_BATCHED
+        GETRI_NPVT_BATCHED,
+        MATINV_BATCHED,
+        MATINV_STRIDED_BATCHED
     };
 
     //getri test template
@@ -70,6 +74,12 @@ namespace
             case GETRI_NPVT_BATCHED:
                 return !strcmp(arg.function, "getri_npvt_batched")
                        || !strcmp(arg.function, "getri_npvt_batched_bad_arg");
+            case MATINV_BATCHED:
+                return !strcmp(arg.function, "matinv_batched")
+                       || !strcmp(arg.function, "matinv_batched_bad_arg");
+            case MATINV_STRIDED_BATCHED:
+                return !strcmp(arg.function, "matinv_strided_batched")
+                       || !strcmp(arg.function, "matinv_strided_batched_bad_arg");
             }
             return false;
         }
@@ -82,6 +92,10 @@ namespace
                 testname_getri_batched(arg, name);
             else if constexpr(GETRI_TYPE == GETRI_NPVT_BATCHED)
                 testname_getri_npvt_batched(arg, name);
+            else if constexpr(GETRI_TYPE == MATINV_BATCHED)
+                testname_matinv_batched(arg, name);
+            else if constexpr(GETRI_TYPE == MATINV_STRIDED_BATCHED)
+                testname_matinv_strided_batched(arg, name);
             return std::move(name);
         }
     };
@@ -114,6 +128,14 @@ namespace
                 testing_getri_npvt_batched<T>(arg);
             else if(!strcmp(arg.function, "getri_npvt_batched_bad_arg"))
                 testing_getri_npvt_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "matinv_batched"))
+                testing_matinv_batched<T>(arg);
+            else if(!strcmp(arg.function, "matinv_batched_bad_arg"))
+                testing_matinv_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "matinv_strided_batched"))
+                testing_matinv_strided_batched<T>(arg);
+            else if(!strcmp(arg.function, "matinv_strided_batched_bad_arg"))
+                testing_matinv_strided_batched_bad_arg<T>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -135,4 +157,20 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(getri_npvt_batched);
 
+    using matinv_batched = getri_template<getri_testing, MATINV_BATCHED>;
+    TEST_P(matinv_batched, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<getri_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(matinv_batched);
+
+    using matinv_strided_batched = getri_template<getri_testing, MATINV_STRIDED_BATCHED>;
+    TEST_P(matinv_strided_batched, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<getri_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(matinv_strided_batched);
+
 } // namespace
@@ -24,6 +24,7 @@
 #include "hipblas_test.hpp"
 #include "solver/testing_getrs.hpp"
 #include "solver/testing_getrs_batched.hpp"
+#include "solver/testing_getrs_interleaved.hpp"
 #include "solver/testing_getrs_strided_batched.hpp"
 #include "type_dispatch.hpp"
 
@@ -35,6 +36,7 @@ namespace
         GETRS,
         GETRS_BATCHED,
         GETRS_STRIDED_BATCHED,
+        GETRS_INTERLEAVED,
     };
 
     //getrs test template
@@ -74,6 +76,8 @@ namespace
             case GETRS_STRIDED_BATCHED:
                 return !strcmp(arg.function, "getrs_strided_batched")
                        || !strcmp(arg.function, "getrs_strided_batched_bad_arg");
+            case GETRS_INTERLEAVED:
+                return !strcmp(arg.function, "getrs_interleaved");
             }
             return false;
         }
@@ -88,6 +92,8 @@ namespace
                 testname_getrs_batched(arg, name);
             else if constexpr(GETRS_TYPE == GETRS_STRIDED_BATCHED)
                 testname_getrs_strided_batched(arg, name);
+            else if constexpr(GETRS_TYPE == GETRS_INTERLEAVED)
+                testname_getrs_interleaved(arg, name);
             return std::move(name);
         }
     };
@@ -124,6 +130,8 @@ namespace
                 testing_getrs_strided_batched<T>(arg);
             else if(!strcmp(arg.function, "getrs_strided_batched_bad_arg"))
                 testing_getrs_strided_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "getrs_interleaved"))
+                testing_getrs_interleaved<T>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -153,4 +161,12 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(getrs_strided_batched);
 
+    using getrs_interleaved = getrs_template<getrs_testing, GETRS_INTERLEAVED>;
+    TEST_P(getrs_interleaved, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<getrs_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(getrs_interleaved);
+
 } // namespace
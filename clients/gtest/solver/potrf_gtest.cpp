@@ -0,0 +1,174 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas_data.hpp"
+#include "hipblas_test.hpp"
+#include "solver/testing_pftrf.hpp"
+#include "solver/testing_potrf.hpp"
+#include "solver/testing_potrf_batched.hpp"
+#include "solver/testing_potrf_strided_batched.hpp"
+#include "type_dispatch.hpp"
+
+namespace
+{
+    // possible potrf test cases
+    enum potrf_test_type
+    {
+        POTRF,
+        POTRF_BATCHED,
+        POTRF_STRIDED_BATCHED,
+        PFTRF,
+    };
+
+    //potrf test template
+    template <template <typename...> class FILTER, potrf_test_type POTRF_TYPE>
+    struct potrf_template : HipBLAS_Test<potrf_template<FILTER, POTRF_TYPE>, FILTER>
+    {
+        template <typename... T>
+        struct type_filter_functor
+        {
+            bool operator()(const Arguments& args)
+            {
+                // additional global filters applied first
+                if(!hipblas_client_global_filters(args))
+                    return false;
+
+                // type filters
+                return static_cast<bool>(FILTER<T...>{});
+            }
+        };
+
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return hipblas_simple_dispatch<potrf_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(POTRF_TYPE)
+            {
+            case POTRF:
+                return !strcmp(arg.function, "potrf") || !strcmp(arg.function, "potrf_bad_arg");
+            case POTRF_BATCHED:
+                return !strcmp(arg.function, "potrf_batched")
+                       || !strcmp(arg.function, "potrf_batched_bad_arg");
+            case POTRF_STRIDED_BATCHED:
+                return !strcmp(arg.function, "potrf_strided_batched")
+                       || !strcmp(arg.function, "potrf_strided_batched_bad_arg");
+            case PFTRF:
+                return !strcmp(arg.function, "pftrf") || !strcmp(arg.function, "pftrf_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            std::string name;
+            if constexpr(POTRF_TYPE == POTRF)
+                testname_potrf(arg, name);
+            else if constexpr(POTRF_TYPE == POTRF_BATCHED)
+                testname_potrf_batched(arg, name);
+            else if constexpr(POTRF_TYPE == POTRF_STRIDED_BATCHED)
+                testname_potrf_strided_batched(arg, name);
+            else if constexpr(POTRF_TYPE == PFTRF)
+                testname_pftrf(arg, name);
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename, typename = void>
+    struct potrf_testing : hipblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    template <typename T>
+    struct potrf_testing<
+        T,
+        std::enable_if_t<
+            std::is_same_v<
+                T,
+                float> || std::is_same_v<T, double> || std::is_same_v<T, hipblasComplex> || std::is_same_v<T, hipblasDoubleComplex>>>
+        : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "potrf"))
+                testing_potrf<T>(arg);
+            else if(!strcmp(arg.function, "potrf_bad_arg"))
+                testing_potrf_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "potrf_batched"))
+                testing_potrf_batched<T>(arg);
+            else if(!strcmp(arg.function, "potrf_batched_bad_arg"))
+                testing_potrf_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "potrf_strided_batched"))
+                testing_potrf_strided_batched<T>(arg);
+            else if(!strcmp(arg.function, "potrf_strided_batched_bad_arg"))
+                testing_potrf_strided_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "pftrf"))
+                testing_pftrf<T>(arg);
+            else if(!strcmp(arg.function, "pftrf_bad_arg"))
+                testing_pftrf_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using potrf = potrf_template<potrf_testing, POTRF>;
+    TEST_P(potrf, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<potrf_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(potrf);
+
+    using potrf_batched = potrf_template<potrf_testing, POTRF_BATCHED>;
+    TEST_P(potrf_batched, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<potrf_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(potrf_batched);
+
+    using potrf_strided_batched = potrf_template<potrf_testing, POTRF_STRIDED_BATCHED>;
+    TEST_P(potrf_strided_batched, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<potrf_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(potrf_strided_batched);
+
+    using pftrf = potrf_template<potrf_testing, PFTRF>;
+    TEST_P(pftrf, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<potrf_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(pftrf);
+
+} // namespace
@@ -25,6 +25,7 @@
 #define _ARGUMENT_MODEL_HPP_
 
 #include "hipblas_arguments.hpp"
+#include "hipblas_counters.hpp"
 #include <algorithm>
 #include <iostream>
 #include <sstream>
@@ -41,6 +42,83 @@ bool ArgumentModel_get_log_function_name();
 void ArgumentModel_set_log_datatype(bool d);
 bool ArgumentModel_get_log_datatype();
 
+// hipblas-bench --output json|csv --output_file path: each run is also written to path as one
+// record of every Arguments field, its results and the environment. Throws if path can't be
+// opened or the format isn't json or csv
+void ArgumentModel_set_output(const std::string& format, const std::string& path);
+
+// hipblas-bench --baseline path: each run is also written to path as a JSON record with the time of
+// each of its hot iterations, which hipblas-bench --baseline path --compare reruns. Throws if path
+// can't be opened
+void ArgumentModel_set_baseline(const std::string& path);
+
+void ArgumentModel_log_record(const Arguments& arg,
+                              double           us,
+                              double           hipblas_gflops,
+                              double           hipblas_GBps,
+                              double           gflops,
+                              double           gbytes,
+                              double           norm1,
+                              double           norm2);
+
+// the time of all hot calls and the rates of the last run logged by this thread, for the aggregate
+// report of hipblas-bench --parallel_devices
+struct ArgumentModel_perf
+{
+    double gpu_us = 0;
+    double gflops = 0;
+    double GBps   = 0;
+};
+
+void               ArgumentModel_set_last_perf(const ArgumentModel_perf& perf);
+ArgumentModel_perf ArgumentModel_get_last_perf();
+
+// appends the min, median, 95th and 99th percentiles and coefficient of variation of the times of
+// the iterations of the last loop timed by hipblas_iteration_timer to the performance fields
+void ArgumentModel_log_iteration_statistics(std::stringstream& name_line,
+                                            std::stringstream& val_line);
+
+// appends the peaks of the device, the arithmetic intensity and the percentages of the peaks and of
+// the roofline that the rates reach to the performance fields
+void ArgumentModel_log_roofline(std::stringstream& name_line,
+                                std::stringstream& val_line,
+                                const Arguments&   arg,
+                                double             hipblas_gflops,
+                                double             hipblas_GBps,
+                                double             gflops,
+                                double             gbytes);
+
+// fails the test, or warns in hipblas-bench, when the rate of a timed run is below
+// arg.perf_threshold percent of the roofline of the device, the lower of its compute peak for the
+// type of arg and what its bandwidth feeds at the arithmetic intensity of the run
+void ArgumentModel_check_perf_threshold(const Arguments& arg,
+                                        double           hipblas_gflops,
+                                        double           hipblas_GBps,
+                                        double           gflops,
+                                        double           gbytes);
+
+// appends the mean power, energy per call, Gflops per watt, mean clocks and hottest temperature
+// that hipblas_telemetry sampled over the last loop of this thread to the performance fields
+void ArgumentModel_log_telemetry(std::stringstream& name_line,
+                                 std::stringstream& val_line,
+                                 double             hipblas_gflops,
+                                 double             us_per_call);
+
+// appends the device memory of the operands, the workspace the handle asked for in query mode, the
+// growth of the used device memory during the last loop timed by this thread, and the footprint,
+// the operands and the larger of the workspace and the growth, to the performance fields
+void ArgumentModel_log_memory_footprint(std::stringstream& name_line, std::stringstream& val_line);
+
+// appends the flops and bytes per call of the models of flops.hpp and bytes.hpp, and the value per
+// call of each hardware counter that hipblas_counters collected over the last loop of this thread,
+// to the performance fields. With the FETCH_SIZE and WRITE_SIZE counters of AMD devices, the bytes
+// they moved are compared with the model too
+void ArgumentModel_log_counters(std::stringstream& name_line,
+                                std::stringstream& val_line,
+                                double             hipblas_gflops,
+                                double             hipblas_GBps,
+                                double             us_per_call);
+
 // ArgumentModel template has a variadic list of argument enums
 template <hipblas_argument... Args>
 class ArgumentModel
@@ -85,6 +163,39 @@ public:
             val_line << ",";
         val_line << hipblas_gflops << ", " << hipblas_GBps << ", " << gpu_us / hot_calls << ", ";
 
+        // the throughput of the batched functions in problems, such as the matrices of a batched
+        // factorization, per second
+        if(has_batch_count)
+        {
+            name_line << "hipblas-problems/s,";
+            val_line << double(batch_count) * hot_calls / gpu_us * 1e6 << ", ";
+        }
+
+        ArgumentModel_set_last_perf({gpu_us, hipblas_gflops, hipblas_GBps});
+
+        if(arg.report_percentiles)
+            ArgumentModel_log_iteration_statistics(name_line, val_line);
+
+        if(arg.roofline)
+            ArgumentModel_log_roofline(
+                name_line, val_line, arg, hipblas_gflops, hipblas_GBps, gflops, gbytes);
+
+        if(arg.perf_threshold > 0)
+            ArgumentModel_check_perf_threshold(arg, hipblas_gflops, hipblas_GBps, gflops, gbytes);
+
+        if(arg.telemetry)
+            ArgumentModel_log_telemetry(name_line, val_line, hipblas_gflops, gpu_us / hot_calls);
+
+        if(arg.memory_footprint)
+            ArgumentModel_log_memory_footprint(name_line, val_line);
+
+        if(hipblas_counters::selected())
+            ArgumentModel_log_counters(
+                name_line, val_line, hipblas_gflops, hipblas_GBps, gpu_us / hot_calls);
+
+        ArgumentModel_log_record(
+            arg, gpu_us / hot_calls, hipblas_gflops, hipblas_GBps, gflops, gbytes, norm1, norm2);
+
         if(arg.unit_check || arg.norm_check)
         {
             if(arg.norm_check)
@@ -0,0 +1,104 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_compute_partition(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_compute_partition(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+
+    const uint32_t mask[] = {0xf};
+    const uint32_t none[] = {0};
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetComputePartition(nullptr, 1, mask),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasSetComputePartitionFraction(nullptr, 0.5f),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+#ifdef __HIP_PLATFORM_NVCC__
+    EXPECT_HIPBLAS_STATUS(hipblasSetComputePartition(handle, 1, mask),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+    EXPECT_HIPBLAS_STATUS(hipblasSetComputePartitionFraction(handle, 0.5f),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+#else
+    EXPECT_HIPBLAS_STATUS(hipblasSetComputePartition(handle, 1, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetComputePartition(handle, 0, mask),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetComputePartition(handle, 1, none),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetComputePartitionFraction(handle, 0.0f),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetComputePartitionFraction(handle, 1.5f),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    hipStream_t stream, partition_stream;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+    // ending a partition that wasn't set does nothing
+    CHECK_HIPBLAS_ERROR(hipblasSetComputePartition(handle, 0, nullptr));
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &partition_stream));
+    EXPECT_EQ(partition_stream, stream);
+
+    // the calls of the handle go to the stream of the partition, after the work queued before
+    const int            N     = 256;
+    const float          alpha = 2.0f;
+    host_vector<float>   hx(N);
+    device_vector<float> dx(N, 1);
+    for(int i = 0; i < N; i++)
+        hx[i] = float(i);
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(float) * N, hipMemcpyHostToDevice));
+
+    CHECK_HIPBLAS_ERROR(hipblasSscal(handle, N, &alpha, dx, 1));
+    CHECK_HIPBLAS_ERROR(hipblasSetComputePartitionFraction(handle, 0.5f));
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &partition_stream));
+    EXPECT_NE(partition_stream, stream);
+    CHECK_HIPBLAS_ERROR(hipblasSscal(handle, N, &alpha, dx, 1));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetComputePartition(handle, 1, mask));
+    CHECK_HIPBLAS_ERROR(hipblasSscal(handle, N, &alpha, dx, 1));
+
+    // ending the partition sets back the stream the handle had
+    CHECK_HIPBLAS_ERROR(hipblasSetComputePartition(handle, 0, nullptr));
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &partition_stream));
+    EXPECT_EQ(partition_stream, stream);
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    CHECK_HIP_ERROR(hipMemcpy(hx, dx, sizeof(float) * N, hipMemcpyDeviceToHost));
+    for(int i = 0; i < N; i++)
+        EXPECT_EQ(hx[i], alpha * alpha * alpha * i);
+
+    // a stream set by the user ends the partition too
+    CHECK_HIPBLAS_ERROR(hipblasSetComputePartitionFraction(handle, 0.25f));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetComputePartition(handle, 0, nullptr));
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &partition_stream));
+    EXPECT_EQ(partition_stream, stream);
+#endif
+}
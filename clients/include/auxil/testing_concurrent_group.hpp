@@ -0,0 +1,102 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_concurrent_group(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_concurrent_group(const Arguments& arg)
+{
+    const int N = 1000;
+
+    hipblasLocalHandle       handle(arg);
+    hipblasConcurrentGroup_t group;
+    hipblasHandle_t          h1, h2, h3;
+
+    EXPECT_HIPBLAS_STATUS(hipblasConcurrentGroupCreate(nullptr, 2, &group),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasConcurrentGroupCreate(handle, 0, &group),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasConcurrentGroupCreate(handle, 2, &group));
+
+    // handles are only handed out between begin and end
+    EXPECT_HIPBLAS_STATUS(
+        hipblasConcurrentGroupNext(group, 0, nullptr, nullptr, 0, nullptr, nullptr, &h1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    host_vector<float> hx(N), hy(N), hz(N), hy_gold(N), hz_gold(N);
+    for(int i = 0; i < N; i++)
+    {
+        hx[i]      = float(i % 7);
+        hy[i]      = float(i % 5);
+        hz[i]      = float(i % 3);
+        hy_gold[i] = hy[i] + 2 * hx[i];
+        hz_gold[i] = 3 * hz[i];
+    }
+
+    device_vector<float> dx(N), dy(N), dz(N);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dz.memcheck());
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(dz.transfer_from(hz));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasConcurrentGroupBegin(group));
+    EXPECT_HIPBLAS_STATUS(hipblasConcurrentGroupBegin(group), HIPBLAS_STATUS_INVALID_VALUE);
+
+    const float  one = 1, three = 3;
+    const void*  reads[]  = {dx};
+    const void*  writes[] = {dy};
+    const void*  zs[]     = {dz};
+    const size_t sizes[]  = {N * sizeof(float)};
+
+    // the two updates of y overlap, so they are queued on the same stream
+    CHECK_HIPBLAS_ERROR(hipblasConcurrentGroupNext(group, 1, reads, sizes, 1, writes, sizes, &h1));
+    CHECK_HIPBLAS_ERROR(hipblasSaxpy(h1, N, &one, dx, 1, dy, 1));
+    CHECK_HIPBLAS_ERROR(hipblasConcurrentGroupNext(group, 0, nullptr, nullptr, 1, zs, sizes, &h3));
+    CHECK_HIPBLAS_ERROR(hipblasSscal(h3, N, &three, dz, 1));
+    CHECK_HIPBLAS_ERROR(hipblasConcurrentGroupNext(group, 1, reads, sizes, 1, writes, sizes, &h2));
+    CHECK_HIPBLAS_ERROR(hipblasSaxpy(h2, N, &one, dx, 1, dy, 1));
+    EXPECT_EQ(h1, h2);
+    EXPECT_NE(h1, h3);
+
+    // a group can't be destroyed between begin and end
+    EXPECT_HIPBLAS_STATUS(hipblasConcurrentGroupDestroy(group), HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasConcurrentGroupEnd(group));
+
+    hipStream_t stream;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(hy.transfer_from(dy));
+    CHECK_HIP_ERROR(hz.transfer_from(dz));
+    unit_check_general<float>(1, N, 1, hy_gold, hy);
+    unit_check_general<float>(1, N, 1, hz_gold, hz);
+
+    CHECK_HIPBLAS_ERROR(hipblasConcurrentGroupDestroy(group));
+}
@@ -0,0 +1,86 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_common.hpp"
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_copy_matrix_peer(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_copy_matrix_peer(const Arguments& arg)
+{
+    const int rows = 37, cols = 19, lda = 40, ldb = 38;
+
+    int device, device_count;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+    CHECK_HIP_ERROR(hipGetDeviceCount(&device_count));
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasCopyMatrixPeerAsync(
+            rows, cols, 4, device, nullptr, lda, device_count, nullptr, ldb, nullptr),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasCopyMatrixPeerAsync(
+            rows, cols, 4, device, nullptr, rows - 1, device, nullptr, ldb, nullptr),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasCopyMatrixPeerAsync(
+        0, cols, 4, device, nullptr, lda, device, nullptr, ldb, nullptr));
+
+    host_vector<float> hA(lda * cols), hB(ldb * cols);
+    hipblas_init<float>(hA, rows, cols, lda);
+
+    device_vector<float> dA(lda * cols);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    // within the device, and to the next device when there is one
+    for(int dst : {device, (device + 1) % device_count})
+    {
+        CHECK_HIP_ERROR(hipSetDevice(dst));
+        hipStream_t stream;
+        CHECK_HIP_ERROR(hipStreamCreate(&stream));
+        float* dB;
+        CHECK_HIP_ERROR(hipMalloc(&dB, sizeof(float) * ldb * cols));
+
+        CHECK_HIPBLAS_ERROR(hipblasCopyMatrixPeerAsync(
+            rows, cols, sizeof(float), device, dA, lda, dst, dB, ldb, stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+        int current;
+        CHECK_HIP_ERROR(hipGetDevice(&current));
+        EXPECT_EQ(current, dst);
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hB.data(), dB, sizeof(float) * ldb * cols, hipMemcpyDeviceToHost));
+        for(int j = 0; j < cols; j++)
+            for(int i = 0; i < rows; i++)
+                EXPECT_EQ(hB[i + j * ldb], hA[i + j * lda]);
+
+        CHECK_HIP_ERROR(hipFree(dB));
+        CHECK_HIP_ERROR(hipStreamDestroy(stream));
+        CHECK_HIP_ERROR(hipSetDevice(device));
+    }
+}
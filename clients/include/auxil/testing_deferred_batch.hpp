@@ -0,0 +1,138 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_deferred_batch(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_deferred_batch(const Arguments& arg)
+{
+    // gemms 0 to 3 have the same shape, gemm 4 doesn't, and gemm 5 reads the C of gemm 0
+    const int n = 8, ld = 8, size = n * ld, gemms = 6;
+
+    hipblasLocalHandle handle(arg);
+
+    EXPECT_HIPBLAS_STATUS(hipblasBeginBatch(nullptr), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasEndBatch(handle), HIPBLAS_STATUS_INVALID_VALUE);
+
+    host_vector<float> hA(size * gemms), hB(size * gemms), hC(size * gemms), hC_gold(size * gemms);
+    hipblas_init<float>(hA, n, n * gemms, ld);
+    hipblas_init<float>(hB, n, n * gemms, ld);
+    hipblas_init<float>(hC, n, n * gemms, ld);
+    hC_gold = hC;
+
+    device_vector<float> dA(size * gemms), dB(size * gemms), dC(size * gemms);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+
+    const float alpha = 2, beta = 1;
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasBeginBatch(handle));
+    EXPECT_HIPBLAS_STATUS(hipblasBeginBatch(handle), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // arguments are checked when the gemm is queued
+    EXPECT_HIPBLAS_STATUS(
+        hipblasSgemm(
+            handle, HIPBLAS_OP_N, HIPBLAS_OP_N, n, n, n, &alpha, dA, 0, dB, ld, &beta, dC, ld),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    for(int i = 0; i < gemms; i++)
+    {
+        int                m    = i == 4 ? n / 2 : n;
+        const float*       A    = i == 5 ? dC : dA + i * size;
+        const float*       hA_i = i == 5 ? hC_gold.data() : hA.data() + i * size;
+        hipblasOperation_t op   = i == 4 ? HIPBLAS_OP_T : HIPBLAS_OP_N;
+
+        CHECK_HIPBLAS_ERROR(hipblasSgemm(handle,
+                                         op,
+                                         HIPBLAS_OP_N,
+                                         m,
+                                         n,
+                                         n,
+                                         &alpha,
+                                         A,
+                                         ld,
+                                         dB + i * size,
+                                         ld,
+                                         &beta,
+                                         dC + i * size,
+                                         ld));
+        ref_gemm<float>(op,
+                        HIPBLAS_OP_N,
+                        m,
+                        n,
+                        n,
+                        alpha,
+                        const_cast<float*>(hA_i),
+                        ld,
+                        hB.data() + i * size,
+                        ld,
+                        beta,
+                        hC_gold.data() + i * size,
+                        ld);
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasEndBatch(handle));
+
+    CHECK_HIP_ERROR(hC.transfer_from(dC));
+    unit_check_general<float>(ld, n * gemms, ld, hC_gold, hC);
+
+    // a scal of C folded into the beta of the next gemm, and two axpys of the same x and y folded
+    // into one. The matrices hold small integers, so that folding doesn't change the results.
+    const float scale = 0.5f, gamma = 4;
+    CHECK_HIPBLAS_ERROR(hipblasBeginBatch(handle));
+    CHECK_HIPBLAS_ERROR(hipblasSscal(handle, size, &scale, dC, 1));
+    CHECK_HIPBLAS_ERROR(hipblasSgemm(
+        handle, HIPBLAS_OP_N, HIPBLAS_OP_N, n, n, n, &alpha, dA, ld, dB, ld, &beta, dC, ld));
+    CHECK_HIPBLAS_ERROR(hipblasSaxpy(handle, size, &gamma, dA, 1, dC + size, 1));
+    CHECK_HIPBLAS_ERROR(hipblasSaxpy(handle, size, &scale, dA, 1, dC + size, 1));
+    CHECK_HIPBLAS_ERROR(hipblasEndBatch(handle));
+
+    ref_scal<float>(size, scale, hC_gold.data(), 1);
+    ref_gemm<float>(HIPBLAS_OP_N,
+                    HIPBLAS_OP_N,
+                    n,
+                    n,
+                    n,
+                    alpha,
+                    hA.data(),
+                    ld,
+                    hB.data(),
+                    ld,
+                    beta,
+                    hC_gold.data(),
+                    ld);
+    ref_axpy<float>(size, gamma, hA.data(), 1, hC_gold.data() + size, 1);
+    ref_axpy<float>(size, scale, hA.data(), 1, hC_gold.data() + size, 1);
+
+    CHECK_HIP_ERROR(hC.transfer_from(dC));
+    unit_check_general<float>(ld, n * gemms, ld, hC_gold, hC);
+}
@@ -0,0 +1,178 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_dist_gemm(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_dist_gemm(const Arguments& arg)
+{
+    // a single process grid, on which the local parts are the matrices, with blocks that
+    // aren't multiples of the sizes so that edge blocks and panels are run
+    const int M = 70, N = 45, K = 52, MB = 16, NB = 8, KB = 12, lda = M, ldb = K, ldc = M + 3;
+
+    hipblasLocalHandle handle(arg);
+    hipblasDistGrid_t  grid;
+    int                nprow, npcol, myrow, mycol;
+    int64_t            local_rows, local_cols;
+    const float        alpha = 2, beta = 3;
+
+    EXPECT_HIPBLAS_STATUS(hipblasDistGridCreate(nullptr, nullptr, 1, 1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasDistGridCreate(&grid, nullptr, 2, 1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasDistGridCreate(&grid, nullptr, 1, 1));
+
+    CHECK_HIPBLAS_ERROR(hipblasDistGridGetInfo(grid, &nprow, &npcol, &myrow, &mycol));
+    EXPECT_EQ(nprow, 1);
+    EXPECT_EQ(npcol, 1);
+    EXPECT_EQ(myrow, 0);
+    EXPECT_EQ(mycol, 0);
+
+    CHECK_HIPBLAS_ERROR(
+        hipblasDistGridGetLocalSize(grid, M, K, MB, KB, &local_rows, &local_cols));
+    EXPECT_EQ(local_rows, M);
+    EXPECT_EQ(local_cols, K);
+
+    host_vector<float> hA(size_t(lda) * K), hB(size_t(ldb) * N), hC(size_t(ldc) * N);
+    hipblas_init<float>(hA, M, K, lda);
+    hipblas_init<float>(hB, K, N, ldb);
+    hipblas_init<float>(hC, M, N, ldc);
+    host_vector<float> hC_gold = hC;
+    host_vector<float> hC_device(size_t(ldc) * N);
+
+    device_vector<float> dA(size_t(lda) * K), dB(size_t(ldb) * N), dC(size_t(ldc) * N);
+    device_vector<float> d_alpha(1), d_beta(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(float), hipMemcpyHostToDevice));
+
+    hipblasDistMatrix_t A, B, C, C_bad;
+    EXPECT_HIPBLAS_STATUS(
+        hipblasDistMatrixCreate(&A, grid, M, K, MB, KB, HIP_R_32F, dA, M - 1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasDistMatrixCreate(&A, grid, M, K, MB, KB, HIP_R_32F, dA, lda));
+    CHECK_HIPBLAS_ERROR(hipblasDistMatrixCreate(&B, grid, K, N, KB, NB, HIP_R_32F, dB, ldb));
+    CHECK_HIPBLAS_ERROR(hipblasDistMatrixCreate(&C, grid, M, N, MB, NB, HIP_R_32F, dC, ldc));
+
+    // the blocks of C must match those of A and B
+    CHECK_HIPBLAS_ERROR(
+        hipblasDistMatrixCreate(&C_bad, grid, M, N, MB + 1, NB, HIP_R_32F, dC, ldc));
+    EXPECT_HIPBLAS_STATUS(hipblasDistGemm(handle, &alpha, A, B, &beta, C_bad, HIPBLAS_COMPUTE_32F),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasDistMatrixDestroy(C_bad));
+
+    ref_gemm<float>(HIPBLAS_OP_N,
+                    HIPBLAS_OP_N,
+                    M,
+                    N,
+                    K,
+                    alpha,
+                    hA.data(),
+                    lda,
+                    hB.data(),
+                    ldb,
+                    beta,
+                    hC_gold.data(),
+                    ldc);
+
+    for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
+    {
+        bool host = pointer_mode == HIPBLAS_POINTER_MODE_HOST;
+
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, pointer_mode));
+        CHECK_HIPBLAS_ERROR(hipblasDistGemm(handle,
+                                            host ? &alpha : d_alpha,
+                                            A,
+                                            B,
+                                            host ? &beta : d_beta,
+                                            C,
+                                            HIPBLAS_COMPUTE_32F));
+        CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+        unit_check_general<float>(M, N, ldc, hC_gold, hC_device);
+    }
+
+    // on a single process grid the all-reduce of hipblasGemmExAllReduce leaves C as it is
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExAllReduce(handle,
+                                                 nullptr,
+                                                 HIPBLAS_OP_N,
+                                                 HIPBLAS_OP_N,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 &alpha,
+                                                 dA,
+                                                 HIP_R_32F,
+                                                 lda,
+                                                 dB,
+                                                 HIP_R_32F,
+                                                 ldb,
+                                                 &beta,
+                                                 dC,
+                                                 HIP_R_32F,
+                                                 ldc,
+                                                 HIPBLAS_COMPUTE_32F,
+                                                 HIPBLAS_GEMM_DEFAULT),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasGemmExAllReduce(handle,
+                                               grid,
+                                               HIPBLAS_OP_N,
+                                               HIPBLAS_OP_N,
+                                               M,
+                                               N,
+                                               K,
+                                               &alpha,
+                                               dA,
+                                               HIP_R_32F,
+                                               lda,
+                                               dB,
+                                               HIP_R_32F,
+                                               ldb,
+                                               &beta,
+                                               dC,
+                                               HIP_R_32F,
+                                               ldc,
+                                               HIPBLAS_COMPUTE_32F,
+                                               HIPBLAS_GEMM_DEFAULT));
+    CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+    unit_check_general<float>(M, N, ldc, hC_gold, hC_device);
+
+    CHECK_HIPBLAS_ERROR(hipblasDistMatrixDestroy(A));
+    CHECK_HIPBLAS_ERROR(hipblasDistMatrixDestroy(B));
+    CHECK_HIPBLAS_ERROR(hipblasDistMatrixDestroy(C));
+    CHECK_HIPBLAS_ERROR(hipblasDistGridDestroy(grid));
+}
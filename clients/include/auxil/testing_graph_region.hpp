@@ -0,0 +1,69 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_graph_region(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_graph_region(const Arguments& arg)
+{
+    // the region is run on x0 and y0, then on x1 and y1, which only updates the cached graph
+    const int   n     = 1000;
+    const float alpha = 3;
+
+    hipblasLocalHandle handle(arg);
+
+    EXPECT_HIPBLAS_STATUS(hipblasBeginRegion(nullptr, 1), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasEndRegion(handle), HIPBLAS_STATUS_INVALID_VALUE);
+
+    host_vector<float> hx(2 * n), hy(2 * n), hy_gold(2 * n);
+    hipblas_init<float>(hx, 1, 2 * n, 1);
+    hipblas_init<float>(hy, 1, 2 * n, 1);
+    hy_gold = hy;
+
+    device_vector<float> dx(2 * n), dy(2 * n);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    for(int i = 0; i < 2; i++)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasBeginRegion(handle, 1));
+        EXPECT_HIPBLAS_STATUS(hipblasBeginRegion(handle, 1), HIPBLAS_STATUS_INVALID_VALUE);
+        CHECK_HIPBLAS_ERROR(hipblasSaxpy(handle, n, &alpha, dx + i * n, 1, dy + i * n, 1));
+        CHECK_HIPBLAS_ERROR(hipblasSscal(handle, n, &alpha, dy + i * n, 1));
+        CHECK_HIPBLAS_ERROR(hipblasEndRegion(handle));
+
+        ref_axpy<float>(n, alpha, hx.data() + i * n, 1, hy_gold.data() + i * n, 1);
+        ref_scal<float>(n, alpha, hy_gold.data() + i * n, 1);
+    }
+
+    CHECK_HIP_ERROR(hy.transfer_from(dy));
+    unit_check_general<float>(1, 2 * n, 1, hy_gold, hy);
+}
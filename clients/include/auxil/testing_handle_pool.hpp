@@ -0,0 +1,241 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_common.hpp"
+
+#include <thread>
+
+/* ============================================================================================ */
+
+inline void testname_handle_pool(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_handle_pool(const Arguments& arg)
+{
+    int device;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+
+    hipblasHandlePool_t pool;
+    hipblasHandle_t     handle, handle2;
+
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolCreate(nullptr, device, 1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolCreate(&pool, device, -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolCreate(&pool, -1, 1), HIPBLAS_STATUS_INVALID_VALUE);
+
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolCreate(&pool, device, 1));
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolAcquire(pool, stream, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolAcquire(pool, stream, &handle));
+
+    hipStream_t handle_stream;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &handle_stream));
+    EXPECT_EQ(handle_stream, stream);
+
+    // the pool grows when all of its handles are in use
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolAcquire(pool, 0, &handle2));
+    EXPECT_NE(handle, handle2);
+
+    // a pool with acquired handles can't be destroyed
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolDestroy(pool), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // the modes set by the user of a handle are reset when it is released
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(hipblasSetBatchLayout(handle, HIPBLAS_BATCH_LAYOUT_INTERLEAVED));
+
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolRelease(pool, handle));
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolRelease(pool, handle), HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolRelease(pool, handle2));
+
+    // the released handles are handed out again, set to the new stream and with the default modes
+    hipblasHandle_t handle1 = handle, handle3;
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolAcquire(pool, 0, &handle));
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolAcquire(pool, 0, &handle3));
+    EXPECT_TRUE(handle == handle1 || handle == handle2);
+    EXPECT_TRUE(handle3 == handle1 || handle3 == handle2);
+    for(hipblasHandle_t h : {handle, handle3})
+    {
+        hipblasPointerMode_t pointer_mode;
+        hipblasBatchLayout_t batch_layout;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(h, &handle_stream));
+        CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(h, &pointer_mode));
+        CHECK_HIPBLAS_ERROR(hipblasGetBatchLayout(h, &batch_layout));
+        EXPECT_EQ(handle_stream, hipStream_t(0));
+        EXPECT_EQ(pointer_mode, HIPBLAS_POINTER_MODE_HOST);
+        EXPECT_EQ(batch_layout, HIPBLAS_BATCH_LAYOUT_STRIDED);
+    }
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolRelease(pool, handle));
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolRelease(pool, handle3));
+
+    // a stream of another device is rejected
+    int device_count;
+    CHECK_HIP_ERROR(hipGetDeviceCount(&device_count));
+    if(device_count > 1)
+    {
+        hipStream_t other_stream;
+        CHECK_HIP_ERROR(hipSetDevice((device + 1) % device_count));
+        CHECK_HIP_ERROR(hipStreamCreate(&other_stream));
+        CHECK_HIP_ERROR(hipSetDevice(device));
+        EXPECT_HIPBLAS_STATUS(hipblasHandlePoolAcquire(pool, other_stream, &handle),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        CHECK_HIP_ERROR(hipStreamDestroy(other_stream));
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolDestroy(pool));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+
+    // a thread gets the same handle from each call, and another thread gets its own
+    EXPECT_HIPBLAS_STATUS(hipblasGetThreadLocalHandle(device, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGetThreadLocalHandle(-1, &handle), HIPBLAS_STATUS_INVALID_VALUE);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetThreadLocalHandle(device, &handle));
+    CHECK_HIPBLAS_ERROR(hipblasGetThreadLocalHandle(device, &handle2));
+    EXPECT_EQ(handle, handle2);
+
+    hipblasStatus_t other_status;
+    std::thread([&]() {
+        other_status = hipblasGetThreadLocalHandle(device, &handle2);
+        if(other_status == HIPBLAS_STATUS_SUCCESS)
+            other_status = hipblasGetStream(handle2, &handle_stream);
+    }).join();
+    CHECK_HIPBLAS_ERROR(other_status);
+    EXPECT_NE(handle, handle2);
+
+    // a stream bound to a shared handle applies to the calls of the binding thread only
+    hipblasLocalHandle shared(arg);
+    hipStream_t        shared_stream, thread_stream;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(shared, &shared_stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(shared, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetStreamForThread(nullptr, stream),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetStreamForThread(shared, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetStreamForThread(shared, stream));
+    CHECK_HIPBLAS_ERROR(hipblasGetStreamForThread(shared, &thread_stream));
+    EXPECT_EQ(thread_stream, stream);
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(shared, &handle_stream));
+    EXPECT_EQ(handle_stream, shared_stream);
+
+    std::thread([&]() {
+        other_status = hipblasGetStreamForThread(shared, &handle_stream);
+    }).join();
+    CHECK_HIPBLAS_ERROR(other_status);
+    EXPECT_EQ(handle_stream, shared_stream);
+
+    // a call with the shared handle is queued on the bound stream
+    const int            N     = 64;
+    const float          alpha = 2.0f;
+    host_vector<float>   hx(N);
+    device_vector<float> dx(N, 1);
+    for(int i = 0; i < N; i++)
+        hx[i] = float(i);
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(float) * N, hipMemcpyHostToDevice));
+    CHECK_HIPBLAS_ERROR(hipblasSscal(shared, N, &alpha, dx, 1));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(hipMemcpy(hx, dx, sizeof(float) * N, hipMemcpyDeviceToHost));
+    for(int i = 0; i < N; i++)
+        EXPECT_EQ(hx[i], alpha * i);
+
+    CHECK_HIPBLAS_ERROR(hipblasResetStreamForThread(shared));
+    CHECK_HIPBLAS_ERROR(hipblasGetStreamForThread(shared, &thread_stream));
+    EXPECT_EQ(thread_stream, shared_stream);
+    CHECK_HIPBLAS_ERROR(hipblasResetStreamForThread(shared));
+
+    // a function built on other hipBLAS functions runs them all on the bound stream, and switches
+    // the pointer mode of the handle of the thread for its inner calls, not that of the shared one
+    const int             M       = 32;
+    const double          h_alpha = 2.0, h_beta = 0.5;
+    host_vector<double>   hA(M * M), hB(M * M), hC(M * M), hC_bound(M * M), hC_shared(M * M);
+    device_vector<double> dA(M * M), dB(M * M), dC(M * M), d_alpha(1), d_beta(1);
+    for(int i = 0; i < M * M; i++)
+    {
+        hA[i] = double(i % 7 - 3) / 8;
+        hB[i] = double(i % 5 - 2) / 4;
+        hC[i] = double(i % 3);
+    }
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(double) * M * M, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(double) * M * M, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(double), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(double), hipMemcpyHostToDevice));
+
+    // the emulated gemm switches to host pointer mode for its int8 gemms
+    auto emulated = [&](hipStream_t call_stream, host_vector<double>& result) {
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(double) * M * M, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasDgemmEmulated(
+            shared, HIPBLAS_OP_N, HIPBLAS_OP_T, M, M, M, d_alpha, dA, M, dB, M, d_beta, dC, M, 8));
+        CHECK_HIP_ERROR(hipStreamSynchronize(call_stream));
+        CHECK_HIP_ERROR(hipMemcpy(result, dC, sizeof(double) * M * M, hipMemcpyDeviceToHost));
+    };
+
+    hipblasPointerMode_t pointer_mode;
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(shared, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(hipblasSetStreamForThread(shared, stream));
+    emulated(stream, hC_bound);
+    CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(shared, &pointer_mode));
+    EXPECT_EQ(pointer_mode, HIPBLAS_POINTER_MODE_DEVICE);
+    CHECK_HIPBLAS_ERROR(hipblasResetStreamForThread(shared));
+
+    emulated(shared_stream, hC_shared);
+    unit_check_general<double>(M, M, M, hC_shared, hC_bound);
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+
+    // handles created from a parent share its workspace, and calls on their streams are ordered
+    hipblasHandle_t parent, child;
+    size_t          parent_size, child_size;
+    EXPECT_HIPBLAS_STATUS(hipblasCreateWithSharedWorkspace(nullptr, nullptr),
+                          HIPBLAS_STATUS_HANDLE_IS_NULLPTR);
+    CHECK_HIPBLAS_ERROR(hipblasCreate(&parent));
+    CHECK_HIPBLAS_ERROR(hipblasCreateWithSharedWorkspace(&child, parent));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceSize(parent, &parent_size));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceSize(child, &child_size));
+    EXPECT_EQ(parent_size, child_size);
+    EXPECT_GT(child_size, size_t(0));
+
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(child, stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(parent, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(child, HIPBLAS_POINTER_MODE_HOST));
+    for(int i = 0; i < N; i++)
+        hx[i] = float(i);
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(float) * N, hipMemcpyHostToDevice));
+    CHECK_HIPBLAS_ERROR(hipblasSscal(parent, N, &alpha, dx, 1));
+    CHECK_HIPBLAS_ERROR(hipblasSscal(child, N, &alpha, dx, 1));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(hipMemcpy(hx, dx, sizeof(float) * N, hipMemcpyDeviceToHost));
+    for(int i = 0; i < N; i++)
+        EXPECT_EQ(hx[i], alpha * alpha * i);
+
+    CHECK_HIPBLAS_ERROR(hipblasDestroy(parent));
+    CHECK_HIPBLAS_ERROR(hipblasDestroy(child));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
@@ -0,0 +1,137 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_optimal_leading_dimension(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_optimal_leading_dimension(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+
+    int64_t ld = 0;
+    void*   ptr;
+
+    EXPECT_HIPBLAS_STATUS(hipblasGetOptimalLeadingDimension(nullptr, 16, HIP_R_32F, &ld),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetOptimalLeadingDimension(handle, -1, HIP_R_32F, &ld),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGetOptimalLeadingDimension(handle, 16, HIP_R_32F, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetOptimalLeadingDimension(handle, 16, static_cast<hipDataType>(-1), &ld),
+        HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasMallocMatrix(-1, 16, HIP_R_32F, &ptr, &ld),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasMallocMatrix(16, -1, HIP_R_32F, &ptr, &ld),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasMallocMatrix(16, 16, HIP_R_32F, nullptr, &ld),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasMallocMatrix(16, 16, HIP_R_32F, &ptr, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasMallocMatrix(16, 16, static_cast<hipDataType>(-1), &ptr, &ld),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // columns of less than a 128 byte line are left as they are, the others are rounded up to
+    // whole lines and get one more line when they are a multiple of 1 KiB
+    struct
+    {
+        int64_t     rows;
+        hipDataType type;
+        int64_t     ld;
+    } cases[] = {
+        {0, HIP_R_32F, 1},
+        {1, HIP_R_32F, 1},
+        {31, HIP_R_32F, 31},
+        {32, HIP_R_32F, 32},
+        {33, HIP_R_32F, 64},
+        {100, HIP_R_32F, 128},
+        {256, HIP_R_32F, 288},
+        {1024, HIP_R_32F, 1056},
+        {1000, HIP_R_64F, 1008},
+        {1024, HIP_R_16F, 1088},
+        {2048, HIP_R_8I, 2176},
+        {64, HIP_C_64F, 72},
+    };
+    for(const auto& c : cases)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasGetOptimalLeadingDimension(handle, c.rows, c.type, &ld));
+        EXPECT_EQ(ld, c.ld) << "rows " << c.rows << ", type " << c.type;
+    }
+
+    std::pair<hipDataType, int64_t> types[] = {{HIP_R_8I, 1},
+                                               {HIP_R_16F, 2},
+                                               {HIP_R_32F, 4},
+                                               {HIP_R_64F, 8},
+                                               {HIP_C_32F, 8},
+                                               {HIP_C_64F, 16}};
+    for(auto [type, size] : types)
+    {
+        for(int64_t rows = 0; rows <= 4096; rows++)
+        {
+            CHECK_HIPBLAS_ERROR(hipblasGetOptimalLeadingDimension(handle, rows, type, &ld));
+            int64_t bytes = ld * size;
+            ASSERT_GE(ld, std::max<int64_t>(rows, 1));
+            if(rows * size < 128)
+            {
+                ASSERT_EQ(ld, std::max<int64_t>(rows, 1));
+                continue;
+            }
+            ASSERT_EQ(bytes % 128, 0);
+            ASSERT_NE(bytes % 1024, 0);
+            ASSERT_LE(bytes, rows * size + 2 * 128);
+        }
+    }
+
+    // the allocation takes the advised leading dimension and holds all of the columns
+    const int64_t rows = 256, cols = 33;
+    int64_t       advised;
+    CHECK_HIPBLAS_ERROR(hipblasGetOptimalLeadingDimension(handle, rows, HIP_R_32F, &advised));
+    CHECK_HIPBLAS_ERROR(hipblasMallocMatrix(rows, cols, HIP_R_32F, &ptr, &ld));
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_EQ(ld, advised);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 256, 0u);
+
+    host_matrix<float> hA(rows, cols, ld);
+    host_matrix<float> hB(rows, cols, ld);
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    CHECK_HIP_ERROR(hipMemcpy(ptr, hA, sizeof(float) * ld * cols, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(hB, ptr, sizeof(float) * ld * cols, hipMemcpyDeviceToHost));
+    unit_check_general<float>(rows, cols, ld, hA, hB);
+    CHECK_HIP_ERROR(hipFree(ptr));
+
+    // empty matrices aren't allocated
+    ptr = &ld;
+    CHECK_HIPBLAS_ERROR(hipblasMallocMatrix(0, cols, HIP_R_32F, &ptr, &ld));
+    EXPECT_EQ(ptr, nullptr);
+    EXPECT_EQ(ld, 1);
+    ptr = &ld;
+    CHECK_HIPBLAS_ERROR(hipblasMallocMatrix(rows, 0, HIP_R_32F, &ptr, &ld));
+    EXPECT_EQ(ptr, nullptr);
+    EXPECT_EQ(ld, advised);
+}
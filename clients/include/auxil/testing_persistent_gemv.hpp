@@ -0,0 +1,86 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_persistent_gemv(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_persistent_gemv(const Arguments& arg)
+{
+    // a chain of gemvs, each reading the y of the one before, alternately with A and A^T, with a
+    // queue shorter than the chain so that calls wait for room
+    const int   n = 64, lda = 70, calls = 12, queue = 4;
+    const float alpha = 1.0f / 64, beta = 1;
+
+    hipblasLocalHandle handle(arg);
+
+    EXPECT_HIPBLAS_STATUS(hipblasPersistentStart(nullptr, queue), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasPersistentStart(handle, 0), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasPersistentStop(handle), HIPBLAS_STATUS_INVALID_VALUE);
+
+    host_vector<float> hA(lda * n), hy((calls + 1) * n), hy_gold((calls + 1) * n);
+    hipblas_init<float>(hA, n, n, lda);
+    hipblas_init<float>(hy, 1, (calls + 1) * n, 1);
+    hy_gold = hy;
+
+    device_vector<float> dA(lda * n), dy((calls + 1) * n);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasPersistentStart(handle, queue));
+    EXPECT_HIPBLAS_STATUS(hipblasPersistentStart(handle, queue), HIPBLAS_STATUS_INVALID_VALUE);
+
+    for(int i = 0; i < calls; i++)
+    {
+        hipblasOperation_t trans = i % 2 ? HIPBLAS_OP_T : HIPBLAS_OP_N;
+        CHECK_HIPBLAS_ERROR(hipblasSgemv(
+            handle, trans, n, n, &alpha, dA, lda, dy + i * n, 1, &beta, dy + (i + 1) * n, 1));
+        ref_gemv<float>(trans,
+                        n,
+                        n,
+                        alpha,
+                        hA.data(),
+                        lda,
+                        hy_gold.data() + i * n,
+                        1,
+                        beta,
+                        hy_gold.data() + (i + 1) * n,
+                        1);
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasPersistentSynchronize(handle));
+    CHECK_HIPBLAS_ERROR(hipblasPersistentStop(handle));
+
+    // the sums of the kernel aren't in the order of the reference
+    CHECK_HIP_ERROR(hy.transfer_from(dy));
+    double error = norm_check_general<float>('F', 1, (calls + 1) * n, 1, hy_gold, hy);
+    EXPECT_LE(error, n * calls * std::numeric_limits<float>::epsilon());
+}
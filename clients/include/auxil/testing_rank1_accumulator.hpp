@@ -0,0 +1,84 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_rank1_accumulator(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_rank1_accumulator(const Arguments& arg)
+{
+    // five updates with a capacity of two, so that two flushes are made by adds and one by the
+    // destroy. The vectors hold small integers, so that the results are exact.
+    const int n = 16, lda = 20, updates = 5, capacity = 2;
+
+    hipblasLocalHandle        handle(arg);
+    hipblasRank1Accumulator_t acc;
+
+    EXPECT_HIPBLAS_STATUS(hipblasRank1AccumulatorCreate(
+                              nullptr, HIPBLAS_RANK1_GER, HIP_R_32F, HIPBLAS_FILL_MODE_UPPER, n, n,
+                              nullptr, lda, capacity, &acc),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    host_vector<float> hx(n * updates), hy(n * updates), hA(lda * n), hA_gold(lda * n);
+    hipblas_init<float>(hx, 1, n * updates, 1);
+    hipblas_init<float>(hy, 1, n * updates, 1);
+
+    device_vector<float> dx(n * updates), dy(n * updates), dA(lda * n);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    for(hipblasRank1Update_t update : {HIPBLAS_RANK1_GER, HIPBLAS_RANK1_SYR})
+    {
+        hipblas_init<float>(hA, n, n, lda);
+        hA_gold = hA;
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+        CHECK_HIPBLAS_ERROR(hipblasRank1AccumulatorCreate(
+            handle, update, HIP_R_32F, HIPBLAS_FILL_MODE_LOWER, n, n, dA, lda, capacity, &acc));
+        EXPECT_HIPBLAS_STATUS(hipblasRank1AccumulatorAdd(acc, nullptr, dx, 1, dy, 1),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+        for(int i = 0; i < updates; i++)
+        {
+            float alpha = float(i - 2);
+            CHECK_HIPBLAS_ERROR(
+                hipblasRank1AccumulatorAdd(acc, &alpha, dx + i * n, 1, dy + i * n, 1));
+            float* x = hx.data() + i * n;
+            if(update == HIPBLAS_RANK1_GER)
+                ref_ger<float, false>(n, n, alpha, x, 1, hy.data() + i * n, 1, hA_gold, lda);
+            else
+                ref_syr<float>(HIPBLAS_FILL_MODE_LOWER, n, alpha, x, 1, hA_gold, lda);
+        }
+        CHECK_HIPBLAS_ERROR(hipblasRank1AccumulatorDestroy(acc));
+
+        CHECK_HIP_ERROR(hA.transfer_from(dA));
+        unit_check_general<float>(n, n, lda, hA_gold, hA);
+    }
+}
@@ -0,0 +1,145 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_batch_layout(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_set_get_batch_layout(const Arguments& arg)
+{
+    hipblasBatchLayout_t layout = HIPBLAS_BATCH_LAYOUT_INTERLEAVED;
+
+    hipblasLocalHandle handle(arg);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetBatchLayout(nullptr, HIPBLAS_BATCH_LAYOUT_INTERLEAVED),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetBatchLayout(nullptr, &layout), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetBatchLayout(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetBatchLayout(handle, hipblasBatchLayout_t(2)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetBatchLayout(handle, &layout));
+    EXPECT_EQ(layout, HIPBLAS_BATCH_LAYOUT_STRIDED);
+
+    // a batch of tiny gemms in the strided layout, then the same gemms interleaved and converted
+    // back. The sums of small integers are exact.
+    const int     M = 4, N = 3, K = 5, batch = 37;
+    hipblasStride stride_A = M * K, stride_B = K * N, stride_C = M * N;
+
+    host_vector<float>   hA(stride_A * batch), hB(stride_B * batch), hC(stride_C * batch);
+    host_vector<float>   hC_gold(stride_C * batch), hC_interleaved(stride_C * batch);
+    device_vector<float> dA(stride_A * batch), dB(stride_B * batch), dC(stride_C * batch);
+    device_vector<float> dA_i(stride_A * batch), dB_i(stride_B * batch), dC_i(stride_C * batch);
+    for(size_t i = 0; i < hA.size(); i++)
+        hA[i] = float(i % 7) - 3;
+    for(size_t i = 0; i < hB.size(); i++)
+        hB[i] = float(i % 5) - 2;
+    for(size_t i = 0; i < hC.size(); i++)
+        hC[i] = float(i % 3);
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+
+    const float alpha = 2, beta = -1;
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    auto gemm = [&](float*        A,
+                    float*        B,
+                    float*        C,
+                    hipblasStride s_A,
+                    hipblasStride s_B,
+                    hipblasStride s_C) {
+        CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedEx_v2(handle,
+                                                           HIPBLAS_OP_N,
+                                                           HIPBLAS_OP_N,
+                                                           M,
+                                                           N,
+                                                           K,
+                                                           &alpha,
+                                                           A,
+                                                           HIP_R_32F,
+                                                           M,
+                                                           s_A,
+                                                           B,
+                                                           HIP_R_32F,
+                                                           K,
+                                                           s_B,
+                                                           &beta,
+                                                           C,
+                                                           HIP_R_32F,
+                                                           M,
+                                                           s_C,
+                                                           batch,
+                                                           HIPBLAS_COMPUTE_32F,
+                                                           HIPBLAS_GEMM_DEFAULT));
+    };
+
+    gemm(dA, dB, dC, stride_A, stride_B, stride_C);
+    CHECK_HIP_ERROR(hC_gold.transfer_from(dC));
+
+    // in the interleaved layout element (i, j) of matrix b is at b + (i + j * ld) * batch. With a
+    // stream, the interleaved gemm is made with it bound to handle for the thread.
+    auto interleaved_gemm = [&](hipStream_t stream) {
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        CHECK_HIPBLAS_ERROR(hipblasInterleaveBatch(
+            handle, M, K, HIP_R_32F, dA, M, stride_A, dA_i, M, batch, batch));
+        CHECK_HIPBLAS_ERROR(hipblasInterleaveBatch(
+            handle, K, N, HIP_R_32F, dB, K, stride_B, dB_i, K, batch, batch));
+        CHECK_HIPBLAS_ERROR(hipblasInterleaveBatch(
+            handle, M, N, HIP_R_32F, dC, M, stride_C, dC_i, M, batch, batch));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetBatchLayout(handle, HIPBLAS_BATCH_LAYOUT_INTERLEAVED));
+        CHECK_HIPBLAS_ERROR(hipblasGetBatchLayout(handle, &layout));
+        EXPECT_EQ(layout, HIPBLAS_BATCH_LAYOUT_INTERLEAVED);
+        if(stream)
+        {
+            CHECK_HIPBLAS_ERROR(hipblasSetStreamForThread(handle, stream));
+        }
+        gemm(dA_i, dB_i, dC_i, batch, batch, batch);
+        if(stream)
+        {
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+            CHECK_HIPBLAS_ERROR(hipblasResetStreamForThread(handle));
+        }
+        CHECK_HIPBLAS_ERROR(hipblasSetBatchLayout(handle, HIPBLAS_BATCH_LAYOUT_STRIDED));
+
+        CHECK_HIPBLAS_ERROR(hipblasDeinterleaveBatch(
+            handle, M, N, HIP_R_32F, dC_i, M, batch, dC, M, stride_C, batch));
+        CHECK_HIP_ERROR(hC_interleaved.transfer_from(dC));
+        for(size_t i = 0; i < hC_interleaved.size(); i++)
+            EXPECT_EQ(hC_interleaved[i], hC_gold[i]);
+    };
+
+    interleaved_gemm(nullptr);
+
+    // the handle of the thread takes the layout of handle when the stream is bound
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    interleaved_gemm(stream);
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
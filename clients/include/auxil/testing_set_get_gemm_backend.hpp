@@ -0,0 +1,136 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_gemm_backend(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_set_get_gemm_backend(const Arguments& arg)
+{
+    hipblasGemmBackend_t backend = HIPBLAS_GEMM_BACKEND_LT;
+
+    hipblasLocalHandle handle(arg);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetGemmBackend(nullptr, HIPBLAS_GEMM_BACKEND_LT),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetGemmBackend(nullptr, &backend),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetGemmBackend(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetGemmBackend(handle, hipblasGemmBackend_t(2)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    // the default is HIPBLAS_GEMM_BACKEND_LT when HIPBLAS_GEMM_BACKEND=lt
+    const char* env = getenv("HIPBLAS_GEMM_BACKEND");
+    CHECK_HIPBLAS_ERROR(hipblasGetGemmBackend(handle, &backend));
+    EXPECT_EQ(backend,
+              env && !strcmp(env, "lt") ? HIPBLAS_GEMM_BACKEND_LT : HIPBLAS_GEMM_BACKEND_DEFAULT);
+
+    // the same gemms in both modes, run twice in HIPBLAS_GEMM_BACKEND_LT mode so the second finds
+    // the algorithm cached. The sums of small integers are exact.
+    const int M = 96, N = 64, K = 48, batch = 2;
+    size_t    size_A = size_t(M) * K, size_B = size_t(K) * N, size_C = size_t(M) * N;
+
+    host_vector<float>   hA(size_A * batch), hB(size_B * batch), hC(size_C * batch);
+    host_vector<float>   hC_gold(size_C * batch), hC_lt(size_C * batch);
+    device_vector<float> dA(size_A * batch), dB(size_B * batch), dC(size_C * batch);
+    for(size_t i = 0; i < hA.size(); i++)
+        hA[i] = float(i % 7) - 3;
+    for(size_t i = 0; i < hB.size(); i++)
+        hB[i] = float(i % 5) - 2;
+    for(size_t i = 0; i < hC.size(); i++)
+        hC[i] = float(i % 3);
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    const float alpha = 2, beta = -1;
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    auto gemm = [&](host_vector<float>& hD) {
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        CHECK_HIPBLAS_ERROR(hipblasGemmEx_v2(handle,
+                                             HIPBLAS_OP_N,
+                                             HIPBLAS_OP_N,
+                                             M,
+                                             N,
+                                             K,
+                                             &alpha,
+                                             dA,
+                                             HIP_R_32F,
+                                             M,
+                                             dB,
+                                             HIP_R_32F,
+                                             K,
+                                             &beta,
+                                             dC,
+                                             HIP_R_32F,
+                                             M,
+                                             HIPBLAS_COMPUTE_32F,
+                                             HIPBLAS_GEMM_DEFAULT));
+        CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedEx_v2(handle,
+                                                           HIPBLAS_OP_T,
+                                                           HIPBLAS_OP_N,
+                                                           N,
+                                                           N,
+                                                           K,
+                                                           &alpha,
+                                                           dB,
+                                                           HIP_R_32F,
+                                                           K,
+                                                           size_B,
+                                                           dB,
+                                                           HIP_R_32F,
+                                                           K,
+                                                           size_B,
+                                                           &beta,
+                                                           dC,
+                                                           HIP_R_32F,
+                                                           M,
+                                                           size_C,
+                                                           batch,
+                                                           HIPBLAS_COMPUTE_32F,
+                                                           HIPBLAS_GEMM_DEFAULT));
+        CHECK_HIP_ERROR(hD.transfer_from(dC));
+    };
+
+    CHECK_HIPBLAS_ERROR(hipblasSetGemmBackend(handle, HIPBLAS_GEMM_BACKEND_DEFAULT));
+    gemm(hC_gold);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetGemmBackend(handle, HIPBLAS_GEMM_BACKEND_LT));
+    CHECK_HIPBLAS_ERROR(hipblasGetGemmBackend(handle, &backend));
+    EXPECT_EQ(backend, HIPBLAS_GEMM_BACKEND_LT);
+    for(int run = 0; run < 2; run++)
+    {
+        gemm(hC_lt);
+        for(size_t i = 0; i < hC_lt.size(); i++)
+            EXPECT_EQ(hC_lt[i], hC_gold[i]);
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasSetGemmBackend(handle, HIPBLAS_GEMM_BACKEND_DEFAULT));
+    CHECK_HIPBLAS_ERROR(hipblasGetGemmBackend(handle, &backend));
+    EXPECT_EQ(backend, HIPBLAS_GEMM_BACKEND_DEFAULT);
+}
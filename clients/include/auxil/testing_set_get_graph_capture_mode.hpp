@@ -0,0 +1,89 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_graph_capture_mode(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_set_get_graph_capture_mode(const Arguments& arg)
+{
+    int   N     = 64;
+    float alpha = 1.0f, beta = 0.0f;
+
+    hipblasGraphCaptureMode_t mode = HIPBLAS_GRAPH_CAPTURE_SAFE;
+
+    hipblasLocalHandle handle(arg);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetGraphCaptureMode(nullptr, HIPBLAS_GRAPH_CAPTURE_SAFE),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetGraphCaptureMode(nullptr, &mode),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetGraphCaptureMode(handle, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetGraphCaptureMode(handle, hipblasGraphCaptureMode_t(2)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetGraphCaptureMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_GRAPH_CAPTURE_DEFAULT);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetGraphCaptureMode(handle, HIPBLAS_GRAPH_CAPTURE_SAFE));
+    CHECK_HIPBLAS_ERROR(hipblasGetGraphCaptureMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_GRAPH_CAPTURE_SAFE);
+
+    // a call captured in safe mode replays from the graph
+    device_matrix<float> dA(N, N, N);
+    device_matrix<float> dB(N, N, N);
+    device_matrix<float> dC(N, N, N);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+    hipStream_t    stream;
+    hipGraph_t     graph;
+    hipGraphExec_t graph_exec;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    CHECK_HIP_ERROR(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    EXPECT_HIPBLAS_STATUS(
+        hipblasSgemm(
+            handle, HIPBLAS_OP_N, HIPBLAS_OP_N, N, N, N, &alpha, dA, N, dB, N, &beta, dC, N),
+        HIPBLAS_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipStreamEndCapture(stream, &graph));
+
+    CHECK_HIP_ERROR(hipGraphInstantiate(&graph_exec, graph, nullptr, nullptr, 0));
+    CHECK_HIP_ERROR(hipGraphLaunch(graph_exec, stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    CHECK_HIP_ERROR(hipGraphExecDestroy(graph_exec));
+    CHECK_HIP_ERROR(hipGraphDestroy(graph));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetGraphCaptureMode(handle, HIPBLAS_GRAPH_CAPTURE_DEFAULT));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, nullptr));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
@@ -0,0 +1,146 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_common.hpp"
+
+#include <vector>
+
+/* ============================================================================================ */
+
+inline void testname_set_get_host_dispatch_mode(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_set_get_host_dispatch_mode(const Arguments& arg)
+{
+    hipblasHostDispatchMode_t mode      = HIPBLAS_HOST_DISPATCH_SMALL;
+    int64_t                   threshold = -1;
+
+    hipblasLocalHandle handle(arg);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetHostDispatchMode(nullptr, HIPBLAS_HOST_DISPATCH_SMALL),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetHostDispatchMode(nullptr, &mode),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetHostDispatchMode(handle, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetHostDispatchMode(handle, hipblasHostDispatchMode_t(2)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasSetHostDispatchThreshold(nullptr, HIPBLAS_HOST_DISPATCH_GEMM, 1),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasSetHostDispatchThreshold(handle, hipblasHostDispatchFunction_t(5), 1),
+        HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasSetHostDispatchThreshold(handle, HIPBLAS_HOST_DISPATCH_GEMM, -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetHostDispatchThreshold(handle, HIPBLAS_HOST_DISPATCH_GEMM, nullptr),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetHostDispatchMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_HOST_DISPATCH_NONE);
+    CHECK_HIPBLAS_ERROR(
+        hipblasGetHostDispatchThreshold(handle, HIPBLAS_HOST_DISPATCH_AXPY, &threshold));
+    EXPECT_EQ(threshold, 65536);
+    CHECK_HIPBLAS_ERROR(
+        hipblasGetHostDispatchThreshold(handle, HIPBLAS_HOST_DISPATCH_GEMM, &threshold));
+    EXPECT_EQ(threshold, 262144);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetHostDispatchMode(handle, HIPBLAS_HOST_DISPATCH_SMALL));
+    CHECK_HIPBLAS_ERROR(hipblasGetHostDispatchMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_HOST_DISPATCH_SMALL);
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // small problems on pageable host memory are computed on the host. The sums of small
+    // integers are exact, so the results must match the reference.
+    const int          N = 16;
+    std::vector<float> A(N * N), B(N * N), C(N * N), C_gold(N * N), x(N), y(N), y_gold(N);
+    for(int i = 0; i < N * N; i++)
+    {
+        A[i] = float(i % 7) - 3;
+        B[i] = float(i % 5) - 2;
+        C[i] = C_gold[i] = float(i % 3);
+    }
+    for(int i = 0; i < N; i++)
+    {
+        x[i] = float(i % 4) - 1;
+        y[i] = y_gold[i] = float(i % 6);
+    }
+    const float alpha = 2, beta = -1;
+
+    for(int j = 0; j < N; j++)
+    {
+        for(int i = 0; i < N; i++)
+        {
+            float sum = 0;
+            for(int l = 0; l < N; l++)
+                sum += A[l + i * N] * B[l + j * N];
+            C_gold[i + j * N] = alpha * sum + beta * C_gold[i + j * N];
+        }
+    }
+    CHECK_HIPBLAS_ERROR(hipblasSgemm(handle,
+                                     HIPBLAS_OP_T,
+                                     HIPBLAS_OP_N,
+                                     N,
+                                     N,
+                                     N,
+                                     &alpha,
+                                     A.data(),
+                                     N,
+                                     B.data(),
+                                     N,
+                                     &beta,
+                                     C.data(),
+                                     N));
+    EXPECT_EQ(C, C_gold);
+
+    for(int i = 0; i < N; i++)
+        y_gold[i] += alpha * x[N - 1 - i];
+    CHECK_HIPBLAS_ERROR(hipblasSaxpy(handle, N, &alpha, x.data(), -1, y.data(), 1));
+    EXPECT_EQ(y, y_gold);
+
+    float expected = 0, result = 0;
+    for(int i = 0; i < N; i++)
+        expected += x[i] * y[i];
+    CHECK_HIPBLAS_ERROR(hipblasSdot(handle, N, x.data(), 1, y.data(), 1, &result));
+    EXPECT_EQ(result, expected);
+
+    // device memory is still computed on the device
+    device_vector<float> dx(N, 1), dy(N, 1);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_HIP_ERROR(hipMemcpy(dx, x.data(), sizeof(float) * N, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, y.data(), sizeof(float) * N, hipMemcpyHostToDevice));
+    result = 0;
+    CHECK_HIPBLAS_ERROR(hipblasSdot(handle, N, dx, 1, dy, 1, &result));
+    EXPECT_EQ(result, expected);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetHostDispatchThreshold(handle, HIPBLAS_HOST_DISPATCH_DOT, 0));
+    CHECK_HIPBLAS_ERROR(
+        hipblasGetHostDispatchThreshold(handle, HIPBLAS_HOST_DISPATCH_DOT, &threshold));
+    EXPECT_EQ(threshold, 0);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetHostDispatchMode(handle, HIPBLAS_HOST_DISPATCH_NONE));
+    CHECK_HIPBLAS_ERROR(hipblasGetHostDispatchMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_HOST_DISPATCH_NONE);
+}
@@ -0,0 +1,55 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_info_mode(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_set_get_info_mode(const Arguments& arg)
+{
+    hipblasInfoMode_t mode = HIPBLAS_INFO_MODE_DEVICE;
+
+    hipblasLocalHandle handle(arg);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetInfoMode(nullptr, HIPBLAS_INFO_MODE_DEVICE),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetInfoMode(nullptr, &mode), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetInfoMode(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetInfoMode(handle, hipblasInfoMode_t(2)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetInfoMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_INFO_MODE_HOST);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetInfoMode(handle, HIPBLAS_INFO_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(hipblasGetInfoMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_INFO_MODE_DEVICE);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetInfoMode(handle, HIPBLAS_INFO_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasGetInfoMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_INFO_MODE_HOST);
+}
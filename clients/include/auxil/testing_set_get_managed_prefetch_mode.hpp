@@ -0,0 +1,129 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_managed_prefetch_mode(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_set_get_managed_prefetch_mode(const Arguments& arg)
+{
+    hipblasManagedPrefetchMode_t mode = HIPBLAS_MANAGED_PREFETCH_DEVICE;
+
+    hipblasLocalHandle handle(arg);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetManagedPrefetchMode(nullptr, HIPBLAS_MANAGED_PREFETCH_DEVICE),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetManagedPrefetchMode(nullptr, &mode),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetManagedPrefetchMode(handle, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetManagedPrefetchMode(handle, hipblasManagedPrefetchMode_t(2)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetManagedPrefetchMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_MANAGED_PREFETCH_NONE);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetManagedPrefetchMode(handle, HIPBLAS_MANAGED_PREFETCH_DEVICE));
+    CHECK_HIPBLAS_ERROR(hipblasGetManagedPrefetchMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_MANAGED_PREFETCH_DEVICE);
+
+    int device, managed = 0;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+    CHECK_HIP_ERROR(hipDeviceGetAttribute(&managed, hipDeviceAttributeManagedMemory, device));
+    if(!managed)
+        return;
+
+    // a gemm and a gemv on managed memory written on the host, run twice so the second finds
+    // the ranges already prefetched. The sums of small integers are exact.
+    const int N = 64;
+    float*    A;
+    float*    B;
+    float*    C;
+    float*    x;
+    float*    y;
+    CHECK_HIP_ERROR(hipMallocManaged(&A, sizeof(float) * N * N));
+    CHECK_HIP_ERROR(hipMallocManaged(&B, sizeof(float) * N * N));
+    CHECK_HIP_ERROR(hipMallocManaged(&C, sizeof(float) * N * N));
+    CHECK_HIP_ERROR(hipMallocManaged(&x, sizeof(float) * N));
+    CHECK_HIP_ERROR(hipMallocManaged(&y, sizeof(float) * N));
+
+    const float alpha = 2, beta = -1;
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    for(int run = 0; run < 2; run++)
+    {
+        host_vector<float> C_gold(N * N), y_gold(N);
+        for(int i = 0; i < N * N; i++)
+        {
+            A[i] = float(i % 7) - 3;
+            B[i] = float(i % 5) - 2;
+            C[i] = C_gold[i] = float(i % 3 + run);
+        }
+        for(int i = 0; i < N; i++)
+        {
+            x[i] = float(i % 4) - 1;
+            y[i] = y_gold[i] = float(i % 6 - run);
+        }
+
+        for(int j = 0; j < N; j++)
+        {
+            for(int i = 0; i < N; i++)
+            {
+                float sum = 0;
+                for(int l = 0; l < N; l++)
+                    sum += A[i + l * N] * B[l + j * N];
+                C_gold[i + j * N] = alpha * sum + beta * C_gold[i + j * N];
+            }
+            float sum = 0;
+            for(int l = 0; l < N; l++)
+                sum += A[l + j * N] * x[l];
+            y_gold[j] = alpha * sum + beta * y_gold[j];
+        }
+
+        CHECK_HIPBLAS_ERROR(hipblasSgemm(
+            handle, HIPBLAS_OP_N, HIPBLAS_OP_N, N, N, N, &alpha, A, N, B, N, &beta, C, N));
+        CHECK_HIPBLAS_ERROR(
+            hipblasSgemv(handle, HIPBLAS_OP_T, N, N, &alpha, A, N, x, 1, &beta, y, 1));
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+        for(int i = 0; i < N * N; i++)
+            EXPECT_EQ(C[i], C_gold[i]);
+        for(int i = 0; i < N; i++)
+            EXPECT_EQ(y[i], y_gold[i]);
+    }
+
+    CHECK_HIP_ERROR(hipFree(A));
+    CHECK_HIP_ERROR(hipFree(B));
+    CHECK_HIP_ERROR(hipFree(C));
+    CHECK_HIP_ERROR(hipFree(x));
+    CHECK_HIP_ERROR(hipFree(y));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetManagedPrefetchMode(handle, HIPBLAS_MANAGED_PREFETCH_NONE));
+    CHECK_HIPBLAS_ERROR(hipblasGetManagedPrefetchMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_MANAGED_PREFETCH_NONE);
+}
@@ -41,6 +41,17 @@ void testing_set_get_math_mode(const Arguments& arg)
     status = hipblasGetMathMode(handle, &mode);
     EXPECT_EQ(mode, HIPBLAS_DEFAULT_MATH);
 
+    // The 3M complex gemms are a hipBLAS mode on both backends
+    status = hipblasSetMathMode(handle, HIPBLAS_GEMM_3M_MATH);
+    EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+    status = hipblasGetMathMode(handle, &mode);
+    EXPECT_EQ(mode, HIPBLAS_GEMM_3M_MATH);
+
+    status = hipblasSetMathMode(handle, HIPBLAS_DEFAULT_MATH);
+    EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+    status = hipblasGetMathMode(handle, &mode);
+    EXPECT_EQ(mode, HIPBLAS_DEFAULT_MATH);
+
 #ifdef __HIP_PLATFORM_NVCC__
     // Both cuBLAS and hipBLAS have these math modes, but there isn't really much overlap.
     status = hipblasSetMathMode(handle, HIPBLAS_XF32_XDL_MATH);
@@ -40,9 +40,23 @@ inline void testname_set_get_matrix(const Arguments& arg, std::string& name)
 template <typename T>
 void testing_set_get_matrix(const Arguments& arg)
 {
-    bool FORTRAN            = arg.api == hipblas_client_api::FORTRAN;
-    auto hipblasSetMatrixFn = FORTRAN ? hipblasSetMatrixFortran : hipblasSetMatrix;
-    auto hipblasGetMatrixFn = FORTRAN ? hipblasGetMatrixFortran : hipblasGetMatrix;
+    bool FORTRAN    = arg.api == hipblas_client_api::FORTRAN;
+    bool FORTRAN_64 = arg.api == hipblas_client_api::FORTRAN_64;
+    bool C_64       = arg.api == hipblas_client_api::C_64;
+    auto hipblasSetMatrixFn = [FORTRAN, FORTRAN_64, C_64](auto... args) {
+        if(FORTRAN_64)
+            return hipblasSetMatrix_64Fortran(args...);
+        if(C_64)
+            return hipblasSetMatrix_64(args...);
+        return FORTRAN ? hipblasSetMatrixFortran(args...) : hipblasSetMatrix(args...);
+    };
+    auto hipblasGetMatrixFn = [FORTRAN, FORTRAN_64, C_64](auto... args) {
+        if(FORTRAN_64)
+            return hipblasGetMatrix_64Fortran(args...);
+        if(C_64)
+            return hipblasGetMatrix_64(args...);
+        return FORTRAN ? hipblasGetMatrixFortran(args...) : hipblasGetMatrix(args...);
+    };
 
     int rows = arg.rows;
     int cols = arg.cols;
@@ -121,18 +135,21 @@ void testing_set_get_matrix(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(
                 hipblasSetMatrixFn(rows, cols, sizeof(T), (void*)ha, lda, (void*)dc, ldc));
             CHECK_HIPBLAS_ERROR(
                 hipblasGetMatrixFn(rows, cols, sizeof(T), (void*)dc, ldc, (void*)hb, ldb));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasSetGetMatrixModel{}.log_args<T>(std::cout,
                                                arg,
@@ -142,3 +159,7 @@ void testing_set_get_matrix(const Arguments& arg)
                                                hipblas_error);
     }
 }
+
+// Instantiated in clients/common/auxil/common_set_get_matrix.cpp
+extern template void testing_set_get_matrix<float>(const Arguments&);
+extern template void testing_set_get_matrix<double>(const Arguments&);
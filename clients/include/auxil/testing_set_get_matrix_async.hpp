@@ -40,9 +40,23 @@ inline void testname_set_get_matrix_async(const Arguments& arg, std::string& nam
 template <typename T>
 void testing_set_get_matrix_async(const Arguments& arg)
 {
-    bool FORTRAN                 = arg.api == hipblas_client_api::FORTRAN;
-    auto hipblasSetMatrixAsyncFn = FORTRAN ? hipblasSetMatrixAsyncFortran : hipblasSetMatrixAsync;
-    auto hipblasGetMatrixAsyncFn = FORTRAN ? hipblasGetMatrixAsyncFortran : hipblasGetMatrixAsync;
+    bool FORTRAN    = arg.api == hipblas_client_api::FORTRAN;
+    bool FORTRAN_64 = arg.api == hipblas_client_api::FORTRAN_64;
+    bool C_64       = arg.api == hipblas_client_api::C_64;
+    auto hipblasSetMatrixAsyncFn = [FORTRAN, FORTRAN_64, C_64](auto... args) {
+        if(FORTRAN_64)
+            return hipblasSetMatrixAsync_64Fortran(args...);
+        if(C_64)
+            return hipblasSetMatrixAsync_64(args...);
+        return FORTRAN ? hipblasSetMatrixAsyncFortran(args...) : hipblasSetMatrixAsync(args...);
+    };
+    auto hipblasGetMatrixAsyncFn = [FORTRAN, FORTRAN_64, C_64](auto... args) {
+        if(FORTRAN_64)
+            return hipblasGetMatrixAsync_64Fortran(args...);
+        if(C_64)
+            return hipblasGetMatrixAsync_64(args...);
+        return FORTRAN ? hipblasGetMatrixAsyncFortran(args...) : hipblasGetMatrixAsync(args...);
+    };
 
     int rows = arg.rows;
     int cols = arg.cols;
@@ -128,18 +142,21 @@ void testing_set_get_matrix_async(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasSetMatrixAsyncFn(
                 rows, cols, sizeof(T), (void*)ha, lda, (void*)dc, ldc, stream));
             CHECK_HIPBLAS_ERROR(hipblasGetMatrixAsyncFn(
                 rows, cols, sizeof(T), (void*)dc, ldc, (void*)hb, ldb, stream));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasSetGetMatrixAsyncModel{}.log_args<T>(std::cout,
                                                     arg,
@@ -149,3 +166,7 @@ void testing_set_get_matrix_async(const Arguments& arg)
                                                     hipblas_error);
     }
 }
+
+// Instantiated in clients/common/auxil/common_set_get_matrix_async.cpp
+extern template void testing_set_get_matrix_async<float>(const Arguments&);
+extern template void testing_set_get_matrix_async<double>(const Arguments&);
@@ -0,0 +1,116 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_common.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+/* ============================================================================================ */
+
+inline void testname_set_get_matrix_ex(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_set_get_matrix_ex(const Arguments& arg)
+{
+    // small integers are exact in half and bfloat16, so the round trips are exact
+    const int   rows = 37, cols = 19, lda = 40, ldb = 38;
+    hipStream_t stream = nullptr;
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasSetMatrixEx(rows, cols, HIP_R_32F, nullptr, lda, HIP_R_8I, nullptr, ldb, stream),
+        HIPBLAS_STATUS_NOT_SUPPORTED);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasSetMatrixEx(rows, cols, HIP_R_32F, nullptr, 0, HIP_R_16F, nullptr, ldb, stream),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetMatrixEx(rows, cols, HIP_R_16F, nullptr, ldb, HIP_R_32F, nullptr, lda, stream),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    host_vector<float> hA(lda * cols), hB(lda * cols);
+    hipblas_init<float>(hA, rows, cols, lda);
+    hA[0] = 1.0f;
+
+    for(hipDataType type : {HIP_R_16F, HIP_R_16BF, HIP_R_64F})
+    {
+        size_t              size = type == HIP_R_64F ? sizeof(double) : sizeof(uint16_t);
+        device_vector<char> dB(size * ldb * cols);
+        CHECK_DEVICE_ALLOCATION(dB.memcheck());
+
+        CHECK_HIPBLAS_ERROR(
+            hipblasSetMatrixEx(rows, cols, HIP_R_32F, hA, lda, type, dB, ldb, stream));
+
+        // the device holds elements of the converted type
+        if(type != HIP_R_64F)
+        {
+            uint16_t first;
+            CHECK_HIP_ERROR(hipMemcpy(&first, dB, sizeof(first), hipMemcpyDeviceToHost));
+            EXPECT_EQ(first, type == HIP_R_16F ? 0x3C00 : 0x3F80);
+        }
+
+        for(auto& x : hB)
+            x = -1.0f;
+        CHECK_HIPBLAS_ERROR(
+            hipblasGetMatrixEx(rows, cols, type, dB, ldb, HIP_R_32F, hB, lda, stream));
+        unit_check_general<float>(rows, cols, lda, hA, hB);
+    }
+
+    // a matrix written to a file with leading dimension lda after a header, and read back
+    std::string path = std::string(testing::TempDir()) + "hipblas_matrix_file.bin";
+    const int   header = 64;
+
+    // dB has room for a column more than the file holds
+    device_vector<float> dA(ldb * cols), dB(ldb * (cols + 1));
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    EXPECT_HIPBLAS_STATUS(hipblasSetMatrixFromFile(rows,
+                                                   cols,
+                                                   sizeof(float),
+                                                   "/nonexistent/matrix",
+                                                   0,
+                                                   lda,
+                                                   dB,
+                                                   ldb,
+                                                   stream),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasSetMatrix(rows, cols, sizeof(float), hA, lda, dA, ldb));
+    CHECK_HIPBLAS_ERROR(hipblasGetMatrixToFile(
+        rows, cols, sizeof(float), dA, ldb, path.c_str(), header, lda, stream));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetMatrixFromFile(
+        rows, cols, sizeof(float), path.c_str(), header, lda, dB, ldb, stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    for(auto& x : hB)
+        x = -1.0f;
+    CHECK_HIPBLAS_ERROR(hipblasGetMatrix(rows, cols, sizeof(float), dB, ldb, hB, lda));
+    unit_check_general<float>(rows, cols, lda, hA, hB);
+
+    // a file shorter than the matrix
+    EXPECT_HIPBLAS_STATUS(
+        hipblasSetMatrixFromFile(
+            rows, cols + 1, sizeof(float), path.c_str(), header, lda, dB, ldb, stream),
+        HIPBLAS_STATUS_MAPPING_ERROR);
+    std::remove(path.c_str());
+}
@@ -52,5 +52,59 @@ void testing_set_get_pointer_mode(const Arguments& arg)
 
     EXPECT_EQ(HIPBLAS_POINTER_MODE_HOST, mode);
 
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_PINNED_HOST);
+    EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+
+    status = hipblasGetPointerMode(handle, &mode);
+    EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+
+    EXPECT_EQ(HIPBLAS_POINTER_MODE_PINNED_HOST, mode);
+
+    // The results of the reductions are written to pinned host memory on the stream, and alpha
+    // is still read on the host. The sums of small integers are exact.
+    int                  N = 1000;
+    host_vector<float>   hx(N);
+    device_vector<float> dx(N, 1);
+    device_vector<float> dy(N, 1);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    for(int i = 0; i < N; i++)
+        hx[i] = float(i % 5) - 2;
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(hipMemset(dy, 0, sizeof(float) * N));
+
+    float alpha = 2;
+    CHECK_HIPBLAS_ERROR(hipblasSaxpy(handle, N, &alpha, dx, 1, dy, 1));
+
+    float* results = nullptr;
+    int*   index   = nullptr;
+    CHECK_HIP_ERROR(hipHostMalloc((void**)&results, sizeof(float) * 2));
+    CHECK_HIP_ERROR(hipHostMalloc((void**)&index, sizeof(int)));
+    CHECK_HIPBLAS_ERROR(hipblasSdot(handle, N, dx, 1, dy, 1, results));
+    CHECK_HIPBLAS_ERROR(hipblasSasum(handle, N, dx, 1, results + 1));
+    CHECK_HIPBLAS_ERROR(hipblasIsamax(handle, N, dx, 1, index));
+
+    hipStream_t stream;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    float dot = 0, asum = 0;
+    for(int i = 0; i < N; i++)
+    {
+        dot += hx[i] * alpha * hx[i];
+        asum += std::abs(hx[i]);
+    }
+    EXPECT_EQ(results[0], dot);
+    EXPECT_EQ(results[1], asum);
+    EXPECT_EQ(*index, 1);
+
+    // the reductions leave the handle in the mode
+    status = hipblasGetPointerMode(handle, &mode);
+    EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_POINTER_MODE_PINNED_HOST, mode);
+
+    CHECK_HIP_ERROR(hipHostFree(results));
+    CHECK_HIP_ERROR(hipHostFree(index));
+
     hipblasDestroy(handle);
 }
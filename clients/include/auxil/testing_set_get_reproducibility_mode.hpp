@@ -0,0 +1,99 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_reproducibility_mode(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_set_get_reproducibility_mode(const Arguments& arg)
+{
+    hipblasReproducibilityMode_t mode         = HIPBLAS_REPRODUCIBILITY_BITWISE;
+    hipblasAtomicsMode_t         atomics_mode = HIPBLAS_ATOMICS_NOT_ALLOWED;
+
+    hipblasLocalHandle handle(arg);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetReproducibilityMode(nullptr, HIPBLAS_REPRODUCIBILITY_BITWISE),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetReproducibilityMode(nullptr, &mode),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetReproducibilityMode(handle, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetReproducibilityMode(handle, hipblasReproducibilityMode_t(2)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetReproducibilityMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_REPRODUCIBILITY_DEFAULT);
+
+    // atomics are disabled while the handle is reproducible, and restored after
+    CHECK_HIPBLAS_ERROR(hipblasSetAtomicsMode(handle, HIPBLAS_ATOMICS_ALLOWED));
+    CHECK_HIPBLAS_ERROR(hipblasSetReproducibilityMode(handle, HIPBLAS_REPRODUCIBILITY_BITWISE));
+    CHECK_HIPBLAS_ERROR(hipblasGetReproducibilityMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_REPRODUCIBILITY_BITWISE);
+    CHECK_HIPBLAS_ERROR(hipblasGetAtomicsMode(handle, &atomics_mode));
+    EXPECT_EQ(atomics_mode, HIPBLAS_ATOMICS_NOT_ALLOWED);
+    EXPECT_HIPBLAS_STATUS(hipblasSetAtomicsMode(handle, HIPBLAS_ATOMICS_ALLOWED),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+    CHECK_HIPBLAS_ERROR(hipblasSetAtomicsMode(handle, HIPBLAS_ATOMICS_NOT_ALLOWED));
+
+    // the sums of small integers are exact, so the fixed-order dot must match the reference,
+    // and must give the same bits from one call to the next
+    int                  N = 100000;
+    host_vector<float>   hx(N);
+    host_vector<float>   hy(N);
+    device_vector<float> dx(N, 1);
+    device_vector<float> dy(N, 1);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    for(int i = 0; i < N; i++)
+    {
+        hx[i] = float(i % 7) - 3;
+        hy[i] = float(i % 5) - 2;
+    }
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    float expected = 0;
+    for(int i = 0; i < N; i++)
+        expected += hx[i] * hy[i];
+
+    float result = 0, repeat = 0;
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasSdot(handle, N, dx, 1, dy, 1, &result));
+    CHECK_HIPBLAS_ERROR(hipblasSdot(handle, N, dx, 1, dy, 1, &repeat));
+    EXPECT_EQ(result, expected);
+    EXPECT_EQ(memcmp(&result, &repeat, sizeof(float)), 0);
+
+    int index = 0;
+    CHECK_HIPBLAS_ERROR(hipblasIsamax(handle, N, dx, 1, &index));
+    EXPECT_EQ(index, 1);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetReproducibilityMode(handle, HIPBLAS_REPRODUCIBILITY_DEFAULT));
+    CHECK_HIPBLAS_ERROR(hipblasGetReproducibilityMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_REPRODUCIBILITY_DEFAULT);
+    CHECK_HIPBLAS_ERROR(hipblasGetAtomicsMode(handle, &atomics_mode));
+    EXPECT_EQ(atomics_mode, HIPBLAS_ATOMICS_ALLOWED);
+}
@@ -0,0 +1,151 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_rounding_mode(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_set_get_rounding_mode(const Arguments& arg)
+{
+    hipblasRoundingMode_t mode = HIPBLAS_ROUND_STOCHASTIC;
+    uint64_t              seed = 1;
+
+    hipblasLocalHandle handle(arg);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetRoundingMode(nullptr, HIPBLAS_ROUND_TOWARD_ZERO, 0),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetRoundingMode(nullptr, &mode, &seed),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetRoundingMode(handle, nullptr, &seed),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetRoundingMode(handle, hipblasRoundingMode_t(3), 0),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetRoundingMode(handle, &mode, &seed));
+    EXPECT_EQ(mode, HIPBLAS_ROUND_NEAREST_EVEN);
+    EXPECT_EQ(seed, 0u);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetRoundingMode(handle, HIPBLAS_ROUND_STOCHASTIC, 42));
+    CHECK_HIPBLAS_ERROR(hipblasGetRoundingMode(handle, &mode, nullptr));
+    EXPECT_EQ(mode, HIPBLAS_ROUND_STOCHASTIC);
+    CHECK_HIPBLAS_ERROR(hipblasGetRoundingMode(handle, &mode, &seed));
+    EXPECT_EQ(seed, 42u);
+
+#ifdef HIPBLAS_V2
+    // y := 1 + alpha * 1 in half, with alpha 3/4 of the spacing of half at 1, is the half after
+    // 1 to nearest, 1 toward zero and either of them stochastically, by an axpyEx and by a gemmEx
+    // of k = 1 with beta = 1
+    const int          N          = 4096;
+    const uint16_t     half_one   = 0x3C00;
+    const float        alpha      = 0.75f / 1024;
+    const float        one        = 1;
+    host_vector<float> h_x(N, 1.0f);
+
+    host_vector<uint16_t>   h_y(N), h_first(N);
+    device_vector<float>    d_x(N);
+    device_vector<uint16_t> d_y(N), d_a(N), d_b(1);
+    CHECK_DEVICE_ALLOCATION(d_x.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_y.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_a.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_b.memcheck());
+    CHECK_HIP_ERROR(d_x.transfer_from(h_x));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // the ones of y, and of A and B for the gemm
+    host_vector<uint16_t> h_ones(N, half_one);
+    CHECK_HIP_ERROR(d_a.transfer_from(h_ones));
+    CHECK_HIP_ERROR(hipMemcpy(d_b, h_ones, sizeof(uint16_t), hipMemcpyHostToDevice));
+
+    // up is the number of elements of y rounded up by the axpyEx, or by the gemmEx, of the mode
+    auto round_y = [&](hipblasRoundingMode_t rounding, bool gemm, int& up) {
+        CHECK_HIP_ERROR(d_y.transfer_from(h_ones));
+        if(gemm)
+            CHECK_HIPBLAS_ERROR(hipblasGemmEx(handle,
+                                              HIPBLAS_OP_N,
+                                              HIPBLAS_OP_N,
+                                              N,
+                                              1,
+                                              1,
+                                              &alpha,
+                                              d_a,
+                                              HIP_R_16F,
+                                              N,
+                                              d_b,
+                                              HIP_R_16F,
+                                              1,
+                                              &one,
+                                              d_y,
+                                              HIP_R_16F,
+                                              N,
+                                              HIPBLAS_COMPUTE_32F,
+                                              HIPBLAS_GEMM_DEFAULT));
+        else
+            CHECK_HIPBLAS_ERROR(hipblasAxpyEx(
+                handle, N, &alpha, HIP_R_32F, d_x, HIP_R_32F, 1, d_y, HIP_R_16F, 1, HIP_R_32F));
+        CHECK_HIP_ERROR(h_y.transfer_from(d_y));
+
+        up = 0;
+        for(int i = 0; i < N; i++)
+        {
+            EXPECT_TRUE(h_y[i] == half_one || h_y[i] == half_one + 1) << "rounding " << rounding;
+            up += h_y[i] != half_one;
+        }
+    };
+
+    for(bool gemm : {false, true})
+    {
+        int up;
+        CHECK_HIPBLAS_ERROR(hipblasSetRoundingMode(handle, HIPBLAS_ROUND_NEAREST_EVEN, 0));
+        round_y(HIPBLAS_ROUND_NEAREST_EVEN, gemm, up);
+        EXPECT_EQ(up, N);
+
+        CHECK_HIPBLAS_ERROR(hipblasSetRoundingMode(handle, HIPBLAS_ROUND_TOWARD_ZERO, 0));
+        round_y(HIPBLAS_ROUND_TOWARD_ZERO, gemm, up);
+        EXPECT_EQ(up, 0);
+
+        // about 3/4 of the elements are rounded up, the same ones for the same seed, and other
+        // ones by the next call
+        CHECK_HIPBLAS_ERROR(hipblasSetRoundingMode(handle, HIPBLAS_ROUND_STOCHASTIC, 42));
+        round_y(HIPBLAS_ROUND_STOCHASTIC, gemm, up);
+        EXPECT_GT(up, N * 0.7);
+        EXPECT_LT(up, N * 0.8);
+        h_first = h_y;
+
+        round_y(HIPBLAS_ROUND_STOCHASTIC, gemm, up);
+        EXPECT_NE(memcmp(h_first, h_y, sizeof(uint16_t) * N), 0);
+
+        CHECK_HIPBLAS_ERROR(hipblasSetRoundingMode(handle, HIPBLAS_ROUND_STOCHASTIC, 42));
+        round_y(HIPBLAS_ROUND_STOCHASTIC, gemm, up);
+        EXPECT_EQ(memcmp(h_first, h_y, sizeof(uint16_t) * N), 0);
+    }
+#endif
+
+    CHECK_HIPBLAS_ERROR(hipblasSetRoundingMode(handle, HIPBLAS_ROUND_NEAREST_EVEN, 0));
+    CHECK_HIPBLAS_ERROR(hipblasGetRoundingMode(handle, &mode, &seed));
+    EXPECT_EQ(mode, HIPBLAS_ROUND_NEAREST_EVEN);
+}
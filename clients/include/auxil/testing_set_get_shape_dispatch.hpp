@@ -0,0 +1,168 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_shape_dispatch_mode(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_set_get_shape_dispatch_mode(const Arguments& arg)
+{
+    hipblasShapeDispatchMode_t mode = HIPBLAS_SHAPE_DISPATCH_ALLOWED;
+
+    hipblasLocalHandle handle(arg);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetShapeDispatchMode(nullptr, HIPBLAS_SHAPE_DISPATCH_ALLOWED),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetShapeDispatchMode(nullptr, &mode),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetShapeDispatchMode(handle, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetShapeDispatchMode(handle, hipblasShapeDispatchMode_t(2)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetShapeDispatchMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_SHAPE_DISPATCH_NONE);
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // each call is made in the default mode and then rewritten, and the results must agree
+    // within the rounding of sums of K terms
+    auto compare = [&](auto                      call,
+                       device_vector<float>&     dC,
+                       const host_vector<float>& hC,
+                       int64_t                   m,
+                       int64_t                   n,
+                       int64_t                   ldc,
+                       int64_t                   k) {
+        host_vector<float> hC_gold(hC.size()), hC_shaped(hC.size());
+
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        CHECK_HIPBLAS_ERROR(hipblasSetShapeDispatchMode(handle, HIPBLAS_SHAPE_DISPATCH_NONE));
+        CHECK_HIPBLAS_ERROR(call());
+        CHECK_HIP_ERROR(hC_gold.transfer_from(dC));
+
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        CHECK_HIPBLAS_ERROR(hipblasSetShapeDispatchMode(handle, HIPBLAS_SHAPE_DISPATCH_ALLOWED));
+        CHECK_HIPBLAS_ERROR(hipblasGetShapeDispatchMode(handle, &mode));
+        EXPECT_EQ(mode, HIPBLAS_SHAPE_DISPATCH_ALLOWED);
+        CHECK_HIPBLAS_ERROR(call());
+        CHECK_HIP_ERROR(hC_shaped.transfer_from(dC));
+        CHECK_HIPBLAS_ERROR(hipblasSetShapeDispatchMode(handle, HIPBLAS_SHAPE_DISPATCH_NONE));
+
+        double abs_error = 4.0 * k * std::numeric_limits<float>::epsilon();
+        near_check_general<float>(m, n, ldc, hC_gold.data(), hC_shaped.data(), abs_error);
+    };
+
+    auto fill = [](host_vector<float>& h, int period) {
+        for(size_t i = 0; i < h.size(); i++)
+            h[i] = float(i % period) / period - 0.5f;
+    };
+
+    const float alpha = 1.5f, beta = -0.5f;
+
+    // gemms of 1 to 8 columns, as gemv batches
+    const int M = 65, K = 40, ldc = M + 3;
+    for(int N : {1, 5, 8})
+        for(hipblasOperation_t transA : {HIPBLAS_OP_N, HIPBLAS_OP_T})
+            for(hipblasOperation_t transB : {HIPBLAS_OP_N, HIPBLAS_OP_T})
+            {
+                int lda = (transA == HIPBLAS_OP_N ? M : K) + 1;
+                int ldb = (transB == HIPBLAS_OP_N ? K : N) + 2;
+                host_vector<float> hA(size_t(lda) * (transA == HIPBLAS_OP_N ? K : M));
+                host_vector<float> hB(size_t(ldb) * (transB == HIPBLAS_OP_N ? N : K));
+                host_vector<float> hC(size_t(ldc) * N);
+                fill(hA, 7);
+                fill(hB, 5);
+                fill(hC, 3);
+
+                device_vector<float> dA(hA.size()), dB(hB.size()), dC(hC.size());
+                CHECK_HIP_ERROR(dA.transfer_from(hA));
+                CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+                auto gemm = [&] {
+                    return hipblasGemmEx_v2(handle,
+                                            transA,
+                                            transB,
+                                            M,
+                                            N,
+                                            K,
+                                            &alpha,
+                                            dA,
+                                            HIP_R_32F,
+                                            lda,
+                                            dB,
+                                            HIP_R_32F,
+                                            ldb,
+                                            &beta,
+                                            dC,
+                                            HIP_R_32F,
+                                            ldc,
+                                            HIPBLAS_COMPUTE_32F,
+                                            HIPBLAS_GEMM_DEFAULT);
+                };
+                compare(gemm, dC, hC, M, N, ldc, K);
+            }
+
+    // a batch of gemvs of one matrix, as a gemm, with the vectors x as the columns of a matrix
+    // and as its rows
+    const int m = 33, n = 24, batch = 20, lda = m + 1;
+    const int stridey = m + 2;
+    for(bool x_rows : {false, true})
+    {
+        int                incx    = x_rows ? batch + 1 : 1;
+        hipblasStride      stridex = x_rows ? 1 : n + 1;
+        host_vector<float> hA(size_t(lda) * n), hx(size_t(n + 1) * (batch + 1));
+        host_vector<float> hy(size_t(stridey) * batch);
+        fill(hA, 7);
+        fill(hx, 5);
+        fill(hy, 3);
+
+        device_vector<float> dA(hA.size()), dx(hx.size()), dy(hy.size());
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+        auto gemv = [&] {
+            return hipblasSgemvStridedBatched(handle,
+                                              HIPBLAS_OP_N,
+                                              m,
+                                              n,
+                                              &alpha,
+                                              dA,
+                                              lda,
+                                              0,
+                                              dx,
+                                              incx,
+                                              stridex,
+                                              &beta,
+                                              dy,
+                                              1,
+                                              stridey,
+                                              batch);
+        };
+        compare(gemv, dy, hy, m, batch, stridey, n);
+    }
+}
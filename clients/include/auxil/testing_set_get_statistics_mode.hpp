@@ -0,0 +1,117 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_statistics_mode(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_set_get_statistics_mode(const Arguments& arg)
+{
+    hipblasStatisticsMode_t  mode = HIPBLAS_STATISTICS_TIMED;
+    hipblasStatistics        stats;
+    hipblasRoutineStatistics routines[4];
+    int                      count = 4;
+
+    hipblasLocalHandle handle(arg);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetStatisticsMode(nullptr, HIPBLAS_STATISTICS_COUNT),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetStatisticsMode(nullptr, &mode),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetStatisticsMode(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetStatisticsMode(handle, hipblasStatisticsMode_t(3)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasGetStatistics(nullptr, &stats), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetStatistics(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGetRoutineStatistics(handle, nullptr, routines),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasResetStatistics(nullptr), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetStatisticsMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_STATISTICS_NONE);
+
+    const int          N     = 1024;
+    const float        alpha = 2;
+    float              result;
+    host_vector<float> h_x(N, 1.0f);
+
+    device_vector<float> d_x(N), d_y(N);
+    CHECK_DEVICE_ALLOCATION(d_x.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_y.memcheck());
+    CHECK_HIP_ERROR(d_x.transfer_from(h_x));
+    CHECK_HIP_ERROR(d_y.transfer_from(h_x));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // calls aren't counted in the default mode
+    CHECK_HIPBLAS_ERROR(hipblasSaxpy(handle, N, &alpha, d_x, 1, d_y, 1));
+    CHECK_HIPBLAS_ERROR(hipblasGetStatistics(handle, &stats));
+    EXPECT_EQ(stats.calls, 0u);
+
+    for(hipblasStatisticsMode_t counted : {HIPBLAS_STATISTICS_COUNT, HIPBLAS_STATISTICS_TIMED})
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSetStatisticsMode(handle, counted));
+        CHECK_HIPBLAS_ERROR(hipblasGetStatisticsMode(handle, &mode));
+        EXPECT_EQ(mode, counted);
+        CHECK_HIPBLAS_ERROR(hipblasResetStatistics(handle));
+
+        // three axpys and a dot waiting for its result on the host
+        for(int i = 0; i < 3; i++)
+            CHECK_HIPBLAS_ERROR(hipblasSaxpy(handle, N, &alpha, d_x, 1, d_y, 1));
+        CHECK_HIPBLAS_ERROR(hipblasSdot(handle, N, d_x, 1, d_y, 1, &result));
+
+        CHECK_HIPBLAS_ERROR(hipblasGetStatistics(handle, &stats));
+        EXPECT_EQ(stats.calls, 4u);
+        EXPECT_EQ(stats.hostSyncs, 1u);
+        EXPECT_EQ(stats.fallbacks, 0u);
+        if(counted == HIPBLAS_STATISTICS_TIMED)
+            EXPECT_GT(stats.gpuTimeMs, 0.0);
+        else
+            EXPECT_EQ(stats.gpuTimeMs, 0.0);
+
+        count = 0;
+        CHECK_HIPBLAS_ERROR(hipblasGetRoutineStatistics(handle, &count, nullptr));
+        EXPECT_EQ(count, 2);
+        count = 1;
+        CHECK_HIPBLAS_ERROR(hipblasGetRoutineStatistics(handle, &count, routines));
+        EXPECT_EQ(count, 2);
+        EXPECT_STREQ(routines[0].routine, "hipblasSaxpy");
+        EXPECT_EQ(routines[0].calls, 3u);
+    }
+
+    // setting the mode back keeps the statistics, which are then reset
+    CHECK_HIPBLAS_ERROR(hipblasSetStatisticsMode(handle, HIPBLAS_STATISTICS_NONE));
+    CHECK_HIPBLAS_ERROR(hipblasGetStatistics(handle, &stats));
+    EXPECT_EQ(stats.calls, 4u);
+    CHECK_HIPBLAS_ERROR(hipblasResetStatistics(handle));
+    CHECK_HIPBLAS_ERROR(hipblasGetStatistics(handle, &stats));
+    EXPECT_EQ(stats.calls, 0u);
+    EXPECT_EQ(stats.hostSyncs, 0u);
+    count = 4;
+    CHECK_HIPBLAS_ERROR(hipblasGetRoutineStatistics(handle, &count, routines));
+    EXPECT_EQ(count, 0);
+}
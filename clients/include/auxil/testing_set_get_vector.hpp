@@ -40,9 +40,23 @@ inline void testname_set_get_vector(const Arguments& arg, std::string& name)
 template <typename T>
 void testing_set_get_vector(const Arguments& arg)
 {
-    bool FORTRAN            = arg.api == hipblas_client_api::FORTRAN;
-    auto hipblasSetVectorFn = FORTRAN ? hipblasSetVectorFortran : hipblasSetVector;
-    auto hipblasGetVectorFn = FORTRAN ? hipblasGetVectorFortran : hipblasGetVector;
+    bool FORTRAN    = arg.api == hipblas_client_api::FORTRAN;
+    bool FORTRAN_64 = arg.api == hipblas_client_api::FORTRAN_64;
+    bool C_64       = arg.api == hipblas_client_api::C_64;
+    auto hipblasSetVectorFn = [FORTRAN, FORTRAN_64, C_64](auto... args) {
+        if(FORTRAN_64)
+            return hipblasSetVector_64Fortran(args...);
+        if(C_64)
+            return hipblasSetVector_64(args...);
+        return FORTRAN ? hipblasSetVectorFortran(args...) : hipblasSetVector(args...);
+    };
+    auto hipblasGetVectorFn = [FORTRAN, FORTRAN_64, C_64](auto... args) {
+        if(FORTRAN_64)
+            return hipblasGetVector_64Fortran(args...);
+        if(C_64)
+            return hipblasGetVector_64(args...);
+        return FORTRAN ? hipblasGetVectorFortran(args...) : hipblasGetVector(args...);
+    };
 
     int M    = arg.M;
     int incx = arg.incx;
@@ -112,16 +126,19 @@ void testing_set_get_vector(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasSetVectorFn(M, sizeof(T), (void*)hx, incx, (void*)db, incd));
             CHECK_HIPBLAS_ERROR(hipblasGetVectorFn(M, sizeof(T), (void*)db, incd, (void*)hy, incy));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasSetGetVectorModel{}.log_args<T>(std::cout,
                                                arg,
@@ -131,3 +148,7 @@ void testing_set_get_vector(const Arguments& arg)
                                                hipblas_error);
     }
 }
+
+// Instantiated in clients/common/auxil/common_set_get_vector.cpp
+extern template void testing_set_get_vector<float>(const Arguments&);
+extern template void testing_set_get_vector<double>(const Arguments&);
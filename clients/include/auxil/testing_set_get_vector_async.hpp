@@ -40,9 +40,23 @@ inline void testname_set_get_vector_async(const Arguments& arg, std::string& nam
 template <typename T>
 void testing_set_get_vector_async(const Arguments& arg)
 {
-    bool FORTRAN                 = arg.api == hipblas_client_api::FORTRAN;
-    auto hipblasSetVectorAsyncFn = FORTRAN ? hipblasSetVectorAsyncFortran : hipblasSetVectorAsync;
-    auto hipblasGetVectorAsyncFn = FORTRAN ? hipblasGetVectorAsyncFortran : hipblasGetVectorAsync;
+    bool FORTRAN    = arg.api == hipblas_client_api::FORTRAN;
+    bool FORTRAN_64 = arg.api == hipblas_client_api::FORTRAN_64;
+    bool C_64       = arg.api == hipblas_client_api::C_64;
+    auto hipblasSetVectorAsyncFn = [FORTRAN, FORTRAN_64, C_64](auto... args) {
+        if(FORTRAN_64)
+            return hipblasSetVectorAsync_64Fortran(args...);
+        if(C_64)
+            return hipblasSetVectorAsync_64(args...);
+        return FORTRAN ? hipblasSetVectorAsyncFortran(args...) : hipblasSetVectorAsync(args...);
+    };
+    auto hipblasGetVectorAsyncFn = [FORTRAN, FORTRAN_64, C_64](auto... args) {
+        if(FORTRAN_64)
+            return hipblasGetVectorAsync_64Fortran(args...);
+        if(C_64)
+            return hipblasGetVectorAsync_64(args...);
+        return FORTRAN ? hipblasGetVectorAsyncFortran(args...) : hipblasGetVectorAsync(args...);
+    };
 
     int M    = arg.M;
     int incx = arg.incx;
@@ -114,18 +128,21 @@ void testing_set_get_vector_async(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(
                 hipblasSetVectorAsyncFn(M, sizeof(T), (void*)hx, incx, (void*)db, incd, stream));
             CHECK_HIPBLAS_ERROR(
                 hipblasGetVectorAsyncFn(M, sizeof(T), (void*)db, incd, (void*)hy, incy, stream));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasSetGetVectorAsyncModel{}.log_args<T>(std::cout,
                                                     arg,
@@ -135,3 +152,7 @@ void testing_set_get_vector_async(const Arguments& arg)
                                                     hipblas_error);
     }
 }
+
+// Instantiated in clients/common/auxil/common_set_get_vector_async.cpp
+extern template void testing_set_get_vector_async<float>(const Arguments&);
+extern template void testing_set_get_vector_async<double>(const Arguments&);
@@ -0,0 +1,137 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_workspace(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_set_get_workspace(const Arguments& arg)
+{
+    size_t workspace_size = 4 * 1024 * 1024;
+    size_t size           = 0;
+
+    // the workspace outlives the handle that uses it
+    device_vector<char> workspace(workspace_size);
+    CHECK_DEVICE_ALLOCATION(workspace.memcheck());
+
+    hipblasLocalHandle handle(arg);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetWorkspace(nullptr, workspace, workspace_size),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetWorkspaceSize(nullptr, &size),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetWorkspaceSize(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, workspace, workspace_size));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceSize(handle, &size));
+    EXPECT_EQ(size, workspace_size);
+
+    // a smaller workspace replaces the previous one
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, workspace, workspace_size / 2));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceSize(handle, &size));
+    EXPECT_EQ(size, workspace_size / 2);
+
+#ifndef __HIP_PLATFORM_NVCC__
+    // rocBLAS returns to library-managed device memory
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, nullptr, 0));
+#endif
+
+    // a limit on the workspace hipBLAS allocates, which a workspace of the user ignores
+    size_t limit = 0;
+    EXPECT_HIPBLAS_STATUS(hipblasSetWorkspaceLimit(nullptr, workspace_size),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetWorkspaceLimit(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceLimit(handle, &limit));
+    EXPECT_EQ(limit, size_t(0));
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspaceLimit(handle, workspace_size / 4));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceLimit(handle, &limit));
+    EXPECT_EQ(limit, workspace_size / 4);
+#ifndef __HIP_PLATFORM_NVCC__
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceSize(handle, &size));
+    EXPECT_LE(size, workspace_size / 4);
+#endif
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, workspace, workspace_size));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceSize(handle, &size));
+    EXPECT_EQ(size, workspace_size);
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspaceLimit(handle, 0));
+#ifndef __HIP_PLATFORM_NVCC__
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, nullptr, 0));
+#endif
+
+    // device memory allocated from a memory pool on the stream of the handle
+    int          device;
+    hipMemPool_t pool, handle_pool;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+    CHECK_HIP_ERROR(hipDeviceGetDefaultMemPool(&pool, device));
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetWorkspaceMemPool(nullptr, pool),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetWorkspaceMemPool(handle, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceMemPool(handle, &handle_pool));
+    EXPECT_EQ(handle_pool, hipMemPool_t(nullptr));
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspaceMemPool(handle, pool));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceMemPool(handle, &handle_pool));
+    EXPECT_EQ(handle_pool, pool);
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, stream));
+
+    // a product of ones, large enough for rocBLAS to need a workspace for some solutions
+    const int            N     = 512;
+    const float          alpha = 1.0f, beta = 0.0f;
+    host_vector<float>   hA(size_t(N) * N);
+    device_vector<float> dA(size_t(N) * N, 1);
+    device_vector<float> dC(size_t(N) * N, 1);
+    for(size_t i = 0; i < hA.size(); i++)
+        hA[i] = 1.0f;
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIPBLAS_ERROR(hipblasSgemm(
+        handle, HIPBLAS_OP_N, HIPBLAS_OP_T, N, N, N, &alpha, dA, N, dA, N, &beta, dC, N));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(hipMemcpy(hA, dC, sizeof(float) * hA.size(), hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < hA.size(); i++)
+        EXPECT_EQ(hA[i], float(N));
+
+    // a workspace of the user takes precedence over the pool, and removing the pool returns to
+    // hipMalloc
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, workspace, workspace_size));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceSize(handle, &size));
+    EXPECT_EQ(size, workspace_size);
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspaceMemPool(handle, nullptr));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceMemPool(handle, &handle_pool));
+    EXPECT_EQ(handle_pool, hipMemPool_t(nullptr));
+#ifndef __HIP_PLATFORM_NVCC__
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, nullptr, 0));
+#endif
+
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, nullptr));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
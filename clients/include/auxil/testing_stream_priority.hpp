@@ -0,0 +1,93 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_stream_priority(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_stream_priority(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+
+    hipblasPriority_t priority;
+    EXPECT_HIPBLAS_STATUS(hipblasSetPriority(nullptr, HIPBLAS_PRIORITY_HIGH),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetPriority(nullptr, &priority), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetPriority(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetPriority(handle, hipblasPriority_t(3)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    hipStream_t stream, priority_stream;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+    CHECK_HIPBLAS_ERROR(hipblasGetPriority(handle, &priority));
+    EXPECT_EQ(priority, HIPBLAS_PRIORITY_DEFAULT);
+
+    // the default priority on a handle without a priority stream does nothing
+    CHECK_HIPBLAS_ERROR(hipblasSetPriority(handle, HIPBLAS_PRIORITY_DEFAULT));
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &priority_stream));
+    EXPECT_EQ(priority_stream, stream);
+
+    // the calls of the handle go to the priority stream, after the work queued before
+    const int            N     = 256;
+    const float          alpha = 2.0f;
+    host_vector<float>   hx(N);
+    device_vector<float> dx(N, 1);
+    for(int i = 0; i < N; i++)
+        hx[i] = float(i);
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(float) * N, hipMemcpyHostToDevice));
+
+    CHECK_HIPBLAS_ERROR(hipblasSscal(handle, N, &alpha, dx, 1));
+    CHECK_HIPBLAS_ERROR(hipblasSetPriority(handle, HIPBLAS_PRIORITY_HIGH));
+    CHECK_HIPBLAS_ERROR(hipblasGetPriority(handle, &priority));
+    EXPECT_EQ(priority, HIPBLAS_PRIORITY_HIGH);
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &priority_stream));
+    EXPECT_NE(priority_stream, stream);
+    CHECK_HIPBLAS_ERROR(hipblasSscal(handle, N, &alpha, dx, 1));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPriority(handle, HIPBLAS_PRIORITY_LOW));
+    CHECK_HIPBLAS_ERROR(hipblasGetPriority(handle, &priority));
+    EXPECT_EQ(priority, HIPBLAS_PRIORITY_LOW);
+    CHECK_HIPBLAS_ERROR(hipblasSscal(handle, N, &alpha, dx, 1));
+
+    // the default priority sets back the stream the handle had
+    CHECK_HIPBLAS_ERROR(hipblasSetPriority(handle, HIPBLAS_PRIORITY_DEFAULT));
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &priority_stream));
+    EXPECT_EQ(priority_stream, stream);
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    CHECK_HIP_ERROR(hipMemcpy(hx, dx, sizeof(float) * N, hipMemcpyDeviceToHost));
+    for(int i = 0; i < N; i++)
+        EXPECT_EQ(hx[i], alpha * alpha * alpha * i);
+
+    // a stream set by the user ends the priority stream too
+    CHECK_HIPBLAS_ERROR(hipblasSetPriority(handle, HIPBLAS_PRIORITY_HIGH));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, stream));
+    CHECK_HIPBLAS_ERROR(hipblasGetPriority(handle, &priority));
+    EXPECT_EQ(priority, HIPBLAS_PRIORITY_DEFAULT);
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &priority_stream));
+    EXPECT_EQ(priority_stream, stream);
+}
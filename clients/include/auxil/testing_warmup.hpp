@@ -0,0 +1,70 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_warmup(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_warmup(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+
+    auto problem = [](hipblasOperation_t   transA,
+                      hipblasOperation_t   transB,
+                      int                  size,
+                      hipDataType          type,
+                      hipblasComputeType_t computeType,
+                      int                  batchCount) {
+        return hipblasWarmupProblem{
+            transA, transB, size, size / 2, size / 4, type, type, type, computeType, batchCount};
+    };
+
+    hipblasWarmupProblem problems[] = {
+        problem(HIPBLAS_OP_N, HIPBLAS_OP_N, 128, HIP_R_32F, HIPBLAS_COMPUTE_32F, 1),
+        problem(HIPBLAS_OP_T, HIPBLAS_OP_N, 64, HIP_R_16F, HIPBLAS_COMPUTE_32F, 1),
+        problem(HIPBLAS_OP_N, HIPBLAS_OP_T, 32, HIP_R_64F, HIPBLAS_COMPUTE_64F, 10),
+    };
+    const int count = sizeof(problems) / sizeof(problems[0]);
+
+    EXPECT_HIPBLAS_STATUS(hipblasWarmup(nullptr, count, problems),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasWarmup(handle, count, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasWarmup(handle, -1, problems), HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasWarmup(handle, 0, nullptr));
+
+    hipblasWarmupProblem invalid = problems[0];
+    invalid.batchCount           = 0;
+    EXPECT_HIPBLAS_STATUS(hipblasWarmup(handle, 1, &invalid), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // the pointer mode of the handle is left as it was
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(hipblasWarmup(handle, count, problems));
+
+    hipblasPointerMode_t mode;
+    CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_POINTER_MODE_DEVICE);
+}
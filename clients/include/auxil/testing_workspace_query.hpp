@@ -0,0 +1,69 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_workspace_query(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_workspace_query(const Arguments& arg)
+{
+    int    N     = 128;
+    float  alpha = 1.0f, beta = 0.0f;
+    size_t size  = 0;
+
+    hipblasLocalHandle handle(arg);
+
+    device_matrix<float> dA(N, N, N);
+    device_matrix<float> dB(N, N, N);
+    device_matrix<float> dC(N, N, N);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+    EXPECT_HIPBLAS_STATUS(hipblasStartWorkspaceQuery(nullptr), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasStopWorkspaceQuery(nullptr, &size),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    // stopping a query that was never started
+    EXPECT_HIPBLAS_STATUS(hipblasStopWorkspaceQuery(handle, &size), HIPBLAS_STATUS_INVALID_VALUE);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasStartWorkspaceQuery(handle));
+    EXPECT_HIPBLAS_STATUS(hipblasStartWorkspaceQuery(handle), HIPBLAS_STATUS_INVALID_VALUE);
+
+    CHECK_HIPBLAS_ERROR(hipblasSgemm(
+        handle, HIPBLAS_OP_N, HIPBLAS_OP_N, N, N, N, &alpha, dA, N, dB, N, &beta, dC, N));
+
+    EXPECT_HIPBLAS_STATUS(hipblasStopWorkspaceQuery(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasStopWorkspaceQuery(handle, &size));
+    EXPECT_HIPBLAS_STATUS(hipblasStopWorkspaceQuery(handle, &size), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // the handle is usable again after the query
+    CHECK_HIPBLAS_ERROR(hipblasSgemm(
+        handle, HIPBLAS_OP_N, HIPBLAS_OP_N, N, N, N, &alpha, dA, N, dB, N, &beta, dC, N));
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+}
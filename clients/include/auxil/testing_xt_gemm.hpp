@@ -0,0 +1,345 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_xt_gemm(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_xt_gemm(const Arguments& arg)
+{
+    // sizes that aren't multiples of the block size, so that edge tiles and k blocks are run
+    const int M = 70, N = 45, K = 52, lda = K, ldb = K, ldc = M + 3;
+
+    int device;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+
+    hipblasXtHandle_t xt;
+    int               block_dim;
+    const float       alpha = 2, beta = 3;
+
+    CHECK_HIPBLAS_ERROR(hipblasXtCreate(&xt));
+
+    // a context is used once its devices are selected
+    EXPECT_HIPBLAS_STATUS(hipblasXtSgemm(xt,
+                                         HIPBLAS_OP_T,
+                                         HIPBLAS_OP_N,
+                                         M,
+                                         N,
+                                         K,
+                                         &alpha,
+                                         nullptr,
+                                         lda,
+                                         nullptr,
+                                         ldb,
+                                         &beta,
+                                         nullptr,
+                                         ldc),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasXtDeviceSelect(xt, 0, &device), HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasXtDeviceSelect(xt, 1, &device));
+
+    EXPECT_HIPBLAS_STATUS(hipblasXtSetBlockDim(xt, 0), HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasXtSetBlockDim(xt, 16));
+    CHECK_HIPBLAS_ERROR(hipblasXtGetBlockDim(xt, &block_dim));
+    EXPECT_EQ(block_dim, 16);
+
+    // pageable host matrices
+    host_vector<float> hA(size_t(lda) * M), hB(size_t(ldb) * N), hC(size_t(ldc) * N);
+    hipblas_init<float>(hA, K, M, lda);
+    hipblas_init<float>(hB, K, N, ldb);
+    hipblas_init<float>(hC, M, N, ldc);
+    host_vector<float> hC_gold = hC;
+
+    CHECK_HIPBLAS_ERROR(hipblasXtSgemm(
+        xt, HIPBLAS_OP_T, HIPBLAS_OP_N, M, N, K, &alpha, hA, lda, hB, ldb, &beta, hC, ldc));
+    ref_gemm<float>(HIPBLAS_OP_T,
+                    HIPBLAS_OP_N,
+                    M,
+                    N,
+                    K,
+                    alpha,
+                    hA.data(),
+                    lda,
+                    hB.data(),
+                    ldb,
+                    beta,
+                    hC_gold.data(),
+                    ldc);
+    unit_check_general<float>(M, N, ldc, hC_gold, hC);
+
+    // device matrices
+    device_vector<float> dA(size_t(lda) * M), dB(size_t(ldb) * N), dC(size_t(ldc) * N);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+
+    CHECK_HIPBLAS_ERROR(hipblasXtSgemm(
+        xt, HIPBLAS_OP_T, HIPBLAS_OP_N, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc));
+    ref_gemm<float>(HIPBLAS_OP_T,
+                    HIPBLAS_OP_N,
+                    M,
+                    N,
+                    K,
+                    alpha,
+                    hA.data(),
+                    lda,
+                    hB.data(),
+                    ldb,
+                    beta,
+                    hC_gold.data(),
+                    ldc);
+    CHECK_HIP_ERROR(hC.transfer_from(dC));
+    unit_check_general<float>(M, N, ldc, hC_gold, hC);
+
+    // a budget for 8 x 8 tiles, smaller than the block size, streams a k dominant gemm of host
+    // matrices through double buffered blocks
+    const int Mk = 9, Nk = 10, Kk = 300, ldak = Mk, ldbk = Nk, ldck = Mk;
+    size_t    budget;
+    CHECK_HIPBLAS_ERROR(hipblasXtSetMemoryBudget(xt, 6 * 8 * 8 * sizeof(float)));
+    CHECK_HIPBLAS_ERROR(hipblasXtGetMemoryBudget(xt, &budget));
+    EXPECT_EQ(budget, 6 * 8 * 8 * sizeof(float));
+
+    host_vector<float> hAk(size_t(ldak) * Kk), hBk(size_t(ldbk) * Kk), hCk(size_t(ldck) * Nk);
+    hipblas_init<float>(hAk, Mk, Kk, ldak);
+    hipblas_init<float>(hBk, Nk, Kk, ldbk);
+    hipblas_init<float>(hCk, Mk, Nk, ldck);
+    host_vector<float> hCk_gold = hCk;
+
+    EXPECT_HIPBLAS_STATUS(hipblasXtGemmEx(xt,
+                                          HIPBLAS_OP_N,
+                                          HIPBLAS_OP_T,
+                                          Mk,
+                                          Nk,
+                                          Kk,
+                                          &alpha,
+                                          hAk,
+                                          HIP_R_32F,
+                                          ldak,
+                                          hBk,
+                                          HIP_R_32U,
+                                          ldbk,
+                                          &beta,
+                                          hCk,
+                                          HIP_R_32F,
+                                          ldck,
+                                          HIPBLAS_COMPUTE_32F,
+                                          HIPBLAS_GEMM_DEFAULT),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+    CHECK_HIPBLAS_ERROR(hipblasXtGemmEx(xt,
+                                        HIPBLAS_OP_N,
+                                        HIPBLAS_OP_T,
+                                        Mk,
+                                        Nk,
+                                        Kk,
+                                        &alpha,
+                                        hAk,
+                                        HIP_R_32F,
+                                        ldak,
+                                        hBk,
+                                        HIP_R_32F,
+                                        ldbk,
+                                        &beta,
+                                        hCk,
+                                        HIP_R_32F,
+                                        ldck,
+                                        HIPBLAS_COMPUTE_32F,
+                                        HIPBLAS_GEMM_DEFAULT));
+    ref_gemm<float>(HIPBLAS_OP_N,
+                    HIPBLAS_OP_T,
+                    Mk,
+                    Nk,
+                    Kk,
+                    alpha,
+                    hAk.data(),
+                    ldak,
+                    hBk.data(),
+                    ldbk,
+                    beta,
+                    hCk_gold.data(),
+                    ldck);
+    unit_check_general<float>(Mk, Nk, ldck, hCk_gold, hCk);
+
+    // a budget for a few problems per chunk runs a strided batch of host matrices in several
+    // pipelined chunks over the three slots, with A shared by the gemms
+    const int     Mb = 5, Nb = 6, Kb = 7, batch = 50;
+    hipblasStride stride_b = size_t(Kb) * Nb + 3, stride_c = size_t(Mb) * Nb;
+    CHECK_HIPBLAS_ERROR(hipblasXtSetMemoryBudget(xt, 3 * (8 * 1024 + 3 * 256)));
+
+    host_vector<float> hAb(size_t(Mb) * Kb), hBb(stride_b * batch), hCb(stride_c * batch);
+    hipblas_init<float>(hAb, Mb, Kb, Mb);
+    hipblas_init<float>(hBb, stride_b * batch, 1, stride_b * batch);
+    hipblas_init<float>(hCb, stride_c * batch, 1, stride_c * batch);
+    host_vector<float> hCb_gold = hCb;
+
+    EXPECT_HIPBLAS_STATUS(hipblasXtGemmStridedBatchedEx(xt,
+                                                        HIPBLAS_OP_N,
+                                                        HIPBLAS_OP_N,
+                                                        Mb,
+                                                        Nb,
+                                                        Kb,
+                                                        &alpha,
+                                                        hAb,
+                                                        HIP_R_32F,
+                                                        Mb,
+                                                        1,
+                                                        hBb,
+                                                        HIP_R_32F,
+                                                        Kb,
+                                                        stride_b,
+                                                        &beta,
+                                                        hCb,
+                                                        HIP_R_32F,
+                                                        Mb,
+                                                        stride_c,
+                                                        batch,
+                                                        HIPBLAS_COMPUTE_32F,
+                                                        HIPBLAS_GEMM_DEFAULT),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+    for(int pass = 0; pass < 2; pass++)
+    {
+        // the second pass splits the batch by the throughput timed in the first
+        CHECK_HIPBLAS_ERROR(hipblasXtGemmStridedBatchedEx(xt,
+                                                          HIPBLAS_OP_N,
+                                                          HIPBLAS_OP_N,
+                                                          Mb,
+                                                          Nb,
+                                                          Kb,
+                                                          &alpha,
+                                                          hAb,
+                                                          HIP_R_32F,
+                                                          Mb,
+                                                          0,
+                                                          hBb,
+                                                          HIP_R_32F,
+                                                          Kb,
+                                                          stride_b,
+                                                          &beta,
+                                                          hCb,
+                                                          HIP_R_32F,
+                                                          Mb,
+                                                          stride_c,
+                                                          batch,
+                                                          HIPBLAS_COMPUTE_32F,
+                                                          HIPBLAS_GEMM_DEFAULT));
+        for(int b = 0; b < batch; b++)
+            ref_gemm<float>(HIPBLAS_OP_N,
+                            HIPBLAS_OP_N,
+                            Mb,
+                            Nb,
+                            Kb,
+                            alpha,
+                            hAb,
+                            Mb,
+                            hBb + b * stride_b,
+                            Kb,
+                            beta,
+                            hCb_gold + b * stride_c,
+                            Mb);
+        unit_check_general<float>(Mb, Nb, batch, Mb, stride_c, hCb_gold, hCb);
+    }
+
+    // getrf and getrs of device matrices, ordered on a stream
+    const int     Nf = 8, nrhs = 2;
+    hipblasStride stride_a = size_t(Nf) * Nf, stride_x = size_t(Nf) * nrhs;
+    host_vector<float> hAf(stride_a * batch), hXf(stride_x * batch), hXf_gold(stride_x * batch);
+    host_vector<int>   hIpiv(size_t(Nf) * batch), hInfo(batch);
+    hipblas_init<float>(hAf, stride_a * batch, 1, stride_a * batch);
+    hipblas_init<float>(hXf, stride_x * batch, 1, stride_x * batch);
+    for(int b = 0; b < batch; b++)
+        for(int i = 0; i < Nf; i++)
+            hAf[b * stride_a + i * (Nf + 1)] += 4 * Nf;
+    hXf_gold = hXf;
+
+    device_vector<float> dAf(stride_a * batch), dXf(stride_x * batch);
+    device_vector<int>   dIpiv(size_t(Nf) * batch), dInfo(batch);
+    CHECK_DEVICE_ALLOCATION(dAf.memcheck());
+    CHECK_DEVICE_ALLOCATION(dXf.memcheck());
+    CHECK_DEVICE_ALLOCATION(dIpiv.memcheck());
+    CHECK_DEVICE_ALLOCATION(dInfo.memcheck());
+    CHECK_HIP_ERROR(dAf.transfer_from(hAf));
+    CHECK_HIP_ERROR(dXf.transfer_from(hXf));
+
+    hipStream_t stream, xt_stream;
+    int         info;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIPBLAS_ERROR(hipblasXtSetStream(xt, stream));
+    CHECK_HIPBLAS_ERROR(hipblasXtGetStream(xt, &xt_stream));
+    EXPECT_EQ(xt_stream, stream);
+
+    CHECK_HIPBLAS_ERROR(
+        hipblasXtSgetrfStridedBatched(xt, Nf, dAf, Nf, stride_a, dIpiv, Nf, dInfo, batch));
+    EXPECT_HIPBLAS_STATUS(hipblasXtSgetrsStridedBatched(xt,
+                                                        HIPBLAS_OP_N,
+                                                        Nf,
+                                                        nrhs,
+                                                        dAf,
+                                                        Nf - 1,
+                                                        stride_a,
+                                                        dIpiv,
+                                                        Nf,
+                                                        dXf,
+                                                        Nf,
+                                                        stride_x,
+                                                        &info,
+                                                        batch),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(info, -5);
+    CHECK_HIPBLAS_ERROR(hipblasXtSgetrsStridedBatched(xt,
+                                                      HIPBLAS_OP_N,
+                                                      Nf,
+                                                      nrhs,
+                                                      dAf,
+                                                      Nf,
+                                                      stride_a,
+                                                      dIpiv,
+                                                      Nf,
+                                                      dXf,
+                                                      Nf,
+                                                      stride_x,
+                                                      &info,
+                                                      batch));
+    EXPECT_EQ(info, 0);
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(hXf.transfer_from(dXf));
+    CHECK_HIP_ERROR(hInfo.transfer_from(dInfo));
+
+    for(int b = 0; b < batch; b++)
+    {
+        EXPECT_EQ(hInfo[b], 0);
+        ref_getrf<float>(Nf, Nf, hAf + b * stride_a, Nf, hIpiv + b * Nf);
+        ref_getrs<float>(
+            'N', Nf, nrhs, hAf + b * stride_a, Nf, hIpiv + b * Nf, hXf_gold + b * stride_x, Nf);
+    }
+    near_check_general<float>(Nf, nrhs, batch, Nf, stride_x, hXf_gold, hXf, Nf * 1e-5);
+
+    CHECK_HIPBLAS_ERROR(hipblasXtSetStream(xt, nullptr));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    CHECK_HIPBLAS_ERROR(hipblasXtDestroy(xt));
+}
@@ -179,15 +179,19 @@ void testing_asum(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer  timer(arg, stream);
+        hipblas_rotating_buffers rotating(arg, dx);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
+
+            DAPI_CHECK(hipblasAsumFn, (handle, N, rotating(dx, iter), incx, d_hipblas_result));
 
-            DAPI_CHECK(hipblasAsumFn, (handle, N, dx, incx, d_hipblas_result));
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasAsumModel{}.log_args<T>(std::cout,
                                        arg,
@@ -200,3 +204,9 @@ void testing_asum(const Arguments& arg)
 
     return;
 }
+
+// Instantiated in clients/common/blas1/common_asum.cpp
+extern template void testing_asum<float>(const Arguments&);
+extern template void testing_asum<double>(const Arguments&);
+extern template void testing_asum<hipblasComplex>(const Arguments&);
+extern template void testing_asum<hipblasDoubleComplex>(const Arguments&);
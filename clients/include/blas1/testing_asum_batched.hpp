@@ -157,6 +157,9 @@ void testing_asum_batched(const Arguments& arg)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_asum<T>(N, hx[b], incx, &(h_cpu_result[b]));
@@ -207,16 +210,19 @@ void testing_asum_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_CHECK(hipblasAsumBatchedFn,
                        (handle, N, dx.ptr_on_device(), incx, batch_count, d_hipblas_result));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasAsumBatchedModel{}.log_args<T>(std::cout,
                                               arg,
@@ -227,3 +233,9 @@ void testing_asum_batched(const Arguments& arg)
                                               hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas1/common_asum.cpp
+extern template void testing_asum_batched<float>(const Arguments&);
+extern template void testing_asum_batched<double>(const Arguments&);
+extern template void testing_asum_batched<hipblasComplex>(const Arguments&);
+extern template void testing_asum_batched<hipblasDoubleComplex>(const Arguments&);
@@ -161,6 +161,9 @@ void testing_asum_strided_batched(const Arguments& arg)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_asum<T>(N, hx.data() + b * stridex, incx, &cpu_result[b]);
@@ -203,16 +206,19 @@ void testing_asum_strided_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_CHECK(hipblasAsumStridedBatchedFn,
                        (handle, N, dx, incx, stridex, batch_count, d_hipblas_result));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasAsumStridedBatchedModel{}.log_args<T>(std::cout,
                                                      arg,
@@ -223,3 +229,9 @@ void testing_asum_strided_batched(const Arguments& arg)
                                                      hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas1/common_asum.cpp
+extern template void testing_asum_strided_batched<float>(const Arguments&);
+extern template void testing_asum_strided_batched<double>(const Arguments&);
+extern template void testing_asum_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_asum_strided_batched<hipblasDoubleComplex>(const Arguments&);
@@ -198,15 +198,26 @@ void testing_axpy(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer  timer(arg, stream);
+        hipblas_rotating_buffers rotating(arg, dx, dy_device);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            DAPI_CHECK(hipblasAxpyFn, (handle, N, d_alpha, dx, incx, dy_device, incy));
+            timer.start(iter);
+
+            DAPI_CHECK(hipblasAxpyFn,
+                       (handle,
+                        N,
+                        d_alpha,
+                        rotating(dx, iter),
+                        incx,
+                        rotating(dy_device, iter),
+                        incy));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasAxpyModel{}.log_args<T>(std::cout,
                                        arg,
@@ -217,3 +228,10 @@ void testing_axpy(const Arguments& arg)
                                        hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas1/common_axpy.cpp
+extern template void testing_axpy<float>(const Arguments&);
+extern template void testing_axpy<double>(const Arguments&);
+extern template void testing_axpy<hipblasHalf>(const Arguments&);
+extern template void testing_axpy<hipblasComplex>(const Arguments&);
+extern template void testing_axpy<hipblasDoubleComplex>(const Arguments&);
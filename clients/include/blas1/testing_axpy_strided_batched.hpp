@@ -194,6 +194,9 @@ void testing_axpy_strided_batched(const Arguments& arg)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_axpy<T>(N, alpha, hx_cpu[b], incx, hy_cpu[b], incy);
@@ -223,16 +226,19 @@ void testing_axpy_strided_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_CHECK(hipblasAxpyStridedBatchedFn,
                        (handle, N, d_alpha, dx, incx, stride_x, dy, incy, stride_y, batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasAxpyStridedBatchedModel{}.log_args<T>(std::cout,
                                                      arg,
@@ -243,3 +249,10 @@ void testing_axpy_strided_batched(const Arguments& arg)
                                                      hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas1/common_axpy.cpp
+extern template void testing_axpy_strided_batched<float>(const Arguments&);
+extern template void testing_axpy_strided_batched<double>(const Arguments&);
+extern template void testing_axpy_strided_batched<hipblasHalf>(const Arguments&);
+extern template void testing_axpy_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_axpy_strided_batched<hipblasDoubleComplex>(const Arguments&);
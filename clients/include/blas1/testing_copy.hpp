@@ -149,15 +149,25 @@ void testing_copy(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer  timer(arg, stream);
+        hipblas_rotating_buffers rotating(arg, dx, dy);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
+
+            DAPI_CHECK(hipblasCopyFn,
+                       (handle,
+                        N,
+                        rotating(dx, iter),
+                        incx,
+                        rotating(dy, iter),
+                        incy));
 
-            DAPI_CHECK(hipblasCopyFn, (handle, N, dx, incx, dy, incy));
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasCopyModel{}.log_args<T>(std::cout,
                                        arg,
@@ -167,3 +177,9 @@ void testing_copy(const Arguments& arg)
                                        hipblas_error);
     }
 }
+
+// Instantiated in clients/common/blas1/common_copy.cpp
+extern template void testing_copy<float>(const Arguments&);
+extern template void testing_copy<double>(const Arguments&);
+extern template void testing_copy<hipblasComplex>(const Arguments&);
+extern template void testing_copy<hipblasDoubleComplex>(const Arguments&);
@@ -130,6 +130,9 @@ void testing_copy_batched(const Arguments& arg)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_copy<T>(N, hx_cpu[b], incx, hy_cpu[b], incy);
@@ -152,17 +155,20 @@ void testing_copy_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_CHECK(
                 hipblasCopyBatchedFn,
                 (handle, N, dx.ptr_on_device(), incx, dy.ptr_on_device(), incy, batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasCopyBatchedModel{}.log_args<T>(std::cout,
                                               arg,
@@ -172,3 +178,9 @@ void testing_copy_batched(const Arguments& arg)
                                               hipblas_error);
     }
 }
+
+// Instantiated in clients/common/blas1/common_copy.cpp
+extern template void testing_copy_batched<float>(const Arguments&);
+extern template void testing_copy_batched<double>(const Arguments&);
+extern template void testing_copy_batched<hipblasComplex>(const Arguments&);
+extern template void testing_copy_batched<hipblasDoubleComplex>(const Arguments&);
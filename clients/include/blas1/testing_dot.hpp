@@ -205,15 +205,26 @@ void testing_dot(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer  timer(arg, stream);
+        hipblas_rotating_buffers rotating(arg, dx, dy);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            DAPI_CHECK(hipblasDotFn, (handle, N, dx, incx, dy, incy, d_hipblas_result));
+            timer.start(iter);
+
+            DAPI_CHECK(hipblasDotFn,
+                       (handle,
+                        N,
+                        rotating(dx, iter),
+                        incx,
+                        rotating(dy, iter),
+                        incy,
+                        d_hipblas_result));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasDotModel{}.log_args<T>(std::cout,
                                       arg,
@@ -230,3 +241,13 @@ void testing_dotc(const Arguments& arg)
 {
     testing_dot<T, true>(arg);
 }
+
+// Instantiated in clients/common/blas1/common_dot.cpp
+extern template void testing_dot<float>(const Arguments&);
+extern template void testing_dot<double>(const Arguments&);
+extern template void testing_dot<hipblasHalf>(const Arguments&);
+extern template void testing_dot<hipblasBfloat16>(const Arguments&);
+extern template void testing_dot<hipblasComplex>(const Arguments&);
+extern template void testing_dot<hipblasDoubleComplex>(const Arguments&);
+extern template void testing_dotc<hipblasComplex>(const Arguments&);
+extern template void testing_dotc<hipblasDoubleComplex>(const Arguments&);
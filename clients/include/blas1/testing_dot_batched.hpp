@@ -191,6 +191,9 @@ void testing_dot_batched(const Arguments& arg)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             (CONJ ? ref_dotc<T> : ref_dot<T>)(N, hx[b], incx, hy[b], incy, &(h_cpu_result[b]));
@@ -230,11 +233,12 @@ void testing_dot_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_CHECK(hipblasDotBatchedFn,
                        (handle,
@@ -245,8 +249,10 @@ void testing_dot_batched(const Arguments& arg)
                         incy,
                         batch_count,
                         d_hipblas_result));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasDotBatchedModel{}.log_args<T>(std::cout,
                                              arg,
@@ -263,3 +269,13 @@ void testing_dotc_batched(const Arguments& arg)
 {
     testing_dot_batched<T, true>(arg);
 }
+
+// Instantiated in clients/common/blas1/common_dot.cpp
+extern template void testing_dot_batched<float>(const Arguments&);
+extern template void testing_dot_batched<double>(const Arguments&);
+extern template void testing_dot_batched<hipblasHalf>(const Arguments&);
+extern template void testing_dot_batched<hipblasBfloat16>(const Arguments&);
+extern template void testing_dot_batched<hipblasComplex>(const Arguments&);
+extern template void testing_dot_batched<hipblasDoubleComplex>(const Arguments&);
+extern template void testing_dotc_batched<hipblasComplex>(const Arguments&);
+extern template void testing_dotc_batched<hipblasDoubleComplex>(const Arguments&);
@@ -204,6 +204,9 @@ void testing_dot_strided_batched(const Arguments& arg)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             (CONJ ? ref_dotc<T> : ref_dot<T>)(N,
@@ -248,17 +251,20 @@ void testing_dot_strided_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_CHECK(
                 hipblasDotStridedBatchedFn,
                 (handle, N, dx, incx, stridex, dy, incy, stridey, batch_count, d_hipblas_result));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasDotStridedBatchedModel{}.log_args<T>(std::cout,
                                                     arg,
@@ -275,3 +281,13 @@ void testing_dotc_strided_batched(const Arguments& arg)
 {
     testing_dot_strided_batched<T, true>(arg);
 }
+
+// Instantiated in clients/common/blas1/common_dot.cpp
+extern template void testing_dot_strided_batched<float>(const Arguments&);
+extern template void testing_dot_strided_batched<double>(const Arguments&);
+extern template void testing_dot_strided_batched<hipblasHalf>(const Arguments&);
+extern template void testing_dot_strided_batched<hipblasBfloat16>(const Arguments&);
+extern template void testing_dot_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_dot_strided_batched<hipblasDoubleComplex>(const Arguments&);
+extern template void testing_dotc_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_dotc_strided_batched<hipblasDoubleComplex>(const Arguments&);
@@ -180,15 +180,18 @@ void testing_iamax_iamin(const Arguments& arg, FUNC func)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(func(handle, N, dx, incx, d_hipblas_result));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasIamaxIaminModel{}.log_args<T>(std::cout,
                                              arg,
@@ -235,3 +238,13 @@ void testing_iamin(const Arguments& arg)
     else
         testing_iamax_iamin<T, hipblas_iamax_iamin_ref::iamin<T>, int>(arg, hipblasIaminFn);
 }
+
+// Instantiated in clients/common/blas1/common_iamax_iamin.cpp
+extern template void testing_iamax<float>(const Arguments&);
+extern template void testing_iamax<double>(const Arguments&);
+extern template void testing_iamax<hipblasComplex>(const Arguments&);
+extern template void testing_iamax<hipblasDoubleComplex>(const Arguments&);
+extern template void testing_iamin<float>(const Arguments&);
+extern template void testing_iamin<double>(const Arguments&);
+extern template void testing_iamin<hipblasComplex>(const Arguments&);
+extern template void testing_iamin<hipblasDoubleComplex>(const Arguments&);
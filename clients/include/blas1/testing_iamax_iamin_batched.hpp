@@ -194,16 +194,19 @@ void testing_iamax_iamin_batched(const Arguments& arg, FUNC func)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(
                 func(handle, N, dx.ptr_on_device(), incx, batch_count, d_hipblas_result_device));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasIamaxIaminBatchedModel{}.log_args<T>(std::cout,
                                                     arg,
@@ -256,3 +259,13 @@ void testing_iamin_batched(const Arguments& arg)
         testing_iamax_iamin_batched<T, hipblas_iamax_iamin_ref::iamin<T>, int>(
             arg, hipblasIaminBatchedFn);
 }
+
+// Instantiated in clients/common/blas1/common_iamax_iamin.cpp
+extern template void testing_iamax_batched<float>(const Arguments&);
+extern template void testing_iamax_batched<double>(const Arguments&);
+extern template void testing_iamax_batched<hipblasComplex>(const Arguments&);
+extern template void testing_iamax_batched<hipblasDoubleComplex>(const Arguments&);
+extern template void testing_iamin_batched<float>(const Arguments&);
+extern template void testing_iamin_batched<double>(const Arguments&);
+extern template void testing_iamin_batched<hipblasComplex>(const Arguments&);
+extern template void testing_iamin_batched<hipblasDoubleComplex>(const Arguments&);
@@ -209,15 +209,18 @@ void testing_iamax_iamin_strided_batched(const Arguments& arg, FUNC func)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(func(handle, N, dx, incx, stridex, batch_count, d_hipblas_result));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasIamaxIaminStridedBatchedModel{}.log_args<T>(std::cout,
                                                            arg,
@@ -272,3 +275,13 @@ void testing_iamin_strided_batched(const Arguments& arg)
         testing_iamax_iamin_strided_batched<T, hipblas_iamax_iamin_ref::iamin<T>, int>(
             arg, hipblasIaminStridedBatchedFn);
 }
+
+// Instantiated in clients/common/blas1/common_iamax_iamin.cpp
+extern template void testing_iamax_strided_batched<float>(const Arguments&);
+extern template void testing_iamax_strided_batched<double>(const Arguments&);
+extern template void testing_iamax_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_iamax_strided_batched<hipblasDoubleComplex>(const Arguments&);
+extern template void testing_iamin_strided_batched<float>(const Arguments&);
+extern template void testing_iamin_strided_batched<double>(const Arguments&);
+extern template void testing_iamin_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_iamin_strided_batched<hipblasDoubleComplex>(const Arguments&);
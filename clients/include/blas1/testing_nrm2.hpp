@@ -159,15 +159,19 @@ void testing_nrm2(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer  timer(arg, stream);
+        hipblas_rotating_buffers rotating(arg, dx);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
+
+            DAPI_CHECK(hipblasNrm2Fn, (handle, N, rotating(dx, iter), incx, d_hipblas_result));
 
-            DAPI_CHECK(hipblasNrm2Fn, (handle, N, dx, incx, d_hipblas_result));
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasNrm2Model{}.log_args<T>(std::cout,
                                        arg,
@@ -178,3 +182,9 @@ void testing_nrm2(const Arguments& arg)
                                        hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas1/common_nrm2.cpp
+extern template void testing_nrm2<float>(const Arguments&);
+extern template void testing_nrm2<double>(const Arguments&);
+extern template void testing_nrm2<hipblasComplex>(const Arguments&);
+extern template void testing_nrm2<hipblasDoubleComplex>(const Arguments&);
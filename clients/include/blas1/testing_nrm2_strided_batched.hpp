@@ -161,6 +161,9 @@ void testing_nrm2_strided_batched(const Arguments& arg)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_nrm2<T, Tr>(N, hx.data() + b * stridex, incx, &(h_cpu_result[b]));
@@ -191,16 +194,19 @@ void testing_nrm2_strided_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_CHECK(hipblasNrm2StridedBatchedFn,
                        (handle, N, dx, incx, stridex, batch_count, d_hipblas_result));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasNrm2StridedBatchedModel{}.log_args<T>(std::cout,
                                                      arg,
@@ -211,3 +217,9 @@ void testing_nrm2_strided_batched(const Arguments& arg)
                                                      hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas1/common_nrm2.cpp
+extern template void testing_nrm2_strided_batched<float>(const Arguments&);
+extern template void testing_nrm2_strided_batched<double>(const Arguments&);
+extern template void testing_nrm2_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_nrm2_strided_batched<hipblasDoubleComplex>(const Arguments&);
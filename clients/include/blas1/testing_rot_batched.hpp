@@ -142,6 +142,9 @@ void testing_rot_batched(const Arguments& arg)
     // ref_rotg<T, U>(cx, cy, hc, hs);
     // cx[0] = hx[0];
     // cy[0] = hy[0];
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
     for(int64_t b = 0; b < batch_count; b++)
     {
         ref_rot<T, U, V>(N, cx[b], incx, cy[b], incy, *hc, *hs);
@@ -237,11 +240,12 @@ void testing_rot_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_CHECK(hipblasRotBatchedFn,
                        (handle,
@@ -253,8 +257,10 @@ void testing_rot_batched(const Arguments& arg)
                         dc,
                         ds,
                         batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasRotBatchedModel{}.log_args<T>(std::cout,
                                              arg,
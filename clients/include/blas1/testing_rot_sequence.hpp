@@ -0,0 +1,418 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasRotSequenceModel
+    = ArgumentModel<e_a_type, e_side, e_M, e_N, e_lda, e_stride_scale, e_batch_count>;
+
+inline void testname_rot_sequence(const Arguments& arg, std::string& name)
+{
+    hipblasRotSequenceModel{}.test_name(arg, name);
+}
+
+// The rotSequence functions, with the complex types of the tests cast to those of the HIPBLAS_V2
+// interface
+#ifdef HIPBLAS_V2
+template <typename T>
+using hipblas_rot_sequence_type_t = std::conditional_t<
+    std::is_same_v<T, hipblasComplex>,
+    hipComplex,
+    std::conditional_t<std::is_same_v<T, hipblasDoubleComplex>, hipDoubleComplex, T>>;
+#else
+template <typename T>
+using hipblas_rot_sequence_type_t = T;
+#endif
+
+template <typename T>
+hipblasStatus_t hipblasRotSequenceFn(hipblasHandle_t       handle,
+                                     hipblasSideMode_t     side,
+                                     hipblasRotPivot_t     pivot,
+                                     hipblasRotDirection_t direct,
+                                     int                   m,
+                                     int                   n,
+                                     const real_t<T>*      c,
+                                     const T*              s,
+                                     T*                    A,
+                                     int                   lda)
+{
+    using Tc = hipblas_rot_sequence_type_t<T>;
+    auto s_c = (const Tc*)s;
+    auto A_c = (Tc*)A;
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSrotSequence(handle, side, pivot, direct, m, n, c, s_c, A_c, lda);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDrotSequence(handle, side, pivot, direct, m, n, c, s_c, A_c, lda);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCrotSequence(handle, side, pivot, direct, m, n, c, s_c, A_c, lda);
+    else
+        return hipblasZrotSequence(handle, side, pivot, direct, m, n, c, s_c, A_c, lda);
+}
+
+template <typename T>
+hipblasStatus_t hipblasRotSequenceStridedBatchedFn(hipblasHandle_t       handle,
+                                                   hipblasSideMode_t     side,
+                                                   hipblasRotPivot_t     pivot,
+                                                   hipblasRotDirection_t direct,
+                                                   int                   m,
+                                                   int                   n,
+                                                   const real_t<T>*      c,
+                                                   hipblasStride         stride_c,
+                                                   const T*              s,
+                                                   hipblasStride         stride_s,
+                                                   T*                    A,
+                                                   int                   lda,
+                                                   hipblasStride         stride_a,
+                                                   int                   batch_count)
+{
+    using Tc = hipblas_rot_sequence_type_t<T>;
+    auto s_c = (const Tc*)s;
+    auto A_c = (Tc*)A;
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSrotSequenceStridedBatched(handle,
+                                                 side,
+                                                 pivot,
+                                                 direct,
+                                                 m,
+                                                 n,
+                                                 c,
+                                                 stride_c,
+                                                 s_c,
+                                                 stride_s,
+                                                 A_c,
+                                                 lda,
+                                                 stride_a,
+                                                 batch_count);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDrotSequenceStridedBatched(handle,
+                                                 side,
+                                                 pivot,
+                                                 direct,
+                                                 m,
+                                                 n,
+                                                 c,
+                                                 stride_c,
+                                                 s_c,
+                                                 stride_s,
+                                                 A_c,
+                                                 lda,
+                                                 stride_a,
+                                                 batch_count);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCrotSequenceStridedBatched(handle,
+                                                 side,
+                                                 pivot,
+                                                 direct,
+                                                 m,
+                                                 n,
+                                                 c,
+                                                 stride_c,
+                                                 s_c,
+                                                 stride_s,
+                                                 A_c,
+                                                 lda,
+                                                 stride_a,
+                                                 batch_count);
+    else
+        return hipblasZrotSequenceStridedBatched(handle,
+                                                 side,
+                                                 pivot,
+                                                 direct,
+                                                 m,
+                                                 n,
+                                                 c,
+                                                 stride_c,
+                                                 s_c,
+                                                 stride_s,
+                                                 A_c,
+                                                 lda,
+                                                 stride_a,
+                                                 batch_count);
+}
+
+// The rotations one at a time, as LAPACK lasr applies them
+template <typename T, typename U>
+void ref_rot_sequence(bool                  left,
+                      hipblasRotPivot_t     pivot,
+                      hipblasRotDirection_t direct,
+                      int                   m,
+                      int                   n,
+                      const U*              c,
+                      const T*              s,
+                      T*                    A,
+                      int                   lda)
+{
+    int z     = left ? m : n;
+    int lines = left ? n : m;
+    for(int r = 0; r < z - 1; r++)
+    {
+        int k = direct == HIPBLAS_ROT_DIRECTION_FORWARD ? r : z - 2 - r;
+        int p = pivot == HIPBLAS_ROT_PIVOT_TOP ? 0 : k;
+        int q = pivot == HIPBLAS_ROT_PIVOT_BOTTOM ? z - 1 : k + 1;
+        for(int l = 0; l < lines; l++)
+        {
+            T& x = left ? A[p + size_t(l) * lda] : A[l + size_t(p) * lda];
+            T& y = left ? A[q + size_t(l) * lda] : A[l + size_t(q) * lda];
+            T  t = c[k] * x + s[k] * y;
+            y    = c[k] * y - std::conj(s[k]) * x;
+            x    = t;
+        }
+    }
+}
+
+template <typename T>
+void testing_rot_sequence_bad_arg(const Arguments& arg)
+{
+    using U = real_t<T>;
+
+    hipblasLocalHandle handle(arg);
+    int                M           = 20;
+    int                N           = 10;
+    int                lda         = 21;
+    int                batch_count = 2;
+    hipblasStride      stride_a    = hipblasStride(lda) * N;
+
+    auto side   = HIPBLAS_SIDE_LEFT;
+    auto pivot  = HIPBLAS_ROT_PIVOT_VARIABLE;
+    auto direct = HIPBLAS_ROT_DIRECTION_FORWARD;
+
+    device_vector<U>               dc(M * batch_count);
+    device_vector<T>               ds(M * batch_count);
+    device_strided_batch_matrix<T> dA(M, N, lda, stride_a, batch_count);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasRotSequenceFn<T>(nullptr, side, pivot, direct, M, N, dc, ds, dA, lda),
+        HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasRotSequenceFn<T>(handle, HIPBLAS_SIDE_BOTH, pivot, direct, M, N, dc, ds, dA, lda),
+        HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasRotSequenceFn<T>(
+                              handle, side, (hipblasRotPivot_t)3, direct, M, N, dc, ds, dA, lda),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasRotSequenceFn<T>(
+                              handle, side, pivot, (hipblasRotDirection_t)2, M, N, dc, ds, dA, lda),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasRotSequenceFn<T>(handle, side, pivot, direct, -1, N, dc, ds, dA, lda),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasRotSequenceFn<T>(handle, side, pivot, direct, M, N, dc, ds, dA, M - 1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasRotSequenceFn<T>(handle, side, pivot, direct, M, N, nullptr, ds, dA, lda),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasRotSequenceFn<T>(handle, side, pivot, direct, M, N, dc, nullptr, dA, lda),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasRotSequenceFn<T>(handle, side, pivot, direct, M, N, dc, ds, nullptr, lda),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasRotSequenceStridedBatchedFn<T>(handle,
+                                                                side,
+                                                                pivot,
+                                                                direct,
+                                                                M,
+                                                                N,
+                                                                dc,
+                                                                M,
+                                                                ds,
+                                                                M,
+                                                                dA,
+                                                                lda,
+                                                                stride_a,
+                                                                -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // With fewer than two rows from the left, or no columns, there is nothing to rotate
+    CHECK_HIPBLAS_ERROR(
+        hipblasRotSequenceFn<T>(handle, side, pivot, direct, 1, N, nullptr, nullptr, nullptr, lda));
+    CHECK_HIPBLAS_ERROR(
+        hipblasRotSequenceFn<T>(handle, side, pivot, direct, M, 0, nullptr, nullptr, nullptr, lda));
+    CHECK_HIPBLAS_ERROR(hipblasRotSequenceStridedBatchedFn<T>(
+        handle, side, pivot, direct, M, N, nullptr, M, nullptr, M, nullptr, lda, stride_a, 0));
+}
+
+// Every pivot and direction, for a strided batch checked against the rotations one at a time,
+// and for its first matrix alone, which gives the same result exactly
+template <typename T>
+void testing_rot_sequence(const Arguments& arg)
+{
+    using U = real_t<T>;
+
+    hipblasSideMode_t side         = char2hipblas_side(arg.side);
+    bool              left         = side == HIPBLAS_SIDE_LEFT;
+    int               M            = arg.M;
+    int               N            = arg.N;
+    int               lda          = arg.lda;
+    double            stride_scale = arg.stride_scale;
+    int               batch_count  = arg.batch_count;
+    int               z            = left ? M : N;
+
+    // Check to prevent memory allocation error
+    if(M < 1 || N < 1 || z < 2 || lda < M || batch_count <= 0)
+        return;
+
+    hipblasStride stride_c = hipblasStride((z - 1) * stride_scale);
+    hipblasStride stride_a = hipblasStride(lda) * N * stride_scale;
+
+    host_vector<U>               hc(stride_c * batch_count);
+    host_vector<T>               hs(stride_c * batch_count);
+    host_strided_batch_matrix<T> hA(M, N, lda, stride_a, batch_count);
+    host_strided_batch_matrix<T> hA_gold(M, N, lda, stride_a, batch_count);
+    host_strided_batch_matrix<T> hA_gpu(M, N, lda, stride_a, batch_count);
+    host_strided_batch_matrix<T> hA_one(M, N, lda, stride_a, 1);
+
+    CHECK_HIP_ERROR(hA.memcheck());
+
+    device_vector<U>               dc(stride_c * batch_count);
+    device_vector<T>               ds(stride_c * batch_count);
+    device_strided_batch_matrix<T> dA(M, N, lda, stride_a, batch_count);
+
+    CHECK_DEVICE_ALLOCATION(dc.memcheck());
+    CHECK_DEVICE_ALLOCATION(ds.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+
+    double             gpu_time_used, hipblas_error = 0;
+    hipblasLocalHandle handle(arg);
+
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+
+    // cosines and sines of random angles, with a random phase for the complex sines
+    for(size_t k = 0; k < hc.size(); k++)
+    {
+        U angle = random_generator<U>();
+        hc[k]   = std::cos(angle);
+        if constexpr(is_complex<T>)
+        {
+            U phase = random_generator<U>();
+            hs[k]   = T(std::sin(angle) * std::cos(phase), std::sin(angle) * std::sin(phase));
+        }
+        else
+            hs[k] = std::sin(angle);
+    }
+
+    CHECK_HIP_ERROR(dc.transfer_from(hc));
+    CHECK_HIP_ERROR(ds.transfer_from(hs));
+
+    const hipblasRotPivot_t pivots[] = {
+        HIPBLAS_ROT_PIVOT_VARIABLE, HIPBLAS_ROT_PIVOT_TOP, HIPBLAS_ROT_PIVOT_BOTTOM};
+    const hipblasRotDirection_t directions[]
+        = {HIPBLAS_ROT_DIRECTION_FORWARD, HIPBLAS_ROT_DIRECTION_BACKWARD};
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        for(auto pivot : pivots)
+        {
+            for(auto direct : directions)
+            {
+                CHECK_HIP_ERROR(dA.transfer_from(hA));
+                CHECK_HIPBLAS_ERROR(hipblasRotSequenceStridedBatchedFn<T>(handle,
+                                                                          side,
+                                                                          pivot,
+                                                                          direct,
+                                                                          M,
+                                                                          N,
+                                                                          dc,
+                                                                          stride_c,
+                                                                          ds,
+                                                                          stride_c,
+                                                                          dA,
+                                                                          lda,
+                                                                          stride_a,
+                                                                          batch_count));
+                CHECK_HIP_ERROR(hA_gpu.transfer_from(dA));
+
+                hA_gold.copy_from(hA);
+                for(int b = 0; b < batch_count; b++)
+                {
+                    ref_rot_sequence(left,
+                                     pivot,
+                                     direct,
+                                     M,
+                                     N,
+                                     &hc[b * stride_c],
+                                     &hs[b * stride_c],
+                                     hA_gold[b],
+                                     lda);
+                    hipblas_error = std::max(
+                        hipblas_error,
+                        norm_check_general<T>('F', M, N, lda, hA_gold[b], hA_gpu[b]));
+                }
+
+                // the first matrix on its own
+                CHECK_HIP_ERROR(dA.transfer_from(hA));
+                CHECK_HIPBLAS_ERROR(
+                    hipblasRotSequenceFn<T>(handle, side, pivot, direct, M, N, dc, ds, dA, lda));
+                CHECK_HIP_ERROR(hA_one.transfer_from(dA));
+                unit_check_general<T>(M, N, lda, hA_gpu[0], hA_one[0]);
+            }
+        }
+
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = eps * 4 * z;
+            unit_check_error(hipblas_error, tolerance);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        hipblas_iteration_timer timer(arg, stream);
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            timer.start(iter);
+
+            CHECK_HIPBLAS_ERROR(hipblasRotSequenceStridedBatchedFn<T>(handle,
+                                                                      side,
+                                                                      HIPBLAS_ROT_PIVOT_VARIABLE,
+                                                                      HIPBLAS_ROT_DIRECTION_FORWARD,
+                                                                      M,
+                                                                      N,
+                                                                      dc,
+                                                                      stride_c,
+                                                                      ds,
+                                                                      stride_c,
+                                                                      dA,
+                                                                      lda,
+                                                                      stride_a,
+                                                                      batch_count));
+
+            timer.stop(iter);
+        }
+        gpu_time_used = timer.elapsed_us();
+
+        // 6 flops for each pair of real elements rotated, 24 for a pair of complex ones
+        double pairs  = double(z - 1) * (left ? N : M) * batch_count;
+        double gflops = pairs * (is_complex<T> ? 24 : 6) / 1e9;
+        hipblasRotSequenceModel{}.log_args<T>(
+            std::cout, arg, gpu_time_used, gflops, ArgumentLogging::NA_value, hipblas_error);
+    }
+}
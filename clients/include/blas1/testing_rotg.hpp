@@ -166,15 +166,18 @@ void testing_rotg(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_CHECK(hipblasRotgFn, (handle, da, db, dc, ds));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasRotgModel{}.log_args<T>(std::cout,
                                        arg,
@@ -185,3 +188,9 @@ void testing_rotg(const Arguments& arg)
                                        hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas1/common_rotg.cpp
+extern template void testing_rotg<float>(const Arguments&);
+extern template void testing_rotg<double>(const Arguments&);
+extern template void testing_rotg<hipblasComplex>(const Arguments&);
+extern template void testing_rotg<hipblasDoubleComplex>(const Arguments&);
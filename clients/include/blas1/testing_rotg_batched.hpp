@@ -165,6 +165,9 @@ void testing_rotg_batched(const Arguments& arg)
         CHECK_HIP_ERROR(rs.transfer_from(ds));
 
         // CBLAS
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_rotg<T, U>(ca[b], cb[b], cc[b], cs[b]);
@@ -206,11 +209,12 @@ void testing_rotg_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_CHECK(hipblasRotgBatchedFn,
                        (handle,
@@ -219,8 +223,10 @@ void testing_rotg_batched(const Arguments& arg)
                         dc.ptr_on_device(),
                         ds.ptr_on_device(),
                         batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasRotgBatchedModel{}.log_args<T>(std::cout,
                                               arg,
@@ -231,3 +237,9 @@ void testing_rotg_batched(const Arguments& arg)
                                               hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas1/common_rotg.cpp
+extern template void testing_rotg_batched<float>(const Arguments&);
+extern template void testing_rotg_batched<double>(const Arguments&);
+extern template void testing_rotg_batched<hipblasComplex>(const Arguments&);
+extern template void testing_rotg_batched<hipblasDoubleComplex>(const Arguments&);
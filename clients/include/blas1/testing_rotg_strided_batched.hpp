@@ -167,6 +167,9 @@ void testing_rotg_strided_batched(const Arguments& arg)
         CHECK_HIP_ERROR(rc.transfer_from(dc));
         CHECK_HIP_ERROR(rs.transfer_from(ds));
 
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_rotg<T, U>(ca.data() + b * stride_a,
@@ -215,17 +218,20 @@ void testing_rotg_strided_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_CHECK(
                 hipblasRotgStridedBatchedFn,
                 (handle, da, stride_a, db, stride_b, dc, stride_c, ds, stride_s, batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasRotgStridedBatchedModel{}.log_args<T>(std::cout,
                                                      arg,
@@ -236,3 +242,9 @@ void testing_rotg_strided_batched(const Arguments& arg)
                                                      hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas1/common_rotg.cpp
+extern template void testing_rotg_strided_batched<float>(const Arguments&);
+extern template void testing_rotg_strided_batched<double>(const Arguments&);
+extern template void testing_rotg_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_rotg_strided_batched<hipblasDoubleComplex>(const Arguments&);
@@ -215,15 +215,18 @@ void testing_rotm(const Arguments& arg)
         CHECK_HIP_ERROR(dy.transfer_from(hy));
         CHECK_HIP_ERROR(dparam.transfer_from(hparam));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_CHECK(hipblasRotmFn, (handle, N, dx, incx, dy, incy, dparam));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasRotmModel{}.log_args<T>(std::cout,
                                        arg,
@@ -234,3 +237,7 @@ void testing_rotm(const Arguments& arg)
                                        hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas1/common_rotm.cpp
+extern template void testing_rotm<float>(const Arguments&);
+extern template void testing_rotm<double>(const Arguments&);
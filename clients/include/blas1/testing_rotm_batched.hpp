@@ -126,6 +126,9 @@ void testing_rotm_batched(const Arguments& arg)
     hipblas_init_vector(hy, arg, hipblas_client_alpha_sets_nan, false);
     hipblas_init_vector(hdata, arg, hipblas_client_alpha_sets_nan, false);
 
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
     for(int64_t b = 0; b < batch_count; b++)
         ref_rotmg<T>(&hdata[b][0], &hdata[b][1], &hdata[b][2], &hdata[b][3], hparam[b]);
 
@@ -166,6 +169,9 @@ void testing_rotm_batched(const Arguments& arg)
             cx.copy_from(hx);
             cy.copy_from(hy);
 
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
             for(int64_t b = 0; b < batch_count; b++)
             {
                 // CPU BLAS reference data
@@ -204,11 +210,12 @@ void testing_rotm_batched(const Arguments& arg)
         CHECK_HIP_ERROR(dy.transfer_from(hy));
         CHECK_HIP_ERROR(dparam.transfer_from(hparam));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_CHECK(hipblasRotmBatchedFn,
                        (handle,
@@ -219,8 +226,10 @@ void testing_rotm_batched(const Arguments& arg)
                         incy,
                         dparam.ptr_on_device(),
                         batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasRotmBatchedModel{}.log_args<T>(std::cout,
                                               arg,
@@ -231,3 +240,7 @@ void testing_rotm_batched(const Arguments& arg)
                                               hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas1/common_rotm.cpp
+extern template void testing_rotm_batched<float>(const Arguments&);
+extern template void testing_rotm_batched<double>(const Arguments&);
@@ -179,6 +179,9 @@ void testing_rotm_strided_batched(const Arguments& arg)
     // that it zeros out the second element of the rotm vector parameter
     hipblas_init_vector_zero<T>(hparam);
 
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
     for(int64_t b = 0; b < batch_count; b++)
         ref_rotmg<T>(&hdata[b][0], &hdata[b][1], &hdata[b][2], &hdata[b][3], hparam[b]);
 
@@ -225,6 +228,9 @@ void testing_rotm_strided_batched(const Arguments& arg)
             cy.copy_from(hy);
 
             // CPU BLAS reference data
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
             for(int64_t b = 0; b < batch_count; b++)
             {
                 ref_rotm<T>(N, cx[b], incx, cy[b], incy, hparam[b]);
@@ -258,11 +264,12 @@ void testing_rotm_strided_batched(const Arguments& arg)
         CHECK_HIP_ERROR(dy.transfer_from(hy));
         CHECK_HIP_ERROR(dparam.transfer_from(hparam));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_CHECK(hipblasRotmStridedBatchedFn,
                        (handle,
@@ -276,8 +283,10 @@ void testing_rotm_strided_batched(const Arguments& arg)
                         dparam,
                         stride_param,
                         batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasRotmStridedBatchedModel{}.log_args<T>(std::cout,
                                                      arg,
@@ -288,3 +297,7 @@ void testing_rotm_strided_batched(const Arguments& arg)
                                                      hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas1/common_rotm.cpp
+extern template void testing_rotm_strided_batched<float>(const Arguments&);
+extern template void testing_rotm_strided_batched<double>(const Arguments&);
@@ -131,16 +131,19 @@ void testing_rotmg(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_CHECK(hipblasRotmgFn,
                        (handle, dparams, dparams + 1, dparams + 2, dparams + 3, dparams + 4));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasRotmgModel{}.log_args<T>(std::cout,
                                         arg,
@@ -151,3 +154,7 @@ void testing_rotmg(const Arguments& arg)
                                         hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas1/common_rotmg.cpp
+extern template void testing_rotmg<float>(const Arguments&);
+extern template void testing_rotmg<double>(const Arguments&);
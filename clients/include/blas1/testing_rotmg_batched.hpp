@@ -171,6 +171,9 @@ void testing_rotmg_batched(const Arguments& arg)
         CHECK_HIP_ERROR(hparams_d.transfer_from(dparams));
 
         // CBLAS
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_rotmg<T>(cd1[b], cd2[b], cx1[b], cy1[b], cparams[b]);
@@ -218,11 +221,12 @@ void testing_rotmg_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_CHECK(hipblasRotmgBatchedFn,
                        (handle,
@@ -232,8 +236,10 @@ void testing_rotmg_batched(const Arguments& arg)
                         dy1.ptr_on_device(),
                         dparams.ptr_on_device(),
                         batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasRotmgBatchedModel{}.log_args<T>(std::cout,
                                                arg,
@@ -244,3 +250,7 @@ void testing_rotmg_batched(const Arguments& arg)
                                                hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas1/common_rotmg.cpp
+extern template void testing_rotmg_batched<float>(const Arguments&);
+extern template void testing_rotmg_batched<double>(const Arguments&);
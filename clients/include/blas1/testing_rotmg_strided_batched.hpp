@@ -266,6 +266,9 @@ void testing_rotmg_strided_batched(const Arguments& arg)
         CHECK_HIP_ERROR(hy1_d.transfer_from(dy1));
         CHECK_HIP_ERROR(hparams_d.transfer_from(dparams));
 
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_rotmg<T>(cd1[b], cd2[b], cx1[b], cy1[b], cparams[b]);
@@ -319,11 +322,12 @@ void testing_rotmg_strided_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_CHECK(hipblasRotmgStridedBatchedFn,
                        (handle,
@@ -338,8 +342,10 @@ void testing_rotmg_strided_batched(const Arguments& arg)
                         dparams,
                         stride_param,
                         batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasRotmgStridedBatchedModel{}.log_args<T>(std::cout,
                                                       arg,
@@ -350,3 +356,7 @@ void testing_rotmg_strided_batched(const Arguments& arg)
                                                       hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas1/common_rotmg.cpp
+extern template void testing_rotmg_strided_batched<float>(const Arguments&);
+extern template void testing_rotmg_strided_batched<double>(const Arguments&);
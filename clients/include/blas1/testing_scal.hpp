@@ -151,15 +151,19 @@ void testing_scal(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer  timer(arg, stream);
+        hipblas_rotating_buffers rotating(arg, dx);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
+
+            DAPI_CHECK(hipblasScalFn, (handle, N, &alpha, rotating(dx, iter), incx));
 
-            DAPI_CHECK(hipblasScalFn, (handle, N, &alpha, dx, incx));
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasScalModel{}.log_args<T>(std::cout,
                                        arg,
@@ -169,3 +173,9 @@ void testing_scal(const Arguments& arg)
                                        hipblas_error);
     }
 }
+
+// Instantiated in clients/common/blas1/common_scal.cpp
+extern template void testing_scal<float>(const Arguments&);
+extern template void testing_scal<double>(const Arguments&);
+extern template void testing_scal<hipblasComplex>(const Arguments&);
+extern template void testing_scal<hipblasDoubleComplex>(const Arguments&);
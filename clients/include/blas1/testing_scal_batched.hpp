@@ -133,6 +133,9 @@ void testing_scal_batched(const Arguments& arg)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_scal<T, U>(N, alpha, hz[b], incx);
@@ -156,16 +159,19 @@ void testing_scal_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_CHECK(hipblasScalBatchedFn,
                        (handle, N, &alpha, dx.ptr_on_device(), incx, batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasScalBatchedModel{}.log_args<T>(std::cout,
                                               arg,
@@ -175,3 +181,9 @@ void testing_scal_batched(const Arguments& arg)
                                               hipblas_error);
     }
 }
+
+// Instantiated in clients/common/blas1/common_scal.cpp
+extern template void testing_scal_batched<float>(const Arguments&);
+extern template void testing_scal_batched<double>(const Arguments&);
+extern template void testing_scal_batched<hipblasComplex>(const Arguments&);
+extern template void testing_scal_batched<hipblasDoubleComplex>(const Arguments&);
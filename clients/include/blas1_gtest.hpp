@@ -65,4 +65,5 @@ enum class blas1
     rotmg,
     rotmg_batched,
     rotmg_strided_batched,
+    rot_sequence,
 };
@@ -389,17 +389,20 @@ void testing_gbmv(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(
                 hipblasGbmvFn,
                 (handle, transA, M, N, KL, KU, d_alpha, dA, lda, dx, incx, d_beta, dy, incy));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasGbmvModel{}.log_args<T>(std::cout,
                                        arg,
@@ -410,3 +413,9 @@ void testing_gbmv(const Arguments& arg)
                                        hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_gbmv.cpp
+extern template void testing_gbmv<float>(const Arguments&);
+extern template void testing_gbmv<double>(const Arguments&);
+extern template void testing_gbmv<hipblasComplex>(const Arguments&);
+extern template void testing_gbmv<hipblasDoubleComplex>(const Arguments&);
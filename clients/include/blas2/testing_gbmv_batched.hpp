@@ -496,6 +496,9 @@ void testing_gbmv_batched(const Arguments& arg)
            CPU BLAS
         =================================================================== */
 
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(size_t b = 0; b < batch_count; b++)
         {
             ref_gbmv<T>(
@@ -526,11 +529,12 @@ void testing_gbmv_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasGbmvBatchedFn,
                           (handle,
@@ -548,8 +552,10 @@ void testing_gbmv_batched(const Arguments& arg)
                            dy.ptr_on_device(),
                            incy,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasGbmvBatchedModel{}.log_args<T>(std::cout,
                                               arg,
@@ -560,3 +566,9 @@ void testing_gbmv_batched(const Arguments& arg)
                                               hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_gbmv.cpp
+extern template void testing_gbmv_batched<float>(const Arguments&);
+extern template void testing_gbmv_batched<double>(const Arguments&);
+extern template void testing_gbmv_batched<hipblasComplex>(const Arguments&);
+extern template void testing_gbmv_batched<hipblasDoubleComplex>(const Arguments&);
@@ -559,6 +559,9 @@ void testing_gbmv_strided_batched(const Arguments& arg)
            CPU BLAS
         =================================================================== */
 
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(size_t b = 0; b < batch_count; b++)
         {
             ref_gbmv<T>(
@@ -589,11 +592,12 @@ void testing_gbmv_strided_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasGbmvStridedBatchedFn,
                           (handle,
@@ -614,8 +618,10 @@ void testing_gbmv_strided_batched(const Arguments& arg)
                            incy,
                            stride_y,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasGbmvStridedBatchedModel{}.log_args<T>(std::cout,
                                                      arg,
@@ -626,3 +632,9 @@ void testing_gbmv_strided_batched(const Arguments& arg)
                                                      hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_gbmv.cpp
+extern template void testing_gbmv_strided_batched<float>(const Arguments&);
+extern template void testing_gbmv_strided_batched<double>(const Arguments&);
+extern template void testing_gbmv_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_gbmv_strided_batched<hipblasDoubleComplex>(const Arguments&);
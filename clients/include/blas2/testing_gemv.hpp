@@ -319,18 +319,31 @@ void testing_gemv(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
         CHECK_HIP_ERROR(dy.transfer_from(hy));
 
+        hipblas_iteration_timer  timer(arg, stream);
+        hipblas_rotating_buffers rotating(arg, dA, dx, dy);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-            {
-                gpu_time_used = get_time_us_sync(stream);
-            }
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasGemvFn,
-                          (handle, transA, M, N, d_alpha, dA, lda, dx, incx, d_beta, dy, incy));
+                          (handle,
+                           transA,
+                           M,
+                           N,
+                           d_alpha,
+                           rotating(dA, iter),
+                           lda,
+                           rotating(dx, iter),
+                           incx,
+                           d_beta,
+                           rotating(dy, iter),
+                           incy));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasGemvModel{}.log_args<T>(std::cout,
                                        arg,
@@ -341,3 +354,9 @@ void testing_gemv(const Arguments& arg)
                                        hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_gemv.cpp
+extern template void testing_gemv<float>(const Arguments&);
+extern template void testing_gemv<double>(const Arguments&);
+extern template void testing_gemv<hipblasComplex>(const Arguments&);
+extern template void testing_gemv<hipblasDoubleComplex>(const Arguments&);
@@ -464,6 +464,9 @@ void testing_gemv_batched(const Arguments& arg)
            CPU BLAS
         =================================================================== */
 
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(size_t b = 0; b < batch_count; b++)
         {
             ref_gemv<T>(transA, M, N, h_alpha, hA[b], lda, hx[b], incx, h_beta, hy_cpu[b], incy);
@@ -493,13 +496,12 @@ void testing_gemv_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-            {
-                gpu_time_used = get_time_us_sync(stream);
-            }
+            timer.start(iter);
             DAPI_DISPATCH(hipblasGemvBatchedFn,
                           (handle,
                            transA,
@@ -514,8 +516,10 @@ void testing_gemv_batched(const Arguments& arg)
                            dy.ptr_on_device(),
                            incy,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasGemvBatchedModel{}.log_args<T>(std::cout,
                                               arg,
@@ -526,3 +530,9 @@ void testing_gemv_batched(const Arguments& arg)
                                               hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_gemv.cpp
+extern template void testing_gemv_batched<float>(const Arguments&);
+extern template void testing_gemv_batched<double>(const Arguments&);
+extern template void testing_gemv_batched<hipblasComplex>(const Arguments&);
+extern template void testing_gemv_batched<hipblasDoubleComplex>(const Arguments&);
@@ -302,6 +302,9 @@ void testing_ger_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(size_t b = 0; b < batch_count; b++)
         {
             ref_ger<T, CONJ>(M, N, h_alpha, hx[b], incx, hy[b], incy, hA_cpu[b], lda);
@@ -331,11 +334,12 @@ void testing_ger_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasGerBatchedFn,
                           (handle,
@@ -349,8 +353,10 @@ void testing_ger_batched(const Arguments& arg)
                            dA.ptr_on_device(),
                            lda,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasGerBatchedModel{}.log_args<T>(std::cout,
                                              arg,
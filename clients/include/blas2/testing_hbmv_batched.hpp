@@ -413,6 +413,9 @@ void testing_hbmv_batched(const Arguments& arg)
            CPU BLAS
         =================================================================== */
 
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(size_t b = 0; b < batch_count; b++)
         {
             ref_hbmv<T>(uplo, N, K, h_alpha, hA[b], lda, hx[b], incx, h_beta, hy_cpu[b], incy);
@@ -442,11 +445,12 @@ void testing_hbmv_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasHbmvBatchedFn,
                           (handle,
@@ -462,8 +466,10 @@ void testing_hbmv_batched(const Arguments& arg)
                            dy.ptr_on_device(),
                            incy,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasHbmvBatchedModel{}.log_args<T>(std::cout,
                                               arg,
@@ -474,3 +480,7 @@ void testing_hbmv_batched(const Arguments& arg)
                                               hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_hbmv.cpp
+extern template void testing_hbmv_batched<hipblasComplex>(const Arguments&);
+extern template void testing_hbmv_batched<hipblasDoubleComplex>(const Arguments&);
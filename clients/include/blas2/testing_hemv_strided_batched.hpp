@@ -465,6 +465,9 @@ void testing_hemv_strided_batched(const Arguments& arg)
            CPU BLAS
         =================================================================== */
 
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(size_t b = 0; b < batch_count; b++)
         {
             ref_hemv<T>(uplo, N, h_alpha, hA[b], lda, hx[b], incx, h_beta, hy_cpu[b], incy);
@@ -494,11 +497,12 @@ void testing_hemv_strided_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasHemvStridedBatchedFn,
                           (handle,
@@ -516,8 +520,10 @@ void testing_hemv_strided_batched(const Arguments& arg)
                            incy,
                            stride_y,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasHemvStridedBatchedModel{}.log_args<T>(std::cout,
                                                      arg,
@@ -528,3 +534,7 @@ void testing_hemv_strided_batched(const Arguments& arg)
                                                      hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_hemv.cpp
+extern template void testing_hemv_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_hemv_strided_batched<hipblasDoubleComplex>(const Arguments&);
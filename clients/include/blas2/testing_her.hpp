@@ -221,14 +221,17 @@ void testing_her(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
             DAPI_DISPATCH(hipblasHerFn, (handle, uplo, N, d_alpha, dx, incx, dA, lda));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasHerModel{}.log_args<U>(std::cout,
                                       arg,
@@ -239,3 +242,7 @@ void testing_her(const Arguments& arg)
                                       hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_her.cpp
+extern template void testing_her<hipblasComplex>(const Arguments&);
+extern template void testing_her<hipblasDoubleComplex>(const Arguments&);
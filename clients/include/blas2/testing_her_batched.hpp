@@ -248,6 +248,9 @@ void testing_her_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(size_t b = 0; b < batch_count; b++)
         {
             ref_her<T>(uplo, N, h_alpha, hx[b], incx, hA_cpu[b], lda);
@@ -277,11 +280,12 @@ void testing_her_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasHerBatchedFn,
                           (handle,
@@ -293,8 +297,10 @@ void testing_her_batched(const Arguments& arg)
                            dA.ptr_on_device(),
                            lda,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasHerBatchedModel{}.log_args<U>(std::cout,
                                              arg,
@@ -305,3 +311,7 @@ void testing_her_batched(const Arguments& arg)
                                              hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_her.cpp
+extern template void testing_her_batched<hipblasComplex>(const Arguments&);
+extern template void testing_her_batched<hipblasDoubleComplex>(const Arguments&);
@@ -276,16 +276,19 @@ void testing_hpmv(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasHpmvFn,
                           (handle, uplo, N, d_alpha, dAp, dx, incx, d_beta, dy, incy));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasHpmvModel{}.log_args<T>(std::cout,
                                        arg,
@@ -296,3 +299,7 @@ void testing_hpmv(const Arguments& arg)
                                        hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_hpmv.cpp
+extern template void testing_hpmv<hipblasComplex>(const Arguments&);
+extern template void testing_hpmv<hipblasDoubleComplex>(const Arguments&);
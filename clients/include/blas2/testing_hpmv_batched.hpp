@@ -385,6 +385,9 @@ void testing_hpmv_batched(const Arguments& arg)
            CPU BLAS
         =================================================================== */
 
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(size_t b = 0; b < batch_count; b++)
         {
             ref_hpmv<T>(uplo, N, h_alpha, hAp[b], hx[b], incx, h_beta, hy_cpu[b], incy);
@@ -414,11 +417,12 @@ void testing_hpmv_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasHpmvBatchedFn(handle,
                                                      uplo,
@@ -431,8 +435,10 @@ void testing_hpmv_batched(const Arguments& arg)
                                                      dy.ptr_on_device(),
                                                      incy,
                                                      batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasHpmvBatchedModel{}.log_args<T>(std::cout,
                                               arg,
@@ -443,3 +449,7 @@ void testing_hpmv_batched(const Arguments& arg)
                                               hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_hpmv.cpp
+extern template void testing_hpmv_batched<hipblasComplex>(const Arguments&);
+extern template void testing_hpmv_batched<hipblasDoubleComplex>(const Arguments&);
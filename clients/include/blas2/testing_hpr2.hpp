@@ -249,15 +249,18 @@ void testing_hpr2(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasHpr2Fn, (handle, uplo, N, d_alpha, dx, incx, dy, incy, dAp));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasHpr2Model{}.log_args<T>(std::cout,
                                        arg,
@@ -268,3 +271,7 @@ void testing_hpr2(const Arguments& arg)
                                        hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_hpr2.cpp
+extern template void testing_hpr2<hipblasComplex>(const Arguments&);
+extern template void testing_hpr2<hipblasDoubleComplex>(const Arguments&);
@@ -322,6 +322,9 @@ void testing_hpr2_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(size_t b = 0; b < batch_count; b++)
         {
             ref_hpr2<T>(uplo, N, h_alpha, hx[b], incx, hy[b], incy, hAp_cpu[b]);
@@ -351,11 +354,12 @@ void testing_hpr2_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasHpr2BatchedFn,
                           (handle,
@@ -368,8 +372,10 @@ void testing_hpr2_batched(const Arguments& arg)
                            incy,
                            dAp.ptr_on_device(),
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasHpr2BatchedModel{}.log_args<T>(std::cout,
                                               arg,
@@ -380,3 +386,7 @@ void testing_hpr2_batched(const Arguments& arg)
                                               hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_hpr2.cpp
+extern template void testing_hpr2_batched<hipblasComplex>(const Arguments&);
+extern template void testing_hpr2_batched<hipblasDoubleComplex>(const Arguments&);
@@ -412,6 +412,9 @@ void testing_hpr2_strided_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(size_t b = 0; b < batch_count; b++)
         {
             ref_hpr2<T>(uplo, N, h_alpha, hx[b], incx, hy[b], incy, hAp_cpu[b]);
@@ -443,11 +446,12 @@ void testing_hpr2_strided_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasHpr2StridedBatchedFn(handle,
                                                             uplo,
@@ -462,8 +466,10 @@ void testing_hpr2_strided_batched(const Arguments& arg)
                                                             dAp,
                                                             stride_A,
                                                             batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasHpr2StridedBatchedModel{}.log_args<T>(std::cout,
                                                      arg,
@@ -474,3 +480,7 @@ void testing_hpr2_strided_batched(const Arguments& arg)
                                                      hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_hpr2.cpp
+extern template void testing_hpr2_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_hpr2_strided_batched<hipblasDoubleComplex>(const Arguments&);
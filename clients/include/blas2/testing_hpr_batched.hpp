@@ -236,6 +236,9 @@ void testing_hpr_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(size_t b = 0; b < batch_count; b++)
         {
             ref_hpr<T>(uplo, N, h_alpha, hx[b], incx, hAp_cpu[b]);
@@ -265,11 +268,12 @@ void testing_hpr_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasHprBatchedFn,
                           (handle,
@@ -280,8 +284,10 @@ void testing_hpr_batched(const Arguments& arg)
                            incx,
                            dAp.ptr_on_device(),
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasHprBatchedModel{}.log_args<U>(std::cout,
                                              arg,
@@ -292,3 +298,7 @@ void testing_hpr_batched(const Arguments& arg)
                                              hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_hpr.cpp
+extern template void testing_hpr_batched<hipblasComplex>(const Arguments&);
+extern template void testing_hpr_batched<hipblasDoubleComplex>(const Arguments&);
@@ -256,6 +256,9 @@ void testing_hpr_strided_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(size_t b = 0; b < batch_count; b++)
         {
             ref_hpr<T>(uplo, N, h_alpha, hx[b], incx, hAp_cpu[b]);
@@ -287,17 +290,20 @@ void testing_hpr_strided_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(
                 hipblasHprStridedBatchedFn,
                 (handle, uplo, N, d_alpha, dx, incx, stride_x, dAp, stride_A, batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasHprStridedBatchedModel{}.log_args<U>(std::cout,
                                                     arg,
@@ -308,3 +314,7 @@ void testing_hpr_strided_batched(const Arguments& arg)
                                                     hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_hpr.cpp
+extern template void testing_hpr_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_hpr_strided_batched<hipblasDoubleComplex>(const Arguments&);
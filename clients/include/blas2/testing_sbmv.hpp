@@ -282,16 +282,19 @@ void testing_sbmv(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasSbmvFn,
                           (handle, uplo, N, K, d_alpha, dA, lda, dx, incx, d_beta, dy, incy));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasSbmvModel{}.log_args<T>(std::cout,
                                        arg,
@@ -302,3 +305,7 @@ void testing_sbmv(const Arguments& arg)
                                        hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_sbmv.cpp
+extern template void testing_sbmv<float>(const Arguments&);
+extern template void testing_sbmv<double>(const Arguments&);
@@ -425,6 +425,9 @@ void testing_sbmv_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_sbmv<T>(uplo, N, K, h_alpha, hA[b], lda, hx[b], incx, h_beta, hy_cpu[b], incy);
@@ -454,13 +457,12 @@ void testing_sbmv_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-            {
-                gpu_time_used = get_time_us_sync(stream);
-            }
+            timer.start(iter);
             DAPI_DISPATCH(hipblasSbmvBatchedFn,
                           (handle,
                            uplo,
@@ -475,8 +477,10 @@ void testing_sbmv_batched(const Arguments& arg)
                            dy.ptr_on_device(),
                            incy,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasSbmvBatchedModel{}.log_args<T>(std::cout,
                                               arg,
@@ -487,3 +491,7 @@ void testing_sbmv_batched(const Arguments& arg)
                                               hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_sbmv.cpp
+extern template void testing_sbmv_batched<float>(const Arguments&);
+extern template void testing_sbmv_batched<double>(const Arguments&);
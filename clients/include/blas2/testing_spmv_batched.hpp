@@ -384,6 +384,9 @@ void testing_spmv_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_spmv<T>(uplo, N, h_alpha, hAp[b], hx[b], incx, h_beta, hy_cpu[b], incy);
@@ -412,13 +415,12 @@ void testing_spmv_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-            {
-                gpu_time_used = get_time_us_sync(stream);
-            }
+            timer.start(iter);
             DAPI_DISPATCH(hipblasSpmvBatchedFn,
                           (handle,
                            uplo,
@@ -431,8 +433,10 @@ void testing_spmv_batched(const Arguments& arg)
                            dy.ptr_on_device(),
                            incy,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasSpmvBatchedModel{}.log_args<T>(std::cout,
                                               arg,
@@ -443,3 +447,7 @@ void testing_spmv_batched(const Arguments& arg)
                                               hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_spmv.cpp
+extern template void testing_spmv_batched<float>(const Arguments&);
+extern template void testing_spmv_batched<double>(const Arguments&);
@@ -467,6 +467,9 @@ void testing_spmv_strided_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_spmv<T>(uplo, N, h_alpha, hAp[b], hx[b], incx, h_beta, hy_cpu[b], incy);
@@ -495,13 +498,12 @@ void testing_spmv_strided_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-            {
-                gpu_time_used = get_time_us_sync(stream);
-            }
+            timer.start(iter);
             DAPI_DISPATCH(hipblasSpmvStridedBatchedFn,
                           (handle,
                            uplo,
@@ -517,9 +519,11 @@ void testing_spmv_strided_batched(const Arguments& arg)
                            incy,
                            stride_y,
                            batch_count));
+
+            timer.stop(iter);
         }
 
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasSpmvStridedBatchedModel{}.log_args<T>(std::cout,
                                                      arg,
@@ -530,3 +534,7 @@ void testing_spmv_strided_batched(const Arguments& arg)
                                                      hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_spmv.cpp
+extern template void testing_spmv_strided_batched<float>(const Arguments&);
+extern template void testing_spmv_strided_batched<double>(const Arguments&);
@@ -223,15 +223,18 @@ void testing_spr(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasSprFn, (handle, uplo, N, d_alpha, dx, incx, dAp));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasSprModel{}.log_args<T>(std::cout,
                                       arg,
@@ -242,3 +245,9 @@ void testing_spr(const Arguments& arg)
                                       hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_spr.cpp
+extern template void testing_spr<float>(const Arguments&);
+extern template void testing_spr<double>(const Arguments&);
+extern template void testing_spr<hipblasComplex>(const Arguments&);
+extern template void testing_spr<hipblasDoubleComplex>(const Arguments&);
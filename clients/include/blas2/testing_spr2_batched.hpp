@@ -317,6 +317,9 @@ void testing_spr2_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_spr2<T>(uplo, N, h_alpha, hx[b], incx, hy[b], incy, hAp_cpu[b]);
@@ -345,11 +348,12 @@ void testing_spr2_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasSpr2BatchedFn,
                           (handle,
@@ -362,8 +366,10 @@ void testing_spr2_batched(const Arguments& arg)
                            incy,
                            dAp.ptr_on_device(),
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasSpr2BatchedModel{}.log_args<T>(std::cout,
                                               arg,
@@ -374,3 +380,7 @@ void testing_spr2_batched(const Arguments& arg)
                                               hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_spr2.cpp
+extern template void testing_spr2_batched<float>(const Arguments&);
+extern template void testing_spr2_batched<double>(const Arguments&);
@@ -408,6 +408,9 @@ void testing_spr2_strided_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_spr2<T>(uplo, N, h_alpha, hx[b], incx, hy[b], incy, hAp_cpu[b]);
@@ -436,11 +439,12 @@ void testing_spr2_strided_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasSpr2StridedBatchedFn,
                           (handle,
@@ -456,8 +460,10 @@ void testing_spr2_strided_batched(const Arguments& arg)
                            dAp,
                            stride_A,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasSpr2StridedBatchedModel{}.log_args<T>(std::cout,
                                                      arg,
@@ -468,3 +474,7 @@ void testing_spr2_strided_batched(const Arguments& arg)
                                                      hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_spr2.cpp
+extern template void testing_spr2_strided_batched<float>(const Arguments&);
+extern template void testing_spr2_strided_batched<double>(const Arguments&);
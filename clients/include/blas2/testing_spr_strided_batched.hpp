@@ -249,6 +249,9 @@ void testing_spr_strided_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_spr<T>(uplo, N, h_alpha, hx[b], incx, hAp_cpu[b]);
@@ -277,17 +280,20 @@ void testing_spr_strided_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(
                 hipblasSprStridedBatchedFn,
                 (handle, uplo, N, d_alpha, dx, incx, stride_x, dAp, stride_A, batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasSprStridedBatchedModel{}.log_args<T>(std::cout,
                                                     arg,
@@ -298,3 +304,9 @@ void testing_spr_strided_batched(const Arguments& arg)
                                                     hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_spr.cpp
+extern template void testing_spr_strided_batched<float>(const Arguments&);
+extern template void testing_spr_strided_batched<double>(const Arguments&);
+extern template void testing_spr_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_spr_strided_batched<hipblasDoubleComplex>(const Arguments&);
@@ -262,16 +262,19 @@ void testing_symv(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasSymvFn,
                           (handle, uplo, N, d_alpha, dA, lda, dx, incx, d_beta, dy, incy));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasSymvModel{}.log_args<T>(std::cout,
                                        arg,
@@ -282,3 +285,9 @@ void testing_symv(const Arguments& arg)
                                        hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_symv.cpp
+extern template void testing_symv<float>(const Arguments&);
+extern template void testing_symv<double>(const Arguments&);
+extern template void testing_symv<hipblasComplex>(const Arguments&);
+extern template void testing_symv<hipblasDoubleComplex>(const Arguments&);
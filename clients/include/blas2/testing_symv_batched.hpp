@@ -395,6 +395,9 @@ void testing_symv_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_symv<T>(uplo, N, h_alpha, hA[b], lda, hx[b], incx, h_beta, hy_cpu[b], incy);
@@ -424,11 +427,12 @@ void testing_symv_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasSymvBatchedFn,
                           (handle,
@@ -443,8 +447,10 @@ void testing_symv_batched(const Arguments& arg)
                            dy.ptr_on_device(),
                            incy,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasSymvBatchedModel{}.log_args<T>(std::cout,
                                               arg,
@@ -455,3 +461,9 @@ void testing_symv_batched(const Arguments& arg)
                                               hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_symv.cpp
+extern template void testing_symv_batched<float>(const Arguments&);
+extern template void testing_symv_batched<double>(const Arguments&);
+extern template void testing_symv_batched<hipblasComplex>(const Arguments&);
+extern template void testing_symv_batched<hipblasDoubleComplex>(const Arguments&);
@@ -218,15 +218,18 @@ void testing_syr(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasSyrFn, (handle, uplo, N, d_alpha, dx, incx, dA, lda));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasSyrModel{}.log_args<T>(std::cout,
                                       arg,
@@ -237,3 +240,9 @@ void testing_syr(const Arguments& arg)
                                       hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_syr.cpp
+extern template void testing_syr<float>(const Arguments&);
+extern template void testing_syr<double>(const Arguments&);
+extern template void testing_syr<hipblasComplex>(const Arguments&);
+extern template void testing_syr<hipblasDoubleComplex>(const Arguments&);
@@ -244,15 +244,18 @@ void testing_syr2(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasSyr2Fn, (handle, uplo, N, d_alpha, dx, incx, dy, incy, dA, lda));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasSyr2Model{}.log_args<T>(std::cout,
                                        arg,
@@ -263,3 +266,9 @@ void testing_syr2(const Arguments& arg)
                                        hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_syr2.cpp
+extern template void testing_syr2<float>(const Arguments&);
+extern template void testing_syr2<double>(const Arguments&);
+extern template void testing_syr2<hipblasComplex>(const Arguments&);
+extern template void testing_syr2<hipblasDoubleComplex>(const Arguments&);
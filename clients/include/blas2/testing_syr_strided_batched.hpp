@@ -273,6 +273,9 @@ void testing_syr_strided_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_syr<T>(uplo, N, h_alpha, hx[b], incx, hA_cpu[b], lda);
@@ -301,17 +304,20 @@ void testing_syr_strided_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(
                 hipblasSyrStridedBatchedFn,
                 (handle, uplo, N, d_alpha, dx, incx, stride_x, dA, lda, stride_A, batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasSyrStridedBatchedModel{}.log_args<T>(std::cout,
                                                     arg,
@@ -322,3 +328,9 @@ void testing_syr_strided_batched(const Arguments& arg)
                                                     hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas2/common_syr.cpp
+extern template void testing_syr_strided_batched<float>(const Arguments&);
+extern template void testing_syr_strided_batched<double>(const Arguments&);
+extern template void testing_syr_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_syr_strided_batched<hipblasDoubleComplex>(const Arguments&);
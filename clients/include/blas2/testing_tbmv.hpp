@@ -214,15 +214,18 @@ void testing_tbmv(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasTbmvFn, (handle, uplo, transA, diag, M, K, dAb, lda, dx, incx));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasTbmvModel{}.log_args<T>(std::cout,
                                        arg,
@@ -232,3 +235,9 @@ void testing_tbmv(const Arguments& arg)
                                        hipblas_error);
     }
 }
+
+// Instantiated in clients/common/blas2/common_tbmv.cpp
+extern template void testing_tbmv<float>(const Arguments&);
+extern template void testing_tbmv<double>(const Arguments&);
+extern template void testing_tbmv<hipblasComplex>(const Arguments&);
+extern template void testing_tbmv<hipblasDoubleComplex>(const Arguments&);
@@ -266,6 +266,9 @@ void testing_tbmv_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(size_t b = 0; b < batch_count; b++)
         {
             ref_tbmv<T>(uplo, transA, diag, M, K, hAb[b], lda, hx_cpu[b], incx);
@@ -291,11 +294,12 @@ void testing_tbmv_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasTbmvBatchedFn,
                           (handle,
@@ -309,8 +313,10 @@ void testing_tbmv_batched(const Arguments& arg)
                            dx.ptr_on_device(),
                            incx,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasTbmvBatchedModel{}.log_args<T>(std::cout,
                                               arg,
@@ -320,3 +326,9 @@ void testing_tbmv_batched(const Arguments& arg)
                                               hipblas_error);
     }
 }
+
+// Instantiated in clients/common/blas2/common_tbmv.cpp
+extern template void testing_tbmv_batched<float>(const Arguments&);
+extern template void testing_tbmv_batched<double>(const Arguments&);
+extern template void testing_tbmv_batched<hipblasComplex>(const Arguments&);
+extern template void testing_tbmv_batched<hipblasDoubleComplex>(const Arguments&);
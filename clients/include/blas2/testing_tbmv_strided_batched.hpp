@@ -323,6 +323,9 @@ void testing_tbmv_strided_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(size_t b = 0; b < batch_count; b++)
         {
             ref_tbmv<T>(uplo, transA, diag, M, K, hAb[b], lda, hx_cpu[b], incx);
@@ -349,11 +352,12 @@ void testing_tbmv_strided_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasTbmvStridedBatchedFn,
                           (handle,
@@ -369,8 +373,10 @@ void testing_tbmv_strided_batched(const Arguments& arg)
                            incx,
                            stride_x,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasTbmvStridedBatchedModel{}.log_args<T>(std::cout,
                                                      arg,
@@ -380,3 +386,9 @@ void testing_tbmv_strided_batched(const Arguments& arg)
                                                      hipblas_error);
     }
 }
+
+// Instantiated in clients/common/blas2/common_tbmv.cpp
+extern template void testing_tbmv_strided_batched<float>(const Arguments&);
+extern template void testing_tbmv_strided_batched<double>(const Arguments&);
+extern template void testing_tbmv_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_tbmv_strided_batched<hipblasDoubleComplex>(const Arguments&);
@@ -222,16 +222,19 @@ void testing_tbsv(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasTbsvFn,
                           (handle, uplo, transA, diag, N, K, dAb, lda, dx_or_b, incx));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+        gpu_time_used = timer.elapsed_us(); // in microseconds
 
         hipblasTbsvModel{}.log_args<T>(std::cout,
                                        arg,
@@ -241,3 +244,9 @@ void testing_tbsv(const Arguments& arg)
                                        hipblas_error);
     }
 }
+
+// Instantiated in clients/common/blas2/common_tbsv.cpp
+extern template void testing_tbsv<float>(const Arguments&);
+extern template void testing_tbsv<double>(const Arguments&);
+extern template void testing_tbsv<hipblasComplex>(const Arguments&);
+extern template void testing_tbsv<hipblasDoubleComplex>(const Arguments&);
@@ -253,6 +253,9 @@ void testing_tbsv_batched(const Arguments& arg)
 
     regular_to_banded(uplo == HIPBLAS_FILL_MODE_UPPER, hA, hAb, K);
 
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
     for(size_t b = 0; b < batch_count; b++)
     {
         // Calculate hb = hA*hx;
@@ -306,11 +309,12 @@ void testing_tbsv_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasTbsvBatchedFn,
                           (handle,
@@ -324,8 +328,10 @@ void testing_tbsv_batched(const Arguments& arg)
                            dx_or_b.ptr_on_device(),
                            incx,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+        gpu_time_used = timer.elapsed_us(); // in microseconds
 
         hipblasTbsvBatchedModel{}.log_args<T>(std::cout,
                                               arg,
@@ -335,3 +341,9 @@ void testing_tbsv_batched(const Arguments& arg)
                                               cumulative_hipblas_error);
     }
 }
+
+// Instantiated in clients/common/blas2/common_tbsv.cpp
+extern template void testing_tbsv_batched<float>(const Arguments&);
+extern template void testing_tbsv_batched<double>(const Arguments&);
+extern template void testing_tbsv_batched<hipblasComplex>(const Arguments&);
+extern template void testing_tbsv_batched<hipblasDoubleComplex>(const Arguments&);
@@ -190,15 +190,18 @@ void testing_tpmv(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasTpmvFn, (handle, uplo, transA, diag, N, dAp, dx, incx));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+        gpu_time_used = timer.elapsed_us(); // in microseconds
 
         hipblasTpmvModel{}.log_args<T>(std::cout,
                                        arg,
@@ -208,3 +211,9 @@ void testing_tpmv(const Arguments& arg)
                                        hipblas_error);
     }
 }
+
+// Instantiated in clients/common/blas2/common_tpmv.cpp
+extern template void testing_tpmv<float>(const Arguments&);
+extern template void testing_tpmv<double>(const Arguments&);
+extern template void testing_tpmv<hipblasComplex>(const Arguments&);
+extern template void testing_tpmv<hipblasDoubleComplex>(const Arguments&);
@@ -231,6 +231,9 @@ void testing_tpmv_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(size_t b = 0; b < batch_count; b++)
         {
             ref_tpmv<T>(uplo, transA, diag, N, hAp[b], hx_cpu[b], incx);
@@ -254,11 +257,12 @@ void testing_tpmv_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasTpmvBatchedFn,
                           (handle,
@@ -270,8 +274,10 @@ void testing_tpmv_batched(const Arguments& arg)
                            dx.ptr_on_device(),
                            incx,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+        gpu_time_used = timer.elapsed_us(); // in microseconds
 
         hipblasTpmvBatchedModel{}.log_args<T>(std::cout,
                                               arg,
@@ -281,3 +287,9 @@ void testing_tpmv_batched(const Arguments& arg)
                                               hipblas_error);
     }
 }
+
+// Instantiated in clients/common/blas2/common_tpmv.cpp
+extern template void testing_tpmv_batched<float>(const Arguments&);
+extern template void testing_tpmv_batched<double>(const Arguments&);
+extern template void testing_tpmv_batched<hipblasComplex>(const Arguments&);
+extern template void testing_tpmv_batched<hipblasDoubleComplex>(const Arguments&);
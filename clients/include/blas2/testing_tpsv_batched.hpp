@@ -219,6 +219,9 @@ void testing_tpsv_batched(const Arguments& arg)
         make_unit_diagonal(uplo, hA);
     }
 
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
     for(size_t b = 0; b < batch_count; b++)
     {
         // Calculate hb = hA*hx;
@@ -275,11 +278,12 @@ void testing_tpsv_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasTpsvBatchedFn,
                           (handle,
@@ -291,8 +295,10 @@ void testing_tpsv_batched(const Arguments& arg)
                            dx_or_b.ptr_on_device(),
                            incx,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+        gpu_time_used = timer.elapsed_us(); // in microseconds
 
         hipblasTpsvBatchedModel{}.log_args<T>(std::cout,
                                               arg,
@@ -302,3 +308,9 @@ void testing_tpsv_batched(const Arguments& arg)
                                               cumulative_hipblas_error);
     }
 }
+
+// Instantiated in clients/common/blas2/common_tpsv.cpp
+extern template void testing_tpsv_batched<float>(const Arguments&);
+extern template void testing_tpsv_batched<double>(const Arguments&);
+extern template void testing_tpsv_batched<hipblasComplex>(const Arguments&);
+extern template void testing_tpsv_batched<hipblasDoubleComplex>(const Arguments&);
@@ -248,6 +248,9 @@ void testing_tpsv_strided_batched(const Arguments& arg)
         make_unit_diagonal(uplo, hA);
     }
 
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
     for(size_t b = 0; b < batch_count; b++)
     {
         // Calculate hb = hA*hx;
@@ -297,11 +300,12 @@ void testing_tpsv_strided_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasTpsvStridedBatchedFn,
                           (handle,
@@ -315,8 +319,10 @@ void testing_tpsv_strided_batched(const Arguments& arg)
                            incx,
                            stride_x,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+        gpu_time_used = timer.elapsed_us(); // in microseconds
 
         hipblasTpsvStridedBatchedModel{}.log_args<T>(std::cout,
                                                      arg,
@@ -326,3 +332,9 @@ void testing_tpsv_strided_batched(const Arguments& arg)
                                                      cumulative_hipblas_error);
     }
 }
+
+// Instantiated in clients/common/blas2/common_tpsv.cpp
+extern template void testing_tpsv_strided_batched<float>(const Arguments&);
+extern template void testing_tpsv_strided_batched<double>(const Arguments&);
+extern template void testing_tpsv_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_tpsv_strided_batched<hipblasDoubleComplex>(const Arguments&);
@@ -0,0 +1,144 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasTpttrModel = ArgumentModel<e_a_type, e_uplo, e_N, e_lda>;
+
+inline void testname_tpttr(const Arguments& arg, std::string& name)
+{
+    hipblasTpttrModel{}.test_name(arg, name);
+}
+
+// hipblas?tpttr, with the complex types of the tests cast to the ones of the HIPBLAS_V2
+// interface
+template <typename T>
+hipblasStatus_t hipblasTpttrFn(
+    hipblasHandle_t handle, hipblasFillMode_t uplo, int n, const T* AP, T* A, int lda)
+{
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasStpttr(handle, uplo, n, AP, A, lda);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDtpttr(handle, uplo, n, AP, A, lda);
+#ifdef HIPBLAS_V2
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCtpttr(handle, uplo, n, (const hipComplex*)AP, (hipComplex*)A, lda);
+    else
+        return hipblasZtpttr(
+            handle, uplo, n, (const hipDoubleComplex*)AP, (hipDoubleComplex*)A, lda);
+#else
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCtpttr(handle, uplo, n, AP, A, lda);
+    else
+        return hipblasZtpttr(handle, uplo, n, AP, A, lda);
+#endif
+}
+
+template <typename T>
+void testing_tpttr_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+
+    hipblasFillMode_t uplo = HIPBLAS_FILL_MODE_UPPER;
+    int               N    = 100;
+    int               lda  = 101;
+
+    device_matrix<T> dAp(1, hipblas_packed_matrix_size(N), 1);
+    device_matrix<T> dA(N, N, lda);
+
+    EXPECT_HIPBLAS_STATUS(hipblasTpttrFn<T>(nullptr, uplo, N, dAp, dA, lda),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasTpttrFn<T>(handle, (hipblasFillMode_t)HIPBLAS_OP_N, N, dAp, dA, lda),
+        HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasTpttrFn<T>(handle, uplo, -1, dAp, dA, lda),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasTpttrFn<T>(handle, uplo, N, dAp, dA, N - 1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    if(arg.bad_arg_all)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasTpttrFn<T>(handle, uplo, N, nullptr, dA, lda),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+        EXPECT_HIPBLAS_STATUS(hipblasTpttrFn<T>(handle, uplo, N, dAp, nullptr, lda),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+    }
+
+    // With N == 0, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasTpttrFn<T>(handle, uplo, 0, nullptr, nullptr, lda));
+}
+
+template <typename T>
+void testing_tpttr(const Arguments& arg)
+{
+    hipblasFillMode_t uplo  = char2hipblas_fill(arg.uplo);
+    bool              upper = uplo == HIPBLAS_FILL_MODE_UPPER;
+    int               N     = arg.N;
+    int               lda   = arg.lda;
+
+    hipblasLocalHandle handle(arg);
+
+    bool invalid_size = N < 0 || lda < std::max(1, N);
+    if(invalid_size || !N)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasTpttrFn<T>(handle, uplo, N, nullptr, nullptr, lda),
+                              invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                           : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    host_matrix<T> hAp(1, hipblas_packed_matrix_size(N), 1);
+    host_matrix<T> hA(N, N, lda);
+    host_matrix<T> hA_gold(N, N, lda);
+
+    device_matrix<T> dAp(1, hipblas_packed_matrix_size(N), 1);
+    device_matrix<T> dA(N, N, lda);
+
+    CHECK_DEVICE_ALLOCATION(dAp.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+
+    hipblas_init_matrix(hAp, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix);
+
+    // The triangle of uplo, column by column; the other triangle is left as it is
+    hA_gold        = hA;
+    const T* Ap    = hAp;
+    T*       Agold = hA_gold;
+    for(int j = 0; j < N; j++)
+        for(int i = upper ? 0 : j; i < (upper ? j + 1 : N); i++)
+            Agold[i + size_t(j) * lda] = *Ap++;
+
+    CHECK_HIP_ERROR(dAp.transfer_from(hAp));
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    CHECK_HIPBLAS_ERROR(hipblasTpttrFn<T>(handle, uplo, N, dAp, dA, lda));
+    CHECK_HIP_ERROR(hA.transfer_from(dA));
+
+    unit_check_general<T>(N, N, lda, hA_gold, hA);
+}
@@ -197,15 +197,18 @@ void testing_trmv(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasTrmvFn, (handle, uplo, transA, diag, N, dA, lda, dx, incx));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasTrmvModel{}.log_args<T>(std::cout,
                                        arg,
@@ -215,3 +218,9 @@ void testing_trmv(const Arguments& arg)
                                        hipblas_error);
     }
 }
+
+// Instantiated in clients/common/blas2/common_trmv.cpp
+extern template void testing_trmv<float>(const Arguments&);
+extern template void testing_trmv<double>(const Arguments&);
+extern template void testing_trmv<hipblasComplex>(const Arguments&);
+extern template void testing_trmv<hipblasDoubleComplex>(const Arguments&);
@@ -236,6 +236,9 @@ void testing_trmv_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(size_t b = 0; b < batch_count; b++)
         {
             ref_trmv<T>(uplo, transA, diag, N, hA[b], lda, hx[b], incx);
@@ -259,11 +262,12 @@ void testing_trmv_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasTrmvBatchedFn,
                           (handle,
@@ -276,8 +280,10 @@ void testing_trmv_batched(const Arguments& arg)
                            dx.ptr_on_device(),
                            incx,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasTrmvBatchedModel{}.log_args<T>(std::cout,
                                               arg,
@@ -287,3 +293,9 @@ void testing_trmv_batched(const Arguments& arg)
                                               hipblas_error);
     }
 }
+
+// Instantiated in clients/common/blas2/common_trmv.cpp
+extern template void testing_trmv_batched<float>(const Arguments&);
+extern template void testing_trmv_batched<double>(const Arguments&);
+extern template void testing_trmv_batched<hipblasComplex>(const Arguments&);
+extern template void testing_trmv_batched<hipblasDoubleComplex>(const Arguments&);
@@ -284,6 +284,9 @@ void testing_trmv_strided_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(size_t b = 0; b < batch_count; b++)
         {
             ref_trmv<T>(uplo, transA, diag, N, hA[b], lda, hx[b], incx);
@@ -308,11 +311,12 @@ void testing_trmv_strided_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasTrmvStridedBatchedFn,
                           (handle,
@@ -327,8 +331,10 @@ void testing_trmv_strided_batched(const Arguments& arg)
                            incx,
                            stride_x,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasTrmvStridedBatchedModel{}.log_args<T>(std::cout,
                                                      arg,
@@ -338,3 +344,9 @@ void testing_trmv_strided_batched(const Arguments& arg)
                                                      hipblas_error);
     }
 }
+
+// Instantiated in clients/common/blas2/common_trmv.cpp
+extern template void testing_trmv_strided_batched<float>(const Arguments&);
+extern template void testing_trmv_strided_batched<double>(const Arguments&);
+extern template void testing_trmv_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_trmv_strided_batched<hipblasDoubleComplex>(const Arguments&);
@@ -206,15 +206,18 @@ void testing_trsv(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasTrsvFn, (handle, uplo, transA, diag, N, dA, lda, dx_or_b, incx));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+        gpu_time_used = timer.elapsed_us(); // in microseconds
 
         hipblasTrsvModel{}.log_args<T>(std::cout,
                                        arg,
@@ -224,3 +227,9 @@ void testing_trsv(const Arguments& arg)
                                        hipblas_error);
     }
 }
+
+// Instantiated in clients/common/blas2/common_trsv.cpp
+extern template void testing_trsv<float>(const Arguments&);
+extern template void testing_trsv<double>(const Arguments&);
+extern template void testing_trsv<hipblasComplex>(const Arguments&);
+extern template void testing_trsv<hipblasDoubleComplex>(const Arguments&);
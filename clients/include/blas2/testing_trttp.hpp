@@ -0,0 +1,141 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasTrttpModel = ArgumentModel<e_a_type, e_uplo, e_N, e_lda>;
+
+inline void testname_trttp(const Arguments& arg, std::string& name)
+{
+    hipblasTrttpModel{}.test_name(arg, name);
+}
+
+// hipblas?trttp, with the complex types of the tests cast to the ones of the HIPBLAS_V2
+// interface
+template <typename T>
+hipblasStatus_t hipblasTrttpFn(
+    hipblasHandle_t handle, hipblasFillMode_t uplo, int n, const T* A, int lda, T* AP)
+{
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasStrttp(handle, uplo, n, A, lda, AP);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDtrttp(handle, uplo, n, A, lda, AP);
+#ifdef HIPBLAS_V2
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCtrttp(handle, uplo, n, (const hipComplex*)A, lda, (hipComplex*)AP);
+    else
+        return hipblasZtrttp(
+            handle, uplo, n, (const hipDoubleComplex*)A, lda, (hipDoubleComplex*)AP);
+#else
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCtrttp(handle, uplo, n, A, lda, AP);
+    else
+        return hipblasZtrttp(handle, uplo, n, A, lda, AP);
+#endif
+}
+
+template <typename T>
+void testing_trttp_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+
+    hipblasFillMode_t uplo = HIPBLAS_FILL_MODE_UPPER;
+    int               N    = 100;
+    int               lda  = 101;
+
+    device_matrix<T> dA(N, N, lda);
+    device_matrix<T> dAp(1, hipblas_packed_matrix_size(N), 1);
+
+    EXPECT_HIPBLAS_STATUS(hipblasTrttpFn<T>(nullptr, uplo, N, dA, lda, dAp),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasTrttpFn<T>(handle, (hipblasFillMode_t)HIPBLAS_OP_N, N, dA, lda, dAp),
+        HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasTrttpFn<T>(handle, uplo, -1, dA, lda, dAp),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasTrttpFn<T>(handle, uplo, N, dA, N - 1, dAp),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    if(arg.bad_arg_all)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasTrttpFn<T>(handle, uplo, N, nullptr, lda, dAp),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+        EXPECT_HIPBLAS_STATUS(hipblasTrttpFn<T>(handle, uplo, N, dA, lda, nullptr),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+    }
+
+    // With N == 0, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasTrttpFn<T>(handle, uplo, 0, nullptr, lda, nullptr));
+}
+
+template <typename T>
+void testing_trttp(const Arguments& arg)
+{
+    hipblasFillMode_t uplo  = char2hipblas_fill(arg.uplo);
+    bool              upper = uplo == HIPBLAS_FILL_MODE_UPPER;
+    int               N     = arg.N;
+    int               lda   = arg.lda;
+
+    hipblasLocalHandle handle(arg);
+
+    bool invalid_size = N < 0 || lda < std::max(1, N);
+    if(invalid_size || !N)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasTrttpFn<T>(handle, uplo, N, nullptr, lda, nullptr),
+                              invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                           : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    host_matrix<T> hA(N, N, lda);
+    host_matrix<T> hAp(1, hipblas_packed_matrix_size(N), 1);
+    host_matrix<T> hAp_gold(1, hipblas_packed_matrix_size(N), 1);
+
+    device_matrix<T> dA(N, N, lda);
+    device_matrix<T> dAp(1, hipblas_packed_matrix_size(N), 1);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dAp.memcheck());
+
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+
+    // The triangle of uplo, column by column
+    const T* A      = hA;
+    T*       Apgold = hAp_gold;
+    for(int j = 0; j < N; j++)
+        for(int i = upper ? 0 : j; i < (upper ? j + 1 : N); i++)
+            *Apgold++ = A[i + size_t(j) * lda];
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    CHECK_HIPBLAS_ERROR(hipblasTrttpFn<T>(handle, uplo, N, dA, lda, dAp));
+    CHECK_HIP_ERROR(hAp.transfer_from(dAp));
+
+    unit_check_general<T>(1, hipblas_packed_matrix_size(N), 1, hAp_gold, hAp);
+}
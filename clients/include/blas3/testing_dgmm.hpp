@@ -211,15 +211,18 @@ void testing_dgmm(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasDgmmFn, (handle, side, M, N, dA, lda, dx, incx, dC, ldc));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+        gpu_time_used = timer.elapsed_us(); // in microseconds
 
         hipblasDgmmModel{}.log_args<T>(std::cout,
                                        arg,
@@ -229,3 +232,9 @@ void testing_dgmm(const Arguments& arg)
                                        hipblas_error);
     }
 }
+
+// Instantiated in clients/common/blas3/common_dgmm.cpp
+extern template void testing_dgmm<float>(const Arguments&);
+extern template void testing_dgmm<double>(const Arguments&);
+extern template void testing_dgmm<hipblasComplex>(const Arguments&);
+extern template void testing_dgmm<hipblasDoubleComplex>(const Arguments&);
@@ -264,6 +264,9 @@ void testing_dgmm_batched(const Arguments& arg)
 
         // reference calculation
         ptrdiff_t shift_x = incx < 0 ? -ptrdiff_t(incx) * (N - 1) : 0;
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_dgmm<T>(side, M, N, hA[b], lda, hx[b], incx, hC_gold[b], ldc);
@@ -287,11 +290,12 @@ void testing_dgmm_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasDgmmBatchedFn,
                           (handle,
@@ -305,8 +309,10 @@ void testing_dgmm_batched(const Arguments& arg)
                            dC.ptr_on_device(),
                            ldc,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+        gpu_time_used = timer.elapsed_us(); // in microseconds
 
         hipblasDgmmBatchedModel{}.log_args<T>(std::cout,
                                               arg,
@@ -316,3 +322,9 @@ void testing_dgmm_batched(const Arguments& arg)
                                               hipblas_error);
     }
 }
+
+// Instantiated in clients/common/blas3/common_dgmm.cpp
+extern template void testing_dgmm_batched<float>(const Arguments&);
+extern template void testing_dgmm_batched<double>(const Arguments&);
+extern template void testing_dgmm_batched<hipblasComplex>(const Arguments&);
+extern template void testing_dgmm_batched<hipblasDoubleComplex>(const Arguments&);
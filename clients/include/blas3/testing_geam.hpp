@@ -373,17 +373,20 @@ void testing_geam(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(
                 hipblasGeamFn,
                 (handle, transA, transB, M, N, d_alpha, dA, lda, d_beta, dB, ldb, dC, ldc));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+        gpu_time_used = timer.elapsed_us(); // in microseconds
 
         hipblasGeamModel{}.log_args<T>(std::cout,
                                        arg,
@@ -394,3 +397,9 @@ void testing_geam(const Arguments& arg)
                                        hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas3/common_geam.cpp
+extern template void testing_geam<float>(const Arguments&);
+extern template void testing_geam<double>(const Arguments&);
+extern template void testing_geam<hipblasComplex>(const Arguments&);
+extern template void testing_geam<hipblasDoubleComplex>(const Arguments&);
@@ -318,13 +318,6 @@ void testing_gemm(const Arguments& arg)
     double gpu_time_used, hipblas_error_host, hipblas_error_device;
 
     // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
-    // Allocate host memory
-    host_matrix<T> hA(A_row, A_col, lda);
-    host_matrix<T> hB(B_row, B_col, ldb);
-    host_matrix<T> hC_host(M, N, ldc);
-    host_matrix<T> hC_device(M, N, ldc);
-    host_matrix<T> hC_cpu(M, N, ldc);
-
     // Allocate device memory
     device_matrix<T> dA(A_row, A_col, lda);
     device_matrix<T> dB(B_row, B_col, ldb);
@@ -339,25 +332,190 @@ void testing_gemm(const Arguments& arg)
     CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
     CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
 
-    // Initial Data on CPU
-    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
-    hipblas_init_matrix(
-        hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
-    hipblas_init_matrix(hC_host, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
-
-    // copy vector is easy in STL; hz = hx: save a copy in hC_cpu which will be output of CPU BLAS
-    hC_cpu    = hC_host;
-    hC_device = hC_host;
-
-    // copy data from CPU to device, does not work for lda != A_row
-    CHECK_HIP_ERROR(dA.transfer_from(hA));
-    CHECK_HIP_ERROR(dB.transfer_from(hB));
-    CHECK_HIP_ERROR(dC.transfer_from(hC_host));
     CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
 
-    if(arg.unit_check || arg.norm_check)
+    if(hipblas_probabilistic_check_applies(arg))
     {
+        // Both sides of C = alpha * op(A) * op(B) + beta * C0 are multiplied by random vectors
+        // on the device, in O(n^2), so large sizes are checked in seconds. dC0 keeps C0 for the
+        // call in device pointer mode
+        device_matrix<T> dC0(M, N, ldc);
+        CHECK_DEVICE_ALLOCATION(dC0.memcheck());
+
+        CHECK_HIP_ERROR(hipblas_init_matrix(
+            dA, arg, 'A', hipblas_client_alpha_sets_nan, hipblas_general_matrix, true));
+        CHECK_HIP_ERROR(hipblas_init_matrix(
+            dB, arg, 'B', hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true));
+        CHECK_HIP_ERROR(hipblas_init_matrix(
+            dC, arg, 'C', hipblas_client_beta_sets_nan, hipblas_general_matrix));
+        CHECK_HIP_ERROR(dC0.transfer_from(dC));
+
+        const int vectors = 2;
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        DAPI_CHECK(hipblasGemmFn,
+                   (handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+        CHECK_HIP_ERROR(hipblas_device_probabilistic_gemm_error<T>(transA,
+                                                                   transB,
+                                                                   M,
+                                                                   N,
+                                                                   K,
+                                                                   h_alpha,
+                                                                   dA,
+                                                                   lda,
+                                                                   0,
+                                                                   dB,
+                                                                   ldb,
+                                                                   0,
+                                                                   h_beta,
+                                                                   dC0,
+                                                                   ldc,
+                                                                   0,
+                                                                   dC,
+                                                                   ldc,
+                                                                   0,
+                                                                   1,
+                                                                   vectors,
+                                                                   &hipblas_error_host));
+
+        CHECK_HIP_ERROR(dC.transfer_from(dC0));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasGemmFn(
+            handle, transA, transB, M, N, K, d_alpha, dA, lda, dB, ldb, d_beta, dC, ldc));
+        CHECK_HIP_ERROR(hipblas_device_probabilistic_gemm_error<T>(transA,
+                                                                   transB,
+                                                                   M,
+                                                                   N,
+                                                                   K,
+                                                                   h_alpha,
+                                                                   dA,
+                                                                   lda,
+                                                                   0,
+                                                                   dB,
+                                                                   ldb,
+                                                                   0,
+                                                                   h_beta,
+                                                                   dC0,
+                                                                   ldc,
+                                                                   0,
+                                                                   dC,
+                                                                   ldc,
+                                                                   0,
+                                                                   1,
+                                                                   vectors,
+                                                                   &hipblas_error_device));
+
+        // the residual is relative to the sums that bound the rounding errors of K products and
+        // of the rounding of C itself
+        if(arg.unit_check)
+        {
+            const double tol = (K + 2) * hipblas_type_epsilon<T>;
+            unit_check_error(hipblas_error_host, tol);
+            unit_check_error(hipblas_error_device, tol);
+        }
+    }
+    else if(hipblas_device_reference_applies(arg))
+    {
+        // The reference is computed on the device in double, and the results are checked on the
+        // device. dC_device holds C for the call in device pointer mode, so both results are kept
+        device_matrix<hipblas_device_wide_t<T>> dC_ref(M, N, M);
+        device_matrix<T>                        dC_device(M, N, ldc);
+        CHECK_DEVICE_ALLOCATION(dC_ref.memcheck());
+        CHECK_DEVICE_ALLOCATION(dC_device.memcheck());
+
+        CHECK_HIP_ERROR(hipblas_init_matrix(
+            dA, arg, 'A', hipblas_client_alpha_sets_nan, hipblas_general_matrix, true));
+        CHECK_HIP_ERROR(hipblas_init_matrix(
+            dB, arg, 'B', hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true));
+        CHECK_HIP_ERROR(hipblas_init_matrix(
+            dC, arg, 'C', hipblas_client_beta_sets_nan, hipblas_general_matrix));
+        CHECK_HIP_ERROR(dC_device.transfer_from(dC));
+
+        CHECK_HIP_ERROR(hipblas_device_reference_gemm<T>(transA,
+                                                         transB,
+                                                         M,
+                                                         N,
+                                                         K,
+                                                         h_alpha,
+                                                         dA,
+                                                         lda,
+                                                         0,
+                                                         dB,
+                                                         ldb,
+                                                         0,
+                                                         h_beta,
+                                                         dC,
+                                                         ldc,
+                                                         0,
+                                                         1,
+                                                         dC_ref));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        DAPI_CHECK(hipblasGemmFn,
+                   (handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasGemmFn(
+            handle, transA, transB, M, N, K, d_alpha, dA, lda, dB, ldb, d_beta, dC_device, ldc));
+
+        hipblas_error_host   = norm_check_device('F', M, N, dC_ref, dC);
+        hipblas_error_device = norm_check_device('F', M, N, dC_ref, dC_device);
+
+        // The reference isn't rounded to T, so the check is a tolerance rather than bitwise
+        if(arg.unit_check)
+        {
+            const double tol = K * hipblas_type_epsilon<T>;
+            unit_check_error(hipblas_error_host, tol);
+            unit_check_error(hipblas_error_device, tol);
+            unit_check_device(M, N, dC, dC_device);
+        }
+    }
+    else if(arg.unit_check || arg.norm_check)
+    {
+        // Allocate host memory
+        host_matrix<T> hA(A_row, A_col, lda);
+        host_matrix<T> hB(B_row, B_col, ldb);
+        host_matrix<T> hC_host(M, N, ldc);
+        host_matrix<T> hC_device(M, N, ldc);
+        host_matrix<T> hC_cpu(M, N, ldc);
+
+        // Initial Data on CPU
+        hipblas_init_matrix(
+            hA, arg, 'A', hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+        hipblas_init_matrix(
+            hB, arg, 'B', hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+        hipblas_init_matrix(
+            hC_host, arg, 'C', hipblas_client_beta_sets_nan, hipblas_general_matrix);
+
+        // copy vector is easy in STL; hz = hx: save a copy in hC_cpu, the output of CPU BLAS
+        hC_cpu    = hC_host;
+        hC_device = hC_host;
+
+        // copy data from CPU to device, does not work for lda != A_row
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIP_ERROR(dC.transfer_from(hC_host));
+
+        /* =====================================================================
+                    CPU BLAS, concurrently with the hipBLAS calls
+        =================================================================== */
+        hipblas_host_reference reference([&] {
+            ref_gemm<T>(transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        h_alpha,
+                        hA.data(),
+                        lda,
+                        hB.data(),
+                        ldb,
+                        h_beta,
+                        hC_cpu.data(),
+                        ldc);
+        });
+
         /* =====================================================================
             HIPBLAS
         =================================================================== */
@@ -377,22 +535,7 @@ void testing_gemm(const Arguments& arg)
 
         CHECK_HIP_ERROR(hC_device.transfer_from(dC));
 
-        /* =====================================================================
-                    CPU BLAS
-        =================================================================== */
-        ref_gemm<T>(transA,
-                    transB,
-                    M,
-                    N,
-                    K,
-                    h_alpha,
-                    hA.data(),
-                    lda,
-                    hB.data(),
-                    ldb,
-                    h_beta,
-                    hC_cpu.data(),
-                    ldc);
+        reference.wait();
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -419,6 +562,16 @@ void testing_gemm(const Arguments& arg)
         }
 
     } // end of if unit/norm check
+    else
+    {
+        // Without checks there are no host copies, the data is initialized on the device
+        CHECK_HIP_ERROR(hipblas_init_matrix(
+            dA, arg, 'A', hipblas_client_alpha_sets_nan, hipblas_general_matrix, true));
+        CHECK_HIP_ERROR(hipblas_init_matrix(
+            dB, arg, 'B', hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true));
+        CHECK_HIP_ERROR(hipblas_init_matrix(
+            dC, arg, 'C', hipblas_client_beta_sets_nan, hipblas_general_matrix));
+    }
 
     if(arg.timing)
     {
@@ -429,17 +582,33 @@ void testing_gemm(const Arguments& arg)
         // we need to copy alpha and beta to the host.
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
+        hipblas_iteration_timer  timer(arg, stream);
+        hipblas_rotating_buffers rotating(arg, dA, dB, dC);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            DAPI_DISPATCH(
-                hipblasGemmFn,
-                (handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+            timer.start(iter);
+
+            DAPI_DISPATCH(hipblasGemmFn,
+                          (handle,
+                           transA,
+                           transB,
+                           M,
+                           N,
+                           K,
+                           &h_alpha,
+                           rotating(dA, iter),
+                           lda,
+                           rotating(dB, iter),
+                           ldb,
+                           &h_beta,
+                           rotating(dC, iter),
+                           ldc));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasGemmModel{}.log_args<T>(std::cout,
                                        arg,
@@ -450,3 +619,10 @@ void testing_gemm(const Arguments& arg)
                                        hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas3/common_gemm.cpp
+extern template void testing_gemm<float>(const Arguments&);
+extern template void testing_gemm<double>(const Arguments&);
+extern template void testing_gemm<hipblasHalf>(const Arguments&);
+extern template void testing_gemm<hipblasComplex>(const Arguments&);
+extern template void testing_gemm<hipblasDoubleComplex>(const Arguments&);
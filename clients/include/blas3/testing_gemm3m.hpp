@@ -0,0 +1,264 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemm3mModel = ArgumentModel<e_a_type,
+                                         e_transA,
+                                         e_transB,
+                                         e_M,
+                                         e_N,
+                                         e_K,
+                                         e_alpha,
+                                         e_lda,
+                                         e_ldb,
+                                         e_beta,
+                                         e_ldc>;
+
+inline void testname_gemm3m(const Arguments& arg, std::string& name)
+{
+    hipblasGemm3mModel{}.test_name(arg, name);
+}
+
+// hipblasCgemm3m or hipblasZgemm3m, with the complex type of the tests cast to the one of the
+// HIPBLAS_V2 interface
+template <typename T>
+hipblasStatus_t hipblasGemm3mFn(hipblasHandle_t    handle,
+                                hipblasOperation_t transA,
+                                hipblasOperation_t transB,
+                                int                m,
+                                int                n,
+                                int                k,
+                                const T*           alpha,
+                                const T*           A,
+                                int                lda,
+                                const T*           B,
+                                int                ldb,
+                                const T*           beta,
+                                T*                 C,
+                                int                ldc)
+{
+#ifdef HIPBLAS_V2
+    using Tc = std::conditional_t<std::is_same_v<T, hipblasComplex>, hipComplex, hipDoubleComplex>;
+#else
+    using Tc = T;
+#endif
+    if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCgemm3m(handle,
+                              transA,
+                              transB,
+                              m,
+                              n,
+                              k,
+                              (const Tc*)alpha,
+                              (const Tc*)A,
+                              lda,
+                              (const Tc*)B,
+                              ldb,
+                              (const Tc*)beta,
+                              (Tc*)C,
+                              ldc);
+    else
+        return hipblasZgemm3m(handle,
+                              transA,
+                              transB,
+                              m,
+                              n,
+                              k,
+                              (const Tc*)alpha,
+                              (const Tc*)A,
+                              lda,
+                              (const Tc*)B,
+                              ldb,
+                              (const Tc*)beta,
+                              (Tc*)C,
+                              ldc);
+}
+
+template <typename T>
+void testing_gemm3m_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+
+    int M = 101, N = 100, K = 102, lda = 103, ldb = 104, ldc = 105;
+
+    hipblasOperation_t transA = HIPBLAS_OP_N;
+    hipblasOperation_t transB = HIPBLAS_OP_N;
+
+    device_matrix<T> dA(M, K, lda);
+    device_matrix<T> dB(K, N, ldb);
+    device_matrix<T> dC(M, N, ldc);
+
+    T h_alpha(1), h_beta(2);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemm3mFn<T>(nullptr, transA, transB, M, N, K, &h_alpha, dA, lda,
+                                             dB, ldb, &h_beta, dC, ldc),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemm3mFn<T>(handle, (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                                             transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta,
+                                             dC, ldc),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemm3mFn<T>(handle, transA, transB, M, N, K, &h_alpha, dA, M - 1,
+                                             dB, ldb, &h_beta, dC, ldc),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemm3mFn<T>(handle, transA, transB, M, N, K, nullptr, dA, lda,
+                                             dB, ldb, &h_beta, dC, ldc),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemm3mFn<T>(handle, transA, transB, M, N, K, &h_alpha, nullptr,
+                                             lda, dB, ldb, &h_beta, dC, ldc),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // With M == 0, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasGemm3mFn<T>(handle, transA, transB, 0, N, K, nullptr, nullptr, lda,
+                                           nullptr, ldb, nullptr, nullptr, ldc));
+
+    // clang-format on
+}
+
+template <typename T>
+void testing_gemm3m(const Arguments& arg)
+{
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+    int                ldc    = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    hipblasLocalHandle handle(arg);
+
+    int A_row = transA == HIPBLAS_OP_N ? M : std::max(K, 1);
+    int A_col = transA == HIPBLAS_OP_N ? std::max(K, 1) : M;
+    int B_row = transB == HIPBLAS_OP_N ? std::max(K, 1) : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : std::max(K, 1);
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_HIPBLAS_STATUS(
+            hipblasGemm3mFn<T>(handle,
+                               transA,
+                               transB,
+                               M,
+                               N,
+                               K,
+                               nullptr,
+                               nullptr,
+                               lda,
+                               nullptr,
+                               ldb,
+                               nullptr,
+                               nullptr,
+                               ldc),
+            invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    host_matrix<T> hA(A_row, A_col, lda);
+    host_matrix<T> hB(B_row, B_col, ldb);
+    host_matrix<T> hC(M, N, ldc);
+    host_matrix<T> hC_cpu(M, N, ldc);
+    host_matrix<T> hC_host(M, N, ldc);
+    host_matrix<T> hC_device(M, N, ldc);
+    host_matrix<T> hC_math_mode(M, N, ldc);
+
+    device_matrix<T> dA(A_row, A_col, lda);
+    device_matrix<T> dB(B_row, B_col, ldb);
+    device_matrix<T> dC(M, N, ldc);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // The data are small integers, for which the sums of the 3M algorithm are exact
+    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(
+        hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+    hipblas_init_matrix(hC, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+    hC_cpu = hC;
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    ref_gemm<T>(transA,
+                transB,
+                M,
+                N,
+                K,
+                h_alpha,
+                hA.data(),
+                lda,
+                hB.data(),
+                ldb,
+                h_beta,
+                hC_cpu.data(),
+                ldc);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasGemm3mFn<T>(
+        handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+    CHECK_HIP_ERROR(hC_host.transfer_from(dC));
+
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(hipblasGemm3mFn<T>(
+        handle, transA, transB, M, N, K, d_alpha, dA, lda, dB, ldb, d_beta, dC, ldc));
+    CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+
+    // hipblasCgemm and hipblasZgemm in HIPBLAS_GEMM_3M_MATH mode
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasSetMathMode(handle, HIPBLAS_GEMM_3M_MATH));
+    CHECK_HIPBLAS_ERROR((hipblasGemm<T, false>)(
+        handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+    CHECK_HIPBLAS_ERROR(hipblasSetMathMode(handle, HIPBLAS_DEFAULT_MATH));
+    CHECK_HIP_ERROR(hC_math_mode.transfer_from(dC));
+
+    unit_check_general<T>(M, N, ldc, hC_cpu, hC_host);
+    unit_check_general<T>(M, N, ldc, hC_cpu, hC_device);
+    unit_check_general<T>(M, N, ldc, hC_cpu, hC_math_mode);
+}
@@ -486,23 +486,28 @@ void testing_gemm_batched(const Arguments& arg)
 
     if(arg.unit_check || arg.norm_check)
     {
-        // calculate "golden" result on CPU
-        for(int64_t i = 0; i < batch_count; i++)
-        {
-            ref_gemm<T>(transA,
-                        transB,
-                        M,
-                        N,
-                        K,
-                        h_alpha,
-                        (T*)hA[i],
-                        lda,
-                        (T*)hB[i],
-                        ldb,
-                        h_beta,
-                        (T*)hC_cpu[i],
-                        ldc);
-        }
+        // calculate "golden" result on CPU, concurrently with the hipBLAS calls
+        hipblas_host_reference reference([&] {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int64_t i = 0; i < batch_count; i++)
+            {
+                ref_gemm<T>(transA,
+                            transB,
+                            M,
+                            N,
+                            K,
+                            h_alpha,
+                            (T*)hA[i],
+                            lda,
+                            (T*)hB[i],
+                            ldb,
+                            h_beta,
+                            (T*)hC_cpu[i],
+                            ldc);
+            }
+        });
 
         // test hipBLAS batched gemm with alpha and beta pointers on device
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
@@ -547,6 +552,8 @@ void testing_gemm_batched(const Arguments& arg)
 
         CHECK_HIP_ERROR(hC_host.transfer_from(dC));
 
+        reference.wait();
+
         if(arg.unit_check)
         {
             if(std::is_same_v<T, hipblasHalf> && (getArchMajor() == 11))
@@ -580,11 +587,12 @@ void testing_gemm_batched(const Arguments& arg)
         // we need to copy alpha and beta to the host.
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasGemmBatchedFn,
                           (handle,
@@ -602,9 +610,11 @@ void testing_gemm_batched(const Arguments& arg)
                            dC.ptr_on_device(),
                            ldc,
                            batch_count));
+
+            timer.stop(iter);
         }
 
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasGemmBatchedModel{}.log_args<T>(std::cout,
                                               arg,
@@ -615,3 +625,10 @@ void testing_gemm_batched(const Arguments& arg)
                                               hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas3/common_gemm.cpp
+extern template void testing_gemm_batched<float>(const Arguments&);
+extern template void testing_gemm_batched<double>(const Arguments&);
+extern template void testing_gemm_batched<hipblasHalf>(const Arguments&);
+extern template void testing_gemm_batched<hipblasComplex>(const Arguments&);
+extern template void testing_gemm_batched<hipblasDoubleComplex>(const Arguments&);
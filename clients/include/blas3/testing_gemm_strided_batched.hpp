@@ -497,20 +497,6 @@ void testing_gemm_strided_batched(const Arguments& arg)
     }
 
     // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
-    // Allocate host memory
-    host_strided_batch_matrix<T> hA(A_row, A_col, lda, stride_A, batch_count);
-    host_strided_batch_matrix<T> hB(B_row, B_col, ldb, stride_B, batch_count);
-    host_strided_batch_matrix<T> hC_host(M, N, ldc, stride_C, batch_count);
-    host_strided_batch_matrix<T> hC_device(M, N, ldc, stride_C, batch_count);
-    host_strided_batch_matrix<T> hC_cpu(M, N, ldc, stride_C, batch_count);
-
-    // Check host memory allocation
-    CHECK_HIP_ERROR(hA.memcheck());
-    CHECK_HIP_ERROR(hB.memcheck());
-    CHECK_HIP_ERROR(hC_host.memcheck());
-    CHECK_HIP_ERROR(hC_device.memcheck());
-    CHECK_HIP_ERROR(hC_cpu.memcheck());
-
     // Allocate device memory
     device_strided_batch_matrix<T> dA(A_row, A_col, lda, stride_A, batch_count);
     device_strided_batch_matrix<T> dB(B_row, B_col, ldb, stride_B, batch_count);
@@ -525,20 +511,6 @@ void testing_gemm_strided_batched(const Arguments& arg)
     CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
     CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
 
-    // Initial Data on CPU
-    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
-    hipblas_init_matrix(
-        hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
-    hipblas_init_matrix(hC_host, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
-
-    // copy vector
-    hC_device.copy_from(hC_host);
-    hC_cpu.copy_from(hC_host);
-
-    // copy data from CPU to device, does not work for lda != A_row
-    CHECK_HIP_ERROR(dA.transfer_from(hA));
-    CHECK_HIP_ERROR(dB.transfer_from(hB));
-    CHECK_HIP_ERROR(dC.transfer_from(hC_host));
     CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
 
@@ -547,8 +519,158 @@ void testing_gemm_strided_batched(const Arguments& arg)
     /* =====================================================================
          HIPBLAS
     =================================================================== */
-    if(arg.unit_check || arg.norm_check)
+    if(hipblas_device_reference_applies(arg))
+    {
+        // The reference is computed on the device in double, and the results are checked on the
+        // device. dC_device holds C for the call in device pointer mode, so both results are kept
+        device_strided_batch_matrix<hipblas_device_wide_t<T>> dC_ref(M, N, M, M * N, batch_count);
+
+        device_strided_batch_matrix<T> dC_device(M, N, ldc, stride_C, batch_count);
+        CHECK_DEVICE_ALLOCATION(dC_ref.memcheck());
+        CHECK_DEVICE_ALLOCATION(dC_device.memcheck());
+
+        CHECK_HIP_ERROR(hipblas_init_matrix(
+            dA, arg, 'A', hipblas_client_alpha_sets_nan, hipblas_general_matrix, true));
+        CHECK_HIP_ERROR(hipblas_init_matrix(
+            dB, arg, 'B', hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true));
+        CHECK_HIP_ERROR(hipblas_init_matrix(
+            dC, arg, 'C', hipblas_client_beta_sets_nan, hipblas_general_matrix));
+        CHECK_HIP_ERROR(dC_device.transfer_from(dC));
+
+        CHECK_HIP_ERROR(hipblas_device_reference_gemm<T>(transA,
+                                                         transB,
+                                                         M,
+                                                         N,
+                                                         K,
+                                                         h_alpha,
+                                                         dA,
+                                                         lda,
+                                                         stride_A,
+                                                         dB,
+                                                         ldb,
+                                                         stride_B,
+                                                         h_beta,
+                                                         dC,
+                                                         ldc,
+                                                         stride_C,
+                                                         batch_count,
+                                                         dC_ref));
+
+        // host mode
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        DAPI_CHECK(hipblasGemmStridedBatchedFn,
+                   (handle,
+                    transA,
+                    transB,
+                    M,
+                    N,
+                    K,
+                    &h_alpha,
+                    dA,
+                    lda,
+                    stride_A,
+                    dB,
+                    ldb,
+                    stride_B,
+                    &h_beta,
+                    dC,
+                    ldc,
+                    stride_C,
+                    batch_count));
+
+        // device mode
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        DAPI_CHECK(hipblasGemmStridedBatchedFn,
+                   (handle,
+                    transA,
+                    transB,
+                    M,
+                    N,
+                    K,
+                    d_alpha,
+                    dA,
+                    lda,
+                    stride_A,
+                    dB,
+                    ldb,
+                    stride_B,
+                    d_beta,
+                    dC_device,
+                    ldc,
+                    stride_C,
+                    batch_count));
+
+        hipblas_error_host   = norm_check_device('F', M, N, dC_ref, dC);
+        hipblas_error_device = norm_check_device('F', M, N, dC_ref, dC_device);
+
+        // The reference isn't rounded to T, so the check is a tolerance rather than bitwise. The
+        // errors of the batches are summed, as on the host
+        if(arg.unit_check)
+        {
+            const double tol = K * batch_count * hipblas_type_epsilon<T>;
+            unit_check_error(hipblas_error_host, tol);
+            unit_check_error(hipblas_error_device, tol);
+            unit_check_device(M, N, dC, dC_device);
+        }
+    }
+    else if(arg.unit_check || arg.norm_check)
     {
+        // Allocate host memory
+        host_strided_batch_matrix<T> hA(A_row, A_col, lda, stride_A, batch_count);
+        host_strided_batch_matrix<T> hB(B_row, B_col, ldb, stride_B, batch_count);
+        host_strided_batch_matrix<T> hC_host(M, N, ldc, stride_C, batch_count);
+        host_strided_batch_matrix<T> hC_device(M, N, ldc, stride_C, batch_count);
+        host_strided_batch_matrix<T> hC_cpu(M, N, ldc, stride_C, batch_count);
+
+        // Check host memory allocation
+        CHECK_HIP_ERROR(hA.memcheck());
+        CHECK_HIP_ERROR(hB.memcheck());
+        CHECK_HIP_ERROR(hC_host.memcheck());
+        CHECK_HIP_ERROR(hC_device.memcheck());
+        CHECK_HIP_ERROR(hC_cpu.memcheck());
+
+        // Initial Data on CPU
+        hipblas_init_matrix(
+            hA, arg, 'A', hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+        hipblas_init_matrix(
+            hB, arg, 'B', hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+        hipblas_init_matrix(
+            hC_host, arg, 'C', hipblas_client_beta_sets_nan, hipblas_general_matrix);
+
+        // copy vector
+        hC_device.copy_from(hC_host);
+        hC_cpu.copy_from(hC_host);
+
+        // copy data from CPU to device, does not work for lda != A_row
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIP_ERROR(dC.transfer_from(hC_host));
+
+        /* =====================================================================
+                    CPU BLAS, concurrently with the hipBLAS calls
+        =================================================================== */
+        hipblas_host_reference reference([&] {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int64_t b = 0; b < batch_count; b++)
+            {
+                ref_gemm<T>(transA,
+                            transB,
+                            M,
+                            N,
+                            K,
+                            h_alpha,
+                            hA[b],
+                            lda,
+                            hB[b],
+                            ldb,
+                            h_beta,
+                            hC_cpu[b],
+                            ldc);
+            }
+        });
+
         // host mode
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
@@ -600,14 +722,7 @@ void testing_gemm_strided_batched(const Arguments& arg)
                     batch_count));
         CHECK_HIP_ERROR(hC_device.transfer_from(dC));
 
-        /* =====================================================================
-                    CPU BLAS
-        =================================================================== */
-        for(int64_t b = 0; b < batch_count; b++)
-        {
-            ref_gemm<T>(
-                transA, transB, M, N, K, h_alpha, hA[b], lda, hB[b], ldb, h_beta, hC_cpu[b], ldc);
-        }
+        reference.wait();
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -633,6 +748,16 @@ void testing_gemm_strided_batched(const Arguments& arg)
                 = norm_check_general<T>('F', M, N, ldc, stride_C, hC_cpu, hC_device, batch_count);
         }
     }
+    else
+    {
+        // Without checks there are no host copies, the data is initialized on the device
+        CHECK_HIP_ERROR(hipblas_init_matrix(
+            dA, arg, 'A', hipblas_client_alpha_sets_nan, hipblas_general_matrix, true));
+        CHECK_HIP_ERROR(hipblas_init_matrix(
+            dB, arg, 'B', hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true));
+        CHECK_HIP_ERROR(hipblas_init_matrix(
+            dC, arg, 'C', hipblas_client_beta_sets_nan, hipblas_general_matrix));
+    }
 
     if(arg.timing)
     {
@@ -643,11 +768,12 @@ void testing_gemm_strided_batched(const Arguments& arg)
         // we need to copy alpha and beta to the host.
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasGemmStridedBatchedFn,
                           (handle,
@@ -668,8 +794,10 @@ void testing_gemm_strided_batched(const Arguments& arg)
                            ldc,
                            stride_C,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasGemmStridedBatchedModel{}.log_args<T>(std::cout,
                                                      arg,
@@ -680,3 +808,10 @@ void testing_gemm_strided_batched(const Arguments& arg)
                                                      hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas3/common_gemm.cpp
+extern template void testing_gemm_strided_batched<float>(const Arguments&);
+extern template void testing_gemm_strided_batched<double>(const Arguments&);
+extern template void testing_gemm_strided_batched<hipblasHalf>(const Arguments&);
+extern template void testing_gemm_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_gemm_strided_batched<hipblasDoubleComplex>(const Arguments&);
@@ -227,13 +227,6 @@ void testing_hemm(const Arguments& arg)
     }
 
     // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
-    // Allocate host memory
-    host_matrix<T> hA(dim_A, dim_A, lda);
-    host_matrix<T> hB(M, N, ldb);
-    host_matrix<T> hC_host(M, N, ldc);
-    host_matrix<T> hC_device(M, N, ldc);
-    host_matrix<T> hC_cpu(M, N, ldc);
-
     // Allocate device memory
     device_matrix<T> dA(dim_A, dim_A, lda);
     device_matrix<T> dB(M, N, ldb);
@@ -249,24 +242,32 @@ void testing_hemm(const Arguments& arg)
     CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
 
     double gpu_time_used, hipblas_error_host, hipblas_error_device;
-    // Initial Data on CPU
-    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_hermitian_matrix, true);
-    hipblas_init_matrix(
-        hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
-    hipblas_init_matrix(hC_host, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
-
-    hC_cpu    = hC_host;
-    hC_device = hC_host;
-
-    // copy data from CPU to device
-    CHECK_HIP_ERROR(dA.transfer_from(hA));
-    CHECK_HIP_ERROR(dB.transfer_from(hB));
-    CHECK_HIP_ERROR(dC.transfer_from(hC_host));
     CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
 
     if(arg.unit_check || arg.norm_check)
     {
+        // Allocate host memory
+        host_matrix<T> hA(dim_A, dim_A, lda);
+        host_matrix<T> hB(M, N, ldb);
+        host_matrix<T> hC_host(M, N, ldc);
+        host_matrix<T> hC_device(M, N, ldc);
+        host_matrix<T> hC_cpu(M, N, ldc);
+
+        // Initial Data on CPU
+        hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_hermitian_matrix, true);
+        hipblas_init_matrix(
+            hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+        hipblas_init_matrix(hC_host, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+
+        hC_cpu    = hC_host;
+        hC_device = hC_host;
+
+        // copy data from CPU to device
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIP_ERROR(dC.transfer_from(hC_host));
+
         /* =====================================================================
             HIPBLAS
         =================================================================== */
@@ -304,6 +305,16 @@ void testing_hemm(const Arguments& arg)
             hipblas_error_device = norm_check_general<T>('F', M, N, ldc, hC_cpu, hC_device);
         }
     }
+    else
+    {
+        // Without checks there are no host copies, the data is initialized on the device
+        CHECK_HIP_ERROR(hipblas_init_matrix(
+            dA, arg, hipblas_client_never_set_nan, hipblas_hermitian_matrix, true));
+        CHECK_HIP_ERROR(hipblas_init_matrix(
+            dB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true));
+        CHECK_HIP_ERROR(
+            hipblas_init_matrix(dC, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix));
+    }
 
     if(arg.timing)
     {
@@ -311,16 +322,19 @@ void testing_hemm(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasHemmFn,
                           (handle, side, uplo, M, N, d_alpha, dA, lda, dB, ldb, d_beta, dC, ldc));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+        gpu_time_used = timer.elapsed_us(); // in microseconds
 
         hipblasHemmModel{}.log_args<T>(std::cout,
                                        arg,
@@ -331,3 +345,7 @@ void testing_hemm(const Arguments& arg)
                                        hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas3/common_hemm.cpp
+extern template void testing_hemm<hipblasComplex>(const Arguments&);
+extern template void testing_hemm<hipblasDoubleComplex>(const Arguments&);
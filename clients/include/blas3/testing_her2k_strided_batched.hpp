@@ -574,6 +574,9 @@ void testing_her2k_strided_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_her2k<T>(
@@ -603,11 +606,12 @@ void testing_her2k_strided_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasHer2kStridedBatchedFn,
                           (handle,
@@ -627,8 +631,10 @@ void testing_her2k_strided_batched(const Arguments& arg)
                            ldc,
                            stride_C,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+        gpu_time_used = timer.elapsed_us(); // in microseconds
 
         hipblasHer2kStridedBatchedModel{}.log_args<T>(std::cout,
                                                       arg,
@@ -639,3 +645,7 @@ void testing_her2k_strided_batched(const Arguments& arg)
                                                       hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas3/common_her2k.cpp
+extern template void testing_her2k_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_her2k_strided_batched<hipblasDoubleComplex>(const Arguments&);
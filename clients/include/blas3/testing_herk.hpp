@@ -203,12 +203,6 @@ void testing_herk(const Arguments& arg)
     size_t cols = (transA == HIPBLAS_OP_N ? std::max(K, int64_t(1)) : N);
 
     // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
-    // Allocate host memory
-    host_matrix<T> hA(rows, cols, lda);
-    host_matrix<T> hC_host(N, N, ldc);
-    host_matrix<T> hC_device(N, N, ldc);
-    host_matrix<T> hC_gold(N, N, ldc);
-
     // Allocate device memory
     device_matrix<T> dA(rows, cols, lda);
     device_matrix<T> dC(N, N, ldc);
@@ -226,22 +220,29 @@ void testing_herk(const Arguments& arg)
 
     double gpu_time_used, hipblas_error_host, hipblas_error_device;
 
-    // Initial Data on CPU
-    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
-    hipblas_init_matrix(
-        hC_host, arg, hipblas_client_beta_sets_nan, hipblas_hermitian_matrix, false);
-
-    hC_device = hC_host;
-    hC_gold   = hC_host;
-
-    // copy data from CPU to device
-    CHECK_HIP_ERROR(dA.transfer_from(hA));
-    CHECK_HIP_ERROR(dC.transfer_from(hC_host));
     CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(U), hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(U), hipMemcpyHostToDevice));
 
     if(arg.unit_check || arg.norm_check)
     {
+        // Allocate host memory
+        host_matrix<T> hA(rows, cols, lda);
+        host_matrix<T> hC_host(N, N, ldc);
+        host_matrix<T> hC_device(N, N, ldc);
+        host_matrix<T> hC_gold(N, N, ldc);
+
+        // Initial Data on CPU
+        hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+        hipblas_init_matrix(
+            hC_host, arg, hipblas_client_beta_sets_nan, hipblas_hermitian_matrix, false);
+
+        hC_device = hC_host;
+        hC_gold   = hC_host;
+
+        // copy data from CPU to device
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dC.transfer_from(hC_host));
+
         /* =====================================================================
             HIPBLAS
         =================================================================== */
@@ -278,6 +279,14 @@ void testing_herk(const Arguments& arg)
             hipblas_error_device = norm_check_general<T>('F', N, N, ldc, hC_gold, hC_device);
         }
     }
+    else
+    {
+        // Without checks there are no host copies, the data is initialized on the device
+        CHECK_HIP_ERROR(hipblas_init_matrix(
+            dA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true));
+        CHECK_HIP_ERROR(
+            hipblas_init_matrix(dC, arg, hipblas_client_beta_sets_nan, hipblas_hermitian_matrix));
+    }
 
     if(arg.timing)
     {
@@ -285,16 +294,19 @@ void testing_herk(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasHerkFn,
                           (handle, uplo, transA, N, K, d_alpha, dA, lda, d_beta, dC, ldc));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+        gpu_time_used = timer.elapsed_us(); // in microseconds
 
         hipblasHerkModel{}.log_args<T>(std::cout,
                                        arg,
@@ -305,3 +317,7 @@ void testing_herk(const Arguments& arg)
                                        hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas3/common_herk.cpp
+extern template void testing_herk<hipblasComplex>(const Arguments&);
+extern template void testing_herk<hipblasDoubleComplex>(const Arguments&);
@@ -0,0 +1,499 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasMatcopyModel = ArgumentModel<e_a_type,
+                                          e_transA,
+                                          e_uplo,
+                                          e_M,
+                                          e_N,
+                                          e_alpha,
+                                          e_lda,
+                                          e_ldb,
+                                          e_stride_scale,
+                                          e_batch_count>;
+
+inline void testname_matcopy(const Arguments& arg, std::string& name)
+{
+    hipblasMatcopyModel{}.test_name(arg, name);
+}
+
+// The omatcopy, imatcopy and lacpy functions, with the complex types of the tests cast to those
+// of the HIPBLAS_V2 interface
+#ifdef HIPBLAS_V2
+template <typename T>
+using hipblas_matcopy_type_t = std::conditional_t<
+    std::is_same_v<T, hipblasComplex>,
+    hipComplex,
+    std::conditional_t<std::is_same_v<T, hipblasDoubleComplex>, hipDoubleComplex, T>>;
+#else
+template <typename T>
+using hipblas_matcopy_type_t = T;
+#endif
+
+template <typename T>
+hipblasStatus_t hipblasOmatcopyStridedBatchedFn(hipblasHandle_t    handle,
+                                                hipblasOperation_t trans,
+                                                int                m,
+                                                int                n,
+                                                const T*           alpha,
+                                                const T*           A,
+                                                int                lda,
+                                                hipblasStride      stride_a,
+                                                T*                 B,
+                                                int                ldb,
+                                                hipblasStride      stride_b,
+                                                int                batch_count)
+{
+    using Tc = hipblas_matcopy_type_t<T>;
+    auto alpha_c = (const Tc*)alpha;
+    auto A_c     = (const Tc*)A;
+    auto B_c     = (Tc*)B;
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSomatcopyStridedBatched(handle,
+                                              trans,
+                                              m,
+                                              n,
+                                              alpha_c,
+                                              A_c,
+                                              lda,
+                                              stride_a,
+                                              B_c,
+                                              ldb,
+                                              stride_b,
+                                              batch_count);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDomatcopyStridedBatched(handle,
+                                              trans,
+                                              m,
+                                              n,
+                                              alpha_c,
+                                              A_c,
+                                              lda,
+                                              stride_a,
+                                              B_c,
+                                              ldb,
+                                              stride_b,
+                                              batch_count);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasComatcopyStridedBatched(handle,
+                                              trans,
+                                              m,
+                                              n,
+                                              alpha_c,
+                                              A_c,
+                                              lda,
+                                              stride_a,
+                                              B_c,
+                                              ldb,
+                                              stride_b,
+                                              batch_count);
+    else
+        return hipblasZomatcopyStridedBatched(handle,
+                                              trans,
+                                              m,
+                                              n,
+                                              alpha_c,
+                                              A_c,
+                                              lda,
+                                              stride_a,
+                                              B_c,
+                                              ldb,
+                                              stride_b,
+                                              batch_count);
+}
+
+template <typename T>
+hipblasStatus_t hipblasImatcopyStridedBatchedFn(hipblasHandle_t    handle,
+                                                hipblasOperation_t trans,
+                                                int                m,
+                                                int                n,
+                                                const T*           alpha,
+                                                T*                 AB,
+                                                int                lda,
+                                                int                ldb,
+                                                hipblasStride      stride,
+                                                int                batch_count)
+{
+    using Tc = hipblas_matcopy_type_t<T>;
+    auto alpha_c = (const Tc*)alpha;
+    auto AB_c    = (Tc*)AB;
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSimatcopyStridedBatched(handle,
+                                              trans,
+                                              m,
+                                              n,
+                                              alpha_c,
+                                              AB_c,
+                                              lda,
+                                              ldb,
+                                              stride,
+                                              batch_count);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDimatcopyStridedBatched(handle,
+                                              trans,
+                                              m,
+                                              n,
+                                              alpha_c,
+                                              AB_c,
+                                              lda,
+                                              ldb,
+                                              stride,
+                                              batch_count);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCimatcopyStridedBatched(handle,
+                                              trans,
+                                              m,
+                                              n,
+                                              alpha_c,
+                                              AB_c,
+                                              lda,
+                                              ldb,
+                                              stride,
+                                              batch_count);
+    else
+        return hipblasZimatcopyStridedBatched(handle,
+                                              trans,
+                                              m,
+                                              n,
+                                              alpha_c,
+                                              AB_c,
+                                              lda,
+                                              ldb,
+                                              stride,
+                                              batch_count);
+}
+
+template <typename T>
+hipblasStatus_t hipblasLacpyStridedBatchedFn(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             int               m,
+                                             int               n,
+                                             const T*          A,
+                                             int               lda,
+                                             hipblasStride     stride_a,
+                                             T*                B,
+                                             int               ldb,
+                                             hipblasStride     stride_b,
+                                             int               batch_count)
+{
+    using Tc = hipblas_matcopy_type_t<T>;
+    auto A_c = (const Tc*)A;
+    auto B_c = (Tc*)B;
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSlacpyStridedBatched(handle,
+                                           uplo,
+                                           m,
+                                           n,
+                                           A_c,
+                                           lda,
+                                           stride_a,
+                                           B_c,
+                                           ldb,
+                                           stride_b,
+                                           batch_count);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDlacpyStridedBatched(handle,
+                                           uplo,
+                                           m,
+                                           n,
+                                           A_c,
+                                           lda,
+                                           stride_a,
+                                           B_c,
+                                           ldb,
+                                           stride_b,
+                                           batch_count);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasClacpyStridedBatched(handle,
+                                           uplo,
+                                           m,
+                                           n,
+                                           A_c,
+                                           lda,
+                                           stride_a,
+                                           B_c,
+                                           ldb,
+                                           stride_b,
+                                           batch_count);
+    else
+        return hipblasZlacpyStridedBatched(handle,
+                                           uplo,
+                                           m,
+                                           n,
+                                           A_c,
+                                           lda,
+                                           stride_a,
+                                           B_c,
+                                           ldb,
+                                           stride_b,
+                                           batch_count);
+}
+
+template <typename T>
+hipblasStatus_t hipblasLacpyBatchedFn(hipblasHandle_t   handle,
+                                      hipblasFillMode_t uplo,
+                                      int               m,
+                                      int               n,
+                                      const T* const*   A,
+                                      int               lda,
+                                      T* const*         B,
+                                      int               ldb,
+                                      int               batch_count)
+{
+    using Tc = hipblas_matcopy_type_t<T>;
+    auto A_c = (const Tc* const*)A;
+    auto B_c = (Tc* const*)B;
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSlacpyBatched(handle, uplo, m, n, A_c, lda, B_c, ldb, batch_count);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDlacpyBatched(handle, uplo, m, n, A_c, lda, B_c, ldb, batch_count);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasClacpyBatched(handle, uplo, m, n, A_c, lda, B_c, ldb, batch_count);
+    else
+        return hipblasZlacpyBatched(handle, uplo, m, n, A_c, lda, B_c, ldb, batch_count);
+}
+
+// B := alpha * op(A) for the m by n matrix A
+template <typename T>
+void ref_omatcopy(
+    hipblasOperation_t trans, int m, int n, T alpha, const T* A, int lda, T* B, int ldb)
+{
+    for(int j = 0; j < n; j++)
+        for(int i = 0; i < m; i++)
+        {
+            T a = A[i + size_t(j) * lda];
+            if(trans == HIPBLAS_OP_N)
+                B[i + size_t(j) * ldb] = alpha * a;
+            else
+            {
+                if constexpr(is_complex<T>)
+                    if(trans == HIPBLAS_OP_C)
+                        a = std::conj(a);
+                B[j + size_t(i) * ldb] = alpha * a;
+            }
+        }
+}
+
+template <typename T>
+void testing_matcopy_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+    int                M           = 20;
+    int                N           = 10;
+    int                lda         = 21;
+    int                ldb         = 21;
+    int                batch_count = 2;
+    hipblasStride      stride      = hipblasStride(lda) * M;
+    T                  alpha       = T(1);
+
+    auto trans = HIPBLAS_OP_T;
+    auto uplo  = HIPBLAS_FILL_MODE_FULL;
+
+    device_strided_batch_matrix<T> dA(M, N, lda, stride, batch_count);
+    device_strided_batch_matrix<T> dB(N, M, ldb, stride, batch_count);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasOmatcopyStridedBatchedFn<T>(nullptr, trans, M, N, &alpha, dA, lda,
+                                                             stride, dB, ldb, stride, batch_count),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasOmatcopyStridedBatchedFn<T>(handle, (hipblasOperation_t)0, M, N,
+                                                             &alpha, dA, lda, stride, dB, ldb,
+                                                             stride, batch_count),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasOmatcopyStridedBatchedFn<T>(handle, trans, M, N, &alpha, dA, M - 1,
+                                                             stride, dB, ldb, stride, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasOmatcopyStridedBatchedFn<T>(handle, trans, M, N, &alpha, dA, lda,
+                                                             stride, dB, N - 1, stride,
+                                                             batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasOmatcopyStridedBatchedFn<T>(handle, trans, M, N, nullptr, dA, lda,
+                                                             stride, dB, ldb, stride, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasOmatcopyStridedBatchedFn<T>(handle, trans, M, N, &alpha, dA, lda,
+                                                             stride, nullptr, ldb, stride,
+                                                             batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasImatcopyStridedBatchedFn<T>(handle, trans, M, N, &alpha, nullptr,
+                                                             lda, ldb, stride, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasImatcopyStridedBatchedFn<T>(handle, trans, M, N, &alpha, dA, lda,
+                                                             ldb, stride, -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasLacpyStridedBatchedFn<T>(handle, HIPBLAS_FILL_MODE_FULL, M, N, dA,
+                                                          lda, stride, dB, M - 1, stride,
+                                                          batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasLacpyStridedBatchedFn<T>(handle, (hipblasFillMode_t)0, M, N, dA,
+                                                          lda, stride, dB, ldb, stride,
+                                                          batch_count),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    // With no rows, no columns or no matrices, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasOmatcopyStridedBatchedFn<T>(handle, trans, 0, N, nullptr, nullptr,
+                                                           lda, stride, nullptr, ldb, stride,
+                                                           batch_count));
+    CHECK_HIPBLAS_ERROR(hipblasImatcopyStridedBatchedFn<T>(handle, trans, M, 0, nullptr, nullptr,
+                                                           lda, ldb, stride, batch_count));
+    CHECK_HIPBLAS_ERROR(hipblasLacpyStridedBatchedFn<T>(handle, uplo, M, N, nullptr, lda, stride,
+                                                        nullptr, ldb, stride, 0));
+
+    // clang-format on
+}
+
+// omatcopy and imatcopy checked against the reference, and lacpy of each triangle from strided
+// batches and from arrays of pointers. The data and alpha are small integers, so the results are
+// exact.
+template <typename T>
+void testing_matcopy(const Arguments& arg)
+{
+    hipblasOperation_t trans        = char2hipblas_operation(arg.transA);
+    hipblasFillMode_t  uplo         = char2hipblas_fill(arg.uplo);
+    int                M            = arg.M;
+    int                N            = arg.N;
+    int                lda          = arg.lda;
+    int                ldb          = arg.ldb;
+    double             stride_scale = arg.stride_scale;
+    int                batch_count  = arg.batch_count;
+    int                B_row        = trans == HIPBLAS_OP_N ? M : N;
+    int                B_col        = trans == HIPBLAS_OP_N ? N : M;
+
+    T h_alpha = arg.get_alpha<T>();
+
+    // Check to prevent memory allocation error
+    if(M < 1 || N < 1 || lda < M || ldb < B_row || batch_count <= 0)
+        return;
+
+    // the in-place matrices hold both layouts
+    hipblasStride stride_a = hipblasStride(lda) * N * stride_scale;
+    hipblasStride stride_b = hipblasStride(ldb) * B_col * stride_scale;
+    hipblasStride stride   = std::max(stride_a, stride_b);
+
+    host_strided_batch_matrix<T> hA(M, N, lda, stride, batch_count);
+    host_strided_batch_matrix<T> hB_gold(B_row, B_col, ldb, stride, batch_count);
+    host_strided_batch_matrix<T> hB(B_row, B_col, ldb, stride, batch_count);
+    host_batch_matrix<T>         hA_batch(M, N, lda, batch_count);
+    host_batch_matrix<T>         hB_batch(M, N, ldb, batch_count);
+
+    CHECK_HIP_ERROR(hA.memcheck());
+
+    device_strided_batch_matrix<T> dA(M, N, lda, stride, batch_count);
+    device_strided_batch_matrix<T> dB(B_row, B_col, ldb, stride, batch_count);
+    device_batch_matrix<T>         dA_batch(M, N, lda, batch_count);
+    device_batch_matrix<T>         dB_batch(M, N, ldb, batch_count);
+    device_vector<T>               d_alpha(1);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA_batch.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB_batch.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+
+    double             gpu_time_used;
+    hipblasLocalHandle handle(arg);
+
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        for(int b = 0; b < batch_count; b++)
+            ref_omatcopy(trans, M, N, h_alpha, hA[b], lda, hB_gold[b], ldb);
+
+        // out of place with alpha on the host
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasOmatcopyStridedBatchedFn<T>(
+            handle, trans, M, N, &h_alpha, dA, lda, stride, dB, ldb, stride, batch_count));
+        CHECK_HIP_ERROR(hB.transfer_from(dB));
+        unit_check_general<T>(B_row, B_col, batch_count, ldb, stride, hB_gold, hB);
+
+        // in place with alpha on the device
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasImatcopyStridedBatchedFn<T>(
+            handle, trans, M, N, d_alpha, dA, lda, ldb, stride, batch_count));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hB[0], dA[0], sizeof(T) * stride * batch_count, hipMemcpyDeviceToHost));
+        unit_check_general<T>(B_row, B_col, batch_count, ldb, stride, hB_gold, hB);
+
+        // lacpy of the triangle of uplo, over a B filled with the original A
+        for(int b = 0; b < batch_count; b++)
+            for(int j = 0; j < N; j++)
+                for(int i = 0; i < M; i++)
+                {
+                    hA_batch[b][i + size_t(j) * lda] = hA[b][i + size_t(j) * lda];
+                    hB_batch[b][i + size_t(j) * ldb] = T(-1);
+                    bool copied = uplo == HIPBLAS_FILL_MODE_FULL
+                                  || (uplo == HIPBLAS_FILL_MODE_UPPER ? i <= j : i >= j);
+                    hB_gold[b][i + size_t(j) * ldb] = copied ? hA[b][i + size_t(j) * lda] : T(-1);
+                }
+
+        CHECK_HIP_ERROR(dA_batch.transfer_from(hA_batch));
+        CHECK_HIP_ERROR(dB_batch.transfer_from(hB_batch));
+        CHECK_HIPBLAS_ERROR(hipblasLacpyBatchedFn<T>(handle,
+                                                     uplo,
+                                                     M,
+                                                     N,
+                                                     dA_batch.ptr_on_device(),
+                                                     lda,
+                                                     dB_batch.ptr_on_device(),
+                                                     ldb,
+                                                     batch_count));
+        CHECK_HIP_ERROR(hB_batch.transfer_from(dB_batch));
+        for(int b = 0; b < batch_count; b++)
+            unit_check_general<T>(M, N, ldb, hB_gold[b], hB_batch[b]);
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasOmatcopyStridedBatchedFn<T>(
+                handle, trans, M, N, &h_alpha, dA, lda, stride, dB, ldb, stride, batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        double gbyte_per_second = 2.0 * M * N * batch_count * sizeof(T) / 1e3 / gpu_time_used;
+        hipblasMatcopyModel{}.log_args<T>(std::cout,
+                                          arg,
+                                          gpu_time_used,
+                                          ArgumentLogging::NA_value,
+                                          gbyte_per_second,
+                                          ArgumentLogging::NA_value);
+    }
+}
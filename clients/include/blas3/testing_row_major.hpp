@@ -0,0 +1,338 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+enum class hipblas_row_major_op
+{
+    gemm,
+    symm,
+    hemm,
+    trsm,
+    trmm,
+    syrk,
+    herk,
+    syr2k,
+    her2k,
+};
+
+using hipblasRowMajorModel = ArgumentModel<e_a_type,
+                                           e_side,
+                                           e_uplo,
+                                           e_transA,
+                                           e_transB,
+                                           e_diag,
+                                           e_M,
+                                           e_N,
+                                           e_K,
+                                           e_alpha,
+                                           e_beta,
+                                           e_lda,
+                                           e_ldb,
+                                           e_ldc>;
+
+inline void testname_row_major(const Arguments& arg, std::string& name)
+{
+    hipblasRowMajorModel{}.test_name(arg, name);
+}
+
+// Copies the rows by cols matrix held column-major in cm to row-major storage in rm
+template <typename T>
+void hipblas_col_to_row_major(
+    int64_t rows, int64_t cols, const T* cm, int64_t ld_cm, T* rm, int64_t ld_rm)
+{
+    for(int64_t i = 0; i < rows; i++)
+        for(int64_t j = 0; j < cols; j++)
+            rm[i * ld_rm + j] = cm[i + j * ld_cm];
+}
+
+template <typename T>
+void hipblas_row_to_col_major(
+    int64_t rows, int64_t cols, const T* rm, int64_t ld_rm, T* cm, int64_t ld_cm)
+{
+    for(int64_t i = 0; i < rows; i++)
+        for(int64_t j = 0; j < cols; j++)
+            cm[i + j * ld_cm] = rm[i * ld_rm + j];
+}
+
+// Runs the row-major function on row-major copies of the operands and the column-major function
+// on the operands themselves, and expects the same status and the same C, the B of trsm.
+// lda, ldb and ldc are the row-major leading dimensions, the distances between the rows.
+template <hipblas_row_major_op OP, typename T>
+void testing_row_major(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    using U  = real_t<T>;
+    using op = hipblas_row_major_op;
+
+    constexpr bool hermitian = OP == op::hemm || OP == op::herk || OP == op::her2k;
+    constexpr bool rank_k = OP == op::syrk || OP == op::herk || OP == op::syr2k || OP == op::her2k;
+    constexpr bool has_B  = OP != op::trsm && OP != op::syrk && OP != op::herk;
+
+    if(hermitian && !is_complex<T>)
+        return;
+
+    hipblasSideMode_t  side   = char2hipblas_side(arg.side);
+    hipblasFillMode_t  uplo   = char2hipblas_fill(arg.uplo);
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    hipblasDiagType_t  diag   = char2hipblas_diagonal(arg.diag);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+    int                ldc    = arg.ldc;
+
+    T h_alpha   = arg.get_alpha<T>();
+    T h_beta    = arg.get_beta<T>();
+    U h_alpha_r = arg.get_alpha<U>();
+    U h_beta_r  = arg.get_beta<U>();
+
+    // the logical shapes of A, B and C, trsm solving in place in C
+    int64_t rows_A, cols_A, rows_B, cols_B, rows_C = M, cols_C = N;
+    if constexpr(OP == op::gemm)
+    {
+        rows_A = transA == HIPBLAS_OP_N ? M : K;
+        cols_A = transA == HIPBLAS_OP_N ? K : M;
+        rows_B = transB == HIPBLAS_OP_N ? K : N;
+        cols_B = transB == HIPBLAS_OP_N ? N : K;
+    }
+    else if constexpr(rank_k)
+    {
+        rows_A = rows_B = transA == HIPBLAS_OP_N ? N : K;
+        cols_A = cols_B = transA == HIPBLAS_OP_N ? K : N;
+        rows_C = cols_C = N;
+    }
+    else
+    {
+        rows_A = cols_A = side == HIPBLAS_SIDE_LEFT ? M : N;
+        rows_B          = M;
+        cols_B          = N;
+    }
+
+    // only valid problems are compared, the argument checks of the row-major functions are those
+    // of the column-major ones on the transposed sizes
+    if(M < 0 || N < 0 || K < 0 || lda < std::max<int64_t>(1, cols_A)
+       || (has_B && ldb < std::max<int64_t>(1, cols_B)) || ldc < std::max<int64_t>(1, cols_C))
+        return;
+
+    int64_t ld_A = std::max<int64_t>(1, rows_A);
+    int64_t ld_B = std::max<int64_t>(1, rows_B);
+    int64_t ld_C = std::max<int64_t>(1, rows_C);
+
+    hipblasLocalHandle handle(arg);
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // The `_rm` matrices hold the row-major copies, as column-major transposes.
+    host_matrix<T> hA(rows_A, cols_A, ld_A);
+    host_matrix<T> hB(rows_B, cols_B, ld_B);
+    host_matrix<T> hC(rows_C, cols_C, ld_C);
+    host_matrix<T> hA_rm(cols_A, rows_A, lda);
+    host_matrix<T> hB_rm(cols_B, rows_B, ldb);
+    host_matrix<T> hC_rm(cols_C, rows_C, ldc);
+    host_matrix<T> hC_gold(rows_C, cols_C, ld_C);
+    host_matrix<T> hC_out(rows_C, cols_C, ld_C);
+
+    device_matrix<T> dA(rows_A, cols_A, ld_A);
+    device_matrix<T> dB(rows_B, cols_B, ld_B);
+    device_matrix<T> dC(rows_C, cols_C, ld_C);
+    device_matrix<T> dA_rm(cols_A, rows_A, lda);
+    device_matrix<T> dB_rm(cols_B, rows_B, ldb);
+    device_matrix<T> dC_rm(cols_C, rows_C, ldc);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA_rm.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB_rm.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC_rm.memcheck());
+
+    // Initial Data on CPU
+    if(OP == op::trsm)
+    {
+        hipblas_init_matrix(hA,
+                            arg,
+                            hipblas_client_never_set_nan,
+                            hipblas_diagonally_dominant_triangular_matrix,
+                            true);
+        if(diag == HIPBLAS_DIAG_UNIT)
+            make_unit_diagonal(uplo, (T*)hA, ld_A, rows_A);
+    }
+    else
+        hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(hB, arg, hipblas_client_never_set_nan, hipblas_general_matrix, false, true);
+    hipblas_init_matrix(hC, arg, hipblas_client_never_set_nan, hipblas_general_matrix);
+
+    hipblas_col_to_row_major<T>(rows_A, cols_A, hA, ld_A, hA_rm, lda);
+    hipblas_col_to_row_major<T>(rows_B, cols_B, hB, ld_B, hB_rm, ldb);
+    hipblas_col_to_row_major<T>(rows_C, cols_C, hC, ld_C, hC_rm, ldc);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(dA_rm.transfer_from(hA_rm));
+    CHECK_HIP_ERROR(dB_rm.transfer_from(hB_rm));
+    CHECK_HIP_ERROR(dC_rm.transfer_from(hC_rm));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    hipDataType     type = arg.a_type;
+    hipblasStatus_t status_cm, status_rm;
+    if constexpr(OP == op::gemm)
+    {
+        status_cm = hipblasGemm<T>(
+            handle, transA, transB, M, N, K, &h_alpha, dA, ld_A, dB, ld_B, &h_beta, dC, ld_C);
+        status_rm = hipblasRmGemm(handle,
+                                  transA,
+                                  transB,
+                                  M,
+                                  N,
+                                  K,
+                                  &h_alpha,
+                                  dA_rm,
+                                  lda,
+                                  dB_rm,
+                                  ldb,
+                                  &h_beta,
+                                  dC_rm,
+                                  ldc,
+                                  type);
+    }
+    else if constexpr(OP == op::symm || OP == op::hemm)
+    {
+        auto hipblasCmFn = OP == op::symm ? hipblasSymm<T> : hipblasHemm<T>;
+        auto hipblasRmFn = OP == op::symm ? hipblasRmSymm : hipblasRmHemm;
+        status_cm        = hipblasCmFn(
+            handle, side, uplo, M, N, &h_alpha, dA, ld_A, dB, ld_B, &h_beta, dC, ld_C);
+        status_rm = hipblasRmFn(
+            handle, side, uplo, M, N, &h_alpha, dA_rm, lda, dB_rm, ldb, &h_beta, dC_rm, ldc, type);
+    }
+    else if constexpr(OP == op::trsm)
+    {
+        status_cm = hipblasTrsm<T>(
+            handle, side, uplo, transA, diag, M, N, &h_alpha, dA, ld_A, dC, ld_C);
+        status_rm = hipblasRmTrsm(
+            handle, side, uplo, transA, diag, M, N, &h_alpha, dA_rm, lda, dC_rm, ldc, type);
+    }
+    else if constexpr(OP == op::trmm)
+    {
+        status_cm = hipblasTrmm<T>(
+            handle, side, uplo, transA, diag, M, N, &h_alpha, dA, ld_A, dB, ld_B, dC, ld_C);
+        status_rm = hipblasRmTrmm(handle,
+                                  side,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  M,
+                                  N,
+                                  &h_alpha,
+                                  dA_rm,
+                                  lda,
+                                  dB_rm,
+                                  ldb,
+                                  dC_rm,
+                                  ldc,
+                                  type);
+    }
+    else if constexpr(OP == op::syrk)
+    {
+        status_cm = hipblasSyrk<T>(
+            handle, uplo, transA, N, K, &h_alpha, dA, ld_A, &h_beta, dC, ld_C);
+        status_rm = hipblasRmSyrk(
+            handle, uplo, transA, N, K, &h_alpha, dA_rm, lda, &h_beta, dC_rm, ldc, type);
+    }
+    else if constexpr(OP == op::herk)
+    {
+        status_cm = hipblasHerk<T, U>(
+            handle, uplo, transA, N, K, &h_alpha_r, dA, ld_A, &h_beta_r, dC, ld_C);
+        status_rm = hipblasRmHerk(
+            handle, uplo, transA, N, K, &h_alpha_r, dA_rm, lda, &h_beta_r, dC_rm, ldc, type);
+    }
+    else if constexpr(OP == op::syr2k)
+    {
+        status_cm = hipblasSyr2k<T>(
+            handle, uplo, transA, N, K, &h_alpha, dA, ld_A, dB, ld_B, &h_beta, dC, ld_C);
+        status_rm = hipblasRmSyr2k(handle,
+                                   uplo,
+                                   transA,
+                                   N,
+                                   K,
+                                   &h_alpha,
+                                   dA_rm,
+                                   lda,
+                                   dB_rm,
+                                   ldb,
+                                   &h_beta,
+                                   dC_rm,
+                                   ldc,
+                                   type);
+    }
+    else
+    {
+        status_cm = hipblasHer2k<T, U>(
+            handle, uplo, transA, N, K, &h_alpha, dA, ld_A, dB, ld_B, &h_beta_r, dC, ld_C);
+        status_rm = hipblasRmHer2k(handle,
+                                   uplo,
+                                   transA,
+                                   N,
+                                   K,
+                                   &h_alpha,
+                                   dA_rm,
+                                   lda,
+                                   dB_rm,
+                                   ldb,
+                                   &h_beta_r,
+                                   dC_rm,
+                                   ldc,
+                                   type);
+    }
+
+    // an operation the column-major function rejects, such as the transpose of complex herk, is
+    // rejected by the row-major one too
+    EXPECT_HIPBLAS_STATUS(status_rm, status_cm);
+    if(status_cm != HIPBLAS_STATUS_SUCCESS)
+        return;
+
+    CHECK_HIP_ERROR(hC_gold.transfer_from(dC));
+    CHECK_HIP_ERROR(hC_rm.transfer_from(dC_rm));
+    hipblas_row_to_col_major<T>(rows_C, cols_C, hC_rm, ldc, hC_out, ld_C);
+
+    // the two calls differ in their blocking only, which changes the rounding of the solve
+    if(OP == op::trsm)
+    {
+        real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+        double    tolerance = eps * 40 * M;
+        double    error     = norm_check_general<T>('F', rows_C, cols_C, ld_C, hC_gold, hC_out);
+        unit_check_error(error, tolerance);
+    }
+    else
+        unit_check_general<T>(rows_C, cols_C, ld_C, hC_gold, hC_out);
+#endif
+}
@@ -247,13 +247,6 @@ void testing_syr2k(const Arguments& arg)
     size_t cols = (transA == HIPBLAS_OP_N ? std::max(K, int64_t(1)) : N);
 
     // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
-    // Allocate host memory
-    host_matrix<T> hA(rows, cols, lda);
-    host_matrix<T> hB(rows, cols, ldb);
-    host_matrix<T> hC_host(N, N, ldc);
-    host_matrix<T> hC_device(N, N, ldc);
-    host_matrix<T> hC_cpu(N, N, ldc);
-
     // Allocate device memory
     device_matrix<T> dA(rows, cols, lda);
     device_matrix<T> dB(rows, cols, ldb);
@@ -273,24 +266,33 @@ void testing_syr2k(const Arguments& arg)
 
     double gpu_time_used, hipblas_error_host, hipblas_error_device;
 
-    // Initial Data on CPU
-    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
-    hipblas_init_matrix(hB, arg, hipblas_client_never_set_nan, hipblas_general_matrix, false, true);
-    hipblas_init_matrix(hC_host, arg, hipblas_client_never_set_nan, hipblas_symmetric_matrix);
-
-    // copy matrix is easy in STL; hB = hA: save a copy in hB which will be output of CPU BLAS
-    hC_device = hC_host;
-    hC_cpu    = hC_host;
-
-    // copy data from CPU to device
-    CHECK_HIP_ERROR(dA.transfer_from(hA));
-    CHECK_HIP_ERROR(dB.transfer_from(hB));
-    CHECK_HIP_ERROR(dC.transfer_from(hC_host));
     CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
 
     if(arg.unit_check || arg.norm_check)
     {
+        // Allocate host memory
+        host_matrix<T> hA(rows, cols, lda);
+        host_matrix<T> hB(rows, cols, ldb);
+        host_matrix<T> hC_host(N, N, ldc);
+        host_matrix<T> hC_device(N, N, ldc);
+        host_matrix<T> hC_cpu(N, N, ldc);
+
+        // Initial Data on CPU
+        hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+        hipblas_init_matrix(
+            hB, arg, hipblas_client_never_set_nan, hipblas_general_matrix, false, true);
+        hipblas_init_matrix(hC_host, arg, hipblas_client_never_set_nan, hipblas_symmetric_matrix);
+
+        // copy matrix is easy in STL; hB = hA: save a copy in hB which will be output of CPU BLAS
+        hC_device = hC_host;
+        hC_cpu    = hC_host;
+
+        // copy data from CPU to device
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIP_ERROR(dC.transfer_from(hC_host));
+
         /* =====================================================================
             HIPBLAS
         =================================================================== */
@@ -328,6 +330,16 @@ void testing_syr2k(const Arguments& arg)
             hipblas_error_device = norm_check_general<T>('F', N, N, ldc, hC_cpu, hC_device);
         }
     }
+    else
+    {
+        // Without checks there are no host copies, the data is initialized on the device
+        CHECK_HIP_ERROR(hipblas_init_matrix(
+            dA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true));
+        CHECK_HIP_ERROR(hipblas_init_matrix(
+            dB, arg, hipblas_client_never_set_nan, hipblas_general_matrix, false, true));
+        CHECK_HIP_ERROR(
+            hipblas_init_matrix(dC, arg, hipblas_client_never_set_nan, hipblas_symmetric_matrix));
+    }
 
     if(arg.timing)
     {
@@ -335,16 +347,19 @@ void testing_syr2k(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasSyr2kFn,
                           (handle, uplo, transA, N, K, d_alpha, dA, lda, dB, ldb, d_beta, dC, ldc));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+        gpu_time_used = timer.elapsed_us(); // in microseconds
 
         hipblasSyr2kModel{}.log_args<T>(std::cout,
                                         arg,
@@ -355,3 +370,9 @@ void testing_syr2k(const Arguments& arg)
                                         hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas3/common_syr2k.cpp
+extern template void testing_syr2k<float>(const Arguments&);
+extern template void testing_syr2k<double>(const Arguments&);
+extern template void testing_syr2k<hipblasComplex>(const Arguments&);
+extern template void testing_syr2k<hipblasDoubleComplex>(const Arguments&);
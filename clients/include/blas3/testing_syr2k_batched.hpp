@@ -485,6 +485,9 @@ void testing_syr2k_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_syr2k<T>(
@@ -514,11 +517,12 @@ void testing_syr2k_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasSyr2kBatchedFn,
                           (handle,
@@ -535,8 +539,10 @@ void testing_syr2k_batched(const Arguments& arg)
                            dC.ptr_on_device(),
                            ldc,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+        gpu_time_used = timer.elapsed_us(); // in microseconds
 
         hipblasSyr2kBatchedModel{}.log_args<T>(std::cout,
                                                arg,
@@ -547,3 +553,9 @@ void testing_syr2k_batched(const Arguments& arg)
                                                hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas3/common_syr2k.cpp
+extern template void testing_syr2k_batched<float>(const Arguments&);
+extern template void testing_syr2k_batched<double>(const Arguments&);
+extern template void testing_syr2k_batched<hipblasComplex>(const Arguments&);
+extern template void testing_syr2k_batched<hipblasDoubleComplex>(const Arguments&);
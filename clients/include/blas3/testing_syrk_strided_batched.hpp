@@ -466,6 +466,9 @@ void testing_syrk_strided_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_syrk<T>(uplo, transA, N, K, h_alpha, hA[b], lda, h_beta, hC_cpu[b], ldc);
@@ -494,11 +497,12 @@ void testing_syrk_strided_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasSyrkStridedBatchedFn,
                           (handle,
@@ -515,8 +519,10 @@ void testing_syrk_strided_batched(const Arguments& arg)
                            ldc,
                            stride_C,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+        gpu_time_used = timer.elapsed_us(); // in microseconds
 
         hipblasSyrkStridedBatchedModel{}.log_args<T>(std::cout,
                                                      arg,
@@ -527,3 +533,9 @@ void testing_syrk_strided_batched(const Arguments& arg)
                                                      hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas3/common_syrk.cpp
+extern template void testing_syrk_strided_batched<float>(const Arguments&);
+extern template void testing_syrk_strided_batched<double>(const Arguments&);
+extern template void testing_syrk_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_syrk_strided_batched<hipblasDoubleComplex>(const Arguments&);
@@ -504,11 +504,12 @@ void testing_syrkx_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasSyrkxBatchedFn,
                           (handle,
@@ -525,8 +526,10 @@ void testing_syrkx_batched(const Arguments& arg)
                            dC.ptr_on_device(),
                            ldc,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasSyrkxBatchedModel{}.log_args<T>(std::cout,
                                                arg,
@@ -537,3 +540,9 @@ void testing_syrkx_batched(const Arguments& arg)
                                                hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas3/common_syrkx.cpp
+extern template void testing_syrkx_batched<float>(const Arguments&);
+extern template void testing_syrkx_batched<double>(const Arguments&);
+extern template void testing_syrkx_batched<hipblasComplex>(const Arguments&);
+extern template void testing_syrkx_batched<hipblasDoubleComplex>(const Arguments&);
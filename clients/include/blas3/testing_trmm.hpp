@@ -374,14 +374,6 @@ void testing_trmm(const Arguments& arg)
     }
 
     // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
-    // Allocate host memory
-    host_matrix<T> hA(K, K, lda);
-    host_matrix<T> hB(M, N, ldb);
-    host_matrix<T> hC = (inplace) ? host_matrix<T>(1, 1, 1) : host_matrix<T>(M, N, ldc);
-    host_matrix<T> hOut_host(M, N, ldOut);
-    host_matrix<T> hOut_device(M, N, ldOut);
-    host_matrix<T> hOut_cpu(M, N, ldOut);
-
     // Allocate device memory
     device_matrix<T> dA(K, K, lda);
     device_matrix<T> dB(M, N, ldb);
@@ -398,26 +390,36 @@ void testing_trmm(const Arguments& arg)
 
     double gpu_time_used, hipblas_error_host, hipblas_error_device;
 
-    // Initial Data on CPU
-    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_triangular_matrix, true);
-    hipblas_init_matrix(
-        hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
 
-    if(!inplace)
+    if(arg.unit_check || arg.norm_check)
+    {
+        // Allocate host memory
+        host_matrix<T> hA(K, K, lda);
+        host_matrix<T> hB(M, N, ldb);
+        host_matrix<T> hC = (inplace) ? host_matrix<T>(1, 1, 1) : host_matrix<T>(M, N, ldc);
+        host_matrix<T> hOut_host(M, N, ldOut);
+        host_matrix<T> hOut_device(M, N, ldOut);
+        host_matrix<T> hOut_cpu(M, N, ldOut);
+
+        // Initial Data on CPU
         hipblas_init_matrix(
-            hC, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+            hA, arg, hipblas_client_alpha_sets_nan, hipblas_triangular_matrix, true);
+        hipblas_init_matrix(
+            hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
 
-    hOut_host   = inplace ? hB : hC;
-    hOut_device = hOut_host;
-    hOut_cpu    = hOut_host;
+        if(!inplace)
+            hipblas_init_matrix(
+                hC, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
 
-    // copy data from CPU to device
-    CHECK_HIP_ERROR(dA.transfer_from(hA));
-    CHECK_HIP_ERROR(dB.transfer_from(hB));
-    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        hOut_host   = inplace ? hB : hC;
+        hOut_device = hOut_host;
+        hOut_cpu    = hOut_host;
+
+        // copy data from CPU to device
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
 
-    if(arg.unit_check || arg.norm_check)
-    {
         /* =====================================================================
             HIPBLAS
         =================================================================== */
@@ -459,6 +461,14 @@ void testing_trmm(const Arguments& arg)
             hipblas_error_device = norm_check_general<T>('F', M, N, ldOut, hOut_cpu, hOut_device);
         }
     }
+    else
+    {
+        // Without checks there are no host copies, the data is initialized on the device
+        CHECK_HIP_ERROR(hipblas_init_matrix(
+            dA, arg, hipblas_client_alpha_sets_nan, hipblas_triangular_matrix, true));
+        CHECK_HIP_ERROR(hipblas_init_matrix(
+            dB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true));
+    }
 
     if(arg.timing)
     {
@@ -466,17 +476,20 @@ void testing_trmm(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(
                 hipblasTrmmFn,
                 (handle, side, uplo, transA, diag, M, N, d_alpha, dA, lda, dB, ldb, *dOut, ldOut));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasTrmmModel{}.log_args<T>(std::cout,
                                        arg,
@@ -487,3 +500,9 @@ void testing_trmm(const Arguments& arg)
                                        hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas3/common_trmm.cpp
+extern template void testing_trmm<float>(const Arguments&);
+extern template void testing_trmm<double>(const Arguments&);
+extern template void testing_trmm<hipblasComplex>(const Arguments&);
+extern template void testing_trmm<hipblasDoubleComplex>(const Arguments&);
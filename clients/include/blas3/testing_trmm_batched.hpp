@@ -562,6 +562,9 @@ void testing_trmm_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_trmm<T>(side, uplo, transA, diag, M, N, h_alpha, hA[b], lda, hB[b], ldb);
@@ -591,11 +594,12 @@ void testing_trmm_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasTrmmBatchedFn,
                           (handle,
@@ -613,8 +617,10 @@ void testing_trmm_batched(const Arguments& arg)
                            (*dOut).ptr_on_device(),
                            ldOut,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasTrmmBatchedModel{}.log_args<T>(std::cout,
                                               arg,
@@ -625,3 +631,9 @@ void testing_trmm_batched(const Arguments& arg)
                                               hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas3/common_trmm.cpp
+extern template void testing_trmm_batched<float>(const Arguments&);
+extern template void testing_trmm_batched<double>(const Arguments&);
+extern template void testing_trmm_batched<hipblasComplex>(const Arguments&);
+extern template void testing_trmm_batched<hipblasDoubleComplex>(const Arguments&);
@@ -632,6 +632,9 @@ void testing_trmm_strided_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_trmm<T>(side, uplo, transA, diag, M, N, h_alpha, hA[b], lda, hB[b], ldb);
@@ -662,11 +665,12 @@ void testing_trmm_strided_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasTrmmStridedBatchedFn,
                           (handle,
@@ -687,8 +691,10 @@ void testing_trmm_strided_batched(const Arguments& arg)
                            ldOut,
                            stride_Out,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasTrmmStridedBatchedModel{}.log_args<T>(std::cout,
                                                      arg,
@@ -699,3 +705,9 @@ void testing_trmm_strided_batched(const Arguments& arg)
                                                      hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas3/common_trmm.cpp
+extern template void testing_trmm_strided_batched<float>(const Arguments&);
+extern template void testing_trmm_strided_batched<double>(const Arguments&);
+extern template void testing_trmm_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_trmm_strided_batched<hipblasDoubleComplex>(const Arguments&);
@@ -225,9 +225,6 @@ void testing_trsm(const Arguments& arg)
     // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
     // Allocate host memory
     host_matrix<T> hA(K, K, lda);
-    host_matrix<T> hB_host(M, N, ldb);
-    host_matrix<T> hB_device(M, N, ldb);
-    host_matrix<T> hB_cpu(M, N, ldb);
 
     // Allocate device memory
     device_matrix<T> dA(K, K, lda);
@@ -244,8 +241,6 @@ void testing_trsm(const Arguments& arg)
     // Initial data on CPU
     hipblas_init_matrix(
         hA, arg, hipblas_client_never_set_nan, hipblas_diagonally_dominant_triangular_matrix, true);
-    hipblas_init_matrix(
-        hB_host, arg, hipblas_client_never_set_nan, hipblas_general_matrix, false, true);
 
     //  make hA unit diagonal if diag == HIPBLAS_DIAG_UNIT
     if(diag == HIPBLAS_DIAG_UNIT)
@@ -253,51 +248,97 @@ void testing_trsm(const Arguments& arg)
         make_unit_diagonal(uplo, (T*)hA, lda, K);
     }
 
-    // Calculate hB = hA*hX;
-    ref_trmm<T>(side, uplo, transA, diag, M, N, T(1.0) / h_alpha, (const T*)hA, lda, hB_host, ldb);
-
-    hB_cpu    = hB_host; // original solution hX
-    hB_device = hB_host;
-
     // copy data from CPU to device
     CHECK_HIP_ERROR(dA.transfer_from(hA));
-    CHECK_HIP_ERROR(dB.transfer_from(hB_host));
     CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
 
-    /* =====================================================================
-           HIPBLAS
-    =================================================================== */
-    if(arg.unit_check || arg.norm_check)
+    // if enable norm check, norm check is invasive
+    real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+    double    tolerance = eps * 40 * M;
+
+    if(hipblas_device_reference_applies(arg))
     {
+        // The reference is solved on the device in double, and the results are checked on the
+        // device. B is drawn on the device instead of being computed from a known solution on the
+        // host, and dB_device holds it for the call in device pointer mode
+        device_matrix<hipblas_device_wide_t<T>> dB_ref(M, N, M);
+        device_matrix<T>                        dB_device(M, N, ldb);
+        CHECK_DEVICE_ALLOCATION(dB_ref.memcheck());
+        CHECK_DEVICE_ALLOCATION(dB_device.memcheck());
+
+        CHECK_HIP_ERROR(hipblas_init_matrix(
+            dB, arg, hipblas_client_never_set_nan, hipblas_general_matrix, false, true));
+        CHECK_HIP_ERROR(dB_device.transfer_from(dB));
+
+        CHECK_HIP_ERROR(hipblas_device_reference_trsm<T>(
+            side, uplo, transA, diag, M, N, h_alpha, dA, lda, 0, dB, ldb, 0, 1, dB_ref));
+
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
         DAPI_CHECK(hipblasTrsmFn,
                    (handle, side, uplo, transA, diag, M, N, &h_alpha, dA, lda, dB, ldb));
 
-        CHECK_HIP_ERROR(hB_host.transfer_from(dB));
-        CHECK_HIP_ERROR(dB.transfer_from(hB_device));
-
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
         DAPI_CHECK(hipblasTrsmFn,
-                   (handle, side, uplo, transA, diag, M, N, d_alpha, dA, lda, dB, ldb));
+                   (handle, side, uplo, transA, diag, M, N, d_alpha, dA, lda, dB_device, ldb));
+
+        hipblas_error_host   = norm_check_device('F', M, N, dB_ref, dB);
+        hipblas_error_device = norm_check_device('F', M, N, dB_ref, dB_device);
+        if(arg.unit_check)
+        {
+            unit_check_error(hipblas_error_host, tolerance);
+            unit_check_error(hipblas_error_device, tolerance);
+            unit_check_device(M, N, dB, dB_device);
+        }
+    }
+    else
+    {
+        host_matrix<T> hB_host(M, N, ldb);
+        host_matrix<T> hB_device(M, N, ldb);
+        host_matrix<T> hB_cpu(M, N, ldb);
+
+        hipblas_init_matrix(
+            hB_host, arg, hipblas_client_never_set_nan, hipblas_general_matrix, false, true);
 
-        CHECK_HIP_ERROR(hB_device.transfer_from(dB));
+        // Calculate hB = hA*hX;
+        ref_trmm<T>(
+            side, uplo, transA, diag, M, N, T(1.0) / h_alpha, (const T*)hA, lda, hB_host, ldb);
+
+        hB_cpu    = hB_host; // original solution hX
+        hB_device = hB_host;
+
+        CHECK_HIP_ERROR(dB.transfer_from(hB_host));
 
         /* =====================================================================
-           CPU BLAS
+               HIPBLAS
         =================================================================== */
+        if(arg.unit_check || arg.norm_check)
+        {
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+            DAPI_CHECK(hipblasTrsmFn,
+                       (handle, side, uplo, transA, diag, M, N, &h_alpha, dA, lda, dB, ldb));
 
-        ref_trsm<T>(side, uplo, transA, diag, M, N, h_alpha, (const T*)hA, lda, hB_cpu, ldb);
+            CHECK_HIP_ERROR(hB_host.transfer_from(dB));
+            CHECK_HIP_ERROR(dB.transfer_from(hB_device));
 
-        // if enable norm check, norm check is invasive
-        real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
-        double    tolerance = eps * 40 * M;
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+            DAPI_CHECK(hipblasTrsmFn,
+                       (handle, side, uplo, transA, diag, M, N, d_alpha, dA, lda, dB, ldb));
 
-        hipblas_error_host   = norm_check_general<T>('F', M, N, ldb, hB_cpu, hB_host);
-        hipblas_error_device = norm_check_general<T>('F', M, N, ldb, hB_cpu, hB_device);
-        if(arg.unit_check)
-        {
-            unit_check_error(hipblas_error_host, tolerance);
-            unit_check_error(hipblas_error_device, tolerance);
+            CHECK_HIP_ERROR(hB_device.transfer_from(dB));
+
+            /* =====================================================================
+               CPU BLAS
+            =================================================================== */
+
+            ref_trsm<T>(side, uplo, transA, diag, M, N, h_alpha, (const T*)hA, lda, hB_cpu, ldb);
+
+            hipblas_error_host   = norm_check_general<T>('F', M, N, ldb, hB_cpu, hB_host);
+            hipblas_error_device = norm_check_general<T>('F', M, N, ldb, hB_cpu, hB_device);
+            if(arg.unit_check)
+            {
+                unit_check_error(hipblas_error_host, tolerance);
+                unit_check_error(hipblas_error_device, tolerance);
+            }
         }
     }
 
@@ -307,16 +348,19 @@ void testing_trsm(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasTrsmFn,
                           (handle, side, uplo, transA, diag, M, N, d_alpha, dA, lda, dB, ldb));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasTrsmModel{}.log_args<T>(std::cout,
                                        arg,
@@ -327,3 +371,9 @@ void testing_trsm(const Arguments& arg)
                                        hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas3/common_trsm.cpp
+extern template void testing_trsm<float>(const Arguments&);
+extern template void testing_trsm<double>(const Arguments&);
+extern template void testing_trsm<hipblasComplex>(const Arguments&);
+extern template void testing_trsm<hipblasDoubleComplex>(const Arguments&);
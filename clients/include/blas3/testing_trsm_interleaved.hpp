@@ -0,0 +1,152 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasTrsmInterleavedModel = ArgumentModel<e_a_type,
+                                                  e_side,
+                                                  e_uplo,
+                                                  e_transA,
+                                                  e_diag,
+                                                  e_M,
+                                                  e_N,
+                                                  e_alpha,
+                                                  e_lda,
+                                                  e_ldb,
+                                                  e_batch_count>;
+
+inline void testname_trsm_interleaved(const Arguments& arg, std::string& name)
+{
+    hipblasTrsmInterleavedModel{}.test_name(arg, name);
+}
+
+// hipblasTrsmStridedBatched in HIPBLAS_BATCH_LAYOUT_INTERLEAVED mode, against the same solves in
+// the strided layout
+template <typename T>
+void testing_trsm_interleaved(const Arguments& arg)
+{
+    auto hipblasTrsmStridedBatchedFn = hipblasTrsmStridedBatched<T, false>;
+
+    hipblasSideMode_t  side        = char2hipblas_side(arg.side);
+    hipblasFillMode_t  uplo        = char2hipblas_fill(arg.uplo);
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasDiagType_t  diag        = char2hipblas_diagonal(arg.diag);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                lda         = arg.lda;
+    int                ldb         = arg.ldb;
+    int                batch_count = arg.batch_count;
+    int                K           = side == HIPBLAS_SIDE_LEFT ? M : N;
+
+    T h_alpha = arg.get_alpha<T>();
+
+    if(M < 1 || N < 1 || lda < K || ldb < M || batch_count < 1)
+        return;
+
+    hipblasStride stride_A = hipblasStride(lda) * K;
+    hipblasStride stride_B = hipblasStride(ldb) * N;
+
+    host_strided_batch_matrix<T>   hA(K, K, lda, stride_A, batch_count);
+    host_strided_batch_matrix<T>   hB(M, N, ldb, stride_B, batch_count);
+    host_strided_batch_matrix<T>   hB_gold(M, N, ldb, stride_B, batch_count);
+    host_strided_batch_matrix<T>   hB_interleaved(M, N, ldb, stride_B, batch_count);
+    device_strided_batch_matrix<T> dA(K, K, lda, stride_A, batch_count);
+    device_strided_batch_matrix<T> dB(M, N, ldb, stride_B, batch_count);
+    device_vector<T>               dA_i(stride_A * batch_count);
+    device_vector<T>               dB_i(stride_B * batch_count);
+
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA_i.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB_i.memcheck());
+
+    hipblas_init_matrix(
+        hA, arg, hipblas_client_never_set_nan, hipblas_diagonally_dominant_triangular_matrix, true);
+    hipblas_init_matrix(hB, arg, hipblas_client_never_set_nan, hipblas_general_matrix, false, true);
+    if(diag == HIPBLAS_DIAG_UNIT)
+        make_unit_diagonal(uplo, hA);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    hipDataType        type = hipblas_datatype2hip(arg.a_type);
+    hipblasLocalHandle handle(arg);
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    CHECK_HIPBLAS_ERROR(hipblasTrsmStridedBatchedFn(handle,
+                                                    side,
+                                                    uplo,
+                                                    transA,
+                                                    diag,
+                                                    M,
+                                                    N,
+                                                    &h_alpha,
+                                                    dA,
+                                                    lda,
+                                                    stride_A,
+                                                    dB,
+                                                    ldb,
+                                                    stride_B,
+                                                    batch_count));
+    CHECK_HIP_ERROR(hB_gold.transfer_from(dB));
+
+    // the same batches interleaved, element (i, j) of matrix b at b + (i + j * ld) * batch_count
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIPBLAS_ERROR(hipblasInterleaveBatch(
+        handle, K, K, type, dA, lda, stride_A, dA_i, lda, batch_count, batch_count));
+    CHECK_HIPBLAS_ERROR(hipblasInterleaveBatch(
+        handle, M, N, type, dB, ldb, stride_B, dB_i, ldb, batch_count, batch_count));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetBatchLayout(handle, HIPBLAS_BATCH_LAYOUT_INTERLEAVED));
+    CHECK_HIPBLAS_ERROR(hipblasTrsmStridedBatchedFn(handle,
+                                                    side,
+                                                    uplo,
+                                                    transA,
+                                                    diag,
+                                                    M,
+                                                    N,
+                                                    &h_alpha,
+                                                    dA_i,
+                                                    lda,
+                                                    batch_count,
+                                                    dB_i,
+                                                    ldb,
+                                                    batch_count,
+                                                    batch_count));
+    CHECK_HIPBLAS_ERROR(hipblasSetBatchLayout(handle, HIPBLAS_BATCH_LAYOUT_STRIDED));
+
+    CHECK_HIPBLAS_ERROR(hipblasDeinterleaveBatch(
+        handle, M, N, type, dB_i, ldb, batch_count, dB, ldb, stride_B, batch_count));
+    CHECK_HIP_ERROR(hB_interleaved.transfer_from(dB));
+
+    // the two layouts are solved by different algorithms, as in testing_trsm_strided_batched
+    real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+    double    tolerance = eps * 40 * M;
+    double    error
+        = norm_check_general<T>('F', M, N, ldb, stride_B, hB_gold, hB_interleaved, batch_count);
+    unit_check_error(error, tolerance);
+}
@@ -449,6 +449,9 @@ void testing_trsm_strided_batched(const Arguments& arg)
         make_unit_diagonal(uplo, hA);
     }
 
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
     for(int64_t b = 0; b < batch_count; b++)
     {
         // Calculate hB = hA*hX;
@@ -522,6 +525,9 @@ void testing_trsm_strided_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_trsm<T>(
@@ -548,13 +554,12 @@ void testing_trsm_strided_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-            {
-                gpu_time_used = get_time_us_sync(stream);
-            }
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasTrsmStridedBatchedFn,
                           (handle,
@@ -572,8 +577,10 @@ void testing_trsm_strided_batched(const Arguments& arg)
                            ldb,
                            stride_B,
                            batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasTrsmStridedBatchedModel{}.log_args<T>(std::cout,
                                                      arg,
@@ -584,3 +591,9 @@ void testing_trsm_strided_batched(const Arguments& arg)
                                                      hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas3/common_trsm.cpp
+extern template void testing_trsm_strided_batched<float>(const Arguments&);
+extern template void testing_trsm_strided_batched<double>(const Arguments&);
+extern template void testing_trsm_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_trsm_strided_batched<hipblasDoubleComplex>(const Arguments&);
@@ -177,15 +177,18 @@ void testing_trtri(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasTrtriFn(handle, uplo, diag, N, dA, lda, dinvA, ldinvA));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasTrtriModel{}.log_args<T>(std::cout,
                                         arg,
@@ -195,3 +198,9 @@ void testing_trtri(const Arguments& arg)
                                         hipblas_error);
     }
 }
+
+// Instantiated in clients/common/blas3/common_trtri.cpp
+extern template void testing_trtri<float>(const Arguments&);
+extern template void testing_trtri<double>(const Arguments&);
+extern template void testing_trtri<hipblasComplex>(const Arguments&);
+extern template void testing_trtri<hipblasDoubleComplex>(const Arguments&);
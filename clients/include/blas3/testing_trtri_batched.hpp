@@ -219,6 +219,9 @@ void testing_trtri_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int b = 0; b < batch_count; b++)
         {
             ref_trtri<T>(arg.uplo, arg.diag, N, hB[b], lda);
@@ -240,11 +243,12 @@ void testing_trtri_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasTrtriBatchedFn(handle,
                                                       uplo,
@@ -255,8 +259,10 @@ void testing_trtri_batched(const Arguments& arg)
                                                       dinvA.ptr_on_device(),
                                                       ldinvA,
                                                       batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasTrtriBatchedModel{}.log_args<T>(std::cout,
                                                arg,
@@ -266,3 +272,9 @@ void testing_trtri_batched(const Arguments& arg)
                                                hipblas_error);
     }
 }
+
+// Instantiated in clients/common/blas3/common_trtri.cpp
+extern template void testing_trtri_batched<float>(const Arguments&);
+extern template void testing_trtri_batched<double>(const Arguments&);
+extern template void testing_trtri_batched<hipblasComplex>(const Arguments&);
+extern template void testing_trtri_batched<hipblasDoubleComplex>(const Arguments&);
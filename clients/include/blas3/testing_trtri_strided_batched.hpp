@@ -233,6 +233,9 @@ void testing_trtri_strided_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int b = 0; b < batch_count; b++)
         {
             ref_trtri<T>(arg.uplo, arg.diag, N, hB.data() + b * stride_A, lda);
@@ -255,16 +258,19 @@ void testing_trtri_strided_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasTrtriStridedBatchedFn(
                 handle, uplo, diag, N, dA, lda, stride_A, dinvA, ldinvA, stride_A, batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasTrtriStridedBatchedModel{}.log_args<T>(std::cout,
                                                       arg,
@@ -274,3 +280,9 @@ void testing_trtri_strided_batched(const Arguments& arg)
                                                       hipblas_error);
     }
 }
+
+// Instantiated in clients/common/blas3/common_trtri.cpp
+extern template void testing_trtri_strided_batched<float>(const Arguments&);
+extern template void testing_trtri_strided_batched<double>(const Arguments&);
+extern template void testing_trtri_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_trtri_strided_batched<hipblasDoubleComplex>(const Arguments&);
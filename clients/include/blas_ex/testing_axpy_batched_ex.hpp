@@ -323,6 +323,9 @@ void testing_axpy_batched_ex(const Arguments& arg)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_axpy(N, h_alpha, hx[b], incx, hy_cpu[b], incy);
@@ -351,11 +354,12 @@ void testing_axpy_batched_ex(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasAxpyBatchedExFn,
                           (handle,
@@ -370,8 +374,10 @@ void testing_axpy_batched_ex(const Arguments& arg)
                            incy,
                            batch_count,
                            executionType));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasAxpyBatchedExModel{}.log_args<Ta>(std::cout,
                                                  arg,
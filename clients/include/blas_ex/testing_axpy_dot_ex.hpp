@@ -0,0 +1,185 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasAxpyDotExModel
+    = ArgumentModel<e_a_type, e_compute_type, e_N, e_alpha, e_incx, e_incy, e_incd>;
+
+inline void testname_axpy_dot_ex(const Arguments& arg, std::string& name)
+{
+    hipblasAxpyDotExModel{}.test_name(arg, name);
+}
+
+template <typename T, typename Tex = T>
+void testing_axpy_dot_ex_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType dataType      = arg.a_type;
+    hipDataType executionType = arg.compute_type;
+
+    int N = 100, incx = 1, incy = 1, incz = 1;
+
+    device_vector<T> dx(N, incx);
+    device_vector<T> dy(N, incy);
+    device_vector<T> dz(N, incz);
+
+    Tex h_alpha(1), h_result(0);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasAxpyDotEx(nullptr, N, &h_alpha, dx, incx, dy, incy, dz, incz,
+                                           &h_result, dataType, executionType),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasAxpyDotEx(handle, N, nullptr, dx, incx, dy, incy, dz, incz,
+                                           &h_result, dataType, executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasAxpyDotEx(handle, N, &h_alpha, dx, incx, nullptr, incy, dz, incz,
+                                           &h_result, dataType, executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasAxpyDotEx(handle, N, &h_alpha, dx, incx, dy, incy, nullptr, incz,
+                                           &h_result, dataType, executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasAxpyDotEx(handle, N, &h_alpha, dx, incx, dy, incy, dz, incz,
+                                           nullptr, dataType, executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // y is written, so its increment can't be zero
+    EXPECT_HIPBLAS_STATUS(hipblasAxpyDotEx(handle, N, &h_alpha, dx, incx, dy, 0, dz, incz,
+                                           &h_result, dataType, executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // the vectors and the computation must be of matching types
+    EXPECT_HIPBLAS_STATUS(hipblasAxpyDotEx(handle, N, &h_alpha, dx, incx, dy, incy, dz, incz,
+                                           &h_result, HIP_R_8I, executionType),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // With N == 0, the result is zero and the vectors can be nullptr
+    Tex h_zero(0);
+    h_result = Tex(1);
+    CHECK_HIPBLAS_ERROR(hipblasAxpyDotEx(handle, 0, nullptr, nullptr, incx, nullptr, incy,
+                                         nullptr, incz, &h_result, dataType, executionType));
+    unit_check_general<Tex>(1, 1, 1, &h_zero, &h_result);
+
+    // clang-format on
+#endif
+}
+
+template <typename T, typename Tex = T>
+void testing_axpy_dot_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    int     N    = arg.N;
+    int64_t incx = arg.incx;
+    int64_t incy = arg.incy;
+    int64_t incz = arg.incd;
+
+    hipDataType dataType      = arg.a_type;
+    hipDataType executionType = arg.compute_type;
+
+    hipblasLocalHandle handle(arg);
+
+    if(N <= 0)
+    {
+        Tex h_zero(0), h_result(1);
+        CHECK_HIPBLAS_ERROR(hipblasAxpyDotEx(handle,
+                                             N,
+                                             nullptr,
+                                             nullptr,
+                                             incx,
+                                             nullptr,
+                                             incy,
+                                             nullptr,
+                                             incz,
+                                             &h_result,
+                                             dataType,
+                                             executionType));
+        unit_check_general<Tex>(1, 1, 1, &h_zero, &h_result);
+        return;
+    }
+
+    Tex h_alpha = arg.get_alpha<Tex>();
+
+    // Naming: dx is in GPU (device) memory. hx is in CPU (host) memory
+    host_vector<T> hx(N, incx);
+    host_vector<T> hy(N, incy);
+    host_vector<T> hz(N, incz);
+    host_vector<T> hy_gold(N, incy);
+    host_vector<T> hy_host(N, incy);
+    host_vector<T> hy_device(N, incy);
+
+    device_vector<T>   dx(N, incx);
+    device_vector<T>   dy(N, incy);
+    device_vector<T>   dz(N, incz);
+    device_vector<Tex> d_alpha(1);
+    device_vector<Tex> d_result(1);
+
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dz.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_result.memcheck());
+
+    hipblas_init_vector(hx, arg, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_vector(hy, arg, hipblas_client_alpha_sets_nan, false);
+    hipblas_init_vector(hz, arg, hipblas_client_alpha_sets_nan, false, true);
+    hy_gold = hy;
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(dz.transfer_from(hz));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Tex), hipMemcpyHostToDevice));
+
+    Tex result_gold = ref_axpy_dot_ex<T, Tex>(N, h_alpha, hx, incx, hy_gold, incy, hz, incz);
+
+    Tex result_host, result_device;
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasAxpyDotEx(
+        handle, N, &h_alpha, dx, incx, dy, incy, dz, incz, &result_host, dataType, executionType));
+    CHECK_HIP_ERROR(hy_host.transfer_from(dy));
+
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(hipblasAxpyDotEx(
+        handle, N, d_alpha, dx, incx, dy, incy, dz, incz, d_result, dataType, executionType));
+    CHECK_HIP_ERROR(hy_device.transfer_from(dy));
+    CHECK_HIP_ERROR(hipMemcpy(&result_device, d_result, sizeof(Tex), hipMemcpyDeviceToHost));
+
+    // the data are small integers, so the sums are exact in any order
+    int abs_incy = incy < 0 ? -incy : incy;
+    unit_check_general<T>(1, N, abs_incy, hy_gold, hy_host);
+    unit_check_general<T>(1, N, abs_incy, hy_gold, hy_device);
+    unit_check_general<Tex>(1, 1, 1, &result_gold, &result_host);
+    unit_check_general<Tex>(1, 1, 1, &result_gold, &result_device);
+#endif
+}
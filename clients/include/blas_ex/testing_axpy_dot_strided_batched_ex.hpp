@@ -0,0 +1,224 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasAxpyDotStridedBatchedExModel = ArgumentModel<e_a_type,
+                                                          e_compute_type,
+                                                          e_N,
+                                                          e_alpha,
+                                                          e_incx,
+                                                          e_incy,
+                                                          e_incd,
+                                                          e_stride_scale,
+                                                          e_batch_count>;
+
+inline void testname_axpy_dot_strided_batched_ex(const Arguments& arg, std::string& name)
+{
+    hipblasAxpyDotStridedBatchedExModel{}.test_name(arg, name);
+}
+
+template <typename T, typename Tex = T>
+void testing_axpy_dot_strided_batched_ex_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType dataType      = arg.a_type;
+    hipDataType executionType = arg.compute_type;
+
+    int N = 100, incx = 1, incy = 1, incz = 1, batch_count = 2;
+
+    hipblasStride stridex = N, stridey = N, stridez = N;
+
+    device_strided_batch_vector<T> dx(N, incx, stridex, batch_count);
+    device_strided_batch_vector<T> dy(N, incy, stridey, batch_count);
+    device_strided_batch_vector<T> dz(N, incz, stridez, batch_count);
+
+    Tex h_alpha(1), h_result[2];
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasAxpyDotStridedBatchedEx(nullptr, N, &h_alpha, dx, incx, stridex,
+                                                         dy, incy, stridey, dz, incz, stridez,
+                                                         h_result, batch_count, dataType,
+                                                         executionType),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasAxpyDotStridedBatchedEx(handle, N, nullptr, dx, incx, stridex,
+                                                         dy, incy, stridey, dz, incz, stridez,
+                                                         h_result, batch_count, dataType,
+                                                         executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasAxpyDotStridedBatchedEx(handle, N, &h_alpha, dx, incx, stridex,
+                                                         dy, incy, stridey, dz, incz, stridez,
+                                                         nullptr, batch_count, dataType,
+                                                         executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasAxpyDotStridedBatchedEx(handle, N, &h_alpha, dx, incx, stridex,
+                                                         dy, incy, stridey, dz, incz, stridez,
+                                                         h_result, -1, dataType, executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // With batch_count == 0, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasAxpyDotStridedBatchedEx(handle, N, nullptr, nullptr, incx, stridex,
+                                                       nullptr, incy, stridey, nullptr, incz,
+                                                       stridez, nullptr, 0, dataType,
+                                                       executionType));
+
+    // clang-format on
+#endif
+}
+
+template <typename T, typename Tex = T>
+void testing_axpy_dot_strided_batched_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    int N           = arg.N;
+    int incx        = arg.incx;
+    int incy        = arg.incy;
+    int incz        = arg.incd;
+    int batch_count = arg.batch_count;
+
+    hipDataType dataType      = arg.a_type;
+    hipDataType executionType = arg.compute_type;
+
+    hipblasLocalHandle handle(arg);
+
+    int abs_incx = incx < 0 ? -incx : incx;
+    int abs_incy = incy < 0 ? -incy : incy;
+    int abs_incz = incz < 0 ? -incz : incz;
+
+    hipblasStride stridex = hipblasStride(N) * abs_incx * arg.stride_scale;
+    hipblasStride stridey = hipblasStride(N) * abs_incy * arg.stride_scale;
+    hipblasStride stridez = hipblasStride(N) * abs_incz * arg.stride_scale;
+
+    // the results of empty vectors are zero, so result is needed even then
+    if(N <= 0 || batch_count <= 0)
+    {
+        host_vector<Tex> h_result(std::max(batch_count, 1));
+        EXPECT_HIPBLAS_STATUS(hipblasAxpyDotStridedBatchedEx(handle,
+                                                             N,
+                                                             nullptr,
+                                                             nullptr,
+                                                             incx,
+                                                             stridex,
+                                                             nullptr,
+                                                             incy,
+                                                             stridey,
+                                                             nullptr,
+                                                             incz,
+                                                             stridez,
+                                                             h_result,
+                                                             batch_count,
+                                                             dataType,
+                                                             executionType),
+                              batch_count < 0 ? HIPBLAS_STATUS_INVALID_VALUE
+                                              : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    Tex h_alpha = arg.get_alpha<Tex>();
+
+    // Naming: dx is in GPU (device) memory. hx is in CPU (host) memory
+    host_strided_batch_vector<T> hx(N, incx, stridex, batch_count);
+    host_strided_batch_vector<T> hy(N, incy, stridey, batch_count);
+    host_strided_batch_vector<T> hz(N, incz, stridez, batch_count);
+    host_strided_batch_vector<T> hy_gold(N, incy, stridey, batch_count);
+    host_strided_batch_vector<T> hy_host(N, incy, stridey, batch_count);
+    host_strided_batch_vector<T> hy_device(N, incy, stridey, batch_count);
+    host_vector<Tex>             result_gold(batch_count);
+    host_vector<Tex>             result_host(batch_count);
+    host_vector<Tex>             result_device(batch_count);
+
+    device_strided_batch_vector<T> dx(N, incx, stridex, batch_count);
+    device_strided_batch_vector<T> dy(N, incy, stridey, batch_count);
+    device_strided_batch_vector<T> dz(N, incz, stridez, batch_count);
+    device_vector<Tex>             d_alpha(1);
+    device_vector<Tex>             d_result(batch_count);
+
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dz.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_result.memcheck());
+
+    hipblas_init_vector(hx, arg, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_vector(hy, arg, hipblas_client_alpha_sets_nan, false);
+    hipblas_init_vector(hz, arg, hipblas_client_alpha_sets_nan, false, true);
+    hy_gold.copy_from(hy);
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(dz.transfer_from(hz));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Tex), hipMemcpyHostToDevice));
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(int b = 0; b < batch_count; b++)
+        result_gold[b]
+            = ref_axpy_dot_ex<T, Tex>(N, h_alpha, hx[b], incx, hy_gold[b], incy, hz[b], incz);
+
+    auto axpy_dot = [&](const Tex* alpha, Tex* result) {
+        return hipblasAxpyDotStridedBatchedEx(handle,
+                                              N,
+                                              alpha,
+                                              dx,
+                                              incx,
+                                              stridex,
+                                              dy,
+                                              incy,
+                                              stridey,
+                                              dz,
+                                              incz,
+                                              stridez,
+                                              result,
+                                              batch_count,
+                                              dataType,
+                                              executionType);
+    };
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(axpy_dot(&h_alpha, result_host));
+    CHECK_HIP_ERROR(hy_host.transfer_from(dy));
+
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(axpy_dot(d_alpha, d_result));
+    CHECK_HIP_ERROR(hy_device.transfer_from(dy));
+    CHECK_HIP_ERROR(result_device.transfer_from(d_result));
+
+    // the data are small integers, so the sums are exact in any order
+    unit_check_general<T>(1, N, batch_count, abs_incy, stridey, hy_gold, hy_host);
+    unit_check_general<T>(1, N, batch_count, abs_incy, stridey, hy_gold, hy_device);
+    unit_check_general<Tex>(1, batch_count, 1, result_gold, result_host);
+    unit_check_general<Tex>(1, batch_count, 1, result_gold, result_device);
+#endif
+}
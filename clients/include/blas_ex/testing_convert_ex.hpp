@@ -0,0 +1,363 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasConvertExModel = ArgumentModel<e_a_type,
+                                            e_b_type,
+                                            e_N,
+                                            e_alpha,
+                                            e_incx,
+                                            e_incy,
+                                            e_stride_scale,
+                                            e_batch_count>;
+
+inline void testname_convert_ex(const Arguments& arg, std::string& name)
+{
+    hipblasConvertExModel{}.test_name(arg, name);
+}
+
+// the components of the real types as double, and back, rounded to nearest even
+template <typename T>
+inline double convert_ex_to_double(T x)
+{
+    return double(x);
+}
+
+inline double convert_ex_to_double(hipblasHalf x)
+{
+    return half_to_float(x);
+}
+
+inline double convert_ex_to_double(hipblasBfloat16 x)
+{
+    return bfloat16_to_float(x);
+}
+
+template <typename T>
+inline T convert_ex_from_double(double x)
+{
+    return T(x);
+}
+
+template <>
+inline hipblasHalf convert_ex_from_double(double x)
+{
+    return float_to_half(float(x));
+}
+
+template <>
+inline hipblasBfloat16 convert_ex_from_double(double x)
+{
+    return float_to_bfloat16(float(x));
+}
+
+template <typename Tx, typename Ty = Tx>
+void testing_convert_ex_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType xType = arg.a_type;
+    hipDataType yType = arg.b_type;
+
+    int N = 100, incx = 1, incy = 1, batch_count = 2;
+
+    hipblasStride stridex = N, stridey = N;
+
+    device_strided_batch_vector<Tx> dx(N, incx, stridex, batch_count);
+    device_strided_batch_vector<Ty> dy(N, incy, stridey, batch_count);
+
+    hipblasRoundingMode_t   rne  = HIPBLAS_ROUND_NEAREST_EVEN;
+    hipblasSaturationMode_t none = HIPBLAS_SATURATION_NONE;
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasConvertStridedBatchedEx(nullptr, N, dx, xType, incx, stridex, dy,
+                                                         yType, incy, stridey, nullptr, rne, none,
+                                                         batch_count),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasConvertStridedBatchedEx(handle, N, dx, xType, incx, stridex, dy,
+                                                         yType, incy, stridey, nullptr,
+                                                         hipblasRoundingMode_t(2), none,
+                                                         batch_count),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasConvertStridedBatchedEx(handle, N, dx, xType, incx, stridex, dy,
+                                                         yType, incy, stridey, nullptr, rne,
+                                                         hipblasSaturationMode_t(2),
+                                                         batch_count),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasConvertStridedBatchedEx(handle, N, nullptr, xType, incx, stridex,
+                                                         dy, yType, incy, stridey, nullptr, rne,
+                                                         none, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasConvertStridedBatchedEx(handle, N, dx, xType, incx, stridex,
+                                                         nullptr, yType, incy, stridey, nullptr,
+                                                         rne, none, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasConvertStridedBatchedEx(handle, N, dx, xType, incx, stridex, dy,
+                                                         yType, incy, stridey, nullptr, rne, none,
+                                                         -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // integers aren't converted, and complex vectors only to complex vectors
+    EXPECT_HIPBLAS_STATUS(hipblasConvertEx(handle, N, dx, HIP_R_8I, incx, dy, yType, incy,
+                                           nullptr, rne, none),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasConvertEx(handle, N, dx, xType, incx, dy, HIP_C_32F, incy,
+                                           nullptr, rne, none),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // With N == 0 or batchCount == 0, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasConvertEx(handle, 0, nullptr, xType, incx, nullptr, yType, incy,
+                                         nullptr, rne, none));
+    CHECK_HIPBLAS_ERROR(hipblasConvertBatchedEx(handle, N, nullptr, xType, incx, nullptr, yType,
+                                                incy, nullptr, rne, none, 0));
+
+    // clang-format on
+#endif
+}
+
+// The conversions of float to 8-bit floats and back, for values whose roundings and
+// saturations are known
+inline void testing_convert_ex_fp8(hipblasHandle_t handle)
+{
+#ifdef HIPBLAS_V2
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+
+    // HIP_R_8F_E4M3_FNUZ has a largest value of 240, 3 bits of mantissa and a smallest
+    // subnormal of 2^-10
+    const std::vector<float> x{1, -1.5f, 17, 19, 250, 1000, -1000, 0.0005f, nan};
+    const std::vector<float> nearest{1, -1.5f, 16, 20, nan, nan, nan, 0.0009765625f, nan};
+    const std::vector<float> saturated{1, -1.5f, 16, 20, 240, 240, -240, 0.0009765625f, nan};
+    const std::vector<float> toward_zero{1, -1.5f, 16, 18, 240, 240, -240, 0, nan};
+
+    int                     n = int(x.size());
+    host_vector<float>      hx(n), hy(n);
+    device_vector<float>    dx(n), dy(n);
+    device_vector<uint8_t>  d8(n);
+    hipblasRoundingMode_t   rne  = HIPBLAS_ROUND_NEAREST_EVEN;
+    hipblasSaturationMode_t none = HIPBLAS_SATURATION_NONE;
+
+    std::copy(x.begin(), x.end(), hx.begin());
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+    struct
+    {
+        hipblasRoundingMode_t     rounding;
+        hipblasSaturationMode_t   saturation;
+        const std::vector<float>& expected;
+    } cases[] = {{rne, none, nearest},
+                 {rne, HIPBLAS_SATURATION_FINITE, saturated},
+                 {HIPBLAS_ROUND_TOWARD_ZERO, none, toward_zero}};
+
+    for(const auto& c : cases)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasConvertEx(handle,
+                                             n,
+                                             dx,
+                                             HIP_R_32F,
+                                             1,
+                                             d8,
+                                             HIP_R_8F_E4M3_FNUZ,
+                                             1,
+                                             nullptr,
+                                             c.rounding,
+                                             c.saturation));
+        CHECK_HIPBLAS_ERROR(hipblasConvertEx(
+            handle, n, d8, HIP_R_8F_E4M3_FNUZ, 1, dy, HIP_R_32F, 1, nullptr, rne, none));
+        CHECK_HIP_ERROR(hy.transfer_from(dy));
+        for(int i = 0; i < n; i++)
+        {
+            if(std::isnan(c.expected[i]))
+                EXPECT_TRUE(std::isnan(hy[i])) << "x = " << x[i];
+            else
+                EXPECT_EQ(hy[i], c.expected[i]) << "x = " << x[i];
+        }
+    }
+#endif
+}
+
+template <typename Tx, typename Ty = Tx>
+void testing_convert_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    using Rx = real_t<Tx>;
+    using Ry = real_t<Ty>;
+    using Ts = std::conditional_t<std::is_same_v<Rx, double> || std::is_same_v<Ry, double>,
+                                  double,
+                                  float>;
+
+    int N           = arg.N;
+    int incx        = arg.incx;
+    int incy        = arg.incy;
+    int batch_count = arg.batch_count;
+
+    hipDataType xType = arg.a_type;
+    hipDataType yType = arg.b_type;
+
+    Ts h_scale = arg.get_alpha<Ts>();
+
+    hipblasLocalHandle handle(arg);
+
+    int           abs_incx = incx < 0 ? -incx : incx;
+    int           abs_incy = incy < 0 ? -incy : incy;
+    hipblasStride stridex  = hipblasStride(N) * abs_incx * arg.stride_scale;
+    hipblasStride stridey  = hipblasStride(N) * abs_incy * arg.stride_scale;
+
+    hipblasRoundingMode_t   rne  = HIPBLAS_ROUND_NEAREST_EVEN;
+    hipblasSaturationMode_t none = HIPBLAS_SATURATION_NONE;
+
+    if(N <= 0 || batch_count <= 0)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasConvertStridedBatchedEx(handle,
+                                                             N,
+                                                             nullptr,
+                                                             xType,
+                                                             incx,
+                                                             stridex,
+                                                             nullptr,
+                                                             yType,
+                                                             incy,
+                                                             stridey,
+                                                             nullptr,
+                                                             rne,
+                                                             none,
+                                                             batch_count),
+                              batch_count < 0 ? HIPBLAS_STATUS_INVALID_VALUE
+                                              : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    // Naming: dx is in GPU (device) memory. hx is in CPU (host) memory
+    host_strided_batch_vector<Tx> hx(N, incx, stridex, batch_count);
+    host_batch_vector<Tx>         hx_batch(N, incx, batch_count);
+    host_strided_batch_vector<Ty> hy(N, incy, stridey, batch_count);
+    host_strided_batch_vector<Ty> hy_gold(N, incy, stridey, batch_count);
+    host_batch_vector<Ty>         hy_batch(N, incy, batch_count);
+    host_batch_vector<Ty>         hy_batch_gold(N, incy, batch_count);
+    host_vector<Ty>               hy_unscaled(size_t(N) * abs_incy);
+    host_vector<Ty>               hy_unscaled_gold(size_t(N) * abs_incy);
+
+    device_strided_batch_vector<Tx> dx(N, incx, stridex, batch_count);
+    device_batch_vector<Tx>         dx_batch(N, incx, batch_count);
+    device_strided_batch_vector<Ty> dy(N, incy, stridey, batch_count);
+    device_batch_vector<Ty>         dy_batch(N, incy, batch_count);
+    device_vector<Ty>               dy_unscaled(size_t(N) * abs_incy);
+    device_vector<Ts>               d_scale(1);
+
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx_batch.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_batch.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_unscaled.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_scale.memcheck());
+
+    // small integers, whose scalings by the scales of the tests are exact in every type
+    hipblas_init_vector(hx, arg, hipblas_client_never_set_nan, true);
+    hipblas_init_vector(hy, arg, hipblas_client_never_set_nan, false);
+    for(int b = 0; b < batch_count; b++)
+        for(int i = 0; i < N; i++)
+            hx_batch[b][i * abs_incx] = hx[b][i * abs_incx];
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dx_batch.transfer_from(hx_batch));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(hipMemcpy(d_scale, &h_scale, sizeof(Ts), hipMemcpyHostToDevice));
+
+    // y_b := scale * x_b component by component, the first element being at the end of the
+    // vectors with negative increments
+    constexpr int components = is_complex<Tx> ? 2 : 1;
+
+    auto reference = [&](const Tx* x, Ty* y, double scale) {
+        for(int i = 0; i < N; i++)
+        {
+            int64_t   xi = incx >= 0 ? int64_t(i) * incx : int64_t(N - 1 - i) * -incx;
+            int64_t   yi = incy >= 0 ? int64_t(i) * incy : int64_t(N - 1 - i) * -incy;
+            const Rx* xr = reinterpret_cast<const Rx*>(x + xi);
+            Ry*       yr = reinterpret_cast<Ry*>(y + yi);
+            for(int c = 0; c < components; c++)
+                yr[c] = convert_ex_from_double<Ry>(convert_ex_to_double(xr[c]) * scale);
+        }
+    };
+    for(int b = 0; b < batch_count; b++)
+    {
+        reference(hx[b], hy_gold[b], h_scale);
+        reference(hx_batch[b], hy_batch_gold[b], h_scale);
+    }
+    reference(hx[0], hy_unscaled_gold, 1.0);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasConvertStridedBatchedEx(handle,
+                                                       N,
+                                                       dx,
+                                                       xType,
+                                                       incx,
+                                                       stridex,
+                                                       dy,
+                                                       yType,
+                                                       incy,
+                                                       stridey,
+                                                       &h_scale,
+                                                       rne,
+                                                       none,
+                                                       batch_count));
+    CHECK_HIPBLAS_ERROR(hipblasConvertEx(
+        handle, N, dx, xType, incx, dy_unscaled, yType, incy, nullptr, rne, none));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(hipblasConvertBatchedEx(handle,
+                                                N,
+                                                dx_batch.ptr_on_device(),
+                                                xType,
+                                                incx,
+                                                dy_batch.ptr_on_device(),
+                                                yType,
+                                                incy,
+                                                d_scale,
+                                                rne,
+                                                none,
+                                                batch_count));
+
+    CHECK_HIP_ERROR(hy.transfer_from(dy));
+    CHECK_HIP_ERROR(hy_batch.transfer_from(dy_batch));
+    CHECK_HIP_ERROR(hy_unscaled.transfer_from(dy_unscaled));
+
+    unit_check_general<Ty>(1, N, batch_count, abs_incy, stridey, hy_gold.data(), hy.data());
+    unit_check_general<Ty>(1, N, batch_count, abs_incy, hy_batch_gold, hy_batch);
+    unit_check_general<Ty>(1, N, abs_incy, hy_unscaled_gold, hy_unscaled);
+
+    if constexpr(std::is_same_v<Tx, float> && std::is_same_v<Ty, float>)
+        testing_convert_ex_fp8(handle);
+#endif
+}
@@ -0,0 +1,234 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGeamExModel = ArgumentModel<e_a_type,
+                                         e_c_type,
+                                         e_compute_type,
+                                         e_transA,
+                                         e_transB,
+                                         e_M,
+                                         e_N,
+                                         e_alpha,
+                                         e_lda,
+                                         e_beta,
+                                         e_ldb,
+                                         e_ldc>;
+
+inline void testname_geam_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGeamExModel{}.test_name(arg, name);
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_geam_ex_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType          aType       = arg.a_type;
+    hipDataType          cType       = arg.c_type;
+    hipblasComputeType_t computeType = arg.compute_type_gemm;
+    hipblasOperation_t   transA      = HIPBLAS_OP_N;
+    hipblasOperation_t   transB      = HIPBLAS_OP_N;
+
+    int M = 101, N = 100, lda = 102, ldb = 103, ldc = 104;
+
+    device_matrix<Ti> dA(M, N, lda);
+    device_matrix<Ti> dB(M, N, ldb);
+    device_matrix<To> dC(M, N, ldc);
+
+    Tex h_alpha(1), h_beta(2);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasGeamEx(nullptr, transA, transB, M, N, &h_alpha, dA, aType, lda,
+                                        &h_beta, dB, aType, ldb, dC, cType, ldc, computeType),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGeamEx(handle, (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL, transB,
+                                        M, N, &h_alpha, dA, aType, lda, &h_beta, dB, aType, ldb,
+                                        dC, cType, ldc, computeType),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGeamEx(handle, transA, transB, M, N, nullptr, dA, aType, lda,
+                                        &h_beta, dB, aType, ldb, dC, cType, ldc, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGeamEx(handle, transA, transB, M, N, &h_alpha, dA, aType, lda,
+                                        nullptr, dB, aType, ldb, dC, cType, ldc, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGeamEx(handle, transA, transB, M, N, &h_alpha, dA, aType, lda,
+                                        &h_beta, dB, aType, ldb, nullptr, cType, ldc, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGeamEx(handle, transA, transB, M, N, &h_alpha, dA, aType, M - 1,
+                                        &h_beta, dB, aType, ldb, dC, cType, ldc, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGeamEx(handle, transA, transB, M, N, &h_alpha, dA, aType, lda,
+                                        &h_beta, dB, aType, ldb, dC, cType, M - 1, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // integer C isn't supported
+    EXPECT_HIPBLAS_STATUS(hipblasGeamEx(handle, transA, transB, M, N, &h_alpha, dA, aType, lda,
+                                        &h_beta, dB, aType, ldb, dC, HIP_R_32I, ldc, computeType),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // With M == 0 or N == 0, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasGeamEx(handle, transA, transB, 0, N, nullptr, nullptr, aType, lda,
+                                      nullptr, nullptr, aType, ldb, nullptr, cType, ldc,
+                                      computeType));
+    CHECK_HIPBLAS_ERROR(hipblasGeamEx(handle, transA, transB, M, 0, nullptr, nullptr, aType, lda,
+                                      nullptr, nullptr, aType, ldb, nullptr, cType, ldc,
+                                      computeType));
+
+    // clang-format on
+#endif
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_geam_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+    int                ldc    = arg.ldc;
+
+    hipDataType          a_type       = arg.a_type;
+    hipDataType          c_type       = arg.c_type;
+    hipblasComputeType_t compute_type = arg.compute_type_gemm;
+
+    hipblasLocalHandle handle(arg);
+
+    int A_row = transA == HIPBLAS_OP_N ? M : N;
+    int A_col = transA == HIPBLAS_OP_N ? N : M;
+    int B_row = transB == HIPBLAS_OP_N ? M : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : M;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = M < 0 || N < 0 || lda < A_row || lda < 1 || ldb < B_row || ldb < 1
+                        || ldc < M || ldc < 1;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasGeamEx(handle,
+                                            transA,
+                                            transB,
+                                            M,
+                                            N,
+                                            nullptr,
+                                            nullptr,
+                                            a_type,
+                                            lda,
+                                            nullptr,
+                                            nullptr,
+                                            a_type,
+                                            ldb,
+                                            nullptr,
+                                            c_type,
+                                            ldc,
+                                            compute_type),
+                              invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    Tex h_alpha = arg.get_alpha<Tex>();
+    Tex h_beta  = arg.get_beta<Tex>();
+
+    // Naming: dA is in GPU (device) memory. hA is in CPU (host) memory
+    host_matrix<Ti> hA(A_row, A_col, lda);
+    host_matrix<Ti> hB(B_row, B_col, ldb);
+    host_matrix<To> hC(M, N, ldc);
+    host_matrix<To> hC_gold(M, N, ldc);
+    host_matrix<To> hC_host(M, N, ldc);
+    host_matrix<To> hC_device(M, N, ldc);
+
+    device_matrix<Ti>  dA(A_row, A_col, lda);
+    device_matrix<Ti>  dB(B_row, B_col, ldb);
+    device_matrix<To>  dC(M, N, ldc);
+    device_vector<Tex> d_alpha(1);
+    device_vector<Tex> d_beta(1);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(hB, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix, false, true);
+    hipblas_init_matrix(hC, arg, hipblas_client_never_set_nan, hipblas_general_matrix);
+    hC_gold = hC;
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Tex), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(Tex), hipMemcpyHostToDevice));
+
+    ref_geam_ex<Ti, To, Tex>(transA, transB, M, N, h_alpha, hA, lda, h_beta, hB, ldb, hC_gold, ldc);
+
+    auto geam = [&](const Tex* alpha, const Tex* beta) {
+        return hipblasGeamEx(handle,
+                             transA,
+                             transB,
+                             M,
+                             N,
+                             alpha,
+                             dA,
+                             a_type,
+                             lda,
+                             beta,
+                             dB,
+                             a_type,
+                             ldb,
+                             dC,
+                             c_type,
+                             ldc,
+                             compute_type);
+    };
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(geam(&h_alpha, &h_beta));
+    CHECK_HIP_ERROR(hC_host.transfer_from(dC));
+
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(geam(d_alpha, d_beta));
+    CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+
+    unit_check_general<To>(M, N, ldc, hC_gold, hC_host);
+    unit_check_general<To>(M, N, ldc, hC_gold, hC_device);
+#endif
+}
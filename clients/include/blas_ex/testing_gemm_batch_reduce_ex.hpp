@@ -0,0 +1,237 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmBatchReduceExModel = ArgumentModel<e_a_type,
+                                                    e_c_type,
+                                                    e_compute_type,
+                                                    e_transA,
+                                                    e_transB,
+                                                    e_M,
+                                                    e_N,
+                                                    e_K,
+                                                    e_alpha,
+                                                    e_lda,
+                                                    e_ldb,
+                                                    e_beta,
+                                                    e_ldc,
+                                                    e_batch_count>;
+
+inline void testname_gemm_batch_reduce_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmBatchReduceExModel{}.test_name(arg, name);
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_batch_reduce_ex_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType          aType       = arg.a_type;
+    hipDataType          bType       = arg.b_type;
+    hipDataType          cType       = arg.c_type;
+    hipblasComputeType_t computeType = arg.compute_type_gemm;
+    hipblasGemmAlgo_t    algo        = HIPBLAS_GEMM_DEFAULT;
+
+    int M = 101, N = 100, K = 102, lda = 103, ldb = 104, ldc = 105;
+
+    hipblasOperation_t transA = HIPBLAS_OP_N;
+    hipblasOperation_t transB = HIPBLAS_OP_N;
+
+    device_matrix<Ti> dA(M, K, lda);
+    device_matrix<Ti> dB(K, N, ldb);
+    device_matrix<To> dC(M, N, ldc);
+
+    Tex h_alpha(1), h_beta(2);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmBatchReduceEx(nullptr, transA, transB, M, N, K, &h_alpha,
+                              dA, aType, lda, 0, dB, bType, ldb, 0, &h_beta, dC, cType, ldc, 2,
+                              computeType, algo),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmBatchReduceEx(handle, transA, transB, M, N, K, &h_alpha,
+                              dA, aType, lda, 0, dB, bType, ldb, 0, &h_beta, dC, cType, ldc, -1,
+                              computeType, algo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmBatchReduceEx(handle, transA, transB, M, N, -1, &h_alpha,
+                              dA, aType, lda, 0, dB, bType, ldb, 0, &h_beta, dC, cType, ldc, 2,
+                              computeType, algo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmBatchReduceEx(handle, transA, transB, M, N, K, &h_alpha,
+                              dA, aType, M - 1, 0, dB, bType, ldb, 0, &h_beta, dC, cType, ldc, 2,
+                              computeType, algo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmBatchReduceEx(handle, transA, transB, M, N, K, &h_alpha,
+                              nullptr, aType, lda, 0, dB, bType, ldb, 0, &h_beta, dC, cType, ldc,
+                              2, computeType, algo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmBatchReduceEx(handle, transA, transB, M, N, K, &h_alpha,
+                              dA, aType, lda, 0, dB, bType, ldb, 0, &h_beta, nullptr, cType, ldc,
+                              2, computeType, algo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If M == 0 || N == 0, can have nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasGemmBatchReduceEx(handle, transA, transB, 0, N, K, nullptr,
+                            nullptr, aType, lda, 0, nullptr, bType, ldb, 0, nullptr, nullptr,
+                            cType, ldc, 2, computeType, algo));
+
+    // clang-format on
+#endif
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_batch_reduce_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                lda         = arg.lda;
+    int                ldb         = arg.ldb;
+    int                ldc         = arg.ldc;
+    int                batch_count = arg.batch_count;
+
+    hipDataType          a_type       = arg.a_type;
+    hipDataType          b_type       = arg.b_type;
+    hipDataType          c_type       = arg.c_type;
+    hipblasComputeType_t compute_type = arg.compute_type_gemm;
+    hipblasGemmAlgo_t    algo         = HIPBLAS_GEMM_DEFAULT;
+
+    Tex h_alpha = arg.get_alpha<Tex>();
+    Tex h_beta  = arg.get_beta<Tex>();
+    Tex h_one(1);
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    hipblasLocalHandle handle(arg);
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size
+        = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0;
+    if(invalid_size || !M || !N)
+        return;
+
+    // Matrices one after the other, so A_i lie along k when op(A) is A and B_i when op(B) is a
+    // transpose, and the sum is a single gemm when both do
+    int           count    = std::max(batch_count, 1);
+    hipblasStride stride_A = hipblasStride(lda) * A_col;
+    hipblasStride stride_B = hipblasStride(ldb) * B_col;
+
+    host_strided_batch_matrix<Ti> hA(A_row, A_col, lda, stride_A, count);
+    host_strided_batch_matrix<Ti> hB(B_row, B_col, ldb, stride_B, count);
+    host_matrix<To>               hC(M, N, ldc);
+    host_matrix<To>               hC_device(M, N, ldc);
+    host_matrix<To>               hC_gold(M, N, ldc);
+
+    device_strided_batch_matrix<Ti> dA(A_row, A_col, lda, stride_A, count);
+    device_strided_batch_matrix<Ti> dB(B_row, B_col, ldb, stride_B, count);
+    device_matrix<To>               dC(M, N, ldc);
+    device_vector<Tex>              d_alpha(1), d_beta(1);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(
+        hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+    hipblas_init_matrix(hC, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Tex), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(Tex), hipMemcpyHostToDevice));
+
+    // CPU BLAS, with the products accumulated into C one after the other
+    hC_gold = hC;
+    for(int b = 0; b < batch_count; b++)
+        ref_gemm<Ti, To, Tex>(transA,
+                              transB,
+                              M,
+                              N,
+                              K,
+                              h_alpha,
+                              hA[b],
+                              lda,
+                              hB[b],
+                              ldb,
+                              b ? h_one : h_beta,
+                              hC_gold,
+                              ldc);
+    if(!batch_count)
+        ref_gemm<Ti, To, Tex>(
+            transA, transB, M, N, 0, h_alpha, hA[0], lda, hB[0], ldb, h_beta, hC_gold, ldc);
+
+    for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
+    {
+        bool host = pointer_mode == HIPBLAS_POINTER_MODE_HOST;
+
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, pointer_mode));
+        CHECK_HIPBLAS_ERROR(hipblasGemmBatchReduceEx(handle,
+                                                     transA,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     host ? &h_alpha : d_alpha,
+                                                     dA,
+                                                     a_type,
+                                                     lda,
+                                                     stride_A,
+                                                     dB,
+                                                     b_type,
+                                                     ldb,
+                                                     stride_B,
+                                                     host ? &h_beta : d_beta,
+                                                     dC,
+                                                     c_type,
+                                                     ldc,
+                                                     batch_count,
+                                                     compute_type,
+                                                     algo));
+        CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+
+        unit_check_general<To>(M, N, ldc, hC_gold, hC_device);
+    }
+#endif
+}
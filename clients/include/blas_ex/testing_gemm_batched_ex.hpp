@@ -538,6 +538,9 @@ void testing_gemm_batched_ex(const Arguments& arg)
         CHECK_HIP_ERROR(hC_device.transfer_from(dC));
 
         // CPU BLAS
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_gemm<Ti, To, Tex>(transA,
@@ -589,11 +592,12 @@ void testing_gemm_batched_ex(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             if(!arg.with_flags)
             {
@@ -644,8 +648,10 @@ void testing_gemm_batched_ex(const Arguments& arg)
                                                     algo,
                                                     flags));
             }
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasGemmBatchedExModel{}.log_args<To>(std::cout,
                                                  arg,
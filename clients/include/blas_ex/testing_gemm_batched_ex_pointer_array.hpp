@@ -0,0 +1,278 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmBatchedExPointerArrayModel = ArgumentModel<e_a_type,
+                                                            e_c_type,
+                                                            e_compute_type,
+                                                            e_transA,
+                                                            e_transB,
+                                                            e_M,
+                                                            e_N,
+                                                            e_K,
+                                                            e_alpha,
+                                                            e_lda,
+                                                            e_ldb,
+                                                            e_beta,
+                                                            e_ldc,
+                                                            e_batch_count>;
+
+inline void testname_gemm_batched_ex_pointer_array(const Arguments& arg, std::string& name)
+{
+    hipblasGemmBatchedExPointerArrayModel{}.test_name(arg, name);
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_batched_ex_pointer_array_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipblasPointerArray_t array;
+    void**                device_pointers;
+    void*                 pointers[3] = {};
+
+    device_vector<int64_t> d_offsets(3);
+    device_vector<Ti>      dA(3);
+
+    EXPECT_HIPBLAS_STATUS(hipblasPointerArrayCreate(nullptr, 3), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasPointerArrayCreate(&array, -1), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(array, nullptr);
+
+    CHECK_HIPBLAS_ERROR(hipblasPointerArrayCreate(&array, 3));
+
+    EXPECT_HIPBLAS_STATUS(hipblasPointerArraySet(nullptr, array, 0, 3, pointers),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasPointerArraySet(handle, nullptr, 0, 3, pointers),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasPointerArraySet(handle, array, -1, 3, pointers),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasPointerArraySet(handle, array, 1, 3, pointers),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasPointerArraySet(handle, array, 0, 3, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasPointerArraySetOffsets(nullptr, array, dA, d_offsets),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasPointerArraySetOffsets(handle, array, nullptr, d_offsets),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasPointerArraySetOffsets(handle, array, dA, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasPointerArrayGetDevicePointer(nullptr, &device_pointers),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasPointerArrayGetDevicePointer(array, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // With count == 0, pointers can be nullptr
+    CHECK_HIPBLAS_ERROR(hipblasPointerArraySet(handle, array, 3, 0, nullptr));
+
+    CHECK_HIPBLAS_ERROR(hipblasPointerArrayDestroy(array));
+    CHECK_HIPBLAS_ERROR(hipblasPointerArrayDestroy(nullptr));
+#endif
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_batched_ex_pointer_array(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                lda         = arg.lda;
+    int                ldb         = arg.ldb;
+    int                ldc         = arg.ldc;
+    int                batch_count = arg.batch_count;
+
+    hipDataType          a_type       = arg.a_type;
+    hipDataType          b_type       = arg.b_type;
+    hipDataType          c_type       = arg.c_type;
+    hipblasComputeType_t compute_type = arg.compute_type_gemm;
+    hipblasGemmAlgo_t    algo         = HIPBLAS_GEMM_DEFAULT;
+
+    Tex h_alpha = arg.get_alpha<Tex>();
+    Tex h_beta  = arg.get_beta<Tex>();
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    hipblasLocalHandle handle(arg);
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M
+                        || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+        return;
+
+    // the matrices are stored as strided batches, and the pointer arrays point into them
+    hipblasStride stride_A = hipblasStride(lda) * A_col;
+    hipblasStride stride_B = hipblasStride(ldb) * B_col;
+    hipblasStride stride_C = hipblasStride(ldc) * N;
+
+    host_strided_batch_matrix<Ti> hA(A_row, A_col, lda, stride_A, batch_count);
+    host_strided_batch_matrix<Ti> hB(B_row, B_col, ldb, stride_B, batch_count);
+    host_strided_batch_matrix<To> hC(M, N, ldc, stride_C, batch_count);
+    host_strided_batch_matrix<To> hC_device(M, N, ldc, stride_C, batch_count);
+    host_strided_batch_matrix<To> hC_gold(M, N, ldc, stride_C, batch_count);
+
+    device_strided_batch_matrix<Ti> dA(A_row, A_col, lda, stride_A, batch_count);
+    device_strided_batch_matrix<Ti> dB(B_row, B_col, ldb, stride_B, batch_count);
+    device_strided_batch_matrix<To> dC(M, N, ldc, stride_C, batch_count);
+    device_strided_batch_matrix<To> dC_other(M, N, ldc, stride_C, batch_count);
+    device_vector<int64_t>          d_offsets(batch_count);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC_other.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_offsets.memcheck());
+
+    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(
+        hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+    hipblas_init_matrix(hC, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    hC_gold.copy_from(hC);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(int b = 0; b < batch_count; b++)
+    {
+        ref_gemm<Ti, To, Tex>(transA,
+                              transB,
+                              M,
+                              N,
+                              K,
+                              h_alpha,
+                              hA[b],
+                              lda,
+                              hB[b],
+                              ldb,
+                              h_beta,
+                              hC_gold[b],
+                              ldc);
+    }
+
+    hipblasPointerArray_t A_array, B_array, C_array;
+    CHECK_HIPBLAS_ERROR(hipblasPointerArrayCreate(&A_array, batch_count));
+    CHECK_HIPBLAS_ERROR(hipblasPointerArrayCreate(&B_array, batch_count));
+    CHECK_HIPBLAS_ERROR(hipblasPointerArrayCreate(&C_array, batch_count));
+
+    void** dA_array;
+    void** dB_array;
+    void** dC_array;
+    CHECK_HIPBLAS_ERROR(hipblasPointerArrayGetDevicePointer(A_array, &dA_array));
+    CHECK_HIPBLAS_ERROR(hipblasPointerArrayGetDevicePointer(B_array, &dB_array));
+    CHECK_HIPBLAS_ERROR(hipblasPointerArrayGetDevicePointer(C_array, &dC_array));
+
+    std::vector<void*> A_ptr(batch_count), B_ptr(batch_count), C_ptr(batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        A_ptr[b] = dA[b];
+        B_ptr[b] = dB[b];
+        C_ptr[b] = dC_other[b];
+    }
+    CHECK_HIPBLAS_ERROR(hipblasPointerArraySet(handle, A_array, 0, batch_count, A_ptr.data()));
+    CHECK_HIPBLAS_ERROR(hipblasPointerArraySet(handle, B_array, 0, batch_count, B_ptr.data()));
+    CHECK_HIPBLAS_ERROR(hipblasPointerArraySet(handle, C_array, 0, batch_count, C_ptr.data()));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    auto gemm = [&]() {
+        return hipblasGemmBatchedEx(handle,
+                                    transA,
+                                    transB,
+                                    M,
+                                    N,
+                                    K,
+                                    &h_alpha,
+                                    (const void**)dA_array,
+                                    a_type,
+                                    lda,
+                                    (const void**)dB_array,
+                                    b_type,
+                                    ldb,
+                                    &h_beta,
+                                    dC_array,
+                                    c_type,
+                                    ldc,
+                                    batch_count,
+                                    compute_type,
+                                    algo);
+    };
+
+    // C set from the host in a few steps: all pointers, then the first half moved to dC, which
+    // only writes the changed pointers, then all again, which writes the rest
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    for(int b = 0; b < batch_count; b++)
+        C_ptr[b] = dC[b];
+    CHECK_HIPBLAS_ERROR(
+        hipblasPointerArraySet(handle, C_array, 0, batch_count / 2, C_ptr.data()));
+    CHECK_HIPBLAS_ERROR(hipblasPointerArraySet(handle, C_array, 0, batch_count, C_ptr.data()));
+
+    std::vector<void*> C_ptr_device(batch_count);
+    CHECK_HIP_ERROR(hipMemcpy(
+        C_ptr_device.data(), dC_array, batch_count * sizeof(void*), hipMemcpyDeviceToHost));
+    EXPECT_EQ(C_ptr_device, C_ptr);
+
+    CHECK_HIPBLAS_ERROR(gemm());
+    CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+    unit_check_general<To>(M, N, batch_count, ldc, stride_C, hC_gold, hC_device);
+
+    // C computed on the device from the offsets of the matrices in dC_other
+    std::vector<int64_t> h_offsets(batch_count);
+    for(int b = 0; b < batch_count; b++)
+        h_offsets[b] = b * stride_C * int64_t(sizeof(To));
+    CHECK_HIP_ERROR(hipMemcpy(
+        d_offsets, h_offsets.data(), batch_count * sizeof(int64_t), hipMemcpyHostToDevice));
+
+    CHECK_HIP_ERROR(dC_other.transfer_from(hC));
+    CHECK_HIPBLAS_ERROR(hipblasPointerArraySetOffsets(handle, C_array, dC_other[0], d_offsets));
+
+    CHECK_HIPBLAS_ERROR(gemm());
+    CHECK_HIP_ERROR(hC_device.transfer_from(dC_other));
+    unit_check_general<To>(M, N, batch_count, ldc, stride_C, hC_gold, hC_device);
+
+    // the pointers into dC are those set last from the host, but the offsets replaced them on
+    // the device, so setting them again must write them all
+    CHECK_HIPBLAS_ERROR(hipblasPointerArraySet(handle, C_array, 0, batch_count, C_ptr.data()));
+    CHECK_HIP_ERROR(hipMemcpy(
+        C_ptr_device.data(), dC_array, batch_count * sizeof(void*), hipMemcpyDeviceToHost));
+    EXPECT_EQ(C_ptr_device, C_ptr);
+
+    CHECK_HIPBLAS_ERROR(hipblasPointerArrayDestroy(A_array));
+    CHECK_HIPBLAS_ERROR(hipblasPointerArrayDestroy(B_array));
+    CHECK_HIPBLAS_ERROR(hipblasPointerArrayDestroy(C_array));
+#endif
+}
@@ -0,0 +1,260 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_common.hpp"
+#include <complex>
+
+/* ============================================================================================ */
+
+using hipblasGemmComplexHalfExModel = ArgumentModel<e_a_type,
+                                                    e_c_type,
+                                                    e_transA,
+                                                    e_transB,
+                                                    e_M,
+                                                    e_N,
+                                                    e_K,
+                                                    e_alpha,
+                                                    e_lda,
+                                                    e_ldb,
+                                                    e_beta,
+                                                    e_ldc>;
+
+inline void testname_gemm_complex_half_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmComplexHalfExModel{}.test_name(arg, name);
+}
+
+using hipblasGemmStridedBatchedComplexHalfExModel = ArgumentModel<e_a_type,
+                                                                  e_c_type,
+                                                                  e_transA,
+                                                                  e_transB,
+                                                                  e_M,
+                                                                  e_N,
+                                                                  e_K,
+                                                                  e_alpha,
+                                                                  e_lda,
+                                                                  e_ldb,
+                                                                  e_beta,
+                                                                  e_ldc,
+                                                                  e_batch_count>;
+
+inline void testname_gemm_strided_batched_complex_half_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmStridedBatchedComplexHalfExModel{}.test_name(arg, name);
+}
+
+// The gemmEx of complex Th matrices, with a C of complex To, Th or float, by hipblasGemmEx, or by
+// hipblasGemmStridedBatchedEx of arg.batch_count problems when batched. The real and imaginary
+// parts are held interleaved in host_vector<Th> and host_vector<To>.
+template <typename Th, typename To>
+void testing_gemm_complex_half_ex_batch(const Arguments& arg, bool batched)
+{
+#ifdef HIPBLAS_V2
+    using Tc                   = std::complex<float>;
+    constexpr bool is_half     = std::is_same_v<Th, hipblasHalf>;
+    hipDataType    ab_type     = is_half ? HIP_C_16F : HIP_C_16BF;
+    hipDataType    c_type      = std::is_same_v<To, float> ? HIP_C_32F : ab_type;
+    int            batch_count = batched ? arg.batch_count : 1;
+
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+    int                ldc    = arg.ldc;
+    Tc                 alpha(arg.alpha, arg.alphai);
+    Tc                 beta(arg.beta, arg.betai);
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    hipblasLocalHandle handle(arg);
+
+    size_t size_A = size_t(lda) * A_col, size_B = size_t(ldb) * B_col;
+    size_t size_C = size_t(ldc) * N;
+
+    auto gemm = [&](const void* alpha_ptr,
+                    const void* A,
+                    const void* B,
+                    const void* beta_ptr,
+                    void*       C,
+                    int         count) {
+        if(!batched)
+            return hipblasGemmEx(handle,
+                                 transA,
+                                 transB,
+                                 M,
+                                 N,
+                                 K,
+                                 alpha_ptr,
+                                 A,
+                                 ab_type,
+                                 lda,
+                                 B,
+                                 ab_type,
+                                 ldb,
+                                 beta_ptr,
+                                 C,
+                                 c_type,
+                                 ldc,
+                                 HIPBLAS_COMPUTE_32F,
+                                 HIPBLAS_GEMM_DEFAULT);
+        return hipblasGemmStridedBatchedEx(handle,
+                                           transA,
+                                           transB,
+                                           M,
+                                           N,
+                                           K,
+                                           alpha_ptr,
+                                           A,
+                                           ab_type,
+                                           lda,
+                                           size_A,
+                                           B,
+                                           ab_type,
+                                           ldb,
+                                           size_B,
+                                           beta_ptr,
+                                           C,
+                                           c_type,
+                                           ldc,
+                                           size_C,
+                                           count,
+                                           HIPBLAS_COMPUTE_32F,
+                                           HIPBLAS_GEMM_DEFAULT);
+    };
+
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < std::max(A_row, 1)
+                        || ldb < std::max(B_row, 1) || ldc < std::max(M, 1) || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        EXPECT_HIPBLAS_STATUS(gemm(nullptr, nullptr, nullptr, nullptr, nullptr, batch_count),
+                              invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                           : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    // small integers, which Th holds exactly, so the products and the sums of the 3M algorithm
+    // are exact, and C is only rounded when it is stored
+    host_vector<Th> hA(2 * size_A * batch_count), hB(2 * size_B * batch_count);
+    host_vector<To> hC(2 * size_C * batch_count), hC_device(2 * size_C * batch_count);
+    for(size_t i = 0; i < hA.size() / 2; i++)
+    {
+        hA[2 * i]     = ref_gemv_ex_from_float<Th>(float(i % 7) - 3);
+        hA[2 * i + 1] = ref_gemv_ex_from_float<Th>(float(i % 5) - 2);
+    }
+    for(size_t i = 0; i < hB.size() / 2; i++)
+    {
+        hB[2 * i]     = ref_gemv_ex_from_float<Th>(float(i % 5) - 2);
+        hB[2 * i + 1] = ref_gemv_ex_from_float<Th>(float(i % 3) - 1);
+    }
+    for(size_t i = 0; i < hC.size() / 2; i++)
+    {
+        hC[2 * i]     = ref_gemv_ex_from_float<To>(float(i % 3));
+        hC[2 * i + 1] = ref_gemv_ex_from_float<To>(float(i % 4) - 2);
+    }
+
+    // the float reference, rounded to To as the device rounds it
+    auto op = [](hipblasOperation_t trans, const Th* X, int ldx, int i, int j) {
+        size_t x  = trans == HIPBLAS_OP_N ? i + size_t(j) * ldx : j + size_t(i) * ldx;
+        float  xr = ref_gemv_ex_to_float(X[2 * x]), xi = ref_gemv_ex_to_float(X[2 * x + 1]);
+        return Tc(xr, trans == HIPBLAS_OP_C ? -xi : xi);
+    };
+    host_vector<float> hC_gold(2 * size_C * batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        const Th* A = hA.data() + 2 * size_A * b;
+        const Th* B = hB.data() + 2 * size_B * b;
+        for(int j = 0; j < N; j++)
+        {
+            for(int i = 0; i < M; i++)
+            {
+                Tc w = 0;
+                for(int l = 0; l < K; l++)
+                    w += op(transA, A, lda, i, l) * op(transB, B, ldb, l, j);
+                size_t c = 2 * (size_C * b + i + size_t(j) * ldc);
+                Tc     r = alpha * w
+                       + beta * Tc(ref_gemv_ex_to_float(hC[c]), ref_gemv_ex_to_float(hC[c + 1]));
+                hC_gold[c]     = ref_gemv_ex_to_float(ref_gemv_ex_from_float<To>(r.real()));
+                hC_gold[c + 1] = ref_gemv_ex_to_float(ref_gemv_ex_from_float<To>(r.imag()));
+            }
+        }
+    }
+
+    device_vector<Th> dA(hA.size()), dB(hB.size());
+    device_vector<To> dC(hC.size());
+    device_vector<Tc> d_alpha(1), d_beta(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(Tc), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(Tc), hipMemcpyHostToDevice));
+
+    // the four real products and the 3M algorithm, in both pointer modes
+    for(hipblasMath_t math : {HIPBLAS_DEFAULT_MATH, HIPBLAS_GEMM_3M_MATH})
+    {
+        for(hipblasPointerMode_t mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
+        {
+            bool device_mode = mode == HIPBLAS_POINTER_MODE_DEVICE;
+            CHECK_HIP_ERROR(dC.transfer_from(hC));
+            CHECK_HIPBLAS_ERROR(hipblasSetMathMode(handle, math));
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, mode));
+            CHECK_HIPBLAS_ERROR(gemm(device_mode ? (Tc*)d_alpha : &alpha,
+                                     dA,
+                                     dB,
+                                     device_mode ? (Tc*)d_beta : &beta,
+                                     dC,
+                                     batch_count));
+
+            CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+            for(int b = 0; b < batch_count; b++)
+                for(int j = 0; j < N; j++)
+                    for(int i = 0; i < M; i++)
+                    {
+                        size_t c = 2 * (size_C * b + i + size_t(j) * ldc);
+                        EXPECT_EQ(ref_gemv_ex_to_float(hC_device[c]), hC_gold[c]);
+                        EXPECT_EQ(ref_gemv_ex_to_float(hC_device[c + 1]), hC_gold[c + 1]);
+                    }
+        }
+    }
+    CHECK_HIPBLAS_ERROR(hipblasSetMathMode(handle, HIPBLAS_DEFAULT_MATH));
+#endif
+}
+
+template <typename Th, typename To>
+void testing_gemm_complex_half_ex(const Arguments& arg)
+{
+    testing_gemm_complex_half_ex_batch<Th, To>(arg, false);
+}
+
+template <typename Th, typename To>
+void testing_gemm_strided_batched_complex_half_ex(const Arguments& arg)
+{
+    testing_gemm_complex_half_ex_batch<Th, To>(arg, true);
+}
@@ -161,6 +161,19 @@ void testing_gemm_ex_bad_arg(const Arguments& arg)
 
         if(arg.bad_arg_all)
         {
+            // invalid flags are rejected before the gemm runs, which would set C to 0
+            size_t C_bytes = size_t(ldc) * N * sizeof(To);
+            CHECK_HIP_ERROR(hipMemset(dC, 1, C_bytes));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM, hipblasGemmExFn, (handle, transA, transB, M, N, K, zero,
+                                            dA, aType, lda,
+                                            dB, bType, ldb, zero,
+                                            dC, cType, ldc,
+                                            computeType,
+                                            algo, (hipblasGemmFlags_t)0x40));
+            std::vector<unsigned char> hC(C_bytes);
+            CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, C_bytes, hipMemcpyDeviceToHost));
+            EXPECT_EQ(size_t(std::count(hC.begin(), hC.end(), 1)), C_bytes);
+
             DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
                 hipblasGemmExFn, (
                     handle, transA, transB, M, N, K, alpha,
@@ -320,6 +333,11 @@ void testing_gemm_ex(const Arguments& arg)
 #endif
     hipblasGemmFlags_t flags = hipblasGemmFlags_t(arg.flags);
 
+#ifdef HIPBLAS_V2
+    // A non-zero solution_index runs a specific solution from hipblasGemmExGetSolutions
+    bool use_solution = arg.solution_index && arg.api == hipblas_client_api::C;
+#endif
+
     Tex h_alpha_Tex = arg.get_alpha<Tex>();
     Tex h_beta_Tex  = arg.get_beta<Tex>();
 
@@ -380,10 +398,10 @@ void testing_gemm_ex(const Arguments& arg)
     double gpu_time_used, hipblas_error_host, hipblas_error_device;
 
     // Initial Data on CPU
-    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(hA, arg, 'A', hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
     hipblas_init_matrix(
-        hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
-    hipblas_init_matrix(hC_host, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+        hB, arg, 'B', hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+    hipblas_init_matrix(hC_host, arg, 'C', hipblas_client_beta_sets_nan, hipblas_general_matrix);
 
     hC_gold = hC_device = hC_host;
 
@@ -397,8 +415,51 @@ void testing_gemm_ex(const Arguments& arg)
 
     if(unit_check || norm_check)
     {
+        // reference BLAS, concurrently with the hipBLAS calls
+        hipblas_host_reference reference([&] {
+            ref_gemm<Ti, To, Tex>(transA,
+                                  transB,
+                                  M,
+                                  N,
+                                  K,
+                                  h_alpha_Tex,
+                                  hA.data(),
+                                  lda,
+                                  hB.data(),
+                                  ldb,
+                                  h_beta_Tex,
+                                  hC_gold.data(),
+                                  ldc);
+        });
+
         // hipBLAS
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+#ifdef HIPBLAS_V2
+        if(use_solution)
+        {
+            CHECK_HIPBLAS_ERROR(hipblasGemmExWithSolution(handle,
+                                                          transA,
+                                                          transB,
+                                                          M,
+                                                          N,
+                                                          K,
+                                                          &h_alpha_Tex,
+                                                          dA,
+                                                          a_type,
+                                                          lda,
+                                                          dB,
+                                                          b_type,
+                                                          ldb,
+                                                          &h_beta_Tex,
+                                                          dC,
+                                                          c_type,
+                                                          ldc,
+                                                          compute_type,
+                                                          flags,
+                                                          arg.solution_index));
+        }
+        else
+#endif
         if(!arg.with_flags)
         {
             DAPI_CHECK(hipblasGemmExFn,
@@ -451,6 +512,32 @@ void testing_gemm_ex(const Arguments& arg)
         CHECK_HIP_ERROR(dC.transfer_from(hC_device));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+#ifdef HIPBLAS_V2
+        if(use_solution)
+        {
+            CHECK_HIPBLAS_ERROR(hipblasGemmExWithSolution(handle,
+                                                          transA,
+                                                          transB,
+                                                          M,
+                                                          N,
+                                                          K,
+                                                          d_alpha,
+                                                          dA,
+                                                          a_type,
+                                                          lda,
+                                                          dB,
+                                                          b_type,
+                                                          ldb,
+                                                          d_beta,
+                                                          dC,
+                                                          c_type,
+                                                          ldc,
+                                                          compute_type,
+                                                          flags,
+                                                          arg.solution_index));
+        }
+        else
+#endif
         if(!arg.with_flags)
         {
             DAPI_CHECK(hipblasGemmExFn,
@@ -501,20 +588,7 @@ void testing_gemm_ex(const Arguments& arg)
 
         CHECK_HIP_ERROR(hC_device.transfer_from(dC));
 
-        // reference BLAS
-        ref_gemm<Ti, To, Tex>(transA,
-                              transB,
-                              M,
-                              N,
-                              K,
-                              h_alpha_Tex,
-                              hA.data(),
-                              lda,
-                              hB.data(),
-                              ldb,
-                              h_beta_Tex,
-                              hC_gold.data(),
-                              ldc);
+        reference.wait();
 
         if(unit_check)
         {
@@ -549,12 +623,40 @@ void testing_gemm_ex(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
+        hipblas_iteration_timer  timer(arg, stream);
+        hipblas_rotating_buffers rotating(arg, dA, dB, dC);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
+#ifdef HIPBLAS_V2
+            if(use_solution)
+            {
+                hipblasGemmExWithSolution(handle,
+                                          transA,
+                                          transB,
+                                          M,
+                                          N,
+                                          K,
+                                          &h_alpha_Tex,
+                                          rotating(dA, iter),
+                                          a_type,
+                                          lda,
+                                          rotating(dB, iter),
+                                          b_type,
+                                          ldb,
+                                          &h_beta_Tex,
+                                          rotating(dC, iter),
+                                          c_type,
+                                          ldc,
+                                          compute_type,
+                                          flags,
+                                          arg.solution_index);
+            }
+            else
+#endif
             if(!arg.with_flags)
             {
                 DAPI_DISPATCH(hipblasGemmExFn,
@@ -565,14 +667,14 @@ void testing_gemm_ex(const Arguments& arg)
                                N,
                                K,
                                &h_alpha_Tex,
-                               dA,
+                               rotating(dA, iter),
                                a_type,
                                lda,
-                               dB,
+                               rotating(dB, iter),
                                b_type,
                                ldb,
                                &h_beta_Tex,
-                               dC,
+                               rotating(dC, iter),
                                c_type,
                                ldc,
                                compute_type,
@@ -588,22 +690,24 @@ void testing_gemm_ex(const Arguments& arg)
                                N,
                                K,
                                &h_alpha_Tex,
-                               dA,
+                               rotating(dA, iter),
                                a_type,
                                lda,
-                               dB,
+                               rotating(dB, iter),
                                b_type,
                                ldb,
                                &h_beta_Tex,
-                               dC,
+                               rotating(dC, iter),
                                c_type,
                                ldc,
                                compute_type,
                                algo,
                                flags));
             }
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasGemmExModel{}.log_args<To>(std::cout,
                                           arg,
@@ -0,0 +1,233 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmExEmulatedModel = ArgumentModel<e_a_type,
+                                                 e_transA,
+                                                 e_transB,
+                                                 e_M,
+                                                 e_N,
+                                                 e_K,
+                                                 e_alpha,
+                                                 e_lda,
+                                                 e_ldb,
+                                                 e_beta,
+                                                 e_ldc>;
+
+inline void testname_gemm_ex_emulated(const Arguments& arg, std::string& name)
+{
+    hipblasGemmExEmulatedModel{}.test_name(arg, name);
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_ex_emulated_bad_arg(const Arguments& arg)
+{
+    if constexpr(std::is_same_v<Ti, double> && std::is_same_v<To, double>)
+    {
+        hipblasLocalHandle handle(arg);
+
+        int    M = 101, N = 100, K = 102, lda = 103, ldb = 104, ldc = 105, slices = 8;
+        double alpha = 1, beta = 0;
+
+        hipblasOperation_t transA = HIPBLAS_OP_N;
+        hipblasOperation_t transB = HIPBLAS_OP_N;
+
+        device_matrix<double> dA(M, K, lda);
+        device_matrix<double> dB(K, N, ldb);
+        device_matrix<double> dC(M, N, ldc);
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        // clang-format off
+
+        EXPECT_HIPBLAS_STATUS(hipblasDgemmEmulated(nullptr, transA, transB, M, N, K, &alpha, dA,
+                                                   lda, dB, ldb, &beta, dC, ldc, slices),
+                              HIPBLAS_STATUS_NOT_INITIALIZED);
+
+        EXPECT_HIPBLAS_STATUS(hipblasDgemmEmulated(handle, transA, hipblasOperation_t(0), M, N, K,
+                                                   &alpha, dA, lda, dB, ldb, &beta, dC, ldc,
+                                                   slices),
+                              HIPBLAS_STATUS_INVALID_ENUM);
+
+        EXPECT_HIPBLAS_STATUS(hipblasDgemmEmulated(handle, transA, transB, M, N, K, &alpha, dA,
+                                                   M - 1, dB, ldb, &beta, dC, ldc, slices),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+        EXPECT_HIPBLAS_STATUS(hipblasDgemmEmulated(handle, transA, transB, M, N, K, &alpha, dA,
+                                                   lda, dB, ldb, &beta, dC, M - 1, slices),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+        for(int bad_slices : {0, 9})
+            EXPECT_HIPBLAS_STATUS(hipblasDgemmEmulated(handle, transA, transB, M, N, K, &alpha, dA,
+                                                       lda, dB, ldb, &beta, dC, ldc, bad_slices),
+                                  HIPBLAS_STATUS_INVALID_VALUE);
+
+        EXPECT_HIPBLAS_STATUS(hipblasDgemmEmulated(handle, transA, transB, M, N, K, nullptr, dA,
+                                                   lda, dB, ldb, &beta, dC, ldc, slices),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+        EXPECT_HIPBLAS_STATUS(hipblasDgemmEmulated(handle, transA, transB, M, N, K, &alpha,
+                                                   nullptr, lda, dB, ldb, &beta, dC, ldc, slices),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+        // With M == 0, can have all nullptrs
+        CHECK_HIPBLAS_ERROR(hipblasDgemmEmulated(handle, transA, transB, 0, N, K, nullptr,
+                                                 nullptr, lda, nullptr, ldb, nullptr, nullptr,
+                                                 ldc, slices));
+
+        // clang-format on
+    }
+}
+
+// The elements of each row of op(A) and column of op(B) are kept to 7 bits per slice relative
+// to their largest magnitude, which is about 1 for the trigonometric test data, and the
+// omitted products of slices are below that. The bounds are for sums of K such errors.
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_ex_emulated(const Arguments& arg)
+{
+    if constexpr(std::is_same_v<Ti, double> && std::is_same_v<To, double>)
+    {
+        hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+        hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+        int                M      = arg.M;
+        int                N      = arg.N;
+        int                K      = arg.K;
+        int                lda    = arg.lda;
+        int                ldb    = arg.ldb;
+        int                ldc    = arg.ldc;
+
+        double h_alpha = arg.get_alpha<double>();
+        double h_beta  = arg.get_beta<double>();
+
+        int A_row = transA == HIPBLAS_OP_N ? M : K;
+        int A_col = transA == HIPBLAS_OP_N ? K : M;
+        int B_row = transB == HIPBLAS_OP_N ? K : N;
+        int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+        hipblasLocalHandle handle(arg);
+
+        bool invalid_size = M < 0 || N < 0 || K < 0 || lda < std::max(A_row, 1)
+                            || ldb < std::max(B_row, 1) || ldc < std::max(M, 1);
+        if(invalid_size || !M || !N)
+        {
+            EXPECT_HIPBLAS_STATUS(hipblasDgemmEmulated(handle,
+                                                       transA,
+                                                       transB,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       nullptr,
+                                                       nullptr,
+                                                       lda,
+                                                       nullptr,
+                                                       ldb,
+                                                       nullptr,
+                                                       nullptr,
+                                                       ldc,
+                                                       8),
+                                  invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                               : HIPBLAS_STATUS_SUCCESS);
+            return;
+        }
+
+        host_matrix<double> hA(A_row, A_col, lda);
+        host_matrix<double> hB(B_row, B_col, ldb);
+        host_matrix<double> hC(M, N, ldc);
+        host_matrix<double> hC_gold(M, N, ldc);
+        host_matrix<double> hC_device(M, N, ldc);
+
+        device_matrix<double> dA(A_row, A_col, lda);
+        device_matrix<double> dB(B_row, B_col, ldb);
+        device_matrix<double> dC(M, N, ldc);
+        device_vector<double> d_alpha(1);
+        device_vector<double> d_beta(1);
+
+        CHECK_DEVICE_ALLOCATION(dA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dB.memcheck());
+        CHECK_DEVICE_ALLOCATION(dC.memcheck());
+        CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+        CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+        hipblas_init_matrix_trig<double>(hipblas_general_matrix, 'F', hA, false);
+        hipblas_init_matrix_trig<double>(hipblas_general_matrix, 'F', hB, true);
+        hipblas_init_matrix_trig<double>(hipblas_general_matrix, 'F', hC, false);
+        hC_gold = hC;
+
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(double), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(double), hipMemcpyHostToDevice));
+
+        ref_gemm<double>(transA,
+                         transB,
+                         M,
+                         N,
+                         K,
+                         h_alpha,
+                         hA.data(),
+                         lda,
+                         hB.data(),
+                         ldb,
+                         h_beta,
+                         hC_gold.data(),
+                         ldc);
+
+        // 8 slices with scalars on the host, 4 with scalars on the device
+        for(int slices : {8, 4})
+        {
+            bool device_scalars = slices == 4;
+            CHECK_HIP_ERROR(dC.transfer_from(hC));
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(
+                handle, device_scalars ? HIPBLAS_POINTER_MODE_DEVICE : HIPBLAS_POINTER_MODE_HOST));
+            CHECK_HIPBLAS_ERROR(hipblasDgemmEmulated(handle,
+                                                     transA,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     device_scalars ? d_alpha : &h_alpha,
+                                                     dA,
+                                                     lda,
+                                                     dB,
+                                                     ldb,
+                                                     device_scalars ? d_beta : &h_beta,
+                                                     dC,
+                                                     ldc,
+                                                     slices));
+
+            hipblasPointerMode_t mode_after;
+            CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(handle, &mode_after));
+            EXPECT_EQ(mode_after,
+                      device_scalars ? HIPBLAS_POINTER_MODE_DEVICE : HIPBLAS_POINTER_MODE_HOST);
+
+            CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+            double slice_error = std::ldexp(double(slices + 2), -7 * slices);
+            double tol         = std::abs(h_alpha) * (K + 1)
+                         * (slice_error + 4 * std::numeric_limits<double>::epsilon());
+            near_check_general<double>(M, N, ldc, hC_gold.data(), hC_device.data(), tol);
+        }
+    }
+}
@@ -0,0 +1,288 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "utility.h"
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <typeinfo>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmExGetSolutionsModel = ArgumentModel<e_a_type,
+                                                     e_c_type,
+                                                     e_compute_type,
+                                                     e_transA,
+                                                     e_transB,
+                                                     e_M,
+                                                     e_N,
+                                                     e_K,
+                                                     e_alpha,
+                                                     e_lda,
+                                                     e_ldb,
+                                                     e_beta,
+                                                     e_ldc,
+                                                     e_flags>;
+
+inline void testname_gemm_ex_get_solutions(const Arguments& arg, std::string& name)
+{
+    hipblasGemmExGetSolutionsModel{}.test_name(arg, name);
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_ex_get_solutions_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType          aType       = arg.a_type;
+    hipDataType          bType       = arg.b_type;
+    hipDataType          cType       = arg.c_type;
+    hipblasComputeType_t computeType = arg.compute_type_gemm;
+    hipblasGemmFlags_t   flags       = HIPBLAS_GEMM_FLAGS_NONE;
+
+    int M   = 101;
+    int N   = 100;
+    int K   = 102;
+    int lda = 103;
+    int ldb = 104;
+    int ldc = 105;
+
+    hipblasOperation_t transA = HIPBLAS_OP_N;
+    hipblasOperation_t transB = HIPBLAS_OP_N;
+
+    device_matrix<Ti> dA(M, K, lda);
+    device_matrix<Ti> dB(K, N, ldb);
+    device_matrix<To> dC(M, N, ldc);
+
+    Tex h_alpha(1), h_beta(2);
+    int count = 0;
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExGetSolutions(nullptr, transA, transB, M, N, K, &h_alpha,
+                                                    dA, aType, lda, dB, bType, ldb, &h_beta,
+                                                    dC, cType, ldc, computeType, flags,
+                                                    nullptr, &count),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExGetSolutions(handle, transA, transB, M, N, K, &h_alpha,
+                                                    dA, aType, lda, dB, bType, ldb, &h_beta,
+                                                    dC, cType, ldc, computeType, flags,
+                                                    nullptr, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExGetSolutions(handle,
+                                                    (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                                                    transB, M, N, K, &h_alpha,
+                                                    dA, aType, lda, dB, bType, ldb, &h_beta,
+                                                    dC, cType, ldc, computeType, flags,
+                                                    nullptr, &count),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExWithSolution(nullptr, transA, transB, M, N, K, &h_alpha,
+                                                    dA, aType, lda, dB, bType, ldb, &h_beta,
+                                                    dC, cType, ldc, computeType, flags, 0),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    // clang-format on
+#endif
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_ex_get_solutions(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+    int                ldc    = arg.ldc;
+
+    hipDataType          a_type       = arg.a_type;
+    hipDataType          b_type       = arg.b_type;
+    hipDataType          c_type       = arg.c_type;
+    hipblasComputeType_t compute_type = arg.compute_type_gemm;
+    hipblasGemmFlags_t   flags        = hipblasGemmFlags_t(arg.flags);
+
+    Tex h_alpha_Tex = arg.get_alpha<Tex>();
+    Tex h_beta_Tex  = arg.get_beta<Tex>();
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    hipblasLocalHandle handle(arg);
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M;
+    if(invalid_size || !M || !N)
+        return;
+
+    host_matrix<Ti> hA(A_row, A_col, lda);
+    host_matrix<Ti> hB(B_row, B_col, ldb);
+    host_matrix<To> hC(M, N, ldc);
+    host_matrix<To> hC_device(M, N, ldc);
+    host_matrix<To> hC_gold(M, N, ldc);
+
+    device_matrix<Ti> dA(A_row, A_col, lda);
+    device_matrix<Ti> dB(B_row, B_col, ldb);
+    device_matrix<To> dC(M, N, ldc);
+
+    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(
+        hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+    hipblas_init_matrix(hC, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+    hC_gold = hC;
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    ref_gemm<Ti, To, Tex>(transA,
+                          transB,
+                          M,
+                          N,
+                          K,
+                          h_alpha_Tex,
+                          hA.data(),
+                          lda,
+                          hB.data(),
+                          ldb,
+                          h_beta_Tex,
+                          hC_gold.data(),
+                          ldc);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    int count = 0;
+    CHECK_HIPBLAS_ERROR(hipblasGemmExGetSolutions(handle,
+                                                  transA,
+                                                  transB,
+                                                  M,
+                                                  N,
+                                                  K,
+                                                  &h_alpha_Tex,
+                                                  dA,
+                                                  a_type,
+                                                  lda,
+                                                  dB,
+                                                  b_type,
+                                                  ldb,
+                                                  &h_beta_Tex,
+                                                  dC,
+                                                  c_type,
+                                                  ldc,
+                                                  compute_type,
+                                                  flags,
+                                                  nullptr,
+                                                  &count));
+    ASSERT_GE(count, 1);
+
+    // a list shorter than the number of solutions is filled up to its size
+    int first = 0, first_count = 1;
+    CHECK_HIPBLAS_ERROR(hipblasGemmExGetSolutions(handle,
+                                                  transA,
+                                                  transB,
+                                                  M,
+                                                  N,
+                                                  K,
+                                                  &h_alpha_Tex,
+                                                  dA,
+                                                  a_type,
+                                                  lda,
+                                                  dB,
+                                                  b_type,
+                                                  ldb,
+                                                  &h_beta_Tex,
+                                                  dC,
+                                                  c_type,
+                                                  ldc,
+                                                  compute_type,
+                                                  flags,
+                                                  &first,
+                                                  &first_count));
+    EXPECT_EQ(first_count, 1);
+
+    std::vector<int> solutions(count);
+    CHECK_HIPBLAS_ERROR(hipblasGemmExGetSolutions(handle,
+                                                  transA,
+                                                  transB,
+                                                  M,
+                                                  N,
+                                                  K,
+                                                  &h_alpha_Tex,
+                                                  dA,
+                                                  a_type,
+                                                  lda,
+                                                  dB,
+                                                  b_type,
+                                                  ldb,
+                                                  &h_beta_Tex,
+                                                  dC,
+                                                  c_type,
+                                                  ldc,
+                                                  compute_type,
+                                                  flags,
+                                                  solutions.data(),
+                                                  &count));
+    ASSERT_GE(count, 1);
+    EXPECT_EQ(solutions[0], first);
+
+    // every reported solution must compute the same result
+    for(int i = 0; i < count; i++)
+    {
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        CHECK_HIPBLAS_ERROR(hipblasGemmExWithSolution(handle,
+                                                      transA,
+                                                      transB,
+                                                      M,
+                                                      N,
+                                                      K,
+                                                      &h_alpha_Tex,
+                                                      dA,
+                                                      a_type,
+                                                      lda,
+                                                      dB,
+                                                      b_type,
+                                                      ldb,
+                                                      &h_beta_Tex,
+                                                      dC,
+                                                      c_type,
+                                                      ldc,
+                                                      compute_type,
+                                                      flags,
+                                                      solutions[i]));
+        CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+
+        unit_check_general<To>(M, N, ldc, hC_gold, hC_device);
+    }
+#endif
+}
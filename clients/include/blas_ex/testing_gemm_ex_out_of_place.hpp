@@ -0,0 +1,294 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "utility.h"
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <typeinfo>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmExOutOfPlaceModel = ArgumentModel<e_a_type,
+                                                   e_c_type,
+                                                   e_compute_type,
+                                                   e_transA,
+                                                   e_transB,
+                                                   e_M,
+                                                   e_N,
+                                                   e_K,
+                                                   e_alpha,
+                                                   e_lda,
+                                                   e_ldb,
+                                                   e_beta,
+                                                   e_ldc,
+                                                   e_ldd,
+                                                   e_batch_count>;
+
+inline void testname_gemm_ex_out_of_place(const Arguments& arg, std::string& name)
+{
+    hipblasGemmExOutOfPlaceModel{}.test_name(arg, name);
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_ex_out_of_place_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType          aType       = arg.a_type;
+    hipDataType          bType       = arg.b_type;
+    hipDataType          cType       = arg.c_type;
+    hipblasComputeType_t computeType = arg.compute_type_gemm;
+    hipblasGemmAlgo_t    algo        = HIPBLAS_GEMM_DEFAULT;
+    hipblasGemmFlags_t   flags       = HIPBLAS_GEMM_FLAGS_NONE;
+
+    int M   = 101;
+    int N   = 100;
+    int K   = 102;
+    int lda = 103;
+    int ldb = 104;
+    int ldc = 105;
+    int ldd = 106;
+
+    hipblasOperation_t transA = HIPBLAS_OP_N;
+    hipblasOperation_t transB = HIPBLAS_OP_N;
+
+    device_matrix<Ti> dA(M, K, lda);
+    device_matrix<Ti> dB(K, N, ldb);
+    device_matrix<To> dC(M, N, ldc);
+    device_matrix<To> dD(M, N, ldd);
+
+    Tex h_alpha(1), h_beta(2);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExOutOfPlace(nullptr, transA, transB, M, N, K, &h_alpha,
+                                                  dA, aType, lda, dB, bType, ldb, &h_beta,
+                                                  dC, cType, ldc, dD, cType, ldd, computeType,
+                                                  algo, flags),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    // D has the type of C
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExOutOfPlace(handle, transA, transB, M, N, K, &h_alpha,
+                                                  dA, aType, lda, dB, bType, ldb, &h_beta,
+                                                  dC, cType, ldc, dD, HIP_R_8I, ldd, computeType,
+                                                  algo, flags),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExOutOfPlace(handle, transA, transB, M, N, K, &h_alpha,
+                                                  dA, aType, lda, dB, bType, ldb, &h_beta,
+                                                  dC, cType, ldc, dD, cType, M - 1, computeType,
+                                                  algo, flags),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // in place, D must have the layout of C
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExOutOfPlace(handle, transA, transB, M, N, K, &h_alpha,
+                                                  dA, aType, lda, dB, bType, ldb, &h_beta,
+                                                  dC, cType, ldc, dC, cType, ldd, computeType,
+                                                  algo, flags),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmStridedBatchedExOutOfPlace(handle, transA, transB, M, N, K,
+                                                                &h_alpha, dA, aType, lda, 0, dB,
+                                                                bType, ldb, 0, &h_beta, dC, cType,
+                                                                ldc, 0, dC, cType, ldc, ldc, 2,
+                                                                computeType, algo, flags),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // clang-format on
+#endif
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_ex_out_of_place(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                lda         = arg.lda;
+    int                ldb         = arg.ldb;
+    int                ldc         = arg.ldc;
+    int                ldd         = arg.ldd;
+    int                batch_count = arg.batch_count;
+
+    hipDataType          a_type       = arg.a_type;
+    hipDataType          b_type       = arg.b_type;
+    hipDataType          c_type       = arg.c_type;
+    hipblasComputeType_t compute_type = arg.compute_type_gemm;
+    hipblasGemmAlgo_t    algo         = HIPBLAS_GEMM_DEFAULT;
+    hipblasGemmFlags_t   flags        = hipblasGemmFlags_t(arg.flags);
+
+    Tex h_alpha_Tex = arg.get_alpha<Tex>();
+    Tex h_beta_Tex  = arg.get_beta<Tex>();
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    hipblasLocalHandle handle(arg);
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M
+                        || ldd < M || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+        return;
+
+    hipblasStride stride_A = hipblasStride(lda) * A_col;
+    hipblasStride stride_B = hipblasStride(ldb) * B_col;
+    hipblasStride stride_C = hipblasStride(ldc) * N;
+    hipblasStride stride_D = hipblasStride(ldd) * N;
+
+    host_strided_batch_matrix<Ti> hA(A_row, A_col, lda, stride_A, batch_count);
+    host_strided_batch_matrix<Ti> hB(B_row, B_col, ldb, stride_B, batch_count);
+    host_strided_batch_matrix<To> hC(M, N, ldc, stride_C, batch_count);
+    host_strided_batch_matrix<To> hC_device(M, N, ldc, stride_C, batch_count);
+    host_strided_batch_matrix<To> hD_host(M, N, ldd, stride_D, batch_count);
+    host_strided_batch_matrix<To> hD_device(M, N, ldd, stride_D, batch_count);
+    host_strided_batch_matrix<To> hD_gold(M, N, ldd, stride_D, batch_count);
+
+    device_strided_batch_matrix<Ti> dA(A_row, A_col, lda, stride_A, batch_count);
+    device_strided_batch_matrix<Ti> dB(B_row, B_col, ldb, stride_B, batch_count);
+    device_strided_batch_matrix<To> dC(M, N, ldc, stride_C, batch_count);
+    device_strided_batch_matrix<To> dD(M, N, ldd, stride_D, batch_count);
+    device_vector<Tex>              d_alpha(1);
+    device_vector<Tex>              d_beta(1);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+
+    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(
+        hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+    hipblas_init_matrix(hC, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha_Tex, sizeof(Tex), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta_Tex, sizeof(Tex), hipMemcpyHostToDevice));
+
+    // D = alpha * op(A) * op(B) + beta * C, computed in place on a copy of C with the layout of D
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(int b = 0; b < batch_count; b++)
+    {
+        for(int j = 0; j < N; j++)
+        {
+            for(int i = 0; i < M; i++)
+                hD_gold[b][i + j * size_t(ldd)] = hC[b][i + j * size_t(ldc)];
+        }
+        ref_gemm<Ti, To, Tex>(transA,
+                              transB,
+                              M,
+                              N,
+                              K,
+                              h_alpha_Tex,
+                              hA[b],
+                              lda,
+                              hB[b],
+                              ldb,
+                              h_beta_Tex,
+                              hD_gold[b],
+                              ldd);
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedExOutOfPlace(handle,
+                                                              transA,
+                                                              transB,
+                                                              M,
+                                                              N,
+                                                              K,
+                                                              &h_alpha_Tex,
+                                                              dA,
+                                                              a_type,
+                                                              lda,
+                                                              stride_A,
+                                                              dB,
+                                                              b_type,
+                                                              ldb,
+                                                              stride_B,
+                                                              &h_beta_Tex,
+                                                              dC,
+                                                              c_type,
+                                                              ldc,
+                                                              stride_C,
+                                                              dD,
+                                                              c_type,
+                                                              ldd,
+                                                              stride_D,
+                                                              batch_count,
+                                                              compute_type,
+                                                              algo,
+                                                              flags));
+    CHECK_HIP_ERROR(hD_host.transfer_from(dD));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(hipblasGemmExOutOfPlace(handle,
+                                                transA,
+                                                transB,
+                                                M,
+                                                N,
+                                                K,
+                                                d_alpha,
+                                                dA,
+                                                a_type,
+                                                lda,
+                                                dB,
+                                                b_type,
+                                                ldb,
+                                                d_beta,
+                                                dC,
+                                                c_type,
+                                                ldc,
+                                                dD,
+                                                c_type,
+                                                ldd,
+                                                compute_type,
+                                                algo,
+                                                flags));
+    CHECK_HIP_ERROR(hD_device.transfer_from(dD));
+
+    // C is only read
+    CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+    unit_check_general<To>(M, N, batch_count, ldc, stride_C, hC, hC_device);
+
+    unit_check_general<To>(M, N, batch_count, ldd, stride_D, hD_gold, hD_host);
+    unit_check_general<To>(M, N, ldd, hD_gold[0], hD_device[0]);
+#endif
+}
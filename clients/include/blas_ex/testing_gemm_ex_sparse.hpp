@@ -0,0 +1,297 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmExSparseModel = ArgumentModel<e_a_type,
+                                               e_c_type,
+                                               e_transB,
+                                               e_M,
+                                               e_N,
+                                               e_K,
+                                               e_alpha,
+                                               e_lda,
+                                               e_ldb,
+                                               e_beta,
+                                               e_ldc>;
+
+inline void testname_gemm_ex_sparse(const Arguments& arg, std::string& name)
+{
+    hipblasGemmExSparseModel{}.test_name(arg, name);
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_ex_sparse_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    if constexpr(std::is_same_v<Ti, float> && std::is_same_v<To, float>)
+    {
+        hipblasLocalHandle handle(arg);
+
+        int   M = 101, N = 100, K = 64, lda = 103, ldac = 102, ldm = 101, ldb = 104, ldc = 105;
+        float alpha = 1, beta = 0;
+
+        hipblasOperation_t   transB      = HIPBLAS_OP_N;
+        hipDataType          type        = HIP_R_32F;
+        hipblasComputeType_t computeType = HIPBLAS_COMPUTE_32F;
+
+        device_vector<float>   dA(size_t(lda) * K);
+        device_vector<float>   dAc(size_t(ldac) * K / 2);
+        device_vector<uint8_t> dMeta(size_t(ldm) * K / 4);
+        device_vector<float>   dB(size_t(ldb) * N);
+        device_vector<float>   dC(size_t(ldc) * N);
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        // clang-format off
+
+        EXPECT_HIPBLAS_STATUS(hipblasSparseCompress2of4(nullptr, M, K, dA, type, lda, dAc, ldac,
+                                                        dMeta, ldm),
+                              HIPBLAS_STATUS_NOT_INITIALIZED);
+        EXPECT_HIPBLAS_STATUS(hipblasSparseCompress2of4(handle, M, K, dA, HIP_R_64F, lda, dAc,
+                                                        ldac, dMeta, ldm),
+                              HIPBLAS_STATUS_NOT_SUPPORTED);
+        EXPECT_HIPBLAS_STATUS(hipblasSparseCompress2of4(handle, M, K - 2, dA, type, lda, dAc,
+                                                        ldac, dMeta, ldm),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasSparseCompress2of4(handle, M, K, dA, type, lda, dAc, ldac,
+                                                        dMeta, M - 1),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasSparseCompress2of4(handle, M, K, dA, type, lda, nullptr,
+                                                        ldac, dMeta, ldm),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+        EXPECT_HIPBLAS_STATUS(hipblasGemmExSparse(nullptr, transB, M, N, K, &alpha, dAc, type,
+                                                  ldac, dMeta, ldm, dB, type, ldb, &beta, dC,
+                                                  type, ldc, computeType),
+                              HIPBLAS_STATUS_NOT_INITIALIZED);
+        EXPECT_HIPBLAS_STATUS(hipblasGemmExSparse(handle, hipblasOperation_t(0), M, N, K, &alpha,
+                                                  dAc, type, ldac, dMeta, ldm, dB, type, ldb,
+                                                  &beta, dC, type, ldc, computeType),
+                              HIPBLAS_STATUS_INVALID_ENUM);
+        EXPECT_HIPBLAS_STATUS(hipblasGemmExSparse(handle, transB, M, N, K, &alpha, dAc, HIP_R_8I,
+                                                  ldac, dMeta, ldm, dB, type, ldb, &beta, dC,
+                                                  type, ldc, computeType),
+                              HIPBLAS_STATUS_NOT_SUPPORTED);
+        EXPECT_HIPBLAS_STATUS(hipblasGemmExSparse(handle, transB, M, N, K - 1, &alpha, dAc, type,
+                                                  ldac, dMeta, ldm, dB, type, ldb, &beta, dC,
+                                                  type, ldc, computeType),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasGemmExSparse(handle, transB, M, N, K, &alpha, dAc, type,
+                                                  ldac, dMeta, ldm, dB, type, K - 1, &beta, dC,
+                                                  type, ldc, computeType),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasGemmExSparse(handle, transB, M, N, K, &alpha, dAc, type,
+                                                  ldac, nullptr, ldm, dB, type, ldb, &beta, dC,
+                                                  type, ldc, computeType),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+        // With M == 0, can have all nullptrs
+        CHECK_HIPBLAS_ERROR(hipblasGemmExSparse(handle, transB, 0, N, K, nullptr, nullptr, type,
+                                                ldac, nullptr, ldm, nullptr, type, ldb, nullptr,
+                                                nullptr, type, ldc, computeType));
+
+        // clang-format on
+    }
+#endif
+}
+
+// The elements are small integers, so the products are exact in float and the results, rounded
+// once to To, compare exactly
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_ex_sparse(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    constexpr bool supported_a = std::is_same_v<Ti, float> || std::is_same_v<Ti, hipblasHalf>
+                                 || std::is_same_v<Ti, hipblasBfloat16>;
+    if constexpr(supported_a && std::is_same_v<Tex, float>)
+    {
+        hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+        int                M      = arg.M;
+        int                N      = arg.N;
+        int                K      = arg.K;
+        int                lda    = arg.lda;
+        int                ldb    = arg.ldb;
+        int                ldc    = arg.ldc;
+        hipDataType        aType  = arg.a_type;
+        hipDataType        bType  = arg.b_type;
+        hipDataType        cType  = arg.c_type;
+
+        Tex h_alpha = arg.get_alpha<Tex>();
+        Tex h_beta  = arg.get_beta<Tex>();
+
+        int B_row = transB == HIPBLAS_OP_N ? K : N;
+        int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+        hipblasLocalHandle handle(arg);
+
+        bool invalid_size = M < 0 || N < 0 || K < 0 || K % 4 || lda < std::max(M, 1)
+                            || ldb < std::max(B_row, 1) || ldc < std::max(M, 1);
+        if(invalid_size || !M || !N)
+        {
+            EXPECT_HIPBLAS_STATUS(hipblasGemmExSparse(handle,
+                                                      transB,
+                                                      M,
+                                                      N,
+                                                      K,
+                                                      nullptr,
+                                                      nullptr,
+                                                      aType,
+                                                      lda,
+                                                      nullptr,
+                                                      lda,
+                                                      nullptr,
+                                                      bType,
+                                                      ldb,
+                                                      nullptr,
+                                                      nullptr,
+                                                      cType,
+                                                      ldc,
+                                                      HIPBLAS_COMPUTE_32F),
+                                  invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                               : HIPBLAS_STATUS_SUCCESS);
+            return;
+        }
+
+        // Ac and metadata have the leading dimension of A
+        size_t size_A    = size_t(lda) * K;
+        size_t size_Ac   = size_t(lda) * K / 2;
+        size_t size_meta = size_t(lda) * K / 4;
+        size_t size_B    = size_t(ldb) * B_col;
+        size_t size_C    = size_t(ldc) * N;
+
+        host_vector<Ti>     hA(size_A);
+        host_vector<Ti>     hA_pruned(size_A);
+        host_vector<Ti>     hAc_gold(size_Ac);
+        host_vector<Ti>     hAc(size_Ac);
+        host_vector<int8_t> hMeta_gold(size_meta);
+        host_vector<int8_t> hMeta(size_meta);
+        host_vector<Ti>     hB(size_B);
+        host_vector<To>     hC(size_C);
+        host_vector<To>     hC_gold(size_C);
+        host_vector<To>     hC_device(size_C);
+
+        device_vector<Ti>     dA(size_A);
+        device_vector<Ti>     dAc(size_Ac);
+        device_vector<int8_t> dMeta(size_meta);
+        device_vector<Ti>     dB(size_B);
+        device_vector<To>     dC(size_C);
+
+        CHECK_DEVICE_ALLOCATION(dA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dAc.memcheck());
+        CHECK_DEVICE_ALLOCATION(dMeta.memcheck());
+        CHECK_DEVICE_ALLOCATION(dB.memcheck());
+        CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+        for(int p = 0; p < K; p++)
+            for(int i = 0; i < M; i++)
+                hA[i + size_t(p) * lda]
+                    = ref_gemv_ex_from_float<Ti>(float((i * 3 + p * 5) % 9 - 4));
+        for(int j = 0; j < B_col; j++)
+            for(int i = 0; i < B_row; i++)
+                hB[i + size_t(j) * ldb] = ref_gemv_ex_from_float<Ti>(float((i + 2 * j) % 7 - 3));
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < M; i++)
+                hC[i + size_t(j) * ldc] = ref_gemv_ex_from_float<To>(float((i + j) % 5 - 2));
+        hC_gold = hC;
+
+        // the two elements of largest magnitude of each group of 4, the first of equal ones
+        hA_pruned = hA;
+        for(int g = 0; g < K / 4; g++)
+        {
+            for(int i = 0; i < M; i++)
+            {
+                auto mag = [&](int q) {
+                    return std::abs(ref_gemv_ex_to_float(hA[i + size_t(4 * g + q) * lda]));
+                };
+                int first = 0;
+                for(int q = 1; q < 4; q++)
+                    if(mag(q) > mag(first))
+                        first = q;
+                int second = first == 0 ? 1 : 0;
+                for(int q = second + 1; q < 4; q++)
+                    if(q != first && mag(q) > mag(second))
+                        second = q;
+
+                int lo = std::min(first, second), hi = std::max(first, second);
+                for(int q = 0; q < 4; q++)
+                    if(q != lo && q != hi)
+                        hA_pruned[i + size_t(4 * g + q) * lda] = ref_gemv_ex_from_float<Ti>(0.0f);
+                hAc_gold[i + size_t(2 * g) * lda]     = hA[i + size_t(4 * g + lo) * lda];
+                hAc_gold[i + size_t(2 * g + 1) * lda] = hA[i + size_t(4 * g + hi) * lda];
+                hMeta_gold[i + size_t(g) * lda]       = int8_t(lo | hi << 2);
+            }
+        }
+
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+
+        ref_gemm<Ti, To, Tex>(HIPBLAS_OP_N,
+                              transB,
+                              M,
+                              N,
+                              K,
+                              h_alpha,
+                              hA_pruned.data(),
+                              lda,
+                              hB.data(),
+                              ldb,
+                              h_beta,
+                              hC_gold.data(),
+                              ldc);
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(
+            hipblasSparseCompress2of4(handle, M, K, dA, aType, lda, dAc, lda, dMeta, lda));
+        CHECK_HIPBLAS_ERROR(hipblasGemmExSparse(handle,
+                                                transB,
+                                                M,
+                                                N,
+                                                K,
+                                                &h_alpha,
+                                                dAc,
+                                                aType,
+                                                lda,
+                                                dMeta,
+                                                lda,
+                                                dB,
+                                                bType,
+                                                ldb,
+                                                &h_beta,
+                                                dC,
+                                                cType,
+                                                ldc,
+                                                HIPBLAS_COMPUTE_32F));
+
+        CHECK_HIP_ERROR(hAc.transfer_from(dAc));
+        CHECK_HIP_ERROR(hMeta.transfer_from(dMeta));
+        CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+        unit_check_general<Ti>(M, K / 2, lda, hAc_gold, hAc);
+        unit_check_general<int8_t>(M, K / 4, lda, hMeta_gold, hMeta);
+        unit_check_general<To>(M, N, ldc, hC_gold, hC_device);
+    }
+#endif
+}
@@ -0,0 +1,260 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmExWithDiagonalScalesModel = ArgumentModel<e_a_type,
+                                                           e_transA,
+                                                           e_transB,
+                                                           e_M,
+                                                           e_N,
+                                                           e_K,
+                                                           e_alpha,
+                                                           e_lda,
+                                                           e_ldb,
+                                                           e_beta,
+                                                           e_ldc>;
+
+inline void testname_gemm_ex_with_diagonal_scales(const Arguments& arg, std::string& name)
+{
+    hipblasGemmExWithDiagonalScalesModel{}.test_name(arg, name);
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_ex_with_diagonal_scales_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    int M = 101, N = 100, K = 102, lda = 103, ldb = 104, ldc = 105;
+
+    hipblasOperation_t   transA = HIPBLAS_OP_N;
+    hipblasOperation_t   transB = HIPBLAS_OP_N;
+    hipDataType          type   = HIP_R_32F;
+    hipblasComputeType_t ct     = HIPBLAS_COMPUTE_32F;
+    float                alpha = 1, beta = 0;
+
+    device_matrix<float> dA(M, K, lda);
+    device_matrix<float> dB(K, N, ldb);
+    device_matrix<float> dC(M, N, ldc);
+    device_vector<float> dRow(M), dCol(N);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExWithDiagonalScales(nullptr, transA, transB, M, N, K, &alpha,
+                                                          dA, type, lda, dB, type, ldb, &beta, dC,
+                                                          type, ldc, ct, dRow, dCol),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExWithDiagonalScales(handle, hipblasOperation_t(0), transB, M,
+                                                          N, K, &alpha, dA, type, lda, dB, type,
+                                                          ldb, &beta, dC, type, ldc, ct, dRow,
+                                                          dCol),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExWithDiagonalScales(handle, transA, transB, M, N, K, &alpha,
+                                                          dA, type, M - 1, dB, type, ldb, &beta,
+                                                          dC, type, ldc, ct, dRow, dCol),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExWithDiagonalScales(handle, transA, transB, M, N, K, &alpha,
+                                                          dA, type, lda, dB, type, ldb, &beta, dC,
+                                                          type, M - 1, ct, dRow, dCol),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExWithDiagonalScales(handle, transA, transB, M, N, K, nullptr,
+                                                          dA, type, lda, dB, type, ldb, &beta, dC,
+                                                          type, ldc, ct, dRow, dCol),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExWithDiagonalScales(handle, transA, transB, M, N, K, &alpha,
+                                                          nullptr, type, lda, dB, type, ldb, &beta,
+                                                          dC, type, ldc, ct, dRow, dCol),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // With M == 0, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasGemmExWithDiagonalScales(handle, transA, transB, 0, N, K, nullptr,
+                                                        nullptr, type, lda, nullptr, type, ldb,
+                                                        nullptr, nullptr, type, ldc, ct, nullptr,
+                                                        nullptr));
+
+    // clang-format on
+#endif
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_ex_with_diagonal_scales(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    if constexpr((std::is_same_v<Ti, float> || std::is_same_v<Ti, double>)
+                 && std::is_same_v<Ti, To> && std::is_same_v<To, Tex>)
+    {
+        constexpr bool       is_double = std::is_same_v<Ti, double>;
+        hipDataType          type      = is_double ? HIP_R_64F : HIP_R_32F;
+        hipblasComputeType_t ct        = is_double ? HIPBLAS_COMPUTE_64F : HIPBLAS_COMPUTE_32F;
+
+        hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+        hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+        int                M      = arg.M;
+        int                N      = arg.N;
+        int                K      = arg.K;
+        int                lda    = arg.lda;
+        int                ldb    = arg.ldb;
+        int                ldc    = arg.ldc;
+        Tex                alpha  = arg.get_alpha<Tex>();
+        Tex                beta   = arg.get_beta<Tex>();
+
+        int A_row = transA == HIPBLAS_OP_N ? M : K;
+        int A_col = transA == HIPBLAS_OP_N ? K : M;
+        int B_row = transB == HIPBLAS_OP_N ? K : N;
+        int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+        hipblasLocalHandle handle(arg);
+
+        bool invalid_size = M < 0 || N < 0 || K < 0 || lda < std::max(A_row, 1)
+                            || ldb < std::max(B_row, 1) || ldc < std::max(M, 1);
+        if(invalid_size || !M || !N)
+        {
+            EXPECT_HIPBLAS_STATUS(hipblasGemmExWithDiagonalScales(handle,
+                                                                  transA,
+                                                                  transB,
+                                                                  M,
+                                                                  N,
+                                                                  K,
+                                                                  nullptr,
+                                                                  nullptr,
+                                                                  type,
+                                                                  lda,
+                                                                  nullptr,
+                                                                  type,
+                                                                  ldb,
+                                                                  nullptr,
+                                                                  nullptr,
+                                                                  type,
+                                                                  ldc,
+                                                                  ct,
+                                                                  nullptr,
+                                                                  nullptr),
+                                  invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                               : HIPBLAS_STATUS_SUCCESS);
+            return;
+        }
+
+        host_matrix<Ti>    hA(A_row, A_col, lda);
+        host_matrix<Ti>    hB(B_row, B_col, ldb);
+        host_matrix<To>    hW(M, N, M);
+        host_matrix<To>    hC(M, N, ldc);
+        host_matrix<To>    hC_gold(M, N, ldc);
+        host_matrix<To>    hC_device(M, N, ldc);
+        host_vector<float> hRow(M), hCol(N);
+
+        device_matrix<Ti>    dA(A_row, A_col, lda);
+        device_matrix<Ti>    dB(B_row, B_col, ldb);
+        device_matrix<To>    dC(M, N, ldc);
+        device_vector<Tex>   d_alpha(1), d_beta(1);
+        device_vector<float> dRow(M), dCol(N);
+
+        CHECK_DEVICE_ALLOCATION(dA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dB.memcheck());
+        CHECK_DEVICE_ALLOCATION(dC.memcheck());
+        CHECK_DEVICE_ALLOCATION(dRow.memcheck());
+        CHECK_DEVICE_ALLOCATION(dCol.memcheck());
+
+        hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+        hipblas_init_matrix(
+            hB, arg, hipblas_client_never_set_nan, hipblas_general_matrix, false, true);
+        hipblas_init_matrix(hC, arg, hipblas_client_never_set_nan, hipblas_general_matrix);
+
+        // powers of two, so the scaled products of the small integers of the data are exact
+        for(int i = 0; i < M; i++)
+            hRow[i] = float(1 << (i % 3)) / 2;
+        for(int j = 0; j < N; j++)
+            hCol[j] = float(1 << (j % 4)) / 4;
+
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIP_ERROR(dRow.transfer_from(hRow));
+        CHECK_HIP_ERROR(dCol.transfer_from(hCol));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(Tex), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(Tex), hipMemcpyHostToDevice));
+
+        ref_gemm<Ti, To, Tex>(
+            transA, transB, M, N, K, 1, hA.data(), lda, hB.data(), ldb, 0, hW.data(), M);
+
+        // each of the scales alone and both, in both pointer modes
+        for(hipblasPointerMode_t mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
+        {
+            for(int scales = 1; scales <= 3; scales++)
+            {
+                bool row = scales & 1, col = scales & 2;
+                for(int j = 0; j < N; j++)
+                {
+                    for(int i = 0; i < M; i++)
+                    {
+                        Tex w = hW.data()[i + size_t(j) * M] * (row ? hRow[i] : 1.0f)
+                                * (col ? hCol[j] : 1.0f);
+                        hC_gold.data()[i + size_t(j) * ldc]
+                            = alpha * w + beta * hC.data()[i + size_t(j) * ldc];
+                    }
+                }
+
+                bool device_mode = mode == HIPBLAS_POINTER_MODE_DEVICE;
+                CHECK_HIP_ERROR(dC.transfer_from(hC));
+                CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, mode));
+                CHECK_HIPBLAS_ERROR(
+                    hipblasGemmExWithDiagonalScales(handle,
+                                                    transA,
+                                                    transB,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    device_mode ? (Tex*)d_alpha : &alpha,
+                                                    dA,
+                                                    type,
+                                                    lda,
+                                                    dB,
+                                                    type,
+                                                    ldb,
+                                                    device_mode ? (Tex*)d_beta : &beta,
+                                                    dC,
+                                                    type,
+                                                    ldc,
+                                                    ct,
+                                                    row ? (float*)dRow : nullptr,
+                                                    col ? (float*)dCol : nullptr));
+
+                hipblasPointerMode_t mode_after;
+                CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(handle, &mode_after));
+                EXPECT_EQ(mode_after, mode);
+
+                CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+                unit_check_general<To>(M, N, ldc, hC_gold, hC_device);
+            }
+        }
+    }
+#endif
+}
@@ -0,0 +1,291 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "utility.h"
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <typeinfo>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmExWithEpilogueModel = ArgumentModel<e_a_type,
+                                                     e_c_type,
+                                                     e_compute_type,
+                                                     e_transA,
+                                                     e_transB,
+                                                     e_M,
+                                                     e_N,
+                                                     e_K,
+                                                     e_alpha,
+                                                     e_lda,
+                                                     e_ldb,
+                                                     e_beta,
+                                                     e_ldc>;
+
+inline void testname_gemm_ex_with_epilogue(const Arguments& arg, std::string& name)
+{
+    hipblasGemmExWithEpilogueModel{}.test_name(arg, name);
+}
+
+// tanh approximation of GELU, as computed by hipBLASLt and cuBLASLt
+inline double ref_gelu(double x)
+{
+    return 0.5 * x * (1.0 + std::tanh(0.7978845608028654 * (x + 0.044715 * x * x * x)));
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_ex_with_epilogue_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType          aType       = arg.a_type;
+    hipDataType          bType       = arg.b_type;
+    hipDataType          cType       = arg.c_type;
+    hipblasComputeType_t computeType = arg.compute_type_gemm;
+
+    int M   = 101;
+    int N   = 100;
+    int K   = 102;
+    int lda = 103;
+    int ldb = 104;
+    int ldc = 105;
+
+    hipblasOperation_t transA = HIPBLAS_OP_N;
+    hipblasOperation_t transB = HIPBLAS_OP_N;
+
+    device_matrix<Ti> dA(M, K, lda);
+    device_matrix<Ti> dB(K, N, ldb);
+    device_matrix<To> dC(M, N, ldc);
+    device_matrix<To> dAux(M, N, ldc);
+    device_vector<To> dBias(M);
+
+    Tex h_alpha(1), h_beta(2);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExWithEpilogue(nullptr, transA, transB, M, N, K, &h_alpha,
+                                                    dA, aType, lda, dB, bType, ldb, &h_beta,
+                                                    dC, cType, ldc, computeType,
+                                                    HIPBLAS_EPILOGUE_BIAS, dBias, nullptr, 0),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    if(arg.bad_arg_all)
+    {
+        // the cuBLAS backend leaves these checks to cuBLASLt
+        EXPECT_HIPBLAS_STATUS(hipblasGemmExWithEpilogue(handle, transA, transB, M, N, K, &h_alpha,
+                                                        dA, aType, lda, dB, bType, ldb, &h_beta,
+                                                        dC, cType, ldc, computeType,
+                                                        hipblasEpilogue_t(3), dBias, nullptr, 0),
+                              HIPBLAS_STATUS_INVALID_ENUM);
+
+        EXPECT_HIPBLAS_STATUS(hipblasGemmExWithEpilogue(handle, transA, transB, M, N, K, &h_alpha,
+                                                        dA, aType, lda, dB, bType, ldb, &h_beta,
+                                                        dC, cType, ldc, computeType,
+                                                        HIPBLAS_EPILOGUE_BIAS, nullptr, nullptr, 0),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+        EXPECT_HIPBLAS_STATUS(hipblasGemmExWithEpilogue(handle, transA, transB, M, N, K, &h_alpha,
+                                                        dA, aType, lda, dB, bType, ldb, &h_beta,
+                                                        dC, cType, ldc, computeType,
+                                                        HIPBLAS_EPILOGUE_GELU_AUX, nullptr, dAux,
+                                                        M - 1),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+        EXPECT_HIPBLAS_STATUS(hipblasGemmExWithEpilogue(handle, transA, transB, M, N, K, &h_alpha,
+                                                        dA, aType, M - 1, dB, bType, ldb, &h_beta,
+                                                        dC, cType, ldc, computeType,
+                                                        HIPBLAS_EPILOGUE_RELU, nullptr, nullptr, 0),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+    }
+
+    // clang-format on
+#endif
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_ex_with_epilogue(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    // the epilogues are defined on real outputs
+    if constexpr(!is_complex<To>)
+    {
+        hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+        hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+        int                M      = arg.M;
+        int                N      = arg.N;
+        int                K      = arg.K;
+        int                lda    = arg.lda;
+        int                ldb    = arg.ldb;
+        int                ldc    = arg.ldc;
+
+        hipDataType          a_type       = arg.a_type;
+        hipDataType          b_type       = arg.b_type;
+        hipDataType          c_type       = arg.c_type;
+        hipblasComputeType_t compute_type = arg.compute_type_gemm;
+
+        Tex h_alpha_Tex = arg.get_alpha<Tex>();
+        Tex h_beta_Tex  = arg.get_beta<Tex>();
+
+        int A_row = transA == HIPBLAS_OP_N ? M : K;
+        int A_col = transA == HIPBLAS_OP_N ? K : M;
+        int B_row = transB == HIPBLAS_OP_N ? K : N;
+        int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+        hipblasLocalHandle handle(arg);
+
+        // check here to prevent undefined memory allocation error
+        bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M;
+        if(invalid_size || !M || !N)
+            return;
+
+        host_matrix<Ti> hA(A_row, A_col, lda);
+        host_matrix<Ti> hB(B_row, B_col, ldb);
+        host_matrix<To> hC(M, N, ldc);
+        host_matrix<To> hC_device(M, N, ldc);
+        host_matrix<To> hC_gemm(M, N, ldc);
+        host_matrix<To> hC_gold(M, N, ldc);
+        host_matrix<To> hAux_device(M, N, ldc);
+        host_matrix<To> hAux_gold(M, N, ldc);
+        host_vector<To> hBias(M);
+
+        device_matrix<Ti> dA(A_row, A_col, lda);
+        device_matrix<Ti> dB(B_row, B_col, ldb);
+        device_matrix<To> dC(M, N, ldc);
+        device_matrix<To> dAux(M, N, ldc);
+        device_vector<To> dBias(M);
+
+        hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+        hipblas_init_matrix(
+            hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+        hipblas_init_matrix(hC, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+        hipblas_init_vector(hBias, arg, hipblas_client_never_set_nan);
+
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIP_ERROR(dBias.transfer_from(hBias));
+
+        hC_gemm = hC;
+        ref_gemm<Ti, To, Tex>(transA,
+                              transB,
+                              M,
+                              N,
+                              K,
+                              h_alpha_Tex,
+                              hA.data(),
+                              lda,
+                              hB.data(),
+                              ldb,
+                              h_beta_Tex,
+                              hC_gemm.data(),
+                              ldc);
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        for(hipblasEpilogue_t epilogue : {HIPBLAS_EPILOGUE_DEFAULT,
+                                          HIPBLAS_EPILOGUE_RELU,
+                                          HIPBLAS_EPILOGUE_BIAS,
+                                          HIPBLAS_EPILOGUE_RELU_BIAS,
+                                          HIPBLAS_EPILOGUE_GELU,
+                                          HIPBLAS_EPILOGUE_GELU_AUX_BIAS})
+        {
+            bool with_bias = epilogue & HIPBLAS_EPILOGUE_BIAS;
+            bool with_aux  = epilogue == HIPBLAS_EPILOGUE_GELU_AUX_BIAS;
+            bool gelu      = epilogue & HIPBLAS_EPILOGUE_GELU;
+            bool relu      = epilogue & HIPBLAS_EPILOGUE_RELU;
+
+            // the epilogue is applied to the reference gemm, with aux holding the input of GELU
+            double max_abs = 0;
+            for(int j = 0; j < N; j++)
+            {
+                for(int i = 0; i < M; i++)
+                {
+                    size_t idx = i + j * size_t(ldc);
+                    double x   = double(hC_gemm.data()[idx]);
+                    if(with_bias)
+                        x += double(hBias[i]);
+                    hAux_gold.data()[idx] = To(x);
+                    if(relu)
+                        x = x > 0 ? x : 0;
+                    else if(gelu)
+                        x = ref_gelu(x);
+                    hC_gold.data()[idx] = To(x);
+                    max_abs             = std::max(max_abs, std::abs(x));
+                }
+            }
+
+            CHECK_HIP_ERROR(dC.transfer_from(hC));
+            hipblasStatus_t status = hipblasGemmExWithEpilogue(handle,
+                                                               transA,
+                                                               transB,
+                                                               M,
+                                                               N,
+                                                               K,
+                                                               &h_alpha_Tex,
+                                                               dA,
+                                                               a_type,
+                                                               lda,
+                                                               dB,
+                                                               b_type,
+                                                               ldb,
+                                                               &h_beta_Tex,
+                                                               dC,
+                                                               c_type,
+                                                               ldc,
+                                                               compute_type,
+                                                               epilogue,
+                                                               with_bias ? (To*)dBias : nullptr,
+                                                               with_aux ? (To*)dAux : nullptr,
+                                                               ldc);
+
+            // builds without hipBLASLt, and problems that hipBLASLt or cuBLASLt don't support
+            if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+                continue;
+            CHECK_HIPBLAS_ERROR(status);
+
+            CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+            if(gelu)
+            {
+                double tol = std::numeric_limits<To>::epsilon() * 100 * (1 + max_abs);
+                near_check_general<To>(M, N, ldc, hC_gold, hC_device, tol);
+            }
+            else
+                unit_check_general<To>(M, N, ldc, hC_gold, hC_device);
+
+            if(with_aux)
+            {
+                CHECK_HIP_ERROR(hAux_device.transfer_from(dAux));
+                unit_check_general<To>(M, N, ldc, hAux_gold, hAux_device);
+            }
+        }
+    }
+#endif
+}
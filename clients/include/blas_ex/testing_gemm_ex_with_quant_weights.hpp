@@ -0,0 +1,276 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmExWithQuantWeightsModel = ArgumentModel<e_a_type,
+                                                         e_c_type,
+                                                         e_transA,
+                                                         e_M,
+                                                         e_N,
+                                                         e_K,
+                                                         e_alpha,
+                                                         e_lda,
+                                                         e_ldb,
+                                                         e_beta,
+                                                         e_ldc>;
+
+inline void testname_gemm_ex_with_quant_weights(const Arguments& arg, std::string& name)
+{
+    hipblasGemmExWithQuantWeightsModel{}.test_name(arg, name);
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_ex_with_quant_weights_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    if constexpr(std::is_same_v<Ti, hipblasHalf> && std::is_same_v<To, hipblasHalf>)
+    {
+        hipblasLocalHandle handle(arg);
+
+        int   M = 4, N = 100, K = 128, lda = 130, ldb = 129, ldc = 5, group_size = 32;
+        float alpha = 1, beta = 0;
+
+        hipblasOperation_t  transA = HIPBLAS_OP_N;
+        hipblasWeightType_t bType  = HIPBLAS_WEIGHT_INT8;
+        hipDataType         aType  = HIP_R_16F;
+        hipDataType         cType  = HIP_R_16F;
+
+        device_matrix<hipblasHalf> dA(M, K, lda);
+        device_matrix<uint8_t>     dB(K, N, ldb);
+        device_matrix<hipblasHalf> dScales(K / group_size, N, K / group_size);
+        device_matrix<hipblasHalf> dC(M, N, ldc);
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        auto call = [&](hipblasHandle_t     h,
+                        hipblasOperation_t  trans,
+                        hipblasWeightType_t b_type,
+                        hipDataType         c_type,
+                        int                 lda_,
+                        int                 ldb_,
+                        const void*         scales,
+                        int                 group_size_) {
+            return hipblasGemmExWithQuantWeights(h,
+                                                 trans,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 &alpha,
+                                                 dA,
+                                                 aType,
+                                                 lda_,
+                                                 dB,
+                                                 b_type,
+                                                 ldb_,
+                                                 scales,
+                                                 nullptr,
+                                                 group_size_,
+                                                 &beta,
+                                                 dC,
+                                                 c_type,
+                                                 ldc,
+                                                 HIPBLAS_COMPUTE_32F);
+        };
+
+        // clang-format off
+
+        EXPECT_HIPBLAS_STATUS(call(nullptr, transA, bType, cType, lda, ldb, dScales, group_size),
+                              HIPBLAS_STATUS_NOT_INITIALIZED);
+        EXPECT_HIPBLAS_STATUS(call(handle, hipblasOperation_t(0), bType, cType, lda, ldb, dScales,
+                                   group_size),
+                              HIPBLAS_STATUS_INVALID_ENUM);
+        EXPECT_HIPBLAS_STATUS(call(handle, transA, hipblasWeightType_t(2), cType, lda, ldb,
+                                   dScales, group_size),
+                              HIPBLAS_STATUS_INVALID_ENUM);
+        EXPECT_HIPBLAS_STATUS(call(handle, transA, bType, HIP_R_16BF, lda, ldb, dScales,
+                                   group_size),
+                              HIPBLAS_STATUS_NOT_SUPPORTED);
+        EXPECT_HIPBLAS_STATUS(call(handle, transA, bType, cType, M - 1, ldb, dScales, group_size),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(call(handle, transA, bType, cType, lda, K - 1, dScales, group_size),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(call(handle, transA, bType, cType, lda, ldb, dScales, 0),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(call(handle, transA, bType, cType, lda, ldb, nullptr, group_size),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+        // the uint4 weights of a column take (K + 1) / 2 bytes
+        CHECK_HIPBLAS_ERROR(call(handle, transA, HIPBLAS_WEIGHT_UINT4, cType, lda, K / 2, dScales,
+                                 group_size));
+
+        // clang-format on
+    }
+#endif
+}
+
+// The activations, weight codes, zero points and C are small integers and the scales powers of
+// two, so the sums are exact in float and the results, rounded once to To, compare exactly
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_ex_with_quant_weights(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    constexpr bool half_a = std::is_same_v<Ti, hipblasHalf> || std::is_same_v<Ti, hipblasBfloat16>;
+    if constexpr(half_a && (std::is_same_v<To, Ti> || std::is_same_v<To, float>))
+    {
+        hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+        int                M      = arg.M;
+        int                N      = arg.N;
+        int                K      = arg.K;
+        int                lda    = arg.lda;
+        int                ldb    = arg.ldb;
+        int                ldc    = arg.ldc;
+        hipDataType        aType  = arg.a_type;
+        hipDataType        cType  = arg.c_type;
+
+        float h_alpha = arg.get_alpha<float>();
+        float h_beta  = arg.get_beta<float>();
+
+        int A_row = transA == HIPBLAS_OP_N ? M : K;
+        int A_col = transA == HIPBLAS_OP_N ? K : M;
+
+        hipblasLocalHandle handle(arg);
+
+        if(M <= 0 || N <= 0 || K <= 0 || lda < A_row || ldb < K || ldc < M)
+            return;
+
+        size_t size_A = size_t(lda) * A_col;
+        size_t size_B = size_t(ldb) * N;
+        size_t size_C = size_t(ldc) * N;
+
+        host_vector<Ti>      hA(size_A);
+        host_vector<uint8_t> hB(size_B);
+        host_vector<To>      hC(size_C);
+        host_vector<To>      hC_gold(size_C);
+        host_vector<To>      hC_device(size_C);
+
+        device_vector<Ti>      dA(size_A);
+        device_vector<uint8_t> dB(size_B);
+        device_vector<To>      dC(size_C);
+
+        CHECK_DEVICE_ALLOCATION(dA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dB.memcheck());
+        CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+        for(int j = 0; j < A_col; j++)
+            for(int i = 0; i < A_row; i++)
+                hA[i + size_t(j) * lda]
+                    = ref_gemv_ex_from_float<Ti>(float((i * 7 + j * 3) % 7 - 3));
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < M; i++)
+                hC[i + size_t(j) * ldc] = ref_gemv_ex_from_float<To>(float((i + 2 * j) % 5 - 2));
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        for(hipblasWeightType_t bType : {HIPBLAS_WEIGHT_INT8, HIPBLAS_WEIGHT_UINT4})
+        {
+            for(int group_size : {32, K})
+            {
+                int groups = (K - 1) / group_size + 1;
+
+                host_vector<Ti>     hScales(size_t(groups) * N);
+                host_vector<Ti>     hZeros(size_t(groups) * N);
+                device_vector<Ti>   dScales(size_t(groups) * N);
+                device_vector<Ti>   dZeros(size_t(groups) * N);
+                host_vector<double> hW(size_t(K) * N);
+
+                for(int j = 0; j < N; j++)
+                {
+                    for(int g = 0; g < groups; g++)
+                    {
+                        float zero
+                            = bType == HIPBLAS_WEIGHT_UINT4 ? 8 - (g + j) % 3 : (g + j) % 3 - 1;
+                        hScales[g + size_t(j) * groups]
+                            = ref_gemv_ex_from_float<Ti>(std::ldexp(1.0f, -((g + 2 * j) % 3)));
+                        hZeros[g + size_t(j) * groups] = ref_gemv_ex_from_float<Ti>(zero);
+                    }
+                    for(int p = 0; p < K; p++)
+                    {
+                        int     code = bType == HIPBLAS_WEIGHT_UINT4 ? (p * 5 + j * 3) % 16
+                                                                     : (p * 5 + j * 3) % 17 - 8;
+                        uint8_t& b   = hB[(bType == HIPBLAS_WEIGHT_UINT4 ? p / 2 : p)
+                                        + size_t(j) * ldb];
+                        if(bType == HIPBLAS_WEIGHT_INT8)
+                            b = uint8_t(int8_t(code));
+                        else
+                            b = p & 1 ? uint8_t((b & 15) | (code << 4)) : uint8_t(code);
+
+                        size_t g = p / group_size + size_t(j) * groups;
+                        hW[p + size_t(j) * K]
+                            = ref_gemv_ex_to_float(hScales[g])
+                              * (code - ref_gemv_ex_to_float(hZeros[g]));
+                    }
+                }
+
+                for(int j = 0; j < N; j++)
+                {
+                    for(int i = 0; i < M; i++)
+                    {
+                        double sum = 0;
+                        for(int p = 0; p < K; p++)
+                        {
+                            size_t a = transA == HIPBLAS_OP_N ? i + size_t(p) * lda
+                                                              : p + size_t(i) * lda;
+                            sum += ref_gemv_ex_to_float(hA[a]) * hW[p + size_t(j) * K];
+                        }
+                        double c = ref_gemv_ex_to_float(hC[i + size_t(j) * ldc]);
+                        hC_gold[i + size_t(j) * ldc] = ref_gemv_ex_from_float<To>(
+                            float(h_alpha * sum + (h_beta == 0 ? 0 : h_beta * c)));
+                    }
+                }
+
+                CHECK_HIP_ERROR(dB.transfer_from(hB));
+                CHECK_HIP_ERROR(dC.transfer_from(hC));
+                CHECK_HIP_ERROR(dScales.transfer_from(hScales));
+                CHECK_HIP_ERROR(dZeros.transfer_from(hZeros));
+
+                CHECK_HIPBLAS_ERROR(hipblasGemmExWithQuantWeights(handle,
+                                                                  transA,
+                                                                  M,
+                                                                  N,
+                                                                  K,
+                                                                  &h_alpha,
+                                                                  dA,
+                                                                  aType,
+                                                                  lda,
+                                                                  dB,
+                                                                  bType,
+                                                                  ldb,
+                                                                  dScales,
+                                                                  dZeros,
+                                                                  group_size,
+                                                                  &h_beta,
+                                                                  dC,
+                                                                  cType,
+                                                                  ldc,
+                                                                  HIPBLAS_COMPUTE_32F));
+
+                CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+                unit_check_general<To>(M, N, ldc, hC_gold, hC_device);
+            }
+        }
+    }
+#endif
+}
@@ -0,0 +1,222 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmExWithRequantModel
+    = ArgumentModel<e_a_type, e_transA, e_transB, e_M, e_N, e_K, e_lda, e_ldb, e_ldd>;
+
+inline void testname_gemm_ex_with_requant(const Arguments& arg, std::string& name)
+{
+    hipblasGemmExWithRequantModel{}.test_name(arg, name);
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_ex_with_requant_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    int M = 101, N = 100, K = 102, lda = 103, ldb = 104, ldd = 105;
+
+    hipblasOperation_t transA = HIPBLAS_OP_N;
+    hipblasOperation_t transB = HIPBLAS_OP_N;
+
+    device_matrix<int8_t> dA(M, K, lda);
+    device_matrix<int8_t> dB(K, N, ldb);
+    device_matrix<int8_t> dD(M, N, ldd);
+    device_vector<float>  dScale(M);
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExWithRequant(nullptr, transA, transB, M, N, K, dA, lda, dB,
+                                                   ldb, dD, ldd, dScale, nullptr, nullptr),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExWithRequant(handle, hipblasOperation_t(0), transB, M, N,
+                                                   K, dA, lda, dB, ldb, dD, ldd, dScale, nullptr,
+                                                   nullptr),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExWithRequant(handle, transA, transB, M, N, K, dA, M - 1, dB,
+                                                   ldb, dD, ldd, dScale, nullptr, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExWithRequant(handle, transA, transB, M, N, K, dA, lda, dB,
+                                                   ldb, dD, M - 1, dScale, nullptr, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExWithRequant(handle, transA, transB, M, N, K, dA, lda, dB,
+                                                   ldb, dD, ldd, nullptr, nullptr, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExWithRequant(handle, transA, transB, M, N, K, nullptr, lda,
+                                                   dB, ldb, dD, ldd, dScale, nullptr, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // With M == 0, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasGemmExWithRequant(handle, transA, transB, 0, N, K, nullptr, lda,
+                                                 nullptr, ldb, nullptr, ldd, nullptr, nullptr,
+                                                 nullptr));
+
+    // clang-format on
+#endif
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_ex_with_requant(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    if constexpr(std::is_same_v<Ti, int8_t> && std::is_same_v<To, int32_t>)
+    {
+        hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+        hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+        int                M      = arg.M;
+        int                N      = arg.N;
+        int                K      = arg.K;
+        int                lda    = arg.lda;
+        int                ldb    = arg.ldb;
+        int                ldd    = arg.ldd;
+
+        int A_row = transA == HIPBLAS_OP_N ? M : K;
+        int A_col = transA == HIPBLAS_OP_N ? K : M;
+        int B_row = transB == HIPBLAS_OP_N ? K : N;
+        int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+        hipblasLocalHandle handle(arg);
+
+        bool invalid_size = M < 0 || N < 0 || K < 0 || lda < std::max(A_row, 1)
+                            || ldb < std::max(B_row, 1) || ldd < std::max(M, 1);
+        if(invalid_size || !M || !N)
+        {
+            EXPECT_HIPBLAS_STATUS(hipblasGemmExWithRequant(handle,
+                                                           transA,
+                                                           transB,
+                                                           M,
+                                                           N,
+                                                           K,
+                                                           nullptr,
+                                                           lda,
+                                                           nullptr,
+                                                           ldb,
+                                                           nullptr,
+                                                           ldd,
+                                                           nullptr,
+                                                           nullptr,
+                                                           nullptr),
+                                  invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                               : HIPBLAS_STATUS_SUCCESS);
+            return;
+        }
+
+        host_matrix<int8_t>  hA(A_row, A_col, lda);
+        host_matrix<int8_t>  hB(B_row, B_col, ldb);
+        host_matrix<int32_t> hW(M, N, M);
+        host_matrix<int8_t>  hD_gold(M, N, ldd);
+        host_matrix<int8_t>  hD_device(M, N, ldd);
+        host_vector<float>   hScale(M);
+        host_vector<int32_t> hBias(M);
+        host_vector<int32_t> hZero(M);
+
+        device_matrix<int8_t>  dA(A_row, A_col, lda);
+        device_matrix<int8_t>  dB(B_row, B_col, ldb);
+        device_matrix<int8_t>  dD(M, N, ldd);
+        device_vector<float>   dScale(M);
+        device_vector<int32_t> dBias(M);
+        device_vector<int32_t> dZero(M);
+
+        CHECK_DEVICE_ALLOCATION(dA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dB.memcheck());
+        CHECK_DEVICE_ALLOCATION(dD.memcheck());
+        CHECK_DEVICE_ALLOCATION(dScale.memcheck());
+        CHECK_DEVICE_ALLOCATION(dBias.memcheck());
+        CHECK_DEVICE_ALLOCATION(dZero.memcheck());
+
+        hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+        hipblas_init_matrix(
+            hB, arg, hipblas_client_never_set_nan, hipblas_general_matrix, false, true);
+
+        // scales that push some of the results out of the int8 range, to check the saturation
+        for(int i = 0; i < M; i++)
+        {
+            hScale[i] = 0.25f + 0.125f * (i % 5);
+            hBias[i]  = i % 11 - 5;
+            hZero[i]  = i % 7 - 3;
+        }
+
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIP_ERROR(dScale.transfer_from(hScale));
+        CHECK_HIP_ERROR(dBias.transfer_from(hBias));
+        CHECK_HIP_ERROR(dZero.transfer_from(hZero));
+
+        ref_gemm<int8_t, int32_t, int32_t>(
+            transA, transB, M, N, K, 1, hA.data(), lda, hB.data(), ldb, 0, hW.data(), M);
+
+        // the pointer mode of the handle doesn't matter, and is left as it was
+        for(hipblasPointerMode_t mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
+        {
+            for(bool offsets : {false, true})
+            {
+                for(int j = 0; j < N; j++)
+                {
+                    for(int i = 0; i < M; i++)
+                    {
+                        int64_t acc = hW.data()[i + size_t(j) * M] + (offsets ? hBias[i] : 0);
+                        float   q   = std::nearbyint(hScale[i] * float(acc))
+                                  + float(offsets ? hZero[i] : 0);
+                        hD_gold.data()[i + size_t(j) * ldd]
+                            = int8_t(std::clamp(q, -128.0f, 127.0f));
+                    }
+                }
+
+                CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, mode));
+                CHECK_HIPBLAS_ERROR(hipblasGemmExWithRequant(handle,
+                                                             transA,
+                                                             transB,
+                                                             M,
+                                                             N,
+                                                             K,
+                                                             dA,
+                                                             lda,
+                                                             dB,
+                                                             ldb,
+                                                             dD,
+                                                             ldd,
+                                                             dScale,
+                                                             offsets ? (int32_t*)dBias : nullptr,
+                                                             offsets ? (int32_t*)dZero : nullptr));
+
+                hipblasPointerMode_t mode_after;
+                CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(handle, &mode_after));
+                EXPECT_EQ(mode_after, mode);
+
+                CHECK_HIP_ERROR(hD_device.transfer_from(dD));
+                unit_check_general<int8_t>(M, N, ldd, hD_gold, hD_device);
+            }
+        }
+    }
+#endif
+}
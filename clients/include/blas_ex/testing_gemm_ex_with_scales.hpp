@@ -0,0 +1,358 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "utility.h"
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <typeinfo>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmExWithScalesModel = ArgumentModel<e_c_type,
+                                                   e_transA,
+                                                   e_transB,
+                                                   e_M,
+                                                   e_N,
+                                                   e_K,
+                                                   e_alpha,
+                                                   e_lda,
+                                                   e_ldb,
+                                                   e_beta,
+                                                   e_ldc,
+                                                   e_batch_count>;
+
+inline void testname_gemm_ex_with_scales(const Arguments& arg, std::string& name)
+{
+    hipblasGemmExWithScalesModel{}.test_name(arg, name);
+}
+
+#ifdef __HIP_PLATFORM_NVCC__
+// cuBLASLt takes the OCP FP8 types
+#ifdef HIP_R_8F_E4M3
+#define HIPBLAS_TEST_FP8_TYPE HIP_R_8F_E4M3
+#endif
+constexpr int hipblas_test_fp8_bias = 7;
+#else
+// rocBLAS and hipBLASLt take the FNUZ FP8 types, whose exponent bias is one more
+#define HIPBLAS_TEST_FP8_TYPE HIP_R_8F_E4M3_FNUZ
+constexpr int hipblas_test_fp8_bias = 8;
+#endif
+
+// E4M3 encoding of (-1)^negative * 2^e, so that the tests can fill FP8 matrices without an
+// FP8 host type. Products and sums of these are exact in float for the sizes tested.
+inline uint8_t fp8_e4m3_pow2(int e, bool negative)
+{
+    return uint8_t((negative ? 0x80 : 0) | ((e + hipblas_test_fp8_bias) << 3));
+}
+
+// fills an FP8 matrix with powers of two in [1/2, 2] of either sign, and ref with their values
+inline void
+    fp8_init_matrix(host_vector<uint8_t>& h, host_vector<float>& ref, size_t size, int seed)
+{
+    for(size_t i = 0; i < size; i++)
+    {
+        int  e        = int((i * 7 + seed) % 3) - 1;
+        bool negative = (i * 5 + seed) % 4 == 0;
+        h[i]          = fp8_e4m3_pow2(e, negative);
+        ref[i]        = (negative ? -1.0f : 1.0f) * std::ldexp(1.0f, e);
+    }
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_ex_with_scales_bad_arg(const Arguments& arg)
+{
+#if defined(HIPBLAS_V2) && defined(HIPBLAS_TEST_FP8_TYPE)
+    hipblasLocalHandle handle(arg);
+
+    hipDataType          abType      = HIPBLAS_TEST_FP8_TYPE;
+    hipDataType          cType       = HIP_R_32F;
+    hipblasComputeType_t computeType = HIPBLAS_COMPUTE_32F;
+
+    int M   = 101;
+    int N   = 100;
+    int K   = 102;
+    int lda = 103;
+    int ldb = 104;
+    int ldc = 105;
+
+    hipblasOperation_t transA = HIPBLAS_OP_T;
+    hipblasOperation_t transB = HIPBLAS_OP_N;
+
+    device_vector<uint8_t> dA(size_t(K) * lda);
+    device_vector<uint8_t> dB(size_t(N) * ldb);
+    device_vector<float>   dC(size_t(N) * ldc);
+    device_vector<float>   dScale(1);
+
+    float h_alpha(1), h_beta(2);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExWithScales(nullptr, transA, transB, M, N, K, &h_alpha,
+                                                  dA, abType, lda, dB, abType, ldb, &h_beta,
+                                                  dC, cType, ldc, computeType,
+                                                  dScale, dScale, nullptr, nullptr),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmStridedBatchedExWithScales(nullptr, transA, transB, M, N, K,
+                                                                &h_alpha, dA, abType, lda, 0, dB,
+                                                                abType, ldb, 0, &h_beta, dC,
+                                                                cType, ldc, 0, 1, computeType,
+                                                                dScale, dScale, nullptr, nullptr),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    if(arg.bad_arg_all)
+    {
+        // the cuBLAS backend leaves these checks to cuBLASLt
+        EXPECT_HIPBLAS_STATUS(hipblasGemmExWithScales(handle, transA, transB, M, N, K, &h_alpha,
+                                                      dA, abType, M - 1, dB, abType, ldb, &h_beta,
+                                                      dC, cType, ldc, computeType,
+                                                      dScale, dScale, nullptr, nullptr),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+        EXPECT_HIPBLAS_STATUS(hipblasGemmExWithScales(handle, transA, transB, M, N, K, nullptr,
+                                                      dA, abType, lda, dB, abType, ldb, &h_beta,
+                                                      dC, cType, ldc, computeType,
+                                                      dScale, dScale, nullptr, nullptr),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+        EXPECT_HIPBLAS_STATUS(hipblasGemmStridedBatchedExWithScales(handle, transA, transB, M, N,
+                                                                    K, &h_alpha, dA, abType, lda,
+                                                                    0, dB, abType, ldb, 0,
+                                                                    &h_beta, dC, cType, ldc, 0,
+                                                                    -1, computeType, dScale,
+                                                                    dScale, nullptr, nullptr),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+        // the scaling factors are only defined for FP8 inputs
+        EXPECT_HIPBLAS_STATUS(hipblasGemmExWithScales(handle, transA, transB, M, N, K, &h_alpha,
+                                                      dA, HIP_R_32F, lda, dB, HIP_R_32F, ldb,
+                                                      &h_beta, dC, cType, ldc, computeType,
+                                                      dScale, dScale, nullptr, nullptr),
+                              HIPBLAS_STATUS_NOT_SUPPORTED);
+    }
+
+    // clang-format on
+#endif
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_ex_with_scales(const Arguments& arg)
+{
+#if defined(HIPBLAS_V2) && defined(HIPBLAS_TEST_FP8_TYPE)
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                lda         = arg.lda;
+    int                ldb         = arg.ldb;
+    int                ldc         = arg.ldc;
+    int                batch_count = arg.batch_count;
+
+    hipDataType          ab_type      = HIPBLAS_TEST_FP8_TYPE;
+    hipDataType          c_type       = HIP_R_32F;
+    hipblasComputeType_t compute_type = HIPBLAS_COMPUTE_32F;
+
+    float h_alpha   = arg.get_alpha<float>();
+    float h_beta    = arg.get_beta<float>();
+    float h_scale_a = 2.0f;
+    float h_scale_b = 4.0f;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    hipblasLocalHandle handle(arg);
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M
+                        || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+        return;
+
+    hipblasStride stride_A = hipblasStride(lda) * A_col;
+    hipblasStride stride_B = hipblasStride(ldb) * B_col;
+    hipblasStride stride_C = hipblasStride(ldc) * N;
+
+    host_vector<uint8_t> hA(stride_A * batch_count);
+    host_vector<uint8_t> hB(stride_B * batch_count);
+    host_vector<float>   hA_ref(stride_A * batch_count);
+    host_vector<float>   hB_ref(stride_B * batch_count);
+    host_vector<float>   hC(stride_C * batch_count);
+    host_vector<float>   hC_device(stride_C * batch_count);
+    host_vector<float>   hC_gold(stride_C * batch_count);
+    host_vector<float>   hScale_a(1), hScale_b(1);
+
+    device_vector<uint8_t> dA(stride_A * batch_count);
+    device_vector<uint8_t> dB(stride_B * batch_count);
+    device_vector<float>   dC(stride_C * batch_count);
+    device_vector<float>   dScale_a(1), dScale_b(1);
+
+    fp8_init_matrix(hA, hA_ref, hA.size(), 0);
+    fp8_init_matrix(hB, hB_ref, hB.size(), 1);
+    hipblas_init_vector(hC, arg, hipblas_client_beta_sets_nan, true);
+    hScale_a[0] = h_scale_a;
+    hScale_b[0] = h_scale_b;
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dScale_a.transfer_from(hScale_a));
+    CHECK_HIP_ERROR(dScale_b.transfer_from(hScale_b));
+
+    // the gemms of the inputs, with the scaling factors folded into alpha
+    auto ref_gemms = [&](float alpha, host_vector<float>& hC_ref) {
+        hC_ref = hC;
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int b = 0; b < batch_count; b++)
+        {
+            ref_gemm<float, float, float>(transA,
+                                          transB,
+                                          M,
+                                          N,
+                                          K,
+                                          alpha,
+                                          hA_ref.data() + b * stride_A,
+                                          lda,
+                                          hB_ref.data() + b * stride_B,
+                                          ldb,
+                                          h_beta,
+                                          hC_ref.data() + b * stride_C,
+                                          ldc);
+        }
+    };
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+#ifndef __HIP_PLATFORM_NVCC__
+    // unscaled FNUZ FP8 inputs are also taken by the gemm_ex functions of the rocBLAS backend
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    hipblasStatus_t status_ex = hipblasGemmStridedBatchedEx(handle,
+                                                            transA,
+                                                            transB,
+                                                            M,
+                                                            N,
+                                                            K,
+                                                            &h_alpha,
+                                                            dA,
+                                                            ab_type,
+                                                            lda,
+                                                            stride_A,
+                                                            dB,
+                                                            ab_type,
+                                                            ldb,
+                                                            stride_B,
+                                                            &h_beta,
+                                                            dC,
+                                                            c_type,
+                                                            ldc,
+                                                            stride_C,
+                                                            batch_count,
+                                                            compute_type,
+                                                            HIPBLAS_GEMM_DEFAULT);
+    if(status_ex != HIPBLAS_STATUS_NOT_SUPPORTED && status_ex != HIPBLAS_STATUS_ARCH_MISMATCH)
+    {
+        CHECK_HIPBLAS_ERROR(status_ex);
+        ref_gemms(h_alpha, hC_gold);
+        CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+        unit_check_general<float>(M, N, batch_count, ldc, stride_C, hC_gold, hC_device);
+    }
+#endif
+
+    ref_gemms(h_alpha * h_scale_a * h_scale_b, hC_gold);
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    hipblasStatus_t status = hipblasGemmStridedBatchedExWithScales(handle,
+                                                                   transA,
+                                                                   transB,
+                                                                   M,
+                                                                   N,
+                                                                   K,
+                                                                   &h_alpha,
+                                                                   dA,
+                                                                   ab_type,
+                                                                   lda,
+                                                                   stride_A,
+                                                                   dB,
+                                                                   ab_type,
+                                                                   ldb,
+                                                                   stride_B,
+                                                                   &h_beta,
+                                                                   dC,
+                                                                   c_type,
+                                                                   ldc,
+                                                                   stride_C,
+                                                                   batch_count,
+                                                                   compute_type,
+                                                                   dScale_a,
+                                                                   dScale_b,
+                                                                   nullptr,
+                                                                   nullptr);
+
+    // builds without hipBLASLt, devices without FP8, and problems that hipBLASLt or cuBLASLt
+    // don't support
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED || status == HIPBLAS_STATUS_ARCH_MISMATCH)
+        return;
+    CHECK_HIPBLAS_ERROR(status);
+
+    CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+    unit_check_general<float>(M, N, batch_count, ldc, stride_C, hC_gold, hC_device);
+
+    // the first problem with the non-batched function
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIPBLAS_ERROR(hipblasGemmExWithScales(handle,
+                                                transA,
+                                                transB,
+                                                M,
+                                                N,
+                                                K,
+                                                &h_alpha,
+                                                dA,
+                                                ab_type,
+                                                lda,
+                                                dB,
+                                                ab_type,
+                                                ldb,
+                                                &h_beta,
+                                                dC,
+                                                c_type,
+                                                ldc,
+                                                compute_type,
+                                                dScale_a,
+                                                dScale_b,
+                                                nullptr,
+                                                nullptr));
+
+    CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+    unit_check_general<float>(M, N, ldc, hC_gold, hC_device);
+#endif
+}
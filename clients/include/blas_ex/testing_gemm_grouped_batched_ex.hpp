@@ -0,0 +1,308 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "utility.h"
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdlib.h>
+#include <typeinfo>
+#include <vector>
+
+#include "hipblas_unique_ptr.hpp"
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmGroupedBatchedExModel = ArgumentModel<e_a_type,
+                                                       e_c_type,
+                                                       e_compute_type,
+                                                       e_transA,
+                                                       e_transB,
+                                                       e_M,
+                                                       e_N,
+                                                       e_K,
+                                                       e_alpha,
+                                                       e_lda,
+                                                       e_ldb,
+                                                       e_beta,
+                                                       e_ldc,
+                                                       e_batch_count>;
+
+inline void testname_gemm_grouped_batched_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmGroupedBatchedExModel{}.test_name(arg, name);
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_grouped_batched_ex_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType          aType       = arg.a_type;
+    hipDataType          bType       = arg.b_type;
+    hipDataType          cType       = arg.c_type;
+    hipblasComputeType_t computeType = arg.compute_type_gemm;
+
+    hipblasOperation_t transA[]     = {HIPBLAS_OP_N};
+    hipblasOperation_t transB[]     = {HIPBLAS_OP_N};
+    hipblasOperation_t bad_trans[]  = {(hipblasOperation_t)HIPBLAS_FILL_MODE_FULL};
+    int                M[]          = {101};
+    int                N[]          = {100};
+    int                K[]          = {102};
+    int                lda[]        = {103};
+    int                ldb[]        = {104};
+    int                ldc[]        = {105};
+    int                bad_ldc[]    = {99};
+    int                group_size[] = {2};
+
+    device_batch_matrix<Ti> dA(M[0], K[0], lda[0], group_size[0]);
+    device_batch_matrix<Ti> dB(K[0], N[0], ldb[0], group_size[0]);
+    device_batch_matrix<To> dC(M[0], N[0], ldc[0], group_size[0]);
+
+    Tex h_alpha[] = {Tex(1)};
+    Tex h_beta[]  = {Tex(2)};
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmGroupedBatchedEx(nullptr, transA, transB, M, N, K, h_alpha,
+                                                      (const void**)dA.ptr_on_device(), aType, lda,
+                                                      (const void**)dB.ptr_on_device(), bType, ldb,
+                                                      h_beta, (void**)dC.ptr_on_device(), cType,
+                                                      ldc, 1, group_size, computeType),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmGroupedBatchedEx(handle, transA, transB, M, N, K, h_alpha,
+                                                      (const void**)dA.ptr_on_device(), aType, lda,
+                                                      (const void**)dB.ptr_on_device(), bType, ldb,
+                                                      h_beta, (void**)dC.ptr_on_device(), cType,
+                                                      ldc, -1, group_size, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmGroupedBatchedEx(handle, transA, transB, M, N, K, h_alpha,
+                                                      (const void**)dA.ptr_on_device(), aType, lda,
+                                                      (const void**)dB.ptr_on_device(), bType, ldb,
+                                                      h_beta, (void**)dC.ptr_on_device(), cType,
+                                                      ldc, 1, nullptr, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmGroupedBatchedEx(handle, transA, transB, M, N, K, h_alpha,
+                                                      (const void**)dA.ptr_on_device(), aType, lda,
+                                                      (const void**)dB.ptr_on_device(), bType, ldb,
+                                                      h_beta, (void**)dC.ptr_on_device(), cType,
+                                                      bad_ldc, 1, group_size, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    if(arg.bad_arg_all)
+    {
+        // the cuBLAS backend leaves operation checks to cuBLAS
+        EXPECT_HIPBLAS_STATUS(hipblasGemmGroupedBatchedEx(handle, bad_trans, transB, M, N, K,
+                                                          h_alpha,
+                                                          (const void**)dA.ptr_on_device(), aType,
+                                                          lda,
+                                                          (const void**)dB.ptr_on_device(), bType,
+                                                          ldb, h_beta,
+                                                          (void**)dC.ptr_on_device(), cType, ldc,
+                                                          1, group_size, computeType),
+                              HIPBLAS_STATUS_INVALID_ENUM);
+    }
+
+    // an empty list of groups is a no-op
+    CHECK_HIPBLAS_ERROR(hipblasGemmGroupedBatchedEx(handle, transA, transB, M, N, K, nullptr,
+                                                    nullptr, aType, lda, nullptr, bType, ldb,
+                                                    nullptr, nullptr, cType, ldc, 0, group_size,
+                                                    computeType));
+
+    // clang-format on
+#endif
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_grouped_batched_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+
+    hipDataType          a_type       = arg.a_type;
+    hipDataType          b_type       = arg.b_type;
+    hipDataType          c_type       = arg.c_type;
+    hipblasComputeType_t compute_type = arg.compute_type_gemm;
+
+    Tex h_alpha_Tex = arg.get_alpha<Tex>();
+    Tex h_beta_Tex  = arg.get_beta<Tex>();
+
+    int batch_count = arg.batch_count;
+
+    hipblasLocalHandle handle(arg);
+
+    // check here to prevent undefined memory allocation error
+    int  A_row0       = transA == HIPBLAS_OP_N ? arg.M : arg.K;
+    int  B_row0       = transB == HIPBLAS_OP_N ? arg.K : arg.N;
+    bool invalid_size = arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.lda < A_row0
+                        || arg.ldb < B_row0 || arg.ldc < arg.M || batch_count < 0;
+    if(invalid_size || !arg.M || !arg.N || !batch_count)
+        return;
+
+    // The first two groups have the same problem so that the AMD backend runs them as
+    // one batch, the third has a different size and the last one is empty.
+    const int group_count = 4;
+
+    std::vector<hipblasOperation_t> transa_array(group_count, transA);
+    std::vector<hipblasOperation_t> transb_array(group_count, transB);
+    std::vector<int>                m_array{arg.M, arg.M, arg.M + 1, arg.M};
+    std::vector<int>                n_array{arg.N, arg.N, arg.N + 2, arg.N};
+    std::vector<int>                k_array{arg.K, arg.K, arg.K + 3, arg.K};
+    std::vector<int>                lda_array(group_count);
+    std::vector<int>                ldb_array(group_count);
+    std::vector<int>                ldc_array(group_count);
+    std::vector<int>                group_size{batch_count, 1, 2, 0};
+    std::vector<Tex>                alpha_array(group_count, h_alpha_Tex);
+    std::vector<Tex>                beta_array(group_count, h_beta_Tex);
+
+    std::vector<std::unique_ptr<host_batch_matrix<Ti>>>   hA(group_count), hB(group_count);
+    std::vector<std::unique_ptr<host_batch_matrix<To>>>   hC(group_count), hC_gold(group_count);
+    std::vector<std::unique_ptr<device_batch_matrix<Ti>>> dA(group_count), dB(group_count);
+    std::vector<std::unique_ptr<device_batch_matrix<To>>> dC(group_count);
+
+    std::vector<const void*> A_ptrs, B_ptrs;
+    std::vector<void*>       C_ptrs;
+
+    for(int g = 0; g < group_count; g++)
+    {
+        int A_row = transA == HIPBLAS_OP_N ? m_array[g] : k_array[g];
+        int A_col = transA == HIPBLAS_OP_N ? k_array[g] : m_array[g];
+        int B_row = transB == HIPBLAS_OP_N ? k_array[g] : n_array[g];
+        int B_col = transB == HIPBLAS_OP_N ? n_array[g] : k_array[g];
+
+        lda_array[g] = std::max<int64_t>(arg.lda, A_row);
+        ldb_array[g] = std::max<int64_t>(arg.ldb, B_row);
+        ldc_array[g] = std::max<int64_t>(arg.ldc, m_array[g]);
+
+        hA[g] = std::make_unique<host_batch_matrix<Ti>>(A_row, A_col, lda_array[g], group_size[g]);
+        hB[g] = std::make_unique<host_batch_matrix<Ti>>(B_row, B_col, ldb_array[g], group_size[g]);
+        hC[g] = std::make_unique<host_batch_matrix<To>>(
+            m_array[g], n_array[g], ldc_array[g], group_size[g]);
+        hC_gold[g] = std::make_unique<host_batch_matrix<To>>(
+            m_array[g], n_array[g], ldc_array[g], group_size[g]);
+        dA[g] = std::make_unique<device_batch_matrix<Ti>>(
+            A_row, A_col, lda_array[g], group_size[g]);
+        dB[g] = std::make_unique<device_batch_matrix<Ti>>(
+            B_row, B_col, ldb_array[g], group_size[g]);
+        dC[g] = std::make_unique<device_batch_matrix<To>>(
+            m_array[g], n_array[g], ldc_array[g], group_size[g]);
+
+        if(!group_size[g])
+            continue;
+
+        CHECK_HIP_ERROR(hA[g]->memcheck());
+        CHECK_HIP_ERROR(hB[g]->memcheck());
+        CHECK_HIP_ERROR(hC[g]->memcheck());
+        CHECK_HIP_ERROR(hC_gold[g]->memcheck());
+        CHECK_DEVICE_ALLOCATION(dA[g]->memcheck());
+        CHECK_DEVICE_ALLOCATION(dB[g]->memcheck());
+        CHECK_DEVICE_ALLOCATION(dC[g]->memcheck());
+
+        hipblas_init_matrix(
+            *hA[g], arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+        hipblas_init_matrix(
+            *hB[g], arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+        hipblas_init_matrix(*hC[g], arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+        hC_gold[g]->copy_from(*hC[g]);
+
+        CHECK_HIP_ERROR(dA[g]->transfer_from(*hA[g]));
+        CHECK_HIP_ERROR(dB[g]->transfer_from(*hB[g]));
+        CHECK_HIP_ERROR(dC[g]->transfer_from(*hC[g]));
+
+        for(int b = 0; b < group_size[g]; b++)
+        {
+            A_ptrs.push_back((*dA[g])[b]);
+            B_ptrs.push_back((*dB[g])[b]);
+            C_ptrs.push_back((*dC[g])[b]);
+
+            ref_gemm<Ti, To, Tex>(transA,
+                                  transB,
+                                  m_array[g],
+                                  n_array[g],
+                                  k_array[g],
+                                  h_alpha_Tex,
+                                  (*hA[g])[b],
+                                  lda_array[g],
+                                  (*hB[g])[b],
+                                  ldb_array[g],
+                                  h_beta_Tex,
+                                  (*hC_gold[g])[b],
+                                  ldc_array[g]);
+        }
+    }
+
+    // the pointer arrays of all the groups are concatenated on the device
+    hipblas_unique_ptr dA_ptrs(hipblas::device_malloc(sizeof(void*) * A_ptrs.size()),
+                               hipblas::device_free);
+    hipblas_unique_ptr dB_ptrs(hipblas::device_malloc(sizeof(void*) * B_ptrs.size()),
+                               hipblas::device_free);
+    hipblas_unique_ptr dC_ptrs(hipblas::device_malloc(sizeof(void*) * C_ptrs.size()),
+                               hipblas::device_free);
+    CHECK_HIP_ERROR(hipMemcpy(
+        dA_ptrs.get(), A_ptrs.data(), sizeof(void*) * A_ptrs.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dB_ptrs.get(), B_ptrs.data(), sizeof(void*) * B_ptrs.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dC_ptrs.get(), C_ptrs.data(), sizeof(void*) * C_ptrs.size(), hipMemcpyHostToDevice));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasGemmGroupedBatchedEx(handle,
+                                                    transa_array.data(),
+                                                    transb_array.data(),
+                                                    m_array.data(),
+                                                    n_array.data(),
+                                                    k_array.data(),
+                                                    alpha_array.data(),
+                                                    (const void* const*)dA_ptrs.get(),
+                                                    a_type,
+                                                    lda_array.data(),
+                                                    (const void* const*)dB_ptrs.get(),
+                                                    b_type,
+                                                    ldb_array.data(),
+                                                    beta_array.data(),
+                                                    (void* const*)dC_ptrs.get(),
+                                                    c_type,
+                                                    ldc_array.data(),
+                                                    group_count,
+                                                    group_size.data(),
+                                                    compute_type));
+
+    for(int g = 0; g < group_count; g++)
+    {
+        if(!group_size[g])
+            continue;
+
+        CHECK_HIP_ERROR(hC[g]->transfer_from(*dC[g]));
+        unit_check_general<To>(
+            m_array[g], n_array[g], group_size[g], ldc_array[g], *hC_gold[g], *hC[g]);
+    }
+#endif
+}
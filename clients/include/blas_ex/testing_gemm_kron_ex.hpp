@@ -0,0 +1,282 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmKronExModel = ArgumentModel<e_a_type,
+                                             e_c_type,
+                                             e_compute_type,
+                                             e_transA,
+                                             e_transB,
+                                             e_M,
+                                             e_N,
+                                             e_KL,
+                                             e_KU,
+                                             e_K,
+                                             e_alpha,
+                                             e_lda,
+                                             e_ldb,
+                                             e_beta,
+                                             e_ldc,
+                                             e_ldd>;
+
+inline void testname_gemm_kron_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmKronExModel{}.test_name(arg, name);
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_kron_ex_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType          aType       = arg.a_type;
+    hipDataType          bType       = arg.b_type;
+    hipDataType          xType       = arg.a_type;
+    hipDataType          yType       = arg.c_type;
+    hipblasComputeType_t computeType = arg.compute_type_gemm;
+
+    int m1 = 5, n1 = 6, m2 = 7, n2 = 8, K = 9, lda = 10, ldb = 11, ldx = 50, ldy = 40;
+
+    hipblasOperation_t transA = HIPBLAS_OP_N;
+    hipblasOperation_t transB = HIPBLAS_OP_N;
+
+    device_matrix<Ti> dA(m1, n1, lda);
+    device_matrix<Ti> dB(m2, n2, ldb);
+    device_matrix<Ti> dX(n1 * n2, K, ldx);
+    device_matrix<To> dY(m1 * m2, K, ldy);
+
+    Tex h_alpha(1), h_beta(2);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmKronEx(nullptr, transA, transB, m1, n1, m2, n2, K, &h_alpha,
+                              dA, aType, lda, dB, bType, ldb, dX, xType, ldx, &h_beta, dY, yType,
+                              ldy, computeType),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmKronEx(handle, transA, transB, m1, n1, m2, -1, K, &h_alpha,
+                              dA, aType, lda, dB, bType, ldb, dX, xType, ldx, &h_beta, dY, yType,
+                              ldy, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmKronEx(handle, transA, transB, m1, n1, m2, n2, K, &h_alpha,
+                              dA, aType, lda, dB, bType, m2 - 1, dX, xType, ldx, &h_beta, dY,
+                              yType, ldy, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmKronEx(handle, transA, transB, m1, n1, m2, n2, K, &h_alpha,
+                              dA, aType, lda, dB, bType, ldb, dX, xType, n1 * n2 - 1, &h_beta,
+                              dY, yType, ldy, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmKronEx(handle, transA, transB, m1, n1, m2, n2, K, &h_alpha,
+                              dA, aType, lda, dB, bType, ldb, dX, xType, ldx, &h_beta, dY, yType,
+                              m1 * m2 - 1, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmKronEx(handle, transA, transB, m1, n1, m2, n2, K, &h_alpha,
+                              dA, aType, lda, nullptr, bType, ldb, dX, xType, ldx, &h_beta, dY,
+                              yType, ldy, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmKronEx(handle, transA, transB, m1, n1, m2, n2, K, &h_alpha,
+                              dA, aType, lda, dB, bType, ldb, dX, xType, ldx, &h_beta, nullptr,
+                              yType, ldy, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // A, B and X must be of the same type
+    EXPECT_HIPBLAS_STATUS(hipblasGemmKronEx(handle, transA, transB, m1, n1, m2, n2, K, &h_alpha,
+                              dA, aType, lda, dB, bType, ldb, dX, HIP_R_8I, ldx, &h_beta, dY,
+                              yType, ldy, computeType),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // If m1 * m2 == 0 || K == 0, can have nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasGemmKronEx(handle, transA, transB, m1, n1, m2, n2, 0, nullptr,
+                            nullptr, aType, lda, nullptr, bType, ldb, nullptr, xType, ldx,
+                            nullptr, nullptr, yType, ldy, computeType));
+
+    // clang-format on
+#endif
+}
+
+// the product of entries of A and B, through float for half and bfloat16
+template <typename T>
+inline T gemm_kron_mul(const T& a, const T& b)
+{
+    return a * b;
+}
+
+inline hipblasHalf gemm_kron_mul(const hipblasHalf& a, const hipblasHalf& b)
+{
+    return float_to_half(half_to_float(a) * half_to_float(b));
+}
+
+inline hipblasBfloat16 gemm_kron_mul(const hipblasBfloat16& a, const hipblasBfloat16& b)
+{
+    return float_to_bfloat16(bfloat16_to_float(a) * bfloat16_to_float(b));
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_kron_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int                m1     = arg.M;
+    int                n1     = arg.N;
+    int                m2     = arg.KL;
+    int                n2     = arg.KU;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+    int                ldx    = arg.ldc;
+    int                ldy    = arg.ldd;
+
+    hipDataType          a_type       = arg.a_type;
+    hipDataType          b_type       = arg.b_type;
+    hipDataType          y_type       = arg.c_type;
+    hipblasComputeType_t compute_type = arg.compute_type_gemm;
+
+    Tex h_alpha = arg.get_alpha<Tex>();
+    Tex h_beta  = arg.get_beta<Tex>();
+
+    int A_row = transA == HIPBLAS_OP_N ? m1 : n1;
+    int A_col = transA == HIPBLAS_OP_N ? n1 : m1;
+    int B_row = transB == HIPBLAS_OP_N ? m2 : n2;
+    int B_col = transB == HIPBLAS_OP_N ? n2 : m2;
+    int X_row = n1 * n2;
+    int Y_row = m1 * m2;
+
+    hipblasLocalHandle handle(arg);
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = m1 < 0 || n1 < 0 || m2 < 0 || n2 < 0 || K < 0 || lda < A_row
+                        || ldb < B_row || ldx < X_row || ldy < Y_row;
+    if(invalid_size || !Y_row || !K)
+        return;
+
+    host_matrix<Ti> hA(A_row, A_col, lda);
+    host_matrix<Ti> hB(B_row, B_col, ldb);
+    host_matrix<Ti> hX(X_row, K, ldx);
+    host_matrix<Ti> hAB(Y_row, X_row, Y_row);
+    host_matrix<To> hY(Y_row, K, ldy);
+    host_matrix<To> hY_device(Y_row, K, ldy);
+    host_matrix<To> hY_gold(Y_row, K, ldy);
+
+    device_matrix<Ti>  dA(A_row, A_col, lda);
+    device_matrix<Ti>  dB(B_row, B_col, ldb);
+    device_matrix<Ti>  dX(X_row, K, ldx);
+    device_matrix<To>  dY(Y_row, K, ldy);
+    device_vector<Tex> d_alpha(1), d_beta(1);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dX.memcheck());
+    CHECK_DEVICE_ALLOCATION(dY.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix);
+    hipblas_init_matrix(
+        hX, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+    hipblas_init_matrix(hY, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dX.transfer_from(hX));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Tex), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(Tex), hipMemcpyHostToDevice));
+
+    // CPU BLAS, on op(A) kron op(B) formed explicitly, with row i1 * m2 + i2 and column
+    // j1 * n2 + j2 holding op(A)(i1, j1) * op(B)(i2, j2)
+    auto op = [](hipblasOperation_t trans, const Ti* M, int ld, int i, int j) {
+        if(trans == HIPBLAS_OP_N)
+            return M[i + size_t(j) * ld];
+        Ti m = M[j + size_t(i) * ld];
+        return trans == HIPBLAS_OP_C ? hipblas_conjugate(m) : m;
+    };
+    Ti* AB = hAB;
+    for(int j1 = 0; j1 < n1; j1++)
+        for(int j2 = 0; j2 < n2; j2++)
+            for(int i1 = 0; i1 < m1; i1++)
+                for(int i2 = 0; i2 < m2; i2++)
+                    AB[i1 * m2 + i2 + size_t(j1 * n2 + j2) * Y_row]
+                        = gemm_kron_mul(op(transA, hA, lda, i1, j1), op(transB, hB, ldb, i2, j2));
+
+    hY_gold = hY;
+    ref_gemm<Ti, To, Tex>(HIPBLAS_OP_N,
+                          HIPBLAS_OP_N,
+                          Y_row,
+                          K,
+                          X_row,
+                          h_alpha,
+                          hAB,
+                          Y_row,
+                          hX,
+                          ldx,
+                          h_beta,
+                          hY_gold,
+                          ldy);
+
+    for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
+    {
+        bool host = pointer_mode == HIPBLAS_POINTER_MODE_HOST;
+
+        CHECK_HIP_ERROR(dY.transfer_from(hY));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, pointer_mode));
+        CHECK_HIPBLAS_ERROR(hipblasGemmKronEx(handle,
+                                              transA,
+                                              transB,
+                                              m1,
+                                              n1,
+                                              m2,
+                                              n2,
+                                              K,
+                                              host ? &h_alpha : d_alpha,
+                                              dA,
+                                              a_type,
+                                              lda,
+                                              dB,
+                                              b_type,
+                                              ldb,
+                                              dX,
+                                              a_type,
+                                              ldx,
+                                              host ? &h_beta : d_beta,
+                                              dY,
+                                              y_type,
+                                              ldy,
+                                              compute_type));
+        CHECK_HIP_ERROR(hY_device.transfer_from(dY));
+
+        unit_check_general<To>(Y_row, K, ldy, hY_gold, hY_device);
+    }
+#endif
+}
@@ -0,0 +1,244 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "utility.h"
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <typeinfo>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmPlanModel = ArgumentModel<e_a_type,
+                                           e_c_type,
+                                           e_compute_type,
+                                           e_transA,
+                                           e_transB,
+                                           e_M,
+                                           e_N,
+                                           e_K,
+                                           e_alpha,
+                                           e_lda,
+                                           e_ldb,
+                                           e_beta,
+                                           e_ldc,
+                                           e_batch_count>;
+
+inline void testname_gemm_plan(const Arguments& arg, std::string& name)
+{
+    hipblasGemmPlanModel{}.test_name(arg, name);
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_plan_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType          aType       = arg.a_type;
+    hipDataType          bType       = arg.b_type;
+    hipDataType          cType       = arg.c_type;
+    hipblasComputeType_t computeType = arg.compute_type_gemm;
+    hipblasGemmFlags_t   flags       = HIPBLAS_GEMM_FLAGS_NONE;
+
+    int M   = 101;
+    int N   = 100;
+    int K   = 102;
+    int lda = 103;
+    int ldb = 104;
+    int ldc = 105;
+
+    hipblasStride strideA = hipblasStride(lda) * K;
+    hipblasStride strideB = hipblasStride(ldb) * N;
+    hipblasStride strideC = hipblasStride(ldc) * N;
+
+    hipblasOperation_t transA = HIPBLAS_OP_N;
+    hipblasOperation_t transB = HIPBLAS_OP_N;
+
+    hipblasGemmPlan_t plan = nullptr;
+    Tex               h_alpha(1), h_beta(2);
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmPlanCreate(nullptr, &plan, transA, transB, M, N, K,
+                                                aType, lda, strideA, bType, ldb, strideB,
+                                                cType, ldc, strideC, 1, computeType, flags, 0),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmPlanCreate(handle, nullptr, transA, transB, M, N, K,
+                                                aType, lda, strideA, bType, ldb, strideB,
+                                                cType, ldc, strideC, 1, computeType, flags, 0),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmPlanCreate(handle, &plan,
+                                                (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                                                transB, M, N, K,
+                                                aType, lda, strideA, bType, ldb, strideB,
+                                                cType, ldc, strideC, 1, computeType, flags, 0),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_EQ(plan, nullptr);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmPlanCreate(handle, &plan, transA, transB, M, N, K,
+                                                aType, M - 1, strideA, bType, ldb, strideB,
+                                                cType, ldc, strideC, 1, computeType, flags, 0),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(plan, nullptr);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmPlanExecute(handle, nullptr, &h_alpha, nullptr, nullptr,
+                                                 &h_beta, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // clang-format on
+
+    CHECK_HIPBLAS_ERROR(hipblasGemmPlanDestroy(nullptr));
+#endif
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_plan(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                lda         = arg.lda;
+    int                ldb         = arg.ldb;
+    int                ldc         = arg.ldc;
+    int                batch_count = arg.batch_count;
+
+    hipDataType          a_type       = arg.a_type;
+    hipDataType          b_type       = arg.b_type;
+    hipDataType          c_type       = arg.c_type;
+    hipblasComputeType_t compute_type = arg.compute_type_gemm;
+    hipblasGemmFlags_t   flags        = hipblasGemmFlags_t(arg.flags);
+
+    Tex h_alpha_Tex = arg.get_alpha<Tex>();
+    Tex h_beta_Tex  = arg.get_beta<Tex>();
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    hipblasStride stride_A = hipblasStride(lda) * A_col;
+    hipblasStride stride_B = hipblasStride(ldb) * B_col;
+    hipblasStride stride_C = hipblasStride(ldc) * N;
+
+    hipblasLocalHandle handle(arg);
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size
+        = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+        return;
+
+    host_strided_batch_matrix<Ti> hA(A_row, A_col, lda, stride_A, batch_count);
+    host_strided_batch_matrix<Ti> hB(B_row, B_col, ldb, stride_B, batch_count);
+    host_strided_batch_matrix<To> hC(M, N, ldc, stride_C, batch_count);
+    host_strided_batch_matrix<To> hC_device(M, N, ldc, stride_C, batch_count);
+    host_strided_batch_matrix<To> hC_gold(M, N, ldc, stride_C, batch_count);
+
+    device_strided_batch_matrix<Ti> dA(A_row, A_col, lda, stride_A, batch_count);
+    device_strided_batch_matrix<Ti> dB(B_row, B_col, ldb, stride_B, batch_count);
+    device_strided_batch_matrix<To> dC(M, N, ldc, stride_C, batch_count);
+
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(
+        hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+    hipblas_init_matrix(hC, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+    hC_gold.copy_from(hC);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(int b = 0; b < batch_count; b++)
+    {
+        ref_gemm<Ti, To, Tex>(transA,
+                              transB,
+                              M,
+                              N,
+                              K,
+                              h_alpha_Tex,
+                              hA[b],
+                              lda,
+                              hB[b],
+                              ldb,
+                              h_beta_Tex,
+                              hC_gold[b],
+                              ldc);
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    hipblasGemmPlan_t plan = nullptr;
+    CHECK_HIPBLAS_ERROR(hipblasGemmPlanCreate(handle,
+                                              &plan,
+                                              transA,
+                                              transB,
+                                              M,
+                                              N,
+                                              K,
+                                              a_type,
+                                              lda,
+                                              stride_A,
+                                              b_type,
+                                              ldb,
+                                              stride_B,
+                                              c_type,
+                                              ldc,
+                                              stride_C,
+                                              batch_count,
+                                              compute_type,
+                                              flags,
+                                              0));
+
+    // the same plan must give the same result each time it is executed
+    for(int iter = 0; iter < 2; iter++)
+    {
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        CHECK_HIPBLAS_ERROR(
+            hipblasGemmPlanExecute(handle, plan, &h_alpha_Tex, dA, dB, &h_beta_Tex, dC));
+        CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+
+        unit_check_general<To>(M, N, batch_count, ldc, stride_C, hC_gold, hC_device);
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasGemmPlanDestroy(plan));
+#endif
+}
@@ -0,0 +1,237 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+#include <complex>
+
+/* ============================================================================================ */
+
+using hipblasGemmPlanarComplexExModel = ArgumentModel<e_a_type,
+                                                      e_transA,
+                                                      e_transB,
+                                                      e_M,
+                                                      e_N,
+                                                      e_K,
+                                                      e_alpha,
+                                                      e_lda,
+                                                      e_ldb,
+                                                      e_beta,
+                                                      e_ldc>;
+
+inline void testname_gemm_planar_complex_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmPlanarComplexExModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_gemm_planar_complex_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    if constexpr(std::is_same_v<T, float> || std::is_same_v<T, double>)
+    {
+        using Tc                       = std::complex<T>;
+        constexpr bool       is_double = std::is_same_v<T, double>;
+        hipDataType          type      = is_double ? HIP_R_64F : HIP_R_32F;
+        hipblasComputeType_t ct        = is_double ? HIPBLAS_COMPUTE_64F : HIPBLAS_COMPUTE_32F;
+
+        hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+        hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+        int                M      = arg.M;
+        int                N      = arg.N;
+        int                K      = arg.K;
+        int                lda    = arg.lda;
+        int                ldb    = arg.ldb;
+        int                ldc    = arg.ldc;
+        Tc                 alpha(arg.alpha, arg.alphai);
+        Tc                 beta(arg.beta, arg.betai);
+
+        int A_row = transA == HIPBLAS_OP_N ? M : K;
+        int A_col = transA == HIPBLAS_OP_N ? K : M;
+        int B_row = transB == HIPBLAS_OP_N ? K : N;
+        int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+        hipblasLocalHandle handle(arg);
+
+        EXPECT_HIPBLAS_STATUS(hipblasGemmPlanarComplexEx(nullptr,
+                                                         transA,
+                                                         transB,
+                                                         M,
+                                                         N,
+                                                         K,
+                                                         nullptr,
+                                                         nullptr,
+                                                         nullptr,
+                                                         type,
+                                                         lda,
+                                                         nullptr,
+                                                         nullptr,
+                                                         type,
+                                                         ldb,
+                                                         nullptr,
+                                                         nullptr,
+                                                         nullptr,
+                                                         type,
+                                                         ldc,
+                                                         ct),
+                              HIPBLAS_STATUS_NOT_INITIALIZED);
+
+        bool invalid_size = M < 0 || N < 0 || K < 0 || lda < std::max(A_row, 1)
+                            || ldb < std::max(B_row, 1) || ldc < std::max(M, 1);
+        if(invalid_size || !M || !N)
+        {
+            EXPECT_HIPBLAS_STATUS(hipblasGemmPlanarComplexEx(handle,
+                                                             transA,
+                                                             transB,
+                                                             M,
+                                                             N,
+                                                             K,
+                                                             nullptr,
+                                                             nullptr,
+                                                             nullptr,
+                                                             type,
+                                                             lda,
+                                                             nullptr,
+                                                             nullptr,
+                                                             type,
+                                                             ldb,
+                                                             nullptr,
+                                                             nullptr,
+                                                             nullptr,
+                                                             type,
+                                                             ldc,
+                                                             ct),
+                                  invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                               : HIPBLAS_STATUS_SUCCESS);
+            return;
+        }
+
+        size_t size_A = size_t(lda) * A_col, size_B = size_t(ldb) * B_col;
+        size_t size_C = size_t(ldc) * N;
+
+        // small integers, so the products are exact with either algorithm
+        host_vector<T> hAr(size_A), hAi(size_A), hBr(size_B), hBi(size_B);
+        host_vector<T> hCr(size_C), hCi(size_C), hCr_device(size_C), hCi_device(size_C);
+        for(size_t i = 0; i < size_A; i++)
+        {
+            hAr[i] = T(i % 7) - 3;
+            hAi[i] = T(i % 5) - 2;
+        }
+        for(size_t i = 0; i < size_B; i++)
+        {
+            hBr[i] = T(i % 5) - 2;
+            hBi[i] = T(i % 3) - 1;
+        }
+        for(size_t i = 0; i < size_C; i++)
+        {
+            hCr[i] = T(i % 3);
+            hCi[i] = T(i % 4) - 2;
+        }
+
+        // the reference computed on interleaved complex values
+        auto op = [](hipblasOperation_t trans, const T* Xr, const T* Xi, int ldx, int i, int j) {
+            size_t x = trans == HIPBLAS_OP_N ? i + size_t(j) * ldx : j + size_t(i) * ldx;
+            return Tc(Xr[x], trans == HIPBLAS_OP_C ? -Xi[x] : Xi[x]);
+        };
+        host_vector<Tc> hC_gold(size_C);
+        for(int j = 0; j < N; j++)
+        {
+            for(int i = 0; i < M; i++)
+            {
+                Tc w = 0;
+                for(int l = 0; l < K; l++)
+                    w += op(transA, hAr, hAi, lda, i, l) * op(transB, hBr, hBi, ldb, l, j);
+                size_t c   = i + size_t(j) * ldc;
+                hC_gold[c] = alpha * w + beta * Tc(hCr[c], hCi[c]);
+            }
+        }
+
+        device_vector<T>  dAr(size_A), dAi(size_A), dBr(size_B), dBi(size_B);
+        device_vector<T>  dCr(size_C), dCi(size_C);
+        device_vector<Tc> d_alpha(1), d_beta(1);
+        CHECK_DEVICE_ALLOCATION(dAr.memcheck());
+        CHECK_DEVICE_ALLOCATION(dAi.memcheck());
+        CHECK_DEVICE_ALLOCATION(dBr.memcheck());
+        CHECK_DEVICE_ALLOCATION(dBi.memcheck());
+        CHECK_DEVICE_ALLOCATION(dCr.memcheck());
+        CHECK_DEVICE_ALLOCATION(dCi.memcheck());
+
+        CHECK_HIP_ERROR(dAr.transfer_from(hAr));
+        CHECK_HIP_ERROR(dAi.transfer_from(hAi));
+        CHECK_HIP_ERROR(dBr.transfer_from(hBr));
+        CHECK_HIP_ERROR(dBi.transfer_from(hBi));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(Tc), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(Tc), hipMemcpyHostToDevice));
+
+        // the four real products and the 3M algorithm, in both pointer modes
+        for(hipblasMath_t math : {HIPBLAS_DEFAULT_MATH, HIPBLAS_GEMM_3M_MATH})
+        {
+            for(hipblasPointerMode_t mode :
+                {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
+            {
+                bool device_mode = mode == HIPBLAS_POINTER_MODE_DEVICE;
+                CHECK_HIP_ERROR(dCr.transfer_from(hCr));
+                CHECK_HIP_ERROR(dCi.transfer_from(hCi));
+                CHECK_HIPBLAS_ERROR(hipblasSetMathMode(handle, math));
+                CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, mode));
+                CHECK_HIPBLAS_ERROR(
+                    hipblasGemmPlanarComplexEx(handle,
+                                               transA,
+                                               transB,
+                                               M,
+                                               N,
+                                               K,
+                                               device_mode ? (Tc*)d_alpha : &alpha,
+                                               dAr,
+                                               dAi,
+                                               type,
+                                               lda,
+                                               dBr,
+                                               dBi,
+                                               type,
+                                               ldb,
+                                               device_mode ? (Tc*)d_beta : &beta,
+                                               dCr,
+                                               dCi,
+                                               type,
+                                               ldc,
+                                               ct));
+
+                hipblasPointerMode_t mode_after;
+                CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(handle, &mode_after));
+                EXPECT_EQ(mode_after, mode);
+
+                CHECK_HIP_ERROR(hCr_device.transfer_from(dCr));
+                CHECK_HIP_ERROR(hCi_device.transfer_from(dCi));
+                for(int j = 0; j < N; j++)
+                    for(int i = 0; i < M; i++)
+                    {
+                        size_t c = i + size_t(j) * ldc;
+                        EXPECT_EQ(hCr_device[c], hC_gold[c].real());
+                        EXPECT_EQ(hCi_device[c], hC_gold[c].imag());
+                    }
+            }
+        }
+        CHECK_HIPBLAS_ERROR(hipblasSetMathMode(handle, HIPBLAS_DEFAULT_MATH));
+    }
+#endif
+}
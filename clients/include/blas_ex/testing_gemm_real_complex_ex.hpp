@@ -0,0 +1,300 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+#include <complex>
+
+/* ============================================================================================ */
+
+using hipblasGemmRealComplexExModel = ArgumentModel<e_a_type,
+                                                    e_transA,
+                                                    e_transB,
+                                                    e_M,
+                                                    e_N,
+                                                    e_K,
+                                                    e_alpha,
+                                                    e_lda,
+                                                    e_ldb,
+                                                    e_beta,
+                                                    e_ldc,
+                                                    e_batch_count>;
+
+inline void testname_gemm_real_complex_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmRealComplexExModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_gemm_real_complex_ex_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    int M = 101, N = 100, K = 102, lda = 103, ldb = 104, ldc = 105;
+
+    hipblasOperation_t   transA = HIPBLAS_OP_N;
+    hipblasOperation_t   transB = HIPBLAS_OP_N;
+    hipDataType          rType  = HIP_R_32F;
+    hipDataType          cType  = HIP_C_32F;
+    hipblasComputeType_t ct     = HIPBLAS_COMPUTE_32F;
+    std::complex<float>  alpha = 1, beta = 0;
+
+    device_vector<float>               dA(size_t(lda) * K);
+    device_vector<std::complex<float>> dB(size_t(ldb) * N);
+    device_vector<std::complex<float>> dC(size_t(ldc) * N);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmRealComplexEx(nullptr, transA, transB, M, N, K, &alpha, dA,
+                                                   rType, lda, dB, cType, ldb, &beta, dC, cType,
+                                                   ldc, ct),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmRealComplexEx(handle, hipblasOperation_t(0), transB, M, N, K,
+                                                   &alpha, dA, rType, lda, dB, cType, ldb, &beta,
+                                                   dC, cType, ldc, ct),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmRealComplexEx(handle, transA, transB, M, N, K, &alpha, dA,
+                                                   rType, M - 1, dB, cType, ldb, &beta, dC, cType,
+                                                   ldc, ct),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmRealComplexEx(handle, transA, transB, M, N, K, &alpha, dA,
+                                                   rType, lda, dB, cType, ldb, &beta, dC, cType,
+                                                   M - 1, ct),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmRealComplexEx(handle, transA, transB, M, N, K, nullptr, dA,
+                                                   rType, lda, dB, cType, ldb, &beta, dC, cType,
+                                                   ldc, ct),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmRealComplexEx(handle, transA, transB, M, N, K, &alpha,
+                                                   nullptr, rType, lda, dB, cType, ldb, &beta, dC,
+                                                   cType, ldc, ct),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // both operands real, both complex, or precisions that differ
+    EXPECT_HIPBLAS_STATUS(hipblasGemmRealComplexEx(handle, transA, transB, M, N, K, &alpha, dA,
+                                                   rType, lda, dB, rType, ldb, &beta, dC, cType,
+                                                   ldc, ct),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmRealComplexEx(handle, transA, transB, M, N, K, &alpha, dA,
+                                                   cType, lda, dB, cType, ldb, &beta, dC, cType,
+                                                   ldc, ct),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmRealComplexEx(handle, transA, transB, M, N, K, &alpha, dA,
+                                                   rType, lda, dB, HIP_C_64F, ldb, &beta, dC,
+                                                   cType, ldc, ct),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // With M == 0, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasGemmRealComplexEx(handle, transA, transB, 0, N, K, nullptr, nullptr,
+                                                 rType, lda, nullptr, cType, ldb, nullptr, nullptr,
+                                                 cType, ldc, ct));
+
+    // clang-format on
+#endif
+}
+
+template <typename T>
+void testing_gemm_real_complex_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    if constexpr(std::is_same_v<T, float> || std::is_same_v<T, double>)
+    {
+        using Tc                       = std::complex<T>;
+        constexpr bool       is_double = std::is_same_v<T, double>;
+        hipDataType          rType     = is_double ? HIP_R_64F : HIP_R_32F;
+        hipDataType          cType     = is_double ? HIP_C_64F : HIP_C_32F;
+        hipblasComputeType_t ct        = is_double ? HIPBLAS_COMPUTE_64F : HIPBLAS_COMPUTE_32F;
+
+        hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+        hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+        int                M           = arg.M;
+        int                N           = arg.N;
+        int                K           = arg.K;
+        int                lda         = arg.lda;
+        int                ldb         = arg.ldb;
+        int                ldc         = arg.ldc;
+        int                batch_count = arg.batch_count;
+        Tc                 alpha(arg.alpha, arg.alphai);
+        Tc                 beta(arg.beta, arg.betai);
+
+        int A_row = transA == HIPBLAS_OP_N ? M : K;
+        int A_col = transA == HIPBLAS_OP_N ? K : M;
+        int B_row = transB == HIPBLAS_OP_N ? K : N;
+        int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+        hipblasLocalHandle handle(arg);
+
+        bool invalid_size = M < 0 || N < 0 || K < 0 || batch_count < 0 || lda < std::max(A_row, 1)
+                            || ldb < std::max(B_row, 1) || ldc < std::max(M, 1);
+        if(invalid_size || !M || !N || !batch_count)
+        {
+            EXPECT_HIPBLAS_STATUS(hipblasGemmRealComplexStridedBatchedEx(handle,
+                                                                         transA,
+                                                                         transB,
+                                                                         M,
+                                                                         N,
+                                                                         K,
+                                                                         nullptr,
+                                                                         nullptr,
+                                                                         rType,
+                                                                         lda,
+                                                                         0,
+                                                                         nullptr,
+                                                                         cType,
+                                                                         ldb,
+                                                                         0,
+                                                                         nullptr,
+                                                                         nullptr,
+                                                                         cType,
+                                                                         ldc,
+                                                                         0,
+                                                                         batch_count,
+                                                                         ct),
+                                  invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                               : HIPBLAS_STATUS_SUCCESS);
+            return;
+        }
+
+        hipblasStride stride_A = hipblasStride(lda) * A_col;
+        hipblasStride stride_B = hipblasStride(ldb) * B_col;
+        hipblasStride stride_C = hipblasStride(ldc) * N;
+
+        // small integers, so the products are exact
+        host_vector<Tc> hA(stride_A * batch_count), hB(stride_B * batch_count);
+        host_vector<Tc> hC(stride_C * batch_count), hC_gold(stride_C * batch_count);
+        host_vector<Tc> hC_device(stride_C * batch_count);
+        for(size_t i = 0; i < hA.size(); i++)
+            hA[i] = Tc(T(i % 7) - 3, T(i % 5) - 2);
+        for(size_t i = 0; i < hB.size(); i++)
+            hB[i] = Tc(T(i % 5) - 2, T(i % 3) - 1);
+        for(size_t i = 0; i < hC.size(); i++)
+            hC[i] = Tc(T(i % 3), T(i % 4) - 2);
+
+        host_vector<T> hA_real(hA.size()), hB_real(hB.size());
+        for(size_t i = 0; i < hA.size(); i++)
+            hA_real[i] = hA[i].real();
+        for(size_t i = 0; i < hB.size(); i++)
+            hB_real[i] = hB[i].real();
+
+        device_vector<Tc> dA(hA.size()), dB(hB.size()), dC(hC.size());
+        device_vector<T>  dA_real(hA.size()), dB_real(hB.size());
+        device_vector<Tc> d_alpha(1), d_beta(1);
+        CHECK_DEVICE_ALLOCATION(dA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dB.memcheck());
+        CHECK_DEVICE_ALLOCATION(dC.memcheck());
+        CHECK_DEVICE_ALLOCATION(dA_real.memcheck());
+        CHECK_DEVICE_ALLOCATION(dB_real.memcheck());
+
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIP_ERROR(dA_real.transfer_from(hA_real));
+        CHECK_HIP_ERROR(dB_real.transfer_from(hB_real));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(Tc), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(Tc), hipMemcpyHostToDevice));
+
+        auto op = [](hipblasOperation_t trans, const Tc* X, int ldx, int i, int j) {
+            return trans == HIPBLAS_OP_N ? X[i + size_t(j) * ldx]
+                   : trans == HIPBLAS_OP_T ? X[j + size_t(i) * ldx]
+                                           : std::conj(X[j + size_t(i) * ldx]);
+        };
+
+        // A real and B complex, then A complex and B real, in both pointer modes
+        for(bool complex_a : {false, true})
+        {
+            for(int b = 0; b < batch_count; b++)
+            {
+                const Tc* A = hA.data() + b * stride_A;
+                const Tc* B = hB.data() + b * stride_B;
+                for(int j = 0; j < N; j++)
+                {
+                    for(int i = 0; i < M; i++)
+                    {
+                        Tc w = 0;
+                        for(int l = 0; l < K; l++)
+                        {
+                            Tc a = op(transA, A, lda, i, l);
+                            Tc x = op(transB, B, ldb, l, j);
+                            w += (complex_a ? a : Tc(a.real())) * (complex_a ? Tc(x.real()) : x);
+                        }
+                        size_t idx   = b * stride_C + i + size_t(j) * ldc;
+                        hC_gold[idx] = alpha * w + beta * hC[idx];
+                    }
+                }
+            }
+
+            for(hipblasPointerMode_t mode :
+                {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
+            {
+                bool device_mode = mode == HIPBLAS_POINTER_MODE_DEVICE;
+                CHECK_HIP_ERROR(dC.transfer_from(hC));
+                CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, mode));
+                CHECK_HIPBLAS_ERROR(hipblasGemmRealComplexStridedBatchedEx(
+                    handle,
+                    transA,
+                    transB,
+                    M,
+                    N,
+                    K,
+                    device_mode ? (Tc*)d_alpha : &alpha,
+                    complex_a ? (void*)dA : (void*)dA_real,
+                    complex_a ? cType : rType,
+                    lda,
+                    stride_A,
+                    complex_a ? (void*)dB_real : (void*)dB,
+                    complex_a ? rType : cType,
+                    ldb,
+                    stride_B,
+                    device_mode ? (Tc*)d_beta : &beta,
+                    dC,
+                    cType,
+                    ldc,
+                    stride_C,
+                    batch_count,
+                    ct));
+
+                hipblasPointerMode_t mode_after;
+                CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(handle, &mode_after));
+                EXPECT_EQ(mode_after, mode);
+
+                CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+                for(int b = 0; b < batch_count; b++)
+                    for(int j = 0; j < N; j++)
+                        for(int i = 0; i < M; i++)
+                        {
+                            size_t idx = b * stride_C + i + size_t(j) * ldc;
+                            EXPECT_EQ(hC_device[idx], hC_gold[idx]);
+                        }
+            }
+        }
+    }
+#endif
+}
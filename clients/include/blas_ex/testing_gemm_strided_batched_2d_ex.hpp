@@ -0,0 +1,240 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmStridedBatched2DExModel = ArgumentModel<e_a_type,
+                                                         e_c_type,
+                                                         e_compute_type,
+                                                         e_transA,
+                                                         e_transB,
+                                                         e_M,
+                                                         e_N,
+                                                         e_K,
+                                                         e_alpha,
+                                                         e_lda,
+                                                         e_ldb,
+                                                         e_beta,
+                                                         e_ldc,
+                                                         e_batch_count>;
+
+inline void testname_gemm_strided_batched_2d_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmStridedBatched2DExModel{}.test_name(arg, name);
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_strided_batched_2d_ex_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType          aType       = arg.a_type;
+    hipDataType          bType       = arg.b_type;
+    hipDataType          cType       = arg.c_type;
+    hipblasComputeType_t computeType = arg.compute_type_gemm;
+    hipblasGemmAlgo_t    algo        = HIPBLAS_GEMM_DEFAULT;
+
+    int M = 101, N = 100, K = 102, lda = 103, ldb = 104, ldc = 105;
+
+    hipblasOperation_t transA = HIPBLAS_OP_N;
+    hipblasOperation_t transB = HIPBLAS_OP_N;
+
+    device_matrix<Ti> dA(M, K, lda);
+    device_matrix<Ti> dB(K, N, ldb);
+    device_matrix<To> dC(M, N, ldc);
+
+    Tex h_alpha(1), h_beta(2);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmStridedBatched2DEx(nullptr, transA, transB, M, N, K,
+                              &h_alpha, dA, aType, lda, 0, 0, dB, bType, ldb, 0, 0, &h_beta, dC,
+                              cType, ldc, 0, 0, 2, 3, computeType, algo),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmStridedBatched2DEx(handle, transA, transB, M, N, K,
+                              &h_alpha, dA, aType, lda, 0, 0, dB, bType, ldb, 0, 0, &h_beta, dC,
+                              cType, ldc, 0, 0, -1, 3, computeType, algo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmStridedBatched2DEx(handle, transA, transB, M, N, K,
+                              &h_alpha, dA, aType, lda, 0, 0, dB, bType, ldb, 0, 0, &h_beta, dC,
+                              cType, ldc, 0, 0, 2, -1, computeType, algo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmStridedBatched2DEx(handle, transA, transB, M, N, K,
+                              &h_alpha, dA, aType, M - 1, 0, 0, dB, bType, ldb, 0, 0, &h_beta,
+                              dC, cType, ldc, 0, 1, 2, 3, computeType, algo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmStridedBatched2DEx(handle, transA, transB, M, N, K,
+                              &h_alpha, nullptr, aType, lda, 0, 0, dB, bType, ldb, 0, 0,
+                              &h_beta, dC, cType, ldc, 0, 1, 2, 3, computeType, algo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // With an empty batch, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatched2DEx(handle, transA, transB, M, N, K, nullptr,
+                            nullptr, aType, lda, 0, 0, nullptr, bType, ldb, 0, 0, nullptr,
+                            nullptr, cType, ldc, 0, 0, 2, 0, computeType, algo));
+
+    // clang-format on
+#endif
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_strided_batched_2d_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasOperation_t transA        = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB        = char2hipblas_operation(arg.transB);
+    int                M             = arg.M;
+    int                N             = arg.N;
+    int                K             = arg.K;
+    int                lda           = arg.lda;
+    int                ldb           = arg.ldb;
+    int                ldc           = arg.ldc;
+    int                batch_count_1 = arg.batch_count;
+
+    // the heads of attention
+    const int batch_count_2 = 3;
+
+    hipDataType          a_type       = arg.a_type;
+    hipDataType          b_type       = arg.b_type;
+    hipDataType          c_type       = arg.c_type;
+    hipblasComputeType_t compute_type = arg.compute_type_gemm;
+    hipblasGemmAlgo_t    algo         = HIPBLAS_GEMM_DEFAULT;
+
+    Tex h_alpha = arg.get_alpha<Tex>();
+    Tex h_beta  = arg.get_beta<Tex>();
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    hipblasLocalHandle handle(arg);
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M
+                        || batch_count_1 < 0;
+    if(invalid_size || !M || !N || !batch_count_1)
+        return;
+
+    // the problems are stored as one strided batch
+    int           count    = batch_count_1 * batch_count_2;
+    hipblasStride stride_A = hipblasStride(lda) * A_col;
+    hipblasStride stride_B = hipblasStride(ldb) * B_col;
+    hipblasStride stride_C = hipblasStride(ldc) * N;
+
+    host_strided_batch_matrix<Ti> hA(A_row, A_col, lda, stride_A, count);
+    host_strided_batch_matrix<Ti> hB(B_row, B_col, ldb, stride_B, count);
+    host_strided_batch_matrix<To> hC(M, N, ldc, stride_C, count);
+    host_strided_batch_matrix<To> hC_device(M, N, ldc, stride_C, count);
+    host_strided_batch_matrix<To> hC_gold(M, N, ldc, stride_C, count);
+
+    device_strided_batch_matrix<Ti> dA(A_row, A_col, lda, stride_A, count);
+    device_strided_batch_matrix<Ti> dB(B_row, B_col, ldb, stride_B, count);
+    device_strided_batch_matrix<To> dC(M, N, ldc, stride_C, count);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(
+        hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+    hipblas_init_matrix(hC, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // [batch, heads] order, whose strides collapse into one, then [heads, batch] order, which
+    // needs the batched gemm
+    for(bool heads_outer : {false, true})
+    {
+        hipblasStride step_1 = heads_outer ? 1 : batch_count_2;
+        hipblasStride step_2 = heads_outer ? batch_count_1 : 1;
+
+        hC_gold.copy_from(hC);
+        for(int i = 0; i < batch_count_1; i++)
+        {
+            for(int j = 0; j < batch_count_2; j++)
+            {
+                int b = int(i * step_1 + j * step_2);
+                ref_gemm<Ti, To, Tex>(transA,
+                                      transB,
+                                      M,
+                                      N,
+                                      K,
+                                      h_alpha,
+                                      hA[b],
+                                      lda,
+                                      hB[b],
+                                      ldb,
+                                      h_beta,
+                                      hC_gold[b],
+                                      ldc);
+            }
+        }
+
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatched2DEx(handle,
+                                                          transA,
+                                                          transB,
+                                                          M,
+                                                          N,
+                                                          K,
+                                                          &h_alpha,
+                                                          dA,
+                                                          a_type,
+                                                          lda,
+                                                          stride_A * step_1,
+                                                          stride_A * step_2,
+                                                          dB,
+                                                          b_type,
+                                                          ldb,
+                                                          stride_B * step_1,
+                                                          stride_B * step_2,
+                                                          &h_beta,
+                                                          dC,
+                                                          c_type,
+                                                          ldc,
+                                                          stride_C * step_1,
+                                                          stride_C * step_2,
+                                                          batch_count_1,
+                                                          batch_count_2,
+                                                          compute_type,
+                                                          algo));
+        CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+
+        unit_check_general<To>(M, N, count, ldc, stride_C, hC_gold, hC_device);
+    }
+#endif
+}
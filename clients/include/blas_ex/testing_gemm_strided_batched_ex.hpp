@@ -359,7 +359,8 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
     int64_t B_row = transB == HIPBLAS_OP_N ? K : N;
     int64_t B_col = transB == HIPBLAS_OP_N ? N : K;
 
-    const size_t stride_A = static_cast<size_t>(lda) * static_cast<size_t>(A_col);
+    // stride_scale only applies to A, so that 0 tests an A shared by the whole batch
+    const size_t stride_A = static_cast<size_t>(lda * A_col * arg.stride_scale);
     const size_t stride_B = static_cast<size_t>(ldb) * static_cast<size_t>(B_col);
     const size_t stride_C = static_cast<size_t>(ldc) * static_cast<size_t>(N);
 
@@ -437,10 +438,10 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
     double gpu_time_used, hipblas_error_host, hipblas_error_device;
 
     // Initial Data on CPU
-    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(hA, arg, 'A', hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
     hipblas_init_matrix(
-        hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
-    hipblas_init_matrix(hC_host, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+        hB, arg, 'B', hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+    hipblas_init_matrix(hC_host, arg, 'C', hipblas_client_beta_sets_nan, hipblas_general_matrix);
 
     hC_device.copy_from(hC_host);
     hC_gold.copy_from(hC_host);
@@ -575,6 +576,9 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
         CHECK_HIP_ERROR(hC_device.transfer_from(dC));
 
         // CPU BLAS
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_gemm<Ti, To, Tex>(transA,
@@ -625,11 +629,12 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             if(!arg.with_flags)
             {
@@ -686,8 +691,10 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
                                algo,
                                flags));
             }
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasGemmStridedBatchedExModel{}.log_args<To>(std::cout,
                                                         arg,
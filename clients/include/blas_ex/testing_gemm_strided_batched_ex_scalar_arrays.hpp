@@ -0,0 +1,245 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmStridedBatchedExScalarArraysModel = ArgumentModel<e_a_type,
+                                                                   e_c_type,
+                                                                   e_compute_type,
+                                                                   e_transA,
+                                                                   e_transB,
+                                                                   e_M,
+                                                                   e_N,
+                                                                   e_K,
+                                                                   e_alpha,
+                                                                   e_lda,
+                                                                   e_ldb,
+                                                                   e_beta,
+                                                                   e_ldc,
+                                                                   e_batch_count>;
+
+inline void testname_gemm_strided_batched_ex_scalar_arrays(const Arguments& arg, std::string& name)
+{
+    hipblasGemmStridedBatchedExScalarArraysModel{}.test_name(arg, name);
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_strided_batched_ex_scalar_arrays_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType          aType       = arg.a_type;
+    hipDataType          bType       = arg.b_type;
+    hipDataType          cType       = arg.c_type;
+    hipblasComputeType_t computeType = arg.compute_type_gemm;
+    hipblasGemmAlgo_t    algo        = HIPBLAS_GEMM_DEFAULT;
+
+    int M = 101, N = 100, K = 102, lda = 103, ldb = 104, ldc = 105;
+
+    hipblasOperation_t transA = HIPBLAS_OP_N;
+    hipblasOperation_t transB = HIPBLAS_OP_N;
+
+    device_matrix<Ti> dA(M, K, lda);
+    device_matrix<Ti> dB(K, N, ldb);
+    device_matrix<To> dC(M, N, ldc);
+
+    Tex h_alpha[2] = {Tex(1), Tex(2)}, h_beta[2] = {Tex(2), Tex(1)};
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmStridedBatchedExWithScalarArrays(nullptr, transA, transB, M,
+                              N, K, h_alpha, 1, dA, aType, lda, 0, dB, bType, ldb, 0, h_beta, 1,
+                              dC, cType, ldc, 0, 2, computeType, algo),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmStridedBatchedExWithScalarArrays(handle, transA, transB, M,
+                              N, K, h_alpha, -1, dA, aType, lda, 0, dB, bType, ldb, 0, h_beta, 1,
+                              dC, cType, ldc, 0, 2, computeType, algo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmStridedBatchedExWithScalarArrays(handle, transA, transB, M,
+                              N, K, nullptr, 1, dA, aType, lda, 0, dB, bType, ldb, 0, h_beta, 1,
+                              dC, cType, ldc, 0, 2, computeType, algo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // integer gemms have no scalar arrays
+    EXPECT_HIPBLAS_STATUS(hipblasGemmStridedBatchedExWithScalarArrays(handle, transA, transB, M,
+                              N, K, h_alpha, 1, dA, aType, lda, 0, dB, bType, ldb, 0, h_beta, 1,
+                              dC, HIP_R_32I, ldc, 0, 2, HIPBLAS_COMPUTE_32I, algo),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // nothing to do
+    CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedExWithScalarArrays(handle, transA, transB, M,
+                            N, K, nullptr, 1, nullptr, aType, lda, 0, nullptr, bType, ldb, 0,
+                            nullptr, 1, nullptr, cType, ldc, 0, 0, computeType, algo));
+
+    // clang-format on
+#endif
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_strided_batched_ex_scalar_arrays(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                lda         = arg.lda;
+    int                ldb         = arg.ldb;
+    int                ldc         = arg.ldc;
+    int                batch_count = arg.batch_count;
+
+    hipDataType          a_type       = arg.a_type;
+    hipDataType          b_type       = arg.b_type;
+    hipDataType          c_type       = arg.c_type;
+    hipblasComputeType_t compute_type = arg.compute_type_gemm;
+    hipblasGemmAlgo_t    algo         = HIPBLAS_GEMM_DEFAULT;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    hipblasLocalHandle handle(arg);
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M
+                        || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+        return;
+
+    hipblasStride stride_A = hipblasStride(lda) * A_col;
+    hipblasStride stride_B = hipblasStride(ldb) * B_col;
+    hipblasStride stride_C = hipblasStride(ldc) * N;
+
+    // alpha_b and beta_b are two apart, with beta_b zero for every other problem
+    const hipblasStride stride_scalars = 2;
+    host_vector<Tex>    h_alpha(stride_scalars * batch_count), h_beta(stride_scalars * batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        h_alpha[b * stride_scalars] = arg.get_alpha<Tex>() + Tex(b);
+        h_beta[b * stride_scalars]  = b % 2 ? arg.get_beta<Tex>() : Tex(0);
+    }
+
+    host_strided_batch_matrix<Ti> hA(A_row, A_col, lda, stride_A, batch_count);
+    host_strided_batch_matrix<Ti> hB(B_row, B_col, ldb, stride_B, batch_count);
+    host_strided_batch_matrix<To> hC(M, N, ldc, stride_C, batch_count);
+    host_strided_batch_matrix<To> hC_host(M, N, ldc, stride_C, batch_count);
+    host_strided_batch_matrix<To> hC_device(M, N, ldc, stride_C, batch_count);
+    host_strided_batch_matrix<To> hC_gold(M, N, ldc, stride_C, batch_count);
+
+    device_strided_batch_matrix<Ti> dA(A_row, A_col, lda, stride_A, batch_count);
+    device_strided_batch_matrix<Ti> dB(B_row, B_col, ldb, stride_B, batch_count);
+    device_strided_batch_matrix<To> dC(M, N, ldc, stride_C, batch_count);
+    device_vector<Tex>              d_alpha(stride_scalars * batch_count);
+    device_vector<Tex>              d_beta(stride_scalars * batch_count);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(
+        hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+    hipblas_init_matrix(hC, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+    hC_gold.copy_from(hC);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(d_alpha.transfer_from(h_alpha));
+    CHECK_HIP_ERROR(d_beta.transfer_from(h_beta));
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(int b = 0; b < batch_count; b++)
+        ref_gemm<Ti, To, Tex>(transA,
+                              transB,
+                              M,
+                              N,
+                              K,
+                              h_alpha[b * stride_scalars],
+                              hA[b],
+                              lda,
+                              hB[b],
+                              ldb,
+                              h_beta[b * stride_scalars],
+                              hC_gold[b],
+                              ldc);
+
+    auto gemm = [&](const Tex* alpha, const Tex* beta) {
+        return hipblasGemmStridedBatchedExWithScalarArrays(handle,
+                                                           transA,
+                                                           transB,
+                                                           M,
+                                                           N,
+                                                           K,
+                                                           alpha,
+                                                           stride_scalars,
+                                                           dA,
+                                                           a_type,
+                                                           lda,
+                                                           stride_A,
+                                                           dB,
+                                                           b_type,
+                                                           ldb,
+                                                           stride_B,
+                                                           beta,
+                                                           stride_scalars,
+                                                           dC,
+                                                           c_type,
+                                                           ldc,
+                                                           stride_C,
+                                                           batch_count,
+                                                           compute_type,
+                                                           algo);
+    };
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(gemm(h_alpha, h_beta));
+    CHECK_HIP_ERROR(hC_host.transfer_from(dC));
+
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(gemm(d_alpha, d_beta));
+    CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+
+    // the pointer mode of the handle is kept
+    hipblasPointerMode_t mode;
+    CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_POINTER_MODE_DEVICE);
+
+    unit_check_general<To>(M, N, batch_count, ldc, stride_C, hC_gold, hC_host);
+    unit_check_general<To>(M, N, batch_count, ldc, stride_C, hC_gold, hC_device);
+#endif
+}
@@ -0,0 +1,310 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <memory>
+#include <vector>
+
+#include "hipblas_unique_ptr.hpp"
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmVBatchedModel = ArgumentModel<e_a_type,
+                                               e_transA,
+                                               e_transB,
+                                               e_M,
+                                               e_N,
+                                               e_K,
+                                               e_alpha,
+                                               e_lda,
+                                               e_ldb,
+                                               e_beta,
+                                               e_ldc,
+                                               e_batch_count>;
+
+inline void testname_gemm_vbatched(const Arguments& arg, std::string& name)
+{
+    hipblasGemmVBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_gemm_vbatched_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType        dataType    = arg.a_type;
+    hipblasOperation_t transA      = HIPBLAS_OP_N;
+    hipblasOperation_t transB      = HIPBLAS_OP_N;
+    int                M           = 100;
+    int                N           = 101;
+    int                K           = 102;
+    int                batch_count = 2;
+
+    device_batch_matrix<T> dA(M, K, M, batch_count);
+    device_batch_matrix<T> dB(K, N, K, batch_count);
+    device_batch_matrix<T> dC(M, N, M, batch_count);
+    device_vector<int>     dsize(batch_count);
+
+    auto A = (const void* const*)dA.ptr_on_device();
+    auto B = (const void* const*)dB.ptr_on_device();
+    auto C = (void* const*)dC.ptr_on_device();
+
+    T h_alpha(1), h_beta(2);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmVBatched(nullptr, transA, transB, dsize, dsize, dsize, M, N,
+                                              &h_alpha, A, dsize, B, dsize, &h_beta, C, dsize,
+                                              batch_count, dataType),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmVBatched(handle, transA,
+                                              (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL, dsize,
+                                              dsize, dsize, M, N, &h_alpha, A, dsize, B, dsize,
+                                              &h_beta, C, dsize, batch_count, dataType),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmVBatched(handle, transA, transB, dsize, dsize, dsize, M, -1,
+                                              &h_alpha, A, dsize, B, dsize, &h_beta, C, dsize,
+                                              batch_count, dataType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmVBatched(handle, transA, transB, dsize, dsize, nullptr, M, N,
+                                              &h_alpha, A, dsize, B, dsize, &h_beta, C, dsize,
+                                              batch_count, dataType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmVBatched(handle, transA, transB, dsize, dsize, dsize, M, N,
+                                              &h_alpha, A, dsize, B, dsize, nullptr, C, dsize,
+                                              batch_count, dataType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmVBatched(handle, transA, transB, dsize, dsize, dsize, M, N,
+                                              &h_alpha, A, dsize, nullptr, dsize, &h_beta, C,
+                                              dsize, batch_count, dataType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // integer matrices aren't supported
+    EXPECT_HIPBLAS_STATUS(hipblasGemmVBatched(handle, transA, transB, dsize, dsize, dsize, M, N,
+                                              &h_alpha, A, dsize, B, dsize, &h_beta, C, dsize,
+                                              batch_count, HIP_R_32I),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // With maxM == 0, maxN == 0 or batch_count == 0, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasGemmVBatched(handle, transA, transB, nullptr, nullptr, nullptr, 0,
+                                            N, nullptr, nullptr, nullptr, nullptr, nullptr,
+                                            nullptr, nullptr, nullptr, batch_count, dataType));
+    CHECK_HIPBLAS_ERROR(hipblasGemmVBatched(handle, transA, transB, nullptr, nullptr, nullptr, M,
+                                            0, nullptr, nullptr, nullptr, nullptr, nullptr,
+                                            nullptr, nullptr, nullptr, batch_count, dataType));
+    CHECK_HIPBLAS_ERROR(hipblasGemmVBatched(handle, transA, transB, nullptr, nullptr, nullptr, M,
+                                            N, nullptr, nullptr, nullptr, nullptr, nullptr,
+                                            nullptr, nullptr, nullptr, 0, dataType));
+
+    // clang-format on
+#endif
+}
+
+template <typename T>
+void testing_gemm_vbatched(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                batch_count = arg.batch_count;
+    hipDataType        data_type   = arg.a_type;
+
+    hipblasLocalHandle handle(arg);
+
+    bool invalid_size = M < 0 || N < 0 || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasGemmVBatched(handle,
+                                                  transA,
+                                                  transB,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  M,
+                                                  N,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  batch_count,
+                                                  data_type),
+                              invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    // The problems cycle through sizes from 0 up to M by N by K, so that the launch, which is
+    // sized for M by N, has blocks past the end of most of them
+    std::vector<int> m_array(batch_count), n_array(batch_count), k_array(batch_count);
+    std::vector<int> lda_array(batch_count), ldb_array(batch_count), ldc_array(batch_count);
+
+    std::vector<std::unique_ptr<host_matrix<T>>>   hA(batch_count), hB(batch_count);
+    std::vector<std::unique_ptr<host_matrix<T>>>   hC(batch_count), hC_gold(batch_count);
+    std::vector<std::unique_ptr<host_matrix<T>>>   hC_res(batch_count);
+    std::vector<std::unique_ptr<device_matrix<T>>> dA(batch_count), dB(batch_count);
+    std::vector<std::unique_ptr<device_matrix<T>>> dC(batch_count);
+
+    std::vector<const void*> A_ptrs(batch_count), B_ptrs(batch_count);
+    std::vector<void*>       C_ptrs(batch_count);
+
+    for(int b = 0; b < batch_count; b++)
+    {
+        m_array[b] = M * (b % 4) / 3;
+        n_array[b] = N * ((b + 1) % 4) / 3;
+        k_array[b] = K * ((b + 2) % 4) / 3;
+
+        // the empty problems still get matrices of one element
+        int m     = std::max(m_array[b], 1);
+        int n     = std::max(n_array[b], 1);
+        int k     = std::max(k_array[b], 1);
+        int A_row = transA == HIPBLAS_OP_N ? m : k;
+        int A_col = transA == HIPBLAS_OP_N ? k : m;
+        int B_row = transB == HIPBLAS_OP_N ? k : n;
+        int B_col = transB == HIPBLAS_OP_N ? n : k;
+
+        lda_array[b] = std::max<int>(arg.lda, A_row);
+        ldb_array[b] = std::max<int>(arg.ldb, B_row);
+        ldc_array[b] = std::max<int>(arg.ldc, m);
+
+        hA[b]      = std::make_unique<host_matrix<T>>(A_row, A_col, lda_array[b]);
+        hB[b]      = std::make_unique<host_matrix<T>>(B_row, B_col, ldb_array[b]);
+        hC[b]      = std::make_unique<host_matrix<T>>(m, n, ldc_array[b]);
+        hC_gold[b] = std::make_unique<host_matrix<T>>(m, n, ldc_array[b]);
+        hC_res[b]  = std::make_unique<host_matrix<T>>(m, n, ldc_array[b]);
+        dA[b]      = std::make_unique<device_matrix<T>>(A_row, A_col, lda_array[b]);
+        dB[b]      = std::make_unique<device_matrix<T>>(B_row, B_col, ldb_array[b]);
+        dC[b]      = std::make_unique<device_matrix<T>>(m, n, ldc_array[b]);
+
+        CHECK_DEVICE_ALLOCATION(dA[b]->memcheck());
+        CHECK_DEVICE_ALLOCATION(dB[b]->memcheck());
+        CHECK_DEVICE_ALLOCATION(dC[b]->memcheck());
+
+        hipblas_init_matrix(
+            *hA[b], arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+        hipblas_init_matrix(
+            *hB[b], arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+        hipblas_init_matrix(*hC[b], arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+        *hC_gold[b] = *hC[b];
+
+        CHECK_HIP_ERROR(dA[b]->transfer_from(*hA[b]));
+        CHECK_HIP_ERROR(dB[b]->transfer_from(*hB[b]));
+
+        A_ptrs[b] = *dA[b];
+        B_ptrs[b] = *dB[b];
+        C_ptrs[b] = *dC[b];
+
+        if(m_array[b] && n_array[b])
+            ref_gemm<T, T, T>(transA,
+                              transB,
+                              m_array[b],
+                              n_array[b],
+                              k_array[b],
+                              h_alpha,
+                              *hA[b],
+                              lda_array[b],
+                              *hB[b],
+                              ldb_array[b],
+                              h_beta,
+                              *hC_gold[b],
+                              ldc_array[b]);
+    }
+
+    device_vector<int> dm(batch_count), dn(batch_count), dk(batch_count);
+    device_vector<int> dlda(batch_count), dldb(batch_count), dldc(batch_count);
+    device_vector<T>   d_alpha(1), d_beta(1);
+
+    hipblas_unique_ptr dA_ptrs(hipblas::device_malloc(sizeof(void*) * batch_count),
+                               hipblas::device_free);
+    hipblas_unique_ptr dB_ptrs(hipblas::device_malloc(sizeof(void*) * batch_count),
+                               hipblas::device_free);
+    hipblas_unique_ptr dC_ptrs(hipblas::device_malloc(sizeof(void*) * batch_count),
+                               hipblas::device_free);
+
+    size_t int_bytes = sizeof(int) * batch_count, ptr_bytes = sizeof(void*) * batch_count;
+    CHECK_HIP_ERROR(hipMemcpy(dm, m_array.data(), int_bytes, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dn, n_array.data(), int_bytes, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dk, k_array.data(), int_bytes, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dlda, lda_array.data(), int_bytes, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dldb, ldb_array.data(), int_bytes, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dldc, ldc_array.data(), int_bytes, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dA_ptrs.get(), A_ptrs.data(), ptr_bytes, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB_ptrs.get(), B_ptrs.data(), ptr_bytes, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_ptrs.get(), C_ptrs.data(), ptr_bytes, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    auto gemm = [&](const T* alpha, const T* beta) {
+        for(int b = 0; b < batch_count; b++)
+            CHECK_HIP_ERROR(dC[b]->transfer_from(*hC[b]));
+
+        CHECK_HIPBLAS_ERROR(hipblasGemmVBatched(handle,
+                                                transA,
+                                                transB,
+                                                dm,
+                                                dn,
+                                                dk,
+                                                M,
+                                                N,
+                                                alpha,
+                                                (const void* const*)dA_ptrs.get(),
+                                                dlda,
+                                                (const void* const*)dB_ptrs.get(),
+                                                dldb,
+                                                beta,
+                                                (void* const*)dC_ptrs.get(),
+                                                dldc,
+                                                batch_count,
+                                                data_type));
+
+        // the empty problems are left as they were
+        for(int b = 0; b < batch_count; b++)
+        {
+            CHECK_HIP_ERROR(hC_res[b]->transfer_from(*dC[b]));
+            unit_check_general<T>(hC[b]->m(), hC[b]->n(), ldc_array[b], *hC_gold[b], *hC_res[b]);
+        }
+    };
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    gemm(&h_alpha, &h_beta);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    gemm(d_alpha, d_beta);
+#endif
+}
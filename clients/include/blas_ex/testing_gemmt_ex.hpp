@@ -0,0 +1,300 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmtExModel = ArgumentModel<e_a_type,
+                                          e_c_type,
+                                          e_compute_type,
+                                          e_uplo,
+                                          e_transA,
+                                          e_transB,
+                                          e_N,
+                                          e_K,
+                                          e_alpha,
+                                          e_lda,
+                                          e_ldb,
+                                          e_beta,
+                                          e_ldc,
+                                          e_stride_scale,
+                                          e_batch_count>;
+
+inline void testname_gemmt_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmtExModel{}.test_name(arg, name);
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemmt_ex_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType          aType       = arg.a_type;
+    hipDataType          cType       = arg.c_type;
+    hipblasComputeType_t computeType = arg.compute_type_gemm;
+    hipblasFillMode_t    uplo        = HIPBLAS_FILL_MODE_LOWER;
+    hipblasOperation_t   transA      = HIPBLAS_OP_N;
+    hipblasOperation_t   transB      = HIPBLAS_OP_N;
+
+    int N = 101, K = 100, lda = 102, ldb = 103, ldc = 104, batch_count = 2;
+
+    hipblasStride strideA = hipblasStride(lda) * K;
+    hipblasStride strideB = hipblasStride(ldb) * N;
+    hipblasStride strideC = hipblasStride(ldc) * N;
+
+    device_strided_batch_matrix<Ti> dA(N, K, lda, strideA, batch_count);
+    device_strided_batch_matrix<Ti> dB(K, N, ldb, strideB, batch_count);
+    device_strided_batch_matrix<To> dC(N, N, ldc, strideC, batch_count);
+
+    Tex h_alpha(1), h_beta(2);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmtEx(nullptr, uplo, transA, transB, N, K, &h_alpha, dA,
+                                         aType, lda, dB, aType, ldb, &h_beta, dC, cType, ldc,
+                                         computeType),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmtEx(handle, HIPBLAS_FILL_MODE_FULL, transA, transB, N, K,
+                                         &h_alpha, dA, aType, lda, dB, aType, ldb, &h_beta, dC,
+                                         cType, ldc, computeType),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmtEx(handle, uplo, transA, hipblasOperation_t(-1), N, K,
+                                         &h_alpha, dA, aType, lda, dB, aType, ldb, &h_beta, dC,
+                                         cType, ldc, computeType),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmtEx(handle, uplo, transA, transB, N, K, nullptr, dA, aType,
+                                         lda, dB, aType, ldb, &h_beta, dC, cType, ldc,
+                                         computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmtEx(handle, uplo, transA, transB, N, K, &h_alpha, dA, aType,
+                                         lda, dB, aType, ldb, nullptr, dC, cType, ldc,
+                                         computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // op(B) is K by N
+    EXPECT_HIPBLAS_STATUS(hipblasGemmtEx(handle, uplo, transA, transB, N, K, &h_alpha, dA, aType,
+                                         lda, dB, aType, K - 1, &h_beta, dC, cType, ldc,
+                                         computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmtStridedBatchedEx(handle, uplo, transA, transB, N, K,
+                                                       &h_alpha, dA, aType, lda, strideA, dB,
+                                                       aType, ldb, strideB, &h_beta, dC, cType,
+                                                       ldc, strideC, -1, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // integer C isn't supported
+    EXPECT_HIPBLAS_STATUS(hipblasGemmtEx(handle, uplo, transA, transB, N, K, &h_alpha, dA, aType,
+                                         lda, dB, aType, ldb, &h_beta, dC, HIP_R_32I, ldc,
+                                         computeType),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // With N == 0 or batchCount == 0, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasGemmtEx(handle, uplo, transA, transB, 0, K, nullptr, nullptr,
+                                       aType, lda, nullptr, aType, ldb, nullptr, nullptr, cType,
+                                       ldc, computeType));
+    CHECK_HIPBLAS_ERROR(hipblasGemmtStridedBatchedEx(handle, uplo, transA, transB, N, K, nullptr,
+                                                     nullptr, aType, lda, strideA, nullptr,
+                                                     aType, ldb, strideB, nullptr, nullptr,
+                                                     cType, ldc, strideC, 0, computeType));
+
+    // clang-format on
+#endif
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemmt_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasFillMode_t  uplo        = char2hipblas_fill(arg.uplo);
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                lda         = arg.lda;
+    int                ldb         = arg.ldb;
+    int                ldc         = arg.ldc;
+    int                batch_count = arg.batch_count;
+
+    hipDataType          a_type       = arg.a_type;
+    hipDataType          c_type       = arg.c_type;
+    hipblasComputeType_t compute_type = arg.compute_type_gemm;
+
+    hipblasLocalHandle handle(arg);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    int  rows_a       = transA == HIPBLAS_OP_N ? N : K;
+    int  rows_b       = transB == HIPBLAS_OP_N ? K : N;
+    bool invalid_size = N < 0 || K < 0 || batch_count < 0 || ldc < N || ldc < 1 || lda < rows_a
+                        || lda < 1 || ldb < rows_b || ldb < 1;
+    if(invalid_size || !N || !batch_count)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasGemmtStridedBatchedEx(handle,
+                                                           uplo,
+                                                           transA,
+                                                           transB,
+                                                           N,
+                                                           K,
+                                                           nullptr,
+                                                           nullptr,
+                                                           a_type,
+                                                           lda,
+                                                           0,
+                                                           nullptr,
+                                                           a_type,
+                                                           ldb,
+                                                           0,
+                                                           nullptr,
+                                                           nullptr,
+                                                           c_type,
+                                                           ldc,
+                                                           0,
+                                                           batch_count,
+                                                           compute_type),
+                              invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    int A_row = transA == HIPBLAS_OP_N ? N : std::max(K, 1);
+    int A_col = transA == HIPBLAS_OP_N ? std::max(K, 1) : N;
+    int B_row = transB == HIPBLAS_OP_N ? std::max(K, 1) : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : std::max(K, 1);
+
+    hipblasStride stride_A = hipblasStride(lda) * A_col * arg.stride_scale;
+    hipblasStride stride_B = hipblasStride(ldb) * B_col * arg.stride_scale;
+    hipblasStride stride_C = hipblasStride(ldc) * N * arg.stride_scale;
+
+    Tex h_alpha = arg.get_alpha<Tex>();
+    Tex h_beta  = arg.get_beta<Tex>();
+
+    // Naming: dA is in GPU (device) memory. hA is in CPU (host) memory
+    host_strided_batch_matrix<Ti> hA(A_row, A_col, lda, stride_A, batch_count);
+    host_strided_batch_matrix<Ti> hB(B_row, B_col, ldb, stride_B, batch_count);
+    host_strided_batch_matrix<To> hC(N, N, ldc, stride_C, batch_count);
+    host_strided_batch_matrix<To> hC_gold(N, N, ldc, stride_C, batch_count);
+    host_strided_batch_matrix<To> hC_host(N, N, ldc, stride_C, batch_count);
+    host_strided_batch_matrix<To> hC_device(N, N, ldc, stride_C, batch_count);
+
+    device_strided_batch_matrix<Ti> dA(A_row, A_col, lda, stride_A, batch_count);
+    device_strided_batch_matrix<Ti> dB(B_row, B_col, ldb, stride_B, batch_count);
+    device_strided_batch_matrix<To> dC(N, N, ldc, stride_C, batch_count);
+    device_vector<Tex>              d_alpha(1);
+    device_vector<Tex>              d_beta(1);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix);
+    hipblas_init_matrix(hC, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+    hC_gold.copy_from(hC);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Tex), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(Tex), hipMemcpyHostToDevice));
+
+    // the full product, of which only the uplo triangle is copied into C
+    for(int b = 0; b < batch_count; b++)
+    {
+        std::vector<To> full(hC_gold[b], hC_gold[b] + size_t(ldc) * N);
+        ref_gemm<Ti, To, Tex>(
+            transA, transB, N, N, K, h_alpha, hA[b], lda, hB[b], ldb, h_beta, full.data(), ldc);
+        for(int j = 0; j < N; j++)
+        {
+            int i_begin = uplo == HIPBLAS_FILL_MODE_LOWER ? j : 0;
+            int i_end   = uplo == HIPBLAS_FILL_MODE_LOWER ? N : j + 1;
+            for(int i = i_begin; i < i_end; i++)
+                hC_gold[b][size_t(j) * ldc + i] = full[size_t(j) * ldc + i];
+        }
+    }
+
+    // host pointer mode through the strided batched function, device pointer mode through
+    // hipblasGemmtEx for each matrix
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasGemmtStridedBatchedEx(handle,
+                                                     uplo,
+                                                     transA,
+                                                     transB,
+                                                     N,
+                                                     K,
+                                                     &h_alpha,
+                                                     dA,
+                                                     a_type,
+                                                     lda,
+                                                     stride_A,
+                                                     dB,
+                                                     a_type,
+                                                     ldb,
+                                                     stride_B,
+                                                     &h_beta,
+                                                     dC,
+                                                     c_type,
+                                                     ldc,
+                                                     stride_C,
+                                                     batch_count,
+                                                     compute_type));
+    CHECK_HIP_ERROR(hC_host.transfer_from(dC));
+
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPBLAS_ERROR(hipblasGemmtEx(handle,
+                                           uplo,
+                                           transA,
+                                           transB,
+                                           N,
+                                           K,
+                                           d_alpha,
+                                           dA[b],
+                                           a_type,
+                                           lda,
+                                           dB[b],
+                                           a_type,
+                                           ldb,
+                                           d_beta,
+                                           dC[b],
+                                           c_type,
+                                           ldc,
+                                           compute_type));
+    CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+
+    // the triangle that isn't computed must be left as it was
+    unit_check_general<To>(N, N, batch_count, ldc, stride_C, hC_gold, hC_host);
+    unit_check_general<To>(N, N, batch_count, ldc, stride_C, hC_gold, hC_device);
+#endif
+}
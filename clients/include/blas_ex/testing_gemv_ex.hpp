@@ -0,0 +1,223 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemvExModel = ArgumentModel<e_a_type,
+                                         e_c_type,
+                                         e_compute_type,
+                                         e_transA,
+                                         e_M,
+                                         e_N,
+                                         e_alpha,
+                                         e_lda,
+                                         e_incx,
+                                         e_beta,
+                                         e_incy>;
+
+inline void testname_gemv_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemvExModel{}.test_name(arg, name);
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemv_ex_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType          aType       = arg.a_type;
+    hipDataType          yType       = arg.c_type;
+    hipblasComputeType_t computeType = arg.compute_type_gemm;
+    hipblasOperation_t   transA      = HIPBLAS_OP_N;
+
+    int M = 100, N = 101, lda = 102, incx = 1, incy = 1;
+
+    device_matrix<Ti> dA(M, N, lda);
+    device_vector<Ti> dx(N, incx);
+    device_vector<To> dy(M, incy);
+
+    Tex h_alpha(1), h_beta(2);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemvEx(nullptr, transA, M, N, &h_alpha, dA, aType, lda, dx,
+                                        aType, incx, &h_beta, dy, yType, incy, computeType),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemvEx(handle, (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL, M,
+                                        N, &h_alpha, dA, aType, lda, dx, aType, incx, &h_beta,
+                                        dy, yType, incy, computeType),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemvEx(handle, transA, M, N, nullptr, dA, aType, lda, dx,
+                                        aType, incx, &h_beta, dy, yType, incy, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // A and x of different types
+    EXPECT_HIPBLAS_STATUS(hipblasGemvEx(handle, transA, M, N, &h_alpha, dA, aType, lda, dx,
+                                        HIP_R_8I, incx, &h_beta, dy, yType, incy, computeType),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // a compute type narrower than A
+    EXPECT_HIPBLAS_STATUS(hipblasGemvEx(handle, transA, M, N, &h_alpha, dA, aType, lda, dx,
+                                        aType, incx, &h_beta, dy, yType, incy,
+                                        HIPBLAS_COMPUTE_32I),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // With M == 0 || N == 0, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasGemvEx(handle, transA, 0, N, nullptr, nullptr, aType, lda,
+                                      nullptr, aType, incx, nullptr, nullptr, yType, incy,
+                                      computeType));
+    CHECK_HIPBLAS_ERROR(hipblasGemvEx(handle, transA, M, 0, nullptr, nullptr, aType, lda,
+                                      nullptr, aType, incx, nullptr, nullptr, yType, incy,
+                                      computeType));
+
+    // clang-format on
+#endif
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemv_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                lda    = arg.lda;
+    int64_t            incx   = arg.incx;
+    int64_t            incy   = arg.incy;
+
+    hipDataType          a_type       = arg.a_type;
+    hipDataType          y_type       = arg.c_type;
+    hipblasComputeType_t compute_type = arg.compute_type_gemm;
+
+    int dim_x = transA == HIPBLAS_OP_N ? N : M;
+    int dim_y = transA == HIPBLAS_OP_N ? M : N;
+
+    hipblasLocalHandle handle(arg);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = M < 0 || N < 0 || lda < M || lda < 1 || !incx || !incy;
+    if(invalid_size || !M || !N)
+    {
+        if(!invalid_size || arg.bad_arg_all)
+        {
+            // cublas backend doesn't support nullptrs with bad input sizes
+            EXPECT_HIPBLAS_STATUS(hipblasGemvEx(handle,
+                                                transA,
+                                                M,
+                                                N,
+                                                nullptr,
+                                                nullptr,
+                                                a_type,
+                                                lda,
+                                                nullptr,
+                                                a_type,
+                                                incx,
+                                                nullptr,
+                                                nullptr,
+                                                y_type,
+                                                incy,
+                                                compute_type),
+                                  invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                               : HIPBLAS_STATUS_SUCCESS);
+        }
+        return;
+    }
+
+    int abs_incy = incy >= 0 ? incy : -incy;
+
+    Tex h_alpha = arg.get_alpha<Tex>();
+    Tex h_beta  = arg.get_beta<Tex>();
+
+    // Naming: dA is in GPU (device) memory. hA is in CPU (host) memory
+    host_matrix<Ti> hA(M, N, lda);
+    host_vector<Ti> hx(dim_x, incx);
+    host_vector<To> hy(dim_y, incy);
+    host_vector<To> hy_cpu(dim_y, incy);
+    host_vector<To> hy_host(dim_y, incy);
+    host_vector<To> hy_device(dim_y, incy);
+
+    device_matrix<Ti>  dA(M, N, lda);
+    device_vector<Ti>  dx(dim_x, incx);
+    device_vector<To>  dy(dim_y, incy);
+    device_vector<Tex> d_alpha(1);
+    device_vector<Tex> d_beta(1);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_vector(hx, arg, hipblas_client_alpha_sets_nan, false, true);
+    hipblas_init_vector(hy, arg, hipblas_client_beta_sets_nan);
+    hy_cpu = hy;
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Tex), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(Tex), hipMemcpyHostToDevice));
+
+    ref_gemv_ex<Ti, To, Tex>(transA, M, N, h_alpha, hA, lda, hx, incx, h_beta, hy_cpu, incy);
+
+    auto gemv = [&](const Tex* alpha, const Tex* beta) {
+        return hipblasGemvEx(handle,
+                             transA,
+                             M,
+                             N,
+                             alpha,
+                             dA,
+                             a_type,
+                             lda,
+                             dx,
+                             a_type,
+                             incx,
+                             beta,
+                             dy,
+                             y_type,
+                             incy,
+                             compute_type);
+    };
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(gemv(&h_alpha, &h_beta));
+    CHECK_HIP_ERROR(hy_host.transfer_from(dy));
+
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(gemv(d_alpha, d_beta));
+    CHECK_HIP_ERROR(hy_device.transfer_from(dy));
+
+    unit_check_general<To>(1, dim_y, abs_incy, hy_cpu, hy_host);
+    unit_check_general<To>(1, dim_y, abs_incy, hy_cpu, hy_device);
+#endif
+}
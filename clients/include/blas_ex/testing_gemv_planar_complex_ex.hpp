@@ -0,0 +1,191 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+#include <complex>
+
+/* ============================================================================================ */
+
+using hipblasGemvPlanarComplexExModel = ArgumentModel<e_a_type,
+                                                      e_transA,
+                                                      e_M,
+                                                      e_N,
+                                                      e_alpha,
+                                                      e_lda,
+                                                      e_incx,
+                                                      e_beta,
+                                                      e_incy>;
+
+inline void testname_gemv_planar_complex_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemvPlanarComplexExModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_gemv_planar_complex_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    if constexpr(std::is_same_v<T, float> || std::is_same_v<T, double>)
+    {
+        using Tc                       = std::complex<T>;
+        constexpr bool       is_double = std::is_same_v<T, double>;
+        hipDataType          type      = is_double ? HIP_R_64F : HIP_R_32F;
+        hipblasComputeType_t ct        = is_double ? HIPBLAS_COMPUTE_64F : HIPBLAS_COMPUTE_32F;
+
+        hipblasOperation_t trans = char2hipblas_operation(arg.transA);
+        int                M     = arg.M;
+        int                N     = arg.N;
+        int                lda   = arg.lda;
+        int                incx  = arg.incx;
+        int                incy  = arg.incy;
+        Tc                 alpha(arg.alpha, arg.alphai);
+        Tc                 beta(arg.beta, arg.betai);
+
+        hipblasLocalHandle handle(arg);
+
+        bool invalid_size = M < 0 || N < 0 || lda < std::max(M, 1) || !incx || !incy;
+        if(invalid_size || !M || !N)
+        {
+            EXPECT_HIPBLAS_STATUS(hipblasGemvPlanarComplexEx(handle,
+                                                             trans,
+                                                             M,
+                                                             N,
+                                                             nullptr,
+                                                             nullptr,
+                                                             nullptr,
+                                                             type,
+                                                             lda,
+                                                             nullptr,
+                                                             nullptr,
+                                                             type,
+                                                             incx,
+                                                             nullptr,
+                                                             nullptr,
+                                                             nullptr,
+                                                             type,
+                                                             incy,
+                                                             ct),
+                                  invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                               : HIPBLAS_STATUS_SUCCESS);
+            return;
+        }
+
+        int    x_len  = trans == HIPBLAS_OP_N ? N : M;
+        int    y_len  = trans == HIPBLAS_OP_N ? M : N;
+        size_t size_A = size_t(lda) * N;
+        size_t size_x = size_t(x_len) * std::abs(incx);
+        size_t size_y = size_t(y_len) * std::abs(incy);
+
+        // small integers, so the products are exact
+        host_vector<T> hAr(size_A), hAi(size_A), hxr(size_x), hxi(size_x);
+        host_vector<T> hyr(size_y), hyi(size_y), hyr_device(size_y), hyi_device(size_y);
+        for(size_t i = 0; i < size_A; i++)
+        {
+            hAr[i] = T(i % 7) - 3;
+            hAi[i] = T(i % 5) - 2;
+        }
+        for(size_t i = 0; i < size_x; i++)
+        {
+            hxr[i] = T(i % 5) - 2;
+            hxi[i] = T(i % 3) - 1;
+        }
+        for(size_t i = 0; i < size_y; i++)
+        {
+            hyr[i] = T(i % 3);
+            hyi[i] = T(i % 4) - 2;
+        }
+
+        // element i of a vector, counted from the end for negative increments
+        auto at = [](int i, int len, int inc) {
+            return size_t(inc > 0 ? i * inc : (i - len + 1) * inc);
+        };
+        host_vector<Tc> hy_gold(y_len);
+        for(int i = 0; i < y_len; i++)
+        {
+            Tc w = 0;
+            for(int l = 0; l < x_len; l++)
+            {
+                size_t a = trans == HIPBLAS_OP_N ? i + size_t(l) * lda : l + size_t(i) * lda;
+                Tc     A(hAr[a], trans == HIPBLAS_OP_C ? -hAi[a] : hAi[a]);
+                size_t x = at(l, x_len, incx);
+                w += A * Tc(hxr[x], hxi[x]);
+            }
+            size_t y   = at(i, y_len, incy);
+            hy_gold[i] = alpha * w + beta * Tc(hyr[y], hyi[y]);
+        }
+
+        device_vector<T>  dAr(size_A), dAi(size_A), dxr(size_x), dxi(size_x);
+        device_vector<T>  dyr(size_y), dyi(size_y);
+        device_vector<Tc> d_alpha(1), d_beta(1);
+        CHECK_DEVICE_ALLOCATION(dAr.memcheck());
+        CHECK_DEVICE_ALLOCATION(dAi.memcheck());
+        CHECK_DEVICE_ALLOCATION(dxr.memcheck());
+        CHECK_DEVICE_ALLOCATION(dxi.memcheck());
+        CHECK_DEVICE_ALLOCATION(dyr.memcheck());
+        CHECK_DEVICE_ALLOCATION(dyi.memcheck());
+
+        CHECK_HIP_ERROR(dAr.transfer_from(hAr));
+        CHECK_HIP_ERROR(dAi.transfer_from(hAi));
+        CHECK_HIP_ERROR(dxr.transfer_from(hxr));
+        CHECK_HIP_ERROR(dxi.transfer_from(hxi));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(Tc), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(Tc), hipMemcpyHostToDevice));
+
+        for(hipblasPointerMode_t mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
+        {
+            bool device_mode = mode == HIPBLAS_POINTER_MODE_DEVICE;
+            CHECK_HIP_ERROR(dyr.transfer_from(hyr));
+            CHECK_HIP_ERROR(dyi.transfer_from(hyi));
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, mode));
+            CHECK_HIPBLAS_ERROR(hipblasGemvPlanarComplexEx(handle,
+                                                           trans,
+                                                           M,
+                                                           N,
+                                                           device_mode ? (Tc*)d_alpha : &alpha,
+                                                           dAr,
+                                                           dAi,
+                                                           type,
+                                                           lda,
+                                                           dxr,
+                                                           dxi,
+                                                           type,
+                                                           incx,
+                                                           device_mode ? (Tc*)d_beta : &beta,
+                                                           dyr,
+                                                           dyi,
+                                                           type,
+                                                           incy,
+                                                           ct));
+
+            CHECK_HIP_ERROR(hyr_device.transfer_from(dyr));
+            CHECK_HIP_ERROR(hyi_device.transfer_from(dyi));
+            for(int i = 0; i < y_len; i++)
+            {
+                size_t y = at(i, y_len, incy);
+                EXPECT_EQ(hyr_device[y], hy_gold[i].real());
+                EXPECT_EQ(hyi_device[y], hy_gold[i].imag());
+            }
+        }
+    }
+#endif
+}
@@ -0,0 +1,240 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemvStridedBatchedExModel = ArgumentModel<e_a_type,
+                                                       e_c_type,
+                                                       e_compute_type,
+                                                       e_transA,
+                                                       e_M,
+                                                       e_N,
+                                                       e_alpha,
+                                                       e_lda,
+                                                       e_incx,
+                                                       e_beta,
+                                                       e_incy,
+                                                       e_stride_scale,
+                                                       e_batch_count>;
+
+inline void testname_gemv_strided_batched_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemvStridedBatchedExModel{}.test_name(arg, name);
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemv_strided_batched_ex_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType          aType       = arg.a_type;
+    hipDataType          yType       = arg.c_type;
+    hipblasComputeType_t computeType = arg.compute_type_gemm;
+    hipblasOperation_t   transA      = HIPBLAS_OP_N;
+
+    int M = 100, N = 101, lda = 102, incx = 1, incy = 1, batch_count = 2;
+
+    hipblasStride stride_A = hipblasStride(lda) * N;
+    hipblasStride stride_x = N;
+    hipblasStride stride_y = M;
+
+    device_strided_batch_matrix<Ti> dA(M, N, lda, stride_A, batch_count);
+    device_strided_batch_vector<Ti> dx(N, incx, stride_x, batch_count);
+    device_strided_batch_vector<To> dy(M, incy, stride_y, batch_count);
+
+    Tex h_alpha(1), h_beta(2);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemvStridedBatchedEx(nullptr, transA, M, N, &h_alpha, dA, aType,
+                                                      lda, stride_A, dx, aType, incx, stride_x,
+                                                      &h_beta, dy, yType, incy, stride_y,
+                                                      batch_count, computeType),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemvStridedBatchedEx(handle, transA, M, N, nullptr, dA, aType,
+                                                      lda, stride_A, dx, aType, incx, stride_x,
+                                                      &h_beta, dy, yType, incy, stride_y,
+                                                      batch_count, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemvStridedBatchedEx(handle, transA, M, N, &h_alpha, dA, aType,
+                                                      lda, stride_A, dx, HIP_R_8I, incx,
+                                                      stride_x, &h_beta, dy, yType, incy,
+                                                      stride_y, batch_count, computeType),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // With batch_count == 0, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasGemvStridedBatchedEx(handle, transA, M, N, nullptr, nullptr, aType,
+                                                    lda, stride_A, nullptr, aType, incx,
+                                                    stride_x, nullptr, nullptr, yType, incy,
+                                                    stride_y, 0, computeType));
+
+    // clang-format on
+#endif
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemv_strided_batched_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasOperation_t transA       = char2hipblas_operation(arg.transA);
+    int                M            = arg.M;
+    int                N            = arg.N;
+    int                lda          = arg.lda;
+    int                incx         = arg.incx;
+    int                incy         = arg.incy;
+    double             stride_scale = arg.stride_scale;
+    int                batch_count  = arg.batch_count;
+
+    hipDataType          a_type       = arg.a_type;
+    hipDataType          y_type       = arg.c_type;
+    hipblasComputeType_t compute_type = arg.compute_type_gemm;
+
+    int dim_x    = transA == HIPBLAS_OP_N ? N : M;
+    int dim_y    = transA == HIPBLAS_OP_N ? M : N;
+    int abs_incx = incx >= 0 ? incx : -incx;
+    int abs_incy = incy >= 0 ? incy : -incy;
+
+    hipblasStride stride_A = hipblasStride(lda) * N * stride_scale;
+    hipblasStride stride_x = hipblasStride(dim_x) * abs_incx * stride_scale;
+    hipblasStride stride_y = hipblasStride(dim_y) * abs_incy * stride_scale;
+
+    hipblasLocalHandle handle(arg);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = M < 0 || N < 0 || lda < M || lda < 1 || !incx || !incy || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        if(!invalid_size || arg.bad_arg_all)
+        {
+            // cublas backend doesn't support nullptrs with bad input sizes
+            EXPECT_HIPBLAS_STATUS(hipblasGemvStridedBatchedEx(handle,
+                                                              transA,
+                                                              M,
+                                                              N,
+                                                              nullptr,
+                                                              nullptr,
+                                                              a_type,
+                                                              lda,
+                                                              stride_A,
+                                                              nullptr,
+                                                              a_type,
+                                                              incx,
+                                                              stride_x,
+                                                              nullptr,
+                                                              nullptr,
+                                                              y_type,
+                                                              incy,
+                                                              stride_y,
+                                                              batch_count,
+                                                              compute_type),
+                                  invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                               : HIPBLAS_STATUS_SUCCESS);
+        }
+        return;
+    }
+
+    Tex h_alpha = arg.get_alpha<Tex>();
+    Tex h_beta  = arg.get_beta<Tex>();
+
+    // Naming: dA is in GPU (device) memory. hA is in CPU (host) memory
+    host_strided_batch_matrix<Ti> hA(M, N, lda, stride_A, batch_count);
+    host_strided_batch_vector<Ti> hx(dim_x, incx, stride_x, batch_count);
+    host_strided_batch_vector<To> hy(dim_y, incy, stride_y, batch_count);
+    host_strided_batch_vector<To> hy_cpu(dim_y, incy, stride_y, batch_count);
+    host_strided_batch_vector<To> hy_host(dim_y, incy, stride_y, batch_count);
+    host_strided_batch_vector<To> hy_device(dim_y, incy, stride_y, batch_count);
+
+    device_strided_batch_matrix<Ti> dA(M, N, lda, stride_A, batch_count);
+    device_strided_batch_vector<Ti> dx(dim_x, incx, stride_x, batch_count);
+    device_strided_batch_vector<To> dy(dim_y, incy, stride_y, batch_count);
+    device_vector<Tex>              d_alpha(1);
+    device_vector<Tex>              d_beta(1);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_vector(hx, arg, hipblas_client_alpha_sets_nan, false, true);
+    hipblas_init_vector(hy, arg, hipblas_client_beta_sets_nan);
+    hy_cpu.copy_from(hy);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Tex), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(Tex), hipMemcpyHostToDevice));
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(int b = 0; b < batch_count; b++)
+        ref_gemv_ex<Ti, To, Tex>(
+            transA, M, N, h_alpha, hA[b], lda, hx[b], incx, h_beta, hy_cpu[b], incy);
+
+    auto gemv = [&](const Tex* alpha, const Tex* beta) {
+        return hipblasGemvStridedBatchedEx(handle,
+                                           transA,
+                                           M,
+                                           N,
+                                           alpha,
+                                           dA,
+                                           a_type,
+                                           lda,
+                                           stride_A,
+                                           dx,
+                                           a_type,
+                                           incx,
+                                           stride_x,
+                                           beta,
+                                           dy,
+                                           y_type,
+                                           incy,
+                                           stride_y,
+                                           batch_count,
+                                           compute_type);
+    };
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(gemv(&h_alpha, &h_beta));
+    CHECK_HIP_ERROR(hy_host.transfer_from(dy));
+
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(gemv(d_alpha, d_beta));
+    CHECK_HIP_ERROR(hy_device.transfer_from(dy));
+
+    unit_check_general<To>(1, dim_y, batch_count, abs_incy, stride_y, hy_cpu, hy_host);
+    unit_check_general<To>(1, dim_y, batch_count, abs_incy, stride_y, hy_cpu, hy_device);
+#endif
+}
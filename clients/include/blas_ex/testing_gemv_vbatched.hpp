@@ -0,0 +1,293 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <memory>
+#include <vector>
+
+#include "hipblas_unique_ptr.hpp"
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemvVBatchedModel = ArgumentModel<e_a_type,
+                                               e_transA,
+                                               e_M,
+                                               e_N,
+                                               e_alpha,
+                                               e_lda,
+                                               e_incx,
+                                               e_beta,
+                                               e_incy,
+                                               e_batch_count>;
+
+inline void testname_gemv_vbatched(const Arguments& arg, std::string& name)
+{
+    hipblasGemvVBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_gemv_vbatched_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType        dataType    = arg.a_type;
+    hipblasOperation_t trans       = HIPBLAS_OP_N;
+    int                M           = 100;
+    int                N           = 101;
+    int                batch_count = 2;
+
+    device_batch_matrix<T> dA(M, N, M, batch_count);
+    device_batch_vector<T> dx(N, 1, batch_count);
+    device_batch_vector<T> dy(M, 1, batch_count);
+    device_vector<int>     dsize(batch_count);
+
+    auto A = (const void* const*)dA.ptr_on_device();
+    auto x = (const void* const*)dx.ptr_on_device();
+    auto y = (void* const*)dy.ptr_on_device();
+
+    T h_alpha(1), h_beta(2);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemvVBatched(nullptr, trans, dsize, dsize, M, N, &h_alpha, A,
+                                              dsize, x, dsize, &h_beta, y, dsize, batch_count,
+                                              dataType),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemvVBatched(handle, (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                                              dsize, dsize, M, N, &h_alpha, A, dsize, x, dsize,
+                                              &h_beta, y, dsize, batch_count, dataType),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemvVBatched(handle, trans, dsize, dsize, -1, N, &h_alpha, A,
+                                              dsize, x, dsize, &h_beta, y, dsize, batch_count,
+                                              dataType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemvVBatched(handle, trans, dsize, dsize, M, N, &h_alpha, A, dsize,
+                                              x, dsize, &h_beta, y, dsize, -1, dataType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemvVBatched(handle, trans, nullptr, dsize, M, N, &h_alpha, A,
+                                              dsize, x, dsize, &h_beta, y, dsize, batch_count,
+                                              dataType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemvVBatched(handle, trans, dsize, dsize, M, N, nullptr, A, dsize,
+                                              x, dsize, &h_beta, y, dsize, batch_count, dataType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemvVBatched(handle, trans, dsize, dsize, M, N, &h_alpha, A, dsize,
+                                              x, dsize, &h_beta, nullptr, dsize, batch_count,
+                                              dataType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // half precision isn't supported
+    EXPECT_HIPBLAS_STATUS(hipblasGemvVBatched(handle, trans, dsize, dsize, M, N, &h_alpha, A, dsize,
+                                              x, dsize, &h_beta, y, dsize, batch_count, HIP_R_16F),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // With maxM == 0, maxN == 0 or batch_count == 0, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasGemvVBatched(handle, trans, nullptr, nullptr, 0, N, nullptr, nullptr,
+                                            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+                                            batch_count, dataType));
+    CHECK_HIPBLAS_ERROR(hipblasGemvVBatched(handle, trans, nullptr, nullptr, M, 0, nullptr, nullptr,
+                                            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+                                            batch_count, dataType));
+    CHECK_HIPBLAS_ERROR(hipblasGemvVBatched(handle, trans, nullptr, nullptr, M, N, nullptr, nullptr,
+                                            nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+                                            0, dataType));
+
+    // clang-format on
+#endif
+}
+
+template <typename T>
+void testing_gemv_vbatched(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasOperation_t trans       = char2hipblas_operation(arg.transA);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int64_t            incx        = arg.incx;
+    int64_t            incy        = arg.incy;
+    int                batch_count = arg.batch_count;
+    hipDataType        data_type   = arg.a_type;
+
+    hipblasLocalHandle handle(arg);
+
+    bool invalid_size = M < 0 || N < 0 || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasGemvVBatched(handle,
+                                                  trans,
+                                                  nullptr,
+                                                  nullptr,
+                                                  M,
+                                                  N,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  batch_count,
+                                                  data_type),
+                              invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    // The problems cycle through sizes from 0 up to M by N, so that the launch, which is sized
+    // for M by N, has blocks past the end of most of them
+    std::vector<int> m_array(batch_count), n_array(batch_count), lda_array(batch_count);
+    std::vector<int> incx_array(batch_count, incx), incy_array(batch_count, incy);
+
+    std::vector<std::unique_ptr<host_matrix<T>>>   hA(batch_count);
+    std::vector<std::unique_ptr<host_vector<T>>>   hx(batch_count), hy(batch_count);
+    std::vector<std::unique_ptr<host_vector<T>>>   hy_gold(batch_count), hy_res(batch_count);
+    std::vector<std::unique_ptr<device_matrix<T>>> dA(batch_count);
+    std::vector<std::unique_ptr<device_vector<T>>> dx(batch_count), dy(batch_count);
+
+    std::vector<const void*> A_ptrs(batch_count), x_ptrs(batch_count);
+    std::vector<void*>       y_ptrs(batch_count);
+
+    for(int b = 0; b < batch_count; b++)
+    {
+        m_array[b] = M * (b % 4) / 3;
+        n_array[b] = N * ((b + 1) % 4) / 3;
+
+        // the empty problems still get a matrix and vectors of one element
+        int rows  = std::max(m_array[b], 1);
+        int cols  = std::max(n_array[b], 1);
+        int x_len = trans == HIPBLAS_OP_N ? cols : rows;
+        int y_len = trans == HIPBLAS_OP_N ? rows : cols;
+
+        lda_array[b] = std::max<int>(arg.lda, rows);
+
+        hA[b]      = std::make_unique<host_matrix<T>>(rows, cols, lda_array[b]);
+        hx[b]      = std::make_unique<host_vector<T>>(x_len, incx);
+        hy[b]      = std::make_unique<host_vector<T>>(y_len, incy);
+        hy_gold[b] = std::make_unique<host_vector<T>>(y_len, incy);
+        hy_res[b]  = std::make_unique<host_vector<T>>(y_len, incy);
+        dA[b]      = std::make_unique<device_matrix<T>>(rows, cols, lda_array[b]);
+        dx[b]      = std::make_unique<device_vector<T>>(x_len, incx);
+        dy[b]      = std::make_unique<device_vector<T>>(y_len, incy);
+
+        CHECK_DEVICE_ALLOCATION(dA[b]->memcheck());
+        CHECK_DEVICE_ALLOCATION(dx[b]->memcheck());
+        CHECK_DEVICE_ALLOCATION(dy[b]->memcheck());
+
+        hipblas_init_matrix(
+            *hA[b], arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true, false);
+        hipblas_init_vector(*hx[b], arg, hipblas_client_alpha_sets_nan, false, true);
+        hipblas_init_vector(*hy[b], arg, hipblas_client_beta_sets_nan);
+        *hy_gold[b] = *hy[b];
+
+        CHECK_HIP_ERROR(dA[b]->transfer_from(*hA[b]));
+        CHECK_HIP_ERROR(dx[b]->transfer_from(*hx[b]));
+
+        A_ptrs[b] = *dA[b];
+        x_ptrs[b] = *dx[b];
+        y_ptrs[b] = *dy[b];
+
+        if(m_array[b] && n_array[b])
+            ref_gemv<T>(trans,
+                        m_array[b],
+                        n_array[b],
+                        h_alpha,
+                        *hA[b],
+                        lda_array[b],
+                        *hx[b],
+                        incx,
+                        h_beta,
+                        *hy_gold[b],
+                        incy);
+    }
+
+    device_vector<int> dm(batch_count), dn(batch_count), dlda(batch_count);
+    device_vector<int> dincx(batch_count), dincy(batch_count);
+    device_vector<T>   d_alpha(1), d_beta(1);
+
+    hipblas_unique_ptr dA_ptrs(hipblas::device_malloc(sizeof(void*) * batch_count),
+                               hipblas::device_free);
+    hipblas_unique_ptr dx_ptrs(hipblas::device_malloc(sizeof(void*) * batch_count),
+                               hipblas::device_free);
+    hipblas_unique_ptr dy_ptrs(hipblas::device_malloc(sizeof(void*) * batch_count),
+                               hipblas::device_free);
+
+    size_t int_bytes = sizeof(int) * batch_count, ptr_bytes = sizeof(void*) * batch_count;
+    CHECK_HIP_ERROR(hipMemcpy(dm, m_array.data(), int_bytes, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dn, n_array.data(), int_bytes, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dlda, lda_array.data(), int_bytes, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dincx, incx_array.data(), int_bytes, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dincy, incy_array.data(), int_bytes, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dA_ptrs.get(), A_ptrs.data(), ptr_bytes, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx_ptrs.get(), x_ptrs.data(), ptr_bytes, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_ptrs.get(), y_ptrs.data(), ptr_bytes, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    auto gemv = [&](const T* alpha, const T* beta) {
+        for(int b = 0; b < batch_count; b++)
+            CHECK_HIP_ERROR(dy[b]->transfer_from(*hy[b]));
+
+        CHECK_HIPBLAS_ERROR(hipblasGemvVBatched(handle,
+                                                trans,
+                                                dm,
+                                                dn,
+                                                M,
+                                                N,
+                                                alpha,
+                                                (const void* const*)dA_ptrs.get(),
+                                                dlda,
+                                                (const void* const*)dx_ptrs.get(),
+                                                dincx,
+                                                beta,
+                                                (void* const*)dy_ptrs.get(),
+                                                dincy,
+                                                batch_count,
+                                                data_type));
+
+        // the empty problems are left as they were
+        for(int b = 0; b < batch_count; b++)
+        {
+            CHECK_HIP_ERROR(hy_res[b]->transfer_from(*dy[b]));
+            unit_check_general<T>(1, hy[b]->n(), std::abs(incy), *hy_gold[b], *hy_res[b]);
+        }
+    };
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    gemv(&h_alpha, &h_beta);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    gemv(d_alpha, d_beta);
+#endif
+}
@@ -0,0 +1,227 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasHerkExModel = ArgumentModel<e_a_type,
+                                         e_c_type,
+                                         e_compute_type,
+                                         e_uplo,
+                                         e_transA,
+                                         e_N,
+                                         e_K,
+                                         e_alpha,
+                                         e_lda,
+                                         e_beta,
+                                         e_ldc>;
+
+inline void testname_herk_ex(const Arguments& arg, std::string& name)
+{
+    hipblasHerkExModel{}.test_name(arg, name);
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_herk_ex_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType          aType       = arg.a_type;
+    hipDataType          cType       = arg.c_type;
+    hipblasComputeType_t computeType = arg.compute_type_gemm;
+    hipblasFillMode_t    uplo        = HIPBLAS_FILL_MODE_LOWER;
+    hipblasOperation_t   transA      = HIPBLAS_OP_N;
+
+    int N = 101, K = 100, lda = 102, ldc = 104;
+
+    device_matrix<Ti> dA(N, K, lda);
+    device_matrix<To> dC(N, N, ldc);
+
+    using U = real_t<Tex>;
+    U h_alpha(1), h_beta(2);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasHerkEx(nullptr, uplo, transA, N, K, &h_alpha, dA, aType, lda,
+                                        &h_beta, dC, cType, ldc, computeType),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasHerkEx(handle, HIPBLAS_FILL_MODE_FULL, transA, N, K, &h_alpha,
+                                        dA, aType, lda, &h_beta, dC, cType, ldc, computeType),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasHerkEx(handle, uplo, HIPBLAS_OP_T, N, K, &h_alpha, dA, aType,
+                                        lda, &h_beta, dC, cType, ldc, computeType),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasHerkEx(handle, uplo, transA, N, K, nullptr, dA, aType, lda,
+                                        &h_beta, dC, cType, ldc, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasHerkEx(handle, uplo, transA, N, K, &h_alpha, dA, aType, lda,
+                                        nullptr, dC, cType, ldc, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasHerkEx(handle, uplo, transA, N, K, &h_alpha, dA, aType, lda,
+                                        &h_beta, dC, cType, N - 1, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // real C isn't supported
+    EXPECT_HIPBLAS_STATUS(hipblasHerkEx(handle, uplo, transA, N, K, &h_alpha, dA, aType, lda,
+                                        &h_beta, dC, HIP_R_32F, ldc, computeType),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // With N == 0, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasHerkEx(handle, uplo, transA, 0, K, nullptr, nullptr, aType, lda,
+                                      nullptr, nullptr, cType, ldc, computeType));
+
+    // clang-format on
+#endif
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_herk_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasFillMode_t  uplo   = char2hipblas_fill(arg.uplo);
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldc    = arg.ldc;
+
+    hipDataType          a_type       = arg.a_type;
+    hipDataType          c_type       = arg.c_type;
+    hipblasComputeType_t compute_type = arg.compute_type_gemm;
+
+    hipblasLocalHandle handle(arg);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    int  rows_a       = transA == HIPBLAS_OP_N ? N : K;
+    bool invalid_size = N < 0 || K < 0 || ldc < N || ldc < 1 || lda < rows_a || lda < 1;
+    if(invalid_size || !N)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasHerkEx(handle,
+                                            uplo,
+                                            transA,
+                                            N,
+                                            K,
+                                            nullptr,
+                                            nullptr,
+                                            a_type,
+                                            lda,
+                                            nullptr,
+                                            nullptr,
+                                            c_type,
+                                            ldc,
+                                            compute_type),
+                              invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    int rows = transA == HIPBLAS_OP_N ? N : std::max(K, 1);
+    int cols = transA == HIPBLAS_OP_N ? std::max(K, 1) : N;
+
+    // alpha and beta are real
+    using U = real_t<Tex>;
+
+    U h_alpha = arg.get_alpha<U>();
+    U h_beta  = arg.get_beta<U>();
+
+    // Naming: dA is in GPU (device) memory. hA is in CPU (host) memory
+    host_matrix<Ti> hA(rows, cols, lda);
+    host_matrix<To> hC(N, N, ldc);
+    host_matrix<To> hC_gold(N, N, ldc);
+    host_matrix<To> hC_host(N, N, ldc);
+    host_matrix<To> hC_device(N, N, ldc);
+
+    device_matrix<Ti>  dA(rows, cols, lda);
+    device_matrix<To>  dC(N, N, ldc);
+    device_vector<U>   d_alpha(1);
+    device_vector<U>   d_beta(1);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(hC, arg, hipblas_client_beta_sets_nan, hipblas_hermitian_matrix, false);
+    hC_gold = hC;
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(U), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(U), hipMemcpyHostToDevice));
+
+    ref_syrk_ex<Ti, To, Tex>(uplo,
+                             transA,
+                             true,
+                             false,
+                             N,
+                             K,
+                             Tex(h_alpha),
+                             hA,
+                             lda,
+                             hA,
+                             lda,
+                             Tex(h_beta),
+                             hC_gold,
+                             ldc);
+
+    auto herk = [&](const U* alpha, const U* beta) {
+        return hipblasHerkEx(handle,
+                             uplo,
+                             transA,
+                             N,
+                             K,
+                             alpha,
+                             dA,
+                             a_type,
+                             lda,
+                             beta,
+                             dC,
+                             c_type,
+                             ldc,
+                             compute_type);
+    };
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(herk(&h_alpha, &h_beta));
+    CHECK_HIP_ERROR(hC_host.transfer_from(dC));
+
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(herk(d_alpha, d_beta));
+    CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+
+    // the triangle that isn't updated must be left as it was
+    unit_check_general<To>(N, N, ldc, hC_gold, hC_host);
+    unit_check_general<To>(N, N, ldc, hC_gold, hC_device);
+#endif
+}
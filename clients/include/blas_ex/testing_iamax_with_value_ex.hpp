@@ -0,0 +1,212 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasIamaxWithValueExModel
+    = ArgumentModel<e_a_type, e_compute_type, e_N, e_incx, e_stride_scale, e_batch_count>;
+
+inline void testname_iamax_with_value_ex(const Arguments& arg, std::string& name)
+{
+    hipblasIamaxWithValueExModel{}.test_name(arg, name);
+}
+
+template <typename T, typename Tv = T>
+void testing_iamax_with_value_ex_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType xType     = arg.a_type;
+    hipDataType valueType = arg.compute_type;
+
+    int N = 100, incx = 1, batch_count = 2;
+
+    hipblasStride stridex = N;
+
+    device_strided_batch_vector<T> dx(N, incx, stridex, batch_count);
+
+    int h_result[2];
+    Tv  h_value[2];
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasIamaxStridedBatchedExWithValue(nullptr, N, dx, xType, incx,
+                                                                stridex, h_result, h_value,
+                                                                valueType, batch_count),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasIamaxStridedBatchedExWithValue(handle, N, nullptr, xType, incx,
+                                                                stridex, h_result, h_value,
+                                                                valueType, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasIamaxStridedBatchedExWithValue(handle, N, dx, xType, incx,
+                                                                stridex, nullptr, h_value,
+                                                                valueType, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasIaminStridedBatchedExWithValue(handle, N, dx, xType, incx,
+                                                                stridex, h_result, nullptr,
+                                                                valueType, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasIaminStridedBatchedExWithValue(handle, N, dx, xType, incx,
+                                                                stridex, h_result, h_value,
+                                                                valueType, -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // the values are of the type of x, or float for half and bfloat16
+    EXPECT_HIPBLAS_STATUS(hipblasIamaxExWithValue(handle, N, dx, xType, incx, h_result, h_value,
+                                                  HIP_R_8I),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // With batchCount == 0, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasIamaxBatchedExWithValue(handle, N, nullptr, xType, incx, nullptr,
+                                                       nullptr, valueType, 0));
+
+    // clang-format on
+#endif
+}
+
+template <typename T, typename Tv = T>
+void testing_iamax_with_value_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    int N           = arg.N;
+    int incx        = arg.incx;
+    int batch_count = arg.batch_count;
+
+    hipDataType xType     = arg.a_type;
+    hipDataType valueType = arg.compute_type;
+
+    hipblasLocalHandle handle(arg);
+
+    int           abs_incx = incx < 0 ? -incx : incx;
+    hipblasStride stridex  = hipblasStride(N) * abs_incx * arg.stride_scale;
+
+    // as for iamax, the indices are zero when N or incx isn't positive, and so are the values
+    if(N <= 0 || incx <= 0 || batch_count <= 0)
+    {
+        int              batches = std::max(batch_count, 1);
+        host_vector<int> h_result(batches);
+        host_vector<int> h_zero(batches);
+        for(int b = 0; b < batches; b++)
+        {
+            h_result[b] = 1;
+            h_zero[b]   = batch_count > 0 ? 0 : 1;
+        }
+        host_vector<Tv> h_value(batches);
+        EXPECT_HIPBLAS_STATUS(hipblasIamaxStridedBatchedExWithValue(handle,
+                                                                    N,
+                                                                    nullptr,
+                                                                    xType,
+                                                                    incx,
+                                                                    stridex,
+                                                                    h_result,
+                                                                    h_value,
+                                                                    valueType,
+                                                                    batch_count),
+                              batch_count < 0 ? HIPBLAS_STATUS_INVALID_VALUE
+                                              : HIPBLAS_STATUS_SUCCESS);
+        unit_check_general<int>(1, batches, 1, h_zero, h_result);
+        return;
+    }
+
+    // Naming: dx is in GPU (device) memory. hx is in CPU (host) memory
+    host_strided_batch_vector<T> hx(N, incx, stridex, batch_count);
+    host_batch_vector<T>         hx_batch(N, incx, batch_count);
+    host_vector<int>             result_gold(batch_count);
+    host_vector<int>             result_host(batch_count);
+    host_vector<int>             result_device(batch_count);
+    host_vector<Tv>              value_gold(batch_count);
+    host_vector<Tv>              value_host(batch_count);
+    host_vector<Tv>              value_device(batch_count);
+
+    device_strided_batch_vector<T> dx(N, incx, stridex, batch_count);
+    device_batch_vector<T>         dx_batch(N, incx, batch_count);
+    device_vector<int>             d_result(batch_count);
+    device_vector<Tv>              d_value(batch_count);
+
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx_batch.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_result.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_value.memcheck());
+
+    hipblas_init_vector(hx, arg, hipblas_client_never_set_nan, true);
+    for(int b = 0; b < batch_count; b++)
+        for(int i = 0; i < N; i++)
+            hx_batch[b][i * incx] = hx[b][i * incx];
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dx_batch.transfer_from(hx_batch));
+
+    for(bool amin : {false, true})
+    {
+        auto hipblasStridedBatchedFn = amin ? hipblasIaminStridedBatchedExWithValue
+                                            : hipblasIamaxStridedBatchedExWithValue;
+        auto hipblasBatchedFn
+            = amin ? hipblasIaminBatchedExWithValue : hipblasIamaxBatchedExWithValue;
+
+        for(int b = 0; b < batch_count; b++)
+            ref_iamax_ex_with_value<T, Tv>(
+                N, hx[b], incx, amin, &result_gold[b], &value_gold[b]);
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasStridedBatchedFn(handle,
+                                                    N,
+                                                    dx,
+                                                    xType,
+                                                    incx,
+                                                    stridex,
+                                                    result_host,
+                                                    value_host,
+                                                    valueType,
+                                                    batch_count));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasBatchedFn(handle,
+                                             N,
+                                             dx_batch.ptr_on_device(),
+                                             xType,
+                                             incx,
+                                             d_result,
+                                             d_value,
+                                             valueType,
+                                             batch_count));
+        CHECK_HIP_ERROR(result_device.transfer_from(d_result));
+        CHECK_HIP_ERROR(value_device.transfer_from(d_value));
+
+        // the values are copies of elements of x, so they compare exactly
+        unit_check_general<int>(1, batch_count, 1, result_gold, result_host);
+        unit_check_general<int>(1, batch_count, 1, result_gold, result_device);
+        unit_check_general<Tv>(1, batch_count, 1, value_gold, value_host);
+        unit_check_general<Tv>(1, batch_count, 1, value_gold, value_device);
+    }
+#endif
+}
@@ -0,0 +1,155 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+#include <complex>
+
+/* ============================================================================================ */
+
+using hipblasMatmulTensorModel = ArgumentModel<e_a_type, e_M, e_N, e_K, e_alpha, e_beta>;
+
+inline void testname_matmul_tensor(const Arguments& arg, std::string& name)
+{
+    hipblasMatmulTensorModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_matmul_tensor(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    if constexpr(std::is_same_v<T, float>)
+    {
+        int   M     = arg.M;
+        int   N     = arg.N;
+        int   K     = arg.K;
+        float alpha = arg.alpha;
+        float beta  = arg.beta;
+        if(M < 1 || N < 1 || K < 1)
+            return;
+
+        // A is one matrix broadcast over the batch of B and C
+        const int batch = 2;
+
+        // a matrix of each tensor is column major, row major or strided with neither stride 1,
+        // which is copied, in a buffer of batch_stride elements per matrix
+        enum layout
+        {
+            column_major,
+            row_major,
+            strided
+        };
+        auto strides_of = [](layout l, int64_t rows, int64_t cols, int64_t* strides) {
+            strides[0] = l == column_major ? 1 : l == row_major ? cols + 1 : 2;
+            strides[1] = l == column_major ? rows + 1 : l == row_major ? 1 : 2 * rows;
+        };
+        auto batch_stride = [](int64_t rows, int64_t cols) { return 2 * (rows + 1) * (cols + 1); };
+
+        size_t size_A = batch_stride(M, K), size_B = batch_stride(K, N) * batch;
+        size_t size_C = batch_stride(M, N) * batch;
+
+        // small integers, so the products are exact
+        host_vector<float> hA(size_A), hB(size_B), hC(size_C), hC_gold(size_C), hC_device(size_C);
+        for(size_t i = 0; i < size_A; i++)
+            hA[i] = float(i % 7) - 3;
+        for(size_t i = 0; i < size_B; i++)
+            hB[i] = float(i % 5) - 2;
+        for(size_t i = 0; i < size_C; i++)
+            hC[i] = float(i % 3);
+
+        device_vector<float> dA(size_A), dB(size_B), dC(size_C);
+        CHECK_DEVICE_ALLOCATION(dA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dB.memcheck());
+        CHECK_DEVICE_ALLOCATION(dC.memcheck());
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+        int64_t shape_A[2] = {M, K}, shape_B[3] = {batch, K, N}, shape_C[3] = {batch, M, N};
+        int64_t strides_A[2], strides_B[3], strides_C[3];
+        strides_B[0] = batch_stride(K, N);
+        strides_C[0] = batch_stride(M, N);
+
+        hipblasDLDataType f32{2, 32, 1};
+        hipblasDLDevice   device{10, 0};
+        CHECK_HIP_ERROR(hipGetDevice(&device.deviceId));
+        hipblasDLTensor A{dA, device, 2, f32, shape_A, strides_A, 0};
+        hipblasDLTensor B{dB, device, 3, f32, shape_B, strides_B, 0};
+        hipblasDLTensor C{dC, device, 3, f32, shape_C, strides_C, 0};
+
+        hipblasLocalHandle handle(arg);
+
+        strides_of(column_major, M, K, strides_A);
+        strides_of(column_major, K, N, strides_B + 1);
+        strides_of(column_major, M, N, strides_C + 1);
+        EXPECT_HIPBLAS_STATUS(
+            hipblasMatmulTensor(nullptr, &alpha, &A, &B, &beta, &C, HIPBLAS_COMPUTE_32F),
+            HIPBLAS_STATUS_NOT_INITIALIZED);
+        EXPECT_HIPBLAS_STATUS(
+            hipblasMatmulTensor(handle, &alpha, &A, &B, &beta, nullptr, HIPBLAS_COMPUTE_32F),
+            HIPBLAS_STATUS_INVALID_VALUE);
+
+        // the inner dimensions must agree, and the tensors must be on a device
+        shape_B[1] = K + 1;
+        EXPECT_HIPBLAS_STATUS(
+            hipblasMatmulTensor(handle, &alpha, &A, &B, &beta, &C, HIPBLAS_COMPUTE_32F),
+            HIPBLAS_STATUS_INVALID_VALUE);
+        shape_B[1]          = K;
+        A.device.deviceType = 1;
+        EXPECT_HIPBLAS_STATUS(
+            hipblasMatmulTensor(handle, &alpha, &A, &B, &beta, &C, HIPBLAS_COMPUTE_32F),
+            HIPBLAS_STATUS_NOT_SUPPORTED);
+        A.device.deviceType = 10;
+
+        for(layout la : {column_major, row_major, strided})
+            for(layout lb : {column_major, row_major, strided})
+                for(layout lc : {column_major, row_major, strided})
+                {
+                    strides_of(la, M, K, strides_A);
+                    strides_of(lb, K, N, strides_B + 1);
+                    strides_of(lc, M, N, strides_C + 1);
+
+                    // elements of C outside of the tensor must be left as they are
+                    hC_gold = hC;
+                    for(int b = 0; b < batch; b++)
+                        for(int j = 0; j < N; j++)
+                            for(int i = 0; i < M; i++)
+                            {
+                                float w = 0;
+                                for(int l = 0; l < K; l++)
+                                    w += hA[i * strides_A[0] + l * strides_A[1]]
+                                         * hB[b * strides_B[0] + l * strides_B[1]
+                                              + j * strides_B[2]];
+                                float& c = hC_gold[b * strides_C[0] + i * strides_C[1]
+                                                   + j * strides_C[2]];
+                                c        = alpha * w + beta * c;
+                            }
+
+                    CHECK_HIP_ERROR(dC.transfer_from(hC));
+                    CHECK_HIPBLAS_ERROR(hipblasMatmulTensor(
+                        handle, &alpha, &A, &B, &beta, &C, HIPBLAS_COMPUTE_32F));
+                    CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+                    for(size_t i = 0; i < size_C; i++)
+                        EXPECT_EQ(hC_device[i], hC_gold[i]);
+                }
+    }
+#endif
+}
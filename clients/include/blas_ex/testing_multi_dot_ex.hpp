@@ -0,0 +1,170 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasMultiDotExModel
+    = ArgumentModel<e_a_type, e_compute_type, e_N, e_K, e_incx, e_incy, e_stride_scale>;
+
+inline void testname_multi_dot_ex(const Arguments& arg, std::string& name)
+{
+    hipblasMultiDotExModel{}.test_name(arg, name);
+}
+
+template <typename T, typename Tex = T>
+void testing_multi_dot_ex_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType dataType      = arg.a_type;
+    hipDataType executionType = arg.compute_type;
+
+    int N = 100, K = 2, incx = 1, incy = 1;
+
+    hipblasStride stridey = N;
+
+    device_vector<T>               dx(N, incx);
+    device_strided_batch_vector<T> dy(N, incy, stridey, K);
+
+    Tex h_result[2];
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasMultiDotEx(nullptr, N, K, dx, incx, dy, incy, stridey, h_result,
+                                            dataType, executionType),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasMultiDotEx(handle, N, K, nullptr, incx, dy, incy, stridey,
+                                            h_result, dataType, executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasMultiDotEx(handle, N, K, dx, incx, nullptr, incy, stridey,
+                                            h_result, dataType, executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasMultiDotEx(handle, N, K, dx, incx, dy, incy, stridey, nullptr,
+                                            dataType, executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasMultiDotEx(handle, N, -1, dx, incx, dy, incy, stridey, h_result,
+                                            dataType, executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasMultiDotEx(handle, N, K, dx, incx, dy, incy, stridey, h_result,
+                                            HIP_R_8I, executionType),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // With K == 0, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasMultiDotEx(handle, N, 0, nullptr, incx, nullptr, incy, stridey,
+                                          nullptr, dataType, executionType));
+
+    // clang-format on
+#endif
+}
+
+template <typename T, typename Tex = T>
+void testing_multi_dot_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    int     N    = arg.N;
+    int     K    = arg.K;
+    int64_t incx = arg.incx;
+    int64_t incy = arg.incy;
+
+    hipDataType dataType      = arg.a_type;
+    hipDataType executionType = arg.compute_type;
+
+    hipblasLocalHandle handle(arg);
+
+    int           abs_incy = incy < 0 ? -incy : incy;
+    hipblasStride stridey  = hipblasStride(N) * abs_incy * arg.stride_scale;
+
+    // the results of empty vectors are zero, so result is needed even then
+    if(N <= 0 || K <= 0)
+    {
+        host_vector<Tex> h_result(std::max(K, 1));
+        host_vector<Tex> h_zero(std::max(K, 1));
+        for(int j = 0; j < std::max(K, 1); j++)
+        {
+            h_result[j] = Tex(1);
+            h_zero[j]   = K > 0 ? Tex(0) : Tex(1);
+        }
+        EXPECT_HIPBLAS_STATUS(hipblasMultiDotEx(handle,
+                                                N,
+                                                K,
+                                                nullptr,
+                                                incx,
+                                                nullptr,
+                                                incy,
+                                                stridey,
+                                                h_result,
+                                                dataType,
+                                                executionType),
+                              K < 0 ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS);
+        unit_check_general<Tex>(1, std::max(K, 1), 1, h_zero, h_result);
+        return;
+    }
+
+    // Naming: dx is in GPU (device) memory. hx is in CPU (host) memory
+    host_vector<T>               hx(N, incx);
+    host_strided_batch_vector<T> hy(N, incy, stridey, K);
+    host_vector<Tex>             result_gold(K);
+    host_vector<Tex>             result_host(K);
+    host_vector<Tex>             result_device(K);
+
+    device_vector<T>               dx(N, incx);
+    device_strided_batch_vector<T> dy(N, incy, stridey, K);
+    device_vector<Tex>             d_result(K);
+
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_result.memcheck());
+
+    hipblas_init_vector(hx, arg, hipblas_client_never_set_nan, true);
+    hipblas_init_vector(hy, arg, hipblas_client_never_set_nan, false);
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    ref_multi_dot_ex<T, Tex>(N, K, hx, incx, hy[0], incy, stridey, result_gold);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasMultiDotEx(
+        handle, N, K, dx, incx, dy, incy, stridey, result_host, dataType, executionType));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(hipblasMultiDotEx(
+        handle, N, K, dx, incx, dy, incy, stridey, d_result, dataType, executionType));
+    CHECK_HIP_ERROR(result_device.transfer_from(d_result));
+
+    // the data are small integers, so the sums are exact in any order
+    unit_check_general<Tex>(1, K, 1, result_gold, result_host);
+    unit_check_general<Tex>(1, K, 1, result_gold, result_device);
+#endif
+}
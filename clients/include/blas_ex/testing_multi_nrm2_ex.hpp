@@ -0,0 +1,153 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasMultiNrm2ExModel
+    = ArgumentModel<e_a_type, e_compute_type, e_N, e_K, e_incx, e_stride_scale>;
+
+inline void testname_multi_nrm2_ex(const Arguments& arg, std::string& name)
+{
+    hipblasMultiNrm2ExModel{}.test_name(arg, name);
+}
+
+template <typename T, typename Tr = T>
+void testing_multi_nrm2_ex_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType dataType      = arg.a_type;
+    hipDataType executionType = arg.compute_type;
+
+    int N = 100, K = 2, incx = 1;
+
+    hipblasStride stridex = N;
+
+    device_strided_batch_vector<T> dx(N, incx, stridex, K);
+
+    Tr h_result[2];
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasMultiNrm2Ex(nullptr, N, K, dx, incx, stridex, h_result, dataType,
+                                             executionType),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasMultiNrm2Ex(handle, N, K, nullptr, incx, stridex, h_result,
+                                             dataType, executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasMultiNrm2Ex(handle, N, K, dx, incx, stridex, nullptr, dataType,
+                                             executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasMultiNrm2Ex(handle, N, -1, dx, incx, stridex, h_result, dataType,
+                                             executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // the norms of complex vectors are real
+    EXPECT_HIPBLAS_STATUS(hipblasMultiNrm2Ex(handle, N, K, dx, incx, stridex, h_result, dataType,
+                                             HIP_C_32F),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // With K == 0, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasMultiNrm2Ex(handle, N, 0, nullptr, incx, stridex, nullptr,
+                                           dataType, executionType));
+
+    // clang-format on
+#endif
+}
+
+template <typename T, typename Tr = T>
+void testing_multi_nrm2_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    int N    = arg.N;
+    int K    = arg.K;
+    int incx = arg.incx;
+
+    hipDataType dataType      = arg.a_type;
+    hipDataType executionType = arg.compute_type;
+
+    hipblasLocalHandle handle(arg);
+
+    int           abs_incx = incx < 0 ? -incx : incx;
+    hipblasStride stridex  = hipblasStride(N) * abs_incx * arg.stride_scale;
+
+    // as for nrm2, the norms are zero when N or incx isn't positive
+    if(N <= 0 || incx <= 0 || K <= 0)
+    {
+        host_vector<Tr> h_result(std::max(K, 1));
+        host_vector<Tr> h_zero(std::max(K, 1));
+        for(int j = 0; j < std::max(K, 1); j++)
+        {
+            h_result[j] = Tr(1);
+            h_zero[j]   = K > 0 ? Tr(0) : Tr(1);
+        }
+        EXPECT_HIPBLAS_STATUS(
+            hipblasMultiNrm2Ex(
+                handle, N, K, nullptr, incx, stridex, h_result, dataType, executionType),
+            K < 0 ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS);
+        unit_check_general<Tr>(1, std::max(K, 1), 1, h_zero, h_result);
+        return;
+    }
+
+    // Naming: dx is in GPU (device) memory. hx is in CPU (host) memory
+    host_strided_batch_vector<T> hx(N, incx, stridex, K);
+    host_vector<Tr>              result_gold(K);
+    host_vector<Tr>              result_host(K);
+    host_vector<Tr>              result_device(K);
+
+    device_strided_batch_vector<T> dx(N, incx, stridex, K);
+    device_vector<Tr>              d_result(K);
+
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_result.memcheck());
+
+    hipblas_init_vector(hx, arg, hipblas_client_never_set_nan, true);
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+    ref_multi_nrm2_ex<T, Tr>(N, K, hx[0], incx, stridex, result_gold);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasMultiNrm2Ex(
+        handle, N, K, dx, incx, stridex, result_host, dataType, executionType));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(
+        hipblasMultiNrm2Ex(handle, N, K, dx, incx, stridex, d_result, dataType, executionType));
+    CHECK_HIP_ERROR(result_device.transfer_from(d_result));
+
+    // the data are small integers, so the sums of squares are exact in any order and so are
+    // their correctly rounded square roots
+    unit_check_general<Tr>(1, K, 1, result_gold, result_host);
+    unit_check_general<Tr>(1, K, 1, result_gold, result_device);
+#endif
+}
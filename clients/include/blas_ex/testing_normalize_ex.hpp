@@ -0,0 +1,165 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasNormalizeExModel
+    = ArgumentModel<e_a_type, e_compute_type, e_N, e_incx, e_stride_scale, e_batch_count>;
+
+inline void testname_normalize_ex(const Arguments& arg, std::string& name)
+{
+    hipblasNormalizeExModel{}.test_name(arg, name);
+}
+
+template <typename T, typename Tr = T>
+void testing_normalize_ex_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType dataType      = arg.a_type;
+    hipDataType executionType = arg.compute_type;
+
+    int N = 100, incx = 1, batch_count = 2;
+
+    hipblasStride stridex = N;
+
+    device_strided_batch_vector<T> dx(N, incx, stridex, batch_count);
+
+    Tr h_norm[2];
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasNormalizeEx(nullptr, N, dx, incx, h_norm, dataType,
+                                             executionType),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasNormalizeEx(handle, N, nullptr, incx, h_norm, dataType,
+                                             executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasNormalizeStridedBatchedEx(handle, N, dx, incx, stridex, h_norm,
+                                                           -1, dataType, executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // the norms of complex vectors are real
+    EXPECT_HIPBLAS_STATUS(hipblasNormalizeEx(handle, N, dx, incx, h_norm, dataType, HIP_C_32F),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // With batchCount == 0, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasNormalizeStridedBatchedEx(handle, N, nullptr, incx, stridex,
+                                                         nullptr, 0, dataType, executionType));
+
+    // the norms are optional
+    CHECK_HIPBLAS_ERROR(hipblasNormalizeEx(handle, N, dx, incx, nullptr, dataType,
+                                           executionType));
+
+    // clang-format on
+#endif
+}
+
+template <typename T, typename Tr = T>
+void testing_normalize_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    int N           = arg.N;
+    int incx        = arg.incx;
+    int batch_count = arg.batch_count;
+
+    hipDataType dataType      = arg.a_type;
+    hipDataType executionType = arg.compute_type;
+
+    hipblasLocalHandle handle(arg);
+
+    int           abs_incx = incx < 0 ? -incx : incx;
+    hipblasStride stridex  = hipblasStride(N) * abs_incx * arg.stride_scale;
+
+    // as for nrm2, the norms are zero when N or incx isn't positive
+    if(N <= 0 || incx <= 0 || batch_count <= 0)
+    {
+        int             batches = std::max(batch_count, 1);
+        host_vector<Tr> h_norm(batches);
+        host_vector<Tr> h_zero(batches);
+        for(int b = 0; b < batches; b++)
+        {
+            h_norm[b] = Tr(1);
+            h_zero[b] = batch_count > 0 ? Tr(0) : Tr(1);
+        }
+        EXPECT_HIPBLAS_STATUS(
+            hipblasNormalizeStridedBatchedEx(
+                handle, N, nullptr, incx, stridex, h_norm, batch_count, dataType, executionType),
+            batch_count < 0 ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS);
+        unit_check_general<Tr>(1, batches, 1, h_zero, h_norm);
+        return;
+    }
+
+    // Naming: dx is in GPU (device) memory. hx is in CPU (host) memory
+    host_strided_batch_vector<T> hx(N, incx, stridex, batch_count);
+    host_strided_batch_vector<T> hx_gold(N, incx, stridex, batch_count);
+    host_strided_batch_vector<T> hx_device(N, incx, stridex, batch_count);
+    host_vector<Tr>              norm_gold(batch_count);
+    host_vector<Tr>              norm_host(batch_count);
+    host_vector<Tr>              norm_device(batch_count);
+
+    device_strided_batch_vector<T> dx(N, incx, stridex, batch_count);
+    device_vector<Tr>              d_norm(batch_count);
+
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_norm.memcheck());
+
+    hipblas_init_vector(hx, arg, hipblas_client_never_set_nan, true);
+    hx_gold.copy_from(hx);
+
+    for(int b = 0; b < batch_count; b++)
+        ref_normalize_ex<T, Tr>(N, hx_gold[b], incx, &norm_gold[b]);
+
+    // host pointer mode, one vector at a time
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPBLAS_ERROR(hipblasNormalizeEx(
+            handle, N, dx[b], incx, &norm_host[b], dataType, executionType));
+    CHECK_HIP_ERROR(hx_device.transfer_from(dx));
+
+    // the data are small integers, so the sums of squares are exact in any order and so are
+    // their correctly rounded square roots and the scaled elements
+    unit_check_general<Tr>(1, batch_count, 1, norm_gold, norm_host);
+    unit_check_general<T>(1, N, batch_count, abs_incx, stridex, hx_gold, hx_device);
+
+    // device pointer mode, the whole batch in one call
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(hipblasNormalizeStridedBatchedEx(
+        handle, N, dx, incx, stridex, d_norm, batch_count, dataType, executionType));
+    CHECK_HIP_ERROR(norm_device.transfer_from(d_norm));
+    CHECK_HIP_ERROR(hx_device.transfer_from(dx));
+
+    unit_check_general<Tr>(1, batch_count, 1, norm_gold, norm_device);
+    unit_check_general<T>(1, N, batch_count, abs_incx, stridex, hx_gold, hx_device);
+#endif
+}
@@ -202,6 +202,9 @@ void testing_nrm2_batched_ex(const Arguments& arg)
                     CPU BLAS
         =================================================================== */
 
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_nrm2<Tx, Tr>(N, hx[b], incx, &(h_cpu_result[b]));
@@ -245,11 +248,12 @@ void testing_nrm2_batched_ex(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasNrm2BatchedExFn,
                           (handle,
@@ -261,8 +265,10 @@ void testing_nrm2_batched_ex(const Arguments& arg)
                            d_hipblas_result,
                            resultType,
                            executionType));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasNrm2BatchedExModel{}.log_args<Tx>(std::cout,
                                                  arg,
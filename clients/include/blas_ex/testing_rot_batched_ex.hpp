@@ -282,6 +282,9 @@ void testing_rot_batched_ex(const Arguments& arg)
         CHECK_HIP_ERROR(hy_device.transfer_from(dy));
 
         // CBLAS
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int64_t b = 0; b < batch_count; b++)
         {
             ref_rot<Tx, Tcs, Tcs>(N, hx_cpu[b], incx, hy_cpu[b], incy, *hc, *hs);
@@ -313,11 +316,12 @@ void testing_rot_batched_ex(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             DAPI_DISPATCH(hipblasRotBatchedExFn,
                           (handle,
@@ -333,8 +337,10 @@ void testing_rot_batched_ex(const Arguments& arg)
                            csType,
                            batch_count,
                            executionType));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasRotBatchedExModel{}.log_args<Tx>(std::cout,
                                                 arg,
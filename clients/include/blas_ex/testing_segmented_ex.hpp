@@ -0,0 +1,414 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// hipblasAsumSegmentedEx, hipblasNrm2SegmentedEx, hipblasDotSegmentedEx and hipblasDotcSegmentedEx
+enum class hipblas_segmented_test_op
+{
+    asum,
+    nrm2,
+    dot,
+    dotc
+};
+
+using hipblasNormSegmentedExModel = ArgumentModel<e_a_type, e_compute_type, e_N, e_incx>;
+
+using hipblasDotSegmentedExModel = ArgumentModel<e_a_type, e_compute_type, e_N, e_incx, e_incy>;
+
+inline void testname_asum_segmented_ex(const Arguments& arg, std::string& name)
+{
+    hipblasNormSegmentedExModel{}.test_name(arg, name);
+}
+
+inline void testname_nrm2_segmented_ex(const Arguments& arg, std::string& name)
+{
+    hipblasNormSegmentedExModel{}.test_name(arg, name);
+}
+
+inline void testname_dot_segmented_ex(const Arguments& arg, std::string& name)
+{
+    hipblasDotSegmentedExModel{}.test_name(arg, name);
+}
+
+inline void testname_dotc_segmented_ex(const Arguments& arg, std::string& name)
+{
+    hipblasDotSegmentedExModel{}.test_name(arg, name);
+}
+
+#ifdef HIPBLAS_V2
+
+// The segmented function OP, with y unused by the norms
+template <hipblas_segmented_test_op OP>
+hipblasStatus_t hipblasSegmentedExFn(hipblasHandle_t handle,
+                                     int             n,
+                                     const void*     x,
+                                     int             incx,
+                                     const void*     y,
+                                     int             incy,
+                                     const int*      offsets,
+                                     int             numSegments,
+                                     void*           result,
+                                     hipDataType     dataType,
+                                     hipDataType     executionType)
+{
+    if constexpr(OP == hipblas_segmented_test_op::asum)
+        return hipblasAsumSegmentedEx(
+            handle, n, x, incx, offsets, numSegments, result, dataType, executionType);
+    else if constexpr(OP == hipblas_segmented_test_op::nrm2)
+        return hipblasNrm2SegmentedEx(
+            handle, n, x, incx, offsets, numSegments, result, dataType, executionType);
+    else if constexpr(OP == hipblas_segmented_test_op::dot)
+        return hipblasDotSegmentedEx(
+            handle, n, x, incx, y, incy, offsets, numSegments, result, dataType, executionType);
+    else
+        return hipblasDotcSegmentedEx(
+            handle, n, x, incx, y, incy, offsets, numSegments, result, dataType, executionType);
+}
+
+// The reduction OP of the n elements of x and y, summed in Tr, for incx > 0 and incy > 0
+template <hipblas_segmented_test_op OP, typename T, typename Tr>
+Tr ref_segment_ex(int64_t n, const T* x, int64_t incx, const T* y, int64_t incy)
+{
+    Tr sum = Tr(0);
+    if constexpr(OP == hipblas_segmented_test_op::nrm2)
+        ref_multi_nrm2_ex<T, Tr>(n, 1, x, incx, 0, &sum);
+    else if constexpr(OP == hipblas_segmented_test_op::dotc)
+        ref_multi_dot_ex<T, Tr>(n, 1, y, incy, x, incx, 0, &sum);
+    else
+    {
+        for(int64_t i = 0; i < n; i++)
+        {
+            if constexpr(OP == hipblas_segmented_test_op::dot)
+                sum += ref_blas1_fused_load<T, Tr>(x, n, incx, i)
+                       * ref_blas1_fused_load<T, Tr>(y, n, incy, i);
+            else if constexpr(is_complex<T>)
+                sum += std::abs(std::real(x[i * incx])) + std::abs(std::imag(x[i * incx]));
+            else
+                sum += std::abs(ref_blas1_fused_load<T, Tr>(x, n, incx, i));
+        }
+    }
+    return sum;
+}
+
+template <hipblas_segmented_test_op OP, typename T, typename Tr>
+void testing_segmented_ex_bad_arg(const Arguments& arg)
+{
+    constexpr bool dot
+        = OP == hipblas_segmented_test_op::dot || OP == hipblas_segmented_test_op::dotc;
+
+    hipblasLocalHandle handle(arg);
+
+    hipDataType dataType      = arg.a_type;
+    hipDataType executionType = arg.compute_type;
+
+    int N = 100, numSegments = 2, incx = 1, incy = 1;
+
+    host_vector<int> h_offsets(numSegments + 1);
+    h_offsets[0] = 0;
+    h_offsets[1] = 40;
+    h_offsets[2] = N;
+
+    device_vector<T>   dx(N, incx);
+    device_vector<T>   dy(N, incy);
+    device_vector<int> d_offsets(numSegments + 1);
+    CHECK_HIP_ERROR(d_offsets.transfer_from(h_offsets));
+
+    const T* y = dot ? (const T*)dy : nullptr;
+
+    Tr h_result[2];
+
+    auto fn = hipblasSegmentedExFn<OP>;
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(fn(nullptr, N, dx, incx, y, incy, d_offsets, numSegments, h_result,
+                             dataType, executionType),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(fn(handle, -1, dx, incx, y, incy, d_offsets, numSegments, h_result,
+                             dataType, executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(fn(handle, N, dx, incx, y, incy, d_offsets, -1, h_result, dataType,
+                             executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // the increments must be positive
+    EXPECT_HIPBLAS_STATUS(fn(handle, N, dx, 0, y, incy, d_offsets, numSegments, h_result,
+                             dataType, executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(fn(handle, N, dx, -1, y, incy, d_offsets, numSegments, h_result,
+                             dataType, executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    if(dot)
+        EXPECT_HIPBLAS_STATUS(fn(handle, N, dx, incx, y, -1, d_offsets, numSegments, h_result,
+                                 dataType, executionType),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(fn(handle, N, dx, incx, y, incy, nullptr, numSegments, h_result,
+                             dataType, executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(fn(handle, N, dx, incx, y, incy, d_offsets, numSegments, nullptr,
+                             dataType, executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(fn(handle, N, nullptr, incx, y, incy, d_offsets, numSegments,
+                             h_result, dataType, executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    if(dot)
+        EXPECT_HIPBLAS_STATUS(fn(handle, N, dx, incx, nullptr, incy, d_offsets, numSegments,
+                                 h_result, dataType, executionType),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+    // the norms of complex vectors are real, and there is no 8 bit integer reduction
+    EXPECT_HIPBLAS_STATUS(fn(handle, N, dx, incx, y, incy, d_offsets, numSegments, h_result,
+                             dataType, dot ? HIP_R_8I : HIP_C_32F),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    EXPECT_HIPBLAS_STATUS(fn(handle, N, dx, incx, y, incy, d_offsets, numSegments, h_result,
+                             HIP_R_8I, executionType),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // With numSegments == 0, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(fn(handle, N, nullptr, incx, nullptr, incy, nullptr, 0, nullptr,
+                           dataType, executionType));
+
+    // With N == 0, the vectors aren't read and all the results are zero
+    h_result[0] = h_result[1] = Tr(1);
+    CHECK_HIPBLAS_ERROR(fn(handle, 0, nullptr, incx, nullptr, incy, d_offsets, numSegments,
+                           h_result, dataType, executionType));
+    EXPECT_EQ(h_result[0], Tr(0));
+    EXPECT_EQ(h_result[1], Tr(0));
+
+    // clang-format on
+}
+
+template <hipblas_segmented_test_op OP, typename T, typename Tr>
+void testing_segmented_ex(const Arguments& arg)
+{
+    constexpr bool dot
+        = OP == hipblas_segmented_test_op::dot || OP == hipblas_segmented_test_op::dotc;
+
+    int     N    = arg.N;
+    int64_t incx = arg.incx;
+    int64_t incy = dot ? arg.incy : 1;
+
+    hipDataType dataType      = arg.a_type;
+    hipDataType executionType = arg.compute_type;
+
+    hipblasLocalHandle handle(arg);
+
+    // Segments of lengths cycling through these, from empty to several times the 1024 elements
+    // of a tile of the kernels, over the elements 1, ..., N - 2 of the vectors, ending with the
+    // shorter segment at N - 2 and an empty one
+    const int lengths[] = {0, 1, 5, 0, 0, 100, 1023, 1024, 1025, 3000, 7, 2049};
+
+    std::vector<int> offsets{std::min(N, 1)};
+    for(size_t s = 0; offsets.back() < N - 1; s++)
+        offsets.push_back(std::min(offsets.back() + lengths[s % std::size(lengths)], N - 1));
+    offsets.push_back(offsets.back());
+
+    int numSegments = int(offsets.size()) - 1;
+
+    // Naming: dx is in GPU (device) memory. hx is in CPU (host) memory
+    host_vector<T>   hx(N, incx);
+    host_vector<T>   hy(N, incy);
+    host_vector<int> h_offsets(numSegments + 1);
+    host_vector<Tr>  result_gold(numSegments);
+    host_vector<Tr>  result_host(numSegments);
+    host_vector<Tr>  result_device(numSegments);
+
+    device_vector<T>   dx(N, incx);
+    device_vector<T>   dy(N, incy);
+    device_vector<int> d_offsets(numSegments + 1);
+    device_vector<Tr>  d_result(numSegments);
+
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_offsets.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_result.memcheck());
+
+    std::copy(offsets.begin(), offsets.end(), h_offsets.data());
+    hipblas_init_vector(hx, arg, hipblas_client_never_set_nan, true);
+    hipblas_init_vector(hy, arg, hipblas_client_never_set_nan, false);
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(d_offsets.transfer_from(h_offsets));
+
+    const T* y = dot ? (const T*)dy : nullptr;
+
+    // the gold results are those of each segment on its own
+    for(int s = 0; s < numSegments; s++)
+        result_gold[s] = ref_segment_ex<OP, T, Tr>(offsets[s + 1] - offsets[s],
+                                                   hx.data() + offsets[s] * incx,
+                                                   incx,
+                                                   hy.data() + offsets[s] * incy,
+                                                   incy);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasSegmentedExFn<OP>(handle,
+                                                 N,
+                                                 dx,
+                                                 incx,
+                                                 y,
+                                                 incy,
+                                                 d_offsets,
+                                                 numSegments,
+                                                 result_host,
+                                                 dataType,
+                                                 executionType));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(hipblasSegmentedExFn<OP>(handle,
+                                                 N,
+                                                 dx,
+                                                 incx,
+                                                 y,
+                                                 incy,
+                                                 d_offsets,
+                                                 numSegments,
+                                                 d_result,
+                                                 dataType,
+                                                 executionType));
+    CHECK_HIP_ERROR(result_device.transfer_from(d_result));
+
+    // the data are small integers, so the sums are exact in any order and so are the correctly
+    // rounded square roots of the norms
+    unit_check_general<Tr>(1, numSegments, 1, result_gold, result_host);
+    unit_check_general<Tr>(1, numSegments, 1, result_gold, result_device);
+
+    // the same segments reduced one by one by the BLAS 1 functions, which exist for the vectors
+    // computed in their own precision
+    if constexpr(std::is_same_v<real_t<T>, real_t<Tr>>)
+    {
+        host_vector<Tr> result_loop(numSegments);
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        for(int s = 0; s < numSegments; s++)
+        {
+            int      n  = offsets[s + 1] - offsets[s];
+            const T* xs = dx + offsets[s] * incx;
+            const T* ys = dy + offsets[s] * incy;
+            if constexpr(OP == hipblas_segmented_test_op::asum)
+                CHECK_HIPBLAS_ERROR((hipblasAsum<T, Tr>)(handle, n, xs, incx, &result_loop[s]));
+            else if constexpr(OP == hipblas_segmented_test_op::nrm2)
+                CHECK_HIPBLAS_ERROR((hipblasNrm2<T, Tr>)(handle, n, xs, incx, &result_loop[s]));
+            else if constexpr(OP == hipblas_segmented_test_op::dot)
+                CHECK_HIPBLAS_ERROR(hipblasDot<T>(handle, n, xs, incx, ys, incy, &result_loop[s]));
+            else
+                CHECK_HIPBLAS_ERROR(
+                    hipblasDotc<T>(handle, n, xs, incx, ys, incy, &result_loop[s]));
+        }
+
+        // nrm2 may scale the elements as it sums their squares, so its norms are only close
+        for(int s = 0; s < numSegments; s++)
+        {
+            if constexpr(OP == hipblas_segmented_test_op::nrm2)
+                near_check_general<Tr>(1,
+                                       1,
+                                       1,
+                                       &result_loop[s],
+                                       &result_host[s],
+                                       hipblas_type_epsilon<Tr> * 2
+                                           * (offsets[s + 1] - offsets[s]) * result_loop[s]);
+            else
+                unit_check_general<Tr>(1, 1, 1, &result_loop[s], &result_host[s]);
+        }
+    }
+}
+
+#endif
+
+template <typename T, typename Tr = T>
+void testing_asum_segmented_ex_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    testing_segmented_ex_bad_arg<hipblas_segmented_test_op::asum, T, Tr>(arg);
+#endif
+}
+
+template <typename T, typename Tr = T>
+void testing_asum_segmented_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    testing_segmented_ex<hipblas_segmented_test_op::asum, T, Tr>(arg);
+#endif
+}
+
+template <typename T, typename Tr = T>
+void testing_nrm2_segmented_ex_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    testing_segmented_ex_bad_arg<hipblas_segmented_test_op::nrm2, T, Tr>(arg);
+#endif
+}
+
+template <typename T, typename Tr = T>
+void testing_nrm2_segmented_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    testing_segmented_ex<hipblas_segmented_test_op::nrm2, T, Tr>(arg);
+#endif
+}
+
+template <typename T, typename Tex = T>
+void testing_dot_segmented_ex_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    testing_segmented_ex_bad_arg<hipblas_segmented_test_op::dot, T, Tex>(arg);
+#endif
+}
+
+template <typename T, typename Tex = T>
+void testing_dot_segmented_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    testing_segmented_ex<hipblas_segmented_test_op::dot, T, Tex>(arg);
+#endif
+}
+
+template <typename T, typename Tex = T>
+void testing_dotc_segmented_ex_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    testing_segmented_ex_bad_arg<hipblas_segmented_test_op::dotc, T, Tex>(arg);
+#endif
+}
+
+template <typename T, typename Tex = T>
+void testing_dotc_segmented_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    testing_segmented_ex<hipblas_segmented_test_op::dotc, T, Tex>(arg);
+#endif
+}
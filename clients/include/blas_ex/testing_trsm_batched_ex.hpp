@@ -411,6 +411,9 @@ void testing_trsm_batched_ex(const Arguments& arg)
         make_unit_diagonal(uplo, hA);
     }
 
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
     for(int b = 0; b < batch_count; b++)
     {
         // Calculate hB = hA*hX;
@@ -521,6 +524,9 @@ void testing_trsm_batched_ex(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int b = 0; b < batch_count; b++)
         {
             ref_trsm<T>(
@@ -548,13 +554,12 @@ void testing_trsm_batched_ex(const Arguments& arg)
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-            {
-                gpu_time_used = get_time_us_sync(stream);
-            }
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasTrsmBatchedExFn(handle,
                                                        side,
@@ -572,8 +577,10 @@ void testing_trsm_batched_ex(const Arguments& arg)
                                                        dinvA.ptr_on_device(),
                                                        TRSM_BLOCK * K,
                                                        arg.compute_type));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasTrsmBatchedExModel{}.log_args<T>(std::cout,
                                                 arg,
@@ -584,3 +591,9 @@ void testing_trsm_batched_ex(const Arguments& arg)
                                                 hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas_ex/common_trsm_ex.cpp
+extern template void testing_trsm_batched_ex<float>(const Arguments&);
+extern template void testing_trsm_batched_ex<double>(const Arguments&);
+extern template void testing_trsm_batched_ex<hipblasComplex>(const Arguments&);
+extern template void testing_trsm_batched_ex<hipblasDoubleComplex>(const Arguments&);
@@ -386,37 +386,57 @@ void testing_trsm_ex(const Arguments& arg)
     hipblasStride stride_invA = TRSM_BLOCK * TRSM_BLOCK;
     int           blocks      = K / TRSM_BLOCK;
 
-    // Calculate invA
+    // Calculate invA, on the host with backends without trtri
+    hipblasStatus_t trtri_status = HIPBLAS_STATUS_SUCCESS;
     if(blocks > 0)
     {
-        CHECK_HIPBLAS_ERROR(hipblasTrtriStridedBatched<T>(handle,
-                                                          uplo,
-                                                          diag,
-                                                          TRSM_BLOCK,
-                                                          dA,
-                                                          lda,
-                                                          stride_A,
-                                                          dinvA,
-                                                          TRSM_BLOCK,
-                                                          stride_invA,
-                                                          blocks));
+        trtri_status = hipblasTrtriStridedBatched<T>(handle,
+                                                     uplo,
+                                                     diag,
+                                                     TRSM_BLOCK,
+                                                     dA,
+                                                     lda,
+                                                     stride_A,
+                                                     dinvA,
+                                                     TRSM_BLOCK,
+                                                     stride_invA,
+                                                     blocks);
     }
 
-    if(K % TRSM_BLOCK != 0 || blocks == 0)
+    if(trtri_status == HIPBLAS_STATUS_SUCCESS && (K % TRSM_BLOCK != 0 || blocks == 0))
     {
-        CHECK_HIPBLAS_ERROR(hipblasTrtriStridedBatched<T>(handle,
-                                                          uplo,
-                                                          diag,
-                                                          K - TRSM_BLOCK * blocks,
-                                                          dA + stride_A * blocks,
-                                                          lda,
-                                                          stride_A,
-                                                          dinvA + stride_invA * blocks,
-                                                          TRSM_BLOCK,
-                                                          stride_invA,
-                                                          1));
+        trtri_status = hipblasTrtriStridedBatched<T>(handle,
+                                                     uplo,
+                                                     diag,
+                                                     K - TRSM_BLOCK * blocks,
+                                                     dA + stride_A * blocks,
+                                                     lda,
+                                                     stride_A,
+                                                     dinvA + stride_invA * blocks,
+                                                     TRSM_BLOCK,
+                                                     stride_invA,
+                                                     1);
     }
 
+    if(trtri_status == HIPBLAS_STATUS_NOT_SUPPORTED)
+    {
+        host_vector<T> hinvA(size_t(TRSM_BLOCK) * K);
+        for(int j0 = 0; j0 < K; j0 += TRSM_BLOCK)
+        {
+            int jb    = std::min(TRSM_BLOCK, K - j0);
+            T*  block = hinvA.data() + size_t(j0) * TRSM_BLOCK;
+            for(int j = 0; j < jb; j++)
+                for(int i = 0; i < jb; i++)
+                    block[i + j * TRSM_BLOCK] = hA.data()[j0 + i + size_t(j0 + j) * lda];
+            ref_trtri<T>(
+                hipblas2char_fill(uplo), hipblas2char_diagonal(diag), jb, block, TRSM_BLOCK);
+        }
+        CHECK_HIP_ERROR(
+            hipMemcpy(dinvA, hinvA.data(), sizeof(T) * hinvA.size(), hipMemcpyHostToDevice));
+    }
+    else
+        CHECK_HIPBLAS_ERROR(trtri_status);
+
     if(arg.unit_check || arg.norm_check)
     {
         /* =====================================================================
@@ -488,11 +508,12 @@ void testing_trsm_ex(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasTrsmExFn(handle,
                                                 side,
@@ -509,8 +530,10 @@ void testing_trsm_ex(const Arguments& arg)
                                                 dinvA,
                                                 TRSM_BLOCK * K,
                                                 arg.compute_type));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasTrsmExModel{}.log_args<T>(std::cout,
                                          arg,
@@ -521,3 +544,9 @@ void testing_trsm_ex(const Arguments& arg)
                                          hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas_ex/common_trsm_ex.cpp
+extern template void testing_trsm_ex<float>(const Arguments&);
+extern template void testing_trsm_ex<double>(const Arguments&);
+extern template void testing_trsm_ex<hipblasComplex>(const Arguments&);
+extern template void testing_trsm_ex<hipblasDoubleComplex>(const Arguments&);
@@ -0,0 +1,327 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasTrsmPreparedModel = ArgumentModel<e_a_type,
+                                               e_side,
+                                               e_uplo,
+                                               e_transA,
+                                               e_diag,
+                                               e_M,
+                                               e_N,
+                                               e_alpha,
+                                               e_lda,
+                                               e_ldb,
+                                               e_stride_scale,
+                                               e_batch_count>;
+
+inline void testname_trsm_prepared(const Arguments& arg, std::string& name)
+{
+    hipblasTrsmPreparedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_trsm_prepared_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    int                M            = 101;
+    int                N            = 100;
+    int                lda          = 102;
+    int                ldb          = 103;
+    int                batch_count  = 2;
+    hipblasSideMode_t  side         = HIPBLAS_SIDE_LEFT;
+    hipblasFillMode_t  uplo         = HIPBLAS_FILL_MODE_LOWER;
+    hipblasOperation_t transA       = HIPBLAS_OP_N;
+    hipblasDiagType_t  diag         = HIPBLAS_DIAG_NON_UNIT;
+    hipDataType        compute_type = arg.compute_type;
+
+    int           K        = M;
+    hipblasStride stride_A = hipblasStride(lda) * K;
+    hipblasStride stride_B = hipblasStride(ldb) * N;
+
+    device_strided_batch_matrix<T> dA(K, K, lda, stride_A, batch_count);
+    device_strided_batch_matrix<T> dB(M, N, ldb, stride_B, batch_count);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+
+    const T h_alpha(1);
+
+    // destroying nothing is a no-op
+    CHECK_HIPBLAS_ERROR(hipblasTrsmPreparedDestroy(nullptr));
+
+    hipblasTrsmPrepared_t prepared = nullptr, prepared_batched = nullptr;
+
+    auto create = [&](hipblasFillMode_t uplo_,
+                      hipblasDiagType_t diag_,
+                      int               k_,
+                      void*             A_,
+                      int               lda_,
+                      int               batch_count_,
+                      hipDataType       compute_type_) {
+        prepared = nullptr;
+        return hipblasTrsmPreparedCreate(
+            handle, &prepared, uplo_, diag_, k_, A_, lda_, stride_A, batch_count_, compute_type_);
+    };
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasTrsmPreparedCreate(
+            nullptr, &prepared, uplo, diag, K, dA, lda, stride_A, batch_count, compute_type),
+        HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasTrsmPreparedCreate(
+            handle, nullptr, uplo, diag, K, dA, lda, stride_A, batch_count, compute_type),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        create(HIPBLAS_FILL_MODE_FULL, diag, K, dA, lda, batch_count, compute_type),
+        HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(create(uplo,
+                                 (hipblasDiagType_t)HIPBLAS_FILL_MODE_FULL,
+                                 K,
+                                 dA,
+                                 lda,
+                                 batch_count,
+                                 compute_type),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(create(uplo, diag, K, dA, lda, batch_count, HIP_R_16F),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+    EXPECT_HIPBLAS_STATUS(create(uplo, diag, -1, dA, lda, batch_count, compute_type),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(create(uplo, diag, K, dA, K - 1, batch_count, compute_type),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(create(uplo, diag, K, dA, lda, 0, compute_type),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(create(uplo, diag, K, nullptr, lda, batch_count, compute_type),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(prepared, nullptr);
+
+    // an empty matrix doesn't need A
+    CHECK_HIPBLAS_ERROR(create(uplo, diag, 0, nullptr, 1, batch_count, compute_type));
+    EXPECT_NE(prepared, nullptr);
+    CHECK_HIPBLAS_ERROR(hipblasTrsmPreparedDestroy(prepared));
+
+    CHECK_HIPBLAS_ERROR(create(uplo, diag, K, dA, lda, batch_count, compute_type));
+    prepared_batched = prepared;
+    CHECK_HIPBLAS_ERROR(create(uplo, diag, K, dA, lda, 1, compute_type));
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasTrsmPreparedEx(nullptr, prepared, side, transA, M, N, &h_alpha, dB, ldb),
+        HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasTrsmPreparedEx(handle, nullptr, side, transA, M, N, &h_alpha, dB, ldb),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    // trsmPreparedEx solves with a single matrix
+    EXPECT_HIPBLAS_STATUS(
+        hipblasTrsmPreparedEx(handle, prepared_batched, side, transA, M, N, &h_alpha, dB, ldb),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasTrsmPreparedEx(
+            handle, prepared, HIPBLAS_SIDE_BOTH, transA, M, N, &h_alpha, dB, ldb),
+        HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasTrsmPreparedEx(handle,
+                                                prepared,
+                                                side,
+                                                (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                                                M,
+                                                N,
+                                                &h_alpha,
+                                                dB,
+                                                ldb),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    // the order of A must match B
+    EXPECT_HIPBLAS_STATUS(
+        hipblasTrsmPreparedEx(handle, prepared, side, transA, M - 1, N, &h_alpha, dB, ldb),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasTrsmPreparedEx(
+            handle, prepared, HIPBLAS_SIDE_RIGHT, transA, M, N, &h_alpha, dB, ldb),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasTrsmPreparedEx(handle, prepared, side, transA, M, N, &h_alpha, dB, M - 1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasTrsmPreparedStridedBatchedEx(
+            nullptr, prepared_batched, side, transA, M, N, &h_alpha, dB, ldb, stride_B),
+        HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasTrsmPreparedStridedBatchedEx(
+            handle, nullptr, side, transA, M, N, &h_alpha, dB, ldb, stride_B),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasTrsmPreparedStridedBatchedEx(
+            handle, prepared_batched, HIPBLAS_SIDE_BOTH, transA, M, N, &h_alpha, dB, ldb, stride_B),
+        HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasTrsmPreparedStridedBatchedEx(handle,
+                                            prepared_batched,
+                                            side,
+                                            (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                                            M,
+                                            N,
+                                            &h_alpha,
+                                            dB,
+                                            ldb,
+                                            stride_B),
+        HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasTrsmPreparedStridedBatchedEx(
+            handle, prepared_batched, side, transA, M - 1, N, &h_alpha, dB, ldb, stride_B),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasTrsmPreparedStridedBatchedEx(
+            handle, prepared_batched, side, transA, M, N, &h_alpha, dB, M - 1, stride_B),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    CHECK_HIPBLAS_ERROR(hipblasTrsmPreparedDestroy(prepared));
+    CHECK_HIPBLAS_ERROR(hipblasTrsmPreparedDestroy(prepared_batched));
+#endif
+}
+
+template <typename T>
+void testing_trsm_prepared(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasSideMode_t  side         = char2hipblas_side(arg.side);
+    hipblasFillMode_t  uplo         = char2hipblas_fill(arg.uplo);
+    hipblasOperation_t transA       = char2hipblas_operation(arg.transA);
+    hipblasDiagType_t  diag         = char2hipblas_diagonal(arg.diag);
+    int                M            = arg.M;
+    int                N            = arg.N;
+    int                lda          = arg.lda;
+    int                ldb          = arg.ldb;
+    double             stride_scale = arg.stride_scale;
+    int                batch_count  = arg.batch_count;
+    hipDataType        compute_type = arg.compute_type;
+
+    T h_alpha = arg.get_alpha<T>();
+
+    int K = (side == HIPBLAS_SIDE_LEFT ? M : N);
+
+    hipblasStride stride_A = size_t(lda) * K * stride_scale;
+    hipblasStride stride_B = size_t(ldb) * N * stride_scale;
+
+    // the invalid sizes are checked by the bad_arg test
+    if(M <= 0 || N <= 0 || lda < K || ldb < M || batch_count <= 0)
+        return;
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    host_strided_batch_matrix<T> hA(K, K, lda, stride_A, batch_count);
+    host_strided_batch_matrix<T> hB(M, N, ldb, stride_B, batch_count);
+    host_strided_batch_matrix<T> hB_trsm(M, N, ldb, stride_B, batch_count);
+    host_strided_batch_matrix<T> hB_prepared(M, N, ldb, stride_B, batch_count);
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hB_trsm.memcheck());
+    CHECK_HIP_ERROR(hB_prepared.memcheck());
+
+    device_strided_batch_matrix<T> dA(K, K, lda, stride_A, batch_count);
+    device_strided_batch_matrix<T> dB_trsm(M, N, ldb, stride_B, batch_count);
+    device_strided_batch_matrix<T> dB_prepared(M, N, ldb, stride_B, batch_count);
+    device_vector<T>               d_alpha(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB_trsm.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB_prepared.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+
+    hipblasLocalHandle handle(arg);
+
+    hipblas_init_matrix(
+        hA, arg, hipblas_client_never_set_nan, hipblas_diagonally_dominant_triangular_matrix, true);
+    hipblas_init_matrix(hB, arg, hipblas_client_never_set_nan, hipblas_general_matrix);
+    if(diag == HIPBLAS_DIAG_UNIT)
+        make_unit_diagonal(uplo, hA);
+
+    // B = op(A) * X / alpha, so that the solution X is well conditioned
+    for(int b = 0; b < batch_count; b++)
+        ref_trmm<T>(
+            side, uplo, transA, diag, M, N, T(1.0) / h_alpha, (const T*)hA[b], lda, hB[b], ldb);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    // the inverses are computed once and used by every solve below
+    hipblasTrsmPrepared_t prepared, prepared_batched;
+    CHECK_HIPBLAS_ERROR(hipblasTrsmPreparedCreate(
+        handle, &prepared, uplo, diag, K, dA, lda, stride_A, 1, compute_type));
+    CHECK_HIPBLAS_ERROR(hipblasTrsmPreparedCreate(
+        handle, &prepared_batched, uplo, diag, K, dA, lda, stride_A, batch_count, compute_type));
+
+    real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+    double    tolerance = eps * 40 * M;
+
+    for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, pointer_mode));
+        const T* alpha = pointer_mode == HIPBLAS_POINTER_MODE_HOST ? &h_alpha : d_alpha;
+
+        // the first matrix alone, against trsm
+        CHECK_HIP_ERROR(dB_trsm.transfer_from(hB));
+        CHECK_HIP_ERROR(dB_prepared.transfer_from(hB));
+        CHECK_HIPBLAS_ERROR(
+            hipblasTrsm<T>(handle, side, uplo, transA, diag, M, N, alpha, dA, lda, dB_trsm, ldb));
+        CHECK_HIPBLAS_ERROR(
+            hipblasTrsmPreparedEx(handle, prepared, side, transA, M, N, alpha, dB_prepared, ldb));
+        CHECK_HIP_ERROR(hB_trsm.transfer_from(dB_trsm));
+        CHECK_HIP_ERROR(hB_prepared.transfer_from(dB_prepared));
+
+        double error = norm_check_general<T>('F', M, N, ldb, hB_trsm[0], hB_prepared[0]);
+        unit_check_error(error, tolerance);
+
+        // the batch, against trsmStridedBatched
+        CHECK_HIP_ERROR(dB_trsm.transfer_from(hB));
+        CHECK_HIP_ERROR(dB_prepared.transfer_from(hB));
+        CHECK_HIPBLAS_ERROR(hipblasTrsmStridedBatched<T>(handle,
+                                                         side,
+                                                         uplo,
+                                                         transA,
+                                                         diag,
+                                                         M,
+                                                         N,
+                                                         alpha,
+                                                         dA,
+                                                         lda,
+                                                         stride_A,
+                                                         dB_trsm,
+                                                         ldb,
+                                                         stride_B,
+                                                         batch_count));
+        CHECK_HIPBLAS_ERROR(hipblasTrsmPreparedStridedBatchedEx(
+            handle, prepared_batched, side, transA, M, N, alpha, dB_prepared, ldb, stride_B));
+        CHECK_HIP_ERROR(hB_trsm.transfer_from(dB_trsm));
+        CHECK_HIP_ERROR(hB_prepared.transfer_from(dB_prepared));
+
+        error = norm_check_general<T>(
+            'F', M, N, ldb, stride_B, hB_trsm, hB_prepared, batch_count);
+        unit_check_error(error, tolerance);
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasTrsmPreparedDestroy(prepared));
+    CHECK_HIPBLAS_ERROR(hipblasTrsmPreparedDestroy(prepared_batched));
+#endif
+}
@@ -471,6 +471,9 @@ void testing_trsm_strided_batched_ex(const Arguments& arg)
         make_unit_diagonal(uplo, hA);
     }
 
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
     for(int b = 0; b < batch_count; b++)
     {
         // Calculate hB = hA*hX;
@@ -589,6 +592,9 @@ void testing_trsm_strided_batched_ex(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int b = 0; b < batch_count; b++)
         {
             ref_trsm<T>(
@@ -616,13 +622,12 @@ void testing_trsm_strided_batched_ex(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-            {
-                gpu_time_used = get_time_us_sync(stream);
-            }
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasTrsmStridedBatchedExFn(handle,
                                                               side,
@@ -643,8 +648,10 @@ void testing_trsm_strided_batched_ex(const Arguments& arg)
                                                               invA_size,
                                                               stride_invA,
                                                               arg.compute_type));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasTrsmStridedBatchedExModel{}.log_args<T>(std::cout,
                                                        arg,
@@ -655,3 +662,9 @@ void testing_trsm_strided_batched_ex(const Arguments& arg)
                                                        hipblas_error_device);
     }
 }
+
+// Instantiated in clients/common/blas_ex/common_trsm_ex.cpp
+extern template void testing_trsm_strided_batched_ex<float>(const Arguments&);
+extern template void testing_trsm_strided_batched_ex<double>(const Arguments&);
+extern template void testing_trsm_strided_batched_ex<hipblasComplex>(const Arguments&);
+extern template void testing_trsm_strided_batched_ex<hipblasDoubleComplex>(const Arguments&);
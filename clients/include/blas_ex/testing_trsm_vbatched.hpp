@@ -0,0 +1,297 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <memory>
+#include <vector>
+
+#include "hipblas_unique_ptr.hpp"
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasTrsmVBatchedModel = ArgumentModel<e_a_type,
+                                               e_side,
+                                               e_uplo,
+                                               e_transA,
+                                               e_diag,
+                                               e_M,
+                                               e_N,
+                                               e_alpha,
+                                               e_lda,
+                                               e_ldb,
+                                               e_batch_count>;
+
+inline void testname_trsm_vbatched(const Arguments& arg, std::string& name)
+{
+    hipblasTrsmVBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_trsm_vbatched_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType        dataType    = arg.a_type;
+    hipblasSideMode_t  side        = HIPBLAS_SIDE_LEFT;
+    hipblasFillMode_t  uplo        = HIPBLAS_FILL_MODE_LOWER;
+    hipblasOperation_t transA      = HIPBLAS_OP_N;
+    hipblasDiagType_t  diag        = HIPBLAS_DIAG_NON_UNIT;
+    int                M           = 100;
+    int                N           = 101;
+    int                batch_count = 2;
+
+    device_batch_matrix<T> dA(M, M, M, batch_count);
+    device_batch_matrix<T> dB(M, N, M, batch_count);
+    device_vector<int>     dsize(batch_count);
+
+    auto A = (const void* const*)dA.ptr_on_device();
+    auto B = (void* const*)dB.ptr_on_device();
+
+    T h_alpha(1);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasTrsmVBatched(nullptr, side, uplo, transA, diag, dsize, dsize, M,
+                                              N, &h_alpha, A, dsize, B, dsize, batch_count,
+                                              dataType),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasTrsmVBatched(handle, (hipblasSideMode_t)HIPBLAS_FILL_MODE_FULL,
+                                              uplo, transA, diag, dsize, dsize, M, N, &h_alpha, A,
+                                              dsize, B, dsize, batch_count, dataType),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasTrsmVBatched(handle, side, HIPBLAS_FILL_MODE_FULL, transA, diag,
+                                              dsize, dsize, M, N, &h_alpha, A, dsize, B, dsize,
+                                              batch_count, dataType),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasTrsmVBatched(handle, side, uplo, transA,
+                                              (hipblasDiagType_t)HIPBLAS_FILL_MODE_FULL, dsize,
+                                              dsize, M, N, &h_alpha, A, dsize, B, dsize,
+                                              batch_count, dataType),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasTrsmVBatched(handle, side, uplo, transA, diag, dsize, dsize, -1,
+                                              N, &h_alpha, A, dsize, B, dsize, batch_count,
+                                              dataType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasTrsmVBatched(handle, side, uplo, transA, diag, dsize, dsize, M,
+                                              N, nullptr, A, dsize, B, dsize, batch_count,
+                                              dataType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasTrsmVBatched(handle, side, uplo, transA, diag, dsize, dsize, M,
+                                              N, &h_alpha, A, nullptr, B, dsize, batch_count,
+                                              dataType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // half precision isn't supported
+    EXPECT_HIPBLAS_STATUS(hipblasTrsmVBatched(handle, side, uplo, transA, diag, dsize, dsize, M,
+                                              N, &h_alpha, A, dsize, B, dsize, batch_count,
+                                              HIP_R_16F),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // With maxM == 0, maxN == 0 or batch_count == 0, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasTrsmVBatched(handle, side, uplo, transA, diag, nullptr, nullptr, 0,
+                                            N, nullptr, nullptr, nullptr, nullptr, nullptr,
+                                            batch_count, dataType));
+    CHECK_HIPBLAS_ERROR(hipblasTrsmVBatched(handle, side, uplo, transA, diag, nullptr, nullptr, M,
+                                            0, nullptr, nullptr, nullptr, nullptr, nullptr,
+                                            batch_count, dataType));
+    CHECK_HIPBLAS_ERROR(hipblasTrsmVBatched(handle, side, uplo, transA, diag, nullptr, nullptr, M,
+                                            N, nullptr, nullptr, nullptr, nullptr, nullptr, 0,
+                                            dataType));
+
+    // clang-format on
+#endif
+}
+
+template <typename T>
+void testing_trsm_vbatched(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasSideMode_t  side        = char2hipblas_side(arg.side);
+    hipblasFillMode_t  uplo        = char2hipblas_fill(arg.uplo);
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasDiagType_t  diag        = char2hipblas_diagonal(arg.diag);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                batch_count = arg.batch_count;
+    hipDataType        data_type   = arg.a_type;
+
+    hipblasLocalHandle handle(arg);
+
+    bool invalid_size = M < 0 || N < 0 || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasTrsmVBatched(handle,
+                                                  side,
+                                                  uplo,
+                                                  transA,
+                                                  diag,
+                                                  nullptr,
+                                                  nullptr,
+                                                  M,
+                                                  N,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  nullptr,
+                                                  batch_count,
+                                                  data_type),
+                              invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    T h_alpha = arg.get_alpha<T>();
+
+    // The problems cycle through sizes from 0 up to M by N, so that the launch, which is sized
+    // for M by N, has threads past the end of most of them
+    std::vector<int> m_array(batch_count), n_array(batch_count);
+    std::vector<int> lda_array(batch_count), ldb_array(batch_count);
+
+    std::vector<std::unique_ptr<host_matrix<T>>>   hA(batch_count), hB(batch_count);
+    std::vector<std::unique_ptr<host_matrix<T>>>   hB_gold(batch_count), hB_res(batch_count);
+    std::vector<std::unique_ptr<device_matrix<T>>> dA(batch_count), dB(batch_count);
+
+    std::vector<const void*> A_ptrs(batch_count);
+    std::vector<void*>       B_ptrs(batch_count);
+
+    for(int b = 0; b < batch_count; b++)
+    {
+        m_array[b] = M * (b % 4) / 3;
+        n_array[b] = N * ((b + 1) % 4) / 3;
+
+        // the empty problems still get matrices of one element
+        int m = std::max(m_array[b], 1);
+        int n = std::max(n_array[b], 1);
+        int K = side == HIPBLAS_SIDE_LEFT ? m : n;
+
+        lda_array[b] = std::max<int>(arg.lda, K);
+        ldb_array[b] = std::max<int>(arg.ldb, m);
+
+        hA[b]      = std::make_unique<host_matrix<T>>(K, K, lda_array[b]);
+        hB[b]      = std::make_unique<host_matrix<T>>(m, n, ldb_array[b]);
+        hB_gold[b] = std::make_unique<host_matrix<T>>(m, n, ldb_array[b]);
+        hB_res[b]  = std::make_unique<host_matrix<T>>(m, n, ldb_array[b]);
+        dA[b]      = std::make_unique<device_matrix<T>>(K, K, lda_array[b]);
+        dB[b]      = std::make_unique<device_matrix<T>>(m, n, ldb_array[b]);
+
+        CHECK_DEVICE_ALLOCATION(dA[b]->memcheck());
+        CHECK_DEVICE_ALLOCATION(dB[b]->memcheck());
+
+        hipblas_init_matrix(*hA[b],
+                            arg,
+                            hipblas_client_never_set_nan,
+                            hipblas_diagonally_dominant_triangular_matrix,
+                            true);
+        if(diag == HIPBLAS_DIAG_UNIT)
+            make_unit_diagonal(uplo, (T*)*hA[b], lda_array[b], K);
+        hipblas_init_matrix(*hB[b], arg, hipblas_client_never_set_nan, hipblas_general_matrix);
+        *hB_gold[b] = *hB[b];
+
+        CHECK_HIP_ERROR(dA[b]->transfer_from(*hA[b]));
+
+        A_ptrs[b] = *dA[b];
+        B_ptrs[b] = *dB[b];
+
+        if(m_array[b] && n_array[b])
+            ref_trsm<T>(side,
+                        uplo,
+                        transA,
+                        diag,
+                        m_array[b],
+                        n_array[b],
+                        h_alpha,
+                        *hA[b],
+                        lda_array[b],
+                        *hB_gold[b],
+                        ldb_array[b]);
+    }
+
+    device_vector<int> dm(batch_count), dn(batch_count);
+    device_vector<int> dlda(batch_count), dldb(batch_count);
+    device_vector<T>   d_alpha(1);
+
+    hipblas_unique_ptr dA_ptrs(hipblas::device_malloc(sizeof(void*) * batch_count),
+                               hipblas::device_free);
+    hipblas_unique_ptr dB_ptrs(hipblas::device_malloc(sizeof(void*) * batch_count),
+                               hipblas::device_free);
+
+    size_t int_bytes = sizeof(int) * batch_count, ptr_bytes = sizeof(void*) * batch_count;
+    CHECK_HIP_ERROR(hipMemcpy(dm, m_array.data(), int_bytes, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dn, n_array.data(), int_bytes, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dlda, lda_array.data(), int_bytes, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dldb, ldb_array.data(), int_bytes, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dA_ptrs.get(), A_ptrs.data(), ptr_bytes, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB_ptrs.get(), B_ptrs.data(), ptr_bytes, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+    double    tolerance = eps * 40 * std::max(M, N);
+
+    auto trsm = [&](const T* alpha) {
+        for(int b = 0; b < batch_count; b++)
+            CHECK_HIP_ERROR(dB[b]->transfer_from(*hB[b]));
+
+        CHECK_HIPBLAS_ERROR(hipblasTrsmVBatched(handle,
+                                                side,
+                                                uplo,
+                                                transA,
+                                                diag,
+                                                dm,
+                                                dn,
+                                                M,
+                                                N,
+                                                alpha,
+                                                (const void* const*)dA_ptrs.get(),
+                                                dlda,
+                                                (void* const*)dB_ptrs.get(),
+                                                dldb,
+                                                batch_count,
+                                                data_type));
+
+        // the empty problems are left as they were
+        for(int b = 0; b < batch_count; b++)
+        {
+            CHECK_HIP_ERROR(hB_res[b]->transfer_from(*dB[b]));
+            double error = norm_check_general<T>(
+                'F', hB[b]->m(), hB[b]->n(), ldb_array[b], *hB_gold[b], *hB_res[b]);
+            if(arg.unit_check)
+                unit_check_error(error, tolerance);
+        }
+    };
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    trsm(&h_alpha);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    trsm(d_alpha);
+#endif
+}
@@ -0,0 +1,179 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasWaxpbyExModel
+    = ArgumentModel<e_a_type, e_compute_type, e_N, e_alpha, e_beta, e_incx, e_incy, e_incd>;
+
+inline void testname_waxpby_ex(const Arguments& arg, std::string& name)
+{
+    hipblasWaxpbyExModel{}.test_name(arg, name);
+}
+
+template <typename T, typename Tex = T>
+void testing_waxpby_ex_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType dataType      = arg.a_type;
+    hipDataType executionType = arg.compute_type;
+
+    int N = 100, incx = 1, incy = 1, incw = 1;
+
+    device_vector<T> dx(N, incx);
+    device_vector<T> dy(N, incy);
+    device_vector<T> dw(N, incw);
+
+    Tex h_alpha(1), h_beta(2), h_zero(0);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasWaxpbyEx(nullptr, N, &h_alpha, dx, incx, &h_beta, dy, incy, dw,
+                                          incw, dataType, executionType),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasWaxpbyEx(handle, N, nullptr, dx, incx, &h_beta, dy, incy, dw,
+                                          incw, dataType, executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasWaxpbyEx(handle, N, &h_alpha, dx, incx, nullptr, dy, incy, dw,
+                                          incw, dataType, executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasWaxpbyEx(handle, N, &h_alpha, nullptr, incx, &h_beta, dy, incy,
+                                          dw, incw, dataType, executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasWaxpbyEx(handle, N, &h_alpha, dx, incx, &h_beta, dy, incy,
+                                          nullptr, incw, dataType, executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasWaxpbyEx(handle, N, &h_alpha, dx, incx, &h_beta, dy, incy, dw, 0,
+                                          dataType, executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasWaxpbyEx(handle, N, &h_alpha, dx, incx, &h_beta, dy, incy, dw,
+                                          incw, HIP_R_8I, executionType),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // With beta == 0 on the host, y isn't read and can be nullptr
+    CHECK_HIPBLAS_ERROR(hipblasWaxpbyEx(handle, N, &h_alpha, dx, incx, &h_zero, nullptr, incy,
+                                        dw, incw, dataType, executionType));
+
+    // With N == 0, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasWaxpbyEx(handle, 0, nullptr, nullptr, incx, nullptr, nullptr, incy,
+                                        nullptr, incw, dataType, executionType));
+
+    // clang-format on
+#endif
+}
+
+template <typename T, typename Tex = T>
+void testing_waxpby_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    int     N    = arg.N;
+    int64_t incx = arg.incx;
+    int64_t incy = arg.incy;
+    int64_t incw = arg.incd;
+
+    hipDataType dataType      = arg.a_type;
+    hipDataType executionType = arg.compute_type;
+
+    hipblasLocalHandle handle(arg);
+
+    if(N <= 0)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasWaxpbyEx(handle,
+                                            N,
+                                            nullptr,
+                                            nullptr,
+                                            incx,
+                                            nullptr,
+                                            nullptr,
+                                            incy,
+                                            nullptr,
+                                            incw,
+                                            dataType,
+                                            executionType));
+        return;
+    }
+
+    Tex h_alpha = arg.get_alpha<Tex>();
+    Tex h_beta  = arg.get_beta<Tex>();
+
+    // Naming: dx is in GPU (device) memory. hx is in CPU (host) memory
+    host_vector<T> hx(N, incx);
+    host_vector<T> hy(N, incy);
+    host_vector<T> hw(N, incw);
+    host_vector<T> hw_gold(N, incw);
+    host_vector<T> hw_host(N, incw);
+    host_vector<T> hw_device(N, incw);
+
+    device_vector<T>   dx(N, incx);
+    device_vector<T>   dy(N, incy);
+    device_vector<T>   dw(N, incw);
+    device_vector<Tex> d_alpha(1);
+    device_vector<Tex> d_beta(1);
+
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dw.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    hipblas_init_vector(hx, arg, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_vector(hy, arg, hipblas_client_beta_sets_nan, false);
+    hipblas_init_vector(hw, arg, hipblas_client_never_set_nan, false, true);
+    hw_gold = hw;
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(dw.transfer_from(hw));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Tex), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(Tex), hipMemcpyHostToDevice));
+
+    ref_waxpby_ex<T, Tex>(N, h_alpha, hx, incx, h_beta, hy, incy, hw_gold, incw);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasWaxpbyEx(
+        handle, N, &h_alpha, dx, incx, &h_beta, dy, incy, dw, incw, dataType, executionType));
+    CHECK_HIP_ERROR(hw_host.transfer_from(dw));
+
+    CHECK_HIP_ERROR(dw.transfer_from(hw));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(hipblasWaxpbyEx(
+        handle, N, d_alpha, dx, incx, d_beta, dy, incy, dw, incw, dataType, executionType));
+    CHECK_HIP_ERROR(hw_device.transfer_from(dw));
+
+    int abs_incw = incw < 0 ? -incw : incw;
+    unit_check_general<T>(1, N, abs_incw, hw_gold, hw_host);
+    unit_check_general<T>(1, N, abs_incw, hw_gold, hw_device);
+#endif
+}
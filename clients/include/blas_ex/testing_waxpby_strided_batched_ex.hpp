@@ -0,0 +1,217 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasWaxpbyStridedBatchedExModel = ArgumentModel<e_a_type,
+                                                         e_compute_type,
+                                                         e_N,
+                                                         e_alpha,
+                                                         e_beta,
+                                                         e_incx,
+                                                         e_incy,
+                                                         e_incd,
+                                                         e_stride_scale,
+                                                         e_batch_count>;
+
+inline void testname_waxpby_strided_batched_ex(const Arguments& arg, std::string& name)
+{
+    hipblasWaxpbyStridedBatchedExModel{}.test_name(arg, name);
+}
+
+template <typename T, typename Tex = T>
+void testing_waxpby_strided_batched_ex_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType dataType      = arg.a_type;
+    hipDataType executionType = arg.compute_type;
+
+    int N = 100, incx = 1, incy = 1, incw = 1, batch_count = 2;
+
+    hipblasStride stridex = N, stridey = N, stridew = N;
+
+    device_strided_batch_vector<T> dx(N, incx, stridex, batch_count);
+    device_strided_batch_vector<T> dy(N, incy, stridey, batch_count);
+    device_strided_batch_vector<T> dw(N, incw, stridew, batch_count);
+
+    Tex h_alpha(1), h_beta(2);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasWaxpbyStridedBatchedEx(nullptr, N, &h_alpha, dx, incx, stridex,
+                                                        &h_beta, dy, incy, stridey, dw, incw,
+                                                        stridew, batch_count, dataType,
+                                                        executionType),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasWaxpbyStridedBatchedEx(handle, N, nullptr, dx, incx, stridex,
+                                                        &h_beta, dy, incy, stridey, dw, incw,
+                                                        stridew, batch_count, dataType,
+                                                        executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasWaxpbyStridedBatchedEx(handle, N, &h_alpha, dx, incx, stridex,
+                                                        &h_beta, dy, incy, stridey, nullptr,
+                                                        incw, stridew, batch_count, dataType,
+                                                        executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasWaxpbyStridedBatchedEx(handle, N, &h_alpha, dx, incx, stridex,
+                                                        &h_beta, dy, incy, stridey, dw, incw,
+                                                        stridew, -1, dataType, executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // With batch_count == 0, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasWaxpbyStridedBatchedEx(handle, N, nullptr, nullptr, incx, stridex,
+                                                      nullptr, nullptr, incy, stridey, nullptr,
+                                                      incw, stridew, 0, dataType,
+                                                      executionType));
+
+    // clang-format on
+#endif
+}
+
+template <typename T, typename Tex = T>
+void testing_waxpby_strided_batched_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    int N           = arg.N;
+    int incx        = arg.incx;
+    int incy        = arg.incy;
+    int incw        = arg.incd;
+    int batch_count = arg.batch_count;
+
+    hipDataType dataType      = arg.a_type;
+    hipDataType executionType = arg.compute_type;
+
+    hipblasLocalHandle handle(arg);
+
+    int abs_incx = incx < 0 ? -incx : incx;
+    int abs_incy = incy < 0 ? -incy : incy;
+    int abs_incw = incw < 0 ? -incw : incw;
+
+    hipblasStride stridex = hipblasStride(N) * abs_incx * arg.stride_scale;
+    hipblasStride stridey = hipblasStride(N) * abs_incy * arg.stride_scale;
+    hipblasStride stridew = hipblasStride(N) * abs_incw * arg.stride_scale;
+
+    if(N <= 0 || batch_count <= 0)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasWaxpbyStridedBatchedEx(handle,
+                                                            N,
+                                                            nullptr,
+                                                            nullptr,
+                                                            incx,
+                                                            stridex,
+                                                            nullptr,
+                                                            nullptr,
+                                                            incy,
+                                                            stridey,
+                                                            nullptr,
+                                                            incw,
+                                                            stridew,
+                                                            batch_count,
+                                                            dataType,
+                                                            executionType),
+                              batch_count < 0 ? HIPBLAS_STATUS_INVALID_VALUE
+                                              : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    Tex h_alpha = arg.get_alpha<Tex>();
+    Tex h_beta  = arg.get_beta<Tex>();
+
+    // Naming: dx is in GPU (device) memory. hx is in CPU (host) memory
+    host_strided_batch_vector<T> hx(N, incx, stridex, batch_count);
+    host_strided_batch_vector<T> hy(N, incy, stridey, batch_count);
+    host_strided_batch_vector<T> hw(N, incw, stridew, batch_count);
+    host_strided_batch_vector<T> hw_gold(N, incw, stridew, batch_count);
+    host_strided_batch_vector<T> hw_host(N, incw, stridew, batch_count);
+    host_strided_batch_vector<T> hw_device(N, incw, stridew, batch_count);
+
+    device_strided_batch_vector<T> dx(N, incx, stridex, batch_count);
+    device_strided_batch_vector<T> dy(N, incy, stridey, batch_count);
+    device_strided_batch_vector<T> dw(N, incw, stridew, batch_count);
+    device_vector<Tex>             d_alpha(1);
+    device_vector<Tex>             d_beta(1);
+
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dw.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    hipblas_init_vector(hx, arg, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_vector(hy, arg, hipblas_client_beta_sets_nan, false);
+    hipblas_init_vector(hw, arg, hipblas_client_never_set_nan, false, true);
+    hw_gold.copy_from(hw);
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(dw.transfer_from(hw));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Tex), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(Tex), hipMemcpyHostToDevice));
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(int b = 0; b < batch_count; b++)
+        ref_waxpby_ex<T, Tex>(N, h_alpha, hx[b], incx, h_beta, hy[b], incy, hw_gold[b], incw);
+
+    auto waxpby = [&](const Tex* alpha, const Tex* beta) {
+        return hipblasWaxpbyStridedBatchedEx(handle,
+                                             N,
+                                             alpha,
+                                             dx,
+                                             incx,
+                                             stridex,
+                                             beta,
+                                             dy,
+                                             incy,
+                                             stridey,
+                                             dw,
+                                             incw,
+                                             stridew,
+                                             batch_count,
+                                             dataType,
+                                             executionType);
+    };
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(waxpby(&h_alpha, &h_beta));
+    CHECK_HIP_ERROR(hw_host.transfer_from(dw));
+
+    CHECK_HIP_ERROR(dw.transfer_from(hw));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(waxpby(d_alpha, d_beta));
+    CHECK_HIP_ERROR(hw_device.transfer_from(dw));
+
+    unit_check_general<T>(1, N, batch_count, abs_incw, stridew, hw_gold, hw_host);
+    unit_check_general<T>(1, N, batch_count, abs_incw, stridew, hw_gold, hw_device);
+#endif
+}
@@ -0,0 +1,149 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasXpayExModel = ArgumentModel<e_a_type, e_compute_type, e_N, e_alpha, e_incx, e_incy>;
+
+inline void testname_xpay_ex(const Arguments& arg, std::string& name)
+{
+    hipblasXpayExModel{}.test_name(arg, name);
+}
+
+template <typename T, typename Tex = T>
+void testing_xpay_ex_bad_arg(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    hipblasLocalHandle handle(arg);
+
+    hipDataType dataType      = arg.a_type;
+    hipDataType executionType = arg.compute_type;
+
+    int N = 100, incx = 1, incy = 1;
+
+    device_vector<T> dx(N, incx);
+    device_vector<T> dy(N, incy);
+
+    Tex h_alpha(2);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasXpayEx(nullptr, N, &h_alpha, dx, incx, dy, incy, dataType,
+                                        executionType),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXpayEx(handle, N, nullptr, dx, incx, dy, incy, dataType,
+                                        executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXpayEx(handle, N, &h_alpha, nullptr, incx, dy, incy, dataType,
+                                        executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXpayEx(handle, N, &h_alpha, dx, incx, nullptr, incy, dataType,
+                                        executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXpayEx(handle, N, &h_alpha, dx, incx, dy, 0, dataType,
+                                        executionType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXpayEx(handle, N, &h_alpha, dx, incx, dy, incy, HIP_R_8I,
+                                        executionType),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // With N == 0, can have all nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasXpayEx(handle, 0, nullptr, nullptr, incx, nullptr, incy, dataType,
+                                      executionType));
+
+    // clang-format on
+#endif
+}
+
+template <typename T, typename Tex = T>
+void testing_xpay_ex(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    int     N    = arg.N;
+    int64_t incx = arg.incx;
+    int64_t incy = arg.incy;
+
+    hipDataType dataType      = arg.a_type;
+    hipDataType executionType = arg.compute_type;
+
+    hipblasLocalHandle handle(arg);
+
+    if(N <= 0)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasXpayEx(
+            handle, N, nullptr, nullptr, incx, nullptr, incy, dataType, executionType));
+        return;
+    }
+
+    Tex h_alpha = arg.get_alpha<Tex>();
+
+    // Naming: dx is in GPU (device) memory. hx is in CPU (host) memory
+    host_vector<T> hx(N, incx);
+    host_vector<T> hy(N, incy);
+    host_vector<T> hy_gold(N, incy);
+    host_vector<T> hy_host(N, incy);
+    host_vector<T> hy_device(N, incy);
+
+    device_vector<T>   dx(N, incx);
+    device_vector<T>   dy(N, incy);
+    device_vector<Tex> d_alpha(1);
+
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+
+    hipblas_init_vector(hx, arg, hipblas_client_never_set_nan, true);
+    hipblas_init_vector(hy, arg, hipblas_client_alpha_sets_nan, false);
+    hy_gold = hy;
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Tex), hipMemcpyHostToDevice));
+
+    ref_waxpby_ex<T, Tex>(N, Tex(1), hx, incx, h_alpha, hy_gold, incy, hy_gold, incy);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(
+        hipblasXpayEx(handle, N, &h_alpha, dx, incx, dy, incy, dataType, executionType));
+    CHECK_HIP_ERROR(hy_host.transfer_from(dy));
+
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(
+        hipblasXpayEx(handle, N, d_alpha, dx, incx, dy, incy, dataType, executionType));
+    CHECK_HIP_ERROR(hy_device.transfer_from(dy));
+
+    int abs_incy = incy < 0 ? -incy : incy;
+    unit_check_general<T>(1, N, abs_incy, hy_gold, hy_host);
+    unit_check_general<T>(1, N, abs_incy, hy_gold, hy_device);
+#endif
+}
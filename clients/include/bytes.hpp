@@ -25,6 +25,9 @@
 #define _HIPBLAS_BYTES_H_
 
 #include "hipblas.h"
+#include "type_utils.h"
+
+#include <algorithm>
 
 /*!\file
  * \brief provides bandwidth measure as byte counts Basic Linear Algebra Subprograms (BLAS) of
@@ -438,4 +441,91 @@ constexpr double trtri_gbyte_count(int n)
     return (sizeof(T) * (2 * tri_count(n)));
 }
 
+/*
+ * ===========================================================================
+ *    Solver
+ * ===========================================================================
+ */
+
+/*
+ * The solver functions go over their matrices many times, with blocks in the caches, so their
+ * byte counts are the least traffic they can have, each matrix read and written once.
+ */
+
+/* \brief byte counts of GETRF and GEQRF, of the m by n matrix */
+template <typename T>
+constexpr double getrf_gbyte_count(int64_t m, int64_t n)
+{
+    // read A, write the factors
+    return (sizeof(T) * 2.0 * m * n) / 1e9;
+}
+
+/* \brief byte counts of GETRS */
+template <typename T>
+constexpr double getrs_gbyte_count(int64_t n, int64_t nrhs)
+{
+    // read the factors, read B, write X
+    return (sizeof(T) * (double(n) * n + 2.0 * n * nrhs)) / 1e9;
+}
+
+/* \brief byte counts of GESV */
+template <typename T>
+constexpr double gesv_gbyte_count(int64_t n, int64_t nrhs)
+{
+    // read A, write the factors, read B, write X
+    return (sizeof(T) * (2.0 * n * n + 2.0 * n * nrhs)) / 1e9;
+}
+
+/* \brief byte counts of GETRI and MATINV */
+template <typename T>
+constexpr double getri_gbyte_count(int64_t n)
+{
+    // read A or its factors, write the inverse
+    return (sizeof(T) * 2.0 * n * n) / 1e9;
+}
+
+/* \brief byte counts of POTRF and POTRI */
+template <typename T>
+constexpr double potrf_gbyte_count(int64_t n)
+{
+    // read the triangle of A, write the one of the result
+    return (sizeof(T) * 2.0 * tri_count(n)) / 1e9;
+}
+
+/* \brief byte counts of POTRS */
+template <typename T>
+constexpr double potrs_gbyte_count(int64_t n, int64_t nrhs)
+{
+    // read the factor, read B, write X
+    return (sizeof(T) * (tri_count(n) + 2.0 * n * nrhs)) / 1e9;
+}
+
+/* \brief byte counts of GELS */
+template <typename T>
+constexpr double gels_gbyte_count(int64_t m, int64_t n, int64_t nrhs)
+{
+    // read A, write the factors, read B, write X in B
+    return (sizeof(T) * (2.0 * m * n + 2.0 * std::max(m, n) * nrhs)) / 1e9;
+}
+
+/* \brief byte counts of SYEV, SYEVD and SYEVJ */
+template <typename T>
+constexpr double syev_gbyte_count(int64_t n, bool vectors)
+{
+    // read the triangle of A, write the eigenvalues and the eigenvectors in A
+    return (sizeof(T) * (tri_count(n) + (vectors ? double(n) * n : 0.0))
+            + sizeof(real_t<T>) * n)
+           / 1e9;
+}
+
+/* \brief byte counts of GESVD and GESVDJ, of the m by n matrix */
+template <typename T>
+constexpr double gesvd_gbyte_count(int64_t m, int64_t n, bool vectors)
+{
+    // read A, write the singular values and the min(m, n) first singular vectors
+    double k = std::min(m, n);
+    return (sizeof(T) * (double(m) * n + (vectors ? k * (m + n) : 0.0)) + sizeof(real_t<T>) * k)
+           / 1e9;
+}
+
 #endif /* _HIPBLAS_BYTES_H_ */
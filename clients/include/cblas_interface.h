@@ -159,6 +159,80 @@ void ref_gemv(hipblasOperation_t transA,
               T*                 y,
               int64_t            incy);
 
+// gemv_ex
+// cblas does not support the 16-bit types, so A, x and y are converted to float
+template <typename T>
+inline float ref_gemv_ex_to_float(T val)
+{
+    if constexpr(std::is_same_v<T, hipblasHalf>)
+        return half_to_float(val);
+    else if constexpr(std::is_same_v<T, hipblasBfloat16>)
+        return bfloat16_to_float(val);
+    else
+        return val;
+}
+
+template <typename T>
+inline T ref_gemv_ex_from_float(float val)
+{
+    if constexpr(std::is_same_v<T, hipblasHalf>)
+        return float_to_half(val);
+    else if constexpr(std::is_same_v<T, hipblasBfloat16>)
+        return float_to_bfloat16(val);
+    else
+        return val;
+}
+
+template <typename Ti, typename To = Ti, typename Tc = To>
+inline void ref_gemv_ex(hipblasOperation_t transA,
+                        int64_t            m,
+                        int64_t            n,
+                        Tc                 alpha,
+                        Ti*                A,
+                        int64_t            lda,
+                        Ti*                x,
+                        int64_t            incx,
+                        Tc                 beta,
+                        To*                y,
+                        int64_t            incy)
+{
+    if constexpr(std::is_same_v<Ti, Tc> && std::is_same_v<To, Tc>)
+    {
+        ref_gemv<Tc>(transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
+    }
+    else
+    {
+        int64_t dim_x  = transA == HIPBLAS_OP_N ? n : m;
+        int64_t dim_y  = transA == HIPBLAS_OP_N ? m : n;
+        size_t  size_A = size_t(lda) * n;
+        size_t  size_x = 1 + size_t(dim_x - 1) * std::abs(incx);
+        size_t  size_y = 1 + size_t(dim_y - 1) * std::abs(incy);
+
+        std::vector<float> A_float(size_A), x_float(size_x), y_float(size_y);
+        for(size_t i = 0; i < size_A; i++)
+            A_float[i] = ref_gemv_ex_to_float(A[i]);
+        for(size_t i = 0; i < size_x; i++)
+            x_float[i] = ref_gemv_ex_to_float(x[i]);
+        for(size_t i = 0; i < size_y; i++)
+            y_float[i] = ref_gemv_ex_to_float(y[i]);
+
+        ref_gemv<float>(transA,
+                        m,
+                        n,
+                        alpha,
+                        A_float.data(),
+                        lda,
+                        x_float.data(),
+                        incx,
+                        beta,
+                        y_float.data(),
+                        incy);
+
+        for(size_t i = 0; i < size_y; i++)
+            y[i] = ref_gemv_ex_from_float<To>(y_float[i]);
+    }
+}
+
 template <typename T>
 void ref_symv(hipblasFillMode_t uplo,
               int64_t           n,
@@ -548,6 +622,218 @@ void ref_geam(hipblasOperation_t transa,
               T*                 C,
               int64_t            ldc);
 
+// geam_ex, computed in the type of the scalars Tc. A isn't read when alpha is zero, nor B when
+// beta is zero.
+template <typename Ti, typename To = Ti, typename Tc = To>
+inline void ref_geam_ex(hipblasOperation_t transA,
+                        hipblasOperation_t transB,
+                        int64_t            m,
+                        int64_t            n,
+                        Tc                 alpha,
+                        Ti*                A,
+                        int64_t            lda,
+                        Tc                 beta,
+                        Ti*                B,
+                        int64_t            ldb,
+                        To*                C,
+                        int64_t            ldc)
+{
+    auto load = [](Ti* X, int64_t ldx, hipblasOperation_t trans, int64_t i, int64_t j) {
+        Ti x = trans == HIPBLAS_OP_N ? X[j * ldx + i] : X[i * ldx + j];
+        Tc y;
+        if constexpr(std::is_same_v<Ti, hipblasHalf>)
+            y = half_to_float(x);
+        else if constexpr(std::is_same_v<Ti, hipblasBfloat16>)
+            y = bfloat16_to_float(x);
+        else
+            y = Tc(x);
+        return trans == HIPBLAS_OP_C ? hipblas_conjugate(y) : y;
+    };
+
+    for(int64_t j = 0; j < n; j++)
+    {
+        for(int64_t i = 0; i < m; i++)
+        {
+            Tc c = Tc(0);
+            if(alpha != Tc(0))
+                c = alpha * load(A, lda, transA, i, j);
+            if(beta != Tc(0))
+                c += beta * load(B, ldb, transB, i, j);
+
+            if constexpr(std::is_same_v<To, hipblasHalf>)
+                C[j * ldc + i] = float_to_half(c);
+            else if constexpr(std::is_same_v<To, hipblasBfloat16>)
+                C[j * ldc + i] = float_to_bfloat16(c);
+            else
+                C[j * ldc + i] = To(c);
+        }
+    }
+}
+
+// Fused BLAS 1 Ex functions, computed in Tex. Half and bfloat16 elements are converted to
+// float and rounded back when stored, and negative increments count from the end of the
+// vector as in cblas.
+template <typename T, typename Tex>
+inline Tex ref_blas1_fused_load(const T* x, int64_t n, int64_t incx, int64_t i)
+{
+    T v = x[incx < 0 ? (i - (n - 1)) * incx : i * incx];
+    if constexpr(std::is_same_v<T, hipblasHalf>)
+        return half_to_float(v);
+    else if constexpr(std::is_same_v<T, hipblasBfloat16>)
+        return bfloat16_to_float(v);
+    else
+        return Tex(v);
+}
+
+template <typename T, typename Tex>
+inline void ref_blas1_fused_store(Tex v, T* x, int64_t n, int64_t incx, int64_t i)
+{
+    T& e = x[incx < 0 ? (i - (n - 1)) * incx : i * incx];
+    if constexpr(std::is_same_v<T, hipblasHalf>)
+        e = float_to_half(v);
+    else if constexpr(std::is_same_v<T, hipblasBfloat16>)
+        e = float_to_bfloat16(v);
+    else
+        e = T(v);
+}
+
+// w := alpha * x + beta * y. x isn't read when alpha is zero, nor y when beta is zero.
+template <typename T, typename Tex = T>
+inline void ref_waxpby_ex(int64_t  n,
+                          Tex      alpha,
+                          const T* x,
+                          int64_t  incx,
+                          Tex      beta,
+                          const T* y,
+                          int64_t  incy,
+                          T*       w,
+                          int64_t  incw)
+{
+    for(int64_t i = 0; i < n; i++)
+    {
+        Tex v = Tex(0);
+        if(alpha != Tex(0))
+            v = alpha * ref_blas1_fused_load<T, Tex>(x, n, incx, i);
+        if(beta != Tex(0))
+            v += beta * ref_blas1_fused_load<T, Tex>(y, n, incy, i);
+        ref_blas1_fused_store(v, w, n, incw, i);
+    }
+}
+
+// y := alpha * x + y, then returns y^H * z with y as stored
+template <typename T, typename Tex = T>
+inline Tex ref_axpy_dot_ex(int64_t  n,
+                           Tex      alpha,
+                           const T* x,
+                           int64_t  incx,
+                           T*       y,
+                           int64_t  incy,
+                           const T* z,
+                           int64_t  incz)
+{
+    ref_waxpby_ex<T, Tex>(n, alpha, x, incx, Tex(1), y, incy, y, incy);
+
+    Tex result = Tex(0);
+    for(int64_t i = 0; i < n; i++)
+        result += hipblas_conjugate(ref_blas1_fused_load<T, Tex>(y, n, incy, i))
+                  * ref_blas1_fused_load<T, Tex>(z, n, incz, i);
+    return result;
+}
+
+// result[j] := y_j^H * x for the k vectors y_j, y_j starting stridey after y_(j - 1)
+template <typename T, typename Tex = T>
+inline void ref_multi_dot_ex(int64_t  n,
+                             int64_t  k,
+                             const T* x,
+                             int64_t  incx,
+                             const T* y,
+                             int64_t  incy,
+                             int64_t  stridey,
+                             Tex*     result)
+{
+    for(int64_t j = 0; j < k; j++)
+    {
+        const T* yj = y + j * stridey;
+        result[j]   = Tex(0);
+        for(int64_t i = 0; i < n; i++)
+            result[j] += hipblas_conjugate(ref_blas1_fused_load<T, Tex>(yj, n, incy, i))
+                         * ref_blas1_fused_load<T, Tex>(x, n, incx, i);
+    }
+}
+
+// result[j] := the Euclidean norm of x_j, summed in Tr, for the k vectors x_j with incx > 0
+template <typename T, typename Tr>
+inline void ref_multi_nrm2_ex(
+    int64_t n, int64_t k, const T* x, int64_t incx, int64_t stridex, Tr* result)
+{
+    for(int64_t j = 0; j < k; j++)
+    {
+        Tr sum = Tr(0);
+        for(int64_t i = 0; i < n; i++)
+        {
+            if constexpr(is_complex<T>)
+            {
+                T v = x[j * stridex + i * incx];
+                sum += std::real(v) * std::real(v) + std::imag(v) * std::imag(v);
+            }
+            else
+            {
+                Tr v = ref_blas1_fused_load<T, Tr>(x + j * stridex, n, incx, i);
+                sum += v * v;
+            }
+        }
+        result[j] = std::sqrt(sum);
+    }
+}
+
+// norm := the Euclidean norm of x, summed in Tr, and x := x / norm unless norm is zero, for
+// incx > 0
+template <typename T, typename Tr>
+inline void ref_normalize_ex(int64_t n, T* x, int64_t incx, Tr* norm)
+{
+    ref_multi_nrm2_ex<T, Tr>(n, 1, x, incx, 0, norm);
+    if(*norm == Tr(0))
+        return;
+
+    Tr scale = Tr(1) / *norm;
+    for(int64_t i = 0; i < n; i++)
+    {
+        if constexpr(is_complex<T>)
+            x[i * incx] = T(std::real(x[i * incx]) * scale, std::imag(x[i * incx]) * scale);
+        else
+            ref_blas1_fused_store(
+                scale * ref_blas1_fused_load<T, Tr>(x, n, incx, i), x, n, incx, i);
+    }
+}
+
+// result := the first 1-based index of the element of largest, or with amin smallest,
+// |Re(x_i)| + |Im(x_i)| for incx > 0, and value := x_result converted to Tv
+template <typename T, typename Tv>
+inline void ref_iamax_ex_with_value(
+    int64_t n, const T* x, int64_t incx, bool amin, int* result, Tv* value)
+{
+    int64_t best = 0;
+    double  mag  = 0;
+    for(int64_t i = 0; i < n; i++)
+    {
+        double a;
+        if constexpr(is_complex<T>)
+            a = std::abs(std::real(x[i * incx])) + std::abs(std::imag(x[i * incx]));
+        else
+            a = std::abs(ref_blas1_fused_load<T, double>(x, n, incx, i));
+        if(i == 0 || (amin ? a < mag : a > mag))
+        {
+            best = i;
+            mag  = a;
+        }
+    }
+    *result = int(best + 1);
+    if constexpr(std::is_same_v<T, Tv>)
+        *value = x[best * incx];
+    else
+        *value = ref_blas1_fused_load<T, Tv>(x, n, incx, best);
+}
+
 // gemm
 template <typename Ti, typename To = Ti, typename Tc = To>
 void ref_gemm(hipblasOperation_t transA,
@@ -564,6 +850,47 @@ void ref_gemm(hipblasOperation_t transA,
               To*                C,
               int64_t            ldc);
 
+// syrk_ex, herk_ex and syr2k_ex with ref_gemm: the product op(A) * op(B)^T (op(B)^H for herk)
+// of the full n-by-n matrix, plus op(B) * op(A)^T when rank_2k, is copied into the uplo
+// triangle of C. B is A for syrk and herk, and herk drops the imaginary part of the diagonal.
+template <typename Ti, typename To = Ti, typename Tc = To>
+inline void ref_syrk_ex(hipblasFillMode_t  uplo,
+                        hipblasOperation_t trans,
+                        bool               herk,
+                        bool               rank_2k,
+                        int64_t            n,
+                        int64_t            k,
+                        Tc                 alpha,
+                        Ti*                A,
+                        int64_t            lda,
+                        Ti*                B,
+                        int64_t            ldb,
+                        Tc                 beta,
+                        To*                C,
+                        int64_t            ldc)
+{
+    hipblasOperation_t trans_a = trans;
+    hipblasOperation_t trans_b
+        = trans != HIPBLAS_OP_N ? HIPBLAS_OP_N : (herk ? HIPBLAS_OP_C : HIPBLAS_OP_T);
+
+    std::vector<To> full(C, C + size_t(ldc) * n);
+    ref_gemm<Ti, To, Tc>(trans_a, trans_b, n, n, k, alpha, A, lda, B, ldb, beta, full.data(), ldc);
+    if(rank_2k)
+        ref_gemm<Ti, To, Tc>(
+            trans_a, trans_b, n, n, k, alpha, B, ldb, A, lda, Tc(1), full.data(), ldc);
+
+    for(int64_t j = 0; j < n; j++)
+    {
+        int64_t i_begin = uplo == HIPBLAS_FILL_MODE_LOWER ? j : 0;
+        int64_t i_end   = uplo == HIPBLAS_FILL_MODE_LOWER ? n : j + 1;
+        for(int64_t i = i_begin; i < i_end; i++)
+            C[j * ldc + i] = full[j * ldc + i];
+        if constexpr(is_complex<To>)
+            if(herk)
+                C[j * ldc + j].imag(0);
+    }
+}
+
 // dgmm
 template <typename T>
 void ref_dgmm(hipblasSideMode_t side,
@@ -804,6 +1131,12 @@ void ref_trmm(hipblasSideMode_t  side,
 template <typename T>
 int ref_potrf(char uplo, int m, T* A, int lda);
 
+template <typename T>
+int ref_potrs(char uplo, int n, int nrhs, T* A, int lda, T* B, int ldb);
+
+template <typename T>
+int ref_potri(char uplo, int n, T* A, int lda);
+
 template <typename T>
 int ref_getrf(int m, int n, T* A, int lda, int* ipiv);
 
@@ -819,6 +1152,15 @@ int ref_geqrf(int m, int n, T* A, int lda, T* tau, T* work, int lwork);
 template <typename T>
 int ref_gels(char trans, int m, int n, int nrhs, T* A, int lda, T* B, int ldb, T* work, int lwork);
 
+// heevd for complex T
+template <typename T>
+int ref_syevd(char jobz, char uplo, int n, T* A, int lda, real_t<T>* W);
+
+// V is V^H, with leading dimension ldv
+template <typename T>
+int ref_gesvd(
+    char jobu, char jobvt, int m, int n, T* A, int lda, real_t<T>* S, T* U, int ldu, T* V, int ldv);
+
 #endif
 
 /* ============================================================================================ */
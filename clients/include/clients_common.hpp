@@ -23,10 +23,18 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <vector>
 
 struct Arguments;
 
 void get_test_name(const Arguments& arg, std::string& name);
 
 int run_bench_test(Arguments& arg, int unit_check, int timing);
+
+// hipblas-bench --overhead, in benchmarks/bench_overhead.cpp
+int run_bench_overhead(const Arguments& arg, int calls);
+
+// hipblas-bench --thread_scaling, in benchmarks/bench_scaling.cpp
+int run_bench_thread_scaling(const Arguments& arg, const std::vector<int64_t>& thread_counts);
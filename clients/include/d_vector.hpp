@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include "device_alloc.hpp"
 #include "hipblas_test.hpp"
 
 #include <cinttypes>
@@ -95,7 +96,8 @@ public:
     T* device_vector_setup()
     {
         T* d = nullptr;
-        if(use_HMM ? hipMallocManaged(&d, m_bytes) : (hipMalloc)(&d, m_bytes) != hipSuccess)
+        if((use_HMM ? hipMallocManaged(&d, m_bytes) : device_pool_malloc((void**)&d, m_bytes))
+           != hipSuccess)
         {
             std::cout << "Warning: hip can't allocate " << m_bytes << " bytes (" << (m_bytes >> 30)
                       << " GB)" << std::endl;
@@ -159,8 +161,8 @@ public:
             if(m_pad > 0)
                 d -= m_pad; // restore to start of alloc
 
-            // Free device memory
-            CHECK_HIP_ERROR((hipFree)(d));
+            // Free device memory, or return it to the cache of device_pool_malloc
+            CHECK_HIP_ERROR(use_HMM ? (hipFree)(d) : device_pool_free(d));
         }
     }
 };
@@ -0,0 +1,71 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <hip/hip_runtime_api.h>
+
+//!
+//! @brief Size class of the blocks of the device and pinned host pools. Classes are 256 bytes
+//!        apart below 2 kB, and above it a quarter of the power of 2 at or below the size apart,
+//!        so at most a fifth of a block is unused.
+//!
+inline size_t pool_size_class(size_t size)
+{
+    size_t step = 256;
+    while(step * 8 <= size)
+        step *= 2;
+    return size ? (size + step - 1) / step * step : step;
+}
+
+//!
+//! @brief Allocates device memory on the current device from a cache of blocks freed with
+//!        device_pool_free, with hipMalloc if none of the size class is cached. The cache is
+//!        released by test_cleanup::cleanup(), and is bypassed if HIPBLAS_CLIENT_NO_DEVICE_POOL
+//!        is set, so that leak checkers see each hipMalloc and hipFree.
+//!
+hipError_t device_pool_malloc(void** ptr, size_t size);
+
+//!
+//! @brief Returns memory allocated with device_pool_malloc to the cache, after the device is
+//!        synchronized as hipFree would.
+//!
+hipError_t device_pool_free(void* ptr);
+
+//!
+//! @brief Frees the cached blocks of all devices. Blocks that are in use are kept.
+//!
+hipError_t device_pool_release();
+
+//!
+//! @brief Return the bytes held in the cache, which aren't in use.
+//!
+size_t device_pool_bytes_cached();
+
+//!
+//! @brief Return the bytes of the blocks in use on device, rounded up to their size classes, or
+//!        -1 if HIPBLAS_CLIENT_NO_DEVICE_POOL is set, as they aren't tracked then.
+//!
+int64_t device_pool_bytes_in_use(int device);
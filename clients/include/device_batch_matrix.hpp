@@ -250,12 +250,12 @@ private:
     //!
     bool try_initialize_memory()
     {
-        bool success = false;
+        bool   success = false;
+        size_t bytes   = m_batch_count * sizeof(T*);
 
-        success
-            = (hipSuccess
-               == (!this->use_HMM ? (hipMalloc)(&m_device_data, m_batch_count * sizeof(T*))
-                                  : hipMallocManaged(&m_device_data, m_batch_count * sizeof(T*))));
+        success = (hipSuccess
+                   == (!this->use_HMM ? device_pool_malloc((void**)&m_device_data, bytes)
+                                      : hipMallocManaged(&m_device_data, bytes)));
         if(success)
         {
             success = (nullptr
@@ -338,7 +338,7 @@ private:
         {
             auto tmp_device_data = m_device_data;
             m_device_data        = nullptr;
-            CHECK_HIP_ERROR((hipFree)(tmp_device_data));
+            CHECK_HIP_ERROR(device_pool_free(tmp_device_data));
         }
     }
 };
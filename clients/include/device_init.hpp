@@ -0,0 +1,132 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+#include <cstdint>
+#include <type_traits>
+
+/* ============================================================================================ */
+/*! \brief  Initialize matrices on the device, without host copies, from the counter-based
+ *          generator of hipblas_philox.hpp. The data of hipblas_initialization::rand_int and hpl
+ *          is the data hipblas_counter_rng draws on the host for the same seed. */
+
+//! @brief The element types that hipblas_init_device can fill.
+enum class hipblas_device_init_type
+{
+    f32,
+    f64,
+    f16,
+    bf16,
+    c32,
+    c64,
+    i8,
+};
+
+//! @brief The matrices that hipblas_init_device can fill, those of hipblas_matrix_type but the
+//!        diagonally dominant triangular ones, which need the sums of their rows.
+enum class hipblas_device_init_matrix
+{
+    general,
+    symmetric,
+    hermitian,
+    triangular,
+};
+
+template <typename T>
+constexpr bool hipblas_device_init_supported
+    = std::is_same_v<T, float> || std::is_same_v<T, double> || std::is_same_v<T, hipblasHalf>
+      || std::is_same_v<T, hipblasBfloat16> || std::is_same_v<T, hipblasComplex>
+      || std::is_same_v<T, hipblasDoubleComplex> || std::is_same_v<T, int8_t>;
+
+template <typename T>
+constexpr hipblas_device_init_type hipblas_device_init_type_of()
+{
+    static_assert(hipblas_device_init_supported<T>, "no device initialization of this type");
+
+    if constexpr(std::is_same_v<T, float>)
+        return hipblas_device_init_type::f32;
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblas_device_init_type::f64;
+    else if constexpr(std::is_same_v<T, hipblasHalf>)
+        return hipblas_device_init_type::f16;
+    else if constexpr(std::is_same_v<T, hipblasBfloat16>)
+        return hipblas_device_init_type::bf16;
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblas_device_init_type::c32;
+    else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+        return hipblas_device_init_type::c64;
+    else
+        return hipblas_device_init_type::i8;
+}
+
+//!
+//! @brief Fill the M by N matrices at A on the device with random data, and synchronize.
+//! @param hpl Draw from [-0.5, 0.5) like hipblas_initialization::hpl rather than integers.
+//! @param alternating_sign Negate the elements (i, j) with i + j even, like
+//!        hipblas_init_matrix_alternating_sign. General and triangular matrices only.
+//! @param matrix The shape of the matrices, with the triangle uplo stored as by
+//!        hipblas_init_matrix: 'U', 'L', or both triangles of a symmetric or hermitian matrix
+//!        for any other uplo.
+//!
+hipError_t hipblas_init_device_data(void*                      A,
+                                    hipblas_device_init_type   type,
+                                    int64_t                    M,
+                                    int64_t                    N,
+                                    int64_t                    lda,
+                                    hipblasStride              stride,
+                                    int64_t                    batch_count,
+                                    uint64_t                   seed,
+                                    bool                       hpl,
+                                    bool                       alternating_sign,
+                                    hipblas_device_init_matrix matrix,
+                                    char                       uplo);
+
+template <typename T>
+hipError_t hipblas_init_device(T*                         A,
+                               int64_t                    M,
+                               int64_t                    N,
+                               int64_t                    lda,
+                               hipblasStride              stride,
+                               int64_t                    batch_count,
+                               uint64_t                   seed,
+                               bool                       hpl,
+                               bool                       alternating_sign,
+                               hipblas_device_init_matrix matrix,
+                               char                       uplo)
+{
+    return hipblas_init_device_data(A,
+                                    hipblas_device_init_type_of<T>(),
+                                    M,
+                                    N,
+                                    lda,
+                                    stride,
+                                    batch_count,
+                                    seed,
+                                    hpl,
+                                    alternating_sign,
+                                    matrix,
+                                    uplo);
+}
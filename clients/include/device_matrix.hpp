@@ -143,6 +143,19 @@ public:
                          this->use_HMM ? hipMemcpyHostToHost : hipMemcpyHostToDevice);
     }
 
+    //!
+    //! @brief Transfer data from another device matrix.
+    //! @param that The device matrix.
+    //! @return the hip error.
+    //!
+    hipError_t transfer_from(const device_matrix& that)
+    {
+        return hipMemcpy(m_data,
+                         (const T*)that,
+                         this->nmemb() * sizeof(T),
+                         this->use_HMM ? hipMemcpyHostToHost : hipMemcpyDeviceToDevice);
+    }
+
     hipError_t memcheck() const
     {
         return !this->nmemb() || m_data ? hipSuccess : hipErrorOutOfMemory;
@@ -0,0 +1,406 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "device_init.hpp"
+#include "hipblas.h"
+#include "hipblas_philox.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+/* ============================================================================================ */
+/*! \brief  Reference results computed on the device in double precision, with plain kernels that
+ *          share no code with the library, and checks of results against references on the
+ *          device. Only the errors and the positions of a few mismatches are copied back, so
+ *          large and many-batch sizes are checked without host copies of the matrices or a host
+ *          BLAS. */
+
+//! @brief A scalar of any element type, widened to double.
+struct hipblas_device_scalar
+{
+    double real;
+    double imag;
+};
+
+template <typename T>
+hipblas_device_scalar hipblas_device_scalar_of(const T& x)
+{
+    if constexpr(std::is_same_v<T, hipblasComplex> || std::is_same_v<T, hipblasDoubleComplex>)
+        return {double(x.real()), double(x.imag())};
+    else if constexpr(std::is_same_v<T, hipblasHalf> || std::is_same_v<T, hipblasBfloat16>)
+    {
+        uint16_t bits;
+        std::memcpy(&bits, &x, sizeof(bits));
+        return {std::is_same_v<T, hipblasHalf> ? hipblas_philox_half_float(bits)
+                                                : hipblas_philox_bfloat16_float(bits),
+                0.0};
+    }
+    else
+        return {double(x), 0.0};
+}
+
+//! @brief The type of the references of T computed on the device: double or double complex.
+template <typename T>
+using hipblas_device_wide_t = std::conditional_t<
+    std::is_same_v<T, hipblasComplex> || std::is_same_v<T, hipblasDoubleComplex>,
+    hipblasDoubleComplex,
+    double>;
+
+//! @brief The outcome of an elementwise check on the device.
+struct hipblas_device_check_result
+{
+    static constexpr int max_reported = 8;
+
+    double  max_error; // the largest absolute difference of a real or imaginary part
+    int64_t mismatches; // the number of elements out of tolerance
+    int64_t reported; // the number of mismatches below, the ones of the lowest indices
+    int64_t batch[max_reported];
+    int64_t row[max_reported];
+    int64_t col[max_reported];
+};
+
+inline std::string hipblas_device_check_message(const hipblas_device_check_result& result)
+{
+    std::ostringstream msg;
+    msg << result.mismatches << " elements out of tolerance, max error " << result.max_error
+        << ", first at (batch, row, col)";
+    for(int64_t k = 0; k < result.reported; k++)
+        msg << " (" << result.batch[k] << ", " << result.row[k] << ", " << result.col[k] << ")";
+    return msg.str();
+}
+
+//!
+//! @brief ref = alpha * op(A) * op(B) + beta * C, in double, for batch_count strided matrices.
+//!        C isn't read when beta is 0. ref holds M by N wide elements per batch, with a leading
+//!        dimension of M.
+//!
+hipError_t hipblas_device_reference_gemm_data(hipblas_device_init_type type,
+                                              hipblasOperation_t       transA,
+                                              hipblasOperation_t       transB,
+                                              int64_t                  M,
+                                              int64_t                  N,
+                                              int64_t                  K,
+                                              hipblas_device_scalar    alpha,
+                                              const void*              A,
+                                              int64_t                  lda,
+                                              hipblasStride            strideA,
+                                              const void*              B,
+                                              int64_t                  ldb,
+                                              hipblasStride            strideB,
+                                              hipblas_device_scalar    beta,
+                                              const void*              C,
+                                              int64_t                  ldc,
+                                              hipblasStride            strideC,
+                                              int64_t                  batch_count,
+                                              void*                    ref);
+
+//!
+//! @brief The solution X of op(A) * X = alpha * B or X * op(A) = alpha * B, in double, for
+//!        batch_count strided matrices. Only the triangle uplo of A is read, and not its diagonal
+//!        when diag is unit. ref is laid out as for hipblas_device_reference_gemm_data.
+//!
+hipError_t hipblas_device_reference_trsm_data(hipblas_device_init_type type,
+                                              hipblasSideMode_t        side,
+                                              hipblasFillMode_t        uplo,
+                                              hipblasOperation_t       transA,
+                                              hipblasDiagType_t        diag,
+                                              int64_t                  M,
+                                              int64_t                  N,
+                                              hipblas_device_scalar    alpha,
+                                              const void*              A,
+                                              int64_t                  lda,
+                                              hipblasStride            strideA,
+                                              const void*              B,
+                                              int64_t                  ldb,
+                                              hipblasStride            strideB,
+                                              int64_t                  batch_count,
+                                              void*                    ref);
+
+//!
+//! @brief The relative error ||ref - res|| / ||ref|| of the M by N matrices res of type type, like
+//!        norm_check_general: summed over the batches for the Frobenius norm 'F', and their
+//!        largest for the one norm 'O'. The absolute error is used for a batch whose reference
+//!        is 0, and a NaN in res gives a NaN error. ref is of type type or of its wide type, and
+//!        the stream work of res is waited for first.
+//!
+hipError_t hipblas_device_norm_error_data(char                     norm_type,
+                                          hipblas_device_init_type type,
+                                          int64_t                  M,
+                                          int64_t                  N,
+                                          hipblas_device_init_type ref_type,
+                                          const void*              ref,
+                                          int64_t                  ldref,
+                                          hipblasStride            strideref,
+                                          const void*              res,
+                                          int64_t                  ldres,
+                                          hipblasStride            strideres,
+                                          int64_t                  batch_count,
+                                          double*                  error);
+
+//!
+//! @brief Compare the real and imaginary parts of res and ref elementwise, like
+//!        near_check_general within abs_error, or with unit set like unit_check_general within 4
+//!        units in the last place of the float or double they are compared as. A NaN in ref must
+//!        be a NaN in res. The types and the waiting are as for hipblas_device_norm_error_data.
+//!
+hipError_t hipblas_device_near_check_data(hipblas_device_init_type     type,
+                                          int64_t                      M,
+                                          int64_t                      N,
+                                          hipblas_device_init_type     ref_type,
+                                          const void*                  ref,
+                                          int64_t                      ldref,
+                                          hipblasStride                strideref,
+                                          const void*                  res,
+                                          int64_t                      ldres,
+                                          hipblasStride                strideres,
+                                          int64_t                      batch_count,
+                                          double                       abs_error,
+                                          bool                         unit,
+                                          hipblas_device_check_result* result);
+
+//!
+//! @brief A probabilistic check of C = alpha * op(A) * op(B) + beta * C0, after Freivalds: both
+//!        sides are multiplied by vectors of random signs on the device in double, in O(n^2)
+//!        rather than the O(n^3) of a reference. error is the largest over the rows, batches and
+//!        vectors of |r_i| / (|alpha| (|op(A)| |op(B)| 1)_i + |beta| (|C0| 1)_i + (|C| 1)_i), the
+//!        residual r relative to the sums bounding the rounding errors of a correct C, which are
+//!        below about K units of roundoff. A NaN in C gives a NaN error. C0 isn't read when beta is
+//!        0, and the stream work of C is waited for first.
+//!
+hipError_t hipblas_device_probabilistic_gemm_error_data(hipblas_device_init_type type,
+                                                       hipblasOperation_t       transA,
+                                                       hipblasOperation_t       transB,
+                                                       int64_t                  M,
+                                                       int64_t                  N,
+                                                       int64_t                  K,
+                                                       hipblas_device_scalar    alpha,
+                                                       const void*              A,
+                                                       int64_t                  lda,
+                                                       hipblasStride            strideA,
+                                                       const void*              B,
+                                                       int64_t                  ldb,
+                                                       hipblasStride            strideB,
+                                                       hipblas_device_scalar    beta,
+                                                       const void*              C0,
+                                                       int64_t                  ldc0,
+                                                       hipblasStride            strideC0,
+                                                       const void*              C,
+                                                       int64_t                  ldc,
+                                                       hipblasStride            strideC,
+                                                       int64_t                  batch_count,
+                                                       int                      vectors,
+                                                       double*                  error);
+
+template <typename T>
+hipError_t hipblas_device_reference_gemm(hipblasOperation_t        transA,
+                                         hipblasOperation_t        transB,
+                                         int64_t                   M,
+                                         int64_t                   N,
+                                         int64_t                   K,
+                                         T                         alpha,
+                                         const T*                  A,
+                                         int64_t                   lda,
+                                         hipblasStride             strideA,
+                                         const T*                  B,
+                                         int64_t                   ldb,
+                                         hipblasStride             strideB,
+                                         T                         beta,
+                                         const T*                  C,
+                                         int64_t                   ldc,
+                                         hipblasStride             strideC,
+                                         int64_t                   batch_count,
+                                         hipblas_device_wide_t<T>* ref)
+{
+    return hipblas_device_reference_gemm_data(hipblas_device_init_type_of<T>(),
+                                              transA,
+                                              transB,
+                                              M,
+                                              N,
+                                              K,
+                                              hipblas_device_scalar_of(alpha),
+                                              A,
+                                              lda,
+                                              strideA,
+                                              B,
+                                              ldb,
+                                              strideB,
+                                              hipblas_device_scalar_of(beta),
+                                              C,
+                                              ldc,
+                                              strideC,
+                                              batch_count,
+                                              ref);
+}
+
+template <typename T>
+hipError_t hipblas_device_reference_trsm(hipblasSideMode_t         side,
+                                         hipblasFillMode_t         uplo,
+                                         hipblasOperation_t        transA,
+                                         hipblasDiagType_t         diag,
+                                         int64_t                   M,
+                                         int64_t                   N,
+                                         T                         alpha,
+                                         const T*                  A,
+                                         int64_t                   lda,
+                                         hipblasStride             strideA,
+                                         const T*                  B,
+                                         int64_t                   ldb,
+                                         hipblasStride             strideB,
+                                         int64_t                   batch_count,
+                                         hipblas_device_wide_t<T>* ref)
+{
+    return hipblas_device_reference_trsm_data(hipblas_device_init_type_of<T>(),
+                                              side,
+                                              uplo,
+                                              transA,
+                                              diag,
+                                              M,
+                                              N,
+                                              hipblas_device_scalar_of(alpha),
+                                              A,
+                                              lda,
+                                              strideA,
+                                              B,
+                                              ldb,
+                                              strideB,
+                                              batch_count,
+                                              ref);
+}
+
+template <typename T, typename Tref>
+hipError_t hipblas_device_norm_error(char          norm_type,
+                                     int64_t       M,
+                                     int64_t       N,
+                                     const Tref*   ref,
+                                     int64_t       ldref,
+                                     hipblasStride strideref,
+                                     const T*      res,
+                                     int64_t       ldres,
+                                     hipblasStride strideres,
+                                     int64_t       batch_count,
+                                     double*       error)
+{
+    static_assert(std::is_same_v<Tref, T> || std::is_same_v<Tref, hipblas_device_wide_t<T>>,
+                  "the reference is of the type of the results or of its wide type");
+
+    return hipblas_device_norm_error_data(norm_type,
+                                          hipblas_device_init_type_of<T>(),
+                                          M,
+                                          N,
+                                          hipblas_device_init_type_of<Tref>(),
+                                          ref,
+                                          ldref,
+                                          strideref,
+                                          res,
+                                          ldres,
+                                          strideres,
+                                          batch_count,
+                                          error);
+}
+
+template <typename T, typename Tref>
+hipError_t hipblas_device_near_check(int64_t                      M,
+                                     int64_t                      N,
+                                     const Tref*                  ref,
+                                     int64_t                      ldref,
+                                     hipblasStride                strideref,
+                                     const T*                     res,
+                                     int64_t                      ldres,
+                                     hipblasStride                strideres,
+                                     int64_t                      batch_count,
+                                     double                       abs_error,
+                                     bool                         unit,
+                                     hipblas_device_check_result* result)
+{
+    static_assert(std::is_same_v<Tref, T> || std::is_same_v<Tref, hipblas_device_wide_t<T>>,
+                  "the reference is of the type of the results or of its wide type");
+
+    return hipblas_device_near_check_data(hipblas_device_init_type_of<T>(),
+                                          M,
+                                          N,
+                                          hipblas_device_init_type_of<Tref>(),
+                                          ref,
+                                          ldref,
+                                          strideref,
+                                          res,
+                                          ldres,
+                                          strideres,
+                                          batch_count,
+                                          abs_error,
+                                          unit,
+                                          result);
+}
+
+template <typename T>
+hipError_t hipblas_device_probabilistic_gemm_error(hipblasOperation_t transA,
+                                                   hipblasOperation_t transB,
+                                                   int64_t            M,
+                                                   int64_t            N,
+                                                   int64_t            K,
+                                                   T                  alpha,
+                                                   const T*           A,
+                                                   int64_t            lda,
+                                                   hipblasStride      strideA,
+                                                   const T*           B,
+                                                   int64_t            ldb,
+                                                   hipblasStride      strideB,
+                                                   T                  beta,
+                                                   const T*           C0,
+                                                   int64_t            ldc0,
+                                                   hipblasStride      strideC0,
+                                                   const T*           C,
+                                                   int64_t            ldc,
+                                                   hipblasStride      strideC,
+                                                   int64_t            batch_count,
+                                                   int                vectors,
+                                                   double*            error)
+{
+    return hipblas_device_probabilistic_gemm_error_data(hipblas_device_init_type_of<T>(),
+                                                        transA,
+                                                        transB,
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        hipblas_device_scalar_of(alpha),
+                                                        A,
+                                                        lda,
+                                                        strideA,
+                                                        B,
+                                                        ldb,
+                                                        strideB,
+                                                        hipblas_device_scalar_of(beta),
+                                                        C0,
+                                                        ldc0,
+                                                        strideC0,
+                                                        C,
+                                                        ldc,
+                                                        strideC,
+                                                        batch_count,
+                                                        vectors,
+                                                        error);
+}
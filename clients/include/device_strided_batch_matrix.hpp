@@ -204,6 +204,19 @@ public:
                          this->use_HMM ? hipMemcpyHostToHost : hipMemcpyHostToDevice);
     }
 
+    //!
+    //! @brief Transfer data from another strided batched matrix on device.
+    //! @param that That strided batched matrix on device.
+    //! @return The hip error.
+    //!
+    hipError_t transfer_from(const device_strided_batch_matrix& that)
+    {
+        return hipMemcpy(this->data(),
+                         that.data(),
+                         sizeof(T) * this->nmemb(),
+                         this->use_HMM ? hipMemcpyHostToHost : hipMemcpyDeviceToDevice);
+    }
+
     //!
     //! @brief Broadcast data from one matrix on host to each batch_count matrices.
     //! @param that That matrix on host.
@@ -806,13 +806,13 @@ constexpr double trtri_gflop_count<hipblasDoubleComplex>(int64_t n)
  * ===========================================================================
  */
 
-/* \brief floating point counts of GEQRF */
+/* \brief floating point counts of GEQRF, of the m by n matrix */
 template <typename T>
 constexpr double geqrf_gflop_count(int64_t n, int64_t m)
 {
-    // Calculation is for m == n, using max of m, n for now
-    int64_t k = std::max(m, n);
-    return ((4.0 / 3.0) * k * k * k);
+    // 2mn^2 - 2n^3/3 for m >= n, the LQ-like count of the transpose otherwise
+    double k = std::min(m, n), l = std::max(m, n);
+    return (2.0 * l * k * k - (2.0 / 3.0) * k * k * k) / 1e9;
 }
 
 template <>
@@ -827,11 +827,13 @@ constexpr double geqrf_gflop_count<hipblasDoubleComplex>(int64_t n, int64_t m)
     return 4.0 * geqrf_gflop_count<float>(n, m);
 }
 
-/* \brief floating point counts of GETRF */
+/* \brief floating point counts of GETRF, of the m by n matrix */
 template <typename T>
 constexpr double getrf_gflop_count(int64_t n, int64_t m)
 {
-    return (m * n * n) / 1e9;
+    // mn^2 - n^3/3 for m >= n, so 2n^3/3 for a square matrix
+    double k = std::min(m, n), l = std::max(m, n);
+    return (l * k * k - (1.0 / 3.0) * k * k * k) / 1e9;
 }
 
 template <>
@@ -884,25 +886,138 @@ constexpr double getrs_gflop_count<hipblasDoubleComplex>(int64_t n, int64_t nrhs
     return 4.0 * getrs_gflop_count<float>(n, nrhs);
 }
 
-/* \brief floating point counts of GELS */
+/* \brief floating point counts of GESV, the factorization of GETRF and the solve of GETRS */
 template <typename T>
-constexpr double gels_gflop_count(int64_t m, int64_t n)
+constexpr double gesv_gflop_count(int64_t n, int64_t nrhs)
 {
-    // Not using this for now as better to just use exe. time
-    int64_t k = m >= n ? n : m;
-    return ((2 * m * n * n) - ((2.0 / 3.0) * k * k * k)) / 1e9;
+    return getrf_gflop_count<T>(n, n) + getrs_gflop_count<T>(n, nrhs);
+}
+
+/* \brief floating point counts of POTRF */
+template <typename T>
+constexpr double potrf_gflop_count(int64_t n)
+{
+    return ((1.0 / 3.0) * n * n * n) / 1e9;
+}
+
+template <>
+constexpr double potrf_gflop_count<hipblasComplex>(int64_t n)
+{
+    return 4.0 * potrf_gflop_count<float>(n);
+}
+
+template <>
+constexpr double potrf_gflop_count<hipblasDoubleComplex>(int64_t n)
+{
+    return 4.0 * potrf_gflop_count<float>(n);
+}
+
+/* \brief floating point counts of POTRI */
+template <typename T>
+constexpr double potri_gflop_count(int64_t n)
+{
+    return ((2.0 / 3.0) * n * n * n) / 1e9;
+}
+
+template <>
+constexpr double potri_gflop_count<hipblasComplex>(int64_t n)
+{
+    return 4.0 * potri_gflop_count<float>(n);
+}
+
+template <>
+constexpr double potri_gflop_count<hipblasDoubleComplex>(int64_t n)
+{
+    return 4.0 * potri_gflop_count<float>(n);
+}
+
+/* \brief floating point counts of POTRS */
+template <typename T>
+constexpr double potrs_gflop_count(int64_t n, int64_t nrhs)
+{
+    return (2.0 * n * n * nrhs) / 1e9;
+}
+
+template <>
+constexpr double potrs_gflop_count<hipblasComplex>(int64_t n, int64_t nrhs)
+{
+    return 4.0 * potrs_gflop_count<float>(n, nrhs);
+}
+
+template <>
+constexpr double potrs_gflop_count<hipblasDoubleComplex>(int64_t n, int64_t nrhs)
+{
+    return 4.0 * potrs_gflop_count<float>(n, nrhs);
+}
+
+/* \brief floating point counts of GELS, the QR factorization of GEQRF, the product of Q^H by
+ *  the right hand sides and the triangular solve */
+template <typename T>
+constexpr double gels_gflop_count(int64_t m, int64_t n, int64_t nrhs)
+{
+    double k = std::min(m, n), l = std::max(m, n);
+    return geqrf_gflop_count<float>(n, m) + nrhs * (4.0 * l * k - k * k) / 1e9;
+}
+
+template <>
+constexpr double gels_gflop_count<hipblasComplex>(int64_t m, int64_t n, int64_t nrhs)
+{
+    return 4.0 * gels_gflop_count<float>(m, n, nrhs);
+}
+
+template <>
+constexpr double gels_gflop_count<hipblasDoubleComplex>(int64_t m, int64_t n, int64_t nrhs)
+{
+    return 4.0 * gels_gflop_count<float>(m, n, nrhs);
+}
+
+/*
+ * The eigensolvers and the SVDs are all counted with the flops of the algorithms of reference of
+ * Golub and Van Loan, the symmetric QR algorithm and the Golub-Kahan-Reinsch SVD, whatever the
+ * algorithm of the function, so that the rates of the divide and conquer and Jacobi functions
+ * compare.
+ */
+
+/* \brief floating point counts of SYEV, SYEVD and SYEVJ, with or without the eigenvectors */
+template <typename T>
+constexpr double syev_gflop_count(int64_t n, bool vectors)
+{
+    return (vectors ? 9.0 * n * n * n : (4.0 / 3.0) * n * n * n) / 1e9;
+}
+
+template <>
+constexpr double syev_gflop_count<hipblasComplex>(int64_t n, bool vectors)
+{
+    return 4.0 * syev_gflop_count<float>(n, vectors);
+}
+
+template <>
+constexpr double syev_gflop_count<hipblasDoubleComplex>(int64_t n, bool vectors)
+{
+    return 4.0 * syev_gflop_count<float>(n, vectors);
+}
+
+/* \brief floating point counts of GESVD and GESVDJ, of the m by n matrix, with or without the
+ *  min(m, n) first left and right singular vectors */
+template <typename T>
+constexpr double gesvd_gflop_count(int64_t m, int64_t n, bool vectors)
+{
+    double k = std::min(m, n), l = std::max(m, n);
+    return (vectors ? 14.0 * l * k * k + 8.0 * k * k * k
+                    : 4.0 * l * k * k - (4.0 / 3.0) * k * k * k)
+           / 1e9;
 }
 
 template <>
-constexpr double gels_gflop_count<hipblasComplex>(int64_t m, int64_t n)
+constexpr double gesvd_gflop_count<hipblasComplex>(int64_t m, int64_t n, bool vectors)
 {
-    return 4 * gels_gflop_count<float>(m, n);
+    return 4.0 * gesvd_gflop_count<float>(m, n, vectors);
 }
 
 template <>
-constexpr double gels_gflop_count<hipblasDoubleComplex>(int64_t m, int64_t n)
+constexpr double gesvd_gflop_count<hipblasDoubleComplex>(int64_t m, int64_t n, bool vectors)
 {
-    return 4 * gels_gflop_count<float>(m, n);
+    return 4.0 * gesvd_gflop_count<float>(m, n, vectors);
 }
 
 #endif /* _HIPBLAS_FLOPS_H_ */
@@ -7191,6 +7191,26 @@ hipblasStatus_t hipblasZgeqrfBatchedCast(hipblasHandle_t             handle,
                                          int*                        info,
                                          const int                   batchCount);
 
+hipblasStatus_t hipblasCgeqrfBatchedStridedTauCast(hipblasHandle_t       handle,
+                                                   const int             m,
+                                                   const int             n,
+                                                   hipblasComplex* const A[],
+                                                   const int             lda,
+                                                   hipblasComplex*       tau,
+                                                   const hipblasStride   strideT,
+                                                   int*                  info,
+                                                   const int             batchCount);
+
+hipblasStatus_t hipblasZgeqrfBatchedStridedTauCast(hipblasHandle_t             handle,
+                                                   const int                   m,
+                                                   const int                   n,
+                                                   hipblasDoubleComplex* const A[],
+                                                   const int                   lda,
+                                                   hipblasDoubleComplex*       tau,
+                                                   const hipblasStride         strideT,
+                                                   int*                        info,
+                                                   const int                   batchCount);
+
 hipblasStatus_t hipblasCgeqrfStridedBatchedCast(hipblasHandle_t     handle,
                                                 const int           m,
                                                 const int           n,
@@ -7294,6 +7314,424 @@ hipblasStatus_t hipblasZgelsStridedBatchedCast(hipblasHandle_t       handle,
                                                int*                  deviceInfo,
                                                const int             batchCount);
 
+// potrf
+hipblasStatus_t hipblasCpotrfCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasComplex*         A,
+                                  const int               lda,
+                                  int*                    info);
+
+hipblasStatus_t hipblasZpotrfCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasDoubleComplex*   A,
+                                  const int               lda,
+                                  int*                    info);
+
+hipblasStatus_t hipblasCpotrfBatchedCast(hipblasHandle_t         handle,
+                                         const hipblasFillMode_t uplo,
+                                         const int               n,
+                                         hipblasComplex* const   A[],
+                                         const int               lda,
+                                         int*                    info,
+                                         const int               batchCount);
+
+hipblasStatus_t hipblasZpotrfBatchedCast(hipblasHandle_t             handle,
+                                         const hipblasFillMode_t     uplo,
+                                         const int                   n,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         int*                        info,
+                                         const int                   batchCount);
+
+hipblasStatus_t hipblasCpotrfStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasComplex*         A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                int*                    info,
+                                                const int               batchCount);
+
+hipblasStatus_t hipblasZpotrfStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasDoubleComplex*   A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                int*                    info,
+                                                const int               batchCount);
+
+// potrs
+hipblasStatus_t hipblasCpotrsCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  const int               nrhs,
+                                  hipblasComplex*         A,
+                                  const int               lda,
+                                  hipblasComplex*         B,
+                                  const int               ldb,
+                                  int*                    info);
+
+hipblasStatus_t hipblasZpotrsCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  const int               nrhs,
+                                  hipblasDoubleComplex*   A,
+                                  const int               lda,
+                                  hipblasDoubleComplex*   B,
+                                  const int               ldb,
+                                  int*                    info);
+
+hipblasStatus_t hipblasCpotrsBatchedCast(hipblasHandle_t         handle,
+                                         const hipblasFillMode_t uplo,
+                                         const int               n,
+                                         const int               nrhs,
+                                         hipblasComplex* const   A[],
+                                         const int               lda,
+                                         hipblasComplex* const   B[],
+                                         const int               ldb,
+                                         int*                    info,
+                                         const int               batchCount);
+
+hipblasStatus_t hipblasZpotrsBatchedCast(hipblasHandle_t             handle,
+                                         const hipblasFillMode_t     uplo,
+                                         const int                   n,
+                                         const int                   nrhs,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         hipblasDoubleComplex* const B[],
+                                         const int                   ldb,
+                                         int*                        info,
+                                         const int                   batchCount);
+
+hipblasStatus_t hipblasCpotrsStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                const int               nrhs,
+                                                hipblasComplex*         A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                hipblasComplex*         B,
+                                                const int               ldb,
+                                                const hipblasStride     strideB,
+                                                int*                    info,
+                                                const int               batchCount);
+
+hipblasStatus_t hipblasZpotrsStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                const int               nrhs,
+                                                hipblasDoubleComplex*   A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                hipblasDoubleComplex*   B,
+                                                const int               ldb,
+                                                const hipblasStride     strideB,
+                                                int*                    info,
+                                                const int               batchCount);
+
+// potri
+hipblasStatus_t hipblasCpotriCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasComplex*         A,
+                                  const int               lda,
+                                  int*                    info);
+
+hipblasStatus_t hipblasZpotriCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasDoubleComplex*   A,
+                                  const int               lda,
+                                  int*                    info);
+
+hipblasStatus_t hipblasCpotriBatchedCast(hipblasHandle_t         handle,
+                                         const hipblasFillMode_t uplo,
+                                         const int               n,
+                                         hipblasComplex* const   A[],
+                                         const int               lda,
+                                         int*                    info,
+                                         const int               batchCount);
+
+hipblasStatus_t hipblasZpotriBatchedCast(hipblasHandle_t             handle,
+                                         const hipblasFillMode_t     uplo,
+                                         const int                   n,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         int*                        info,
+                                         const int                   batchCount);
+
+hipblasStatus_t hipblasCpotriStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasComplex*         A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                int*                    info,
+                                                const int               batchCount);
+
+hipblasStatus_t hipblasZpotriStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasDoubleComplex*   A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                int*                    info,
+                                                const int               batchCount);
+
+// syevj, syevd
+hipblasStatus_t hipblasCheevjCast(hipblasHandle_t         handle,
+                                  const hipblasEvect_t    evect,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasComplex*         A,
+                                  const int               lda,
+                                  const float             abstol,
+                                  float*                  residual,
+                                  const int               maxSweeps,
+                                  int*                    nSweeps,
+                                  float*                  W,
+                                  int*                    info);
+
+hipblasStatus_t hipblasZheevjCast(hipblasHandle_t         handle,
+                                  const hipblasEvect_t    evect,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasDoubleComplex*   A,
+                                  const int               lda,
+                                  const double            abstol,
+                                  double*                 residual,
+                                  const int               maxSweeps,
+                                  int*                    nSweeps,
+                                  double*                 W,
+                                  int*                    info);
+
+hipblasStatus_t hipblasCheevjBatchedCast(hipblasHandle_t         handle,
+                                         const hipblasEvect_t    evect,
+                                         const hipblasFillMode_t uplo,
+                                         const int               n,
+                                         hipblasComplex* const   A[],
+                                         const int               lda,
+                                         const float             abstol,
+                                         float*                  residual,
+                                         const int               maxSweeps,
+                                         int*                    nSweeps,
+                                         float*                  W,
+                                         const hipblasStride     strideW,
+                                         int*                    info,
+                                         const int               batchCount);
+
+hipblasStatus_t hipblasZheevjBatchedCast(hipblasHandle_t             handle,
+                                         const hipblasEvect_t        evect,
+                                         const hipblasFillMode_t     uplo,
+                                         const int                   n,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         const double                abstol,
+                                         double*                     residual,
+                                         const int                   maxSweeps,
+                                         int*                        nSweeps,
+                                         double*                     W,
+                                         const hipblasStride         strideW,
+                                         int*                        info,
+                                         const int                   batchCount);
+
+hipblasStatus_t hipblasCheevjStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasEvect_t    evect,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasComplex*         A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                const float             abstol,
+                                                float*                  residual,
+                                                const int               maxSweeps,
+                                                int*                    nSweeps,
+                                                float*                  W,
+                                                const hipblasStride     strideW,
+                                                int*                    info,
+                                                const int               batchCount);
+
+hipblasStatus_t hipblasZheevjStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasEvect_t    evect,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasDoubleComplex*   A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                const double            abstol,
+                                                double*                 residual,
+                                                const int               maxSweeps,
+                                                int*                    nSweeps,
+                                                double*                 W,
+                                                const hipblasStride     strideW,
+                                                int*                    info,
+                                                const int               batchCount);
+
+hipblasStatus_t hipblasCheevdCast(hipblasHandle_t         handle,
+                                  const hipblasEvect_t    evect,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasComplex*         A,
+                                  const int               lda,
+                                  float*                  D,
+                                  float*                  E,
+                                  int*                    info);
+
+hipblasStatus_t hipblasZheevdCast(hipblasHandle_t         handle,
+                                  const hipblasEvect_t    evect,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasDoubleComplex*   A,
+                                  const int               lda,
+                                  double*                 D,
+                                  double*                 E,
+                                  int*                    info);
+
+// gesvdj
+hipblasStatus_t hipblasCgesvdjBatchedCast(hipblasHandle_t       handle,
+                                          const hipblasSvect_t  leftSvect,
+                                          const hipblasSvect_t  rightSvect,
+                                          const int             m,
+                                          const int             n,
+                                          hipblasComplex* const A[],
+                                          const int             lda,
+                                          const float           abstol,
+                                          float*                residual,
+                                          const int             maxSweeps,
+                                          int*                  nSweeps,
+                                          float*                S,
+                                          const hipblasStride   strideS,
+                                          hipblasComplex*       U,
+                                          const int             ldu,
+                                          const hipblasStride   strideU,
+                                          hipblasComplex*       V,
+                                          const int             ldv,
+                                          const hipblasStride   strideV,
+                                          int*                  info,
+                                          const int             batchCount);
+
+hipblasStatus_t hipblasZgesvdjBatchedCast(hipblasHandle_t             handle,
+                                          const hipblasSvect_t        leftSvect,
+                                          const hipblasSvect_t        rightSvect,
+                                          const int                   m,
+                                          const int                   n,
+                                          hipblasDoubleComplex* const A[],
+                                          const int                   lda,
+                                          const double                abstol,
+                                          double*                     residual,
+                                          const int                   maxSweeps,
+                                          int*                        nSweeps,
+                                          double*                     S,
+                                          const hipblasStride         strideS,
+                                          hipblasDoubleComplex*       U,
+                                          const int                   ldu,
+                                          const hipblasStride         strideU,
+                                          hipblasDoubleComplex*       V,
+                                          const int                   ldv,
+                                          const hipblasStride         strideV,
+                                          int*                        info,
+                                          const int                   batchCount);
+
+hipblasStatus_t hipblasCgesvdjStridedBatchedCast(hipblasHandle_t      handle,
+                                                 const hipblasSvect_t leftSvect,
+                                                 const hipblasSvect_t rightSvect,
+                                                 const int            m,
+                                                 const int            n,
+                                                 hipblasComplex*      A,
+                                                 const int            lda,
+                                                 const hipblasStride  strideA,
+                                                 const float          abstol,
+                                                 float*               residual,
+                                                 const int            maxSweeps,
+                                                 int*                 nSweeps,
+                                                 float*               S,
+                                                 const hipblasStride  strideS,
+                                                 hipblasComplex*      U,
+                                                 const int            ldu,
+                                                 const hipblasStride  strideU,
+                                                 hipblasComplex*      V,
+                                                 const int            ldv,
+                                                 const hipblasStride  strideV,
+                                                 int*                 info,
+                                                 const int            batchCount);
+
+hipblasStatus_t hipblasZgesvdjStridedBatchedCast(hipblasHandle_t       handle,
+                                                 const hipblasSvect_t  leftSvect,
+                                                 const hipblasSvect_t  rightSvect,
+                                                 const int             m,
+                                                 const int             n,
+                                                 hipblasDoubleComplex* A,
+                                                 const int             lda,
+                                                 const hipblasStride   strideA,
+                                                 const double          abstol,
+                                                 double*               residual,
+                                                 const int             maxSweeps,
+                                                 int*                  nSweeps,
+                                                 double*               S,
+                                                 const hipblasStride   strideS,
+                                                 hipblasDoubleComplex* U,
+                                                 const int             ldu,
+                                                 const hipblasStride   strideU,
+                                                 hipblasDoubleComplex* V,
+                                                 const int             ldv,
+                                                 const hipblasStride   strideV,
+                                                 int*                  info,
+                                                 const int             batchCount);
+
+// gesv
+hipblasStatus_t hipblasCgesvBatchedCast(hipblasHandle_t       handle,
+                                        const int             n,
+                                        const int             nrhs,
+                                        hipblasComplex* const A[],
+                                        const int             lda,
+                                        int*                  ipiv,
+                                        hipblasComplex* const B[],
+                                        const int             ldb,
+                                        int*                  info,
+                                        const int             batchCount);
+
+hipblasStatus_t hipblasZgesvBatchedCast(hipblasHandle_t             handle,
+                                        const int                   n,
+                                        const int                   nrhs,
+                                        hipblasDoubleComplex* const A[],
+                                        const int                   lda,
+                                        int*                        ipiv,
+                                        hipblasDoubleComplex* const B[],
+                                        const int                   ldb,
+                                        int*                        info,
+                                        const int                   batchCount);
+
+hipblasStatus_t hipblasCgesvStridedBatchedCast(hipblasHandle_t     handle,
+                                               const int           n,
+                                               const int           nrhs,
+                                               hipblasComplex*     A,
+                                               const int           lda,
+                                               const hipblasStride strideA,
+                                               int*                ipiv,
+                                               const hipblasStride strideP,
+                                               hipblasComplex*     B,
+                                               const int           ldb,
+                                               const hipblasStride strideB,
+                                               int*                info,
+                                               const int           batchCount);
+
+hipblasStatus_t hipblasZgesvStridedBatchedCast(hipblasHandle_t       handle,
+                                               const int             n,
+                                               const int             nrhs,
+                                               hipblasDoubleComplex* A,
+                                               const int             lda,
+                                               const hipblasStride   strideA,
+                                               int*                  ipiv,
+                                               const hipblasStride   strideP,
+                                               hipblasDoubleComplex* B,
+                                               const int             ldb,
+                                               const hipblasStride   strideB,
+                                               int*                  info,
+                                               const int             batchCount);
+
 #endif
 
 namespace
@@ -12027,6 +12465,17 @@ namespace
                                                   int*                info,
                                                   const int           batchCount);
 
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGeqrfBatchedStridedTau)(hipblasHandle_t     handle,
+                                                     const int           m,
+                                                     const int           n,
+                                                     T* const            A[],
+                                                     const int           lda,
+                                                     T*                  tau,
+                                                     const hipblasStride strideT,
+                                                     int*                info,
+                                                     const int           batchCount);
+
     MAP2CF(hipblasGeqrf, float, hipblasSgeqrf);
     MAP2CF(hipblasGeqrf, double, hipblasDgeqrf);
     MAP2CF_V2(hipblasGeqrf, hipblasComplex, hipblasCgeqrf);
@@ -12037,6 +12486,13 @@ namespace
     MAP2CF_V2(hipblasGeqrfBatched, hipblasComplex, hipblasCgeqrfBatched);
     MAP2CF_V2(hipblasGeqrfBatched, hipblasDoubleComplex, hipblasZgeqrfBatched);
 
+    MAP2CF(hipblasGeqrfBatchedStridedTau, float, hipblasSgeqrfBatchedStridedTau);
+    MAP2CF(hipblasGeqrfBatchedStridedTau, double, hipblasDgeqrfBatchedStridedTau);
+    MAP2CF_V2(hipblasGeqrfBatchedStridedTau, hipblasComplex, hipblasCgeqrfBatchedStridedTau);
+    MAP2CF_V2(hipblasGeqrfBatchedStridedTau,
+              hipblasDoubleComplex,
+              hipblasZgeqrfBatchedStridedTau);
+
     MAP2CF(hipblasGeqrfStridedBatched, float, hipblasSgeqrfStridedBatched);
     MAP2CF(hipblasGeqrfStridedBatched, double, hipblasDgeqrfStridedBatched);
     MAP2CF_V2(hipblasGeqrfStridedBatched, hipblasComplex, hipblasCgeqrfStridedBatched);
@@ -12101,6 +12557,322 @@ namespace
     MAP2CF_V2(hipblasGelsStridedBatched, hipblasComplex, hipblasCgelsStridedBatched);
     MAP2CF_V2(hipblasGelsStridedBatched, hipblasDoubleComplex, hipblasZgelsStridedBatched);
 
+    // potrf
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotrf)(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    T*                      A,
+                                    const int               lda,
+                                    int*                    info);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotrfBatched)(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           T* const                A[],
+                                           const int               lda,
+                                           int*                    info,
+                                           const int               batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotrfStridedBatched)(hipblasHandle_t         handle,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  T*                      A,
+                                                  const int               lda,
+                                                  const hipblasStride     strideA,
+                                                  int*                    info,
+                                                  const int               batchCount);
+
+    MAP2CF(hipblasPotrf, float, hipblasSpotrf);
+    MAP2CF(hipblasPotrf, double, hipblasDpotrf);
+    MAP2CF_V2(hipblasPotrf, hipblasComplex, hipblasCpotrf);
+    MAP2CF_V2(hipblasPotrf, hipblasDoubleComplex, hipblasZpotrf);
+
+    MAP2CF(hipblasPotrfBatched, float, hipblasSpotrfBatched);
+    MAP2CF(hipblasPotrfBatched, double, hipblasDpotrfBatched);
+    MAP2CF_V2(hipblasPotrfBatched, hipblasComplex, hipblasCpotrfBatched);
+    MAP2CF_V2(hipblasPotrfBatched, hipblasDoubleComplex, hipblasZpotrfBatched);
+
+    MAP2CF(hipblasPotrfStridedBatched, float, hipblasSpotrfStridedBatched);
+    MAP2CF(hipblasPotrfStridedBatched, double, hipblasDpotrfStridedBatched);
+    MAP2CF_V2(hipblasPotrfStridedBatched, hipblasComplex, hipblasCpotrfStridedBatched);
+    MAP2CF_V2(hipblasPotrfStridedBatched, hipblasDoubleComplex, hipblasZpotrfStridedBatched);
+
+    // potrs
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotrs)(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    const int               nrhs,
+                                    T*                      A,
+                                    const int               lda,
+                                    T*                      B,
+                                    const int               ldb,
+                                    int*                    info);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotrsBatched)(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           const int               nrhs,
+                                           T* const                A[],
+                                           const int               lda,
+                                           T* const                B[],
+                                           const int               ldb,
+                                           int*                    info,
+                                           const int               batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotrsStridedBatched)(hipblasHandle_t         handle,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  const int               nrhs,
+                                                  T*                      A,
+                                                  const int               lda,
+                                                  const hipblasStride     strideA,
+                                                  T*                      B,
+                                                  const int               ldb,
+                                                  const hipblasStride     strideB,
+                                                  int*                    info,
+                                                  const int               batchCount);
+
+    MAP2CF(hipblasPotrs, float, hipblasSpotrs);
+    MAP2CF(hipblasPotrs, double, hipblasDpotrs);
+    MAP2CF_V2(hipblasPotrs, hipblasComplex, hipblasCpotrs);
+    MAP2CF_V2(hipblasPotrs, hipblasDoubleComplex, hipblasZpotrs);
+
+    MAP2CF(hipblasPotrsBatched, float, hipblasSpotrsBatched);
+    MAP2CF(hipblasPotrsBatched, double, hipblasDpotrsBatched);
+    MAP2CF_V2(hipblasPotrsBatched, hipblasComplex, hipblasCpotrsBatched);
+    MAP2CF_V2(hipblasPotrsBatched, hipblasDoubleComplex, hipblasZpotrsBatched);
+
+    MAP2CF(hipblasPotrsStridedBatched, float, hipblasSpotrsStridedBatched);
+    MAP2CF(hipblasPotrsStridedBatched, double, hipblasDpotrsStridedBatched);
+    MAP2CF_V2(hipblasPotrsStridedBatched, hipblasComplex, hipblasCpotrsStridedBatched);
+    MAP2CF_V2(hipblasPotrsStridedBatched, hipblasDoubleComplex, hipblasZpotrsStridedBatched);
+
+    // potri
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotri)(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    T*                      A,
+                                    const int               lda,
+                                    int*                    info);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotriBatched)(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           T* const                A[],
+                                           const int               lda,
+                                           int*                    info,
+                                           const int               batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotriStridedBatched)(hipblasHandle_t         handle,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  T*                      A,
+                                                  const int               lda,
+                                                  const hipblasStride     strideA,
+                                                  int*                    info,
+                                                  const int               batchCount);
+
+    MAP2CF(hipblasPotri, float, hipblasSpotri);
+    MAP2CF(hipblasPotri, double, hipblasDpotri);
+    MAP2CF_V2(hipblasPotri, hipblasComplex, hipblasCpotri);
+    MAP2CF_V2(hipblasPotri, hipblasDoubleComplex, hipblasZpotri);
+
+    MAP2CF(hipblasPotriBatched, float, hipblasSpotriBatched);
+    MAP2CF(hipblasPotriBatched, double, hipblasDpotriBatched);
+    MAP2CF_V2(hipblasPotriBatched, hipblasComplex, hipblasCpotriBatched);
+    MAP2CF_V2(hipblasPotriBatched, hipblasDoubleComplex, hipblasZpotriBatched);
+
+    MAP2CF(hipblasPotriStridedBatched, float, hipblasSpotriStridedBatched);
+    MAP2CF(hipblasPotriStridedBatched, double, hipblasDpotriStridedBatched);
+    MAP2CF_V2(hipblasPotriStridedBatched, hipblasComplex, hipblasCpotriStridedBatched);
+    MAP2CF_V2(hipblasPotriStridedBatched, hipblasDoubleComplex, hipblasZpotriStridedBatched);
+
+    // syevj, syevd
+    template <typename T, typename U, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSyevj)(hipblasHandle_t         handle,
+                                    const hipblasEvect_t    evect,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    T*                      A,
+                                    const int               lda,
+                                    const U                 abstol,
+                                    U*                      residual,
+                                    const int               maxSweeps,
+                                    int*                    nSweeps,
+                                    U*                      W,
+                                    int*                    info);
+
+    template <typename T, typename U, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSyevjBatched)(hipblasHandle_t         handle,
+                                           const hipblasEvect_t    evect,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           T* const                A[],
+                                           const int               lda,
+                                           const U                 abstol,
+                                           U*                      residual,
+                                           const int               maxSweeps,
+                                           int*                    nSweeps,
+                                           U*                      W,
+                                           const hipblasStride     strideW,
+                                           int*                    info,
+                                           const int               batchCount);
+
+    template <typename T, typename U, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSyevjStridedBatched)(hipblasHandle_t         handle,
+                                                  const hipblasEvect_t    evect,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  T*                      A,
+                                                  const int               lda,
+                                                  const hipblasStride     strideA,
+                                                  const U                 abstol,
+                                                  U*                      residual,
+                                                  const int               maxSweeps,
+                                                  int*                    nSweeps,
+                                                  U*                      W,
+                                                  const hipblasStride     strideW,
+                                                  int*                    info,
+                                                  const int               batchCount);
+
+    template <typename T, typename U, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSyevd)(hipblasHandle_t         handle,
+                                    const hipblasEvect_t    evect,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    T*                      A,
+                                    const int               lda,
+                                    U*                      D,
+                                    U*                      E,
+                                    int*                    info);
+
+    MAP2CF(hipblasSyevj, float, float, hipblasSsyevj);
+    MAP2CF(hipblasSyevj, double, double, hipblasDsyevj);
+    MAP2CF_V2(hipblasSyevj, hipblasComplex, float, hipblasCheevj);
+    MAP2CF_V2(hipblasSyevj, hipblasDoubleComplex, double, hipblasZheevj);
+
+    MAP2CF(hipblasSyevjBatched, float, float, hipblasSsyevjBatched);
+    MAP2CF(hipblasSyevjBatched, double, double, hipblasDsyevjBatched);
+    MAP2CF_V2(hipblasSyevjBatched, hipblasComplex, float, hipblasCheevjBatched);
+    MAP2CF_V2(hipblasSyevjBatched, hipblasDoubleComplex, double, hipblasZheevjBatched);
+
+    MAP2CF(hipblasSyevjStridedBatched, float, float, hipblasSsyevjStridedBatched);
+    MAP2CF(hipblasSyevjStridedBatched, double, double, hipblasDsyevjStridedBatched);
+    MAP2CF_V2(hipblasSyevjStridedBatched, hipblasComplex, float, hipblasCheevjStridedBatched);
+    MAP2CF_V2(
+        hipblasSyevjStridedBatched, hipblasDoubleComplex, double, hipblasZheevjStridedBatched);
+
+    MAP2CF(hipblasSyevd, float, float, hipblasSsyevd);
+    MAP2CF(hipblasSyevd, double, double, hipblasDsyevd);
+    MAP2CF_V2(hipblasSyevd, hipblasComplex, float, hipblasCheevd);
+    MAP2CF_V2(hipblasSyevd, hipblasDoubleComplex, double, hipblasZheevd);
+
+    // gesvdj
+    template <typename T, typename U, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGesvdjBatched)(hipblasHandle_t      handle,
+                                            const hipblasSvect_t leftSvect,
+                                            const hipblasSvect_t rightSvect,
+                                            const int            m,
+                                            const int            n,
+                                            T* const             A[],
+                                            const int            lda,
+                                            const U              abstol,
+                                            U*                   residual,
+                                            const int            maxSweeps,
+                                            int*                 nSweeps,
+                                            U*                   S,
+                                            const hipblasStride  strideS,
+                                            T*                   Umat,
+                                            const int            ldu,
+                                            const hipblasStride  strideU,
+                                            T*                   Vmat,
+                                            const int            ldv,
+                                            const hipblasStride  strideV,
+                                            int*                 info,
+                                            const int            batchCount);
+
+    template <typename T, typename U, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGesvdjStridedBatched)(hipblasHandle_t      handle,
+                                                   const hipblasSvect_t leftSvect,
+                                                   const hipblasSvect_t rightSvect,
+                                                   const int            m,
+                                                   const int            n,
+                                                   T*                   A,
+                                                   const int            lda,
+                                                   const hipblasStride  strideA,
+                                                   const U              abstol,
+                                                   U*                   residual,
+                                                   const int            maxSweeps,
+                                                   int*                 nSweeps,
+                                                   U*                   S,
+                                                   const hipblasStride  strideS,
+                                                   T*                   Umat,
+                                                   const int            ldu,
+                                                   const hipblasStride  strideU,
+                                                   T*                   Vmat,
+                                                   const int            ldv,
+                                                   const hipblasStride  strideV,
+                                                   int*                 info,
+                                                   const int            batchCount);
+
+    MAP2CF(hipblasGesvdjBatched, float, float, hipblasSgesvdjBatched);
+    MAP2CF(hipblasGesvdjBatched, double, double, hipblasDgesvdjBatched);
+    MAP2CF_V2(hipblasGesvdjBatched, hipblasComplex, float, hipblasCgesvdjBatched);
+    MAP2CF_V2(hipblasGesvdjBatched, hipblasDoubleComplex, double, hipblasZgesvdjBatched);
+
+    MAP2CF(hipblasGesvdjStridedBatched, float, float, hipblasSgesvdjStridedBatched);
+    MAP2CF(hipblasGesvdjStridedBatched, double, double, hipblasDgesvdjStridedBatched);
+    MAP2CF_V2(hipblasGesvdjStridedBatched, hipblasComplex, float, hipblasCgesvdjStridedBatched);
+    MAP2CF_V2(
+        hipblasGesvdjStridedBatched, hipblasDoubleComplex, double, hipblasZgesvdjStridedBatched);
+
+    // gesv
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGesvBatched)(hipblasHandle_t handle,
+                                          const int       n,
+                                          const int       nrhs,
+                                          T* const        A[],
+                                          const int       lda,
+                                          int*            ipiv,
+                                          T* const        B[],
+                                          const int       ldb,
+                                          int*            info,
+                                          const int       batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGesvStridedBatched)(hipblasHandle_t     handle,
+                                                 const int           n,
+                                                 const int           nrhs,
+                                                 T*                  A,
+                                                 const int           lda,
+                                                 const hipblasStride strideA,
+                                                 int*                ipiv,
+                                                 const hipblasStride strideP,
+                                                 T*                  B,
+                                                 const int           ldb,
+                                                 const hipblasStride strideB,
+                                                 int*                info,
+                                                 const int           batchCount);
+
+    MAP2CF(hipblasGesvBatched, float, hipblasSgesvBatched);
+    MAP2CF(hipblasGesvBatched, double, hipblasDgesvBatched);
+    MAP2CF_V2(hipblasGesvBatched, hipblasComplex, hipblasCgesvBatched);
+    MAP2CF_V2(hipblasGesvBatched, hipblasDoubleComplex, hipblasZgesvBatched);
+
+    MAP2CF(hipblasGesvStridedBatched, float, hipblasSgesvStridedBatched);
+    MAP2CF(hipblasGesvStridedBatched, double, hipblasDgesvStridedBatched);
+    MAP2CF_V2(hipblasGesvStridedBatched, hipblasComplex, hipblasCgesvStridedBatched);
+    MAP2CF_V2(hipblasGesvStridedBatched, hipblasDoubleComplex, hipblasZgesvStridedBatched);
+
 #endif
 }
 
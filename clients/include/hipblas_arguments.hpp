@@ -69,6 +69,14 @@ typedef enum hipblas_client_api_
     FORTRAN_64 = 3
 } hipblas_client_api;
 
+// hipblas-bench --timing
+typedef enum hipblas_client_timing_
+{
+    TIMING_SYNC   = 0,
+    TIMING_EVENTS = 1,
+    TIMING_HOST   = 2
+} hipblas_client_timing;
+
 /*! \brief device matches pattern */
 bool gpu_arch_match(const std::string& gpu_arch, const char pattern[4]);
 
@@ -169,11 +177,25 @@ struct Arguments
     bool inplace    = false; // only for trmm
     bool with_flags = false;
 
-    int      norm_check = 0;
-    int      unit_check = 1;
-    int      timing     = 0;
-    int      iters      = 10;
-    int      cold_iters = 2;
+    int      norm_check          = 0;
+    int      unit_check          = 1;
+    int      timing              = 0;
+    int      iters               = 10;
+    int      cold_iters          = 2;
+    int      timing_mode         = TIMING_SYNC;
+    bool     report_percentiles  = false;
+    int      rotating            = 0;
+    bool     flush_cache         = false;
+    bool     roofline            = false;
+    bool     telemetry           = false;
+    bool     memory_footprint    = false;
+    double   device_memory_limit = 0; // GB of workspace of the handle, 0 for no limit
+    double   perf_threshold      = 0; // % of the roofline a timed test must reach, 0 for none
+    bool     own_stream          = false; // the handle doesn't use the null stream
+    bool     graph               = false;
+    bool     device_reference    = false;
+    bool     probabilistic_check = false;
+    bool     pad_ld              = false; // pad the gemm leading dimensions of hipblas-bench
     uint32_t algo;
     int32_t  solution_index;
     uint32_t flags;
@@ -181,7 +203,11 @@ struct Arguments
     char     name[64];
     char     category[64];
 
-    int atomics_mode = HIPBLAS_ATOMICS_NOT_ALLOWED;
+    // files of A, B and C, separated by commas, which replace their initialization
+    char input_file[256];
+
+    int atomics_mode         = HIPBLAS_ATOMICS_NOT_ALLOWED;
+    int reproducibility_mode = HIPBLAS_REPRODUCIBILITY_DEFAULT;
 
     hipblas_client_os os_flags;
 
@@ -254,13 +280,29 @@ struct Arguments
     OPER(timing) SEP                 \
     OPER(iters) SEP                  \
     OPER(cold_iters) SEP             \
+    OPER(timing_mode) SEP            \
+    OPER(report_percentiles) SEP     \
+    OPER(rotating) SEP               \
+    OPER(flush_cache) SEP            \
+    OPER(roofline) SEP               \
+    OPER(telemetry) SEP              \
+    OPER(memory_footprint) SEP       \
+    OPER(device_memory_limit) SEP    \
+    OPER(perf_threshold) SEP         \
+    OPER(own_stream) SEP             \
+    OPER(graph) SEP                  \
+    OPER(device_reference) SEP       \
+    OPER(probabilistic_check) SEP    \
+    OPER(pad_ld) SEP                 \
     OPER(algo) SEP                   \
     OPER(solution_index) SEP         \
     OPER(flags) SEP                  \
     OPER(function) SEP               \
     OPER(name) SEP                   \
     OPER(category) SEP               \
+    OPER(input_file) SEP             \
     OPER(atomics_mode) SEP           \
+    OPER(reproducibility_mode) SEP   \
     OPER(os_flags) SEP               \
     OPER(gpu_arch) SEP               \
     OPER(backend_flags) SEP          \
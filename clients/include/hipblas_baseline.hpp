@@ -0,0 +1,50 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas_arguments.hpp"
+#include <string>
+#include <vector>
+
+// a run recorded by hipblas-bench --baseline, with the time of each of its hot iterations
+struct hipblas_baseline_case
+{
+    Arguments           arg{};
+    std::vector<double> iteration_us;
+};
+
+// reads the runs recorded in a --baseline file. Throws std::invalid_argument if the file can't be
+// opened or a line isn't a record written by --baseline
+std::vector<hipblas_baseline_case> hipblas_baseline_read(const std::string& path);
+
+// one-sided p-value of the Mann-Whitney U test that the times of current tend to be larger than
+// the times of baseline, with the normal approximation corrected for ties
+double hipblas_mann_whitney_p(const std::vector<double>& baseline,
+                              const std::vector<double>& current);
+
+// hipblas-bench --baseline path --compare: reruns each run recorded in path, and reports it as a
+// regression when its median iteration time is more than threshold, as a fraction, slower than
+// the recorded one and the times are slower at the significance level. Returns the number of
+// regressions and of runs that failed
+int hipblas_baseline_compare(const std::string& path, double threshold, double significance);
@@ -0,0 +1,67 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+/* ============================================================================================ */
+/*! \brief  collects the hardware counters selected with hipblas-bench --counters over the hot
+ *          iterations of a device, between start and stop. The counters are read in process
+ *          through the device counting service of rocprofiler-sdk on AMD devices, which is loaded
+ *          by select, so the clients don't depend on it. Without the library, or on NVIDIA
+ *          devices, the counters of the last loop are empty. */
+class hipblas_counters
+{
+    int  m_context = -1;
+    bool m_started = false;
+
+public:
+    hipblas_counters() = default;
+
+    ~hipblas_counters();
+
+    hipblas_counters(const hipblas_counters&) = delete;
+    hipblas_counters& operator=(const hipblas_counters&) = delete;
+
+    // selects the comma separated counters to collect over every timing loop. The profiler can
+    // only attach before the HIP runtime is initialized, so this is called before the first HIP
+    // call. Throws if the list is empty
+    static void select(const std::string& list);
+
+    // whether counters were selected
+    static bool selected();
+
+    // starts counting on the device
+    void start(int device);
+
+    // stops counting, and divides the counts by the calls of the loop as the last counters of
+    // this thread
+    void stop(int calls);
+
+    // the (name, value per call) of each counter of the last loop counted by this thread, in the
+    // order they were selected
+    static const std::vector<std::pair<std::string, double>>& last();
+};
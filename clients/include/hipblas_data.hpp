@@ -23,6 +23,7 @@
 #pragma once
 
 #include "hipblas_arguments.hpp"
+#include "hipblas_parse_data.hpp"
 #include "test_cleanup.hpp"
 #include <cerrno>
 #include <cstdio>
@@ -96,6 +97,12 @@ class HipBLAS_TestData
     };
 
 public:
+    // Name of the data file, or empty if none was set
+    static const std::string& get_filename()
+    {
+        return filename();
+    }
+
     // Initialize filename, optionally removing it at exit
     static void set_filename(std::string name, bool remove_atexit = false)
     {
@@ -111,7 +118,7 @@ public:
     // begin() iterator which accepts an optional filter.
     static iterator begin(bool filter(const Arguments&) = nullptr)
     {
-        static std::ifstream* ifs = nullptr;
+        static hipblas_data_stream* ifs = nullptr;
 
         // If this is the first time, or after test_cleanup::cleanup() has been called
         if(!ifs)
@@ -120,9 +127,8 @@ public:
             if(fileToOpen.empty())
                 return end();
 
-            // Allocate a std::ifstream and register it to be deleted during cleanup
-            ifs = test_cleanup::allocate(
-                &ifs, fileToOpen, std::ifstream::in | std::ifstream::binary);
+            // Allocate a hipblas_data_stream and register it to be deleted during cleanup
+            ifs = test_cleanup::allocate(&ifs, fileToOpen);
             if(!ifs || ifs->fail())
             {
                 std::cerr << "Cannot open " << fileToOpen << ": " << strerror(errno) << std::endl;
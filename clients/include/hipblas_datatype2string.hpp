@@ -145,6 +145,66 @@ inline constexpr auto hipblas_datatype2string(hipblasDatatype_t type)
     return "invalid";
 }
 
+// return the size in bytes of an element of a hipblas_datatype, 0 if it is not known
+inline constexpr size_t hipblas_datatype_size(hipblasDatatype_t type)
+{
+    switch(type)
+    {
+    case HIPBLAS_R_8I:
+    case HIPBLAS_R_8U:
+        return 1;
+    case HIPBLAS_R_16F:
+    case HIPBLAS_R_16B:
+    case HIPBLAS_C_8I:
+    case HIPBLAS_C_8U:
+        return 2;
+    case HIPBLAS_R_32F:
+    case HIPBLAS_R_32I:
+    case HIPBLAS_R_32U:
+    case HIPBLAS_C_16F:
+    case HIPBLAS_C_16B:
+        return 4;
+    case HIPBLAS_R_64F:
+    case HIPBLAS_C_32F:
+    case HIPBLAS_C_32I:
+    case HIPBLAS_C_32U:
+        return 8;
+    case HIPBLAS_C_64F:
+        return 16;
+    default:
+        return 0;
+    }
+}
+
+// return the hipDataType of a hipblas_datatype, for the functions that take a hipDataType without
+// HIPBLAS_V2 too, HIP_R_32F if it is not a floating point type
+inline constexpr hipDataType hipblas_datatype2hip(hipblasDatatype_t type)
+{
+#ifdef HIPBLAS_V2
+    return type;
+#else
+    switch(type)
+    {
+    case HIPBLAS_R_16F:
+        return HIP_R_16F;
+    case HIPBLAS_R_16B:
+        return HIP_R_16BF;
+    case HIPBLAS_R_64F:
+        return HIP_R_64F;
+    case HIPBLAS_C_16F:
+        return HIP_C_16F;
+    case HIPBLAS_C_16B:
+        return HIP_C_16BF;
+    case HIPBLAS_C_32F:
+        return HIP_C_32F;
+    case HIPBLAS_C_64F:
+        return HIP_C_64F;
+    default:
+        return HIP_R_32F;
+    }
+#endif
+}
+
 // return string for hipblasComputeType_t
 inline constexpr auto hipblas_computetype2string(hipblasComputeType_t type)
 {
@@ -74,6 +74,52 @@ hipblasStatus_t hipblasSetMatrixAsyncFortran(
 hipblasStatus_t hipblasGetMatrixAsyncFortran(
     int rows, int cols, int elemSize, const void* A, int lda, void* B, int ldb, hipStream_t stream);
 
+hipblasStatus_t hipblasSetVector_64Fortran(
+    int64_t n, int64_t elemSize, const void* x, int64_t incx, void* y, int64_t incy);
+
+hipblasStatus_t hipblasGetVector_64Fortran(
+    int64_t n, int64_t elemSize, const void* x, int64_t incx, void* y, int64_t incy);
+
+hipblasStatus_t hipblasSetMatrix_64Fortran(
+    int64_t rows, int64_t cols, int64_t elemSize, const void* A, int64_t lda, void* B, int64_t ldb);
+
+hipblasStatus_t hipblasGetMatrix_64Fortran(
+    int64_t rows, int64_t cols, int64_t elemSize, const void* A, int64_t lda, void* B, int64_t ldb);
+
+hipblasStatus_t hipblasSetVectorAsync_64Fortran(int64_t     n,
+                                                int64_t     elemSize,
+                                                const void* x,
+                                                int64_t     incx,
+                                                void*       y,
+                                                int64_t     incy,
+                                                hipStream_t stream);
+
+hipblasStatus_t hipblasGetVectorAsync_64Fortran(int64_t     n,
+                                                int64_t     elemSize,
+                                                const void* x,
+                                                int64_t     incx,
+                                                void*       y,
+                                                int64_t     incy,
+                                                hipStream_t stream);
+
+hipblasStatus_t hipblasSetMatrixAsync_64Fortran(int64_t     rows,
+                                                int64_t     cols,
+                                                int64_t     elemSize,
+                                                const void* A,
+                                                int64_t     lda,
+                                                void*       B,
+                                                int64_t     ldb,
+                                                hipStream_t stream);
+
+hipblasStatus_t hipblasGetMatrixAsync_64Fortran(int64_t     rows,
+                                                int64_t     cols,
+                                                int64_t     elemSize,
+                                                const void* A,
+                                                int64_t     lda,
+                                                void*       B,
+                                                int64_t     ldb,
+                                                hipStream_t stream);
+
 hipblasStatus_t hipblasSetAtomicsModeFortran(hipblasHandle_t      handle,
                                              hipblasAtomicsMode_t atomics_mode);
 
@@ -656,6 +702,47 @@ hipblasStatus_t hipblasZgeqrfBatchedFortran(hipblasHandle_t             handle,
                                             int*                        info,
                                             const int                   batch_count);
 
+// geqrf_batched_strided_tau
+hipblasStatus_t hipblasSgeqrfBatchedStridedTauFortran(hipblasHandle_t     handle,
+                                                      const int           m,
+                                                      const int           n,
+                                                      float* const        A[],
+                                                      const int           lda,
+                                                      float*              tau,
+                                                      const hipblasStride strideT,
+                                                      int*                info,
+                                                      const int           batch_count);
+
+hipblasStatus_t hipblasDgeqrfBatchedStridedTauFortran(hipblasHandle_t     handle,
+                                                      const int           m,
+                                                      const int           n,
+                                                      double* const       A[],
+                                                      const int           lda,
+                                                      double*             tau,
+                                                      const hipblasStride strideT,
+                                                      int*                info,
+                                                      const int           batch_count);
+
+hipblasStatus_t hipblasCgeqrfBatchedStridedTauFortran(hipblasHandle_t       handle,
+                                                      const int             m,
+                                                      const int             n,
+                                                      hipblasComplex* const A[],
+                                                      const int             lda,
+                                                      hipblasComplex*       tau,
+                                                      const hipblasStride   strideT,
+                                                      int*                  info,
+                                                      const int             batch_count);
+
+hipblasStatus_t hipblasZgeqrfBatchedStridedTauFortran(hipblasHandle_t             handle,
+                                                      const int                   m,
+                                                      const int                   n,
+                                                      hipblasDoubleComplex* const A[],
+                                                      const int                   lda,
+                                                      hipblasDoubleComplex*       tau,
+                                                      const hipblasStride         strideT,
+                                                      int*                        info,
+                                                      const int                   batch_count);
+
 // geqrf_strided_batched
 hipblasStatus_t hipblasSgeqrfStridedBatchedFortran(hipblasHandle_t     handle,
                                                    const int           m,
@@ -863,6 +950,847 @@ hipblasStatus_t hipblasZgelsStridedBatchedFortran(hipblasHandle_t       handle,
                                                   int*                  info,
                                                   int*                  deviceInfo,
                                                   const int             batchCount);
+
+// potrf
+hipblasStatus_t hipblasSpotrfFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     float*                  A,
+                                     const int               lda,
+                                     int*                    info);
+
+hipblasStatus_t hipblasDpotrfFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     double*                 A,
+                                     const int               lda,
+                                     int*                    info);
+
+hipblasStatus_t hipblasCpotrfFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasComplex*         A,
+                                     const int               lda,
+                                     int*                    info);
+
+hipblasStatus_t hipblasZpotrfFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasDoubleComplex*   A,
+                                     const int               lda,
+                                     int*                    info);
+
+// potrf_batched
+hipblasStatus_t hipblasSpotrfBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            float* const            A[],
+                                            const int               lda,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasDpotrfBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            double* const           A[],
+                                            const int               lda,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasCpotrfBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasComplex* const   A[],
+                                            const int               lda,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasZpotrfBatchedFortran(hipblasHandle_t             handle,
+                                            const hipblasFillMode_t     uplo,
+                                            const int                   n,
+                                            hipblasDoubleComplex* const A[],
+                                            const int                   lda,
+                                            int*                        info,
+                                            const int                   batchCount);
+
+// potrf_strided_batched
+hipblasStatus_t hipblasSpotrfStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   float*                  A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasDpotrfStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   double*                 A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasCpotrfStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   hipblasComplex*         A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasZpotrfStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   hipblasDoubleComplex*   A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+// potrs
+hipblasStatus_t hipblasSpotrsFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     float*                  A,
+                                     const int               lda,
+                                     float*                  B,
+                                     const int               ldb,
+                                     int*                    info);
+
+hipblasStatus_t hipblasDpotrsFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     double*                 A,
+                                     const int               lda,
+                                     double*                 B,
+                                     const int               ldb,
+                                     int*                    info);
+
+hipblasStatus_t hipblasCpotrsFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     hipblasComplex*         A,
+                                     const int               lda,
+                                     hipblasComplex*         B,
+                                     const int               ldb,
+                                     int*                    info);
+
+hipblasStatus_t hipblasZpotrsFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     hipblasDoubleComplex*   A,
+                                     const int               lda,
+                                     hipblasDoubleComplex*   B,
+                                     const int               ldb,
+                                     int*                    info);
+
+// potrs_batched
+hipblasStatus_t hipblasSpotrsBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            float* const            A[],
+                                            const int               lda,
+                                            float* const            B[],
+                                            const int               ldb,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasDpotrsBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            double* const           A[],
+                                            const int               lda,
+                                            double* const           B[],
+                                            const int               ldb,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasCpotrsBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            hipblasComplex* const   A[],
+                                            const int               lda,
+                                            hipblasComplex* const   B[],
+                                            const int               ldb,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasZpotrsBatchedFortran(hipblasHandle_t             handle,
+                                            const hipblasFillMode_t     uplo,
+                                            const int                   n,
+                                            const int                   nrhs,
+                                            hipblasDoubleComplex* const A[],
+                                            const int                   lda,
+                                            hipblasDoubleComplex* const B[],
+                                            const int                   ldb,
+                                            int*                        info,
+                                            const int                   batchCount);
+
+// potrs_strided_batched
+hipblasStatus_t hipblasSpotrsStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const int               nrhs,
+                                                   float*                  A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   float*                  B,
+                                                   const int               ldb,
+                                                   const hipblasStride     strideB,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasDpotrsStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const int               nrhs,
+                                                   double*                 A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   double*                 B,
+                                                   const int               ldb,
+                                                   const hipblasStride     strideB,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasCpotrsStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const int               nrhs,
+                                                   hipblasComplex*         A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   hipblasComplex*         B,
+                                                   const int               ldb,
+                                                   const hipblasStride     strideB,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasZpotrsStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const int               nrhs,
+                                                   hipblasDoubleComplex*   A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   hipblasDoubleComplex*   B,
+                                                   const int               ldb,
+                                                   const hipblasStride     strideB,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+// potri
+hipblasStatus_t hipblasSpotriFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     float*                  A,
+                                     const int               lda,
+                                     int*                    info);
+
+hipblasStatus_t hipblasDpotriFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     double*                 A,
+                                     const int               lda,
+                                     int*                    info);
+
+hipblasStatus_t hipblasCpotriFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasComplex*         A,
+                                     const int               lda,
+                                     int*                    info);
+
+hipblasStatus_t hipblasZpotriFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasDoubleComplex*   A,
+                                     const int               lda,
+                                     int*                    info);
+
+// potri_batched
+hipblasStatus_t hipblasSpotriBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            float* const            A[],
+                                            const int               lda,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasDpotriBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            double* const           A[],
+                                            const int               lda,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasCpotriBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasComplex* const   A[],
+                                            const int               lda,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasZpotriBatchedFortran(hipblasHandle_t             handle,
+                                            const hipblasFillMode_t     uplo,
+                                            const int                   n,
+                                            hipblasDoubleComplex* const A[],
+                                            const int                   lda,
+                                            int*                        info,
+                                            const int                   batchCount);
+
+// potri_strided_batched
+hipblasStatus_t hipblasSpotriStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   float*                  A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasDpotriStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   double*                 A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasCpotriStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   hipblasComplex*         A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasZpotriStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   hipblasDoubleComplex*   A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+// syevj
+hipblasStatus_t hipblasSsyevjFortran(hipblasHandle_t         handle,
+                                     const hipblasEvect_t    evect,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     float*                  A,
+                                     const int               lda,
+                                     const float             abstol,
+                                     float*                  residual,
+                                     const int               maxSweeps,
+                                     int*                    nSweeps,
+                                     float*                  W,
+                                     int*                    info);
+
+hipblasStatus_t hipblasDsyevjFortran(hipblasHandle_t         handle,
+                                     const hipblasEvect_t    evect,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     double*                 A,
+                                     const int               lda,
+                                     const double            abstol,
+                                     double*                 residual,
+                                     const int               maxSweeps,
+                                     int*                    nSweeps,
+                                     double*                 W,
+                                     int*                    info);
+
+hipblasStatus_t hipblasCheevjFortran(hipblasHandle_t         handle,
+                                     const hipblasEvect_t    evect,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasComplex*         A,
+                                     const int               lda,
+                                     const float             abstol,
+                                     float*                  residual,
+                                     const int               maxSweeps,
+                                     int*                    nSweeps,
+                                     float*                  W,
+                                     int*                    info);
+
+hipblasStatus_t hipblasZheevjFortran(hipblasHandle_t         handle,
+                                     const hipblasEvect_t    evect,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasDoubleComplex*   A,
+                                     const int               lda,
+                                     const double            abstol,
+                                     double*                 residual,
+                                     const int               maxSweeps,
+                                     int*                    nSweeps,
+                                     double*                 W,
+                                     int*                    info);
+
+// syevj_batched
+hipblasStatus_t hipblasSsyevjBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasEvect_t    evect,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            float* const            A[],
+                                            const int               lda,
+                                            const float             abstol,
+                                            float*                  residual,
+                                            const int               maxSweeps,
+                                            int*                    nSweeps,
+                                            float*                  W,
+                                            const hipblasStride     strideW,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasDsyevjBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasEvect_t    evect,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            double* const           A[],
+                                            const int               lda,
+                                            const double            abstol,
+                                            double*                 residual,
+                                            const int               maxSweeps,
+                                            int*                    nSweeps,
+                                            double*                 W,
+                                            const hipblasStride     strideW,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasCheevjBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasEvect_t    evect,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasComplex* const   A[],
+                                            const int               lda,
+                                            const float             abstol,
+                                            float*                  residual,
+                                            const int               maxSweeps,
+                                            int*                    nSweeps,
+                                            float*                  W,
+                                            const hipblasStride     strideW,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasZheevjBatchedFortran(hipblasHandle_t             handle,
+                                            const hipblasEvect_t        evect,
+                                            const hipblasFillMode_t     uplo,
+                                            const int                   n,
+                                            hipblasDoubleComplex* const A[],
+                                            const int                   lda,
+                                            const double                abstol,
+                                            double*                     residual,
+                                            const int                   maxSweeps,
+                                            int*                        nSweeps,
+                                            double*                     W,
+                                            const hipblasStride         strideW,
+                                            int*                        info,
+                                            const int                   batchCount);
+
+// syevj_strided_batched
+hipblasStatus_t hipblasSsyevjStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasEvect_t    evect,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   float*                  A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   const float             abstol,
+                                                   float*                  residual,
+                                                   const int               maxSweeps,
+                                                   int*                    nSweeps,
+                                                   float*                  W,
+                                                   const hipblasStride     strideW,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasDsyevjStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasEvect_t    evect,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   double*                 A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   const double            abstol,
+                                                   double*                 residual,
+                                                   const int               maxSweeps,
+                                                   int*                    nSweeps,
+                                                   double*                 W,
+                                                   const hipblasStride     strideW,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasCheevjStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasEvect_t    evect,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   hipblasComplex*         A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   const float             abstol,
+                                                   float*                  residual,
+                                                   const int               maxSweeps,
+                                                   int*                    nSweeps,
+                                                   float*                  W,
+                                                   const hipblasStride     strideW,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasZheevjStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasEvect_t    evect,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   hipblasDoubleComplex*   A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   const double            abstol,
+                                                   double*                 residual,
+                                                   const int               maxSweeps,
+                                                   int*                    nSweeps,
+                                                   double*                 W,
+                                                   const hipblasStride     strideW,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+// syevd
+hipblasStatus_t hipblasSsyevdFortran(hipblasHandle_t         handle,
+                                     const hipblasEvect_t    evect,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     float*                  A,
+                                     const int               lda,
+                                     float*                  D,
+                                     float*                  E,
+                                     int*                    info);
+
+hipblasStatus_t hipblasDsyevdFortran(hipblasHandle_t         handle,
+                                     const hipblasEvect_t    evect,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     double*                 A,
+                                     const int               lda,
+                                     double*                 D,
+                                     double*                 E,
+                                     int*                    info);
+
+hipblasStatus_t hipblasCheevdFortran(hipblasHandle_t         handle,
+                                     const hipblasEvect_t    evect,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasComplex*         A,
+                                     const int               lda,
+                                     float*                  D,
+                                     float*                  E,
+                                     int*                    info);
+
+hipblasStatus_t hipblasZheevdFortran(hipblasHandle_t         handle,
+                                     const hipblasEvect_t    evect,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasDoubleComplex*   A,
+                                     const int               lda,
+                                     double*                 D,
+                                     double*                 E,
+                                     int*                    info);
+
+// gesvdj_batched
+hipblasStatus_t hipblasSgesvdjBatchedFortran(hipblasHandle_t      handle,
+                                             const hipblasSvect_t leftSvect,
+                                             const hipblasSvect_t rightSvect,
+                                             const int            m,
+                                             const int            n,
+                                             float* const         A[],
+                                             const int            lda,
+                                             const float          abstol,
+                                             float*               residual,
+                                             const int            maxSweeps,
+                                             int*                 nSweeps,
+                                             float*               S,
+                                             const hipblasStride  strideS,
+                                             float*               U,
+                                             const int            ldu,
+                                             const hipblasStride  strideU,
+                                             float*               V,
+                                             const int            ldv,
+                                             const hipblasStride  strideV,
+                                             int*                 info,
+                                             const int            batchCount);
+
+hipblasStatus_t hipblasDgesvdjBatchedFortran(hipblasHandle_t      handle,
+                                             const hipblasSvect_t leftSvect,
+                                             const hipblasSvect_t rightSvect,
+                                             const int            m,
+                                             const int            n,
+                                             double* const        A[],
+                                             const int            lda,
+                                             const double         abstol,
+                                             double*              residual,
+                                             const int            maxSweeps,
+                                             int*                 nSweeps,
+                                             double*              S,
+                                             const hipblasStride  strideS,
+                                             double*              U,
+                                             const int            ldu,
+                                             const hipblasStride  strideU,
+                                             double*              V,
+                                             const int            ldv,
+                                             const hipblasStride  strideV,
+                                             int*                 info,
+                                             const int            batchCount);
+
+hipblasStatus_t hipblasCgesvdjBatchedFortran(hipblasHandle_t       handle,
+                                             const hipblasSvect_t  leftSvect,
+                                             const hipblasSvect_t  rightSvect,
+                                             const int             m,
+                                             const int             n,
+                                             hipblasComplex* const A[],
+                                             const int             lda,
+                                             const float           abstol,
+                                             float*                residual,
+                                             const int             maxSweeps,
+                                             int*                  nSweeps,
+                                             float*                S,
+                                             const hipblasStride   strideS,
+                                             hipblasComplex*       U,
+                                             const int             ldu,
+                                             const hipblasStride   strideU,
+                                             hipblasComplex*       V,
+                                             const int             ldv,
+                                             const hipblasStride   strideV,
+                                             int*                  info,
+                                             const int             batchCount);
+
+hipblasStatus_t hipblasZgesvdjBatchedFortran(hipblasHandle_t             handle,
+                                             const hipblasSvect_t        leftSvect,
+                                             const hipblasSvect_t        rightSvect,
+                                             const int                   m,
+                                             const int                   n,
+                                             hipblasDoubleComplex* const A[],
+                                             const int                   lda,
+                                             const double                abstol,
+                                             double*                     residual,
+                                             const int                   maxSweeps,
+                                             int*                        nSweeps,
+                                             double*                     S,
+                                             const hipblasStride         strideS,
+                                             hipblasDoubleComplex*       U,
+                                             const int                   ldu,
+                                             const hipblasStride         strideU,
+                                             hipblasDoubleComplex*       V,
+                                             const int                   ldv,
+                                             const hipblasStride         strideV,
+                                             int*                        info,
+                                             const int                   batchCount);
+
+// gesvdj_strided_batched
+hipblasStatus_t hipblasSgesvdjStridedBatchedFortran(hipblasHandle_t      handle,
+                                                    const hipblasSvect_t leftSvect,
+                                                    const hipblasSvect_t rightSvect,
+                                                    const int            m,
+                                                    const int            n,
+                                                    float*               A,
+                                                    const int            lda,
+                                                    const hipblasStride  strideA,
+                                                    const float          abstol,
+                                                    float*               residual,
+                                                    const int            maxSweeps,
+                                                    int*                 nSweeps,
+                                                    float*               S,
+                                                    const hipblasStride  strideS,
+                                                    float*               U,
+                                                    const int            ldu,
+                                                    const hipblasStride  strideU,
+                                                    float*               V,
+                                                    const int            ldv,
+                                                    const hipblasStride  strideV,
+                                                    int*                 info,
+                                                    const int            batchCount);
+
+hipblasStatus_t hipblasDgesvdjStridedBatchedFortran(hipblasHandle_t      handle,
+                                                    const hipblasSvect_t leftSvect,
+                                                    const hipblasSvect_t rightSvect,
+                                                    const int            m,
+                                                    const int            n,
+                                                    double*              A,
+                                                    const int            lda,
+                                                    const hipblasStride  strideA,
+                                                    const double         abstol,
+                                                    double*              residual,
+                                                    const int            maxSweeps,
+                                                    int*                 nSweeps,
+                                                    double*              S,
+                                                    const hipblasStride  strideS,
+                                                    double*              U,
+                                                    const int            ldu,
+                                                    const hipblasStride  strideU,
+                                                    double*              V,
+                                                    const int            ldv,
+                                                    const hipblasStride  strideV,
+                                                    int*                 info,
+                                                    const int            batchCount);
+
+hipblasStatus_t hipblasCgesvdjStridedBatchedFortran(hipblasHandle_t      handle,
+                                                    const hipblasSvect_t leftSvect,
+                                                    const hipblasSvect_t rightSvect,
+                                                    const int            m,
+                                                    const int            n,
+                                                    hipblasComplex*      A,
+                                                    const int            lda,
+                                                    const hipblasStride  strideA,
+                                                    const float          abstol,
+                                                    float*               residual,
+                                                    const int            maxSweeps,
+                                                    int*                 nSweeps,
+                                                    float*               S,
+                                                    const hipblasStride  strideS,
+                                                    hipblasComplex*      U,
+                                                    const int            ldu,
+                                                    const hipblasStride  strideU,
+                                                    hipblasComplex*      V,
+                                                    const int            ldv,
+                                                    const hipblasStride  strideV,
+                                                    int*                 info,
+                                                    const int            batchCount);
+
+hipblasStatus_t hipblasZgesvdjStridedBatchedFortran(hipblasHandle_t       handle,
+                                                    const hipblasSvect_t  leftSvect,
+                                                    const hipblasSvect_t  rightSvect,
+                                                    const int             m,
+                                                    const int             n,
+                                                    hipblasDoubleComplex* A,
+                                                    const int             lda,
+                                                    const hipblasStride   strideA,
+                                                    const double          abstol,
+                                                    double*               residual,
+                                                    const int             maxSweeps,
+                                                    int*                  nSweeps,
+                                                    double*               S,
+                                                    const hipblasStride   strideS,
+                                                    hipblasDoubleComplex* U,
+                                                    const int             ldu,
+                                                    const hipblasStride   strideU,
+                                                    hipblasDoubleComplex* V,
+                                                    const int             ldv,
+                                                    const hipblasStride   strideV,
+                                                    int*                  info,
+                                                    const int             batchCount);
+
+// gesv_batched
+hipblasStatus_t hipblasSgesvBatchedFortran(hipblasHandle_t handle,
+                                           const int       n,
+                                           const int       nrhs,
+                                           float* const    A[],
+                                           const int       lda,
+                                           int*            ipiv,
+                                           float* const    B[],
+                                           const int       ldb,
+                                           int*            info,
+                                           const int       batchCount);
+
+hipblasStatus_t hipblasDgesvBatchedFortran(hipblasHandle_t handle,
+                                           const int       n,
+                                           const int       nrhs,
+                                           double* const   A[],
+                                           const int       lda,
+                                           int*            ipiv,
+                                           double* const   B[],
+                                           const int       ldb,
+                                           int*            info,
+                                           const int       batchCount);
+
+hipblasStatus_t hipblasCgesvBatchedFortran(hipblasHandle_t       handle,
+                                           const int             n,
+                                           const int             nrhs,
+                                           hipblasComplex* const A[],
+                                           const int             lda,
+                                           int*                  ipiv,
+                                           hipblasComplex* const B[],
+                                           const int             ldb,
+                                           int*                  info,
+                                           const int             batchCount);
+
+hipblasStatus_t hipblasZgesvBatchedFortran(hipblasHandle_t             handle,
+                                           const int                   n,
+                                           const int                   nrhs,
+                                           hipblasDoubleComplex* const A[],
+                                           const int                   lda,
+                                           int*                        ipiv,
+                                           hipblasDoubleComplex* const B[],
+                                           const int                   ldb,
+                                           int*                        info,
+                                           const int                   batchCount);
+
+// gesv_strided_batched
+hipblasStatus_t hipblasSgesvStridedBatchedFortran(hipblasHandle_t     handle,
+                                                  const int           n,
+                                                  const int           nrhs,
+                                                  float*              A,
+                                                  const int           lda,
+                                                  const hipblasStride strideA,
+                                                  int*                ipiv,
+                                                  const hipblasStride strideP,
+                                                  float*              B,
+                                                  const int           ldb,
+                                                  const hipblasStride strideB,
+                                                  int*                info,
+                                                  const int           batchCount);
+
+hipblasStatus_t hipblasDgesvStridedBatchedFortran(hipblasHandle_t     handle,
+                                                  const int           n,
+                                                  const int           nrhs,
+                                                  double*             A,
+                                                  const int           lda,
+                                                  const hipblasStride strideA,
+                                                  int*                ipiv,
+                                                  const hipblasStride strideP,
+                                                  double*             B,
+                                                  const int           ldb,
+                                                  const hipblasStride strideB,
+                                                  int*                info,
+                                                  const int           batchCount);
+
+hipblasStatus_t hipblasCgesvStridedBatchedFortran(hipblasHandle_t     handle,
+                                                  const int           n,
+                                                  const int           nrhs,
+                                                  hipblasComplex*     A,
+                                                  const int           lda,
+                                                  const hipblasStride strideA,
+                                                  int*                ipiv,
+                                                  const hipblasStride strideP,
+                                                  hipblasComplex*     B,
+                                                  const int           ldb,
+                                                  const hipblasStride strideB,
+                                                  int*                info,
+                                                  const int           batchCount);
+
+hipblasStatus_t hipblasZgesvStridedBatchedFortran(hipblasHandle_t       handle,
+                                                  const int             n,
+                                                  const int             nrhs,
+                                                  hipblasDoubleComplex* A,
+                                                  const int             lda,
+                                                  const hipblasStride   strideA,
+                                                  int*                  ipiv,
+                                                  const hipblasStride   strideP,
+                                                  hipblasDoubleComplex* B,
+                                                  const int             ldb,
+                                                  const hipblasStride   strideB,
+                                                  int*                  info,
+                                                  const int             batchCount);
 }
 
 #ifdef HIPBLAS_V2
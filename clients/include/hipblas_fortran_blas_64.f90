@@ -21,6 +21,145 @@
 !
 !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 
+!--------!
+!  Aux   !
+!--------!
+function hipblasSetVector_64Fortran(n, elemSize, x, incx, y, incy) &
+    bind(c, name='hipblasSetVector_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSetVector_64Fortran
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: elemSize
+    type(c_ptr), value :: x
+    integer(c_int64_t), value :: incx
+    type(c_ptr), value :: y
+    integer(c_int64_t), value :: incy
+            hipblasSetVector_64Fortran = &
+        hipblasSetVector_64(n, elemSize, x, incx, y, incy)
+end function hipblasSetVector_64Fortran
+
+function hipblasGetVector_64Fortran(n, elemSize, x, incx, y, incy) &
+    bind(c, name='hipblasGetVector_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGetVector_64Fortran
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: elemSize
+    type(c_ptr), value :: x
+    integer(c_int64_t), value :: incx
+    type(c_ptr), value :: y
+    integer(c_int64_t), value :: incy
+            hipblasGetVector_64Fortran = &
+        hipblasGetVector_64(n, elemSize, x, incx, y, incy)
+end function hipblasGetVector_64Fortran
+
+function hipblasSetMatrix_64Fortran(rows, cols, elemSize, A, lda, B, ldb) &
+    bind(c, name='hipblasSetMatrix_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSetMatrix_64Fortran
+    integer(c_int64_t), value :: rows
+    integer(c_int64_t), value :: cols
+    integer(c_int64_t), value :: elemSize
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+            hipblasSetMatrix_64Fortran = &
+        hipblasSetMatrix_64(rows, cols, elemSize, A, lda, B, ldb)
+end function hipblasSetMatrix_64Fortran
+
+function hipblasGetMatrix_64Fortran(rows, cols, elemSize, A, lda, B, ldb) &
+    bind(c, name='hipblasGetMatrix_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGetMatrix_64Fortran
+    integer(c_int64_t), value :: rows
+    integer(c_int64_t), value :: cols
+    integer(c_int64_t), value :: elemSize
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+            hipblasGetMatrix_64Fortran = &
+        hipblasGetMatrix_64(rows, cols, elemSize, A, lda, B, ldb)
+end function hipblasGetMatrix_64Fortran
+
+function hipblasSetVectorAsync_64Fortran(n, elemSize, x, incx, y, incy, stream) &
+    bind(c, name='hipblasSetVectorAsync_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSetVectorAsync_64Fortran
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: elemSize
+    type(c_ptr), value :: x
+    integer(c_int64_t), value :: incx
+    type(c_ptr), value :: y
+    integer(c_int64_t), value :: incy
+    type(c_ptr), value :: stream
+            hipblasSetVectorAsync_64Fortran = &
+        hipblasSetVectorAsync_64(n, elemSize, x, incx, y, incy, stream)
+end function hipblasSetVectorAsync_64Fortran
+
+function hipblasGetVectorAsync_64Fortran(n, elemSize, x, incx, y, incy, stream) &
+    bind(c, name='hipblasGetVectorAsync_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGetVectorAsync_64Fortran
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: elemSize
+    type(c_ptr), value :: x
+    integer(c_int64_t), value :: incx
+    type(c_ptr), value :: y
+    integer(c_int64_t), value :: incy
+    type(c_ptr), value :: stream
+            hipblasGetVectorAsync_64Fortran = &
+        hipblasGetVectorAsync_64(n, elemSize, x, incx, y, incy, stream)
+end function hipblasGetVectorAsync_64Fortran
+
+function hipblasSetMatrixAsync_64Fortran(rows, cols, elemSize, A, lda, B, ldb, stream) &
+    bind(c, name='hipblasSetMatrixAsync_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSetMatrixAsync_64Fortran
+    integer(c_int64_t), value :: rows
+    integer(c_int64_t), value :: cols
+    integer(c_int64_t), value :: elemSize
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    type(c_ptr), value :: stream
+            hipblasSetMatrixAsync_64Fortran = &
+        hipblasSetMatrixAsync_64(rows, cols, elemSize, A, lda, B, ldb, stream)
+end function hipblasSetMatrixAsync_64Fortran
+
+function hipblasGetMatrixAsync_64Fortran(rows, cols, elemSize, A, lda, B, ldb, stream) &
+    bind(c, name='hipblasGetMatrixAsync_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGetMatrixAsync_64Fortran
+    integer(c_int64_t), value :: rows
+    integer(c_int64_t), value :: cols
+    integer(c_int64_t), value :: elemSize
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    type(c_ptr), value :: stream
+            hipblasGetMatrixAsync_64Fortran = &
+        hipblasGetMatrixAsync_64(rows, cols, elemSize, A, lda, B, ldb, stream)
+end function hipblasGetMatrixAsync_64Fortran
+
 !--------!
 ! blas 1 !
 !--------!
@@ -750,6 +750,83 @@ function hipblasZgeqrfBatchedFortran(handle, m, n, A, lda, tau, info, batch_coun
         hipblasZgeqrfBatched(handle, m, n, A, lda, tau, info, batch_count)
 end function hipblasZgeqrfBatchedFortran
 
+! geqrf_batched_strided_tau
+function hipblasSgeqrfBatchedStridedTauFortran(handle, m, n, A, lda, tau, strideT, info, batch_count) &
+    bind(c, name='hipblasSgeqrfBatchedStridedTauFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgeqrfBatchedStridedTauFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: tau
+    integer(c_int64_t), value :: strideT
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasSgeqrfBatchedStridedTauFortran = &
+        hipblasSgeqrfBatchedStridedTau(handle, m, n, A, lda, tau, strideT, info, batch_count)
+end function hipblasSgeqrfBatchedStridedTauFortran
+
+function hipblasDgeqrfBatchedStridedTauFortran(handle, m, n, A, lda, tau, strideT, info, batch_count) &
+    bind(c, name='hipblasDgeqrfBatchedStridedTauFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgeqrfBatchedStridedTauFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: tau
+    integer(c_int64_t), value :: strideT
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasDgeqrfBatchedStridedTauFortran = &
+        hipblasDgeqrfBatchedStridedTau(handle, m, n, A, lda, tau, strideT, info, batch_count)
+end function hipblasDgeqrfBatchedStridedTauFortran
+
+function hipblasCgeqrfBatchedStridedTauFortran(handle, m, n, A, lda, tau, strideT, info, batch_count) &
+    bind(c, name='hipblasCgeqrfBatchedStridedTauFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgeqrfBatchedStridedTauFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: tau
+    integer(c_int64_t), value :: strideT
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasCgeqrfBatchedStridedTauFortran = &
+        hipblasCgeqrfBatchedStridedTau(handle, m, n, A, lda, tau, strideT, info, batch_count)
+end function hipblasCgeqrfBatchedStridedTauFortran
+
+function hipblasZgeqrfBatchedStridedTauFortran(handle, m, n, A, lda, tau, strideT, info, batch_count) &
+    bind(c, name='hipblasZgeqrfBatchedStridedTauFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgeqrfBatchedStridedTauFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: tau
+    integer(c_int64_t), value :: strideT
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasZgeqrfBatchedStridedTauFortran = &
+        hipblasZgeqrfBatchedStridedTau(handle, m, n, A, lda, tau, strideT, info, batch_count)
+end function hipblasZgeqrfBatchedStridedTauFortran
+
 ! geqrf_strided_batched
 function hipblasSgeqrfStridedBatchedFortran(handle, m, n, A, lda, stride_A, &
                                             tau, stride_T, info, batch_count) &
@@ -1121,3 +1198,1556 @@ function hipblasZgelsStridedBatchedFortran(handle, trans, m, n, nrhs, A, &
         hipblasZgelsStridedBatched(handle, trans, m, n, nrhs, A, lda, strideA, &
     B, ldb, strideB, info, deviceInfo, batchCount)
 end function hipblasZgelsStridedBatchedFortran
+
+! potrf
+function hipblasSpotrfFortran(handle, uplo, n, A, lda, info) &
+    bind(c, name='hipblasSpotrfFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrfFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasSpotrfFortran = &
+        hipblasSpotrf(handle, uplo, n, A, lda, info)
+end function hipblasSpotrfFortran
+
+function hipblasDpotrfFortran(handle, uplo, n, A, lda, info) &
+    bind(c, name='hipblasDpotrfFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrfFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasDpotrfFortran = &
+        hipblasDpotrf(handle, uplo, n, A, lda, info)
+end function hipblasDpotrfFortran
+
+function hipblasCpotrfFortran(handle, uplo, n, A, lda, info) &
+    bind(c, name='hipblasCpotrfFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrfFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasCpotrfFortran = &
+        hipblasCpotrf(handle, uplo, n, A, lda, info)
+end function hipblasCpotrfFortran
+
+function hipblasZpotrfFortran(handle, uplo, n, A, lda, info) &
+    bind(c, name='hipblasZpotrfFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrfFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasZpotrfFortran = &
+        hipblasZpotrf(handle, uplo, n, A, lda, info)
+end function hipblasZpotrfFortran
+
+! potrf_batched
+function hipblasSpotrfBatchedFortran(handle, uplo, n, A, lda, info, batchCount) &
+    bind(c, name='hipblasSpotrfBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrfBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasSpotrfBatchedFortran = &
+        hipblasSpotrfBatched(handle, uplo, n, A, lda, info, batchCount)
+end function hipblasSpotrfBatchedFortran
+
+function hipblasDpotrfBatchedFortran(handle, uplo, n, A, lda, info, batchCount) &
+    bind(c, name='hipblasDpotrfBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrfBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasDpotrfBatchedFortran = &
+        hipblasDpotrfBatched(handle, uplo, n, A, lda, info, batchCount)
+end function hipblasDpotrfBatchedFortran
+
+function hipblasCpotrfBatchedFortran(handle, uplo, n, A, lda, info, batchCount) &
+    bind(c, name='hipblasCpotrfBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrfBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasCpotrfBatchedFortran = &
+        hipblasCpotrfBatched(handle, uplo, n, A, lda, info, batchCount)
+end function hipblasCpotrfBatchedFortran
+
+function hipblasZpotrfBatchedFortran(handle, uplo, n, A, lda, info, batchCount) &
+    bind(c, name='hipblasZpotrfBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrfBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasZpotrfBatchedFortran = &
+        hipblasZpotrfBatched(handle, uplo, n, A, lda, info, batchCount)
+end function hipblasZpotrfBatchedFortran
+
+! potrf_strided_batched
+function hipblasSpotrfStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, &
+                                            batchCount) &
+    bind(c, name='hipblasSpotrfStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrfStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasSpotrfStridedBatchedFortran = &
+        hipblasSpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount)
+end function hipblasSpotrfStridedBatchedFortran
+
+function hipblasDpotrfStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, &
+                                            batchCount) &
+    bind(c, name='hipblasDpotrfStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrfStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasDpotrfStridedBatchedFortran = &
+        hipblasDpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount)
+end function hipblasDpotrfStridedBatchedFortran
+
+function hipblasCpotrfStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, &
+                                            batchCount) &
+    bind(c, name='hipblasCpotrfStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrfStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasCpotrfStridedBatchedFortran = &
+        hipblasCpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount)
+end function hipblasCpotrfStridedBatchedFortran
+
+function hipblasZpotrfStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, &
+                                            batchCount) &
+    bind(c, name='hipblasZpotrfStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrfStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasZpotrfStridedBatchedFortran = &
+        hipblasZpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount)
+end function hipblasZpotrfStridedBatchedFortran
+
+! potrs
+function hipblasSpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info) &
+    bind(c, name='hipblasSpotrsFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrsFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    hipblasSpotrsFortran = &
+        hipblasSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info)
+end function hipblasSpotrsFortran
+
+function hipblasDpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info) &
+    bind(c, name='hipblasDpotrsFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrsFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    hipblasDpotrsFortran = &
+        hipblasDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info)
+end function hipblasDpotrsFortran
+
+function hipblasCpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info) &
+    bind(c, name='hipblasCpotrsFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrsFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    hipblasCpotrsFortran = &
+        hipblasCpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info)
+end function hipblasCpotrsFortran
+
+function hipblasZpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info) &
+    bind(c, name='hipblasZpotrsFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrsFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    hipblasZpotrsFortran = &
+        hipblasZpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info)
+end function hipblasZpotrsFortran
+
+! potrs_batched
+function hipblasSpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info, &
+                                     batchCount) &
+    bind(c, name='hipblasSpotrsBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrsBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasSpotrsBatchedFortran = &
+        hipblasSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount)
+end function hipblasSpotrsBatchedFortran
+
+function hipblasDpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info, &
+                                     batchCount) &
+    bind(c, name='hipblasDpotrsBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrsBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasDpotrsBatchedFortran = &
+        hipblasDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount)
+end function hipblasDpotrsBatchedFortran
+
+function hipblasCpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info, &
+                                     batchCount) &
+    bind(c, name='hipblasCpotrsBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrsBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasCpotrsBatchedFortran = &
+        hipblasCpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount)
+end function hipblasCpotrsBatchedFortran
+
+function hipblasZpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info, &
+                                     batchCount) &
+    bind(c, name='hipblasZpotrsBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrsBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasZpotrsBatchedFortran = &
+        hipblasZpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount)
+end function hipblasZpotrsBatchedFortran
+
+! potrs_strided_batched
+function hipblasSpotrsStridedBatchedFortran(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+                                            strideB, info, batchCount) &
+    bind(c, name='hipblasSpotrsStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrsStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasSpotrsStridedBatchedFortran = &
+        hipblasSpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+                                    strideB, info, batchCount)
+end function hipblasSpotrsStridedBatchedFortran
+
+function hipblasDpotrsStridedBatchedFortran(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+                                            strideB, info, batchCount) &
+    bind(c, name='hipblasDpotrsStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrsStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasDpotrsStridedBatchedFortran = &
+        hipblasDpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+                                    strideB, info, batchCount)
+end function hipblasDpotrsStridedBatchedFortran
+
+function hipblasCpotrsStridedBatchedFortran(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+                                            strideB, info, batchCount) &
+    bind(c, name='hipblasCpotrsStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrsStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasCpotrsStridedBatchedFortran = &
+        hipblasCpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+                                    strideB, info, batchCount)
+end function hipblasCpotrsStridedBatchedFortran
+
+function hipblasZpotrsStridedBatchedFortran(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+                                            strideB, info, batchCount) &
+    bind(c, name='hipblasZpotrsStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrsStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasZpotrsStridedBatchedFortran = &
+        hipblasZpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+                                    strideB, info, batchCount)
+end function hipblasZpotrsStridedBatchedFortran
+
+! potri
+function hipblasSpotriFortran(handle, uplo, n, A, lda, info) &
+    bind(c, name='hipblasSpotriFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotriFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasSpotriFortran = &
+        hipblasSpotri(handle, uplo, n, A, lda, info)
+end function hipblasSpotriFortran
+
+function hipblasDpotriFortran(handle, uplo, n, A, lda, info) &
+    bind(c, name='hipblasDpotriFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotriFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasDpotriFortran = &
+        hipblasDpotri(handle, uplo, n, A, lda, info)
+end function hipblasDpotriFortran
+
+function hipblasCpotriFortran(handle, uplo, n, A, lda, info) &
+    bind(c, name='hipblasCpotriFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotriFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasCpotriFortran = &
+        hipblasCpotri(handle, uplo, n, A, lda, info)
+end function hipblasCpotriFortran
+
+function hipblasZpotriFortran(handle, uplo, n, A, lda, info) &
+    bind(c, name='hipblasZpotriFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotriFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasZpotriFortran = &
+        hipblasZpotri(handle, uplo, n, A, lda, info)
+end function hipblasZpotriFortran
+
+! potri_batched
+function hipblasSpotriBatchedFortran(handle, uplo, n, A, lda, info, batchCount) &
+    bind(c, name='hipblasSpotriBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotriBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasSpotriBatchedFortran = &
+        hipblasSpotriBatched(handle, uplo, n, A, lda, info, batchCount)
+end function hipblasSpotriBatchedFortran
+
+function hipblasDpotriBatchedFortran(handle, uplo, n, A, lda, info, batchCount) &
+    bind(c, name='hipblasDpotriBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotriBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasDpotriBatchedFortran = &
+        hipblasDpotriBatched(handle, uplo, n, A, lda, info, batchCount)
+end function hipblasDpotriBatchedFortran
+
+function hipblasCpotriBatchedFortran(handle, uplo, n, A, lda, info, batchCount) &
+    bind(c, name='hipblasCpotriBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotriBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasCpotriBatchedFortran = &
+        hipblasCpotriBatched(handle, uplo, n, A, lda, info, batchCount)
+end function hipblasCpotriBatchedFortran
+
+function hipblasZpotriBatchedFortran(handle, uplo, n, A, lda, info, batchCount) &
+    bind(c, name='hipblasZpotriBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotriBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasZpotriBatchedFortran = &
+        hipblasZpotriBatched(handle, uplo, n, A, lda, info, batchCount)
+end function hipblasZpotriBatchedFortran
+
+! potri_strided_batched
+function hipblasSpotriStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, &
+                                            batchCount) &
+    bind(c, name='hipblasSpotriStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotriStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasSpotriStridedBatchedFortran = &
+        hipblasSpotriStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount)
+end function hipblasSpotriStridedBatchedFortran
+
+function hipblasDpotriStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, &
+                                            batchCount) &
+    bind(c, name='hipblasDpotriStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotriStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasDpotriStridedBatchedFortran = &
+        hipblasDpotriStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount)
+end function hipblasDpotriStridedBatchedFortran
+
+function hipblasCpotriStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, &
+                                            batchCount) &
+    bind(c, name='hipblasCpotriStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotriStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasCpotriStridedBatchedFortran = &
+        hipblasCpotriStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount)
+end function hipblasCpotriStridedBatchedFortran
+
+function hipblasZpotriStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, &
+                                            batchCount) &
+    bind(c, name='hipblasZpotriStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotriStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasZpotriStridedBatchedFortran = &
+        hipblasZpotriStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount)
+end function hipblasZpotriStridedBatchedFortran
+
+! syevj
+function hipblasSsyevjFortran(handle, evect, uplo, n, A, lda, abstol, residual, maxSweeps, &
+                              nSweeps, W, info) &
+    bind(c, name='hipblasSsyevjFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSsyevjFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    real(c_float), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: W
+    type(c_ptr), value :: info
+    hipblasSsyevjFortran = &
+        hipblasSsyevj(handle, evect, uplo, n, A, lda, abstol, residual, maxSweeps, nSweeps, &
+                      W, info)
+end function hipblasSsyevjFortran
+
+function hipblasDsyevjFortran(handle, evect, uplo, n, A, lda, abstol, residual, maxSweeps, &
+                              nSweeps, W, info) &
+    bind(c, name='hipblasDsyevjFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDsyevjFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    real(c_double), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: W
+    type(c_ptr), value :: info
+    hipblasDsyevjFortran = &
+        hipblasDsyevj(handle, evect, uplo, n, A, lda, abstol, residual, maxSweeps, nSweeps, &
+                      W, info)
+end function hipblasDsyevjFortran
+
+function hipblasCheevjFortran(handle, evect, uplo, n, A, lda, abstol, residual, maxSweeps, &
+                              nSweeps, W, info) &
+    bind(c, name='hipblasCheevjFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCheevjFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    real(c_float), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: W
+    type(c_ptr), value :: info
+    hipblasCheevjFortran = &
+        hipblasCheevj(handle, evect, uplo, n, A, lda, abstol, residual, maxSweeps, nSweeps, &
+                      W, info)
+end function hipblasCheevjFortran
+
+function hipblasZheevjFortran(handle, evect, uplo, n, A, lda, abstol, residual, maxSweeps, &
+                              nSweeps, W, info) &
+    bind(c, name='hipblasZheevjFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZheevjFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    real(c_double), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: W
+    type(c_ptr), value :: info
+    hipblasZheevjFortran = &
+        hipblasZheevj(handle, evect, uplo, n, A, lda, abstol, residual, maxSweeps, nSweeps, &
+                      W, info)
+end function hipblasZheevjFortran
+
+! syevj_batched
+function hipblasSsyevjBatchedFortran(handle, evect, uplo, n, A, lda, abstol, residual, &
+                                     maxSweeps, nSweeps, W, strideW, info, batchCount) &
+    bind(c, name='hipblasSsyevjBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSsyevjBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    real(c_float), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: W
+    integer(c_int64_t), value :: strideW
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasSsyevjBatchedFortran = &
+        hipblasSsyevjBatched(handle, evect, uplo, n, A, lda, abstol, residual, maxSweeps, &
+                             nSweeps, W, strideW, info, batchCount)
+end function hipblasSsyevjBatchedFortran
+
+function hipblasDsyevjBatchedFortran(handle, evect, uplo, n, A, lda, abstol, residual, &
+                                     maxSweeps, nSweeps, W, strideW, info, batchCount) &
+    bind(c, name='hipblasDsyevjBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDsyevjBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    real(c_double), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: W
+    integer(c_int64_t), value :: strideW
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasDsyevjBatchedFortran = &
+        hipblasDsyevjBatched(handle, evect, uplo, n, A, lda, abstol, residual, maxSweeps, &
+                             nSweeps, W, strideW, info, batchCount)
+end function hipblasDsyevjBatchedFortran
+
+function hipblasCheevjBatchedFortran(handle, evect, uplo, n, A, lda, abstol, residual, &
+                                     maxSweeps, nSweeps, W, strideW, info, batchCount) &
+    bind(c, name='hipblasCheevjBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCheevjBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    real(c_float), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: W
+    integer(c_int64_t), value :: strideW
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasCheevjBatchedFortran = &
+        hipblasCheevjBatched(handle, evect, uplo, n, A, lda, abstol, residual, maxSweeps, &
+                             nSweeps, W, strideW, info, batchCount)
+end function hipblasCheevjBatchedFortran
+
+function hipblasZheevjBatchedFortran(handle, evect, uplo, n, A, lda, abstol, residual, &
+                                     maxSweeps, nSweeps, W, strideW, info, batchCount) &
+    bind(c, name='hipblasZheevjBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZheevjBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    real(c_double), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: W
+    integer(c_int64_t), value :: strideW
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasZheevjBatchedFortran = &
+        hipblasZheevjBatched(handle, evect, uplo, n, A, lda, abstol, residual, maxSweeps, &
+                             nSweeps, W, strideW, info, batchCount)
+end function hipblasZheevjBatchedFortran
+
+! syevj_strided_batched
+function hipblasSsyevjStridedBatchedFortran(handle, evect, uplo, n, A, lda, strideA, &
+                                            abstol, residual, maxSweeps, nSweeps, W, &
+                                            strideW, info, batchCount) &
+    bind(c, name='hipblasSsyevjStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSsyevjStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    real(c_float), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: W
+    integer(c_int64_t), value :: strideW
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasSsyevjStridedBatchedFortran = &
+        hipblasSsyevjStridedBatched(handle, evect, uplo, n, A, lda, strideA, abstol, &
+                                    residual, maxSweeps, nSweeps, W, strideW, info, &
+                                    batchCount)
+end function hipblasSsyevjStridedBatchedFortran
+
+function hipblasDsyevjStridedBatchedFortran(handle, evect, uplo, n, A, lda, strideA, &
+                                            abstol, residual, maxSweeps, nSweeps, W, &
+                                            strideW, info, batchCount) &
+    bind(c, name='hipblasDsyevjStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDsyevjStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    real(c_double), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: W
+    integer(c_int64_t), value :: strideW
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasDsyevjStridedBatchedFortran = &
+        hipblasDsyevjStridedBatched(handle, evect, uplo, n, A, lda, strideA, abstol, &
+                                    residual, maxSweeps, nSweeps, W, strideW, info, &
+                                    batchCount)
+end function hipblasDsyevjStridedBatchedFortran
+
+function hipblasCheevjStridedBatchedFortran(handle, evect, uplo, n, A, lda, strideA, &
+                                            abstol, residual, maxSweeps, nSweeps, W, &
+                                            strideW, info, batchCount) &
+    bind(c, name='hipblasCheevjStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCheevjStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    real(c_float), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: W
+    integer(c_int64_t), value :: strideW
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasCheevjStridedBatchedFortran = &
+        hipblasCheevjStridedBatched(handle, evect, uplo, n, A, lda, strideA, abstol, &
+                                    residual, maxSweeps, nSweeps, W, strideW, info, &
+                                    batchCount)
+end function hipblasCheevjStridedBatchedFortran
+
+function hipblasZheevjStridedBatchedFortran(handle, evect, uplo, n, A, lda, strideA, &
+                                            abstol, residual, maxSweeps, nSweeps, W, &
+                                            strideW, info, batchCount) &
+    bind(c, name='hipblasZheevjStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZheevjStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    real(c_double), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: W
+    integer(c_int64_t), value :: strideW
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasZheevjStridedBatchedFortran = &
+        hipblasZheevjStridedBatched(handle, evect, uplo, n, A, lda, strideA, abstol, &
+                                    residual, maxSweeps, nSweeps, W, strideW, info, &
+                                    batchCount)
+end function hipblasZheevjStridedBatchedFortran
+
+! syevd
+function hipblasSsyevdFortran(handle, evect, uplo, n, A, lda, D, E, info) &
+    bind(c, name='hipblasSsyevdFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSsyevdFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: D
+    type(c_ptr), value :: E
+    type(c_ptr), value :: info
+    hipblasSsyevdFortran = &
+        hipblasSsyevd(handle, evect, uplo, n, A, lda, D, E, info)
+end function hipblasSsyevdFortran
+
+function hipblasDsyevdFortran(handle, evect, uplo, n, A, lda, D, E, info) &
+    bind(c, name='hipblasDsyevdFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDsyevdFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: D
+    type(c_ptr), value :: E
+    type(c_ptr), value :: info
+    hipblasDsyevdFortran = &
+        hipblasDsyevd(handle, evect, uplo, n, A, lda, D, E, info)
+end function hipblasDsyevdFortran
+
+function hipblasCheevdFortran(handle, evect, uplo, n, A, lda, D, E, info) &
+    bind(c, name='hipblasCheevdFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCheevdFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: D
+    type(c_ptr), value :: E
+    type(c_ptr), value :: info
+    hipblasCheevdFortran = &
+        hipblasCheevd(handle, evect, uplo, n, A, lda, D, E, info)
+end function hipblasCheevdFortran
+
+function hipblasZheevdFortran(handle, evect, uplo, n, A, lda, D, E, info) &
+    bind(c, name='hipblasZheevdFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZheevdFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: D
+    type(c_ptr), value :: E
+    type(c_ptr), value :: info
+    hipblasZheevdFortran = &
+        hipblasZheevd(handle, evect, uplo, n, A, lda, D, E, info)
+end function hipblasZheevdFortran
+
+! gesvdj_batched
+function hipblasSgesvdjBatchedFortran(handle, leftSvect, rightSvect, m, n, A, lda, abstol, &
+                                      residual, maxSweeps, nSweeps, S, strideS, U, ldu, &
+                                      strideU, V, ldv, strideV, info, batchCount) &
+    bind(c, name='hipblasSgesvdjBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgesvdjBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVECT_NONE)), value :: leftSvect
+    integer(kind(HIPBLAS_SVECT_NONE)), value :: rightSvect
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    real(c_float), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: S
+    integer(c_int64_t), value :: strideS
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    integer(c_int64_t), value :: strideU
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    integer(c_int64_t), value :: strideV
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasSgesvdjBatchedFortran = &
+        hipblasSgesvdjBatched(handle, leftSvect, rightSvect, m, n, A, lda, abstol, &
+                              residual, maxSweeps, nSweeps, S, strideS, U, ldu, strideU, V, &
+                              ldv, strideV, info, batchCount)
+end function hipblasSgesvdjBatchedFortran
+
+function hipblasDgesvdjBatchedFortran(handle, leftSvect, rightSvect, m, n, A, lda, abstol, &
+                                      residual, maxSweeps, nSweeps, S, strideS, U, ldu, &
+                                      strideU, V, ldv, strideV, info, batchCount) &
+    bind(c, name='hipblasDgesvdjBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgesvdjBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVECT_NONE)), value :: leftSvect
+    integer(kind(HIPBLAS_SVECT_NONE)), value :: rightSvect
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    real(c_double), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: S
+    integer(c_int64_t), value :: strideS
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    integer(c_int64_t), value :: strideU
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    integer(c_int64_t), value :: strideV
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasDgesvdjBatchedFortran = &
+        hipblasDgesvdjBatched(handle, leftSvect, rightSvect, m, n, A, lda, abstol, &
+                              residual, maxSweeps, nSweeps, S, strideS, U, ldu, strideU, V, &
+                              ldv, strideV, info, batchCount)
+end function hipblasDgesvdjBatchedFortran
+
+function hipblasCgesvdjBatchedFortran(handle, leftSvect, rightSvect, m, n, A, lda, abstol, &
+                                      residual, maxSweeps, nSweeps, S, strideS, U, ldu, &
+                                      strideU, V, ldv, strideV, info, batchCount) &
+    bind(c, name='hipblasCgesvdjBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgesvdjBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVECT_NONE)), value :: leftSvect
+    integer(kind(HIPBLAS_SVECT_NONE)), value :: rightSvect
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    real(c_float), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: S
+    integer(c_int64_t), value :: strideS
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    integer(c_int64_t), value :: strideU
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    integer(c_int64_t), value :: strideV
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasCgesvdjBatchedFortran = &
+        hipblasCgesvdjBatched(handle, leftSvect, rightSvect, m, n, A, lda, abstol, &
+                              residual, maxSweeps, nSweeps, S, strideS, U, ldu, strideU, V, &
+                              ldv, strideV, info, batchCount)
+end function hipblasCgesvdjBatchedFortran
+
+function hipblasZgesvdjBatchedFortran(handle, leftSvect, rightSvect, m, n, A, lda, abstol, &
+                                      residual, maxSweeps, nSweeps, S, strideS, U, ldu, &
+                                      strideU, V, ldv, strideV, info, batchCount) &
+    bind(c, name='hipblasZgesvdjBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgesvdjBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVECT_NONE)), value :: leftSvect
+    integer(kind(HIPBLAS_SVECT_NONE)), value :: rightSvect
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    real(c_double), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: S
+    integer(c_int64_t), value :: strideS
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    integer(c_int64_t), value :: strideU
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    integer(c_int64_t), value :: strideV
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasZgesvdjBatchedFortran = &
+        hipblasZgesvdjBatched(handle, leftSvect, rightSvect, m, n, A, lda, abstol, &
+                              residual, maxSweeps, nSweeps, S, strideS, U, ldu, strideU, V, &
+                              ldv, strideV, info, batchCount)
+end function hipblasZgesvdjBatchedFortran
+
+! gesvdj_strided_batched
+function hipblasSgesvdjStridedBatchedFortran(handle, leftSvect, rightSvect, m, n, A, lda, &
+                                             strideA, abstol, residual, maxSweeps, nSweeps, &
+                                             S, strideS, U, ldu, strideU, V, ldv, strideV, &
+                                             info, batchCount) &
+    bind(c, name='hipblasSgesvdjStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgesvdjStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVECT_NONE)), value :: leftSvect
+    integer(kind(HIPBLAS_SVECT_NONE)), value :: rightSvect
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    real(c_float), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: S
+    integer(c_int64_t), value :: strideS
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    integer(c_int64_t), value :: strideU
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    integer(c_int64_t), value :: strideV
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasSgesvdjStridedBatchedFortran = &
+        hipblasSgesvdjStridedBatched(handle, leftSvect, rightSvect, m, n, A, lda, strideA, &
+                                     abstol, residual, maxSweeps, nSweeps, S, strideS, U, &
+                                     ldu, strideU, V, ldv, strideV, info, batchCount)
+end function hipblasSgesvdjStridedBatchedFortran
+
+function hipblasDgesvdjStridedBatchedFortran(handle, leftSvect, rightSvect, m, n, A, lda, &
+                                             strideA, abstol, residual, maxSweeps, nSweeps, &
+                                             S, strideS, U, ldu, strideU, V, ldv, strideV, &
+                                             info, batchCount) &
+    bind(c, name='hipblasDgesvdjStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgesvdjStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVECT_NONE)), value :: leftSvect
+    integer(kind(HIPBLAS_SVECT_NONE)), value :: rightSvect
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    real(c_double), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: S
+    integer(c_int64_t), value :: strideS
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    integer(c_int64_t), value :: strideU
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    integer(c_int64_t), value :: strideV
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasDgesvdjStridedBatchedFortran = &
+        hipblasDgesvdjStridedBatched(handle, leftSvect, rightSvect, m, n, A, lda, strideA, &
+                                     abstol, residual, maxSweeps, nSweeps, S, strideS, U, &
+                                     ldu, strideU, V, ldv, strideV, info, batchCount)
+end function hipblasDgesvdjStridedBatchedFortran
+
+function hipblasCgesvdjStridedBatchedFortran(handle, leftSvect, rightSvect, m, n, A, lda, &
+                                             strideA, abstol, residual, maxSweeps, nSweeps, &
+                                             S, strideS, U, ldu, strideU, V, ldv, strideV, &
+                                             info, batchCount) &
+    bind(c, name='hipblasCgesvdjStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgesvdjStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVECT_NONE)), value :: leftSvect
+    integer(kind(HIPBLAS_SVECT_NONE)), value :: rightSvect
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    real(c_float), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: S
+    integer(c_int64_t), value :: strideS
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    integer(c_int64_t), value :: strideU
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    integer(c_int64_t), value :: strideV
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasCgesvdjStridedBatchedFortran = &
+        hipblasCgesvdjStridedBatched(handle, leftSvect, rightSvect, m, n, A, lda, strideA, &
+                                     abstol, residual, maxSweeps, nSweeps, S, strideS, U, &
+                                     ldu, strideU, V, ldv, strideV, info, batchCount)
+end function hipblasCgesvdjStridedBatchedFortran
+
+function hipblasZgesvdjStridedBatchedFortran(handle, leftSvect, rightSvect, m, n, A, lda, &
+                                             strideA, abstol, residual, maxSweeps, nSweeps, &
+                                             S, strideS, U, ldu, strideU, V, ldv, strideV, &
+                                             info, batchCount) &
+    bind(c, name='hipblasZgesvdjStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgesvdjStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVECT_NONE)), value :: leftSvect
+    integer(kind(HIPBLAS_SVECT_NONE)), value :: rightSvect
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    real(c_double), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: S
+    integer(c_int64_t), value :: strideS
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    integer(c_int64_t), value :: strideU
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    integer(c_int64_t), value :: strideV
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasZgesvdjStridedBatchedFortran = &
+        hipblasZgesvdjStridedBatched(handle, leftSvect, rightSvect, m, n, A, lda, strideA, &
+                                     abstol, residual, maxSweeps, nSweeps, S, strideS, U, &
+                                     ldu, strideU, V, ldv, strideV, info, batchCount)
+end function hipblasZgesvdjStridedBatchedFortran
+
+! gesv_batched
+function hipblasSgesvBatchedFortran(handle, n, nrhs, A, lda, ipiv, B, ldb, info, &
+                                    batchCount) &
+    bind(c, name='hipblasSgesvBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgesvBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasSgesvBatchedFortran = &
+        hipblasSgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount)
+end function hipblasSgesvBatchedFortran
+
+function hipblasDgesvBatchedFortran(handle, n, nrhs, A, lda, ipiv, B, ldb, info, &
+                                    batchCount) &
+    bind(c, name='hipblasDgesvBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgesvBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasDgesvBatchedFortran = &
+        hipblasDgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount)
+end function hipblasDgesvBatchedFortran
+
+function hipblasCgesvBatchedFortran(handle, n, nrhs, A, lda, ipiv, B, ldb, info, &
+                                    batchCount) &
+    bind(c, name='hipblasCgesvBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgesvBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasCgesvBatchedFortran = &
+        hipblasCgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount)
+end function hipblasCgesvBatchedFortran
+
+function hipblasZgesvBatchedFortran(handle, n, nrhs, A, lda, ipiv, B, ldb, info, &
+                                    batchCount) &
+    bind(c, name='hipblasZgesvBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgesvBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasZgesvBatchedFortran = &
+        hipblasZgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount)
+end function hipblasZgesvBatchedFortran
+
+! gesv_strided_batched
+function hipblasSgesvStridedBatchedFortran(handle, n, nrhs, A, lda, strideA, ipiv, strideP, &
+                                           B, ldb, strideB, info, batchCount) &
+    bind(c, name='hipblasSgesvStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgesvStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasSgesvStridedBatchedFortran = &
+        hipblasSgesvStridedBatched(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, &
+                                   strideB, info, batchCount)
+end function hipblasSgesvStridedBatchedFortran
+
+function hipblasDgesvStridedBatchedFortran(handle, n, nrhs, A, lda, strideA, ipiv, strideP, &
+                                           B, ldb, strideB, info, batchCount) &
+    bind(c, name='hipblasDgesvStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgesvStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasDgesvStridedBatchedFortran = &
+        hipblasDgesvStridedBatched(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, &
+                                   strideB, info, batchCount)
+end function hipblasDgesvStridedBatchedFortran
+
+function hipblasCgesvStridedBatchedFortran(handle, n, nrhs, A, lda, strideA, ipiv, strideP, &
+                                           B, ldb, strideB, info, batchCount) &
+    bind(c, name='hipblasCgesvStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgesvStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasCgesvStridedBatchedFortran = &
+        hipblasCgesvStridedBatched(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, &
+                                   strideB, info, batchCount)
+end function hipblasCgesvStridedBatchedFortran
+
+function hipblasZgesvStridedBatchedFortran(handle, n, nrhs, A, lda, strideA, ipiv, strideP, &
+                                           B, ldb, strideB, info, batchCount) &
+    bind(c, name='hipblasZgesvStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgesvStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasZgesvStridedBatchedFortran = &
+        hipblasZgesvStridedBatched(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, &
+                                   strideB, info, batchCount)
+end function hipblasZgesvStridedBatchedFortran
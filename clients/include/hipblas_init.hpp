@@ -27,8 +27,10 @@
 #include <omp.h>
 #endif
 #include <assert.h>
+#include <cstring>
 
 #include "hipblas.h"
+#include "hipblas_philox.hpp"
 #include "host_batch_vector.hpp"
 #include "host_strided_batch_vector.hpp"
 #include "host_vector.hpp"
@@ -71,6 +73,110 @@ typedef enum hipblas_matrix_type_
 
 } hipblas_matrix_type;
 
+/* ============================================================================================ */
+/*! \brief  Stateless random data for the OpenMP initializations, from the counter-based generator
+ *          of hipblas_philox.hpp. Element index of batch b is a function of the seed, the index and
+ *          b only, so the data doesn't depend on the number of threads or the machine, and it is
+ *          the data that hipblas_init_device draws for the same seed */
+
+//! @brief The data drawn by hipblas_counter_rng.
+enum class hipblas_rng_data
+{
+    rand_int, // integers in the range of random_generator
+    hpl, // values in the range of random_hpl_generator
+    nan, // NaNs with random bits, like random_nan_generator
+};
+
+template <typename T>
+class hipblas_counter_rng
+{
+    uint64_t         m_seed;
+    hipblas_rng_data m_data;
+
+    // A NaN with the random bits of bits, like hipblas_nan_rng
+    template <typename F, typename UINT_T, int SIG, int EXP>
+    static F nan_data(uint64_t bits)
+    {
+        static_assert(sizeof(UINT_T) == sizeof(F), "Type sizes do not match");
+        UINT_T u = UINT_T(bits) | 1; // Not Inf (mantissa == 0)
+        u |= (((UINT_T)1 << EXP) - 1) << SIG; // Exponent = all 1's
+        F fp;
+        std::memcpy(&fp, &u, sizeof(fp));
+        return fp;
+    }
+
+public:
+    //! @brief A generator with the next seed of hipblas_counter_seed.
+    explicit hipblas_counter_rng(hipblas_rng_data data)
+        : m_seed(hipblas_counter_seed++)
+        , m_data(data)
+    {
+    }
+
+    T operator()(int64_t batch_index, int64_t index) const
+    {
+        hipblas_philox rng(m_seed, index, batch_index);
+        uint64_t       bits = uint64_t(rng.r[1]) << 32 | rng.r[0];
+
+        if constexpr(std::is_same_v<T, hipblasHalf>)
+        {
+            return m_data == hipblas_rng_data::nan ? nan_data<hipblasHalf, uint16_t, 10, 5>(bits)
+                   : m_data == hipblas_rng_data::hpl ? float_to_half(rng.hpl_float(0))
+                                                     : float_to_half(float(rng.rand_int(0, 3)));
+        }
+        else if constexpr(std::is_same_v<T, hipblasBfloat16>)
+        {
+            return m_data == hipblas_rng_data::nan
+                       ? nan_data<hipblasBfloat16, uint16_t, 7, 8>(bits)
+                   : m_data == hipblas_rng_data::hpl ? float_to_bfloat16(rng.hpl_float(0))
+                                                     : float_to_bfloat16(float(rng.rand_int(0, 3)));
+        }
+        else if constexpr(std::is_same_v<T, float> || std::is_same_v<T, hipblasComplex>)
+        {
+            if(m_data == hipblas_rng_data::nan)
+            {
+                uint64_t high = uint64_t(rng.r[3]) << 32 | rng.r[2];
+                if constexpr(std::is_same_v<T, float>)
+                    return nan_data<float, uint32_t, 23, 8>(bits);
+                else
+                    return {nan_data<float, uint32_t, 23, 8>(bits),
+                            nan_data<float, uint32_t, 23, 8>(high)};
+            }
+            if(m_data == hipblas_rng_data::hpl)
+                return T(rng.hpl_float(0));
+            if constexpr(std::is_same_v<T, float>)
+                return float(rng.rand_int(0, 10));
+            else
+                return {float(rng.rand_int(0, 10)), float(rng.rand_int(1, 10))};
+        }
+        else if constexpr(std::is_same_v<T, double> || std::is_same_v<T, hipblasDoubleComplex>)
+        {
+            if(m_data == hipblas_rng_data::nan)
+            {
+                uint64_t high = uint64_t(rng.r[3]) << 32 | rng.r[2];
+                if constexpr(std::is_same_v<T, double>)
+                    return nan_data<double, uint64_t, 52, 11>(bits);
+                else
+                    return {nan_data<double, uint64_t, 52, 11>(bits),
+                            nan_data<double, uint64_t, 52, 11>(high)};
+            }
+            if(m_data == hipblas_rng_data::hpl)
+                return T(rng.hpl_double());
+            if constexpr(std::is_same_v<T, double>)
+                return double(rng.rand_int(0, 10));
+            else
+                return {double(rng.rand_int(0, 10)), double(rng.rand_int(1, 10))};
+        }
+        else
+        {
+            // Integers: any value for NaN, and the hpl values truncate to 0 as on the device
+            return m_data == hipblas_rng_data::nan ? T(bits)
+                   : m_data == hipblas_rng_data::hpl ? T(0)
+                                                     : T(rng.rand_int(0, 10));
+        }
+    }
+};
+
 template <typename T>
 void hipblas_init(
     T* A, int64_t M, int64_t N, int64_t lda, hipblasStride stride = 0, int64_t batch_count = 1)
@@ -92,10 +198,10 @@ inline void hipblas_init_nan(T* A, size_t N)
 }
 
 template <typename U, typename T>
-void hipblas_init_matrix_alternating_sign(hipblas_matrix_type matrix_type,
-                                          const char          uplo,
-                                          T                   rand_gen(),
-                                          U&                  hA)
+void hipblas_init_matrix_alternating_sign(hipblas_matrix_type           matrix_type,
+                                          const char                    uplo,
+                                          const hipblas_counter_rng<T>& rand_gen,
+                                          U&                            hA)
 {
     auto M   = hA.m();
     auto N   = hA.n();
@@ -110,10 +216,10 @@ void hipblas_init_matrix_alternating_sign(hipblas_matrix_type matrix_type,
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-            for(size_t i = 0; i < M; ++i)
-                for(size_t j = 0; j < N; ++j)
+            for(size_t j = 0; j < N; ++j)
+                for(size_t i = 0; i < M; ++i)
                 {
-                    auto value     = rand_gen();
+                    auto value     = rand_gen(batch_index, i + j * M);
                     A[i + j * lda] = (i ^ j) & 1 ? T(value) : T(hipblas_negate(value));
                 }
         }
@@ -122,11 +228,11 @@ void hipblas_init_matrix_alternating_sign(hipblas_matrix_type matrix_type,
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-            for(size_t i = 0; i < M; ++i)
-                for(size_t j = 0; j < N; ++j)
+            for(size_t j = 0; j < N; ++j)
+                for(size_t i = 0; i < M; ++i)
                 {
-                    auto value
-                        = uplo == 'U' ? (j >= i ? rand_gen() : T(0)) : (j <= i ? rand_gen() : T(0));
+                    bool stored    = uplo == 'U' ? j >= i : j <= i;
+                    auto value     = stored ? rand_gen(batch_index, i + j * M) : T(0);
                     A[i + j * lda] = (i ^ j) & 1 ? T(value) : T(hipblas_negate(value));
                 }
         }
@@ -135,7 +241,11 @@ void hipblas_init_matrix_alternating_sign(hipblas_matrix_type matrix_type,
 
 // Initialize vector so adjacent entries have alternating sign.
 template <typename T>
-void hipblas_init_vector_alternating_sign(T rand_gen(), T* x, int64_t N, int64_t incx)
+void hipblas_init_vector_alternating_sign(const hipblas_counter_rng<T>& rand_gen,
+                                          T*                            x,
+                                          int64_t                       N,
+                                          int64_t                       incx,
+                                          int64_t                       batch_index = 0)
 {
     if(incx < 0)
         x -= (N - 1) * incx;
@@ -145,13 +255,16 @@ void hipblas_init_vector_alternating_sign(T rand_gen(), T* x, int64_t N, int64_t
 #endif
     for(int64_t j = 0; j < N; ++j)
     {
-        auto value  = rand_gen();
+        auto value  = rand_gen(batch_index, j);
         x[j * incx] = j & 1 ? T(value) : T(hipblas_negate(value));
     }
 }
 
 template <typename U, typename T>
-void hipblas_init_matrix(hipblas_matrix_type matrix_type, const char uplo, T rand_gen(), U& hA)
+void hipblas_init_matrix(hipblas_matrix_type           matrix_type,
+                         const char                    uplo,
+                         const hipblas_counter_rng<T>& rand_gen,
+                         U&                            hA)
 {
     for(int64_t batch_index = 0; batch_index < hA.batch_count(); ++batch_index)
     {
@@ -166,7 +279,7 @@ void hipblas_init_matrix(hipblas_matrix_type matrix_type, const char uplo, T ran
 #endif
             for(size_t j = 0; j < N; ++j)
                 for(size_t i = 0; i < M; ++i)
-                    A[i + j * lda] = rand_gen();
+                    A[i + j * lda] = rand_gen(batch_index, i + j * M);
         }
         else if(matrix_type == hipblas_hermitian_matrix)
         {
@@ -176,7 +289,7 @@ void hipblas_init_matrix(hipblas_matrix_type matrix_type, const char uplo, T ran
             for(size_t i = 0; i < N; ++i)
                 for(size_t j = 0; j <= i; ++j)
                 {
-                    auto value = rand_gen();
+                    auto value = rand_gen(batch_index, j + i * M);
                     if(i == j)
                         A[j + i * lda] = hipblas_real(value);
                     else if(uplo == 'U')
@@ -204,7 +317,7 @@ void hipblas_init_matrix(hipblas_matrix_type matrix_type, const char uplo, T ran
             for(size_t i = 0; i < N; ++i)
                 for(size_t j = 0; j <= i; ++j)
                 {
-                    auto value = rand_gen();
+                    auto value = rand_gen(batch_index, j + i * M);
                     if(i == j)
                         A[j + i * lda] = value;
                     else if(uplo == 'U')
@@ -232,9 +345,8 @@ void hipblas_init_matrix(hipblas_matrix_type matrix_type, const char uplo, T ran
             for(size_t j = 0; j < N; ++j)
                 for(size_t i = 0; i < M; ++i)
                 {
-                    auto value
-                        = uplo == 'U' ? (j >= i ? rand_gen() : T(0)) : (j <= i ? rand_gen() : T(0));
-                    A[i + j * lda] = value;
+                    bool stored    = uplo == 'U' ? j >= i : j <= i;
+                    A[i + j * lda] = stored ? rand_gen(batch_index, i + j * M) : T(0);
                 }
         }
         else if(matrix_type == hipblas_diagonally_dominant_triangular_matrix)
@@ -250,9 +362,8 @@ void hipblas_init_matrix(hipblas_matrix_type matrix_type, const char uplo, T ran
             for(size_t j = 0; j < N; ++j)
                 for(size_t i = 0; i < M; ++i)
                 {
-                    auto value
-                        = uplo == 'U' ? (j >= i ? rand_gen() : T(0)) : (j <= i ? rand_gen() : T(0));
-                    A[i + j * lda] = value;
+                    bool stored    = uplo == 'U' ? j >= i : j <= i;
+                    A[i + j * lda] = stored ? rand_gen(batch_index, i + j * M) : T(0);
                 }
 
             const T multiplier = T(
@@ -313,7 +424,11 @@ void hipblas_init_matrix(hipblas_matrix_type matrix_type, const char uplo, T ran
 // Initialize vectors with rand_int/hpl/NaN values
 
 template <typename T>
-void hipblas_init_vector(T rand_gen(), T* x, int64_t N, int64_t incx)
+void hipblas_init_vector(const hipblas_counter_rng<T>& rand_gen,
+                         T*                            x,
+                         int64_t                       N,
+                         int64_t                       incx,
+                         int64_t                       batch_index = 0)
 {
     if(incx < 0)
         x -= (N - 1) * incx;
@@ -322,7 +437,7 @@ void hipblas_init_vector(T rand_gen(), T* x, int64_t N, int64_t incx)
 #pragma omp parallel for
 #endif
     for(int64_t j = 0; j < N; ++j)
-        x[j * incx] = rand_gen();
+        x[j * incx] = rand_gen(batch_index, j);
 }
 
 template <typename T, typename U>
@@ -0,0 +1,182 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas_arguments.hpp"
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+//!
+//! @brief The path of arg.input_file for an operand 'A', 'B' or 'C': the entries of the comma
+//!        separated list are the files of A, B and C in order. The path is empty for an operand
+//!        without a file, which keeps the usual initialization.
+//!
+std::string hipblas_input_file_path(const Arguments& arg, char operand);
+
+//!
+//! @brief The kind of the elements of a type, as the character of a .npy descr: 'f' for floating
+//!        point, 'c' for complex and 'i' for integers, with 'b' for bfloat16, which numpy lacks.
+//!
+template <typename T>
+constexpr char hipblas_input_kind = std::is_same_v<T, hipblasBfloat16> ? 'b'
+                                    : is_complex<T>                    ? 'c'
+                                    : std::is_integral_v<T>            ? 'i'
+                                                                       : 'f';
+
+//!
+//! @brief A matrix file of --input_file, memory mapped. A .npy file is described by its header, of
+//!        1, 2 or 3 dimensions: a vector, a (rows, cols) matrix or a (batch, rows, cols) batch, in
+//!        C or Fortran order. Any other file is raw column major data of the kind and size given
+//!        to the constructor.
+//!
+class hipblas_input_file
+{
+public:
+    hipblas_input_file(const std::string& path, char kind, size_t elem_size);
+    ~hipblas_input_file();
+
+    hipblas_input_file(const hipblas_input_file&) = delete;
+    hipblas_input_file& operator=(const hipblas_input_file&) = delete;
+
+    const char* data() const
+    {
+        return m_data;
+    }
+
+    char kind() const
+    {
+        return m_kind;
+    }
+
+    size_t elem_size() const
+    {
+        return m_elem_size;
+    }
+
+    //!
+    //! @brief The element of row i and column j of matrix b of an m by n batch. Shaped files are
+    //!        tiled over larger matrices and batches, vectors and raw files are read in column
+    //!        major order, wrapping around at the end of the file.
+    //!
+    size_t index(int64_t i, int64_t j, int64_t b, int64_t m, int64_t n) const;
+
+    //!
+    //! @brief Whether the elements of an m by n batch with lda = m and stride = m * n lie in the
+    //!        file in the same order, without tiling, so they can be copied in one piece.
+    //!
+    bool contiguous(int64_t m, int64_t n, int64_t batch_count) const;
+
+    //!
+    //! @brief The (real, imaginary) value of an element.
+    //!
+    std::pair<double, double> value(size_t k) const;
+
+    //!
+    //! @brief Registers the mapping with the device, so copies from it are DMA from the page cache
+    //!        rather than staged through a pinned bounce buffer. False if it can't be registered.
+    //!
+    bool pin();
+
+private:
+    std::string       m_path;
+    char*             m_map  = nullptr;
+    size_t            m_size = 0;
+    std::vector<char> m_buffer;
+    bool              m_pinned = false;
+
+    const char* m_data = nullptr;
+    size_t      m_count = 0;
+    char        m_kind;
+    size_t      m_elem_size;
+    bool        m_shaped = false;
+    int64_t     m_rows = 0, m_cols = 0, m_batches = 1;
+    int64_t     m_row_stride = 0, m_col_stride = 0, m_batch_stride = 0;
+
+    void parse_npy();
+};
+
+//!
+//! @brief Fills an m by n batch of leading dimension lda and stride from a file, converting its
+//!        elements to T unless they already have the kind and size of T.
+//!
+template <typename T>
+void hipblas_input_file_fill(const hipblas_input_file& file,
+                             T*                        A,
+                             int64_t                   m,
+                             int64_t                   n,
+                             int64_t                   lda,
+                             hipblasStride             stride,
+                             int64_t                   batch_count)
+{
+    bool same = file.kind() == hipblas_input_kind<T> && file.elem_size() == sizeof(T);
+
+    for(int64_t b = 0; b < batch_count; b++)
+    {
+#pragma omp parallel for
+        for(int64_t j = 0; j < n; j++)
+        {
+            T* col = A + b * stride + j * lda;
+            for(int64_t i = 0; i < m; i++)
+            {
+                size_t k = file.index(i, j, b, m, n);
+                if(same)
+                    std::memcpy(col + i, file.data() + k * sizeof(T), sizeof(T));
+                else
+                {
+                    auto v = file.value(k);
+                    col[i] = convert_alpha_beta<T>(v.first, v.second);
+                }
+            }
+        }
+    }
+}
+
+//!
+//! @brief Copies a file to a device batch. A file that holds the batch as it is laid out on the
+//!        device is pinned and copied straight from the mapping, otherwise it is converted or
+//!        tiled into host memory first.
+//!
+template <typename T>
+hipError_t hipblas_input_file_transfer(hipblas_input_file& file,
+                                       T*                  dA,
+                                       int64_t             m,
+                                       int64_t             n,
+                                       int64_t             lda,
+                                       hipblasStride       stride,
+                                       int64_t             batch_count)
+{
+    if(file.kind() == hipblas_input_kind<T> && file.elem_size() == sizeof(T) && lda == m
+       && (batch_count == 1 || stride == m * n) && file.contiguous(m, n, batch_count))
+    {
+        file.pin();
+        return hipMemcpy(dA, file.data(), sizeof(T) * m * n * batch_count, hipMemcpyDefault);
+    }
+
+    size_t         size = batch_count == 1 ? n * lda : stride * batch_count;
+    std::vector<T> hA(size);
+    hipblas_input_file_fill(file, hA.data(), m, n, lda, stride, batch_count);
+    return hipMemcpy(dA, hA.data(), sizeof(T) * size, hipMemcpyDefault);
+}
@@ -23,7 +23,14 @@
 
 #pragma once
 
+#include "device_init.hpp"
+#include "device_matrix.hpp"
+#include "device_reference.hpp"
+#include "device_strided_batch_matrix.hpp"
 #include "hipblas_init.hpp"
+#include "hipblas_input_file.hpp"
+#include "host_matrix.hpp"
+#include "host_strided_batch_matrix.hpp"
 
 //!
 //! @brief Initialize a host matrix.
@@ -47,26 +54,31 @@ inline void hipblas_init_matrix(host_matrix<T>&         hA,
 
     if(nan_init == hipblas_client_alpha_sets_nan && hipblas_isnan(arg.alpha))
     {
-        hipblas_init_matrix(matrix_type, arg.uplo, random_nan_generator<T>, hA);
+        hipblas_init_matrix(
+            matrix_type, arg.uplo, hipblas_counter_rng<T>(hipblas_rng_data::nan), hA);
     }
     else if(nan_init == hipblas_client_beta_sets_nan && hipblas_isnan(arg.beta))
     {
-        hipblas_init_matrix(matrix_type, arg.uplo, random_nan_generator<T>, hA);
+        hipblas_init_matrix(
+            matrix_type, arg.uplo, hipblas_counter_rng<T>(hipblas_rng_data::nan), hA);
     }
     else if(arg.initialization == hipblas_initialization::hpl)
     {
         if(alternating_sign)
             hipblas_init_matrix_alternating_sign(
-                matrix_type, arg.uplo, random_hpl_generator<T>, hA);
+                matrix_type, arg.uplo, hipblas_counter_rng<T>(hipblas_rng_data::hpl), hA);
         else
-            hipblas_init_matrix(matrix_type, arg.uplo, random_hpl_generator<T>, hA);
+            hipblas_init_matrix(
+                matrix_type, arg.uplo, hipblas_counter_rng<T>(hipblas_rng_data::hpl), hA);
     }
     else if(arg.initialization == hipblas_initialization::rand_int)
     {
         if(alternating_sign)
-            hipblas_init_matrix_alternating_sign(matrix_type, arg.uplo, random_generator<T>, hA);
+            hipblas_init_matrix_alternating_sign(
+                matrix_type, arg.uplo, hipblas_counter_rng<T>(hipblas_rng_data::rand_int), hA);
         else
-            hipblas_init_matrix(matrix_type, arg.uplo, random_generator<T>, hA);
+            hipblas_init_matrix(
+                matrix_type, arg.uplo, hipblas_counter_rng<T>(hipblas_rng_data::rand_int), hA);
     }
     else if(arg.initialization == hipblas_initialization::trig_float)
     {
@@ -96,26 +108,31 @@ inline void hipblas_init_matrix(host_batch_matrix<T>&   hA,
 
     if(nan_init == hipblas_client_alpha_sets_nan && hipblas_isnan(arg.alpha))
     {
-        hipblas_init_matrix(matrix_type, arg.uplo, random_nan_generator<T>, hA);
+        hipblas_init_matrix(
+            matrix_type, arg.uplo, hipblas_counter_rng<T>(hipblas_rng_data::nan), hA);
     }
     else if(nan_init == hipblas_client_beta_sets_nan && hipblas_isnan(arg.beta))
     {
-        hipblas_init_matrix(matrix_type, arg.uplo, random_nan_generator<T>, hA);
+        hipblas_init_matrix(
+            matrix_type, arg.uplo, hipblas_counter_rng<T>(hipblas_rng_data::nan), hA);
     }
     else if(arg.initialization == hipblas_initialization::hpl)
     {
         if(alternating_sign)
             hipblas_init_matrix_alternating_sign(
-                matrix_type, arg.uplo, random_hpl_generator<T>, hA);
+                matrix_type, arg.uplo, hipblas_counter_rng<T>(hipblas_rng_data::hpl), hA);
         else
-            hipblas_init_matrix(matrix_type, arg.uplo, random_hpl_generator<T>, hA);
+            hipblas_init_matrix(
+                matrix_type, arg.uplo, hipblas_counter_rng<T>(hipblas_rng_data::hpl), hA);
     }
     else if(arg.initialization == hipblas_initialization::rand_int)
     {
         if(alternating_sign)
-            hipblas_init_matrix_alternating_sign(matrix_type, arg.uplo, random_generator<T>, hA);
+            hipblas_init_matrix_alternating_sign(
+                matrix_type, arg.uplo, hipblas_counter_rng<T>(hipblas_rng_data::rand_int), hA);
         else
-            hipblas_init_matrix(matrix_type, arg.uplo, random_generator<T>, hA);
+            hipblas_init_matrix(
+                matrix_type, arg.uplo, hipblas_counter_rng<T>(hipblas_rng_data::rand_int), hA);
     }
     else if(arg.initialization == hipblas_initialization::trig_float)
     {
@@ -145,29 +162,243 @@ inline void hipblas_init_matrix(host_strided_batch_matrix<T>& hA,
 
     if(nan_init == hipblas_client_alpha_sets_nan && hipblas_isnan(arg.alpha))
     {
-        hipblas_init_matrix(matrix_type, arg.uplo, random_nan_generator<T>, hA);
+        hipblas_init_matrix(
+            matrix_type, arg.uplo, hipblas_counter_rng<T>(hipblas_rng_data::nan), hA);
     }
     else if(nan_init == hipblas_client_beta_sets_nan && hipblas_isnan(arg.beta))
     {
-        hipblas_init_matrix(matrix_type, arg.uplo, random_nan_generator<T>, hA);
+        hipblas_init_matrix(
+            matrix_type, arg.uplo, hipblas_counter_rng<T>(hipblas_rng_data::nan), hA);
     }
     else if(arg.initialization == hipblas_initialization::hpl)
     {
         if(alternating_sign)
             hipblas_init_matrix_alternating_sign(
-                matrix_type, arg.uplo, random_hpl_generator<T>, hA);
+                matrix_type, arg.uplo, hipblas_counter_rng<T>(hipblas_rng_data::hpl), hA);
         else
-            hipblas_init_matrix(matrix_type, arg.uplo, random_hpl_generator<T>, hA);
+            hipblas_init_matrix(
+                matrix_type, arg.uplo, hipblas_counter_rng<T>(hipblas_rng_data::hpl), hA);
     }
     else if(arg.initialization == hipblas_initialization::rand_int)
     {
         if(alternating_sign)
-            hipblas_init_matrix_alternating_sign(matrix_type, arg.uplo, random_generator<T>, hA);
+            hipblas_init_matrix_alternating_sign(
+                matrix_type, arg.uplo, hipblas_counter_rng<T>(hipblas_rng_data::rand_int), hA);
         else
-            hipblas_init_matrix(matrix_type, arg.uplo, random_generator<T>, hA);
+            hipblas_init_matrix(
+                matrix_type, arg.uplo, hipblas_counter_rng<T>(hipblas_rng_data::rand_int), hA);
     }
     else if(arg.initialization == hipblas_initialization::trig_float)
     {
         hipblas_init_matrix_trig<T>(matrix_type, arg.uplo, hA, seedReset);
     }
 }
+
+//!
+//! @brief Whether the results of a run are checked against a reference computed on the device,
+//!        for arg.device_reference. Runs with NaN scalars are checked on the host, which accepts
+//!        matching NaNs.
+//!
+inline bool hipblas_device_reference_applies(const Arguments& arg)
+{
+    return arg.device_reference && (arg.unit_check || arg.norm_check) && !hipblas_isnan(arg.alpha)
+           && !hipblas_isnan(arg.beta);
+}
+
+//!
+//! @brief Whether the results of a run are checked probabilistically on the device, for
+//!        arg.probabilistic_check, with the exceptions of hipblas_device_reference_applies.
+//!
+inline bool hipblas_probabilistic_check_applies(const Arguments& arg)
+{
+    return arg.probabilistic_check && (arg.unit_check || arg.norm_check)
+           && !hipblas_isnan(arg.alpha) && !hipblas_isnan(arg.beta);
+}
+
+//!
+//! @brief The shape hipblas_init_device draws for a matrix type. The diagonally dominant
+//!        triangular matrices are left to the host.
+//!
+inline hipblas_device_init_matrix hipblas_device_init_matrix_of(hipblas_matrix_type matrix_type)
+{
+    switch(matrix_type)
+    {
+    case hipblas_symmetric_matrix:
+        return hipblas_device_init_matrix::symmetric;
+    case hipblas_hermitian_matrix:
+        return hipblas_device_init_matrix::hermitian;
+    case hipblas_triangular_matrix:
+        return hipblas_device_init_matrix::triangular;
+    default:
+        return hipblas_device_init_matrix::general;
+    }
+}
+
+//!
+//! @brief Whether a matrix can be initialized on the device: a general, symmetric, hermitian or
+//!        triangular matrix of rand_int or hpl data without NaNs. Only general and triangular
+//!        matrices are drawn with alternating signs.
+//!
+template <typename T>
+inline bool hipblas_device_init_applies(const Arguments&        arg,
+                                        hipblas_client_nan_init nan_init,
+                                        hipblas_matrix_type     matrix_type,
+                                        bool                    alternating_sign = false)
+{
+    bool shape = matrix_type == hipblas_general_matrix || matrix_type == hipblas_triangular_matrix
+                 || (!alternating_sign
+                     && (matrix_type == hipblas_symmetric_matrix
+                         || matrix_type == hipblas_hermitian_matrix));
+
+    return hipblas_device_init_supported<T> && shape
+           && !(nan_init == hipblas_client_alpha_sets_nan && hipblas_isnan(arg.alpha))
+           && !(nan_init == hipblas_client_beta_sets_nan && hipblas_isnan(arg.beta))
+           && (arg.initialization == hipblas_initialization::rand_int
+               || arg.initialization == hipblas_initialization::hpl);
+}
+
+//!
+//! @brief Initialize a device matrix, for runs whose results aren't checked against a host copy.
+//!        Where hipblas_device_init_applies the data is drawn on the device, otherwise it is
+//!        initialized on the host and copied.
+//! @param dA The device matrix.
+//! @param arg Specifies the argument class.
+//! @param nan_init Initialize matrix with Nan's depending upon the hipblas_client_nan_init enum value.
+//! @param matrix_type Initialization of the matrix based upon the rocblas_check_matrix_type enum value.
+//! @param seedReset reset the seed if true, do not reset the seed otherwise.
+//! @param alternating_sign Initialize matrix so adjacent entries have alternating sign.
+//! @return the hip error.
+//!
+template <typename T>
+inline hipError_t hipblas_init_matrix(device_matrix<T>&       dA,
+                                      const Arguments&        arg,
+                                      hipblas_client_nan_init nan_init,
+                                      hipblas_matrix_type     matrix_type,
+                                      bool                    seedReset        = false,
+                                      bool                    alternating_sign = false)
+{
+    if constexpr(hipblas_device_init_supported<T>)
+    {
+        if(seedReset)
+            hipblas_seedrand();
+
+        if(hipblas_device_init_applies<T>(arg, nan_init, matrix_type, alternating_sign))
+            return hipblas_init_device<T>(dA,
+                                          dA.m(),
+                                          dA.n(),
+                                          dA.lda(),
+                                          0,
+                                          1,
+                                          hipblas_counter_seed++,
+                                          arg.initialization == hipblas_initialization::hpl,
+                                          alternating_sign,
+                                          hipblas_device_init_matrix_of(matrix_type),
+                                          arg.uplo);
+    }
+
+    host_matrix<T> hA(dA.m(), dA.n(), dA.lda());
+    hipblas_init_matrix(hA, arg, nan_init, matrix_type, seedReset, alternating_sign);
+    return dA.transfer_from(hA);
+}
+
+//!
+//! @brief Initialize a device strided batch matrix, for runs whose results aren't checked against
+//!        a host copy, like the device matrix.
+//! @param dA The device strided batch matrix.
+//! @param arg Specifies the argument class.
+//! @param nan_init Initialize matrix with Nan's depending upon the hipblas_client_nan_init enum value.
+//! @param matrix_type Initialization of the matrix based upon the rocblas_check_matrix_type enum value.
+//! @param seedReset reset the seed if true, do not reset the seed otherwise.
+//! @param alternating_sign Initialize matrix so adjacent entries have alternating sign.
+//! @return the hip error.
+//!
+template <typename T>
+inline hipError_t hipblas_init_matrix(device_strided_batch_matrix<T>& dA,
+                                      const Arguments&                arg,
+                                      hipblas_client_nan_init         nan_init,
+                                      hipblas_matrix_type             matrix_type,
+                                      bool                            seedReset        = false,
+                                      bool                            alternating_sign = false)
+{
+    if constexpr(hipblas_device_init_supported<T>)
+    {
+        if(seedReset)
+            hipblas_seedrand();
+
+        if(hipblas_device_init_applies<T>(arg, nan_init, matrix_type, alternating_sign))
+            return hipblas_init_device<T>(dA,
+                                          dA.m(),
+                                          dA.n(),
+                                          dA.lda(),
+                                          dA.stride(),
+                                          dA.batch_count(),
+                                          hipblas_counter_seed++,
+                                          arg.initialization == hipblas_initialization::hpl,
+                                          alternating_sign,
+                                          hipblas_device_init_matrix_of(matrix_type),
+                                          arg.uplo);
+    }
+
+    host_strided_batch_matrix<T> hA(dA.m(), dA.n(), dA.lda(), dA.stride(), dA.batch_count());
+    hipblas_init_matrix(hA, arg, nan_init, matrix_type, seedReset, alternating_sign);
+    return dA.transfer_from(hA);
+}
+
+//!
+//! @brief Initialize a matrix from its file of arg.input_file.
+//!
+template <typename T>
+inline void hipblas_input_file_init(host_matrix<T>& hA, const std::string& path)
+{
+    hipblas_input_file file(path, hipblas_input_kind<T>, sizeof(T));
+    hipblas_input_file_fill<T>(file, hA, hA.m(), hA.n(), hA.lda(), 0, 1);
+}
+
+template <typename T>
+inline void hipblas_input_file_init(host_strided_batch_matrix<T>& hA, const std::string& path)
+{
+    hipblas_input_file file(path, hipblas_input_kind<T>, sizeof(T));
+    hipblas_input_file_fill<T>(
+        file, hA, hA.m(), hA.n(), hA.lda(), hA.stride(), hA.batch_count());
+}
+
+template <typename T>
+inline hipError_t hipblas_input_file_init(device_matrix<T>& dA, const std::string& path)
+{
+    hipblas_input_file file(path, hipblas_input_kind<T>, sizeof(T));
+    return hipblas_input_file_transfer<T>(file, dA, dA.m(), dA.n(), dA.lda(), 0, 1);
+}
+
+template <typename T>
+inline hipError_t hipblas_input_file_init(device_strided_batch_matrix<T>& dA,
+                                          const std::string&              path)
+{
+    hipblas_input_file file(path, hipblas_input_kind<T>, sizeof(T));
+    return hipblas_input_file_transfer<T>(
+        file, dA, dA.m(), dA.n(), dA.lda(), dA.stride(), dA.batch_count());
+}
+
+//!
+//! @brief Initialize operand 'A', 'B' or 'C' of a function from its file of arg.input_file, or
+//!        as hipblas_init_matrix does when it has none.
+//! @param A The host or device matrix.
+//! @param operand The operand, which selects the entry of arg.input_file.
+//! @return the hip error for a device matrix.
+//!
+template <typename U>
+inline auto hipblas_init_matrix(U&                      A,
+                                const Arguments&        arg,
+                                char                    operand,
+                                hipblas_client_nan_init nan_init,
+                                hipblas_matrix_type     matrix_type,
+                                bool                    seedReset        = false,
+                                bool                    alternating_sign = false)
+{
+    std::string path = hipblas_input_file_path(arg, operand);
+    if(path.empty())
+        return hipblas_init_matrix(A, arg, nan_init, matrix_type, seedReset, alternating_sign);
+
+    if(seedReset)
+        hipblas_seedrand();
+    return hipblas_input_file_init(A, path);
+}
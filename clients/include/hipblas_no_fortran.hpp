@@ -46,6 +46,14 @@
 #define hipblasGetVectorAsyncFortran hipblasGetVectorAsync
 #define hipblasSetMatrixAsyncFortran hipblasSetMatrixAsync
 #define hipblasGetMatrixAsyncFortran hipblasGetMatrixAsync
+#define hipblasSetVector_64Fortran hipblasSetVector_64
+#define hipblasGetVector_64Fortran hipblasGetVector_64
+#define hipblasSetMatrix_64Fortran hipblasSetMatrix_64
+#define hipblasGetMatrix_64Fortran hipblasGetMatrix_64
+#define hipblasSetVectorAsync_64Fortran hipblasSetVectorAsync_64
+#define hipblasGetVectorAsync_64Fortran hipblasGetVectorAsync_64
+#define hipblasSetMatrixAsync_64Fortran hipblasSetMatrixAsync_64
+#define hipblasGetMatrixAsync_64Fortran hipblasGetMatrixAsync_64
 #define hipblasSetAtomicsModeFortran hipblasSetAtomicsMode
 #define hipblasGetAtomicsModeFortran hipblasGetAtomicsMode
 
@@ -1360,9 +1368,82 @@
 #define hipblasDgeqrfBatchedFortran hipblasDgeqrfBatched
 #define hipblasCgeqrfBatchedFortran hipblasCgeqrfBatched
 #define hipblasZgeqrfBatchedFortran hipblasZgeqrfBatched
+#define hipblasSgeqrfBatchedStridedTauFortran hipblasSgeqrfBatchedStridedTau
+#define hipblasDgeqrfBatchedStridedTauFortran hipblasDgeqrfBatchedStridedTau
+#define hipblasCgeqrfBatchedStridedTauFortran hipblasCgeqrfBatchedStridedTau
+#define hipblasZgeqrfBatchedStridedTauFortran hipblasZgeqrfBatchedStridedTau
 #define hipblasSgeqrfStridedBatchedFortran hipblasSgeqrfStridedBatched
 #define hipblasDgeqrfStridedBatchedFortran hipblasDgeqrfStridedBatched
 #define hipblasCgeqrfStridedBatchedFortran hipblasCgeqrfStridedBatched
 #define hipblasZgeqrfStridedBatchedFortran hipblasZgeqrfStridedBatched
 
+#define hipblasSpotrfFortran hipblasSpotrf
+#define hipblasDpotrfFortran hipblasDpotrf
+#define hipblasCpotrfFortran hipblasCpotrf
+#define hipblasZpotrfFortran hipblasZpotrf
+#define hipblasSpotrfBatchedFortran hipblasSpotrfBatched
+#define hipblasDpotrfBatchedFortran hipblasDpotrfBatched
+#define hipblasCpotrfBatchedFortran hipblasCpotrfBatched
+#define hipblasZpotrfBatchedFortran hipblasZpotrfBatched
+#define hipblasSpotrfStridedBatchedFortran hipblasSpotrfStridedBatched
+#define hipblasDpotrfStridedBatchedFortran hipblasDpotrfStridedBatched
+#define hipblasCpotrfStridedBatchedFortran hipblasCpotrfStridedBatched
+#define hipblasZpotrfStridedBatchedFortran hipblasZpotrfStridedBatched
+#define hipblasSpotrsFortran hipblasSpotrs
+#define hipblasDpotrsFortran hipblasDpotrs
+#define hipblasCpotrsFortran hipblasCpotrs
+#define hipblasZpotrsFortran hipblasZpotrs
+#define hipblasSpotrsBatchedFortran hipblasSpotrsBatched
+#define hipblasDpotrsBatchedFortran hipblasDpotrsBatched
+#define hipblasCpotrsBatchedFortran hipblasCpotrsBatched
+#define hipblasZpotrsBatchedFortran hipblasZpotrsBatched
+#define hipblasSpotrsStridedBatchedFortran hipblasSpotrsStridedBatched
+#define hipblasDpotrsStridedBatchedFortran hipblasDpotrsStridedBatched
+#define hipblasCpotrsStridedBatchedFortran hipblasCpotrsStridedBatched
+#define hipblasZpotrsStridedBatchedFortran hipblasZpotrsStridedBatched
+#define hipblasSpotriFortran hipblasSpotri
+#define hipblasDpotriFortran hipblasDpotri
+#define hipblasCpotriFortran hipblasCpotri
+#define hipblasZpotriFortran hipblasZpotri
+#define hipblasSpotriBatchedFortran hipblasSpotriBatched
+#define hipblasDpotriBatchedFortran hipblasDpotriBatched
+#define hipblasCpotriBatchedFortran hipblasCpotriBatched
+#define hipblasZpotriBatchedFortran hipblasZpotriBatched
+#define hipblasSpotriStridedBatchedFortran hipblasSpotriStridedBatched
+#define hipblasDpotriStridedBatchedFortran hipblasDpotriStridedBatched
+#define hipblasCpotriStridedBatchedFortran hipblasCpotriStridedBatched
+#define hipblasZpotriStridedBatchedFortran hipblasZpotriStridedBatched
+#define hipblasSsyevjFortran hipblasSsyevj
+#define hipblasDsyevjFortran hipblasDsyevj
+#define hipblasCheevjFortran hipblasCheevj
+#define hipblasZheevjFortran hipblasZheevj
+#define hipblasSsyevjBatchedFortran hipblasSsyevjBatched
+#define hipblasDsyevjBatchedFortran hipblasDsyevjBatched
+#define hipblasCheevjBatchedFortran hipblasCheevjBatched
+#define hipblasZheevjBatchedFortran hipblasZheevjBatched
+#define hipblasSsyevjStridedBatchedFortran hipblasSsyevjStridedBatched
+#define hipblasDsyevjStridedBatchedFortran hipblasDsyevjStridedBatched
+#define hipblasCheevjStridedBatchedFortran hipblasCheevjStridedBatched
+#define hipblasZheevjStridedBatchedFortran hipblasZheevjStridedBatched
+#define hipblasSsyevdFortran hipblasSsyevd
+#define hipblasDsyevdFortran hipblasDsyevd
+#define hipblasCheevdFortran hipblasCheevd
+#define hipblasZheevdFortran hipblasZheevd
+#define hipblasSgesvdjBatchedFortran hipblasSgesvdjBatched
+#define hipblasDgesvdjBatchedFortran hipblasDgesvdjBatched
+#define hipblasCgesvdjBatchedFortran hipblasCgesvdjBatched
+#define hipblasZgesvdjBatchedFortran hipblasZgesvdjBatched
+#define hipblasSgesvdjStridedBatchedFortran hipblasSgesvdjStridedBatched
+#define hipblasDgesvdjStridedBatchedFortran hipblasDgesvdjStridedBatched
+#define hipblasCgesvdjStridedBatchedFortran hipblasCgesvdjStridedBatched
+#define hipblasZgesvdjStridedBatchedFortran hipblasZgesvdjStridedBatched
+#define hipblasSgesvBatchedFortran hipblasSgesvBatched
+#define hipblasDgesvBatchedFortran hipblasDgesvBatched
+#define hipblasCgesvBatchedFortran hipblasCgesvBatched
+#define hipblasZgesvBatchedFortran hipblasZgesvBatched
+#define hipblasSgesvStridedBatchedFortran hipblasSgesvStridedBatched
+#define hipblasDgesvStridedBatchedFortran hipblasDgesvStridedBatched
+#define hipblasCgesvStridedBatchedFortran hipblasCgesvStridedBatched
+#define hipblasZgesvStridedBatchedFortran hipblasZgesvStridedBatched
+
 #endif
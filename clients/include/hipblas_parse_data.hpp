@@ -24,9 +24,22 @@
 #ifndef _HIPBLAS_PARSE_DATA_H
 #define _HIPBLAS_PARSE_DATA_H
 
+#include <istream>
+#include <memory>
+#include <streambuf>
 #include <string>
 
 // Parse --data and --yaml command-line arguments
 bool hipblas_parse_data(int& argc, char** argv, const std::string& default_file = "");
 
+// Input stream over a binary data file, which is memory-mapped when it is a regular file, so the
+// Arguments records are copied straight from the page cache instead of through a file buffer
+class hipblas_data_stream : public std::istream
+{
+    std::unique_ptr<std::streambuf> buf;
+
+public:
+    explicit hipblas_data_stream(const std::string& filename);
+};
+
 #endif
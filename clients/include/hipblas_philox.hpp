@@ -0,0 +1,152 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cstdint>
+
+#if defined(__HIPCC__) || defined(__CUDACC__)
+#define HIPBLAS_PHILOX_FUNCTION __host__ __device__ inline
+#else
+#define HIPBLAS_PHILOX_FUNCTION inline
+#endif
+
+/* ============================================================================================ */
+/*! \brief  Counter-based random numbers of the Philox4x32-10 generator of Salmon et al., for
+ *          initializing the data of the clients in parallel. A value is a function of the seed and
+ *          of the index of the element only, so the data is the same on the host and the device
+ *          and for any number of threads */
+
+struct hipblas_philox
+{
+    uint32_t r[4];
+
+    HIPBLAS_PHILOX_FUNCTION hipblas_philox(uint64_t seed, uint64_t index, uint64_t batch)
+        : r{uint32_t(index), uint32_t(index >> 32), uint32_t(batch), uint32_t(batch >> 32)}
+    {
+        uint32_t k0 = uint32_t(seed);
+        uint32_t k1 = uint32_t(seed >> 32);
+        for(int round = 0; round < 10; round++)
+        {
+            uint64_t p0 = uint64_t(0xD2511F53) * r[0];
+            uint64_t p1 = uint64_t(0xCD9E8D57) * r[2];
+
+            uint32_t r0 = uint32_t(p1 >> 32) ^ r[1] ^ k0;
+            uint32_t r2 = uint32_t(p0 >> 32) ^ r[3] ^ k1;
+            r[1]        = uint32_t(p1);
+            r[3]        = uint32_t(p0);
+            r[0]        = r0;
+            r[2]        = r2;
+            k0 += 0x9E3779B9;
+            k1 += 0xBB67AE85;
+        }
+    }
+
+    // An integer in [1, n], the range of random_generator
+    HIPBLAS_PHILOX_FUNCTION int rand_int(int word, int n) const
+    {
+        return int(r[word] % uint32_t(n)) + 1;
+    }
+
+    // A float in [-0.5, 0.5), the range of random_hpl_generator
+    HIPBLAS_PHILOX_FUNCTION float hpl_float(int word) const
+    {
+        return float(r[word] >> 8) * (1.0f / 16777216.0f) - 0.5f;
+    }
+
+    // A double in [-0.5, 0.5) from the first two words
+    HIPBLAS_PHILOX_FUNCTION double hpl_double() const
+    {
+        uint64_t bits = (uint64_t(r[0]) << 21) ^ (r[1] >> 11);
+        return double(bits & ((uint64_t(1) << 53) - 1)) * (1.0 / 9007199254740992.0) - 0.5;
+    }
+};
+
+// The bfloat16 nearest to x, which is finite
+HIPBLAS_PHILOX_FUNCTION uint16_t hipblas_philox_bfloat16_bits(float x)
+{
+    union
+    {
+        float    fp;
+        uint32_t u;
+    } v = {x};
+    return uint16_t((v.u + 0x7FFF + ((v.u >> 16) & 1)) >> 16);
+}
+
+// The half nearest to x, which is finite and below 65504 in magnitude
+HIPBLAS_PHILOX_FUNCTION uint16_t hipblas_philox_half_bits(float x)
+{
+    union
+    {
+        float    fp;
+        uint32_t u;
+    } v = {x};
+
+    uint32_t sign = (v.u >> 16) & 0x8000;
+    int32_t  exp  = int32_t((v.u >> 23) & 0xFF) - 127 + 15;
+    uint32_t mant = (v.u & 0x7FFFFF) | 0x800000;
+
+    // Subnormal halves shift the mantissa further, to 0 below the smallest one
+    int32_t shift = exp > 0 ? 13 : 14 - exp;
+    if(shift > 24)
+        return uint16_t(sign);
+
+    uint32_t h    = (exp > 0 ? (uint32_t(exp) << 10) | ((mant & 0x7FFFFF) >> 13) : mant >> shift);
+    uint32_t rest = mant & ((uint32_t(1) << shift) - 1);
+    uint32_t half = uint32_t(1) << (shift - 1);
+    if(rest > half || (rest == half && (h & 1)))
+        h++;
+    return uint16_t(sign | h);
+}
+
+// The float of the bits of a bfloat16
+HIPBLAS_PHILOX_FUNCTION float hipblas_philox_bfloat16_float(uint16_t bits)
+{
+    union
+    {
+        uint32_t u;
+        float    fp;
+    } v = {uint32_t(bits) << 16};
+    return v.fp;
+}
+
+// The float of the bits of a half, which is exact
+HIPBLAS_PHILOX_FUNCTION float hipblas_philox_half_float(uint16_t bits)
+{
+    uint32_t sign = uint32_t(bits & 0x8000) << 16;
+    uint32_t exp  = (bits >> 10) & 0x1F;
+    uint32_t mant = bits & 0x3FF;
+
+    if(exp == 0)
+    {
+        float value = float(mant) * (1.0f / 16777216.0f);
+        return sign ? -value : value;
+    }
+
+    union
+    {
+        uint32_t u;
+        float    fp;
+    } v = {sign | (exp == 0x1F ? 0x7F800000 | (mant << 13) : ((exp + 112) << 23) | (mant << 13))};
+    return v.fp;
+}
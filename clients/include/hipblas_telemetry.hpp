@@ -0,0 +1,83 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// what hipblas_telemetry measured over a timing loop, with -1 for what the device or its
+// management library doesn't report
+struct hipblas_telemetry_summary
+{
+    int    samples    = 0;
+    double watts      = -1.0; // mean power over the loop
+    double sclk_mhz   = -1.0; // mean shader clock
+    double mclk_mhz   = -1.0; // mean memory clock
+    double max_temp_c = -1.0; // hottest temperature, the junction where there is one
+};
+
+/* ============================================================================================ */
+/*! \brief  samples the power, clocks and temperature of a device on a background thread, between
+ *          start and stop. The samples are read in process through ROCm SMI on AMD devices and
+ *          NVML on NVIDIA devices, which are loaded at the first start, so the clients don't
+ *          depend on them. Without the library, the summary has no samples. */
+class hipblas_telemetry
+{
+    struct sample
+    {
+        double us, watts, sclk_mhz, mclk_mhz, temp_c;
+    };
+
+    std::thread             m_thread;
+    std::mutex              m_mutex;
+    std::condition_variable m_wake;
+    bool                    m_started = false;
+    bool                    m_stop    = false;
+    std::vector<sample>     m_samples;
+
+    void sample_loop(int device);
+
+public:
+    hipblas_telemetry() = default;
+
+    ~hipblas_telemetry();
+
+    hipblas_telemetry(const hipblas_telemetry&) = delete;
+    hipblas_telemetry& operator=(const hipblas_telemetry&) = delete;
+
+    // starts sampling the device
+    void start(int device);
+
+    // stops sampling, and summarizes the samples as the last summary of this thread
+    void stop();
+
+    // the summary of the last loop sampled by this thread
+    static const hipblas_telemetry_summary& last();
+
+    // a single read of the shader clock of the device in MHz, or -1 if it isn't reported
+    static double sclk_mhz(int device);
+};
@@ -46,25 +46,31 @@ inline void hipblas_init_vector(host_strided_batch_vector<T>& hx,
         int64_t N    = hx.n();
         if(nan_init == hipblas_client_alpha_sets_nan && hipblas_isnan(arg.alpha))
         {
-            hipblas_init_vector(random_nan_generator<T>, x, N, incx);
+            hipblas_init_vector(
+                hipblas_counter_rng<T>(hipblas_rng_data::nan), x, N, incx, batch_index);
         }
         else if(nan_init == hipblas_client_beta_sets_nan && hipblas_isnan(arg.beta))
         {
-            hipblas_init_vector(random_nan_generator<T>, x, N, incx);
+            hipblas_init_vector(
+                hipblas_counter_rng<T>(hipblas_rng_data::nan), x, N, incx, batch_index);
         }
         else if(arg.initialization == hipblas_initialization::hpl)
         {
             if(alternating_sign)
-                hipblas_init_vector_alternating_sign(random_hpl_generator<T>, x, N, incx);
+                hipblas_init_vector_alternating_sign(
+                    hipblas_counter_rng<T>(hipblas_rng_data::hpl), x, N, incx, batch_index);
             else
-                hipblas_init_vector(random_hpl_generator<T>, x, N, incx);
+                hipblas_init_vector(
+                    hipblas_counter_rng<T>(hipblas_rng_data::hpl), x, N, incx, batch_index);
         }
         else if(arg.initialization == hipblas_initialization::rand_int)
         {
             if(alternating_sign)
-                hipblas_init_vector_alternating_sign(random_generator<T>, x, N, incx);
+                hipblas_init_vector_alternating_sign(
+                    hipblas_counter_rng<T>(hipblas_rng_data::rand_int), x, N, incx, batch_index);
             else
-                hipblas_init_vector(random_generator<T>, x, N, incx);
+                hipblas_init_vector(
+                    hipblas_counter_rng<T>(hipblas_rng_data::rand_int), x, N, incx, batch_index);
         }
         else if(arg.initialization == hipblas_initialization::trig_float)
         {
@@ -95,25 +101,31 @@ inline void hipblas_init_vector(host_batch_vector<T>&   hx,
         int64_t N    = hx.n();
         if(nan_init == hipblas_client_alpha_sets_nan && hipblas_isnan(arg.alpha))
         {
-            hipblas_init_vector(random_nan_generator<T>, x, N, incx);
+            hipblas_init_vector(
+                hipblas_counter_rng<T>(hipblas_rng_data::nan), x, N, incx, batch_index);
         }
         else if(nan_init == hipblas_client_beta_sets_nan && hipblas_isnan(arg.beta))
         {
-            hipblas_init_vector(random_nan_generator<T>, x, N, incx);
+            hipblas_init_vector(
+                hipblas_counter_rng<T>(hipblas_rng_data::nan), x, N, incx, batch_index);
         }
         else if(arg.initialization == hipblas_initialization::hpl)
         {
             if(alternating_sign)
-                hipblas_init_vector_alternating_sign(random_hpl_generator<T>, x, N, incx);
+                hipblas_init_vector_alternating_sign(
+                    hipblas_counter_rng<T>(hipblas_rng_data::hpl), x, N, incx, batch_index);
             else
-                hipblas_init_vector(random_hpl_generator<T>, x, N, incx);
+                hipblas_init_vector(
+                    hipblas_counter_rng<T>(hipblas_rng_data::hpl), x, N, incx, batch_index);
         }
         else if(arg.initialization == hipblas_initialization::rand_int)
         {
             if(alternating_sign)
-                hipblas_init_vector_alternating_sign(random_generator<T>, x, N, incx);
+                hipblas_init_vector_alternating_sign(
+                    hipblas_counter_rng<T>(hipblas_rng_data::rand_int), x, N, incx, batch_index);
             else
-                hipblas_init_vector(random_generator<T>, x, N, incx);
+                hipblas_init_vector(
+                    hipblas_counter_rng<T>(hipblas_rng_data::rand_int), x, N, incx, batch_index);
         }
         else if(arg.initialization == hipblas_initialization::trig_float)
         {
@@ -145,25 +157,28 @@ inline void hipblas_init_vector(host_vector<T>&         hx,
 
     if(nan_init == hipblas_client_alpha_sets_nan && hipblas_isnan(arg.alpha))
     {
-        hipblas_init_vector(random_nan_generator<T>, (T*)hx, N, incx);
+        hipblas_init_vector(hipblas_counter_rng<T>(hipblas_rng_data::nan), (T*)hx, N, incx);
     }
     else if(nan_init == hipblas_client_beta_sets_nan && hipblas_isnan(arg.beta))
     {
-        hipblas_init_vector(random_nan_generator<T>, (T*)hx, N, incx);
+        hipblas_init_vector(hipblas_counter_rng<T>(hipblas_rng_data::nan), (T*)hx, N, incx);
     }
     else if(arg.initialization == hipblas_initialization::hpl)
     {
         if(alternating_sign)
-            hipblas_init_vector_alternating_sign(random_hpl_generator<T>, (T*)hx, N, incx);
+            hipblas_init_vector_alternating_sign(
+                hipblas_counter_rng<T>(hipblas_rng_data::hpl), (T*)hx, N, incx);
         else
-            hipblas_init_vector(random_hpl_generator<T>, (T*)hx, N, incx);
+            hipblas_init_vector(hipblas_counter_rng<T>(hipblas_rng_data::hpl), (T*)hx, N, incx);
     }
     else if(arg.initialization == hipblas_initialization::rand_int)
     {
         if(alternating_sign)
-            hipblas_init_vector_alternating_sign(random_generator<T>, (T*)hx, N, incx);
+            hipblas_init_vector_alternating_sign(
+                hipblas_counter_rng<T>(hipblas_rng_data::rand_int), (T*)hx, N, incx);
         else
-            hipblas_init_vector(random_generator<T>, (T*)hx, N, incx);
+            hipblas_init_vector(
+                hipblas_counter_rng<T>(hipblas_rng_data::rand_int), (T*)hx, N, incx);
     }
     else if(arg.initialization == hipblas_initialization::trig_float)
     {
@@ -260,7 +260,7 @@ private:
             {
                 if(batch_index == 0 && nullptr != this->m_data[batch_index])
                 {
-                    free(this->m_data[batch_index]);
+                    host_free(this->m_data[batch_index]);
                     this->m_data[batch_index] = nullptr;
                 }
                 else
@@ -269,7 +269,7 @@ private:
                 }
             }
 
-            free(this->m_data);
+            host_free(this->m_data);
             this->m_data = nullptr;
         }
     }
@@ -0,0 +1,66 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cstdlib>
+#include <future>
+#include <utility>
+
+// Runs the host reference of a test case on a worker thread, so that it computes while the GPU
+// runs the hipBLAS calls of the case, which are made after it is started. The reference must only
+// read the host operands and write its own result, which the case compares after wait(). The
+// destructor waits too, so that an early return of the case doesn't free what the reference uses.
+// HIPBLAS_CLIENT_SERIAL_REFERENCE runs the reference in the constructor instead, for debugging.
+class hipblas_host_reference
+{
+public:
+    template <typename F>
+    explicit hipblas_host_reference(F&& reference)
+    {
+        static const bool serial = getenv("HIPBLAS_CLIENT_SERIAL_REFERENCE") != nullptr;
+        if(serial)
+            reference();
+        else
+            m_done = std::async(std::launch::async, std::forward<F>(reference));
+    }
+
+    hipblas_host_reference(const hipblas_host_reference&)            = delete;
+    hipblas_host_reference& operator=(const hipblas_host_reference&) = delete;
+
+    ~hipblas_host_reference()
+    {
+        if(m_done.valid())
+            m_done.wait();
+    }
+
+    // returns when the reference is done, and rethrows what it threw
+    void wait()
+    {
+        if(m_done.valid())
+            m_done.get();
+    }
+
+private:
+    std::future<void> m_done;
+};
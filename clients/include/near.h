@@ -25,6 +25,9 @@
 #ifndef _NEAR_H
 #define _NEAR_H
 
+#include "device_matrix.hpp"
+#include "device_reference.hpp"
+#include "device_strided_batch_matrix.hpp"
 #include "hipblas.h"
 #include "host_vector.hpp"
 
@@ -79,6 +82,70 @@ void near_check_general(int64_t        M,
                         host_vector<T> hGPU[],
                         double         abs_error);
 
+/*! \brief Template: gtest near compare of two matrices on the device, compared on the device so
+ *         that only the largest error and the first mismatches are copied back. dCPU is of the
+ *         type of dGPU or of its wide type, the type of the references of device_reference.hpp */
+template <typename T, typename Tref>
+void near_check_device(int64_t       M,
+                       int64_t       N,
+                       int64_t       batch_count,
+                       const Tref*   dCPU,
+                       int64_t       ld_cpu,
+                       hipblasStride stride_cpu,
+                       const T*      dGPU,
+                       int64_t       ld_gpu,
+                       hipblasStride stride_gpu,
+                       double        abs_error)
+{
+#ifdef GOOGLE_TEST
+    hipblas_device_check_result result;
+    ASSERT_EQ(hipblas_device_near_check(M,
+                                        N,
+                                        dCPU,
+                                        ld_cpu,
+                                        stride_cpu,
+                                        dGPU,
+                                        ld_gpu,
+                                        stride_gpu,
+                                        batch_count,
+                                        abs_error,
+                                        false,
+                                        &result),
+              hipSuccess);
+    ASSERT_EQ(result.mismatches, 0) << hipblas_device_check_message(result);
+#endif
+}
+
+template <typename T, typename Tref>
+void near_check_device(int64_t                    M,
+                       int64_t                    N,
+                       const device_matrix<Tref>& dCPU,
+                       const device_matrix<T>&    dGPU,
+                       double                     abs_error)
+{
+    near_check_device(
+        M, N, 1, (const Tref*)dCPU, dCPU.lda(), 0, (const T*)dGPU, dGPU.lda(), 0, abs_error);
+}
+
+template <typename T, typename Tref>
+void near_check_device(int64_t                                  M,
+                       int64_t                                  N,
+                       const device_strided_batch_matrix<Tref>& dCPU,
+                       const device_strided_batch_matrix<T>&    dGPU,
+                       double                                   abs_error)
+{
+    near_check_device(M,
+                      N,
+                      dGPU.batch_count(),
+                      dCPU.data(),
+                      dCPU.lda(),
+                      dCPU.stride(),
+                      dGPU.data(),
+                      dGPU.lda(),
+                      dGPU.stride(),
+                      abs_error);
+}
+
 // currently only used for half-precision comparisons in dot_ex tests
 template <class T>
 HIPBLAS_CLANG_STATIC constexpr double error_tolerance = 0.0;
@@ -25,6 +25,9 @@
 #ifndef _NORM_H
 #define _NORM_H
 
+#include "device_matrix.hpp"
+#include "device_reference.hpp"
+#include "device_strided_batch_matrix.hpp"
 #include "hipblas.h"
 #include "host_batch_matrix.hpp"
 #include "host_batch_vector.hpp"
@@ -209,6 +212,67 @@ double norm_check_general(char                      norm_type,
     return cumulative_error;
 }
 
+/*! \brief  Template: norm check of two matrices on the device, computed on the device so that only
+ *          the error is copied back. norm_type is 'F' or 'O', and the errors of the batches are
+ *          combined as by norm_check_general. dCPU is of the type of dGPU or of its wide type,
+ *          the type of the references of device_reference.hpp. NaN if the check fails to run */
+template <typename T, typename Tref>
+double norm_check_device(char          norm_type,
+                         int64_t       M,
+                         int64_t       N,
+                         int64_t       batch_count,
+                         const Tref*   dCPU,
+                         int64_t       ld_cpu,
+                         hipblasStride stride_cpu,
+                         const T*      dGPU,
+                         int64_t       ld_gpu,
+                         hipblasStride stride_gpu)
+{
+    double     error;
+    hipError_t status = hipblas_device_norm_error(norm_type,
+                                                  M,
+                                                  N,
+                                                  dCPU,
+                                                  ld_cpu,
+                                                  stride_cpu,
+                                                  dGPU,
+                                                  ld_gpu,
+                                                  stride_gpu,
+                                                  batch_count,
+                                                  &error);
+    return status == hipSuccess ? error : std::numeric_limits<double>::quiet_NaN();
+}
+
+template <typename T, typename Tref>
+double norm_check_device(char                       norm_type,
+                         int64_t                    M,
+                         int64_t                    N,
+                         const device_matrix<Tref>& dCPU,
+                         const device_matrix<T>&    dGPU)
+{
+    return norm_check_device(
+        norm_type, M, N, 1, (const Tref*)dCPU, dCPU.lda(), 0, (const T*)dGPU, dGPU.lda(), 0);
+}
+
+template <typename T, typename Tref>
+double norm_check_device(char                                     norm_type,
+                         int64_t                                  M,
+                         int64_t                                  N,
+                         const device_strided_batch_matrix<Tref>& dCPU,
+                         const device_strided_batch_matrix<T>&    dGPU)
+{
+    return norm_check_device(norm_type,
+                             M,
+                             N,
+                             dGPU.batch_count(),
+                             dCPU.data(),
+                             dCPU.lda(),
+                             dCPU.stride(),
+                             dGPU.data(),
+                             dGPU.lda(),
+                             dGPU.stride());
+}
+
 template <typename T>
 double vector_norm_1(int64_t M, int64_t incx, T* hx_gold, T* hx)
 {
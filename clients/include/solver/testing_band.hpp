@@ -0,0 +1,449 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasBandModel = ArgumentModel<e_a_type,
+                                       e_transA,
+                                       e_N,
+                                       e_K,
+                                       e_KL,
+                                       e_KU,
+                                       e_lda,
+                                       e_ldb,
+                                       e_stride_scale,
+                                       e_batch_count>;
+
+inline void testname_band(const Arguments& arg, std::string& name)
+{
+    hipblasBandModel{}.test_name(arg, name);
+}
+
+// The gtsv, gbtrf and gbtrs functions, with the complex types of the tests cast to those of the
+// HIPBLAS_V2 interface
+#ifdef HIPBLAS_V2
+template <typename T>
+using hipblas_band_type_t = std::conditional_t<
+    std::is_same_v<T, hipblasComplex>,
+    hipComplex,
+    std::conditional_t<std::is_same_v<T, hipblasDoubleComplex>, hipDoubleComplex, T>>;
+#else
+template <typename T>
+using hipblas_band_type_t = T;
+#endif
+
+template <typename T>
+hipblasStatus_t hipblasGtsvStridedBatchedFn(hipblasHandle_t handle,
+                                            int             n,
+                                            int             nrhs,
+                                            const T*        dl,
+                                            T*              d,
+                                            T*              du,
+                                            hipblasStride   stride_d,
+                                            T*              B,
+                                            int             ldb,
+                                            hipblasStride   stride_b,
+                                            int             batch_count)
+{
+    using Tc  = hipblas_band_type_t<T>;
+    auto dl_c = (const Tc*)dl;
+    auto d_c  = (Tc*)d;
+    auto du_c = (Tc*)du;
+    auto B_c  = (Tc*)B;
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSgtsvStridedBatched(
+            handle, n, nrhs, dl_c, d_c, du_c, stride_d, B_c, ldb, stride_b, batch_count);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDgtsvStridedBatched(
+            handle, n, nrhs, dl_c, d_c, du_c, stride_d, B_c, ldb, stride_b, batch_count);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCgtsvStridedBatched(
+            handle, n, nrhs, dl_c, d_c, du_c, stride_d, B_c, ldb, stride_b, batch_count);
+    else
+        return hipblasZgtsvStridedBatched(
+            handle, n, nrhs, dl_c, d_c, du_c, stride_d, B_c, ldb, stride_b, batch_count);
+}
+
+template <typename T>
+hipblasStatus_t hipblasGtsvInterleavedBatchFn(
+    hipblasHandle_t handle, int n, int nrhs, const T* dl, T* d, T* du, T* B, int batch_count)
+{
+    using Tc  = hipblas_band_type_t<T>;
+    auto dl_c = (const Tc*)dl;
+    auto d_c  = (Tc*)d;
+    auto du_c = (Tc*)du;
+    auto B_c  = (Tc*)B;
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSgtsvInterleavedBatch(handle, n, nrhs, dl_c, d_c, du_c, B_c, batch_count);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDgtsvInterleavedBatch(handle, n, nrhs, dl_c, d_c, du_c, B_c, batch_count);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCgtsvInterleavedBatch(handle, n, nrhs, dl_c, d_c, du_c, B_c, batch_count);
+    else
+        return hipblasZgtsvInterleavedBatch(handle, n, nrhs, dl_c, d_c, du_c, B_c, batch_count);
+}
+
+template <typename T>
+hipblasStatus_t hipblasGbtrfBatchedFn(hipblasHandle_t handle,
+                                      int             n,
+                                      int             kl,
+                                      int             ku,
+                                      T* const        AB[],
+                                      int             ldab,
+                                      int*            ipiv,
+                                      int*            info,
+                                      int             batch_count)
+{
+    using Tc  = hipblas_band_type_t<T>;
+    auto AB_c = (Tc* const*)AB;
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSgbtrfBatched(handle, n, kl, ku, AB_c, ldab, ipiv, info, batch_count);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDgbtrfBatched(handle, n, kl, ku, AB_c, ldab, ipiv, info, batch_count);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCgbtrfBatched(handle, n, kl, ku, AB_c, ldab, ipiv, info, batch_count);
+    else
+        return hipblasZgbtrfBatched(handle, n, kl, ku, AB_c, ldab, ipiv, info, batch_count);
+}
+
+template <typename T>
+hipblasStatus_t hipblasGbtrsBatchedFn(hipblasHandle_t    handle,
+                                      hipblasOperation_t trans,
+                                      int                n,
+                                      int                kl,
+                                      int                ku,
+                                      int                nrhs,
+                                      T* const           AB[],
+                                      int                ldab,
+                                      const int*         ipiv,
+                                      T* const           B[],
+                                      int                ldb,
+                                      int*               info,
+                                      int                batch_count)
+{
+    using Tc  = hipblas_band_type_t<T>;
+    auto AB_c = (Tc* const*)AB;
+    auto B_c  = (Tc* const*)B;
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSgbtrsBatched(
+            handle, trans, n, kl, ku, nrhs, AB_c, ldab, ipiv, B_c, ldb, info, batch_count);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDgbtrsBatched(
+            handle, trans, n, kl, ku, nrhs, AB_c, ldab, ipiv, B_c, ldb, info, batch_count);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCgbtrsBatched(
+            handle, trans, n, kl, ku, nrhs, AB_c, ldab, ipiv, B_c, ldb, info, batch_count);
+    else
+        return hipblasZgbtrsBatched(
+            handle, trans, n, kl, ku, nrhs, AB_c, ldab, ipiv, B_c, ldb, info, batch_count);
+}
+
+template <typename T>
+void testing_band_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+    int                N           = 10;
+    int                nrhs        = 2;
+    int                kl          = 2;
+    int                ku          = 1;
+    int                ldab        = 2 * kl + ku + 1;
+    int                batch_count = 2;
+    int                info        = 0;
+    hipblasStride      stride      = N;
+
+    device_vector<T>       dl(N * batch_count), d(N * batch_count), du(N * batch_count);
+    device_vector<T>       dB(N * nrhs * batch_count);
+    device_vector<int>     dIpiv(N * batch_count);
+    device_vector<int>     dInfo(batch_count);
+    device_batch_matrix<T> dAB(ldab, N, ldab, batch_count);
+    device_batch_matrix<T> dBb(N, nrhs, N, batch_count);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGtsvStridedBatchedFn<T>(
+                              nullptr, N, nrhs, dl, d, du, stride, dB, N, N * nrhs, batch_count),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGtsvStridedBatchedFn<T>(
+                              handle, N, nrhs, dl, d, du, stride, dB, N - 1, N * nrhs, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGtsvStridedBatchedFn<T>(
+            handle, N, nrhs, nullptr, d, du, stride, dB, N, N * nrhs, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGtsvInterleavedBatchFn<T>(handle, -1, nrhs, dl, d, du, dB, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGtsvInterleavedBatchFn<T>(handle, N, nrhs, dl, d, du, nullptr, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    // ldab >= 2 * kl + ku + 1, for the fill-in of the pivoting
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGbtrfBatchedFn<T>(
+            nullptr, N, kl, ku, dAB.ptr_on_device(), ldab, dIpiv, dInfo, batch_count),
+        HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGbtrfBatchedFn<T>(
+            handle, N, kl, ku, dAB.ptr_on_device(), kl + ku + 1, dIpiv, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGbtrfBatchedFn<T>(
+            handle, N, kl, ku, dAB.ptr_on_device(), ldab, dIpiv, nullptr, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    // info of gbtrs is on the host, the position of the invalid argument as for getrs
+    EXPECT_HIPBLAS_STATUS(hipblasGbtrsBatchedFn<T>(handle,
+                                                   HIPBLAS_OP_N,
+                                                   N,
+                                                   -1,
+                                                   ku,
+                                                   nrhs,
+                                                   dAB.ptr_on_device(),
+                                                   ldab,
+                                                   dIpiv,
+                                                   dBb.ptr_on_device(),
+                                                   N,
+                                                   &info,
+                                                   batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(info, -3);
+    EXPECT_HIPBLAS_STATUS(hipblasGbtrsBatchedFn<T>(handle,
+                                                   HIPBLAS_OP_N,
+                                                   N,
+                                                   kl,
+                                                   ku,
+                                                   nrhs,
+                                                   dAB.ptr_on_device(),
+                                                   ldab,
+                                                   dIpiv,
+                                                   dBb.ptr_on_device(),
+                                                   N - 1,
+                                                   &info,
+                                                   batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(info, -10);
+
+    // If N == 0 || batch_count == 0, the arrays can be nullptr
+    CHECK_HIPBLAS_ERROR(hipblasGtsvStridedBatchedFn<T>(
+        handle, 0, nrhs, nullptr, nullptr, nullptr, stride, nullptr, N, N * nrhs, batch_count));
+    CHECK_HIPBLAS_ERROR(hipblasGtsvInterleavedBatchFn<T>(
+        handle, N, nrhs, nullptr, nullptr, nullptr, nullptr, 0));
+    CHECK_HIPBLAS_ERROR(
+        hipblasGbtrfBatchedFn<T>(handle, N, kl, ku, nullptr, ldab, nullptr, nullptr, 0));
+    CHECK_HIPBLAS_ERROR(hipblasGbtrsBatchedFn<T>(
+        handle, HIPBLAS_OP_N, 0, kl, ku, nrhs, nullptr, ldab, nullptr, nullptr, N, &info, 1));
+}
+
+// Solves diagonally dominant tridiagonal systems with gtsv, strided and interleaved, and general
+// banded systems with gbtrf and gbtrs, and checks the residuals of the solutions
+template <typename T>
+void testing_band(const Arguments& arg)
+{
+    using U = real_t<T>;
+
+    hipblasOperation_t trans        = char2hipblas_operation(arg.transA);
+    int                N            = arg.N;
+    int                nrhs         = arg.K;
+    int                kl           = arg.KL;
+    int                ku           = arg.KU;
+    int                ldab         = arg.lda;
+    int                ldb          = arg.ldb;
+    double             stride_scale = arg.stride_scale;
+    int                batch_count  = arg.batch_count;
+
+    // Check to prevent memory allocation error
+    if(N < 1 || nrhs < 1 || kl < 0 || ku < 0 || ldab < 2 * kl + ku + 1 || ldb < N
+       || batch_count <= 0)
+        return;
+
+    hipblasStride strideD = hipblasStride(N) * stride_scale;
+    hipblasStride strideB = hipblasStride(ldb) * nrhs * stride_scale;
+    size_t        sizeI   = size_t(N) * batch_count;
+
+    host_strided_batch_vector<T> hdl(N, 1, strideD, batch_count);
+    host_strided_batch_vector<T> hd(N, 1, strideD, batch_count);
+    host_strided_batch_vector<T> hdu(N, 1, strideD, batch_count);
+    host_strided_batch_matrix<T> hB(N, nrhs, ldb, strideB, batch_count);
+    host_strided_batch_matrix<T> hX(N, nrhs, ldb, strideB, batch_count);
+    host_vector<T>               hdl_i(sizeI), hd_i(sizeI), hdu_i(sizeI);
+    host_vector<T>               hB_i(sizeI * nrhs), hX_i(sizeI * nrhs);
+    host_batch_matrix<T>         hAB(ldab, N, ldab, batch_count);
+    host_batch_matrix<T>         hBb(N, nrhs, ldb, batch_count);
+    host_batch_matrix<T>         hXb(N, nrhs, ldb, batch_count);
+    host_strided_batch_matrix<T> hR(N, nrhs, ldb, strideB, 3);
+    host_vector<int>             hInfo(batch_count);
+
+    device_strided_batch_vector<T> ddl(N, 1, strideD, batch_count);
+    device_strided_batch_vector<T> dd(N, 1, strideD, batch_count);
+    device_strided_batch_vector<T> ddu(N, 1, strideD, batch_count);
+    device_strided_batch_matrix<T> dB(N, nrhs, ldb, strideB, batch_count);
+    device_vector<T>               ddl_i(sizeI), dd_i(sizeI), ddu_i(sizeI), dB_i(sizeI * nrhs);
+    device_batch_matrix<T>         dAB(ldab, N, ldab, batch_count);
+    device_batch_matrix<T>         dBb(N, nrhs, ldb, batch_count);
+    device_vector<int>             dIpiv(sizeI);
+    device_vector<int>             dInfo(batch_count);
+
+    CHECK_DEVICE_ALLOCATION(ddl.memcheck());
+    CHECK_DEVICE_ALLOCATION(dd.memcheck());
+    CHECK_DEVICE_ALLOCATION(ddu.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(ddl_i.memcheck());
+    CHECK_DEVICE_ALLOCATION(dd_i.memcheck());
+    CHECK_DEVICE_ALLOCATION(ddu_i.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB_i.memcheck());
+    CHECK_DEVICE_ALLOCATION(dAB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dBb.memcheck());
+    CHECK_DEVICE_ALLOCATION(dIpiv.memcheck());
+    CHECK_DEVICE_ALLOCATION(dInfo.memcheck());
+
+    double             hipblas_error = 0;
+    hipblasLocalHandle handle(arg);
+
+    hipblas_init_vector(hdl, arg, hipblas_client_never_set_nan, true);
+    hipblas_init_vector(hd, arg, hipblas_client_never_set_nan);
+    hipblas_init_vector(hdu, arg, hipblas_client_never_set_nan);
+    hipblas_init_matrix(hB, arg, hipblas_client_never_set_nan, hipblas_general_matrix);
+    hipblas_init_matrix(hAB, arg, hipblas_client_never_set_nan, hipblas_general_matrix);
+
+    for(int b = 0; b < batch_count; b++)
+    {
+        // the diagonals are made dominant for the solves without pivoting
+        for(int i = 0; i < N; i++)
+        {
+            hd[b][i] += T(hipblas_abs(hdl[b][i]) + hipblas_abs(hdu[b][i]) + 1);
+
+            hdl_i[size_t(i) * batch_count + b] = hdl[b][i];
+            hd_i[size_t(i) * batch_count + b]  = hd[b][i];
+            hdu_i[size_t(i) * batch_count + b] = hdu[b][i];
+            for(int r = 0; r < nrhs; r++)
+            {
+                hB_i[(size_t(r) * N + i) * batch_count + b] = hB[b][i + size_t(r) * ldb];
+                hBb[b][i + size_t(r) * ldb]                 = hB[b][i + size_t(r) * ldb];
+            }
+        }
+
+        // nothing in the rows of the fill-in of the band storage, and the diagonal scaled to
+        // avoid singularities, as for getrf
+        for(int j = 0; j < N; j++)
+        {
+            for(int i = 0; i < kl; i++)
+                hAB[b][i + size_t(j) * ldab] = T(0);
+            hAB[b][kl + ku + size_t(j) * ldab] += T(400);
+        }
+    }
+
+    CHECK_HIP_ERROR(ddl.transfer_from(hdl));
+    CHECK_HIP_ERROR(dd.transfer_from(hd));
+    CHECK_HIP_ERROR(ddu.transfer_from(hdu));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(ddl_i.transfer_from(hdl_i));
+    CHECK_HIP_ERROR(dd_i.transfer_from(hd_i));
+    CHECK_HIP_ERROR(ddu_i.transfer_from(hdu_i));
+    CHECK_HIP_ERROR(dB_i.transfer_from(hB_i));
+    CHECK_HIP_ERROR(dAB.transfer_from(hAB));
+    CHECK_HIP_ERROR(dBb.transfer_from(hBb));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasGtsvStridedBatchedFn<T>(
+            handle, N, nrhs, ddl, dd, ddu, strideD, dB, ldb, strideB, batch_count));
+        CHECK_HIPBLAS_ERROR(hipblasGtsvInterleavedBatchFn<T>(
+            handle, N, nrhs, ddl_i, dd_i, ddu_i, dB_i, batch_count));
+        CHECK_HIPBLAS_ERROR(hipblasGbtrfBatchedFn<T>(
+            handle, N, kl, ku, dAB.ptr_on_device(), ldab, dIpiv, dInfo, batch_count));
+
+        int info = 0;
+        CHECK_HIPBLAS_ERROR(hipblasGbtrsBatchedFn<T>(handle,
+                                                     trans,
+                                                     N,
+                                                     kl,
+                                                     ku,
+                                                     nrhs,
+                                                     dAB.ptr_on_device(),
+                                                     ldab,
+                                                     dIpiv,
+                                                     dBb.ptr_on_device(),
+                                                     ldb,
+                                                     &info,
+                                                     batch_count));
+        EXPECT_EQ(info, 0);
+
+        CHECK_HIP_ERROR(hX.transfer_from(dB));
+        CHECK_HIP_ERROR(hX_i.transfer_from(dB_i));
+        CHECK_HIP_ERROR(hXb.transfer_from(dBb));
+        CHECK_HIP_ERROR(hInfo.transfer_from(dInfo));
+
+        // the residuals are op(A) * X, to compare with B, of the strided and interleaved gtsv
+        // and of gbtrs
+        for(int b = 0; b < batch_count; b++)
+        {
+            auto x_i = [&](int i, int r) { return hX_i[(size_t(r) * N + i) * batch_count + b]; };
+            auto x   = [&](int i, int r) { return hX[b][i + size_t(r) * ldb]; };
+            auto xb  = [&](int i, int r) { return hXb[b][i + size_t(r) * ldb]; };
+
+            for(int r = 0; r < nrhs; r++)
+                for(int i = 0; i < N; i++)
+                {
+                    T y   = hd[b][i] * x(i, r);
+                    T y_i = hd[b][i] * x_i(i, r);
+                    if(i > 0)
+                    {
+                        y += hdl[b][i] * x(i - 1, r);
+                        y_i += hdl[b][i] * x_i(i - 1, r);
+                    }
+                    if(i < N - 1)
+                    {
+                        y += hdu[b][i] * x(i + 1, r);
+                        y_i += hdu[b][i] * x_i(i + 1, r);
+                    }
+
+                    T yb(0);
+                    if(trans == HIPBLAS_OP_N)
+                        for(int k = std::max(0, i - kl); k <= std::min(N - 1, i + ku); k++)
+                            yb += hAB[b][kl + ku + i - k + size_t(k) * ldab] * xb(k, r);
+                    else
+                        for(int k = std::max(0, i - ku); k <= std::min(N - 1, i + kl); k++)
+                        {
+                            T a = hAB[b][kl + ku + k - i + size_t(i) * ldab];
+                            yb += (trans == HIPBLAS_OP_C ? std::conj(a) : a) * xb(k, r);
+                        }
+
+                    hR[0][i + size_t(r) * ldb] = y;
+                    hR[1][i + size_t(r) * ldb] = y_i;
+                    hR[2][i + size_t(r) * ldb] = yb;
+                }
+
+            for(int s = 0; s < 3; s++)
+                hipblas_error = std::max(
+                    hipblas_error, norm_check_general<T>('F', N, nrhs, ldb, hB[b], hR[s]));
+            EXPECT_EQ(hInfo[b], 0);
+        }
+
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = eps * N * 100;
+            unit_check_error(hipblas_error, tolerance);
+        }
+    }
+}
@@ -263,22 +263,31 @@ void testing_gels(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(
                 hipblasGelsFn(handle, trans, M, N, nrhs, dA, lda, dB, ldb, &info_input, dInfo));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasGelsModel{}.log_args<T>(std::cout,
                                        arg,
                                        gpu_time_used,
-                                       ArgumentLogging::NA_value,
-                                       ArgumentLogging::NA_value,
+                                       gels_gflop_count<T>(M, N, nrhs),
+                                       gels_gbyte_count<T>(M, N, nrhs),
                                        hipblas_error);
     }
 }
+
+// Instantiated in clients/common/solver/common_gels.cpp
+extern template void testing_gels<float>(const Arguments&);
+extern template void testing_gels<double>(const Arguments&);
+extern template void testing_gels<hipblasComplex>(const Arguments&);
+extern template void testing_gels<hipblasDoubleComplex>(const Arguments&);
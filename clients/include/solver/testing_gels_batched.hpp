@@ -323,6 +323,9 @@ void testing_gels_batched(const Arguments& arg)
         int            sizeW = std::max(1, std::min(M, N) + std::max(std::min(M, N), nrhs));
         host_vector<T> hW(sizeW);
 
+#ifdef _OPENMP
+#pragma omp parallel for firstprivate(hW)
+#endif
         for(int b = 0; b < batch_count; b++)
         {
             info[b] = ref_gels(transc, M, N, nrhs, hA[b], lda, hB[b], ldb, hW.data(), sizeW);
@@ -355,11 +358,12 @@ void testing_gels_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasGelsBatchedFn(handle,
                                                      trans,
@@ -373,14 +377,22 @@ void testing_gels_batched(const Arguments& arg)
                                                      &info_input,
                                                      dInfo,
                                                      batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasGelsBatchedModel{}.log_args<T>(std::cout,
                                               arg,
                                               gpu_time_used,
-                                              ArgumentLogging::NA_value,
-                                              ArgumentLogging::NA_value,
+                                              gels_gflop_count<T>(M, N, nrhs),
+                                              gels_gbyte_count<T>(M, N, nrhs),
                                               hipblas_error);
     }
 }
+
+// Instantiated in clients/common/solver/common_gels.cpp
+extern template void testing_gels_batched<float>(const Arguments&);
+extern template void testing_gels_batched<double>(const Arguments&);
+extern template void testing_gels_batched<hipblasComplex>(const Arguments&);
+extern template void testing_gels_batched<hipblasDoubleComplex>(const Arguments&);
@@ -218,21 +218,30 @@ void testing_geqrf(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasGeqrfFn(handle, M, N, dA, lda, dIpiv, &info));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasGeqrfModel{}.log_args<T>(std::cout,
                                         arg,
                                         gpu_time_used,
                                         geqrf_gflop_count<T>(N, M),
-                                        ArgumentLogging::NA_value,
+                                        getrf_gbyte_count<T>(M, N),
                                         hipblas_error);
     }
 }
+
+// Instantiated in clients/common/solver/common_geqrf.cpp
+extern template void testing_geqrf<float>(const Arguments&);
+extern template void testing_geqrf<double>(const Arguments&);
+extern template void testing_geqrf<hipblasComplex>(const Arguments&);
+extern template void testing_geqrf<hipblasDoubleComplex>(const Arguments&);
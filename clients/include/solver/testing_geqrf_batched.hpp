@@ -226,6 +226,9 @@ void testing_geqrf_batched(const Arguments& arg)
 
         // Perform factorization
         work = host_vector<T>(lwork);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int b = 0; b < batch_count; b++)
         {
             ref_geqrf(M, N, hA[b], lda, hIpiv[b], work.data(), N);
@@ -252,22 +255,31 @@ void testing_geqrf_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasGeqrfBatchedFn(
                 handle, M, N, dA.ptr_on_device(), lda, dIpiv.ptr_on_device(), &info, batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasGeqrfBatchedModel{}.log_args<T>(std::cout,
                                                arg,
                                                gpu_time_used,
                                                geqrf_gflop_count<T>(N, M),
-                                               ArgumentLogging::NA_value,
+                                               getrf_gbyte_count<T>(M, N),
                                                hipblas_error);
     }
 }
+
+// Instantiated in clients/common/solver/common_geqrf.cpp
+extern template void testing_geqrf_batched<float>(const Arguments&);
+extern template void testing_geqrf_batched<double>(const Arguments&);
+extern template void testing_geqrf_batched<hipblasComplex>(const Arguments&);
+extern template void testing_geqrf_batched<hipblasDoubleComplex>(const Arguments&);
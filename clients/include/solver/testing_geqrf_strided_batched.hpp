@@ -259,6 +259,9 @@ void testing_geqrf_strided_batched(const Arguments& arg)
 
         // Perform factorization
         work = host_vector<T>(lwork);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int b = 0; b < batch_count; b++)
         {
             ref_geqrf(M, N, hA[b], lda, hIpiv.data() + b * strideP, work.data(), N);
@@ -285,22 +288,31 @@ void testing_geqrf_strided_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasGeqrfStridedBatchedFn(
                 handle, M, N, dA, lda, strideA, dIpiv, strideP, &info, batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasGeqrfStridedBatchedModel{}.log_args<T>(std::cout,
                                                       arg,
                                                       gpu_time_used,
                                                       geqrf_gflop_count<T>(N, M),
-                                                      ArgumentLogging::NA_value,
+                                                      getrf_gbyte_count<T>(M, N),
                                                       hipblas_error);
     }
 }
+
+// Instantiated in clients/common/solver/common_geqrf.cpp
+extern template void testing_geqrf_strided_batched<float>(const Arguments&);
+extern template void testing_geqrf_strided_batched<double>(const Arguments&);
+extern template void testing_geqrf_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_geqrf_strided_batched<hipblasDoubleComplex>(const Arguments&);
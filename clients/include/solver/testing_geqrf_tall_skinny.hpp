@@ -0,0 +1,291 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGeqrfTallSkinnyModel = ArgumentModel<e_a_type, e_algo, e_M, e_N, e_lda, e_ldc>;
+
+inline void testname_geqrf_tall_skinny(const Arguments& arg, std::string& name)
+{
+    hipblasGeqrfTallSkinnyModel{}.test_name(arg, name);
+}
+
+template <typename T>
+hipblasStatus_t hipblasGeqrfTallSkinnyBufferSizeFn(hipblasHandle_t           handle,
+                                                   hipblasTallSkinnyQrAlgo_t algo,
+                                                   int                       m,
+                                                   int                       n,
+                                                   int                       lda,
+                                                   int                       ldr,
+                                                   size_t*                   lwork_bytes)
+{
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSgeqrfTallSkinny_bufferSize(handle, algo, m, n, lda, ldr, lwork_bytes);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDgeqrfTallSkinny_bufferSize(handle, algo, m, n, lda, ldr, lwork_bytes);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCgeqrfTallSkinny_bufferSize(handle, algo, m, n, lda, ldr, lwork_bytes);
+    else
+        return hipblasZgeqrfTallSkinny_bufferSize(handle, algo, m, n, lda, ldr, lwork_bytes);
+}
+
+// hipblas?geqrfTallSkinny, with the complex types of the tests cast to those of the HIPBLAS_V2
+// interface
+template <typename T>
+hipblasStatus_t hipblasGeqrfTallSkinnyFn(hipblasHandle_t           handle,
+                                         hipblasTallSkinnyQrAlgo_t algo,
+                                         int                       m,
+                                         int                       n,
+                                         T*                        A,
+                                         int                       lda,
+                                         T*                        R,
+                                         int                       ldr,
+                                         void*                     workspace,
+                                         size_t                    lwork_bytes,
+                                         int*                      info)
+{
+#ifdef HIPBLAS_V2
+    using Tc = std::conditional_t<
+        std::is_same_v<T, hipblasComplex>,
+        hipComplex,
+        std::conditional_t<std::is_same_v<T, hipblasDoubleComplex>, hipDoubleComplex, T>>;
+#else
+    using Tc = T;
+#endif
+    auto A_c = (Tc*)A;
+    auto R_c = (Tc*)R;
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSgeqrfTallSkinny(
+            handle, algo, m, n, A_c, lda, R_c, ldr, workspace, lwork_bytes, info);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDgeqrfTallSkinny(
+            handle, algo, m, n, A_c, lda, R_c, ldr, workspace, lwork_bytes, info);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCgeqrfTallSkinny(
+            handle, algo, m, n, A_c, lda, R_c, ldr, workspace, lwork_bytes, info);
+    else
+        return hipblasZgeqrfTallSkinny(
+            handle, algo, m, n, A_c, lda, R_c, ldr, workspace, lwork_bytes, info);
+}
+
+template <typename T>
+void testing_geqrf_tall_skinny_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle        handle(arg);
+    hipblasTallSkinnyQrAlgo_t algo = hipblasTallSkinnyQrAlgo_t(arg.algo);
+    int                       M    = 200;
+    int                       N    = 20;
+    int                       lda  = 201;
+    int                       ldr  = 21;
+
+    size_t lwork_bytes;
+    CHECK_HIPBLAS_ERROR(
+        hipblasGeqrfTallSkinnyBufferSizeFn<T>(handle, algo, M, N, lda, ldr, &lwork_bytes));
+
+    device_matrix<T>    dA(M, N, lda);
+    device_matrix<T>    dR(N, N, ldr);
+    device_vector<char> dWork(lwork_bytes);
+    device_vector<int>  dInfo(1);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrfTallSkinnyBufferSizeFn<T>(nullptr, algo, M, N, lda, ldr, &lwork_bytes),
+        HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGeqrfTallSkinnyBufferSizeFn<T>(
+                              handle, hipblasTallSkinnyQrAlgo_t(2), M, N, lda, ldr, &lwork_bytes),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrfTallSkinnyBufferSizeFn<T>(handle, algo, M, N, lda, ldr, nullptr),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrfTallSkinnyFn<T>(
+            nullptr, algo, M, N, dA, lda, dR, ldr, dWork, lwork_bytes, dInfo),
+        HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGeqrfTallSkinnyFn<T>(handle,
+                                                      hipblasTallSkinnyQrAlgo_t(2),
+                                                      M,
+                                                      N,
+                                                      dA,
+                                                      lda,
+                                                      dR,
+                                                      ldr,
+                                                      dWork,
+                                                      lwork_bytes,
+                                                      dInfo),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    // m >= n
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrfTallSkinnyFn<T>(
+            handle, algo, N - 1, N, dA, lda, dR, ldr, dWork, lwork_bytes, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrfTallSkinnyFn<T>(
+            handle, algo, M, -1, dA, lda, dR, ldr, dWork, lwork_bytes, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrfTallSkinnyFn<T>(
+            handle, algo, M, N, dA, M - 1, dR, ldr, dWork, lwork_bytes, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrfTallSkinnyFn<T>(
+            handle, algo, M, N, dA, lda, dR, N - 1, dWork, lwork_bytes, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrfTallSkinnyFn<T>(
+            handle, algo, M, N, dA, lda, dR, ldr, dWork, lwork_bytes - 1, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrfTallSkinnyFn<T>(
+            handle, algo, M, N, nullptr, lda, dR, ldr, dWork, lwork_bytes, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrfTallSkinnyFn<T>(
+            handle, algo, M, N, dA, lda, nullptr, ldr, dWork, lwork_bytes, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrfTallSkinnyFn<T>(
+            handle, algo, M, N, dA, lda, dR, ldr, nullptr, lwork_bytes, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrfTallSkinnyFn<T>(
+            handle, algo, M, N, dA, lda, dR, ldr, dWork, lwork_bytes, nullptr),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If N == 0, A, R and the workspace can be nullptr
+    CHECK_HIPBLAS_ERROR(hipblasGeqrfTallSkinnyFn<T>(
+        handle, algo, M, 0, nullptr, lda, nullptr, ldr, nullptr, 0, dInfo));
+}
+
+template <typename T>
+void testing_geqrf_tall_skinny(const Arguments& arg)
+{
+    using U = real_t<T>;
+
+    hipblasTallSkinnyQrAlgo_t algo = hipblasTallSkinnyQrAlgo_t(arg.algo);
+    int                       M    = arg.M;
+    int                       N    = arg.N;
+    int                       lda  = arg.lda;
+    int                       ldr  = arg.ldc;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || M < N || lda < M || ldr < N)
+        return;
+
+    host_matrix<T>   hA(M, N, lda);
+    host_matrix<T>   hQ(M, N, lda);
+    host_matrix<T>   hR(N, N, ldr);
+    host_matrix<T>   hQR(M, N, lda);
+    host_matrix<T>   hG(N, N, N);
+    host_matrix<T>   hI(N, N, N);
+    host_vector<int> hInfo(1);
+
+    device_matrix<T>   dA(M, N, lda);
+    device_matrix<T>   dR(N, N, ldr);
+    device_vector<int> dInfo(1);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dR.memcheck());
+    CHECK_DEVICE_ALLOCATION(dInfo.memcheck());
+
+    double             gpu_time_used, hipblas_error = 0;
+    hipblasLocalHandle handle(arg);
+
+    size_t lwork_bytes;
+    CHECK_HIPBLAS_ERROR(
+        hipblasGeqrfTallSkinnyBufferSizeFn<T>(handle, algo, M, N, lda, ldr, &lwork_bytes));
+    device_vector<char> dWork(lwork_bytes);
+    CHECK_DEVICE_ALLOCATION(dWork.memcheck());
+
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    for(int j = 0; j < N; j++)
+        for(int i = 0; i < N; i++)
+            hI[0][i + j * N] = T(i == j ? 1 : 0);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasGeqrfTallSkinnyFn<T>(
+            handle, algo, M, N, dA, lda, dR, ldr, dWork, lwork_bytes, dInfo));
+
+        CHECK_HIP_ERROR(hQ.transfer_from(dA));
+        CHECK_HIP_ERROR(hR.transfer_from(dR));
+        CHECK_HIP_ERROR(hipMemcpy(hInfo.data(), dInfo, sizeof(int), hipMemcpyDeviceToHost));
+        EXPECT_EQ(hInfo[0], 0);
+
+        // R is upper triangular, Q^H * Q = I and Q * R = A
+        for(int j = 0; j < N; j++)
+            for(int i = j + 1; i < N; i++)
+                EXPECT_EQ(hR[0][i + j * ldr], T(0));
+
+        ref_gemm<T>(
+            HIPBLAS_OP_C, HIPBLAS_OP_N, N, N, M, (T)1, hQ[0], lda, hQ[0], lda, (T)0, hG[0], N);
+        hipblas_error = norm_check_general<T>('F', N, N, N, hI[0], hG[0]);
+
+        ref_gemm<T>(
+            HIPBLAS_OP_N, HIPBLAS_OP_N, M, N, N, (T)1, hQ[0], lda, hR[0], ldr, (T)0, hQR[0], lda);
+        hipblas_error
+            = std::max(hipblas_error, norm_check_general<T>('F', M, N, lda, hA[0], hQR[0]));
+
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = eps * 2000;
+            unit_check_error(hipblas_error, tolerance);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        hipblas_iteration_timer timer(arg, stream);
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            // A is overwritten by Q, restore it for each run
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+            timer.start(iter);
+
+            CHECK_HIPBLAS_ERROR(hipblasGeqrfTallSkinnyFn<T>(
+                handle, algo, M, N, dA, lda, dR, ldr, dWork, lwork_bytes, dInfo));
+
+            timer.stop(iter);
+        }
+        gpu_time_used = timer.elapsed_us();
+
+        hipblasGeqrfTallSkinnyModel{}.log_args<T>(std::cout,
+                                                  arg,
+                                                  gpu_time_used,
+                                                  geqrf_gflop_count<T>(N, M),
+                                                  getrf_gbyte_count<T>(M, N),
+                                                  hipblas_error);
+    }
+}
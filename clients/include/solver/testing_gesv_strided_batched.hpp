@@ -0,0 +1,409 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gtest/gtest.h"
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasGesvStridedBatchedModel
+    = ArgumentModel<e_a_type, e_N, e_K, e_lda, e_ldb, e_stride_scale, e_batch_count>;
+
+inline void testname_gesv_strided_batched(const Arguments& arg, std::string& name)
+{
+    hipblasGesvStridedBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_gesv_strided_batched_bad_arg(const Arguments& arg)
+{
+    bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasGesvStridedBatchedFn
+        = FORTRAN ? hipblasGesvStridedBatched<T, true> : hipblasGesvStridedBatched<T, false>;
+
+    hipblasLocalHandle  handle(arg);
+    const int           N           = 100;
+    const int           nrhs        = 1;
+    const int           lda         = 101;
+    const int           ldb         = 102;
+    const int           batch_count = 2;
+    const hipblasStride strideA     = size_t(lda) * N;
+    const hipblasStride strideB     = size_t(ldb) * nrhs;
+    const hipblasStride strideP     = N;
+
+    // Allocate device memory
+    device_strided_batch_matrix<T> dA(N, N, lda, strideA, batch_count);
+    device_strided_batch_matrix<T> dB(N, nrhs, ldb, strideB, batch_count);
+    device_vector<int>             dIpiv(strideP * batch_count);
+    device_vector<int>             dInfo(batch_count);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvStridedBatchedFn(nullptr,
+                                                      N,
+                                                      nrhs,
+                                                      dA,
+                                                      lda,
+                                                      strideA,
+                                                      dIpiv,
+                                                      strideP,
+                                                      dB,
+                                                      ldb,
+                                                      strideB,
+                                                      dInfo,
+                                                      batch_count),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvStridedBatchedFn(handle,
+                                                      -1,
+                                                      nrhs,
+                                                      dA,
+                                                      lda,
+                                                      strideA,
+                                                      dIpiv,
+                                                      strideP,
+                                                      dB,
+                                                      ldb,
+                                                      strideB,
+                                                      dInfo,
+                                                      batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvStridedBatchedFn(
+            handle, N, -1, dA, lda, strideA, dIpiv, strideP, dB, ldb, strideB, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvStridedBatchedFn(handle,
+                                                      N,
+                                                      nrhs,
+                                                      dA,
+                                                      N - 1,
+                                                      strideA,
+                                                      dIpiv,
+                                                      strideP,
+                                                      dB,
+                                                      ldb,
+                                                      strideB,
+                                                      dInfo,
+                                                      batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvStridedBatchedFn(handle,
+                                                      N,
+                                                      nrhs,
+                                                      dA,
+                                                      lda,
+                                                      strideA,
+                                                      dIpiv,
+                                                      strideP,
+                                                      dB,
+                                                      N - 1,
+                                                      strideB,
+                                                      dInfo,
+                                                      batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvStridedBatchedFn(
+            handle, N, nrhs, dA, lda, strideA, dIpiv, strideP, dB, ldb, strideB, dInfo, -1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If N == 0, A, B and ipiv can be nullptr
+    CHECK_HIPBLAS_ERROR(hipblasGesvStridedBatchedFn(handle,
+                                                    0,
+                                                    nrhs,
+                                                    nullptr,
+                                                    lda,
+                                                    strideA,
+                                                    nullptr,
+                                                    strideP,
+                                                    nullptr,
+                                                    ldb,
+                                                    strideB,
+                                                    dInfo,
+                                                    batch_count));
+
+    // If nrhs == 0, B can be nullptr
+    CHECK_HIPBLAS_ERROR(hipblasGesvStridedBatchedFn(
+        handle, N, 0, dA, lda, strideA, dIpiv, strideP, nullptr, ldb, strideB, dInfo, batch_count));
+
+    // If batch_count == 0, all pointers can be nullptr
+    CHECK_HIPBLAS_ERROR(hipblasGesvStridedBatchedFn(handle,
+                                                    N,
+                                                    nrhs,
+                                                    nullptr,
+                                                    lda,
+                                                    strideA,
+                                                    nullptr,
+                                                    strideP,
+                                                    nullptr,
+                                                    ldb,
+                                                    strideB,
+                                                    nullptr,
+                                                    0));
+
+    if(arg.bad_arg_all)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasGesvStridedBatchedFn(handle,
+                                                          N,
+                                                          nrhs,
+                                                          nullptr,
+                                                          lda,
+                                                          strideA,
+                                                          dIpiv,
+                                                          strideP,
+                                                          dB,
+                                                          ldb,
+                                                          strideB,
+                                                          dInfo,
+                                                          batch_count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasGesvStridedBatchedFn(handle,
+                                                          N,
+                                                          nrhs,
+                                                          dA,
+                                                          lda,
+                                                          strideA,
+                                                          nullptr,
+                                                          strideP,
+                                                          dB,
+                                                          ldb,
+                                                          strideB,
+                                                          dInfo,
+                                                          batch_count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasGesvStridedBatchedFn(handle,
+                                                          N,
+                                                          nrhs,
+                                                          dA,
+                                                          lda,
+                                                          strideA,
+                                                          dIpiv,
+                                                          strideP,
+                                                          nullptr,
+                                                          ldb,
+                                                          strideB,
+                                                          dInfo,
+                                                          batch_count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasGesvStridedBatchedFn(handle,
+                                                          N,
+                                                          nrhs,
+                                                          dA,
+                                                          lda,
+                                                          strideA,
+                                                          dIpiv,
+                                                          strideP,
+                                                          dB,
+                                                          ldb,
+                                                          strideB,
+                                                          nullptr,
+                                                          batch_count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+    }
+}
+
+template <typename T>
+void testing_gesv_strided_batched(const Arguments& arg)
+{
+    using U      = real_t<T>;
+    bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasGesvStridedBatchedFn
+        = FORTRAN ? hipblasGesvStridedBatched<T, true> : hipblasGesvStridedBatched<T, false>;
+
+    int N           = arg.N;
+    int nrhs        = arg.K;
+    int lda         = arg.lda;
+    int ldb         = arg.ldb;
+    int batch_count = arg.batch_count;
+
+    double        stride_scale = arg.stride_scale;
+    hipblasStride strideA      = size_t(lda) * N * stride_scale;
+    hipblasStride strideB      = size_t(ldb) * nrhs * stride_scale;
+    hipblasStride strideP      = size_t(N) * stride_scale;
+    size_t        Ipiv_size    = strideP * batch_count;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || nrhs < 0 || lda < N || ldb < N || batch_count < 0)
+    {
+        return;
+    }
+    if(batch_count == 0)
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_strided_batch_matrix<T> hA(N, N, lda, strideA, batch_count);
+    host_strided_batch_matrix<T> hA1(N, N, lda, strideA, batch_count);
+    host_strided_batch_matrix<T> hB(N, nrhs, ldb, strideB, batch_count);
+    host_strided_batch_matrix<T> hB1(N, nrhs, ldb, strideB, batch_count);
+    host_vector<int>             hIpiv(Ipiv_size);
+    host_vector<int>             hIpiv1(Ipiv_size);
+    host_vector<int>             hInfo(batch_count);
+    host_vector<int>             hInfo1(batch_count);
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hA1.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hB1.memcheck());
+
+    // Allocate device memory
+    device_strided_batch_matrix<T> dA(N, N, lda, strideA, batch_count);
+    device_strided_batch_matrix<T> dB(N, nrhs, ldb, strideB, batch_count);
+    device_vector<int>             dIpiv(Ipiv_size);
+    device_vector<int>             dInfo(batch_count);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dIpiv.memcheck());
+    CHECK_DEVICE_ALLOCATION(dInfo.memcheck());
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    // Initial hA, hB on CPU
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(hB, arg, hipblas_client_never_set_nan, hipblas_general_matrix, false, true);
+
+    // scale A to avoid singularities
+    for(int b = 0; b < batch_count; b++)
+    {
+        for(int i = 0; i < N; i++)
+        {
+            for(int j = 0; j < N; j++)
+            {
+                if(i == j)
+                    hA[b][i + j * lda] += 400;
+                else
+                    hA[b][i + j * lda] -= 4;
+            }
+        }
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasGesvStridedBatchedFn(handle,
+                                                        N,
+                                                        nrhs,
+                                                        dA,
+                                                        lda,
+                                                        strideA,
+                                                        dIpiv,
+                                                        strideP,
+                                                        dB,
+                                                        ldb,
+                                                        strideB,
+                                                        dInfo,
+                                                        batch_count));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hA1.transfer_from(dA));
+        CHECK_HIP_ERROR(hB1.transfer_from(dB));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hIpiv1.data(), dIpiv, Ipiv_size * sizeof(int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hInfo1.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int b = 0; b < batch_count; b++)
+        {
+            hInfo[b] = ref_getrf<T>(N, N, hA[b], lda, hIpiv.data() + b * strideP);
+            ref_getrs('N', N, nrhs, hA[b], lda, hIpiv.data() + b * strideP, hB[b], ldb);
+        }
+
+        hipblas_error = norm_check_general<T>('F', N, nrhs, ldb, strideB, hB, hB1, batch_count)
+                        + norm_check_general<T>('F', N, N, lda, strideA, hA, hA1, batch_count);
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = N * eps * 100;
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, batch_count, 1, hInfo.data(), hInfo1.data());
+            for(int b = 0; b < batch_count; b++)
+                unit_check_general(
+                    1, N, 1, hIpiv.data() + b * strideP, hIpiv1.data() + b * strideP);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        hipblas_iteration_timer timer(arg, stream);
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            timer.start(iter);
+
+            CHECK_HIPBLAS_ERROR(hipblasGesvStridedBatchedFn(handle,
+                                                            N,
+                                                            nrhs,
+                                                            dA,
+                                                            lda,
+                                                            strideA,
+                                                            dIpiv,
+                                                            strideP,
+                                                            dB,
+                                                            ldb,
+                                                            strideB,
+                                                            dInfo,
+                                                            batch_count));
+
+            timer.stop(iter);
+        }
+        gpu_time_used = timer.elapsed_us();
+
+        hipblasGesvStridedBatchedModel{}.log_args<T>(std::cout,
+                                                     arg,
+                                                     gpu_time_used,
+                                                     gesv_gflop_count<T>(N, nrhs),
+                                                     gesv_gbyte_count<T>(N, nrhs),
+                                                     hipblas_error);
+    }
+}
+
+// Instantiated in clients/common/solver/common_gesv.cpp
+extern template void testing_gesv_strided_batched<float>(const Arguments&);
+extern template void testing_gesv_strided_batched<double>(const Arguments&);
+extern template void testing_gesv_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_gesv_strided_batched<hipblasDoubleComplex>(const Arguments&);
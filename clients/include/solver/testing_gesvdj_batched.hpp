@@ -0,0 +1,772 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gtest/gtest.h"
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasGesvdjBatchedModel = ArgumentModel<e_a_type, e_M, e_N, e_lda, e_batch_count>;
+
+inline void testname_gesvdj_batched(const Arguments& arg, std::string& name)
+{
+    hipblasGesvdjBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_gesvdj_batched_bad_arg(const Arguments& arg)
+{
+    using U      = real_t<T>;
+    bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasGesvdjBatchedFn
+        = FORTRAN ? hipblasGesvdjBatched<T, U, true> : hipblasGesvdjBatched<T, U, false>;
+
+    hipblasLocalHandle   handle(arg);
+    const int            M           = 101;
+    const int            N           = 100;
+    const int            K           = std::min(M, N);
+    const int            lda         = 102;
+    const int            ldu         = 101;
+    const int            ldv         = 100;
+    const int            max_sweeps  = 100;
+    const int            batch_count = 2;
+    const hipblasStride  strideS     = K;
+    const hipblasStride  strideU     = size_t(ldu) * K;
+    const hipblasStride  strideV     = size_t(ldv) * N;
+    const U              abstol      = 0;
+    const hipblasSvect_t left_svect  = HIPBLAS_SVECT_SINGULAR;
+    const hipblasSvect_t right_svect = HIPBLAS_SVECT_SINGULAR;
+
+    // Allocate device memory
+    device_batch_matrix<T> dA(M, N, lda, batch_count);
+    device_vector<U>       dS(strideS * batch_count);
+    device_vector<T>       dU(strideU * batch_count);
+    device_vector<T>       dV(strideV * batch_count);
+    device_vector<U>       dResidual(batch_count);
+    device_vector<int>     dSweeps(batch_count);
+    device_vector<int>     dInfo(batch_count);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvdjBatchedFn(nullptr,
+                                                 left_svect,
+                                                 right_svect,
+                                                 M,
+                                                 N,
+                                                 dA.ptr_on_device(),
+                                                 lda,
+                                                 abstol,
+                                                 dResidual,
+                                                 max_sweeps,
+                                                 dSweeps,
+                                                 dS,
+                                                 strideS,
+                                                 dU,
+                                                 ldu,
+                                                 strideU,
+                                                 dV,
+                                                 ldv,
+                                                 strideV,
+                                                 dInfo,
+                                                 batch_count),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvdjBatchedFn(handle,
+                                                 hipblasSvect_t(2),
+                                                 right_svect,
+                                                 M,
+                                                 N,
+                                                 dA.ptr_on_device(),
+                                                 lda,
+                                                 abstol,
+                                                 dResidual,
+                                                 max_sweeps,
+                                                 dSweeps,
+                                                 dS,
+                                                 strideS,
+                                                 dU,
+                                                 ldu,
+                                                 strideU,
+                                                 dV,
+                                                 ldv,
+                                                 strideV,
+                                                 dInfo,
+                                                 batch_count),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvdjBatchedFn(handle,
+                                                 left_svect,
+                                                 hipblasSvect_t(2),
+                                                 M,
+                                                 N,
+                                                 dA.ptr_on_device(),
+                                                 lda,
+                                                 abstol,
+                                                 dResidual,
+                                                 max_sweeps,
+                                                 dSweeps,
+                                                 dS,
+                                                 strideS,
+                                                 dU,
+                                                 ldu,
+                                                 strideU,
+                                                 dV,
+                                                 ldv,
+                                                 strideV,
+                                                 dInfo,
+                                                 batch_count),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvdjBatchedFn(handle,
+                                                 left_svect,
+                                                 right_svect,
+                                                 -1,
+                                                 N,
+                                                 dA.ptr_on_device(),
+                                                 lda,
+                                                 abstol,
+                                                 dResidual,
+                                                 max_sweeps,
+                                                 dSweeps,
+                                                 dS,
+                                                 strideS,
+                                                 dU,
+                                                 ldu,
+                                                 strideU,
+                                                 dV,
+                                                 ldv,
+                                                 strideV,
+                                                 dInfo,
+                                                 batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvdjBatchedFn(handle,
+                                                 left_svect,
+                                                 right_svect,
+                                                 M,
+                                                 -1,
+                                                 dA.ptr_on_device(),
+                                                 lda,
+                                                 abstol,
+                                                 dResidual,
+                                                 max_sweeps,
+                                                 dSweeps,
+                                                 dS,
+                                                 strideS,
+                                                 dU,
+                                                 ldu,
+                                                 strideU,
+                                                 dV,
+                                                 ldv,
+                                                 strideV,
+                                                 dInfo,
+                                                 batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvdjBatchedFn(handle,
+                                                 left_svect,
+                                                 right_svect,
+                                                 M,
+                                                 N,
+                                                 dA.ptr_on_device(),
+                                                 M - 1,
+                                                 abstol,
+                                                 dResidual,
+                                                 max_sweeps,
+                                                 dSweeps,
+                                                 dS,
+                                                 strideS,
+                                                 dU,
+                                                 ldu,
+                                                 strideU,
+                                                 dV,
+                                                 ldv,
+                                                 strideV,
+                                                 dInfo,
+                                                 batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvdjBatchedFn(handle,
+                                                 left_svect,
+                                                 right_svect,
+                                                 M,
+                                                 N,
+                                                 dA.ptr_on_device(),
+                                                 lda,
+                                                 abstol,
+                                                 dResidual,
+                                                 max_sweeps,
+                                                 dSweeps,
+                                                 dS,
+                                                 strideS,
+                                                 dU,
+                                                 M - 1,
+                                                 strideU,
+                                                 dV,
+                                                 ldv,
+                                                 strideV,
+                                                 dInfo,
+                                                 batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvdjBatchedFn(handle,
+                                                 left_svect,
+                                                 right_svect,
+                                                 M,
+                                                 N,
+                                                 dA.ptr_on_device(),
+                                                 lda,
+                                                 abstol,
+                                                 dResidual,
+                                                 max_sweeps,
+                                                 dSweeps,
+                                                 dS,
+                                                 strideS,
+                                                 dU,
+                                                 ldu,
+                                                 strideU,
+                                                 dV,
+                                                 K - 1,
+                                                 strideV,
+                                                 dInfo,
+                                                 batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvdjBatchedFn(handle,
+                                                 left_svect,
+                                                 right_svect,
+                                                 M,
+                                                 N,
+                                                 dA.ptr_on_device(),
+                                                 lda,
+                                                 abstol,
+                                                 dResidual,
+                                                 0,
+                                                 dSweeps,
+                                                 dS,
+                                                 strideS,
+                                                 dU,
+                                                 ldu,
+                                                 strideU,
+                                                 dV,
+                                                 ldv,
+                                                 strideV,
+                                                 dInfo,
+                                                 batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvdjBatchedFn(handle,
+                                                 left_svect,
+                                                 right_svect,
+                                                 M,
+                                                 N,
+                                                 dA.ptr_on_device(),
+                                                 lda,
+                                                 abstol,
+                                                 dResidual,
+                                                 max_sweeps,
+                                                 dSweeps,
+                                                 dS,
+                                                 strideS,
+                                                 dU,
+                                                 ldu,
+                                                 strideU,
+                                                 dV,
+                                                 ldv,
+                                                 strideV,
+                                                 dInfo,
+                                                 -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If M == 0, A, S, U and V can be nullptr
+    CHECK_HIPBLAS_ERROR(hipblasGesvdjBatchedFn(handle,
+                                               left_svect,
+                                               right_svect,
+                                               0,
+                                               N,
+                                               nullptr,
+                                               lda,
+                                               abstol,
+                                               dResidual,
+                                               max_sweeps,
+                                               dSweeps,
+                                               nullptr,
+                                               strideS,
+                                               nullptr,
+                                               ldu,
+                                               strideU,
+                                               nullptr,
+                                               ldv,
+                                               strideV,
+                                               dInfo,
+                                               batch_count));
+
+    // U and V are only referenced if their singular vectors are computed
+    CHECK_HIPBLAS_ERROR(hipblasGesvdjBatchedFn(handle,
+                                               HIPBLAS_SVECT_NONE,
+                                               HIPBLAS_SVECT_NONE,
+                                               M,
+                                               N,
+                                               dA.ptr_on_device(),
+                                               lda,
+                                               abstol,
+                                               dResidual,
+                                               max_sweeps,
+                                               dSweeps,
+                                               dS,
+                                               strideS,
+                                               nullptr,
+                                               1,
+                                               strideU,
+                                               nullptr,
+                                               1,
+                                               strideV,
+                                               dInfo,
+                                               batch_count));
+
+    if(arg.bad_arg_all)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasGesvdjBatchedFn(handle,
+                                                     left_svect,
+                                                     right_svect,
+                                                     M,
+                                                     N,
+                                                     nullptr,
+                                                     lda,
+                                                     abstol,
+                                                     dResidual,
+                                                     max_sweeps,
+                                                     dSweeps,
+                                                     dS,
+                                                     strideS,
+                                                     dU,
+                                                     ldu,
+                                                     strideU,
+                                                     dV,
+                                                     ldv,
+                                                     strideV,
+                                                     dInfo,
+                                                     batch_count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasGesvdjBatchedFn(handle,
+                                                     left_svect,
+                                                     right_svect,
+                                                     M,
+                                                     N,
+                                                     dA.ptr_on_device(),
+                                                     lda,
+                                                     abstol,
+                                                     dResidual,
+                                                     max_sweeps,
+                                                     dSweeps,
+                                                     nullptr,
+                                                     strideS,
+                                                     dU,
+                                                     ldu,
+                                                     strideU,
+                                                     dV,
+                                                     ldv,
+                                                     strideV,
+                                                     dInfo,
+                                                     batch_count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasGesvdjBatchedFn(handle,
+                                                     left_svect,
+                                                     right_svect,
+                                                     M,
+                                                     N,
+                                                     dA.ptr_on_device(),
+                                                     lda,
+                                                     abstol,
+                                                     dResidual,
+                                                     max_sweeps,
+                                                     dSweeps,
+                                                     dS,
+                                                     strideS,
+                                                     nullptr,
+                                                     ldu,
+                                                     strideU,
+                                                     dV,
+                                                     ldv,
+                                                     strideV,
+                                                     dInfo,
+                                                     batch_count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasGesvdjBatchedFn(handle,
+                                                     left_svect,
+                                                     right_svect,
+                                                     M,
+                                                     N,
+                                                     dA.ptr_on_device(),
+                                                     lda,
+                                                     abstol,
+                                                     dResidual,
+                                                     max_sweeps,
+                                                     dSweeps,
+                                                     dS,
+                                                     strideS,
+                                                     dU,
+                                                     ldu,
+                                                     strideU,
+                                                     nullptr,
+                                                     ldv,
+                                                     strideV,
+                                                     dInfo,
+                                                     batch_count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasGesvdjBatchedFn(handle,
+                                                     left_svect,
+                                                     right_svect,
+                                                     M,
+                                                     N,
+                                                     dA.ptr_on_device(),
+                                                     lda,
+                                                     abstol,
+                                                     nullptr,
+                                                     max_sweeps,
+                                                     dSweeps,
+                                                     dS,
+                                                     strideS,
+                                                     dU,
+                                                     ldu,
+                                                     strideU,
+                                                     dV,
+                                                     ldv,
+                                                     strideV,
+                                                     dInfo,
+                                                     batch_count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasGesvdjBatchedFn(handle,
+                                                     left_svect,
+                                                     right_svect,
+                                                     M,
+                                                     N,
+                                                     dA.ptr_on_device(),
+                                                     lda,
+                                                     abstol,
+                                                     dResidual,
+                                                     max_sweeps,
+                                                     nullptr,
+                                                     dS,
+                                                     strideS,
+                                                     dU,
+                                                     ldu,
+                                                     strideU,
+                                                     dV,
+                                                     ldv,
+                                                     strideV,
+                                                     dInfo,
+                                                     batch_count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasGesvdjBatchedFn(handle,
+                                                     left_svect,
+                                                     right_svect,
+                                                     M,
+                                                     N,
+                                                     dA.ptr_on_device(),
+                                                     lda,
+                                                     abstol,
+                                                     dResidual,
+                                                     max_sweeps,
+                                                     dSweeps,
+                                                     dS,
+                                                     strideS,
+                                                     dU,
+                                                     ldu,
+                                                     strideU,
+                                                     dV,
+                                                     ldv,
+                                                     strideV,
+                                                     nullptr,
+                                                     batch_count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+    }
+}
+
+template <typename T>
+void testing_gesvdj_batched(const Arguments& arg)
+{
+    using U      = real_t<T>;
+    bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasGesvdjBatchedFn
+        = FORTRAN ? hipblasGesvdjBatched<T, U, true> : hipblasGesvdjBatched<T, U, false>;
+
+    int M           = arg.M;
+    int N           = arg.N;
+    int K           = std::min(M, N);
+    int lda         = arg.lda;
+    int ldu         = std::max(1, M);
+    int ldv         = std::max(1, K);
+    int batch_count = arg.batch_count;
+    int max_sweeps  = 100;
+    U   abstol      = 0;
+
+    hipblasStride strideS = K;
+    hipblasStride strideU = size_t(ldu) * K;
+    hipblasStride strideV = size_t(ldv) * N;
+
+    // Check to prevent memory allocation error
+    if(M < 0 || N < 0 || lda < M || batch_count < 0)
+    {
+        return;
+    }
+    if(batch_count == 0)
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_batch_matrix<T>         hA(M, N, lda, batch_count);
+    host_strided_batch_matrix<T> hU1(M, K, ldu, strideU, batch_count);
+    host_strided_batch_matrix<T> hV1(K, N, ldv, strideV, batch_count);
+    host_matrix<T>               hAR(M, N, lda);
+    host_matrix<T>               hUS(M, K, ldu);
+    host_matrix<T>               hG(K, K, K);
+    host_matrix<T>               hI(K, K, K);
+    host_vector<U>               hS(strideS * batch_count);
+    host_vector<U>               hS1(strideS * batch_count);
+    host_vector<int>             hInfo(batch_count);
+    host_vector<int>             hInfo1(batch_count);
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hU1.memcheck());
+    CHECK_HIP_ERROR(hV1.memcheck());
+
+    // Allocate device memory
+    device_batch_matrix<T>         dA(M, N, lda, batch_count);
+    device_strided_batch_matrix<T> dU(M, K, ldu, strideU, batch_count);
+    device_strided_batch_matrix<T> dV(K, N, ldv, strideV, batch_count);
+    device_vector<U>               dS(strideS * batch_count);
+    device_vector<U>               dResidual(batch_count);
+    device_vector<int>             dSweeps(batch_count);
+    device_vector<int>             dInfo(batch_count);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dU.memcheck());
+    CHECK_DEVICE_ALLOCATION(dV.memcheck());
+    CHECK_DEVICE_ALLOCATION(dS.memcheck());
+    CHECK_DEVICE_ALLOCATION(dResidual.memcheck());
+    CHECK_DEVICE_ALLOCATION(dSweeps.memcheck());
+    CHECK_DEVICE_ALLOCATION(dInfo.memcheck());
+
+    double             gpu_time_used, hipblas_error = 0;
+    hipblasLocalHandle handle(arg);
+
+    // Initial hA on CPU
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+
+    for(int j = 0; j < K; j++)
+        for(int i = 0; i < K; i++)
+            hI[i + j * K] = T(i == j ? 1 : 0);
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for firstprivate(hAR)
+#endif
+        for(int b = 0; b < batch_count; b++)
+        {
+            hAR.assign(hA[b], hA[b] + size_t(lda) * N);
+            hInfo[b] = ref_gesvd<T>(
+                'N', 'N', M, N, hAR.data(), lda, hS.data() + b * strideS, nullptr, 1, nullptr, 1);
+        }
+
+        for(auto left_svect : {HIPBLAS_SVECT_NONE, HIPBLAS_SVECT_SINGULAR})
+        {
+            for(auto right_svect : {HIPBLAS_SVECT_NONE, HIPBLAS_SVECT_SINGULAR})
+            {
+                /* =====================================================================
+                    HIPBLAS
+                =================================================================== */
+                CHECK_HIP_ERROR(dA.transfer_from(hA));
+                CHECK_HIPBLAS_ERROR(hipblasGesvdjBatchedFn(handle,
+                                                           left_svect,
+                                                           right_svect,
+                                                           M,
+                                                           N,
+                                                           dA.ptr_on_device(),
+                                                           lda,
+                                                           abstol,
+                                                           dResidual,
+                                                           max_sweeps,
+                                                           dSweeps,
+                                                           dS,
+                                                           strideS,
+                                                           dU,
+                                                           ldu,
+                                                           strideU,
+                                                           dV,
+                                                           ldv,
+                                                           strideV,
+                                                           dInfo,
+                                                           batch_count));
+
+                // Copy output from device to CPU
+                CHECK_HIP_ERROR(hU1.transfer_from(dU));
+                CHECK_HIP_ERROR(hV1.transfer_from(dV));
+                CHECK_HIP_ERROR(hS1.transfer_from(dS));
+                CHECK_HIP_ERROR(hipMemcpy(
+                    hInfo1.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+                double error = norm_check_general<U>(
+                    'F', 1, K, 1, strideS, hS.data(), hS1.data(), batch_count);
+
+                for(int b = 0; K > 0 && b < batch_count; b++)
+                {
+                    // U^H * U = I and V * V^H = I for the singular vectors in U and the rows of V
+                    if(left_svect == HIPBLAS_SVECT_SINGULAR)
+                    {
+                        ref_gemm<T>(HIPBLAS_OP_C,
+                                    HIPBLAS_OP_N,
+                                    K,
+                                    K,
+                                    M,
+                                    (T)1,
+                                    hU1[b],
+                                    ldu,
+                                    hU1[b],
+                                    ldu,
+                                    (T)0,
+                                    hG,
+                                    K);
+                        error = std::max(
+                            error, norm_check_general<T>('F', K, K, K, hI.data(), hG.data()));
+                    }
+                    if(right_svect == HIPBLAS_SVECT_SINGULAR)
+                    {
+                        ref_gemm<T>(HIPBLAS_OP_N,
+                                    HIPBLAS_OP_C,
+                                    K,
+                                    K,
+                                    N,
+                                    (T)1,
+                                    hV1[b],
+                                    ldv,
+                                    hV1[b],
+                                    ldv,
+                                    (T)0,
+                                    hG,
+                                    K);
+                        error = std::max(
+                            error, norm_check_general<T>('F', K, K, K, hI.data(), hG.data()));
+                    }
+
+                    // A = U * diag(S) * V^H
+                    if(left_svect == HIPBLAS_SVECT_SINGULAR
+                       && right_svect == HIPBLAS_SVECT_SINGULAR)
+                    {
+                        U* S = hS1.data() + b * strideS;
+                        for(int j = 0; j < K; j++)
+                            for(int i = 0; i < M; i++)
+                                hUS[i + j * ldu] = hU1[b][i + j * ldu] * (T)S[j];
+                        ref_gemm<T>(HIPBLAS_OP_N,
+                                    HIPBLAS_OP_N,
+                                    M,
+                                    N,
+                                    K,
+                                    (T)1,
+                                    hUS,
+                                    ldu,
+                                    hV1[b],
+                                    ldv,
+                                    (T)0,
+                                    hAR,
+                                    lda);
+                        error = std::max(
+                            error, norm_check_general<T>('F', M, N, lda, hA[b], hAR.data()));
+                    }
+                }
+                hipblas_error = std::max(hipblas_error, error);
+
+                if(arg.unit_check)
+                {
+                    U      eps       = std::numeric_limits<U>::epsilon();
+                    double tolerance = eps * 2000;
+
+                    unit_check_error(error, tolerance);
+                    unit_check_general(1, batch_count, 1, hInfo.data(), hInfo1.data());
+                }
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        hipblas_iteration_timer timer(arg, stream);
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            timer.start(iter);
+
+            // A is overwritten, restore it for each run
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+            CHECK_HIPBLAS_ERROR(hipblasGesvdjBatchedFn(handle,
+                                                       HIPBLAS_SVECT_SINGULAR,
+                                                       HIPBLAS_SVECT_SINGULAR,
+                                                       M,
+                                                       N,
+                                                       dA.ptr_on_device(),
+                                                       lda,
+                                                       abstol,
+                                                       dResidual,
+                                                       max_sweeps,
+                                                       dSweeps,
+                                                       dS,
+                                                       strideS,
+                                                       dU,
+                                                       ldu,
+                                                       strideU,
+                                                       dV,
+                                                       ldv,
+                                                       strideV,
+                                                       dInfo,
+                                                       batch_count));
+
+            timer.stop(iter);
+        }
+        gpu_time_used = timer.elapsed_us();
+
+        hipblasGesvdjBatchedModel{}.log_args<T>(std::cout,
+                                                arg,
+                                                gpu_time_used,
+                                                gesvd_gflop_count<T>(M, N, true),
+                                                gesvd_gbyte_count<T>(M, N, true),
+                                                hipblas_error);
+    }
+}
+
+// Instantiated in clients/common/solver/common_gesvdj.cpp
+extern template void testing_gesvdj_batched<float>(const Arguments&);
+extern template void testing_gesvdj_batched<double>(const Arguments&);
+extern template void testing_gesvdj_batched<hipblasComplex>(const Arguments&);
+extern template void testing_gesvdj_batched<hipblasDoubleComplex>(const Arguments&);
@@ -168,21 +168,30 @@ void testing_getrf(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasGetrfFn(handle, N, dA, lda, dIpiv, dInfo));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasGetrfModel{}.log_args<T>(std::cout,
                                         arg,
                                         gpu_time_used,
                                         getrf_gflop_count<T>(N, M),
-                                        ArgumentLogging::NA_value,
+                                        getrf_gbyte_count<T>(M, N),
                                         hipblas_error);
     }
 }
+
+// Instantiated in clients/common/solver/common_getrf.cpp
+extern template void testing_getrf<float>(const Arguments&);
+extern template void testing_getrf<double>(const Arguments&);
+extern template void testing_getrf<hipblasComplex>(const Arguments&);
+extern template void testing_getrf<hipblasDoubleComplex>(const Arguments&);
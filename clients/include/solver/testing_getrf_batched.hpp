@@ -178,6 +178,9 @@ void testing_getrf_batched(const Arguments& arg)
         /* =====================================================================
            CPU LAPACK
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int b = 0; b < batch_count; b++)
         {
             hInfo[b] = ref_getrf(M, N, hA[b], lda, hIpiv.data() + b * strideP);
@@ -198,22 +201,31 @@ void testing_getrf_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasGetrfBatchedFn(
                 handle, N, dA.ptr_on_device(), lda, dIpiv, dInfo, batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasGetrfBatchedModel{}.log_args<T>(std::cout,
                                                arg,
                                                gpu_time_used,
                                                getrf_gflop_count<T>(N, M),
-                                               ArgumentLogging::NA_value,
+                                               getrf_gbyte_count<T>(M, N),
                                                hipblas_error);
     }
 }
+
+// Instantiated in clients/common/solver/common_getrf.cpp
+extern template void testing_getrf_batched<float>(const Arguments&);
+extern template void testing_getrf_batched<double>(const Arguments&);
+extern template void testing_getrf_batched<hipblasComplex>(const Arguments&);
+extern template void testing_getrf_batched<hipblasDoubleComplex>(const Arguments&);
@@ -0,0 +1,132 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGetrfInterleavedModel = ArgumentModel<e_a_type, e_N, e_lda, e_batch_count>;
+
+inline void testname_getrf_interleaved(const Arguments& arg, std::string& name)
+{
+    hipblasGetrfInterleavedModel{}.test_name(arg, name);
+}
+
+// hipblasGetrfStridedBatched in HIPBLAS_BATCH_LAYOUT_INTERLEAVED mode, against the same
+// factorizations in the strided layout, with the first matrix singular
+template <typename T>
+void testing_getrf_interleaved(const Arguments& arg)
+{
+    auto hipblasGetrfStridedBatchedFn = hipblasGetrfStridedBatched<T, false>;
+
+    int N           = arg.N;
+    int lda         = arg.lda;
+    int batch_count = arg.batch_count;
+
+    if(N < 1 || lda < N || batch_count < 1)
+        return;
+
+    hipblasStride strideA   = hipblasStride(lda) * N;
+    hipblasStride strideP   = N;
+    size_t        Ipiv_size = strideP * batch_count;
+
+    host_strided_batch_matrix<T>   hA(N, N, lda, strideA, batch_count);
+    host_strided_batch_matrix<T>   hA_gold(N, N, lda, strideA, batch_count);
+    host_strided_batch_matrix<T>   hA_interleaved(N, N, lda, strideA, batch_count);
+    host_vector<int>               hIpiv_gold(Ipiv_size);
+    host_vector<int>               hIpiv_interleaved(Ipiv_size);
+    host_vector<int>               hInfo_gold(batch_count);
+    host_vector<int>               hInfo_interleaved(batch_count);
+    device_strided_batch_matrix<T> dA(N, N, lda, strideA, batch_count);
+    device_vector<T>               dA_i(strideA * batch_count);
+    device_vector<int>             dIpiv(Ipiv_size);
+    device_vector<int>             dInfo(batch_count);
+
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA_i.memcheck());
+    CHECK_DEVICE_ALLOCATION(dIpiv.memcheck());
+    CHECK_DEVICE_ALLOCATION(dInfo.memcheck());
+
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+
+    // a dominant anti-diagonal, so that every step swaps rows and no two candidates for a pivot
+    // are close, and a zero column in the first matrix, its first zero pivot
+    int zero_col = std::min(1, N - 1);
+    for(int b = 0; b < batch_count; b++)
+        for(int i = 0; i < N; i++)
+            hA[b][i + (N - 1 - i) * lda] += 400;
+    for(int i = 0; i < N; i++)
+        hA[0][i + zero_col * lda] = T(0);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    hipDataType        type = hipblas_datatype2hip(arg.a_type);
+    hipblasLocalHandle handle(arg);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetrfStridedBatchedFn(
+        handle, N, dA, lda, strideA, dIpiv, strideP, dInfo, batch_count));
+    CHECK_HIP_ERROR(hA_gold.transfer_from(dA));
+    CHECK_HIP_ERROR(hIpiv_gold.transfer_from(dIpiv));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hInfo_gold.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+    // the same batches interleaved, pivot j of matrix b at b + j * batch_count
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(hipMemset(dIpiv, 0, Ipiv_size * sizeof(int)));
+    CHECK_HIP_ERROR(hipMemset(dInfo, 0, batch_count * sizeof(int)));
+    CHECK_HIPBLAS_ERROR(hipblasInterleaveBatch(
+        handle, N, N, type, dA, lda, strideA, dA_i, lda, batch_count, batch_count));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetBatchLayout(handle, HIPBLAS_BATCH_LAYOUT_INTERLEAVED));
+    CHECK_HIPBLAS_ERROR(hipblasGetrfStridedBatchedFn(
+        handle, N, dA_i, lda, batch_count, dIpiv, batch_count, dInfo, batch_count));
+    CHECK_HIPBLAS_ERROR(hipblasSetBatchLayout(handle, HIPBLAS_BATCH_LAYOUT_STRIDED));
+
+    CHECK_HIPBLAS_ERROR(hipblasDeinterleaveBatch(
+        handle, N, N, type, dA_i, lda, batch_count, dA, lda, strideA, batch_count));
+    CHECK_HIP_ERROR(hA_interleaved.transfer_from(dA));
+    CHECK_HIP_ERROR(hIpiv_interleaved.transfer_from(dIpiv));
+    CHECK_HIP_ERROR(hipMemcpy(
+        hInfo_interleaved.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+    host_vector<int> hInfo_expected(batch_count);
+    host_vector<int> hIpiv_strided(Ipiv_size);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hInfo_expected[b] = b == 0 ? zero_col + 1 : 0;
+        for(int j = 0; j < N; j++)
+            hIpiv_strided[b * strideP + j] = hIpiv_interleaved[b + j * batch_count];
+    }
+
+    unit_check_general<int>(1, batch_count, 1, hInfo_expected.data(), hInfo_gold.data());
+    unit_check_general<int>(1, batch_count, 1, hInfo_expected.data(), hInfo_interleaved.data());
+    unit_check_general<int>(
+        1, N, batch_count, 1, strideP, hIpiv_gold.data(), hIpiv_strided.data());
+
+    real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+    double    tolerance = eps * 2000;
+    double    error
+        = norm_check_general<T>('F', N, N, lda, strideA, hA_gold, hA_interleaved, batch_count);
+    unit_check_error(error, tolerance);
+}
@@ -255,11 +255,12 @@ void testing_getri_npvt_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasGetriBatchedFn(handle,
                                                       N,
@@ -270,14 +271,22 @@ void testing_getri_npvt_batched(const Arguments& arg)
                                                       lda,
                                                       dInfo,
                                                       batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasGetriNpvtBatchedModel{}.log_args<T>(std::cout,
                                                    arg,
                                                    gpu_time_used,
                                                    getri_gflop_count<T>(N),
-                                                   ArgumentLogging::NA_value,
+                                                   getri_gbyte_count<T>(N),
                                                    hipblas_error);
     }
 }
+
+// Instantiated in clients/common/solver/common_getri_npvt.cpp
+extern template void testing_getri_npvt_batched<float>(const Arguments&);
+extern template void testing_getri_npvt_batched<double>(const Arguments&);
+extern template void testing_getri_npvt_batched<hipblasComplex>(const Arguments&);
+extern template void testing_getri_npvt_batched<hipblasDoubleComplex>(const Arguments&);
@@ -246,21 +246,30 @@ void testing_getrs(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasGetrsFn(handle, op, N, 1, dA, lda, dIpiv, dB, ldb, &info));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasGetrsModel{}.log_args<T>(std::cout,
                                         arg,
                                         gpu_time_used,
                                         getrs_gflop_count<T>(N, 1),
-                                        ArgumentLogging::NA_value,
+                                        getrs_gbyte_count<T>(N, 1),
                                         hipblas_error);
     }
 }
+
+// Instantiated in clients/common/solver/common_getrs.cpp
+extern template void testing_getrs<float>(const Arguments&);
+extern template void testing_getrs<double>(const Arguments&);
+extern template void testing_getrs<hipblasComplex>(const Arguments&);
+extern template void testing_getrs<hipblasDoubleComplex>(const Arguments&);
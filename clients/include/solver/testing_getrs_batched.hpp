@@ -175,6 +175,27 @@ void testing_getrs_batched_bad_arg(const Arguments& arg)
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
+    // in device info mode the argument check result is written to device memory
+    device_vector<int> dInfo(1);
+    CHECK_DEVICE_ALLOCATION(dInfo.memcheck());
+    CHECK_HIPBLAS_ERROR(hipblasSetInfoMode(handle, HIPBLAS_INFO_MODE_DEVICE));
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetrsBatchedFn(handle, op, -1, nrhs, dAp, lda, dIpiv, dBp, ldb, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIP_ERROR(hipMemcpy(&info, dInfo, sizeof(int), hipMemcpyDeviceToHost));
+    expectedInfo = -2;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetrsBatchedFn(handle, op, N, 0, dAp, lda, dIpiv, nullptr, ldb, dInfo, batch_count),
+        HIPBLAS_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipMemcpy(&info, dInfo, sizeof(int), hipMemcpyDeviceToHost));
+    expectedInfo = 0;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetInfoMode(handle, HIPBLAS_INFO_MODE_HOST));
+
     // can't make any assumptions about ptrs when batch_count < 0, this is handled by rocSOLVER
 
     // cuBLAS beckend doesn't check for nullptrs, including info, hipBLAS/rocSOLVER does
@@ -289,6 +310,9 @@ void testing_getrs_batched(const Arguments& arg)
            CPU LAPACK
         =================================================================== */
 
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int b = 0; b < batch_count; b++)
         {
             ref_getrs('N', N, 1, hA[b], lda, hIpiv.data() + b * strideP, hB[b], ldb);
@@ -311,11 +335,12 @@ void testing_getrs_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasGetrsBatchedFn(handle,
                                                       op,
@@ -328,14 +353,22 @@ void testing_getrs_batched(const Arguments& arg)
                                                       ldb,
                                                       &info,
                                                       batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasGetrsBatchedModel{}.log_args<T>(std::cout,
                                                arg,
                                                gpu_time_used,
                                                getrs_gflop_count<T>(N, 1),
-                                               ArgumentLogging::NA_value,
+                                               getrs_gbyte_count<T>(N, 1),
                                                hipblas_error);
     }
 }
+
+// Instantiated in clients/common/solver/common_getrs.cpp
+extern template void testing_getrs_batched<float>(const Arguments&);
+extern template void testing_getrs_batched<double>(const Arguments&);
+extern template void testing_getrs_batched<hipblasComplex>(const Arguments&);
+extern template void testing_getrs_batched<hipblasDoubleComplex>(const Arguments&);
@@ -0,0 +1,162 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGetrsInterleavedModel
+    = ArgumentModel<e_a_type, e_transA, e_N, e_K, e_lda, e_ldb, e_batch_count>;
+
+inline void testname_getrs_interleaved(const Arguments& arg, std::string& name)
+{
+    hipblasGetrsInterleavedModel{}.test_name(arg, name);
+}
+
+// hipblasGetrsStridedBatched in HIPBLAS_BATCH_LAYOUT_INTERLEAVED mode, with K right-hand sides,
+// against the same solves in the strided layout with the same factorizations
+template <typename T>
+void testing_getrs_interleaved(const Arguments& arg)
+{
+    auto hipblasGetrfStridedBatchedFn = hipblasGetrfStridedBatched<T, false>;
+    auto hipblasGetrsStridedBatchedFn = hipblasGetrsStridedBatched<T, false>;
+
+    hipblasOperation_t trans       = char2hipblas_operation(arg.transA);
+    int                N           = arg.N;
+    int                nrhs        = arg.K;
+    int                lda         = arg.lda;
+    int                ldb         = arg.ldb;
+    int                batch_count = arg.batch_count;
+
+    if(N < 1 || nrhs < 1 || lda < N || ldb < N || batch_count < 1)
+        return;
+
+    hipblasStride strideA   = hipblasStride(lda) * N;
+    hipblasStride strideB   = hipblasStride(ldb) * nrhs;
+    hipblasStride strideP   = N;
+    size_t        Ipiv_size = strideP * batch_count;
+
+    host_strided_batch_matrix<T>   hA(N, N, lda, strideA, batch_count);
+    host_strided_batch_matrix<T>   hB(N, nrhs, ldb, strideB, batch_count);
+    host_strided_batch_matrix<T>   hB_gold(N, nrhs, ldb, strideB, batch_count);
+    host_strided_batch_matrix<T>   hB_interleaved(N, nrhs, ldb, strideB, batch_count);
+    host_vector<int>               hIpiv(Ipiv_size);
+    host_vector<int>               hIpiv_i(Ipiv_size);
+    device_strided_batch_matrix<T> dA(N, N, lda, strideA, batch_count);
+    device_strided_batch_matrix<T> dB(N, nrhs, ldb, strideB, batch_count);
+    device_vector<T>               dA_i(strideA * batch_count);
+    device_vector<T>               dB_i(strideB * batch_count);
+    device_vector<int>             dIpiv(Ipiv_size);
+    device_vector<int>             dIpiv_i(Ipiv_size);
+    device_vector<int>             dInfo(batch_count);
+
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA_i.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB_i.memcheck());
+    CHECK_DEVICE_ALLOCATION(dIpiv.memcheck());
+    CHECK_DEVICE_ALLOCATION(dIpiv_i.memcheck());
+    CHECK_DEVICE_ALLOCATION(dInfo.memcheck());
+
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(hB, arg, hipblas_client_never_set_nan, hipblas_general_matrix, false, true);
+
+    // scale A to avoid singularities, as in setup_getrs_strided_batched_testing
+    for(int b = 0; b < batch_count; b++)
+        for(int i = 0; i < N; i++)
+            for(int j = 0; j < N; j++)
+                hA[b][i + j * lda] += i == j ? 400 : -4;
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    hipDataType        type = hipblas_datatype2hip(arg.a_type);
+    hipblasLocalHandle handle(arg);
+
+    // both layouts solve with the factorizations of the strided layout
+    CHECK_HIPBLAS_ERROR(hipblasGetrfStridedBatchedFn(
+        handle, N, dA, lda, strideA, dIpiv, strideP, dInfo, batch_count));
+
+    int info         = -1;
+    int expectedInfo = 0;
+    CHECK_HIPBLAS_ERROR(hipblasGetrsStridedBatchedFn(handle,
+                                                     trans,
+                                                     N,
+                                                     nrhs,
+                                                     dA,
+                                                     lda,
+                                                     strideA,
+                                                     dIpiv,
+                                                     strideP,
+                                                     dB,
+                                                     ldb,
+                                                     strideB,
+                                                     &info,
+                                                     batch_count));
+    CHECK_HIP_ERROR(hB_gold.transfer_from(dB));
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    // the same batches interleaved, pivot j of matrix b at b + j * batch_count
+    CHECK_HIP_ERROR(hIpiv.transfer_from(dIpiv));
+    for(int b = 0; b < batch_count; b++)
+        for(int j = 0; j < N; j++)
+            hIpiv_i[b + j * batch_count] = hIpiv[b * strideP + j];
+    CHECK_HIP_ERROR(dIpiv_i.transfer_from(hIpiv_i));
+
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIPBLAS_ERROR(hipblasInterleaveBatch(
+        handle, N, N, type, dA, lda, strideA, dA_i, lda, batch_count, batch_count));
+    CHECK_HIPBLAS_ERROR(hipblasInterleaveBatch(
+        handle, N, nrhs, type, dB, ldb, strideB, dB_i, ldb, batch_count, batch_count));
+
+    info = -1;
+    CHECK_HIPBLAS_ERROR(hipblasSetBatchLayout(handle, HIPBLAS_BATCH_LAYOUT_INTERLEAVED));
+    CHECK_HIPBLAS_ERROR(hipblasGetrsStridedBatchedFn(handle,
+                                                     trans,
+                                                     N,
+                                                     nrhs,
+                                                     dA_i,
+                                                     lda,
+                                                     batch_count,
+                                                     dIpiv_i,
+                                                     batch_count,
+                                                     dB_i,
+                                                     ldb,
+                                                     batch_count,
+                                                     &info,
+                                                     batch_count));
+    CHECK_HIPBLAS_ERROR(hipblasSetBatchLayout(handle, HIPBLAS_BATCH_LAYOUT_STRIDED));
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    CHECK_HIPBLAS_ERROR(hipblasDeinterleaveBatch(
+        handle, N, nrhs, type, dB_i, ldb, batch_count, dB, ldb, strideB, batch_count));
+    CHECK_HIP_ERROR(hB_interleaved.transfer_from(dB));
+
+    real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+    double    tolerance = eps * 2000;
+    double    error
+        = norm_check_general<T>('F', N, nrhs, ldb, strideB, hB_gold, hB_interleaved, batch_count);
+    unit_check_error(error, tolerance);
+}
@@ -410,6 +410,9 @@ void testing_getrs_strided_batched(const Arguments& arg)
         /* =====================================================================
            CPU LAPACK
         =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int b = 0; b < batch_count; b++)
         {
             ref_getrs('N', N, 1, hA[b], lda, hIpiv.data() + b * strideP, hB[b], ldb);
@@ -433,11 +436,12 @@ void testing_getrs_strided_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
+        hipblas_iteration_timer timer(arg, stream);
+
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            timer.start(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasGetrsStridedBatchedFn(handle,
                                                              op,
@@ -453,14 +457,22 @@ void testing_getrs_strided_batched(const Arguments& arg)
                                                              strideB,
                                                              &info,
                                                              batch_count));
+
+            timer.stop(iter);
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = timer.elapsed_us();
 
         hipblasGetrsStridedBatchedModel{}.log_args<T>(std::cout,
                                                       arg,
                                                       gpu_time_used,
                                                       getrs_gflop_count<T>(N, 1),
-                                                      ArgumentLogging::NA_value,
+                                                      getrs_gbyte_count<T>(N, 1),
                                                       hipblas_error);
     }
 }
+
+// Instantiated in clients/common/solver/common_getrs.cpp
+extern template void testing_getrs_strided_batched<float>(const Arguments&);
+extern template void testing_getrs_strided_batched<double>(const Arguments&);
+extern template void testing_getrs_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_getrs_strided_batched<hipblasDoubleComplex>(const Arguments&);
@@ -0,0 +1,757 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasLarfModel = ArgumentModel<e_a_type,
+                                       e_side,
+                                       e_transA,
+                                       e_M,
+                                       e_N,
+                                       e_K,
+                                       e_lda,
+                                       e_ldb,
+                                       e_ldc,
+                                       e_stride_scale,
+                                       e_batch_count>;
+
+inline void testname_larf(const Arguments& arg, std::string& name)
+{
+    hipblasLarfModel{}.test_name(arg, name);
+}
+
+// The larfg, larft and larfb functions, with the complex types of the tests cast to those of the
+// HIPBLAS_V2 interface
+#ifdef HIPBLAS_V2
+template <typename T>
+using hipblas_larf_type_t = std::conditional_t<
+    std::is_same_v<T, hipblasComplex>,
+    hipComplex,
+    std::conditional_t<std::is_same_v<T, hipblasDoubleComplex>, hipDoubleComplex, T>>;
+#else
+template <typename T>
+using hipblas_larf_type_t = T;
+#endif
+
+template <typename T>
+hipblasStatus_t hipblasLarfgStridedBatchedFn(hipblasHandle_t handle,
+                                             int             n,
+                                             T*              alpha,
+                                             hipblasStride   stride_alpha,
+                                             T*              x,
+                                             int             incx,
+                                             hipblasStride   stride_x,
+                                             T*              tau,
+                                             hipblasStride   stride_tau,
+                                             int             batch_count)
+{
+    using Tc     = hipblas_larf_type_t<T>;
+    auto alpha_c = (Tc*)alpha;
+    auto x_c     = (Tc*)x;
+    auto tau_c   = (Tc*)tau;
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSlarfgStridedBatched(
+            handle, n, alpha_c, stride_alpha, x_c, incx, stride_x, tau_c, stride_tau, batch_count);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDlarfgStridedBatched(
+            handle, n, alpha_c, stride_alpha, x_c, incx, stride_x, tau_c, stride_tau, batch_count);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasClarfgStridedBatched(
+            handle, n, alpha_c, stride_alpha, x_c, incx, stride_x, tau_c, stride_tau, batch_count);
+    else
+        return hipblasZlarfgStridedBatched(
+            handle, n, alpha_c, stride_alpha, x_c, incx, stride_x, tau_c, stride_tau, batch_count);
+}
+
+template <typename T>
+hipblasStatus_t hipblasLarfgBatchedFn(hipblasHandle_t handle,
+                                      int             n,
+                                      T* const        alpha[],
+                                      T* const        x[],
+                                      int             incx,
+                                      T* const        tau[],
+                                      int             batch_count)
+{
+    using Tc     = hipblas_larf_type_t<T>;
+    auto alpha_c = (Tc* const*)alpha;
+    auto x_c     = (Tc* const*)x;
+    auto tau_c   = (Tc* const*)tau;
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSlarfgBatched(handle, n, alpha_c, x_c, incx, tau_c, batch_count);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDlarfgBatched(handle, n, alpha_c, x_c, incx, tau_c, batch_count);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasClarfgBatched(handle, n, alpha_c, x_c, incx, tau_c, batch_count);
+    else
+        return hipblasZlarfgBatched(handle, n, alpha_c, x_c, incx, tau_c, batch_count);
+}
+
+template <typename T>
+hipblasStatus_t hipblasLarftStridedBatchedFn(hipblasHandle_t handle,
+                                             int             n,
+                                             int             k,
+                                             const T*        V,
+                                             int             ldv,
+                                             hipblasStride   stride_v,
+                                             const T*        tau,
+                                             hipblasStride   stride_tau,
+                                             T*              Tm,
+                                             int             ldt,
+                                             hipblasStride   stride_t,
+                                             int             batch_count)
+{
+    using Tc   = hipblas_larf_type_t<T>;
+    auto V_c   = (const Tc*)V;
+    auto tau_c = (const Tc*)tau;
+    auto T_c   = (Tc*)Tm;
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSlarftStridedBatched(
+            handle, n, k, V_c, ldv, stride_v, tau_c, stride_tau, T_c, ldt, stride_t, batch_count);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDlarftStridedBatched(
+            handle, n, k, V_c, ldv, stride_v, tau_c, stride_tau, T_c, ldt, stride_t, batch_count);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasClarftStridedBatched(
+            handle, n, k, V_c, ldv, stride_v, tau_c, stride_tau, T_c, ldt, stride_t, batch_count);
+    else
+        return hipblasZlarftStridedBatched(
+            handle, n, k, V_c, ldv, stride_v, tau_c, stride_tau, T_c, ldt, stride_t, batch_count);
+}
+
+template <typename T>
+hipblasStatus_t hipblasLarftBatchedFn(hipblasHandle_t handle,
+                                      int             n,
+                                      int             k,
+                                      const T* const  V[],
+                                      int             ldv,
+                                      const T* const  tau[],
+                                      T* const        Tm[],
+                                      int             ldt,
+                                      int             batch_count)
+{
+    using Tc   = hipblas_larf_type_t<T>;
+    auto V_c   = (const Tc* const*)V;
+    auto tau_c = (const Tc* const*)tau;
+    auto T_c   = (Tc* const*)Tm;
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSlarftBatched(handle, n, k, V_c, ldv, tau_c, T_c, ldt, batch_count);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDlarftBatched(handle, n, k, V_c, ldv, tau_c, T_c, ldt, batch_count);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasClarftBatched(handle, n, k, V_c, ldv, tau_c, T_c, ldt, batch_count);
+    else
+        return hipblasZlarftBatched(handle, n, k, V_c, ldv, tau_c, T_c, ldt, batch_count);
+}
+
+template <typename T>
+hipblasStatus_t hipblasLarfbStridedBatchedFn(hipblasHandle_t    handle,
+                                             hipblasSideMode_t  side,
+                                             hipblasOperation_t trans,
+                                             int                m,
+                                             int                n,
+                                             int                k,
+                                             const T*           V,
+                                             int                ldv,
+                                             hipblasStride      stride_v,
+                                             const T*           Tm,
+                                             int                ldt,
+                                             hipblasStride      stride_t,
+                                             T*                 A,
+                                             int                lda,
+                                             hipblasStride      stride_a,
+                                             int                batch_count)
+{
+    using Tc = hipblas_larf_type_t<T>;
+    auto V_c = (const Tc*)V;
+    auto T_c = (const Tc*)Tm;
+    auto A_c = (Tc*)A;
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSlarfbStridedBatched(handle,
+                                           side,
+                                           trans,
+                                           m,
+                                           n,
+                                           k,
+                                           V_c,
+                                           ldv,
+                                           stride_v,
+                                           T_c,
+                                           ldt,
+                                           stride_t,
+                                           A_c,
+                                           lda,
+                                           stride_a,
+                                           batch_count);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDlarfbStridedBatched(handle,
+                                           side,
+                                           trans,
+                                           m,
+                                           n,
+                                           k,
+                                           V_c,
+                                           ldv,
+                                           stride_v,
+                                           T_c,
+                                           ldt,
+                                           stride_t,
+                                           A_c,
+                                           lda,
+                                           stride_a,
+                                           batch_count);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasClarfbStridedBatched(handle,
+                                           side,
+                                           trans,
+                                           m,
+                                           n,
+                                           k,
+                                           V_c,
+                                           ldv,
+                                           stride_v,
+                                           T_c,
+                                           ldt,
+                                           stride_t,
+                                           A_c,
+                                           lda,
+                                           stride_a,
+                                           batch_count);
+    else
+        return hipblasZlarfbStridedBatched(handle,
+                                           side,
+                                           trans,
+                                           m,
+                                           n,
+                                           k,
+                                           V_c,
+                                           ldv,
+                                           stride_v,
+                                           T_c,
+                                           ldt,
+                                           stride_t,
+                                           A_c,
+                                           lda,
+                                           stride_a,
+                                           batch_count);
+}
+
+template <typename T>
+hipblasStatus_t hipblasLarfbBatchedFn(hipblasHandle_t    handle,
+                                      hipblasSideMode_t  side,
+                                      hipblasOperation_t trans,
+                                      int                m,
+                                      int                n,
+                                      int                k,
+                                      const T* const     V[],
+                                      int                ldv,
+                                      const T* const     Tm[],
+                                      int                ldt,
+                                      T* const           A[],
+                                      int                lda,
+                                      int                batch_count)
+{
+    using Tc = hipblas_larf_type_t<T>;
+    auto V_c = (const Tc* const*)V;
+    auto T_c = (const Tc* const*)Tm;
+    auto A_c = (Tc* const*)A;
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSlarfbBatched(
+            handle, side, trans, m, n, k, V_c, ldv, T_c, ldt, A_c, lda, batch_count);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDlarfbBatched(
+            handle, side, trans, m, n, k, V_c, ldv, T_c, ldt, A_c, lda, batch_count);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasClarfbBatched(
+            handle, side, trans, m, n, k, V_c, ldv, T_c, ldt, A_c, lda, batch_count);
+    else
+        return hipblasZlarfbBatched(
+            handle, side, trans, m, n, k, V_c, ldv, T_c, ldt, A_c, lda, batch_count);
+}
+
+// Applies H_j = I - tau * v_j * v_j^H, or H_j^H, to A from the left or the right, with v_j the
+// column j of V below the diagonal and the implied one
+template <typename T>
+void ref_larf_apply(
+    bool left, bool conj_h, int m, int n, int j, const T* V, int ldv, T tau, T* A, int lda)
+{
+    T    t = conj_h ? std::conj(tau) : tau;
+    auto v = [&](int r) { return r == j ? T(1) : V[r + j * ldv]; };
+    if(left)
+    {
+        for(int c = 0; c < n; c++)
+        {
+            T s(0);
+            for(int r = j; r < m; r++)
+                s += std::conj(v(r)) * A[r + c * lda];
+            for(int r = j; r < m; r++)
+                A[r + c * lda] -= t * v(r) * s;
+        }
+    }
+    else
+    {
+        for(int r = 0; r < m; r++)
+        {
+            T s(0);
+            for(int c = j; c < n; c++)
+                s += A[r + c * lda] * v(c);
+            for(int c = j; c < n; c++)
+                A[r + c * lda] -= t * s * std::conj(v(c));
+        }
+    }
+}
+
+template <typename T>
+void testing_larf_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+    int                M           = 20;
+    int                N           = 10;
+    int                K           = 4;
+    int                ld          = 21;
+    int                batch_count = 2;
+    hipblasStride      stride      = ld * M;
+
+    device_strided_batch_matrix<T> dV(M, K, ld, stride, batch_count);
+    device_strided_batch_matrix<T> dT(K, K, ld, stride, batch_count);
+    device_strided_batch_matrix<T> dA(M, N, ld, stride, batch_count);
+    device_vector<T>               dTau(K * batch_count);
+
+    EXPECT_HIPBLAS_STATUS(hipblasLarfgStridedBatchedFn<T>(
+                              nullptr, M, dV, stride, dV + 1, 1, stride, dTau, K, batch_count),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasLarfgStridedBatchedFn<T>(
+                              handle, -1, dV, stride, dV + 1, 1, stride, dTau, K, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasLarfgStridedBatchedFn<T>(
+                              handle, M, dV, stride, dV + 1, 0, stride, dTau, K, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasLarfgStridedBatchedFn<T>(
+                              handle, M, dV, stride, nullptr, 1, stride, dTau, K, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasLarfgStridedBatchedFn<T>(
+                              handle, M, dV, stride, dV + 1, 1, stride, nullptr, K, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasLarftStridedBatchedFn<T>(
+            nullptr, M, K, dV, ld, stride, dTau, K, dT, ld, stride, batch_count),
+        HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    // k <= n, and at most 512
+    EXPECT_HIPBLAS_STATUS(
+        hipblasLarftStridedBatchedFn<T>(
+            handle, K - 1, K, dV, ld, stride, dTau, K, dT, ld, stride, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasLarftStridedBatchedFn<T>(
+            handle, 1000, 513, dV, 1000, stride, dTau, K, dT, 513, stride, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasLarftStridedBatchedFn<T>(
+            handle, M, K, dV, M - 1, stride, dTau, K, dT, ld, stride, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasLarftStridedBatchedFn<T>(
+            handle, M, K, dV, ld, stride, dTau, K, dT, K - 1, stride, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasLarftStridedBatchedFn<T>(
+            handle, M, K, nullptr, ld, stride, dTau, K, dT, ld, stride, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasLarfbStridedBatchedFn<T>(nullptr,
+                                                          HIPBLAS_SIDE_LEFT,
+                                                          HIPBLAS_OP_N,
+                                                          M,
+                                                          N,
+                                                          K,
+                                                          dV,
+                                                          ld,
+                                                          stride,
+                                                          dT,
+                                                          ld,
+                                                          stride,
+                                                          dA,
+                                                          ld,
+                                                          stride,
+                                                          batch_count),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasLarfbStridedBatchedFn<T>(handle,
+                                                          HIPBLAS_SIDE_BOTH,
+                                                          HIPBLAS_OP_N,
+                                                          M,
+                                                          N,
+                                                          K,
+                                                          dV,
+                                                          ld,
+                                                          stride,
+                                                          dT,
+                                                          ld,
+                                                          stride,
+                                                          dA,
+                                                          ld,
+                                                          stride,
+                                                          batch_count),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    // the transpose is only taken for the real types
+    EXPECT_HIPBLAS_STATUS(hipblasLarfbStridedBatchedFn<T>(handle,
+                                                          HIPBLAS_SIDE_LEFT,
+                                                          HIPBLAS_OP_T,
+                                                          M,
+                                                          N,
+                                                          K,
+                                                          dV,
+                                                          ld,
+                                                          stride,
+                                                          dT,
+                                                          ld,
+                                                          stride,
+                                                          dA,
+                                                          ld,
+                                                          stride,
+                                                          batch_count),
+                          is_complex<T> ? HIPBLAS_STATUS_INVALID_ENUM : HIPBLAS_STATUS_SUCCESS);
+
+    // V has n rows from the right, so k <= n and ldv >= n
+    EXPECT_HIPBLAS_STATUS(hipblasLarfbStridedBatchedFn<T>(handle,
+                                                          HIPBLAS_SIDE_RIGHT,
+                                                          HIPBLAS_OP_N,
+                                                          M,
+                                                          K - 1,
+                                                          K,
+                                                          dV,
+                                                          ld,
+                                                          stride,
+                                                          dT,
+                                                          ld,
+                                                          stride,
+                                                          dA,
+                                                          ld,
+                                                          stride,
+                                                          batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasLarfbStridedBatchedFn<T>(handle,
+                                                          HIPBLAS_SIDE_LEFT,
+                                                          HIPBLAS_OP_N,
+                                                          M,
+                                                          N,
+                                                          K,
+                                                          dV,
+                                                          M - 1,
+                                                          stride,
+                                                          dT,
+                                                          ld,
+                                                          stride,
+                                                          dA,
+                                                          ld,
+                                                          stride,
+                                                          batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasLarfbStridedBatchedFn<T>(handle,
+                                                          HIPBLAS_SIDE_LEFT,
+                                                          HIPBLAS_OP_N,
+                                                          M,
+                                                          N,
+                                                          K,
+                                                          dV,
+                                                          ld,
+                                                          stride,
+                                                          dT,
+                                                          ld,
+                                                          stride,
+                                                          nullptr,
+                                                          ld,
+                                                          stride,
+                                                          batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If M == 0 || N == 0 || K == 0 || batch_count == 0, the arrays can be nullptr
+    CHECK_HIPBLAS_ERROR(hipblasLarfgStridedBatchedFn<T>(
+        handle, M, nullptr, stride, nullptr, 1, stride, nullptr, K, 0));
+    CHECK_HIPBLAS_ERROR(hipblasLarftStridedBatchedFn<T>(
+        handle, M, 0, nullptr, ld, stride, nullptr, K, nullptr, ld, stride, batch_count));
+    CHECK_HIPBLAS_ERROR(hipblasLarfbStridedBatchedFn<T>(handle,
+                                                        HIPBLAS_SIDE_LEFT,
+                                                        HIPBLAS_OP_N,
+                                                        M,
+                                                        0,
+                                                        K,
+                                                        nullptr,
+                                                        ld,
+                                                        stride,
+                                                        nullptr,
+                                                        ld,
+                                                        stride,
+                                                        nullptr,
+                                                        ld,
+                                                        stride,
+                                                        batch_count));
+}
+
+// Generates K reflectors from the columns of random V with larfg, forms their T with larft and
+// applies them to A with larfb, for a strided batch and then for a batch of pointers
+template <typename T>
+void testing_larf(const Arguments& arg)
+{
+    using U = real_t<T>;
+
+    hipblasSideMode_t  side         = char2hipblas_side(arg.side);
+    hipblasOperation_t trans        = char2hipblas_operation(arg.transA);
+    bool               left         = side == HIPBLAS_SIDE_LEFT;
+    int                M            = arg.M;
+    int                N            = arg.N;
+    int                K            = arg.K;
+    int                lda          = arg.lda;
+    int                ldv          = arg.ldb;
+    int                ldt          = arg.ldc;
+    double             stride_scale = arg.stride_scale;
+    int                batch_count  = arg.batch_count;
+    int                order        = left ? M : N;
+
+    // Check to prevent memory allocation error
+    if(M < 0 || N < 0 || K < 1 || K > order || K > 512 || lda < M || ldv < order || ldt < K
+       || batch_count <= 0)
+        return;
+
+    hipblasStride strideV = hipblasStride(ldv) * K * stride_scale;
+    hipblasStride strideT = hipblasStride(ldt) * K * stride_scale;
+    hipblasStride strideA = hipblasStride(lda) * N * stride_scale;
+
+    host_strided_batch_matrix<T> hV(order, K, ldv, strideV, batch_count);
+    host_strided_batch_matrix<T> hV0(order, K, ldv, strideV, batch_count);
+    host_strided_batch_matrix<T> hA(M, N, lda, strideA, batch_count);
+    host_strided_batch_matrix<T> hA_gold(M, N, lda, strideA, batch_count);
+    host_strided_batch_matrix<T> hA_gpu(M, N, lda, strideA, batch_count);
+    host_batch_matrix<T>         hVb(order, K, ldv, batch_count);
+    host_batch_matrix<T>         hAb(M, N, lda, batch_count);
+    host_vector<T>               hTau(size_t(K) * batch_count);
+
+    CHECK_HIP_ERROR(hV.memcheck());
+    CHECK_HIP_ERROR(hA.memcheck());
+
+    device_strided_batch_matrix<T> dV(order, K, ldv, strideV, batch_count);
+    device_strided_batch_matrix<T> dT(K, K, ldt, strideT, batch_count);
+    device_strided_batch_matrix<T> dA(M, N, lda, strideA, batch_count);
+    device_vector<T>               dTau(size_t(K) * batch_count);
+    device_batch_matrix<T>         dVb(order, K, ldv, batch_count);
+    device_batch_matrix<T>         dTb(K, K, ldt, batch_count);
+    device_batch_matrix<T>         dAb(M, N, lda, batch_count);
+    device_batch_matrix<T>         dTaub(K, 1, K, batch_count);
+
+    // the pointers to column j of V and element j of tau for larfgBatched
+    device_vector<char> dAlpha(sizeof(T*) * batch_count);
+    device_vector<char> dX(sizeof(T*) * batch_count);
+    device_vector<char> dTauj(sizeof(T*) * batch_count);
+
+    CHECK_DEVICE_ALLOCATION(dV.memcheck());
+    CHECK_DEVICE_ALLOCATION(dT.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dTau.memcheck());
+    CHECK_DEVICE_ALLOCATION(dVb.memcheck());
+    CHECK_DEVICE_ALLOCATION(dTb.memcheck());
+    CHECK_DEVICE_ALLOCATION(dAb.memcheck());
+    CHECK_DEVICE_ALLOCATION(dTaub.memcheck());
+    CHECK_DEVICE_ALLOCATION(dAlpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(dX.memcheck());
+    CHECK_DEVICE_ALLOCATION(dTauj.memcheck());
+
+    double             gpu_time_used, hipblas_error = 0;
+    hipblasLocalHandle handle(arg);
+
+    hipblas_init_matrix(hV0, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix);
+
+    auto larf_strided = [&]() {
+        for(int j = 0; j < K; j++)
+        {
+            T* Vj = dV + j + size_t(j) * ldv;
+            CHECK_HIPBLAS_ERROR(hipblasLarfgStridedBatchedFn<T>(
+                handle, order - j, Vj, strideV, Vj + 1, 1, strideV, dTau + j, K, batch_count));
+        }
+        CHECK_HIPBLAS_ERROR(hipblasLarftStridedBatchedFn<T>(
+            handle, order, K, dV, ldv, strideV, dTau, K, dT, ldt, strideT, batch_count));
+        CHECK_HIPBLAS_ERROR(hipblasLarfbStridedBatchedFn<T>(handle,
+                                                            side,
+                                                            trans,
+                                                            M,
+                                                            N,
+                                                            K,
+                                                            dV,
+                                                            ldv,
+                                                            strideV,
+                                                            dT,
+                                                            ldt,
+                                                            strideT,
+                                                            dA,
+                                                            lda,
+                                                            strideA,
+                                                            batch_count));
+    };
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(dV.transfer_from(hV0));
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        larf_strided();
+
+        CHECK_HIP_ERROR(hV.transfer_from(dV));
+        CHECK_HIP_ERROR(hA_gpu.transfer_from(dA));
+        CHECK_HIP_ERROR(hTau.transfer_from(dTau));
+
+        for(int b = 0; b < batch_count; b++)
+        {
+            // H_j^H takes column j of V0 from the diagonal on to beta * e_1, with beta left on
+            // the diagonal of V
+            for(int j = 0; j < K; j++)
+            {
+                int            n = order - j;
+                host_vector<T> y(order), beta(order);
+                for(int i = j; i < order; i++)
+                {
+                    y[i]    = hV0[b][i + size_t(j) * ldv];
+                    beta[i] = i == j ? hV[b][i + size_t(j) * ldv] : T(0);
+                }
+                ref_larf_apply(
+                    true, true, order, 1, j, hV[b], ldv, hTau[b * K + j], y.data(), order);
+                hipblas_error = std::max(
+                    hipblas_error, norm_check_general<T>('F', n, 1, n, &beta[j], &y[j]));
+            }
+
+            // H = H_0 * H_1 * ... * H_(K-1), applied one reflector at a time
+            for(int j = 0; j < N; j++)
+                for(int i = 0; i < M; i++)
+                    hA_gold[b][i + size_t(j) * lda] = hA[b][i + size_t(j) * lda];
+
+            bool conj_h = trans != HIPBLAS_OP_N;
+            for(int s = 0; s < K; s++)
+            {
+                int j = left == conj_h ? s : K - 1 - s;
+                ref_larf_apply(left, conj_h, M, N, j, hV[b], ldv, hTau[b * K + j], hA_gold[b], lda);
+            }
+
+            hipblas_error = std::max(
+                hipblas_error, norm_check_general<T>('F', M, N, lda, hA_gold[b], hA_gpu[b]));
+        }
+
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = eps * 2000;
+            unit_check_error(hipblas_error, tolerance);
+        }
+
+        // the same with arrays of pointers, which gives the same result exactly
+        for(int b = 0; b < batch_count; b++)
+        {
+            for(int j = 0; j < K; j++)
+                for(int i = 0; i < order; i++)
+                    hVb[b][i + size_t(j) * ldv] = hV0[b][i + size_t(j) * ldv];
+            for(int j = 0; j < N; j++)
+                for(int i = 0; i < M; i++)
+                    hAb[b][i + size_t(j) * lda] = hA[b][i + size_t(j) * lda];
+        }
+        CHECK_HIP_ERROR(dVb.transfer_from(hVb));
+        CHECK_HIP_ERROR(dAb.transfer_from(hAb));
+
+        std::vector<T*> hAlpha(batch_count), hX(batch_count), hTauj(batch_count);
+        for(int j = 0; j < K; j++)
+        {
+            for(int b = 0; b < batch_count; b++)
+            {
+                hAlpha[b] = dVb[b] + j + size_t(j) * ldv;
+                hX[b]     = hAlpha[b] + 1;
+                hTauj[b]  = dTaub[b] + j;
+            }
+            size_t bytes = sizeof(T*) * batch_count;
+            CHECK_HIP_ERROR(hipMemcpy(dAlpha, hAlpha.data(), bytes, hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(dX, hX.data(), bytes, hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(dTauj, hTauj.data(), bytes, hipMemcpyHostToDevice));
+            CHECK_HIPBLAS_ERROR(hipblasLarfgBatchedFn<T>(handle,
+                                                         order - j,
+                                                         (T* const*)(char*)dAlpha,
+                                                         (T* const*)(char*)dX,
+                                                         1,
+                                                         (T* const*)(char*)dTauj,
+                                                         batch_count));
+        }
+        CHECK_HIPBLAS_ERROR(hipblasLarftBatchedFn<T>(handle,
+                                                     order,
+                                                     K,
+                                                     dVb.ptr_on_device(),
+                                                     ldv,
+                                                     dTaub.ptr_on_device(),
+                                                     dTb.ptr_on_device(),
+                                                     ldt,
+                                                     batch_count));
+        CHECK_HIPBLAS_ERROR(hipblasLarfbBatchedFn<T>(handle,
+                                                     side,
+                                                     trans,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     dVb.ptr_on_device(),
+                                                     ldv,
+                                                     dTb.ptr_on_device(),
+                                                     ldt,
+                                                     dAb.ptr_on_device(),
+                                                     lda,
+                                                     batch_count));
+
+        CHECK_HIP_ERROR(hAb.transfer_from(dAb));
+        for(int b = 0; b < batch_count; b++)
+            unit_check_general<T>(M, N, lda, hA_gpu[b], hAb[b]);
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        hipblas_iteration_timer timer(arg, stream);
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            // V and A are overwritten, restore them for each run
+            CHECK_HIP_ERROR(dV.transfer_from(hV0));
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+            timer.start(iter);
+
+            larf_strided();
+
+            timer.stop(iter);
+        }
+        gpu_time_used = timer.elapsed_us();
+
+        hipblasLarfModel{}.log_args<T>(std::cout,
+                                       arg,
+                                       gpu_time_used,
+                                       2 * gemm_gflop_count<T>(M, N, K),
+                                       ArgumentLogging::NA_value,
+                                       hipblas_error);
+    }
+}
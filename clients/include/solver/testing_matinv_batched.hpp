@@ -0,0 +1,289 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasMatinvBatchedModel = ArgumentModel<e_a_type, e_N, e_lda, e_ldc, e_batch_count>;
+
+inline void testname_matinv_batched(const Arguments& arg, std::string& name)
+{
+    hipblasMatinvBatchedModel{}.test_name(arg, name);
+}
+
+// hipblas?matinvBatched, with the complex types of the tests cast to those of the HIPBLAS_V2
+// interface
+template <typename T>
+hipblasStatus_t hipblasMatinvBatchedFn(hipblasHandle_t handle,
+                                       int             n,
+                                       const T* const  A[],
+                                       int             lda,
+                                       T* const        Ainv[],
+                                       int             lda_inv,
+                                       int*            info,
+                                       int             batch_count)
+{
+#ifdef HIPBLAS_V2
+    using Tc = std::conditional_t<
+        std::is_same_v<T, hipblasComplex>,
+        hipComplex,
+        std::conditional_t<std::is_same_v<T, hipblasDoubleComplex>, hipDoubleComplex, T>>;
+#else
+    using Tc = T;
+#endif
+    auto A_c    = (const Tc* const*)A;
+    auto Ainv_c = (Tc* const*)Ainv;
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSmatinvBatched(handle, n, A_c, lda, Ainv_c, lda_inv, info, batch_count);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDmatinvBatched(handle, n, A_c, lda, Ainv_c, lda_inv, info, batch_count);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCmatinvBatched(handle, n, A_c, lda, Ainv_c, lda_inv, info, batch_count);
+    else
+        return hipblasZmatinvBatched(handle, n, A_c, lda, Ainv_c, lda_inv, info, batch_count);
+}
+
+template <typename T>
+void testing_matinv_batched_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+    int64_t            N           = 20;
+    int64_t            lda         = 21;
+    int64_t            batch_count = 2;
+
+    device_batch_matrix<T> dA(N, N, lda, batch_count);
+    device_batch_matrix<T> dC(N, N, lda, batch_count);
+    device_vector<int>     dInfo(batch_count);
+
+    EXPECT_HIPBLAS_STATUS(hipblasMatinvBatchedFn<T>(nullptr,
+                                                    N,
+                                                    dA.ptr_on_device(),
+                                                    lda,
+                                                    dC.ptr_on_device(),
+                                                    lda,
+                                                    dInfo,
+                                                    batch_count),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    // the matrices are at most 32 by 32
+    EXPECT_HIPBLAS_STATUS(hipblasMatinvBatchedFn<T>(handle,
+                                                    33,
+                                                    dA.ptr_on_device(),
+                                                    lda + 13,
+                                                    dC.ptr_on_device(),
+                                                    lda + 13,
+                                                    dInfo,
+                                                    batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasMatinvBatchedFn<T>(handle,
+                                                    -1,
+                                                    dA.ptr_on_device(),
+                                                    lda,
+                                                    dC.ptr_on_device(),
+                                                    lda,
+                                                    dInfo,
+                                                    batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasMatinvBatchedFn<T>(handle,
+                                                    N,
+                                                    dA.ptr_on_device(),
+                                                    N - 1,
+                                                    dC.ptr_on_device(),
+                                                    lda,
+                                                    dInfo,
+                                                    batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasMatinvBatchedFn<T>(handle,
+                                                    N,
+                                                    dA.ptr_on_device(),
+                                                    lda,
+                                                    dC.ptr_on_device(),
+                                                    N - 1,
+                                                    dInfo,
+                                                    batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasMatinvBatchedFn<T>(
+            handle, N, dA.ptr_on_device(), lda, dC.ptr_on_device(), lda, dInfo, -1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasMatinvBatchedFn<T>(
+            handle, N, nullptr, lda, dC.ptr_on_device(), lda, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasMatinvBatchedFn<T>(
+            handle, N, dA.ptr_on_device(), lda, nullptr, lda, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasMatinvBatchedFn<T>(
+            handle, N, dA.ptr_on_device(), lda, dC.ptr_on_device(), lda, nullptr, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If N == 0 || batch_count == 0, A, Ainv and info can be nullptr
+    CHECK_HIPBLAS_ERROR(
+        hipblasMatinvBatchedFn<T>(handle, 0, nullptr, lda, nullptr, lda, nullptr, batch_count));
+    CHECK_HIPBLAS_ERROR(
+        hipblasMatinvBatchedFn<T>(handle, N, nullptr, lda, nullptr, lda, nullptr, 0));
+}
+
+template <typename T>
+void testing_matinv_batched(const Arguments& arg)
+{
+    using U = real_t<T>;
+
+    int N           = arg.N;
+    int lda         = arg.lda;
+    int ldc         = arg.ldc;
+    int batch_count = arg.batch_count;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || N > 32 || lda < N || ldc < N || batch_count <= 0)
+        return;
+
+    host_batch_matrix<T> hA(N, N, lda, batch_count);
+    host_batch_matrix<T> hC(N, N, ldc, batch_count);
+    host_vector<int>     hIpiv(N);
+    host_vector<int>     hInfo(batch_count);
+    host_vector<int>     hInfo1(batch_count);
+
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hC.memcheck());
+
+    device_batch_matrix<T> dA(N, N, lda, batch_count);
+    device_batch_matrix<T> dC(N, N, ldc, batch_count);
+    device_vector<int>     dInfo(batch_count);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dInfo.memcheck());
+
+    double             gpu_time_used, hipblas_error = 0;
+    hipblasLocalHandle handle(arg);
+
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+
+    // scale A to avoid singularities, but keep the pivots of the first column off the diagonal
+    for(int b = 0; b < batch_count; b++)
+    {
+        for(int i = 0; i < N; i++)
+        {
+            for(int j = 0; j < N; j++)
+            {
+                if(i == j)
+                    hA[b][i + j * lda] += 400;
+                else
+                    hA[b][i + j * lda] -= 4;
+            }
+        }
+        if(N > 1)
+            hA[b][N - 1] += 1000;
+    }
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasMatinvBatchedFn<T>(handle,
+                                                      N,
+                                                      dA.ptr_on_device(),
+                                                      lda,
+                                                      dC.ptr_on_device(),
+                                                      ldc,
+                                                      dInfo,
+                                                      batch_count));
+
+        CHECK_HIP_ERROR(hC.transfer_from(dC));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hInfo1.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+        // CPU LAPACK, getrf and getri in place in hA
+        for(int b = 0; b < batch_count; b++)
+        {
+            hInfo[b] = ref_getrf(N, N, hA[b], lda, hIpiv.data());
+
+            host_vector<T> work(1);
+            ref_getri(N, hA[b], lda, hIpiv.data(), work.data(), -1);
+            int lwork = type2int(work[0]);
+
+            work = host_vector<T>(lwork);
+            ref_getri(N, hA[b], lda, hIpiv.data(), work.data(), lwork);
+
+            // the inverse is compared with lda as the leading dimension of both
+            host_matrix<T> hCb(N, N, lda);
+            for(int j = 0; j < N; j++)
+                for(int i = 0; i < N; i++)
+                    hCb[0][i + j * lda] = hC[b][i + j * ldc];
+
+            EXPECT_EQ(hInfo1[b], hInfo[b]);
+            hipblas_error = std::max(hipblas_error,
+                                     norm_check_general<T>('F', N, N, lda, hA[b], hCb[0]));
+        }
+
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = eps * 2000;
+            unit_check_error(hipblas_error, tolerance);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        hipblas_iteration_timer timer(arg, stream);
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            timer.start(iter);
+
+            CHECK_HIPBLAS_ERROR(hipblasMatinvBatchedFn<T>(handle,
+                                                          N,
+                                                          dA.ptr_on_device(),
+                                                          lda,
+                                                          dC.ptr_on_device(),
+                                                          ldc,
+                                                          dInfo,
+                                                          batch_count));
+
+            timer.stop(iter);
+        }
+        gpu_time_used = timer.elapsed_us();
+
+        hipblasMatinvBatchedModel{}.log_args<T>(std::cout,
+                                                arg,
+                                                gpu_time_used,
+                                                getrf_gflop_count<T>(N, N)
+                                                    + getri_gflop_count<T>(N),
+                                                getri_gbyte_count<T>(N),
+                                                hipblas_error);
+    }
+}
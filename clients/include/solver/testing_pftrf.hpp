@@ -0,0 +1,273 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "gtest/gtest.h"
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// transA is the transr of the RFP layout
+using hipblasPftrfModel = ArgumentModel<e_a_type, e_transA, e_uplo, e_N, e_lda>;
+
+inline void testname_pftrf(const Arguments& arg, std::string& name)
+{
+    hipblasPftrfModel{}.test_name(arg, name);
+}
+
+// hipblas?trttf, hipblas?tfttr and hipblas?pftrf, with the complex types of the tests cast to
+// those of the HIPBLAS_V2 interface
+template <typename T>
+using hipblas_rfp_type_t =
+#ifdef HIPBLAS_V2
+    std::conditional_t<
+        std::is_same_v<T, hipblasComplex>,
+        hipComplex,
+        std::conditional_t<std::is_same_v<T, hipblasDoubleComplex>, hipDoubleComplex, T>>;
+#else
+    T;
+#endif
+
+template <typename T>
+hipblasStatus_t hipblasTrttfFn(hipblasHandle_t    handle,
+                               hipblasOperation_t transr,
+                               hipblasFillMode_t  uplo,
+                               int                n,
+                               const T*           A,
+                               int                lda,
+                               T*                 ARF)
+{
+    using Tc = hipblas_rfp_type_t<T>;
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasStrttf(handle, transr, uplo, n, A, lda, ARF);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDtrttf(handle, transr, uplo, n, A, lda, ARF);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCtrttf(handle, transr, uplo, n, (const Tc*)A, lda, (Tc*)ARF);
+    else
+        return hipblasZtrttf(handle, transr, uplo, n, (const Tc*)A, lda, (Tc*)ARF);
+}
+
+template <typename T>
+hipblasStatus_t hipblasTfttrFn(hipblasHandle_t    handle,
+                               hipblasOperation_t transr,
+                               hipblasFillMode_t  uplo,
+                               int                n,
+                               const T*           ARF,
+                               T*                 A,
+                               int                lda)
+{
+    using Tc = hipblas_rfp_type_t<T>;
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasStfttr(handle, transr, uplo, n, ARF, A, lda);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDtfttr(handle, transr, uplo, n, ARF, A, lda);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCtfttr(handle, transr, uplo, n, (const Tc*)ARF, (Tc*)A, lda);
+    else
+        return hipblasZtfttr(handle, transr, uplo, n, (const Tc*)ARF, (Tc*)A, lda);
+}
+
+template <typename T>
+hipblasStatus_t hipblasPftrfFn(hipblasHandle_t    handle,
+                               hipblasOperation_t transr,
+                               hipblasFillMode_t  uplo,
+                               int                n,
+                               T*                 A,
+                               int*               info)
+{
+    using Tc = hipblas_rfp_type_t<T>;
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSpftrf(handle, transr, uplo, n, A, info);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDpftrf(handle, transr, uplo, n, A, info);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCpftrf(handle, transr, uplo, n, (Tc*)A, info);
+    else
+        return hipblasZpftrf(handle, transr, uplo, n, (Tc*)A, info);
+}
+
+template <typename T>
+void testing_pftrf_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle       handle(arg);
+    const int                N      = 101;
+    const int                lda    = 102;
+    const hipblasOperation_t transr = HIPBLAS_OP_N;
+    const hipblasFillMode_t  uplo   = HIPBLAS_FILL_MODE_UPPER;
+
+    device_matrix<T>   dA(N, N, lda);
+    device_vector<T>   dARF(N * (N + 1) / 2);
+    device_vector<int> dInfo(1);
+
+    EXPECT_HIPBLAS_STATUS(hipblasTrttfFn<T>(nullptr, transr, uplo, N, dA, lda, dARF),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasTfttrFn<T>(nullptr, transr, uplo, N, dARF, dA, lda),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasPftrfFn<T>(nullptr, transr, uplo, N, dARF, dInfo),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasTrttfFn<T>(handle, transr, HIPBLAS_FILL_MODE_FULL, N, dA, lda, dARF),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasTrttfFn<T>(handle, transr, uplo, N, dA, N - 1, dARF),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasTfttrFn<T>(handle, transr, uplo, -1, dARF, dA, lda),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasPftrfFn<T>(handle, transr, uplo, -1, dARF, dInfo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // transr is HIPBLAS_OP_N or HIPBLAS_OP_C for complex types
+    if(is_complex<T>)
+        EXPECT_HIPBLAS_STATUS(hipblasPftrfFn<T>(handle, HIPBLAS_OP_T, uplo, N, dARF, dInfo),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If N == 0, A can be nullptr
+    CHECK_HIPBLAS_ERROR(hipblasTrttfFn<T>(handle, transr, uplo, 0, nullptr, lda, nullptr));
+    CHECK_HIPBLAS_ERROR(hipblasPftrfFn<T>(handle, transr, uplo, 0, nullptr, dInfo));
+
+    if(arg.bad_arg_all)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasTrttfFn<T>(handle, transr, uplo, N, nullptr, lda, dARF),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasTfttrFn<T>(handle, transr, uplo, N, dARF, nullptr, lda),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasPftrfFn<T>(handle, transr, uplo, N, nullptr, dInfo),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasPftrfFn<T>(handle, transr, uplo, N, dARF, nullptr),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+    }
+}
+
+template <typename T>
+void testing_pftrf(const Arguments& arg)
+{
+    using U = real_t<T>;
+
+    hipblasOperation_t transr = char2hipblas_operation(arg.transA);
+    hipblasFillMode_t  uplo   = char2hipblas_fill(arg.uplo);
+    int                N      = arg.N;
+    int                lda    = arg.lda;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N)
+        return;
+
+    host_matrix<T>   hA(N, N, lda);
+    host_matrix<T>   hA1(N, N, lda);
+    host_matrix<T>   hR(N, N, lda);
+    host_vector<int> hInfo(1);
+    host_vector<int> hInfo1(1);
+
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hA1.memcheck());
+    CHECK_HIP_ERROR(hR.memcheck());
+
+    device_matrix<T>   dA(N, N, lda);
+    device_vector<T>   dARF(std::max(N * (N + 1) / 2, 1));
+    device_vector<int> dInfo(1);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dARF.memcheck());
+    CHECK_DEVICE_ALLOCATION(dInfo.memcheck());
+
+    double             gpu_time_used, hipblas_error = 0;
+    hipblasLocalHandle handle(arg);
+
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+
+    T* A = (T*)hA;
+    // make A Hermitian and diagonally dominant, so that it is positive definite
+    for(int i = 0; i < N; i++)
+    {
+        for(int j = 0; j < i; j++)
+        {
+            A[i + j * lda] -= 4;
+            A[j + i * lda] = hipblas_conjugate(A[i + j * lda]);
+        }
+        A[i + i * lda] = hipblas_real(A[i + i * lda]);
+        A[i + i * lda] += 10 * N;
+    }
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(hipMemset(dInfo, 0, sizeof(int)));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // A in RFP storage is factored and copied back to the triangle of A, so that the factor
+        // compares with that of potrf
+        CHECK_HIPBLAS_ERROR(hipblasTrttfFn<T>(handle, transr, uplo, N, dA, lda, dARF));
+        CHECK_HIPBLAS_ERROR(hipblasPftrfFn<T>(handle, transr, uplo, N, dARF, dInfo));
+        CHECK_HIPBLAS_ERROR(hipblasTfttrFn<T>(handle, transr, uplo, N, dARF, dA, lda));
+
+        CHECK_HIP_ERROR(hA1.transfer_from(dA));
+        CHECK_HIP_ERROR(hipMemcpy(hInfo1.data(), dInfo, sizeof(int), hipMemcpyDeviceToHost));
+
+        // the reference factors a copy, so that hA is left for the timing runs
+        std::copy(hA[0], hA[0] + size_t(lda) * N, hR[0]);
+        hInfo[0] = ref_potrf(arg.uplo, N, hR.data(), lda);
+
+        hipblas_error = norm_check_general<T>('F', N, N, lda, hR, hA1);
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = eps * 2000;
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, 1, 1, hInfo.data(), hInfo1.data());
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        hipblas_iteration_timer timer(arg, stream);
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            // A is overwritten by its factor, restore it for each run
+            CHECK_HIPBLAS_ERROR(hipblasTrttfFn<T>(handle, transr, uplo, N, dA, lda, dARF));
+
+            timer.start(iter);
+
+            CHECK_HIPBLAS_ERROR(hipblasPftrfFn<T>(handle, transr, uplo, N, dARF, dInfo));
+
+            timer.stop(iter);
+        }
+        gpu_time_used = timer.elapsed_us();
+
+        hipblasPftrfModel{}.log_args<T>(std::cout,
+                                        arg,
+                                        gpu_time_used,
+                                        potrf_gflop_count<T>(N),
+                                        potrf_gbyte_count<T>(N),
+                                        hipblas_error);
+    }
+}
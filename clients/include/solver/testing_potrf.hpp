@@ -0,0 +1,193 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gtest/gtest.h"
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasPotrfModel = ArgumentModel<e_a_type, e_uplo, e_N, e_lda>;
+
+inline void testname_potrf(const Arguments& arg, std::string& name)
+{
+    hipblasPotrfModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_potrf_bad_arg(const Arguments& arg)
+{
+    auto hipblasPotrfFn
+        = arg.api == hipblas_client_api::FORTRAN ? hipblasPotrf<T, true> : hipblasPotrf<T, false>;
+
+    hipblasLocalHandle      handle(arg);
+    const int               N    = 101;
+    const int               lda  = 102;
+    const hipblasFillMode_t uplo = HIPBLAS_FILL_MODE_UPPER;
+
+    // Allocate device memory
+    device_matrix<T>   dA(N, N, lda);
+    device_vector<int> dInfo(1);
+
+    EXPECT_HIPBLAS_STATUS(hipblasPotrfFn(nullptr, uplo, N, dA, lda, dInfo),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasPotrfFn(handle, HIPBLAS_FILL_MODE_FULL, N, dA, lda, dInfo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasPotrfFn(handle, uplo, -1, dA, lda, dInfo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasPotrfFn(handle, uplo, N, dA, N - 1, dInfo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If N == 0, A can be nullptr
+    CHECK_HIPBLAS_ERROR(hipblasPotrfFn(handle, uplo, 0, nullptr, lda, dInfo));
+
+    if(arg.bad_arg_all)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasPotrfFn(handle, uplo, N, nullptr, lda, dInfo),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasPotrfFn(handle, uplo, N, dA, lda, nullptr),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+    }
+}
+
+template <typename T>
+void testing_potrf(const Arguments& arg)
+{
+    using U             = real_t<T>;
+    bool FORTRAN        = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasPotrfFn = FORTRAN ? hipblasPotrf<T, true> : hipblasPotrf<T, false>;
+
+    hipblasFillMode_t uplo = char2hipblas_fill(arg.uplo);
+    int               N    = arg.N;
+    int               lda  = arg.lda;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N)
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_matrix<T>   hA(N, N, lda);
+    host_matrix<T>   hA1(N, N, lda);
+    host_vector<int> hInfo(1);
+    host_vector<int> hInfo1(1);
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hA1.memcheck());
+
+    // Allocate device memory
+    device_matrix<T>   dA(N, N, lda);
+    device_vector<int> dInfo(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dInfo.memcheck());
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    // Initial hA on CPU
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+
+    T* A = (T*)hA;
+    // make A Hermitian and diagonally dominant, so that it is positive definite
+    for(int i = 0; i < N; i++)
+    {
+        for(int j = 0; j < i; j++)
+        {
+            A[i + j * lda] -= 4;
+            A[j + i * lda] = hipblas_conjugate(A[i + j * lda]);
+        }
+        A[i + i * lda] = hipblas_real(A[i + i * lda]);
+        A[i + i * lda] += 10 * N;
+    }
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(hipMemset(dInfo, 0, sizeof(int)));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasPotrfFn(handle, uplo, N, dA, lda, dInfo));
+
+        // Copy output from device to CPU
+        CHECK_HIP_ERROR(hA1.transfer_from(dA));
+        CHECK_HIP_ERROR(hipMemcpy(hInfo1.data(), dInfo, sizeof(int), hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        hInfo[0] = ref_potrf(arg.uplo, N, hA.data(), lda);
+
+        hipblas_error = norm_check_general<T>('F', N, N, lda, hA, hA1);
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = eps * 2000;
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, 1, 1, hInfo.data(), hInfo1.data());
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        hipblas_iteration_timer timer(arg, stream);
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            timer.start(iter);
+
+            CHECK_HIPBLAS_ERROR(hipblasPotrfFn(handle, uplo, N, dA, lda, dInfo));
+
+            timer.stop(iter);
+        }
+        gpu_time_used = timer.elapsed_us();
+
+        hipblasPotrfModel{}.log_args<T>(std::cout,
+                                        arg,
+                                        gpu_time_used,
+                                        potrf_gflop_count<T>(N),
+                                        potrf_gbyte_count<T>(N),
+                                        hipblas_error);
+    }
+}
+
+// Instantiated in clients/common/solver/common_potrf.cpp
+extern template void testing_potrf<float>(const Arguments&);
+extern template void testing_potrf<double>(const Arguments&);
+extern template void testing_potrf<hipblasComplex>(const Arguments&);
+extern template void testing_potrf<hipblasDoubleComplex>(const Arguments&);
@@ -0,0 +1,317 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gtest/gtest.h"
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasPotrsStridedBatchedModel
+    = ArgumentModel<e_a_type, e_uplo, e_N, e_lda, e_ldb, e_stride_scale, e_batch_count>;
+
+inline void testname_potrs_strided_batched(const Arguments& arg, std::string& name)
+{
+    hipblasPotrsStridedBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_potrs_strided_batched_bad_arg(const Arguments& arg)
+{
+    auto hipblasPotrsStridedBatchedFn = arg.api == hipblas_client_api::FORTRAN
+                                            ? hipblasPotrsStridedBatched<T, true>
+                                            : hipblasPotrsStridedBatched<T, false>;
+
+    hipblasLocalHandle      handle(arg);
+    const int               N           = 101;
+    const int               nrhs        = 1;
+    const int               lda         = 102;
+    const int               ldb         = 103;
+    const int               batch_count = 2;
+    const hipblasStride     strideA     = size_t(lda) * N;
+    const hipblasStride     strideB     = size_t(ldb) * nrhs;
+    const hipblasFillMode_t uplo        = HIPBLAS_FILL_MODE_UPPER;
+    int                     info        = 0;
+    int                     expectedInfo;
+
+    // Allocate device memory
+    device_strided_batch_matrix<T> dA(N, N, lda, strideA, batch_count);
+    device_strided_batch_matrix<T> dB(N, nrhs, ldb, strideB, batch_count);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsStridedBatchedFn(
+            handle, uplo, N, nrhs, dA, lda, strideA, dB, ldb, strideB, nullptr, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasPotrsStridedBatchedFn(handle,
+                                                       HIPBLAS_FILL_MODE_FULL,
+                                                       N,
+                                                       nrhs,
+                                                       dA,
+                                                       lda,
+                                                       strideA,
+                                                       dB,
+                                                       ldb,
+                                                       strideB,
+                                                       &info,
+                                                       batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -1;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsStridedBatchedFn(
+            handle, uplo, -1, nrhs, dA, lda, strideA, dB, ldb, strideB, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -2;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsStridedBatchedFn(
+            handle, uplo, N, -1, dA, lda, strideA, dB, ldb, strideB, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -3;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsStridedBatchedFn(
+            handle, uplo, N, nrhs, nullptr, lda, strideA, dB, ldb, strideB, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -4;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsStridedBatchedFn(
+            handle, uplo, N, nrhs, dA, N - 1, strideA, dB, ldb, strideB, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -5;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsStridedBatchedFn(
+            handle, uplo, N, nrhs, dA, lda, strideA, nullptr, ldb, strideB, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -7;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsStridedBatchedFn(
+            handle, uplo, N, nrhs, dA, lda, strideA, dB, N - 1, strideB, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -8;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsStridedBatchedFn(
+            handle, uplo, N, nrhs, dA, lda, strideA, dB, ldb, strideB, &info, -1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -11;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    // If N == 0, A and B can be nullptr
+    EXPECT_HIPBLAS_STATUS(hipblasPotrsStridedBatchedFn(handle,
+                                                       uplo,
+                                                       0,
+                                                       nrhs,
+                                                       nullptr,
+                                                       lda,
+                                                       strideA,
+                                                       nullptr,
+                                                       ldb,
+                                                       strideB,
+                                                       &info,
+                                                       batch_count),
+                          HIPBLAS_STATUS_SUCCESS);
+    expectedInfo = 0;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    // If nrhs == 0, B can be nullptr
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsStridedBatchedFn(
+            handle, uplo, N, 0, dA, lda, strideA, nullptr, ldb, strideB, &info, batch_count),
+        HIPBLAS_STATUS_SUCCESS);
+    expectedInfo = 0;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+}
+
+template <typename T>
+void testing_potrs_strided_batched(const Arguments& arg)
+{
+    using U      = real_t<T>;
+    bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasPotrsStridedBatchedFn
+        = FORTRAN ? hipblasPotrsStridedBatched<T, true> : hipblasPotrsStridedBatched<T, false>;
+
+    hipblasFillMode_t uplo         = char2hipblas_fill(arg.uplo);
+    int               N            = arg.N;
+    int               nrhs         = 1;
+    int               lda          = arg.lda;
+    int               ldb          = arg.ldb;
+    double            stride_scale = arg.stride_scale;
+    int               batch_count  = arg.batch_count;
+
+    hipblasStride strideA = size_t(lda) * N * stride_scale;
+    hipblasStride strideB = size_t(ldb) * nrhs * stride_scale;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N || ldb < N || batch_count < 0)
+    {
+        return;
+    }
+    if(batch_count == 0)
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_strided_batch_matrix<T> hA(N, N, lda, strideA, batch_count);
+    host_strided_batch_matrix<T> hX(N, nrhs, ldb, strideB, batch_count);
+    host_strided_batch_matrix<T> hB(N, nrhs, ldb, strideB, batch_count);
+    host_strided_batch_matrix<T> hB1(N, nrhs, ldb, strideB, batch_count);
+    int                          info;
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hX.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hB1.memcheck());
+
+    // Allocate device memory
+    device_strided_batch_matrix<T> dA(N, N, lda, strideA, batch_count);
+    device_strided_batch_matrix<T> dB(N, nrhs, ldb, strideB, batch_count);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    // Initial hA on CPU
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(hX, arg, hipblas_client_never_set_nan, hipblas_general_matrix, false, true);
+
+    for(int b = 0; b < batch_count; b++)
+    {
+        T* A = hA[b];
+        // make A Hermitian and diagonally dominant, so that it is positive definite
+        for(int i = 0; i < N; i++)
+        {
+            for(int j = 0; j < i; j++)
+            {
+                A[i + j * lda] -= 4;
+                A[j + i * lda] = hipblas_conjugate(A[i + j * lda]);
+            }
+            A[i + i * lda] = hipblas_real(A[i + i * lda]);
+            A[i + i * lda] += 10 * N;
+        }
+    }
+
+    hipblasOperation_t op = HIPBLAS_OP_N;
+    for(int b = 0; b < batch_count; b++)
+    {
+        // Calculate hB = hA*hX;
+        ref_gemm<T>(op, op, N, nrhs, N, (T)1, hA[b], lda, hX[b], ldb, (T)0, hB[b], ldb);
+
+        // Cholesky factorize hA on the CPU
+        int potrf_info = ref_potrf<T>(arg.uplo, N, hA[b], lda);
+        if(potrf_info != 0)
+        {
+            std::cerr << "Cholesky factorization failed" << std::endl;
+            int expectedInfo = 0;
+            unit_check_general(1, 1, 1, &expectedInfo, &potrf_info);
+        }
+    }
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasPotrsStridedBatchedFn(
+            handle, uplo, N, nrhs, dA, lda, strideA, dB, ldb, strideB, &info, batch_count));
+
+        // Copy output from device to CPU
+        CHECK_HIP_ERROR(hB1.transfer_from(dB));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int b = 0; b < batch_count; b++)
+        {
+            ref_potrs(arg.uplo, N, nrhs, hA[b], lda, hB[b], ldb);
+        }
+
+        hipblas_error = norm_check_general<T>('F', N, nrhs, ldb, strideB, hB, hB1, batch_count);
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = N * eps * 100;
+            int    zero      = 0;
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, 1, 1, &zero, &info);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        hipblas_iteration_timer timer(arg, stream);
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            timer.start(iter);
+
+            CHECK_HIPBLAS_ERROR(hipblasPotrsStridedBatchedFn(
+                handle, uplo, N, nrhs, dA, lda, strideA, dB, ldb, strideB, &info, batch_count));
+
+            timer.stop(iter);
+        }
+        gpu_time_used = timer.elapsed_us();
+
+        hipblasPotrsStridedBatchedModel{}.log_args<T>(std::cout,
+                                                      arg,
+                                                      gpu_time_used,
+                                                      potrs_gflop_count<T>(N, nrhs),
+                                                      potrs_gbyte_count<T>(N, nrhs),
+                                                      hipblas_error);
+    }
+}
+
+// Instantiated in clients/common/solver/common_potrs.cpp
+extern template void testing_potrs_strided_batched<float>(const Arguments&);
+extern template void testing_potrs_strided_batched<double>(const Arguments&);
+extern template void testing_potrs_strided_batched<hipblasComplex>(const Arguments&);
+extern template void testing_potrs_strided_batched<hipblasDoubleComplex>(const Arguments&);
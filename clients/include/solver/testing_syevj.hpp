@@ -0,0 +1,348 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gtest/gtest.h"
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasSyevjModel = ArgumentModel<e_a_type, e_uplo, e_N, e_lda>;
+
+inline void testname_syevj(const Arguments& arg, std::string& name)
+{
+    hipblasSyevjModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_syevj_bad_arg(const Arguments& arg)
+{
+    using U             = real_t<T>;
+    bool FORTRAN        = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasSyevjFn = FORTRAN ? hipblasSyevj<T, U, true> : hipblasSyevj<T, U, false>;
+
+    hipblasLocalHandle      handle(arg);
+    const int               N          = 101;
+    const int               lda        = 102;
+    const int               max_sweeps = 100;
+    const U                 abstol     = 0;
+    const hipblasEvect_t    evect      = HIPBLAS_EVECT_ORIGINAL;
+    const hipblasFillMode_t uplo       = HIPBLAS_FILL_MODE_UPPER;
+
+    // Allocate device memory
+    device_matrix<T>   dA(N, N, lda);
+    device_vector<U>   dW(N);
+    device_vector<U>   dResidual(1);
+    device_vector<int> dSweeps(1);
+    device_vector<int> dInfo(1);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasSyevjFn(
+            nullptr, evect, uplo, N, dA, lda, abstol, dResidual, max_sweeps, dSweeps, dW, dInfo),
+        HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSyevjFn(handle,
+                                         hipblasEvect_t(2),
+                                         uplo,
+                                         N,
+                                         dA,
+                                         lda,
+                                         abstol,
+                                         dResidual,
+                                         max_sweeps,
+                                         dSweeps,
+                                         dW,
+                                         dInfo),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSyevjFn(handle,
+                                         evect,
+                                         HIPBLAS_FILL_MODE_FULL,
+                                         N,
+                                         dA,
+                                         lda,
+                                         abstol,
+                                         dResidual,
+                                         max_sweeps,
+                                         dSweeps,
+                                         dW,
+                                         dInfo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasSyevjFn(
+            handle, evect, uplo, -1, dA, lda, abstol, dResidual, max_sweeps, dSweeps, dW, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasSyevjFn(
+            handle, evect, uplo, N, dA, N - 1, abstol, dResidual, max_sweeps, dSweeps, dW, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasSyevjFn(handle, evect, uplo, N, dA, lda, abstol, dResidual, 0, dSweeps, dW, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If N == 0, A and W can be nullptr
+    CHECK_HIPBLAS_ERROR(hipblasSyevjFn(handle,
+                                       evect,
+                                       uplo,
+                                       0,
+                                       nullptr,
+                                       lda,
+                                       abstol,
+                                       dResidual,
+                                       max_sweeps,
+                                       dSweeps,
+                                       nullptr,
+                                       dInfo));
+
+    if(arg.bad_arg_all)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasSyevjFn(handle,
+                                             evect,
+                                             uplo,
+                                             N,
+                                             nullptr,
+                                             lda,
+                                             abstol,
+                                             dResidual,
+                                             max_sweeps,
+                                             dSweeps,
+                                             dW,
+                                             dInfo),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasSyevjFn(handle,
+                                             evect,
+                                             uplo,
+                                             N,
+                                             dA,
+                                             lda,
+                                             abstol,
+                                             dResidual,
+                                             max_sweeps,
+                                             dSweeps,
+                                             nullptr,
+                                             dInfo),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(
+            hipblasSyevjFn(
+                handle, evect, uplo, N, dA, lda, abstol, nullptr, max_sweeps, dSweeps, dW, dInfo),
+            HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(
+            hipblasSyevjFn(
+                handle, evect, uplo, N, dA, lda, abstol, dResidual, max_sweeps, nullptr, dW, dInfo),
+            HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasSyevjFn(handle,
+                                             evect,
+                                             uplo,
+                                             N,
+                                             dA,
+                                             lda,
+                                             abstol,
+                                             dResidual,
+                                             max_sweeps,
+                                             dSweeps,
+                                             dW,
+                                             nullptr),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+    }
+}
+
+template <typename T>
+void testing_syevj(const Arguments& arg)
+{
+    using U             = real_t<T>;
+    bool FORTRAN        = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasSyevjFn = FORTRAN ? hipblasSyevj<T, U, true> : hipblasSyevj<T, U, false>;
+
+    hipblasFillMode_t uplo       = char2hipblas_fill(arg.uplo);
+    int               N          = arg.N;
+    int               lda        = arg.lda;
+    int               max_sweeps = 100;
+    U                 abstol     = 0;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N)
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_matrix<T>   hA(N, N, lda);
+    host_matrix<T>   hA1(N, N, lda);
+    host_matrix<T>   hAV(N, N, lda);
+    host_vector<U>   hW(N);
+    host_vector<U>   hW1(N);
+    host_vector<int> hInfo(1);
+    host_vector<int> hInfo1(1);
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hA1.memcheck());
+
+    // Allocate device memory
+    device_matrix<T>   dA(N, N, lda);
+    device_vector<U>   dW(N);
+    device_vector<U>   dResidual(1);
+    device_vector<int> dSweeps(1);
+    device_vector<int> dInfo(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dW.memcheck());
+    CHECK_DEVICE_ALLOCATION(dResidual.memcheck());
+    CHECK_DEVICE_ALLOCATION(dSweeps.memcheck());
+    CHECK_DEVICE_ALLOCATION(dInfo.memcheck());
+
+    double             gpu_time_used, hipblas_error = 0;
+    hipblasLocalHandle handle(arg);
+
+    // Initial hA on CPU
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+
+    T* A = (T*)hA;
+    // make A Hermitian
+    for(int i = 0; i < N; i++)
+    {
+        for(int j = 0; j < i; j++)
+            A[j + i * lda] = hipblas_conjugate(A[i + j * lda]);
+        A[i + i * lda] = hipblas_real(A[i + i * lda]);
+    }
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        hA1      = hA;
+        hInfo[0] = ref_syevd('N', arg.uplo, N, hA1.data(), lda, hW.data());
+
+        for(auto evect : {HIPBLAS_EVECT_NONE, HIPBLAS_EVECT_ORIGINAL})
+        {
+            /* =====================================================================
+                HIPBLAS
+            =================================================================== */
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+            CHECK_HIPBLAS_ERROR(hipblasSyevjFn(handle,
+                                               evect,
+                                               uplo,
+                                               N,
+                                               dA,
+                                               lda,
+                                               abstol,
+                                               dResidual,
+                                               max_sweeps,
+                                               dSweeps,
+                                               dW,
+                                               dInfo));
+
+            // Copy output from device to CPU
+            CHECK_HIP_ERROR(hA1.transfer_from(dA));
+            CHECK_HIP_ERROR(hW1.transfer_from(dW));
+            CHECK_HIP_ERROR(hipMemcpy(hInfo1.data(), dInfo, sizeof(int), hipMemcpyDeviceToHost));
+
+            double error = norm_check_general<U>('F', 1, N, 1, hW.data(), hW1.data());
+
+            // A * V = V * diag(W) for the eigenvectors V in A
+            if(evect == HIPBLAS_EVECT_ORIGINAL && N > 0)
+            {
+                ref_gemm<T>(HIPBLAS_OP_N,
+                            HIPBLAS_OP_N,
+                            N,
+                            N,
+                            N,
+                            (T)1,
+                            hA.data(),
+                            lda,
+                            hA1.data(),
+                            lda,
+                            (T)0,
+                            hAV.data(),
+                            lda);
+                for(int j = 0; j < N; j++)
+                    for(int i = 0; i < N; i++)
+                        hA1[i + j * lda] *= (T)hW1[j];
+
+                error = std::max(error, norm_check_general<T>('F', N, N, lda, hA1, hAV));
+            }
+            hipblas_error = std::max(hipblas_error, error);
+
+            if(arg.unit_check)
+            {
+                U      eps       = std::numeric_limits<U>::epsilon();
+                double tolerance = eps * 2000;
+
+                unit_check_error(error, tolerance);
+                unit_check_general(1, 1, 1, hInfo.data(), hInfo1.data());
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        hipblas_iteration_timer timer(arg, stream);
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            timer.start(iter);
+
+            // A is overwritten by the eigenvectors, restore it for each run
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+            CHECK_HIPBLAS_ERROR(hipblasSyevjFn(handle,
+                                               HIPBLAS_EVECT_ORIGINAL,
+                                               uplo,
+                                               N,
+                                               dA,
+                                               lda,
+                                               abstol,
+                                               dResidual,
+                                               max_sweeps,
+                                               dSweeps,
+                                               dW,
+                                               dInfo));
+
+            timer.stop(iter);
+        }
+        gpu_time_used = timer.elapsed_us();
+
+        hipblasSyevjModel{}.log_args<T>(std::cout,
+                                        arg,
+                                        gpu_time_used,
+                                        syev_gflop_count<T>(N, true),
+                                        syev_gbyte_count<T>(N, true),
+                                        hipblas_error);
+    }
+}
+
+// Instantiated in clients/common/solver/common_syevj.cpp
+extern template void testing_syevj<float>(const Arguments&);
+extern template void testing_syevj<double>(const Arguments&);
+extern template void testing_syevj<hipblasComplex>(const Arguments&);
+extern template void testing_syevj<hipblasDoubleComplex>(const Arguments&);
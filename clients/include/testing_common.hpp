@@ -49,6 +49,7 @@
 #include "host_batch_matrix.hpp"
 #include "host_batch_vector.hpp"
 #include "host_matrix.hpp"
+#include "host_reference.hpp"
 #include "host_strided_batch_matrix.hpp"
 #include "host_strided_batch_vector.hpp"
 #include "host_vector.hpp"
@@ -276,4 +276,25 @@ auto hipblas_gemm_dispatch(const Arguments& arg)
     return TEST<void>{}(arg);
 }
 
+// gemm_ex of complex half and bfloat16 matrices, computed in float, which have no client types:
+// TEST takes the type of the real and imaginary parts of A and B, and that of C
+template <template <typename...> class TEST>
+auto hipblas_gemm_complex_half_dispatch(const Arguments& arg)
+{
+    const auto Ti = arg.a_type, To = arg.c_type, Tc = arg.compute_type;
+
+    if(arg.b_type == Ti && arg.d_type == To && Tc == HIPBLAS_C_32F)
+    {
+        if(Ti == HIPBLAS_C_16F && To == Ti)
+            return TEST<hipblasHalf, hipblasHalf>{}(arg);
+        else if(Ti == HIPBLAS_C_16F && To == HIPBLAS_C_32F)
+            return TEST<hipblasHalf, float>{}(arg);
+        else if(Ti == HIPBLAS_C_16B && To == Ti)
+            return TEST<hipblasBfloat16, hipblasBfloat16>{}(arg);
+        else if(Ti == HIPBLAS_C_16B && To == HIPBLAS_C_32F)
+            return TEST<hipblasBfloat16, float>{}(arg);
+    }
+    return TEST<void>{}(arg);
+}
+
 #endif
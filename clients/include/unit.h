@@ -25,6 +25,9 @@
 #ifndef _UNIT_H
 #define _UNIT_H
 
+#include "device_matrix.hpp"
+#include "device_reference.hpp"
+#include "device_strided_batch_matrix.hpp"
 #include "hipblas.h"
 #include "host_vector.hpp"
 
@@ -72,6 +75,65 @@ void unit_check_general(int64_t        M,
                         host_vector<T> hCPU[],
                         host_vector<T> hGPU[]);
 
+/*! \brief Template: gtest unit compare of two matrices on the device, compared on the device so
+ *         that only the largest error and the first mismatches are copied back. The elements
+ *         match within 4 units in the last place, like ASSERT_FLOAT_EQ and ASSERT_DOUBLE_EQ */
+template <typename T>
+void unit_check_device(int64_t       M,
+                       int64_t       N,
+                       int64_t       batch_count,
+                       const T*      dCPU,
+                       int64_t       ld_cpu,
+                       hipblasStride stride_cpu,
+                       const T*      dGPU,
+                       int64_t       ld_gpu,
+                       hipblasStride stride_gpu)
+{
+#ifdef GOOGLE_TEST
+    hipblas_device_check_result result;
+    ASSERT_EQ(hipblas_device_near_check(M,
+                                        N,
+                                        dCPU,
+                                        ld_cpu,
+                                        stride_cpu,
+                                        dGPU,
+                                        ld_gpu,
+                                        stride_gpu,
+                                        batch_count,
+                                        0.0,
+                                        true,
+                                        &result),
+              hipSuccess);
+    ASSERT_EQ(result.mismatches, 0) << hipblas_device_check_message(result);
+#endif
+}
+
+template <typename T>
+void unit_check_device(int64_t                 M,
+                       int64_t                 N,
+                       const device_matrix<T>& dCPU,
+                       const device_matrix<T>& dGPU)
+{
+    unit_check_device(M, N, 1, (const T*)dCPU, dCPU.lda(), 0, (const T*)dGPU, dGPU.lda(), 0);
+}
+
+template <typename T>
+void unit_check_device(int64_t                               M,
+                       int64_t                               N,
+                       const device_strided_batch_matrix<T>& dCPU,
+                       const device_strided_batch_matrix<T>& dGPU)
+{
+    unit_check_device(M,
+                      N,
+                      dGPU.batch_count(),
+                      dCPU.data(),
+                      dCPU.lda(),
+                      dCPU.stride(),
+                      dGPU.data(),
+                      dGPU.lda(),
+                      dGPU.stride());
+}
+
 template <typename T>
 void unit_check_error(T error, T tolerance)
 {
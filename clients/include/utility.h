@@ -35,6 +35,7 @@
 #include "hipblas_datatype2string.hpp"
 #include <cstdio>
 #include <iostream>
+#include <memory>
 #include <random>
 #include <vector>
 #endif
@@ -110,10 +111,14 @@ extern int64_t c_i32_overflow;
 using hipblas_rng_t = std::mt19937;
 extern hipblas_rng_t hipblas_rng, hipblas_seed;
 
+// The seed of the next matrix or vector initialized by hipblas_counter_rng, one per thread
+extern thread_local uint64_t hipblas_counter_seed;
+
 // Reset the seed (mainly to ensure repeatability of failures in a given suite)
 inline void hipblas_seedrand()
 {
-    hipblas_rng = hipblas_seed;
+    hipblas_rng          = hipblas_seed;
+    hipblas_counter_seed = 0;
 }
 
 class hipblas_nan_rng
@@ -528,10 +533,15 @@ struct Arguments;
 
 /* ============================================================================================ */
 /*! \brief  local handle which is automatically created and destroyed  */
+// the stream of the handles of this thread whose arg.own_stream is set, for the streams that the
+// threads of hipblas-bench --streams share. With nullptr, each of them creates a stream of its own
+void hipblas_set_thread_stream(hipStream_t stream);
+
 class hipblasLocalHandle
 {
     hipblasHandle_t m_handle;
     void*           m_memory = nullptr;
+    hipStream_t     m_stream = nullptr;
 
 public:
     hipblasLocalHandle();
@@ -545,6 +555,10 @@ public:
     hipblasLocalHandle& operator=(const hipblasLocalHandle&) = delete;
     hipblasLocalHandle& operator=(hipblasLocalHandle&&) = delete;
 
+    // the handle of the last hipblasLocalHandle created from the arguments of a test on this
+    // thread, while it exists, or nullptr
+    static hipblasHandle_t current();
+
     // Allow hipblasLocalHandle to be used anywhere hipblas_handle is expected
     operator hipblasHandle_t&()
     {
@@ -556,6 +570,174 @@ public:
     }
 };
 
+/* ============================================================================================ */
+/*! \brief  timer of the hot iterations of a benchmark loop, with the timing mode of arg:
+ *          TIMING_SYNC, the host clock around a stream synchronize over all hot iterations;
+ *          TIMING_EVENTS, hip events around each hot iteration, which is GPU time only; and
+ *          TIMING_HOST, the host clock around each call without synchronizing, which is the
+ *          time the API takes to return. start and stop are called around each iteration,
+ *          and the cold iterations aren't timed. With arg.report_percentiles, TIMING_SYNC
+ *          synchronizes around each iteration too, so that all modes have the time of each.
+ *          With arg.flush_cache, start overwrites a buffer larger than the last level cache
+ *          before each iteration, outside of the time of the iteration. With arg.graph, the hot
+ *          iterations are captured into a HIP graph instead of run, and elapsed_us is the mean
+ *          time of its replays, measured with hip events. With arg.telemetry, the power, clocks
+ *          and temperature of the device are sampled over the hot iterations. The hardware counters
+ *          selected with hipblas-bench --counters are collected over them too. With
+ *          arg.memory_footprint, the first cold iteration is a dry run in the workspace query
+ *          mode of the handle of the test, and the free device memory is sampled around the
+ *          cold iterations and after the loop. */
+class hipblas_telemetry;
+class hipblas_counters;
+
+// the device memory of the last loop timed by this thread with arg.memory_footprint, in bytes, with
+// -1 for what couldn't be measured
+struct hipblas_memory_footprint
+{
+    int64_t operand_bytes   = -1; // the client allocations in use on the device at the loop start
+    int64_t workspace_bytes = -1; // the workspace the first cold call asked for in query mode
+    int64_t growth_bytes    = -1; // the largest drop of the free device memory during the loop
+};
+
+class hipblas_iteration_timer
+{
+    int                     m_mode;
+    int                     m_cold_iters;
+    int                     m_iters;
+    bool                    m_graph;
+    hipGraphExec_t          m_graph_exec = nullptr;
+    bool                    m_each_iteration;
+    hipStream_t             m_stream;
+    double                  m_start_us = 0;
+    std::vector<double>     m_iteration_us;
+    std::vector<hipEvent_t> m_events;
+    void*                   m_flush       = nullptr;
+    size_t                  m_flush_bytes = 0;
+    int                     m_device      = 0;
+
+    std::unique_ptr<hipblas_telemetry> m_telemetry;
+    std::unique_ptr<hipblas_counters>  m_counters;
+
+    bool                     m_memory;
+    hipblasHandle_t          m_handle;
+    bool                     m_querying   = false;
+    size_t                   m_free_start = 0;
+    size_t                   m_free_min   = 0;
+    hipblas_memory_footprint m_footprint;
+
+    void memory_begin();
+    void memory_sample(int iter);
+
+public:
+    hipblas_iteration_timer(const Arguments& arg, hipStream_t stream);
+
+    ~hipblas_iteration_timer();
+
+    hipblas_iteration_timer(const hipblas_iteration_timer&) = delete;
+    hipblas_iteration_timer& operator=(const hipblas_iteration_timer&) = delete;
+
+    void start(int iter);
+
+    void stop(int iter);
+
+    // total time of the hot iterations in microseconds
+    double elapsed_us();
+
+    // the time of each hot iteration of the last loop of this thread, empty if its iterations
+    // weren't timed one by one
+    static const std::vector<double>& last_iteration_us();
+
+    // the device memory of the last loop of this thread timed with arg.memory_footprint
+    static const hipblas_memory_footprint& last_memory_footprint();
+};
+
+/*! \brief  the start barrier and shared timing window of hipblas-bench --parallel_devices. While
+ *          it is open, the timer of each party waits at its first hot iteration until all parties
+ *          reach theirs, and the window lasts from their release until the last of their timing
+ *          loops ends. A party that returns without reaching a timing loop must leave, so that
+ *          the others don't wait for it. Only the first timing loop of a party takes part. */
+class hipblas_bench_window
+{
+public:
+    static void open(int parties);
+
+    // the length of the window in microseconds
+    static double close();
+
+    // called by hipblas_iteration_timer, no-ops while the window is closed
+    static void arrive(hipStream_t stream);
+    static void finish(hipStream_t stream);
+
+    static void leave();
+};
+
+/*! \brief  copies of the device operands of a benchmark for --rotating, cycled through across the
+ *          iterations so that together they are at least arg.rotating MB and don't stay in the
+ *          last level cache. The first copy is the operands themselves, and the others start
+ *          with the same contents. Without arg.rotating there are no other copies. */
+class hipblas_rotating_buffers
+{
+    struct operand
+    {
+        const char* data;
+        size_t      bytes;
+        size_t      offset;
+    };
+
+    std::vector<operand> m_operands;
+    std::vector<char*>   m_copies;
+
+    void  allocate(const Arguments& arg);
+    void* copy_of(const void* data, int iter) const;
+
+    template <template <typename> class D, typename T>
+    static operand describe(const D<T>& v)
+    {
+        return {reinterpret_cast<const char*>(static_cast<const T*>(v)), v.nmemb() * sizeof(T), 0};
+    }
+
+public:
+    template <typename... D>
+    explicit hipblas_rotating_buffers(const Arguments& arg, const D&... operands)
+        : m_operands{describe(operands)...}
+    {
+        allocate(arg);
+    }
+
+    ~hipblas_rotating_buffers();
+
+    hipblas_rotating_buffers(const hipblas_rotating_buffers&) = delete;
+    hipblas_rotating_buffers& operator=(const hipblas_rotating_buffers&) = delete;
+
+    // the copy of operand for iteration iter
+    template <template <typename> class D, typename T>
+    T* operator()(D<T>& operand, int iter) const
+    {
+        return static_cast<T*>(copy_of(static_cast<T*>(operand), iter));
+    }
+};
+
+/*! \brief  the roofline of the current device for --roofline: the dense peak throughput of each
+ *          data type, from the clock and compute units of the device properties and the rate of
+ *          its architecture, and the bandwidth of device memory, measured with device to device
+ *          copies. A peak is 0 for an architecture that isn't in the table. */
+struct hipblas_device_roofline
+{
+    std::string arch;
+    double      fp64_gflops = 0;
+    double      fp32_gflops = 0;
+    double      fp16_gflops = 0;
+    double      bf16_gflops = 0;
+    double      int8_gops   = 0;
+    double      GBps        = 0;
+
+    // the peak of the data type of the operands, 0 if it isn't known
+    double peak_gflops(hipblasDatatype_t a_type) const;
+
+    // the roofline of the current device, measured the first time it is asked for
+    static const hipblas_device_roofline& current();
+};
+
 hipblasStatus_t hipblas_internal_convert_hip_to_hipblas_status(hipError_t status);
 
 hipblasStatus_t hipblas_internal_convert_hip_to_hipblas_status_and_log(hipError_t status);
@@ -0,0 +1,436 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+//! HIP = Heterogeneous-compute Interface for Portability
+//!
+//! A header-only C++17 interface to hipBLAS. The type of the operands selects the function and
+//! the hipDataType and hipblasComputeType_t arguments at compile time, and a type without a
+//! function is a compile error instead of a status returned at run time. The functions return the
+//! hipblasStatus_t of the C function they call and never throw.
+
+#ifndef HIPBLAS_CXX_HPP
+#define HIPBLAS_CXX_HPP
+
+#if __cplusplus < 201703L && (!defined(_MSVC_LANG) || _MSVC_LANG < 201703L)
+#error "hipblas_cxx.hpp requires C++17"
+#endif
+
+#include "hipblas.h"
+
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace hipblas
+{
+    /*! \brief The hipDataType of an operand type, for the Ex functions */
+    template <typename T>
+    struct data_type;
+
+    template <>
+    struct data_type<hipblasHalf>
+    {
+        static constexpr hipDataType value = HIP_R_16F;
+    };
+
+    template <>
+    struct data_type<hipblasBfloat16>
+    {
+        static constexpr hipDataType value = HIP_R_16BF;
+    };
+
+    template <>
+    struct data_type<float>
+    {
+        static constexpr hipDataType value = HIP_R_32F;
+    };
+
+    template <>
+    struct data_type<double>
+    {
+        static constexpr hipDataType value = HIP_R_64F;
+    };
+
+    template <>
+    struct data_type<hipComplex>
+    {
+        static constexpr hipDataType value = HIP_C_32F;
+    };
+
+    template <>
+    struct data_type<hipDoubleComplex>
+    {
+        static constexpr hipDataType value = HIP_C_64F;
+    };
+
+    template <>
+    struct data_type<int8_t>
+    {
+        static constexpr hipDataType value = HIP_R_8I;
+    };
+
+    template <>
+    struct data_type<int32_t>
+    {
+        static constexpr hipDataType value = HIP_R_32I;
+    };
+
+    template <typename T>
+    inline constexpr hipDataType data_type_v = data_type<T>::value;
+
+    /*! \brief The hipblasComputeType_t of a compute type, for the Ex functions
+
+        \details
+        The compute type is that of the accumulation: float for HIPBLAS_COMPUTE_32F, including
+        complex single precision operands, double for HIPBLAS_COMPUTE_64F, hipblasHalf for
+        HIPBLAS_COMPUTE_16F and int32_t for HIPBLAS_COMPUTE_32I.
+     ********************************************************************/
+    template <typename Compute>
+    struct compute_type;
+
+    template <>
+    struct compute_type<hipblasHalf>
+    {
+        static constexpr hipblasComputeType_t value = HIPBLAS_COMPUTE_16F;
+    };
+
+    template <>
+    struct compute_type<float>
+    {
+        static constexpr hipblasComputeType_t value = HIPBLAS_COMPUTE_32F;
+    };
+
+    template <>
+    struct compute_type<double>
+    {
+        static constexpr hipblasComputeType_t value = HIPBLAS_COMPUTE_64F;
+    };
+
+    template <>
+    struct compute_type<int32_t>
+    {
+        static constexpr hipblasComputeType_t value = HIPBLAS_COMPUTE_32I;
+    };
+
+    template <typename Compute>
+    inline constexpr hipblasComputeType_t compute_type_v = compute_type<Compute>::value;
+
+    namespace detail
+    {
+        template <typename T>
+        inline constexpr bool dependent_false = false;
+    }
+
+    /*! \brief gemm of the typed function of T, hipblasHgemm, hipblasSgemm, hipblasDgemm,
+        hipblasCgemm_v2 or hipblasZgemm_v2
+     ********************************************************************/
+    template <typename T>
+    inline hipblasStatus_t gemm(hipblasHandle_t    handle,
+                                hipblasOperation_t transA,
+                                hipblasOperation_t transB,
+                                int                m,
+                                int                n,
+                                int                k,
+                                const T*           alpha,
+                                const T*           A,
+                                int                lda,
+                                const T*           B,
+                                int                ldb,
+                                const T*           beta,
+                                T*                 C,
+                                int                ldc)
+    {
+        if constexpr(std::is_same_v<T, hipblasHalf>)
+            return hipblasHgemm(
+                handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+        else if constexpr(std::is_same_v<T, float>)
+            return hipblasSgemm(
+                handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+        else if constexpr(std::is_same_v<T, double>)
+            return hipblasDgemm(
+                handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+        else if constexpr(std::is_same_v<T, hipComplex>)
+            return hipblasCgemm_v2(
+                handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+        else if constexpr(std::is_same_v<T, hipDoubleComplex>)
+            return hipblasZgemm_v2(
+                handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+        else
+            static_assert(detail::dependent_false<T>, "hipblas::gemm has no function of this type");
+    }
+
+    /*! \brief strided batched gemm of the typed function of T
+     ********************************************************************/
+    template <typename T>
+    inline hipblasStatus_t gemm_strided_batched(hipblasHandle_t    handle,
+                                                hipblasOperation_t transA,
+                                                hipblasOperation_t transB,
+                                                int                m,
+                                                int                n,
+                                                int                k,
+                                                const T*           alpha,
+                                                const T*           A,
+                                                int                lda,
+                                                hipblasStride      strideA,
+                                                const T*           B,
+                                                int                ldb,
+                                                hipblasStride      strideB,
+                                                const T*           beta,
+                                                T*                 C,
+                                                int                ldc,
+                                                hipblasStride      strideC,
+                                                int                batchCount)
+    {
+        auto call = [&](auto fn) {
+            return fn(handle,
+                      transA,
+                      transB,
+                      m,
+                      n,
+                      k,
+                      alpha,
+                      A,
+                      lda,
+                      strideA,
+                      B,
+                      ldb,
+                      strideB,
+                      beta,
+                      C,
+                      ldc,
+                      strideC,
+                      batchCount);
+        };
+
+        if constexpr(std::is_same_v<T, hipblasHalf>)
+            return call(hipblasHgemmStridedBatched);
+        else if constexpr(std::is_same_v<T, float>)
+            return call(hipblasSgemmStridedBatched);
+        else if constexpr(std::is_same_v<T, double>)
+            return call(hipblasDgemmStridedBatched);
+        else if constexpr(std::is_same_v<T, hipComplex>)
+            return call(hipblasCgemmStridedBatched_v2);
+        else if constexpr(std::is_same_v<T, hipDoubleComplex>)
+            return call(hipblasZgemmStridedBatched_v2);
+        else
+            static_assert(detail::dependent_false<T>,
+                          "hipblas::gemm_strided_batched has no function of this type");
+    }
+
+    /*! \brief hipblasGemmEx_v2 with the types of A, B and C and the compute type given as
+        template arguments
+
+        \details
+        alpha and beta are of type Compute, or of type TC when it is complex.
+     ********************************************************************/
+    template <typename TA, typename TB, typename TC, typename Compute, typename Tscalar>
+    inline hipblasStatus_t gemm_ex(hipblasHandle_t    handle,
+                                   hipblasOperation_t transA,
+                                   hipblasOperation_t transB,
+                                   int                m,
+                                   int                n,
+                                   int                k,
+                                   const Tscalar*     alpha,
+                                   const TA*          A,
+                                   int                lda,
+                                   const TB*          B,
+                                   int                ldb,
+                                   const Tscalar*     beta,
+                                   TC*                C,
+                                   int                ldc,
+                                   hipblasGemmAlgo_t  algo = HIPBLAS_GEMM_DEFAULT)
+    {
+        return hipblasGemmEx_v2(handle,
+                                transA,
+                                transB,
+                                m,
+                                n,
+                                k,
+                                alpha,
+                                A,
+                                data_type_v<TA>,
+                                lda,
+                                B,
+                                data_type_v<TB>,
+                                ldb,
+                                beta,
+                                C,
+                                data_type_v<TC>,
+                                ldc,
+                                compute_type_v<Compute>,
+                                algo);
+    }
+
+    /*! \brief hipblasGemmStridedBatchedEx_v2 with the types of A, B and C and the compute type
+        given as template arguments
+     ********************************************************************/
+    template <typename TA, typename TB, typename TC, typename Compute, typename Tscalar>
+    inline hipblasStatus_t gemm_strided_batched_ex(hipblasHandle_t    handle,
+                                                   hipblasOperation_t transA,
+                                                   hipblasOperation_t transB,
+                                                   int                m,
+                                                   int                n,
+                                                   int                k,
+                                                   const Tscalar*     alpha,
+                                                   const TA*          A,
+                                                   int                lda,
+                                                   hipblasStride      strideA,
+                                                   const TB*          B,
+                                                   int                ldb,
+                                                   hipblasStride      strideB,
+                                                   const Tscalar*     beta,
+                                                   TC*                C,
+                                                   int                ldc,
+                                                   hipblasStride      strideC,
+                                                   int                batchCount,
+                                                   hipblasGemmAlgo_t  algo = HIPBLAS_GEMM_DEFAULT)
+    {
+        return hipblasGemmStridedBatchedEx_v2(handle,
+                                              transA,
+                                              transB,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              data_type_v<TA>,
+                                              lda,
+                                              strideA,
+                                              B,
+                                              data_type_v<TB>,
+                                              ldb,
+                                              strideB,
+                                              beta,
+                                              C,
+                                              data_type_v<TC>,
+                                              ldc,
+                                              strideC,
+                                              batchCount,
+                                              compute_type_v<Compute>,
+                                              algo);
+    }
+
+    /*! \brief The exception thrown by the constructor of handle */
+    class error : public std::runtime_error
+    {
+    public:
+        explicit error(hipblasStatus_t status)
+            : std::runtime_error(hipblasStatusToString(status))
+            , m_status(status)
+        {
+        }
+
+        hipblasStatus_t status() const noexcept
+        {
+            return m_status;
+        }
+
+    private:
+        hipblasStatus_t m_status;
+    };
+
+    /*! \brief An owned hipblasHandle_t, created by the constructor and destroyed by the
+        destructor
+
+        \details
+        It converts to hipblasHandle_t, for the functions of this header and of hipblas.h. The
+        constructor throws hipblas::error when hipblasCreate fails.
+     ********************************************************************/
+    class handle
+    {
+    public:
+        handle()
+        {
+            hipblasStatus_t status = hipblasCreate(&m_handle);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                throw error(status);
+        }
+
+        handle(const handle&)            = delete;
+        handle& operator=(const handle&) = delete;
+
+        handle(handle&& other) noexcept
+            : m_handle(std::exchange(other.m_handle, nullptr))
+        {
+        }
+
+        handle& operator=(handle&& other) noexcept
+        {
+            if(this != &other)
+            {
+                if(m_handle)
+                    hipblasDestroy(m_handle);
+                m_handle = std::exchange(other.m_handle, nullptr);
+            }
+            return *this;
+        }
+
+        ~handle()
+        {
+            if(m_handle)
+                hipblasDestroy(m_handle);
+        }
+
+        hipblasHandle_t get() const noexcept
+        {
+            return m_handle;
+        }
+
+        operator hipblasHandle_t() const noexcept
+        {
+            return m_handle;
+        }
+
+    private:
+        hipblasHandle_t m_handle = nullptr;
+    };
+
+    /*! \brief Sets the stream of a handle for its lifetime, and restores the previous stream of
+        the handle when it is destroyed
+     ********************************************************************/
+    class stream_guard
+    {
+    public:
+        stream_guard(hipblasHandle_t handle, hipStream_t stream)
+            : m_handle(handle)
+        {
+            hipblasGetStream(m_handle, &m_previous);
+            hipblasSetStream(m_handle, stream);
+        }
+
+        stream_guard(const stream_guard&)            = delete;
+        stream_guard& operator=(const stream_guard&) = delete;
+
+        ~stream_guard()
+        {
+            hipblasSetStream(m_handle, m_previous);
+        }
+
+    private:
+        hipblasHandle_t m_handle;
+        hipStream_t     m_previous = nullptr;
+    };
+}
+
+#endif // HIPBLAS_CXX_HPP
@@ -0,0 +1,85 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#define HIPBLAS_BACKEND_LOADER
+#include "hipblas_backend.hpp"
+#include "hipblas.h"
+
+#include <dlfcn.h>
+
+// Loads library and looks up the functions of Table, or returns nullptr. The library is never
+// unloaded.
+template <typename Table, typename Lookup>
+static const Table* hipblasLoadFunctions(const char* name, Lookup&& lookup)
+{
+    void* library = dlopen(name, RTLD_NOW | RTLD_LOCAL);
+    if(!library)
+        return nullptr;
+
+    auto* table = new Table;
+    if(!lookup(library, *table))
+    {
+        delete table;
+        return nullptr;
+    }
+    return table;
+}
+
+#define HIPBLAS_LOOKUP_FUNCTION(name)                                                  \
+    if(!(table.name = reinterpret_cast<decltype(table.name)>(dlsym(library, #name)))) \
+        return false;
+
+std::atomic<const hipblasRocblasFunctions*> hipblas_rocblas_functions{nullptr};
+
+const hipblasRocblasFunctions& hipblasLoadRocblas()
+{
+    static const hipblasRocblasFunctions* functions
+        = hipblasLoadFunctions<hipblasRocblasFunctions>(
+            HIPBLAS_ROCBLAS_LIBRARY, [](void* library, hipblasRocblasFunctions& table) {
+                HIPBLAS_ROCBLAS_FUNCTIONS(HIPBLAS_LOOKUP_FUNCTION)
+                return true;
+            });
+    if(!functions)
+        throw HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_rocblas_functions.store(functions, std::memory_order_release);
+    return *functions;
+}
+
+#ifdef __HIP_PLATFORM_SOLVER__
+std::atomic<const hipblasRocsolverFunctions*> hipblas_rocsolver_functions{nullptr};
+
+const hipblasRocsolverFunctions& hipblasLoadRocsolver()
+{
+    static const hipblasRocsolverFunctions* functions
+        = hipblasLoadFunctions<hipblasRocsolverFunctions>(
+            HIPBLAS_ROCSOLVER_LIBRARY, [](void* library, hipblasRocsolverFunctions& table) {
+                HIPBLAS_ROCSOLVER_FUNCTIONS(HIPBLAS_LOOKUP_FUNCTION)
+                return true;
+            });
+    if(!functions)
+        throw HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_rocsolver_functions.store(functions, std::memory_order_release);
+    return *functions;
+}
+#endif
@@ -0,0 +1,2746 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+// The rocBLAS and rocSOLVER functions called by the rocBLAS backend.
+//
+// hipBLAS built with BUILD_WITH_LAZY_BACKEND isn't linked to rocBLAS and rocSOLVER. The first
+// call of a rocBLAS function loads rocBLAS with dlopen and looks up the functions listed below,
+// and the first call of a rocSOLVER function does the same for rocSOLVER, so a process that
+// doesn't use hipBLAS doesn't load them. Each listed name is then a macro calling through the
+// table of its library, and the backend code is the same in both builds. A function of hipBLAS
+// returns HIPBLAS_STATUS_NOT_INITIALIZED if the library it needs can't be loaded, or lacks one of
+// the functions.
+//
+// A rocBLAS or rocSOLVER function called by the backend must be added to these lists.
+
+#define ROCBLAS_NO_DEPRECATED_WARNINGS
+#define ROCBLAS_BETA_FEATURES_API
+#include "rocblas/rocblas.h"
+#ifdef __HIP_PLATFORM_SOLVER__
+#include "rocsolver/rocsolver.h"
+
+// The following functions are not included in the public API and must be declared
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+rocblas_status rocsolver_sgeqrf_ptr_batched(rocblas_handle    handle,
+                                            const rocblas_int m,
+                                            const rocblas_int n,
+                                            float* const      A[],
+                                            const rocblas_int lda,
+                                            float* const      ipiv[],
+                                            const rocblas_int batch_count);
+
+rocblas_status rocsolver_dgeqrf_ptr_batched(rocblas_handle    handle,
+                                            const rocblas_int m,
+                                            const rocblas_int n,
+                                            double* const     A[],
+                                            const rocblas_int lda,
+                                            double* const     ipiv[],
+                                            const rocblas_int batch_count);
+
+rocblas_status rocsolver_cgeqrf_ptr_batched(rocblas_handle               handle,
+                                            const rocblas_int            m,
+                                            const rocblas_int            n,
+                                            rocblas_float_complex* const A[],
+                                            const rocblas_int            lda,
+                                            rocblas_float_complex* const ipiv[],
+                                            const rocblas_int            batch_count);
+
+rocblas_status rocsolver_zgeqrf_ptr_batched(rocblas_handle                handle,
+                                            const rocblas_int             m,
+                                            const rocblas_int             n,
+                                            rocblas_double_complex* const A[],
+                                            const rocblas_int             lda,
+                                            rocblas_double_complex* const ipiv[],
+                                            const rocblas_int             batch_count);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
+
+#define HIPBLAS_ROCBLAS_FUNCTIONS(X) \
+    X(rocblas_axpy_batched_ex) \
+    X(rocblas_axpy_batched_ex_64) \
+    X(rocblas_axpy_ex) \
+    X(rocblas_axpy_ex_64) \
+    X(rocblas_axpy_strided_batched_ex) \
+    X(rocblas_axpy_strided_batched_ex_64) \
+    X(rocblas_bfdot) \
+    X(rocblas_bfdot_64) \
+    X(rocblas_bfdot_batched) \
+    X(rocblas_bfdot_batched_64) \
+    X(rocblas_bfdot_strided_batched) \
+    X(rocblas_bfdot_strided_batched_64) \
+    X(rocblas_caxpy) \
+    X(rocblas_caxpy_64) \
+    X(rocblas_caxpy_batched) \
+    X(rocblas_caxpy_batched_64) \
+    X(rocblas_caxpy_strided_batched) \
+    X(rocblas_caxpy_strided_batched_64) \
+    X(rocblas_ccopy) \
+    X(rocblas_ccopy_64) \
+    X(rocblas_ccopy_batched) \
+    X(rocblas_ccopy_batched_64) \
+    X(rocblas_ccopy_strided_batched) \
+    X(rocblas_ccopy_strided_batched_64) \
+    X(rocblas_cdgmm) \
+    X(rocblas_cdgmm_64) \
+    X(rocblas_cdgmm_batched) \
+    X(rocblas_cdgmm_batched_64) \
+    X(rocblas_cdgmm_strided_batched) \
+    X(rocblas_cdgmm_strided_batched_64) \
+    X(rocblas_cdotc) \
+    X(rocblas_cdotc_64) \
+    X(rocblas_cdotc_batched) \
+    X(rocblas_cdotc_batched_64) \
+    X(rocblas_cdotc_strided_batched) \
+    X(rocblas_cdotc_strided_batched_64) \
+    X(rocblas_cdotu) \
+    X(rocblas_cdotu_64) \
+    X(rocblas_cdotu_batched) \
+    X(rocblas_cdotu_batched_64) \
+    X(rocblas_cdotu_strided_batched) \
+    X(rocblas_cdotu_strided_batched_64) \
+    X(rocblas_cgbmv) \
+    X(rocblas_cgbmv_64) \
+    X(rocblas_cgbmv_batched) \
+    X(rocblas_cgbmv_batched_64) \
+    X(rocblas_cgbmv_strided_batched) \
+    X(rocblas_cgbmv_strided_batched_64) \
+    X(rocblas_cgeam) \
+    X(rocblas_cgeam_64) \
+    X(rocblas_cgeam_batched) \
+    X(rocblas_cgeam_batched_64) \
+    X(rocblas_cgeam_strided_batched) \
+    X(rocblas_cgeam_strided_batched_64) \
+    X(rocblas_cgemm) \
+    X(rocblas_cgemm_64) \
+    X(rocblas_cgemm_batched) \
+    X(rocblas_cgemm_batched_64) \
+    X(rocblas_cgemm_strided_batched) \
+    X(rocblas_cgemm_strided_batched_64) \
+    X(rocblas_cgemv) \
+    X(rocblas_cgemv_64) \
+    X(rocblas_cgemv_batched) \
+    X(rocblas_cgemv_batched_64) \
+    X(rocblas_cgemv_strided_batched) \
+    X(rocblas_cgemv_strided_batched_64) \
+    X(rocblas_cgerc) \
+    X(rocblas_cgerc_64) \
+    X(rocblas_cgerc_batched) \
+    X(rocblas_cgerc_batched_64) \
+    X(rocblas_cgerc_strided_batched) \
+    X(rocblas_cgerc_strided_batched_64) \
+    X(rocblas_cgeru) \
+    X(rocblas_cgeru_64) \
+    X(rocblas_cgeru_batched) \
+    X(rocblas_cgeru_batched_64) \
+    X(rocblas_cgeru_strided_batched) \
+    X(rocblas_cgeru_strided_batched_64) \
+    X(rocblas_chbmv) \
+    X(rocblas_chbmv_64) \
+    X(rocblas_chbmv_batched) \
+    X(rocblas_chbmv_batched_64) \
+    X(rocblas_chbmv_strided_batched) \
+    X(rocblas_chbmv_strided_batched_64) \
+    X(rocblas_chemm) \
+    X(rocblas_chemm_64) \
+    X(rocblas_chemm_batched) \
+    X(rocblas_chemm_batched_64) \
+    X(rocblas_chemm_strided_batched) \
+    X(rocblas_chemm_strided_batched_64) \
+    X(rocblas_chemv) \
+    X(rocblas_chemv_64) \
+    X(rocblas_chemv_batched) \
+    X(rocblas_chemv_batched_64) \
+    X(rocblas_chemv_strided_batched) \
+    X(rocblas_chemv_strided_batched_64) \
+    X(rocblas_cher) \
+    X(rocblas_cher2) \
+    X(rocblas_cher2_64) \
+    X(rocblas_cher2_batched) \
+    X(rocblas_cher2_batched_64) \
+    X(rocblas_cher2_strided_batched) \
+    X(rocblas_cher2_strided_batched_64) \
+    X(rocblas_cher2k) \
+    X(rocblas_cher2k_64) \
+    X(rocblas_cher2k_batched) \
+    X(rocblas_cher2k_batched_64) \
+    X(rocblas_cher2k_strided_batched) \
+    X(rocblas_cher2k_strided_batched_64) \
+    X(rocblas_cher_64) \
+    X(rocblas_cher_batched) \
+    X(rocblas_cher_batched_64) \
+    X(rocblas_cher_strided_batched) \
+    X(rocblas_cher_strided_batched_64) \
+    X(rocblas_cherk) \
+    X(rocblas_cherk_64) \
+    X(rocblas_cherk_batched) \
+    X(rocblas_cherk_batched_64) \
+    X(rocblas_cherk_strided_batched) \
+    X(rocblas_cherk_strided_batched_64) \
+    X(rocblas_cherkx) \
+    X(rocblas_cherkx_64) \
+    X(rocblas_cherkx_batched) \
+    X(rocblas_cherkx_batched_64) \
+    X(rocblas_cherkx_strided_batched) \
+    X(rocblas_cherkx_strided_batched_64) \
+    X(rocblas_chpmv) \
+    X(rocblas_chpmv_64) \
+    X(rocblas_chpmv_batched) \
+    X(rocblas_chpmv_batched_64) \
+    X(rocblas_chpmv_strided_batched) \
+    X(rocblas_chpmv_strided_batched_64) \
+    X(rocblas_chpr) \
+    X(rocblas_chpr2) \
+    X(rocblas_chpr2_64) \
+    X(rocblas_chpr2_batched) \
+    X(rocblas_chpr2_batched_64) \
+    X(rocblas_chpr2_strided_batched) \
+    X(rocblas_chpr2_strided_batched_64) \
+    X(rocblas_chpr_64) \
+    X(rocblas_chpr_batched) \
+    X(rocblas_chpr_batched_64) \
+    X(rocblas_chpr_strided_batched) \
+    X(rocblas_chpr_strided_batched_64) \
+    X(rocblas_create_handle) \
+    X(rocblas_crot) \
+    X(rocblas_crot_64) \
+    X(rocblas_crot_batched) \
+    X(rocblas_crot_batched_64) \
+    X(rocblas_crot_strided_batched) \
+    X(rocblas_crot_strided_batched_64) \
+    X(rocblas_crotg) \
+    X(rocblas_crotg_64) \
+    X(rocblas_crotg_batched) \
+    X(rocblas_crotg_batched_64) \
+    X(rocblas_crotg_strided_batched) \
+    X(rocblas_crotg_strided_batched_64) \
+    X(rocblas_cscal) \
+    X(rocblas_cscal_64) \
+    X(rocblas_cscal_batched) \
+    X(rocblas_cscal_batched_64) \
+    X(rocblas_cscal_strided_batched) \
+    X(rocblas_cscal_strided_batched_64) \
+    X(rocblas_cspr) \
+    X(rocblas_cspr_64) \
+    X(rocblas_cspr_batched) \
+    X(rocblas_cspr_batched_64) \
+    X(rocblas_cspr_strided_batched) \
+    X(rocblas_cspr_strided_batched_64) \
+    X(rocblas_csrot) \
+    X(rocblas_csrot_64) \
+    X(rocblas_csrot_batched) \
+    X(rocblas_csrot_batched_64) \
+    X(rocblas_csrot_strided_batched) \
+    X(rocblas_csrot_strided_batched_64) \
+    X(rocblas_csscal) \
+    X(rocblas_csscal_64) \
+    X(rocblas_csscal_batched) \
+    X(rocblas_csscal_batched_64) \
+    X(rocblas_csscal_strided_batched) \
+    X(rocblas_csscal_strided_batched_64) \
+    X(rocblas_cswap) \
+    X(rocblas_cswap_64) \
+    X(rocblas_cswap_batched) \
+    X(rocblas_cswap_batched_64) \
+    X(rocblas_cswap_strided_batched) \
+    X(rocblas_cswap_strided_batched_64) \
+    X(rocblas_csymm) \
+    X(rocblas_csymm_64) \
+    X(rocblas_csymm_batched) \
+    X(rocblas_csymm_batched_64) \
+    X(rocblas_csymm_strided_batched) \
+    X(rocblas_csymm_strided_batched_64) \
+    X(rocblas_csymv) \
+    X(rocblas_csymv_64) \
+    X(rocblas_csymv_batched) \
+    X(rocblas_csymv_batched_64) \
+    X(rocblas_csymv_strided_batched) \
+    X(rocblas_csymv_strided_batched_64) \
+    X(rocblas_csyr) \
+    X(rocblas_csyr2) \
+    X(rocblas_csyr2_64) \
+    X(rocblas_csyr2_batched) \
+    X(rocblas_csyr2_batched_64) \
+    X(rocblas_csyr2_strided_batched) \
+    X(rocblas_csyr2_strided_batched_64) \
+    X(rocblas_csyr2k) \
+    X(rocblas_csyr2k_64) \
+    X(rocblas_csyr2k_batched) \
+    X(rocblas_csyr2k_batched_64) \
+    X(rocblas_csyr2k_strided_batched) \
+    X(rocblas_csyr2k_strided_batched_64) \
+    X(rocblas_csyr_64) \
+    X(rocblas_csyr_batched) \
+    X(rocblas_csyr_batched_64) \
+    X(rocblas_csyr_strided_batched) \
+    X(rocblas_csyr_strided_batched_64) \
+    X(rocblas_csyrk) \
+    X(rocblas_csyrk_64) \
+    X(rocblas_csyrk_batched) \
+    X(rocblas_csyrk_batched_64) \
+    X(rocblas_csyrk_strided_batched) \
+    X(rocblas_csyrk_strided_batched_64) \
+    X(rocblas_csyrkx) \
+    X(rocblas_csyrkx_64) \
+    X(rocblas_csyrkx_batched) \
+    X(rocblas_csyrkx_batched_64) \
+    X(rocblas_csyrkx_strided_batched) \
+    X(rocblas_csyrkx_strided_batched_64) \
+    X(rocblas_ctbmv) \
+    X(rocblas_ctbmv_64) \
+    X(rocblas_ctbmv_batched) \
+    X(rocblas_ctbmv_batched_64) \
+    X(rocblas_ctbmv_strided_batched) \
+    X(rocblas_ctbmv_strided_batched_64) \
+    X(rocblas_ctbsv) \
+    X(rocblas_ctbsv_64) \
+    X(rocblas_ctbsv_batched) \
+    X(rocblas_ctbsv_batched_64) \
+    X(rocblas_ctbsv_strided_batched) \
+    X(rocblas_ctbsv_strided_batched_64) \
+    X(rocblas_ctpmv) \
+    X(rocblas_ctpmv_64) \
+    X(rocblas_ctpmv_batched) \
+    X(rocblas_ctpmv_batched_64) \
+    X(rocblas_ctpmv_strided_batched) \
+    X(rocblas_ctpmv_strided_batched_64) \
+    X(rocblas_ctpsv) \
+    X(rocblas_ctpsv_64) \
+    X(rocblas_ctpsv_batched) \
+    X(rocblas_ctpsv_batched_64) \
+    X(rocblas_ctpsv_strided_batched) \
+    X(rocblas_ctpsv_strided_batched_64) \
+    X(rocblas_ctrmm) \
+    X(rocblas_ctrmm_64) \
+    X(rocblas_ctrmm_batched) \
+    X(rocblas_ctrmm_batched_64) \
+    X(rocblas_ctrmm_strided_batched) \
+    X(rocblas_ctrmm_strided_batched_64) \
+    X(rocblas_ctrmv) \
+    X(rocblas_ctrmv_64) \
+    X(rocblas_ctrmv_batched) \
+    X(rocblas_ctrmv_batched_64) \
+    X(rocblas_ctrmv_strided_batched) \
+    X(rocblas_ctrmv_strided_batched_64) \
+    X(rocblas_ctrsm) \
+    X(rocblas_ctrsm_64) \
+    X(rocblas_ctrsm_batched) \
+    X(rocblas_ctrsm_batched_64) \
+    X(rocblas_ctrsm_strided_batched) \
+    X(rocblas_ctrsm_strided_batched_64) \
+    X(rocblas_ctrsv) \
+    X(rocblas_ctrsv_64) \
+    X(rocblas_ctrsv_batched) \
+    X(rocblas_ctrsv_batched_64) \
+    X(rocblas_ctrsv_strided_batched) \
+    X(rocblas_ctrsv_strided_batched_64) \
+    X(rocblas_ctrtri) \
+    X(rocblas_ctrtri_batched) \
+    X(rocblas_ctrtri_strided_batched) \
+    X(rocblas_dasum) \
+    X(rocblas_dasum_64) \
+    X(rocblas_dasum_batched) \
+    X(rocblas_dasum_batched_64) \
+    X(rocblas_dasum_strided_batched) \
+    X(rocblas_dasum_strided_batched_64) \
+    X(rocblas_daxpy) \
+    X(rocblas_daxpy_64) \
+    X(rocblas_daxpy_batched) \
+    X(rocblas_daxpy_batched_64) \
+    X(rocblas_daxpy_strided_batched) \
+    X(rocblas_daxpy_strided_batched_64) \
+    X(rocblas_dcopy) \
+    X(rocblas_dcopy_64) \
+    X(rocblas_dcopy_batched) \
+    X(rocblas_dcopy_batched_64) \
+    X(rocblas_dcopy_strided_batched) \
+    X(rocblas_dcopy_strided_batched_64) \
+    X(rocblas_ddgmm) \
+    X(rocblas_ddgmm_64) \
+    X(rocblas_ddgmm_batched) \
+    X(rocblas_ddgmm_batched_64) \
+    X(rocblas_ddgmm_strided_batched) \
+    X(rocblas_ddgmm_strided_batched_64) \
+    X(rocblas_ddot) \
+    X(rocblas_ddot_64) \
+    X(rocblas_ddot_batched) \
+    X(rocblas_ddot_batched_64) \
+    X(rocblas_ddot_strided_batched) \
+    X(rocblas_ddot_strided_batched_64) \
+    X(rocblas_destroy_handle) \
+    X(rocblas_dgbmv) \
+    X(rocblas_dgbmv_64) \
+    X(rocblas_dgbmv_batched) \
+    X(rocblas_dgbmv_batched_64) \
+    X(rocblas_dgbmv_strided_batched) \
+    X(rocblas_dgbmv_strided_batched_64) \
+    X(rocblas_dgeam) \
+    X(rocblas_dgeam_64) \
+    X(rocblas_dgeam_batched) \
+    X(rocblas_dgeam_batched_64) \
+    X(rocblas_dgeam_strided_batched) \
+    X(rocblas_dgeam_strided_batched_64) \
+    X(rocblas_dgemm) \
+    X(rocblas_dgemm_64) \
+    X(rocblas_dgemm_batched) \
+    X(rocblas_dgemm_batched_64) \
+    X(rocblas_dgemm_strided_batched) \
+    X(rocblas_dgemm_strided_batched_64) \
+    X(rocblas_dgemv) \
+    X(rocblas_dgemv_64) \
+    X(rocblas_dgemv_batched) \
+    X(rocblas_dgemv_batched_64) \
+    X(rocblas_dgemv_strided_batched) \
+    X(rocblas_dgemv_strided_batched_64) \
+    X(rocblas_dger) \
+    X(rocblas_dger_64) \
+    X(rocblas_dger_batched) \
+    X(rocblas_dger_batched_64) \
+    X(rocblas_dger_strided_batched) \
+    X(rocblas_dger_strided_batched_64) \
+    X(rocblas_dnrm2) \
+    X(rocblas_dnrm2_64) \
+    X(rocblas_dnrm2_batched) \
+    X(rocblas_dnrm2_batched_64) \
+    X(rocblas_dnrm2_strided_batched) \
+    X(rocblas_dnrm2_strided_batched_64) \
+    X(rocblas_dot_batched_ex) \
+    X(rocblas_dot_batched_ex_64) \
+    X(rocblas_dot_ex) \
+    X(rocblas_dot_ex_64) \
+    X(rocblas_dot_strided_batched_ex) \
+    X(rocblas_dot_strided_batched_ex_64) \
+    X(rocblas_dotc_batched_ex) \
+    X(rocblas_dotc_batched_ex_64) \
+    X(rocblas_dotc_ex) \
+    X(rocblas_dotc_ex_64) \
+    X(rocblas_dotc_strided_batched_ex) \
+    X(rocblas_dotc_strided_batched_ex_64) \
+    X(rocblas_drot) \
+    X(rocblas_drot_64) \
+    X(rocblas_drot_batched) \
+    X(rocblas_drot_batched_64) \
+    X(rocblas_drot_strided_batched) \
+    X(rocblas_drot_strided_batched_64) \
+    X(rocblas_drotg) \
+    X(rocblas_drotg_64) \
+    X(rocblas_drotg_batched) \
+    X(rocblas_drotg_batched_64) \
+    X(rocblas_drotg_strided_batched) \
+    X(rocblas_drotg_strided_batched_64) \
+    X(rocblas_drotm) \
+    X(rocblas_drotm_64) \
+    X(rocblas_drotm_batched) \
+    X(rocblas_drotm_batched_64) \
+    X(rocblas_drotm_strided_batched) \
+    X(rocblas_drotm_strided_batched_64) \
+    X(rocblas_drotmg) \
+    X(rocblas_drotmg_64) \
+    X(rocblas_drotmg_batched) \
+    X(rocblas_drotmg_batched_64) \
+    X(rocblas_drotmg_strided_batched) \
+    X(rocblas_drotmg_strided_batched_64) \
+    X(rocblas_dsbmv) \
+    X(rocblas_dsbmv_64) \
+    X(rocblas_dsbmv_batched) \
+    X(rocblas_dsbmv_batched_64) \
+    X(rocblas_dsbmv_strided_batched) \
+    X(rocblas_dsbmv_strided_batched_64) \
+    X(rocblas_dscal) \
+    X(rocblas_dscal_64) \
+    X(rocblas_dscal_batched) \
+    X(rocblas_dscal_batched_64) \
+    X(rocblas_dscal_strided_batched) \
+    X(rocblas_dscal_strided_batched_64) \
+    X(rocblas_dspmv) \
+    X(rocblas_dspmv_64) \
+    X(rocblas_dspmv_batched) \
+    X(rocblas_dspmv_batched_64) \
+    X(rocblas_dspmv_strided_batched) \
+    X(rocblas_dspmv_strided_batched_64) \
+    X(rocblas_dspr) \
+    X(rocblas_dspr2) \
+    X(rocblas_dspr2_64) \
+    X(rocblas_dspr2_batched) \
+    X(rocblas_dspr2_batched_64) \
+    X(rocblas_dspr2_strided_batched) \
+    X(rocblas_dspr2_strided_batched_64) \
+    X(rocblas_dspr_64) \
+    X(rocblas_dspr_batched) \
+    X(rocblas_dspr_batched_64) \
+    X(rocblas_dspr_strided_batched) \
+    X(rocblas_dspr_strided_batched_64) \
+    X(rocblas_dswap) \
+    X(rocblas_dswap_64) \
+    X(rocblas_dswap_batched) \
+    X(rocblas_dswap_batched_64) \
+    X(rocblas_dswap_strided_batched) \
+    X(rocblas_dswap_strided_batched_64) \
+    X(rocblas_dsymm) \
+    X(rocblas_dsymm_64) \
+    X(rocblas_dsymm_batched) \
+    X(rocblas_dsymm_batched_64) \
+    X(rocblas_dsymm_strided_batched) \
+    X(rocblas_dsymm_strided_batched_64) \
+    X(rocblas_dsymv) \
+    X(rocblas_dsymv_64) \
+    X(rocblas_dsymv_batched) \
+    X(rocblas_dsymv_batched_64) \
+    X(rocblas_dsymv_strided_batched) \
+    X(rocblas_dsymv_strided_batched_64) \
+    X(rocblas_dsyr) \
+    X(rocblas_dsyr2) \
+    X(rocblas_dsyr2_64) \
+    X(rocblas_dsyr2_batched) \
+    X(rocblas_dsyr2_batched_64) \
+    X(rocblas_dsyr2_strided_batched) \
+    X(rocblas_dsyr2_strided_batched_64) \
+    X(rocblas_dsyr2k) \
+    X(rocblas_dsyr2k_64) \
+    X(rocblas_dsyr2k_batched) \
+    X(rocblas_dsyr2k_batched_64) \
+    X(rocblas_dsyr2k_strided_batched) \
+    X(rocblas_dsyr2k_strided_batched_64) \
+    X(rocblas_dsyr_64) \
+    X(rocblas_dsyr_batched) \
+    X(rocblas_dsyr_batched_64) \
+    X(rocblas_dsyr_strided_batched) \
+    X(rocblas_dsyr_strided_batched_64) \
+    X(rocblas_dsyrk) \
+    X(rocblas_dsyrk_64) \
+    X(rocblas_dsyrk_batched) \
+    X(rocblas_dsyrk_batched_64) \
+    X(rocblas_dsyrk_strided_batched) \
+    X(rocblas_dsyrk_strided_batched_64) \
+    X(rocblas_dsyrkx) \
+    X(rocblas_dsyrkx_64) \
+    X(rocblas_dsyrkx_batched) \
+    X(rocblas_dsyrkx_batched_64) \
+    X(rocblas_dsyrkx_strided_batched) \
+    X(rocblas_dsyrkx_strided_batched_64) \
+    X(rocblas_dtbmv) \
+    X(rocblas_dtbmv_64) \
+    X(rocblas_dtbmv_batched) \
+    X(rocblas_dtbmv_batched_64) \
+    X(rocblas_dtbmv_strided_batched) \
+    X(rocblas_dtbmv_strided_batched_64) \
+    X(rocblas_dtbsv) \
+    X(rocblas_dtbsv_64) \
+    X(rocblas_dtbsv_batched) \
+    X(rocblas_dtbsv_batched_64) \
+    X(rocblas_dtbsv_strided_batched) \
+    X(rocblas_dtbsv_strided_batched_64) \
+    X(rocblas_dtpmv) \
+    X(rocblas_dtpmv_64) \
+    X(rocblas_dtpmv_batched) \
+    X(rocblas_dtpmv_batched_64) \
+    X(rocblas_dtpmv_strided_batched) \
+    X(rocblas_dtpmv_strided_batched_64) \
+    X(rocblas_dtpsv) \
+    X(rocblas_dtpsv_64) \
+    X(rocblas_dtpsv_batched) \
+    X(rocblas_dtpsv_batched_64) \
+    X(rocblas_dtpsv_strided_batched) \
+    X(rocblas_dtpsv_strided_batched_64) \
+    X(rocblas_dtrmm) \
+    X(rocblas_dtrmm_64) \
+    X(rocblas_dtrmm_batched) \
+    X(rocblas_dtrmm_batched_64) \
+    X(rocblas_dtrmm_strided_batched) \
+    X(rocblas_dtrmm_strided_batched_64) \
+    X(rocblas_dtrmv) \
+    X(rocblas_dtrmv_64) \
+    X(rocblas_dtrmv_batched) \
+    X(rocblas_dtrmv_batched_64) \
+    X(rocblas_dtrmv_strided_batched) \
+    X(rocblas_dtrmv_strided_batched_64) \
+    X(rocblas_dtrsm) \
+    X(rocblas_dtrsm_64) \
+    X(rocblas_dtrsm_batched) \
+    X(rocblas_dtrsm_batched_64) \
+    X(rocblas_dtrsm_strided_batched) \
+    X(rocblas_dtrsm_strided_batched_64) \
+    X(rocblas_dtrsv) \
+    X(rocblas_dtrsv_64) \
+    X(rocblas_dtrsv_batched) \
+    X(rocblas_dtrsv_batched_64) \
+    X(rocblas_dtrsv_strided_batched) \
+    X(rocblas_dtrsv_strided_batched_64) \
+    X(rocblas_dtrtri) \
+    X(rocblas_dtrtri_batched) \
+    X(rocblas_dtrtri_strided_batched) \
+    X(rocblas_dzasum) \
+    X(rocblas_dzasum_64) \
+    X(rocblas_dzasum_batched) \
+    X(rocblas_dzasum_batched_64) \
+    X(rocblas_dzasum_strided_batched) \
+    X(rocblas_dzasum_strided_batched_64) \
+    X(rocblas_dznrm2) \
+    X(rocblas_dznrm2_64) \
+    X(rocblas_dznrm2_batched) \
+    X(rocblas_dznrm2_batched_64) \
+    X(rocblas_dznrm2_strided_batched) \
+    X(rocblas_dznrm2_strided_batched_64) \
+    X(rocblas_gemm_batched_ex) \
+    X(rocblas_gemm_batched_ex3) \
+    X(rocblas_gemm_batched_ex_64) \
+    X(rocblas_gemm_batched_ex_get_solutions) \
+    X(rocblas_gemm_ex) \
+    X(rocblas_gemm_ex3) \
+    X(rocblas_gemm_ex_64) \
+    X(rocblas_gemm_ex_get_solutions) \
+    X(rocblas_gemm_strided_batched_ex) \
+    X(rocblas_gemm_strided_batched_ex3) \
+    X(rocblas_gemm_strided_batched_ex_64) \
+    X(rocblas_gemm_strided_batched_ex_get_solutions) \
+    X(rocblas_get_atomics_mode) \
+    X(rocblas_get_device_memory_size) \
+    X(rocblas_get_math_mode) \
+    X(rocblas_get_matrix) \
+    X(rocblas_get_matrix_async) \
+    X(rocblas_get_pointer_mode) \
+    X(rocblas_get_stream) \
+    X(rocblas_get_vector) \
+    X(rocblas_get_vector_async) \
+    X(rocblas_get_version_string) \
+    X(rocblas_get_version_string_size) \
+    X(rocblas_haxpy) \
+    X(rocblas_haxpy_64) \
+    X(rocblas_haxpy_batched) \
+    X(rocblas_haxpy_batched_64) \
+    X(rocblas_haxpy_strided_batched) \
+    X(rocblas_haxpy_strided_batched_64) \
+    X(rocblas_hdot) \
+    X(rocblas_hdot_64) \
+    X(rocblas_hdot_batched) \
+    X(rocblas_hdot_batched_64) \
+    X(rocblas_hdot_strided_batched) \
+    X(rocblas_hdot_strided_batched_64) \
+    X(rocblas_hgemm) \
+    X(rocblas_hgemm_64) \
+    X(rocblas_hgemm_batched) \
+    X(rocblas_hgemm_batched_64) \
+    X(rocblas_hgemm_strided_batched) \
+    X(rocblas_hgemm_strided_batched_64) \
+    X(rocblas_hshgemv_batched) \
+    X(rocblas_hshgemv_strided_batched) \
+    X(rocblas_hssgemv_batched) \
+    X(rocblas_hssgemv_strided_batched) \
+    X(rocblas_icamax) \
+    X(rocblas_icamax_64) \
+    X(rocblas_icamax_batched) \
+    X(rocblas_icamax_batched_64) \
+    X(rocblas_icamax_strided_batched) \
+    X(rocblas_icamax_strided_batched_64) \
+    X(rocblas_icamin) \
+    X(rocblas_icamin_64) \
+    X(rocblas_icamin_batched) \
+    X(rocblas_icamin_batched_64) \
+    X(rocblas_icamin_strided_batched) \
+    X(rocblas_icamin_strided_batched_64) \
+    X(rocblas_idamax) \
+    X(rocblas_idamax_64) \
+    X(rocblas_idamax_batched) \
+    X(rocblas_idamax_batched_64) \
+    X(rocblas_idamax_strided_batched) \
+    X(rocblas_idamax_strided_batched_64) \
+    X(rocblas_idamin) \
+    X(rocblas_idamin_64) \
+    X(rocblas_idamin_batched) \
+    X(rocblas_idamin_batched_64) \
+    X(rocblas_idamin_strided_batched) \
+    X(rocblas_idamin_strided_batched_64) \
+    X(rocblas_initialize) \
+    X(rocblas_is_device_memory_size_query) \
+    X(rocblas_is_managing_device_memory) \
+    X(rocblas_is_user_managing_device_memory) \
+    X(rocblas_isamax) \
+    X(rocblas_isamax_64) \
+    X(rocblas_isamax_batched) \
+    X(rocblas_isamax_batched_64) \
+    X(rocblas_isamax_strided_batched) \
+    X(rocblas_isamax_strided_batched_64) \
+    X(rocblas_isamin) \
+    X(rocblas_isamin_64) \
+    X(rocblas_isamin_batched) \
+    X(rocblas_isamin_batched_64) \
+    X(rocblas_isamin_strided_batched) \
+    X(rocblas_isamin_strided_batched_64) \
+    X(rocblas_izamax) \
+    X(rocblas_izamax_64) \
+    X(rocblas_izamax_batched) \
+    X(rocblas_izamax_batched_64) \
+    X(rocblas_izamax_strided_batched) \
+    X(rocblas_izamax_strided_batched_64) \
+    X(rocblas_izamin) \
+    X(rocblas_izamin_64) \
+    X(rocblas_izamin_batched) \
+    X(rocblas_izamin_batched_64) \
+    X(rocblas_izamin_strided_batched) \
+    X(rocblas_izamin_strided_batched_64) \
+    X(rocblas_nrm2_batched_ex) \
+    X(rocblas_nrm2_batched_ex_64) \
+    X(rocblas_nrm2_ex) \
+    X(rocblas_nrm2_ex_64) \
+    X(rocblas_nrm2_strided_batched_ex) \
+    X(rocblas_nrm2_strided_batched_ex_64) \
+    X(rocblas_rot_batched_ex) \
+    X(rocblas_rot_batched_ex_64) \
+    X(rocblas_rot_ex) \
+    X(rocblas_rot_ex_64) \
+    X(rocblas_rot_strided_batched_ex) \
+    X(rocblas_rot_strided_batched_ex_64) \
+    X(rocblas_sasum) \
+    X(rocblas_sasum_64) \
+    X(rocblas_sasum_batched) \
+    X(rocblas_sasum_batched_64) \
+    X(rocblas_sasum_strided_batched) \
+    X(rocblas_sasum_strided_batched_64) \
+    X(rocblas_saxpy) \
+    X(rocblas_saxpy_64) \
+    X(rocblas_saxpy_batched) \
+    X(rocblas_saxpy_batched_64) \
+    X(rocblas_saxpy_strided_batched) \
+    X(rocblas_saxpy_strided_batched_64) \
+    X(rocblas_scal_batched_ex) \
+    X(rocblas_scal_batched_ex_64) \
+    X(rocblas_scal_ex) \
+    X(rocblas_scal_ex_64) \
+    X(rocblas_scal_strided_batched_ex) \
+    X(rocblas_scal_strided_batched_ex_64) \
+    X(rocblas_scasum) \
+    X(rocblas_scasum_64) \
+    X(rocblas_scasum_batched) \
+    X(rocblas_scasum_batched_64) \
+    X(rocblas_scasum_strided_batched) \
+    X(rocblas_scasum_strided_batched_64) \
+    X(rocblas_scnrm2) \
+    X(rocblas_scnrm2_64) \
+    X(rocblas_scnrm2_batched) \
+    X(rocblas_scnrm2_batched_64) \
+    X(rocblas_scnrm2_strided_batched) \
+    X(rocblas_scnrm2_strided_batched_64) \
+    X(rocblas_scopy) \
+    X(rocblas_scopy_64) \
+    X(rocblas_scopy_batched) \
+    X(rocblas_scopy_batched_64) \
+    X(rocblas_scopy_strided_batched) \
+    X(rocblas_scopy_strided_batched_64) \
+    X(rocblas_sdgmm) \
+    X(rocblas_sdgmm_64) \
+    X(rocblas_sdgmm_batched) \
+    X(rocblas_sdgmm_batched_64) \
+    X(rocblas_sdgmm_strided_batched) \
+    X(rocblas_sdgmm_strided_batched_64) \
+    X(rocblas_sdot) \
+    X(rocblas_sdot_64) \
+    X(rocblas_sdot_batched) \
+    X(rocblas_sdot_batched_64) \
+    X(rocblas_sdot_strided_batched) \
+    X(rocblas_sdot_strided_batched_64) \
+    X(rocblas_set_atomics_mode) \
+    X(rocblas_set_device_memory_size) \
+    X(rocblas_set_math_mode) \
+    X(rocblas_set_matrix) \
+    X(rocblas_set_matrix_async) \
+    X(rocblas_set_pointer_mode) \
+    X(rocblas_set_stream) \
+    X(rocblas_set_vector) \
+    X(rocblas_set_vector_async) \
+    X(rocblas_set_workspace) \
+    X(rocblas_sgbmv) \
+    X(rocblas_sgbmv_64) \
+    X(rocblas_sgbmv_batched) \
+    X(rocblas_sgbmv_batched_64) \
+    X(rocblas_sgbmv_strided_batched) \
+    X(rocblas_sgbmv_strided_batched_64) \
+    X(rocblas_sgeam) \
+    X(rocblas_sgeam_64) \
+    X(rocblas_sgeam_batched) \
+    X(rocblas_sgeam_batched_64) \
+    X(rocblas_sgeam_strided_batched) \
+    X(rocblas_sgeam_strided_batched_64) \
+    X(rocblas_sgemm) \
+    X(rocblas_sgemm_64) \
+    X(rocblas_sgemm_batched) \
+    X(rocblas_sgemm_batched_64) \
+    X(rocblas_sgemm_strided_batched) \
+    X(rocblas_sgemm_strided_batched_64) \
+    X(rocblas_sgemv) \
+    X(rocblas_sgemv_64) \
+    X(rocblas_sgemv_batched) \
+    X(rocblas_sgemv_batched_64) \
+    X(rocblas_sgemv_strided_batched) \
+    X(rocblas_sgemv_strided_batched_64) \
+    X(rocblas_sger) \
+    X(rocblas_sger_64) \
+    X(rocblas_sger_batched) \
+    X(rocblas_sger_batched_64) \
+    X(rocblas_sger_strided_batched) \
+    X(rocblas_sger_strided_batched_64) \
+    X(rocblas_snrm2) \
+    X(rocblas_snrm2_64) \
+    X(rocblas_snrm2_batched) \
+    X(rocblas_snrm2_batched_64) \
+    X(rocblas_snrm2_strided_batched) \
+    X(rocblas_snrm2_strided_batched_64) \
+    X(rocblas_srot) \
+    X(rocblas_srot_64) \
+    X(rocblas_srot_batched) \
+    X(rocblas_srot_batched_64) \
+    X(rocblas_srot_strided_batched) \
+    X(rocblas_srot_strided_batched_64) \
+    X(rocblas_srotg) \
+    X(rocblas_srotg_64) \
+    X(rocblas_srotg_batched) \
+    X(rocblas_srotg_batched_64) \
+    X(rocblas_srotg_strided_batched) \
+    X(rocblas_srotg_strided_batched_64) \
+    X(rocblas_srotm) \
+    X(rocblas_srotm_64) \
+    X(rocblas_srotm_batched) \
+    X(rocblas_srotm_batched_64) \
+    X(rocblas_srotm_strided_batched) \
+    X(rocblas_srotm_strided_batched_64) \
+    X(rocblas_srotmg) \
+    X(rocblas_srotmg_64) \
+    X(rocblas_srotmg_batched) \
+    X(rocblas_srotmg_batched_64) \
+    X(rocblas_srotmg_strided_batched) \
+    X(rocblas_srotmg_strided_batched_64) \
+    X(rocblas_ssbmv) \
+    X(rocblas_ssbmv_64) \
+    X(rocblas_ssbmv_batched) \
+    X(rocblas_ssbmv_batched_64) \
+    X(rocblas_ssbmv_strided_batched) \
+    X(rocblas_ssbmv_strided_batched_64) \
+    X(rocblas_sscal) \
+    X(rocblas_sscal_64) \
+    X(rocblas_sscal_batched) \
+    X(rocblas_sscal_batched_64) \
+    X(rocblas_sscal_strided_batched) \
+    X(rocblas_sscal_strided_batched_64) \
+    X(rocblas_sspmv) \
+    X(rocblas_sspmv_64) \
+    X(rocblas_sspmv_batched) \
+    X(rocblas_sspmv_batched_64) \
+    X(rocblas_sspmv_strided_batched) \
+    X(rocblas_sspmv_strided_batched_64) \
+    X(rocblas_sspr) \
+    X(rocblas_sspr2) \
+    X(rocblas_sspr2_64) \
+    X(rocblas_sspr2_batched) \
+    X(rocblas_sspr2_batched_64) \
+    X(rocblas_sspr2_strided_batched) \
+    X(rocblas_sspr2_strided_batched_64) \
+    X(rocblas_sspr_64) \
+    X(rocblas_sspr_batched) \
+    X(rocblas_sspr_batched_64) \
+    X(rocblas_sspr_strided_batched) \
+    X(rocblas_sspr_strided_batched_64) \
+    X(rocblas_sswap) \
+    X(rocblas_sswap_64) \
+    X(rocblas_sswap_batched) \
+    X(rocblas_sswap_batched_64) \
+    X(rocblas_sswap_strided_batched) \
+    X(rocblas_sswap_strided_batched_64) \
+    X(rocblas_ssymm) \
+    X(rocblas_ssymm_64) \
+    X(rocblas_ssymm_batched) \
+    X(rocblas_ssymm_batched_64) \
+    X(rocblas_ssymm_strided_batched) \
+    X(rocblas_ssymm_strided_batched_64) \
+    X(rocblas_ssymv) \
+    X(rocblas_ssymv_64) \
+    X(rocblas_ssymv_batched) \
+    X(rocblas_ssymv_batched_64) \
+    X(rocblas_ssymv_strided_batched) \
+    X(rocblas_ssymv_strided_batched_64) \
+    X(rocblas_ssyr) \
+    X(rocblas_ssyr2) \
+    X(rocblas_ssyr2_64) \
+    X(rocblas_ssyr2_batched) \
+    X(rocblas_ssyr2_batched_64) \
+    X(rocblas_ssyr2_strided_batched) \
+    X(rocblas_ssyr2_strided_batched_64) \
+    X(rocblas_ssyr2k) \
+    X(rocblas_ssyr2k_64) \
+    X(rocblas_ssyr2k_batched) \
+    X(rocblas_ssyr2k_batched_64) \
+    X(rocblas_ssyr2k_strided_batched) \
+    X(rocblas_ssyr2k_strided_batched_64) \
+    X(rocblas_ssyr_64) \
+    X(rocblas_ssyr_batched) \
+    X(rocblas_ssyr_batched_64) \
+    X(rocblas_ssyr_strided_batched) \
+    X(rocblas_ssyr_strided_batched_64) \
+    X(rocblas_ssyrk) \
+    X(rocblas_ssyrk_64) \
+    X(rocblas_ssyrk_batched) \
+    X(rocblas_ssyrk_batched_64) \
+    X(rocblas_ssyrk_strided_batched) \
+    X(rocblas_ssyrk_strided_batched_64) \
+    X(rocblas_ssyrkx) \
+    X(rocblas_ssyrkx_64) \
+    X(rocblas_ssyrkx_batched) \
+    X(rocblas_ssyrkx_batched_64) \
+    X(rocblas_ssyrkx_strided_batched) \
+    X(rocblas_ssyrkx_strided_batched_64) \
+    X(rocblas_start_device_memory_size_query) \
+    X(rocblas_stbmv) \
+    X(rocblas_stbmv_64) \
+    X(rocblas_stbmv_batched) \
+    X(rocblas_stbmv_batched_64) \
+    X(rocblas_stbmv_strided_batched) \
+    X(rocblas_stbmv_strided_batched_64) \
+    X(rocblas_stbsv) \
+    X(rocblas_stbsv_64) \
+    X(rocblas_stbsv_batched) \
+    X(rocblas_stbsv_batched_64) \
+    X(rocblas_stbsv_strided_batched) \
+    X(rocblas_stbsv_strided_batched_64) \
+    X(rocblas_stop_device_memory_size_query) \
+    X(rocblas_stpmv) \
+    X(rocblas_stpmv_64) \
+    X(rocblas_stpmv_batched) \
+    X(rocblas_stpmv_batched_64) \
+    X(rocblas_stpmv_strided_batched) \
+    X(rocblas_stpmv_strided_batched_64) \
+    X(rocblas_stpsv) \
+    X(rocblas_stpsv_64) \
+    X(rocblas_stpsv_batched) \
+    X(rocblas_stpsv_batched_64) \
+    X(rocblas_stpsv_strided_batched) \
+    X(rocblas_stpsv_strided_batched_64) \
+    X(rocblas_strmm) \
+    X(rocblas_strmm_64) \
+    X(rocblas_strmm_batched) \
+    X(rocblas_strmm_batched_64) \
+    X(rocblas_strmm_strided_batched) \
+    X(rocblas_strmm_strided_batched_64) \
+    X(rocblas_strmv) \
+    X(rocblas_strmv_64) \
+    X(rocblas_strmv_batched) \
+    X(rocblas_strmv_batched_64) \
+    X(rocblas_strmv_strided_batched) \
+    X(rocblas_strmv_strided_batched_64) \
+    X(rocblas_strsm) \
+    X(rocblas_strsm_64) \
+    X(rocblas_strsm_batched) \
+    X(rocblas_strsm_batched_64) \
+    X(rocblas_strsm_strided_batched) \
+    X(rocblas_strsm_strided_batched_64) \
+    X(rocblas_strsv) \
+    X(rocblas_strsv_64) \
+    X(rocblas_strsv_batched) \
+    X(rocblas_strsv_batched_64) \
+    X(rocblas_strsv_strided_batched) \
+    X(rocblas_strsv_strided_batched_64) \
+    X(rocblas_strtri) \
+    X(rocblas_strtri_batched) \
+    X(rocblas_strtri_strided_batched) \
+    X(rocblas_trsm_batched_ex) \
+    X(rocblas_trsm_ex) \
+    X(rocblas_trsm_strided_batched_ex) \
+    X(rocblas_tssgemv_batched) \
+    X(rocblas_tssgemv_strided_batched) \
+    X(rocblas_tstgemv_batched) \
+    X(rocblas_tstgemv_strided_batched) \
+    X(rocblas_zaxpy) \
+    X(rocblas_zaxpy_64) \
+    X(rocblas_zaxpy_batched) \
+    X(rocblas_zaxpy_batched_64) \
+    X(rocblas_zaxpy_strided_batched) \
+    X(rocblas_zaxpy_strided_batched_64) \
+    X(rocblas_zcopy) \
+    X(rocblas_zcopy_64) \
+    X(rocblas_zcopy_batched) \
+    X(rocblas_zcopy_batched_64) \
+    X(rocblas_zcopy_strided_batched) \
+    X(rocblas_zcopy_strided_batched_64) \
+    X(rocblas_zdgmm) \
+    X(rocblas_zdgmm_64) \
+    X(rocblas_zdgmm_batched) \
+    X(rocblas_zdgmm_batched_64) \
+    X(rocblas_zdgmm_strided_batched) \
+    X(rocblas_zdgmm_strided_batched_64) \
+    X(rocblas_zdotc) \
+    X(rocblas_zdotc_64) \
+    X(rocblas_zdotc_batched) \
+    X(rocblas_zdotc_batched_64) \
+    X(rocblas_zdotc_strided_batched) \
+    X(rocblas_zdotc_strided_batched_64) \
+    X(rocblas_zdotu) \
+    X(rocblas_zdotu_64) \
+    X(rocblas_zdotu_batched) \
+    X(rocblas_zdotu_batched_64) \
+    X(rocblas_zdotu_strided_batched) \
+    X(rocblas_zdotu_strided_batched_64) \
+    X(rocblas_zdrot) \
+    X(rocblas_zdrot_64) \
+    X(rocblas_zdrot_batched) \
+    X(rocblas_zdrot_batched_64) \
+    X(rocblas_zdrot_strided_batched) \
+    X(rocblas_zdrot_strided_batched_64) \
+    X(rocblas_zdscal) \
+    X(rocblas_zdscal_64) \
+    X(rocblas_zdscal_batched) \
+    X(rocblas_zdscal_batched_64) \
+    X(rocblas_zdscal_strided_batched) \
+    X(rocblas_zdscal_strided_batched_64) \
+    X(rocblas_zgbmv) \
+    X(rocblas_zgbmv_64) \
+    X(rocblas_zgbmv_batched) \
+    X(rocblas_zgbmv_batched_64) \
+    X(rocblas_zgbmv_strided_batched) \
+    X(rocblas_zgbmv_strided_batched_64) \
+    X(rocblas_zgeam) \
+    X(rocblas_zgeam_64) \
+    X(rocblas_zgeam_batched) \
+    X(rocblas_zgeam_batched_64) \
+    X(rocblas_zgeam_strided_batched) \
+    X(rocblas_zgeam_strided_batched_64) \
+    X(rocblas_zgemm) \
+    X(rocblas_zgemm_64) \
+    X(rocblas_zgemm_batched) \
+    X(rocblas_zgemm_batched_64) \
+    X(rocblas_zgemm_strided_batched) \
+    X(rocblas_zgemm_strided_batched_64) \
+    X(rocblas_zgemv) \
+    X(rocblas_zgemv_64) \
+    X(rocblas_zgemv_batched) \
+    X(rocblas_zgemv_batched_64) \
+    X(rocblas_zgemv_strided_batched) \
+    X(rocblas_zgemv_strided_batched_64) \
+    X(rocblas_zgerc) \
+    X(rocblas_zgerc_64) \
+    X(rocblas_zgerc_batched) \
+    X(rocblas_zgerc_batched_64) \
+    X(rocblas_zgerc_strided_batched) \
+    X(rocblas_zgerc_strided_batched_64) \
+    X(rocblas_zgeru) \
+    X(rocblas_zgeru_64) \
+    X(rocblas_zgeru_batched) \
+    X(rocblas_zgeru_batched_64) \
+    X(rocblas_zgeru_strided_batched) \
+    X(rocblas_zgeru_strided_batched_64) \
+    X(rocblas_zhbmv) \
+    X(rocblas_zhbmv_64) \
+    X(rocblas_zhbmv_batched) \
+    X(rocblas_zhbmv_batched_64) \
+    X(rocblas_zhbmv_strided_batched) \
+    X(rocblas_zhbmv_strided_batched_64) \
+    X(rocblas_zhemm) \
+    X(rocblas_zhemm_64) \
+    X(rocblas_zhemm_batched) \
+    X(rocblas_zhemm_batched_64) \
+    X(rocblas_zhemm_strided_batched) \
+    X(rocblas_zhemm_strided_batched_64) \
+    X(rocblas_zhemv) \
+    X(rocblas_zhemv_64) \
+    X(rocblas_zhemv_batched) \
+    X(rocblas_zhemv_batched_64) \
+    X(rocblas_zhemv_strided_batched) \
+    X(rocblas_zhemv_strided_batched_64) \
+    X(rocblas_zher) \
+    X(rocblas_zher2) \
+    X(rocblas_zher2_64) \
+    X(rocblas_zher2_batched) \
+    X(rocblas_zher2_batched_64) \
+    X(rocblas_zher2_strided_batched) \
+    X(rocblas_zher2_strided_batched_64) \
+    X(rocblas_zher2k) \
+    X(rocblas_zher2k_64) \
+    X(rocblas_zher2k_batched) \
+    X(rocblas_zher2k_batched_64) \
+    X(rocblas_zher2k_strided_batched) \
+    X(rocblas_zher2k_strided_batched_64) \
+    X(rocblas_zher_64) \
+    X(rocblas_zher_batched) \
+    X(rocblas_zher_batched_64) \
+    X(rocblas_zher_strided_batched) \
+    X(rocblas_zher_strided_batched_64) \
+    X(rocblas_zherk) \
+    X(rocblas_zherk_64) \
+    X(rocblas_zherk_batched) \
+    X(rocblas_zherk_batched_64) \
+    X(rocblas_zherk_strided_batched) \
+    X(rocblas_zherk_strided_batched_64) \
+    X(rocblas_zherkx) \
+    X(rocblas_zherkx_64) \
+    X(rocblas_zherkx_batched) \
+    X(rocblas_zherkx_batched_64) \
+    X(rocblas_zherkx_strided_batched) \
+    X(rocblas_zherkx_strided_batched_64) \
+    X(rocblas_zhpmv) \
+    X(rocblas_zhpmv_64) \
+    X(rocblas_zhpmv_batched) \
+    X(rocblas_zhpmv_batched_64) \
+    X(rocblas_zhpmv_strided_batched) \
+    X(rocblas_zhpmv_strided_batched_64) \
+    X(rocblas_zhpr) \
+    X(rocblas_zhpr2) \
+    X(rocblas_zhpr2_64) \
+    X(rocblas_zhpr2_batched) \
+    X(rocblas_zhpr2_batched_64) \
+    X(rocblas_zhpr2_strided_batched) \
+    X(rocblas_zhpr2_strided_batched_64) \
+    X(rocblas_zhpr_64) \
+    X(rocblas_zhpr_batched) \
+    X(rocblas_zhpr_batched_64) \
+    X(rocblas_zhpr_strided_batched) \
+    X(rocblas_zhpr_strided_batched_64) \
+    X(rocblas_zrot) \
+    X(rocblas_zrot_64) \
+    X(rocblas_zrot_batched) \
+    X(rocblas_zrot_batched_64) \
+    X(rocblas_zrot_strided_batched) \
+    X(rocblas_zrot_strided_batched_64) \
+    X(rocblas_zrotg) \
+    X(rocblas_zrotg_64) \
+    X(rocblas_zrotg_batched) \
+    X(rocblas_zrotg_batched_64) \
+    X(rocblas_zrotg_strided_batched) \
+    X(rocblas_zrotg_strided_batched_64) \
+    X(rocblas_zscal) \
+    X(rocblas_zscal_64) \
+    X(rocblas_zscal_batched) \
+    X(rocblas_zscal_batched_64) \
+    X(rocblas_zscal_strided_batched) \
+    X(rocblas_zscal_strided_batched_64) \
+    X(rocblas_zspr) \
+    X(rocblas_zspr_64) \
+    X(rocblas_zspr_batched) \
+    X(rocblas_zspr_batched_64) \
+    X(rocblas_zspr_strided_batched) \
+    X(rocblas_zspr_strided_batched_64) \
+    X(rocblas_zswap) \
+    X(rocblas_zswap_64) \
+    X(rocblas_zswap_batched) \
+    X(rocblas_zswap_batched_64) \
+    X(rocblas_zswap_strided_batched) \
+    X(rocblas_zswap_strided_batched_64) \
+    X(rocblas_zsymm) \
+    X(rocblas_zsymm_64) \
+    X(rocblas_zsymm_batched) \
+    X(rocblas_zsymm_batched_64) \
+    X(rocblas_zsymm_strided_batched) \
+    X(rocblas_zsymm_strided_batched_64) \
+    X(rocblas_zsymv) \
+    X(rocblas_zsymv_64) \
+    X(rocblas_zsymv_batched) \
+    X(rocblas_zsymv_batched_64) \
+    X(rocblas_zsymv_strided_batched) \
+    X(rocblas_zsymv_strided_batched_64) \
+    X(rocblas_zsyr) \
+    X(rocblas_zsyr2) \
+    X(rocblas_zsyr2_64) \
+    X(rocblas_zsyr2_batched) \
+    X(rocblas_zsyr2_batched_64) \
+    X(rocblas_zsyr2_strided_batched) \
+    X(rocblas_zsyr2_strided_batched_64) \
+    X(rocblas_zsyr2k) \
+    X(rocblas_zsyr2k_64) \
+    X(rocblas_zsyr2k_batched) \
+    X(rocblas_zsyr2k_batched_64) \
+    X(rocblas_zsyr2k_strided_batched) \
+    X(rocblas_zsyr2k_strided_batched_64) \
+    X(rocblas_zsyr_64) \
+    X(rocblas_zsyr_batched) \
+    X(rocblas_zsyr_batched_64) \
+    X(rocblas_zsyr_strided_batched) \
+    X(rocblas_zsyr_strided_batched_64) \
+    X(rocblas_zsyrk) \
+    X(rocblas_zsyrk_64) \
+    X(rocblas_zsyrk_batched) \
+    X(rocblas_zsyrk_batched_64) \
+    X(rocblas_zsyrk_strided_batched) \
+    X(rocblas_zsyrk_strided_batched_64) \
+    X(rocblas_zsyrkx) \
+    X(rocblas_zsyrkx_64) \
+    X(rocblas_zsyrkx_batched) \
+    X(rocblas_zsyrkx_batched_64) \
+    X(rocblas_zsyrkx_strided_batched) \
+    X(rocblas_zsyrkx_strided_batched_64) \
+    X(rocblas_ztbmv) \
+    X(rocblas_ztbmv_64) \
+    X(rocblas_ztbmv_batched) \
+    X(rocblas_ztbmv_batched_64) \
+    X(rocblas_ztbmv_strided_batched) \
+    X(rocblas_ztbmv_strided_batched_64) \
+    X(rocblas_ztbsv) \
+    X(rocblas_ztbsv_64) \
+    X(rocblas_ztbsv_batched) \
+    X(rocblas_ztbsv_batched_64) \
+    X(rocblas_ztbsv_strided_batched) \
+    X(rocblas_ztbsv_strided_batched_64) \
+    X(rocblas_ztpmv) \
+    X(rocblas_ztpmv_64) \
+    X(rocblas_ztpmv_batched) \
+    X(rocblas_ztpmv_batched_64) \
+    X(rocblas_ztpmv_strided_batched) \
+    X(rocblas_ztpmv_strided_batched_64) \
+    X(rocblas_ztpsv) \
+    X(rocblas_ztpsv_64) \
+    X(rocblas_ztpsv_batched) \
+    X(rocblas_ztpsv_batched_64) \
+    X(rocblas_ztpsv_strided_batched) \
+    X(rocblas_ztpsv_strided_batched_64) \
+    X(rocblas_ztrmm) \
+    X(rocblas_ztrmm_64) \
+    X(rocblas_ztrmm_batched) \
+    X(rocblas_ztrmm_batched_64) \
+    X(rocblas_ztrmm_strided_batched) \
+    X(rocblas_ztrmm_strided_batched_64) \
+    X(rocblas_ztrmv) \
+    X(rocblas_ztrmv_64) \
+    X(rocblas_ztrmv_batched) \
+    X(rocblas_ztrmv_batched_64) \
+    X(rocblas_ztrmv_strided_batched) \
+    X(rocblas_ztrmv_strided_batched_64) \
+    X(rocblas_ztrsm) \
+    X(rocblas_ztrsm_64) \
+    X(rocblas_ztrsm_batched) \
+    X(rocblas_ztrsm_batched_64) \
+    X(rocblas_ztrsm_strided_batched) \
+    X(rocblas_ztrsm_strided_batched_64) \
+    X(rocblas_ztrsv) \
+    X(rocblas_ztrsv_64) \
+    X(rocblas_ztrsv_batched) \
+    X(rocblas_ztrsv_batched_64) \
+    X(rocblas_ztrsv_strided_batched) \
+    X(rocblas_ztrsv_strided_batched_64) \
+    X(rocblas_ztrtri) \
+    X(rocblas_ztrtri_batched) \
+    X(rocblas_ztrtri_strided_batched)
+
+#ifdef __HIP_PLATFORM_SOLVER__
+#define HIPBLAS_ROCSOLVER_FUNCTIONS(X) \
+    X(rocsolver_cgels) \
+    X(rocsolver_cgels_batched) \
+    X(rocsolver_cgels_strided_batched) \
+    X(rocsolver_cgeqrf) \
+    X(rocsolver_cgeqrf_batched) \
+    X(rocsolver_cgeqrf_ptr_batched) \
+    X(rocsolver_cgeqrf_strided_batched) \
+    X(rocsolver_cgesv_batched) \
+    X(rocsolver_cgesv_strided_batched) \
+    X(rocsolver_cgesvdj_batched) \
+    X(rocsolver_cgesvdj_strided_batched) \
+    X(rocsolver_cgetrf) \
+    X(rocsolver_cgetrf_batched) \
+    X(rocsolver_cgetrf_npvt) \
+    X(rocsolver_cgetrf_npvt_batched) \
+    X(rocsolver_cgetrf_npvt_strided_batched) \
+    X(rocsolver_cgetrf_strided_batched) \
+    X(rocsolver_cgetri_npvt_outofplace_batched) \
+    X(rocsolver_cgetri_outofplace_batched) \
+    X(rocsolver_cgetrs) \
+    X(rocsolver_cgetrs_batched) \
+    X(rocsolver_cgetrs_strided_batched) \
+    X(rocsolver_cheevd) \
+    X(rocsolver_cheevj) \
+    X(rocsolver_cheevj_batched) \
+    X(rocsolver_cheevj_strided_batched) \
+    X(rocsolver_cpotrf) \
+    X(rocsolver_cpotrf_batched) \
+    X(rocsolver_cpotrf_strided_batched) \
+    X(rocsolver_cpotri) \
+    X(rocsolver_cpotri_batched) \
+    X(rocsolver_cpotri_strided_batched) \
+    X(rocsolver_cpotrs) \
+    X(rocsolver_cpotrs_batched) \
+    X(rocsolver_cpotrs_strided_batched) \
+    X(rocsolver_dgels) \
+    X(rocsolver_dgels_batched) \
+    X(rocsolver_dgels_strided_batched) \
+    X(rocsolver_dgeqrf) \
+    X(rocsolver_dgeqrf_batched) \
+    X(rocsolver_dgeqrf_ptr_batched) \
+    X(rocsolver_dgeqrf_strided_batched) \
+    X(rocsolver_dgesv_batched) \
+    X(rocsolver_dgesv_strided_batched) \
+    X(rocsolver_dgesvdj_batched) \
+    X(rocsolver_dgesvdj_strided_batched) \
+    X(rocsolver_dgetrf) \
+    X(rocsolver_dgetrf_batched) \
+    X(rocsolver_dgetrf_npvt) \
+    X(rocsolver_dgetrf_npvt_batched) \
+    X(rocsolver_dgetrf_npvt_strided_batched) \
+    X(rocsolver_dgetrf_strided_batched) \
+    X(rocsolver_dgetri_npvt_outofplace_batched) \
+    X(rocsolver_dgetri_outofplace_batched) \
+    X(rocsolver_dgetrs) \
+    X(rocsolver_dgetrs_batched) \
+    X(rocsolver_dgetrs_strided_batched) \
+    X(rocsolver_dpotrf) \
+    X(rocsolver_dpotrf_batched) \
+    X(rocsolver_dpotrf_strided_batched) \
+    X(rocsolver_dpotri) \
+    X(rocsolver_dpotri_batched) \
+    X(rocsolver_dpotri_strided_batched) \
+    X(rocsolver_dpotrs) \
+    X(rocsolver_dpotrs_batched) \
+    X(rocsolver_dpotrs_strided_batched) \
+    X(rocsolver_dsyevd) \
+    X(rocsolver_dsyevj) \
+    X(rocsolver_dsyevj_batched) \
+    X(rocsolver_dsyevj_strided_batched) \
+    X(rocsolver_sgels) \
+    X(rocsolver_sgels_batched) \
+    X(rocsolver_sgels_strided_batched) \
+    X(rocsolver_sgeqrf) \
+    X(rocsolver_sgeqrf_batched) \
+    X(rocsolver_sgeqrf_ptr_batched) \
+    X(rocsolver_sgeqrf_strided_batched) \
+    X(rocsolver_sgesv_batched) \
+    X(rocsolver_sgesv_strided_batched) \
+    X(rocsolver_sgesvdj_batched) \
+    X(rocsolver_sgesvdj_strided_batched) \
+    X(rocsolver_sgetrf) \
+    X(rocsolver_sgetrf_batched) \
+    X(rocsolver_sgetrf_npvt) \
+    X(rocsolver_sgetrf_npvt_batched) \
+    X(rocsolver_sgetrf_npvt_strided_batched) \
+    X(rocsolver_sgetrf_strided_batched) \
+    X(rocsolver_sgetri_npvt_outofplace_batched) \
+    X(rocsolver_sgetri_outofplace_batched) \
+    X(rocsolver_sgetrs) \
+    X(rocsolver_sgetrs_batched) \
+    X(rocsolver_sgetrs_strided_batched) \
+    X(rocsolver_spotrf) \
+    X(rocsolver_spotrf_batched) \
+    X(rocsolver_spotrf_strided_batched) \
+    X(rocsolver_spotri) \
+    X(rocsolver_spotri_batched) \
+    X(rocsolver_spotri_strided_batched) \
+    X(rocsolver_spotrs) \
+    X(rocsolver_spotrs_batched) \
+    X(rocsolver_spotrs_strided_batched) \
+    X(rocsolver_ssyevd) \
+    X(rocsolver_ssyevj) \
+    X(rocsolver_ssyevj_batched) \
+    X(rocsolver_ssyevj_strided_batched) \
+    X(rocsolver_zgels) \
+    X(rocsolver_zgels_batched) \
+    X(rocsolver_zgels_strided_batched) \
+    X(rocsolver_zgeqrf) \
+    X(rocsolver_zgeqrf_batched) \
+    X(rocsolver_zgeqrf_ptr_batched) \
+    X(rocsolver_zgeqrf_strided_batched) \
+    X(rocsolver_zgesv_batched) \
+    X(rocsolver_zgesv_strided_batched) \
+    X(rocsolver_zgesvdj_batched) \
+    X(rocsolver_zgesvdj_strided_batched) \
+    X(rocsolver_zgetrf) \
+    X(rocsolver_zgetrf_batched) \
+    X(rocsolver_zgetrf_npvt) \
+    X(rocsolver_zgetrf_npvt_batched) \
+    X(rocsolver_zgetrf_npvt_strided_batched) \
+    X(rocsolver_zgetrf_strided_batched) \
+    X(rocsolver_zgetri_npvt_outofplace_batched) \
+    X(rocsolver_zgetri_outofplace_batched) \
+    X(rocsolver_zgetrs) \
+    X(rocsolver_zgetrs_batched) \
+    X(rocsolver_zgetrs_strided_batched) \
+    X(rocsolver_zheevd) \
+    X(rocsolver_zheevj) \
+    X(rocsolver_zheevj_batched) \
+    X(rocsolver_zheevj_strided_batched) \
+    X(rocsolver_zpotrf) \
+    X(rocsolver_zpotrf_batched) \
+    X(rocsolver_zpotrf_strided_batched) \
+    X(rocsolver_zpotri) \
+    X(rocsolver_zpotri_batched) \
+    X(rocsolver_zpotri_strided_batched) \
+    X(rocsolver_zpotrs) \
+    X(rocsolver_zpotrs_batched) \
+    X(rocsolver_zpotrs_strided_batched)
+#endif
+
+#ifdef HIPBLAS_LAZY_BACKEND
+
+#include <atomic>
+
+#define HIPBLAS_BACKEND_FUNCTION(name) decltype(&::name) name;
+
+struct hipblasRocblasFunctions
+{
+    HIPBLAS_ROCBLAS_FUNCTIONS(HIPBLAS_BACKEND_FUNCTION)
+};
+
+#ifdef __HIP_PLATFORM_SOLVER__
+struct hipblasRocsolverFunctions
+{
+    HIPBLAS_ROCSOLVER_FUNCTIONS(HIPBLAS_BACKEND_FUNCTION)
+};
+#endif
+
+#undef HIPBLAS_BACKEND_FUNCTION
+
+// Load the library on the first call, and throw HIPBLAS_STATUS_NOT_INITIALIZED if it fails
+const hipblasRocblasFunctions& hipblasLoadRocblas();
+extern std::atomic<const hipblasRocblasFunctions*> hipblas_rocblas_functions;
+
+inline const hipblasRocblasFunctions& hipblasRocblas()
+{
+    const hipblasRocblasFunctions* functions
+        = hipblas_rocblas_functions.load(std::memory_order_acquire);
+    return functions ? *functions : hipblasLoadRocblas();
+}
+
+#ifdef __HIP_PLATFORM_SOLVER__
+const hipblasRocsolverFunctions& hipblasLoadRocsolver();
+extern std::atomic<const hipblasRocsolverFunctions*> hipblas_rocsolver_functions;
+
+inline const hipblasRocsolverFunctions& hipblasRocsolver()
+{
+    const hipblasRocsolverFunctions* functions
+        = hipblas_rocsolver_functions.load(std::memory_order_acquire);
+    return functions ? *functions : hipblasLoadRocsolver();
+}
+#endif
+
+// hipblas_backend.cpp defines HIPBLAS_BACKEND_LOADER to fill the tables
+#ifndef HIPBLAS_BACKEND_LOADER
+#define rocblas_axpy_batched_ex (hipblasRocblas().rocblas_axpy_batched_ex)
+#define rocblas_axpy_batched_ex_64 (hipblasRocblas().rocblas_axpy_batched_ex_64)
+#define rocblas_axpy_ex (hipblasRocblas().rocblas_axpy_ex)
+#define rocblas_axpy_ex_64 (hipblasRocblas().rocblas_axpy_ex_64)
+#define rocblas_axpy_strided_batched_ex (hipblasRocblas().rocblas_axpy_strided_batched_ex)
+#define rocblas_axpy_strided_batched_ex_64 (hipblasRocblas().rocblas_axpy_strided_batched_ex_64)
+#define rocblas_bfdot (hipblasRocblas().rocblas_bfdot)
+#define rocblas_bfdot_64 (hipblasRocblas().rocblas_bfdot_64)
+#define rocblas_bfdot_batched (hipblasRocblas().rocblas_bfdot_batched)
+#define rocblas_bfdot_batched_64 (hipblasRocblas().rocblas_bfdot_batched_64)
+#define rocblas_bfdot_strided_batched (hipblasRocblas().rocblas_bfdot_strided_batched)
+#define rocblas_bfdot_strided_batched_64 (hipblasRocblas().rocblas_bfdot_strided_batched_64)
+#define rocblas_caxpy (hipblasRocblas().rocblas_caxpy)
+#define rocblas_caxpy_64 (hipblasRocblas().rocblas_caxpy_64)
+#define rocblas_caxpy_batched (hipblasRocblas().rocblas_caxpy_batched)
+#define rocblas_caxpy_batched_64 (hipblasRocblas().rocblas_caxpy_batched_64)
+#define rocblas_caxpy_strided_batched (hipblasRocblas().rocblas_caxpy_strided_batched)
+#define rocblas_caxpy_strided_batched_64 (hipblasRocblas().rocblas_caxpy_strided_batched_64)
+#define rocblas_ccopy (hipblasRocblas().rocblas_ccopy)
+#define rocblas_ccopy_64 (hipblasRocblas().rocblas_ccopy_64)
+#define rocblas_ccopy_batched (hipblasRocblas().rocblas_ccopy_batched)
+#define rocblas_ccopy_batched_64 (hipblasRocblas().rocblas_ccopy_batched_64)
+#define rocblas_ccopy_strided_batched (hipblasRocblas().rocblas_ccopy_strided_batched)
+#define rocblas_ccopy_strided_batched_64 (hipblasRocblas().rocblas_ccopy_strided_batched_64)
+#define rocblas_cdgmm (hipblasRocblas().rocblas_cdgmm)
+#define rocblas_cdgmm_64 (hipblasRocblas().rocblas_cdgmm_64)
+#define rocblas_cdgmm_batched (hipblasRocblas().rocblas_cdgmm_batched)
+#define rocblas_cdgmm_batched_64 (hipblasRocblas().rocblas_cdgmm_batched_64)
+#define rocblas_cdgmm_strided_batched (hipblasRocblas().rocblas_cdgmm_strided_batched)
+#define rocblas_cdgmm_strided_batched_64 (hipblasRocblas().rocblas_cdgmm_strided_batched_64)
+#define rocblas_cdotc (hipblasRocblas().rocblas_cdotc)
+#define rocblas_cdotc_64 (hipblasRocblas().rocblas_cdotc_64)
+#define rocblas_cdotc_batched (hipblasRocblas().rocblas_cdotc_batched)
+#define rocblas_cdotc_batched_64 (hipblasRocblas().rocblas_cdotc_batched_64)
+#define rocblas_cdotc_strided_batched (hipblasRocblas().rocblas_cdotc_strided_batched)
+#define rocblas_cdotc_strided_batched_64 (hipblasRocblas().rocblas_cdotc_strided_batched_64)
+#define rocblas_cdotu (hipblasRocblas().rocblas_cdotu)
+#define rocblas_cdotu_64 (hipblasRocblas().rocblas_cdotu_64)
+#define rocblas_cdotu_batched (hipblasRocblas().rocblas_cdotu_batched)
+#define rocblas_cdotu_batched_64 (hipblasRocblas().rocblas_cdotu_batched_64)
+#define rocblas_cdotu_strided_batched (hipblasRocblas().rocblas_cdotu_strided_batched)
+#define rocblas_cdotu_strided_batched_64 (hipblasRocblas().rocblas_cdotu_strided_batched_64)
+#define rocblas_cgbmv (hipblasRocblas().rocblas_cgbmv)
+#define rocblas_cgbmv_64 (hipblasRocblas().rocblas_cgbmv_64)
+#define rocblas_cgbmv_batched (hipblasRocblas().rocblas_cgbmv_batched)
+#define rocblas_cgbmv_batched_64 (hipblasRocblas().rocblas_cgbmv_batched_64)
+#define rocblas_cgbmv_strided_batched (hipblasRocblas().rocblas_cgbmv_strided_batched)
+#define rocblas_cgbmv_strided_batched_64 (hipblasRocblas().rocblas_cgbmv_strided_batched_64)
+#define rocblas_cgeam (hipblasRocblas().rocblas_cgeam)
+#define rocblas_cgeam_64 (hipblasRocblas().rocblas_cgeam_64)
+#define rocblas_cgeam_batched (hipblasRocblas().rocblas_cgeam_batched)
+#define rocblas_cgeam_batched_64 (hipblasRocblas().rocblas_cgeam_batched_64)
+#define rocblas_cgeam_strided_batched (hipblasRocblas().rocblas_cgeam_strided_batched)
+#define rocblas_cgeam_strided_batched_64 (hipblasRocblas().rocblas_cgeam_strided_batched_64)
+#define rocblas_cgemm (hipblasRocblas().rocblas_cgemm)
+#define rocblas_cgemm_64 (hipblasRocblas().rocblas_cgemm_64)
+#define rocblas_cgemm_batched (hipblasRocblas().rocblas_cgemm_batched)
+#define rocblas_cgemm_batched_64 (hipblasRocblas().rocblas_cgemm_batched_64)
+#define rocblas_cgemm_strided_batched (hipblasRocblas().rocblas_cgemm_strided_batched)
+#define rocblas_cgemm_strided_batched_64 (hipblasRocblas().rocblas_cgemm_strided_batched_64)
+#define rocblas_cgemv (hipblasRocblas().rocblas_cgemv)
+#define rocblas_cgemv_64 (hipblasRocblas().rocblas_cgemv_64)
+#define rocblas_cgemv_batched (hipblasRocblas().rocblas_cgemv_batched)
+#define rocblas_cgemv_batched_64 (hipblasRocblas().rocblas_cgemv_batched_64)
+#define rocblas_cgemv_strided_batched (hipblasRocblas().rocblas_cgemv_strided_batched)
+#define rocblas_cgemv_strided_batched_64 (hipblasRocblas().rocblas_cgemv_strided_batched_64)
+#define rocblas_cgerc (hipblasRocblas().rocblas_cgerc)
+#define rocblas_cgerc_64 (hipblasRocblas().rocblas_cgerc_64)
+#define rocblas_cgerc_batched (hipblasRocblas().rocblas_cgerc_batched)
+#define rocblas_cgerc_batched_64 (hipblasRocblas().rocblas_cgerc_batched_64)
+#define rocblas_cgerc_strided_batched (hipblasRocblas().rocblas_cgerc_strided_batched)
+#define rocblas_cgerc_strided_batched_64 (hipblasRocblas().rocblas_cgerc_strided_batched_64)
+#define rocblas_cgeru (hipblasRocblas().rocblas_cgeru)
+#define rocblas_cgeru_64 (hipblasRocblas().rocblas_cgeru_64)
+#define rocblas_cgeru_batched (hipblasRocblas().rocblas_cgeru_batched)
+#define rocblas_cgeru_batched_64 (hipblasRocblas().rocblas_cgeru_batched_64)
+#define rocblas_cgeru_strided_batched (hipblasRocblas().rocblas_cgeru_strided_batched)
+#define rocblas_cgeru_strided_batched_64 (hipblasRocblas().rocblas_cgeru_strided_batched_64)
+#define rocblas_chbmv (hipblasRocblas().rocblas_chbmv)
+#define rocblas_chbmv_64 (hipblasRocblas().rocblas_chbmv_64)
+#define rocblas_chbmv_batched (hipblasRocblas().rocblas_chbmv_batched)
+#define rocblas_chbmv_batched_64 (hipblasRocblas().rocblas_chbmv_batched_64)
+#define rocblas_chbmv_strided_batched (hipblasRocblas().rocblas_chbmv_strided_batched)
+#define rocblas_chbmv_strided_batched_64 (hipblasRocblas().rocblas_chbmv_strided_batched_64)
+#define rocblas_chemm (hipblasRocblas().rocblas_chemm)
+#define rocblas_chemm_64 (hipblasRocblas().rocblas_chemm_64)
+#define rocblas_chemm_batched (hipblasRocblas().rocblas_chemm_batched)
+#define rocblas_chemm_batched_64 (hipblasRocblas().rocblas_chemm_batched_64)
+#define rocblas_chemm_strided_batched (hipblasRocblas().rocblas_chemm_strided_batched)
+#define rocblas_chemm_strided_batched_64 (hipblasRocblas().rocblas_chemm_strided_batched_64)
+#define rocblas_chemv (hipblasRocblas().rocblas_chemv)
+#define rocblas_chemv_64 (hipblasRocblas().rocblas_chemv_64)
+#define rocblas_chemv_batched (hipblasRocblas().rocblas_chemv_batched)
+#define rocblas_chemv_batched_64 (hipblasRocblas().rocblas_chemv_batched_64)
+#define rocblas_chemv_strided_batched (hipblasRocblas().rocblas_chemv_strided_batched)
+#define rocblas_chemv_strided_batched_64 (hipblasRocblas().rocblas_chemv_strided_batched_64)
+#define rocblas_cher (hipblasRocblas().rocblas_cher)
+#define rocblas_cher2 (hipblasRocblas().rocblas_cher2)
+#define rocblas_cher2_64 (hipblasRocblas().rocblas_cher2_64)
+#define rocblas_cher2_batched (hipblasRocblas().rocblas_cher2_batched)
+#define rocblas_cher2_batched_64 (hipblasRocblas().rocblas_cher2_batched_64)
+#define rocblas_cher2_strided_batched (hipblasRocblas().rocblas_cher2_strided_batched)
+#define rocblas_cher2_strided_batched_64 (hipblasRocblas().rocblas_cher2_strided_batched_64)
+#define rocblas_cher2k (hipblasRocblas().rocblas_cher2k)
+#define rocblas_cher2k_64 (hipblasRocblas().rocblas_cher2k_64)
+#define rocblas_cher2k_batched (hipblasRocblas().rocblas_cher2k_batched)
+#define rocblas_cher2k_batched_64 (hipblasRocblas().rocblas_cher2k_batched_64)
+#define rocblas_cher2k_strided_batched (hipblasRocblas().rocblas_cher2k_strided_batched)
+#define rocblas_cher2k_strided_batched_64 (hipblasRocblas().rocblas_cher2k_strided_batched_64)
+#define rocblas_cher_64 (hipblasRocblas().rocblas_cher_64)
+#define rocblas_cher_batched (hipblasRocblas().rocblas_cher_batched)
+#define rocblas_cher_batched_64 (hipblasRocblas().rocblas_cher_batched_64)
+#define rocblas_cher_strided_batched (hipblasRocblas().rocblas_cher_strided_batched)
+#define rocblas_cher_strided_batched_64 (hipblasRocblas().rocblas_cher_strided_batched_64)
+#define rocblas_cherk (hipblasRocblas().rocblas_cherk)
+#define rocblas_cherk_64 (hipblasRocblas().rocblas_cherk_64)
+#define rocblas_cherk_batched (hipblasRocblas().rocblas_cherk_batched)
+#define rocblas_cherk_batched_64 (hipblasRocblas().rocblas_cherk_batched_64)
+#define rocblas_cherk_strided_batched (hipblasRocblas().rocblas_cherk_strided_batched)
+#define rocblas_cherk_strided_batched_64 (hipblasRocblas().rocblas_cherk_strided_batched_64)
+#define rocblas_cherkx (hipblasRocblas().rocblas_cherkx)
+#define rocblas_cherkx_64 (hipblasRocblas().rocblas_cherkx_64)
+#define rocblas_cherkx_batched (hipblasRocblas().rocblas_cherkx_batched)
+#define rocblas_cherkx_batched_64 (hipblasRocblas().rocblas_cherkx_batched_64)
+#define rocblas_cherkx_strided_batched (hipblasRocblas().rocblas_cherkx_strided_batched)
+#define rocblas_cherkx_strided_batched_64 (hipblasRocblas().rocblas_cherkx_strided_batched_64)
+#define rocblas_chpmv (hipblasRocblas().rocblas_chpmv)
+#define rocblas_chpmv_64 (hipblasRocblas().rocblas_chpmv_64)
+#define rocblas_chpmv_batched (hipblasRocblas().rocblas_chpmv_batched)
+#define rocblas_chpmv_batched_64 (hipblasRocblas().rocblas_chpmv_batched_64)
+#define rocblas_chpmv_strided_batched (hipblasRocblas().rocblas_chpmv_strided_batched)
+#define rocblas_chpmv_strided_batched_64 (hipblasRocblas().rocblas_chpmv_strided_batched_64)
+#define rocblas_chpr (hipblasRocblas().rocblas_chpr)
+#define rocblas_chpr2 (hipblasRocblas().rocblas_chpr2)
+#define rocblas_chpr2_64 (hipblasRocblas().rocblas_chpr2_64)
+#define rocblas_chpr2_batched (hipblasRocblas().rocblas_chpr2_batched)
+#define rocblas_chpr2_batched_64 (hipblasRocblas().rocblas_chpr2_batched_64)
+#define rocblas_chpr2_strided_batched (hipblasRocblas().rocblas_chpr2_strided_batched)
+#define rocblas_chpr2_strided_batched_64 (hipblasRocblas().rocblas_chpr2_strided_batched_64)
+#define rocblas_chpr_64 (hipblasRocblas().rocblas_chpr_64)
+#define rocblas_chpr_batched (hipblasRocblas().rocblas_chpr_batched)
+#define rocblas_chpr_batched_64 (hipblasRocblas().rocblas_chpr_batched_64)
+#define rocblas_chpr_strided_batched (hipblasRocblas().rocblas_chpr_strided_batched)
+#define rocblas_chpr_strided_batched_64 (hipblasRocblas().rocblas_chpr_strided_batched_64)
+#define rocblas_create_handle (hipblasRocblas().rocblas_create_handle)
+#define rocblas_crot (hipblasRocblas().rocblas_crot)
+#define rocblas_crot_64 (hipblasRocblas().rocblas_crot_64)
+#define rocblas_crot_batched (hipblasRocblas().rocblas_crot_batched)
+#define rocblas_crot_batched_64 (hipblasRocblas().rocblas_crot_batched_64)
+#define rocblas_crot_strided_batched (hipblasRocblas().rocblas_crot_strided_batched)
+#define rocblas_crot_strided_batched_64 (hipblasRocblas().rocblas_crot_strided_batched_64)
+#define rocblas_crotg (hipblasRocblas().rocblas_crotg)
+#define rocblas_crotg_64 (hipblasRocblas().rocblas_crotg_64)
+#define rocblas_crotg_batched (hipblasRocblas().rocblas_crotg_batched)
+#define rocblas_crotg_batched_64 (hipblasRocblas().rocblas_crotg_batched_64)
+#define rocblas_crotg_strided_batched (hipblasRocblas().rocblas_crotg_strided_batched)
+#define rocblas_crotg_strided_batched_64 (hipblasRocblas().rocblas_crotg_strided_batched_64)
+#define rocblas_cscal (hipblasRocblas().rocblas_cscal)
+#define rocblas_cscal_64 (hipblasRocblas().rocblas_cscal_64)
+#define rocblas_cscal_batched (hipblasRocblas().rocblas_cscal_batched)
+#define rocblas_cscal_batched_64 (hipblasRocblas().rocblas_cscal_batched_64)
+#define rocblas_cscal_strided_batched (hipblasRocblas().rocblas_cscal_strided_batched)
+#define rocblas_cscal_strided_batched_64 (hipblasRocblas().rocblas_cscal_strided_batched_64)
+#define rocblas_cspr (hipblasRocblas().rocblas_cspr)
+#define rocblas_cspr_64 (hipblasRocblas().rocblas_cspr_64)
+#define rocblas_cspr_batched (hipblasRocblas().rocblas_cspr_batched)
+#define rocblas_cspr_batched_64 (hipblasRocblas().rocblas_cspr_batched_64)
+#define rocblas_cspr_strided_batched (hipblasRocblas().rocblas_cspr_strided_batched)
+#define rocblas_cspr_strided_batched_64 (hipblasRocblas().rocblas_cspr_strided_batched_64)
+#define rocblas_csrot (hipblasRocblas().rocblas_csrot)
+#define rocblas_csrot_64 (hipblasRocblas().rocblas_csrot_64)
+#define rocblas_csrot_batched (hipblasRocblas().rocblas_csrot_batched)
+#define rocblas_csrot_batched_64 (hipblasRocblas().rocblas_csrot_batched_64)
+#define rocblas_csrot_strided_batched (hipblasRocblas().rocblas_csrot_strided_batched)
+#define rocblas_csrot_strided_batched_64 (hipblasRocblas().rocblas_csrot_strided_batched_64)
+#define rocblas_csscal (hipblasRocblas().rocblas_csscal)
+#define rocblas_csscal_64 (hipblasRocblas().rocblas_csscal_64)
+#define rocblas_csscal_batched (hipblasRocblas().rocblas_csscal_batched)
+#define rocblas_csscal_batched_64 (hipblasRocblas().rocblas_csscal_batched_64)
+#define rocblas_csscal_strided_batched (hipblasRocblas().rocblas_csscal_strided_batched)
+#define rocblas_csscal_strided_batched_64 (hipblasRocblas().rocblas_csscal_strided_batched_64)
+#define rocblas_cswap (hipblasRocblas().rocblas_cswap)
+#define rocblas_cswap_64 (hipblasRocblas().rocblas_cswap_64)
+#define rocblas_cswap_batched (hipblasRocblas().rocblas_cswap_batched)
+#define rocblas_cswap_batched_64 (hipblasRocblas().rocblas_cswap_batched_64)
+#define rocblas_cswap_strided_batched (hipblasRocblas().rocblas_cswap_strided_batched)
+#define rocblas_cswap_strided_batched_64 (hipblasRocblas().rocblas_cswap_strided_batched_64)
+#define rocblas_csymm (hipblasRocblas().rocblas_csymm)
+#define rocblas_csymm_64 (hipblasRocblas().rocblas_csymm_64)
+#define rocblas_csymm_batched (hipblasRocblas().rocblas_csymm_batched)
+#define rocblas_csymm_batched_64 (hipblasRocblas().rocblas_csymm_batched_64)
+#define rocblas_csymm_strided_batched (hipblasRocblas().rocblas_csymm_strided_batched)
+#define rocblas_csymm_strided_batched_64 (hipblasRocblas().rocblas_csymm_strided_batched_64)
+#define rocblas_csymv (hipblasRocblas().rocblas_csymv)
+#define rocblas_csymv_64 (hipblasRocblas().rocblas_csymv_64)
+#define rocblas_csymv_batched (hipblasRocblas().rocblas_csymv_batched)
+#define rocblas_csymv_batched_64 (hipblasRocblas().rocblas_csymv_batched_64)
+#define rocblas_csymv_strided_batched (hipblasRocblas().rocblas_csymv_strided_batched)
+#define rocblas_csymv_strided_batched_64 (hipblasRocblas().rocblas_csymv_strided_batched_64)
+#define rocblas_csyr (hipblasRocblas().rocblas_csyr)
+#define rocblas_csyr2 (hipblasRocblas().rocblas_csyr2)
+#define rocblas_csyr2_64 (hipblasRocblas().rocblas_csyr2_64)
+#define rocblas_csyr2_batched (hipblasRocblas().rocblas_csyr2_batched)
+#define rocblas_csyr2_batched_64 (hipblasRocblas().rocblas_csyr2_batched_64)
+#define rocblas_csyr2_strided_batched (hipblasRocblas().rocblas_csyr2_strided_batched)
+#define rocblas_csyr2_strided_batched_64 (hipblasRocblas().rocblas_csyr2_strided_batched_64)
+#define rocblas_csyr2k (hipblasRocblas().rocblas_csyr2k)
+#define rocblas_csyr2k_64 (hipblasRocblas().rocblas_csyr2k_64)
+#define rocblas_csyr2k_batched (hipblasRocblas().rocblas_csyr2k_batched)
+#define rocblas_csyr2k_batched_64 (hipblasRocblas().rocblas_csyr2k_batched_64)
+#define rocblas_csyr2k_strided_batched (hipblasRocblas().rocblas_csyr2k_strided_batched)
+#define rocblas_csyr2k_strided_batched_64 (hipblasRocblas().rocblas_csyr2k_strided_batched_64)
+#define rocblas_csyr_64 (hipblasRocblas().rocblas_csyr_64)
+#define rocblas_csyr_batched (hipblasRocblas().rocblas_csyr_batched)
+#define rocblas_csyr_batched_64 (hipblasRocblas().rocblas_csyr_batched_64)
+#define rocblas_csyr_strided_batched (hipblasRocblas().rocblas_csyr_strided_batched)
+#define rocblas_csyr_strided_batched_64 (hipblasRocblas().rocblas_csyr_strided_batched_64)
+#define rocblas_csyrk (hipblasRocblas().rocblas_csyrk)
+#define rocblas_csyrk_64 (hipblasRocblas().rocblas_csyrk_64)
+#define rocblas_csyrk_batched (hipblasRocblas().rocblas_csyrk_batched)
+#define rocblas_csyrk_batched_64 (hipblasRocblas().rocblas_csyrk_batched_64)
+#define rocblas_csyrk_strided_batched (hipblasRocblas().rocblas_csyrk_strided_batched)
+#define rocblas_csyrk_strided_batched_64 (hipblasRocblas().rocblas_csyrk_strided_batched_64)
+#define rocblas_csyrkx (hipblasRocblas().rocblas_csyrkx)
+#define rocblas_csyrkx_64 (hipblasRocblas().rocblas_csyrkx_64)
+#define rocblas_csyrkx_batched (hipblasRocblas().rocblas_csyrkx_batched)
+#define rocblas_csyrkx_batched_64 (hipblasRocblas().rocblas_csyrkx_batched_64)
+#define rocblas_csyrkx_strided_batched (hipblasRocblas().rocblas_csyrkx_strided_batched)
+#define rocblas_csyrkx_strided_batched_64 (hipblasRocblas().rocblas_csyrkx_strided_batched_64)
+#define rocblas_ctbmv (hipblasRocblas().rocblas_ctbmv)
+#define rocblas_ctbmv_64 (hipblasRocblas().rocblas_ctbmv_64)
+#define rocblas_ctbmv_batched (hipblasRocblas().rocblas_ctbmv_batched)
+#define rocblas_ctbmv_batched_64 (hipblasRocblas().rocblas_ctbmv_batched_64)
+#define rocblas_ctbmv_strided_batched (hipblasRocblas().rocblas_ctbmv_strided_batched)
+#define rocblas_ctbmv_strided_batched_64 (hipblasRocblas().rocblas_ctbmv_strided_batched_64)
+#define rocblas_ctbsv (hipblasRocblas().rocblas_ctbsv)
+#define rocblas_ctbsv_64 (hipblasRocblas().rocblas_ctbsv_64)
+#define rocblas_ctbsv_batched (hipblasRocblas().rocblas_ctbsv_batched)
+#define rocblas_ctbsv_batched_64 (hipblasRocblas().rocblas_ctbsv_batched_64)
+#define rocblas_ctbsv_strided_batched (hipblasRocblas().rocblas_ctbsv_strided_batched)
+#define rocblas_ctbsv_strided_batched_64 (hipblasRocblas().rocblas_ctbsv_strided_batched_64)
+#define rocblas_ctpmv (hipblasRocblas().rocblas_ctpmv)
+#define rocblas_ctpmv_64 (hipblasRocblas().rocblas_ctpmv_64)
+#define rocblas_ctpmv_batched (hipblasRocblas().rocblas_ctpmv_batched)
+#define rocblas_ctpmv_batched_64 (hipblasRocblas().rocblas_ctpmv_batched_64)
+#define rocblas_ctpmv_strided_batched (hipblasRocblas().rocblas_ctpmv_strided_batched)
+#define rocblas_ctpmv_strided_batched_64 (hipblasRocblas().rocblas_ctpmv_strided_batched_64)
+#define rocblas_ctpsv (hipblasRocblas().rocblas_ctpsv)
+#define rocblas_ctpsv_64 (hipblasRocblas().rocblas_ctpsv_64)
+#define rocblas_ctpsv_batched (hipblasRocblas().rocblas_ctpsv_batched)
+#define rocblas_ctpsv_batched_64 (hipblasRocblas().rocblas_ctpsv_batched_64)
+#define rocblas_ctpsv_strided_batched (hipblasRocblas().rocblas_ctpsv_strided_batched)
+#define rocblas_ctpsv_strided_batched_64 (hipblasRocblas().rocblas_ctpsv_strided_batched_64)
+#define rocblas_ctrmm (hipblasRocblas().rocblas_ctrmm)
+#define rocblas_ctrmm_64 (hipblasRocblas().rocblas_ctrmm_64)
+#define rocblas_ctrmm_batched (hipblasRocblas().rocblas_ctrmm_batched)
+#define rocblas_ctrmm_batched_64 (hipblasRocblas().rocblas_ctrmm_batched_64)
+#define rocblas_ctrmm_strided_batched (hipblasRocblas().rocblas_ctrmm_strided_batched)
+#define rocblas_ctrmm_strided_batched_64 (hipblasRocblas().rocblas_ctrmm_strided_batched_64)
+#define rocblas_ctrmv (hipblasRocblas().rocblas_ctrmv)
+#define rocblas_ctrmv_64 (hipblasRocblas().rocblas_ctrmv_64)
+#define rocblas_ctrmv_batched (hipblasRocblas().rocblas_ctrmv_batched)
+#define rocblas_ctrmv_batched_64 (hipblasRocblas().rocblas_ctrmv_batched_64)
+#define rocblas_ctrmv_strided_batched (hipblasRocblas().rocblas_ctrmv_strided_batched)
+#define rocblas_ctrmv_strided_batched_64 (hipblasRocblas().rocblas_ctrmv_strided_batched_64)
+#define rocblas_ctrsm (hipblasRocblas().rocblas_ctrsm)
+#define rocblas_ctrsm_64 (hipblasRocblas().rocblas_ctrsm_64)
+#define rocblas_ctrsm_batched (hipblasRocblas().rocblas_ctrsm_batched)
+#define rocblas_ctrsm_batched_64 (hipblasRocblas().rocblas_ctrsm_batched_64)
+#define rocblas_ctrsm_strided_batched (hipblasRocblas().rocblas_ctrsm_strided_batched)
+#define rocblas_ctrsm_strided_batched_64 (hipblasRocblas().rocblas_ctrsm_strided_batched_64)
+#define rocblas_ctrsv (hipblasRocblas().rocblas_ctrsv)
+#define rocblas_ctrsv_64 (hipblasRocblas().rocblas_ctrsv_64)
+#define rocblas_ctrsv_batched (hipblasRocblas().rocblas_ctrsv_batched)
+#define rocblas_ctrsv_batched_64 (hipblasRocblas().rocblas_ctrsv_batched_64)
+#define rocblas_ctrsv_strided_batched (hipblasRocblas().rocblas_ctrsv_strided_batched)
+#define rocblas_ctrsv_strided_batched_64 (hipblasRocblas().rocblas_ctrsv_strided_batched_64)
+#define rocblas_ctrtri (hipblasRocblas().rocblas_ctrtri)
+#define rocblas_ctrtri_batched (hipblasRocblas().rocblas_ctrtri_batched)
+#define rocblas_ctrtri_strided_batched (hipblasRocblas().rocblas_ctrtri_strided_batched)
+#define rocblas_dasum (hipblasRocblas().rocblas_dasum)
+#define rocblas_dasum_64 (hipblasRocblas().rocblas_dasum_64)
+#define rocblas_dasum_batched (hipblasRocblas().rocblas_dasum_batched)
+#define rocblas_dasum_batched_64 (hipblasRocblas().rocblas_dasum_batched_64)
+#define rocblas_dasum_strided_batched (hipblasRocblas().rocblas_dasum_strided_batched)
+#define rocblas_dasum_strided_batched_64 (hipblasRocblas().rocblas_dasum_strided_batched_64)
+#define rocblas_daxpy (hipblasRocblas().rocblas_daxpy)
+#define rocblas_daxpy_64 (hipblasRocblas().rocblas_daxpy_64)
+#define rocblas_daxpy_batched (hipblasRocblas().rocblas_daxpy_batched)
+#define rocblas_daxpy_batched_64 (hipblasRocblas().rocblas_daxpy_batched_64)
+#define rocblas_daxpy_strided_batched (hipblasRocblas().rocblas_daxpy_strided_batched)
+#define rocblas_daxpy_strided_batched_64 (hipblasRocblas().rocblas_daxpy_strided_batched_64)
+#define rocblas_dcopy (hipblasRocblas().rocblas_dcopy)
+#define rocblas_dcopy_64 (hipblasRocblas().rocblas_dcopy_64)
+#define rocblas_dcopy_batched (hipblasRocblas().rocblas_dcopy_batched)
+#define rocblas_dcopy_batched_64 (hipblasRocblas().rocblas_dcopy_batched_64)
+#define rocblas_dcopy_strided_batched (hipblasRocblas().rocblas_dcopy_strided_batched)
+#define rocblas_dcopy_strided_batched_64 (hipblasRocblas().rocblas_dcopy_strided_batched_64)
+#define rocblas_ddgmm (hipblasRocblas().rocblas_ddgmm)
+#define rocblas_ddgmm_64 (hipblasRocblas().rocblas_ddgmm_64)
+#define rocblas_ddgmm_batched (hipblasRocblas().rocblas_ddgmm_batched)
+#define rocblas_ddgmm_batched_64 (hipblasRocblas().rocblas_ddgmm_batched_64)
+#define rocblas_ddgmm_strided_batched (hipblasRocblas().rocblas_ddgmm_strided_batched)
+#define rocblas_ddgmm_strided_batched_64 (hipblasRocblas().rocblas_ddgmm_strided_batched_64)
+#define rocblas_ddot (hipblasRocblas().rocblas_ddot)
+#define rocblas_ddot_64 (hipblasRocblas().rocblas_ddot_64)
+#define rocblas_ddot_batched (hipblasRocblas().rocblas_ddot_batched)
+#define rocblas_ddot_batched_64 (hipblasRocblas().rocblas_ddot_batched_64)
+#define rocblas_ddot_strided_batched (hipblasRocblas().rocblas_ddot_strided_batched)
+#define rocblas_ddot_strided_batched_64 (hipblasRocblas().rocblas_ddot_strided_batched_64)
+#define rocblas_destroy_handle (hipblasRocblas().rocblas_destroy_handle)
+#define rocblas_dgbmv (hipblasRocblas().rocblas_dgbmv)
+#define rocblas_dgbmv_64 (hipblasRocblas().rocblas_dgbmv_64)
+#define rocblas_dgbmv_batched (hipblasRocblas().rocblas_dgbmv_batched)
+#define rocblas_dgbmv_batched_64 (hipblasRocblas().rocblas_dgbmv_batched_64)
+#define rocblas_dgbmv_strided_batched (hipblasRocblas().rocblas_dgbmv_strided_batched)
+#define rocblas_dgbmv_strided_batched_64 (hipblasRocblas().rocblas_dgbmv_strided_batched_64)
+#define rocblas_dgeam (hipblasRocblas().rocblas_dgeam)
+#define rocblas_dgeam_64 (hipblasRocblas().rocblas_dgeam_64)
+#define rocblas_dgeam_batched (hipblasRocblas().rocblas_dgeam_batched)
+#define rocblas_dgeam_batched_64 (hipblasRocblas().rocblas_dgeam_batched_64)
+#define rocblas_dgeam_strided_batched (hipblasRocblas().rocblas_dgeam_strided_batched)
+#define rocblas_dgeam_strided_batched_64 (hipblasRocblas().rocblas_dgeam_strided_batched_64)
+#define rocblas_dgemm (hipblasRocblas().rocblas_dgemm)
+#define rocblas_dgemm_64 (hipblasRocblas().rocblas_dgemm_64)
+#define rocblas_dgemm_batched (hipblasRocblas().rocblas_dgemm_batched)
+#define rocblas_dgemm_batched_64 (hipblasRocblas().rocblas_dgemm_batched_64)
+#define rocblas_dgemm_strided_batched (hipblasRocblas().rocblas_dgemm_strided_batched)
+#define rocblas_dgemm_strided_batched_64 (hipblasRocblas().rocblas_dgemm_strided_batched_64)
+#define rocblas_dgemv (hipblasRocblas().rocblas_dgemv)
+#define rocblas_dgemv_64 (hipblasRocblas().rocblas_dgemv_64)
+#define rocblas_dgemv_batched (hipblasRocblas().rocblas_dgemv_batched)
+#define rocblas_dgemv_batched_64 (hipblasRocblas().rocblas_dgemv_batched_64)
+#define rocblas_dgemv_strided_batched (hipblasRocblas().rocblas_dgemv_strided_batched)
+#define rocblas_dgemv_strided_batched_64 (hipblasRocblas().rocblas_dgemv_strided_batched_64)
+#define rocblas_dger (hipblasRocblas().rocblas_dger)
+#define rocblas_dger_64 (hipblasRocblas().rocblas_dger_64)
+#define rocblas_dger_batched (hipblasRocblas().rocblas_dger_batched)
+#define rocblas_dger_batched_64 (hipblasRocblas().rocblas_dger_batched_64)
+#define rocblas_dger_strided_batched (hipblasRocblas().rocblas_dger_strided_batched)
+#define rocblas_dger_strided_batched_64 (hipblasRocblas().rocblas_dger_strided_batched_64)
+#define rocblas_dnrm2 (hipblasRocblas().rocblas_dnrm2)
+#define rocblas_dnrm2_64 (hipblasRocblas().rocblas_dnrm2_64)
+#define rocblas_dnrm2_batched (hipblasRocblas().rocblas_dnrm2_batched)
+#define rocblas_dnrm2_batched_64 (hipblasRocblas().rocblas_dnrm2_batched_64)
+#define rocblas_dnrm2_strided_batched (hipblasRocblas().rocblas_dnrm2_strided_batched)
+#define rocblas_dnrm2_strided_batched_64 (hipblasRocblas().rocblas_dnrm2_strided_batched_64)
+#define rocblas_dot_batched_ex (hipblasRocblas().rocblas_dot_batched_ex)
+#define rocblas_dot_batched_ex_64 (hipblasRocblas().rocblas_dot_batched_ex_64)
+#define rocblas_dot_ex (hipblasRocblas().rocblas_dot_ex)
+#define rocblas_dot_ex_64 (hipblasRocblas().rocblas_dot_ex_64)
+#define rocblas_dot_strided_batched_ex (hipblasRocblas().rocblas_dot_strided_batched_ex)
+#define rocblas_dot_strided_batched_ex_64 (hipblasRocblas().rocblas_dot_strided_batched_ex_64)
+#define rocblas_dotc_batched_ex (hipblasRocblas().rocblas_dotc_batched_ex)
+#define rocblas_dotc_batched_ex_64 (hipblasRocblas().rocblas_dotc_batched_ex_64)
+#define rocblas_dotc_ex (hipblasRocblas().rocblas_dotc_ex)
+#define rocblas_dotc_ex_64 (hipblasRocblas().rocblas_dotc_ex_64)
+#define rocblas_dotc_strided_batched_ex (hipblasRocblas().rocblas_dotc_strided_batched_ex)
+#define rocblas_dotc_strided_batched_ex_64 (hipblasRocblas().rocblas_dotc_strided_batched_ex_64)
+#define rocblas_drot (hipblasRocblas().rocblas_drot)
+#define rocblas_drot_64 (hipblasRocblas().rocblas_drot_64)
+#define rocblas_drot_batched (hipblasRocblas().rocblas_drot_batched)
+#define rocblas_drot_batched_64 (hipblasRocblas().rocblas_drot_batched_64)
+#define rocblas_drot_strided_batched (hipblasRocblas().rocblas_drot_strided_batched)
+#define rocblas_drot_strided_batched_64 (hipblasRocblas().rocblas_drot_strided_batched_64)
+#define rocblas_drotg (hipblasRocblas().rocblas_drotg)
+#define rocblas_drotg_64 (hipblasRocblas().rocblas_drotg_64)
+#define rocblas_drotg_batched (hipblasRocblas().rocblas_drotg_batched)
+#define rocblas_drotg_batched_64 (hipblasRocblas().rocblas_drotg_batched_64)
+#define rocblas_drotg_strided_batched (hipblasRocblas().rocblas_drotg_strided_batched)
+#define rocblas_drotg_strided_batched_64 (hipblasRocblas().rocblas_drotg_strided_batched_64)
+#define rocblas_drotm (hipblasRocblas().rocblas_drotm)
+#define rocblas_drotm_64 (hipblasRocblas().rocblas_drotm_64)
+#define rocblas_drotm_batched (hipblasRocblas().rocblas_drotm_batched)
+#define rocblas_drotm_batched_64 (hipblasRocblas().rocblas_drotm_batched_64)
+#define rocblas_drotm_strided_batched (hipblasRocblas().rocblas_drotm_strided_batched)
+#define rocblas_drotm_strided_batched_64 (hipblasRocblas().rocblas_drotm_strided_batched_64)
+#define rocblas_drotmg (hipblasRocblas().rocblas_drotmg)
+#define rocblas_drotmg_64 (hipblasRocblas().rocblas_drotmg_64)
+#define rocblas_drotmg_batched (hipblasRocblas().rocblas_drotmg_batched)
+#define rocblas_drotmg_batched_64 (hipblasRocblas().rocblas_drotmg_batched_64)
+#define rocblas_drotmg_strided_batched (hipblasRocblas().rocblas_drotmg_strided_batched)
+#define rocblas_drotmg_strided_batched_64 (hipblasRocblas().rocblas_drotmg_strided_batched_64)
+#define rocblas_dsbmv (hipblasRocblas().rocblas_dsbmv)
+#define rocblas_dsbmv_64 (hipblasRocblas().rocblas_dsbmv_64)
+#define rocblas_dsbmv_batched (hipblasRocblas().rocblas_dsbmv_batched)
+#define rocblas_dsbmv_batched_64 (hipblasRocblas().rocblas_dsbmv_batched_64)
+#define rocblas_dsbmv_strided_batched (hipblasRocblas().rocblas_dsbmv_strided_batched)
+#define rocblas_dsbmv_strided_batched_64 (hipblasRocblas().rocblas_dsbmv_strided_batched_64)
+#define rocblas_dscal (hipblasRocblas().rocblas_dscal)
+#define rocblas_dscal_64 (hipblasRocblas().rocblas_dscal_64)
+#define rocblas_dscal_batched (hipblasRocblas().rocblas_dscal_batched)
+#define rocblas_dscal_batched_64 (hipblasRocblas().rocblas_dscal_batched_64)
+#define rocblas_dscal_strided_batched (hipblasRocblas().rocblas_dscal_strided_batched)
+#define rocblas_dscal_strided_batched_64 (hipblasRocblas().rocblas_dscal_strided_batched_64)
+#define rocblas_dspmv (hipblasRocblas().rocblas_dspmv)
+#define rocblas_dspmv_64 (hipblasRocblas().rocblas_dspmv_64)
+#define rocblas_dspmv_batched (hipblasRocblas().rocblas_dspmv_batched)
+#define rocblas_dspmv_batched_64 (hipblasRocblas().rocblas_dspmv_batched_64)
+#define rocblas_dspmv_strided_batched (hipblasRocblas().rocblas_dspmv_strided_batched)
+#define rocblas_dspmv_strided_batched_64 (hipblasRocblas().rocblas_dspmv_strided_batched_64)
+#define rocblas_dspr (hipblasRocblas().rocblas_dspr)
+#define rocblas_dspr2 (hipblasRocblas().rocblas_dspr2)
+#define rocblas_dspr2_64 (hipblasRocblas().rocblas_dspr2_64)
+#define rocblas_dspr2_batched (hipblasRocblas().rocblas_dspr2_batched)
+#define rocblas_dspr2_batched_64 (hipblasRocblas().rocblas_dspr2_batched_64)
+#define rocblas_dspr2_strided_batched (hipblasRocblas().rocblas_dspr2_strided_batched)
+#define rocblas_dspr2_strided_batched_64 (hipblasRocblas().rocblas_dspr2_strided_batched_64)
+#define rocblas_dspr_64 (hipblasRocblas().rocblas_dspr_64)
+#define rocblas_dspr_batched (hipblasRocblas().rocblas_dspr_batched)
+#define rocblas_dspr_batched_64 (hipblasRocblas().rocblas_dspr_batched_64)
+#define rocblas_dspr_strided_batched (hipblasRocblas().rocblas_dspr_strided_batched)
+#define rocblas_dspr_strided_batched_64 (hipblasRocblas().rocblas_dspr_strided_batched_64)
+#define rocblas_dswap (hipblasRocblas().rocblas_dswap)
+#define rocblas_dswap_64 (hipblasRocblas().rocblas_dswap_64)
+#define rocblas_dswap_batched (hipblasRocblas().rocblas_dswap_batched)
+#define rocblas_dswap_batched_64 (hipblasRocblas().rocblas_dswap_batched_64)
+#define rocblas_dswap_strided_batched (hipblasRocblas().rocblas_dswap_strided_batched)
+#define rocblas_dswap_strided_batched_64 (hipblasRocblas().rocblas_dswap_strided_batched_64)
+#define rocblas_dsymm (hipblasRocblas().rocblas_dsymm)
+#define rocblas_dsymm_64 (hipblasRocblas().rocblas_dsymm_64)
+#define rocblas_dsymm_batched (hipblasRocblas().rocblas_dsymm_batched)
+#define rocblas_dsymm_batched_64 (hipblasRocblas().rocblas_dsymm_batched_64)
+#define rocblas_dsymm_strided_batched (hipblasRocblas().rocblas_dsymm_strided_batched)
+#define rocblas_dsymm_strided_batched_64 (hipblasRocblas().rocblas_dsymm_strided_batched_64)
+#define rocblas_dsymv (hipblasRocblas().rocblas_dsymv)
+#define rocblas_dsymv_64 (hipblasRocblas().rocblas_dsymv_64)
+#define rocblas_dsymv_batched (hipblasRocblas().rocblas_dsymv_batched)
+#define rocblas_dsymv_batched_64 (hipblasRocblas().rocblas_dsymv_batched_64)
+#define rocblas_dsymv_strided_batched (hipblasRocblas().rocblas_dsymv_strided_batched)
+#define rocblas_dsymv_strided_batched_64 (hipblasRocblas().rocblas_dsymv_strided_batched_64)
+#define rocblas_dsyr (hipblasRocblas().rocblas_dsyr)
+#define rocblas_dsyr2 (hipblasRocblas().rocblas_dsyr2)
+#define rocblas_dsyr2_64 (hipblasRocblas().rocblas_dsyr2_64)
+#define rocblas_dsyr2_batched (hipblasRocblas().rocblas_dsyr2_batched)
+#define rocblas_dsyr2_batched_64 (hipblasRocblas().rocblas_dsyr2_batched_64)
+#define rocblas_dsyr2_strided_batched (hipblasRocblas().rocblas_dsyr2_strided_batched)
+#define rocblas_dsyr2_strided_batched_64 (hipblasRocblas().rocblas_dsyr2_strided_batched_64)
+#define rocblas_dsyr2k (hipblasRocblas().rocblas_dsyr2k)
+#define rocblas_dsyr2k_64 (hipblasRocblas().rocblas_dsyr2k_64)
+#define rocblas_dsyr2k_batched (hipblasRocblas().rocblas_dsyr2k_batched)
+#define rocblas_dsyr2k_batched_64 (hipblasRocblas().rocblas_dsyr2k_batched_64)
+#define rocblas_dsyr2k_strided_batched (hipblasRocblas().rocblas_dsyr2k_strided_batched)
+#define rocblas_dsyr2k_strided_batched_64 (hipblasRocblas().rocblas_dsyr2k_strided_batched_64)
+#define rocblas_dsyr_64 (hipblasRocblas().rocblas_dsyr_64)
+#define rocblas_dsyr_batched (hipblasRocblas().rocblas_dsyr_batched)
+#define rocblas_dsyr_batched_64 (hipblasRocblas().rocblas_dsyr_batched_64)
+#define rocblas_dsyr_strided_batched (hipblasRocblas().rocblas_dsyr_strided_batched)
+#define rocblas_dsyr_strided_batched_64 (hipblasRocblas().rocblas_dsyr_strided_batched_64)
+#define rocblas_dsyrk (hipblasRocblas().rocblas_dsyrk)
+#define rocblas_dsyrk_64 (hipblasRocblas().rocblas_dsyrk_64)
+#define rocblas_dsyrk_batched (hipblasRocblas().rocblas_dsyrk_batched)
+#define rocblas_dsyrk_batched_64 (hipblasRocblas().rocblas_dsyrk_batched_64)
+#define rocblas_dsyrk_strided_batched (hipblasRocblas().rocblas_dsyrk_strided_batched)
+#define rocblas_dsyrk_strided_batched_64 (hipblasRocblas().rocblas_dsyrk_strided_batched_64)
+#define rocblas_dsyrkx (hipblasRocblas().rocblas_dsyrkx)
+#define rocblas_dsyrkx_64 (hipblasRocblas().rocblas_dsyrkx_64)
+#define rocblas_dsyrkx_batched (hipblasRocblas().rocblas_dsyrkx_batched)
+#define rocblas_dsyrkx_batched_64 (hipblasRocblas().rocblas_dsyrkx_batched_64)
+#define rocblas_dsyrkx_strided_batched (hipblasRocblas().rocblas_dsyrkx_strided_batched)
+#define rocblas_dsyrkx_strided_batched_64 (hipblasRocblas().rocblas_dsyrkx_strided_batched_64)
+#define rocblas_dtbmv (hipblasRocblas().rocblas_dtbmv)
+#define rocblas_dtbmv_64 (hipblasRocblas().rocblas_dtbmv_64)
+#define rocblas_dtbmv_batched (hipblasRocblas().rocblas_dtbmv_batched)
+#define rocblas_dtbmv_batched_64 (hipblasRocblas().rocblas_dtbmv_batched_64)
+#define rocblas_dtbmv_strided_batched (hipblasRocblas().rocblas_dtbmv_strided_batched)
+#define rocblas_dtbmv_strided_batched_64 (hipblasRocblas().rocblas_dtbmv_strided_batched_64)
+#define rocblas_dtbsv (hipblasRocblas().rocblas_dtbsv)
+#define rocblas_dtbsv_64 (hipblasRocblas().rocblas_dtbsv_64)
+#define rocblas_dtbsv_batched (hipblasRocblas().rocblas_dtbsv_batched)
+#define rocblas_dtbsv_batched_64 (hipblasRocblas().rocblas_dtbsv_batched_64)
+#define rocblas_dtbsv_strided_batched (hipblasRocblas().rocblas_dtbsv_strided_batched)
+#define rocblas_dtbsv_strided_batched_64 (hipblasRocblas().rocblas_dtbsv_strided_batched_64)
+#define rocblas_dtpmv (hipblasRocblas().rocblas_dtpmv)
+#define rocblas_dtpmv_64 (hipblasRocblas().rocblas_dtpmv_64)
+#define rocblas_dtpmv_batched (hipblasRocblas().rocblas_dtpmv_batched)
+#define rocblas_dtpmv_batched_64 (hipblasRocblas().rocblas_dtpmv_batched_64)
+#define rocblas_dtpmv_strided_batched (hipblasRocblas().rocblas_dtpmv_strided_batched)
+#define rocblas_dtpmv_strided_batched_64 (hipblasRocblas().rocblas_dtpmv_strided_batched_64)
+#define rocblas_dtpsv (hipblasRocblas().rocblas_dtpsv)
+#define rocblas_dtpsv_64 (hipblasRocblas().rocblas_dtpsv_64)
+#define rocblas_dtpsv_batched (hipblasRocblas().rocblas_dtpsv_batched)
+#define rocblas_dtpsv_batched_64 (hipblasRocblas().rocblas_dtpsv_batched_64)
+#define rocblas_dtpsv_strided_batched (hipblasRocblas().rocblas_dtpsv_strided_batched)
+#define rocblas_dtpsv_strided_batched_64 (hipblasRocblas().rocblas_dtpsv_strided_batched_64)
+#define rocblas_dtrmm (hipblasRocblas().rocblas_dtrmm)
+#define rocblas_dtrmm_64 (hipblasRocblas().rocblas_dtrmm_64)
+#define rocblas_dtrmm_batched (hipblasRocblas().rocblas_dtrmm_batched)
+#define rocblas_dtrmm_batched_64 (hipblasRocblas().rocblas_dtrmm_batched_64)
+#define rocblas_dtrmm_strided_batched (hipblasRocblas().rocblas_dtrmm_strided_batched)
+#define rocblas_dtrmm_strided_batched_64 (hipblasRocblas().rocblas_dtrmm_strided_batched_64)
+#define rocblas_dtrmv (hipblasRocblas().rocblas_dtrmv)
+#define rocblas_dtrmv_64 (hipblasRocblas().rocblas_dtrmv_64)
+#define rocblas_dtrmv_batched (hipblasRocblas().rocblas_dtrmv_batched)
+#define rocblas_dtrmv_batched_64 (hipblasRocblas().rocblas_dtrmv_batched_64)
+#define rocblas_dtrmv_strided_batched (hipblasRocblas().rocblas_dtrmv_strided_batched)
+#define rocblas_dtrmv_strided_batched_64 (hipblasRocblas().rocblas_dtrmv_strided_batched_64)
+#define rocblas_dtrsm (hipblasRocblas().rocblas_dtrsm)
+#define rocblas_dtrsm_64 (hipblasRocblas().rocblas_dtrsm_64)
+#define rocblas_dtrsm_batched (hipblasRocblas().rocblas_dtrsm_batched)
+#define rocblas_dtrsm_batched_64 (hipblasRocblas().rocblas_dtrsm_batched_64)
+#define rocblas_dtrsm_strided_batched (hipblasRocblas().rocblas_dtrsm_strided_batched)
+#define rocblas_dtrsm_strided_batched_64 (hipblasRocblas().rocblas_dtrsm_strided_batched_64)
+#define rocblas_dtrsv (hipblasRocblas().rocblas_dtrsv)
+#define rocblas_dtrsv_64 (hipblasRocblas().rocblas_dtrsv_64)
+#define rocblas_dtrsv_batched (hipblasRocblas().rocblas_dtrsv_batched)
+#define rocblas_dtrsv_batched_64 (hipblasRocblas().rocblas_dtrsv_batched_64)
+#define rocblas_dtrsv_strided_batched (hipblasRocblas().rocblas_dtrsv_strided_batched)
+#define rocblas_dtrsv_strided_batched_64 (hipblasRocblas().rocblas_dtrsv_strided_batched_64)
+#define rocblas_dtrtri (hipblasRocblas().rocblas_dtrtri)
+#define rocblas_dtrtri_batched (hipblasRocblas().rocblas_dtrtri_batched)
+#define rocblas_dtrtri_strided_batched (hipblasRocblas().rocblas_dtrtri_strided_batched)
+#define rocblas_dzasum (hipblasRocblas().rocblas_dzasum)
+#define rocblas_dzasum_64 (hipblasRocblas().rocblas_dzasum_64)
+#define rocblas_dzasum_batched (hipblasRocblas().rocblas_dzasum_batched)
+#define rocblas_dzasum_batched_64 (hipblasRocblas().rocblas_dzasum_batched_64)
+#define rocblas_dzasum_strided_batched (hipblasRocblas().rocblas_dzasum_strided_batched)
+#define rocblas_dzasum_strided_batched_64 (hipblasRocblas().rocblas_dzasum_strided_batched_64)
+#define rocblas_dznrm2 (hipblasRocblas().rocblas_dznrm2)
+#define rocblas_dznrm2_64 (hipblasRocblas().rocblas_dznrm2_64)
+#define rocblas_dznrm2_batched (hipblasRocblas().rocblas_dznrm2_batched)
+#define rocblas_dznrm2_batched_64 (hipblasRocblas().rocblas_dznrm2_batched_64)
+#define rocblas_dznrm2_strided_batched (hipblasRocblas().rocblas_dznrm2_strided_batched)
+#define rocblas_dznrm2_strided_batched_64 (hipblasRocblas().rocblas_dznrm2_strided_batched_64)
+#define rocblas_gemm_batched_ex (hipblasRocblas().rocblas_gemm_batched_ex)
+#define rocblas_gemm_batched_ex3 (hipblasRocblas().rocblas_gemm_batched_ex3)
+#define rocblas_gemm_batched_ex_64 (hipblasRocblas().rocblas_gemm_batched_ex_64)
+#define rocblas_gemm_batched_ex_get_solutions \
+    (hipblasRocblas().rocblas_gemm_batched_ex_get_solutions)
+#define rocblas_gemm_ex (hipblasRocblas().rocblas_gemm_ex)
+#define rocblas_gemm_ex3 (hipblasRocblas().rocblas_gemm_ex3)
+#define rocblas_gemm_ex_64 (hipblasRocblas().rocblas_gemm_ex_64)
+#define rocblas_gemm_ex_get_solutions (hipblasRocblas().rocblas_gemm_ex_get_solutions)
+#define rocblas_gemm_strided_batched_ex (hipblasRocblas().rocblas_gemm_strided_batched_ex)
+#define rocblas_gemm_strided_batched_ex3 (hipblasRocblas().rocblas_gemm_strided_batched_ex3)
+#define rocblas_gemm_strided_batched_ex_64 (hipblasRocblas().rocblas_gemm_strided_batched_ex_64)
+#define rocblas_gemm_strided_batched_ex_get_solutions \
+    (hipblasRocblas().rocblas_gemm_strided_batched_ex_get_solutions)
+#define rocblas_get_atomics_mode (hipblasRocblas().rocblas_get_atomics_mode)
+#define rocblas_get_device_memory_size (hipblasRocblas().rocblas_get_device_memory_size)
+#define rocblas_get_math_mode (hipblasRocblas().rocblas_get_math_mode)
+#define rocblas_get_matrix (hipblasRocblas().rocblas_get_matrix)
+#define rocblas_get_matrix_async (hipblasRocblas().rocblas_get_matrix_async)
+#define rocblas_get_pointer_mode (hipblasRocblas().rocblas_get_pointer_mode)
+#define rocblas_get_stream (hipblasRocblas().rocblas_get_stream)
+#define rocblas_get_vector (hipblasRocblas().rocblas_get_vector)
+#define rocblas_get_vector_async (hipblasRocblas().rocblas_get_vector_async)
+#define rocblas_get_version_string (hipblasRocblas().rocblas_get_version_string)
+#define rocblas_get_version_string_size (hipblasRocblas().rocblas_get_version_string_size)
+#define rocblas_haxpy (hipblasRocblas().rocblas_haxpy)
+#define rocblas_haxpy_64 (hipblasRocblas().rocblas_haxpy_64)
+#define rocblas_haxpy_batched (hipblasRocblas().rocblas_haxpy_batched)
+#define rocblas_haxpy_batched_64 (hipblasRocblas().rocblas_haxpy_batched_64)
+#define rocblas_haxpy_strided_batched (hipblasRocblas().rocblas_haxpy_strided_batched)
+#define rocblas_haxpy_strided_batched_64 (hipblasRocblas().rocblas_haxpy_strided_batched_64)
+#define rocblas_hdot (hipblasRocblas().rocblas_hdot)
+#define rocblas_hdot_64 (hipblasRocblas().rocblas_hdot_64)
+#define rocblas_hdot_batched (hipblasRocblas().rocblas_hdot_batched)
+#define rocblas_hdot_batched_64 (hipblasRocblas().rocblas_hdot_batched_64)
+#define rocblas_hdot_strided_batched (hipblasRocblas().rocblas_hdot_strided_batched)
+#define rocblas_hdot_strided_batched_64 (hipblasRocblas().rocblas_hdot_strided_batched_64)
+#define rocblas_hgemm (hipblasRocblas().rocblas_hgemm)
+#define rocblas_hgemm_64 (hipblasRocblas().rocblas_hgemm_64)
+#define rocblas_hgemm_batched (hipblasRocblas().rocblas_hgemm_batched)
+#define rocblas_hgemm_batched_64 (hipblasRocblas().rocblas_hgemm_batched_64)
+#define rocblas_hgemm_strided_batched (hipblasRocblas().rocblas_hgemm_strided_batched)
+#define rocblas_hgemm_strided_batched_64 (hipblasRocblas().rocblas_hgemm_strided_batched_64)
+#define rocblas_hshgemv_batched (hipblasRocblas().rocblas_hshgemv_batched)
+#define rocblas_hshgemv_strided_batched (hipblasRocblas().rocblas_hshgemv_strided_batched)
+#define rocblas_hssgemv_batched (hipblasRocblas().rocblas_hssgemv_batched)
+#define rocblas_hssgemv_strided_batched (hipblasRocblas().rocblas_hssgemv_strided_batched)
+#define rocblas_icamax (hipblasRocblas().rocblas_icamax)
+#define rocblas_icamax_64 (hipblasRocblas().rocblas_icamax_64)
+#define rocblas_icamax_batched (hipblasRocblas().rocblas_icamax_batched)
+#define rocblas_icamax_batched_64 (hipblasRocblas().rocblas_icamax_batched_64)
+#define rocblas_icamax_strided_batched (hipblasRocblas().rocblas_icamax_strided_batched)
+#define rocblas_icamax_strided_batched_64 (hipblasRocblas().rocblas_icamax_strided_batched_64)
+#define rocblas_icamin (hipblasRocblas().rocblas_icamin)
+#define rocblas_icamin_64 (hipblasRocblas().rocblas_icamin_64)
+#define rocblas_icamin_batched (hipblasRocblas().rocblas_icamin_batched)
+#define rocblas_icamin_batched_64 (hipblasRocblas().rocblas_icamin_batched_64)
+#define rocblas_icamin_strided_batched (hipblasRocblas().rocblas_icamin_strided_batched)
+#define rocblas_icamin_strided_batched_64 (hipblasRocblas().rocblas_icamin_strided_batched_64)
+#define rocblas_idamax (hipblasRocblas().rocblas_idamax)
+#define rocblas_idamax_64 (hipblasRocblas().rocblas_idamax_64)
+#define rocblas_idamax_batched (hipblasRocblas().rocblas_idamax_batched)
+#define rocblas_idamax_batched_64 (hipblasRocblas().rocblas_idamax_batched_64)
+#define rocblas_idamax_strided_batched (hipblasRocblas().rocblas_idamax_strided_batched)
+#define rocblas_idamax_strided_batched_64 (hipblasRocblas().rocblas_idamax_strided_batched_64)
+#define rocblas_idamin (hipblasRocblas().rocblas_idamin)
+#define rocblas_idamin_64 (hipblasRocblas().rocblas_idamin_64)
+#define rocblas_idamin_batched (hipblasRocblas().rocblas_idamin_batched)
+#define rocblas_idamin_batched_64 (hipblasRocblas().rocblas_idamin_batched_64)
+#define rocblas_idamin_strided_batched (hipblasRocblas().rocblas_idamin_strided_batched)
+#define rocblas_idamin_strided_batched_64 (hipblasRocblas().rocblas_idamin_strided_batched_64)
+#define rocblas_initialize (hipblasRocblas().rocblas_initialize)
+#define rocblas_is_device_memory_size_query (hipblasRocblas().rocblas_is_device_memory_size_query)
+#define rocblas_is_managing_device_memory (hipblasRocblas().rocblas_is_managing_device_memory)
+#define rocblas_is_user_managing_device_memory \
+    (hipblasRocblas().rocblas_is_user_managing_device_memory)
+#define rocblas_isamax (hipblasRocblas().rocblas_isamax)
+#define rocblas_isamax_64 (hipblasRocblas().rocblas_isamax_64)
+#define rocblas_isamax_batched (hipblasRocblas().rocblas_isamax_batched)
+#define rocblas_isamax_batched_64 (hipblasRocblas().rocblas_isamax_batched_64)
+#define rocblas_isamax_strided_batched (hipblasRocblas().rocblas_isamax_strided_batched)
+#define rocblas_isamax_strided_batched_64 (hipblasRocblas().rocblas_isamax_strided_batched_64)
+#define rocblas_isamin (hipblasRocblas().rocblas_isamin)
+#define rocblas_isamin_64 (hipblasRocblas().rocblas_isamin_64)
+#define rocblas_isamin_batched (hipblasRocblas().rocblas_isamin_batched)
+#define rocblas_isamin_batched_64 (hipblasRocblas().rocblas_isamin_batched_64)
+#define rocblas_isamin_strided_batched (hipblasRocblas().rocblas_isamin_strided_batched)
+#define rocblas_isamin_strided_batched_64 (hipblasRocblas().rocblas_isamin_strided_batched_64)
+#define rocblas_izamax (hipblasRocblas().rocblas_izamax)
+#define rocblas_izamax_64 (hipblasRocblas().rocblas_izamax_64)
+#define rocblas_izamax_batched (hipblasRocblas().rocblas_izamax_batched)
+#define rocblas_izamax_batched_64 (hipblasRocblas().rocblas_izamax_batched_64)
+#define rocblas_izamax_strided_batched (hipblasRocblas().rocblas_izamax_strided_batched)
+#define rocblas_izamax_strided_batched_64 (hipblasRocblas().rocblas_izamax_strided_batched_64)
+#define rocblas_izamin (hipblasRocblas().rocblas_izamin)
+#define rocblas_izamin_64 (hipblasRocblas().rocblas_izamin_64)
+#define rocblas_izamin_batched (hipblasRocblas().rocblas_izamin_batched)
+#define rocblas_izamin_batched_64 (hipblasRocblas().rocblas_izamin_batched_64)
+#define rocblas_izamin_strided_batched (hipblasRocblas().rocblas_izamin_strided_batched)
+#define rocblas_izamin_strided_batched_64 (hipblasRocblas().rocblas_izamin_strided_batched_64)
+#define rocblas_nrm2_batched_ex (hipblasRocblas().rocblas_nrm2_batched_ex)
+#define rocblas_nrm2_batched_ex_64 (hipblasRocblas().rocblas_nrm2_batched_ex_64)
+#define rocblas_nrm2_ex (hipblasRocblas().rocblas_nrm2_ex)
+#define rocblas_nrm2_ex_64 (hipblasRocblas().rocblas_nrm2_ex_64)
+#define rocblas_nrm2_strided_batched_ex (hipblasRocblas().rocblas_nrm2_strided_batched_ex)
+#define rocblas_nrm2_strided_batched_ex_64 (hipblasRocblas().rocblas_nrm2_strided_batched_ex_64)
+#define rocblas_rot_batched_ex (hipblasRocblas().rocblas_rot_batched_ex)
+#define rocblas_rot_batched_ex_64 (hipblasRocblas().rocblas_rot_batched_ex_64)
+#define rocblas_rot_ex (hipblasRocblas().rocblas_rot_ex)
+#define rocblas_rot_ex_64 (hipblasRocblas().rocblas_rot_ex_64)
+#define rocblas_rot_strided_batched_ex (hipblasRocblas().rocblas_rot_strided_batched_ex)
+#define rocblas_rot_strided_batched_ex_64 (hipblasRocblas().rocblas_rot_strided_batched_ex_64)
+#define rocblas_sasum (hipblasRocblas().rocblas_sasum)
+#define rocblas_sasum_64 (hipblasRocblas().rocblas_sasum_64)
+#define rocblas_sasum_batched (hipblasRocblas().rocblas_sasum_batched)
+#define rocblas_sasum_batched_64 (hipblasRocblas().rocblas_sasum_batched_64)
+#define rocblas_sasum_strided_batched (hipblasRocblas().rocblas_sasum_strided_batched)
+#define rocblas_sasum_strided_batched_64 (hipblasRocblas().rocblas_sasum_strided_batched_64)
+#define rocblas_saxpy (hipblasRocblas().rocblas_saxpy)
+#define rocblas_saxpy_64 (hipblasRocblas().rocblas_saxpy_64)
+#define rocblas_saxpy_batched (hipblasRocblas().rocblas_saxpy_batched)
+#define rocblas_saxpy_batched_64 (hipblasRocblas().rocblas_saxpy_batched_64)
+#define rocblas_saxpy_strided_batched (hipblasRocblas().rocblas_saxpy_strided_batched)
+#define rocblas_saxpy_strided_batched_64 (hipblasRocblas().rocblas_saxpy_strided_batched_64)
+#define rocblas_scal_batched_ex (hipblasRocblas().rocblas_scal_batched_ex)
+#define rocblas_scal_batched_ex_64 (hipblasRocblas().rocblas_scal_batched_ex_64)
+#define rocblas_scal_ex (hipblasRocblas().rocblas_scal_ex)
+#define rocblas_scal_ex_64 (hipblasRocblas().rocblas_scal_ex_64)
+#define rocblas_scal_strided_batched_ex (hipblasRocblas().rocblas_scal_strided_batched_ex)
+#define rocblas_scal_strided_batched_ex_64 (hipblasRocblas().rocblas_scal_strided_batched_ex_64)
+#define rocblas_scasum (hipblasRocblas().rocblas_scasum)
+#define rocblas_scasum_64 (hipblasRocblas().rocblas_scasum_64)
+#define rocblas_scasum_batched (hipblasRocblas().rocblas_scasum_batched)
+#define rocblas_scasum_batched_64 (hipblasRocblas().rocblas_scasum_batched_64)
+#define rocblas_scasum_strided_batched (hipblasRocblas().rocblas_scasum_strided_batched)
+#define rocblas_scasum_strided_batched_64 (hipblasRocblas().rocblas_scasum_strided_batched_64)
+#define rocblas_scnrm2 (hipblasRocblas().rocblas_scnrm2)
+#define rocblas_scnrm2_64 (hipblasRocblas().rocblas_scnrm2_64)
+#define rocblas_scnrm2_batched (hipblasRocblas().rocblas_scnrm2_batched)
+#define rocblas_scnrm2_batched_64 (hipblasRocblas().rocblas_scnrm2_batched_64)
+#define rocblas_scnrm2_strided_batched (hipblasRocblas().rocblas_scnrm2_strided_batched)
+#define rocblas_scnrm2_strided_batched_64 (hipblasRocblas().rocblas_scnrm2_strided_batched_64)
+#define rocblas_scopy (hipblasRocblas().rocblas_scopy)
+#define rocblas_scopy_64 (hipblasRocblas().rocblas_scopy_64)
+#define rocblas_scopy_batched (hipblasRocblas().rocblas_scopy_batched)
+#define rocblas_scopy_batched_64 (hipblasRocblas().rocblas_scopy_batched_64)
+#define rocblas_scopy_strided_batched (hipblasRocblas().rocblas_scopy_strided_batched)
+#define rocblas_scopy_strided_batched_64 (hipblasRocblas().rocblas_scopy_strided_batched_64)
+#define rocblas_sdgmm (hipblasRocblas().rocblas_sdgmm)
+#define rocblas_sdgmm_64 (hipblasRocblas().rocblas_sdgmm_64)
+#define rocblas_sdgmm_batched (hipblasRocblas().rocblas_sdgmm_batched)
+#define rocblas_sdgmm_batched_64 (hipblasRocblas().rocblas_sdgmm_batched_64)
+#define rocblas_sdgmm_strided_batched (hipblasRocblas().rocblas_sdgmm_strided_batched)
+#define rocblas_sdgmm_strided_batched_64 (hipblasRocblas().rocblas_sdgmm_strided_batched_64)
+#define rocblas_sdot (hipblasRocblas().rocblas_sdot)
+#define rocblas_sdot_64 (hipblasRocblas().rocblas_sdot_64)
+#define rocblas_sdot_batched (hipblasRocblas().rocblas_sdot_batched)
+#define rocblas_sdot_batched_64 (hipblasRocblas().rocblas_sdot_batched_64)
+#define rocblas_sdot_strided_batched (hipblasRocblas().rocblas_sdot_strided_batched)
+#define rocblas_sdot_strided_batched_64 (hipblasRocblas().rocblas_sdot_strided_batched_64)
+#define rocblas_set_atomics_mode (hipblasRocblas().rocblas_set_atomics_mode)
+#define rocblas_set_device_memory_size (hipblasRocblas().rocblas_set_device_memory_size)
+#define rocblas_set_math_mode (hipblasRocblas().rocblas_set_math_mode)
+#define rocblas_set_matrix (hipblasRocblas().rocblas_set_matrix)
+#define rocblas_set_matrix_async (hipblasRocblas().rocblas_set_matrix_async)
+#define rocblas_set_pointer_mode (hipblasRocblas().rocblas_set_pointer_mode)
+#define rocblas_set_stream (hipblasRocblas().rocblas_set_stream)
+#define rocblas_set_vector (hipblasRocblas().rocblas_set_vector)
+#define rocblas_set_vector_async (hipblasRocblas().rocblas_set_vector_async)
+#define rocblas_set_workspace (hipblasRocblas().rocblas_set_workspace)
+#define rocblas_sgbmv (hipblasRocblas().rocblas_sgbmv)
+#define rocblas_sgbmv_64 (hipblasRocblas().rocblas_sgbmv_64)
+#define rocblas_sgbmv_batched (hipblasRocblas().rocblas_sgbmv_batched)
+#define rocblas_sgbmv_batched_64 (hipblasRocblas().rocblas_sgbmv_batched_64)
+#define rocblas_sgbmv_strided_batched (hipblasRocblas().rocblas_sgbmv_strided_batched)
+#define rocblas_sgbmv_strided_batched_64 (hipblasRocblas().rocblas_sgbmv_strided_batched_64)
+#define rocblas_sgeam (hipblasRocblas().rocblas_sgeam)
+#define rocblas_sgeam_64 (hipblasRocblas().rocblas_sgeam_64)
+#define rocblas_sgeam_batched (hipblasRocblas().rocblas_sgeam_batched)
+#define rocblas_sgeam_batched_64 (hipblasRocblas().rocblas_sgeam_batched_64)
+#define rocblas_sgeam_strided_batched (hipblasRocblas().rocblas_sgeam_strided_batched)
+#define rocblas_sgeam_strided_batched_64 (hipblasRocblas().rocblas_sgeam_strided_batched_64)
+#define rocblas_sgemm (hipblasRocblas().rocblas_sgemm)
+#define rocblas_sgemm_64 (hipblasRocblas().rocblas_sgemm_64)
+#define rocblas_sgemm_batched (hipblasRocblas().rocblas_sgemm_batched)
+#define rocblas_sgemm_batched_64 (hipblasRocblas().rocblas_sgemm_batched_64)
+#define rocblas_sgemm_strided_batched (hipblasRocblas().rocblas_sgemm_strided_batched)
+#define rocblas_sgemm_strided_batched_64 (hipblasRocblas().rocblas_sgemm_strided_batched_64)
+#define rocblas_sgemv (hipblasRocblas().rocblas_sgemv)
+#define rocblas_sgemv_64 (hipblasRocblas().rocblas_sgemv_64)
+#define rocblas_sgemv_batched (hipblasRocblas().rocblas_sgemv_batched)
+#define rocblas_sgemv_batched_64 (hipblasRocblas().rocblas_sgemv_batched_64)
+#define rocblas_sgemv_strided_batched (hipblasRocblas().rocblas_sgemv_strided_batched)
+#define rocblas_sgemv_strided_batched_64 (hipblasRocblas().rocblas_sgemv_strided_batched_64)
+#define rocblas_sger (hipblasRocblas().rocblas_sger)
+#define rocblas_sger_64 (hipblasRocblas().rocblas_sger_64)
+#define rocblas_sger_batched (hipblasRocblas().rocblas_sger_batched)
+#define rocblas_sger_batched_64 (hipblasRocblas().rocblas_sger_batched_64)
+#define rocblas_sger_strided_batched (hipblasRocblas().rocblas_sger_strided_batched)
+#define rocblas_sger_strided_batched_64 (hipblasRocblas().rocblas_sger_strided_batched_64)
+#define rocblas_snrm2 (hipblasRocblas().rocblas_snrm2)
+#define rocblas_snrm2_64 (hipblasRocblas().rocblas_snrm2_64)
+#define rocblas_snrm2_batched (hipblasRocblas().rocblas_snrm2_batched)
+#define rocblas_snrm2_batched_64 (hipblasRocblas().rocblas_snrm2_batched_64)
+#define rocblas_snrm2_strided_batched (hipblasRocblas().rocblas_snrm2_strided_batched)
+#define rocblas_snrm2_strided_batched_64 (hipblasRocblas().rocblas_snrm2_strided_batched_64)
+#define rocblas_srot (hipblasRocblas().rocblas_srot)
+#define rocblas_srot_64 (hipblasRocblas().rocblas_srot_64)
+#define rocblas_srot_batched (hipblasRocblas().rocblas_srot_batched)
+#define rocblas_srot_batched_64 (hipblasRocblas().rocblas_srot_batched_64)
+#define rocblas_srot_strided_batched (hipblasRocblas().rocblas_srot_strided_batched)
+#define rocblas_srot_strided_batched_64 (hipblasRocblas().rocblas_srot_strided_batched_64)
+#define rocblas_srotg (hipblasRocblas().rocblas_srotg)
+#define rocblas_srotg_64 (hipblasRocblas().rocblas_srotg_64)
+#define rocblas_srotg_batched (hipblasRocblas().rocblas_srotg_batched)
+#define rocblas_srotg_batched_64 (hipblasRocblas().rocblas_srotg_batched_64)
+#define rocblas_srotg_strided_batched (hipblasRocblas().rocblas_srotg_strided_batched)
+#define rocblas_srotg_strided_batched_64 (hipblasRocblas().rocblas_srotg_strided_batched_64)
+#define rocblas_srotm (hipblasRocblas().rocblas_srotm)
+#define rocblas_srotm_64 (hipblasRocblas().rocblas_srotm_64)
+#define rocblas_srotm_batched (hipblasRocblas().rocblas_srotm_batched)
+#define rocblas_srotm_batched_64 (hipblasRocblas().rocblas_srotm_batched_64)
+#define rocblas_srotm_strided_batched (hipblasRocblas().rocblas_srotm_strided_batched)
+#define rocblas_srotm_strided_batched_64 (hipblasRocblas().rocblas_srotm_strided_batched_64)
+#define rocblas_srotmg (hipblasRocblas().rocblas_srotmg)
+#define rocblas_srotmg_64 (hipblasRocblas().rocblas_srotmg_64)
+#define rocblas_srotmg_batched (hipblasRocblas().rocblas_srotmg_batched)
+#define rocblas_srotmg_batched_64 (hipblasRocblas().rocblas_srotmg_batched_64)
+#define rocblas_srotmg_strided_batched (hipblasRocblas().rocblas_srotmg_strided_batched)
+#define rocblas_srotmg_strided_batched_64 (hipblasRocblas().rocblas_srotmg_strided_batched_64)
+#define rocblas_ssbmv (hipblasRocblas().rocblas_ssbmv)
+#define rocblas_ssbmv_64 (hipblasRocblas().rocblas_ssbmv_64)
+#define rocblas_ssbmv_batched (hipblasRocblas().rocblas_ssbmv_batched)
+#define rocblas_ssbmv_batched_64 (hipblasRocblas().rocblas_ssbmv_batched_64)
+#define rocblas_ssbmv_strided_batched (hipblasRocblas().rocblas_ssbmv_strided_batched)
+#define rocblas_ssbmv_strided_batched_64 (hipblasRocblas().rocblas_ssbmv_strided_batched_64)
+#define rocblas_sscal (hipblasRocblas().rocblas_sscal)
+#define rocblas_sscal_64 (hipblasRocblas().rocblas_sscal_64)
+#define rocblas_sscal_batched (hipblasRocblas().rocblas_sscal_batched)
+#define rocblas_sscal_batched_64 (hipblasRocblas().rocblas_sscal_batched_64)
+#define rocblas_sscal_strided_batched (hipblasRocblas().rocblas_sscal_strided_batched)
+#define rocblas_sscal_strided_batched_64 (hipblasRocblas().rocblas_sscal_strided_batched_64)
+#define rocblas_sspmv (hipblasRocblas().rocblas_sspmv)
+#define rocblas_sspmv_64 (hipblasRocblas().rocblas_sspmv_64)
+#define rocblas_sspmv_batched (hipblasRocblas().rocblas_sspmv_batched)
+#define rocblas_sspmv_batched_64 (hipblasRocblas().rocblas_sspmv_batched_64)
+#define rocblas_sspmv_strided_batched (hipblasRocblas().rocblas_sspmv_strided_batched)
+#define rocblas_sspmv_strided_batched_64 (hipblasRocblas().rocblas_sspmv_strided_batched_64)
+#define rocblas_sspr (hipblasRocblas().rocblas_sspr)
+#define rocblas_sspr2 (hipblasRocblas().rocblas_sspr2)
+#define rocblas_sspr2_64 (hipblasRocblas().rocblas_sspr2_64)
+#define rocblas_sspr2_batched (hipblasRocblas().rocblas_sspr2_batched)
+#define rocblas_sspr2_batched_64 (hipblasRocblas().rocblas_sspr2_batched_64)
+#define rocblas_sspr2_strided_batched (hipblasRocblas().rocblas_sspr2_strided_batched)
+#define rocblas_sspr2_strided_batched_64 (hipblasRocblas().rocblas_sspr2_strided_batched_64)
+#define rocblas_sspr_64 (hipblasRocblas().rocblas_sspr_64)
+#define rocblas_sspr_batched (hipblasRocblas().rocblas_sspr_batched)
+#define rocblas_sspr_batched_64 (hipblasRocblas().rocblas_sspr_batched_64)
+#define rocblas_sspr_strided_batched (hipblasRocblas().rocblas_sspr_strided_batched)
+#define rocblas_sspr_strided_batched_64 (hipblasRocblas().rocblas_sspr_strided_batched_64)
+#define rocblas_sswap (hipblasRocblas().rocblas_sswap)
+#define rocblas_sswap_64 (hipblasRocblas().rocblas_sswap_64)
+#define rocblas_sswap_batched (hipblasRocblas().rocblas_sswap_batched)
+#define rocblas_sswap_batched_64 (hipblasRocblas().rocblas_sswap_batched_64)
+#define rocblas_sswap_strided_batched (hipblasRocblas().rocblas_sswap_strided_batched)
+#define rocblas_sswap_strided_batched_64 (hipblasRocblas().rocblas_sswap_strided_batched_64)
+#define rocblas_ssymm (hipblasRocblas().rocblas_ssymm)
+#define rocblas_ssymm_64 (hipblasRocblas().rocblas_ssymm_64)
+#define rocblas_ssymm_batched (hipblasRocblas().rocblas_ssymm_batched)
+#define rocblas_ssymm_batched_64 (hipblasRocblas().rocblas_ssymm_batched_64)
+#define rocblas_ssymm_strided_batched (hipblasRocblas().rocblas_ssymm_strided_batched)
+#define rocblas_ssymm_strided_batched_64 (hipblasRocblas().rocblas_ssymm_strided_batched_64)
+#define rocblas_ssymv (hipblasRocblas().rocblas_ssymv)
+#define rocblas_ssymv_64 (hipblasRocblas().rocblas_ssymv_64)
+#define rocblas_ssymv_batched (hipblasRocblas().rocblas_ssymv_batched)
+#define rocblas_ssymv_batched_64 (hipblasRocblas().rocblas_ssymv_batched_64)
+#define rocblas_ssymv_strided_batched (hipblasRocblas().rocblas_ssymv_strided_batched)
+#define rocblas_ssymv_strided_batched_64 (hipblasRocblas().rocblas_ssymv_strided_batched_64)
+#define rocblas_ssyr (hipblasRocblas().rocblas_ssyr)
+#define rocblas_ssyr2 (hipblasRocblas().rocblas_ssyr2)
+#define rocblas_ssyr2_64 (hipblasRocblas().rocblas_ssyr2_64)
+#define rocblas_ssyr2_batched (hipblasRocblas().rocblas_ssyr2_batched)
+#define rocblas_ssyr2_batched_64 (hipblasRocblas().rocblas_ssyr2_batched_64)
+#define rocblas_ssyr2_strided_batched (hipblasRocblas().rocblas_ssyr2_strided_batched)
+#define rocblas_ssyr2_strided_batched_64 (hipblasRocblas().rocblas_ssyr2_strided_batched_64)
+#define rocblas_ssyr2k (hipblasRocblas().rocblas_ssyr2k)
+#define rocblas_ssyr2k_64 (hipblasRocblas().rocblas_ssyr2k_64)
+#define rocblas_ssyr2k_batched (hipblasRocblas().rocblas_ssyr2k_batched)
+#define rocblas_ssyr2k_batched_64 (hipblasRocblas().rocblas_ssyr2k_batched_64)
+#define rocblas_ssyr2k_strided_batched (hipblasRocblas().rocblas_ssyr2k_strided_batched)
+#define rocblas_ssyr2k_strided_batched_64 (hipblasRocblas().rocblas_ssyr2k_strided_batched_64)
+#define rocblas_ssyr_64 (hipblasRocblas().rocblas_ssyr_64)
+#define rocblas_ssyr_batched (hipblasRocblas().rocblas_ssyr_batched)
+#define rocblas_ssyr_batched_64 (hipblasRocblas().rocblas_ssyr_batched_64)
+#define rocblas_ssyr_strided_batched (hipblasRocblas().rocblas_ssyr_strided_batched)
+#define rocblas_ssyr_strided_batched_64 (hipblasRocblas().rocblas_ssyr_strided_batched_64)
+#define rocblas_ssyrk (hipblasRocblas().rocblas_ssyrk)
+#define rocblas_ssyrk_64 (hipblasRocblas().rocblas_ssyrk_64)
+#define rocblas_ssyrk_batched (hipblasRocblas().rocblas_ssyrk_batched)
+#define rocblas_ssyrk_batched_64 (hipblasRocblas().rocblas_ssyrk_batched_64)
+#define rocblas_ssyrk_strided_batched (hipblasRocblas().rocblas_ssyrk_strided_batched)
+#define rocblas_ssyrk_strided_batched_64 (hipblasRocblas().rocblas_ssyrk_strided_batched_64)
+#define rocblas_ssyrkx (hipblasRocblas().rocblas_ssyrkx)
+#define rocblas_ssyrkx_64 (hipblasRocblas().rocblas_ssyrkx_64)
+#define rocblas_ssyrkx_batched (hipblasRocblas().rocblas_ssyrkx_batched)
+#define rocblas_ssyrkx_batched_64 (hipblasRocblas().rocblas_ssyrkx_batched_64)
+#define rocblas_ssyrkx_strided_batched (hipblasRocblas().rocblas_ssyrkx_strided_batched)
+#define rocblas_ssyrkx_strided_batched_64 (hipblasRocblas().rocblas_ssyrkx_strided_batched_64)
+#define rocblas_start_device_memory_size_query \
+    (hipblasRocblas().rocblas_start_device_memory_size_query)
+#define rocblas_stbmv (hipblasRocblas().rocblas_stbmv)
+#define rocblas_stbmv_64 (hipblasRocblas().rocblas_stbmv_64)
+#define rocblas_stbmv_batched (hipblasRocblas().rocblas_stbmv_batched)
+#define rocblas_stbmv_batched_64 (hipblasRocblas().rocblas_stbmv_batched_64)
+#define rocblas_stbmv_strided_batched (hipblasRocblas().rocblas_stbmv_strided_batched)
+#define rocblas_stbmv_strided_batched_64 (hipblasRocblas().rocblas_stbmv_strided_batched_64)
+#define rocblas_stbsv (hipblasRocblas().rocblas_stbsv)
+#define rocblas_stbsv_64 (hipblasRocblas().rocblas_stbsv_64)
+#define rocblas_stbsv_batched (hipblasRocblas().rocblas_stbsv_batched)
+#define rocblas_stbsv_batched_64 (hipblasRocblas().rocblas_stbsv_batched_64)
+#define rocblas_stbsv_strided_batched (hipblasRocblas().rocblas_stbsv_strided_batched)
+#define rocblas_stbsv_strided_batched_64 (hipblasRocblas().rocblas_stbsv_strided_batched_64)
+#define rocblas_stop_device_memory_size_query \
+    (hipblasRocblas().rocblas_stop_device_memory_size_query)
+#define rocblas_stpmv (hipblasRocblas().rocblas_stpmv)
+#define rocblas_stpmv_64 (hipblasRocblas().rocblas_stpmv_64)
+#define rocblas_stpmv_batched (hipblasRocblas().rocblas_stpmv_batched)
+#define rocblas_stpmv_batched_64 (hipblasRocblas().rocblas_stpmv_batched_64)
+#define rocblas_stpmv_strided_batched (hipblasRocblas().rocblas_stpmv_strided_batched)
+#define rocblas_stpmv_strided_batched_64 (hipblasRocblas().rocblas_stpmv_strided_batched_64)
+#define rocblas_stpsv (hipblasRocblas().rocblas_stpsv)
+#define rocblas_stpsv_64 (hipblasRocblas().rocblas_stpsv_64)
+#define rocblas_stpsv_batched (hipblasRocblas().rocblas_stpsv_batched)
+#define rocblas_stpsv_batched_64 (hipblasRocblas().rocblas_stpsv_batched_64)
+#define rocblas_stpsv_strided_batched (hipblasRocblas().rocblas_stpsv_strided_batched)
+#define rocblas_stpsv_strided_batched_64 (hipblasRocblas().rocblas_stpsv_strided_batched_64)
+#define rocblas_strmm (hipblasRocblas().rocblas_strmm)
+#define rocblas_strmm_64 (hipblasRocblas().rocblas_strmm_64)
+#define rocblas_strmm_batched (hipblasRocblas().rocblas_strmm_batched)
+#define rocblas_strmm_batched_64 (hipblasRocblas().rocblas_strmm_batched_64)
+#define rocblas_strmm_strided_batched (hipblasRocblas().rocblas_strmm_strided_batched)
+#define rocblas_strmm_strided_batched_64 (hipblasRocblas().rocblas_strmm_strided_batched_64)
+#define rocblas_strmv (hipblasRocblas().rocblas_strmv)
+#define rocblas_strmv_64 (hipblasRocblas().rocblas_strmv_64)
+#define rocblas_strmv_batched (hipblasRocblas().rocblas_strmv_batched)
+#define rocblas_strmv_batched_64 (hipblasRocblas().rocblas_strmv_batched_64)
+#define rocblas_strmv_strided_batched (hipblasRocblas().rocblas_strmv_strided_batched)
+#define rocblas_strmv_strided_batched_64 (hipblasRocblas().rocblas_strmv_strided_batched_64)
+#define rocblas_strsm (hipblasRocblas().rocblas_strsm)
+#define rocblas_strsm_64 (hipblasRocblas().rocblas_strsm_64)
+#define rocblas_strsm_batched (hipblasRocblas().rocblas_strsm_batched)
+#define rocblas_strsm_batched_64 (hipblasRocblas().rocblas_strsm_batched_64)
+#define rocblas_strsm_strided_batched (hipblasRocblas().rocblas_strsm_strided_batched)
+#define rocblas_strsm_strided_batched_64 (hipblasRocblas().rocblas_strsm_strided_batched_64)
+#define rocblas_strsv (hipblasRocblas().rocblas_strsv)
+#define rocblas_strsv_64 (hipblasRocblas().rocblas_strsv_64)
+#define rocblas_strsv_batched (hipblasRocblas().rocblas_strsv_batched)
+#define rocblas_strsv_batched_64 (hipblasRocblas().rocblas_strsv_batched_64)
+#define rocblas_strsv_strided_batched (hipblasRocblas().rocblas_strsv_strided_batched)
+#define rocblas_strsv_strided_batched_64 (hipblasRocblas().rocblas_strsv_strided_batched_64)
+#define rocblas_strtri (hipblasRocblas().rocblas_strtri)
+#define rocblas_strtri_batched (hipblasRocblas().rocblas_strtri_batched)
+#define rocblas_strtri_strided_batched (hipblasRocblas().rocblas_strtri_strided_batched)
+#define rocblas_trsm_batched_ex (hipblasRocblas().rocblas_trsm_batched_ex)
+#define rocblas_trsm_ex (hipblasRocblas().rocblas_trsm_ex)
+#define rocblas_trsm_strided_batched_ex (hipblasRocblas().rocblas_trsm_strided_batched_ex)
+#define rocblas_tssgemv_batched (hipblasRocblas().rocblas_tssgemv_batched)
+#define rocblas_tssgemv_strided_batched (hipblasRocblas().rocblas_tssgemv_strided_batched)
+#define rocblas_tstgemv_batched (hipblasRocblas().rocblas_tstgemv_batched)
+#define rocblas_tstgemv_strided_batched (hipblasRocblas().rocblas_tstgemv_strided_batched)
+#define rocblas_zaxpy (hipblasRocblas().rocblas_zaxpy)
+#define rocblas_zaxpy_64 (hipblasRocblas().rocblas_zaxpy_64)
+#define rocblas_zaxpy_batched (hipblasRocblas().rocblas_zaxpy_batched)
+#define rocblas_zaxpy_batched_64 (hipblasRocblas().rocblas_zaxpy_batched_64)
+#define rocblas_zaxpy_strided_batched (hipblasRocblas().rocblas_zaxpy_strided_batched)
+#define rocblas_zaxpy_strided_batched_64 (hipblasRocblas().rocblas_zaxpy_strided_batched_64)
+#define rocblas_zcopy (hipblasRocblas().rocblas_zcopy)
+#define rocblas_zcopy_64 (hipblasRocblas().rocblas_zcopy_64)
+#define rocblas_zcopy_batched (hipblasRocblas().rocblas_zcopy_batched)
+#define rocblas_zcopy_batched_64 (hipblasRocblas().rocblas_zcopy_batched_64)
+#define rocblas_zcopy_strided_batched (hipblasRocblas().rocblas_zcopy_strided_batched)
+#define rocblas_zcopy_strided_batched_64 (hipblasRocblas().rocblas_zcopy_strided_batched_64)
+#define rocblas_zdgmm (hipblasRocblas().rocblas_zdgmm)
+#define rocblas_zdgmm_64 (hipblasRocblas().rocblas_zdgmm_64)
+#define rocblas_zdgmm_batched (hipblasRocblas().rocblas_zdgmm_batched)
+#define rocblas_zdgmm_batched_64 (hipblasRocblas().rocblas_zdgmm_batched_64)
+#define rocblas_zdgmm_strided_batched (hipblasRocblas().rocblas_zdgmm_strided_batched)
+#define rocblas_zdgmm_strided_batched_64 (hipblasRocblas().rocblas_zdgmm_strided_batched_64)
+#define rocblas_zdotc (hipblasRocblas().rocblas_zdotc)
+#define rocblas_zdotc_64 (hipblasRocblas().rocblas_zdotc_64)
+#define rocblas_zdotc_batched (hipblasRocblas().rocblas_zdotc_batched)
+#define rocblas_zdotc_batched_64 (hipblasRocblas().rocblas_zdotc_batched_64)
+#define rocblas_zdotc_strided_batched (hipblasRocblas().rocblas_zdotc_strided_batched)
+#define rocblas_zdotc_strided_batched_64 (hipblasRocblas().rocblas_zdotc_strided_batched_64)
+#define rocblas_zdotu (hipblasRocblas().rocblas_zdotu)
+#define rocblas_zdotu_64 (hipblasRocblas().rocblas_zdotu_64)
+#define rocblas_zdotu_batched (hipblasRocblas().rocblas_zdotu_batched)
+#define rocblas_zdotu_batched_64 (hipblasRocblas().rocblas_zdotu_batched_64)
+#define rocblas_zdotu_strided_batched (hipblasRocblas().rocblas_zdotu_strided_batched)
+#define rocblas_zdotu_strided_batched_64 (hipblasRocblas().rocblas_zdotu_strided_batched_64)
+#define rocblas_zdrot (hipblasRocblas().rocblas_zdrot)
+#define rocblas_zdrot_64 (hipblasRocblas().rocblas_zdrot_64)
+#define rocblas_zdrot_batched (hipblasRocblas().rocblas_zdrot_batched)
+#define rocblas_zdrot_batched_64 (hipblasRocblas().rocblas_zdrot_batched_64)
+#define rocblas_zdrot_strided_batched (hipblasRocblas().rocblas_zdrot_strided_batched)
+#define rocblas_zdrot_strided_batched_64 (hipblasRocblas().rocblas_zdrot_strided_batched_64)
+#define rocblas_zdscal (hipblasRocblas().rocblas_zdscal)
+#define rocblas_zdscal_64 (hipblasRocblas().rocblas_zdscal_64)
+#define rocblas_zdscal_batched (hipblasRocblas().rocblas_zdscal_batched)
+#define rocblas_zdscal_batched_64 (hipblasRocblas().rocblas_zdscal_batched_64)
+#define rocblas_zdscal_strided_batched (hipblasRocblas().rocblas_zdscal_strided_batched)
+#define rocblas_zdscal_strided_batched_64 (hipblasRocblas().rocblas_zdscal_strided_batched_64)
+#define rocblas_zgbmv (hipblasRocblas().rocblas_zgbmv)
+#define rocblas_zgbmv_64 (hipblasRocblas().rocblas_zgbmv_64)
+#define rocblas_zgbmv_batched (hipblasRocblas().rocblas_zgbmv_batched)
+#define rocblas_zgbmv_batched_64 (hipblasRocblas().rocblas_zgbmv_batched_64)
+#define rocblas_zgbmv_strided_batched (hipblasRocblas().rocblas_zgbmv_strided_batched)
+#define rocblas_zgbmv_strided_batched_64 (hipblasRocblas().rocblas_zgbmv_strided_batched_64)
+#define rocblas_zgeam (hipblasRocblas().rocblas_zgeam)
+#define rocblas_zgeam_64 (hipblasRocblas().rocblas_zgeam_64)
+#define rocblas_zgeam_batched (hipblasRocblas().rocblas_zgeam_batched)
+#define rocblas_zgeam_batched_64 (hipblasRocblas().rocblas_zgeam_batched_64)
+#define rocblas_zgeam_strided_batched (hipblasRocblas().rocblas_zgeam_strided_batched)
+#define rocblas_zgeam_strided_batched_64 (hipblasRocblas().rocblas_zgeam_strided_batched_64)
+#define rocblas_zgemm (hipblasRocblas().rocblas_zgemm)
+#define rocblas_zgemm_64 (hipblasRocblas().rocblas_zgemm_64)
+#define rocblas_zgemm_batched (hipblasRocblas().rocblas_zgemm_batched)
+#define rocblas_zgemm_batched_64 (hipblasRocblas().rocblas_zgemm_batched_64)
+#define rocblas_zgemm_strided_batched (hipblasRocblas().rocblas_zgemm_strided_batched)
+#define rocblas_zgemm_strided_batched_64 (hipblasRocblas().rocblas_zgemm_strided_batched_64)
+#define rocblas_zgemv (hipblasRocblas().rocblas_zgemv)
+#define rocblas_zgemv_64 (hipblasRocblas().rocblas_zgemv_64)
+#define rocblas_zgemv_batched (hipblasRocblas().rocblas_zgemv_batched)
+#define rocblas_zgemv_batched_64 (hipblasRocblas().rocblas_zgemv_batched_64)
+#define rocblas_zgemv_strided_batched (hipblasRocblas().rocblas_zgemv_strided_batched)
+#define rocblas_zgemv_strided_batched_64 (hipblasRocblas().rocblas_zgemv_strided_batched_64)
+#define rocblas_zgerc (hipblasRocblas().rocblas_zgerc)
+#define rocblas_zgerc_64 (hipblasRocblas().rocblas_zgerc_64)
+#define rocblas_zgerc_batched (hipblasRocblas().rocblas_zgerc_batched)
+#define rocblas_zgerc_batched_64 (hipblasRocblas().rocblas_zgerc_batched_64)
+#define rocblas_zgerc_strided_batched (hipblasRocblas().rocblas_zgerc_strided_batched)
+#define rocblas_zgerc_strided_batched_64 (hipblasRocblas().rocblas_zgerc_strided_batched_64)
+#define rocblas_zgeru (hipblasRocblas().rocblas_zgeru)
+#define rocblas_zgeru_64 (hipblasRocblas().rocblas_zgeru_64)
+#define rocblas_zgeru_batched (hipblasRocblas().rocblas_zgeru_batched)
+#define rocblas_zgeru_batched_64 (hipblasRocblas().rocblas_zgeru_batched_64)
+#define rocblas_zgeru_strided_batched (hipblasRocblas().rocblas_zgeru_strided_batched)
+#define rocblas_zgeru_strided_batched_64 (hipblasRocblas().rocblas_zgeru_strided_batched_64)
+#define rocblas_zhbmv (hipblasRocblas().rocblas_zhbmv)
+#define rocblas_zhbmv_64 (hipblasRocblas().rocblas_zhbmv_64)
+#define rocblas_zhbmv_batched (hipblasRocblas().rocblas_zhbmv_batched)
+#define rocblas_zhbmv_batched_64 (hipblasRocblas().rocblas_zhbmv_batched_64)
+#define rocblas_zhbmv_strided_batched (hipblasRocblas().rocblas_zhbmv_strided_batched)
+#define rocblas_zhbmv_strided_batched_64 (hipblasRocblas().rocblas_zhbmv_strided_batched_64)
+#define rocblas_zhemm (hipblasRocblas().rocblas_zhemm)
+#define rocblas_zhemm_64 (hipblasRocblas().rocblas_zhemm_64)
+#define rocblas_zhemm_batched (hipblasRocblas().rocblas_zhemm_batched)
+#define rocblas_zhemm_batched_64 (hipblasRocblas().rocblas_zhemm_batched_64)
+#define rocblas_zhemm_strided_batched (hipblasRocblas().rocblas_zhemm_strided_batched)
+#define rocblas_zhemm_strided_batched_64 (hipblasRocblas().rocblas_zhemm_strided_batched_64)
+#define rocblas_zhemv (hipblasRocblas().rocblas_zhemv)
+#define rocblas_zhemv_64 (hipblasRocblas().rocblas_zhemv_64)
+#define rocblas_zhemv_batched (hipblasRocblas().rocblas_zhemv_batched)
+#define rocblas_zhemv_batched_64 (hipblasRocblas().rocblas_zhemv_batched_64)
+#define rocblas_zhemv_strided_batched (hipblasRocblas().rocblas_zhemv_strided_batched)
+#define rocblas_zhemv_strided_batched_64 (hipblasRocblas().rocblas_zhemv_strided_batched_64)
+#define rocblas_zher (hipblasRocblas().rocblas_zher)
+#define rocblas_zher2 (hipblasRocblas().rocblas_zher2)
+#define rocblas_zher2_64 (hipblasRocblas().rocblas_zher2_64)
+#define rocblas_zher2_batched (hipblasRocblas().rocblas_zher2_batched)
+#define rocblas_zher2_batched_64 (hipblasRocblas().rocblas_zher2_batched_64)
+#define rocblas_zher2_strided_batched (hipblasRocblas().rocblas_zher2_strided_batched)
+#define rocblas_zher2_strided_batched_64 (hipblasRocblas().rocblas_zher2_strided_batched_64)
+#define rocblas_zher2k (hipblasRocblas().rocblas_zher2k)
+#define rocblas_zher2k_64 (hipblasRocblas().rocblas_zher2k_64)
+#define rocblas_zher2k_batched (hipblasRocblas().rocblas_zher2k_batched)
+#define rocblas_zher2k_batched_64 (hipblasRocblas().rocblas_zher2k_batched_64)
+#define rocblas_zher2k_strided_batched (hipblasRocblas().rocblas_zher2k_strided_batched)
+#define rocblas_zher2k_strided_batched_64 (hipblasRocblas().rocblas_zher2k_strided_batched_64)
+#define rocblas_zher_64 (hipblasRocblas().rocblas_zher_64)
+#define rocblas_zher_batched (hipblasRocblas().rocblas_zher_batched)
+#define rocblas_zher_batched_64 (hipblasRocblas().rocblas_zher_batched_64)
+#define rocblas_zher_strided_batched (hipblasRocblas().rocblas_zher_strided_batched)
+#define rocblas_zher_strided_batched_64 (hipblasRocblas().rocblas_zher_strided_batched_64)
+#define rocblas_zherk (hipblasRocblas().rocblas_zherk)
+#define rocblas_zherk_64 (hipblasRocblas().rocblas_zherk_64)
+#define rocblas_zherk_batched (hipblasRocblas().rocblas_zherk_batched)
+#define rocblas_zherk_batched_64 (hipblasRocblas().rocblas_zherk_batched_64)
+#define rocblas_zherk_strided_batched (hipblasRocblas().rocblas_zherk_strided_batched)
+#define rocblas_zherk_strided_batched_64 (hipblasRocblas().rocblas_zherk_strided_batched_64)
+#define rocblas_zherkx (hipblasRocblas().rocblas_zherkx)
+#define rocblas_zherkx_64 (hipblasRocblas().rocblas_zherkx_64)
+#define rocblas_zherkx_batched (hipblasRocblas().rocblas_zherkx_batched)
+#define rocblas_zherkx_batched_64 (hipblasRocblas().rocblas_zherkx_batched_64)
+#define rocblas_zherkx_strided_batched (hipblasRocblas().rocblas_zherkx_strided_batched)
+#define rocblas_zherkx_strided_batched_64 (hipblasRocblas().rocblas_zherkx_strided_batched_64)
+#define rocblas_zhpmv (hipblasRocblas().rocblas_zhpmv)
+#define rocblas_zhpmv_64 (hipblasRocblas().rocblas_zhpmv_64)
+#define rocblas_zhpmv_batched (hipblasRocblas().rocblas_zhpmv_batched)
+#define rocblas_zhpmv_batched_64 (hipblasRocblas().rocblas_zhpmv_batched_64)
+#define rocblas_zhpmv_strided_batched (hipblasRocblas().rocblas_zhpmv_strided_batched)
+#define rocblas_zhpmv_strided_batched_64 (hipblasRocblas().rocblas_zhpmv_strided_batched_64)
+#define rocblas_zhpr (hipblasRocblas().rocblas_zhpr)
+#define rocblas_zhpr2 (hipblasRocblas().rocblas_zhpr2)
+#define rocblas_zhpr2_64 (hipblasRocblas().rocblas_zhpr2_64)
+#define rocblas_zhpr2_batched (hipblasRocblas().rocblas_zhpr2_batched)
+#define rocblas_zhpr2_batched_64 (hipblasRocblas().rocblas_zhpr2_batched_64)
+#define rocblas_zhpr2_strided_batched (hipblasRocblas().rocblas_zhpr2_strided_batched)
+#define rocblas_zhpr2_strided_batched_64 (hipblasRocblas().rocblas_zhpr2_strided_batched_64)
+#define rocblas_zhpr_64 (hipblasRocblas().rocblas_zhpr_64)
+#define rocblas_zhpr_batched (hipblasRocblas().rocblas_zhpr_batched)
+#define rocblas_zhpr_batched_64 (hipblasRocblas().rocblas_zhpr_batched_64)
+#define rocblas_zhpr_strided_batched (hipblasRocblas().rocblas_zhpr_strided_batched)
+#define rocblas_zhpr_strided_batched_64 (hipblasRocblas().rocblas_zhpr_strided_batched_64)
+#define rocblas_zrot (hipblasRocblas().rocblas_zrot)
+#define rocblas_zrot_64 (hipblasRocblas().rocblas_zrot_64)
+#define rocblas_zrot_batched (hipblasRocblas().rocblas_zrot_batched)
+#define rocblas_zrot_batched_64 (hipblasRocblas().rocblas_zrot_batched_64)
+#define rocblas_zrot_strided_batched (hipblasRocblas().rocblas_zrot_strided_batched)
+#define rocblas_zrot_strided_batched_64 (hipblasRocblas().rocblas_zrot_strided_batched_64)
+#define rocblas_zrotg (hipblasRocblas().rocblas_zrotg)
+#define rocblas_zrotg_64 (hipblasRocblas().rocblas_zrotg_64)
+#define rocblas_zrotg_batched (hipblasRocblas().rocblas_zrotg_batched)
+#define rocblas_zrotg_batched_64 (hipblasRocblas().rocblas_zrotg_batched_64)
+#define rocblas_zrotg_strided_batched (hipblasRocblas().rocblas_zrotg_strided_batched)
+#define rocblas_zrotg_strided_batched_64 (hipblasRocblas().rocblas_zrotg_strided_batched_64)
+#define rocblas_zscal (hipblasRocblas().rocblas_zscal)
+#define rocblas_zscal_64 (hipblasRocblas().rocblas_zscal_64)
+#define rocblas_zscal_batched (hipblasRocblas().rocblas_zscal_batched)
+#define rocblas_zscal_batched_64 (hipblasRocblas().rocblas_zscal_batched_64)
+#define rocblas_zscal_strided_batched (hipblasRocblas().rocblas_zscal_strided_batched)
+#define rocblas_zscal_strided_batched_64 (hipblasRocblas().rocblas_zscal_strided_batched_64)
+#define rocblas_zspr (hipblasRocblas().rocblas_zspr)
+#define rocblas_zspr_64 (hipblasRocblas().rocblas_zspr_64)
+#define rocblas_zspr_batched (hipblasRocblas().rocblas_zspr_batched)
+#define rocblas_zspr_batched_64 (hipblasRocblas().rocblas_zspr_batched_64)
+#define rocblas_zspr_strided_batched (hipblasRocblas().rocblas_zspr_strided_batched)
+#define rocblas_zspr_strided_batched_64 (hipblasRocblas().rocblas_zspr_strided_batched_64)
+#define rocblas_zswap (hipblasRocblas().rocblas_zswap)
+#define rocblas_zswap_64 (hipblasRocblas().rocblas_zswap_64)
+#define rocblas_zswap_batched (hipblasRocblas().rocblas_zswap_batched)
+#define rocblas_zswap_batched_64 (hipblasRocblas().rocblas_zswap_batched_64)
+#define rocblas_zswap_strided_batched (hipblasRocblas().rocblas_zswap_strided_batched)
+#define rocblas_zswap_strided_batched_64 (hipblasRocblas().rocblas_zswap_strided_batched_64)
+#define rocblas_zsymm (hipblasRocblas().rocblas_zsymm)
+#define rocblas_zsymm_64 (hipblasRocblas().rocblas_zsymm_64)
+#define rocblas_zsymm_batched (hipblasRocblas().rocblas_zsymm_batched)
+#define rocblas_zsymm_batched_64 (hipblasRocblas().rocblas_zsymm_batched_64)
+#define rocblas_zsymm_strided_batched (hipblasRocblas().rocblas_zsymm_strided_batched)
+#define rocblas_zsymm_strided_batched_64 (hipblasRocblas().rocblas_zsymm_strided_batched_64)
+#define rocblas_zsymv (hipblasRocblas().rocblas_zsymv)
+#define rocblas_zsymv_64 (hipblasRocblas().rocblas_zsymv_64)
+#define rocblas_zsymv_batched (hipblasRocblas().rocblas_zsymv_batched)
+#define rocblas_zsymv_batched_64 (hipblasRocblas().rocblas_zsymv_batched_64)
+#define rocblas_zsymv_strided_batched (hipblasRocblas().rocblas_zsymv_strided_batched)
+#define rocblas_zsymv_strided_batched_64 (hipblasRocblas().rocblas_zsymv_strided_batched_64)
+#define rocblas_zsyr (hipblasRocblas().rocblas_zsyr)
+#define rocblas_zsyr2 (hipblasRocblas().rocblas_zsyr2)
+#define rocblas_zsyr2_64 (hipblasRocblas().rocblas_zsyr2_64)
+#define rocblas_zsyr2_batched (hipblasRocblas().rocblas_zsyr2_batched)
+#define rocblas_zsyr2_batched_64 (hipblasRocblas().rocblas_zsyr2_batched_64)
+#define rocblas_zsyr2_strided_batched (hipblasRocblas().rocblas_zsyr2_strided_batched)
+#define rocblas_zsyr2_strided_batched_64 (hipblasRocblas().rocblas_zsyr2_strided_batched_64)
+#define rocblas_zsyr2k (hipblasRocblas().rocblas_zsyr2k)
+#define rocblas_zsyr2k_64 (hipblasRocblas().rocblas_zsyr2k_64)
+#define rocblas_zsyr2k_batched (hipblasRocblas().rocblas_zsyr2k_batched)
+#define rocblas_zsyr2k_batched_64 (hipblasRocblas().rocblas_zsyr2k_batched_64)
+#define rocblas_zsyr2k_strided_batched (hipblasRocblas().rocblas_zsyr2k_strided_batched)
+#define rocblas_zsyr2k_strided_batched_64 (hipblasRocblas().rocblas_zsyr2k_strided_batched_64)
+#define rocblas_zsyr_64 (hipblasRocblas().rocblas_zsyr_64)
+#define rocblas_zsyr_batched (hipblasRocblas().rocblas_zsyr_batched)
+#define rocblas_zsyr_batched_64 (hipblasRocblas().rocblas_zsyr_batched_64)
+#define rocblas_zsyr_strided_batched (hipblasRocblas().rocblas_zsyr_strided_batched)
+#define rocblas_zsyr_strided_batched_64 (hipblasRocblas().rocblas_zsyr_strided_batched_64)
+#define rocblas_zsyrk (hipblasRocblas().rocblas_zsyrk)
+#define rocblas_zsyrk_64 (hipblasRocblas().rocblas_zsyrk_64)
+#define rocblas_zsyrk_batched (hipblasRocblas().rocblas_zsyrk_batched)
+#define rocblas_zsyrk_batched_64 (hipblasRocblas().rocblas_zsyrk_batched_64)
+#define rocblas_zsyrk_strided_batched (hipblasRocblas().rocblas_zsyrk_strided_batched)
+#define rocblas_zsyrk_strided_batched_64 (hipblasRocblas().rocblas_zsyrk_strided_batched_64)
+#define rocblas_zsyrkx (hipblasRocblas().rocblas_zsyrkx)
+#define rocblas_zsyrkx_64 (hipblasRocblas().rocblas_zsyrkx_64)
+#define rocblas_zsyrkx_batched (hipblasRocblas().rocblas_zsyrkx_batched)
+#define rocblas_zsyrkx_batched_64 (hipblasRocblas().rocblas_zsyrkx_batched_64)
+#define rocblas_zsyrkx_strided_batched (hipblasRocblas().rocblas_zsyrkx_strided_batched)
+#define rocblas_zsyrkx_strided_batched_64 (hipblasRocblas().rocblas_zsyrkx_strided_batched_64)
+#define rocblas_ztbmv (hipblasRocblas().rocblas_ztbmv)
+#define rocblas_ztbmv_64 (hipblasRocblas().rocblas_ztbmv_64)
+#define rocblas_ztbmv_batched (hipblasRocblas().rocblas_ztbmv_batched)
+#define rocblas_ztbmv_batched_64 (hipblasRocblas().rocblas_ztbmv_batched_64)
+#define rocblas_ztbmv_strided_batched (hipblasRocblas().rocblas_ztbmv_strided_batched)
+#define rocblas_ztbmv_strided_batched_64 (hipblasRocblas().rocblas_ztbmv_strided_batched_64)
+#define rocblas_ztbsv (hipblasRocblas().rocblas_ztbsv)
+#define rocblas_ztbsv_64 (hipblasRocblas().rocblas_ztbsv_64)
+#define rocblas_ztbsv_batched (hipblasRocblas().rocblas_ztbsv_batched)
+#define rocblas_ztbsv_batched_64 (hipblasRocblas().rocblas_ztbsv_batched_64)
+#define rocblas_ztbsv_strided_batched (hipblasRocblas().rocblas_ztbsv_strided_batched)
+#define rocblas_ztbsv_strided_batched_64 (hipblasRocblas().rocblas_ztbsv_strided_batched_64)
+#define rocblas_ztpmv (hipblasRocblas().rocblas_ztpmv)
+#define rocblas_ztpmv_64 (hipblasRocblas().rocblas_ztpmv_64)
+#define rocblas_ztpmv_batched (hipblasRocblas().rocblas_ztpmv_batched)
+#define rocblas_ztpmv_batched_64 (hipblasRocblas().rocblas_ztpmv_batched_64)
+#define rocblas_ztpmv_strided_batched (hipblasRocblas().rocblas_ztpmv_strided_batched)
+#define rocblas_ztpmv_strided_batched_64 (hipblasRocblas().rocblas_ztpmv_strided_batched_64)
+#define rocblas_ztpsv (hipblasRocblas().rocblas_ztpsv)
+#define rocblas_ztpsv_64 (hipblasRocblas().rocblas_ztpsv_64)
+#define rocblas_ztpsv_batched (hipblasRocblas().rocblas_ztpsv_batched)
+#define rocblas_ztpsv_batched_64 (hipblasRocblas().rocblas_ztpsv_batched_64)
+#define rocblas_ztpsv_strided_batched (hipblasRocblas().rocblas_ztpsv_strided_batched)
+#define rocblas_ztpsv_strided_batched_64 (hipblasRocblas().rocblas_ztpsv_strided_batched_64)
+#define rocblas_ztrmm (hipblasRocblas().rocblas_ztrmm)
+#define rocblas_ztrmm_64 (hipblasRocblas().rocblas_ztrmm_64)
+#define rocblas_ztrmm_batched (hipblasRocblas().rocblas_ztrmm_batched)
+#define rocblas_ztrmm_batched_64 (hipblasRocblas().rocblas_ztrmm_batched_64)
+#define rocblas_ztrmm_strided_batched (hipblasRocblas().rocblas_ztrmm_strided_batched)
+#define rocblas_ztrmm_strided_batched_64 (hipblasRocblas().rocblas_ztrmm_strided_batched_64)
+#define rocblas_ztrmv (hipblasRocblas().rocblas_ztrmv)
+#define rocblas_ztrmv_64 (hipblasRocblas().rocblas_ztrmv_64)
+#define rocblas_ztrmv_batched (hipblasRocblas().rocblas_ztrmv_batched)
+#define rocblas_ztrmv_batched_64 (hipblasRocblas().rocblas_ztrmv_batched_64)
+#define rocblas_ztrmv_strided_batched (hipblasRocblas().rocblas_ztrmv_strided_batched)
+#define rocblas_ztrmv_strided_batched_64 (hipblasRocblas().rocblas_ztrmv_strided_batched_64)
+#define rocblas_ztrsm (hipblasRocblas().rocblas_ztrsm)
+#define rocblas_ztrsm_64 (hipblasRocblas().rocblas_ztrsm_64)
+#define rocblas_ztrsm_batched (hipblasRocblas().rocblas_ztrsm_batched)
+#define rocblas_ztrsm_batched_64 (hipblasRocblas().rocblas_ztrsm_batched_64)
+#define rocblas_ztrsm_strided_batched (hipblasRocblas().rocblas_ztrsm_strided_batched)
+#define rocblas_ztrsm_strided_batched_64 (hipblasRocblas().rocblas_ztrsm_strided_batched_64)
+#define rocblas_ztrsv (hipblasRocblas().rocblas_ztrsv)
+#define rocblas_ztrsv_64 (hipblasRocblas().rocblas_ztrsv_64)
+#define rocblas_ztrsv_batched (hipblasRocblas().rocblas_ztrsv_batched)
+#define rocblas_ztrsv_batched_64 (hipblasRocblas().rocblas_ztrsv_batched_64)
+#define rocblas_ztrsv_strided_batched (hipblasRocblas().rocblas_ztrsv_strided_batched)
+#define rocblas_ztrsv_strided_batched_64 (hipblasRocblas().rocblas_ztrsv_strided_batched_64)
+#define rocblas_ztrtri (hipblasRocblas().rocblas_ztrtri)
+#define rocblas_ztrtri_batched (hipblasRocblas().rocblas_ztrtri_batched)
+#define rocblas_ztrtri_strided_batched (hipblasRocblas().rocblas_ztrtri_strided_batched)
+#ifdef __HIP_PLATFORM_SOLVER__
+#define rocsolver_cgels (hipblasRocsolver().rocsolver_cgels)
+#define rocsolver_cgels_batched (hipblasRocsolver().rocsolver_cgels_batched)
+#define rocsolver_cgels_strided_batched (hipblasRocsolver().rocsolver_cgels_strided_batched)
+#define rocsolver_cgeqrf (hipblasRocsolver().rocsolver_cgeqrf)
+#define rocsolver_cgeqrf_batched (hipblasRocsolver().rocsolver_cgeqrf_batched)
+#define rocsolver_cgeqrf_ptr_batched (hipblasRocsolver().rocsolver_cgeqrf_ptr_batched)
+#define rocsolver_cgeqrf_strided_batched (hipblasRocsolver().rocsolver_cgeqrf_strided_batched)
+#define rocsolver_cgesv_batched (hipblasRocsolver().rocsolver_cgesv_batched)
+#define rocsolver_cgesv_strided_batched (hipblasRocsolver().rocsolver_cgesv_strided_batched)
+#define rocsolver_cgesvdj_batched (hipblasRocsolver().rocsolver_cgesvdj_batched)
+#define rocsolver_cgesvdj_strided_batched (hipblasRocsolver().rocsolver_cgesvdj_strided_batched)
+#define rocsolver_cgetrf (hipblasRocsolver().rocsolver_cgetrf)
+#define rocsolver_cgetrf_batched (hipblasRocsolver().rocsolver_cgetrf_batched)
+#define rocsolver_cgetrf_npvt (hipblasRocsolver().rocsolver_cgetrf_npvt)
+#define rocsolver_cgetrf_npvt_batched (hipblasRocsolver().rocsolver_cgetrf_npvt_batched)
+#define rocsolver_cgetrf_npvt_strided_batched \
+    (hipblasRocsolver().rocsolver_cgetrf_npvt_strided_batched)
+#define rocsolver_cgetrf_strided_batched (hipblasRocsolver().rocsolver_cgetrf_strided_batched)
+#define rocsolver_cgetri_npvt_outofplace_batched \
+    (hipblasRocsolver().rocsolver_cgetri_npvt_outofplace_batched)
+#define rocsolver_cgetri_outofplace_batched (hipblasRocsolver().rocsolver_cgetri_outofplace_batched)
+#define rocsolver_cgetrs (hipblasRocsolver().rocsolver_cgetrs)
+#define rocsolver_cgetrs_batched (hipblasRocsolver().rocsolver_cgetrs_batched)
+#define rocsolver_cgetrs_strided_batched (hipblasRocsolver().rocsolver_cgetrs_strided_batched)
+#define rocsolver_cheevd (hipblasRocsolver().rocsolver_cheevd)
+#define rocsolver_cheevj (hipblasRocsolver().rocsolver_cheevj)
+#define rocsolver_cheevj_batched (hipblasRocsolver().rocsolver_cheevj_batched)
+#define rocsolver_cheevj_strided_batched (hipblasRocsolver().rocsolver_cheevj_strided_batched)
+#define rocsolver_cpotrf (hipblasRocsolver().rocsolver_cpotrf)
+#define rocsolver_cpotrf_batched (hipblasRocsolver().rocsolver_cpotrf_batched)
+#define rocsolver_cpotrf_strided_batched (hipblasRocsolver().rocsolver_cpotrf_strided_batched)
+#define rocsolver_cpotri (hipblasRocsolver().rocsolver_cpotri)
+#define rocsolver_cpotri_batched (hipblasRocsolver().rocsolver_cpotri_batched)
+#define rocsolver_cpotri_strided_batched (hipblasRocsolver().rocsolver_cpotri_strided_batched)
+#define rocsolver_cpotrs (hipblasRocsolver().rocsolver_cpotrs)
+#define rocsolver_cpotrs_batched (hipblasRocsolver().rocsolver_cpotrs_batched)
+#define rocsolver_cpotrs_strided_batched (hipblasRocsolver().rocsolver_cpotrs_strided_batched)
+#define rocsolver_dgels (hipblasRocsolver().rocsolver_dgels)
+#define rocsolver_dgels_batched (hipblasRocsolver().rocsolver_dgels_batched)
+#define rocsolver_dgels_strided_batched (hipblasRocsolver().rocsolver_dgels_strided_batched)
+#define rocsolver_dgeqrf (hipblasRocsolver().rocsolver_dgeqrf)
+#define rocsolver_dgeqrf_batched (hipblasRocsolver().rocsolver_dgeqrf_batched)
+#define rocsolver_dgeqrf_ptr_batched (hipblasRocsolver().rocsolver_dgeqrf_ptr_batched)
+#define rocsolver_dgeqrf_strided_batched (hipblasRocsolver().rocsolver_dgeqrf_strided_batched)
+#define rocsolver_dgesv_batched (hipblasRocsolver().rocsolver_dgesv_batched)
+#define rocsolver_dgesv_strided_batched (hipblasRocsolver().rocsolver_dgesv_strided_batched)
+#define rocsolver_dgesvdj_batched (hipblasRocsolver().rocsolver_dgesvdj_batched)
+#define rocsolver_dgesvdj_strided_batched (hipblasRocsolver().rocsolver_dgesvdj_strided_batched)
+#define rocsolver_dgetrf (hipblasRocsolver().rocsolver_dgetrf)
+#define rocsolver_dgetrf_batched (hipblasRocsolver().rocsolver_dgetrf_batched)
+#define rocsolver_dgetrf_npvt (hipblasRocsolver().rocsolver_dgetrf_npvt)
+#define rocsolver_dgetrf_npvt_batched (hipblasRocsolver().rocsolver_dgetrf_npvt_batched)
+#define rocsolver_dgetrf_npvt_strided_batched \
+    (hipblasRocsolver().rocsolver_dgetrf_npvt_strided_batched)
+#define rocsolver_dgetrf_strided_batched (hipblasRocsolver().rocsolver_dgetrf_strided_batched)
+#define rocsolver_dgetri_npvt_outofplace_batched \
+    (hipblasRocsolver().rocsolver_dgetri_npvt_outofplace_batched)
+#define rocsolver_dgetri_outofplace_batched (hipblasRocsolver().rocsolver_dgetri_outofplace_batched)
+#define rocsolver_dgetrs (hipblasRocsolver().rocsolver_dgetrs)
+#define rocsolver_dgetrs_batched (hipblasRocsolver().rocsolver_dgetrs_batched)
+#define rocsolver_dgetrs_strided_batched (hipblasRocsolver().rocsolver_dgetrs_strided_batched)
+#define rocsolver_dpotrf (hipblasRocsolver().rocsolver_dpotrf)
+#define rocsolver_dpotrf_batched (hipblasRocsolver().rocsolver_dpotrf_batched)
+#define rocsolver_dpotrf_strided_batched (hipblasRocsolver().rocsolver_dpotrf_strided_batched)
+#define rocsolver_dpotri (hipblasRocsolver().rocsolver_dpotri)
+#define rocsolver_dpotri_batched (hipblasRocsolver().rocsolver_dpotri_batched)
+#define rocsolver_dpotri_strided_batched (hipblasRocsolver().rocsolver_dpotri_strided_batched)
+#define rocsolver_dpotrs (hipblasRocsolver().rocsolver_dpotrs)
+#define rocsolver_dpotrs_batched (hipblasRocsolver().rocsolver_dpotrs_batched)
+#define rocsolver_dpotrs_strided_batched (hipblasRocsolver().rocsolver_dpotrs_strided_batched)
+#define rocsolver_dsyevd (hipblasRocsolver().rocsolver_dsyevd)
+#define rocsolver_dsyevj (hipblasRocsolver().rocsolver_dsyevj)
+#define rocsolver_dsyevj_batched (hipblasRocsolver().rocsolver_dsyevj_batched)
+#define rocsolver_dsyevj_strided_batched (hipblasRocsolver().rocsolver_dsyevj_strided_batched)
+#define rocsolver_sgels (hipblasRocsolver().rocsolver_sgels)
+#define rocsolver_sgels_batched (hipblasRocsolver().rocsolver_sgels_batched)
+#define rocsolver_sgels_strided_batched (hipblasRocsolver().rocsolver_sgels_strided_batched)
+#define rocsolver_sgeqrf (hipblasRocsolver().rocsolver_sgeqrf)
+#define rocsolver_sgeqrf_batched (hipblasRocsolver().rocsolver_sgeqrf_batched)
+#define rocsolver_sgeqrf_ptr_batched (hipblasRocsolver().rocsolver_sgeqrf_ptr_batched)
+#define rocsolver_sgeqrf_strided_batched (hipblasRocsolver().rocsolver_sgeqrf_strided_batched)
+#define rocsolver_sgesv_batched (hipblasRocsolver().rocsolver_sgesv_batched)
+#define rocsolver_sgesv_strided_batched (hipblasRocsolver().rocsolver_sgesv_strided_batched)
+#define rocsolver_sgesvdj_batched (hipblasRocsolver().rocsolver_sgesvdj_batched)
+#define rocsolver_sgesvdj_strided_batched (hipblasRocsolver().rocsolver_sgesvdj_strided_batched)
+#define rocsolver_sgetrf (hipblasRocsolver().rocsolver_sgetrf)
+#define rocsolver_sgetrf_batched (hipblasRocsolver().rocsolver_sgetrf_batched)
+#define rocsolver_sgetrf_npvt (hipblasRocsolver().rocsolver_sgetrf_npvt)
+#define rocsolver_sgetrf_npvt_batched (hipblasRocsolver().rocsolver_sgetrf_npvt_batched)
+#define rocsolver_sgetrf_npvt_strided_batched \
+    (hipblasRocsolver().rocsolver_sgetrf_npvt_strided_batched)
+#define rocsolver_sgetrf_strided_batched (hipblasRocsolver().rocsolver_sgetrf_strided_batched)
+#define rocsolver_sgetri_npvt_outofplace_batched \
+    (hipblasRocsolver().rocsolver_sgetri_npvt_outofplace_batched)
+#define rocsolver_sgetri_outofplace_batched (hipblasRocsolver().rocsolver_sgetri_outofplace_batched)
+#define rocsolver_sgetrs (hipblasRocsolver().rocsolver_sgetrs)
+#define rocsolver_sgetrs_batched (hipblasRocsolver().rocsolver_sgetrs_batched)
+#define rocsolver_sgetrs_strided_batched (hipblasRocsolver().rocsolver_sgetrs_strided_batched)
+#define rocsolver_spotrf (hipblasRocsolver().rocsolver_spotrf)
+#define rocsolver_spotrf_batched (hipblasRocsolver().rocsolver_spotrf_batched)
+#define rocsolver_spotrf_strided_batched (hipblasRocsolver().rocsolver_spotrf_strided_batched)
+#define rocsolver_spotri (hipblasRocsolver().rocsolver_spotri)
+#define rocsolver_spotri_batched (hipblasRocsolver().rocsolver_spotri_batched)
+#define rocsolver_spotri_strided_batched (hipblasRocsolver().rocsolver_spotri_strided_batched)
+#define rocsolver_spotrs (hipblasRocsolver().rocsolver_spotrs)
+#define rocsolver_spotrs_batched (hipblasRocsolver().rocsolver_spotrs_batched)
+#define rocsolver_spotrs_strided_batched (hipblasRocsolver().rocsolver_spotrs_strided_batched)
+#define rocsolver_ssyevd (hipblasRocsolver().rocsolver_ssyevd)
+#define rocsolver_ssyevj (hipblasRocsolver().rocsolver_ssyevj)
+#define rocsolver_ssyevj_batched (hipblasRocsolver().rocsolver_ssyevj_batched)
+#define rocsolver_ssyevj_strided_batched (hipblasRocsolver().rocsolver_ssyevj_strided_batched)
+#define rocsolver_zgels (hipblasRocsolver().rocsolver_zgels)
+#define rocsolver_zgels_batched (hipblasRocsolver().rocsolver_zgels_batched)
+#define rocsolver_zgels_strided_batched (hipblasRocsolver().rocsolver_zgels_strided_batched)
+#define rocsolver_zgeqrf (hipblasRocsolver().rocsolver_zgeqrf)
+#define rocsolver_zgeqrf_batched (hipblasRocsolver().rocsolver_zgeqrf_batched)
+#define rocsolver_zgeqrf_ptr_batched (hipblasRocsolver().rocsolver_zgeqrf_ptr_batched)
+#define rocsolver_zgeqrf_strided_batched (hipblasRocsolver().rocsolver_zgeqrf_strided_batched)
+#define rocsolver_zgesv_batched (hipblasRocsolver().rocsolver_zgesv_batched)
+#define rocsolver_zgesv_strided_batched (hipblasRocsolver().rocsolver_zgesv_strided_batched)
+#define rocsolver_zgesvdj_batched (hipblasRocsolver().rocsolver_zgesvdj_batched)
+#define rocsolver_zgesvdj_strided_batched (hipblasRocsolver().rocsolver_zgesvdj_strided_batched)
+#define rocsolver_zgetrf (hipblasRocsolver().rocsolver_zgetrf)
+#define rocsolver_zgetrf_batched (hipblasRocsolver().rocsolver_zgetrf_batched)
+#define rocsolver_zgetrf_npvt (hipblasRocsolver().rocsolver_zgetrf_npvt)
+#define rocsolver_zgetrf_npvt_batched (hipblasRocsolver().rocsolver_zgetrf_npvt_batched)
+#define rocsolver_zgetrf_npvt_strided_batched \
+    (hipblasRocsolver().rocsolver_zgetrf_npvt_strided_batched)
+#define rocsolver_zgetrf_strided_batched (hipblasRocsolver().rocsolver_zgetrf_strided_batched)
+#define rocsolver_zgetri_npvt_outofplace_batched \
+    (hipblasRocsolver().rocsolver_zgetri_npvt_outofplace_batched)
+#define rocsolver_zgetri_outofplace_batched (hipblasRocsolver().rocsolver_zgetri_outofplace_batched)
+#define rocsolver_zgetrs (hipblasRocsolver().rocsolver_zgetrs)
+#define rocsolver_zgetrs_batched (hipblasRocsolver().rocsolver_zgetrs_batched)
+#define rocsolver_zgetrs_strided_batched (hipblasRocsolver().rocsolver_zgetrs_strided_batched)
+#define rocsolver_zheevd (hipblasRocsolver().rocsolver_zheevd)
+#define rocsolver_zheevj (hipblasRocsolver().rocsolver_zheevj)
+#define rocsolver_zheevj_batched (hipblasRocsolver().rocsolver_zheevj_batched)
+#define rocsolver_zheevj_strided_batched (hipblasRocsolver().rocsolver_zheevj_strided_batched)
+#define rocsolver_zpotrf (hipblasRocsolver().rocsolver_zpotrf)
+#define rocsolver_zpotrf_batched (hipblasRocsolver().rocsolver_zpotrf_batched)
+#define rocsolver_zpotrf_strided_batched (hipblasRocsolver().rocsolver_zpotrf_strided_batched)
+#define rocsolver_zpotri (hipblasRocsolver().rocsolver_zpotri)
+#define rocsolver_zpotri_batched (hipblasRocsolver().rocsolver_zpotri_batched)
+#define rocsolver_zpotri_strided_batched (hipblasRocsolver().rocsolver_zpotri_strided_batched)
+#define rocsolver_zpotrs (hipblasRocsolver().rocsolver_zpotrs)
+#define rocsolver_zpotrs_batched (hipblasRocsolver().rocsolver_zpotrs_batched)
+#define rocsolver_zpotrs_strided_batched (hipblasRocsolver().rocsolver_zpotrs_strided_batched)
+#endif
+#endif
+
+#endif
@@ -0,0 +1,10865 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas_internal.hpp"
+
+extern "C" {
+
+// amax
+hipblasStatus_t hipblasIsamax(hipblasHandle_t handle, int n, const float* x, int incx, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleIamax(handle, n, x, incx, result, HIP_R_32F);
+    return hipblasConvertStatus(rocblas_isamax((rocblas_handle)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdamax(hipblasHandle_t handle, int n, const double* x, int incx, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleIamax(handle, n, x, incx, result, HIP_R_64F);
+    return hipblasConvertStatus(rocblas_idamax((rocblas_handle)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasIcamax(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleIamax(handle, n, x, incx, result, HIP_C_32F);
+    return hipblasConvertStatus(
+        rocblas_icamax((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamax(
+    hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleIamax(handle, n, x, incx, result, HIP_C_64F);
+    return hipblasConvertStatus(
+        rocblas_izamax((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasIcamax_v2(hipblasHandle_t handle, int n, const hipComplex* x, int incx, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleIamax(handle, n, x, incx, result, HIP_C_32F);
+    return hipblasConvertStatus(
+        rocblas_icamax((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamax_v2(
+    hipblasHandle_t handle, int n, const hipDoubleComplex* x, int incx, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleIamax(handle, n, x, incx, result, HIP_C_64F);
+    return hipblasConvertStatus(
+        rocblas_izamax((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// amax_64
+hipblasStatus_t hipblasIsamax_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_isamax_64((rocblas_handle)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdamax_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_idamax_64((rocblas_handle)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamax_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_icamax_64((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamax_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_izamax_64((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamax_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipComplex* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_icamax_64((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamax_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipDoubleComplex* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_izamax_64((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// amax_batched
+hipblasStatus_t hipblasIsamaxBatched(
+    hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_isamax_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdamaxBatched(
+    hipblasHandle_t handle, int n, const double* const x[], int incx, int batchCount, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_idamax_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamaxBatched(hipblasHandle_t             handle,
+                                     int                         n,
+                                     const hipblasComplex* const x[],
+                                     int                         incx,
+                                     int                         batchCount,
+                                     int*                        result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_icamax_batched((rocblas_handle)handle,
+                                                       n,
+                                                       (const rocblas_float_complex* const*)x,
+                                                       incx,
+                                                       batchCount,
+                                                       result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamaxBatched(hipblasHandle_t                   handle,
+                                     int                               n,
+                                     const hipblasDoubleComplex* const x[],
+                                     int                               incx,
+                                     int                               batchCount,
+                                     int*                              result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_izamax_batched((rocblas_handle)handle,
+                                                       n,
+                                                       (const rocblas_double_complex* const*)x,
+                                                       incx,
+                                                       batchCount,
+                                                       result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamaxBatched_v2(hipblasHandle_t         handle,
+                                        int                     n,
+                                        const hipComplex* const x[],
+                                        int                     incx,
+                                        int                     batchCount,
+                                        int*                    result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_icamax_batched((rocblas_handle)handle,
+                                                       n,
+                                                       (const rocblas_float_complex* const*)x,
+                                                       incx,
+                                                       batchCount,
+                                                       result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamaxBatched_v2(hipblasHandle_t               handle,
+                                        int                           n,
+                                        const hipDoubleComplex* const x[],
+                                        int                           incx,
+                                        int                           batchCount,
+                                        int*                          result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_izamax_batched((rocblas_handle)handle,
+                                                       n,
+                                                       (const rocblas_double_complex* const*)x,
+                                                       incx,
+                                                       batchCount,
+                                                       result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// amax_batched_64
+hipblasStatus_t hipblasIsamaxBatched_64(hipblasHandle_t    handle,
+                                        int64_t            n,
+                                        const float* const x[],
+                                        int64_t            incx,
+                                        int64_t            batchCount,
+                                        int64_t*           result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_isamax_batched_64((rocblas_handle)handle, n, x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdamaxBatched_64(hipblasHandle_t     handle,
+                                        int64_t             n,
+                                        const double* const x[],
+                                        int64_t             incx,
+                                        int64_t             batchCount,
+                                        int64_t*            result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_idamax_batched_64((rocblas_handle)handle, n, x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamaxBatched_64(hipblasHandle_t             handle,
+                                        int64_t                     n,
+                                        const hipblasComplex* const x[],
+                                        int64_t                     incx,
+                                        int64_t                     batchCount,
+                                        int64_t*                    result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_icamax_batched_64((rocblas_handle)handle,
+                                                          n,
+                                                          (const rocblas_float_complex* const*)x,
+                                                          incx,
+                                                          batchCount,
+                                                          result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamaxBatched_64(hipblasHandle_t                   handle,
+                                        int64_t                           n,
+                                        const hipblasDoubleComplex* const x[],
+                                        int64_t                           incx,
+                                        int64_t                           batchCount,
+                                        int64_t*                          result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_izamax_batched_64((rocblas_handle)handle,
+                                                          n,
+                                                          (const rocblas_double_complex* const*)x,
+                                                          incx,
+                                                          batchCount,
+                                                          result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamaxBatched_v2_64(hipblasHandle_t         handle,
+                                           int64_t                 n,
+                                           const hipComplex* const x[],
+                                           int64_t                 incx,
+                                           int64_t                 batchCount,
+                                           int64_t*                result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_icamax_batched_64((rocblas_handle)handle,
+                                                          n,
+                                                          (const rocblas_float_complex* const*)x,
+                                                          incx,
+                                                          batchCount,
+                                                          result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamaxBatched_v2_64(hipblasHandle_t               handle,
+                                           int64_t                       n,
+                                           const hipDoubleComplex* const x[],
+                                           int64_t                       incx,
+                                           int64_t                       batchCount,
+                                           int64_t*                      result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_izamax_batched_64((rocblas_handle)handle,
+                                                          n,
+                                                          (const rocblas_double_complex* const*)x,
+                                                          incx,
+                                                          batchCount,
+                                                          result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// amax_strided_batched
+hipblasStatus_t hipblasIsamaxStridedBatched(hipblasHandle_t handle,
+                                            int             n,
+                                            const float*    x,
+                                            int             incx,
+                                            hipblasStride   stridex,
+                                            int             batchCount,
+                                            int*            result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_isamax_strided_batched(
+        (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdamaxStridedBatched(hipblasHandle_t handle,
+                                            int             n,
+                                            const double*   x,
+                                            int             incx,
+                                            hipblasStride   stridex,
+                                            int             batchCount,
+                                            int*            result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_idamax_strided_batched(
+        (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamaxStridedBatched(hipblasHandle_t       handle,
+                                            int                   n,
+                                            const hipblasComplex* x,
+                                            int                   incx,
+                                            hipblasStride         stridex,
+                                            int                   batchCount,
+                                            int*                  result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_icamax_strided_batched(
+        (rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamaxStridedBatched(hipblasHandle_t             handle,
+                                            int                         n,
+                                            const hipblasDoubleComplex* x,
+                                            int                         incx,
+                                            hipblasStride               stridex,
+                                            int                         batchCount,
+                                            int*                        result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_izamax_strided_batched(
+        (rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamaxStridedBatched_v2(hipblasHandle_t   handle,
+                                               int               n,
+                                               const hipComplex* x,
+                                               int               incx,
+                                               hipblasStride     stridex,
+                                               int               batchCount,
+                                               int*              result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_icamax_strided_batched(
+        (rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamaxStridedBatched_v2(hipblasHandle_t         handle,
+                                               int                     n,
+                                               const hipDoubleComplex* x,
+                                               int                     incx,
+                                               hipblasStride           stridex,
+                                               int                     batchCount,
+                                               int*                    result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_izamax_strided_batched(
+        (rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// amax_strided_batched_64
+hipblasStatus_t hipblasIsamaxStridedBatched_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               const float*    x,
+                                               int64_t         incx,
+                                               hipblasStride   stridex,
+                                               int64_t         batchCount,
+                                               int64_t*        result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_isamax_strided_batched_64(
+        (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdamaxStridedBatched_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               const double*   x,
+                                               int64_t         incx,
+                                               hipblasStride   stridex,
+                                               int64_t         batchCount,
+                                               int64_t*        result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_idamax_strided_batched_64(
+        (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamaxStridedBatched_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasStride         stridex,
+                                               int64_t               batchCount,
+                                               int64_t*              result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_icamax_strided_batched_64(
+        (rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamaxStridedBatched_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               hipblasStride               stridex,
+                                               int64_t                     batchCount,
+                                               int64_t*                    result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_izamax_strided_batched_64(
+        (rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamaxStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                  int64_t           n,
+                                                  const hipComplex* x,
+                                                  int64_t           incx,
+                                                  hipblasStride     stridex,
+                                                  int64_t           batchCount,
+                                                  int64_t*          result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_icamax_strided_batched_64(
+        (rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamaxStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                  int64_t                 n,
+                                                  const hipDoubleComplex* x,
+                                                  int64_t                 incx,
+                                                  hipblasStride           stridex,
+                                                  int64_t                 batchCount,
+                                                  int64_t*                result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_izamax_strided_batched_64(
+        (rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// amin
+hipblasStatus_t hipblasIsamin(hipblasHandle_t handle, int n, const float* x, int incx, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_isamin((rocblas_handle)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdamin(hipblasHandle_t handle, int n, const double* x, int incx, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_idamin((rocblas_handle)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasIcamin(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    return hipblasConvertStatus(
+        rocblas_icamin((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamin(
+    hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_izamin((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasIcamin_v2(hipblasHandle_t handle, int n, const hipComplex* x, int incx, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    return hipblasConvertStatus(
+        rocblas_icamin((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamin_v2(
+    hipblasHandle_t handle, int n, const hipDoubleComplex* x, int incx, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_izamin((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// amin_64
+hipblasStatus_t hipblasIsamin_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_isamin_64((rocblas_handle)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdamin_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_idamin_64((rocblas_handle)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamin_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_icamin_64((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamin_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_izamin_64((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamin_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipComplex* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_icamin_64((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamin_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipDoubleComplex* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_izamin_64((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// amin_batched
+hipblasStatus_t hipblasIsaminBatched(
+    hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_isamin_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdaminBatched(
+    hipblasHandle_t handle, int n, const double* const x[], int incx, int batchCount, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_idamin_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcaminBatched(hipblasHandle_t             handle,
+                                     int                         n,
+                                     const hipblasComplex* const x[],
+                                     int                         incx,
+                                     int                         batchCount,
+                                     int*                        result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_icamin_batched(
+        (rocblas_handle)handle, n, (rocblas_float_complex* const*)x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzaminBatched(hipblasHandle_t                   handle,
+                                     int                               n,
+                                     const hipblasDoubleComplex* const x[],
+                                     int                               incx,
+                                     int                               batchCount,
+                                     int*                              result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_izamin_batched(
+        (rocblas_handle)handle, n, (rocblas_double_complex* const*)x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcaminBatched_v2(hipblasHandle_t         handle,
+                                        int                     n,
+                                        const hipComplex* const x[],
+                                        int                     incx,
+                                        int                     batchCount,
+                                        int*                    result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_icamin_batched(
+        (rocblas_handle)handle, n, (rocblas_float_complex* const*)x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzaminBatched_v2(hipblasHandle_t               handle,
+                                        int                           n,
+                                        const hipDoubleComplex* const x[],
+                                        int                           incx,
+                                        int                           batchCount,
+                                        int*                          result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_izamin_batched(
+        (rocblas_handle)handle, n, (rocblas_double_complex* const*)x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// amin_batched_64
+hipblasStatus_t hipblasIsaminBatched_64(hipblasHandle_t    handle,
+                                        int64_t            n,
+                                        const float* const x[],
+                                        int64_t            incx,
+                                        int64_t            batchCount,
+                                        int64_t*           result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_isamin_batched_64((rocblas_handle)handle, n, x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdaminBatched_64(hipblasHandle_t     handle,
+                                        int64_t             n,
+                                        const double* const x[],
+                                        int64_t             incx,
+                                        int64_t             batchCount,
+                                        int64_t*            result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_idamin_batched_64((rocblas_handle)handle, n, x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcaminBatched_64(hipblasHandle_t             handle,
+                                        int64_t                     n,
+                                        const hipblasComplex* const x[],
+                                        int64_t                     incx,
+                                        int64_t                     batchCount,
+                                        int64_t*                    result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_icamin_batched_64(
+        (rocblas_handle)handle, n, (rocblas_float_complex* const*)x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzaminBatched_64(hipblasHandle_t                   handle,
+                                        int64_t                           n,
+                                        const hipblasDoubleComplex* const x[],
+                                        int64_t                           incx,
+                                        int64_t                           batchCount,
+                                        int64_t*                          result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_izamin_batched_64(
+        (rocblas_handle)handle, n, (rocblas_double_complex* const*)x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcaminBatched_v2_64(hipblasHandle_t         handle,
+                                           int64_t                 n,
+                                           const hipComplex* const x[],
+                                           int64_t                 incx,
+                                           int64_t                 batchCount,
+                                           int64_t*                result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_icamin_batched_64(
+        (rocblas_handle)handle, n, (rocblas_float_complex* const*)x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzaminBatched_v2_64(hipblasHandle_t               handle,
+                                           int64_t                       n,
+                                           const hipDoubleComplex* const x[],
+                                           int64_t                       incx,
+                                           int64_t                       batchCount,
+                                           int64_t*                      result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_izamin_batched_64(
+        (rocblas_handle)handle, n, (rocblas_double_complex* const*)x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// amin_strided_batched
+hipblasStatus_t hipblasIsaminStridedBatched(hipblasHandle_t handle,
+                                            int             n,
+                                            const float*    x,
+                                            int             incx,
+                                            hipblasStride   stridex,
+                                            int             batchCount,
+                                            int*            result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_isamin_strided_batched(
+        (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdaminStridedBatched(hipblasHandle_t handle,
+                                            int             n,
+                                            const double*   x,
+                                            int             incx,
+                                            hipblasStride   stridex,
+                                            int             batchCount,
+                                            int*            result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_idamin_strided_batched(
+        (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcaminStridedBatched(hipblasHandle_t       handle,
+                                            int                   n,
+                                            const hipblasComplex* x,
+                                            int                   incx,
+                                            hipblasStride         stridex,
+                                            int                   batchCount,
+                                            int*                  result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_icamin_strided_batched(
+        (rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzaminStridedBatched(hipblasHandle_t             handle,
+                                            int                         n,
+                                            const hipblasDoubleComplex* x,
+                                            int                         incx,
+                                            hipblasStride               stridex,
+                                            int                         batchCount,
+                                            int*                        result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_izamin_strided_batched(
+        (rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcaminStridedBatched_v2(hipblasHandle_t   handle,
+                                               int               n,
+                                               const hipComplex* x,
+                                               int               incx,
+                                               hipblasStride     stridex,
+                                               int               batchCount,
+                                               int*              result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_icamin_strided_batched(
+        (rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzaminStridedBatched_v2(hipblasHandle_t         handle,
+                                               int                     n,
+                                               const hipDoubleComplex* x,
+                                               int                     incx,
+                                               hipblasStride           stridex,
+                                               int                     batchCount,
+                                               int*                    result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_izamin_strided_batched(
+        (rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// amin_strided_batched_64
+hipblasStatus_t hipblasIsaminStridedBatched_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               const float*    x,
+                                               int64_t         incx,
+                                               hipblasStride   stridex,
+                                               int64_t         batchCount,
+                                               int64_t*        result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_isamin_strided_batched_64(
+        (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdaminStridedBatched_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               const double*   x,
+                                               int64_t         incx,
+                                               hipblasStride   stridex,
+                                               int64_t         batchCount,
+                                               int64_t*        result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_idamin_strided_batched_64(
+        (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcaminStridedBatched_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasStride         stridex,
+                                               int64_t               batchCount,
+                                               int64_t*              result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_icamin_strided_batched_64(
+        (rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzaminStridedBatched_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               hipblasStride               stridex,
+                                               int64_t                     batchCount,
+                                               int64_t*                    result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_izamin_strided_batched_64(
+        (rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcaminStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                  int64_t           n,
+                                                  const hipComplex* x,
+                                                  int64_t           incx,
+                                                  hipblasStride     stridex,
+                                                  int64_t           batchCount,
+                                                  int64_t*          result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_icamin_strided_batched_64(
+        (rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzaminStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                  int64_t                 n,
+                                                  const hipDoubleComplex* x,
+                                                  int64_t                 incx,
+                                                  hipblasStride           stridex,
+                                                  int64_t                 batchCount,
+                                                  int64_t*                result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_izamin_strided_batched_64(
+        (rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// asum
+hipblasStatus_t hipblasSasum(hipblasHandle_t handle, int n, const float* x, int incx, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleAsum(handle, n, x, incx, result, HIP_R_32F);
+    return hipblasConvertStatus(rocblas_sasum((rocblas_handle)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasDasum(hipblasHandle_t handle, int n, const double* x, int incx, double* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleAsum(handle, n, x, incx, result, HIP_R_64F);
+    return hipblasConvertStatus(rocblas_dasum((rocblas_handle)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasScasum(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleAsum(handle, n, x, incx, result, HIP_C_32F);
+    return hipblasConvertStatus(
+        rocblas_scasum((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDzasum(
+    hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleAsum(handle, n, x, incx, result, HIP_C_64F);
+    return hipblasConvertStatus(
+        rocblas_dzasum((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasScasum_v2(hipblasHandle_t handle, int n, const hipComplex* x, int incx, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleAsum(handle, n, x, incx, result, HIP_C_32F);
+    return hipblasConvertStatus(
+        rocblas_scasum((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDzasum_v2(
+    hipblasHandle_t handle, int n, const hipDoubleComplex* x, int incx, double* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleAsum(handle, n, x, incx, result, HIP_C_64F);
+    return hipblasConvertStatus(
+        rocblas_dzasum((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// asum_64
+hipblasStatus_t
+    hipblasSasum_64(hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    return hipblasConvertStatus(rocblas_sasum_64((rocblas_handle)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDasum_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dasum_64((rocblas_handle)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScasum_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_scasum_64((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDzasum_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_dzasum_64((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScasum_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipComplex* x, int64_t incx, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_scasum_64((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDzasum_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipDoubleComplex* x, int64_t incx, double* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_dzasum_64((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// asum_batched
+hipblasStatus_t hipblasSasumBatched(
+    hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_sasum_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDasumBatched(hipblasHandle_t     handle,
+                                    int                 n,
+                                    const double* const x[],
+                                    int                 incx,
+                                    int                 batchCount,
+                                    double*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_dasum_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScasumBatched(hipblasHandle_t             handle,
+                                     int                         n,
+                                     const hipblasComplex* const x[],
+                                     int                         incx,
+                                     int                         batchCount,
+                                     float*                      result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_scasum_batched(
+        (rocblas_handle)handle, n, (rocblas_float_complex* const*)x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDzasumBatched(hipblasHandle_t                   handle,
+                                     int                               n,
+                                     const hipblasDoubleComplex* const x[],
+                                     int                               incx,
+                                     int                               batchCount,
+                                     double*                           result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dzasum_batched(
+        (rocblas_handle)handle, n, (rocblas_double_complex* const*)x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScasumBatched_v2(hipblasHandle_t         handle,
+                                        int                     n,
+                                        const hipComplex* const x[],
+                                        int                     incx,
+                                        int                     batchCount,
+                                        float*                  result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_scasum_batched(
+        (rocblas_handle)handle, n, (rocblas_float_complex* const*)x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDzasumBatched_v2(hipblasHandle_t               handle,
+                                        int                           n,
+                                        const hipDoubleComplex* const x[],
+                                        int                           incx,
+                                        int                           batchCount,
+                                        double*                       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dzasum_batched(
+        (rocblas_handle)handle, n, (rocblas_double_complex* const*)x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// asum_batched_64
+hipblasStatus_t hipblasSasumBatched_64(hipblasHandle_t    handle,
+                                       int64_t            n,
+                                       const float* const x[],
+                                       int64_t            incx,
+                                       int64_t            batchCount,
+                                       float*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_sasum_batched_64((rocblas_handle)handle, n, x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDasumBatched_64(hipblasHandle_t     handle,
+                                       int64_t             n,
+                                       const double* const x[],
+                                       int64_t             incx,
+                                       int64_t             batchCount,
+                                       double*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_dasum_batched_64((rocblas_handle)handle, n, x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScasumBatched_64(hipblasHandle_t             handle,
+                                        int64_t                     n,
+                                        const hipblasComplex* const x[],
+                                        int64_t                     incx,
+                                        int64_t                     batchCount,
+                                        float*                      result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_scasum_batched_64(
+        (rocblas_handle)handle, n, (rocblas_float_complex* const*)x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDzasumBatched_64(hipblasHandle_t                   handle,
+                                        int64_t                           n,
+                                        const hipblasDoubleComplex* const x[],
+                                        int64_t                           incx,
+                                        int64_t                           batchCount,
+                                        double*                           result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dzasum_batched_64(
+        (rocblas_handle)handle, n, (rocblas_double_complex* const*)x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScasumBatched_v2_64(hipblasHandle_t         handle,
+                                           int64_t                 n,
+                                           const hipComplex* const x[],
+                                           int64_t                 incx,
+                                           int64_t                 batchCount,
+                                           float*                  result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_scasum_batched_64(
+        (rocblas_handle)handle, n, (rocblas_float_complex* const*)x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDzasumBatched_v2_64(hipblasHandle_t               handle,
+                                           int64_t                       n,
+                                           const hipDoubleComplex* const x[],
+                                           int64_t                       incx,
+                                           int64_t                       batchCount,
+                                           double*                       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dzasum_batched_64(
+        (rocblas_handle)handle, n, (rocblas_double_complex* const*)x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// asum_strided_batched
+hipblasStatus_t hipblasSasumStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           const float*    x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           int             batchCount,
+                                           float*          result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_sasum_strided_batched(
+        (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDasumStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           const double*   x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           int             batchCount,
+                                           double*         result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dasum_strided_batched(
+        (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScasumStridedBatched(hipblasHandle_t       handle,
+                                            int                   n,
+                                            const hipblasComplex* x,
+                                            int                   incx,
+                                            hipblasStride         stridex,
+                                            int                   batchCount,
+                                            float*                result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_scasum_strided_batched(
+        (rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDzasumStridedBatched(hipblasHandle_t             handle,
+                                            int                         n,
+                                            const hipblasDoubleComplex* x,
+                                            int                         incx,
+                                            hipblasStride               stridex,
+                                            int                         batchCount,
+                                            double*                     result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dzasum_strided_batched(
+        (rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScasumStridedBatched_v2(hipblasHandle_t   handle,
+                                               int               n,
+                                               const hipComplex* x,
+                                               int               incx,
+                                               hipblasStride     stridex,
+                                               int               batchCount,
+                                               float*            result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_scasum_strided_batched(
+        (rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDzasumStridedBatched_v2(hipblasHandle_t         handle,
+                                               int                     n,
+                                               const hipDoubleComplex* x,
+                                               int                     incx,
+                                               hipblasStride           stridex,
+                                               int                     batchCount,
+                                               double*                 result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dzasum_strided_batched(
+        (rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// asum_strided_batched_64
+hipblasStatus_t hipblasSasumStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const float*    x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              int64_t         batchCount,
+                                              float*          result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_sasum_strided_batched_64(
+        (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDasumStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const double*   x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              int64_t         batchCount,
+                                              double*         result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dasum_strided_batched_64(
+        (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScasumStridedBatched_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasStride         stridex,
+                                               int64_t               batchCount,
+                                               float*                result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_scasum_strided_batched_64(
+        (rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDzasumStridedBatched_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               hipblasStride               stridex,
+                                               int64_t                     batchCount,
+                                               double*                     result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dzasum_strided_batched_64(
+        (rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScasumStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                  int64_t           n,
+                                                  const hipComplex* x,
+                                                  int64_t           incx,
+                                                  hipblasStride     stridex,
+                                                  int64_t           batchCount,
+                                                  float*            result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_scasum_strided_batched_64(
+        (rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDzasumStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                  int64_t                 n,
+                                                  const hipDoubleComplex* x,
+                                                  int64_t                 incx,
+                                                  hipblasStride           stridex,
+                                                  int64_t                 batchCount,
+                                                  double*                 result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dzasum_strided_batched_64(
+        (rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// axpy
+hipblasStatus_t hipblasHaxpy(hipblasHandle_t    handle,
+                             int                n,
+                             const hipblasHalf* alpha,
+                             const hipblasHalf* x,
+                             int                incx,
+                             hipblasHalf*       y,
+                             int                incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_haxpy((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_half*)alpha,
+                                              (rocblas_half*)x,
+                                              incx,
+                                              (rocblas_half*)y,
+                                              incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSaxpy(
+    hipblasHandle_t handle, int n, const float* alpha, const float* x, int incx, float* y, int incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t deferred = hipblasDeferVector(handle, n, alpha, x, incx, y, incy, HIP_R_32F);
+    if(deferred != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return deferred;
+    hipblasStatus_t host = hipblasHostAxpy(handle, n, alpha, x, incx, y, incy, HIP_R_32F);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    return hipblasConvertStatus(rocblas_saxpy((rocblas_handle)handle, n, alpha, x, incx, y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDaxpy(hipblasHandle_t handle,
+                             int             n,
+                             const double*   alpha,
+                             const double*   x,
+                             int             incx,
+                             double*         y,
+                             int             incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t deferred = hipblasDeferVector(handle, n, alpha, x, incx, y, incy, HIP_R_64F);
+    if(deferred != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return deferred;
+    hipblasStatus_t host = hipblasHostAxpy(handle, n, alpha, x, incx, y, incy, HIP_R_64F);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    return hipblasConvertStatus(rocblas_daxpy((rocblas_handle)handle, n, alpha, x, incx, y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCaxpy(hipblasHandle_t       handle,
+                             int                   n,
+                             const hipblasComplex* alpha,
+                             const hipblasComplex* x,
+                             int                   incx,
+                             hipblasComplex*       y,
+                             int                   incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostAxpy(handle, n, alpha, x, incx, y, incy, HIP_C_32F);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    return hipblasConvertStatus(rocblas_caxpy((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_float_complex*)alpha,
+                                              (rocblas_float_complex*)x,
+                                              incx,
+                                              (rocblas_float_complex*)y,
+                                              incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZaxpy(hipblasHandle_t             handle,
+                             int                         n,
+                             const hipblasDoubleComplex* alpha,
+                             const hipblasDoubleComplex* x,
+                             int                         incx,
+                             hipblasDoubleComplex*       y,
+                             int                         incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostAxpy(handle, n, alpha, x, incx, y, incy, HIP_C_64F);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    return hipblasConvertStatus(rocblas_zaxpy((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_double_complex*)alpha,
+                                              (rocblas_double_complex*)x,
+                                              incx,
+                                              (rocblas_double_complex*)y,
+                                              incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCaxpy_v2(hipblasHandle_t   handle,
+                                int               n,
+                                const hipComplex* alpha,
+                                const hipComplex* x,
+                                int               incx,
+                                hipComplex*       y,
+                                int               incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostAxpy(handle, n, alpha, x, incx, y, incy, HIP_C_32F);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    return hipblasConvertStatus(rocblas_caxpy((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_float_complex*)alpha,
+                                              (rocblas_float_complex*)x,
+                                              incx,
+                                              (rocblas_float_complex*)y,
+                                              incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZaxpy_v2(hipblasHandle_t         handle,
+                                int                     n,
+                                const hipDoubleComplex* alpha,
+                                const hipDoubleComplex* x,
+                                int                     incx,
+                                hipDoubleComplex*       y,
+                                int                     incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostAxpy(handle, n, alpha, x, incx, y, incy, HIP_C_64F);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    return hipblasConvertStatus(rocblas_zaxpy((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_double_complex*)alpha,
+                                              (rocblas_double_complex*)x,
+                                              incx,
+                                              (rocblas_double_complex*)y,
+                                              incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// 64-bit interface
+hipblasStatus_t hipblasHaxpy_64(hipblasHandle_t    handle,
+                                int64_t            n,
+                                const hipblasHalf* alpha,
+                                const hipblasHalf* x,
+                                int64_t            incx,
+                                hipblasHalf*       y,
+                                int64_t            incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_haxpy_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_half*)alpha,
+                                                 (rocblas_half*)x,
+                                                 incx,
+                                                 (rocblas_half*)y,
+                                                 incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSaxpy_64(hipblasHandle_t handle,
+                                int64_t         n,
+                                const float*    alpha,
+                                const float*    x,
+                                int64_t         incx,
+                                float*          y,
+                                int64_t         incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(
+        rocblas_saxpy_64((rocblas_handle)handle, n, alpha, x, incx, y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDaxpy_64(hipblasHandle_t handle,
+                                int64_t         n,
+                                const double*   alpha,
+                                const double*   x,
+                                int64_t         incx,
+                                double*         y,
+                                int64_t         incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(
+        rocblas_daxpy_64((rocblas_handle)handle, n, alpha, x, incx, y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCaxpy_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                hipblasComplex*       y,
+                                int64_t               incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_caxpy_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_float_complex*)alpha,
+                                                 (rocblas_float_complex*)x,
+                                                 incx,
+                                                 (rocblas_float_complex*)y,
+                                                 incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZaxpy_64(hipblasHandle_t             handle,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                hipblasDoubleComplex*       y,
+                                int64_t                     incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_zaxpy_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_double_complex*)alpha,
+                                                 (rocblas_double_complex*)x,
+                                                 incx,
+                                                 (rocblas_double_complex*)y,
+                                                 incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCaxpy_v2_64(hipblasHandle_t   handle,
+                                   int64_t           n,
+                                   const hipComplex* alpha,
+                                   const hipComplex* x,
+                                   int64_t           incx,
+                                   hipComplex*       y,
+                                   int64_t           incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_caxpy_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_float_complex*)alpha,
+                                                 (rocblas_float_complex*)x,
+                                                 incx,
+                                                 (rocblas_float_complex*)y,
+                                                 incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZaxpy_v2_64(hipblasHandle_t         handle,
+                                   int64_t                 n,
+                                   const hipDoubleComplex* alpha,
+                                   const hipDoubleComplex* x,
+                                   int64_t                 incx,
+                                   hipDoubleComplex*       y,
+                                   int64_t                 incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_zaxpy_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_double_complex*)alpha,
+                                                 (rocblas_double_complex*)x,
+                                                 incx,
+                                                 (rocblas_double_complex*)y,
+                                                 incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// axpy_batched
+hipblasStatus_t hipblasHaxpyBatched(hipblasHandle_t          handle,
+                                    int                      n,
+                                    const hipblasHalf*       alpha,
+                                    const hipblasHalf* const x[],
+                                    int                      incx,
+                                    hipblasHalf* const       y[],
+                                    int                      incy,
+                                    int                      batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_haxpy_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_half*)alpha,
+                                                      (rocblas_half* const*)x,
+                                                      incx,
+                                                      (rocblas_half* const*)y,
+                                                      incy,
+                                                      batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSaxpyBatched(hipblasHandle_t    handle,
+                                    int                n,
+                                    const float*       alpha,
+                                    const float* const x[],
+                                    int                incx,
+                                    float* const       y[],
+                                    int                incy,
+                                    int                batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(
+        rocblas_saxpy_batched((rocblas_handle)handle, n, alpha, x, incx, y, incy, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDaxpyBatched(hipblasHandle_t     handle,
+                                    int                 n,
+                                    const double*       alpha,
+                                    const double* const x[],
+                                    int                 incx,
+                                    double* const       y[],
+                                    int                 incy,
+                                    int                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(
+        rocblas_daxpy_batched((rocblas_handle)handle, n, alpha, x, incx, y, incy, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCaxpyBatched(hipblasHandle_t             handle,
+                                    int                         n,
+                                    const hipblasComplex*       alpha,
+                                    const hipblasComplex* const x[],
+                                    int                         incx,
+                                    hipblasComplex* const       y[],
+                                    int                         incy,
+                                    int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_caxpy_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_float_complex*)alpha,
+                                                      (rocblas_float_complex* const*)x,
+                                                      incx,
+                                                      (rocblas_float_complex* const*)y,
+                                                      incy,
+                                                      batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZaxpyBatched(hipblasHandle_t                   handle,
+                                    int                               n,
+                                    const hipblasDoubleComplex*       alpha,
+                                    const hipblasDoubleComplex* const x[],
+                                    int                               incx,
+                                    hipblasDoubleComplex* const       y[],
+                                    int                               incy,
+                                    int                               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_zaxpy_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_double_complex*)alpha,
+                                                      (rocblas_double_complex* const*)x,
+                                                      incx,
+                                                      (rocblas_double_complex* const*)y,
+                                                      incy,
+                                                      batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCaxpyBatched_v2(hipblasHandle_t         handle,
+                                       int                     n,
+                                       const hipComplex*       alpha,
+                                       const hipComplex* const x[],
+                                       int                     incx,
+                                       hipComplex* const       y[],
+                                       int                     incy,
+                                       int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_caxpy_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_float_complex*)alpha,
+                                                      (rocblas_float_complex* const*)x,
+                                                      incx,
+                                                      (rocblas_float_complex* const*)y,
+                                                      incy,
+                                                      batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZaxpyBatched_v2(hipblasHandle_t               handle,
+                                       int                           n,
+                                       const hipDoubleComplex*       alpha,
+                                       const hipDoubleComplex* const x[],
+                                       int                           incx,
+                                       hipDoubleComplex* const       y[],
+                                       int                           incy,
+                                       int                           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_zaxpy_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_double_complex*)alpha,
+                                                      (rocblas_double_complex* const*)x,
+                                                      incx,
+                                                      (rocblas_double_complex* const*)y,
+                                                      incy,
+                                                      batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// 64-bit interface
+hipblasStatus_t hipblasHaxpyBatched_64(hipblasHandle_t          handle,
+                                       int64_t                  n,
+                                       const hipblasHalf*       alpha,
+                                       const hipblasHalf* const x[],
+                                       int64_t                  incx,
+                                       hipblasHalf* const       y[],
+                                       int64_t                  incy,
+                                       int64_t                  batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_haxpy_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_half*)alpha,
+                                                         (rocblas_half* const*)x,
+                                                         incx,
+                                                         (rocblas_half* const*)y,
+                                                         incy,
+                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSaxpyBatched_64(hipblasHandle_t    handle,
+                                       int64_t            n,
+                                       const float*       alpha,
+                                       const float* const x[],
+                                       int64_t            incx,
+                                       float* const       y[],
+                                       int64_t            incy,
+                                       int64_t            batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(
+        rocblas_saxpy_batched_64((rocblas_handle)handle, n, alpha, x, incx, y, incy, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDaxpyBatched_64(hipblasHandle_t     handle,
+                                       int64_t             n,
+                                       const double*       alpha,
+                                       const double* const x[],
+                                       int64_t             incx,
+                                       double* const       y[],
+                                       int64_t             incy,
+                                       int64_t             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(
+        rocblas_daxpy_batched_64((rocblas_handle)handle, n, alpha, x, incx, y, incy, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCaxpyBatched_64(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const x[],
+                                       int64_t                     incx,
+                                       hipblasComplex* const       y[],
+                                       int64_t                     incy,
+                                       int64_t                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_caxpy_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_float_complex*)alpha,
+                                                         (rocblas_float_complex* const*)x,
+                                                         incx,
+                                                         (rocblas_float_complex* const*)y,
+                                                         incy,
+                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZaxpyBatched_64(hipblasHandle_t                   handle,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const x[],
+                                       int64_t                           incx,
+                                       hipblasDoubleComplex* const       y[],
+                                       int64_t                           incy,
+                                       int64_t                           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_zaxpy_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_double_complex*)alpha,
+                                                         (rocblas_double_complex* const*)x,
+                                                         incx,
+                                                         (rocblas_double_complex* const*)y,
+                                                         incy,
+                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCaxpyBatched_v2_64(hipblasHandle_t         handle,
+                                          int64_t                 n,
+                                          const hipComplex*       alpha,
+                                          const hipComplex* const x[],
+                                          int64_t                 incx,
+                                          hipComplex* const       y[],
+                                          int64_t                 incy,
+                                          int64_t                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_caxpy_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_float_complex*)alpha,
+                                                         (rocblas_float_complex* const*)x,
+                                                         incx,
+                                                         (rocblas_float_complex* const*)y,
+                                                         incy,
+                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZaxpyBatched_v2_64(hipblasHandle_t               handle,
+                                          int64_t                       n,
+                                          const hipDoubleComplex*       alpha,
+                                          const hipDoubleComplex* const x[],
+                                          int64_t                       incx,
+                                          hipDoubleComplex* const       y[],
+                                          int64_t                       incy,
+                                          int64_t                       batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_zaxpy_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_double_complex*)alpha,
+                                                         (rocblas_double_complex* const*)x,
+                                                         incx,
+                                                         (rocblas_double_complex* const*)y,
+                                                         incy,
+                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// axpy_strided_batched
+hipblasStatus_t hipblasHaxpyStridedBatched(hipblasHandle_t    handle,
+                                           int                n,
+                                           const hipblasHalf* alpha,
+                                           const hipblasHalf* x,
+                                           int                incx,
+                                           hipblasStride      stridex,
+                                           hipblasHalf*       y,
+                                           int                incy,
+                                           hipblasStride      stridey,
+                                           int                batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_haxpy_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_half*)alpha,
+                                                              (rocblas_half*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_half*)y,
+                                                              incy,
+                                                              stridey,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSaxpyStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           const float*    alpha,
+                                           const float*    x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           float*          y,
+                                           int             incy,
+                                           hipblasStride   stridey,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_saxpy_strided_batched(
+        (rocblas_handle)handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDaxpyStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           const double*   alpha,
+                                           const double*   x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           double*         y,
+                                           int             incy,
+                                           hipblasStride   stridey,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_daxpy_strided_batched(
+        (rocblas_handle)handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCaxpyStridedBatched(hipblasHandle_t       handle,
+                                           int                   n,
+                                           const hipblasComplex* alpha,
+                                           const hipblasComplex* x,
+                                           int                   incx,
+                                           hipblasStride         stridex,
+                                           hipblasComplex*       y,
+                                           int                   incy,
+                                           hipblasStride         stridey,
+                                           int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_caxpy_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_float_complex*)alpha,
+                                                              (rocblas_float_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_float_complex*)y,
+                                                              incy,
+                                                              stridey,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZaxpyStridedBatched(hipblasHandle_t             handle,
+                                           int                         n,
+                                           const hipblasDoubleComplex* alpha,
+                                           const hipblasDoubleComplex* x,
+                                           int                         incx,
+                                           hipblasStride               stridex,
+                                           hipblasDoubleComplex*       y,
+                                           int                         incy,
+                                           hipblasStride               stridey,
+                                           int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_zaxpy_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_double_complex*)alpha,
+                                                              (rocblas_double_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_double_complex*)y,
+                                                              incy,
+                                                              stridey,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCaxpyStridedBatched_v2(hipblasHandle_t   handle,
+                                              int               n,
+                                              const hipComplex* alpha,
+                                              const hipComplex* x,
+                                              int               incx,
+                                              hipblasStride     stridex,
+                                              hipComplex*       y,
+                                              int               incy,
+                                              hipblasStride     stridey,
+                                              int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_caxpy_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_float_complex*)alpha,
+                                                              (rocblas_float_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_float_complex*)y,
+                                                              incy,
+                                                              stridey,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZaxpyStridedBatched_v2(hipblasHandle_t         handle,
+                                              int                     n,
+                                              const hipDoubleComplex* alpha,
+                                              const hipDoubleComplex* x,
+                                              int                     incx,
+                                              hipblasStride           stridex,
+                                              hipDoubleComplex*       y,
+                                              int                     incy,
+                                              hipblasStride           stridey,
+                                              int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_zaxpy_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_double_complex*)alpha,
+                                                              (rocblas_double_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_double_complex*)y,
+                                                              incy,
+                                                              stridey,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// 64-bit interface
+hipblasStatus_t hipblasHaxpyStridedBatched_64(hipblasHandle_t    handle,
+                                              int64_t            n,
+                                              const hipblasHalf* alpha,
+                                              const hipblasHalf* x,
+                                              int64_t            incx,
+                                              hipblasStride      stridex,
+                                              hipblasHalf*       y,
+                                              int64_t            incy,
+                                              hipblasStride      stridey,
+                                              int64_t            batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_haxpy_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_half*)alpha,
+                                                                 (rocblas_half*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_half*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSaxpyStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const float*    alpha,
+                                              const float*    x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              float*          y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_saxpy_strided_batched_64(
+        (rocblas_handle)handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDaxpyStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const double*   alpha,
+                                              const double*   x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              double*         y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_daxpy_strided_batched_64(
+        (rocblas_handle)handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCaxpyStridedBatched_64(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              hipblasComplex*       y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_caxpy_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_float_complex*)alpha,
+                                                                 (rocblas_float_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_float_complex*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZaxpyStridedBatched_64(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              hipblasDoubleComplex*       y,
+                                              int64_t                     incy,
+                                              hipblasStride               stridey,
+                                              int64_t                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_zaxpy_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_double_complex*)alpha,
+                                                                 (rocblas_double_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_double_complex*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCaxpyStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                 int64_t           n,
+                                                 const hipComplex* alpha,
+                                                 const hipComplex* x,
+                                                 int64_t           incx,
+                                                 hipblasStride     stridex,
+                                                 hipComplex*       y,
+                                                 int64_t           incy,
+                                                 hipblasStride     stridey,
+                                                 int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_caxpy_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_float_complex*)alpha,
+                                                                 (rocblas_float_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_float_complex*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZaxpyStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                 int64_t                 n,
+                                                 const hipDoubleComplex* alpha,
+                                                 const hipDoubleComplex* x,
+                                                 int64_t                 incx,
+                                                 hipblasStride           stridex,
+                                                 hipDoubleComplex*       y,
+                                                 int64_t                 incy,
+                                                 hipblasStride           stridey,
+                                                 int64_t                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_zaxpy_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_double_complex*)alpha,
+                                                                 (rocblas_double_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_double_complex*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// copy
+hipblasStatus_t
+    hipblasScopy(hipblasHandle_t handle, int n, const float* x, int incx, float* y, int incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_scopy((rocblas_handle)handle, n, x, incx, y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasDcopy(hipblasHandle_t handle, int n, const double* x, int incx, double* y, int incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_dcopy((rocblas_handle)handle, n, x, incx, y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCcopy(
+    hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, hipblasComplex* y, int incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_ccopy((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_float_complex*)x,
+                                              incx,
+                                              (rocblas_float_complex*)y,
+                                              incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZcopy(hipblasHandle_t             handle,
+                             int                         n,
+                             const hipblasDoubleComplex* x,
+                             int                         incx,
+                             hipblasDoubleComplex*       y,
+                             int                         incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_zcopy((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_double_complex*)x,
+                                              incx,
+                                              (rocblas_double_complex*)y,
+                                              incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCcopy_v2(
+    hipblasHandle_t handle, int n, const hipComplex* x, int incx, hipComplex* y, int incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_ccopy((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_float_complex*)x,
+                                              incx,
+                                              (rocblas_float_complex*)y,
+                                              incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZcopy_v2(hipblasHandle_t         handle,
+                                int                     n,
+                                const hipDoubleComplex* x,
+                                int                     incx,
+                                hipDoubleComplex*       y,
+                                int                     incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_zcopy((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_double_complex*)x,
+                                              incx,
+                                              (rocblas_double_complex*)y,
+                                              incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// 64-bit interface
+hipblasStatus_t hipblasScopy_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* y, int64_t incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_scopy_64((rocblas_handle)handle, n, x, incx, y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDcopy_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* y, int64_t incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_dcopy_64((rocblas_handle)handle, n, x, incx, y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCcopy_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                hipblasComplex*       y,
+                                int64_t               incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_ccopy_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_float_complex*)x,
+                                                 incx,
+                                                 (rocblas_float_complex*)y,
+                                                 incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZcopy_64(hipblasHandle_t             handle,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                hipblasDoubleComplex*       y,
+                                int64_t                     incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_zcopy_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_double_complex*)x,
+                                                 incx,
+                                                 (rocblas_double_complex*)y,
+                                                 incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCcopy_v2_64(hipblasHandle_t   handle,
+                                   int64_t           n,
+                                   const hipComplex* x,
+                                   int64_t           incx,
+                                   hipComplex*       y,
+                                   int64_t           incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_ccopy_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_float_complex*)x,
+                                                 incx,
+                                                 (rocblas_float_complex*)y,
+                                                 incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZcopy_v2_64(hipblasHandle_t         handle,
+                                   int64_t                 n,
+                                   const hipDoubleComplex* x,
+                                   int64_t                 incx,
+                                   hipDoubleComplex*       y,
+                                   int64_t                 incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_zcopy_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_double_complex*)x,
+                                                 incx,
+                                                 (rocblas_double_complex*)y,
+                                                 incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// copy_batched
+hipblasStatus_t hipblasScopyBatched(hipblasHandle_t    handle,
+                                    int                n,
+                                    const float* const x[],
+                                    int                incx,
+                                    float* const       y[],
+                                    int                incy,
+                                    int                batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(
+        rocblas_scopy_batched((rocblas_handle)handle, n, x, incx, y, incy, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDcopyBatched(hipblasHandle_t     handle,
+                                    int                 n,
+                                    const double* const x[],
+                                    int                 incx,
+                                    double* const       y[],
+                                    int                 incy,
+                                    int                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(
+        rocblas_dcopy_batched((rocblas_handle)handle, n, x, incx, y, incy, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCcopyBatched(hipblasHandle_t             handle,
+                                    int                         n,
+                                    const hipblasComplex* const x[],
+                                    int                         incx,
+                                    hipblasComplex* const       y[],
+                                    int                         incy,
+                                    int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_ccopy_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_float_complex**)x,
+                                                      incx,
+                                                      (rocblas_float_complex**)y,
+                                                      incy,
+                                                      batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZcopyBatched(hipblasHandle_t                   handle,
+                                    int                               n,
+                                    const hipblasDoubleComplex* const x[],
+                                    int                               incx,
+                                    hipblasDoubleComplex* const       y[],
+                                    int                               incy,
+                                    int                               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_zcopy_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_double_complex**)x,
+                                                      incx,
+                                                      (rocblas_double_complex**)y,
+                                                      incy,
+                                                      batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCcopyBatched_v2(hipblasHandle_t         handle,
+                                       int                     n,
+                                       const hipComplex* const x[],
+                                       int                     incx,
+                                       hipComplex* const       y[],
+                                       int                     incy,
+                                       int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_ccopy_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_float_complex**)x,
+                                                      incx,
+                                                      (rocblas_float_complex**)y,
+                                                      incy,
+                                                      batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZcopyBatched_v2(hipblasHandle_t               handle,
+                                       int                           n,
+                                       const hipDoubleComplex* const x[],
+                                       int                           incx,
+                                       hipDoubleComplex* const       y[],
+                                       int                           incy,
+                                       int                           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_zcopy_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_double_complex**)x,
+                                                      incx,
+                                                      (rocblas_double_complex**)y,
+                                                      incy,
+                                                      batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// 64-bit interface
+hipblasStatus_t hipblasScopyBatched_64(hipblasHandle_t    handle,
+                                       int64_t            n,
+                                       const float* const x[],
+                                       int64_t            incx,
+                                       float* const       y[],
+                                       int64_t            incy,
+                                       int64_t            batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(
+        rocblas_scopy_batched_64((rocblas_handle)handle, n, x, incx, y, incy, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDcopyBatched_64(hipblasHandle_t     handle,
+                                       int64_t             n,
+                                       const double* const x[],
+                                       int64_t             incx,
+                                       double* const       y[],
+                                       int64_t             incy,
+                                       int64_t             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(
+        rocblas_dcopy_batched_64((rocblas_handle)handle, n, x, incx, y, incy, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCcopyBatched_64(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       const hipblasComplex* const x[],
+                                       int64_t                     incx,
+                                       hipblasComplex* const       y[],
+                                       int64_t                     incy,
+                                       int64_t                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_ccopy_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_float_complex**)x,
+                                                         incx,
+                                                         (rocblas_float_complex**)y,
+                                                         incy,
+                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZcopyBatched_64(hipblasHandle_t                   handle,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex* const x[],
+                                       int64_t                           incx,
+                                       hipblasDoubleComplex* const       y[],
+                                       int64_t                           incy,
+                                       int64_t                           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_zcopy_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_double_complex**)x,
+                                                         incx,
+                                                         (rocblas_double_complex**)y,
+                                                         incy,
+                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCcopyBatched_v2_64(hipblasHandle_t         handle,
+                                          int64_t                 n,
+                                          const hipComplex* const x[],
+                                          int64_t                 incx,
+                                          hipComplex* const       y[],
+                                          int64_t                 incy,
+                                          int64_t                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_ccopy_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_float_complex**)x,
+                                                         incx,
+                                                         (rocblas_float_complex**)y,
+                                                         incy,
+                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZcopyBatched_v2_64(hipblasHandle_t               handle,
+                                          int64_t                       n,
+                                          const hipDoubleComplex* const x[],
+                                          int64_t                       incx,
+                                          hipDoubleComplex* const       y[],
+                                          int64_t                       incy,
+                                          int64_t                       batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_zcopy_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_double_complex**)x,
+                                                         incx,
+                                                         (rocblas_double_complex**)y,
+                                                         incy,
+                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// copy_strided_batched
+hipblasStatus_t hipblasScopyStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           const float*    x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           float*          y,
+                                           int             incy,
+                                           hipblasStride   stridey,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_scopy_strided_batched(
+        (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDcopyStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           const double*   x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           double*         y,
+                                           int             incy,
+                                           hipblasStride   stridey,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_dcopy_strided_batched(
+        (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCcopyStridedBatched(hipblasHandle_t       handle,
+                                           int                   n,
+                                           const hipblasComplex* x,
+                                           int                   incx,
+                                           hipblasStride         stridex,
+                                           hipblasComplex*       y,
+                                           int                   incy,
+                                           hipblasStride         stridey,
+                                           int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_ccopy_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_float_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_float_complex*)y,
+                                                              incy,
+                                                              stridey,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZcopyStridedBatched(hipblasHandle_t             handle,
+                                           int                         n,
+                                           const hipblasDoubleComplex* x,
+                                           int                         incx,
+                                           hipblasStride               stridex,
+                                           hipblasDoubleComplex*       y,
+                                           int                         incy,
+                                           hipblasStride               stridey,
+                                           int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_zcopy_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_double_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_double_complex*)y,
+                                                              incy,
+                                                              stridey,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCcopyStridedBatched_v2(hipblasHandle_t   handle,
+                                              int               n,
+                                              const hipComplex* x,
+                                              int               incx,
+                                              hipblasStride     stridex,
+                                              hipComplex*       y,
+                                              int               incy,
+                                              hipblasStride     stridey,
+                                              int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_ccopy_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_float_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_float_complex*)y,
+                                                              incy,
+                                                              stridey,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZcopyStridedBatched_v2(hipblasHandle_t         handle,
+                                              int                     n,
+                                              const hipDoubleComplex* x,
+                                              int                     incx,
+                                              hipblasStride           stridex,
+                                              hipDoubleComplex*       y,
+                                              int                     incy,
+                                              hipblasStride           stridey,
+                                              int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_zcopy_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_double_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_double_complex*)y,
+                                                              incy,
+                                                              stridey,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// 64-bit interface
+hipblasStatus_t hipblasScopyStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const float*    x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              float*          y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_scopy_strided_batched_64(
+        (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDcopyStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const double*   x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              double*         y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_dcopy_strided_batched_64(
+        (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCcopyStridedBatched_64(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              hipblasComplex*       y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_ccopy_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_float_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_float_complex*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZcopyStridedBatched_64(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              hipblasDoubleComplex*       y,
+                                              int64_t                     incy,
+                                              hipblasStride               stridey,
+                                              int64_t                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_zcopy_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_double_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_double_complex*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCcopyStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                 int64_t           n,
+                                                 const hipComplex* x,
+                                                 int64_t           incx,
+                                                 hipblasStride     stridex,
+                                                 hipComplex*       y,
+                                                 int64_t           incy,
+                                                 hipblasStride     stridey,
+                                                 int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_ccopy_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_float_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_float_complex*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZcopyStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                 int64_t                 n,
+                                                 const hipDoubleComplex* x,
+                                                 int64_t                 incx,
+                                                 hipblasStride           stridex,
+                                                 hipDoubleComplex*       y,
+                                                 int64_t                 incy,
+                                                 hipblasStride           stridey,
+                                                 int64_t                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_zcopy_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_double_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_double_complex*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// dot
+hipblasStatus_t hipblasHdot(hipblasHandle_t    handle,
+                            int                n,
+                            const hipblasHalf* x,
+                            int                incx,
+                            const hipblasHalf* y,
+                            int                incy,
+                            hipblasHalf*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_hdot((rocblas_handle)handle,
+                                             n,
+                                             (rocblas_half*)x,
+                                             incx,
+                                             (rocblas_half*)y,
+                                             incy,
+                                             (rocblas_half*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasBfdot(hipblasHandle_t        handle,
+                             int                    n,
+                             const hipblasBfloat16* x,
+                             int                    incx,
+                             const hipblasBfloat16* y,
+                             int                    incy,
+                             hipblasBfloat16*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_bfdot((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_bfloat16*)x,
+                                              incx,
+                                              (rocblas_bfloat16*)y,
+                                              incy,
+                                              (rocblas_bfloat16*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSdot(hipblasHandle_t handle,
+                            int             n,
+                            const float*    x,
+                            int             incx,
+                            const float*    y,
+                            int             incy,
+                            float*          result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostDot(handle, n, x, incx, y, incy, result, HIP_R_32F, false);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleDot(handle, n, x, incx, y, incy, result, HIP_R_32F, false);
+    return hipblasConvertStatus(rocblas_sdot((rocblas_handle)handle, n, x, incx, y, incy, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDdot(hipblasHandle_t handle,
+                            int             n,
+                            const double*   x,
+                            int             incx,
+                            const double*   y,
+                            int             incy,
+                            double*         result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostDot(handle, n, x, incx, y, incy, result, HIP_R_64F, false);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleDot(handle, n, x, incx, y, incy, result, HIP_R_64F, false);
+    return hipblasConvertStatus(rocblas_ddot((rocblas_handle)handle, n, x, incx, y, incy, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotc(hipblasHandle_t       handle,
+                             int                   n,
+                             const hipblasComplex* x,
+                             int                   incx,
+                             const hipblasComplex* y,
+                             int                   incy,
+                             hipblasComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostDot(handle, n, x, incx, y, incy, result, HIP_C_32F, true);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleDot(handle, n, x, incx, y, incy, result, HIP_C_32F, true);
+    return hipblasConvertStatus(rocblas_cdotc((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_float_complex*)x,
+                                              incx,
+                                              (rocblas_float_complex*)y,
+                                              incy,
+                                              (rocblas_float_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotu(hipblasHandle_t       handle,
+                             int                   n,
+                             const hipblasComplex* x,
+                             int                   incx,
+                             const hipblasComplex* y,
+                             int                   incy,
+                             hipblasComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostDot(handle, n, x, incx, y, incy, result, HIP_C_32F, false);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleDot(handle, n, x, incx, y, incy, result, HIP_C_32F, false);
+    return hipblasConvertStatus(rocblas_cdotu((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_float_complex*)x,
+                                              incx,
+                                              (rocblas_float_complex*)y,
+                                              incy,
+                                              (rocblas_float_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotc(hipblasHandle_t             handle,
+                             int                         n,
+                             const hipblasDoubleComplex* x,
+                             int                         incx,
+                             const hipblasDoubleComplex* y,
+                             int                         incy,
+                             hipblasDoubleComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostDot(handle, n, x, incx, y, incy, result, HIP_C_64F, true);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleDot(handle, n, x, incx, y, incy, result, HIP_C_64F, true);
+    return hipblasConvertStatus(rocblas_zdotc((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_double_complex*)x,
+                                              incx,
+                                              (rocblas_double_complex*)y,
+                                              incy,
+                                              (rocblas_double_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotu(hipblasHandle_t             handle,
+                             int                         n,
+                             const hipblasDoubleComplex* x,
+                             int                         incx,
+                             const hipblasDoubleComplex* y,
+                             int                         incy,
+                             hipblasDoubleComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostDot(handle, n, x, incx, y, incy, result, HIP_C_64F, false);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleDot(handle, n, x, incx, y, incy, result, HIP_C_64F, false);
+    return hipblasConvertStatus(rocblas_zdotu((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_double_complex*)x,
+                                              incx,
+                                              (rocblas_double_complex*)y,
+                                              incy,
+                                              (rocblas_double_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotc_v2(hipblasHandle_t   handle,
+                                int               n,
+                                const hipComplex* x,
+                                int               incx,
+                                const hipComplex* y,
+                                int               incy,
+                                hipComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostDot(handle, n, x, incx, y, incy, result, HIP_C_32F, true);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleDot(handle, n, x, incx, y, incy, result, HIP_C_32F, true);
+    return hipblasConvertStatus(rocblas_cdotc((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_float_complex*)x,
+                                              incx,
+                                              (rocblas_float_complex*)y,
+                                              incy,
+                                              (rocblas_float_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotu_v2(hipblasHandle_t   handle,
+                                int               n,
+                                const hipComplex* x,
+                                int               incx,
+                                const hipComplex* y,
+                                int               incy,
+                                hipComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostDot(handle, n, x, incx, y, incy, result, HIP_C_32F, false);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleDot(handle, n, x, incx, y, incy, result, HIP_C_32F, false);
+    return hipblasConvertStatus(rocblas_cdotu((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_float_complex*)x,
+                                              incx,
+                                              (rocblas_float_complex*)y,
+                                              incy,
+                                              (rocblas_float_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotc_v2(hipblasHandle_t         handle,
+                                int                     n,
+                                const hipDoubleComplex* x,
+                                int                     incx,
+                                const hipDoubleComplex* y,
+                                int                     incy,
+                                hipDoubleComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostDot(handle, n, x, incx, y, incy, result, HIP_C_64F, true);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleDot(handle, n, x, incx, y, incy, result, HIP_C_64F, true);
+    return hipblasConvertStatus(rocblas_zdotc((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_double_complex*)x,
+                                              incx,
+                                              (rocblas_double_complex*)y,
+                                              incy,
+                                              (rocblas_double_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotu_v2(hipblasHandle_t         handle,
+                                int                     n,
+                                const hipDoubleComplex* x,
+                                int                     incx,
+                                const hipDoubleComplex* y,
+                                int                     incy,
+                                hipDoubleComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostDot(handle, n, x, incx, y, incy, result, HIP_C_64F, false);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleDot(handle, n, x, incx, y, incy, result, HIP_C_64F, false);
+    return hipblasConvertStatus(rocblas_zdotu((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_double_complex*)x,
+                                              incx,
+                                              (rocblas_double_complex*)y,
+                                              incy,
+                                              (rocblas_double_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// dot_64
+hipblasStatus_t hipblasHdot_64(hipblasHandle_t    handle,
+                               int64_t            n,
+                               const hipblasHalf* x,
+                               int64_t            incx,
+                               const hipblasHalf* y,
+                               int64_t            incy,
+                               hipblasHalf*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_hdot_64((rocblas_handle)handle,
+                                                n,
+                                                (rocblas_half*)x,
+                                                incx,
+                                                (rocblas_half*)y,
+                                                incy,
+                                                (rocblas_half*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasBfdot_64(hipblasHandle_t        handle,
+                                int64_t                n,
+                                const hipblasBfloat16* x,
+                                int64_t                incx,
+                                const hipblasBfloat16* y,
+                                int64_t                incy,
+                                hipblasBfloat16*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_bfdot_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_bfloat16*)x,
+                                                 incx,
+                                                 (rocblas_bfloat16*)y,
+                                                 incy,
+                                                 (rocblas_bfloat16*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSdot_64(hipblasHandle_t handle,
+                               int64_t         n,
+                               const float*    x,
+                               int64_t         incx,
+                               const float*    y,
+                               int64_t         incy,
+                               float*          result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_sdot_64((rocblas_handle)handle, n, x, incx, y, incy, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDdot_64(hipblasHandle_t handle,
+                               int64_t         n,
+                               const double*   x,
+                               int64_t         incx,
+                               const double*   y,
+                               int64_t         incy,
+                               double*         result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_ddot_64((rocblas_handle)handle, n, x, incx, y, incy, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotc_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* y,
+                                int64_t               incy,
+                                hipblasComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_cdotc_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_float_complex*)x,
+                                                 incx,
+                                                 (rocblas_float_complex*)y,
+                                                 incy,
+                                                 (rocblas_float_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotu_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* y,
+                                int64_t               incy,
+                                hipblasComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_cdotu_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_float_complex*)x,
+                                                 incx,
+                                                 (rocblas_float_complex*)y,
+                                                 incy,
+                                                 (rocblas_float_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotc_64(hipblasHandle_t             handle,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* y,
+                                int64_t                     incy,
+                                hipblasDoubleComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_zdotc_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_double_complex*)x,
+                                                 incx,
+                                                 (rocblas_double_complex*)y,
+                                                 incy,
+                                                 (rocblas_double_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotu_64(hipblasHandle_t             handle,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* y,
+                                int64_t                     incy,
+                                hipblasDoubleComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_zdotu_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_double_complex*)x,
+                                                 incx,
+                                                 (rocblas_double_complex*)y,
+                                                 incy,
+                                                 (rocblas_double_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotc_v2_64(hipblasHandle_t   handle,
+                                   int64_t           n,
+                                   const hipComplex* x,
+                                   int64_t           incx,
+                                   const hipComplex* y,
+                                   int64_t           incy,
+                                   hipComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_cdotc_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_float_complex*)x,
+                                                 incx,
+                                                 (rocblas_float_complex*)y,
+                                                 incy,
+                                                 (rocblas_float_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotu_v2_64(hipblasHandle_t   handle,
+                                   int64_t           n,
+                                   const hipComplex* x,
+                                   int64_t           incx,
+                                   const hipComplex* y,
+                                   int64_t           incy,
+                                   hipComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_cdotu_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_float_complex*)x,
+                                                 incx,
+                                                 (rocblas_float_complex*)y,
+                                                 incy,
+                                                 (rocblas_float_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotc_v2_64(hipblasHandle_t         handle,
+                                   int64_t                 n,
+                                   const hipDoubleComplex* x,
+                                   int64_t                 incx,
+                                   const hipDoubleComplex* y,
+                                   int64_t                 incy,
+                                   hipDoubleComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_zdotc_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_double_complex*)x,
+                                                 incx,
+                                                 (rocblas_double_complex*)y,
+                                                 incy,
+                                                 (rocblas_double_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotu_v2_64(hipblasHandle_t         handle,
+                                   int64_t                 n,
+                                   const hipDoubleComplex* x,
+                                   int64_t                 incx,
+                                   const hipDoubleComplex* y,
+                                   int64_t                 incy,
+                                   hipDoubleComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_zdotu_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_double_complex*)x,
+                                                 incx,
+                                                 (rocblas_double_complex*)y,
+                                                 incy,
+                                                 (rocblas_double_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// dot_batched
+hipblasStatus_t hipblasHdotBatched(hipblasHandle_t          handle,
+                                   int                      n,
+                                   const hipblasHalf* const x[],
+                                   int                      incx,
+                                   const hipblasHalf* const y[],
+                                   int                      incy,
+                                   int                      batchCount,
+                                   hipblasHalf*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_hdot_batched((rocblas_handle)handle,
+                                                     n,
+                                                     (rocblas_half* const*)x,
+                                                     incx,
+                                                     (rocblas_half* const*)y,
+                                                     incy,
+                                                     batchCount,
+                                                     (rocblas_half*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasBfdotBatched(hipblasHandle_t              handle,
+                                    int                          n,
+                                    const hipblasBfloat16* const x[],
+                                    int                          incx,
+                                    const hipblasBfloat16* const y[],
+                                    int                          incy,
+                                    int                          batchCount,
+                                    hipblasBfloat16*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_bfdot_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_bfloat16* const*)x,
+                                                      incx,
+                                                      (rocblas_bfloat16* const*)y,
+                                                      incy,
+                                                      batchCount,
+                                                      (rocblas_bfloat16*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSdotBatched(hipblasHandle_t    handle,
+                                   int                n,
+                                   const float* const x[],
+                                   int                incx,
+                                   const float* const y[],
+                                   int                incy,
+                                   int                batchCount,
+                                   float*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_sdot_batched((rocblas_handle)handle, n, x, incx, y, incy, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDdotBatched(hipblasHandle_t     handle,
+                                   int                 n,
+                                   const double* const x[],
+                                   int                 incx,
+                                   const double* const y[],
+                                   int                 incy,
+                                   int                 batchCount,
+                                   double*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_ddot_batched((rocblas_handle)handle, n, x, incx, y, incy, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotcBatched(hipblasHandle_t             handle,
+                                    int                         n,
+                                    const hipblasComplex* const x[],
+                                    int                         incx,
+                                    const hipblasComplex* const y[],
+                                    int                         incy,
+                                    int                         batchCount,
+                                    hipblasComplex*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_cdotc_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_float_complex**)x,
+                                                      incx,
+                                                      (rocblas_float_complex**)y,
+                                                      incy,
+                                                      batchCount,
+                                                      (rocblas_float_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotuBatched(hipblasHandle_t             handle,
+                                    int                         n,
+                                    const hipblasComplex* const x[],
+                                    int                         incx,
+                                    const hipblasComplex* const y[],
+                                    int                         incy,
+                                    int                         batchCount,
+                                    hipblasComplex*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_cdotu_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_float_complex**)x,
+                                                      incx,
+                                                      (rocblas_float_complex**)y,
+                                                      incy,
+                                                      batchCount,
+                                                      (rocblas_float_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotcBatched(hipblasHandle_t                   handle,
+                                    int                               n,
+                                    const hipblasDoubleComplex* const x[],
+                                    int                               incx,
+                                    const hipblasDoubleComplex* const y[],
+                                    int                               incy,
+                                    int                               batchCount,
+                                    hipblasDoubleComplex*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_zdotc_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_double_complex**)x,
+                                                      incx,
+                                                      (rocblas_double_complex**)y,
+                                                      incy,
+                                                      batchCount,
+                                                      (rocblas_double_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotuBatched(hipblasHandle_t                   handle,
+                                    int                               n,
+                                    const hipblasDoubleComplex* const x[],
+                                    int                               incx,
+                                    const hipblasDoubleComplex* const y[],
+                                    int                               incy,
+                                    int                               batchCount,
+                                    hipblasDoubleComplex*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_zdotu_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_double_complex**)x,
+                                                      incx,
+                                                      (rocblas_double_complex**)y,
+                                                      incy,
+                                                      batchCount,
+                                                      (rocblas_double_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotcBatched_v2(hipblasHandle_t         handle,
+                                       int                     n,
+                                       const hipComplex* const x[],
+                                       int                     incx,
+                                       const hipComplex* const y[],
+                                       int                     incy,
+                                       int                     batchCount,
+                                       hipComplex*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_cdotc_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_float_complex**)x,
+                                                      incx,
+                                                      (rocblas_float_complex**)y,
+                                                      incy,
+                                                      batchCount,
+                                                      (rocblas_float_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotuBatched_v2(hipblasHandle_t         handle,
+                                       int                     n,
+                                       const hipComplex* const x[],
+                                       int                     incx,
+                                       const hipComplex* const y[],
+                                       int                     incy,
+                                       int                     batchCount,
+                                       hipComplex*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_cdotu_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_float_complex**)x,
+                                                      incx,
+                                                      (rocblas_float_complex**)y,
+                                                      incy,
+                                                      batchCount,
+                                                      (rocblas_float_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotcBatched_v2(hipblasHandle_t               handle,
+                                       int                           n,
+                                       const hipDoubleComplex* const x[],
+                                       int                           incx,
+                                       const hipDoubleComplex* const y[],
+                                       int                           incy,
+                                       int                           batchCount,
+                                       hipDoubleComplex*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_zdotc_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_double_complex**)x,
+                                                      incx,
+                                                      (rocblas_double_complex**)y,
+                                                      incy,
+                                                      batchCount,
+                                                      (rocblas_double_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotuBatched_v2(hipblasHandle_t               handle,
+                                       int                           n,
+                                       const hipDoubleComplex* const x[],
+                                       int                           incx,
+                                       const hipDoubleComplex* const y[],
+                                       int                           incy,
+                                       int                           batchCount,
+                                       hipDoubleComplex*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_zdotu_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_double_complex**)x,
+                                                      incx,
+                                                      (rocblas_double_complex**)y,
+                                                      incy,
+                                                      batchCount,
+                                                      (rocblas_double_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// dot_batched_64
+hipblasStatus_t hipblasHdotBatched_64(hipblasHandle_t          handle,
+                                      int64_t                  n,
+                                      const hipblasHalf* const x[],
+                                      int64_t                  incx,
+                                      const hipblasHalf* const y[],
+                                      int64_t                  incy,
+                                      int64_t                  batchCount,
+                                      hipblasHalf*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_hdot_batched_64((rocblas_handle)handle,
+                                                        n,
+                                                        (rocblas_half* const*)x,
+                                                        incx,
+                                                        (rocblas_half* const*)y,
+                                                        incy,
+                                                        batchCount,
+                                                        (rocblas_half*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasBfdotBatched_64(hipblasHandle_t              handle,
+                                       int64_t                      n,
+                                       const hipblasBfloat16* const x[],
+                                       int64_t                      incx,
+                                       const hipblasBfloat16* const y[],
+                                       int64_t                      incy,
+                                       int64_t                      batchCount,
+                                       hipblasBfloat16*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_bfdot_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_bfloat16* const*)x,
+                                                         incx,
+                                                         (rocblas_bfloat16* const*)y,
+                                                         incy,
+                                                         batchCount,
+                                                         (rocblas_bfloat16*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSdotBatched_64(hipblasHandle_t    handle,
+                                      int64_t            n,
+                                      const float* const x[],
+                                      int64_t            incx,
+                                      const float* const y[],
+                                      int64_t            incy,
+                                      int64_t            batchCount,
+                                      float*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_sdot_batched_64((rocblas_handle)handle, n, x, incx, y, incy, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDdotBatched_64(hipblasHandle_t     handle,
+                                      int64_t             n,
+                                      const double* const x[],
+                                      int64_t             incx,
+                                      const double* const y[],
+                                      int64_t             incy,
+                                      int64_t             batchCount,
+                                      double*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_ddot_batched_64((rocblas_handle)handle, n, x, incx, y, incy, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotcBatched_64(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       const hipblasComplex* const x[],
+                                       int64_t                     incx,
+                                       const hipblasComplex* const y[],
+                                       int64_t                     incy,
+                                       int64_t                     batchCount,
+                                       hipblasComplex*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_cdotc_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_float_complex**)x,
+                                                         incx,
+                                                         (rocblas_float_complex**)y,
+                                                         incy,
+                                                         batchCount,
+                                                         (rocblas_float_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotuBatched_64(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       const hipblasComplex* const x[],
+                                       int64_t                     incx,
+                                       const hipblasComplex* const y[],
+                                       int64_t                     incy,
+                                       int64_t                     batchCount,
+                                       hipblasComplex*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_cdotu_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_float_complex**)x,
+                                                         incx,
+                                                         (rocblas_float_complex**)y,
+                                                         incy,
+                                                         batchCount,
+                                                         (rocblas_float_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotcBatched_64(hipblasHandle_t                   handle,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex* const x[],
+                                       int64_t                           incx,
+                                       const hipblasDoubleComplex* const y[],
+                                       int64_t                           incy,
+                                       int64_t                           batchCount,
+                                       hipblasDoubleComplex*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_zdotc_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_double_complex**)x,
+                                                         incx,
+                                                         (rocblas_double_complex**)y,
+                                                         incy,
+                                                         batchCount,
+                                                         (rocblas_double_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotuBatched_64(hipblasHandle_t                   handle,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex* const x[],
+                                       int64_t                           incx,
+                                       const hipblasDoubleComplex* const y[],
+                                       int64_t                           incy,
+                                       int64_t                           batchCount,
+                                       hipblasDoubleComplex*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_zdotu_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_double_complex**)x,
+                                                         incx,
+                                                         (rocblas_double_complex**)y,
+                                                         incy,
+                                                         batchCount,
+                                                         (rocblas_double_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotcBatched_v2_64(hipblasHandle_t         handle,
+                                          int64_t                 n,
+                                          const hipComplex* const x[],
+                                          int64_t                 incx,
+                                          const hipComplex* const y[],
+                                          int64_t                 incy,
+                                          int64_t                 batchCount,
+                                          hipComplex*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_cdotc_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_float_complex**)x,
+                                                         incx,
+                                                         (rocblas_float_complex**)y,
+                                                         incy,
+                                                         batchCount,
+                                                         (rocblas_float_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotuBatched_v2_64(hipblasHandle_t         handle,
+                                          int64_t                 n,
+                                          const hipComplex* const x[],
+                                          int64_t                 incx,
+                                          const hipComplex* const y[],
+                                          int64_t                 incy,
+                                          int64_t                 batchCount,
+                                          hipComplex*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_cdotu_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_float_complex**)x,
+                                                         incx,
+                                                         (rocblas_float_complex**)y,
+                                                         incy,
+                                                         batchCount,
+                                                         (rocblas_float_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotcBatched_v2_64(hipblasHandle_t               handle,
+                                          int64_t                       n,
+                                          const hipDoubleComplex* const x[],
+                                          int64_t                       incx,
+                                          const hipDoubleComplex* const y[],
+                                          int64_t                       incy,
+                                          int64_t                       batchCount,
+                                          hipDoubleComplex*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_zdotc_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_double_complex**)x,
+                                                         incx,
+                                                         (rocblas_double_complex**)y,
+                                                         incy,
+                                                         batchCount,
+                                                         (rocblas_double_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotuBatched_v2_64(hipblasHandle_t               handle,
+                                          int64_t                       n,
+                                          const hipDoubleComplex* const x[],
+                                          int64_t                       incx,
+                                          const hipDoubleComplex* const y[],
+                                          int64_t                       incy,
+                                          int64_t                       batchCount,
+                                          hipDoubleComplex*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_zdotu_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_double_complex**)x,
+                                                         incx,
+                                                         (rocblas_double_complex**)y,
+                                                         incy,
+                                                         batchCount,
+                                                         (rocblas_double_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// dot_strided_batched
+hipblasStatus_t hipblasHdotStridedBatched(hipblasHandle_t    handle,
+                                          int                n,
+                                          const hipblasHalf* x,
+                                          int                incx,
+                                          hipblasStride      stridex,
+                                          const hipblasHalf* y,
+                                          int                incy,
+                                          hipblasStride      stridey,
+                                          int                batchCount,
+                                          hipblasHalf*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_hdot_strided_batched((rocblas_handle)handle,
+                                                             n,
+                                                             (rocblas_half*)x,
+                                                             incx,
+                                                             stridex,
+                                                             (rocblas_half*)y,
+                                                             incy,
+                                                             stridey,
+                                                             batchCount,
+                                                             (rocblas_half*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasBfdotStridedBatched(hipblasHandle_t        handle,
+                                           int                    n,
+                                           const hipblasBfloat16* x,
+                                           int                    incx,
+                                           hipblasStride          stridex,
+                                           const hipblasBfloat16* y,
+                                           int                    incy,
+                                           hipblasStride          stridey,
+                                           int                    batchCount,
+                                           hipblasBfloat16*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_bfdot_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_bfloat16*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_bfloat16*)y,
+                                                              incy,
+                                                              stridey,
+                                                              batchCount,
+                                                              (rocblas_bfloat16*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSdotStridedBatched(hipblasHandle_t handle,
+                                          int             n,
+                                          const float*    x,
+                                          int             incx,
+                                          hipblasStride   stridex,
+                                          const float*    y,
+                                          int             incy,
+                                          hipblasStride   stridey,
+                                          int             batchCount,
+                                          float*          result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_sdot_strided_batched(
+        (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDdotStridedBatched(hipblasHandle_t handle,
+                                          int             n,
+                                          const double*   x,
+                                          int             incx,
+                                          hipblasStride   stridex,
+                                          const double*   y,
+                                          int             incy,
+                                          hipblasStride   stridey,
+                                          int             batchCount,
+                                          double*         result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_ddot_strided_batched(
+        (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotcStridedBatched(hipblasHandle_t       handle,
+                                           int                   n,
+                                           const hipblasComplex* x,
+                                           int                   incx,
+                                           hipblasStride         stridex,
+                                           const hipblasComplex* y,
+                                           int                   incy,
+                                           hipblasStride         stridey,
+                                           int                   batchCount,
+                                           hipblasComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_cdotc_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_float_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_float_complex*)y,
+                                                              incy,
+                                                              stridey,
+                                                              batchCount,
+                                                              (rocblas_float_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotuStridedBatched(hipblasHandle_t       handle,
+                                           int                   n,
+                                           const hipblasComplex* x,
+                                           int                   incx,
+                                           hipblasStride         stridex,
+                                           const hipblasComplex* y,
+                                           int                   incy,
+                                           hipblasStride         stridey,
+                                           int                   batchCount,
+                                           hipblasComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_cdotu_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_float_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_float_complex*)y,
+                                                              incy,
+                                                              stridey,
+                                                              batchCount,
+                                                              (rocblas_float_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotcStridedBatched(hipblasHandle_t             handle,
+                                           int                         n,
+                                           const hipblasDoubleComplex* x,
+                                           int                         incx,
+                                           hipblasStride               stridex,
+                                           const hipblasDoubleComplex* y,
+                                           int                         incy,
+                                           hipblasStride               stridey,
+                                           int                         batchCount,
+                                           hipblasDoubleComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_zdotc_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_double_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_double_complex*)y,
+                                                              incy,
+                                                              stridey,
+                                                              batchCount,
+                                                              (rocblas_double_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotuStridedBatched(hipblasHandle_t             handle,
+                                           int                         n,
+                                           const hipblasDoubleComplex* x,
+                                           int                         incx,
+                                           hipblasStride               stridex,
+                                           const hipblasDoubleComplex* y,
+                                           int                         incy,
+                                           hipblasStride               stridey,
+                                           int                         batchCount,
+                                           hipblasDoubleComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_zdotu_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_double_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_double_complex*)y,
+                                                              incy,
+                                                              stridey,
+                                                              batchCount,
+                                                              (rocblas_double_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotcStridedBatched_v2(hipblasHandle_t   handle,
+                                              int               n,
+                                              const hipComplex* x,
+                                              int               incx,
+                                              hipblasStride     stridex,
+                                              const hipComplex* y,
+                                              int               incy,
+                                              hipblasStride     stridey,
+                                              int               batchCount,
+                                              hipComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_cdotc_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_float_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_float_complex*)y,
+                                                              incy,
+                                                              stridey,
+                                                              batchCount,
+                                                              (rocblas_float_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotuStridedBatched_v2(hipblasHandle_t   handle,
+                                              int               n,
+                                              const hipComplex* x,
+                                              int               incx,
+                                              hipblasStride     stridex,
+                                              const hipComplex* y,
+                                              int               incy,
+                                              hipblasStride     stridey,
+                                              int               batchCount,
+                                              hipComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_cdotu_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_float_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_float_complex*)y,
+                                                              incy,
+                                                              stridey,
+                                                              batchCount,
+                                                              (rocblas_float_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotcStridedBatched_v2(hipblasHandle_t         handle,
+                                              int                     n,
+                                              const hipDoubleComplex* x,
+                                              int                     incx,
+                                              hipblasStride           stridex,
+                                              const hipDoubleComplex* y,
+                                              int                     incy,
+                                              hipblasStride           stridey,
+                                              int                     batchCount,
+                                              hipDoubleComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_zdotc_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_double_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_double_complex*)y,
+                                                              incy,
+                                                              stridey,
+                                                              batchCount,
+                                                              (rocblas_double_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotuStridedBatched_v2(hipblasHandle_t         handle,
+                                              int                     n,
+                                              const hipDoubleComplex* x,
+                                              int                     incx,
+                                              hipblasStride           stridex,
+                                              const hipDoubleComplex* y,
+                                              int                     incy,
+                                              hipblasStride           stridey,
+                                              int                     batchCount,
+                                              hipDoubleComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_zdotu_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_double_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_double_complex*)y,
+                                                              incy,
+                                                              stridey,
+                                                              batchCount,
+                                                              (rocblas_double_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// dot_strided_batched_64
+hipblasStatus_t hipblasHdotStridedBatched_64(hipblasHandle_t    handle,
+                                             int64_t            n,
+                                             const hipblasHalf* x,
+                                             int64_t            incx,
+                                             hipblasStride      stridex,
+                                             const hipblasHalf* y,
+                                             int64_t            incy,
+                                             hipblasStride      stridey,
+                                             int64_t            batchCount,
+                                             hipblasHalf*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_hdot_strided_batched_64((rocblas_handle)handle,
+                                                                n,
+                                                                (rocblas_half*)x,
+                                                                incx,
+                                                                stridex,
+                                                                (rocblas_half*)y,
+                                                                incy,
+                                                                stridey,
+                                                                batchCount,
+                                                                (rocblas_half*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasBfdotStridedBatched_64(hipblasHandle_t        handle,
+                                              int64_t                n,
+                                              const hipblasBfloat16* x,
+                                              int64_t                incx,
+                                              hipblasStride          stridex,
+                                              const hipblasBfloat16* y,
+                                              int64_t                incy,
+                                              hipblasStride          stridey,
+                                              int64_t                batchCount,
+                                              hipblasBfloat16*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_bfdot_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_bfloat16*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_bfloat16*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 batchCount,
+                                                                 (rocblas_bfloat16*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSdotStridedBatched_64(hipblasHandle_t handle,
+                                             int64_t         n,
+                                             const float*    x,
+                                             int64_t         incx,
+                                             hipblasStride   stridex,
+                                             const float*    y,
+                                             int64_t         incy,
+                                             hipblasStride   stridey,
+                                             int64_t         batchCount,
+                                             float*          result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_sdot_strided_batched_64(
+        (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDdotStridedBatched_64(hipblasHandle_t handle,
+                                             int64_t         n,
+                                             const double*   x,
+                                             int64_t         incx,
+                                             hipblasStride   stridex,
+                                             const double*   y,
+                                             int64_t         incy,
+                                             hipblasStride   stridey,
+                                             int64_t         batchCount,
+                                             double*         result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_ddot_strided_batched_64(
+        (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotcStridedBatched_64(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              const hipblasComplex* y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              int64_t               batchCount,
+                                              hipblasComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_cdotc_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_float_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_float_complex*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 batchCount,
+                                                                 (rocblas_float_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotuStridedBatched_64(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              const hipblasComplex* y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              int64_t               batchCount,
+                                              hipblasComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_cdotu_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_float_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_float_complex*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 batchCount,
+                                                                 (rocblas_float_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotcStridedBatched_64(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              const hipblasDoubleComplex* y,
+                                              int64_t                     incy,
+                                              hipblasStride               stridey,
+                                              int64_t                     batchCount,
+                                              hipblasDoubleComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_zdotc_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_double_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_double_complex*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 batchCount,
+                                                                 (rocblas_double_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotuStridedBatched_64(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              const hipblasDoubleComplex* y,
+                                              int64_t                     incy,
+                                              hipblasStride               stridey,
+                                              int64_t                     batchCount,
+                                              hipblasDoubleComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_zdotu_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_double_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_double_complex*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 batchCount,
+                                                                 (rocblas_double_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotcStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                 int64_t           n,
+                                                 const hipComplex* x,
+                                                 int64_t           incx,
+                                                 hipblasStride     stridex,
+                                                 const hipComplex* y,
+                                                 int64_t           incy,
+                                                 hipblasStride     stridey,
+                                                 int64_t           batchCount,
+                                                 hipComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_cdotc_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_float_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_float_complex*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 batchCount,
+                                                                 (rocblas_float_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotuStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                 int64_t           n,
+                                                 const hipComplex* x,
+                                                 int64_t           incx,
+                                                 hipblasStride     stridex,
+                                                 const hipComplex* y,
+                                                 int64_t           incy,
+                                                 hipblasStride     stridey,
+                                                 int64_t           batchCount,
+                                                 hipComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_cdotu_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_float_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_float_complex*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 batchCount,
+                                                                 (rocblas_float_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotcStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                 int64_t                 n,
+                                                 const hipDoubleComplex* x,
+                                                 int64_t                 incx,
+                                                 hipblasStride           stridex,
+                                                 const hipDoubleComplex* y,
+                                                 int64_t                 incy,
+                                                 hipblasStride           stridey,
+                                                 int64_t                 batchCount,
+                                                 hipDoubleComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_zdotc_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_double_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_double_complex*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 batchCount,
+                                                                 (rocblas_double_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotuStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                 int64_t                 n,
+                                                 const hipDoubleComplex* x,
+                                                 int64_t                 incx,
+                                                 hipblasStride           stridex,
+                                                 const hipDoubleComplex* y,
+                                                 int64_t                 incy,
+                                                 hipblasStride           stridey,
+                                                 int64_t                 batchCount,
+                                                 hipDoubleComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_zdotu_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_double_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_double_complex*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 batchCount,
+                                                                 (rocblas_double_complex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// nrm2
+hipblasStatus_t hipblasSnrm2(hipblasHandle_t handle, int n, const float* x, int incx, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleNrm2(handle, n, x, incx, result, HIP_R_32F);
+    return hipblasConvertStatus(rocblas_snrm2((rocblas_handle)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasDnrm2(hipblasHandle_t handle, int n, const double* x, int incx, double* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleNrm2(handle, n, x, incx, result, HIP_R_64F);
+    return hipblasConvertStatus(rocblas_dnrm2((rocblas_handle)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasScnrm2(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleNrm2(handle, n, x, incx, result, HIP_C_32F);
+    return hipblasConvertStatus(
+        rocblas_scnrm2((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDznrm2(
+    hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleNrm2(handle, n, x, incx, result, HIP_C_64F);
+    return hipblasConvertStatus(
+        rocblas_dznrm2((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasScnrm2_v2(hipblasHandle_t handle, int n, const hipComplex* x, int incx, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleNrm2(handle, n, x, incx, result, HIP_C_32F);
+    return hipblasConvertStatus(
+        rocblas_scnrm2((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDznrm2_v2(
+    hipblasHandle_t handle, int n, const hipDoubleComplex* x, int incx, double* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleNrm2(handle, n, x, incx, result, HIP_C_64F);
+    return hipblasConvertStatus(
+        rocblas_dznrm2((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// nrm2_64
+hipblasStatus_t
+    hipblasSnrm2_64(hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    return hipblasConvertStatus(rocblas_snrm2_64((rocblas_handle)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDnrm2_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dnrm2_64((rocblas_handle)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScnrm2_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_scnrm2_64((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDznrm2_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_dznrm2_64((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScnrm2_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipComplex* x, int64_t incx, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_scnrm2_64((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDznrm2_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipDoubleComplex* x, int64_t incx, double* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_dznrm2_64((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// nrm2_batched
+hipblasStatus_t hipblasSnrm2Batched(
+    hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_snrm2_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDnrm2Batched(hipblasHandle_t     handle,
+                                    int                 n,
+                                    const double* const x[],
+                                    int                 incx,
+                                    int                 batchCount,
+                                    double*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_dnrm2_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScnrm2Batched(hipblasHandle_t             handle,
+                                     int                         n,
+                                     const hipblasComplex* const x[],
+                                     int                         incx,
+                                     int                         batchCount,
+                                     float*                      result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_scnrm2_batched(
+        (rocblas_handle)handle, n, (rocblas_float_complex* const*)x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDznrm2Batched(hipblasHandle_t                   handle,
+                                     int                               n,
+                                     const hipblasDoubleComplex* const x[],
+                                     int                               incx,
+                                     int                               batchCount,
+                                     double*                           result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dznrm2_batched(
+        (rocblas_handle)handle, n, (rocblas_double_complex* const*)x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScnrm2Batched_v2(hipblasHandle_t         handle,
+                                        int                     n,
+                                        const hipComplex* const x[],
+                                        int                     incx,
+                                        int                     batchCount,
+                                        float*                  result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_scnrm2_batched(
+        (rocblas_handle)handle, n, (rocblas_float_complex* const*)x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDznrm2Batched_v2(hipblasHandle_t               handle,
+                                        int                           n,
+                                        const hipDoubleComplex* const x[],
+                                        int                           incx,
+                                        int                           batchCount,
+                                        double*                       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dznrm2_batched(
+        (rocblas_handle)handle, n, (rocblas_double_complex* const*)x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// nrm2_batched_64
+hipblasStatus_t hipblasSnrm2Batched_64(hipblasHandle_t    handle,
+                                       int64_t            n,
+                                       const float* const x[],
+                                       int64_t            incx,
+                                       int64_t            batchCount,
+                                       float*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_snrm2_batched_64((rocblas_handle)handle, n, x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDnrm2Batched_64(hipblasHandle_t     handle,
+                                       int64_t             n,
+                                       const double* const x[],
+                                       int64_t             incx,
+                                       int64_t             batchCount,
+                                       double*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_dnrm2_batched_64((rocblas_handle)handle, n, x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScnrm2Batched_64(hipblasHandle_t             handle,
+                                        int64_t                     n,
+                                        const hipblasComplex* const x[],
+                                        int64_t                     incx,
+                                        int64_t                     batchCount,
+                                        float*                      result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_scnrm2_batched_64(
+        (rocblas_handle)handle, n, (rocblas_float_complex* const*)x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDznrm2Batched_64(hipblasHandle_t                   handle,
+                                        int64_t                           n,
+                                        const hipblasDoubleComplex* const x[],
+                                        int64_t                           incx,
+                                        int64_t                           batchCount,
+                                        double*                           result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dznrm2_batched_64(
+        (rocblas_handle)handle, n, (rocblas_double_complex* const*)x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScnrm2Batched_v2_64(hipblasHandle_t         handle,
+                                           int64_t                 n,
+                                           const hipComplex* const x[],
+                                           int64_t                 incx,
+                                           int64_t                 batchCount,
+                                           float*                  result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_scnrm2_batched_64(
+        (rocblas_handle)handle, n, (rocblas_float_complex* const*)x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDznrm2Batched_v2_64(hipblasHandle_t               handle,
+                                           int64_t                       n,
+                                           const hipDoubleComplex* const x[],
+                                           int64_t                       incx,
+                                           int64_t                       batchCount,
+                                           double*                       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dznrm2_batched_64(
+        (rocblas_handle)handle, n, (rocblas_double_complex* const*)x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// nrm2_strided_batched
+hipblasStatus_t hipblasSnrm2StridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           const float*    x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           int             batchCount,
+                                           float*          result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_snrm2_strided_batched(
+        (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDnrm2StridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           const double*   x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           int             batchCount,
+                                           double*         result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dnrm2_strided_batched(
+        (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScnrm2StridedBatched(hipblasHandle_t       handle,
+                                            int                   n,
+                                            const hipblasComplex* x,
+                                            int                   incx,
+                                            hipblasStride         stridex,
+                                            int                   batchCount,
+                                            float*                result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_scnrm2_strided_batched(
+        (rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDznrm2StridedBatched(hipblasHandle_t             handle,
+                                            int                         n,
+                                            const hipblasDoubleComplex* x,
+                                            int                         incx,
+                                            hipblasStride               stridex,
+                                            int                         batchCount,
+                                            double*                     result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dznrm2_strided_batched(
+        (rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScnrm2StridedBatched_v2(hipblasHandle_t   handle,
+                                               int               n,
+                                               const hipComplex* x,
+                                               int               incx,
+                                               hipblasStride     stridex,
+                                               int               batchCount,
+                                               float*            result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_scnrm2_strided_batched(
+        (rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDznrm2StridedBatched_v2(hipblasHandle_t         handle,
+                                               int                     n,
+                                               const hipDoubleComplex* x,
+                                               int                     incx,
+                                               hipblasStride           stridex,
+                                               int                     batchCount,
+                                               double*                 result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dznrm2_strided_batched(
+        (rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// nrm2_strided_batched_64
+hipblasStatus_t hipblasSnrm2StridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const float*    x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              int64_t         batchCount,
+                                              float*          result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_snrm2_strided_batched_64(
+        (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDnrm2StridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const double*   x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              int64_t         batchCount,
+                                              double*         result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dnrm2_strided_batched_64(
+        (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScnrm2StridedBatched_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasStride         stridex,
+                                               int64_t               batchCount,
+                                               float*                result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_scnrm2_strided_batched_64(
+        (rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDznrm2StridedBatched_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               hipblasStride               stridex,
+                                               int64_t                     batchCount,
+                                               double*                     result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dznrm2_strided_batched_64(
+        (rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScnrm2StridedBatched_v2_64(hipblasHandle_t   handle,
+                                                  int64_t           n,
+                                                  const hipComplex* x,
+                                                  int64_t           incx,
+                                                  hipblasStride     stridex,
+                                                  int64_t           batchCount,
+                                                  float*            result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_scnrm2_strided_batched_64(
+        (rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDznrm2StridedBatched_v2_64(hipblasHandle_t         handle,
+                                                  int64_t                 n,
+                                                  const hipDoubleComplex* x,
+                                                  int64_t                 incx,
+                                                  hipblasStride           stridex,
+                                                  int64_t                 batchCount,
+                                                  double*                 result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dznrm2_strided_batched_64(
+        (rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, stridex, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rot
+hipblasStatus_t hipblasSrot(hipblasHandle_t handle,
+                            int             n,
+                            float*          x,
+                            int             incx,
+                            float*          y,
+                            int             incy,
+                            const float*    c,
+                            const float*    s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_srot((rocblas_handle)handle, n, x, incx, y, incy, c, s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrot(hipblasHandle_t handle,
+                            int             n,
+                            double*         x,
+                            int             incx,
+                            double*         y,
+                            int             incy,
+                            const double*   c,
+                            const double*   s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_drot((rocblas_handle)handle, n, x, incx, y, incy, c, s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrot(hipblasHandle_t       handle,
+                            int                   n,
+                            hipblasComplex*       x,
+                            int                   incx,
+                            hipblasComplex*       y,
+                            int                   incy,
+                            const float*          c,
+                            const hipblasComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_crot((rocblas_handle)handle,
+                                             n,
+                                             (rocblas_float_complex*)x,
+                                             incx,
+                                             (rocblas_float_complex*)y,
+                                             incy,
+                                             c,
+                                             (rocblas_float_complex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsrot(hipblasHandle_t handle,
+                             int             n,
+                             hipblasComplex* x,
+                             int             incx,
+                             hipblasComplex* y,
+                             int             incy,
+                             const float*    c,
+                             const float*    s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_csrot((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_float_complex*)x,
+                                              incx,
+                                              (rocblas_float_complex*)y,
+                                              incy,
+                                              c,
+                                              s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrot(hipblasHandle_t             handle,
+                            int                         n,
+                            hipblasDoubleComplex*       x,
+                            int                         incx,
+                            hipblasDoubleComplex*       y,
+                            int                         incy,
+                            const double*               c,
+                            const hipblasDoubleComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_zrot((rocblas_handle)handle,
+                                             n,
+                                             (rocblas_double_complex*)x,
+                                             incx,
+                                             (rocblas_double_complex*)y,
+                                             incy,
+                                             c,
+                                             (rocblas_double_complex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdrot(hipblasHandle_t       handle,
+                             int                   n,
+                             hipblasDoubleComplex* x,
+                             int                   incx,
+                             hipblasDoubleComplex* y,
+                             int                   incy,
+                             const double*         c,
+                             const double*         s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_zdrot((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_double_complex*)x,
+                                              incx,
+                                              (rocblas_double_complex*)y,
+                                              incy,
+                                              c,
+                                              s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrot_v2(hipblasHandle_t   handle,
+                               int               n,
+                               hipComplex*       x,
+                               int               incx,
+                               hipComplex*       y,
+                               int               incy,
+                               const float*      c,
+                               const hipComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_crot((rocblas_handle)handle,
+                                             n,
+                                             (rocblas_float_complex*)x,
+                                             incx,
+                                             (rocblas_float_complex*)y,
+                                             incy,
+                                             c,
+                                             (rocblas_float_complex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsrot_v2(hipblasHandle_t handle,
+                                int             n,
+                                hipComplex*     x,
+                                int             incx,
+                                hipComplex*     y,
+                                int             incy,
+                                const float*    c,
+                                const float*    s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_csrot((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_float_complex*)x,
+                                              incx,
+                                              (rocblas_float_complex*)y,
+                                              incy,
+                                              c,
+                                              s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrot_v2(hipblasHandle_t         handle,
+                               int                     n,
+                               hipDoubleComplex*       x,
+                               int                     incx,
+                               hipDoubleComplex*       y,
+                               int                     incy,
+                               const double*           c,
+                               const hipDoubleComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_zrot((rocblas_handle)handle,
+                                             n,
+                                             (rocblas_double_complex*)x,
+                                             incx,
+                                             (rocblas_double_complex*)y,
+                                             incy,
+                                             c,
+                                             (rocblas_double_complex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdrot_v2(hipblasHandle_t   handle,
+                                int               n,
+                                hipDoubleComplex* x,
+                                int               incx,
+                                hipDoubleComplex* y,
+                                int               incy,
+                                const double*     c,
+                                const double*     s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_zdrot((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_double_complex*)x,
+                                              incx,
+                                              (rocblas_double_complex*)y,
+                                              incy,
+                                              c,
+                                              s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rot_64
+hipblasStatus_t hipblasSrot_64(hipblasHandle_t handle,
+                               int64_t         n,
+                               float*          x,
+                               int64_t         incx,
+                               float*          y,
+                               int64_t         incy,
+                               const float*    c,
+                               const float*    s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_srot_64((rocblas_handle)handle, n, x, incx, y, incy, c, s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrot_64(hipblasHandle_t handle,
+                               int64_t         n,
+                               double*         x,
+                               int64_t         incx,
+                               double*         y,
+                               int64_t         incy,
+                               const double*   c,
+                               const double*   s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_drot_64((rocblas_handle)handle, n, x, incx, y, incy, c, s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrot_64(hipblasHandle_t       handle,
+                               int64_t               n,
+                               hipblasComplex*       x,
+                               int64_t               incx,
+                               hipblasComplex*       y,
+                               int64_t               incy,
+                               const float*          c,
+                               const hipblasComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_crot_64((rocblas_handle)handle,
+                                                n,
+                                                (rocblas_float_complex*)x,
+                                                incx,
+                                                (rocblas_float_complex*)y,
+                                                incy,
+                                                c,
+                                                (rocblas_float_complex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsrot_64(hipblasHandle_t handle,
+                                int64_t         n,
+                                hipblasComplex* x,
+                                int64_t         incx,
+                                hipblasComplex* y,
+                                int64_t         incy,
+                                const float*    c,
+                                const float*    s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_csrot_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_float_complex*)x,
+                                                 incx,
+                                                 (rocblas_float_complex*)y,
+                                                 incy,
+                                                 c,
+                                                 s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrot_64(hipblasHandle_t             handle,
+                               int64_t                     n,
+                               hipblasDoubleComplex*       x,
+                               int64_t                     incx,
+                               hipblasDoubleComplex*       y,
+                               int64_t                     incy,
+                               const double*               c,
+                               const hipblasDoubleComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_zrot_64((rocblas_handle)handle,
+                                                n,
+                                                (rocblas_double_complex*)x,
+                                                incx,
+                                                (rocblas_double_complex*)y,
+                                                incy,
+                                                c,
+                                                (rocblas_double_complex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdrot_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                hipblasDoubleComplex* x,
+                                int64_t               incx,
+                                hipblasDoubleComplex* y,
+                                int64_t               incy,
+                                const double*         c,
+                                const double*         s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_zdrot_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_double_complex*)x,
+                                                 incx,
+                                                 (rocblas_double_complex*)y,
+                                                 incy,
+                                                 c,
+                                                 s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrot_v2_64(hipblasHandle_t   handle,
+                                  int64_t           n,
+                                  hipComplex*       x,
+                                  int64_t           incx,
+                                  hipComplex*       y,
+                                  int64_t           incy,
+                                  const float*      c,
+                                  const hipComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_crot_64((rocblas_handle)handle,
+                                                n,
+                                                (rocblas_float_complex*)x,
+                                                incx,
+                                                (rocblas_float_complex*)y,
+                                                incy,
+                                                c,
+                                                (rocblas_float_complex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsrot_v2_64(hipblasHandle_t handle,
+                                   int64_t         n,
+                                   hipComplex*     x,
+                                   int64_t         incx,
+                                   hipComplex*     y,
+                                   int64_t         incy,
+                                   const float*    c,
+                                   const float*    s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_csrot_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_float_complex*)x,
+                                                 incx,
+                                                 (rocblas_float_complex*)y,
+                                                 incy,
+                                                 c,
+                                                 s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrot_v2_64(hipblasHandle_t         handle,
+                                  int64_t                 n,
+                                  hipDoubleComplex*       x,
+                                  int64_t                 incx,
+                                  hipDoubleComplex*       y,
+                                  int64_t                 incy,
+                                  const double*           c,
+                                  const hipDoubleComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_zrot_64((rocblas_handle)handle,
+                                                n,
+                                                (rocblas_double_complex*)x,
+                                                incx,
+                                                (rocblas_double_complex*)y,
+                                                incy,
+                                                c,
+                                                (rocblas_double_complex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdrot_v2_64(hipblasHandle_t   handle,
+                                   int64_t           n,
+                                   hipDoubleComplex* x,
+                                   int64_t           incx,
+                                   hipDoubleComplex* y,
+                                   int64_t           incy,
+                                   const double*     c,
+                                   const double*     s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_zdrot_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_double_complex*)x,
+                                                 incx,
+                                                 (rocblas_double_complex*)y,
+                                                 incy,
+                                                 c,
+                                                 s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rot_batched
+hipblasStatus_t hipblasSrotBatched(hipblasHandle_t handle,
+                                   int             n,
+                                   float* const    x[],
+                                   int             incx,
+                                   float* const    y[],
+                                   int             incy,
+                                   const float*    c,
+                                   const float*    s,
+                                   int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(
+        rocblas_srot_batched((rocblas_handle)handle, n, x, incx, y, incy, c, s, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotBatched(hipblasHandle_t handle,
+                                   int             n,
+                                   double* const   x[],
+                                   int             incx,
+                                   double* const   y[],
+                                   int             incy,
+                                   const double*   c,
+                                   const double*   s,
+                                   int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(
+        rocblas_drot_batched((rocblas_handle)handle, n, x, incx, y, incy, c, s, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotBatched(hipblasHandle_t       handle,
+                                   int                   n,
+                                   hipblasComplex* const x[],
+                                   int                   incx,
+                                   hipblasComplex* const y[],
+                                   int                   incy,
+                                   const float*          c,
+                                   const hipblasComplex* s,
+                                   int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_crot_batched((rocblas_handle)handle,
+                                                     n,
+                                                     (rocblas_float_complex**)x,
+                                                     incx,
+                                                     (rocblas_float_complex**)y,
+                                                     incy,
+                                                     c,
+                                                     (rocblas_float_complex*)s,
+                                                     batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsrotBatched(hipblasHandle_t       handle,
+                                    int                   n,
+                                    hipblasComplex* const x[],
+                                    int                   incx,
+                                    hipblasComplex* const y[],
+                                    int                   incy,
+                                    const float*          c,
+                                    const float*          s,
+                                    int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_csrot_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_float_complex**)x,
+                                                      incx,
+                                                      (rocblas_float_complex**)y,
+                                                      incy,
+                                                      c,
+                                                      s,
+                                                      batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotBatched(hipblasHandle_t             handle,
+                                   int                         n,
+                                   hipblasDoubleComplex* const x[],
+                                   int                         incx,
+                                   hipblasDoubleComplex* const y[],
+                                   int                         incy,
+                                   const double*               c,
+                                   const hipblasDoubleComplex* s,
+                                   int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_zrot_batched((rocblas_handle)handle,
+                                                     n,
+                                                     (rocblas_double_complex**)x,
+                                                     incx,
+                                                     (rocblas_double_complex**)y,
+                                                     incy,
+                                                     c,
+                                                     (rocblas_double_complex*)s,
+                                                     batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdrotBatched(hipblasHandle_t             handle,
+                                    int                         n,
+                                    hipblasDoubleComplex* const x[],
+                                    int                         incx,
+                                    hipblasDoubleComplex* const y[],
+                                    int                         incy,
+                                    const double*               c,
+                                    const double*               s,
+                                    int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_zdrot_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_double_complex**)x,
+                                                      incx,
+                                                      (rocblas_double_complex**)y,
+                                                      incy,
+                                                      c,
+                                                      s,
+                                                      batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotBatched_v2(hipblasHandle_t   handle,
+                                      int               n,
+                                      hipComplex* const x[],
+                                      int               incx,
+                                      hipComplex* const y[],
+                                      int               incy,
+                                      const float*      c,
+                                      const hipComplex* s,
+                                      int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_crot_batched((rocblas_handle)handle,
+                                                     n,
+                                                     (rocblas_float_complex**)x,
+                                                     incx,
+                                                     (rocblas_float_complex**)y,
+                                                     incy,
+                                                     c,
+                                                     (rocblas_float_complex*)s,
+                                                     batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsrotBatched_v2(hipblasHandle_t   handle,
+                                       int               n,
+                                       hipComplex* const x[],
+                                       int               incx,
+                                       hipComplex* const y[],
+                                       int               incy,
+                                       const float*      c,
+                                       const float*      s,
+                                       int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_csrot_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_float_complex**)x,
+                                                      incx,
+                                                      (rocblas_float_complex**)y,
+                                                      incy,
+                                                      c,
+                                                      s,
+                                                      batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotBatched_v2(hipblasHandle_t         handle,
+                                      int                     n,
+                                      hipDoubleComplex* const x[],
+                                      int                     incx,
+                                      hipDoubleComplex* const y[],
+                                      int                     incy,
+                                      const double*           c,
+                                      const hipDoubleComplex* s,
+                                      int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_zrot_batched((rocblas_handle)handle,
+                                                     n,
+                                                     (rocblas_double_complex**)x,
+                                                     incx,
+                                                     (rocblas_double_complex**)y,
+                                                     incy,
+                                                     c,
+                                                     (rocblas_double_complex*)s,
+                                                     batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdrotBatched_v2(hipblasHandle_t         handle,
+                                       int                     n,
+                                       hipDoubleComplex* const x[],
+                                       int                     incx,
+                                       hipDoubleComplex* const y[],
+                                       int                     incy,
+                                       const double*           c,
+                                       const double*           s,
+                                       int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_zdrot_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_double_complex**)x,
+                                                      incx,
+                                                      (rocblas_double_complex**)y,
+                                                      incy,
+                                                      c,
+                                                      s,
+                                                      batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rot_batched_64
+hipblasStatus_t hipblasSrotBatched_64(hipblasHandle_t handle,
+                                      int64_t         n,
+                                      float* const    x[],
+                                      int64_t         incx,
+                                      float* const    y[],
+                                      int64_t         incy,
+                                      const float*    c,
+                                      const float*    s,
+                                      int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(
+        rocblas_srot_batched_64((rocblas_handle)handle, n, x, incx, y, incy, c, s, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotBatched_64(hipblasHandle_t handle,
+                                      int64_t         n,
+                                      double* const   x[],
+                                      int64_t         incx,
+                                      double* const   y[],
+                                      int64_t         incy,
+                                      const double*   c,
+                                      const double*   s,
+                                      int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(
+        rocblas_drot_batched_64((rocblas_handle)handle, n, x, incx, y, incy, c, s, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotBatched_64(hipblasHandle_t       handle,
+                                      int64_t               n,
+                                      hipblasComplex* const x[],
+                                      int64_t               incx,
+                                      hipblasComplex* const y[],
+                                      int64_t               incy,
+                                      const float*          c,
+                                      const hipblasComplex* s,
+                                      int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_crot_batched_64((rocblas_handle)handle,
+                                                        n,
+                                                        (rocblas_float_complex**)x,
+                                                        incx,
+                                                        (rocblas_float_complex**)y,
+                                                        incy,
+                                                        c,
+                                                        (rocblas_float_complex*)s,
+                                                        batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsrotBatched_64(hipblasHandle_t       handle,
+                                       int64_t               n,
+                                       hipblasComplex* const x[],
+                                       int64_t               incx,
+                                       hipblasComplex* const y[],
+                                       int64_t               incy,
+                                       const float*          c,
+                                       const float*          s,
+                                       int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_csrot_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_float_complex**)x,
+                                                         incx,
+                                                         (rocblas_float_complex**)y,
+                                                         incy,
+                                                         c,
+                                                         s,
+                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotBatched_64(hipblasHandle_t             handle,
+                                      int64_t                     n,
+                                      hipblasDoubleComplex* const x[],
+                                      int64_t                     incx,
+                                      hipblasDoubleComplex* const y[],
+                                      int64_t                     incy,
+                                      const double*               c,
+                                      const hipblasDoubleComplex* s,
+                                      int64_t                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_zrot_batched_64((rocblas_handle)handle,
+                                                        n,
+                                                        (rocblas_double_complex**)x,
+                                                        incx,
+                                                        (rocblas_double_complex**)y,
+                                                        incy,
+                                                        c,
+                                                        (rocblas_double_complex*)s,
+                                                        batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdrotBatched_64(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       hipblasDoubleComplex* const x[],
+                                       int64_t                     incx,
+                                       hipblasDoubleComplex* const y[],
+                                       int64_t                     incy,
+                                       const double*               c,
+                                       const double*               s,
+                                       int64_t                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_zdrot_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_double_complex**)x,
+                                                         incx,
+                                                         (rocblas_double_complex**)y,
+                                                         incy,
+                                                         c,
+                                                         s,
+                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotBatched_v2_64(hipblasHandle_t   handle,
+                                         int64_t           n,
+                                         hipComplex* const x[],
+                                         int64_t           incx,
+                                         hipComplex* const y[],
+                                         int64_t           incy,
+                                         const float*      c,
+                                         const hipComplex* s,
+                                         int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_crot_batched_64((rocblas_handle)handle,
+                                                        n,
+                                                        (rocblas_float_complex**)x,
+                                                        incx,
+                                                        (rocblas_float_complex**)y,
+                                                        incy,
+                                                        c,
+                                                        (rocblas_float_complex*)s,
+                                                        batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsrotBatched_v2_64(hipblasHandle_t   handle,
+                                          int64_t           n,
+                                          hipComplex* const x[],
+                                          int64_t           incx,
+                                          hipComplex* const y[],
+                                          int64_t           incy,
+                                          const float*      c,
+                                          const float*      s,
+                                          int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_csrot_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_float_complex**)x,
+                                                         incx,
+                                                         (rocblas_float_complex**)y,
+                                                         incy,
+                                                         c,
+                                                         s,
+                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotBatched_v2_64(hipblasHandle_t         handle,
+                                         int64_t                 n,
+                                         hipDoubleComplex* const x[],
+                                         int64_t                 incx,
+                                         hipDoubleComplex* const y[],
+                                         int64_t                 incy,
+                                         const double*           c,
+                                         const hipDoubleComplex* s,
+                                         int64_t                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_zrot_batched_64((rocblas_handle)handle,
+                                                        n,
+                                                        (rocblas_double_complex**)x,
+                                                        incx,
+                                                        (rocblas_double_complex**)y,
+                                                        incy,
+                                                        c,
+                                                        (rocblas_double_complex*)s,
+                                                        batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdrotBatched_v2_64(hipblasHandle_t         handle,
+                                          int64_t                 n,
+                                          hipDoubleComplex* const x[],
+                                          int64_t                 incx,
+                                          hipDoubleComplex* const y[],
+                                          int64_t                 incy,
+                                          const double*           c,
+                                          const double*           s,
+                                          int64_t                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_zdrot_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_double_complex**)x,
+                                                         incx,
+                                                         (rocblas_double_complex**)y,
+                                                         incy,
+                                                         c,
+                                                         s,
+                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rot_strided_batched
+hipblasStatus_t hipblasSrotStridedBatched(hipblasHandle_t handle,
+                                          int             n,
+                                          float*          x,
+                                          int             incx,
+                                          hipblasStride   stridex,
+                                          float*          y,
+                                          int             incy,
+                                          hipblasStride   stridey,
+                                          const float*    c,
+                                          const float*    s,
+                                          int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_srot_strided_batched(
+        (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, c, s, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotStridedBatched(hipblasHandle_t handle,
+                                          int             n,
+                                          double*         x,
+                                          int             incx,
+                                          hipblasStride   stridex,
+                                          double*         y,
+                                          int             incy,
+                                          hipblasStride   stridey,
+                                          const double*   c,
+                                          const double*   s,
+                                          int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_drot_strided_batched(
+        (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, c, s, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotStridedBatched(hipblasHandle_t       handle,
+                                          int                   n,
+                                          hipblasComplex*       x,
+                                          int                   incx,
+                                          hipblasStride         stridex,
+                                          hipblasComplex*       y,
+                                          int                   incy,
+                                          hipblasStride         stridey,
+                                          const float*          c,
+                                          const hipblasComplex* s,
+                                          int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_crot_strided_batched((rocblas_handle)handle,
+                                                             n,
+                                                             (rocblas_float_complex*)x,
+                                                             incx,
+                                                             stridex,
+                                                             (rocblas_float_complex*)y,
+                                                             incy,
+                                                             stridey,
+                                                             c,
+                                                             (rocblas_float_complex*)s,
+                                                             batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsrotStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           hipblasComplex* x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           hipblasComplex* y,
+                                           int             incy,
+                                           hipblasStride   stridey,
+                                           const float*    c,
+                                           const float*    s,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_csrot_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_float_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_float_complex*)y,
+                                                              incy,
+                                                              stridey,
+                                                              c,
+                                                              s,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotStridedBatched(hipblasHandle_t             handle,
+                                          int                         n,
+                                          hipblasDoubleComplex*       x,
+                                          int                         incx,
+                                          hipblasStride               stridex,
+                                          hipblasDoubleComplex*       y,
+                                          int                         incy,
+                                          hipblasStride               stridey,
+                                          const double*               c,
+                                          const hipblasDoubleComplex* s,
+                                          int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_zrot_strided_batched((rocblas_handle)handle,
+                                                             n,
+                                                             (rocblas_double_complex*)x,
+                                                             incx,
+                                                             stridex,
+                                                             (rocblas_double_complex*)y,
+                                                             incy,
+                                                             stridey,
+                                                             c,
+                                                             (rocblas_double_complex*)s,
+                                                             batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdrotStridedBatched(hipblasHandle_t       handle,
+                                           int                   n,
+                                           hipblasDoubleComplex* x,
+                                           int                   incx,
+                                           hipblasStride         stridex,
+                                           hipblasDoubleComplex* y,
+                                           int                   incy,
+                                           hipblasStride         stridey,
+                                           const double*         c,
+                                           const double*         s,
+                                           int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_zdrot_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_double_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_double_complex*)y,
+                                                              incy,
+                                                              stridey,
+                                                              c,
+                                                              s,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotStridedBatched_v2(hipblasHandle_t   handle,
+                                             int               n,
+                                             hipComplex*       x,
+                                             int               incx,
+                                             hipblasStride     stridex,
+                                             hipComplex*       y,
+                                             int               incy,
+                                             hipblasStride     stridey,
+                                             const float*      c,
+                                             const hipComplex* s,
+                                             int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_crot_strided_batched((rocblas_handle)handle,
+                                                             n,
+                                                             (rocblas_float_complex*)x,
+                                                             incx,
+                                                             stridex,
+                                                             (rocblas_float_complex*)y,
+                                                             incy,
+                                                             stridey,
+                                                             c,
+                                                             (rocblas_float_complex*)s,
+                                                             batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsrotStridedBatched_v2(hipblasHandle_t handle,
+                                              int             n,
+                                              hipComplex*     x,
+                                              int             incx,
+                                              hipblasStride   stridex,
+                                              hipComplex*     y,
+                                              int             incy,
+                                              hipblasStride   stridey,
+                                              const float*    c,
+                                              const float*    s,
+                                              int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_csrot_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_float_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_float_complex*)y,
+                                                              incy,
+                                                              stridey,
+                                                              c,
+                                                              s,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotStridedBatched_v2(hipblasHandle_t         handle,
+                                             int                     n,
+                                             hipDoubleComplex*       x,
+                                             int                     incx,
+                                             hipblasStride           stridex,
+                                             hipDoubleComplex*       y,
+                                             int                     incy,
+                                             hipblasStride           stridey,
+                                             const double*           c,
+                                             const hipDoubleComplex* s,
+                                             int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_zrot_strided_batched((rocblas_handle)handle,
+                                                             n,
+                                                             (rocblas_double_complex*)x,
+                                                             incx,
+                                                             stridex,
+                                                             (rocblas_double_complex*)y,
+                                                             incy,
+                                                             stridey,
+                                                             c,
+                                                             (rocblas_double_complex*)s,
+                                                             batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdrotStridedBatched_v2(hipblasHandle_t   handle,
+                                              int               n,
+                                              hipDoubleComplex* x,
+                                              int               incx,
+                                              hipblasStride     stridex,
+                                              hipDoubleComplex* y,
+                                              int               incy,
+                                              hipblasStride     stridey,
+                                              const double*     c,
+                                              const double*     s,
+                                              int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_zdrot_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_double_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_double_complex*)y,
+                                                              incy,
+                                                              stridey,
+                                                              c,
+                                                              s,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rot_strided_batched_64
+hipblasStatus_t hipblasSrotStridedBatched_64(hipblasHandle_t handle,
+                                             int64_t         n,
+                                             float*          x,
+                                             int64_t         incx,
+                                             hipblasStride   stridex,
+                                             float*          y,
+                                             int64_t         incy,
+                                             hipblasStride   stridey,
+                                             const float*    c,
+                                             const float*    s,
+                                             int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_srot_strided_batched_64(
+        (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, c, s, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotStridedBatched_64(hipblasHandle_t handle,
+                                             int64_t         n,
+                                             double*         x,
+                                             int64_t         incx,
+                                             hipblasStride   stridex,
+                                             double*         y,
+                                             int64_t         incy,
+                                             hipblasStride   stridey,
+                                             const double*   c,
+                                             const double*   s,
+                                             int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_drot_strided_batched_64(
+        (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, c, s, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotStridedBatched_64(hipblasHandle_t       handle,
+                                             int64_t               n,
+                                             hipblasComplex*       x,
+                                             int64_t               incx,
+                                             hipblasStride         stridex,
+                                             hipblasComplex*       y,
+                                             int64_t               incy,
+                                             hipblasStride         stridey,
+                                             const float*          c,
+                                             const hipblasComplex* s,
+                                             int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_crot_strided_batched_64((rocblas_handle)handle,
+                                                                n,
+                                                                (rocblas_float_complex*)x,
+                                                                incx,
+                                                                stridex,
+                                                                (rocblas_float_complex*)y,
+                                                                incy,
+                                                                stridey,
+                                                                c,
+                                                                (rocblas_float_complex*)s,
+                                                                batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsrotStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              hipblasComplex* x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              hipblasComplex* y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              const float*    c,
+                                              const float*    s,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_csrot_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_float_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_float_complex*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 c,
+                                                                 s,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotStridedBatched_64(hipblasHandle_t             handle,
+                                             int64_t                     n,
+                                             hipblasDoubleComplex*       x,
+                                             int64_t                     incx,
+                                             hipblasStride               stridex,
+                                             hipblasDoubleComplex*       y,
+                                             int64_t                     incy,
+                                             hipblasStride               stridey,
+                                             const double*               c,
+                                             const hipblasDoubleComplex* s,
+                                             int64_t                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_zrot_strided_batched_64((rocblas_handle)handle,
+                                                                n,
+                                                                (rocblas_double_complex*)x,
+                                                                incx,
+                                                                stridex,
+                                                                (rocblas_double_complex*)y,
+                                                                incy,
+                                                                stridey,
+                                                                c,
+                                                                (rocblas_double_complex*)s,
+                                                                batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdrotStridedBatched_64(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              hipblasDoubleComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              hipblasDoubleComplex* y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              const double*         c,
+                                              const double*         s,
+                                              int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_zdrot_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_double_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_double_complex*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 c,
+                                                                 s,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                int64_t           n,
+                                                hipComplex*       x,
+                                                int64_t           incx,
+                                                hipblasStride     stridex,
+                                                hipComplex*       y,
+                                                int64_t           incy,
+                                                hipblasStride     stridey,
+                                                const float*      c,
+                                                const hipComplex* s,
+                                                int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_crot_strided_batched_64((rocblas_handle)handle,
+                                                                n,
+                                                                (rocblas_float_complex*)x,
+                                                                incx,
+                                                                stridex,
+                                                                (rocblas_float_complex*)y,
+                                                                incy,
+                                                                stridey,
+                                                                c,
+                                                                (rocblas_float_complex*)s,
+                                                                batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsrotStridedBatched_v2_64(hipblasHandle_t handle,
+                                                 int64_t         n,
+                                                 hipComplex*     x,
+                                                 int64_t         incx,
+                                                 hipblasStride   stridex,
+                                                 hipComplex*     y,
+                                                 int64_t         incy,
+                                                 hipblasStride   stridey,
+                                                 const float*    c,
+                                                 const float*    s,
+                                                 int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_csrot_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_float_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_float_complex*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 c,
+                                                                 s,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                int64_t                 n,
+                                                hipDoubleComplex*       x,
+                                                int64_t                 incx,
+                                                hipblasStride           stridex,
+                                                hipDoubleComplex*       y,
+                                                int64_t                 incy,
+                                                hipblasStride           stridey,
+                                                const double*           c,
+                                                const hipDoubleComplex* s,
+                                                int64_t                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_zrot_strided_batched_64((rocblas_handle)handle,
+                                                                n,
+                                                                (rocblas_double_complex*)x,
+                                                                incx,
+                                                                stridex,
+                                                                (rocblas_double_complex*)y,
+                                                                incy,
+                                                                stridey,
+                                                                c,
+                                                                (rocblas_double_complex*)s,
+                                                                batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdrotStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                 int64_t           n,
+                                                 hipDoubleComplex* x,
+                                                 int64_t           incx,
+                                                 hipblasStride     stridex,
+                                                 hipDoubleComplex* y,
+                                                 int64_t           incy,
+                                                 hipblasStride     stridey,
+                                                 const double*     c,
+                                                 const double*     s,
+                                                 int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_zdrot_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_double_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_double_complex*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 c,
+                                                                 s,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotg
+hipblasStatus_t hipblasSrotg(hipblasHandle_t handle, float* a, float* b, float* c, float* s)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(rocblas_srotg((rocblas_handle)handle, a, b, c, s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotg(hipblasHandle_t handle, double* a, double* b, double* c, double* s)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(rocblas_drotg((rocblas_handle)handle, a, b, c, s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotg(
+    hipblasHandle_t handle, hipblasComplex* a, hipblasComplex* b, float* c, hipblasComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(rocblas_crotg((rocblas_handle)handle,
+                                              (rocblas_float_complex*)a,
+                                              (rocblas_float_complex*)b,
+                                              c,
+                                              (rocblas_float_complex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotg(hipblasHandle_t       handle,
+                             hipblasDoubleComplex* a,
+                             hipblasDoubleComplex* b,
+                             double*               c,
+                             hipblasDoubleComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(rocblas_zrotg((rocblas_handle)handle,
+                                              (rocblas_double_complex*)a,
+                                              (rocblas_double_complex*)b,
+                                              c,
+                                              (rocblas_double_complex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasCrotg_v2(hipblasHandle_t handle, hipComplex* a, hipComplex* b, float* c, hipComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(rocblas_crotg((rocblas_handle)handle,
+                                              (rocblas_float_complex*)a,
+                                              (rocblas_float_complex*)b,
+                                              c,
+                                              (rocblas_float_complex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotg_v2(hipblasHandle_t   handle,
+                                hipDoubleComplex* a,
+                                hipDoubleComplex* b,
+                                double*           c,
+                                hipDoubleComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(rocblas_zrotg((rocblas_handle)handle,
+                                              (rocblas_double_complex*)a,
+                                              (rocblas_double_complex*)b,
+                                              c,
+                                              (rocblas_double_complex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotg_64
+hipblasStatus_t hipblasSrotg_64(hipblasHandle_t handle, float* a, float* b, float* c, float* s)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(rocblas_srotg_64((rocblas_handle)handle, a, b, c, s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotg_64(hipblasHandle_t handle, double* a, double* b, double* c, double* s)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(rocblas_drotg_64((rocblas_handle)handle, a, b, c, s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotg_64(
+    hipblasHandle_t handle, hipblasComplex* a, hipblasComplex* b, float* c, hipblasComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(rocblas_crotg_64((rocblas_handle)handle,
+                                                 (rocblas_float_complex*)a,
+                                                 (rocblas_float_complex*)b,
+                                                 c,
+                                                 (rocblas_float_complex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotg_64(hipblasHandle_t       handle,
+                                hipblasDoubleComplex* a,
+                                hipblasDoubleComplex* b,
+                                double*               c,
+                                hipblasDoubleComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(rocblas_zrotg_64((rocblas_handle)handle,
+                                                 (rocblas_double_complex*)a,
+                                                 (rocblas_double_complex*)b,
+                                                 c,
+                                                 (rocblas_double_complex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotg_v2_64(
+    hipblasHandle_t handle, hipComplex* a, hipComplex* b, float* c, hipComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(rocblas_crotg_64((rocblas_handle)handle,
+                                                 (rocblas_float_complex*)a,
+                                                 (rocblas_float_complex*)b,
+                                                 c,
+                                                 (rocblas_float_complex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotg_v2_64(hipblasHandle_t   handle,
+                                   hipDoubleComplex* a,
+                                   hipDoubleComplex* b,
+                                   double*           c,
+                                   hipDoubleComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(rocblas_zrotg_64((rocblas_handle)handle,
+                                                 (rocblas_double_complex*)a,
+                                                 (rocblas_double_complex*)b,
+                                                 c,
+                                                 (rocblas_double_complex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotg_batched
+hipblasStatus_t hipblasSrotgBatched(hipblasHandle_t handle,
+                                    float* const    a[],
+                                    float* const    b[],
+                                    float* const    c[],
+                                    float* const    s[],
+                                    int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, batchCount);
+    return hipblasConvertStatus(
+        rocblas_srotg_batched((rocblas_handle)handle, a, b, c, s, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotgBatched(hipblasHandle_t handle,
+                                    double* const   a[],
+                                    double* const   b[],
+                                    double* const   c[],
+                                    double* const   s[],
+                                    int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, batchCount);
+    return hipblasConvertStatus(
+        rocblas_drotg_batched((rocblas_handle)handle, a, b, c, s, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotgBatched(hipblasHandle_t       handle,
+                                    hipblasComplex* const a[],
+                                    hipblasComplex* const b[],
+                                    float* const          c[],
+                                    hipblasComplex* const s[],
+                                    int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, batchCount);
+    return hipblasConvertStatus(rocblas_crotg_batched((rocblas_handle)handle,
+                                                      (rocblas_float_complex**)a,
+                                                      (rocblas_float_complex**)b,
+                                                      c,
+                                                      (rocblas_float_complex**)s,
+                                                      batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotgBatched(hipblasHandle_t             handle,
+                                    hipblasDoubleComplex* const a[],
+                                    hipblasDoubleComplex* const b[],
+                                    double* const               c[],
+                                    hipblasDoubleComplex* const s[],
+                                    int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, batchCount);
+    return hipblasConvertStatus(rocblas_zrotg_batched((rocblas_handle)handle,
+                                                      (rocblas_double_complex**)a,
+                                                      (rocblas_double_complex**)b,
+                                                      c,
+                                                      (rocblas_double_complex**)s,
+                                                      batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotgBatched_v2(hipblasHandle_t   handle,
+                                       hipComplex* const a[],
+                                       hipComplex* const b[],
+                                       float* const      c[],
+                                       hipComplex* const s[],
+                                       int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, batchCount);
+    return hipblasConvertStatus(rocblas_crotg_batched((rocblas_handle)handle,
+                                                      (rocblas_float_complex**)a,
+                                                      (rocblas_float_complex**)b,
+                                                      c,
+                                                      (rocblas_float_complex**)s,
+                                                      batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotgBatched_v2(hipblasHandle_t         handle,
+                                       hipDoubleComplex* const a[],
+                                       hipDoubleComplex* const b[],
+                                       double* const           c[],
+                                       hipDoubleComplex* const s[],
+                                       int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, batchCount);
+    return hipblasConvertStatus(rocblas_zrotg_batched((rocblas_handle)handle,
+                                                      (rocblas_double_complex**)a,
+                                                      (rocblas_double_complex**)b,
+                                                      c,
+                                                      (rocblas_double_complex**)s,
+                                                      batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotg_batched_64
+hipblasStatus_t hipblasSrotgBatched_64(hipblasHandle_t handle,
+                                       float* const    a[],
+                                       float* const    b[],
+                                       float* const    c[],
+                                       float* const    s[],
+                                       int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, batchCount);
+    return hipblasConvertStatus(
+        rocblas_srotg_batched_64((rocblas_handle)handle, a, b, c, s, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotgBatched_64(hipblasHandle_t handle,
+                                       double* const   a[],
+                                       double* const   b[],
+                                       double* const   c[],
+                                       double* const   s[],
+                                       int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, batchCount);
+    return hipblasConvertStatus(
+        rocblas_drotg_batched_64((rocblas_handle)handle, a, b, c, s, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotgBatched_64(hipblasHandle_t       handle,
+                                       hipblasComplex* const a[],
+                                       hipblasComplex* const b[],
+                                       float* const          c[],
+                                       hipblasComplex* const s[],
+                                       int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, batchCount);
+    return hipblasConvertStatus(rocblas_crotg_batched_64((rocblas_handle)handle,
+                                                         (rocblas_float_complex**)a,
+                                                         (rocblas_float_complex**)b,
+                                                         c,
+                                                         (rocblas_float_complex**)s,
+                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotgBatched_64(hipblasHandle_t             handle,
+                                       hipblasDoubleComplex* const a[],
+                                       hipblasDoubleComplex* const b[],
+                                       double* const               c[],
+                                       hipblasDoubleComplex* const s[],
+                                       int64_t                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, batchCount);
+    return hipblasConvertStatus(rocblas_zrotg_batched_64((rocblas_handle)handle,
+                                                         (rocblas_double_complex**)a,
+                                                         (rocblas_double_complex**)b,
+                                                         c,
+                                                         (rocblas_double_complex**)s,
+                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotgBatched_v2_64(hipblasHandle_t   handle,
+                                          hipComplex* const a[],
+                                          hipComplex* const b[],
+                                          float* const      c[],
+                                          hipComplex* const s[],
+                                          int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, batchCount);
+    return hipblasConvertStatus(rocblas_crotg_batched_64((rocblas_handle)handle,
+                                                         (rocblas_float_complex**)a,
+                                                         (rocblas_float_complex**)b,
+                                                         c,
+                                                         (rocblas_float_complex**)s,
+                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotgBatched_v2_64(hipblasHandle_t         handle,
+                                          hipDoubleComplex* const a[],
+                                          hipDoubleComplex* const b[],
+                                          double* const           c[],
+                                          hipDoubleComplex* const s[],
+                                          int64_t                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, batchCount);
+    return hipblasConvertStatus(rocblas_zrotg_batched_64((rocblas_handle)handle,
+                                                         (rocblas_double_complex**)a,
+                                                         (rocblas_double_complex**)b,
+                                                         c,
+                                                         (rocblas_double_complex**)s,
+                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotg_strided_batched
+hipblasStatus_t hipblasSrotgStridedBatched(hipblasHandle_t handle,
+                                           float*          a,
+                                           hipblasStride   stride_a,
+                                           float*          b,
+                                           hipblasStride   stride_b,
+                                           float*          c,
+                                           hipblasStride   stride_c,
+                                           float*          s,
+                                           hipblasStride   stride_s,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, stride_a, stride_b, stride_c, stride_s, batchCount);
+    return hipblasConvertStatus(rocblas_srotg_strided_batched(
+        (rocblas_handle)handle, a, stride_a, b, stride_b, c, stride_c, s, stride_s, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotgStridedBatched(hipblasHandle_t handle,
+                                           double*         a,
+                                           hipblasStride   stride_a,
+                                           double*         b,
+                                           hipblasStride   stride_b,
+                                           double*         c,
+                                           hipblasStride   stride_c,
+                                           double*         s,
+                                           hipblasStride   stride_s,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, stride_a, stride_b, stride_c, stride_s, batchCount);
+    return hipblasConvertStatus(rocblas_drotg_strided_batched(
+        (rocblas_handle)handle, a, stride_a, b, stride_b, c, stride_c, s, stride_s, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotgStridedBatched(hipblasHandle_t handle,
+                                           hipblasComplex* a,
+                                           hipblasStride   stride_a,
+                                           hipblasComplex* b,
+                                           hipblasStride   stride_b,
+                                           float*          c,
+                                           hipblasStride   stride_c,
+                                           hipblasComplex* s,
+                                           hipblasStride   stride_s,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, stride_a, stride_b, stride_c, stride_s, batchCount);
+    return hipblasConvertStatus(rocblas_crotg_strided_batched((rocblas_handle)handle,
+                                                              (rocblas_float_complex*)a,
+                                                              stride_a,
+                                                              (rocblas_float_complex*)b,
+                                                              stride_b,
+                                                              c,
+                                                              stride_c,
+                                                              (rocblas_float_complex*)s,
+                                                              stride_s,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotgStridedBatched(hipblasHandle_t       handle,
+                                           hipblasDoubleComplex* a,
+                                           hipblasStride         stride_a,
+                                           hipblasDoubleComplex* b,
+                                           hipblasStride         stride_b,
+                                           double*               c,
+                                           hipblasStride         stride_c,
+                                           hipblasDoubleComplex* s,
+                                           hipblasStride         stride_s,
+                                           int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, stride_a, stride_b, stride_c, stride_s, batchCount);
+    return hipblasConvertStatus(rocblas_zrotg_strided_batched((rocblas_handle)handle,
+                                                              (rocblas_double_complex*)a,
+                                                              stride_a,
+                                                              (rocblas_double_complex*)b,
+                                                              stride_b,
+                                                              c,
+                                                              stride_c,
+                                                              (rocblas_double_complex*)s,
+                                                              stride_s,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotgStridedBatched_v2(hipblasHandle_t handle,
+                                              hipComplex*     a,
+                                              hipblasStride   stride_a,
+                                              hipComplex*     b,
+                                              hipblasStride   stride_b,
+                                              float*          c,
+                                              hipblasStride   stride_c,
+                                              hipComplex*     s,
+                                              hipblasStride   stride_s,
+                                              int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, stride_a, stride_b, stride_c, stride_s, batchCount);
+    return hipblasConvertStatus(rocblas_crotg_strided_batched((rocblas_handle)handle,
+                                                              (rocblas_float_complex*)a,
+                                                              stride_a,
+                                                              (rocblas_float_complex*)b,
+                                                              stride_b,
+                                                              c,
+                                                              stride_c,
+                                                              (rocblas_float_complex*)s,
+                                                              stride_s,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotgStridedBatched_v2(hipblasHandle_t   handle,
+                                              hipDoubleComplex* a,
+                                              hipblasStride     stride_a,
+                                              hipDoubleComplex* b,
+                                              hipblasStride     stride_b,
+                                              double*           c,
+                                              hipblasStride     stride_c,
+                                              hipDoubleComplex* s,
+                                              hipblasStride     stride_s,
+                                              int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, stride_a, stride_b, stride_c, stride_s, batchCount);
+    return hipblasConvertStatus(rocblas_zrotg_strided_batched((rocblas_handle)handle,
+                                                              (rocblas_double_complex*)a,
+                                                              stride_a,
+                                                              (rocblas_double_complex*)b,
+                                                              stride_b,
+                                                              c,
+                                                              stride_c,
+                                                              (rocblas_double_complex*)s,
+                                                              stride_s,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotg_strided_batched_64
+hipblasStatus_t hipblasSrotgStridedBatched_64(hipblasHandle_t handle,
+                                              float*          a,
+                                              hipblasStride   stride_a,
+                                              float*          b,
+                                              hipblasStride   stride_b,
+                                              float*          c,
+                                              hipblasStride   stride_c,
+                                              float*          s,
+                                              hipblasStride   stride_s,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, stride_a, stride_b, stride_c, stride_s, batchCount);
+    return hipblasConvertStatus(rocblas_srotg_strided_batched_64(
+        (rocblas_handle)handle, a, stride_a, b, stride_b, c, stride_c, s, stride_s, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotgStridedBatched_64(hipblasHandle_t handle,
+                                              double*         a,
+                                              hipblasStride   stride_a,
+                                              double*         b,
+                                              hipblasStride   stride_b,
+                                              double*         c,
+                                              hipblasStride   stride_c,
+                                              double*         s,
+                                              hipblasStride   stride_s,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, stride_a, stride_b, stride_c, stride_s, batchCount);
+    return hipblasConvertStatus(rocblas_drotg_strided_batched_64(
+        (rocblas_handle)handle, a, stride_a, b, stride_b, c, stride_c, s, stride_s, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotgStridedBatched_64(hipblasHandle_t handle,
+                                              hipblasComplex* a,
+                                              hipblasStride   stride_a,
+                                              hipblasComplex* b,
+                                              hipblasStride   stride_b,
+                                              float*          c,
+                                              hipblasStride   stride_c,
+                                              hipblasComplex* s,
+                                              hipblasStride   stride_s,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, stride_a, stride_b, stride_c, stride_s, batchCount);
+    return hipblasConvertStatus(rocblas_crotg_strided_batched_64((rocblas_handle)handle,
+                                                                 (rocblas_float_complex*)a,
+                                                                 stride_a,
+                                                                 (rocblas_float_complex*)b,
+                                                                 stride_b,
+                                                                 c,
+                                                                 stride_c,
+                                                                 (rocblas_float_complex*)s,
+                                                                 stride_s,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotgStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasDoubleComplex* a,
+                                              hipblasStride         stride_a,
+                                              hipblasDoubleComplex* b,
+                                              hipblasStride         stride_b,
+                                              double*               c,
+                                              hipblasStride         stride_c,
+                                              hipblasDoubleComplex* s,
+                                              hipblasStride         stride_s,
+                                              int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, stride_a, stride_b, stride_c, stride_s, batchCount);
+    return hipblasConvertStatus(rocblas_zrotg_strided_batched_64((rocblas_handle)handle,
+                                                                 (rocblas_double_complex*)a,
+                                                                 stride_a,
+                                                                 (rocblas_double_complex*)b,
+                                                                 stride_b,
+                                                                 c,
+                                                                 stride_c,
+                                                                 (rocblas_double_complex*)s,
+                                                                 stride_s,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotgStridedBatched_v2_64(hipblasHandle_t handle,
+                                                 hipComplex*     a,
+                                                 hipblasStride   stride_a,
+                                                 hipComplex*     b,
+                                                 hipblasStride   stride_b,
+                                                 float*          c,
+                                                 hipblasStride   stride_c,
+                                                 hipComplex*     s,
+                                                 hipblasStride   stride_s,
+                                                 int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, stride_a, stride_b, stride_c, stride_s, batchCount);
+    return hipblasConvertStatus(rocblas_crotg_strided_batched_64((rocblas_handle)handle,
+                                                                 (rocblas_float_complex*)a,
+                                                                 stride_a,
+                                                                 (rocblas_float_complex*)b,
+                                                                 stride_b,
+                                                                 c,
+                                                                 stride_c,
+                                                                 (rocblas_float_complex*)s,
+                                                                 stride_s,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotgStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                 hipDoubleComplex* a,
+                                                 hipblasStride     stride_a,
+                                                 hipDoubleComplex* b,
+                                                 hipblasStride     stride_b,
+                                                 double*           c,
+                                                 hipblasStride     stride_c,
+                                                 hipDoubleComplex* s,
+                                                 hipblasStride     stride_s,
+                                                 int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, stride_a, stride_b, stride_c, stride_s, batchCount);
+    return hipblasConvertStatus(rocblas_zrotg_strided_batched_64((rocblas_handle)handle,
+                                                                 (rocblas_double_complex*)a,
+                                                                 stride_a,
+                                                                 (rocblas_double_complex*)b,
+                                                                 stride_b,
+                                                                 c,
+                                                                 stride_c,
+                                                                 (rocblas_double_complex*)s,
+                                                                 stride_s,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotm
+hipblasStatus_t hipblasSrotm(
+    hipblasHandle_t handle, int n, float* x, int incx, float* y, int incy, const float* param)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_srotm((rocblas_handle)handle, n, x, incx, y, incy, param));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotm(
+    hipblasHandle_t handle, int n, double* x, int incx, double* y, int incy, const double* param)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_drotm((rocblas_handle)handle, n, x, incx, y, incy, param));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotm_64
+hipblasStatus_t hipblasSrotm_64(hipblasHandle_t handle,
+                                int64_t         n,
+                                float*          x,
+                                int64_t         incx,
+                                float*          y,
+                                int64_t         incy,
+                                const float*    param)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(
+        rocblas_srotm_64((rocblas_handle)handle, n, x, incx, y, incy, param));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotm_64(hipblasHandle_t handle,
+                                int64_t         n,
+                                double*         x,
+                                int64_t         incx,
+                                double*         y,
+                                int64_t         incy,
+                                const double*   param)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(
+        rocblas_drotm_64((rocblas_handle)handle, n, x, incx, y, incy, param));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotm_batched
+hipblasStatus_t hipblasSrotmBatched(hipblasHandle_t    handle,
+                                    int                n,
+                                    float* const       x[],
+                                    int                incx,
+                                    float* const       y[],
+                                    int                incy,
+                                    const float* const param[],
+                                    int                batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(
+        rocblas_srotm_batched((rocblas_handle)handle, n, x, incx, y, incy, param, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotmBatched(hipblasHandle_t     handle,
+                                    int                 n,
+                                    double* const       x[],
+                                    int                 incx,
+                                    double* const       y[],
+                                    int                 incy,
+                                    const double* const param[],
+                                    int                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(
+        rocblas_drotm_batched((rocblas_handle)handle, n, x, incx, y, incy, param, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotm_batched_64
+hipblasStatus_t hipblasSrotmBatched_64(hipblasHandle_t    handle,
+                                       int64_t            n,
+                                       float* const       x[],
+                                       int64_t            incx,
+                                       float* const       y[],
+                                       int64_t            incy,
+                                       const float* const param[],
+                                       int64_t            batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(
+        rocblas_srotm_batched_64((rocblas_handle)handle, n, x, incx, y, incy, param, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotmBatched_64(hipblasHandle_t     handle,
+                                       int64_t             n,
+                                       double* const       x[],
+                                       int64_t             incx,
+                                       double* const       y[],
+                                       int64_t             incy,
+                                       const double* const param[],
+                                       int64_t             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(
+        rocblas_drotm_batched_64((rocblas_handle)handle, n, x, incx, y, incy, param, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotm_strided_batched
+hipblasStatus_t hipblasSrotmStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           float*          x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           float*          y,
+                                           int             incy,
+                                           hipblasStride   stridey,
+                                           const float*    param,
+                                           hipblasStride   strideParam,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, strideParam, batchCount);
+    return hipblasConvertStatus(rocblas_srotm_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              x,
+                                                              incx,
+                                                              stridex,
+                                                              y,
+                                                              incy,
+                                                              stridey,
+                                                              param,
+                                                              strideParam,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotmStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           double*         x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           double*         y,
+                                           int             incy,
+                                           hipblasStride   stridey,
+                                           const double*   param,
+                                           hipblasStride   strideParam,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, strideParam, batchCount);
+    return hipblasConvertStatus(rocblas_drotm_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              x,
+                                                              incx,
+                                                              stridex,
+                                                              y,
+                                                              incy,
+                                                              stridey,
+                                                              param,
+                                                              strideParam,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotm_strided_batched_64
+hipblasStatus_t hipblasSrotmStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              float*          x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              float*          y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              const float*    param,
+                                              hipblasStride   strideParam,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, strideParam, batchCount);
+    return hipblasConvertStatus(rocblas_srotm_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 param,
+                                                                 strideParam,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotmStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              double*         x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              double*         y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              const double*   param,
+                                              hipblasStride   strideParam,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, strideParam, batchCount);
+    return hipblasConvertStatus(rocblas_drotm_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 param,
+                                                                 strideParam,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotmg
+hipblasStatus_t hipblasSrotmg(
+    hipblasHandle_t handle, float* d1, float* d2, float* x1, const float* y1, float* param)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(rocblas_srotmg((rocblas_handle)handle, d1, d2, x1, y1, param));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotmg(
+    hipblasHandle_t handle, double* d1, double* d2, double* x1, const double* y1, double* param)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(rocblas_drotmg((rocblas_handle)handle, d1, d2, x1, y1, param));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotmg_64
+hipblasStatus_t hipblasSrotmg_64(
+    hipblasHandle_t handle, float* d1, float* d2, float* x1, const float* y1, float* param)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(rocblas_srotmg_64((rocblas_handle)handle, d1, d2, x1, y1, param));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotmg_64(
+    hipblasHandle_t handle, double* d1, double* d2, double* x1, const double* y1, double* param)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(rocblas_drotmg_64((rocblas_handle)handle, d1, d2, x1, y1, param));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotmg_batched
+hipblasStatus_t hipblasSrotmgBatched(hipblasHandle_t    handle,
+                                     float* const       d1[],
+                                     float* const       d2[],
+                                     float* const       x1[],
+                                     const float* const y1[],
+                                     float* const       param[],
+                                     int                batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, batchCount);
+    return hipblasConvertStatus(
+        rocblas_srotmg_batched((rocblas_handle)handle, d1, d2, x1, y1, param, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotmgBatched(hipblasHandle_t     handle,
+                                     double* const       d1[],
+                                     double* const       d2[],
+                                     double* const       x1[],
+                                     const double* const y1[],
+                                     double* const       param[],
+                                     int                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, batchCount);
+    return hipblasConvertStatus(
+        rocblas_drotmg_batched((rocblas_handle)handle, d1, d2, x1, y1, param, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotmg_batched_64
+hipblasStatus_t hipblasSrotmgBatched_64(hipblasHandle_t    handle,
+                                        float* const       d1[],
+                                        float* const       d2[],
+                                        float* const       x1[],
+                                        const float* const y1[],
+                                        float* const       param[],
+                                        int64_t            batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, batchCount);
+    return hipblasConvertStatus(
+        rocblas_srotmg_batched_64((rocblas_handle)handle, d1, d2, x1, y1, param, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotmgBatched_64(hipblasHandle_t     handle,
+                                        double* const       d1[],
+                                        double* const       d2[],
+                                        double* const       x1[],
+                                        const double* const y1[],
+                                        double* const       param[],
+                                        int64_t             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, batchCount);
+    return hipblasConvertStatus(
+        rocblas_drotmg_batched_64((rocblas_handle)handle, d1, d2, x1, y1, param, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotmg_strided_batched
+hipblasStatus_t hipblasSrotmgStridedBatched(hipblasHandle_t handle,
+                                            float*          d1,
+                                            hipblasStride   stride_d1,
+                                            float*          d2,
+                                            hipblasStride   stride_d2,
+                                            float*          x1,
+                                            hipblasStride   stride_x1,
+                                            const float*    y1,
+                                            hipblasStride   stride_y1,
+                                            float*          param,
+                                            hipblasStride   strideParam,
+                                            int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, stride_d1, stride_d2, stride_x1, stride_y1, strideParam, batchCount);
+    return hipblasConvertStatus(rocblas_srotmg_strided_batched((rocblas_handle)handle,
+                                                               d1,
+                                                               stride_d1,
+                                                               d2,
+                                                               stride_d2,
+                                                               x1,
+                                                               stride_x1,
+                                                               y1,
+                                                               stride_y1,
+                                                               param,
+                                                               strideParam,
+                                                               batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotmgStridedBatched(hipblasHandle_t handle,
+                                            double*         d1,
+                                            hipblasStride   stride_d1,
+                                            double*         d2,
+                                            hipblasStride   stride_d2,
+                                            double*         x1,
+                                            hipblasStride   stride_x1,
+                                            const double*   y1,
+                                            hipblasStride   stride_y1,
+                                            double*         param,
+                                            hipblasStride   strideParam,
+                                            int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, stride_d1, stride_d2, stride_x1, stride_y1, strideParam, batchCount);
+    return hipblasConvertStatus(rocblas_drotmg_strided_batched((rocblas_handle)handle,
+                                                               d1,
+                                                               stride_d1,
+                                                               d2,
+                                                               stride_d2,
+                                                               x1,
+                                                               stride_x1,
+                                                               y1,
+                                                               stride_y1,
+                                                               param,
+                                                               strideParam,
+                                                               batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotmg_strided_batched_64
+hipblasStatus_t hipblasSrotmgStridedBatched_64(hipblasHandle_t handle,
+                                               float*          d1,
+                                               hipblasStride   stride_d1,
+                                               float*          d2,
+                                               hipblasStride   stride_d2,
+                                               float*          x1,
+                                               hipblasStride   stride_x1,
+                                               const float*    y1,
+                                               hipblasStride   stride_y1,
+                                               float*          param,
+                                               hipblasStride   strideParam,
+                                               int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, stride_d1, stride_d2, stride_x1, stride_y1, strideParam, batchCount);
+    return hipblasConvertStatus(rocblas_srotmg_strided_batched_64((rocblas_handle)handle,
+                                                                  d1,
+                                                                  stride_d1,
+                                                                  d2,
+                                                                  stride_d2,
+                                                                  x1,
+                                                                  stride_x1,
+                                                                  y1,
+                                                                  stride_y1,
+                                                                  param,
+                                                                  strideParam,
+                                                                  batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotmgStridedBatched_64(hipblasHandle_t handle,
+                                               double*         d1,
+                                               hipblasStride   stride_d1,
+                                               double*         d2,
+                                               hipblasStride   stride_d2,
+                                               double*         x1,
+                                               hipblasStride   stride_x1,
+                                               const double*   y1,
+                                               hipblasStride   stride_y1,
+                                               double*         param,
+                                               hipblasStride   strideParam,
+                                               int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, stride_d1, stride_d2, stride_x1, stride_y1, strideParam, batchCount);
+    return hipblasConvertStatus(rocblas_drotmg_strided_batched_64((rocblas_handle)handle,
+                                                                  d1,
+                                                                  stride_d1,
+                                                                  d2,
+                                                                  stride_d2,
+                                                                  x1,
+                                                                  stride_x1,
+                                                                  y1,
+                                                                  stride_y1,
+                                                                  param,
+                                                                  strideParam,
+                                                                  batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// scal
+hipblasStatus_t hipblasSscal(hipblasHandle_t handle, int n, const float* alpha, float* x, int incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasStatus_t deferred = hipblasDeferVector(handle, n, alpha, nullptr, 1, x, incx, HIP_R_32F);
+    if(deferred != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return deferred;
+    hipblasStatus_t host = hipblasHostScal(handle, n, alpha, x, incx, HIP_R_32F);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    return hipblasConvertStatus(rocblas_sscal((rocblas_handle)handle, n, alpha, x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasDscal(hipblasHandle_t handle, int n, const double* alpha, double* x, int incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasStatus_t deferred = hipblasDeferVector(handle, n, alpha, nullptr, 1, x, incx, HIP_R_64F);
+    if(deferred != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return deferred;
+    hipblasStatus_t host = hipblasHostScal(handle, n, alpha, x, incx, HIP_R_64F);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    return hipblasConvertStatus(rocblas_dscal((rocblas_handle)handle, n, alpha, x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCscal(
+    hipblasHandle_t handle, int n, const hipblasComplex* alpha, hipblasComplex* x, int incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasStatus_t host = hipblasHostScal(handle, n, alpha, x, incx, HIP_C_32F);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    return hipblasConvertStatus(rocblas_cscal(
+        (rocblas_handle)handle, n, (rocblas_float_complex*)alpha, (rocblas_float_complex*)x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasCsscal(hipblasHandle_t handle, int n, const float* alpha, hipblasComplex* x, int incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    return hipblasConvertStatus(
+        rocblas_csscal((rocblas_handle)handle, n, alpha, (rocblas_float_complex*)x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZscal(hipblasHandle_t             handle,
+                             int                         n,
+                             const hipblasDoubleComplex* alpha,
+                             hipblasDoubleComplex*       x,
+                             int                         incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasStatus_t host = hipblasHostScal(handle, n, alpha, x, incx, HIP_C_64F);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    return hipblasConvertStatus(rocblas_zscal((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_double_complex*)alpha,
+                                              (rocblas_double_complex*)x,
+                                              incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdscal(
+    hipblasHandle_t handle, int n, const double* alpha, hipblasDoubleComplex* x, int incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    return hipblasConvertStatus(
+        rocblas_zdscal((rocblas_handle)handle, n, alpha, (rocblas_double_complex*)x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasCscal_v2(hipblasHandle_t handle, int n, const hipComplex* alpha, hipComplex* x, int incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasStatus_t host = hipblasHostScal(handle, n, alpha, x, incx, HIP_C_32F);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    return hipblasConvertStatus(rocblas_cscal(
+        (rocblas_handle)handle, n, (rocblas_float_complex*)alpha, (rocblas_float_complex*)x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasCsscal_v2(hipblasHandle_t handle, int n, const float* alpha, hipComplex* x, int incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    return hipblasConvertStatus(
+        rocblas_csscal((rocblas_handle)handle, n, alpha, (rocblas_float_complex*)x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZscal_v2(
+    hipblasHandle_t handle, int n, const hipDoubleComplex* alpha, hipDoubleComplex* x, int incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasStatus_t host = hipblasHostScal(handle, n, alpha, x, incx, HIP_C_64F);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    return hipblasConvertStatus(rocblas_zscal((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_double_complex*)alpha,
+                                              (rocblas_double_complex*)x,
+                                              incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdscal_v2(
+    hipblasHandle_t handle, int n, const double* alpha, hipDoubleComplex* x, int incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    return hipblasConvertStatus(
+        rocblas_zdscal((rocblas_handle)handle, n, alpha, (rocblas_double_complex*)x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// scal_64
+hipblasStatus_t
+    hipblasSscal_64(hipblasHandle_t handle, int64_t n, const float* alpha, float* x, int64_t incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    return hipblasConvertStatus(rocblas_sscal_64((rocblas_handle)handle, n, alpha, x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasDscal_64(hipblasHandle_t handle, int64_t n, const double* alpha, double* x, int64_t incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    return hipblasConvertStatus(rocblas_dscal_64((rocblas_handle)handle, n, alpha, x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCscal_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* alpha, hipblasComplex* x, int64_t incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    return hipblasConvertStatus(rocblas_cscal_64(
+        (rocblas_handle)handle, n, (rocblas_float_complex*)alpha, (rocblas_float_complex*)x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsscal_64(
+    hipblasHandle_t handle, int64_t n, const float* alpha, hipblasComplex* x, int64_t incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    return hipblasConvertStatus(
+        rocblas_csscal_64((rocblas_handle)handle, n, alpha, (rocblas_float_complex*)x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZscal_64(hipblasHandle_t             handle,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                hipblasDoubleComplex*       x,
+                                int64_t                     incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    return hipblasConvertStatus(rocblas_zscal_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_double_complex*)alpha,
+                                                 (rocblas_double_complex*)x,
+                                                 incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdscal_64(
+    hipblasHandle_t handle, int64_t n, const double* alpha, hipblasDoubleComplex* x, int64_t incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    return hipblasConvertStatus(
+        rocblas_zdscal_64((rocblas_handle)handle, n, alpha, (rocblas_double_complex*)x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCscal_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipComplex* alpha, hipComplex* x, int64_t incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    return hipblasConvertStatus(rocblas_cscal_64(
+        (rocblas_handle)handle, n, (rocblas_float_complex*)alpha, (rocblas_float_complex*)x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsscal_v2_64(
+    hipblasHandle_t handle, int64_t n, const float* alpha, hipComplex* x, int64_t incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    return hipblasConvertStatus(
+        rocblas_csscal_64((rocblas_handle)handle, n, alpha, (rocblas_float_complex*)x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZscal_v2_64(hipblasHandle_t         handle,
+                                   int64_t                 n,
+                                   const hipDoubleComplex* alpha,
+                                   hipDoubleComplex*       x,
+                                   int64_t                 incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    return hipblasConvertStatus(rocblas_zscal_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_double_complex*)alpha,
+                                                 (rocblas_double_complex*)x,
+                                                 incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdscal_v2_64(
+    hipblasHandle_t handle, int64_t n, const double* alpha, hipDoubleComplex* x, int64_t incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    return hipblasConvertStatus(
+        rocblas_zdscal_64((rocblas_handle)handle, n, alpha, (rocblas_double_complex*)x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// scal_batched
+hipblasStatus_t hipblasSscalBatched(
+    hipblasHandle_t handle, int n, const float* alpha, float* const x[], int incx, int batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasConvertStatus(
+        rocblas_sscal_batched((rocblas_handle)handle, n, alpha, x, incx, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDscalBatched(
+    hipblasHandle_t handle, int n, const double* alpha, double* const x[], int incx, int batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasConvertStatus(
+        rocblas_dscal_batched((rocblas_handle)handle, n, alpha, x, incx, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCscalBatched(hipblasHandle_t       handle,
+                                    int                   n,
+                                    const hipblasComplex* alpha,
+                                    hipblasComplex* const x[],
+                                    int                   incx,
+                                    int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasConvertStatus(rocblas_cscal_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_float_complex*)alpha,
+                                                      (rocblas_float_complex* const*)x,
+                                                      incx,
+                                                      batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZscalBatched(hipblasHandle_t             handle,
+                                    int                         n,
+                                    const hipblasDoubleComplex* alpha,
+                                    hipblasDoubleComplex* const x[],
+                                    int                         incx,
+                                    int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasConvertStatus(rocblas_zscal_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_double_complex*)alpha,
+                                                      (rocblas_double_complex* const*)x,
+                                                      incx,
+                                                      batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsscalBatched(hipblasHandle_t       handle,
+                                     int                   n,
+                                     const float*          alpha,
+                                     hipblasComplex* const x[],
+                                     int                   incx,
+                                     int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasConvertStatus(rocblas_csscal_batched(
+        (rocblas_handle)handle, n, alpha, (rocblas_float_complex* const*)x, incx, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdscalBatched(hipblasHandle_t             handle,
+                                     int                         n,
+                                     const double*               alpha,
+                                     hipblasDoubleComplex* const x[],
+                                     int                         incx,
+                                     int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasConvertStatus(rocblas_zdscal_batched(
+        (rocblas_handle)handle, n, alpha, (rocblas_double_complex* const*)x, incx, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCscalBatched_v2(hipblasHandle_t   handle,
+                                       int               n,
+                                       const hipComplex* alpha,
+                                       hipComplex* const x[],
+                                       int               incx,
+                                       int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasConvertStatus(rocblas_cscal_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_float_complex*)alpha,
+                                                      (rocblas_float_complex* const*)x,
+                                                      incx,
+                                                      batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZscalBatched_v2(hipblasHandle_t         handle,
+                                       int                     n,
+                                       const hipDoubleComplex* alpha,
+                                       hipDoubleComplex* const x[],
+                                       int                     incx,
+                                       int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasConvertStatus(rocblas_zscal_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_double_complex*)alpha,
+                                                      (rocblas_double_complex* const*)x,
+                                                      incx,
+                                                      batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsscalBatched_v2(hipblasHandle_t   handle,
+                                        int               n,
+                                        const float*      alpha,
+                                        hipComplex* const x[],
+                                        int               incx,
+                                        int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasConvertStatus(rocblas_csscal_batched(
+        (rocblas_handle)handle, n, alpha, (rocblas_float_complex* const*)x, incx, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdscalBatched_v2(hipblasHandle_t         handle,
+                                        int                     n,
+                                        const double*           alpha,
+                                        hipDoubleComplex* const x[],
+                                        int                     incx,
+                                        int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasConvertStatus(rocblas_zdscal_batched(
+        (rocblas_handle)handle, n, alpha, (rocblas_double_complex* const*)x, incx, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// scal_batched_64
+hipblasStatus_t hipblasSscalBatched_64(hipblasHandle_t handle,
+                                       int64_t         n,
+                                       const float*    alpha,
+                                       float* const    x[],
+                                       int64_t         incx,
+                                       int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasConvertStatus(
+        rocblas_sscal_batched_64((rocblas_handle)handle, n, alpha, x, incx, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDscalBatched_64(hipblasHandle_t handle,
+                                       int64_t         n,
+                                       const double*   alpha,
+                                       double* const   x[],
+                                       int64_t         incx,
+                                       int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasConvertStatus(
+        rocblas_dscal_batched_64((rocblas_handle)handle, n, alpha, x, incx, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCscalBatched_64(hipblasHandle_t       handle,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       hipblasComplex* const x[],
+                                       int64_t               incx,
+                                       int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasConvertStatus(rocblas_cscal_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_float_complex*)alpha,
+                                                         (rocblas_float_complex* const*)x,
+                                                         incx,
+                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZscalBatched_64(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       hipblasDoubleComplex* const x[],
+                                       int64_t                     incx,
+                                       int64_t                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasConvertStatus(rocblas_zscal_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_double_complex*)alpha,
+                                                         (rocblas_double_complex* const*)x,
+                                                         incx,
+                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsscalBatched_64(hipblasHandle_t       handle,
+                                        int64_t               n,
+                                        const float*          alpha,
+                                        hipblasComplex* const x[],
+                                        int64_t               incx,
+                                        int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasConvertStatus(rocblas_csscal_batched_64(
+        (rocblas_handle)handle, n, alpha, (rocblas_float_complex* const*)x, incx, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdscalBatched_64(hipblasHandle_t             handle,
+                                        int64_t                     n,
+                                        const double*               alpha,
+                                        hipblasDoubleComplex* const x[],
+                                        int64_t                     incx,
+                                        int64_t                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasConvertStatus(rocblas_zdscal_batched_64(
+        (rocblas_handle)handle, n, alpha, (rocblas_double_complex* const*)x, incx, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCscalBatched_v2_64(hipblasHandle_t   handle,
+                                          int64_t           n,
+                                          const hipComplex* alpha,
+                                          hipComplex* const x[],
+                                          int64_t           incx,
+                                          int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasConvertStatus(rocblas_cscal_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_float_complex*)alpha,
+                                                         (rocblas_float_complex* const*)x,
+                                                         incx,
+                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZscalBatched_v2_64(hipblasHandle_t         handle,
+                                          int64_t                 n,
+                                          const hipDoubleComplex* alpha,
+                                          hipDoubleComplex* const x[],
+                                          int64_t                 incx,
+                                          int64_t                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasConvertStatus(rocblas_zscal_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_double_complex*)alpha,
+                                                         (rocblas_double_complex* const*)x,
+                                                         incx,
+                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsscalBatched_v2_64(hipblasHandle_t   handle,
+                                           int64_t           n,
+                                           const float*      alpha,
+                                           hipComplex* const x[],
+                                           int64_t           incx,
+                                           int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasConvertStatus(rocblas_csscal_batched_64(
+        (rocblas_handle)handle, n, alpha, (rocblas_float_complex* const*)x, incx, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdscalBatched_v2_64(hipblasHandle_t         handle,
+                                           int64_t                 n,
+                                           const double*           alpha,
+                                           hipDoubleComplex* const x[],
+                                           int64_t                 incx,
+                                           int64_t                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasConvertStatus(rocblas_zdscal_batched_64(
+        (rocblas_handle)handle, n, alpha, (rocblas_double_complex* const*)x, incx, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// scal_strided_batched
+hipblasStatus_t hipblasSscalStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           const float*    alpha,
+                                           float*          x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasConvertStatus(rocblas_sscal_strided_batched(
+        (rocblas_handle)handle, n, alpha, x, incx, stridex, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDscalStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           const double*   alpha,
+                                           double*         x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasConvertStatus(rocblas_dscal_strided_batched(
+        (rocblas_handle)handle, n, alpha, x, incx, stridex, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCscalStridedBatched(hipblasHandle_t       handle,
+                                           int                   n,
+                                           const hipblasComplex* alpha,
+                                           hipblasComplex*       x,
+                                           int                   incx,
+                                           hipblasStride         stridex,
+                                           int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasConvertStatus(rocblas_cscal_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_float_complex*)alpha,
+                                                              (rocblas_float_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZscalStridedBatched(hipblasHandle_t             handle,
+                                           int                         n,
+                                           const hipblasDoubleComplex* alpha,
+                                           hipblasDoubleComplex*       x,
+                                           int                         incx,
+                                           hipblasStride               stridex,
+                                           int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasConvertStatus(rocblas_zscal_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_double_complex*)alpha,
+                                                              (rocblas_double_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsscalStridedBatched(hipblasHandle_t handle,
+                                            int             n,
+                                            const float*    alpha,
+                                            hipblasComplex* x,
+                                            int             incx,
+                                            hipblasStride   stridex,
+                                            int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasConvertStatus(rocblas_csscal_strided_batched(
+        (rocblas_handle)handle, n, alpha, (rocblas_float_complex*)x, incx, stridex, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdscalStridedBatched(hipblasHandle_t       handle,
+                                            int                   n,
+                                            const double*         alpha,
+                                            hipblasDoubleComplex* x,
+                                            int                   incx,
+                                            hipblasStride         stridex,
+                                            int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasConvertStatus(rocblas_zdscal_strided_batched(
+        (rocblas_handle)handle, n, alpha, (rocblas_double_complex*)x, incx, stridex, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCscalStridedBatched_v2(hipblasHandle_t   handle,
+                                              int               n,
+                                              const hipComplex* alpha,
+                                              hipComplex*       x,
+                                              int               incx,
+                                              hipblasStride     stridex,
+                                              int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasConvertStatus(rocblas_cscal_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_float_complex*)alpha,
+                                                              (rocblas_float_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZscalStridedBatched_v2(hipblasHandle_t         handle,
+                                              int                     n,
+                                              const hipDoubleComplex* alpha,
+                                              hipDoubleComplex*       x,
+                                              int                     incx,
+                                              hipblasStride           stridex,
+                                              int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasConvertStatus(rocblas_zscal_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_double_complex*)alpha,
+                                                              (rocblas_double_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsscalStridedBatched_v2(hipblasHandle_t handle,
+                                               int             n,
+                                               const float*    alpha,
+                                               hipComplex*     x,
+                                               int             incx,
+                                               hipblasStride   stridex,
+                                               int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasConvertStatus(rocblas_csscal_strided_batched(
+        (rocblas_handle)handle, n, alpha, (rocblas_float_complex*)x, incx, stridex, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdscalStridedBatched_v2(hipblasHandle_t   handle,
+                                               int               n,
+                                               const double*     alpha,
+                                               hipDoubleComplex* x,
+                                               int               incx,
+                                               hipblasStride     stridex,
+                                               int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasConvertStatus(rocblas_zdscal_strided_batched(
+        (rocblas_handle)handle, n, alpha, (rocblas_double_complex*)x, incx, stridex, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// scal_strided_batched_64
+hipblasStatus_t hipblasSscalStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const float*    alpha,
+                                              float*          x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasConvertStatus(rocblas_sscal_strided_batched_64(
+        (rocblas_handle)handle, n, alpha, x, incx, stridex, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDscalStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const double*   alpha,
+                                              double*         x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasConvertStatus(rocblas_dscal_strided_batched_64(
+        (rocblas_handle)handle, n, alpha, x, incx, stridex, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCscalStridedBatched_64(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              hipblasComplex*       x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasConvertStatus(rocblas_cscal_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_float_complex*)alpha,
+                                                                 (rocblas_float_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZscalStridedBatched_64(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              hipblasDoubleComplex*       x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              int64_t                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasConvertStatus(rocblas_zscal_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_double_complex*)alpha,
+                                                                 (rocblas_double_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsscalStridedBatched_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               const float*    alpha,
+                                               hipblasComplex* x,
+                                               int64_t         incx,
+                                               hipblasStride   stridex,
+                                               int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasConvertStatus(rocblas_csscal_strided_batched_64(
+        (rocblas_handle)handle, n, alpha, (rocblas_float_complex*)x, incx, stridex, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdscalStridedBatched_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const double*         alpha,
+                                               hipblasDoubleComplex* x,
+                                               int64_t               incx,
+                                               hipblasStride         stridex,
+                                               int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasConvertStatus(rocblas_zdscal_strided_batched_64(
+        (rocblas_handle)handle, n, alpha, (rocblas_double_complex*)x, incx, stridex, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCscalStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                 int64_t           n,
+                                                 const hipComplex* alpha,
+                                                 hipComplex*       x,
+                                                 int64_t           incx,
+                                                 hipblasStride     stridex,
+                                                 int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasConvertStatus(rocblas_cscal_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_float_complex*)alpha,
+                                                                 (rocblas_float_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZscalStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                 int64_t                 n,
+                                                 const hipDoubleComplex* alpha,
+                                                 hipDoubleComplex*       x,
+                                                 int64_t                 incx,
+                                                 hipblasStride           stridex,
+                                                 int64_t                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasConvertStatus(rocblas_zscal_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_double_complex*)alpha,
+                                                                 (rocblas_double_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsscalStridedBatched_v2_64(hipblasHandle_t handle,
+                                                  int64_t         n,
+                                                  const float*    alpha,
+                                                  hipComplex*     x,
+                                                  int64_t         incx,
+                                                  hipblasStride   stridex,
+                                                  int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasConvertStatus(rocblas_csscal_strided_batched_64(
+        (rocblas_handle)handle, n, alpha, (rocblas_float_complex*)x, incx, stridex, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdscalStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                  int64_t           n,
+                                                  const double*     alpha,
+                                                  hipDoubleComplex* x,
+                                                  int64_t           incx,
+                                                  hipblasStride     stridex,
+                                                  int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasConvertStatus(rocblas_zdscal_strided_batched_64(
+        (rocblas_handle)handle, n, alpha, (rocblas_double_complex*)x, incx, stridex, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// swap
+hipblasStatus_t hipblasSswap(hipblasHandle_t handle, int n, float* x, int incx, float* y, int incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_sswap((rocblas_handle)handle, n, x, incx, y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasDswap(hipblasHandle_t handle, int n, double* x, int incx, double* y, int incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_dswap((rocblas_handle)handle, n, x, incx, y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCswap(
+    hipblasHandle_t handle, int n, hipblasComplex* x, int incx, hipblasComplex* y, int incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_cswap((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_float_complex*)x,
+                                              incx,
+                                              (rocblas_float_complex*)y,
+                                              incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZswap(hipblasHandle_t       handle,
+                             int                   n,
+                             hipblasDoubleComplex* x,
+                             int                   incx,
+                             hipblasDoubleComplex* y,
+                             int                   incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_zswap((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_double_complex*)x,
+                                              incx,
+                                              (rocblas_double_complex*)y,
+                                              incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasCswap_v2(hipblasHandle_t handle, int n, hipComplex* x, int incx, hipComplex* y, int incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_cswap((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_float_complex*)x,
+                                              incx,
+                                              (rocblas_float_complex*)y,
+                                              incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZswap_v2(
+    hipblasHandle_t handle, int n, hipDoubleComplex* x, int incx, hipDoubleComplex* y, int incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_zswap((rocblas_handle)handle,
+                                              n,
+                                              (rocblas_double_complex*)x,
+                                              incx,
+                                              (rocblas_double_complex*)y,
+                                              incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// swap_64
+hipblasStatus_t hipblasSswap_64(
+    hipblasHandle_t handle, int64_t n, float* x, int64_t incx, float* y, int64_t incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_sswap_64((rocblas_handle)handle, n, x, incx, y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDswap_64(
+    hipblasHandle_t handle, int64_t n, double* x, int64_t incx, double* y, int64_t incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_dswap_64((rocblas_handle)handle, n, x, incx, y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCswap_64(hipblasHandle_t handle,
+                                int64_t         n,
+                                hipblasComplex* x,
+                                int64_t         incx,
+                                hipblasComplex* y,
+                                int64_t         incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_cswap_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_float_complex*)x,
+                                                 incx,
+                                                 (rocblas_float_complex*)y,
+                                                 incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZswap_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                hipblasDoubleComplex* x,
+                                int64_t               incx,
+                                hipblasDoubleComplex* y,
+                                int64_t               incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_zswap_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_double_complex*)x,
+                                                 incx,
+                                                 (rocblas_double_complex*)y,
+                                                 incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCswap_v2_64(
+    hipblasHandle_t handle, int64_t n, hipComplex* x, int64_t incx, hipComplex* y, int64_t incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_cswap_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_float_complex*)x,
+                                                 incx,
+                                                 (rocblas_float_complex*)y,
+                                                 incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZswap_v2_64(hipblasHandle_t   handle,
+                                   int64_t           n,
+                                   hipDoubleComplex* x,
+                                   int64_t           incx,
+                                   hipDoubleComplex* y,
+                                   int64_t           incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(rocblas_zswap_64((rocblas_handle)handle,
+                                                 n,
+                                                 (rocblas_double_complex*)x,
+                                                 incx,
+                                                 (rocblas_double_complex*)y,
+                                                 incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// swap_batched
+hipblasStatus_t hipblasSswapBatched(hipblasHandle_t handle,
+                                    int             n,
+                                    float* const    x[],
+                                    int             incx,
+                                    float* const    y[],
+                                    int             incy,
+                                    int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(
+        rocblas_sswap_batched((rocblas_handle)handle, n, x, incx, y, incy, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDswapBatched(hipblasHandle_t handle,
+                                    int             n,
+                                    double* const   x[],
+                                    int             incx,
+                                    double* const   y[],
+                                    int             incy,
+                                    int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(
+        rocblas_dswap_batched((rocblas_handle)handle, n, x, incx, y, incy, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCswapBatched(hipblasHandle_t       handle,
+                                    int                   n,
+                                    hipblasComplex* const x[],
+                                    int                   incx,
+                                    hipblasComplex* const y[],
+                                    int                   incy,
+                                    int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_cswap_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_float_complex**)x,
+                                                      incx,
+                                                      (rocblas_float_complex**)y,
+                                                      incy,
+                                                      batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZswapBatched(hipblasHandle_t             handle,
+                                    int                         n,
+                                    hipblasDoubleComplex* const x[],
+                                    int                         incx,
+                                    hipblasDoubleComplex* const y[],
+                                    int                         incy,
+                                    int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_zswap_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_double_complex**)x,
+                                                      incx,
+                                                      (rocblas_double_complex**)y,
+                                                      incy,
+                                                      batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCswapBatched_v2(hipblasHandle_t   handle,
+                                       int               n,
+                                       hipComplex* const x[],
+                                       int               incx,
+                                       hipComplex* const y[],
+                                       int               incy,
+                                       int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_cswap_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_float_complex**)x,
+                                                      incx,
+                                                      (rocblas_float_complex**)y,
+                                                      incy,
+                                                      batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZswapBatched_v2(hipblasHandle_t         handle,
+                                       int                     n,
+                                       hipDoubleComplex* const x[],
+                                       int                     incx,
+                                       hipDoubleComplex* const y[],
+                                       int                     incy,
+                                       int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_zswap_batched((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_double_complex**)x,
+                                                      incx,
+                                                      (rocblas_double_complex**)y,
+                                                      incy,
+                                                      batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// swap_batched_64
+hipblasStatus_t hipblasSswapBatched_64(hipblasHandle_t handle,
+                                       int64_t         n,
+                                       float* const    x[],
+                                       int64_t         incx,
+                                       float* const    y[],
+                                       int64_t         incy,
+                                       int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(
+        rocblas_sswap_batched_64((rocblas_handle)handle, n, x, incx, y, incy, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDswapBatched_64(hipblasHandle_t handle,
+                                       int64_t         n,
+                                       double* const   x[],
+                                       int64_t         incx,
+                                       double* const   y[],
+                                       int64_t         incy,
+                                       int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(
+        rocblas_dswap_batched_64((rocblas_handle)handle, n, x, incx, y, incy, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCswapBatched_64(hipblasHandle_t       handle,
+                                       int64_t               n,
+                                       hipblasComplex* const x[],
+                                       int64_t               incx,
+                                       hipblasComplex* const y[],
+                                       int64_t               incy,
+                                       int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_cswap_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_float_complex**)x,
+                                                         incx,
+                                                         (rocblas_float_complex**)y,
+                                                         incy,
+                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZswapBatched_64(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       hipblasDoubleComplex* const x[],
+                                       int64_t                     incx,
+                                       hipblasDoubleComplex* const y[],
+                                       int64_t                     incy,
+                                       int64_t                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_zswap_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_double_complex**)x,
+                                                         incx,
+                                                         (rocblas_double_complex**)y,
+                                                         incy,
+                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCswapBatched_v2_64(hipblasHandle_t   handle,
+                                          int64_t           n,
+                                          hipComplex* const x[],
+                                          int64_t           incx,
+                                          hipComplex* const y[],
+                                          int64_t           incy,
+                                          int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_cswap_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_float_complex**)x,
+                                                         incx,
+                                                         (rocblas_float_complex**)y,
+                                                         incy,
+                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZswapBatched_v2_64(hipblasHandle_t         handle,
+                                          int64_t                 n,
+                                          hipDoubleComplex* const x[],
+                                          int64_t                 incx,
+                                          hipDoubleComplex* const y[],
+                                          int64_t                 incy,
+                                          int64_t                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasConvertStatus(rocblas_zswap_batched_64((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_double_complex**)x,
+                                                         incx,
+                                                         (rocblas_double_complex**)y,
+                                                         incy,
+                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// swap_strided_batched
+hipblasStatus_t hipblasSswapStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           float*          x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           float*          y,
+                                           int             incy,
+                                           hipblasStride   stridey,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_sswap_strided_batched(
+        (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDswapStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           double*         x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           double*         y,
+                                           int             incy,
+                                           hipblasStride   stridey,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_dswap_strided_batched(
+        (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCswapStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           hipblasComplex* x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           hipblasComplex* y,
+                                           int             incy,
+                                           hipblasStride   stridey,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_cswap_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_float_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_float_complex*)y,
+                                                              incy,
+                                                              stridey,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZswapStridedBatched(hipblasHandle_t       handle,
+                                           int                   n,
+                                           hipblasDoubleComplex* x,
+                                           int                   incx,
+                                           hipblasStride         stridex,
+                                           hipblasDoubleComplex* y,
+                                           int                   incy,
+                                           hipblasStride         stridey,
+                                           int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_zswap_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_double_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_double_complex*)y,
+                                                              incy,
+                                                              stridey,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCswapStridedBatched_v2(hipblasHandle_t handle,
+                                              int             n,
+                                              hipComplex*     x,
+                                              int             incx,
+                                              hipblasStride   stridex,
+                                              hipComplex*     y,
+                                              int             incy,
+                                              hipblasStride   stridey,
+                                              int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_cswap_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_float_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_float_complex*)y,
+                                                              incy,
+                                                              stridey,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZswapStridedBatched_v2(hipblasHandle_t   handle,
+                                              int               n,
+                                              hipDoubleComplex* x,
+                                              int               incx,
+                                              hipblasStride     stridex,
+                                              hipDoubleComplex* y,
+                                              int               incy,
+                                              hipblasStride     stridey,
+                                              int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_zswap_strided_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_double_complex*)x,
+                                                              incx,
+                                                              stridex,
+                                                              (rocblas_double_complex*)y,
+                                                              incy,
+                                                              stridey,
+                                                              batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// swap_strided_batched_64
+hipblasStatus_t hipblasSswapStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              float*          x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              float*          y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_sswap_strided_batched_64(
+        (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDswapStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              double*         x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              double*         y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_dswap_strided_batched_64(
+        (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCswapStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              hipblasComplex* x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              hipblasComplex* y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_cswap_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_float_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_float_complex*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZswapStridedBatched_64(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              hipblasDoubleComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              hipblasDoubleComplex* y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_zswap_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_double_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_double_complex*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCswapStridedBatched_v2_64(hipblasHandle_t handle,
+                                                 int64_t         n,
+                                                 hipComplex*     x,
+                                                 int64_t         incx,
+                                                 hipblasStride   stridex,
+                                                 hipComplex*     y,
+                                                 int64_t         incy,
+                                                 hipblasStride   stridey,
+                                                 int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_cswap_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_float_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_float_complex*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZswapStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                 int64_t           n,
+                                                 hipDoubleComplex* x,
+                                                 int64_t           incx,
+                                                 hipblasStride     stridex,
+                                                 hipDoubleComplex* y,
+                                                 int64_t           incy,
+                                                 hipblasStride     stridey,
+                                                 int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasConvertStatus(rocblas_zswap_strided_batched_64((rocblas_handle)handle,
+                                                                 n,
+                                                                 (rocblas_double_complex*)x,
+                                                                 incx,
+                                                                 stridex,
+                                                                 (rocblas_double_complex*)y,
+                                                                 incy,
+                                                                 stridey,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+} // extern "C"
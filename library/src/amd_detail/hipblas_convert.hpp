@@ -0,0 +1,317 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+#include "hipblas_backend.hpp"
+#include "hipblas_entry.hpp"
+
+#include <hip/library_types.h>
+
+// Conversions between the enums of hipBLAS and rocBLAS.
+//
+// The conversions don't throw, so they can be inlined into each entry point. An invalid enum is
+// converted to a value that rocBLAS rejects, and its status, usually HIPBLAS_STATUS_INVALID_ENUM,
+// is kept for the calling thread. hipblasConvertStatus returns a kept status in place of the
+// status of the rocBLAS call, so an entry point of the form
+//
+//     return hipblasConvertStatus(rocblas_xxx(..., hipblasConvertOperation(trans), ...));
+//
+// returns HIPBLAS_STATUS_INVALID_ENUM for an invalid trans. An entry point that doesn't pass
+// the converted value to rocBLAS checks hipblasTakeEnumStatus itself. The status is that of the
+// call, hipblas_enum_status, which HIPBLAS_ENTRY clears and restores, so a call that returns
+// before checking it doesn't leave it to the next call on the thread.
+
+// Keeps status for the calling thread, the first one if there are several
+[[gnu::cold, gnu::noinline]] inline void hipblasSetEnumStatus(hipblasStatus_t status) noexcept
+{
+    if(hipblas_enum_status == HIPBLAS_STATUS_SUCCESS)
+        hipblas_enum_status = status;
+}
+
+// Returns and clears the status kept for the calling thread
+inline hipblasStatus_t hipblasTakeEnumStatus() noexcept
+{
+    hipblasStatus_t status = hipblas_enum_status;
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        hipblas_enum_status = HIPBLAS_STATUS_SUCCESS;
+    return status;
+}
+
+// op, fill, diag and side have the same values in hipBLAS and rocBLAS, so they are converted by
+// a range check
+static_assert(int(HIPBLAS_OP_N) == int(rocblas_operation_none)
+              && int(HIPBLAS_OP_T) == int(rocblas_operation_transpose)
+              && int(HIPBLAS_OP_C) == int(rocblas_operation_conjugate_transpose));
+static_assert(int(HIPBLAS_FILL_MODE_UPPER) == int(rocblas_fill_upper)
+              && int(HIPBLAS_FILL_MODE_LOWER) == int(rocblas_fill_lower)
+              && int(HIPBLAS_FILL_MODE_FULL) == int(rocblas_fill_full));
+static_assert(int(HIPBLAS_DIAG_NON_UNIT) == int(rocblas_diagonal_non_unit)
+              && int(HIPBLAS_DIAG_UNIT) == int(rocblas_diagonal_unit));
+static_assert(int(HIPBLAS_SIDE_LEFT) == int(rocblas_side_left)
+              && int(HIPBLAS_SIDE_RIGHT) == int(rocblas_side_right)
+              && int(HIPBLAS_SIDE_BOTH) == int(rocblas_side_both));
+
+template <typename To, typename From>
+constexpr To hipblasConvertRange(From value, From first, From last) noexcept
+{
+    if(value >= first && value <= last)
+        return To(value);
+    hipblasSetEnumStatus(HIPBLAS_STATUS_INVALID_ENUM);
+    return To(0);
+}
+
+constexpr rocblas_operation hipblasConvertOperation(hipblasOperation_t op) noexcept
+{
+    return hipblasConvertRange<rocblas_operation>(op, HIPBLAS_OP_N, HIPBLAS_OP_C);
+}
+
+constexpr rocblas_fill hipblasConvertFill(hipblasFillMode_t fill) noexcept
+{
+    return hipblasConvertRange<rocblas_fill>(
+        fill, HIPBLAS_FILL_MODE_UPPER, HIPBLAS_FILL_MODE_FULL);
+}
+
+constexpr rocblas_diagonal hipblasConvertDiag(hipblasDiagType_t diagonal) noexcept
+{
+    return hipblasConvertRange<rocblas_diagonal>(
+        diagonal, HIPBLAS_DIAG_NON_UNIT, HIPBLAS_DIAG_UNIT);
+}
+
+constexpr rocblas_side hipblasConvertSide(hipblasSideMode_t side) noexcept
+{
+    return hipblasConvertRange<rocblas_side>(side, HIPBLAS_SIDE_LEFT, HIPBLAS_SIDE_BOTH);
+}
+
+constexpr rocblas_pointer_mode hipblasGetRocblasPointerMode(hipblasPointerMode_t mode) noexcept
+{
+    switch(mode)
+    {
+    case HIPBLAS_POINTER_MODE_HOST:
+        return rocblas_pointer_mode_host;
+    case HIPBLAS_POINTER_MODE_DEVICE:
+        return rocblas_pointer_mode_device;
+    }
+    hipblasSetEnumStatus(HIPBLAS_STATUS_INVALID_ENUM);
+    return rocblas_pointer_mode_host;
+}
+
+constexpr hipblasPointerMode_t hipblasConvertPointerMode(rocblas_pointer_mode mode) noexcept
+{
+    switch(mode)
+    {
+    case rocblas_pointer_mode_host:
+        return HIPBLAS_POINTER_MODE_HOST;
+    case rocblas_pointer_mode_device:
+        return HIPBLAS_POINTER_MODE_DEVICE;
+    }
+    hipblasSetEnumStatus(HIPBLAS_STATUS_INVALID_ENUM);
+    return HIPBLAS_POINTER_MODE_HOST;
+}
+
+constexpr rocblas_datatype hipblasConvertDatatype_v2(hipDataType type) noexcept
+{
+    switch(type)
+    {
+    case HIP_R_16F:
+        return rocblas_datatype_f16_r;
+    case HIP_R_32F:
+        return rocblas_datatype_f32_r;
+    case HIP_R_64F:
+        return rocblas_datatype_f64_r;
+    case HIP_C_16F:
+        return rocblas_datatype_f16_c;
+    case HIP_C_32F:
+        return rocblas_datatype_f32_c;
+    case HIP_C_64F:
+        return rocblas_datatype_f64_c;
+    case HIP_R_8I:
+        return rocblas_datatype_i8_r;
+    case HIP_R_8U:
+        return rocblas_datatype_u8_r;
+    case HIP_R_32I:
+        return rocblas_datatype_i32_r;
+    case HIP_R_32U:
+        return rocblas_datatype_u32_r;
+    case HIP_C_8I:
+        return rocblas_datatype_i8_c;
+    case HIP_C_8U:
+        return rocblas_datatype_u8_c;
+    case HIP_C_32I:
+        return rocblas_datatype_i32_c;
+    case HIP_C_32U:
+        return rocblas_datatype_u32_c;
+    case HIP_R_16BF:
+        return rocblas_datatype_bf16_r;
+    case HIP_C_16BF:
+        return rocblas_datatype_bf16_c;
+    case HIP_R_8F_E4M3_FNUZ:
+        return rocblas_datatype_f8_r;
+    case HIP_R_8F_E5M2_FNUZ:
+        return rocblas_datatype_bf8_r;
+    default:
+        hipblasSetEnumStatus(HIPBLAS_STATUS_INVALID_ENUM);
+        return rocblas_datatype_invalid;
+    }
+}
+
+constexpr rocblas_datatype hipblasConvertDatatype(hipblasDatatype_t type) noexcept
+{
+    switch(type)
+    {
+    case HIPBLAS_R_16F:
+        return rocblas_datatype_f16_r;
+    case HIPBLAS_R_32F:
+        return rocblas_datatype_f32_r;
+    case HIPBLAS_R_64F:
+        return rocblas_datatype_f64_r;
+    case HIPBLAS_C_16F:
+        return rocblas_datatype_f16_c;
+    case HIPBLAS_C_32F:
+        return rocblas_datatype_f32_c;
+    case HIPBLAS_C_64F:
+        return rocblas_datatype_f64_c;
+    case HIPBLAS_R_8I:
+        return rocblas_datatype_i8_r;
+    case HIPBLAS_R_8U:
+        return rocblas_datatype_u8_r;
+    case HIPBLAS_R_32I:
+        return rocblas_datatype_i32_r;
+    case HIPBLAS_R_32U:
+        return rocblas_datatype_u32_r;
+    case HIPBLAS_C_8I:
+        return rocblas_datatype_i8_c;
+    case HIPBLAS_C_8U:
+        return rocblas_datatype_u8_c;
+    case HIPBLAS_C_32I:
+        return rocblas_datatype_i32_c;
+    case HIPBLAS_C_32U:
+        return rocblas_datatype_u32_c;
+    case HIPBLAS_R_16B:
+        return rocblas_datatype_bf16_r;
+    case HIPBLAS_C_16B:
+        return rocblas_datatype_bf16_c;
+    default:
+        hipblasSetEnumStatus(HIPBLAS_STATUS_INVALID_ENUM);
+        return rocblas_datatype_invalid;
+    }
+}
+
+constexpr rocblas_gemm_algo hipblasConvertGemmAlgo(hipblasGemmAlgo_t algo) noexcept
+{
+    if(algo == HIPBLAS_GEMM_DEFAULT)
+        return rocblas_gemm_algo_standard;
+    hipblasSetEnumStatus(HIPBLAS_STATUS_INVALID_ENUM);
+    return rocblas_gemm_algo(-1);
+}
+
+// rocBLAS has no invalid value for the gemm flags, so an entry point checks
+// hipblasTakeEnumStatus after converting them, before it runs a gemm with no flags
+constexpr rocblas_gemm_flags hipblasConvertGemmFlags(hipblasGemmFlags_t flags) noexcept
+{
+    switch(flags)
+    {
+    case HIPBLAS_GEMM_FLAGS_NONE:
+        return rocblas_gemm_flags_none;
+    case HIPBLAS_GEMM_FLAGS_USE_CU_EFFICIENCY:
+        return rocblas_gemm_flags_use_cu_efficiency;
+    case HIPBLAS_GEMM_FLAGS_FP16_ALT_IMPL:
+        return rocblas_gemm_flags_fp16_alt_impl;
+    case HIPBLAS_GEMM_FLAGS_CHECK_SOLUTION_INDEX:
+        return rocblas_gemm_flags_check_solution_index;
+    case HIPBLAS_GEMM_FLAGS_FP16_ALT_IMPL_RNZ:
+        return rocblas_gemm_flags_fp16_alt_impl_rnz;
+    default:
+        hipblasSetEnumStatus(HIPBLAS_STATUS_INVALID_ENUM);
+        return rocblas_gemm_flags_none;
+    }
+}
+
+constexpr rocblas_atomics_mode hipblasConvertAtomicsMode(hipblasAtomicsMode_t mode) noexcept
+{
+    switch(mode)
+    {
+    case HIPBLAS_ATOMICS_NOT_ALLOWED:
+        return rocblas_atomics_not_allowed;
+    case HIPBLAS_ATOMICS_ALLOWED:
+        return rocblas_atomics_allowed;
+    }
+    hipblasSetEnumStatus(HIPBLAS_STATUS_INVALID_ENUM);
+    return rocblas_atomics_not_allowed;
+}
+
+constexpr rocblas_math_mode hipblasGetRocblasMathMode(hipblasMath_t mode) noexcept
+{
+    switch(mode)
+    {
+    case HIPBLAS_DEFAULT_MATH:
+        return rocblas_default_math;
+    case HIPBLAS_XF32_XDL_MATH:
+        return rocblas_xf32_xdl_math_op;
+    }
+    hipblasSetEnumStatus(HIPBLAS_STATUS_NOT_SUPPORTED);
+    return rocblas_default_math;
+}
+
+constexpr hipblasMath_t hipblasConvertMathMode(rocblas_math_mode mode) noexcept
+{
+    switch(mode)
+    {
+    case rocblas_default_math:
+        return HIPBLAS_DEFAULT_MATH;
+    case rocblas_xf32_xdl_math_op:
+        return HIPBLAS_XF32_XDL_MATH;
+    }
+    hipblasSetEnumStatus(HIPBLAS_STATUS_INVALID_ENUM);
+    return HIPBLAS_DEFAULT_MATH;
+}
+
+inline hipblasStatus_t hipblasConvertStatus(rocblas_status_ error) noexcept
+{
+    if(hipblas_enum_status != HIPBLAS_STATUS_SUCCESS)
+        return hipblasTakeEnumStatus();
+
+    switch(error)
+    {
+    case rocblas_status_size_unchanged:
+    case rocblas_status_size_increased:
+    case rocblas_status_success:
+        return HIPBLAS_STATUS_SUCCESS;
+    case rocblas_status_invalid_handle:
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    case rocblas_status_not_implemented:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    case rocblas_status_invalid_pointer:
+    case rocblas_status_invalid_size:
+    case rocblas_status_invalid_value:
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    case rocblas_status_memory_error:
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    case rocblas_status_internal_error:
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    case rocblas_status_arch_mismatch:
+        return HIPBLAS_STATUS_ARCH_MISMATCH;
+    default:
+        return HIPBLAS_STATUS_UNKNOWN;
+    }
+}
@@ -0,0 +1,7645 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas_internal.hpp"
+
+// Reports solution index 0 (the rocBLAS default heuristic) followed by the solutions found by
+// a rocBLAS *_get_solutions query, with the in/out count semantics of hipblasGemmExGetSolutions.
+template <typename GetSolutions>
+static hipblasStatus_t
+    hipblasGetGemmSolutions(int* solutionList, int* solutionCount, GetSolutions&& get_solutions)
+{
+    if(!solutionCount)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    rocblas_int    available = 0;
+    rocblas_status status    = get_solutions(nullptr, &available);
+    if(status != rocblas_status_success)
+        return hipblasConvertStatus(status);
+
+    if(!solutionList)
+    {
+        *solutionCount = available + 1;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    if(*solutionCount <= 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    rocblas_int size = std::min(available, *solutionCount - 1);
+    if(size > 0)
+    {
+        status = get_solutions(solutionList + 1, &size);
+        if(status != rocblas_status_success)
+            return hipblasConvertStatus(status);
+    }
+
+    solutionList[0] = 0;
+    *solutionCount  = size + 1;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Size of the alpha and beta of a rocBLAS gemm_ex computing in compute_type
+static size_t hipblasGemmScalarSize(rocblas_datatype compute_type)
+{
+    switch(compute_type)
+    {
+    case rocblas_datatype_f16_r:
+        return 2;
+    case rocblas_datatype_f64_r:
+    case rocblas_datatype_f32_c:
+        return 8;
+    case rocblas_datatype_f64_c:
+        return 16;
+    default:
+        return 4;
+    }
+}
+
+#ifdef __HIP_PLATFORM_HIPBLASLT__
+// Sets the stream, pointer mode and scale type of a hipBLASLt gemm on handle. hipBLASLt has no
+// complex gemm, and op C is op T on real types.
+static hipblasStatus_t hipblasLtGemmSetup(hipblasHandle_t    handle,
+                                          hipblasLtGemmArgs& args,
+                                          rocblas_datatype   compute_type)
+{
+    switch(compute_type)
+    {
+    case rocblas_datatype_f16_r:
+        args.scale_type = HIP_R_16F;
+        break;
+    case rocblas_datatype_f32_r:
+        args.scale_type = HIP_R_32F;
+        break;
+    case rocblas_datatype_f64_r:
+        args.scale_type = HIP_R_64F;
+        break;
+    case rocblas_datatype_i32_r:
+        args.scale_type = HIP_R_32I;
+        break;
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    rocblas_pointer_mode pointer_mode;
+    rocblas_status       status = rocblas_get_stream((rocblas_handle)handle, &args.stream);
+    if(status == rocblas_status_success)
+        status = rocblas_get_pointer_mode((rocblas_handle)handle, &pointer_mode);
+    if(status != rocblas_status_success)
+        return hipblasConvertStatus(status);
+
+    args.device_scalars = pointer_mode == rocblas_pointer_mode_device;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+#endif
+
+// The workspace of the gemms computed with hipBLASLt in HIPBLAS_GEMM_BACKEND_LT mode
+static constexpr size_t hipblas_lt_workspace_size = size_t(4) << 20;
+
+// hipblasGemmEx and hipblasGemmStridedBatchedEx in HIPBLAS_GEMM_BACKEND_LT mode, computed with
+// hipBLASLt when it has an algorithm for the problem. Returns HIPBLAS_STATUS_NOT_SUPPORTED, for
+// the call to go to rocBLAS, in the default mode, for invalid arguments and empty problems, and
+// for the problems hipBLASLt doesn't take.
+static hipblasStatus_t hipblasLtRoutedGemmEx(hipblasHandle_t    handle,
+                                             hipblasOperation_t transa,
+                                             hipblasOperation_t transb,
+                                             int                m,
+                                             int                n,
+                                             int                k,
+                                             const void*        alpha,
+                                             const void*        A,
+                                             hipDataType        a_type,
+                                             int                lda,
+                                             hipblasStride      stride_a,
+                                             const void*        B,
+                                             hipDataType        b_type,
+                                             int                ldb,
+                                             hipblasStride      stride_b,
+                                             const void*        beta,
+                                             void*              C,
+                                             hipDataType        c_type,
+                                             int                ldc,
+                                             hipblasStride      stride_c,
+                                             int                batch_count,
+                                             rocblas_datatype   compute_type)
+{
+    if(!hipblasIsGemmBackendLt(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+#ifdef __HIP_PLATFORM_HIPBLASLT__
+    for(hipblasOperation_t trans : {transa, transb})
+    {
+        if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    int a_rows = transa == HIPBLAS_OP_N ? m : k;
+    int b_rows = transb == HIPBLAS_OP_N ? k : n;
+    if(m <= 0 || n <= 0 || k <= 0 || batch_count <= 0 || lda < a_rows || ldb < b_rows || ldc < m
+       || !alpha || !beta || !A || !B || !C)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblasLtGemmArgs args;
+    if(hipblasLtGemmSetup(handle, args, compute_type) != HIPBLAS_STATUS_SUCCESS)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    args.trans_a        = transa != HIPBLAS_OP_N;
+    args.trans_b        = transb != HIPBLAS_OP_N;
+    args.m              = m;
+    args.n              = n;
+    args.k              = k;
+    args.alpha          = alpha;
+    args.A              = A;
+    args.a_type         = a_type;
+    args.lda            = lda;
+    args.stride_a       = stride_a;
+    args.B              = B;
+    args.b_type         = b_type;
+    args.ldb            = ldb;
+    args.stride_b       = stride_b;
+    args.beta           = beta;
+    args.C              = C;
+    args.c_type         = c_type;
+    args.ldc            = ldc;
+    args.stride_c       = stride_c;
+    args.batch_count    = batch_count;
+    args.cache_algo     = true;
+    args.workspace      = hipblasGetScratch(handle, hipblas_lt_workspace_size, args.stream);
+    args.workspace_size = args.workspace ? hipblas_lt_workspace_size : 0;
+    return hipblasStatus_t(hipblasLtGemm(args));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+// hipblasGemmExWithScales and hipblasGemmStridedBatchedExWithScales, computed with hipBLASLt
+static hipblasStatus_t hipblasGemmExWithScalesImpl(hipblasHandle_t      handle,
+                                                   hipblasOperation_t   transa,
+                                                   hipblasOperation_t   transb,
+                                                   int                  m,
+                                                   int                  n,
+                                                   int                  k,
+                                                   const void*          alpha,
+                                                   const void*          A,
+                                                   hipDataType          a_type,
+                                                   int                  lda,
+                                                   hipblasStride        stride_a,
+                                                   const void*          B,
+                                                   hipDataType          b_type,
+                                                   int                  ldb,
+                                                   hipblasStride        stride_b,
+                                                   const void*          beta,
+                                                   void*                C,
+                                                   hipDataType          c_type,
+                                                   int                  ldc,
+                                                   hipblasStride        stride_c,
+                                                   int                  batch_count,
+                                                   hipblasComputeType_t compute_type,
+                                                   const float*         scale_a,
+                                                   const float*         scale_b,
+                                                   const float*         scale_d,
+                                                   float*               amax_d)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // the scaling factors are only defined for FP8 inputs
+    for(rocblas_datatype type : {a_type_roc, b_type_roc})
+    {
+        if(type != rocblas_datatype_f8_r && type != rocblas_datatype_bf8_r)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    for(hipblasOperation_t trans : {transa, transb})
+    {
+        if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+    }
+
+    int a_rows = transa == HIPBLAS_OP_N ? m : k;
+    int b_rows = transb == HIPBLAS_OP_N ? k : n;
+    if(m < 0 || n < 0 || k < 0 || batch_count < 0 || lda < a_rows || ldb < b_rows || ldc < m)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    if(!m || !n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    if(!alpha || !beta || !C)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+#ifdef __HIP_PLATFORM_HIPBLASLT__
+    hipblasLtGemmArgs args;
+    status = hipblasLtGemmSetup(handle, args, compute_type_roc);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    args.trans_a     = transa != HIPBLAS_OP_N;
+    args.trans_b     = transb != HIPBLAS_OP_N;
+    args.m           = m;
+    args.n           = n;
+    args.k           = k;
+    args.alpha       = alpha;
+    args.A           = A;
+    args.a_type      = a_type;
+    args.lda         = lda;
+    args.stride_a    = stride_a;
+    args.B           = B;
+    args.b_type      = b_type;
+    args.ldb         = ldb;
+    args.stride_b    = stride_b;
+    args.beta        = beta;
+    args.C           = C;
+    args.c_type      = c_type;
+    args.ldc         = ldc;
+    args.stride_c    = stride_c;
+    args.batch_count = batch_count;
+    args.scale_a     = scale_a;
+    args.scale_b     = scale_b;
+    args.scale_d     = scale_d;
+    args.amax_d      = amax_d;
+    return hipblasStatus_t(hipblasLtGemm(args));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+// hipblasGemmExWithDiagonalScales with hipBLASLt, see hipblas_gemm_diagonal_scales.hpp
+hipblasStatus_t hipblasLtGemmDiagonalScales(hipblasHandle_t      handle,
+                                            hipblasOperation_t   transa,
+                                            hipblasOperation_t   transb,
+                                            int                  m,
+                                            int                  n,
+                                            int                  k,
+                                            const void*          alpha,
+                                            const void*          A,
+                                            hipDataType          a_type,
+                                            int                  lda,
+                                            const void*          B,
+                                            hipDataType          b_type,
+                                            int                  ldb,
+                                            const void*          beta,
+                                            void*                C,
+                                            hipDataType          c_type,
+                                            int                  ldc,
+                                            hipblasComputeType_t compute_type,
+                                            const float*         row_scale,
+                                            const float*         col_scale)
+{
+#ifdef __HIP_PLATFORM_HIPBLASLT__
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblasLtGemmArgs args;
+    if(hipblasLtGemmSetup(handle, args, compute_type_roc) != HIPBLAS_STATUS_SUCCESS)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    args.trans_a          = transa != HIPBLAS_OP_N;
+    args.trans_b          = transb != HIPBLAS_OP_N;
+    args.m                = m;
+    args.n                = n;
+    args.k                = k;
+    args.alpha            = alpha;
+    args.A                = A;
+    args.a_type           = a_type;
+    args.lda              = lda;
+    args.B                = B;
+    args.b_type           = b_type;
+    args.ldb              = ldb;
+    args.beta             = beta;
+    args.C                = C;
+    args.c_type           = c_type;
+    args.ldc              = ldc;
+    args.scale_a          = row_scale;
+    args.scale_b          = col_scale;
+    args.outer_vec_scales = true;
+
+    // a scale mode or type combination this hipBLASLt doesn't have is left to the fallback
+    status = hipblasStatus_t(hipblasLtGemm(args));
+    return status == HIPBLAS_STATUS_INVALID_VALUE ? HIPBLAS_STATUS_NOT_SUPPORTED : status;
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+// rocBLAS has no grouped gemm, so hipblasGemmGroupedBatchedEx runs one batched gemm per group,
+// which launches once per group rather than once per problem. Consecutive groups of the same
+// problem with the same host scalars, as when a caller splits a batch, run as one batched gemm.
+template <typename T_INT>
+static hipblasStatus_t hipblasGemmGroupedBatchedExImpl(hipblasHandle_t          handle,
+                                                       const hipblasOperation_t transa_array[],
+                                                       const hipblasOperation_t transb_array[],
+                                                       const T_INT              m_array[],
+                                                       const T_INT              n_array[],
+                                                       const T_INT              k_array[],
+                                                       const void*              alpha_array,
+                                                       const void* const        A_array[],
+                                                       hipDataType              a_type,
+                                                       const T_INT              lda_array[],
+                                                       const void* const        B_array[],
+                                                       hipDataType              b_type,
+                                                       const T_INT              ldb_array[],
+                                                       const void*              beta_array,
+                                                       void* const              C_array[],
+                                                       hipDataType              c_type,
+                                                       const T_INT              ldc_array[],
+                                                       T_INT                    group_count,
+                                                       const T_INT              group_size[],
+                                                       hipblasComputeType_t     compute_type)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(group_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!group_count)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!transa_array || !transb_array || !m_array || !n_array || !k_array || !lda_array
+       || !ldb_array || !ldc_array || !group_size || !alpha_array || !beta_array)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasFastComputeScope fast_compute(handle, compute_type);
+
+    // all groups are checked first, so that an invalid group doesn't leave the groups before it
+    // computed
+    for(T_INT g = 0; g < group_count; g++)
+    {
+        for(hipblasOperation_t trans : {transa_array[g], transb_array[g]})
+        {
+            if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+                return HIPBLAS_STATUS_INVALID_ENUM;
+        }
+
+        T_INT a_rows = transa_array[g] == HIPBLAS_OP_N ? m_array[g] : k_array[g];
+        T_INT b_rows = transb_array[g] == HIPBLAS_OP_N ? k_array[g] : n_array[g];
+        if(m_array[g] < 0 || n_array[g] < 0 || k_array[g] < 0 || group_size[g] < 0
+           || lda_array[g] < a_rows || ldb_array[g] < b_rows || ldc_array[g] < m_array[g])
+            return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    rocblas_pointer_mode pointer_mode;
+    rocblas_status blas_status = rocblas_get_pointer_mode((rocblas_handle)handle, &pointer_mode);
+    if(blas_status != rocblas_status_success)
+        return hipblasConvertStatus(blas_status);
+
+    size_t      scalar_size = hipblasGemmScalarSize(compute_type_roc);
+    const char* alpha       = static_cast<const char*>(alpha_array);
+    const char* beta        = static_cast<const char*>(beta_array);
+
+    // device scalars can't be compared, so groups only merge in host pointer mode
+    auto same_problem = [&](T_INT g, T_INT h) {
+        return pointer_mode == rocblas_pointer_mode_host && transa_array[g] == transa_array[h]
+               && transb_array[g] == transb_array[h] && m_array[g] == m_array[h]
+               && n_array[g] == n_array[h] && k_array[g] == k_array[h]
+               && lda_array[g] == lda_array[h] && ldb_array[g] == ldb_array[h]
+               && ldc_array[g] == ldc_array[h]
+               && !memcmp(alpha + g * scalar_size, alpha + h * scalar_size, scalar_size)
+               && !memcmp(beta + g * scalar_size, beta + h * scalar_size, scalar_size);
+    };
+
+    int64_t offset = 0;
+    for(T_INT g = 0; g < group_count;)
+    {
+        T_INT batch_count = group_size[g];
+        T_INT next        = g + 1;
+        for(; next < group_count && same_problem(g, next)
+              && batch_count <= std::numeric_limits<T_INT>::max() - group_size[next];
+            next++)
+            batch_count += group_size[next];
+
+        if(batch_count)
+        {
+            status = hipblasConvertStatus(
+                hipblasTunedGemmBatchedEx<T_INT>((rocblas_handle)handle,
+                                                 hipblasConvertOperation(transa_array[g]),
+                                                 hipblasConvertOperation(transb_array[g]),
+                                                 m_array[g],
+                                                 n_array[g],
+                                                 k_array[g],
+                                                 alpha + g * scalar_size,
+                                                 A_array ? A_array + offset : nullptr,
+                                                 a_type_roc,
+                                                 lda_array[g],
+                                                 B_array ? B_array + offset : nullptr,
+                                                 b_type_roc,
+                                                 ldb_array[g],
+                                                 beta + g * scalar_size,
+                                                 (void*)(C_array ? C_array + offset : nullptr),
+                                                 c_type_roc,
+                                                 ldc_array[g],
+                                                 batch_count,
+                                                 compute_type_roc,
+                                                 rocblas_gemm_algo_standard,
+                                                 rocblas_gemm_flags_none));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+
+        offset += batch_count;
+        g = next;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+extern "C" {
+
+// gemm_ex
+hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
+                              hipblasOperation_t transa,
+                              hipblasOperation_t transb,
+                              int                m,
+                              int                n,
+                              int                k,
+                              const void*        alpha,
+                              const void*        A,
+                              hipblasDatatype_t  a_type,
+                              int                lda,
+                              const void*        B,
+                              hipblasDatatype_t  b_type,
+                              int                ldb,
+                              const void*        beta,
+                              void*              C,
+                              hipblasDatatype_t  c_type,
+                              int                ldc,
+                              hipblasDatatype_t  compute_type,
+                              hipblasGemmAlgo_t  algo)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, transa, transb, m, n, k, a_type, lda, b_type, ldb, c_type, ldc, compute_type, algo);
+
+    rocblas_gemm_flags flags = rocblas_gemm_flags_none;
+
+    return hipblasConvertStatus(hipblasTunedGemmEx<int>((rocblas_handle)handle,
+                                                        hipblasConvertOperation(transa),
+                                                        hipblasConvertOperation(transb),
+                                                        m,
+                                                        n,
+                                                        k,
+                                                        alpha,
+                                                        A,
+                                                        hipblasConvertDatatype(a_type),
+                                                        lda,
+                                                        B,
+                                                        hipblasConvertDatatype(b_type),
+                                                        ldb,
+                                                        beta,
+                                                        C,
+                                                        hipblasConvertDatatype(c_type),
+                                                        ldc,
+                                                        hipblasConvertDatatype(compute_type),
+                                                        hipblasConvertGemmAlgo(algo),
+                                                        flags));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasInternalGemmExTypes(hipDataType          a_in,
+                                           hipDataType          b_in,
+                                           hipDataType          c_in,
+                                           hipblasComputeType_t compute_in,
+                                           rocblas_datatype&    a_out,
+                                           rocblas_datatype&    b_out,
+                                           rocblas_datatype&    c_out,
+                                           rocblas_datatype&    compute_out)
+{
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    if(a_in == HIP_R_16F && b_in == HIP_R_16F && c_in == HIP_R_16F
+       && compute_in == HIPBLAS_COMPUTE_16F)
+    {
+        a_out = b_out = c_out = hipblasConvertDatatype_v2(a_in);
+        // HIPBLAS_COMPUTE_16F specifies at least 16-bits for compute so we could use f32_r here, but would
+        // introduce some overhead with scalars. Leaving it to rocBLAS to choose hpa when possible.
+        compute_out = rocblas_datatype_f16_r;
+    }
+    else if(a_in == HIP_R_16F && b_in == HIP_R_16F && c_in == HIP_R_16F
+            && compute_in == HIPBLAS_COMPUTE_32F)
+    {
+        a_out = b_out = c_out = rocblas_datatype_f16_r;
+        compute_out           = rocblas_datatype_f32_r;
+    }
+    else if(a_in == HIP_R_16F && b_in == HIP_R_16F && c_in == HIP_R_32F
+            && compute_in == HIPBLAS_COMPUTE_32F)
+    {
+        a_out = b_out = rocblas_datatype_f16_r;
+        c_out         = rocblas_datatype_f32_r;
+        compute_out   = rocblas_datatype_f32_r;
+    }
+    else if(a_in == HIP_R_16BF && b_in == HIP_R_16BF && c_in == HIP_R_16BF
+            && compute_in == HIPBLAS_COMPUTE_32F)
+    {
+        a_out = b_out = c_out = rocblas_datatype_bf16_r;
+        compute_out           = rocblas_datatype_f32_r;
+    }
+    else if(a_in == HIP_R_16BF && b_in == HIP_R_16BF && c_in == HIP_R_32F
+            && compute_in == HIPBLAS_COMPUTE_32F)
+    {
+        a_out = b_out = rocblas_datatype_bf16_r;
+        c_out         = rocblas_datatype_f32_r;
+        compute_out   = rocblas_datatype_f32_r;
+    }
+    else if(a_in == HIP_R_32F && b_in == HIP_R_32F && c_in == HIP_R_32F
+            && (compute_in == HIPBLAS_COMPUTE_32F || hipblasIsFastCompute32F(compute_in)))
+    {
+        // the fast compute types are f32 computed in the xf32 math mode, see
+        // hipblasFastComputeScope
+        a_out = b_out = c_out = compute_out = rocblas_datatype_f32_r;
+    }
+    else if(a_in == HIP_R_64F && b_in == HIP_R_64F && c_in == HIP_R_64F
+            && compute_in == HIPBLAS_COMPUTE_64F)
+    {
+        a_out = b_out = c_out = compute_out = rocblas_datatype_f64_r;
+    }
+    else if(a_in == HIP_R_8I && b_in == HIP_R_8I && c_in == HIP_R_32I
+            && compute_in == HIPBLAS_COMPUTE_32I)
+    {
+        a_out = b_out = rocblas_datatype_i8_r;
+        c_out = compute_out = rocblas_datatype_i32_r;
+    }
+    else if((a_in == HIP_R_8F_E4M3_FNUZ || a_in == HIP_R_8F_E5M2_FNUZ)
+            && (b_in == HIP_R_8F_E4M3_FNUZ || b_in == HIP_R_8F_E5M2_FNUZ)
+            && (c_in == HIP_R_32F || c_in == HIP_R_16F || c_in == HIP_R_16BF
+                || c_in == HIP_R_8F_E4M3_FNUZ || c_in == HIP_R_8F_E5M2_FNUZ)
+            && compute_in == HIPBLAS_COMPUTE_32F)
+    {
+        // FP8 inputs are accumulated in f32, see rocblas_gemm_ex3
+        a_out       = hipblasConvertDatatype_v2(a_in);
+        b_out       = hipblasConvertDatatype_v2(b_in);
+        c_out       = hipblasConvertDatatype_v2(c_in);
+        compute_out = rocblas_datatype_f32_r;
+    }
+    else if(a_in == HIP_C_32F && b_in == HIP_C_32F && c_in == HIP_C_32F
+            && (compute_in == HIPBLAS_COMPUTE_32F || hipblasIsFastCompute32F(compute_in)))
+    {
+        a_out = b_out = c_out = compute_out = rocblas_datatype_f32_c;
+    }
+    else if(a_in == HIP_C_64F && b_in == HIP_C_64F && c_in == HIP_C_64F
+            && compute_in == HIPBLAS_COMPUTE_64F)
+    {
+        a_out = b_out = c_out = compute_out = rocblas_datatype_f64_c;
+    }
+    else
+    {
+        status = HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+    return status;
+}
+
+hipblasStatus_t hipblasGemmEx_v2(hipblasHandle_t      handle,
+                                 hipblasOperation_t   transa,
+                                 hipblasOperation_t   transb,
+                                 int                  m,
+                                 int                  n,
+                                 int                  k,
+                                 const void*          alpha,
+                                 const void*          A,
+                                 hipDataType          a_type,
+                                 int                  lda,
+                                 const void*          B,
+                                 hipDataType          b_type,
+                                 int                  ldb,
+                                 const void*          beta,
+                                 void*                C,
+                                 hipDataType          c_type,
+                                 int                  ldc,
+                                 hipblasComputeType_t compute_type,
+                                 hipblasGemmAlgo_t    algo)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, transa, transb, m, n, k, a_type, lda, b_type, ldb, c_type, ldc, compute_type, algo);
+    hipblasPrefetchGemm(handle,
+                        transa,
+                        transb,
+                        m,
+                        n,
+                        k,
+                        A,
+                        lda,
+                        0,
+                        B,
+                        ldb,
+                        0,
+                        C,
+                        ldc,
+                        0,
+                        1,
+                        hipblasPrefetchTypeSize(a_type),
+                        hipblasPrefetchTypeSize(b_type),
+                        hipblasPrefetchTypeSize(c_type));
+
+    hipblasStatus_t rounded = hipblasRoundedGemmEx(handle,
+                                                   transa,
+                                                   transb,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   A,
+                                                   a_type,
+                                                   lda,
+                                                   0,
+                                                   B,
+                                                   b_type,
+                                                   ldb,
+                                                   0,
+                                                   beta,
+                                                   C,
+                                                   c_type,
+                                                   ldc,
+                                                   0,
+                                                   1,
+                                                   compute_type,
+                                                   algo);
+    if(rounded != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return rounded;
+
+    hipblasStatus_t complex_half = hipblasComplexHalfGemmEx(handle,
+                                                            transa,
+                                                            transb,
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            alpha,
+                                                            A,
+                                                            a_type,
+                                                            lda,
+                                                            0,
+                                                            B,
+                                                            b_type,
+                                                            ldb,
+                                                            0,
+                                                            beta,
+                                                            C,
+                                                            c_type,
+                                                            ldc,
+                                                            0,
+                                                            1,
+                                                            compute_type);
+    if(complex_half != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return complex_half;
+
+    hipblasStatus_t shaped = hipblasShapeDispatchGemm(handle,
+                                                      transa,
+                                                      transb,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      alpha,
+                                                      A,
+                                                      a_type,
+                                                      lda,
+                                                      B,
+                                                      b_type,
+                                                      ldb,
+                                                      beta,
+                                                      C,
+                                                      c_type,
+                                                      ldc,
+                                                      compute_type);
+    if(shaped != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return shaped;
+
+    // Not necessarily a 1-to-1 mapping between hipblasComputeType_t and rocblas_datatype, so handling supported cases
+    // individually, can be changed with rocBLAS if/when related changes happen there.
+
+    rocblas_gemm_flags flags = rocblas_gemm_flags_none;
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasStatus_t lt = hipblasLtRoutedGemmEx(handle,
+                                               transa,
+                                               transb,
+                                               m,
+                                               n,
+                                               k,
+                                               alpha,
+                                               A,
+                                               a_type,
+                                               lda,
+                                               0,
+                                               B,
+                                               b_type,
+                                               ldb,
+                                               0,
+                                               beta,
+                                               C,
+                                               c_type,
+                                               ldc,
+                                               0,
+                                               1,
+                                               compute_type_roc);
+    if(lt != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return lt;
+
+    hipblasFastComputeScope fast_compute(handle, compute_type);
+
+    return hipblasConvertStatus(hipblasTunedGemmEx<int>((rocblas_handle)handle,
+                                                        hipblasConvertOperation(transa),
+                                                        hipblasConvertOperation(transb),
+                                                        m,
+                                                        n,
+                                                        k,
+                                                        alpha,
+                                                        A,
+                                                        a_type_roc,
+                                                        lda,
+                                                        B,
+                                                        b_type_roc,
+                                                        ldb,
+                                                        beta,
+                                                        C,
+                                                        c_type_roc,
+                                                        ldc,
+                                                        compute_type_roc,
+                                                        hipblasConvertGemmAlgo(algo),
+                                                        flags));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmExWithFlags(hipblasHandle_t    handle,
+                                       hipblasOperation_t transa,
+                                       hipblasOperation_t transb,
+                                       int                m,
+                                       int                n,
+                                       int                k,
+                                       const void*        alpha,
+                                       const void*        A,
+                                       hipblasDatatype_t  a_type,
+                                       int                lda,
+                                       const void*        B,
+                                       hipblasDatatype_t  b_type,
+                                       int                ldb,
+                                       const void*        beta,
+                                       void*              C,
+                                       hipblasDatatype_t  c_type,
+                                       int                ldc,
+                                       hipblasDatatype_t  compute_type,
+                                       hipblasGemmAlgo_t  algo,
+                                       hipblasGemmFlags_t flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  compute_type,
+                  algo,
+                  flags);
+
+    rocblas_gemm_flags flags_roc = hipblasConvertGemmFlags(flags);
+    if(hipblasStatus_t enum_status = hipblasTakeEnumStatus())
+        return enum_status;
+
+    return hipblasConvertStatus(hipblasTunedGemmEx<int>((rocblas_handle)handle,
+                                                        hipblasConvertOperation(transa),
+                                                        hipblasConvertOperation(transb),
+                                                        m,
+                                                        n,
+                                                        k,
+                                                        alpha,
+                                                        A,
+                                                        hipblasConvertDatatype(a_type),
+                                                        lda,
+                                                        B,
+                                                        hipblasConvertDatatype(b_type),
+                                                        ldb,
+                                                        beta,
+                                                        C,
+                                                        hipblasConvertDatatype(c_type),
+                                                        ldc,
+                                                        hipblasConvertDatatype(compute_type),
+                                                        hipblasConvertGemmAlgo(algo),
+                                                        flags_roc));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmExWithFlags_v2(hipblasHandle_t      handle,
+                                          hipblasOperation_t   transa,
+                                          hipblasOperation_t   transb,
+                                          int                  m,
+                                          int                  n,
+                                          int                  k,
+                                          const void*          alpha,
+                                          const void*          A,
+                                          hipDataType          a_type,
+                                          int                  lda,
+                                          const void*          B,
+                                          hipDataType          b_type,
+                                          int                  ldb,
+                                          const void*          beta,
+                                          void*                C,
+                                          hipDataType          c_type,
+                                          int                  ldc,
+                                          hipblasComputeType_t compute_type,
+                                          hipblasGemmAlgo_t    algo,
+                                          hipblasGemmFlags_t   flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  compute_type,
+                  algo,
+                  flags);
+
+    // Not necessarily a 1-to-1 mapping between hipblasComputeType_t and rocblas_datatype, so handling supported cases
+    // individually, can be changed with rocBLAS if/when related changes happen there.
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasFastComputeScope fast_compute(handle, compute_type);
+
+    rocblas_gemm_flags flags_roc = hipblasConvertGemmFlags(flags);
+    if(hipblasStatus_t enum_status = hipblasTakeEnumStatus())
+        return enum_status;
+
+    return hipblasConvertStatus(hipblasTunedGemmEx<int>((rocblas_handle)handle,
+                                                        hipblasConvertOperation(transa),
+                                                        hipblasConvertOperation(transb),
+                                                        m,
+                                                        n,
+                                                        k,
+                                                        alpha,
+                                                        A,
+                                                        a_type_roc,
+                                                        lda,
+                                                        B,
+                                                        b_type_roc,
+                                                        ldb,
+                                                        beta,
+                                                        C,
+                                                        c_type_roc,
+                                                        ldc,
+                                                        compute_type_roc,
+                                                        hipblasConvertGemmAlgo(algo),
+                                                        flags_roc));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t    handle,
+                                     hipblasOperation_t transa,
+                                     hipblasOperation_t transb,
+                                     int                m,
+                                     int                n,
+                                     int                k,
+                                     const void*        alpha,
+                                     const void*        A[],
+                                     hipblasDatatype_t  a_type,
+                                     int                lda,
+                                     const void*        B[],
+                                     hipblasDatatype_t  b_type,
+                                     int                ldb,
+                                     const void*        beta,
+                                     void*              C[],
+                                     hipblasDatatype_t  c_type,
+                                     int                ldc,
+                                     int                batch_count,
+                                     hipblasDatatype_t  compute_type,
+                                     hipblasGemmAlgo_t  algo)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  batch_count,
+                  compute_type,
+                  algo);
+
+    rocblas_gemm_flags flags = rocblas_gemm_flags_none;
+
+    return hipblasConvertStatus(
+        hipblasTunedGemmBatchedEx<int>((rocblas_handle)handle,
+                                       hipblasConvertOperation(transa),
+                                       hipblasConvertOperation(transb),
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       (void*)A,
+                                       hipblasConvertDatatype(a_type),
+                                       lda,
+                                       (void*)B,
+                                       hipblasConvertDatatype(b_type),
+                                       ldb,
+                                       beta,
+                                       (void*)C,
+                                       hipblasConvertDatatype(c_type),
+                                       ldc,
+                                       batch_count,
+                                       hipblasConvertDatatype(compute_type),
+                                       hipblasConvertGemmAlgo(algo),
+                                       flags));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedEx_v2(hipblasHandle_t      handle,
+                                        hipblasOperation_t   transa,
+                                        hipblasOperation_t   transb,
+                                        int                  m,
+                                        int                  n,
+                                        int                  k,
+                                        const void*          alpha,
+                                        const void*          A[],
+                                        hipDataType          a_type,
+                                        int                  lda,
+                                        const void*          B[],
+                                        hipDataType          b_type,
+                                        int                  ldb,
+                                        const void*          beta,
+                                        void*                C[],
+                                        hipDataType          c_type,
+                                        int                  ldc,
+                                        int                  batch_count,
+                                        hipblasComputeType_t compute_type,
+                                        hipblasGemmAlgo_t    algo)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  batch_count,
+                  compute_type,
+                  algo);
+
+    hipblasStatus_t small = hipblasSmallGemm(handle,
+                                             transa,
+                                             transb,
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             a_type,
+                                             lda,
+                                             0,
+                                             B,
+                                             b_type,
+                                             ldb,
+                                             0,
+                                             beta,
+                                             C,
+                                             c_type,
+                                             ldc,
+                                             0,
+                                             batch_count,
+                                             compute_type,
+                                             true);
+    if(small != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return small;
+
+    // Not necessarily a 1-to-1 mapping between hipblasComputeType_t and rocblas_datatype, so handling supported cases
+    // individually, can be changed with rocBLAS if/when related changes happen there.
+
+    rocblas_gemm_flags flags = rocblas_gemm_flags_none;
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasFastComputeScope fast_compute(handle, compute_type);
+
+    return hipblasConvertStatus(hipblasTunedGemmBatchedEx<int>((rocblas_handle)handle,
+                                                               hipblasConvertOperation(transa),
+                                                               hipblasConvertOperation(transb),
+                                                               m,
+                                                               n,
+                                                               k,
+                                                               alpha,
+                                                               (void*)A,
+                                                               a_type_roc,
+                                                               lda,
+                                                               (void*)B,
+                                                               b_type_roc,
+                                                               ldb,
+                                                               beta,
+                                                               (void*)C,
+                                                               c_type_roc,
+                                                               ldc,
+                                                               batch_count,
+                                                               compute_type_roc,
+                                                               hipblasConvertGemmAlgo(algo),
+                                                               flags));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedExWithFlags(hipblasHandle_t    handle,
+                                              hipblasOperation_t transa,
+                                              hipblasOperation_t transb,
+                                              int                m,
+                                              int                n,
+                                              int                k,
+                                              const void*        alpha,
+                                              const void*        A[],
+                                              hipblasDatatype_t  a_type,
+                                              int                lda,
+                                              const void*        B[],
+                                              hipblasDatatype_t  b_type,
+                                              int                ldb,
+                                              const void*        beta,
+                                              void*              C[],
+                                              hipblasDatatype_t  c_type,
+                                              int                ldc,
+                                              int                batch_count,
+                                              hipblasDatatype_t  compute_type,
+                                              hipblasGemmAlgo_t  algo,
+                                              hipblasGemmFlags_t flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  batch_count,
+                  compute_type,
+                  algo,
+                  flags);
+
+    rocblas_gemm_flags flags_roc = hipblasConvertGemmFlags(flags);
+    if(hipblasStatus_t enum_status = hipblasTakeEnumStatus())
+        return enum_status;
+
+    return hipblasConvertStatus(
+        hipblasTunedGemmBatchedEx<int>((rocblas_handle)handle,
+                                       hipblasConvertOperation(transa),
+                                       hipblasConvertOperation(transb),
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       (void*)A,
+                                       hipblasConvertDatatype(a_type),
+                                       lda,
+                                       (void*)B,
+                                       hipblasConvertDatatype(b_type),
+                                       ldb,
+                                       beta,
+                                       (void*)C,
+                                       hipblasConvertDatatype(c_type),
+                                       ldc,
+                                       batch_count,
+                                       hipblasConvertDatatype(compute_type),
+                                       hipblasConvertGemmAlgo(algo),
+                                       flags_roc));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedExWithFlags_v2(hipblasHandle_t      handle,
+                                                 hipblasOperation_t   transa,
+                                                 hipblasOperation_t   transb,
+                                                 int                  m,
+                                                 int                  n,
+                                                 int                  k,
+                                                 const void*          alpha,
+                                                 const void*          A[],
+                                                 hipDataType          a_type,
+                                                 int                  lda,
+                                                 const void*          B[],
+                                                 hipDataType          b_type,
+                                                 int                  ldb,
+                                                 const void*          beta,
+                                                 void*                C[],
+                                                 hipDataType          c_type,
+                                                 int                  ldc,
+                                                 int                  batch_count,
+                                                 hipblasComputeType_t compute_type,
+                                                 hipblasGemmAlgo_t    algo,
+                                                 hipblasGemmFlags_t   flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  batch_count,
+                  compute_type,
+                  algo,
+                  flags);
+
+    hipblasStatus_t small = hipblasSmallGemm(handle,
+                                             transa,
+                                             transb,
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             a_type,
+                                             lda,
+                                             0,
+                                             B,
+                                             b_type,
+                                             ldb,
+                                             0,
+                                             beta,
+                                             C,
+                                             c_type,
+                                             ldc,
+                                             0,
+                                             batch_count,
+                                             compute_type,
+                                             true);
+    if(small != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return small;
+
+    // Not necessarily a 1-to-1 mapping between hipblasComputeType_t and rocblas_datatype, so handling supported cases
+    // individually, can be changed with rocBLAS if/when related changes happen there.
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasFastComputeScope fast_compute(handle, compute_type);
+
+    rocblas_gemm_flags flags_roc = hipblasConvertGemmFlags(flags);
+    if(hipblasStatus_t enum_status = hipblasTakeEnumStatus())
+        return enum_status;
+
+    return hipblasConvertStatus(hipblasTunedGemmBatchedEx<int>((rocblas_handle)handle,
+                                                               hipblasConvertOperation(transa),
+                                                               hipblasConvertOperation(transb),
+                                                               m,
+                                                               n,
+                                                               k,
+                                                               alpha,
+                                                               (void*)A,
+                                                               a_type_roc,
+                                                               lda,
+                                                               (void*)B,
+                                                               b_type_roc,
+                                                               ldb,
+                                                               beta,
+                                                               (void*)C,
+                                                               c_type_roc,
+                                                               ldc,
+                                                               batch_count,
+                                                               compute_type_roc,
+                                                               hipblasConvertGemmAlgo(algo),
+                                                               flags_roc));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t    handle,
+                                            hipblasOperation_t transa,
+                                            hipblasOperation_t transb,
+                                            int                m,
+                                            int                n,
+                                            int                k,
+                                            const void*        alpha,
+                                            const void*        A,
+                                            hipblasDatatype_t  a_type,
+                                            int                lda,
+                                            hipblasStride      stride_A,
+                                            const void*        B,
+                                            hipblasDatatype_t  b_type,
+                                            int                ldb,
+                                            hipblasStride      stride_B,
+                                            const void*        beta,
+                                            void*              C,
+                                            hipblasDatatype_t  c_type,
+                                            int                ldc,
+                                            hipblasStride      stride_C,
+                                            int                batch_count,
+                                            hipblasDatatype_t  compute_type,
+                                            hipblasGemmAlgo_t  algo)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  stride_A,
+                  b_type,
+                  ldb,
+                  stride_B,
+                  c_type,
+                  ldc,
+                  stride_C,
+                  batch_count,
+                  compute_type,
+                  algo);
+
+    rocblas_gemm_flags flags = rocblas_gemm_flags_none;
+
+    return hipblasConvertStatus(
+        hipblasTunedGemmStridedBatchedEx<int>((rocblas_handle)handle,
+                                              hipblasConvertOperation(transa),
+                                              hipblasConvertOperation(transb),
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              hipblasConvertDatatype(a_type),
+                                              lda,
+                                              stride_A,
+                                              B,
+                                              hipblasConvertDatatype(b_type),
+                                              ldb,
+                                              stride_B,
+                                              beta,
+                                              C,
+                                              hipblasConvertDatatype(c_type),
+                                              ldc,
+                                              stride_C,
+                                              batch_count,
+                                              hipblasConvertDatatype(compute_type),
+                                              hipblasConvertGemmAlgo(algo),
+                                              flags));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedEx_v2(hipblasHandle_t      handle,
+                                               hipblasOperation_t   transa,
+                                               hipblasOperation_t   transb,
+                                               int                  m,
+                                               int                  n,
+                                               int                  k,
+                                               const void*          alpha,
+                                               const void*          A,
+                                               hipDataType          a_type,
+                                               int                  lda,
+                                               hipblasStride        stride_A,
+                                               const void*          B,
+                                               hipDataType          b_type,
+                                               int                  ldb,
+                                               hipblasStride        stride_B,
+                                               const void*          beta,
+                                               void*                C,
+                                               hipDataType          c_type,
+                                               int                  ldc,
+                                               hipblasStride        stride_C,
+                                               int                  batch_count,
+                                               hipblasComputeType_t compute_type,
+                                               hipblasGemmAlgo_t    algo)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  stride_A,
+                  b_type,
+                  ldb,
+                  stride_B,
+                  c_type,
+                  ldc,
+                  stride_C,
+                  batch_count,
+                  compute_type,
+                  algo);
+    hipblasPrefetchGemm(handle,
+                        transa,
+                        transb,
+                        m,
+                        n,
+                        k,
+                        A,
+                        lda,
+                        stride_A,
+                        B,
+                        ldb,
+                        stride_B,
+                        C,
+                        ldc,
+                        stride_C,
+                        batch_count,
+                        hipblasPrefetchTypeSize(a_type),
+                        hipblasPrefetchTypeSize(b_type),
+                        hipblasPrefetchTypeSize(c_type));
+
+    hipblasStatus_t rounded = hipblasRoundedGemmEx(handle,
+                                                   transa,
+                                                   transb,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   A,
+                                                   a_type,
+                                                   lda,
+                                                   stride_A,
+                                                   B,
+                                                   b_type,
+                                                   ldb,
+                                                   stride_B,
+                                                   beta,
+                                                   C,
+                                                   c_type,
+                                                   ldc,
+                                                   stride_C,
+                                                   batch_count,
+                                                   compute_type,
+                                                   algo);
+    if(rounded != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return rounded;
+
+    hipblasStatus_t complex_half = hipblasComplexHalfGemmEx(handle,
+                                                            transa,
+                                                            transb,
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            alpha,
+                                                            A,
+                                                            a_type,
+                                                            lda,
+                                                            stride_A,
+                                                            B,
+                                                            b_type,
+                                                            ldb,
+                                                            stride_B,
+                                                            beta,
+                                                            C,
+                                                            c_type,
+                                                            ldc,
+                                                            stride_C,
+                                                            batch_count,
+                                                            compute_type);
+    if(complex_half != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return complex_half;
+
+    hipblasStatus_t broadcast = hipblasBroadcastGemm(handle,
+                                                     transa,
+                                                     transb,
+                                                     m,
+                                                     n,
+                                                     k,
+                                                     alpha,
+                                                     A,
+                                                     a_type,
+                                                     lda,
+                                                     stride_A,
+                                                     B,
+                                                     b_type,
+                                                     ldb,
+                                                     stride_B,
+                                                     beta,
+                                                     C,
+                                                     c_type,
+                                                     ldc,
+                                                     stride_C,
+                                                     batch_count,
+                                                     compute_type,
+                                                     algo,
+                                                     HIPBLAS_GEMM_FLAGS_NONE);
+    if(broadcast != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return broadcast;
+
+    hipblasStatus_t small = hipblasSmallGemm(handle,
+                                             transa,
+                                             transb,
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             a_type,
+                                             lda,
+                                             stride_A,
+                                             B,
+                                             b_type,
+                                             ldb,
+                                             stride_B,
+                                             beta,
+                                             C,
+                                             c_type,
+                                             ldc,
+                                             stride_C,
+                                             batch_count,
+                                             compute_type,
+                                             false);
+    if(small != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return small;
+
+    // Not necessarily a 1-to-1 mapping between hipblasComputeType_t and rocblas_datatype, so handling supported cases
+    // individually, can be changed with rocBLAS if/when related changes happen there.
+
+    rocblas_gemm_flags flags = rocblas_gemm_flags_none;
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasStatus_t lt = hipblasLtRoutedGemmEx(handle,
+                                               transa,
+                                               transb,
+                                               m,
+                                               n,
+                                               k,
+                                               alpha,
+                                               A,
+                                               a_type,
+                                               lda,
+                                               stride_A,
+                                               B,
+                                               b_type,
+                                               ldb,
+                                               stride_B,
+                                               beta,
+                                               C,
+                                               c_type,
+                                               ldc,
+                                               stride_C,
+                                               batch_count,
+                                               compute_type_roc);
+    if(lt != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return lt;
+
+    hipblasFastComputeScope fast_compute(handle, compute_type);
+
+    return hipblasConvertStatus(
+        hipblasTunedGemmStridedBatchedEx<int>((rocblas_handle)handle,
+                                              hipblasConvertOperation(transa),
+                                              hipblasConvertOperation(transb),
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              a_type_roc,
+                                              lda,
+                                              stride_A,
+                                              B,
+                                              b_type_roc,
+                                              ldb,
+                                              stride_B,
+                                              beta,
+                                              C,
+                                              c_type_roc,
+                                              ldc,
+                                              stride_C,
+                                              batch_count,
+                                              compute_type_roc,
+                                              hipblasConvertGemmAlgo(algo),
+                                              flags));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExWithFlags(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transa,
+                                                     hipblasOperation_t transb,
+                                                     int                m,
+                                                     int                n,
+                                                     int                k,
+                                                     const void*        alpha,
+                                                     const void*        A,
+                                                     hipblasDatatype_t  a_type,
+                                                     int                lda,
+                                                     hipblasStride      stride_A,
+                                                     const void*        B,
+                                                     hipblasDatatype_t  b_type,
+                                                     int                ldb,
+                                                     hipblasStride      stride_B,
+                                                     const void*        beta,
+                                                     void*              C,
+                                                     hipblasDatatype_t  c_type,
+                                                     int                ldc,
+                                                     hipblasStride      stride_C,
+                                                     int                batch_count,
+                                                     hipblasDatatype_t  compute_type,
+                                                     hipblasGemmAlgo_t  algo,
+                                                     hipblasGemmFlags_t flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  stride_A,
+                  b_type,
+                  ldb,
+                  stride_B,
+                  c_type,
+                  ldc,
+                  stride_C,
+                  batch_count,
+                  compute_type,
+                  algo,
+                  flags);
+
+    rocblas_gemm_flags flags_roc = hipblasConvertGemmFlags(flags);
+    if(hipblasStatus_t enum_status = hipblasTakeEnumStatus())
+        return enum_status;
+
+    return hipblasConvertStatus(
+        hipblasTunedGemmStridedBatchedEx<int>((rocblas_handle)handle,
+                                              hipblasConvertOperation(transa),
+                                              hipblasConvertOperation(transb),
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              hipblasConvertDatatype(a_type),
+                                              lda,
+                                              stride_A,
+                                              B,
+                                              hipblasConvertDatatype(b_type),
+                                              ldb,
+                                              stride_B,
+                                              beta,
+                                              C,
+                                              hipblasConvertDatatype(c_type),
+                                              ldc,
+                                              stride_C,
+                                              batch_count,
+                                              hipblasConvertDatatype(compute_type),
+                                              hipblasConvertGemmAlgo(algo),
+                                              flags_roc));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExWithFlags_v2(hipblasHandle_t      handle,
+                                                        hipblasOperation_t   transa,
+                                                        hipblasOperation_t   transb,
+                                                        int                  m,
+                                                        int                  n,
+                                                        int                  k,
+                                                        const void*          alpha,
+                                                        const void*          A,
+                                                        hipDataType          a_type,
+                                                        int                  lda,
+                                                        hipblasStride        stride_A,
+                                                        const void*          B,
+                                                        hipDataType          b_type,
+                                                        int                  ldb,
+                                                        hipblasStride        stride_B,
+                                                        const void*          beta,
+                                                        void*                C,
+                                                        hipDataType          c_type,
+                                                        int                  ldc,
+                                                        hipblasStride        stride_C,
+                                                        int                  batch_count,
+                                                        hipblasComputeType_t compute_type,
+                                                        hipblasGemmAlgo_t    algo,
+                                                        hipblasGemmFlags_t   flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  stride_A,
+                  b_type,
+                  ldb,
+                  stride_B,
+                  c_type,
+                  ldc,
+                  stride_C,
+                  batch_count,
+                  compute_type,
+                  algo,
+                  flags);
+
+    hipblasStatus_t broadcast = hipblasBroadcastGemm(handle,
+                                                     transa,
+                                                     transb,
+                                                     m,
+                                                     n,
+                                                     k,
+                                                     alpha,
+                                                     A,
+                                                     a_type,
+                                                     lda,
+                                                     stride_A,
+                                                     B,
+                                                     b_type,
+                                                     ldb,
+                                                     stride_B,
+                                                     beta,
+                                                     C,
+                                                     c_type,
+                                                     ldc,
+                                                     stride_C,
+                                                     batch_count,
+                                                     compute_type,
+                                                     algo,
+                                                     flags);
+    if(broadcast != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return broadcast;
+
+    hipblasStatus_t small = hipblasSmallGemm(handle,
+                                             transa,
+                                             transb,
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             a_type,
+                                             lda,
+                                             stride_A,
+                                             B,
+                                             b_type,
+                                             ldb,
+                                             stride_B,
+                                             beta,
+                                             C,
+                                             c_type,
+                                             ldc,
+                                             stride_C,
+                                             batch_count,
+                                             compute_type,
+                                             false);
+    if(small != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return small;
+
+    // Not necessarily a 1-to-1 mapping between hipblasComputeType_t and rocblas_datatype, so handling supported cases
+    // individually, can be changed with rocBLAS if/when related changes happen there.
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasFastComputeScope fast_compute(handle, compute_type);
+
+    rocblas_gemm_flags flags_roc = hipblasConvertGemmFlags(flags);
+    if(hipblasStatus_t enum_status = hipblasTakeEnumStatus())
+        return enum_status;
+
+    return hipblasConvertStatus(
+        hipblasTunedGemmStridedBatchedEx<int>((rocblas_handle)handle,
+                                              hipblasConvertOperation(transa),
+                                              hipblasConvertOperation(transb),
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              a_type_roc,
+                                              lda,
+                                              stride_A,
+                                              B,
+                                              b_type_roc,
+                                              ldb,
+                                              stride_B,
+                                              beta,
+                                              C,
+                                              c_type_roc,
+                                              ldc,
+                                              stride_C,
+                                              batch_count,
+                                              compute_type_roc,
+                                              hipblasConvertGemmAlgo(algo),
+                                              flags_roc));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmExGetSolutions(hipblasHandle_t      handle,
+                                          hipblasOperation_t   transa,
+                                          hipblasOperation_t   transb,
+                                          int                  m,
+                                          int                  n,
+                                          int                  k,
+                                          const void*          alpha,
+                                          const void*          A,
+                                          hipDataType          a_type,
+                                          int                  lda,
+                                          const void*          B,
+                                          hipDataType          b_type,
+                                          int                  ldb,
+                                          const void*          beta,
+                                          void*                C,
+                                          hipDataType          c_type,
+                                          int                  ldc,
+                                          hipblasComputeType_t compute_type,
+                                          hipblasGemmFlags_t   flags,
+                                          int*                 solution_list,
+                                          int*                 solution_count)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasFastComputeScope fast_compute(handle, compute_type);
+
+    rocblas_operation  opA       = hipblasConvertOperation(transa);
+    rocblas_operation  opB       = hipblasConvertOperation(transb);
+    rocblas_gemm_flags flags_roc = hipblasConvertGemmFlags(flags);
+    if(hipblasStatus_t enum_status = hipblasTakeEnumStatus())
+        return enum_status;
+
+    return hipblasGetGemmSolutions(
+        solution_list, solution_count, [&](rocblas_int* list, rocblas_int* size) {
+            return rocblas_gemm_ex_get_solutions((rocblas_handle)handle,
+                                                 opA,
+                                                 opB,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 alpha,
+                                                 A,
+                                                 a_type_roc,
+                                                 lda,
+                                                 B,
+                                                 b_type_roc,
+                                                 ldb,
+                                                 beta,
+                                                 C,
+                                                 c_type_roc,
+                                                 ldc,
+                                                 C,
+                                                 c_type_roc,
+                                                 ldc,
+                                                 compute_type_roc,
+                                                 rocblas_gemm_algo_solution_index,
+                                                 flags_roc,
+                                                 list,
+                                                 size);
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmExWithSolution(hipblasHandle_t      handle,
+                                          hipblasOperation_t   transa,
+                                          hipblasOperation_t   transb,
+                                          int                  m,
+                                          int                  n,
+                                          int                  k,
+                                          const void*          alpha,
+                                          const void*          A,
+                                          hipDataType          a_type,
+                                          int                  lda,
+                                          const void*          B,
+                                          hipDataType          b_type,
+                                          int                  ldb,
+                                          const void*          beta,
+                                          void*                C,
+                                          hipDataType          c_type,
+                                          int                  ldc,
+                                          hipblasComputeType_t compute_type,
+                                          hipblasGemmFlags_t   flags,
+                                          int                  solution_index)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  compute_type,
+                  flags,
+                  solution_index);
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasFastComputeScope fast_compute(handle, compute_type);
+
+    // an explicit solution bypasses the tuning cache
+    rocblas_gemm_algo algo
+        = solution_index ? rocblas_gemm_algo_solution_index : rocblas_gemm_algo_standard;
+
+    rocblas_gemm_flags flags_roc = hipblasConvertGemmFlags(flags);
+    if(hipblasStatus_t enum_status = hipblasTakeEnumStatus())
+        return enum_status;
+
+    return hipblasConvertStatus(rocblas_gemm_ex((rocblas_handle)handle,
+                                                hipblasConvertOperation(transa),
+                                                hipblasConvertOperation(transb),
+                                                m,
+                                                n,
+                                                k,
+                                                alpha,
+                                                A,
+                                                a_type_roc,
+                                                lda,
+                                                B,
+                                                b_type_roc,
+                                                ldb,
+                                                beta,
+                                                C,
+                                                c_type_roc,
+                                                ldc,
+                                                C,
+                                                c_type_roc,
+                                                ldc,
+                                                compute_type_roc,
+                                                algo,
+                                                solution_index,
+                                                flags_roc));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmExWithEpilogue(hipblasHandle_t      handle,
+                                          hipblasOperation_t   transa,
+                                          hipblasOperation_t   transb,
+                                          int                  m,
+                                          int                  n,
+                                          int                  k,
+                                          const void*          alpha,
+                                          const void*          A,
+                                          hipDataType          a_type,
+                                          int                  lda,
+                                          const void*          B,
+                                          hipDataType          b_type,
+                                          int                  ldb,
+                                          const void*          beta,
+                                          void*                C,
+                                          hipDataType          c_type,
+                                          int                  ldc,
+                                          hipblasComputeType_t compute_type,
+                                          hipblasEpilogue_t    epilogue,
+                                          const void*          bias,
+                                          void*                aux,
+                                          int                  ldaux)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, transa, transb, m, n, k, a_type, lda, b_type, ldb, c_type, ldc, compute_type);
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasFastComputeScope fast_compute(handle, compute_type);
+
+    bool with_bias = false, with_aux = false;
+    switch(epilogue)
+    {
+    case HIPBLAS_EPILOGUE_DEFAULT:
+    case HIPBLAS_EPILOGUE_RELU:
+    case HIPBLAS_EPILOGUE_GELU:
+        break;
+    case HIPBLAS_EPILOGUE_BIAS:
+    case HIPBLAS_EPILOGUE_RELU_BIAS:
+    case HIPBLAS_EPILOGUE_GELU_BIAS:
+        with_bias = true;
+        break;
+    case HIPBLAS_EPILOGUE_GELU_AUX:
+        with_aux = true;
+        break;
+    case HIPBLAS_EPILOGUE_GELU_AUX_BIAS:
+        with_bias = with_aux = true;
+        break;
+    default:
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    }
+
+    for(hipblasOperation_t trans : {transa, transb})
+    {
+        if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+    }
+
+    int a_rows = transa == HIPBLAS_OP_N ? m : k;
+    int b_rows = transb == HIPBLAS_OP_N ? k : n;
+    if(m < 0 || n < 0 || k < 0 || lda < a_rows || ldb < b_rows || ldc < m
+       || (with_aux && ldaux < m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    if(!m || !n)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    if(!alpha || !beta || !C || (with_bias && !bias) || (with_aux && !aux))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+#ifdef __HIP_PLATFORM_HIPBLASLT__
+    hipblasLtGemmArgs args;
+    status = hipblasLtGemmSetup(handle, args, compute_type_roc);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    args.trans_a  = transa != HIPBLAS_OP_N;
+    args.trans_b  = transb != HIPBLAS_OP_N;
+    args.m        = m;
+    args.n        = n;
+    args.k        = k;
+    args.alpha    = alpha;
+    args.A        = A;
+    args.a_type   = a_type;
+    args.lda      = lda;
+    args.B        = B;
+    args.b_type   = b_type;
+    args.ldb      = ldb;
+    args.beta     = beta;
+    args.C        = C;
+    args.c_type   = c_type;
+    args.ldc      = ldc;
+    args.epilogue = epilogue;
+    args.bias     = with_bias ? bias : nullptr;
+    args.aux      = with_aux ? aux : nullptr;
+    args.ldaux    = ldaux;
+    return hipblasStatus_t(hipblasLtGemm(args));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmExWithScales(hipblasHandle_t      handle,
+                                        hipblasOperation_t   transa,
+                                        hipblasOperation_t   transb,
+                                        int                  m,
+                                        int                  n,
+                                        int                  k,
+                                        const void*          alpha,
+                                        const void*          A,
+                                        hipDataType          a_type,
+                                        int                  lda,
+                                        const void*          B,
+                                        hipDataType          b_type,
+                                        int                  ldb,
+                                        const void*          beta,
+                                        void*                C,
+                                        hipDataType          c_type,
+                                        int                  ldc,
+                                        hipblasComputeType_t compute_type,
+                                        const float*         scale_a,
+                                        const float*         scale_b,
+                                        const float*         scale_d,
+                                        float*               amax_d)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, transa, transb, m, n, k, a_type, lda, b_type, ldb, c_type, ldc, compute_type);
+
+    return hipblasGemmExWithScalesImpl(handle,
+                                       transa,
+                                       transb,
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       A,
+                                       a_type,
+                                       lda,
+                                       0,
+                                       B,
+                                       b_type,
+                                       ldb,
+                                       0,
+                                       beta,
+                                       C,
+                                       c_type,
+                                       ldc,
+                                       0,
+                                       1,
+                                       compute_type,
+                                       scale_a,
+                                       scale_b,
+                                       scale_d,
+                                       amax_d);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExWithScales(hipblasHandle_t      handle,
+                                                      hipblasOperation_t   transa,
+                                                      hipblasOperation_t   transb,
+                                                      int                  m,
+                                                      int                  n,
+                                                      int                  k,
+                                                      const void*          alpha,
+                                                      const void*          A,
+                                                      hipDataType          a_type,
+                                                      int                  lda,
+                                                      hipblasStride        stride_a,
+                                                      const void*          B,
+                                                      hipDataType          b_type,
+                                                      int                  ldb,
+                                                      hipblasStride        stride_b,
+                                                      const void*          beta,
+                                                      void*                C,
+                                                      hipDataType          c_type,
+                                                      int                  ldc,
+                                                      hipblasStride        stride_c,
+                                                      int                  batch_count,
+                                                      hipblasComputeType_t compute_type,
+                                                      const float*         scale_a,
+                                                      const float*         scale_b,
+                                                      const float*         scale_d,
+                                                      float*               amax_d)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  stride_a,
+                  b_type,
+                  ldb,
+                  stride_b,
+                  c_type,
+                  ldc,
+                  stride_c,
+                  batch_count,
+                  compute_type);
+
+    return hipblasGemmExWithScalesImpl(handle,
+                                       transa,
+                                       transb,
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       A,
+                                       a_type,
+                                       lda,
+                                       stride_a,
+                                       B,
+                                       b_type,
+                                       ldb,
+                                       stride_b,
+                                       beta,
+                                       C,
+                                       c_type,
+                                       ldc,
+                                       stride_c,
+                                       batch_count,
+                                       compute_type,
+                                       scale_a,
+                                       scale_b,
+                                       scale_d,
+                                       amax_d);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmExOutOfPlace(hipblasHandle_t      handle,
+                                        hipblasOperation_t   transa,
+                                        hipblasOperation_t   transb,
+                                        int                  m,
+                                        int                  n,
+                                        int                  k,
+                                        const void*          alpha,
+                                        const void*          A,
+                                        hipDataType          a_type,
+                                        int                  lda,
+                                        const void*          B,
+                                        hipDataType          b_type,
+                                        int                  ldb,
+                                        const void*          beta,
+                                        const void*          C,
+                                        hipDataType          c_type,
+                                        int                  ldc,
+                                        void*                D,
+                                        hipDataType          d_type,
+                                        int                  ldd,
+                                        hipblasComputeType_t compute_type,
+                                        hipblasGemmAlgo_t    algo,
+                                        hipblasGemmFlags_t   flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  compute_type,
+                  algo,
+                  flags);
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasFastComputeScope fast_compute(handle, compute_type);
+
+    if(d_type != c_type)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    if(D == C && ldd != ldc)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    rocblas_gemm_flags flags_roc = hipblasConvertGemmFlags(flags);
+    if(hipblasStatus_t enum_status = hipblasTakeEnumStatus())
+        return enum_status;
+
+    return hipblasConvertStatus(hipblasTunedGemmEx<int>((rocblas_handle)handle,
+                                                        hipblasConvertOperation(transa),
+                                                        hipblasConvertOperation(transb),
+                                                        m,
+                                                        n,
+                                                        k,
+                                                        alpha,
+                                                        A,
+                                                        a_type_roc,
+                                                        lda,
+                                                        B,
+                                                        b_type_roc,
+                                                        ldb,
+                                                        beta,
+                                                        C,
+                                                        c_type_roc,
+                                                        ldc,
+                                                        D,
+                                                        c_type_roc,
+                                                        ldd,
+                                                        compute_type_roc,
+                                                        hipblasConvertGemmAlgo(algo),
+                                                        flags_roc));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExOutOfPlace(hipblasHandle_t      handle,
+                                                      hipblasOperation_t   transa,
+                                                      hipblasOperation_t   transb,
+                                                      int                  m,
+                                                      int                  n,
+                                                      int                  k,
+                                                      const void*          alpha,
+                                                      const void*          A,
+                                                      hipDataType          a_type,
+                                                      int                  lda,
+                                                      hipblasStride        stride_A,
+                                                      const void*          B,
+                                                      hipDataType          b_type,
+                                                      int                  ldb,
+                                                      hipblasStride        stride_B,
+                                                      const void*          beta,
+                                                      const void*          C,
+                                                      hipDataType          c_type,
+                                                      int                  ldc,
+                                                      hipblasStride        stride_C,
+                                                      void*                D,
+                                                      hipDataType          d_type,
+                                                      int                  ldd,
+                                                      hipblasStride        stride_D,
+                                                      int                  batch_count,
+                                                      hipblasComputeType_t compute_type,
+                                                      hipblasGemmAlgo_t    algo,
+                                                      hipblasGemmFlags_t   flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  stride_A,
+                  b_type,
+                  ldb,
+                  stride_B,
+                  c_type,
+                  ldc,
+                  stride_C,
+                  batch_count,
+                  compute_type,
+                  algo,
+                  flags);
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasFastComputeScope fast_compute(handle, compute_type);
+
+    if(d_type != c_type)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    if(D == C && (ldd != ldc || stride_D != stride_C))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    rocblas_gemm_flags flags_roc = hipblasConvertGemmFlags(flags);
+    if(hipblasStatus_t enum_status = hipblasTakeEnumStatus())
+        return enum_status;
+
+    return hipblasConvertStatus(
+        hipblasTunedGemmStridedBatchedEx<int>((rocblas_handle)handle,
+                                              hipblasConvertOperation(transa),
+                                              hipblasConvertOperation(transb),
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              a_type_roc,
+                                              lda,
+                                              stride_A,
+                                              B,
+                                              b_type_roc,
+                                              ldb,
+                                              stride_B,
+                                              beta,
+                                              C,
+                                              c_type_roc,
+                                              ldc,
+                                              stride_C,
+                                              D,
+                                              c_type_roc,
+                                              ldd,
+                                              stride_D,
+                                              batch_count,
+                                              compute_type_roc,
+                                              hipblasConvertGemmAlgo(algo),
+                                              flags_roc));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedExGetSolutions(hipblasHandle_t      handle,
+                                                 hipblasOperation_t   transa,
+                                                 hipblasOperation_t   transb,
+                                                 int                  m,
+                                                 int                  n,
+                                                 int                  k,
+                                                 const void*          alpha,
+                                                 const void*          A[],
+                                                 hipDataType          a_type,
+                                                 int                  lda,
+                                                 const void*          B[],
+                                                 hipDataType          b_type,
+                                                 int                  ldb,
+                                                 const void*          beta,
+                                                 void*                C[],
+                                                 hipDataType          c_type,
+                                                 int                  ldc,
+                                                 int                  batch_count,
+                                                 hipblasComputeType_t compute_type,
+                                                 hipblasGemmFlags_t   flags,
+                                                 int*                 solution_list,
+                                                 int*                 solution_count)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasFastComputeScope fast_compute(handle, compute_type);
+
+    rocblas_operation  opA       = hipblasConvertOperation(transa);
+    rocblas_operation  opB       = hipblasConvertOperation(transb);
+    rocblas_gemm_flags flags_roc = hipblasConvertGemmFlags(flags);
+    if(hipblasStatus_t enum_status = hipblasTakeEnumStatus())
+        return enum_status;
+
+    return hipblasGetGemmSolutions(
+        solution_list, solution_count, [&](rocblas_int* list, rocblas_int* size) {
+            return rocblas_gemm_batched_ex_get_solutions((rocblas_handle)handle,
+                                                         opA,
+                                                         opB,
+                                                         m,
+                                                         n,
+                                                         k,
+                                                         alpha,
+                                                         (void*)A,
+                                                         a_type_roc,
+                                                         lda,
+                                                         (void*)B,
+                                                         b_type_roc,
+                                                         ldb,
+                                                         beta,
+                                                         (void*)C,
+                                                         c_type_roc,
+                                                         ldc,
+                                                         (void*)C,
+                                                         c_type_roc,
+                                                         ldc,
+                                                         batch_count,
+                                                         compute_type_roc,
+                                                         rocblas_gemm_algo_solution_index,
+                                                         flags_roc,
+                                                         list,
+                                                         size);
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedExWithSolution(hipblasHandle_t      handle,
+                                                 hipblasOperation_t   transa,
+                                                 hipblasOperation_t   transb,
+                                                 int                  m,
+                                                 int                  n,
+                                                 int                  k,
+                                                 const void*          alpha,
+                                                 const void*          A[],
+                                                 hipDataType          a_type,
+                                                 int                  lda,
+                                                 const void*          B[],
+                                                 hipDataType          b_type,
+                                                 int                  ldb,
+                                                 const void*          beta,
+                                                 void*                C[],
+                                                 hipDataType          c_type,
+                                                 int                  ldc,
+                                                 int                  batch_count,
+                                                 hipblasComputeType_t compute_type,
+                                                 hipblasGemmFlags_t   flags,
+                                                 int                  solution_index)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  batch_count,
+                  compute_type,
+                  flags,
+                  solution_index);
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasFastComputeScope fast_compute(handle, compute_type);
+
+    rocblas_gemm_algo algo
+        = solution_index ? rocblas_gemm_algo_solution_index : rocblas_gemm_algo_standard;
+
+    rocblas_gemm_flags flags_roc = hipblasConvertGemmFlags(flags);
+    if(hipblasStatus_t enum_status = hipblasTakeEnumStatus())
+        return enum_status;
+
+    return hipblasConvertStatus(rocblas_gemm_batched_ex((rocblas_handle)handle,
+                                                        hipblasConvertOperation(transa),
+                                                        hipblasConvertOperation(transb),
+                                                        m,
+                                                        n,
+                                                        k,
+                                                        alpha,
+                                                        (void*)A,
+                                                        a_type_roc,
+                                                        lda,
+                                                        (void*)B,
+                                                        b_type_roc,
+                                                        ldb,
+                                                        beta,
+                                                        (void*)C,
+                                                        c_type_roc,
+                                                        ldc,
+                                                        (void*)C,
+                                                        c_type_roc,
+                                                        ldc,
+                                                        batch_count,
+                                                        compute_type_roc,
+                                                        algo,
+                                                        solution_index,
+                                                        flags_roc));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExGetSolutions(hipblasHandle_t      handle,
+                                                        hipblasOperation_t   transa,
+                                                        hipblasOperation_t   transb,
+                                                        int                  m,
+                                                        int                  n,
+                                                        int                  k,
+                                                        const void*          alpha,
+                                                        const void*          A,
+                                                        hipDataType          a_type,
+                                                        int                  lda,
+                                                        hipblasStride        stride_A,
+                                                        const void*          B,
+                                                        hipDataType          b_type,
+                                                        int                  ldb,
+                                                        hipblasStride        stride_B,
+                                                        const void*          beta,
+                                                        void*                C,
+                                                        hipDataType          c_type,
+                                                        int                  ldc,
+                                                        hipblasStride        stride_C,
+                                                        int                  batch_count,
+                                                        hipblasComputeType_t compute_type,
+                                                        hipblasGemmFlags_t   flags,
+                                                        int*                 solution_list,
+                                                        int*                 solution_count)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasFastComputeScope fast_compute(handle, compute_type);
+
+    rocblas_operation  opA       = hipblasConvertOperation(transa);
+    rocblas_operation  opB       = hipblasConvertOperation(transb);
+    rocblas_gemm_flags flags_roc = hipblasConvertGemmFlags(flags);
+    if(hipblasStatus_t enum_status = hipblasTakeEnumStatus())
+        return enum_status;
+
+    return hipblasGetGemmSolutions(
+        solution_list, solution_count, [&](rocblas_int* list, rocblas_int* size) {
+            return rocblas_gemm_strided_batched_ex_get_solutions((rocblas_handle)handle,
+                                                                 opA,
+                                                                 opB,
+                                                                 m,
+                                                                 n,
+                                                                 k,
+                                                                 alpha,
+                                                                 A,
+                                                                 a_type_roc,
+                                                                 lda,
+                                                                 stride_A,
+                                                                 B,
+                                                                 b_type_roc,
+                                                                 ldb,
+                                                                 stride_B,
+                                                                 beta,
+                                                                 C,
+                                                                 c_type_roc,
+                                                                 ldc,
+                                                                 stride_C,
+                                                                 C,
+                                                                 c_type_roc,
+                                                                 ldc,
+                                                                 stride_C,
+                                                                 batch_count,
+                                                                 compute_type_roc,
+                                                                 rocblas_gemm_algo_solution_index,
+                                                                 flags_roc,
+                                                                 list,
+                                                                 size);
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExWithSolution(hipblasHandle_t      handle,
+                                                        hipblasOperation_t   transa,
+                                                        hipblasOperation_t   transb,
+                                                        int                  m,
+                                                        int                  n,
+                                                        int                  k,
+                                                        const void*          alpha,
+                                                        const void*          A,
+                                                        hipDataType          a_type,
+                                                        int                  lda,
+                                                        hipblasStride        stride_A,
+                                                        const void*          B,
+                                                        hipDataType          b_type,
+                                                        int                  ldb,
+                                                        hipblasStride        stride_B,
+                                                        const void*          beta,
+                                                        void*                C,
+                                                        hipDataType          c_type,
+                                                        int                  ldc,
+                                                        hipblasStride        stride_C,
+                                                        int                  batch_count,
+                                                        hipblasComputeType_t compute_type,
+                                                        hipblasGemmFlags_t   flags,
+                                                        int                  solution_index)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  stride_A,
+                  b_type,
+                  ldb,
+                  stride_B,
+                  c_type,
+                  ldc,
+                  stride_C,
+                  batch_count,
+                  compute_type,
+                  flags,
+                  solution_index);
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasFastComputeScope fast_compute(handle, compute_type);
+
+    rocblas_gemm_algo algo
+        = solution_index ? rocblas_gemm_algo_solution_index : rocblas_gemm_algo_standard;
+
+    rocblas_gemm_flags flags_roc = hipblasConvertGemmFlags(flags);
+    if(hipblasStatus_t enum_status = hipblasTakeEnumStatus())
+        return enum_status;
+
+    return hipblasConvertStatus(
+        rocblas_gemm_strided_batched_ex((rocblas_handle)handle,
+                                        hipblasConvertOperation(transa),
+                                        hipblasConvertOperation(transb),
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        A,
+                                        a_type_roc,
+                                        lda,
+                                        stride_A,
+                                        B,
+                                        b_type_roc,
+                                        ldb,
+                                        stride_B,
+                                        beta,
+                                        C,
+                                        c_type_roc,
+                                        ldc,
+                                        stride_C,
+                                        C,
+                                        c_type_roc,
+                                        ldc,
+                                        stride_C,
+                                        batch_count,
+                                        compute_type_roc,
+                                        algo,
+                                        solution_index,
+                                        flags_roc));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// gemm plans keep the gemmEx arguments converted to rocBLAS once, so executing one only
+// passes the pointers
+struct hipblasGemmPlan
+{
+    rocblas_operation  transa, transb;
+    int                m, n, k;
+    rocblas_datatype   a_type, b_type, c_type, compute_type;
+    int                lda, ldb, ldc;
+    rocblas_stride     stride_A, stride_B, stride_C;
+    int                batch_count;
+    rocblas_gemm_flags   flags;
+    int                  solution_index;
+    hipblasComputeType_t hipblas_compute_type;
+};
+
+hipblasStatus_t hipblasGemmPlanCreate(hipblasHandle_t      handle,
+                                      hipblasGemmPlan_t*   plan,
+                                      hipblasOperation_t   transa,
+                                      hipblasOperation_t   transb,
+                                      int                  m,
+                                      int                  n,
+                                      int                  k,
+                                      hipDataType          a_type,
+                                      int                  lda,
+                                      hipblasStride        stride_A,
+                                      hipDataType          b_type,
+                                      int                  ldb,
+                                      hipblasStride        stride_B,
+                                      hipDataType          c_type,
+                                      int                  ldc,
+                                      hipblasStride        stride_C,
+                                      int                  batch_count,
+                                      hipblasComputeType_t compute_type,
+                                      hipblasGemmFlags_t   flags,
+                                      int                  solution_index)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  stride_A,
+                  b_type,
+                  ldb,
+                  stride_B,
+                  c_type,
+                  ldc,
+                  stride_C,
+                  batch_count,
+                  compute_type,
+                  flags,
+                  solution_index);
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(plan == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *plan = nullptr;
+
+    rocblas_operation  trans_a   = hipblasConvertOperation(transa);
+    rocblas_operation  trans_b   = hipblasConvertOperation(transb);
+    rocblas_gemm_flags flags_roc = hipblasConvertGemmFlags(flags);
+    if(hipblasStatus_t enum_status = hipblasTakeEnumStatus())
+        return enum_status;
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    int rows_A = trans_a == rocblas_operation_none ? m : k;
+    int rows_B = trans_b == rocblas_operation_none ? k : n;
+    if(m < 0 || n < 0 || k < 0 || lda < std::max(1, rows_A) || ldb < std::max(1, rows_B)
+       || ldc < std::max(1, m) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *plan = new hipblasGemmPlan{trans_a,
+                                trans_b,
+                                m,
+                                n,
+                                k,
+                                a_type_roc,
+                                b_type_roc,
+                                c_type_roc,
+                                compute_type_roc,
+                                lda,
+                                ldb,
+                                ldc,
+                                stride_A,
+                                stride_B,
+                                stride_C,
+                                batch_count,
+                                flags_roc,
+                                solution_index,
+                                compute_type};
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmPlanDestroy(hipblasGemmPlan_t plan)
+try
+{
+    delete plan;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmPlanExecute(hipblasHandle_t   handle,
+                                       hipblasGemmPlan_t plan,
+                                       const void*       alpha,
+                                       const void*       A,
+                                       const void*       B,
+                                       const void*       beta,
+                                       void*             C)
+try
+{
+    HIPBLAS_ENTRY(handle);
+
+    if(plan == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    const hipblasGemmPlan& p = *plan;
+
+    hipblasFastComputeScope fast_compute(handle, p.hipblas_compute_type);
+
+    // an explicit solution bypasses the tuning cache, as in hipblasGemmExWithSolution
+    if(p.solution_index)
+    {
+        if(p.batch_count == 1)
+            return hipblasConvertStatus(rocblas_gemm_ex((rocblas_handle)handle,
+                                                        p.transa,
+                                                        p.transb,
+                                                        p.m,
+                                                        p.n,
+                                                        p.k,
+                                                        alpha,
+                                                        A,
+                                                        p.a_type,
+                                                        p.lda,
+                                                        B,
+                                                        p.b_type,
+                                                        p.ldb,
+                                                        beta,
+                                                        C,
+                                                        p.c_type,
+                                                        p.ldc,
+                                                        C,
+                                                        p.c_type,
+                                                        p.ldc,
+                                                        p.compute_type,
+                                                        rocblas_gemm_algo_solution_index,
+                                                        p.solution_index,
+                                                        p.flags));
+
+        return hipblasConvertStatus(
+            rocblas_gemm_strided_batched_ex((rocblas_handle)handle,
+                                            p.transa,
+                                            p.transb,
+                                            p.m,
+                                            p.n,
+                                            p.k,
+                                            alpha,
+                                            A,
+                                            p.a_type,
+                                            p.lda,
+                                            p.stride_A,
+                                            B,
+                                            p.b_type,
+                                            p.ldb,
+                                            p.stride_B,
+                                            beta,
+                                            C,
+                                            p.c_type,
+                                            p.ldc,
+                                            p.stride_C,
+                                            C,
+                                            p.c_type,
+                                            p.ldc,
+                                            p.stride_C,
+                                            p.batch_count,
+                                            p.compute_type,
+                                            rocblas_gemm_algo_solution_index,
+                                            p.solution_index,
+                                            p.flags));
+    }
+
+    if(p.batch_count == 1)
+        return hipblasConvertStatus(hipblasTunedGemmEx<int>((rocblas_handle)handle,
+                                                            p.transa,
+                                                            p.transb,
+                                                            p.m,
+                                                            p.n,
+                                                            p.k,
+                                                            alpha,
+                                                            A,
+                                                            p.a_type,
+                                                            p.lda,
+                                                            B,
+                                                            p.b_type,
+                                                            p.ldb,
+                                                            beta,
+                                                            C,
+                                                            p.c_type,
+                                                            p.ldc,
+                                                            p.compute_type,
+                                                            rocblas_gemm_algo_standard,
+                                                            p.flags));
+
+    return hipblasConvertStatus(hipblasTunedGemmStridedBatchedEx<int>((rocblas_handle)handle,
+                                                                      p.transa,
+                                                                      p.transb,
+                                                                      p.m,
+                                                                      p.n,
+                                                                      p.k,
+                                                                      alpha,
+                                                                      A,
+                                                                      p.a_type,
+                                                                      p.lda,
+                                                                      p.stride_A,
+                                                                      B,
+                                                                      p.b_type,
+                                                                      p.ldb,
+                                                                      p.stride_B,
+                                                                      beta,
+                                                                      C,
+                                                                      p.c_type,
+                                                                      p.ldc,
+                                                                      p.stride_C,
+                                                                      p.batch_count,
+                                                                      p.compute_type,
+                                                                      rocblas_gemm_algo_standard,
+                                                                      p.flags));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmGroupedBatchedEx(hipblasHandle_t          handle,
+                                            const hipblasOperation_t transa_array[],
+                                            const hipblasOperation_t transb_array[],
+                                            const int                m_array[],
+                                            const int                n_array[],
+                                            const int                k_array[],
+                                            const void*              alpha_array,
+                                            const void* const        A_array[],
+                                            hipDataType              a_type,
+                                            const int                lda_array[],
+                                            const void* const        B_array[],
+                                            hipDataType              b_type,
+                                            const int                ldb_array[],
+                                            const void*              beta_array,
+                                            void* const              C_array[],
+                                            hipDataType              c_type,
+                                            const int                ldc_array[],
+                                            int                      group_count,
+                                            const int                group_size[],
+                                            hipblasComputeType_t     compute_type)
+try
+{
+    HIPBLAS_ENTRY(handle, a_type, b_type, c_type, group_count, compute_type);
+
+    return hipblasGemmGroupedBatchedExImpl(handle,
+                                           transa_array,
+                                           transb_array,
+                                           m_array,
+                                           n_array,
+                                           k_array,
+                                           alpha_array,
+                                           A_array,
+                                           a_type,
+                                           lda_array,
+                                           B_array,
+                                           b_type,
+                                           ldb_array,
+                                           beta_array,
+                                           C_array,
+                                           c_type,
+                                           ldc_array,
+                                           group_count,
+                                           group_size,
+                                           compute_type);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmGroupedBatchedEx_64(hipblasHandle_t          handle,
+                                               const hipblasOperation_t transa_array[],
+                                               const hipblasOperation_t transb_array[],
+                                               const int64_t            m_array[],
+                                               const int64_t            n_array[],
+                                               const int64_t            k_array[],
+                                               const void*              alpha_array,
+                                               const void* const        A_array[],
+                                               hipDataType              a_type,
+                                               const int64_t            lda_array[],
+                                               const void* const        B_array[],
+                                               hipDataType              b_type,
+                                               const int64_t            ldb_array[],
+                                               const void*              beta_array,
+                                               void* const              C_array[],
+                                               hipDataType              c_type,
+                                               const int64_t            ldc_array[],
+                                               int64_t                  group_count,
+                                               const int64_t            group_size[],
+                                               hipblasComputeType_t     compute_type)
+try
+{
+    HIPBLAS_ENTRY(handle, a_type, b_type, c_type, group_count, compute_type);
+
+    return hipblasGemmGroupedBatchedExImpl(handle,
+                                           transa_array,
+                                           transb_array,
+                                           m_array,
+                                           n_array,
+                                           k_array,
+                                           alpha_array,
+                                           A_array,
+                                           a_type,
+                                           lda_array,
+                                           B_array,
+                                           b_type,
+                                           ldb_array,
+                                           beta_array,
+                                           C_array,
+                                           c_type,
+                                           ldc_array,
+                                           group_count,
+                                           group_size,
+                                           compute_type);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// gemm_ex_64
+hipblasStatus_t hipblasGemmEx_64(hipblasHandle_t    handle,
+                                 hipblasOperation_t transa,
+                                 hipblasOperation_t transb,
+                                 int64_t            m,
+                                 int64_t            n,
+                                 int64_t            k,
+                                 const void*        alpha,
+                                 const void*        A,
+                                 hipblasDatatype_t  a_type,
+                                 int64_t            lda,
+                                 const void*        B,
+                                 hipblasDatatype_t  b_type,
+                                 int64_t            ldb,
+                                 const void*        beta,
+                                 void*              C,
+                                 hipblasDatatype_t  c_type,
+                                 int64_t            ldc,
+                                 hipblasDatatype_t  compute_type,
+                                 hipblasGemmAlgo_t  algo)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, transa, transb, m, n, k, a_type, lda, b_type, ldb, c_type, ldc, compute_type, algo);
+
+    rocblas_gemm_flags flags = rocblas_gemm_flags_none;
+
+    return hipblasConvertStatus(hipblasTunedGemmEx<int64_t>((rocblas_handle)handle,
+                                                            hipblasConvertOperation(transa),
+                                                            hipblasConvertOperation(transb),
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            alpha,
+                                                            A,
+                                                            hipblasConvertDatatype(a_type),
+                                                            lda,
+                                                            B,
+                                                            hipblasConvertDatatype(b_type),
+                                                            ldb,
+                                                            beta,
+                                                            C,
+                                                            hipblasConvertDatatype(c_type),
+                                                            ldc,
+                                                            hipblasConvertDatatype(compute_type),
+                                                            hipblasConvertGemmAlgo(algo),
+                                                            flags));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmEx_v2_64(hipblasHandle_t      handle,
+                                    hipblasOperation_t   transa,
+                                    hipblasOperation_t   transb,
+                                    int64_t              m,
+                                    int64_t              n,
+                                    int64_t              k,
+                                    const void*          alpha,
+                                    const void*          A,
+                                    hipDataType          a_type,
+                                    int64_t              lda,
+                                    const void*          B,
+                                    hipDataType          b_type,
+                                    int64_t              ldb,
+                                    const void*          beta,
+                                    void*                C,
+                                    hipDataType          c_type,
+                                    int64_t              ldc,
+                                    hipblasComputeType_t compute_type,
+                                    hipblasGemmAlgo_t    algo)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, transa, transb, m, n, k, a_type, lda, b_type, ldb, c_type, ldc, compute_type, algo);
+    hipblasPrefetchGemm(handle,
+                        transa,
+                        transb,
+                        m,
+                        n,
+                        k,
+                        A,
+                        lda,
+                        0,
+                        B,
+                        ldb,
+                        0,
+                        C,
+                        ldc,
+                        0,
+                        1,
+                        hipblasPrefetchTypeSize(a_type),
+                        hipblasPrefetchTypeSize(b_type),
+                        hipblasPrefetchTypeSize(c_type));
+
+    // Not necessarily a 1-to-1 mapping between hipblasComputeType_t and rocblas_datatype, so handling supported cases
+    // individually, can be changed with rocBLAS if/when related changes happen there.
+
+    rocblas_gemm_flags flags = rocblas_gemm_flags_none;
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasFastComputeScope fast_compute(handle, compute_type);
+
+    return hipblasConvertStatus(hipblasTunedGemmEx<int64_t>((rocblas_handle)handle,
+                                                            hipblasConvertOperation(transa),
+                                                            hipblasConvertOperation(transb),
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            alpha,
+                                                            A,
+                                                            a_type_roc,
+                                                            lda,
+                                                            B,
+                                                            b_type_roc,
+                                                            ldb,
+                                                            beta,
+                                                            C,
+                                                            c_type_roc,
+                                                            ldc,
+                                                            compute_type_roc,
+                                                            hipblasConvertGemmAlgo(algo),
+                                                            flags));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmExWithFlags_64(hipblasHandle_t    handle,
+                                          hipblasOperation_t transa,
+                                          hipblasOperation_t transb,
+                                          int64_t            m,
+                                          int64_t            n,
+                                          int64_t            k,
+                                          const void*        alpha,
+                                          const void*        A,
+                                          hipblasDatatype_t  a_type,
+                                          int64_t            lda,
+                                          const void*        B,
+                                          hipblasDatatype_t  b_type,
+                                          int64_t            ldb,
+                                          const void*        beta,
+                                          void*              C,
+                                          hipblasDatatype_t  c_type,
+                                          int64_t            ldc,
+                                          hipblasDatatype_t  compute_type,
+                                          hipblasGemmAlgo_t  algo,
+                                          hipblasGemmFlags_t flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  compute_type,
+                  algo,
+                  flags);
+
+    rocblas_gemm_flags flags_roc = hipblasConvertGemmFlags(flags);
+    if(hipblasStatus_t enum_status = hipblasTakeEnumStatus())
+        return enum_status;
+
+    return hipblasConvertStatus(hipblasTunedGemmEx<int64_t>((rocblas_handle)handle,
+                                                            hipblasConvertOperation(transa),
+                                                            hipblasConvertOperation(transb),
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            alpha,
+                                                            A,
+                                                            hipblasConvertDatatype(a_type),
+                                                            lda,
+                                                            B,
+                                                            hipblasConvertDatatype(b_type),
+                                                            ldb,
+                                                            beta,
+                                                            C,
+                                                            hipblasConvertDatatype(c_type),
+                                                            ldc,
+                                                            hipblasConvertDatatype(compute_type),
+                                                            hipblasConvertGemmAlgo(algo),
+                                                            flags_roc));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmExWithFlags_v2_64(hipblasHandle_t      handle,
+                                             hipblasOperation_t   transa,
+                                             hipblasOperation_t   transb,
+                                             int64_t              m,
+                                             int64_t              n,
+                                             int64_t              k,
+                                             const void*          alpha,
+                                             const void*          A,
+                                             hipDataType          a_type,
+                                             int64_t              lda,
+                                             const void*          B,
+                                             hipDataType          b_type,
+                                             int64_t              ldb,
+                                             const void*          beta,
+                                             void*                C,
+                                             hipDataType          c_type,
+                                             int64_t              ldc,
+                                             hipblasComputeType_t compute_type,
+                                             hipblasGemmAlgo_t    algo,
+                                             hipblasGemmFlags_t   flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  compute_type,
+                  algo,
+                  flags);
+
+    // Not necessarily a 1-to-1 mapping between hipblasComputeType_t and rocblas_datatype, so handling supported cases
+    // individually, can be changed with rocBLAS if/when related changes happen there.
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasFastComputeScope fast_compute(handle, compute_type);
+
+    rocblas_gemm_flags flags_roc = hipblasConvertGemmFlags(flags);
+    if(hipblasStatus_t enum_status = hipblasTakeEnumStatus())
+        return enum_status;
+
+    return hipblasConvertStatus(hipblasTunedGemmEx<int64_t>((rocblas_handle)handle,
+                                                            hipblasConvertOperation(transa),
+                                                            hipblasConvertOperation(transb),
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            alpha,
+                                                            A,
+                                                            a_type_roc,
+                                                            lda,
+                                                            B,
+                                                            b_type_roc,
+                                                            ldb,
+                                                            beta,
+                                                            C,
+                                                            c_type_roc,
+                                                            ldc,
+                                                            compute_type_roc,
+                                                            hipblasConvertGemmAlgo(algo),
+                                                            flags_roc));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedEx_64(hipblasHandle_t    handle,
+                                        hipblasOperation_t transa,
+                                        hipblasOperation_t transb,
+                                        int64_t            m,
+                                        int64_t            n,
+                                        int64_t            k,
+                                        const void*        alpha,
+                                        const void*        A[],
+                                        hipblasDatatype_t  a_type,
+                                        int64_t            lda,
+                                        const void*        B[],
+                                        hipblasDatatype_t  b_type,
+                                        int64_t            ldb,
+                                        const void*        beta,
+                                        void*              C[],
+                                        hipblasDatatype_t  c_type,
+                                        int64_t            ldc,
+                                        int64_t            batch_count,
+                                        hipblasDatatype_t  compute_type,
+                                        hipblasGemmAlgo_t  algo)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  batch_count,
+                  compute_type,
+                  algo);
+
+    rocblas_gemm_flags flags = rocblas_gemm_flags_none;
+
+    return hipblasConvertStatus(
+        hipblasTunedGemmBatchedEx<int64_t>((rocblas_handle)handle,
+                                           hipblasConvertOperation(transa),
+                                           hipblasConvertOperation(transb),
+                                           m,
+                                           n,
+                                           k,
+                                           alpha,
+                                           (void*)A,
+                                           hipblasConvertDatatype(a_type),
+                                           lda,
+                                           (void*)B,
+                                           hipblasConvertDatatype(b_type),
+                                           ldb,
+                                           beta,
+                                           (void*)C,
+                                           hipblasConvertDatatype(c_type),
+                                           ldc,
+                                           batch_count,
+                                           hipblasConvertDatatype(compute_type),
+                                           hipblasConvertGemmAlgo(algo),
+                                           flags));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedEx_v2_64(hipblasHandle_t      handle,
+                                           hipblasOperation_t   transa,
+                                           hipblasOperation_t   transb,
+                                           int64_t              m,
+                                           int64_t              n,
+                                           int64_t              k,
+                                           const void*          alpha,
+                                           const void*          A[],
+                                           hipDataType          a_type,
+                                           int64_t              lda,
+                                           const void*          B[],
+                                           hipDataType          b_type,
+                                           int64_t              ldb,
+                                           const void*          beta,
+                                           void*                C[],
+                                           hipDataType          c_type,
+                                           int64_t              ldc,
+                                           int64_t              batch_count,
+                                           hipblasComputeType_t compute_type,
+                                           hipblasGemmAlgo_t    algo)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  batch_count,
+                  compute_type,
+                  algo);
+
+    hipblasStatus_t small = hipblasSmallGemm(handle,
+                                             transa,
+                                             transb,
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             a_type,
+                                             lda,
+                                             0,
+                                             B,
+                                             b_type,
+                                             ldb,
+                                             0,
+                                             beta,
+                                             C,
+                                             c_type,
+                                             ldc,
+                                             0,
+                                             batch_count,
+                                             compute_type,
+                                             true);
+    if(small != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return small;
+
+    // Not necessarily a 1-to-1 mapping between hipblasComputeType_t and rocblas_datatype, so handling supported cases
+    // individually, can be changed with rocBLAS if/when related changes happen there.
+
+    rocblas_gemm_flags flags = rocblas_gemm_flags_none;
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasFastComputeScope fast_compute(handle, compute_type);
+
+    return hipblasConvertStatus(
+        hipblasTunedGemmBatchedEx<int64_t>((rocblas_handle)handle,
+                                           hipblasConvertOperation(transa),
+                                           hipblasConvertOperation(transb),
+                                           m,
+                                           n,
+                                           k,
+                                           alpha,
+                                           (void*)A,
+                                           a_type_roc,
+                                           lda,
+                                           (void*)B,
+                                           b_type_roc,
+                                           ldb,
+                                           beta,
+                                           (void*)C,
+                                           c_type_roc,
+                                           ldc,
+                                           batch_count,
+                                           compute_type_roc,
+                                           hipblasConvertGemmAlgo(algo),
+                                           flags));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedExWithFlags_64(hipblasHandle_t    handle,
+                                                 hipblasOperation_t transa,
+                                                 hipblasOperation_t transb,
+                                                 int64_t            m,
+                                                 int64_t            n,
+                                                 int64_t            k,
+                                                 const void*        alpha,
+                                                 const void*        A[],
+                                                 hipblasDatatype_t  a_type,
+                                                 int64_t            lda,
+                                                 const void*        B[],
+                                                 hipblasDatatype_t  b_type,
+                                                 int64_t            ldb,
+                                                 const void*        beta,
+                                                 void*              C[],
+                                                 hipblasDatatype_t  c_type,
+                                                 int64_t            ldc,
+                                                 int64_t            batch_count,
+                                                 hipblasDatatype_t  compute_type,
+                                                 hipblasGemmAlgo_t  algo,
+                                                 hipblasGemmFlags_t flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  batch_count,
+                  compute_type,
+                  algo,
+                  flags);
+
+    rocblas_gemm_flags flags_roc = hipblasConvertGemmFlags(flags);
+    if(hipblasStatus_t enum_status = hipblasTakeEnumStatus())
+        return enum_status;
+
+    return hipblasConvertStatus(
+        hipblasTunedGemmBatchedEx<int64_t>((rocblas_handle)handle,
+                                           hipblasConvertOperation(transa),
+                                           hipblasConvertOperation(transb),
+                                           m,
+                                           n,
+                                           k,
+                                           alpha,
+                                           (void*)A,
+                                           hipblasConvertDatatype(a_type),
+                                           lda,
+                                           (void*)B,
+                                           hipblasConvertDatatype(b_type),
+                                           ldb,
+                                           beta,
+                                           (void*)C,
+                                           hipblasConvertDatatype(c_type),
+                                           ldc,
+                                           batch_count,
+                                           hipblasConvertDatatype(compute_type),
+                                           hipblasConvertGemmAlgo(algo),
+                                           flags_roc));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedExWithFlags_v2_64(hipblasHandle_t      handle,
+                                                    hipblasOperation_t   transa,
+                                                    hipblasOperation_t   transb,
+                                                    int64_t              m,
+                                                    int64_t              n,
+                                                    int64_t              k,
+                                                    const void*          alpha,
+                                                    const void*          A[],
+                                                    hipDataType          a_type,
+                                                    int64_t              lda,
+                                                    const void*          B[],
+                                                    hipDataType          b_type,
+                                                    int64_t              ldb,
+                                                    const void*          beta,
+                                                    void*                C[],
+                                                    hipDataType          c_type,
+                                                    int64_t              ldc,
+                                                    int64_t              batch_count,
+                                                    hipblasComputeType_t compute_type,
+                                                    hipblasGemmAlgo_t    algo,
+                                                    hipblasGemmFlags_t   flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  batch_count,
+                  compute_type,
+                  algo,
+                  flags);
+
+    hipblasStatus_t small = hipblasSmallGemm(handle,
+                                             transa,
+                                             transb,
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             a_type,
+                                             lda,
+                                             0,
+                                             B,
+                                             b_type,
+                                             ldb,
+                                             0,
+                                             beta,
+                                             C,
+                                             c_type,
+                                             ldc,
+                                             0,
+                                             batch_count,
+                                             compute_type,
+                                             true);
+    if(small != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return small;
+
+    // Not necessarily a 1-to-1 mapping between hipblasComputeType_t and rocblas_datatype, so handling supported cases
+    // individually, can be changed with rocBLAS if/when related changes happen there.
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasFastComputeScope fast_compute(handle, compute_type);
+
+    rocblas_gemm_flags flags_roc = hipblasConvertGemmFlags(flags);
+    if(hipblasStatus_t enum_status = hipblasTakeEnumStatus())
+        return enum_status;
+
+    return hipblasConvertStatus(
+        hipblasTunedGemmBatchedEx<int64_t>((rocblas_handle)handle,
+                                           hipblasConvertOperation(transa),
+                                           hipblasConvertOperation(transb),
+                                           m,
+                                           n,
+                                           k,
+                                           alpha,
+                                           (void*)A,
+                                           a_type_roc,
+                                           lda,
+                                           (void*)B,
+                                           b_type_roc,
+                                           ldb,
+                                           beta,
+                                           (void*)C,
+                                           c_type_roc,
+                                           ldc,
+                                           batch_count,
+                                           compute_type_roc,
+                                           hipblasConvertGemmAlgo(algo),
+                                           flags_roc));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedEx_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t transa,
+                                               hipblasOperation_t transb,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const void*        alpha,
+                                               const void*        A,
+                                               hipblasDatatype_t  a_type,
+                                               int64_t            lda,
+                                               hipblasStride      stride_A,
+                                               const void*        B,
+                                               hipblasDatatype_t  b_type,
+                                               int64_t            ldb,
+                                               hipblasStride      stride_B,
+                                               const void*        beta,
+                                               void*              C,
+                                               hipblasDatatype_t  c_type,
+                                               int64_t            ldc,
+                                               hipblasStride      stride_C,
+                                               int64_t            batch_count,
+                                               hipblasDatatype_t  compute_type,
+                                               hipblasGemmAlgo_t  algo)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  stride_A,
+                  b_type,
+                  ldb,
+                  stride_B,
+                  c_type,
+                  ldc,
+                  stride_C,
+                  batch_count,
+                  compute_type,
+                  algo);
+
+    rocblas_gemm_flags flags = rocblas_gemm_flags_none;
+
+    return hipblasConvertStatus(
+        hipblasTunedGemmStridedBatchedEx<int64_t>((rocblas_handle)handle,
+                                                  hipblasConvertOperation(transa),
+                                                  hipblasConvertOperation(transb),
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  A,
+                                                  hipblasConvertDatatype(a_type),
+                                                  lda,
+                                                  stride_A,
+                                                  B,
+                                                  hipblasConvertDatatype(b_type),
+                                                  ldb,
+                                                  stride_B,
+                                                  beta,
+                                                  C,
+                                                  hipblasConvertDatatype(c_type),
+                                                  ldc,
+                                                  stride_C,
+                                                  batch_count,
+                                                  hipblasConvertDatatype(compute_type),
+                                                  hipblasConvertGemmAlgo(algo),
+                                                  flags));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedEx_v2_64(hipblasHandle_t      handle,
+                                                  hipblasOperation_t   transa,
+                                                  hipblasOperation_t   transb,
+                                                  int64_t              m,
+                                                  int64_t              n,
+                                                  int64_t              k,
+                                                  const void*          alpha,
+                                                  const void*          A,
+                                                  hipDataType          a_type,
+                                                  int64_t              lda,
+                                                  hipblasStride        stride_A,
+                                                  const void*          B,
+                                                  hipDataType          b_type,
+                                                  int64_t              ldb,
+                                                  hipblasStride        stride_B,
+                                                  const void*          beta,
+                                                  void*                C,
+                                                  hipDataType          c_type,
+                                                  int64_t              ldc,
+                                                  hipblasStride        stride_C,
+                                                  int64_t              batch_count,
+                                                  hipblasComputeType_t compute_type,
+                                                  hipblasGemmAlgo_t    algo)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  stride_A,
+                  b_type,
+                  ldb,
+                  stride_B,
+                  c_type,
+                  ldc,
+                  stride_C,
+                  batch_count,
+                  compute_type,
+                  algo);
+    hipblasPrefetchGemm(handle,
+                        transa,
+                        transb,
+                        m,
+                        n,
+                        k,
+                        A,
+                        lda,
+                        stride_A,
+                        B,
+                        ldb,
+                        stride_B,
+                        C,
+                        ldc,
+                        stride_C,
+                        batch_count,
+                        hipblasPrefetchTypeSize(a_type),
+                        hipblasPrefetchTypeSize(b_type),
+                        hipblasPrefetchTypeSize(c_type));
+
+    hipblasStatus_t broadcast = hipblasBroadcastGemm(handle,
+                                                     transa,
+                                                     transb,
+                                                     m,
+                                                     n,
+                                                     k,
+                                                     alpha,
+                                                     A,
+                                                     a_type,
+                                                     lda,
+                                                     stride_A,
+                                                     B,
+                                                     b_type,
+                                                     ldb,
+                                                     stride_B,
+                                                     beta,
+                                                     C,
+                                                     c_type,
+                                                     ldc,
+                                                     stride_C,
+                                                     batch_count,
+                                                     compute_type,
+                                                     algo,
+                                                     HIPBLAS_GEMM_FLAGS_NONE);
+    if(broadcast != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return broadcast;
+
+    hipblasStatus_t small = hipblasSmallGemm(handle,
+                                             transa,
+                                             transb,
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             a_type,
+                                             lda,
+                                             stride_A,
+                                             B,
+                                             b_type,
+                                             ldb,
+                                             stride_B,
+                                             beta,
+                                             C,
+                                             c_type,
+                                             ldc,
+                                             stride_C,
+                                             batch_count,
+                                             compute_type,
+                                             false);
+    if(small != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return small;
+
+    // Not necessarily a 1-to-1 mapping between hipblasComputeType_t and rocblas_datatype, so handling supported cases
+    // individually, can be changed with rocBLAS if/when related changes happen there.
+
+    rocblas_gemm_flags flags = rocblas_gemm_flags_none;
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasFastComputeScope fast_compute(handle, compute_type);
+
+    return hipblasConvertStatus(
+        hipblasTunedGemmStridedBatchedEx<int64_t>((rocblas_handle)handle,
+                                                  hipblasConvertOperation(transa),
+                                                  hipblasConvertOperation(transb),
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  A,
+                                                  a_type_roc,
+                                                  lda,
+                                                  stride_A,
+                                                  B,
+                                                  b_type_roc,
+                                                  ldb,
+                                                  stride_B,
+                                                  beta,
+                                                  C,
+                                                  c_type_roc,
+                                                  ldc,
+                                                  stride_C,
+                                                  batch_count,
+                                                  compute_type_roc,
+                                                  hipblasConvertGemmAlgo(algo),
+                                                  flags));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExWithFlags_64(hipblasHandle_t    handle,
+                                                        hipblasOperation_t transa,
+                                                        hipblasOperation_t transb,
+                                                        int64_t            m,
+                                                        int64_t            n,
+                                                        int64_t            k,
+                                                        const void*        alpha,
+                                                        const void*        A,
+                                                        hipblasDatatype_t  a_type,
+                                                        int64_t            lda,
+                                                        hipblasStride      stride_A,
+                                                        const void*        B,
+                                                        hipblasDatatype_t  b_type,
+                                                        int64_t            ldb,
+                                                        hipblasStride      stride_B,
+                                                        const void*        beta,
+                                                        void*              C,
+                                                        hipblasDatatype_t  c_type,
+                                                        int64_t            ldc,
+                                                        hipblasStride      stride_C,
+                                                        int64_t            batch_count,
+                                                        hipblasDatatype_t  compute_type,
+                                                        hipblasGemmAlgo_t  algo,
+                                                        hipblasGemmFlags_t flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  stride_A,
+                  b_type,
+                  ldb,
+                  stride_B,
+                  c_type,
+                  ldc,
+                  stride_C,
+                  batch_count,
+                  compute_type,
+                  algo,
+                  flags);
+
+    rocblas_gemm_flags flags_roc = hipblasConvertGemmFlags(flags);
+    if(hipblasStatus_t enum_status = hipblasTakeEnumStatus())
+        return enum_status;
+
+    return hipblasConvertStatus(
+        hipblasTunedGemmStridedBatchedEx<int64_t>((rocblas_handle)handle,
+                                                  hipblasConvertOperation(transa),
+                                                  hipblasConvertOperation(transb),
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  A,
+                                                  hipblasConvertDatatype(a_type),
+                                                  lda,
+                                                  stride_A,
+                                                  B,
+                                                  hipblasConvertDatatype(b_type),
+                                                  ldb,
+                                                  stride_B,
+                                                  beta,
+                                                  C,
+                                                  hipblasConvertDatatype(c_type),
+                                                  ldc,
+                                                  stride_C,
+                                                  batch_count,
+                                                  hipblasConvertDatatype(compute_type),
+                                                  hipblasConvertGemmAlgo(algo),
+                                                  flags_roc));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExWithFlags_v2_64(hipblasHandle_t      handle,
+                                                           hipblasOperation_t   transa,
+                                                           hipblasOperation_t   transb,
+                                                           int64_t              m,
+                                                           int64_t              n,
+                                                           int64_t              k,
+                                                           const void*          alpha,
+                                                           const void*          A,
+                                                           hipDataType          a_type,
+                                                           int64_t              lda,
+                                                           hipblasStride        stride_A,
+                                                           const void*          B,
+                                                           hipDataType          b_type,
+                                                           int64_t              ldb,
+                                                           hipblasStride        stride_B,
+                                                           const void*          beta,
+                                                           void*                C,
+                                                           hipDataType          c_type,
+                                                           int64_t              ldc,
+                                                           hipblasStride        stride_C,
+                                                           int64_t              batch_count,
+                                                           hipblasComputeType_t compute_type,
+                                                           hipblasGemmAlgo_t    algo,
+                                                           hipblasGemmFlags_t   flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  stride_A,
+                  b_type,
+                  ldb,
+                  stride_B,
+                  c_type,
+                  ldc,
+                  stride_C,
+                  batch_count,
+                  compute_type,
+                  algo,
+                  flags);
+
+    hipblasStatus_t broadcast = hipblasBroadcastGemm(handle,
+                                                     transa,
+                                                     transb,
+                                                     m,
+                                                     n,
+                                                     k,
+                                                     alpha,
+                                                     A,
+                                                     a_type,
+                                                     lda,
+                                                     stride_A,
+                                                     B,
+                                                     b_type,
+                                                     ldb,
+                                                     stride_B,
+                                                     beta,
+                                                     C,
+                                                     c_type,
+                                                     ldc,
+                                                     stride_C,
+                                                     batch_count,
+                                                     compute_type,
+                                                     algo,
+                                                     flags);
+    if(broadcast != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return broadcast;
+
+    hipblasStatus_t small = hipblasSmallGemm(handle,
+                                             transa,
+                                             transb,
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             a_type,
+                                             lda,
+                                             stride_A,
+                                             B,
+                                             b_type,
+                                             ldb,
+                                             stride_B,
+                                             beta,
+                                             C,
+                                             c_type,
+                                             ldc,
+                                             stride_C,
+                                             batch_count,
+                                             compute_type,
+                                             false);
+    if(small != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return small;
+
+    // Not necessarily a 1-to-1 mapping between hipblasComputeType_t and rocblas_datatype, so handling supported cases
+    // individually, can be changed with rocBLAS if/when related changes happen there.
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasFastComputeScope fast_compute(handle, compute_type);
+
+    rocblas_gemm_flags flags_roc = hipblasConvertGemmFlags(flags);
+    if(hipblasStatus_t enum_status = hipblasTakeEnumStatus())
+        return enum_status;
+
+    return hipblasConvertStatus(
+        hipblasTunedGemmStridedBatchedEx<int64_t>((rocblas_handle)handle,
+                                                  hipblasConvertOperation(transa),
+                                                  hipblasConvertOperation(transb),
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  A,
+                                                  a_type_roc,
+                                                  lda,
+                                                  stride_A,
+                                                  B,
+                                                  b_type_roc,
+                                                  ldb,
+                                                  stride_B,
+                                                  beta,
+                                                  C,
+                                                  c_type_roc,
+                                                  ldc,
+                                                  stride_C,
+                                                  batch_count,
+                                                  compute_type_roc,
+                                                  hipblasConvertGemmAlgo(algo),
+                                                  flags_roc));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// gemv_ex
+// The type combinations of gemv_ex, named as the rocBLAS functions after the types of A and x,
+// of the computation and of y
+enum hipblasGemvExTypes
+{
+    HIPBLAS_GEMV_EX_HSH,
+    HIPBLAS_GEMV_EX_HSS,
+    HIPBLAS_GEMV_EX_TST,
+    HIPBLAS_GEMV_EX_TSS,
+    HIPBLAS_GEMV_EX_S,
+    HIPBLAS_GEMV_EX_D,
+    HIPBLAS_GEMV_EX_C,
+    HIPBLAS_GEMV_EX_Z,
+};
+
+static hipblasStatus_t hipblasGetGemvExTypes(hipDataType          a_type,
+                                             hipDataType          x_type,
+                                             hipDataType          y_type,
+                                             hipblasComputeType_t compute_type,
+                                             hipblasGemvExTypes&  types)
+{
+    bool compute_32f
+        = compute_type == HIPBLAS_COMPUTE_32F || compute_type == HIPBLAS_COMPUTE_32F_PEDANTIC;
+    bool compute_64f
+        = compute_type == HIPBLAS_COMPUTE_64F || compute_type == HIPBLAS_COMPUTE_64F_PEDANTIC;
+
+    if(a_type != x_type)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    else if(a_type == HIP_R_16F && y_type == HIP_R_16F && compute_32f)
+        types = HIPBLAS_GEMV_EX_HSH;
+    else if(a_type == HIP_R_16F && y_type == HIP_R_32F && compute_32f)
+        types = HIPBLAS_GEMV_EX_HSS;
+    else if(a_type == HIP_R_16BF && y_type == HIP_R_16BF && compute_32f)
+        types = HIPBLAS_GEMV_EX_TST;
+    else if(a_type == HIP_R_16BF && y_type == HIP_R_32F && compute_32f)
+        types = HIPBLAS_GEMV_EX_TSS;
+    else if(a_type == HIP_R_32F && y_type == HIP_R_32F && compute_32f)
+        types = HIPBLAS_GEMV_EX_S;
+    else if(a_type == HIP_R_64F && y_type == HIP_R_64F && compute_64f)
+        types = HIPBLAS_GEMV_EX_D;
+    else if(a_type == HIP_C_32F && y_type == HIP_C_32F && compute_32f)
+        types = HIPBLAS_GEMV_EX_C;
+    else if(a_type == HIP_C_64F && y_type == HIP_C_64F && compute_64f)
+        types = HIPBLAS_GEMV_EX_Z;
+    else
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+static hipblasStatus_t hipblasGemvStridedBatchedExImpl(hipblasHandle_t      handle,
+                                                       hipblasOperation_t   trans,
+                                                       int                  m,
+                                                       int                  n,
+                                                       const void*          alpha,
+                                                       const void*          A,
+                                                       hipDataType          a_type,
+                                                       int                  lda,
+                                                       hipblasStride        stride_A,
+                                                       const void*          x,
+                                                       hipDataType          x_type,
+                                                       int                  incx,
+                                                       hipblasStride        stride_x,
+                                                       const void*          beta,
+                                                       void*                y,
+                                                       hipDataType          y_type,
+                                                       int                  incy,
+                                                       hipblasStride        stride_y,
+                                                       int                  batch_count,
+                                                       hipblasComputeType_t compute_type)
+{
+    hipblasGemvExTypes types;
+    hipblasStatus_t    status = hipblasGetGemvExTypes(a_type, x_type, y_type, compute_type, types);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    rocblas_handle    roc_handle = (rocblas_handle)handle;
+    rocblas_operation roc_trans  = hipblasConvertOperation(trans);
+
+    switch(types)
+    {
+    case HIPBLAS_GEMV_EX_HSH:
+        return hipblasConvertStatus(rocblas_hshgemv_strided_batched(roc_handle,
+                                                                    roc_trans,
+                                                                    m,
+                                                                    n,
+                                                                    (const float*)alpha,
+                                                                    (const rocblas_half*)A,
+                                                                    lda,
+                                                                    stride_A,
+                                                                    (const rocblas_half*)x,
+                                                                    incx,
+                                                                    stride_x,
+                                                                    (const float*)beta,
+                                                                    (rocblas_half*)y,
+                                                                    incy,
+                                                                    stride_y,
+                                                                    batch_count));
+    case HIPBLAS_GEMV_EX_HSS:
+        return hipblasConvertStatus(rocblas_hssgemv_strided_batched(roc_handle,
+                                                                    roc_trans,
+                                                                    m,
+                                                                    n,
+                                                                    (const float*)alpha,
+                                                                    (const rocblas_half*)A,
+                                                                    lda,
+                                                                    stride_A,
+                                                                    (const rocblas_half*)x,
+                                                                    incx,
+                                                                    stride_x,
+                                                                    (const float*)beta,
+                                                                    (float*)y,
+                                                                    incy,
+                                                                    stride_y,
+                                                                    batch_count));
+    case HIPBLAS_GEMV_EX_TST:
+        return hipblasConvertStatus(rocblas_tstgemv_strided_batched(roc_handle,
+                                                                    roc_trans,
+                                                                    m,
+                                                                    n,
+                                                                    (const float*)alpha,
+                                                                    (const rocblas_bfloat16*)A,
+                                                                    lda,
+                                                                    stride_A,
+                                                                    (const rocblas_bfloat16*)x,
+                                                                    incx,
+                                                                    stride_x,
+                                                                    (const float*)beta,
+                                                                    (rocblas_bfloat16*)y,
+                                                                    incy,
+                                                                    stride_y,
+                                                                    batch_count));
+    case HIPBLAS_GEMV_EX_TSS:
+        return hipblasConvertStatus(rocblas_tssgemv_strided_batched(roc_handle,
+                                                                    roc_trans,
+                                                                    m,
+                                                                    n,
+                                                                    (const float*)alpha,
+                                                                    (const rocblas_bfloat16*)A,
+                                                                    lda,
+                                                                    stride_A,
+                                                                    (const rocblas_bfloat16*)x,
+                                                                    incx,
+                                                                    stride_x,
+                                                                    (const float*)beta,
+                                                                    (float*)y,
+                                                                    incy,
+                                                                    stride_y,
+                                                                    batch_count));
+    case HIPBLAS_GEMV_EX_S:
+        return hipblasConvertStatus(rocblas_sgemv_strided_batched(roc_handle,
+                                                                  roc_trans,
+                                                                  m,
+                                                                  n,
+                                                                  (const float*)alpha,
+                                                                  (const float*)A,
+                                                                  lda,
+                                                                  stride_A,
+                                                                  (const float*)x,
+                                                                  incx,
+                                                                  stride_x,
+                                                                  (const float*)beta,
+                                                                  (float*)y,
+                                                                  incy,
+                                                                  stride_y,
+                                                                  batch_count));
+    case HIPBLAS_GEMV_EX_D:
+        return hipblasConvertStatus(rocblas_dgemv_strided_batched(roc_handle,
+                                                                  roc_trans,
+                                                                  m,
+                                                                  n,
+                                                                  (const double*)alpha,
+                                                                  (const double*)A,
+                                                                  lda,
+                                                                  stride_A,
+                                                                  (const double*)x,
+                                                                  incx,
+                                                                  stride_x,
+                                                                  (const double*)beta,
+                                                                  (double*)y,
+                                                                  incy,
+                                                                  stride_y,
+                                                                  batch_count));
+    case HIPBLAS_GEMV_EX_C:
+        return hipblasConvertStatus(
+            rocblas_cgemv_strided_batched(roc_handle,
+                                          roc_trans,
+                                          m,
+                                          n,
+                                          (const rocblas_float_complex*)alpha,
+                                          (const rocblas_float_complex*)A,
+                                          lda,
+                                          stride_A,
+                                          (const rocblas_float_complex*)x,
+                                          incx,
+                                          stride_x,
+                                          (const rocblas_float_complex*)beta,
+                                          (rocblas_float_complex*)y,
+                                          incy,
+                                          stride_y,
+                                          batch_count));
+    case HIPBLAS_GEMV_EX_Z:
+        return hipblasConvertStatus(
+            rocblas_zgemv_strided_batched(roc_handle,
+                                          roc_trans,
+                                          m,
+                                          n,
+                                          (const rocblas_double_complex*)alpha,
+                                          (const rocblas_double_complex*)A,
+                                          lda,
+                                          stride_A,
+                                          (const rocblas_double_complex*)x,
+                                          incx,
+                                          stride_x,
+                                          (const rocblas_double_complex*)beta,
+                                          (rocblas_double_complex*)y,
+                                          incy,
+                                          stride_y,
+                                          batch_count));
+    }
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasGemvEx(hipblasHandle_t      handle,
+                              hipblasOperation_t   trans,
+                              int                  m,
+                              int                  n,
+                              const void*          alpha,
+                              const void*          A,
+                              hipDataType          aType,
+                              int                  lda,
+                              const void*          x,
+                              hipDataType          xType,
+                              int                  incx,
+                              const void*          beta,
+                              void*                y,
+                              hipDataType          yType,
+                              int                  incy,
+                              hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, aType, lda, xType, incx, yType, incy, computeType);
+    hipblasStatus_t persistent = hipblasPersistentGemv(handle,
+                                                       trans,
+                                                       m,
+                                                       n,
+                                                       alpha,
+                                                       A,
+                                                       aType,
+                                                       lda,
+                                                       x,
+                                                       xType,
+                                                       incx,
+                                                       beta,
+                                                       y,
+                                                       yType,
+                                                       incy,
+                                                       computeType);
+    if(persistent != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return persistent;
+
+    // rocBLAS has only batched mixed-precision gemvs, so this is a batch of one
+    return hipblasGemvStridedBatchedExImpl(handle,
+                                           trans,
+                                           m,
+                                           n,
+                                           alpha,
+                                           A,
+                                           aType,
+                                           lda,
+                                           0,
+                                           x,
+                                           xType,
+                                           incx,
+                                           0,
+                                           beta,
+                                           y,
+                                           yType,
+                                           incy,
+                                           0,
+                                           1,
+                                           computeType);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemvBatchedEx(hipblasHandle_t      handle,
+                                     hipblasOperation_t   trans,
+                                     int                  m,
+                                     int                  n,
+                                     const void*          alpha,
+                                     const void* const    A[],
+                                     hipDataType          aType,
+                                     int                  lda,
+                                     const void* const    x[],
+                                     hipDataType          xType,
+                                     int                  incx,
+                                     const void*          beta,
+                                     void* const          y[],
+                                     hipDataType          yType,
+                                     int                  incy,
+                                     int                  batchCount,
+                                     hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, trans, m, n, aType, lda, xType, incx, yType, incy, batchCount, computeType);
+
+    hipblasGemvExTypes types;
+    hipblasStatus_t    status = hipblasGetGemvExTypes(aType, xType, yType, computeType, types);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    rocblas_handle    roc_handle = (rocblas_handle)handle;
+    rocblas_operation roc_trans  = hipblasConvertOperation(trans);
+
+    switch(types)
+    {
+    case HIPBLAS_GEMV_EX_HSH:
+        return hipblasConvertStatus(rocblas_hshgemv_batched(roc_handle,
+                                                            roc_trans,
+                                                            m,
+                                                            n,
+                                                            (const float*)alpha,
+                                                            (const rocblas_half* const*)A,
+                                                            lda,
+                                                            (const rocblas_half* const*)x,
+                                                            incx,
+                                                            (const float*)beta,
+                                                            (rocblas_half* const*)y,
+                                                            incy,
+                                                            batchCount));
+    case HIPBLAS_GEMV_EX_HSS:
+        return hipblasConvertStatus(rocblas_hssgemv_batched(roc_handle,
+                                                            roc_trans,
+                                                            m,
+                                                            n,
+                                                            (const float*)alpha,
+                                                            (const rocblas_half* const*)A,
+                                                            lda,
+                                                            (const rocblas_half* const*)x,
+                                                            incx,
+                                                            (const float*)beta,
+                                                            (float* const*)y,
+                                                            incy,
+                                                            batchCount));
+    case HIPBLAS_GEMV_EX_TST:
+        return hipblasConvertStatus(rocblas_tstgemv_batched(roc_handle,
+                                                            roc_trans,
+                                                            m,
+                                                            n,
+                                                            (const float*)alpha,
+                                                            (const rocblas_bfloat16* const*)A,
+                                                            lda,
+                                                            (const rocblas_bfloat16* const*)x,
+                                                            incx,
+                                                            (const float*)beta,
+                                                            (rocblas_bfloat16* const*)y,
+                                                            incy,
+                                                            batchCount));
+    case HIPBLAS_GEMV_EX_TSS:
+        return hipblasConvertStatus(rocblas_tssgemv_batched(roc_handle,
+                                                            roc_trans,
+                                                            m,
+                                                            n,
+                                                            (const float*)alpha,
+                                                            (const rocblas_bfloat16* const*)A,
+                                                            lda,
+                                                            (const rocblas_bfloat16* const*)x,
+                                                            incx,
+                                                            (const float*)beta,
+                                                            (float* const*)y,
+                                                            incy,
+                                                            batchCount));
+    case HIPBLAS_GEMV_EX_S:
+        return hipblasConvertStatus(rocblas_sgemv_batched(roc_handle,
+                                                          roc_trans,
+                                                          m,
+                                                          n,
+                                                          (const float*)alpha,
+                                                          (const float* const*)A,
+                                                          lda,
+                                                          (const float* const*)x,
+                                                          incx,
+                                                          (const float*)beta,
+                                                          (float* const*)y,
+                                                          incy,
+                                                          batchCount));
+    case HIPBLAS_GEMV_EX_D:
+        return hipblasConvertStatus(rocblas_dgemv_batched(roc_handle,
+                                                          roc_trans,
+                                                          m,
+                                                          n,
+                                                          (const double*)alpha,
+                                                          (const double* const*)A,
+                                                          lda,
+                                                          (const double* const*)x,
+                                                          incx,
+                                                          (const double*)beta,
+                                                          (double* const*)y,
+                                                          incy,
+                                                          batchCount));
+    case HIPBLAS_GEMV_EX_C:
+        return hipblasConvertStatus(
+            rocblas_cgemv_batched(roc_handle,
+                                  roc_trans,
+                                  m,
+                                  n,
+                                  (const rocblas_float_complex*)alpha,
+                                  (const rocblas_float_complex* const*)A,
+                                  lda,
+                                  (const rocblas_float_complex* const*)x,
+                                  incx,
+                                  (const rocblas_float_complex*)beta,
+                                  (rocblas_float_complex* const*)y,
+                                  incy,
+                                  batchCount));
+    case HIPBLAS_GEMV_EX_Z:
+        return hipblasConvertStatus(
+            rocblas_zgemv_batched(roc_handle,
+                                  roc_trans,
+                                  m,
+                                  n,
+                                  (const rocblas_double_complex*)alpha,
+                                  (const rocblas_double_complex* const*)A,
+                                  lda,
+                                  (const rocblas_double_complex* const*)x,
+                                  incx,
+                                  (const rocblas_double_complex*)beta,
+                                  (rocblas_double_complex* const*)y,
+                                  incy,
+                                  batchCount));
+    }
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemvStridedBatchedEx(hipblasHandle_t      handle,
+                                            hipblasOperation_t   trans,
+                                            int                  m,
+                                            int                  n,
+                                            const void*          alpha,
+                                            const void*          A,
+                                            hipDataType          aType,
+                                            int                  lda,
+                                            hipblasStride        strideA,
+                                            const void*          x,
+                                            hipDataType          xType,
+                                            int                  incx,
+                                            hipblasStride        stridex,
+                                            const void*          beta,
+                                            void*                y,
+                                            hipDataType          yType,
+                                            int                  incy,
+                                            hipblasStride        stridey,
+                                            int                  batchCount,
+                                            hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  trans,
+                  m,
+                  n,
+                  aType,
+                  lda,
+                  strideA,
+                  xType,
+                  incx,
+                  stridex,
+                  yType,
+                  incy,
+                  stridey,
+                  batchCount,
+                  computeType);
+    if(xType == aType && yType == aType)
+    {
+        hipblasStatus_t shaped = hipblasShapeDispatchGemvBatch(handle,
+                                                               trans,
+                                                               m,
+                                                               n,
+                                                               alpha,
+                                                               A,
+                                                               lda,
+                                                               strideA,
+                                                               x,
+                                                               incx,
+                                                               stridex,
+                                                               beta,
+                                                               y,
+                                                               incy,
+                                                               stridey,
+                                                               batchCount,
+                                                               aType,
+                                                               computeType);
+        if(shaped != HIPBLAS_STATUS_NOT_SUPPORTED)
+            return shaped;
+    }
+
+    return hipblasGemvStridedBatchedExImpl(handle,
+                                           trans,
+                                           m,
+                                           n,
+                                           alpha,
+                                           A,
+                                           aType,
+                                           lda,
+                                           strideA,
+                                           x,
+                                           xType,
+                                           incx,
+                                           stridex,
+                                           beta,
+                                           y,
+                                           yType,
+                                           incy,
+                                           stridey,
+                                           batchCount,
+                                           computeType);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// trsm_ex
+hipblasStatus_t hipblasTrsmEx(hipblasHandle_t    handle,
+                              hipblasSideMode_t  side,
+                              hipblasFillMode_t  uplo,
+                              hipblasOperation_t transA,
+                              hipblasDiagType_t  diag,
+                              int                m,
+                              int                n,
+                              const void*        alpha,
+                              void*              A,
+                              int                lda,
+                              void*              B,
+                              int                ldb,
+                              const void*        invA,
+                              int                invA_size,
+                              hipblasDatatype_t  compute_type)
+try
+{
+    HIPBLAS_ENTRY(handle, side, uplo, transA, diag, m, n, lda, ldb, invA_size, compute_type);
+    return hipblasConvertStatus(rocblas_trsm_ex((rocblas_handle)handle,
+                                                hipblasConvertSide(side),
+                                                hipblasConvertFill(uplo),
+                                                hipblasConvertOperation(transA),
+                                                hipblasConvertDiag(diag),
+                                                m,
+                                                n,
+                                                alpha,
+                                                A,
+                                                lda,
+                                                B,
+                                                ldb,
+                                                invA,
+                                                invA_size,
+                                                hipblasConvertDatatype(compute_type)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasTrsmEx_v2(hipblasHandle_t    handle,
+                                 hipblasSideMode_t  side,
+                                 hipblasFillMode_t  uplo,
+                                 hipblasOperation_t transA,
+                                 hipblasDiagType_t  diag,
+                                 int                m,
+                                 int                n,
+                                 const void*        alpha,
+                                 void*              A,
+                                 int                lda,
+                                 void*              B,
+                                 int                ldb,
+                                 const void*        invA,
+                                 int                invA_size,
+                                 hipDataType        compute_type)
+try
+{
+    HIPBLAS_ENTRY(handle, side, uplo, transA, diag, m, n, lda, ldb, invA_size, compute_type);
+    return hipblasConvertStatus(rocblas_trsm_ex((rocblas_handle)handle,
+                                                hipblasConvertSide(side),
+                                                hipblasConvertFill(uplo),
+                                                hipblasConvertOperation(transA),
+                                                hipblasConvertDiag(diag),
+                                                m,
+                                                n,
+                                                alpha,
+                                                A,
+                                                lda,
+                                                B,
+                                                ldb,
+                                                invA,
+                                                invA_size,
+                                                hipblasConvertDatatype_v2(compute_type)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasTrsmBatchedEx(hipblasHandle_t    handle,
+                                     hipblasSideMode_t  side,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t transA,
+                                     hipblasDiagType_t  diag,
+                                     int                m,
+                                     int                n,
+                                     const void*        alpha,
+                                     void*              A,
+                                     int                lda,
+                                     void*              B,
+                                     int                ldb,
+                                     int                batch_count,
+                                     const void*        invA,
+                                     int                invA_size,
+                                     hipblasDatatype_t  compute_type)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, side, uplo, transA, diag, m, n, lda, ldb, batch_count, invA_size, compute_type);
+
+    return hipblasConvertStatus(rocblas_trsm_batched_ex((rocblas_handle)handle,
+                                                        hipblasConvertSide(side),
+                                                        hipblasConvertFill(uplo),
+                                                        hipblasConvertOperation(transA),
+                                                        hipblasConvertDiag(diag),
+                                                        m,
+                                                        n,
+                                                        alpha,
+                                                        A,
+                                                        lda,
+                                                        B,
+                                                        ldb,
+                                                        batch_count,
+                                                        invA,
+                                                        invA_size,
+                                                        hipblasConvertDatatype(compute_type)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasTrsmBatchedEx_v2(hipblasHandle_t    handle,
+                                        hipblasSideMode_t  side,
+                                        hipblasFillMode_t  uplo,
+                                        hipblasOperation_t transA,
+                                        hipblasDiagType_t  diag,
+                                        int                m,
+                                        int                n,
+                                        const void*        alpha,
+                                        void*              A,
+                                        int                lda,
+                                        void*              B,
+                                        int                ldb,
+                                        int                batch_count,
+                                        const void*        invA,
+                                        int                invA_size,
+                                        hipDataType        compute_type)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, side, uplo, transA, diag, m, n, lda, ldb, batch_count, invA_size, compute_type);
+
+    return hipblasConvertStatus(rocblas_trsm_batched_ex((rocblas_handle)handle,
+                                                        hipblasConvertSide(side),
+                                                        hipblasConvertFill(uplo),
+                                                        hipblasConvertOperation(transA),
+                                                        hipblasConvertDiag(diag),
+                                                        m,
+                                                        n,
+                                                        alpha,
+                                                        A,
+                                                        lda,
+                                                        B,
+                                                        ldb,
+                                                        batch_count,
+                                                        invA,
+                                                        invA_size,
+                                                        hipblasConvertDatatype_v2(compute_type)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasTrsmStridedBatchedEx(hipblasHandle_t    handle,
+                                            hipblasSideMode_t  side,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            hipblasDiagType_t  diag,
+                                            int                m,
+                                            int                n,
+                                            const void*        alpha,
+                                            void*              A,
+                                            int                lda,
+                                            hipblasStride      stride_A,
+                                            void*              B,
+                                            int                ldb,
+                                            hipblasStride      stride_B,
+                                            int                batch_count,
+                                            const void*        invA,
+                                            int                invA_size,
+                                            hipblasStride      stride_invA,
+                                            hipblasDatatype_t  compute_type)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  side,
+                  uplo,
+                  transA,
+                  diag,
+                  m,
+                  n,
+                  lda,
+                  stride_A,
+                  ldb,
+                  stride_B,
+                  batch_count,
+                  invA_size,
+                  stride_invA,
+                  compute_type);
+
+    return hipblasConvertStatus(
+        rocblas_trsm_strided_batched_ex((rocblas_handle)handle,
+                                        hipblasConvertSide(side),
+                                        hipblasConvertFill(uplo),
+                                        hipblasConvertOperation(transA),
+                                        hipblasConvertDiag(diag),
+                                        m,
+                                        n,
+                                        alpha,
+                                        A,
+                                        lda,
+                                        stride_A,
+                                        B,
+                                        ldb,
+                                        stride_B,
+                                        batch_count,
+                                        invA,
+                                        invA_size,
+                                        stride_invA,
+                                        hipblasConvertDatatype(compute_type)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasTrsmStridedBatchedEx_v2(hipblasHandle_t    handle,
+                                               hipblasSideMode_t  side,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int                m,
+                                               int                n,
+                                               const void*        alpha,
+                                               void*              A,
+                                               int                lda,
+                                               hipblasStride      stride_A,
+                                               void*              B,
+                                               int                ldb,
+                                               hipblasStride      stride_B,
+                                               int                batch_count,
+                                               const void*        invA,
+                                               int                invA_size,
+                                               hipblasStride      stride_invA,
+                                               hipDataType        compute_type)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  side,
+                  uplo,
+                  transA,
+                  diag,
+                  m,
+                  n,
+                  lda,
+                  stride_A,
+                  ldb,
+                  stride_B,
+                  batch_count,
+                  invA_size,
+                  stride_invA,
+                  compute_type);
+
+    return hipblasConvertStatus(
+        rocblas_trsm_strided_batched_ex((rocblas_handle)handle,
+                                        hipblasConvertSide(side),
+                                        hipblasConvertFill(uplo),
+                                        hipblasConvertOperation(transA),
+                                        hipblasConvertDiag(diag),
+                                        m,
+                                        n,
+                                        alpha,
+                                        A,
+                                        lda,
+                                        stride_A,
+                                        B,
+                                        ldb,
+                                        stride_B,
+                                        batch_count,
+                                        invA,
+                                        invA_size,
+                                        stride_invA,
+                                        hipblasConvertDatatype_v2(compute_type)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// // syrk_ex
+// hipblasStatus_t hipblasCsyrkEx(hipblasHandle_t       handle,
+//                                           hipblasFillMode_t     uplo,
+//                                           hipblasOperation_t    trans,
+//                                           int                   n,
+//                                           int                   k,
+//                                           const hipblasComplex* alpha,
+//                                           const void*           A,
+//                                           hipblasDatatype_t     Atype,
+//                                           int                   lda,
+//                                           const hipblasComplex* beta,
+//                                           hipblasComplex*       C,
+//                                           hipblasDatatype_t     Ctype,
+//                                           int                   ldc)
+// try
+// {
+//     return HIPBLAS_STATUS_NOT_SUPPORTED;
+// }
+// catch(...)
+// {
+//     return hipblas_exception_to_status();
+// }
+
+// // herk_ex
+// hipblasStatus_t hipblasCherkEx(hipblasHandle_t    handle,
+//                                           hipblasFillMode_t  uplo,
+//                                           hipblasOperation_t trans,
+//                                           int                n,
+//                                           int                k,
+//                                           const float*       alpha,
+//                                           const void*        A,
+//                                           hipblasDatatype_t  Atype,
+//                                           int                lda,
+//                                           const float*       beta,
+//                                           hipblasComplex*    C,
+//                                           hipblasDatatype_t  Ctype,
+//                                           int                ldc)
+// try
+// {
+//     return HIPBLAS_STATUS_NOT_SUPPORTED;
+// }
+// catch(...)
+// {
+//     return hipblas_exception_to_status();
+// }
+
+// axpy_ex
+hipblasStatus_t hipblasAxpyEx(hipblasHandle_t   handle,
+                              int               n,
+                              const void*       alpha,
+                              hipblasDatatype_t alphaType,
+                              const void*       x,
+                              hipblasDatatype_t xType,
+                              int               incx,
+                              void*             y,
+                              hipblasDatatype_t yType,
+                              int               incy,
+                              hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, yType, incy, executionType);
+    return hipblasConvertStatus(rocblas_axpy_ex((rocblas_handle)handle,
+                                                n,
+                                                alpha,
+                                                hipblasConvertDatatype(alphaType),
+                                                x,
+                                                hipblasConvertDatatype(xType),
+                                                incx,
+                                                y,
+                                                hipblasConvertDatatype(yType),
+                                                incy,
+                                                hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasAxpyEx_v2(hipblasHandle_t handle,
+                                 int             n,
+                                 const void*     alpha,
+                                 hipDataType     alphaType,
+                                 const void*     x,
+                                 hipDataType     xType,
+                                 int             incx,
+                                 void*           y,
+                                 hipDataType     yType,
+                                 int             incy,
+                                 hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, yType, incy, executionType);
+    hipblasStatus_t rounded = hipblasRoundedAxpyEx(handle,
+                                                   n,
+                                                   alpha,
+                                                   alphaType,
+                                                   x,
+                                                   xType,
+                                                   incx,
+                                                   y,
+                                                   yType,
+                                                   incy,
+                                                   executionType);
+    if(rounded != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return rounded;
+    return hipblasConvertStatus(rocblas_axpy_ex((rocblas_handle)handle,
+                                                n,
+                                                alpha,
+                                                hipblasConvertDatatype_v2(alphaType),
+                                                x,
+                                                hipblasConvertDatatype_v2(xType),
+                                                incx,
+                                                y,
+                                                hipblasConvertDatatype_v2(yType),
+                                                incy,
+                                                hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasAxpyBatchedEx(hipblasHandle_t   handle,
+                                     int               n,
+                                     const void*       alpha,
+                                     hipblasDatatype_t alphaType,
+                                     const void*       x,
+                                     hipblasDatatype_t xType,
+                                     int               incx,
+                                     void*             y,
+                                     hipblasDatatype_t yType,
+                                     int               incy,
+                                     int               batch_count,
+                                     hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, yType, incy, batch_count, executionType);
+    return hipblasConvertStatus(rocblas_axpy_batched_ex((rocblas_handle)handle,
+                                                        n,
+                                                        alpha,
+                                                        hipblasConvertDatatype(alphaType),
+                                                        x,
+                                                        hipblasConvertDatatype(xType),
+                                                        incx,
+                                                        y,
+                                                        hipblasConvertDatatype(yType),
+                                                        incy,
+                                                        batch_count,
+                                                        hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasAxpyBatchedEx_v2(hipblasHandle_t handle,
+                                        int             n,
+                                        const void*     alpha,
+                                        hipDataType     alphaType,
+                                        const void*     x,
+                                        hipDataType     xType,
+                                        int             incx,
+                                        void*           y,
+                                        hipDataType     yType,
+                                        int             incy,
+                                        int             batch_count,
+                                        hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, yType, incy, batch_count, executionType);
+    return hipblasConvertStatus(rocblas_axpy_batched_ex((rocblas_handle)handle,
+                                                        n,
+                                                        alpha,
+                                                        hipblasConvertDatatype_v2(alphaType),
+                                                        x,
+                                                        hipblasConvertDatatype_v2(xType),
+                                                        incx,
+                                                        y,
+                                                        hipblasConvertDatatype_v2(yType),
+                                                        incy,
+                                                        batch_count,
+                                                        hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasAxpyStridedBatchedEx(hipblasHandle_t   handle,
+                                            int               n,
+                                            const void*       alpha,
+                                            hipblasDatatype_t alphaType,
+                                            const void*       x,
+                                            hipblasDatatype_t xType,
+                                            int               incx,
+                                            hipblasStride     stridex,
+                                            void*             y,
+                                            hipblasDatatype_t yType,
+                                            int               incy,
+                                            hipblasStride     stridey,
+                                            int               batch_count,
+                                            hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  n,
+                  alphaType,
+                  xType,
+                  incx,
+                  stridex,
+                  yType,
+                  incy,
+                  stridey,
+                  batch_count,
+                  executionType);
+
+    return hipblasConvertStatus(
+        rocblas_axpy_strided_batched_ex((rocblas_handle)handle,
+                                        n,
+                                        alpha,
+                                        hipblasConvertDatatype(alphaType),
+                                        x,
+                                        hipblasConvertDatatype(xType),
+                                        incx,
+                                        stridex,
+                                        y,
+                                        hipblasConvertDatatype(yType),
+                                        incy,
+                                        stridey,
+                                        batch_count,
+                                        hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasAxpyStridedBatchedEx_v2(hipblasHandle_t handle,
+                                               int             n,
+                                               const void*     alpha,
+                                               hipDataType     alphaType,
+                                               const void*     x,
+                                               hipDataType     xType,
+                                               int             incx,
+                                               hipblasStride   stridex,
+                                               void*           y,
+                                               hipDataType     yType,
+                                               int             incy,
+                                               hipblasStride   stridey,
+                                               int             batch_count,
+                                               hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  n,
+                  alphaType,
+                  xType,
+                  incx,
+                  stridex,
+                  yType,
+                  incy,
+                  stridey,
+                  batch_count,
+                  executionType);
+
+    return hipblasConvertStatus(
+        rocblas_axpy_strided_batched_ex((rocblas_handle)handle,
+                                        n,
+                                        alpha,
+                                        hipblasConvertDatatype_v2(alphaType),
+                                        x,
+                                        hipblasConvertDatatype_v2(xType),
+                                        incx,
+                                        stridex,
+                                        y,
+                                        hipblasConvertDatatype_v2(yType),
+                                        incy,
+                                        stridey,
+                                        batch_count,
+                                        hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// axpy_ex_64
+hipblasStatus_t hipblasAxpyEx_64(hipblasHandle_t   handle,
+                                 int64_t           n,
+                                 const void*       alpha,
+                                 hipblasDatatype_t alphaType,
+                                 const void*       x,
+                                 hipblasDatatype_t xType,
+                                 int64_t           incx,
+                                 void*             y,
+                                 hipblasDatatype_t yType,
+                                 int64_t           incy,
+                                 hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, yType, incy, executionType);
+    return hipblasConvertStatus(rocblas_axpy_ex_64((rocblas_handle)handle,
+                                                   n,
+                                                   alpha,
+                                                   hipblasConvertDatatype(alphaType),
+                                                   x,
+                                                   hipblasConvertDatatype(xType),
+                                                   incx,
+                                                   y,
+                                                   hipblasConvertDatatype(yType),
+                                                   incy,
+                                                   hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasAxpyEx_v2_64(hipblasHandle_t handle,
+                                    int64_t         n,
+                                    const void*     alpha,
+                                    hipDataType     alphaType,
+                                    const void*     x,
+                                    hipDataType     xType,
+                                    int64_t         incx,
+                                    void*           y,
+                                    hipDataType     yType,
+                                    int64_t         incy,
+                                    hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, yType, incy, executionType);
+    return hipblasConvertStatus(rocblas_axpy_ex_64((rocblas_handle)handle,
+                                                   n,
+                                                   alpha,
+                                                   hipblasConvertDatatype_v2(alphaType),
+                                                   x,
+                                                   hipblasConvertDatatype_v2(xType),
+                                                   incx,
+                                                   y,
+                                                   hipblasConvertDatatype_v2(yType),
+                                                   incy,
+                                                   hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasAxpyBatchedEx_64(hipblasHandle_t   handle,
+                                        int64_t           n,
+                                        const void*       alpha,
+                                        hipblasDatatype_t alphaType,
+                                        const void*       x,
+                                        hipblasDatatype_t xType,
+                                        int64_t           incx,
+                                        void*             y,
+                                        hipblasDatatype_t yType,
+                                        int64_t           incy,
+                                        int64_t           batch_count,
+                                        hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, yType, incy, batch_count, executionType);
+    return hipblasConvertStatus(rocblas_axpy_batched_ex_64((rocblas_handle)handle,
+                                                           n,
+                                                           alpha,
+                                                           hipblasConvertDatatype(alphaType),
+                                                           x,
+                                                           hipblasConvertDatatype(xType),
+                                                           incx,
+                                                           y,
+                                                           hipblasConvertDatatype(yType),
+                                                           incy,
+                                                           batch_count,
+                                                           hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasAxpyBatchedEx_v2_64(hipblasHandle_t handle,
+                                           int64_t         n,
+                                           const void*     alpha,
+                                           hipDataType     alphaType,
+                                           const void*     x,
+                                           hipDataType     xType,
+                                           int64_t         incx,
+                                           void*           y,
+                                           hipDataType     yType,
+                                           int64_t         incy,
+                                           int64_t         batch_count,
+                                           hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, yType, incy, batch_count, executionType);
+    return hipblasConvertStatus(
+        rocblas_axpy_batched_ex_64((rocblas_handle)handle,
+                                   n,
+                                   alpha,
+                                   hipblasConvertDatatype_v2(alphaType),
+                                   x,
+                                   hipblasConvertDatatype_v2(xType),
+                                   incx,
+                                   y,
+                                   hipblasConvertDatatype_v2(yType),
+                                   incy,
+                                   batch_count,
+                                   hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasAxpyStridedBatchedEx_64(hipblasHandle_t   handle,
+                                               int64_t           n,
+                                               const void*       alpha,
+                                               hipblasDatatype_t alphaType,
+                                               const void*       x,
+                                               hipblasDatatype_t xType,
+                                               int64_t           incx,
+                                               hipblasStride     stridex,
+                                               void*             y,
+                                               hipblasDatatype_t yType,
+                                               int64_t           incy,
+                                               hipblasStride     stridey,
+                                               int64_t           batch_count,
+                                               hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  n,
+                  alphaType,
+                  xType,
+                  incx,
+                  stridex,
+                  yType,
+                  incy,
+                  stridey,
+                  batch_count,
+                  executionType);
+
+    return hipblasConvertStatus(
+        rocblas_axpy_strided_batched_ex_64((rocblas_handle)handle,
+                                           n,
+                                           alpha,
+                                           hipblasConvertDatatype(alphaType),
+                                           x,
+                                           hipblasConvertDatatype(xType),
+                                           incx,
+                                           stridex,
+                                           y,
+                                           hipblasConvertDatatype(yType),
+                                           incy,
+                                           stridey,
+                                           batch_count,
+                                           hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasAxpyStridedBatchedEx_v2_64(hipblasHandle_t handle,
+                                                  int64_t         n,
+                                                  const void*     alpha,
+                                                  hipDataType     alphaType,
+                                                  const void*     x,
+                                                  hipDataType     xType,
+                                                  int64_t         incx,
+                                                  hipblasStride   stridex,
+                                                  void*           y,
+                                                  hipDataType     yType,
+                                                  int64_t         incy,
+                                                  hipblasStride   stridey,
+                                                  int64_t         batch_count,
+                                                  hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  n,
+                  alphaType,
+                  xType,
+                  incx,
+                  stridex,
+                  yType,
+                  incy,
+                  stridey,
+                  batch_count,
+                  executionType);
+
+    return hipblasConvertStatus(
+        rocblas_axpy_strided_batched_ex_64((rocblas_handle)handle,
+                                           n,
+                                           alpha,
+                                           hipblasConvertDatatype_v2(alphaType),
+                                           x,
+                                           hipblasConvertDatatype_v2(xType),
+                                           incx,
+                                           stridex,
+                                           y,
+                                           hipblasConvertDatatype_v2(yType),
+                                           incy,
+                                           stridey,
+                                           batch_count,
+                                           hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// dot_ex
+hipblasStatus_t hipblasDotEx(hipblasHandle_t   handle,
+                             int               n,
+                             const void*       x,
+                             hipblasDatatype_t xType,
+                             int               incx,
+                             const void*       y,
+                             hipblasDatatype_t yType,
+                             int               incy,
+                             void*             result,
+                             hipblasDatatype_t resultType,
+                             hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dot_ex((rocblas_handle)handle,
+                                               n,
+                                               x,
+                                               hipblasConvertDatatype(xType),
+                                               incx,
+                                               y,
+                                               hipblasConvertDatatype(yType),
+                                               incy,
+                                               result,
+                                               hipblasConvertDatatype(resultType),
+                                               hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotEx_v2(hipblasHandle_t handle,
+                                int             n,
+                                const void*     x,
+                                hipDataType     xType,
+                                int             incx,
+                                const void*     y,
+                                hipDataType     yType,
+                                int             incy,
+                                void*           result,
+                                hipDataType     resultType,
+                                hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dot_ex((rocblas_handle)handle,
+                                               n,
+                                               x,
+                                               hipblasConvertDatatype_v2(xType),
+                                               incx,
+                                               y,
+                                               hipblasConvertDatatype_v2(yType),
+                                               incy,
+                                               result,
+                                               hipblasConvertDatatype_v2(resultType),
+                                               hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotcEx(hipblasHandle_t   handle,
+                              int               n,
+                              const void*       x,
+                              hipblasDatatype_t xType,
+                              int               incx,
+                              const void*       y,
+                              hipblasDatatype_t yType,
+                              int               incy,
+                              void*             result,
+                              hipblasDatatype_t resultType,
+                              hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dotc_ex((rocblas_handle)handle,
+                                                n,
+                                                x,
+                                                hipblasConvertDatatype(xType),
+                                                incx,
+                                                y,
+                                                hipblasConvertDatatype(yType),
+                                                incy,
+                                                result,
+                                                hipblasConvertDatatype(resultType),
+                                                hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotcEx_v2(hipblasHandle_t handle,
+                                 int             n,
+                                 const void*     x,
+                                 hipDataType     xType,
+                                 int             incx,
+                                 const void*     y,
+                                 hipDataType     yType,
+                                 int             incy,
+                                 void*           result,
+                                 hipDataType     resultType,
+                                 hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dotc_ex((rocblas_handle)handle,
+                                                n,
+                                                x,
+                                                hipblasConvertDatatype_v2(xType),
+                                                incx,
+                                                y,
+                                                hipblasConvertDatatype_v2(yType),
+                                                incy,
+                                                result,
+                                                hipblasConvertDatatype_v2(resultType),
+                                                hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotBatchedEx(hipblasHandle_t   handle,
+                                    int               n,
+                                    const void*       x,
+                                    hipblasDatatype_t xType,
+                                    int               incx,
+                                    const void*       y,
+                                    hipblasDatatype_t yType,
+                                    int               incy,
+                                    int               batch_count,
+                                    void*             result,
+                                    hipblasDatatype_t resultType,
+                                    hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, batch_count, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dot_batched_ex((rocblas_handle)handle,
+                                                       n,
+                                                       x,
+                                                       hipblasConvertDatatype(xType),
+                                                       incx,
+                                                       y,
+                                                       hipblasConvertDatatype(yType),
+                                                       incy,
+                                                       batch_count,
+                                                       result,
+                                                       hipblasConvertDatatype(resultType),
+                                                       hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotBatchedEx_v2(hipblasHandle_t handle,
+                                       int             n,
+                                       const void*     x,
+                                       hipDataType     xType,
+                                       int             incx,
+                                       const void*     y,
+                                       hipDataType     yType,
+                                       int             incy,
+                                       int             batch_count,
+                                       void*           result,
+                                       hipDataType     resultType,
+                                       hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, batch_count, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dot_batched_ex((rocblas_handle)handle,
+                                                       n,
+                                                       x,
+                                                       hipblasConvertDatatype_v2(xType),
+                                                       incx,
+                                                       y,
+                                                       hipblasConvertDatatype_v2(yType),
+                                                       incy,
+                                                       batch_count,
+                                                       result,
+                                                       hipblasConvertDatatype_v2(resultType),
+                                                       hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotcBatchedEx(hipblasHandle_t   handle,
+                                     int               n,
+                                     const void*       x,
+                                     hipblasDatatype_t xType,
+                                     int               incx,
+                                     const void*       y,
+                                     hipblasDatatype_t yType,
+                                     int               incy,
+                                     int               batch_count,
+                                     void*             result,
+                                     hipblasDatatype_t resultType,
+                                     hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, batch_count, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dotc_batched_ex((rocblas_handle)handle,
+                                                        n,
+                                                        x,
+                                                        hipblasConvertDatatype(xType),
+                                                        incx,
+                                                        y,
+                                                        hipblasConvertDatatype(yType),
+                                                        incy,
+                                                        batch_count,
+                                                        result,
+                                                        hipblasConvertDatatype(resultType),
+                                                        hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotcBatchedEx_v2(hipblasHandle_t handle,
+                                        int             n,
+                                        const void*     x,
+                                        hipDataType     xType,
+                                        int             incx,
+                                        const void*     y,
+                                        hipDataType     yType,
+                                        int             incy,
+                                        int             batch_count,
+                                        void*           result,
+                                        hipDataType     resultType,
+                                        hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, batch_count, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dotc_batched_ex((rocblas_handle)handle,
+                                                        n,
+                                                        x,
+                                                        hipblasConvertDatatype_v2(xType),
+                                                        incx,
+                                                        y,
+                                                        hipblasConvertDatatype_v2(yType),
+                                                        incy,
+                                                        batch_count,
+                                                        result,
+                                                        hipblasConvertDatatype_v2(resultType),
+                                                        hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotStridedBatchedEx(hipblasHandle_t   handle,
+                                           int               n,
+                                           const void*       x,
+                                           hipblasDatatype_t xType,
+                                           int               incx,
+                                           hipblasStride     stridex,
+                                           const void*       y,
+                                           hipblasDatatype_t yType,
+                                           int               incy,
+                                           hipblasStride     stridey,
+                                           int               batch_count,
+                                           void*             result,
+                                           hipblasDatatype_t resultType,
+                                           hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  n,
+                  xType,
+                  incx,
+                  stridex,
+                  yType,
+                  incy,
+                  stridey,
+                  batch_count,
+                  resultType,
+                  executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+    return hipblasConvertStatus(
+        rocblas_dot_strided_batched_ex((rocblas_handle)handle,
+                                       n,
+                                       x,
+                                       hipblasConvertDatatype(xType),
+                                       incx,
+                                       stridex,
+                                       y,
+                                       hipblasConvertDatatype(yType),
+                                       incy,
+                                       stridey,
+                                       batch_count,
+                                       result,
+                                       hipblasConvertDatatype(resultType),
+                                       hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotStridedBatchedEx_v2(hipblasHandle_t handle,
+                                              int             n,
+                                              const void*     x,
+                                              hipDataType     xType,
+                                              int             incx,
+                                              hipblasStride   stridex,
+                                              const void*     y,
+                                              hipDataType     yType,
+                                              int             incy,
+                                              hipblasStride   stridey,
+                                              int             batch_count,
+                                              void*           result,
+                                              hipDataType     resultType,
+                                              hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  n,
+                  xType,
+                  incx,
+                  stridex,
+                  yType,
+                  incy,
+                  stridey,
+                  batch_count,
+                  resultType,
+                  executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+    return hipblasConvertStatus(
+        rocblas_dot_strided_batched_ex((rocblas_handle)handle,
+                                       n,
+                                       x,
+                                       hipblasConvertDatatype_v2(xType),
+                                       incx,
+                                       stridex,
+                                       y,
+                                       hipblasConvertDatatype_v2(yType),
+                                       incy,
+                                       stridey,
+                                       batch_count,
+                                       result,
+                                       hipblasConvertDatatype_v2(resultType),
+                                       hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotcStridedBatchedEx(hipblasHandle_t   handle,
+                                            int               n,
+                                            const void*       x,
+                                            hipblasDatatype_t xType,
+                                            int               incx,
+                                            hipblasStride     stridex,
+                                            const void*       y,
+                                            hipblasDatatype_t yType,
+                                            int               incy,
+                                            hipblasStride     stridey,
+                                            int               batch_count,
+                                            void*             result,
+                                            hipblasDatatype_t resultType,
+                                            hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  n,
+                  xType,
+                  incx,
+                  stridex,
+                  yType,
+                  incy,
+                  stridey,
+                  batch_count,
+                  resultType,
+                  executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+    return hipblasConvertStatus(
+        rocblas_dotc_strided_batched_ex((rocblas_handle)handle,
+                                        n,
+                                        x,
+                                        hipblasConvertDatatype(xType),
+                                        incx,
+                                        stridex,
+                                        y,
+                                        hipblasConvertDatatype(yType),
+                                        incy,
+                                        stridey,
+                                        batch_count,
+                                        result,
+                                        hipblasConvertDatatype(resultType),
+                                        hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotcStridedBatchedEx_v2(hipblasHandle_t handle,
+                                               int             n,
+                                               const void*     x,
+                                               hipDataType     xType,
+                                               int             incx,
+                                               hipblasStride   stridex,
+                                               const void*     y,
+                                               hipDataType     yType,
+                                               int             incy,
+                                               hipblasStride   stridey,
+                                               int             batch_count,
+                                               void*           result,
+                                               hipDataType     resultType,
+                                               hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  n,
+                  xType,
+                  incx,
+                  stridex,
+                  yType,
+                  incy,
+                  stridey,
+                  batch_count,
+                  resultType,
+                  executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+    return hipblasConvertStatus(
+        rocblas_dotc_strided_batched_ex((rocblas_handle)handle,
+                                        n,
+                                        x,
+                                        hipblasConvertDatatype_v2(xType),
+                                        incx,
+                                        stridex,
+                                        y,
+                                        hipblasConvertDatatype_v2(yType),
+                                        incy,
+                                        stridey,
+                                        batch_count,
+                                        result,
+                                        hipblasConvertDatatype_v2(resultType),
+                                        hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// dot_ex_64
+hipblasStatus_t hipblasDotEx_64(hipblasHandle_t   handle,
+                                int64_t           n,
+                                const void*       x,
+                                hipblasDatatype_t xType,
+                                int64_t           incx,
+                                const void*       y,
+                                hipblasDatatype_t yType,
+                                int64_t           incy,
+                                void*             result,
+                                hipblasDatatype_t resultType,
+                                hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dot_ex_64((rocblas_handle)handle,
+                                                  n,
+                                                  x,
+                                                  hipblasConvertDatatype(xType),
+                                                  incx,
+                                                  y,
+                                                  hipblasConvertDatatype(yType),
+                                                  incy,
+                                                  result,
+                                                  hipblasConvertDatatype(resultType),
+                                                  hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotEx_v2_64(hipblasHandle_t handle,
+                                   int64_t         n,
+                                   const void*     x,
+                                   hipDataType     xType,
+                                   int64_t         incx,
+                                   const void*     y,
+                                   hipDataType     yType,
+                                   int64_t         incy,
+                                   void*           result,
+                                   hipDataType     resultType,
+                                   hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dot_ex_64((rocblas_handle)handle,
+                                                  n,
+                                                  x,
+                                                  hipblasConvertDatatype_v2(xType),
+                                                  incx,
+                                                  y,
+                                                  hipblasConvertDatatype_v2(yType),
+                                                  incy,
+                                                  result,
+                                                  hipblasConvertDatatype_v2(resultType),
+                                                  hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotcEx_64(hipblasHandle_t   handle,
+                                 int64_t           n,
+                                 const void*       x,
+                                 hipblasDatatype_t xType,
+                                 int64_t           incx,
+                                 const void*       y,
+                                 hipblasDatatype_t yType,
+                                 int64_t           incy,
+                                 void*             result,
+                                 hipblasDatatype_t resultType,
+                                 hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dotc_ex_64((rocblas_handle)handle,
+                                                   n,
+                                                   x,
+                                                   hipblasConvertDatatype(xType),
+                                                   incx,
+                                                   y,
+                                                   hipblasConvertDatatype(yType),
+                                                   incy,
+                                                   result,
+                                                   hipblasConvertDatatype(resultType),
+                                                   hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotcEx_v2_64(hipblasHandle_t handle,
+                                    int64_t         n,
+                                    const void*     x,
+                                    hipDataType     xType,
+                                    int64_t         incx,
+                                    const void*     y,
+                                    hipDataType     yType,
+                                    int64_t         incy,
+                                    void*           result,
+                                    hipDataType     resultType,
+                                    hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dotc_ex_64((rocblas_handle)handle,
+                                                   n,
+                                                   x,
+                                                   hipblasConvertDatatype_v2(xType),
+                                                   incx,
+                                                   y,
+                                                   hipblasConvertDatatype_v2(yType),
+                                                   incy,
+                                                   result,
+                                                   hipblasConvertDatatype_v2(resultType),
+                                                   hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotBatchedEx_64(hipblasHandle_t   handle,
+                                       int64_t           n,
+                                       const void*       x,
+                                       hipblasDatatype_t xType,
+                                       int64_t           incx,
+                                       const void*       y,
+                                       hipblasDatatype_t yType,
+                                       int64_t           incy,
+                                       int64_t           batch_count,
+                                       void*             result,
+                                       hipblasDatatype_t resultType,
+                                       hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, batch_count, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dot_batched_ex_64((rocblas_handle)handle,
+                                                          n,
+                                                          x,
+                                                          hipblasConvertDatatype(xType),
+                                                          incx,
+                                                          y,
+                                                          hipblasConvertDatatype(yType),
+                                                          incy,
+                                                          batch_count,
+                                                          result,
+                                                          hipblasConvertDatatype(resultType),
+                                                          hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotBatchedEx_v2_64(hipblasHandle_t handle,
+                                          int64_t         n,
+                                          const void*     x,
+                                          hipDataType     xType,
+                                          int64_t         incx,
+                                          const void*     y,
+                                          hipDataType     yType,
+                                          int64_t         incy,
+                                          int64_t         batch_count,
+                                          void*           result,
+                                          hipDataType     resultType,
+                                          hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, batch_count, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_dot_batched_ex_64((rocblas_handle)handle,
+                                  n,
+                                  x,
+                                  hipblasConvertDatatype_v2(xType),
+                                  incx,
+                                  y,
+                                  hipblasConvertDatatype_v2(yType),
+                                  incy,
+                                  batch_count,
+                                  result,
+                                  hipblasConvertDatatype_v2(resultType),
+                                  hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotcBatchedEx_64(hipblasHandle_t   handle,
+                                        int64_t           n,
+                                        const void*       x,
+                                        hipblasDatatype_t xType,
+                                        int64_t           incx,
+                                        const void*       y,
+                                        hipblasDatatype_t yType,
+                                        int64_t           incy,
+                                        int64_t           batch_count,
+                                        void*             result,
+                                        hipblasDatatype_t resultType,
+                                        hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, batch_count, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_dotc_batched_ex_64((rocblas_handle)handle,
+                                                           n,
+                                                           x,
+                                                           hipblasConvertDatatype(xType),
+                                                           incx,
+                                                           y,
+                                                           hipblasConvertDatatype(yType),
+                                                           incy,
+                                                           batch_count,
+                                                           result,
+                                                           hipblasConvertDatatype(resultType),
+                                                           hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotcBatchedEx_v2_64(hipblasHandle_t handle,
+                                           int64_t         n,
+                                           const void*     x,
+                                           hipDataType     xType,
+                                           int64_t         incx,
+                                           const void*     y,
+                                           hipDataType     yType,
+                                           int64_t         incy,
+                                           int64_t         batch_count,
+                                           void*           result,
+                                           hipDataType     resultType,
+                                           hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, batch_count, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_dotc_batched_ex_64((rocblas_handle)handle,
+                                   n,
+                                   x,
+                                   hipblasConvertDatatype_v2(xType),
+                                   incx,
+                                   y,
+                                   hipblasConvertDatatype_v2(yType),
+                                   incy,
+                                   batch_count,
+                                   result,
+                                   hipblasConvertDatatype_v2(resultType),
+                                   hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotStridedBatchedEx_64(hipblasHandle_t   handle,
+                                              int64_t           n,
+                                              const void*       x,
+                                              hipblasDatatype_t xType,
+                                              int64_t           incx,
+                                              hipblasStride     stridex,
+                                              const void*       y,
+                                              hipblasDatatype_t yType,
+                                              int64_t           incy,
+                                              hipblasStride     stridey,
+                                              int64_t           batch_count,
+                                              void*             result,
+                                              hipblasDatatype_t resultType,
+                                              hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  n,
+                  xType,
+                  incx,
+                  stridex,
+                  yType,
+                  incy,
+                  stridey,
+                  batch_count,
+                  resultType,
+                  executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+    return hipblasConvertStatus(
+        rocblas_dot_strided_batched_ex_64((rocblas_handle)handle,
+                                          n,
+                                          x,
+                                          hipblasConvertDatatype(xType),
+                                          incx,
+                                          stridex,
+                                          y,
+                                          hipblasConvertDatatype(yType),
+                                          incy,
+                                          stridey,
+                                          batch_count,
+                                          result,
+                                          hipblasConvertDatatype(resultType),
+                                          hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotStridedBatchedEx_v2_64(hipblasHandle_t handle,
+                                                 int64_t         n,
+                                                 const void*     x,
+                                                 hipDataType     xType,
+                                                 int64_t         incx,
+                                                 hipblasStride   stridex,
+                                                 const void*     y,
+                                                 hipDataType     yType,
+                                                 int64_t         incy,
+                                                 hipblasStride   stridey,
+                                                 int64_t         batch_count,
+                                                 void*           result,
+                                                 hipDataType     resultType,
+                                                 hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  n,
+                  xType,
+                  incx,
+                  stridex,
+                  yType,
+                  incy,
+                  stridey,
+                  batch_count,
+                  resultType,
+                  executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+    return hipblasConvertStatus(
+        rocblas_dot_strided_batched_ex_64((rocblas_handle)handle,
+                                          n,
+                                          x,
+                                          hipblasConvertDatatype_v2(xType),
+                                          incx,
+                                          stridex,
+                                          y,
+                                          hipblasConvertDatatype_v2(yType),
+                                          incy,
+                                          stridey,
+                                          batch_count,
+                                          result,
+                                          hipblasConvertDatatype_v2(resultType),
+                                          hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotcStridedBatchedEx_64(hipblasHandle_t   handle,
+                                               int64_t           n,
+                                               const void*       x,
+                                               hipblasDatatype_t xType,
+                                               int64_t           incx,
+                                               hipblasStride     stridex,
+                                               const void*       y,
+                                               hipblasDatatype_t yType,
+                                               int64_t           incy,
+                                               hipblasStride     stridey,
+                                               int64_t           batch_count,
+                                               void*             result,
+                                               hipblasDatatype_t resultType,
+                                               hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  n,
+                  xType,
+                  incx,
+                  stridex,
+                  yType,
+                  incy,
+                  stridey,
+                  batch_count,
+                  resultType,
+                  executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+    return hipblasConvertStatus(
+        rocblas_dotc_strided_batched_ex_64((rocblas_handle)handle,
+                                           n,
+                                           x,
+                                           hipblasConvertDatatype(xType),
+                                           incx,
+                                           stridex,
+                                           y,
+                                           hipblasConvertDatatype(yType),
+                                           incy,
+                                           stridey,
+                                           batch_count,
+                                           result,
+                                           hipblasConvertDatatype(resultType),
+                                           hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotcStridedBatchedEx_v2_64(hipblasHandle_t handle,
+                                                  int64_t         n,
+                                                  const void*     x,
+                                                  hipDataType     xType,
+                                                  int64_t         incx,
+                                                  hipblasStride   stridex,
+                                                  const void*     y,
+                                                  hipDataType     yType,
+                                                  int64_t         incy,
+                                                  hipblasStride   stridey,
+                                                  int64_t         batch_count,
+                                                  void*           result,
+                                                  hipDataType     resultType,
+                                                  hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  n,
+                  xType,
+                  incx,
+                  stridex,
+                  yType,
+                  incy,
+                  stridey,
+                  batch_count,
+                  resultType,
+                  executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+    return hipblasConvertStatus(
+        rocblas_dotc_strided_batched_ex_64((rocblas_handle)handle,
+                                           n,
+                                           x,
+                                           hipblasConvertDatatype_v2(xType),
+                                           incx,
+                                           stridex,
+                                           y,
+                                           hipblasConvertDatatype_v2(yType),
+                                           incy,
+                                           stridey,
+                                           batch_count,
+                                           result,
+                                           hipblasConvertDatatype_v2(resultType),
+                                           hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// nrm2_ex
+hipblasStatus_t hipblasNrm2Ex(hipblasHandle_t   handle,
+                              int               n,
+                              const void*       x,
+                              hipblasDatatype_t xType,
+                              int               incx,
+                              void*             result,
+                              hipblasDatatype_t resultType,
+                              hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_nrm2_ex((rocblas_handle)handle,
+                                                n,
+                                                x,
+                                                hipblasConvertDatatype(xType),
+                                                incx,
+                                                result,
+                                                hipblasConvertDatatype(resultType),
+                                                hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasNrm2Ex_v2(hipblasHandle_t handle,
+                                 int             n,
+                                 const void*     x,
+                                 hipDataType     xType,
+                                 int             incx,
+                                 void*           result,
+                                 hipDataType     resultType,
+                                 hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_nrm2_ex((rocblas_handle)handle,
+                                                n,
+                                                x,
+                                                hipblasConvertDatatype_v2(xType),
+                                                incx,
+                                                result,
+                                                hipblasConvertDatatype_v2(resultType),
+                                                hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasNrm2BatchedEx(hipblasHandle_t   handle,
+                                     int               n,
+                                     const void*       x,
+                                     hipblasDatatype_t xType,
+                                     int               incx,
+                                     int               batch_count,
+                                     void*             result,
+                                     hipblasDatatype_t resultType,
+                                     hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, batch_count, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_nrm2_batched_ex((rocblas_handle)handle,
+                                                        n,
+                                                        x,
+                                                        hipblasConvertDatatype(xType),
+                                                        incx,
+                                                        batch_count,
+                                                        result,
+                                                        hipblasConvertDatatype(resultType),
+                                                        hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasNrm2BatchedEx_v2(hipblasHandle_t handle,
+                                        int             n,
+                                        const void*     x,
+                                        hipDataType     xType,
+                                        int             incx,
+                                        int             batch_count,
+                                        void*           result,
+                                        hipDataType     resultType,
+                                        hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, batch_count, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_nrm2_batched_ex((rocblas_handle)handle,
+                                                        n,
+                                                        x,
+                                                        hipblasConvertDatatype_v2(xType),
+                                                        incx,
+                                                        batch_count,
+                                                        result,
+                                                        hipblasConvertDatatype_v2(resultType),
+                                                        hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasNrm2StridedBatchedEx(hipblasHandle_t   handle,
+                                            int               n,
+                                            const void*       x,
+                                            hipblasDatatype_t xType,
+                                            int               incx,
+                                            hipblasStride     stridex,
+                                            int               batch_count,
+                                            void*             result,
+                                            hipblasDatatype_t resultType,
+                                            hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, stridex, batch_count, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_nrm2_strided_batched_ex((rocblas_handle)handle,
+                                        n,
+                                        x,
+                                        hipblasConvertDatatype(xType),
+                                        incx,
+                                        stridex,
+                                        batch_count,
+                                        result,
+                                        hipblasConvertDatatype(resultType),
+                                        hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasNrm2StridedBatchedEx_v2(hipblasHandle_t handle,
+                                               int             n,
+                                               const void*     x,
+                                               hipDataType     xType,
+                                               int             incx,
+                                               hipblasStride   stridex,
+                                               int             batch_count,
+                                               void*           result,
+                                               hipDataType     resultType,
+                                               hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, stridex, batch_count, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_nrm2_strided_batched_ex((rocblas_handle)handle,
+                                        n,
+                                        x,
+                                        hipblasConvertDatatype_v2(xType),
+                                        incx,
+                                        stridex,
+                                        batch_count,
+                                        result,
+                                        hipblasConvertDatatype_v2(resultType),
+                                        hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// nrm2_ex_64
+hipblasStatus_t hipblasNrm2Ex_64(hipblasHandle_t   handle,
+                                 int64_t           n,
+                                 const void*       x,
+                                 hipblasDatatype_t xType,
+                                 int64_t           incx,
+                                 void*             result,
+                                 hipblasDatatype_t resultType,
+                                 hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_nrm2_ex_64((rocblas_handle)handle,
+                                                   n,
+                                                   x,
+                                                   hipblasConvertDatatype(xType),
+                                                   incx,
+                                                   result,
+                                                   hipblasConvertDatatype(resultType),
+                                                   hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasNrm2Ex_v2_64(hipblasHandle_t handle,
+                                    int64_t         n,
+                                    const void*     x,
+                                    hipDataType     xType,
+                                    int64_t         incx,
+                                    void*           result,
+                                    hipDataType     resultType,
+                                    hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_nrm2_ex_64((rocblas_handle)handle,
+                                                   n,
+                                                   x,
+                                                   hipblasConvertDatatype_v2(xType),
+                                                   incx,
+                                                   result,
+                                                   hipblasConvertDatatype_v2(resultType),
+                                                   hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasNrm2BatchedEx_64(hipblasHandle_t   handle,
+                                        int64_t           n,
+                                        const void*       x,
+                                        hipblasDatatype_t xType,
+                                        int64_t           incx,
+                                        int64_t           batch_count,
+                                        void*             result,
+                                        hipblasDatatype_t resultType,
+                                        hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, batch_count, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(rocblas_nrm2_batched_ex_64((rocblas_handle)handle,
+                                                           n,
+                                                           x,
+                                                           hipblasConvertDatatype(xType),
+                                                           incx,
+                                                           batch_count,
+                                                           result,
+                                                           hipblasConvertDatatype(resultType),
+                                                           hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasNrm2BatchedEx_v2_64(hipblasHandle_t handle,
+                                           int64_t         n,
+                                           const void*     x,
+                                           hipDataType     xType,
+                                           int64_t         incx,
+                                           int64_t         batch_count,
+                                           void*           result,
+                                           hipDataType     resultType,
+                                           hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, batch_count, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_nrm2_batched_ex_64((rocblas_handle)handle,
+                                   n,
+                                   x,
+                                   hipblasConvertDatatype_v2(xType),
+                                   incx,
+                                   batch_count,
+                                   result,
+                                   hipblasConvertDatatype_v2(resultType),
+                                   hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasNrm2StridedBatchedEx_64(hipblasHandle_t   handle,
+                                               int64_t           n,
+                                               const void*       x,
+                                               hipblasDatatype_t xType,
+                                               int64_t           incx,
+                                               hipblasStride     stridex,
+                                               int64_t           batch_count,
+                                               void*             result,
+                                               hipblasDatatype_t resultType,
+                                               hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, stridex, batch_count, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_nrm2_strided_batched_ex_64((rocblas_handle)handle,
+                                           n,
+                                           x,
+                                           hipblasConvertDatatype(xType),
+                                           incx,
+                                           stridex,
+                                           batch_count,
+                                           result,
+                                           hipblasConvertDatatype(resultType),
+                                           hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasNrm2StridedBatchedEx_v2_64(hipblasHandle_t handle,
+                                                  int64_t         n,
+                                                  const void*     x,
+                                                  hipDataType     xType,
+                                                  int64_t         incx,
+                                                  hipblasStride   stridex,
+                                                  int64_t         batch_count,
+                                                  void*           result,
+                                                  hipDataType     resultType,
+                                                  hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, stridex, batch_count, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        rocblas_nrm2_strided_batched_ex_64((rocblas_handle)handle,
+                                           n,
+                                           x,
+                                           hipblasConvertDatatype_v2(xType),
+                                           incx,
+                                           stridex,
+                                           batch_count,
+                                           result,
+                                           hipblasConvertDatatype_v2(resultType),
+                                           hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rot_ex
+hipblasStatus_t hipblasRotEx(hipblasHandle_t   handle,
+                             int               n,
+                             void*             x,
+                             hipblasDatatype_t xType,
+                             int               incx,
+                             void*             y,
+                             hipblasDatatype_t yType,
+                             int               incy,
+                             const void*       c,
+                             const void*       s,
+                             hipblasDatatype_t csType,
+                             hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, csType, executionType);
+    return hipblasConvertStatus(rocblas_rot_ex((rocblas_handle)handle,
+                                               n,
+                                               x,
+                                               hipblasConvertDatatype(xType),
+                                               incx,
+                                               y,
+                                               hipblasConvertDatatype(yType),
+                                               incy,
+                                               c,
+                                               s,
+                                               hipblasConvertDatatype(csType),
+                                               hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasRotEx_v2(hipblasHandle_t handle,
+                                int             n,
+                                void*           x,
+                                hipDataType     xType,
+                                int             incx,
+                                void*           y,
+                                hipDataType     yType,
+                                int             incy,
+                                const void*     c,
+                                const void*     s,
+                                hipDataType     csType,
+                                hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, csType, executionType);
+    return hipblasConvertStatus(rocblas_rot_ex((rocblas_handle)handle,
+                                               n,
+                                               x,
+                                               hipblasConvertDatatype_v2(xType),
+                                               incx,
+                                               y,
+                                               hipblasConvertDatatype_v2(yType),
+                                               incy,
+                                               c,
+                                               s,
+                                               hipblasConvertDatatype_v2(csType),
+                                               hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasRotBatchedEx(hipblasHandle_t   handle,
+                                    int               n,
+                                    void*             x,
+                                    hipblasDatatype_t xType,
+                                    int               incx,
+                                    void*             y,
+                                    hipblasDatatype_t yType,
+                                    int               incy,
+                                    const void*       c,
+                                    const void*       s,
+                                    hipblasDatatype_t csType,
+                                    int               batch_count,
+                                    hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, csType, batch_count, executionType);
+    return hipblasConvertStatus(rocblas_rot_batched_ex((rocblas_handle)handle,
+                                                       n,
+                                                       x,
+                                                       hipblasConvertDatatype(xType),
+                                                       incx,
+                                                       y,
+                                                       hipblasConvertDatatype(yType),
+                                                       incy,
+                                                       c,
+                                                       s,
+                                                       hipblasConvertDatatype(csType),
+                                                       batch_count,
+                                                       hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasRotBatchedEx_v2(hipblasHandle_t handle,
+                                       int             n,
+                                       void*           x,
+                                       hipDataType     xType,
+                                       int             incx,
+                                       void*           y,
+                                       hipDataType     yType,
+                                       int             incy,
+                                       const void*     c,
+                                       const void*     s,
+                                       hipDataType     csType,
+                                       int             batch_count,
+                                       hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, csType, batch_count, executionType);
+    return hipblasConvertStatus(rocblas_rot_batched_ex((rocblas_handle)handle,
+                                                       n,
+                                                       x,
+                                                       hipblasConvertDatatype_v2(xType),
+                                                       incx,
+                                                       y,
+                                                       hipblasConvertDatatype_v2(yType),
+                                                       incy,
+                                                       c,
+                                                       s,
+                                                       hipblasConvertDatatype_v2(csType),
+                                                       batch_count,
+                                                       hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasRotStridedBatchedEx(hipblasHandle_t   handle,
+                                           int               n,
+                                           void*             x,
+                                           hipblasDatatype_t xType,
+                                           int               incx,
+                                           hipblasStride     stridex,
+                                           void*             y,
+                                           hipblasDatatype_t yType,
+                                           int               incy,
+                                           hipblasStride     stridey,
+                                           const void*       c,
+                                           const void*       s,
+                                           hipblasDatatype_t csType,
+                                           int               batch_count,
+                                           hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, n, xType, incx, stridex, yType, incy, stridey, csType, batch_count, executionType);
+
+    return hipblasConvertStatus(
+        rocblas_rot_strided_batched_ex((rocblas_handle)handle,
+                                       n,
+                                       x,
+                                       hipblasConvertDatatype(xType),
+                                       incx,
+                                       stridex,
+                                       y,
+                                       hipblasConvertDatatype(yType),
+                                       incy,
+                                       stridey,
+                                       c,
+                                       s,
+                                       hipblasConvertDatatype(csType),
+                                       batch_count,
+                                       hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasRotStridedBatchedEx_v2(hipblasHandle_t handle,
+                                              int             n,
+                                              void*           x,
+                                              hipDataType     xType,
+                                              int             incx,
+                                              hipblasStride   stridex,
+                                              void*           y,
+                                              hipDataType     yType,
+                                              int             incy,
+                                              hipblasStride   stridey,
+                                              const void*     c,
+                                              const void*     s,
+                                              hipDataType     csType,
+                                              int             batch_count,
+                                              hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, n, xType, incx, stridex, yType, incy, stridey, csType, batch_count, executionType);
+
+    return hipblasConvertStatus(
+        rocblas_rot_strided_batched_ex((rocblas_handle)handle,
+                                       n,
+                                       x,
+                                       hipblasConvertDatatype_v2(xType),
+                                       incx,
+                                       stridex,
+                                       y,
+                                       hipblasConvertDatatype_v2(yType),
+                                       incy,
+                                       stridey,
+                                       c,
+                                       s,
+                                       hipblasConvertDatatype_v2(csType),
+                                       batch_count,
+                                       hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rot_ex_64
+hipblasStatus_t hipblasRotEx_64(hipblasHandle_t   handle,
+                                int64_t           n,
+                                void*             x,
+                                hipblasDatatype_t xType,
+                                int64_t           incx,
+                                void*             y,
+                                hipblasDatatype_t yType,
+                                int64_t           incy,
+                                const void*       c,
+                                const void*       s,
+                                hipblasDatatype_t csType,
+                                hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, csType, executionType);
+    return hipblasConvertStatus(rocblas_rot_ex_64((rocblas_handle)handle,
+                                                  n,
+                                                  x,
+                                                  hipblasConvertDatatype(xType),
+                                                  incx,
+                                                  y,
+                                                  hipblasConvertDatatype(yType),
+                                                  incy,
+                                                  c,
+                                                  s,
+                                                  hipblasConvertDatatype(csType),
+                                                  hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasRotEx_v2_64(hipblasHandle_t handle,
+                                   int64_t         n,
+                                   void*           x,
+                                   hipDataType     xType,
+                                   int64_t         incx,
+                                   void*           y,
+                                   hipDataType     yType,
+                                   int64_t         incy,
+                                   const void*     c,
+                                   const void*     s,
+                                   hipDataType     csType,
+                                   hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, csType, executionType);
+    return hipblasConvertStatus(rocblas_rot_ex_64((rocblas_handle)handle,
+                                                  n,
+                                                  x,
+                                                  hipblasConvertDatatype_v2(xType),
+                                                  incx,
+                                                  y,
+                                                  hipblasConvertDatatype_v2(yType),
+                                                  incy,
+                                                  c,
+                                                  s,
+                                                  hipblasConvertDatatype_v2(csType),
+                                                  hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasRotBatchedEx_64(hipblasHandle_t   handle,
+                                       int64_t           n,
+                                       void*             x,
+                                       hipblasDatatype_t xType,
+                                       int64_t           incx,
+                                       void*             y,
+                                       hipblasDatatype_t yType,
+                                       int64_t           incy,
+                                       const void*       c,
+                                       const void*       s,
+                                       hipblasDatatype_t csType,
+                                       int64_t           batch_count,
+                                       hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, csType, batch_count, executionType);
+    return hipblasConvertStatus(rocblas_rot_batched_ex_64((rocblas_handle)handle,
+                                                          n,
+                                                          x,
+                                                          hipblasConvertDatatype(xType),
+                                                          incx,
+                                                          y,
+                                                          hipblasConvertDatatype(yType),
+                                                          incy,
+                                                          c,
+                                                          s,
+                                                          hipblasConvertDatatype(csType),
+                                                          batch_count,
+                                                          hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasRotBatchedEx_v2_64(hipblasHandle_t handle,
+                                          int64_t         n,
+                                          void*           x,
+                                          hipDataType     xType,
+                                          int64_t         incx,
+                                          void*           y,
+                                          hipDataType     yType,
+                                          int64_t         incy,
+                                          const void*     c,
+                                          const void*     s,
+                                          hipDataType     csType,
+                                          int64_t         batch_count,
+                                          hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, csType, batch_count, executionType);
+    return hipblasConvertStatus(
+        rocblas_rot_batched_ex_64((rocblas_handle)handle,
+                                  n,
+                                  x,
+                                  hipblasConvertDatatype_v2(xType),
+                                  incx,
+                                  y,
+                                  hipblasConvertDatatype_v2(yType),
+                                  incy,
+                                  c,
+                                  s,
+                                  hipblasConvertDatatype_v2(csType),
+                                  batch_count,
+                                  hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasRotStridedBatchedEx_64(hipblasHandle_t   handle,
+                                              int64_t           n,
+                                              void*             x,
+                                              hipblasDatatype_t xType,
+                                              int64_t           incx,
+                                              hipblasStride     stridex,
+                                              void*             y,
+                                              hipblasDatatype_t yType,
+                                              int64_t           incy,
+                                              hipblasStride     stridey,
+                                              const void*       c,
+                                              const void*       s,
+                                              hipblasDatatype_t csType,
+                                              int64_t           batch_count,
+                                              hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, n, xType, incx, stridex, yType, incy, stridey, csType, batch_count, executionType);
+
+    return hipblasConvertStatus(
+        rocblas_rot_strided_batched_ex_64((rocblas_handle)handle,
+                                          n,
+                                          x,
+                                          hipblasConvertDatatype(xType),
+                                          incx,
+                                          stridex,
+                                          y,
+                                          hipblasConvertDatatype(yType),
+                                          incy,
+                                          stridey,
+                                          c,
+                                          s,
+                                          hipblasConvertDatatype(csType),
+                                          batch_count,
+                                          hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasRotStridedBatchedEx_v2_64(hipblasHandle_t handle,
+                                                 int64_t         n,
+                                                 void*           x,
+                                                 hipDataType     xType,
+                                                 int64_t         incx,
+                                                 hipblasStride   stridex,
+                                                 void*           y,
+                                                 hipDataType     yType,
+                                                 int64_t         incy,
+                                                 hipblasStride   stridey,
+                                                 const void*     c,
+                                                 const void*     s,
+                                                 hipDataType     csType,
+                                                 int64_t         batch_count,
+                                                 hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, n, xType, incx, stridex, yType, incy, stridey, csType, batch_count, executionType);
+
+    return hipblasConvertStatus(
+        rocblas_rot_strided_batched_ex_64((rocblas_handle)handle,
+                                          n,
+                                          x,
+                                          hipblasConvertDatatype_v2(xType),
+                                          incx,
+                                          stridex,
+                                          y,
+                                          hipblasConvertDatatype_v2(yType),
+                                          incy,
+                                          stridey,
+                                          c,
+                                          s,
+                                          hipblasConvertDatatype_v2(csType),
+                                          batch_count,
+                                          hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// scal_ex
+hipblasStatus_t hipblasScalEx(hipblasHandle_t   handle,
+                              int               n,
+                              const void*       alpha,
+                              hipblasDatatype_t alphaType,
+                              void*             x,
+                              hipblasDatatype_t xType,
+                              int               incx,
+                              hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, executionType);
+    return hipblasConvertStatus(rocblas_scal_ex((rocblas_handle)handle,
+                                                n,
+                                                alpha,
+                                                hipblasConvertDatatype(alphaType),
+                                                x,
+                                                hipblasConvertDatatype(xType),
+                                                incx,
+                                                hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScalEx_v2(hipblasHandle_t handle,
+                                 int             n,
+                                 const void*     alpha,
+                                 hipDataType     alphaType,
+                                 void*           x,
+                                 hipDataType     xType,
+                                 int             incx,
+                                 hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, executionType);
+    hipblasStatus_t rounded = hipblasRoundedScalEx(handle,
+                                                   n,
+                                                   alpha,
+                                                   alphaType,
+                                                   x,
+                                                   xType,
+                                                   incx,
+                                                   executionType);
+    if(rounded != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return rounded;
+    return hipblasConvertStatus(rocblas_scal_ex((rocblas_handle)handle,
+                                                n,
+                                                alpha,
+                                                hipblasConvertDatatype_v2(alphaType),
+                                                x,
+                                                hipblasConvertDatatype_v2(xType),
+                                                incx,
+                                                hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScalBatchedEx(hipblasHandle_t   handle,
+                                     int               n,
+                                     const void*       alpha,
+                                     hipblasDatatype_t alphaType,
+                                     void*             x,
+                                     hipblasDatatype_t xType,
+                                     int               incx,
+                                     int               batch_count,
+                                     hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, batch_count, executionType);
+    return hipblasConvertStatus(rocblas_scal_batched_ex((rocblas_handle)handle,
+                                                        n,
+                                                        alpha,
+                                                        hipblasConvertDatatype(alphaType),
+                                                        x,
+                                                        hipblasConvertDatatype(xType),
+                                                        incx,
+                                                        batch_count,
+                                                        hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScalBatchedEx_v2(hipblasHandle_t handle,
+                                        int             n,
+                                        const void*     alpha,
+                                        hipDataType     alphaType,
+                                        void*           x,
+                                        hipDataType     xType,
+                                        int             incx,
+                                        int             batch_count,
+                                        hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, batch_count, executionType);
+    return hipblasConvertStatus(rocblas_scal_batched_ex((rocblas_handle)handle,
+                                                        n,
+                                                        alpha,
+                                                        hipblasConvertDatatype_v2(alphaType),
+                                                        x,
+                                                        hipblasConvertDatatype_v2(xType),
+                                                        incx,
+                                                        batch_count,
+                                                        hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScalStridedBatchedEx(hipblasHandle_t   handle,
+                                            int               n,
+                                            const void*       alpha,
+                                            hipblasDatatype_t alphaType,
+                                            void*             x,
+                                            hipblasDatatype_t xType,
+                                            int               incx,
+                                            hipblasStride     stridex,
+                                            int               batch_count,
+                                            hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, stridex, batch_count, executionType);
+    return hipblasConvertStatus(
+        rocblas_scal_strided_batched_ex((rocblas_handle)handle,
+                                        n,
+                                        alpha,
+                                        hipblasConvertDatatype(alphaType),
+                                        x,
+                                        hipblasConvertDatatype(xType),
+                                        incx,
+                                        stridex,
+                                        batch_count,
+                                        hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScalStridedBatchedEx_v2(hipblasHandle_t handle,
+                                               int             n,
+                                               const void*     alpha,
+                                               hipDataType     alphaType,
+                                               void*           x,
+                                               hipDataType     xType,
+                                               int             incx,
+                                               hipblasStride   stridex,
+                                               int             batch_count,
+                                               hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, stridex, batch_count, executionType);
+    return hipblasConvertStatus(
+        rocblas_scal_strided_batched_ex((rocblas_handle)handle,
+                                        n,
+                                        alpha,
+                                        hipblasConvertDatatype_v2(alphaType),
+                                        x,
+                                        hipblasConvertDatatype_v2(xType),
+                                        incx,
+                                        stridex,
+                                        batch_count,
+                                        hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// scal_ex
+hipblasStatus_t hipblasScalEx_64(hipblasHandle_t   handle,
+                                 int64_t           n,
+                                 const void*       alpha,
+                                 hipblasDatatype_t alphaType,
+                                 void*             x,
+                                 hipblasDatatype_t xType,
+                                 int64_t           incx,
+                                 hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, executionType);
+    return hipblasConvertStatus(rocblas_scal_ex_64((rocblas_handle)handle,
+                                                   n,
+                                                   alpha,
+                                                   hipblasConvertDatatype(alphaType),
+                                                   x,
+                                                   hipblasConvertDatatype(xType),
+                                                   incx,
+                                                   hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScalEx_v2_64(hipblasHandle_t handle,
+                                    int64_t         n,
+                                    const void*     alpha,
+                                    hipDataType     alphaType,
+                                    void*           x,
+                                    hipDataType     xType,
+                                    int64_t         incx,
+                                    hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, executionType);
+    return hipblasConvertStatus(rocblas_scal_ex_64((rocblas_handle)handle,
+                                                   n,
+                                                   alpha,
+                                                   hipblasConvertDatatype_v2(alphaType),
+                                                   x,
+                                                   hipblasConvertDatatype_v2(xType),
+                                                   incx,
+                                                   hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScalBatchedEx_64(hipblasHandle_t   handle,
+                                        int64_t           n,
+                                        const void*       alpha,
+                                        hipblasDatatype_t alphaType,
+                                        void*             x,
+                                        hipblasDatatype_t xType,
+                                        int64_t           incx,
+                                        int64_t           batch_count,
+                                        hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, batch_count, executionType);
+    return hipblasConvertStatus(rocblas_scal_batched_ex_64((rocblas_handle)handle,
+                                                           n,
+                                                           alpha,
+                                                           hipblasConvertDatatype(alphaType),
+                                                           x,
+                                                           hipblasConvertDatatype(xType),
+                                                           incx,
+                                                           batch_count,
+                                                           hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScalBatchedEx_v2_64(hipblasHandle_t handle,
+                                           int64_t         n,
+                                           const void*     alpha,
+                                           hipDataType     alphaType,
+                                           void*           x,
+                                           hipDataType     xType,
+                                           int64_t         incx,
+                                           int64_t         batch_count,
+                                           hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, batch_count, executionType);
+    return hipblasConvertStatus(
+        rocblas_scal_batched_ex_64((rocblas_handle)handle,
+                                   n,
+                                   alpha,
+                                   hipblasConvertDatatype_v2(alphaType),
+                                   x,
+                                   hipblasConvertDatatype_v2(xType),
+                                   incx,
+                                   batch_count,
+                                   hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScalStridedBatchedEx_64(hipblasHandle_t   handle,
+                                               int64_t           n,
+                                               const void*       alpha,
+                                               hipblasDatatype_t alphaType,
+                                               void*             x,
+                                               hipblasDatatype_t xType,
+                                               int64_t           incx,
+                                               hipblasStride     stridex,
+                                               int64_t           batch_count,
+                                               hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, stridex, batch_count, executionType);
+    return hipblasConvertStatus(
+        rocblas_scal_strided_batched_ex_64((rocblas_handle)handle,
+                                           n,
+                                           alpha,
+                                           hipblasConvertDatatype(alphaType),
+                                           x,
+                                           hipblasConvertDatatype(xType),
+                                           incx,
+                                           stridex,
+                                           batch_count,
+                                           hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScalStridedBatchedEx_v2_64(hipblasHandle_t handle,
+                                                  int64_t         n,
+                                                  const void*     alpha,
+                                                  hipDataType     alphaType,
+                                                  void*           x,
+                                                  hipDataType     xType,
+                                                  int64_t         incx,
+                                                  hipblasStride   stridex,
+                                                  int64_t         batch_count,
+                                                  hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, stridex, batch_count, executionType);
+    return hipblasConvertStatus(
+        rocblas_scal_strided_batched_ex_64((rocblas_handle)handle,
+                                           n,
+                                           alpha,
+                                           hipblasConvertDatatype_v2(alphaType),
+                                           x,
+                                           hipblasConvertDatatype_v2(xType),
+                                           incx,
+                                           stridex,
+                                           batch_count,
+                                           hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+} // extern "C"
@@ -0,0 +1,462 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+
+#include <algorithm>
+
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_gemm3m.hpp"
+#include "hipblas_internal.hpp"
+
+namespace
+{
+    constexpr int hipblas_gemm3m_tile = 32;
+    constexpr int hipblas_gemm3m_rows = 8;
+
+    __device__ inline float hipblas_gemm3m_real(hipFloatComplex x)
+    {
+        return hipCrealf(x);
+    }
+
+    __device__ inline double hipblas_gemm3m_real(hipDoubleComplex x)
+    {
+        return hipCreal(x);
+    }
+
+    __device__ inline float hipblas_gemm3m_imag(hipFloatComplex x)
+    {
+        return hipCimagf(x);
+    }
+
+    __device__ inline double hipblas_gemm3m_imag(hipDoubleComplex x)
+    {
+        return hipCimag(x);
+    }
+
+    // Xr, Xi and Xr + Xi of the rows-by-cols matrix X into the planes P, P + plane and
+    // P + 2 * plane, with leading dimension rows. Xi is negated when conj, for op(X) = X^H.
+    template <typename T, typename TR>
+    __global__ void hipblasGemm3mSplitKernel(
+        int rows, int cols, const T* X, int ldx, bool conj, TR* P, size_t plane)
+    {
+        int i = blockIdx.x * hipblas_gemm3m_tile + threadIdx.x;
+        if(i >= rows)
+            return;
+
+        int j_end = min(cols, int(blockIdx.y + 1) * hipblas_gemm3m_tile);
+        for(int j = blockIdx.y * hipblas_gemm3m_tile + threadIdx.y; j < j_end;
+            j += hipblas_gemm3m_rows)
+        {
+            T      x  = X[i + size_t(j) * ldx];
+            TR     re = hipblas_gemm3m_real(x);
+            TR     im = conj ? -hipblas_gemm3m_imag(x) : hipblas_gemm3m_imag(x);
+            size_t p  = i + size_t(j) * rows;
+
+            P[p]             = re;
+            P[plane + p]     = im;
+            P[2 * plane + p] = re + im;
+        }
+    }
+
+    // C := alpha * W + beta * C, with W = (P1 - P2) + i (P3 - P1 - P2) from the m-by-n planes
+    // P1, P2 and P3 at P. The planes aren't read when alpha is zero and C isn't read when beta
+    // is zero. The scalars are read from alpha and beta when they aren't nullptr, in device
+    // pointer mode, and are alpha_value and beta_value otherwise.
+    template <typename T, typename TR>
+    __global__ void hipblasGemm3mCombineKernel(int       m,
+                                               int       n,
+                                               const TR* P,
+                                               size_t    plane,
+                                               const T*  alpha,
+                                               T         alpha_value,
+                                               const T*  beta,
+                                               T         beta_value,
+                                               T*        C,
+                                               int       ldc)
+    {
+        int i = blockIdx.x * hipblas_gemm3m_tile + threadIdx.x;
+        if(i >= m)
+            return;
+
+        T    a      = alpha ? *alpha : alpha_value;
+        T    b      = beta ? *beta : beta_value;
+        bool read_p = !hipblas_device_is_zero(a);
+        bool read_c = !hipblas_device_is_zero(b);
+
+        int j_end = min(n, int(blockIdx.y + 1) * hipblas_gemm3m_tile);
+        for(int j = blockIdx.y * hipblas_gemm3m_tile + threadIdx.y; j < j_end;
+            j += hipblas_gemm3m_rows)
+        {
+            T w{}, c{};
+            if(read_p)
+            {
+                size_t p  = i + size_t(j) * m;
+                TR     p1 = P[p], p2 = P[plane + p], p3 = P[2 * plane + p];
+                w.x       = p1 - p2;
+                w.y       = p3 - p1 - p2;
+            }
+            if(read_c)
+                c = C[i + size_t(j) * ldc];
+            C[i + size_t(j) * ldc] = hipblas_device_axpby(a, w, b, c);
+        }
+    }
+
+    template <typename T, typename TR>
+    hipError_t hipblas_gemm3m_split(
+        int rows, int cols, const T* X, int ldx, bool conj, TR* P, size_t plane, hipStream_t stream)
+    {
+        dim3 grid((rows - 1) / hipblas_gemm3m_tile + 1, (cols - 1) / hipblas_gemm3m_tile + 1);
+        dim3 threads(hipblas_gemm3m_tile, hipblas_gemm3m_rows);
+        hipblasGemm3mSplitKernel<T, TR>
+            <<<grid, threads, 0, stream>>>(rows, cols, X, ldx, conj, P, plane);
+        return hipGetLastError();
+    }
+
+    template <typename T, typename TR>
+    hipError_t hipblas_gemm3m_combine(int         m,
+                                      int         n,
+                                      const TR*   P,
+                                      size_t      plane,
+                                      const T*    alpha,
+                                      const T*    beta,
+                                      bool        host_scalars,
+                                      T*          C,
+                                      int         ldc,
+                                      hipStream_t stream)
+    {
+        dim3 grid((m - 1) / hipblas_gemm3m_tile + 1, (n - 1) / hipblas_gemm3m_tile + 1);
+        dim3 threads(hipblas_gemm3m_tile, hipblas_gemm3m_rows);
+        hipblasGemm3mCombineKernel<T, TR>
+            <<<grid, threads, 0, stream>>>(m,
+                                           n,
+                                           P,
+                                           plane,
+                                           host_scalars ? nullptr : alpha,
+                                           host_scalars ? *alpha : T{},
+                                           host_scalars ? nullptr : beta,
+                                           host_scalars ? *beta : T{},
+                                           C,
+                                           ldc);
+        return hipGetLastError();
+    }
+
+    // P1, P2 and P3 as one strided batched gemm of the three planes of A and of B
+    rocblas_status hipblas_gemm3m_products(rocblas_handle    handle,
+                                           rocblas_operation transa,
+                                           rocblas_operation transb,
+                                           int               m,
+                                           int               n,
+                                           int               k,
+                                           const float*      A,
+                                           int               lda,
+                                           rocblas_stride    stride_a,
+                                           const float*      B,
+                                           int               ldb,
+                                           rocblas_stride    stride_b,
+                                           float*            P,
+                                           rocblas_stride    stride_p)
+    {
+        const float one = 1, zero = 0;
+        return rocblas_sgemm_strided_batched(handle,
+                                             transa,
+                                             transb,
+                                             m,
+                                             n,
+                                             k,
+                                             &one,
+                                             A,
+                                             lda,
+                                             stride_a,
+                                             B,
+                                             ldb,
+                                             stride_b,
+                                             &zero,
+                                             P,
+                                             m,
+                                             stride_p,
+                                             3);
+    }
+
+    rocblas_status hipblas_gemm3m_products(rocblas_handle    handle,
+                                           rocblas_operation transa,
+                                           rocblas_operation transb,
+                                           int               m,
+                                           int               n,
+                                           int               k,
+                                           const double*     A,
+                                           int               lda,
+                                           rocblas_stride    stride_a,
+                                           const double*     B,
+                                           int               ldb,
+                                           rocblas_stride    stride_b,
+                                           double*           P,
+                                           rocblas_stride    stride_p)
+    {
+        const double one = 1, zero = 0;
+        return rocblas_dgemm_strided_batched(handle,
+                                             transa,
+                                             transb,
+                                             m,
+                                             n,
+                                             k,
+                                             &one,
+                                             A,
+                                             lda,
+                                             stride_a,
+                                             B,
+                                             ldb,
+                                             stride_b,
+                                             &zero,
+                                             P,
+                                             m,
+                                             stride_p,
+                                             3);
+    }
+
+    // The complex gemm of rocBLAS, for the cases the 3M algorithm saves nothing in
+    rocblas_status hipblas_gemm3m_complex_gemm(rocblas_handle         handle,
+                                               rocblas_operation      transa,
+                                               rocblas_operation      transb,
+                                               int                    m,
+                                               int                    n,
+                                               int                    k,
+                                               const hipFloatComplex* alpha,
+                                               const hipFloatComplex* A,
+                                               int                    lda,
+                                               const hipFloatComplex* B,
+                                               int                    ldb,
+                                               const hipFloatComplex* beta,
+                                               hipFloatComplex*       C,
+                                               int                    ldc)
+    {
+        return rocblas_cgemm(handle,
+                             transa,
+                             transb,
+                             m,
+                             n,
+                             k,
+                             (const rocblas_float_complex*)alpha,
+                             (const rocblas_float_complex*)A,
+                             lda,
+                             (const rocblas_float_complex*)B,
+                             ldb,
+                             (const rocblas_float_complex*)beta,
+                             (rocblas_float_complex*)C,
+                             ldc);
+    }
+
+    rocblas_status hipblas_gemm3m_complex_gemm(rocblas_handle          handle,
+                                               rocblas_operation       transa,
+                                               rocblas_operation       transb,
+                                               int                     m,
+                                               int                     n,
+                                               int                     k,
+                                               const hipDoubleComplex* alpha,
+                                               const hipDoubleComplex* A,
+                                               int                     lda,
+                                               const hipDoubleComplex* B,
+                                               int                     ldb,
+                                               const hipDoubleComplex* beta,
+                                               hipDoubleComplex*       C,
+                                               int                     ldc)
+    {
+        return rocblas_zgemm(handle,
+                             transa,
+                             transb,
+                             m,
+                             n,
+                             k,
+                             (const rocblas_double_complex*)alpha,
+                             (const rocblas_double_complex*)A,
+                             lda,
+                             (const rocblas_double_complex*)B,
+                             ldb,
+                             (const rocblas_double_complex*)beta,
+                             (rocblas_double_complex*)C,
+                             ldc);
+    }
+
+    template <typename T, typename TR>
+    hipblasStatus_t hipblasGemm3mImpl(hipblasHandle_t    handle,
+                                      hipblasOperation_t transa,
+                                      hipblasOperation_t transb,
+                                      int                m,
+                                      int                n,
+                                      int                k,
+                                      const T*           alpha,
+                                      const T*           A,
+                                      int                lda,
+                                      const T*           B,
+                                      int                ldb,
+                                      const T*           beta,
+                                      T*                 C,
+                                      int                ldc)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+        auto valid_trans = [](hipblasOperation_t trans) {
+            return trans == HIPBLAS_OP_N || trans == HIPBLAS_OP_T || trans == HIPBLAS_OP_C;
+        };
+        if(!valid_trans(transa) || !valid_trans(transb))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+        int rows_a = transa == HIPBLAS_OP_N ? m : k;
+        int cols_a = transa == HIPBLAS_OP_N ? k : m;
+        int rows_b = transb == HIPBLAS_OP_N ? k : n;
+        int cols_b = transb == HIPBLAS_OP_N ? n : k;
+        if(m < 0 || n < 0 || k < 0 || lda < std::max(rows_a, 1) || ldb < std::max(rows_b, 1)
+           || ldc < std::max(m, 1))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!m || !n)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !beta)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        rocblas_handle       rhandle = (rocblas_handle)handle;
+        rocblas_pointer_mode mode;
+        hipStream_t          stream;
+        rocblas_status       status = rocblas_get_pointer_mode(rhandle, &mode);
+        if(status != rocblas_status_success
+           || (status = rocblas_get_stream(rhandle, &stream)) != rocblas_status_success)
+            return hipblasConvertStatus(status);
+        bool host_scalars = mode == rocblas_pointer_mode_host;
+
+        // Without products, or with alpha zero given on the host, there is nothing to save
+        if(!k || (host_scalars && alpha->x == 0 && alpha->y == 0))
+            return hipblasConvertStatus(hipblas_gemm3m_complex_gemm(rhandle,
+                                                                    hipblasConvertOperation(transa),
+                                                                    hipblasConvertOperation(transb),
+                                                                    m,
+                                                                    n,
+                                                                    k,
+                                                                    alpha,
+                                                                    A,
+                                                                    lda,
+                                                                    B,
+                                                                    ldb,
+                                                                    beta,
+                                                                    C,
+                                                                    ldc));
+        if(!A || !B || !C)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        // The scratch memory is the planes of A, of B, then P1, P2 and P3
+        size_t plane_a = size_t(rows_a) * cols_a;
+        size_t plane_b = size_t(rows_b) * cols_b;
+        size_t plane_p = size_t(m) * n;
+        size_t bytes_a = hipblas_scratch_pad(3 * plane_a * sizeof(TR));
+        size_t bytes_b = hipblas_scratch_pad(3 * plane_b * sizeof(TR));
+        size_t bytes_p = 3 * plane_p * sizeof(TR);
+
+        char* scratch = (char*)hipblasGetScratch(handle, bytes_a + bytes_b + bytes_p, stream);
+        if(!scratch)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        TR* Ap = (TR*)scratch;
+        TR* Bp = (TR*)(scratch + bytes_a);
+        TR* P  = (TR*)(scratch + bytes_a + bytes_b);
+
+        bool conj_a = transa == HIPBLAS_OP_C;
+        bool conj_b = transb == HIPBLAS_OP_C;
+        if(hipblas_gemm3m_split(rows_a, cols_a, A, lda, conj_a, Ap, plane_a, stream) != hipSuccess
+           || hipblas_gemm3m_split(rows_b, cols_b, B, ldb, conj_b, Bp, plane_b, stream)
+                  != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        // The planes are real, so a conjugate transpose is a transpose of the negated Xi. The
+        // products take their one and zero in host pointer mode.
+        rocblas_operation real_a
+            = transa == HIPBLAS_OP_N ? rocblas_operation_none : rocblas_operation_transpose;
+        rocblas_operation real_b
+            = transb == HIPBLAS_OP_N ? rocblas_operation_none : rocblas_operation_transpose;
+        if(!host_scalars
+           && (status = rocblas_set_pointer_mode(rhandle, rocblas_pointer_mode_host))
+                  != rocblas_status_success)
+            return hipblasConvertStatus(status);
+        status = hipblas_gemm3m_products(rhandle,
+                                         real_a,
+                                         real_b,
+                                         m,
+                                         n,
+                                         k,
+                                         Ap,
+                                         rows_a,
+                                         plane_a,
+                                         Bp,
+                                         rows_b,
+                                         plane_b,
+                                         P,
+                                         plane_p);
+        if(!host_scalars)
+        {
+            rocblas_status mode_status = rocblas_set_pointer_mode(rhandle, mode);
+            if(status == rocblas_status_success)
+                status = mode_status;
+        }
+        if(status != rocblas_status_success)
+            return hipblasConvertStatus(status);
+
+        if(hipblas_gemm3m_combine(m, n, P, plane_p, alpha, beta, host_scalars, C, ldc, stream)
+           != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+hipblasStatus_t hipblasGemm3m(hipblasHandle_t        handle,
+                              hipblasOperation_t     transa,
+                              hipblasOperation_t     transb,
+                              int                    m,
+                              int                    n,
+                              int                    k,
+                              const hipFloatComplex* alpha,
+                              const hipFloatComplex* A,
+                              int                    lda,
+                              const hipFloatComplex* B,
+                              int                    ldb,
+                              const hipFloatComplex* beta,
+                              hipFloatComplex*       C,
+                              int                    ldc)
+{
+    return hipblasGemm3mImpl<hipFloatComplex, float>(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+hipblasStatus_t hipblasGemm3m(hipblasHandle_t         handle,
+                              hipblasOperation_t      transa,
+                              hipblasOperation_t      transb,
+                              int                     m,
+                              int                     n,
+                              int                     k,
+                              const hipDoubleComplex* alpha,
+                              const hipDoubleComplex* A,
+                              int                     lda,
+                              const hipDoubleComplex* B,
+                              int                     ldb,
+                              const hipDoubleComplex* beta,
+                              hipDoubleComplex*       C,
+                              int                     ldc)
+{
+    return hipblasGemm3mImpl<hipDoubleComplex, double>(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
@@ -0,0 +1,65 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+#include <hip/hip_complex.h>
+
+// The 3M algorithm for complex gemms on the rocBLAS backend, used by hipblasCgemm3m and
+// hipblasZgemm3m, and by hipblasCgemm and hipblasZgemm in HIPBLAS_GEMM_3M_MATH mode.
+//
+// With op(A) = Ar + i Ai and op(B) = Br + i Bi, the products P1 = Ar Br, P2 = Ai Bi and
+// P3 = (Ar + Ai)(Br + Bi) give op(A) op(B) = (P1 - P2) + i (P3 - P1 - P2): three real gemms in
+// place of the four of a complex gemm. A and B are split into planes of their real parts,
+// imaginary parts and sums in the scratch memory of the handle, the three products are one
+// strided batched real gemm, and a last kernel forms alpha * op(A) op(B) + beta * C. The sums
+// lose some accuracy when the real and imaginary parts differ greatly in magnitude.
+hipblasStatus_t hipblasGemm3m(hipblasHandle_t        handle,
+                              hipblasOperation_t     transa,
+                              hipblasOperation_t     transb,
+                              int                    m,
+                              int                    n,
+                              int                    k,
+                              const hipFloatComplex* alpha,
+                              const hipFloatComplex* A,
+                              int                    lda,
+                              const hipFloatComplex* B,
+                              int                    ldb,
+                              const hipFloatComplex* beta,
+                              hipFloatComplex*       C,
+                              int                    ldc);
+
+hipblasStatus_t hipblasGemm3m(hipblasHandle_t         handle,
+                              hipblasOperation_t      transa,
+                              hipblasOperation_t      transb,
+                              int                     m,
+                              int                     n,
+                              int                     k,
+                              const hipDoubleComplex* alpha,
+                              const hipDoubleComplex* A,
+                              int                     lda,
+                              const hipDoubleComplex* B,
+                              int                     ldb,
+                              const hipDoubleComplex* beta,
+                              hipDoubleComplex*       C,
+                              int                     ldc);
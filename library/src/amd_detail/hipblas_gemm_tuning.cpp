@@ -0,0 +1,1491 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#define ROCBLAS_NO_DEPRECATED_WARNINGS
+#define ROCBLAS_BETA_FEATURES_API
+#include "hipblas_gemm_tuning.hpp"
+#include "hipblas_batch_split.hpp"
+#include "hipblas_handle_state.hpp"
+#include <hip/hip_runtime_api.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    enum gemm_tuning_kind : int
+    {
+        kind_gemm_ex                 = 0,
+        kind_gemm_batched_ex         = 1,
+        kind_gemm_strided_batched_ex = 2,
+    };
+
+    struct gemm_tuning_key
+    {
+        std::string arch;
+        int         kind;
+        int         transA, transB;
+        int64_t     m, n, k;
+        int64_t     lda, ldb, ldc;
+        int64_t     stride_A, stride_B, stride_C;
+        int64_t     batch_count;
+        int         a_type, b_type, c_type, compute_type;
+        int         math_mode; // of the handle, which the fast f32 compute types set
+        uint32_t    flags;
+
+        auto tie() const
+        {
+            return std::tie(arch,
+                            kind,
+                            transA,
+                            transB,
+                            m,
+                            n,
+                            k,
+                            lda,
+                            ldb,
+                            ldc,
+                            stride_A,
+                            stride_B,
+                            stride_C,
+                            batch_count,
+                            a_type,
+                            b_type,
+                            c_type,
+                            compute_type,
+                            math_mode,
+                            flags);
+        }
+
+        bool operator==(const gemm_tuning_key& rhs) const
+        {
+            return tie() == rhs.tie();
+        }
+    };
+
+    struct gemm_tuning_key_hash
+    {
+        size_t operator()(const gemm_tuning_key& key) const
+        {
+            size_t seed = std::hash<std::string>{}(key.arch);
+            auto   mix  = [&seed](int64_t v) {
+                seed ^= std::hash<int64_t>{}(v) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+            };
+            for(int64_t v : {int64_t(key.kind),
+                             int64_t(key.transA),
+                             int64_t(key.transB),
+                             key.m,
+                             key.n,
+                             key.k,
+                             key.lda,
+                             key.ldb,
+                             key.ldc,
+                             key.stride_A,
+                             key.stride_B,
+                             key.stride_C,
+                             key.batch_count,
+                             int64_t(key.a_type),
+                             int64_t(key.b_type),
+                             int64_t(key.c_type),
+                             int64_t(key.compute_type),
+                             int64_t(key.math_mode),
+                             int64_t(key.flags)})
+                mix(v);
+            return seed;
+        }
+    };
+
+    // A solution sampled by online tuning, the first of a problem being the default heuristic
+    struct online_candidate
+    {
+        int32_t solution;
+        int     samples = 0; // completed timed calls
+        int     running = 0; // timed calls whose events haven't completed
+        float   best_ms = std::numeric_limits<float>::max();
+        bool    dropped = false;
+    };
+
+    // A timed call of a problem being tuned online
+    struct online_sample
+    {
+        int        candidate;
+        hipEvent_t start, stop;
+    };
+
+    // A problem being tuned online, on the calls made with it
+    struct online_problem
+    {
+        std::vector<online_candidate> candidates;
+        std::vector<online_sample>    samples;
+        int                           calls = 0;
+        int                           next  = 0; // the candidate sampled next, round robin
+    };
+
+    struct gemm_tuning_state
+    {
+        std::shared_mutex                                                   mutex;
+        std::unordered_map<gemm_tuning_key, int32_t, gemm_tuning_key_hash> cache;
+        std::map<int, std::string>                                          arch_names;
+        std::string                                                         file;
+        bool                                                                tune  = false;
+        bool                                                                dirty = false;
+        int                                                                 iters = 10;
+
+        // online tuning, set with HIPBLAS_GEMM_TUNING_ONLINE and the limits of its exploration
+        bool   online            = false;
+        int    online_candidates = 4;
+        int    online_samples    = 3;
+        size_t online_problems   = 64;
+
+        // the problems being tuned online, and events of their samples for reuse
+        std::unordered_map<gemm_tuning_key, online_problem, gemm_tuning_key_hash> online_tuning;
+        std::vector<hipEvent_t>                                                    free_events;
+    };
+
+    // Set once at init if a cache file or online tuning is requested; when false the tuned
+    // wrappers forward directly to rocBLAS.
+    std::atomic<bool> g_tuning_active{false};
+    std::once_flag    g_tuning_once;
+
+    gemm_tuning_state& tuning_state()
+    {
+        // Intentionally leaked so the atexit flush can run after other static destructors.
+        static auto* state = new gemm_tuning_state;
+        return *state;
+    }
+
+    bool env_enabled(const char* name)
+    {
+        const char* env = getenv(name);
+        return env && *env && *env != '0';
+    }
+
+    size_t rocblas_datatype_size(rocblas_datatype type)
+    {
+        switch(type)
+        {
+        case rocblas_datatype_i8_r:
+        case rocblas_datatype_u8_r:
+        case rocblas_datatype_f8_r:
+        case rocblas_datatype_bf8_r:
+            return 1;
+        case rocblas_datatype_f16_r:
+        case rocblas_datatype_bf16_r:
+        case rocblas_datatype_i8_c:
+        case rocblas_datatype_u8_c:
+            return 2;
+        case rocblas_datatype_f32_r:
+        case rocblas_datatype_i32_r:
+        case rocblas_datatype_u32_r:
+        case rocblas_datatype_f16_c:
+        case rocblas_datatype_bf16_c:
+            return 4;
+        case rocblas_datatype_f64_r:
+        case rocblas_datatype_f32_c:
+        case rocblas_datatype_i32_c:
+        case rocblas_datatype_u32_c:
+            return 8;
+        default:
+            return 16;
+        }
+    }
+
+    bool parse_cache_line(const std::string& line, gemm_tuning_key& key, int32_t& solution)
+    {
+        std::istringstream in(line);
+        return bool(in >> key.arch >> key.kind >> key.transA >> key.transB >> key.m >> key.n
+                    >> key.k >> key.lda >> key.ldb >> key.ldc >> key.stride_A >> key.stride_B
+                    >> key.stride_C >> key.batch_count >> key.a_type >> key.b_type >> key.c_type
+                    >> key.compute_type >> key.math_mode >> key.flags >> solution);
+    }
+
+    void load_cache_file(gemm_tuning_state& state)
+    {
+        std::ifstream in(state.file);
+        std::string   line;
+        while(std::getline(in, line))
+        {
+            if(line.empty() || line[0] == '#')
+                continue;
+
+            gemm_tuning_key key;
+            int32_t         solution;
+            if(parse_cache_line(line, key, solution))
+                state.cache[key] = solution;
+        }
+    }
+
+    const std::string& device_arch(gemm_tuning_state& state)
+    {
+        int device = 0;
+        if(hipGetDevice(&device) != hipSuccess)
+            device = 0;
+
+        {
+            std::shared_lock<std::shared_mutex> lock(state.mutex);
+            auto                                it = state.arch_names.find(device);
+            if(it != state.arch_names.end())
+                return it->second;
+        }
+
+        hipDeviceProp_t props;
+        std::string     arch = "unknown";
+        if(hipGetDeviceProperties(&props, device) == hipSuccess)
+        {
+            arch = props.gcnArchName;
+            // Whitespace is the field separator in the cache file
+            for(char& c : arch)
+                if(c == ' ' || c == '\t')
+                    c = '_';
+        }
+
+        std::unique_lock<std::shared_mutex> lock(state.mutex);
+        return state.arch_names.emplace(device, arch).first->second;
+    }
+
+    template <typename T_INT>
+    bool fits_int32(std::initializer_list<T_INT> values)
+    {
+        for(T_INT v : values)
+            if(v > T_INT(std::numeric_limits<rocblas_int>::max()))
+                return false;
+        return true;
+    }
+
+    // Device scratch used as the D output while benchmarking, so the user's C is never
+    // overwritten by tuning runs.
+    struct tuning_scratch
+    {
+        void* data     = nullptr;
+        void* pointers = nullptr;
+
+        ~tuning_scratch()
+        {
+            if(data)
+                (void)hipFree(data);
+            if(pointers)
+                (void)hipFree(pointers);
+        }
+    };
+
+    // Times the default heuristic (solution 0) and each rocBLAS candidate with `bench`, and
+    // returns the fastest. Returns -1 if no decision could be made and nothing should be cached.
+    template <typename Bench>
+    int32_t pick_fastest_solution(rocblas_handle                  handle,
+                                  const std::vector<rocblas_int>& candidates,
+                                  int                             iters,
+                                  Bench&&                         bench)
+    {
+        hipStream_t stream;
+        if(rocblas_get_stream(handle, &stream) != rocblas_status_success)
+            return -1;
+
+        hipEvent_t start, stop;
+        if(hipEventCreate(&start) != hipSuccess)
+            return -1;
+        if(hipEventCreate(&stop) != hipSuccess)
+        {
+            (void)hipEventDestroy(start);
+            return -1;
+        }
+
+        float   best_time     = std::numeric_limits<float>::max();
+        int32_t best_solution = -1;
+
+        std::vector<rocblas_int> solutions{0};
+        solutions.insert(solutions.end(), candidates.begin(), candidates.end());
+
+        for(rocblas_int solution : solutions)
+        {
+            // warm-up run; also rejects solutions rocBLAS considers invalid for this problem
+            if(bench(solution) != rocblas_status_success)
+                continue;
+
+            bool ok = hipEventRecord(start, stream) == hipSuccess;
+            for(int i = 0; ok && i < iters; i++)
+                ok = bench(solution) == rocblas_status_success;
+            ok = ok && hipEventRecord(stop, stream) == hipSuccess
+                 && hipEventSynchronize(stop) == hipSuccess;
+
+            float time_ms = 0;
+            if(ok && hipEventElapsedTime(&time_ms, start, stop) == hipSuccess
+               && time_ms < best_time)
+            {
+                best_time     = time_ms;
+                best_solution = solution;
+            }
+        }
+
+        (void)hipEventDestroy(start);
+        (void)hipEventDestroy(stop);
+        return best_solution;
+    }
+
+    bool stream_is_capturing(rocblas_handle handle)
+    {
+        hipStream_t            stream;
+        hipStreamCaptureStatus capture = hipStreamCaptureStatusNone;
+        if(rocblas_get_stream(handle, &stream) != rocblas_status_success
+           || hipStreamIsCapturing(stream, &capture) != hipSuccess)
+            return true;
+        return capture != hipStreamCaptureStatusNone;
+    }
+
+    // Runs the problem of launch with solution, the default heuristic for 0
+    template <typename Launch>
+    rocblas_status launch_solution(Launch&&           launch,
+                                   rocblas_gemm_algo  algo,
+                                   rocblas_gemm_flags flags,
+                                   int32_t            solution)
+    {
+        if(solution <= 0)
+            return launch(algo, 0, flags);
+
+        return launch(rocblas_gemm_algo_solution_index,
+                      solution,
+                      rocblas_gemm_flags(flags | rocblas_gemm_flags_check_solution_index));
+    }
+
+    // Online tuning drops a candidate whose fastest call is this many times slower than the
+    // fastest call of its problem, and decides with the samples it has once a problem has been
+    // called this many times the number of samples it needs, so that a problem whose calls can't
+    // all be timed isn't explored for ever
+    constexpr float online_drop_ratio     = 1.5f;
+    constexpr int   online_max_call_ratio = 4;
+
+    // Called with the mutex of state held
+    hipEvent_t take_event(gemm_tuning_state& state)
+    {
+        if(!state.free_events.empty())
+        {
+            hipEvent_t event = state.free_events.back();
+            state.free_events.pop_back();
+            return event;
+        }
+        hipEvent_t event;
+        return hipEventCreate(&event) == hipSuccess ? event : nullptr;
+    }
+
+    // Adds the times of the samples of problem whose events have completed, without waiting for
+    // the others, and drops the candidates that are too slow. Called with the mutex of state held.
+    void collect_samples(gemm_tuning_state& state, online_problem& problem)
+    {
+        auto completed = [&](online_sample& sample) {
+            hipError_t status = hipEventQuery(sample.stop);
+            if(status == hipErrorNotReady)
+                return false;
+
+            online_candidate& candidate = problem.candidates[sample.candidate];
+            float             ms        = 0;
+            candidate.running--;
+            if(status == hipSuccess
+               && hipEventElapsedTime(&ms, sample.start, sample.stop) == hipSuccess)
+            {
+                candidate.samples++;
+                candidate.best_ms = std::min(candidate.best_ms, ms);
+            }
+            state.free_events.push_back(sample.start);
+            state.free_events.push_back(sample.stop);
+            return true;
+        };
+        auto& samples = problem.samples;
+        samples.erase(std::remove_if(samples.begin(), samples.end(), completed), samples.end());
+
+        float fastest = std::numeric_limits<float>::max();
+        for(const online_candidate& candidate : problem.candidates)
+            fastest = std::min(fastest, candidate.best_ms);
+        for(online_candidate& candidate : problem.candidates)
+        {
+            if(candidate.samples && candidate.best_ms > online_drop_ratio * fastest)
+                candidate.dropped = true;
+        }
+    }
+
+    // Returns the fastest candidate of problem once its tuning is complete, or -1
+    int32_t online_decision(const gemm_tuning_state& state, const online_problem& problem)
+    {
+        const online_candidate* fastest  = nullptr;
+        bool                    complete = true;
+        for(const online_candidate& candidate : problem.candidates)
+        {
+            if(candidate.dropped)
+                continue;
+            if(candidate.samples < state.online_samples)
+                complete = false;
+            if(candidate.samples && (!fastest || candidate.best_ms < fastest->best_ms))
+                fastest = &candidate;
+        }
+
+        int max_calls = online_max_call_ratio * state.online_samples;
+        if(!complete && problem.calls < max_calls * int(problem.candidates.size()))
+            return -1;
+        return fastest ? fastest->solution : 0;
+    }
+
+    // Runs a call of a problem that isn't cached with one of its candidate solutions, timed with
+    // events on the stream of handle. The candidates are the default heuristic and an even
+    // spread of at most online_candidates of the rocBLAS solutions, sampled in turn until each
+    // has online_samples completed calls, and the fastest is then cached. The times are collected
+    // by later calls without waiting, so that tuning never synchronizes the stream, and at most
+    // online_problems problems are tuned at a time, the others running with the default heuristic.
+    template <typename Launch, typename Candidates>
+    rocblas_status online_dispatch(rocblas_handle         handle,
+                                   const gemm_tuning_key& key,
+                                   rocblas_gemm_algo      algo,
+                                   rocblas_gemm_flags     flags,
+                                   Launch&&               launch,
+                                   Candidates&&           candidates)
+    {
+        gemm_tuning_state& state = tuning_state();
+
+        // the solutions of a new problem are listed without holding the mutex
+        bool tuning;
+        {
+            std::shared_lock<std::shared_mutex> lock(state.mutex);
+            tuning = state.online_tuning.count(key) != 0;
+            if(!tuning && state.online_tuning.size() >= state.online_problems)
+                return launch(algo, 0, flags);
+        }
+        std::vector<rocblas_int> solutions;
+        if(!tuning)
+            solutions = candidates();
+
+        std::unique_lock<std::shared_mutex> lock(state.mutex);
+
+        auto it = state.online_tuning.find(key);
+        if(it == state.online_tuning.end())
+        {
+            // the problem may have been decided by another thread in the meantime
+            auto cached = state.cache.find(key);
+            if(cached != state.cache.end())
+            {
+                int32_t solution = cached->second;
+                lock.unlock();
+                return launch_solution(launch, algo, flags, solution);
+            }
+            if(tuning || state.online_tuning.size() >= state.online_problems)
+            {
+                lock.unlock();
+                return launch(algo, 0, flags);
+            }
+            if(solutions.empty())
+            {
+                state.cache[key] = 0;
+                state.dirty      = true;
+                lock.unlock();
+                return launch(algo, 0, flags);
+            }
+
+            online_problem problem;
+            problem.candidates.push_back({0});
+            int count = std::min(state.online_candidates, int(solutions.size()));
+            for(int i = 0; i < count; i++)
+                problem.candidates.push_back({solutions[size_t(i) * solutions.size() / count]});
+            it = state.online_tuning.emplace(key, std::move(problem)).first;
+        }
+
+        online_problem& problem = it->second;
+        problem.calls++;
+        collect_samples(state, problem);
+
+        int32_t solution = online_decision(state, problem);
+        if(solution >= 0)
+        {
+            for(online_sample& sample : problem.samples)
+            {
+                state.free_events.push_back(sample.start);
+                state.free_events.push_back(sample.stop);
+            }
+            state.online_tuning.erase(it);
+            state.cache[key] = solution;
+            state.dirty      = true;
+            lock.unlock();
+            return launch_solution(launch, algo, flags, solution);
+        }
+
+        // the next candidate that needs samples, or the default heuristic untimed while the
+        // samples of all of them are running
+        int num_candidates = int(problem.candidates.size());
+        int next           = -1;
+        for(int i = 0; i < num_candidates && next < 0; i++)
+        {
+            int                     c         = (problem.next + i) % num_candidates;
+            const online_candidate& candidate = problem.candidates[c];
+            if(!candidate.dropped && candidate.samples + candidate.running < state.online_samples)
+                next = c;
+        }
+        if(next < 0)
+        {
+            lock.unlock();
+            return launch(algo, 0, flags);
+        }
+        problem.next                = (next + 1) % num_candidates;
+        online_candidate& candidate = problem.candidates[next];
+
+        hipStream_t stream = nullptr;
+        hipEvent_t  start  = take_event(state);
+        hipEvent_t  stop   = take_event(state);
+        if(!start || !stop || rocblas_get_stream(handle, &stream) != rocblas_status_success
+           || hipEventRecord(start, stream) != hipSuccess)
+        {
+            if(start)
+                state.free_events.push_back(start);
+            if(stop)
+                state.free_events.push_back(stop);
+            lock.unlock();
+            return launch(algo, 0, flags);
+        }
+
+        rocblas_status status = launch_solution(launch, algo, flags, candidate.solution);
+        if(status == rocblas_status_success && hipEventRecord(stop, stream) == hipSuccess)
+        {
+            candidate.running++;
+            problem.samples.push_back({next, start, stop});
+            return status;
+        }
+
+        state.free_events.push_back(start);
+        state.free_events.push_back(stop);
+        if(status == rocblas_status_success || status == rocblas_status_memory_error
+           || candidate.solution == 0)
+            return status;
+
+        // a solution rocBLAS rejects for the problem isn't sampled again
+        candidate.dropped = true;
+        lock.unlock();
+        return launch(algo, 0, flags);
+    }
+
+    // Common lookup / tune / launch path for all three GEMM kinds.
+    //   launch(algo, solution_index, flags) runs the user's problem.
+    //   tune() benchmarks candidates and returns the winner, or -1 if undecided.
+    //   candidates() lists the solutions online tuning samples, empty if it shouldn't.
+    template <typename Launch, typename Tune, typename Candidates>
+    rocblas_status tuned_dispatch(rocblas_handle     handle,
+                                  gemm_tuning_key&   key,
+                                  rocblas_gemm_algo  algo,
+                                  rocblas_gemm_flags flags,
+                                  Launch&&           launch,
+                                  Tune&&             tune,
+                                  Candidates&&       candidates)
+    {
+        // the solution picked by tuning depends on timing, so it isn't reproducible
+        if(!g_tuning_active.load(std::memory_order_relaxed) || !handle
+           || hipblasIsReproducible(hipblasHandle_t(handle)))
+            return launch(algo, 0, flags);
+
+        gemm_tuning_state& state = tuning_state();
+        key.arch                 = device_arch(state);
+        key.flags                = uint32_t(flags);
+
+        // the f32 compute type runs in the xf32 math mode for the fast f32 compute types, see
+        // hipblasFastComputeScope, so the solutions of the two are kept apart
+        rocblas_math_mode math_mode = rocblas_default_math;
+        (void)rocblas_get_math_mode(handle, &math_mode);
+        key.math_mode = math_mode;
+
+        int32_t solution = -1;
+        {
+            std::shared_lock<std::shared_mutex> lock(state.mutex);
+            auto                                it = state.cache.find(key);
+            if(it != state.cache.end())
+                solution = it->second;
+        }
+
+        // candidates can't be timed while capturing or in a workspace size query
+        if(solution < 0 && (state.tune || state.online) && !stream_is_capturing(handle)
+           && !rocblas_is_device_memory_size_query(handle))
+        {
+            if(state.online)
+                return online_dispatch(handle, key, algo, flags, launch, candidates);
+
+            solution = tune();
+            if(solution >= 0)
+            {
+                std::unique_lock<std::shared_mutex> lock(state.mutex);
+                state.cache[key] = solution;
+                state.dirty      = true;
+            }
+        }
+
+        return launch_solution(launch, algo, flags, solution);
+    }
+
+    template <typename T_INT>
+    bool quick_return(T_INT m, T_INT n, T_INT k, T_INT batch_count = 1)
+    {
+        return m <= 0 || n <= 0 || k <= 0 || batch_count <= 0;
+    }
+
+    // FP8 gemms are only computed by the rocBLAS gemm_ex3 functions, which take the FP8 types
+    // as input types with an f32 compute type. They have no 64-bit interface and no solution
+    // selection, so FP8 problems bypass the tuning cache.
+    // Matrix `first` of a strided batch of matrices of type starting at p
+    char* batch_offset(const void* p, rocblas_stride stride, int64_t first, rocblas_datatype type)
+    {
+        return (char*)p + first * stride * rocblas_datatype_size(type);
+    }
+
+    bool is_f8(rocblas_datatype a_type, rocblas_datatype b_type)
+    {
+        return a_type == rocblas_datatype_f8_r || a_type == rocblas_datatype_bf8_r
+               || b_type == rocblas_datatype_f8_r || b_type == rocblas_datatype_bf8_r;
+    }
+
+    // Gathers candidate solution indices with a rocBLAS *_get_solutions entry point.
+    template <typename GetSolutions>
+    std::vector<rocblas_int> query_solutions(GetSolutions&& get_solutions)
+    {
+        rocblas_int size = 0;
+        if(get_solutions(nullptr, &size) != rocblas_status_success || size <= 0)
+            return {};
+
+        std::vector<rocblas_int> list(size);
+        if(get_solutions(list.data(), &size) != rocblas_status_success)
+            return {};
+        list.resize(size);
+        return list;
+    }
+}
+
+void hipblasGemmTuningInit()
+{
+    std::call_once(g_tuning_once, []() {
+        gemm_tuning_state& state = tuning_state();
+
+        const char* file = getenv("HIPBLAS_GEMM_TUNING_FILE");
+        if(file && *file)
+        {
+            state.file = file;
+            load_cache_file(state);
+        }
+
+        state.tune   = env_enabled("HIPBLAS_GEMM_TUNING");
+        state.online = env_enabled("HIPBLAS_GEMM_TUNING_ONLINE");
+
+        const char* iters = getenv("HIPBLAS_GEMM_TUNING_ITERS");
+        if(iters && atoi(iters) > 0)
+            state.iters = atoi(iters);
+
+        const char* candidates = getenv("HIPBLAS_GEMM_TUNING_CANDIDATES");
+        if(candidates && atoi(candidates) > 0)
+            state.online_candidates = atoi(candidates);
+
+        const char* samples = getenv("HIPBLAS_GEMM_TUNING_SAMPLES");
+        if(samples && atoi(samples) > 0)
+            state.online_samples = atoi(samples);
+
+        if(!state.cache.empty() || state.tune || state.online)
+        {
+            g_tuning_active.store(true, std::memory_order_relaxed);
+            if(!state.file.empty())
+                std::atexit(hipblasGemmTuningFlush);
+        }
+    });
+}
+
+void hipblasGemmTuningFlush()
+{
+    if(!g_tuning_active.load(std::memory_order_relaxed))
+        return;
+
+    gemm_tuning_state&                  state = tuning_state();
+    std::unique_lock<std::shared_mutex> lock(state.mutex);
+    if(!state.dirty || state.file.empty())
+        return;
+
+    // Write to a temporary file and rename so a concurrent reader never sees a partial cache.
+    std::string tmp_file = state.file + ".tmp";
+    {
+        std::ofstream out(tmp_file, std::ios::trunc);
+        if(!out)
+            return;
+
+        out << "# hipBLAS GEMM tuning cache\n"
+               "# arch kind transA transB m n k lda ldb ldc stride_A stride_B stride_C "
+               "batch_count a_type b_type c_type compute_type math_mode flags solution_index\n";
+        for(const auto& entry : state.cache)
+        {
+            const gemm_tuning_key& key = entry.first;
+            out << key.arch << ' ' << key.kind << ' ' << key.transA << ' ' << key.transB << ' '
+                << key.m << ' ' << key.n << ' ' << key.k << ' ' << key.lda << ' ' << key.ldb
+                << ' ' << key.ldc << ' ' << key.stride_A << ' ' << key.stride_B << ' '
+                << key.stride_C << ' ' << key.batch_count << ' ' << key.a_type << ' '
+                << key.b_type << ' ' << key.c_type << ' ' << key.compute_type << ' '
+                << key.math_mode << ' ' << key.flags << ' ' << entry.second << '\n';
+        }
+        if(!out)
+            return;
+    }
+
+    if(std::rename(tmp_file.c_str(), state.file.c_str()) == 0)
+        state.dirty = false;
+}
+
+template <typename T_INT>
+rocblas_status hipblasTunedGemmEx(rocblas_handle     handle,
+                                  rocblas_operation  transA,
+                                  rocblas_operation  transB,
+                                  T_INT              m,
+                                  T_INT              n,
+                                  T_INT              k,
+                                  const void*        alpha,
+                                  const void*        A,
+                                  rocblas_datatype   a_type,
+                                  T_INT              lda,
+                                  const void*        B,
+                                  rocblas_datatype   b_type,
+                                  T_INT              ldb,
+                                  const void*        beta,
+                                  const void*        C,
+                                  rocblas_datatype   c_type,
+                                  T_INT              ldc,
+                                  void*              D,
+                                  rocblas_datatype   d_type,
+                                  T_INT              ldd,
+                                  rocblas_datatype   compute_type,
+                                  rocblas_gemm_algo  algo,
+                                  rocblas_gemm_flags flags)
+{
+    if(is_f8(a_type, b_type))
+    {
+        if(!fits_int32({m, n, k, lda, ldb, ldc, ldd}))
+            return rocblas_status_not_implemented;
+        return rocblas_gemm_ex3(handle,
+                                transA,
+                                transB,
+                                m,
+                                n,
+                                k,
+                                alpha,
+                                A,
+                                a_type,
+                                lda,
+                                B,
+                                b_type,
+                                ldb,
+                                beta,
+                                C,
+                                c_type,
+                                ldc,
+                                D,
+                                d_type,
+                                ldd,
+                                rocblas_compute_type_f32,
+                                algo,
+                                0,
+                                flags);
+    }
+
+    auto run = [&](void* d, rocblas_gemm_algo algo_, int32_t solution, rocblas_gemm_flags flags_) {
+        if constexpr(std::is_same<T_INT, int64_t>{})
+            return rocblas_gemm_ex_64(handle,
+                                      transA,
+                                      transB,
+                                      m,
+                                      n,
+                                      k,
+                                      alpha,
+                                      A,
+                                      a_type,
+                                      lda,
+                                      B,
+                                      b_type,
+                                      ldb,
+                                      beta,
+                                      C,
+                                      c_type,
+                                      ldc,
+                                      d,
+                                      d_type,
+                                      ldd,
+                                      compute_type,
+                                      algo_,
+                                      solution,
+                                      flags_);
+        else
+            return rocblas_gemm_ex(handle,
+                                   transA,
+                                   transB,
+                                   m,
+                                   n,
+                                   k,
+                                   alpha,
+                                   A,
+                                   a_type,
+                                   lda,
+                                   B,
+                                   b_type,
+                                   ldb,
+                                   beta,
+                                   C,
+                                   c_type,
+                                   ldc,
+                                   d,
+                                   d_type,
+                                   ldd,
+                                   compute_type,
+                                   algo_,
+                                   solution,
+                                   flags_);
+    };
+
+    auto launch = [&](rocblas_gemm_algo algo_, int32_t solution, rocblas_gemm_flags flags_) {
+        return run(D, algo_, solution, flags_);
+    };
+
+    // the candidate solutions of the problem with the output d
+    auto solutions = [&](void* d) {
+        return query_solutions([&](rocblas_int* list, rocblas_int* size) {
+            return rocblas_gemm_ex_get_solutions(handle,
+                                                 transA,
+                                                 transB,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 alpha,
+                                                 A,
+                                                 a_type,
+                                                 lda,
+                                                 B,
+                                                 b_type,
+                                                 ldb,
+                                                 beta,
+                                                 C,
+                                                 c_type,
+                                                 ldc,
+                                                 d,
+                                                 d_type,
+                                                 ldd,
+                                                 compute_type,
+                                                 rocblas_gemm_algo_solution_index,
+                                                 flags,
+                                                 list,
+                                                 size);
+        });
+    };
+
+    auto tune = [&]() -> int32_t {
+        if(quick_return(m, n, k) || !fits_int32({m, n, k, lda, ldb, ldc, ldd}))
+            return 0;
+
+        tuning_scratch scratch;
+        if(hipMalloc(&scratch.data, size_t(ldd) * n * rocblas_datatype_size(d_type)) != hipSuccess)
+            return -1;
+
+        auto candidates = solutions(scratch.data);
+
+        return pick_fastest_solution(
+            handle, candidates, tuning_state().iters, [&](rocblas_int solution) {
+                return run(scratch.data,
+                           solution ? rocblas_gemm_algo_solution_index : algo,
+                           solution,
+                           flags);
+            });
+    };
+
+    // the candidates of online tuning, which are run on the problem itself
+    auto candidates = [&]() -> std::vector<rocblas_int> {
+        if(quick_return(m, n, k) || !fits_int32({m, n, k, lda, ldb, ldc, ldd}))
+            return {};
+        return solutions(D);
+    };
+
+    gemm_tuning_key key{};
+    key.kind         = kind_gemm_ex;
+    key.transA       = transA;
+    key.transB       = transB;
+    key.m            = m;
+    key.n            = n;
+    key.k            = k;
+    key.lda          = lda;
+    key.ldb          = ldb;
+    key.ldc          = ldc;
+    key.batch_count  = 1;
+    key.a_type       = a_type;
+    key.b_type       = b_type;
+    key.c_type       = c_type;
+    key.compute_type = compute_type;
+
+    return tuned_dispatch(handle, key, algo, flags, launch, tune, candidates);
+}
+
+template <typename T_INT>
+rocblas_status hipblasTunedGemmBatchedEx(rocblas_handle     handle,
+                                         rocblas_operation  transA,
+                                         rocblas_operation  transB,
+                                         T_INT              m,
+                                         T_INT              n,
+                                         T_INT              k,
+                                         const void*        alpha,
+                                         const void*        A,
+                                         rocblas_datatype   a_type,
+                                         T_INT              lda,
+                                         const void*        B,
+                                         rocblas_datatype   b_type,
+                                         T_INT              ldb,
+                                         const void*        beta,
+                                         const void*        C,
+                                         rocblas_datatype   c_type,
+                                         T_INT              ldc,
+                                         void*              D,
+                                         rocblas_datatype   d_type,
+                                         T_INT              ldd,
+                                         T_INT              batch_count,
+                                         rocblas_datatype   compute_type,
+                                         rocblas_gemm_algo  algo,
+                                         rocblas_gemm_flags flags)
+{
+    if(is_f8(a_type, b_type))
+    {
+        if(!fits_int32({m, n, k, lda, ldb, ldc, ldd, batch_count}))
+            return rocblas_status_not_implemented;
+        return rocblas_gemm_batched_ex3(handle,
+                                        transA,
+                                        transB,
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        A,
+                                        a_type,
+                                        lda,
+                                        B,
+                                        b_type,
+                                        ldb,
+                                        beta,
+                                        C,
+                                        c_type,
+                                        ldc,
+                                        D,
+                                        d_type,
+                                        ldd,
+                                        batch_count,
+                                        rocblas_compute_type_f32,
+                                        algo,
+                                        0,
+                                        flags);
+    }
+
+    auto run = [&](void* d, rocblas_gemm_algo algo_, int32_t solution, rocblas_gemm_flags flags_) {
+        if constexpr(std::is_same<T_INT, int64_t>{})
+            return rocblas_gemm_batched_ex_64(handle,
+                                              transA,
+                                              transB,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              a_type,
+                                              lda,
+                                              B,
+                                              b_type,
+                                              ldb,
+                                              beta,
+                                              C,
+                                              c_type,
+                                              ldc,
+                                              d,
+                                              d_type,
+                                              ldd,
+                                              batch_count,
+                                              compute_type,
+                                              algo_,
+                                              solution,
+                                              flags_);
+        else
+            return rocblas_gemm_batched_ex(handle,
+                                           transA,
+                                           transB,
+                                           m,
+                                           n,
+                                           k,
+                                           alpha,
+                                           A,
+                                           a_type,
+                                           lda,
+                                           B,
+                                           b_type,
+                                           ldb,
+                                           beta,
+                                           C,
+                                           c_type,
+                                           ldc,
+                                           d,
+                                           d_type,
+                                           ldd,
+                                           batch_count,
+                                           compute_type,
+                                           algo_,
+                                           solution,
+                                           flags_);
+    };
+
+    auto launch = [&](rocblas_gemm_algo algo_, int32_t solution, rocblas_gemm_flags flags_) {
+        return run(D, algo_, solution, flags_);
+    };
+
+    // the candidate solutions of the problem with the output d
+    auto solutions = [&](void* d) {
+        return query_solutions([&](rocblas_int* list, rocblas_int* size) {
+            return rocblas_gemm_batched_ex_get_solutions(handle,
+                                                         transA,
+                                                         transB,
+                                                         m,
+                                                         n,
+                                                         k,
+                                                         alpha,
+                                                         A,
+                                                         a_type,
+                                                         lda,
+                                                         B,
+                                                         b_type,
+                                                         ldb,
+                                                         beta,
+                                                         C,
+                                                         c_type,
+                                                         ldc,
+                                                         d,
+                                                         d_type,
+                                                         ldd,
+                                                         batch_count,
+                                                         compute_type,
+                                                         rocblas_gemm_algo_solution_index,
+                                                         flags,
+                                                         list,
+                                                         size);
+        });
+    };
+
+    auto tune = [&]() -> int32_t {
+        if(quick_return(m, n, k, batch_count)
+           || !fits_int32({m, n, k, lda, ldb, ldc, ldd, batch_count}))
+            return 0;
+
+        tuning_scratch scratch;
+        size_t         matrix_bytes = size_t(ldd) * n * rocblas_datatype_size(d_type);
+        if(hipMalloc(&scratch.data, matrix_bytes * batch_count) != hipSuccess
+           || hipMalloc(&scratch.pointers, sizeof(void*) * batch_count) != hipSuccess)
+            return -1;
+
+        std::vector<void*> host_pointers(batch_count);
+        for(T_INT b = 0; b < batch_count; b++)
+            host_pointers[b] = static_cast<char*>(scratch.data) + b * matrix_bytes;
+        if(hipMemcpy(scratch.pointers,
+                     host_pointers.data(),
+                     sizeof(void*) * batch_count,
+                     hipMemcpyHostToDevice)
+           != hipSuccess)
+            return -1;
+
+        auto candidates = solutions(scratch.pointers);
+
+        return pick_fastest_solution(
+            handle, candidates, tuning_state().iters, [&](rocblas_int solution) {
+                return run(scratch.pointers,
+                           solution ? rocblas_gemm_algo_solution_index : algo,
+                           solution,
+                           flags);
+            });
+    };
+
+    // the candidates of online tuning, which are run on the problem itself
+    auto candidates = [&]() -> std::vector<rocblas_int> {
+        if(quick_return(m, n, k, batch_count)
+           || !fits_int32({m, n, k, lda, ldb, ldc, ldd, batch_count}))
+            return {};
+        return solutions(D);
+    };
+
+    gemm_tuning_key key{};
+    key.kind         = kind_gemm_batched_ex;
+    key.transA       = transA;
+    key.transB       = transB;
+    key.m            = m;
+    key.n            = n;
+    key.k            = k;
+    key.lda          = lda;
+    key.ldb          = ldb;
+    key.ldc          = ldc;
+    key.batch_count  = batch_count;
+    key.a_type       = a_type;
+    key.b_type       = b_type;
+    key.c_type       = c_type;
+    key.compute_type = compute_type;
+
+    return tuned_dispatch(handle, key, algo, flags, launch, tune, candidates);
+}
+
+template <typename T_INT>
+rocblas_status hipblasTunedGemmStridedBatchedEx(rocblas_handle     handle,
+                                                rocblas_operation  transA,
+                                                rocblas_operation  transB,
+                                                T_INT              m,
+                                                T_INT              n,
+                                                T_INT              k,
+                                                const void*        alpha,
+                                                const void*        A,
+                                                rocblas_datatype   a_type,
+                                                T_INT              lda,
+                                                rocblas_stride     stride_A,
+                                                const void*        B,
+                                                rocblas_datatype   b_type,
+                                                T_INT              ldb,
+                                                rocblas_stride     stride_B,
+                                                const void*        beta,
+                                                const void*        C,
+                                                rocblas_datatype   c_type,
+                                                T_INT              ldc,
+                                                rocblas_stride     stride_C,
+                                                void*              D,
+                                                rocblas_datatype   d_type,
+                                                T_INT              ldd,
+                                                rocblas_stride     stride_D,
+                                                T_INT              batch_count,
+                                                rocblas_datatype   compute_type,
+                                                rocblas_gemm_algo  algo,
+                                                rocblas_gemm_flags flags)
+{
+    // The 64-bit function of rocBLAS takes a batch of any size, but its fp8 function and the
+    // tuning take 32-bit batch counts, so a larger batch of 32-bit sized problems is passed in
+    // chunks of the largest 32-bit batch
+    if constexpr(std::is_same<T_INT, int64_t>{})
+    {
+        constexpr int64_t max_batch_32 = std::numeric_limits<rocblas_int>::max();
+        if(batch_count > max_batch_32 && fits_int32({m, n, k, lda, ldb, ldc, ldd}))
+            return hipblasSplitBatch(batch_count, max_batch_32, [&](int64_t first, int64_t count) {
+                return hipblasTunedGemmStridedBatchedEx<T_INT>(
+                    handle,
+                    transA,
+                    transB,
+                    m,
+                    n,
+                    k,
+                    alpha,
+                    batch_offset(A, stride_A, first, a_type),
+                    a_type,
+                    lda,
+                    stride_A,
+                    batch_offset(B, stride_B, first, b_type),
+                    b_type,
+                    ldb,
+                    stride_B,
+                    beta,
+                    batch_offset(C, stride_C, first, c_type),
+                    c_type,
+                    ldc,
+                    stride_C,
+                    batch_offset(D, stride_D, first, d_type),
+                    d_type,
+                    ldd,
+                    stride_D,
+                    count,
+                    compute_type,
+                    algo,
+                    flags);
+            });
+    }
+
+    if(is_f8(a_type, b_type))
+    {
+        if(!fits_int32({m, n, k, lda, ldb, ldc, ldd, batch_count}))
+            return rocblas_status_not_implemented;
+        return rocblas_gemm_strided_batched_ex3(handle,
+                                                transA,
+                                                transB,
+                                                m,
+                                                n,
+                                                k,
+                                                alpha,
+                                                A,
+                                                a_type,
+                                                lda,
+                                                stride_A,
+                                                B,
+                                                b_type,
+                                                ldb,
+                                                stride_B,
+                                                beta,
+                                                C,
+                                                c_type,
+                                                ldc,
+                                                stride_C,
+                                                D,
+                                                d_type,
+                                                ldd,
+                                                stride_D,
+                                                batch_count,
+                                                rocblas_compute_type_f32,
+                                                algo,
+                                                0,
+                                                flags);
+    }
+
+    auto run = [&](void* d, rocblas_gemm_algo algo_, int32_t solution, rocblas_gemm_flags flags_) {
+        if constexpr(std::is_same<T_INT, int64_t>{})
+            return rocblas_gemm_strided_batched_ex_64(handle,
+                                                      transA,
+                                                      transB,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      alpha,
+                                                      A,
+                                                      a_type,
+                                                      lda,
+                                                      stride_A,
+                                                      B,
+                                                      b_type,
+                                                      ldb,
+                                                      stride_B,
+                                                      beta,
+                                                      C,
+                                                      c_type,
+                                                      ldc,
+                                                      stride_C,
+                                                      d,
+                                                      d_type,
+                                                      ldd,
+                                                      stride_D,
+                                                      batch_count,
+                                                      compute_type,
+                                                      algo_,
+                                                      solution,
+                                                      flags_);
+        else
+            return rocblas_gemm_strided_batched_ex(handle,
+                                                   transA,
+                                                   transB,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   A,
+                                                   a_type,
+                                                   lda,
+                                                   stride_A,
+                                                   B,
+                                                   b_type,
+                                                   ldb,
+                                                   stride_B,
+                                                   beta,
+                                                   C,
+                                                   c_type,
+                                                   ldc,
+                                                   stride_C,
+                                                   d,
+                                                   d_type,
+                                                   ldd,
+                                                   stride_D,
+                                                   batch_count,
+                                                   compute_type,
+                                                   algo_,
+                                                   solution,
+                                                   flags_);
+    };
+
+    auto launch = [&](rocblas_gemm_algo algo_, int32_t solution, rocblas_gemm_flags flags_) {
+        return run(D, algo_, solution, flags_);
+    };
+
+    // the candidate solutions of the problem with the output d
+    auto solutions = [&](void* d) {
+        return query_solutions([&](rocblas_int* list, rocblas_int* size) {
+            return rocblas_gemm_strided_batched_ex_get_solutions(handle,
+                                                                 transA,
+                                                                 transB,
+                                                                 m,
+                                                                 n,
+                                                                 k,
+                                                                 alpha,
+                                                                 A,
+                                                                 a_type,
+                                                                 lda,
+                                                                 stride_A,
+                                                                 B,
+                                                                 b_type,
+                                                                 ldb,
+                                                                 stride_B,
+                                                                 beta,
+                                                                 C,
+                                                                 c_type,
+                                                                 ldc,
+                                                                 stride_C,
+                                                                 d,
+                                                                 d_type,
+                                                                 ldd,
+                                                                 stride_D,
+                                                                 batch_count,
+                                                                 compute_type,
+                                                                 rocblas_gemm_algo_solution_index,
+                                                                 flags,
+                                                                 list,
+                                                                 size);
+        });
+    };
+
+    auto tune = [&]() -> int32_t {
+        if(quick_return(m, n, k, batch_count) || stride_D < 0
+           || !fits_int32({m, n, k, lda, ldb, ldc, ldd, batch_count}))
+            return 0;
+
+        tuning_scratch scratch;
+        size_t         elements = size_t(ldd) * n + size_t(stride_D) * (batch_count - 1);
+        if(hipMalloc(&scratch.data, elements * rocblas_datatype_size(d_type)) != hipSuccess)
+            return -1;
+
+        auto candidates = solutions(scratch.data);
+
+        return pick_fastest_solution(
+            handle, candidates, tuning_state().iters, [&](rocblas_int solution) {
+                return run(scratch.data,
+                           solution ? rocblas_gemm_algo_solution_index : algo,
+                           solution,
+                           flags);
+            });
+    };
+
+    // the candidates of online tuning, which are run on the problem itself
+    auto candidates = [&]() -> std::vector<rocblas_int> {
+        if(quick_return(m, n, k, batch_count) || stride_D < 0
+           || !fits_int32({m, n, k, lda, ldb, ldc, ldd, batch_count}))
+            return {};
+        return solutions(D);
+    };
+
+    gemm_tuning_key key{};
+    key.kind         = kind_gemm_strided_batched_ex;
+    key.transA       = transA;
+    key.transB       = transB;
+    key.m            = m;
+    key.n            = n;
+    key.k            = k;
+    key.lda          = lda;
+    key.ldb          = ldb;
+    key.ldc          = ldc;
+    key.stride_A     = stride_A;
+    key.stride_B     = stride_B;
+    key.stride_C     = stride_C;
+    key.batch_count  = batch_count;
+    key.a_type       = a_type;
+    key.b_type       = b_type;
+    key.c_type       = c_type;
+    key.compute_type = compute_type;
+
+    return tuned_dispatch(handle, key, algo, flags, launch, tune, candidates);
+}
+
+#define INSTANTIATE_TUNED_GEMM(T_INT_)                                                           \
+    template rocblas_status hipblasTunedGemmEx<T_INT_>(rocblas_handle,                           \
+                                                       rocblas_operation,                        \
+                                                       rocblas_operation,                        \
+                                                       T_INT_,                                   \
+                                                       T_INT_,                                   \
+                                                       T_INT_,                                   \
+                                                       const void*,                              \
+                                                       const void*,                              \
+                                                       rocblas_datatype,                         \
+                                                       T_INT_,                                   \
+                                                       const void*,                              \
+                                                       rocblas_datatype,                         \
+                                                       T_INT_,                                   \
+                                                       const void*,                              \
+                                                       const void*,                              \
+                                                       rocblas_datatype,                         \
+                                                       T_INT_,                                   \
+                                                       void*,                                    \
+                                                       rocblas_datatype,                         \
+                                                       T_INT_,                                   \
+                                                       rocblas_datatype,                         \
+                                                       rocblas_gemm_algo,                        \
+                                                       rocblas_gemm_flags);                      \
+    template rocblas_status hipblasTunedGemmBatchedEx<T_INT_>(rocblas_handle,                    \
+                                                              rocblas_operation,                 \
+                                                              rocblas_operation,                 \
+                                                              T_INT_,                            \
+                                                              T_INT_,                            \
+                                                              T_INT_,                            \
+                                                              const void*,                       \
+                                                              const void*,                       \
+                                                              rocblas_datatype,                  \
+                                                              T_INT_,                            \
+                                                              const void*,                       \
+                                                              rocblas_datatype,                  \
+                                                              T_INT_,                            \
+                                                              const void*,                       \
+                                                              const void*,                       \
+                                                              rocblas_datatype,                  \
+                                                              T_INT_,                            \
+                                                              void*,                             \
+                                                              rocblas_datatype,                  \
+                                                              T_INT_,                            \
+                                                              T_INT_,                            \
+                                                              rocblas_datatype,                  \
+                                                              rocblas_gemm_algo,                 \
+                                                              rocblas_gemm_flags);               \
+    template rocblas_status hipblasTunedGemmStridedBatchedEx<T_INT_>(rocblas_handle,             \
+                                                                     rocblas_operation,          \
+                                                                     rocblas_operation,          \
+                                                                     T_INT_,                     \
+                                                                     T_INT_,                     \
+                                                                     T_INT_,                     \
+                                                                     const void*,                \
+                                                                     const void*,                \
+                                                                     rocblas_datatype,           \
+                                                                     T_INT_,                     \
+                                                                     rocblas_stride,             \
+                                                                     const void*,                \
+                                                                     rocblas_datatype,           \
+                                                                     T_INT_,                     \
+                                                                     rocblas_stride,             \
+                                                                     const void*,                \
+                                                                     const void*,                \
+                                                                     rocblas_datatype,           \
+                                                                     T_INT_,                     \
+                                                                     rocblas_stride,             \
+                                                                     void*,                      \
+                                                                     rocblas_datatype,           \
+                                                                     T_INT_,                     \
+                                                                     rocblas_stride,             \
+                                                                     T_INT_,                     \
+                                                                     rocblas_datatype,           \
+                                                                     rocblas_gemm_algo,          \
+                                                                     rocblas_gemm_flags);
+
+INSTANTIATE_TUNED_GEMM(rocblas_int)
+INSTANTIATE_TUNED_GEMM(int64_t)
+
+#undef INSTANTIATE_TUNED_GEMM
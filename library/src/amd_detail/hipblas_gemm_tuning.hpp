@@ -0,0 +1,291 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas_backend.hpp"
+#include <cstdint>
+
+// GEMM solution-index tuning cache for the rocBLAS backend.
+//
+// All hipblasGemm*Ex* wrappers route through the hipblasTunedGemm* functions below. When
+// neither HIPBLAS_GEMM_TUNING_FILE nor HIPBLAS_GEMM_TUNING is set these forward straight to
+// rocBLAS with solution_index == 0, so the cost on the default path is a single flag check.
+//
+//   HIPBLAS_GEMM_TUNING_FILE=<path>  load tuned solutions from <path> at hipblasCreate, and
+//                                    write newly tuned entries back at hipblasDestroy
+//   HIPBLAS_GEMM_TUNING=1            benchmark candidate solutions for problems that are
+//                                    not yet in the cache and remember the fastest one
+//   HIPBLAS_GEMM_TUNING_ITERS=<n>    timed iterations per candidate (default 10)
+//   HIPBLAS_GEMM_TUNING_ONLINE=1     instead sample candidate solutions on the calls made with
+//                                    problems that are not yet in the cache, timed with events
+//                                    on the stream of the call, and remember the fastest one
+//   HIPBLAS_GEMM_TUNING_CANDIDATES=<n>
+//                                    solutions sampled besides the default heuristic (default 4)
+//   HIPBLAS_GEMM_TUNING_SAMPLES=<n>  timed calls per sampled solution (default 3)
+//
+// Cached solutions are passed to rocBLAS with rocblas_gemm_flags_check_solution_index, so a
+// stale entry (e.g. after a rocBLAS upgrade) falls back to the default heuristic.
+//
+// FP8 problems are computed with the rocBLAS gemm_ex3 functions and are never tuned.
+
+// Loads the cache file once per process. Called from hipblasCreate.
+void hipblasGemmTuningInit();
+
+// Writes the cache file if any new entries were tuned. Called from hipblasDestroy.
+void hipblasGemmTuningFlush();
+
+// The result is written to D, which may be C. D is not part of the cache key, so a solution
+// tuned for one output layout is also used for the others.
+template <typename T_INT>
+rocblas_status hipblasTunedGemmEx(rocblas_handle     handle,
+                                  rocblas_operation  transA,
+                                  rocblas_operation  transB,
+                                  T_INT              m,
+                                  T_INT              n,
+                                  T_INT              k,
+                                  const void*        alpha,
+                                  const void*        A,
+                                  rocblas_datatype   a_type,
+                                  T_INT              lda,
+                                  const void*        B,
+                                  rocblas_datatype   b_type,
+                                  T_INT              ldb,
+                                  const void*        beta,
+                                  const void*        C,
+                                  rocblas_datatype   c_type,
+                                  T_INT              ldc,
+                                  void*              D,
+                                  rocblas_datatype   d_type,
+                                  T_INT              ldd,
+                                  rocblas_datatype   compute_type,
+                                  rocblas_gemm_algo  algo,
+                                  rocblas_gemm_flags flags);
+
+template <typename T_INT>
+rocblas_status hipblasTunedGemmBatchedEx(rocblas_handle     handle,
+                                         rocblas_operation  transA,
+                                         rocblas_operation  transB,
+                                         T_INT              m,
+                                         T_INT              n,
+                                         T_INT              k,
+                                         const void*        alpha,
+                                         const void*        A,
+                                         rocblas_datatype   a_type,
+                                         T_INT              lda,
+                                         const void*        B,
+                                         rocblas_datatype   b_type,
+                                         T_INT              ldb,
+                                         const void*        beta,
+                                         const void*        C,
+                                         rocblas_datatype   c_type,
+                                         T_INT              ldc,
+                                         void*              D,
+                                         rocblas_datatype   d_type,
+                                         T_INT              ldd,
+                                         T_INT              batch_count,
+                                         rocblas_datatype   compute_type,
+                                         rocblas_gemm_algo  algo,
+                                         rocblas_gemm_flags flags);
+
+template <typename T_INT>
+rocblas_status hipblasTunedGemmStridedBatchedEx(rocblas_handle     handle,
+                                                rocblas_operation  transA,
+                                                rocblas_operation  transB,
+                                                T_INT              m,
+                                                T_INT              n,
+                                                T_INT              k,
+                                                const void*        alpha,
+                                                const void*        A,
+                                                rocblas_datatype   a_type,
+                                                T_INT              lda,
+                                                rocblas_stride     stride_A,
+                                                const void*        B,
+                                                rocblas_datatype   b_type,
+                                                T_INT              ldb,
+                                                rocblas_stride     stride_B,
+                                                const void*        beta,
+                                                const void*        C,
+                                                rocblas_datatype   c_type,
+                                                T_INT              ldc,
+                                                rocblas_stride     stride_C,
+                                                void*              D,
+                                                rocblas_datatype   d_type,
+                                                T_INT              ldd,
+                                                rocblas_stride     stride_D,
+                                                T_INT              batch_count,
+                                                rocblas_datatype   compute_type,
+                                                rocblas_gemm_algo  algo,
+                                                rocblas_gemm_flags flags);
+
+// In-place versions, with the result written to C
+template <typename T_INT>
+inline rocblas_status hipblasTunedGemmEx(rocblas_handle     handle,
+                                         rocblas_operation  transA,
+                                         rocblas_operation  transB,
+                                         T_INT              m,
+                                         T_INT              n,
+                                         T_INT              k,
+                                         const void*        alpha,
+                                         const void*        A,
+                                         rocblas_datatype   a_type,
+                                         T_INT              lda,
+                                         const void*        B,
+                                         rocblas_datatype   b_type,
+                                         T_INT              ldb,
+                                         const void*        beta,
+                                         void*              C,
+                                         rocblas_datatype   c_type,
+                                         T_INT              ldc,
+                                         rocblas_datatype   compute_type,
+                                         rocblas_gemm_algo  algo,
+                                         rocblas_gemm_flags flags)
+{
+    return hipblasTunedGemmEx<T_INT>(handle,
+                                     transA,
+                                     transB,
+                                     m,
+                                     n,
+                                     k,
+                                     alpha,
+                                     A,
+                                     a_type,
+                                     lda,
+                                     B,
+                                     b_type,
+                                     ldb,
+                                     beta,
+                                     C,
+                                     c_type,
+                                     ldc,
+                                     C,
+                                     c_type,
+                                     ldc,
+                                     compute_type,
+                                     algo,
+                                     flags);
+}
+
+template <typename T_INT>
+inline rocblas_status hipblasTunedGemmBatchedEx(rocblas_handle     handle,
+                                                rocblas_operation  transA,
+                                                rocblas_operation  transB,
+                                                T_INT              m,
+                                                T_INT              n,
+                                                T_INT              k,
+                                                const void*        alpha,
+                                                const void*        A,
+                                                rocblas_datatype   a_type,
+                                                T_INT              lda,
+                                                const void*        B,
+                                                rocblas_datatype   b_type,
+                                                T_INT              ldb,
+                                                const void*        beta,
+                                                void*              C,
+                                                rocblas_datatype   c_type,
+                                                T_INT              ldc,
+                                                T_INT              batch_count,
+                                                rocblas_datatype   compute_type,
+                                                rocblas_gemm_algo  algo,
+                                                rocblas_gemm_flags flags)
+{
+    return hipblasTunedGemmBatchedEx<T_INT>(handle,
+                                            transA,
+                                            transB,
+                                            m,
+                                            n,
+                                            k,
+                                            alpha,
+                                            A,
+                                            a_type,
+                                            lda,
+                                            B,
+                                            b_type,
+                                            ldb,
+                                            beta,
+                                            C,
+                                            c_type,
+                                            ldc,
+                                            C,
+                                            c_type,
+                                            ldc,
+                                            batch_count,
+                                            compute_type,
+                                            algo,
+                                            flags);
+}
+
+template <typename T_INT>
+inline rocblas_status hipblasTunedGemmStridedBatchedEx(rocblas_handle     handle,
+                                                       rocblas_operation  transA,
+                                                       rocblas_operation  transB,
+                                                       T_INT              m,
+                                                       T_INT              n,
+                                                       T_INT              k,
+                                                       const void*        alpha,
+                                                       const void*        A,
+                                                       rocblas_datatype   a_type,
+                                                       T_INT              lda,
+                                                       rocblas_stride     stride_A,
+                                                       const void*        B,
+                                                       rocblas_datatype   b_type,
+                                                       T_INT              ldb,
+                                                       rocblas_stride     stride_B,
+                                                       const void*        beta,
+                                                       void*              C,
+                                                       rocblas_datatype   c_type,
+                                                       T_INT              ldc,
+                                                       rocblas_stride     stride_C,
+                                                       T_INT              batch_count,
+                                                       rocblas_datatype   compute_type,
+                                                       rocblas_gemm_algo  algo,
+                                                       rocblas_gemm_flags flags)
+{
+    return hipblasTunedGemmStridedBatchedEx<T_INT>(handle,
+                                                   transA,
+                                                   transB,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   A,
+                                                   a_type,
+                                                   lda,
+                                                   stride_A,
+                                                   B,
+                                                   b_type,
+                                                   ldb,
+                                                   stride_B,
+                                                   beta,
+                                                   C,
+                                                   c_type,
+                                                   ldc,
+                                                   stride_C,
+                                                   C,
+                                                   c_type,
+                                                   ldc,
+                                                   stride_C,
+                                                   batch_count,
+                                                   compute_type,
+                                                   algo,
+                                                   flags);
+}
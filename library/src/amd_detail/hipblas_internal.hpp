@@ -0,0 +1,183 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+// Declarations shared by the translation units of the rocBLAS backend
+
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "hipblas_backend.hpp"
+#include "hipblas_convert.hpp"
+#include "hipblas_gemm3m.hpp"
+#include "hipblas_gemm_tuning.hpp"
+#include "hipblas_deferred.hpp"
+#include "hipblas_entry.hpp"
+#include "hipblas_gemm_broadcast.hpp"
+#include "hipblas_gemm_complex_half.hpp"
+#include "hipblas_gemm_diagonal_scales.hpp"
+#include "hipblas_gemm_small.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_host_dispatch.hpp"
+#include "hipblas_interleaved_batch.hpp"
+#include "hipblas_managed.hpp"
+#include "hipblas_persistent.hpp"
+#include "hipblas_packed.hpp"
+#include "hipblas_reproducible.hpp"
+#include "hipblas_rounding.hpp"
+#include "hipblas_shape_dispatch.hpp"
+#include "hipblas_staging.hpp"
+#include "hipblas_trace.hpp"
+#include "hipblas_trsm_small.hpp"
+#include "hipblas_matinv.hpp"
+#include "limits.h"
+#ifdef __HIP_PLATFORM_HIPBLASLT__
+#include "hipblas_lt.hpp"
+#endif
+#include <algorithm>
+#include <cstring>
+#include <hip/library_types.h>
+#include <limits>
+#include <math.h>
+#include <type_traits>
+
+extern "C" hipblasStatus_t hipblasInternalGemmExTypes(hipDataType          a_in,
+                                                      hipDataType          b_in,
+                                                      hipDataType          c_in,
+                                                      hipblasComputeType_t compute_in,
+                                                      rocblas_datatype&    a_out,
+                                                      rocblas_datatype&    b_out,
+                                                      rocblas_datatype&    c_out,
+                                                      rocblas_datatype&    compute_out);
+
+// The HIPBLAS_COMPUTE_32F_FAST_* compute types allow the f32 gemms to compute with reduced
+// precision inputs. rocBLAS has one such mode, the xf32 math mode, which all three select
+constexpr bool hipblasIsFastCompute32F(hipblasComputeType_t compute) noexcept
+{
+    return compute == HIPBLAS_COMPUTE_32F_FAST_16F || compute == HIPBLAS_COMPUTE_32F_FAST_16BF
+           || compute == HIPBLAS_COMPUTE_32F_FAST_TF32;
+}
+
+// Sets the xf32 math mode of the rocBLAS handle for the scope of a gemmEx with a
+// HIPBLAS_COMPUTE_32F_FAST_* compute type and restores the previous mode on exit. rocBLAS
+// computes in f32 on the devices without xf32 instructions.
+class hipblasFastComputeScope
+{
+    rocblas_handle    m_handle = nullptr;
+    rocblas_math_mode m_mode   = rocblas_default_math;
+
+public:
+    hipblasFastComputeScope(hipblasHandle_t handle, hipblasComputeType_t compute)
+    {
+        if(!handle || !hipblasIsFastCompute32F(compute))
+            return;
+
+        auto rocblas_handle_ = (rocblas_handle)handle;
+        if(rocblas_get_math_mode(rocblas_handle_, &m_mode) == rocblas_status_success
+           && m_mode != rocblas_xf32_xdl_math_op
+           && rocblas_set_math_mode(rocblas_handle_, rocblas_xf32_xdl_math_op)
+                  == rocblas_status_success)
+            m_handle = rocblas_handle_;
+    }
+
+    ~hipblasFastComputeScope()
+    {
+        if(m_handle)
+            rocblas_set_math_mode(m_handle, m_mode);
+    }
+
+    hipblasFastComputeScope(const hipblasFastComputeScope&) = delete;
+    hipblasFastComputeScope& operator=(const hipblasFastComputeScope&) = delete;
+};
+
+// True if handle is in HIPBLAS_GRAPH_CAPTURE_SAFE mode and its stream is capturing
+bool hipblasCaptureSafeActive(rocblas_handle handle);
+
+// The rocSOLVER wrappers write the result of their argument checks through a host info pointer.
+// hipblasSolverInfo redirects these writes to a local value when they can't go to host memory:
+//   - in HIPBLAS_INFO_MODE_DEVICE info is a device pointer, and store() writes the value to it
+//     on the handle's stream
+//   - while capturing in HIPBLAS_GRAPH_CAPTURE_SAFE mode the value is dropped, as graph replays
+//     would not update it. The argument checks of rocSOLVER still report invalid arguments
+//     through the returned status.
+class hipblasSolverInfo
+{
+    rocblas_handle m_handle;
+    int*           m_device_info = nullptr;
+    int            m_value       = 0;
+
+public:
+    hipblasSolverInfo(rocblas_handle handle, int*& info)
+        : m_handle(handle)
+    {
+        if(!info)
+            return;
+
+        if(hipblasIsDeviceInfoMode(hipblasHandle_t(handle)))
+        {
+            m_device_info = info;
+            info          = &m_value;
+        }
+        else if(hipblasCaptureSafeActive(handle))
+            info = &m_value;
+    }
+
+    hipblasStatus_t store() const
+    {
+        if(!m_device_info)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        hipStream_t    stream;
+        rocblas_status status = rocblas_get_stream(m_handle, &stream);
+        if(status != rocblas_status_success)
+            return hipblasConvertStatus(status);
+
+        if(hipMemsetD32Async(hipDeviceptr_t(m_device_info), m_value, 1, stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+};
+
+// Slow path of hipblasDemandAlloc: query the device memory needed by func, grow the handle's
+// device memory to it and retry
+hipblasStatus_t hipblasDemandAllocRetry(rocblas_handle handle,
+                                        hipblasStatus_t (*func)(void*),
+                                        void*          context);
+
+// Attempt a rocBLAS call; if it gets an allocation error, query the
+// size needed and attempt to allocate it, retrying the operation.
+// The call is inlined and nothing is allocated unless the retry is needed.
+template <typename Func>
+inline hipblasStatus_t hipblasDemandAlloc(rocblas_handle handle, Func&& func)
+{
+    hipblasStatus_t status = func();
+    if(status == HIPBLAS_STATUS_ALLOC_FAILED)
+    {
+        using func_t = std::remove_reference_t<Func>;
+        status       = hipblasDemandAllocRetry(
+            handle, [](void* f) { return (*static_cast<func_t*>(f))(); }, &func);
+    }
+    return status;
+}
+
+#define HIPBLAS_DEMAND_ALLOC(status__) \
+    hipblasDemandAlloc(rocblas_handle(handle), [&]() -> hipblasStatus_t { return status__; })
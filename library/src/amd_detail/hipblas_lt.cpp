@@ -0,0 +1,329 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas_lt.hpp"
+#include <hipblaslt/hipblaslt.h>
+
+#include <array>
+#include <mutex>
+#include <unordered_map>
+
+#define RETURN_IF_HIPBLASLT_ERROR(expr__)      \
+    do                                         \
+    {                                          \
+        hipblasStatus_t status__ = (expr__);   \
+        if(status__ != HIPBLAS_STATUS_SUCCESS) \
+            return status__;                   \
+    } while(0)
+
+namespace
+{
+    // hipBLASLt handles are created once per device and kept for the lifetime of the process,
+    // as hipblasHandle_t has no room for them and creating one per call is expensive
+    hipblasStatus_t lt_handle(hipblasLtHandle_t& handle)
+    {
+        static std::mutex                                 mutex;
+        static std::unordered_map<int, hipblasLtHandle_t> handles;
+
+        int device;
+        if(hipGetDevice(&device) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto it = handles.find(device);
+        if(it == handles.end())
+        {
+            hipblasStatus_t status = hipblasLtCreate(&handle);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            it = handles.emplace(device, handle).first;
+        }
+        handle = it->second;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // The problem of a gemm whose algorithm is cached: the device, the transposes, sizes, types,
+    // leading dimensions and strides, the batch count, the scale type, the pointer mode and the
+    // workspace size
+    using lt_problem = std::array<int64_t, 20>;
+
+    struct lt_problem_hash
+    {
+        size_t operator()(const lt_problem& problem) const
+        {
+            size_t seed = 0;
+            for(int64_t v : problem)
+                seed ^= std::hash<int64_t>{}(v) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+            return seed;
+        }
+    };
+
+    // The heuristic result of each cached problem, with returned == 0 for the problems hipBLASLt
+    // has no algorithm for
+    struct lt_algo
+    {
+        int                              returned;
+        hipblasLtMatmulHeuristicResult_t heuristic;
+    };
+
+    std::mutex& lt_algo_mutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    std::unordered_map<lt_problem, lt_algo, lt_problem_hash>& lt_algo_cache()
+    {
+        static std::unordered_map<lt_problem, lt_algo, lt_problem_hash> cache;
+        return cache;
+    }
+
+    bool lt_compute_type(hipDataType scale_type, hipblasComputeType_t& compute_type)
+    {
+        switch(scale_type)
+        {
+        case HIP_R_16F:
+            compute_type = HIPBLAS_COMPUTE_16F;
+            return true;
+        case HIP_R_32F:
+            compute_type = HIPBLAS_COMPUTE_32F;
+            return true;
+        case HIP_R_64F:
+            compute_type = HIPBLAS_COMPUTE_64F;
+            return true;
+        case HIP_R_32I:
+            compute_type = HIPBLAS_COMPUTE_32I;
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // The descriptors of one matmul, destroyed when the call returns
+    struct lt_matmul
+    {
+        hipblasLtMatmulDesc_t       desc = nullptr;
+        hipblasLtMatrixLayout_t     A    = nullptr;
+        hipblasLtMatrixLayout_t     B    = nullptr;
+        hipblasLtMatrixLayout_t     C    = nullptr;
+        hipblasLtMatmulPreference_t pref = nullptr;
+
+        ~lt_matmul()
+        {
+            if(pref)
+                hipblasLtMatmulPreferenceDestroy(pref);
+            if(C)
+                hipblasLtMatrixLayoutDestroy(C);
+            if(B)
+                hipblasLtMatrixLayoutDestroy(B);
+            if(A)
+                hipblasLtMatrixLayoutDestroy(A);
+            if(desc)
+                hipblasLtMatmulDescDestroy(desc);
+        }
+
+        template <typename T>
+        hipblasStatus_t set(hipblasLtMatmulDescAttributes_t attribute, const T& value)
+        {
+            return hipblasLtMatmulDescSetAttribute(desc, attribute, &value, sizeof(T));
+        }
+
+        hipblasStatus_t layout(hipblasLtMatrixLayout_t& layout,
+                               hipDataType              type,
+                               int64_t                  rows,
+                               int64_t                  cols,
+                               int64_t                  ld,
+                               int64_t                  batch_count,
+                               int64_t                  stride)
+        {
+            RETURN_IF_HIPBLASLT_ERROR(hipblasLtMatrixLayoutCreate(&layout, type, rows, cols, ld));
+            if(batch_count == 1)
+                return HIPBLAS_STATUS_SUCCESS;
+
+            int32_t batch = int32_t(batch_count);
+            RETURN_IF_HIPBLASLT_ERROR(hipblasLtMatrixLayoutSetAttribute(
+                layout, HIPBLASLT_MATRIX_LAYOUT_BATCH_COUNT, &batch, sizeof(batch)));
+            return hipblasLtMatrixLayoutSetAttribute(
+                layout, HIPBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET, &stride, sizeof(stride));
+        }
+    };
+}
+
+int hipblasLtGemm(const hipblasLtGemmArgs& args)
+{
+    hipblasComputeType_t compute_type;
+    if(!lt_compute_type(args.scale_type, compute_type))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblasLtHandle_t handle;
+    RETURN_IF_HIPBLASLT_ERROR(lt_handle(handle));
+
+    hipblasOperation_t     op_a     = args.trans_a ? HIPBLAS_OP_T : HIPBLAS_OP_N;
+    hipblasOperation_t     op_b     = args.trans_b ? HIPBLAS_OP_T : HIPBLAS_OP_N;
+    hipblasLtEpilogue_t    epilogue = hipblasLtEpilogue_t(args.epilogue);
+    hipblasLtPointerMode_t mode     = args.device_scalars ? HIPBLASLT_POINTER_MODE_DEVICE
+                                                          : HIPBLASLT_POINTER_MODE_HOST;
+    uint64_t               max_work = args.workspace_size;
+
+    int        device = 0;
+    lt_problem problem;
+    if(args.cache_algo)
+    {
+        if(hipGetDevice(&device) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        problem = {device,
+                   args.trans_a,
+                   args.trans_b,
+                   args.m,
+                   args.n,
+                   args.k,
+                   args.a_type,
+                   args.lda,
+                   args.stride_a,
+                   args.b_type,
+                   args.ldb,
+                   args.stride_b,
+                   args.c_type,
+                   args.ldc,
+                   args.stride_c,
+                   args.batch_count,
+                   args.scale_type,
+                   args.device_scalars,
+                   int64_t(args.workspace_size),
+                   args.epilogue};
+    }
+
+    lt_matmul matmul;
+    RETURN_IF_HIPBLASLT_ERROR(
+        hipblasLtMatmulDescCreate(&matmul.desc, compute_type, args.scale_type));
+    RETURN_IF_HIPBLASLT_ERROR(matmul.set(HIPBLASLT_MATMUL_DESC_TRANSA, op_a));
+    RETURN_IF_HIPBLASLT_ERROR(matmul.set(HIPBLASLT_MATMUL_DESC_TRANSB, op_b));
+    RETURN_IF_HIPBLASLT_ERROR(matmul.set(HIPBLASLT_MATMUL_DESC_POINTER_MODE, mode));
+    RETURN_IF_HIPBLASLT_ERROR(matmul.set(HIPBLASLT_MATMUL_DESC_EPILOGUE, epilogue));
+    if(args.bias)
+    {
+        RETURN_IF_HIPBLASLT_ERROR(matmul.set(HIPBLASLT_MATMUL_DESC_BIAS_POINTER, args.bias));
+        RETURN_IF_HIPBLASLT_ERROR(matmul.set(HIPBLASLT_MATMUL_DESC_BIAS_DATA_TYPE, args.c_type));
+    }
+    if(args.aux)
+    {
+        RETURN_IF_HIPBLASLT_ERROR(matmul.set(HIPBLASLT_MATMUL_DESC_EPILOGUE_AUX_POINTER, args.aux));
+        RETURN_IF_HIPBLASLT_ERROR(matmul.set(HIPBLASLT_MATMUL_DESC_EPILOGUE_AUX_LD, args.ldaux));
+    }
+    // the outer vector scale modes are in hipBLASLt from version 1.0
+    if(args.outer_vec_scales)
+    {
+#if hipblasltVersionMajor >= 1
+        hipblasLtMatmulMatrixScale_t outer = HIPBLASLT_MATMUL_MATRIX_SCALE_OUTER_VEC_32F;
+        if(args.scale_a)
+            RETURN_IF_HIPBLASLT_ERROR(matmul.set(HIPBLASLT_MATMUL_DESC_A_SCALE_MODE, outer));
+        if(args.scale_b)
+            RETURN_IF_HIPBLASLT_ERROR(matmul.set(HIPBLASLT_MATMUL_DESC_B_SCALE_MODE, outer));
+#else
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+    }
+    if(args.scale_a)
+        RETURN_IF_HIPBLASLT_ERROR(matmul.set(HIPBLASLT_MATMUL_DESC_A_SCALE_POINTER, args.scale_a));
+    if(args.scale_b)
+        RETURN_IF_HIPBLASLT_ERROR(matmul.set(HIPBLASLT_MATMUL_DESC_B_SCALE_POINTER, args.scale_b));
+    if(args.scale_d)
+        RETURN_IF_HIPBLASLT_ERROR(matmul.set(HIPBLASLT_MATMUL_DESC_D_SCALE_POINTER, args.scale_d));
+    if(args.amax_d)
+        RETURN_IF_HIPBLASLT_ERROR(matmul.set(HIPBLASLT_MATMUL_DESC_AMAX_D_POINTER, args.amax_d));
+
+    // D is written in place of C, so both use the layout of C
+    RETURN_IF_HIPBLASLT_ERROR(matmul.layout(matmul.A,
+                                            args.a_type,
+                                            args.trans_a ? args.k : args.m,
+                                            args.trans_a ? args.m : args.k,
+                                            args.lda,
+                                            args.batch_count,
+                                            args.stride_a));
+    RETURN_IF_HIPBLASLT_ERROR(matmul.layout(matmul.B,
+                                            args.b_type,
+                                            args.trans_b ? args.n : args.k,
+                                            args.trans_b ? args.k : args.n,
+                                            args.ldb,
+                                            args.batch_count,
+                                            args.stride_b));
+    RETURN_IF_HIPBLASLT_ERROR(matmul.layout(
+        matmul.C, args.c_type, args.m, args.n, args.ldc, args.batch_count, args.stride_c));
+
+    hipblasLtMatmulHeuristicResult_t heuristic;
+    int                              returned = 0;
+    bool                             cached   = false;
+    if(args.cache_algo)
+    {
+        std::lock_guard<std::mutex> lock(lt_algo_mutex());
+
+        auto it = lt_algo_cache().find(problem);
+        if(it != lt_algo_cache().end())
+        {
+            returned  = it->second.returned;
+            heuristic = it->second.heuristic;
+            cached    = true;
+        }
+    }
+
+    if(!cached)
+    {
+        RETURN_IF_HIPBLASLT_ERROR(hipblasLtMatmulPreferenceCreate(&matmul.pref));
+        RETURN_IF_HIPBLASLT_ERROR(hipblasLtMatmulPreferenceSetAttribute(
+            matmul.pref, HIPBLASLT_MATMUL_PREF_MAX_WORKSPACE_BYTES, &max_work, sizeof(max_work)));
+        RETURN_IF_HIPBLASLT_ERROR(hipblasLtMatmulAlgoGetHeuristic(handle,
+                                                                  matmul.desc,
+                                                                  matmul.A,
+                                                                  matmul.B,
+                                                                  matmul.C,
+                                                                  matmul.C,
+                                                                  matmul.pref,
+                                                                  1,
+                                                                  &heuristic,
+                                                                  &returned));
+        if(args.cache_algo)
+        {
+            std::lock_guard<std::mutex> lock(lt_algo_mutex());
+            lt_algo_cache()[problem] = {returned, heuristic};
+        }
+    }
+    if(returned == 0)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return hipblasLtMatmul(handle,
+                           matmul.desc,
+                           args.alpha,
+                           args.A,
+                           matmul.A,
+                           args.B,
+                           matmul.B,
+                           args.beta,
+                           args.C,
+                           matmul.C,
+                           args.C,
+                           matmul.C,
+                           &heuristic.algo,
+                           heuristic.workspaceSize ? args.workspace : nullptr,
+                           heuristic.workspaceSize,
+                           args.stream);
+}
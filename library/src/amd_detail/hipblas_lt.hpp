@@ -0,0 +1,92 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <hip/hip_runtime_api.h>
+#include <hip/library_types.h>
+
+// hipBLASLt path of hipblasGemmExWithEpilogue and the hipblasGemm*ExWithScales functions on the
+// rocBLAS backend, built when hipBLASLt is found (__HIP_PLATFORM_HIPBLASLT__).
+//
+// hipblaslt.h declares its own hipblasStatus_t and hipblasComputeType_t, so it is only included
+// by hipblas_lt.cpp and this interface uses plain types. The returned status and epilogue are
+// the integer values of hipblasStatus_t and hipblasEpilogue_t, which are the same as those of
+// hipBLASLt.
+struct hipblasLtGemmArgs
+{
+    hipStream_t stream;
+    bool        trans_a;
+    bool        trans_b;
+    int64_t     m;
+    int64_t     n;
+    int64_t     k;
+    const void* alpha;
+    const void* A;
+    hipDataType a_type;
+    int64_t     lda;
+    int64_t     stride_a    = 0;
+    const void* B;
+    hipDataType b_type;
+    int64_t     ldb;
+    int64_t     stride_b    = 0;
+    const void* beta;
+    void*       C;
+    hipDataType c_type;
+    int64_t     ldc;
+    int64_t     stride_c    = 0;
+    int64_t     batch_count = 1;
+
+    // type of alpha, beta and the accumulation
+    hipDataType scale_type;
+    bool        device_scalars;
+
+    // hipblasGemmExWithEpilogue
+    int         epilogue = 1;
+    const void* bias     = nullptr;
+    void*       aux      = nullptr;
+    int64_t     ldaux    = 0;
+
+    // hipblasGemm*ExWithScales, device pointers to a float each
+    const float* scale_a = nullptr;
+    const float* scale_b = nullptr;
+    const float* scale_d = nullptr;
+    float*       amax_d  = nullptr;
+
+    // hipblasGemmExWithDiagonalScales: scale_a and scale_b are vectors of m and n floats, the
+    // scales of the rows of op(A) and the columns of op(B)
+    bool outer_vec_scales = false;
+
+    // hipblasGemmEx in HIPBLAS_GEMM_BACKEND_LT mode: device memory the algorithm may use, and
+    // whether the algorithm is cached by problem rather than queried on every call
+    void*  workspace      = nullptr;
+    size_t workspace_size = 0;
+    bool   cache_algo     = false;
+};
+
+// Computes C = epilogue(alpha * op(A) * op(B) + beta * C), with the scales and amax if set, on
+// args.stream with a hipBLASLt handle for the current device. Only the workspace of args is
+// used, so the call doesn't allocate device memory. Returns HIPBLAS_STATUS_NOT_SUPPORTED if
+// hipBLASLt has no algorithm for the problem.
+int hipblasLtGemm(const hipblasLtGemmArgs& args);
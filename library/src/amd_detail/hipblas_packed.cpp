@@ -0,0 +1,122 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+
+#include <algorithm>
+
+#include "hipblas_internal.hpp"
+#include "hipblas_packed.hpp"
+
+namespace
+{
+    constexpr int hipblas_packed_threads = 256;
+
+    // Offset in the packed format of the first element of column j of the triangle
+    __device__ inline size_t hipblas_packed_column(bool upper, int n, int j)
+    {
+        return upper ? size_t(j) * (j + 1) / 2 : size_t(j) * (2 * size_t(n) - j + 1) / 2;
+    }
+
+    // Copies the triangle of uplo between AP and A: into A when unpack, and into AP otherwise.
+    // Thread r of column j takes the element r of the column within the triangle, which is
+    // row r for the upper triangle and row j + r for the lower one.
+    template <typename T>
+    __global__ void __launch_bounds__(hipblas_packed_threads)
+        hipblasPackedKernel(bool upper, int n, T* AP, T* A, int lda, bool unpack)
+    {
+        int r = blockIdx.x * hipblas_packed_threads + threadIdx.x;
+        for(int j = blockIdx.y; j < n; j += gridDim.y)
+        {
+            int rows = upper ? j + 1 : n - j;
+            if(r >= rows)
+                continue;
+
+            int    i = upper ? r : j + r;
+            size_t p = hipblas_packed_column(upper, n, j) + r;
+            size_t a = i + size_t(j) * lda;
+            if(unpack)
+                A[a] = AP[p];
+            else
+                AP[p] = A[a];
+        }
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblas_packed_copy(
+        hipblasHandle_t handle, hipblasFillMode_t uplo, int n, T* AP, T* A, int lda, bool unpack)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(n < 0 || lda < std::max(1, n))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!n)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!AP || !A)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t    stream;
+        rocblas_status status = rocblas_get_stream((rocblas_handle)handle, &stream);
+        if(status != rocblas_status_success)
+            return hipblasConvertStatus(status);
+
+        dim3 grid((n - 1) / hipblas_packed_threads + 1, std::min(n, 65535));
+        hipblasPackedKernel<T><<<grid, hipblas_packed_threads, 0, stream>>>(
+            uplo == HIPBLAS_FILL_MODE_UPPER, n, AP, A, lda, unpack);
+        if(hipGetLastError() != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+template <typename T>
+hipblasStatus_t hipblasTpttr(
+    hipblasHandle_t handle, hipblasFillMode_t uplo, int n, const T* AP, T* A, int lda)
+{
+    return hipblas_packed_copy(handle, uplo, n, const_cast<T*>(AP), A, lda, true);
+}
+
+template <typename T>
+hipblasStatus_t hipblasTrttp(
+    hipblasHandle_t handle, hipblasFillMode_t uplo, int n, const T* A, int lda, T* AP)
+{
+    return hipblas_packed_copy(handle, uplo, n, AP, const_cast<T*>(A), lda, false);
+}
+
+template hipblasStatus_t hipblasTpttr<float>(
+    hipblasHandle_t, hipblasFillMode_t, int, const float*, float*, int);
+template hipblasStatus_t hipblasTrttp<float>(
+    hipblasHandle_t, hipblasFillMode_t, int, const float*, int, float*);
+template hipblasStatus_t hipblasTpttr<double>(
+    hipblasHandle_t, hipblasFillMode_t, int, const double*, double*, int);
+template hipblasStatus_t hipblasTrttp<double>(
+    hipblasHandle_t, hipblasFillMode_t, int, const double*, int, double*);
+template hipblasStatus_t hipblasTpttr<hipFloatComplex>(
+    hipblasHandle_t, hipblasFillMode_t, int, const hipFloatComplex*, hipFloatComplex*, int);
+template hipblasStatus_t hipblasTrttp<hipFloatComplex>(
+    hipblasHandle_t, hipblasFillMode_t, int, const hipFloatComplex*, int, hipFloatComplex*);
+template hipblasStatus_t hipblasTpttr<hipDoubleComplex>(
+    hipblasHandle_t, hipblasFillMode_t, int, const hipDoubleComplex*, hipDoubleComplex*, int);
+template hipblasStatus_t hipblasTrttp<hipDoubleComplex>(
+    hipblasHandle_t, hipblasFillMode_t, int, const hipDoubleComplex*, int, hipDoubleComplex*);
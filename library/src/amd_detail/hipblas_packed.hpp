@@ -0,0 +1,39 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+#include <hip/hip_complex.h>
+
+// The conversions between the packed format and full storage of triangular matrices on the
+// rocBLAS backend, which has no tpttr or trttp, used by hipblas?tpttr and hipblas?trttp for
+// float, double, hipFloatComplex and hipDoubleComplex. A thread copies an element, and the
+// threads of a block take consecutive rows of a column of the triangle, which is contiguous
+// in both formats.
+template <typename T>
+hipblasStatus_t hipblasTpttr(
+    hipblasHandle_t handle, hipblasFillMode_t uplo, int n, const T* AP, T* A, int lda);
+
+template <typename T>
+hipblasStatus_t hipblasTrttp(
+    hipblasHandle_t handle, hipblasFillMode_t uplo, int n, const T* A, int lda, T* AP);
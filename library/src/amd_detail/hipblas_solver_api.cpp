@@ -0,0 +1,8324 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas_internal.hpp"
+
+extern "C" {
+
+#ifdef __HIP_PLATFORM_SOLVER__
+
+//--------------------------------------------------------------------------------------
+//rocSOLVER functions
+//--------------------------------------------------------------------------------------
+
+constexpr rocblas_evect hipblasConvertEvect(hipblasEvect_t evect) noexcept
+{
+    switch(evect)
+    {
+    case HIPBLAS_EVECT_NONE:
+        return rocblas_evect_none;
+    case HIPBLAS_EVECT_ORIGINAL:
+        return rocblas_evect_original;
+    }
+    hipblasSetEnumStatus(HIPBLAS_STATUS_INVALID_ENUM);
+    return rocblas_evect(0);
+}
+
+constexpr rocblas_svect hipblasConvertSvect(hipblasSvect_t svect) noexcept
+{
+    switch(svect)
+    {
+    case HIPBLAS_SVECT_NONE:
+        return rocblas_svect_none;
+    case HIPBLAS_SVECT_SINGULAR:
+        return rocblas_svect_singular;
+    }
+    hipblasSetEnumStatus(HIPBLAS_STATUS_INVALID_ENUM);
+    return rocblas_svect(0);
+}
+
+// getrf
+hipblasStatus_t hipblasSgetrf(
+    hipblasHandle_t handle, const int n, float* A, const int lda, int* ipiv, int* info)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda);
+
+    if(ipiv != nullptr)
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(
+            rocsolver_sgetrf((rocblas_handle)handle, n, n, A, lda, ipiv, info)));
+    else
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(
+            rocsolver_sgetrf_npvt((rocblas_handle)handle, n, n, A, lda, info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgetrf(
+    hipblasHandle_t handle, const int n, double* A, const int lda, int* ipiv, int* info)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda);
+
+    if(ipiv != nullptr)
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(
+            rocsolver_dgetrf((rocblas_handle)handle, n, n, A, lda, ipiv, info)));
+    else
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(
+            rocsolver_dgetrf_npvt((rocblas_handle)handle, n, n, A, lda, info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrf(
+    hipblasHandle_t handle, const int n, hipblasComplex* A, const int lda, int* ipiv, int* info)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda);
+
+    if(ipiv != nullptr)
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_cgetrf(
+            (rocblas_handle)handle, n, n, (rocblas_float_complex*)A, lda, ipiv, info)));
+    else
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_cgetrf_npvt(
+            (rocblas_handle)handle, n, n, (rocblas_float_complex*)A, lda, info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrf(hipblasHandle_t       handle,
+                              const int             n,
+                              hipblasDoubleComplex* A,
+                              const int             lda,
+                              int*                  ipiv,
+                              int*                  info)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda);
+
+    if(ipiv != nullptr)
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_zgetrf(
+            (rocblas_handle)handle, n, n, (rocblas_double_complex*)A, lda, ipiv, info)));
+    else
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_zgetrf_npvt(
+            (rocblas_handle)handle, n, n, (rocblas_double_complex*)A, lda, info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrf_v2(
+    hipblasHandle_t handle, const int n, hipComplex* A, const int lda, int* ipiv, int* info)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda);
+
+    if(ipiv != nullptr)
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_cgetrf(
+            (rocblas_handle)handle, n, n, (rocblas_float_complex*)A, lda, ipiv, info)));
+    else
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_cgetrf_npvt(
+            (rocblas_handle)handle, n, n, (rocblas_float_complex*)A, lda, info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrf_v2(
+    hipblasHandle_t handle, const int n, hipDoubleComplex* A, const int lda, int* ipiv, int* info)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda);
+
+    if(ipiv != nullptr)
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_zgetrf(
+            (rocblas_handle)handle, n, n, (rocblas_double_complex*)A, lda, ipiv, info)));
+    else
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_zgetrf_npvt(
+            (rocblas_handle)handle, n, n, (rocblas_double_complex*)A, lda, info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// getrf_batched
+hipblasStatus_t hipblasSgetrfBatched(hipblasHandle_t handle,
+                                     const int       n,
+                                     float* const    A[],
+                                     const int       lda,
+                                     int*            ipiv,
+                                     int*            info,
+                                     const int       batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, batch_count);
+
+    if(ipiv != nullptr)
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_sgetrf_batched(
+            (rocblas_handle)handle, n, n, A, lda, ipiv, n, info, batch_count)));
+    else
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_sgetrf_npvt_batched(
+            (rocblas_handle)handle, n, n, A, lda, info, batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgetrfBatched(hipblasHandle_t handle,
+                                     const int       n,
+                                     double* const   A[],
+                                     const int       lda,
+                                     int*            ipiv,
+                                     int*            info,
+                                     const int       batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, batch_count);
+
+    if(ipiv != nullptr)
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_dgetrf_batched(
+            (rocblas_handle)handle, n, n, A, lda, ipiv, n, info, batch_count)));
+    else
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_dgetrf_npvt_batched(
+            (rocblas_handle)handle, n, n, A, lda, info, batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrfBatched(hipblasHandle_t       handle,
+                                     const int             n,
+                                     hipblasComplex* const A[],
+                                     const int             lda,
+                                     int*                  ipiv,
+                                     int*                  info,
+                                     const int             batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, batch_count);
+
+    if(ipiv != nullptr)
+        return HIPBLAS_DEMAND_ALLOC(
+            hipblasConvertStatus(rocsolver_cgetrf_batched((rocblas_handle)handle,
+                                                          n,
+                                                          n,
+                                                          (rocblas_float_complex**)A,
+                                                          lda,
+                                                          ipiv,
+                                                          n,
+                                                          info,
+                                                          batch_count)));
+    else
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_cgetrf_npvt_batched(
+            (rocblas_handle)handle, n, n, (rocblas_float_complex**)A, lda, info, batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrfBatched(hipblasHandle_t             handle,
+                                     const int                   n,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     int*                        ipiv,
+                                     int*                        info,
+                                     const int                   batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, batch_count);
+
+    if(ipiv != nullptr)
+        return HIPBLAS_DEMAND_ALLOC(
+            hipblasConvertStatus(rocsolver_zgetrf_batched((rocblas_handle)handle,
+                                                          n,
+                                                          n,
+                                                          (rocblas_double_complex**)A,
+                                                          lda,
+                                                          ipiv,
+                                                          n,
+                                                          info,
+                                                          batch_count)));
+    else
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_zgetrf_npvt_batched(
+            (rocblas_handle)handle, n, n, (rocblas_double_complex**)A, lda, info, batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrfBatched_v2(hipblasHandle_t   handle,
+                                        const int         n,
+                                        hipComplex* const A[],
+                                        const int         lda,
+                                        int*              ipiv,
+                                        int*              info,
+                                        const int         batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, batch_count);
+
+    if(ipiv != nullptr)
+        return HIPBLAS_DEMAND_ALLOC(
+            hipblasConvertStatus(rocsolver_cgetrf_batched((rocblas_handle)handle,
+                                                          n,
+                                                          n,
+                                                          (rocblas_float_complex**)A,
+                                                          lda,
+                                                          ipiv,
+                                                          n,
+                                                          info,
+                                                          batch_count)));
+    else
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_cgetrf_npvt_batched(
+            (rocblas_handle)handle, n, n, (rocblas_float_complex**)A, lda, info, batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrfBatched_v2(hipblasHandle_t         handle,
+                                        const int               n,
+                                        hipDoubleComplex* const A[],
+                                        const int               lda,
+                                        int*                    ipiv,
+                                        int*                    info,
+                                        const int               batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, batch_count);
+
+    if(ipiv != nullptr)
+        return HIPBLAS_DEMAND_ALLOC(
+            hipblasConvertStatus(rocsolver_zgetrf_batched((rocblas_handle)handle,
+                                                          n,
+                                                          n,
+                                                          (rocblas_double_complex**)A,
+                                                          lda,
+                                                          ipiv,
+                                                          n,
+                                                          info,
+                                                          batch_count)));
+    else
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_zgetrf_npvt_batched(
+            (rocblas_handle)handle, n, n, (rocblas_double_complex**)A, lda, info, batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// getrf_strided_batched
+hipblasStatus_t hipblasSgetrfStridedBatched(hipblasHandle_t     handle,
+                                            const int           n,
+                                            float*              A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            int*                ipiv,
+                                            const hipblasStride strideP,
+                                            int*                info,
+                                            const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, strideA, strideP, batch_count);
+
+    if(hipblasIsInterleavedBatch(handle))
+        return hipblasInterleavedGetrf(
+            handle, n, A, HIP_R_32F, lda, strideA, ipiv, strideP, info, batch_count);
+
+    if(ipiv != nullptr)
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_sgetrf_strided_batched(
+            (rocblas_handle)handle, n, n, A, lda, strideA, ipiv, strideP, info, batch_count)));
+    else
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_sgetrf_npvt_strided_batched(
+            (rocblas_handle)handle, n, n, A, lda, strideA, info, batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgetrfStridedBatched(hipblasHandle_t     handle,
+                                            const int           n,
+                                            double*             A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            int*                ipiv,
+                                            const hipblasStride strideP,
+                                            int*                info,
+                                            const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, strideA, strideP, batch_count);
+
+    if(hipblasIsInterleavedBatch(handle))
+        return hipblasInterleavedGetrf(
+            handle, n, A, HIP_R_64F, lda, strideA, ipiv, strideP, info, batch_count);
+
+    if(ipiv != nullptr)
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_dgetrf_strided_batched(
+            (rocblas_handle)handle, n, n, A, lda, strideA, ipiv, strideP, info, batch_count)));
+    else
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_dgetrf_npvt_strided_batched(
+            (rocblas_handle)handle, n, n, A, lda, strideA, info, batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrfStridedBatched(hipblasHandle_t     handle,
+                                            const int           n,
+                                            hipblasComplex*     A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            int*                ipiv,
+                                            const hipblasStride strideP,
+                                            int*                info,
+                                            const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, strideA, strideP, batch_count);
+
+    if(hipblasIsInterleavedBatch(handle))
+        return hipblasInterleavedGetrf(
+            handle, n, A, HIP_C_32F, lda, strideA, ipiv, strideP, info, batch_count);
+
+    if(ipiv != nullptr)
+        return HIPBLAS_DEMAND_ALLOC(
+            hipblasConvertStatus(rocsolver_cgetrf_strided_batched((rocblas_handle)handle,
+                                                                  n,
+                                                                  n,
+                                                                  (rocblas_float_complex*)A,
+                                                                  lda,
+                                                                  strideA,
+                                                                  ipiv,
+                                                                  strideP,
+                                                                  info,
+                                                                  batch_count)));
+    else
+        return HIPBLAS_DEMAND_ALLOC(
+            hipblasConvertStatus(rocsolver_cgetrf_npvt_strided_batched((rocblas_handle)handle,
+                                                                       n,
+                                                                       n,
+                                                                       (rocblas_float_complex*)A,
+                                                                       lda,
+                                                                       strideA,
+                                                                       info,
+                                                                       batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrfStridedBatched(hipblasHandle_t       handle,
+                                            const int             n,
+                                            hipblasDoubleComplex* A,
+                                            const int             lda,
+                                            const hipblasStride   strideA,
+                                            int*                  ipiv,
+                                            const hipblasStride   strideP,
+                                            int*                  info,
+                                            const int             batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, strideA, strideP, batch_count);
+
+    if(hipblasIsInterleavedBatch(handle))
+        return hipblasInterleavedGetrf(
+            handle, n, A, HIP_C_64F, lda, strideA, ipiv, strideP, info, batch_count);
+
+    if(ipiv != nullptr)
+        return HIPBLAS_DEMAND_ALLOC(
+            hipblasConvertStatus(rocsolver_zgetrf_strided_batched((rocblas_handle)handle,
+                                                                  n,
+                                                                  n,
+                                                                  (rocblas_double_complex*)A,
+                                                                  lda,
+                                                                  strideA,
+                                                                  ipiv,
+                                                                  strideP,
+                                                                  info,
+                                                                  batch_count)));
+    else
+        return HIPBLAS_DEMAND_ALLOC(
+            hipblasConvertStatus(rocsolver_zgetrf_npvt_strided_batched((rocblas_handle)handle,
+                                                                       n,
+                                                                       n,
+                                                                       (rocblas_double_complex*)A,
+                                                                       lda,
+                                                                       strideA,
+                                                                       info,
+                                                                       batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrfStridedBatched_v2(hipblasHandle_t     handle,
+                                               const int           n,
+                                               hipComplex*         A,
+                                               const int           lda,
+                                               const hipblasStride strideA,
+                                               int*                ipiv,
+                                               const hipblasStride strideP,
+                                               int*                info,
+                                               const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, strideA, strideP, batch_count);
+
+    if(hipblasIsInterleavedBatch(handle))
+        return hipblasInterleavedGetrf(
+            handle, n, A, HIP_C_32F, lda, strideA, ipiv, strideP, info, batch_count);
+
+    if(ipiv != nullptr)
+        return HIPBLAS_DEMAND_ALLOC(
+            hipblasConvertStatus(rocsolver_cgetrf_strided_batched((rocblas_handle)handle,
+                                                                  n,
+                                                                  n,
+                                                                  (rocblas_float_complex*)A,
+                                                                  lda,
+                                                                  strideA,
+                                                                  ipiv,
+                                                                  strideP,
+                                                                  info,
+                                                                  batch_count)));
+    else
+        return HIPBLAS_DEMAND_ALLOC(
+            hipblasConvertStatus(rocsolver_cgetrf_npvt_strided_batched((rocblas_handle)handle,
+                                                                       n,
+                                                                       n,
+                                                                       (rocblas_float_complex*)A,
+                                                                       lda,
+                                                                       strideA,
+                                                                       info,
+                                                                       batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrfStridedBatched_v2(hipblasHandle_t     handle,
+                                               const int           n,
+                                               hipDoubleComplex*   A,
+                                               const int           lda,
+                                               const hipblasStride strideA,
+                                               int*                ipiv,
+                                               const hipblasStride strideP,
+                                               int*                info,
+                                               const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, strideA, strideP, batch_count);
+
+    if(hipblasIsInterleavedBatch(handle))
+        return hipblasInterleavedGetrf(
+            handle, n, A, HIP_C_64F, lda, strideA, ipiv, strideP, info, batch_count);
+
+    if(ipiv != nullptr)
+        return HIPBLAS_DEMAND_ALLOC(
+            hipblasConvertStatus(rocsolver_zgetrf_strided_batched((rocblas_handle)handle,
+                                                                  n,
+                                                                  n,
+                                                                  (rocblas_double_complex*)A,
+                                                                  lda,
+                                                                  strideA,
+                                                                  ipiv,
+                                                                  strideP,
+                                                                  info,
+                                                                  batch_count)));
+    else
+        return HIPBLAS_DEMAND_ALLOC(
+            hipblasConvertStatus(rocsolver_zgetrf_npvt_strided_batched((rocblas_handle)handle,
+                                                                       n,
+                                                                       n,
+                                                                       (rocblas_double_complex*)A,
+                                                                       lda,
+                                                                       strideA,
+                                                                       info,
+                                                                       batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// getrs
+hipblasStatus_t hipblasSgetrs(hipblasHandle_t          handle,
+                              const hipblasOperation_t trans,
+                              const int                n,
+                              const int                nrhs,
+                              float*                   A,
+                              const int                lda,
+                              const int*               ipiv,
+                              float*                   B,
+                              const int                ldb,
+                              int*                     info)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(ipiv == NULL && n)
+        *info = -6;
+    else if(B == NULL && n * nrhs)
+        *info = -7;
+    else if(ldb < std::max(1, n))
+        *info = -8;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_sgetrs(
+        (rocblas_handle)handle, hipblasConvertOperation(trans), n, nrhs, A, lda, ipiv, B, ldb)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgetrs(hipblasHandle_t          handle,
+                              const hipblasOperation_t trans,
+                              const int                n,
+                              const int                nrhs,
+                              double*                  A,
+                              const int                lda,
+                              const int*               ipiv,
+                              double*                  B,
+                              const int                ldb,
+                              int*                     info)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(ipiv == NULL && n)
+        *info = -6;
+    else if(B == NULL && n * nrhs)
+        *info = -7;
+    else if(ldb < std::max(1, n))
+        *info = -8;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_dgetrs(
+        (rocblas_handle)handle, hipblasConvertOperation(trans), n, nrhs, A, lda, ipiv, B, ldb)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrs(hipblasHandle_t          handle,
+                              const hipblasOperation_t trans,
+                              const int                n,
+                              const int                nrhs,
+                              hipblasComplex*          A,
+                              const int                lda,
+                              const int*               ipiv,
+                              hipblasComplex*          B,
+                              const int                ldb,
+                              int*                     info)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(ipiv == NULL && n)
+        *info = -6;
+    else if(B == NULL && n * nrhs)
+        *info = -7;
+    else if(ldb < std::max(1, n))
+        *info = -8;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgetrs((rocblas_handle)handle,
+                                              hipblasConvertOperation(trans),
+                                              n,
+                                              nrhs,
+                                              (rocblas_float_complex*)A,
+                                              lda,
+                                              ipiv,
+                                              (rocblas_float_complex*)B,
+                                              ldb)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrs(hipblasHandle_t          handle,
+                              const hipblasOperation_t trans,
+                              const int                n,
+                              const int                nrhs,
+                              hipblasDoubleComplex*    A,
+                              const int                lda,
+                              const int*               ipiv,
+                              hipblasDoubleComplex*    B,
+                              const int                ldb,
+                              int*                     info)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(ipiv == NULL && n)
+        *info = -6;
+    else if(B == NULL && n * nrhs)
+        *info = -7;
+    else if(ldb < std::max(1, n))
+        *info = -8;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgetrs((rocblas_handle)handle,
+                                              hipblasConvertOperation(trans),
+                                              n,
+                                              nrhs,
+                                              (rocblas_double_complex*)A,
+                                              lda,
+                                              ipiv,
+                                              (rocblas_double_complex*)B,
+                                              ldb)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrs_v2(hipblasHandle_t          handle,
+                                 const hipblasOperation_t trans,
+                                 const int                n,
+                                 const int                nrhs,
+                                 hipComplex*              A,
+                                 const int                lda,
+                                 const int*               ipiv,
+                                 hipComplex*              B,
+                                 const int                ldb,
+                                 int*                     info)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(ipiv == NULL && n)
+        *info = -6;
+    else if(B == NULL && n * nrhs)
+        *info = -7;
+    else if(ldb < std::max(1, n))
+        *info = -8;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgetrs((rocblas_handle)handle,
+                                              hipblasConvertOperation(trans),
+                                              n,
+                                              nrhs,
+                                              (rocblas_float_complex*)A,
+                                              lda,
+                                              ipiv,
+                                              (rocblas_float_complex*)B,
+                                              ldb)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrs_v2(hipblasHandle_t          handle,
+                                 const hipblasOperation_t trans,
+                                 const int                n,
+                                 const int                nrhs,
+                                 hipDoubleComplex*        A,
+                                 const int                lda,
+                                 const int*               ipiv,
+                                 hipDoubleComplex*        B,
+                                 const int                ldb,
+                                 int*                     info)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(ipiv == NULL && n)
+        *info = -6;
+    else if(B == NULL && n * nrhs)
+        *info = -7;
+    else if(ldb < std::max(1, n))
+        *info = -8;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgetrs((rocblas_handle)handle,
+                                              hipblasConvertOperation(trans),
+                                              n,
+                                              nrhs,
+                                              (rocblas_double_complex*)A,
+                                              lda,
+                                              ipiv,
+                                              (rocblas_double_complex*)B,
+                                              ldb)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// getrs_batched
+hipblasStatus_t hipblasSgetrsBatched(hipblasHandle_t          handle,
+                                     const hipblasOperation_t trans,
+                                     const int                n,
+                                     const int                nrhs,
+                                     float* const             A[],
+                                     const int                lda,
+                                     const int*               ipiv,
+                                     float* const             B[],
+                                     const int                ldb,
+                                     int*                     info,
+                                     const int                batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, ldb, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(ipiv == NULL && n)
+        *info = -6;
+    else if(B == NULL && n * nrhs)
+        *info = -7;
+    else if(ldb < std::max(1, n))
+        *info = -8;
+    else if(batch_count < 0)
+        *info = -10;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_sgetrs_batched((rocblas_handle)handle,
+                                                      hipblasConvertOperation(trans),
+                                                      n,
+                                                      nrhs,
+                                                      A,
+                                                      lda,
+                                                      ipiv,
+                                                      n,
+                                                      B,
+                                                      ldb,
+                                                      batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgetrsBatched(hipblasHandle_t          handle,
+                                     const hipblasOperation_t trans,
+                                     const int                n,
+                                     const int                nrhs,
+                                     double* const            A[],
+                                     const int                lda,
+                                     const int*               ipiv,
+                                     double* const            B[],
+                                     const int                ldb,
+                                     int*                     info,
+                                     const int                batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, ldb, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(ipiv == NULL && n)
+        *info = -6;
+    else if(B == NULL && n * nrhs)
+        *info = -7;
+    else if(ldb < std::max(1, n))
+        *info = -8;
+    else if(batch_count < 0)
+        *info = -10;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_dgetrs_batched((rocblas_handle)handle,
+                                                      hipblasConvertOperation(trans),
+                                                      n,
+                                                      nrhs,
+                                                      A,
+                                                      lda,
+                                                      ipiv,
+                                                      n,
+                                                      B,
+                                                      ldb,
+                                                      batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrsBatched(hipblasHandle_t          handle,
+                                     const hipblasOperation_t trans,
+                                     const int                n,
+                                     const int                nrhs,
+                                     hipblasComplex* const    A[],
+                                     const int                lda,
+                                     const int*               ipiv,
+                                     hipblasComplex* const    B[],
+                                     const int                ldb,
+                                     int*                     info,
+                                     const int                batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, ldb, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(ipiv == NULL && n)
+        *info = -6;
+    else if(B == NULL && n * nrhs)
+        *info = -7;
+    else if(ldb < std::max(1, n))
+        *info = -8;
+    else if(batch_count < 0)
+        *info = -10;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgetrs_batched((rocblas_handle)handle,
+                                                      hipblasConvertOperation(trans),
+                                                      n,
+                                                      nrhs,
+                                                      (rocblas_float_complex**)A,
+                                                      lda,
+                                                      ipiv,
+                                                      n,
+                                                      (rocblas_float_complex**)B,
+                                                      ldb,
+                                                      batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrsBatched(hipblasHandle_t             handle,
+                                     const hipblasOperation_t    trans,
+                                     const int                   n,
+                                     const int                   nrhs,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     const int*                  ipiv,
+                                     hipblasDoubleComplex* const B[],
+                                     const int                   ldb,
+                                     int*                        info,
+                                     const int                   batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, ldb, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(ipiv == NULL && n)
+        *info = -6;
+    else if(B == NULL && n * nrhs)
+        *info = -7;
+    else if(ldb < std::max(1, n))
+        *info = -8;
+    else if(batch_count < 0)
+        *info = -10;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgetrs_batched((rocblas_handle)handle,
+                                                      hipblasConvertOperation(trans),
+                                                      n,
+                                                      nrhs,
+                                                      (rocblas_double_complex**)A,
+                                                      lda,
+                                                      ipiv,
+                                                      n,
+                                                      (rocblas_double_complex**)B,
+                                                      ldb,
+                                                      batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrsBatched_v2(hipblasHandle_t          handle,
+                                        const hipblasOperation_t trans,
+                                        const int                n,
+                                        const int                nrhs,
+                                        hipComplex* const        A[],
+                                        const int                lda,
+                                        const int*               ipiv,
+                                        hipComplex* const        B[],
+                                        const int                ldb,
+                                        int*                     info,
+                                        const int                batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, ldb, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(ipiv == NULL && n)
+        *info = -6;
+    else if(B == NULL && n * nrhs)
+        *info = -7;
+    else if(ldb < std::max(1, n))
+        *info = -8;
+    else if(batch_count < 0)
+        *info = -10;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgetrs_batched((rocblas_handle)handle,
+                                                      hipblasConvertOperation(trans),
+                                                      n,
+                                                      nrhs,
+                                                      (rocblas_float_complex**)A,
+                                                      lda,
+                                                      ipiv,
+                                                      n,
+                                                      (rocblas_float_complex**)B,
+                                                      ldb,
+                                                      batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrsBatched_v2(hipblasHandle_t          handle,
+                                        const hipblasOperation_t trans,
+                                        const int                n,
+                                        const int                nrhs,
+                                        hipDoubleComplex* const  A[],
+                                        const int                lda,
+                                        const int*               ipiv,
+                                        hipDoubleComplex* const  B[],
+                                        const int                ldb,
+                                        int*                     info,
+                                        const int                batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, ldb, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(ipiv == NULL && n)
+        *info = -6;
+    else if(B == NULL && n * nrhs)
+        *info = -7;
+    else if(ldb < std::max(1, n))
+        *info = -8;
+    else if(batch_count < 0)
+        *info = -10;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgetrs_batched((rocblas_handle)handle,
+                                                      hipblasConvertOperation(trans),
+                                                      n,
+                                                      nrhs,
+                                                      (rocblas_double_complex**)A,
+                                                      lda,
+                                                      ipiv,
+                                                      n,
+                                                      (rocblas_double_complex**)B,
+                                                      ldb,
+                                                      batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// getrs_strided_batched
+hipblasStatus_t hipblasSgetrsStridedBatched(hipblasHandle_t          handle,
+                                            const hipblasOperation_t trans,
+                                            const int                n,
+                                            const int                nrhs,
+                                            float*                   A,
+                                            const int                lda,
+                                            const hipblasStride      strideA,
+                                            const int*               ipiv,
+                                            const hipblasStride      strideP,
+                                            float*                   B,
+                                            const int                ldb,
+                                            const hipblasStride      strideB,
+                                            int*                     info,
+                                            const int                batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, strideA, strideP, ldb, strideB, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(ipiv == NULL && n)
+        *info = -7;
+    else if(B == NULL && n * nrhs)
+        *info = -9;
+    else if(ldb < std::max(1, n))
+        *info = -10;
+    else if(batch_count < 0)
+        *info = -13;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    if(hipblasIsInterleavedBatch(handle))
+        return hipblasInterleavedGetrs(handle,
+                                       trans,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       HIP_R_32F,
+                                       lda,
+                                       strideA,
+                                       ipiv,
+                                       strideP,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       info,
+                                       batch_count);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_sgetrs_strided_batched((rocblas_handle)handle,
+                                                              hipblasConvertOperation(trans),
+                                                              n,
+                                                              nrhs,
+                                                              A,
+                                                              lda,
+                                                              strideA,
+                                                              ipiv,
+                                                              strideP,
+                                                              B,
+                                                              ldb,
+                                                              strideB,
+                                                              batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgetrsStridedBatched(hipblasHandle_t          handle,
+                                            const hipblasOperation_t trans,
+                                            const int                n,
+                                            const int                nrhs,
+                                            double*                  A,
+                                            const int                lda,
+                                            const hipblasStride      strideA,
+                                            const int*               ipiv,
+                                            const hipblasStride      strideP,
+                                            double*                  B,
+                                            const int                ldb,
+                                            const hipblasStride      strideB,
+                                            int*                     info,
+                                            const int                batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, strideA, strideP, ldb, strideB, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(ipiv == NULL && n)
+        *info = -7;
+    else if(B == NULL && n * nrhs)
+        *info = -9;
+    else if(ldb < std::max(1, n))
+        *info = -10;
+    else if(batch_count < 0)
+        *info = -13;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    if(hipblasIsInterleavedBatch(handle))
+        return hipblasInterleavedGetrs(handle,
+                                       trans,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       HIP_R_64F,
+                                       lda,
+                                       strideA,
+                                       ipiv,
+                                       strideP,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       info,
+                                       batch_count);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_dgetrs_strided_batched((rocblas_handle)handle,
+                                                              hipblasConvertOperation(trans),
+                                                              n,
+                                                              nrhs,
+                                                              A,
+                                                              lda,
+                                                              strideA,
+                                                              ipiv,
+                                                              strideP,
+                                                              B,
+                                                              ldb,
+                                                              strideB,
+                                                              batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrsStridedBatched(hipblasHandle_t          handle,
+                                            const hipblasOperation_t trans,
+                                            const int                n,
+                                            const int                nrhs,
+                                            hipblasComplex*          A,
+                                            const int                lda,
+                                            const hipblasStride      strideA,
+                                            const int*               ipiv,
+                                            const hipblasStride      strideP,
+                                            hipblasComplex*          B,
+                                            const int                ldb,
+                                            const hipblasStride      strideB,
+                                            int*                     info,
+                                            const int                batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, strideA, strideP, ldb, strideB, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(ipiv == NULL && n)
+        *info = -7;
+    else if(B == NULL && n * nrhs)
+        *info = -9;
+    else if(ldb < std::max(1, n))
+        *info = -10;
+    else if(batch_count < 0)
+        *info = -13;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    if(hipblasIsInterleavedBatch(handle))
+        return hipblasInterleavedGetrs(handle,
+                                       trans,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       HIP_C_32F,
+                                       lda,
+                                       strideA,
+                                       ipiv,
+                                       strideP,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       info,
+                                       batch_count);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgetrs_strided_batched((rocblas_handle)handle,
+                                                              hipblasConvertOperation(trans),
+                                                              n,
+                                                              nrhs,
+                                                              (rocblas_float_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              ipiv,
+                                                              strideP,
+                                                              (rocblas_float_complex*)B,
+                                                              ldb,
+                                                              strideB,
+                                                              batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrsStridedBatched(hipblasHandle_t          handle,
+                                            const hipblasOperation_t trans,
+                                            const int                n,
+                                            const int                nrhs,
+                                            hipblasDoubleComplex*    A,
+                                            const int                lda,
+                                            const hipblasStride      strideA,
+                                            const int*               ipiv,
+                                            const hipblasStride      strideP,
+                                            hipblasDoubleComplex*    B,
+                                            const int                ldb,
+                                            const hipblasStride      strideB,
+                                            int*                     info,
+                                            const int                batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, strideA, strideP, ldb, strideB, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(ipiv == NULL && n)
+        *info = -7;
+    else if(B == NULL && n * nrhs)
+        *info = -9;
+    else if(ldb < std::max(1, n))
+        *info = -10;
+    else if(batch_count < 0)
+        *info = -13;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    if(hipblasIsInterleavedBatch(handle))
+        return hipblasInterleavedGetrs(handle,
+                                       trans,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       HIP_C_64F,
+                                       lda,
+                                       strideA,
+                                       ipiv,
+                                       strideP,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       info,
+                                       batch_count);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgetrs_strided_batched((rocblas_handle)handle,
+                                                              hipblasConvertOperation(trans),
+                                                              n,
+                                                              nrhs,
+                                                              (rocblas_double_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              ipiv,
+                                                              strideP,
+                                                              (rocblas_double_complex*)B,
+                                                              ldb,
+                                                              strideB,
+                                                              batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrsStridedBatched_v2(hipblasHandle_t          handle,
+                                               const hipblasOperation_t trans,
+                                               const int                n,
+                                               const int                nrhs,
+                                               hipComplex*              A,
+                                               const int                lda,
+                                               const hipblasStride      strideA,
+                                               const int*               ipiv,
+                                               const hipblasStride      strideP,
+                                               hipComplex*              B,
+                                               const int                ldb,
+                                               const hipblasStride      strideB,
+                                               int*                     info,
+                                               const int                batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, strideA, strideP, ldb, strideB, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(ipiv == NULL && n)
+        *info = -7;
+    else if(B == NULL && n * nrhs)
+        *info = -9;
+    else if(ldb < std::max(1, n))
+        *info = -10;
+    else if(batch_count < 0)
+        *info = -13;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    if(hipblasIsInterleavedBatch(handle))
+        return hipblasInterleavedGetrs(handle,
+                                       trans,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       HIP_C_32F,
+                                       lda,
+                                       strideA,
+                                       ipiv,
+                                       strideP,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       info,
+                                       batch_count);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgetrs_strided_batched((rocblas_handle)handle,
+                                                              hipblasConvertOperation(trans),
+                                                              n,
+                                                              nrhs,
+                                                              (rocblas_float_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              ipiv,
+                                                              strideP,
+                                                              (rocblas_float_complex*)B,
+                                                              ldb,
+                                                              strideB,
+                                                              batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrsStridedBatched_v2(hipblasHandle_t          handle,
+                                               const hipblasOperation_t trans,
+                                               const int                n,
+                                               const int                nrhs,
+                                               hipDoubleComplex*        A,
+                                               const int                lda,
+                                               const hipblasStride      strideA,
+                                               const int*               ipiv,
+                                               const hipblasStride      strideP,
+                                               hipDoubleComplex*        B,
+                                               const int                ldb,
+                                               const hipblasStride      strideB,
+                                               int*                     info,
+                                               const int                batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, strideA, strideP, ldb, strideB, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(ipiv == NULL && n)
+        *info = -7;
+    else if(B == NULL && n * nrhs)
+        *info = -9;
+    else if(ldb < std::max(1, n))
+        *info = -10;
+    else if(batch_count < 0)
+        *info = -13;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    if(hipblasIsInterleavedBatch(handle))
+        return hipblasInterleavedGetrs(handle,
+                                       trans,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       HIP_C_64F,
+                                       lda,
+                                       strideA,
+                                       ipiv,
+                                       strideP,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       info,
+                                       batch_count);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgetrs_strided_batched((rocblas_handle)handle,
+                                                              hipblasConvertOperation(trans),
+                                                              n,
+                                                              nrhs,
+                                                              (rocblas_double_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              ipiv,
+                                                              strideP,
+                                                              (rocblas_double_complex*)B,
+                                                              ldb,
+                                                              strideB,
+                                                              batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// getri_batched
+hipblasStatus_t hipblasSgetriBatched(hipblasHandle_t handle,
+                                     const int       n,
+                                     float* const    A[],
+                                     const int       lda,
+                                     int*            ipiv,
+                                     float* const    C[],
+                                     const int       ldc,
+                                     int*            info,
+                                     const int       batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, ldc, batch_count);
+
+    if(ipiv != nullptr)
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_sgetri_outofplace_batched(
+            (rocblas_handle)handle, n, A, lda, ipiv, n, C, ldc, info, batch_count)));
+    else
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_sgetri_npvt_outofplace_batched(
+            (rocblas_handle)handle, n, A, lda, C, ldc, info, batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgetriBatched(hipblasHandle_t handle,
+                                     const int       n,
+                                     double* const   A[],
+                                     const int       lda,
+                                     int*            ipiv,
+                                     double* const   C[],
+                                     const int       ldc,
+                                     int*            info,
+                                     const int       batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, ldc, batch_count);
+
+    if(ipiv != nullptr)
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_dgetri_outofplace_batched(
+            (rocblas_handle)handle, n, A, lda, ipiv, n, C, ldc, info, batch_count)));
+    else
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_dgetri_npvt_outofplace_batched(
+            (rocblas_handle)handle, n, A, lda, C, ldc, info, batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetriBatched(hipblasHandle_t       handle,
+                                     const int             n,
+                                     hipblasComplex* const A[],
+                                     const int             lda,
+                                     int*                  ipiv,
+                                     hipblasComplex* const C[],
+                                     const int             ldc,
+                                     int*                  info,
+                                     const int             batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, ldc, batch_count);
+
+    if(ipiv != nullptr)
+        return HIPBLAS_DEMAND_ALLOC(
+            hipblasConvertStatus(rocsolver_cgetri_outofplace_batched((rocblas_handle)handle,
+                                                                     n,
+                                                                     (rocblas_float_complex**)A,
+                                                                     lda,
+                                                                     ipiv,
+                                                                     n,
+                                                                     (rocblas_float_complex**)C,
+                                                                     ldc,
+                                                                     info,
+                                                                     batch_count)));
+    else
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(
+            rocsolver_cgetri_npvt_outofplace_batched((rocblas_handle)handle,
+                                                     n,
+                                                     (rocblas_float_complex**)A,
+                                                     lda,
+                                                     (rocblas_float_complex**)C,
+                                                     ldc,
+                                                     info,
+                                                     batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetriBatched(hipblasHandle_t             handle,
+                                     const int                   n,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     int*                        ipiv,
+                                     hipblasDoubleComplex* const C[],
+                                     const int                   ldc,
+                                     int*                        info,
+                                     const int                   batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, ldc, batch_count);
+
+    if(ipiv != nullptr)
+        return HIPBLAS_DEMAND_ALLOC(
+            hipblasConvertStatus(rocsolver_zgetri_outofplace_batched((rocblas_handle)handle,
+                                                                     n,
+                                                                     (rocblas_double_complex**)A,
+                                                                     lda,
+                                                                     ipiv,
+                                                                     n,
+                                                                     (rocblas_double_complex**)C,
+                                                                     ldc,
+                                                                     info,
+                                                                     batch_count)));
+    else
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(
+            rocsolver_zgetri_npvt_outofplace_batched((rocblas_handle)handle,
+                                                     n,
+                                                     (rocblas_double_complex**)A,
+                                                     lda,
+                                                     (rocblas_double_complex**)C,
+                                                     ldc,
+                                                     info,
+                                                     batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetriBatched_v2(hipblasHandle_t   handle,
+                                        const int         n,
+                                        hipComplex* const A[],
+                                        const int         lda,
+                                        int*              ipiv,
+                                        hipComplex* const C[],
+                                        const int         ldc,
+                                        int*              info,
+                                        const int         batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, ldc, batch_count);
+
+    if(ipiv != nullptr)
+        return HIPBLAS_DEMAND_ALLOC(
+            hipblasConvertStatus(rocsolver_cgetri_outofplace_batched((rocblas_handle)handle,
+                                                                     n,
+                                                                     (rocblas_float_complex**)A,
+                                                                     lda,
+                                                                     ipiv,
+                                                                     n,
+                                                                     (rocblas_float_complex**)C,
+                                                                     ldc,
+                                                                     info,
+                                                                     batch_count)));
+    else
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(
+            rocsolver_cgetri_npvt_outofplace_batched((rocblas_handle)handle,
+                                                     n,
+                                                     (rocblas_float_complex**)A,
+                                                     lda,
+                                                     (rocblas_float_complex**)C,
+                                                     ldc,
+                                                     info,
+                                                     batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetriBatched_v2(hipblasHandle_t         handle,
+                                        const int               n,
+                                        hipDoubleComplex* const A[],
+                                        const int               lda,
+                                        int*                    ipiv,
+                                        hipDoubleComplex* const C[],
+                                        const int               ldc,
+                                        int*                    info,
+                                        const int               batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, ldc, batch_count);
+
+    if(ipiv != nullptr)
+        return HIPBLAS_DEMAND_ALLOC(
+            hipblasConvertStatus(rocsolver_zgetri_outofplace_batched((rocblas_handle)handle,
+                                                                     n,
+                                                                     (rocblas_double_complex**)A,
+                                                                     lda,
+                                                                     ipiv,
+                                                                     n,
+                                                                     (rocblas_double_complex**)C,
+                                                                     ldc,
+                                                                     info,
+                                                                     batch_count)));
+    else
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(
+            rocsolver_zgetri_npvt_outofplace_batched((rocblas_handle)handle,
+                                                     n,
+                                                     (rocblas_double_complex**)A,
+                                                     lda,
+                                                     (rocblas_double_complex**)C,
+                                                     ldc,
+                                                     info,
+                                                     batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// matinv_batched
+hipblasStatus_t hipblasSmatinvBatched(hipblasHandle_t    handle,
+                                      const int          n,
+                                      const float* const A[],
+                                      const int          lda,
+                                      float* const       Ainv[],
+                                      const int          lda_inv,
+                                      int*               info,
+                                      const int          batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, lda_inv, batch_count);
+    return hipblasMatinv(
+        handle, n, A, HIP_R_32F, lda, 0, (void*)Ainv, lda_inv, 0, info, batch_count, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDmatinvBatched(hipblasHandle_t     handle,
+                                      const int           n,
+                                      const double* const A[],
+                                      const int           lda,
+                                      double* const       Ainv[],
+                                      const int           lda_inv,
+                                      int*                info,
+                                      const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, lda_inv, batch_count);
+    return hipblasMatinv(
+        handle, n, A, HIP_R_64F, lda, 0, (void*)Ainv, lda_inv, 0, info, batch_count, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCmatinvBatched(hipblasHandle_t             handle,
+                                      const int                   n,
+                                      const hipblasComplex* const A[],
+                                      const int                   lda,
+                                      hipblasComplex* const       Ainv[],
+                                      const int                   lda_inv,
+                                      int*                        info,
+                                      const int                   batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, lda_inv, batch_count);
+    return hipblasMatinv(
+        handle, n, A, HIP_C_32F, lda, 0, (void*)Ainv, lda_inv, 0, info, batch_count, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZmatinvBatched(hipblasHandle_t                   handle,
+                                      const int                         n,
+                                      const hipblasDoubleComplex* const A[],
+                                      const int                         lda,
+                                      hipblasDoubleComplex* const       Ainv[],
+                                      const int                         lda_inv,
+                                      int*                              info,
+                                      const int                         batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, lda_inv, batch_count);
+    return hipblasMatinv(
+        handle, n, A, HIP_C_64F, lda, 0, (void*)Ainv, lda_inv, 0, info, batch_count, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCmatinvBatched_v2(hipblasHandle_t         handle,
+                                         const int               n,
+                                         const hipComplex* const A[],
+                                         const int               lda,
+                                         hipComplex* const       Ainv[],
+                                         const int               lda_inv,
+                                         int*                    info,
+                                         const int               batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, lda_inv, batch_count);
+    return hipblasMatinv(
+        handle, n, A, HIP_C_32F, lda, 0, (void*)Ainv, lda_inv, 0, info, batch_count, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZmatinvBatched_v2(hipblasHandle_t               handle,
+                                         const int                     n,
+                                         const hipDoubleComplex* const A[],
+                                         const int                     lda,
+                                         hipDoubleComplex* const       Ainv[],
+                                         const int                     lda_inv,
+                                         int*                          info,
+                                         const int                     batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, lda_inv, batch_count);
+    return hipblasMatinv(
+        handle, n, A, HIP_C_64F, lda, 0, (void*)Ainv, lda_inv, 0, info, batch_count, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// matinv_strided_batched
+hipblasStatus_t hipblasSmatinvStridedBatched(hipblasHandle_t     handle,
+                                             const int           n,
+                                             const float*        A,
+                                             const int           lda,
+                                             const hipblasStride strideA,
+                                             float*              Ainv,
+                                             const int           lda_inv,
+                                             const hipblasStride strideAinv,
+                                             int*                info,
+                                             const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, strideA, lda_inv, strideAinv, batch_count);
+    return hipblasMatinv(
+        handle, n, A, HIP_R_32F, lda, strideA, Ainv, lda_inv, strideAinv, info, batch_count, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDmatinvStridedBatched(hipblasHandle_t     handle,
+                                             const int           n,
+                                             const double*       A,
+                                             const int           lda,
+                                             const hipblasStride strideA,
+                                             double*             Ainv,
+                                             const int           lda_inv,
+                                             const hipblasStride strideAinv,
+                                             int*                info,
+                                             const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, strideA, lda_inv, strideAinv, batch_count);
+    return hipblasMatinv(
+        handle, n, A, HIP_R_64F, lda, strideA, Ainv, lda_inv, strideAinv, info, batch_count, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCmatinvStridedBatched(hipblasHandle_t       handle,
+                                             const int             n,
+                                             const hipblasComplex* A,
+                                             const int             lda,
+                                             const hipblasStride   strideA,
+                                             hipblasComplex*       Ainv,
+                                             const int             lda_inv,
+                                             const hipblasStride   strideAinv,
+                                             int*                  info,
+                                             const int             batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, strideA, lda_inv, strideAinv, batch_count);
+    return hipblasMatinv(
+        handle, n, A, HIP_C_32F, lda, strideA, Ainv, lda_inv, strideAinv, info, batch_count, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZmatinvStridedBatched(hipblasHandle_t             handle,
+                                             const int                   n,
+                                             const hipblasDoubleComplex* A,
+                                             const int                   lda,
+                                             const hipblasStride         strideA,
+                                             hipblasDoubleComplex*       Ainv,
+                                             const int                   lda_inv,
+                                             const hipblasStride         strideAinv,
+                                             int*                        info,
+                                             const int                   batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, strideA, lda_inv, strideAinv, batch_count);
+    return hipblasMatinv(
+        handle, n, A, HIP_C_64F, lda, strideA, Ainv, lda_inv, strideAinv, info, batch_count, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCmatinvStridedBatched_v2(hipblasHandle_t     handle,
+                                                const int           n,
+                                                const hipComplex*   A,
+                                                const int           lda,
+                                                const hipblasStride strideA,
+                                                hipComplex*         Ainv,
+                                                const int           lda_inv,
+                                                const hipblasStride strideAinv,
+                                                int*                info,
+                                                const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, strideA, lda_inv, strideAinv, batch_count);
+    return hipblasMatinv(
+        handle, n, A, HIP_C_32F, lda, strideA, Ainv, lda_inv, strideAinv, info, batch_count, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZmatinvStridedBatched_v2(hipblasHandle_t         handle,
+                                                const int               n,
+                                                const hipDoubleComplex* A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                hipDoubleComplex*       Ainv,
+                                                const int               lda_inv,
+                                                const hipblasStride     strideAinv,
+                                                int*                    info,
+                                                const int               batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, strideA, lda_inv, strideAinv, batch_count);
+    return hipblasMatinv(
+        handle, n, A, HIP_C_64F, lda, strideA, Ainv, lda_inv, strideAinv, info, batch_count, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// geqrf
+hipblasStatus_t hipblasSgeqrf(hipblasHandle_t handle,
+                              const int       m,
+                              const int       n,
+                              float*          A,
+                              const int       lda,
+                              float*          tau,
+                              int*            info)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL && m * n)
+        *info = -5;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_sgeqrf((rocblas_handle)handle, m, n, A, lda, tau)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgeqrf(hipblasHandle_t handle,
+                              const int       m,
+                              const int       n,
+                              double*         A,
+                              const int       lda,
+                              double*         tau,
+                              int*            info)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL && m * n)
+        *info = -5;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_dgeqrf((rocblas_handle)handle, m, n, A, lda, tau)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgeqrf(hipblasHandle_t handle,
+                              const int       m,
+                              const int       n,
+                              hipblasComplex* A,
+                              const int       lda,
+                              hipblasComplex* tau,
+                              int*            info)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL && m * n)
+        *info = -5;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgeqrf((rocblas_handle)handle,
+                                              m,
+                                              n,
+                                              (rocblas_float_complex*)A,
+                                              lda,
+                                              (rocblas_float_complex*)tau)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgeqrf(hipblasHandle_t       handle,
+                              const int             m,
+                              const int             n,
+                              hipblasDoubleComplex* A,
+                              const int             lda,
+                              hipblasDoubleComplex* tau,
+                              int*                  info)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL && m * n)
+        *info = -5;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgeqrf((rocblas_handle)handle,
+                                              m,
+                                              n,
+                                              (rocblas_double_complex*)A,
+                                              lda,
+                                              (rocblas_double_complex*)tau)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgeqrf_v2(hipblasHandle_t handle,
+                                 const int       m,
+                                 const int       n,
+                                 hipComplex*     A,
+                                 const int       lda,
+                                 hipComplex*     tau,
+                                 int*            info)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL && m * n)
+        *info = -5;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgeqrf((rocblas_handle)handle,
+                                              m,
+                                              n,
+                                              (rocblas_float_complex*)A,
+                                              lda,
+                                              (rocblas_float_complex*)tau)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgeqrf_v2(hipblasHandle_t   handle,
+                                 const int         m,
+                                 const int         n,
+                                 hipDoubleComplex* A,
+                                 const int         lda,
+                                 hipDoubleComplex* tau,
+                                 int*              info)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL && m * n)
+        *info = -5;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgeqrf((rocblas_handle)handle,
+                                              m,
+                                              n,
+                                              (rocblas_double_complex*)A,
+                                              lda,
+                                              (rocblas_double_complex*)tau)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// geqrf_batched
+hipblasStatus_t hipblasSgeqrfBatched(hipblasHandle_t handle,
+                                     const int       m,
+                                     const int       n,
+                                     float* const    A[],
+                                     const int       lda,
+                                     float* const    tau[],
+                                     int*            info,
+                                     const int       batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL && m * n)
+        *info = -5;
+    else if(batch_count < 0)
+        *info = -7;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(
+        rocsolver_sgeqrf_ptr_batched((rocblas_handle)handle, m, n, A, lda, tau, batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgeqrfBatched(hipblasHandle_t handle,
+                                     const int       m,
+                                     const int       n,
+                                     double* const   A[],
+                                     const int       lda,
+                                     double* const   tau[],
+                                     int*            info,
+                                     const int       batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL && m * n)
+        *info = -5;
+    else if(batch_count < 0)
+        *info = -7;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(
+        rocsolver_dgeqrf_ptr_batched((rocblas_handle)handle, m, n, A, lda, tau, batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgeqrfBatched(hipblasHandle_t       handle,
+                                     const int             m,
+                                     const int             n,
+                                     hipblasComplex* const A[],
+                                     const int             lda,
+                                     hipblasComplex* const tau[],
+                                     int*                  info,
+                                     const int             batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL && m * n)
+        *info = -5;
+    else if(batch_count < 0)
+        *info = -7;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgeqrf_ptr_batched((rocblas_handle)handle,
+                                                          m,
+                                                          n,
+                                                          (rocblas_float_complex**)A,
+                                                          lda,
+                                                          (rocblas_float_complex**)tau,
+                                                          batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgeqrfBatched(hipblasHandle_t             handle,
+                                     const int                   m,
+                                     const int                   n,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     hipblasDoubleComplex* const tau[],
+                                     int*                        info,
+                                     const int                   batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL && m * n)
+        *info = -5;
+    else if(batch_count < 0)
+        *info = -7;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgeqrf_ptr_batched((rocblas_handle)handle,
+                                                          m,
+                                                          n,
+                                                          (rocblas_double_complex**)A,
+                                                          lda,
+                                                          (rocblas_double_complex**)tau,
+                                                          batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgeqrfBatched_v2(hipblasHandle_t   handle,
+                                        const int         m,
+                                        const int         n,
+                                        hipComplex* const A[],
+                                        const int         lda,
+                                        hipComplex* const tau[],
+                                        int*              info,
+                                        const int         batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL && m * n)
+        *info = -5;
+    else if(batch_count < 0)
+        *info = -7;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgeqrf_ptr_batched((rocblas_handle)handle,
+                                                          m,
+                                                          n,
+                                                          (rocblas_float_complex**)A,
+                                                          lda,
+                                                          (rocblas_float_complex**)tau,
+                                                          batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgeqrfBatched_v2(hipblasHandle_t         handle,
+                                        const int               m,
+                                        const int               n,
+                                        hipDoubleComplex* const A[],
+                                        const int               lda,
+                                        hipDoubleComplex* const tau[],
+                                        int*                    info,
+                                        const int               batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL && m * n)
+        *info = -5;
+    else if(batch_count < 0)
+        *info = -7;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgeqrf_ptr_batched((rocblas_handle)handle,
+                                                          m,
+                                                          n,
+                                                          (rocblas_double_complex**)A,
+                                                          lda,
+                                                          (rocblas_double_complex**)tau,
+                                                          batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// geqrf_batched_strided_tau
+hipblasStatus_t hipblasSgeqrfBatchedStridedTau(hipblasHandle_t     handle,
+                                               const int           m,
+                                               const int           n,
+                                               float* const        A[],
+                                               const int           lda,
+                                               float*              tau,
+                                               const hipblasStride strideT,
+                                               int*                info,
+                                               const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, strideT, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL && m * n)
+        *info = -5;
+    else if(batch_count < 0)
+        *info = -8;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_sgeqrf_batched(
+        (rocblas_handle)handle, m, n, A, lda, tau, strideT, batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgeqrfBatchedStridedTau(hipblasHandle_t     handle,
+                                               const int           m,
+                                               const int           n,
+                                               double* const       A[],
+                                               const int           lda,
+                                               double*             tau,
+                                               const hipblasStride strideT,
+                                               int*                info,
+                                               const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, strideT, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL && m * n)
+        *info = -5;
+    else if(batch_count < 0)
+        *info = -8;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_dgeqrf_batched(
+        (rocblas_handle)handle, m, n, A, lda, tau, strideT, batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgeqrfBatchedStridedTau(hipblasHandle_t       handle,
+                                               const int             m,
+                                               const int             n,
+                                               hipblasComplex* const A[],
+                                               const int             lda,
+                                               hipblasComplex*       tau,
+                                               const hipblasStride   strideT,
+                                               int*                  info,
+                                               const int             batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, strideT, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL && m * n)
+        *info = -5;
+    else if(batch_count < 0)
+        *info = -8;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgeqrf_batched((rocblas_handle)handle,
+                                                      m,
+                                                      n,
+                                                      (rocblas_float_complex**)A,
+                                                      lda,
+                                                      (rocblas_float_complex*)tau,
+                                                      strideT,
+                                                      batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgeqrfBatchedStridedTau(hipblasHandle_t             handle,
+                                               const int                   m,
+                                               const int                   n,
+                                               hipblasDoubleComplex* const A[],
+                                               const int                   lda,
+                                               hipblasDoubleComplex*       tau,
+                                               const hipblasStride         strideT,
+                                               int*                        info,
+                                               const int                   batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, strideT, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL && m * n)
+        *info = -5;
+    else if(batch_count < 0)
+        *info = -8;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgeqrf_batched((rocblas_handle)handle,
+                                                      m,
+                                                      n,
+                                                      (rocblas_double_complex**)A,
+                                                      lda,
+                                                      (rocblas_double_complex*)tau,
+                                                      strideT,
+                                                      batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgeqrfBatchedStridedTau_v2(hipblasHandle_t     handle,
+                                                  const int           m,
+                                                  const int           n,
+                                                  hipComplex* const   A[],
+                                                  const int           lda,
+                                                  hipComplex*         tau,
+                                                  const hipblasStride strideT,
+                                                  int*                info,
+                                                  const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, strideT, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL && m * n)
+        *info = -5;
+    else if(batch_count < 0)
+        *info = -8;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgeqrf_batched((rocblas_handle)handle,
+                                                      m,
+                                                      n,
+                                                      (rocblas_float_complex**)A,
+                                                      lda,
+                                                      (rocblas_float_complex*)tau,
+                                                      strideT,
+                                                      batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgeqrfBatchedStridedTau_v2(hipblasHandle_t         handle,
+                                                  const int               m,
+                                                  const int               n,
+                                                  hipDoubleComplex* const A[],
+                                                  const int               lda,
+                                                  hipDoubleComplex*       tau,
+                                                  const hipblasStride     strideT,
+                                                  int*                    info,
+                                                  const int               batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, strideT, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL && m * n)
+        *info = -5;
+    else if(batch_count < 0)
+        *info = -8;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgeqrf_batched((rocblas_handle)handle,
+                                                      m,
+                                                      n,
+                                                      (rocblas_double_complex**)A,
+                                                      lda,
+                                                      (rocblas_double_complex*)tau,
+                                                      strideT,
+                                                      batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// geqrf_strided_batched
+hipblasStatus_t hipblasSgeqrfStridedBatched(hipblasHandle_t     handle,
+                                            const int           m,
+                                            const int           n,
+                                            float*              A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            float*              tau,
+                                            const hipblasStride strideT,
+                                            int*                info,
+                                            const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, strideA, strideT, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL && m * n)
+        *info = -6;
+    else if(batch_count < 0)
+        *info = -9;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_sgeqrf_strided_batched(
+        (rocblas_handle)handle, m, n, A, lda, strideA, tau, strideT, batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgeqrfStridedBatched(hipblasHandle_t     handle,
+                                            const int           m,
+                                            const int           n,
+                                            double*             A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            double*             tau,
+                                            const hipblasStride strideT,
+                                            int*                info,
+                                            const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, strideA, strideT, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL && m * n)
+        *info = -6;
+    else if(batch_count < 0)
+        *info = -9;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_dgeqrf_strided_batched(
+        (rocblas_handle)handle, m, n, A, lda, strideA, tau, strideT, batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgeqrfStridedBatched(hipblasHandle_t     handle,
+                                            const int           m,
+                                            const int           n,
+                                            hipblasComplex*     A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            hipblasComplex*     tau,
+                                            const hipblasStride strideT,
+                                            int*                info,
+                                            const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, strideA, strideT, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL && m * n)
+        *info = -6;
+    else if(batch_count < 0)
+        *info = -9;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgeqrf_strided_batched((rocblas_handle)handle,
+                                                              m,
+                                                              n,
+                                                              (rocblas_float_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              (rocblas_float_complex*)tau,
+                                                              strideT,
+                                                              batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgeqrfStridedBatched(hipblasHandle_t       handle,
+                                            const int             m,
+                                            const int             n,
+                                            hipblasDoubleComplex* A,
+                                            const int             lda,
+                                            const hipblasStride   strideA,
+                                            hipblasDoubleComplex* tau,
+                                            const hipblasStride   strideT,
+                                            int*                  info,
+                                            const int             batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, strideA, strideT, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL && m * n)
+        *info = -6;
+    else if(batch_count < 0)
+        *info = -9;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgeqrf_strided_batched((rocblas_handle)handle,
+                                                              m,
+                                                              n,
+                                                              (rocblas_double_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              (rocblas_double_complex*)tau,
+                                                              strideT,
+                                                              batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgeqrfStridedBatched_v2(hipblasHandle_t     handle,
+                                               const int           m,
+                                               const int           n,
+                                               hipComplex*         A,
+                                               const int           lda,
+                                               const hipblasStride strideA,
+                                               hipComplex*         tau,
+                                               const hipblasStride strideT,
+                                               int*                info,
+                                               const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, strideA, strideT, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL && m * n)
+        *info = -6;
+    else if(batch_count < 0)
+        *info = -9;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgeqrf_strided_batched((rocblas_handle)handle,
+                                                              m,
+                                                              n,
+                                                              (rocblas_float_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              (rocblas_float_complex*)tau,
+                                                              strideT,
+                                                              batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgeqrfStridedBatched_v2(hipblasHandle_t     handle,
+                                               const int           m,
+                                               const int           n,
+                                               hipDoubleComplex*   A,
+                                               const int           lda,
+                                               const hipblasStride strideA,
+                                               hipDoubleComplex*   tau,
+                                               const hipblasStride strideT,
+                                               int*                info,
+                                               const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, strideA, strideT, batch_count);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL && m * n)
+        *info = -6;
+    else if(batch_count < 0)
+        *info = -9;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgeqrf_strided_batched((rocblas_handle)handle,
+                                                              m,
+                                                              n,
+                                                              (rocblas_double_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              (rocblas_double_complex*)tau,
+                                                              strideT,
+                                                              batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// gels
+hipblasStatus_t hipblasSgels(hipblasHandle_t    handle,
+                             hipblasOperation_t trans,
+                             const int          m,
+                             const int          n,
+                             const int          nrhs,
+                             float*             A,
+                             const int          lda,
+                             float*             B,
+                             const int          ldb,
+                             int*               info,
+                             int*               deviceInfo)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T)
+        *info = -1;
+    else if(m < 0)
+        *info = -2;
+    else if(n < 0)
+        *info = -3;
+    else if(nrhs < 0)
+        *info = -4;
+    else if(A == NULL && m * n)
+        *info = -5;
+    else if(lda < m)
+        *info = -6;
+    else if(B == NULL && (m * nrhs || n * nrhs))
+        *info = -7;
+    else if(ldb < m || ldb < n)
+        *info = -8;
+    else if(deviceInfo == NULL)
+        *info = -10;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_sgels((rocblas_handle)handle,
+                                                                     hipblasConvertOperation(trans),
+                                                                     m,
+                                                                     n,
+                                                                     nrhs,
+                                                                     A,
+                                                                     lda,
+                                                                     B,
+                                                                     ldb,
+                                                                     deviceInfo)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgels(hipblasHandle_t    handle,
+                             hipblasOperation_t trans,
+                             const int          m,
+                             const int          n,
+                             const int          nrhs,
+                             double*            A,
+                             const int          lda,
+                             double*            B,
+                             const int          ldb,
+                             int*               info,
+                             int*               deviceInfo)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T)
+        *info = -1;
+    else if(m < 0)
+        *info = -2;
+    else if(n < 0)
+        *info = -3;
+    else if(nrhs < 0)
+        *info = -4;
+    else if(A == NULL && m * n)
+        *info = -5;
+    else if(lda < m)
+        *info = -6;
+    else if(B == NULL && (m * nrhs || n * nrhs))
+        *info = -7;
+    else if(ldb < m || ldb < n)
+        *info = -8;
+    else if(deviceInfo == NULL)
+        *info = -10;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_dgels((rocblas_handle)handle,
+                                                                     hipblasConvertOperation(trans),
+                                                                     m,
+                                                                     n,
+                                                                     nrhs,
+                                                                     A,
+                                                                     lda,
+                                                                     B,
+                                                                     ldb,
+                                                                     deviceInfo)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgels(hipblasHandle_t    handle,
+                             hipblasOperation_t trans,
+                             const int          m,
+                             const int          n,
+                             const int          nrhs,
+                             hipblasComplex*    A,
+                             const int          lda,
+                             hipblasComplex*    B,
+                             const int          ldb,
+                             int*               info,
+                             int*               deviceInfo)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(m < 0)
+        *info = -2;
+    else if(n < 0)
+        *info = -3;
+    else if(nrhs < 0)
+        *info = -4;
+    else if(A == NULL && m * n)
+        *info = -5;
+    else if(lda < m)
+        *info = -6;
+    else if(B == NULL && (m * nrhs || n * nrhs))
+        *info = -7;
+    else if(ldb < m || ldb < n)
+        *info = -8;
+    else if(deviceInfo == NULL)
+        *info = -10;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_cgels((rocblas_handle)handle,
+                                                                     hipblasConvertOperation(trans),
+                                                                     m,
+                                                                     n,
+                                                                     nrhs,
+                                                                     (rocblas_float_complex*)A,
+                                                                     lda,
+                                                                     (rocblas_float_complex*)B,
+                                                                     ldb,
+                                                                     deviceInfo)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgels(hipblasHandle_t       handle,
+                             hipblasOperation_t    trans,
+                             const int             m,
+                             const int             n,
+                             const int             nrhs,
+                             hipblasDoubleComplex* A,
+                             const int             lda,
+                             hipblasDoubleComplex* B,
+                             const int             ldb,
+                             int*                  info,
+                             int*                  deviceInfo)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(m < 0)
+        *info = -2;
+    else if(n < 0)
+        *info = -3;
+    else if(nrhs < 0)
+        *info = -4;
+    else if(A == NULL && m * n)
+        *info = -5;
+    else if(lda < m)
+        *info = -6;
+    else if(B == NULL && (m * nrhs || n * nrhs))
+        *info = -7;
+    else if(ldb < m || ldb < n)
+        *info = -8;
+    else if(deviceInfo == NULL)
+        *info = -10;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_zgels((rocblas_handle)handle,
+                                                                     hipblasConvertOperation(trans),
+                                                                     m,
+                                                                     n,
+                                                                     nrhs,
+                                                                     (rocblas_double_complex*)A,
+                                                                     lda,
+                                                                     (rocblas_double_complex*)B,
+                                                                     ldb,
+                                                                     deviceInfo)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgels_v2(hipblasHandle_t    handle,
+                                hipblasOperation_t trans,
+                                const int          m,
+                                const int          n,
+                                const int          nrhs,
+                                hipComplex*        A,
+                                const int          lda,
+                                hipComplex*        B,
+                                const int          ldb,
+                                int*               info,
+                                int*               deviceInfo)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(m < 0)
+        *info = -2;
+    else if(n < 0)
+        *info = -3;
+    else if(nrhs < 0)
+        *info = -4;
+    else if(A == NULL && m * n)
+        *info = -5;
+    else if(lda < m)
+        *info = -6;
+    else if(B == NULL && (m * nrhs || n * nrhs))
+        *info = -7;
+    else if(ldb < m || ldb < n)
+        *info = -8;
+    else if(deviceInfo == NULL)
+        *info = -10;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_cgels((rocblas_handle)handle,
+                                                                     hipblasConvertOperation(trans),
+                                                                     m,
+                                                                     n,
+                                                                     nrhs,
+                                                                     (rocblas_float_complex*)A,
+                                                                     lda,
+                                                                     (rocblas_float_complex*)B,
+                                                                     ldb,
+                                                                     deviceInfo)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgels_v2(hipblasHandle_t    handle,
+                                hipblasOperation_t trans,
+                                const int          m,
+                                const int          n,
+                                const int          nrhs,
+                                hipDoubleComplex*  A,
+                                const int          lda,
+                                hipDoubleComplex*  B,
+                                const int          ldb,
+                                int*               info,
+                                int*               deviceInfo)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(m < 0)
+        *info = -2;
+    else if(n < 0)
+        *info = -3;
+    else if(nrhs < 0)
+        *info = -4;
+    else if(A == NULL && m * n)
+        *info = -5;
+    else if(lda < m)
+        *info = -6;
+    else if(B == NULL && (m * nrhs || n * nrhs))
+        *info = -7;
+    else if(ldb < m || ldb < n)
+        *info = -8;
+    else if(deviceInfo == NULL)
+        *info = -10;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_zgels((rocblas_handle)handle,
+                                                                     hipblasConvertOperation(trans),
+                                                                     m,
+                                                                     n,
+                                                                     nrhs,
+                                                                     (rocblas_double_complex*)A,
+                                                                     lda,
+                                                                     (rocblas_double_complex*)B,
+                                                                     ldb,
+                                                                     deviceInfo)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// gelsBatched
+hipblasStatus_t hipblasSgelsBatched(hipblasHandle_t    handle,
+                                    hipblasOperation_t trans,
+                                    const int          m,
+                                    const int          n,
+                                    const int          nrhs,
+                                    float* const       A[],
+                                    const int          lda,
+                                    float* const       B[],
+                                    const int          ldb,
+                                    int*               info,
+                                    int*               deviceInfo,
+                                    const int          batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, ldb, batchCount);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T)
+        *info = -1;
+    else if(m < 0)
+        *info = -2;
+    else if(n < 0)
+        *info = -3;
+    else if(nrhs < 0)
+        *info = -4;
+    else if(A == NULL && m * n)
+        *info = -5;
+    else if(lda < m)
+        *info = -6;
+    else if(B == NULL && (m * nrhs || n * nrhs))
+        *info = -7;
+    else if(ldb < m || ldb < n)
+        *info = -8;
+    else if(deviceInfo == NULL && batchCount)
+        *info = -10;
+    else if(batchCount < 0)
+        *info = -11;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_sgels_batched((rocblas_handle)handle,
+                                                     hipblasConvertOperation(trans),
+                                                     m,
+                                                     n,
+                                                     nrhs,
+                                                     A,
+                                                     lda,
+                                                     B,
+                                                     ldb,
+                                                     deviceInfo,
+                                                     batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgelsBatched(hipblasHandle_t    handle,
+                                    hipblasOperation_t trans,
+                                    const int          m,
+                                    const int          n,
+                                    const int          nrhs,
+                                    double* const      A[],
+                                    const int          lda,
+                                    double* const      B[],
+                                    const int          ldb,
+                                    int*               info,
+                                    int*               deviceInfo,
+                                    const int          batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, ldb, batchCount);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T)
+        *info = -1;
+    else if(m < 0)
+        *info = -2;
+    else if(n < 0)
+        *info = -3;
+    else if(nrhs < 0)
+        *info = -4;
+    else if(A == NULL && m * n)
+        *info = -5;
+    else if(lda < m)
+        *info = -6;
+    else if(B == NULL && (m * nrhs || n * nrhs))
+        *info = -7;
+    else if(ldb < m || ldb < n)
+        *info = -8;
+    else if(deviceInfo == NULL && batchCount)
+        *info = -10;
+    else if(batchCount < 0)
+        *info = -11;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_dgels_batched((rocblas_handle)handle,
+                                                     hipblasConvertOperation(trans),
+                                                     m,
+                                                     n,
+                                                     nrhs,
+                                                     A,
+                                                     lda,
+                                                     B,
+                                                     ldb,
+                                                     deviceInfo,
+                                                     batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgelsBatched(hipblasHandle_t       handle,
+                                    hipblasOperation_t    trans,
+                                    const int             m,
+                                    const int             n,
+                                    const int             nrhs,
+                                    hipblasComplex* const A[],
+                                    const int             lda,
+                                    hipblasComplex* const B[],
+                                    const int             ldb,
+                                    int*                  info,
+                                    int*                  deviceInfo,
+                                    const int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, ldb, batchCount);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(m < 0)
+        *info = -2;
+    else if(n < 0)
+        *info = -3;
+    else if(nrhs < 0)
+        *info = -4;
+    else if(A == NULL && m * n)
+        *info = -5;
+    else if(lda < m)
+        *info = -6;
+    else if(B == NULL && (m * nrhs || n * nrhs))
+        *info = -7;
+    else if(ldb < m || ldb < n)
+        *info = -8;
+    else if(deviceInfo == NULL && batchCount)
+        *info = -10;
+    else if(batchCount < 0)
+        *info = -11;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgels_batched((rocblas_handle)handle,
+                                                     hipblasConvertOperation(trans),
+                                                     m,
+                                                     n,
+                                                     nrhs,
+                                                     (rocblas_float_complex**)A,
+                                                     lda,
+                                                     (rocblas_float_complex**)B,
+                                                     ldb,
+                                                     deviceInfo,
+                                                     batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgelsBatched(hipblasHandle_t             handle,
+                                    hipblasOperation_t          trans,
+                                    const int                   m,
+                                    const int                   n,
+                                    const int                   nrhs,
+                                    hipblasDoubleComplex* const A[],
+                                    const int                   lda,
+                                    hipblasDoubleComplex* const B[],
+                                    const int                   ldb,
+                                    int*                        info,
+                                    int*                        deviceInfo,
+                                    const int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, ldb, batchCount);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(m < 0)
+        *info = -2;
+    else if(n < 0)
+        *info = -3;
+    else if(nrhs < 0)
+        *info = -4;
+    else if(A == NULL && m * n)
+        *info = -5;
+    else if(lda < m)
+        *info = -6;
+    else if(B == NULL && (m * nrhs || n * nrhs))
+        *info = -7;
+    else if(ldb < m || ldb < n)
+        *info = -8;
+    else if(deviceInfo == NULL && batchCount)
+        *info = -10;
+    else if(batchCount < 0)
+        *info = -11;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgels_batched((rocblas_handle)handle,
+                                                     hipblasConvertOperation(trans),
+                                                     m,
+                                                     n,
+                                                     nrhs,
+                                                     (rocblas_double_complex**)A,
+                                                     lda,
+                                                     (rocblas_double_complex**)B,
+                                                     ldb,
+                                                     deviceInfo,
+                                                     batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgelsBatched_v2(hipblasHandle_t    handle,
+                                       hipblasOperation_t trans,
+                                       const int          m,
+                                       const int          n,
+                                       const int          nrhs,
+                                       hipComplex* const  A[],
+                                       const int          lda,
+                                       hipComplex* const  B[],
+                                       const int          ldb,
+                                       int*               info,
+                                       int*               deviceInfo,
+                                       const int          batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, ldb, batchCount);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(m < 0)
+        *info = -2;
+    else if(n < 0)
+        *info = -3;
+    else if(nrhs < 0)
+        *info = -4;
+    else if(A == NULL && m * n)
+        *info = -5;
+    else if(lda < m)
+        *info = -6;
+    else if(B == NULL && (m * nrhs || n * nrhs))
+        *info = -7;
+    else if(ldb < m || ldb < n)
+        *info = -8;
+    else if(deviceInfo == NULL && batchCount)
+        *info = -10;
+    else if(batchCount < 0)
+        *info = -11;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgels_batched((rocblas_handle)handle,
+                                                     hipblasConvertOperation(trans),
+                                                     m,
+                                                     n,
+                                                     nrhs,
+                                                     (rocblas_float_complex**)A,
+                                                     lda,
+                                                     (rocblas_float_complex**)B,
+                                                     ldb,
+                                                     deviceInfo,
+                                                     batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgelsBatched_v2(hipblasHandle_t         handle,
+                                       hipblasOperation_t      trans,
+                                       const int               m,
+                                       const int               n,
+                                       const int               nrhs,
+                                       hipDoubleComplex* const A[],
+                                       const int               lda,
+                                       hipDoubleComplex* const B[],
+                                       const int               ldb,
+                                       int*                    info,
+                                       int*                    deviceInfo,
+                                       const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, ldb, batchCount);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(m < 0)
+        *info = -2;
+    else if(n < 0)
+        *info = -3;
+    else if(nrhs < 0)
+        *info = -4;
+    else if(A == NULL && m * n)
+        *info = -5;
+    else if(lda < m)
+        *info = -6;
+    else if(B == NULL && (m * nrhs || n * nrhs))
+        *info = -7;
+    else if(ldb < m || ldb < n)
+        *info = -8;
+    else if(deviceInfo == NULL && batchCount)
+        *info = -10;
+    else if(batchCount < 0)
+        *info = -11;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgels_batched((rocblas_handle)handle,
+                                                     hipblasConvertOperation(trans),
+                                                     m,
+                                                     n,
+                                                     nrhs,
+                                                     (rocblas_double_complex**)A,
+                                                     lda,
+                                                     (rocblas_double_complex**)B,
+                                                     ldb,
+                                                     deviceInfo,
+                                                     batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// gelsStridedBatched
+hipblasStatus_t hipblasSgelsStridedBatched(hipblasHandle_t     handle,
+                                           hipblasOperation_t  trans,
+                                           const int           m,
+                                           const int           n,
+                                           const int           nrhs,
+                                           float*              A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           float*              B,
+                                           const int           ldb,
+                                           const hipblasStride strideB,
+                                           int*                info,
+                                           int*                deviceInfo,
+                                           const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, strideA, ldb, strideB, batchCount);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T)
+        *info = -1;
+    else if(m < 0)
+        *info = -2;
+    else if(n < 0)
+        *info = -3;
+    else if(nrhs < 0)
+        *info = -4;
+    else if(A == NULL && m * n)
+        *info = -5;
+    else if(lda < m)
+        *info = -6;
+    else if(B == NULL && (m * nrhs || n * nrhs))
+        *info = -8;
+    else if(ldb < m || ldb < n)
+        *info = -9;
+    else if(deviceInfo == NULL && batchCount)
+        *info = -12;
+    else if(batchCount < 0)
+        *info = -13;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_sgels_strided_batched((rocblas_handle)handle,
+                                                             hipblasConvertOperation(trans),
+                                                             m,
+                                                             n,
+                                                             nrhs,
+                                                             A,
+                                                             lda,
+                                                             strideA,
+                                                             B,
+                                                             ldb,
+                                                             strideB,
+                                                             deviceInfo,
+                                                             batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgelsStridedBatched(hipblasHandle_t     handle,
+                                           hipblasOperation_t  trans,
+                                           const int           m,
+                                           const int           n,
+                                           const int           nrhs,
+                                           double*             A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           double*             B,
+                                           const int           ldb,
+                                           const hipblasStride strideB,
+                                           int*                info,
+                                           int*                deviceInfo,
+                                           const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, strideA, ldb, strideB, batchCount);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T)
+        *info = -1;
+    else if(m < 0)
+        *info = -2;
+    else if(n < 0)
+        *info = -3;
+    else if(nrhs < 0)
+        *info = -4;
+    else if(A == NULL && m * n)
+        *info = -5;
+    else if(lda < m)
+        *info = -6;
+    else if(B == NULL && (m * nrhs || n * nrhs))
+        *info = -8;
+    else if(ldb < m || ldb < n)
+        *info = -9;
+    else if(deviceInfo == NULL && batchCount)
+        *info = -12;
+    else if(batchCount < 0)
+        *info = -13;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_dgels_strided_batched((rocblas_handle)handle,
+                                                             hipblasConvertOperation(trans),
+                                                             m,
+                                                             n,
+                                                             nrhs,
+                                                             A,
+                                                             lda,
+                                                             strideA,
+                                                             B,
+                                                             ldb,
+                                                             strideB,
+                                                             deviceInfo,
+                                                             batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgelsStridedBatched(hipblasHandle_t     handle,
+                                           hipblasOperation_t  trans,
+                                           const int           m,
+                                           const int           n,
+                                           const int           nrhs,
+                                           hipblasComplex*     A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           hipblasComplex*     B,
+                                           const int           ldb,
+                                           const hipblasStride strideB,
+                                           int*                info,
+                                           int*                deviceInfo,
+                                           const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, strideA, ldb, strideB, batchCount);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(m < 0)
+        *info = -2;
+    else if(n < 0)
+        *info = -3;
+    else if(nrhs < 0)
+        *info = -4;
+    else if(A == NULL && m * n)
+        *info = -5;
+    else if(lda < m)
+        *info = -6;
+    else if(B == NULL && (m * nrhs || n * nrhs))
+        *info = -8;
+    else if(ldb < m || ldb < n)
+        *info = -9;
+    else if(deviceInfo == NULL && batchCount)
+        *info = -12;
+    else if(batchCount < 0)
+        *info = -13;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgels_strided_batched((rocblas_handle)handle,
+                                                             hipblasConvertOperation(trans),
+                                                             m,
+                                                             n,
+                                                             nrhs,
+                                                             (rocblas_float_complex*)A,
+                                                             lda,
+                                                             strideA,
+                                                             (rocblas_float_complex*)B,
+                                                             ldb,
+                                                             strideB,
+                                                             deviceInfo,
+                                                             batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgelsStridedBatched(hipblasHandle_t       handle,
+                                           hipblasOperation_t    trans,
+                                           const int             m,
+                                           const int             n,
+                                           const int             nrhs,
+                                           hipblasDoubleComplex* A,
+                                           const int             lda,
+                                           const hipblasStride   strideA,
+                                           hipblasDoubleComplex* B,
+                                           const int             ldb,
+                                           const hipblasStride   strideB,
+                                           int*                  info,
+                                           int*                  deviceInfo,
+                                           const int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, strideA, ldb, strideB, batchCount);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(m < 0)
+        *info = -2;
+    else if(n < 0)
+        *info = -3;
+    else if(nrhs < 0)
+        *info = -4;
+    else if(A == NULL && m * n)
+        *info = -5;
+    else if(lda < m)
+        *info = -6;
+    else if(B == NULL && (m * nrhs || n * nrhs))
+        *info = -8;
+    else if(ldb < m || ldb < n)
+        *info = -9;
+    else if(deviceInfo == NULL && batchCount)
+        *info = -12;
+    else if(batchCount < 0)
+        *info = -13;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgels_strided_batched((rocblas_handle)handle,
+                                                             hipblasConvertOperation(trans),
+                                                             m,
+                                                             n,
+                                                             nrhs,
+                                                             (rocblas_double_complex*)A,
+                                                             lda,
+                                                             strideA,
+                                                             (rocblas_double_complex*)B,
+                                                             ldb,
+                                                             strideB,
+                                                             deviceInfo,
+                                                             batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgelsStridedBatched_v2(hipblasHandle_t     handle,
+                                              hipblasOperation_t  trans,
+                                              const int           m,
+                                              const int           n,
+                                              const int           nrhs,
+                                              hipComplex*         A,
+                                              const int           lda,
+                                              const hipblasStride strideA,
+                                              hipComplex*         B,
+                                              const int           ldb,
+                                              const hipblasStride strideB,
+                                              int*                info,
+                                              int*                deviceInfo,
+                                              const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, strideA, ldb, strideB, batchCount);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(m < 0)
+        *info = -2;
+    else if(n < 0)
+        *info = -3;
+    else if(nrhs < 0)
+        *info = -4;
+    else if(A == NULL && m * n)
+        *info = -5;
+    else if(lda < m)
+        *info = -6;
+    else if(B == NULL && (m * nrhs || n * nrhs))
+        *info = -8;
+    else if(ldb < m || ldb < n)
+        *info = -9;
+    else if(deviceInfo == NULL && batchCount)
+        *info = -12;
+    else if(batchCount < 0)
+        *info = -13;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgels_strided_batched((rocblas_handle)handle,
+                                                             hipblasConvertOperation(trans),
+                                                             m,
+                                                             n,
+                                                             nrhs,
+                                                             (rocblas_float_complex*)A,
+                                                             lda,
+                                                             strideA,
+                                                             (rocblas_float_complex*)B,
+                                                             ldb,
+                                                             strideB,
+                                                             deviceInfo,
+                                                             batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgelsStridedBatched_v2(hipblasHandle_t     handle,
+                                              hipblasOperation_t  trans,
+                                              const int           m,
+                                              const int           n,
+                                              const int           nrhs,
+                                              hipDoubleComplex*   A,
+                                              const int           lda,
+                                              const hipblasStride strideA,
+                                              hipDoubleComplex*   B,
+                                              const int           ldb,
+                                              const hipblasStride strideB,
+                                              int*                info,
+                                              int*                deviceInfo,
+                                              const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, strideA, ldb, strideB, batchCount);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(m < 0)
+        *info = -2;
+    else if(n < 0)
+        *info = -3;
+    else if(nrhs < 0)
+        *info = -4;
+    else if(A == NULL && m * n)
+        *info = -5;
+    else if(lda < m)
+        *info = -6;
+    else if(B == NULL && (m * nrhs || n * nrhs))
+        *info = -8;
+    else if(ldb < m || ldb < n)
+        *info = -9;
+    else if(deviceInfo == NULL && batchCount)
+        *info = -12;
+    else if(batchCount < 0)
+        *info = -13;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgels_strided_batched((rocblas_handle)handle,
+                                                             hipblasConvertOperation(trans),
+                                                             m,
+                                                             n,
+                                                             nrhs,
+                                                             (rocblas_double_complex*)A,
+                                                             lda,
+                                                             strideA,
+                                                             (rocblas_double_complex*)B,
+                                                             ldb,
+                                                             strideB,
+                                                             deviceInfo,
+                                                             batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potrf
+hipblasStatus_t hipblasSpotrf(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              float*                  A,
+                              const int               lda,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_spotrf(
+        (rocblas_handle)handle, hipblasConvertFill(uplo), n, A, lda, info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotrf(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              double*                 A,
+                              const int               lda,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_dpotrf(
+        (rocblas_handle)handle, hipblasConvertFill(uplo), n, A, lda, info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrf(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              hipblasComplex*         A,
+                              const int               lda,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cpotrf((rocblas_handle)handle,
+                                              hipblasConvertFill(uplo),
+                                              n,
+                                              (rocblas_float_complex*)A,
+                                              lda,
+                                              info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrf(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              hipblasDoubleComplex*   A,
+                              const int               lda,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zpotrf((rocblas_handle)handle,
+                                              hipblasConvertFill(uplo),
+                                              n,
+                                              (rocblas_double_complex*)A,
+                                              lda,
+                                              info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrf_v2(hipblasHandle_t         handle,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 hipComplex*             A,
+                                 const int               lda,
+                                 int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cpotrf((rocblas_handle)handle,
+                                              hipblasConvertFill(uplo),
+                                              n,
+                                              (rocblas_float_complex*)A,
+                                              lda,
+                                              info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrf_v2(hipblasHandle_t         handle,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 hipDoubleComplex*       A,
+                                 const int               lda,
+                                 int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zpotrf((rocblas_handle)handle,
+                                              hipblasConvertFill(uplo),
+                                              n,
+                                              (rocblas_double_complex*)A,
+                                              lda,
+                                              info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potrf_batched
+hipblasStatus_t hipblasSpotrfBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     float* const            A[],
+                                     const int               lda,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_spotrf_batched(
+        (rocblas_handle)handle, hipblasConvertFill(uplo), n, A, lda, info, batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotrfBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     double* const           A[],
+                                     const int               lda,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_dpotrf_batched(
+        (rocblas_handle)handle, hipblasConvertFill(uplo), n, A, lda, info, batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrfBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasComplex* const   A[],
+                                     const int               lda,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cpotrf_batched((rocblas_handle)handle,
+                                                      hipblasConvertFill(uplo),
+                                                      n,
+                                                      (rocblas_float_complex**)A,
+                                                      lda,
+                                                      info,
+                                                      batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrfBatched(hipblasHandle_t             handle,
+                                     const hipblasFillMode_t     uplo,
+                                     const int                   n,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     int*                        info,
+                                     const int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zpotrf_batched((rocblas_handle)handle,
+                                                      hipblasConvertFill(uplo),
+                                                      n,
+                                                      (rocblas_double_complex**)A,
+                                                      lda,
+                                                      info,
+                                                      batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrfBatched_v2(hipblasHandle_t         handle,
+                                        const hipblasFillMode_t uplo,
+                                        const int               n,
+                                        hipComplex* const       A[],
+                                        const int               lda,
+                                        int*                    info,
+                                        const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cpotrf_batched((rocblas_handle)handle,
+                                                      hipblasConvertFill(uplo),
+                                                      n,
+                                                      (rocblas_float_complex**)A,
+                                                      lda,
+                                                      info,
+                                                      batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrfBatched_v2(hipblasHandle_t         handle,
+                                        const hipblasFillMode_t uplo,
+                                        const int               n,
+                                        hipDoubleComplex* const A[],
+                                        const int               lda,
+                                        int*                    info,
+                                        const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zpotrf_batched((rocblas_handle)handle,
+                                                      hipblasConvertFill(uplo),
+                                                      n,
+                                                      (rocblas_double_complex**)A,
+                                                      lda,
+                                                      info,
+                                                      batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potrf_strided_batched
+hipblasStatus_t hipblasSpotrfStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            float*                  A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_spotrf_strided_batched(
+        (rocblas_handle)handle, hipblasConvertFill(uplo), n, A, lda, strideA, info, batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotrfStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            double*                 A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_dpotrf_strided_batched(
+        (rocblas_handle)handle, hipblasConvertFill(uplo), n, A, lda, strideA, info, batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrfStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasComplex*         A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cpotrf_strided_batched((rocblas_handle)handle,
+                                                              hipblasConvertFill(uplo),
+                                                              n,
+                                                              (rocblas_float_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              info,
+                                                              batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrfStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasDoubleComplex*   A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zpotrf_strided_batched((rocblas_handle)handle,
+                                                              hipblasConvertFill(uplo),
+                                                              n,
+                                                              (rocblas_double_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              info,
+                                                              batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrfStridedBatched_v2(hipblasHandle_t         handle,
+                                               const hipblasFillMode_t uplo,
+                                               const int               n,
+                                               hipComplex*             A,
+                                               const int               lda,
+                                               const hipblasStride     strideA,
+                                               int*                    info,
+                                               const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cpotrf_strided_batched((rocblas_handle)handle,
+                                                              hipblasConvertFill(uplo),
+                                                              n,
+                                                              (rocblas_float_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              info,
+                                                              batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrfStridedBatched_v2(hipblasHandle_t         handle,
+                                               const hipblasFillMode_t uplo,
+                                               const int               n,
+                                               hipDoubleComplex*       A,
+                                               const int               lda,
+                                               const hipblasStride     strideA,
+                                               int*                    info,
+                                               const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zpotrf_strided_batched((rocblas_handle)handle,
+                                                              hipblasConvertFill(uplo),
+                                                              n,
+                                                              (rocblas_double_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              info,
+                                                              batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potrs
+hipblasStatus_t hipblasSpotrs(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              const int               nrhs,
+                              float*                  A,
+                              const int               lda,
+                              float*                  B,
+                              const int               ldb,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(B == NULL && n * nrhs)
+        *info = -6;
+    else if(ldb < std::max(1, n))
+        *info = -7;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_spotrs(
+        (rocblas_handle)handle, hipblasConvertFill(uplo), n, nrhs, A, lda, B, ldb)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotrs(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              const int               nrhs,
+                              double*                 A,
+                              const int               lda,
+                              double*                 B,
+                              const int               ldb,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(B == NULL && n * nrhs)
+        *info = -6;
+    else if(ldb < std::max(1, n))
+        *info = -7;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_dpotrs(
+        (rocblas_handle)handle, hipblasConvertFill(uplo), n, nrhs, A, lda, B, ldb)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrs(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              const int               nrhs,
+                              hipblasComplex*         A,
+                              const int               lda,
+                              hipblasComplex*         B,
+                              const int               ldb,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(B == NULL && n * nrhs)
+        *info = -6;
+    else if(ldb < std::max(1, n))
+        *info = -7;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cpotrs((rocblas_handle)handle,
+                                              hipblasConvertFill(uplo),
+                                              n,
+                                              nrhs,
+                                              (rocblas_float_complex*)A,
+                                              lda,
+                                              (rocblas_float_complex*)B,
+                                              ldb)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrs(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              const int               nrhs,
+                              hipblasDoubleComplex*   A,
+                              const int               lda,
+                              hipblasDoubleComplex*   B,
+                              const int               ldb,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(B == NULL && n * nrhs)
+        *info = -6;
+    else if(ldb < std::max(1, n))
+        *info = -7;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zpotrs((rocblas_handle)handle,
+                                              hipblasConvertFill(uplo),
+                                              n,
+                                              nrhs,
+                                              (rocblas_double_complex*)A,
+                                              lda,
+                                              (rocblas_double_complex*)B,
+                                              ldb)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrs_v2(hipblasHandle_t         handle,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 const int               nrhs,
+                                 hipComplex*             A,
+                                 const int               lda,
+                                 hipComplex*             B,
+                                 const int               ldb,
+                                 int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(B == NULL && n * nrhs)
+        *info = -6;
+    else if(ldb < std::max(1, n))
+        *info = -7;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cpotrs((rocblas_handle)handle,
+                                              hipblasConvertFill(uplo),
+                                              n,
+                                              nrhs,
+                                              (rocblas_float_complex*)A,
+                                              lda,
+                                              (rocblas_float_complex*)B,
+                                              ldb)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrs_v2(hipblasHandle_t         handle,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 const int               nrhs,
+                                 hipDoubleComplex*       A,
+                                 const int               lda,
+                                 hipDoubleComplex*       B,
+                                 const int               ldb,
+                                 int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(B == NULL && n * nrhs)
+        *info = -6;
+    else if(ldb < std::max(1, n))
+        *info = -7;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zpotrs((rocblas_handle)handle,
+                                              hipblasConvertFill(uplo),
+                                              n,
+                                              nrhs,
+                                              (rocblas_double_complex*)A,
+                                              lda,
+                                              (rocblas_double_complex*)B,
+                                              ldb)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potrs_batched
+hipblasStatus_t hipblasSpotrsBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     float* const            A[],
+                                     const int               lda,
+                                     float* const            B[],
+                                     const int               ldb,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, ldb, batchCount);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(B == NULL && n * nrhs)
+        *info = -6;
+    else if(ldb < std::max(1, n))
+        *info = -7;
+    else if(batchCount < 0)
+        *info = -9;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_spotrs_batched(
+        (rocblas_handle)handle, hipblasConvertFill(uplo), n, nrhs, A, lda, B, ldb, batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotrsBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     double* const           A[],
+                                     const int               lda,
+                                     double* const           B[],
+                                     const int               ldb,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, ldb, batchCount);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(B == NULL && n * nrhs)
+        *info = -6;
+    else if(ldb < std::max(1, n))
+        *info = -7;
+    else if(batchCount < 0)
+        *info = -9;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_dpotrs_batched(
+        (rocblas_handle)handle, hipblasConvertFill(uplo), n, nrhs, A, lda, B, ldb, batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrsBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     hipblasComplex* const   A[],
+                                     const int               lda,
+                                     hipblasComplex* const   B[],
+                                     const int               ldb,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, ldb, batchCount);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(B == NULL && n * nrhs)
+        *info = -6;
+    else if(ldb < std::max(1, n))
+        *info = -7;
+    else if(batchCount < 0)
+        *info = -9;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cpotrs_batched((rocblas_handle)handle,
+                                                      hipblasConvertFill(uplo),
+                                                      n,
+                                                      nrhs,
+                                                      (rocblas_float_complex**)A,
+                                                      lda,
+                                                      (rocblas_float_complex**)B,
+                                                      ldb,
+                                                      batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrsBatched(hipblasHandle_t             handle,
+                                     const hipblasFillMode_t     uplo,
+                                     const int                   n,
+                                     const int                   nrhs,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     hipblasDoubleComplex* const B[],
+                                     const int                   ldb,
+                                     int*                        info,
+                                     const int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, ldb, batchCount);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(B == NULL && n * nrhs)
+        *info = -6;
+    else if(ldb < std::max(1, n))
+        *info = -7;
+    else if(batchCount < 0)
+        *info = -9;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zpotrs_batched((rocblas_handle)handle,
+                                                      hipblasConvertFill(uplo),
+                                                      n,
+                                                      nrhs,
+                                                      (rocblas_double_complex**)A,
+                                                      lda,
+                                                      (rocblas_double_complex**)B,
+                                                      ldb,
+                                                      batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrsBatched_v2(hipblasHandle_t         handle,
+                                        const hipblasFillMode_t uplo,
+                                        const int               n,
+                                        const int               nrhs,
+                                        hipComplex* const       A[],
+                                        const int               lda,
+                                        hipComplex* const       B[],
+                                        const int               ldb,
+                                        int*                    info,
+                                        const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, ldb, batchCount);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(B == NULL && n * nrhs)
+        *info = -6;
+    else if(ldb < std::max(1, n))
+        *info = -7;
+    else if(batchCount < 0)
+        *info = -9;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cpotrs_batched((rocblas_handle)handle,
+                                                      hipblasConvertFill(uplo),
+                                                      n,
+                                                      nrhs,
+                                                      (rocblas_float_complex**)A,
+                                                      lda,
+                                                      (rocblas_float_complex**)B,
+                                                      ldb,
+                                                      batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrsBatched_v2(hipblasHandle_t         handle,
+                                        const hipblasFillMode_t uplo,
+                                        const int               n,
+                                        const int               nrhs,
+                                        hipDoubleComplex* const A[],
+                                        const int               lda,
+                                        hipDoubleComplex* const B[],
+                                        const int               ldb,
+                                        int*                    info,
+                                        const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, ldb, batchCount);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(B == NULL && n * nrhs)
+        *info = -6;
+    else if(ldb < std::max(1, n))
+        *info = -7;
+    else if(batchCount < 0)
+        *info = -9;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zpotrs_batched((rocblas_handle)handle,
+                                                      hipblasConvertFill(uplo),
+                                                      n,
+                                                      nrhs,
+                                                      (rocblas_double_complex**)A,
+                                                      lda,
+                                                      (rocblas_double_complex**)B,
+                                                      ldb,
+                                                      batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potrs_strided_batched
+hipblasStatus_t hipblasSpotrsStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            float*                  A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            float*                  B,
+                                            const int               ldb,
+                                            const hipblasStride     strideB,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, strideA, ldb, strideB, batchCount);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(B == NULL && n * nrhs)
+        *info = -7;
+    else if(ldb < std::max(1, n))
+        *info = -8;
+    else if(batchCount < 0)
+        *info = -11;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_spotrs_strided_batched((rocblas_handle)handle,
+                                                              hipblasConvertFill(uplo),
+                                                              n,
+                                                              nrhs,
+                                                              A,
+                                                              lda,
+                                                              strideA,
+                                                              B,
+                                                              ldb,
+                                                              strideB,
+                                                              batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotrsStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            double*                 A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            double*                 B,
+                                            const int               ldb,
+                                            const hipblasStride     strideB,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, strideA, ldb, strideB, batchCount);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(B == NULL && n * nrhs)
+        *info = -7;
+    else if(ldb < std::max(1, n))
+        *info = -8;
+    else if(batchCount < 0)
+        *info = -11;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_dpotrs_strided_batched((rocblas_handle)handle,
+                                                              hipblasConvertFill(uplo),
+                                                              n,
+                                                              nrhs,
+                                                              A,
+                                                              lda,
+                                                              strideA,
+                                                              B,
+                                                              ldb,
+                                                              strideB,
+                                                              batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrsStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            hipblasComplex*         A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            hipblasComplex*         B,
+                                            const int               ldb,
+                                            const hipblasStride     strideB,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, strideA, ldb, strideB, batchCount);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(B == NULL && n * nrhs)
+        *info = -7;
+    else if(ldb < std::max(1, n))
+        *info = -8;
+    else if(batchCount < 0)
+        *info = -11;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cpotrs_strided_batched((rocblas_handle)handle,
+                                                              hipblasConvertFill(uplo),
+                                                              n,
+                                                              nrhs,
+                                                              (rocblas_float_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              (rocblas_float_complex*)B,
+                                                              ldb,
+                                                              strideB,
+                                                              batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrsStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            hipblasDoubleComplex*   A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            hipblasDoubleComplex*   B,
+                                            const int               ldb,
+                                            const hipblasStride     strideB,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, strideA, ldb, strideB, batchCount);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(B == NULL && n * nrhs)
+        *info = -7;
+    else if(ldb < std::max(1, n))
+        *info = -8;
+    else if(batchCount < 0)
+        *info = -11;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zpotrs_strided_batched((rocblas_handle)handle,
+                                                              hipblasConvertFill(uplo),
+                                                              n,
+                                                              nrhs,
+                                                              (rocblas_double_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              (rocblas_double_complex*)B,
+                                                              ldb,
+                                                              strideB,
+                                                              batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrsStridedBatched_v2(hipblasHandle_t         handle,
+                                               const hipblasFillMode_t uplo,
+                                               const int               n,
+                                               const int               nrhs,
+                                               hipComplex*             A,
+                                               const int               lda,
+                                               const hipblasStride     strideA,
+                                               hipComplex*             B,
+                                               const int               ldb,
+                                               const hipblasStride     strideB,
+                                               int*                    info,
+                                               const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, strideA, ldb, strideB, batchCount);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(B == NULL && n * nrhs)
+        *info = -7;
+    else if(ldb < std::max(1, n))
+        *info = -8;
+    else if(batchCount < 0)
+        *info = -11;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cpotrs_strided_batched((rocblas_handle)handle,
+                                                              hipblasConvertFill(uplo),
+                                                              n,
+                                                              nrhs,
+                                                              (rocblas_float_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              (rocblas_float_complex*)B,
+                                                              ldb,
+                                                              strideB,
+                                                              batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrsStridedBatched_v2(hipblasHandle_t         handle,
+                                               const hipblasFillMode_t uplo,
+                                               const int               n,
+                                               const int               nrhs,
+                                               hipDoubleComplex*       A,
+                                               const int               lda,
+                                               const hipblasStride     strideA,
+                                               hipDoubleComplex*       B,
+                                               const int               ldb,
+                                               const hipblasStride     strideB,
+                                               int*                    info,
+                                               const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, strideA, ldb, strideB, batchCount);
+
+    hipblasSolverInfo solver_info((rocblas_handle)handle, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(B == NULL && n * nrhs)
+        *info = -7;
+    else if(ldb < std::max(1, n))
+        *info = -8;
+    else if(batchCount < 0)
+        *info = -11;
+    else
+        *info = 0;
+
+    hipblasStatus_t info_status = solver_info.store();
+    if(info_status != HIPBLAS_STATUS_SUCCESS)
+        return info_status;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zpotrs_strided_batched((rocblas_handle)handle,
+                                                              hipblasConvertFill(uplo),
+                                                              n,
+                                                              nrhs,
+                                                              (rocblas_double_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              (rocblas_double_complex*)B,
+                                                              ldb,
+                                                              strideB,
+                                                              batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potri
+hipblasStatus_t hipblasSpotri(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              float*                  A,
+                              const int               lda,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_spotri(
+        (rocblas_handle)handle, hipblasConvertFill(uplo), n, A, lda, info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotri(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              double*                 A,
+                              const int               lda,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_dpotri(
+        (rocblas_handle)handle, hipblasConvertFill(uplo), n, A, lda, info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotri(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              hipblasComplex*         A,
+                              const int               lda,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cpotri((rocblas_handle)handle,
+                                              hipblasConvertFill(uplo),
+                                              n,
+                                              (rocblas_float_complex*)A,
+                                              lda,
+                                              info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotri(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              hipblasDoubleComplex*   A,
+                              const int               lda,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zpotri((rocblas_handle)handle,
+                                              hipblasConvertFill(uplo),
+                                              n,
+                                              (rocblas_double_complex*)A,
+                                              lda,
+                                              info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotri_v2(hipblasHandle_t         handle,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 hipComplex*             A,
+                                 const int               lda,
+                                 int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cpotri((rocblas_handle)handle,
+                                              hipblasConvertFill(uplo),
+                                              n,
+                                              (rocblas_float_complex*)A,
+                                              lda,
+                                              info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotri_v2(hipblasHandle_t         handle,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 hipDoubleComplex*       A,
+                                 const int               lda,
+                                 int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zpotri((rocblas_handle)handle,
+                                              hipblasConvertFill(uplo),
+                                              n,
+                                              (rocblas_double_complex*)A,
+                                              lda,
+                                              info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potri_batched
+hipblasStatus_t hipblasSpotriBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     float* const            A[],
+                                     const int               lda,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_spotri_batched(
+        (rocblas_handle)handle, hipblasConvertFill(uplo), n, A, lda, info, batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotriBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     double* const           A[],
+                                     const int               lda,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_dpotri_batched(
+        (rocblas_handle)handle, hipblasConvertFill(uplo), n, A, lda, info, batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotriBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasComplex* const   A[],
+                                     const int               lda,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cpotri_batched((rocblas_handle)handle,
+                                                      hipblasConvertFill(uplo),
+                                                      n,
+                                                      (rocblas_float_complex**)A,
+                                                      lda,
+                                                      info,
+                                                      batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotriBatched(hipblasHandle_t             handle,
+                                     const hipblasFillMode_t     uplo,
+                                     const int                   n,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     int*                        info,
+                                     const int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zpotri_batched((rocblas_handle)handle,
+                                                      hipblasConvertFill(uplo),
+                                                      n,
+                                                      (rocblas_double_complex**)A,
+                                                      lda,
+                                                      info,
+                                                      batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotriBatched_v2(hipblasHandle_t         handle,
+                                        const hipblasFillMode_t uplo,
+                                        const int               n,
+                                        hipComplex* const       A[],
+                                        const int               lda,
+                                        int*                    info,
+                                        const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cpotri_batched((rocblas_handle)handle,
+                                                      hipblasConvertFill(uplo),
+                                                      n,
+                                                      (rocblas_float_complex**)A,
+                                                      lda,
+                                                      info,
+                                                      batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotriBatched_v2(hipblasHandle_t         handle,
+                                        const hipblasFillMode_t uplo,
+                                        const int               n,
+                                        hipDoubleComplex* const A[],
+                                        const int               lda,
+                                        int*                    info,
+                                        const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zpotri_batched((rocblas_handle)handle,
+                                                      hipblasConvertFill(uplo),
+                                                      n,
+                                                      (rocblas_double_complex**)A,
+                                                      lda,
+                                                      info,
+                                                      batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potri_strided_batched
+hipblasStatus_t hipblasSpotriStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            float*                  A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_spotri_strided_batched(
+        (rocblas_handle)handle, hipblasConvertFill(uplo), n, A, lda, strideA, info, batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotriStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            double*                 A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_dpotri_strided_batched(
+        (rocblas_handle)handle, hipblasConvertFill(uplo), n, A, lda, strideA, info, batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotriStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasComplex*         A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cpotri_strided_batched((rocblas_handle)handle,
+                                                              hipblasConvertFill(uplo),
+                                                              n,
+                                                              (rocblas_float_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              info,
+                                                              batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotriStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasDoubleComplex*   A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zpotri_strided_batched((rocblas_handle)handle,
+                                                              hipblasConvertFill(uplo),
+                                                              n,
+                                                              (rocblas_double_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              info,
+                                                              batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotriStridedBatched_v2(hipblasHandle_t         handle,
+                                               const hipblasFillMode_t uplo,
+                                               const int               n,
+                                               hipComplex*             A,
+                                               const int               lda,
+                                               const hipblasStride     strideA,
+                                               int*                    info,
+                                               const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cpotri_strided_batched((rocblas_handle)handle,
+                                                              hipblasConvertFill(uplo),
+                                                              n,
+                                                              (rocblas_float_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              info,
+                                                              batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotriStridedBatched_v2(hipblasHandle_t         handle,
+                                               const hipblasFillMode_t uplo,
+                                               const int               n,
+                                               hipDoubleComplex*       A,
+                                               const int               lda,
+                                               const hipblasStride     strideA,
+                                               int*                    info,
+                                               const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zpotri_strided_batched((rocblas_handle)handle,
+                                                              hipblasConvertFill(uplo),
+                                                              n,
+                                                              (rocblas_double_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              info,
+                                                              batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// syevj
+hipblasStatus_t hipblasSsyevj(hipblasHandle_t         handle,
+                              const hipblasEvect_t    evect,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              float*                  A,
+                              const int               lda,
+                              const float             abstol,
+                              float*                  residual,
+                              const int               maxSweeps,
+                              int*                    nSweeps,
+                              float*                  W,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, maxSweeps);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_ssyevj((rocblas_handle)handle,
+                                              rocblas_esort_ascending,
+                                              hipblasConvertEvect(evect),
+                                              hipblasConvertFill(uplo),
+                                              n,
+                                              A,
+                                              lda,
+                                              abstol,
+                                              residual,
+                                              maxSweeps,
+                                              nSweeps,
+                                              W,
+                                              info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDsyevj(hipblasHandle_t         handle,
+                              const hipblasEvect_t    evect,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              double*                 A,
+                              const int               lda,
+                              const double            abstol,
+                              double*                 residual,
+                              const int               maxSweeps,
+                              int*                    nSweeps,
+                              double*                 W,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, maxSweeps);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_dsyevj((rocblas_handle)handle,
+                                              rocblas_esort_ascending,
+                                              hipblasConvertEvect(evect),
+                                              hipblasConvertFill(uplo),
+                                              n,
+                                              A,
+                                              lda,
+                                              abstol,
+                                              residual,
+                                              maxSweeps,
+                                              nSweeps,
+                                              W,
+                                              info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCheevj(hipblasHandle_t         handle,
+                              const hipblasEvect_t    evect,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              hipblasComplex*         A,
+                              const int               lda,
+                              const float             abstol,
+                              float*                  residual,
+                              const int               maxSweeps,
+                              int*                    nSweeps,
+                              float*                  W,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, maxSweeps);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cheevj((rocblas_handle)handle,
+                                              rocblas_esort_ascending,
+                                              hipblasConvertEvect(evect),
+                                              hipblasConvertFill(uplo),
+                                              n,
+                                              (rocblas_float_complex*)A,
+                                              lda,
+                                              abstol,
+                                              residual,
+                                              maxSweeps,
+                                              nSweeps,
+                                              W,
+                                              info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZheevj(hipblasHandle_t         handle,
+                              const hipblasEvect_t    evect,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              hipblasDoubleComplex*   A,
+                              const int               lda,
+                              const double            abstol,
+                              double*                 residual,
+                              const int               maxSweeps,
+                              int*                    nSweeps,
+                              double*                 W,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, maxSweeps);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zheevj((rocblas_handle)handle,
+                                              rocblas_esort_ascending,
+                                              hipblasConvertEvect(evect),
+                                              hipblasConvertFill(uplo),
+                                              n,
+                                              (rocblas_double_complex*)A,
+                                              lda,
+                                              abstol,
+                                              residual,
+                                              maxSweeps,
+                                              nSweeps,
+                                              W,
+                                              info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCheevj_v2(hipblasHandle_t         handle,
+                                 const hipblasEvect_t    evect,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 hipComplex*             A,
+                                 const int               lda,
+                                 const float             abstol,
+                                 float*                  residual,
+                                 const int               maxSweeps,
+                                 int*                    nSweeps,
+                                 float*                  W,
+                                 int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, maxSweeps);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cheevj((rocblas_handle)handle,
+                                              rocblas_esort_ascending,
+                                              hipblasConvertEvect(evect),
+                                              hipblasConvertFill(uplo),
+                                              n,
+                                              (rocblas_float_complex*)A,
+                                              lda,
+                                              abstol,
+                                              residual,
+                                              maxSweeps,
+                                              nSweeps,
+                                              W,
+                                              info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZheevj_v2(hipblasHandle_t         handle,
+                                 const hipblasEvect_t    evect,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 hipDoubleComplex*       A,
+                                 const int               lda,
+                                 const double            abstol,
+                                 double*                 residual,
+                                 const int               maxSweeps,
+                                 int*                    nSweeps,
+                                 double*                 W,
+                                 int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, maxSweeps);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zheevj((rocblas_handle)handle,
+                                              rocblas_esort_ascending,
+                                              hipblasConvertEvect(evect),
+                                              hipblasConvertFill(uplo),
+                                              n,
+                                              (rocblas_double_complex*)A,
+                                              lda,
+                                              abstol,
+                                              residual,
+                                              maxSweeps,
+                                              nSweeps,
+                                              W,
+                                              info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// syevj_batched
+hipblasStatus_t hipblasSsyevjBatched(hipblasHandle_t         handle,
+                                     const hipblasEvect_t    evect,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     float* const            A[],
+                                     const int               lda,
+                                     const float             abstol,
+                                     float*                  residual,
+                                     const int               maxSweeps,
+                                     int*                    nSweeps,
+                                     float*                  W,
+                                     const hipblasStride     strideW,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, maxSweeps, strideW, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_ssyevj_batched((rocblas_handle)handle,
+                                                      rocblas_esort_ascending,
+                                                      hipblasConvertEvect(evect),
+                                                      hipblasConvertFill(uplo),
+                                                      n,
+                                                      A,
+                                                      lda,
+                                                      abstol,
+                                                      residual,
+                                                      maxSweeps,
+                                                      nSweeps,
+                                                      W,
+                                                      strideW,
+                                                      info,
+                                                      batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDsyevjBatched(hipblasHandle_t         handle,
+                                     const hipblasEvect_t    evect,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     double* const           A[],
+                                     const int               lda,
+                                     const double            abstol,
+                                     double*                 residual,
+                                     const int               maxSweeps,
+                                     int*                    nSweeps,
+                                     double*                 W,
+                                     const hipblasStride     strideW,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, maxSweeps, strideW, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_dsyevj_batched((rocblas_handle)handle,
+                                                      rocblas_esort_ascending,
+                                                      hipblasConvertEvect(evect),
+                                                      hipblasConvertFill(uplo),
+                                                      n,
+                                                      A,
+                                                      lda,
+                                                      abstol,
+                                                      residual,
+                                                      maxSweeps,
+                                                      nSweeps,
+                                                      W,
+                                                      strideW,
+                                                      info,
+                                                      batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCheevjBatched(hipblasHandle_t         handle,
+                                     const hipblasEvect_t    evect,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasComplex* const   A[],
+                                     const int               lda,
+                                     const float             abstol,
+                                     float*                  residual,
+                                     const int               maxSweeps,
+                                     int*                    nSweeps,
+                                     float*                  W,
+                                     const hipblasStride     strideW,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, maxSweeps, strideW, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cheevj_batched((rocblas_handle)handle,
+                                                      rocblas_esort_ascending,
+                                                      hipblasConvertEvect(evect),
+                                                      hipblasConvertFill(uplo),
+                                                      n,
+                                                      (rocblas_float_complex**)A,
+                                                      lda,
+                                                      abstol,
+                                                      residual,
+                                                      maxSweeps,
+                                                      nSweeps,
+                                                      W,
+                                                      strideW,
+                                                      info,
+                                                      batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZheevjBatched(hipblasHandle_t             handle,
+                                     const hipblasEvect_t        evect,
+                                     const hipblasFillMode_t     uplo,
+                                     const int                   n,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     const double                abstol,
+                                     double*                     residual,
+                                     const int                   maxSweeps,
+                                     int*                        nSweeps,
+                                     double*                     W,
+                                     const hipblasStride         strideW,
+                                     int*                        info,
+                                     const int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, maxSweeps, strideW, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zheevj_batched((rocblas_handle)handle,
+                                                      rocblas_esort_ascending,
+                                                      hipblasConvertEvect(evect),
+                                                      hipblasConvertFill(uplo),
+                                                      n,
+                                                      (rocblas_double_complex**)A,
+                                                      lda,
+                                                      abstol,
+                                                      residual,
+                                                      maxSweeps,
+                                                      nSweeps,
+                                                      W,
+                                                      strideW,
+                                                      info,
+                                                      batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCheevjBatched_v2(hipblasHandle_t         handle,
+                                        const hipblasEvect_t    evect,
+                                        const hipblasFillMode_t uplo,
+                                        const int               n,
+                                        hipComplex* const       A[],
+                                        const int               lda,
+                                        const float             abstol,
+                                        float*                  residual,
+                                        const int               maxSweeps,
+                                        int*                    nSweeps,
+                                        float*                  W,
+                                        const hipblasStride     strideW,
+                                        int*                    info,
+                                        const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, maxSweeps, strideW, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cheevj_batched((rocblas_handle)handle,
+                                                      rocblas_esort_ascending,
+                                                      hipblasConvertEvect(evect),
+                                                      hipblasConvertFill(uplo),
+                                                      n,
+                                                      (rocblas_float_complex**)A,
+                                                      lda,
+                                                      abstol,
+                                                      residual,
+                                                      maxSweeps,
+                                                      nSweeps,
+                                                      W,
+                                                      strideW,
+                                                      info,
+                                                      batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZheevjBatched_v2(hipblasHandle_t         handle,
+                                        const hipblasEvect_t    evect,
+                                        const hipblasFillMode_t uplo,
+                                        const int               n,
+                                        hipDoubleComplex* const A[],
+                                        const int               lda,
+                                        const double            abstol,
+                                        double*                 residual,
+                                        const int               maxSweeps,
+                                        int*                    nSweeps,
+                                        double*                 W,
+                                        const hipblasStride     strideW,
+                                        int*                    info,
+                                        const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, maxSweeps, strideW, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zheevj_batched((rocblas_handle)handle,
+                                                      rocblas_esort_ascending,
+                                                      hipblasConvertEvect(evect),
+                                                      hipblasConvertFill(uplo),
+                                                      n,
+                                                      (rocblas_double_complex**)A,
+                                                      lda,
+                                                      abstol,
+                                                      residual,
+                                                      maxSweeps,
+                                                      nSweeps,
+                                                      W,
+                                                      strideW,
+                                                      info,
+                                                      batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// syevj_strided_batched
+hipblasStatus_t hipblasSsyevjStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasEvect_t    evect,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            float*                  A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            const float             abstol,
+                                            float*                  residual,
+                                            const int               maxSweeps,
+                                            int*                    nSweeps,
+                                            float*                  W,
+                                            const hipblasStride     strideW,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, maxSweeps, strideW, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_ssyevj_strided_batched((rocblas_handle)handle,
+                                                              rocblas_esort_ascending,
+                                                              hipblasConvertEvect(evect),
+                                                              hipblasConvertFill(uplo),
+                                                              n,
+                                                              A,
+                                                              lda,
+                                                              strideA,
+                                                              abstol,
+                                                              residual,
+                                                              maxSweeps,
+                                                              nSweeps,
+                                                              W,
+                                                              strideW,
+                                                              info,
+                                                              batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDsyevjStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasEvect_t    evect,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            double*                 A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            const double            abstol,
+                                            double*                 residual,
+                                            const int               maxSweeps,
+                                            int*                    nSweeps,
+                                            double*                 W,
+                                            const hipblasStride     strideW,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, maxSweeps, strideW, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_dsyevj_strided_batched((rocblas_handle)handle,
+                                                              rocblas_esort_ascending,
+                                                              hipblasConvertEvect(evect),
+                                                              hipblasConvertFill(uplo),
+                                                              n,
+                                                              A,
+                                                              lda,
+                                                              strideA,
+                                                              abstol,
+                                                              residual,
+                                                              maxSweeps,
+                                                              nSweeps,
+                                                              W,
+                                                              strideW,
+                                                              info,
+                                                              batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCheevjStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasEvect_t    evect,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasComplex*         A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            const float             abstol,
+                                            float*                  residual,
+                                            const int               maxSweeps,
+                                            int*                    nSweeps,
+                                            float*                  W,
+                                            const hipblasStride     strideW,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, maxSweeps, strideW, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cheevj_strided_batched((rocblas_handle)handle,
+                                                              rocblas_esort_ascending,
+                                                              hipblasConvertEvect(evect),
+                                                              hipblasConvertFill(uplo),
+                                                              n,
+                                                              (rocblas_float_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              abstol,
+                                                              residual,
+                                                              maxSweeps,
+                                                              nSweeps,
+                                                              W,
+                                                              strideW,
+                                                              info,
+                                                              batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZheevjStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasEvect_t    evect,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasDoubleComplex*   A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            const double            abstol,
+                                            double*                 residual,
+                                            const int               maxSweeps,
+                                            int*                    nSweeps,
+                                            double*                 W,
+                                            const hipblasStride     strideW,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, maxSweeps, strideW, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zheevj_strided_batched((rocblas_handle)handle,
+                                                              rocblas_esort_ascending,
+                                                              hipblasConvertEvect(evect),
+                                                              hipblasConvertFill(uplo),
+                                                              n,
+                                                              (rocblas_double_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              abstol,
+                                                              residual,
+                                                              maxSweeps,
+                                                              nSweeps,
+                                                              W,
+                                                              strideW,
+                                                              info,
+                                                              batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCheevjStridedBatched_v2(hipblasHandle_t         handle,
+                                               const hipblasEvect_t    evect,
+                                               const hipblasFillMode_t uplo,
+                                               const int               n,
+                                               hipComplex*             A,
+                                               const int               lda,
+                                               const hipblasStride     strideA,
+                                               const float             abstol,
+                                               float*                  residual,
+                                               const int               maxSweeps,
+                                               int*                    nSweeps,
+                                               float*                  W,
+                                               const hipblasStride     strideW,
+                                               int*                    info,
+                                               const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, maxSweeps, strideW, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cheevj_strided_batched((rocblas_handle)handle,
+                                                              rocblas_esort_ascending,
+                                                              hipblasConvertEvect(evect),
+                                                              hipblasConvertFill(uplo),
+                                                              n,
+                                                              (rocblas_float_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              abstol,
+                                                              residual,
+                                                              maxSweeps,
+                                                              nSweeps,
+                                                              W,
+                                                              strideW,
+                                                              info,
+                                                              batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZheevjStridedBatched_v2(hipblasHandle_t         handle,
+                                               const hipblasEvect_t    evect,
+                                               const hipblasFillMode_t uplo,
+                                               const int               n,
+                                               hipDoubleComplex*       A,
+                                               const int               lda,
+                                               const hipblasStride     strideA,
+                                               const double            abstol,
+                                               double*                 residual,
+                                               const int               maxSweeps,
+                                               int*                    nSweeps,
+                                               double*                 W,
+                                               const hipblasStride     strideW,
+                                               int*                    info,
+                                               const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, maxSweeps, strideW, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zheevj_strided_batched((rocblas_handle)handle,
+                                                              rocblas_esort_ascending,
+                                                              hipblasConvertEvect(evect),
+                                                              hipblasConvertFill(uplo),
+                                                              n,
+                                                              (rocblas_double_complex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              abstol,
+                                                              residual,
+                                                              maxSweeps,
+                                                              nSweeps,
+                                                              W,
+                                                              strideW,
+                                                              info,
+                                                              batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// syevd
+hipblasStatus_t hipblasSsyevd(hipblasHandle_t         handle,
+                              const hipblasEvect_t    evect,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              float*                  A,
+                              const int               lda,
+                              float*                  D,
+                              float*                  E,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_ssyevd((rocblas_handle)handle,
+                                              hipblasConvertEvect(evect),
+                                              hipblasConvertFill(uplo),
+                                              n,
+                                              A,
+                                              lda,
+                                              D,
+                                              E,
+                                              info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDsyevd(hipblasHandle_t         handle,
+                              const hipblasEvect_t    evect,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              double*                 A,
+                              const int               lda,
+                              double*                 D,
+                              double*                 E,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_dsyevd((rocblas_handle)handle,
+                                              hipblasConvertEvect(evect),
+                                              hipblasConvertFill(uplo),
+                                              n,
+                                              A,
+                                              lda,
+                                              D,
+                                              E,
+                                              info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCheevd(hipblasHandle_t         handle,
+                              const hipblasEvect_t    evect,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              hipblasComplex*         A,
+                              const int               lda,
+                              float*                  D,
+                              float*                  E,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cheevd((rocblas_handle)handle,
+                                              hipblasConvertEvect(evect),
+                                              hipblasConvertFill(uplo),
+                                              n,
+                                              (rocblas_float_complex*)A,
+                                              lda,
+                                              D,
+                                              E,
+                                              info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZheevd(hipblasHandle_t         handle,
+                              const hipblasEvect_t    evect,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              hipblasDoubleComplex*   A,
+                              const int               lda,
+                              double*                 D,
+                              double*                 E,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zheevd((rocblas_handle)handle,
+                                              hipblasConvertEvect(evect),
+                                              hipblasConvertFill(uplo),
+                                              n,
+                                              (rocblas_double_complex*)A,
+                                              lda,
+                                              D,
+                                              E,
+                                              info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCheevd_v2(hipblasHandle_t         handle,
+                                 const hipblasEvect_t    evect,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 hipComplex*             A,
+                                 const int               lda,
+                                 float*                  D,
+                                 float*                  E,
+                                 int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cheevd((rocblas_handle)handle,
+                                              hipblasConvertEvect(evect),
+                                              hipblasConvertFill(uplo),
+                                              n,
+                                              (rocblas_float_complex*)A,
+                                              lda,
+                                              D,
+                                              E,
+                                              info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZheevd_v2(hipblasHandle_t         handle,
+                                 const hipblasEvect_t    evect,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 hipDoubleComplex*       A,
+                                 const int               lda,
+                                 double*                 D,
+                                 double*                 E,
+                                 int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zheevd((rocblas_handle)handle,
+                                              hipblasConvertEvect(evect),
+                                              hipblasConvertFill(uplo),
+                                              n,
+                                              (rocblas_double_complex*)A,
+                                              lda,
+                                              D,
+                                              E,
+                                              info)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// gesvdj_batched
+hipblasStatus_t hipblasSgesvdjBatched(hipblasHandle_t      handle,
+                                      const hipblasSvect_t leftSvect,
+                                      const hipblasSvect_t rightSvect,
+                                      const int            m,
+                                      const int            n,
+                                      float* const         A[],
+                                      const int            lda,
+                                      const float          abstol,
+                                      float*               residual,
+                                      const int            maxSweeps,
+                                      int*                 nSweeps,
+                                      float*               S,
+                                      const hipblasStride  strideS,
+                                      float*               U,
+                                      const int            ldu,
+                                      const hipblasStride  strideU,
+                                      float*               V,
+                                      const int            ldv,
+                                      const hipblasStride  strideV,
+                                      int*                 info,
+                                      const int            batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, maxSweeps, strideS, ldu, strideU, ldv, strideV, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_sgesvdj_batched((rocblas_handle)handle,
+                                                       hipblasConvertSvect(leftSvect),
+                                                       hipblasConvertSvect(rightSvect),
+                                                       m,
+                                                       n,
+                                                       A,
+                                                       lda,
+                                                       abstol,
+                                                       residual,
+                                                       maxSweeps,
+                                                       nSweeps,
+                                                       S,
+                                                       strideS,
+                                                       U,
+                                                       ldu,
+                                                       strideU,
+                                                       V,
+                                                       ldv,
+                                                       strideV,
+                                                       info,
+                                                       batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgesvdjBatched(hipblasHandle_t      handle,
+                                      const hipblasSvect_t leftSvect,
+                                      const hipblasSvect_t rightSvect,
+                                      const int            m,
+                                      const int            n,
+                                      double* const        A[],
+                                      const int            lda,
+                                      const double         abstol,
+                                      double*              residual,
+                                      const int            maxSweeps,
+                                      int*                 nSweeps,
+                                      double*              S,
+                                      const hipblasStride  strideS,
+                                      double*              U,
+                                      const int            ldu,
+                                      const hipblasStride  strideU,
+                                      double*              V,
+                                      const int            ldv,
+                                      const hipblasStride  strideV,
+                                      int*                 info,
+                                      const int            batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, maxSweeps, strideS, ldu, strideU, ldv, strideV, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_dgesvdj_batched((rocblas_handle)handle,
+                                                       hipblasConvertSvect(leftSvect),
+                                                       hipblasConvertSvect(rightSvect),
+                                                       m,
+                                                       n,
+                                                       A,
+                                                       lda,
+                                                       abstol,
+                                                       residual,
+                                                       maxSweeps,
+                                                       nSweeps,
+                                                       S,
+                                                       strideS,
+                                                       U,
+                                                       ldu,
+                                                       strideU,
+                                                       V,
+                                                       ldv,
+                                                       strideV,
+                                                       info,
+                                                       batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgesvdjBatched(hipblasHandle_t       handle,
+                                      const hipblasSvect_t  leftSvect,
+                                      const hipblasSvect_t  rightSvect,
+                                      const int             m,
+                                      const int             n,
+                                      hipblasComplex* const A[],
+                                      const int             lda,
+                                      const float           abstol,
+                                      float*                residual,
+                                      const int             maxSweeps,
+                                      int*                  nSweeps,
+                                      float*                S,
+                                      const hipblasStride   strideS,
+                                      hipblasComplex*       U,
+                                      const int             ldu,
+                                      const hipblasStride   strideU,
+                                      hipblasComplex*       V,
+                                      const int             ldv,
+                                      const hipblasStride   strideV,
+                                      int*                  info,
+                                      const int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, maxSweeps, strideS, ldu, strideU, ldv, strideV, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgesvdj_batched((rocblas_handle)handle,
+                                                       hipblasConvertSvect(leftSvect),
+                                                       hipblasConvertSvect(rightSvect),
+                                                       m,
+                                                       n,
+                                                       (rocblas_float_complex**)A,
+                                                       lda,
+                                                       abstol,
+                                                       residual,
+                                                       maxSweeps,
+                                                       nSweeps,
+                                                       S,
+                                                       strideS,
+                                                       (rocblas_float_complex*)U,
+                                                       ldu,
+                                                       strideU,
+                                                       (rocblas_float_complex*)V,
+                                                       ldv,
+                                                       strideV,
+                                                       info,
+                                                       batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgesvdjBatched(hipblasHandle_t             handle,
+                                      const hipblasSvect_t        leftSvect,
+                                      const hipblasSvect_t        rightSvect,
+                                      const int                   m,
+                                      const int                   n,
+                                      hipblasDoubleComplex* const A[],
+                                      const int                   lda,
+                                      const double                abstol,
+                                      double*                     residual,
+                                      const int                   maxSweeps,
+                                      int*                        nSweeps,
+                                      double*                     S,
+                                      const hipblasStride         strideS,
+                                      hipblasDoubleComplex*       U,
+                                      const int                   ldu,
+                                      const hipblasStride         strideU,
+                                      hipblasDoubleComplex*       V,
+                                      const int                   ldv,
+                                      const hipblasStride         strideV,
+                                      int*                        info,
+                                      const int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, maxSweeps, strideS, ldu, strideU, ldv, strideV, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgesvdj_batched((rocblas_handle)handle,
+                                                       hipblasConvertSvect(leftSvect),
+                                                       hipblasConvertSvect(rightSvect),
+                                                       m,
+                                                       n,
+                                                       (rocblas_double_complex**)A,
+                                                       lda,
+                                                       abstol,
+                                                       residual,
+                                                       maxSweeps,
+                                                       nSweeps,
+                                                       S,
+                                                       strideS,
+                                                       (rocblas_double_complex*)U,
+                                                       ldu,
+                                                       strideU,
+                                                       (rocblas_double_complex*)V,
+                                                       ldv,
+                                                       strideV,
+                                                       info,
+                                                       batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgesvdjBatched_v2(hipblasHandle_t      handle,
+                                         const hipblasSvect_t leftSvect,
+                                         const hipblasSvect_t rightSvect,
+                                         const int            m,
+                                         const int            n,
+                                         hipComplex* const    A[],
+                                         const int            lda,
+                                         const float          abstol,
+                                         float*               residual,
+                                         const int            maxSweeps,
+                                         int*                 nSweeps,
+                                         float*               S,
+                                         const hipblasStride  strideS,
+                                         hipComplex*          U,
+                                         const int            ldu,
+                                         const hipblasStride  strideU,
+                                         hipComplex*          V,
+                                         const int            ldv,
+                                         const hipblasStride  strideV,
+                                         int*                 info,
+                                         const int            batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, maxSweeps, strideS, ldu, strideU, ldv, strideV, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgesvdj_batched((rocblas_handle)handle,
+                                                       hipblasConvertSvect(leftSvect),
+                                                       hipblasConvertSvect(rightSvect),
+                                                       m,
+                                                       n,
+                                                       (rocblas_float_complex**)A,
+                                                       lda,
+                                                       abstol,
+                                                       residual,
+                                                       maxSweeps,
+                                                       nSweeps,
+                                                       S,
+                                                       strideS,
+                                                       (rocblas_float_complex*)U,
+                                                       ldu,
+                                                       strideU,
+                                                       (rocblas_float_complex*)V,
+                                                       ldv,
+                                                       strideV,
+                                                       info,
+                                                       batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgesvdjBatched_v2(hipblasHandle_t         handle,
+                                         const hipblasSvect_t    leftSvect,
+                                         const hipblasSvect_t    rightSvect,
+                                         const int               m,
+                                         const int               n,
+                                         hipDoubleComplex* const A[],
+                                         const int               lda,
+                                         const double            abstol,
+                                         double*                 residual,
+                                         const int               maxSweeps,
+                                         int*                    nSweeps,
+                                         double*                 S,
+                                         const hipblasStride     strideS,
+                                         hipDoubleComplex*       U,
+                                         const int               ldu,
+                                         const hipblasStride     strideU,
+                                         hipDoubleComplex*       V,
+                                         const int               ldv,
+                                         const hipblasStride     strideV,
+                                         int*                    info,
+                                         const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, maxSweeps, strideS, ldu, strideU, ldv, strideV, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgesvdj_batched((rocblas_handle)handle,
+                                                       hipblasConvertSvect(leftSvect),
+                                                       hipblasConvertSvect(rightSvect),
+                                                       m,
+                                                       n,
+                                                       (rocblas_double_complex**)A,
+                                                       lda,
+                                                       abstol,
+                                                       residual,
+                                                       maxSweeps,
+                                                       nSweeps,
+                                                       S,
+                                                       strideS,
+                                                       (rocblas_double_complex*)U,
+                                                       ldu,
+                                                       strideU,
+                                                       (rocblas_double_complex*)V,
+                                                       ldv,
+                                                       strideV,
+                                                       info,
+                                                       batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// gesvdj_strided_batched
+hipblasStatus_t hipblasSgesvdjStridedBatched(hipblasHandle_t      handle,
+                                             const hipblasSvect_t leftSvect,
+                                             const hipblasSvect_t rightSvect,
+                                             const int            m,
+                                             const int            n,
+                                             float*               A,
+                                             const int            lda,
+                                             const hipblasStride  strideA,
+                                             const float          abstol,
+                                             float*               residual,
+                                             const int            maxSweeps,
+                                             int*                 nSweeps,
+                                             float*               S,
+                                             const hipblasStride  strideS,
+                                             float*               U,
+                                             const int            ldu,
+                                             const hipblasStride  strideU,
+                                             float*               V,
+                                             const int            ldv,
+                                             const hipblasStride  strideV,
+                                             int*                 info,
+                                             const int            batchCount)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, m, n, lda, strideA, maxSweeps, strideS, ldu, strideU, ldv, strideV, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_sgesvdj_strided_batched((rocblas_handle)handle,
+                                                               hipblasConvertSvect(leftSvect),
+                                                               hipblasConvertSvect(rightSvect),
+                                                               m,
+                                                               n,
+                                                               A,
+                                                               lda,
+                                                               strideA,
+                                                               abstol,
+                                                               residual,
+                                                               maxSweeps,
+                                                               nSweeps,
+                                                               S,
+                                                               strideS,
+                                                               U,
+                                                               ldu,
+                                                               strideU,
+                                                               V,
+                                                               ldv,
+                                                               strideV,
+                                                               info,
+                                                               batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgesvdjStridedBatched(hipblasHandle_t      handle,
+                                             const hipblasSvect_t leftSvect,
+                                             const hipblasSvect_t rightSvect,
+                                             const int            m,
+                                             const int            n,
+                                             double*              A,
+                                             const int            lda,
+                                             const hipblasStride  strideA,
+                                             const double         abstol,
+                                             double*              residual,
+                                             const int            maxSweeps,
+                                             int*                 nSweeps,
+                                             double*              S,
+                                             const hipblasStride  strideS,
+                                             double*              U,
+                                             const int            ldu,
+                                             const hipblasStride  strideU,
+                                             double*              V,
+                                             const int            ldv,
+                                             const hipblasStride  strideV,
+                                             int*                 info,
+                                             const int            batchCount)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, m, n, lda, strideA, maxSweeps, strideS, ldu, strideU, ldv, strideV, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_dgesvdj_strided_batched((rocblas_handle)handle,
+                                                               hipblasConvertSvect(leftSvect),
+                                                               hipblasConvertSvect(rightSvect),
+                                                               m,
+                                                               n,
+                                                               A,
+                                                               lda,
+                                                               strideA,
+                                                               abstol,
+                                                               residual,
+                                                               maxSweeps,
+                                                               nSweeps,
+                                                               S,
+                                                               strideS,
+                                                               U,
+                                                               ldu,
+                                                               strideU,
+                                                               V,
+                                                               ldv,
+                                                               strideV,
+                                                               info,
+                                                               batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgesvdjStridedBatched(hipblasHandle_t      handle,
+                                             const hipblasSvect_t leftSvect,
+                                             const hipblasSvect_t rightSvect,
+                                             const int            m,
+                                             const int            n,
+                                             hipblasComplex*      A,
+                                             const int            lda,
+                                             const hipblasStride  strideA,
+                                             const float          abstol,
+                                             float*               residual,
+                                             const int            maxSweeps,
+                                             int*                 nSweeps,
+                                             float*               S,
+                                             const hipblasStride  strideS,
+                                             hipblasComplex*      U,
+                                             const int            ldu,
+                                             const hipblasStride  strideU,
+                                             hipblasComplex*      V,
+                                             const int            ldv,
+                                             const hipblasStride  strideV,
+                                             int*                 info,
+                                             const int            batchCount)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, m, n, lda, strideA, maxSweeps, strideS, ldu, strideU, ldv, strideV, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgesvdj_strided_batched((rocblas_handle)handle,
+                                                               hipblasConvertSvect(leftSvect),
+                                                               hipblasConvertSvect(rightSvect),
+                                                               m,
+                                                               n,
+                                                               (rocblas_float_complex*)A,
+                                                               lda,
+                                                               strideA,
+                                                               abstol,
+                                                               residual,
+                                                               maxSweeps,
+                                                               nSweeps,
+                                                               S,
+                                                               strideS,
+                                                               (rocblas_float_complex*)U,
+                                                               ldu,
+                                                               strideU,
+                                                               (rocblas_float_complex*)V,
+                                                               ldv,
+                                                               strideV,
+                                                               info,
+                                                               batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgesvdjStridedBatched(hipblasHandle_t       handle,
+                                             const hipblasSvect_t  leftSvect,
+                                             const hipblasSvect_t  rightSvect,
+                                             const int             m,
+                                             const int             n,
+                                             hipblasDoubleComplex* A,
+                                             const int             lda,
+                                             const hipblasStride   strideA,
+                                             const double          abstol,
+                                             double*               residual,
+                                             const int             maxSweeps,
+                                             int*                  nSweeps,
+                                             double*               S,
+                                             const hipblasStride   strideS,
+                                             hipblasDoubleComplex* U,
+                                             const int             ldu,
+                                             const hipblasStride   strideU,
+                                             hipblasDoubleComplex* V,
+                                             const int             ldv,
+                                             const hipblasStride   strideV,
+                                             int*                  info,
+                                             const int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, m, n, lda, strideA, maxSweeps, strideS, ldu, strideU, ldv, strideV, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgesvdj_strided_batched((rocblas_handle)handle,
+                                                               hipblasConvertSvect(leftSvect),
+                                                               hipblasConvertSvect(rightSvect),
+                                                               m,
+                                                               n,
+                                                               (rocblas_double_complex*)A,
+                                                               lda,
+                                                               strideA,
+                                                               abstol,
+                                                               residual,
+                                                               maxSweeps,
+                                                               nSweeps,
+                                                               S,
+                                                               strideS,
+                                                               (rocblas_double_complex*)U,
+                                                               ldu,
+                                                               strideU,
+                                                               (rocblas_double_complex*)V,
+                                                               ldv,
+                                                               strideV,
+                                                               info,
+                                                               batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgesvdjStridedBatched_v2(hipblasHandle_t      handle,
+                                                const hipblasSvect_t leftSvect,
+                                                const hipblasSvect_t rightSvect,
+                                                const int            m,
+                                                const int            n,
+                                                hipComplex*          A,
+                                                const int            lda,
+                                                const hipblasStride  strideA,
+                                                const float          abstol,
+                                                float*               residual,
+                                                const int            maxSweeps,
+                                                int*                 nSweeps,
+                                                float*               S,
+                                                const hipblasStride  strideS,
+                                                hipComplex*          U,
+                                                const int            ldu,
+                                                const hipblasStride  strideU,
+                                                hipComplex*          V,
+                                                const int            ldv,
+                                                const hipblasStride  strideV,
+                                                int*                 info,
+                                                const int            batchCount)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, m, n, lda, strideA, maxSweeps, strideS, ldu, strideU, ldv, strideV, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgesvdj_strided_batched((rocblas_handle)handle,
+                                                               hipblasConvertSvect(leftSvect),
+                                                               hipblasConvertSvect(rightSvect),
+                                                               m,
+                                                               n,
+                                                               (rocblas_float_complex*)A,
+                                                               lda,
+                                                               strideA,
+                                                               abstol,
+                                                               residual,
+                                                               maxSweeps,
+                                                               nSweeps,
+                                                               S,
+                                                               strideS,
+                                                               (rocblas_float_complex*)U,
+                                                               ldu,
+                                                               strideU,
+                                                               (rocblas_float_complex*)V,
+                                                               ldv,
+                                                               strideV,
+                                                               info,
+                                                               batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgesvdjStridedBatched_v2(hipblasHandle_t      handle,
+                                                const hipblasSvect_t leftSvect,
+                                                const hipblasSvect_t rightSvect,
+                                                const int            m,
+                                                const int            n,
+                                                hipDoubleComplex*    A,
+                                                const int            lda,
+                                                const hipblasStride  strideA,
+                                                const double         abstol,
+                                                double*              residual,
+                                                const int            maxSweeps,
+                                                int*                 nSweeps,
+                                                double*              S,
+                                                const hipblasStride  strideS,
+                                                hipDoubleComplex*    U,
+                                                const int            ldu,
+                                                const hipblasStride  strideU,
+                                                hipDoubleComplex*    V,
+                                                const int            ldv,
+                                                const hipblasStride  strideV,
+                                                int*                 info,
+                                                const int            batchCount)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, m, n, lda, strideA, maxSweeps, strideS, ldu, strideU, ldv, strideV, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgesvdj_strided_batched((rocblas_handle)handle,
+                                                               hipblasConvertSvect(leftSvect),
+                                                               hipblasConvertSvect(rightSvect),
+                                                               m,
+                                                               n,
+                                                               (rocblas_double_complex*)A,
+                                                               lda,
+                                                               strideA,
+                                                               abstol,
+                                                               residual,
+                                                               maxSweeps,
+                                                               nSweeps,
+                                                               S,
+                                                               strideS,
+                                                               (rocblas_double_complex*)U,
+                                                               ldu,
+                                                               strideU,
+                                                               (rocblas_double_complex*)V,
+                                                               ldv,
+                                                               strideV,
+                                                               info,
+                                                               batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// gesv_batched
+hipblasStatus_t hipblasSgesvBatched(hipblasHandle_t handle,
+                                    const int       n,
+                                    const int       nrhs,
+                                    float* const    A[],
+                                    const int       lda,
+                                    int*            ipiv,
+                                    float* const    B[],
+                                    const int       ldb,
+                                    int*            info,
+                                    const int       batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, ldb, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_sgesv_batched(
+        (rocblas_handle)handle, n, nrhs, A, lda, ipiv, n, B, ldb, info, batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgesvBatched(hipblasHandle_t handle,
+                                    const int       n,
+                                    const int       nrhs,
+                                    double* const   A[],
+                                    const int       lda,
+                                    int*            ipiv,
+                                    double* const   B[],
+                                    const int       ldb,
+                                    int*            info,
+                                    const int       batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, ldb, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_dgesv_batched(
+        (rocblas_handle)handle, n, nrhs, A, lda, ipiv, n, B, ldb, info, batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgesvBatched(hipblasHandle_t       handle,
+                                    const int             n,
+                                    const int             nrhs,
+                                    hipblasComplex* const A[],
+                                    const int             lda,
+                                    int*                  ipiv,
+                                    hipblasComplex* const B[],
+                                    const int             ldb,
+                                    int*                  info,
+                                    const int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, ldb, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgesv_batched((rocblas_handle)handle,
+                                                     n,
+                                                     nrhs,
+                                                     (rocblas_float_complex**)A,
+                                                     lda,
+                                                     ipiv,
+                                                     n,
+                                                     (rocblas_float_complex**)B,
+                                                     ldb,
+                                                     info,
+                                                     batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgesvBatched(hipblasHandle_t             handle,
+                                    const int                   n,
+                                    const int                   nrhs,
+                                    hipblasDoubleComplex* const A[],
+                                    const int                   lda,
+                                    int*                        ipiv,
+                                    hipblasDoubleComplex* const B[],
+                                    const int                   ldb,
+                                    int*                        info,
+                                    const int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, ldb, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgesv_batched((rocblas_handle)handle,
+                                                     n,
+                                                     nrhs,
+                                                     (rocblas_double_complex**)A,
+                                                     lda,
+                                                     ipiv,
+                                                     n,
+                                                     (rocblas_double_complex**)B,
+                                                     ldb,
+                                                     info,
+                                                     batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgesvBatched_v2(hipblasHandle_t   handle,
+                                       const int         n,
+                                       const int         nrhs,
+                                       hipComplex* const A[],
+                                       const int         lda,
+                                       int*              ipiv,
+                                       hipComplex* const B[],
+                                       const int         ldb,
+                                       int*              info,
+                                       const int         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, ldb, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgesv_batched((rocblas_handle)handle,
+                                                     n,
+                                                     nrhs,
+                                                     (rocblas_float_complex**)A,
+                                                     lda,
+                                                     ipiv,
+                                                     n,
+                                                     (rocblas_float_complex**)B,
+                                                     ldb,
+                                                     info,
+                                                     batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgesvBatched_v2(hipblasHandle_t         handle,
+                                       const int               n,
+                                       const int               nrhs,
+                                       hipDoubleComplex* const A[],
+                                       const int               lda,
+                                       int*                    ipiv,
+                                       hipDoubleComplex* const B[],
+                                       const int               ldb,
+                                       int*                    info,
+                                       const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, ldb, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgesv_batched((rocblas_handle)handle,
+                                                     n,
+                                                     nrhs,
+                                                     (rocblas_double_complex**)A,
+                                                     lda,
+                                                     ipiv,
+                                                     n,
+                                                     (rocblas_double_complex**)B,
+                                                     ldb,
+                                                     info,
+                                                     batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// gesv_strided_batched
+hipblasStatus_t hipblasSgesvStridedBatched(hipblasHandle_t     handle,
+                                           const int           n,
+                                           const int           nrhs,
+                                           float*              A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           int*                ipiv,
+                                           const hipblasStride strideP,
+                                           float*              B,
+                                           const int           ldb,
+                                           const hipblasStride strideB,
+                                           int*                info,
+                                           const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, strideA, strideP, ldb, strideB, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_sgesv_strided_batched((rocblas_handle)handle,
+                                                             n,
+                                                             nrhs,
+                                                             A,
+                                                             lda,
+                                                             strideA,
+                                                             ipiv,
+                                                             strideP,
+                                                             B,
+                                                             ldb,
+                                                             strideB,
+                                                             info,
+                                                             batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgesvStridedBatched(hipblasHandle_t     handle,
+                                           const int           n,
+                                           const int           nrhs,
+                                           double*             A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           int*                ipiv,
+                                           const hipblasStride strideP,
+                                           double*             B,
+                                           const int           ldb,
+                                           const hipblasStride strideB,
+                                           int*                info,
+                                           const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, strideA, strideP, ldb, strideB, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_dgesv_strided_batched((rocblas_handle)handle,
+                                                             n,
+                                                             nrhs,
+                                                             A,
+                                                             lda,
+                                                             strideA,
+                                                             ipiv,
+                                                             strideP,
+                                                             B,
+                                                             ldb,
+                                                             strideB,
+                                                             info,
+                                                             batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgesvStridedBatched(hipblasHandle_t     handle,
+                                           const int           n,
+                                           const int           nrhs,
+                                           hipblasComplex*     A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           int*                ipiv,
+                                           const hipblasStride strideP,
+                                           hipblasComplex*     B,
+                                           const int           ldb,
+                                           const hipblasStride strideB,
+                                           int*                info,
+                                           const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, strideA, strideP, ldb, strideB, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgesv_strided_batched((rocblas_handle)handle,
+                                                             n,
+                                                             nrhs,
+                                                             (rocblas_float_complex*)A,
+                                                             lda,
+                                                             strideA,
+                                                             ipiv,
+                                                             strideP,
+                                                             (rocblas_float_complex*)B,
+                                                             ldb,
+                                                             strideB,
+                                                             info,
+                                                             batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgesvStridedBatched(hipblasHandle_t       handle,
+                                           const int             n,
+                                           const int             nrhs,
+                                           hipblasDoubleComplex* A,
+                                           const int             lda,
+                                           const hipblasStride   strideA,
+                                           int*                  ipiv,
+                                           const hipblasStride   strideP,
+                                           hipblasDoubleComplex* B,
+                                           const int             ldb,
+                                           const hipblasStride   strideB,
+                                           int*                  info,
+                                           const int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, strideA, strideP, ldb, strideB, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgesv_strided_batched((rocblas_handle)handle,
+                                                             n,
+                                                             nrhs,
+                                                             (rocblas_double_complex*)A,
+                                                             lda,
+                                                             strideA,
+                                                             ipiv,
+                                                             strideP,
+                                                             (rocblas_double_complex*)B,
+                                                             ldb,
+                                                             strideB,
+                                                             info,
+                                                             batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgesvStridedBatched_v2(hipblasHandle_t     handle,
+                                              const int           n,
+                                              const int           nrhs,
+                                              hipComplex*         A,
+                                              const int           lda,
+                                              const hipblasStride strideA,
+                                              int*                ipiv,
+                                              const hipblasStride strideP,
+                                              hipComplex*         B,
+                                              const int           ldb,
+                                              const hipblasStride strideB,
+                                              int*                info,
+                                              const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, strideA, strideP, ldb, strideB, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cgesv_strided_batched((rocblas_handle)handle,
+                                                             n,
+                                                             nrhs,
+                                                             (rocblas_float_complex*)A,
+                                                             lda,
+                                                             strideA,
+                                                             ipiv,
+                                                             strideP,
+                                                             (rocblas_float_complex*)B,
+                                                             ldb,
+                                                             strideB,
+                                                             info,
+                                                             batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgesvStridedBatched_v2(hipblasHandle_t     handle,
+                                              const int           n,
+                                              const int           nrhs,
+                                              hipDoubleComplex*   A,
+                                              const int           lda,
+                                              const hipblasStride strideA,
+                                              int*                ipiv,
+                                              const hipblasStride strideP,
+                                              hipDoubleComplex*   B,
+                                              const int           ldb,
+                                              const hipblasStride strideB,
+                                              int*                info,
+                                              const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, strideA, strideP, ldb, strideB, batchCount);
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zgesv_strided_batched((rocblas_handle)handle,
+                                                             n,
+                                                             nrhs,
+                                                             (rocblas_double_complex*)A,
+                                                             lda,
+                                                             strideA,
+                                                             ipiv,
+                                                             strideP,
+                                                             (rocblas_double_complex*)B,
+                                                             ldb,
+                                                             strideB,
+                                                             info,
+                                                             batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+#endif
+
+} // extern "C"
@@ -20,8 +20,15 @@
  * SOFTWARE.
  *
  * ************************************************************************ */
+#include <hip/hip_runtime_api.h>
 #include <hipblas.h>
 
+#include <algorithm>
+
+#include "exceptions.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_managed.hpp"
+
 // Convert hipblas_status to string
 extern "C" const char* hipblasStatusToString(hipblasStatus_t status)
 {
@@ -48,3 +55,488 @@ extern "C" const char* hipblasStatusToString(hipblasStatus_t status)
     // from our switch. If the value is not a valid hipblas_status, we return this string.
     return "<undefined hipblasStatus_t value>";
 }
+
+// The graph capture mode is kept by hipBLAS for both backends
+extern "C" hipblasStatus_t hipblasSetGraphCaptureMode(hipblasHandle_t           handle,
+                                                      hipblasGraphCaptureMode_t mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_GRAPH_CAPTURE_DEFAULT && mode != HIPBLAS_GRAPH_CAPTURE_SAFE)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    hipblasSetHandleGraphCaptureMode(handle, mode);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetGraphCaptureMode(hipblasHandle_t            handle,
+                                                      hipblasGraphCaptureMode_t* mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *mode = hipblasGetHandleState(handle)->graph_capture_mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// The solver info mode is kept by hipBLAS for both backends
+extern "C" hipblasStatus_t hipblasSetInfoMode(hipblasHandle_t handle, hipblasInfoMode_t mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_INFO_MODE_HOST && mode != HIPBLAS_INFO_MODE_DEVICE)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    hipblasSetHandleInfoMode(handle, mode);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetInfoMode(hipblasHandle_t handle, hipblasInfoMode_t* mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *mode = hipblasGetHandleState(handle)->info_mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// The reproducibility mode is kept by hipBLAS for both backends. It also holds the atomics mode
+// of the backend at HIPBLAS_ATOMICS_NOT_ALLOWED.
+extern "C" hipblasStatus_t hipblasSetReproducibilityMode(hipblasHandle_t              handle,
+                                                         hipblasReproducibilityMode_t mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_REPRODUCIBILITY_DEFAULT && mode != HIPBLAS_REPRODUCIBILITY_BITWISE)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    hipblasHandleState* state = hipblasGetHandleState(handle);
+    if(state->reproducibility_mode == mode)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    if(mode == HIPBLAS_REPRODUCIBILITY_BITWISE)
+    {
+        hipblasAtomicsMode_t atomics_mode;
+        hipblasStatus_t      status = hipblasGetAtomicsMode(handle, &atomics_mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetAtomicsMode(handle, HIPBLAS_ATOMICS_NOT_ALLOWED);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        state->atomics_mode_before_reproducible = atomics_mode;
+        hipblasSetHandleReproducibilityMode(handle, mode);
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // atomics can only be allowed again once the handle has left the mode
+    hipblasSetHandleReproducibilityMode(handle, mode);
+    return hipblasSetAtomicsMode(handle, state->atomics_mode_before_reproducible);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetReproducibilityMode(hipblasHandle_t               handle,
+                                                         hipblasReproducibilityMode_t* mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *mode = hipblasGetHandleState(handle)->reproducibility_mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// The host dispatch mode and thresholds are kept by hipBLAS for both backends
+extern "C" hipblasStatus_t hipblasSetHostDispatchMode(hipblasHandle_t           handle,
+                                                      hipblasHostDispatchMode_t mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_HOST_DISPATCH_NONE && mode != HIPBLAS_HOST_DISPATCH_SMALL)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    hipblasSetHandleHostDispatchMode(handle, mode);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetHostDispatchMode(hipblasHandle_t            handle,
+                                                      hipblasHostDispatchMode_t* mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *mode = hipblasGetHandleState(handle)->host_dispatch_mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasSetHostDispatchThreshold(hipblasHandle_t               handle,
+                                                           hipblasHostDispatchFunction_t function,
+                                                           int64_t                       threshold)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(function < HIPBLAS_HOST_DISPATCH_AXPY || function > HIPBLAS_HOST_DISPATCH_GEMM)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(threshold < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasGetHandleState(handle)->host_dispatch_thresholds[function] = threshold;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetHostDispatchThreshold(hipblasHandle_t               handle,
+                                                           hipblasHostDispatchFunction_t function,
+                                                           int64_t*                      threshold)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(function < HIPBLAS_HOST_DISPATCH_AXPY || function > HIPBLAS_HOST_DISPATCH_GEMM)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(threshold == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *threshold = hipblasGetHandleState(handle)->host_dispatch_thresholds[function];
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// The managed memory prefetch mode is kept by hipBLAS for both backends
+extern "C" hipblasStatus_t hipblasSetManagedPrefetchMode(hipblasHandle_t              handle,
+                                                         hipblasManagedPrefetchMode_t mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_MANAGED_PREFETCH_NONE && mode != HIPBLAS_MANAGED_PREFETCH_DEVICE)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    hipblasSetHandleManagedPrefetchMode(handle, mode);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetManagedPrefetchMode(hipblasHandle_t               handle,
+                                                         hipblasManagedPrefetchMode_t* mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *mode = hipblasGetHandleState(handle)->managed_prefetch_mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// The gemm backend is kept by hipBLAS for both backends, see hipblasIsGemmBackendLt
+extern "C" hipblasStatus_t hipblasSetGemmBackend(hipblasHandle_t      handle,
+                                                 hipblasGemmBackend_t backend)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(backend != HIPBLAS_GEMM_BACKEND_DEFAULT && backend != HIPBLAS_GEMM_BACKEND_LT)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    hipblasSetHandleGemmBackend(handle, backend);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetGemmBackend(hipblasHandle_t       handle,
+                                                 hipblasGemmBackend_t* backend)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(backend == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *backend = hipblasGetHandleState(handle)->gemm_backend;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// The batch layout is kept by hipBLAS for both backends, see hipblas_interleaved_batch.hpp
+extern "C" hipblasStatus_t hipblasSetBatchLayout(hipblasHandle_t      handle,
+                                                 hipblasBatchLayout_t layout)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(layout != HIPBLAS_BATCH_LAYOUT_STRIDED && layout != HIPBLAS_BATCH_LAYOUT_INTERLEAVED)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    hipblasSetHandleBatchLayout(handle, layout);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetBatchLayout(hipblasHandle_t       handle,
+                                                 hipblasBatchLayout_t* layout)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(layout == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *layout = hipblasGetHandleState(handle)->batch_layout;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// The shape dispatch is done by hipBLAS for both backends, see hipblas_shape_dispatch.hpp
+extern "C" hipblasStatus_t hipblasSetShapeDispatchMode(hipblasHandle_t            handle,
+                                                       hipblasShapeDispatchMode_t mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_SHAPE_DISPATCH_NONE && mode != HIPBLAS_SHAPE_DISPATCH_ALLOWED)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    hipblasSetHandleShapeDispatchMode(handle, mode);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetShapeDispatchMode(hipblasHandle_t             handle,
+                                                       hipblasShapeDispatchMode_t* mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *mode = hipblasGetHandleState(handle)->shape_dispatch_mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// The rounding mode is kept by hipBLAS for both backends, see hipblas_rounding.cpp
+extern "C" hipblasStatus_t
+    hipblasSetRoundingMode(hipblasHandle_t handle, hipblasRoundingMode_t mode, uint64_t seed)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_ROUND_NEAREST_EVEN && mode != HIPBLAS_ROUND_TOWARD_ZERO
+       && mode != HIPBLAS_ROUND_STOCHASTIC)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    hipblasSetHandleRoundingMode(handle, mode, seed);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t
+    hipblasGetRoundingMode(hipblasHandle_t handle, hipblasRoundingMode_t* mode, uint64_t* seed)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasHandleState* state = hipblasGetHandleState(handle);
+    *mode                     = state->rounding_mode;
+    if(seed)
+        *seed = state->rounding_seed;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasSetStatisticsMode(hipblasHandle_t         handle,
+                                                    hipblasStatisticsMode_t mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_STATISTICS_NONE && mode != HIPBLAS_STATISTICS_COUNT
+       && mode != HIPBLAS_STATISTICS_TIMED)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    hipblasSetHandleStatisticsMode(handle, mode);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetStatisticsMode(hipblasHandle_t          handle,
+                                                    hipblasStatisticsMode_t* mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *mode = hipblasGetHandleState(handle)->statistics_mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// Columns start on a cache line, and a column stride that is a multiple of the channel
+// interleave would put the same row of every column in one channel of the memory and one set of
+// the caches, so such strides get one more cache line. Both are the same on current AMD and
+// NVIDIA GPUs.
+static constexpr int64_t hipblas_ld_line_bytes   = 128;
+static constexpr int64_t hipblas_ld_period_bytes = 1024;
+
+static int64_t hipblasOptimalLeadingDimension(int64_t rows, int64_t elem_size)
+{
+    int64_t bytes = std::max<int64_t>(rows, 1) * elem_size;
+
+    // matrices of less than a cache line per column aren't worth padding
+    if(bytes < hipblas_ld_line_bytes)
+        return std::max<int64_t>(rows, 1);
+
+    bytes = (bytes + hipblas_ld_line_bytes - 1) / hipblas_ld_line_bytes * hipblas_ld_line_bytes;
+    if(bytes % hipblas_ld_period_bytes == 0)
+        bytes += hipblas_ld_line_bytes;
+    return bytes / elem_size;
+}
+
+extern "C" hipblasStatus_t hipblasGetOptimalLeadingDimension(hipblasHandle_t handle,
+                                                             int64_t         rows,
+                                                             hipDataType     type,
+                                                             int64_t*        ld)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(rows < 0 || ld == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    size_t elem_size = hipblasPrefetchTypeSize(type);
+    if(!elem_size)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    *ld = hipblasOptimalLeadingDimension(rows, elem_size);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t
+    hipblasMallocMatrix(int64_t rows, int64_t cols, hipDataType type, void** ptr, int64_t* ld)
+try
+{
+    if(rows < 0 || cols < 0 || ptr == nullptr || ld == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    size_t elem_size = hipblasPrefetchTypeSize(type);
+    if(!elem_size)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    *ptr = nullptr;
+    *ld  = hipblasOptimalLeadingDimension(rows, elem_size);
+    if(!rows || !cols)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    // hipMalloc aligns allocations to at least 256 bytes
+    if(hipMalloc(ptr, size_t(*ld) * cols * elem_size) != hipSuccess)
+    {
+        *ptr = nullptr;
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
@@ -0,0 +1,1206 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_entry.hpp"
+
+// The batched tridiagonal solver gtsv and the banded LU factorization and solve gbtrf and gbtrs.
+// Neither rocSOLVER nor cuSOLVER has batched versions of these, so they are kernels of hipBLAS
+// for both backends, each a single launch for the whole batch.
+//
+// gtsv solves without pivoting, for the diagonally dominant systems of implicit time stepping.
+// A strided batch of single right-hand sides of up to hipblas_gtsv_pcr_max equations is solved
+// by parallel cyclic reduction, a system per block with a thread per equation, in shared
+// memory. Everything else, and the interleaved layout, where element i of system b is at
+// i * batchCount + b, is solved by the Thomas algorithm with a thread per system, which reads
+// the interleaved layout coalesced.
+//
+// gbtrf is LAPACK gbtf2, with partial pivoting, and gbtrs is LAPACK gbtrs, with a thread per
+// system, or per right-hand side of a system, as the bands of these are narrow.
+
+namespace
+{
+    constexpr int hipblas_band_threads = 128;
+
+    // The most equations of the systems that gtsv solves by parallel cyclic reduction
+    constexpr int hipblas_gtsv_pcr_max = 512;
+
+    template <typename T>
+    __device__ inline T hipblas_band_mul(T a, T b)
+    {
+        if constexpr(std::is_same_v<T, hipFloatComplex>)
+            return hipCmulf(a, b);
+        else if constexpr(std::is_same_v<T, hipDoubleComplex>)
+            return hipCmul(a, b);
+        else
+            return a * b;
+    }
+
+    template <typename T>
+    __device__ inline T hipblas_band_div(T a, T b)
+    {
+        if constexpr(std::is_same_v<T, hipFloatComplex>)
+            return hipCdivf(a, b);
+        else if constexpr(std::is_same_v<T, hipDoubleComplex>)
+            return hipCdiv(a, b);
+        else
+            return a / b;
+    }
+
+    template <typename T>
+    __device__ inline T hipblas_band_sub(T a, T b)
+    {
+        if constexpr(std::is_same_v<T, hipFloatComplex>)
+            return hipCsubf(a, b);
+        else if constexpr(std::is_same_v<T, hipDoubleComplex>)
+            return hipCsub(a, b);
+        else
+            return a - b;
+    }
+
+    // c - a * b
+    template <typename T>
+    __device__ inline T hipblas_band_fms(T a, T b, T c)
+    {
+        return hipblas_band_sub(c, hipblas_band_mul(a, b));
+    }
+
+    // |re(a)| + |im(a)|, by which LAPACK picks the pivots
+    template <typename T>
+    __device__ inline auto hipblas_band_abs1(T a)
+    {
+        if constexpr(std::is_arithmetic_v<T>)
+            return fabs(a);
+        else
+            return fabs(a.x) + fabs(a.y);
+    }
+
+    template <typename T>
+    __device__ inline T hipblas_band_zero()
+    {
+        return hipblas_band_sub(hipblas_device_one<T>(), hipblas_device_one<T>());
+    }
+
+    template <typename T>
+    __device__ inline void hipblas_band_swap(T& a, T& b)
+    {
+        T t = a;
+        a   = b;
+        b   = t;
+    }
+
+    // A system of gtsv is dl, d and du of n elements each, at inc from one to the next and
+    // stride from one system to the next, and its right-hand sides are the columns of B, whose
+    // elements are at incb, columns at ldb and systems at stride_b. dl[0] and du[n - 1] are not
+    // referenced.
+    struct hipblas_gtsv_problem
+    {
+        int           n;
+        int           nrhs;
+        const void*   dl;
+        void*         d;
+        void*         du;
+        int64_t       inc;
+        hipblasStride stride;
+        void*         B;
+        int64_t       incb;
+        int64_t       ldb;
+        hipblasStride stride_b;
+        int64_t       batch_count;
+    };
+
+    // One system per thread. The forward sweep leaves the reciprocals of the pivots in d and the
+    // multipliers of the superdiagonal in du, which are then applied to each right-hand side.
+    template <typename T>
+    __global__ void __launch_bounds__(hipblas_band_threads)
+        hipblasGtsvThomasKernel(hipblas_gtsv_problem problem)
+    {
+        const int     n   = problem.n;
+        const int64_t inc = problem.inc;
+
+        for(int64_t b = int64_t(blockIdx.x) * blockDim.x + threadIdx.x; b < problem.batch_count;
+            b += int64_t(gridDim.x) * blockDim.x)
+        {
+            const T* dl = static_cast<const T*>(problem.dl) + b * problem.stride;
+            T*       d  = static_cast<T*>(problem.d) + b * problem.stride;
+            T*       du = static_cast<T*>(problem.du) + b * problem.stride;
+
+            T rw = hipblas_band_div(hipblas_device_one<T>(), d[0]);
+            d[0] = rw;
+            for(int i = 1; i < n; i++)
+            {
+                du[(i - 1) * inc] = hipblas_band_mul(du[(i - 1) * inc], rw);
+                rw = hipblas_band_div(hipblas_device_one<T>(),
+                                      hipblas_band_fms(dl[i * inc], du[(i - 1) * inc], d[i * inc]));
+                d[i * inc] = rw;
+            }
+
+            for(int r = 0; r < problem.nrhs; r++)
+            {
+                T* x = static_cast<T*>(problem.B) + b * problem.stride_b + r * problem.ldb;
+
+                T y = hipblas_band_mul(x[0], d[0]);
+                x[0] = y;
+                for(int i = 1; i < n; i++)
+                {
+                    y = hipblas_band_mul(hipblas_band_fms(dl[i * inc], y, x[i * problem.incb]),
+                                         d[i * inc]);
+                    x[i * problem.incb] = y;
+                }
+                for(int i = n - 2; i >= 0; i--)
+                {
+                    y = hipblas_band_fms(du[i * inc], y, x[i * problem.incb]);
+                    x[i * problem.incb] = y;
+                }
+            }
+        }
+    }
+
+    // One system of a single right-hand side per block, a thread per equation. Each step of the
+    // reduction eliminates the couplings of every equation to the equations s before and after
+    // it, with s doubling, until the equations are decoupled. dl, d and du are not written.
+    template <typename T>
+    __global__ void __launch_bounds__(hipblas_gtsv_pcr_max)
+        hipblasGtsvPcrKernel(hipblas_gtsv_problem problem)
+    {
+        __shared__ T a[hipblas_gtsv_pcr_max];
+        __shared__ T c[hipblas_gtsv_pcr_max];
+        __shared__ T dg[hipblas_gtsv_pcr_max];
+        __shared__ T r[hipblas_gtsv_pcr_max];
+
+        const int i = threadIdx.x;
+        const int n = problem.n;
+
+        for(int64_t b = blockIdx.x; b < problem.batch_count; b += gridDim.x)
+        {
+            const T* dl = static_cast<const T*>(problem.dl) + b * problem.stride;
+            const T* d  = static_cast<const T*>(problem.d) + b * problem.stride;
+            const T* du = static_cast<const T*>(problem.du) + b * problem.stride;
+            T*       x  = static_cast<T*>(problem.B) + b * problem.stride_b;
+
+            if(i < n)
+            {
+                a[i]  = i > 0 ? dl[i] : hipblas_band_zero<T>();
+                c[i]  = i < n - 1 ? du[i] : hipblas_band_zero<T>();
+                dg[i] = d[i];
+                r[i]  = x[i];
+            }
+            __syncthreads();
+
+            for(int s = 1; s < n; s *= 2)
+            {
+                T ai = hipblas_band_zero<T>(), ci = ai, di = ai, ri = ai;
+                if(i < n)
+                {
+                    di = dg[i];
+                    ri = r[i];
+                    if(i >= s)
+                    {
+                        T k1 = hipblas_band_div(a[i], dg[i - s]);
+                        ai   = hipblas_band_fms(a[i - s], k1, ai);
+                        di   = hipblas_band_fms(c[i - s], k1, di);
+                        ri   = hipblas_band_fms(r[i - s], k1, ri);
+                    }
+                    if(i + s < n)
+                    {
+                        T k2 = hipblas_band_div(c[i], dg[i + s]);
+                        ci   = hipblas_band_fms(c[i + s], k2, ci);
+                        di   = hipblas_band_fms(a[i + s], k2, di);
+                        ri   = hipblas_band_fms(r[i + s], k2, ri);
+                    }
+                }
+                __syncthreads();
+                if(i < n)
+                {
+                    a[i]  = ai;
+                    c[i]  = ci;
+                    dg[i] = di;
+                    r[i]  = ri;
+                }
+                __syncthreads();
+            }
+
+            if(i < n)
+                x[i] = hipblas_band_div(r[i], dg[i]);
+            __syncthreads();
+        }
+    }
+
+    // The band of each matrix is in LAPACK band storage, A(i, j) in AB[kl + ku + i - j + j * ldab],
+    // with the first kl rows for the fill-in of the pivoting.
+    struct hipblas_gbtrf_problem
+    {
+        int          n;
+        int          kl;
+        int          ku;
+        void* const* AB;
+        int64_t      ldab;
+        int*         ipiv;
+        int*         info;
+        int64_t      batch_count;
+    };
+
+    template <typename T>
+    __global__ void __launch_bounds__(hipblas_band_threads)
+        hipblasGbtrfKernel(hipblas_gbtrf_problem problem)
+    {
+        const int     n    = problem.n;
+        const int     kl   = problem.kl;
+        const int     ku   = problem.ku;
+        const int     kv   = kl + ku;
+        const int64_t ldab = problem.ldab;
+
+        for(int64_t b = int64_t(blockIdx.x) * blockDim.x + threadIdx.x; b < problem.batch_count;
+            b += int64_t(gridDim.x) * blockDim.x)
+        {
+            T*   AB   = static_cast<T*>(problem.AB[b]);
+            int* ipiv = problem.ipiv + b * n;
+            int  info = 0;
+
+            auto ab = [=](int i, int j) -> T& { return AB[i + j * ldab]; };
+
+            // the fill-in of the columns that no earlier column is swapped into
+            for(int j = ku + 1; j < std::min(kv, n); j++)
+                for(int i = kv - j; i < kl; i++)
+                    ab(i, j) = hipblas_band_zero<T>();
+
+            int ju = 0;
+            for(int j = 0; j < n; j++)
+            {
+                if(j + kv < n)
+                    for(int i = 0; i < kl; i++)
+                        ab(i, j + kv) = hipblas_band_zero<T>();
+
+                int  km  = std::min(kl, n - 1 - j);
+                int  jp  = 0;
+                auto big = hipblas_band_abs1(ab(kv, j));
+                for(int i = 1; i <= km; i++)
+                {
+                    auto v = hipblas_band_abs1(ab(kv + i, j));
+                    if(v > big)
+                    {
+                        big = v;
+                        jp  = i;
+                    }
+                }
+                ipiv[j] = j + jp + 1;
+
+                if(hipblas_device_is_zero(ab(kv + jp, j)))
+                {
+                    if(!info)
+                        info = j + 1;
+                    continue;
+                }
+
+                ju = std::max(ju, std::min(j + ku + jp, n - 1));
+                if(jp)
+                    for(int c = 0; c <= ju - j; c++)
+                        hipblas_band_swap(ab(kv + jp - c, j + c), ab(kv - c, j + c));
+
+                T rp = hipblas_band_div(hipblas_device_one<T>(), ab(kv, j));
+                for(int i = 1; i <= km; i++)
+                    ab(kv + i, j) = hipblas_band_mul(ab(kv + i, j), rp);
+                for(int c = 1; c <= ju - j; c++)
+                {
+                    T y = ab(kv - c, j + c);
+                    for(int i = 1; i <= km; i++)
+                        ab(kv + i - c, j + c)
+                            = hipblas_band_fms(ab(kv + i, j), y, ab(kv + i - c, j + c));
+                }
+            }
+            problem.info[b] = info;
+        }
+    }
+
+    struct hipblas_gbtrs_problem
+    {
+        bool         trans;
+        bool         conj;
+        int          n;
+        int          kl;
+        int          ku;
+        int          nrhs;
+        void* const* AB;
+        int64_t      ldab;
+        const int*   ipiv;
+        void* const* B;
+        int64_t      ldb;
+        int64_t      batch_count;
+    };
+
+    // One right-hand side of one system per thread
+    template <typename T>
+    __global__ void __launch_bounds__(hipblas_band_threads)
+        hipblasGbtrsKernel(hipblas_gbtrs_problem problem)
+    {
+        const int     n    = problem.n;
+        const int     kl   = problem.kl;
+        const int     kv   = problem.kl + problem.ku;
+        const int64_t ldab = problem.ldab;
+        const int64_t rhs  = problem.batch_count * problem.nrhs;
+
+        for(int64_t t = int64_t(blockIdx.x) * blockDim.x + threadIdx.x; t < rhs;
+            t += int64_t(gridDim.x) * blockDim.x)
+        {
+            int64_t    b    = t / problem.nrhs;
+            const T*   AB   = static_cast<const T*>(problem.AB[b]);
+            const int* ipiv = problem.ipiv + b * n;
+            T*         x    = static_cast<T*>(problem.B[b]) + (t % problem.nrhs) * problem.ldb;
+
+            auto ab = [=](int i, int j) {
+                T v = AB[i + j * ldab];
+                return problem.conj ? hipblas_device_conj(v) : v;
+            };
+
+            if(!problem.trans)
+            {
+                // L, with the interchanges, and then U
+                for(int j = 0; j < n - 1; j++)
+                {
+                    int l = ipiv[j] - 1;
+                    if(l != j)
+                        hipblas_band_swap(x[l], x[j]);
+                    for(int i = 1; i <= std::min(kl, n - 1 - j); i++)
+                        x[j + i] = hipblas_band_fms(ab(kv + i, j), x[j], x[j + i]);
+                }
+                for(int j = n - 1; j >= 0; j--)
+                {
+                    x[j] = hipblas_band_div(x[j], ab(kv, j));
+                    for(int i = std::max(0, j - kv); i < j; i++)
+                        x[i] = hipblas_band_fms(ab(kv + i - j, j), x[j], x[i]);
+                }
+            }
+            else
+            {
+                // U^T, and then L^T with the interchanges in reverse
+                for(int j = 0; j < n; j++)
+                {
+                    T y = x[j];
+                    for(int i = std::max(0, j - kv); i < j; i++)
+                        y = hipblas_band_fms(ab(kv + i - j, j), x[i], y);
+                    x[j] = hipblas_band_div(y, ab(kv, j));
+                }
+                for(int j = n - 2; j >= 0; j--)
+                {
+                    T y = x[j];
+                    for(int i = 1; i <= std::min(kl, n - 1 - j); i++)
+                        y = hipblas_band_fms(ab(kv + i, j), x[j + i], y);
+                    x[j]  = y;
+                    int l = ipiv[j] - 1;
+                    if(l != j)
+                        hipblas_band_swap(x[l], x[j]);
+                }
+            }
+        }
+    }
+
+    hipblasStatus_t hipblas_band_launched()
+    {
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    // The blocks of hipblas_band_threads for a thread per item
+    int hipblas_band_blocks(int64_t items)
+    {
+        return int(std::min<int64_t>((items - 1) / hipblas_band_threads + 1, 65535));
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblas_gtsv(hipblasHandle_t handle,
+                                 int64_t         n,
+                                 int64_t         nrhs,
+                                 const void*     dl,
+                                 void*           d,
+                                 void*           du,
+                                 hipblasStride   stride,
+                                 void*           B,
+                                 int64_t         ldb,
+                                 hipblasStride   stride_b,
+                                 int64_t         batch_count,
+                                 bool            interleaved)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(n < 0 || nrhs < 0 || batch_count < 0 || (!interleaved && ldb < std::max<int64_t>(n, 1)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!n || !nrhs || !batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!dl || !d || !du || !B)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipblas_gtsv_problem problem;
+        problem.n           = int(n);
+        problem.nrhs        = int(nrhs);
+        problem.dl          = dl;
+        problem.d           = d;
+        problem.du          = du;
+        problem.inc         = interleaved ? batch_count : 1;
+        problem.stride      = interleaved ? 1 : stride;
+        problem.B           = B;
+        problem.incb        = interleaved ? batch_count : 1;
+        problem.ldb         = interleaved ? n * batch_count : ldb;
+        problem.stride_b    = interleaved ? 1 : stride_b;
+        problem.batch_count = batch_count;
+
+        if(!interleaved && nrhs == 1 && n <= hipblas_gtsv_pcr_max)
+        {
+            int blocks = int(std::min<int64_t>(batch_count, 65535));
+            hipblasGtsvPcrKernel<T><<<blocks, hipblas_gtsv_pcr_max, 0, stream>>>(problem);
+        }
+        else
+            hipblasGtsvThomasKernel<T>
+                <<<hipblas_band_blocks(batch_count), hipblas_band_threads, 0, stream>>>(problem);
+        return hipblas_band_launched();
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblas_gbtrf(hipblasHandle_t    handle,
+                                  int64_t            n,
+                                  int64_t            kl,
+                                  int64_t            ku,
+                                  const void* const* AB,
+                                  int64_t            ldab,
+                                  int*               ipiv,
+                                  int*               info,
+                                  int64_t            batch_count)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(n < 0 || kl < 0 || ku < 0 || ldab < 2 * kl + ku + 1 || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+        if((n && (!AB || !ipiv)) || !info)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        if(!n)
+            return hipMemsetAsync(info, 0, batch_count * sizeof(int), stream) == hipSuccess
+                       ? HIPBLAS_STATUS_SUCCESS
+                       : HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        hipblas_gbtrf_problem problem;
+        problem.n           = int(n);
+        problem.kl          = int(kl);
+        problem.ku          = int(ku);
+        problem.AB          = const_cast<void* const*>(AB);
+        problem.ldab        = ldab;
+        problem.ipiv        = ipiv;
+        problem.info        = info;
+        problem.batch_count = batch_count;
+        hipblasGbtrfKernel<T>
+            <<<hipblas_band_blocks(batch_count), hipblas_band_threads, 0, stream>>>(problem);
+        return hipblas_band_launched();
+    }
+
+    // info is on the host, and is the position of the first invalid argument, negated, as for
+    // getrs
+    template <typename T>
+    hipblasStatus_t hipblas_gbtrs(hipblasHandle_t    handle,
+                                  hipblasOperation_t trans,
+                                  int64_t            n,
+                                  int64_t            kl,
+                                  int64_t            ku,
+                                  int64_t            nrhs,
+                                  const void* const* AB,
+                                  int64_t            ldab,
+                                  const int*         ipiv,
+                                  const void* const* B,
+                                  int64_t            ldb,
+                                  int*               info,
+                                  int64_t            batch_count)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!info)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+            *info = -1;
+        else if(n < 0)
+            *info = -2;
+        else if(kl < 0)
+            *info = -3;
+        else if(ku < 0)
+            *info = -4;
+        else if(nrhs < 0)
+            *info = -5;
+        else if(!AB && n)
+            *info = -6;
+        else if(ldab < 2 * kl + ku + 1)
+            *info = -7;
+        else if(!ipiv && n)
+            *info = -8;
+        else if(!B && n && nrhs)
+            *info = -9;
+        else if(ldb < std::max<int64_t>(n, 1))
+            *info = -10;
+        else if(batch_count < 0)
+            *info = -12;
+        else
+            *info = 0;
+
+        if(*info)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!n || !nrhs || !batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipblas_gbtrs_problem problem;
+        problem.trans       = trans != HIPBLAS_OP_N;
+        problem.conj        = trans == HIPBLAS_OP_C && !std::is_arithmetic_v<T>;
+        problem.n           = int(n);
+        problem.kl          = int(kl);
+        problem.ku          = int(ku);
+        problem.nrhs        = int(nrhs);
+        problem.AB          = const_cast<void* const*>(AB);
+        problem.ldab        = ldab;
+        problem.ipiv        = ipiv;
+        problem.B           = const_cast<void* const*>(B);
+        problem.ldb         = ldb;
+        problem.batch_count = batch_count;
+        hipblasGbtrsKernel<T><<<hipblas_band_blocks(batch_count * nrhs),
+                                hipblas_band_threads,
+                                0,
+                                stream>>>(problem);
+        return hipblas_band_launched();
+    }
+}
+
+extern "C" hipblasStatus_t hipblasSgtsvStridedBatched(hipblasHandle_t     handle,
+                                                      const int           n,
+                                                      const int           nrhs,
+                                                      const float*        dl,
+                                                      float*              d,
+                                                      float*              du,
+                                                      const hipblasStride strideD,
+                                                      float*              B,
+                                                      const int           ldb,
+                                                      const hipblasStride strideB,
+                                                      const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, ldb, strideD, strideB, batchCount);
+
+    return hipblas_gtsv<float>(
+        handle, n, nrhs, dl, d, du, strideD, B, ldb, strideB, batchCount, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgtsvStridedBatched(hipblasHandle_t     handle,
+                                                      const int           n,
+                                                      const int           nrhs,
+                                                      const double*       dl,
+                                                      double*             d,
+                                                      double*             du,
+                                                      const hipblasStride strideD,
+                                                      double*             B,
+                                                      const int           ldb,
+                                                      const hipblasStride strideB,
+                                                      const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, ldb, strideD, strideB, batchCount);
+
+    return hipblas_gtsv<double>(
+        handle, n, nrhs, dl, d, du, strideD, B, ldb, strideB, batchCount, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgtsvStridedBatched(hipblasHandle_t       handle,
+                                                      const int             n,
+                                                      const int             nrhs,
+                                                      const hipblasComplex* dl,
+                                                      hipblasComplex*       d,
+                                                      hipblasComplex*       du,
+                                                      const hipblasStride   strideD,
+                                                      hipblasComplex*       B,
+                                                      const int             ldb,
+                                                      const hipblasStride   strideB,
+                                                      const int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, ldb, strideD, strideB, batchCount);
+
+    return hipblas_gtsv<hipFloatComplex>(
+        handle, n, nrhs, dl, d, du, strideD, B, ldb, strideB, batchCount, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgtsvStridedBatched(hipblasHandle_t             handle,
+                                                      const int                   n,
+                                                      const int                   nrhs,
+                                                      const hipblasDoubleComplex* dl,
+                                                      hipblasDoubleComplex*       d,
+                                                      hipblasDoubleComplex*       du,
+                                                      const hipblasStride         strideD,
+                                                      hipblasDoubleComplex*       B,
+                                                      const int                   ldb,
+                                                      const hipblasStride         strideB,
+                                                      const int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, ldb, strideD, strideB, batchCount);
+
+    return hipblas_gtsv<hipDoubleComplex>(
+        handle, n, nrhs, dl, d, du, strideD, B, ldb, strideB, batchCount, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgtsvStridedBatched_v2(hipblasHandle_t     handle,
+                                                         const int           n,
+                                                         const int           nrhs,
+                                                         const hipComplex*   dl,
+                                                         hipComplex*         d,
+                                                         hipComplex*         du,
+                                                         const hipblasStride strideD,
+                                                         hipComplex*         B,
+                                                         const int           ldb,
+                                                         const hipblasStride strideB,
+                                                         const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, ldb, strideD, strideB, batchCount);
+
+    return hipblas_gtsv<hipFloatComplex>(
+        handle, n, nrhs, dl, d, du, strideD, B, ldb, strideB, batchCount, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgtsvStridedBatched_v2(hipblasHandle_t         handle,
+                                                         const int               n,
+                                                         const int               nrhs,
+                                                         const hipDoubleComplex* dl,
+                                                         hipDoubleComplex*       d,
+                                                         hipDoubleComplex*       du,
+                                                         const hipblasStride     strideD,
+                                                         hipDoubleComplex*       B,
+                                                         const int               ldb,
+                                                         const hipblasStride     strideB,
+                                                         const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, ldb, strideD, strideB, batchCount);
+
+    return hipblas_gtsv<hipDoubleComplex>(
+        handle, n, nrhs, dl, d, du, strideD, B, ldb, strideB, batchCount, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasSgtsvInterleavedBatch(hipblasHandle_t handle,
+                                                        const int       n,
+                                                        const int       nrhs,
+                                                        const float*    dl,
+                                                        float*          d,
+                                                        float*          du,
+                                                        float*          B,
+                                                        const int       batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, batchCount);
+
+    return hipblas_gtsv<float>(handle, n, nrhs, dl, d, du, 0, B, 0, 0, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgtsvInterleavedBatch(hipblasHandle_t handle,
+                                                        const int       n,
+                                                        const int       nrhs,
+                                                        const double*   dl,
+                                                        double*         d,
+                                                        double*         du,
+                                                        double*         B,
+                                                        const int       batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, batchCount);
+
+    return hipblas_gtsv<double>(handle, n, nrhs, dl, d, du, 0, B, 0, 0, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgtsvInterleavedBatch(hipblasHandle_t       handle,
+                                                        const int             n,
+                                                        const int             nrhs,
+                                                        const hipblasComplex* dl,
+                                                        hipblasComplex*       d,
+                                                        hipblasComplex*       du,
+                                                        hipblasComplex*       B,
+                                                        const int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, batchCount);
+
+    return hipblas_gtsv<hipFloatComplex>(handle, n, nrhs, dl, d, du, 0, B, 0, 0, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgtsvInterleavedBatch(hipblasHandle_t             handle,
+                                                        const int                   n,
+                                                        const int                   nrhs,
+                                                        const hipblasDoubleComplex* dl,
+                                                        hipblasDoubleComplex*       d,
+                                                        hipblasDoubleComplex*       du,
+                                                        hipblasDoubleComplex*       B,
+                                                        const int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, batchCount);
+
+    return hipblas_gtsv<hipDoubleComplex>(handle, n, nrhs, dl, d, du, 0, B, 0, 0, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgtsvInterleavedBatch_v2(hipblasHandle_t   handle,
+                                                           const int         n,
+                                                           const int         nrhs,
+                                                           const hipComplex* dl,
+                                                           hipComplex*       d,
+                                                           hipComplex*       du,
+                                                           hipComplex*       B,
+                                                           const int         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, batchCount);
+
+    return hipblas_gtsv<hipFloatComplex>(handle, n, nrhs, dl, d, du, 0, B, 0, 0, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgtsvInterleavedBatch_v2(hipblasHandle_t         handle,
+                                                           const int               n,
+                                                           const int               nrhs,
+                                                           const hipDoubleComplex* dl,
+                                                           hipDoubleComplex*       d,
+                                                           hipDoubleComplex*       du,
+                                                           hipDoubleComplex*       B,
+                                                           const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, batchCount);
+
+    return hipblas_gtsv<hipDoubleComplex>(handle, n, nrhs, dl, d, du, 0, B, 0, 0, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasSgbtrfBatched(hipblasHandle_t handle,
+                                                const int       n,
+                                                const int       kl,
+                                                const int       ku,
+                                                float* const    AB[],
+                                                const int       ldab,
+                                                int*            ipiv,
+                                                int*            info,
+                                                const int       batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, kl, ku, ldab, batchCount);
+
+    return hipblas_gbtrf<float>(
+        handle, n, kl, ku, (const void* const*)AB, ldab, ipiv, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgbtrfBatched(hipblasHandle_t handle,
+                                                const int       n,
+                                                const int       kl,
+                                                const int       ku,
+                                                double* const   AB[],
+                                                const int       ldab,
+                                                int*            ipiv,
+                                                int*            info,
+                                                const int       batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, kl, ku, ldab, batchCount);
+
+    return hipblas_gbtrf<double>(
+        handle, n, kl, ku, (const void* const*)AB, ldab, ipiv, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgbtrfBatched(hipblasHandle_t       handle,
+                                                const int             n,
+                                                const int             kl,
+                                                const int             ku,
+                                                hipblasComplex* const AB[],
+                                                const int             ldab,
+                                                int*                  ipiv,
+                                                int*                  info,
+                                                const int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, kl, ku, ldab, batchCount);
+
+    return hipblas_gbtrf<hipFloatComplex>(
+        handle, n, kl, ku, (const void* const*)AB, ldab, ipiv, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgbtrfBatched(hipblasHandle_t             handle,
+                                                const int                   n,
+                                                const int                   kl,
+                                                const int                   ku,
+                                                hipblasDoubleComplex* const AB[],
+                                                const int                   ldab,
+                                                int*                        ipiv,
+                                                int*                        info,
+                                                const int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, kl, ku, ldab, batchCount);
+
+    return hipblas_gbtrf<hipDoubleComplex>(
+        handle, n, kl, ku, (const void* const*)AB, ldab, ipiv, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgbtrfBatched_v2(hipblasHandle_t   handle,
+                                                   const int         n,
+                                                   const int         kl,
+                                                   const int         ku,
+                                                   hipComplex* const AB[],
+                                                   const int         ldab,
+                                                   int*              ipiv,
+                                                   int*              info,
+                                                   const int         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, kl, ku, ldab, batchCount);
+
+    return hipblas_gbtrf<hipFloatComplex>(
+        handle, n, kl, ku, (const void* const*)AB, ldab, ipiv, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgbtrfBatched_v2(hipblasHandle_t         handle,
+                                                   const int               n,
+                                                   const int               kl,
+                                                   const int               ku,
+                                                   hipDoubleComplex* const AB[],
+                                                   const int               ldab,
+                                                   int*                    ipiv,
+                                                   int*                    info,
+                                                   const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, kl, ku, ldab, batchCount);
+
+    return hipblas_gbtrf<hipDoubleComplex>(
+        handle, n, kl, ku, (const void* const*)AB, ldab, ipiv, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasSgbtrsBatched(hipblasHandle_t          handle,
+                                                const hipblasOperation_t trans,
+                                                const int                n,
+                                                const int                kl,
+                                                const int                ku,
+                                                const int                nrhs,
+                                                float* const             AB[],
+                                                const int                ldab,
+                                                const int*               ipiv,
+                                                float* const             B[],
+                                                const int                ldb,
+                                                int*                     info,
+                                                const int                batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, kl, ku, nrhs, ldab, ldb, batchCount);
+
+    return hipblas_gbtrs<float>(handle,
+                                trans,
+                                n,
+                                kl,
+                                ku,
+                                nrhs,
+                                (const void* const*)AB,
+                                ldab,
+                                ipiv,
+                                (const void* const*)B,
+                                ldb,
+                                info,
+                                batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgbtrsBatched(hipblasHandle_t          handle,
+                                                const hipblasOperation_t trans,
+                                                const int                n,
+                                                const int                kl,
+                                                const int                ku,
+                                                const int                nrhs,
+                                                double* const            AB[],
+                                                const int                ldab,
+                                                const int*               ipiv,
+                                                double* const            B[],
+                                                const int                ldb,
+                                                int*                     info,
+                                                const int                batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, kl, ku, nrhs, ldab, ldb, batchCount);
+
+    return hipblas_gbtrs<double>(handle,
+                                 trans,
+                                 n,
+                                 kl,
+                                 ku,
+                                 nrhs,
+                                 (const void* const*)AB,
+                                 ldab,
+                                 ipiv,
+                                 (const void* const*)B,
+                                 ldb,
+                                 info,
+                                 batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgbtrsBatched(hipblasHandle_t          handle,
+                                                const hipblasOperation_t trans,
+                                                const int                n,
+                                                const int                kl,
+                                                const int                ku,
+                                                const int                nrhs,
+                                                hipblasComplex* const    AB[],
+                                                const int                ldab,
+                                                const int*               ipiv,
+                                                hipblasComplex* const    B[],
+                                                const int                ldb,
+                                                int*                     info,
+                                                const int                batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, kl, ku, nrhs, ldab, ldb, batchCount);
+
+    return hipblas_gbtrs<hipFloatComplex>(handle,
+                                          trans,
+                                          n,
+                                          kl,
+                                          ku,
+                                          nrhs,
+                                          (const void* const*)AB,
+                                          ldab,
+                                          ipiv,
+                                          (const void* const*)B,
+                                          ldb,
+                                          info,
+                                          batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgbtrsBatched(hipblasHandle_t             handle,
+                                                const hipblasOperation_t    trans,
+                                                const int                   n,
+                                                const int                   kl,
+                                                const int                   ku,
+                                                const int                   nrhs,
+                                                hipblasDoubleComplex* const AB[],
+                                                const int                   ldab,
+                                                const int*                  ipiv,
+                                                hipblasDoubleComplex* const B[],
+                                                const int                   ldb,
+                                                int*                        info,
+                                                const int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, kl, ku, nrhs, ldab, ldb, batchCount);
+
+    return hipblas_gbtrs<hipDoubleComplex>(handle,
+                                           trans,
+                                           n,
+                                           kl,
+                                           ku,
+                                           nrhs,
+                                           (const void* const*)AB,
+                                           ldab,
+                                           ipiv,
+                                           (const void* const*)B,
+                                           ldb,
+                                           info,
+                                           batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgbtrsBatched_v2(hipblasHandle_t          handle,
+                                                   const hipblasOperation_t trans,
+                                                   const int                n,
+                                                   const int                kl,
+                                                   const int                ku,
+                                                   const int                nrhs,
+                                                   hipComplex* const        AB[],
+                                                   const int                ldab,
+                                                   const int*               ipiv,
+                                                   hipComplex* const        B[],
+                                                   const int                ldb,
+                                                   int*                     info,
+                                                   const int                batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, kl, ku, nrhs, ldab, ldb, batchCount);
+
+    return hipblas_gbtrs<hipFloatComplex>(handle,
+                                          trans,
+                                          n,
+                                          kl,
+                                          ku,
+                                          nrhs,
+                                          (const void* const*)AB,
+                                          ldab,
+                                          ipiv,
+                                          (const void* const*)B,
+                                          ldb,
+                                          info,
+                                          batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgbtrsBatched_v2(hipblasHandle_t          handle,
+                                                   const hipblasOperation_t trans,
+                                                   const int                n,
+                                                   const int                kl,
+                                                   const int                ku,
+                                                   const int                nrhs,
+                                                   hipDoubleComplex* const  AB[],
+                                                   const int                ldab,
+                                                   const int*               ipiv,
+                                                   hipDoubleComplex* const  B[],
+                                                   const int                ldb,
+                                                   int*                     info,
+                                                   const int                batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, kl, ku, nrhs, ldab, ldb, batchCount);
+
+    return hipblas_gbtrs<hipDoubleComplex>(handle,
+                                           trans,
+                                           n,
+                                           kl,
+                                           ku,
+                                           nrhs,
+                                           (const void* const*)AB,
+                                           ldab,
+                                           ipiv,
+                                           (const void* const*)B,
+                                           ldb,
+                                           info,
+                                           batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
@@ -0,0 +1,489 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include "exceptions.hpp"
+#include "hipblas_batched_blas3.hpp"
+#include "hipblas_device_scalars.hpp"
+
+// The batched geam and dgmm of the NVIDIA backend, and the symmetrized matrices of its strided
+// batched symm and hemm, for which cuBLAS has no batched functions. A block covers a tile of 32
+// by 32 elements of every matrix of the batch with 32 by 8 threads, striding over the columns
+// and the batch when the grid can't cover them. The transposed tiles of geam are staged through
+// shared memory, padded against bank conflicts, so that its loads and stores are coalesced.
+
+namespace
+{
+    constexpr int hipblas_batched_blas3_tile = 32;
+    constexpr int hipblas_batched_blas3_rows = 8;
+
+    // The matrix b of a batch, from an array of pointers or at a stride from the first one
+    template <typename T>
+    __device__ inline T*
+        hipblas_batched_blas3_matrix(const void* X, hipblasStride stride, bool batched, int64_t b)
+    {
+        if(batched)
+            return static_cast<T* const*>(const_cast<void*>(X))[b];
+        return static_cast<T*>(const_cast<void*>(X)) + b * stride;
+    }
+
+    // x * y
+    template <typename T>
+    __device__ inline T hipblas_batched_blas3_mul(T x, T y)
+    {
+        return hipblas_device_axpby(x, y, T{}, T{});
+    }
+
+    // x with no imaginary part
+    template <typename T>
+    __device__ inline T hipblas_batched_blas3_real(T x)
+    {
+        return x;
+    }
+
+    __device__ inline hipFloatComplex hipblas_batched_blas3_real(hipFloatComplex x)
+    {
+        return make_hipFloatComplex(hipCrealf(x), 0);
+    }
+
+    __device__ inline hipDoubleComplex hipblas_batched_blas3_real(hipDoubleComplex x)
+    {
+        return make_hipDoubleComplex(hipCreal(x), 0);
+    }
+
+    dim3 hipblas_batched_blas3_grid(int64_t m, int64_t n, int64_t batch_count)
+    {
+        return dim3((m - 1) / hipblas_batched_blas3_tile + 1,
+                    std::min<int64_t>((n - 1) / hipblas_batched_blas3_tile + 1, 65535),
+                    std::min<int64_t>(batch_count, 65535));
+    }
+
+    // Loads the tile of op(X) at rows i0 and columns j0 into tile, with tile[tx][ty] being
+    // op(X)(i0 + tx, j0 + ty) either way, read in columns of X
+    template <typename T>
+    __device__ inline void
+        hipblas_batched_geam_load(T (*tile)[hipblas_batched_blas3_tile + 1],
+                                  const T*           X,
+                                  int64_t            ldx,
+                                  hipblasOperation_t trans,
+                                  int64_t            m,
+                                  int64_t            n,
+                                  int64_t            i0,
+                                  int64_t            j0)
+    {
+        int tx = threadIdx.x;
+        for(int ty = threadIdx.y; ty < hipblas_batched_blas3_tile; ty += hipblas_batched_blas3_rows)
+        {
+            if(trans == HIPBLAS_OP_N)
+            {
+                int64_t i = i0 + tx, j = j0 + ty;
+                if(i < m && j < n)
+                    tile[tx][ty] = X[i + j * ldx];
+            }
+            else
+            {
+                // op(X)(i, j) is X(j, i), with the row j running along the threads of a warp
+                int64_t i = i0 + ty, j = j0 + tx;
+                if(i < m && j < n)
+                {
+                    T x          = X[j + i * ldx];
+                    tile[ty][tx] = trans == HIPBLAS_OP_C ? hipblas_device_conj(x) : x;
+                }
+            }
+        }
+    }
+
+    // C_b := alpha * op(A_b) + beta * op(B_b). A_b isn't read when alpha is zero and B_b isn't
+    // read when beta is zero. The scalars are read from alpha and beta when they aren't
+    // nullptr, in device pointer mode, and are alpha_value and beta_value otherwise.
+    template <typename T>
+    __global__ void hipblasBatchedGeamKernel(hipblasOperation_t transA,
+                                             hipblasOperation_t transB,
+                                             int64_t            m,
+                                             int64_t            n,
+                                             const T*           alpha,
+                                             T                  alpha_value,
+                                             const void*        A,
+                                             int64_t            lda,
+                                             hipblasStride      strideA,
+                                             const T*           beta,
+                                             T                  beta_value,
+                                             const void*        B,
+                                             int64_t            ldb,
+                                             hipblasStride      strideB,
+                                             void*              C,
+                                             int64_t            ldc,
+                                             hipblasStride      strideC,
+                                             bool               batched,
+                                             int64_t            batch_count)
+    {
+        __shared__ T tile_a[hipblas_batched_blas3_tile][hipblas_batched_blas3_tile + 1];
+        __shared__ T tile_b[hipblas_batched_blas3_tile][hipblas_batched_blas3_tile + 1];
+
+        T       a      = alpha ? *alpha : alpha_value;
+        T       bt     = beta ? *beta : beta_value;
+        bool    read_a = !hipblas_device_is_zero(a);
+        bool    read_b = !hipblas_device_is_zero(bt);
+        int     tx     = threadIdx.x;
+        int64_t i0     = int64_t(blockIdx.x) * hipblas_batched_blas3_tile;
+
+        for(int64_t b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            const T* Ab = hipblas_batched_blas3_matrix<T>(A, strideA, batched, b);
+            const T* Bb = hipblas_batched_blas3_matrix<T>(B, strideB, batched, b);
+            T*       Cb = hipblas_batched_blas3_matrix<T>(C, strideC, batched, b);
+
+            for(int64_t j0 = int64_t(blockIdx.y) * hipblas_batched_blas3_tile; j0 < n;
+                j0 += int64_t(gridDim.y) * hipblas_batched_blas3_tile)
+            {
+                if(read_a)
+                    hipblas_batched_geam_load(tile_a, Ab, lda, transA, m, n, i0, j0);
+                if(read_b)
+                    hipblas_batched_geam_load(tile_b, Bb, ldb, transB, m, n, i0, j0);
+                __syncthreads();
+
+                for(int ty = threadIdx.y; ty < hipblas_batched_blas3_tile;
+                    ty += hipblas_batched_blas3_rows)
+                {
+                    int64_t i = i0 + tx, j = j0 + ty;
+                    if(i < m && j < n)
+                        Cb[i + j * ldc] = hipblas_device_axpby(
+                            a, read_a ? tile_a[tx][ty] : T{}, bt, read_b ? tile_b[tx][ty] : T{});
+                }
+
+                // the tiles are reused by the next columns or the next matrix of the batch
+                __syncthreads();
+            }
+        }
+    }
+
+    // C_b := A_b * diag(x_b) when right, and diag(x_b) * A_b otherwise, with x pointing at the
+    // first element of x_b as stored, which is its last one when incx is negative
+    template <typename T>
+    __global__ void hipblasBatchedDgmmKernel(bool          right,
+                                             int64_t       m,
+                                             int64_t       n,
+                                             const void*   A,
+                                             int64_t       lda,
+                                             hipblasStride strideA,
+                                             const void*   x,
+                                             int64_t       incx,
+                                             hipblasStride stridex,
+                                             void*         C,
+                                             int64_t       ldc,
+                                             hipblasStride strideC,
+                                             bool          batched,
+                                             int64_t       batch_count)
+    {
+        int64_t i     = int64_t(blockIdx.x) * hipblas_batched_blas3_tile + threadIdx.x;
+        int64_t shift = incx < 0 ? -(right ? n - 1 : m - 1) * incx : 0;
+        if(i >= m)
+            return;
+
+        for(int64_t b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            const T* Ab = hipblas_batched_blas3_matrix<T>(A, strideA, batched, b);
+            const T* xb = hipblas_batched_blas3_matrix<T>(x, stridex, batched, b) + shift;
+            T*       Cb = hipblas_batched_blas3_matrix<T>(C, strideC, batched, b);
+
+            for(int64_t j0 = int64_t(blockIdx.y) * hipblas_batched_blas3_tile; j0 < n;
+                j0 += int64_t(gridDim.y) * hipblas_batched_blas3_tile)
+            {
+                for(int ty = threadIdx.y; ty < hipblas_batched_blas3_tile;
+                    ty += hipblas_batched_blas3_rows)
+                {
+                    int64_t j = j0 + ty;
+                    if(j >= n)
+                        break;
+                    Cb[i + j * ldc]
+                        = hipblas_batched_blas3_mul(Ab[i + j * lda], xb[(right ? j : i) * incx]);
+                }
+            }
+        }
+    }
+
+    // W_b := the full matrix of the uplo triangle of A_b, as hipblasBatchedSymmetrize
+    template <typename T>
+    __global__ void hipblasBatchedSymmetrizeKernel(bool          upper,
+                                                   bool          hermitian,
+                                                   int64_t       n,
+                                                   const T*      A,
+                                                   int64_t       lda,
+                                                   hipblasStride strideA,
+                                                   T*            W,
+                                                   int64_t       batch_count)
+    {
+        int64_t i = int64_t(blockIdx.x) * hipblas_batched_blas3_tile + threadIdx.x;
+        if(i >= n)
+            return;
+
+        for(int64_t b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            const T* Ab = A + b * strideA;
+            T*       Wb = W + b * n * n;
+            for(int64_t j0 = int64_t(blockIdx.y) * hipblas_batched_blas3_tile; j0 < n;
+                j0 += int64_t(gridDim.y) * hipblas_batched_blas3_tile)
+            {
+                for(int ty = threadIdx.y; ty < hipblas_batched_blas3_tile;
+                    ty += hipblas_batched_blas3_rows)
+                {
+                    int64_t j = j0 + ty;
+                    if(j >= n)
+                        break;
+
+                    T w;
+                    if(i == j)
+                        w = hermitian ? hipblas_batched_blas3_real(Ab[i + j * lda])
+                                      : Ab[i + j * lda];
+                    else if(upper == (i < j))
+                        w = Ab[i + j * lda];
+                    else
+                        w = hermitian ? hipblas_device_conj(Ab[j + i * lda]) : Ab[j + i * lda];
+                    Wb[i + j * n] = w;
+                }
+            }
+        }
+    }
+
+    // Calls launch with a zero of the type of data_type, or returns hipErrorNotSupported for
+    // the other types
+    template <typename F>
+    hipError_t hipblas_batched_blas3_dispatch(hipDataType data_type, F&& launch)
+    {
+        switch(data_type)
+        {
+        case HIP_R_32F:
+            return launch(float(0));
+        case HIP_R_64F:
+            return launch(double(0));
+        case HIP_C_32F:
+            return launch(make_hipFloatComplex(0, 0));
+        case HIP_C_64F:
+            return launch(make_hipDoubleComplex(0, 0));
+        default:
+            return hipErrorNotSupported;
+        }
+    }
+
+    bool hipblas_batched_blas3_type(hipDataType data_type)
+    {
+        return data_type == HIP_R_32F || data_type == HIP_R_64F || data_type == HIP_C_32F
+               || data_type == HIP_C_64F;
+    }
+
+    bool hipblas_batched_blas3_trans(hipblasOperation_t trans)
+    {
+        return trans == HIPBLAS_OP_N || trans == HIPBLAS_OP_T || trans == HIPBLAS_OP_C;
+    }
+
+    hipblasStatus_t hipblas_batched_blas3_status(hipError_t error)
+    {
+        return error == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    // Whether C is the same as X, which is only valid when X isn't transposed and C has its
+    // leading dimension, as geam and dgmm allow
+    bool hipblas_batched_blas3_in_place_invalid(
+        const void* X, int64_t ldx, hipblasOperation_t trans, const void* C, int64_t ldc)
+    {
+        return X == C && (trans != HIPBLAS_OP_N || ldx != ldc);
+    }
+}
+
+hipblasStatus_t hipblasBatchedGeam(hipblasHandle_t    handle,
+                                   hipblasOperation_t transA,
+                                   hipblasOperation_t transB,
+                                   int64_t            m,
+                                   int64_t            n,
+                                   const void*        alpha,
+                                   const void*        A,
+                                   int64_t            lda,
+                                   hipblasStride      strideA,
+                                   const void*        beta,
+                                   const void*        B,
+                                   int64_t            ldb,
+                                   hipblasStride      strideB,
+                                   void*              C,
+                                   int64_t            ldc,
+                                   hipblasStride      strideC,
+                                   hipDataType        dataType,
+                                   int64_t            batchCount,
+                                   bool               batched)
+try
+{
+    int64_t rows_a = transA == HIPBLAS_OP_N ? m : n;
+    int64_t rows_b = transB == HIPBLAS_OP_N ? m : n;
+    if(!handle || !hipblas_batched_blas3_type(dataType) || !hipblas_batched_blas3_trans(transA)
+       || !hipblas_batched_blas3_trans(transB) || m <= 0 || n <= 0 || batchCount <= 0
+       || lda < rows_a || ldb < rows_b || ldc < m || !alpha || !beta || !A || !B || !C
+       || hipblas_batched_blas3_in_place_invalid(A, lda, transA, C, ldc)
+       || hipblas_batched_blas3_in_place_invalid(B, ldb, transB, C, ldc))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetPointerMode(handle, &mode)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    bool host_scalars = mode != HIPBLAS_POINTER_MODE_DEVICE;
+
+    return hipblas_batched_blas3_status(hipblas_batched_blas3_dispatch(dataType, [&](auto zero) {
+        using T = decltype(zero);
+
+        T alpha_value = host_scalars ? *static_cast<const T*>(alpha) : zero;
+        T beta_value  = host_scalars ? *static_cast<const T*>(beta) : zero;
+        dim3 grid     = hipblas_batched_blas3_grid(m, n, batchCount);
+        dim3 threads(hipblas_batched_blas3_tile, hipblas_batched_blas3_rows);
+        hipblasBatchedGeamKernel<T>
+            <<<grid, threads, 0, stream>>>(transA,
+                                           transB,
+                                           m,
+                                           n,
+                                           host_scalars ? nullptr : static_cast<const T*>(alpha),
+                                           alpha_value,
+                                           A,
+                                           lda,
+                                           strideA,
+                                           host_scalars ? nullptr : static_cast<const T*>(beta),
+                                           beta_value,
+                                           B,
+                                           ldb,
+                                           strideB,
+                                           C,
+                                           ldc,
+                                           strideC,
+                                           batched,
+                                           batchCount);
+        return hipGetLastError();
+    }));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasBatchedDgmm(hipblasHandle_t   handle,
+                                   hipblasSideMode_t side,
+                                   int64_t           m,
+                                   int64_t           n,
+                                   const void*       A,
+                                   int64_t           lda,
+                                   hipblasStride     strideA,
+                                   const void*       x,
+                                   int64_t           incx,
+                                   hipblasStride     stridex,
+                                   void*             C,
+                                   int64_t           ldc,
+                                   hipblasStride     strideC,
+                                   hipDataType       dataType,
+                                   int64_t           batchCount,
+                                   bool              batched)
+try
+{
+    if(!handle || !hipblas_batched_blas3_type(dataType)
+       || (side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT) || m <= 0 || n <= 0
+       || batchCount <= 0 || lda < m || ldc < m || !A || !x || !C
+       || hipblas_batched_blas3_in_place_invalid(A, lda, HIPBLAS_OP_N, C, ldc))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return hipblas_batched_blas3_status(hipblas_batched_blas3_dispatch(dataType, [&](auto zero) {
+        using T = decltype(zero);
+
+        dim3 grid = hipblas_batched_blas3_grid(m, n, batchCount);
+        dim3 threads(hipblas_batched_blas3_tile, hipblas_batched_blas3_rows);
+        hipblasBatchedDgmmKernel<T><<<grid, threads, 0, stream>>>(side == HIPBLAS_SIDE_RIGHT,
+                                                                  m,
+                                                                  n,
+                                                                  A,
+                                                                  lda,
+                                                                  strideA,
+                                                                  x,
+                                                                  incx,
+                                                                  stridex,
+                                                                  C,
+                                                                  ldc,
+                                                                  strideC,
+                                                                  batched,
+                                                                  batchCount);
+        return hipGetLastError();
+    }));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasBatchedSymmetrize(hipblasHandle_t   handle,
+                                         hipblasFillMode_t uplo,
+                                         bool              hermitian,
+                                         int64_t           n,
+                                         const void*       A,
+                                         int64_t           lda,
+                                         hipblasStride     strideA,
+                                         void*             W,
+                                         hipDataType       dataType,
+                                         int64_t           batchCount)
+try
+{
+    if(!handle || !hipblas_batched_blas3_type(dataType)
+       || (uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER) || n <= 0
+       || batchCount <= 0 || lda < n || !A || !W)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return hipblas_batched_blas3_status(hipblas_batched_blas3_dispatch(dataType, [&](auto zero) {
+        using T = decltype(zero);
+
+        dim3 grid = hipblas_batched_blas3_grid(n, n, batchCount);
+        dim3 threads(hipblas_batched_blas3_tile, hipblas_batched_blas3_rows);
+        hipblasBatchedSymmetrizeKernel<T>
+            <<<grid, threads, 0, stream>>>(uplo == HIPBLAS_FILL_MODE_UPPER,
+                                           hermitian,
+                                           n,
+                                           static_cast<const T*>(A),
+                                           lda,
+                                           strideA,
+                                           static_cast<T*>(W),
+                                           batchCount);
+        return hipGetLastError();
+    }));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
@@ -0,0 +1,1198 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_complex.h>
+#include <hip/hip_fp16.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "exceptions.hpp"
+#include "hipblas_device_reduce.hpp"
+#include "hipblas_entry.hpp"
+
+// hipblasAxpyDotEx, hipblasWaxpbyEx and hipblasXpayEx and their strided batched forms: vector
+// updates of iterative solvers fused so that each vector is streamed once per call instead of
+// once per BLAS 1 call. hipblasMultiDotEx and hipblasMultiNrm2Ex reduce a block of k vectors,
+// as s-step Krylov methods do, in one call instead of k. hipblasNormalizeEx scales vectors to
+// unit norm without the nrm2 and scal round trip. The same kernels serve both backends.
+// The reductions are the fixed-order reductions of hipblas_device_reduce.hpp.
+
+namespace
+{
+    // w_b := alpha * x_b + beta * y_b. x_b isn't read when alpha is zero and y_b isn't read
+    // when beta is zero. w can be y. The scalars are read from alpha and beta when they aren't
+    // nullptr, in device pointer mode, and are alpha_value and beta_value otherwise.
+    template <typename T, typename TS>
+    __global__ void hipblasWaxpbyExKernel(int           n,
+                                          const TS*     alpha,
+                                          TS            alpha_value,
+                                          const T*      x,
+                                          int           incx,
+                                          hipblasStride stridex,
+                                          const TS*     beta,
+                                          TS            beta_value,
+                                          const T*      y,
+                                          int           incy,
+                                          hipblasStride stridey,
+                                          T*            w,
+                                          int           incw,
+                                          hipblasStride stridew,
+                                          int           batch_count)
+    {
+        TS   a      = alpha ? *alpha : alpha_value;
+        TS   bt     = beta ? *beta : beta_value;
+        bool read_x = !hipblas_device_is_zero(a);
+        bool read_y = !hipblas_device_is_zero(bt);
+
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            const T* xb = x + b * stridex;
+            const T* yb = y + b * stridey;
+            T*       wb = w + b * stridew;
+            for(int i = blockIdx.x * blockDim.x + threadIdx.x; i < n; i += gridDim.x * blockDim.x)
+            {
+                TS xi = read_x ? hipblas_device_load(hipblas_device_elem(xb, n, incx, i)) : TS{};
+                TS yi = read_y ? hipblas_device_load(hipblas_device_elem(yb, n, incy, i)) : TS{};
+                hipblas_device_store(hipblas_device_axpby(a, xi, bt, yi),
+                                     hipblas_device_elem(wb, n, incw, i));
+            }
+        }
+    }
+
+    // y_b := alpha * x_b + y_b, then partial[b * gridDim.x + blockIdx.x] := the sum over the
+    // elements of the block of conj(y_b) * z_b, with y_b as stored. z can be y.
+    template <typename T, typename TS>
+    __global__ void hipblasAxpyDotExKernel(int           n,
+                                           const TS*     alpha,
+                                           TS            alpha_value,
+                                           const T*      x,
+                                           int           incx,
+                                           hipblasStride stridex,
+                                           T*            y,
+                                           int           incy,
+                                           hipblasStride stridey,
+                                           const T*      z,
+                                           int           incz,
+                                           hipblasStride stridez,
+                                           TS*           partial,
+                                           int           batch_count)
+    {
+        __shared__ TS sums[hipblas_blas1_threads];
+
+        TS   a      = alpha ? *alpha : alpha_value;
+        TS   one    = hipblas_device_one<TS>();
+        bool read_x = !hipblas_device_is_zero(a);
+
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            const T* xb  = x + b * stridex;
+            T*       yb  = y + b * stridey;
+            const T* zb  = z + b * stridez;
+            TS       sum = TS{};
+            for(int i = blockIdx.x * blockDim.x + threadIdx.x; i < n; i += gridDim.x * blockDim.x)
+            {
+                T& yi = hipblas_device_elem(yb, n, incy, i);
+                if(read_x)
+                {
+                    TS xi = hipblas_device_load(hipblas_device_elem(xb, n, incx, i));
+                    hipblas_device_store(hipblas_device_axpby(a, xi, one, hipblas_device_load(yi)),
+                                         yi);
+                }
+                TS zi = hipblas_device_load(hipblas_device_elem(zb, n, incz, i));
+                TS yc = hipblas_device_conj(hipblas_device_load(yi));
+                sum   = hipblas_device_axpby(yc, zi, one, sum);
+            }
+
+            sum = hipblas_device_block_sum(sum, sums);
+            if(!threadIdx.x)
+                partial[size_t(b) * gridDim.x + blockIdx.x] = sum;
+        }
+    }
+
+    // partial[j * gridDim.x + blockIdx.x] := the sum over the elements of the block of
+    // conj(y_j) * x
+    template <typename T, typename TS>
+    __global__ void hipblasMultiDotExKernel(int           n,
+                                            const T*      x,
+                                            int           incx,
+                                            const T*      y,
+                                            int           incy,
+                                            hipblasStride stridey,
+                                            TS*           partial,
+                                            int           k)
+    {
+        __shared__ TS sums[hipblas_blas1_threads];
+
+        TS one = hipblas_device_one<TS>();
+        for(int j = blockIdx.y; j < k; j += gridDim.y)
+        {
+            const T* yj  = y + j * stridey;
+            TS       sum = TS{};
+            for(int i = blockIdx.x * blockDim.x + threadIdx.x; i < n; i += gridDim.x * blockDim.x)
+            {
+                TS xi = hipblas_device_load(hipblas_device_elem(x, n, incx, i));
+                TS yc = hipblas_device_conj(
+                    hipblas_device_load(hipblas_device_elem(yj, n, incy, i)));
+                sum = hipblas_device_axpby(yc, xi, one, sum);
+            }
+
+            sum = hipblas_device_block_sum(sum, sums);
+            if(!threadIdx.x)
+                partial[size_t(j) * gridDim.x + blockIdx.x] = sum;
+        }
+    }
+
+    // partial[j * gridDim.x + blockIdx.x] := the sum over the elements of the block of |x_j|^2
+    template <typename T, typename TR>
+    __global__ void hipblasMultiNrm2ExKernel(
+        int n, const T* x, int incx, hipblasStride stridex, TR* partial, int k)
+    {
+        __shared__ TR sums[hipblas_blas1_threads];
+
+        for(int j = blockIdx.y; j < k; j += gridDim.y)
+        {
+            const T* xj  = x + j * stridex;
+            TR       sum = 0;
+            for(int i = blockIdx.x * blockDim.x + threadIdx.x; i < n; i += gridDim.x * blockDim.x)
+                sum += hipblas_device_abs2(
+                    hipblas_device_load(hipblas_device_elem(xj, n, incx, i)));
+
+            sum = hipblas_device_block_sum(sum, sums);
+            if(!threadIdx.x)
+                partial[size_t(j) * gridDim.x + blockIdx.x] = sum;
+        }
+    }
+
+    // The elements of x held per thread by hipblasNormalizeExCachedKernel, which normalizes the
+    // vectors of up to hipblas_normalize_cached * hipblas_blas1_threads elements
+    constexpr int hipblas_normalize_cached = 16;
+
+    inline bool hipblas_normalize_is_cached(int n)
+    {
+        return n <= hipblas_normalize_cached * hipblas_blas1_threads;
+    }
+
+    // a * x for a real a
+    template <typename T, typename TR>
+    __device__ inline T hipblas_device_scale(TR a, T x)
+    {
+        return a * x;
+    }
+
+    __device__ inline hipFloatComplex hipblas_device_scale(float a, hipFloatComplex x)
+    {
+        return make_hipFloatComplex(a * hipCrealf(x), a * hipCimagf(x));
+    }
+
+    __device__ inline hipDoubleComplex hipblas_device_scale(double a, hipDoubleComplex x)
+    {
+        return make_hipDoubleComplex(a * hipCreal(x), a * hipCimag(x));
+    }
+
+    // x_b := x_b / ||x_b|| and norm[b] := ||x_b|| unless norm is nullptr, with one block per
+    // x_b, which is read once into registers. x_b is left as it is when its norm is zero.
+    template <typename T, typename TR>
+    __global__ void hipblasNormalizeExCachedKernel(
+        int n, T* x, int incx, hipblasStride stridex, TR* norm, int batch_count)
+    {
+        using TL = decltype(hipblas_device_load(T{}));
+
+        __shared__ TR sums[hipblas_blas1_threads];
+
+        for(int b = blockIdx.x; b < batch_count; b += gridDim.x)
+        {
+            T* xb = x + b * stridex;
+            TL v[hipblas_normalize_cached];
+            TR sum = 0;
+#pragma unroll
+            for(int c = 0; c < hipblas_normalize_cached; c++)
+            {
+                int i = c * blockDim.x + threadIdx.x;
+                v[c]  = i < n ? hipblas_device_load(hipblas_device_elem(xb, n, incx, i)) : TL{};
+                sum += hipblas_device_abs2(v[c]);
+            }
+
+            TR nrm = sqrt(hipblas_device_block_sum(sum, sums));
+            if(norm && !threadIdx.x)
+                norm[b] = nrm;
+            if(nrm == TR(0))
+                continue;
+
+            TR scale = TR(1) / nrm;
+#pragma unroll
+            for(int c = 0; c < hipblas_normalize_cached; c++)
+            {
+                int i = c * blockDim.x + threadIdx.x;
+                if(i < n)
+                    hipblas_device_store(hipblas_device_scale(scale, v[c]),
+                                         hipblas_device_elem(xb, n, incx, i));
+            }
+        }
+    }
+
+    // The second pass of hipblasNormalizeEx for the longer vectors: each block adds the
+    // partial sums of hipblasMultiNrm2ExKernel of x_b in the order of hipblasBlas1SumKernel,
+    // then scales its elements of x_b, which the first pass may have left in the cache.
+    template <typename T, typename TR>
+    __global__ void hipblasNormalizeExScaleKernel(int           n,
+                                                  T*            x,
+                                                  int           incx,
+                                                  hipblasStride stridex,
+                                                  const TR*     partial,
+                                                  TR*           norm,
+                                                  int           batch_count)
+    {
+        __shared__ TR sums[hipblas_blas1_threads];
+
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            TR sum = 0;
+            for(int i = threadIdx.x; i < gridDim.x; i += blockDim.x)
+                sum += partial[size_t(b) * gridDim.x + i];
+
+            TR nrm = sqrt(hipblas_device_block_sum(sum, sums));
+            if(norm && !blockIdx.x && !threadIdx.x)
+                norm[b] = nrm;
+            if(nrm == TR(0))
+                continue;
+
+            TR scale = TR(1) / nrm;
+            T* xb    = x + b * stridex;
+            for(int i = blockIdx.x * blockDim.x + threadIdx.x; i < n; i += gridDim.x * blockDim.x)
+            {
+                T& e = hipblas_device_elem(xb, n, incx, i);
+                hipblas_device_store(hipblas_device_scale(scale, hipblas_device_load(e)), e);
+            }
+        }
+    }
+
+    template <typename T, typename TS>
+    hipError_t hipblas_waxpby_ex_launch(int           n,
+                                        const void*   alpha,
+                                        bool          host_alpha,
+                                        const void*   x,
+                                        int           incx,
+                                        hipblasStride stridex,
+                                        const void*   beta,
+                                        bool          host_beta,
+                                        const void*   y,
+                                        int           incy,
+                                        hipblasStride stridey,
+                                        void*         w,
+                                        int           incw,
+                                        hipblasStride stridew,
+                                        int           batch_count,
+                                        hipStream_t   stream)
+    {
+        TS alpha_value = host_alpha ? *static_cast<const TS*>(alpha) : TS{};
+        TS beta_value  = host_beta ? *static_cast<const TS*>(beta) : TS{};
+
+        dim3 grid(hipblas_blas1_grid(n), std::min(batch_count, 65535));
+        hipblasWaxpbyExKernel<T, TS>
+            <<<grid, hipblas_blas1_threads, 0, stream>>>(n,
+                                                         host_alpha ? nullptr : (const TS*)alpha,
+                                                         alpha_value,
+                                                         (const T*)x,
+                                                         incx,
+                                                         stridex,
+                                                         host_beta ? nullptr : (const TS*)beta,
+                                                         beta_value,
+                                                         (const T*)y,
+                                                         incy,
+                                                         stridey,
+                                                         (T*)w,
+                                                         incw,
+                                                         stridew,
+                                                         batch_count);
+        return hipGetLastError();
+    }
+
+    // The partial sums go to scratch and the results to result, on the device
+    template <typename T, typename TS>
+    hipError_t hipblas_axpy_dot_ex_launch(int           n,
+                                          const void*   alpha,
+                                          bool          host_alpha,
+                                          const void*   x,
+                                          int           incx,
+                                          hipblasStride stridex,
+                                          void*         y,
+                                          int           incy,
+                                          hipblasStride stridey,
+                                          const void*   z,
+                                          int           incz,
+                                          hipblasStride stridez,
+                                          void*         scratch,
+                                          void*         result,
+                                          int           batch_count,
+                                          hipStream_t   stream)
+    {
+        TS alpha_value = host_alpha ? *static_cast<const TS*>(alpha) : TS{};
+
+        int  blocks = hipblas_blas1_grid(n);
+        dim3 grid(blocks, std::min(batch_count, 65535));
+        hipblasAxpyDotExKernel<T, TS>
+            <<<grid, hipblas_blas1_threads, 0, stream>>>(n,
+                                                         host_alpha ? nullptr : (const TS*)alpha,
+                                                         alpha_value,
+                                                         (const T*)x,
+                                                         incx,
+                                                         stridex,
+                                                         (T*)y,
+                                                         incy,
+                                                         stridey,
+                                                         (const T*)z,
+                                                         incz,
+                                                         stridez,
+                                                         (TS*)scratch,
+                                                         batch_count);
+        hipblasBlas1SumKernel<TS>
+            <<<std::min(batch_count, 65535), hipblas_blas1_threads, 0, stream>>>(
+                blocks, (const TS*)scratch, (TS*)result, batch_count);
+        return hipGetLastError();
+    }
+
+    template <typename T, typename TS>
+    hipError_t hipblas_multi_dot_ex_launch(int           n,
+                                           const void*   x,
+                                           int           incx,
+                                           const void*   y,
+                                           int           incy,
+                                           hipblasStride stridey,
+                                           void*         scratch,
+                                           void*         result,
+                                           int           k,
+                                           hipStream_t   stream)
+    {
+        int  blocks = hipblas_blas1_grid(n);
+        dim3 grid(blocks, std::min(k, 65535));
+        hipblasMultiDotExKernel<T, TS><<<grid, hipblas_blas1_threads, 0, stream>>>(
+            n, (const T*)x, incx, (const T*)y, incy, stridey, (TS*)scratch, k);
+        hipblasBlas1SumKernel<TS>
+            <<<std::min(k, 65535), hipblas_blas1_threads, 0, stream>>>(
+                blocks, (const TS*)scratch, (TS*)result, k);
+        return hipGetLastError();
+    }
+
+    template <typename T, typename TR>
+    hipError_t hipblas_multi_nrm2_ex_launch(int           n,
+                                            const void*   x,
+                                            int           incx,
+                                            hipblasStride stridex,
+                                            void*         scratch,
+                                            void*         result,
+                                            int           k,
+                                            hipStream_t   stream)
+    {
+        int  blocks = hipblas_blas1_grid(n);
+        dim3 grid(blocks, std::min(k, 65535));
+        hipblasMultiNrm2ExKernel<T, TR><<<grid, hipblas_blas1_threads, 0, stream>>>(
+            n, (const T*)x, incx, stridex, (TR*)scratch, k);
+        hipblasBlas1SumKernel<TR, true>
+            <<<std::min(k, 65535), hipblas_blas1_threads, 0, stream>>>(
+                blocks, (const TR*)scratch, (TR*)result, k);
+        return hipGetLastError();
+    }
+
+    // One launch for the vectors of hipblas_normalize_is_cached(n), two otherwise with the
+    // partial sums in scratch. norm is on the device, or nullptr.
+    template <typename T, typename TR>
+    hipError_t hipblas_normalize_ex_launch(int           n,
+                                           void*         x,
+                                           int           incx,
+                                           hipblasStride stridex,
+                                           void*         scratch,
+                                           void*         norm,
+                                           int           batch_count,
+                                           hipStream_t   stream)
+    {
+        int batches = std::min(batch_count, 65535);
+        if(hipblas_normalize_is_cached(n))
+        {
+            hipblasNormalizeExCachedKernel<T, TR><<<batches, hipblas_blas1_threads, 0, stream>>>(
+                n, (T*)x, incx, stridex, (TR*)norm, batch_count);
+            return hipGetLastError();
+        }
+
+        dim3 grid(hipblas_blas1_grid(n), batches);
+        hipblasMultiNrm2ExKernel<T, TR><<<grid, hipblas_blas1_threads, 0, stream>>>(
+            n, (const T*)x, incx, stridex, (TR*)scratch, batch_count);
+        hipblasNormalizeExScaleKernel<T, TR><<<grid, hipblas_blas1_threads, 0, stream>>>(
+            n, (T*)x, incx, stridex, (const TR*)scratch, (TR*)norm, batch_count);
+        return hipGetLastError();
+    }
+
+    // The kernels of one pair of the type of the vectors and executionType, and the size of
+    // the scalars
+    struct hipblas_blas1_fused_kernels
+    {
+        decltype(&hipblas_waxpby_ex_launch<float, float>)    waxpby      = nullptr;
+        decltype(&hipblas_axpy_dot_ex_launch<float, float>)  axpy_dot    = nullptr;
+        decltype(&hipblas_multi_dot_ex_launch<float, float>) multi_dot   = nullptr;
+        size_t                                               scalar_size = 0;
+    };
+
+    template <typename T, typename TS>
+    hipblas_blas1_fused_kernels hipblas_blas1_fused_kernels_of()
+    {
+        return {hipblas_waxpby_ex_launch<T, TS>,
+                hipblas_axpy_dot_ex_launch<T, TS>,
+                hipblas_multi_dot_ex_launch<T, TS>,
+                sizeof(TS)};
+    }
+
+    // Half and bfloat16 vectors are computed in float, the other types in their own type
+    hipblas_blas1_fused_kernels hipblas_blas1_fused_kernels_for(hipDataType data_type,
+                                                                hipDataType execution_type)
+    {
+        switch(execution_type)
+        {
+        case HIP_R_32F:
+            if(data_type == HIP_R_16F)
+                return hipblas_blas1_fused_kernels_of<__half, float>();
+            if(data_type == HIP_R_16BF)
+                return hipblas_blas1_fused_kernels_of<hipblas_device_bf16, float>();
+            if(data_type == HIP_R_32F)
+                return hipblas_blas1_fused_kernels_of<float, float>();
+            break;
+        case HIP_R_64F:
+            if(data_type == HIP_R_64F)
+                return hipblas_blas1_fused_kernels_of<double, double>();
+            break;
+        case HIP_C_32F:
+            if(data_type == HIP_C_32F)
+                return hipblas_blas1_fused_kernels_of<hipFloatComplex, hipFloatComplex>();
+            break;
+        case HIP_C_64F:
+            if(data_type == HIP_C_64F)
+                return hipblas_blas1_fused_kernels_of<hipDoubleComplex, hipDoubleComplex>();
+            break;
+        default:
+            break;
+        }
+        return {};
+    }
+
+    // The kernels of hipblasMultiNrm2Ex and hipblasNormalizeEx for one pair of the type of the
+    // vectors and the real executionType, and the size of the norms
+    struct hipblas_multi_nrm2_kernels
+    {
+        decltype(&hipblas_multi_nrm2_ex_launch<float, float>) multi_nrm2  = nullptr;
+        decltype(&hipblas_normalize_ex_launch<float, float>)  normalize   = nullptr;
+        size_t                                                result_size = 0;
+    };
+
+    template <typename T, typename TR>
+    hipblas_multi_nrm2_kernels hipblas_multi_nrm2_kernels_of()
+    {
+        return {
+            hipblas_multi_nrm2_ex_launch<T, TR>, hipblas_normalize_ex_launch<T, TR>, sizeof(TR)};
+    }
+
+    hipblas_multi_nrm2_kernels hipblas_multi_nrm2_kernels_for(hipDataType data_type,
+                                                              hipDataType execution_type)
+    {
+        if(execution_type == HIP_R_32F)
+        {
+            if(data_type == HIP_R_16F)
+                return hipblas_multi_nrm2_kernels_of<__half, float>();
+            if(data_type == HIP_R_16BF)
+                return hipblas_multi_nrm2_kernels_of<hipblas_device_bf16, float>();
+            if(data_type == HIP_R_32F)
+                return hipblas_multi_nrm2_kernels_of<float, float>();
+            if(data_type == HIP_C_32F)
+                return hipblas_multi_nrm2_kernels_of<hipFloatComplex, float>();
+        }
+        else if(execution_type == HIP_R_64F)
+        {
+            if(data_type == HIP_R_64F)
+                return hipblas_multi_nrm2_kernels_of<double, double>();
+            if(data_type == HIP_C_64F)
+                return hipblas_multi_nrm2_kernels_of<hipDoubleComplex, double>();
+        }
+        return {};
+    }
+
+
+    // hipblasWaxpbyEx, and hipblasXpayEx when xpay, with x scaled by 1 on the host whatever the
+    // pointer mode instead of by alpha
+    hipblasStatus_t hipblasWaxpbyExImpl(hipblasHandle_t handle,
+                                        int             n,
+                                        const void*     alpha,
+                                        bool            xpay,
+                                        const void*     x,
+                                        int             incx,
+                                        hipblasStride   stridex,
+                                        const void*     beta,
+                                        const void*     y,
+                                        int             incy,
+                                        hipblasStride   stridey,
+                                        void*           w,
+                                        int             incw,
+                                        hipblasStride   stridew,
+                                        int             batchCount,
+                                        hipDataType     dataType,
+                                        hipDataType     executionType)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(batchCount < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(n <= 0 || !batchCount)
+            return HIPBLAS_STATUS_SUCCESS;
+        if((!xpay && !alpha) || !beta || !incw)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        auto kernels = hipblas_blas1_fused_kernels_for(dataType, executionType);
+        if(!kernels.waxpby)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        hipStream_t          stream;
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblas_blas1_stream(handle, &stream, &mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        char one[16] = {};
+        if(xpay)
+        {
+            bool is_double = executionType == HIP_R_64F || executionType == HIP_C_64F;
+            hipblas_scalar_one(is_double ? HIPBLAS_COMPUTE_64F : HIPBLAS_COMPUTE_32F, one);
+            alpha = one;
+        }
+
+        bool host_scalars = mode != HIPBLAS_POINTER_MODE_DEVICE;
+        if(host_scalars)
+        {
+            // with the scalars on the host, the vectors that aren't read can be nullptr
+            char zero[16] = {};
+            bool read_x   = xpay || memcmp(alpha, zero, kernels.scalar_size);
+            bool read_y   = memcmp(beta, zero, kernels.scalar_size);
+            if((read_x && !x) || (read_y && !y) || !w)
+                return HIPBLAS_STATUS_INVALID_VALUE;
+        }
+        else if(!x || !y || !w)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        if(kernels.waxpby(n,
+                          alpha,
+                          xpay || host_scalars,
+                          x,
+                          incx,
+                          stridex,
+                          beta,
+                          host_scalars,
+                          y,
+                          incy,
+                          stridey,
+                          w,
+                          incw,
+                          stridew,
+                          batchCount,
+                          stream)
+           != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasStatus_t hipblasAxpyDotExImpl(hipblasHandle_t handle,
+                                         int             n,
+                                         const void*     alpha,
+                                         const void*     x,
+                                         int             incx,
+                                         hipblasStride   stridex,
+                                         void*           y,
+                                         int             incy,
+                                         hipblasStride   stridey,
+                                         const void*     z,
+                                         int             incz,
+                                         hipblasStride   stridez,
+                                         void*           result,
+                                         int             batchCount,
+                                         hipDataType     dataType,
+                                         hipDataType     executionType)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(batchCount < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!batchCount)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!result)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        auto kernels = hipblas_blas1_fused_kernels_for(dataType, executionType);
+        if(!kernels.axpy_dot)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        hipStream_t          stream;
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblas_blas1_stream(handle, &stream, &mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // as for dot, the results of empty vectors are zero. In HIPBLAS_POINTER_MODE_PINNED_HOST
+        // alpha is read on the host and the results are written by the device.
+        bool host_scalars = mode != HIPBLAS_POINTER_MODE_DEVICE;
+        bool host_result  = mode == HIPBLAS_POINTER_MODE_HOST;
+        if(n <= 0)
+            return hipblas_blas1_zero(host_result, result, batchCount, kernels.scalar_size, stream);
+        if(!alpha || !x || !y || !z || !incy)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        return hipblas_blas1_reduce(
+            handle,
+            stream,
+            host_result,
+            n,
+            batchCount,
+            kernels.scalar_size,
+            kernels.scalar_size,
+            result,
+            [&](void* scratch, void* d_result) {
+                return kernels.axpy_dot(n,
+                                        alpha,
+                                        host_scalars,
+                                        x,
+                                        incx,
+                                        stridex,
+                                        y,
+                                        incy,
+                                        stridey,
+                                        z,
+                                        incz,
+                                        stridez,
+                                        scratch,
+                                        d_result,
+                                        batchCount,
+                                        stream);
+            });
+    }
+
+    hipblasStatus_t hipblasMultiDotExImpl(hipblasHandle_t handle,
+                                          int             n,
+                                          int             k,
+                                          const void*     x,
+                                          int             incx,
+                                          const void*     y,
+                                          int             incy,
+                                          hipblasStride   stridey,
+                                          void*           result,
+                                          hipDataType     dataType,
+                                          hipDataType     executionType)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(k < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!k)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!result)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        auto kernels = hipblas_blas1_fused_kernels_for(dataType, executionType);
+        if(!kernels.multi_dot)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        hipStream_t          stream;
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblas_blas1_stream(handle, &stream, &mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        bool host_result = mode == HIPBLAS_POINTER_MODE_HOST;
+        if(n <= 0)
+            return hipblas_blas1_zero(host_result, result, k, kernels.scalar_size, stream);
+        if(!x || !y)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        return hipblas_blas1_reduce(
+            handle,
+            stream,
+            host_result,
+            n,
+            k,
+            kernels.scalar_size,
+            kernels.scalar_size,
+            result,
+            [&](void* scratch, void* d_result) {
+                return kernels.multi_dot(
+                    n, x, incx, y, incy, stridey, scratch, d_result, k, stream);
+            });
+    }
+
+    hipblasStatus_t hipblasMultiNrm2ExImpl(hipblasHandle_t handle,
+                                           int             n,
+                                           int             k,
+                                           const void*     x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           void*           result,
+                                           hipDataType     dataType,
+                                           hipDataType     executionType)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(k < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!k)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!result)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        auto kernels = hipblas_multi_nrm2_kernels_for(dataType, executionType);
+        if(!kernels.multi_nrm2)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        hipStream_t          stream;
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblas_blas1_stream(handle, &stream, &mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // as for nrm2, the norms are zero when n or incx isn't positive
+        bool host_result = mode == HIPBLAS_POINTER_MODE_HOST;
+        if(n <= 0 || incx <= 0)
+            return hipblas_blas1_zero(host_result, result, k, kernels.result_size, stream);
+        if(!x)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        return hipblas_blas1_reduce(
+            handle,
+            stream,
+            host_result,
+            n,
+            k,
+            kernels.result_size,
+            kernels.result_size,
+            result,
+            [&](void* scratch, void* d_result) {
+                return kernels.multi_nrm2(n, x, incx, stridex, scratch, d_result, k, stream);
+            });
+    }
+
+    hipblasStatus_t hipblasNormalizeExImpl(hipblasHandle_t handle,
+                                           int             n,
+                                           void*           x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           void*           norm,
+                                           int             batch_count,
+                                           hipDataType     dataType,
+                                           hipDataType     executionType)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        auto kernels = hipblas_multi_nrm2_kernels_for(dataType, executionType);
+        if(!kernels.normalize)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        hipStream_t          stream;
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblas_blas1_stream(handle, &stream, &mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // as for nrm2, the norms are zero when n or incx isn't positive, and x is left as it is
+        bool host_norm = norm && mode == HIPBLAS_POINTER_MODE_HOST;
+        if(n <= 0 || incx <= 0)
+        {
+            if(!norm)
+                return HIPBLAS_STATUS_SUCCESS;
+            return hipblas_blas1_zero(host_norm, norm, batch_count, kernels.result_size, stream);
+        }
+        if(!x)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        // the cached kernel needs no partial sums, so the scratch may not be needed at all
+        size_t norm_bytes    = size_t(batch_count) * kernels.result_size;
+        size_t partial_bytes = 0;
+        if(!hipblas_normalize_is_cached(n))
+            partial_bytes = hipblas_scratch_pad(size_t(batch_count) * hipblas_blas1_grid(n)
+                                                * kernels.result_size);
+        size_t scratch_bytes = partial_bytes + (host_norm ? norm_bytes : 0);
+        char*  scratch       = nullptr;
+        if(scratch_bytes)
+        {
+            scratch = static_cast<char*>(hipblasGetScratch(handle, scratch_bytes, stream));
+            if(!scratch)
+                return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+
+        void* d_norm = host_norm ? scratch + partial_bytes : norm;
+        if(kernels.normalize(n, x, incx, stridex, scratch, d_norm, batch_count, stream)
+           != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        if(host_norm
+           && (hipMemcpyAsync(norm, d_norm, norm_bytes, hipMemcpyDeviceToHost, stream) != hipSuccess
+               || hipStreamSynchronize(stream) != hipSuccess))
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+extern "C" hipblasStatus_t hipblasAxpyDotEx(hipblasHandle_t handle,
+                                            int             n,
+                                            const void*     alpha,
+                                            const void*     x,
+                                            int             incx,
+                                            void*           y,
+                                            int             incy,
+                                            const void*     z,
+                                            int             incz,
+                                            void*           result,
+                                            hipDataType     dataType,
+                                            hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, incz, dataType, executionType);
+
+    return hipblasAxpyDotExImpl(handle,
+                                n,
+                                alpha,
+                                x,
+                                incx,
+                                0,
+                                y,
+                                incy,
+                                0,
+                                z,
+                                incz,
+                                0,
+                                result,
+                                1,
+                                dataType,
+                                executionType);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasAxpyDotStridedBatchedEx(hipblasHandle_t handle,
+                                                          int             n,
+                                                          const void*     alpha,
+                                                          const void*     x,
+                                                          int             incx,
+                                                          hipblasStride   stridex,
+                                                          void*           y,
+                                                          int             incy,
+                                                          hipblasStride   stridey,
+                                                          const void*     z,
+                                                          int             incz,
+                                                          hipblasStride   stridez,
+                                                          void*           result,
+                                                          int             batchCount,
+                                                          hipDataType     dataType,
+                                                          hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  n,
+                  incx,
+                  stridex,
+                  incy,
+                  stridey,
+                  incz,
+                  stridez,
+                  batchCount,
+                  dataType,
+                  executionType);
+
+    return hipblasAxpyDotExImpl(handle,
+                                n,
+                                alpha,
+                                x,
+                                incx,
+                                stridex,
+                                y,
+                                incy,
+                                stridey,
+                                z,
+                                incz,
+                                stridez,
+                                result,
+                                batchCount,
+                                dataType,
+                                executionType);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasWaxpbyEx(hipblasHandle_t handle,
+                                           int             n,
+                                           const void*     alpha,
+                                           const void*     x,
+                                           int             incx,
+                                           const void*     beta,
+                                           const void*     y,
+                                           int             incy,
+                                           void*           w,
+                                           int             incw,
+                                           hipDataType     dataType,
+                                           hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, incw, dataType, executionType);
+
+    return hipblasWaxpbyExImpl(handle,
+                               n,
+                               alpha,
+                               false,
+                               x,
+                               incx,
+                               0,
+                               beta,
+                               y,
+                               incy,
+                               0,
+                               w,
+                               incw,
+                               0,
+                               1,
+                               dataType,
+                               executionType);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasWaxpbyStridedBatchedEx(hipblasHandle_t handle,
+                                                         int             n,
+                                                         const void*     alpha,
+                                                         const void*     x,
+                                                         int             incx,
+                                                         hipblasStride   stridex,
+                                                         const void*     beta,
+                                                         const void*     y,
+                                                         int             incy,
+                                                         hipblasStride   stridey,
+                                                         void*           w,
+                                                         int             incw,
+                                                         hipblasStride   stridew,
+                                                         int             batchCount,
+                                                         hipDataType     dataType,
+                                                         hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  n,
+                  incx,
+                  stridex,
+                  incy,
+                  stridey,
+                  incw,
+                  stridew,
+                  batchCount,
+                  dataType,
+                  executionType);
+
+    return hipblasWaxpbyExImpl(handle,
+                               n,
+                               alpha,
+                               false,
+                               x,
+                               incx,
+                               stridex,
+                               beta,
+                               y,
+                               incy,
+                               stridey,
+                               w,
+                               incw,
+                               stridew,
+                               batchCount,
+                               dataType,
+                               executionType);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasXpayEx(hipblasHandle_t handle,
+                                         int             n,
+                                         const void*     alpha,
+                                         const void*     x,
+                                         int             incx,
+                                         void*           y,
+                                         int             incy,
+                                         hipDataType     dataType,
+                                         hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, dataType, executionType);
+
+    return hipblasWaxpbyExImpl(handle,
+                               n,
+                               nullptr,
+                               true,
+                               x,
+                               incx,
+                               0,
+                               alpha,
+                               y,
+                               incy,
+                               0,
+                               y,
+                               incy,
+                               0,
+                               1,
+                               dataType,
+                               executionType);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasXpayStridedBatchedEx(hipblasHandle_t handle,
+                                                       int             n,
+                                                       const void*     alpha,
+                                                       const void*     x,
+                                                       int             incx,
+                                                       hipblasStride   stridex,
+                                                       void*           y,
+                                                       int             incy,
+                                                       hipblasStride   stridey,
+                                                       int             batchCount,
+                                                       hipDataType     dataType,
+                                                       hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount, dataType, executionType);
+
+    return hipblasWaxpbyExImpl(handle,
+                               n,
+                               nullptr,
+                               true,
+                               x,
+                               incx,
+                               stridex,
+                               alpha,
+                               y,
+                               incy,
+                               stridey,
+                               y,
+                               incy,
+                               stridey,
+                               batchCount,
+                               dataType,
+                               executionType);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasMultiDotEx(hipblasHandle_t handle,
+                                             int             n,
+                                             int             k,
+                                             const void*     x,
+                                             int             incx,
+                                             const void*     y,
+                                             int             incy,
+                                             hipblasStride   stridey,
+                                             void*           result,
+                                             hipDataType     dataType,
+                                             hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, k, incx, incy, stridey, dataType, executionType);
+
+    return hipblasMultiDotExImpl(
+        handle, n, k, x, incx, y, incy, stridey, result, dataType, executionType);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasMultiNrm2Ex(hipblasHandle_t handle,
+                                              int             n,
+                                              int             k,
+                                              const void*     x,
+                                              int             incx,
+                                              hipblasStride   stridex,
+                                              void*           result,
+                                              hipDataType     dataType,
+                                              hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, k, incx, stridex, dataType, executionType);
+
+    return hipblasMultiNrm2ExImpl(handle, n, k, x, incx, stridex, result, dataType, executionType);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasNormalizeEx(hipblasHandle_t handle,
+                                              int             n,
+                                              void*           x,
+                                              int             incx,
+                                              void*           norm,
+                                              hipDataType     dataType,
+                                              hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, dataType, executionType);
+
+    return hipblasNormalizeExImpl(handle, n, x, incx, 0, norm, 1, dataType, executionType);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasNormalizeStridedBatchedEx(hipblasHandle_t handle,
+                                                            int             n,
+                                                            void*           x,
+                                                            int             incx,
+                                                            hipblasStride   stridex,
+                                                            void*           norm,
+                                                            int             batchCount,
+                                                            hipDataType     dataType,
+                                                            hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount, dataType, executionType);
+
+    return hipblasNormalizeExImpl(
+        handle, n, x, incx, stridex, norm, batchCount, dataType, executionType);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
@@ -0,0 +1,290 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "exceptions.hpp"
+
+namespace
+{
+    // Bytes [begin, end) read or written by a call queued in a concurrent region
+    struct hipblas_concurrent_range
+    {
+        uintptr_t begin;
+        uintptr_t end;
+        bool      write;
+    };
+
+    bool hipblas_concurrent_overlap(const hipblas_concurrent_range& a,
+                                    const hipblas_concurrent_range& b)
+    {
+        return (a.write || b.write) && a.begin < b.end && b.begin < a.end;
+    }
+}
+
+// Each stream of a group has its own handle, so calls queued on different streams never share
+// a workspace. The handles are created with the public API, so groups work the same on every
+// backend.
+struct hipblasConcurrentGroup
+{
+    struct member
+    {
+        hipblasHandle_t                       handle = nullptr;
+        hipStream_t                           stream = nullptr;
+        hipEvent_t                            event  = nullptr;
+        std::vector<hipblas_concurrent_range> ranges;
+    };
+
+    hipblasHandle_t     handle;
+    hipStream_t         user_stream = nullptr;
+    hipEvent_t          fork_event  = nullptr;
+    std::vector<member> members;
+    int                 next   = 0;
+    bool                active = false;
+
+    ~hipblasConcurrentGroup()
+    {
+        for(member& m : members)
+        {
+            if(m.handle)
+                hipblasDestroy(m.handle);
+            if(m.event)
+                (void)hipEventDestroy(m.event);
+            if(m.stream)
+                (void)hipStreamDestroy(m.stream);
+        }
+        if(fork_event)
+            (void)hipEventDestroy(fork_event);
+    }
+
+    // Copies the modes of the user handle to the handles of the group
+    hipblasStatus_t copy_modes()
+    {
+        hipblasPointerMode_t pointer_mode;
+        hipblasAtomicsMode_t atomics_mode;
+        hipblasMath_t        math_mode;
+        hipblasStatus_t      status;
+        if((status = hipblasGetPointerMode(handle, &pointer_mode)) != HIPBLAS_STATUS_SUCCESS
+           || (status = hipblasGetAtomicsMode(handle, &atomics_mode)) != HIPBLAS_STATUS_SUCCESS
+           || (status = hipblasGetMathMode(handle, &math_mode)) != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        for(member& m : members)
+        {
+            if((status = hipblasSetPointerMode(m.handle, pointer_mode)) != HIPBLAS_STATUS_SUCCESS
+               || (status = hipblasSetAtomicsMode(m.handle, atomics_mode))
+                      != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            // math modes that a backend doesn't support are left at its default
+            (void)hipblasSetMathMode(m.handle, math_mode);
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+};
+
+extern "C" hipblasStatus_t hipblasConcurrentGroupCreate(hipblasHandle_t           handle,
+                                                        int                       streamCount,
+                                                        hipblasConcurrentGroup_t* group)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(group == nullptr || streamCount < 1)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *group = nullptr;
+
+    auto* g   = new hipblasConcurrentGroup;
+    g->handle = handle;
+    g->members.resize(streamCount);
+
+    bool ok = hipEventCreateWithFlags(&g->fork_event, hipEventDisableTiming) == hipSuccess;
+    for(auto& m : g->members)
+    {
+        if(!ok)
+            break;
+        ok = hipStreamCreateWithFlags(&m.stream, hipStreamNonBlocking) == hipSuccess
+             && hipEventCreateWithFlags(&m.event, hipEventDisableTiming) == hipSuccess
+             && hipblasCreate(&m.handle) == HIPBLAS_STATUS_SUCCESS
+             && hipblasSetStream(m.handle, m.stream) == HIPBLAS_STATUS_SUCCESS;
+    }
+    if(!ok)
+    {
+        delete g;
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+
+    *group = g;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasConcurrentGroupDestroy(hipblasConcurrentGroup_t group)
+try
+{
+    if(group == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(group->active)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    delete group;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasConcurrentGroupBegin(hipblasConcurrentGroup_t group)
+try
+{
+    if(group == nullptr || group->active)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasStatus_t status = hipblasGetStream(group->handle, &group->user_stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = group->copy_modes();
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // every stream of the group starts after the work already queued on the user stream
+    if(hipEventRecord(group->fork_event, group->user_stream) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    for(auto& m : group->members)
+    {
+        if(hipStreamWaitEvent(m.stream, group->fork_event, 0) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        m.ranges.clear();
+    }
+
+    group->next   = 0;
+    group->active = true;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasConcurrentGroupNext(hipblasConcurrentGroup_t group,
+                                                      int                      readCount,
+                                                      const void* const*       reads,
+                                                      const size_t*            readSizes,
+                                                      int                      writeCount,
+                                                      const void* const*       writes,
+                                                      const size_t*            writeSizes,
+                                                      hipblasHandle_t*         handle)
+try
+{
+    if(group == nullptr || handle == nullptr || !group->active || readCount < 0 || writeCount < 0
+       || (readCount && (!reads || !readSizes)) || (writeCount && (!writes || !writeSizes)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *handle = nullptr;
+
+    std::vector<hipblas_concurrent_range> ranges;
+    ranges.reserve(readCount + writeCount);
+    for(int i = 0; i < readCount; i++)
+    {
+        auto begin = reinterpret_cast<uintptr_t>(reads[i]);
+        ranges.push_back({begin, begin + readSizes[i], false});
+    }
+    for(int i = 0; i < writeCount; i++)
+    {
+        auto begin = reinterpret_cast<uintptr_t>(writes[i]);
+        ranges.push_back({begin, begin + writeSizes[i], true});
+    }
+
+    // streams with queued calls that touch the new ranges
+    int              stream_count = group->members.size();
+    std::vector<int> conflicts;
+    for(int s = 0; s < stream_count; s++)
+    {
+        bool conflict = false;
+        for(auto& queued : group->members[s].ranges)
+        {
+            for(auto& range : ranges)
+                conflict = conflict || hipblas_concurrent_overlap(queued, range);
+            if(conflict)
+                break;
+        }
+        if(conflict)
+            conflicts.push_back(s);
+    }
+
+    // a call that depends on the calls of a single stream is queued after them on that stream,
+    // otherwise the next stream waits for every stream it depends on
+    int chosen;
+    if(conflicts.size() == 1)
+        chosen = conflicts[0];
+    else
+    {
+        chosen       = group->next;
+        group->next  = (group->next + 1) % stream_count;
+        auto& member = group->members[chosen];
+        for(int s : conflicts)
+        {
+            if(s == chosen)
+                continue;
+            auto& other = group->members[s];
+            if(hipEventRecord(other.event, other.stream) != hipSuccess
+               || hipStreamWaitEvent(member.stream, other.event, 0) != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+    }
+
+    auto& member = group->members[chosen];
+    member.ranges.insert(member.ranges.end(), ranges.begin(), ranges.end());
+    *handle = member.handle;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasConcurrentGroupEnd(hipblasConcurrentGroup_t group)
+try
+{
+    if(group == nullptr || !group->active)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    group->active = false;
+
+    // the user stream waits for the work queued on every stream of the group
+    for(auto& m : group->members)
+    {
+        m.ranges.clear();
+        if(hipEventRecord(m.event, m.stream) != hipSuccess
+           || hipStreamWaitEvent(group->user_stream, m.event, 0) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
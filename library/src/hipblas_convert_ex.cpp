@@ -0,0 +1,470 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "exceptions.hpp"
+#include "hipblas_device_convert.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_entry.hpp"
+
+// hipblasConvertEx and its batched forms, y := scale * x converted to the type of y, for the
+// real and complex floating point types down to the 8-bit ones. The elements are computed in
+// float, or in double when x or y is of a double type, and rounded to the type of y by the bits
+// of its format as in hipblas_device_convert.hpp. The kernels are instantiated for the sizes of
+// the components of x and y, with the formats as arguments, so that a pair of sizes serves all
+// the formats of those sizes. Each thread converts hipblas_convert_per_thread components a block
+// apart, so that the loads and stores of a warp are coalesced and each thread has several in
+// flight. The random bits of stochastic rounding are a hash of the index of the element in the
+// batch, so that they don't depend on the grid.
+
+namespace
+{
+    constexpr int hipblas_convert_threads    = 256;
+    constexpr int hipblas_convert_per_thread = 4;
+
+    // The type of a vector: the size of its components, 2 of them for the complex types, and
+    // their format, which isn't used for double
+    struct hipblas_convert_type
+    {
+        int                  size;
+        int                  components;
+        hipblas_float_format format;
+    };
+
+    bool hipblas_convert_type_of(hipDataType type, hipblas_convert_type* info)
+    {
+        switch(type)
+        {
+        case HIP_R_64F:
+        case HIP_C_64F:
+            *info = {8, 1, hipblas_format_f32};
+            break;
+        case HIP_R_32F:
+        case HIP_C_32F:
+            *info = {4, 1, hipblas_format_f32};
+            break;
+        case HIP_R_16F:
+        case HIP_C_16F:
+            *info = {2, 1, hipblas_format_f16};
+            break;
+        case HIP_R_16BF:
+        case HIP_C_16BF:
+            *info = {2, 1, hipblas_format_bf16};
+            break;
+        case HIP_R_8F_E4M3_FNUZ:
+            *info = {1, 1, hipblas_format_e4m3_fnuz};
+            break;
+        case HIP_R_8F_E5M2_FNUZ:
+            *info = {1, 1, hipblas_format_e5m2_fnuz};
+            break;
+#ifdef HIP_R_8F_E4M3
+        case HIP_R_8F_E4M3:
+            *info = {1, 1, hipblas_format_e4m3};
+            break;
+        case HIP_R_8F_E5M2:
+            *info = {1, 1, hipblas_format_e5m2};
+            break;
+#endif
+        default:
+            return false;
+        }
+        if(type == HIP_C_64F || type == HIP_C_32F || type == HIP_C_16F || type == HIP_C_16BF)
+            info->components = 2;
+        return true;
+    }
+
+    // y_b := scale * x_b for the vectors b of x and y, of n elements of the given number of
+    // components. x and y are arrays of pointers when batched.
+    struct hipblas_convert_problem
+    {
+        int64_t               n;
+        int                   components;
+        const void*           x;
+        int64_t               incx;
+        hipblasStride         stridex;
+        void*                 y;
+        int64_t               incy;
+        hipblasStride         stridey;
+        bool                  batched;
+        hipblas_float_format  x_format;
+        hipblas_float_format  y_format;
+        hipblasRoundingMode_t rounding;
+        uint64_t              seed; // of the random bits of HIPBLAS_ROUND_STOCHASTIC
+        bool                  saturate;
+        int                   batch_count;
+    };
+
+    // The type the elements are computed in, for components of XS and YS bytes
+    template <int XS, int YS>
+    using hipblas_convert_compute_t = std::conditional_t<XS == 8 || YS == 8, double, float>;
+
+    // The component t of a vector of n elements at increment inc, the first element being at
+    // the end of the vector for a negative inc
+    __device__ inline int64_t
+        hipblas_convert_offset(int64_t t, int64_t n, int64_t inc, int components)
+    {
+        int64_t i = components == 2 ? t >> 1 : t;
+        int64_t e = inc >= 0 ? i * inc : (n - 1 - i) * -inc;
+        return e * components + (t - i * components);
+    }
+
+    template <int S, typename Tc>
+    __device__ inline Tc hipblas_convert_load(const void* x, int64_t i, hipblas_float_format format)
+    {
+        if constexpr(S == 8)
+            return static_cast<const double*>(x)[i];
+        else if constexpr(S == 4)
+            return static_cast<const float*>(x)[i];
+        else if constexpr(S == 2)
+            return hipblas_float_decode(static_cast<const uint16_t*>(x)[i], format);
+        else
+            return hipblas_float_decode(static_cast<const uint8_t*>(x)[i], format);
+    }
+
+    // x * scale, rounded as the conversion is. Toward zero, the product rounded to nearest is
+    // stepped back toward zero when the error of the rounding, exact by fma, says it was
+    // rounded up in magnitude, so that it isn't rounded twice in different directions.
+    template <typename Tc>
+    __device__ inline Tc hipblas_convert_scale(Tc x, Tc scale, bool toward_zero)
+    {
+        Tc p = x * scale;
+        if(toward_zero && isfinite(x) && isfinite(scale))
+        {
+            if(isinf(p))
+                return copysign(std::numeric_limits<Tc>::max(), p);
+            Tc e = fma(x, scale, -p);
+            if((p > 0 && e < 0) || (p < 0 && e > 0))
+                p = nextafter(p, Tc(0));
+        }
+        return p;
+    }
+
+    template <int S, typename Tc>
+    __device__ inline void hipblas_convert_store(Tc                    v,
+                                                 void*                 y,
+                                                 int64_t               i,
+                                                 hipblas_float_format  format,
+                                                 hipblasRoundingMode_t rounding,
+                                                 bool                  saturate,
+                                                 uint32_t              random)
+    {
+        if constexpr(S == sizeof(Tc))
+        {
+            if(saturate && isinf(v))
+                v = copysign(std::numeric_limits<Tc>::max(), v);
+            static_cast<Tc*>(y)[i] = v;
+        }
+        else if constexpr(S == 4)
+            static_cast<uint32_t*>(y)[i]
+                = hipblas_float_encode(v, format, rounding, saturate, random);
+        else if constexpr(S == 2)
+            static_cast<uint16_t*>(y)[i]
+                = uint16_t(hipblas_float_encode(v, format, rounding, saturate, random));
+        else
+            static_cast<uint8_t*>(y)[i]
+                = uint8_t(hipblas_float_encode(v, format, rounding, saturate, random));
+    }
+
+    template <int XS, int YS>
+    __launch_bounds__(hipblas_convert_threads) __global__
+        void hipblasConvertKernel(hipblas_convert_problem           problem,
+                                  const void*                       scale_ptr,
+                                  hipblas_convert_compute_t<XS, YS> scale_value)
+    {
+        using Tc = hipblas_convert_compute_t<XS, YS>;
+
+        constexpr int tile        = hipblas_convert_threads * hipblas_convert_per_thread;
+        Tc            scale       = scale_ptr ? *static_cast<const Tc*>(scale_ptr) : scale_value;
+        int64_t       total       = problem.n * problem.components;
+        bool          toward_zero = problem.rounding == HIPBLAS_ROUND_TOWARD_ZERO;
+        bool          stochastic  = problem.rounding == HIPBLAS_ROUND_STOCHASTIC;
+
+        for(int b = blockIdx.y; b < problem.batch_count; b += gridDim.y)
+        {
+            int64_t     x_offset = b * problem.stridex * problem.components * XS;
+            int64_t     y_offset = b * problem.stridey * problem.components * YS;
+            const char* x        = problem.batched ? static_cast<const char* const*>(problem.x)[b]
+                                                   : static_cast<const char*>(problem.x) + x_offset;
+            char*       y        = problem.batched ? static_cast<char* const*>(problem.y)[b]
+                                                   : static_cast<char*>(problem.y) + y_offset;
+
+            for(int64_t base = int64_t(blockIdx.x) * tile; base < total;
+                base += int64_t(gridDim.x) * tile)
+            {
+                Tc v[hipblas_convert_per_thread];
+#pragma unroll
+                for(int k = 0; k < hipblas_convert_per_thread; k++)
+                {
+                    int64_t t = base + threadIdx.x + k * hipblas_convert_threads;
+                    if(t < total)
+                        v[k] = hipblas_convert_load<XS, Tc>(
+                            x,
+                            hipblas_convert_offset(t, problem.n, problem.incx, problem.components),
+                            problem.x_format);
+                }
+#pragma unroll
+                for(int k = 0; k < hipblas_convert_per_thread; k++)
+                {
+                    int64_t t = base + threadIdx.x + k * hipblas_convert_threads;
+                    if(t < total)
+                        hipblas_convert_store<YS>(
+                            hipblas_convert_scale(v[k], scale, toward_zero),
+                            y,
+                            hipblas_convert_offset(t, problem.n, problem.incy, problem.components),
+                            problem.y_format,
+                            problem.rounding,
+                            problem.saturate,
+                            stochastic ? hipblas_stochastic_bits(problem.seed, b * total + t) : 0);
+                }
+            }
+        }
+    }
+
+    template <int XS, int YS>
+    hipError_t hipblas_convert_launch(const hipblas_convert_problem& problem,
+                                      const void*                    scale,
+                                      bool                           device_scale,
+                                      hipStream_t                    stream)
+    {
+        using Tc = hipblas_convert_compute_t<XS, YS>;
+
+        // a missing scale is 1, and a scale on the host is passed by value
+        Tc scale_value = scale && !device_scale ? *static_cast<const Tc*>(scale) : Tc(1);
+
+        constexpr int64_t tile   = hipblas_convert_threads * hipblas_convert_per_thread;
+        int64_t           blocks = (problem.n * problem.components + tile - 1) / tile;
+        dim3              grid(int(std::min<int64_t>(blocks, 65535)),
+                  std::min(problem.batch_count, 65535));
+        hipblasConvertKernel<XS, YS><<<grid, hipblas_convert_threads, 0, stream>>>(
+            problem, device_scale ? scale : nullptr, scale_value);
+        return hipGetLastError();
+    }
+
+    template <int XS>
+    hipError_t hipblas_convert_launch(int                            y_size,
+                                      const hipblas_convert_problem& problem,
+                                      const void*                    scale,
+                                      bool                           device_scale,
+                                      hipStream_t                    stream)
+    {
+        switch(y_size)
+        {
+        case 8:
+            return hipblas_convert_launch<XS, 8>(problem, scale, device_scale, stream);
+        case 4:
+            return hipblas_convert_launch<XS, 4>(problem, scale, device_scale, stream);
+        case 2:
+            return hipblas_convert_launch<XS, 2>(problem, scale, device_scale, stream);
+        default:
+            return hipblas_convert_launch<XS, 1>(problem, scale, device_scale, stream);
+        }
+    }
+
+    hipblasStatus_t hipblasConvertExImpl(hipblasHandle_t         handle,
+                                         int                     n,
+                                         const void*             x,
+                                         hipDataType             xType,
+                                         int                     incx,
+                                         hipblasStride           stridex,
+                                         void*                   y,
+                                         hipDataType             yType,
+                                         int                     incy,
+                                         hipblasStride           stridey,
+                                         const void*             scale,
+                                         hipblasRoundingMode_t   rounding,
+                                         hipblasSaturationMode_t saturation,
+                                         bool                    batched,
+                                         int                     batch_count)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if((rounding != HIPBLAS_ROUND_NEAREST_EVEN && rounding != HIPBLAS_ROUND_TOWARD_ZERO
+            && rounding != HIPBLAS_ROUND_STOCHASTIC)
+           || (saturation != HIPBLAS_SATURATION_NONE && saturation != HIPBLAS_SATURATION_FINITE))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        // complex vectors convert to complex ones only
+        hipblas_convert_type x_info, y_info;
+        if(!hipblas_convert_type_of(xType, &x_info) || !hipblas_convert_type_of(yType, &y_info)
+           || x_info.components != y_info.components)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        if(n <= 0 || !batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!x || !y)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t          stream;
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasGetPointerMode(handle, &mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipblas_convert_problem problem{n,
+                                        x_info.components,
+                                        x,
+                                        incx,
+                                        stridex,
+                                        y,
+                                        incy,
+                                        stridey,
+                                        batched,
+                                        x_info.format,
+                                        y_info.format,
+                                        rounding,
+                                        rounding == HIPBLAS_ROUND_STOCHASTIC
+                                            ? hipblasNextStochasticSeed(handle)
+                                            : 0,
+                                        saturation == HIPBLAS_SATURATION_FINITE,
+                                        batch_count};
+
+        bool       device_scale = scale && mode == HIPBLAS_POINTER_MODE_DEVICE;
+        hipError_t err;
+        switch(x_info.size)
+        {
+        case 8:
+            err = hipblas_convert_launch<8>(y_info.size, problem, scale, device_scale, stream);
+            break;
+        case 4:
+            err = hipblas_convert_launch<4>(y_info.size, problem, scale, device_scale, stream);
+            break;
+        case 2:
+            err = hipblas_convert_launch<2>(y_info.size, problem, scale, device_scale, stream);
+            break;
+        default:
+            err = hipblas_convert_launch<1>(y_info.size, problem, scale, device_scale, stream);
+            break;
+        }
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+}
+
+extern "C" hipblasStatus_t hipblasConvertEx(hipblasHandle_t         handle,
+                                            int                     n,
+                                            const void*             x,
+                                            hipDataType             xType,
+                                            int                     incx,
+                                            void*                   y,
+                                            hipDataType             yType,
+                                            int                     incy,
+                                            const void*             scale,
+                                            hipblasRoundingMode_t   rounding,
+                                            hipblasSaturationMode_t saturation)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy);
+
+    return hipblasConvertExImpl(
+        handle, n, x, xType, incx, 0, y, yType, incy, 0, scale, rounding, saturation, false, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasConvertBatchedEx(hipblasHandle_t         handle,
+                                                   int                     n,
+                                                   const void*             x,
+                                                   hipDataType             xType,
+                                                   int                     incx,
+                                                   void*                   y,
+                                                   hipDataType             yType,
+                                                   int                     incy,
+                                                   const void*             scale,
+                                                   hipblasRoundingMode_t   rounding,
+                                                   hipblasSaturationMode_t saturation,
+                                                   int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, batchCount);
+
+    return hipblasConvertExImpl(handle,
+                                n,
+                                x,
+                                xType,
+                                incx,
+                                0,
+                                y,
+                                yType,
+                                incy,
+                                0,
+                                scale,
+                                rounding,
+                                saturation,
+                                true,
+                                batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasConvertStridedBatchedEx(hipblasHandle_t         handle,
+                                                          int                     n,
+                                                          const void*             x,
+                                                          hipDataType             xType,
+                                                          int                     incx,
+                                                          hipblasStride           stridex,
+                                                          void*                   y,
+                                                          hipDataType             yType,
+                                                          int                     incy,
+                                                          hipblasStride           stridey,
+                                                          const void*             scale,
+                                                          hipblasRoundingMode_t   rounding,
+                                                          hipblasSaturationMode_t saturation,
+                                                          int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, stridex, yType, incy, stridey, batchCount);
+
+    return hipblasConvertExImpl(handle,
+                                n,
+                                x,
+                                xType,
+                                incx,
+                                stridex,
+                                y,
+                                yType,
+                                incy,
+                                stridey,
+                                scale,
+                                rounding,
+                                saturation,
+                                false,
+                                batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
@@ -0,0 +1,507 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "exceptions.hpp"
+#include "hipblas_deferred.hpp"
+
+namespace
+{
+    size_t hipblas_deferred_type_size(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_32F:
+            return sizeof(float);
+        case HIP_R_64F:
+        case HIP_C_32F:
+            return sizeof(double);
+        case HIP_C_64F:
+            return 2 * sizeof(double);
+        default:
+            return 0;
+        }
+    }
+
+    // Bytes [begin, end) spanned by a column major matrix of rows x cols with leading dimension ld
+    struct hipblas_deferred_range
+    {
+        uintptr_t begin, end;
+    };
+
+    hipblas_deferred_range
+        hipblas_deferred_matrix(const void* p, int rows, int cols, int ld, size_t size)
+    {
+        auto begin = reinterpret_cast<uintptr_t>(p);
+        if(rows == 0 || cols == 0)
+            return {begin, begin};
+        return {begin, begin + (size_t(ld) * (cols - 1) + rows) * size};
+    }
+
+    bool hipblas_deferred_overlap(hipblas_deferred_range a, hipblas_deferred_range b)
+    {
+        return a.begin < b.end && b.begin < a.end;
+    }
+
+    hipblas_deferred_range hipblas_deferred_A(const hipblasDeferredGemm& g)
+    {
+        bool n = g.transa == HIPBLAS_OP_N;
+        return hipblas_deferred_matrix(
+            g.A, n ? g.m : g.k, n ? g.k : g.m, g.lda, hipblas_deferred_type_size(g.type));
+    }
+
+    hipblas_deferred_range hipblas_deferred_B(const hipblasDeferredGemm& g)
+    {
+        bool n = g.transb == HIPBLAS_OP_N;
+        return hipblas_deferred_matrix(
+            g.B, n ? g.k : g.n, n ? g.n : g.k, g.ldb, hipblas_deferred_type_size(g.type));
+    }
+
+    hipblas_deferred_range hipblas_deferred_C(const hipblasDeferredGemm& g)
+    {
+        return hipblas_deferred_matrix(g.C, g.m, g.n, g.ldc, hipblas_deferred_type_size(g.type));
+    }
+
+    // The real scalars of deferred calls are kept as doubles, rounded to the type of the call
+    double hipblas_deferred_round(double value, hipDataType type)
+    {
+        return type == HIP_R_32F ? double(float(value)) : value;
+    }
+
+    double hipblas_deferred_load(const void* p, hipDataType type)
+    {
+        return type == HIP_R_32F ? *static_cast<const float*>(p) : *static_cast<const double*>(p);
+    }
+
+    void hipblas_deferred_store(void* p, double value, hipDataType type)
+    {
+        if(type == HIP_R_32F)
+            *static_cast<float*>(p) = float(value);
+        else
+            *static_cast<double*>(p) = value;
+    }
+
+    // Runs the scal or axpy held back, if any, in host pointer mode
+    hipblasStatus_t hipblas_deferred_release(hipblasHandle_t handle, hipblasDeferredGemms& deferred)
+    {
+        if(!deferred.vector_pending)
+            return HIPBLAS_STATUS_SUCCESS;
+        deferred.vector_pending = false;
+
+        hipblasPointerMode_t user_mode;
+        hipblasStatus_t      status = hipblasGetPointerMode(handle, &user_mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(user_mode == HIPBLAS_POINTER_MODE_DEVICE
+           && (status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST))
+                  != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // the call goes through hipblasDeferVector, which lets it run while releasing is set
+        const hipblasDeferredVector& v = deferred.vector;
+        deferred.releasing             = true;
+        if(v.type == HIP_R_32F)
+        {
+            float  alpha = float(v.alpha);
+            float* y     = static_cast<float*>(v.y);
+            if(v.axpy)
+                status = hipblasSaxpy(handle, v.n, &alpha, static_cast<const float*>(v.x), 1, y, 1);
+            else
+                status = hipblasSscal(handle, v.n, &alpha, y, 1);
+        }
+        else
+        {
+            double  alpha = v.alpha;
+            double* y     = static_cast<double*>(v.y);
+            if(v.axpy)
+                status
+                    = hipblasDaxpy(handle, v.n, &alpha, static_cast<const double*>(v.x), 1, y, 1);
+            else
+                status = hipblasDscal(handle, v.n, &alpha, y, 1);
+        }
+        deferred.releasing = false;
+
+        if(user_mode == HIPBLAS_POINTER_MODE_DEVICE)
+            (void)hipblasSetPointerMode(handle, user_mode);
+        return status;
+    }
+
+    // Gemms that can run as one batched call: the same type, operations, sizes, leading
+    // dimensions and scalars
+    bool hipblas_deferred_same_batch(const hipblasDeferredGemm& a, const hipblasDeferredGemm& b)
+    {
+        if(a.type != b.type || a.transa != b.transa || a.transb != b.transb || a.m != b.m
+           || a.n != b.n || a.k != b.k || a.lda != b.lda || a.ldb != b.ldb || a.ldc != b.ldc
+           || a.host_scalars != b.host_scalars)
+            return false;
+        if(!a.host_scalars)
+            return a.alpha_ptr == b.alpha_ptr && a.beta_ptr == b.beta_ptr;
+        size_t size = hipblas_deferred_type_size(a.type);
+        return !memcmp(a.alpha, b.alpha, size) && !memcmp(a.beta, b.beta, size);
+    }
+
+    hipblasStatus_t hipblas_deferred_gemm_batched(hipblasHandle_t            handle,
+                                                  const hipblasDeferredGemm& g,
+                                                  void* const*               pointers,
+                                                  int                        batch_count)
+    {
+        const void* alpha = g.host_scalars ? g.alpha : g.alpha_ptr;
+        const void* beta  = g.host_scalars ? g.beta : g.beta_ptr;
+        void* const* A    = pointers;
+        void* const* B    = pointers + batch_count;
+        void* const* C    = pointers + 2 * batch_count;
+
+#define HIPBLAS_DEFERRED_GEMM_BATCHED(fn, T)   \
+    fn(handle,                                 \
+       g.transa,                               \
+       g.transb,                               \
+       g.m,                                    \
+       g.n,                                    \
+       g.k,                                    \
+       static_cast<const T*>(alpha),           \
+       reinterpret_cast<const T* const*>(A),   \
+       g.lda,                                  \
+       reinterpret_cast<const T* const*>(B),   \
+       g.ldb,                                  \
+       static_cast<const T*>(beta),            \
+       reinterpret_cast<T* const*>(C),         \
+       g.ldc,                                  \
+       batch_count)
+
+        switch(g.type)
+        {
+        case HIP_R_32F:
+            return HIPBLAS_DEFERRED_GEMM_BATCHED(hipblasSgemmBatched, float);
+        case HIP_R_64F:
+            return HIPBLAS_DEFERRED_GEMM_BATCHED(hipblasDgemmBatched, double);
+        case HIP_C_32F:
+            return HIPBLAS_DEFERRED_GEMM_BATCHED(hipblasCgemmBatched_v2, hipComplex);
+        case HIP_C_64F:
+            return HIPBLAS_DEFERRED_GEMM_BATCHED(hipblasZgemmBatched_v2, hipDoubleComplex);
+        default:
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+#undef HIPBLAS_DEFERRED_GEMM_BATCHED
+    }
+
+    // Runs the queued gemms of handle, grouped into batched calls in the order of the first gemm
+    // of each group. The pointer arrays of every group are copied to the device in one copy.
+    hipblasStatus_t hipblas_deferred_flush(hipblasHandle_t handle, hipblasDeferredGemms& deferred)
+    {
+        std::vector<hipblasDeferredGemm> queue;
+        queue.swap(deferred.queue);
+        if(queue.empty())
+            return HIPBLAS_STATUS_SUCCESS;
+
+        // the index of the first gemm of each group, and the gemms of the groups in order
+        std::vector<size_t>                                  firsts;
+        std::vector<std::vector<const hipblasDeferredGemm*>> groups;
+        for(const auto& g : queue)
+        {
+            size_t i = 0;
+            while(i < firsts.size() && !hipblas_deferred_same_batch(queue[firsts[i]], g))
+                i++;
+            if(i == firsts.size())
+            {
+                firsts.push_back(&g - queue.data());
+                groups.emplace_back();
+            }
+            groups[i].push_back(&g);
+        }
+
+        std::vector<void*> pointers;
+        pointers.reserve(3 * queue.size());
+        for(const auto& group : groups)
+        {
+            for(auto* g : group)
+                pointers.push_back(const_cast<void*>(g->A));
+            for(auto* g : group)
+                pointers.push_back(const_cast<void*>(g->B));
+            for(auto* g : group)
+                pointers.push_back(g->C);
+        }
+
+        size_t bytes = pointers.size() * sizeof(void*);
+        if(deferred.device_pointers_size < bytes)
+        {
+            if(deferred.device_pointers)
+                (void)hipFree(deferred.device_pointers);
+            deferred.device_pointers      = nullptr;
+            deferred.device_pointers_size = 0;
+            if(hipMalloc(&deferred.device_pointers, bytes) != hipSuccess)
+                return HIPBLAS_STATUS_ALLOC_FAILED;
+            deferred.device_pointers_size = bytes;
+        }
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(hipMemcpyAsync(
+               deferred.device_pointers, pointers.data(), bytes, hipMemcpyHostToDevice, stream)
+           != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        // the batched calls run with the handle in host pointer mode when the scalars were
+        // copied, whatever mode the handle is in now, and the mode is set back afterwards
+        hipblasPointerMode_t user_mode;
+        if((status = hipblasGetPointerMode(handle, &user_mode)) != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        hipblasPointerMode_t mode = user_mode;
+
+        auto* device_pointers = static_cast<void* const*>(deferred.device_pointers);
+        for(const auto& group : groups)
+        {
+            const hipblasDeferredGemm& g = *group[0];
+            hipblasPointerMode_t       group_mode
+                = g.host_scalars ? HIPBLAS_POINTER_MODE_HOST : HIPBLAS_POINTER_MODE_DEVICE;
+            if(group_mode != mode)
+            {
+                if((status = hipblasSetPointerMode(handle, group_mode)) != HIPBLAS_STATUS_SUCCESS)
+                    break;
+                mode = group_mode;
+            }
+            status = hipblas_deferred_gemm_batched(handle, g, device_pointers, group.size());
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                break;
+            device_pointers += 3 * group.size();
+        }
+
+        if(mode != user_mode)
+            (void)hipblasSetPointerMode(handle, user_mode);
+        return status;
+    }
+}
+
+hipblasStatus_t hipblasDeferGemm(hipblasHandle_t    handle,
+                                 hipDataType        type,
+                                 hipblasOperation_t transa,
+                                 hipblasOperation_t transb,
+                                 int                m,
+                                 int                n,
+                                 int                k,
+                                 const void*        alpha,
+                                 const void*        A,
+                                 int                lda,
+                                 const void*        B,
+                                 int                ldb,
+                                 const void*        beta,
+                                 void*              C,
+                                 int                ldc)
+{
+    auto valid_op = [](hipblasOperation_t op) {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    };
+    if(!valid_op(transa) || !valid_op(transb))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    bool na = transa == HIPBLAS_OP_N, nb = transb == HIPBLAS_OP_N;
+    if(m < 0 || n < 0 || k < 0 || lda < (na ? m : k) || lda < 1 || ldb < (nb ? k : n) || ldb < 1
+       || ldc < m || ldc < 1)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(m == 0 || n == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || (k && (!A || !B)) || !C)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasDeferredGemm g{};
+    g.type         = type;
+    g.transa       = transa;
+    g.transb       = transb;
+    g.m            = m;
+    g.n            = n;
+    g.k            = k;
+    g.lda          = lda;
+    g.ldb          = ldb;
+    g.ldc          = ldc;
+    g.host_scalars = mode != HIPBLAS_POINTER_MODE_DEVICE;
+    g.alpha_ptr    = alpha;
+    g.beta_ptr     = beta;
+    g.A            = A;
+    g.B            = B;
+    g.C            = C;
+    if(g.host_scalars)
+    {
+        memcpy(g.alpha, alpha, hipblas_deferred_type_size(type));
+        memcpy(g.beta, beta, hipblas_deferred_type_size(type));
+    }
+
+    hipblasDeferredGemms&  deferred = hipblasGetHandleState(handle)->deferred;
+    hipblas_deferred_range a = hipblas_deferred_A(g), b = hipblas_deferred_B(g),
+                           c = hipblas_deferred_C(g);
+
+    // a scal of exactly the elements of C, without padding between the columns, and not read
+    // through A or B, is folded into beta. A zero or non finite factor isn't, as the gemm
+    // doesn't read C when beta becomes zero.
+    if(deferred.vector_pending)
+    {
+        const hipblasDeferredVector& v = deferred.vector;
+        hipblas_deferred_range       x
+            = hipblas_deferred_matrix(v.y, 1, v.n, 1, hipblas_deferred_type_size(v.type));
+        if(!v.axpy && v.type == type && v.y == C && ldc == m && int64_t(m) * n == v.n
+           && g.host_scalars && std::isfinite(v.alpha) && v.alpha != 0
+           && !hipblas_deferred_overlap(x, a) && !hipblas_deferred_overlap(x, b))
+        {
+            double folded = hipblas_deferred_load(g.beta, type) * v.alpha;
+            hipblas_deferred_store(g.beta, hipblas_deferred_round(folded, type), type);
+            deferred.vector_pending = false;
+        }
+        else if((status = hipblas_deferred_release(handle, deferred)) != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+
+    // a gemm that reads or writes the matrix a queued gemm writes, or writes a matrix a queued
+    // gemm reads, runs after the queue so that the batch keeps the order of the calls
+    for(const auto& queued : deferred.queue)
+    {
+        hipblas_deferred_range qc = hipblas_deferred_C(queued);
+        if(hipblas_deferred_overlap(qc, a) || hipblas_deferred_overlap(qc, b)
+           || hipblas_deferred_overlap(qc, c)
+           || hipblas_deferred_overlap(hipblas_deferred_A(queued), c)
+           || hipblas_deferred_overlap(hipblas_deferred_B(queued), c))
+        {
+            if((status = hipblas_deferred_flush(handle, deferred)) != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            break;
+        }
+    }
+
+    deferred.queue.push_back(g);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasDeferVector(hipblasHandle_t handle,
+                                   int             n,
+                                   const void*     alpha,
+                                   const void*     x,
+                                   int             incx,
+                                   void*           y,
+                                   int             incy,
+                                   hipDataType     type)
+{
+    if(!hipblasIsDeferring(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    hipblasDeferredGemms& deferred = hipblasGetHandleState(handle)->deferred;
+    if(deferred.releasing)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // invalid and empty calls run now, for the backend to report
+    hipblasStatus_t status;
+    if(n <= 0 || !alpha || !y)
+    {
+        status = hipblas_deferred_release(handle, deferred);
+        return status != HIPBLAS_STATUS_SUCCESS ? status : HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    // the call runs after the queued gemms that touch the vector it writes, or write the vector
+    // it reads, held back or not
+    size_t                 size = hipblas_deferred_type_size(type);
+    hipblas_deferred_range w    = hipblas_deferred_matrix(y, 1, n, std::abs(incy), size);
+    hipblas_deferred_range r    = hipblas_deferred_matrix(x, 1, x ? n : 0, std::abs(incx), size);
+    for(const auto& queued : deferred.queue)
+    {
+        hipblas_deferred_range qc = hipblas_deferred_C(queued);
+        if(hipblas_deferred_overlap(qc, w) || hipblas_deferred_overlap(qc, r)
+           || hipblas_deferred_overlap(hipblas_deferred_A(queued), w)
+           || hipblas_deferred_overlap(hipblas_deferred_B(queued), w))
+        {
+            if((status = hipblas_deferred_flush(handle, deferred)) != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            break;
+        }
+    }
+
+    hipblasPointerMode_t mode;
+    if((status = hipblasGetPointerMode(handle, &mode)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    bool hold = (type == HIP_R_32F || type == HIP_R_64F) && mode != HIPBLAS_POINTER_MODE_DEVICE
+                && (!x || incx == 1) && incy == 1 && !hipblasIsReproducible(handle);
+    double scalar = hold ? hipblas_deferred_load(alpha, type) : 0;
+
+    // a scal of the vector the scal held back scales, or an axpy of the x and y of the axpy held
+    // back, is folded into it. Finite factors only, so that no infinity or NaN is made or lost.
+    hipblasDeferredVector& v = deferred.vector;
+    if(hold && deferred.vector_pending && v.type == type && v.axpy == (x != nullptr) && v.x == x
+       && v.y == y && v.n == n && std::isfinite(v.alpha) && std::isfinite(scalar))
+    {
+        v.alpha = hipblas_deferred_round(x ? v.alpha + scalar : v.alpha * scalar, type);
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    if((status = hipblas_deferred_release(handle, deferred)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(!hold)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    v                       = {type, x != nullptr, n, scalar, x, y};
+    deferred.vector_pending = true;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+extern "C" hipblasStatus_t hipblasBeginBatch(hipblasHandle_t handle)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(hipblasIsDeferring(handle))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasSetHandleDeferring(handle, true);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasEndBatch(hipblasHandle_t handle)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!hipblasIsDeferring(handle))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // the calls are run with the handle out of batch mode, so the batched calls aren't queued.
+    // The scal or axpy held back touches none of the queued gemms, so it can run first.
+    hipblasSetHandleDeferring(handle, false);
+    hipblasDeferredGemms& deferred = hipblasGetHandleState(handle)->deferred;
+    hipblasStatus_t       status   = hipblas_deferred_release(handle, deferred);
+    hipblasStatus_t       flushed  = hipblas_deferred_flush(handle, deferred);
+    return status != HIPBLAS_STATUS_SUCCESS ? status : flushed;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
@@ -0,0 +1,774 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <memory>
+
+#ifdef __HIP_PLATFORM_RCCL__
+#ifdef __HIP_PLATFORM_AMD__
+#include <rccl/rccl.h>
+#else
+#include <nccl.h>
+#endif
+#endif
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_entry.hpp"
+
+// The distributed functions, built on the public gemmEx so they are the same for both backends.
+// A grid has a stream for the broadcasts of the panels and two buffers for each of the panels
+// of A and B. The broadcasts into one buffer overlap the gemm that reads the other, with the
+// events loaded and consumed of each buffer ordering the two streams.
+struct hipblasDistGridContext
+{
+    int nprow  = 1;
+    int npcol  = 1;
+    int myrow  = 0;
+    int mycol  = 0;
+    int device = 0;
+
+#ifdef __HIP_PLATFORM_RCCL__
+    // comm of the caller, and the ranks of the process row, in the order of their columns, and
+    // of the process column
+    ncclComm_t comm     = nullptr;
+    ncclComm_t row_comm = nullptr;
+    ncclComm_t col_comm = nullptr;
+#endif
+
+    hipStream_t stream      = nullptr;
+    hipEvent_t  start       = nullptr;
+    hipEvent_t  loaded[2]   = {};
+    hipEvent_t  consumed[2] = {};
+    hipEvent_t  reduced     = nullptr;
+
+    void*  buffer      = nullptr;
+    size_t buffer_size = 0;
+
+    ~hipblasDistGridContext()
+    {
+        release();
+    }
+
+    void release();
+
+    // Grows buffer to size once the last call is done with it
+    hipblasStatus_t reserve(size_t size);
+};
+
+struct hipblasDistMatrixContext
+{
+    hipblasDistGrid_t grid;
+    int64_t           m, n, mb, nb;
+    hipDataType       type;
+    char*             local;
+    int64_t           lld, local_rows, local_cols;
+};
+
+namespace
+{
+    size_t hipblas_dist_size(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_8I:
+        case HIP_R_8U:
+            return 1;
+        case HIP_R_16F:
+        case HIP_R_16BF:
+        case HIP_C_8I:
+            return 2;
+        case HIP_R_32I:
+        case HIP_R_32F:
+            return 4;
+        case HIP_R_64F:
+        case HIP_C_32F:
+            return 8;
+        case HIP_C_64F:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+
+    // the rows or columns of an n long dimension in blocks of nb held by process iproc of
+    // nprocs, numroc of ScaLAPACK
+    int64_t hipblas_dist_numroc(int64_t n, int64_t nb, int iproc, int nprocs)
+    {
+        int64_t blocks = n / nb;
+        int64_t local  = blocks / nprocs * nb;
+        int64_t extra  = blocks % nprocs;
+        if(iproc < extra)
+            local += nb;
+        else if(iproc == extra)
+            local += n % nb;
+        return local;
+    }
+
+    // the number of tiles of columns of C a gemm followed by an all-reduce is split into, so
+    // that the all-reduces of all tiles but the last overlap the gemms of the next ones
+    constexpr int hipblas_dist_overlap_tiles = 4;
+
+#ifdef __HIP_PLATFORM_RCCL__
+    hipblasStatus_t hipblas_dist_status(ncclResult_t result)
+    {
+        return result == ncclSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    // the NCCL type of the real and imaginary parts of type, with the number of them per element
+    bool hipblas_dist_nccl_type(hipDataType type, ncclDataType_t& nccl_type, int& count)
+    {
+        count = 1;
+        switch(type)
+        {
+        case HIP_R_8I:
+            nccl_type = ncclInt8;
+            return true;
+        case HIP_R_8U:
+            nccl_type = ncclUint8;
+            return true;
+        case HIP_R_16F:
+            nccl_type = ncclFloat16;
+            return true;
+        case HIP_R_16BF:
+            nccl_type = ncclBfloat16;
+            return true;
+        case HIP_R_32I:
+            nccl_type = ncclInt32;
+            return true;
+        case HIP_R_32F:
+            nccl_type = ncclFloat32;
+            return true;
+        case HIP_R_64F:
+            nccl_type = ncclFloat64;
+            return true;
+        case HIP_C_32F:
+            count     = 2;
+            nccl_type = ncclFloat32;
+            return true;
+        case HIP_C_64F:
+            count     = 2;
+            nccl_type = ncclFloat64;
+            return true;
+        default:
+            return false;
+        }
+    }
+#endif
+}
+
+void hipblasDistGridContext::release()
+{
+    int previous;
+    if(hipGetDevice(&previous) != hipSuccess)
+        previous = device;
+    (void)hipSetDevice(device);
+#ifdef __HIP_PLATFORM_RCCL__
+    if(row_comm)
+        ncclCommDestroy(row_comm);
+    if(col_comm)
+        ncclCommDestroy(col_comm);
+#endif
+    if(buffer)
+        (void)hipFree(buffer);
+    if(stream)
+        (void)hipStreamDestroy(stream);
+    for(hipEvent_t event : {start, loaded[0], loaded[1], consumed[0], consumed[1], reduced})
+        if(event)
+            (void)hipEventDestroy(event);
+    (void)hipSetDevice(previous);
+}
+
+hipblasStatus_t hipblasDistGridContext::reserve(size_t size)
+{
+    if(size <= buffer_size)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    if(hipStreamSynchronize(stream) != hipSuccess || hipEventSynchronize(consumed[0]) != hipSuccess
+       || hipEventSynchronize(consumed[1]) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(buffer)
+        (void)hipFree(buffer);
+    buffer_size = 0;
+    if(hipMalloc(&buffer, size) != hipSuccess)
+    {
+        buffer = nullptr;
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    buffer_size = size;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+extern "C" hipblasStatus_t
+    hipblasDistGridCreate(hipblasDistGrid_t* grid, void* comm, int nprow, int npcol)
+try
+{
+    if(grid == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *grid = nullptr;
+    if(nprow < 1 || npcol < 1 || (!comm && int64_t(nprow) * npcol != 1))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    auto context = std::make_unique<hipblasDistGridContext>();
+    if(hipGetDevice(&context->device) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    context->nprow = nprow;
+    context->npcol = npcol;
+
+    if(comm)
+    {
+#ifdef __HIP_PLATFORM_RCCL__
+        ncclComm_t nccl_comm = static_cast<ncclComm_t>(comm);
+        int        count, rank;
+        if(ncclCommCount(nccl_comm, &count) != ncclSuccess
+           || ncclCommUserRank(nccl_comm, &rank) != ncclSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        if(int64_t(nprow) * npcol != count)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        context->comm  = nccl_comm;
+        context->myrow = rank / npcol;
+        context->mycol = rank % npcol;
+
+        hipblasStatus_t status = hipblas_dist_status(ncclCommSplit(
+            nccl_comm, context->myrow, context->mycol, &context->row_comm, nullptr));
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_dist_status(ncclCommSplit(
+                nccl_comm, context->mycol, context->myrow, &context->col_comm, nullptr));
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+#else
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+    }
+
+    if(hipStreamCreateWithFlags(&context->stream, hipStreamNonBlocking) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    for(hipEvent_t* event : {&context->start,
+                             &context->loaded[0],
+                             &context->loaded[1],
+                             &context->consumed[0],
+                             &context->consumed[1],
+                             &context->reduced})
+        if(hipEventCreateWithFlags(event, hipEventDisableTiming) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    *grid = context.release();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDistGridDestroy(hipblasDistGrid_t grid)
+try
+{
+    if(grid == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    delete grid;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDistGridGetInfo(hipblasDistGrid_t grid,
+                                                  int*              nprow,
+                                                  int*              npcol,
+                                                  int*              myrow,
+                                                  int*              mycol)
+try
+{
+    if(grid == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!nprow || !npcol || !myrow || !mycol)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *nprow = grid->nprow;
+    *npcol = grid->npcol;
+    *myrow = grid->myrow;
+    *mycol = grid->mycol;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDistGridGetLocalSize(hipblasDistGrid_t grid,
+                                                       int64_t           m,
+                                                       int64_t           n,
+                                                       int64_t           mb,
+                                                       int64_t           nb,
+                                                       int64_t*          localRows,
+                                                       int64_t*          localCols)
+try
+{
+    if(grid == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(m < 0 || n < 0 || mb < 1 || nb < 1 || !localRows || !localCols)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *localRows = hipblas_dist_numroc(m, mb, grid->myrow, grid->nprow);
+    *localCols = hipblas_dist_numroc(n, nb, grid->mycol, grid->npcol);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDistMatrixCreate(hipblasDistMatrix_t* matrix,
+                                                   hipblasDistGrid_t    grid,
+                                                   int64_t              m,
+                                                   int64_t              n,
+                                                   int64_t              mb,
+                                                   int64_t              nb,
+                                                   hipDataType          type,
+                                                   void*                local,
+                                                   int64_t              lld)
+try
+{
+    if(matrix == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *matrix = nullptr;
+    if(grid == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(m < 0 || n < 0 || mb < 1 || nb < 1)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!hipblas_dist_size(type))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    int64_t local_rows = hipblas_dist_numroc(m, mb, grid->myrow, grid->nprow);
+    int64_t local_cols = hipblas_dist_numroc(n, nb, grid->mycol, grid->npcol);
+    if(lld < std::max(int64_t(1), local_rows) || (!local && local_rows && local_cols))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *matrix = new hipblasDistMatrixContext{
+        grid, m, n, mb, nb, type, static_cast<char*>(local), lld, local_rows, local_cols};
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDistMatrixDestroy(hipblasDistMatrix_t matrix)
+try
+{
+    if(matrix == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    delete matrix;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDistGemm(hipblasHandle_t      handle,
+                                           const void*          alpha,
+                                           hipblasDistMatrix_t  A,
+                                           hipblasDistMatrix_t  B,
+                                           const void*          beta,
+                                           hipblasDistMatrix_t  C,
+                                           hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_ENTRY(handle, computeType);
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!A || !B || !C || !alpha || !beta)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasDistGrid_t grid = C->grid;
+    if(A->grid != grid || B->grid != grid || A->m != C->m || B->n != C->n || A->n != B->m
+       || A->mb != C->mb || B->nb != C->nb || A->nb != B->mb)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int64_t m_local = C->local_rows;
+    int64_t n_local = C->local_cols;
+    int64_t k       = A->n;
+    int64_t kb      = A->nb;
+    size_t  a_size  = hipblas_dist_size(A->type);
+    size_t  b_size  = hipblas_dist_size(B->type);
+    if(!C->m || !C->n)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetPointerMode(handle, &mode)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    auto gemm = [&](int64_t     k_gemm,
+                    const void* a,
+                    int64_t     lda,
+                    const void* b,
+                    int64_t     ldb,
+                    const void* gemm_beta) -> hipblasStatus_t {
+        if(m_local <= INT_MAX && n_local <= INT_MAX && k_gemm <= INT_MAX && lda <= INT_MAX
+           && ldb <= INT_MAX && C->lld <= INT_MAX)
+            return hipblasGemmEx_v2(handle,
+                                    HIPBLAS_OP_N,
+                                    HIPBLAS_OP_N,
+                                    int(m_local),
+                                    int(n_local),
+                                    int(k_gemm),
+                                    alpha,
+                                    a,
+                                    A->type,
+                                    int(lda),
+                                    b,
+                                    B->type,
+                                    int(ldb),
+                                    gemm_beta,
+                                    C->local,
+                                    C->type,
+                                    int(C->lld),
+                                    computeType,
+                                    HIPBLAS_GEMM_DEFAULT);
+        return hipblasGemmEx_v2_64(handle,
+                                   HIPBLAS_OP_N,
+                                   HIPBLAS_OP_N,
+                                   m_local,
+                                   n_local,
+                                   k_gemm,
+                                   alpha,
+                                   a,
+                                   A->type,
+                                   lda,
+                                   b,
+                                   B->type,
+                                   ldb,
+                                   gemm_beta,
+                                   C->local,
+                                   C->type,
+                                   C->lld,
+                                   computeType,
+                                   HIPBLAS_GEMM_DEFAULT);
+    };
+
+    // C := beta * C
+    if(!k)
+        return gemm(0, A->local, A->lld, B->local, B->lld, beta);
+
+    // the panels after the first are added to C with a beta of one, on the device in device
+    // pointer mode
+    char one[16] = {};
+    hipblas_scalar_one(computeType, one);
+    const void* gemm_one = one;
+    if(mode == HIPBLAS_POINTER_MODE_DEVICE)
+    {
+        void* d_one = hipblasGetScratch(handle, sizeof(one), stream);
+        if(!d_one)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        if(hipMemcpyAsync(d_one, one, sizeof(one), hipMemcpyHostToDevice, stream) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        gemm_one = d_one;
+    }
+
+    // the panels of the process that holds them are read from its part of A and B, and only
+    // copied into a buffer when they are sent and not contiguous
+    bool   send_a       = grid->npcol > 1;
+    bool   send_b       = grid->nprow > 1;
+    size_t a_panel_size = hipblas_scratch_pad(m_local * kb * a_size);
+    size_t b_panel_size = hipblas_scratch_pad(kb * n_local * b_size);
+    status = grid->reserve(2 * ((send_a ? a_panel_size : 0) + (send_b ? b_panel_size : 0)));
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    char* a_buffers[2] = {};
+    char* b_buffers[2] = {};
+    char* next         = static_cast<char*>(grid->buffer);
+    for(int s = 0; s < 2; s++)
+    {
+        a_buffers[s] = send_a ? next : nullptr;
+        next += send_a ? a_panel_size : 0;
+        b_buffers[s] = send_b ? next : nullptr;
+        next += send_b ? b_panel_size : 0;
+    }
+
+    // the broadcasts read A and B after the work queued before the call
+    if((send_a || send_b)
+       && (hipEventRecord(grid->start, stream) != hipSuccess
+           || hipStreamWaitEvent(grid->stream, grid->start, 0) != hipSuccess))
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    int64_t blocks = (k + kb - 1) / kb;
+    for(int64_t block = 0; block < blocks; block++)
+    {
+        int     s        = block % 2;
+        int64_t k_panel  = std::min(kb, k - block * kb);
+        int     a_root   = block % grid->npcol;
+        int     b_root   = block % grid->nprow;
+        char*   a_panel  = A->local + (block / grid->npcol) * kb * A->lld * a_size;
+        char*   b_panel  = B->local + (block / grid->nprow) * kb * b_size;
+        int64_t lda      = A->lld;
+        int64_t ldb      = B->lld;
+        bool    a_holder = grid->mycol == a_root;
+        bool    b_holder = grid->myrow == b_root;
+
+        if(send_a || send_b)
+        {
+            if(hipStreamWaitEvent(grid->stream, grid->consumed[s], 0) != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+            char* a_send = a_holder && A->lld == m_local ? a_panel : a_buffers[s];
+            char* b_send = b_holder && B->lld == k_panel ? b_panel : b_buffers[s];
+            if(send_a && a_holder && a_send != a_panel && m_local
+               && hipMemcpy2DAsync(a_send,
+                                   m_local * a_size,
+                                   a_panel,
+                                   A->lld * a_size,
+                                   m_local * a_size,
+                                   k_panel,
+                                   hipMemcpyDeviceToDevice,
+                                   grid->stream)
+                      != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+            if(send_b && b_holder && b_send != b_panel && n_local
+               && hipMemcpy2DAsync(b_send,
+                                   k_panel * b_size,
+                                   b_panel,
+                                   B->lld * b_size,
+                                   k_panel * b_size,
+                                   n_local,
+                                   hipMemcpyDeviceToDevice,
+                                   grid->stream)
+                      != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+#ifdef __HIP_PLATFORM_RCCL__
+            // the processes of a row all have the rows of C, and those of a column its columns,
+            // so the panels have the same size on all of them
+            status = hipblas_dist_status(ncclGroupStart());
+            if(status == HIPBLAS_STATUS_SUCCESS && send_a)
+                status = hipblas_dist_status(ncclBroadcast(a_send,
+                                                           a_send,
+                                                           m_local * k_panel * a_size,
+                                                           ncclUint8,
+                                                           a_root,
+                                                           grid->row_comm,
+                                                           grid->stream));
+            if(status == HIPBLAS_STATUS_SUCCESS && send_b)
+                status = hipblas_dist_status(ncclBroadcast(b_send,
+                                                           b_send,
+                                                           k_panel * n_local * b_size,
+                                                           ncclUint8,
+                                                           b_root,
+                                                           grid->col_comm,
+                                                           grid->stream));
+            hipblasStatus_t end_status = hipblas_dist_status(ncclGroupEnd());
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = end_status;
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+#endif
+
+            if(hipEventRecord(grid->loaded[s], grid->stream) != hipSuccess
+               || hipStreamWaitEvent(stream, grid->loaded[s], 0) != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+            if(send_a && !a_holder)
+            {
+                a_panel = a_buffers[s];
+                lda     = std::max(int64_t(1), m_local);
+            }
+            if(send_b && !b_holder)
+            {
+                b_panel = b_buffers[s];
+                ldb     = k_panel;
+            }
+        }
+
+        status = gemm(k_panel, a_panel, lda, b_panel, ldb, block ? gemm_one : beta);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        if((send_a || send_b) && hipEventRecord(grid->consumed[s], stream) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGemmExAllReduce(hipblasHandle_t      handle,
+                                                  hipblasDistGrid_t    grid,
+                                                  hipblasOperation_t   transA,
+                                                  hipblasOperation_t   transB,
+                                                  int                  m,
+                                                  int                  n,
+                                                  int                  k,
+                                                  const void*          alpha,
+                                                  const void*          A,
+                                                  hipDataType          aType,
+                                                  int                  lda,
+                                                  const void*          B,
+                                                  hipDataType          bType,
+                                                  int                  ldb,
+                                                  const void*          beta,
+                                                  void*                C,
+                                                  hipDataType          cType,
+                                                  int                  ldc,
+                                                  hipblasComputeType_t computeType,
+                                                  hipblasGemmAlgo_t    algo)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, transA, transB, m, n, k, aType, lda, bType, ldb, cType, ldc, computeType, algo);
+
+    if(!handle || !grid)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    auto gemm = [&](int col, int cols) -> hipblasStatus_t {
+        size_t b_offset = transB == HIPBLAS_OP_N ? size_t(col) * ldb : col;
+        return hipblasGemmEx_v2(handle,
+                                transA,
+                                transB,
+                                m,
+                                cols,
+                                k,
+                                alpha,
+                                A,
+                                aType,
+                                lda,
+                                B ? static_cast<const char*>(B)
+                                        + b_offset * hipblas_dist_size(bType)
+                                  : nullptr,
+                                bType,
+                                ldb,
+                                beta,
+                                C ? static_cast<char*>(C)
+                                        + size_t(col) * ldc * hipblas_dist_size(cType)
+                                  : nullptr,
+                                cType,
+                                ldc,
+                                computeType,
+                                algo);
+    };
+
+    // a single process has nothing to reduce, and the checks of the arguments are those of the
+    // gemm
+    bool reduce = grid->nprow * grid->npcol > 1;
+    if(!reduce || m <= 0 || n <= 0)
+        return gemm(0, n);
+    if(!hipblas_dist_size(bType) || !hipblas_dist_size(cType))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+#ifdef __HIP_PLATFORM_RCCL__
+    ncclDataType_t nccl_type;
+    int            parts;
+    if(!hipblas_dist_nccl_type(cType, nccl_type, parts))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // the tiles are packed into the buffer of the grid when the columns of C aren't contiguous,
+    // so that the padding between them isn't reduced
+    size_t c_size = hipblas_dist_size(cType);
+    bool   packed = ldc != m;
+    if(packed && (status = grid->reserve(size_t(m) * n * c_size)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // the buffer may still be read by the gemms of hipblasDistGemm
+    if(hipStreamWaitEvent(grid->stream, grid->consumed[0], 0) != hipSuccess
+       || hipStreamWaitEvent(grid->stream, grid->consumed[1], 0) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    int tile = (n + hipblas_dist_overlap_tiles - 1) / hipblas_dist_overlap_tiles;
+    for(int col = 0; col < n; col += tile)
+    {
+        int cols = std::min(tile, n - col);
+        if((status = gemm(col, cols)) != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // the all-reduce of a tile waits for its gemm only, the event being waited for as
+        // recorded when the wait is queued
+        if(hipEventRecord(grid->loaded[0], stream) != hipSuccess
+           || hipStreamWaitEvent(grid->stream, grid->loaded[0], 0) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        char* c_tile = static_cast<char*>(C) + size_t(col) * ldc * c_size;
+        char* reduce_tile
+            = packed ? static_cast<char*>(grid->buffer) + size_t(col) * m * c_size : c_tile;
+        if(packed
+           && hipMemcpy2DAsync(reduce_tile,
+                               m * c_size,
+                               c_tile,
+                               ldc * c_size,
+                               m * c_size,
+                               cols,
+                               hipMemcpyDeviceToDevice,
+                               grid->stream)
+                  != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        status = hipblas_dist_status(ncclAllReduce(reduce_tile,
+                                                   reduce_tile,
+                                                   size_t(m) * cols * parts,
+                                                   nccl_type,
+                                                   ncclSum,
+                                                   grid->comm,
+                                                   grid->stream));
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        if(packed
+           && hipMemcpy2DAsync(c_tile,
+                               ldc * c_size,
+                               reduce_tile,
+                               m * c_size,
+                               m * c_size,
+                               cols,
+                               hipMemcpyDeviceToDevice,
+                               grid->stream)
+                  != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    // the work queued after the call on the stream of handle sees the reduced C
+    if(hipEventRecord(grid->reduced, grid->stream) != hipSuccess
+       || hipStreamWaitEvent(stream, grid->reduced, 0) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    return HIPBLAS_STATUS_SUCCESS;
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
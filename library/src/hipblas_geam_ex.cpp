@@ -0,0 +1,544 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_complex.h>
+#include <hip/hip_fp16.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_entry.hpp"
+
+// hipblasGeamEx and its batched and strided batched forms. Neither rocBLAS nor cuBLAS has a
+// geam with separate types, so this is one kernel for both backends: each block writes a tile
+// of C, reading A and B in tiles through shared memory when they are transposed so that every
+// element of A, B and C is read or written once, with coalesced accesses.
+
+namespace
+{
+    constexpr int hipblas_geam_ex_tile = 32;
+    constexpr int hipblas_geam_ex_rows = 8;
+
+    // The matrix b of a batch, from an array of pointers or at a stride from the first one
+    template <typename T>
+    __device__ inline const T*
+        hipblas_geam_ex_matrix(const void* X, hipblasStride stride, bool batched, int b)
+    {
+        return batched ? static_cast<const T* const*>(X)[b] : static_cast<const T*>(X) + b * stride;
+    }
+
+    // Loads the tile of op(X) at rows i0 and columns j0 into tile, in the type of the scalars.
+    // tile[tx][ty] is op(X)(i0 + tx, j0 + ty) either way, read in columns of X.
+    template <typename TX, typename TS>
+    __device__ inline void hipblas_geam_ex_load_tile(TS (*tile)[hipblas_geam_ex_tile + 1],
+                                                     const TX*          X,
+                                                     int                ldx,
+                                                     hipblasOperation_t trans,
+                                                     int                m,
+                                                     int                n,
+                                                     int                i0,
+                                                     int                j0)
+    {
+        int tx = threadIdx.x;
+        for(int ty = threadIdx.y; ty < hipblas_geam_ex_tile; ty += hipblas_geam_ex_rows)
+        {
+            if(trans == HIPBLAS_OP_N)
+            {
+                int i = i0 + tx, j = j0 + ty;
+                if(i < m && j < n)
+                    tile[tx][ty] = hipblas_device_load(X[i + size_t(j) * ldx]);
+            }
+            else
+            {
+                // op(X)(i, j) is X(j, i), with the row j running along the threads of a warp
+                int i = i0 + ty, j = j0 + tx;
+                if(i < m && j < n)
+                {
+                    TS x = hipblas_device_load(X[j + size_t(i) * ldx]);
+                    tile[ty][tx] = trans == HIPBLAS_OP_C ? hipblas_device_conj(x) : x;
+                }
+            }
+        }
+    }
+
+    // C_b := alpha * op(A_b) + beta * op(B_b). A_b isn't read when alpha is zero and B_b isn't
+    // read when beta is zero. The scalars are read from alpha and beta when they aren't
+    // nullptr, in device pointer mode, and are alpha_value and beta_value otherwise.
+    template <typename TA, typename TB, typename TC, typename TS>
+    __global__ void hipblasGeamExKernel(hipblasOperation_t transA,
+                                        hipblasOperation_t transB,
+                                        int                m,
+                                        int                n,
+                                        const TS*          alpha,
+                                        TS                 alpha_value,
+                                        const void*        A,
+                                        int                lda,
+                                        hipblasStride      strideA,
+                                        const TS*          beta,
+                                        TS                 beta_value,
+                                        const void*        B,
+                                        int                ldb,
+                                        hipblasStride      strideB,
+                                        void*              C,
+                                        int                ldc,
+                                        hipblasStride      strideC,
+                                        bool               batched,
+                                        int                batch_count)
+    {
+        __shared__ TS tile_a[hipblas_geam_ex_tile][hipblas_geam_ex_tile + 1];
+        __shared__ TS tile_b[hipblas_geam_ex_tile][hipblas_geam_ex_tile + 1];
+
+        TS   a      = alpha ? *alpha : alpha_value;
+        TS   bt     = beta ? *beta : beta_value;
+        bool read_a = !hipblas_device_is_zero(a);
+        bool read_b = !hipblas_device_is_zero(bt);
+        int  i0     = blockIdx.x * hipblas_geam_ex_tile;
+        int  j0     = blockIdx.y * hipblas_geam_ex_tile;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            const TA* Ab = read_a ? hipblas_geam_ex_matrix<TA>(A, strideA, batched, b) : nullptr;
+            const TB* Bb = read_b ? hipblas_geam_ex_matrix<TB>(B, strideB, batched, b) : nullptr;
+            if(read_a)
+                hipblas_geam_ex_load_tile(tile_a, Ab, lda, transA, m, n, i0, j0);
+            if(read_b)
+                hipblas_geam_ex_load_tile(tile_b, Bb, ldb, transB, m, n, i0, j0);
+            __syncthreads();
+
+            TC* Cb = batched ? static_cast<TC* const*>(C)[b] : static_cast<TC*>(C) + b * strideC;
+            int tx = threadIdx.x;
+            for(int ty = threadIdx.y; ty < hipblas_geam_ex_tile; ty += hipblas_geam_ex_rows)
+            {
+                int i = i0 + tx, j = j0 + ty;
+                if(i >= m || j >= n)
+                    continue;
+
+                TS x = read_a ? tile_a[tx][ty] : TS{};
+                TS y = read_b ? tile_b[tx][ty] : TS{};
+                hipblas_device_store(hipblas_device_axpby(a, x, bt, y), Cb[i + size_t(j) * ldc]);
+            }
+
+            // the tiles are reused by the next matrix of the batch
+            __syncthreads();
+        }
+    }
+
+    template <typename TA, typename TB, typename TC, typename TS>
+    hipError_t hipblas_geam_ex_launch(hipblasOperation_t transA,
+                                      hipblasOperation_t transB,
+                                      int                m,
+                                      int                n,
+                                      const void*        alpha,
+                                      bool               host_scalars,
+                                      const void*        A,
+                                      int                lda,
+                                      hipblasStride      strideA,
+                                      const void*        beta,
+                                      const void*        B,
+                                      int                ldb,
+                                      hipblasStride      strideB,
+                                      void*              C,
+                                      int                ldc,
+                                      hipblasStride      strideC,
+                                      bool               batched,
+                                      int                batch_count,
+                                      hipStream_t        stream)
+    {
+        TS alpha_value{}, beta_value{};
+        if(host_scalars)
+        {
+            alpha_value = *static_cast<const TS*>(alpha);
+            beta_value  = *static_cast<const TS*>(beta);
+        }
+
+        dim3 grid((m - 1) / hipblas_geam_ex_tile + 1,
+                  (n - 1) / hipblas_geam_ex_tile + 1,
+                  std::min(batch_count, 65535));
+        dim3 threads(hipblas_geam_ex_tile, hipblas_geam_ex_rows);
+        hipblasGeamExKernel<TA, TB, TC, TS>
+            <<<grid, threads, 0, stream>>>(transA,
+                                           transB,
+                                           m,
+                                           n,
+                                           host_scalars ? nullptr : (const TS*)alpha,
+                                           alpha_value,
+                                           A,
+                                           lda,
+                                           strideA,
+                                           host_scalars ? nullptr : (const TS*)beta,
+                                           beta_value,
+                                           B,
+                                           ldb,
+                                           strideB,
+                                           C,
+                                           ldc,
+                                           strideC,
+                                           batched,
+                                           batch_count);
+        return hipGetLastError();
+    }
+
+    using hipblas_geam_ex_fn = hipError_t (*)(hipblasOperation_t,
+                                              hipblasOperation_t,
+                                              int,
+                                              int,
+                                              const void*,
+                                              bool,
+                                              const void*,
+                                              int,
+                                              hipblasStride,
+                                              const void*,
+                                              const void*,
+                                              int,
+                                              hipblasStride,
+                                              void*,
+                                              int,
+                                              hipblasStride,
+                                              bool,
+                                              int,
+                                              hipStream_t);
+
+    // With float computation A, B and C can each be half, bfloat16 or float
+    template <typename TA, typename TB>
+    hipblas_geam_ex_fn hipblas_geam_ex_float_c(hipDataType c_type)
+    {
+        switch(c_type)
+        {
+        case HIP_R_16F:
+            return hipblas_geam_ex_launch<TA, TB, __half, float>;
+        case HIP_R_16BF:
+            return hipblas_geam_ex_launch<TA, TB, hipblas_device_bf16, float>;
+        case HIP_R_32F:
+            return hipblas_geam_ex_launch<TA, TB, float, float>;
+        default:
+            return nullptr;
+        }
+    }
+
+    template <typename TA>
+    hipblas_geam_ex_fn hipblas_geam_ex_float_b(hipDataType b_type, hipDataType c_type)
+    {
+        switch(b_type)
+        {
+        case HIP_R_16F:
+            return hipblas_geam_ex_float_c<TA, __half>(c_type);
+        case HIP_R_16BF:
+            return hipblas_geam_ex_float_c<TA, hipblas_device_bf16>(c_type);
+        case HIP_R_32F:
+            return hipblas_geam_ex_float_c<TA, float>(c_type);
+        default:
+            return nullptr;
+        }
+    }
+
+    // The kernel for the types of A, B and C and computeType, the type of the scalars, or
+    // nullptr for the types it doesn't support
+    hipblas_geam_ex_fn hipblas_geam_ex_kernel(hipDataType          a_type,
+                                              hipDataType          b_type,
+                                              hipDataType          c_type,
+                                              hipblasComputeType_t compute_type)
+    {
+        bool same_type = a_type == b_type && b_type == c_type;
+        switch(compute_type)
+        {
+        case HIPBLAS_COMPUTE_32F:
+        case HIPBLAS_COMPUTE_32F_PEDANTIC:
+            if(same_type && c_type == HIP_C_32F)
+                return hipblas_geam_ex_launch<hipFloatComplex,
+                                              hipFloatComplex,
+                                              hipFloatComplex,
+                                              hipFloatComplex>;
+            switch(a_type)
+            {
+            case HIP_R_16F:
+                return hipblas_geam_ex_float_b<__half>(b_type, c_type);
+            case HIP_R_16BF:
+                return hipblas_geam_ex_float_b<hipblas_device_bf16>(b_type, c_type);
+            case HIP_R_32F:
+                return hipblas_geam_ex_float_b<float>(b_type, c_type);
+            default:
+                return nullptr;
+            }
+        case HIPBLAS_COMPUTE_64F:
+        case HIPBLAS_COMPUTE_64F_PEDANTIC:
+            if(same_type && c_type == HIP_R_64F)
+                return hipblas_geam_ex_launch<double, double, double, double>;
+            if(same_type && c_type == HIP_C_64F)
+                return hipblas_geam_ex_launch<hipDoubleComplex,
+                                              hipDoubleComplex,
+                                              hipDoubleComplex,
+                                              hipDoubleComplex>;
+            return nullptr;
+        default:
+            return nullptr;
+        }
+    }
+
+    hipblasStatus_t hipblasGeamExImpl(hipblasHandle_t      handle,
+                                      hipblasOperation_t   transA,
+                                      hipblasOperation_t   transB,
+                                      int                  m,
+                                      int                  n,
+                                      const void*          alpha,
+                                      const void*          A,
+                                      hipDataType          aType,
+                                      int                  lda,
+                                      hipblasStride        strideA,
+                                      const void*          beta,
+                                      const void*          B,
+                                      hipDataType          bType,
+                                      int                  ldb,
+                                      hipblasStride        strideB,
+                                      void*                C,
+                                      hipDataType          cType,
+                                      int                  ldc,
+                                      hipblasStride        strideC,
+                                      bool                 batched,
+                                      int                  batchCount,
+                                      hipblasComputeType_t computeType)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+        auto valid_trans = [](hipblasOperation_t trans) {
+            return trans == HIPBLAS_OP_N || trans == HIPBLAS_OP_T || trans == HIPBLAS_OP_C;
+        };
+        if(!valid_trans(transA) || !valid_trans(transB))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+        int rows_a = transA == HIPBLAS_OP_N ? m : n;
+        int rows_b = transB == HIPBLAS_OP_N ? m : n;
+        if(m < 0 || n < 0 || batchCount < 0 || lda < std::max(rows_a, 1)
+           || ldb < std::max(rows_b, 1) || ldc < std::max(m, 1))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!m || !n || !batchCount)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !beta || !C)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        auto geam = hipblas_geam_ex_kernel(aType, bType, cType, computeType);
+        if(!geam)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        hipStream_t          stream;
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS
+           || (status = hipblasGetPointerMode(handle, &mode)) != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        if(geam(transA,
+                transB,
+                m,
+                n,
+                alpha,
+                mode != HIPBLAS_POINTER_MODE_DEVICE,
+                A,
+                lda,
+                strideA,
+                beta,
+                B,
+                ldb,
+                strideB,
+                C,
+                ldc,
+                strideC,
+                batched,
+                batchCount,
+                stream)
+           != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+extern "C" hipblasStatus_t hipblasGeamEx(hipblasHandle_t      handle,
+                                         hipblasOperation_t   transA,
+                                         hipblasOperation_t   transB,
+                                         int                  m,
+                                         int                  n,
+                                         const void*          alpha,
+                                         const void*          A,
+                                         hipDataType          aType,
+                                         int                  lda,
+                                         const void*          beta,
+                                         const void*          B,
+                                         hipDataType          bType,
+                                         int                  ldb,
+                                         void*                C,
+                                         hipDataType          cType,
+                                         int                  ldc,
+                                         hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_ENTRY(handle, transA, transB, m, n, aType, lda, bType, ldb, cType, ldc, computeType);
+
+    return hipblasGeamExImpl(handle,
+                             transA,
+                             transB,
+                             m,
+                             n,
+                             alpha,
+                             A,
+                             aType,
+                             lda,
+                             0,
+                             beta,
+                             B,
+                             bType,
+                             ldb,
+                             0,
+                             C,
+                             cType,
+                             ldc,
+                             0,
+                             false,
+                             1,
+                             computeType);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGeamBatchedEx(hipblasHandle_t      handle,
+                                                hipblasOperation_t   transA,
+                                                hipblasOperation_t   transB,
+                                                int                  m,
+                                                int                  n,
+                                                const void*          alpha,
+                                                const void* const    A[],
+                                                hipDataType          aType,
+                                                int                  lda,
+                                                const void*          beta,
+                                                const void* const    B[],
+                                                hipDataType          bType,
+                                                int                  ldb,
+                                                void* const          C[],
+                                                hipDataType          cType,
+                                                int                  ldc,
+                                                int                  batchCount,
+                                                hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, transA, transB, m, n, aType, lda, bType, ldb, cType, ldc, batchCount, computeType);
+
+    return hipblasGeamExImpl(handle,
+                             transA,
+                             transB,
+                             m,
+                             n,
+                             alpha,
+                             A,
+                             aType,
+                             lda,
+                             0,
+                             beta,
+                             B,
+                             bType,
+                             ldb,
+                             0,
+                             (void*)C,
+                             cType,
+                             ldc,
+                             0,
+                             true,
+                             batchCount,
+                             computeType);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGeamStridedBatchedEx(hipblasHandle_t      handle,
+                                                       hipblasOperation_t   transA,
+                                                       hipblasOperation_t   transB,
+                                                       int                  m,
+                                                       int                  n,
+                                                       const void*          alpha,
+                                                       const void*          A,
+                                                       hipDataType          aType,
+                                                       int                  lda,
+                                                       hipblasStride        strideA,
+                                                       const void*          beta,
+                                                       const void*          B,
+                                                       hipDataType          bType,
+                                                       int                  ldb,
+                                                       hipblasStride        strideB,
+                                                       void*                C,
+                                                       hipDataType          cType,
+                                                       int                  ldc,
+                                                       hipblasStride        strideC,
+                                                       int                  batchCount,
+                                                       hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transA,
+                  transB,
+                  m,
+                  n,
+                  aType,
+                  lda,
+                  strideA,
+                  bType,
+                  ldb,
+                  strideB,
+                  cType,
+                  ldc,
+                  strideC,
+                  batchCount,
+                  computeType);
+
+    return hipblasGeamExImpl(handle,
+                             transA,
+                             transB,
+                             m,
+                             n,
+                             alpha,
+                             A,
+                             aType,
+                             lda,
+                             strideA,
+                             beta,
+                             B,
+                             bType,
+                             ldb,
+                             strideB,
+                             C,
+                             cType,
+                             ldc,
+                             strideC,
+                             false,
+                             batchCount,
+                             computeType);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
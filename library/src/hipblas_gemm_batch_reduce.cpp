@@ -0,0 +1,214 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <climits>
+#include <cstdint>
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_entry.hpp"
+
+// hipblasGemmBatchReduceEx, built on the public gemmEx so it is the same for both backends.
+// sum_i op(A_i) * op(B_i) is op(A) * op(B) for the A of the A_i side by side along k and the B
+// of the B_i stacked along k, so when the strides lay them out that way the sum is one gemm
+// with k * batchCount. Otherwise the products are added to C one gemm after another, with beta
+// one after the first, which needs no memory for the products.
+
+namespace
+{
+    size_t hipblas_batch_reduce_size(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_8I:
+        case HIP_R_8U:
+            return 1;
+        case HIP_R_16F:
+        case HIP_R_16BF:
+        case HIP_C_8I:
+            return 2;
+        case HIP_R_32I:
+        case HIP_R_32F:
+            return 4;
+        case HIP_R_64F:
+        case HIP_C_32F:
+            return 8;
+        case HIP_C_64F:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+}
+
+extern "C" hipblasStatus_t hipblasGemmBatchReduceEx(hipblasHandle_t      handle,
+                                                    hipblasOperation_t   transA,
+                                                    hipblasOperation_t   transB,
+                                                    int                  m,
+                                                    int                  n,
+                                                    int                  k,
+                                                    const void*          alpha,
+                                                    const void*          A,
+                                                    hipDataType          aType,
+                                                    int                  lda,
+                                                    hipblasStride        strideA,
+                                                    const void*          B,
+                                                    hipDataType          bType,
+                                                    int                  ldb,
+                                                    hipblasStride        strideB,
+                                                    const void*          beta,
+                                                    void*                C,
+                                                    hipDataType          cType,
+                                                    int                  ldc,
+                                                    int                  batchCount,
+                                                    hipblasComputeType_t computeType,
+                                                    hipblasGemmAlgo_t    algo)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transA,
+                  transB,
+                  m,
+                  n,
+                  k,
+                  aType,
+                  lda,
+                  strideA,
+                  bType,
+                  ldb,
+                  strideB,
+                  cType,
+                  ldc,
+                  batchCount,
+                  computeType,
+                  algo);
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(k < 0 || batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    auto gemm = [&](int64_t     k_gemm,
+                    const void* a,
+                    const void* b,
+                    const void* gemm_beta) -> hipblasStatus_t {
+        if(k_gemm <= INT_MAX)
+            return hipblasGemmEx_v2(handle,
+                                    transA,
+                                    transB,
+                                    m,
+                                    n,
+                                    int(k_gemm),
+                                    alpha,
+                                    a,
+                                    aType,
+                                    lda,
+                                    b,
+                                    bType,
+                                    ldb,
+                                    gemm_beta,
+                                    C,
+                                    cType,
+                                    ldc,
+                                    computeType,
+                                    algo);
+        return hipblasGemmEx_v2_64(handle,
+                                   transA,
+                                   transB,
+                                   m,
+                                   n,
+                                   k_gemm,
+                                   alpha,
+                                   a,
+                                   aType,
+                                   lda,
+                                   b,
+                                   bType,
+                                   ldb,
+                                   gemm_beta,
+                                   C,
+                                   cType,
+                                   ldc,
+                                   computeType,
+                                   algo);
+    };
+
+    // the A_i next to each other along k, and the B_i one under the other
+    int64_t k_all  = int64_t(k) * batchCount;
+    bool    a_fold = transA == HIPBLAS_OP_N ? strideA == hipblasStride(k) * lda
+                                            : strideA == k && lda >= k_all;
+    bool    b_fold = transB == HIPBLAS_OP_N ? strideB == k && ldb >= k_all
+                                            : strideB == hipblasStride(k) * ldb;
+
+    // the argument checks and quick returns, and C := beta * C for an empty batch, are those of
+    // the gemm
+    if(batchCount <= 1 || !m || !n || !k || !alpha || !A || !B || (a_fold && b_fold))
+        return gemm(k_all, A, B, beta);
+
+    size_t a_size = hipblas_batch_reduce_size(aType);
+    size_t b_size = hipblas_batch_reduce_size(bType);
+    if(!a_size || !b_size)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetPointerMode(handle, &mode)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // the products after the first are added to C with a beta of one, on the device in device
+    // pointer mode
+    char one[16] = {};
+    hipblas_scalar_one(computeType, one);
+    const void* gemm_one = one;
+    if(mode == HIPBLAS_POINTER_MODE_DEVICE)
+    {
+        void* d_one = hipblasGetScratch(handle, sizeof(one), stream);
+        if(!d_one)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        if(hipMemcpyAsync(d_one, one, sizeof(one), hipMemcpyHostToDevice, stream) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        gemm_one = d_one;
+    }
+
+    auto a = static_cast<const char*>(A);
+    auto b = static_cast<const char*>(B);
+    for(int i = 0; i < batchCount; i++)
+    {
+        status = gemm(k,
+                      a + i * strideA * int64_t(a_size),
+                      b + i * strideB * int64_t(b_size),
+                      i ? gemm_one : beta);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
@@ -0,0 +1,252 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_entry.hpp"
+
+// hipblasGemmStridedBatched2DEx, built on the public gemmEx so it is the same for both backends.
+// A batch whose two strides collapse into one is a strided batched gemm. Otherwise a kernel
+// writes the pointers of the problems to the scratch memory of the handle, and the batch is
+// computed by one batched gemm on the matrices where they are.
+
+namespace
+{
+    constexpr int hipblas_batched_2d_block = 256;
+
+    size_t hipblas_batched_2d_size(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_8I:
+        case HIP_R_8U:
+            return 1;
+        case HIP_R_16F:
+        case HIP_R_16BF:
+        case HIP_C_8I:
+            return 2;
+        case HIP_R_32I:
+        case HIP_R_32F:
+            return 4;
+        case HIP_R_64F:
+        case HIP_C_32F:
+            return 8;
+        case HIP_C_64F:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+
+    // The strides of one of A, B and C, in bytes
+    struct hipblas_batched_2d_strides
+    {
+        int64_t stride1;
+        int64_t stride2;
+    };
+
+    // X_ptr[i * batch_count2 + j] := X + i * stride1 + j * stride2 for A, B and C
+    __global__ void hipblasBatched2DPointersKernel(int                        batch_count1,
+                                                   int                        batch_count2,
+                                                   const char*                A,
+                                                   hipblas_batched_2d_strides a,
+                                                   const char*                B,
+                                                   hipblas_batched_2d_strides b,
+                                                   char*                      C,
+                                                   hipblas_batched_2d_strides c,
+                                                   const void**               A_ptr,
+                                                   const void**               B_ptr,
+                                                   void**                     C_ptr)
+    {
+        int64_t count = int64_t(batch_count1) * batch_count2;
+        for(int64_t p = int64_t(blockIdx.x) * blockDim.x + threadIdx.x; p < count;
+            p += int64_t(gridDim.x) * blockDim.x)
+        {
+            int64_t i = p / batch_count2;
+            int64_t j = p % batch_count2;
+            A_ptr[p]  = A + i * a.stride1 + j * a.stride2;
+            B_ptr[p]  = B + i * b.stride1 + j * b.stride2;
+            C_ptr[p]  = C + i * c.stride1 + j * c.stride2;
+        }
+    }
+}
+
+extern "C" hipblasStatus_t hipblasGemmStridedBatched2DEx(hipblasHandle_t      handle,
+                                                         hipblasOperation_t   transA,
+                                                         hipblasOperation_t   transB,
+                                                         int                  m,
+                                                         int                  n,
+                                                         int                  k,
+                                                         const void*          alpha,
+                                                         const void*          A,
+                                                         hipDataType          aType,
+                                                         int                  lda,
+                                                         hipblasStride        strideA1,
+                                                         hipblasStride        strideA2,
+                                                         const void*          B,
+                                                         hipDataType          bType,
+                                                         int                  ldb,
+                                                         hipblasStride        strideB1,
+                                                         hipblasStride        strideB2,
+                                                         const void*          beta,
+                                                         void*                C,
+                                                         hipDataType          cType,
+                                                         int                  ldc,
+                                                         hipblasStride        strideC1,
+                                                         hipblasStride        strideC2,
+                                                         int                  batchCount1,
+                                                         int                  batchCount2,
+                                                         hipblasComputeType_t computeType,
+                                                         hipblasGemmAlgo_t    algo)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transA,
+                  transB,
+                  m,
+                  n,
+                  k,
+                  aType,
+                  lda,
+                  strideA1,
+                  strideA2,
+                  bType,
+                  ldb,
+                  strideB1,
+                  strideB2,
+                  cType,
+                  ldc,
+                  strideC1,
+                  strideC2,
+                  batchCount1,
+                  batchCount2,
+                  computeType);
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    int64_t count = int64_t(batchCount1) * batchCount2;
+    if(batchCount1 < 0 || batchCount2 < 0 || count > INT_MAX)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    auto strided = [&](hipblasStride stride_a, hipblasStride stride_b, hipblasStride stride_c) {
+        return hipblasGemmStridedBatchedEx_v2(handle,
+                                              transA,
+                                              transB,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              aType,
+                                              lda,
+                                              stride_a,
+                                              B,
+                                              bType,
+                                              ldb,
+                                              stride_b,
+                                              beta,
+                                              C,
+                                              cType,
+                                              ldc,
+                                              stride_c,
+                                              int(count),
+                                              computeType,
+                                              algo);
+    };
+
+    // the argument checks and quick returns of empty problems are those of the strided gemm
+    if(batchCount2 == 1)
+        return strided(strideA1, strideB1, strideC1);
+    if(batchCount1 <= 1 || !count || !m || !n || !A || !B || !C
+       || (strideA1 == strideA2 * batchCount2 && strideB1 == strideB2 * batchCount2
+           && strideC1 == strideC2 * batchCount2))
+        return strided(strideA2, strideB2, strideC2);
+
+    size_t a_size = hipblas_batched_2d_size(aType);
+    size_t b_size = hipblas_batched_2d_size(bType);
+    size_t c_size = hipblas_batched_2d_size(cType);
+    if(!a_size || !b_size || !c_size)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    size_t ptr_bytes = hipblas_scratch_pad(count * sizeof(void*));
+    char*  scratch   = static_cast<char*>(hipblasGetScratch(handle, 3 * ptr_bytes, stream));
+    if(!scratch)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    auto A_ptr = reinterpret_cast<const void**>(scratch);
+    auto B_ptr = reinterpret_cast<const void**>(scratch + ptr_bytes);
+    auto C_ptr = reinterpret_cast<void**>(scratch + 2 * ptr_bytes);
+
+    int blocks = int(std::min<int64_t>((count - 1) / hipblas_batched_2d_block + 1, 65535));
+    hipblasBatched2DPointersKernel<<<blocks, hipblas_batched_2d_block, 0, stream>>>(
+        batchCount1,
+        batchCount2,
+        static_cast<const char*>(A),
+        {strideA1 * int64_t(a_size), strideA2 * int64_t(a_size)},
+        static_cast<const char*>(B),
+        {strideB1 * int64_t(b_size), strideB2 * int64_t(b_size)},
+        static_cast<char*>(C),
+        {strideC1 * int64_t(c_size), strideC2 * int64_t(c_size)},
+        A_ptr,
+        B_ptr,
+        C_ptr);
+    if(hipGetLastError() != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    return hipblasGemmBatchedEx_v2(handle,
+                                   transA,
+                                   transB,
+                                   m,
+                                   n,
+                                   k,
+                                   alpha,
+                                   A_ptr,
+                                   aType,
+                                   lda,
+                                   B_ptr,
+                                   bType,
+                                   ldb,
+                                   beta,
+                                   C_ptr,
+                                   cType,
+                                   ldc,
+                                   int(count),
+                                   computeType,
+                                   algo);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
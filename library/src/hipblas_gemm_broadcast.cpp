@@ -0,0 +1,145 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hipblas.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+
+#include "exceptions.hpp"
+#include "hipblas_gemm_broadcast.hpp"
+
+// The broadcast gemms of hipblas_gemm_broadcast.hpp, built on the public gemmEx so they are the
+// same for both backends. Problem b of the batch is C_b := alpha * op(A) * op(B_b) + beta * C_b,
+// and with the layouts taken here B_0, B_1, ... and C_0, C_1, ... are the column blocks of a
+// single op(B) and C of n * batchCount columns.
+
+namespace
+{
+    bool hipblas_broadcast_gemm_enabled()
+    {
+        static const bool enabled = [] {
+            const char* env = getenv("HIPBLAS_BROADCAST_GEMM");
+            return !env || *env != '0';
+        }();
+        return enabled;
+    }
+}
+
+hipblasStatus_t hipblasBroadcastGemm(hipblasHandle_t      handle,
+                                     hipblasOperation_t   transA,
+                                     hipblasOperation_t   transB,
+                                     int64_t              m,
+                                     int64_t              n,
+                                     int64_t              k,
+                                     const void*          alpha,
+                                     const void*          A,
+                                     hipDataType          aType,
+                                     int64_t              lda,
+                                     hipblasStride        strideA,
+                                     const void*          B,
+                                     hipDataType          bType,
+                                     int64_t              ldb,
+                                     hipblasStride        strideB,
+                                     const void*          beta,
+                                     void*                C,
+                                     hipDataType          cType,
+                                     int64_t              ldc,
+                                     hipblasStride        strideC,
+                                     int64_t              batchCount,
+                                     hipblasComputeType_t computeType,
+                                     hipblasGemmAlgo_t    algo,
+                                     hipblasGemmFlags_t   flags)
+try
+{
+    if(!handle || strideA != 0 || batchCount < 2 || !hipblas_broadcast_gemm_enabled())
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    auto valid_trans = [](hipblasOperation_t trans) {
+        return trans == HIPBLAS_OP_N || trans == HIPBLAS_OP_T || trans == HIPBLAS_OP_C;
+    };
+    if(!valid_trans(transA) || !valid_trans(transB))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // Empty problems and the quick returns of the backend stay with the backend
+    if(m < 1 || n < 1 || k < 1 || n > INT64_MAX / batchCount)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    int64_t n_all  = n * batchCount;
+    int64_t rows_a = transA == HIPBLAS_OP_N ? m : k;
+    int64_t rows_b = transB == HIPBLAS_OP_N ? k : n_all;
+    if(lda < rows_a || ldb < rows_b || ldc < m || !alpha || !beta || !A || !B || !C)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    bool b_blocks = transB == HIPBLAS_OP_N ? strideB == n * ldb : strideB == n;
+    if(!b_blocks || strideC != n * ldc)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    if(std::max({m, n_all, k, lda, ldb, ldc}) <= INT_MAX)
+        return hipblasGemmExWithFlags_v2(handle,
+                                         transA,
+                                         transB,
+                                         int(m),
+                                         int(n_all),
+                                         int(k),
+                                         alpha,
+                                         A,
+                                         aType,
+                                         int(lda),
+                                         B,
+                                         bType,
+                                         int(ldb),
+                                         beta,
+                                         C,
+                                         cType,
+                                         int(ldc),
+                                         computeType,
+                                         algo,
+                                         flags);
+
+    return hipblasGemmExWithFlags_v2_64(handle,
+                                        transA,
+                                        transB,
+                                        m,
+                                        n_all,
+                                        k,
+                                        alpha,
+                                        A,
+                                        aType,
+                                        lda,
+                                        B,
+                                        bType,
+                                        ldb,
+                                        beta,
+                                        C,
+                                        cType,
+                                        ldc,
+                                        computeType,
+                                        algo,
+                                        flags);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
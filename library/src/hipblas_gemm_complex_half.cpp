@@ -0,0 +1,424 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_complex.h>
+#include <hip/hip_fp16.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_gemm_complex_half.hpp"
+#include "hipblas_handle_state.hpp"
+
+// With op(A) = Ar + i Ai and op(B) = Br + i Bi,
+//
+//     op(A) op(B) = (Ar Br - Ai Bi) + i (Ar Bi + Ai Br)
+//                 = (P1 - P2) + i (P3 - P1 - P2)
+//
+// for P1 = Ar Br, P2 = Ai Bi and P3 = (Ar + Ai)(Br + Bi), the 3M algorithm of hipblasCgemm3m.
+// The planes of A and B, with Ai and Bi negated for HIPBLAS_OP_C, are packed in scratch memory
+// of the handle in their own type, so the products run on the half precision matrix
+// cores, and the products are accumulated in float planes, from which a last kernel adds alpha
+// times op(A) op(B) to beta * C. The sums of the 3M algorithm are rounded to the type of A and B.
+
+namespace
+{
+    constexpr int hipblas_complex_half_tile = 32;
+    constexpr int hipblas_complex_half_rows = 8;
+
+    // An element of complex half, bfloat16 or float type, stored as its real and imaginary parts
+    template <typename T>
+    struct hipblas_complex_half_t
+    {
+        T x, y;
+    };
+
+    // Xr, Xi and, when sums, Xs := Xr + Xi for each rows by cols matrix of the batch X, with Xi
+    // negated when conj, packed with leading dimension rows and a stride of plane, each of the
+    // planes being batch_count * plane elements after the previous one
+    template <typename T>
+    __global__ void hipblasComplexHalfSplitKernel(int                              rows,
+                                                  int                              cols,
+                                                  const hipblas_complex_half_t<T>* X,
+                                                  int                              ldx,
+                                                  hipblasStride                    stride_x,
+                                                  bool                             conj,
+                                                  bool                             sums,
+                                                  T*                               S,
+                                                  size_t                           plane,
+                                                  int                              batch_count)
+    {
+        int i = blockIdx.x * hipblas_complex_half_tile + threadIdx.x;
+        if(i >= rows)
+            return;
+
+        size_t planes = size_t(batch_count) * plane;
+        int    j_end  = min(cols, int(blockIdx.y + 1) * hipblas_complex_half_tile);
+        for(int64_t b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            for(int j = blockIdx.y * hipblas_complex_half_tile + threadIdx.y; j < j_end;
+                j += hipblas_complex_half_rows)
+            {
+                hipblas_complex_half_t<T> x = X[b * stride_x + i + int64_t(j) * ldx];
+                size_t                    s = b * plane + i + size_t(j) * rows;
+                if(conj)
+                    hipblas_device_store(-hipblas_device_load(x.y), x.y);
+                S[s]          = x.x;
+                S[planes + s] = x.y;
+                if(sums)
+                    hipblas_device_store(hipblas_device_load(x.x) + hipblas_device_load(x.y),
+                                         S[2 * planes + s]);
+            }
+        }
+    }
+
+    // C := alpha * W + beta * C for each m by n product W of the batch in the float planes P,
+    // P + planes and, for the 3M algorithm, P + 2 * planes, of stride m * n: W = P1 + i P2, or
+    // W = (P1 - P2) + i (P3 - P1 - P2) when three. C isn't read when beta is zero. The scalars
+    // are read from alpha and beta when they aren't nullptr, in device pointer mode, and are
+    // alpha_value and beta_value otherwise.
+    template <typename T>
+    __global__ void hipblasComplexHalfCombineKernel(int                        m,
+                                                    int                        n,
+                                                    const float*               P,
+                                                    bool                       three,
+                                                    const hipFloatComplex*     alpha,
+                                                    hipFloatComplex            alpha_value,
+                                                    const hipFloatComplex*     beta,
+                                                    hipFloatComplex            beta_value,
+                                                    hipblas_complex_half_t<T>* C,
+                                                    int                        ldc,
+                                                    hipblasStride              stride_c,
+                                                    int                        batch_count)
+    {
+        int i = blockIdx.x * hipblas_complex_half_tile + threadIdx.x;
+        if(i >= m)
+            return;
+
+        hipFloatComplex a      = alpha ? *alpha : alpha_value;
+        hipFloatComplex b      = beta ? *beta : beta_value;
+        bool            read_c = !hipblas_device_is_zero(b);
+        size_t          planes = size_t(batch_count) * m * n;
+
+        int j_end = min(n, int(blockIdx.y + 1) * hipblas_complex_half_tile);
+        for(int64_t batch = blockIdx.z; batch < batch_count; batch += gridDim.z)
+        {
+            for(int j = blockIdx.y * hipblas_complex_half_tile + threadIdx.y; j < j_end;
+                j += hipblas_complex_half_rows)
+            {
+                size_t                     p = batch * m * n + i + size_t(j) * m;
+                hipblas_complex_half_t<T>& q = C[batch * stride_c + i + int64_t(j) * ldc];
+                hipFloatComplex            w{}, c{};
+                if(three)
+                {
+                    float p1 = P[p], p2 = P[planes + p], p3 = P[2 * planes + p];
+                    w.x      = p1 - p2;
+                    w.y      = p3 - p1 - p2;
+                }
+                else
+                {
+                    w.x = P[p];
+                    w.y = P[planes + p];
+                }
+                if(read_c)
+                {
+                    c.x = hipblas_device_load(q.x);
+                    c.y = hipblas_device_load(q.y);
+                }
+                c = hipblas_device_axpby(a, w, b, c);
+                hipblas_device_store(c.x, q.x);
+                hipblas_device_store(c.y, q.y);
+            }
+        }
+    }
+
+    template <typename T>
+    hipError_t hipblas_complex_half_split(int           rows,
+                                          int           cols,
+                                          const void*   X,
+                                          int           ldx,
+                                          hipblasStride stride_x,
+                                          bool          conj,
+                                          bool          sums,
+                                          void*         S,
+                                          int           batch_count,
+                                          hipStream_t   stream)
+    {
+        dim3 grid((rows - 1) / hipblas_complex_half_tile + 1,
+                  (cols - 1) / hipblas_complex_half_tile + 1,
+                  std::min(batch_count, 65535));
+        dim3 threads(hipblas_complex_half_tile, hipblas_complex_half_rows);
+        hipblasComplexHalfSplitKernel<T><<<grid, threads, 0, stream>>>(
+            rows,
+            cols,
+            static_cast<const hipblas_complex_half_t<T>*>(X),
+            ldx,
+            stride_x,
+            conj,
+            sums,
+            static_cast<T*>(S),
+            size_t(rows) * cols,
+            batch_count);
+        return hipGetLastError();
+    }
+
+    template <typename T>
+    hipError_t hipblas_complex_half_combine(int           m,
+                                            int           n,
+                                            const float*  P,
+                                            bool          three,
+                                            const void*   alpha,
+                                            const void*   beta,
+                                            bool          host_scalars,
+                                            void*         C,
+                                            int           ldc,
+                                            hipblasStride stride_c,
+                                            int           batch_count,
+                                            hipStream_t   stream)
+    {
+        using TC = hipFloatComplex;
+        dim3 grid((m - 1) / hipblas_complex_half_tile + 1,
+                  (n - 1) / hipblas_complex_half_tile + 1,
+                  std::min(batch_count, 65535));
+        dim3 threads(hipblas_complex_half_tile, hipblas_complex_half_rows);
+        hipblasComplexHalfCombineKernel<T><<<grid, threads, 0, stream>>>(
+            m,
+            n,
+            P,
+            three,
+            host_scalars ? nullptr : static_cast<const TC*>(alpha),
+            host_scalars ? *static_cast<const TC*>(alpha) : TC{},
+            host_scalars ? nullptr : static_cast<const TC*>(beta),
+            host_scalars ? *static_cast<const TC*>(beta) : TC{},
+            static_cast<hipblas_complex_half_t<T>*>(C),
+            ldc,
+            stride_c,
+            batch_count);
+        return hipGetLastError();
+    }
+
+    // Runs the real products in host pointer mode and restores the pointer mode of the handle
+    // when done
+    class hipblas_complex_half_products
+    {
+    public:
+        hipblas_complex_half_products(hipblasHandle_t handle, hipblasPointerMode_t mode)
+            : m_handle(handle)
+            , m_mode(mode)
+        {
+        }
+
+        ~hipblas_complex_half_products()
+        {
+            if(m_mode != HIPBLAS_POINTER_MODE_HOST)
+                hipblasSetPointerMode(m_handle, m_mode);
+        }
+
+        hipblasStatus_t host_mode()
+        {
+            return m_mode == HIPBLAS_POINTER_MODE_HOST
+                       ? HIPBLAS_STATUS_SUCCESS
+                       : hipblasSetPointerMode(m_handle, HIPBLAS_POINTER_MODE_HOST);
+        }
+
+    private:
+        hipblasHandle_t      m_handle;
+        hipblasPointerMode_t m_mode;
+    };
+}
+
+hipblasStatus_t hipblasComplexHalfGemmEx(hipblasHandle_t      handle,
+                                         hipblasOperation_t   transA,
+                                         hipblasOperation_t   transB,
+                                         int                  m,
+                                         int                  n,
+                                         int                  k,
+                                         const void*          alpha,
+                                         const void*          A,
+                                         hipDataType          aType,
+                                         int                  lda,
+                                         hipblasStride        strideA,
+                                         const void*          B,
+                                         hipDataType          bType,
+                                         int                  ldb,
+                                         hipblasStride        strideB,
+                                         const void*          beta,
+                                         void*                C,
+                                         hipDataType          cType,
+                                         int                  ldc,
+                                         hipblasStride        strideC,
+                                         int                  batchCount,
+                                         hipblasComputeType_t computeType)
+try
+{
+    if((aType != HIP_C_16F && aType != HIP_C_16BF) || bType != aType)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if((cType != aType && cType != HIP_C_32F) || computeType != HIPBLAS_COMPUTE_32F)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    for(hipblasOperation_t trans : {transA, transB})
+        if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+    int rows_a = transA == HIPBLAS_OP_N ? m : k;
+    int cols_a = transA == HIPBLAS_OP_N ? k : m;
+    int rows_b = transB == HIPBLAS_OP_N ? k : n;
+    int cols_b = transB == HIPBLAS_OP_N ? n : k;
+    if(m < 0 || n < 0 || k < 0 || batchCount < 0 || lda < std::max(rows_a, 1)
+       || ldb < std::max(rows_b, 1) || ldc < std::max(m, 1))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    if(!m || !n || !batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || !C || (k && (!A || !B)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasStatus_t      status;
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    if((status = hipblasGetStream(handle, &stream)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetPointerMode(handle, &mode)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    bool               is_half   = aType == HIP_C_16F;
+    hipDataType        real_type = is_half ? HIP_R_16F : HIP_R_16BF;
+    hipblasOperation_t op_a      = transA == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+    hipblasOperation_t op_b      = transB == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+    bool               gemm_3m   = hipblasIsGemm3m(handle);
+    int                planes    = gemm_3m ? 3 : 2;
+
+    // the planes of A, B and the products, each plane holding the batch, in the rounding scratch
+    // memory, as the real gemms may take a workspace from hipblasGetScratch
+    size_t plane_a = size_t(rows_a) * cols_a;
+    size_t plane_b = size_t(rows_b) * cols_b;
+    size_t plane_c = size_t(m) * n;
+    size_t bytes_a = hipblas_scratch_pad(planes * plane_a * batchCount * sizeof(__half));
+    size_t bytes_b = hipblas_scratch_pad(planes * plane_b * batchCount * sizeof(__half));
+    char*  scratch = static_cast<char*>(hipblasGetRoundingScratch(
+        handle, bytes_a + bytes_b + planes * plane_c * batchCount * sizeof(float), stream));
+    if(!scratch)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    char*  S_a = scratch;
+    char*  S_b = S_a + bytes_a;
+    float* P   = reinterpret_cast<float*>(S_b + bytes_b);
+
+    auto split = is_half ? hipblas_complex_half_split<__half>
+                         : hipblas_complex_half_split<hipblas_device_bf16>;
+    if(k
+       && (split(rows_a,
+                 cols_a,
+                 A,
+                 lda,
+                 strideA,
+                 transA == HIPBLAS_OP_C,
+                 gemm_3m,
+                 S_a,
+                 batchCount,
+                 stream)
+               != hipSuccess
+           || split(rows_b,
+                    cols_b,
+                    B,
+                    ldb,
+                    strideB,
+                    transB == HIPBLAS_OP_C,
+                    gemm_3m,
+                    S_b,
+                    batchCount,
+                    stream)
+                  != hipSuccess))
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    hipblas_complex_half_products products(handle, mode);
+    if((status = products.host_mode()) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // P[z] := a * op(X[x]) * op(Y[y]) + b * P[z] for the planes x of A, y of B and z of the
+    // products
+    auto gemm = [&](float a, int x, int y, float b, int z) {
+        return hipblasGemmStridedBatchedEx_v2(handle,
+                                              op_a,
+                                              op_b,
+                                              m,
+                                              n,
+                                              k,
+                                              &a,
+                                              S_a + x * plane_a * batchCount * sizeof(__half),
+                                              real_type,
+                                              std::max(rows_a, 1),
+                                              plane_a,
+                                              S_b + y * plane_b * batchCount * sizeof(__half),
+                                              real_type,
+                                              std::max(rows_b, 1),
+                                              plane_b,
+                                              &b,
+                                              P + z * plane_c * batchCount,
+                                              HIP_R_32F,
+                                              m,
+                                              plane_c,
+                                              batchCount,
+                                              HIPBLAS_COMPUTE_32F,
+                                              HIPBLAS_GEMM_DEFAULT);
+    };
+
+    if(gemm_3m)
+    {
+        if((status = gemm(1, 0, 0, 0, 0)) != HIPBLAS_STATUS_SUCCESS
+           || (status = gemm(1, 1, 1, 0, 1)) != HIPBLAS_STATUS_SUCCESS
+           || (status = gemm(1, 2, 2, 0, 2)) != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    else if((status = gemm(1, 0, 0, 0, 0)) != HIPBLAS_STATUS_SUCCESS
+            || (status = gemm(-1, 1, 1, 1, 0)) != HIPBLAS_STATUS_SUCCESS
+            || (status = gemm(1, 0, 1, 0, 1)) != HIPBLAS_STATUS_SUCCESS
+            || (status = gemm(1, 1, 0, 1, 1)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    auto combine = cType == HIP_C_32F ? hipblas_complex_half_combine<float>
+                   : is_half          ? hipblas_complex_half_combine<__half>
+                                      : hipblas_complex_half_combine<hipblas_device_bf16>;
+    if(combine(m,
+               n,
+               P,
+               gemm_3m,
+               alpha,
+               beta,
+               mode != HIPBLAS_POINTER_MODE_DEVICE,
+               C,
+               ldc,
+               strideC,
+               batchCount,
+               stream)
+       != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
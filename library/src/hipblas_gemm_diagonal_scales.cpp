@@ -0,0 +1,345 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_fp16.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_gemm_diagonal_scales.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_entry.hpp"
+
+// hipblasGemmExWithDiagonalScales. The backends first try hipBLASLt or cuBLASLt, which scale the
+// rows of op(A) and the columns of op(B) as they are loaded. Otherwise the product is computed
+// in panels of columns, like hipblasGemmExWithRequant: op(A) * op(B) of a panel is written to
+// the scratch memory of the handle in the type of the scalars, and a kernel right after scales
+// it and adds beta * C, so with panels that fit in the last level cache the unscaled product
+// doesn't reach memory and A and B aren't rewritten as a dgmm would.
+
+namespace
+{
+    // the product of a panel, which fits in the L2 cache of current GPUs
+    constexpr size_t hipblas_diagonal_scales_panel_bytes = size_t(4) << 20;
+    constexpr int    hipblas_diagonal_scales_threads     = 256;
+
+    // C := alpha * diag(row_scale) * W * diag(col_scale) + beta * C for the m by n panel W. C
+    // isn't read when beta is zero. The scalars are read from alpha and beta when they aren't
+    // nullptr, in device pointer mode, and are alpha_value and beta_value otherwise.
+    template <typename TC, typename TS>
+    __global__ void hipblasDiagonalScalesKernel(int          m,
+                                                int          n,
+                                                const TS*    alpha,
+                                                TS           alpha_value,
+                                                const TS*    W,
+                                                const float* row_scale,
+                                                const float* col_scale,
+                                                const TS*    beta,
+                                                TS           beta_value,
+                                                TC*          C,
+                                                int          ldc)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= m)
+            return;
+
+        TS a  = alpha ? *alpha : alpha_value;
+        TS bt = beta ? *beta : beta_value;
+        if(row_scale)
+            a *= TS(row_scale[i]);
+        for(int j = blockIdx.y; j < n; j += gridDim.y)
+        {
+            TS  w = col_scale ? W[i + size_t(j) * m] * TS(col_scale[j]) : W[i + size_t(j) * m];
+            TC& c = C[i + size_t(j) * ldc];
+            TS  y = bt == TS(0) ? a * w : a * w + bt * hipblas_device_load(c);
+            hipblas_device_store(y, c);
+        }
+    }
+
+    template <typename TC, typename TS>
+    hipError_t hipblas_diagonal_scales_launch(int          m,
+                                              int          n,
+                                              const void*  alpha,
+                                              bool         host_scalars,
+                                              const void*  W,
+                                              const float* row_scale,
+                                              const float* col_scale,
+                                              const void*  beta,
+                                              void*        C,
+                                              int          ldc,
+                                              hipStream_t  stream)
+    {
+        TS alpha_value{}, beta_value{};
+        if(host_scalars)
+        {
+            alpha_value = *static_cast<const TS*>(alpha);
+            beta_value  = *static_cast<const TS*>(beta);
+        }
+
+        dim3 grid((m - 1) / hipblas_diagonal_scales_threads + 1, std::min(n, 65535));
+        hipblasDiagonalScalesKernel<TC, TS>
+            <<<grid, hipblas_diagonal_scales_threads, 0, stream>>>(
+                m,
+                n,
+                host_scalars ? nullptr : static_cast<const TS*>(alpha),
+                alpha_value,
+                static_cast<const TS*>(W),
+                row_scale,
+                col_scale,
+                host_scalars ? nullptr : static_cast<const TS*>(beta),
+                beta_value,
+                static_cast<TC*>(C),
+                ldc);
+        return hipGetLastError();
+    }
+
+    using hipblas_diagonal_scales_fn = hipError_t (*)(int,
+                                                      int,
+                                                      const void*,
+                                                      bool,
+                                                      const void*,
+                                                      const float*,
+                                                      const float*,
+                                                      const void*,
+                                                      void*,
+                                                      int,
+                                                      hipStream_t);
+
+    // The kernel for the types of A, B and C and computeType, or nullptr for the types it
+    // doesn't support: real A and B of the same type, half, bfloat16 or float with float
+    // computation and C of any of those types, or double throughout. The type of W is the type
+    // of the scalars, which the gemm writes from A and B of any of these types.
+    hipblas_diagonal_scales_fn hipblas_diagonal_scales_kernel(hipDataType          a_type,
+                                                              hipDataType          b_type,
+                                                              hipDataType          c_type,
+                                                              hipblasComputeType_t compute_type,
+                                                              hipDataType&         w_type)
+    {
+        if(a_type != b_type)
+            return nullptr;
+
+        switch(compute_type)
+        {
+        case HIPBLAS_COMPUTE_32F:
+        case HIPBLAS_COMPUTE_32F_PEDANTIC:
+            w_type = HIP_R_32F;
+            if(a_type != HIP_R_16F && a_type != HIP_R_16BF && a_type != HIP_R_32F)
+                return nullptr;
+            switch(c_type)
+            {
+            case HIP_R_16F:
+                return hipblas_diagonal_scales_launch<__half, float>;
+            case HIP_R_16BF:
+                return hipblas_diagonal_scales_launch<hipblas_device_bf16, float>;
+            case HIP_R_32F:
+                return hipblas_diagonal_scales_launch<float, float>;
+            default:
+                return nullptr;
+            }
+        case HIPBLAS_COMPUTE_64F:
+        case HIPBLAS_COMPUTE_64F_PEDANTIC:
+            w_type = HIP_R_64F;
+            if(a_type == HIP_R_64F && c_type == HIP_R_64F)
+                return hipblas_diagonal_scales_launch<double, double>;
+            return nullptr;
+        default:
+            return nullptr;
+        }
+    }
+}
+
+extern "C" hipblasStatus_t hipblasGemmExWithDiagonalScales(hipblasHandle_t      handle,
+                                                           hipblasOperation_t   transA,
+                                                           hipblasOperation_t   transB,
+                                                           int                  m,
+                                                           int                  n,
+                                                           int                  k,
+                                                           const void*          alpha,
+                                                           const void*          A,
+                                                           hipDataType          aType,
+                                                           int                  lda,
+                                                           const void*          B,
+                                                           hipDataType          bType,
+                                                           int                  ldb,
+                                                           const void*          beta,
+                                                           void*                C,
+                                                           hipDataType          cType,
+                                                           int                  ldc,
+                                                           hipblasComputeType_t computeType,
+                                                           const float*         rowScale,
+                                                           const float*         colScale)
+try
+{
+    HIPBLAS_ENTRY(handle, transA, transB, m, n, k, aType, lda, bType, ldb, cType, ldc, computeType);
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    for(hipblasOperation_t trans : {transA, transB})
+        if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+    int rows_a = transA == HIPBLAS_OP_N ? m : k;
+    int rows_b = transB == HIPBLAS_OP_N ? k : n;
+    if(m < 0 || n < 0 || k < 0 || lda < std::max(rows_a, 1) || ldb < std::max(rows_b, 1)
+       || ldc < std::max(m, 1))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || !C || (k && (!A || !B)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // without scales it is hipblasGemmEx
+    if(!rowScale && !colScale)
+        return hipblasGemmEx_v2(handle,
+                                transA,
+                                transB,
+                                m,
+                                n,
+                                k,
+                                alpha,
+                                A,
+                                aType,
+                                lda,
+                                B,
+                                bType,
+                                ldb,
+                                beta,
+                                C,
+                                cType,
+                                ldc,
+                                computeType,
+                                HIPBLAS_GEMM_DEFAULT);
+
+    hipblasStatus_t status = hipblasLtGemmDiagonalScales(handle,
+                                                         transA,
+                                                         transB,
+                                                         m,
+                                                         n,
+                                                         k,
+                                                         alpha,
+                                                         A,
+                                                         aType,
+                                                         lda,
+                                                         B,
+                                                         bType,
+                                                         ldb,
+                                                         beta,
+                                                         C,
+                                                         cType,
+                                                         ldc,
+                                                         computeType,
+                                                         rowScale,
+                                                         colScale);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
+
+    hipDataType w_type;
+    auto        scale = hipblas_diagonal_scales_kernel(aType, bType, cType, computeType, w_type);
+    if(!scale)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    if((status = hipblasGetStream(handle, &stream)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetPointerMode(handle, &mode)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // panels of whole multiples of 64 columns where possible, for the tiles of the gemm
+    size_t  w_size = w_type == HIP_R_64F ? sizeof(double) : sizeof(float);
+    int64_t panel  = std::max<int64_t>(hipblas_diagonal_scales_panel_bytes / (w_size * m), 1);
+    if(panel > 64)
+        panel -= panel % 64;
+    int cols = int(std::min<int64_t>(panel, n));
+
+    void* W = hipblasGetScratch(handle, hipblas_scratch_pad(size_t(m) * cols * w_size), stream);
+    if(!W)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    // W := op(A) * op(B) with alpha one and beta zero, given in host pointer mode
+    const double one_double = 1, zero_double = 0;
+    const float  one_float = 1, zero_float = 0;
+    const void*  one  = w_type == HIP_R_64F ? (const void*)&one_double : &one_float;
+    const void*  zero = w_type == HIP_R_64F ? (const void*)&zero_double : &zero_float;
+    if(mode != HIPBLAS_POINTER_MODE_HOST
+       && (status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST))
+              != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    size_t  b_size = bType == HIP_R_64F ? 8 : bType == HIP_R_32F ? 4 : 2;
+    int64_t b_step = transB == HIPBLAS_OP_N ? ldb : 1;
+    for(int j = 0; j < n && status == HIPBLAS_STATUS_SUCCESS; j += cols)
+    {
+        int nj = std::min(cols, n - j);
+        status = hipblasGemmEx_v2(handle,
+                                  transA,
+                                  transB,
+                                  m,
+                                  nj,
+                                  k,
+                                  one,
+                                  A,
+                                  aType,
+                                  lda,
+                                  static_cast<const char*>(B) + j * b_step * b_size,
+                                  bType,
+                                  ldb,
+                                  zero,
+                                  W,
+                                  w_type,
+                                  m,
+                                  computeType,
+                                  HIPBLAS_GEMM_DEFAULT);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            break;
+
+        size_t c_size = cType == HIP_R_64F ? 8 : cType == HIP_R_32F ? 4 : 2;
+        if(scale(m,
+                 nj,
+                 alpha,
+                 mode != HIPBLAS_POINTER_MODE_DEVICE,
+                 W,
+                 rowScale,
+                 colScale ? colScale + j : nullptr,
+                 beta,
+                 static_cast<char*>(C) + size_t(j) * ldc * c_size,
+                 ldc,
+                 stream)
+           != hipSuccess)
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    if(mode != HIPBLAS_POINTER_MODE_HOST)
+    {
+        hipblasStatus_t mode_status = hipblasSetPointerMode(handle, mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = mode_status;
+    }
+    return status;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
@@ -0,0 +1,331 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_entry.hpp"
+
+// hipblasDgemmEmulated, a double gemm computed with the int8 gemmEx of the backend by the Ozaki
+// scheme. Each row of op(A) and column of op(B) is scaled by a power of two to below 1 in
+// magnitude and split into slices of 7 bits held as int8, so that
+//
+//     op(A)(i, :) = 2^ea[i] * sum_t 2^(-7 (t + 1)) * At(i, :)
+//     op(B)(:, j) = 2^eb[j] * sum_u 2^(-7 (u + 1)) * Bu(:, j)
+//
+// up to the bits past the last slice. The products At * Bu are exact in int32 for up to
+// hipblas_emulated_k_max terms, longer sums being split, and those with t + u < slices are added
+// in double, the others being below the precision of the slices.
+
+namespace
+{
+    constexpr int hipblas_emulated_threads    = 256;
+    constexpr int hipblas_emulated_bits       = 7;
+    constexpr int hipblas_emulated_max_slices = 8;
+
+    // k * 127 * 127 fits in int32
+    constexpr int hipblas_emulated_k_max = 131072;
+
+    // ex[r] := the exponent of the largest magnitude of row r of X, the elements of which are
+    // X[r * inc_row + p * inc_k] for p < k, so that the row scaled by 2^-ex[r] is below 1
+    __global__ void hipblasEmulatedExponentKernel(
+        int rows, int k, const double* X, int64_t inc_row, int64_t inc_k, int* ex)
+    {
+        __shared__ double maxs[hipblas_emulated_threads];
+
+        for(int r = blockIdx.x; r < rows; r += gridDim.x)
+        {
+            double x_max = 0;
+            for(int p = threadIdx.x; p < k; p += blockDim.x)
+                x_max = fmax(x_max, fabs(X[r * inc_row + p * inc_k]));
+
+            maxs[threadIdx.x] = x_max;
+            __syncthreads();
+            for(int s = blockDim.x / 2; s > 0; s /= 2)
+            {
+                if(threadIdx.x < s)
+                    maxs[threadIdx.x] = fmax(maxs[threadIdx.x], maxs[threadIdx.x + s]);
+                __syncthreads();
+            }
+
+            if(threadIdx.x == 0)
+            {
+                int e = 0;
+                frexp(maxs[0], &e);
+                ex[r] = e;
+            }
+            __syncthreads();
+        }
+    }
+
+    // The slices of the columns p0 to p0 + kc of the rows of X. Slice t of row r is column r of
+    // the kc by rows matrix D + t * rows * kc, so that the int8 gemms read both operands along k.
+    // The digits are taken by truncation, so they stay in [-127, 127] and the remainders exact.
+    __global__ void hipblasEmulatedSliceKernel(int           rows,
+                                               int           kc,
+                                               int           p0,
+                                               const double* X,
+                                               int64_t       inc_row,
+                                               int64_t       inc_k,
+                                               const int*    ex,
+                                               int           slices,
+                                               int8_t*       D)
+    {
+        int p = blockIdx.x * blockDim.x + threadIdx.x;
+        if(p >= kc)
+            return;
+
+        size_t slice_size = size_t(rows) * kc;
+        for(int r = blockIdx.y; r < rows; r += gridDim.y)
+        {
+            double x = ldexp(X[r * inc_row + (p0 + p) * inc_k], -ex[r]);
+            for(int t = 0; t < slices; t++)
+            {
+                x *= double(1 << hipblas_emulated_bits);
+                double digit = trunc(x);
+                x -= digit;
+                D[t * slice_size + p + size_t(r) * kc] = int8_t(digit);
+            }
+        }
+    }
+
+    // acc += 2^-shift * W for the m by n int32 matrix W
+    __global__ void hipblasEmulatedAccumulateKernel(
+        int m, int n, const int32_t* W, int shift, double* acc)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= m)
+            return;
+
+        for(int j = blockIdx.y; j < n; j += gridDim.y)
+            acc[i + size_t(j) * m] += ldexp(double(W[i + size_t(j) * m]), -shift);
+    }
+
+    // C := alpha * 2^(ea[i] + eb[j]) * acc + beta * C, with C not read when beta is zero
+    __global__ void hipblasEmulatedScaleKernel(int           m,
+                                               int           n,
+                                               const double* acc,
+                                               const int*    ea,
+                                               const int*    eb,
+                                               const double* alpha_ptr,
+                                               double        alpha_value,
+                                               const double* beta_ptr,
+                                               double        beta_value,
+                                               double*       C,
+                                               int           ldc)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= m)
+            return;
+
+        double alpha = alpha_ptr ? *alpha_ptr : alpha_value;
+        double beta  = beta_ptr ? *beta_ptr : beta_value;
+        for(int j = blockIdx.y; j < n; j += gridDim.y)
+        {
+            double  w = alpha * ldexp(acc[i + size_t(j) * m], ea[i] + eb[j]);
+            double& c = C[i + size_t(j) * ldc];
+            c         = beta == 0 ? w : w + beta * c;
+        }
+    }
+}
+
+extern "C" hipblasStatus_t hipblasDgemmEmulated(hipblasHandle_t    handle,
+                                                hipblasOperation_t transA,
+                                                hipblasOperation_t transB,
+                                                int                m,
+                                                int                n,
+                                                int                k,
+                                                const double*      alpha,
+                                                const double*      A,
+                                                int                lda,
+                                                const double*      B,
+                                                int                ldb,
+                                                const double*      beta,
+                                                double*            C,
+                                                int                ldc,
+                                                int                numSlices)
+try
+{
+    HIPBLAS_ENTRY(handle, transA, transB, m, n, k, lda, ldb, ldc, numSlices);
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    for(hipblasOperation_t trans : {transA, transB})
+        if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+    int rows_a = transA == HIPBLAS_OP_N ? m : k;
+    int rows_b = transB == HIPBLAS_OP_N ? k : n;
+    if(m < 0 || n < 0 || k < 0 || lda < std::max(rows_a, 1) || ldb < std::max(rows_b, 1)
+       || ldc < std::max(m, 1) || numSlices < 1 || numSlices > hipblas_emulated_max_slices)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || !C || (k && (!A || !B)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetPointerMode(handle, &mode)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    bool          device_scalars = mode == HIPBLAS_POINTER_MODE_DEVICE;
+    const double* alpha_ptr      = device_scalars ? alpha : nullptr;
+    const double* beta_ptr       = device_scalars ? beta : nullptr;
+    double        alpha_value    = device_scalars ? 0 : *alpha;
+    double        beta_value     = device_scalars ? 0 : *beta;
+
+    // the exponents of the rows of op(A) and columns of op(B), the double sum, the int32 product
+    // and the slices of one split of k
+    int    kc           = std::min(std::max(k, 1), hipblas_emulated_k_max);
+    size_t ea_bytes     = hipblas_scratch_pad(sizeof(int) * m);
+    size_t eb_bytes     = hipblas_scratch_pad(sizeof(int) * n);
+    size_t acc_bytes    = hipblas_scratch_pad(sizeof(double) * m * n);
+    size_t w_bytes      = hipblas_scratch_pad(sizeof(int32_t) * m * n);
+    size_t slices_bytes = hipblas_scratch_pad(size_t(numSlices) * kc * m);
+    size_t bytes
+        = ea_bytes + eb_bytes + acc_bytes + w_bytes + slices_bytes + size_t(numSlices) * kc * n;
+
+    char* scratch = static_cast<char*>(hipblasGetScratch(handle, bytes, stream));
+    if(!scratch)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    int*     ea       = reinterpret_cast<int*>(scratch);
+    int*     eb       = reinterpret_cast<int*>(scratch + ea_bytes);
+    double*  acc      = reinterpret_cast<double*>(scratch + ea_bytes + eb_bytes);
+    int32_t* W        = reinterpret_cast<int32_t*>(scratch + ea_bytes + eb_bytes + acc_bytes);
+    int8_t*  A_slices = reinterpret_cast<int8_t*>(W) + w_bytes;
+    int8_t*  B_slices = A_slices + slices_bytes;
+
+    // element (r, p) of op(A) and element (p, r) of op(B), as rows r of length k
+    int64_t a_row = transA == HIPBLAS_OP_N ? 1 : lda;
+    int64_t a_k   = transA == HIPBLAS_OP_N ? lda : 1;
+    int64_t b_row = transB == HIPBLAS_OP_N ? ldb : 1;
+    int64_t b_k   = transB == HIPBLAS_OP_N ? 1 : ldb;
+
+    if(hipMemsetAsync(acc, 0, sizeof(double) * m * n, stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    if(k)
+    {
+        hipblasEmulatedExponentKernel<<<std::min(m, 65535), hipblas_emulated_threads, 0, stream>>>(
+            m, k, A, a_row, a_k, ea);
+        hipblasEmulatedExponentKernel<<<std::min(n, 65535), hipblas_emulated_threads, 0, stream>>>(
+            n, k, B, b_row, b_k, eb);
+    }
+    else
+    {
+        if(hipMemsetAsync(ea, 0, sizeof(int) * m, stream) != hipSuccess
+           || hipMemsetAsync(eb, 0, sizeof(int) * n, stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+    if(hipGetLastError() != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    // alpha one and beta zero of the int8 gemms are given in host pointer mode
+    const int32_t one = 1, zero = 0;
+    if(mode != HIPBLAS_POINTER_MODE_HOST
+       && (status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST))
+              != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    int  blocks_m = (m - 1) / hipblas_emulated_threads + 1;
+    dim3 grid_mn(blocks_m, std::min(n, 65535));
+    for(int p0 = 0; p0 < k && status == HIPBLAS_STATUS_SUCCESS; p0 += kc)
+    {
+        int  kp = std::min(kc, k - p0);
+        dim3 grid_a((kp - 1) / hipblas_emulated_threads + 1, std::min(m, 65535));
+        dim3 grid_b((kp - 1) / hipblas_emulated_threads + 1, std::min(n, 65535));
+        hipblasEmulatedSliceKernel<<<grid_a, hipblas_emulated_threads, 0, stream>>>(
+            m, kp, p0, A, a_row, a_k, ea, numSlices, A_slices);
+        hipblasEmulatedSliceKernel<<<grid_b, hipblas_emulated_threads, 0, stream>>>(
+            n, kp, p0, B, b_row, b_k, eb, numSlices, B_slices);
+        if(hipGetLastError() != hipSuccess)
+        {
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+            break;
+        }
+
+        for(int t = 0; t < numSlices && status == HIPBLAS_STATUS_SUCCESS; t++)
+        {
+            for(int u = 0; t + u < numSlices; u++)
+            {
+                status = hipblasGemmEx_v2(handle,
+                                          HIPBLAS_OP_T,
+                                          HIPBLAS_OP_N,
+                                          m,
+                                          n,
+                                          kp,
+                                          &one,
+                                          A_slices + size_t(t) * m * kp,
+                                          HIP_R_8I,
+                                          kp,
+                                          B_slices + size_t(u) * n * kp,
+                                          HIP_R_8I,
+                                          kp,
+                                          &zero,
+                                          W,
+                                          HIP_R_32I,
+                                          m,
+                                          HIPBLAS_COMPUTE_32I,
+                                          HIPBLAS_GEMM_DEFAULT);
+                if(status != HIPBLAS_STATUS_SUCCESS)
+                    break;
+
+                int shift = hipblas_emulated_bits * (t + u + 2);
+                hipblasEmulatedAccumulateKernel<<<grid_mn, hipblas_emulated_threads, 0, stream>>>(
+                    m, n, W, shift, acc);
+                if(hipGetLastError() != hipSuccess)
+                {
+                    status = HIPBLAS_STATUS_EXECUTION_FAILED;
+                    break;
+                }
+            }
+        }
+    }
+
+    if(mode != HIPBLAS_POINTER_MODE_HOST)
+    {
+        hipblasStatus_t mode_status = hipblasSetPointerMode(handle, mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = mode_status;
+    }
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasEmulatedScaleKernel<<<grid_mn, hipblas_emulated_threads, 0, stream>>>(
+        m, n, acc, ea, eb, alpha_ptr, alpha_value, beta_ptr, beta_value, C, ldc);
+    if(hipGetLastError() != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
@@ -0,0 +1,301 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_entry.hpp"
+
+// hipblasGemmKronEx, built on the public strided batched gemmEx so it is the same for both
+// backends. Column c of X, of n1 * n2 elements, is the n2-by-n1 matrix X_c with leading
+// dimension n2, and column c of Y the m2-by-m1 matrix Y_c, so that
+//   (op(A) kron op(B)) * x_c = vec(op(B) * X_c * op(A)^T)
+// which is two gemms over the columns of X, each strided batched with a stride of zero for A
+// or B. The product by the smaller of A and B is taken first, whichever has the fewer flops,
+// into the scratch memory of the handle in the type of X. When the columns of X, or of Y, are
+// next to each other, the product by B is a single gemm over all of them.
+
+namespace
+{
+    // The most scratch memory for the intermediate products, which are computed for as many
+    // columns of X at a time as fit in it
+    constexpr size_t hipblas_kron_scratch_max = size_t(64) << 20;
+
+    size_t hipblas_kron_size(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_16F:
+        case HIP_R_16BF:
+            return 2;
+        case HIP_R_32F:
+            return 4;
+        case HIP_R_64F:
+        case HIP_C_32F:
+            return 8;
+        case HIP_C_64F:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+}
+
+extern "C" hipblasStatus_t hipblasGemmKronEx(hipblasHandle_t      handle,
+                                             hipblasOperation_t   transA,
+                                             hipblasOperation_t   transB,
+                                             int                  m1,
+                                             int                  n1,
+                                             int                  m2,
+                                             int                  n2,
+                                             int                  k,
+                                             const void*          alpha,
+                                             const void*          A,
+                                             hipDataType          aType,
+                                             int                  lda,
+                                             const void*          B,
+                                             hipDataType          bType,
+                                             int                  ldb,
+                                             const void*          X,
+                                             hipDataType          xType,
+                                             int                  ldx,
+                                             const void*          beta,
+                                             void*                Y,
+                                             hipDataType          yType,
+                                             int                  ldy,
+                                             hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transA,
+                  transB,
+                  m1,
+                  n1,
+                  m2,
+                  n2,
+                  k,
+                  aType,
+                  lda,
+                  bType,
+                  ldb,
+                  xType,
+                  ldx,
+                  yType,
+                  ldy,
+                  computeType);
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    auto valid_trans = [](hipblasOperation_t trans) {
+        return trans == HIPBLAS_OP_N || trans == HIPBLAS_OP_T || trans == HIPBLAS_OP_C;
+    };
+    if(!valid_trans(transA) || !valid_trans(transB))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    int64_t rows_x = int64_t(n1) * n2;
+    int64_t rows_y = int64_t(m1) * m2;
+    int     rows_a = transA == HIPBLAS_OP_N ? m1 : n1;
+    int     rows_b = transB == HIPBLAS_OP_N ? m2 : n2;
+    if(m1 < 0 || n1 < 0 || m2 < 0 || n2 < 0 || k < 0 || lda < std::max(rows_a, 1)
+       || ldb < std::max(rows_b, 1) || ldx < std::max<int64_t>(rows_x, 1)
+       || ldy < std::max<int64_t>(rows_y, 1))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!rows_y || !k)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || !A || !B || !X || !Y)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // op(A)^T is A itself for op(A) = A^T, and A^T for op(A) = A, but no gemm takes the
+    // conjugate of A without the transpose. The intermediate products are in the type of X.
+    bool   complex = aType == HIP_C_32F || aType == HIP_C_64F;
+    size_t x_size  = hipblas_kron_size(xType);
+    size_t y_size  = hipblas_kron_size(yType);
+    if(aType != bType || aType != xType || !x_size || !y_size
+       || (complex && transA == HIPBLAS_OP_C))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    hipblasOperation_t trans_at = transA == HIPBLAS_OP_N ? HIPBLAS_OP_T : HIPBLAS_OP_N;
+
+    // with B first, W_c := op(B) * X_c is m2-by-n1 and Y_c := alpha * W_c * op(A)^T + beta * Y_c;
+    // otherwise W_c := X_c * op(A)^T is n2-by-m1 and Y_c := alpha * op(B) * W_c + beta * Y_c
+    int64_t flops_b_first = int64_t(m2) * n1 * (n2 + m1);
+    int64_t flops_a_first = int64_t(n2) * m1 * (n1 + m2);
+    bool    b_first       = flops_b_first <= flops_a_first;
+    int     rows_w        = b_first ? m2 : n2;
+    int     cols_w        = b_first ? n1 : m1;
+    int64_t column_bytes  = int64_t(rows_w) * cols_w * x_size;
+    int     chunk         = int(std::max<int64_t>(
+        1, std::min<int64_t>(k, hipblas_kron_scratch_max / std::max<int64_t>(column_bytes, 1))));
+
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetPointerMode(handle, &mode)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // W, and the one and zero of the first gemm after it, on the device in device pointer mode
+    size_t w_bytes = hipblas_scratch_pad(size_t(column_bytes) * chunk);
+    char   one[16] = {}, zero[16] = {};
+    hipblas_scalar_one(computeType, one);
+    bool  device  = mode == HIPBLAS_POINTER_MODE_DEVICE;
+    char* scratch = static_cast<char*>(
+        hipblasGetScratch(handle, w_bytes + (device ? 2 * sizeof(one) : 0), stream));
+    if(!scratch)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    const void* w_one  = one;
+    const void* w_zero = zero;
+    if(device)
+    {
+        char* d_one = scratch + w_bytes;
+        if(hipMemcpyAsync(d_one, one, sizeof(one), hipMemcpyHostToDevice, stream) != hipSuccess
+           || hipMemsetAsync(d_one + sizeof(one), 0, sizeof(zero), stream) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        w_one  = d_one;
+        w_zero = d_one + sizeof(one);
+    }
+
+    // W is packed, so the product by op(B) is a single gemm over the columns when the other
+    // operand of it, X or Y, is packed as well
+    bool fold = b_first ? ldx == rows_x : ldy == rows_y;
+    for(int c = 0; c < k; c += chunk)
+    {
+        int         cols = std::min(chunk, k - c);
+        const char* x    = static_cast<const char*>(X) + int64_t(c) * ldx * x_size;
+        char*       y    = static_cast<char*>(Y) + int64_t(c) * ldy * y_size;
+
+        if(b_first)
+        {
+            status = hipblasGemmStridedBatchedEx_v2(handle,
+                                                    transB,
+                                                    HIPBLAS_OP_N,
+                                                    m2,
+                                                    fold ? n1 * cols : n1,
+                                                    n2,
+                                                    w_one,
+                                                    B,
+                                                    bType,
+                                                    ldb,
+                                                    0,
+                                                    x,
+                                                    xType,
+                                                    std::max(n2, 1),
+                                                    ldx,
+                                                    w_zero,
+                                                    scratch,
+                                                    xType,
+                                                    m2,
+                                                    hipblasStride(m2) * n1,
+                                                    fold ? 1 : cols,
+                                                    computeType,
+                                                    HIPBLAS_GEMM_DEFAULT);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblasGemmStridedBatchedEx_v2(handle,
+                                                        HIPBLAS_OP_N,
+                                                        trans_at,
+                                                        m2,
+                                                        m1,
+                                                        n1,
+                                                        alpha,
+                                                        scratch,
+                                                        xType,
+                                                        m2,
+                                                        hipblasStride(m2) * n1,
+                                                        A,
+                                                        aType,
+                                                        lda,
+                                                        0,
+                                                        beta,
+                                                        y,
+                                                        yType,
+                                                        m2,
+                                                        ldy,
+                                                        cols,
+                                                        computeType,
+                                                        HIPBLAS_GEMM_DEFAULT);
+        }
+        else
+        {
+            status = hipblasGemmStridedBatchedEx_v2(handle,
+                                                    HIPBLAS_OP_N,
+                                                    trans_at,
+                                                    n2,
+                                                    m1,
+                                                    n1,
+                                                    w_one,
+                                                    x,
+                                                    xType,
+                                                    std::max(n2, 1),
+                                                    ldx,
+                                                    A,
+                                                    aType,
+                                                    lda,
+                                                    0,
+                                                    w_zero,
+                                                    scratch,
+                                                    xType,
+                                                    std::max(n2, 1),
+                                                    hipblasStride(n2) * m1,
+                                                    cols,
+                                                    computeType,
+                                                    HIPBLAS_GEMM_DEFAULT);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblasGemmStridedBatchedEx_v2(handle,
+                                                        transB,
+                                                        HIPBLAS_OP_N,
+                                                        m2,
+                                                        fold ? m1 * cols : m1,
+                                                        n2,
+                                                        alpha,
+                                                        B,
+                                                        bType,
+                                                        ldb,
+                                                        0,
+                                                        scratch,
+                                                        xType,
+                                                        std::max(n2, 1),
+                                                        hipblasStride(n2) * m1,
+                                                        beta,
+                                                        y,
+                                                        yType,
+                                                        m2,
+                                                        ldy,
+                                                        fold ? 1 : cols,
+                                                        computeType,
+                                                        HIPBLAS_GEMM_DEFAULT);
+        }
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
@@ -0,0 +1,339 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_entry.hpp"
+
+// hipblasGemmExWithQuantWeights, a gemm of half or bfloat16 activations with int8 or uint4
+// weights that are dequantised by group of rows as they are loaded. Products with up to
+// hipblas_quant_gemv_rows rows of op(A), as in the decode phase of LLM inference, are computed
+// by a kernel that reads each weight once and uses it for all the rows, so that only the packed
+// weights are read from memory. Larger products are computed by the gemmEx of the backend on
+// panels of columns of B dequantised to the type of A in the scratch memory of the handle, as
+// the dequantisation is then small beside the product.
+
+namespace
+{
+    constexpr int    hipblas_quant_threads     = 256;
+    constexpr int    hipblas_quant_gemv_rows   = 8;
+    constexpr size_t hipblas_quant_panel_bytes = size_t(32) << 20;
+
+    struct hipblas_quant_problem
+    {
+        hipblasOperation_t transA;
+        int                m, n, k;
+        const void*        A;
+        int                lda;
+        const uint8_t*     B;
+        int                ldb;
+        const void*        scales;
+        const void*        zero_points;
+        int                group_size;
+        int                groups;
+        void*              C;
+        int                ldc;
+    };
+
+    // W(p, j) = scale * (q(p, j) - zero point), with the scale and zero point of the group of p
+    template <typename TA, bool INT4>
+    __device__ inline float hipblas_quant_weight(const hipblas_quant_problem& problem, int p, int j)
+    {
+        float q;
+        if constexpr(INT4)
+        {
+            uint8_t pair = problem.B[p / 2 + size_t(j) * problem.ldb];
+            q            = float(p & 1 ? pair >> 4 : pair & 15);
+        }
+        else
+            q = float(int8_t(problem.B[p + size_t(j) * problem.ldb]));
+
+        size_t g     = p / problem.group_size + size_t(j) * problem.groups;
+        float  scale = hipblas_device_load(static_cast<const TA*>(problem.scales)[g]);
+        float  zero  = problem.zero_points
+                           ? hipblas_device_load(static_cast<const TA*>(problem.zero_points)[g])
+                           : 0.0f;
+        return scale * (q - zero);
+    }
+
+    // C(:, j) := alpha * op(A) * W(:, j) + beta * C(:, j) for up to hipblas_quant_gemv_rows rows
+    // of op(A), one column per block
+    template <typename TA, typename TC, bool INT4>
+    __launch_bounds__(hipblas_quant_threads) __global__
+        void hipblasQuantGemvKernel(hipblas_quant_problem problem,
+                                    const float*          alpha_ptr,
+                                    float                 alpha_value,
+                                    const float*          beta_ptr,
+                                    float                 beta_value)
+    {
+        __shared__ float sums[hipblas_quant_gemv_rows][hipblas_quant_threads];
+
+        const TA* A     = static_cast<const TA*>(problem.A);
+        TC*       C     = static_cast<TC*>(problem.C);
+        int64_t   a_row = problem.transA == HIPBLAS_OP_N ? 1 : problem.lda;
+        int64_t   a_k   = problem.transA == HIPBLAS_OP_N ? problem.lda : 1;
+        float     alpha = alpha_ptr ? *alpha_ptr : alpha_value;
+        float     beta  = beta_ptr ? *beta_ptr : beta_value;
+
+        for(int j = blockIdx.x; j < problem.n; j += gridDim.x)
+        {
+            float acc[hipblas_quant_gemv_rows] = {};
+            for(int p = threadIdx.x; p < problem.k; p += blockDim.x)
+            {
+                float w = hipblas_quant_weight<TA, INT4>(problem, p, j);
+                for(int i = 0; i < hipblas_quant_gemv_rows; i++)
+                    if(i < problem.m)
+                        acc[i] += hipblas_device_load(A[i * a_row + p * a_k]) * w;
+            }
+
+            for(int i = 0; i < problem.m; i++)
+                sums[i][threadIdx.x] = acc[i];
+            __syncthreads();
+            for(int s = blockDim.x / 2; s > 0; s /= 2)
+            {
+                if(threadIdx.x < s)
+                    for(int i = 0; i < problem.m; i++)
+                        sums[i][threadIdx.x] += sums[i][threadIdx.x + s];
+                __syncthreads();
+            }
+
+            if(threadIdx.x < problem.m)
+            {
+                int   i = threadIdx.x;
+                TC&   c = C[i + size_t(j) * problem.ldc];
+                float w = alpha * sums[i][0];
+                hipblas_device_store(beta == 0 ? w : w + beta * hipblas_device_load(c), c);
+            }
+            __syncthreads();
+        }
+    }
+
+    // W(:, jj) := the dequantised column j0 + jj of B for jj < nb, in the type of A
+    template <typename TA, bool INT4>
+    __global__ void hipblasQuantDequantKernel(hipblas_quant_problem problem, int j0, int nb, TA* W)
+    {
+        int p = blockIdx.x * blockDim.x + threadIdx.x;
+        if(p >= problem.k)
+            return;
+
+        for(int jj = blockIdx.y; jj < nb; jj += gridDim.y)
+            hipblas_device_store(hipblas_quant_weight<TA, INT4>(problem, p, j0 + jj),
+                                 W[p + size_t(jj) * problem.k]);
+    }
+
+    template <typename TA, typename TC, bool INT4>
+    hipError_t hipblas_quant_gemv_launch(const hipblas_quant_problem& problem,
+                                         const void*                  alpha,
+                                         const void*                  beta,
+                                         bool                         host_scalars,
+                                         hipStream_t                  stream)
+    {
+        float alpha_value = host_scalars ? *static_cast<const float*>(alpha) : 0;
+        float beta_value  = host_scalars ? *static_cast<const float*>(beta) : 0;
+
+        hipblasQuantGemvKernel<TA, TC, INT4>
+            <<<std::min(problem.n, 65535), hipblas_quant_threads, 0, stream>>>(
+                problem,
+                host_scalars ? nullptr : static_cast<const float*>(alpha),
+                alpha_value,
+                host_scalars ? nullptr : static_cast<const float*>(beta),
+                beta_value);
+        return hipGetLastError();
+    }
+
+    template <typename TA, bool INT4>
+    hipError_t hipblas_quant_dequant_launch(
+        const hipblas_quant_problem& problem, int j0, int nb, void* W, hipStream_t stream)
+    {
+        dim3 grid((problem.k - 1) / hipblas_quant_threads + 1, std::min(nb, 65535));
+        hipblasQuantDequantKernel<TA, INT4><<<grid, hipblas_quant_threads, 0, stream>>>(
+            problem, j0, nb, static_cast<TA*>(W));
+        return hipGetLastError();
+    }
+
+    struct hipblas_quant_kernels
+    {
+        hipError_t (*gemv)(
+            const hipblas_quant_problem&, const void*, const void*, bool, hipStream_t);
+        hipError_t (*dequant)(const hipblas_quant_problem&, int, int, void*, hipStream_t);
+    };
+
+    // C can be of the type of A or float
+    template <typename TA, bool INT4>
+    hipblas_quant_kernels hipblas_quant_kernels_of(hipDataType a_type, hipDataType c_type)
+    {
+        if(c_type == a_type)
+            return {hipblas_quant_gemv_launch<TA, TA, INT4>,
+                    hipblas_quant_dequant_launch<TA, INT4>};
+        if(c_type == HIP_R_32F)
+            return {hipblas_quant_gemv_launch<TA, float, INT4>,
+                    hipblas_quant_dequant_launch<TA, INT4>};
+        return {};
+    }
+
+    // The kernels for the types of A, B and C, or nullptrs for the types that aren't supported
+    hipblas_quant_kernels hipblas_quant_kernels_for(hipDataType         a_type,
+                                                    hipblasWeightType_t b_type,
+                                                    hipDataType         c_type)
+    {
+        bool int4 = b_type == HIPBLAS_WEIGHT_UINT4;
+        switch(a_type)
+        {
+        case HIP_R_16F:
+            return int4 ? hipblas_quant_kernels_of<__half, true>(a_type, c_type)
+                        : hipblas_quant_kernels_of<__half, false>(a_type, c_type);
+        case HIP_R_16BF:
+            return int4 ? hipblas_quant_kernels_of<hipblas_device_bf16, true>(a_type, c_type)
+                        : hipblas_quant_kernels_of<hipblas_device_bf16, false>(a_type, c_type);
+        default:
+            return {};
+        }
+    }
+}
+
+extern "C" hipblasStatus_t hipblasGemmExWithQuantWeights(hipblasHandle_t      handle,
+                                                         hipblasOperation_t   transA,
+                                                         int                  m,
+                                                         int                  n,
+                                                         int                  k,
+                                                         const void*          alpha,
+                                                         const void*          A,
+                                                         hipDataType          aType,
+                                                         int                  lda,
+                                                         const void*          B,
+                                                         hipblasWeightType_t  bType,
+                                                         int                  ldb,
+                                                         const void*          scales,
+                                                         const void*          zeroPoints,
+                                                         int                  groupSize,
+                                                         const void*          beta,
+                                                         void*                C,
+                                                         hipDataType          cType,
+                                                         int                  ldc,
+                                                         hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_ENTRY(handle, transA, m, n, k, aType, lda, ldb, groupSize, cType, ldc, computeType);
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(transA != HIPBLAS_OP_N && transA != HIPBLAS_OP_T && transA != HIPBLAS_OP_C)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(bType != HIPBLAS_WEIGHT_INT8 && bType != HIPBLAS_WEIGHT_UINT4)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    hipblas_quant_kernels kernels = hipblas_quant_kernels_for(aType, bType, cType);
+    if(!kernels.gemv || computeType != HIPBLAS_COMPUTE_32F)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    int rows_a = transA == HIPBLAS_OP_N ? m : k;
+    int rows_b = bType == HIPBLAS_WEIGHT_UINT4 ? (k + 1) / 2 : k;
+    if(m < 0 || n < 0 || k < 0 || lda < std::max(rows_a, 1) || ldb < std::max(rows_b, 1)
+       || ldc < std::max(m, 1) || groupSize < 1)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || !C || (k && (!A || !B || !scales)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetPointerMode(handle, &mode)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblas_quant_problem problem{transA,
+                                  m,
+                                  n,
+                                  k,
+                                  A,
+                                  lda,
+                                  static_cast<const uint8_t*>(B),
+                                  ldb,
+                                  scales,
+                                  zeroPoints,
+                                  groupSize,
+                                  std::max((k - 1) / groupSize + 1, 1),
+                                  C,
+                                  ldc};
+
+    if(m <= hipblas_quant_gemv_rows)
+    {
+        if(kernels.gemv(problem, alpha, beta, mode != HIPBLAS_POINTER_MODE_DEVICE, stream)
+           != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // panels of whole multiples of 64 columns where possible, for the tiles of the gemm
+    size_t  a_size = 2;
+    size_t  c_size = cType == HIP_R_32F ? 4 : 2;
+    int64_t panel  = std::max<int64_t>(hipblas_quant_panel_bytes / (a_size * std::max(k, 1)), 1);
+    if(panel > 64)
+        panel -= panel % 64;
+    int cols = int(std::min<int64_t>(panel, n));
+
+    size_t w_bytes = hipblas_scratch_pad(a_size * cols * std::max(k, 1));
+    void*  W       = hipblasGetScratch(handle, w_bytes, stream);
+    if(!W)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    for(int j = 0; j < n && status == HIPBLAS_STATUS_SUCCESS; j += cols)
+    {
+        int nj = std::min(cols, n - j);
+        if(k && kernels.dequant(problem, j, nj, W, stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        status = hipblasGemmEx_v2(handle,
+                                  transA,
+                                  HIPBLAS_OP_N,
+                                  m,
+                                  nj,
+                                  k,
+                                  alpha,
+                                  A,
+                                  aType,
+                                  lda,
+                                  W,
+                                  aType,
+                                  std::max(k, 1),
+                                  beta,
+                                  static_cast<char*>(C) + c_size * j * ldc,
+                                  cType,
+                                  ldc,
+                                  computeType,
+                                  HIPBLAS_GEMM_DEFAULT);
+    }
+    return status;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
@@ -0,0 +1,490 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_fp16.h>
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_entry.hpp"
+
+// hipblasGemmRealComplexEx and hipblasGemmRealComplexStridedBatchedEx, the gemm of a real and a
+// complex matrix without promoting the real one to complex. A complex matrix is a real one of
+// twice the rows, so with the complex operand A not transposed and real scalars the product is
+// one real gemm on the matrices as they are. Otherwise the complex operand is split into its real
+// and imaginary parts in the scratch memory of the handle, two real gemms multiply them by the
+// real operand, and a kernel combines the two products into C with alpha and beta. Either way
+// the work is that of two real gemms rather than the four of a complex one.
+
+namespace
+{
+    // the split complex operands and products of the batches done at once
+    constexpr size_t hipblas_real_complex_scratch_bytes = size_t(64) << 20;
+    constexpr int    hipblas_real_complex_threads       = 256;
+
+    template <typename T>
+    using hipblas_complex_t
+        = std::conditional_t<std::is_same_v<T, float>, hipFloatComplex, hipDoubleComplex>;
+
+    template <typename T>
+    __device__ inline hipblas_complex_t<T> hipblas_make_complex(T re, T im)
+    {
+        if constexpr(std::is_same_v<T, float>)
+            return make_hipFloatComplex(re, im);
+        else
+            return make_hipDoubleComplex(re, im);
+    }
+
+    // Z_re and Z_im := the real and imaginary parts of the rows by cols matrices of Z, packed,
+    // with Z_im negated for conjugate transposes
+    template <typename T>
+    __global__ void hipblasRealComplexSplitKernel(int                         rows,
+                                                  int                         cols,
+                                                  const hipblas_complex_t<T>* Z,
+                                                  int                         ldz,
+                                                  hipblasStride               stride_z,
+                                                  bool                        conj,
+                                                  T*                          Z_re,
+                                                  T*                          Z_im,
+                                                  int                         batch_count)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= rows)
+            return;
+
+        size_t plane = size_t(rows) * cols;
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+            for(int j = blockIdx.y; j < cols; j += gridDim.y)
+            {
+                hipblas_complex_t<T> z   = Z[b * stride_z + i + size_t(j) * ldz];
+                size_t               idx = b * plane + i + size_t(j) * rows;
+                Z_re[idx]                = z.x;
+                Z_im[idx]                = conj ? -z.y : z.y;
+            }
+    }
+
+    // C := alpha * (W_re + i W_im) + beta * C for the packed m by n products W_re and W_im. C
+    // isn't read when beta is zero. The scalars are read from alpha and beta when they aren't
+    // nullptr, in device pointer mode, and are alpha_value and beta_value otherwise.
+    template <typename T>
+    __global__ void hipblasRealComplexCombineKernel(int                         m,
+                                                    int                         n,
+                                                    const hipblas_complex_t<T>* alpha,
+                                                    hipblas_complex_t<T>        alpha_value,
+                                                    const T*                    W_re,
+                                                    const T*                    W_im,
+                                                    const hipblas_complex_t<T>* beta,
+                                                    hipblas_complex_t<T>        beta_value,
+                                                    hipblas_complex_t<T>*       C,
+                                                    int                         ldc,
+                                                    hipblasStride               stride_c,
+                                                    int                         batch_count)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= m)
+            return;
+
+        hipblas_complex_t<T> a  = alpha ? *alpha : alpha_value;
+        hipblas_complex_t<T> bt = beta ? *beta : beta_value;
+        hipblas_complex_t<T> zero{};
+        size_t               plane = size_t(m) * n;
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+            for(int j = blockIdx.y; j < n; j += gridDim.y)
+            {
+                size_t                idx = b * plane + i + size_t(j) * m;
+                hipblas_complex_t<T>  w   = hipblas_make_complex(W_re[idx], W_im[idx]);
+                hipblas_complex_t<T>& c   = C[b * stride_c + i + size_t(j) * ldc];
+                c = hipblas_device_axpby(a, w, bt, hipblas_device_is_zero(bt) ? zero : c);
+            }
+    }
+
+    template <typename T>
+    hipError_t hipblas_real_complex_split(int           rows,
+                                          int           cols,
+                                          const void*   Z,
+                                          int           ldz,
+                                          hipblasStride stride_z,
+                                          bool          conj,
+                                          void*         Z_re,
+                                          void*         Z_im,
+                                          int           batch_count,
+                                          hipStream_t   stream)
+    {
+        dim3 grid((rows - 1) / hipblas_real_complex_threads + 1,
+                  std::min(cols, 65535),
+                  std::min(batch_count, 65535));
+        hipblasRealComplexSplitKernel<T><<<grid, hipblas_real_complex_threads, 0, stream>>>(
+            rows,
+            cols,
+            static_cast<const hipblas_complex_t<T>*>(Z),
+            ldz,
+            stride_z,
+            conj,
+            static_cast<T*>(Z_re),
+            static_cast<T*>(Z_im),
+            batch_count);
+        return hipGetLastError();
+    }
+
+    template <typename T>
+    hipError_t hipblas_real_complex_combine(int           m,
+                                            int           n,
+                                            const void*   alpha,
+                                            bool          host_scalars,
+                                            const void*   W_re,
+                                            const void*   W_im,
+                                            const void*   beta,
+                                            void*         C,
+                                            int           ldc,
+                                            hipblasStride stride_c,
+                                            int           batch_count,
+                                            hipStream_t   stream)
+    {
+        using TC = hipblas_complex_t<T>;
+        TC alpha_value{}, beta_value{};
+        if(host_scalars)
+        {
+            alpha_value = *static_cast<const TC*>(alpha);
+            beta_value  = *static_cast<const TC*>(beta);
+        }
+
+        dim3 grid((m - 1) / hipblas_real_complex_threads + 1,
+                  std::min(n, 65535),
+                  std::min(batch_count, 65535));
+        hipblasRealComplexCombineKernel<T><<<grid, hipblas_real_complex_threads, 0, stream>>>(
+            m,
+            n,
+            host_scalars ? nullptr : static_cast<const TC*>(alpha),
+            alpha_value,
+            static_cast<const T*>(W_re),
+            static_cast<const T*>(W_im),
+            host_scalars ? nullptr : static_cast<const TC*>(beta),
+            beta_value,
+            static_cast<TC*>(C),
+            ldc,
+            stride_c,
+            batch_count);
+        return hipGetLastError();
+    }
+
+    // The real type of a real and a complex type of the same precision, or HIP_R_8I, which no
+    // gemm here takes, for any other pair
+    hipDataType hipblas_real_complex_type(hipDataType real_type, hipDataType complex_type)
+    {
+        if(real_type == HIP_R_32F && complex_type == HIP_C_32F)
+            return HIP_R_32F;
+        if(real_type == HIP_R_64F && complex_type == HIP_C_64F)
+            return HIP_R_64F;
+        return HIP_R_8I;
+    }
+}
+
+extern "C" hipblasStatus_t hipblasGemmRealComplexStridedBatchedEx(hipblasHandle_t      handle,
+                                                                  hipblasOperation_t   transA,
+                                                                  hipblasOperation_t   transB,
+                                                                  int                  m,
+                                                                  int                  n,
+                                                                  int                  k,
+                                                                  const void*          alpha,
+                                                                  const void*          A,
+                                                                  hipDataType          aType,
+                                                                  int                  lda,
+                                                                  hipblasStride        strideA,
+                                                                  const void*          B,
+                                                                  hipDataType          bType,
+                                                                  int                  ldb,
+                                                                  hipblasStride        strideB,
+                                                                  const void*          beta,
+                                                                  void*                C,
+                                                                  hipDataType          cType,
+                                                                  int                  ldc,
+                                                                  hipblasStride        strideC,
+                                                                  int                  batchCount,
+                                                                  hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transA,
+                  transB,
+                  m,
+                  n,
+                  k,
+                  aType,
+                  lda,
+                  strideA,
+                  bType,
+                  ldb,
+                  strideB,
+                  cType,
+                  ldc,
+                  strideC,
+                  batchCount,
+                  computeType);
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    for(hipblasOperation_t trans : {transA, transB})
+        if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+    int rows_a = transA == HIPBLAS_OP_N ? m : k;
+    int rows_b = transB == HIPBLAS_OP_N ? k : n;
+    if(m < 0 || n < 0 || k < 0 || batchCount < 0 || lda < std::max(rows_a, 1)
+       || ldb < std::max(rows_b, 1) || ldc < std::max(m, 1))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    bool        complex_a = aType == HIP_C_32F || aType == HIP_C_64F;
+    hipDataType real_type = complex_a ? hipblas_real_complex_type(bType, aType)
+                                      : hipblas_real_complex_type(aType, bType);
+    if(real_type == HIP_R_8I || cType != (real_type == HIP_R_32F ? HIP_C_32F : HIP_C_64F))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    if(!m || !n || !batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || !C || (k && (!A || !B)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasStatus_t      status;
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    if((status = hipblasGetStream(handle, &stream)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetPointerMode(handle, &mode)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    bool   is_float  = real_type == HIP_R_32F;
+    size_t real_size = is_float ? sizeof(float) : sizeof(double);
+
+    // C viewed as a real matrix of 2 * m rows is A viewed so times op(B) when A is complex and not
+    // transposed, with the real parts of the scalars when they have no imaginary parts
+    auto imag = [&](const void* x) {
+        return is_float ? double(static_cast<const float*>(x)[1])
+                        : static_cast<const double*>(x)[1];
+    };
+    if(complex_a && transA == HIPBLAS_OP_N && mode == HIPBLAS_POINTER_MODE_HOST && !imag(alpha)
+       && !imag(beta))
+        return hipblasGemmStridedBatchedEx_v2(handle,
+                                              transA,
+                                              transB == HIPBLAS_OP_C ? HIPBLAS_OP_T : transB,
+                                              2 * m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              real_type,
+                                              2 * lda,
+                                              2 * strideA,
+                                              B,
+                                              real_type,
+                                              ldb,
+                                              strideB,
+                                              beta,
+                                              C,
+                                              real_type,
+                                              2 * ldc,
+                                              2 * strideC,
+                                              batchCount,
+                                              computeType,
+                                              HIPBLAS_GEMM_DEFAULT);
+
+    // the complex operand Z, packed into its real and imaginary parts, and the real operand R
+    hipblasOperation_t trans_z  = complex_a ? transA : transB;
+    hipblasOperation_t trans_r  = complex_a ? transB : transA;
+    int                rows_z   = complex_a ? rows_a : rows_b;
+    int                cols_z   = complex_a ? (transA == HIPBLAS_OP_N ? k : m)
+                                            : (transB == HIPBLAS_OP_N ? n : k);
+    const void*        Z        = complex_a ? A : B;
+    const void*        R        = complex_a ? B : A;
+    int                ldz      = complex_a ? lda : ldb;
+    int                ldr      = complex_a ? ldb : lda;
+    hipblasStride      stride_z = complex_a ? strideA : strideB;
+    hipblasStride      stride_r = complex_a ? strideB : strideA;
+    if(trans_r == HIPBLAS_OP_C)
+        trans_r = HIPBLAS_OP_T;
+    hipblasOperation_t op_z = trans_z == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+
+    // the batches of a chunk have their split operands and products packed in the scratch memory
+    hipblasStride plane_z   = hipblasStride(rows_z) * cols_z;
+    hipblasStride plane_w   = hipblasStride(m) * n;
+    size_t        per_batch = 2 * (plane_z + plane_w) * real_size;
+    int           chunk     = int(std::clamp<size_t>(
+        hipblas_real_complex_scratch_bytes / per_batch, 1, size_t(batchCount)));
+    size_t        z_bytes   = hipblas_scratch_pad(plane_z * real_size * chunk);
+    size_t        w_bytes   = hipblas_scratch_pad(plane_w * real_size * chunk);
+
+    char* scratch = static_cast<char*>(hipblasGetScratch(handle, 2 * (z_bytes + w_bytes), stream));
+    if(!scratch)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    char* Z_re = scratch;
+    char* Z_im = Z_re + z_bytes;
+    char* W_re = Z_im + z_bytes;
+    char* W_im = W_re + w_bytes;
+
+    // W := op(A) * op(B) for each part with alpha one and beta zero, given in host pointer mode
+    const double one_double = 1, zero_double = 0;
+    const float  one_float = 1, zero_float = 0;
+    const void*  one  = is_float ? (const void*)&one_float : &one_double;
+    const void*  zero = is_float ? (const void*)&zero_float : &zero_double;
+    if(mode != HIPBLAS_POINTER_MODE_HOST
+       && (status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST))
+              != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    auto split   = hipblas_real_complex_split<double>;
+    auto combine = hipblas_real_complex_combine<double>;
+    if(is_float)
+    {
+        split   = hipblas_real_complex_split<float>;
+        combine = hipblas_real_complex_combine<float>;
+    }
+    size_t complex_size = 2 * real_size;
+    for(int b = 0; b < batchCount && status == HIPBLAS_STATUS_SUCCESS; b += chunk)
+    {
+        int nb = std::min(chunk, batchCount - b);
+        if(plane_z
+           && split(rows_z,
+                    cols_z,
+                    static_cast<const char*>(Z) + b * stride_z * complex_size,
+                    ldz,
+                    stride_z,
+                    trans_z == HIPBLAS_OP_C,
+                    Z_re,
+                    Z_im,
+                    nb,
+                    stream)
+                  != hipSuccess)
+        {
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+            break;
+        }
+
+        const char* r = static_cast<const char*>(R) + b * stride_r * real_size;
+        for(int part = 0; part < 2 && status == HIPBLAS_STATUS_SUCCESS; part++)
+        {
+            const char* z = part ? Z_im : Z_re;
+            void*       w = part ? W_im : W_re;
+            status        = hipblasGemmStridedBatchedEx_v2(handle,
+                                                    complex_a ? op_z : trans_r,
+                                                    complex_a ? trans_r : op_z,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    one,
+                                                    complex_a ? z : r,
+                                                    real_type,
+                                                    complex_a ? std::max(rows_z, 1) : ldr,
+                                                    complex_a ? plane_z : stride_r,
+                                                    complex_a ? r : z,
+                                                    real_type,
+                                                    complex_a ? ldr : std::max(rows_z, 1),
+                                                    complex_a ? stride_r : plane_z,
+                                                    zero,
+                                                    w,
+                                                    real_type,
+                                                    m,
+                                                    plane_w,
+                                                    nb,
+                                                    computeType,
+                                                    HIPBLAS_GEMM_DEFAULT);
+        }
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            break;
+
+        if(combine(m,
+                   n,
+                   alpha,
+                   mode != HIPBLAS_POINTER_MODE_DEVICE,
+                   W_re,
+                   W_im,
+                   beta,
+                   static_cast<char*>(C) + b * strideC * complex_size,
+                   ldc,
+                   strideC,
+                   nb,
+                   stream)
+           != hipSuccess)
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    if(mode != HIPBLAS_POINTER_MODE_HOST)
+    {
+        hipblasStatus_t mode_status = hipblasSetPointerMode(handle, mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = mode_status;
+    }
+    return status;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGemmRealComplexEx(hipblasHandle_t      handle,
+                                                    hipblasOperation_t   transA,
+                                                    hipblasOperation_t   transB,
+                                                    int                  m,
+                                                    int                  n,
+                                                    int                  k,
+                                                    const void*          alpha,
+                                                    const void*          A,
+                                                    hipDataType          aType,
+                                                    int                  lda,
+                                                    const void*          B,
+                                                    hipDataType          bType,
+                                                    int                  ldb,
+                                                    const void*          beta,
+                                                    void*                C,
+                                                    hipDataType          cType,
+                                                    int                  ldc,
+                                                    hipblasComputeType_t computeType)
+{
+    HIPBLAS_ENTRY(handle, transA, transB, m, n, k, aType, lda, bType, ldb, cType, ldc, computeType);
+
+    return hipblasGemmRealComplexStridedBatchedEx(handle,
+                                                  transA,
+                                                  transB,
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  A,
+                                                  aType,
+                                                  lda,
+                                                  0,
+                                                  B,
+                                                  bType,
+                                                  ldb,
+                                                  0,
+                                                  beta,
+                                                  C,
+                                                  cType,
+                                                  ldc,
+                                                  0,
+                                                  1,
+                                                  computeType);
+}
@@ -0,0 +1,175 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_entry.hpp"
+
+// hipblasGemmExWithRequant, built on the public gemmEx so that the int8 gemm is the tuned one
+// of the backend. D is computed in panels of columns: the int32 product of a panel is written
+// to the scratch memory of the handle and requantised into D by a kernel right after, so with
+// panels that fit in the last level cache the int32 results don't reach memory.
+
+namespace
+{
+    // the int32 results of a panel, which fit in the L2 cache of current GPUs
+    constexpr size_t hipblas_requant_panel_bytes = size_t(4) << 20;
+    constexpr int    hipblas_requant_threads     = 256;
+
+    // D := saturate(round(scale * (W + bias)) + zero_point) for the m by n panel W, with the
+    // scale, bias and zero point of each row
+    __global__ void hipblasRequantKernel(int            m,
+                                         int            n,
+                                         const int32_t* W,
+                                         const float*   scale,
+                                         const int32_t* bias,
+                                         const int32_t* zero_point,
+                                         int8_t*        D,
+                                         int            ldd)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= m)
+            return;
+
+        float   s = scale[i];
+        int64_t b = bias ? bias[i] : 0;
+        float   z = zero_point ? float(zero_point[i]) : 0.0f;
+        for(int j = blockIdx.y; j < n; j += gridDim.y)
+        {
+            float q = rintf(s * float(W[i + size_t(j) * m] + b)) + z;
+            D[i + size_t(j) * ldd] = int8_t(fminf(fmaxf(q, -128.0f), 127.0f));
+        }
+    }
+}
+
+extern "C" hipblasStatus_t hipblasGemmExWithRequant(hipblasHandle_t    handle,
+                                                    hipblasOperation_t transA,
+                                                    hipblasOperation_t transB,
+                                                    int                m,
+                                                    int                n,
+                                                    int                k,
+                                                    const int8_t*      A,
+                                                    int                lda,
+                                                    const int8_t*      B,
+                                                    int                ldb,
+                                                    int8_t*            D,
+                                                    int                ldd,
+                                                    const float*       scale,
+                                                    const int32_t*     bias,
+                                                    const int32_t*     zeroPoint)
+try
+{
+    HIPBLAS_ENTRY(handle, transA, transB, m, n, k, lda, ldb, ldd);
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    for(hipblasOperation_t trans : {transA, transB})
+        if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+    int rows_a = transA == HIPBLAS_OP_N ? m : k;
+    int rows_b = transB == HIPBLAS_OP_N ? k : n;
+    if(m < 0 || n < 0 || k < 0 || lda < std::max(rows_a, 1) || ldb < std::max(rows_b, 1)
+       || ldd < std::max(m, 1))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!D || !scale || (k && (!A || !B)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetPointerMode(handle, &mode)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // panels of whole multiples of 64 columns where possible, for the tiles of the gemm
+    int64_t panel = std::max<int64_t>(hipblas_requant_panel_bytes / (sizeof(int32_t) * m), 1);
+    if(panel > 64)
+        panel -= panel % 64;
+    int cols = int(std::min<int64_t>(panel, n));
+
+    int32_t* W = static_cast<int32_t*>(
+        hipblasGetScratch(handle, hipblas_scratch_pad(size_t(m) * cols * sizeof(int32_t)), stream));
+    if(!W)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    // alpha one and beta zero are given in host pointer mode
+    const int32_t one = 1, zero = 0;
+    if(mode != HIPBLAS_POINTER_MODE_HOST
+       && (status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST))
+              != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    int64_t b_step = transB == HIPBLAS_OP_N ? ldb : 1;
+    for(int j = 0; j < n && status == HIPBLAS_STATUS_SUCCESS; j += cols)
+    {
+        int nj = std::min(cols, n - j);
+        status = hipblasGemmEx_v2(handle,
+                                  transA,
+                                  transB,
+                                  m,
+                                  nj,
+                                  k,
+                                  &one,
+                                  A,
+                                  HIP_R_8I,
+                                  lda,
+                                  B + j * b_step,
+                                  HIP_R_8I,
+                                  ldb,
+                                  &zero,
+                                  W,
+                                  HIP_R_32I,
+                                  m,
+                                  HIPBLAS_COMPUTE_32I,
+                                  HIPBLAS_GEMM_DEFAULT);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            break;
+
+        dim3 grid((m - 1) / hipblas_requant_threads + 1, std::min(nj, 65535));
+        hipblasRequantKernel<<<grid, hipblas_requant_threads, 0, stream>>>(
+            m, nj, W, scale, bias, zeroPoint, D + size_t(j) * ldd, ldd);
+        if(hipGetLastError() != hipSuccess)
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    if(mode != HIPBLAS_POINTER_MODE_HOST)
+    {
+        hipblasStatus_t mode_status = hipblasSetPointerMode(handle, mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = mode_status;
+    }
+    return status;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
@@ -0,0 +1,336 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_complex.h>
+#include <hip/hip_fp16.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_handle_state.hpp"
+
+// hipblasGemmStridedBatchedExWithScalarArrays, built on the public strided batched gemmEx so it
+// is the same for both backends. Neither rocBLAS nor cuBLAS takes an alpha and beta for each
+// problem of a batch, so the products are computed into the scratch memory of the handle and
+// scaled into C by one kernel, which reads each alpha_i and beta_i on the device.
+
+namespace
+{
+    constexpr int hipblas_scalar_arrays_block = 256;
+
+    // C_b := alpha_b * W_b + beta_b * C_b for the m-by-n matrices of each problem b, with W_b
+    // packed. C_b isn't read when beta_b is zero.
+    template <typename TC, typename TS>
+    __global__ void hipblasGemmScalarArraysKernel(int           m,
+                                                  int           n,
+                                                  int           batch_count,
+                                                  const TC*     W,
+                                                  const TS*     alpha,
+                                                  hipblasStride stride_alpha,
+                                                  const TS*     beta,
+                                                  hipblasStride stride_beta,
+                                                  TC*           C,
+                                                  int           ldc,
+                                                  hipblasStride stride_c)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= m)
+            return;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            auto a  = hipblas_device_load(alpha[b * stride_alpha]);
+            auto bt = hipblas_device_load(beta[b * stride_beta]);
+            for(int j = blockIdx.y; j < n; j += gridDim.y)
+            {
+                TC&  c = C[b * stride_c + size_t(j) * ldc + i];
+                auto w = hipblas_device_load(W[(size_t(b) * n + j) * m + i]);
+                auto r = hipblas_device_is_zero(bt)
+                             ? hipblas_device_axpby(a, w, bt, decltype(w){})
+                             : hipblas_device_axpby(a, w, bt, hipblas_device_load(c));
+                hipblas_device_store(r, c);
+            }
+        }
+    }
+
+    template <typename TC, typename TS>
+    hipError_t hipblas_scalar_arrays_scale(int           m,
+                                           int           n,
+                                           int           batch_count,
+                                           const void*   W,
+                                           const void*   alpha,
+                                           hipblasStride stride_alpha,
+                                           const void*   beta,
+                                           hipblasStride stride_beta,
+                                           void*         C,
+                                           int           ldc,
+                                           hipblasStride stride_c,
+                                           hipStream_t   stream)
+    {
+        dim3 grid((m - 1) / hipblas_scalar_arrays_block + 1,
+                  std::min(n, 65535),
+                  std::min(batch_count, 65535));
+        hipblasGemmScalarArraysKernel<TC, TS>
+            <<<grid, hipblas_scalar_arrays_block, 0, stream>>>(m,
+                                                               n,
+                                                               batch_count,
+                                                               (const TC*)W,
+                                                               (const TS*)alpha,
+                                                               stride_alpha,
+                                                               (const TS*)beta,
+                                                               stride_beta,
+                                                               (TC*)C,
+                                                               ldc,
+                                                               stride_c);
+        return hipGetLastError();
+    }
+
+    using hipblas_scalar_arrays_scale_fn = hipError_t (*)(int,
+                                                          int,
+                                                          int,
+                                                          const void*,
+                                                          const void*,
+                                                          hipblasStride,
+                                                          const void*,
+                                                          hipblasStride,
+                                                          void*,
+                                                          int,
+                                                          hipblasStride,
+                                                          hipStream_t);
+
+    // The kernel for the type of C and the scalars, which have the type of computeType, with
+    // the sizes of both. Returns nullptr for the types it doesn't support.
+    hipblas_scalar_arrays_scale_fn hipblas_scalar_arrays_kernel(hipDataType          c_type,
+                                                                hipblasComputeType_t compute_type,
+                                                                size_t*              c_size,
+                                                                size_t*              scalar_size)
+    {
+        bool half_scalars
+            = compute_type == HIPBLAS_COMPUTE_16F || compute_type == HIPBLAS_COMPUTE_16F_PEDANTIC;
+        bool double_scalars
+            = compute_type == HIPBLAS_COMPUTE_64F || compute_type == HIPBLAS_COMPUTE_64F_PEDANTIC;
+        bool int_scalars
+            = compute_type == HIPBLAS_COMPUTE_32I || compute_type == HIPBLAS_COMPUTE_32I_PEDANTIC;
+        bool float_scalars = !half_scalars && !double_scalars && !int_scalars;
+
+        switch(c_type)
+        {
+        case HIP_R_16F:
+            *c_size = sizeof(__half);
+            if(half_scalars)
+            {
+                *scalar_size = sizeof(__half);
+                return hipblas_scalar_arrays_scale<__half, __half>;
+            }
+            *scalar_size = sizeof(float);
+            return float_scalars ? hipblas_scalar_arrays_scale<__half, float> : nullptr;
+        case HIP_R_16BF:
+            *c_size      = sizeof(hipblas_device_bf16);
+            *scalar_size = sizeof(float);
+            return float_scalars ? hipblas_scalar_arrays_scale<hipblas_device_bf16, float>
+                                 : nullptr;
+        case HIP_R_32F:
+            *c_size = *scalar_size = sizeof(float);
+            return float_scalars ? hipblas_scalar_arrays_scale<float, float> : nullptr;
+        case HIP_R_64F:
+            *c_size = *scalar_size = sizeof(double);
+            return double_scalars ? hipblas_scalar_arrays_scale<double, double> : nullptr;
+        case HIP_C_32F:
+            *c_size = *scalar_size = sizeof(hipFloatComplex);
+            return float_scalars ? hipblas_scalar_arrays_scale<hipFloatComplex, hipFloatComplex>
+                                 : nullptr;
+        case HIP_C_64F:
+            *c_size = *scalar_size = sizeof(hipDoubleComplex);
+            return double_scalars
+                       ? hipblas_scalar_arrays_scale<hipDoubleComplex, hipDoubleComplex>
+                       : nullptr;
+        default:
+            return nullptr;
+        }
+    }
+}
+
+extern "C" hipblasStatus_t
+    hipblasGemmStridedBatchedExWithScalarArrays(hipblasHandle_t      handle,
+                                                hipblasOperation_t   transA,
+                                                hipblasOperation_t   transB,
+                                                int                  m,
+                                                int                  n,
+                                                int                  k,
+                                                const void*          alpha,
+                                                hipblasStride        strideAlpha,
+                                                const void*          A,
+                                                hipDataType          aType,
+                                                int                  lda,
+                                                hipblasStride        strideA,
+                                                const void*          B,
+                                                hipDataType          bType,
+                                                int                  ldb,
+                                                hipblasStride        strideB,
+                                                const void*          beta,
+                                                hipblasStride        strideBeta,
+                                                void*                C,
+                                                hipDataType          cType,
+                                                int                  ldc,
+                                                hipblasStride        strideC,
+                                                int                  batchCount,
+                                                hipblasComputeType_t computeType,
+                                                hipblasGemmAlgo_t    algo)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(m < 0 || n < 0 || k < 0 || batchCount < 0 || ldc < std::max(m, 1) || strideAlpha < 0
+       || strideBeta < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n || !batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // the same scalars for every problem
+    if(!strideAlpha && !strideBeta)
+        return hipblasGemmStridedBatchedEx_v2(handle,
+                                              transA,
+                                              transB,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              aType,
+                                              lda,
+                                              strideA,
+                                              B,
+                                              bType,
+                                              ldb,
+                                              strideB,
+                                              beta,
+                                              C,
+                                              cType,
+                                              ldc,
+                                              strideC,
+                                              batchCount,
+                                              computeType,
+                                              algo);
+
+    size_t c_size, scalar_size;
+    auto   scale = hipblas_scalar_arrays_kernel(cType, computeType, &c_size, &scalar_size);
+    if(!scale)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetPointerMode(handle, &mode)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // the products, then in host pointer mode the scalars copied to the device
+    size_t w_bytes      = hipblas_scratch_pad(size_t(m) * n * batchCount * c_size);
+    size_t alpha_bytes  = ((batchCount - 1) * strideAlpha + 1) * scalar_size;
+    size_t beta_bytes   = ((batchCount - 1) * strideBeta + 1) * scalar_size;
+    size_t beta_offset  = w_bytes + hipblas_scratch_pad(alpha_bytes);
+    bool   host_scalars = mode != HIPBLAS_POINTER_MODE_DEVICE;
+    char*  scratch      = static_cast<char*>(
+        hipblasGetScratch(handle, host_scalars ? beta_offset + beta_bytes : w_bytes, stream));
+    if(!scratch)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    const void* d_alpha = alpha;
+    const void* d_beta  = beta;
+    if(host_scalars)
+    {
+        d_alpha = scratch + w_bytes;
+        d_beta  = scratch + beta_offset;
+        if(hipMemcpyAsync(scratch + w_bytes, alpha, alpha_bytes, hipMemcpyHostToDevice, stream)
+               != hipSuccess
+           || hipMemcpyAsync(scratch + beta_offset, beta, beta_bytes, hipMemcpyHostToDevice, stream)
+                  != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    // W_b := op(A_b) * op(B_b), with alpha one and beta zero given in host pointer mode
+    char one[16] = {}, zero[16] = {};
+    hipblas_scalar_one(computeType, one);
+
+    if(!host_scalars
+       && (status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST))
+              != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    status = hipblasGemmStridedBatchedEx_v2(handle,
+                                            transA,
+                                            transB,
+                                            m,
+                                            n,
+                                            k,
+                                            one,
+                                            A,
+                                            aType,
+                                            lda,
+                                            strideA,
+                                            B,
+                                            bType,
+                                            ldb,
+                                            strideB,
+                                            zero,
+                                            scratch,
+                                            cType,
+                                            m,
+                                            hipblasStride(m) * n,
+                                            batchCount,
+                                            computeType,
+                                            algo);
+    if(!host_scalars)
+    {
+        hipblasStatus_t mode_status = hipblasSetPointerMode(handle, mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = mode_status;
+    }
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    if(scale(m,
+             n,
+             batchCount,
+             scratch,
+             d_alpha,
+             strideAlpha,
+             d_beta,
+             strideBeta,
+             C,
+             ldc,
+             strideC,
+             stream)
+       != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
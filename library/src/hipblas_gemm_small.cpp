@@ -0,0 +1,441 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_gemm_small.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_interleaved_batch.hpp"
+
+// The small batched gemms of hipblas_gemm_small.hpp. A block of hipblas_small_gemm_threads
+// threads computes P problems at once: every problem is padded with zeros to S x S, op(A) and
+// op(B) are loaded into shared memory with the reads of each column of A and B coalesced, and
+// each thread accumulates R elements of a column of C in registers over the S columns of op(A),
+// a loop that is unrolled as S is known at compile time.
+
+namespace
+{
+    constexpr int hipblas_small_gemm_threads = 256;
+    constexpr int hipblas_small_gemm_max     = 32;
+
+    // Smallest batch computed by these kernels; the backend is as fast for fewer problems
+    constexpr int64_t hipblas_small_gemm_min_batch = 32;
+
+    template <typename T>
+    __device__ inline T hipblas_small_gemm_fma(T a, T b, T c)
+    {
+        return a * b + c;
+    }
+
+    __device__ inline hipFloatComplex
+        hipblas_small_gemm_fma(hipFloatComplex a, hipFloatComplex b, hipFloatComplex c)
+    {
+        return hipCfmaf(a, b, c);
+    }
+
+    __device__ inline hipDoubleComplex
+        hipblas_small_gemm_fma(hipDoubleComplex a, hipDoubleComplex b, hipDoubleComplex c)
+    {
+        return hipCfma(a, b, c);
+    }
+
+    // The matrix b of a batch, from an array of pointers or at a stride from the first one
+    template <typename T>
+    __device__ inline T*
+        hipblas_small_gemm_matrix(const void* X, hipblasStride stride, bool batched, int64_t b)
+    {
+        if(batched)
+            return static_cast<T* const*>(X)[b];
+        return static_cast<T*>(const_cast<void*>(X)) + b * stride;
+    }
+
+    // Loads op(X), rows by cols, into the S x S tile padded with zeros, so that
+    // tile[i][j] = op(X)(i, j). The threads read consecutive elements of the columns of X.
+    template <typename T, int S>
+    __device__ inline void hipblas_small_gemm_load(T (*tile)[S + 1],
+                                                   const T*           X,
+                                                   int64_t            ldx,
+                                                   hipblasOperation_t trans,
+                                                   int                rows,
+                                                   int                cols,
+                                                   int                thread,
+                                                   int                threads)
+    {
+        for(int e = thread; e < S * S; e += threads)
+        {
+            int r = e % S, c = e / S;
+            T   x{};
+            if(trans == HIPBLAS_OP_N)
+            {
+                if(r < rows && c < cols)
+                    x = X[r + c * ldx];
+                tile[r][c] = x;
+            }
+            else
+            {
+                // X(r, c) is op(X)(c, r)
+                if(r < cols && c < rows)
+                    x = X[r + c * ldx];
+                tile[c][r] = trans == HIPBLAS_OP_C ? hipblas_device_conj(x) : x;
+            }
+        }
+    }
+
+    // C_b := alpha * op(A_b) * op(B_b) + beta * C_b for P problems per block and R rows of C
+    // per thread. A_b and B_b aren't read when alpha is zero and C_b isn't read when beta is
+    // zero. The scalars are read from alpha and beta when they aren't nullptr, in device
+    // pointer mode, and are alpha_value and beta_value otherwise.
+    template <typename T, int S, int R>
+    __global__ void __launch_bounds__(hipblas_small_gemm_threads)
+        hipblasSmallGemmKernel(hipblasOperation_t transA,
+                               hipblasOperation_t transB,
+                               int                m,
+                               int                n,
+                               int                k,
+                               const T*           alpha,
+                               T                  alpha_value,
+                               const void*        A,
+                               int64_t            lda,
+                               hipblasStride      strideA,
+                               const void*        B,
+                               int64_t            ldb,
+                               hipblasStride      strideB,
+                               const T*           beta,
+                               T                  beta_value,
+                               void*              C,
+                               int64_t            ldc,
+                               hipblasStride      strideC,
+                               bool               batched,
+                               int64_t            batch_count)
+    {
+        constexpr int threads = S * S / R;
+        constexpr int P       = hipblas_small_gemm_threads / threads;
+        constexpr int rows    = S / R;
+
+        __shared__ T tile_a[P][S][S + 1];
+        __shared__ T tile_b[P][S][S + 1];
+
+        T    a       = alpha ? *alpha : alpha_value;
+        T    bt      = beta ? *beta : beta_value;
+        bool read_ab = !hipblas_device_is_zero(a);
+        bool read_c  = !hipblas_device_is_zero(bt);
+        int  p       = threadIdx.x / threads;
+        int  t       = threadIdx.x % threads;
+        int  i0      = t % rows;
+        int  j       = t / rows;
+
+        for(int64_t b0 = int64_t(blockIdx.x) * P; b0 < batch_count; b0 += int64_t(gridDim.x) * P)
+        {
+            int64_t b      = b0 + p;
+            bool    active = b < batch_count;
+            if(active && read_ab)
+            {
+                const T* Ab = hipblas_small_gemm_matrix<const T>(A, strideA, batched, b);
+                const T* Bb = hipblas_small_gemm_matrix<const T>(B, strideB, batched, b);
+                hipblas_small_gemm_load<T, S>(tile_a[p], Ab, lda, transA, m, k, t, threads);
+                hipblas_small_gemm_load<T, S>(tile_b[p], Bb, ldb, transB, k, n, t, threads);
+            }
+            __syncthreads();
+
+            if(active && j < n)
+            {
+                T acc[R];
+#pragma unroll
+                for(int q = 0; q < R; q++)
+                    acc[q] = T{};
+                if(read_ab)
+                {
+#pragma unroll
+                    for(int l = 0; l < S; l++)
+                    {
+                        T y = tile_b[p][l][j];
+#pragma unroll
+                        for(int q = 0; q < R; q++)
+                            acc[q] = hipblas_small_gemm_fma(tile_a[p][i0 + q * rows][l], y, acc[q]);
+                    }
+                }
+
+                T* Cb = hipblas_small_gemm_matrix<T>(C, strideC, batched, b);
+#pragma unroll
+                for(int q = 0; q < R; q++)
+                {
+                    int i = i0 + q * rows;
+                    if(i >= m)
+                        continue;
+                    T& c = Cb[i + j * ldc];
+                    c    = hipblas_device_axpby(a, acc[q], bt, read_c ? c : T{});
+                }
+            }
+
+            // the tiles are reused by the next problems of the batch
+            __syncthreads();
+        }
+    }
+
+    template <typename T, int S, int R>
+    hipError_t hipblas_small_gemm_launch(hipblasOperation_t transA,
+                                         hipblasOperation_t transB,
+                                         int                m,
+                                         int                n,
+                                         int                k,
+                                         const void*        alpha,
+                                         bool               host_scalars,
+                                         const void*        A,
+                                         int64_t            lda,
+                                         hipblasStride      strideA,
+                                         const void*        B,
+                                         int64_t            ldb,
+                                         hipblasStride      strideB,
+                                         const void*        beta,
+                                         void*              C,
+                                         int64_t            ldc,
+                                         hipblasStride      strideC,
+                                         bool               batched,
+                                         int64_t            batch_count,
+                                         hipStream_t        stream)
+    {
+        constexpr int P = hipblas_small_gemm_threads / (S * S / R);
+
+        T alpha_value{}, beta_value{};
+        if(host_scalars)
+        {
+            alpha_value = *static_cast<const T*>(alpha);
+            beta_value  = *static_cast<const T*>(beta);
+        }
+
+        int blocks = int(std::min<int64_t>((batch_count - 1) / P + 1, 65535));
+        hipblasSmallGemmKernel<T, S, R>
+            <<<blocks, hipblas_small_gemm_threads, 0, stream>>>(
+                transA,
+                transB,
+                m,
+                n,
+                k,
+                host_scalars ? nullptr : (const T*)alpha,
+                alpha_value,
+                A,
+                lda,
+                strideA,
+                B,
+                ldb,
+                strideB,
+                host_scalars ? nullptr : (const T*)beta,
+                beta_value,
+                C,
+                ldc,
+                strideC,
+                batched,
+                batch_count);
+        return hipGetLastError();
+    }
+
+    using hipblas_small_gemm_fn = hipError_t (*)(hipblasOperation_t,
+                                                 hipblasOperation_t,
+                                                 int,
+                                                 int,
+                                                 int,
+                                                 const void*,
+                                                 bool,
+                                                 const void*,
+                                                 int64_t,
+                                                 hipblasStride,
+                                                 const void*,
+                                                 int64_t,
+                                                 hipblasStride,
+                                                 const void*,
+                                                 void*,
+                                                 int64_t,
+                                                 hipblasStride,
+                                                 bool,
+                                                 int64_t,
+                                                 hipStream_t);
+
+    // The kernel for problems padded to size: 16 problems of 4 x 4 or 4 of 8 x 8 per block with
+    // an element of C per thread, and 2 of 16 x 16 or 1 of 32 x 32 with 2 and 4 per thread
+    template <typename T>
+    hipblas_small_gemm_fn hipblas_small_gemm_size(int size)
+    {
+        if(size <= 4)
+            return hipblas_small_gemm_launch<T, 4, 1>;
+        if(size <= 8)
+            return hipblas_small_gemm_launch<T, 8, 1>;
+        if(size <= 16)
+            return hipblas_small_gemm_launch<T, 16, 2>;
+        return hipblas_small_gemm_launch<T, 32, 4>;
+    }
+
+    // The kernel for the types, or nullptr for the types the kernels don't support
+    hipblas_small_gemm_fn hipblas_small_gemm_kernel(hipDataType          a_type,
+                                                    hipDataType          b_type,
+                                                    hipDataType          c_type,
+                                                    hipblasComputeType_t compute_type,
+                                                    int                  size)
+    {
+        if(a_type != b_type || b_type != c_type)
+            return nullptr;
+        switch(compute_type)
+        {
+        case HIPBLAS_COMPUTE_32F:
+        case HIPBLAS_COMPUTE_32F_PEDANTIC:
+            if(c_type == HIP_R_32F)
+                return hipblas_small_gemm_size<float>(size);
+            if(c_type == HIP_C_32F)
+                return hipblas_small_gemm_size<hipFloatComplex>(size);
+            return nullptr;
+        case HIPBLAS_COMPUTE_64F:
+        case HIPBLAS_COMPUTE_64F_PEDANTIC:
+            if(c_type == HIP_R_64F)
+                return hipblas_small_gemm_size<double>(size);
+            if(c_type == HIP_C_64F)
+                return hipblas_small_gemm_size<hipDoubleComplex>(size);
+            return nullptr;
+        default:
+            return nullptr;
+        }
+    }
+
+    bool hipblas_small_gemm_enabled()
+    {
+        static const bool enabled = [] {
+            const char* env = getenv("HIPBLAS_SMALL_GEMM");
+            return !env || *env != '0';
+        }();
+        return enabled;
+    }
+}
+
+hipblasStatus_t hipblasSmallGemm(hipblasHandle_t      handle,
+                                 hipblasOperation_t   transA,
+                                 hipblasOperation_t   transB,
+                                 int64_t              m,
+                                 int64_t              n,
+                                 int64_t              k,
+                                 const void*          alpha,
+                                 const void*          A,
+                                 hipDataType          aType,
+                                 int64_t              lda,
+                                 hipblasStride        strideA,
+                                 const void*          B,
+                                 hipDataType          bType,
+                                 int64_t              ldb,
+                                 hipblasStride        strideB,
+                                 const void*          beta,
+                                 void*                C,
+                                 hipDataType          cType,
+                                 int64_t              ldc,
+                                 hipblasStride        strideC,
+                                 int64_t              batchCount,
+                                 hipblasComputeType_t computeType,
+                                 bool                 batched)
+try
+{
+    // The backend can't read the interleaved layout, so its calls are all taken
+    if(!batched && hipblasIsInterleavedBatch(handle))
+        return hipblasInterleavedGemm(handle,
+                                      transA,
+                                      transB,
+                                      m,
+                                      n,
+                                      k,
+                                      alpha,
+                                      A,
+                                      aType,
+                                      lda,
+                                      strideA,
+                                      B,
+                                      bType,
+                                      ldb,
+                                      strideB,
+                                      beta,
+                                      C,
+                                      cType,
+                                      ldc,
+                                      strideC,
+                                      batchCount,
+                                      computeType);
+
+    if(!handle || !hipblas_small_gemm_enabled())
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    auto valid_trans = [](hipblasOperation_t trans) {
+        return trans == HIPBLAS_OP_N || trans == HIPBLAS_OP_T || trans == HIPBLAS_OP_C;
+    };
+    if(!valid_trans(transA) || !valid_trans(transB))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // Empty problems and the quick returns of the backend stay with the backend
+    int64_t size = std::max({m, n, k});
+    if(m < 1 || n < 1 || k < 1 || size > hipblas_small_gemm_max
+       || batchCount < hipblas_small_gemm_min_batch)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    int64_t rows_a = transA == HIPBLAS_OP_N ? m : k;
+    int64_t rows_b = transB == HIPBLAS_OP_N ? k : n;
+    if(lda < rows_a || ldb < rows_b || ldc < m || !alpha || !beta || !A || !B || !C)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    auto gemm = hipblas_small_gemm_kernel(aType, bType, cType, computeType, int(size));
+    if(!gemm)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetPointerMode(handle, &mode)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    if(gemm(transA,
+            transB,
+            int(m),
+            int(n),
+            int(k),
+            alpha,
+            mode != HIPBLAS_POINTER_MODE_DEVICE,
+            A,
+            lda,
+            strideA,
+            B,
+            ldb,
+            strideB,
+            beta,
+            C,
+            ldc,
+            strideC,
+            batched,
+            batchCount,
+            stream)
+       != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
@@ -0,0 +1,316 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_entry.hpp"
+
+// hipblasSparseCompress2of4 and hipblasGemmExSparse, gemms with an A that has at most two
+// nonzeros in each group of four consecutive elements of its rows. The compressed A keeps the
+// two elements of each group and 2-bit indices of their positions in the group, half the size
+// of A and an eighth of it for the indices. The product expands row panels of the compressed A
+// into the scratch memory of the handle and computes them with the gemmEx of the backend.
+
+namespace
+{
+    constexpr int    hipblas_sparse_threads     = 256;
+    constexpr size_t hipblas_sparse_panel_bytes = size_t(32) << 20;
+
+    // Ac(i, 2g:2g+1) := the two elements of largest magnitude of A(i, 4g:4g+3), in the order of
+    // their columns, and meta(i, g) := their positions in the group, the first in the low bits.
+    // Elements of equal magnitude are kept from the left, so that a group with two nonzeros or
+    // less is kept as it is.
+    template <typename T>
+    __global__ void hipblasSparseCompressKernel(int      m,
+                                                int      groups,
+                                                const T* A,
+                                                int      lda,
+                                                T*       Ac,
+                                                int      ldac,
+                                                uint8_t* meta,
+                                                int      ldm)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= m)
+            return;
+
+        for(int g = blockIdx.y; g < groups; g += gridDim.y)
+        {
+            T     a[4];
+            float mag[4];
+            for(int q = 0; q < 4; q++)
+            {
+                a[q]   = A[i + size_t(4 * g + q) * lda];
+                mag[q] = fabsf(hipblas_device_load(a[q]));
+            }
+
+            int first = 0;
+            for(int q = 1; q < 4; q++)
+                if(mag[q] > mag[first])
+                    first = q;
+            int second = first == 0 ? 1 : 0;
+            for(int q = second + 1; q < 4; q++)
+                if(q != first && mag[q] > mag[second])
+                    second = q;
+
+            int lo = std::min(first, second), hi = std::max(first, second);
+            Ac[i + size_t(2 * g) * ldac]     = a[lo];
+            Ac[i + size_t(2 * g + 1) * ldac] = a[hi];
+            meta[i + size_t(g) * ldm]        = uint8_t(lo | hi << 2);
+        }
+    }
+
+    // W(ii, :) := row i0 + ii of the expanded A for ii < mi. Only the size of the elements
+    // matters, so the kernel is instantiated for unsigned integers of each size.
+    template <typename T>
+    __global__ void hipblasSparseExpandKernel(int            i0,
+                                              int            mi,
+                                              int            groups,
+                                              const T*       Ac,
+                                              int            ldac,
+                                              const uint8_t* meta,
+                                              int            ldm,
+                                              T*             W)
+    {
+        int ii = blockIdx.x * blockDim.x + threadIdx.x;
+        if(ii >= mi)
+            return;
+
+        int i = i0 + ii;
+        for(int g = blockIdx.y; g < groups; g += gridDim.y)
+        {
+            uint8_t pos = meta[i + size_t(g) * ldm];
+            T       lo  = Ac[i + size_t(2 * g) * ldac];
+            T       hi  = Ac[i + size_t(2 * g + 1) * ldac];
+            for(int q = 0; q < 4; q++)
+                W[ii + size_t(4 * g + q) * mi]
+                    = q == (pos & 3) ? lo : (q == ((pos >> 2) & 3) ? hi : T(0));
+        }
+    }
+
+    template <typename T>
+    hipError_t hipblas_sparse_compress_launch(int         m,
+                                              int         groups,
+                                              const void* A,
+                                              int         lda,
+                                              void*       Ac,
+                                              int         ldac,
+                                              void*       meta,
+                                              int         ldm,
+                                              hipStream_t stream)
+    {
+        dim3 grid((m - 1) / hipblas_sparse_threads + 1, std::min(groups, 65535));
+        hipblasSparseCompressKernel<T>
+            <<<grid, hipblas_sparse_threads, 0, stream>>>(m,
+                                                          groups,
+                                                          static_cast<const T*>(A),
+                                                          lda,
+                                                          static_cast<T*>(Ac),
+                                                          ldac,
+                                                          static_cast<uint8_t*>(meta),
+                                                          ldm);
+        return hipGetLastError();
+    }
+
+    template <typename T>
+    hipError_t hipblas_sparse_expand_launch(int         i0,
+                                            int         mi,
+                                            int         groups,
+                                            const void* Ac,
+                                            int         ldac,
+                                            const void* meta,
+                                            int         ldm,
+                                            void*       W,
+                                            hipStream_t stream)
+    {
+        dim3 grid((mi - 1) / hipblas_sparse_threads + 1, std::min(groups, 65535));
+        hipblasSparseExpandKernel<T>
+            <<<grid, hipblas_sparse_threads, 0, stream>>>(i0,
+                                                          mi,
+                                                          groups,
+                                                          static_cast<const T*>(Ac),
+                                                          ldac,
+                                                          static_cast<const uint8_t*>(meta),
+                                                          ldm,
+                                                          static_cast<T*>(W));
+        return hipGetLastError();
+    }
+
+    // The size of the elements of the types of A and C, or 0 for the types that aren't supported
+    size_t hipblas_sparse_type_size(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_16F:
+        case HIP_R_16BF:
+            return 2;
+        case HIP_R_32F:
+            return 4;
+        default:
+            return 0;
+        }
+    }
+}
+
+extern "C" hipblasStatus_t hipblasSparseCompress2of4(hipblasHandle_t handle,
+                                                     int             m,
+                                                     int             k,
+                                                     const void*     A,
+                                                     hipDataType     aType,
+                                                     int             lda,
+                                                     void*           Ac,
+                                                     int             ldac,
+                                                     void*           metadata,
+                                                     int             ldm)
+try
+{
+    HIPBLAS_ENTRY(handle, m, k, aType, lda, ldac, ldm);
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!hipblas_sparse_type_size(aType))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(m < 0 || k < 0 || k % 4 || lda < std::max(m, 1) || ldac < std::max(m, 1)
+       || ldm < std::max(m, 1))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !k)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!A || !Ac || !metadata)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    auto launch = aType == HIP_R_16F    ? hipblas_sparse_compress_launch<__half>
+                  : aType == HIP_R_16BF ? hipblas_sparse_compress_launch<hipblas_device_bf16>
+                                        : hipblas_sparse_compress_launch<float>;
+    if(launch(m, k / 4, A, lda, Ac, ldac, metadata, ldm, stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGemmExSparse(hipblasHandle_t      handle,
+                                               hipblasOperation_t   transB,
+                                               int                  m,
+                                               int                  n,
+                                               int                  k,
+                                               const void*          alpha,
+                                               const void*          Ac,
+                                               hipDataType          aType,
+                                               int                  ldac,
+                                               const void*          metadata,
+                                               int                  ldm,
+                                               const void*          B,
+                                               hipDataType          bType,
+                                               int                  ldb,
+                                               const void*          beta,
+                                               void*                C,
+                                               hipDataType          cType,
+                                               int                  ldc,
+                                               hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_ENTRY(handle, transB, m, n, k, aType, ldac, ldm, bType, ldb, cType, ldc, computeType);
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(transB != HIPBLAS_OP_N && transB != HIPBLAS_OP_T && transB != HIPBLAS_OP_C)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    size_t a_size = hipblas_sparse_type_size(aType);
+    size_t c_size = hipblas_sparse_type_size(cType);
+    if(!a_size || !c_size)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    int rows_b = transB == HIPBLAS_OP_N ? k : n;
+    if(m < 0 || n < 0 || k < 0 || k % 4 || ldac < std::max(m, 1) || ldm < std::max(m, 1)
+       || ldb < std::max(rows_b, 1) || ldc < std::max(m, 1))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || !C || (k && (!Ac || !metadata || !B)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // panels of whole multiples of 64 rows where possible, for the tiles of the gemm
+    int64_t panel = std::max<int64_t>(hipblas_sparse_panel_bytes / (a_size * std::max(k, 1)), 1);
+    if(panel > 64)
+        panel -= panel % 64;
+    int rows = int(std::min<int64_t>(panel, m));
+
+    size_t w_bytes = hipblas_scratch_pad(a_size * rows * std::max(k, 1));
+    void*  W       = hipblasGetScratch(handle, w_bytes, stream);
+    if(!W)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    auto expand = a_size == 2 ? hipblas_sparse_expand_launch<uint16_t>
+                              : hipblas_sparse_expand_launch<uint32_t>;
+
+    for(int i = 0; i < m && status == HIPBLAS_STATUS_SUCCESS; i += rows)
+    {
+        int mi = std::min(rows, m - i);
+        if(k && expand(i, mi, k / 4, Ac, ldac, metadata, ldm, W, stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        status = hipblasGemmEx_v2(handle,
+                                  HIPBLAS_OP_N,
+                                  transB,
+                                  mi,
+                                  n,
+                                  k,
+                                  alpha,
+                                  W,
+                                  aType,
+                                  mi,
+                                  B,
+                                  bType,
+                                  ldb,
+                                  beta,
+                                  static_cast<char*>(C) + c_size * i,
+                                  cType,
+                                  ldc,
+                                  computeType,
+                                  HIPBLAS_GEMM_DEFAULT);
+    }
+    return status;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
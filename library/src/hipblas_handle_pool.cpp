@@ -0,0 +1,261 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <map>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "exceptions.hpp"
+#include "hipblas_thread_stream.hpp"
+
+// Handles of a pool are created with the public hipblasCreate on the device of the pool, so the
+// pool works the same on every backend. defaults is never acquired, and its modes are given back
+// to each handle released.
+struct hipblasHandlePool
+{
+    int                                 device;
+    hipblasHandle_t                     defaults;
+    std::mutex                          mutex;
+    std::vector<hipblasHandle_t>        free;
+    std::unordered_set<hipblasHandle_t> acquired;
+};
+
+namespace
+{
+    // Creates a handle on device, leaving the current device of the thread unchanged
+    hipblasStatus_t hipblas_handle_pool_create_handle(int device, hipblasHandle_t* handle)
+    {
+        int current;
+        if(hipGetDevice(&current) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        if(current != device && hipSetDevice(device) != hipSuccess)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipblasStatus_t status = hipblasCreate(handle);
+
+        if(current != device)
+            (void)hipSetDevice(current);
+        return status;
+    }
+
+    // The handles of hipblasGetThreadLocalHandle of a thread, destroyed when the thread exits
+    struct hipblas_thread_handles
+    {
+        std::map<int, hipblasHandle_t> handles;
+
+        ~hipblas_thread_handles()
+        {
+            for(auto& device_handle : handles)
+                hipblasDestroy(device_handle.second);
+        }
+    };
+}
+
+extern "C" hipblasStatus_t
+    hipblasHandlePoolCreate(hipblasHandlePool_t* pool, int deviceId, int size)
+try
+{
+    if(pool == nullptr || size < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *pool = nullptr;
+
+    int device_count;
+    if(hipGetDeviceCount(&device_count) != hipSuccess)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(deviceId < 0 || deviceId >= device_count)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    auto* p   = new hipblasHandlePool;
+    p->device = deviceId;
+    hipblasStatus_t status = hipblas_handle_pool_create_handle(deviceId, &p->defaults);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        delete p;
+        return status;
+    }
+    p->free.reserve(size);
+    for(int i = 0; i < size; i++)
+    {
+        hipblasHandle_t handle;
+        status = hipblas_handle_pool_create_handle(deviceId, &handle);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            for(hipblasHandle_t h : p->free)
+                hipblasDestroy(h);
+            hipblasDestroy(p->defaults);
+            delete p;
+            return status;
+        }
+        p->free.push_back(handle);
+    }
+
+    *pool = p;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasHandlePoolDestroy(hipblasHandlePool_t pool)
+try
+{
+    if(pool == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        if(!pool->acquired.empty())
+            return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    hipblasStatus_t status = hipblasDestroy(pool->defaults);
+    for(hipblasHandle_t handle : pool->free)
+    {
+        hipblasStatus_t destroy_status = hipblasDestroy(handle);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = destroy_status;
+    }
+    delete pool;
+    return status;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasHandlePoolAcquire(hipblasHandlePool_t pool,
+                                                    hipStream_t         stream,
+                                                    hipblasHandle_t*    handle)
+try
+{
+    if(pool == nullptr || handle == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *handle = nullptr;
+
+    // the default stream goes with the device of the pool, any other stream must be on it
+    int device;
+    if(stream && (hipStreamGetDevice(stream, &device) != hipSuccess || device != pool->device))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasHandle_t h = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        if(!pool->free.empty())
+        {
+            h = pool->free.back();
+            pool->free.pop_back();
+        }
+    }
+
+    // the pool grows outside of the lock, as creating a handle is slow
+    if(!h)
+    {
+        hipblasStatus_t status = hipblas_handle_pool_create_handle(pool->device, &h);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+
+    hipblasStatus_t status = hipblasSetStream(h, stream);
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        pool->free.push_back(h);
+        return status;
+    }
+    pool->acquired.insert(h);
+    *handle = h;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasHandlePoolRelease(hipblasHandlePool_t pool,
+                                                    hipblasHandle_t     handle)
+try
+{
+    if(pool == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        if(!pool->acquired.erase(handle))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    // the modes are reset outside of the lock, and a handle that can't be reset is destroyed
+    // rather than acquired again with the modes of its last user
+    hipblasStatus_t status = hipblasCopyHandleModes(pool->defaults, handle);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasDestroy(handle);
+        return status;
+    }
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    pool->free.push_back(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetThreadLocalHandle(int deviceId, hipblasHandle_t* handle)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *handle = nullptr;
+
+    thread_local hipblas_thread_handles thread_handles;
+
+    auto it = thread_handles.handles.find(deviceId);
+    if(it != thread_handles.handles.end())
+    {
+        *handle = it->second;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int device_count;
+    if(hipGetDeviceCount(&device_count) != hipSuccess)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(deviceId < 0 || deviceId >= device_count)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasHandle_t h;
+    hipblasStatus_t status = hipblas_handle_pool_create_handle(deviceId, &h);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    thread_handles.handles.emplace(deviceId, h);
+    *handle = h;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
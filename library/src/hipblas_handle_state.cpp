@@ -0,0 +1,601 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas_handle_state.hpp"
+#include "hipblas_statistics.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace
+{
+    std::mutex& handle_state_mutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    // Handle states are heap allocated so pointers stay valid while other handles are added
+    std::unordered_map<hipblasHandle_t, std::unique_ptr<hipblasHandleState>>& handle_state_map()
+    {
+        static std::unordered_map<hipblasHandle_t, std::unique_ptr<hipblasHandleState>> map;
+        return map;
+    }
+
+    // Replaces the memory of scratch by size bytes for use on stream, allocated from pool with
+    // hipMallocFromPoolAsync, or with hipMalloc if pool is nullptr. Returns false, with scratch
+    // empty, if they can't be allocated.
+    bool alloc_scratch(hipblasScratch& scratch, size_t size, hipStream_t stream, hipMemPool_t pool)
+    {
+        hipblasFreeScratch(scratch);
+
+        hipError_t status = pool ? hipMallocFromPoolAsync(&scratch.data, size, pool, stream)
+                                 : hipMalloc(&scratch.data, size);
+        if(status != hipSuccess)
+        {
+            scratch.data = nullptr;
+            return false;
+        }
+        scratch.size   = size;
+        scratch.stream = stream;
+        scratch.pool   = pool;
+        return true;
+    }
+
+    // number of handles in HIPBLAS_GRAPH_CAPTURE_SAFE, HIPBLAS_INFO_MODE_DEVICE,
+    // HIPBLAS_GEMM_3M_MATH, HIPBLAS_POINTER_MODE_PINNED_HOST, HIPBLAS_REPRODUCIBILITY_BITWISE,
+    // HIPBLAS_HOST_DISPATCH_SMALL, HIPBLAS_MANAGED_PREFETCH_DEVICE,
+    // HIPBLAS_BATCH_LAYOUT_INTERLEAVED and HIPBLAS_SHAPE_DISPATCH_ALLOWED mode, in a rounding
+    // mode other than HIPBLAS_ROUND_NEAREST_EVEN or a statistics mode, between hipblasBeginBatch
+    // and hipblasEndBatch or hipblasPersistentStart and hipblasPersistentStop, and with a compute
+    // partition or a priority stream
+    std::atomic<int> g_graph_capture_safe_handles{0};
+    std::atomic<int> g_device_info_handles{0};
+    std::atomic<int> g_deferring_handles{0};
+    std::atomic<int> g_persistent_handles{0};
+    std::atomic<int> g_gemm_3m_handles{0};
+    std::atomic<int> g_pinned_host_handles{0};
+    std::atomic<int> g_reproducible_handles{0};
+    std::atomic<int> g_partitioned_handles{0};
+    std::atomic<int> g_host_dispatch_handles{0};
+    std::atomic<int> g_managed_prefetch_handles{0};
+    std::atomic<int> g_rounding_handles{0};
+    std::atomic<int> g_statistics_handles{0};
+    std::atomic<int> g_interleaved_handles{0};
+    std::atomic<int> g_shape_dispatch_handles{0};
+
+    // number of handles in another gemm backend than hipblasDefaultGemmBackend
+    std::atomic<int> g_gemm_backend_handles{0};
+
+    // Sets a mode member of the state of handle, keeping count of the handles not in the
+    // default mode so that queries on the default path don't need to look up the handle.
+    template <typename Mode>
+    void set_handle_mode(hipblasHandle_t handle,
+                         Mode hipblasHandleState::*member,
+                         Mode                      mode,
+                         Mode                      default_mode,
+                         std::atomic<int>&         count)
+    {
+        hipblasHandleState* state = hipblasGetHandleState(handle);
+
+        std::lock_guard<std::mutex> lock(handle_state_mutex());
+        if(state->*member == mode)
+            return;
+        if(state->*member == default_mode)
+            count++;
+        else if(mode == default_mode)
+            count--;
+        state->*member = mode;
+    }
+
+    // read(state) for the state of handle, under the lock so that it doesn't race with a set on
+    // another thread, or default_value for a handle without a state, which no query adds
+    template <typename T, typename Read>
+    T read_handle_state(hipblasHandle_t handle, T default_value, Read read)
+    {
+        std::lock_guard<std::mutex> lock(handle_state_mutex());
+
+        auto it = handle_state_map().find(handle);
+        return it == handle_state_map().end() ? default_value : read(*it->second);
+    }
+
+    // A mode member of the state of handle, or default_mode for a handle that never set one
+    template <typename Mode>
+    Mode get_handle_mode(hipblasHandle_t           handle,
+                         Mode hipblasHandleState::*member,
+                         Mode                      default_mode)
+    {
+        return read_handle_state(handle, default_mode, [member](const hipblasHandleState& state) {
+            return state.*member;
+        });
+    }
+
+    // The memory of scratch, a member of the state of a handle with the workspace pool pool, as
+    // hipblasGetScratch returns it
+    void* get_scratch(hipblasScratch& scratch, hipMemPool_t pool, size_t size, hipStream_t stream)
+    {
+        bool realloc = !scratch.data || scratch.size < size || scratch.pool != pool;
+        if(scratch.data && scratch.stream != stream)
+        {
+            if(pool)
+                realloc = true;
+            else if(hipStreamSynchronize(scratch.stream) != hipSuccess)
+                return nullptr;
+        }
+
+        if(realloc)
+        {
+            // stream ordered memory can't be freed or allocated for later use in a graph capture
+            hipStreamCaptureStatus capture = hipStreamCaptureStatusNone;
+            if((pool || scratch.pool)
+               && (hipStreamIsCapturing(stream, &capture) != hipSuccess
+                   || capture != hipStreamCaptureStatusNone))
+                return nullptr;
+            if(!alloc_scratch(scratch, std::max(size, scratch.size), stream, pool))
+                return nullptr;
+            hipblasStatisticsWorkspaceAllocation(scratch.size);
+        }
+        scratch.stream = stream;
+        return scratch.data;
+    }
+}
+
+hipblasStreamPool::~hipblasStreamPool()
+{
+    for(hipStream_t stream : streams)
+        (void)hipStreamDestroy(stream);
+    for(hipEvent_t event : joins)
+        (void)hipEventDestroy(event);
+    if(fork)
+        (void)hipEventDestroy(fork);
+}
+
+hipblasPartitionStream::~hipblasPartitionStream()
+{
+    if(stream)
+        (void)hipStreamDestroy(stream);
+}
+
+hipblasDeferredGemms::~hipblasDeferredGemms()
+{
+    if(device_pointers)
+        (void)hipFree(device_pointers);
+}
+
+hipblasRegions::~hipblasRegions()
+{
+    for(auto& graph : graphs)
+        (void)hipGraphExecDestroy(graph.second);
+}
+
+hipblasStatisticsCounters::~hipblasStatisticsCounters()
+{
+    for(pending_call& call : pending)
+    {
+        (void)hipEventDestroy(call.start);
+        (void)hipEventDestroy(call.stop);
+    }
+    for(hipEvent_t event : free_events)
+        (void)hipEventDestroy(event);
+}
+
+hipblasScratch::~hipblasScratch()
+{
+    if(data)
+        (void)hipFree(data);
+}
+
+hipblasHandleState* hipblasGetHandleState(hipblasHandle_t handle)
+{
+    std::lock_guard<std::mutex> lock(handle_state_mutex());
+
+    auto& state = handle_state_map()[handle];
+    if(!state)
+        state = std::make_unique<hipblasHandleState>();
+    return state.get();
+}
+
+void hipblasDestroyHandleState(hipblasHandle_t handle)
+{
+    std::lock_guard<std::mutex> lock(handle_state_mutex());
+
+    auto it = handle_state_map().find(handle);
+    if(it == handle_state_map().end())
+        return;
+    if(it->second->graph_capture_mode != HIPBLAS_GRAPH_CAPTURE_DEFAULT)
+        g_graph_capture_safe_handles--;
+    if(it->second->info_mode != HIPBLAS_INFO_MODE_HOST)
+        g_device_info_handles--;
+    if(it->second->deferring)
+        g_deferring_handles--;
+    if(it->second->persistent)
+        g_persistent_handles--;
+    if(it->second->gemm_3m)
+        g_gemm_3m_handles--;
+    if(it->second->pinned_host_results)
+        g_pinned_host_handles--;
+    if(it->second->reproducibility_mode != HIPBLAS_REPRODUCIBILITY_DEFAULT)
+        g_reproducible_handles--;
+    if(it->second->partition.stream)
+        g_partitioned_handles--;
+    if(it->second->host_dispatch_mode != HIPBLAS_HOST_DISPATCH_NONE)
+        g_host_dispatch_handles--;
+    if(it->second->managed_prefetch_mode != HIPBLAS_MANAGED_PREFETCH_NONE)
+        g_managed_prefetch_handles--;
+    if(it->second->rounding_mode != HIPBLAS_ROUND_NEAREST_EVEN)
+        g_rounding_handles--;
+    if(it->second->statistics_mode != HIPBLAS_STATISTICS_NONE)
+        g_statistics_handles--;
+    if(it->second->gemm_backend != hipblasDefaultGemmBackend())
+        g_gemm_backend_handles--;
+    if(it->second->batch_layout != HIPBLAS_BATCH_LAYOUT_STRIDED)
+        g_interleaved_handles--;
+    if(it->second->shape_dispatch_mode != HIPBLAS_SHAPE_DISPATCH_NONE)
+        g_shape_dispatch_handles--;
+    handle_state_map().erase(it);
+}
+
+void* hipblasGetScratch(hipblasHandle_t handle, size_t size, hipStream_t stream)
+{
+    hipblasHandleState* state = hipblasGetHandleState(handle);
+    return get_scratch(state->scratch, state->workspace_pool, size, stream);
+}
+
+void* hipblasGetRoundingScratch(hipblasHandle_t handle, size_t size, hipStream_t stream)
+{
+    hipblasHandleState* state = hipblasGetHandleState(handle);
+    return get_scratch(state->rounding_scratch, state->workspace_pool, size, stream);
+}
+
+void hipblasFreeScratch(hipblasScratch& scratch)
+{
+    if(scratch.data)
+    {
+        if(scratch.pool)
+            (void)hipFreeAsync(scratch.data, scratch.stream);
+        else
+            (void)hipFree(scratch.data);
+    }
+    scratch.data = nullptr;
+    scratch.size = 0;
+    scratch.pool = nullptr;
+}
+
+void hipblasSetHandleGraphCaptureMode(hipblasHandle_t handle, hipblasGraphCaptureMode_t mode)
+{
+    set_handle_mode(handle,
+                    &hipblasHandleState::graph_capture_mode,
+                    mode,
+                    HIPBLAS_GRAPH_CAPTURE_DEFAULT,
+                    g_graph_capture_safe_handles);
+}
+
+bool hipblasIsGraphCaptureSafe(hipblasHandle_t handle)
+{
+    if(g_graph_capture_safe_handles.load(std::memory_order_relaxed) == 0)
+        return false;
+    return get_handle_mode(
+               handle, &hipblasHandleState::graph_capture_mode, HIPBLAS_GRAPH_CAPTURE_DEFAULT)
+           == HIPBLAS_GRAPH_CAPTURE_SAFE;
+}
+
+void hipblasSetHandleInfoMode(hipblasHandle_t handle, hipblasInfoMode_t mode)
+{
+    set_handle_mode(handle,
+                    &hipblasHandleState::info_mode,
+                    mode,
+                    HIPBLAS_INFO_MODE_HOST,
+                    g_device_info_handles);
+}
+
+bool hipblasIsDeviceInfoMode(hipblasHandle_t handle)
+{
+    if(g_device_info_handles.load(std::memory_order_relaxed) == 0)
+        return false;
+    return get_handle_mode(handle, &hipblasHandleState::info_mode, HIPBLAS_INFO_MODE_HOST)
+           == HIPBLAS_INFO_MODE_DEVICE;
+}
+
+void hipblasSetHandlePartitionStream(hipblasHandle_t   handle,
+                                     hipStream_t       stream,
+                                     hipStream_t       replaced,
+                                     hipblasPriority_t priority)
+{
+    hipblasHandleState* state = hipblasGetHandleState(handle);
+
+    std::unique_lock<std::mutex> lock(handle_state_mutex());
+    hipStream_t                  previous = state->partition.stream;
+    if(!previous && stream)
+        g_partitioned_handles++;
+    else if(previous && !stream)
+        g_partitioned_handles--;
+    state->partition.stream   = stream;
+    state->partition.replaced = stream ? replaced : nullptr;
+    state->partition.priority = stream ? priority : HIPBLAS_PRIORITY_DEFAULT;
+    lock.unlock();
+
+    // the work already queued on the previous stream still runs after it is destroyed
+    if(previous)
+        (void)hipStreamDestroy(previous);
+}
+
+bool hipblasHasComputePartition(hipblasHandle_t handle)
+{
+    if(!handle || g_partitioned_handles.load(std::memory_order_relaxed) == 0)
+        return false;
+    return read_handle_state(handle, false, [](const hipblasHandleState& state) {
+        return state.partition.stream != nullptr;
+    });
+}
+
+void hipblasSetHandleDeferring(hipblasHandle_t handle, bool deferring)
+{
+    set_handle_mode(
+        handle, &hipblasHandleState::deferring, deferring, false, g_deferring_handles);
+}
+
+bool hipblasIsDeferring(hipblasHandle_t handle)
+{
+    if(!handle || g_deferring_handles.load(std::memory_order_relaxed) == 0)
+        return false;
+    return get_handle_mode(handle, &hipblasHandleState::deferring, false);
+}
+
+void hipblasSetHandlePersistent(hipblasHandle_t handle, bool persistent)
+{
+    set_handle_mode(
+        handle, &hipblasHandleState::persistent, persistent, false, g_persistent_handles);
+}
+
+bool hipblasIsPersistent(hipblasHandle_t handle)
+{
+    if(!handle || g_persistent_handles.load(std::memory_order_relaxed) == 0)
+        return false;
+    return get_handle_mode(handle, &hipblasHandleState::persistent, false);
+}
+
+void hipblasSetHandleGemm3m(hipblasHandle_t handle, bool gemm_3m)
+{
+    set_handle_mode(handle, &hipblasHandleState::gemm_3m, gemm_3m, false, g_gemm_3m_handles);
+}
+
+bool hipblasIsGemm3m(hipblasHandle_t handle)
+{
+    if(!handle || g_gemm_3m_handles.load(std::memory_order_relaxed) == 0)
+        return false;
+    return get_handle_mode(handle, &hipblasHandleState::gemm_3m, false);
+}
+
+void hipblasSetHandlePinnedHostResults(hipblasHandle_t handle, bool pinned_host_results)
+{
+    set_handle_mode(handle,
+                    &hipblasHandleState::pinned_host_results,
+                    pinned_host_results,
+                    false,
+                    g_pinned_host_handles);
+}
+
+bool hipblasIsPinnedHostResults(hipblasHandle_t handle)
+{
+    if(!handle || g_pinned_host_handles.load(std::memory_order_relaxed) == 0)
+        return false;
+    return get_handle_mode(handle, &hipblasHandleState::pinned_host_results, false);
+}
+
+hipblasPinnedHostResultScope::hipblasPinnedHostResultScope(hipblasHandle_t handle)
+{
+    hipblasStatisticsHostSync(handle);
+    if(hipblasIsPinnedHostResults(handle)
+       && hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE) == HIPBLAS_STATUS_SUCCESS)
+        this->handle = handle;
+}
+
+hipblasPinnedHostResultScope::~hipblasPinnedHostResultScope()
+{
+    if(handle)
+        (void)hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_PINNED_HOST);
+}
+
+void hipblasSetHandleReproducibilityMode(hipblasHandle_t handle, hipblasReproducibilityMode_t mode)
+{
+    set_handle_mode(handle,
+                    &hipblasHandleState::reproducibility_mode,
+                    mode,
+                    HIPBLAS_REPRODUCIBILITY_DEFAULT,
+                    g_reproducible_handles);
+}
+
+bool hipblasIsReproducible(hipblasHandle_t handle)
+{
+    if(!handle || g_reproducible_handles.load(std::memory_order_relaxed) == 0)
+        return false;
+    return get_handle_mode(handle,
+                           &hipblasHandleState::reproducibility_mode,
+                           HIPBLAS_REPRODUCIBILITY_DEFAULT)
+           == HIPBLAS_REPRODUCIBILITY_BITWISE;
+}
+
+void hipblasSetHandleHostDispatchMode(hipblasHandle_t handle, hipblasHostDispatchMode_t mode)
+{
+    set_handle_mode(handle,
+                    &hipblasHandleState::host_dispatch_mode,
+                    mode,
+                    HIPBLAS_HOST_DISPATCH_NONE,
+                    g_host_dispatch_handles);
+}
+
+bool hipblasIsHostDispatch(hipblasHandle_t               handle,
+                           hipblasHostDispatchFunction_t function,
+                           int64_t                       size)
+{
+    if(!handle || g_host_dispatch_handles.load(std::memory_order_relaxed) == 0)
+        return false;
+    return read_handle_state(handle, false, [=](const hipblasHandleState& state) {
+        return state.host_dispatch_mode == HIPBLAS_HOST_DISPATCH_SMALL
+               && size < state.host_dispatch_thresholds[function];
+    });
+}
+
+hipblasGemmBackend_t hipblasDefaultGemmBackend()
+{
+    static const hipblasGemmBackend_t backend = [] {
+        const char* env = getenv("HIPBLAS_GEMM_BACKEND");
+        return env && !strcmp(env, "lt") ? HIPBLAS_GEMM_BACKEND_LT : HIPBLAS_GEMM_BACKEND_DEFAULT;
+    }();
+    return backend;
+}
+
+void hipblasSetHandleGemmBackend(hipblasHandle_t handle, hipblasGemmBackend_t backend)
+{
+    set_handle_mode(handle,
+                    &hipblasHandleState::gemm_backend,
+                    backend,
+                    hipblasDefaultGemmBackend(),
+                    g_gemm_backend_handles);
+}
+
+bool hipblasIsGemmBackendLt(hipblasHandle_t handle)
+{
+    if(!handle
+       || (g_gemm_backend_handles.load(std::memory_order_relaxed) == 0
+           && hipblasDefaultGemmBackend() == HIPBLAS_GEMM_BACKEND_DEFAULT))
+        return false;
+    return get_handle_mode(
+               handle, &hipblasHandleState::gemm_backend, hipblasDefaultGemmBackend())
+           == HIPBLAS_GEMM_BACKEND_LT;
+}
+
+void hipblasSetHandleBatchLayout(hipblasHandle_t handle, hipblasBatchLayout_t layout)
+{
+    set_handle_mode(handle,
+                    &hipblasHandleState::batch_layout,
+                    layout,
+                    HIPBLAS_BATCH_LAYOUT_STRIDED,
+                    g_interleaved_handles);
+}
+
+bool hipblasIsInterleavedBatch(hipblasHandle_t handle)
+{
+    if(!handle || g_interleaved_handles.load(std::memory_order_relaxed) == 0)
+        return false;
+    return get_handle_mode(
+               handle, &hipblasHandleState::batch_layout, HIPBLAS_BATCH_LAYOUT_STRIDED)
+           == HIPBLAS_BATCH_LAYOUT_INTERLEAVED;
+}
+
+void hipblasSetHandleShapeDispatchMode(hipblasHandle_t handle, hipblasShapeDispatchMode_t mode)
+{
+    set_handle_mode(handle,
+                    &hipblasHandleState::shape_dispatch_mode,
+                    mode,
+                    HIPBLAS_SHAPE_DISPATCH_NONE,
+                    g_shape_dispatch_handles);
+}
+
+bool hipblasIsShapeDispatch(hipblasHandle_t handle)
+{
+    if(!handle || g_shape_dispatch_handles.load(std::memory_order_relaxed) == 0)
+        return false;
+    return get_handle_mode(
+               handle, &hipblasHandleState::shape_dispatch_mode, HIPBLAS_SHAPE_DISPATCH_NONE)
+           == HIPBLAS_SHAPE_DISPATCH_ALLOWED;
+}
+
+void hipblasSetHandleManagedPrefetchMode(hipblasHandle_t              handle,
+                                         hipblasManagedPrefetchMode_t mode)
+{
+    set_handle_mode(handle,
+                    &hipblasHandleState::managed_prefetch_mode,
+                    mode,
+                    HIPBLAS_MANAGED_PREFETCH_NONE,
+                    g_managed_prefetch_handles);
+
+    hipblasHandleState*         state = hipblasGetHandleState(handle);
+    std::lock_guard<std::mutex> lock(handle_state_mutex());
+    state->managed_prefetched.clear();
+}
+
+bool hipblasIsManagedPrefetch(hipblasHandle_t handle)
+{
+    if(!handle || g_managed_prefetch_handles.load(std::memory_order_relaxed) == 0)
+        return false;
+    return get_handle_mode(handle,
+                           &hipblasHandleState::managed_prefetch_mode,
+                           HIPBLAS_MANAGED_PREFETCH_NONE)
+           == HIPBLAS_MANAGED_PREFETCH_DEVICE;
+}
+
+void hipblasSetHandleRoundingMode(hipblasHandle_t       handle,
+                                  hipblasRoundingMode_t mode,
+                                  uint64_t              seed)
+{
+    set_handle_mode(handle,
+                    &hipblasHandleState::rounding_mode,
+                    mode,
+                    HIPBLAS_ROUND_NEAREST_EVEN,
+                    g_rounding_handles);
+
+    hipblasHandleState*         state = hipblasGetHandleState(handle);
+    std::lock_guard<std::mutex> lock(handle_state_mutex());
+    state->rounding_seed  = seed;
+    state->rounding_calls = 0;
+}
+
+hipblasRoundingMode_t hipblasGetHandleRoundingMode(hipblasHandle_t handle)
+{
+    if(!handle || g_rounding_handles.load(std::memory_order_relaxed) == 0)
+        return HIPBLAS_ROUND_NEAREST_EVEN;
+    return get_handle_mode(handle, &hipblasHandleState::rounding_mode, HIPBLAS_ROUND_NEAREST_EVEN);
+}
+
+uint64_t hipblasNextStochasticSeed(hipblasHandle_t handle)
+{
+    hipblasHandleState*         state = hipblasGetHandleState(handle);
+    std::lock_guard<std::mutex> lock(handle_state_mutex());
+
+    // the finalizer of splitmix64, so that the seeds of consecutive calls share no structure
+    // with the indices of the elements the kernels hash them with
+    uint64_t z = state->rounding_seed + ++state->rounding_calls * 0x9e3779b97f4a7c15ull;
+    z          = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z          = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+void hipblasSetHandleStatisticsMode(hipblasHandle_t handle, hipblasStatisticsMode_t mode)
+{
+    set_handle_mode(handle,
+                    &hipblasHandleState::statistics_mode,
+                    mode,
+                    HIPBLAS_STATISTICS_NONE,
+                    g_statistics_handles);
+}
+
+hipblasStatisticsMode_t hipblasGetHandleStatisticsMode(hipblasHandle_t handle)
+{
+    if(!handle || g_statistics_handles.load(std::memory_order_relaxed) == 0)
+        return HIPBLAS_STATISTICS_NONE;
+    return get_handle_mode(handle, &hipblasHandleState::statistics_mode, HIPBLAS_STATISTICS_NONE);
+}
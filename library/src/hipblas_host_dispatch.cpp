@@ -0,0 +1,355 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_runtime_api.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+
+#include "exceptions.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_host_dispatch.hpp"
+
+// The functions of hipblas_host_dispatch.hpp. Problems below the thresholds are small enough
+// that plain loops over the elements, in the order of the reference BLAS, finish before a
+// kernel would be launched, so there is no blocking or threading here.
+
+namespace
+{
+    // True if p is in host memory, pageable or pinned, and not managed memory the device may
+    // hold
+    bool hipblas_is_host_memory(const void* p)
+    {
+        hipPointerAttribute_t attr;
+        if(hipPointerGetAttributes(&attr, p) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            return true;
+        }
+        return attr.type == hipMemoryTypeUnregistered || attr.type == hipMemoryTypeHost;
+    }
+
+    // Checks that the call can be computed on the host: size is below the threshold of
+    // function, handle is in host pointer mode and the matrices and vectors are in host memory.
+    // Then waits for the stream of handle, as the work queued on it may still read or write
+    // them. Returns HIPBLAS_STATUS_NOT_SUPPORTED for calls left to the backend.
+    hipblasStatus_t hipblas_host_dispatch_begin(hipblasHandle_t                    handle,
+                                                hipblasHostDispatchFunction_t      function,
+                                                int64_t                            size,
+                                                std::initializer_list<const void*> data)
+    {
+        if(!hipblasIsHostDispatch(handle, function, size))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        hipblasPointerMode_t mode;
+        if(hipblasGetPointerMode(handle, &mode) != HIPBLAS_STATUS_SUCCESS
+           || mode != HIPBLAS_POINTER_MODE_HOST
+           || !std::all_of(data.begin(), data.end(), hipblas_is_host_memory))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(hipStreamSynchronize(stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Calls f with a null pointer of the host type of dataType
+    template <typename F>
+    hipblasStatus_t hipblas_host_dispatch_type(hipDataType dataType, F&& f)
+    {
+        switch(dataType)
+        {
+        case HIP_R_32F:
+            return f(static_cast<float*>(nullptr));
+        case HIP_R_64F:
+            return f(static_cast<double*>(nullptr));
+        case HIP_C_32F:
+            return f(static_cast<std::complex<float>*>(nullptr));
+        case HIP_C_64F:
+            return f(static_cast<std::complex<double>*>(nullptr));
+        default:
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    template <typename T>
+    T hipblas_host_conj(T x)
+    {
+        return x;
+    }
+
+    template <typename T>
+    std::complex<T> hipblas_host_conj(std::complex<T> x)
+    {
+        return std::conj(x);
+    }
+
+    // offset of element i of a vector of n elements with increment inc, which starts from
+    // the end of the vector when inc is negative
+    inline int64_t hipblas_host_index(int64_t i, int64_t n, int64_t inc)
+    {
+        return (inc >= 0 ? i : i + 1 - n) * inc;
+    }
+
+    bool hipblas_host_valid_trans(hipblasOperation_t trans)
+    {
+        return trans == HIPBLAS_OP_N || trans == HIPBLAS_OP_T || trans == HIPBLAS_OP_C;
+    }
+}
+
+hipblasStatus_t hipblasHostAxpy(hipblasHandle_t handle,
+                                int             n,
+                                const void*     alpha,
+                                const void*     x,
+                                int             incx,
+                                void*           y,
+                                int             incy,
+                                hipDataType     dataType)
+try
+{
+    if(n <= 0 || !alpha || !x || !y)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return hipblas_host_dispatch_type(dataType, [&](auto* type) {
+        using T = std::remove_pointer_t<decltype(type)>;
+
+        hipblasStatus_t status
+            = hipblas_host_dispatch_begin(handle, HIPBLAS_HOST_DISPATCH_AXPY, n, {x, y});
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        T        a  = *static_cast<const T*>(alpha);
+        const T* xs = static_cast<const T*>(x);
+        T*       ys = static_cast<T*>(y);
+        if(a == T(0))
+            return HIPBLAS_STATUS_SUCCESS;
+        for(int64_t i = 0; i < n; i++)
+            ys[hipblas_host_index(i, n, incy)] += a * xs[hipblas_host_index(i, n, incx)];
+        return HIPBLAS_STATUS_SUCCESS;
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasHostScal(
+    hipblasHandle_t handle, int n, const void* alpha, void* x, int incx, hipDataType dataType)
+try
+{
+    if(n <= 0 || incx <= 0 || !alpha || !x)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return hipblas_host_dispatch_type(dataType, [&](auto* type) {
+        using T = std::remove_pointer_t<decltype(type)>;
+
+        hipblasStatus_t status
+            = hipblas_host_dispatch_begin(handle, HIPBLAS_HOST_DISPATCH_SCAL, n, {x});
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        T  a  = *static_cast<const T*>(alpha);
+        T* xs = static_cast<T*>(x);
+        for(int64_t i = 0; i < n; i++)
+            xs[i * incx] *= a;
+        return HIPBLAS_STATUS_SUCCESS;
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasHostDot(hipblasHandle_t handle,
+                               int             n,
+                               const void*     x,
+                               int             incx,
+                               const void*     y,
+                               int             incy,
+                               void*           result,
+                               hipDataType     dataType,
+                               bool            conj)
+try
+{
+    if(n <= 0 || !x || !y || !result)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return hipblas_host_dispatch_type(dataType, [&](auto* type) {
+        using T = std::remove_pointer_t<decltype(type)>;
+
+        hipblasStatus_t status
+            = hipblas_host_dispatch_begin(handle, HIPBLAS_HOST_DISPATCH_DOT, n, {x, y, result});
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        const T* xs  = static_cast<const T*>(x);
+        const T* ys  = static_cast<const T*>(y);
+        T        sum = T(0);
+        for(int64_t i = 0; i < n; i++)
+        {
+            T xi = xs[hipblas_host_index(i, n, incx)];
+            sum += (conj ? hipblas_host_conj(xi) : xi) * ys[hipblas_host_index(i, n, incy)];
+        }
+        *static_cast<T*>(result) = sum;
+        return HIPBLAS_STATUS_SUCCESS;
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasHostGemv(hipblasHandle_t    handle,
+                                hipblasOperation_t trans,
+                                int                m,
+                                int                n,
+                                const void*        alpha,
+                                const void*        A,
+                                int                lda,
+                                const void*        x,
+                                int                incx,
+                                const void*        beta,
+                                void*              y,
+                                int                incy,
+                                hipDataType        dataType)
+try
+{
+    if(!hipblas_host_valid_trans(trans) || m <= 0 || n <= 0 || lda < m || !incx || !incy
+       || !alpha || !beta || !A || !x || !y)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return hipblas_host_dispatch_type(dataType, [&](auto* type) {
+        using T = std::remove_pointer_t<decltype(type)>;
+
+        hipblasStatus_t status = hipblas_host_dispatch_begin(
+            handle, HIPBLAS_HOST_DISPATCH_GEMV, int64_t(m) * n, {A, x, y});
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        T        a    = *static_cast<const T*>(alpha);
+        T        b    = *static_cast<const T*>(beta);
+        const T* As   = static_cast<const T*>(A);
+        const T* xs   = static_cast<const T*>(x);
+        T*       ys   = static_cast<T*>(y);
+        int64_t  rows = trans == HIPBLAS_OP_N ? m : n;
+        int64_t  cols = trans == HIPBLAS_OP_N ? n : m;
+
+        // y_i := alpha * sum_j op(A)_ij x_j + beta * y_i, without reading y when beta is 0
+        for(int64_t i = 0; i < rows; i++)
+        {
+            T sum = T(0);
+            for(int64_t j = 0; j < cols; j++)
+            {
+                T aij = trans == HIPBLAS_OP_N ? As[i + j * lda] : As[j + i * lda];
+                if(trans == HIPBLAS_OP_C)
+                    aij = hipblas_host_conj(aij);
+                sum += aij * xs[hipblas_host_index(j, cols, incx)];
+            }
+            T& yi = ys[hipblas_host_index(i, rows, incy)];
+            yi    = b == T(0) ? a * sum : a * sum + b * yi;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasHostGemm(hipblasHandle_t    handle,
+                                hipblasOperation_t transA,
+                                hipblasOperation_t transB,
+                                int                m,
+                                int                n,
+                                int                k,
+                                const void*        alpha,
+                                const void*        A,
+                                int                lda,
+                                const void*        B,
+                                int                ldb,
+                                const void*        beta,
+                                void*              C,
+                                int                ldc,
+                                hipDataType        dataType)
+try
+{
+    int64_t rows_a = transA == HIPBLAS_OP_N ? m : k;
+    int64_t rows_b = transB == HIPBLAS_OP_N ? k : n;
+    if(!hipblas_host_valid_trans(transA) || !hipblas_host_valid_trans(transB) || m <= 0 || n <= 0
+       || k < 0 || lda < std::max<int64_t>(rows_a, 1) || ldb < std::max<int64_t>(rows_b, 1)
+       || ldc < m || !alpha || !beta || !A || !B || !C)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // m * n * k, saturated
+    int64_t mn   = int64_t(m) * n;
+    int64_t size = k && mn > INT64_MAX / k ? INT64_MAX : mn * k;
+
+    return hipblas_host_dispatch_type(dataType, [&](auto* type) {
+        using T = std::remove_pointer_t<decltype(type)>;
+
+        hipblasStatus_t status
+            = hipblas_host_dispatch_begin(handle, HIPBLAS_HOST_DISPATCH_GEMM, size, {A, B, C});
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        T        a  = *static_cast<const T*>(alpha);
+        T        b  = *static_cast<const T*>(beta);
+        const T* As = static_cast<const T*>(A);
+        const T* Bs = static_cast<const T*>(B);
+        T*       Cs = static_cast<T*>(C);
+
+        auto op_a = [&](int64_t i, int64_t l) {
+            T ail = transA == HIPBLAS_OP_N ? As[i + l * lda] : As[l + i * lda];
+            return transA == HIPBLAS_OP_C ? hipblas_host_conj(ail) : ail;
+        };
+        auto op_b = [&](int64_t l, int64_t j) {
+            T blj = transB == HIPBLAS_OP_N ? Bs[l + j * ldb] : Bs[j + l * ldb];
+            return transB == HIPBLAS_OP_C ? hipblas_host_conj(blj) : blj;
+        };
+
+        // C_ij := alpha * sum_l op(A)_il op(B)_lj + beta * C_ij, without reading C when beta
+        // is 0
+        for(int64_t j = 0; j < n; j++)
+        {
+            for(int64_t i = 0; i < m; i++)
+            {
+                T sum = T(0);
+                for(int64_t l = 0; l < k; l++)
+                    sum += op_a(i, l) * op_b(l, j);
+                T& cij = Cs[i + j * ldc];
+                cij    = b == T(0) ? a * sum : a * sum + b * cij;
+            }
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
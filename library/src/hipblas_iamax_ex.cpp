@@ -0,0 +1,413 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <type_traits>
+
+#include "exceptions.hpp"
+#include "hipblas_device_reduce.hpp"
+#include "hipblas_entry.hpp"
+
+// hipblasIamaxExWithValue and hipblasIaminExWithValue and their batched forms: the index of
+// iamax or iamin together with the element found there, for pivot searches that would otherwise
+// gather the element in a launch of their own. The element is read once by the block that merges
+// the partials of the blocks, so the cost is that of iamax. The partials are merged in a fixed
+// order, as in hipblas_device_reduce.hpp, and the same kernels serve both backends.
+
+namespace
+{
+    // The vector b of x, from an array of pointers or at a stride from the first one
+    template <typename T>
+    __device__ inline const T*
+        hipblas_iamax_ex_vector(const void* x, hipblasStride stridex, bool batched, int b)
+    {
+        if(batched)
+            return static_cast<const T* const*>(x)[b];
+        return static_cast<const T*>(x) + b * stridex;
+    }
+
+    // The element x in the type V of the values, which is its own or float for half and bfloat16
+    template <typename V, typename T>
+    __device__ inline V hipblas_iamax_ex_value(T x)
+    {
+        if constexpr(std::is_same_v<T, V>)
+            return x;
+        else
+            return hipblas_device_load(x);
+    }
+
+    // partial[b * gridDim.x + blockIdx.x] := the partial of iamax, or of iamin when MIN, over the
+    // elements of the block of vector b
+    template <typename T, typename TR, bool MIN>
+    __global__ void hipblasIamaxExWithValueKernel(int                        n,
+                                                  const void*                x,
+                                                  int                        incx,
+                                                  hipblasStride              stridex,
+                                                  bool                       batched,
+                                                  hipblas_iamax_partial<TR>* partial,
+                                                  int                        batch_count)
+    {
+        __shared__ hipblas_iamax_partial<TR> ps[hipblas_blas1_threads];
+
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            const T* xb = hipblas_iamax_ex_vector<T>(x, stridex, batched, b);
+
+            // each thread visits its elements in increasing order, so only a strictly better
+            // value replaces the one it has
+            hipblas_iamax_partial<TR> p{0, -1};
+            for(int i = blockIdx.x * blockDim.x + threadIdx.x; i < n; i += gridDim.x * blockDim.x)
+            {
+                TR v = hipblas_device_abs1(hipblas_device_load(xb[int64_t(i) * incx]));
+                if(p.index < 0 || hipblas_iamax_better<MIN>(v, p.value))
+                    p = {v, i};
+            }
+
+            p = hipblas_iamax_block_merge<TR, MIN>(p, ps);
+            if(!threadIdx.x)
+                partial[size_t(b) * gridDim.x + blockIdx.x] = p;
+        }
+    }
+
+    // result[b] := the 1-based index of the merge of the partials of the blocks of vector b, and
+    // value[b] := the element of vector b at that index
+    template <typename T, typename TR, typename V, bool MIN>
+    __global__ void hipblasIamaxExWithValueResultKernel(int                              blocks,
+                                                        const hipblas_iamax_partial<TR>* partial,
+                                                        const void*                      x,
+                                                        int                              incx,
+                                                        hipblasStride                    stridex,
+                                                        bool                             batched,
+                                                        int*                             result,
+                                                        V*                               value,
+                                                        int batch_count)
+    {
+        __shared__ hipblas_iamax_partial<TR> ps[hipblas_blas1_threads];
+
+        for(int b = blockIdx.x; b < batch_count; b += gridDim.x)
+        {
+            hipblas_iamax_partial<TR> p{0, -1};
+            for(int i = threadIdx.x; i < blocks; i += blockDim.x)
+                hipblas_iamax_merge<TR, MIN>(p, partial[size_t(b) * blocks + i]);
+
+            p = hipblas_iamax_block_merge<TR, MIN>(p, ps);
+            if(!threadIdx.x)
+            {
+                const T* xb = hipblas_iamax_ex_vector<T>(x, stridex, batched, b);
+                result[b]   = p.index + 1;
+                value[b]    = hipblas_iamax_ex_value<V>(xb[int64_t(p.index) * incx]);
+            }
+        }
+    }
+
+    template <typename T, typename TR, typename V, bool MIN>
+    hipError_t hipblas_iamax_ex_launch(int           n,
+                                       const void*   x,
+                                       int           incx,
+                                       hipblasStride stridex,
+                                       bool          batched,
+                                       void*         scratch,
+                                       int*          result,
+                                       void*         value,
+                                       int           batch_count,
+                                       hipStream_t   stream)
+    {
+        int  blocks = hipblas_blas1_grid(n);
+        dim3 grid(blocks, std::min(batch_count, 65535));
+        hipblasIamaxExWithValueKernel<T, TR, MIN><<<grid, hipblas_blas1_threads, 0, stream>>>(
+            n, x, incx, stridex, batched, (hipblas_iamax_partial<TR>*)scratch, batch_count);
+        hipblasIamaxExWithValueResultKernel<T, TR, V, MIN>
+            <<<std::min(batch_count, 65535), hipblas_blas1_threads, 0, stream>>>(
+                blocks,
+                (const hipblas_iamax_partial<TR>*)scratch,
+                x,
+                incx,
+                stridex,
+                batched,
+                result,
+                (V*)value,
+                batch_count);
+        return hipGetLastError();
+    }
+
+    // The kernels of one pair of the type of the vectors and the type of the values, with the
+    // sizes of the partials and of the values
+    struct hipblas_iamax_ex_kernels
+    {
+        decltype(&hipblas_iamax_ex_launch<float, float, float, false>) launch       = nullptr;
+        size_t                                                         partial_size = 0;
+        size_t                                                         value_size   = 0;
+    };
+
+    template <typename T, typename TR, typename V>
+    hipblas_iamax_ex_kernels hipblas_iamax_ex_kernels_of(bool min)
+    {
+        auto launch = min ? hipblas_iamax_ex_launch<T, TR, V, true>
+                          : hipblas_iamax_ex_launch<T, TR, V, false>;
+        return {launch, sizeof(hipblas_iamax_partial<TR>), sizeof(V)};
+    }
+
+    hipblas_iamax_ex_kernels
+        hipblas_iamax_ex_kernels_for(hipDataType x_type, hipDataType value_type, bool min)
+    {
+        switch(x_type)
+        {
+        case HIP_R_16F:
+            if(value_type == HIP_R_16F)
+                return hipblas_iamax_ex_kernels_of<__half, float, __half>(min);
+            if(value_type == HIP_R_32F)
+                return hipblas_iamax_ex_kernels_of<__half, float, float>(min);
+            break;
+        case HIP_R_16BF:
+            if(value_type == HIP_R_16BF)
+                return hipblas_iamax_ex_kernels_of<hipblas_device_bf16, float, hipblas_device_bf16>(
+                    min);
+            if(value_type == HIP_R_32F)
+                return hipblas_iamax_ex_kernels_of<hipblas_device_bf16, float, float>(min);
+            break;
+        case HIP_R_32F:
+            if(value_type == HIP_R_32F)
+                return hipblas_iamax_ex_kernels_of<float, float, float>(min);
+            break;
+        case HIP_R_64F:
+            if(value_type == HIP_R_64F)
+                return hipblas_iamax_ex_kernels_of<double, double, double>(min);
+            break;
+        case HIP_C_32F:
+            if(value_type == HIP_C_32F)
+                return hipblas_iamax_ex_kernels_of<hipFloatComplex, float, hipFloatComplex>(min);
+            break;
+        case HIP_C_64F:
+            if(value_type == HIP_C_64F)
+                return hipblas_iamax_ex_kernels_of<hipDoubleComplex, double, hipDoubleComplex>(
+                    min);
+            break;
+        default:
+            break;
+        }
+        return {};
+    }
+
+    // iamax, or iamin when min, of the batch_count vectors of x, an array of pointers when
+    // batched, with their indices in result and their elements at those indices in value
+    hipblasStatus_t hipblasIamaxExWithValueImpl(hipblasHandle_t handle,
+                                                int             n,
+                                                const void*     x,
+                                                hipDataType     xType,
+                                                int             incx,
+                                                hipblasStride   stridex,
+                                                bool            batched,
+                                                int*            result,
+                                                void*           value,
+                                                hipDataType     valueType,
+                                                int             batchCount,
+                                                bool            min)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(batchCount < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!batchCount)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!result || !value)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        auto kernels = hipblas_iamax_ex_kernels_for(xType, valueType, min);
+        if(!kernels.launch)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        hipStream_t          stream;
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblas_blas1_stream(handle, &stream, &mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // as for iamax, the indices are zero when n or incx isn't positive, and so are the values
+        bool host_result = mode == HIPBLAS_POINTER_MODE_HOST;
+        if(n <= 0 || incx <= 0)
+        {
+            status = hipblas_blas1_zero(host_result, result, batchCount, sizeof(int), stream);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            return hipblas_blas1_zero(host_result, value, batchCount, kernels.value_size, stream);
+        }
+        if(!x)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        // the partials, followed on the host by the indices and values copied back to it
+        size_t blocks        = hipblas_blas1_grid(n);
+        size_t partial_bytes = hipblas_scratch_pad(batchCount * blocks * kernels.partial_size);
+        size_t index_bytes   = hipblas_scratch_pad(batchCount * sizeof(int));
+        size_t value_bytes   = batchCount * kernels.value_size;
+        char* scratch = static_cast<char*>(hipblasGetScratch(
+            handle, partial_bytes + (host_result ? index_bytes + value_bytes : 0), stream));
+        if(!scratch)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+
+        int*  d_result = host_result ? (int*)(scratch + partial_bytes) : result;
+        void* d_value  = host_result ? scratch + partial_bytes + index_bytes : value;
+        if(kernels.launch(
+               n, x, incx, stridex, batched, scratch, d_result, d_value, batchCount, stream)
+           != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        if(host_result
+           && (hipMemcpyAsync(
+                   result, d_result, batchCount * sizeof(int), hipMemcpyDeviceToHost, stream)
+                   != hipSuccess
+               || hipMemcpyAsync(value, d_value, value_bytes, hipMemcpyDeviceToHost, stream)
+                      != hipSuccess
+               || hipStreamSynchronize(stream) != hipSuccess))
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+extern "C" hipblasStatus_t hipblasIamaxExWithValue(hipblasHandle_t handle,
+                                                   int             n,
+                                                   const void*     x,
+                                                   hipDataType     xType,
+                                                   int             incx,
+                                                   int*            result,
+                                                   void*           value,
+                                                   hipDataType     valueType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, valueType);
+
+    return hipblasIamaxExWithValueImpl(
+        handle, n, x, xType, incx, 0, false, result, value, valueType, 1, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasIamaxBatchedExWithValue(hipblasHandle_t handle,
+                                                          int             n,
+                                                          const void*     x,
+                                                          hipDataType     xType,
+                                                          int             incx,
+                                                          int*            result,
+                                                          void*           value,
+                                                          hipDataType     valueType,
+                                                          int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, valueType, batchCount);
+
+    return hipblasIamaxExWithValueImpl(
+        handle, n, x, xType, incx, 0, true, result, value, valueType, batchCount, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasIamaxStridedBatchedExWithValue(hipblasHandle_t handle,
+                                                                 int             n,
+                                                                 const void*     x,
+                                                                 hipDataType     xType,
+                                                                 int             incx,
+                                                                 hipblasStride   stridex,
+                                                                 int*            result,
+                                                                 void*           value,
+                                                                 hipDataType     valueType,
+                                                                 int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, stridex, valueType, batchCount);
+
+    return hipblasIamaxExWithValueImpl(
+        handle, n, x, xType, incx, stridex, false, result, value, valueType, batchCount, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasIaminExWithValue(hipblasHandle_t handle,
+                                                   int             n,
+                                                   const void*     x,
+                                                   hipDataType     xType,
+                                                   int             incx,
+                                                   int*            result,
+                                                   void*           value,
+                                                   hipDataType     valueType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, valueType);
+
+    return hipblasIamaxExWithValueImpl(
+        handle, n, x, xType, incx, 0, false, result, value, valueType, 1, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasIaminBatchedExWithValue(hipblasHandle_t handle,
+                                                          int             n,
+                                                          const void*     x,
+                                                          hipDataType     xType,
+                                                          int             incx,
+                                                          int*            result,
+                                                          void*           value,
+                                                          hipDataType     valueType,
+                                                          int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, valueType, batchCount);
+
+    return hipblasIamaxExWithValueImpl(
+        handle, n, x, xType, incx, 0, true, result, value, valueType, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasIaminStridedBatchedExWithValue(hipblasHandle_t handle,
+                                                                 int             n,
+                                                                 const void*     x,
+                                                                 hipDataType     xType,
+                                                                 int             incx,
+                                                                 hipblasStride   stridex,
+                                                                 int*            result,
+                                                                 void*           value,
+                                                                 hipDataType     valueType,
+                                                                 int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, stridex, valueType, batchCount);
+
+    return hipblasIamaxExWithValueImpl(
+        handle, n, x, xType, incx, stridex, false, result, value, valueType, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
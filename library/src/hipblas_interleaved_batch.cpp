@@ -0,0 +1,975 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_interleaved_batch.hpp"
+#include "hipblas_managed.hpp"
+#include "hipblas_entry.hpp"
+
+// The interleaved batch layout of hipblasSetBatchLayout, element (i, j) of matrix b of X at
+// X[b + (i + j * ldx) * strideX]. The kernels give a thread to each matrix of the batch, and to
+// each element of C or right-hand side when there are several, with the threads of a block on
+// consecutive matrices: a thread walks through its matrix as the reference algorithm does, and
+// every load and store of a warp is of consecutive elements. This is what makes the batches of
+// tiny matrices, too small for a block or even a warp each, bandwidth bound instead of latency
+// bound. The conversions between the layouts go through shared memory tiles.
+
+namespace
+{
+    constexpr int hipblas_interleaved_threads = 256;
+
+    // Matrices and elements of the tiles of the layout conversions, and the rows of threads of
+    // their blocks, each copying hipblas_interleave_tile / hipblas_interleave_rows elements
+    constexpr int hipblas_interleave_tile = 32;
+    constexpr int hipblas_interleave_rows = 8;
+
+    constexpr int64_t hipblas_interleaved_max_grid = 65535;
+
+    template <typename T>
+    __device__ inline T hipblas_interleaved_mul(T a, T b)
+    {
+        return a * b;
+    }
+
+    __device__ inline hipFloatComplex hipblas_interleaved_mul(hipFloatComplex a, hipFloatComplex b)
+    {
+        return hipCmulf(a, b);
+    }
+
+    __device__ inline hipDoubleComplex hipblas_interleaved_mul(hipDoubleComplex a,
+                                                               hipDoubleComplex b)
+    {
+        return hipCmul(a, b);
+    }
+
+    // c - a * b
+    template <typename T>
+    __device__ inline T hipblas_interleaved_fms(T a, T b, T c)
+    {
+        return c - a * b;
+    }
+
+    __device__ inline hipFloatComplex
+        hipblas_interleaved_fms(hipFloatComplex a, hipFloatComplex b, hipFloatComplex c)
+    {
+        return hipCsubf(c, hipCmulf(a, b));
+    }
+
+    __device__ inline hipDoubleComplex
+        hipblas_interleaved_fms(hipDoubleComplex a, hipDoubleComplex b, hipDoubleComplex c)
+    {
+        return hipCsub(c, hipCmul(a, b));
+    }
+
+    // a * b + c
+    template <typename T>
+    __device__ inline T hipblas_interleaved_fma(T a, T b, T c)
+    {
+        return a * b + c;
+    }
+
+    __device__ inline hipFloatComplex
+        hipblas_interleaved_fma(hipFloatComplex a, hipFloatComplex b, hipFloatComplex c)
+    {
+        return hipCfmaf(a, b, c);
+    }
+
+    __device__ inline hipDoubleComplex
+        hipblas_interleaved_fma(hipDoubleComplex a, hipDoubleComplex b, hipDoubleComplex c)
+    {
+        return hipCfma(a, b, c);
+    }
+
+    template <typename T>
+    __device__ inline T hipblas_interleaved_div(T a, T b)
+    {
+        return a / b;
+    }
+
+    __device__ inline hipFloatComplex hipblas_interleaved_div(hipFloatComplex a, hipFloatComplex b)
+    {
+        return hipCdivf(a, b);
+    }
+
+    __device__ inline hipDoubleComplex hipblas_interleaved_div(hipDoubleComplex a,
+                                                               hipDoubleComplex b)
+    {
+        return hipCdiv(a, b);
+    }
+
+    // The magnitude the pivots are chosen by, |Re| + |Im| for complex types as in iamax
+    template <typename T>
+    __device__ inline double hipblas_interleaved_abs(T a)
+    {
+        return fabs(double(a));
+    }
+
+    __device__ inline double hipblas_interleaved_abs(hipFloatComplex a)
+    {
+        return fabs(double(hipCrealf(a))) + fabs(double(hipCimagf(a)));
+    }
+
+    __device__ inline double hipblas_interleaved_abs(hipDoubleComplex a)
+    {
+        return fabs(hipCreal(a)) + fabs(hipCimag(a));
+    }
+
+    template <typename T>
+    __device__ inline void hipblas_interleaved_swap(T& a, T& b)
+    {
+        T t = a;
+        a   = b;
+        b   = t;
+    }
+
+    // The thread's matrix of the batch, numbered across the blocks of a row of the grid
+    __device__ inline int64_t hipblas_interleaved_matrix()
+    {
+        return int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+    }
+
+    // The index of element e, counted down the columns, of matrix b of a strided batch
+    __device__ inline int64_t
+        hipblas_strided_index(int64_t e, int64_t b, int64_t m, int64_t ld, hipblasStride stride)
+    {
+        return b * stride + e % m + e / m * ld;
+    }
+
+    // The index of element e of matrix b of an interleaved batch
+    __device__ inline int64_t
+        hipblas_interleaved_index(int64_t e, int64_t b, int64_t m, int64_t ld, hipblasStride stride)
+    {
+        return b + (e % m + e / m * ld) * stride;
+    }
+
+    // Copies the m by n matrices of X to Y, from the strided layout to the interleaved one when
+    // interleave and back otherwise. A block copies tiles of hipblas_interleave_tile matrices by
+    // as many elements, kept in shared memory as tile[matrix][element]: the threads of a row
+    // read and write consecutive elements of a strided matrix, or the same element of
+    // consecutive interleaved matrices.
+    template <typename E, bool interleave>
+    __global__ void __launch_bounds__(hipblas_interleave_tile * hipblas_interleave_rows)
+        hipblasInterleaveKernel(int64_t       m,
+                                int64_t       n,
+                                const E*      X,
+                                int64_t       ldx,
+                                hipblasStride stridex,
+                                E*            Y,
+                                int64_t       ldy,
+                                hipblasStride stridey,
+                                int64_t       batch_count)
+    {
+        __shared__ E tile[hipblas_interleave_tile][hipblas_interleave_tile + 1];
+
+        constexpr int S        = hipblas_interleave_tile;
+        int64_t       elements = m * n;
+        int64_t       first_e  = int64_t(blockIdx.x) * S;
+        for(int64_t first_b = int64_t(blockIdx.y) * S; first_b < batch_count;
+            first_b += int64_t(gridDim.y) * S)
+        {
+            for(int r = threadIdx.y; r < S; r += hipblas_interleave_rows)
+            {
+                if(interleave)
+                {
+                    int64_t e = first_e + threadIdx.x, b = first_b + r;
+                    if(e < elements && b < batch_count)
+                        tile[r][threadIdx.x] = X[hipblas_strided_index(e, b, m, ldx, stridex)];
+                }
+                else
+                {
+                    int64_t e = first_e + r, b = first_b + threadIdx.x;
+                    if(e < elements && b < batch_count)
+                        tile[threadIdx.x][r] = X[hipblas_interleaved_index(e, b, m, ldx, stridex)];
+                }
+            }
+            __syncthreads();
+
+            for(int r = threadIdx.y; r < S; r += hipblas_interleave_rows)
+            {
+                if(interleave)
+                {
+                    int64_t e = first_e + r, b = first_b + threadIdx.x;
+                    if(e < elements && b < batch_count)
+                        Y[hipblas_interleaved_index(e, b, m, ldy, stridey)] = tile[threadIdx.x][r];
+                }
+                else
+                {
+                    int64_t e = first_e + threadIdx.x, b = first_b + r;
+                    if(e < elements && b < batch_count)
+                        Y[hipblas_strided_index(e, b, m, ldy, stridey)] = tile[r][threadIdx.x];
+                }
+            }
+            __syncthreads();
+        }
+    }
+
+    template <typename E>
+    hipError_t hipblas_interleave_launch(bool          interleave,
+                                         int64_t       m,
+                                         int64_t       n,
+                                         const void*   A,
+                                         int64_t       lda,
+                                         hipblasStride strideA,
+                                         void*         B,
+                                         int64_t       ldb,
+                                         hipblasStride strideB,
+                                         int64_t       batch_count,
+                                         hipStream_t   stream)
+    {
+        constexpr int64_t S = hipblas_interleave_tile;
+        int64_t           tiles = std::min((batch_count - 1) / S + 1, hipblas_interleaved_max_grid);
+        dim3              blocks(unsigned((m * n - 1) / S + 1), unsigned(tiles));
+        dim3              threads(hipblas_interleave_tile, hipblas_interleave_rows);
+        if(interleave)
+            hipblasInterleaveKernel<E, true><<<blocks, threads, 0, stream>>>(
+                m, n, (const E*)A, lda, strideA, (E*)B, ldb, strideB, batch_count);
+        else
+            hipblasInterleaveKernel<E, false><<<blocks, threads, 0, stream>>>(
+                m, n, (const E*)A, lda, strideA, (E*)B, ldb, strideB, batch_count);
+        return hipGetLastError();
+    }
+
+    hipblasStatus_t hipblas_interleave(bool            interleave,
+                                       hipblasHandle_t handle,
+                                       int64_t         m,
+                                       int64_t         n,
+                                       hipDataType     type,
+                                       const void*     A,
+                                       int64_t         lda,
+                                       hipblasStride   strideA,
+                                       void*           B,
+                                       int64_t         ldb,
+                                       hipblasStride   strideB,
+                                       int64_t         batch_count)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+        size_t size = hipblasPrefetchTypeSize(type);
+        if(!size)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        // The strides of the strided side are between matrices and those of the interleaved
+        // side between elements
+        int64_t       ld_strided         = interleave ? lda : ldb;
+        hipblasStride stride_strided     = interleave ? strideA : strideB;
+        hipblasStride stride_interleaved = interleave ? strideB : strideA;
+        if(m < 0 || n < 0 || batch_count < 0 || lda < std::max<int64_t>(1, m)
+           || ldb < std::max<int64_t>(1, m)
+           || (batch_count > 1 && stride_strided < ld_strided * n)
+           || stride_interleaved < batch_count)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!m || !n || !batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!A || !B)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // Only the size of the elements matters
+        auto launch = size == 1   ? hipblas_interleave_launch<uint8_t>
+                      : size == 2 ? hipblas_interleave_launch<uint16_t>
+                      : size == 4 ? hipblas_interleave_launch<uint32_t>
+                      : size == 8 ? hipblas_interleave_launch<uint64_t>
+                                  : hipblas_interleave_launch<hipDoubleComplex>;
+        if(launch(interleave, m, n, A, lda, strideA, B, ldb, strideB, batch_count, stream)
+           != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Element (i, j) of matrix b of an interleaved batch
+    template <typename T>
+    __device__ inline T& hipblas_interleaved_at(
+        T* X, int64_t i, int64_t j, int64_t ldx, hipblasStride stridex, int64_t b)
+    {
+        return X[b + (i + j * ldx) * stridex];
+    }
+
+    // C_b := alpha * op(A_b) * op(B_b) + beta * C_b with a thread for each matrix b and element
+    // of C, the columns of the grid walking through the elements of C. C_b isn't read when beta
+    // is zero. The scalars are read from alpha and beta when they aren't nullptr, in device
+    // pointer mode, and are alpha_value and beta_value otherwise.
+    template <typename T>
+    __global__ void __launch_bounds__(hipblas_interleaved_threads)
+        hipblasInterleavedGemmKernel(hipblasOperation_t transA,
+                                     hipblasOperation_t transB,
+                                     int64_t            m,
+                                     int64_t            n,
+                                     int64_t            k,
+                                     const T*           alpha,
+                                     T                  alpha_value,
+                                     const T*           A,
+                                     int64_t            lda,
+                                     hipblasStride      strideA,
+                                     const T*           B,
+                                     int64_t            ldb,
+                                     hipblasStride      strideB,
+                                     const T*           beta,
+                                     T                  beta_value,
+                                     T*                 C,
+                                     int64_t            ldc,
+                                     hipblasStride      strideC,
+                                     int64_t            batch_count)
+    {
+        int64_t b = hipblas_interleaved_matrix();
+        if(b >= batch_count)
+            return;
+        if(alpha)
+            alpha_value = *alpha;
+        if(beta)
+            beta_value = *beta;
+
+        for(int64_t e = blockIdx.y; e < m * n; e += gridDim.y)
+        {
+            int64_t i = e % m, j = e / m;
+            T       sum{};
+            if(!hipblas_device_is_zero(alpha_value))
+                for(int64_t l = 0; l < k; l++)
+                {
+                    T a = transA == HIPBLAS_OP_N ? hipblas_interleaved_at(A, i, l, lda, strideA, b)
+                                                 : hipblas_interleaved_at(A, l, i, lda, strideA, b);
+                    T x = transB == HIPBLAS_OP_N ? hipblas_interleaved_at(B, l, j, ldb, strideB, b)
+                                                 : hipblas_interleaved_at(B, j, l, ldb, strideB, b);
+                    if(transA == HIPBLAS_OP_C)
+                        a = hipblas_device_conj(a);
+                    if(transB == HIPBLAS_OP_C)
+                        x = hipblas_device_conj(x);
+                    sum = hipblas_interleaved_fma(a, x, sum);
+                }
+
+            T& c = hipblas_interleaved_at(C, i, j, ldc, strideC, b);
+            c    = hipblas_device_axpby(
+                alpha_value, sum, beta_value, hipblas_device_is_zero(beta_value) ? T{} : c);
+        }
+    }
+
+    // Solves M x = x in place for the triangle of M of order n, whose element (r, c) is
+    // a[r * row + c * col], conjugated when conj, and x with its elements inc apart: forward from
+    // the first row when M is lower triangular, backward from the last otherwise, and without
+    // dividing by the diagonal when unit. Row t subtracts the solved elements from its own, so
+    // that x is read and written by the thread alone.
+    template <typename T>
+    __device__ void hipblas_interleaved_trsv(const T* a,
+                                             int64_t  row,
+                                             int64_t  col,
+                                             int64_t  n,
+                                             bool     conj,
+                                             bool     forward,
+                                             bool     unit,
+                                             T*       x,
+                                             int64_t  inc)
+    {
+        for(int64_t step = 0; step < n; step++)
+        {
+            int64_t t     = forward ? step : n - 1 - step;
+            int64_t first = forward ? 0 : t + 1;
+            int64_t last  = forward ? t : n;
+            T       acc   = x[t * inc];
+            for(int64_t s = first; s < last; s++)
+            {
+                T m = a[t * row + s * col];
+                acc = hipblas_interleaved_fms(conj ? hipblas_device_conj(m) : m, x[s * inc], acc);
+            }
+            if(!unit)
+            {
+                T d = a[t * (row + col)];
+                acc = hipblas_interleaved_div(acc, conj ? hipblas_device_conj(d) : d);
+            }
+            x[t * inc] = acc;
+        }
+    }
+
+    // op(A_b) X = alpha B_b, or X op(A_b) = alpha B_b, with a thread for each matrix b and
+    // right-hand side, a column of B on the left and a row on the right, which solves the
+    // transposed system op(A_b)^T x = alpha b. M is op(A), or op(A)^T on the right, and A^T when
+    // transposed, so that it is lower triangular when forward.
+    template <typename T>
+    __global__ void __launch_bounds__(hipblas_interleaved_threads)
+        hipblasInterleavedTrsmKernel(bool          left,
+                                     bool          transposed,
+                                     bool          conj,
+                                     bool          forward,
+                                     bool          unit,
+                                     int64_t       order,
+                                     int64_t       rhs,
+                                     const T*      alpha,
+                                     T             alpha_value,
+                                     const T*      A,
+                                     int64_t       lda,
+                                     hipblasStride strideA,
+                                     T*            B,
+                                     int64_t       ldb,
+                                     hipblasStride strideB,
+                                     int64_t       batch_count)
+    {
+        int64_t b = hipblas_interleaved_matrix();
+        if(b >= batch_count)
+            return;
+        if(alpha)
+            alpha_value = *alpha;
+
+        int64_t row = strideA, col = lda * strideA;
+        if(transposed)
+            hipblas_interleaved_swap(row, col);
+
+        for(int64_t r = blockIdx.y; r < rhs; r += gridDim.y)
+        {
+            T*      x   = left ? B + b + r * ldb * strideB : B + b + r * strideB;
+            int64_t inc = left ? strideB : ldb * strideB;
+            bool    zero = hipblas_device_is_zero(alpha_value);
+            for(int64_t t = 0; t < order; t++)
+                x[t * inc] = zero ? T{} : hipblas_interleaved_mul(alpha_value, x[t * inc]);
+            if(!zero)
+                hipblas_interleaved_trsv(A + b, row, col, order, conj, forward, unit, x, inc);
+        }
+    }
+
+    // P A_b = L U by the right-looking algorithm of getf2, with a thread for each matrix b, the
+    // pivots written from 1 when ipiv isn't nullptr and info[b] the first zero pivot from 1
+    template <typename T>
+    __global__ void __launch_bounds__(hipblas_interleaved_threads)
+        hipblasInterleavedGetrfKernel(int64_t       n,
+                                      T*            A,
+                                      int64_t       lda,
+                                      hipblasStride strideA,
+                                      int*          ipiv,
+                                      hipblasStride strideP,
+                                      int*          info,
+                                      int64_t       batch_count)
+    {
+        int64_t b = hipblas_interleaved_matrix();
+        if(b >= batch_count)
+            return;
+
+        T*      a   = A + b;
+        int64_t row = strideA, col = lda * strideA;
+        int     zero_pivot = 0;
+        for(int64_t j = 0; j < n; j++)
+        {
+            if(ipiv)
+            {
+                int64_t p    = j;
+                double  best = hipblas_interleaved_abs(a[j * row + j * col]);
+                for(int64_t i = j + 1; i < n; i++)
+                {
+                    double v = hipblas_interleaved_abs(a[i * row + j * col]);
+                    if(v > best)
+                    {
+                        best = v;
+                        p    = i;
+                    }
+                }
+                ipiv[b + j * strideP] = int(p + 1);
+                if(p != j)
+                    for(int64_t c = 0; c < n; c++)
+                        hipblas_interleaved_swap(a[j * row + c * col], a[p * row + c * col]);
+            }
+
+            T pivot = a[j * (row + col)];
+            if(!hipblas_device_is_zero(pivot))
+            {
+                T inverse = hipblas_interleaved_div(hipblas_device_one<T>(), pivot);
+                for(int64_t i = j + 1; i < n; i++)
+                    a[i * row + j * col] = hipblas_interleaved_mul(a[i * row + j * col], inverse);
+            }
+            else if(!zero_pivot)
+                zero_pivot = int(j + 1);
+
+            for(int64_t c = j + 1; c < n; c++)
+            {
+                T u = a[j * row + c * col];
+                for(int64_t i = j + 1; i < n; i++)
+                    a[i * row + c * col]
+                        = hipblas_interleaved_fms(a[i * row + j * col], u, a[i * row + c * col]);
+            }
+        }
+        info[b] = zero_pivot;
+    }
+
+    // op(A_b) X = B_b with P A_b = L U, with a thread for each matrix b and column of B:
+    // x := P x, L y = x and U x = y, or, transposed, U^T y = x, L^T z = y and x := P^T z
+    template <typename T>
+    __global__ void __launch_bounds__(hipblas_interleaved_threads)
+        hipblasInterleavedGetrsKernel(bool          transposed,
+                                      bool          conj,
+                                      int64_t       n,
+                                      int64_t       nrhs,
+                                      const T*      A,
+                                      int64_t       lda,
+                                      hipblasStride strideA,
+                                      const int*    ipiv,
+                                      hipblasStride strideP,
+                                      T*            B,
+                                      int64_t       ldb,
+                                      hipblasStride strideB,
+                                      int64_t       batch_count)
+    {
+        int64_t b = hipblas_interleaved_matrix();
+        if(b >= batch_count)
+            return;
+
+        const T* a   = A + b;
+        int64_t  row = strideA, col = lda * strideA;
+        for(int64_t r = blockIdx.y; r < nrhs; r += gridDim.y)
+        {
+            T*      x   = B + b + r * ldb * strideB;
+            int64_t inc = strideB;
+            if(!transposed)
+            {
+                for(int64_t j = 0; j < n; j++)
+                {
+                    int64_t p = ipiv[b + j * strideP] - 1;
+                    if(p != j)
+                        hipblas_interleaved_swap(x[j * inc], x[p * inc]);
+                }
+                hipblas_interleaved_trsv(a, row, col, n, false, true, true, x, inc);
+                hipblas_interleaved_trsv(a, row, col, n, false, false, false, x, inc);
+            }
+            else
+            {
+                hipblas_interleaved_trsv(a, col, row, n, conj, true, false, x, inc);
+                hipblas_interleaved_trsv(a, col, row, n, conj, false, true, x, inc);
+                for(int64_t j = n - 1; j >= 0; j--)
+                {
+                    int64_t p = ipiv[b + j * strideP] - 1;
+                    if(p != j)
+                        hipblas_interleaved_swap(x[j * inc], x[p * inc]);
+                }
+            }
+        }
+    }
+
+    // Calls f with a value of the type of the elements of type, or returns false for the types
+    // the kernels don't have
+    template <typename F>
+    bool hipblas_interleaved_dispatch(hipDataType type, F&& f)
+    {
+        switch(type)
+        {
+        case HIP_R_32F:
+            f(float{});
+            return true;
+        case HIP_R_64F:
+            f(double{});
+            return true;
+        case HIP_C_32F:
+            f(hipFloatComplex{});
+            return true;
+        case HIP_C_64F:
+            f(hipDoubleComplex{});
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // The blocks of a launch with a thread for each matrix and a row of blocks for each of
+    // columns elements, right-hand sides or elements of C
+    dim3 hipblas_interleaved_blocks(int64_t batch_count, int64_t columns)
+    {
+        return dim3(unsigned((batch_count - 1) / hipblas_interleaved_threads + 1),
+                    unsigned(std::clamp<int64_t>(columns, 1, hipblas_interleaved_max_grid)));
+    }
+
+    hipblasStatus_t hipblas_interleaved_stream(hipblasHandle_t       handle,
+                                               hipStream_t*          stream,
+                                               hipblasPointerMode_t* mode)
+    {
+        hipblasStatus_t status = hipblasGetStream(handle, stream);
+        if(status == HIPBLAS_STATUS_SUCCESS && mode)
+            status = hipblasGetPointerMode(handle, mode);
+        return status;
+    }
+}
+
+extern "C" hipblasStatus_t hipblasInterleaveBatch(hipblasHandle_t handle,
+                                                  int64_t         m,
+                                                  int64_t         n,
+                                                  hipDataType     type,
+                                                  const void*     A,
+                                                  int64_t         lda,
+                                                  hipblasStride   strideA,
+                                                  void*           B,
+                                                  int64_t         ldb,
+                                                  hipblasStride   strideB,
+                                                  int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, type, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblas_interleave(
+        true, handle, m, n, type, A, lda, strideA, B, ldb, strideB, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDeinterleaveBatch(hipblasHandle_t handle,
+                                                    int64_t         m,
+                                                    int64_t         n,
+                                                    hipDataType     type,
+                                                    const void*     A,
+                                                    int64_t         lda,
+                                                    hipblasStride   strideA,
+                                                    void*           B,
+                                                    int64_t         ldb,
+                                                    hipblasStride   strideB,
+                                                    int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, type, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblas_interleave(
+        false, handle, m, n, type, A, lda, strideA, B, ldb, strideB, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasInterleavedGemm(hipblasHandle_t      handle,
+                                       hipblasOperation_t   transA,
+                                       hipblasOperation_t   transB,
+                                       int64_t              m,
+                                       int64_t              n,
+                                       int64_t              k,
+                                       const void*          alpha,
+                                       const void*          A,
+                                       hipDataType          aType,
+                                       int64_t              lda,
+                                       hipblasStride        strideA,
+                                       const void*          B,
+                                       hipDataType          bType,
+                                       int64_t              ldb,
+                                       hipblasStride        strideB,
+                                       const void*          beta,
+                                       void*                C,
+                                       hipDataType          cType,
+                                       int64_t              ldc,
+                                       hipblasStride        strideC,
+                                       int64_t              batchCount,
+                                       hipblasComputeType_t computeType)
+try
+{
+    auto valid_trans = [](hipblasOperation_t trans) {
+        return trans == HIPBLAS_OP_N || trans == HIPBLAS_OP_T || trans == HIPBLAS_OP_C;
+    };
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!valid_trans(transA) || !valid_trans(transB))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    int64_t rows_a = transA == HIPBLAS_OP_N ? m : k;
+    int64_t rows_b = transB == HIPBLAS_OP_N ? k : n;
+    if(m < 0 || n < 0 || k < 0 || batchCount < 0 || lda < std::max<int64_t>(1, rows_a)
+       || ldb < std::max<int64_t>(1, rows_b) || ldc < std::max<int64_t>(1, m)
+       || strideA < batchCount || strideB < batchCount || strideC < batchCount)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    bool double_compute
+        = computeType == HIPBLAS_COMPUTE_64F || computeType == HIPBLAS_COMPUTE_64F_PEDANTIC;
+    bool float_compute
+        = computeType == HIPBLAS_COMPUTE_32F || computeType == HIPBLAS_COMPUTE_32F_PEDANTIC;
+    bool double_type = cType == HIP_R_64F || cType == HIP_C_64F;
+    if(aType != bType || bType != cType || (double_type ? !double_compute : !float_compute))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    if(!m || !n || !batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || !C || (k && (!A || !B)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblas_interleaved_stream(handle, &stream, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    bool host_scalars = mode != HIPBLAS_POINTER_MODE_DEVICE;
+
+    hipError_t error = hipSuccess;
+    bool       typed = hipblas_interleaved_dispatch(cType, [&](auto zero) {
+        using T       = decltype(zero);
+        T alpha_value = host_scalars ? *static_cast<const T*>(alpha) : T{};
+        T beta_value  = host_scalars ? *static_cast<const T*>(beta) : T{};
+        hipblasInterleavedGemmKernel<T>
+            <<<hipblas_interleaved_blocks(batchCount, m * n),
+               hipblas_interleaved_threads,
+               0,
+               stream>>>(transA,
+                         transB,
+                         m,
+                         n,
+                         k,
+                         host_scalars ? nullptr : static_cast<const T*>(alpha),
+                         alpha_value,
+                         static_cast<const T*>(A),
+                         lda,
+                         strideA,
+                         static_cast<const T*>(B),
+                         ldb,
+                         strideB,
+                         host_scalars ? nullptr : static_cast<const T*>(beta),
+                         beta_value,
+                         static_cast<T*>(C),
+                         ldc,
+                         strideC,
+                         batchCount);
+        error = hipGetLastError();
+    });
+    if(!typed)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return error == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasInterleavedTrsm(hipblasHandle_t    handle,
+                                       hipblasSideMode_t  side,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const void*        alpha,
+                                       const void*        A,
+                                       hipDataType        dataType,
+                                       int64_t            lda,
+                                       hipblasStride      strideA,
+                                       void*              B,
+                                       int64_t            ldb,
+                                       hipblasStride      strideB,
+                                       int64_t            batchCount)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if((side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+       || (uplo != HIPBLAS_FILL_MODE_LOWER && uplo != HIPBLAS_FILL_MODE_UPPER)
+       || (transA != HIPBLAS_OP_N && transA != HIPBLAS_OP_T && transA != HIPBLAS_OP_C)
+       || (diag != HIPBLAS_DIAG_UNIT && diag != HIPBLAS_DIAG_NON_UNIT))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    bool    left  = side == HIPBLAS_SIDE_LEFT;
+    int64_t order = left ? m : n;
+    if(m < 0 || n < 0 || batchCount < 0 || lda < std::max<int64_t>(1, order)
+       || ldb < std::max<int64_t>(1, m) || strideA < batchCount || strideB < batchCount)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n || !batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !A || !B)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblas_interleaved_stream(handle, &stream, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    bool host_scalars = mode != HIPBLAS_POINTER_MODE_DEVICE;
+
+    // X op(A) = alpha B is op(A)^T X^T = alpha B^T, and op(A) is op(A)^T transposed
+    bool transposed = (transA != HIPBLAS_OP_N) == left;
+    bool forward    = (uplo == HIPBLAS_FILL_MODE_LOWER) != transposed;
+
+    hipError_t error = hipSuccess;
+    bool       typed = hipblas_interleaved_dispatch(dataType, [&](auto zero) {
+        using T       = decltype(zero);
+        T alpha_value = host_scalars ? *static_cast<const T*>(alpha) : T{};
+        hipblasInterleavedTrsmKernel<T>
+            <<<hipblas_interleaved_blocks(batchCount, left ? n : m),
+               hipblas_interleaved_threads,
+               0,
+               stream>>>(left,
+                         transposed,
+                         transA == HIPBLAS_OP_C,
+                         forward,
+                         diag == HIPBLAS_DIAG_UNIT,
+                         order,
+                         left ? n : m,
+                         host_scalars ? nullptr : static_cast<const T*>(alpha),
+                         alpha_value,
+                         static_cast<const T*>(A),
+                         lda,
+                         strideA,
+                         static_cast<T*>(B),
+                         ldb,
+                         strideB,
+                         batchCount);
+        error = hipGetLastError();
+    });
+    if(!typed)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return error == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasInterleavedGetrf(hipblasHandle_t handle,
+                                        int64_t         n,
+                                        void*           A,
+                                        hipDataType     dataType,
+                                        int64_t         lda,
+                                        hipblasStride   strideA,
+                                        int*            ipiv,
+                                        hipblasStride   strideP,
+                                        int*            info,
+                                        int64_t         batchCount)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max<int64_t>(1, n) || batchCount < 0 || strideA < batchCount
+       || (ipiv && strideP < batchCount))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!info || (n && !A))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblas_interleaved_stream(handle, &stream, nullptr);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // An empty matrix still gets its info of 0
+    hipError_t error = hipSuccess;
+    bool       typed = hipblas_interleaved_dispatch(dataType, [&](auto zero) {
+        using T = decltype(zero);
+        hipblasInterleavedGetrfKernel<T>
+            <<<hipblas_interleaved_blocks(batchCount, 1), hipblas_interleaved_threads, 0, stream>>>(
+                n, static_cast<T*>(A), lda, strideA, ipiv, strideP, info, batchCount);
+        error = hipGetLastError();
+    });
+    if(!typed)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return error == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasInterleavedGetrs(hipblasHandle_t    handle,
+                                        hipblasOperation_t trans,
+                                        int64_t            n,
+                                        int64_t            nrhs,
+                                        const void*        A,
+                                        hipDataType        dataType,
+                                        int64_t            lda,
+                                        hipblasStride      strideA,
+                                        const int*         ipiv,
+                                        hipblasStride      strideP,
+                                        void*              B,
+                                        int64_t            ldb,
+                                        hipblasStride      strideB,
+                                        int*               info,
+                                        int64_t            batchCount)
+try
+{
+    if(info == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == nullptr && n)
+        *info = -4;
+    else if(lda < std::max<int64_t>(1, n))
+        *info = -5;
+    else if(strideA < batchCount)
+        *info = -6;
+    else if(ipiv == nullptr && n)
+        *info = -7;
+    else if(strideP < batchCount)
+        *info = -8;
+    else if(B == nullptr && n * nrhs)
+        *info = -9;
+    else if(ldb < std::max<int64_t>(1, n))
+        *info = -10;
+    else if(strideB < batchCount)
+        *info = -11;
+    else if(batchCount < 0)
+        *info = -13;
+    else
+        *info = 0;
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!n || !nrhs || !batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblas_interleaved_stream(handle, &stream, nullptr);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipError_t error = hipSuccess;
+    bool       typed = hipblas_interleaved_dispatch(dataType, [&](auto zero) {
+        using T = decltype(zero);
+        hipblasInterleavedGetrsKernel<T>
+            <<<hipblas_interleaved_blocks(batchCount, nrhs),
+               hipblas_interleaved_threads,
+               0,
+               stream>>>(trans != HIPBLAS_OP_N,
+                         trans == HIPBLAS_OP_C,
+                         n,
+                         nrhs,
+                         static_cast<const T*>(A),
+                         lda,
+                         strideA,
+                         ipiv,
+                         strideP,
+                         static_cast<T*>(B),
+                         ldb,
+                         strideB,
+                         batchCount);
+        error = hipGetLastError();
+    });
+    if(!typed)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return error == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
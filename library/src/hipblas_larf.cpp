@@ -0,0 +1,1599 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_entry.hpp"
+
+// The batched Householder reflector functions larfg, larft and larfb. rocSOLVER has these only
+// for a single problem and cuSOLVER not at all, so they are kernels of hipBLAS for both backends,
+// each a single launch for the whole batch. The reflectors are the forward, columnwise ones that
+// geqrf leaves below the diagonal of A: V is unit lower trapezoidal, with the ones and the zeros
+// above them implied, and H = H_1 * H_2 * ... * H_k = I - V * T * V^H for the upper triangular
+// T of larft.
+//
+// larfg and larft work on one problem per block. larfb applies H, or H^H, to each column of A
+// from the left, or to each row from the right, in a block of its own: a column a becomes
+// a - V * op(T) * (V^H * a), and a row is the same with its conjugate and the other op(T).
+
+namespace
+{
+    constexpr int hipblas_larf_threads = 256;
+
+    // The most reflectors of larft and larfb, whose vectors of k elements are in shared memory
+    constexpr int hipblas_larf_max_k = 512;
+
+    template <typename T>
+    __device__ inline T hipblas_larf_mul(T a, T b)
+    {
+        return a * b;
+    }
+
+    __device__ inline hipFloatComplex hipblas_larf_mul(hipFloatComplex a, hipFloatComplex b)
+    {
+        return hipCmulf(a, b);
+    }
+
+    __device__ inline hipDoubleComplex hipblas_larf_mul(hipDoubleComplex a, hipDoubleComplex b)
+    {
+        return hipCmul(a, b);
+    }
+
+    // c + a * b
+    template <typename T>
+    __device__ inline T hipblas_larf_fma(T a, T b, T c)
+    {
+        return c + a * b;
+    }
+
+    __device__ inline hipFloatComplex
+        hipblas_larf_fma(hipFloatComplex a, hipFloatComplex b, hipFloatComplex c)
+    {
+        return hipCaddf(c, hipCmulf(a, b));
+    }
+
+    __device__ inline hipDoubleComplex
+        hipblas_larf_fma(hipDoubleComplex a, hipDoubleComplex b, hipDoubleComplex c)
+    {
+        return hipCadd(c, hipCmul(a, b));
+    }
+
+    template <typename T>
+    __device__ inline T hipblas_larf_add(T a, T b)
+    {
+        return a + b;
+    }
+
+    __device__ inline hipFloatComplex hipblas_larf_add(hipFloatComplex a, hipFloatComplex b)
+    {
+        return hipCaddf(a, b);
+    }
+
+    __device__ inline hipDoubleComplex hipblas_larf_add(hipDoubleComplex a, hipDoubleComplex b)
+    {
+        return hipCadd(a, b);
+    }
+
+    template <typename T>
+    __device__ inline T hipblas_larf_sub(T a, T b)
+    {
+        return a - b;
+    }
+
+    __device__ inline hipFloatComplex hipblas_larf_sub(hipFloatComplex a, hipFloatComplex b)
+    {
+        return hipCsubf(a, b);
+    }
+
+    __device__ inline hipDoubleComplex hipblas_larf_sub(hipDoubleComplex a, hipDoubleComplex b)
+    {
+        return hipCsub(a, b);
+    }
+
+    template <typename T>
+    __device__ inline T hipblas_larf_inv(T a)
+    {
+        return T(1) / a;
+    }
+
+    __device__ inline hipFloatComplex hipblas_larf_inv(hipFloatComplex a)
+    {
+        return hipCdivf(make_hipFloatComplex(1, 0), a);
+    }
+
+    __device__ inline hipDoubleComplex hipblas_larf_inv(hipDoubleComplex a)
+    {
+        return hipCdiv(make_hipDoubleComplex(1, 0), a);
+    }
+
+    // The real and imaginary parts, and the element of type T made from them
+    template <typename T>
+    __device__ inline auto hipblas_larf_real(T a)
+    {
+        if constexpr(std::is_arithmetic_v<T>)
+            return a;
+        else
+            return a.x;
+    }
+
+    template <typename T>
+    __device__ inline auto hipblas_larf_imag(T a)
+    {
+        if constexpr(std::is_arithmetic_v<T>)
+            return T(0);
+        else
+            return a.y;
+    }
+
+    template <typename T, typename U>
+    __device__ inline T hipblas_larf_make(U re, U im)
+    {
+        if constexpr(std::is_same_v<T, hipFloatComplex>)
+            return make_hipFloatComplex(re, im);
+        else if constexpr(std::is_same_v<T, hipDoubleComplex>)
+            return make_hipDoubleComplex(re, im);
+        else
+            return re;
+    }
+
+    // The element b of a batch, from an array of pointers or at a stride from the first one
+    template <typename T>
+    __device__ inline T*
+        hipblas_larf_batch(const void* X, hipblasStride stride, bool batched, int64_t b)
+    {
+        if(batched)
+            return static_cast<T* const*>(X)[b];
+        return static_cast<T*>(const_cast<void*>(X)) + b * stride;
+    }
+
+    // The sum, or the largest, of the values of the threads of a block, in red[0]
+    template <bool largest, typename U>
+    __device__ inline void hipblas_larf_reduce(U* red)
+    {
+        const int t = threadIdx.x;
+        for(int s = hipblas_larf_threads / 2; s > 0; s /= 2)
+        {
+            __syncthreads();
+            if(t < s)
+                red[t] = largest ? max(red[t], red[t + s]) : red[t] + red[t + s];
+        }
+        __syncthreads();
+    }
+
+    struct hipblas_larfg_problem
+    {
+        int64_t       n;
+        void*         alpha;
+        hipblasStride stride_alpha;
+        void*         x;
+        int64_t       incx;
+        hipblasStride stride_x;
+        void*         tau;
+        hipblasStride stride_tau;
+        bool          batched;
+        int64_t       batch_count;
+    };
+
+    // One reflector per block. The norm of x is scaled by its largest element against overflow,
+    // as in LAPACK, but the rescaling of LAPACK for a beta below the safe minimum is left out.
+    template <typename T>
+    __global__ void __launch_bounds__(hipblas_larf_threads)
+        hipblasLarfgKernel(hipblas_larfg_problem problem)
+    {
+        using U = decltype(hipblas_larf_real(T{}));
+
+        __shared__ U    red[hipblas_larf_threads];
+        __shared__ T    scale;
+        __shared__ bool reflect;
+
+        const int     t  = threadIdx.x;
+        const int64_t nx = problem.n - 1;
+
+        for(int64_t b = blockIdx.x; b < problem.batch_count; b += gridDim.x)
+        {
+            T* alpha
+                = hipblas_larf_batch<T>(problem.alpha, problem.stride_alpha, problem.batched, b);
+            T* x   = hipblas_larf_batch<T>(problem.x, problem.stride_x, problem.batched, b);
+            T* tau = hipblas_larf_batch<T>(problem.tau, problem.stride_tau, problem.batched, b);
+
+            U big = 0;
+            for(int64_t i = t; i < nx; i += hipblas_larf_threads)
+            {
+                T y = x[i * problem.incx];
+                big = max(big, max(fabs(hipblas_larf_real(y)), fabs(hipblas_larf_imag(y))));
+            }
+            red[t] = big;
+            hipblas_larf_reduce<true>(red);
+            big = red[0];
+            __syncthreads();
+
+            U ssq = 0;
+            if(big > 0)
+            {
+                for(int64_t i = t; i < nx; i += hipblas_larf_threads)
+                {
+                    T y  = x[i * problem.incx];
+                    U re = hipblas_larf_real(y) / big, im = hipblas_larf_imag(y) / big;
+                    ssq += re * re + im * im;
+                }
+            }
+            red[t] = ssq;
+            hipblas_larf_reduce<false>(red);
+
+            if(t == 0)
+            {
+                U xnorm = big * sqrt(red[0]);
+                U ar    = hipblas_larf_real(*alpha);
+                U ai    = hipblas_larf_imag(*alpha);
+
+                // H = I when x and the imaginary part of alpha are zero
+                reflect = problem.n > 1 && (xnorm != 0 || ai != 0);
+                if(!reflect)
+                    *tau = T{};
+                else
+                {
+                    U w    = max(fabs(ar), max(fabs(ai), xnorm));
+                    U norm = w * sqrt((ar / w) * (ar / w) + (ai / w) * (ai / w)
+                                      + (xnorm / w) * (xnorm / w));
+                    U beta = ar >= 0 ? -norm : norm;
+                    T diag = hipblas_larf_make<T>(beta, U(0));
+
+                    *tau   = hipblas_larf_make<T>((beta - ar) / beta, -ai / beta);
+                    scale  = hipblas_larf_inv(hipblas_larf_sub(*alpha, diag));
+                    *alpha = diag;
+                }
+            }
+            __syncthreads();
+
+            if(reflect)
+            {
+                for(int64_t i = t; i < nx; i += hipblas_larf_threads)
+                    x[i * problem.incx] = hipblas_larf_mul(x[i * problem.incx], scale);
+            }
+
+            // the shared memory is reused by the next reflector of the batch
+            __syncthreads();
+        }
+    }
+
+    struct hipblas_larft_problem
+    {
+        int           n;
+        int           k;
+        const void*   V;
+        int64_t       ldv;
+        hipblasStride stride_v;
+        const void*   tau;
+        hipblasStride stride_tau;
+        void*         T;
+        int64_t       ldt;
+        hipblasStride stride_t;
+        bool          batched;
+        int64_t       batch_count;
+    };
+
+    // One T per block. The products V(:, j)^H * V(:, i) of the columns, with the implied ones, are
+    // first computed in parallel into the strict upper triangle of T, and then column i of T is
+    // -tau_i * T(0:i-1, 0:i-1) times them, column by column.
+    template <typename T>
+    __global__ void __launch_bounds__(hipblas_larf_threads)
+        hipblasLarftKernel(hipblas_larft_problem problem)
+    {
+        __shared__ T g[hipblas_larf_max_k];
+
+        const int     t     = threadIdx.x;
+        const int     n     = problem.n;
+        const int     k     = problem.k;
+        const int64_t pairs = int64_t(k) * (k - 1) / 2;
+
+        for(int64_t b = blockIdx.x; b < problem.batch_count; b += gridDim.x)
+        {
+            const T* V
+                = hipblas_larf_batch<const T>(problem.V, problem.stride_v, problem.batched, b);
+            const T* tau
+                = hipblas_larf_batch<const T>(problem.tau, problem.stride_tau, problem.batched, b);
+            T* Tb = hipblas_larf_batch<T>(problem.T, problem.stride_t, problem.batched, b);
+
+            // pair p is column i and row j < i, with the columns one after the other
+            for(int64_t p = t; p < pairs; p += hipblas_larf_threads)
+            {
+                int i = int((1 + sqrt(1 + 8 * double(p))) / 2);
+                while(int64_t(i) * (i - 1) / 2 > p)
+                    i--;
+                while(int64_t(i + 1) * i / 2 <= p)
+                    i++;
+                int j = int(p - int64_t(i) * (i - 1) / 2);
+
+                T s = hipblas_device_conj(V[i + j * problem.ldv]);
+                for(int r = i + 1; r < n; r++)
+                    s = hipblas_larf_fma(hipblas_device_conj(V[r + j * problem.ldv]),
+                                         V[r + i * problem.ldv],
+                                         s);
+                Tb[j + i * problem.ldt] = s;
+            }
+            for(int i = t; i < k; i += hipblas_larf_threads)
+                Tb[i + i * problem.ldt] = tau[i];
+            __syncthreads();
+
+            for(int i = 1; i < k; i++)
+            {
+                for(int j = t; j < i; j += hipblas_larf_threads)
+                    g[j] = Tb[j + i * problem.ldt];
+                __syncthreads();
+
+                T f = tau[i];
+                for(int j = t; j < i; j += hipblas_larf_threads)
+                {
+                    T s{};
+                    for(int p = j; p < i; p++)
+                        s = hipblas_larf_fma(Tb[j + p * problem.ldt], g[p], s);
+                    Tb[j + i * problem.ldt] = hipblas_larf_sub(T{}, hipblas_larf_mul(f, s));
+                }
+                __syncthreads();
+            }
+        }
+    }
+
+    struct hipblas_larfb_problem
+    {
+        bool          left;
+        bool          trans;
+        int           m;
+        int           n;
+        int           k;
+        const void*   V;
+        int64_t       ldv;
+        hipblasStride stride_v;
+        const void*   T;
+        int64_t       ldt;
+        hipblasStride stride_t;
+        void*         A;
+        int64_t       lda;
+        hipblasStride stride_a;
+        bool          batched;
+        int64_t       batch_count;
+    };
+
+    // Element r of reflector l of V, with the implied one and zeros
+    template <typename T>
+    __device__ inline T hipblas_larf_v(const T* V, int64_t ldv, int64_t r, int l)
+    {
+        if(r < l)
+            return T{};
+        if(r == l)
+            return hipblas_larf_make<T>(1, 0);
+        return V[r + l * ldv];
+    }
+
+    // One column, or row, of A per block. For up to 256 reflectors at a time, the threads are
+    // split into groups with a thread per reflector, each group summing the products of every few
+    // elements, and the sums of the groups are then added up.
+    template <typename T>
+    __global__ void __launch_bounds__(hipblas_larf_threads)
+        hipblasLarfbKernel(hipblas_larfb_problem problem)
+    {
+        __shared__ T red[hipblas_larf_threads];
+        __shared__ T w[hipblas_larf_max_k];
+        __shared__ T z[hipblas_larf_max_k];
+
+        const int     t      = threadIdx.x;
+        const int     k      = problem.k;
+        const int64_t length = problem.left ? problem.m : problem.n;
+        const int64_t count  = problem.left ? problem.n : problem.m;
+        const int64_t inc    = problem.left ? 1 : problem.lda;
+
+        // a row is applied as the conjugate column, with H^H in place of H
+        const bool conj  = !problem.left;
+        const bool trans = problem.left ? problem.trans : !problem.trans;
+
+        for(int64_t e = blockIdx.x; e < count * problem.batch_count; e += gridDim.x)
+        {
+            int64_t  b = e / count, c = e % count;
+            const T* V
+                = hipblas_larf_batch<const T>(problem.V, problem.stride_v, problem.batched, b);
+            const T* Tb
+                = hipblas_larf_batch<const T>(problem.T, problem.stride_t, problem.batched, b);
+            T* a = hipblas_larf_batch<T>(problem.A, problem.stride_a, problem.batched, b)
+                   + (problem.left ? c * problem.lda : c);
+
+            // w = V^H * a
+            for(int l0 = 0; l0 < k; l0 += hipblas_larf_threads)
+            {
+                int kk     = std::min(k - l0, hipblas_larf_threads);
+                int groups = hipblas_larf_threads / kk;
+                int l = l0 + t % kk, group = t / kk;
+
+                if(group < groups)
+                {
+                    // the first element of the group from row l on, above which V is zero
+                    int64_t r0 = group;
+                    if(r0 < l)
+                        r0 += (l - group + groups - 1) / groups * groups;
+
+                    T s{};
+                    for(int64_t r = r0; r < length; r += groups)
+                    {
+                        T y = a[r * inc];
+                        T v = hipblas_larf_v(V, problem.ldv, r, l);
+                        s   = hipblas_larf_fma(
+                            hipblas_device_conj(v), conj ? hipblas_device_conj(y) : y, s);
+                    }
+                    red[t] = s;
+                }
+                __syncthreads();
+                if(t < kk)
+                {
+                    T s = red[t];
+                    for(int g = 1; g < groups; g++)
+                        s = hipblas_larf_add(s, red[t + g * kk]);
+                    w[l0 + t] = s;
+                }
+                __syncthreads();
+            }
+
+            // z = op(T) * w
+            for(int l = t; l < k; l += hipblas_larf_threads)
+            {
+                T s{};
+                if(trans)
+                {
+                    for(int p = 0; p <= l; p++)
+                        s = hipblas_larf_fma(hipblas_device_conj(Tb[p + l * problem.ldt]), w[p], s);
+                }
+                else
+                {
+                    for(int p = l; p < k; p++)
+                        s = hipblas_larf_fma(Tb[l + p * problem.ldt], w[p], s);
+                }
+                z[l] = s;
+            }
+            __syncthreads();
+
+            // a -= V * z
+            for(int64_t r = t; r < length; r += hipblas_larf_threads)
+            {
+                T y = a[r * inc];
+                if(conj)
+                    y = hipblas_device_conj(y);
+
+                T s{};
+                for(int l = 0; l < k && l <= r; l++)
+                    s = hipblas_larf_fma(hipblas_larf_v(V, problem.ldv, r, l), z[l], s);
+                y = hipblas_larf_sub(y, s);
+
+                a[r * inc] = conj ? hipblas_device_conj(y) : y;
+            }
+
+            // the shared memory is reused by the next column of the batch
+            __syncthreads();
+        }
+    }
+
+    hipblasStatus_t hipblas_larf_launched()
+    {
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    int hipblas_larf_blocks(int64_t problems)
+    {
+        return int(std::min<int64_t>(problems, 65535));
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblas_larfg(hipblasHandle_t handle,
+                                  int64_t         n,
+                                  void*           alpha,
+                                  hipblasStride   stride_alpha,
+                                  void*           x,
+                                  int64_t         incx,
+                                  hipblasStride   stride_x,
+                                  void*           tau,
+                                  hipblasStride   stride_tau,
+                                  int64_t         batch_count,
+                                  bool            batched)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(n < 0 || incx <= 0 || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !tau || (n > 1 && !x))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipblas_larfg_problem problem;
+        problem.n            = n;
+        problem.alpha        = alpha;
+        problem.stride_alpha = stride_alpha;
+        problem.x            = x;
+        problem.incx         = incx;
+        problem.stride_x     = stride_x;
+        problem.tau          = tau;
+        problem.stride_tau   = stride_tau;
+        problem.batched      = batched;
+        problem.batch_count  = batch_count;
+        hipblasLarfgKernel<T>
+            <<<hipblas_larf_blocks(batch_count), hipblas_larf_threads, 0, stream>>>(problem);
+        return hipblas_larf_launched();
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblas_larft(hipblasHandle_t handle,
+                                  int64_t         n,
+                                  int64_t         k,
+                                  const void*     V,
+                                  int64_t         ldv,
+                                  hipblasStride   stride_v,
+                                  const void*     tau,
+                                  hipblasStride   stride_tau,
+                                  void*           Tm,
+                                  int64_t         ldt,
+                                  hipblasStride   stride_t,
+                                  int64_t         batch_count,
+                                  bool            batched)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(k < 0 || k > n || k > hipblas_larf_max_k || ldv < std::max<int64_t>(n, 1)
+           || ldt < std::max<int64_t>(k, 1) || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!k || !batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!V || !tau || !Tm)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipblas_larft_problem problem;
+        problem.n           = int(n);
+        problem.k           = int(k);
+        problem.V           = V;
+        problem.ldv         = ldv;
+        problem.stride_v    = stride_v;
+        problem.tau         = tau;
+        problem.stride_tau  = stride_tau;
+        problem.T           = Tm;
+        problem.ldt         = ldt;
+        problem.stride_t    = stride_t;
+        problem.batched     = batched;
+        problem.batch_count = batch_count;
+        hipblasLarftKernel<T>
+            <<<hipblas_larf_blocks(batch_count), hipblas_larf_threads, 0, stream>>>(problem);
+        return hipblas_larf_launched();
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblas_larfb(hipblasHandle_t    handle,
+                                  hipblasSideMode_t  side,
+                                  hipblasOperation_t trans,
+                                  int64_t            m,
+                                  int64_t            n,
+                                  int64_t            k,
+                                  const void*        V,
+                                  int64_t            ldv,
+                                  hipblasStride      stride_v,
+                                  const void*        Tm,
+                                  int64_t            ldt,
+                                  hipblasStride      stride_t,
+                                  void*              A,
+                                  int64_t            lda,
+                                  hipblasStride      stride_a,
+                                  int64_t            batch_count,
+                                  bool               batched)
+    {
+        // the real types take H^T as well as H^H, which is the same for them
+        constexpr bool real = std::is_arithmetic_v<T>;
+
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C && (!real || trans != HIPBLAS_OP_T))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+        int64_t order = side == HIPBLAS_SIDE_LEFT ? m : n;
+        if(m < 0 || n < 0 || k < 0 || k > order || k > hipblas_larf_max_k
+           || ldv < std::max<int64_t>(order, 1) || ldt < std::max<int64_t>(k, 1)
+           || lda < std::max<int64_t>(m, 1) || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!m || !n || !k || !batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!V || !Tm || !A)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipblas_larfb_problem problem;
+        problem.left        = side == HIPBLAS_SIDE_LEFT;
+        problem.trans       = trans != HIPBLAS_OP_N;
+        problem.m           = int(m);
+        problem.n           = int(n);
+        problem.k           = int(k);
+        problem.V           = V;
+        problem.ldv         = ldv;
+        problem.stride_v    = stride_v;
+        problem.T           = Tm;
+        problem.ldt         = ldt;
+        problem.stride_t    = stride_t;
+        problem.A           = A;
+        problem.lda         = lda;
+        problem.stride_a    = stride_a;
+        problem.batched     = batched;
+        problem.batch_count = batch_count;
+
+        int64_t vectors = (problem.left ? n : m) * batch_count;
+        hipblasLarfbKernel<T>
+            <<<hipblas_larf_blocks(vectors), hipblas_larf_threads, 0, stream>>>(problem);
+        return hipblas_larf_launched();
+    }
+}
+
+extern "C" hipblasStatus_t hipblasSlarfgBatched(hipblasHandle_t handle,
+                                                const int       n,
+                                                float* const    alpha[],
+                                                float* const    x[],
+                                                const int       incx,
+                                                float* const    tau[],
+                                                const int       batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+
+    return hipblas_larfg<float>(
+        handle, n, (void*)alpha, 0, (void*)x, incx, 0, (void*)tau, 0, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDlarfgBatched(hipblasHandle_t handle,
+                                                const int       n,
+                                                double* const   alpha[],
+                                                double* const   x[],
+                                                const int       incx,
+                                                double* const   tau[],
+                                                const int       batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+
+    return hipblas_larfg<double>(
+        handle, n, (void*)alpha, 0, (void*)x, incx, 0, (void*)tau, 0, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasClarfgBatched(hipblasHandle_t       handle,
+                                                const int             n,
+                                                hipblasComplex* const alpha[],
+                                                hipblasComplex* const x[],
+                                                const int             incx,
+                                                hipblasComplex* const tau[],
+                                                const int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+
+    return hipblas_larfg<hipFloatComplex>(
+        handle, n, (void*)alpha, 0, (void*)x, incx, 0, (void*)tau, 0, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZlarfgBatched(hipblasHandle_t             handle,
+                                                const int                   n,
+                                                hipblasDoubleComplex* const alpha[],
+                                                hipblasDoubleComplex* const x[],
+                                                const int                   incx,
+                                                hipblasDoubleComplex* const tau[],
+                                                const int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+
+    return hipblas_larfg<hipDoubleComplex>(
+        handle, n, (void*)alpha, 0, (void*)x, incx, 0, (void*)tau, 0, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasClarfgBatched_v2(hipblasHandle_t   handle,
+                                                   const int         n,
+                                                   hipComplex* const alpha[],
+                                                   hipComplex* const x[],
+                                                   const int         incx,
+                                                   hipComplex* const tau[],
+                                                   const int         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+
+    return hipblas_larfg<hipFloatComplex>(
+        handle, n, (void*)alpha, 0, (void*)x, incx, 0, (void*)tau, 0, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZlarfgBatched_v2(hipblasHandle_t         handle,
+                                                   const int               n,
+                                                   hipDoubleComplex* const alpha[],
+                                                   hipDoubleComplex* const x[],
+                                                   const int               incx,
+                                                   hipDoubleComplex* const tau[],
+                                                   const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+
+    return hipblas_larfg<hipDoubleComplex>(
+        handle, n, (void*)alpha, 0, (void*)x, incx, 0, (void*)tau, 0, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasSlarfgStridedBatched(hipblasHandle_t     handle,
+                                                       const int           n,
+                                                       float*              alpha,
+                                                       const hipblasStride strideAlpha,
+                                                       float*              x,
+                                                       const int           incx,
+                                                       const hipblasStride stridex,
+                                                       float*              tau,
+                                                       const hipblasStride strideTau,
+                                                       const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, strideAlpha, stridex, strideTau, batchCount);
+
+    return hipblas_larfg<float>(
+        handle, n, alpha, strideAlpha, x, incx, stridex, tau, strideTau, batchCount, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDlarfgStridedBatched(hipblasHandle_t     handle,
+                                                       const int           n,
+                                                       double*             alpha,
+                                                       const hipblasStride strideAlpha,
+                                                       double*             x,
+                                                       const int           incx,
+                                                       const hipblasStride stridex,
+                                                       double*             tau,
+                                                       const hipblasStride strideTau,
+                                                       const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, strideAlpha, stridex, strideTau, batchCount);
+
+    return hipblas_larfg<double>(
+        handle, n, alpha, strideAlpha, x, incx, stridex, tau, strideTau, batchCount, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasClarfgStridedBatched(hipblasHandle_t     handle,
+                                                       const int           n,
+                                                       hipblasComplex*     alpha,
+                                                       const hipblasStride strideAlpha,
+                                                       hipblasComplex*     x,
+                                                       const int           incx,
+                                                       const hipblasStride stridex,
+                                                       hipblasComplex*     tau,
+                                                       const hipblasStride strideTau,
+                                                       const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, strideAlpha, stridex, strideTau, batchCount);
+
+    return hipblas_larfg<hipFloatComplex>(
+        handle, n, alpha, strideAlpha, x, incx, stridex, tau, strideTau, batchCount, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZlarfgStridedBatched(hipblasHandle_t       handle,
+                                                       const int             n,
+                                                       hipblasDoubleComplex* alpha,
+                                                       const hipblasStride   strideAlpha,
+                                                       hipblasDoubleComplex* x,
+                                                       const int             incx,
+                                                       const hipblasStride   stridex,
+                                                       hipblasDoubleComplex* tau,
+                                                       const hipblasStride   strideTau,
+                                                       const int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, strideAlpha, stridex, strideTau, batchCount);
+
+    return hipblas_larfg<hipDoubleComplex>(
+        handle, n, alpha, strideAlpha, x, incx, stridex, tau, strideTau, batchCount, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasClarfgStridedBatched_v2(hipblasHandle_t     handle,
+                                                          const int           n,
+                                                          hipComplex*         alpha,
+                                                          const hipblasStride strideAlpha,
+                                                          hipComplex*         x,
+                                                          const int           incx,
+                                                          const hipblasStride stridex,
+                                                          hipComplex*         tau,
+                                                          const hipblasStride strideTau,
+                                                          const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, strideAlpha, stridex, strideTau, batchCount);
+
+    return hipblas_larfg<hipFloatComplex>(
+        handle, n, alpha, strideAlpha, x, incx, stridex, tau, strideTau, batchCount, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZlarfgStridedBatched_v2(hipblasHandle_t     handle,
+                                                          const int           n,
+                                                          hipDoubleComplex*   alpha,
+                                                          const hipblasStride strideAlpha,
+                                                          hipDoubleComplex*   x,
+                                                          const int           incx,
+                                                          const hipblasStride stridex,
+                                                          hipDoubleComplex*   tau,
+                                                          const hipblasStride strideTau,
+                                                          const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, strideAlpha, stridex, strideTau, batchCount);
+
+    return hipblas_larfg<hipDoubleComplex>(
+        handle, n, alpha, strideAlpha, x, incx, stridex, tau, strideTau, batchCount, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasSlarftBatched(hipblasHandle_t    handle,
+                                                const int          n,
+                                                const int          k,
+                                                const float* const V[],
+                                                const int          ldv,
+                                                const float* const tau[],
+                                                float* const       T[],
+                                                const int          ldt,
+                                                const int          batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, k, ldv, ldt, batchCount);
+
+    return hipblas_larft<float>(
+        handle, n, k, V, ldv, 0, tau, 0, (void*)T, ldt, 0, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDlarftBatched(hipblasHandle_t     handle,
+                                                const int           n,
+                                                const int           k,
+                                                const double* const V[],
+                                                const int           ldv,
+                                                const double* const tau[],
+                                                double* const       T[],
+                                                const int           ldt,
+                                                const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, k, ldv, ldt, batchCount);
+
+    return hipblas_larft<double>(
+        handle, n, k, V, ldv, 0, tau, 0, (void*)T, ldt, 0, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasClarftBatched(hipblasHandle_t             handle,
+                                                const int                   n,
+                                                const int                   k,
+                                                const hipblasComplex* const V[],
+                                                const int                   ldv,
+                                                const hipblasComplex* const tau[],
+                                                hipblasComplex* const       T[],
+                                                const int                   ldt,
+                                                const int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, k, ldv, ldt, batchCount);
+
+    return hipblas_larft<hipFloatComplex>(
+        handle, n, k, V, ldv, 0, tau, 0, (void*)T, ldt, 0, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZlarftBatched(hipblasHandle_t                   handle,
+                                                const int                         n,
+                                                const int                         k,
+                                                const hipblasDoubleComplex* const V[],
+                                                const int                         ldv,
+                                                const hipblasDoubleComplex* const tau[],
+                                                hipblasDoubleComplex* const       T[],
+                                                const int                         ldt,
+                                                const int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, k, ldv, ldt, batchCount);
+
+    return hipblas_larft<hipDoubleComplex>(
+        handle, n, k, V, ldv, 0, tau, 0, (void*)T, ldt, 0, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasClarftBatched_v2(hipblasHandle_t         handle,
+                                                   const int               n,
+                                                   const int               k,
+                                                   const hipComplex* const V[],
+                                                   const int               ldv,
+                                                   const hipComplex* const tau[],
+                                                   hipComplex* const       T[],
+                                                   const int               ldt,
+                                                   const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, k, ldv, ldt, batchCount);
+
+    return hipblas_larft<hipFloatComplex>(
+        handle, n, k, V, ldv, 0, tau, 0, (void*)T, ldt, 0, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZlarftBatched_v2(hipblasHandle_t               handle,
+                                                   const int                     n,
+                                                   const int                     k,
+                                                   const hipDoubleComplex* const V[],
+                                                   const int                     ldv,
+                                                   const hipDoubleComplex* const tau[],
+                                                   hipDoubleComplex* const       T[],
+                                                   const int                     ldt,
+                                                   const int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, k, ldv, ldt, batchCount);
+
+    return hipblas_larft<hipDoubleComplex>(
+        handle, n, k, V, ldv, 0, tau, 0, (void*)T, ldt, 0, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasSlarftStridedBatched(hipblasHandle_t     handle,
+                                                       const int           n,
+                                                       const int           k,
+                                                       const float*        V,
+                                                       const int           ldv,
+                                                       const hipblasStride strideV,
+                                                       const float*        tau,
+                                                       const hipblasStride strideTau,
+                                                       float*              T,
+                                                       const int           ldt,
+                                                       const hipblasStride strideT,
+                                                       const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, k, ldv, strideV, strideTau, ldt, strideT, batchCount);
+
+    return hipblas_larft<float>(
+        handle, n, k, V, ldv, strideV, tau, strideTau, T, ldt, strideT, batchCount, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDlarftStridedBatched(hipblasHandle_t     handle,
+                                                       const int           n,
+                                                       const int           k,
+                                                       const double*       V,
+                                                       const int           ldv,
+                                                       const hipblasStride strideV,
+                                                       const double*       tau,
+                                                       const hipblasStride strideTau,
+                                                       double*             T,
+                                                       const int           ldt,
+                                                       const hipblasStride strideT,
+                                                       const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, k, ldv, strideV, strideTau, ldt, strideT, batchCount);
+
+    return hipblas_larft<double>(
+        handle, n, k, V, ldv, strideV, tau, strideTau, T, ldt, strideT, batchCount, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasClarftStridedBatched(hipblasHandle_t       handle,
+                                                       const int             n,
+                                                       const int             k,
+                                                       const hipblasComplex* V,
+                                                       const int             ldv,
+                                                       const hipblasStride   strideV,
+                                                       const hipblasComplex* tau,
+                                                       const hipblasStride   strideTau,
+                                                       hipblasComplex*       T,
+                                                       const int             ldt,
+                                                       const hipblasStride   strideT,
+                                                       const int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, k, ldv, strideV, strideTau, ldt, strideT, batchCount);
+
+    return hipblas_larft<hipFloatComplex>(
+        handle, n, k, V, ldv, strideV, tau, strideTau, T, ldt, strideT, batchCount, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZlarftStridedBatched(hipblasHandle_t             handle,
+                                                       const int                   n,
+                                                       const int                   k,
+                                                       const hipblasDoubleComplex* V,
+                                                       const int                   ldv,
+                                                       const hipblasStride         strideV,
+                                                       const hipblasDoubleComplex* tau,
+                                                       const hipblasStride         strideTau,
+                                                       hipblasDoubleComplex*       T,
+                                                       const int                   ldt,
+                                                       const hipblasStride         strideT,
+                                                       const int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, k, ldv, strideV, strideTau, ldt, strideT, batchCount);
+
+    return hipblas_larft<hipDoubleComplex>(
+        handle, n, k, V, ldv, strideV, tau, strideTau, T, ldt, strideT, batchCount, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasClarftStridedBatched_v2(hipblasHandle_t     handle,
+                                                          const int           n,
+                                                          const int           k,
+                                                          const hipComplex*   V,
+                                                          const int           ldv,
+                                                          const hipblasStride strideV,
+                                                          const hipComplex*   tau,
+                                                          const hipblasStride strideTau,
+                                                          hipComplex*         T,
+                                                          const int           ldt,
+                                                          const hipblasStride strideT,
+                                                          const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, k, ldv, strideV, strideTau, ldt, strideT, batchCount);
+
+    return hipblas_larft<hipFloatComplex>(
+        handle, n, k, V, ldv, strideV, tau, strideTau, T, ldt, strideT, batchCount, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZlarftStridedBatched_v2(hipblasHandle_t         handle,
+                                                          const int               n,
+                                                          const int               k,
+                                                          const hipDoubleComplex* V,
+                                                          const int               ldv,
+                                                          const hipblasStride     strideV,
+                                                          const hipDoubleComplex* tau,
+                                                          const hipblasStride     strideTau,
+                                                          hipDoubleComplex*       T,
+                                                          const int               ldt,
+                                                          const hipblasStride     strideT,
+                                                          const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, k, ldv, strideV, strideTau, ldt, strideT, batchCount);
+
+    return hipblas_larft<hipDoubleComplex>(
+        handle, n, k, V, ldv, strideV, tau, strideTau, T, ldt, strideT, batchCount, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasSlarfbBatched(hipblasHandle_t    handle,
+                                                hipblasSideMode_t  side,
+                                                hipblasOperation_t trans,
+                                                const int          m,
+                                                const int          n,
+                                                const int          k,
+                                                const float* const V[],
+                                                const int          ldv,
+                                                const float* const T[],
+                                                const int          ldt,
+                                                float* const       A[],
+                                                const int          lda,
+                                                const int          batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, side, trans, m, n, k, ldv, ldt, lda, batchCount);
+
+    return hipblas_larfb<float>(
+        handle, side, trans, m, n, k, V, ldv, 0, T, ldt, 0, (void*)A, lda, 0, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDlarfbBatched(hipblasHandle_t     handle,
+                                                hipblasSideMode_t   side,
+                                                hipblasOperation_t  trans,
+                                                const int           m,
+                                                const int           n,
+                                                const int           k,
+                                                const double* const V[],
+                                                const int           ldv,
+                                                const double* const T[],
+                                                const int           ldt,
+                                                double* const       A[],
+                                                const int           lda,
+                                                const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, side, trans, m, n, k, ldv, ldt, lda, batchCount);
+
+    return hipblas_larfb<double>(
+        handle, side, trans, m, n, k, V, ldv, 0, T, ldt, 0, (void*)A, lda, 0, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasClarfbBatched(hipblasHandle_t             handle,
+                                                hipblasSideMode_t           side,
+                                                hipblasOperation_t          trans,
+                                                const int                   m,
+                                                const int                   n,
+                                                const int                   k,
+                                                const hipblasComplex* const V[],
+                                                const int                   ldv,
+                                                const hipblasComplex* const T[],
+                                                const int                   ldt,
+                                                hipblasComplex* const       A[],
+                                                const int                   lda,
+                                                const int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, side, trans, m, n, k, ldv, ldt, lda, batchCount);
+
+    return hipblas_larfb<hipFloatComplex>(
+        handle, side, trans, m, n, k, V, ldv, 0, T, ldt, 0, (void*)A, lda, 0, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZlarfbBatched(hipblasHandle_t                   handle,
+                                                hipblasSideMode_t                 side,
+                                                hipblasOperation_t                trans,
+                                                const int                         m,
+                                                const int                         n,
+                                                const int                         k,
+                                                const hipblasDoubleComplex* const V[],
+                                                const int                         ldv,
+                                                const hipblasDoubleComplex* const T[],
+                                                const int                         ldt,
+                                                hipblasDoubleComplex* const       A[],
+                                                const int                         lda,
+                                                const int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, side, trans, m, n, k, ldv, ldt, lda, batchCount);
+
+    return hipblas_larfb<hipDoubleComplex>(
+        handle, side, trans, m, n, k, V, ldv, 0, T, ldt, 0, (void*)A, lda, 0, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasClarfbBatched_v2(hipblasHandle_t         handle,
+                                                   hipblasSideMode_t       side,
+                                                   hipblasOperation_t      trans,
+                                                   const int               m,
+                                                   const int               n,
+                                                   const int               k,
+                                                   const hipComplex* const V[],
+                                                   const int               ldv,
+                                                   const hipComplex* const T[],
+                                                   const int               ldt,
+                                                   hipComplex* const       A[],
+                                                   const int               lda,
+                                                   const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, side, trans, m, n, k, ldv, ldt, lda, batchCount);
+
+    return hipblas_larfb<hipFloatComplex>(
+        handle, side, trans, m, n, k, V, ldv, 0, T, ldt, 0, (void*)A, lda, 0, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZlarfbBatched_v2(hipblasHandle_t               handle,
+                                                   hipblasSideMode_t             side,
+                                                   hipblasOperation_t            trans,
+                                                   const int                     m,
+                                                   const int                     n,
+                                                   const int                     k,
+                                                   const hipDoubleComplex* const V[],
+                                                   const int                     ldv,
+                                                   const hipDoubleComplex* const T[],
+                                                   const int                     ldt,
+                                                   hipDoubleComplex* const       A[],
+                                                   const int                     lda,
+                                                   const int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, side, trans, m, n, k, ldv, ldt, lda, batchCount);
+
+    return hipblas_larfb<hipDoubleComplex>(
+        handle, side, trans, m, n, k, V, ldv, 0, T, ldt, 0, (void*)A, lda, 0, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasSlarfbStridedBatched(hipblasHandle_t     handle,
+                                                       hipblasSideMode_t   side,
+                                                       hipblasOperation_t  trans,
+                                                       const int           m,
+                                                       const int           n,
+                                                       const int           k,
+                                                       const float*        V,
+                                                       const int           ldv,
+                                                       const hipblasStride strideV,
+                                                       const float*        T,
+                                                       const int           ldt,
+                                                       const hipblasStride strideT,
+                                                       float*              A,
+                                                       const int           lda,
+                                                       const hipblasStride strideA,
+                                                       const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, side, trans, m, n, k, ldv, strideV, ldt, strideT, lda, strideA, batchCount);
+
+    return hipblas_larfb<float>(handle,
+                                side,
+                                trans,
+                                m,
+                                n,
+                                k,
+                                V,
+                                ldv,
+                                strideV,
+                                T,
+                                ldt,
+                                strideT,
+                                A,
+                                lda,
+                                strideA,
+                                batchCount,
+                                false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDlarfbStridedBatched(hipblasHandle_t     handle,
+                                                       hipblasSideMode_t   side,
+                                                       hipblasOperation_t  trans,
+                                                       const int           m,
+                                                       const int           n,
+                                                       const int           k,
+                                                       const double*       V,
+                                                       const int           ldv,
+                                                       const hipblasStride strideV,
+                                                       const double*       T,
+                                                       const int           ldt,
+                                                       const hipblasStride strideT,
+                                                       double*             A,
+                                                       const int           lda,
+                                                       const hipblasStride strideA,
+                                                       const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, side, trans, m, n, k, ldv, strideV, ldt, strideT, lda, strideA, batchCount);
+
+    return hipblas_larfb<double>(handle,
+                                 side,
+                                 trans,
+                                 m,
+                                 n,
+                                 k,
+                                 V,
+                                 ldv,
+                                 strideV,
+                                 T,
+                                 ldt,
+                                 strideT,
+                                 A,
+                                 lda,
+                                 strideA,
+                                 batchCount,
+                                 false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasClarfbStridedBatched(hipblasHandle_t       handle,
+                                                       hipblasSideMode_t     side,
+                                                       hipblasOperation_t    trans,
+                                                       const int             m,
+                                                       const int             n,
+                                                       const int             k,
+                                                       const hipblasComplex* V,
+                                                       const int             ldv,
+                                                       const hipblasStride   strideV,
+                                                       const hipblasComplex* T,
+                                                       const int             ldt,
+                                                       const hipblasStride   strideT,
+                                                       hipblasComplex*       A,
+                                                       const int             lda,
+                                                       const hipblasStride   strideA,
+                                                       const int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, side, trans, m, n, k, ldv, strideV, ldt, strideT, lda, strideA, batchCount);
+
+    return hipblas_larfb<hipFloatComplex>(handle,
+                                          side,
+                                          trans,
+                                          m,
+                                          n,
+                                          k,
+                                          V,
+                                          ldv,
+                                          strideV,
+                                          T,
+                                          ldt,
+                                          strideT,
+                                          A,
+                                          lda,
+                                          strideA,
+                                          batchCount,
+                                          false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZlarfbStridedBatched(hipblasHandle_t             handle,
+                                                       hipblasSideMode_t           side,
+                                                       hipblasOperation_t          trans,
+                                                       const int                   m,
+                                                       const int                   n,
+                                                       const int                   k,
+                                                       const hipblasDoubleComplex* V,
+                                                       const int                   ldv,
+                                                       const hipblasStride         strideV,
+                                                       const hipblasDoubleComplex* T,
+                                                       const int                   ldt,
+                                                       const hipblasStride         strideT,
+                                                       hipblasDoubleComplex*       A,
+                                                       const int                   lda,
+                                                       const hipblasStride         strideA,
+                                                       const int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, side, trans, m, n, k, ldv, strideV, ldt, strideT, lda, strideA, batchCount);
+
+    return hipblas_larfb<hipDoubleComplex>(handle,
+                                           side,
+                                           trans,
+                                           m,
+                                           n,
+                                           k,
+                                           V,
+                                           ldv,
+                                           strideV,
+                                           T,
+                                           ldt,
+                                           strideT,
+                                           A,
+                                           lda,
+                                           strideA,
+                                           batchCount,
+                                           false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasClarfbStridedBatched_v2(hipblasHandle_t     handle,
+                                                          hipblasSideMode_t   side,
+                                                          hipblasOperation_t  trans,
+                                                          const int           m,
+                                                          const int           n,
+                                                          const int           k,
+                                                          const hipComplex*   V,
+                                                          const int           ldv,
+                                                          const hipblasStride strideV,
+                                                          const hipComplex*   T,
+                                                          const int           ldt,
+                                                          const hipblasStride strideT,
+                                                          hipComplex*         A,
+                                                          const int           lda,
+                                                          const hipblasStride strideA,
+                                                          const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, side, trans, m, n, k, ldv, strideV, ldt, strideT, lda, strideA, batchCount);
+
+    return hipblas_larfb<hipFloatComplex>(handle,
+                                          side,
+                                          trans,
+                                          m,
+                                          n,
+                                          k,
+                                          V,
+                                          ldv,
+                                          strideV,
+                                          T,
+                                          ldt,
+                                          strideT,
+                                          A,
+                                          lda,
+                                          strideA,
+                                          batchCount,
+                                          false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZlarfbStridedBatched_v2(hipblasHandle_t         handle,
+                                                          hipblasSideMode_t       side,
+                                                          hipblasOperation_t      trans,
+                                                          const int               m,
+                                                          const int               n,
+                                                          const int               k,
+                                                          const hipDoubleComplex* V,
+                                                          const int               ldv,
+                                                          const hipblasStride     strideV,
+                                                          const hipDoubleComplex* T,
+                                                          const int               ldt,
+                                                          const hipblasStride     strideT,
+                                                          hipDoubleComplex*       A,
+                                                          const int               lda,
+                                                          const hipblasStride     strideA,
+                                                          const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, side, trans, m, n, k, ldv, strideV, ldt, strideT, lda, strideA, batchCount);
+
+    return hipblas_larfb<hipDoubleComplex>(handle,
+                                           side,
+                                           trans,
+                                           m,
+                                           n,
+                                           k,
+                                           V,
+                                           ldv,
+                                           strideV,
+                                           T,
+                                           ldt,
+                                           strideT,
+                                           A,
+                                           lda,
+                                           strideA,
+                                           batchCount,
+                                           false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
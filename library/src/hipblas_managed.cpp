@@ -0,0 +1,197 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_runtime_api.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iterator>
+#include <map>
+
+#include "hipblas_handle_state.hpp"
+#include "hipblas_managed.hpp"
+
+namespace
+{
+    // True if p is in managed memory, or in pageable host memory that device can access
+    // through HMM
+    bool hipblas_is_prefetchable(const void* p, int device)
+    {
+        hipPointerAttribute_t attr;
+        if(hipPointerGetAttributes(&attr, p) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            attr.type = hipMemoryTypeUnregistered;
+        }
+        if(attr.type == hipMemoryTypeManaged)
+            return true;
+        if(attr.type != hipMemoryTypeUnregistered)
+            return false;
+
+        int pageable = 0;
+        if(hipDeviceGetAttribute(&pageable, hipDeviceAttributePageableMemoryAccess, device)
+           != hipSuccess)
+        {
+            (void)hipGetLastError();
+            return false;
+        }
+        return pageable != 0;
+    }
+
+    // Prefetches the bytes at p to the current device on the stream of handle, unless they are
+    // in a range handle already prefetched. The ranges are merged as they are added.
+    void hipblas_prefetch(hipblasHandle_t handle, const void* p, size_t bytes)
+    {
+        if(!p || !bytes)
+            return;
+
+        std::map<uintptr_t, uintptr_t>& ranges = hipblasGetHandleState(handle)->managed_prefetched;
+
+        uintptr_t begin = reinterpret_cast<uintptr_t>(p);
+        uintptr_t end   = begin + bytes;
+        auto      next  = ranges.upper_bound(begin);
+        if(next != ranges.begin() && std::prev(next)->second >= end)
+            return;
+
+        int         device;
+        hipStream_t stream;
+        if(hipGetDevice(&device) != hipSuccess
+           || hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS
+           || !hipblas_is_prefetchable(p, device))
+            return;
+
+        if(hipMemAdvise(p, bytes, hipMemAdviseSetPreferredLocation, device) != hipSuccess
+           || hipMemPrefetchAsync(p, bytes, device, stream) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            return;
+        }
+
+        if(next != ranges.begin() && std::prev(next)->second >= begin)
+        {
+            --next;
+            begin = next->first;
+            end   = std::max(end, next->second);
+            next  = ranges.erase(next);
+        }
+        while(next != ranges.end() && next->first <= end)
+        {
+            end  = std::max(end, next->second);
+            next = ranges.erase(next);
+        }
+        ranges[begin] = end;
+    }
+
+    // The bytes spanned by batch_count column major rows x cols matrices stride elements apart
+    size_t hipblas_matrix_span(
+        int64_t rows, int64_t cols, int64_t ld, int64_t stride, int64_t batch_count, size_t size)
+    {
+        if(rows <= 0 || cols <= 0 || batch_count <= 0)
+            return 0;
+        return size_t((cols - 1) * ld + rows + (batch_count - 1) * std::max(stride, int64_t(0)))
+               * size;
+    }
+}
+
+void hipblasPrefetchGemm(hipblasHandle_t    handle,
+                         hipblasOperation_t transA,
+                         hipblasOperation_t transB,
+                         int64_t            m,
+                         int64_t            n,
+                         int64_t            k,
+                         const void*        A,
+                         int64_t            lda,
+                         int64_t            strideA,
+                         const void*        B,
+                         int64_t            ldb,
+                         int64_t            strideB,
+                         const void*        C,
+                         int64_t            ldc,
+                         int64_t            strideC,
+                         int64_t            batchCount,
+                         size_t             aSize,
+                         size_t             bSize,
+                         size_t             cSize)
+{
+    if(!hipblasIsManagedPrefetch(handle))
+        return;
+
+    bool a_n = transA == HIPBLAS_OP_N;
+    bool b_n = transB == HIPBLAS_OP_N;
+    hipblas_prefetch(handle,
+                     A,
+                     hipblas_matrix_span(a_n ? m : k, a_n ? k : m, lda, strideA, batchCount, aSize));
+    hipblas_prefetch(handle,
+                     B,
+                     hipblas_matrix_span(b_n ? k : n, b_n ? n : k, ldb, strideB, batchCount, bSize));
+    hipblas_prefetch(handle, C, hipblas_matrix_span(m, n, ldc, strideC, batchCount, cSize));
+}
+
+void hipblasPrefetchGemv(hipblasHandle_t    handle,
+                         hipblasOperation_t trans,
+                         int64_t            m,
+                         int64_t            n,
+                         const void*        A,
+                         int64_t            lda,
+                         const void*        x,
+                         int64_t            incx,
+                         const void*        y,
+                         int64_t            incy,
+                         size_t             elemSize)
+{
+    if(!hipblasIsManagedPrefetch(handle))
+        return;
+
+    int64_t x_n = trans == HIPBLAS_OP_N ? n : m;
+    int64_t y_n = trans == HIPBLAS_OP_N ? m : n;
+    hipblas_prefetch(handle, A, hipblas_matrix_span(m, n, lda, 0, 1, elemSize));
+    hipblas_prefetch(handle, x, hipblas_matrix_span(1, x_n, std::abs(incx), 0, 1, elemSize));
+    hipblas_prefetch(handle, y, hipblas_matrix_span(1, y_n, std::abs(incy), 0, 1, elemSize));
+}
+
+size_t hipblasPrefetchTypeSize(hipDataType type)
+{
+    switch(type)
+    {
+    case HIP_R_8I:
+    case HIP_R_8U:
+    case HIP_R_8F_E4M3_FNUZ:
+    case HIP_R_8F_E5M2_FNUZ:
+        return 1;
+    case HIP_R_16F:
+    case HIP_R_16BF:
+    case HIP_C_8I:
+        return 2;
+    case HIP_R_32I:
+    case HIP_R_32F:
+        return 4;
+    case HIP_R_64F:
+    case HIP_C_32F:
+        return 8;
+    case HIP_C_64F:
+        return 16;
+    default:
+        return 0;
+    }
+}
@@ -0,0 +1,1328 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_entry.hpp"
+
+// The matrix copies of omatcopy, imatcopy and lacpy, which neither backend has, so they are a
+// kernel of hipBLAS for both. A block moves a tile of 32 by 32 elements of B with 32 by 8
+// threads. A transposed tile is staged through shared memory, padded against bank conflicts, so
+// that both the loads from A and the stores to B are coalesced.
+//
+// imatcopy transposes a square matrix in place by swapping the pairs of tiles across the
+// diagonal, each pair by one block that holds both tiles in shared memory, so no second matrix
+// is needed. The other in-place transposes, whose elements follow permutation cycles that don't
+// map well on tiles, are staged through the workspace of the handle instead.
+
+namespace
+{
+    constexpr int hipblas_matcopy_tile = 32;
+    constexpr int hipblas_matcopy_rows = 8;
+
+    // alpha * x
+    template <typename T>
+    __device__ inline T hipblas_matcopy_scale(T alpha, T x)
+    {
+        return alpha * x;
+    }
+
+    __device__ inline hipFloatComplex hipblas_matcopy_scale(hipFloatComplex alpha,
+                                                            hipFloatComplex x)
+    {
+        return hipCmulf(alpha, x);
+    }
+
+    __device__ inline hipDoubleComplex hipblas_matcopy_scale(hipDoubleComplex alpha,
+                                                             hipDoubleComplex x)
+    {
+        return hipCmul(alpha, x);
+    }
+
+    // B_b := alpha * op(A_b), for B_b of rows by cols elements, restricted to the upper or the
+    // lower triangle of B_b unless uplo is HIPBLAS_FILL_MODE_FULL. A and B are arrays of
+    // pointers when batched. alpha isn't applied unless scale, so that plain copies are exact.
+    struct hipblas_matcopy_problem
+    {
+        int64_t            rows;
+        int64_t            cols;
+        hipblasOperation_t trans;
+        hipblasFillMode_t  uplo;
+        bool               scale;
+        bool               batched;
+        const void*        A;
+        int64_t            lda;
+        hipblasStride      stride_a;
+        void*              B;
+        int64_t            ldb;
+        hipblasStride      stride_b;
+        int                batch_count;
+    };
+
+    template <typename T>
+    __device__ inline T* hipblas_matcopy_matrix(void* A, hipblasStride stride, bool batched, int b)
+    {
+        if(batched)
+            return static_cast<T* const*>(A)[b];
+        return static_cast<T*>(A) + b * stride;
+    }
+
+    template <typename T>
+    __device__ inline T hipblas_matcopy_op(T x, hipblasOperation_t trans, T alpha, bool scale)
+    {
+        if(trans == HIPBLAS_OP_C)
+            x = hipblas_device_conj(x);
+        return scale ? hipblas_matcopy_scale(alpha, x) : x;
+    }
+
+    template <typename T>
+    __global__ void
+        hipblasMatcopyKernel(hipblas_matcopy_problem problem, const T* alpha, T alpha_value)
+    {
+        __shared__ T tile[hipblas_matcopy_tile][hipblas_matcopy_tile + 1];
+
+        T       a     = alpha ? *alpha : alpha_value;
+        int     tx    = threadIdx.x;
+        int     ty    = threadIdx.y;
+        int64_t i0    = int64_t(blockIdx.x) * hipblas_matcopy_tile;
+        bool    upper = problem.uplo == HIPBLAS_FILL_MODE_UPPER;
+        bool    lower = problem.uplo == HIPBLAS_FILL_MODE_LOWER;
+
+        for(int b = blockIdx.z; b < problem.batch_count; b += gridDim.z)
+        {
+            const T* A = hipblas_matcopy_matrix<T>(
+                const_cast<void*>(problem.A), problem.stride_a, problem.batched, b);
+            T* B = hipblas_matcopy_matrix<T>(problem.B, problem.stride_b, problem.batched, b);
+
+            for(int64_t j0 = int64_t(blockIdx.y) * hipblas_matcopy_tile; j0 < problem.cols;
+                j0 += int64_t(gridDim.y) * hipblas_matcopy_tile)
+            {
+                if(problem.trans == HIPBLAS_OP_N)
+                {
+                    int64_t i = i0 + tx;
+                    for(int r = ty; r < hipblas_matcopy_tile; r += hipblas_matcopy_rows)
+                    {
+                        int64_t j = j0 + r;
+                        if(i < problem.rows && j < problem.cols && !(upper && i > j)
+                           && !(lower && i < j))
+                            B[i + j * problem.ldb] = hipblas_matcopy_op(
+                                A[i + j * problem.lda], problem.trans, a, problem.scale);
+                    }
+                    continue;
+                }
+
+                // B(i, j) is A(j, i): the tile is read along the columns of A and written along
+                // the columns of B
+                for(int r = ty; r < hipblas_matcopy_tile; r += hipblas_matcopy_rows)
+                    if(j0 + tx < problem.cols && i0 + r < problem.rows)
+                        tile[r][tx] = A[(j0 + tx) + (i0 + r) * problem.lda];
+                __syncthreads();
+
+                for(int r = ty; r < hipblas_matcopy_tile; r += hipblas_matcopy_rows)
+                    if(i0 + tx < problem.rows && j0 + r < problem.cols)
+                        B[(i0 + tx) + (j0 + r) * problem.ldb]
+                            = hipblas_matcopy_op(tile[tx][r], problem.trans, a, problem.scale);
+                __syncthreads();
+            }
+        }
+    }
+
+    // A_b := alpha * op(A_b) in place for square A_b of order problem.rows and op a transpose.
+    // The block of tile (p, q) with p <= q swaps it with tile (q, p).
+    template <typename T>
+    __global__ void
+        hipblasImatcopySquareKernel(hipblas_matcopy_problem problem, const T* alpha, T alpha_value)
+    {
+        __shared__ T upper[hipblas_matcopy_tile][hipblas_matcopy_tile + 1];
+        __shared__ T lower[hipblas_matcopy_tile][hipblas_matcopy_tile + 1];
+
+        if(blockIdx.x > blockIdx.y)
+            return;
+
+        T       a    = alpha ? *alpha : alpha_value;
+        int     tx   = threadIdx.x;
+        int     ty   = threadIdx.y;
+        int64_t n    = problem.rows;
+        int64_t p0   = int64_t(blockIdx.x) * hipblas_matcopy_tile;
+        int64_t q0   = int64_t(blockIdx.y) * hipblas_matcopy_tile;
+        bool    diag = blockIdx.x == blockIdx.y;
+
+        for(int b = blockIdx.z; b < problem.batch_count; b += gridDim.z)
+        {
+            T* A = hipblas_matcopy_matrix<T>(problem.B, problem.stride_b, false, b);
+
+            // upper[r][c] := A(p0 + c, q0 + r) and lower[r][c] := A(q0 + c, p0 + r)
+            for(int r = ty; r < hipblas_matcopy_tile; r += hipblas_matcopy_rows)
+            {
+                if(p0 + tx < n && q0 + r < n)
+                    upper[r][tx] = A[(p0 + tx) + (q0 + r) * problem.lda];
+                if(!diag && q0 + tx < n && p0 + r < n)
+                    lower[r][tx] = A[(q0 + tx) + (p0 + r) * problem.lda];
+            }
+            __syncthreads();
+
+            // A(p0 + c, q0 + r) := op(A(q0 + r, p0 + c)) and A(q0 + c, p0 + r) := op(A(p0 + r,
+            // q0 + c)), which is the tile itself on the diagonal
+            for(int r = ty; r < hipblas_matcopy_tile; r += hipblas_matcopy_rows)
+            {
+                if(p0 + tx < n && q0 + r < n)
+                    A[(p0 + tx) + (q0 + r) * problem.lda] = hipblas_matcopy_op(
+                        diag ? upper[tx][r] : lower[tx][r], problem.trans, a, problem.scale);
+                if(!diag && q0 + tx < n && p0 + r < n)
+                    A[(q0 + tx) + (p0 + r) * problem.lda]
+                        = hipblas_matcopy_op(upper[tx][r], problem.trans, a, problem.scale);
+            }
+            __syncthreads();
+        }
+    }
+
+    template <typename T>
+    hipError_t hipblas_matcopy_launch(const hipblas_matcopy_problem& problem,
+                                      const T*                       alpha,
+                                      T                              alpha_value,
+                                      bool                           square,
+                                      hipStream_t                    stream)
+    {
+        int64_t tiles_i = (problem.rows - 1) / hipblas_matcopy_tile + 1;
+        int64_t tiles_j = (problem.cols - 1) / hipblas_matcopy_tile + 1;
+        dim3    grid(unsigned(tiles_i),
+                  unsigned(std::min<int64_t>(tiles_j, 65535)),
+                  unsigned(std::min(problem.batch_count, 65535)));
+        dim3    threads(hipblas_matcopy_tile, hipblas_matcopy_rows);
+        if(square)
+            hipblasImatcopySquareKernel<T>
+                <<<grid, threads, 0, stream>>>(problem, alpha, alpha_value);
+        else
+            hipblasMatcopyKernel<T><<<grid, threads, 0, stream>>>(problem, alpha, alpha_value);
+        return hipGetLastError();
+    }
+
+    bool hipblas_matcopy_valid_trans(hipblasOperation_t trans)
+    {
+        return trans == HIPBLAS_OP_N || trans == HIPBLAS_OP_T || trans == HIPBLAS_OP_C;
+    }
+
+    // alpha on the host or the device, as the pointer mode says
+    template <typename T>
+    hipblasStatus_t hipblas_matcopy_alpha(hipblasHandle_t handle,
+                                          const void*     alpha,
+                                          const T**       d_alpha,
+                                          T*              h_alpha,
+                                          hipStream_t*    stream)
+    {
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblasGetStream(handle, stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasGetPointerMode(handle, &mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        *d_alpha = mode == HIPBLAS_POINTER_MODE_DEVICE ? static_cast<const T*>(alpha) : nullptr;
+        *h_alpha = mode == HIPBLAS_POINTER_MODE_DEVICE ? T{} : *static_cast<const T*>(alpha);
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // B_b := alpha * op(A_b) for the m by n matrices A_b
+    template <typename T>
+    hipblasStatus_t hipblas_omatcopy(hipblasHandle_t    handle,
+                                     hipblasOperation_t trans,
+                                     int64_t            m,
+                                     int64_t            n,
+                                     const void*        alpha,
+                                     const void*        A,
+                                     int64_t            lda,
+                                     hipblasStride      stride_a,
+                                     void*              B,
+                                     int64_t            ldb,
+                                     hipblasStride      stride_b,
+                                     int64_t            batch_count)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!hipblas_matcopy_valid_trans(trans))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+        int64_t rows = trans == HIPBLAS_OP_N ? m : n;
+        if(m < 0 || n < 0 || lda < std::max<int64_t>(m, 1) || ldb < std::max<int64_t>(rows, 1)
+           || batch_count < 0 || batch_count > INT32_MAX)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!m || !n || !batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !A || !B)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        const T*        d_alpha;
+        T               h_alpha;
+        hipblasStatus_t status = hipblas_matcopy_alpha(handle, alpha, &d_alpha, &h_alpha, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipblas_matcopy_problem problem{rows,
+                                        trans == HIPBLAS_OP_N ? n : m,
+                                        trans,
+                                        HIPBLAS_FILL_MODE_FULL,
+                                        true,
+                                        false,
+                                        A,
+                                        lda,
+                                        stride_a,
+                                        B,
+                                        ldb,
+                                        stride_b,
+                                        int(batch_count)};
+        return hipblas_matcopy_launch<T>(problem, d_alpha, h_alpha, false, stream) == hipSuccess
+                   ? HIPBLAS_STATUS_SUCCESS
+                   : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    // A_b := alpha * op(A_b) in place for the m by n matrices A_b, with leading dimension lda on
+    // entry and ldb on exit
+    template <typename T>
+    hipblasStatus_t hipblas_imatcopy(hipblasHandle_t    handle,
+                                     hipblasOperation_t trans,
+                                     int64_t            m,
+                                     int64_t            n,
+                                     const void*        alpha,
+                                     void*              AB,
+                                     int64_t            lda,
+                                     int64_t            ldb,
+                                     hipblasStride      stride,
+                                     int64_t            batch_count)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!hipblas_matcopy_valid_trans(trans))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+        int64_t rows = trans == HIPBLAS_OP_N ? m : n;
+        int64_t cols = trans == HIPBLAS_OP_N ? n : m;
+        if(m < 0 || n < 0 || lda < std::max<int64_t>(m, 1) || ldb < std::max<int64_t>(rows, 1)
+           || batch_count < 0 || batch_count > INT32_MAX)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!m || !n || !batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !AB)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        const T*        d_alpha;
+        T               h_alpha;
+        hipblasStatus_t status = hipblas_matcopy_alpha(handle, alpha, &d_alpha, &h_alpha, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipblas_matcopy_problem problem{rows,
+                                        cols,
+                                        trans,
+                                        HIPBLAS_FILL_MODE_FULL,
+                                        true,
+                                        false,
+                                        AB,
+                                        lda,
+                                        stride,
+                                        AB,
+                                        ldb,
+                                        stride,
+                                        int(batch_count)};
+
+        // elementwise in place, or the tiles swapped across the diagonal
+        bool in_place = trans == HIPBLAS_OP_N && lda == ldb;
+        bool square   = trans != HIPBLAS_OP_N && m == n && lda == ldb;
+        if(in_place || square)
+            return hipblas_matcopy_launch<T>(problem, d_alpha, h_alpha, square, stream)
+                           == hipSuccess
+                       ? HIPBLAS_STATUS_SUCCESS
+                       : HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        // otherwise A_b is copied as it is to the workspace, packed, and back with op
+        size_t bytes = size_t(m) * n * batch_count * sizeof(T);
+        T*     work  = static_cast<T*>(hipblasGetScratch(handle, bytes, stream));
+        if(!work)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+
+        hipblas_matcopy_problem pack{m,
+                                     n,
+                                     HIPBLAS_OP_N,
+                                     HIPBLAS_FILL_MODE_FULL,
+                                     false,
+                                     false,
+                                     AB,
+                                     lda,
+                                     stride,
+                                     work,
+                                     m,
+                                     m * n,
+                                     int(batch_count)};
+        problem.A        = work;
+        problem.lda      = m;
+        problem.stride_a = m * n;
+        if(hipblas_matcopy_launch<T>(pack, nullptr, T{}, false, stream) != hipSuccess
+           || hipblas_matcopy_launch<T>(problem, d_alpha, h_alpha, false, stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // B_b := A_b, or its upper or lower triangle, for the m by n matrices A_b, which are arrays
+    // of pointers when batched
+    template <typename T>
+    hipblasStatus_t hipblas_lacpy(hipblasHandle_t   handle,
+                                  hipblasFillMode_t uplo,
+                                  int64_t           m,
+                                  int64_t           n,
+                                  const void*       A,
+                                  int64_t           lda,
+                                  hipblasStride     stride_a,
+                                  void*             B,
+                                  int64_t           ldb,
+                                  hipblasStride     stride_b,
+                                  bool              batched,
+                                  int64_t           batch_count)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(uplo != HIPBLAS_FILL_MODE_FULL && uplo != HIPBLAS_FILL_MODE_UPPER
+           && uplo != HIPBLAS_FILL_MODE_LOWER)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(m < 0 || n < 0 || lda < std::max<int64_t>(m, 1) || ldb < std::max<int64_t>(m, 1)
+           || batch_count < 0 || batch_count > INT32_MAX)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!m || !n || !batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!A || !B)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipblas_matcopy_problem problem{m,
+                                        n,
+                                        HIPBLAS_OP_N,
+                                        uplo,
+                                        false,
+                                        batched,
+                                        A,
+                                        lda,
+                                        stride_a,
+                                        B,
+                                        ldb,
+                                        stride_b,
+                                        int(batch_count)};
+        return hipblas_matcopy_launch<T>(problem, nullptr, T{}, false, stream) == hipSuccess
+                   ? HIPBLAS_STATUS_SUCCESS
+                   : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+}
+
+extern "C" hipblasStatus_t hipblasSomatcopy(hipblasHandle_t    handle,
+                                            hipblasOperation_t trans,
+                                            int                m,
+                                            int                n,
+                                            const float*       alpha,
+                                            const float*       A,
+                                            int                lda,
+                                            float*             B,
+                                            int                ldb)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, lda, ldb);
+
+    return hipblas_omatcopy<float>(handle, trans, m, n, alpha, A, lda, 0, B, ldb, 0, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDomatcopy(hipblasHandle_t    handle,
+                                            hipblasOperation_t trans,
+                                            int                m,
+                                            int                n,
+                                            const double*      alpha,
+                                            const double*      A,
+                                            int                lda,
+                                            double*            B,
+                                            int                ldb)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, lda, ldb);
+
+    return hipblas_omatcopy<double>(handle, trans, m, n, alpha, A, lda, 0, B, ldb, 0, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasComatcopy(hipblasHandle_t       handle,
+                                            hipblasOperation_t    trans,
+                                            int                   m,
+                                            int                   n,
+                                            const hipblasComplex* alpha,
+                                            const hipblasComplex* A,
+                                            int                   lda,
+                                            hipblasComplex*       B,
+                                            int                   ldb)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, lda, ldb);
+
+    return hipblas_omatcopy<hipFloatComplex>(handle, trans, m, n, alpha, A, lda, 0, B, ldb, 0, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZomatcopy(hipblasHandle_t             handle,
+                                            hipblasOperation_t          trans,
+                                            int                         m,
+                                            int                         n,
+                                            const hipblasDoubleComplex* alpha,
+                                            const hipblasDoubleComplex* A,
+                                            int                         lda,
+                                            hipblasDoubleComplex*       B,
+                                            int                         ldb)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, lda, ldb);
+
+    return hipblas_omatcopy<hipDoubleComplex>(handle, trans, m, n, alpha, A, lda, 0, B, ldb, 0, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasComatcopy_v2(hipblasHandle_t    handle,
+                                               hipblasOperation_t trans,
+                                               int                m,
+                                               int                n,
+                                               const hipComplex*  alpha,
+                                               const hipComplex*  A,
+                                               int                lda,
+                                               hipComplex*        B,
+                                               int                ldb)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, lda, ldb);
+
+    return hipblas_omatcopy<hipFloatComplex>(handle, trans, m, n, alpha, A, lda, 0, B, ldb, 0, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZomatcopy_v2(hipblasHandle_t         handle,
+                                               hipblasOperation_t      trans,
+                                               int                     m,
+                                               int                     n,
+                                               const hipDoubleComplex* alpha,
+                                               const hipDoubleComplex* A,
+                                               int                     lda,
+                                               hipDoubleComplex*       B,
+                                               int                     ldb)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, lda, ldb);
+
+    return hipblas_omatcopy<hipDoubleComplex>(handle, trans, m, n, alpha, A, lda, 0, B, ldb, 0, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasSomatcopyStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasOperation_t trans,
+                                                          int                m,
+                                                          int                n,
+                                                          const float*       alpha,
+                                                          const float*       A,
+                                                          int                lda,
+                                                          hipblasStride      strideA,
+                                                          float*             B,
+                                                          int                ldb,
+                                                          hipblasStride      strideB,
+                                                          int                batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblas_omatcopy<float>(
+        handle, trans, m, n, alpha, A, lda, strideA, B, ldb, strideB, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDomatcopyStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasOperation_t trans,
+                                                          int                m,
+                                                          int                n,
+                                                          const double*      alpha,
+                                                          const double*      A,
+                                                          int                lda,
+                                                          hipblasStride      strideA,
+                                                          double*            B,
+                                                          int                ldb,
+                                                          hipblasStride      strideB,
+                                                          int                batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblas_omatcopy<double>(
+        handle, trans, m, n, alpha, A, lda, strideA, B, ldb, strideB, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasComatcopyStridedBatched(hipblasHandle_t       handle,
+                                                          hipblasOperation_t    trans,
+                                                          int                   m,
+                                                          int                   n,
+                                                          const hipblasComplex* alpha,
+                                                          const hipblasComplex* A,
+                                                          int                   lda,
+                                                          hipblasStride         strideA,
+                                                          hipblasComplex*       B,
+                                                          int                   ldb,
+                                                          hipblasStride         strideB,
+                                                          int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblas_omatcopy<hipFloatComplex>(
+        handle, trans, m, n, alpha, A, lda, strideA, B, ldb, strideB, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZomatcopyStridedBatched(hipblasHandle_t             handle,
+                                                          hipblasOperation_t          trans,
+                                                          int                         m,
+                                                          int                         n,
+                                                          const hipblasDoubleComplex* alpha,
+                                                          const hipblasDoubleComplex* A,
+                                                          int                         lda,
+                                                          hipblasStride               strideA,
+                                                          hipblasDoubleComplex*       B,
+                                                          int                         ldb,
+                                                          hipblasStride               strideB,
+                                                          int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblas_omatcopy<hipDoubleComplex>(
+        handle, trans, m, n, alpha, A, lda, strideA, B, ldb, strideB, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasComatcopyStridedBatched_v2(hipblasHandle_t    handle,
+                                                             hipblasOperation_t trans,
+                                                             int                m,
+                                                             int                n,
+                                                             const hipComplex*  alpha,
+                                                             const hipComplex*  A,
+                                                             int                lda,
+                                                             hipblasStride      strideA,
+                                                             hipComplex*        B,
+                                                             int                ldb,
+                                                             hipblasStride      strideB,
+                                                             int                batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblas_omatcopy<hipFloatComplex>(
+        handle, trans, m, n, alpha, A, lda, strideA, B, ldb, strideB, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZomatcopyStridedBatched_v2(hipblasHandle_t         handle,
+                                                             hipblasOperation_t      trans,
+                                                             int                     m,
+                                                             int                     n,
+                                                             const hipDoubleComplex* alpha,
+                                                             const hipDoubleComplex* A,
+                                                             int                     lda,
+                                                             hipblasStride           strideA,
+                                                             hipDoubleComplex*       B,
+                                                             int                     ldb,
+                                                             hipblasStride           strideB,
+                                                             int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblas_omatcopy<hipDoubleComplex>(
+        handle, trans, m, n, alpha, A, lda, strideA, B, ldb, strideB, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasSimatcopy(hipblasHandle_t    handle,
+                                            hipblasOperation_t trans,
+                                            int                m,
+                                            int                n,
+                                            const float*       alpha,
+                                            float*             AB,
+                                            int                lda,
+                                            int                ldb)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, lda, ldb);
+
+    return hipblas_imatcopy<float>(handle, trans, m, n, alpha, AB, lda, ldb, 0, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDimatcopy(hipblasHandle_t    handle,
+                                            hipblasOperation_t trans,
+                                            int                m,
+                                            int                n,
+                                            const double*      alpha,
+                                            double*            AB,
+                                            int                lda,
+                                            int                ldb)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, lda, ldb);
+
+    return hipblas_imatcopy<double>(handle, trans, m, n, alpha, AB, lda, ldb, 0, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCimatcopy(hipblasHandle_t       handle,
+                                            hipblasOperation_t    trans,
+                                            int                   m,
+                                            int                   n,
+                                            const hipblasComplex* alpha,
+                                            hipblasComplex*       AB,
+                                            int                   lda,
+                                            int                   ldb)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, lda, ldb);
+
+    return hipblas_imatcopy<hipFloatComplex>(handle, trans, m, n, alpha, AB, lda, ldb, 0, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZimatcopy(hipblasHandle_t             handle,
+                                            hipblasOperation_t          trans,
+                                            int                         m,
+                                            int                         n,
+                                            const hipblasDoubleComplex* alpha,
+                                            hipblasDoubleComplex*       AB,
+                                            int                         lda,
+                                            int                         ldb)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, lda, ldb);
+
+    return hipblas_imatcopy<hipDoubleComplex>(handle, trans, m, n, alpha, AB, lda, ldb, 0, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCimatcopy_v2(hipblasHandle_t    handle,
+                                               hipblasOperation_t trans,
+                                               int                m,
+                                               int                n,
+                                               const hipComplex*  alpha,
+                                               hipComplex*        AB,
+                                               int                lda,
+                                               int                ldb)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, lda, ldb);
+
+    return hipblas_imatcopy<hipFloatComplex>(handle, trans, m, n, alpha, AB, lda, ldb, 0, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZimatcopy_v2(hipblasHandle_t         handle,
+                                               hipblasOperation_t      trans,
+                                               int                     m,
+                                               int                     n,
+                                               const hipDoubleComplex* alpha,
+                                               hipDoubleComplex*       AB,
+                                               int                     lda,
+                                               int                     ldb)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, lda, ldb);
+
+    return hipblas_imatcopy<hipDoubleComplex>(handle, trans, m, n, alpha, AB, lda, ldb, 0, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasSimatcopyStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasOperation_t trans,
+                                                          int                m,
+                                                          int                n,
+                                                          const float*       alpha,
+                                                          float*             AB,
+                                                          int                lda,
+                                                          int                ldb,
+                                                          hipblasStride      stride,
+                                                          int                batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, lda, ldb, stride, batchCount);
+
+    return hipblas_imatcopy<float>(handle, trans, m, n, alpha, AB, lda, ldb, stride, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDimatcopyStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasOperation_t trans,
+                                                          int                m,
+                                                          int                n,
+                                                          const double*      alpha,
+                                                          double*            AB,
+                                                          int                lda,
+                                                          int                ldb,
+                                                          hipblasStride      stride,
+                                                          int                batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, lda, ldb, stride, batchCount);
+
+    return hipblas_imatcopy<double>(handle, trans, m, n, alpha, AB, lda, ldb, stride, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCimatcopyStridedBatched(hipblasHandle_t       handle,
+                                                          hipblasOperation_t    trans,
+                                                          int                   m,
+                                                          int                   n,
+                                                          const hipblasComplex* alpha,
+                                                          hipblasComplex*       AB,
+                                                          int                   lda,
+                                                          int                   ldb,
+                                                          hipblasStride         stride,
+                                                          int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, lda, ldb, stride, batchCount);
+
+    return hipblas_imatcopy<hipFloatComplex>(
+        handle, trans, m, n, alpha, AB, lda, ldb, stride, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZimatcopyStridedBatched(hipblasHandle_t             handle,
+                                                          hipblasOperation_t          trans,
+                                                          int                         m,
+                                                          int                         n,
+                                                          const hipblasDoubleComplex* alpha,
+                                                          hipblasDoubleComplex*       AB,
+                                                          int                         lda,
+                                                          int                         ldb,
+                                                          hipblasStride               stride,
+                                                          int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, lda, ldb, stride, batchCount);
+
+    return hipblas_imatcopy<hipDoubleComplex>(
+        handle, trans, m, n, alpha, AB, lda, ldb, stride, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCimatcopyStridedBatched_v2(hipblasHandle_t    handle,
+                                                             hipblasOperation_t trans,
+                                                             int                m,
+                                                             int                n,
+                                                             const hipComplex*  alpha,
+                                                             hipComplex*        AB,
+                                                             int                lda,
+                                                             int                ldb,
+                                                             hipblasStride      stride,
+                                                             int                batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, lda, ldb, stride, batchCount);
+
+    return hipblas_imatcopy<hipFloatComplex>(
+        handle, trans, m, n, alpha, AB, lda, ldb, stride, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZimatcopyStridedBatched_v2(hipblasHandle_t         handle,
+                                                             hipblasOperation_t      trans,
+                                                             int                     m,
+                                                             int                     n,
+                                                             const hipDoubleComplex* alpha,
+                                                             hipDoubleComplex*       AB,
+                                                             int                     lda,
+                                                             int                     ldb,
+                                                             hipblasStride           stride,
+                                                             int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, lda, ldb, stride, batchCount);
+
+    return hipblas_imatcopy<hipDoubleComplex>(
+        handle, trans, m, n, alpha, AB, lda, ldb, stride, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasSlacpy(hipblasHandle_t   handle,
+                                         hipblasFillMode_t uplo,
+                                         int               m,
+                                         int               n,
+                                         const float*      A,
+                                         int               lda,
+                                         float*            B,
+                                         int               ldb)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, m, n, lda, ldb);
+
+    return hipblas_lacpy<float>(handle, uplo, m, n, A, lda, 0, B, ldb, 0, false, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDlacpy(hipblasHandle_t   handle,
+                                         hipblasFillMode_t uplo,
+                                         int               m,
+                                         int               n,
+                                         const double*     A,
+                                         int               lda,
+                                         double*           B,
+                                         int               ldb)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, m, n, lda, ldb);
+
+    return hipblas_lacpy<double>(handle, uplo, m, n, A, lda, 0, B, ldb, 0, false, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasClacpy(hipblasHandle_t       handle,
+                                         hipblasFillMode_t     uplo,
+                                         int                   m,
+                                         int                   n,
+                                         const hipblasComplex* A,
+                                         int                   lda,
+                                         hipblasComplex*       B,
+                                         int                   ldb)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, m, n, lda, ldb);
+
+    return hipblas_lacpy<hipFloatComplex>(handle, uplo, m, n, A, lda, 0, B, ldb, 0, false, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZlacpy(hipblasHandle_t             handle,
+                                         hipblasFillMode_t           uplo,
+                                         int                         m,
+                                         int                         n,
+                                         const hipblasDoubleComplex* A,
+                                         int                         lda,
+                                         hipblasDoubleComplex*       B,
+                                         int                         ldb)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, m, n, lda, ldb);
+
+    return hipblas_lacpy<hipDoubleComplex>(handle, uplo, m, n, A, lda, 0, B, ldb, 0, false, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasClacpy_v2(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               m,
+                                            int               n,
+                                            const hipComplex* A,
+                                            int               lda,
+                                            hipComplex*       B,
+                                            int               ldb)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, m, n, lda, ldb);
+
+    return hipblas_lacpy<hipFloatComplex>(handle, uplo, m, n, A, lda, 0, B, ldb, 0, false, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZlacpy_v2(hipblasHandle_t         handle,
+                                            hipblasFillMode_t       uplo,
+                                            int                     m,
+                                            int                     n,
+                                            const hipDoubleComplex* A,
+                                            int                     lda,
+                                            hipDoubleComplex*       B,
+                                            int                     ldb)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, m, n, lda, ldb);
+
+    return hipblas_lacpy<hipDoubleComplex>(handle, uplo, m, n, A, lda, 0, B, ldb, 0, false, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasSlacpyBatched(hipblasHandle_t    handle,
+                                                hipblasFillMode_t  uplo,
+                                                int                m,
+                                                int                n,
+                                                const float* const A[],
+                                                int                lda,
+                                                float* const       B[],
+                                                int                ldb,
+                                                int                batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, m, n, lda, ldb, batchCount);
+
+    return hipblas_lacpy<float>(handle, uplo, m, n, A, lda, 0, (void*)B, ldb, 0, true, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDlacpyBatched(hipblasHandle_t     handle,
+                                                hipblasFillMode_t   uplo,
+                                                int                 m,
+                                                int                 n,
+                                                const double* const A[],
+                                                int                 lda,
+                                                double* const       B[],
+                                                int                 ldb,
+                                                int                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, m, n, lda, ldb, batchCount);
+
+    return hipblas_lacpy<double>(handle, uplo, m, n, A, lda, 0, (void*)B, ldb, 0, true, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasClacpyBatched(hipblasHandle_t             handle,
+                                                hipblasFillMode_t           uplo,
+                                                int                         m,
+                                                int                         n,
+                                                const hipblasComplex* const A[],
+                                                int                         lda,
+                                                hipblasComplex* const       B[],
+                                                int                         ldb,
+                                                int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, m, n, lda, ldb, batchCount);
+
+    return hipblas_lacpy<hipFloatComplex>(
+        handle, uplo, m, n, A, lda, 0, (void*)B, ldb, 0, true, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZlacpyBatched(hipblasHandle_t                   handle,
+                                                hipblasFillMode_t                 uplo,
+                                                int                               m,
+                                                int                               n,
+                                                const hipblasDoubleComplex* const A[],
+                                                int                               lda,
+                                                hipblasDoubleComplex* const       B[],
+                                                int                               ldb,
+                                                int                               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, m, n, lda, ldb, batchCount);
+
+    return hipblas_lacpy<hipDoubleComplex>(
+        handle, uplo, m, n, A, lda, 0, (void*)B, ldb, 0, true, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasClacpyBatched_v2(hipblasHandle_t         handle,
+                                                   hipblasFillMode_t       uplo,
+                                                   int                     m,
+                                                   int                     n,
+                                                   const hipComplex* const A[],
+                                                   int                     lda,
+                                                   hipComplex* const       B[],
+                                                   int                     ldb,
+                                                   int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, m, n, lda, ldb, batchCount);
+
+    return hipblas_lacpy<hipFloatComplex>(
+        handle, uplo, m, n, A, lda, 0, (void*)B, ldb, 0, true, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZlacpyBatched_v2(hipblasHandle_t               handle,
+                                                   hipblasFillMode_t             uplo,
+                                                   int                           m,
+                                                   int                           n,
+                                                   const hipDoubleComplex* const A[],
+                                                   int                           lda,
+                                                   hipDoubleComplex* const       B[],
+                                                   int                           ldb,
+                                                   int                           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, m, n, lda, ldb, batchCount);
+
+    return hipblas_lacpy<hipDoubleComplex>(
+        handle, uplo, m, n, A, lda, 0, (void*)B, ldb, 0, true, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasSlacpyStridedBatched(hipblasHandle_t   handle,
+                                                       hipblasFillMode_t uplo,
+                                                       int               m,
+                                                       int               n,
+                                                       const float*      A,
+                                                       int               lda,
+                                                       hipblasStride     strideA,
+                                                       float*            B,
+                                                       int               ldb,
+                                                       hipblasStride     strideB,
+                                                       int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, m, n, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblas_lacpy<float>(
+        handle, uplo, m, n, A, lda, strideA, B, ldb, strideB, false, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDlacpyStridedBatched(hipblasHandle_t   handle,
+                                                       hipblasFillMode_t uplo,
+                                                       int               m,
+                                                       int               n,
+                                                       const double*     A,
+                                                       int               lda,
+                                                       hipblasStride     strideA,
+                                                       double*           B,
+                                                       int               ldb,
+                                                       hipblasStride     strideB,
+                                                       int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, m, n, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblas_lacpy<double>(
+        handle, uplo, m, n, A, lda, strideA, B, ldb, strideB, false, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasClacpyStridedBatched(hipblasHandle_t       handle,
+                                                       hipblasFillMode_t     uplo,
+                                                       int                   m,
+                                                       int                   n,
+                                                       const hipblasComplex* A,
+                                                       int                   lda,
+                                                       hipblasStride         strideA,
+                                                       hipblasComplex*       B,
+                                                       int                   ldb,
+                                                       hipblasStride         strideB,
+                                                       int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, m, n, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblas_lacpy<hipFloatComplex>(
+        handle, uplo, m, n, A, lda, strideA, B, ldb, strideB, false, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZlacpyStridedBatched(hipblasHandle_t             handle,
+                                                       hipblasFillMode_t           uplo,
+                                                       int                         m,
+                                                       int                         n,
+                                                       const hipblasDoubleComplex* A,
+                                                       int                         lda,
+                                                       hipblasStride               strideA,
+                                                       hipblasDoubleComplex*       B,
+                                                       int                         ldb,
+                                                       hipblasStride               strideB,
+                                                       int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, m, n, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblas_lacpy<hipDoubleComplex>(
+        handle, uplo, m, n, A, lda, strideA, B, ldb, strideB, false, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasClacpyStridedBatched_v2(hipblasHandle_t   handle,
+                                                          hipblasFillMode_t uplo,
+                                                          int               m,
+                                                          int               n,
+                                                          const hipComplex* A,
+                                                          int               lda,
+                                                          hipblasStride     strideA,
+                                                          hipComplex*       B,
+                                                          int               ldb,
+                                                          hipblasStride     strideB,
+                                                          int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, m, n, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblas_lacpy<hipFloatComplex>(
+        handle, uplo, m, n, A, lda, strideA, B, ldb, strideB, false, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZlacpyStridedBatched_v2(hipblasHandle_t         handle,
+                                                          hipblasFillMode_t       uplo,
+                                                          int                     m,
+                                                          int                     n,
+                                                          const hipDoubleComplex* A,
+                                                          int                     lda,
+                                                          hipblasStride           strideA,
+                                                          hipDoubleComplex*       B,
+                                                          int                     ldb,
+                                                          hipblasStride           strideB,
+                                                          int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, m, n, lda, strideA, ldb, strideB, batchCount);
+
+    return hipblas_lacpy<hipDoubleComplex>(
+        handle, uplo, m, n, A, lda, strideA, B, ldb, strideB, false, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
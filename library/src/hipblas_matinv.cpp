@@ -0,0 +1,386 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_matinv.hpp"
+
+// The small batched inverses of hipblas_matinv.hpp. A block inverts P matrices padded to order
+// S, each in shared memory with S threads. Step k of the Gauss-Jordan elimination swaps the row
+// of the largest pivot of column k into row k, scales row k by the inverse of the pivot, with
+// the pivot itself replaced by its inverse, and then subtracts multiples of row k from the other
+// rows, with column k replaced by minus the multiples times the inverse of the pivot. That
+// leaves the inverse of P A in place for the row interchanges P, and the inverse of A is that
+// with the columns interchanged in the reverse order.
+
+namespace
+{
+    constexpr int hipblas_matinv_threads = 256;
+    constexpr int hipblas_matinv_max     = 32;
+
+    // Shared memory of a block, which bounds the matrices per block of the larger types
+    constexpr size_t hipblas_matinv_lds = 48 * 1024;
+
+    // Matrices per block of order S, with a padded row against bank conflicts
+    template <typename T, int S>
+    constexpr int hipblas_matinv_matrices()
+    {
+        constexpr size_t bytes = S * (S + 1) * sizeof(T) + S * sizeof(int);
+        constexpr size_t p
+            = std::min<size_t>(hipblas_matinv_threads / S, hipblas_matinv_lds / bytes);
+        return p < 1 ? 1 : int(p);
+    }
+
+    template <typename T>
+    __device__ inline T hipblas_matinv_mul(T a, T b)
+    {
+        return a * b;
+    }
+
+    __device__ inline hipFloatComplex hipblas_matinv_mul(hipFloatComplex a, hipFloatComplex b)
+    {
+        return hipCmulf(a, b);
+    }
+
+    __device__ inline hipDoubleComplex hipblas_matinv_mul(hipDoubleComplex a, hipDoubleComplex b)
+    {
+        return hipCmul(a, b);
+    }
+
+    // c - a * b
+    template <typename T>
+    __device__ inline T hipblas_matinv_fms(T a, T b, T c)
+    {
+        return c - a * b;
+    }
+
+    __device__ inline hipFloatComplex
+        hipblas_matinv_fms(hipFloatComplex a, hipFloatComplex b, hipFloatComplex c)
+    {
+        return hipCsubf(c, hipCmulf(a, b));
+    }
+
+    __device__ inline hipDoubleComplex
+        hipblas_matinv_fms(hipDoubleComplex a, hipDoubleComplex b, hipDoubleComplex c)
+    {
+        return hipCsub(c, hipCmul(a, b));
+    }
+
+    template <typename T>
+    __device__ inline T hipblas_matinv_neg(T a)
+    {
+        return -a;
+    }
+
+    __device__ inline hipFloatComplex hipblas_matinv_neg(hipFloatComplex a)
+    {
+        return make_hipFloatComplex(-a.x, -a.y);
+    }
+
+    __device__ inline hipDoubleComplex hipblas_matinv_neg(hipDoubleComplex a)
+    {
+        return make_hipDoubleComplex(-a.x, -a.y);
+    }
+
+    template <typename T>
+    __device__ inline T hipblas_matinv_inv(T a)
+    {
+        return T(1) / a;
+    }
+
+    __device__ inline hipFloatComplex hipblas_matinv_inv(hipFloatComplex a)
+    {
+        return hipCdivf(make_hipFloatComplex(1, 0), a);
+    }
+
+    __device__ inline hipDoubleComplex hipblas_matinv_inv(hipDoubleComplex a)
+    {
+        return hipCdiv(make_hipDoubleComplex(1, 0), a);
+    }
+
+    // The size the pivots are chosen by, |re| + |im| for the complex types as in iamax
+    template <typename T>
+    __device__ inline double hipblas_matinv_abs(T a)
+    {
+        return a < 0 ? -double(a) : double(a);
+    }
+
+    __device__ inline double hipblas_matinv_abs(hipFloatComplex a)
+    {
+        return fabs(double(a.x)) + fabs(double(a.y));
+    }
+
+    __device__ inline double hipblas_matinv_abs(hipDoubleComplex a)
+    {
+        return fabs(a.x) + fabs(a.y);
+    }
+
+    // The matrix b of a batch, from an array of pointers or at a stride from the first one
+    template <typename T>
+    __device__ inline T*
+        hipblas_matinv_matrix(const void* X, hipblasStride stride, bool batched, int64_t b)
+    {
+        if(batched)
+            return static_cast<T* const*>(X)[b];
+        return static_cast<T*>(const_cast<void*>(X)) + b * stride;
+    }
+
+    struct hipblas_matinv_problem
+    {
+        int           order;
+        const void*   A;
+        int64_t       lda;
+        hipblasStride strideA;
+        void*         Ainv;
+        int64_t       lda_inv;
+        hipblasStride strideAinv;
+        int*          info;
+        bool          batched;
+        int64_t       batch_count;
+    };
+
+    // Inverts P matrices per block, thread t of a matrix working on its row t, or its column t
+    // where the rows are read or swapped
+    template <typename T, int S>
+    __global__ void __launch_bounds__(hipblas_matinv_threads)
+        hipblasMatinvKernel(hipblas_matinv_problem problem)
+    {
+        constexpr int P = hipblas_matinv_matrices<T, S>();
+
+        __shared__ T   a[P][S][S + 1];
+        __shared__ int pivot[P][S];
+        __shared__ int singular[P];
+
+        const int order = problem.order;
+        int       p     = threadIdx.x / S;
+        int       t     = threadIdx.x % S;
+        bool      lane  = t < order;
+
+        for(int64_t b0 = int64_t(blockIdx.x) * P; b0 < problem.batch_count;
+            b0 += int64_t(gridDim.x) * P)
+        {
+            int64_t b      = b0 + p;
+            bool    active = b < problem.batch_count;
+
+            // the threads read consecutive elements of the columns of A
+            if(active)
+            {
+                const T* Ab = hipblas_matinv_matrix<const T>(
+                    problem.A, problem.strideA, problem.batched, b);
+                for(int e = t; e < S * S; e += S)
+                {
+                    int r = e % S, c = e / S;
+                    if(r < order && c < order)
+                        a[p][r][c] = Ab[r + c * problem.lda];
+                }
+            }
+            if(t == 0)
+                singular[p] = 0;
+            __syncthreads();
+
+            for(int k = 0; k < order; k++)
+            {
+                // the pivot is the first of the largest in column k from row k on
+                if(active && t == 0)
+                {
+                    int    r   = k;
+                    double big = hipblas_matinv_abs(a[p][k][k]);
+                    for(int i = k + 1; i < order; i++)
+                    {
+                        double size = hipblas_matinv_abs(a[p][i][k]);
+                        if(size > big)
+                        {
+                            r   = i;
+                            big = size;
+                        }
+                    }
+                    pivot[p][k] = r;
+                    if(big == 0 && !singular[p])
+                        singular[p] = k + 1;
+                }
+                __syncthreads();
+
+                // a zero pivot leaves the step out, as the inverse is then undefined anyway
+                bool step = active && lane && !hipblas_device_is_zero(a[p][pivot[p][k]][k]);
+                if(step && pivot[p][k] != k)
+                {
+                    T y                  = a[p][k][t];
+                    a[p][k][t]           = a[p][pivot[p][k]][t];
+                    a[p][pivot[p][k]][t] = y;
+                }
+                __syncthreads();
+
+                T inv_pivot{};
+                if(step)
+                    inv_pivot = hipblas_matinv_inv(a[p][k][k]);
+                __syncthreads();
+                if(step)
+                    a[p][k][t] = t == k ? inv_pivot : hipblas_matinv_mul(a[p][k][t], inv_pivot);
+                __syncthreads();
+
+                if(step && t != k)
+                {
+                    T f = a[p][t][k];
+                    for(int j = 0; j < order; j++)
+                    {
+                        if(j != k)
+                            a[p][t][j] = hipblas_matinv_fms(f, a[p][k][j], a[p][t][j]);
+                    }
+                    a[p][t][k] = hipblas_matinv_neg(hipblas_matinv_mul(f, inv_pivot));
+                }
+                __syncthreads();
+            }
+
+            // the column interchanges, each thread in its own row
+            if(active && lane)
+            {
+                for(int k = order - 1; k >= 0; k--)
+                {
+                    int r = pivot[p][k];
+                    if(r != k)
+                    {
+                        T y        = a[p][t][k];
+                        a[p][t][k] = a[p][t][r];
+                        a[p][t][r] = y;
+                    }
+                }
+            }
+            __syncthreads();
+
+            if(active)
+            {
+                T* Cb = hipblas_matinv_matrix<T>(
+                    problem.Ainv, problem.strideAinv, problem.batched, b);
+                for(int e = t; e < S * S; e += S)
+                {
+                    int r = e % S, c = e / S;
+                    if(r < order && c < order)
+                        Cb[r + c * problem.lda_inv] = a[p][r][c];
+                }
+                if(t == 0)
+                    problem.info[b] = singular[p];
+            }
+
+            // the shared memory is reused by the next matrices of the batch
+            __syncthreads();
+        }
+    }
+
+    template <typename T, int S>
+    hipError_t hipblas_matinv_launch(const hipblas_matinv_problem& problem, hipStream_t stream)
+    {
+        constexpr int P = hipblas_matinv_matrices<T, S>();
+
+        int blocks = int(std::min<int64_t>((problem.batch_count - 1) / P + 1, 65535));
+        hipblasMatinvKernel<T, S><<<blocks, P * S, 0, stream>>>(problem);
+        return hipGetLastError();
+    }
+
+    using hipblas_matinv_fn = hipError_t (*)(const hipblas_matinv_problem&, hipStream_t);
+
+    // The kernel for matrices padded to the order: 32 of order 8 or 16 of order 16 per block,
+    // and fewer of order 32 when they don't fit in shared memory
+    template <typename T>
+    hipblas_matinv_fn hipblas_matinv_order(int order)
+    {
+        if(order <= 8)
+            return hipblas_matinv_launch<T, 8>;
+        if(order <= 16)
+            return hipblas_matinv_launch<T, 16>;
+        return hipblas_matinv_launch<T, 32>;
+    }
+}
+
+hipblasStatus_t hipblasMatinv(hipblasHandle_t handle,
+                              int64_t         n,
+                              const void*     A,
+                              hipDataType     dataType,
+                              int64_t         lda,
+                              hipblasStride   strideA,
+                              void*           Ainv,
+                              int64_t         lda_inv,
+                              hipblasStride   strideAinv,
+                              int*            info,
+                              int64_t         batchCount,
+                              bool            batched)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || n > hipblas_matinv_max || lda < std::max<int64_t>(n, 1)
+       || lda_inv < std::max<int64_t>(n, 1) || batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!n || !batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!A || !Ainv || !info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblas_matinv_fn matinv;
+    switch(dataType)
+    {
+    case HIP_R_32F:
+        matinv = hipblas_matinv_order<float>(int(n));
+        break;
+    case HIP_R_64F:
+        matinv = hipblas_matinv_order<double>(int(n));
+        break;
+    case HIP_C_32F:
+        matinv = hipblas_matinv_order<hipFloatComplex>(int(n));
+        break;
+    case HIP_C_64F:
+        matinv = hipblas_matinv_order<hipDoubleComplex>(int(n));
+        break;
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblas_matinv_problem problem;
+    problem.order       = int(n);
+    problem.A           = A;
+    problem.lda         = lda;
+    problem.strideA     = strideA;
+    problem.Ainv        = Ainv;
+    problem.lda_inv     = lda_inv;
+    problem.strideAinv  = strideAinv;
+    problem.info        = info;
+    problem.batched     = batched;
+    problem.batch_count = batchCount;
+    if(matinv(problem, stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
@@ -0,0 +1,378 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_entry.hpp"
+
+// hipblasMatmulTensor, a gemm of tensors described as by DLPack. The strides of each matrix say
+// whether it is column major, row major, that is transposed, or neither, and a strided batched
+// gemm is called on the tensors in place. Only an operand with neither layout is copied, into a
+// compact column major batch in the scratch memory of the handle.
+
+namespace
+{
+    constexpr int hipblas_tensor_threads = 256;
+
+    // A batch of rows by cols matrices of a tensor, with its strides in elements
+    struct hipblas_tensor_view
+    {
+        char*       data;
+        hipDataType type;
+        size_t      elem_size;
+        int64_t     batch, rows, cols;
+        int64_t     batch_stride, row_stride, col_stride;
+    };
+
+    // The hipDataType of a DLPack type, or HIPBLAS_DATATYPE_INVALID for the others
+    hipDataType hipblas_tensor_type(const hipblasDLDataType& dtype, size_t& elem_size)
+    {
+        elem_size = dtype.bits / 8;
+        if(dtype.lanes != 1)
+            return hipDataType(HIPBLAS_DATATYPE_INVALID);
+
+        switch(dtype.code)
+        {
+        case 0: // kDLInt
+            if(dtype.bits == 8)
+                return HIP_R_8I;
+            if(dtype.bits == 32)
+                return HIP_R_32I;
+            break;
+        case 2: // kDLFloat
+            if(dtype.bits == 16)
+                return HIP_R_16F;
+            if(dtype.bits == 32)
+                return HIP_R_32F;
+            if(dtype.bits == 64)
+                return HIP_R_64F;
+            break;
+        case 4: // kDLBfloat
+            if(dtype.bits == 16)
+                return HIP_R_16BF;
+            break;
+        case 5: // kDLComplex
+            if(dtype.bits == 64)
+                return HIP_C_32F;
+            if(dtype.bits == 128)
+                return HIP_C_64F;
+            break;
+        }
+        return hipDataType(HIPBLAS_DATATYPE_INVALID);
+    }
+
+    hipblasStatus_t hipblas_tensor_view_of(const hipblasDLTensor* tensor,
+                                           hipblas_tensor_view&   view)
+    {
+        if(!tensor || tensor->ndim < 0 || (tensor->ndim && !tensor->shape))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(tensor->device.deviceType == 1 || (tensor->ndim != 2 && tensor->ndim != 3))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        view.type = hipblas_tensor_type(tensor->dtype, view.elem_size);
+        if(view.type == hipDataType(HIPBLAS_DATATYPE_INVALID))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        // the strides of a compact row major tensor when there are none
+        const int64_t* shape = tensor->shape;
+        int64_t        compact[3];
+        const int64_t* strides = tensor->strides;
+        if(!strides)
+        {
+            int64_t stride = 1;
+            for(int d = tensor->ndim - 1; d >= 0; d--)
+            {
+                compact[d] = stride;
+                stride *= shape[d];
+            }
+            strides = compact;
+        }
+
+        int first         = tensor->ndim - 2;
+        view.batch        = first ? shape[0] : 1;
+        view.batch_stride = first ? strides[0] : 0;
+        view.rows         = shape[first];
+        view.cols         = shape[first + 1];
+        view.row_stride   = strides[first];
+        view.col_stride   = strides[first + 1];
+        if(view.batch < 0 || view.rows < 0 || view.cols < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        view.data = static_cast<char*>(tensor->data) + tensor->byteOffset;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Whether the matrices of a view are op(M) for column major matrices M of leading dimension
+    // ld, with transposed set when op is a transpose, that is when the view is row major
+    bool hipblas_tensor_layout(const hipblas_tensor_view& view, bool& transposed, int64_t& ld)
+    {
+        int64_t r = std::max<int64_t>(view.rows, 1), c = std::max<int64_t>(view.cols, 1);
+        if(view.batch > 1 && view.batch_stride < 0)
+            return false;
+
+        // a single row or column has no stride to check
+        if((view.row_stride == 1 || r == 1) && (c == 1 || view.col_stride >= r))
+        {
+            transposed = false;
+            ld         = c == 1 ? r : view.col_stride;
+            return true;
+        }
+        if((view.col_stride == 1 || c == 1) && (r == 1 || view.row_stride >= c))
+        {
+            transposed = true;
+            ld         = r == 1 ? c : view.row_stride;
+            return true;
+        }
+        return false;
+    }
+
+    // Y := X for batches of rows by cols matrices of any strides, in elements of T
+    template <typename T>
+    __global__ void hipblasTensorCopyKernel(int64_t     rows,
+                                            int64_t     cols,
+                                            int64_t     batch,
+                                            const char* X,
+                                            int64_t     x_row,
+                                            int64_t     x_col,
+                                            int64_t     x_batch,
+                                            char*       Y,
+                                            int64_t     y_row,
+                                            int64_t     y_col,
+                                            int64_t     y_batch)
+    {
+        int64_t i = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+        if(i >= rows)
+            return;
+
+        const T* x = reinterpret_cast<const T*>(X);
+        T*       y = reinterpret_cast<T*>(Y);
+        for(int64_t b = blockIdx.z; b < batch; b += gridDim.z)
+            for(int64_t j = blockIdx.y; j < cols; j += gridDim.y)
+                y[b * y_batch + i * y_row + j * y_col] = x[b * x_batch + i * x_row + j * x_col];
+    }
+
+    // copies a view to a compact column major batch, or back when to_view is set
+    hipError_t hipblas_tensor_copy(const hipblas_tensor_view& view,
+                                   char*                      packed,
+                                   bool                       to_view,
+                                   hipStream_t                stream)
+    {
+        struct alignas(16) element16
+        {
+            uint64_t lo, hi;
+        };
+
+        auto kernel = hipblasTensorCopyKernel<uint8_t>;
+        if(view.elem_size == 2)
+            kernel = hipblasTensorCopyKernel<uint16_t>;
+        else if(view.elem_size == 4)
+            kernel = hipblasTensorCopyKernel<uint32_t>;
+        else if(view.elem_size == 8)
+            kernel = hipblasTensorCopyKernel<uint64_t>;
+        else if(view.elem_size == 16)
+            kernel = hipblasTensorCopyKernel<element16>;
+
+        int64_t rows = view.rows, cols = view.cols;
+        int64_t stride = rows * cols;
+        dim3    grid(unsigned((rows - 1) / hipblas_tensor_threads + 1),
+                  unsigned(std::min<int64_t>(cols, 65535)),
+                  unsigned(std::min<int64_t>(view.batch, 65535)));
+        if(to_view)
+            kernel<<<grid, hipblas_tensor_threads, 0, stream>>>(rows,
+                                                                cols,
+                                                                view.batch,
+                                                                packed,
+                                                                1,
+                                                                rows,
+                                                                stride,
+                                                                view.data,
+                                                                view.row_stride,
+                                                                view.col_stride,
+                                                                view.batch_stride);
+        else
+            kernel<<<grid, hipblas_tensor_threads, 0, stream>>>(rows,
+                                                                cols,
+                                                                view.batch,
+                                                                view.data,
+                                                                view.row_stride,
+                                                                view.col_stride,
+                                                                view.batch_stride,
+                                                                packed,
+                                                                1,
+                                                                rows,
+                                                                stride);
+        return hipGetLastError();
+    }
+}
+
+extern "C" hipblasStatus_t hipblasMatmulTensor(hipblasHandle_t        handle,
+                                               const void*            alpha,
+                                               const hipblasDLTensor* A,
+                                               const hipblasDLTensor* B,
+                                               const void*            beta,
+                                               const hipblasDLTensor* C,
+                                               hipblasComputeType_t   computeType)
+try
+{
+    HIPBLAS_ENTRY(handle, computeType);
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_tensor_view a, b, c;
+    hipblasStatus_t     status;
+    if((status = hipblas_tensor_view_of(A, a)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblas_tensor_view_of(B, b)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblas_tensor_view_of(C, c)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // A and B are broadcast over the batch of C when they have a batch of 1
+    int64_t m = c.rows, n = c.cols, k = a.cols;
+    if(a.rows != m || b.rows != k || b.cols != n || (a.batch != 1 && a.batch != c.batch)
+       || (b.batch != 1 && b.batch != c.batch) || (c.batch > 1 && !c.batch_stride))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(a.batch == 1)
+        a.batch_stride = 0;
+    if(b.batch == 1)
+        b.batch_stride = 0;
+
+    if(!m || !n || !c.batch)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || !c.data || (k && (!a.data || !b.data)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t stream;
+    if((status = hipblasGetStream(handle, &stream)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // the operands without a BLAS layout are copied to compact column major batches, which are
+    // packed one after the other in the scratch memory
+    hipblas_tensor_view* views[3] = {&a, &b, &c};
+    bool                 trans[3], copied[3];
+    int64_t              ld[3];
+    size_t               bytes[3], total = 0;
+    for(int t = 0; t < 3; t++)
+    {
+        hipblas_tensor_view& v = *views[t];
+        copied[t]              = !hipblas_tensor_layout(v, trans[t], ld[t]);
+        bytes[t]               = 0;
+        if(copied[t])
+        {
+            trans[t] = false;
+            ld[t]    = std::max<int64_t>(v.rows, 1);
+            bytes[t] = hipblas_scratch_pad(size_t(v.batch * v.rows * v.cols) * v.elem_size);
+            total += bytes[t];
+        }
+    }
+
+    char* scratch = nullptr;
+    if(total)
+    {
+        scratch = static_cast<char*>(hipblasGetScratch(handle, total, stream));
+        if(!scratch)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+
+    char*         data[3];
+    hipblasStride stride[3];
+    for(int t = 0; t < 3; t++)
+    {
+        hipblas_tensor_view& v = *views[t];
+        data[t]                = v.data;
+        stride[t]              = v.batch_stride;
+        if(copied[t])
+        {
+            data[t]   = scratch;
+            stride[t] = v.batch > 1 ? v.rows * v.cols : 0;
+            scratch += bytes[t];
+            if(hipblas_tensor_copy(v, data[t], false, stream) != hipSuccess)
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+        }
+    }
+
+    // C = A * B, or C^T = B^T * A^T when C is row major
+    auto op = [](bool transposed) { return transposed ? HIPBLAS_OP_T : HIPBLAS_OP_N; };
+    if(!trans[2])
+        status = hipblasGemmStridedBatchedEx_v2_64(handle,
+                                                   op(trans[0]),
+                                                   op(trans[1]),
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   data[0],
+                                                   a.type,
+                                                   ld[0],
+                                                   stride[0],
+                                                   data[1],
+                                                   b.type,
+                                                   ld[1],
+                                                   stride[1],
+                                                   beta,
+                                                   data[2],
+                                                   c.type,
+                                                   ld[2],
+                                                   stride[2],
+                                                   c.batch,
+                                                   computeType,
+                                                   HIPBLAS_GEMM_DEFAULT);
+    else
+        status = hipblasGemmStridedBatchedEx_v2_64(handle,
+                                                   op(!trans[1]),
+                                                   op(!trans[0]),
+                                                   n,
+                                                   m,
+                                                   k,
+                                                   alpha,
+                                                   data[1],
+                                                   b.type,
+                                                   ld[1],
+                                                   stride[1],
+                                                   data[0],
+                                                   a.type,
+                                                   ld[0],
+                                                   stride[0],
+                                                   beta,
+                                                   data[2],
+                                                   c.type,
+                                                   ld[2],
+                                                   stride[2],
+                                                   c.batch,
+                                                   computeType,
+                                                   HIPBLAS_GEMM_DEFAULT);
+
+    if(status == HIPBLAS_STATUS_SUCCESS && copied[2]
+       && hipblas_tensor_copy(c, data[2], true, stream) != hipSuccess)
+        status = HIPBLAS_STATUS_EXECUTION_FAILED;
+    return status;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
@@ -87,6 +87,7 @@ module hipblas_enums
     enum, bind(c)
         enumerator :: HIPBLAS_POINTER_MODE_HOST = 0
         enumerator :: HIPBLAS_POINTER_MODE_DEVICE = 1
+        enumerator :: HIPBLAS_POINTER_MODE_PINNED_HOST = 2
     end enum
 
     enum, bind(c)
@@ -106,6 +107,16 @@ module hipblas_enums
         enumerator :: HIPBLAS_GEMM_FLAGS_FP16_ALT_IMPL_RNZ = 16
     end enum
 
+    enum, bind(c)
+        enumerator :: HIPBLAS_EVECT_NONE = 0
+        enumerator :: HIPBLAS_EVECT_ORIGINAL = 1
+    end enum
+
+    enum, bind(c)
+        enumerator :: HIPBLAS_SVECT_NONE = 0
+        enumerator :: HIPBLAS_SVECT_SINGULAR = 1
+    end enum
+
 end module hipblas_enums
 
 module hipblas
@@ -320,6 +331,142 @@ module hipblas
         end function hipblasGetMatrixAsync
     end interface
 
+    interface
+        function hipblasSetVector_64(n, elemSize, x, incx, y, incy) &
+            bind(c, name='hipblasSetVector_64')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSetVector_64
+            integer(c_int64_t), value :: n
+            integer(c_int64_t), value :: elemSize
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+        end function hipblasSetVector_64
+    end interface
+
+    interface
+        function hipblasGetVector_64(n, elemSize, x, incx, y, incy) &
+            bind(c, name='hipblasGetVector_64')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGetVector_64
+            integer(c_int64_t), value :: n
+            integer(c_int64_t), value :: elemSize
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+        end function hipblasGetVector_64
+    end interface
+
+    interface
+        function hipblasSetMatrix_64(rows, cols, elemSize, A, lda, B, ldb) &
+            bind(c, name='hipblasSetMatrix_64')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSetMatrix_64
+            integer(c_int64_t), value :: rows
+            integer(c_int64_t), value :: cols
+            integer(c_int64_t), value :: elemSize
+            type(c_ptr), value :: A
+            integer(c_int64_t), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int64_t), value :: ldb
+        end function hipblasSetMatrix_64
+    end interface
+
+    interface
+        function hipblasGetMatrix_64(rows, cols, elemSize, A, lda, B, ldb) &
+            bind(c, name='hipblasGetMatrix_64')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGetMatrix_64
+            integer(c_int64_t), value :: rows
+            integer(c_int64_t), value :: cols
+            integer(c_int64_t), value :: elemSize
+            type(c_ptr), value :: A
+            integer(c_int64_t), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int64_t), value :: ldb
+        end function hipblasGetMatrix_64
+    end interface
+
+    interface
+        function hipblasSetVectorAsync_64(n, elemSize, x, incx, y, incy, stream) &
+            bind(c, name='hipblasSetVectorAsync_64')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSetVectorAsync_64
+            integer(c_int64_t), value :: n
+            integer(c_int64_t), value :: elemSize
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+            type(c_ptr), value :: stream
+        end function hipblasSetVectorAsync_64
+    end interface
+
+    interface
+        function hipblasGetVectorAsync_64(n, elemSize, x, incx, y, incy, stream) &
+            bind(c, name='hipblasGetVectorAsync_64')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGetVectorAsync_64
+            integer(c_int64_t), value :: n
+            integer(c_int64_t), value :: elemSize
+            type(c_ptr), value :: x
+            integer(c_int64_t), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int64_t), value :: incy
+            type(c_ptr), value :: stream
+        end function hipblasGetVectorAsync_64
+    end interface
+
+    interface
+        function hipblasSetMatrixAsync_64(rows, cols, elemSize, A, lda, B, ldb, stream) &
+            bind(c, name='hipblasSetMatrixAsync_64')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSetMatrixAsync_64
+            integer(c_int64_t), value :: rows
+            integer(c_int64_t), value :: cols
+            integer(c_int64_t), value :: elemSize
+            type(c_ptr), value :: A
+            integer(c_int64_t), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int64_t), value :: ldb
+            type(c_ptr), value :: stream
+        end function hipblasSetMatrixAsync_64
+    end interface
+
+    interface
+        function hipblasGetMatrixAsync_64(rows, cols, elemSize, A, lda, B, ldb, stream) &
+            bind(c, name='hipblasGetMatrixAsync_64')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGetMatrixAsync_64
+            integer(c_int64_t), value :: rows
+            integer(c_int64_t), value :: cols
+            integer(c_int64_t), value :: elemSize
+            type(c_ptr), value :: A
+            integer(c_int64_t), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int64_t), value :: ldb
+            type(c_ptr), value :: stream
+        end function hipblasGetMatrixAsync_64
+    end interface
+
     ! atomics mode
     interface
         function hipblasSetAtomicsMode(handle, atomics_mode) &
@@ -23947,7 +24094,7 @@ module hipblas
     !         use iso_c_binding
     !         use hipblas_enums
     !         implicit none
-    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCsyrkEx
+    !         integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCsyrkEx
     !         type(c_ptr), value :: handle
     !         integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
     !         integer(kind(HIPBLAS_OP_N)), value :: trans
@@ -23971,7 +24118,7 @@ module hipblas
     !         use iso_c_binding
     !         use hipblas_enums
     !         implicit none
-    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCherkEx
+    !         integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCherkEx
     !         type(c_ptr), value :: handle
     !         integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
     !         integer(kind(HIPBLAS_OP_N)), value :: trans
@@ -24792,6 +24939,71 @@ module hipblas
         end function hipblasScalStridedBatchedEx_64
     end interface
 
+    ! pointerArray
+    interface
+        function hipblasPointerArrayCreate(array, count) &
+            bind(c, name='hipblasPointerArrayCreate')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasPointerArrayCreate
+            type(c_ptr) :: array
+            integer(c_int), value :: count
+        end function hipblasPointerArrayCreate
+    end interface
+
+    interface
+        function hipblasPointerArrayDestroy(array) &
+            bind(c, name='hipblasPointerArrayDestroy')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasPointerArrayDestroy
+            type(c_ptr), value :: array
+        end function hipblasPointerArrayDestroy
+    end interface
+
+    interface
+        function hipblasPointerArraySet(handle, array, first, count, pointers) &
+            bind(c, name='hipblasPointerArraySet')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasPointerArraySet
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: array
+            integer(c_int), value :: first
+            integer(c_int), value :: count
+            type(c_ptr), value :: pointers
+        end function hipblasPointerArraySet
+    end interface
+
+    interface
+        function hipblasPointerArraySetOffsets(handle, array, base, offsets) &
+            bind(c, name='hipblasPointerArraySetOffsets')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasPointerArraySetOffsets
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: array
+            type(c_ptr), value :: base
+            type(c_ptr), value :: offsets
+        end function hipblasPointerArraySetOffsets
+    end interface
+
+    interface
+        function hipblasPointerArrayGetDevicePointer(array, devicePointers) &
+            bind(c, name='hipblasPointerArrayGetDevicePointer')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasPointerArrayGetDevicePointer
+            type(c_ptr), value :: array
+            type(c_ptr) :: devicePointers
+        end function hipblasPointerArrayGetDevicePointer
+    end interface
+
     !--------!
     ! Solver !
     !--------!
@@ -25505,6 +25717,83 @@ module hipblas
         end function hipblasZgeqrfBatched
     end interface
 
+    ! geqrf_batched_strided_tau
+    interface
+        function hipblasSgeqrfBatchedStridedTau(handle, m, n, A, lda, tau, strideT, info, batch_count) &
+            bind(c, name='hipblasSgeqrfBatchedStridedTau')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgeqrfBatchedStridedTau
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            integer(c_int64_t), value :: strideT
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasSgeqrfBatchedStridedTau
+    end interface
+
+    interface
+        function hipblasDgeqrfBatchedStridedTau(handle, m, n, A, lda, tau, strideT, info, batch_count) &
+            bind(c, name='hipblasDgeqrfBatchedStridedTau')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgeqrfBatchedStridedTau
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            integer(c_int64_t), value :: strideT
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasDgeqrfBatchedStridedTau
+    end interface
+
+    interface
+        function hipblasCgeqrfBatchedStridedTau(handle, m, n, A, lda, tau, strideT, info, batch_count) &
+            bind(c, name='hipblasCgeqrfBatchedStridedTau')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgeqrfBatchedStridedTau
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            integer(c_int64_t), value :: strideT
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasCgeqrfBatchedStridedTau
+    end interface
+
+    interface
+        function hipblasZgeqrfBatchedStridedTau(handle, m, n, A, lda, tau, strideT, info, batch_count) &
+            bind(c, name='hipblasZgeqrfBatchedStridedTau')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgeqrfBatchedStridedTau
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            integer(c_int64_t), value :: strideT
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasZgeqrfBatchedStridedTau
+    end interface
+
     ! geqrf_strided_batched
     interface
         function hipblasSgeqrfStridedBatched(handle, m, n, A, lda, stride_A, &
@@ -25592,7 +25881,7 @@ module hipblas
 
     ! gels
     interface
-        function hipblasSgels(handle, m, n, nrhs, trans, A, lda, B, ldb, info, deviceInfo) &
+        function hipblasSgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo) &
             bind(c, name = 'hipblasSgels')
             use iso_c_binding
             use hipblas_enums
@@ -25613,7 +25902,7 @@ module hipblas
     end interface
 
     interface
-        function hipblasDgels(handle, m, n, nrhs, trans, A, lda, B, ldb, info, deviceInfo) &
+        function hipblasDgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo) &
             bind(c, name = 'hipblasDgels')
             use iso_c_binding
             use hipblas_enums
@@ -25634,7 +25923,7 @@ module hipblas
     end interface
 
     interface
-        function hipblasCgels(handle, m, n, nrhs, trans, A, lda, B, ldb, info, deviceInfo) &
+        function hipblasCgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo) &
             bind(c, name = 'hipblasCgels')
             use iso_c_binding
             use hipblas_enums
@@ -25655,7 +25944,7 @@ module hipblas
     end interface
 
     interface
-        function hipblasZgels(handle, m, n, nrhs, trans, A, lda, B, ldb, info, deviceInfo) &
+        function hipblasZgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo) &
             bind(c, name = 'hipblasZgels')
             use iso_c_binding
             use hipblas_enums
@@ -25677,7 +25966,7 @@ module hipblas
 
     ! gelsBatched
     interface
-        function hipblasSgelsBatched(handle, m, n, nrhs, trans, A, lda, B, ldb, info, deviceInfo, batchCount) &
+        function hipblasSgelsBatched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount) &
                 bind(c, name = 'hipblasSgelsBatched')
             use iso_c_binding
             use hipblas_enums
@@ -25699,7 +25988,7 @@ module hipblas
     end interface
 
     interface
-        function hipblasDgelsBatched(handle, m, n, nrhs, trans, A, lda, B, ldb, info, deviceInfo, batchCount) &
+        function hipblasDgelsBatched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount) &
                 bind(c, name = 'hipblasDgelsBatched')
             use iso_c_binding
             use hipblas_enums
@@ -25721,7 +26010,7 @@ module hipblas
     end interface
 
     interface
-        function hipblasCgelsBatched(handle, m, n, nrhs, trans, A, lda, B, ldb, info, deviceInfo, batchCount) &
+        function hipblasCgelsBatched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount) &
                 bind(c, name = 'hipblasCgelsBatched')
             use iso_c_binding
             use hipblas_enums
@@ -25743,7 +26032,7 @@ module hipblas
     end interface
 
     interface
-        function hipblasZgelsBatched(handle, m, n, nrhs, trans, A, lda, B, ldb, info, deviceInfo, batchCount) &
+        function hipblasZgelsBatched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount) &
                 bind(c, name = 'hipblasZgelsBatched')
             use iso_c_binding
             use hipblas_enums
@@ -25766,7 +26055,7 @@ module hipblas
 
     ! gelsStridedBatched
     interface
-        function hipblasSgelsStridedBatched(handle, m, n, nrhs, trans, A, lda, strideA, &
+        function hipblasSgelsStridedBatched(handle, trans, m, n, nrhs, A, lda, strideA, &
             B, ldb, strideB, info, deviceInfo, batchCount) &
                 bind(c, name = 'hipblasSgelsStridedBatched')
             use iso_c_binding
@@ -25791,7 +26080,7 @@ module hipblas
     end interface
 
     interface
-        function hipblasDgelsStridedBatched(handle, m, n, nrhs, trans, A, lda, strideA, &
+        function hipblasDgelsStridedBatched(handle, trans, m, n, nrhs, A, lda, strideA, &
             B, ldb, strideB, info, deviceInfo, batchCount) &
                 bind(c, name = 'hipblasDgelsStridedBatched')
             use iso_c_binding
@@ -25816,7 +26105,7 @@ module hipblas
     end interface
 
     interface
-        function hipblasCgelsStridedBatched(handle, m, n, nrhs, trans, A, lda, strideA, &
+        function hipblasCgelsStridedBatched(handle, trans, m, n, nrhs, A, lda, strideA, &
             B, ldb, strideB, info, deviceInfo, batchCount) &
                 bind(c, name = 'hipblasCgelsStridedBatched')
             use iso_c_binding
@@ -25841,7 +26130,7 @@ module hipblas
     end interface
 
     interface
-        function hipblasZgelsStridedBatched(handle, m, n, nrhs, trans, A, lda, strideA, &
+        function hipblasZgelsStridedBatched(handle, trans, m, n, nrhs, A, lda, strideA, &
             B, ldb, strideB, info, deviceInfo, batchCount) &
                 bind(c, name = 'hipblasZgelsStridedBatched')
             use iso_c_binding
@@ -25865,4 +26154,2500 @@ module hipblas
         end function hipblasZgelsStridedBatched
     end interface
 
-end module hipblas
+    ! potrf
+    interface
+        function hipblasSpotrf(handle, uplo, n, A, lda, info) &
+            bind(c, name='hipblasSpotrf')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrf
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipblasSpotrf
+    end interface
+
+    interface
+        function hipblasDpotrf(handle, uplo, n, A, lda, info) &
+            bind(c, name='hipblasDpotrf')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrf
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipblasDpotrf
+    end interface
+
+    interface
+        function hipblasCpotrf(handle, uplo, n, A, lda, info) &
+            bind(c, name='hipblasCpotrf')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrf
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipblasCpotrf
+    end interface
+
+    interface
+        function hipblasZpotrf(handle, uplo, n, A, lda, info) &
+            bind(c, name='hipblasZpotrf')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrf
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipblasZpotrf
+    end interface
+
+    ! potrf_batched
+    interface
+        function hipblasSpotrfBatched(handle, uplo, n, A, lda, info, batchCount) &
+            bind(c, name='hipblasSpotrfBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrfBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasSpotrfBatched
+    end interface
+
+    interface
+        function hipblasDpotrfBatched(handle, uplo, n, A, lda, info, batchCount) &
+            bind(c, name='hipblasDpotrfBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrfBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasDpotrfBatched
+    end interface
+
+    interface
+        function hipblasCpotrfBatched(handle, uplo, n, A, lda, info, batchCount) &
+            bind(c, name='hipblasCpotrfBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrfBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasCpotrfBatched
+    end interface
+
+    interface
+        function hipblasZpotrfBatched(handle, uplo, n, A, lda, info, batchCount) &
+            bind(c, name='hipblasZpotrfBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrfBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasZpotrfBatched
+    end interface
+
+    ! potrf_strided_batched
+    interface
+        function hipblasSpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, &
+                                             batchCount) &
+            bind(c, name='hipblasSpotrfStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrfStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasSpotrfStridedBatched
+    end interface
+
+    interface
+        function hipblasDpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, &
+                                             batchCount) &
+            bind(c, name='hipblasDpotrfStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrfStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasDpotrfStridedBatched
+    end interface
+
+    interface
+        function hipblasCpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, &
+                                             batchCount) &
+            bind(c, name='hipblasCpotrfStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrfStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasCpotrfStridedBatched
+    end interface
+
+    interface
+        function hipblasZpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, &
+                                             batchCount) &
+            bind(c, name='hipblasZpotrfStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrfStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasZpotrfStridedBatched
+    end interface
+
+    ! potrs
+    interface
+        function hipblasSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info) &
+            bind(c, name='hipblasSpotrs')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrs
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+        end function hipblasSpotrs
+    end interface
+
+    interface
+        function hipblasDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info) &
+            bind(c, name='hipblasDpotrs')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrs
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+        end function hipblasDpotrs
+    end interface
+
+    interface
+        function hipblasCpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info) &
+            bind(c, name='hipblasCpotrs')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrs
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+        end function hipblasCpotrs
+    end interface
+
+    interface
+        function hipblasZpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info) &
+            bind(c, name='hipblasZpotrs')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrs
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+        end function hipblasZpotrs
+    end interface
+
+    ! potrs_batched
+    interface
+        function hipblasSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, &
+                                      batchCount) &
+            bind(c, name='hipblasSpotrsBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrsBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasSpotrsBatched
+    end interface
+
+    interface
+        function hipblasDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, &
+                                      batchCount) &
+            bind(c, name='hipblasDpotrsBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrsBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasDpotrsBatched
+    end interface
+
+    interface
+        function hipblasCpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, &
+                                      batchCount) &
+            bind(c, name='hipblasCpotrsBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrsBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasCpotrsBatched
+    end interface
+
+    interface
+        function hipblasZpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, &
+                                      batchCount) &
+            bind(c, name='hipblasZpotrsBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrsBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasZpotrsBatched
+    end interface
+
+    ! potrs_strided_batched
+    interface
+        function hipblasSpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, &
+                                             ldb, strideB, info, batchCount) &
+            bind(c, name='hipblasSpotrsStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrsStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasSpotrsStridedBatched
+    end interface
+
+    interface
+        function hipblasDpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, &
+                                             ldb, strideB, info, batchCount) &
+            bind(c, name='hipblasDpotrsStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrsStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasDpotrsStridedBatched
+    end interface
+
+    interface
+        function hipblasCpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, &
+                                             ldb, strideB, info, batchCount) &
+            bind(c, name='hipblasCpotrsStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrsStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasCpotrsStridedBatched
+    end interface
+
+    interface
+        function hipblasZpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, &
+                                             ldb, strideB, info, batchCount) &
+            bind(c, name='hipblasZpotrsStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrsStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasZpotrsStridedBatched
+    end interface
+
+    ! potri
+    interface
+        function hipblasSpotri(handle, uplo, n, A, lda, info) &
+            bind(c, name='hipblasSpotri')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotri
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipblasSpotri
+    end interface
+
+    interface
+        function hipblasDpotri(handle, uplo, n, A, lda, info) &
+            bind(c, name='hipblasDpotri')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotri
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipblasDpotri
+    end interface
+
+    interface
+        function hipblasCpotri(handle, uplo, n, A, lda, info) &
+            bind(c, name='hipblasCpotri')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotri
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipblasCpotri
+    end interface
+
+    interface
+        function hipblasZpotri(handle, uplo, n, A, lda, info) &
+            bind(c, name='hipblasZpotri')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotri
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipblasZpotri
+    end interface
+
+    ! potri_batched
+    interface
+        function hipblasSpotriBatched(handle, uplo, n, A, lda, info, batchCount) &
+            bind(c, name='hipblasSpotriBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotriBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasSpotriBatched
+    end interface
+
+    interface
+        function hipblasDpotriBatched(handle, uplo, n, A, lda, info, batchCount) &
+            bind(c, name='hipblasDpotriBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotriBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasDpotriBatched
+    end interface
+
+    interface
+        function hipblasCpotriBatched(handle, uplo, n, A, lda, info, batchCount) &
+            bind(c, name='hipblasCpotriBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotriBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasCpotriBatched
+    end interface
+
+    interface
+        function hipblasZpotriBatched(handle, uplo, n, A, lda, info, batchCount) &
+            bind(c, name='hipblasZpotriBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotriBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasZpotriBatched
+    end interface
+
+    ! potri_strided_batched
+    interface
+        function hipblasSpotriStridedBatched(handle, uplo, n, A, lda, strideA, info, &
+                                             batchCount) &
+            bind(c, name='hipblasSpotriStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotriStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasSpotriStridedBatched
+    end interface
+
+    interface
+        function hipblasDpotriStridedBatched(handle, uplo, n, A, lda, strideA, info, &
+                                             batchCount) &
+            bind(c, name='hipblasDpotriStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotriStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasDpotriStridedBatched
+    end interface
+
+    interface
+        function hipblasCpotriStridedBatched(handle, uplo, n, A, lda, strideA, info, &
+                                             batchCount) &
+            bind(c, name='hipblasCpotriStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotriStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasCpotriStridedBatched
+    end interface
+
+    interface
+        function hipblasZpotriStridedBatched(handle, uplo, n, A, lda, strideA, info, &
+                                             batchCount) &
+            bind(c, name='hipblasZpotriStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotriStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasZpotriStridedBatched
+    end interface
+
+    ! syevj
+    interface
+        function hipblasSsyevj(handle, evect, uplo, n, A, lda, abstol, residual, maxSweeps, &
+                               nSweeps, W, info) &
+            bind(c, name='hipblasSsyevj')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSsyevj
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            real(c_float), value :: abstol
+            type(c_ptr), value :: residual
+            integer(c_int), value :: maxSweeps
+            type(c_ptr), value :: nSweeps
+            type(c_ptr), value :: W
+            type(c_ptr), value :: info
+        end function hipblasSsyevj
+    end interface
+
+    interface
+        function hipblasDsyevj(handle, evect, uplo, n, A, lda, abstol, residual, maxSweeps, &
+                               nSweeps, W, info) &
+            bind(c, name='hipblasDsyevj')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDsyevj
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            real(c_double), value :: abstol
+            type(c_ptr), value :: residual
+            integer(c_int), value :: maxSweeps
+            type(c_ptr), value :: nSweeps
+            type(c_ptr), value :: W
+            type(c_ptr), value :: info
+        end function hipblasDsyevj
+    end interface
+
+    interface
+        function hipblasCheevj(handle, evect, uplo, n, A, lda, abstol, residual, maxSweeps, &
+                               nSweeps, W, info) &
+            bind(c, name='hipblasCheevj')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCheevj
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            real(c_float), value :: abstol
+            type(c_ptr), value :: residual
+            integer(c_int), value :: maxSweeps
+            type(c_ptr), value :: nSweeps
+            type(c_ptr), value :: W
+            type(c_ptr), value :: info
+        end function hipblasCheevj
+    end interface
+
+    interface
+        function hipblasZheevj(handle, evect, uplo, n, A, lda, abstol, residual, maxSweeps, &
+                               nSweeps, W, info) &
+            bind(c, name='hipblasZheevj')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZheevj
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            real(c_double), value :: abstol
+            type(c_ptr), value :: residual
+            integer(c_int), value :: maxSweeps
+            type(c_ptr), value :: nSweeps
+            type(c_ptr), value :: W
+            type(c_ptr), value :: info
+        end function hipblasZheevj
+    end interface
+
+    ! syevj_batched
+    interface
+        function hipblasSsyevjBatched(handle, evect, uplo, n, A, lda, abstol, residual, &
+                                      maxSweeps, nSweeps, W, strideW, info, batchCount) &
+            bind(c, name='hipblasSsyevjBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSsyevjBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            real(c_float), value :: abstol
+            type(c_ptr), value :: residual
+            integer(c_int), value :: maxSweeps
+            type(c_ptr), value :: nSweeps
+            type(c_ptr), value :: W
+            integer(c_int64_t), value :: strideW
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasSsyevjBatched
+    end interface
+
+    interface
+        function hipblasDsyevjBatched(handle, evect, uplo, n, A, lda, abstol, residual, &
+                                      maxSweeps, nSweeps, W, strideW, info, batchCount) &
+            bind(c, name='hipblasDsyevjBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDsyevjBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            real(c_double), value :: abstol
+            type(c_ptr), value :: residual
+            integer(c_int), value :: maxSweeps
+            type(c_ptr), value :: nSweeps
+            type(c_ptr), value :: W
+            integer(c_int64_t), value :: strideW
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasDsyevjBatched
+    end interface
+
+    interface
+        function hipblasCheevjBatched(handle, evect, uplo, n, A, lda, abstol, residual, &
+                                      maxSweeps, nSweeps, W, strideW, info, batchCount) &
+            bind(c, name='hipblasCheevjBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCheevjBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            real(c_float), value :: abstol
+            type(c_ptr), value :: residual
+            integer(c_int), value :: maxSweeps
+            type(c_ptr), value :: nSweeps
+            type(c_ptr), value :: W
+            integer(c_int64_t), value :: strideW
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasCheevjBatched
+    end interface
+
+    interface
+        function hipblasZheevjBatched(handle, evect, uplo, n, A, lda, abstol, residual, &
+                                      maxSweeps, nSweeps, W, strideW, info, batchCount) &
+            bind(c, name='hipblasZheevjBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZheevjBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            real(c_double), value :: abstol
+            type(c_ptr), value :: residual
+            integer(c_int), value :: maxSweeps
+            type(c_ptr), value :: nSweeps
+            type(c_ptr), value :: W
+            integer(c_int64_t), value :: strideW
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasZheevjBatched
+    end interface
+
+    ! syevj_strided_batched
+    interface
+        function hipblasSsyevjStridedBatched(handle, evect, uplo, n, A, lda, strideA, &
+                                             abstol, residual, maxSweeps, nSweeps, W, &
+                                             strideW, info, batchCount) &
+            bind(c, name='hipblasSsyevjStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSsyevjStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            real(c_float), value :: abstol
+            type(c_ptr), value :: residual
+            integer(c_int), value :: maxSweeps
+            type(c_ptr), value :: nSweeps
+            type(c_ptr), value :: W
+            integer(c_int64_t), value :: strideW
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasSsyevjStridedBatched
+    end interface
+
+    interface
+        function hipblasDsyevjStridedBatched(handle, evect, uplo, n, A, lda, strideA, &
+                                             abstol, residual, maxSweeps, nSweeps, W, &
+                                             strideW, info, batchCount) &
+            bind(c, name='hipblasDsyevjStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDsyevjStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            real(c_double), value :: abstol
+            type(c_ptr), value :: residual
+            integer(c_int), value :: maxSweeps
+            type(c_ptr), value :: nSweeps
+            type(c_ptr), value :: W
+            integer(c_int64_t), value :: strideW
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasDsyevjStridedBatched
+    end interface
+
+    interface
+        function hipblasCheevjStridedBatched(handle, evect, uplo, n, A, lda, strideA, &
+                                             abstol, residual, maxSweeps, nSweeps, W, &
+                                             strideW, info, batchCount) &
+            bind(c, name='hipblasCheevjStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCheevjStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            real(c_float), value :: abstol
+            type(c_ptr), value :: residual
+            integer(c_int), value :: maxSweeps
+            type(c_ptr), value :: nSweeps
+            type(c_ptr), value :: W
+            integer(c_int64_t), value :: strideW
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasCheevjStridedBatched
+    end interface
+
+    interface
+        function hipblasZheevjStridedBatched(handle, evect, uplo, n, A, lda, strideA, &
+                                             abstol, residual, maxSweeps, nSweeps, W, &
+                                             strideW, info, batchCount) &
+            bind(c, name='hipblasZheevjStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZheevjStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            real(c_double), value :: abstol
+            type(c_ptr), value :: residual
+            integer(c_int), value :: maxSweeps
+            type(c_ptr), value :: nSweeps
+            type(c_ptr), value :: W
+            integer(c_int64_t), value :: strideW
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasZheevjStridedBatched
+    end interface
+
+    ! syevd
+    interface
+        function hipblasSsyevd(handle, evect, uplo, n, A, lda, D, E, info) &
+            bind(c, name='hipblasSsyevd')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSsyevd
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: info
+        end function hipblasSsyevd
+    end interface
+
+    interface
+        function hipblasDsyevd(handle, evect, uplo, n, A, lda, D, E, info) &
+            bind(c, name='hipblasDsyevd')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDsyevd
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: info
+        end function hipblasDsyevd
+    end interface
+
+    interface
+        function hipblasCheevd(handle, evect, uplo, n, A, lda, D, E, info) &
+            bind(c, name='hipblasCheevd')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCheevd
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: info
+        end function hipblasCheevd
+    end interface
+
+    interface
+        function hipblasZheevd(handle, evect, uplo, n, A, lda, D, E, info) &
+            bind(c, name='hipblasZheevd')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZheevd
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_EVECT_NONE)), value :: evect
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: info
+        end function hipblasZheevd
+    end interface
+
+    ! gesvdj_batched
+    interface
+        function hipblasSgesvdjBatched(handle, leftSvect, rightSvect, m, n, A, lda, abstol, &
+                                       residual, maxSweeps, nSweeps, S, strideS, U, ldu, &
+                                       strideU, V, ldv, strideV, info, batchCount) &
+            bind(c, name='hipblasSgesvdjBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgesvdjBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SVECT_NONE)), value :: leftSvect
+            integer(kind(HIPBLAS_SVECT_NONE)), value :: rightSvect
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            real(c_float), value :: abstol
+            type(c_ptr), value :: residual
+            integer(c_int), value :: maxSweeps
+            type(c_ptr), value :: nSweeps
+            type(c_ptr), value :: S
+            integer(c_int64_t), value :: strideS
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            integer(c_int64_t), value :: strideU
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int64_t), value :: strideV
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasSgesvdjBatched
+    end interface
+
+    interface
+        function hipblasDgesvdjBatched(handle, leftSvect, rightSvect, m, n, A, lda, abstol, &
+                                       residual, maxSweeps, nSweeps, S, strideS, U, ldu, &
+                                       strideU, V, ldv, strideV, info, batchCount) &
+            bind(c, name='hipblasDgesvdjBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgesvdjBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SVECT_NONE)), value :: leftSvect
+            integer(kind(HIPBLAS_SVECT_NONE)), value :: rightSvect
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            real(c_double), value :: abstol
+            type(c_ptr), value :: residual
+            integer(c_int), value :: maxSweeps
+            type(c_ptr), value :: nSweeps
+            type(c_ptr), value :: S
+            integer(c_int64_t), value :: strideS
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            integer(c_int64_t), value :: strideU
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int64_t), value :: strideV
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasDgesvdjBatched
+    end interface
+
+    interface
+        function hipblasCgesvdjBatched(handle, leftSvect, rightSvect, m, n, A, lda, abstol, &
+                                       residual, maxSweeps, nSweeps, S, strideS, U, ldu, &
+                                       strideU, V, ldv, strideV, info, batchCount) &
+            bind(c, name='hipblasCgesvdjBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgesvdjBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SVECT_NONE)), value :: leftSvect
+            integer(kind(HIPBLAS_SVECT_NONE)), value :: rightSvect
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            real(c_float), value :: abstol
+            type(c_ptr), value :: residual
+            integer(c_int), value :: maxSweeps
+            type(c_ptr), value :: nSweeps
+            type(c_ptr), value :: S
+            integer(c_int64_t), value :: strideS
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            integer(c_int64_t), value :: strideU
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int64_t), value :: strideV
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasCgesvdjBatched
+    end interface
+
+    interface
+        function hipblasZgesvdjBatched(handle, leftSvect, rightSvect, m, n, A, lda, abstol, &
+                                       residual, maxSweeps, nSweeps, S, strideS, U, ldu, &
+                                       strideU, V, ldv, strideV, info, batchCount) &
+            bind(c, name='hipblasZgesvdjBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgesvdjBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SVECT_NONE)), value :: leftSvect
+            integer(kind(HIPBLAS_SVECT_NONE)), value :: rightSvect
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            real(c_double), value :: abstol
+            type(c_ptr), value :: residual
+            integer(c_int), value :: maxSweeps
+            type(c_ptr), value :: nSweeps
+            type(c_ptr), value :: S
+            integer(c_int64_t), value :: strideS
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            integer(c_int64_t), value :: strideU
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int64_t), value :: strideV
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasZgesvdjBatched
+    end interface
+
+    ! gesvdj_strided_batched
+    interface
+        function hipblasSgesvdjStridedBatched(handle, leftSvect, rightSvect, m, n, A, lda, &
+                                              strideA, abstol, residual, maxSweeps, &
+                                              nSweeps, S, strideS, U, ldu, strideU, V, ldv, &
+                                              strideV, info, batchCount) &
+            bind(c, name='hipblasSgesvdjStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgesvdjStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SVECT_NONE)), value :: leftSvect
+            integer(kind(HIPBLAS_SVECT_NONE)), value :: rightSvect
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            real(c_float), value :: abstol
+            type(c_ptr), value :: residual
+            integer(c_int), value :: maxSweeps
+            type(c_ptr), value :: nSweeps
+            type(c_ptr), value :: S
+            integer(c_int64_t), value :: strideS
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            integer(c_int64_t), value :: strideU
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int64_t), value :: strideV
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasSgesvdjStridedBatched
+    end interface
+
+    interface
+        function hipblasDgesvdjStridedBatched(handle, leftSvect, rightSvect, m, n, A, lda, &
+                                              strideA, abstol, residual, maxSweeps, &
+                                              nSweeps, S, strideS, U, ldu, strideU, V, ldv, &
+                                              strideV, info, batchCount) &
+            bind(c, name='hipblasDgesvdjStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgesvdjStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SVECT_NONE)), value :: leftSvect
+            integer(kind(HIPBLAS_SVECT_NONE)), value :: rightSvect
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            real(c_double), value :: abstol
+            type(c_ptr), value :: residual
+            integer(c_int), value :: maxSweeps
+            type(c_ptr), value :: nSweeps
+            type(c_ptr), value :: S
+            integer(c_int64_t), value :: strideS
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            integer(c_int64_t), value :: strideU
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int64_t), value :: strideV
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasDgesvdjStridedBatched
+    end interface
+
+    interface
+        function hipblasCgesvdjStridedBatched(handle, leftSvect, rightSvect, m, n, A, lda, &
+                                              strideA, abstol, residual, maxSweeps, &
+                                              nSweeps, S, strideS, U, ldu, strideU, V, ldv, &
+                                              strideV, info, batchCount) &
+            bind(c, name='hipblasCgesvdjStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgesvdjStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SVECT_NONE)), value :: leftSvect
+            integer(kind(HIPBLAS_SVECT_NONE)), value :: rightSvect
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            real(c_float), value :: abstol
+            type(c_ptr), value :: residual
+            integer(c_int), value :: maxSweeps
+            type(c_ptr), value :: nSweeps
+            type(c_ptr), value :: S
+            integer(c_int64_t), value :: strideS
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            integer(c_int64_t), value :: strideU
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int64_t), value :: strideV
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasCgesvdjStridedBatched
+    end interface
+
+    interface
+        function hipblasZgesvdjStridedBatched(handle, leftSvect, rightSvect, m, n, A, lda, &
+                                              strideA, abstol, residual, maxSweeps, &
+                                              nSweeps, S, strideS, U, ldu, strideU, V, ldv, &
+                                              strideV, info, batchCount) &
+            bind(c, name='hipblasZgesvdjStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgesvdjStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SVECT_NONE)), value :: leftSvect
+            integer(kind(HIPBLAS_SVECT_NONE)), value :: rightSvect
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            real(c_double), value :: abstol
+            type(c_ptr), value :: residual
+            integer(c_int), value :: maxSweeps
+            type(c_ptr), value :: nSweeps
+            type(c_ptr), value :: S
+            integer(c_int64_t), value :: strideS
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            integer(c_int64_t), value :: strideU
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int64_t), value :: strideV
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasZgesvdjStridedBatched
+    end interface
+
+    ! gesv_batched
+    interface
+        function hipblasSgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, &
+                                     batchCount) &
+            bind(c, name='hipblasSgesvBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgesvBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasSgesvBatched
+    end interface
+
+    interface
+        function hipblasDgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, &
+                                     batchCount) &
+            bind(c, name='hipblasDgesvBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgesvBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasDgesvBatched
+    end interface
+
+    interface
+        function hipblasCgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, &
+                                     batchCount) &
+            bind(c, name='hipblasCgesvBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgesvBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasCgesvBatched
+    end interface
+
+    interface
+        function hipblasZgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, &
+                                     batchCount) &
+            bind(c, name='hipblasZgesvBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgesvBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasZgesvBatched
+    end interface
+
+    ! gesv_strided_batched
+    interface
+        function hipblasSgesvStridedBatched(handle, n, nrhs, A, lda, strideA, ipiv, &
+                                            strideP, B, ldb, strideB, info, batchCount) &
+            bind(c, name='hipblasSgesvStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgesvStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasSgesvStridedBatched
+    end interface
+
+    interface
+        function hipblasDgesvStridedBatched(handle, n, nrhs, A, lda, strideA, ipiv, &
+                                            strideP, B, ldb, strideB, info, batchCount) &
+            bind(c, name='hipblasDgesvStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgesvStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasDgesvStridedBatched
+    end interface
+
+    interface
+        function hipblasCgesvStridedBatched(handle, n, nrhs, A, lda, strideA, ipiv, &
+                                            strideP, B, ldb, strideB, info, batchCount) &
+            bind(c, name='hipblasCgesvStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgesvStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasCgesvStridedBatched
+    end interface
+
+    interface
+        function hipblasZgesvStridedBatched(handle, n, nrhs, A, lda, strideA, ipiv, &
+                                            strideP, B, ldb, strideB, info, batchCount) &
+            bind(c, name='hipblasZgesvStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgesvStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasZgesvStridedBatched
+    end interface
+
+end module hipblas
+
+! Overloads of common functions for Fortran arrays in device memory, such as hipfort device arrays
+! or arrays mapped with the use_device_addr clause of OpenMP. The address of the first element of
+! each array, its leading dimension, increment or stride are passed to hipBLAS as they are, so
+! sections of larger arrays are used in place rather than copied in and out of a temporary. The
+! columns of a matrix must be contiguous, and the functions return HIPBLAS_STATUS_INVALID_VALUE if
+! they aren't or if the shapes of the arrays don't match. The sizes are taken from the shapes of
+! the arrays, and the scalars are host values, so the handle must be in HIPBLAS_POINTER_MODE_HOST.
+! The calls are asynchronous on the stream of the handle, as the functions they call.
+module hipblas_arrays
+    use iso_c_binding
+    use hipblas_enums
+    use hipblas
+    implicit none
+
+    private
+    public :: hipblasAxpy, hipblasScal, hipblasDot, hipblasDotc, hipblasDotu
+    public :: hipblasGemv, hipblasGemm, hipblasGemmStridedBatched, hipblasTrsm
+
+    interface hipblasAxpy
+        module procedure hipblasSaxpyArray, hipblasDaxpyArray, hipblasCaxpyArray, hipblasZaxpyArray
+    end interface hipblasAxpy
+
+    interface hipblasScal
+        module procedure hipblasSscalArray, hipblasDscalArray, hipblasCscalArray, hipblasZscalArray
+    end interface hipblasScal
+
+    interface hipblasDot
+        module procedure hipblasSdotArray, hipblasDdotArray
+    end interface hipblasDot
+
+    interface hipblasDotc
+        module procedure hipblasCdotcArray, hipblasZdotcArray
+    end interface hipblasDotc
+
+    interface hipblasDotu
+        module procedure hipblasCdotuArray, hipblasZdotuArray
+    end interface hipblasDotu
+
+    interface hipblasGemv
+        module procedure hipblasSgemvArray, hipblasDgemvArray, hipblasCgemvArray, hipblasZgemvArray
+    end interface hipblasGemv
+
+    interface hipblasGemm
+        module procedure hipblasSgemmArray, hipblasDgemmArray, hipblasCgemmArray, hipblasZgemmArray
+    end interface hipblasGemm
+
+    interface hipblasGemmStridedBatched
+        module procedure hipblasSgemmStridedBatchedArray, &
+                         hipblasDgemmStridedBatchedArray, &
+                         hipblasCgemmStridedBatchedArray, &
+                         hipblasZgemmStridedBatchedArray
+    end interface hipblasGemmStridedBatched
+
+    interface hipblasTrsm
+        module procedure hipblasStrsmArray, hipblasDtrsmArray, hipblasCtrsmArray, hipblasZtrsmArray
+    end interface hipblasTrsm
+
+contains
+
+    ! the distance from the element at first to the element at second, in elements
+    function hipblas_distance(first, second, elem_size) result(distance)
+        type(c_ptr), intent(in) :: first
+        type(c_ptr), intent(in) :: second
+        integer(c_size_t), intent(in) :: elem_size
+        integer(c_int64_t) :: distance
+        distance = (transfer(second, 0_c_intptr_t) - transfer(first, 0_c_intptr_t))/ &
+                   int(elem_size, c_intptr_t)
+    end function hipblas_distance
+
+    ! the rows of op(A) for an m by n matrix A
+    function hipblas_op_rows(trans, m, n) result(rows)
+        integer(kind(HIPBLAS_OP_N)), intent(in) :: trans
+        integer, intent(in) :: m
+        integer, intent(in) :: n
+        integer :: rows
+        if (trans == HIPBLAS_OP_N) then
+            rows = m
+        else
+            rows = n
+        end if
+    end function hipblas_op_rows
+
+    ! the address of the first element of x, which is the last one for a negative increment,
+    ! and the increment of x
+    subroutine hipblas_vector_s(x, ptr, inc)
+        real(c_float), target, intent(in) :: x(:)
+        type(c_ptr), intent(out) :: ptr
+        integer(c_int), intent(out) :: inc
+        ptr = c_null_ptr
+        inc = 1
+        if (size(x) == 0) return
+        ptr = c_loc(x(1))
+        if (size(x) > 1) inc = int(hipblas_distance(ptr, c_loc(x(2)), c_sizeof(x(1))), c_int)
+        if (inc < 0) ptr = c_loc(x(size(x)))
+    end subroutine hipblas_vector_s
+
+    ! the address of the first element of A and its leading dimension, which is -1 if the columns
+    ! of A aren't contiguous
+    subroutine hipblas_matrix_s(A, ptr, ld)
+        real(c_float), target, intent(in) :: A(:, :)
+        type(c_ptr), intent(out) :: ptr
+        integer(c_int), intent(out) :: ld
+        ptr = c_null_ptr
+        ld = max(1, size(A, 1))
+        if (size(A) == 0) return
+        ptr = c_loc(A(1, 1))
+        if (size(A, 2) > 1) &
+            ld = int(hipblas_distance(ptr, c_loc(A(1, 2)), c_sizeof(A(1, 1))), c_int)
+        if (size(A, 1) > 1) then
+            if (hipblas_distance(ptr, c_loc(A(2, 1)), c_sizeof(A(1, 1))) /= 1) ld = -1
+        end if
+        if (ld < size(A, 1)) ld = -1
+    end subroutine hipblas_matrix_s
+
+    ! the address of the first element of A, its leading dimension and the stride between its
+    ! matrices, with a leading dimension of -1 if the columns of A aren't contiguous
+    subroutine hipblas_batch_s(A, ptr, ld, stride)
+        real(c_float), target, intent(in) :: A(:, :, :)
+        type(c_ptr), intent(out) :: ptr
+        integer(c_int), intent(out) :: ld
+        integer(c_int64_t), intent(out) :: stride
+        type(c_ptr) :: first
+        stride = int(size(A, 1), c_int64_t)*size(A, 2)
+        if (size(A) == 0) then
+            ptr = c_null_ptr
+            ld = max(1, size(A, 1))
+            return
+        end if
+        call hipblas_matrix_s(A(:, :, 1), ptr, ld)
+        first = c_loc(A(1, 1, 1))
+        ptr = first
+        if (size(A, 3) > 1) &
+            stride = hipblas_distance(first, c_loc(A(1, 1, 2)), c_sizeof(A(1, 1, 1)))
+    end subroutine hipblas_batch_s
+
+    function hipblasSaxpyArray(handle, alpha, x, y) result(res)
+        type(c_ptr), intent(in) :: handle
+        real(c_float), target, intent(in) :: alpha
+        real(c_float), target, intent(in) :: x(:)
+        real(c_float), target, intent(inout) :: y(:)
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: px, py
+        integer(c_int) :: incx, incy
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        if (size(x) /= size(y)) return
+        call hipblas_vector_s(x, px, incx)
+        call hipblas_vector_s(y, py, incy)
+        res = hipblasSaxpy(handle, size(x), c_loc(alpha), px, incx, py, incy)
+    end function hipblasSaxpyArray
+
+    function hipblasSscalArray(handle, alpha, x) result(res)
+        type(c_ptr), intent(in) :: handle
+        real(c_float), target, intent(in) :: alpha
+        real(c_float), target, intent(inout) :: x(:)
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: px
+        integer(c_int) :: incx
+        call hipblas_vector_s(x, px, incx)
+        res = hipblasSscal(handle, size(x), c_loc(alpha), px, incx)
+    end function hipblasSscalArray
+
+    function hipblasSdotArray(handle, x, y, result) result(res)
+        type(c_ptr), intent(in) :: handle
+        real(c_float), target, intent(in) :: x(:)
+        real(c_float), target, intent(in) :: y(:)
+        real(c_float), target, intent(out) :: result
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: px, py
+        integer(c_int) :: incx, incy
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        if (size(x) /= size(y)) return
+        call hipblas_vector_s(x, px, incx)
+        call hipblas_vector_s(y, py, incy)
+        res = hipblasSdot(handle, size(x), px, incx, py, incy, c_loc(result))
+    end function hipblasSdotArray
+
+    function hipblasSgemvArray(handle, trans, alpha, A, x, beta, y) result(res)
+        type(c_ptr), intent(in) :: handle
+        integer(kind(HIPBLAS_OP_N)), intent(in) :: trans
+        real(c_float), target, intent(in) :: alpha
+        real(c_float), target, intent(in) :: A(:, :)
+        real(c_float), target, intent(in) :: x(:)
+        real(c_float), target, intent(in) :: beta
+        real(c_float), target, intent(inout) :: y(:)
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: pA, px, py
+        integer(c_int) :: lda, incx, incy
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        if (size(y) /= hipblas_op_rows(trans, size(A, 1), size(A, 2))) return
+        if (size(x) /= hipblas_op_rows(trans, size(A, 2), size(A, 1))) return
+        call hipblas_matrix_s(A, pA, lda)
+        if (lda < 0) return
+        call hipblas_vector_s(x, px, incx)
+        call hipblas_vector_s(y, py, incy)
+        res = hipblasSgemv(handle, trans, size(A, 1), size(A, 2), c_loc(alpha), pA, lda, &
+                             px, incx, c_loc(beta), py, incy)
+    end function hipblasSgemvArray
+
+    function hipblasSgemmArray(handle, transA, transB, alpha, A, B, beta, C) result(res)
+        type(c_ptr), intent(in) :: handle
+        integer(kind(HIPBLAS_OP_N)), intent(in) :: transA
+        integer(kind(HIPBLAS_OP_N)), intent(in) :: transB
+        real(c_float), target, intent(in) :: alpha
+        real(c_float), target, intent(in) :: A(:, :)
+        real(c_float), target, intent(in) :: B(:, :)
+        real(c_float), target, intent(in) :: beta
+        real(c_float), target, intent(inout) :: C(:, :)
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: pA, pB, pC
+        integer(c_int) :: lda, ldb, ldc
+        integer :: k
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        k = hipblas_op_rows(transA, size(A, 2), size(A, 1))
+        if (size(C, 1) /= hipblas_op_rows(transA, size(A, 1), size(A, 2))) return
+        if (k /= hipblas_op_rows(transB, size(B, 1), size(B, 2))) return
+        if (size(C, 2) /= hipblas_op_rows(transB, size(B, 2), size(B, 1))) return
+        call hipblas_matrix_s(A, pA, lda)
+        call hipblas_matrix_s(B, pB, ldb)
+        call hipblas_matrix_s(C, pC, ldc)
+        if (lda < 0 .or. ldb < 0 .or. ldc < 0) return
+        res = hipblasSgemm(handle, transA, transB, size(C, 1), size(C, 2), k, c_loc(alpha), &
+                             pA, lda, pB, ldb, c_loc(beta), pC, ldc)
+    end function hipblasSgemmArray
+
+    function hipblasSgemmStridedBatchedArray(handle, transA, transB, alpha, A, B, beta, C) &
+        result(res)
+        type(c_ptr), intent(in) :: handle
+        integer(kind(HIPBLAS_OP_N)), intent(in) :: transA
+        integer(kind(HIPBLAS_OP_N)), intent(in) :: transB
+        real(c_float), target, intent(in) :: alpha
+        real(c_float), target, intent(in) :: A(:, :, :)
+        real(c_float), target, intent(in) :: B(:, :, :)
+        real(c_float), target, intent(in) :: beta
+        real(c_float), target, intent(inout) :: C(:, :, :)
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: pA, pB, pC
+        integer(c_int) :: lda, ldb, ldc
+        integer(c_int64_t) :: strideA, strideB, strideC
+        integer :: k
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        k = hipblas_op_rows(transA, size(A, 2), size(A, 1))
+        if (size(C, 1) /= hipblas_op_rows(transA, size(A, 1), size(A, 2))) return
+        if (k /= hipblas_op_rows(transB, size(B, 1), size(B, 2))) return
+        if (size(C, 2) /= hipblas_op_rows(transB, size(B, 2), size(B, 1))) return
+        if (size(A, 3) /= size(C, 3) .or. size(B, 3) /= size(C, 3)) return
+        call hipblas_batch_s(A, pA, lda, strideA)
+        call hipblas_batch_s(B, pB, ldb, strideB)
+        call hipblas_batch_s(C, pC, ldc, strideC)
+        if (lda < 0 .or. ldb < 0 .or. ldc < 0) return
+        res = hipblasSgemmStridedBatched(handle, transA, transB, size(C, 1), size(C, 2), k, &
+                                           c_loc(alpha), pA, lda, strideA, pB, ldb, strideB, &
+                                           c_loc(beta), pC, ldc, strideC, size(C, 3))
+    end function hipblasSgemmStridedBatchedArray
+
+    function hipblasStrsmArray(handle, side, uplo, transA, diag, alpha, A, B) result(res)
+        type(c_ptr), intent(in) :: handle
+        integer(kind(HIPBLAS_SIDE_LEFT)), intent(in) :: side
+        integer(kind(HIPBLAS_FILL_MODE_UPPER)), intent(in) :: uplo
+        integer(kind(HIPBLAS_OP_N)), intent(in) :: transA
+        integer(kind(HIPBLAS_DIAG_NON_UNIT)), intent(in) :: diag
+        real(c_float), target, intent(in) :: alpha
+        real(c_float), target, intent(in) :: A(:, :)
+        real(c_float), target, intent(inout) :: B(:, :)
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: pA, pB
+        integer(c_int) :: lda, ldb
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        if (size(A, 1) /= size(A, 2)) return
+        if (side == HIPBLAS_SIDE_LEFT .and. size(A, 1) /= size(B, 1)) return
+        if (side /= HIPBLAS_SIDE_LEFT .and. size(A, 1) /= size(B, 2)) return
+        call hipblas_matrix_s(A, pA, lda)
+        call hipblas_matrix_s(B, pB, ldb)
+        if (lda < 0 .or. ldb < 0) return
+        res = hipblasStrsm(handle, side, uplo, transA, diag, size(B, 1), size(B, 2), &
+                             c_loc(alpha), pA, lda, pB, ldb)
+    end function hipblasStrsmArray
+
+    ! the address of the first element of x, which is the last one for a negative increment,
+    ! and the increment of x
+    subroutine hipblas_vector_d(x, ptr, inc)
+        real(c_double), target, intent(in) :: x(:)
+        type(c_ptr), intent(out) :: ptr
+        integer(c_int), intent(out) :: inc
+        ptr = c_null_ptr
+        inc = 1
+        if (size(x) == 0) return
+        ptr = c_loc(x(1))
+        if (size(x) > 1) inc = int(hipblas_distance(ptr, c_loc(x(2)), c_sizeof(x(1))), c_int)
+        if (inc < 0) ptr = c_loc(x(size(x)))
+    end subroutine hipblas_vector_d
+
+    ! the address of the first element of A and its leading dimension, which is -1 if the columns
+    ! of A aren't contiguous
+    subroutine hipblas_matrix_d(A, ptr, ld)
+        real(c_double), target, intent(in) :: A(:, :)
+        type(c_ptr), intent(out) :: ptr
+        integer(c_int), intent(out) :: ld
+        ptr = c_null_ptr
+        ld = max(1, size(A, 1))
+        if (size(A) == 0) return
+        ptr = c_loc(A(1, 1))
+        if (size(A, 2) > 1) &
+            ld = int(hipblas_distance(ptr, c_loc(A(1, 2)), c_sizeof(A(1, 1))), c_int)
+        if (size(A, 1) > 1) then
+            if (hipblas_distance(ptr, c_loc(A(2, 1)), c_sizeof(A(1, 1))) /= 1) ld = -1
+        end if
+        if (ld < size(A, 1)) ld = -1
+    end subroutine hipblas_matrix_d
+
+    ! the address of the first element of A, its leading dimension and the stride between its
+    ! matrices, with a leading dimension of -1 if the columns of A aren't contiguous
+    subroutine hipblas_batch_d(A, ptr, ld, stride)
+        real(c_double), target, intent(in) :: A(:, :, :)
+        type(c_ptr), intent(out) :: ptr
+        integer(c_int), intent(out) :: ld
+        integer(c_int64_t), intent(out) :: stride
+        type(c_ptr) :: first
+        stride = int(size(A, 1), c_int64_t)*size(A, 2)
+        if (size(A) == 0) then
+            ptr = c_null_ptr
+            ld = max(1, size(A, 1))
+            return
+        end if
+        call hipblas_matrix_d(A(:, :, 1), ptr, ld)
+        first = c_loc(A(1, 1, 1))
+        ptr = first
+        if (size(A, 3) > 1) &
+            stride = hipblas_distance(first, c_loc(A(1, 1, 2)), c_sizeof(A(1, 1, 1)))
+    end subroutine hipblas_batch_d
+
+    function hipblasDaxpyArray(handle, alpha, x, y) result(res)
+        type(c_ptr), intent(in) :: handle
+        real(c_double), target, intent(in) :: alpha
+        real(c_double), target, intent(in) :: x(:)
+        real(c_double), target, intent(inout) :: y(:)
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: px, py
+        integer(c_int) :: incx, incy
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        if (size(x) /= size(y)) return
+        call hipblas_vector_d(x, px, incx)
+        call hipblas_vector_d(y, py, incy)
+        res = hipblasDaxpy(handle, size(x), c_loc(alpha), px, incx, py, incy)
+    end function hipblasDaxpyArray
+
+    function hipblasDscalArray(handle, alpha, x) result(res)
+        type(c_ptr), intent(in) :: handle
+        real(c_double), target, intent(in) :: alpha
+        real(c_double), target, intent(inout) :: x(:)
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: px
+        integer(c_int) :: incx
+        call hipblas_vector_d(x, px, incx)
+        res = hipblasDscal(handle, size(x), c_loc(alpha), px, incx)
+    end function hipblasDscalArray
+
+    function hipblasDdotArray(handle, x, y, result) result(res)
+        type(c_ptr), intent(in) :: handle
+        real(c_double), target, intent(in) :: x(:)
+        real(c_double), target, intent(in) :: y(:)
+        real(c_double), target, intent(out) :: result
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: px, py
+        integer(c_int) :: incx, incy
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        if (size(x) /= size(y)) return
+        call hipblas_vector_d(x, px, incx)
+        call hipblas_vector_d(y, py, incy)
+        res = hipblasDdot(handle, size(x), px, incx, py, incy, c_loc(result))
+    end function hipblasDdotArray
+
+    function hipblasDgemvArray(handle, trans, alpha, A, x, beta, y) result(res)
+        type(c_ptr), intent(in) :: handle
+        integer(kind(HIPBLAS_OP_N)), intent(in) :: trans
+        real(c_double), target, intent(in) :: alpha
+        real(c_double), target, intent(in) :: A(:, :)
+        real(c_double), target, intent(in) :: x(:)
+        real(c_double), target, intent(in) :: beta
+        real(c_double), target, intent(inout) :: y(:)
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: pA, px, py
+        integer(c_int) :: lda, incx, incy
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        if (size(y) /= hipblas_op_rows(trans, size(A, 1), size(A, 2))) return
+        if (size(x) /= hipblas_op_rows(trans, size(A, 2), size(A, 1))) return
+        call hipblas_matrix_d(A, pA, lda)
+        if (lda < 0) return
+        call hipblas_vector_d(x, px, incx)
+        call hipblas_vector_d(y, py, incy)
+        res = hipblasDgemv(handle, trans, size(A, 1), size(A, 2), c_loc(alpha), pA, lda, &
+                             px, incx, c_loc(beta), py, incy)
+    end function hipblasDgemvArray
+
+    function hipblasDgemmArray(handle, transA, transB, alpha, A, B, beta, C) result(res)
+        type(c_ptr), intent(in) :: handle
+        integer(kind(HIPBLAS_OP_N)), intent(in) :: transA
+        integer(kind(HIPBLAS_OP_N)), intent(in) :: transB
+        real(c_double), target, intent(in) :: alpha
+        real(c_double), target, intent(in) :: A(:, :)
+        real(c_double), target, intent(in) :: B(:, :)
+        real(c_double), target, intent(in) :: beta
+        real(c_double), target, intent(inout) :: C(:, :)
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: pA, pB, pC
+        integer(c_int) :: lda, ldb, ldc
+        integer :: k
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        k = hipblas_op_rows(transA, size(A, 2), size(A, 1))
+        if (size(C, 1) /= hipblas_op_rows(transA, size(A, 1), size(A, 2))) return
+        if (k /= hipblas_op_rows(transB, size(B, 1), size(B, 2))) return
+        if (size(C, 2) /= hipblas_op_rows(transB, size(B, 2), size(B, 1))) return
+        call hipblas_matrix_d(A, pA, lda)
+        call hipblas_matrix_d(B, pB, ldb)
+        call hipblas_matrix_d(C, pC, ldc)
+        if (lda < 0 .or. ldb < 0 .or. ldc < 0) return
+        res = hipblasDgemm(handle, transA, transB, size(C, 1), size(C, 2), k, c_loc(alpha), &
+                             pA, lda, pB, ldb, c_loc(beta), pC, ldc)
+    end function hipblasDgemmArray
+
+    function hipblasDgemmStridedBatchedArray(handle, transA, transB, alpha, A, B, beta, C) &
+        result(res)
+        type(c_ptr), intent(in) :: handle
+        integer(kind(HIPBLAS_OP_N)), intent(in) :: transA
+        integer(kind(HIPBLAS_OP_N)), intent(in) :: transB
+        real(c_double), target, intent(in) :: alpha
+        real(c_double), target, intent(in) :: A(:, :, :)
+        real(c_double), target, intent(in) :: B(:, :, :)
+        real(c_double), target, intent(in) :: beta
+        real(c_double), target, intent(inout) :: C(:, :, :)
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: pA, pB, pC
+        integer(c_int) :: lda, ldb, ldc
+        integer(c_int64_t) :: strideA, strideB, strideC
+        integer :: k
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        k = hipblas_op_rows(transA, size(A, 2), size(A, 1))
+        if (size(C, 1) /= hipblas_op_rows(transA, size(A, 1), size(A, 2))) return
+        if (k /= hipblas_op_rows(transB, size(B, 1), size(B, 2))) return
+        if (size(C, 2) /= hipblas_op_rows(transB, size(B, 2), size(B, 1))) return
+        if (size(A, 3) /= size(C, 3) .or. size(B, 3) /= size(C, 3)) return
+        call hipblas_batch_d(A, pA, lda, strideA)
+        call hipblas_batch_d(B, pB, ldb, strideB)
+        call hipblas_batch_d(C, pC, ldc, strideC)
+        if (lda < 0 .or. ldb < 0 .or. ldc < 0) return
+        res = hipblasDgemmStridedBatched(handle, transA, transB, size(C, 1), size(C, 2), k, &
+                                           c_loc(alpha), pA, lda, strideA, pB, ldb, strideB, &
+                                           c_loc(beta), pC, ldc, strideC, size(C, 3))
+    end function hipblasDgemmStridedBatchedArray
+
+    function hipblasDtrsmArray(handle, side, uplo, transA, diag, alpha, A, B) result(res)
+        type(c_ptr), intent(in) :: handle
+        integer(kind(HIPBLAS_SIDE_LEFT)), intent(in) :: side
+        integer(kind(HIPBLAS_FILL_MODE_UPPER)), intent(in) :: uplo
+        integer(kind(HIPBLAS_OP_N)), intent(in) :: transA
+        integer(kind(HIPBLAS_DIAG_NON_UNIT)), intent(in) :: diag
+        real(c_double), target, intent(in) :: alpha
+        real(c_double), target, intent(in) :: A(:, :)
+        real(c_double), target, intent(inout) :: B(:, :)
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: pA, pB
+        integer(c_int) :: lda, ldb
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        if (size(A, 1) /= size(A, 2)) return
+        if (side == HIPBLAS_SIDE_LEFT .and. size(A, 1) /= size(B, 1)) return
+        if (side /= HIPBLAS_SIDE_LEFT .and. size(A, 1) /= size(B, 2)) return
+        call hipblas_matrix_d(A, pA, lda)
+        call hipblas_matrix_d(B, pB, ldb)
+        if (lda < 0 .or. ldb < 0) return
+        res = hipblasDtrsm(handle, side, uplo, transA, diag, size(B, 1), size(B, 2), &
+                             c_loc(alpha), pA, lda, pB, ldb)
+    end function hipblasDtrsmArray
+
+    ! the address of the first element of x, which is the last one for a negative increment,
+    ! and the increment of x
+    subroutine hipblas_vector_c(x, ptr, inc)
+        complex(c_float_complex), target, intent(in) :: x(:)
+        type(c_ptr), intent(out) :: ptr
+        integer(c_int), intent(out) :: inc
+        ptr = c_null_ptr
+        inc = 1
+        if (size(x) == 0) return
+        ptr = c_loc(x(1))
+        if (size(x) > 1) inc = int(hipblas_distance(ptr, c_loc(x(2)), c_sizeof(x(1))), c_int)
+        if (inc < 0) ptr = c_loc(x(size(x)))
+    end subroutine hipblas_vector_c
+
+    ! the address of the first element of A and its leading dimension, which is -1 if the columns
+    ! of A aren't contiguous
+    subroutine hipblas_matrix_c(A, ptr, ld)
+        complex(c_float_complex), target, intent(in) :: A(:, :)
+        type(c_ptr), intent(out) :: ptr
+        integer(c_int), intent(out) :: ld
+        ptr = c_null_ptr
+        ld = max(1, size(A, 1))
+        if (size(A) == 0) return
+        ptr = c_loc(A(1, 1))
+        if (size(A, 2) > 1) &
+            ld = int(hipblas_distance(ptr, c_loc(A(1, 2)), c_sizeof(A(1, 1))), c_int)
+        if (size(A, 1) > 1) then
+            if (hipblas_distance(ptr, c_loc(A(2, 1)), c_sizeof(A(1, 1))) /= 1) ld = -1
+        end if
+        if (ld < size(A, 1)) ld = -1
+    end subroutine hipblas_matrix_c
+
+    ! the address of the first element of A, its leading dimension and the stride between its
+    ! matrices, with a leading dimension of -1 if the columns of A aren't contiguous
+    subroutine hipblas_batch_c(A, ptr, ld, stride)
+        complex(c_float_complex), target, intent(in) :: A(:, :, :)
+        type(c_ptr), intent(out) :: ptr
+        integer(c_int), intent(out) :: ld
+        integer(c_int64_t), intent(out) :: stride
+        type(c_ptr) :: first
+        stride = int(size(A, 1), c_int64_t)*size(A, 2)
+        if (size(A) == 0) then
+            ptr = c_null_ptr
+            ld = max(1, size(A, 1))
+            return
+        end if
+        call hipblas_matrix_c(A(:, :, 1), ptr, ld)
+        first = c_loc(A(1, 1, 1))
+        ptr = first
+        if (size(A, 3) > 1) &
+            stride = hipblas_distance(first, c_loc(A(1, 1, 2)), c_sizeof(A(1, 1, 1)))
+    end subroutine hipblas_batch_c
+
+    function hipblasCaxpyArray(handle, alpha, x, y) result(res)
+        type(c_ptr), intent(in) :: handle
+        complex(c_float_complex), target, intent(in) :: alpha
+        complex(c_float_complex), target, intent(in) :: x(:)
+        complex(c_float_complex), target, intent(inout) :: y(:)
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: px, py
+        integer(c_int) :: incx, incy
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        if (size(x) /= size(y)) return
+        call hipblas_vector_c(x, px, incx)
+        call hipblas_vector_c(y, py, incy)
+        res = hipblasCaxpy(handle, size(x), c_loc(alpha), px, incx, py, incy)
+    end function hipblasCaxpyArray
+
+    function hipblasCscalArray(handle, alpha, x) result(res)
+        type(c_ptr), intent(in) :: handle
+        complex(c_float_complex), target, intent(in) :: alpha
+        complex(c_float_complex), target, intent(inout) :: x(:)
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: px
+        integer(c_int) :: incx
+        call hipblas_vector_c(x, px, incx)
+        res = hipblasCscal(handle, size(x), c_loc(alpha), px, incx)
+    end function hipblasCscalArray
+
+    function hipblasCdotcArray(handle, x, y, result) result(res)
+        type(c_ptr), intent(in) :: handle
+        complex(c_float_complex), target, intent(in) :: x(:)
+        complex(c_float_complex), target, intent(in) :: y(:)
+        complex(c_float_complex), target, intent(out) :: result
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: px, py
+        integer(c_int) :: incx, incy
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        if (size(x) /= size(y)) return
+        call hipblas_vector_c(x, px, incx)
+        call hipblas_vector_c(y, py, incy)
+        res = hipblasCdotc(handle, size(x), px, incx, py, incy, c_loc(result))
+    end function hipblasCdotcArray
+
+    function hipblasCdotuArray(handle, x, y, result) result(res)
+        type(c_ptr), intent(in) :: handle
+        complex(c_float_complex), target, intent(in) :: x(:)
+        complex(c_float_complex), target, intent(in) :: y(:)
+        complex(c_float_complex), target, intent(out) :: result
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: px, py
+        integer(c_int) :: incx, incy
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        if (size(x) /= size(y)) return
+        call hipblas_vector_c(x, px, incx)
+        call hipblas_vector_c(y, py, incy)
+        res = hipblasCdotu(handle, size(x), px, incx, py, incy, c_loc(result))
+    end function hipblasCdotuArray
+
+    function hipblasCgemvArray(handle, trans, alpha, A, x, beta, y) result(res)
+        type(c_ptr), intent(in) :: handle
+        integer(kind(HIPBLAS_OP_N)), intent(in) :: trans
+        complex(c_float_complex), target, intent(in) :: alpha
+        complex(c_float_complex), target, intent(in) :: A(:, :)
+        complex(c_float_complex), target, intent(in) :: x(:)
+        complex(c_float_complex), target, intent(in) :: beta
+        complex(c_float_complex), target, intent(inout) :: y(:)
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: pA, px, py
+        integer(c_int) :: lda, incx, incy
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        if (size(y) /= hipblas_op_rows(trans, size(A, 1), size(A, 2))) return
+        if (size(x) /= hipblas_op_rows(trans, size(A, 2), size(A, 1))) return
+        call hipblas_matrix_c(A, pA, lda)
+        if (lda < 0) return
+        call hipblas_vector_c(x, px, incx)
+        call hipblas_vector_c(y, py, incy)
+        res = hipblasCgemv(handle, trans, size(A, 1), size(A, 2), c_loc(alpha), pA, lda, &
+                             px, incx, c_loc(beta), py, incy)
+    end function hipblasCgemvArray
+
+    function hipblasCgemmArray(handle, transA, transB, alpha, A, B, beta, C) result(res)
+        type(c_ptr), intent(in) :: handle
+        integer(kind(HIPBLAS_OP_N)), intent(in) :: transA
+        integer(kind(HIPBLAS_OP_N)), intent(in) :: transB
+        complex(c_float_complex), target, intent(in) :: alpha
+        complex(c_float_complex), target, intent(in) :: A(:, :)
+        complex(c_float_complex), target, intent(in) :: B(:, :)
+        complex(c_float_complex), target, intent(in) :: beta
+        complex(c_float_complex), target, intent(inout) :: C(:, :)
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: pA, pB, pC
+        integer(c_int) :: lda, ldb, ldc
+        integer :: k
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        k = hipblas_op_rows(transA, size(A, 2), size(A, 1))
+        if (size(C, 1) /= hipblas_op_rows(transA, size(A, 1), size(A, 2))) return
+        if (k /= hipblas_op_rows(transB, size(B, 1), size(B, 2))) return
+        if (size(C, 2) /= hipblas_op_rows(transB, size(B, 2), size(B, 1))) return
+        call hipblas_matrix_c(A, pA, lda)
+        call hipblas_matrix_c(B, pB, ldb)
+        call hipblas_matrix_c(C, pC, ldc)
+        if (lda < 0 .or. ldb < 0 .or. ldc < 0) return
+        res = hipblasCgemm(handle, transA, transB, size(C, 1), size(C, 2), k, c_loc(alpha), &
+                             pA, lda, pB, ldb, c_loc(beta), pC, ldc)
+    end function hipblasCgemmArray
+
+    function hipblasCgemmStridedBatchedArray(handle, transA, transB, alpha, A, B, beta, C) &
+        result(res)
+        type(c_ptr), intent(in) :: handle
+        integer(kind(HIPBLAS_OP_N)), intent(in) :: transA
+        integer(kind(HIPBLAS_OP_N)), intent(in) :: transB
+        complex(c_float_complex), target, intent(in) :: alpha
+        complex(c_float_complex), target, intent(in) :: A(:, :, :)
+        complex(c_float_complex), target, intent(in) :: B(:, :, :)
+        complex(c_float_complex), target, intent(in) :: beta
+        complex(c_float_complex), target, intent(inout) :: C(:, :, :)
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: pA, pB, pC
+        integer(c_int) :: lda, ldb, ldc
+        integer(c_int64_t) :: strideA, strideB, strideC
+        integer :: k
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        k = hipblas_op_rows(transA, size(A, 2), size(A, 1))
+        if (size(C, 1) /= hipblas_op_rows(transA, size(A, 1), size(A, 2))) return
+        if (k /= hipblas_op_rows(transB, size(B, 1), size(B, 2))) return
+        if (size(C, 2) /= hipblas_op_rows(transB, size(B, 2), size(B, 1))) return
+        if (size(A, 3) /= size(C, 3) .or. size(B, 3) /= size(C, 3)) return
+        call hipblas_batch_c(A, pA, lda, strideA)
+        call hipblas_batch_c(B, pB, ldb, strideB)
+        call hipblas_batch_c(C, pC, ldc, strideC)
+        if (lda < 0 .or. ldb < 0 .or. ldc < 0) return
+        res = hipblasCgemmStridedBatched(handle, transA, transB, size(C, 1), size(C, 2), k, &
+                                           c_loc(alpha), pA, lda, strideA, pB, ldb, strideB, &
+                                           c_loc(beta), pC, ldc, strideC, size(C, 3))
+    end function hipblasCgemmStridedBatchedArray
+
+    function hipblasCtrsmArray(handle, side, uplo, transA, diag, alpha, A, B) result(res)
+        type(c_ptr), intent(in) :: handle
+        integer(kind(HIPBLAS_SIDE_LEFT)), intent(in) :: side
+        integer(kind(HIPBLAS_FILL_MODE_UPPER)), intent(in) :: uplo
+        integer(kind(HIPBLAS_OP_N)), intent(in) :: transA
+        integer(kind(HIPBLAS_DIAG_NON_UNIT)), intent(in) :: diag
+        complex(c_float_complex), target, intent(in) :: alpha
+        complex(c_float_complex), target, intent(in) :: A(:, :)
+        complex(c_float_complex), target, intent(inout) :: B(:, :)
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: pA, pB
+        integer(c_int) :: lda, ldb
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        if (size(A, 1) /= size(A, 2)) return
+        if (side == HIPBLAS_SIDE_LEFT .and. size(A, 1) /= size(B, 1)) return
+        if (side /= HIPBLAS_SIDE_LEFT .and. size(A, 1) /= size(B, 2)) return
+        call hipblas_matrix_c(A, pA, lda)
+        call hipblas_matrix_c(B, pB, ldb)
+        if (lda < 0 .or. ldb < 0) return
+        res = hipblasCtrsm(handle, side, uplo, transA, diag, size(B, 1), size(B, 2), &
+                             c_loc(alpha), pA, lda, pB, ldb)
+    end function hipblasCtrsmArray
+
+    ! the address of the first element of x, which is the last one for a negative increment,
+    ! and the increment of x
+    subroutine hipblas_vector_z(x, ptr, inc)
+        complex(c_double_complex), target, intent(in) :: x(:)
+        type(c_ptr), intent(out) :: ptr
+        integer(c_int), intent(out) :: inc
+        ptr = c_null_ptr
+        inc = 1
+        if (size(x) == 0) return
+        ptr = c_loc(x(1))
+        if (size(x) > 1) inc = int(hipblas_distance(ptr, c_loc(x(2)), c_sizeof(x(1))), c_int)
+        if (inc < 0) ptr = c_loc(x(size(x)))
+    end subroutine hipblas_vector_z
+
+    ! the address of the first element of A and its leading dimension, which is -1 if the columns
+    ! of A aren't contiguous
+    subroutine hipblas_matrix_z(A, ptr, ld)
+        complex(c_double_complex), target, intent(in) :: A(:, :)
+        type(c_ptr), intent(out) :: ptr
+        integer(c_int), intent(out) :: ld
+        ptr = c_null_ptr
+        ld = max(1, size(A, 1))
+        if (size(A) == 0) return
+        ptr = c_loc(A(1, 1))
+        if (size(A, 2) > 1) &
+            ld = int(hipblas_distance(ptr, c_loc(A(1, 2)), c_sizeof(A(1, 1))), c_int)
+        if (size(A, 1) > 1) then
+            if (hipblas_distance(ptr, c_loc(A(2, 1)), c_sizeof(A(1, 1))) /= 1) ld = -1
+        end if
+        if (ld < size(A, 1)) ld = -1
+    end subroutine hipblas_matrix_z
+
+    ! the address of the first element of A, its leading dimension and the stride between its
+    ! matrices, with a leading dimension of -1 if the columns of A aren't contiguous
+    subroutine hipblas_batch_z(A, ptr, ld, stride)
+        complex(c_double_complex), target, intent(in) :: A(:, :, :)
+        type(c_ptr), intent(out) :: ptr
+        integer(c_int), intent(out) :: ld
+        integer(c_int64_t), intent(out) :: stride
+        type(c_ptr) :: first
+        stride = int(size(A, 1), c_int64_t)*size(A, 2)
+        if (size(A) == 0) then
+            ptr = c_null_ptr
+            ld = max(1, size(A, 1))
+            return
+        end if
+        call hipblas_matrix_z(A(:, :, 1), ptr, ld)
+        first = c_loc(A(1, 1, 1))
+        ptr = first
+        if (size(A, 3) > 1) &
+            stride = hipblas_distance(first, c_loc(A(1, 1, 2)), c_sizeof(A(1, 1, 1)))
+    end subroutine hipblas_batch_z
+
+    function hipblasZaxpyArray(handle, alpha, x, y) result(res)
+        type(c_ptr), intent(in) :: handle
+        complex(c_double_complex), target, intent(in) :: alpha
+        complex(c_double_complex), target, intent(in) :: x(:)
+        complex(c_double_complex), target, intent(inout) :: y(:)
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: px, py
+        integer(c_int) :: incx, incy
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        if (size(x) /= size(y)) return
+        call hipblas_vector_z(x, px, incx)
+        call hipblas_vector_z(y, py, incy)
+        res = hipblasZaxpy(handle, size(x), c_loc(alpha), px, incx, py, incy)
+    end function hipblasZaxpyArray
+
+    function hipblasZscalArray(handle, alpha, x) result(res)
+        type(c_ptr), intent(in) :: handle
+        complex(c_double_complex), target, intent(in) :: alpha
+        complex(c_double_complex), target, intent(inout) :: x(:)
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: px
+        integer(c_int) :: incx
+        call hipblas_vector_z(x, px, incx)
+        res = hipblasZscal(handle, size(x), c_loc(alpha), px, incx)
+    end function hipblasZscalArray
+
+    function hipblasZdotcArray(handle, x, y, result) result(res)
+        type(c_ptr), intent(in) :: handle
+        complex(c_double_complex), target, intent(in) :: x(:)
+        complex(c_double_complex), target, intent(in) :: y(:)
+        complex(c_double_complex), target, intent(out) :: result
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: px, py
+        integer(c_int) :: incx, incy
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        if (size(x) /= size(y)) return
+        call hipblas_vector_z(x, px, incx)
+        call hipblas_vector_z(y, py, incy)
+        res = hipblasZdotc(handle, size(x), px, incx, py, incy, c_loc(result))
+    end function hipblasZdotcArray
+
+    function hipblasZdotuArray(handle, x, y, result) result(res)
+        type(c_ptr), intent(in) :: handle
+        complex(c_double_complex), target, intent(in) :: x(:)
+        complex(c_double_complex), target, intent(in) :: y(:)
+        complex(c_double_complex), target, intent(out) :: result
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: px, py
+        integer(c_int) :: incx, incy
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        if (size(x) /= size(y)) return
+        call hipblas_vector_z(x, px, incx)
+        call hipblas_vector_z(y, py, incy)
+        res = hipblasZdotu(handle, size(x), px, incx, py, incy, c_loc(result))
+    end function hipblasZdotuArray
+
+    function hipblasZgemvArray(handle, trans, alpha, A, x, beta, y) result(res)
+        type(c_ptr), intent(in) :: handle
+        integer(kind(HIPBLAS_OP_N)), intent(in) :: trans
+        complex(c_double_complex), target, intent(in) :: alpha
+        complex(c_double_complex), target, intent(in) :: A(:, :)
+        complex(c_double_complex), target, intent(in) :: x(:)
+        complex(c_double_complex), target, intent(in) :: beta
+        complex(c_double_complex), target, intent(inout) :: y(:)
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: pA, px, py
+        integer(c_int) :: lda, incx, incy
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        if (size(y) /= hipblas_op_rows(trans, size(A, 1), size(A, 2))) return
+        if (size(x) /= hipblas_op_rows(trans, size(A, 2), size(A, 1))) return
+        call hipblas_matrix_z(A, pA, lda)
+        if (lda < 0) return
+        call hipblas_vector_z(x, px, incx)
+        call hipblas_vector_z(y, py, incy)
+        res = hipblasZgemv(handle, trans, size(A, 1), size(A, 2), c_loc(alpha), pA, lda, &
+                             px, incx, c_loc(beta), py, incy)
+    end function hipblasZgemvArray
+
+    function hipblasZgemmArray(handle, transA, transB, alpha, A, B, beta, C) result(res)
+        type(c_ptr), intent(in) :: handle
+        integer(kind(HIPBLAS_OP_N)), intent(in) :: transA
+        integer(kind(HIPBLAS_OP_N)), intent(in) :: transB
+        complex(c_double_complex), target, intent(in) :: alpha
+        complex(c_double_complex), target, intent(in) :: A(:, :)
+        complex(c_double_complex), target, intent(in) :: B(:, :)
+        complex(c_double_complex), target, intent(in) :: beta
+        complex(c_double_complex), target, intent(inout) :: C(:, :)
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: pA, pB, pC
+        integer(c_int) :: lda, ldb, ldc
+        integer :: k
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        k = hipblas_op_rows(transA, size(A, 2), size(A, 1))
+        if (size(C, 1) /= hipblas_op_rows(transA, size(A, 1), size(A, 2))) return
+        if (k /= hipblas_op_rows(transB, size(B, 1), size(B, 2))) return
+        if (size(C, 2) /= hipblas_op_rows(transB, size(B, 2), size(B, 1))) return
+        call hipblas_matrix_z(A, pA, lda)
+        call hipblas_matrix_z(B, pB, ldb)
+        call hipblas_matrix_z(C, pC, ldc)
+        if (lda < 0 .or. ldb < 0 .or. ldc < 0) return
+        res = hipblasZgemm(handle, transA, transB, size(C, 1), size(C, 2), k, c_loc(alpha), &
+                             pA, lda, pB, ldb, c_loc(beta), pC, ldc)
+    end function hipblasZgemmArray
+
+    function hipblasZgemmStridedBatchedArray(handle, transA, transB, alpha, A, B, beta, C) &
+        result(res)
+        type(c_ptr), intent(in) :: handle
+        integer(kind(HIPBLAS_OP_N)), intent(in) :: transA
+        integer(kind(HIPBLAS_OP_N)), intent(in) :: transB
+        complex(c_double_complex), target, intent(in) :: alpha
+        complex(c_double_complex), target, intent(in) :: A(:, :, :)
+        complex(c_double_complex), target, intent(in) :: B(:, :, :)
+        complex(c_double_complex), target, intent(in) :: beta
+        complex(c_double_complex), target, intent(inout) :: C(:, :, :)
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: pA, pB, pC
+        integer(c_int) :: lda, ldb, ldc
+        integer(c_int64_t) :: strideA, strideB, strideC
+        integer :: k
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        k = hipblas_op_rows(transA, size(A, 2), size(A, 1))
+        if (size(C, 1) /= hipblas_op_rows(transA, size(A, 1), size(A, 2))) return
+        if (k /= hipblas_op_rows(transB, size(B, 1), size(B, 2))) return
+        if (size(C, 2) /= hipblas_op_rows(transB, size(B, 2), size(B, 1))) return
+        if (size(A, 3) /= size(C, 3) .or. size(B, 3) /= size(C, 3)) return
+        call hipblas_batch_z(A, pA, lda, strideA)
+        call hipblas_batch_z(B, pB, ldb, strideB)
+        call hipblas_batch_z(C, pC, ldc, strideC)
+        if (lda < 0 .or. ldb < 0 .or. ldc < 0) return
+        res = hipblasZgemmStridedBatched(handle, transA, transB, size(C, 1), size(C, 2), k, &
+                                           c_loc(alpha), pA, lda, strideA, pB, ldb, strideB, &
+                                           c_loc(beta), pC, ldc, strideC, size(C, 3))
+    end function hipblasZgemmStridedBatchedArray
+
+    function hipblasZtrsmArray(handle, side, uplo, transA, diag, alpha, A, B) result(res)
+        type(c_ptr), intent(in) :: handle
+        integer(kind(HIPBLAS_SIDE_LEFT)), intent(in) :: side
+        integer(kind(HIPBLAS_FILL_MODE_UPPER)), intent(in) :: uplo
+        integer(kind(HIPBLAS_OP_N)), intent(in) :: transA
+        integer(kind(HIPBLAS_DIAG_NON_UNIT)), intent(in) :: diag
+        complex(c_double_complex), target, intent(in) :: alpha
+        complex(c_double_complex), target, intent(in) :: A(:, :)
+        complex(c_double_complex), target, intent(inout) :: B(:, :)
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr) :: pA, pB
+        integer(c_int) :: lda, ldb
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        if (size(A, 1) /= size(A, 2)) return
+        if (side == HIPBLAS_SIDE_LEFT .and. size(A, 1) /= size(B, 1)) return
+        if (side /= HIPBLAS_SIDE_LEFT .and. size(A, 1) /= size(B, 2)) return
+        call hipblas_matrix_z(A, pA, lda)
+        call hipblas_matrix_z(B, pB, ldb)
+        if (lda < 0 .or. ldb < 0) return
+        res = hipblasZtrsm(handle, side, uplo, transA, diag, size(B, 1), size(B, 2), &
+                             c_loc(alpha), pA, lda, pB, ldb)
+    end function hipblasZtrsmArray
+
+end module hipblas_arrays
+
+! Device pointer arrays for the batched functions, such as hipblasSgetrfBatched and
+! hipblasSgelsBatched, built from a strided device buffer. The array is uploaded once when it is
+! created, and kept in device memory until it is destroyed, so the same batch is passed to any
+! number of batched calls through its pointers component without building an array of c_ptr on
+! the host each call. Pointing the batch at a new buffer only uploads the pointers that changed.
+module hipblas_batches
+    use iso_c_binding
+    use hipblas_enums
+    use hipblas
+    implicit none
+
+    private
+    public :: hipblas_batch_pointers
+    public :: hipblasBatchPointersCreate, hipblasBatchPointersSet, hipblasBatchPointersDestroy
+
+    type hipblas_batch_pointers
+        ! the hipblasPointerArray_t holding the pointers
+        type(c_ptr) :: array = c_null_ptr
+        ! the device array of the pointers, for the A, B and C arguments of the batched functions
+        type(c_ptr) :: pointers = c_null_ptr
+        integer(c_int) :: batch_count = 0
+    end type hipblas_batch_pointers
+
+contains
+
+    ! creates batch with the pointers base + i*stride for i = 0, ..., batch_count - 1, where
+    ! stride is in elements of elem_size bytes, as the stride of the strided batched functions
+    function hipblasBatchPointersCreate(handle, batch, base, stride, elem_size, batch_count) &
+        result(res)
+        type(c_ptr), intent(in) :: handle
+        type(hipblas_batch_pointers), intent(out) :: batch
+        type(c_ptr), intent(in) :: base
+        integer(c_int64_t), intent(in) :: stride
+        integer(c_size_t), intent(in) :: elem_size
+        integer(c_int), intent(in) :: batch_count
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: destroyed
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        if (batch_count < 0) return
+        res = hipblasPointerArrayCreate(batch%array, batch_count)
+        if (res /= HIPBLAS_STATUS_SUCCESS) return
+        batch%batch_count = batch_count
+        res = hipblasPointerArrayGetDevicePointer(batch%array, batch%pointers)
+        if (res == HIPBLAS_STATUS_SUCCESS) &
+            res = hipblasBatchPointersSet(handle, batch, base, stride, elem_size)
+        if (res /= HIPBLAS_STATUS_SUCCESS) destroyed = hipblasBatchPointersDestroy(batch)
+    end function hipblasBatchPointersCreate
+
+    ! points batch at base + i*stride, on the stream of handle; the pointers that are the same
+    ! as before aren't uploaded again
+    function hipblasBatchPointersSet(handle, batch, base, stride, elem_size) result(res)
+        type(c_ptr), intent(in) :: handle
+        type(hipblas_batch_pointers), intent(inout) :: batch
+        type(c_ptr), intent(in) :: base
+        integer(c_int64_t), intent(in) :: stride
+        integer(c_size_t), intent(in) :: elem_size
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        type(c_ptr), allocatable, target :: pointers(:)
+        integer(c_intptr_t) :: first, step
+        integer :: i
+        res = HIPBLAS_STATUS_INVALID_VALUE
+        if (.not. c_associated(batch%array)) return
+        if (batch%batch_count == 0) then
+            res = HIPBLAS_STATUS_SUCCESS
+            return
+        end if
+        if (.not. c_associated(base)) return
+        allocate(pointers(batch%batch_count))
+        first = transfer(base, 0_c_intptr_t)
+        step = int(stride, c_intptr_t)*int(elem_size, c_intptr_t)
+        do i = 1, batch%batch_count
+            pointers(i) = transfer(first + (i - 1)*step, c_null_ptr)
+        end do
+        res = hipblasPointerArraySet(handle, batch%array, 0, batch%batch_count, c_loc(pointers))
+    end function hipblasBatchPointersSet
+
+    ! frees the pointers of batch, after the work queued with them completes
+    function hipblasBatchPointersDestroy(batch) result(res)
+        type(hipblas_batch_pointers), intent(inout) :: batch
+        integer(kind(HIPBLAS_STATUS_SUCCESS)) :: res
+        res = HIPBLAS_STATUS_SUCCESS
+        if (c_associated(batch%array)) res = hipblasPointerArrayDestroy(batch%array)
+        batch%array = c_null_ptr
+        batch%pointers = c_null_ptr
+        batch%batch_count = 0
+    end function hipblasBatchPointersDestroy
+
+end module hipblas_batches
@@ -0,0 +1,478 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "exceptions.hpp"
+#include "hipblas_device_convert.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_persistent.hpp"
+
+// The persistent mode of a handle keeps one block per compute unit of a kernel resident on a
+// stream of its own. The kernel polls a ring of gemv descriptors in pinned host memory mapped to
+// the device, which a queued gemv fills and publishes by advancing the tail of the ring, so that
+// a call costs a few host stores instead of a launch. Every block computes its share of each
+// gemv, rows of y for op(A) = A and columns of A for the transposes, and the blocks then meet at
+// a barrier on counters in device memory, the last one to arrive publishing the calls done to
+// the host, so that a gemv sees the results of the ones before it.
+
+struct hipblasPersistentCall
+{
+    bool               stop;
+    hipDataType        a_type, y_type; // x has the type of A
+    bool               device_scalars;
+    hipblasOperation_t trans;
+    int                m, n, lda, incx, incy;
+    double             alpha, beta;
+    const void*        alpha_ptr;
+    const void*        beta_ptr;
+    const void*        A;
+    const void*        x;
+    void*              y;
+};
+
+struct hipblasPersistentRing
+{
+    uint64_t              tail; // written by the host
+    uint64_t              done; // written by the kernel
+    hipblasPersistentCall calls[1];
+};
+
+namespace
+{
+    constexpr int hipblas_persistent_threads = 256;
+
+    __device__ inline void hipblas_persistent_pause()
+    {
+#if defined(__HIP_PLATFORM_AMD__)
+        __builtin_amdgcn_s_sleep(2);
+#else
+        __nanosleep(100);
+#endif
+    }
+
+    template <typename Tc, hipDataType type>
+    __device__ inline Tc hipblas_persistent_load(const void* p, int64_t i)
+    {
+        if constexpr(type == HIP_R_16F)
+            return hipblas_float_decode(static_cast<const uint16_t*>(p)[i], hipblas_format_f16);
+        else if constexpr(type == HIP_R_16BF)
+            return hipblas_float_decode(static_cast<const uint16_t*>(p)[i], hipblas_format_bf16);
+        else if constexpr(type == HIP_R_32F)
+            return static_cast<const float*>(p)[i];
+        else
+            return static_cast<const double*>(p)[i];
+    }
+
+    template <typename Tc, hipDataType type>
+    __device__ inline void hipblas_persistent_store(void* p, int64_t i, Tc v)
+    {
+        if constexpr(type == HIP_R_16F)
+            static_cast<uint16_t*>(p)[i] = uint16_t(
+                hipblas_float_encode(v, hipblas_format_f16, HIPBLAS_ROUND_NEAREST_EVEN, false));
+        else if constexpr(type == HIP_R_16BF)
+            static_cast<uint16_t*>(p)[i] = uint16_t(
+                hipblas_float_encode(v, hipblas_format_bf16, HIPBLAS_ROUND_NEAREST_EVEN, false));
+        else if constexpr(type == HIP_R_32F)
+            static_cast<float*>(p)[i] = float(v);
+        else
+            static_cast<double*>(p)[i] = double(v);
+    }
+
+    // The offset of element i of a vector of n elements with increment inc, which for a
+    // negative inc starts from the end as in BLAS
+    __device__ inline int64_t hipblas_persistent_index(int64_t i, int n, int inc)
+    {
+        return inc >= 0 ? i * inc : (i - (n - 1)) * int64_t(inc);
+    }
+
+    // The share of the block of y = alpha op(A) x + beta y. y isn't read when beta is zero.
+    template <typename Tc, hipDataType a_type, hipDataType y_type>
+    __device__ void hipblas_persistent_gemv(const hipblasPersistentCall& g)
+    {
+        __shared__ Tc partial[hipblas_persistent_threads];
+
+        Tc alpha = g.device_scalars ? *static_cast<const Tc*>(g.alpha_ptr) : Tc(g.alpha);
+        Tc beta  = g.device_scalars ? *static_cast<const Tc*>(g.beta_ptr) : Tc(g.beta);
+
+        bool notrans = g.trans == HIPBLAS_OP_N;
+        int  ylen    = notrans ? g.m : g.n;
+        int  xlen    = notrans ? g.n : g.m;
+
+        auto finish = [&](int i, Tc sum) {
+            int64_t iy = hipblas_persistent_index(i, ylen, g.incy);
+            Tc      v  = alpha * sum;
+            if(beta != Tc(0))
+                v += beta * hipblas_persistent_load<Tc, y_type>(g.y, iy);
+            hipblas_persistent_store<Tc, y_type>(g.y, iy, v);
+        };
+
+        if(notrans)
+        {
+            // a thread per row, so that the loads of a column of A are coalesced
+            for(int i = blockIdx.x * blockDim.x + threadIdx.x; i < g.m;
+                i += gridDim.x * blockDim.x)
+            {
+                Tc sum = 0;
+                for(int j = 0; j < g.n; j++)
+                    sum += hipblas_persistent_load<Tc, a_type>(g.A, i + int64_t(j) * g.lda)
+                           * hipblas_persistent_load<Tc, a_type>(
+                               g.x, hipblas_persistent_index(j, xlen, g.incx));
+                finish(i, sum);
+            }
+            return;
+        }
+
+        // a block per column, reduced in shared memory
+        for(int j = blockIdx.x; j < g.n; j += gridDim.x)
+        {
+            Tc sum = 0;
+            for(int i = threadIdx.x; i < g.m; i += blockDim.x)
+                sum += hipblas_persistent_load<Tc, a_type>(g.A, i + int64_t(j) * g.lda)
+                       * hipblas_persistent_load<Tc, a_type>(
+                           g.x, hipblas_persistent_index(i, xlen, g.incx));
+            partial[threadIdx.x] = sum;
+            __syncthreads();
+            for(int s = blockDim.x / 2; s > 0; s /= 2)
+            {
+                if(threadIdx.x < s)
+                    partial[threadIdx.x] += partial[threadIdx.x + s];
+                __syncthreads();
+            }
+            if(threadIdx.x == 0)
+                finish(j, partial[0]);
+            __syncthreads();
+        }
+    }
+
+    __device__ inline void hipblas_persistent_dispatch(const hipblasPersistentCall& g)
+    {
+        switch(g.a_type)
+        {
+        case HIP_R_16F:
+            if(g.y_type == HIP_R_16F)
+                hipblas_persistent_gemv<float, HIP_R_16F, HIP_R_16F>(g);
+            else
+                hipblas_persistent_gemv<float, HIP_R_16F, HIP_R_32F>(g);
+            break;
+        case HIP_R_16BF:
+            if(g.y_type == HIP_R_16BF)
+                hipblas_persistent_gemv<float, HIP_R_16BF, HIP_R_16BF>(g);
+            else
+                hipblas_persistent_gemv<float, HIP_R_16BF, HIP_R_32F>(g);
+            break;
+        case HIP_R_32F:
+            hipblas_persistent_gemv<float, HIP_R_32F, HIP_R_32F>(g);
+            break;
+        default:
+            hipblas_persistent_gemv<double, HIP_R_64F, HIP_R_64F>(g);
+            break;
+        }
+    }
+
+    // counters[0] counts the arrivals of the blocks at the barriers, and counters[1] the calls
+    // done by every block
+    __global__ void __launch_bounds__(hipblas_persistent_threads)
+        hipblasPersistentKernel(hipblasPersistentRing* ring, uint64_t* counters, int size)
+    {
+        __shared__ hipblasPersistentCall g;
+
+        volatile uint64_t* tail = &ring->tail;
+        volatile uint64_t* done = &counters[1];
+        for(uint64_t call = 0;; call++)
+        {
+            if(threadIdx.x == 0)
+            {
+                while(*tail <= call)
+                    hipblas_persistent_pause();
+                __threadfence_system();
+                g = ring->calls[call % size];
+            }
+            __syncthreads();
+            if(g.stop)
+                return;
+
+            hipblas_persistent_dispatch(g);
+
+            __syncthreads();
+            if(threadIdx.x == 0)
+            {
+                __threadfence();
+                if(atomicAdd((unsigned long long*)&counters[0], 1ull)
+                   == (call + 1) * gridDim.x - 1)
+                {
+                    *done = call + 1;
+                    __threadfence_system();
+                    *(volatile uint64_t*)&ring->done = call + 1;
+                    __threadfence_system();
+                }
+                while(*done <= call)
+                    hipblas_persistent_pause();
+            }
+            __syncthreads();
+        }
+    }
+
+    // Waits until the kernel has done all but at most left of the queued calls
+    void hipblas_persistent_wait(const hipblasPersistentQueue& q, uint64_t left)
+    {
+        volatile uint64_t* done = &q.ring->done;
+        while(q.tail - *done > left)
+            std::this_thread::yield();
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+
+    void hipblas_persistent_push(hipblasPersistentQueue& q, const hipblasPersistentCall& g)
+    {
+        hipblas_persistent_wait(q, q.size - 1);
+        q.ring->calls[q.tail % q.size] = g;
+        std::atomic_thread_fence(std::memory_order_release);
+        *(volatile uint64_t*)&q.ring->tail = ++q.tail;
+    }
+
+    // Stops the kernel, once it is done with the queued calls, if running, and frees the memory
+    // and stream of q
+    void hipblas_persistent_release(hipblasPersistentQueue& q, bool running)
+    {
+        if(running)
+        {
+            hipblasPersistentCall g{};
+            g.stop = true;
+            hipblas_persistent_push(q, g);
+            (void)hipStreamSynchronize(q.stream);
+        }
+        if(q.stream)
+            (void)hipStreamDestroy(q.stream);
+        if(q.counters)
+            (void)hipFree(q.counters);
+        if(q.ring)
+            (void)hipHostFree(q.ring);
+        q.ring     = nullptr;
+        q.d_ring   = nullptr;
+        q.counters = nullptr;
+        q.stream   = nullptr;
+    }
+
+    bool hipblas_persistent_types(hipDataType          a_type,
+                                  hipDataType          x_type,
+                                  hipDataType          y_type,
+                                  hipblasComputeType_t compute_type)
+    {
+        if(a_type != x_type)
+            return false;
+        bool compute32 = compute_type == HIPBLAS_COMPUTE_32F
+                         || compute_type == HIPBLAS_COMPUTE_32F_PEDANTIC;
+        bool compute64 = compute_type == HIPBLAS_COMPUTE_64F
+                         || compute_type == HIPBLAS_COMPUTE_64F_PEDANTIC;
+        switch(a_type)
+        {
+        case HIP_R_16F:
+        case HIP_R_16BF:
+            return compute32 && (y_type == a_type || y_type == HIP_R_32F);
+        case HIP_R_32F:
+            return compute32 && y_type == HIP_R_32F;
+        case HIP_R_64F:
+            return compute64 && y_type == HIP_R_64F;
+        default:
+            return false;
+        }
+    }
+}
+
+hipblasPersistentQueue::~hipblasPersistentQueue()
+{
+    hipblas_persistent_release(*this, stream != nullptr);
+}
+
+hipblasStatus_t hipblasPersistentGemv(hipblasHandle_t      handle,
+                                      hipblasOperation_t   trans,
+                                      int                  m,
+                                      int                  n,
+                                      const void*          alpha,
+                                      const void*          A,
+                                      hipDataType          aType,
+                                      int                  lda,
+                                      const void*          x,
+                                      hipDataType          xType,
+                                      int                  incx,
+                                      const void*          beta,
+                                      void*                y,
+                                      hipDataType          yType,
+                                      int                  incy,
+                                      hipblasComputeType_t computeType)
+{
+    if(!hipblasIsPersistent(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    hipblasPersistentQueue& q = hipblasGetHandleState(handle)->persistent_queue;
+
+    // the calls that aren't queued, including the invalid ones for the backend to report, run
+    // after the queued ones are done
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    bool valid = (trans == HIPBLAS_OP_N || trans == HIPBLAS_OP_T || trans == HIPBLAS_OP_C)
+                 && m > 0 && n > 0 && lda >= m && incx != 0 && incy != 0 && alpha && beta && A
+                 && x && y;
+    if(!valid || !hipblas_persistent_types(aType, xType, yType, computeType))
+    {
+        hipblas_persistent_wait(q, 0);
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    hipblasPersistentCall g{};
+    g.a_type         = aType;
+    g.y_type         = yType;
+    g.device_scalars = mode == HIPBLAS_POINTER_MODE_DEVICE;
+    g.trans          = trans;
+    g.m              = m;
+    g.n              = n;
+    g.lda            = lda;
+    g.incx           = incx;
+    g.incy           = incy;
+    g.alpha_ptr      = alpha;
+    g.beta_ptr       = beta;
+    g.A              = A;
+    g.x              = x;
+    g.y              = y;
+    if(!g.device_scalars)
+    {
+        bool real64 = aType == HIP_R_64F;
+
+        g.alpha = real64 ? *static_cast<const double*>(alpha) : *static_cast<const float*>(alpha);
+        g.beta  = real64 ? *static_cast<const double*>(beta) : *static_cast<const float*>(beta);
+    }
+    hipblas_persistent_push(q, g);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasPersistentGemv(hipblasHandle_t    handle,
+                                      hipblasOperation_t trans,
+                                      int                m,
+                                      int                n,
+                                      const void*        alpha,
+                                      const void*        A,
+                                      int                lda,
+                                      const void*        x,
+                                      int                incx,
+                                      const void*        beta,
+                                      void*              y,
+                                      int                incy,
+                                      hipDataType        type)
+{
+    hipblasComputeType_t compute
+        = type == HIP_R_64F || type == HIP_C_64F ? HIPBLAS_COMPUTE_64F : HIPBLAS_COMPUTE_32F;
+    return hipblasPersistentGemv(
+        handle, trans, m, n, alpha, A, type, lda, x, type, incx, beta, y, type, incy, compute);
+}
+
+extern "C" hipblasStatus_t hipblasPersistentStart(hipblasHandle_t handle, int queueSize)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(queueSize < 1 || hipblasIsPersistent(handle))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasPersistentQueue& q = hipblasGetHandleState(handle)->persistent_queue;
+
+    int device, blocks;
+    if(hipGetDevice(&device) != hipSuccess
+       || hipDeviceGetAttribute(&blocks, hipDeviceAttributeMultiprocessorCount, device)
+              != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    size_t bytes = sizeof(hipblasPersistentRing) + (queueSize - 1) * sizeof(hipblasPersistentCall);
+    void*  ring  = nullptr;
+    if(hipHostMalloc(&ring, bytes, hipHostMallocMapped | hipHostMallocCoherent) != hipSuccess)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    q.ring       = static_cast<hipblasPersistentRing*>(ring);
+    q.ring->tail = 0;
+    q.ring->done = 0;
+    q.size       = queueSize;
+    q.tail       = 0;
+
+    void* d_ring = nullptr;
+    if(hipHostGetDevicePointer(&d_ring, ring, 0) != hipSuccess
+       || hipMalloc(&q.counters, 2 * sizeof(uint64_t)) != hipSuccess
+       || hipStreamCreateWithFlags(&q.stream, hipStreamNonBlocking) != hipSuccess
+       || hipMemsetAsync(q.counters, 0, 2 * sizeof(uint64_t), q.stream) != hipSuccess)
+    {
+        hipblas_persistent_release(q, false);
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    q.d_ring = static_cast<hipblasPersistentRing*>(d_ring);
+
+    hipblasPersistentKernel<<<blocks, hipblas_persistent_threads, 0, q.stream>>>(
+        q.d_ring, q.counters, queueSize);
+    if(hipGetLastError() != hipSuccess)
+    {
+        hipblas_persistent_release(q, false);
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    hipblasSetHandlePersistent(handle, true);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasPersistentSynchronize(hipblasHandle_t handle)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!hipblasIsPersistent(handle))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblas_persistent_wait(hipblasGetHandleState(handle)->persistent_queue, 0);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasPersistentStop(hipblasHandle_t handle)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!hipblasIsPersistent(handle))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // the stop is queued after the calls, and the kernel returns once they are done
+    hipblasSetHandlePersistent(handle, false);
+    hipblas_persistent_release(hipblasGetHandleState(handle)->persistent_queue, true);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
@@ -0,0 +1,546 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_fp16.h>
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_entry.hpp"
+
+// hipblasGemmPlanarComplexEx and hipblasGemvPlanarComplexEx, complex products of matrices and
+// vectors kept as separate real and imaginary parts, computed by the real gemms and gemvs of the
+// backend. With op(A) = Ar + i Ai and op(B) = Br + i Bi,
+//
+//     op(A) op(B) = (Ar Br - Ai Bi) + i (Ar Bi + Ai Br),
+//
+// so with real alpha and beta in host pointer mode the four real products are accumulated
+// straight into Cr and Ci. Otherwise the product is formed in the scratch memory of the handle,
+// by the four real products or, in HIPBLAS_GEMM_3M_MATH mode, by the three of the 3M algorithm of
+// hipblasCgemm3m, and a last kernel adds alpha times it to beta * C.
+
+namespace
+{
+    constexpr int hipblas_planar_tile = 32;
+    constexpr int hipblas_planar_rows = 8;
+
+    template <typename T>
+    using hipblas_complex_t
+        = std::conditional_t<std::is_same_v<T, float>, hipFloatComplex, hipDoubleComplex>;
+
+    // S := Xr + Xi or Xr - Xi for the rows by cols matrix X, packed with leading dimension rows
+    template <typename T>
+    __global__ void hipblasPlanarSumKernel(
+        int rows, int cols, const T* Xr, const T* Xi, int ldx, bool conj, T* S)
+    {
+        int i = blockIdx.x * hipblas_planar_tile + threadIdx.x;
+        if(i >= rows)
+            return;
+
+        int j_end = min(cols, int(blockIdx.y + 1) * hipblas_planar_tile);
+        for(int j = blockIdx.y * hipblas_planar_tile + threadIdx.y; j < j_end;
+            j += hipblas_planar_rows)
+        {
+            size_t x                = i + size_t(j) * ldx;
+            S[i + size_t(j) * rows] = conj ? Xr[x] - Xi[x] : Xr[x] + Xi[x];
+        }
+    }
+
+    // C := alpha * W + beta * C for the m by n product W in the planes P, P + plane and, for the
+    // 3M algorithm, P + 2 * plane: W = P1 + i P2, or W = (P1 - P2) + i (P3 - P1 - P2) when three.
+    // Element (i, j) of C is at i * incc + j * ldc of Cr and Ci. C isn't read when beta is zero.
+    // The scalars are read from alpha and beta when they aren't nullptr, in device pointer mode,
+    // and are alpha_value and beta_value otherwise.
+    template <typename T>
+    __global__ void hipblasPlanarCombineKernel(int                         m,
+                                               int                         n,
+                                               const T*                    P,
+                                               size_t                      plane,
+                                               bool                        three,
+                                               const hipblas_complex_t<T>* alpha,
+                                               hipblas_complex_t<T>        alpha_value,
+                                               const hipblas_complex_t<T>* beta,
+                                               hipblas_complex_t<T>        beta_value,
+                                               T*                          Cr,
+                                               T*                          Ci,
+                                               int64_t                     incc,
+                                               int64_t                     ldc)
+    {
+        int i = blockIdx.x * hipblas_planar_tile + threadIdx.x;
+        if(i >= m)
+            return;
+
+        hipblas_complex_t<T> a      = alpha ? *alpha : alpha_value;
+        hipblas_complex_t<T> b      = beta ? *beta : beta_value;
+        bool                 read_c = !hipblas_device_is_zero(b);
+
+        int j_end = min(n, int(blockIdx.y + 1) * hipblas_planar_tile);
+        for(int j = blockIdx.y * hipblas_planar_tile + threadIdx.y; j < j_end;
+            j += hipblas_planar_rows)
+        {
+            size_t               p = i + size_t(j) * m;
+            int64_t              q = i * incc + j * ldc;
+            hipblas_complex_t<T> w{}, c{};
+            if(three)
+            {
+                T p1 = P[p], p2 = P[plane + p], p3 = P[2 * plane + p];
+                w.x  = p1 - p2;
+                w.y  = p3 - p1 - p2;
+            }
+            else
+            {
+                w.x = P[p];
+                w.y = P[plane + p];
+            }
+            if(read_c)
+            {
+                c.x = Cr[q];
+                c.y = Ci[q];
+            }
+            c     = hipblas_device_axpby(a, w, b, c);
+            Cr[q] = c.x;
+            Ci[q] = c.y;
+        }
+    }
+
+    template <typename T>
+    hipError_t hipblas_planar_sum(int         rows,
+                                  int         cols,
+                                  const void* Xr,
+                                  const void* Xi,
+                                  int         ldx,
+                                  bool        conj,
+                                  void*       S,
+                                  hipStream_t stream)
+    {
+        dim3 grid((rows - 1) / hipblas_planar_tile + 1, (cols - 1) / hipblas_planar_tile + 1);
+        dim3 threads(hipblas_planar_tile, hipblas_planar_rows);
+        hipblasPlanarSumKernel<T><<<grid, threads, 0, stream>>>(rows,
+                                                                cols,
+                                                                static_cast<const T*>(Xr),
+                                                                static_cast<const T*>(Xi),
+                                                                ldx,
+                                                                conj,
+                                                                static_cast<T*>(S));
+        return hipGetLastError();
+    }
+
+    template <typename T>
+    hipError_t hipblas_planar_combine(int         m,
+                                      int         n,
+                                      const void* P,
+                                      size_t      plane,
+                                      bool        three,
+                                      const void* alpha,
+                                      const void* beta,
+                                      bool        host_scalars,
+                                      void*       Cr,
+                                      void*       Ci,
+                                      int64_t     incc,
+                                      int64_t     ldc,
+                                      hipStream_t stream)
+    {
+        using TC = hipblas_complex_t<T>;
+        dim3 grid((m - 1) / hipblas_planar_tile + 1, (n - 1) / hipblas_planar_tile + 1);
+        dim3 threads(hipblas_planar_tile, hipblas_planar_rows);
+        hipblasPlanarCombineKernel<T><<<grid, threads, 0, stream>>>(
+            m,
+            n,
+            static_cast<const T*>(P),
+            plane,
+            three,
+            host_scalars ? nullptr : static_cast<const TC*>(alpha),
+            host_scalars ? *static_cast<const TC*>(alpha) : TC{},
+            host_scalars ? nullptr : static_cast<const TC*>(beta),
+            host_scalars ? *static_cast<const TC*>(beta) : TC{},
+            static_cast<T*>(Cr),
+            static_cast<T*>(Ci),
+            incc,
+            ldc);
+        return hipGetLastError();
+    }
+
+    // The real or imaginary part of a complex scalar of the precision of type
+    double hipblas_planar_part(const void* x, bool is_float, int part)
+    {
+        return is_float ? static_cast<const float*>(x)[part] : static_cast<const double*>(x)[part];
+    }
+
+    // Runs the real products of a planar complex function in host pointer mode, with the scalars
+    // given as doubles, and restores the pointer mode of the handle when done
+    class hipblas_planar_products
+    {
+    public:
+        hipblas_planar_products(hipblasHandle_t handle, hipblasPointerMode_t mode, bool is_float)
+            : m_handle(handle)
+            , m_mode(mode)
+            , m_is_float(is_float)
+        {
+        }
+
+        ~hipblas_planar_products()
+        {
+            if(m_mode != HIPBLAS_POINTER_MODE_HOST)
+                hipblasSetPointerMode(m_handle, m_mode);
+        }
+
+        hipblasStatus_t host_mode()
+        {
+            return m_mode == HIPBLAS_POINTER_MODE_HOST
+                       ? HIPBLAS_STATUS_SUCCESS
+                       : hipblasSetPointerMode(m_handle, HIPBLAS_POINTER_MODE_HOST);
+        }
+
+        // pointers to alpha and beta in the precision of the products
+        std::pair<const void*, const void*> scalars(double alpha, double beta)
+        {
+            m_alpha   = alpha;
+            m_beta    = beta;
+            m_alpha_f = float(alpha);
+            m_beta_f  = float(beta);
+            if(m_is_float)
+                return {&m_alpha_f, &m_beta_f};
+            return {&m_alpha, &m_beta};
+        }
+
+    private:
+        hipblasHandle_t      m_handle;
+        hipblasPointerMode_t m_mode;
+        bool                 m_is_float;
+        double               m_alpha, m_beta;
+        float                m_alpha_f, m_beta_f;
+    };
+
+    // The real type of planar complex arguments, or HIP_R_8I for types that aren't supported
+    hipDataType hipblas_planar_type(hipDataType a_type, hipDataType b_type, hipDataType c_type)
+    {
+        if(a_type != b_type || a_type != c_type
+           || (a_type != HIP_R_32F && a_type != HIP_R_64F))
+            return HIP_R_8I;
+        return a_type;
+    }
+}
+
+extern "C" hipblasStatus_t hipblasGemmPlanarComplexEx(hipblasHandle_t      handle,
+                                                      hipblasOperation_t   transA,
+                                                      hipblasOperation_t   transB,
+                                                      int                  m,
+                                                      int                  n,
+                                                      int                  k,
+                                                      const void*          alpha,
+                                                      const void*          Ar,
+                                                      const void*          Ai,
+                                                      hipDataType          aType,
+                                                      int                  lda,
+                                                      const void*          Br,
+                                                      const void*          Bi,
+                                                      hipDataType          bType,
+                                                      int                  ldb,
+                                                      const void*          beta,
+                                                      void*                Cr,
+                                                      void*                Ci,
+                                                      hipDataType          cType,
+                                                      int                  ldc,
+                                                      hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_ENTRY(handle, transA, transB, m, n, k, aType, lda, bType, ldb, cType, ldc, computeType);
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    for(hipblasOperation_t trans : {transA, transB})
+        if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+    int rows_a = transA == HIPBLAS_OP_N ? m : k;
+    int cols_a = transA == HIPBLAS_OP_N ? k : m;
+    int rows_b = transB == HIPBLAS_OP_N ? k : n;
+    int cols_b = transB == HIPBLAS_OP_N ? n : k;
+    if(m < 0 || n < 0 || k < 0 || lda < std::max(rows_a, 1) || ldb < std::max(rows_b, 1)
+       || ldc < std::max(m, 1))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipDataType type = hipblas_planar_type(aType, bType, cType);
+    if(type == HIP_R_8I)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    if(!m || !n)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || !Cr || !Ci || (k && (!Ar || !Ai || !Br || !Bi)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasStatus_t      status;
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    if((status = hipblasGetStream(handle, &stream)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetPointerMode(handle, &mode)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    bool               is_float  = type == HIP_R_32F;
+    size_t             real_size = is_float ? sizeof(float) : sizeof(double);
+    hipblasOperation_t op_a      = transA == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+    hipblasOperation_t op_b      = transB == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+    double             sign_a    = transA == HIPBLAS_OP_C ? -1 : 1;
+    double             sign_b    = transB == HIPBLAS_OP_C ? -1 : 1;
+    bool               gemm_3m   = hipblasIsGemm3m(handle);
+
+    hipblas_planar_products products(handle, mode, is_float);
+    if((status = products.host_mode()) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // Z := alpha * op(X) * op(Y) + beta * Z
+    auto gemm = [&](double      a,
+                    const void* X,
+                    int         ldx,
+                    const void* Y,
+                    int         ldy,
+                    double      b,
+                    void*       Z,
+                    int         ldz) {
+        auto scalars = products.scalars(a, b);
+        return hipblasGemmEx_v2(handle,
+                                op_a,
+                                op_b,
+                                m,
+                                n,
+                                k,
+                                scalars.first,
+                                X,
+                                type,
+                                ldx,
+                                Y,
+                                type,
+                                ldy,
+                                scalars.second,
+                                Z,
+                                type,
+                                ldz,
+                                computeType,
+                                HIPBLAS_GEMM_DEFAULT);
+    };
+
+    // real alpha and beta: the four products are accumulated into Cr and Ci
+    if(mode == HIPBLAS_POINTER_MODE_HOST && !gemm_3m && !hipblas_planar_part(alpha, is_float, 1)
+       && !hipblas_planar_part(beta, is_float, 1))
+    {
+        double a = hipblas_planar_part(alpha, is_float, 0);
+        double b = hipblas_planar_part(beta, is_float, 0);
+        if((status = gemm(a, Ar, lda, Br, ldb, b, Cr, ldc)) != HIPBLAS_STATUS_SUCCESS
+           || (status = gemm(-sign_a * sign_b * a, Ai, lda, Bi, ldb, 1, Cr, ldc))
+                  != HIPBLAS_STATUS_SUCCESS
+           || (status = gemm(sign_b * a, Ar, lda, Bi, ldb, b, Ci, ldc)) != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return gemm(sign_a * a, Ai, lda, Br, ldb, 1, Ci, ldc);
+    }
+
+    // the m by n planes of the product, after the sums of the 3M algorithm
+    size_t plane   = size_t(m) * n;
+    size_t sum_a   = gemm_3m ? hipblas_scratch_pad(size_t(rows_a) * cols_a * real_size) : 0;
+    size_t sum_b   = gemm_3m ? hipblas_scratch_pad(size_t(rows_b) * cols_b * real_size) : 0;
+    int    planes  = gemm_3m ? 3 : 2;
+    char*  scratch = static_cast<char*>(
+        hipblasGetScratch(handle, sum_a + sum_b + planes * plane * real_size, stream));
+    if(!scratch)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    char* S_a = scratch;
+    char* S_b = S_a + sum_a;
+    char* P   = S_b + sum_b;
+    char* P2  = P + plane * real_size;
+    char* P3  = P2 + plane * real_size;
+
+    if(gemm_3m)
+    {
+        // P1 = Ar Br, P2 = Ai Bi and P3 = (Ar + Ai)(Br + Bi), with the signs of conjugation
+        auto sum = is_float ? hipblas_planar_sum<float> : hipblas_planar_sum<double>;
+        if(k
+           && (sum(rows_a, cols_a, Ar, Ai, lda, sign_a < 0, S_a, stream) != hipSuccess
+               || sum(rows_b, cols_b, Br, Bi, ldb, sign_b < 0, S_b, stream) != hipSuccess))
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        if((status = gemm(1, Ar, lda, Br, ldb, 0, P, m)) != HIPBLAS_STATUS_SUCCESS
+           || (status = gemm(sign_a * sign_b, Ai, lda, Bi, ldb, 0, P2, m)) != HIPBLAS_STATUS_SUCCESS
+           || (status = gemm(1, S_a, std::max(rows_a, 1), S_b, std::max(rows_b, 1), 0, P3, m))
+                  != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    else if((status = gemm(1, Ar, lda, Br, ldb, 0, P, m)) != HIPBLAS_STATUS_SUCCESS
+            || (status = gemm(-sign_a * sign_b, Ai, lda, Bi, ldb, 1, P, m))
+                   != HIPBLAS_STATUS_SUCCESS
+            || (status = gemm(sign_b, Ar, lda, Bi, ldb, 0, P2, m)) != HIPBLAS_STATUS_SUCCESS
+            || (status = gemm(sign_a, Ai, lda, Br, ldb, 1, P2, m)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    auto combine = is_float ? hipblas_planar_combine<float> : hipblas_planar_combine<double>;
+    if(combine(m,
+               n,
+               P,
+               plane,
+               gemm_3m,
+               alpha,
+               beta,
+               mode != HIPBLAS_POINTER_MODE_DEVICE,
+               Cr,
+               Ci,
+               1,
+               ldc,
+               stream)
+       != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGemvPlanarComplexEx(hipblasHandle_t      handle,
+                                                      hipblasOperation_t   trans,
+                                                      int                  m,
+                                                      int                  n,
+                                                      const void*          alpha,
+                                                      const void*          Ar,
+                                                      const void*          Ai,
+                                                      hipDataType          aType,
+                                                      int                  lda,
+                                                      const void*          xr,
+                                                      const void*          xi,
+                                                      hipDataType          xType,
+                                                      int                  incx,
+                                                      const void*          beta,
+                                                      void*                yr,
+                                                      void*                yi,
+                                                      hipDataType          yType,
+                                                      int                  incy,
+                                                      hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, aType, lda, xType, incx, yType, incy, computeType);
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(m < 0 || n < 0 || lda < std::max(m, 1) || !incx || !incy)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipDataType type = hipblas_planar_type(aType, xType, yType);
+    if(type == HIP_R_8I)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    if(!m || !n)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || !Ar || !Ai || !xr || !xi || !yr || !yi)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasStatus_t      status;
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    if((status = hipblasGetStream(handle, &stream)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetPointerMode(handle, &mode)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    bool               is_float = type == HIP_R_32F;
+    hipblasOperation_t op       = trans == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+    double             sign     = trans == HIPBLAS_OP_C ? -1 : 1;
+    int                y_len    = trans == HIPBLAS_OP_N ? m : n;
+
+    hipblas_planar_products products(handle, mode, is_float);
+    if((status = products.host_mode()) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // z := alpha * op(X) * v + beta * z
+    auto gemv = [&](double a, const void* X, const void* v, double b, void* z, int incz) {
+        auto scalars = products.scalars(a, b);
+        return hipblasGemvEx(handle,
+                             op,
+                             m,
+                             n,
+                             scalars.first,
+                             X,
+                             type,
+                             lda,
+                             v,
+                             type,
+                             incx,
+                             scalars.second,
+                             z,
+                             type,
+                             incz,
+                             computeType);
+    };
+
+    // real alpha and beta: the four products are accumulated into yr and yi
+    if(mode == HIPBLAS_POINTER_MODE_HOST && !hipblas_planar_part(alpha, is_float, 1)
+       && !hipblas_planar_part(beta, is_float, 1))
+    {
+        double a = hipblas_planar_part(alpha, is_float, 0);
+        double b = hipblas_planar_part(beta, is_float, 0);
+        if((status = gemv(a, Ar, xr, b, yr, incy)) != HIPBLAS_STATUS_SUCCESS
+           || (status = gemv(-sign * a, Ai, xi, 1, yr, incy)) != HIPBLAS_STATUS_SUCCESS
+           || (status = gemv(a, Ar, xi, b, yi, incy)) != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return gemv(sign * a, Ai, xr, 1, yi, incy);
+    }
+
+    // the product, in two planes of y_len elements
+    size_t real_size = is_float ? sizeof(float) : sizeof(double);
+    char*  P = static_cast<char*>(hipblasGetScratch(handle, 2 * y_len * real_size, stream));
+    if(!P)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    char* P2 = P + y_len * real_size;
+    if((status = gemv(1, Ar, xr, 0, P, 1)) != HIPBLAS_STATUS_SUCCESS
+       || (status = gemv(-sign, Ai, xi, 1, P, 1)) != HIPBLAS_STATUS_SUCCESS
+       || (status = gemv(1, Ar, xi, 0, P2, 1)) != HIPBLAS_STATUS_SUCCESS
+       || (status = gemv(sign, Ai, xr, 1, P2, 1)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // with a negative increment y is read from its last element back
+    int64_t offset = incy < 0 ? int64_t(1 - y_len) * incy * int64_t(real_size) : 0;
+    auto combine = is_float ? hipblas_planar_combine<float> : hipblas_planar_combine<double>;
+    if(combine(y_len,
+               1,
+               P,
+               y_len,
+               false,
+               alpha,
+               beta,
+               mode != HIPBLAS_POINTER_MODE_DEVICE,
+               static_cast<char*>(yr) + offset,
+               static_cast<char*>(yi) + offset,
+               incy,
+               0,
+               stream)
+       != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
@@ -0,0 +1,258 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "exceptions.hpp"
+
+// Pointer arrays for the batched functions that stay in device memory from call to call. A
+// pinned mirror of the array on the host holds the pointers last set, so that setting the array
+// again only writes the pointers that changed: a few are passed to a kernel as its arguments,
+// which costs no copy, and more are copied in one span from the mirror.
+
+namespace
+{
+    // Most changed pointers written by one kernel; more are copied from the mirror
+    constexpr int hipblas_pointer_array_updates = 32;
+    constexpr int hipblas_pointer_array_block   = 256;
+
+    struct hipblas_pointer_array_update
+    {
+        int   count;
+        int   index[hipblas_pointer_array_updates];
+        void* pointer[hipblas_pointer_array_updates];
+    };
+
+    __global__ void hipblasPointerArrayUpdateKernel(void** pointers,
+                                                    hipblas_pointer_array_update update)
+    {
+        int i = threadIdx.x;
+        if(i < update.count)
+            pointers[update.index[i]] = update.pointer[i];
+    }
+
+    __global__ void hipblasPointerArrayOffsetsKernel(
+        int count, void** pointers, const char* base, const int64_t* offsets)
+    {
+        for(int i = blockIdx.x * blockDim.x + threadIdx.x; i < count; i += gridDim.x * blockDim.x)
+            pointers[i] = const_cast<char*>(base) + offsets[i];
+    }
+}
+
+struct hipblasPointerArray
+{
+    int        count  = 0;
+    void**     device = nullptr;
+    void**     mirror = nullptr;
+    hipEvent_t copied = nullptr;
+
+    // The mirror is out of date after pointerArraySetOffsets, until the whole array is set again
+    bool mirror_valid = true;
+
+    // A copy from the mirror may still be reading it
+    bool copy_pending = false;
+
+    ~hipblasPointerArray()
+    {
+        if(copy_pending)
+            (void)hipEventSynchronize(copied);
+        if(device)
+            (void)hipFree(device);
+        if(mirror)
+            (void)hipHostFree(mirror);
+        if(copied)
+            (void)hipEventDestroy(copied);
+    }
+};
+
+extern "C" hipblasStatus_t hipblasPointerArrayCreate(hipblasPointerArray_t* array, int count)
+try
+{
+    if(!array)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *array = nullptr;
+    if(count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    auto   p     = new hipblasPointerArray;
+    size_t bytes = std::max(count, 1) * sizeof(void*);
+    p->count     = count;
+    if(hipMalloc(&p->device, bytes) != hipSuccess
+       || hipHostMalloc(&p->mirror, bytes, hipHostMallocDefault) != hipSuccess
+       || hipEventCreateWithFlags(&p->copied, hipEventDisableTiming) != hipSuccess
+       || hipMemset(p->device, 0, bytes) != hipSuccess)
+    {
+        delete p;
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    std::memset(p->mirror, 0, bytes);
+
+    *array = p;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasPointerArrayDestroy(hipblasPointerArray_t array)
+try
+{
+    delete array;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasPointerArraySet(hipblasHandle_t       handle,
+                                                  hipblasPointerArray_t array,
+                                                  int                   first,
+                                                  int                   count,
+                                                  void* const*          pointers)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!array || first < 0 || count < 0 || int64_t(first) + count > array->count)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!count)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!pointers)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // the mirror can't change under a copy that is still reading it
+    if(array->copy_pending)
+    {
+        if(hipEventSynchronize(array->copied) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        array->copy_pending = false;
+    }
+
+    // the pointers that changed, the first few of them by index, and the span of them all
+    hipblas_pointer_array_update update{};
+    int                          lo = -1, hi = -1, changed = 0;
+    for(int i = 0; i < count; i++)
+    {
+        int index = first + i;
+        if(array->mirror_valid && array->mirror[index] == pointers[i])
+            continue;
+        if(changed < hipblas_pointer_array_updates)
+        {
+            update.index[changed]   = index;
+            update.pointer[changed] = pointers[i];
+        }
+        changed++;
+        if(lo < 0)
+            lo = index;
+        hi                   = index;
+        array->mirror[index] = pointers[i];
+    }
+    if(!array->mirror_valid && first == 0 && count == array->count)
+        array->mirror_valid = true;
+    if(!changed)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    if(changed <= hipblas_pointer_array_updates)
+    {
+        update.count = changed;
+        hipblasPointerArrayUpdateKernel<<<1, hipblas_pointer_array_updates, 0, stream>>>(
+            array->device, update);
+        if(hipGetLastError() != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    if(hipMemcpyAsync(array->device + lo,
+                      array->mirror + lo,
+                      (hi - lo + 1) * sizeof(void*),
+                      hipMemcpyHostToDevice,
+                      stream)
+           != hipSuccess
+       || hipEventRecord(array->copied, stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    array->copy_pending = true;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasPointerArraySetOffsets(hipblasHandle_t       handle,
+                                                         hipblasPointerArray_t array,
+                                                         const void*           base,
+                                                         const int64_t*        offsets)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!array)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!array->count)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!base || !offsets)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    int blocks = std::min((array->count - 1) / hipblas_pointer_array_block + 1, 65535);
+    hipblasPointerArrayOffsetsKernel<<<blocks, hipblas_pointer_array_block, 0, stream>>>(
+        array->count, array->device, static_cast<const char*>(base), offsets);
+    if(hipGetLastError() != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    array->mirror_valid = false;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasPointerArrayGetDevicePointer(hipblasPointerArray_t array,
+                                                               void***               devicePointers)
+try
+{
+    if(!array || !devicePointers)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *devicePointers = array->device;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
@@ -0,0 +1,401 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas_profile.hpp"
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+// The formulas of the clients, so that the profile reports the GFLOP/s and GB/s of a shape as
+// hipblas-bench does when it is replayed
+#include "../../clients/include/bytes.hpp"
+#include "../../clients/include/flops.hpp"
+
+namespace
+{
+    template <typename T>
+    struct real_type
+    {
+        using type = T;
+    };
+
+    template <>
+    struct real_type<hipblasComplex>
+    {
+        using type = float;
+    };
+
+    template <>
+    struct real_type<hipblasDoubleComplex>
+    {
+        using type = double;
+    };
+
+    bool ends_with(const std::string& str, const char* suffix)
+    {
+        size_t len = strlen(suffix);
+        return str.size() >= len && str.compare(str.size() - len, len, suffix) == 0;
+    }
+
+    // T is the type of the data, U the type of the b_type of the shape and V of its c_type,
+    // which differ from T for the mixed precision scal and rot functions
+    template <typename T, typename U, typename V>
+    bool count(const std::string&         f,
+               const hipblasProfileShape& s,
+               double&                    gflop,
+               double&                    gbyte)
+    {
+        hipblasOperation_t transA = s.transA == 'T'   ? HIPBLAS_OP_T
+                                    : s.transA == 'C' ? HIPBLAS_OP_C
+                                                      : HIPBLAS_OP_N;
+        int64_t            dim_A  = s.side == 'L' ? s.M : s.N;
+
+        // rotm only has real precisions, counted with the flag hipblas-bench uses by default
+        if constexpr(std::is_floating_point<T>{})
+        {
+            if(f == "rotm")
+            {
+                gflop = rotm_gflop_count<T>(s.N, T(0));
+                gbyte = rotm_gbyte_count<T>(s.N, T(0));
+                return true;
+            }
+        }
+
+        gbyte = 0;
+        // level 1
+        if(f == "asum")
+        {
+            gflop = asum_gflop_count<T>(s.N);
+            gbyte = asum_gbyte_count<T>(s.N);
+        }
+        else if(f == "axpy")
+        {
+            gflop = axpy_gflop_count<T>(s.N);
+            gbyte = axpy_gbyte_count<T>(s.N);
+        }
+        else if(f == "copy")
+        {
+            gflop = copy_gflop_count<T>(s.N);
+            gbyte = copy_gbyte_count<T>(s.N);
+        }
+        else if(f == "dot")
+        {
+            gflop = dot_gflop_count<false, T>(s.N);
+            gbyte = dot_gbyte_count<T>(s.N);
+        }
+        else if(f == "dotc")
+        {
+            gflop = dot_gflop_count<true, T>(s.N);
+            gbyte = dot_gbyte_count<T>(s.N);
+        }
+        else if(f == "iamax" || f == "iamin")
+        {
+            gflop = iamax_gflop_count<T>(s.N);
+            gbyte = iamax_gbyte_count<T>(s.N);
+        }
+        else if(f == "nrm2")
+        {
+            gflop = nrm2_gflop_count<T>(s.N);
+            gbyte = nrm2_gbyte_count<T>(s.N);
+        }
+        else if(f == "rot")
+        {
+            gflop = rot_gflop_count<T, T, U, V>(s.N);
+            gbyte = rot_gbyte_count<T>(s.N);
+        }
+        else if(f == "scal")
+        {
+            gflop = scal_gflop_count<T, U>(s.N);
+            gbyte = scal_gbyte_count<T>(s.N);
+        }
+        else if(f == "swap")
+        {
+            gflop = swap_gflop_count<T>(s.N);
+            gbyte = swap_gbyte_count<T>(s.N);
+        }
+        // level 2
+        else if(f == "gbmv")
+        {
+            gflop = gbmv_gflop_count<T>(transA, s.M, s.N, s.KL, s.KU);
+            gbyte = gbmv_gbyte_count<T>(transA, s.M, s.N, s.KL, s.KU);
+        }
+        else if(f == "gemv")
+        {
+            gflop = gemv_gflop_count<T>(transA, s.M, s.N);
+            gbyte = gemv_gbyte_count<T>(transA, s.M, s.N);
+        }
+        else if(f == "ger" || f == "geru" || f == "gerc")
+        {
+            gflop = ger_gflop_count<T>(s.M, s.N);
+            gbyte = ger_gbyte_count<T>(s.M, s.N);
+        }
+        else if(f == "hbmv")
+        {
+            gflop = hbmv_gflop_count<T>(s.N, s.K);
+            gbyte = hbmv_gbyte_count<T>(s.N, s.K);
+        }
+        else if(f == "hemv")
+        {
+            gflop = hemv_gflop_count<T>(s.N);
+            gbyte = hemv_gbyte_count<T>(s.N);
+        }
+        else if(f == "her")
+        {
+            gflop = her_gflop_count<T>(s.N);
+            gbyte = her_gbyte_count<T>(s.N);
+        }
+        else if(f == "her2")
+        {
+            gflop = her2_gflop_count<T>(s.N);
+            gbyte = her2_gbyte_count<T>(s.N);
+        }
+        else if(f == "hpmv")
+        {
+            gflop = hpmv_gflop_count<T>(s.N);
+            gbyte = hpmv_gbyte_count<T>(s.N);
+        }
+        else if(f == "hpr")
+        {
+            gflop = hpr_gflop_count<T>(s.N);
+            gbyte = hpr_gbyte_count<T>(s.N);
+        }
+        else if(f == "hpr2")
+        {
+            gflop = hpr2_gflop_count<T>(s.N);
+            gbyte = hpr2_gbyte_count<T>(s.N);
+        }
+        else if(f == "sbmv")
+        {
+            gflop = sbmv_gflop_count<T>(s.N, s.K);
+            gbyte = sbmv_gbyte_count<T>(s.N, s.K);
+        }
+        else if(f == "spmv")
+        {
+            gflop = spmv_gflop_count<T>(s.N);
+            gbyte = spmv_gbyte_count<T>(s.N);
+        }
+        else if(f == "spr")
+        {
+            gflop = spr_gflop_count<T>(s.N);
+            gbyte = spr_gbyte_count<T>(s.N);
+        }
+        else if(f == "spr2")
+        {
+            gflop = spr2_gflop_count<T>(s.N);
+            gbyte = spr2_gbyte_count<T>(s.N);
+        }
+        else if(f == "symv")
+        {
+            gflop = symv_gflop_count<T>(s.N);
+            gbyte = symv_gbyte_count<T>(s.N);
+        }
+        else if(f == "syr")
+        {
+            gflop = syr_gflop_count<T>(s.N);
+            gbyte = syr_gbyte_count<T>(s.N);
+        }
+        else if(f == "syr2")
+        {
+            gflop = syr2_gflop_count<T>(s.N);
+            gbyte = syr2_gbyte_count<T>(s.N);
+        }
+        else if(f == "tbmv")
+        {
+            gflop = tbmv_gflop_count<T>(s.M, s.K);
+            gbyte = tbmv_gbyte_count<T>(s.M, s.K);
+        }
+        else if(f == "tbsv")
+        {
+            gflop = tbsv_gflop_count<T>(s.N, s.K);
+            gbyte = tbsv_gbyte_count<T>(s.N, s.K);
+        }
+        else if(f == "tpmv")
+        {
+            gflop = tpmv_gflop_count<T>(s.N);
+            gbyte = tpmv_gbyte_count<T>(s.N);
+        }
+        else if(f == "tpsv")
+        {
+            gflop = tpsv_gflop_count<T>(s.N);
+            gbyte = tpsv_gbyte_count<T>(s.N);
+        }
+        else if(f == "trmv")
+        {
+            gflop = trmv_gflop_count<T>(s.N);
+            gbyte = trmv_gbyte_count<T>(s.N);
+        }
+        else if(f == "trsv")
+        {
+            gflop = trsv_gflop_count<T>(s.N);
+            gbyte = trsv_gbyte_count<T>(s.N);
+        }
+        // level 3
+        else if(f == "dgmm")
+        {
+            gflop = dgmm_gflop_count<T>(s.M, s.N);
+            gbyte = dgmm_gbyte_count<T>(s.M, s.N, dim_A);
+        }
+        else if(f == "geam")
+        {
+            gflop = geam_gflop_count<T>(s.M, s.N);
+            gbyte = geam_gbyte_count<T>(s.M, s.N);
+        }
+        else if(f == "gemm")
+        {
+            gflop = gemm_gflop_count<T>(s.M, s.N, s.K);
+            gbyte = gemm_gbyte_count<T>(s.M, s.N, s.K);
+        }
+        else if(f == "hemm")
+        {
+            gflop = hemm_gflop_count<T>(s.M, s.N, dim_A);
+            gbyte = hemm_gbyte_count<T>(s.M, s.N, dim_A);
+        }
+        else if(f == "her2k")
+        {
+            gflop = her2k_gflop_count<T>(s.N, s.K);
+            gbyte = her2k_gbyte_count<T>(s.N, s.K);
+        }
+        else if(f == "herk")
+        {
+            gflop = herk_gflop_count<T>(s.N, s.K);
+            gbyte = herk_gbyte_count<T>(s.N, s.K);
+        }
+        else if(f == "herkx")
+        {
+            gflop = herkx_gflop_count<T>(s.N, s.K);
+            gbyte = herkx_gbyte_count<T>(s.N, s.K);
+        }
+        else if(f == "symm")
+        {
+            gflop = symm_gflop_count<T>(s.M, s.N, dim_A);
+            gbyte = symm_gbyte_count<T>(s.M, s.N, dim_A);
+        }
+        else if(f == "syr2k")
+        {
+            gflop = syr2k_gflop_count<T>(s.N, s.K);
+            gbyte = syr2k_gbyte_count<T>(s.N, s.K);
+        }
+        else if(f == "syrk")
+        {
+            gflop = syrk_gflop_count<T>(s.N, s.K);
+            gbyte = syrk_gbyte_count<T>(s.N, s.K);
+        }
+        else if(f == "syrkx")
+        {
+            gflop = syrkx_gflop_count<T>(s.N, s.K);
+            gbyte = syrkx_gbyte_count<T>(s.N, s.K);
+        }
+        else if(f == "trmm")
+        {
+            gflop = trmm_gflop_count<T>(s.M, s.N, dim_A);
+            gbyte = trmm_gbyte_count<T>(s.M, s.N, dim_A);
+        }
+        else if(f == "trsm")
+        {
+            gflop = trsm_gflop_count<T>(s.M, s.N, dim_A);
+            gbyte = trsm_gbyte_count<T>(s.M, s.N, dim_A);
+        }
+        else if(f == "trtri")
+        {
+            gflop = trtri_gflop_count<T>(s.N);
+            gbyte = trtri_gbyte_count<T>(s.N);
+        }
+        // solver
+        else if(f == "geqrf")
+            gflop = geqrf_gflop_count<T>(s.N, s.M);
+        else if(f == "getrf" || f == "getrf_npvt")
+            gflop = getrf_gflop_count<T>(s.N, s.N);
+        else if(f == "getri" || f == "getri_npvt")
+            gflop = getri_gflop_count<T>(s.N);
+        else if(f == "getrs")
+            gflop = getrs_gflop_count<T>(s.N, 1);
+        else if(f == "potrf")
+            gflop = potrf_gflop_count<T>(s.N);
+        else if(f == "potri")
+            gflop = potri_gflop_count<T>(s.N);
+        else if(f == "potrs")
+            gflop = potrs_gflop_count<T>(s.N, 1);
+        else
+            return false;
+        return true;
+    }
+
+    template <typename T>
+    bool count_type(const std::string&         f,
+                    const hipblasProfileShape& s,
+                    double&                    gflop,
+                    double&                    gbyte)
+    {
+        using R = typename real_type<T>::type;
+        if constexpr(!std::is_same<T, R>{})
+        {
+            bool real_b = s.b_type != s.a_type;
+            bool real_c = s.c_type != s.a_type;
+            if(real_b && real_c)
+                return count<T, R, R>(f, s, gflop, gbyte);
+            if(real_b)
+                return count<T, R, T>(f, s, gflop, gbyte);
+        }
+        return count<T, T, T>(f, s, gflop, gbyte);
+    }
+}
+
+bool hipblasProfileCount(const hipblasProfileShape& shape, double& gflop, double& gbyte)
+{
+    std::string f = shape.function, type = shape.a_type;
+    if(ends_with(f, "_ex"))
+    {
+        // gemm_ex counts in its compute type as hipblas-bench does, the other _ex functions
+        // in the type of their data
+        f.resize(f.size() - 3);
+        if(f.compare(0, 4, "gemm") == 0)
+            type = shape.compute_type;
+    }
+    if(ends_with(f, "_strided_batched"))
+        f.resize(f.size() - strlen("_strided_batched"));
+    else if(ends_with(f, "_batched"))
+        f.resize(f.size() - strlen("_batched"));
+
+    bool known = false;
+    if(type == "f32_r")
+        known = count_type<float>(f, shape, gflop, gbyte);
+    else if(type == "f64_r")
+        known = count_type<double>(f, shape, gflop, gbyte);
+    else if(type == "f32_c")
+        known = count_type<hipblasComplex>(f, shape, gflop, gbyte);
+    else if(type == "f64_c")
+        known = count_type<hipblasDoubleComplex>(f, shape, gflop, gbyte);
+    else if(type == "f16_r")
+        known = count_type<hipblasHalf>(f, shape, gflop, gbyte);
+    else if(type == "bf16_r")
+        known = count_type<hipblasBfloat16>(f, shape, gflop, gbyte);
+    else if(type == "i32_r")
+        known = count_type<int32_t>(f, shape, gflop, gbyte);
+
+    // hipblas-bench reports the batched functions over all of their problems
+    if(known && shape.batch_count > 1)
+    {
+        gflop *= shape.batch_count;
+        gbyte *= shape.batch_count;
+    }
+    return known;
+}
@@ -0,0 +1,533 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include "exceptions.hpp"
+#include "hipblas_entry.hpp"
+
+// An accumulator keeps the updates it records as the columns of U, alpha times x, and of V, y
+// for ger and gerc and x for syr and her, so that A + sum alpha_j x_j y_j^T is A + U V^T. The
+// columns are copied with the public API on the stream of the handle, or on the stream bound to it
+// for the calling thread, so the accumulator works the same on every backend, and A is read once
+// per flush instead of once per update.
+
+namespace
+{
+    hipblasStatus_t hipblas_rank1_copy(hipblasHandle_t h, int n, const float* x, int incx, float* y)
+    {
+        return hipblasScopy(h, n, x, incx, y, 1);
+    }
+
+    hipblasStatus_t
+        hipblas_rank1_copy(hipblasHandle_t h, int n, const double* x, int incx, double* y)
+    {
+        return hipblasDcopy(h, n, x, incx, y, 1);
+    }
+
+    hipblasStatus_t
+        hipblas_rank1_copy(hipblasHandle_t h, int n, const hipComplex* x, int incx, hipComplex* y)
+    {
+        return hipblasCcopy_v2(h, n, x, incx, y, 1);
+    }
+
+    hipblasStatus_t hipblas_rank1_copy(
+        hipblasHandle_t h, int n, const hipDoubleComplex* x, int incx, hipDoubleComplex* y)
+    {
+        return hipblasZcopy_v2(h, n, x, incx, y, 1);
+    }
+
+    hipblasStatus_t hipblas_rank1_scal(hipblasHandle_t h, int n, const float* alpha, float* x)
+    {
+        return hipblasSscal(h, n, alpha, x, 1);
+    }
+
+    hipblasStatus_t hipblas_rank1_scal(hipblasHandle_t h, int n, const double* alpha, double* x)
+    {
+        return hipblasDscal(h, n, alpha, x, 1);
+    }
+
+    hipblasStatus_t
+        hipblas_rank1_scal(hipblasHandle_t h, int n, const hipComplex* alpha, hipComplex* x)
+    {
+        return hipblasCscal_v2(h, n, alpha, x, 1);
+    }
+
+    hipblasStatus_t hipblas_rank1_scal(hipblasHandle_t         h,
+                                       int                     n,
+                                       const hipDoubleComplex* alpha,
+                                       hipDoubleComplex*       x)
+    {
+        return hipblasZscal_v2(h, n, alpha, x, 1);
+    }
+
+    // the real alpha of her
+    hipblasStatus_t hipblas_rank1_scal(hipblasHandle_t h, int n, const float* alpha, hipComplex* x)
+    {
+        return hipblasCsscal_v2(h, n, alpha, x, 1);
+    }
+
+    hipblasStatus_t
+        hipblas_rank1_scal(hipblasHandle_t h, int n, const double* alpha, hipDoubleComplex* x)
+    {
+        return hipblasZdscal_v2(h, n, alpha, x, 1);
+    }
+
+    template <typename T>
+    T hipblas_rank1_one()
+    {
+        return T(1);
+    }
+
+    template <>
+    hipComplex hipblas_rank1_one()
+    {
+        return make_hipFloatComplex(1, 0);
+    }
+
+    template <>
+    hipDoubleComplex hipblas_rank1_one()
+    {
+        return make_hipDoubleComplex(1, 0);
+    }
+
+    // A += U op(V)
+    hipblasStatus_t hipblas_rank1_gemm(hipblasHandle_t    h,
+                                       hipblasOperation_t transV,
+                                       int                m,
+                                       int                n,
+                                       int                k,
+                                       const float*       one,
+                                       const float*       U,
+                                       const float*       V,
+                                       float*             A,
+                                       int                lda)
+    {
+        return hipblasSgemm(h, HIPBLAS_OP_N, transV, m, n, k, one, U, m, V, n, one, A, lda);
+    }
+
+    hipblasStatus_t hipblas_rank1_gemm(hipblasHandle_t    h,
+                                       hipblasOperation_t transV,
+                                       int                m,
+                                       int                n,
+                                       int                k,
+                                       const double*      one,
+                                       const double*      U,
+                                       const double*      V,
+                                       double*            A,
+                                       int                lda)
+    {
+        return hipblasDgemm(h, HIPBLAS_OP_N, transV, m, n, k, one, U, m, V, n, one, A, lda);
+    }
+
+    hipblasStatus_t hipblas_rank1_gemm(hipblasHandle_t    h,
+                                       hipblasOperation_t transV,
+                                       int                m,
+                                       int                n,
+                                       int                k,
+                                       const hipComplex*  one,
+                                       const hipComplex*  U,
+                                       const hipComplex*  V,
+                                       hipComplex*        A,
+                                       int                lda)
+    {
+        return hipblasCgemm_v2(h, HIPBLAS_OP_N, transV, m, n, k, one, U, m, V, n, one, A, lda);
+    }
+
+    hipblasStatus_t hipblas_rank1_gemm(hipblasHandle_t         h,
+                                       hipblasOperation_t      transV,
+                                       int                     m,
+                                       int                     n,
+                                       int                     k,
+                                       const hipDoubleComplex* one,
+                                       const hipDoubleComplex* U,
+                                       const hipDoubleComplex* V,
+                                       hipDoubleComplex*       A,
+                                       int                     lda)
+    {
+        return hipblasZgemm_v2(h, HIPBLAS_OP_N, transV, m, n, k, one, U, m, V, n, one, A, lda);
+    }
+
+    // the uplo triangle of A += U V^T, which is symmetric
+    hipblasStatus_t hipblas_rank1_syrkx(hipblasHandle_t   h,
+                                        hipblasFillMode_t uplo,
+                                        int               n,
+                                        int               k,
+                                        const float*      one,
+                                        const float*      U,
+                                        const float*      V,
+                                        float*            A,
+                                        int               lda)
+    {
+        return hipblasSsyrkx(h, uplo, HIPBLAS_OP_N, n, k, one, U, n, V, n, one, A, lda);
+    }
+
+    hipblasStatus_t hipblas_rank1_syrkx(hipblasHandle_t   h,
+                                        hipblasFillMode_t uplo,
+                                        int               n,
+                                        int               k,
+                                        const double*     one,
+                                        const double*     U,
+                                        const double*     V,
+                                        double*           A,
+                                        int               lda)
+    {
+        return hipblasDsyrkx(h, uplo, HIPBLAS_OP_N, n, k, one, U, n, V, n, one, A, lda);
+    }
+
+    hipblasStatus_t hipblas_rank1_syrkx(hipblasHandle_t   h,
+                                        hipblasFillMode_t uplo,
+                                        int               n,
+                                        int               k,
+                                        const hipComplex* one,
+                                        const hipComplex* U,
+                                        const hipComplex* V,
+                                        hipComplex*       A,
+                                        int               lda)
+    {
+        return hipblasCsyrkx_v2(h, uplo, HIPBLAS_OP_N, n, k, one, U, n, V, n, one, A, lda);
+    }
+
+    hipblasStatus_t hipblas_rank1_syrkx(hipblasHandle_t         h,
+                                        hipblasFillMode_t       uplo,
+                                        int                     n,
+                                        int                     k,
+                                        const hipDoubleComplex* one,
+                                        const hipDoubleComplex* U,
+                                        const hipDoubleComplex* V,
+                                        hipDoubleComplex*       A,
+                                        int                     lda)
+    {
+        return hipblasZsyrkx_v2(h, uplo, HIPBLAS_OP_N, n, k, one, U, n, V, n, one, A, lda);
+    }
+
+    // the uplo triangle of A += U V^H, which is Hermitian
+    hipblasStatus_t hipblas_rank1_herkx(hipblasHandle_t   h,
+                                        hipblasFillMode_t uplo,
+                                        int               n,
+                                        int               k,
+                                        const hipComplex* one,
+                                        const hipComplex* U,
+                                        const hipComplex* V,
+                                        hipComplex*       A,
+                                        int               lda)
+    {
+        const float real_one = 1;
+        return hipblasCherkx_v2(h, uplo, HIPBLAS_OP_N, n, k, one, U, n, V, n, &real_one, A, lda);
+    }
+
+    hipblasStatus_t hipblas_rank1_herkx(hipblasHandle_t         h,
+                                        hipblasFillMode_t       uplo,
+                                        int                     n,
+                                        int                     k,
+                                        const hipDoubleComplex* one,
+                                        const hipDoubleComplex* U,
+                                        const hipDoubleComplex* V,
+                                        hipDoubleComplex*       A,
+                                        int                     lda)
+    {
+        const double real_one = 1;
+        return hipblasZherkx_v2(h, uplo, HIPBLAS_OP_N, n, k, one, U, n, V, n, &real_one, A, lda);
+    }
+
+    hipblasStatus_t hipblas_rank1_herkx(hipblasHandle_t,
+                                        hipblasFillMode_t,
+                                        int,
+                                        int,
+                                        const float*,
+                                        const float*,
+                                        const float*,
+                                        float*,
+                                        int)
+    {
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    hipblasStatus_t hipblas_rank1_herkx(hipblasHandle_t,
+                                        hipblasFillMode_t,
+                                        int,
+                                        int,
+                                        const double*,
+                                        const double*,
+                                        const double*,
+                                        double*,
+                                        int)
+    {
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    size_t hipblas_rank1_type_size(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_32F:
+            return sizeof(float);
+        case HIP_R_64F:
+        case HIP_C_32F:
+            return sizeof(double);
+        case HIP_C_64F:
+            return 2 * sizeof(double);
+        default:
+            return 0;
+        }
+    }
+}
+
+struct hipblasRank1Accumulator
+{
+    hipblasHandle_t      handle;
+    hipblasRank1Update_t update;
+    hipDataType          type;
+    hipblasFillMode_t    uplo;
+    int                  m, n, lda, capacity;
+    void*                A;
+    void*                U     = nullptr;
+    void*                V     = nullptr;
+    int                  count = 0;
+
+    ~hipblasRank1Accumulator()
+    {
+        if(U)
+            (void)hipFree(U);
+        if(V)
+            (void)hipFree(V);
+    }
+
+    // Records alpha x y^T as column count of U and V. Treal is the type of the alpha of her.
+    template <typename T, typename Treal>
+    hipblasStatus_t
+        add(hipblasHandle_t h, const void* alpha, const void* x, int incx, const void* y, int incy)
+    {
+        bool            general = update == HIPBLAS_RANK1_GER || update == HIPBLAS_RANK1_GERC;
+        T*              u       = static_cast<T*>(U) + size_t(count) * m;
+        T*              v       = static_cast<T*>(V) + size_t(count) * n;
+        hipblasStatus_t status;
+        if((status = hipblas_rank1_copy(h, m, static_cast<const T*>(x), incx, u))
+               != HIPBLAS_STATUS_SUCCESS
+           || (status = update == HIPBLAS_RANK1_HER
+                            ? hipblas_rank1_scal(h, m, static_cast<const Treal*>(alpha), u)
+                            : hipblas_rank1_scal(h, m, static_cast<const T*>(alpha), u))
+                  != HIPBLAS_STATUS_SUCCESS
+           || (status = hipblas_rank1_copy(
+                   h, n, static_cast<const T*>(general ? y : x), general ? incy : incx, v))
+                  != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        count++;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipblasStatus_t flush(hipblasHandle_t h)
+    {
+        const T  one = hipblas_rank1_one<T>();
+        const T* u   = static_cast<const T*>(U);
+        const T* v   = static_cast<const T*>(V);
+        T*       a   = static_cast<T*>(A);
+        int      k   = count;
+        count        = 0;
+        switch(update)
+        {
+        case HIPBLAS_RANK1_GER:
+            return hipblas_rank1_gemm(h, HIPBLAS_OP_T, m, n, k, &one, u, v, a, lda);
+        case HIPBLAS_RANK1_GERC:
+            return hipblas_rank1_gemm(h, HIPBLAS_OP_C, m, n, k, &one, u, v, a, lda);
+        case HIPBLAS_RANK1_SYR:
+            return hipblas_rank1_syrkx(h, uplo, n, k, &one, u, v, a, lda);
+        case HIPBLAS_RANK1_HER:
+            return hipblas_rank1_herkx(h, uplo, n, k, &one, u, v, a, lda);
+        }
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    // The scalars of the recorded updates are host pointers whatever the pointer mode of the
+    // handle, which is set back afterwards
+    template <typename F>
+    hipblasStatus_t in_host_pointer_mode(hipblasHandle_t h, F f)
+    {
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblasGetPointerMode(h, &mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(mode != HIPBLAS_POINTER_MODE_HOST
+           && (status = hipblasSetPointerMode(h, HIPBLAS_POINTER_MODE_HOST))
+                  != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        status = f();
+        if(mode != HIPBLAS_POINTER_MODE_HOST)
+            (void)hipblasSetPointerMode(h, mode);
+        return status;
+    }
+
+    hipblasStatus_t flush_any(hipblasHandle_t h)
+    {
+        if(count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        return in_host_pointer_mode(h, [this, h] {
+            switch(type)
+            {
+            case HIP_R_32F:
+                return flush<float>(h);
+            case HIP_R_64F:
+                return flush<double>(h);
+            case HIP_C_32F:
+                return flush<hipComplex>(h);
+            case HIP_C_64F:
+                return flush<hipDoubleComplex>(h);
+            default:
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+            }
+        });
+    }
+};
+
+extern "C" hipblasStatus_t hipblasRank1AccumulatorCreate(hipblasHandle_t            handle,
+                                                         hipblasRank1Update_t       update,
+                                                         hipDataType                type,
+                                                         hipblasFillMode_t          uplo,
+                                                         int                        m,
+                                                         int                        n,
+                                                         void*                      A,
+                                                         int                        lda,
+                                                         int                        capacity,
+                                                         hipblasRank1Accumulator_t* accumulator)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(accumulator == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *accumulator = nullptr;
+
+    bool general = update == HIPBLAS_RANK1_GER || update == HIPBLAS_RANK1_GERC;
+    if(!general && update != HIPBLAS_RANK1_SYR && update != HIPBLAS_RANK1_HER)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(!general && uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    size_t size = hipblas_rank1_type_size(type);
+    if(size == 0 || (update == HIPBLAS_RANK1_HER && (type == HIP_R_32F || type == HIP_R_64F)))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(m < 1 || n < 1 || (!general && m != n) || lda < m || capacity < 1 || A == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    auto* acc     = new hipblasRank1Accumulator;
+    acc->handle   = handle;
+    acc->update   = update;
+    acc->type     = type;
+    acc->uplo     = uplo;
+    acc->m        = m;
+    acc->n        = n;
+    acc->lda      = lda;
+    acc->capacity = capacity;
+    acc->A        = A;
+    if(hipMalloc(&acc->U, size * m * capacity) != hipSuccess
+       || hipMalloc(&acc->V, size * n * capacity) != hipSuccess)
+    {
+        delete acc;
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+
+    *accumulator = acc;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasRank1AccumulatorAdd(hipblasRank1Accumulator_t accumulator,
+                                                      const void*               alpha,
+                                                      const void*               x,
+                                                      int                       incx,
+                                                      const void*               y,
+                                                      int                       incy)
+try
+{
+    if(accumulator == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    hipblasRank1Accumulator& acc    = *accumulator;
+    hipblasHandle_t          handle = acc.handle;
+    HIPBLAS_ENTRY(handle, incx, incy);
+
+    bool general = acc.update == HIPBLAS_RANK1_GER || acc.update == HIPBLAS_RANK1_GERC;
+    if(alpha == nullptr || x == nullptr || incx == 0 || (general && (y == nullptr || incy == 0)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasStatus_t status;
+    if(acc.count == acc.capacity && (status = acc.flush_any(handle)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return acc.in_host_pointer_mode(handle, [&] {
+        switch(acc.type)
+        {
+        case HIP_R_32F:
+            return acc.add<float, float>(handle, alpha, x, incx, y, incy);
+        case HIP_R_64F:
+            return acc.add<double, double>(handle, alpha, x, incx, y, incy);
+        case HIP_C_32F:
+            return acc.add<hipComplex, float>(handle, alpha, x, incx, y, incy);
+        case HIP_C_64F:
+            return acc.add<hipDoubleComplex, double>(handle, alpha, x, incx, y, incy);
+        default:
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasRank1AccumulatorFlush(hipblasRank1Accumulator_t accumulator)
+try
+{
+    if(accumulator == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    hipblasHandle_t handle = accumulator->handle;
+    HIPBLAS_ENTRY(handle);
+
+    return accumulator->flush_any(handle);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasRank1AccumulatorDestroy(hipblasRank1Accumulator_t accumulator)
+try
+{
+    if(accumulator == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    hipblasHandle_t handle = accumulator->handle;
+    HIPBLAS_ENTRY(handle);
+
+    // U and V are freed after the flush that reads them, as hipFree waits for the device
+    hipblasStatus_t status = accumulator->flush_any(handle);
+    delete accumulator;
+    return status;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
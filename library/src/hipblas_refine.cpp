@@ -0,0 +1,734 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <limits>
+
+#include "exceptions.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_entry.hpp"
+
+// The mixed precision iterative refinement solvers hipblasDSgesv and hipblasZCgesv, which are
+// built on the public getrf, getrs and gemm of hipBLAS, so they are the same for both backends.
+// Only the conversions between precisions and the convergence test are hipBLAS kernels.
+
+#ifdef __HIP_PLATFORM_SOLVER__
+
+namespace
+{
+    // As in LAPACK dsgesv: at most ITERMAX refinement steps, and a solution is accepted when
+    // ||r||_inf < ||x||_inf * ||A||_inf * eps * sqrt(n) * BWDMAX for each right-hand side
+    constexpr int    hipblas_refine_itermax = 30;
+    constexpr double hipblas_refine_bwdmax  = 1.0;
+
+    constexpr int hipblas_refine_block = 256;
+
+    // The workspace is As, Xs, R, then the scalars of the refinement, each padded so that the
+    // next one stays aligned
+    constexpr size_t hipblas_refine_align = 256;
+
+    size_t hipblas_refine_pad(size_t bytes)
+    {
+        return (bytes + hipblas_refine_align - 1) / hipblas_refine_align * hipblas_refine_align;
+    }
+
+    // The scalars kept on the device: ||A||_inf, the flag set by a conversion that overflows
+    // or by the convergence test, and the info of getrs in HIPBLAS_INFO_MODE_DEVICE
+    struct hipblasRefineScalars
+    {
+        double anrm;
+        int    flag;
+        int    info;
+    };
+
+    template <typename T>
+    struct hipblas_refine_low;
+
+    template <>
+    struct hipblas_refine_low<double>
+    {
+        using type = float;
+    };
+
+    template <>
+    struct hipblas_refine_low<hipDoubleComplex>
+    {
+        using type = hipFloatComplex;
+    };
+
+    template <typename T>
+    using hipblas_refine_low_t = typename hipblas_refine_low<T>::type;
+
+    __device__ __host__ inline double hipblas_refine_abs(double x)
+    {
+        return fabs(x);
+    }
+
+    __device__ __host__ inline double hipblas_refine_abs(hipDoubleComplex x)
+    {
+        return hipCabs(x);
+    }
+
+    // y := x converted to the precision of y. Sets *overflow if an element of x doesn't fit.
+    __device__ inline void hipblas_refine_convert(double x, float& y, int* overflow)
+    {
+        if(fabs(x) > FLT_MAX)
+            *overflow = 1;
+        y = float(x);
+    }
+
+    __device__ inline void
+        hipblas_refine_convert(hipDoubleComplex x, hipFloatComplex& y, int* overflow)
+    {
+        if(fabs(hipCreal(x)) > FLT_MAX || fabs(hipCimag(x)) > FLT_MAX)
+            *overflow = 1;
+        y = hipComplexDoubleToFloat(x);
+    }
+
+    __device__ inline double hipblas_refine_widen(float x)
+    {
+        return x;
+    }
+
+    __device__ inline hipDoubleComplex hipblas_refine_widen(hipFloatComplex x)
+    {
+        return hipComplexFloatToDouble(x);
+    }
+
+    __device__ inline double hipblas_refine_add(double x, double y)
+    {
+        return x + y;
+    }
+
+    __device__ inline hipDoubleComplex hipblas_refine_add(hipDoubleComplex x, hipDoubleComplex y)
+    {
+        return hipCadd(x, y);
+    }
+
+    // B(i, j) := A(i, j) converted to the precision of B, for an m-by-n matrix
+    template <typename T, typename U>
+    __global__ void hipblasRefineConvertKernel(
+        int m, int n, const T* A, int lda, U* B, int ldb, hipblasRefineScalars* scalars)
+    {
+        int64_t tid = blockIdx.x * int64_t(blockDim.x) + threadIdx.x;
+        if(tid >= int64_t(m) * n)
+            return;
+        int i = tid % m;
+        int j = tid / m;
+        hipblas_refine_convert(A[i + j * int64_t(lda)], B[i + j * int64_t(ldb)], &scalars->flag);
+    }
+
+    // X(i, j) := X(i, j) + widened Y(i, j), for an m-by-n matrix
+    template <typename T, typename U>
+    __global__ void hipblasRefineUpdateKernel(int m, int n, const U* Y, int ldy, T* X, int ldx)
+    {
+        int64_t tid = blockIdx.x * int64_t(blockDim.x) + threadIdx.x;
+        if(tid >= int64_t(m) * n)
+            return;
+        int i = tid % m;
+        int j = tid / m;
+        T&  x = X[i + j * int64_t(ldx)];
+        x     = hipblas_refine_add(x, hipblas_refine_widen(Y[i + j * int64_t(ldy)]));
+    }
+
+    // Y := X for an m-by-n matrix
+    template <typename T>
+    __global__ void hipblasRefineCopyKernel(int m, int n, const T* X, int ldx, T* Y, int ldy)
+    {
+        int64_t tid = blockIdx.x * int64_t(blockDim.x) + threadIdx.x;
+        if(tid >= int64_t(m) * n)
+            return;
+        int i                   = tid % m;
+        int j                   = tid / m;
+        Y[i + j * int64_t(ldy)] = X[i + j * int64_t(ldx)];
+    }
+
+    // scalars->anrm := ||A||_inf, the largest absolute row sum of the n-by-n matrix A, by one
+    // block, and clears the flag
+    template <typename T>
+    __global__ void
+        hipblasRefineNormKernel(int n, const T* A, int lda, hipblasRefineScalars* scalars)
+    {
+        __shared__ double partial[hipblas_refine_block];
+
+        double row_max = 0;
+        for(int i = threadIdx.x; i < n; i += blockDim.x)
+        {
+            double sum = 0;
+            for(int j = 0; j < n; j++)
+                sum += hipblas_refine_abs(A[i + j * int64_t(lda)]);
+            row_max = fmax(row_max, sum);
+        }
+        partial[threadIdx.x] = row_max;
+        __syncthreads();
+
+        for(int s = blockDim.x / 2; s > 0; s /= 2)
+        {
+            if(threadIdx.x < s)
+                partial[threadIdx.x] = fmax(partial[threadIdx.x], partial[threadIdx.x + s]);
+            __syncthreads();
+        }
+        if(threadIdx.x == 0)
+        {
+            scalars->anrm = partial[0];
+            scalars->flag = 0;
+        }
+    }
+
+    // Sets scalars->flag if any right-hand side of the n-by-nrhs residual R hasn't converged
+    // for the solution X, with one block per right-hand side. The flag is cleared before the
+    // launch.
+    template <typename T>
+    __global__ void hipblasRefineConvergedKernel(
+        int n, const T* R, int ldr, const T* X, int ldx, double cte, hipblasRefineScalars* scalars)
+    {
+        __shared__ double rnrm[hipblas_refine_block];
+        __shared__ double xnrm[hipblas_refine_block];
+
+        int64_t j = blockIdx.x;
+        double  r = 0, x = 0;
+        for(int i = threadIdx.x; i < n; i += blockDim.x)
+        {
+            r = fmax(r, hipblas_refine_abs(R[i + j * ldr]));
+            x = fmax(x, hipblas_refine_abs(X[i + j * ldx]));
+        }
+        rnrm[threadIdx.x] = r;
+        xnrm[threadIdx.x] = x;
+        __syncthreads();
+
+        for(int s = blockDim.x / 2; s > 0; s /= 2)
+        {
+            if(threadIdx.x < s)
+            {
+                rnrm[threadIdx.x] = fmax(rnrm[threadIdx.x], rnrm[threadIdx.x + s]);
+                xnrm[threadIdx.x] = fmax(xnrm[threadIdx.x], xnrm[threadIdx.x + s]);
+            }
+            __syncthreads();
+        }
+        if(threadIdx.x == 0 && !(rnrm[0] <= xnrm[0] * scalars->anrm * cte))
+            scalars->flag = 1;
+    }
+
+    // The hipBLAS functions for precision T, and the lower precision of the factorization
+    hipblasStatus_t hipblas_refine_getrf(
+        hipblasHandle_t handle, int n, float* A, int lda, int* ipiv, int* info)
+    {
+        return hipblasSgetrf(handle, n, A, lda, ipiv, info);
+    }
+
+    hipblasStatus_t hipblas_refine_getrf(
+        hipblasHandle_t handle, int n, double* A, int lda, int* ipiv, int* info)
+    {
+        return hipblasDgetrf(handle, n, A, lda, ipiv, info);
+    }
+
+    hipblasStatus_t hipblas_refine_getrf(
+        hipblasHandle_t handle, int n, hipFloatComplex* A, int lda, int* ipiv, int* info)
+    {
+        return hipblasCgetrf_v2(handle, n, A, lda, ipiv, info);
+    }
+
+    hipblasStatus_t hipblas_refine_getrf(
+        hipblasHandle_t handle, int n, hipDoubleComplex* A, int lda, int* ipiv, int* info)
+    {
+        return hipblasZgetrf_v2(handle, n, A, lda, ipiv, info);
+    }
+
+    hipblasStatus_t hipblas_refine_getrs(hipblasHandle_t handle,
+                                         int             n,
+                                         int             nrhs,
+                                         float*          A,
+                                         int             lda,
+                                         const int*      ipiv,
+                                         float*          B,
+                                         int             ldb,
+                                         int*            info)
+    {
+        return hipblasSgetrs(handle, HIPBLAS_OP_N, n, nrhs, A, lda, ipiv, B, ldb, info);
+    }
+
+    hipblasStatus_t hipblas_refine_getrs(hipblasHandle_t handle,
+                                         int             n,
+                                         int             nrhs,
+                                         double*         A,
+                                         int             lda,
+                                         const int*      ipiv,
+                                         double*         B,
+                                         int             ldb,
+                                         int*            info)
+    {
+        return hipblasDgetrs(handle, HIPBLAS_OP_N, n, nrhs, A, lda, ipiv, B, ldb, info);
+    }
+
+    hipblasStatus_t hipblas_refine_getrs(hipblasHandle_t  handle,
+                                         int              n,
+                                         int              nrhs,
+                                         hipFloatComplex* A,
+                                         int              lda,
+                                         const int*       ipiv,
+                                         hipFloatComplex* B,
+                                         int              ldb,
+                                         int*             info)
+    {
+        return hipblasCgetrs_v2(handle, HIPBLAS_OP_N, n, nrhs, A, lda, ipiv, B, ldb, info);
+    }
+
+    hipblasStatus_t hipblas_refine_getrs(hipblasHandle_t   handle,
+                                         int               n,
+                                         int               nrhs,
+                                         hipDoubleComplex* A,
+                                         int               lda,
+                                         const int*        ipiv,
+                                         hipDoubleComplex* B,
+                                         int               ldb,
+                                         int*              info)
+    {
+        return hipblasZgetrs_v2(handle, HIPBLAS_OP_N, n, nrhs, A, lda, ipiv, B, ldb, info);
+    }
+
+    // R := B - A * X
+    hipblasStatus_t hipblas_refine_residual(hipblasHandle_t handle,
+                                            int             n,
+                                            int             nrhs,
+                                            const double*   A,
+                                            int             lda,
+                                            const double*   X,
+                                            int             ldx,
+                                            double*         R,
+                                            int             ldr)
+    {
+        const double alpha = -1, beta = 1;
+        return hipblasDgemm(
+            handle, HIPBLAS_OP_N, HIPBLAS_OP_N, n, nrhs, n, &alpha, A, lda, X, ldx, &beta, R, ldr);
+    }
+
+    hipblasStatus_t hipblas_refine_residual(hipblasHandle_t         handle,
+                                            int                     n,
+                                            int                     nrhs,
+                                            const hipDoubleComplex* A,
+                                            int                     lda,
+                                            const hipDoubleComplex* X,
+                                            int                     ldx,
+                                            hipDoubleComplex*       R,
+                                            int                     ldr)
+    {
+        const hipDoubleComplex alpha = make_hipDoubleComplex(-1, 0);
+        const hipDoubleComplex beta  = make_hipDoubleComplex(1, 0);
+        return hipblasZgemm_v2(
+            handle, HIPBLAS_OP_N, HIPBLAS_OP_N, n, nrhs, n, &alpha, A, lda, X, ldx, &beta, R, ldr);
+    }
+
+    int hipblas_refine_blocks(int m, int n)
+    {
+        return int((int64_t(m) * n - 1) / hipblas_refine_block + 1);
+    }
+
+    hipblasStatus_t hipblas_refine_launched()
+    {
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    // The layout of the workspace for an n-by-n system with nrhs right-hand sides
+    template <typename T>
+    struct hipblasRefineWorkspace
+    {
+        using L = hipblas_refine_low_t<T>;
+
+        size_t As_bytes, Xs_bytes, R_bytes;
+
+        hipblasRefineWorkspace(int n, int nrhs)
+            : As_bytes(hipblas_refine_pad(sizeof(L) * n * n))
+            , Xs_bytes(hipblas_refine_pad(sizeof(L) * n * nrhs))
+            , R_bytes(hipblas_refine_pad(sizeof(T) * n * nrhs))
+        {
+        }
+
+        size_t size() const
+        {
+            return As_bytes + Xs_bytes + R_bytes + hipblas_refine_pad(sizeof(hipblasRefineScalars));
+        }
+    };
+
+    template <typename T>
+    hipblasStatus_t hipblas_gesv_refine_buffer_size(
+        hipblasHandle_t handle, int n, int nrhs, int lda, int ldb, int ldx, size_t* lwork_bytes)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(lwork_bytes == nullptr || n < 0 || nrhs < 0 || lda < std::max(1, n)
+           || ldb < std::max(1, n) || ldx < std::max(1, n))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        *lwork_bytes = hipblasRefineWorkspace<T>(n, nrhs).size();
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Returns the flag of the scalars on the device, after the work queued on stream
+    hipblasStatus_t
+        hipblas_refine_read_flag(hipStream_t stream, hipblasRefineScalars* scalars, int* flag)
+    {
+        if(hipMemcpyAsync(flag, &scalars->flag, sizeof(int), hipMemcpyDeviceToHost, stream)
+               != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblas_gesv_refine(hipblasHandle_t handle,
+                                        int             n,
+                                        int             nrhs,
+                                        T*              A,
+                                        int             lda,
+                                        int*            ipiv,
+                                        T*              B,
+                                        int             ldb,
+                                        T*              X,
+                                        int             ldx,
+                                        void*           workspace,
+                                        size_t          lwork_bytes,
+                                        int*            iter,
+                                        int*            info)
+    {
+        using L = hipblas_refine_low_t<T>;
+
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(n < 0 || nrhs < 0 || lda < std::max(1, n) || ldb < std::max(1, n)
+           || ldx < std::max(1, n))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(iter == nullptr || info == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipblasRefineWorkspace<T> layout(n, nrhs);
+        if((workspace == nullptr && n) || lwork_bytes < layout.size())
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(n && ((A == nullptr || ipiv == nullptr) || ((B == nullptr || X == nullptr) && nrhs)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        int zero = 0;
+        if(n == 0 || nrhs == 0)
+        {
+            if(hipMemcpyAsync(iter, &zero, sizeof(int), hipMemcpyHostToDevice, stream) != hipSuccess
+               || hipMemcpyAsync(info, &zero, sizeof(int), hipMemcpyHostToDevice, stream)
+                      != hipSuccess
+               || hipStreamSynchronize(stream) != hipSuccess)
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        // The solution loop reads the convergence flag back after each step, so it can't be
+        // captured in a graph
+        hipStreamCaptureStatus capture = hipStreamCaptureStatusNone;
+        if(hipStreamIsCapturing(stream, &capture) != hipSuccess
+           || capture != hipStreamCaptureStatusNone)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        char*                 ws      = (char*)workspace;
+        L*                    As      = (L*)ws;
+        L*                    Xs      = (L*)(ws + layout.As_bytes);
+        T*                    R       = (T*)(ws + layout.As_bytes + layout.Xs_bytes);
+        hipblasRefineScalars* scalars = (hipblasRefineScalars*)(ws + layout.As_bytes
+                                                                 + layout.Xs_bytes
+                                                                 + layout.R_bytes);
+
+        // getrs reports its argument checks through info, which is a device pointer in
+        // HIPBLAS_INFO_MODE_DEVICE
+        int  host_info = 0;
+        int* rs_info   = hipblasIsDeviceInfoMode(handle) ? &scalars->info : &host_info;
+
+        // gemm is called with host alpha and beta
+        hipblasPointerMode_t pointer_mode;
+        status = hipblasGetPointerMode(handle, &pointer_mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        const double eps = std::numeric_limits<double>::epsilon() / 2;
+        const double cte = eps * std::sqrt(double(n)) * hipblas_refine_bwdmax;
+
+        // iter as in LAPACK: the number of refinement steps if they converged, -2 if A or B
+        // overflow the lower precision, -3 if its factorization failed, and -(ITERMAX + 1) if the
+        // refinement didn't converge. In the negative cases the system is solved by getrf and
+        // getrs in the precision of A.
+        int  host_iter = 0;
+        int  flag      = 0;
+        auto step      = [&]() -> hipblasStatus_t {
+            // ||A||_inf and As := A
+            hipblasRefineNormKernel<T><<<1, hipblas_refine_block, 0, stream>>>(n, A, lda, scalars);
+            hipblasRefineConvertKernel<T, L>
+                <<<hipblas_refine_blocks(n, n), hipblas_refine_block, 0, stream>>>(
+                    n, n, A, lda, As, n, scalars);
+            hipblasRefineConvertKernel<T, L>
+                <<<hipblas_refine_blocks(n, nrhs), hipblas_refine_block, 0, stream>>>(
+                    n, nrhs, B, ldb, Xs, n, scalars);
+            hipblasStatus_t status = hipblas_refine_launched();
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblas_refine_read_flag(stream, scalars, &flag);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            if(flag)
+            {
+                host_iter = -2;
+                return HIPBLAS_STATUS_SUCCESS;
+            }
+
+            // As := P * L * U in the lower precision, with its info in the flag
+            status = hipblas_refine_getrf(handle, n, As, n, ipiv, &scalars->flag);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblas_refine_read_flag(stream, scalars, &flag);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            if(flag)
+            {
+                host_iter = -3;
+                return HIPBLAS_STATUS_SUCCESS;
+            }
+
+            // X := the solution in the lower precision
+            status = hipblas_refine_getrs(handle, n, nrhs, As, n, ipiv, Xs, n, rs_info);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            // X := 0, so the update widens Xs into it
+            if(hipMemset2DAsync(X, sizeof(T) * ldx, 0, sizeof(T) * n, nrhs, stream) != hipSuccess)
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+            hipblasRefineUpdateKernel<T, L>
+                <<<hipblas_refine_blocks(n, nrhs), hipblas_refine_block, 0, stream>>>(
+                    n, nrhs, Xs, n, X, ldx);
+            status = hipblas_refine_launched();
+
+            for(int it = 0; it <= hipblas_refine_itermax && status == HIPBLAS_STATUS_SUCCESS; it++)
+            {
+                // R := B - A * X, and the flag stays clear if every right-hand side converged
+                hipblasRefineCopyKernel<T>
+                    <<<hipblas_refine_blocks(n, nrhs), hipblas_refine_block, 0, stream>>>(
+                        n, nrhs, B, ldb, R, n);
+                status = hipblas_refine_launched();
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = hipblas_refine_residual(handle, n, nrhs, A, lda, X, ldx, R, n);
+                if(status == HIPBLAS_STATUS_SUCCESS
+                   && hipMemsetAsync(&scalars->flag, 0, sizeof(int), stream) != hipSuccess)
+                    status = HIPBLAS_STATUS_EXECUTION_FAILED;
+                if(status != HIPBLAS_STATUS_SUCCESS)
+                    return status;
+                hipblasRefineConvergedKernel<T><<<nrhs, hipblas_refine_block, 0, stream>>>(
+                    n, R, n, X, ldx, cte, scalars);
+                status = hipblas_refine_launched();
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = hipblas_refine_read_flag(stream, scalars, &flag);
+                if(status != HIPBLAS_STATUS_SUCCESS)
+                    return status;
+                if(!flag)
+                {
+                    host_iter = it;
+                    return HIPBLAS_STATUS_SUCCESS;
+                }
+                if(it == hipblas_refine_itermax)
+                    break;
+
+                // X := X + the correction solved from R in the lower precision
+                hipblasRefineConvertKernel<T, L>
+                    <<<hipblas_refine_blocks(n, nrhs), hipblas_refine_block, 0, stream>>>(
+                        n, nrhs, R, n, Xs, n, scalars);
+                status = hipblas_refine_launched();
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = hipblas_refine_getrs(handle, n, nrhs, As, n, ipiv, Xs, n, rs_info);
+                if(status != HIPBLAS_STATUS_SUCCESS)
+                    return status;
+                hipblasRefineUpdateKernel<T, L>
+                    <<<hipblas_refine_blocks(n, nrhs), hipblas_refine_block, 0, stream>>>(
+                        n, nrhs, Xs, n, X, ldx);
+                status = hipblas_refine_launched();
+            }
+            host_iter = -(hipblas_refine_itermax + 1);
+            return status;
+        };
+
+        status = step();
+
+        if(status == HIPBLAS_STATUS_SUCCESS && host_iter < 0)
+        {
+            // A := P * L * U and X := A^-1 * B in the precision of A
+            status = hipblas_refine_getrf(handle, n, A, lda, ipiv, info);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+            {
+                hipblasRefineCopyKernel<T>
+                    <<<hipblas_refine_blocks(n, nrhs), hipblas_refine_block, 0, stream>>>(
+                        n, nrhs, B, ldb, X, ldx);
+                status = hipblas_refine_launched();
+            }
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblas_refine_getrs(handle, n, nrhs, A, lda, ipiv, X, ldx, rs_info);
+        }
+        else if(status == HIPBLAS_STATUS_SUCCESS
+                && hipMemcpyAsync(info, &zero, sizeof(int), hipMemcpyHostToDevice, stream)
+                       != hipSuccess)
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        if(status == HIPBLAS_STATUS_SUCCESS
+           && (hipMemcpyAsync(iter, &host_iter, sizeof(int), hipMemcpyHostToDevice, stream)
+                   != hipSuccess
+               || hipStreamSynchronize(stream) != hipSuccess))
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        hipblasStatus_t mode_status = hipblasSetPointerMode(handle, pointer_mode);
+        return status != HIPBLAS_STATUS_SUCCESS ? status : mode_status;
+    }
+}
+
+extern "C" hipblasStatus_t hipblasDSgesv_bufferSize(hipblasHandle_t handle,
+                                                    const int       n,
+                                                    const int       nrhs,
+                                                    const int       lda,
+                                                    const int       ldb,
+                                                    const int       ldx,
+                                                    size_t*         lworkBytes)
+try
+{
+    return hipblas_gesv_refine_buffer_size<double>(handle, n, nrhs, lda, ldb, ldx, lworkBytes);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZCgesv_bufferSize(hipblasHandle_t handle,
+                                                    const int       n,
+                                                    const int       nrhs,
+                                                    const int       lda,
+                                                    const int       ldb,
+                                                    const int       ldx,
+                                                    size_t*         lworkBytes)
+try
+{
+    return hipblas_gesv_refine_buffer_size<hipDoubleComplex>(
+        handle, n, nrhs, lda, ldb, ldx, lworkBytes);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDSgesv(hipblasHandle_t handle,
+                                         const int       n,
+                                         const int       nrhs,
+                                         double*         A,
+                                         const int       lda,
+                                         int*            ipiv,
+                                         double*         B,
+                                         const int       ldb,
+                                         double*         X,
+                                         const int       ldx,
+                                         void*           workspace,
+                                         const size_t    lworkBytes,
+                                         int*            iter,
+                                         int*            info)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, ldb, ldx);
+
+    return hipblas_gesv_refine<double>(
+        handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, workspace, lworkBytes, iter, info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZCgesv(hipblasHandle_t       handle,
+                                         const int             n,
+                                         const int             nrhs,
+                                         hipblasDoubleComplex* A,
+                                         const int             lda,
+                                         int*                  ipiv,
+                                         hipblasDoubleComplex* B,
+                                         const int             ldb,
+                                         hipblasDoubleComplex* X,
+                                         const int             ldx,
+                                         void*                 workspace,
+                                         const size_t          lworkBytes,
+                                         int*                  iter,
+                                         int*                  info)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, ldb, ldx);
+
+    return hipblas_gesv_refine<hipDoubleComplex>(handle,
+                                                 n,
+                                                 nrhs,
+                                                 (hipDoubleComplex*)A,
+                                                 lda,
+                                                 ipiv,
+                                                 (hipDoubleComplex*)B,
+                                                 ldb,
+                                                 (hipDoubleComplex*)X,
+                                                 ldx,
+                                                 workspace,
+                                                 lworkBytes,
+                                                 iter,
+                                                 info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZCgesv_v2(hipblasHandle_t   handle,
+                                            const int         n,
+                                            const int         nrhs,
+                                            hipDoubleComplex* A,
+                                            const int         lda,
+                                            int*              ipiv,
+                                            hipDoubleComplex* B,
+                                            const int         ldb,
+                                            hipDoubleComplex* X,
+                                            const int         ldx,
+                                            void*             workspace,
+                                            const size_t      lworkBytes,
+                                            int*              iter,
+                                            int*              info)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, ldb, ldx);
+
+    return hipblas_gesv_refine<hipDoubleComplex>(
+        handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, workspace, lworkBytes, iter, info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+#endif
@@ -0,0 +1,123 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include "exceptions.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_thread_stream.hpp"
+
+// hipBLAS can't tell that the calls of a region are those of an earlier execution without running
+// their host code, so every execution of a region is captured, which submits no work. The first
+// capture of a key is instantiated, and later ones update the cached executable in place, which
+// is enough when only the pointers or scalars of the kernels changed. The executable is
+// instantiated again when the update fails, for instance when the sizes of a call changed the
+// kernels it launches.
+
+extern "C" hipblasStatus_t hipblasBeginRegion(hipblasHandle_t handle, uint64_t key)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasRegions& region = hipblasGetHandleState(handle)->regions;
+    if(region.active)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // the calls of the region are made on the handle bound to the calling thread, if any
+    hipblasHandle_t stream_handle = hipblasThreadStreamHandle(handle);
+    hipStream_t     stream        = nullptr;
+    hipblasStatus_t status        = hipblasGetStream(stream_handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // a region within a capture of the caller is recorded in that capture
+    hipStreamCaptureStatus capture = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(stream, &capture) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(capture == hipStreamCaptureStatusNone
+       && hipStreamBeginCapture(stream, hipStreamCaptureModeThreadLocal) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    hipblasGraphCaptureMode_t mode = hipblasGetHandleState(stream_handle)->graph_capture_mode;
+    hipblasSetHandleGraphCaptureMode(stream_handle, HIPBLAS_GRAPH_CAPTURE_SAFE);
+
+    region.active               = true;
+    region.capturing            = capture == hipStreamCaptureStatusNone;
+    region.key                  = key;
+    region.stream               = stream;
+    region.stream_handle        = stream_handle;
+    region.graph_capture_before = mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasEndRegion(hipblasHandle_t handle)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasRegions& region = hipblasGetHandleState(handle)->regions;
+    if(!region.active)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    region.active = false;
+    hipblasSetHandleGraphCaptureMode(region.stream_handle, region.graph_capture_before);
+    if(!region.capturing)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipGraph_t graph = nullptr;
+    if(hipStreamEndCapture(region.stream, &graph) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    hipGraphExec_t& exec = region.graphs[region.key];
+    if(exec)
+    {
+        hipGraphNode_t           error_node = nullptr;
+        hipGraphExecUpdateResult result     = hipGraphExecUpdateSuccess;
+        if(hipGraphExecUpdate(exec, graph, &error_node, &result) != hipSuccess)
+        {
+            (void)hipGraphExecDestroy(exec);
+            exec = nullptr;
+        }
+    }
+    if(!exec && hipGraphInstantiate(&exec, graph, nullptr, nullptr, 0) != hipSuccess)
+        exec = nullptr;
+    (void)hipGraphDestroy(graph);
+
+    if(!exec)
+    {
+        region.graphs.erase(region.key);
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+    return hipGraphLaunch(exec, region.stream) == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                                            : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
@@ -0,0 +1,361 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+
+#include "exceptions.hpp"
+#include "hipblas_device_reduce.hpp"
+#include "hipblas_reproducible.hpp"
+
+// The BLAS 1 reductions of handles in HIPBLAS_REPRODUCIBILITY_BITWISE. They use the fixed-order
+// reductions of hipblas_device_reduce.hpp, so their results don't depend on the backend, the
+// device or the timing of the blocks.
+
+namespace
+{
+    // partial[blockIdx.x] := the sum over the elements of the block of conj(x) * y when CONJ,
+    // and of x * y otherwise
+    template <typename T, bool CONJ>
+    __global__ void
+        hipblasReproducibleDotKernel(int n, const T* x, int incx, const T* y, int incy, T* partial)
+    {
+        __shared__ T sums[hipblas_blas1_threads];
+
+        T one = hipblas_device_one<T>();
+        T sum = T{};
+        for(int i = blockIdx.x * blockDim.x + threadIdx.x; i < n; i += gridDim.x * blockDim.x)
+        {
+            T xi = hipblas_device_elem(x, n, incx, i);
+            if constexpr(CONJ)
+                xi = hipblas_device_conj(xi);
+            sum = hipblas_device_axpby(xi, hipblas_device_elem(y, n, incy, i), one, sum);
+        }
+
+        sum = hipblas_device_block_sum(sum, sums);
+        if(!threadIdx.x)
+            partial[blockIdx.x] = sum;
+    }
+
+    // partial[blockIdx.x] := the sum over the elements of the block of |re(x)| + |im(x)| when
+    // !NRM2, and of |x|^2 otherwise
+    template <typename T, typename TR, bool NRM2>
+    __global__ void hipblasReproducibleSumKernel(int n, const T* x, int incx, TR* partial)
+    {
+        __shared__ TR sums[hipblas_blas1_threads];
+
+        TR sum = 0;
+        for(int i = blockIdx.x * blockDim.x + threadIdx.x; i < n; i += gridDim.x * blockDim.x)
+        {
+            if constexpr(NRM2)
+                sum += hipblas_device_abs2(x[int64_t(i) * incx]);
+            else
+                sum += hipblas_device_abs1(x[int64_t(i) * incx]);
+        }
+
+        sum = hipblas_device_block_sum(sum, sums);
+        if(!threadIdx.x)
+            partial[blockIdx.x] = sum;
+    }
+
+    // partial[blockIdx.x] := the partial of iamax over the elements of the block
+    template <typename T, typename TR>
+    __global__ void hipblasReproducibleIamaxKernel(int                        n,
+                                                   const T*                   x,
+                                                   int                        incx,
+                                                   hipblas_iamax_partial<TR>* partial)
+    {
+        __shared__ hipblas_iamax_partial<TR> ps[hipblas_blas1_threads];
+
+        // each thread visits its elements in increasing order, so only a larger value replaces
+        // the one it has
+        hipblas_iamax_partial<TR> p{0, -1};
+        for(int i = blockIdx.x * blockDim.x + threadIdx.x; i < n; i += gridDim.x * blockDim.x)
+        {
+            TR v = hipblas_device_abs1(x[int64_t(i) * incx]);
+            if(p.index < 0 || v > p.value)
+                p = {v, i};
+        }
+
+        p = hipblas_iamax_block_merge(p, ps);
+        if(!threadIdx.x)
+            partial[blockIdx.x] = p;
+    }
+
+    // result := the 1-based index of the merge of the partials of the blocks
+    template <typename TR>
+    __global__ void hipblasReproducibleIamaxResultKernel(int                              blocks,
+                                                         const hipblas_iamax_partial<TR>* partial,
+                                                         int*                             result)
+    {
+        __shared__ hipblas_iamax_partial<TR> ps[hipblas_blas1_threads];
+
+        hipblas_iamax_partial<TR> p{0, -1};
+        for(int i = threadIdx.x; i < blocks; i += blockDim.x)
+            hipblas_iamax_merge(p, partial[i]);
+
+        p = hipblas_iamax_block_merge(p, ps);
+        if(!threadIdx.x)
+            *result = p.index + 1;
+    }
+
+    template <typename T, bool CONJ>
+    hipError_t hipblas_reproducible_dot_launch(int         n,
+                                               const void* x,
+                                               int         incx,
+                                               const void* y,
+                                               int         incy,
+                                               void*       scratch,
+                                               void*       result,
+                                               hipStream_t stream)
+    {
+        int blocks = hipblas_blas1_grid(n);
+        hipblasReproducibleDotKernel<T, CONJ><<<blocks, hipblas_blas1_threads, 0, stream>>>(
+            n, (const T*)x, incx, (const T*)y, incy, (T*)scratch);
+        hipblasBlas1SumKernel<T><<<1, hipblas_blas1_threads, 0, stream>>>(
+            blocks, (const T*)scratch, (T*)result, 1);
+        return hipGetLastError();
+    }
+
+    template <typename T, typename TR, bool NRM2>
+    hipError_t hipblas_reproducible_sum_launch(
+        int n, const void* x, int incx, void* scratch, void* result, hipStream_t stream)
+    {
+        int blocks = hipblas_blas1_grid(n);
+        hipblasReproducibleSumKernel<T, TR, NRM2><<<blocks, hipblas_blas1_threads, 0, stream>>>(
+            n, (const T*)x, incx, (TR*)scratch);
+        hipblasBlas1SumKernel<TR, NRM2><<<1, hipblas_blas1_threads, 0, stream>>>(
+            blocks, (const TR*)scratch, (TR*)result, 1);
+        return hipGetLastError();
+    }
+
+    template <typename T, typename TR>
+    hipError_t hipblas_reproducible_iamax_launch(
+        int n, const void* x, int incx, void* scratch, void* result, hipStream_t stream)
+    {
+        int blocks = hipblas_blas1_grid(n);
+        hipblasReproducibleIamaxKernel<T, TR><<<blocks, hipblas_blas1_threads, 0, stream>>>(
+            n, (const T*)x, incx, (hipblas_iamax_partial<TR>*)scratch);
+        hipblasReproducibleIamaxResultKernel<TR><<<1, hipblas_blas1_threads, 0, stream>>>(
+            blocks, (const hipblas_iamax_partial<TR>*)scratch, (int*)result);
+        return hipGetLastError();
+    }
+
+    // The kernels of one type of the vectors, with the sizes of the elements, of their real
+    // type and of the partials of iamax
+    struct hipblas_reproducible_kernels
+    {
+        decltype(&hipblas_reproducible_dot_launch<float, false>)        dot        = nullptr;
+        decltype(&hipblas_reproducible_dot_launch<float, true>)         dotc       = nullptr;
+        decltype(&hipblas_reproducible_sum_launch<float, float, false>) asum       = nullptr;
+        decltype(&hipblas_reproducible_sum_launch<float, float, true>)  nrm2       = nullptr;
+        decltype(&hipblas_reproducible_iamax_launch<float, float>)      iamax      = nullptr;
+        size_t                                                          size       = 0;
+        size_t                                                          real_size  = 0;
+        size_t                                                          iamax_size = 0;
+    };
+
+    template <typename T, typename TR>
+    hipblas_reproducible_kernels hipblas_reproducible_kernels_of()
+    {
+        return {hipblas_reproducible_dot_launch<T, false>,
+                hipblas_reproducible_dot_launch<T, true>,
+                hipblas_reproducible_sum_launch<T, TR, false>,
+                hipblas_reproducible_sum_launch<T, TR, true>,
+                hipblas_reproducible_iamax_launch<T, TR>,
+                sizeof(T),
+                sizeof(TR),
+                sizeof(hipblas_iamax_partial<TR>)};
+    }
+
+    hipblas_reproducible_kernels hipblas_reproducible_kernels_for(hipDataType data_type)
+    {
+        switch(data_type)
+        {
+        case HIP_R_32F:
+            return hipblas_reproducible_kernels_of<float, float>();
+        case HIP_R_64F:
+            return hipblas_reproducible_kernels_of<double, double>();
+        case HIP_C_32F:
+            return hipblas_reproducible_kernels_of<hipFloatComplex, float>();
+        case HIP_C_64F:
+            return hipblas_reproducible_kernels_of<hipDoubleComplex, double>();
+        default:
+            return {};
+        }
+    }
+
+    // Reduces the vector of n elements at x with launch, with partials of partial_size bytes
+    // and a result of result_size bytes, or sets the result to zero when empty is true
+    template <typename Launch>
+    hipblasStatus_t hipblas_reproducible_reduce(hipblasHandle_t handle,
+                                                int             n,
+                                                bool            empty,
+                                                const void*     x,
+                                                void*           result,
+                                                size_t          partial_size,
+                                                size_t          result_size,
+                                                Launch          launch)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!result)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t          stream;
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblas_blas1_stream(handle, &stream, &mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        bool host_result = mode == HIPBLAS_POINTER_MODE_HOST;
+        if(empty)
+            return hipblas_blas1_zero(host_result, result, 1, result_size, stream);
+        if(!x)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        return hipblas_blas1_reduce(handle,
+                                    stream,
+                                    host_result,
+                                    n,
+                                    1,
+                                    partial_size,
+                                    result_size,
+                                    result,
+                                    [&](void* scratch, void* d_result) {
+                                        return launch(scratch, d_result, stream);
+                                    });
+    }
+}
+
+hipblasStatus_t hipblasReproducibleDot(hipblasHandle_t handle,
+                                       int             n,
+                                       const void*     x,
+                                       int             incx,
+                                       const void*     y,
+                                       int             incy,
+                                       void*           result,
+                                       hipDataType     dataType,
+                                       bool            conj)
+try
+{
+    auto kernels = hipblas_reproducible_kernels_for(dataType);
+    if(!kernels.dot)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(n > 0 && !y)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    auto launch = conj ? kernels.dotc : kernels.dot;
+    return hipblas_reproducible_reduce(
+        handle,
+        n,
+        n <= 0,
+        x,
+        result,
+        kernels.size,
+        kernels.size,
+        [&](void* scratch, void* d_result, hipStream_t stream) {
+            return launch(n, x, incx, y, incy, scratch, d_result, stream);
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasReproducibleAsum(
+    hipblasHandle_t handle, int n, const void* x, int incx, void* result, hipDataType dataType)
+try
+{
+    auto kernels = hipblas_reproducible_kernels_for(dataType);
+    if(!kernels.asum)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return hipblas_reproducible_reduce(
+        handle,
+        n,
+        n <= 0 || incx <= 0,
+        x,
+        result,
+        kernels.real_size,
+        kernels.real_size,
+        [&](void* scratch, void* d_result, hipStream_t stream) {
+            return kernels.asum(n, x, incx, scratch, d_result, stream);
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasReproducibleNrm2(
+    hipblasHandle_t handle, int n, const void* x, int incx, void* result, hipDataType dataType)
+try
+{
+    auto kernels = hipblas_reproducible_kernels_for(dataType);
+    if(!kernels.nrm2)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return hipblas_reproducible_reduce(
+        handle,
+        n,
+        n <= 0 || incx <= 0,
+        x,
+        result,
+        kernels.real_size,
+        kernels.real_size,
+        [&](void* scratch, void* d_result, hipStream_t stream) {
+            return kernels.nrm2(n, x, incx, scratch, d_result, stream);
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasReproducibleIamax(
+    hipblasHandle_t handle, int n, const void* x, int incx, int* result, hipDataType dataType)
+try
+{
+    auto kernels = hipblas_reproducible_kernels_for(dataType);
+    if(!kernels.iamax)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return hipblas_reproducible_reduce(
+        handle,
+        n,
+        n <= 0 || incx <= 0,
+        x,
+        result,
+        kernels.iamax_size,
+        sizeof(int),
+        [&](void* scratch, void* d_result, hipStream_t stream) {
+            return kernels.iamax(n, x, incx, scratch, d_result, stream);
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
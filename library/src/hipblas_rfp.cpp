@@ -0,0 +1,1296 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_entry.hpp"
+
+// The Rectangular Full Packed functions of LAPACK: hipblas?trttf and hipblas?tfttr convert
+// between the full and RFP storage of a triangle, and hipblas?tfsm, hipblas?sfrk, hipblas?hfrk
+// and hipblas?pftrf are trsm, syrk, herk and potrf on a matrix in RFP storage, in the layouts
+// of LAPACK. They are built on the public trsm, gemm, syrk, herk and potrf of hipBLAS, so they
+// are the same for both backends.
+//
+// An RFP matrix of order n holds n(n+1)/2 elements in a full matrix, so each of its three blocks
+// is a plain matrix with a leading dimension. Seen as the lower triangle L of the symmetric or
+// Hermitian matrix (A itself when uplo is lower and A^H when it is upper) the blocks are the
+// triangles L11 and L22 of orders n1 and n2 = n - n1 and the full n2-by-n1 L21 between them,
+// each stored as it is or conjugate transposed. Every function is then a trsm, syrk, herk or
+// potrf on each triangle and one gemm on L21.
+
+#ifdef __HIP_PLATFORM_SOLVER__
+
+namespace
+{
+    constexpr int hipblas_rfp_tile = 32;
+    constexpr int hipblas_rfp_rows = 8;
+
+    template <typename T>
+    constexpr bool hipblas_rfp_is_complex
+        = std::is_same_v<T, hipFloatComplex> || std::is_same_v<T, hipDoubleComplex>;
+
+    template <typename T>
+    using hipblas_rfp_real_t = std::conditional_t<
+        std::is_same_v<T, hipFloatComplex>,
+        float,
+        std::conditional_t<std::is_same_v<T, hipDoubleComplex>, double, T>>;
+
+    // The blocks L11, L21 and L22 of an RFP matrix, in that order: block b is at offset[b] of
+    // the array with leading dimension ld, stored as L^H rather than L when conj[b] is set
+    struct hipblas_rfp_blocks
+    {
+        int     n1, n2, ld;
+        int64_t offset[3];
+        bool    conj[3];
+    };
+
+    hipblas_rfp_blocks
+        hipblas_rfp_layout(hipblasOperation_t transr, hipblasFillMode_t uplo, int n)
+    {
+        bool    lower = uplo == HIPBLAS_FILL_MODE_LOWER;
+        bool    odd   = n % 2;
+        int64_t k     = n / 2;
+
+        hipblas_rfp_blocks blocks;
+        blocks.n1 = lower ? n - k : k;
+        blocks.n2 = n - blocks.n1;
+
+        int64_t n1 = blocks.n1, n2 = blocks.n2;
+        auto    set = [&](int ld, int64_t o11, bool c11, int64_t o21, bool c21, int64_t o22) {
+            blocks.ld        = std::max(ld, 1);
+            blocks.offset[0] = o11;
+            blocks.offset[1] = o21;
+            blocks.offset[2] = o22;
+            blocks.conj[0]   = c11;
+            blocks.conj[1]   = c21;
+            blocks.conj[2]   = !c11;
+        };
+
+        if(transr == HIPBLAS_OP_N)
+        {
+            if(lower)
+                odd ? set(n, 0, false, n1, false, n) : set(n + 1, 1, false, k + 1, false, 0);
+            else
+                odd ? set(n, n2, false, 0, true, n1) : set(n + 1, k + 1, false, 0, true, k);
+        }
+        else
+        {
+            if(lower)
+                odd ? set(n1, 0, true, n1 * n1, true, 1) : set(k, k, true, k * (k + 1), true, 0);
+            else
+                odd ? set(n2, n2 * n2, true, 0, false, n1 * n2)
+                    : set(k, k * (k + 1), true, 0, false, k * k);
+        }
+        return blocks;
+    }
+
+    // Copies the uplo triangle of the n-by-n A to the RFP array, or back when to_rfp is false
+    template <typename T>
+    __global__ void hipblasRfpCopyKernel(
+        int n, bool upper, hipblas_rfp_blocks blocks, T* A, int lda, T* ARF, bool to_rfp)
+    {
+        int i = blockIdx.x * hipblas_rfp_tile + threadIdx.x;
+        if(i >= n)
+            return;
+
+        int j_end = min(n, int(blockIdx.y + 1) * hipblas_rfp_tile);
+        for(int j = blockIdx.y * hipblas_rfp_tile + threadIdx.y; j < j_end; j += hipblas_rfp_rows)
+        {
+            if(upper ? i > j : i < j)
+                continue;
+
+            // element (r, c) of L, in block b
+            int r = upper ? j : i, c = upper ? i : j;
+            int b = c >= blocks.n1 ? 2 : r >= blocks.n1 ? 1 : 0;
+            if(b)
+                r -= blocks.n1;
+            if(b == 2)
+                c -= blocks.n1;
+
+            int64_t ld   = blocks.ld;
+            bool    conj = blocks.conj[b] != upper;
+            int64_t k    = blocks.offset[b] + (blocks.conj[b] ? c + r * ld : r + c * ld);
+            T*      a    = A + i + int64_t(j) * lda;
+            if(to_rfp)
+                ARF[k] = conj ? hipblas_device_conj(*a) : *a;
+            else
+                *a = conj ? hipblas_device_conj(ARF[k]) : ARF[k];
+        }
+    }
+
+    // *info := n1 + *info2 when only the factorization of L22 failed
+    __global__ void hipblasRfpInfoKernel(int* info, const int* info2, int n1)
+    {
+        if(*info == 0 && *info2 > 0)
+            *info = *info2 + n1;
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblas_rfp_copy(hipblasHandle_t    handle,
+                                     hipblasOperation_t transr,
+                                     hipblasFillMode_t  uplo,
+                                     int                n,
+                                     T*                 A,
+                                     int                lda,
+                                     T*                 ARF,
+                                     bool               to_rfp)
+    {
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipblas_rfp_blocks blocks = hipblas_rfp_layout(transr, uplo, n);
+        dim3 grid((n - 1) / hipblas_rfp_tile + 1, (n - 1) / hipblas_rfp_tile + 1);
+        dim3 threads(hipblas_rfp_tile, hipblas_rfp_rows);
+        hipblasRfpCopyKernel<T><<<grid, threads, 0, stream>>>(
+            n, uplo == HIPBLAS_FILL_MODE_UPPER, blocks, A, lda, ARF, to_rfp);
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    // Switches the handle to host pointer mode for the calls that make up a function, which pass
+    // scalars of their own, and restores the pointer mode when done. The scalars of the function
+    // are read to the host first in device pointer mode, which waits for the stream.
+    class hipblas_rfp_host_mode
+    {
+    public:
+        explicit hipblas_rfp_host_mode(hipblasHandle_t handle)
+            : m_handle(handle)
+        {
+        }
+
+        ~hipblas_rfp_host_mode()
+        {
+            if(m_mode != HIPBLAS_POINTER_MODE_HOST)
+                hipblasSetPointerMode(m_handle, m_mode);
+        }
+
+        hipblasStatus_t set()
+        {
+            hipblasStatus_t status;
+            if((status = hipblasGetPointerMode(m_handle, &m_mode)) != HIPBLAS_STATUS_SUCCESS
+               || (status = hipblasGetStream(m_handle, &m_stream)) != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            return m_mode == HIPBLAS_POINTER_MODE_HOST
+                       ? HIPBLAS_STATUS_SUCCESS
+                       : hipblasSetPointerMode(m_handle, HIPBLAS_POINTER_MODE_HOST);
+        }
+
+        template <typename S>
+        hipblasStatus_t read(const S* x, S& value)
+        {
+            if(m_mode == HIPBLAS_POINTER_MODE_HOST)
+            {
+                value = *x;
+                return HIPBLAS_STATUS_SUCCESS;
+            }
+            if(hipMemcpyAsync(&value, x, sizeof(S), hipMemcpyDeviceToHost, m_stream) != hipSuccess
+               || hipStreamSynchronize(m_stream) != hipSuccess)
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+    private:
+        hipblasHandle_t      m_handle;
+        hipblasPointerMode_t m_mode = HIPBLAS_POINTER_MODE_HOST;
+        hipStream_t          m_stream;
+    };
+
+    template <typename T>
+    T hipblas_rfp_scalar(double x)
+    {
+        if constexpr(hipblas_rfp_is_complex<T>)
+            return T{hipblas_rfp_real_t<T>(x), 0};
+        else
+            return T(x);
+    }
+
+    // The triangle of block b of L and the operation on it that gives L_b, or L_b^H when herm
+    hipblasFillMode_t hipblas_rfp_uplo(const hipblas_rfp_blocks& blocks, int b)
+    {
+        return blocks.conj[b] ? HIPBLAS_FILL_MODE_UPPER : HIPBLAS_FILL_MODE_LOWER;
+    }
+
+    hipblasOperation_t hipblas_rfp_op(const hipblas_rfp_blocks& blocks, int b, bool herm)
+    {
+        return blocks.conj[b] != herm ? HIPBLAS_OP_C : HIPBLAS_OP_N;
+    }
+
+    // The hipBLAS functions for precision T, in host pointer mode
+    template <typename T>
+    hipblasStatus_t hipblas_rfp_trsm(hipblasHandle_t    handle,
+                                     hipblasSideMode_t  side,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t trans,
+                                     hipblasDiagType_t  diag,
+                                     int                m,
+                                     int                n,
+                                     T                  alpha,
+                                     const T*           A,
+                                     int                lda,
+                                     T*                 B,
+                                     int                ldb)
+    {
+        if(!m || !n)
+            return HIPBLAS_STATUS_SUCCESS;
+        if constexpr(std::is_same_v<T, float>)
+            return hipblasStrsm(handle, side, uplo, trans, diag, m, n, &alpha, A, lda, B, ldb);
+        else if constexpr(std::is_same_v<T, double>)
+            return hipblasDtrsm(handle, side, uplo, trans, diag, m, n, &alpha, A, lda, B, ldb);
+        else if constexpr(std::is_same_v<T, hipFloatComplex>)
+            return hipblasCtrsm_v2(handle, side, uplo, trans, diag, m, n, &alpha, A, lda, B, ldb);
+        else
+            return hipblasZtrsm_v2(handle, side, uplo, trans, diag, m, n, &alpha, A, lda, B, ldb);
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblas_rfp_gemm(hipblasHandle_t    handle,
+                                     hipblasOperation_t transA,
+                                     hipblasOperation_t transB,
+                                     int                m,
+                                     int                n,
+                                     int                k,
+                                     T                  alpha,
+                                     const T*           A,
+                                     int                lda,
+                                     const T*           B,
+                                     int                ldb,
+                                     T                  beta,
+                                     T*                 C,
+                                     int                ldc)
+    {
+        if(!m || !n)
+            return HIPBLAS_STATUS_SUCCESS;
+        if constexpr(std::is_same_v<T, float>)
+            return hipblasSgemm(
+                handle, transA, transB, m, n, k, &alpha, A, lda, B, ldb, &beta, C, ldc);
+        else if constexpr(std::is_same_v<T, double>)
+            return hipblasDgemm(
+                handle, transA, transB, m, n, k, &alpha, A, lda, B, ldb, &beta, C, ldc);
+        else if constexpr(std::is_same_v<T, hipFloatComplex>)
+            return hipblasCgemm_v2(
+                handle, transA, transB, m, n, k, &alpha, A, lda, B, ldb, &beta, C, ldc);
+        else
+            return hipblasZgemm_v2(
+                handle, transA, transB, m, n, k, &alpha, A, lda, B, ldb, &beta, C, ldc);
+    }
+
+    // syrk for real T and herk for complex T
+    template <typename T>
+    hipblasStatus_t hipblas_rfp_herk(hipblasHandle_t       handle,
+                                     hipblasFillMode_t     uplo,
+                                     hipblasOperation_t    trans,
+                                     int                   n,
+                                     int                   k,
+                                     hipblas_rfp_real_t<T> alpha,
+                                     const T*              A,
+                                     int                   lda,
+                                     hipblas_rfp_real_t<T> beta,
+                                     T*                    C,
+                                     int                   ldc)
+    {
+        if(!n)
+            return HIPBLAS_STATUS_SUCCESS;
+        if constexpr(std::is_same_v<T, float>)
+            return hipblasSsyrk(handle, uplo, trans, n, k, &alpha, A, lda, &beta, C, ldc);
+        else if constexpr(std::is_same_v<T, double>)
+            return hipblasDsyrk(handle, uplo, trans, n, k, &alpha, A, lda, &beta, C, ldc);
+        else if constexpr(std::is_same_v<T, hipFloatComplex>)
+            return hipblasCherk_v2(handle, uplo, trans, n, k, &alpha, A, lda, &beta, C, ldc);
+        else
+            return hipblasZherk_v2(handle, uplo, trans, n, k, &alpha, A, lda, &beta, C, ldc);
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblas_rfp_potrf(
+        hipblasHandle_t handle, hipblasFillMode_t uplo, int n, T* A, int lda, int* info)
+    {
+        if constexpr(std::is_same_v<T, float>)
+            return hipblasSpotrf(handle, uplo, n, A, lda, info);
+        else if constexpr(std::is_same_v<T, double>)
+            return hipblasDpotrf(handle, uplo, n, A, lda, info);
+        else if constexpr(std::is_same_v<T, hipFloatComplex>)
+            return hipblasCpotrf_v2(handle, uplo, n, A, lda, info);
+        else
+            return hipblasZpotrf_v2(handle, uplo, n, A, lda, info);
+    }
+
+    // Whether op is an operation of LAPACK for T: N or T for real types and N or C for complex
+    // ones, where C is the same as T for real types
+    template <typename T>
+    bool hipblas_rfp_valid_op(hipblasOperation_t op)
+    {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_C
+               || (op == HIPBLAS_OP_T && !hipblas_rfp_is_complex<T>);
+    }
+
+    bool hipblas_rfp_valid_uplo(hipblasFillMode_t uplo)
+    {
+        return uplo == HIPBLAS_FILL_MODE_LOWER || uplo == HIPBLAS_FILL_MODE_UPPER;
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblas_trttf(hipblasHandle_t    handle,
+                                  hipblasOperation_t transr,
+                                  hipblasFillMode_t  uplo,
+                                  int                n,
+                                  const T*           A,
+                                  int                lda,
+                                  T*                 ARF)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!hipblas_rfp_valid_op<T>(transr) || !hipblas_rfp_valid_uplo(uplo) || n < 0
+           || lda < std::max(n, 1))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!n)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!A || !ARF)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        return hipblas_rfp_copy(handle, transr, uplo, n, const_cast<T*>(A), lda, ARF, true);
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblas_tfttr(hipblasHandle_t    handle,
+                                  hipblasOperation_t transr,
+                                  hipblasFillMode_t  uplo,
+                                  int                n,
+                                  const T*           ARF,
+                                  T*                 A,
+                                  int                lda)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!hipblas_rfp_valid_op<T>(transr) || !hipblas_rfp_valid_uplo(uplo) || n < 0
+           || lda < std::max(n, 1))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!n)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!A || !ARF)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        return hipblas_rfp_copy(handle, transr, uplo, n, A, lda, const_cast<T*>(ARF), false);
+    }
+
+    // op(A) * X = alpha * B or X * op(A) = alpha * B, with op(A) either L or L^H. For L X = B,
+    // X1 = L11^-1 B1 and X2 = L22^-1 (B2 - L21 X1), and the other cases are alike.
+    template <typename T>
+    hipblasStatus_t hipblas_tfsm(hipblasHandle_t    handle,
+                                 hipblasOperation_t transr,
+                                 hipblasSideMode_t  side,
+                                 hipblasFillMode_t  uplo,
+                                 hipblasOperation_t trans,
+                                 hipblasDiagType_t  diag,
+                                 int                m,
+                                 int                n,
+                                 const T*           alpha,
+                                 const T*           A,
+                                 T*                 B,
+                                 int                ldb)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!hipblas_rfp_valid_op<T>(transr) || !hipblas_rfp_valid_op<T>(trans)
+           || !hipblas_rfp_valid_uplo(uplo)
+           || (side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+           || (diag != HIPBLAS_DIAG_NON_UNIT && diag != HIPBLAS_DIAG_UNIT) || m < 0 || n < 0
+           || ldb < std::max(m, 1))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!m || !n)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !A || !B)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipblas_rfp_host_mode host_mode(handle);
+        hipblasStatus_t       status;
+        T                     a;
+        if((status = host_mode.set()) != HIPBLAS_STATUS_SUCCESS
+           || (status = host_mode.read(alpha, a)) != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        bool               left   = side == HIPBLAS_SIDE_LEFT;
+        hipblas_rfp_blocks blocks = hipblas_rfp_layout(transr, uplo, left ? m : n);
+        int                n1 = blocks.n1, n2 = blocks.n2, ld = blocks.ld;
+        const T*           L21    = A + blocks.offset[1];
+
+        // op(A) is L for lower A and no transpose, or upper A and a transpose
+        bool herm = (uplo == HIPBLAS_FILL_MODE_LOWER) == (trans != HIPBLAS_OP_N);
+
+        T  one = hipblas_rfp_scalar<T>(1), minus_one = hipblas_rfp_scalar<T>(-1);
+        T* B1  = B;
+        T* B2  = left ? B + n1 : B + int64_t(n1) * ldb;
+        int rows1 = left ? n1 : m, cols1 = left ? n : n1;
+        int rows2 = left ? n2 : m, cols2 = left ? n : n2;
+
+        auto trsm = [&](int b, T scale, T* X, int rows, int cols) {
+            return hipblas_rfp_trsm(handle,
+                                    side,
+                                    hipblas_rfp_uplo(blocks, b),
+                                    hipblas_rfp_op(blocks, b, herm),
+                                    diag,
+                                    rows,
+                                    cols,
+                                    scale,
+                                    A + blocks.offset[b],
+                                    ld,
+                                    X,
+                                    ldb);
+        };
+
+        // Y := alpha * Y - op(L21) * X for the left side, or alpha * Y - X * op(L21) for the right
+        auto update = [&](const T* X, T* Y, int rows, int cols, int inner) {
+            hipblasOperation_t op = hipblas_rfp_op(blocks, 1, herm);
+            hipblasOperation_t op_l = left ? op : HIPBLAS_OP_N;
+            hipblasOperation_t op_r = left ? HIPBLAS_OP_N : op;
+            return hipblas_rfp_gemm(handle,
+                                    op_l,
+                                    op_r,
+                                    rows,
+                                    cols,
+                                    inner,
+                                    minus_one,
+                                    left ? L21 : X,
+                                    left ? ld : ldb,
+                                    left ? X : L21,
+                                    left ? ldb : ld,
+                                    a,
+                                    Y,
+                                    ldb);
+        };
+
+        // L11 is applied first when X1 comes first, for L from the left and L^H from the right
+        if(left != herm)
+        {
+            if((status = trsm(0, a, B1, rows1, cols1)) != HIPBLAS_STATUS_SUCCESS
+               || (status = update(B1, B2, rows2, cols2, n1)) != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            return trsm(2, one, B2, rows2, cols2);
+        }
+
+        if((status = trsm(2, a, B2, rows2, cols2)) != HIPBLAS_STATUS_SUCCESS
+           || (status = update(B2, B1, rows1, cols1, n2)) != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return trsm(0, one, B1, rows1, cols1);
+    }
+
+
+    // C := alpha * op(A) * op(A)^H + beta * C for C in RFP storage. With P = op(A) split into its
+    // first n1 rows P1 and its last n2 rows P2, L11 and L22 are updated by syrk or herk with P1
+    // and P2, and L21 by the gemm P2 * P1^H.
+    template <typename T>
+    hipblasStatus_t hipblas_sfrk(hipblasHandle_t              handle,
+                                 hipblasOperation_t           transr,
+                                 hipblasFillMode_t            uplo,
+                                 hipblasOperation_t           trans,
+                                 int                          n,
+                                 int                          k,
+                                 const hipblas_rfp_real_t<T>* alpha,
+                                 const T*                     A,
+                                 int                          lda,
+                                 const hipblas_rfp_real_t<T>* beta,
+                                 T*                           C)
+    {
+        bool normal = trans == HIPBLAS_OP_N;
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!hipblas_rfp_valid_op<T>(transr) || !hipblas_rfp_valid_op<T>(trans)
+           || !hipblas_rfp_valid_uplo(uplo) || n < 0 || k < 0
+           || lda < std::max(normal ? n : k, 1))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!n)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !beta || !C || (k && !A))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipblas_rfp_host_mode host_mode(handle);
+        hipblasStatus_t       status;
+        hipblas_rfp_real_t<T> a, b;
+        if((status = host_mode.set()) != HIPBLAS_STATUS_SUCCESS
+           || (status = host_mode.read(alpha, a)) != HIPBLAS_STATUS_SUCCESS
+           || (status = host_mode.read(beta, b)) != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipblas_rfp_blocks blocks = hipblas_rfp_layout(transr, uplo, n);
+        int                n1 = blocks.n1, n2 = blocks.n2, ld = blocks.ld;
+        hipblasOperation_t op = normal ? HIPBLAS_OP_N : HIPBLAS_OP_C;
+        const T*           P1 = A;
+        const T*           P2 = normal ? A + n1 : A + int64_t(n1) * lda;
+
+        T*                 C11 = C + blocks.offset[0];
+        T*                 C22 = C + blocks.offset[2];
+
+        if((status = hipblas_rfp_herk(
+                handle, hipblas_rfp_uplo(blocks, 0), op, n1, k, a, P1, lda, b, C11, ld))
+               != HIPBLAS_STATUS_SUCCESS
+           || (status = hipblas_rfp_herk(
+                   handle, hipblas_rfp_uplo(blocks, 2), op, n2, k, a, P2, lda, b, C22, ld))
+                  != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // L21 := alpha * P2 * P1^H + beta * L21, or its conjugate transpose when stored so
+        bool conj = blocks.conj[1];
+        return hipblas_rfp_gemm(handle,
+                                normal ? HIPBLAS_OP_N : HIPBLAS_OP_C,
+                                normal ? HIPBLAS_OP_C : HIPBLAS_OP_N,
+                                conj ? n1 : n2,
+                                conj ? n2 : n1,
+                                k,
+                                hipblas_rfp_scalar<T>(a),
+                                conj ? P1 : P2,
+                                lda,
+                                conj ? P2 : P1,
+                                lda,
+                                hipblas_rfp_scalar<T>(b),
+                                C + blocks.offset[1],
+                                ld);
+    }
+
+    // The Cholesky factorization of A in RFP storage: L11 := chol(L11), L21 := L21 * L11^-H and
+    // L22 := chol(L22 - L21 * L21^H), where the factorization of L22 reports its failure in the
+    // scratch memory of the handle
+    template <typename T>
+    hipblasStatus_t hipblas_pftrf(hipblasHandle_t    handle,
+                                  hipblasOperation_t transr,
+                                  hipblasFillMode_t  uplo,
+                                  int                n,
+                                  T*                 A,
+                                  int*               info)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!hipblas_rfp_valid_op<T>(transr) || !hipblas_rfp_valid_uplo(uplo) || n < 0 || !info
+           || (n && !A))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipblas_rfp_blocks blocks = hipblas_rfp_layout(transr, uplo, n);
+        int                n1 = blocks.n1, n2 = blocks.n2, ld = blocks.ld;
+        T*                 L11 = A + blocks.offset[0];
+        T*                 L21 = A + blocks.offset[1];
+        T*                 L22 = A + blocks.offset[2];
+        if(!n2)
+            return hipblas_rfp_potrf(handle, hipblas_rfp_uplo(blocks, 0), n1, L11, ld, info);
+        if(!n1)
+            return hipblas_rfp_potrf(handle, hipblas_rfp_uplo(blocks, 2), n2, L22, ld, info);
+
+        hipblas_rfp_host_mode host_mode(handle);
+        hipblasStatus_t       status;
+        hipStream_t           stream;
+        if((status = host_mode.set()) != HIPBLAS_STATUS_SUCCESS
+           || (status = hipblasGetStream(handle, &stream)) != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        T one = hipblas_rfp_scalar<T>(1);
+        if((status = hipblas_rfp_potrf(handle, hipblas_rfp_uplo(blocks, 0), n1, L11, ld, info))
+           != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // L21 := L21 * L11^-H, or L21^H := L11^-1 * L21^H when it is stored conjugate transposed
+        bool conj = blocks.conj[1];
+        if((status = hipblas_rfp_trsm(handle,
+                                      conj ? HIPBLAS_SIDE_LEFT : HIPBLAS_SIDE_RIGHT,
+                                      hipblas_rfp_uplo(blocks, 0),
+                                      hipblas_rfp_op(blocks, 0, !conj),
+                                      HIPBLAS_DIAG_NON_UNIT,
+                                      conj ? n1 : n2,
+                                      conj ? n2 : n1,
+                                      one,
+                                      L11,
+                                      ld,
+                                      L21,
+                                      ld))
+               != HIPBLAS_STATUS_SUCCESS
+           || (status = hipblas_rfp_herk(handle,
+                                         hipblas_rfp_uplo(blocks, 2),
+                                         conj ? HIPBLAS_OP_C : HIPBLAS_OP_N,
+                                         n2,
+                                         n1,
+                                         hipblas_rfp_real_t<T>(-1),
+                                         L21,
+                                         ld,
+                                         hipblas_rfp_real_t<T>(1),
+                                         L22,
+                                         ld))
+                  != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        int* info2 = static_cast<int*>(hipblasGetScratch(handle, sizeof(int), stream));
+        if(!info2)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        if((status = hipblas_rfp_potrf(handle, hipblas_rfp_uplo(blocks, 2), n2, L22, ld, info2))
+           != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipblasRfpInfoKernel<<<1, 1, 0, stream>>>(info, info2, n1);
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+}
+
+extern "C" hipblasStatus_t hipblasStrttf(hipblasHandle_t          handle,
+                                         const hipblasOperation_t transr,
+                                         const hipblasFillMode_t  uplo,
+                                         const int                n,
+                                         const float*             A,
+                                         const int                lda,
+                                         float*                   ARF)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, uplo, n, lda);
+
+    return hipblas_trttf<float>(handle, transr, uplo, n, A, lda, ARF);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDtrttf(hipblasHandle_t          handle,
+                                         const hipblasOperation_t transr,
+                                         const hipblasFillMode_t  uplo,
+                                         const int                n,
+                                         const double*            A,
+                                         const int                lda,
+                                         double*                  ARF)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, uplo, n, lda);
+
+    return hipblas_trttf<double>(handle, transr, uplo, n, A, lda, ARF);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCtrttf(hipblasHandle_t          handle,
+                                         const hipblasOperation_t transr,
+                                         const hipblasFillMode_t  uplo,
+                                         const int                n,
+                                         const hipblasComplex*    A,
+                                         const int                lda,
+                                         hipblasComplex*          ARF)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, uplo, n, lda);
+
+    return hipblas_trttf<hipFloatComplex>(
+        handle, transr, uplo, n, (const hipFloatComplex*)A, lda, (hipFloatComplex*)ARF);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZtrttf(hipblasHandle_t             handle,
+                                         const hipblasOperation_t    transr,
+                                         const hipblasFillMode_t     uplo,
+                                         const int                   n,
+                                         const hipblasDoubleComplex* A,
+                                         const int                   lda,
+                                         hipblasDoubleComplex*       ARF)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, uplo, n, lda);
+
+    return hipblas_trttf<hipDoubleComplex>(
+        handle, transr, uplo, n, (const hipDoubleComplex*)A, lda, (hipDoubleComplex*)ARF);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCtrttf_v2(hipblasHandle_t          handle,
+                                            const hipblasOperation_t transr,
+                                            const hipblasFillMode_t  uplo,
+                                            const int                n,
+                                            const hipComplex*        A,
+                                            const int                lda,
+                                            hipComplex*              ARF)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, uplo, n, lda);
+
+    return hipblas_trttf<hipFloatComplex>(handle, transr, uplo, n, A, lda, ARF);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZtrttf_v2(hipblasHandle_t          handle,
+                                            const hipblasOperation_t transr,
+                                            const hipblasFillMode_t  uplo,
+                                            const int                n,
+                                            const hipDoubleComplex*  A,
+                                            const int                lda,
+                                            hipDoubleComplex*        ARF)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, uplo, n, lda);
+
+    return hipblas_trttf<hipDoubleComplex>(handle, transr, uplo, n, A, lda, ARF);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasStfttr(hipblasHandle_t          handle,
+                                         const hipblasOperation_t transr,
+                                         const hipblasFillMode_t  uplo,
+                                         const int                n,
+                                         const float*             ARF,
+                                         float*                   A,
+                                         const int                lda)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, uplo, n, lda);
+
+    return hipblas_tfttr<float>(handle, transr, uplo, n, ARF, A, lda);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDtfttr(hipblasHandle_t          handle,
+                                         const hipblasOperation_t transr,
+                                         const hipblasFillMode_t  uplo,
+                                         const int                n,
+                                         const double*            ARF,
+                                         double*                  A,
+                                         const int                lda)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, uplo, n, lda);
+
+    return hipblas_tfttr<double>(handle, transr, uplo, n, ARF, A, lda);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCtfttr(hipblasHandle_t          handle,
+                                         const hipblasOperation_t transr,
+                                         const hipblasFillMode_t  uplo,
+                                         const int                n,
+                                         const hipblasComplex*    ARF,
+                                         hipblasComplex*          A,
+                                         const int                lda)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, uplo, n, lda);
+
+    return hipblas_tfttr<hipFloatComplex>(
+        handle, transr, uplo, n, (const hipFloatComplex*)ARF, (hipFloatComplex*)A, lda);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZtfttr(hipblasHandle_t             handle,
+                                         const hipblasOperation_t    transr,
+                                         const hipblasFillMode_t     uplo,
+                                         const int                   n,
+                                         const hipblasDoubleComplex* ARF,
+                                         hipblasDoubleComplex*       A,
+                                         const int                   lda)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, uplo, n, lda);
+
+    return hipblas_tfttr<hipDoubleComplex>(
+        handle, transr, uplo, n, (const hipDoubleComplex*)ARF, (hipDoubleComplex*)A, lda);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCtfttr_v2(hipblasHandle_t          handle,
+                                            const hipblasOperation_t transr,
+                                            const hipblasFillMode_t  uplo,
+                                            const int                n,
+                                            const hipComplex*        ARF,
+                                            hipComplex*              A,
+                                            const int                lda)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, uplo, n, lda);
+
+    return hipblas_tfttr<hipFloatComplex>(handle, transr, uplo, n, ARF, A, lda);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZtfttr_v2(hipblasHandle_t          handle,
+                                            const hipblasOperation_t transr,
+                                            const hipblasFillMode_t  uplo,
+                                            const int                n,
+                                            const hipDoubleComplex*  ARF,
+                                            hipDoubleComplex*        A,
+                                            const int                lda)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, uplo, n, lda);
+
+    return hipblas_tfttr<hipDoubleComplex>(handle, transr, uplo, n, ARF, A, lda);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasStfsm(hipblasHandle_t          handle,
+                                        const hipblasOperation_t transr,
+                                        const hipblasSideMode_t  side,
+                                        const hipblasFillMode_t  uplo,
+                                        const hipblasOperation_t trans,
+                                        const hipblasDiagType_t  diag,
+                                        const int                m,
+                                        const int                n,
+                                        const float*             alpha,
+                                        const float*             A,
+                                        float*                   B,
+                                        const int                ldb)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, side, uplo, trans, diag, m, n, ldb);
+
+    return hipblas_tfsm<float>(handle, transr, side, uplo, trans, diag, m, n, alpha, A, B, ldb);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDtfsm(hipblasHandle_t          handle,
+                                        const hipblasOperation_t transr,
+                                        const hipblasSideMode_t  side,
+                                        const hipblasFillMode_t  uplo,
+                                        const hipblasOperation_t trans,
+                                        const hipblasDiagType_t  diag,
+                                        const int                m,
+                                        const int                n,
+                                        const double*            alpha,
+                                        const double*            A,
+                                        double*                  B,
+                                        const int                ldb)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, side, uplo, trans, diag, m, n, ldb);
+
+    return hipblas_tfsm<double>(handle, transr, side, uplo, trans, diag, m, n, alpha, A, B, ldb);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCtfsm(hipblasHandle_t          handle,
+                                        const hipblasOperation_t transr,
+                                        const hipblasSideMode_t  side,
+                                        const hipblasFillMode_t  uplo,
+                                        const hipblasOperation_t trans,
+                                        const hipblasDiagType_t  diag,
+                                        const int                m,
+                                        const int                n,
+                                        const hipblasComplex*    alpha,
+                                        const hipblasComplex*    A,
+                                        hipblasComplex*          B,
+                                        const int                ldb)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, side, uplo, trans, diag, m, n, ldb);
+
+    return hipblas_tfsm<hipFloatComplex>(handle,
+                                         transr,
+                                         side,
+                                         uplo,
+                                         trans,
+                                         diag,
+                                         m,
+                                         n,
+                                         (const hipFloatComplex*)alpha,
+                                         (const hipFloatComplex*)A,
+                                         (hipFloatComplex*)B,
+                                         ldb);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZtfsm(hipblasHandle_t             handle,
+                                        const hipblasOperation_t    transr,
+                                        const hipblasSideMode_t     side,
+                                        const hipblasFillMode_t     uplo,
+                                        const hipblasOperation_t    trans,
+                                        const hipblasDiagType_t     diag,
+                                        const int                   m,
+                                        const int                   n,
+                                        const hipblasDoubleComplex* alpha,
+                                        const hipblasDoubleComplex* A,
+                                        hipblasDoubleComplex*       B,
+                                        const int                   ldb)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, side, uplo, trans, diag, m, n, ldb);
+
+    return hipblas_tfsm<hipDoubleComplex>(handle,
+                                          transr,
+                                          side,
+                                          uplo,
+                                          trans,
+                                          diag,
+                                          m,
+                                          n,
+                                          (const hipDoubleComplex*)alpha,
+                                          (const hipDoubleComplex*)A,
+                                          (hipDoubleComplex*)B,
+                                          ldb);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCtfsm_v2(hipblasHandle_t          handle,
+                                           const hipblasOperation_t transr,
+                                           const hipblasSideMode_t  side,
+                                           const hipblasFillMode_t  uplo,
+                                           const hipblasOperation_t trans,
+                                           const hipblasDiagType_t  diag,
+                                           const int                m,
+                                           const int                n,
+                                           const hipComplex*        alpha,
+                                           const hipComplex*        A,
+                                           hipComplex*              B,
+                                           const int                ldb)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, side, uplo, trans, diag, m, n, ldb);
+
+    return hipblas_tfsm<hipFloatComplex>(
+        handle, transr, side, uplo, trans, diag, m, n, alpha, A, B, ldb);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZtfsm_v2(hipblasHandle_t          handle,
+                                           const hipblasOperation_t transr,
+                                           const hipblasSideMode_t  side,
+                                           const hipblasFillMode_t  uplo,
+                                           const hipblasOperation_t trans,
+                                           const hipblasDiagType_t  diag,
+                                           const int                m,
+                                           const int                n,
+                                           const hipDoubleComplex*  alpha,
+                                           const hipDoubleComplex*  A,
+                                           hipDoubleComplex*        B,
+                                           const int                ldb)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, side, uplo, trans, diag, m, n, ldb);
+
+    return hipblas_tfsm<hipDoubleComplex>(
+        handle, transr, side, uplo, trans, diag, m, n, alpha, A, B, ldb);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasSsfrk(hipblasHandle_t          handle,
+                                        const hipblasOperation_t transr,
+                                        const hipblasFillMode_t  uplo,
+                                        const hipblasOperation_t trans,
+                                        const int                n,
+                                        const int                k,
+                                        const float*             alpha,
+                                        const float*             A,
+                                        const int                lda,
+                                        const float*             beta,
+                                        float*                   C)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, uplo, trans, n, k, lda);
+
+    return hipblas_sfrk<float>(handle, transr, uplo, trans, n, k, alpha, A, lda, beta, C);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDsfrk(hipblasHandle_t          handle,
+                                        const hipblasOperation_t transr,
+                                        const hipblasFillMode_t  uplo,
+                                        const hipblasOperation_t trans,
+                                        const int                n,
+                                        const int                k,
+                                        const double*            alpha,
+                                        const double*            A,
+                                        const int                lda,
+                                        const double*            beta,
+                                        double*                  C)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, uplo, trans, n, k, lda);
+
+    return hipblas_sfrk<double>(handle, transr, uplo, trans, n, k, alpha, A, lda, beta, C);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasChfrk(hipblasHandle_t          handle,
+                                        const hipblasOperation_t transr,
+                                        const hipblasFillMode_t  uplo,
+                                        const hipblasOperation_t trans,
+                                        const int                n,
+                                        const int                k,
+                                        const float*             alpha,
+                                        const hipblasComplex*    A,
+                                        const int                lda,
+                                        const float*             beta,
+                                        hipblasComplex*          C)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, uplo, trans, n, k, lda);
+
+    return hipblas_sfrk<hipFloatComplex>(handle,
+                                         transr,
+                                         uplo,
+                                         trans,
+                                         n,
+                                         k,
+                                         alpha,
+                                         (const hipFloatComplex*)A,
+                                         lda,
+                                         beta,
+                                         (hipFloatComplex*)C);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZhfrk(hipblasHandle_t             handle,
+                                        const hipblasOperation_t    transr,
+                                        const hipblasFillMode_t     uplo,
+                                        const hipblasOperation_t    trans,
+                                        const int                   n,
+                                        const int                   k,
+                                        const double*               alpha,
+                                        const hipblasDoubleComplex* A,
+                                        const int                   lda,
+                                        const double*               beta,
+                                        hipblasDoubleComplex*       C)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, uplo, trans, n, k, lda);
+
+    return hipblas_sfrk<hipDoubleComplex>(handle,
+                                          transr,
+                                          uplo,
+                                          trans,
+                                          n,
+                                          k,
+                                          alpha,
+                                          (const hipDoubleComplex*)A,
+                                          lda,
+                                          beta,
+                                          (hipDoubleComplex*)C);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasChfrk_v2(hipblasHandle_t          handle,
+                                           const hipblasOperation_t transr,
+                                           const hipblasFillMode_t  uplo,
+                                           const hipblasOperation_t trans,
+                                           const int                n,
+                                           const int                k,
+                                           const float*             alpha,
+                                           const hipComplex*        A,
+                                           const int                lda,
+                                           const float*             beta,
+                                           hipComplex*              C)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, uplo, trans, n, k, lda);
+
+    return hipblas_sfrk<hipFloatComplex>(handle, transr, uplo, trans, n, k, alpha, A, lda, beta, C);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZhfrk_v2(hipblasHandle_t          handle,
+                                           const hipblasOperation_t transr,
+                                           const hipblasFillMode_t  uplo,
+                                           const hipblasOperation_t trans,
+                                           const int                n,
+                                           const int                k,
+                                           const double*            alpha,
+                                           const hipDoubleComplex*  A,
+                                           const int                lda,
+                                           const double*            beta,
+                                           hipDoubleComplex*        C)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, uplo, trans, n, k, lda);
+
+    return hipblas_sfrk<hipDoubleComplex>(
+        handle, transr, uplo, trans, n, k, alpha, A, lda, beta, C);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasSpftrf(hipblasHandle_t          handle,
+                                         const hipblasOperation_t transr,
+                                         const hipblasFillMode_t  uplo,
+                                         const int                n,
+                                         float*                   A,
+                                         int*                     info)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, uplo, n);
+
+    return hipblas_pftrf<float>(handle, transr, uplo, n, A, info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDpftrf(hipblasHandle_t          handle,
+                                         const hipblasOperation_t transr,
+                                         const hipblasFillMode_t  uplo,
+                                         const int                n,
+                                         double*                  A,
+                                         int*                     info)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, uplo, n);
+
+    return hipblas_pftrf<double>(handle, transr, uplo, n, A, info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCpftrf(hipblasHandle_t          handle,
+                                         const hipblasOperation_t transr,
+                                         const hipblasFillMode_t  uplo,
+                                         const int                n,
+                                         hipblasComplex*          A,
+                                         int*                     info)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, uplo, n);
+
+    return hipblas_pftrf<hipFloatComplex>(handle, transr, uplo, n, (hipFloatComplex*)A, info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZpftrf(hipblasHandle_t          handle,
+                                         const hipblasOperation_t transr,
+                                         const hipblasFillMode_t  uplo,
+                                         const int                n,
+                                         hipblasDoubleComplex*    A,
+                                         int*                     info)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, uplo, n);
+
+    return hipblas_pftrf<hipDoubleComplex>(handle, transr, uplo, n, (hipDoubleComplex*)A, info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCpftrf_v2(hipblasHandle_t          handle,
+                                            const hipblasOperation_t transr,
+                                            const hipblasFillMode_t  uplo,
+                                            const int                n,
+                                            hipComplex*              A,
+                                            int*                     info)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, uplo, n);
+
+    return hipblas_pftrf<hipFloatComplex>(handle, transr, uplo, n, A, info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZpftrf_v2(hipblasHandle_t          handle,
+                                            const hipblasOperation_t transr,
+                                            const hipblasFillMode_t  uplo,
+                                            const int                n,
+                                            hipDoubleComplex*        A,
+                                            int*                     info)
+try
+{
+    HIPBLAS_ENTRY(handle, transr, uplo, n);
+
+    return hipblas_pftrf<hipDoubleComplex>(handle, transr, uplo, n, A, info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+#endif
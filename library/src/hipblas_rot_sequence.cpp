@@ -0,0 +1,542 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+#include "exceptions.hpp"
+#include "hipblas_entry.hpp"
+
+// The sequences of plane rotations of rotSequence, as in LAPACK lasr. Neither backend has them, so
+// they are a kernel of hipBLAS for both. A rotation k of the sequence mixes two of the z rows of A
+// (side left, z = m) or two of its z columns (side right, z = n), called positions here. Applied
+// one at a time with rot, the sequence would read and write A z - 1 times.
+//
+// Every rotation of the sequence shares a position with the one before it: the position k + 1 of
+// the variable pivot, or the fixed position of the top and bottom pivots. Each thread owns a line,
+// a column of A from the left or a row of it from the right, and carries that shared element in a
+// register from one rotation to the next, so each element of A is read and written once. The
+// positions are staged through shared memory in tiles, which keeps the loads and stores of a block
+// coalesced whichever way A is stored.
+
+namespace
+{
+    // The lines of a block, one per thread, and the positions of a tile
+    constexpr int hipblas_rot_sequence_lines = 64;
+    constexpr int hipblas_rot_sequence_depth = 32;
+
+    // x and y become c * x + s * y and c * y - conj(s) * x
+    template <typename T, typename U>
+    __device__ inline void hipblas_rot_sequence_rotate(U c, T s, T& x, T& y)
+    {
+        if constexpr(std::is_arithmetic_v<T>)
+        {
+            T t = c * x + s * y;
+            y   = c * y - s * x;
+            x   = t;
+        }
+        else
+        {
+            T t;
+            t.x = c * x.x + (s.x * y.x - s.y * y.y);
+            t.y = c * x.y + (s.x * y.y + s.y * y.x);
+            y.x = c * y.x - (s.x * x.x + s.y * x.y);
+            y.y = c * y.y - (s.x * x.y - s.y * x.x);
+            x   = t;
+        }
+    }
+
+    // The element at position i of line l
+    template <typename T>
+    __device__ inline T& hipblas_rot_sequence_at(T* A, int64_t lda, bool left, int64_t i, int64_t l)
+    {
+        return left ? A[i + l * lda] : A[l + i * lda];
+    }
+
+    struct hipblas_rot_sequence_problem
+    {
+        bool              left;
+        hipblasRotPivot_t pivot;
+        bool              forward;
+        int64_t           z;
+        int64_t           lines;
+        const void*       c;
+        hipblasStride     stride_c;
+        const void*       s;
+        hipblasStride     stride_s;
+        void*             A;
+        int64_t           lda;
+        hipblasStride     stride_a;
+        int64_t           batch_count;
+    };
+
+    // One block of lines per iteration of the grid-stride loop. Rotation k reads its other
+    // position, k + shift, from the tile, and leaves one of its two results there, or, when that
+    // position belongs to a tile that is already written back, in A itself.
+    template <typename T, typename U>
+    __global__ void __launch_bounds__(hipblas_rot_sequence_lines)
+        hipblasRotSequenceKernel(hipblas_rot_sequence_problem problem)
+    {
+        constexpr int lines = hipblas_rot_sequence_lines;
+        constexpr int depth = hipblas_rot_sequence_depth;
+
+        __shared__ T tile[depth][lines + 1];
+
+        const int     t         = threadIdx.x;
+        const bool    left      = problem.left;
+        const bool    forward   = problem.forward;
+        const bool    variable  = problem.pivot == HIPBLAS_ROT_PIVOT_VARIABLE;
+        const bool    top       = problem.pivot == HIPBLAS_ROT_PIVOT_TOP;
+        const int64_t rotations = problem.z - 1;
+
+        // the carried element is x of the rotation, or y, and the one left behind is x, or y
+        const bool    carry_x = top || (variable && forward);
+        const bool    out_x   = variable ? forward : !top;
+        const int     shift   = carry_x ? 1 : 0;
+        const int64_t first   = carry_x ? 0 : rotations;
+        const int64_t last    = variable ? rotations - first : first;
+
+        const int64_t groups = (problem.lines - 1) / lines + 1;
+        for(int64_t g = blockIdx.x; g < groups * problem.batch_count; g += gridDim.x)
+        {
+            const int64_t b      = g / groups;
+            const int64_t line0  = (g % groups) * lines;
+            const int64_t count  = min(int64_t(lines), problem.lines - line0);
+            const bool    active = t < count;
+
+            const U* c = static_cast<const U*>(problem.c) + b * problem.stride_c;
+            const T* s = static_cast<const T*>(problem.s) + b * problem.stride_s;
+            T*       A = static_cast<T*>(problem.A) + b * problem.stride_a;
+
+            // the lines of the block start at line0
+            A += left ? line0 * problem.lda : line0;
+
+            T carry{};
+            if(active)
+                carry = hipblas_rot_sequence_at(A, problem.lda, left, first, t);
+
+            for(int64_t done = 0; done < rotations; done += depth)
+            {
+                const int     n    = int(min(int64_t(depth), rotations - done));
+                const int64_t k0   = forward ? done : rotations - done - n;
+                const int64_t pos0 = k0 + shift;
+
+                // along the columns of A from the left and along its rows from the right
+                for(int e = t; e < depth * lines; e += lines)
+                {
+                    int i = left ? e % depth : e / lines;
+                    int l = left ? e / depth : e % lines;
+                    if(i < n && l < count)
+                        tile[i][l] = hipblas_rot_sequence_at(A, problem.lda, left, pos0 + i, l);
+                }
+                __syncthreads();
+
+                if(active)
+                {
+                    for(int r = 0; r < n; r++)
+                    {
+                        const int     i = forward ? r : n - 1 - r;
+                        const int64_t k = k0 + i;
+
+                        T x = carry_x ? carry : tile[i][t];
+                        T y = carry_x ? tile[i][t] : carry;
+                        hipblas_rot_sequence_rotate(c[k], s[k], x, y);
+                        carry = out_x ? y : x;
+
+                        const int64_t pos = variable ? (forward ? k : k + 1) : k + shift;
+                        if(pos >= pos0 && pos < pos0 + n)
+                            tile[pos - pos0][t] = out_x ? x : y;
+                        else
+                            hipblas_rot_sequence_at(A, problem.lda, left, pos, t) = out_x ? x : y;
+                    }
+                }
+                __syncthreads();
+
+                for(int e = t; e < depth * lines; e += lines)
+                {
+                    int i = left ? e % depth : e / lines;
+                    int l = left ? e / depth : e % lines;
+                    if(i < n && l < count)
+                        hipblas_rot_sequence_at(A, problem.lda, left, pos0 + i, l) = tile[i][l];
+                }
+                __syncthreads();
+            }
+
+            if(active)
+                hipblas_rot_sequence_at(A, problem.lda, left, last, t) = carry;
+        }
+    }
+
+    template <typename T, typename U>
+    hipblasStatus_t hipblas_rot_sequence(hipblasHandle_t       handle,
+                                         hipblasSideMode_t     side,
+                                         hipblasRotPivot_t     pivot,
+                                         hipblasRotDirection_t direct,
+                                         int64_t               m,
+                                         int64_t               n,
+                                         const U*              c,
+                                         hipblasStride         stride_c,
+                                         const void*           s,
+                                         hipblasStride         stride_s,
+                                         void*                 A,
+                                         int64_t               lda,
+                                         hipblasStride         stride_a,
+                                         int64_t               batch_count)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(pivot != HIPBLAS_ROT_PIVOT_VARIABLE && pivot != HIPBLAS_ROT_PIVOT_TOP
+           && pivot != HIPBLAS_ROT_PIVOT_BOTTOM)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(direct != HIPBLAS_ROT_DIRECTION_FORWARD && direct != HIPBLAS_ROT_DIRECTION_BACKWARD)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(m < 0 || n < 0 || lda < std::max<int64_t>(m, 1) || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipblas_rot_sequence_problem problem;
+        problem.left  = side == HIPBLAS_SIDE_LEFT;
+        problem.z     = problem.left ? m : n;
+        problem.lines = problem.left ? n : m;
+        if(problem.z < 2 || !problem.lines || !batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!c || !s || !A)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        problem.pivot       = pivot;
+        problem.forward     = direct == HIPBLAS_ROT_DIRECTION_FORWARD;
+        problem.c           = c;
+        problem.stride_c    = stride_c;
+        problem.s           = s;
+        problem.stride_s    = stride_s;
+        problem.A           = A;
+        problem.lda         = lda;
+        problem.stride_a    = stride_a;
+        problem.batch_count = batch_count;
+
+        int64_t groups = (problem.lines - 1) / hipblas_rot_sequence_lines + 1;
+        int     blocks = int(std::min<int64_t>(groups * batch_count, 65535));
+        hipblasRotSequenceKernel<T, U>
+            <<<blocks, hipblas_rot_sequence_lines, 0, stream>>>(problem);
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+}
+
+extern "C" hipblasStatus_t hipblasSrotSequence(hipblasHandle_t       handle,
+                                               hipblasSideMode_t     side,
+                                               hipblasRotPivot_t     pivot,
+                                               hipblasRotDirection_t direct,
+                                               const int             m,
+                                               const int             n,
+                                               const float*          c,
+                                               const float*          s,
+                                               float*                A,
+                                               const int             lda)
+try
+{
+    HIPBLAS_ENTRY(handle, side, m, n, lda);
+
+    return hipblas_rot_sequence<float, float>(
+        handle, side, pivot, direct, m, n, c, 0, s, 0, A, lda, 0, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDrotSequence(hipblasHandle_t       handle,
+                                               hipblasSideMode_t     side,
+                                               hipblasRotPivot_t     pivot,
+                                               hipblasRotDirection_t direct,
+                                               const int             m,
+                                               const int             n,
+                                               const double*         c,
+                                               const double*         s,
+                                               double*               A,
+                                               const int             lda)
+try
+{
+    HIPBLAS_ENTRY(handle, side, m, n, lda);
+
+    return hipblas_rot_sequence<double, double>(
+        handle, side, pivot, direct, m, n, c, 0, s, 0, A, lda, 0, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCrotSequence(hipblasHandle_t       handle,
+                                               hipblasSideMode_t     side,
+                                               hipblasRotPivot_t     pivot,
+                                               hipblasRotDirection_t direct,
+                                               const int             m,
+                                               const int             n,
+                                               const float*          c,
+                                               const hipblasComplex* s,
+                                               hipblasComplex*       A,
+                                               const int             lda)
+try
+{
+    HIPBLAS_ENTRY(handle, side, m, n, lda);
+
+    return hipblas_rot_sequence<hipFloatComplex, float>(
+        handle, side, pivot, direct, m, n, c, 0, s, 0, A, lda, 0, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZrotSequence(hipblasHandle_t             handle,
+                                               hipblasSideMode_t           side,
+                                               hipblasRotPivot_t           pivot,
+                                               hipblasRotDirection_t       direct,
+                                               const int                   m,
+                                               const int                   n,
+                                               const double*               c,
+                                               const hipblasDoubleComplex* s,
+                                               hipblasDoubleComplex*       A,
+                                               const int                   lda)
+try
+{
+    HIPBLAS_ENTRY(handle, side, m, n, lda);
+
+    return hipblas_rot_sequence<hipDoubleComplex, double>(
+        handle, side, pivot, direct, m, n, c, 0, s, 0, A, lda, 0, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCrotSequence_v2(hipblasHandle_t       handle,
+                                                  hipblasSideMode_t     side,
+                                                  hipblasRotPivot_t     pivot,
+                                                  hipblasRotDirection_t direct,
+                                                  const int             m,
+                                                  const int             n,
+                                                  const float*          c,
+                                                  const hipComplex*     s,
+                                                  hipComplex*           A,
+                                                  const int             lda)
+try
+{
+    HIPBLAS_ENTRY(handle, side, m, n, lda);
+
+    return hipblas_rot_sequence<hipFloatComplex, float>(
+        handle, side, pivot, direct, m, n, c, 0, s, 0, A, lda, 0, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZrotSequence_v2(hipblasHandle_t         handle,
+                                                  hipblasSideMode_t       side,
+                                                  hipblasRotPivot_t       pivot,
+                                                  hipblasRotDirection_t   direct,
+                                                  const int               m,
+                                                  const int               n,
+                                                  const double*           c,
+                                                  const hipDoubleComplex* s,
+                                                  hipDoubleComplex*       A,
+                                                  const int               lda)
+try
+{
+    HIPBLAS_ENTRY(handle, side, m, n, lda);
+
+    return hipblas_rot_sequence<hipDoubleComplex, double>(
+        handle, side, pivot, direct, m, n, c, 0, s, 0, A, lda, 0, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasSrotSequenceStridedBatched(hipblasHandle_t       handle,
+                                                             hipblasSideMode_t     side,
+                                                             hipblasRotPivot_t     pivot,
+                                                             hipblasRotDirection_t direct,
+                                                             const int             m,
+                                                             const int             n,
+                                                             const float*          c,
+                                                             const hipblasStride   stridec,
+                                                             const float*          s,
+                                                             const hipblasStride   strides,
+                                                             float*                A,
+                                                             const int             lda,
+                                                             const hipblasStride   strideA,
+                                                             const int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, side, m, n, stridec, strides, lda, strideA, batchCount);
+
+    return hipblas_rot_sequence<float, float>(
+        handle, side, pivot, direct, m, n, c, stridec, s, strides, A, lda, strideA, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDrotSequenceStridedBatched(hipblasHandle_t       handle,
+                                                             hipblasSideMode_t     side,
+                                                             hipblasRotPivot_t     pivot,
+                                                             hipblasRotDirection_t direct,
+                                                             const int             m,
+                                                             const int             n,
+                                                             const double*         c,
+                                                             const hipblasStride   stridec,
+                                                             const double*         s,
+                                                             const hipblasStride   strides,
+                                                             double*               A,
+                                                             const int             lda,
+                                                             const hipblasStride   strideA,
+                                                             const int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, side, m, n, stridec, strides, lda, strideA, batchCount);
+
+    return hipblas_rot_sequence<double, double>(
+        handle, side, pivot, direct, m, n, c, stridec, s, strides, A, lda, strideA, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCrotSequenceStridedBatched(hipblasHandle_t       handle,
+                                                             hipblasSideMode_t     side,
+                                                             hipblasRotPivot_t     pivot,
+                                                             hipblasRotDirection_t direct,
+                                                             const int             m,
+                                                             const int             n,
+                                                             const float*          c,
+                                                             const hipblasStride   stridec,
+                                                             const hipblasComplex* s,
+                                                             const hipblasStride   strides,
+                                                             hipblasComplex*       A,
+                                                             const int             lda,
+                                                             const hipblasStride   strideA,
+                                                             const int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, side, m, n, stridec, strides, lda, strideA, batchCount);
+
+    return hipblas_rot_sequence<hipFloatComplex, float>(
+        handle, side, pivot, direct, m, n, c, stridec, s, strides, A, lda, strideA, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZrotSequenceStridedBatched(hipblasHandle_t             handle,
+                                                             hipblasSideMode_t           side,
+                                                             hipblasRotPivot_t           pivot,
+                                                             hipblasRotDirection_t       direct,
+                                                             const int                   m,
+                                                             const int                   n,
+                                                             const double*               c,
+                                                             const hipblasStride         stridec,
+                                                             const hipblasDoubleComplex* s,
+                                                             const hipblasStride         strides,
+                                                             hipblasDoubleComplex*       A,
+                                                             const int                   lda,
+                                                             const hipblasStride         strideA,
+                                                             const int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, side, m, n, stridec, strides, lda, strideA, batchCount);
+
+    return hipblas_rot_sequence<hipDoubleComplex, double>(
+        handle, side, pivot, direct, m, n, c, stridec, s, strides, A, lda, strideA, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCrotSequenceStridedBatched_v2(hipblasHandle_t       handle,
+                                                                hipblasSideMode_t     side,
+                                                                hipblasRotPivot_t     pivot,
+                                                                hipblasRotDirection_t direct,
+                                                                const int             m,
+                                                                const int             n,
+                                                                const float*          c,
+                                                                const hipblasStride   stridec,
+                                                                const hipComplex*     s,
+                                                                const hipblasStride   strides,
+                                                                hipComplex*           A,
+                                                                const int             lda,
+                                                                const hipblasStride   strideA,
+                                                                const int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, side, m, n, stridec, strides, lda, strideA, batchCount);
+
+    return hipblas_rot_sequence<hipFloatComplex, float>(
+        handle, side, pivot, direct, m, n, c, stridec, s, strides, A, lda, strideA, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZrotSequenceStridedBatched_v2(hipblasHandle_t         handle,
+                                                                hipblasSideMode_t       side,
+                                                                hipblasRotPivot_t       pivot,
+                                                                hipblasRotDirection_t   direct,
+                                                                const int               m,
+                                                                const int               n,
+                                                                const double*           c,
+                                                                const hipblasStride     stridec,
+                                                                const hipDoubleComplex* s,
+                                                                const hipblasStride     strides,
+                                                                hipDoubleComplex*       A,
+                                                                const int               lda,
+                                                                const hipblasStride     strideA,
+                                                                const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, side, m, n, stridec, strides, lda, strideA, batchCount);
+
+    return hipblas_rot_sequence<hipDoubleComplex, double>(
+        handle, side, pivot, direct, m, n, c, stridec, s, strides, A, lda, strideA, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
@@ -0,0 +1,393 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_rounding.hpp"
+
+// The functions of hipblas_rounding.hpp, built on the public gemmEx, axpyEx, scalEx and
+// convertEx so they are the same for both backends. The output is widened to float in the
+// memory of hipblasGetRoundingScratch when it is read, computed there by the backend in float, and
+// rounded once to its type in the rounding mode of the handle. The widening is exact, so the
+// only rounding to the type of the output is that of the mode.
+
+namespace
+{
+    // The most scratch memory for the outputs of a batch of gemms, which are computed for as
+    // many problems at a time as fit in it
+    constexpr size_t hipblas_rounding_scratch_max = size_t(64) << 20;
+
+    // The size of the elements of the output types rounded in the mode of the handle, 0 for the
+    // others
+    size_t hipblas_rounding_size(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_16F:
+        case HIP_R_16BF:
+            return 2;
+        case HIP_R_8F_E4M3_FNUZ:
+        case HIP_R_8F_E5M2_FNUZ:
+#ifdef HIP_R_8F_E4M3
+        case HIP_R_8F_E4M3:
+        case HIP_R_8F_E5M2:
+#endif
+            return 1;
+        default:
+            return 0;
+        }
+    }
+
+    // The size of the elements of the types computed in float, the output types and float
+    size_t hipblas_rounding_input_size(hipDataType type)
+    {
+        return type == HIP_R_32F ? sizeof(float) : hipblas_rounding_size(type);
+    }
+
+    // The fp8 outputs of the backends saturate, and the others overflow to infinity
+    hipblasSaturationMode_t hipblas_rounding_saturation(hipDataType type)
+    {
+        return hipblas_rounding_size(type) == 1 ? HIPBLAS_SATURATION_FINITE
+                                                : HIPBLAS_SATURATION_NONE;
+    }
+
+    // Converts the count matrices of m-by-n elements of src, at ld and stride, to those of dst,
+    // as a single batch of columns when the columns of both are evenly spaced across matrices
+    hipblasStatus_t hipblas_rounding_convert(hipblasHandle_t       handle,
+                                             int                   m,
+                                             int                   n,
+                                             const void*           src,
+                                             hipDataType           srcType,
+                                             int                   lds,
+                                             hipblasStride         strides,
+                                             void*                 dst,
+                                             hipDataType           dstType,
+                                             int                   ldd,
+                                             hipblasStride         strided,
+                                             int                   count,
+                                             hipblasRoundingMode_t rounding)
+    {
+        hipblasSaturationMode_t saturation = hipblas_rounding_saturation(dstType);
+        if(count == 1 || (strides == hipblasStride(lds) * n && strided == hipblasStride(ldd) * n))
+            return hipblasConvertStridedBatchedEx(handle,
+                                                  m,
+                                                  src,
+                                                  srcType,
+                                                  1,
+                                                  lds,
+                                                  dst,
+                                                  dstType,
+                                                  1,
+                                                  ldd,
+                                                  nullptr,
+                                                  rounding,
+                                                  saturation,
+                                                  n * count);
+
+        size_t src_size = hipblas_rounding_input_size(srcType);
+        size_t dst_size = hipblas_rounding_input_size(dstType);
+        for(int b = 0; b < count; b++)
+        {
+            hipblasStatus_t status = hipblasConvertStridedBatchedEx(
+                handle,
+                m,
+                static_cast<const char*>(src) + b * strides * src_size,
+                srcType,
+                1,
+                lds,
+                static_cast<char*>(dst) + b * strided * dst_size,
+                dstType,
+                1,
+                ldd,
+                nullptr,
+                rounding,
+                saturation,
+                n);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+hipblasStatus_t hipblasRoundedGemmEx(hipblasHandle_t      handle,
+                                     hipblasOperation_t   transA,
+                                     hipblasOperation_t   transB,
+                                     int                  m,
+                                     int                  n,
+                                     int                  k,
+                                     const void*          alpha,
+                                     const void*          A,
+                                     hipDataType          aType,
+                                     int                  lda,
+                                     hipblasStride        strideA,
+                                     const void*          B,
+                                     hipDataType          bType,
+                                     int                  ldb,
+                                     hipblasStride        strideB,
+                                     const void*          beta,
+                                     void*                C,
+                                     hipDataType          cType,
+                                     int                  ldc,
+                                     hipblasStride        strideC,
+                                     int                  batchCount,
+                                     hipblasComputeType_t computeType,
+                                     hipblasGemmAlgo_t    algo)
+{
+    hipblasRoundingMode_t rounding = hipblasGetHandleRoundingMode(handle);
+    size_t                a_size   = hipblas_rounding_input_size(aType);
+    size_t                b_size   = hipblas_rounding_input_size(bType);
+    if(rounding == HIPBLAS_ROUND_NEAREST_EVEN || computeType != HIPBLAS_COMPUTE_32F
+       || !hipblas_rounding_size(cType) || !a_size || !b_size)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(m <= 0 || n <= 0 || k < 0 || batchCount <= 0 || ldc < m || !alpha || !beta || !C
+       || (k && (!A || !B)))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetPointerMode(handle, &mode)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // C is only read when beta isn't 0, which is known on the host in host pointer mode
+    bool   read_c       = mode == HIPBLAS_POINTER_MODE_DEVICE || *static_cast<const float*>(beta);
+    size_t matrix_bytes = size_t(m) * n * sizeof(float);
+    int    chunk        = int(std::max<size_t>(
+        1, std::min<size_t>(batchCount, hipblas_rounding_scratch_max / matrix_bytes)));
+    float* D            = static_cast<float*>(
+        hipblasGetRoundingScratch(handle, hipblas_scratch_pad(matrix_bytes * chunk), stream));
+    if(!D)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    size_t c_size = hipblas_rounding_size(cType);
+    for(int b = 0; b < batchCount; b += chunk)
+    {
+        int   count = std::min(chunk, batchCount - b);
+        char* c     = static_cast<char*>(C) + b * strideC * c_size;
+
+        if(read_c)
+            status = hipblas_rounding_convert(handle,
+                                              m,
+                                              n,
+                                              c,
+                                              cType,
+                                              ldc,
+                                              strideC,
+                                              D,
+                                              HIP_R_32F,
+                                              m,
+                                              hipblasStride(m) * n,
+                                              count,
+                                              HIPBLAS_ROUND_NEAREST_EVEN);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasGemmStridedBatchedEx_v2(
+                handle,
+                transA,
+                transB,
+                m,
+                n,
+                k,
+                alpha,
+                A ? static_cast<const char*>(A) + b * strideA * a_size : nullptr,
+                aType,
+                lda,
+                strideA,
+                B ? static_cast<const char*>(B) + b * strideB * b_size : nullptr,
+                bType,
+                ldb,
+                strideB,
+                beta,
+                D,
+                HIP_R_32F,
+                m,
+                hipblasStride(m) * n,
+                count,
+                computeType,
+                algo);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_rounding_convert(handle,
+                                              m,
+                                              n,
+                                              D,
+                                              HIP_R_32F,
+                                              m,
+                                              hipblasStride(m) * n,
+                                              c,
+                                              cType,
+                                              ldc,
+                                              strideC,
+                                              count,
+                                              rounding);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasRoundedAxpyEx(hipblasHandle_t handle,
+                                     int             n,
+                                     const void*     alpha,
+                                     hipDataType     alphaType,
+                                     const void*     x,
+                                     hipDataType     xType,
+                                     int             incx,
+                                     void*           y,
+                                     hipDataType     yType,
+                                     int             incy,
+                                     hipDataType     executionType)
+{
+    hipblasRoundingMode_t rounding = hipblasGetHandleRoundingMode(handle);
+    if(rounding == HIPBLAS_ROUND_NEAREST_EVEN || alphaType != HIP_R_32F
+       || executionType != HIP_R_32F || !hipblas_rounding_size(yType)
+       || !hipblas_rounding_input_size(xType))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(n <= 0 || !incy || !alpha || !x || !y)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // x and y in float, packed in the order of their elements, x only when it isn't float
+    size_t y_bytes = hipblas_scratch_pad(size_t(n) * sizeof(float));
+    bool   widen_x = xType != HIP_R_32F;
+    size_t x_bytes = widen_x ? size_t(n) * sizeof(float) : 0;
+    char*  scratch
+        = static_cast<char*>(hipblasGetRoundingScratch(handle, y_bytes + x_bytes, stream));
+    if(!scratch)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    float* Y = reinterpret_cast<float*>(scratch);
+    float* X = reinterpret_cast<float*>(scratch + y_bytes);
+
+    status = hipblasConvertEx(handle,
+                              n,
+                              y,
+                              yType,
+                              incy,
+                              Y,
+                              HIP_R_32F,
+                              1,
+                              nullptr,
+                              HIPBLAS_ROUND_NEAREST_EVEN,
+                              HIPBLAS_SATURATION_NONE);
+    if(status == HIPBLAS_STATUS_SUCCESS && widen_x)
+        status = hipblasConvertEx(handle,
+                                  n,
+                                  x,
+                                  xType,
+                                  incx,
+                                  X,
+                                  HIP_R_32F,
+                                  1,
+                                  nullptr,
+                                  HIPBLAS_ROUND_NEAREST_EVEN,
+                                  HIPBLAS_SATURATION_NONE);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasAxpyEx_v2(handle,
+                                  n,
+                                  alpha,
+                                  HIP_R_32F,
+                                  widen_x ? X : x,
+                                  HIP_R_32F,
+                                  widen_x ? 1 : incx,
+                                  Y,
+                                  HIP_R_32F,
+                                  1,
+                                  HIP_R_32F);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasConvertEx(handle,
+                                  n,
+                                  Y,
+                                  HIP_R_32F,
+                                  1,
+                                  y,
+                                  yType,
+                                  incy,
+                                  nullptr,
+                                  rounding,
+                                  hipblas_rounding_saturation(yType));
+    return status;
+}
+
+hipblasStatus_t hipblasRoundedScalEx(hipblasHandle_t handle,
+                                     int             n,
+                                     const void*     alpha,
+                                     hipDataType     alphaType,
+                                     void*           x,
+                                     hipDataType     xType,
+                                     int             incx,
+                                     hipDataType     executionType)
+{
+    hipblasRoundingMode_t rounding = hipblasGetHandleRoundingMode(handle);
+    if(rounding == HIPBLAS_ROUND_NEAREST_EVEN || alphaType != HIP_R_32F
+       || executionType != HIP_R_32F || !hipblas_rounding_size(xType))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(n <= 0 || incx <= 0 || !alpha || !x)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    float* X
+        = static_cast<float*>(hipblasGetRoundingScratch(handle, size_t(n) * sizeof(float), stream));
+    if(!X)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    status = hipblasConvertEx(handle,
+                              n,
+                              x,
+                              xType,
+                              incx,
+                              X,
+                              HIP_R_32F,
+                              1,
+                              nullptr,
+                              HIPBLAS_ROUND_NEAREST_EVEN,
+                              HIPBLAS_SATURATION_NONE);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasScalEx_v2(handle, n, alpha, HIP_R_32F, X, HIP_R_32F, 1, HIP_R_32F);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasConvertEx(handle,
+                                  n,
+                                  X,
+                                  HIP_R_32F,
+                                  1,
+                                  x,
+                                  xType,
+                                  incx,
+                                  nullptr,
+                                  rounding,
+                                  hipblas_rounding_saturation(xType));
+    return status;
+}
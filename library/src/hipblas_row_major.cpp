@@ -0,0 +1,525 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_complex.h>
+#include <hipblas.h>
+#include <type_traits>
+
+#include "exceptions.hpp"
+#include "hipblas_entry.hpp"
+
+// A matrix stored row-major is its transpose stored column-major, so a row-major call is the
+// column-major call of the transposed problem: C = op(A) op(B) becomes C^T = op(B)^T op(A)^T,
+// the left side becomes the right side, the upper triangle becomes the lower one and the
+// operation of syrk and herk is reversed. Each entry point remaps its arguments and calls the
+// column-major function of the public API, with no copy or transpose of the operands.
+
+namespace
+{
+    template <typename T>
+    struct hipblas_rm_fns;
+
+    template <>
+    struct hipblas_rm_fns<float>
+    {
+        static constexpr auto gemm  = hipblasSgemm;
+        static constexpr auto symm  = hipblasSsymm;
+        static constexpr auto trsm  = hipblasStrsm;
+        static constexpr auto trmm  = hipblasStrmm;
+        static constexpr auto syrk  = hipblasSsyrk;
+        static constexpr auto syr2k = hipblasSsyr2k;
+    };
+
+    template <>
+    struct hipblas_rm_fns<double>
+    {
+        static constexpr auto gemm  = hipblasDgemm;
+        static constexpr auto symm  = hipblasDsymm;
+        static constexpr auto trsm  = hipblasDtrsm;
+        static constexpr auto trmm  = hipblasDtrmm;
+        static constexpr auto syrk  = hipblasDsyrk;
+        static constexpr auto syr2k = hipblasDsyr2k;
+    };
+
+    template <>
+    struct hipblas_rm_fns<hipComplex>
+    {
+        static constexpr auto gemm  = hipblasCgemm_v2;
+        static constexpr auto symm  = hipblasCsymm_v2;
+        static constexpr auto trsm  = hipblasCtrsm_v2;
+        static constexpr auto trmm  = hipblasCtrmm_v2;
+        static constexpr auto syrk  = hipblasCsyrk_v2;
+        static constexpr auto syr2k = hipblasCsyr2k_v2;
+        static constexpr auto hemm  = hipblasChemm_v2;
+        static constexpr auto herk  = hipblasCherk_v2;
+        static constexpr auto her2k = hipblasCher2k_v2;
+    };
+
+    template <>
+    struct hipblas_rm_fns<hipDoubleComplex>
+    {
+        static constexpr auto gemm  = hipblasZgemm_v2;
+        static constexpr auto symm  = hipblasZsymm_v2;
+        static constexpr auto trsm  = hipblasZtrsm_v2;
+        static constexpr auto trmm  = hipblasZtrmm_v2;
+        static constexpr auto syrk  = hipblasZsyrk_v2;
+        static constexpr auto syr2k = hipblasZsyr2k_v2;
+        static constexpr auto hemm  = hipblasZhemm_v2;
+        static constexpr auto herk  = hipblasZherk_v2;
+        static constexpr auto her2k = hipblasZher2k_v2;
+    };
+
+    template <typename T>
+    using hipblas_rm_real_t = std::conditional_t<
+        std::is_same_v<T, hipComplex>,
+        float,
+        std::conditional_t<std::is_same_v<T, hipDoubleComplex>, double, T>>;
+
+    // values out of range are passed through, for the column-major function to reject them
+    hipblasSideMode_t hipblas_rm_side(hipblasSideMode_t side)
+    {
+        return side == HIPBLAS_SIDE_LEFT    ? HIPBLAS_SIDE_RIGHT
+               : side == HIPBLAS_SIDE_RIGHT ? HIPBLAS_SIDE_LEFT
+                                            : side;
+    }
+
+    hipblasFillMode_t hipblas_rm_uplo(hipblasFillMode_t uplo)
+    {
+        return uplo == HIPBLAS_FILL_MODE_UPPER   ? HIPBLAS_FILL_MODE_LOWER
+               : uplo == HIPBLAS_FILL_MODE_LOWER ? HIPBLAS_FILL_MODE_UPPER
+                                                 : uplo;
+    }
+
+    // the operation of syrk and syr2k, for which HIPBLAS_OP_C is HIPBLAS_OP_T of a real type
+    template <typename T>
+    hipblasOperation_t hipblas_rm_sym_trans(hipblasOperation_t trans)
+    {
+        if(trans == HIPBLAS_OP_N)
+            return HIPBLAS_OP_T;
+        bool real = std::is_same_v<T, hipblas_rm_real_t<T>>;
+        if(trans == HIPBLAS_OP_T || (real && trans == HIPBLAS_OP_C))
+            return HIPBLAS_OP_N;
+        return trans;
+    }
+
+    hipblasOperation_t hipblas_rm_her_trans(hipblasOperation_t trans)
+    {
+        return trans == HIPBLAS_OP_N   ? HIPBLAS_OP_C
+               : trans == HIPBLAS_OP_C ? HIPBLAS_OP_N
+                                       : trans;
+    }
+
+    // calls f with a value of the type of the operands, the real types excepted for hemm, herk
+    // and her2k
+    template <bool complex_only, typename F>
+    hipblasStatus_t hipblas_rm_dispatch(hipDataType type, F&& f)
+    {
+        switch(type)
+        {
+        case HIP_R_32F:
+        case HIP_R_64F:
+            if constexpr(complex_only)
+                return HIPBLAS_STATUS_NOT_SUPPORTED;
+            else
+                return type == HIP_R_32F ? f(float{}) : f(double{});
+        case HIP_C_32F:
+            return f(hipComplex{});
+        case HIP_C_64F:
+            return f(hipDoubleComplex{});
+        default:
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        }
+    }
+}
+
+extern "C" hipblasStatus_t hipblasRmGemm(hipblasHandle_t    handle,
+                                         hipblasOperation_t transA,
+                                         hipblasOperation_t transB,
+                                         int                m,
+                                         int                n,
+                                         int                k,
+                                         const void*        alpha,
+                                         const void*        A,
+                                         int                lda,
+                                         const void*        B,
+                                         int                ldb,
+                                         const void*        beta,
+                                         void*              C,
+                                         int                ldc,
+                                         hipDataType        type)
+try
+{
+    HIPBLAS_ENTRY(handle, transA, transB, m, n, k, lda, ldb, ldc, type);
+
+    return hipblas_rm_dispatch<false>(type, [&](auto t) {
+        using T = decltype(t);
+        return hipblas_rm_fns<T>::gemm(handle,
+                                       transB,
+                                       transA,
+                                       n,
+                                       m,
+                                       k,
+                                       static_cast<const T*>(alpha),
+                                       static_cast<const T*>(B),
+                                       ldb,
+                                       static_cast<const T*>(A),
+                                       lda,
+                                       static_cast<const T*>(beta),
+                                       static_cast<T*>(C),
+                                       ldc);
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+namespace
+{
+    template <bool hermitian>
+    hipblasStatus_t hipblas_rm_symm(hipblasHandle_t   handle,
+                                    hipblasSideMode_t side,
+                                    hipblasFillMode_t uplo,
+                                    int               m,
+                                    int               n,
+                                    const void*       alpha,
+                                    const void*       A,
+                                    int               lda,
+                                    const void*       B,
+                                    int               ldb,
+                                    const void*       beta,
+                                    void*             C,
+                                    int               ldc,
+                                    hipDataType       type)
+    {
+        return hipblas_rm_dispatch<hermitian>(type, [&](auto t) {
+            using T = decltype(t);
+            auto fn   = [] {
+                if constexpr(hermitian)
+                    return hipblas_rm_fns<T>::hemm;
+                else
+                    return hipblas_rm_fns<T>::symm;
+            }();
+            return fn(handle,
+                      hipblas_rm_side(side),
+                      hipblas_rm_uplo(uplo),
+                      n,
+                      m,
+                      static_cast<const T*>(alpha),
+                      static_cast<const T*>(A),
+                      lda,
+                      static_cast<const T*>(B),
+                      ldb,
+                      static_cast<const T*>(beta),
+                      static_cast<T*>(C),
+                      ldc);
+        });
+    }
+}
+
+extern "C" hipblasStatus_t hipblasRmSymm(hipblasHandle_t   handle,
+                                         hipblasSideMode_t side,
+                                         hipblasFillMode_t uplo,
+                                         int               m,
+                                         int               n,
+                                         const void*       alpha,
+                                         const void*       A,
+                                         int               lda,
+                                         const void*       B,
+                                         int               ldb,
+                                         const void*       beta,
+                                         void*             C,
+                                         int               ldc,
+                                         hipDataType       type)
+try
+{
+    HIPBLAS_ENTRY(handle, side, uplo, m, n, lda, ldb, ldc, type);
+
+    return hipblas_rm_symm<false>(
+        handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, type);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasRmHemm(hipblasHandle_t   handle,
+                                         hipblasSideMode_t side,
+                                         hipblasFillMode_t uplo,
+                                         int               m,
+                                         int               n,
+                                         const void*       alpha,
+                                         const void*       A,
+                                         int               lda,
+                                         const void*       B,
+                                         int               ldb,
+                                         const void*       beta,
+                                         void*             C,
+                                         int               ldc,
+                                         hipDataType       type)
+try
+{
+    HIPBLAS_ENTRY(handle, side, uplo, m, n, lda, ldb, ldc, type);
+
+    return hipblas_rm_symm<true>(
+        handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, type);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasRmTrsm(hipblasHandle_t    handle,
+                                         hipblasSideMode_t  side,
+                                         hipblasFillMode_t  uplo,
+                                         hipblasOperation_t transA,
+                                         hipblasDiagType_t  diag,
+                                         int                m,
+                                         int                n,
+                                         const void*        alpha,
+                                         const void*        A,
+                                         int                lda,
+                                         void*              B,
+                                         int                ldb,
+                                         hipDataType        type)
+try
+{
+    HIPBLAS_ENTRY(handle, side, uplo, transA, diag, m, n, lda, ldb, type);
+
+    return hipblas_rm_dispatch<false>(type, [&](auto t) {
+        using T = decltype(t);
+        return hipblas_rm_fns<T>::trsm(handle,
+                                       hipblas_rm_side(side),
+                                       hipblas_rm_uplo(uplo),
+                                       transA,
+                                       diag,
+                                       n,
+                                       m,
+                                       static_cast<const T*>(alpha),
+                                       static_cast<const T*>(A),
+                                       lda,
+                                       static_cast<T*>(B),
+                                       ldb);
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasRmTrmm(hipblasHandle_t    handle,
+                                         hipblasSideMode_t  side,
+                                         hipblasFillMode_t  uplo,
+                                         hipblasOperation_t transA,
+                                         hipblasDiagType_t  diag,
+                                         int                m,
+                                         int                n,
+                                         const void*        alpha,
+                                         const void*        A,
+                                         int                lda,
+                                         const void*        B,
+                                         int                ldb,
+                                         void*              C,
+                                         int                ldc,
+                                         hipDataType        type)
+try
+{
+    HIPBLAS_ENTRY(handle, side, uplo, transA, diag, m, n, lda, ldb, ldc, type);
+
+    return hipblas_rm_dispatch<false>(type, [&](auto t) {
+        using T = decltype(t);
+        return hipblas_rm_fns<T>::trmm(handle,
+                                       hipblas_rm_side(side),
+                                       hipblas_rm_uplo(uplo),
+                                       transA,
+                                       diag,
+                                       n,
+                                       m,
+                                       static_cast<const T*>(alpha),
+                                       static_cast<const T*>(A),
+                                       lda,
+                                       static_cast<const T*>(B),
+                                       ldb,
+                                       static_cast<T*>(C),
+                                       ldc);
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasRmSyrk(hipblasHandle_t    handle,
+                                         hipblasFillMode_t  uplo,
+                                         hipblasOperation_t transA,
+                                         int                n,
+                                         int                k,
+                                         const void*        alpha,
+                                         const void*        A,
+                                         int                lda,
+                                         const void*        beta,
+                                         void*              C,
+                                         int                ldc,
+                                         hipDataType        type)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, transA, n, k, lda, ldc, type);
+
+    return hipblas_rm_dispatch<false>(type, [&](auto t) {
+        using T = decltype(t);
+        return hipblas_rm_fns<T>::syrk(handle,
+                                       hipblas_rm_uplo(uplo),
+                                       hipblas_rm_sym_trans<T>(transA),
+                                       n,
+                                       k,
+                                       static_cast<const T*>(alpha),
+                                       static_cast<const T*>(A),
+                                       lda,
+                                       static_cast<const T*>(beta),
+                                       static_cast<T*>(C),
+                                       ldc);
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasRmHerk(hipblasHandle_t    handle,
+                                         hipblasFillMode_t  uplo,
+                                         hipblasOperation_t transA,
+                                         int                n,
+                                         int                k,
+                                         const void*        alpha,
+                                         const void*        A,
+                                         int                lda,
+                                         const void*        beta,
+                                         void*              C,
+                                         int                ldc,
+                                         hipDataType        type)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, transA, n, k, lda, ldc, type);
+
+    return hipblas_rm_dispatch<true>(type, [&](auto t) {
+        using T = decltype(t);
+        using R = hipblas_rm_real_t<T>;
+        return hipblas_rm_fns<T>::herk(handle,
+                                       hipblas_rm_uplo(uplo),
+                                       hipblas_rm_her_trans(transA),
+                                       n,
+                                       k,
+                                       static_cast<const R*>(alpha),
+                                       static_cast<const T*>(A),
+                                       lda,
+                                       static_cast<const R*>(beta),
+                                       static_cast<T*>(C),
+                                       ldc);
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasRmSyr2k(hipblasHandle_t    handle,
+                                          hipblasFillMode_t  uplo,
+                                          hipblasOperation_t transA,
+                                          int                n,
+                                          int                k,
+                                          const void*        alpha,
+                                          const void*        A,
+                                          int                lda,
+                                          const void*        B,
+                                          int                ldb,
+                                          const void*        beta,
+                                          void*              C,
+                                          int                ldc,
+                                          hipDataType        type)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, transA, n, k, lda, ldb, ldc, type);
+
+    return hipblas_rm_dispatch<false>(type, [&](auto t) {
+        using T = decltype(t);
+        return hipblas_rm_fns<T>::syr2k(handle,
+                                        hipblas_rm_uplo(uplo),
+                                        hipblas_rm_sym_trans<T>(transA),
+                                        n,
+                                        k,
+                                        static_cast<const T*>(alpha),
+                                        static_cast<const T*>(A),
+                                        lda,
+                                        static_cast<const T*>(B),
+                                        ldb,
+                                        static_cast<const T*>(beta),
+                                        static_cast<T*>(C),
+                                        ldc);
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// alpha A B^H + conj(alpha) B A^H transposed is alpha B'^H A' + conj(alpha) A'^H B' of the
+// column-major A' and B', so A and B change places
+extern "C" hipblasStatus_t hipblasRmHer2k(hipblasHandle_t    handle,
+                                          hipblasFillMode_t  uplo,
+                                          hipblasOperation_t transA,
+                                          int                n,
+                                          int                k,
+                                          const void*        alpha,
+                                          const void*        A,
+                                          int                lda,
+                                          const void*        B,
+                                          int                ldb,
+                                          const void*        beta,
+                                          void*              C,
+                                          int                ldc,
+                                          hipDataType        type)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, transA, n, k, lda, ldb, ldc, type);
+
+    return hipblas_rm_dispatch<true>(type, [&](auto t) {
+        using T = decltype(t);
+        using R = hipblas_rm_real_t<T>;
+        return hipblas_rm_fns<T>::her2k(handle,
+                                        hipblas_rm_uplo(uplo),
+                                        hipblas_rm_her_trans(transA),
+                                        n,
+                                        k,
+                                        static_cast<const T*>(alpha),
+                                        static_cast<const T*>(B),
+                                        ldb,
+                                        static_cast<const T*>(A),
+                                        lda,
+                                        static_cast<const R*>(beta),
+                                        static_cast<T*>(C),
+                                        ldc);
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
@@ -0,0 +1,465 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <type_traits>
+
+#include "exceptions.hpp"
+#include "hipblas_device_reduce.hpp"
+#include "hipblas_entry.hpp"
+
+// hipblasAsumSegmentedEx, hipblasNrm2SegmentedEx, hipblasDotSegmentedEx and
+// hipblasDotcSegmentedEx: the reductions of the segments of one array, of any lengths, given by
+// an array of offsets on the device, as the rows of a CSR matrix are. The work is split by
+// elements rather than by segments, so a few long segments don't leave most of the device idle
+// while short ones are reduced:
+//
+// - hipblasSegmentedTileKernel splits x into tiles of hipblas_segmented_tile elements, and sums
+//   the elements of each tile that belong to segments longer than a tile. A tile holds parts of
+//   at most two such segments, and the part of segment s in tile t is stored at s + t, which is
+//   unique, as the pairs (s, t) of the parts increase in s and t together.
+// - hipblasSegmentedKernel reduces each segment with a small block, from the elements of x for
+//   the segments of up to a tile, and from the sums of its tiles for the longer ones.
+//
+// The sums are added in a fixed order, as in hipblas_device_reduce.hpp, and the same kernels
+// serve both backends.
+
+namespace
+{
+    enum class hipblas_segmented_op
+    {
+        asum,
+        nrm2,
+        dot,
+        dotc
+    };
+
+    // The elements of a tile of hipblasSegmentedTileKernel
+    constexpr int hipblas_segmented_tile = 4 * hipblas_blas1_threads;
+
+    // The threads of a block of hipblasSegmentedKernel
+    constexpr int hipblas_segmented_threads = 64;
+
+    // sum + the term of element i of the reduction OP
+    template <hipblas_segmented_op OP, typename TS, typename T>
+    __device__ inline TS
+        hipblas_segmented_add(TS sum, const T* x, int incx, const T* y, int incy, int i)
+    {
+        auto xi = hipblas_device_load(x[int64_t(i) * incx]);
+        if constexpr(OP == hipblas_segmented_op::asum)
+            return sum + hipblas_device_abs1(xi);
+        else if constexpr(OP == hipblas_segmented_op::nrm2)
+            return sum + hipblas_device_abs2(xi);
+        else
+        {
+            TS xs = xi;
+            if constexpr(OP == hipblas_segmented_op::dotc)
+                xs = hipblas_device_conj(xs);
+            TS yi = hipblas_device_load(y[int64_t(i) * incy]);
+            return hipblas_device_axpby(xs, yi, hipblas_device_one<TS>(), sum);
+        }
+    }
+
+    // The first segment that ends after element p, or num_segments
+    __device__ inline int hipblas_segment_of(const int* offsets, int num_segments, int p)
+    {
+        int lo = 0, hi = num_segments;
+        while(lo < hi)
+        {
+            int mid = lo + (hi - lo) / 2;
+            if(offsets[mid + 1] > p)
+                hi = mid;
+            else
+                lo = mid + 1;
+        }
+        return lo;
+    }
+
+    // partial[s + t] := the sum of the terms of the elements of tile t in segment s, for the
+    // segments s longer than a tile
+    template <hipblas_segmented_op OP, typename T, typename TS>
+    __global__ void hipblasSegmentedTileKernel(int        n,
+                                               const T*   x,
+                                               int        incx,
+                                               const T*   y,
+                                               int        incy,
+                                               const int* offsets,
+                                               int        num_segments,
+                                               TS*        partial)
+    {
+        __shared__ TS sums[hipblas_blas1_threads];
+
+        int tiles = (n - 1) / hipblas_segmented_tile + 1;
+        for(int t = blockIdx.x; t < tiles; t += gridDim.x)
+        {
+            int begin = t * hipblas_segmented_tile;
+            int end   = n - begin < hipblas_segmented_tile ? n : begin + hipblas_segmented_tile;
+            for(int s = hipblas_segment_of(offsets, num_segments, begin);
+                s < num_segments && offsets[s] < end;
+                s++)
+            {
+                int lo = offsets[s], hi = offsets[s + 1];
+                if(hi - lo <= hipblas_segmented_tile)
+                    continue;
+
+                // the part of the segment in the tile
+                int first = lo > begin ? lo : begin;
+                int past  = hi < end ? hi : end;
+
+                TS sum = TS{};
+                for(int i = first + threadIdx.x; i < past; i += blockDim.x)
+                    sum = hipblas_segmented_add<OP>(sum, x, incx, y, incy, i);
+
+                sum = hipblas_device_block_sum(sum, sums);
+                if(!threadIdx.x)
+                    partial[s + t] = sum;
+            }
+        }
+    }
+
+    // result[s] := the reduction OP of segment s
+    template <hipblas_segmented_op OP, typename T, typename TS>
+    __global__ void hipblasSegmentedKernel(const T*   x,
+                                           int        incx,
+                                           const T*   y,
+                                           int        incy,
+                                           const int* offsets,
+                                           int        num_segments,
+                                           const TS*  partial,
+                                           TS*        result)
+    {
+        __shared__ TS sums[hipblas_segmented_threads];
+
+        TS one = hipblas_device_one<TS>();
+        for(int s = blockIdx.x; s < num_segments; s += gridDim.x)
+        {
+            int lo = offsets[s], hi = offsets[s + 1];
+            TS  sum = TS{};
+            if(hi - lo <= hipblas_segmented_tile)
+            {
+                for(int i = lo + threadIdx.x; i < hi; i += blockDim.x)
+                    sum = hipblas_segmented_add<OP>(sum, x, incx, y, incy, i);
+            }
+            else
+            {
+                int last = (hi - 1) / hipblas_segmented_tile;
+                for(int t = lo / hipblas_segmented_tile + threadIdx.x; t <= last; t += blockDim.x)
+                    sum = hipblas_device_axpby(one, partial[s + t], one, sum);
+            }
+
+            sum = hipblas_device_block_sum(sum, sums);
+            if(!threadIdx.x)
+            {
+                if constexpr(OP == hipblas_segmented_op::nrm2)
+                    result[s] = sqrt(sum);
+                else
+                    result[s] = sum;
+            }
+        }
+    }
+
+    // The sums of the tiles of the long segments, one per part of a segment in a tile
+    inline size_t hipblas_segmented_partials(int n, int num_segments)
+    {
+        return size_t(num_segments) + (n - 1) / hipblas_segmented_tile + 1;
+    }
+
+    template <hipblas_segmented_op OP, typename T, typename TS>
+    hipError_t hipblas_segmented_launch(int         n,
+                                        const void* x,
+                                        int         incx,
+                                        const void* y,
+                                        int         incy,
+                                        const int*  offsets,
+                                        int         num_segments,
+                                        void*       scratch,
+                                        void*       result,
+                                        hipStream_t stream)
+    {
+        int tiles = (n - 1) / hipblas_segmented_tile + 1;
+        hipblasSegmentedTileKernel<OP, T, TS>
+            <<<std::min(tiles, 65535), hipblas_blas1_threads, 0, stream>>>(
+                n, (const T*)x, incx, (const T*)y, incy, offsets, num_segments, (TS*)scratch);
+        hipblasSegmentedKernel<OP, T, TS>
+            <<<std::min(num_segments, 65535), hipblas_segmented_threads, 0, stream>>>(
+                (const T*)x,
+                incx,
+                (const T*)y,
+                incy,
+                offsets,
+                num_segments,
+                (const TS*)scratch,
+                (TS*)result);
+        return hipGetLastError();
+    }
+
+    // The kernels of one reduction for one pair of the type of the vectors and executionType,
+    // and the size of the results
+    struct hipblas_segmented_kernels
+    {
+        decltype(&hipblas_segmented_launch<hipblas_segmented_op::asum, float, float>) launch
+            = nullptr;
+        size_t result_size = 0;
+    };
+
+    template <hipblas_segmented_op OP, typename T, typename TS>
+    hipblas_segmented_kernels hipblas_segmented_kernels_of()
+    {
+        return {hipblas_segmented_launch<OP, T, TS>, sizeof(TS)};
+    }
+
+    // Half and bfloat16 vectors are computed in float. The norms of complex vectors are real,
+    // their dot products complex.
+    template <hipblas_segmented_op OP>
+    hipblas_segmented_kernels hipblas_segmented_kernels_for(hipDataType data_type,
+                                                            hipDataType execution_type)
+    {
+        constexpr bool norm = OP == hipblas_segmented_op::asum || OP == hipblas_segmented_op::nrm2;
+        switch(execution_type)
+        {
+        case HIP_R_32F:
+            if(data_type == HIP_R_16F)
+                return hipblas_segmented_kernels_of<OP, __half, float>();
+            if(data_type == HIP_R_16BF)
+                return hipblas_segmented_kernels_of<OP, hipblas_device_bf16, float>();
+            if(data_type == HIP_R_32F)
+                return hipblas_segmented_kernels_of<OP, float, float>();
+            if constexpr(norm)
+                if(data_type == HIP_C_32F)
+                    return hipblas_segmented_kernels_of<OP, hipFloatComplex, float>();
+            break;
+        case HIP_R_64F:
+            if(data_type == HIP_R_64F)
+                return hipblas_segmented_kernels_of<OP, double, double>();
+            if constexpr(norm)
+                if(data_type == HIP_C_64F)
+                    return hipblas_segmented_kernels_of<OP, hipDoubleComplex, double>();
+            break;
+        case HIP_C_32F:
+            if constexpr(!norm)
+                if(data_type == HIP_C_32F)
+                    return hipblas_segmented_kernels_of<OP, hipFloatComplex, hipFloatComplex>();
+            break;
+        case HIP_C_64F:
+            if constexpr(!norm)
+                if(data_type == HIP_C_64F)
+                    return hipblas_segmented_kernels_of<OP, hipDoubleComplex, hipDoubleComplex>();
+            break;
+        default:
+            break;
+        }
+        return {};
+    }
+
+    // The reduction of kernels of the numSegments segments of x, and of y for the dot products,
+    // with the segment s of elements offsets[s], ..., offsets[s + 1] - 1
+    hipblasStatus_t hipblasSegmentedExImpl(hipblasHandle_t           handle,
+                                           int                       n,
+                                           const void*               x,
+                                           int                       incx,
+                                           const void*               y,
+                                           int                       incy,
+                                           bool                      dot,
+                                           const int*                offsets,
+                                           int                       numSegments,
+                                           void*                     result,
+                                           hipblas_segmented_kernels kernels)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(n < 0 || numSegments < 0 || incx <= 0 || (dot && incy <= 0))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!numSegments)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!result || !offsets)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!kernels.launch)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        hipStream_t          stream;
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblas_blas1_stream(handle, &stream, &mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // all the segments are empty when n is zero
+        bool host_result = mode == HIPBLAS_POINTER_MODE_HOST;
+        if(!n)
+            return hipblas_blas1_zero(
+                host_result, result, numSegments, kernels.result_size, stream);
+        if(!x || (dot && !y))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        // the sums of the tiles, followed on the host by the results copied back to it
+        size_t partial_bytes
+            = hipblas_scratch_pad(hipblas_segmented_partials(n, numSegments) * kernels.result_size);
+        size_t result_bytes = size_t(numSegments) * kernels.result_size;
+        char*  scratch      = static_cast<char*>(hipblasGetScratch(
+            handle, partial_bytes + (host_result ? result_bytes : 0), stream));
+        if(!scratch)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+
+        void* d_result = host_result ? scratch + partial_bytes : result;
+        if(kernels.launch(n, x, incx, y, incy, offsets, numSegments, scratch, d_result, stream)
+           != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        if(host_result
+           && (hipMemcpyAsync(result, d_result, result_bytes, hipMemcpyDeviceToHost, stream)
+                   != hipSuccess
+               || hipStreamSynchronize(stream) != hipSuccess))
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+extern "C" hipblasStatus_t hipblasAsumSegmentedEx(hipblasHandle_t handle,
+                                                  int             n,
+                                                  const void*     x,
+                                                  int             incx,
+                                                  const int*      offsets,
+                                                  int             numSegments,
+                                                  void*           result,
+                                                  hipDataType     dataType,
+                                                  hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, numSegments, dataType, executionType);
+
+    return hipblasSegmentedExImpl(
+        handle,
+        n,
+        x,
+        incx,
+        nullptr,
+        0,
+        false,
+        offsets,
+        numSegments,
+        result,
+        hipblas_segmented_kernels_for<hipblas_segmented_op::asum>(dataType, executionType));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasNrm2SegmentedEx(hipblasHandle_t handle,
+                                                  int             n,
+                                                  const void*     x,
+                                                  int             incx,
+                                                  const int*      offsets,
+                                                  int             numSegments,
+                                                  void*           result,
+                                                  hipDataType     dataType,
+                                                  hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, numSegments, dataType, executionType);
+
+    return hipblasSegmentedExImpl(
+        handle,
+        n,
+        x,
+        incx,
+        nullptr,
+        0,
+        false,
+        offsets,
+        numSegments,
+        result,
+        hipblas_segmented_kernels_for<hipblas_segmented_op::nrm2>(dataType, executionType));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDotSegmentedEx(hipblasHandle_t handle,
+                                                 int             n,
+                                                 const void*     x,
+                                                 int             incx,
+                                                 const void*     y,
+                                                 int             incy,
+                                                 const int*      offsets,
+                                                 int             numSegments,
+                                                 void*           result,
+                                                 hipDataType     dataType,
+                                                 hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, numSegments, dataType, executionType);
+
+    return hipblasSegmentedExImpl(
+        handle,
+        n,
+        x,
+        incx,
+        y,
+        incy,
+        true,
+        offsets,
+        numSegments,
+        result,
+        hipblas_segmented_kernels_for<hipblas_segmented_op::dot>(dataType, executionType));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDotcSegmentedEx(hipblasHandle_t handle,
+                                                  int             n,
+                                                  const void*     x,
+                                                  int             incx,
+                                                  const void*     y,
+                                                  int             incy,
+                                                  const int*      offsets,
+                                                  int             numSegments,
+                                                  void*           result,
+                                                  hipDataType     dataType,
+                                                  hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, numSegments, dataType, executionType);
+
+    return hipblasSegmentedExImpl(
+        handle,
+        n,
+        x,
+        incx,
+        y,
+        incy,
+        true,
+        offsets,
+        numSegments,
+        result,
+        hipblas_segmented_kernels_for<hipblas_segmented_op::dotc>(dataType, executionType));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
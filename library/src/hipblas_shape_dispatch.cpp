@@ -0,0 +1,179 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hipblas.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+
+#include "hipblas_handle_state.hpp"
+#include "hipblas_shape_dispatch.hpp"
+
+namespace
+{
+    // Whether the type and compute type are those the rewrites take: float, double,
+    // hipFloatComplex or hipDoubleComplex with the compute type of their precision
+    bool hipblas_shape_dispatch_type(hipDataType type, hipblasComputeType_t computeType)
+    {
+        if(type == HIP_R_32F || type == HIP_C_32F)
+            return computeType == HIPBLAS_COMPUTE_32F;
+        if(type == HIP_R_64F || type == HIP_C_64F)
+            return computeType == HIPBLAS_COMPUTE_64F;
+        return false;
+    }
+
+    bool hipblas_shape_dispatch_int(int64_t value)
+    {
+        return value >= 0 && value <= INT_MAX;
+    }
+}
+
+hipblasStatus_t hipblasShapeDispatchGemm(hipblasHandle_t      handle,
+                                         hipblasOperation_t   transA,
+                                         hipblasOperation_t   transB,
+                                         int64_t              m,
+                                         int64_t              n,
+                                         int64_t              k,
+                                         const void*          alpha,
+                                         const void*          A,
+                                         hipDataType          aType,
+                                         int64_t              lda,
+                                         const void*          B,
+                                         hipDataType          bType,
+                                         int64_t              ldb,
+                                         const void*          beta,
+                                         void*                C,
+                                         hipDataType          cType,
+                                         int64_t              ldc,
+                                         hipblasComputeType_t computeType)
+{
+    if(!hipblasIsShapeDispatch(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    bool complex = aType == HIP_C_32F || aType == HIP_C_64F;
+    if(n < 1 || n > hipblas_shape_dispatch_max_columns || m < 1 || k < 1 || aType != bType
+       || aType != cType || !hipblas_shape_dispatch_type(aType, computeType)
+       || (complex && transB == HIPBLAS_OP_C) || !alpha || !beta || !A || !B || !C)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // the gemvs take A as it is stored, rows_a by cols_a
+    int64_t rows_a = transA == HIPBLAS_OP_N ? m : k;
+    int64_t cols_a = transA == HIPBLAS_OP_N ? k : m;
+    int64_t rows_b = transB == HIPBLAS_OP_N ? k : n;
+    if(lda < rows_a || ldb < rows_b || ldc < m || !hipblas_shape_dispatch_int(rows_a)
+       || !hipblas_shape_dispatch_int(cols_a) || !hipblas_shape_dispatch_int(lda)
+       || !hipblas_shape_dispatch_int(ldb) || !hipblas_shape_dispatch_int(ldc))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // the column j of op(B) is the column j of B, or its row j
+    bool transposed_b = transB != HIPBLAS_OP_N;
+    return hipblasGemvStridedBatchedEx(handle,
+                                       transA,
+                                       int(rows_a),
+                                       int(cols_a),
+                                       alpha,
+                                       A,
+                                       aType,
+                                       int(lda),
+                                       0,
+                                       B,
+                                       bType,
+                                       transposed_b ? int(ldb) : 1,
+                                       transposed_b ? 1 : ldb,
+                                       beta,
+                                       C,
+                                       cType,
+                                       1,
+                                       ldc,
+                                       int(n),
+                                       computeType);
+}
+
+hipblasStatus_t hipblasShapeDispatchGemvBatch(hipblasHandle_t      handle,
+                                              hipblasOperation_t   trans,
+                                              int64_t              m,
+                                              int64_t              n,
+                                              const void*          alpha,
+                                              const void*          A,
+                                              int64_t              lda,
+                                              hipblasStride        strideA,
+                                              const void*          x,
+                                              int64_t              incx,
+                                              hipblasStride        stridex,
+                                              const void*          beta,
+                                              void*                y,
+                                              int64_t              incy,
+                                              hipblasStride        stridey,
+                                              int64_t              batchCount,
+                                              hipDataType          type,
+                                              hipblasComputeType_t computeType)
+{
+    if(!hipblasIsShapeDispatch(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // op(A) is rows by cols, and the gemm is rows by batchCount with an inner dimension of cols
+    int64_t rows = trans == HIPBLAS_OP_N ? m : n;
+    int64_t cols = trans == HIPBLAS_OP_N ? n : m;
+    if(strideA || batchCount <= hipblas_shape_dispatch_max_columns || m < 1 || n < 1
+       || lda < std::max<int64_t>(m, 1) || !hipblas_shape_dispatch_type(type, computeType)
+       || !alpha || !beta || !A || !x || !y)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // the vectors y are the columns of C, and the vectors x those of B, or its rows
+    if(incy != 1 || stridey < rows)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    hipblasOperation_t trans_x;
+    int64_t            ldx;
+    if(incx == 1 && stridex >= cols)
+    {
+        trans_x = HIPBLAS_OP_N;
+        ldx     = stridex;
+    }
+    else if(stridex == 1 && incx >= batchCount)
+    {
+        trans_x = HIPBLAS_OP_T;
+        ldx     = incx;
+    }
+    else
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return hipblasGemmEx_v2_64(handle,
+                               trans,
+                               trans_x,
+                               rows,
+                               batchCount,
+                               cols,
+                               alpha,
+                               A,
+                               type,
+                               lda,
+                               x,
+                               type,
+                               ldx,
+                               beta,
+                               y,
+                               type,
+                               stridey,
+                               computeType,
+                               HIPBLAS_GEMM_DEFAULT);
+}
@@ -0,0 +1,306 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "exceptions.hpp"
+#include "hipblas_shared_workspace.hpp"
+#include "hipblas_statistics.hpp"
+
+// The workspace of the handles created with hipblasCreateWithSharedWorkspace from one another,
+// or from nullptr on one device. mutex is held by hipblasSharedWorkspaceScope for each call,
+// and by hipBLAS functions called from the call on the same thread. stream is the stream of
+// the last call, whose work any call on another stream waits for.
+struct hipblasSharedWorkspace
+{
+    std::recursive_mutex mutex;
+    int                  device     = 0;
+    void*                data       = nullptr;
+    size_t               size       = 0;
+    uint64_t             generation = 0; // counts the times data was replaced
+    hipStream_t          stream     = nullptr;
+    bool                 used       = false;
+    hipEvent_t           event      = nullptr;
+
+    hipblasSharedWorkspace() = default;
+
+    ~hipblasSharedWorkspace()
+    {
+        if(data)
+            (void)hipFree(data);
+        if(event)
+            (void)hipEventDestroy(event);
+    }
+
+    hipblasSharedWorkspace(const hipblasSharedWorkspace&) = delete;
+    hipblasSharedWorkspace& operator=(const hipblasSharedWorkspace&) = delete;
+};
+
+namespace
+{
+    // The smallest shared workspace, the size cuBLAS recommends for the largest devices, which
+    // also holds what rocBLAS needs for most calls without growing
+    constexpr size_t hipblas_shared_workspace_min_size = size_t(32) << 20;
+
+    // A handle sharing a workspace, with the generation of the workspace set on it
+    struct hipblas_shared_member
+    {
+        std::shared_ptr<hipblasSharedWorkspace> workspace;
+        uint64_t                                generation;
+    };
+
+    std::mutex& shared_workspace_mutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    std::unordered_map<hipblasHandle_t, hipblas_shared_member>& shared_member_map()
+    {
+        static std::unordered_map<hipblasHandle_t, hipblas_shared_member> map;
+        return map;
+    }
+
+    // The workspace of the handles created from nullptr, by device, kept while one of them exists
+    std::unordered_map<int, std::weak_ptr<hipblasSharedWorkspace>>& device_workspace_map()
+    {
+        static std::unordered_map<int, std::weak_ptr<hipblasSharedWorkspace>> map;
+        return map;
+    }
+
+    // number of handles sharing a workspace, see hipblasHasSharedWorkspace
+    std::atomic<int> g_shared_workspace_handles{0};
+
+    // The workspace shared by handle, or nullptr
+    std::shared_ptr<hipblasSharedWorkspace> shared_workspace_of(hipblasHandle_t handle)
+    {
+        std::lock_guard<std::mutex> lock(shared_workspace_mutex());
+
+        auto it = shared_member_map().find(handle);
+        return it == shared_member_map().end() ? nullptr : it->second.workspace;
+    }
+
+    // Sets the workspace on handle if it has an older one. Called with the lock of the workspace
+    // held.
+    hipblasStatus_t shared_workspace_bind(hipblasHandle_t handle, hipblasSharedWorkspace& workspace)
+    {
+        {
+            std::lock_guard<std::mutex> lock(shared_workspace_mutex());
+
+            auto it = shared_member_map().find(handle);
+            if(it == shared_member_map().end() || it->second.generation == workspace.generation)
+                return HIPBLAS_STATUS_SUCCESS;
+            it->second.generation = workspace.generation;
+        }
+        return hipblasSetWorkspace(handle, workspace.data, workspace.size);
+    }
+
+    // Makes handle share workspace, setting it as the workspace of handle
+    hipblasStatus_t shared_workspace_join(hipblasHandle_t                                handle,
+                                          const std::shared_ptr<hipblasSharedWorkspace>& workspace)
+    {
+        std::lock_guard<std::recursive_mutex> workspace_lock(workspace->mutex);
+
+        hipblasStatus_t status = hipblasSetWorkspace(handle, workspace->data, workspace->size);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        std::lock_guard<std::mutex> lock(shared_workspace_mutex());
+        auto inserted = shared_member_map().insert({handle, {workspace, workspace->generation}});
+        if(inserted.second)
+            g_shared_workspace_handles++;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+bool hipblasHasSharedWorkspace(hipblasHandle_t handle)
+{
+    if(g_shared_workspace_handles.load(std::memory_order_relaxed) == 0)
+        return false;
+    return shared_workspace_of(handle) != nullptr;
+}
+
+hipblasStatus_t hipblasGrowSharedWorkspace(hipblasHandle_t handle, size_t size)
+{
+    std::shared_ptr<hipblasSharedWorkspace> workspace = shared_workspace_of(handle);
+    if(!workspace)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::recursive_mutex> lock(workspace->mutex);
+
+    // another handle may have grown it since the call of handle started
+    if(size > workspace->size)
+    {
+        // hipFree waits for the work of every handle on the previous workspace
+        void* data;
+        if(hipMalloc(&data, size) != hipSuccess)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        (void)hipFree(workspace->data);
+        workspace->data = data;
+        workspace->size = size;
+        workspace->generation++;
+    }
+    return shared_workspace_bind(handle, *workspace);
+}
+
+void hipblasLeaveSharedWorkspace(hipblasHandle_t handle)
+{
+    if(g_shared_workspace_handles.load() == 0)
+        return;
+
+    // released without the mutex, as the last handle frees the workspace
+    std::shared_ptr<hipblasSharedWorkspace> workspace;
+    {
+        std::lock_guard<std::mutex> lock(shared_workspace_mutex());
+
+        auto it = shared_member_map().find(handle);
+        if(it == shared_member_map().end())
+            return;
+        workspace = std::move(it->second.workspace);
+        shared_member_map().erase(it);
+        g_shared_workspace_handles--;
+    }
+}
+
+void hipblasSharedWorkspaceScope::enter(hipblasHandle_t handle)
+{
+    if(g_shared_workspace_handles.load(std::memory_order_relaxed) == 0 || !handle)
+        return;
+
+    std::shared_ptr<hipblasSharedWorkspace> workspace = shared_workspace_of(handle);
+    if(!workspace)
+        return;
+    workspace->mutex.lock();
+    m_workspace = std::move(workspace);
+
+    // a workspace grown by another handle replaces the one handle has
+    if(shared_workspace_bind(handle, *m_workspace) != HIPBLAS_STATUS_SUCCESS)
+        return;
+
+    hipStream_t stream;
+    if(hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS)
+        return;
+
+    // the work of a captured call is ordered by the graph launch, which the caller orders after
+    // the other handles, as an event recorded outside the capture can't be waited for in it
+    hipStreamCaptureStatus capture = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(stream, &capture) != hipSuccess
+       || capture != hipStreamCaptureStatusNone)
+        return;
+
+    if(m_workspace->used && m_workspace->stream != stream)
+    {
+        if(!m_workspace->event
+           && hipEventCreateWithFlags(&m_workspace->event, hipEventDisableTiming) != hipSuccess)
+            m_workspace->event = nullptr;
+
+        // without an event the previous stream is waited for on the host
+        if(!m_workspace->event
+           || hipEventRecord(m_workspace->event, m_workspace->stream) != hipSuccess
+           || hipStreamWaitEvent(stream, m_workspace->event, 0) != hipSuccess)
+            (void)hipStreamSynchronize(m_workspace->stream);
+    }
+    m_workspace->stream = stream;
+    m_workspace->used   = true;
+}
+
+hipblasSharedWorkspaceScope::~hipblasSharedWorkspaceScope()
+{
+    if(m_workspace)
+        m_workspace->mutex.unlock();
+}
+
+extern "C" hipblasStatus_t hipblasCreateWithSharedWorkspace(hipblasHandle_t* handle,
+                                                            hipblasHandle_t  parent)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
+
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    std::shared_ptr<hipblasSharedWorkspace> workspace;
+    if(parent)
+        workspace = shared_workspace_of(parent);
+    else
+    {
+        std::lock_guard<std::mutex> lock(shared_workspace_mutex());
+        workspace = device_workspace_map()[device].lock();
+    }
+    if(workspace && workspace->device != device)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    bool created = !workspace;
+    if(created)
+    {
+        // the first workspace of parent is as large as the one it already has
+        size_t size = 0;
+        if(parent)
+            (void)hipblasGetWorkspaceSize(parent, &size);
+
+        workspace         = std::make_shared<hipblasSharedWorkspace>();
+        workspace->device = device;
+        workspace->size   = std::max(size, hipblas_shared_workspace_min_size);
+        if(hipMalloc(&workspace->data, workspace->size) != hipSuccess)
+        {
+            workspace->data = nullptr;
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+        hipblasStatisticsWorkspaceAllocation(workspace->size);
+    }
+
+    hipblasStatus_t status = hipblasCreate(handle);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // parent shares the workspace created for it from now on
+    if(created && parent)
+        status = shared_workspace_join(parent, workspace);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = shared_workspace_join(*handle, workspace);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasDestroy(*handle);
+        *handle = nullptr;
+        return status;
+    }
+
+    if(!parent)
+    {
+        std::lock_guard<std::mutex> lock(shared_workspace_mutex());
+        device_workspace_map()[device] = workspace;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
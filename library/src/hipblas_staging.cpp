@@ -0,0 +1,1304 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "exceptions.hpp"
+#include "hipblas_staging.hpp"
+#include <hip/hip_runtime.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#ifdef HIPBLAS_GDS
+#ifdef __HIP_PLATFORM_NVIDIA__
+#include <cufile.h>
+#else
+#include <hipfile.h>
+#endif
+#endif
+
+namespace
+{
+    // Copies from pageable memory of at least two buffers are staged, so that packing a buffer
+    // overlaps the copy of another
+    constexpr size_t hipblas_staging_buffer_size  = size_t(2) << 20;
+    constexpr int    hipblas_staging_buffer_count = 4;
+
+    // The NUMA node of the host the PCIe slot of device is attached to, as Linux reports it, or
+    // -1 when it isn't known or the host has a single node
+    int hipblas_device_numa_node(int device)
+    {
+#ifdef _WIN32
+        return -1;
+#else
+        char bus_id[32];
+        if(hipDeviceGetPCIBusId(bus_id, sizeof(bus_id), device) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            return -1;
+        }
+        std::string path = "/sys/bus/pci/devices/" + std::string(bus_id) + "/numa_node";
+        std::transform(path.begin(), path.end(), path.begin(), [](unsigned char c) {
+            return char(std::tolower(c));
+        });
+
+        std::ifstream file(path);
+        int           node = -1;
+        if(!(file >> node))
+            return -1;
+        return node;
+#endif
+    }
+
+    // Pinned portable memory of size bytes. With node >= 0, the pages are placed on that NUMA
+    // node before they are pinned, so that the copies of a device on a dual socket host don't
+    // cross the link between the sockets; node is set to -1 if the pages can't be placed.
+    void* hipblas_staging_alloc(size_t size, int& node)
+    {
+#ifndef _WIN32
+        constexpr int      MPOL_PREFERRED = 1;
+        constexpr unsigned bits           = 8 * sizeof(unsigned long);
+        if(node >= 0)
+        {
+            void* p
+                = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if(p != MAP_FAILED)
+            {
+                // the pages are placed as they are first touched, so the preference is set
+                // before the memset, and the kernel reads one bit less than maxnode
+                std::vector<unsigned long> mask(node / bits + 1, 0);
+                mask[node / bits] = 1ul << (node % bits);
+                bool placed = syscall(SYS_mbind,
+                                      p,
+                                      size,
+                                      MPOL_PREFERRED,
+                                      mask.data(),
+                                      mask.size() * bits + 1,
+                                      0)
+                              == 0;
+                memset(p, 0, size);
+                if(placed && hipHostRegister(p, size, hipHostRegisterPortable) == hipSuccess)
+                    return p;
+                (void)hipGetLastError();
+                munmap(p, size);
+            }
+            node = -1;
+        }
+#else
+        node = -1;
+#endif
+        void* p;
+        return hipHostMalloc(&p, size, hipHostMallocPortable) == hipSuccess ? p : nullptr;
+    }
+
+    // The pinned buffers of a device, each with the event recorded after its last copy. The
+    // buffers are allocated on first use and kept until the process exits, and are portable so
+    // that peer copies can read other devices into them. They are on the NUMA node closest to
+    // the device, or node is -1.
+    struct hipblas_staging_ring
+    {
+        std::mutex mutex;
+        void*      buffers[hipblas_staging_buffer_count] = {};
+        hipEvent_t events[hipblas_staging_buffer_count]  = {};
+        int        next                                  = 0;
+        int        node                                  = -1;
+
+        bool allocate()
+        {
+            for(int i = 0; i < hipblas_staging_buffer_count; i++)
+            {
+                if(!buffers[i]
+                   && !(buffers[i] = hipblas_staging_alloc(hipblas_staging_buffer_size, node)))
+                    return false;
+                if(!events[i]
+                   && hipEventCreateWithFlags(&events[i], hipEventDisableTiming) != hipSuccess)
+                    return false;
+            }
+            return true;
+        }
+    };
+
+    hipblas_staging_ring& hipblas_staging_ring_of(int device)
+    {
+        static std::mutex                                             mutex;
+        static std::map<int, std::unique_ptr<hipblas_staging_ring>>* rings
+            = new std::map<int, std::unique_ptr<hipblas_staging_ring>>;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto&                       ring = (*rings)[device];
+        if(!ring)
+        {
+            ring       = std::make_unique<hipblas_staging_ring>();
+            ring->node = hipblas_device_numa_node(device);
+        }
+        return *ring;
+    }
+
+    bool hipblas_is_pageable(const void* p)
+    {
+        hipPointerAttribute_t attr;
+        if(hipPointerGetAttributes(&attr, p) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            return true;
+        }
+        return attr.type == hipMemoryTypeUnregistered;
+    }
+
+    // Converts n elements from the host type to the device type of a copy to the device, or
+    // from the device type to the host type of a copy from it
+    using hipblas_convert_fn = void (*)(const void* src, void* dst, size_t n);
+
+    // Part of a copy that fits one staging buffer: rows [row, row + rows) of columns
+    // [col, col + cols)
+    struct hipblas_staging_piece
+    {
+        size_t row, rows, col, cols;
+    };
+
+    // Splits rows x cols elements into pieces of at most buffer_elements: whole columns where
+    // they fit a buffer, otherwise parts of a column
+    std::vector<hipblas_staging_piece>
+        hipblas_staging_pieces(size_t rows, size_t cols, size_t buffer_elements)
+    {
+        std::vector<hipblas_staging_piece> pieces;
+        if(rows <= buffer_elements)
+        {
+            size_t chunk_cols = buffer_elements / rows;
+            for(size_t c = 0; c < cols; c += chunk_cols)
+                pieces.push_back({0, rows, c, std::min(chunk_cols, cols - c)});
+        }
+        else
+        {
+            for(size_t c = 0; c < cols; c++)
+                for(size_t r = 0; r < rows; r += buffer_elements)
+                    pieces.push_back({r, std::min(buffer_elements, rows - r), c, 1});
+        }
+        return pieces;
+    }
+
+    // Copies rows x cols elements between host, of host_size bytes each with leading dimension
+    // ldh, and device, of device_size bytes each with leading dimension ldd, through the staging
+    // ring of the current device. The buffers hold device elements, so the copies move only
+    // device bytes, with convert, or a plain copy if it is null, run on the host as each buffer
+    // is packed or unpacked.
+    hipblasStatus_t hipblas_staged_copy(bool               to_device,
+                                        size_t             rows,
+                                        size_t             cols,
+                                        const void*        host_ptr,
+                                        size_t             ldh,
+                                        size_t             host_size,
+                                        const void*        device_ptr,
+                                        size_t             ldd,
+                                        size_t             device_size,
+                                        hipblas_convert_fn convert,
+                                        hipStream_t        stream,
+                                        bool               async)
+    {
+        // contiguous matrices are copied as one column
+        if(ldh == rows && ldd == rows)
+        {
+            rows *= cols;
+            cols = 1;
+            ldh = ldd = rows;
+        }
+
+        const auto pieces
+            = hipblas_staging_pieces(rows, cols, hipblas_staging_buffer_size / device_size);
+
+        int device_id;
+        if(hipGetDevice(&device_id) != hipSuccess)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        hipblas_staging_ring&       ring = hipblas_staging_ring_of(device_id);
+        std::lock_guard<std::mutex> lock(ring.mutex);
+        if(!ring.allocate())
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+
+        char* host   = static_cast<char*>(const_cast<void*>(host_ptr));
+        char* device = static_cast<char*>(const_cast<void*>(device_ptr));
+
+        // packs or unpacks a piece between the host matrix and a staging buffer
+        auto pack = [&](const hipblas_staging_piece& p, char* buffer, bool into_buffer) {
+            for(size_t j = 0; j < p.cols; j++)
+            {
+                char* h = host + ((p.col + j) * ldh + p.row) * host_size;
+                char* b = buffer + j * p.rows * device_size;
+                char* s = into_buffer ? h : b;
+                char* t = into_buffer ? b : h;
+                if(convert)
+                    convert(s, t, p.rows);
+                else
+                    memcpy(t, s, p.rows * device_size);
+            }
+        };
+        auto device_at = [&](const hipblas_staging_piece& p) {
+            return device + (p.col * ldd + p.row) * device_size;
+        };
+
+        if(to_device)
+        {
+            for(const auto& p : pieces)
+            {
+                int   i      = ring.next;
+                char* buffer = static_cast<char*>(ring.buffers[i]);
+                ring.next    = (i + 1) % hipblas_staging_buffer_count;
+
+                // the buffer is free once its last copy is done
+                if(hipEventSynchronize(ring.events[i]) != hipSuccess)
+                    return HIPBLAS_STATUS_MAPPING_ERROR;
+                pack(p, buffer, true);
+                if(hipMemcpy2DAsync(device_at(p),
+                                    ldd * device_size,
+                                    buffer,
+                                    p.rows * device_size,
+                                    p.rows * device_size,
+                                    p.cols,
+                                    hipMemcpyHostToDevice,
+                                    stream)
+                       != hipSuccess
+                   || hipEventRecord(ring.events[i], stream) != hipSuccess)
+                    return HIPBLAS_STATUS_MAPPING_ERROR;
+            }
+            if(!async && hipStreamSynchronize(stream) != hipSuccess)
+                return HIPBLAS_STATUS_MAPPING_ERROR;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        // up to every buffer is being copied while the oldest copy is unpacked
+        std::deque<std::pair<const hipblas_staging_piece*, int>> pending;
+        auto unpack_oldest = [&]() {
+            auto [p, i] = pending.front();
+            pending.pop_front();
+            if(hipEventSynchronize(ring.events[i]) != hipSuccess)
+                return false;
+            pack(*p, static_cast<char*>(ring.buffers[i]), false);
+            return true;
+        };
+
+        for(const auto& p : pieces)
+        {
+            if(pending.size() == hipblas_staging_buffer_count && !unpack_oldest())
+                return HIPBLAS_STATUS_MAPPING_ERROR;
+
+            int i     = ring.next;
+            ring.next = (i + 1) % hipblas_staging_buffer_count;
+            if(hipEventSynchronize(ring.events[i]) != hipSuccess
+               || hipMemcpy2DAsync(ring.buffers[i],
+                                   p.rows * device_size,
+                                   device_at(p),
+                                   ldd * device_size,
+                                   p.rows * device_size,
+                                   p.cols,
+                                   hipMemcpyDeviceToHost,
+                                   stream)
+                      != hipSuccess
+               || hipEventRecord(ring.events[i], stream) != hipSuccess)
+                return HIPBLAS_STATUS_MAPPING_ERROR;
+            pending.emplace_back(&p, i);
+        }
+        while(!pending.empty())
+            if(!unpack_oldest())
+                return HIPBLAS_STATUS_MAPPING_ERROR;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Element types of hipblasSetMatrixEx and hipblasGetMatrixEx, loaded and stored as float
+    // or double. Half and bfloat16 are rounded to nearest even, with overflow to infinity.
+    struct hipblas_half_bits
+    {
+        uint16_t bits;
+
+        explicit operator float() const
+        {
+            uint32_t sign = uint32_t(bits & 0x8000) << 16, exp = (bits >> 10) & 0x1f,
+                     mant = bits & 0x3ff, f;
+            if(exp == 0x1f)
+                f = sign | 0x7f800000 | (mant << 13);
+            else if(exp)
+                f = sign | ((exp + 112) << 23) | (mant << 13);
+            else if(!mant)
+                f = sign;
+            else
+            {
+                // subnormal half, normalized for float
+                exp = 113;
+                while(!(mant & 0x400))
+                {
+                    mant <<= 1;
+                    exp--;
+                }
+                f = sign | (exp << 23) | ((mant & 0x3ff) << 13);
+            }
+            float x;
+            memcpy(&x, &f, sizeof(x));
+            return x;
+        }
+
+        hipblas_half_bits() = default;
+        explicit hipblas_half_bits(float x)
+        {
+            uint32_t f;
+            memcpy(&f, &x, sizeof(f));
+            uint32_t sign = (f >> 16) & 0x8000, abs = f & 0x7fffffff;
+            if(abs >= 0x7f800000) // inf or nan
+                bits = sign | 0x7c00 | (abs > 0x7f800000 ? 0x200 : 0);
+            else if(abs >= 0x477ff000) // rounds past the largest half
+                bits = sign | 0x7c00;
+            else if(abs >= 0x38800000) // normal half
+            {
+                uint32_t r = abs - 0x38000000;
+                bits = sign | ((r + 0xfff + ((r >> 13) & 1)) >> 13);
+            }
+            else // subnormal half or zero
+            {
+                float    a = 0;
+                uint32_t u;
+                memcpy(&a, &abs, sizeof(a));
+                a += 0.5f; // aligns the half subnormal bits to the bottom of the mantissa
+                memcpy(&u, &a, sizeof(u));
+                bits = sign | (u - 0x3f000000);
+            }
+        }
+    };
+
+    struct hipblas_bfloat16_bits
+    {
+        uint16_t bits;
+
+        explicit operator float() const
+        {
+            uint32_t f = uint32_t(bits) << 16;
+            float    x;
+            memcpy(&x, &f, sizeof(x));
+            return x;
+        }
+
+        hipblas_bfloat16_bits() = default;
+        explicit hipblas_bfloat16_bits(float x)
+        {
+            uint32_t f;
+            memcpy(&f, &x, sizeof(f));
+            if((f & 0x7fffffff) > 0x7f800000)
+                bits = (f >> 16) | 0x40; // quiet nan
+            else
+                bits = (f + 0x7fff + ((f >> 16) & 1)) >> 16;
+        }
+    };
+
+    // float and double convert to each other directly, and to or from half and bfloat16
+    // through float
+    template <typename D, typename S>
+    D hipblas_convert_element(S x)
+    {
+        if constexpr(std::is_floating_point_v<S> && std::is_floating_point_v<D>)
+            return D(x);
+        else
+            return D(float(x));
+    }
+
+    template <typename S, typename D>
+    void hipblas_convert(const void* src, void* dst, size_t n)
+    {
+        const S* s = static_cast<const S*>(src);
+        D*       d = static_cast<D*>(dst);
+        for(size_t i = 0; i < n; i++)
+            d[i] = hipblas_convert_element<D>(s[i]);
+    }
+
+    template <typename S>
+    hipblas_convert_fn hipblas_convert_from(hipDataType dst)
+    {
+        switch(dst)
+        {
+        case HIP_R_64F:
+            return hipblas_convert<S, double>;
+        case HIP_R_32F:
+            return hipblas_convert<S, float>;
+        case HIP_R_16F:
+            return hipblas_convert<S, hipblas_half_bits>;
+        case HIP_R_16BF:
+            return hipblas_convert<S, hipblas_bfloat16_bits>;
+        default:
+            return nullptr;
+        }
+    }
+
+    hipblas_convert_fn hipblas_convert_between(hipDataType src, hipDataType dst)
+    {
+        switch(src)
+        {
+        case HIP_R_64F:
+            return hipblas_convert_from<double>(dst);
+        case HIP_R_32F:
+            return hipblas_convert_from<float>(dst);
+        case HIP_R_16F:
+            return hipblas_convert_from<hipblas_half_bits>(dst);
+        case HIP_R_16BF:
+            return hipblas_convert_from<hipblas_bfloat16_bits>(dst);
+        default:
+            return nullptr;
+        }
+    }
+
+    size_t hipblas_staging_type_size(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_64F:
+            return 8;
+        case HIP_R_32F:
+            return 4;
+        case HIP_R_16F:
+        case HIP_R_16BF:
+            return 2;
+        default:
+            return 0;
+        }
+    }
+
+    // One copy of cols columns of width bytes between pitched host and device memory
+    hipblasStatus_t hipblas_copy_2d(bool        to_device,
+                                    const void* src,
+                                    size_t      src_pitch,
+                                    void*       dst,
+                                    size_t      dst_pitch,
+                                    size_t      width,
+                                    size_t      cols,
+                                    hipStream_t stream,
+                                    bool        async)
+    {
+        if(hipMemcpy2DAsync(dst,
+                            dst_pitch,
+                            src,
+                            src_pitch,
+                            width,
+                            cols,
+                            to_device ? hipMemcpyHostToDevice : hipMemcpyDeviceToHost,
+                            stream)
+           != hipSuccess)
+            return HIPBLAS_STATUS_MAPPING_ERROR;
+        if(!async && hipStreamSynchronize(stream) != hipSuccess)
+            return HIPBLAS_STATUS_MAPPING_ERROR;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+bool hipblasStagedMatrixCopy(bool             to_device,
+                             int64_t          rows,
+                             int64_t          cols,
+                             int64_t          elemSize,
+                             const void*      src,
+                             int64_t          lds,
+                             void*            dst,
+                             int64_t          ldd,
+                             hipStream_t      stream,
+                             bool             async,
+                             hipblasStatus_t* status)
+{
+    if(rows <= 0 || cols <= 0 || elemSize <= 0 || lds < rows || ldd < rows || !src || !dst)
+        return false;
+    if(size_t(rows) * cols * elemSize < 2 * hipblas_staging_buffer_size)
+        return false;
+
+    const void* host = to_device ? src : dst;
+    if(!hipblas_is_pageable(host) || size_t(elemSize) > hipblas_staging_buffer_size)
+        return false;
+
+    *status = hipblas_staged_copy(to_device,
+                                  rows,
+                                  cols,
+                                  host,
+                                  to_device ? lds : ldd,
+                                  elemSize,
+                                  to_device ? dst : src,
+                                  to_device ? ldd : lds,
+                                  elemSize,
+                                  nullptr,
+                                  stream,
+                                  async);
+    return true;
+}
+bool hipblasStagedVectorCopy(bool             to_device,
+                             int64_t          n,
+                             int64_t          elemSize,
+                             const void*      x,
+                             int64_t          incx,
+                             void*            y,
+                             int64_t          incy,
+                             hipStream_t      stream,
+                             bool             async,
+                             hipblasStatus_t* status)
+{
+    if(incx != 1 || incy != 1)
+        return false;
+    return hipblasStagedMatrixCopy(to_device, n, 1, elemSize, x, n, y, n, stream, async, status);
+}
+
+hipblasStatus_t hipblasCopyMatrix64(bool        to_device,
+                                    int64_t     rows,
+                                    int64_t     cols,
+                                    int64_t     elemSize,
+                                    const void* src,
+                                    int64_t     lds,
+                                    void*       dst,
+                                    int64_t     ldd,
+                                    hipStream_t stream,
+                                    bool        async)
+{
+    if(rows < 0 || cols < 0 || elemSize <= 0 || lds <= 0 || ldd <= 0 || lds < rows
+       || ldd < rows)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!rows || !cols)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!src || !dst)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasStatus_t status;
+    if(hipblasStagedMatrixCopy(
+           to_device, rows, cols, elemSize, src, lds, dst, ldd, stream, async, &status))
+        return status;
+
+    // contiguous matrices go out as a single row of rows * cols elements
+    if(lds == rows && ldd == rows)
+    {
+        rows *= cols;
+        cols = 1;
+    }
+    return hipblas_copy_2d(to_device,
+                           src,
+                           size_t(lds) * elemSize,
+                           dst,
+                           size_t(ldd) * elemSize,
+                           size_t(rows) * elemSize,
+                           cols,
+                           stream,
+                           async);
+}
+
+hipblasStatus_t hipblasCopyVector64(bool        to_device,
+                                    int64_t     n,
+                                    int64_t     elemSize,
+                                    const void* x,
+                                    int64_t     incx,
+                                    void*       y,
+                                    int64_t     incy,
+                                    hipStream_t stream,
+                                    bool        async)
+{
+    if(n < 0 || elemSize <= 0 || incx <= 0 || incy <= 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!n)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!x || !y)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasStatus_t status;
+    if(hipblasStagedVectorCopy(to_device, n, elemSize, x, incx, y, incy, stream, async, &status))
+        return status;
+
+    if(incx == 1 && incy == 1)
+        return hipblas_copy_2d(
+            to_device, x, n * elemSize, y, n * elemSize, n * elemSize, 1, stream, async);
+    return hipblas_copy_2d(to_device,
+                           x,
+                           size_t(incx) * elemSize,
+                           y,
+                           size_t(incy) * elemSize,
+                           elemSize,
+                           n,
+                           stream,
+                           async);
+}
+
+int hipblasStagingNumaNode(int device)
+{
+    hipblas_staging_ring&       ring = hipblas_staging_ring_of(device);
+    std::lock_guard<std::mutex> lock(ring.mutex);
+    return ring.node;
+}
+
+extern "C" hipblasStatus_t hipblasSetVector_64(
+    int64_t n, int64_t elemSize, const void* x, int64_t incx, void* y, int64_t incy)
+try
+{
+    return hipblasCopyVector64(true, n, elemSize, x, incx, y, incy, nullptr, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetVector_64(
+    int64_t n, int64_t elemSize, const void* x, int64_t incx, void* y, int64_t incy)
+try
+{
+    return hipblasCopyVector64(false, n, elemSize, x, incx, y, incy, nullptr, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasSetMatrix_64(
+    int64_t rows, int64_t cols, int64_t elemSize, const void* A, int64_t lda, void* B, int64_t ldb)
+try
+{
+    return hipblasCopyMatrix64(true, rows, cols, elemSize, A, lda, B, ldb, nullptr, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetMatrix_64(
+    int64_t rows, int64_t cols, int64_t elemSize, const void* A, int64_t lda, void* B, int64_t ldb)
+try
+{
+    return hipblasCopyMatrix64(false, rows, cols, elemSize, A, lda, B, ldb, nullptr, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasSetVectorAsync_64(int64_t     n,
+                                                    int64_t     elemSize,
+                                                    const void* x,
+                                                    int64_t     incx,
+                                                    void*       y,
+                                                    int64_t     incy,
+                                                    hipStream_t stream)
+try
+{
+    return hipblasCopyVector64(true, n, elemSize, x, incx, y, incy, stream, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetVectorAsync_64(int64_t     n,
+                                                    int64_t     elemSize,
+                                                    const void* x,
+                                                    int64_t     incx,
+                                                    void*       y,
+                                                    int64_t     incy,
+                                                    hipStream_t stream)
+try
+{
+    return hipblasCopyVector64(false, n, elemSize, x, incx, y, incy, stream, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasSetMatrixAsync_64(int64_t     rows,
+                                                    int64_t     cols,
+                                                    int64_t     elemSize,
+                                                    const void* A,
+                                                    int64_t     lda,
+                                                    void*       B,
+                                                    int64_t     ldb,
+                                                    hipStream_t stream)
+try
+{
+    return hipblasCopyMatrix64(true, rows, cols, elemSize, A, lda, B, ldb, stream, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetMatrixAsync_64(int64_t     rows,
+                                                    int64_t     cols,
+                                                    int64_t     elemSize,
+                                                    const void* A,
+                                                    int64_t     lda,
+                                                    void*       B,
+                                                    int64_t     ldb,
+                                                    hipStream_t stream)
+try
+{
+    return hipblasCopyMatrix64(false, rows, cols, elemSize, A, lda, B, ldb, stream, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasSetMatrixEx(int         rows,
+                                              int         cols,
+                                              hipDataType srcType,
+                                              const void* A,
+                                              int         lda,
+                                              hipDataType dstType,
+                                              void*       B,
+                                              int         ldb,
+                                              hipStream_t stream)
+try
+{
+    size_t src_size = hipblas_staging_type_size(srcType);
+    size_t dst_size = hipblas_staging_type_size(dstType);
+    if(!src_size || !dst_size)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(rows < 0 || cols < 0 || lda <= 0 || ldb <= 0 || lda < rows || ldb < rows)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!rows || !cols)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!A || !B)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    if(srcType == dstType)
+        return hipblasSetMatrixAsync(rows, cols, src_size, A, lda, B, ldb, stream);
+    return hipblas_staged_copy(true,
+                               rows,
+                               cols,
+                               A,
+                               lda,
+                               src_size,
+                               B,
+                               ldb,
+                               dst_size,
+                               hipblas_convert_between(srcType, dstType),
+                               stream,
+                               true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetMatrixEx(int         rows,
+                                              int         cols,
+                                              hipDataType srcType,
+                                              const void* A,
+                                              int         lda,
+                                              hipDataType dstType,
+                                              void*       B,
+                                              int         ldb,
+                                              hipStream_t stream)
+try
+{
+    size_t src_size = hipblas_staging_type_size(srcType);
+    size_t dst_size = hipblas_staging_type_size(dstType);
+    if(!src_size || !dst_size)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(rows < 0 || cols < 0 || lda <= 0 || ldb <= 0 || lda < rows || ldb < rows)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!rows || !cols)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!A || !B)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    if(srcType == dstType)
+        return hipblasGetMatrixAsync(rows, cols, src_size, A, lda, B, ldb, stream);
+    return hipblas_staged_copy(false,
+                               rows,
+                               cols,
+                               B,
+                               ldb,
+                               dst_size,
+                               A,
+                               lda,
+                               src_size,
+                               hipblas_convert_between(srcType, dstType),
+                               stream,
+                               true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCopyMatrixPeerAsync(int         rows,
+                                                      int         cols,
+                                                      int         elemSize,
+                                                      int         srcDevice,
+                                                      const void* A,
+                                                      int         lda,
+                                                      int         dstDevice,
+                                                      void*       B,
+                                                      int         ldb,
+                                                      hipStream_t stream)
+try
+{
+    int device_count;
+    if(hipGetDeviceCount(&device_count) != hipSuccess)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(srcDevice < 0 || srcDevice >= device_count || dstDevice < 0 || dstDevice >= device_count)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(rows < 0 || cols < 0 || elemSize <= 0 || lda <= 0 || ldb <= 0 || lda < rows || ldb < rows)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!rows || !cols)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!A || !B)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // the copy is queued on dstDevice, whose stream it is
+    int current;
+    if(hipGetDevice(&current) != hipSuccess)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(hipSetDevice(dstDevice) != hipSuccess)
+        return HIPBLAS_STATUS_MAPPING_ERROR;
+
+    const size_t width = size_t(rows) * elemSize;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    int             peer   = srcDevice == dstDevice;
+    if(!peer && hipDeviceCanAccessPeer(&peer, dstDevice, srcDevice) != hipSuccess)
+        peer = 0;
+    if(peer && srcDevice != dstDevice)
+    {
+        hipError_t err = hipDeviceEnablePeerAccess(srcDevice, 0);
+        if(err == hipErrorPeerAccessAlreadyEnabled)
+            (void)hipGetLastError();
+        else if(err != hipSuccess)
+            peer = 0;
+    }
+
+    if(peer)
+    {
+        // a direct copy over the link between the devices, or within one
+        if(hipMemcpy2DAsync(B,
+                            size_t(ldb) * elemSize,
+                            A,
+                            size_t(lda) * elemSize,
+                            width,
+                            cols,
+                            hipMemcpyDeviceToDevice,
+                            stream)
+           != hipSuccess)
+            status = HIPBLAS_STATUS_MAPPING_ERROR;
+    }
+    else if(size_t(elemSize) > hipblas_staging_buffer_size)
+        status = HIPBLAS_STATUS_NOT_SUPPORTED;
+    else
+    {
+        // Through the staging ring of dstDevice: each piece is read from srcDevice into a buffer
+        // while the previous one is copied to dstDevice on stream. A is read after the work
+        // already queued on stream, and the function returns once all of it has been read.
+        hipblas_staging_ring& ring = hipblas_staging_ring_of(dstDevice);
+        std::lock_guard<std::mutex> lock(ring.mutex);
+        if(!ring.allocate())
+            status = HIPBLAS_STATUS_ALLOC_FAILED;
+        // the reads are made from srcDevice, since blocking copies on dstDevice would also
+        // wait for the copies queued on stream
+        else if(hipStreamSynchronize(stream) != hipSuccess || hipSetDevice(srcDevice) != hipSuccess)
+            status = HIPBLAS_STATUS_MAPPING_ERROR;
+
+        const char* src = static_cast<const char*>(A);
+        char*       dst = static_cast<char*>(B);
+        const auto  pieces
+            = hipblas_staging_pieces(rows, cols, hipblas_staging_buffer_size / elemSize);
+        for(size_t n = 0; status == HIPBLAS_STATUS_SUCCESS && n < pieces.size(); n++)
+        {
+            const hipblas_staging_piece& p      = pieces[n];
+            int                          i      = ring.next;
+            void*                        buffer = ring.buffers[i];
+            ring.next                           = (i + 1) % hipblas_staging_buffer_count;
+
+            const size_t piece_width = p.rows * elemSize;
+            if(hipEventSynchronize(ring.events[i]) != hipSuccess
+               || hipMemcpy2D(buffer,
+                              piece_width,
+                              src + (p.col * lda + p.row) * elemSize,
+                              size_t(lda) * elemSize,
+                              piece_width,
+                              p.cols,
+                              hipMemcpyDeviceToHost)
+                      != hipSuccess
+               || hipMemcpy2DAsync(dst + (p.col * ldb + p.row) * elemSize,
+                                   size_t(ldb) * elemSize,
+                                   buffer,
+                                   piece_width,
+                                   piece_width,
+                                   p.cols,
+                                   hipMemcpyHostToDevice,
+                                   stream)
+                      != hipSuccess
+               || hipEventRecord(ring.events[i], stream) != hipSuccess)
+                status = HIPBLAS_STATUS_MAPPING_ERROR;
+        }
+    }
+
+    if(hipSetDevice(current) != hipSuccess && status == HIPBLAS_STATUS_SUCCESS)
+        status = HIPBLAS_STATUS_MAPPING_ERROR;
+    return status;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+#ifndef _WIN32
+namespace
+{
+    // Reads or writes bytes at offset of fd, failing on a short read at the end of the file
+    bool hipblas_file_io(bool read, int fd, char* buffer, size_t bytes, int64_t offset)
+    {
+        while(bytes)
+        {
+            ssize_t n = read ? pread(fd, buffer, bytes, offset) : pwrite(fd, buffer, bytes, offset);
+            if(n < 0 && errno == EINTR)
+                continue;
+            if(n <= 0)
+                return false;
+            buffer += n;
+            bytes -= n;
+            offset += n;
+        }
+        return true;
+    }
+
+#ifdef HIPBLAS_GDS
+    // GPUDirect Storage through cuFile on the cuBLAS backend and its hipFile port otherwise,
+    // which move data between the file and device memory without a copy in host memory
+#ifdef __HIP_PLATFORM_NVIDIA__
+    using hipblas_gds_handle = CUfileHandle_t;
+
+    bool hipblas_gds_register(int fd, hipblas_gds_handle* handle)
+    {
+        static const bool driver = cuFileDriverOpen().err == CU_FILE_SUCCESS;
+        CUfileDescr_t     descr  = {};
+        descr.handle.fd          = fd;
+        descr.type               = CU_FILE_HANDLE_TYPE_OPAQUE_FD;
+        return driver && cuFileHandleRegister(handle, &descr).err == CU_FILE_SUCCESS;
+    }
+
+    ssize_t hipblas_gds_io(
+        bool read, hipblas_gds_handle handle, void* device, size_t bytes, int64_t offset)
+    {
+        return read ? cuFileRead(handle, device, bytes, offset, 0)
+                    : cuFileWrite(handle, device, bytes, offset, 0);
+    }
+
+    void hipblas_gds_deregister(hipblas_gds_handle handle)
+    {
+        cuFileHandleDeregister(handle);
+    }
+#else
+    using hipblas_gds_handle = hipFileHandle_t;
+
+    bool hipblas_gds_register(int fd, hipblas_gds_handle* handle)
+    {
+        static const bool driver = hipFileDriverOpen().err == hipFileSuccess;
+        hipFileDescr_t    descr  = {};
+        descr.handle.fd          = fd;
+        descr.type               = hipFileHandleTypeOpaqueFD;
+        return driver && hipFileHandleRegister(handle, &descr).err == hipFileSuccess;
+    }
+
+    ssize_t hipblas_gds_io(
+        bool read, hipblas_gds_handle handle, void* device, size_t bytes, int64_t offset)
+    {
+        return read ? hipFileRead(handle, device, bytes, offset, 0)
+                    : hipFileWrite(handle, device, bytes, offset, 0);
+    }
+
+    void hipblas_gds_deregister(hipblas_gds_handle handle)
+    {
+        hipFileHandleDeregister(handle);
+    }
+#endif
+
+    // Moves the columns of a matrix directly between the file and device memory, in one
+    // transfer when both are contiguous and one per column otherwise. Returns false without
+    // moving anything when the columns are too short for direct transfers to beat the staging
+    // ring, or the file can't be registered. The transfers are synchronous, so they're made
+    // after the work queued on stream.
+    bool hipblas_gds_copy(bool             read,
+                          int              fd,
+                          size_t           rows,
+                          size_t           cols,
+                          size_t           elem_size,
+                          int64_t          offset,
+                          size_t           ldf,
+                          char*            device,
+                          size_t           ldd,
+                          hipStream_t      stream,
+                          hipblasStatus_t* status)
+    {
+        bool contiguous = ldf == rows && ldd == rows;
+        if(!contiguous && rows * elem_size < hipblas_staging_buffer_size / 2)
+            return false;
+
+        hipblas_gds_handle handle;
+        if(!hipblas_gds_register(fd, &handle))
+            return false;
+
+        *status = hipStreamSynchronize(stream) == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                                              : HIPBLAS_STATUS_MAPPING_ERROR;
+        size_t transfers = contiguous ? 1 : cols;
+        size_t bytes     = (contiguous ? rows * cols : rows) * elem_size;
+        for(size_t j = 0; j < transfers && *status == HIPBLAS_STATUS_SUCCESS; j++)
+        {
+            char*   d = device + j * ldd * elem_size;
+            int64_t f = offset + j * ldf * elem_size;
+            if(hipblas_gds_io(read, handle, d, bytes, f) != ssize_t(bytes))
+                *status = HIPBLAS_STATUS_MAPPING_ERROR;
+        }
+        hipblas_gds_deregister(handle);
+        return true;
+    }
+#endif
+
+    // Opens the file of hipblasSetMatrixFromFile or hipblasGetMatrixToFile, closing it when
+    // done
+    class hipblas_matrix_file
+    {
+        int m_fd;
+
+    public:
+        hipblas_matrix_file(const char* path, bool read)
+            : m_fd(open(path, read ? O_RDONLY : O_WRONLY | O_CREAT, 0644))
+        {
+        }
+        ~hipblas_matrix_file()
+        {
+            if(m_fd >= 0)
+                close(m_fd);
+        }
+        int fd() const
+        {
+            return m_fd;
+        }
+    };
+}
+#endif
+
+extern "C" hipblasStatus_t hipblasSetMatrixFromFile(int         rows,
+                                                    int         cols,
+                                                    int         elemSize,
+                                                    const char* path,
+                                                    int64_t     offset,
+                                                    int64_t     ldf,
+                                                    void*       B,
+                                                    int         ldb,
+                                                    hipStream_t stream)
+try
+{
+#ifdef _WIN32
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#else
+    if(rows < 0 || cols < 0 || elemSize <= 0 || offset < 0 || ldf <= 0 || ldb <= 0 || ldf < rows
+       || ldb < rows)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!rows || !cols)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!path || !B)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(size_t(elemSize) > hipblas_staging_buffer_size)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblas_matrix_file file(path, true);
+    if(file.fd() < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    char*           dst    = static_cast<char*>(B);
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+#ifdef HIPBLAS_GDS
+    if(hipblas_gds_copy(
+           true, file.fd(), rows, cols, elemSize, offset, ldf, dst, ldb, stream, &status))
+        return status;
+#endif
+
+    int device_id;
+    if(hipGetDevice(&device_id) != hipSuccess)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    hipblas_staging_ring&       ring = hipblas_staging_ring_of(device_id);
+    std::lock_guard<std::mutex> lock(ring.mutex);
+    if(!ring.allocate())
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    // Whole columns are read with the rows between them, ldf apart in the buffer, when a
+    // column of the file fits a buffer, and columns are read one by one into packed pieces
+    // otherwise. Each buffer is read while the copies of the previous ones run on stream.
+    const size_t elements = hipblas_staging_buffer_size / elemSize;
+    const bool   spans    = size_t(ldf) <= elements;
+    const auto   pieces   = spans ? hipblas_staging_pieces(ldf, cols, elements)
+                                  : hipblas_staging_pieces(rows, cols, elements);
+    for(const auto& p : pieces)
+    {
+        size_t prows = spans ? rows : p.rows, pitch = spans ? ldf : p.rows;
+        int    i      = ring.next;
+        char*  buffer = static_cast<char*>(ring.buffers[i]);
+        ring.next     = (i + 1) % hipblas_staging_buffer_count;
+
+        // the buffer is free once its last copy is done
+        if(hipEventSynchronize(ring.events[i]) != hipSuccess)
+            return HIPBLAS_STATUS_MAPPING_ERROR;
+        bool read = true;
+        if(spans)
+            read = hipblas_file_io(true,
+                                   file.fd(),
+                                   buffer,
+                                   ((p.cols - 1) * ldf + rows) * elemSize,
+                                   offset + p.col * ldf * elemSize);
+        for(size_t j = 0; !spans && read && j < p.cols; j++)
+            read = hipblas_file_io(true,
+                                   file.fd(),
+                                   buffer + j * p.rows * elemSize,
+                                   p.rows * elemSize,
+                                   offset + ((p.col + j) * ldf + p.row) * elemSize);
+        if(!read)
+            return HIPBLAS_STATUS_MAPPING_ERROR;
+
+        if(hipMemcpy2DAsync(dst + (p.col * ldb + p.row) * elemSize,
+                            size_t(ldb) * elemSize,
+                            buffer,
+                            pitch * elemSize,
+                            prows * elemSize,
+                            p.cols,
+                            hipMemcpyHostToDevice,
+                            stream)
+               != hipSuccess
+           || hipEventRecord(ring.events[i], stream) != hipSuccess)
+            return HIPBLAS_STATUS_MAPPING_ERROR;
+    }
+    return status;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetMatrixToFile(int         rows,
+                                                  int         cols,
+                                                  int         elemSize,
+                                                  const void* A,
+                                                  int         lda,
+                                                  const char* path,
+                                                  int64_t     offset,
+                                                  int64_t     ldf,
+                                                  hipStream_t stream)
+try
+{
+#ifdef _WIN32
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#else
+    if(rows < 0 || cols < 0 || elemSize <= 0 || offset < 0 || lda <= 0 || ldf <= 0 || lda < rows
+       || ldf < rows)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!rows || !cols)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!A || !path)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(size_t(elemSize) > hipblas_staging_buffer_size)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblas_matrix_file file(path, false);
+    if(file.fd() < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    char*           src    = static_cast<char*>(const_cast<void*>(A));
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+#ifdef HIPBLAS_GDS
+    if(hipblas_gds_copy(
+           false, file.fd(), rows, cols, elemSize, offset, ldf, src, lda, stream, &status))
+        return status;
+#endif
+
+    int device_id;
+    if(hipGetDevice(&device_id) != hipSuccess)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    hipblas_staging_ring&       ring = hipblas_staging_ring_of(device_id);
+    std::lock_guard<std::mutex> lock(ring.mutex);
+    if(!ring.allocate())
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    // Pieces are copied into packed buffers, and each is written while the copies of the next
+    // ones run, in one write when its columns are contiguous in the file and one per column
+    // otherwise, so the rows of the file between the columns are left as they are
+    const auto pieces = hipblas_staging_pieces(rows, cols, hipblas_staging_buffer_size / elemSize);
+    std::deque<std::pair<const hipblas_staging_piece*, int>> pending;
+    auto write_oldest = [&]() {
+        auto [p, i] = pending.front();
+        pending.pop_front();
+        if(hipEventSynchronize(ring.events[i]) != hipSuccess)
+            return false;
+        char* buffer = static_cast<char*>(ring.buffers[i]);
+        if(p->rows == size_t(ldf))
+            return hipblas_file_io(false,
+                                   file.fd(),
+                                   buffer,
+                                   p->rows * p->cols * elemSize,
+                                   offset + p->col * ldf * elemSize);
+        for(size_t j = 0; j < p->cols; j++)
+            if(!hipblas_file_io(false,
+                                file.fd(),
+                                buffer + j * p->rows * elemSize,
+                                p->rows * elemSize,
+                                offset + ((p->col + j) * ldf + p->row) * elemSize))
+                return false;
+        return true;
+    };
+
+    for(const auto& p : pieces)
+    {
+        if(pending.size() == hipblas_staging_buffer_count && !write_oldest())
+            return HIPBLAS_STATUS_MAPPING_ERROR;
+
+        int i     = ring.next;
+        ring.next = (i + 1) % hipblas_staging_buffer_count;
+        if(hipEventSynchronize(ring.events[i]) != hipSuccess
+           || hipMemcpy2DAsync(ring.buffers[i],
+                               p.rows * elemSize,
+                               src + (p.col * lda + p.row) * elemSize,
+                               size_t(lda) * elemSize,
+                               p.rows * elemSize,
+                               p.cols,
+                               hipMemcpyDeviceToHost,
+                               stream)
+                  != hipSuccess
+           || hipEventRecord(ring.events[i], stream) != hipSuccess)
+            return HIPBLAS_STATUS_MAPPING_ERROR;
+        pending.emplace_back(&p, i);
+    }
+    while(!pending.empty())
+        if(!write_oldest())
+            return HIPBLAS_STATUS_MAPPING_ERROR;
+    return status;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
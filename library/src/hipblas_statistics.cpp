@@ -0,0 +1,248 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas_statistics.hpp"
+#include "exceptions.hpp"
+#include "hipblas_staging.hpp"
+#include "hipblas_thread_stream.hpp"
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+    // The statistics of the counted call in progress on the calling thread
+    thread_local hipblasStatisticsCounters* t_counters = nullptr;
+
+    // Timed calls are collected once this many are pending, so that a handle that is never
+    // queried doesn't accumulate events
+    constexpr size_t pending_calls_collected = 64;
+
+    // Called with the mutex of counters held
+    hipEvent_t take_event(hipblasStatisticsCounters& counters)
+    {
+        if(!counters.free_events.empty())
+        {
+            hipEvent_t event = counters.free_events.back();
+            counters.free_events.pop_back();
+            return event;
+        }
+        hipEvent_t event;
+        return hipEventCreate(&event) == hipSuccess ? event : nullptr;
+    }
+
+    // Adds the GPU time of the pending calls of counters that have completed, or of all of them
+    // after waiting for them if wait is set. Called with the mutex of counters held.
+    void collect_pending(hipblasStatisticsCounters& counters, bool wait)
+    {
+        auto& pending = counters.pending;
+        auto  done    = std::stable_partition(
+            pending.begin(), pending.end(), [&](hipblasStatisticsCounters::pending_call& call) {
+                hipError_t status
+                    = wait ? hipEventSynchronize(call.stop) : hipEventQuery(call.stop);
+                if(status == hipErrorNotReady)
+                    return true;
+
+                float ms = 0;
+                if(status == hipSuccess
+                   && hipEventElapsedTime(&ms, call.start, call.stop) == hipSuccess)
+                {
+                    call.routine->gpu_time_ms += ms;
+                    counters.totals.gpuTimeMs += ms;
+                }
+                counters.free_events.push_back(call.start);
+                counters.free_events.push_back(call.stop);
+                return false;
+            });
+        pending.erase(done, pending.end());
+    }
+}
+
+void hipblasStatisticsScope::begin(hipblasHandle_t         handle,
+                                   hipblasStatisticsMode_t mode,
+                                   const char*             function) noexcept
+try
+{
+    if(t_counters)
+        return;
+
+    hipblasStatisticsCounters&  counters = hipblasGetHandleState(handle)->statistics;
+    std::lock_guard<std::mutex> lock(counters.mutex);
+
+    m_counters = &counters;
+    m_routine  = &counters.routines[function];
+    m_routine->calls++;
+    counters.totals.calls++;
+    t_counters = &counters;
+
+    if(mode != HIPBLAS_STATISTICS_TIMED)
+        return;
+    if(counters.pending.size() >= pending_calls_collected)
+        collect_pending(counters, false);
+
+    // events can't be recorded in a stream that is being captured
+    hipStream_t            stream  = nullptr;
+    hipStreamCaptureStatus capture = hipStreamCaptureStatusNone;
+    if(hipblasGetStream(hipblasThreadStreamHandle(handle), &stream) != HIPBLAS_STATUS_SUCCESS
+       || hipStreamIsCapturing(stream, &capture) != hipSuccess
+       || capture != hipStreamCaptureStatusNone)
+        return;
+
+    m_start = take_event(counters);
+    if(m_start && hipEventRecord(m_start, stream) != hipSuccess)
+    {
+        counters.free_events.push_back(m_start);
+        m_start = nullptr;
+    }
+    m_stream = stream;
+}
+catch(...)
+{
+}
+
+void hipblasStatisticsScope::end() noexcept
+try
+{
+    t_counters = nullptr;
+    if(!m_start)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_counters->mutex);
+
+    hipEvent_t stop = take_event(*m_counters);
+    if(stop && hipEventRecord(stop, m_stream) == hipSuccess)
+    {
+        m_counters->pending.push_back({m_routine, m_start, stop});
+        return;
+    }
+    m_counters->free_events.push_back(m_start);
+    if(stop)
+        m_counters->free_events.push_back(stop);
+}
+catch(...)
+{
+}
+
+void hipblasStatisticsWorkspaceAllocation(size_t bytes) noexcept
+{
+    if(!t_counters)
+        return;
+    std::lock_guard<std::mutex> lock(t_counters->mutex);
+    t_counters->totals.workspaceReallocations++;
+    t_counters->totals.workspaceBytes += bytes;
+}
+
+void hipblasStatisticsHostSync(hipblasHandle_t handle) noexcept
+{
+    hipblasPointerMode_t mode;
+    if(!t_counters || hipblasGetPointerMode(handle, &mode) != HIPBLAS_STATUS_SUCCESS
+       || mode != HIPBLAS_POINTER_MODE_HOST)
+        return;
+    std::lock_guard<std::mutex> lock(t_counters->mutex);
+    t_counters->totals.hostSyncs++;
+}
+
+void hipblasStatisticsFallback() noexcept
+{
+    if(!t_counters)
+        return;
+    std::lock_guard<std::mutex> lock(t_counters->mutex);
+    t_counters->totals.fallbacks++;
+}
+
+extern "C" hipblasStatus_t hipblasGetStatistics(hipblasHandle_t handle, hipblasStatistics* stats)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(stats == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasStatisticsCounters&  counters = hipblasGetHandleState(handle)->statistics;
+    std::lock_guard<std::mutex> lock(counters.mutex);
+    collect_pending(counters, true);
+    *stats = counters.totals;
+
+    int device;
+    stats->stagingNumaNode
+        = hipGetDevice(&device) == hipSuccess ? hipblasStagingNumaNode(device) : -1;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetRoutineStatistics(hipblasHandle_t           handle,
+                                                       int*                      count,
+                                                       hipblasRoutineStatistics* routines)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(count == nullptr || (routines && *count < 0))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasStatisticsCounters&  counters = hipblasGetHandleState(handle)->statistics;
+    std::lock_guard<std::mutex> lock(counters.mutex);
+    collect_pending(counters, true);
+
+    // the routines of a reset handle are kept with no calls, as pending calls point to them
+    std::vector<hipblasRoutineStatistics> counted;
+    for(auto& routine : counters.routines)
+    {
+        if(routine.second.calls)
+            counted.push_back({routine.first, routine.second.calls, routine.second.gpu_time_ms});
+    }
+    std::sort(counted.begin(),
+              counted.end(),
+              [](const hipblasRoutineStatistics& a, const hipblasRoutineStatistics& b) {
+                  return a.calls > b.calls || (a.calls == b.calls && a.gpuTimeMs > b.gpuTimeMs);
+              });
+
+    if(routines)
+        std::copy_n(counted.begin(), std::min(size_t(*count), counted.size()), routines);
+    *count = int(counted.size());
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasResetStatistics(hipblasHandle_t handle)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasStatisticsCounters&  counters = hipblasGetHandleState(handle)->statistics;
+    std::lock_guard<std::mutex> lock(counters.mutex);
+    collect_pending(counters, true);
+    counters.totals = {};
+    for(auto& routine : counters.routines)
+        routine.second = {};
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
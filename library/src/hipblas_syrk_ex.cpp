@@ -0,0 +1,804 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_complex.h>
+#include <hip/hip_fp16.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_entry.hpp"
+
+// hipblasSyrkEx, hipblasHerkEx, hipblasSyr2kEx and hipblasGemmtEx, built on the public strided
+// batched gemmEx so they are the same for both backends and take every type gemmEx takes. C is
+// split into diagonal blocks of order nb. The blocks below (or above) them are updated in place
+// by gemms, one strided batched gemm for each level of a binary split of the block rows, so
+// only about half the flops of a full gemm are spent. The products of the diagonal blocks are
+// computed into the scratch memory of the handle and merged into the uplo triangle of C by a
+// kernel. The matrices of a strided batched gemmt are computed one after the other.
+
+namespace
+{
+    constexpr int hipblas_syrk_ex_nb    = 128;
+    constexpr int hipblas_syrk_ex_block = 256;
+
+    enum hipblasSyrkExKind
+    {
+        HIPBLAS_SYRK_EX,
+        HIPBLAS_HERK_EX,
+        HIPBLAS_SYR2K_EX,
+        HIPBLAS_GEMMT_EX,
+    };
+
+    template <typename T>
+    __device__ inline T hipblas_syrk_ex_real(T x)
+    {
+        return x;
+    }
+
+    __device__ inline hipFloatComplex hipblas_syrk_ex_real(hipFloatComplex x)
+    {
+        return make_hipFloatComplex(hipCrealf(x), 0);
+    }
+
+    __device__ inline hipDoubleComplex hipblas_syrk_ex_real(hipDoubleComplex x)
+    {
+        return make_hipDoubleComplex(hipCreal(x), 0);
+    }
+
+    // C := alpha * W_b + beta * C on the uplo triangle of each diagonal block b of C, with W_b
+    // packed nb-by-nb. C isn't read when beta is zero, and herk drops the imaginary part of the
+    // diagonal.
+    template <typename TC, typename TW, typename TS>
+    __global__ void hipblasSyrkExDiagonalKernel(int       n,
+                                                int       nb,
+                                                bool      lower,
+                                                bool      herk,
+                                                const TW* W,
+                                                const TS* alpha,
+                                                const TS* beta,
+                                                TC*       C,
+                                                int       ldc)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        int j = blockIdx.y;
+        if(i >= nb || (lower ? i < j : i > j))
+            return;
+
+        auto a  = hipblas_device_load(*alpha);
+        auto bt = hipblas_device_load(*beta);
+        for(int b = blockIdx.z; b * nb < n; b += gridDim.z)
+        {
+            int row = b * nb + i;
+            int col = b * nb + j;
+            if(row >= n || col >= n)
+                return;
+
+            TC&  c = C[size_t(col) * ldc + row];
+            auto w = hipblas_device_load(W[(size_t(b) * nb + j) * nb + i]);
+            auto r = hipblas_device_is_zero(bt)
+                         ? hipblas_device_axpby(a, w, bt, decltype(w){})
+                         : hipblas_device_axpby(a, w, bt, hipblas_device_load(c));
+            if(herk && i == j)
+                r = hipblas_syrk_ex_real(r);
+            hipblas_device_store(r, c);
+        }
+    }
+
+    template <typename TC, typename TW, typename TS>
+    hipError_t hipblas_syrk_ex_merge(int         n,
+                                     int         nb,
+                                     bool        lower,
+                                     bool        herk,
+                                     const void* W,
+                                     const void* alpha,
+                                     const void* beta,
+                                     void*       C,
+                                     int         ldc,
+                                     hipStream_t stream)
+    {
+        dim3 grid((nb - 1) / hipblas_syrk_ex_block + 1, nb, std::min((n - 1) / nb + 1, 65535));
+        hipblasSyrkExDiagonalKernel<TC, TW, TS><<<grid, hipblas_syrk_ex_block, 0, stream>>>(
+            n, nb, lower, herk, (const TW*)W, (const TS*)alpha, (const TS*)beta, (TC*)C, ldc);
+        return hipGetLastError();
+    }
+
+    using hipblas_syrk_ex_merge_fn = hipError_t (*)(int,
+                                                    int,
+                                                    bool,
+                                                    bool,
+                                                    const void*,
+                                                    const void*,
+                                                    const void*,
+                                                    void*,
+                                                    int,
+                                                    hipStream_t);
+
+    // The kernel for the type of C and the scalars, which have the type of computeType, with
+    // the sizes of both and the type and size of the products of the diagonal blocks: float for
+    // the 16-bit types of C with float scalars, so they are rounded only once, otherwise the
+    // type of C. Returns nullptr for the types it doesn't support.
+    hipblas_syrk_ex_merge_fn hipblas_syrk_ex_kernel(hipDataType          c_type,
+                                                    hipblasComputeType_t compute_type,
+                                                    size_t*              c_size,
+                                                    hipDataType*         w_type,
+                                                    size_t*              w_size,
+                                                    size_t*              scalar_size)
+    {
+        bool half_scalars
+            = compute_type == HIPBLAS_COMPUTE_16F || compute_type == HIPBLAS_COMPUTE_16F_PEDANTIC;
+        bool double_scalars
+            = compute_type == HIPBLAS_COMPUTE_64F || compute_type == HIPBLAS_COMPUTE_64F_PEDANTIC;
+        bool int_scalars
+            = compute_type == HIPBLAS_COMPUTE_32I || compute_type == HIPBLAS_COMPUTE_32I_PEDANTIC;
+        bool float_scalars = !half_scalars && !double_scalars && !int_scalars;
+
+        *w_type = c_type;
+        switch(c_type)
+        {
+        case HIP_R_16F:
+            *c_size = sizeof(__half);
+            if(half_scalars)
+            {
+                *w_size = *scalar_size = sizeof(__half);
+                return hipblas_syrk_ex_merge<__half, __half, __half>;
+            }
+            *w_type = HIP_R_32F;
+            *w_size = *scalar_size = sizeof(float);
+            return float_scalars ? hipblas_syrk_ex_merge<__half, float, float> : nullptr;
+        case HIP_R_16BF:
+            *c_size = sizeof(hipblas_device_bf16);
+            *w_type = HIP_R_32F;
+            *w_size = *scalar_size = sizeof(float);
+            return float_scalars ? hipblas_syrk_ex_merge<hipblas_device_bf16, float, float>
+                                 : nullptr;
+        case HIP_R_32F:
+            *c_size = *w_size = *scalar_size = sizeof(float);
+            return float_scalars ? hipblas_syrk_ex_merge<float, float, float> : nullptr;
+        case HIP_R_64F:
+            *c_size = *w_size = *scalar_size = sizeof(double);
+            return double_scalars ? hipblas_syrk_ex_merge<double, double, double> : nullptr;
+        case HIP_C_32F:
+            *c_size = *w_size = *scalar_size = sizeof(hipFloatComplex);
+            return float_scalars
+                       ? hipblas_syrk_ex_merge<hipFloatComplex, hipFloatComplex, hipFloatComplex>
+                       : nullptr;
+        case HIP_C_64F:
+            *c_size = *w_size = *scalar_size = sizeof(hipDoubleComplex);
+            return double_scalars ? hipblas_syrk_ex_merge<hipDoubleComplex,
+                                                          hipDoubleComplex,
+                                                          hipDoubleComplex>
+                                  : nullptr;
+        default:
+            return nullptr;
+        }
+    }
+
+    // Size of the elements of A and B, 0 for types gemmEx doesn't take
+    size_t hipblas_syrk_ex_size(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_8I:
+            return 1;
+        case HIP_R_16F:
+        case HIP_R_16BF:
+        case HIP_C_8I:
+            return 2;
+        case HIP_R_32F:
+            return 4;
+        case HIP_R_64F:
+        case HIP_C_32F:
+            return 8;
+        case HIP_C_64F:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+
+    // Computes the rows I = [i, i + m) and columns J = [j, j + n) of C as
+    //   C_IJ := alpha * op(A)_I * op(B)_J^T + beta * C_IJ
+    // with op(A)_I the rows I of op(A), and the conjugate transpose for herk. For gemmt, op(B) is
+    // k by n and the product is op(A)_I * op(B)_J instead, with op(B)_J the columns J of op(B).
+    // batch_count of these are computed at once, I and J both moving down by stride rows each
+    // time.
+    struct hipblasSyrkExGemm
+    {
+        hipblasHandle_t      handle;
+        hipblasOperation_t   trans;
+        hipblasOperation_t   trans_b;
+        bool                 herk;
+        bool                 gemmt;
+        int                  k;
+        const char*          A;
+        hipDataType          a_type;
+        size_t               a_size;
+        int                  lda;
+        const char*          B;
+        hipDataType          b_type;
+        size_t               b_size;
+        int                  ldb;
+        hipDataType          c_type;
+        hipblasComputeType_t compute_type;
+
+        hipblasStatus_t operator()(bool        swap,
+                                   int         i,
+                                   int         j,
+                                   int         m,
+                                   int         n,
+                                   int         batch_count,
+                                   int         stride,
+                                   const void* alpha,
+                                   const void* beta,
+                                   void*       C,
+                                   int         ldc,
+                                   int64_t     ldc_stride) const
+        {
+            // with swap, op(B)_I * op(A)_J^T instead, the second product of syr2k
+            const char* X      = swap ? B : A;
+            const char* Y      = swap ? A : B;
+            hipDataType x_type = swap ? b_type : a_type;
+            hipDataType y_type = swap ? a_type : b_type;
+            size_t      x_size = swap ? b_size : a_size;
+            size_t      y_size = swap ? a_size : b_size;
+            int         ldx    = swap ? ldb : lda;
+            int         ldy    = swap ? lda : ldb;
+
+            bool               notrans = trans == HIPBLAS_OP_N;
+            hipblasOperation_t trans_x = notrans ? HIPBLAS_OP_N : trans;
+            hipblasOperation_t trans_y
+                = notrans ? (herk ? HIPBLAS_OP_C : HIPBLAS_OP_T) : HIPBLAS_OP_N;
+            int64_t x_step = notrans ? 1 : ldx;
+            int64_t y_step = notrans ? 1 : ldy;
+            if(gemmt)
+            {
+                trans_y = trans_b;
+                y_step  = trans_b == HIPBLAS_OP_N ? ldy : 1;
+            }
+
+            return hipblasGemmStridedBatchedEx_v2(handle,
+                                                  trans_x,
+                                                  trans_y,
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  X + i * x_step * x_size,
+                                                  x_type,
+                                                  ldx,
+                                                  stride * x_step,
+                                                  Y + j * y_step * y_size,
+                                                  y_type,
+                                                  ldy,
+                                                  stride * y_step,
+                                                  beta,
+                                                  C,
+                                                  c_type,
+                                                  ldc,
+                                                  stride * ldc_stride,
+                                                  batch_count,
+                                                  compute_type,
+                                                  HIPBLAS_GEMM_DEFAULT);
+        }
+    };
+
+    hipblasStatus_t hipblasSyrkExImpl(hipblasHandle_t      handle,
+                                      hipblasSyrkExKind    kind,
+                                      hipblasFillMode_t    uplo,
+                                      hipblasOperation_t   trans,
+                                      hipblasOperation_t   transB,
+                                      int                  n,
+                                      int                  k,
+                                      const void*          alpha,
+                                      const void*          A,
+                                      hipDataType          aType,
+                                      int                  lda,
+                                      hipblasStride        strideA,
+                                      const void*          B,
+                                      hipDataType          bType,
+                                      int                  ldb,
+                                      hipblasStride        strideB,
+                                      const void*          beta,
+                                      void*                C,
+                                      hipDataType          cType,
+                                      int                  ldc,
+                                      hipblasStride        strideC,
+                                      int                  batchCount,
+                                      hipblasComputeType_t computeType)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+        bool herk       = kind == HIPBLAS_HERK_EX;
+        bool gemmt      = kind == HIPBLAS_GEMMT_EX;
+        bool two_inputs = gemmt || kind == HIPBLAS_SYR2K_EX;
+        auto valid_trans = [](hipblasOperation_t op) {
+            return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+        };
+        if(uplo != HIPBLAS_FILL_MODE_LOWER && uplo != HIPBLAS_FILL_MODE_UPPER)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(gemmt ? !valid_trans(trans) || !valid_trans(transB)
+                 : trans != HIPBLAS_OP_N && trans != (herk ? HIPBLAS_OP_C : HIPBLAS_OP_T))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+        // op(B) is n by k as op(A) is, but k by n for gemmt
+        int rows_a = trans == HIPBLAS_OP_N ? n : k;
+        int rows_b = !gemmt ? rows_a : transB == HIPBLAS_OP_N ? k : n;
+        if(n < 0 || k < 0 || batchCount < 0 || lda < std::max(rows_a, 1) || ldc < std::max(n, 1)
+           || (two_inputs && ldb < std::max(rows_b, 1)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!n || !batchCount)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !beta)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        size_t      c_size, w_size, scalar_size;
+        hipDataType w_type;
+        auto        merge
+            = hipblas_syrk_ex_kernel(cType, computeType, &c_size, &w_type, &w_size, &scalar_size);
+        size_t a_size = hipblas_syrk_ex_size(aType);
+        size_t b_size = two_inputs ? hipblas_syrk_ex_size(bType) : a_size;
+        if(!merge || !a_size || !b_size || (herk && cType != HIP_C_32F && cType != HIP_C_64F))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        hipStream_t          stream;
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS
+           || (status = hipblasGetPointerMode(handle, &mode)) != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // the products of the diagonal blocks, then the scalars on the device: alpha, beta
+        // and one
+        int    nb           = std::min(n, hipblas_syrk_ex_nb);
+        int    blocks       = (n - 1) / nb + 1;
+        size_t w_bytes      = hipblas_scratch_pad(size_t(blocks) * nb * nb * w_size);
+        size_t scalar_bytes = hipblas_scratch_pad(scalar_size);
+        char*  scratch
+            = static_cast<char*>(hipblasGetScratch(handle, w_bytes + 3 * scalar_bytes, stream));
+        if(!scratch)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+
+        char* d_alpha = scratch + w_bytes;
+        char* d_beta  = d_alpha + scalar_bytes;
+        char* d_one   = d_beta + scalar_bytes;
+
+        char one[16] = {}, zero[16] = {};
+        hipblas_scalar_one(computeType, one);
+
+        // alpha and beta of herk are real, but the gemms take them in the complex type of
+        // computeType
+        char        h_alpha[16] = {}, h_beta[16] = {};
+        bool        host_scalars = mode != HIPBLAS_POINTER_MODE_DEVICE;
+        size_t      arg_size     = herk ? scalar_size / 2 : scalar_size;
+        const void* gemm_alpha   = alpha;
+        const void* gemm_beta    = beta;
+        const void* gemm_one     = one;
+        if(host_scalars)
+        {
+            memcpy(h_alpha, alpha, arg_size);
+            memcpy(h_beta, beta, arg_size);
+            gemm_alpha = h_alpha;
+            gemm_beta  = h_beta;
+            if(hipMemcpyAsync(d_alpha, h_alpha, scalar_size, hipMemcpyHostToDevice, stream)
+                   != hipSuccess
+               || hipMemcpyAsync(d_beta, h_beta, scalar_size, hipMemcpyHostToDevice, stream)
+                      != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+        else
+        {
+            if((herk && hipMemsetAsync(d_alpha, 0, 2 * scalar_bytes, stream) != hipSuccess)
+               || hipMemcpyAsync(d_alpha, alpha, arg_size, hipMemcpyDeviceToDevice, stream)
+                      != hipSuccess
+               || hipMemcpyAsync(d_beta, beta, arg_size, hipMemcpyDeviceToDevice, stream)
+                      != hipSuccess
+               || hipMemcpyAsync(d_one, one, scalar_size, hipMemcpyHostToDevice, stream)
+                      != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+            gemm_alpha = d_alpha;
+            gemm_beta  = d_beta;
+            gemm_one   = d_one;
+        }
+
+        hipblasSyrkExGemm gemm{handle,
+                               trans,
+                               transB,
+                               herk,
+                               gemmt,
+                               k,
+                               static_cast<const char*>(A),
+                               aType,
+                               a_size,
+                               lda,
+                               static_cast<const char*>(two_inputs ? B : A),
+                               two_inputs ? bType : aType,
+                               b_size,
+                               two_inputs ? ldb : lda,
+                               cType,
+                               computeType};
+        bool  lower = uplo == HIPBLAS_FILL_MODE_LOWER;
+        char* c     = static_cast<char*>(C);
+
+        // The block of columns [col, col + h) and rows [row, row + rows) below the diagonal,
+        // or its transpose above it, and batch_count - 1 more each 2h rows and columns further
+        auto off_diagonal = [&](int col, int row, int h, int rows, int batch_count) {
+            int i    = lower ? row : col;
+            int j    = lower ? col : row;
+            int m    = lower ? rows : h;
+            int cols = lower ? h : rows;
+
+            void*           Cij         = c + (size_t(j) * ldc + i) * c_size;
+            int64_t         ldc_1       = int64_t(ldc) + 1;
+            hipblasStatus_t gemm_status = gemm(
+                false, i, j, m, cols, batch_count, 2 * h, gemm_alpha, gemm_beta, Cij, ldc, ldc_1);
+            if(gemm_status == HIPBLAS_STATUS_SUCCESS && kind == HIPBLAS_SYR2K_EX)
+                gemm_status = gemm(
+                    true, i, j, m, cols, batch_count, 2 * h, gemm_alpha, gemm_one, Cij, ldc, ldc_1);
+            return gemm_status;
+        };
+
+        // the matrices of a batch one after the other, each with the levels of its own blocks
+        for(int batch = 0; batch < batchCount; batch++)
+        {
+            gemm.A = static_cast<const char*>(A) + batch * strideA * a_size;
+            gemm.B = two_inputs ? static_cast<const char*>(B) + batch * strideB * b_size : gemm.A;
+            c      = static_cast<char*>(C) + batch * strideC * c_size;
+
+            // Every off-diagonal pair of blocks is in exactly one level: at order h, the blocks of
+            // rows [2ph + h, 2ph + 2h) and columns [2ph, 2ph + h)
+            for(int64_t h = nb; h < n; h *= 2)
+            {
+                int pairs = int(n / (2 * h));
+                if(pairs
+                   && (status = off_diagonal(0, int(h), int(h), int(h), pairs))
+                          != HIPBLAS_STATUS_SUCCESS)
+                    return status;
+
+                int64_t i = 2 * h * pairs;
+                if(i + h < n
+                   && (status = off_diagonal(int(i), int(i + h), int(h), int(n - i - h), 1))
+                          != HIPBLAS_STATUS_SUCCESS)
+                    return status;
+            }
+
+            // W_b := op(A)_b * op(B)_b^T of the diagonal blocks, with alpha one and beta zero given
+            // in host pointer mode
+            hipblasSyrkExGemm w_gemm = gemm;
+            w_gemm.c_type            = w_type;
+
+            int full = n / nb;
+            int rest = n - full * nb;
+            if(!host_scalars
+               && (status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST))
+                      != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            for(int swap = 0; swap < (kind == HIPBLAS_SYR2K_EX ? 2 : 1); swap++)
+            {
+                const void* w_beta = swap ? one : zero;
+                if(full)
+                    status = w_gemm(swap, 0, 0, nb, nb, full, nb, one, w_beta, scratch, nb, nb);
+                if(status == HIPBLAS_STATUS_SUCCESS && rest)
+                    status = w_gemm(swap,
+                                    full * nb,
+                                    full * nb,
+                                    rest,
+                                    rest,
+                                    1,
+                                    0,
+                                    one,
+                                    w_beta,
+                                    scratch + size_t(full) * nb * nb * w_size,
+                                    nb,
+                                    0);
+                if(status != HIPBLAS_STATUS_SUCCESS)
+                    break;
+            }
+            if(!host_scalars)
+            {
+                hipblasStatus_t mode_status = hipblasSetPointerMode(handle, mode);
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = mode_status;
+            }
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+
+            if(merge(n, nb, lower, herk, scratch, d_alpha, d_beta, c, ldc, stream) != hipSuccess)
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+extern "C" hipblasStatus_t hipblasSyrkEx(hipblasHandle_t      handle,
+                                         hipblasFillMode_t    uplo,
+                                         hipblasOperation_t   trans,
+                                         int                  n,
+                                         int                  k,
+                                         const void*          alpha,
+                                         const void*          A,
+                                         hipDataType          aType,
+                                         int                  lda,
+                                         const void*          beta,
+                                         void*                C,
+                                         hipDataType          cType,
+                                         int                  ldc,
+                                         hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, trans, n, k, aType, lda, cType, ldc, computeType);
+
+    return hipblasSyrkExImpl(handle,
+                             HIPBLAS_SYRK_EX,
+                             uplo,
+                             trans,
+                             HIPBLAS_OP_N,
+                             n,
+                             k,
+                             alpha,
+                             A,
+                             aType,
+                             lda,
+                             0,
+                             nullptr,
+                             aType,
+                             lda,
+                             0,
+                             beta,
+                             C,
+                             cType,
+                             ldc,
+                             0,
+                             1,
+                             computeType);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasHerkEx(hipblasHandle_t      handle,
+                                         hipblasFillMode_t    uplo,
+                                         hipblasOperation_t   trans,
+                                         int                  n,
+                                         int                  k,
+                                         const void*          alpha,
+                                         const void*          A,
+                                         hipDataType          aType,
+                                         int                  lda,
+                                         const void*          beta,
+                                         void*                C,
+                                         hipDataType          cType,
+                                         int                  ldc,
+                                         hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, trans, n, k, aType, lda, cType, ldc, computeType);
+
+    return hipblasSyrkExImpl(handle,
+                             HIPBLAS_HERK_EX,
+                             uplo,
+                             trans,
+                             HIPBLAS_OP_N,
+                             n,
+                             k,
+                             alpha,
+                             A,
+                             aType,
+                             lda,
+                             0,
+                             nullptr,
+                             aType,
+                             lda,
+                             0,
+                             beta,
+                             C,
+                             cType,
+                             ldc,
+                             0,
+                             1,
+                             computeType);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasSyr2kEx(hipblasHandle_t      handle,
+                                          hipblasFillMode_t    uplo,
+                                          hipblasOperation_t   trans,
+                                          int                  n,
+                                          int                  k,
+                                          const void*          alpha,
+                                          const void*          A,
+                                          hipDataType          aType,
+                                          int                  lda,
+                                          const void*          B,
+                                          hipDataType          bType,
+                                          int                  ldb,
+                                          const void*          beta,
+                                          void*                C,
+                                          hipDataType          cType,
+                                          int                  ldc,
+                                          hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, trans, n, k, aType, lda, bType, ldb, cType, ldc, computeType);
+
+    return hipblasSyrkExImpl(handle,
+                             HIPBLAS_SYR2K_EX,
+                             uplo,
+                             trans,
+                             HIPBLAS_OP_N,
+                             n,
+                             k,
+                             alpha,
+                             A,
+                             aType,
+                             lda,
+                             0,
+                             B,
+                             bType,
+                             ldb,
+                             0,
+                             beta,
+                             C,
+                             cType,
+                             ldc,
+                             0,
+                             1,
+                             computeType);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGemmtEx(hipblasHandle_t      handle,
+                                          hipblasFillMode_t    uplo,
+                                          hipblasOperation_t   transA,
+                                          hipblasOperation_t   transB,
+                                          int                  n,
+                                          int                  k,
+                                          const void*          alpha,
+                                          const void*          A,
+                                          hipDataType          aType,
+                                          int                  lda,
+                                          const void*          B,
+                                          hipDataType          bType,
+                                          int                  ldb,
+                                          const void*          beta,
+                                          void*                C,
+                                          hipDataType          cType,
+                                          int                  ldc,
+                                          hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, uplo, transA, transB, n, k, aType, lda, bType, ldb, cType, ldc, computeType);
+
+    return hipblasSyrkExImpl(handle,
+                             HIPBLAS_GEMMT_EX,
+                             uplo,
+                             transA,
+                             transB,
+                             n,
+                             k,
+                             alpha,
+                             A,
+                             aType,
+                             lda,
+                             0,
+                             B,
+                             bType,
+                             ldb,
+                             0,
+                             beta,
+                             C,
+                             cType,
+                             ldc,
+                             0,
+                             1,
+                             computeType);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGemmtStridedBatchedEx(hipblasHandle_t      handle,
+                                                        hipblasFillMode_t    uplo,
+                                                        hipblasOperation_t   transA,
+                                                        hipblasOperation_t   transB,
+                                                        int                  n,
+                                                        int                  k,
+                                                        const void*          alpha,
+                                                        const void*          A,
+                                                        hipDataType          aType,
+                                                        int                  lda,
+                                                        hipblasStride        strideA,
+                                                        const void*          B,
+                                                        hipDataType          bType,
+                                                        int                  ldb,
+                                                        hipblasStride        strideB,
+                                                        const void*          beta,
+                                                        void*                C,
+                                                        hipDataType          cType,
+                                                        int                  ldc,
+                                                        hipblasStride        strideC,
+                                                        int                  batchCount,
+                                                        hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  uplo,
+                  transA,
+                  transB,
+                  n,
+                  k,
+                  aType,
+                  lda,
+                  strideA,
+                  bType,
+                  ldb,
+                  strideB,
+                  cType,
+                  ldc,
+                  strideC,
+                  batchCount,
+                  computeType);
+
+    return hipblasSyrkExImpl(handle,
+                             HIPBLAS_GEMMT_EX,
+                             uplo,
+                             transA,
+                             transB,
+                             n,
+                             k,
+                             alpha,
+                             A,
+                             aType,
+                             lda,
+                             strideA,
+                             B,
+                             bType,
+                             ldb,
+                             strideB,
+                             beta,
+                             C,
+                             cType,
+                             ldc,
+                             strideC,
+                             batchCount,
+                             computeType);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
@@ -0,0 +1,330 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "exceptions.hpp"
+#include "hipblas_thread_stream.hpp"
+
+namespace
+{
+    // A stream bound to a handle for one thread. thread_handle is set to nullptr, under the
+    // mutex, when the binding is removed, by its thread or by hipblasDestroy of the handle.
+    struct hipblas_thread_stream
+    {
+        hipblasHandle_t              handle;
+        std::atomic<hipblasHandle_t> thread_handle;
+    };
+
+    std::mutex& thread_stream_mutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    // The bindings of every thread, by handle
+    std::unordered_multimap<hipblasHandle_t, std::shared_ptr<hipblas_thread_stream>>&
+        thread_stream_map()
+    {
+        static std::unordered_multimap<hipblasHandle_t, std::shared_ptr<hipblas_thread_stream>>
+            map;
+        return map;
+    }
+
+    // number of bindings, see hipblasThreadStreamHandle
+    std::atomic<int> g_thread_streams{0};
+
+    // Removes binding, returning its handle to destroy, or nullptr if it was already removed.
+    // Called with the mutex held.
+    hipblasHandle_t hipblas_thread_stream_remove(hipblas_thread_stream& binding)
+    {
+        hipblasHandle_t thread_handle = binding.thread_handle.exchange(nullptr);
+        if(!thread_handle)
+            return nullptr;
+
+        auto range = thread_stream_map().equal_range(binding.handle);
+        for(auto it = range.first; it != range.second; ++it)
+        {
+            if(it->second.get() == &binding)
+            {
+                thread_stream_map().erase(it);
+                break;
+            }
+        }
+        g_thread_streams--;
+        return thread_handle;
+    }
+
+    // The bindings of a thread, removed when the thread exits
+    struct hipblas_thread_streams
+    {
+        std::unordered_map<hipblasHandle_t, std::shared_ptr<hipblas_thread_stream>> bindings;
+
+        // Removes the binding of handle, if any
+        void remove(hipblasHandle_t handle)
+        {
+            auto it = bindings.find(handle);
+            if(it == bindings.end())
+                return;
+
+            hipblasHandle_t thread_handle;
+            {
+                std::lock_guard<std::mutex> lock(thread_stream_mutex());
+                thread_handle = hipblas_thread_stream_remove(*it->second);
+            }
+            bindings.erase(it);
+            if(thread_handle)
+                hipblasDestroy(thread_handle);
+        }
+
+        ~hipblas_thread_streams()
+        {
+            while(!bindings.empty())
+                remove(bindings.begin()->first);
+        }
+    };
+
+    hipblas_thread_streams& thread_streams()
+    {
+        thread_local hipblas_thread_streams streams;
+        return streams;
+    }
+
+    // Creates a handle on the device of stream, leaving the current device of the thread
+    // unchanged
+    hipblasStatus_t hipblas_thread_stream_create_handle(hipStream_t stream, hipblasHandle_t* handle)
+    {
+        int current, device;
+        if(hipGetDevice(&current) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        if(hipStreamGetDevice(stream, &device) != hipSuccess)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(current != device && hipSetDevice(device) != hipSuccess)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipblasStatus_t status = hipblasCreate(handle);
+
+        if(current != device)
+            (void)hipSetDevice(current);
+        return status;
+    }
+}
+
+hipblasStatus_t hipblasCopyHandleModes(hipblasHandle_t from, hipblasHandle_t to)
+{
+    hipblasPointerMode_t         pointer_mode;
+    hipblasAtomicsMode_t         atomics_mode;
+    hipblasMath_t                math_mode;
+    hipblasGraphCaptureMode_t    graph_capture_mode;
+    hipblasInfoMode_t            info_mode;
+    hipblasReproducibilityMode_t reproducibility_mode;
+    hipblasHostDispatchMode_t    host_dispatch_mode;
+    hipblasManagedPrefetchMode_t managed_prefetch_mode;
+    hipblasRoundingMode_t        rounding_mode;
+    uint64_t                     rounding_seed;
+    hipMemPool_t                 workspace_pool;
+    size_t                       workspace_limit;
+    hipblasBatchLayout_t         batch_layout;
+    hipblasGemmBackend_t         gemm_backend;
+    hipblasShapeDispatchMode_t   shape_dispatch_mode;
+    hipblasStatus_t              status;
+    if((status = hipblasGetPointerMode(from, &pointer_mode)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetAtomicsMode(from, &atomics_mode)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetMathMode(from, &math_mode)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetGraphCaptureMode(from, &graph_capture_mode)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetInfoMode(from, &info_mode)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetReproducibilityMode(from, &reproducibility_mode))
+              != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetHostDispatchMode(from, &host_dispatch_mode)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetManagedPrefetchMode(from, &managed_prefetch_mode))
+              != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetRoundingMode(from, &rounding_mode, &rounding_seed))
+              != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetWorkspaceMemPool(from, &workspace_pool)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetWorkspaceLimit(from, &workspace_limit)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetBatchLayout(from, &batch_layout)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetGemmBackend(from, &gemm_backend)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetShapeDispatchMode(from, &shape_dispatch_mode))
+              != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    if((status = hipblasSetPointerMode(to, pointer_mode)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasSetAtomicsMode(to, atomics_mode)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasSetGraphCaptureMode(to, graph_capture_mode)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasSetInfoMode(to, info_mode)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasSetReproducibilityMode(to, reproducibility_mode))
+              != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasSetHostDispatchMode(to, host_dispatch_mode)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasSetManagedPrefetchMode(to, managed_prefetch_mode))
+              != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasSetRoundingMode(to, rounding_mode, rounding_seed))
+              != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasSetWorkspaceMemPool(to, workspace_pool)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasSetWorkspaceLimit(to, workspace_limit)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasSetBatchLayout(to, batch_layout)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasSetGemmBackend(to, gemm_backend)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasSetShapeDispatchMode(to, shape_dispatch_mode))
+              != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    for(int function = HIPBLAS_HOST_DISPATCH_AXPY; function <= HIPBLAS_HOST_DISPATCH_GEMM;
+        function++)
+    {
+        int64_t threshold;
+        if((status = hipblasGetHostDispatchThreshold(
+                from, hipblasHostDispatchFunction_t(function), &threshold))
+               != HIPBLAS_STATUS_SUCCESS
+           || (status = hipblasSetHostDispatchThreshold(
+                   to, hipblasHostDispatchFunction_t(function), threshold))
+                  != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    (void)hipblasSetMathMode(to, math_mode);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasHandle_t hipblasThreadStreamHandle(hipblasHandle_t handle)
+{
+    if(g_thread_streams.load(std::memory_order_relaxed) == 0)
+        return handle;
+
+    auto& bindings = thread_streams().bindings;
+    auto  it       = bindings.find(handle);
+    if(it == bindings.end())
+        return handle;
+
+    hipblasHandle_t thread_handle = it->second->thread_handle.load();
+    if(!thread_handle)
+    {
+        // removed by hipblasDestroy of handle, which may since have been reused
+        bindings.erase(it);
+        return handle;
+    }
+    return thread_handle;
+}
+
+void hipblasDestroyThreadStreams(hipblasHandle_t handle)
+{
+    if(g_thread_streams.load() == 0)
+        return;
+
+    std::vector<hipblasHandle_t> thread_handles;
+    {
+        std::lock_guard<std::mutex> lock(thread_stream_mutex());
+
+        // copied first, as removing a binding erases it from the map
+        std::vector<std::shared_ptr<hipblas_thread_stream>> removed;
+        for(auto range = thread_stream_map().equal_range(handle); range.first != range.second;
+            ++range.first)
+            removed.push_back(range.first->second);
+        for(auto& binding : removed)
+        {
+            hipblasHandle_t thread_handle = hipblas_thread_stream_remove(*binding);
+            if(thread_handle)
+                thread_handles.push_back(thread_handle);
+        }
+    }
+
+    // destroyed without the mutex, as hipblasDestroy of a thread handle comes back here
+    for(hipblasHandle_t thread_handle : thread_handles)
+        hipblasDestroy(thread_handle);
+}
+
+extern "C" hipblasStatus_t hipblasSetStreamForThread(hipblasHandle_t handle, hipStream_t stream)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    auto& bindings = thread_streams().bindings;
+    auto  it       = bindings.find(handle);
+    if(it != bindings.end())
+    {
+        hipblasHandle_t thread_handle = it->second->thread_handle.load();
+        if(thread_handle)
+            return hipblasSetStream(thread_handle, stream);
+        bindings.erase(it);
+    }
+
+    hipblasHandle_t thread_handle;
+    hipblasStatus_t status = hipblas_thread_stream_create_handle(stream, &thread_handle);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    // the stream is set first, so that a workspace allocated from a pool is ordered on it
+    if((status = hipblasSetStream(thread_handle, stream)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasCopyHandleModes(handle, thread_handle))
+              != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasDestroy(thread_handle);
+        return status;
+    }
+
+    auto binding           = std::make_shared<hipblas_thread_stream>();
+    binding->handle        = handle;
+    binding->thread_handle = thread_handle;
+    {
+        std::lock_guard<std::mutex> lock(thread_stream_mutex());
+        thread_stream_map().emplace(handle, binding);
+        g_thread_streams++;
+    }
+    bindings.emplace(handle, std::move(binding));
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetStreamForThread(hipblasHandle_t handle, hipStream_t* stream)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(stream == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGetStream(hipblasThreadStreamHandle(handle), stream);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasResetStreamForThread(hipblasHandle_t handle)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    thread_streams().remove(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
@@ -0,0 +1,1095 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas_trace.hpp"
+#include "hipblas_profile.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#ifdef HIPBLAS_ROCTX
+#ifdef __HIP_PLATFORM_AMD__
+#if __has_include(<rocprofiler-sdk-roctx/roctx.h>)
+#include <rocprofiler-sdk-roctx/roctx.h>
+#else
+#include <roctracer/roctx.h>
+#endif
+#else
+#include <nvtx3/nvToolsExt.h>
+#endif
+#endif
+
+// A traced call with the events that time it. ready is set by the calling thread once the call
+// has returned, and cleared by the trace thread once the call is written.
+struct hipblasTraceSlot
+{
+    hipblasTraceRecord record;
+    hipEvent_t         start = nullptr;
+    hipEvent_t         stop  = nullptr;
+    bool               timed = false;
+    std::atomic<bool>  ready{false};
+};
+
+namespace
+{
+    // Ring of the traced calls of one thread, with that thread as the only producer and the
+    // trace thread as the only consumer. Slots are reserved in call order and written in that
+    // order once ready, so a call traced while another is in progress is still written after it.
+    class trace_buffer
+    {
+        std::unique_ptr<hipblasTraceSlot[]> m_slots;
+        size_t                              m_capacity;
+        uint64_t                            m_reserved = 0;
+        std::atomic<uint64_t>               m_written{0};
+        std::atomic<uint64_t>               m_dropped{0};
+
+    public:
+        explicit trace_buffer(size_t capacity)
+            : m_slots(new hipblasTraceSlot[capacity])
+            , m_capacity(capacity)
+        {
+        }
+
+        ~trace_buffer()
+        {
+            for(size_t i = 0; i < m_capacity; i++)
+            {
+                if(m_slots[i].start)
+                    (void)hipEventDestroy(m_slots[i].start);
+                if(m_slots[i].stop)
+                    (void)hipEventDestroy(m_slots[i].stop);
+            }
+        }
+
+        // Called by the thread of the buffer. The calling thread never waits for the trace
+        // thread, so when the buffer is full the call is dropped and counted.
+        hipblasTraceSlot* reserve()
+        {
+            if(m_reserved - m_written.load(std::memory_order_acquire) >= m_capacity)
+            {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            return &m_slots[m_reserved++ % m_capacity];
+        }
+
+        // Called by the thread of the buffer after reserve
+        bool half_full() const
+        {
+            return m_reserved - m_written.load(std::memory_order_relaxed) == m_capacity / 2;
+        }
+
+        // Called by the trace thread. Returns the next call to write if it is ready.
+        hipblasTraceSlot* next()
+        {
+            uint64_t          written = m_written.load(std::memory_order_relaxed);
+            hipblasTraceSlot& slot    = m_slots[written % m_capacity];
+            return slot.ready.load(std::memory_order_acquire) ? &slot : nullptr;
+        }
+
+        // Called by the trace thread once the call returned by next is written
+        void pop()
+        {
+            uint64_t written = m_written.load(std::memory_order_relaxed);
+            m_slots[written % m_capacity].ready.store(false, std::memory_order_relaxed);
+            m_written.store(written + 1, std::memory_order_release);
+        }
+
+        uint64_t take_dropped()
+        {
+            return m_dropped.exchange(0, std::memory_order_relaxed);
+        }
+    };
+
+    const char* datatype_string(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_16F:
+            return "f16_r";
+        case HIP_R_32F:
+            return "f32_r";
+        case HIP_R_64F:
+            return "f64_r";
+        case HIP_C_16F:
+            return "f16_c";
+        case HIP_C_32F:
+            return "f32_c";
+        case HIP_C_64F:
+            return "f64_c";
+        case HIP_R_8I:
+            return "i8_r";
+        case HIP_R_8U:
+            return "u8_r";
+        case HIP_R_32I:
+            return "i32_r";
+        case HIP_R_32U:
+            return "u32_r";
+        case HIP_C_8I:
+            return "i8_c";
+        case HIP_C_8U:
+            return "u8_c";
+        case HIP_C_32I:
+            return "i32_c";
+        case HIP_C_32U:
+            return "u32_c";
+        case HIP_R_16BF:
+            return "bf16_r";
+        case HIP_C_16BF:
+            return "bf16_c";
+        default:
+            return "invalid";
+        }
+    }
+
+#ifndef HIPBLAS_V2
+    const char* datatype_string(hipblasDatatype_t type)
+    {
+        switch(type)
+        {
+        case HIPBLAS_R_16F:
+            return "f16_r";
+        case HIPBLAS_R_32F:
+            return "f32_r";
+        case HIPBLAS_R_64F:
+            return "f64_r";
+        case HIPBLAS_C_16F:
+            return "f16_c";
+        case HIPBLAS_C_32F:
+            return "f32_c";
+        case HIPBLAS_C_64F:
+            return "f64_c";
+        case HIPBLAS_R_8I:
+            return "i8_r";
+        case HIPBLAS_R_8U:
+            return "u8_r";
+        case HIPBLAS_R_32I:
+            return "i32_r";
+        case HIPBLAS_R_32U:
+            return "u32_r";
+        case HIPBLAS_C_8I:
+            return "i8_c";
+        case HIPBLAS_C_8U:
+            return "u8_c";
+        case HIPBLAS_C_32I:
+            return "i32_c";
+        case HIPBLAS_C_32U:
+            return "u32_c";
+        case HIPBLAS_R_16B:
+            return "bf16_r";
+        case HIPBLAS_C_16B:
+            return "bf16_c";
+        default:
+            return "invalid";
+        }
+    }
+#endif
+
+    const char* compute_type_string(hipblasComputeType_t type)
+    {
+        switch(type)
+        {
+        case HIPBLAS_COMPUTE_16F:
+            return "c16f";
+        case HIPBLAS_COMPUTE_16F_PEDANTIC:
+            return "c16f_pedantic";
+        case HIPBLAS_COMPUTE_32F:
+            return "c32f";
+        case HIPBLAS_COMPUTE_32F_PEDANTIC:
+            return "c32f_pedantic";
+        case HIPBLAS_COMPUTE_32F_FAST_16F:
+            return "c32f_fast_16f";
+        case HIPBLAS_COMPUTE_32F_FAST_16BF:
+            return "c32f_fast_16Bf";
+        case HIPBLAS_COMPUTE_32F_FAST_TF32:
+            return "c32f_fast_tf32";
+        case HIPBLAS_COMPUTE_64F:
+            return "c64f";
+        case HIPBLAS_COMPUTE_64F_PEDANTIC:
+            return "c64f_pedantic";
+        case HIPBLAS_COMPUTE_32I:
+            return "c32i";
+        case HIPBLAS_COMPUTE_32I_PEDANTIC:
+            return "c32i_pedantic";
+        default:
+            return "invalid";
+        }
+    }
+
+    // Returns the hipblas-bench value of a traced argument
+    std::string bench_value(int64_t value, hipblasTraceKind kind)
+    {
+        switch(kind)
+        {
+        case hipblasTraceKind::operation:
+            return value == HIPBLAS_OP_T ? "T" : value == HIPBLAS_OP_C ? "C" : "N";
+        case hipblasTraceKind::fill:
+            return value == HIPBLAS_FILL_MODE_UPPER   ? "U"
+                   : value == HIPBLAS_FILL_MODE_LOWER ? "L"
+                                                      : "F";
+        case hipblasTraceKind::diag:
+            return value == HIPBLAS_DIAG_UNIT ? "U" : "N";
+        case hipblasTraceKind::side:
+            return value == HIPBLAS_SIDE_LEFT    ? "L"
+                   : value == HIPBLAS_SIDE_RIGHT ? "R"
+                                                 : "B";
+        case hipblasTraceKind::hip_datatype:
+            return datatype_string(hipDataType(value));
+#ifndef HIPBLAS_V2
+        case hipblasTraceKind::datatype:
+            return datatype_string(hipblasDatatype_t(value));
+#endif
+        case hipblasTraceKind::compute_type:
+            return compute_type_string(hipblasComputeType_t(value));
+        default:
+            return std::to_string(value);
+        }
+    }
+
+    // Returns the hipblas-bench argument of a traced hipBLAS argument, or nullptr if the bench
+    // has no equivalent
+    const char* bench_key(const std::string& name)
+    {
+        // a constant table, as traces are still written while static objects are destroyed
+        static const char* const keys[][2] = {
+            {"m", "M"},
+            {"n", "N"},
+            {"k", "K"},
+            {"kl", "KL"},
+            {"ku", "KU"},
+            {"lda", "lda"},
+            {"ldb", "ldb"},
+            {"ldc", "ldc"},
+            {"incx", "incx"},
+            {"incy", "incy"},
+            {"batchCount", "batch_count"},
+            {"batch_count", "batch_count"},
+            {"trans", "transA"},
+            {"transA", "transA"},
+            {"transa", "transA"},
+            {"transB", "transB"},
+            {"transb", "transB"},
+            {"uplo", "uplo"},
+            {"diag", "diag"},
+            {"side", "side"},
+            {"strideA", "stride_a"},
+            {"strideAP", "stride_a"},
+            {"stride_A", "stride_a"},
+            {"stride_a", "stride_a"},
+            {"bsa", "stride_a"},
+            {"strideB", "stride_b"},
+            {"stride_B", "stride_b"},
+            {"stride_b", "stride_b"},
+            {"bsb", "stride_b"},
+            {"strideC", "stride_c"},
+            {"stride_C", "stride_c"},
+            {"stride_c", "stride_c"},
+            {"bsc", "stride_c"},
+            {"stridex", "stride_x"},
+            {"stride_x", "stride_x"},
+            {"stridey", "stride_y"},
+            {"stride_y", "stride_y"},
+            {"algo", "algo"},
+            {"flags", "flags"},
+            {"solution_index", "solution_index"},
+        };
+
+        for(auto& key : keys)
+        {
+            if(name == key[0])
+                return key[1];
+        }
+        return nullptr;
+    }
+
+    const char* precision_type(char precision)
+    {
+        switch(precision)
+        {
+        case 'S':
+            return "f32_r";
+        case 'D':
+            return "f64_r";
+        case 'C':
+            return "f32_c";
+        case 'Z':
+            return "f64_c";
+        case 'H':
+            return "f16_r";
+        default:
+            return nullptr;
+        }
+    }
+
+    bool ends_with(const std::string& str, const char* suffix)
+    {
+        size_t len = strlen(suffix);
+        return str.size() >= len && str.compare(str.size() - len, len, suffix) == 0;
+    }
+
+    // A hipBLAS function as named by hipblas-bench, e.g. hipblasZdscalStridedBatched_64 is
+    // scal_strided_batched with a_type f64_c, b_type f64_r and the C_64 api
+    struct bench_function
+    {
+        std::string name;
+        const char* api        = "C";
+        const char* a_type     = nullptr; // the type of the data
+        const char* b_type     = nullptr; // the real type of mixed precision functions
+        const char* c_type     = nullptr;
+        bool        with_flags = false;
+    };
+
+    bench_function parse_function(const char* function)
+    {
+        bench_function bench;
+        std::string    name = function + strlen("hipblas");
+
+        if(ends_with(name, "_64"))
+        {
+            name.resize(name.size() - 3);
+            bench.api = "C_64";
+        }
+        if(ends_with(name, "_v2"))
+            name.resize(name.size() - 3);
+        if(ends_with(name, "WithSolution"))
+            name.resize(name.size() - strlen("WithSolution"));
+        // the bench replays the gemm without its epilogue or scaling factors
+        if(ends_with(name, "WithEpilogue"))
+            name.resize(name.size() - strlen("WithEpilogue"));
+        if(ends_with(name, "WithScales"))
+            name.resize(name.size() - strlen("WithScales"));
+        if(ends_with(name, "WithFlags"))
+        {
+            name.resize(name.size() - strlen("WithFlags"));
+            bench.with_flags = true;
+        }
+        // the bench replays the out-of-place gemms in place, with their flags
+        if(ends_with(name, "OutOfPlace"))
+        {
+            name.resize(name.size() - strlen("OutOfPlace"));
+            bench.with_flags = true;
+        }
+
+        std::string suffix;
+        if(ends_with(name, "Ex"))
+        {
+            name.resize(name.size() - 2);
+            suffix = "_ex";
+        }
+        if(ends_with(name, "StridedBatched"))
+        {
+            name.resize(name.size() - strlen("StridedBatched"));
+            suffix = "_strided_batched" + suffix;
+        }
+        else if(ends_with(name, "Batched"))
+        {
+            name.resize(name.size() - strlen("Batched"));
+            suffix = "_batched" + suffix;
+        }
+
+        // The precision is the first letter, after the I of iamax and iamin. The _ex functions
+        // take their types as arguments.
+        std::string base = name;
+        if(name.compare(0, 2, "Bf") == 0)
+        {
+            base         = name.substr(2);
+            bench.a_type = bench.b_type = bench.c_type = "bf16_r";
+        }
+        else if(suffix.find("_ex") == std::string::npos && name.size() > 2)
+        {
+            size_t first = name[0] == 'I' && islower(name[1]) ? 1 : 0;
+            char   c     = toupper(name[first]);
+            if(precision_type(c) && islower(name[first + 1]))
+            {
+                base         = (first ? "i" : "") + name.substr(first + 1);
+                bench.a_type = bench.b_type = bench.c_type = precision_type(c);
+
+                // Csscal, Zdscal, Csrot, Zdrot, Scnrm2, Dznrm2, Scasum and Dzasum take a
+                // complex and a real type, with the real type as b_type
+                const char* second = precision_type(toupper(base[0]));
+                std::string rest   = base.substr(1);
+                if(!first && second && second != bench.a_type
+                   && (rest == "scal" || rest == "rot" || rest == "nrm2" || rest == "asum"))
+                {
+                    bool complex_first = c == 'C' || c == 'Z';
+                    base               = rest;
+                    bench.a_type       = complex_first ? precision_type(c) : second;
+                    bench.b_type       = complex_first ? second : precision_type(c);
+                    bench.c_type       = rest == "rot" ? bench.b_type : bench.a_type;
+                }
+                else if((base == "rot" || base == "rotg") && (c == 'C' || c == 'Z'))
+                {
+                    // the complex rot and rotg take a real c as b_type
+                    bench.b_type = precision_type(c == 'C' ? 'S' : 'D');
+                }
+            }
+        }
+
+        // hipblas-bench names the unconjugated complex dot dot
+        if(base == "dotu")
+            base = "dot";
+
+        // camelCase to snake_case, e.g. getrfNpvt to getrf_npvt
+        for(size_t i = 0; i < base.size(); i++)
+        {
+            if(i && isupper(base[i]))
+                bench.name += '_';
+            bench.name += char(tolower(base[i]));
+        }
+        bench.name += suffix;
+        return bench;
+    }
+
+    // Returns the precision a gemm of compute type counts its operations in, without its _r or
+    // _c suffix
+    const char* compute_datatype(hipblasComputeType_t type)
+    {
+        switch(type)
+        {
+        case HIPBLAS_COMPUTE_16F:
+        case HIPBLAS_COMPUTE_16F_PEDANTIC:
+            return "f16";
+        case HIPBLAS_COMPUTE_64F:
+        case HIPBLAS_COMPUTE_64F_PEDANTIC:
+            return "f64";
+        case HIPBLAS_COMPUTE_32I:
+        case HIPBLAS_COMPUTE_32I_PEDANTIC:
+            return "i32";
+        default:
+            return "f32";
+        }
+    }
+
+    // Sets the argument key of shape, with value as written to the trace
+    void set_shape(hipblasProfileShape& shape,
+                   const char*          key,
+                   int64_t              number,
+                   const std::string&   value)
+    {
+        if(!strcmp(key, "M"))
+            shape.M = number;
+        else if(!strcmp(key, "N"))
+            shape.N = number;
+        else if(!strcmp(key, "K"))
+            shape.K = number;
+        else if(!strcmp(key, "KL"))
+            shape.KL = number;
+        else if(!strcmp(key, "KU"))
+            shape.KU = number;
+        else if(!strcmp(key, "batch_count"))
+            shape.batch_count = number;
+        else if(!strcmp(key, "transA"))
+            shape.transA = value[0];
+        else if(!strcmp(key, "side"))
+            shape.side = value[0];
+    }
+
+    // The calls of one shape on one handle
+    struct profile_entry
+    {
+        uint64_t calls       = 0;
+        uint64_t timed_calls = 0;
+        double   us          = 0; // the GPU time of the timed calls
+        bool     counted     = false; // if gflop and gbyte are known
+        double   gflop       = 0; // per call
+        double   gbyte       = 0;
+        bool     fallback    = false; // if the calls were computed by a fallback
+    };
+
+    // Returns value right aligned in width columns, or - if value is negative
+    std::string profile_column(double value, int width, int precision)
+    {
+        char column[64];
+        if(value < 0)
+            snprintf(column, sizeof(column), "%*s", width, "-");
+        else
+            snprintf(column, sizeof(column), "%*.*f", width, precision, value);
+        return column;
+    }
+
+    // Drains the trace buffers of all threads into the trace file
+    class trace_writer
+    {
+        std::ofstream                              m_file;
+        std::ofstream                              m_profile;
+        size_t                                     m_capacity;
+        std::mutex                                 m_mutex;
+        std::condition_variable                    m_cv;
+        bool                                       m_stop = false;
+        std::vector<std::shared_ptr<trace_buffer>> m_buffers;
+        std::thread                                m_thread;
+
+        // Held while draining, by the trace thread or by hipblasDestroy reporting its handle
+        std::mutex m_drain_mutex;
+
+        // Only used while holding m_drain_mutex
+        std::unordered_map<const char*, std::vector<std::string>> m_arg_names;
+        std::unordered_map<const char*, bench_function>           m_functions;
+        std::unordered_map<hipblasHandle_t, std::unordered_map<std::string, profile_entry>>
+            m_profiles;
+
+        const std::vector<std::string>& arg_names(const char* names)
+        {
+            auto& split = m_arg_names[names];
+            if(split.empty())
+            {
+                std::string name;
+                for(const char* c = names;; c++)
+                {
+                    if(*c == ',' || !*c)
+                    {
+                        split.push_back(name);
+                        name.clear();
+                        if(!*c)
+                            break;
+                    }
+                    else if(!isspace(*c))
+                        name += *c;
+                }
+            }
+            return split;
+        }
+
+        // Returns the hipblas-bench YAML entry of a traced call, and its shape for the profile
+        std::string describe(const hipblasTraceRecord& record, hipblasProfileShape& shape)
+        {
+            auto it = m_functions.find(record.function);
+            if(it == m_functions.end())
+                it = m_functions.emplace(record.function, parse_function(record.function)).first;
+            const bench_function& function = it->second;
+
+            // the _ex functions take their types in the order of a_type, b_type and c_type,
+            // followed by the execution or compute type
+            std::string types[3]  = {function.a_type ? function.a_type : "",
+                                     function.b_type ? function.b_type : "",
+                                     function.c_type ? function.c_type : ""};
+            int         num_types = 0;
+            std::string compute;
+            const char* compute_gemm = nullptr;
+
+            std::vector<std::pair<const char*, std::string>> fields;
+
+            const std::vector<std::string>& names = arg_names(record.arg_names);
+            for(int i = 0; i < record.num_args && i + 1 < int(names.size()); i++)
+            {
+                const std::string& name  = names[i + 1];
+                std::string        value = bench_value(record.values[i], record.kinds[i]);
+
+                if(record.kinds[i] == hipblasTraceKind::datatype
+                   || record.kinds[i] == hipblasTraceKind::hip_datatype)
+                {
+                    if(name == "executionType" || name == "compute_type" || name == "computeType")
+                        compute = value;
+                    else if(num_types < 3)
+                        types[num_types++] = value;
+                }
+                else if(record.kinds[i] == hipblasTraceKind::compute_type)
+                {
+                    fields.emplace_back("compute_type_gemm", value);
+                    compute_gemm = compute_datatype(hipblasComputeType_t(record.values[i]));
+                }
+                else if(const char* key = bench_key(name))
+                {
+                    // hipblas-bench takes the n of tbmv as M
+                    if(!strcmp(key, "N") && function.name.compare(0, 4, "tbmv") == 0)
+                        key = "M";
+                    fields.emplace_back(key, value);
+                    set_shape(shape, key, record.values[i], value);
+                }
+            }
+
+            // functions such as trsm_ex only take a compute type
+            if(types[0].empty())
+                types[0] = compute;
+            for(int i = 1; i < 3; i++)
+            {
+                if(types[i].empty())
+                    types[i] = types[i - 1];
+            }
+            if(compute.empty())
+                compute = types[0];
+
+            std::string line = "- { function: " + function.name;
+            if(!types[0].empty())
+            {
+                line += ", a_type: " + types[0] + ", b_type: " + types[1] + ", c_type: " + types[2]
+                        + ", d_type: " + (num_types ? types[2] : types[0])
+                        + ", compute_type: " + compute;
+            }
+            for(auto& field : fields)
+                line += std::string(", ") + field.first + ": " + field.second;
+            if(function.with_flags)
+                line += ", with_flags: true";
+            line += std::string(", api: ") + function.api;
+            line += ", timing: 1, unit_check: 0, norm_check: 0 }";
+
+            shape.function = function.name;
+            shape.a_type   = types[0];
+            shape.b_type   = types[1];
+            shape.c_type   = types[2];
+            if(compute_gemm)
+            {
+                bool complex       = ends_with(types[0], "_c");
+                shape.compute_type = std::string(compute_gemm) + (complex ? "_c" : "_r");
+            }
+            else
+                shape.compute_type = compute;
+            return line;
+        }
+
+        void write(hipblasTraceSlot& slot)
+        {
+            const hipblasTraceRecord& record = slot.record;
+
+            hipblasProfileShape shape;
+            std::string         line = describe(record, shape);
+
+            float ms    = 0;
+            bool  timed = slot.timed && hipEventSynchronize(slot.stop) == hipSuccess
+                          && hipEventElapsedTime(&ms, slot.start, slot.stop) == hipSuccess;
+
+            if(m_file.is_open())
+            {
+                char comment[128];
+                snprintf(
+                    comment, sizeof(comment), " # %s, stream %p", record.function, record.stream);
+                m_file << line << comment;
+                if(record.fallback)
+                    m_file << ", fallback";
+                if(timed)
+                {
+                    snprintf(comment, sizeof(comment), ", %.3f us", ms * 1000.0);
+                    m_file << comment;
+                }
+                m_file << '\n';
+            }
+
+            if(m_profile.is_open())
+            {
+                auto           inserted = m_profiles[record.handle].emplace(line, profile_entry{});
+                profile_entry& entry    = inserted.first->second;
+                if(inserted.second)
+                    entry.counted = hipblasProfileCount(shape, entry.gflop, entry.gbyte);
+                entry.calls++;
+                entry.fallback = entry.fallback || record.fallback;
+                if(timed)
+                {
+                    entry.timed_calls++;
+                    entry.us += ms * 1000.0;
+                }
+            }
+        }
+
+        // Writes the profile of the calls of handle to the profile file, by decreasing GPU time
+        void report(hipblasHandle_t                                        handle,
+                    const std::unordered_map<std::string, profile_entry>& entries)
+        {
+            std::vector<const std::pair<const std::string, profile_entry>*> sorted;
+
+            uint64_t calls = 0;
+            double   us    = 0;
+            for(auto& entry : entries)
+            {
+                sorted.push_back(&entry);
+                calls += entry.second.calls;
+                us += entry.second.us;
+            }
+            std::sort(sorted.begin(), sorted.end(), [](auto* a, auto* b) {
+                return a->second.us != b->second.us ? a->second.us > b->second.us
+                                                    : a->second.calls > b->second.calls;
+            });
+
+            char line[256];
+            snprintf(line,
+                     sizeof(line),
+                     "# handle %p: %llu calls of %zu shapes, %.3f us of GPU time\n",
+                     (void*)handle,
+                     (unsigned long long)calls,
+                     sorted.size(),
+                     us);
+            m_profile << line;
+            snprintf(line,
+                     sizeof(line),
+                     "#%7s%8s%11s%15s%15s%13s%13s%9s  %s\n",
+                     "time %",
+                     "cum %",
+                     "calls",
+                     "total us",
+                     "avg us",
+                     "GFLOP/s",
+                     "GB/s",
+                     "flop/B",
+                     "shape");
+            m_profile << line;
+
+            double cumulative = 0;
+            for(auto* entry : sorted)
+            {
+                const profile_entry& e = entry->second;
+                cumulative += e.us;
+
+                // calls captured into graphs aren't timed, so the rates are of the timed calls
+                double seconds = e.us / 1e6;
+                double gflops  = e.counted && seconds > 0 ? e.gflop * e.timed_calls / seconds : -1;
+                double gbps    = e.counted && seconds > 0 && e.gbyte > 0
+                                     ? e.gbyte * e.timed_calls / seconds
+                                     : -1;
+
+                m_profile << profile_column(us > 0 ? 100 * e.us / us : -1, 8, 1)
+                          << profile_column(us > 0 ? 100 * cumulative / us : -1, 8, 1)
+                          << profile_column(double(e.calls), 11, 0)
+                          << profile_column(e.timed_calls ? e.us : -1, 15, 3)
+                          << profile_column(e.timed_calls ? e.us / e.timed_calls : -1, 15, 3)
+                          << profile_column(gflops, 13, 1) << profile_column(gbps, 13, 1)
+                          << profile_column(gbps > 0 ? e.gflop / e.gbyte : -1, 9, 2) << "  "
+                          << entry->first << (e.fallback ? "  # fallback" : "") << '\n';
+            }
+            m_profile << '\n';
+            m_profile.flush();
+        }
+
+        // Called while holding m_drain_mutex
+        void drain()
+        {
+            std::vector<std::shared_ptr<trace_buffer>> buffers;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                buffers = m_buffers;
+            }
+
+            for(auto& buffer : buffers)
+            {
+                while(hipblasTraceSlot* slot = buffer->next())
+                {
+                    write(*slot);
+                    buffer->pop();
+                }
+                uint64_t dropped = buffer->take_dropped();
+                if(dropped && m_file.is_open())
+                    m_file << "# " << dropped
+                           << " calls dropped as the trace buffer of their thread was full, see "
+                              "HIPBLAS_TRACE_BUFFER_SIZE\n";
+            }
+            if(m_file.is_open())
+                m_file.flush();
+
+            // Buffers of threads that have exited are only referenced by m_buffers, and are
+            // removed once drained.
+            buffers.clear();
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for(size_t i = 0; i < m_buffers.size();)
+            {
+                if(m_buffers[i].use_count() == 1 && !m_buffers[i]->next())
+                {
+                    m_buffers[i] = m_buffers.back();
+                    m_buffers.pop_back();
+                }
+                else
+                    i++;
+            }
+        }
+
+        void run()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            while(!m_stop)
+            {
+                m_cv.wait_for(lock, std::chrono::milliseconds(100));
+                lock.unlock();
+                {
+                    std::lock_guard<std::mutex> drain_lock(m_drain_mutex);
+                    drain();
+                }
+                lock.lock();
+            }
+        }
+
+    public:
+        // Traces to trace_path and profiles to profile_path, either of which may be nullptr
+        trace_writer(const char* trace_path, const char* profile_path, size_t capacity)
+            : m_capacity(capacity)
+        {
+            if(trace_path)
+            {
+                m_file.open(trace_path);
+                m_file << "# hipBLAS trace, replay with hipblas-bench --yaml <this file>\n";
+            }
+            if(profile_path)
+            {
+                m_profile.open(profile_path);
+                m_profile << "# hipBLAS profile of each handle when destroyed, by shape in "
+                             "hipblas-bench YAML\n\n";
+            }
+            m_thread = std::thread(&trace_writer::run, this);
+        }
+
+        ~trace_writer()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_cv.notify_one();
+            m_thread.join();
+
+            // handles that are never destroyed are reported at exit
+            std::lock_guard<std::mutex> drain_lock(m_drain_mutex);
+            drain();
+            for(auto& profile : m_profiles)
+                report(profile.first, profile.second);
+        }
+
+        bool tracing() const
+        {
+            return m_file.is_open();
+        }
+
+        bool profiling() const
+        {
+            return m_profile.is_open();
+        }
+
+        // Writes the calls of handle made so far, and reports its profile
+        void destroy_handle(hipblasHandle_t handle)
+        {
+            std::lock_guard<std::mutex> drain_lock(m_drain_mutex);
+            drain();
+            auto it = m_profiles.find(handle);
+            if(it != m_profiles.end())
+            {
+                report(it->first, it->second);
+                m_profiles.erase(it);
+            }
+        }
+
+        void wake()
+        {
+            m_cv.notify_one();
+        }
+
+        // Returns the buffer of the calling thread, creating it on the first call
+        trace_buffer* thread_buffer()
+        {
+            thread_local std::shared_ptr<trace_buffer> buffer;
+            if(!buffer)
+            {
+                buffer = std::make_shared<trace_buffer>(m_capacity);
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_buffers.push_back(buffer);
+            }
+            return buffer.get();
+        }
+    };
+
+    std::unique_ptr<trace_writer> create_trace_writer()
+    {
+        const char* trace_path   = getenv("HIPBLAS_TRACE_FILE");
+        const char* profile_path = getenv("HIPBLAS_PROFILE_FILE");
+        if(trace_path && !*trace_path)
+            trace_path = nullptr;
+        if(profile_path && !*profile_path)
+            profile_path = nullptr;
+        if(!trace_path && !profile_path)
+            return nullptr;
+
+        size_t      capacity = 4096;
+        const char* size     = getenv("HIPBLAS_TRACE_BUFFER_SIZE");
+        if(size && atol(size) > 0)
+            capacity = atol(size);
+
+        auto writer = std::make_unique<trace_writer>(trace_path, profile_path, capacity);
+        if(trace_path && !writer->tracing())
+            fprintf(stderr, "hipBLAS warning: cannot open HIPBLAS_TRACE_FILE %s\n", trace_path);
+        if(profile_path && !writer->profiling())
+            fprintf(stderr, "hipBLAS warning: cannot open HIPBLAS_PROFILE_FILE %s\n", profile_path);
+        if(!writer->tracing() && !writer->profiling())
+            return nullptr;
+        return writer;
+    }
+
+    trace_writer* get_trace_writer()
+    {
+        static std::unique_ptr<trace_writer> writer = create_trace_writer();
+        return writer.get();
+    }
+
+    // The slot of the call being traced by the calling thread
+    thread_local hipblasTraceSlot* t_current_slot = nullptr;
+}
+
+bool hipblasTraceEnabled()
+{
+    return get_trace_writer() != nullptr;
+}
+
+void hipblasTraceDestroyHandle(hipblasHandle_t handle)
+{
+    if(trace_writer* writer = get_trace_writer())
+        writer->destroy_handle(handle);
+}
+
+void hipblasTraceScope::begin(hipblasHandle_t                        handle,
+                              const char*                            function,
+                              const char*                            arg_names,
+                              std::initializer_list<hipblasTraceArg> args) noexcept
+try
+{
+    // calls with invalid handles return before doing anything worth replaying
+    if(handle == nullptr)
+        return;
+
+    trace_writer* writer = get_trace_writer();
+    trace_buffer* buffer = writer->thread_buffer();
+    m_slot               = buffer->reserve();
+    if(!m_slot)
+        return;
+    if(buffer->half_full())
+        writer->wake();
+
+    hipblasTraceRecord& record = m_slot->record;
+    record.function            = function;
+    record.arg_names           = arg_names;
+    record.handle              = handle;
+    record.stream              = nullptr;
+    record.num_args            = 0;
+    record.fallback            = false;
+    for(const hipblasTraceArg& arg : args)
+    {
+        record.values[record.num_args] = arg.value;
+        record.kinds[record.num_args]  = arg.kind;
+        record.num_args++;
+    }
+    (void)hipblasGetStream(handle, &record.stream);
+
+    // events can't be recorded in a stream that is being captured
+    hipStreamCaptureStatus capture = hipStreamCaptureStatusNone;
+    m_slot->timed                  = false;
+    if(hipStreamIsCapturing(record.stream, &capture) == hipSuccess
+       && capture == hipStreamCaptureStatusNone)
+    {
+        if(!m_slot->start && hipEventCreate(&m_slot->start) != hipSuccess)
+            m_slot->start = nullptr;
+        if(!m_slot->stop && hipEventCreate(&m_slot->stop) != hipSuccess)
+            m_slot->stop = nullptr;
+        m_slot->timed = m_slot->start && m_slot->stop
+                        && hipEventRecord(m_slot->start, record.stream) == hipSuccess;
+    }
+    t_current_slot = m_slot;
+}
+catch(...)
+{
+}
+
+void hipblasTraceScope::end() noexcept
+{
+    t_current_slot = nullptr;
+    if(m_slot->timed)
+        m_slot->timed = hipEventRecord(m_slot->stop, m_slot->record.stream) == hipSuccess;
+    m_slot->ready.store(true, std::memory_order_release);
+}
+
+void hipblasTraceFallback() noexcept
+{
+    hipblasStatisticsFallback();
+    if(t_current_slot)
+        t_current_slot->record.fallback = true;
+}
+
+#ifdef HIPBLAS_ROCTX
+bool hipblasRangesEnabled()
+{
+    static const bool enabled = [] {
+        const char* env = getenv("HIPBLAS_ROCTX");
+        return env && *env && *env != '0';
+    }();
+    return enabled;
+}
+
+// Names the range of a call with the function and its sizes, e.g. hipblasSgemm m=64 n=64 k=32
+void hipblasTraceScope::push_range(const char*                            function,
+                                   const char*                            arg_names,
+                                   std::initializer_list<hipblasTraceArg> args) noexcept
+{
+    static const char* const sizes[]
+        = {"m", "n", "k", "kl", "ku", "batchCount", "batch_count", "batch_size"};
+
+    char   name[256];
+    size_t len = snprintf(name, sizeof(name), "%s", function);
+
+    // the names of the arguments are spelled as the arguments of HIPBLAS_TRACE, after handle
+    const char* names = strchr(arg_names, ',');
+    for(const hipblasTraceArg& arg : args)
+    {
+        if(!names)
+            break;
+        names++;
+        while(isspace(*names))
+            names++;
+        size_t name_len = strcspn(names, ", \t\n");
+
+        if(arg.kind == hipblasTraceKind::integer && len < sizeof(name))
+        {
+            for(const char* size : sizes)
+            {
+                if(strlen(size) == name_len && strncmp(names, size, name_len) == 0)
+                {
+                    len += snprintf(name + len,
+                                    sizeof(name) - len,
+                                    " %s=%lld",
+                                    size,
+                                    (long long)arg.value);
+                    break;
+                }
+            }
+        }
+        names = strchr(names, ',');
+    }
+
+#ifdef __HIP_PLATFORM_AMD__
+    roctxRangePushA(name);
+#else
+    nvtxRangePushA(name);
+#endif
+    m_range = true;
+}
+
+void hipblasTraceScope::pop_range() noexcept
+{
+#ifdef __HIP_PLATFORM_AMD__
+    roctxRangePop();
+#else
+    nvtxRangePop();
+#endif
+}
+#endif
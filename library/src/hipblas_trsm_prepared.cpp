@@ -0,0 +1,359 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+
+#include "exceptions.hpp"
+#include "hipblas_entry.hpp"
+
+// Prepared trsm: the inverses of the diagonal blocks of a triangular matrix are computed once
+// with trtri into device memory owned by the object, and passed as invA to every trsmEx with
+// that matrix, so the solves only run gemms. This is built on the public trtri and trsmEx of
+// hipBLAS, so it is supported wherever they are.
+
+// The order of the diagonal blocks of invA, as documented for hipblasTrsmEx
+static constexpr int hipblas_trsm_prepared_block = 128;
+
+struct hipblasTrsmPrepared
+{
+    hipblasFillMode_t uplo;
+    hipblasDiagType_t diag;
+    int               k;
+    void*             A;
+    int               lda;
+    hipblasStride     strideA;
+    int               batch_count;
+    hipDataType       compute_type;
+    void*             invA;
+    hipblasStride     stride_invA;
+};
+
+namespace
+{
+    size_t hipblas_trsm_prepared_element_size(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_32F:
+            return sizeof(float);
+        case HIP_R_64F:
+            return sizeof(double);
+        case HIP_C_32F:
+            return sizeof(hipComplex);
+        case HIP_C_64F:
+            return sizeof(hipDoubleComplex);
+        default:
+            return 0;
+        }
+    }
+
+    // invA_j := inverse of the j-th diagonal block of each A_i, for blocks_count blocks of
+    // order n from block j. A single matrix inverts its blocks as one strided batch, and a
+    // batch of matrices inverts one block of all of them at a time.
+    hipblasStatus_t hipblas_trsm_prepared_trtri(hipblasHandle_t            handle,
+                                                const hipblasTrsmPrepared* p,
+                                                int                        j,
+                                                int                        blocks_count,
+                                                int                        n)
+    {
+        const int     nb       = hipblas_trsm_prepared_block;
+        const size_t  size     = hipblas_trsm_prepared_element_size(p->compute_type);
+        hipblasStride stride_d = (hipblasStride(nb) * p->lda + nb);
+        hipblasStride stride_i = hipblasStride(nb) * nb;
+
+        const char* A    = (const char*)p->A + size * stride_d * j;
+        char*       invA = (char*)p->invA + size * stride_i * j;
+
+        // the strides of the batch passed to trtri
+        hipblasStride strideA     = p->batch_count == 1 ? stride_d : p->strideA;
+        hipblasStride stride_invA = p->batch_count == 1 ? stride_i : p->stride_invA;
+        int           batch_count = p->batch_count == 1 ? blocks_count : p->batch_count;
+
+        switch(p->compute_type)
+        {
+        case HIP_R_32F:
+            return hipblasStrtriStridedBatched(handle,
+                                               p->uplo,
+                                               p->diag,
+                                               n,
+                                               (const float*)A,
+                                               p->lda,
+                                               strideA,
+                                               (float*)invA,
+                                               nb,
+                                               stride_invA,
+                                               batch_count);
+        case HIP_R_64F:
+            return hipblasDtrtriStridedBatched(handle,
+                                               p->uplo,
+                                               p->diag,
+                                               n,
+                                               (const double*)A,
+                                               p->lda,
+                                               strideA,
+                                               (double*)invA,
+                                               nb,
+                                               stride_invA,
+                                               batch_count);
+        case HIP_C_32F:
+            return hipblasCtrtriStridedBatched_v2(handle,
+                                                  p->uplo,
+                                                  p->diag,
+                                                  n,
+                                                  (const hipComplex*)A,
+                                                  p->lda,
+                                                  strideA,
+                                                  (hipComplex*)invA,
+                                                  nb,
+                                                  stride_invA,
+                                                  batch_count);
+        case HIP_C_64F:
+            return hipblasZtrtriStridedBatched_v2(handle,
+                                                  p->uplo,
+                                                  p->diag,
+                                                  n,
+                                                  (const hipDoubleComplex*)A,
+                                                  p->lda,
+                                                  strideA,
+                                                  (hipDoubleComplex*)invA,
+                                                  nb,
+                                                  stride_invA,
+                                                  batch_count);
+        default:
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    hipblasStatus_t hipblas_trsm_prepared_compute(hipblasHandle_t handle, hipblasTrsmPrepared* p)
+    {
+        const int nb     = hipblas_trsm_prepared_block;
+        const int full   = p->k / nb;
+        const int remain = p->k % nb;
+
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        if(p->batch_count == 1)
+        {
+            if(full)
+                status = hipblas_trsm_prepared_trtri(handle, p, 0, full, nb);
+        }
+        else
+        {
+            for(int j = 0; j < full && status == HIPBLAS_STATUS_SUCCESS; j++)
+                status = hipblas_trsm_prepared_trtri(handle, p, j, 1, nb);
+        }
+        if(remain && status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_trsm_prepared_trtri(handle, p, full, 1, remain);
+        return status;
+    }
+
+    // Checks that a solve of an m-by-n B fits the prepared matrix
+    hipblasStatus_t hipblas_trsm_prepared_check(const hipblasTrsmPrepared* p,
+                                                hipblasSideMode_t          side,
+                                                hipblasOperation_t         transA,
+                                                int                        m,
+                                                int                        n,
+                                                int                        ldb)
+    {
+        if(side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(transA != HIPBLAS_OP_N && transA != HIPBLAS_OP_T && transA != HIPBLAS_OP_C)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(m < 0 || n < 0 || ldb < std::max(1, m) || (side == HIPBLAS_SIDE_LEFT ? m : n) != p->k)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+extern "C" hipblasStatus_t hipblasTrsmPreparedCreate(hipblasHandle_t        handle,
+                                                     hipblasTrsmPrepared_t* prepared,
+                                                     hipblasFillMode_t      uplo,
+                                                     hipblasDiagType_t      diag,
+                                                     int                    k,
+                                                     void*                  A,
+                                                     int                    lda,
+                                                     hipblasStride          strideA,
+                                                     int                    batchCount,
+                                                     hipDataType            computeType)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, diag, k, lda, strideA, batchCount, computeType);
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(prepared == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *prepared = nullptr;
+
+    if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(diag != HIPBLAS_DIAG_UNIT && diag != HIPBLAS_DIAG_NON_UNIT)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    size_t size = hipblas_trsm_prepared_element_size(computeType);
+    if(!size)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(k < 0 || lda < std::max(1, k) || batchCount < 1 || (k && A == nullptr))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    auto p          = new hipblasTrsmPrepared;
+    p->uplo         = uplo;
+    p->diag         = diag;
+    p->k            = k;
+    p->A            = A;
+    p->lda          = lda;
+    p->strideA      = strideA;
+    p->batch_count  = batchCount;
+    p->compute_type = computeType;
+    p->invA         = nullptr;
+    p->stride_invA  = hipblasStride(hipblas_trsm_prepared_block) * k;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    if(k)
+    {
+        if(hipMalloc(&p->invA, size * p->stride_invA * batchCount) != hipSuccess)
+            status = HIPBLAS_STATUS_ALLOC_FAILED;
+        else
+            status = hipblas_trsm_prepared_compute(handle, p);
+    }
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        (void)hipFree(p->invA);
+        delete p;
+        return status;
+    }
+    *prepared = p;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasTrsmPreparedDestroy(hipblasTrsmPrepared_t prepared)
+try
+{
+    if(prepared)
+    {
+        // The inverses may still be read by solves queued on any stream
+        (void)hipDeviceSynchronize();
+        (void)hipFree(prepared->invA);
+        delete prepared;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasTrsmPreparedEx(hipblasHandle_t       handle,
+                                                 hipblasTrsmPrepared_t prepared,
+                                                 hipblasSideMode_t     side,
+                                                 hipblasOperation_t    transA,
+                                                 int                   m,
+                                                 int                   n,
+                                                 const void*           alpha,
+                                                 void*                 B,
+                                                 int                   ldb)
+try
+{
+    HIPBLAS_ENTRY(handle, side, transA, m, n, ldb);
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(prepared == nullptr || prepared->batch_count != 1)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    hipblasStatus_t status = hipblas_trsm_prepared_check(prepared, side, transA, m, n, ldb);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return hipblasTrsmEx_v2(handle,
+                            side,
+                            prepared->uplo,
+                            transA,
+                            prepared->diag,
+                            m,
+                            n,
+                            alpha,
+                            prepared->A,
+                            prepared->lda,
+                            B,
+                            ldb,
+                            prepared->invA,
+                            int(prepared->stride_invA),
+                            prepared->compute_type);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasTrsmPreparedStridedBatchedEx(hipblasHandle_t       handle,
+                                                               hipblasTrsmPrepared_t prepared,
+                                                               hipblasSideMode_t     side,
+                                                               hipblasOperation_t    transA,
+                                                               int                   m,
+                                                               int                   n,
+                                                               const void*           alpha,
+                                                               void*                 B,
+                                                               int                   ldb,
+                                                               hipblasStride         strideB)
+try
+{
+    HIPBLAS_ENTRY(handle, side, transA, m, n, ldb, strideB);
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(prepared == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    hipblasStatus_t status = hipblas_trsm_prepared_check(prepared, side, transA, m, n, ldb);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return hipblasTrsmStridedBatchedEx_v2(handle,
+                                          side,
+                                          prepared->uplo,
+                                          transA,
+                                          prepared->diag,
+                                          m,
+                                          n,
+                                          alpha,
+                                          prepared->A,
+                                          prepared->lda,
+                                          prepared->strideA,
+                                          B,
+                                          ldb,
+                                          strideB,
+                                          prepared->batch_count,
+                                          prepared->invA,
+                                          int(prepared->stride_invA),
+                                          prepared->stride_invA,
+                                          prepared->compute_type);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
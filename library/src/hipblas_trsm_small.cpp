@@ -0,0 +1,476 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_interleaved_batch.hpp"
+#include "hipblas_trsm_small.hpp"
+
+// The small batched triangular solves of hipblas_trsm_small.hpp. Every solve is written as the
+// forward substitution L x = alpha b of a lower triangular L: a side right trsm solves the
+// transposed system, with the rows of B as its right-hand sides, and an upper triangular L is
+// read with its rows and columns in reverse order. A block solves P systems padded to order S,
+// with the lower triangle of each packed by columns in shared memory and a thread for each row.
+// At step k of the substitution every row i > k subtracts L(i, k) / L(k, k) times x_k, so the
+// threads of a system share a barrier per step and divide by the diagonal only at the end.
+
+namespace
+{
+    constexpr int hipblas_small_trsm_threads = 256;
+    constexpr int hipblas_small_trsm_max     = 64;
+
+    // Right-hand sides kept in shared memory at once
+    constexpr int hipblas_small_trsm_rhs = 8;
+
+    // Shared memory of a block, which bounds the systems per block of the larger types
+    constexpr size_t hipblas_small_trsm_lds = 48 * 1024;
+
+    // Smallest batch solved by these kernels; the backend is as fast for fewer systems
+    constexpr int64_t hipblas_small_trsm_min_batch = 32;
+
+    // Systems per block of order S: a thread for each row, within the shared memory
+    template <typename T, int S>
+    constexpr int hipblas_small_trsm_systems()
+    {
+        constexpr size_t bytes = (S * (S + 1) / 2 + S * hipblas_small_trsm_rhs + S) * sizeof(T);
+        constexpr size_t p     = std::min<size_t>(hipblas_small_trsm_threads / S,
+                                              hipblas_small_trsm_lds / bytes);
+        return p < 1 ? 1 : int(p);
+    }
+
+    // Offset of L(i, k), i >= k, in the lower triangle of order S packed by columns
+    template <int S>
+    __device__ inline int hipblas_small_trsm_packed(int i, int k)
+    {
+        return k * S - k * (k - 1) / 2 + i - k;
+    }
+
+    template <typename T>
+    __device__ inline T hipblas_small_trsm_mul(T a, T b)
+    {
+        return a * b;
+    }
+
+    __device__ inline hipFloatComplex hipblas_small_trsm_mul(hipFloatComplex a, hipFloatComplex b)
+    {
+        return hipCmulf(a, b);
+    }
+
+    __device__ inline hipDoubleComplex hipblas_small_trsm_mul(hipDoubleComplex a,
+                                                              hipDoubleComplex b)
+    {
+        return hipCmul(a, b);
+    }
+
+    // c - a * b
+    template <typename T>
+    __device__ inline T hipblas_small_trsm_fms(T a, T b, T c)
+    {
+        return c - a * b;
+    }
+
+    __device__ inline hipFloatComplex
+        hipblas_small_trsm_fms(hipFloatComplex a, hipFloatComplex b, hipFloatComplex c)
+    {
+        return hipCsubf(c, hipCmulf(a, b));
+    }
+
+    __device__ inline hipDoubleComplex
+        hipblas_small_trsm_fms(hipDoubleComplex a, hipDoubleComplex b, hipDoubleComplex c)
+    {
+        return hipCsub(c, hipCmul(a, b));
+    }
+
+    template <typename T>
+    __device__ inline T hipblas_small_trsm_inv(T a)
+    {
+        return T(1) / a;
+    }
+
+    __device__ inline hipFloatComplex hipblas_small_trsm_inv(hipFloatComplex a)
+    {
+        return hipCdivf(make_hipFloatComplex(1, 0), a);
+    }
+
+    __device__ inline hipDoubleComplex hipblas_small_trsm_inv(hipDoubleComplex a)
+    {
+        return hipCdiv(make_hipDoubleComplex(1, 0), a);
+    }
+
+    // The matrix b of a batch, from an array of pointers or at a stride from the first one
+    template <typename T>
+    __device__ inline T*
+        hipblas_small_trsm_matrix(const void* X, hipblasStride stride, bool batched, int64_t b)
+    {
+        if(batched)
+            return static_cast<T* const*>(X)[b];
+        return static_cast<T*>(const_cast<void*>(X)) + b * stride;
+    }
+
+    // A batch of systems as the forward substitutions of the kernel. L(i, k) is A(i, k), or
+    // A(k, i) when transposed, conjugated when conj, with i and k counted from the end when
+    // reversed. Element i of the right-hand side j is B[offset + i * inc + j * ld], with i also
+    // counted from the end when reversed.
+    struct hipblas_small_trsm_problem
+    {
+        int           order;
+        int           rhs;
+        bool          transposed;
+        bool          conj;
+        bool          reversed;
+        bool          unit;
+        const void*   A;
+        int64_t       lda;
+        hipblasStride strideA;
+        void*         B;
+        int64_t       offset;
+        int64_t       inc;
+        int64_t       ld;
+        hipblasStride strideB;
+        bool          batched;
+        int64_t       batch_count;
+    };
+
+    // Solves L_b X_b = alpha B_b in place for P systems per block. A_b and B_b aren't read when
+    // alpha is zero, and B_b is then set to zero. alpha is read from alpha when it isn't
+    // nullptr, in device pointer mode, and is alpha_value otherwise.
+    template <typename T, int S>
+    __global__ void __launch_bounds__(hipblas_small_trsm_threads)
+        hipblasSmallTrsmKernel(hipblas_small_trsm_problem problem, const T* alpha, T alpha_value)
+    {
+        constexpr int P = hipblas_small_trsm_systems<T, S>();
+        constexpr int W = hipblas_small_trsm_rhs;
+
+        __shared__ T tile[P][S * (S + 1) / 2];
+        __shared__ T inv_diag[P][S];
+        __shared__ T x[P][W][S];
+
+        const int order  = problem.order;
+        T         a      = alpha ? *alpha : alpha_value;
+        bool      read_a = !hipblas_device_is_zero(a);
+        int       p      = threadIdx.x / S;
+        int       t      = threadIdx.x % S;
+        bool      row    = t < order;
+        int64_t   b_row  = problem.offset + (problem.reversed ? order - 1 - t : t) * problem.inc;
+
+        for(int64_t b0 = int64_t(blockIdx.x) * P; b0 < problem.batch_count;
+            b0 += int64_t(gridDim.x) * P)
+        {
+            int64_t b      = b0 + p;
+            bool    active = b < problem.batch_count;
+            T*      Bb     = nullptr;
+            if(active)
+                Bb = hipblas_small_trsm_matrix<T>(problem.B, problem.strideB, problem.batched, b);
+            if(active && read_a)
+            {
+                // the threads read consecutive elements of the columns of A
+                const T* Ab = hipblas_small_trsm_matrix<const T>(
+                    problem.A, problem.strideA, problem.batched, b);
+                for(int e = t; e < S * S; e += S)
+                {
+                    int r = e % S, c = e / S;
+                    if(r >= order || c >= order)
+                        continue;
+                    int i = problem.transposed ? c : r;
+                    int k = problem.transposed ? r : c;
+                    if(problem.reversed)
+                    {
+                        i = order - 1 - i;
+                        k = order - 1 - k;
+                    }
+                    if(i < k)
+                        continue;
+                    T y = Ab[r + c * problem.lda];
+                    tile[p][hipblas_small_trsm_packed<S>(i, k)]
+                        = problem.conj ? hipblas_device_conj(y) : y;
+                }
+            }
+            __syncthreads();
+
+            if(active && read_a && row)
+                inv_diag[p][t]
+                    = problem.unit
+                          ? hipblas_device_one<T>()
+                          : hipblas_small_trsm_inv(tile[p][hipblas_small_trsm_packed<S>(t, t)]);
+
+            for(int j0 = 0; j0 < problem.rhs; j0 += W)
+            {
+                int w = std::min(W, problem.rhs - j0);
+                if(active && row && read_a)
+                {
+                    for(int j = 0; j < w; j++)
+                        x[p][j][t] = hipblas_small_trsm_mul(a, Bb[b_row + (j0 + j) * problem.ld]);
+                }
+                __syncthreads();
+
+                // x_k is complete but for its division by L(k, k) at step k
+                for(int k = 0; read_a && k < order - 1; k++)
+                {
+                    if(active && t > k && row)
+                    {
+                        T l = hipblas_small_trsm_mul(tile[p][hipblas_small_trsm_packed<S>(t, k)],
+                                                     inv_diag[p][k]);
+                        for(int j = 0; j < w; j++)
+                            x[p][j][t] = hipblas_small_trsm_fms(l, x[p][j][k], x[p][j][t]);
+                    }
+                    __syncthreads();
+                }
+
+                if(active && row)
+                {
+                    for(int j = 0; j < w; j++)
+                        Bb[b_row + (j0 + j) * problem.ld]
+                            = read_a ? hipblas_small_trsm_mul(x[p][j][t], inv_diag[p][t]) : T{};
+                }
+            }
+
+            // the shared memory is reused by the next systems of the batch
+            __syncthreads();
+        }
+    }
+
+    template <typename T, int S>
+    hipError_t hipblas_small_trsm_launch(const hipblas_small_trsm_problem& problem,
+                                         const void*                       alpha,
+                                         bool                              host_scalars,
+                                         hipStream_t                       stream)
+    {
+        constexpr int P = hipblas_small_trsm_systems<T, S>();
+
+        // trsv has no alpha
+        T alpha_value = hipblas_device_one<T>();
+        if(alpha && host_scalars)
+            alpha_value = *static_cast<const T*>(alpha);
+
+        int blocks = int(std::min<int64_t>((problem.batch_count - 1) / P + 1, 65535));
+        hipblasSmallTrsmKernel<T, S><<<blocks, P * S, 0, stream>>>(
+            problem, host_scalars ? nullptr : (const T*)alpha, alpha_value);
+        return hipGetLastError();
+    }
+
+    using hipblas_small_trsm_fn
+        = hipError_t (*)(const hipblas_small_trsm_problem&, const void*, bool, hipStream_t);
+
+    // The kernel for systems padded to the order: 32 of order 8 or 16 of order 16 per block, and
+    // fewer of orders 32 and 64 when their triangles don't fit in shared memory
+    template <typename T>
+    hipblas_small_trsm_fn hipblas_small_trsm_order(int order)
+    {
+        if(order <= 8)
+            return hipblas_small_trsm_launch<T, 8>;
+        if(order <= 16)
+            return hipblas_small_trsm_launch<T, 16>;
+        if(order <= 32)
+            return hipblas_small_trsm_launch<T, 32>;
+        return hipblas_small_trsm_launch<T, 64>;
+    }
+
+    bool hipblas_small_trsm_enabled()
+    {
+        static const bool enabled = [] {
+            const char* env = getenv("HIPBLAS_SMALL_TRSM");
+            return !env || *env != '0';
+        }();
+        return enabled;
+    }
+
+    bool hipblas_small_trsm_valid(hipblasFillMode_t  uplo,
+                                  hipblasOperation_t transA,
+                                  hipblasDiagType_t  diag)
+    {
+        return (uplo == HIPBLAS_FILL_MODE_LOWER || uplo == HIPBLAS_FILL_MODE_UPPER)
+               && (transA == HIPBLAS_OP_N || transA == HIPBLAS_OP_T || transA == HIPBLAS_OP_C)
+               && (diag == HIPBLAS_DIAG_UNIT || diag == HIPBLAS_DIAG_NON_UNIT);
+    }
+
+    // Solves the problem with the kernel for its type and order, or returns
+    // HIPBLAS_STATUS_NOT_SUPPORTED for the types the kernels don't support
+    hipblasStatus_t hipblas_small_trsm(hipblasHandle_t                   handle,
+                                       const hipblas_small_trsm_problem& problem,
+                                       const void*                       alpha,
+                                       hipDataType                       type)
+    {
+        hipblas_small_trsm_fn trsm;
+        switch(type)
+        {
+        case HIP_R_32F:
+            trsm = hipblas_small_trsm_order<float>(problem.order);
+            break;
+        case HIP_R_64F:
+            trsm = hipblas_small_trsm_order<double>(problem.order);
+            break;
+        case HIP_C_32F:
+            trsm = hipblas_small_trsm_order<hipFloatComplex>(problem.order);
+            break;
+        case HIP_C_64F:
+            trsm = hipblas_small_trsm_order<hipDoubleComplex>(problem.order);
+            break;
+        default:
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        }
+
+        hipStream_t          stream;
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS
+           || (status = hipblasGetPointerMode(handle, &mode)) != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        if(trsm(problem, alpha, mode != HIPBLAS_POINTER_MODE_DEVICE, stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+hipblasStatus_t hipblasSmallTrsm(hipblasHandle_t    handle,
+                                 hipblasSideMode_t  side,
+                                 hipblasFillMode_t  uplo,
+                                 hipblasOperation_t transA,
+                                 hipblasDiagType_t  diag,
+                                 int64_t            m,
+                                 int64_t            n,
+                                 const void*        alpha,
+                                 const void*        A,
+                                 hipDataType        dataType,
+                                 int64_t            lda,
+                                 hipblasStride      strideA,
+                                 void*              B,
+                                 int64_t            ldb,
+                                 hipblasStride      strideB,
+                                 int64_t            batchCount,
+                                 bool               batched)
+try
+{
+    // The backend can't read the interleaved layout, so its calls are all taken
+    if(!batched && hipblasIsInterleavedBatch(handle))
+        return hipblasInterleavedTrsm(handle,
+                                      side,
+                                      uplo,
+                                      transA,
+                                      diag,
+                                      m,
+                                      n,
+                                      alpha,
+                                      A,
+                                      dataType,
+                                      lda,
+                                      strideA,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      batchCount);
+
+    if(!handle || !hipblas_small_trsm_enabled() || !hipblas_small_trsm_valid(uplo, transA, diag)
+       || (side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // Empty problems and the quick returns of the backend stay with the backend
+    bool    left  = side == HIPBLAS_SIDE_LEFT;
+    int64_t order = left ? m : n;
+    if(m < 1 || n < 1 || order > hipblas_small_trsm_max || n > INT32_MAX
+       || batchCount < hipblas_small_trsm_min_batch)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(lda < order || ldb < m || !alpha || !A || !B)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // X op(A) = alpha B is op(A)^T X^T = alpha B^T, and op(A) is op(A)^T transposed
+    hipblas_small_trsm_problem problem;
+    problem.order       = int(order);
+    problem.rhs         = int(left ? n : m);
+    problem.transposed  = (transA != HIPBLAS_OP_N) == left;
+    problem.conj        = transA == HIPBLAS_OP_C;
+    problem.reversed    = (uplo == HIPBLAS_FILL_MODE_LOWER) == problem.transposed;
+    problem.unit        = diag == HIPBLAS_DIAG_UNIT;
+    problem.A           = A;
+    problem.lda         = lda;
+    problem.strideA     = strideA;
+    problem.B           = B;
+    problem.offset      = 0;
+    problem.inc         = left ? 1 : ldb;
+    problem.ld          = left ? ldb : 1;
+    problem.strideB     = strideB;
+    problem.batched     = batched;
+    problem.batch_count = batchCount;
+    return hipblas_small_trsm(handle, problem, alpha, dataType);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSmallTrsv(hipblasHandle_t    handle,
+                                 hipblasFillMode_t  uplo,
+                                 hipblasOperation_t transA,
+                                 hipblasDiagType_t  diag,
+                                 int64_t            n,
+                                 const void*        A,
+                                 hipDataType        dataType,
+                                 int64_t            lda,
+                                 hipblasStride      strideA,
+                                 void*              x,
+                                 int64_t            incx,
+                                 hipblasStride      stridex,
+                                 int64_t            batchCount,
+                                 bool               batched)
+try
+{
+    if(!handle || !hipblas_small_trsm_enabled() || !hipblas_small_trsm_valid(uplo, transA, diag))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    if(n < 1 || n > hipblas_small_trsm_max || batchCount < hipblas_small_trsm_min_batch)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(lda < n || !incx || !A || !x)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // x runs backwards from its end when incx is negative
+    hipblas_small_trsm_problem problem;
+    problem.order       = int(n);
+    problem.rhs         = 1;
+    problem.transposed  = transA != HIPBLAS_OP_N;
+    problem.conj        = transA == HIPBLAS_OP_C;
+    problem.reversed    = (uplo == HIPBLAS_FILL_MODE_LOWER) == problem.transposed;
+    problem.unit        = diag == HIPBLAS_DIAG_UNIT;
+    problem.A           = A;
+    problem.lda         = lda;
+    problem.strideA     = strideA;
+    problem.B           = x;
+    problem.offset      = incx < 0 ? (1 - n) * incx : 0;
+    problem.inc         = incx;
+    problem.ld          = 0;
+    problem.strideB     = stridex;
+    problem.batched     = batched;
+    problem.batch_count = batchCount;
+    return hipblas_small_trsm(handle, problem, nullptr, dataType);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
@@ -0,0 +1,921 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include "exceptions.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_entry.hpp"
+
+// The tall-skinny QR factorizations hipblas?geqrfTallSkinny, built on the public geqrfBatched,
+// syrk, herk, potrf, trsm and trmm of hipBLAS, so they are the same for both backends. Only the
+// copies between the row blocks are hipBLAS kernels.
+//
+// TSQR computes R by a tree reduction: the rows of A are split into blocks of mb = 8 * n rows
+// that are factored by one geqrfBatched, the R of the blocks are stacked into the blocks of the
+// next level, and so on until one block is left. A is processed in chunks of rows so that the
+// workspace doesn't grow with m, and the R of the chunks are reduced the same way. hipBLAS has
+// no orgqr, so the explicit Q is formed as A * R^-1, and A is orthogonalized a second time the
+// same way so that Q is orthogonal to working precision for cond(A) up to about 1 / eps.
+//
+// CholeskyQR2 computes R from the Cholesky factor of the Gram matrix A^H * A, so nearly all of
+// its work is in syrk and trsm, and repeats it once. It needs cond(A) below about eps^-1/2.
+
+#ifdef __HIP_PLATFORM_SOLVER__
+
+namespace
+{
+    constexpr int hipblas_tsqr_block = 256;
+
+    // The rows of a block are hipblas_tsqr_block_factor times the number of columns, and a chunk
+    // of A holds at most hipblas_tsqr_chunk_blocks blocks
+    constexpr int hipblas_tsqr_block_factor = 8;
+    constexpr int hipblas_tsqr_chunk_blocks = 2048;
+
+    // The parts of the workspace are padded so that the next one stays aligned
+    constexpr size_t hipblas_tsqr_align = 256;
+
+    size_t hipblas_tsqr_pad(size_t bytes)
+    {
+        return (bytes + hipblas_tsqr_align - 1) / hipblas_tsqr_align * hipblas_tsqr_align;
+    }
+
+    int64_t hipblas_tsqr_round_up(int64_t x, int64_t multiple)
+    {
+        return (x + multiple - 1) / multiple * multiple;
+    }
+
+    __device__ inline bool hipblas_tsqr_is_zero(float x)
+    {
+        return x == 0;
+    }
+
+    __device__ inline bool hipblas_tsqr_is_zero(double x)
+    {
+        return x == 0;
+    }
+
+    __device__ inline bool hipblas_tsqr_is_zero(hipFloatComplex x)
+    {
+        return hipCrealf(x) == 0 && hipCimagf(x) == 0;
+    }
+
+    __device__ inline bool hipblas_tsqr_is_zero(hipDoubleComplex x)
+    {
+        return hipCreal(x) == 0 && hipCimag(x) == 0;
+    }
+
+    // In block layout a stack of rows is kept as blocks of mb rows, each an mb-by-n matrix with
+    // a leading dimension of mb, one after the other. B := the first rows rows of A in block
+    // layout, where the rows of A from valid on are zero.
+    template <typename T>
+    __global__ void hipblasTsqrPackKernel(
+        int64_t rows, int n, int64_t valid, const T* A, int lda, T* B, int mb)
+    {
+        int64_t tid = blockIdx.x * int64_t(blockDim.x) + threadIdx.x;
+        if(tid >= rows * n)
+            return;
+        int64_t i = tid % rows;
+        int     j = tid / rows;
+
+        T* b = B + (i / mb) * int64_t(mb) * n + i % mb + j * int64_t(mb);
+        *b   = i < valid ? A[i + j * int64_t(lda)] : T();
+    }
+
+    // Row r of the rows-by-n matrix B := row r % n of the upper triangle of block r / n of the
+    // p blocks of S in block layout, and zero past them. The rows of B are in blocks of dmb
+    // rows, ldb apart, and dstride from one block to the next.
+    template <typename T>
+    __global__ void hipblasTsqrStackKernel(
+        int64_t rows, int n, const T* S, int mb, int p, T* B, int dmb, int ldb, int64_t dstride)
+    {
+        int64_t tid = blockIdx.x * int64_t(blockDim.x) + threadIdx.x;
+        if(tid >= rows * n)
+            return;
+        int64_t r  = tid % rows;
+        int     j  = tid / rows;
+        int64_t k  = r / n;
+        int     rr = r % n;
+
+        T* b = B + (r / dmb) * dstride + r % dmb + j * int64_t(ldb);
+        *b   = k < p && rr <= j ? S[k * int64_t(mb) * n + rr + j * int64_t(mb)] : T();
+    }
+
+    // ptrs[i] := base + i * stride, for the pointer arrays of geqrfBatched
+    template <typename T>
+    __global__ void hipblasTsqrPointersKernel(int count, T* base, int64_t stride, T** ptrs)
+    {
+        int64_t tid = blockIdx.x * int64_t(blockDim.x) + threadIdx.x;
+        if(tid < count)
+            ptrs[tid] = base + tid * stride;
+    }
+
+    // *info := the first zero on the diagonal of the n-by-n matrix R, or 0, by one thread
+    template <typename T>
+    __global__ void hipblasTsqrDiagonalKernel(int n, const T* R, int ldr, int* info)
+    {
+        int j = 0;
+        while(j < n && !hipblas_tsqr_is_zero(R[j + j * int64_t(ldr)]))
+            j++;
+        *info = j < n ? j + 1 : 0;
+    }
+
+    // *info := *info2 unless the first factorization failed
+    __global__ void hipblasTsqrInfoKernel(int* info, const int* info2)
+    {
+        if(*info == 0)
+            *info = *info2;
+    }
+
+    template <typename T>
+    T hipblas_tsqr_one()
+    {
+        return T(1);
+    }
+
+    template <>
+    hipFloatComplex hipblas_tsqr_one<hipFloatComplex>()
+    {
+        return make_hipFloatComplex(1, 0);
+    }
+
+    template <>
+    hipDoubleComplex hipblas_tsqr_one<hipDoubleComplex>()
+    {
+        return make_hipDoubleComplex(1, 0);
+    }
+
+    // The hipBLAS functions for precision T
+    hipblasStatus_t hipblas_tsqr_geqrf(hipblasHandle_t handle,
+                                       int             m,
+                                       int             n,
+                                       float* const    A[],
+                                       int             lda,
+                                       float* const    tau[],
+                                       int*            info,
+                                       int             batch_count)
+    {
+        return hipblasSgeqrfBatched(handle, m, n, A, lda, tau, info, batch_count);
+    }
+
+    hipblasStatus_t hipblas_tsqr_geqrf(hipblasHandle_t handle,
+                                       int             m,
+                                       int             n,
+                                       double* const   A[],
+                                       int             lda,
+                                       double* const   tau[],
+                                       int*            info,
+                                       int             batch_count)
+    {
+        return hipblasDgeqrfBatched(handle, m, n, A, lda, tau, info, batch_count);
+    }
+
+    hipblasStatus_t hipblas_tsqr_geqrf(hipblasHandle_t        handle,
+                                       int                    m,
+                                       int                    n,
+                                       hipFloatComplex* const A[],
+                                       int                    lda,
+                                       hipFloatComplex* const tau[],
+                                       int*                   info,
+                                       int                    batch_count)
+    {
+        return hipblasCgeqrfBatched_v2(handle, m, n, A, lda, tau, info, batch_count);
+    }
+
+    hipblasStatus_t hipblas_tsqr_geqrf(hipblasHandle_t         handle,
+                                       int                     m,
+                                       int                     n,
+                                       hipDoubleComplex* const A[],
+                                       int                     lda,
+                                       hipDoubleComplex* const tau[],
+                                       int*                    info,
+                                       int                     batch_count)
+    {
+        return hipblasZgeqrfBatched_v2(handle, m, n, A, lda, tau, info, batch_count);
+    }
+
+    // The upper triangle of G := A^H * A for the m-by-n matrix A
+    hipblasStatus_t
+        hipblas_tsqr_gram(hipblasHandle_t handle, int m, int n, const float* A, int lda, float* G)
+    {
+        const float one = 1, zero = 0;
+        return hipblasSsyrk(
+            handle, HIPBLAS_FILL_MODE_UPPER, HIPBLAS_OP_T, n, m, &one, A, lda, &zero, G, n);
+    }
+
+    hipblasStatus_t hipblas_tsqr_gram(
+        hipblasHandle_t handle, int m, int n, const double* A, int lda, double* G)
+    {
+        const double one = 1, zero = 0;
+        return hipblasDsyrk(
+            handle, HIPBLAS_FILL_MODE_UPPER, HIPBLAS_OP_T, n, m, &one, A, lda, &zero, G, n);
+    }
+
+    hipblasStatus_t hipblas_tsqr_gram(
+        hipblasHandle_t handle, int m, int n, const hipFloatComplex* A, int lda, hipFloatComplex* G)
+    {
+        const float one = 1, zero = 0;
+        return hipblasCherk_v2(
+            handle, HIPBLAS_FILL_MODE_UPPER, HIPBLAS_OP_C, n, m, &one, A, lda, &zero, G, n);
+    }
+
+    hipblasStatus_t hipblas_tsqr_gram(hipblasHandle_t         handle,
+                                      int                     m,
+                                      int                     n,
+                                      const hipDoubleComplex* A,
+                                      int                     lda,
+                                      hipDoubleComplex*       G)
+    {
+        const double one = 1, zero = 0;
+        return hipblasZherk_v2(
+            handle, HIPBLAS_FILL_MODE_UPPER, HIPBLAS_OP_C, n, m, &one, A, lda, &zero, G, n);
+    }
+
+    hipblasStatus_t hipblas_tsqr_potrf(hipblasHandle_t handle, int n, float* G, int* info)
+    {
+        return hipblasSpotrf(handle, HIPBLAS_FILL_MODE_UPPER, n, G, n, info);
+    }
+
+    hipblasStatus_t hipblas_tsqr_potrf(hipblasHandle_t handle, int n, double* G, int* info)
+    {
+        return hipblasDpotrf(handle, HIPBLAS_FILL_MODE_UPPER, n, G, n, info);
+    }
+
+    hipblasStatus_t
+        hipblas_tsqr_potrf(hipblasHandle_t handle, int n, hipFloatComplex* G, int* info)
+    {
+        return hipblasCpotrf_v2(handle, HIPBLAS_FILL_MODE_UPPER, n, G, n, info);
+    }
+
+    hipblasStatus_t
+        hipblas_tsqr_potrf(hipblasHandle_t handle, int n, hipDoubleComplex* G, int* info)
+    {
+        return hipblasZpotrf_v2(handle, HIPBLAS_FILL_MODE_UPPER, n, G, n, info);
+    }
+
+    // A := A * R^-1 for the m-by-n matrix A and the n-by-n upper triangular R
+    template <typename T>
+    hipblasStatus_t
+        hipblas_tsqr_trsm(hipblasHandle_t handle, int m, int n, const T* R, int ldr, T* A, int lda)
+    {
+        const T one = hipblas_tsqr_one<T>();
+        if constexpr(std::is_same_v<T, float>)
+            return hipblasStrsm(handle,
+                                HIPBLAS_SIDE_RIGHT,
+                                HIPBLAS_FILL_MODE_UPPER,
+                                HIPBLAS_OP_N,
+                                HIPBLAS_DIAG_NON_UNIT,
+                                m,
+                                n,
+                                &one,
+                                R,
+                                ldr,
+                                A,
+                                lda);
+        else if constexpr(std::is_same_v<T, double>)
+            return hipblasDtrsm(handle,
+                                HIPBLAS_SIDE_RIGHT,
+                                HIPBLAS_FILL_MODE_UPPER,
+                                HIPBLAS_OP_N,
+                                HIPBLAS_DIAG_NON_UNIT,
+                                m,
+                                n,
+                                &one,
+                                R,
+                                ldr,
+                                A,
+                                lda);
+        else if constexpr(std::is_same_v<T, hipFloatComplex>)
+            return hipblasCtrsm_v2(handle,
+                                   HIPBLAS_SIDE_RIGHT,
+                                   HIPBLAS_FILL_MODE_UPPER,
+                                   HIPBLAS_OP_N,
+                                   HIPBLAS_DIAG_NON_UNIT,
+                                   m,
+                                   n,
+                                   &one,
+                                   R,
+                                   ldr,
+                                   A,
+                                   lda);
+        else
+            return hipblasZtrsm_v2(handle,
+                                   HIPBLAS_SIDE_RIGHT,
+                                   HIPBLAS_FILL_MODE_UPPER,
+                                   HIPBLAS_OP_N,
+                                   HIPBLAS_DIAG_NON_UNIT,
+                                   m,
+                                   n,
+                                   &one,
+                                   R,
+                                   ldr,
+                                   A,
+                                   lda);
+    }
+
+    // R := R2 * R1 for the n-by-n upper triangular R2 and R1, where R1 is zero below the
+    // diagonal
+    template <typename T>
+    hipblasStatus_t
+        hipblas_tsqr_trmm(hipblasHandle_t handle, int n, const T* R2, const T* R1, T* R, int ldr)
+    {
+        const T one = hipblas_tsqr_one<T>();
+        if constexpr(std::is_same_v<T, float>)
+            return hipblasStrmm(handle,
+                                HIPBLAS_SIDE_LEFT,
+                                HIPBLAS_FILL_MODE_UPPER,
+                                HIPBLAS_OP_N,
+                                HIPBLAS_DIAG_NON_UNIT,
+                                n,
+                                n,
+                                &one,
+                                R2,
+                                n,
+                                R1,
+                                n,
+                                R,
+                                ldr);
+        else if constexpr(std::is_same_v<T, double>)
+            return hipblasDtrmm(handle,
+                                HIPBLAS_SIDE_LEFT,
+                                HIPBLAS_FILL_MODE_UPPER,
+                                HIPBLAS_OP_N,
+                                HIPBLAS_DIAG_NON_UNIT,
+                                n,
+                                n,
+                                &one,
+                                R2,
+                                n,
+                                R1,
+                                n,
+                                R,
+                                ldr);
+        else if constexpr(std::is_same_v<T, hipFloatComplex>)
+            return hipblasCtrmm_v2(handle,
+                                   HIPBLAS_SIDE_LEFT,
+                                   HIPBLAS_FILL_MODE_UPPER,
+                                   HIPBLAS_OP_N,
+                                   HIPBLAS_DIAG_NON_UNIT,
+                                   n,
+                                   n,
+                                   &one,
+                                   R2,
+                                   n,
+                                   R1,
+                                   n,
+                                   R,
+                                   ldr);
+        else
+            return hipblasZtrmm_v2(handle,
+                                   HIPBLAS_SIDE_LEFT,
+                                   HIPBLAS_FILL_MODE_UPPER,
+                                   HIPBLAS_OP_N,
+                                   HIPBLAS_DIAG_NON_UNIT,
+                                   n,
+                                   n,
+                                   &one,
+                                   R2,
+                                   n,
+                                   R1,
+                                   n,
+                                   R,
+                                   ldr);
+    }
+
+    int hipblas_tsqr_blocks(int64_t elements)
+    {
+        return int((elements - 1) / hipblas_tsqr_block + 1);
+    }
+
+    hipblasStatus_t hipblas_tsqr_launched()
+    {
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+
+    // The layout of the workspace for an m-by-n matrix. Both algorithms keep the R1 and R2 of
+    // their two passes and the info of the second pass. TSQR also has the chunk X of A and the
+    // stack Y of the R of its blocks, which take turns as the levels of the reduction, the stack
+    // T of the R of the chunks, the Householder scalars and the pointer arrays of geqrfBatched.
+    template <typename T>
+    struct hipblasTsqrWorkspace
+    {
+        int64_t n, mb = 0, chunk_rows = 0, x_rows = 0, y_rows = 0, t_rows = 0, max_blocks = 0;
+        size_t  R_bytes, X_bytes = 0, Y_bytes = 0, T_bytes = 0, tau_bytes = 0, ptr_bytes = 0;
+
+        hipblasTsqrWorkspace(hipblasTallSkinnyQrAlgo_t algo, int64_t m, int64_t n)
+            : n(n)
+            , R_bytes(hipblas_tsqr_pad(sizeof(T) * n * n))
+        {
+            if(algo != HIPBLAS_TALL_SKINNY_QR_TSQR || !n)
+                return;
+
+            mb             = hipblas_tsqr_block_factor * n;
+            int64_t rows   = hipblas_tsqr_round_up(m, mb);
+            chunk_rows     = std::min(rows, hipblas_tsqr_chunk_blocks * mb);
+            int64_t chunks = (rows - 1) / chunk_rows + 1;
+            t_rows         = hipblas_tsqr_round_up(chunks * n, mb);
+            x_rows         = std::max(chunk_rows, next_rows(t_rows));
+            y_rows         = next_rows(chunk_rows);
+            max_blocks     = std::max({x_rows, y_rows, t_rows}) / mb;
+            X_bytes        = hipblas_tsqr_pad(sizeof(T) * x_rows * n);
+            Y_bytes        = hipblas_tsqr_pad(sizeof(T) * y_rows * n);
+            T_bytes        = hipblas_tsqr_pad(sizeof(T) * t_rows * n);
+            tau_bytes      = hipblas_tsqr_pad(sizeof(T) * max_blocks * n);
+            ptr_bytes      = hipblas_tsqr_pad(sizeof(T*) * max_blocks);
+        }
+
+        // The rows of the next level of the reduction, for a level of rows rows
+        int64_t next_rows(int64_t rows) const
+        {
+            return hipblas_tsqr_round_up(rows / mb * n, mb);
+        }
+
+        size_t size() const
+        {
+            return 2 * R_bytes + X_bytes + Y_bytes + T_bytes + tau_bytes + 4 * ptr_bytes
+                   + hipblas_tsqr_pad(sizeof(int));
+        }
+    };
+
+    hipblasStatus_t hipblas_tsqr_check(hipblasHandle_t           handle,
+                                       hipblasTallSkinnyQrAlgo_t algo,
+                                       int                       m,
+                                       int                       n,
+                                       int                       lda,
+                                       int                       ldr)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(algo != HIPBLAS_TALL_SKINNY_QR_TSQR && algo != HIPBLAS_TALL_SKINNY_QR_CHOLESKY_QR2)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(n < 0 || m < n || lda < std::max(1, m) || ldr < std::max(1, n))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblas_geqrf_tall_skinny_buffer_size(hipblasHandle_t           handle,
+                                                          hipblasTallSkinnyQrAlgo_t algo,
+                                                          int                       m,
+                                                          int                       n,
+                                                          int                       lda,
+                                                          int                       ldr,
+                                                          size_t*                   lwork_bytes)
+    {
+        hipblasStatus_t status = hipblas_tsqr_check(handle, algo, m, n, lda, ldr);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(lwork_bytes == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        *lwork_bytes = hipblasTsqrWorkspace<T>(algo, m, n).size();
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblas_geqrf_tall_skinny(hipblasHandle_t           handle,
+                                              hipblasTallSkinnyQrAlgo_t algo,
+                                              int                       m,
+                                              int                       n,
+                                              T*                        A,
+                                              int                       lda,
+                                              T*                        R,
+                                              int                       ldr,
+                                              void*                     workspace,
+                                              size_t                    lwork_bytes,
+                                              int*                      info)
+    {
+        hipblasStatus_t status = hipblas_tsqr_check(handle, algo, m, n, lda, ldr);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(info == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipblasTsqrWorkspace<T> layout(algo, m, n);
+        if((workspace == nullptr && n) || lwork_bytes < layout.size())
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(n && (A == nullptr || R == nullptr))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t stream;
+        status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        if(n == 0)
+            return hipMemsetAsync(info, 0, sizeof(int), stream) == hipSuccess
+                       ? HIPBLAS_STATUS_SUCCESS
+                       : HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        char* ws    = (char*)workspace;
+        T*    R1    = (T*)ws;
+        T*    R2    = (T*)(ws += layout.R_bytes);
+        T*    X     = (T*)(ws += layout.R_bytes);
+        T*    Y     = (T*)(ws += layout.X_bytes);
+        T*    Tb    = (T*)(ws += layout.Y_bytes);
+        T*    tau   = (T*)(ws += layout.T_bytes);
+        T**   Xp    = (T**)(ws += layout.tau_bytes);
+        T**   Yp    = (T**)(ws += layout.ptr_bytes);
+        T**   Tp    = (T**)(ws += layout.ptr_bytes);
+        T**   taup  = (T**)(ws += layout.ptr_bytes);
+        int*  info2 = (int*)(ws += layout.ptr_bytes);
+
+        // geqrfBatched reports its argument checks through info, which is a device pointer in
+        // HIPBLAS_INFO_MODE_DEVICE
+        int  host_info = 0;
+        int* qr_info   = hipblasIsDeviceInfoMode(handle) ? info2 : &host_info;
+
+        // The scalars of syrk, herk, trsm and trmm are on the host
+        hipblasPointerMode_t pointer_mode;
+        status = hipblasGetPointerMode(handle, &pointer_mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        int64_t mb = layout.mb;
+
+        // Reduces the stack b0 of rows rows in block layout to the R of its first block, which is
+        // left in *last, with b1 as the next level
+        auto reduce = [&](T* b0, T** p0, int64_t rows, T* b1, T** p1, T** last) {
+            while(true)
+            {
+                hipblasStatus_t status
+                    = hipblas_tsqr_geqrf(handle, mb, n, p0, mb, taup, qr_info, rows / mb);
+                if(status != HIPBLAS_STATUS_SUCCESS || rows == mb)
+                {
+                    *last = b0;
+                    return status;
+                }
+
+                int64_t next = layout.next_rows(rows);
+                hipblasTsqrStackKernel<T>
+                    <<<hipblas_tsqr_blocks(next * n), hipblas_tsqr_block, 0, stream>>>(
+                        next, n, b0, mb, rows / mb, b1, mb, mb, mb * n);
+                status = hipblas_tsqr_launched();
+                if(status != HIPBLAS_STATUS_SUCCESS)
+                    return status;
+                std::swap(b0, b1);
+                std::swap(p0, p1);
+                rows = next;
+            }
+        };
+
+        // Rout := the R of A, zero below the diagonal
+        auto tsqr = [&](T* Rout, int ldro) -> hipblasStatus_t {
+            if(hipMemsetAsync(Tb, 0, sizeof(T) * layout.t_rows * n, stream) != hipSuccess)
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+            int64_t         rows   = hipblas_tsqr_round_up(m, mb);
+            T*              last   = nullptr;
+            hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+            for(int64_t c0 = 0, k = 0; c0 < rows && status == HIPBLAS_STATUS_SUCCESS;
+                c0 += layout.chunk_rows, k++)
+            {
+                int64_t chunk = std::min(layout.chunk_rows, rows - c0);
+                hipblasTsqrPackKernel<T>
+                    <<<hipblas_tsqr_blocks(chunk * n), hipblas_tsqr_block, 0, stream>>>(
+                        chunk, n, std::min(chunk, m - c0), A + c0, lda, X, mb);
+                status = hipblas_tsqr_launched();
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = reduce(X, Xp, chunk, Y, Yp, &last);
+                if(status != HIPBLAS_STATUS_SUCCESS)
+                    return status;
+
+                // the R of chunk k are rows k * n of T, which are in one block
+                int64_t row = k * n;
+                hipblasTsqrStackKernel<T>
+                    <<<hipblas_tsqr_blocks(int64_t(n) * n), hipblas_tsqr_block, 0, stream>>>(
+                        n, n, last, mb, 1, Tb + row / mb * mb * n + row % mb, n, mb, 0);
+                status = hipblas_tsqr_launched();
+            }
+
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = reduce(Tb, Tp, layout.t_rows, X, Xp, &last);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            hipblasTsqrStackKernel<T>
+                <<<hipblas_tsqr_blocks(int64_t(n) * n), hipblas_tsqr_block, 0, stream>>>(
+                    n, n, last, mb, 1, Rout, n, ldro, 0);
+            return hipblas_tsqr_launched();
+        };
+
+        // Rout := the Cholesky factor of A^H * A, with its info in pass_info
+        auto cholesky = [&](T* Rout, int* pass_info) -> hipblasStatus_t {
+            hipblasStatus_t status = hipblas_tsqr_gram(handle, m, n, A, lda, Rout);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblas_tsqr_potrf(handle, n, Rout, pass_info);
+            return status;
+        };
+
+        if(algo == HIPBLAS_TALL_SKINNY_QR_TSQR)
+        {
+            hipblasTsqrPointersKernel<T>
+                <<<hipblas_tsqr_blocks(layout.x_rows / mb), hipblas_tsqr_block, 0, stream>>>(
+                    layout.x_rows / mb, X, mb * n, Xp);
+            hipblasTsqrPointersKernel<T>
+                <<<hipblas_tsqr_blocks(layout.y_rows / mb), hipblas_tsqr_block, 0, stream>>>(
+                    layout.y_rows / mb, Y, mb * n, Yp);
+            hipblasTsqrPointersKernel<T>
+                <<<hipblas_tsqr_blocks(layout.t_rows / mb), hipblas_tsqr_block, 0, stream>>>(
+                    layout.t_rows / mb, Tb, mb * n, Tp);
+            hipblasTsqrPointersKernel<T>
+                <<<hipblas_tsqr_blocks(layout.max_blocks), hipblas_tsqr_block, 0, stream>>>(
+                    layout.max_blocks, tau, n, taup);
+            status = hipblas_tsqr_launched();
+
+            // A := A * R1^-1 * R2^-1 for the R1 of A and the R2 of A * R1^-1
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = tsqr(R1, n);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblas_tsqr_trsm(handle, m, n, R1, n, A, lda);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = tsqr(R2, n);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblas_tsqr_trsm(handle, m, n, R2, n, A, lda);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblas_tsqr_trmm(handle, n, R2, R1, R, ldr);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+            {
+                // R is singular if and only if R1 or R2 is
+                hipblasTsqrDiagonalKernel<T><<<1, 1, 0, stream>>>(n, R, ldr, info);
+                status = hipblas_tsqr_launched();
+            }
+        }
+        else
+        {
+            // R1 is zero below the diagonal for trmm. syrk and herk only write the upper
+            // triangle.
+            if(hipMemsetAsync(R1, 0, sizeof(T) * n * n, stream) != hipSuccess)
+                status = HIPBLAS_STATUS_EXECUTION_FAILED;
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = cholesky(R1, info);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblas_tsqr_trsm(handle, m, n, R1, n, A, lda);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = cholesky(R2, info2);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblas_tsqr_trsm(handle, m, n, R2, n, A, lda);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblas_tsqr_trmm(handle, n, R2, R1, R, ldr);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+            {
+                hipblasTsqrInfoKernel<<<1, 1, 0, stream>>>(info, info2);
+                status = hipblas_tsqr_launched();
+            }
+        }
+
+        hipblasStatus_t mode_status = hipblasSetPointerMode(handle, pointer_mode);
+        return status != HIPBLAS_STATUS_SUCCESS ? status : mode_status;
+    }
+}
+
+extern "C" hipblasStatus_t hipblasSgeqrfTallSkinny_bufferSize(hipblasHandle_t           handle,
+                                                              hipblasTallSkinnyQrAlgo_t algo,
+                                                              const int                 m,
+                                                              const int                 n,
+                                                              const int                 lda,
+                                                              const int                 ldr,
+                                                              size_t*                   lworkBytes)
+try
+{
+    return hipblas_geqrf_tall_skinny_buffer_size<float>(handle, algo, m, n, lda, ldr, lworkBytes);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgeqrfTallSkinny_bufferSize(hipblasHandle_t           handle,
+                                                              hipblasTallSkinnyQrAlgo_t algo,
+                                                              const int                 m,
+                                                              const int                 n,
+                                                              const int                 lda,
+                                                              const int                 ldr,
+                                                              size_t*                   lworkBytes)
+try
+{
+    return hipblas_geqrf_tall_skinny_buffer_size<double>(handle, algo, m, n, lda, ldr, lworkBytes);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgeqrfTallSkinny_bufferSize(hipblasHandle_t           handle,
+                                                              hipblasTallSkinnyQrAlgo_t algo,
+                                                              const int                 m,
+                                                              const int                 n,
+                                                              const int                 lda,
+                                                              const int                 ldr,
+                                                              size_t*                   lworkBytes)
+try
+{
+    return hipblas_geqrf_tall_skinny_buffer_size<hipFloatComplex>(
+        handle, algo, m, n, lda, ldr, lworkBytes);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgeqrfTallSkinny_bufferSize(hipblasHandle_t           handle,
+                                                              hipblasTallSkinnyQrAlgo_t algo,
+                                                              const int                 m,
+                                                              const int                 n,
+                                                              const int                 lda,
+                                                              const int                 ldr,
+                                                              size_t*                   lworkBytes)
+try
+{
+    return hipblas_geqrf_tall_skinny_buffer_size<hipDoubleComplex>(
+        handle, algo, m, n, lda, ldr, lworkBytes);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasSgeqrfTallSkinny(hipblasHandle_t           handle,
+                                                   hipblasTallSkinnyQrAlgo_t algo,
+                                                   const int                 m,
+                                                   const int                 n,
+                                                   float*                    A,
+                                                   const int                 lda,
+                                                   float*                    R,
+                                                   const int                 ldr,
+                                                   void*                     workspace,
+                                                   const size_t              lworkBytes,
+                                                   int*                      info)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, ldr);
+
+    return hipblas_geqrf_tall_skinny<float>(
+        handle, algo, m, n, A, lda, R, ldr, workspace, lworkBytes, info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgeqrfTallSkinny(hipblasHandle_t           handle,
+                                                   hipblasTallSkinnyQrAlgo_t algo,
+                                                   const int                 m,
+                                                   const int                 n,
+                                                   double*                   A,
+                                                   const int                 lda,
+                                                   double*                   R,
+                                                   const int                 ldr,
+                                                   void*                     workspace,
+                                                   const size_t              lworkBytes,
+                                                   int*                      info)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, ldr);
+
+    return hipblas_geqrf_tall_skinny<double>(
+        handle, algo, m, n, A, lda, R, ldr, workspace, lworkBytes, info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgeqrfTallSkinny(hipblasHandle_t           handle,
+                                                   hipblasTallSkinnyQrAlgo_t algo,
+                                                   const int                 m,
+                                                   const int                 n,
+                                                   hipblasComplex*           A,
+                                                   const int                 lda,
+                                                   hipblasComplex*           R,
+                                                   const int                 ldr,
+                                                   void*                     workspace,
+                                                   const size_t              lworkBytes,
+                                                   int*                      info)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, ldr);
+
+    return hipblas_geqrf_tall_skinny<hipFloatComplex>(handle,
+                                                      algo,
+                                                      m,
+                                                      n,
+                                                      (hipFloatComplex*)A,
+                                                      lda,
+                                                      (hipFloatComplex*)R,
+                                                      ldr,
+                                                      workspace,
+                                                      lworkBytes,
+                                                      info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgeqrfTallSkinny(hipblasHandle_t           handle,
+                                                   hipblasTallSkinnyQrAlgo_t algo,
+                                                   const int                 m,
+                                                   const int                 n,
+                                                   hipblasDoubleComplex*     A,
+                                                   const int                 lda,
+                                                   hipblasDoubleComplex*     R,
+                                                   const int                 ldr,
+                                                   void*                     workspace,
+                                                   const size_t              lworkBytes,
+                                                   int*                      info)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, ldr);
+
+    return hipblas_geqrf_tall_skinny<hipDoubleComplex>(handle,
+                                                       algo,
+                                                       m,
+                                                       n,
+                                                       (hipDoubleComplex*)A,
+                                                       lda,
+                                                       (hipDoubleComplex*)R,
+                                                       ldr,
+                                                       workspace,
+                                                       lworkBytes,
+                                                       info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgeqrfTallSkinny_v2(hipblasHandle_t           handle,
+                                                      hipblasTallSkinnyQrAlgo_t algo,
+                                                      const int                 m,
+                                                      const int                 n,
+                                                      hipComplex*               A,
+                                                      const int                 lda,
+                                                      hipComplex*               R,
+                                                      const int                 ldr,
+                                                      void*                     workspace,
+                                                      const size_t              lworkBytes,
+                                                      int*                      info)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, ldr);
+
+    return hipblas_geqrf_tall_skinny<hipFloatComplex>(
+        handle, algo, m, n, A, lda, R, ldr, workspace, lworkBytes, info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgeqrfTallSkinny_v2(hipblasHandle_t           handle,
+                                                      hipblasTallSkinnyQrAlgo_t algo,
+                                                      const int                 m,
+                                                      const int                 n,
+                                                      hipDoubleComplex*         A,
+                                                      const int                 lda,
+                                                      hipDoubleComplex*         R,
+                                                      const int                 ldr,
+                                                      void*                     workspace,
+                                                      const size_t              lworkBytes,
+                                                      int*                      info)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, ldr);
+
+    return hipblas_geqrf_tall_skinny<hipDoubleComplex>(
+        handle, algo, m, n, A, lda, R, ldr, workspace, lworkBytes, info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+#endif
@@ -0,0 +1,798 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_entry.hpp"
+
+// hipblasGemvVBatched, hipblasGemmVBatched and hipblasTrsmVBatched: batches of problems of
+// different sizes, with the sizes and leading dimensions in device arrays. Neither backend has
+// these, so they are kernels of hipBLAS. The sizes can't be read on the host without a
+// synchronization, so the grid is sized for the largest problem, from maxM and maxN, and the
+// blocks of a smaller problem that are past its end return at once; each block also loops over
+// the rest of a problem that is larger than the grid.
+
+namespace
+{
+    constexpr int hipblas_vbatched_threads   = 256;
+    constexpr int hipblas_vbatched_tile      = 32;
+    constexpr int hipblas_vbatched_tile_rows = 8;
+
+    template <typename T>
+    __device__ inline T hipblas_vbatched_fma(T a, T b, T c)
+    {
+        return a * b + c;
+    }
+
+    __device__ inline hipFloatComplex
+        hipblas_vbatched_fma(hipFloatComplex a, hipFloatComplex b, hipFloatComplex c)
+    {
+        return hipCfmaf(a, b, c);
+    }
+
+    __device__ inline hipDoubleComplex
+        hipblas_vbatched_fma(hipDoubleComplex a, hipDoubleComplex b, hipDoubleComplex c)
+    {
+        return hipCfma(a, b, c);
+    }
+
+    // c - a * b
+    template <typename T>
+    __device__ inline T hipblas_vbatched_fms(T a, T b, T c)
+    {
+        return c - a * b;
+    }
+
+    __device__ inline hipFloatComplex
+        hipblas_vbatched_fms(hipFloatComplex a, hipFloatComplex b, hipFloatComplex c)
+    {
+        return hipCsubf(c, hipCmulf(a, b));
+    }
+
+    __device__ inline hipDoubleComplex
+        hipblas_vbatched_fms(hipDoubleComplex a, hipDoubleComplex b, hipDoubleComplex c)
+    {
+        return hipCsub(c, hipCmul(a, b));
+    }
+
+    template <typename T>
+    __device__ inline T hipblas_vbatched_div(T a, T b)
+    {
+        return a / b;
+    }
+
+    __device__ inline hipFloatComplex hipblas_vbatched_div(hipFloatComplex a, hipFloatComplex b)
+    {
+        return hipCdivf(a, b);
+    }
+
+    __device__ inline hipDoubleComplex hipblas_vbatched_div(hipDoubleComplex a,
+                                                            hipDoubleComplex b)
+    {
+        return hipCdiv(a, b);
+    }
+
+    // Offset of element i of a vector of n elements with increment inc, which runs backwards
+    // from the end of the vector when inc is negative
+    __device__ inline int64_t hipblas_vbatched_offset(int i, int n, int inc)
+    {
+        return inc >= 0 ? int64_t(i) * inc : int64_t(n - 1 - i) * -inc;
+    }
+
+    // y_b := alpha * A_b * x_b + beta * y_b with a thread for each row of A_b. A_b and x_b
+    // aren't read when alpha is zero and y_b isn't read when beta is zero. The scalars are read
+    // from alpha and beta when they aren't nullptr, in device pointer mode, and are alpha_value
+    // and beta_value otherwise.
+    template <typename T>
+    __global__ void __launch_bounds__(hipblas_vbatched_threads)
+        hipblasGemvVBatchedNKernel(const int*      m,
+                                   const int*      n,
+                                   const T*        alpha,
+                                   T               alpha_value,
+                                   const T* const* A,
+                                   const int*      lda,
+                                   const T* const* x,
+                                   const int*      incx,
+                                   const T*        beta,
+                                   T               beta_value,
+                                   T* const*       y,
+                                   const int*      incy,
+                                   int             batch_count)
+    {
+        T    a      = alpha ? *alpha : alpha_value;
+        T    bt     = beta ? *beta : beta_value;
+        bool read_a = !hipblas_device_is_zero(a);
+        bool read_y = !hipblas_device_is_zero(bt);
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            int mb = m[b], nb = n[b];
+            if(mb <= 0 || nb <= 0)
+                continue;
+
+            const T* Ab  = A[b];
+            const T* xb  = x[b];
+            T*       yb  = y[b];
+            int64_t  ldb = lda[b];
+            int      ix = incx[b], iy = incy[b];
+
+            for(int i = blockIdx.x * blockDim.x + threadIdx.x; i < mb; i += gridDim.x * blockDim.x)
+            {
+                T sum{};
+                if(read_a)
+                    for(int j = 0; j < nb; j++)
+                        sum = hipblas_vbatched_fma(
+                            Ab[i + j * ldb], xb[hipblas_vbatched_offset(j, nb, ix)], sum);
+
+                T& yi = yb[hipblas_vbatched_offset(i, mb, iy)];
+                yi    = hipblas_device_axpby(a, sum, bt, read_y ? yi : T{});
+            }
+        }
+    }
+
+    // y_b := alpha * op(A_b) * x_b + beta * y_b for op(A_b) = A_b^T or A_b^H. Each row of the
+    // block computes an element of y_b, its threads reading consecutive elements of a column of
+    // A_b, and their sums are added in shared memory.
+    template <typename T>
+    __global__ void __launch_bounds__(hipblas_vbatched_threads)
+        hipblasGemvVBatchedTKernel(hipblasOperation_t trans,
+                                   const int*         m,
+                                   const int*         n,
+                                   const T*           alpha,
+                                   T                  alpha_value,
+                                   const T* const*    A,
+                                   const int*         lda,
+                                   const T* const*    x,
+                                   const int*         incx,
+                                   const T*           beta,
+                                   T                  beta_value,
+                                   T* const*          y,
+                                   const int*         incy,
+                                   int                batch_count)
+    {
+        __shared__ T sums[hipblas_vbatched_tile_rows][hipblas_vbatched_tile + 1];
+
+        T    a      = alpha ? *alpha : alpha_value;
+        T    bt     = beta ? *beta : beta_value;
+        bool read_a = !hipblas_device_is_zero(a);
+        bool read_y = !hipblas_device_is_zero(bt);
+        int  tx     = threadIdx.x;
+        int  ty     = threadIdx.y;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            int mb = m[b], nb = n[b];
+            if(mb <= 0 || nb <= 0)
+                continue;
+
+            const T* Ab  = A[b];
+            const T* xb  = x[b];
+            T*       yb  = y[b];
+            int64_t  ldb = lda[b];
+            int      ix = incx[b], iy = incy[b];
+
+            for(int j0 = blockIdx.x * hipblas_vbatched_tile_rows; j0 < nb;
+                j0 += gridDim.x * hipblas_vbatched_tile_rows)
+            {
+                int j = j0 + ty;
+                T   sum{};
+                if(read_a && j < nb)
+                    for(int i = tx; i < mb; i += hipblas_vbatched_tile)
+                    {
+                        T aij = Ab[i + j * ldb];
+                        if(trans == HIPBLAS_OP_C)
+                            aij = hipblas_device_conj(aij);
+                        sum = hipblas_vbatched_fma(
+                            aij, xb[hipblas_vbatched_offset(i, mb, ix)], sum);
+                    }
+                sums[ty][tx] = sum;
+                __syncthreads();
+
+                if(tx == 0 && j < nb)
+                {
+                    T one = hipblas_device_one<T>();
+                    for(int l = 1; l < hipblas_vbatched_tile; l++)
+                        sum = hipblas_vbatched_fma(one, sums[ty][l], sum);
+
+                    T& yj = yb[hipblas_vbatched_offset(j, nb, iy)];
+                    yj    = hipblas_device_axpby(a, sum, bt, read_y ? yj : T{});
+                }
+
+                // sums is reused by the next rows of y_b
+                __syncthreads();
+            }
+        }
+    }
+
+    // Loads the tile of op(X) at rows i0 and columns j0 into tile, with zeros past the rows by
+    // cols op(X), so that tile[r][c] is op(X)(i0 + r, j0 + c), read in columns of X
+    template <typename T>
+    __device__ inline void hipblas_vbatched_load_tile(T (*tile)[hipblas_vbatched_tile + 1],
+                                                      const T*           X,
+                                                      int64_t            ldx,
+                                                      hipblasOperation_t trans,
+                                                      int                rows,
+                                                      int                cols,
+                                                      int                i0,
+                                                      int                j0)
+    {
+        int tx = threadIdx.x;
+        for(int ty = threadIdx.y; ty < hipblas_vbatched_tile; ty += hipblas_vbatched_tile_rows)
+        {
+            if(trans == HIPBLAS_OP_N)
+            {
+                int i = i0 + tx, j = j0 + ty;
+                tile[tx][ty] = i < rows && j < cols ? X[i + j * ldx] : T{};
+            }
+            else
+            {
+                // op(X)(i, j) is X(j, i), with the row j running along the threads of a warp
+                int i = i0 + ty, j = j0 + tx;
+                T   x = i < rows && j < cols ? X[j + i * ldx] : T{};
+                tile[ty][tx] = trans == HIPBLAS_OP_C ? hipblas_device_conj(x) : x;
+            }
+        }
+    }
+
+    // C_b := alpha * op(A_b) * op(B_b) + beta * C_b, a 32 x 32 tile of C_b for each block with
+    // op(A_b) and op(B_b) read in tiles through shared memory. A_b and B_b aren't read when
+    // alpha is zero and C_b isn't read when beta is zero.
+    template <typename T>
+    __global__ void __launch_bounds__(hipblas_vbatched_threads)
+        hipblasGemmVBatchedKernel(hipblasOperation_t transA,
+                                  hipblasOperation_t transB,
+                                  const int*         m,
+                                  const int*         n,
+                                  const int*         k,
+                                  const T*           alpha,
+                                  T                  alpha_value,
+                                  const T* const*    A,
+                                  const int*         lda,
+                                  const T* const*    B,
+                                  const int*         ldb,
+                                  const T*           beta,
+                                  T                  beta_value,
+                                  T* const*          C,
+                                  const int*         ldc,
+                                  int                batch_count)
+    {
+        constexpr int tile  = hipblas_vbatched_tile;
+        constexpr int rows  = hipblas_vbatched_tile_rows;
+        constexpr int per_y = tile / rows;
+
+        __shared__ T tile_a[tile][tile + 1];
+        __shared__ T tile_b[tile][tile + 1];
+
+        T    a      = alpha ? *alpha : alpha_value;
+        T    bt     = beta ? *beta : beta_value;
+        bool read_a = !hipblas_device_is_zero(a);
+        bool read_c = !hipblas_device_is_zero(bt);
+        int  tx     = threadIdx.x;
+        int  ty     = threadIdx.y;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            int mb = m[b], nb = n[b], kb = k[b];
+            if(mb <= 0 || nb <= 0)
+                continue;
+
+            const T* Ab = A[b];
+            const T* Bb = B[b];
+            T*       Cb = C[b];
+
+            for(int i0 = blockIdx.x * tile; i0 < mb; i0 += gridDim.x * tile)
+                for(int j0 = blockIdx.y * tile; j0 < nb; j0 += gridDim.y * tile)
+                {
+                    T sum[per_y]{};
+                    for(int k0 = 0; read_a && k0 < kb; k0 += tile)
+                    {
+                        hipblas_vbatched_load_tile(tile_a, Ab, lda[b], transA, mb, kb, i0, k0);
+                        hipblas_vbatched_load_tile(tile_b, Bb, ldb[b], transB, kb, nb, k0, j0);
+                        __syncthreads();
+
+                        for(int l = 0; l < tile; l++)
+                            for(int r = 0; r < per_y; r++)
+                                sum[r] = hipblas_vbatched_fma(
+                                    tile_a[tx][l], tile_b[l][ty + r * rows], sum[r]);
+
+                        // the tiles are reloaded for the next columns of op(A_b)
+                        __syncthreads();
+                    }
+
+                    int64_t ldcb = ldc[b];
+                    for(int r = 0; r < per_y; r++)
+                    {
+                        int i = i0 + tx, j = j0 + ty + r * rows;
+                        if(i < mb && j < nb)
+                        {
+                            T& cij = Cb[i + j * ldcb];
+                            cij    = hipblas_device_axpby(a, sum[r], bt, read_c ? cij : T{});
+                        }
+                    }
+                }
+        }
+    }
+
+    // Solves op(A_b) * X = alpha * B_b or X * op(A_b) = alpha * B_b for X, which overwrites
+    // B_b, with a thread for each column of B_b on the left and each row on the right. Both
+    // are the triangular system M * x = alpha * b for a column or row b of B_b, where M is
+    // op(A_b) on the left and op(A_b)^T on the right, so that M(i, k) is A_b(k, i) when
+    // transposed is set, and is lower triangular when lower is set.
+    template <typename T>
+    __global__ void __launch_bounds__(hipblas_vbatched_threads)
+        hipblasTrsmVBatchedKernel(hipblasSideMode_t  side,
+                                  hipblasFillMode_t  uplo,
+                                  hipblasOperation_t transA,
+                                  hipblasDiagType_t  diag,
+                                  const int*         m,
+                                  const int*         n,
+                                  const T*           alpha,
+                                  T                  alpha_value,
+                                  const T* const*    A,
+                                  const int*         lda,
+                                  T* const*          B,
+                                  const int*         ldb,
+                                  int                batch_count)
+    {
+        T    a          = alpha ? *alpha : alpha_value;
+        bool left       = side == HIPBLAS_SIDE_LEFT;
+        bool transposed = (transA != HIPBLAS_OP_N) == left;
+        bool lower      = (uplo == HIPBLAS_FILL_MODE_LOWER) != transposed;
+        bool conj       = transA == HIPBLAS_OP_C;
+        bool unit       = diag == HIPBLAS_DIAG_UNIT;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            int mb = m[b], nb = n[b];
+            if(mb <= 0 || nb <= 0)
+                continue;
+
+            const T* Ab    = A[b];
+            int64_t  ldab  = lda[b];
+            int64_t  ldbb  = ldb[b];
+            int      order = left ? mb : nb;
+            int      count = left ? nb : mb;
+
+            // M(i, k) of the system
+            auto M = [=](int i, int k) {
+                T x = transposed ? Ab[k + i * ldab] : Ab[i + k * ldab];
+                return conj ? hipblas_device_conj(x) : x;
+            };
+
+            for(int t = blockIdx.x * blockDim.x + threadIdx.x; t < count;
+                t += gridDim.x * blockDim.x)
+            {
+                // element e of the column or row t of B_b is xt[e * step]
+                T*      xt   = left ? B[b] + t * ldbb : B[b] + t;
+                int64_t step = left ? 1 : ldbb;
+
+                if(hipblas_device_is_zero(a))
+                {
+                    for(int e = 0; e < order; e++)
+                        xt[e * step] = T{};
+                    continue;
+                }
+
+                for(int s = 0; s < order; s++)
+                {
+                    // forward substitution for lower M and backward for upper M
+                    int i   = lower ? s : order - 1 - s;
+                    T   sum = hipblas_vbatched_fma(a, xt[i * step], T{});
+                    if(lower)
+                        for(int l = 0; l < i; l++)
+                            sum = hipblas_vbatched_fms(M(i, l), xt[l * step], sum);
+                    else
+                        for(int l = i + 1; l < order; l++)
+                            sum = hipblas_vbatched_fms(M(i, l), xt[l * step], sum);
+                    xt[i * step] = unit ? sum : hipblas_vbatched_div(sum, M(i, i));
+                }
+            }
+        }
+    }
+
+    // The scalars of a launch, read on the host in host pointer mode and passed to the kernel
+    // by value, or left on the device for the kernel to read
+    template <typename T>
+    struct hipblas_vbatched_scalar
+    {
+        const T* device;
+        T        value;
+
+        hipblas_vbatched_scalar(const void* scalar, bool host_scalars)
+            : device(host_scalars ? nullptr : static_cast<const T*>(scalar))
+            , value(host_scalars ? *static_cast<const T*>(scalar) : T{})
+        {
+        }
+    };
+
+    // Blocks of a grid for count threads or tiles of size, and batches in the z dimension
+    dim3 hipblas_vbatched_grid(int count_x, int size_x, int count_y, int size_y, int batch_count)
+    {
+        return dim3((count_x - 1) / size_x + 1,
+                    (count_y - 1) / size_y + 1,
+                    std::min(batch_count, 65535));
+    }
+
+    template <typename T>
+    hipError_t hipblas_gemv_vbatched_launch(hipblasOperation_t trans,
+                                            const int*         m,
+                                            const int*         n,
+                                            int                max_m,
+                                            int                max_n,
+                                            const void*        alpha,
+                                            bool               host_scalars,
+                                            const void* const* A,
+                                            const int*         lda,
+                                            const void* const* x,
+                                            const int*         incx,
+                                            const void*        beta,
+                                            void* const*       y,
+                                            const int*         incy,
+                                            int                batch_count,
+                                            hipStream_t        stream)
+    {
+        hipblas_vbatched_scalar<T> a(alpha, host_scalars), bt(beta, host_scalars);
+        if(trans == HIPBLAS_OP_N)
+        {
+            dim3 grid = hipblas_vbatched_grid(max_m, hipblas_vbatched_threads, 1, 1, batch_count);
+            hipblasGemvVBatchedNKernel<T>
+                <<<grid, hipblas_vbatched_threads, 0, stream>>>(m,
+                                                                 n,
+                                                                 a.device,
+                                                                 a.value,
+                                                                 (const T* const*)A,
+                                                                 lda,
+                                                                 (const T* const*)x,
+                                                                 incx,
+                                                                 bt.device,
+                                                                 bt.value,
+                                                                 (T* const*)y,
+                                                                 incy,
+                                                                 batch_count);
+        }
+        else
+        {
+            dim3 grid
+                = hipblas_vbatched_grid(max_n, hipblas_vbatched_tile_rows, 1, 1, batch_count);
+            dim3 threads(hipblas_vbatched_tile, hipblas_vbatched_tile_rows);
+            hipblasGemvVBatchedTKernel<T><<<grid, threads, 0, stream>>>(trans,
+                                                                         m,
+                                                                         n,
+                                                                         a.device,
+                                                                         a.value,
+                                                                         (const T* const*)A,
+                                                                         lda,
+                                                                         (const T* const*)x,
+                                                                         incx,
+                                                                         bt.device,
+                                                                         bt.value,
+                                                                         (T* const*)y,
+                                                                         incy,
+                                                                         batch_count);
+        }
+        return hipGetLastError();
+    }
+
+    template <typename T>
+    hipError_t hipblas_gemm_vbatched_launch(hipblasOperation_t transA,
+                                            hipblasOperation_t transB,
+                                            const int*         m,
+                                            const int*         n,
+                                            const int*         k,
+                                            int                max_m,
+                                            int                max_n,
+                                            const void*        alpha,
+                                            bool               host_scalars,
+                                            const void* const* A,
+                                            const int*         lda,
+                                            const void* const* B,
+                                            const int*         ldb,
+                                            const void*        beta,
+                                            void* const*       C,
+                                            const int*         ldc,
+                                            int                batch_count,
+                                            hipStream_t        stream)
+    {
+        hipblas_vbatched_scalar<T> a(alpha, host_scalars), bt(beta, host_scalars);
+
+        dim3 grid = hipblas_vbatched_grid(
+            max_m, hipblas_vbatched_tile, max_n, hipblas_vbatched_tile, batch_count);
+        dim3 threads(hipblas_vbatched_tile, hipblas_vbatched_tile_rows);
+        hipblasGemmVBatchedKernel<T><<<grid, threads, 0, stream>>>(transA,
+                                                                    transB,
+                                                                    m,
+                                                                    n,
+                                                                    k,
+                                                                    a.device,
+                                                                    a.value,
+                                                                    (const T* const*)A,
+                                                                    lda,
+                                                                    (const T* const*)B,
+                                                                    ldb,
+                                                                    bt.device,
+                                                                    bt.value,
+                                                                    (T* const*)C,
+                                                                    ldc,
+                                                                    batch_count);
+        return hipGetLastError();
+    }
+
+    template <typename T>
+    hipError_t hipblas_trsm_vbatched_launch(hipblasSideMode_t  side,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            hipblasDiagType_t  diag,
+                                            const int*         m,
+                                            const int*         n,
+                                            int                max_m,
+                                            int                max_n,
+                                            const void*        alpha,
+                                            bool               host_scalars,
+                                            const void* const* A,
+                                            const int*         lda,
+                                            void* const*       B,
+                                            const int*         ldb,
+                                            int                batch_count,
+                                            hipStream_t        stream)
+    {
+        hipblas_vbatched_scalar<T> a(alpha, host_scalars);
+
+        int  count = side == HIPBLAS_SIDE_LEFT ? max_n : max_m;
+        dim3 grid  = hipblas_vbatched_grid(count, hipblas_vbatched_threads, 1, 1, batch_count);
+        hipblasTrsmVBatchedKernel<T>
+            <<<grid, hipblas_vbatched_threads, 0, stream>>>(side,
+                                                             uplo,
+                                                             transA,
+                                                             diag,
+                                                             m,
+                                                             n,
+                                                             a.device,
+                                                             a.value,
+                                                             (const T* const*)A,
+                                                             lda,
+                                                             (T* const*)B,
+                                                             ldb,
+                                                             batch_count);
+        return hipGetLastError();
+    }
+
+    // Calls launch<T> with the type T of dataType and returns its status, or NOT_SUPPORTED for
+    // the types without kernels
+    template <typename F>
+    hipblasStatus_t hipblas_vbatched_dispatch(hipblasHandle_t handle, hipDataType type, F launch)
+    {
+        hipStream_t          stream;
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS
+           || (status = hipblasGetPointerMode(handle, &mode)) != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        bool       host_scalars = mode != HIPBLAS_POINTER_MODE_DEVICE;
+        hipError_t error;
+        switch(type)
+        {
+        case HIP_R_32F:
+            error = launch(float{}, host_scalars, stream);
+            break;
+        case HIP_R_64F:
+            error = launch(double{}, host_scalars, stream);
+            break;
+        case HIP_C_32F:
+            error = launch(hipFloatComplex{}, host_scalars, stream);
+            break;
+        case HIP_C_64F:
+            error = launch(hipDoubleComplex{}, host_scalars, stream);
+            break;
+        default:
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        }
+        return error == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    bool hipblas_vbatched_valid_trans(hipblasOperation_t trans)
+    {
+        return trans == HIPBLAS_OP_N || trans == HIPBLAS_OP_T || trans == HIPBLAS_OP_C;
+    }
+}
+
+extern "C" hipblasStatus_t hipblasGemvVBatched(hipblasHandle_t    handle,
+                                               hipblasOperation_t trans,
+                                               const int*         m,
+                                               const int*         n,
+                                               int                maxM,
+                                               int                maxN,
+                                               const void*        alpha,
+                                               const void* const  A[],
+                                               const int*         lda,
+                                               const void* const  x[],
+                                               const int*         incx,
+                                               const void*        beta,
+                                               void* const        y[],
+                                               const int*         incy,
+                                               int                batchCount,
+                                               hipDataType        dataType)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, maxM, maxN, batchCount, dataType);
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!hipblas_vbatched_valid_trans(trans))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(maxM < 0 || maxN < 0 || batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!maxM || !maxN || !batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!m || !n || !alpha || !A || !lda || !x || !incx || !beta || !y || !incy)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblas_vbatched_dispatch(
+        handle, dataType, [&](auto type, bool host_scalars, hipStream_t stream) {
+            return hipblas_gemv_vbatched_launch<decltype(type)>(trans,
+                                                                m,
+                                                                n,
+                                                                maxM,
+                                                                maxN,
+                                                                alpha,
+                                                                host_scalars,
+                                                                A,
+                                                                lda,
+                                                                x,
+                                                                incx,
+                                                                beta,
+                                                                y,
+                                                                incy,
+                                                                batchCount,
+                                                                stream);
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasGemmVBatched(hipblasHandle_t    handle,
+                                               hipblasOperation_t transA,
+                                               hipblasOperation_t transB,
+                                               const int*         m,
+                                               const int*         n,
+                                               const int*         k,
+                                               int                maxM,
+                                               int                maxN,
+                                               const void*        alpha,
+                                               const void* const  A[],
+                                               const int*         lda,
+                                               const void* const  B[],
+                                               const int*         ldb,
+                                               const void*        beta,
+                                               void* const        C[],
+                                               const int*         ldc,
+                                               int                batchCount,
+                                               hipDataType        dataType)
+try
+{
+    HIPBLAS_ENTRY(handle, transA, transB, maxM, maxN, batchCount, dataType);
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!hipblas_vbatched_valid_trans(transA) || !hipblas_vbatched_valid_trans(transB))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(maxM < 0 || maxN < 0 || batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!maxM || !maxN || !batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!m || !n || !k || !alpha || !A || !lda || !B || !ldb || !beta || !C || !ldc)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblas_vbatched_dispatch(
+        handle, dataType, [&](auto type, bool host_scalars, hipStream_t stream) {
+            return hipblas_gemm_vbatched_launch<decltype(type)>(transA,
+                                                                transB,
+                                                                m,
+                                                                n,
+                                                                k,
+                                                                maxM,
+                                                                maxN,
+                                                                alpha,
+                                                                host_scalars,
+                                                                A,
+                                                                lda,
+                                                                B,
+                                                                ldb,
+                                                                beta,
+                                                                C,
+                                                                ldc,
+                                                                batchCount,
+                                                                stream);
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasTrsmVBatched(hipblasHandle_t    handle,
+                                               hipblasSideMode_t  side,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               const int*         m,
+                                               const int*         n,
+                                               int                maxM,
+                                               int                maxN,
+                                               const void*        alpha,
+                                               const void* const  A[],
+                                               const int*         lda,
+                                               void* const        B[],
+                                               const int*         ldb,
+                                               int                batchCount,
+                                               hipDataType        dataType)
+try
+{
+    HIPBLAS_ENTRY(handle, side, uplo, transA, diag, maxM, maxN, batchCount, dataType);
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if((side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+       || (uplo != HIPBLAS_FILL_MODE_LOWER && uplo != HIPBLAS_FILL_MODE_UPPER)
+       || !hipblas_vbatched_valid_trans(transA)
+       || (diag != HIPBLAS_DIAG_UNIT && diag != HIPBLAS_DIAG_NON_UNIT))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(maxM < 0 || maxN < 0 || batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!maxM || !maxN || !batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!m || !n || !alpha || !A || !lda || !B || !ldb)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblas_vbatched_dispatch(
+        handle, dataType, [&](auto type, bool host_scalars, hipStream_t stream) {
+            return hipblas_trsm_vbatched_launch<decltype(type)>(side,
+                                                                uplo,
+                                                                transA,
+                                                                diag,
+                                                                m,
+                                                                n,
+                                                                maxM,
+                                                                maxN,
+                                                                alpha,
+                                                                host_scalars,
+                                                                A,
+                                                                lda,
+                                                                B,
+                                                                ldb,
+                                                                batchCount,
+                                                                stream);
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
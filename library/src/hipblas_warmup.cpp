@@ -0,0 +1,217 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include "exceptions.hpp"
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_entry.hpp"
+
+// hipblasWarmup, built on the public gemmEx so it is the same for both backends. Running a
+// problem once is what makes the backend load its kernels and select its solution, so each
+// problem is computed on zero matrices of its shape.
+
+namespace
+{
+    size_t hipblas_warmup_type_size(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_8I:
+        case HIP_R_8U:
+            return 1;
+        case HIP_R_16F:
+        case HIP_R_16BF:
+        case HIP_C_8I:
+            return 2;
+        case HIP_R_32I:
+        case HIP_R_32F:
+            return 4;
+        case HIP_R_64F:
+        case HIP_C_32F:
+            return 8;
+        case HIP_C_64F:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+
+    // The bytes of the matrices of a problem, each padded so that the next stays aligned
+    struct hipblas_warmup_layout
+    {
+        int           lda, ldb, ldc;
+        hipblasStride stride_a, stride_b, stride_c;
+        size_t        offset_b, offset_c, bytes;
+    };
+
+    bool hipblas_warmup_layout_of(const hipblasWarmupProblem& p, hipblas_warmup_layout& layout)
+    {
+        size_t a_size = hipblas_warmup_type_size(p.aType);
+        size_t b_size = hipblas_warmup_type_size(p.bType);
+        size_t c_size = hipblas_warmup_type_size(p.cType);
+        if(!a_size || !b_size || !c_size || p.m < 0 || p.n < 0 || p.k < 0 || p.batchCount < 1)
+            return false;
+
+        bool a_n = p.transA == HIPBLAS_OP_N;
+        bool b_n = p.transB == HIPBLAS_OP_N;
+
+        layout.lda      = std::max(a_n ? p.m : p.k, 1);
+        layout.ldb      = std::max(b_n ? p.k : p.n, 1);
+        layout.ldc      = std::max(p.m, 1);
+        layout.stride_a = hipblasStride(layout.lda) * (a_n ? p.k : p.m);
+        layout.stride_b = hipblasStride(layout.ldb) * (b_n ? p.n : p.k);
+        layout.stride_c = hipblasStride(layout.ldc) * p.n;
+
+        size_t a_bytes  = a_size * layout.stride_a * p.batchCount;
+        size_t b_bytes  = b_size * layout.stride_b * p.batchCount;
+        size_t c_bytes  = c_size * layout.stride_c * p.batchCount;
+        layout.offset_b = hipblas_scratch_pad(a_bytes);
+        layout.offset_c = layout.offset_b + hipblas_scratch_pad(b_bytes);
+        layout.bytes    = layout.offset_c + c_bytes;
+        return true;
+    }
+
+    hipblasStatus_t hipblas_warmup_problem(hipblasHandle_t              handle,
+                                           const hipblasWarmupProblem&  p,
+                                           const hipblas_warmup_layout& layout,
+                                           char*                        data)
+    {
+        // a zero alpha would let the backend return early without loading anything
+        char one[16]  = {};
+        char zero[16] = {};
+        hipblas_scalar_one(p.computeType, one);
+
+        const void* A = data;
+        const void* B = data + layout.offset_b;
+        void*       C = data + layout.offset_c;
+
+        if(p.batchCount == 1)
+            return hipblasGemmEx_v2(handle,
+                                    p.transA,
+                                    p.transB,
+                                    p.m,
+                                    p.n,
+                                    p.k,
+                                    one,
+                                    A,
+                                    p.aType,
+                                    layout.lda,
+                                    B,
+                                    p.bType,
+                                    layout.ldb,
+                                    zero,
+                                    C,
+                                    p.cType,
+                                    layout.ldc,
+                                    p.computeType,
+                                    HIPBLAS_GEMM_DEFAULT);
+
+        return hipblasGemmStridedBatchedEx_v2(handle,
+                                              p.transA,
+                                              p.transB,
+                                              p.m,
+                                              p.n,
+                                              p.k,
+                                              one,
+                                              A,
+                                              p.aType,
+                                              layout.lda,
+                                              layout.stride_a,
+                                              B,
+                                              p.bType,
+                                              layout.ldb,
+                                              layout.stride_b,
+                                              zero,
+                                              C,
+                                              p.cType,
+                                              layout.ldc,
+                                              layout.stride_c,
+                                              p.batchCount,
+                                              p.computeType,
+                                              HIPBLAS_GEMM_DEFAULT);
+    }
+}
+
+extern "C" hipblasStatus_t hipblasWarmup(hipblasHandle_t             handle,
+                                         int                         problemCount,
+                                         const hipblasWarmupProblem* problems)
+try
+{
+    HIPBLAS_ENTRY(handle, problemCount);
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(problemCount < 0 || (problemCount && !problems))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // one allocation for the largest problem, zeroed once, as the results stay zero
+    size_t bytes = 0;
+    for(int i = 0; i < problemCount; i++)
+    {
+        hipblas_warmup_layout layout;
+        if(!hipblas_warmup_layout_of(problems[i], layout))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        bytes = std::max(bytes, layout.bytes);
+    }
+    if(!bytes)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status;
+    if((status = hipblasGetStreamForThread(handle, &stream)) != HIPBLAS_STATUS_SUCCESS
+       || (status = hipblasGetPointerMode(handle, &mode)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    char* data;
+    if(hipMalloc(&data, bytes) != hipSuccess)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    // the scalars are on the host
+    if(mode == HIPBLAS_POINTER_MODE_DEVICE)
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status == HIPBLAS_STATUS_SUCCESS && hipMemsetAsync(data, 0, bytes, stream) != hipSuccess)
+        status = HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    for(int i = 0; i < problemCount && status == HIPBLAS_STATUS_SUCCESS; i++)
+    {
+        hipblas_warmup_layout layout;
+        hipblas_warmup_layout_of(problems[i], layout);
+        status = hipblas_warmup_problem(handle, problems[i], layout, data);
+    }
+
+    if(hipStreamSynchronize(stream) != hipSuccess && status == HIPBLAS_STATUS_SUCCESS)
+        status = HIPBLAS_STATUS_EXECUTION_FAILED;
+    (void)hipFree(data);
+    if(mode == HIPBLAS_POINTER_MODE_DEVICE)
+        (void)hipblasSetPointerMode(handle, mode);
+    return status;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
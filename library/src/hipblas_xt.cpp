@@ -0,0 +1,1607 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <vector>
+
+#include "exceptions.hpp"
+
+// A multi-device context. Each device has a handle whose stream runs the gemms, a stream that
+// copies blocks in and a stream that copies tiles of C out, with two slots of device memory
+// for the blocks of A and B and two for the tiles of C. The copies of the next block overlap
+// the gemm of the current one, and the copy out of a tile overlaps the next tile.
+//
+// The strided batched functions split the batch between the devices in proportion to their
+// throughput, timed by the start and stop events around the share of each device in the last
+// batched call.
+struct hipblasXtContext
+{
+    struct device
+    {
+        int             id;
+        hipblasHandle_t handle = nullptr;
+
+        // copy in, gemm and copy out streams
+        hipStream_t streams[3] = {};
+
+        // a slot of A and B is loaded by the copy in stream and consumed by a gemm, a slot of C
+        // is loaded, done with by the gemms, then free once copied out. The gemms use two slots
+        // and the batched functions three, with loaded, c_done and c_free.
+        hipEvent_t loaded[3]   = {};
+        hipEvent_t consumed[3] = {};
+        hipEvent_t c_loaded[3] = {};
+        hipEvent_t c_done[3]   = {};
+        hipEvent_t c_free[3]   = {};
+
+        void*  buffer      = nullptr;
+        size_t buffer_size = 0;
+        int    slot        = 0;
+        int    batch_slot  = 0;
+
+        // timed events around the share of the device in the last batched call, of timed
+        // problems, and the problems per millisecond measured from them
+        hipEvent_t start      = nullptr;
+        hipEvent_t stop       = nullptr;
+        int        timed      = 0;
+        double     throughput = 0;
+    };
+
+    std::vector<device> devices;
+    int                 block_dim     = 2048;
+    size_t              memory_budget = 0;
+
+    // the stream set with hipblasXtSetStream, and an event of its device that the batched
+    // functions record on it to start after the work queued before them
+    hipStream_t stream        = nullptr;
+    hipEvent_t  stream_ready  = nullptr;
+    int         stream_device = 0;
+
+    ~hipblasXtContext()
+    {
+        release();
+        if(stream_ready)
+            (void)hipEventDestroy(stream_ready);
+    }
+
+    void release();
+};
+
+namespace
+{
+    // Sets the current device for a scope, restoring the previous one at its end
+    class hipblas_xt_device_guard
+    {
+        int  m_previous;
+        bool m_ok;
+
+    public:
+        explicit hipblas_xt_device_guard(int device)
+        {
+            m_ok = hipGetDevice(&m_previous) == hipSuccess
+                   && (m_previous == device || hipSetDevice(device) == hipSuccess);
+        }
+        ~hipblas_xt_device_guard()
+        {
+            (void)hipSetDevice(m_previous);
+        }
+        bool ok() const
+        {
+            return m_ok;
+        }
+    };
+
+    // A matrix given to a hipblasXt function, in host or device memory. Pageable host memory
+    // is registered for the call so that its copies are asynchronous.
+    struct hipblas_xt_matrix
+    {
+        const char* p;
+        size_t      ld;
+        bool        host       = false;
+        bool        registered = false;
+
+        hipblas_xt_matrix(const void* ptr, size_t ld_, size_t rows, size_t cols, size_t size)
+            : p(static_cast<const char*>(ptr))
+            , ld(ld_)
+        {
+            hipPointerAttribute_t attr;
+            if(hipPointerGetAttributes(&attr, ptr) != hipSuccess)
+            {
+                (void)hipGetLastError();
+                attr.type = hipMemoryTypeUnregistered;
+            }
+            if(attr.type == hipMemoryTypeDevice || attr.type == hipMemoryTypeManaged)
+                return;
+
+            host = true;
+            if(attr.type == hipMemoryTypeUnregistered && rows && cols)
+            {
+                size_t bytes = (ld * (cols - 1) + rows) * size;
+                registered   = hipHostRegister(const_cast<char*>(p), bytes, hipHostRegisterDefault)
+                             == hipSuccess;
+                if(!registered)
+                    (void)hipGetLastError();
+            }
+        }
+
+        ~hipblas_xt_matrix()
+        {
+            if(registered)
+                (void)hipHostUnregister(const_cast<char*>(p));
+        }
+
+        const char* at(size_t row, size_t col, size_t size) const
+        {
+            return p + (row + col * ld) * size;
+        }
+    };
+
+    // Copies rows x cols elements at (row, col) of m to or from the device block d with
+    // leading dimension ldd. Host matrices go through hipblasSetMatrixAsync and
+    // hipblasGetMatrixAsync, and device matrices, which may be on another device, through
+    // hipMemcpy2DAsync, which copies peer to peer where it can.
+    hipblasStatus_t hipblas_xt_copy(bool                     to_device,
+                                    const hipblas_xt_matrix& m,
+                                    size_t                   row,
+                                    size_t                   col,
+                                    size_t                   rows,
+                                    size_t                   cols,
+                                    size_t                   size,
+                                    void*                    d,
+                                    int                      ldd,
+                                    hipStream_t              stream)
+    {
+        if(!rows || !cols)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        char* h = const_cast<char*>(m.at(row, col, size));
+        if(m.host && m.ld <= INT_MAX)
+            return to_device ? hipblasSetMatrixAsync(rows, cols, size, h, m.ld, d, ldd, stream)
+                             : hipblasGetMatrixAsync(rows, cols, size, d, ldd, h, m.ld, stream);
+
+        hipError_t err = to_device ? hipMemcpy2DAsync(d,
+                                                      ldd * size,
+                                                      h,
+                                                      m.ld * size,
+                                                      rows * size,
+                                                      cols,
+                                                      hipMemcpyDefault,
+                                                      stream)
+                                   : hipMemcpy2DAsync(h,
+                                                      m.ld * size,
+                                                      d,
+                                                      ldd * size,
+                                                      rows * size,
+                                                      cols,
+                                                      hipMemcpyDefault,
+                                                      stream);
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+
+    template <typename T>
+    T hipblas_xt_one()
+    {
+        return T(1);
+    }
+
+    template <>
+    hipComplex hipblas_xt_one()
+    {
+        return make_hipFloatComplex(1, 0);
+    }
+
+    template <>
+    hipDoubleComplex hipblas_xt_one()
+    {
+        return make_hipDoubleComplex(1, 0);
+    }
+
+    // Sizes in bytes of the elements of A, B and C
+    struct hipblas_xt_sizes
+    {
+        size_t a, b, c;
+    };
+
+    // C = alpha * op(A) * op(B) + beta * C, with C split into tiles given round-robin to the
+    // devices and k split into blocks. gemm(handle, m, n, k, A, B, first, C, ld) runs the gemm
+    // of one block, with beta for the first block of a tile and 1 for the others.
+    template <typename Gemm>
+    hipblasStatus_t hipblas_xt_gemm(hipblasXtHandle_t  xt,
+                                    hipblasOperation_t transa,
+                                    hipblasOperation_t transb,
+                                    size_t             m,
+                                    size_t             n,
+                                    size_t             k,
+                                    const void*        A,
+                                    size_t             lda,
+                                    const void*        B,
+                                    size_t             ldb,
+                                    bool               beta_zero,
+                                    void*              C,
+                                    size_t             ldc,
+                                    hipblas_xt_sizes   sizes,
+                                    Gemm               gemm)
+    {
+        if(xt == nullptr || xt->devices.empty())
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+        bool na = transa == HIPBLAS_OP_N, nb = transb == HIPBLAS_OP_N;
+        if(lda < std::max<size_t>(1, na ? m : k) || ldb < std::max<size_t>(1, nb ? k : n)
+           || ldc < std::max<size_t>(1, m))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!m || !n)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!C || (k && (!A || !B)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        // the block size is lowered so that the two slots of A, B and C fit the budget
+        size_t bd = xt->block_dim;
+        if(xt->memory_budget)
+        {
+            auto budget_bd = static_cast<size_t>(
+                std::sqrt(double(xt->memory_budget) / double(2 * (sizes.a + sizes.b + sizes.c))));
+            if(budget_bd == 0)
+                return HIPBLAS_STATUS_ALLOC_FAILED;
+            bd = std::min(bd, budget_bd);
+        }
+        const size_t block = bd * bd;
+        const size_t bytes = 2 * block * (sizes.a + sizes.b + sizes.c);
+
+        hipblas_xt_matrix mA(A, lda, na ? m : k, na ? k : m, sizes.a);
+        hipblas_xt_matrix mB(B, ldb, nb ? k : n, nb ? n : k, sizes.b);
+        hipblas_xt_matrix mC(C, ldc, m, n, sizes.c);
+
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        auto            record = [&status](hipblasStatus_t s) {
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = s;
+            return s == HIPBLAS_STATUS_SUCCESS;
+        };
+        auto hip = [&record](hipError_t err) {
+            return record(err == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                            : HIPBLAS_STATUS_INTERNAL_ERROR);
+        };
+
+        // the streams of every device are idle between calls, so buffers are replaced freely
+        for(auto& dev : xt->devices)
+        {
+            hipblas_xt_device_guard guard(dev.id);
+            if(!guard.ok())
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+            if(dev.buffer_size < bytes)
+            {
+                if(dev.buffer)
+                    (void)hipFree(dev.buffer);
+                dev.buffer      = nullptr;
+                dev.buffer_size = 0;
+                if(hipMalloc(&dev.buffer, bytes) != hipSuccess)
+                    return HIPBLAS_STATUS_ALLOC_FAILED;
+                dev.buffer_size = bytes;
+            }
+        }
+
+        size_t tiles_m = (m + bd - 1) / bd, tiles_n = (n + bd - 1) / bd;
+        size_t blocks_k = std::max<size_t>(1, (k + bd - 1) / bd);
+        size_t ndev     = xt->devices.size();
+
+        for(size_t t = 0; t < tiles_m * tiles_n && status == HIPBLAS_STATUS_SUCCESS; t++)
+        {
+            auto&                   dev = xt->devices[t % ndev];
+            hipblas_xt_device_guard guard(dev.id);
+            if(!guard.ok())
+            {
+                record(HIPBLAS_STATUS_INTERNAL_ERROR);
+                break;
+            }
+
+            hipStream_t in = dev.streams[0], compute = dev.streams[1], out = dev.streams[2];
+
+            char* base  = static_cast<char*>(dev.buffer);
+            char* dA[2] = {base, base + block * sizes.a};
+            base += 2 * block * sizes.a;
+            char* dB[2] = {base, base + block * sizes.b};
+            base += 2 * block * sizes.b;
+            char* dC[2] = {base, base + block * sizes.c};
+
+            int    c = (t / ndev) % 2;
+            size_t i = (t % tiles_m) * bd, j = (t / tiles_m) * bd;
+            size_t mi = std::min(bd, m - i), nj = std::min(bd, n - j);
+
+            // C is only read when beta isn't zero, as in gemm, into a slot that is free once the
+            // tile before it in the slot is copied out
+            if(!hip(hipStreamWaitEvent(in, dev.c_free[c], 0))
+               || (!beta_zero
+                   && !record(hipblas_xt_copy(true, mC, i, j, mi, nj, sizes.c, dC[c], bd, in)))
+               || !hip(hipEventRecord(dev.c_loaded[c], in))
+               || !hip(hipStreamWaitEvent(compute, dev.c_loaded[c], 0)))
+                break;
+
+            for(size_t b = 0; b < blocks_k; b++)
+            {
+                int    s = dev.slot;
+                size_t l = b * bd, kl = std::min(bd, k - std::min(k, l));
+                dev.slot ^= 1;
+
+                if(!hip(hipStreamWaitEvent(in, dev.consumed[s], 0))
+                   || !record(na ? hipblas_xt_copy(true, mA, i, l, mi, kl, sizes.a, dA[s], bd, in)
+                                 : hipblas_xt_copy(true, mA, l, i, kl, mi, sizes.a, dA[s], bd, in))
+                   || !record(nb ? hipblas_xt_copy(true, mB, l, j, kl, nj, sizes.b, dB[s], bd, in)
+                                 : hipblas_xt_copy(true, mB, j, l, nj, kl, sizes.b, dB[s], bd, in))
+                   || !hip(hipEventRecord(dev.loaded[s], in))
+                   || !hip(hipStreamWaitEvent(compute, dev.loaded[s], 0))
+                   || !record(gemm(dev.handle, mi, nj, kl, dA[s], dB[s], b == 0, dC[c], bd))
+                   || !hip(hipEventRecord(dev.consumed[s], compute)))
+                    break;
+            }
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                break;
+
+            if(!hip(hipEventRecord(dev.c_done[c], compute))
+               || !hip(hipStreamWaitEvent(out, dev.c_done[c], 0))
+               || !record(hipblas_xt_copy(false, mC, i, j, mi, nj, sizes.c, dC[c], bd, out)))
+                break;
+            hip(hipEventRecord(dev.c_free[c], out));
+        }
+
+        // hipblasXt functions return when C holds the result
+        for(auto& dev : xt->devices)
+        {
+            hipblas_xt_device_guard guard(dev.id);
+            for(hipStream_t stream : dev.streams)
+                hip(hipStreamSynchronize(stream));
+        }
+        return status;
+    }
+
+    template <typename T, typename Fn>
+    hipblasStatus_t hipblas_xt_gemm_typed(hipblasXtHandle_t  xt,
+                                          Fn                 fn,
+                                          hipblasOperation_t transa,
+                                          hipblasOperation_t transb,
+                                          size_t             m,
+                                          size_t             n,
+                                          size_t             k,
+                                          const T*           alpha,
+                                          const T*           A,
+                                          size_t             lda,
+                                          const T*           B,
+                                          size_t             ldb,
+                                          const T*           beta,
+                                          T*                 C,
+                                          size_t             ldc)
+    {
+        if(xt && !xt->devices.empty() && m && n && (!alpha || !beta))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        const T one       = hipblas_xt_one<T>();
+        const T zero      = {};
+        bool    beta_zero = beta && !memcmp(beta, &zero, sizeof(T));
+
+        auto gemm = [&](hipblasHandle_t handle,
+                        int             mi,
+                        int             nj,
+                        int             kl,
+                        const void*     dA,
+                        const void*     dB,
+                        bool            first,
+                        void*           dC,
+                        int             ld) {
+            return fn(handle,
+                      transa,
+                      transb,
+                      mi,
+                      nj,
+                      kl,
+                      alpha,
+                      static_cast<const T*>(dA),
+                      ld,
+                      static_cast<const T*>(dB),
+                      ld,
+                      first ? beta : &one,
+                      static_cast<T*>(dC),
+                      ld);
+        };
+        return hipblas_xt_gemm(xt,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               k,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               beta_zero,
+                               C,
+                               ldc,
+                               {sizeof(T), sizeof(T), sizeof(T)},
+                               gemm);
+    }
+}
+
+void hipblasXtContext::release()
+{
+    for(auto& dev : devices)
+    {
+        hipblas_xt_device_guard guard(dev.id);
+        if(dev.handle)
+            hipblasDestroy(dev.handle);
+        if(dev.buffer)
+            (void)hipFree(dev.buffer);
+        for(hipStream_t stream : dev.streams)
+            if(stream)
+                (void)hipStreamDestroy(stream);
+        for(hipEvent_t* events : {dev.loaded, dev.consumed, dev.c_loaded, dev.c_done, dev.c_free})
+            for(int s = 0; s < 3; s++)
+                if(events[s])
+                    (void)hipEventDestroy(events[s]);
+        for(hipEvent_t event : {dev.start, dev.stop})
+            if(event)
+                (void)hipEventDestroy(event);
+    }
+    devices.clear();
+}
+
+extern "C" hipblasStatus_t hipblasXtCreate(hipblasXtHandle_t* handle)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *handle = new hipblasXtContext;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtDestroy(hipblasXtHandle_t handle)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    delete handle;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t
+    hipblasXtDeviceSelect(hipblasXtHandle_t handle, int nbDevices, const int deviceId[])
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    int device_count;
+    if(hipGetDeviceCount(&device_count) != hipSuccess)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(nbDevices < 1 || deviceId == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    for(int i = 0; i < nbDevices; i++)
+        if(deviceId[i] < 0 || deviceId[i] >= device_count
+           || std::count(deviceId, deviceId + i, deviceId[i]))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+    handle->release();
+    handle->devices.resize(nbDevices);
+    for(int i = 0; i < nbDevices; i++)
+    {
+        auto& dev = handle->devices[i];
+        dev.id    = deviceId[i];
+
+        hipblas_xt_device_guard guard(dev.id);
+        bool                    ok = guard.ok();
+        for(hipStream_t& stream : dev.streams)
+            ok = ok && hipStreamCreateWithFlags(&stream, hipStreamNonBlocking) == hipSuccess;
+        for(hipEvent_t* events : {dev.loaded, dev.consumed, dev.c_loaded, dev.c_done, dev.c_free})
+            for(int s = 0; s < 3; s++)
+                ok = ok && hipEventCreateWithFlags(&events[s], hipEventDisableTiming) == hipSuccess;
+        ok = ok && hipEventCreate(&dev.start) == hipSuccess
+             && hipEventCreate(&dev.stop) == hipSuccess;
+        ok = ok && hipblasCreate(&dev.handle) == HIPBLAS_STATUS_SUCCESS
+             && hipblasSetStream(dev.handle, dev.streams[1]) == HIPBLAS_STATUS_SUCCESS;
+        if(!ok)
+        {
+            handle->release();
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+
+        // copies of device matrices between the selected devices go peer to peer
+        for(int j = 0; j < nbDevices; j++)
+        {
+            int can_access = 0;
+            if(j != i && hipDeviceCanAccessPeer(&can_access, dev.id, deviceId[j]) == hipSuccess
+               && can_access && hipDeviceEnablePeerAccess(deviceId[j], 0) != hipSuccess)
+                (void)hipGetLastError(); // already enabled
+        }
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtSetBlockDim(hipblasXtHandle_t handle, int blockDim)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(blockDim < 1)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    handle->block_dim = blockDim;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtGetBlockDim(hipblasXtHandle_t handle, int* blockDim)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(blockDim == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *blockDim = handle->block_dim;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtSetMemoryBudget(hipblasXtHandle_t handle, size_t bytes)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    handle->memory_budget = bytes;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtGetMemoryBudget(hipblasXtHandle_t handle, size_t* bytes)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(bytes == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *bytes = handle->memory_budget;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtSetStream(hipblasXtHandle_t handle, hipStream_t stream)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    // the event recorded on the stream must belong to its device, the current one
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(stream && (!handle->stream_ready || handle->stream_device != device))
+    {
+        hipEvent_t ready;
+        if(hipEventCreateWithFlags(&ready, hipEventDisableTiming) != hipSuccess)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        if(handle->stream_ready)
+            (void)hipEventDestroy(handle->stream_ready);
+        handle->stream_ready  = ready;
+        handle->stream_device = device;
+    }
+    handle->stream = stream;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtGetStream(hipblasXtHandle_t handle, hipStream_t* stream)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(stream == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *stream = handle->stream;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtSgemm(hipblasXtHandle_t  handle,
+                                          hipblasOperation_t transa,
+                                          hipblasOperation_t transb,
+                                          size_t             m,
+                                          size_t             n,
+                                          size_t             k,
+                                          const float*       alpha,
+                                          const float*       A,
+                                          size_t             lda,
+                                          const float*       B,
+                                          size_t             ldb,
+                                          const float*       beta,
+                                          float*             C,
+                                          size_t             ldc)
+try
+{
+    return hipblas_xt_gemm_typed(
+        handle, hipblasSgemm, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtDgemm(hipblasXtHandle_t  handle,
+                                          hipblasOperation_t transa,
+                                          hipblasOperation_t transb,
+                                          size_t             m,
+                                          size_t             n,
+                                          size_t             k,
+                                          const double*      alpha,
+                                          const double*      A,
+                                          size_t             lda,
+                                          const double*      B,
+                                          size_t             ldb,
+                                          const double*      beta,
+                                          double*            C,
+                                          size_t             ldc)
+try
+{
+    return hipblas_xt_gemm_typed(
+        handle, hipblasDgemm, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtCgemm(hipblasXtHandle_t  handle,
+                                          hipblasOperation_t transa,
+                                          hipblasOperation_t transb,
+                                          size_t             m,
+                                          size_t             n,
+                                          size_t             k,
+                                          const hipComplex*  alpha,
+                                          const hipComplex*  A,
+                                          size_t             lda,
+                                          const hipComplex*  B,
+                                          size_t             ldb,
+                                          const hipComplex*  beta,
+                                          hipComplex*        C,
+                                          size_t             ldc)
+try
+{
+    return hipblas_xt_gemm_typed(
+        handle, hipblasCgemm_v2, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtZgemm(hipblasXtHandle_t       handle,
+                                          hipblasOperation_t      transa,
+                                          hipblasOperation_t      transb,
+                                          size_t                  m,
+                                          size_t                  n,
+                                          size_t                  k,
+                                          const hipDoubleComplex* alpha,
+                                          const hipDoubleComplex* A,
+                                          size_t                  lda,
+                                          const hipDoubleComplex* B,
+                                          size_t                  ldb,
+                                          const hipDoubleComplex* beta,
+                                          hipDoubleComplex*       C,
+                                          size_t                  ldc)
+try
+{
+    return hipblas_xt_gemm_typed(
+        handle, hipblasZgemm_v2, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+namespace
+{
+    // Size in bytes of an element of type, 0 for types hipblasXtGemmEx doesn't take
+    size_t hipblas_xt_type_size(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_8I:
+        case HIP_R_8F_E4M3_FNUZ:
+        case HIP_R_8F_E5M2_FNUZ:
+            return 1;
+        case HIP_R_16F:
+        case HIP_R_16BF:
+            return 2;
+        case HIP_R_32F:
+        case HIP_R_32I:
+        case HIP_C_16F:
+            return 4;
+        case HIP_R_64F:
+        case HIP_C_32F:
+            return 8;
+        case HIP_C_64F:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+
+    // Writes 1 in the type of the scalars of a gemmEx to one, returning the size of the scalars
+    size_t hipblas_xt_scalar_one(hipblasComputeType_t compute_type, bool complex, char* one)
+    {
+        size_t size;
+        switch(compute_type)
+        {
+        case HIPBLAS_COMPUTE_16F:
+        case HIPBLAS_COMPUTE_16F_PEDANTIC:
+        {
+            uint16_t half_one = 0x3C00;
+            size              = sizeof(half_one);
+            memcpy(one, &half_one, size);
+            break;
+        }
+        case HIPBLAS_COMPUTE_64F:
+        case HIPBLAS_COMPUTE_64F_PEDANTIC:
+        {
+            double double_one = 1;
+            size              = sizeof(double_one);
+            memcpy(one, &double_one, size);
+            break;
+        }
+        case HIPBLAS_COMPUTE_32I:
+        case HIPBLAS_COMPUTE_32I_PEDANTIC:
+        {
+            int32_t int_one = 1;
+            size            = sizeof(int_one);
+            memcpy(one, &int_one, size);
+            break;
+        }
+        default:
+        {
+            float float_one = 1;
+            size            = sizeof(float_one);
+            memcpy(one, &float_one, size);
+            break;
+        }
+        }
+        if(complex)
+            memset(one + size, 0, size);
+        return complex ? 2 * size : size;
+    }
+}
+
+extern "C" hipblasStatus_t hipblasXtGemmEx(hipblasXtHandle_t    handle,
+                                           hipblasOperation_t   transa,
+                                           hipblasOperation_t   transb,
+                                           size_t               m,
+                                           size_t               n,
+                                           size_t               k,
+                                           const void*          alpha,
+                                           const void*          A,
+                                           hipDataType          aType,
+                                           size_t               lda,
+                                           const void*          B,
+                                           hipDataType          bType,
+                                           size_t               ldb,
+                                           const void*          beta,
+                                           void*                C,
+                                           hipDataType          cType,
+                                           size_t               ldc,
+                                           hipblasComputeType_t computeType,
+                                           hipblasGemmAlgo_t    algo)
+try
+{
+    hipblas_xt_sizes sizes{
+        hipblas_xt_type_size(aType), hipblas_xt_type_size(bType), hipblas_xt_type_size(cType)};
+    if(!sizes.a || !sizes.b || !sizes.c)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(handle && !handle->devices.empty() && m && n && (!alpha || !beta))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    bool   complex = cType == HIP_C_16F || cType == HIP_C_32F || cType == HIP_C_64F;
+    char   one[16], zero[16] = {};
+    size_t scalar_size = hipblas_xt_scalar_one(computeType, complex, one);
+    bool   beta_zero   = beta && !memcmp(beta, zero, scalar_size);
+
+    auto gemm = [&](hipblasHandle_t h,
+                    int             mi,
+                    int             nj,
+                    int             kl,
+                    const void*     dA,
+                    const void*     dB,
+                    bool            first,
+                    void*           dC,
+                    int             ld) {
+        return hipblasGemmEx_v2(h,
+                                transa,
+                                transb,
+                                mi,
+                                nj,
+                                kl,
+                                alpha,
+                                dA,
+                                aType,
+                                ld,
+                                dB,
+                                bType,
+                                ld,
+                                first ? beta : one,
+                                dC,
+                                cType,
+                                ld,
+                                computeType,
+                                algo);
+    };
+    return hipblas_xt_gemm(
+        handle, transa, transb, m, n, k, A, lda, B, ldb, beta_zero, C, ldc, sizes, gemm);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+namespace
+{
+    // Device memory for the slots of a batched call of each device when no budget is set
+    constexpr size_t hipblas_xt_batched_budget = size_t(256) << 20;
+
+    // Slots of a batched call: while a chunk is computed, the next one is copied in and the one
+    // before it copied out
+    constexpr int hipblas_xt_batched_slots = 3;
+
+    // An operand of a strided batched function, span elements of size bytes per problem,
+    // stride elements apart. in operands are copied to the devices and out operands back, and
+    // an operand with a stride of 0 is shared by the problems. Null or empty operands are not
+    // copied.
+    struct hipblas_xt_operand
+    {
+        const void*   p;
+        size_t        span;
+        hipblasStride stride;
+        size_t        size;
+        bool          in;
+        bool          out;
+    };
+
+    // The problems first to first + count of a batch, with the operands in device memory, each
+    // problem at its span from the previous one
+    struct hipblas_xt_chunk
+    {
+        void*         p[3];
+        hipblasStride stride[3];
+        int           first;
+        int           count;
+    };
+
+    // Sets the throughput of a device from its share of the last batched call, once it's done
+    void hipblas_xt_update_throughput(hipblasXtContext::device& dev)
+    {
+        float ms;
+        if(dev.timed && hipEventQuery(dev.stop) == hipSuccess
+           && hipEventElapsedTime(&ms, dev.start, dev.stop) == hipSuccess && ms > 0)
+            dev.throughput = dev.timed / double(ms);
+        (void)hipGetLastError();
+        dev.timed = 0;
+    }
+
+    // Runs batch_count problems of a strided batched function over the devices. Each device
+    // gets a contiguous range of the batch, in proportion to the throughput it reached in the
+    // last batched call, and runs it in chunks that fit one of three slots of its memory, so
+    // the copy in of the next chunk and the copy out of the previous one overlap the
+    // computation of the current chunk. run(handle, chunk) runs the problems of a chunk.
+    //
+    // With a stream set on the context, the devices start after the work queued on it and the
+    // stream waits for them, and the function returns once the work is queued, unless pageable
+    // host memory had to be registered for the call.
+    template <typename Run>
+    hipblasStatus_t hipblas_xt_strided_batched(hipblasXtHandle_t  xt,
+                                               int                batch_count,
+                                               hipblas_xt_operand operands[3],
+                                               Run                run)
+    {
+        if(xt == nullptr || xt->devices.empty())
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        size_t per_problem = 0, shared = 0;
+        for(int i = 0; i < 3; i++)
+        {
+            auto& op = operands[i];
+            if(!op.p || !op.span)
+                continue;
+            if(op.span > INT_MAX || op.stride < 0)
+                return HIPBLAS_STATUS_NOT_SUPPORTED;
+            if(op.stride == 0)
+            {
+                if(op.out && batch_count > 1)
+                    return HIPBLAS_STATUS_INVALID_VALUE;
+                shared += op.span * op.size;
+            }
+            else if(size_t(op.stride) < op.span)
+                return HIPBLAS_STATUS_NOT_SUPPORTED; // overlapping problems
+            else
+                per_problem += op.span * op.size;
+        }
+
+        // problems per chunk, so that the slots fit the budget
+        size_t budget = xt->memory_budget ? xt->memory_budget : hipblas_xt_batched_budget;
+        size_t slot   = budget / hipblas_xt_batched_slots;
+        size_t chunk  = slot > shared + 256 * 3
+                            ? (slot - shared - 256 * 3) / std::max<size_t>(1, per_problem)
+                            : 0;
+        if(chunk == 0)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        chunk = std::min<size_t>(chunk, batch_count);
+
+        size_t offsets[3], slot_bytes = 0;
+        for(int i = 0; i < 3; i++)
+        {
+            auto& op   = operands[i];
+            offsets[i] = slot_bytes;
+            if(op.p && op.span)
+                slot_bytes += ((op.stride ? chunk : 1) * op.span * op.size + 255) / 256 * 256;
+        }
+
+        std::optional<hipblas_xt_matrix> matrices[3];
+        bool                             registered = false;
+        for(int i = 0; i < 3; i++)
+        {
+            auto& op = operands[i];
+            if(op.p && op.span)
+            {
+                matrices[i].emplace(op.p,
+                                    op.stride ? op.stride : op.span,
+                                    op.span,
+                                    op.stride ? batch_count : 1,
+                                    op.size);
+                registered = registered || matrices[i]->registered;
+            }
+        }
+
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        auto            record = [&status](hipblasStatus_t s) {
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = s;
+            return s == HIPBLAS_STATUS_SUCCESS;
+        };
+        auto hip = [&record](hipError_t err) {
+            return record(err == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                            : HIPBLAS_STATUS_INTERNAL_ERROR);
+        };
+
+        // the shares of the devices, even until each has been timed
+        size_t           ndev     = xt->devices.size();
+        double           total    = 0;
+        bool             measured = true;
+        std::vector<int> shares(ndev);
+        for(auto& dev : xt->devices)
+        {
+            hipblas_xt_device_guard guard(dev.id);
+            hipblas_xt_update_throughput(dev);
+            measured = measured && dev.throughput > 0;
+            total += dev.throughput;
+        }
+        int given = 0;
+        for(size_t d = 0; d < ndev; d++)
+        {
+            shares[d] = measured ? int(batch_count * (xt->devices[d].throughput / total))
+                                 : int(batch_count / ndev);
+            given += shares[d];
+        }
+        for(size_t d = 0; given < batch_count; d = (d + 1) % ndev, given++)
+            shares[d]++;
+
+        // buffers are only replaced once the work of earlier calls on them is done
+        for(size_t d = 0; d < ndev; d++)
+        {
+            auto&                   dev = xt->devices[d];
+            hipblas_xt_device_guard guard(dev.id);
+            if(!guard.ok())
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+            if(shares[d] && dev.buffer_size < hipblas_xt_batched_slots * slot_bytes)
+            {
+                for(hipStream_t stream : dev.streams)
+                    (void)hipStreamSynchronize(stream);
+                if(dev.buffer)
+                    (void)hipFree(dev.buffer);
+                dev.buffer      = nullptr;
+                dev.buffer_size = 0;
+                if(hipMalloc(&dev.buffer, hipblas_xt_batched_slots * slot_bytes) != hipSuccess)
+                    return HIPBLAS_STATUS_ALLOC_FAILED;
+                dev.buffer_size = hipblas_xt_batched_slots * slot_bytes;
+            }
+        }
+
+        if(xt->stream)
+        {
+            hipblas_xt_device_guard guard(xt->stream_device);
+            if(!guard.ok() || !hip(hipEventRecord(xt->stream_ready, xt->stream)))
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+
+        int first = 0;
+        for(size_t d = 0; d < ndev && status == HIPBLAS_STATUS_SUCCESS; first += shares[d++])
+        {
+            auto& dev = xt->devices[d];
+            if(!shares[d])
+                continue;
+            hipblas_xt_device_guard guard(dev.id);
+            if(!guard.ok())
+            {
+                record(HIPBLAS_STATUS_INTERNAL_ERROR);
+                break;
+            }
+
+            hipStream_t in = dev.streams[0], compute = dev.streams[1], out = dev.streams[2];
+            if((xt->stream && !hip(hipStreamWaitEvent(in, xt->stream_ready, 0)))
+               || !hip(hipEventRecord(dev.start, in)))
+                break;
+
+            for(int c = first; c < first + shares[d]; c += int(chunk))
+            {
+                int   s    = dev.batch_slot;
+                char* base = static_cast<char*>(dev.buffer) + s * slot_bytes;
+                dev.batch_slot = (s + 1) % hipblas_xt_batched_slots;
+
+                hipblas_xt_chunk ck = {};
+                ck.first            = c;
+                ck.count            = std::min(int(chunk), first + shares[d] - c);
+                for(int i = 0; i < 3; i++)
+                {
+                    if(matrices[i])
+                    {
+                        ck.p[i]      = base + offsets[i];
+                        ck.stride[i] = operands[i].stride ? operands[i].span : 0;
+                    }
+                }
+
+                // the slot is free once the copy out of the chunk before it in the slot is done
+                if(!hip(hipStreamWaitEvent(in, dev.c_free[s], 0)))
+                    break;
+                for(int i = 0; i < 3; i++)
+                {
+                    auto& op = operands[i];
+                    if(matrices[i] && op.in
+                       && !record(hipblas_xt_copy(true,
+                                                  *matrices[i],
+                                                  0,
+                                                  op.stride ? c : 0,
+                                                  op.span,
+                                                  op.stride ? ck.count : 1,
+                                                  op.size,
+                                                  ck.p[i],
+                                                  int(op.span),
+                                                  in)))
+                        break;
+                }
+                if(status != HIPBLAS_STATUS_SUCCESS || !hip(hipEventRecord(dev.loaded[s], in))
+                   || !hip(hipStreamWaitEvent(compute, dev.loaded[s], 0))
+                   || !record(run(dev.handle, ck)) || !hip(hipEventRecord(dev.c_done[s], compute))
+                   || !hip(hipStreamWaitEvent(out, dev.c_done[s], 0)))
+                    break;
+                for(int i = 0; i < 3; i++)
+                {
+                    auto& op = operands[i];
+                    if(matrices[i] && op.out
+                       && !record(hipblas_xt_copy(false,
+                                                  *matrices[i],
+                                                  0,
+                                                  op.stride ? c : 0,
+                                                  op.span,
+                                                  op.stride ? ck.count : 1,
+                                                  op.size,
+                                                  ck.p[i],
+                                                  int(op.span),
+                                                  out)))
+                        break;
+                }
+                if(status != HIPBLAS_STATUS_SUCCESS || !hip(hipEventRecord(dev.c_free[s], out)))
+                    break;
+            }
+            if(status != HIPBLAS_STATUS_SUCCESS || !hip(hipEventRecord(dev.stop, out)))
+                break;
+            dev.timed = shares[d];
+
+            if(xt->stream)
+            {
+                hipblas_xt_device_guard stream_guard(xt->stream_device);
+                hip(hipStreamWaitEvent(xt->stream, dev.stop, 0));
+            }
+        }
+
+        // registered host memory is unregistered at the return, so its copies must be done
+        if(!xt->stream || registered || status != HIPBLAS_STATUS_SUCCESS)
+        {
+            for(auto& dev : xt->devices)
+            {
+                hipblas_xt_device_guard guard(dev.id);
+                for(hipStream_t stream : dev.streams)
+                    hip(hipStreamSynchronize(stream));
+                hipblas_xt_update_throughput(dev);
+            }
+        }
+        return status;
+    }
+
+    template <typename T, typename Fn>
+    hipblasStatus_t hipblas_xt_getrf_strided_batched(hipblasXtHandle_t   xt,
+                                                     Fn                  fn,
+                                                     int                 n,
+                                                     T*                  A,
+                                                     int                 lda,
+                                                     hipblasStride       strideA,
+                                                     int*                ipiv,
+                                                     hipblasStride       strideP,
+                                                     int*                info,
+                                                     int                 batchCount)
+    {
+        if(xt == nullptr || xt->devices.empty())
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(n < 0 || lda < std::max(1, n) || batchCount < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(batchCount && (!info || (n && !A)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        size_t             span_a = n ? size_t(lda) * (n - 1) + n : 0;
+        hipblas_xt_operand operands[3]
+            = {{A, span_a, strideA, sizeof(T), true, true},
+               {ipiv, size_t(n), strideP, sizeof(int), false, true},
+               {info, 1, 1, sizeof(int), false, true}};
+
+        auto run = [&](hipblasHandle_t handle, const hipblas_xt_chunk& ck) {
+            return fn(handle,
+                      n,
+                      static_cast<T*>(ck.p[0]),
+                      lda,
+                      ck.stride[0],
+                      static_cast<int*>(ck.p[1]),
+                      ck.stride[1],
+                      static_cast<int*>(ck.p[2]),
+                      ck.count);
+        };
+        return hipblas_xt_strided_batched(xt, batchCount, operands, run);
+    }
+
+    template <typename T, typename Fn>
+    hipblasStatus_t hipblas_xt_getrs_strided_batched(hipblasXtHandle_t  xt,
+                                                     Fn                 fn,
+                                                     hipblasOperation_t trans,
+                                                     int                n,
+                                                     int                nrhs,
+                                                     T*                 A,
+                                                     int                lda,
+                                                     hipblasStride      strideA,
+                                                     const int*         ipiv,
+                                                     hipblasStride      strideP,
+                                                     T*                 B,
+                                                     int                ldb,
+                                                     hipblasStride      strideB,
+                                                     int*               info,
+                                                     int                batchCount)
+    {
+        if(xt == nullptr || xt->devices.empty())
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(info == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        // info is the negated position of the first invalid argument, as in getrs
+        *info = n < 0                  ? -2
+                : nrhs < 0             ? -3
+                : n && !A              ? -4
+                : lda < std::max(1, n) ? -5
+                : n && !ipiv           ? -7
+                : n && nrhs && !B      ? -9
+                : ldb < std::max(1, n) ? -10
+                : batchCount < 0       ? -13
+                                       : 0;
+        if(*info)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        size_t             span_a = n ? size_t(lda) * (n - 1) + n : 0;
+        size_t             span_b = n && nrhs ? size_t(ldb) * (nrhs - 1) + n : 0;
+        hipblas_xt_operand operands[3]
+            = {{A, span_a, strideA, sizeof(T), true, false},
+               {ipiv, size_t(n), strideP, sizeof(int), true, false},
+               {B, span_b, strideB, sizeof(T), true, true}};
+
+        // info reports invalid arguments, the same for every chunk
+        auto run = [&](hipblasHandle_t handle, const hipblas_xt_chunk& ck) {
+            return fn(handle,
+                      trans,
+                      n,
+                      nrhs,
+                      static_cast<T*>(ck.p[0]),
+                      lda,
+                      ck.stride[0],
+                      static_cast<const int*>(ck.p[1]),
+                      ck.stride[1],
+                      static_cast<T*>(ck.p[2]),
+                      ldb,
+                      ck.stride[2],
+                      info,
+                      ck.count);
+        };
+        return hipblas_xt_strided_batched(xt, batchCount, operands, run);
+    }
+}
+
+extern "C" hipblasStatus_t hipblasXtGemmStridedBatchedEx(hipblasXtHandle_t    handle,
+                                                         hipblasOperation_t   transA,
+                                                         hipblasOperation_t   transB,
+                                                         int                  m,
+                                                         int                  n,
+                                                         int                  k,
+                                                         const void*          alpha,
+                                                         const void*          A,
+                                                         hipDataType          aType,
+                                                         int                  lda,
+                                                         hipblasStride        strideA,
+                                                         const void*          B,
+                                                         hipDataType          bType,
+                                                         int                  ldb,
+                                                         hipblasStride        strideB,
+                                                         const void*          beta,
+                                                         void*                C,
+                                                         hipDataType          cType,
+                                                         int                  ldc,
+                                                         hipblasStride        strideC,
+                                                         int                  batchCount,
+                                                         hipblasComputeType_t computeType,
+                                                         hipblasGemmAlgo_t    algo)
+try
+{
+    hipblas_xt_sizes sizes{
+        hipblas_xt_type_size(aType), hipblas_xt_type_size(bType), hipblas_xt_type_size(cType)};
+    if(!sizes.a || !sizes.b || !sizes.c)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(handle == nullptr || handle->devices.empty())
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    bool na = transA == HIPBLAS_OP_N, nb = transB == HIPBLAS_OP_N;
+    if(m < 0 || n < 0 || k < 0 || batchCount < 0 || lda < std::max(1, na ? m : k)
+       || ldb < std::max(1, nb ? k : n) || ldc < std::max(1, m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n || !batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || !C || (k && (!A || !B)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    bool   complex = cType == HIP_C_16F || cType == HIP_C_32F || cType == HIP_C_64F;
+    char   one[16], zero[16] = {};
+    size_t scalar_size = hipblas_xt_scalar_one(computeType, complex, one);
+    bool   beta_zero   = !memcmp(beta, zero, scalar_size);
+
+    // op(A) and op(B) are only read when k isn't zero, and C when beta isn't zero
+    auto span = [](int rows, int cols, int ld) {
+        return rows && cols ? size_t(ld) * (cols - 1) + rows : 0;
+    };
+    hipblas_xt_operand operands[3]
+        = {{k ? A : nullptr, span(na ? m : k, na ? k : m, lda), strideA, sizes.a, true, false},
+           {k ? B : nullptr, span(nb ? k : n, nb ? n : k, ldb), strideB, sizes.b, true, false},
+           {C, span(m, n, ldc), strideC, sizes.c, !beta_zero, true}};
+
+    auto run = [&](hipblasHandle_t h, const hipblas_xt_chunk& ck) {
+        return hipblasGemmStridedBatchedEx_v2(h,
+                                              transA,
+                                              transB,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              ck.p[0],
+                                              aType,
+                                              lda,
+                                              ck.stride[0],
+                                              ck.p[1],
+                                              bType,
+                                              ldb,
+                                              ck.stride[1],
+                                              beta,
+                                              ck.p[2],
+                                              cType,
+                                              ldc,
+                                              ck.stride[2],
+                                              ck.count,
+                                              computeType,
+                                              algo);
+    };
+    return hipblas_xt_strided_batched(handle, batchCount, operands, run);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtSgetrfStridedBatched(hipblasXtHandle_t   handle,
+                                                         const int           n,
+                                                         float*              A,
+                                                         const int           lda,
+                                                         const hipblasStride strideA,
+                                                         int*                ipiv,
+                                                         const hipblasStride strideP,
+                                                         int*                info,
+                                                         const int           batchCount)
+try
+{
+    return hipblas_xt_getrf_strided_batched(
+        handle, hipblasSgetrfStridedBatched, n, A, lda, strideA, ipiv, strideP, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtDgetrfStridedBatched(hipblasXtHandle_t   handle,
+                                                         const int           n,
+                                                         double*             A,
+                                                         const int           lda,
+                                                         const hipblasStride strideA,
+                                                         int*                ipiv,
+                                                         const hipblasStride strideP,
+                                                         int*                info,
+                                                         const int           batchCount)
+try
+{
+    return hipblas_xt_getrf_strided_batched(
+        handle, hipblasDgetrfStridedBatched, n, A, lda, strideA, ipiv, strideP, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtCgetrfStridedBatched(hipblasXtHandle_t   handle,
+                                                         const int           n,
+                                                         hipComplex*         A,
+                                                         const int           lda,
+                                                         const hipblasStride strideA,
+                                                         int*                ipiv,
+                                                         const hipblasStride strideP,
+                                                         int*                info,
+                                                         const int           batchCount)
+try
+{
+    return hipblas_xt_getrf_strided_batched(handle,
+                                            hipblasCgetrfStridedBatched_v2,
+                                            n,
+                                            A,
+                                            lda,
+                                            strideA,
+                                            ipiv,
+                                            strideP,
+                                            info,
+                                            batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtZgetrfStridedBatched(hipblasXtHandle_t   handle,
+                                                         const int           n,
+                                                         hipDoubleComplex*   A,
+                                                         const int           lda,
+                                                         const hipblasStride strideA,
+                                                         int*                ipiv,
+                                                         const hipblasStride strideP,
+                                                         int*                info,
+                                                         const int           batchCount)
+try
+{
+    return hipblas_xt_getrf_strided_batched(handle,
+                                            hipblasZgetrfStridedBatched_v2,
+                                            n,
+                                            A,
+                                            lda,
+                                            strideA,
+                                            ipiv,
+                                            strideP,
+                                            info,
+                                            batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtSgetrsStridedBatched(hipblasXtHandle_t        handle,
+                                                         const hipblasOperation_t trans,
+                                                         const int                n,
+                                                         const int                nrhs,
+                                                         float*                   A,
+                                                         const int                lda,
+                                                         const hipblasStride      strideA,
+                                                         const int*               ipiv,
+                                                         const hipblasStride      strideP,
+                                                         float*                   B,
+                                                         const int                ldb,
+                                                         const hipblasStride      strideB,
+                                                         int*                     info,
+                                                         const int                batchCount)
+try
+{
+    return hipblas_xt_getrs_strided_batched(handle,
+                                            hipblasSgetrsStridedBatched,
+                                            trans,
+                                            n,
+                                            nrhs,
+                                            A,
+                                            lda,
+                                            strideA,
+                                            ipiv,
+                                            strideP,
+                                            B,
+                                            ldb,
+                                            strideB,
+                                            info,
+                                            batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtDgetrsStridedBatched(hipblasXtHandle_t        handle,
+                                                         const hipblasOperation_t trans,
+                                                         const int                n,
+                                                         const int                nrhs,
+                                                         double*                  A,
+                                                         const int                lda,
+                                                         const hipblasStride      strideA,
+                                                         const int*               ipiv,
+                                                         const hipblasStride      strideP,
+                                                         double*                  B,
+                                                         const int                ldb,
+                                                         const hipblasStride      strideB,
+                                                         int*                     info,
+                                                         const int                batchCount)
+try
+{
+    return hipblas_xt_getrs_strided_batched(handle,
+                                            hipblasDgetrsStridedBatched,
+                                            trans,
+                                            n,
+                                            nrhs,
+                                            A,
+                                            lda,
+                                            strideA,
+                                            ipiv,
+                                            strideP,
+                                            B,
+                                            ldb,
+                                            strideB,
+                                            info,
+                                            batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtCgetrsStridedBatched(hipblasXtHandle_t        handle,
+                                                         const hipblasOperation_t trans,
+                                                         const int                n,
+                                                         const int                nrhs,
+                                                         hipComplex*              A,
+                                                         const int                lda,
+                                                         const hipblasStride      strideA,
+                                                         const int*               ipiv,
+                                                         const hipblasStride      strideP,
+                                                         hipComplex*              B,
+                                                         const int                ldb,
+                                                         const hipblasStride      strideB,
+                                                         int*                     info,
+                                                         const int                batchCount)
+try
+{
+    return hipblas_xt_getrs_strided_batched(handle,
+                                            hipblasCgetrsStridedBatched_v2,
+                                            trans,
+                                            n,
+                                            nrhs,
+                                            A,
+                                            lda,
+                                            strideA,
+                                            ipiv,
+                                            strideP,
+                                            B,
+                                            ldb,
+                                            strideB,
+                                            info,
+                                            batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtZgetrsStridedBatched(hipblasXtHandle_t        handle,
+                                                         const hipblasOperation_t trans,
+                                                         const int                n,
+                                                         const int                nrhs,
+                                                         hipDoubleComplex*        A,
+                                                         const int                lda,
+                                                         const hipblasStride      strideA,
+                                                         const int*               ipiv,
+                                                         const hipblasStride      strideP,
+                                                         hipDoubleComplex*        B,
+                                                         const int                ldb,
+                                                         const hipblasStride      strideB,
+                                                         int*                     info,
+                                                         const int                batchCount)
+try
+{
+    return hipblas_xt_getrs_strided_batched(handle,
+                                            hipblasZgetrsStridedBatched_v2,
+                                            trans,
+                                            n,
+                                            nrhs,
+                                            A,
+                                            lda,
+                                            strideA,
+                                            ipiv,
+                                            strideP,
+                                            B,
+                                            ldb,
+                                            strideB,
+                                            info,
+                                            batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
@@ -0,0 +1,44 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+// Calls chunk(first, count) on consecutive chunks of the problems of a strided batched call, of
+// at most max_count problems each, for batches larger than a single call of the backend takes.
+// The chunks are queued back to back on the stream of the handle, without synchronizing, and
+// the first status other than success (zero, for hipBLAS, rocBLAS and cuBLAS statuses alike) is
+// returned. A batch_count of at most max_count, zero or negative included, is passed on in a
+// single call, for the backend to check the arguments.
+template <typename F>
+auto hipblasSplitBatch(int64_t batch_count, int64_t max_count, F&& chunk)
+{
+    for(int64_t first = 0;; first += max_count)
+    {
+        int64_t count  = std::min(batch_count - first, max_count);
+        auto    status = chunk(first, count);
+        if(status != decltype(status){} || first + count >= batch_count)
+            return status;
+    }
+}
@@ -0,0 +1,93 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+
+#include <cstdint>
+
+// Kernels of hipblas_batched_blas3.cpp for the batched BLAS 3 functions that cuBLAS computes
+// one matrix at a time, so that the NVIDIA backend queues a single launch for a whole batch.
+// A, B, C and x are arrays of pointers when batched, and the first matrix or vector of a
+// strided batch otherwise, and dataType is HIP_R_32F, HIP_R_64F, HIP_C_32F or HIP_C_64F.
+//
+// Return HIPBLAS_STATUS_NOT_SUPPORTED, without any work queued, for the calls they don't take,
+// which the caller then passes to cuBLAS: other types, empty problems and invalid arguments,
+// which cuBLAS reports.
+
+// C_b := alpha * op(A_b) + beta * op(B_b), as geam. C_b may be A_b or B_b when that matrix
+// isn't transposed and has the leading dimension of C_b.
+hipblasStatus_t hipblasBatchedGeam(hipblasHandle_t    handle,
+                                   hipblasOperation_t transA,
+                                   hipblasOperation_t transB,
+                                   int64_t            m,
+                                   int64_t            n,
+                                   const void*        alpha,
+                                   const void*        A,
+                                   int64_t            lda,
+                                   hipblasStride      strideA,
+                                   const void*        beta,
+                                   const void*        B,
+                                   int64_t            ldb,
+                                   hipblasStride      strideB,
+                                   void*              C,
+                                   int64_t            ldc,
+                                   hipblasStride      strideC,
+                                   hipDataType        dataType,
+                                   int64_t            batchCount,
+                                   bool               batched);
+
+// C_b := A_b * diag(x_b) or diag(x_b) * A_b, as dgmm, with a negative incx counting x_b from
+// its end. C_b may be A_b when they have the same leading dimension.
+hipblasStatus_t hipblasBatchedDgmm(hipblasHandle_t   handle,
+                                   hipblasSideMode_t side,
+                                   int64_t           m,
+                                   int64_t           n,
+                                   const void*       A,
+                                   int64_t           lda,
+                                   hipblasStride     strideA,
+                                   const void*       x,
+                                   int64_t           incx,
+                                   hipblasStride     stridex,
+                                   void*             C,
+                                   int64_t           ldc,
+                                   hipblasStride     strideC,
+                                   hipDataType       dataType,
+                                   int64_t           batchCount,
+                                   bool              batched);
+
+// W_b := the full matrix of order n whose uplo triangle is that of A_b, for a strided batch
+// of W_b with a leading dimension of n and a stride of n * n. The other triangle is the
+// transpose of the triangle of A_b, or its conjugate transpose when hermitian, in which case
+// the imaginary parts of the diagonal are taken as zero, as hemm does. The strided batched
+// symm and hemm of the NVIDIA backend then compute the whole batch as one batched gemm.
+hipblasStatus_t hipblasBatchedSymmetrize(hipblasHandle_t   handle,
+                                         hipblasFillMode_t uplo,
+                                         bool              hermitian,
+                                         int64_t           n,
+                                         const void*       A,
+                                         int64_t           lda,
+                                         hipblasStride     strideA,
+                                         void*             W,
+                                         hipDataType       dataType,
+                                         int64_t           batchCount);
@@ -0,0 +1,59 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas_handle_state.hpp"
+
+// Queues a gemm of a handle for which hipblasIsDeferring is true. type is HIP_R_32F,
+// HIP_R_64F, HIP_C_32F or HIP_C_64F. The arguments are checked now, and the gemm is run by
+// hipblasEndBatch, or earlier if a later gemm of the batch touches the matrix it writes.
+hipblasStatus_t hipblasDeferGemm(hipblasHandle_t    handle,
+                                 hipDataType        type,
+                                 hipblasOperation_t transa,
+                                 hipblasOperation_t transb,
+                                 int                m,
+                                 int                n,
+                                 int                k,
+                                 const void*        alpha,
+                                 const void*        A,
+                                 int                lda,
+                                 const void*        B,
+                                 int                ldb,
+                                 const void*        beta,
+                                 void*              C,
+                                 int                ldc);
+
+// Holds back a scal (x == nullptr) or axpy with unit increments, real type and a host scalar of
+// a handle for which hipblasIsDeferring is true, so that it can be folded into the next call:
+// a scal of the matrix C of the next gemm into its beta, and consecutive scals, or axpys of the
+// same x, of the same vector into one call. Returns HIPBLAS_STATUS_NOT_SUPPORTED, after running
+// the call held back before, when the call isn't held back and should run now, which it always
+// is while the handle isn't deferring or is in a reproducibility mode.
+hipblasStatus_t hipblasDeferVector(hipblasHandle_t handle,
+                                   int             n,
+                                   const void*     alpha,
+                                   const void*     x,
+                                   int             incx,
+                                   void*           y,
+                                   int             incy,
+                                   hipDataType     type);
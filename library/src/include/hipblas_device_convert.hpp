@@ -0,0 +1,163 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// Conversions of float and double to and from the floating point types narrower than them, done
+// on the bits of the formats so that they round and saturate the same for every type and on both
+// backends. They are those of hipblasConvertEx, and are here so that kernels that write these
+// types, such as the epilogues of gemms, can round as hipblasConvertEx does.
+
+// A binary floating point format of exp_bits exponent bits and man_bits mantissa bits, with the
+// sign in the bit above them
+struct hipblas_float_format
+{
+    int      exp_bits;
+    int      man_bits;
+    int      bias;
+    uint32_t max_finite; // the bits of the largest finite value
+    uint32_t inf;        // the bits of infinity, or 0 for the formats without
+    uint32_t nan;        // the bits of the NaN that is written
+    bool     nuz;        // no negative zero, its bits being the only NaN, as for the FNUZ types
+};
+
+constexpr hipblas_float_format hipblas_format_f32
+    = {8, 23, 127, 0x7f7fffff, 0x7f800000, 0x7fc00000, false};
+constexpr hipblas_float_format hipblas_format_f16 = {5, 10, 15, 0x7bff, 0x7c00, 0x7e00, false};
+constexpr hipblas_float_format hipblas_format_bf16 = {8, 7, 127, 0x7f7f, 0x7f80, 0x7fc0, false};
+constexpr hipblas_float_format hipblas_format_e4m3_fnuz = {4, 3, 8, 0x7f, 0, 0x80, true};
+constexpr hipblas_float_format hipblas_format_e5m2_fnuz = {5, 2, 16, 0x7f, 0, 0x80, true};
+constexpr hipblas_float_format hipblas_format_e4m3      = {4, 3, 7, 0x7e, 0, 0x7f, false};
+constexpr hipblas_float_format hipblas_format_e5m2      = {5, 2, 15, 0x7b, 0x7c, 0x7e, false};
+
+// The value of bits in format, which is exact in float for the formats narrower than float
+__device__ __host__ inline float hipblas_float_decode(uint32_t bits, hipblas_float_format format)
+{
+    int      width = format.exp_bits + format.man_bits;
+    uint32_t mag   = bits & ((1u << width) - 1);
+    bool     sign  = (bits >> width) & 1;
+    if(format.nuz ? bits == format.nan : mag > (format.inf ? format.inf : format.max_finite))
+        return __builtin_nanf("");
+    if(format.inf && mag == format.inf)
+        return sign ? -__builtin_inff() : __builtin_inff();
+
+    // the value is the integer significand times 2^(exponent - man_bits), with an exponent
+    // field of 0 for the subnormals, which have the exponent of the field 1 and no hidden bit
+    int      exp = int(mag >> format.man_bits);
+    uint32_t man = mag & ((1u << format.man_bits) - 1);
+    float    v   = exp ? ldexpf(float(man | (1u << format.man_bits)),
+                              exp - format.bias - format.man_bits)
+                       : ldexpf(float(man), 1 - format.bias - format.man_bits);
+    return sign ? -v : v;
+}
+
+// 32 random bits for element index of a stochastically rounded output, a hash of seed and index
+// so that they don't depend on how the elements are split among the threads
+__device__ __host__ inline uint32_t hipblas_stochastic_bits(uint64_t seed, uint64_t index)
+{
+    uint64_t z = seed + (index + 1) * 0x9e3779b97f4a7c15ull;
+    z          = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z          = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return uint32_t((z ^ (z >> 31)) >> 32);
+}
+
+// The bits of x in format, which is narrower than the type F of x, float or double. x is rounded
+// to nearest even, toward zero, or stochastically with the uniformly distributed bits random, up
+// in magnitude when the part of x below the last bit of format exceeds them. Values beyond the
+// largest finite value of format become infinity, or NaN in the formats without infinity, unless
+// saturate, with which they and the infinities become the largest finite value of their sign.
+// Rounding toward zero never rounds a finite value to infinity.
+template <typename F>
+__device__ __host__ inline uint32_t hipblas_float_encode(F                     x,
+                                                         hipblas_float_format  format,
+                                                         hipblasRoundingMode_t rounding,
+                                                         bool                  saturate,
+                                                         uint32_t              random = 0)
+{
+    using U                 = std::conditional_t<sizeof(F) == 4, uint32_t, uint64_t>;
+    constexpr int src_man   = sizeof(F) == 4 ? 23 : 52;
+    constexpr int src_bias  = sizeof(F) == 4 ? 127 : 1023;
+    constexpr int src_width = sizeof(F) * 8 - 1;
+
+    U bits;
+    memcpy(&bits, &x, sizeof(bits));
+    bool     sign     = bits >> src_width;
+    U        mag      = bits & ((U(1) << src_width) - 1);
+    int      src_exp  = int(mag >> src_man);
+    uint32_t sign_bit = sign ? 1u << (format.exp_bits + format.man_bits) : 0;
+
+    if(src_exp == (1 << (src_width - src_man)) - 1)
+    {
+        if(mag & ((U(1) << src_man) - 1))
+            return format.nan;
+        if(saturate)
+            return format.max_finite | sign_bit;
+        return format.inf ? format.inf | sign_bit : format.nan;
+    }
+
+    // x is sig * 2^lsb, rounded to a multiple of 2^q, the spacing of format at the exponent of
+    // x, or of the subnormals of format below its smallest normal exponent. sig has fewer than
+    // src_man + 2 bits, so larger shifts round it to zero as that shift does.
+    int emin  = 1 - format.bias;
+    int exp   = src_exp ? src_exp - src_bias : 1 - src_bias;
+    int q     = (exp > emin ? exp : emin) - format.man_bits;
+    U   sig   = src_exp ? (mag & ((U(1) << src_man) - 1)) | (U(1) << src_man) : mag;
+    int lsb   = (src_exp ? src_exp : 1) - src_bias - src_man;
+    int shift = q - lsb < src_man + 2 ? q - lsb : src_man + 2;
+
+    U r    = sig >> shift;
+    U rem  = sig & ((U(1) << shift) - 1);
+    U half = U(1) << (shift - 1);
+    if(rounding == HIPBLAS_ROUND_STOCHASTIC)
+    {
+        // the threshold has the shift bits of rem, the random bits being the high ones
+        U threshold = shift <= 32 ? U(random) & ((U(1) << shift) - 1) : U(random) << (shift - 32);
+        if(rem > threshold)
+            r++;
+    }
+    else if(rounding == HIPBLAS_ROUND_NEAREST_EVEN && (rem > half || (rem == half && (r & 1))))
+        r++;
+
+    // r has the hidden bit of the normals, which carries into the exponent field, so that the
+    // subnormals, with an exponent field of 0, and a rounding up to the next binade both come
+    // out right
+    uint64_t code = (uint64_t(q + format.man_bits + format.bias - 1) << format.man_bits) + r;
+    if(code > format.max_finite)
+    {
+        if(saturate || rounding == HIPBLAS_ROUND_TOWARD_ZERO)
+            code = format.max_finite;
+        else if(format.inf)
+            code = format.inf;
+        else
+            return format.nan;
+    }
+    if(format.nuz && !code)
+        return 0;
+    return uint32_t(code) | sign_bit;
+}
@@ -0,0 +1,236 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "hipblas_device_scalars.hpp"
+#include "hipblas_handle_state.hpp"
+
+// Launch geometry and fixed-order reductions of the BLAS 1 kernels of hipBLAS. The number of
+// blocks only depends on n, each block sums its elements in a fixed order, and the partial sums
+// of the blocks are then added in a fixed order by a single block, so a reduction gives the same
+// bits from one call to the next, whatever the device or the timing.
+
+constexpr int hipblas_blas1_threads = 256;
+constexpr int hipblas_blas1_blocks  = 512;
+
+// The blocks of the vectors of n elements
+inline int hipblas_blas1_grid(int n)
+{
+    return std::min((n - 1) / hipblas_blas1_threads + 1, hipblas_blas1_blocks);
+}
+
+// Element i of the vector of n elements at x with increment incx, counted from the end of the
+// storage when incx is negative
+template <typename T>
+__device__ inline T& hipblas_device_elem(T* x, int n, int incx, int i)
+{
+    return x[incx < 0 ? int64_t(i - (n - 1)) * incx : int64_t(i) * incx];
+}
+
+// |x|^2
+template <typename T>
+__device__ inline T hipblas_device_abs2(T x)
+{
+    return x * x;
+}
+
+__device__ inline float hipblas_device_abs2(hipFloatComplex x)
+{
+    return hipCrealf(x) * hipCrealf(x) + hipCimagf(x) * hipCimagf(x);
+}
+
+__device__ inline double hipblas_device_abs2(hipDoubleComplex x)
+{
+    return hipCreal(x) * hipCreal(x) + hipCimag(x) * hipCimag(x);
+}
+
+// |re(x)| + |im(x)|
+template <typename T>
+__device__ inline T hipblas_device_abs1(T x)
+{
+    return fabs(x);
+}
+
+__device__ inline float hipblas_device_abs1(hipFloatComplex x)
+{
+    return fabsf(hipCrealf(x)) + fabsf(hipCimagf(x));
+}
+
+__device__ inline double hipblas_device_abs1(hipDoubleComplex x)
+{
+    return fabs(hipCreal(x)) + fabs(hipCimag(x));
+}
+
+// The largest |re| + |im| of a range of the elements of a vector, or the smallest when MIN, and
+// the smallest index at which it is found
+template <typename TR>
+struct hipblas_iamax_partial
+{
+    TR  value;
+    int index;
+};
+
+// Whether the value v replaces the value w of iamax, or of iamin when MIN
+template <bool MIN, typename TR>
+__device__ inline bool hipblas_iamax_better(TR v, TR w)
+{
+    return MIN ? v < w : v > w;
+}
+
+template <typename TR, bool MIN = false>
+__device__ inline void hipblas_iamax_merge(hipblas_iamax_partial<TR>&       a,
+                                           const hipblas_iamax_partial<TR>& b)
+{
+    if(b.index >= 0
+       && (a.index < 0 || hipblas_iamax_better<MIN>(b.value, a.value)
+           || (b.value == a.value && b.index < a.index)))
+        a = b;
+}
+
+// The partial of the threads of the block, merged in a fixed order
+template <typename TR, bool MIN = false>
+__device__ inline hipblas_iamax_partial<TR>
+    hipblas_iamax_block_merge(hipblas_iamax_partial<TR> p, hipblas_iamax_partial<TR>* ps)
+{
+    ps[threadIdx.x] = p;
+    __syncthreads();
+    for(int s = blockDim.x / 2; s > 0; s /= 2)
+    {
+        if(threadIdx.x < s)
+            hipblas_iamax_merge<TR, MIN>(ps[threadIdx.x], ps[threadIdx.x + s]);
+        __syncthreads();
+    }
+    p = ps[0];
+    __syncthreads();
+    return p;
+}
+
+// The sum of the values of sum of the threads of the block, added in a fixed order. sums can be
+// reused on return.
+template <typename TS>
+__device__ inline TS hipblas_device_block_sum(TS sum, TS* sums)
+{
+    TS one            = hipblas_device_one<TS>();
+    sums[threadIdx.x] = sum;
+    __syncthreads();
+    for(int s = blockDim.x / 2; s > 0; s /= 2)
+    {
+        if(threadIdx.x < s)
+            sums[threadIdx.x]
+                = hipblas_device_axpby(one, sums[threadIdx.x], one, sums[threadIdx.x + s]);
+        __syncthreads();
+    }
+    sum = sums[0];
+    __syncthreads();
+    return sum;
+}
+
+// result[b] := the sum of the partial sums of the blocks of batch instance b, or its square root
+// when SQRT
+template <typename TS, bool SQRT = false>
+__global__ void hipblasBlas1SumKernel(int blocks, const TS* partial, TS* result, int batch_count)
+{
+    __shared__ TS sums[hipblas_blas1_threads];
+
+    TS one = hipblas_device_one<TS>();
+    for(int b = blockIdx.x; b < batch_count; b += gridDim.x)
+    {
+        TS sum = TS{};
+        for(int i = threadIdx.x; i < blocks; i += blockDim.x)
+            sum = hipblas_device_axpby(one, partial[size_t(b) * blocks + i], one, sum);
+
+        sum = hipblas_device_block_sum(sum, sums);
+        if(!threadIdx.x)
+        {
+            if constexpr(SQRT)
+                result[b] = sqrt(sum);
+            else
+                result[b] = sum;
+        }
+    }
+}
+
+inline hipblasStatus_t hipblas_blas1_stream(hipblasHandle_t       handle,
+                                            hipStream_t*          stream,
+                                            hipblasPointerMode_t* mode)
+{
+    hipblasStatus_t status = hipblasGetStream(handle, stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasGetPointerMode(handle, mode);
+}
+
+// Sets the count results of result_size bytes at result to zero, as for the reductions of empty
+// vectors
+inline hipblasStatus_t hipblas_blas1_zero(
+    bool host_result, void* result, int count, size_t result_size, hipStream_t stream)
+{
+    size_t result_bytes = size_t(count) * result_size;
+    if(host_result)
+        memset(result, 0, result_bytes);
+    else if(hipMemsetAsync(result, 0, result_bytes, stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Runs launch(scratch, d_result), which reduces count vectors of n elements with one partial sum
+// of partial_size bytes per block in scratch, to count results of result_size bytes at d_result.
+// d_result is result, or follows the partial sums in the scratch and is copied to result when it
+// is on the host.
+template <typename Launch>
+hipblasStatus_t hipblas_blas1_reduce(hipblasHandle_t handle,
+                                     hipStream_t     stream,
+                                     bool            host_result,
+                                     int             n,
+                                     int             count,
+                                     size_t          partial_size,
+                                     size_t          result_size,
+                                     void*           result,
+                                     Launch          launch)
+{
+    size_t result_bytes = size_t(count) * result_size;
+    size_t partial_bytes
+        = hipblas_scratch_pad(size_t(count) * hipblas_blas1_grid(n) * partial_size);
+    char* scratch = static_cast<char*>(
+        hipblasGetScratch(handle, partial_bytes + (host_result ? result_bytes : 0), stream));
+    if(!scratch)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    void* d_result = host_result ? scratch + partial_bytes : result;
+    if(launch(scratch, d_result) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    if(host_result
+       && (hipMemcpyAsync(result, d_result, result_bytes, hipMemcpyDeviceToHost, stream)
+               != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess))
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,176 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include <hip/hip_complex.h>
+#include <hip/hip_fp16.h>
+#include <hip/hip_runtime.h>
+#include <hipblas.h>
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// Element helpers for the kernels of the hipBLAS functions that have kernels of their own, which
+// are compiled for both backends and so can't use the bfloat16 type of either.
+
+struct hipblas_device_bf16
+{
+    uint16_t bits;
+};
+
+// Elements are loaded into the type they are scaled in, float for half and bfloat16, and
+// stored back from it
+__device__ inline float hipblas_device_load(__half x)
+{
+    return __half2float(x);
+}
+
+__device__ inline float hipblas_device_load(hipblas_device_bf16 x)
+{
+    uint32_t bits = uint32_t(x.bits) << 16;
+    float    f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+template <typename T>
+__device__ inline T hipblas_device_load(T x)
+{
+    return x;
+}
+
+__device__ inline void hipblas_device_store(float x, __half& y)
+{
+    y = __float2half(x);
+}
+
+__device__ inline void hipblas_device_store(float x, hipblas_device_bf16& y)
+{
+    uint32_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    if((bits & 0x7f800000) == 0x7f800000 && (bits & 0x7fffff))
+        y.bits = uint16_t((bits >> 16) | 0x40);
+    else
+        y.bits = uint16_t((bits + 0x7fff + ((bits >> 16) & 1)) >> 16);
+}
+
+template <typename T>
+__device__ inline void hipblas_device_store(T x, T& y)
+{
+    y = x;
+}
+
+// alpha * w + beta * c
+template <typename T>
+__device__ inline T hipblas_device_axpby(T alpha, T w, T beta, T c)
+{
+    return alpha * w + beta * c;
+}
+
+__device__ inline hipFloatComplex hipblas_device_axpby(hipFloatComplex alpha,
+                                                       hipFloatComplex w,
+                                                       hipFloatComplex beta,
+                                                       hipFloatComplex c)
+{
+    return hipCaddf(hipCmulf(alpha, w), hipCmulf(beta, c));
+}
+
+__device__ inline hipDoubleComplex hipblas_device_axpby(hipDoubleComplex alpha,
+                                                        hipDoubleComplex w,
+                                                        hipDoubleComplex beta,
+                                                        hipDoubleComplex c)
+{
+    return hipCadd(hipCmul(alpha, w), hipCmul(beta, c));
+}
+
+template <typename T>
+__device__ inline T hipblas_device_conj(T x)
+{
+    return x;
+}
+
+__device__ inline hipFloatComplex hipblas_device_conj(hipFloatComplex x)
+{
+    return hipConjf(x);
+}
+
+__device__ inline hipDoubleComplex hipblas_device_conj(hipDoubleComplex x)
+{
+    return hipConj(x);
+}
+
+// 1 in the type of the scalars
+template <typename T>
+__device__ inline T hipblas_device_one()
+{
+    if constexpr(std::is_same_v<T, hipFloatComplex>)
+        return make_hipFloatComplex(1, 0);
+    else if constexpr(std::is_same_v<T, hipDoubleComplex>)
+        return make_hipDoubleComplex(1, 0);
+    else
+        return T(1);
+}
+
+template <typename T>
+__device__ inline bool hipblas_device_is_zero(T x)
+{
+    return x == T(0);
+}
+
+__device__ inline bool hipblas_device_is_zero(hipFloatComplex x)
+{
+    return hipCrealf(x) == 0 && hipCimagf(x) == 0;
+}
+
+__device__ inline bool hipblas_device_is_zero(hipDoubleComplex x)
+{
+    return hipCreal(x) == 0 && hipCimag(x) == 0;
+}
+
+// Writes 1 in the type of the scalars of computeType to one, the real part for complex types
+inline void hipblas_scalar_one(hipblasComputeType_t compute_type, char* one)
+{
+    if(compute_type == HIPBLAS_COMPUTE_16F || compute_type == HIPBLAS_COMPUTE_16F_PEDANTIC)
+    {
+        uint16_t half_one = 0x3C00;
+        memcpy(one, &half_one, sizeof(half_one));
+    }
+    else if(compute_type == HIPBLAS_COMPUTE_64F || compute_type == HIPBLAS_COMPUTE_64F_PEDANTIC)
+    {
+        double double_one = 1;
+        memcpy(one, &double_one, sizeof(double_one));
+    }
+    else
+    {
+        float float_one = 1;
+        memcpy(one, &float_one, sizeof(float_one));
+    }
+}
+
+// bytes rounded up so that what follows them in the scratch memory stays aligned
+inline size_t hipblas_scratch_pad(size_t bytes)
+{
+    constexpr size_t align = 256;
+    return (bytes + align - 1) / align * align;
+}
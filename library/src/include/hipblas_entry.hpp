@@ -0,0 +1,76 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+#include "hipblas_shared_workspace.hpp"
+#include "hipblas_statistics.hpp"
+#include "hipblas_thread_stream.hpp"
+#include "hipblas_trace.hpp"
+
+#include <utility>
+
+// The status of an invalid enum converted for the backend by the call of the calling thread, see
+// amd_detail/hipblas_convert.hpp. A call entered with HIPBLAS_ENTRY starts without one and
+// restores that of its caller when it returns, however it returns, so that a call returning
+// before it checks the status doesn't pass it on to the next call.
+inline thread_local hipblasStatus_t hipblas_enum_status = HIPBLAS_STATUS_SUCCESS;
+
+// The entry of every hipBLAS function that runs work with a handle, including the functions built
+// on other hipBLAS functions and those taking an object created with a handle, for the lifetime
+// of the call. The functions that create, configure or query a handle have none. The call is
+// counted in the statistics of the handle it is made with, which is then replaced by the handle
+// of the stream bound to it for the calling thread, if any (see hipblasSetStreamForThread), so
+// that the call, and every call it makes, runs on that stream and in the modes of that handle. A
+// handle sharing a workspace (see hipblasCreateWithSharedWorkspace) then holds it for the call.
+class hipblasEntryScope
+{
+    hipblasStatus_t             m_enum_status; // of the caller, restored when the call returns
+    hipblasStatisticsScope      m_statistics;
+    hipblasSharedWorkspaceScope m_shared_workspace;
+
+public:
+    // The arguments after handle are those of HIPBLAS_ENTRY, which are ignored
+    template <typename... Args>
+    hipblasEntryScope(const char* function, hipblasHandle_t& handle, const Args&...)
+        : m_enum_status(std::exchange(hipblas_enum_status, HIPBLAS_STATUS_SUCCESS))
+        , m_statistics(function, handle)
+        , m_shared_workspace(handle = hipblasThreadStreamHandle(handle))
+    {
+    }
+
+    ~hipblasEntryScope()
+    {
+        hipblas_enum_status = m_enum_status;
+    }
+
+    hipblasEntryScope(const hipblasEntryScope&) = delete;
+    hipblasEntryScope& operator=(const hipblasEntryScope&) = delete;
+};
+
+// Enters the enclosing hipBLAS function with hipblasEntryScope, then traces it with HIPBLAS_TRACE
+// on the handle it runs on. The arguments are those of HIPBLAS_TRACE, the handle followed by the
+// scalar arguments of the function.
+#define HIPBLAS_ENTRY(...)                                        \
+    hipblasEntryScope hipblas_entry_scope(__func__, __VA_ARGS__); \
+    HIPBLAS_TRACE(__VA_ARGS__)
@@ -0,0 +1,63 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+
+#include <cstdint>
+
+// Strided batched gemms whose problems share A, with strideA == 0, computed as one gemm of
+// op(A) with the B of every problem side by side, which the strided batched gemmEx functions of
+// both backends try first. It reads A once instead of once per problem, and a batch of small
+// problems becomes one large one. That needs the columns of op(B) and of C of consecutive
+// problems to follow each other in memory: strideB == n * ldb, or strideB == n with op(B) = B**T
+// or B**H, and strideC == n * ldc.
+//
+// Returns HIPBLAS_STATUS_NOT_SUPPORTED, without any work queued, for the calls it doesn't take,
+// which the caller then passes to the backend: other strides and layouts, batches of one,
+// invalid arguments and the quick returns of the backend, and any call when
+// HIPBLAS_BROADCAST_GEMM=0 is set.
+hipblasStatus_t hipblasBroadcastGemm(hipblasHandle_t      handle,
+                                     hipblasOperation_t   transA,
+                                     hipblasOperation_t   transB,
+                                     int64_t              m,
+                                     int64_t              n,
+                                     int64_t              k,
+                                     const void*          alpha,
+                                     const void*          A,
+                                     hipDataType          aType,
+                                     int64_t              lda,
+                                     hipblasStride        strideA,
+                                     const void*          B,
+                                     hipDataType          bType,
+                                     int64_t              ldb,
+                                     hipblasStride        strideB,
+                                     const void*          beta,
+                                     void*                C,
+                                     hipDataType          cType,
+                                     int64_t              ldc,
+                                     hipblasStride        strideC,
+                                     int64_t              batchCount,
+                                     hipblasComputeType_t computeType,
+                                     hipblasGemmAlgo_t    algo,
+                                     hipblasGemmFlags_t   flags);
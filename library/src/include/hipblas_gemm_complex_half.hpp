@@ -0,0 +1,66 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+
+// The gemmEx and gemmStridedBatchedEx of complex half and bfloat16 matrices, computed in float by
+// hipblas_gemm_complex_half.cpp, which the functions of both backends try first, as neither
+// backend has complex gemms of these types. The real and imaginary parts of op(A) and op(B) are
+// split into half or bfloat16 planes, multiplied by the real gemms of the backend with float
+// outputs, four of them or, in HIPBLAS_GEMM_3M_MATH mode, the three of the 3M algorithm, and
+// added to beta * C.
+//
+// It takes aType and bType both HIP_C_16F or both HIP_C_16BF, with a cType of aType or HIP_C_32F
+// and a computeType of HIPBLAS_COMPUTE_32F, the scalars being hipFloatComplex, and reports the
+// invalid arguments of these calls itself. It returns HIPBLAS_STATUS_NOT_SUPPORTED, without any
+// work queued, for the calls of other types, which the caller then passes to the backend.
+//
+// Only the int32 hipblasGemmEx and hipblasGemmStridedBatchedEx of the HIPBLAS_V2 interface call
+// it. hipblasGemmEx_64 and hipblasGemmStridedBatchedEx_64 pass their calls straight to the
+// backend, as they do for the other int32 paths of these functions, so complex half and bfloat16
+// problems get the NOT_SUPPORTED status of the backend there.
+
+// The gemmEx of batchCount problems, with strides of 0 for a single one
+hipblasStatus_t hipblasComplexHalfGemmEx(hipblasHandle_t      handle,
+                                         hipblasOperation_t   transA,
+                                         hipblasOperation_t   transB,
+                                         int                  m,
+                                         int                  n,
+                                         int                  k,
+                                         const void*          alpha,
+                                         const void*          A,
+                                         hipDataType          aType,
+                                         int                  lda,
+                                         hipblasStride        strideA,
+                                         const void*          B,
+                                         hipDataType          bType,
+                                         int                  ldb,
+                                         hipblasStride        strideB,
+                                         const void*          beta,
+                                         void*                C,
+                                         hipDataType          cType,
+                                         int                  ldc,
+                                         hipblasStride        strideC,
+                                         int                  batchCount,
+                                         hipblasComputeType_t computeType);
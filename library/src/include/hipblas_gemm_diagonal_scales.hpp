@@ -0,0 +1,54 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+
+// The fused path of hipblasGemmExWithDiagonalScales, defined by each backend: hipBLASLt on the
+// rocBLAS backend and cuBLASLt on the cuBLAS backend, with rowScale and colScale as the outer
+// vector scales of A and B, which are applied as op(A) and op(B) are loaded. Called with the
+// arguments already checked and at least one of the scales given.
+//
+// Returns HIPBLAS_STATUS_NOT_SUPPORTED, without any work queued, for the problems the Lt library
+// doesn't take, including builds without it, which hipblas_gemm_diagonal_scales.cpp then
+// computes with a gemm and a scaling kernel of its own.
+hipblasStatus_t hipblasLtGemmDiagonalScales(hipblasHandle_t      handle,
+                                            hipblasOperation_t   transA,
+                                            hipblasOperation_t   transB,
+                                            int                  m,
+                                            int                  n,
+                                            int                  k,
+                                            const void*          alpha,
+                                            const void*          A,
+                                            hipDataType          aType,
+                                            int                  lda,
+                                            const void*          B,
+                                            hipDataType          bType,
+                                            int                  ldb,
+                                            const void*          beta,
+                                            void*                C,
+                                            hipDataType          cType,
+                                            int                  ldc,
+                                            hipblasComputeType_t computeType,
+                                            const float*         rowScale,
+                                            const float*         colScale);
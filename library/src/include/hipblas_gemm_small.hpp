@@ -0,0 +1,64 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+
+#include <cstdint>
+
+// Batched gemms of small matrices, with m, n and k at most 32, computed by the kernels of
+// hipblas_gemm_small.cpp instead of the backend, which the batched and strided batched gemmEx
+// functions of both backends try first. The problems are padded to a size of 4, 8, 16 or 32
+// known at compile time, and a block computes several of them at once, with op(A) and op(B) of
+// each in shared memory and C in registers.
+//
+// Returns HIPBLAS_STATUS_NOT_SUPPORTED, without any work queued, for the calls it doesn't take,
+// which the caller then passes to the backend: types other than float, double,
+// hipFloatComplex and hipDoubleComplex with the compute type of their precision, larger sizes,
+// batches too small to be worth a kernel of their own, invalid arguments, which the backend
+// reports, and any call when HIPBLAS_SMALL_GEMM=0 is set. A, B and C are arrays of pointers
+// when batched, and the first matrix of a strided batch otherwise. The strided batches of a handle
+// in HIPBLAS_BATCH_LAYOUT_INTERLEAVED mode all go to hipblasInterleavedGemm instead.
+hipblasStatus_t hipblasSmallGemm(hipblasHandle_t      handle,
+                                 hipblasOperation_t   transA,
+                                 hipblasOperation_t   transB,
+                                 int64_t              m,
+                                 int64_t              n,
+                                 int64_t              k,
+                                 const void*          alpha,
+                                 const void*          A,
+                                 hipDataType          aType,
+                                 int64_t              lda,
+                                 hipblasStride        strideA,
+                                 const void*          B,
+                                 hipDataType          bType,
+                                 int64_t              ldb,
+                                 hipblasStride        strideB,
+                                 const void*          beta,
+                                 void*                C,
+                                 hipDataType          cType,
+                                 int64_t              ldc,
+                                 hipblasStride        strideC,
+                                 int64_t              batchCount,
+                                 hipblasComputeType_t computeType,
+                                 bool                 batched);
@@ -0,0 +1,480 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Streams forked from the stream of a handle to run the problems of a batch concurrently, with
+// the events that order them after and before the stream of the handle. Created on first use
+// by the batched fallbacks of the cuBLAS backend and destroyed with the handle.
+struct hipblasStreamPool
+{
+    hipEvent_t               fork = nullptr;
+    std::vector<hipStream_t> streams;
+    std::vector<hipEvent_t>  joins;
+
+    hipblasStreamPool() = default;
+    ~hipblasStreamPool();
+
+    hipblasStreamPool(const hipblasStreamPool&) = delete;
+    hipblasStreamPool& operator=(const hipblasStreamPool&) = delete;
+};
+
+// The stream of a handle set with hipblasSetComputePartition, whose kernels only run on some
+// compute units, or with hipblasSetPriority, and the stream of the handle it replaced.
+// Destroyed with the handle.
+struct hipblasPartitionStream
+{
+    hipStream_t       stream   = nullptr;
+    hipStream_t       replaced = nullptr;
+    hipblasPriority_t priority = HIPBLAS_PRIORITY_DEFAULT;
+
+    hipblasPartitionStream() = default;
+    ~hipblasPartitionStream();
+
+    hipblasPartitionStream(const hipblasPartitionStream&) = delete;
+    hipblasPartitionStream& operator=(const hipblasPartitionStream&) = delete;
+};
+
+// A gemm queued between hipblasBeginBatch and hipblasEndBatch. Scalars given in host pointer
+// mode are copied, so the caller's alpha and beta needn't outlive the call.
+struct hipblasDeferredGemm
+{
+    hipDataType        type;
+    hipblasOperation_t transa, transb;
+    int                m, n, k, lda, ldb, ldc;
+    bool               host_scalars;
+    const void*        alpha_ptr;
+    const void*        beta_ptr;
+    double             alpha[2], beta[2];
+    const void*        A;
+    const void*        B;
+    void*              C;
+};
+
+// A real scal or axpy with unit increments and a host scalar held back between
+// hipblasBeginBatch and hipblasEndBatch, to be folded into the next call. y is the vector
+// written, x of scal and y of axpy, and x the vector axpy reads.
+struct hipblasDeferredVector
+{
+    hipDataType type;
+    bool        axpy;
+    int         n;
+    double      alpha;
+    const void* x;
+    void*       y;
+};
+
+// Gemms of a handle queued between hipblasBeginBatch and hipblasEndBatch, with the device
+// memory the pointer arrays of their batched calls are copied to
+struct hipblasDeferredGemms
+{
+    std::vector<hipblasDeferredGemm> queue;
+    void*                            device_pointers      = nullptr;
+    size_t                           device_pointers_size = 0;
+
+    // the scal or axpy held back, if vector_pending, and whether it is being run
+    hipblasDeferredVector vector         = {};
+    bool                  vector_pending = false;
+    bool                  releasing      = false;
+
+    hipblasDeferredGemms() = default;
+    ~hipblasDeferredGemms();
+
+    hipblasDeferredGemms(const hipblasDeferredGemms&) = delete;
+    hipblasDeferredGemms& operator=(const hipblasDeferredGemms&) = delete;
+};
+
+// The region of a handle between hipblasBeginRegion and hipblasEndRegion, with the graph
+// executables instantiated by hipblasEndRegion, keyed by the key of their region. Destroyed with
+// the handle.
+struct hipblasRegions
+{
+    bool active = false;
+
+    // false if the stream was already being captured by the caller when the region began
+    bool capturing = false;
+
+    uint64_t    key    = 0;
+    hipStream_t stream = nullptr;
+
+    // the handle the calls of the region run on, and its graph capture mode before the region
+    hipblasHandle_t           stream_handle        = nullptr;
+    hipblasGraphCaptureMode_t graph_capture_before = HIPBLAS_GRAPH_CAPTURE_DEFAULT;
+
+    std::unordered_map<uint64_t, hipGraphExec_t> graphs;
+
+    hipblasRegions() = default;
+    ~hipblasRegions();
+
+    hipblasRegions(const hipblasRegions&) = delete;
+    hipblasRegions& operator=(const hipblasRegions&) = delete;
+};
+
+// The resident gemv kernel of a handle between hipblasPersistentStart and hipblasPersistentStop,
+// with the ring of calls queued to it, see hipblas_persistent.cpp. Stopped with the handle.
+struct hipblasPersistentQueue
+{
+    struct hipblasPersistentRing* ring     = nullptr; // host memory mapped to the device
+    struct hipblasPersistentRing* d_ring   = nullptr; // its device address
+    uint64_t*                     counters = nullptr; // device memory of the kernel
+    hipStream_t                   stream   = nullptr; // the stream the kernel runs on
+    int                           size     = 0;       // calls the ring holds
+    uint64_t                      tail     = 0;       // calls queued since the start
+
+    hipblasPersistentQueue() = default;
+    ~hipblasPersistentQueue();
+
+    hipblasPersistentQueue(const hipblasPersistentQueue&) = delete;
+    hipblasPersistentQueue& operator=(const hipblasPersistentQueue&) = delete;
+};
+
+// Device memory of a handle for the intermediate results of hipBLAS functions built on other
+// functions, grown as needed and freed with the handle
+struct hipblasScratch
+{
+    void*        data   = nullptr;
+    size_t       size   = 0;
+    hipStream_t  stream = nullptr;
+    hipMemPool_t pool   = nullptr; // pool data was allocated from, nullptr if from hipMalloc
+
+    hipblasScratch() = default;
+    ~hipblasScratch();
+
+    hipblasScratch(const hipblasScratch&) = delete;
+    hipblasScratch& operator=(const hipblasScratch&) = delete;
+};
+
+// Statistics of a handle counted in a statistics mode by hipblasStatisticsScope, with the events
+// of the calls timed in HIPBLAS_STATISTICS_TIMED mode. Destroyed with the handle.
+struct hipblasStatisticsCounters
+{
+    struct routine_counters
+    {
+        uint64_t calls       = 0;
+        double   gpu_time_ms = 0;
+    };
+
+    // a timed call whose events may not have completed
+    struct pending_call
+    {
+        routine_counters* routine;
+        hipEvent_t        start, stop;
+    };
+
+    std::mutex mutex;
+
+    hipblasStatistics totals = {};
+
+    // keyed by the __func__ of the functions
+    std::unordered_map<const char*, routine_counters> routines;
+
+    std::vector<pending_call> pending;
+    std::vector<hipEvent_t>   free_events;
+
+    hipblasStatisticsCounters() = default;
+    ~hipblasStatisticsCounters();
+
+    hipblasStatisticsCounters(const hipblasStatisticsCounters&) = delete;
+    hipblasStatisticsCounters& operator=(const hipblasStatisticsCounters&) = delete;
+};
+
+// The gemm backend of the handles on which hipblasSetGemmBackend wasn't called:
+// HIPBLAS_GEMM_BACKEND_LT if the environment variable HIPBLAS_GEMM_BACKEND is lt
+hipblasGemmBackend_t hipblasDefaultGemmBackend();
+
+// hipblasHandle_t is the backend (rocBLAS or cuBLAS) handle itself, so state that hipBLAS
+// keeps on top of the backend lives in a side table keyed by the handle. Entries are created
+// on first use and removed by hipblasDestroy.
+struct hipblasHandleState
+{
+    // size of the workspace set with hipblasSetWorkspace, 0 if the backend manages it
+    size_t workspace_size = 0;
+
+    // set with hipblasSetWorkspaceLimit, 0 if the workspace grows to what the calls need
+    size_t workspace_limit = 0;
+
+    // the workspace of the cuBLAS backend sized to workspace_limit
+    hipblasScratch limit_workspace;
+
+    // set with hipblasSetWorkspaceMemPool, nullptr to allocate with hipMalloc
+    hipMemPool_t workspace_pool = nullptr;
+
+    // the workspace of the rocBLAS backend while it is allocated from workspace_pool
+    hipblasScratch pool_workspace;
+
+    // between hipblasStartWorkspaceQuery and hipblasStopWorkspaceQuery on backends without a
+    // native workspace size query
+    bool workspace_query = false;
+
+    // set with hipblasSetGraphCaptureMode through hipblasSetHandleGraphCaptureMode
+    hipblasGraphCaptureMode_t graph_capture_mode = HIPBLAS_GRAPH_CAPTURE_DEFAULT;
+
+    // set with hipblasSetInfoMode through hipblasSetHandleInfoMode
+    hipblasInfoMode_t info_mode = HIPBLAS_INFO_MODE_HOST;
+
+    // set with hipblasSetComputePartition and hipblasSetPriority through
+    // hipblasSetHandlePartitionStream
+    hipblasPartitionStream partition;
+
+    // used by the batched fallbacks of the cuBLAS backend
+    hipblasStreamPool stream_pool;
+
+    // between hipblasBeginBatch and hipblasEndBatch, set through hipblasSetHandleDeferring
+    bool deferring = false;
+
+    // gemms queued while deferring
+    hipblasDeferredGemms deferred;
+
+    // see hipblasBeginRegion
+    hipblasRegions regions;
+
+    // between hipblasPersistentStart and hipblasPersistentStop, set through
+    // hipblasSetHandlePersistent, with the kernel the gemvs are queued to
+    bool                   persistent = false;
+    hipblasPersistentQueue persistent_queue;
+
+    // set with hipblasSetMathMode(HIPBLAS_GEMM_3M_MATH) through hipblasSetHandleGemm3m
+    bool gemm_3m = false;
+
+    // set with hipblasSetPointerMode(HIPBLAS_POINTER_MODE_PINNED_HOST) through
+    // hipblasSetHandlePinnedHostResults
+    bool pinned_host_results = false;
+
+    // set with hipblasSetReproducibilityMode through hipblasSetHandleReproducibilityMode
+    hipblasReproducibilityMode_t reproducibility_mode = HIPBLAS_REPRODUCIBILITY_DEFAULT;
+
+    // the atomics mode restored when the reproducibility mode is set back to the default
+    hipblasAtomicsMode_t atomics_mode_before_reproducible = HIPBLAS_ATOMICS_ALLOWED;
+
+    // set with hipblasSetHostDispatchMode through hipblasSetHandleHostDispatchMode
+    hipblasHostDispatchMode_t host_dispatch_mode = HIPBLAS_HOST_DISPATCH_NONE;
+
+    // set with hipblasSetHostDispatchThreshold, indexed by hipblasHostDispatchFunction_t: the
+    // multiply-adds of n for axpy, scal and dot, m * n for gemv and m * n * k for gemm
+    int64_t host_dispatch_thresholds[HIPBLAS_HOST_DISPATCH_GEMM + 1]
+        = {1 << 16, 1 << 16, 1 << 16, 1 << 16, 1 << 18};
+
+    // set with hipblasSetManagedPrefetchMode through hipblasSetHandleManagedPrefetchMode
+    hipblasManagedPrefetchMode_t managed_prefetch_mode = HIPBLAS_MANAGED_PREFETCH_NONE;
+
+    // set with hipblasSetGemmBackend through hipblasSetHandleGemmBackend, defaulting to the
+    // HIPBLAS_GEMM_BACKEND environment variable
+    hipblasGemmBackend_t gemm_backend = hipblasDefaultGemmBackend();
+
+    // set with hipblasSetBatchLayout through hipblasSetHandleBatchLayout
+    hipblasBatchLayout_t batch_layout = HIPBLAS_BATCH_LAYOUT_STRIDED;
+
+    // set with hipblasSetShapeDispatchMode through hipblasSetHandleShapeDispatchMode
+    hipblasShapeDispatchMode_t shape_dispatch_mode = HIPBLAS_SHAPE_DISPATCH_NONE;
+
+    // the ranges [first, second) of memory prefetched to the device in
+    // HIPBLAS_MANAGED_PREFETCH_DEVICE mode, forgotten when the mode is set
+    std::map<uintptr_t, uintptr_t> managed_prefetched;
+
+    // set with hipblasSetRoundingMode through hipblasSetHandleRoundingMode, with the seed of
+    // HIPBLAS_ROUND_STOCHASTIC and the number of stochastically rounded calls since it was set
+    hipblasRoundingMode_t rounding_mode  = HIPBLAS_ROUND_NEAREST_EVEN;
+    uint64_t              rounding_seed  = 0;
+    uint64_t              rounding_calls = 0;
+
+    // set with hipblasSetStatisticsMode through hipblasSetHandleStatisticsMode
+    hipblasStatisticsMode_t statistics_mode = HIPBLAS_STATISTICS_NONE;
+
+    // counted in a statistics mode, see hipblas_statistics.hpp
+    hipblasStatisticsCounters statistics;
+
+    // see hipblasGetScratch
+    hipblasScratch scratch;
+
+    // see hipblasGetRoundingScratch
+    hipblasScratch rounding_scratch;
+};
+
+// Returns the state of handle, creating it if needed. handle must not be nullptr.
+hipblasHandleState* hipblasGetHandleState(hipblasHandle_t handle);
+
+// Removes the state of handle. Called from hipblasDestroy.
+void hipblasDestroyHandleState(hipblasHandle_t handle);
+
+// Returns at least size bytes of the scratch memory of handle for use on stream, or nullptr if
+// they can't be allocated. The memory is shared by every use on the handle, so a use on
+// another stream than the previous one first waits for the previous stream. When the handle
+// has a workspace pool, the memory is instead freed on the previous stream and allocated again
+// from the pool on stream, so that no use waits for the device.
+void* hipblasGetScratch(hipblasHandle_t handle, size_t size, hipStream_t stream);
+
+// Returns scratch memory as hipblasGetScratch does, but not the same, for the outputs computed in
+// float by hipblas_rounding.cpp and the planes of hipblas_gemm_complex_half.cpp, which are written
+// or read by functions that may themselves have intermediate results or a workspace in the
+// scratch memory of hipblasGetScratch
+void* hipblasGetRoundingScratch(hipblasHandle_t handle, size_t size, hipStream_t stream);
+
+// Frees the memory of scratch: on the stream of its last use if it came from a pool, without
+// waiting, and with hipFree otherwise
+void hipblasFreeScratch(hipblasScratch& scratch);
+
+// Sets the graph capture mode of handle.
+void hipblasSetHandleGraphCaptureMode(hipblasHandle_t handle, hipblasGraphCaptureMode_t mode);
+
+// Returns true if handle is in HIPBLAS_GRAPH_CAPTURE_SAFE mode. While no handle is, this is a
+// single atomic load and doesn't look up the handle.
+bool hipblasIsGraphCaptureSafe(hipblasHandle_t handle);
+
+// Sets the solver info mode of handle.
+void hipblasSetHandleInfoMode(hipblasHandle_t handle, hipblasInfoMode_t mode);
+
+// Returns true if handle is in HIPBLAS_INFO_MODE_DEVICE mode. While no handle is, this is a
+// single atomic load and doesn't look up the handle.
+bool hipblasIsDeviceInfoMode(hipblasHandle_t handle);
+
+// Makes stream, which replaced the stream `replaced` of handle, the partition stream of handle,
+// destroying the previous one. The work already queued on the previous one still runs. Passing
+// stream == nullptr ends the partition. priority is that of a stream set with hipblasSetPriority.
+void hipblasSetHandlePartitionStream(hipblasHandle_t   handle,
+                                     hipStream_t       stream,
+                                     hipStream_t       replaced,
+                                     hipblasPriority_t priority = HIPBLAS_PRIORITY_DEFAULT);
+
+// Returns true if handle has a stream set with hipblasSetComputePartition or hipblasSetPriority.
+// While no handle has, this is a single atomic load and doesn't look up the handle.
+bool hipblasHasComputePartition(hipblasHandle_t handle);
+
+// Sets whether the gemms of handle are queued until hipblasEndBatch.
+void hipblasSetHandleDeferring(hipblasHandle_t handle, bool deferring);
+
+// Returns true if handle is between hipblasBeginBatch and hipblasEndBatch. While no handle is,
+// this is a single atomic load and doesn't look up the handle.
+bool hipblasIsDeferring(hipblasHandle_t handle);
+
+// Sets whether the gemvs of handle are queued to its resident kernel.
+void hipblasSetHandlePersistent(hipblasHandle_t handle, bool persistent);
+
+// Returns true if handle is between hipblasPersistentStart and hipblasPersistentStop. While no
+// handle is, this is a single atomic load and doesn't look up the handle.
+bool hipblasIsPersistent(hipblasHandle_t handle);
+
+// Sets whether the complex gemms of handle use the 3M algorithm.
+void hipblasSetHandleGemm3m(hipblasHandle_t handle, bool gemm_3m);
+
+// Returns true if handle is in HIPBLAS_GEMM_3M_MATH mode. While no handle is, this is a single
+// atomic load and doesn't look up the handle.
+bool hipblasIsGemm3m(hipblasHandle_t handle);
+
+// Sets whether handle is in HIPBLAS_POINTER_MODE_PINNED_HOST mode, in which the backend is in
+// host pointer mode.
+void hipblasSetHandlePinnedHostResults(hipblasHandle_t handle, bool pinned_host_results);
+
+// Returns true if handle is in HIPBLAS_POINTER_MODE_PINNED_HOST mode. While no handle is, this is
+// a single atomic load and doesn't look up the handle.
+bool hipblasIsPinnedHostResults(hipblasHandle_t handle);
+
+// Puts handle in device pointer mode for the lifetime of the scope when it is in
+// HIPBLAS_POINTER_MODE_PINNED_HOST mode, so that the reduction called in the scope writes its
+// results to the pinned host memory on the stream instead of copying them and waiting. Does
+// nothing in the other modes.
+class hipblasPinnedHostResultScope
+{
+    hipblasHandle_t handle = nullptr; // set when the pointer mode was switched
+
+public:
+    explicit hipblasPinnedHostResultScope(hipblasHandle_t handle);
+    ~hipblasPinnedHostResultScope();
+
+    hipblasPinnedHostResultScope(const hipblasPinnedHostResultScope&) = delete;
+    hipblasPinnedHostResultScope& operator=(const hipblasPinnedHostResultScope&) = delete;
+};
+
+// Sets the reproducibility mode of handle.
+void hipblasSetHandleReproducibilityMode(hipblasHandle_t handle, hipblasReproducibilityMode_t mode);
+
+// Returns true if handle is in HIPBLAS_REPRODUCIBILITY_BITWISE mode. While no handle is, this is
+// a single atomic load and doesn't look up the handle.
+bool hipblasIsReproducible(hipblasHandle_t handle);
+
+// Sets the host dispatch mode of handle.
+void hipblasSetHandleHostDispatchMode(hipblasHandle_t handle, hipblasHostDispatchMode_t mode);
+
+// Returns true if handle is in HIPBLAS_HOST_DISPATCH_SMALL mode and size is below its threshold
+// for function. While no handle is in the mode, this is a single atomic load and doesn't look up
+// the handle.
+bool hipblasIsHostDispatch(hipblasHandle_t               handle,
+                           hipblasHostDispatchFunction_t function,
+                           int64_t                       size);
+
+// Sets the managed memory prefetch mode of handle and forgets the ranges it prefetched.
+void hipblasSetHandleManagedPrefetchMode(hipblasHandle_t              handle,
+                                         hipblasManagedPrefetchMode_t mode);
+
+// Returns true if handle is in HIPBLAS_MANAGED_PREFETCH_DEVICE mode. While no handle is, this is
+// a single atomic load and doesn't look up the handle.
+bool hipblasIsManagedPrefetch(hipblasHandle_t handle);
+
+// Sets the gemm backend of handle.
+void hipblasSetHandleGemmBackend(hipblasHandle_t handle, hipblasGemmBackend_t backend);
+
+// Returns true if handle is in HIPBLAS_GEMM_BACKEND_LT mode. While every handle is in the
+// default mode of hipblasDefaultGemmBackend, HIPBLAS_GEMM_BACKEND_DEFAULT, this is a single atomic
+// load and doesn't look up the handle.
+bool hipblasIsGemmBackendLt(hipblasHandle_t handle);
+
+// Sets the layout of the strided batched functions of handle.
+void hipblasSetHandleBatchLayout(hipblasHandle_t handle, hipblasBatchLayout_t layout);
+
+// Returns true if handle is in HIPBLAS_BATCH_LAYOUT_INTERLEAVED mode. While no handle is, this is
+// a single atomic load and doesn't look up the handle.
+bool hipblasIsInterleavedBatch(hipblasHandle_t handle);
+
+// Sets the shape dispatch mode of handle.
+void hipblasSetHandleShapeDispatchMode(hipblasHandle_t handle, hipblasShapeDispatchMode_t mode);
+
+// Returns true if handle is in HIPBLAS_SHAPE_DISPATCH_ALLOWED mode. While no handle is, this is
+// a single atomic load and doesn't look up the handle.
+bool hipblasIsShapeDispatch(hipblasHandle_t handle);
+
+// Sets the rounding mode of handle and its seed, and starts the count of its stochastically
+// rounded calls again.
+void hipblasSetHandleRoundingMode(hipblasHandle_t       handle,
+                                  hipblasRoundingMode_t mode,
+                                  uint64_t              seed);
+
+// Returns the rounding mode of handle. While no handle is in another mode than
+// HIPBLAS_ROUND_NEAREST_EVEN, this is a single atomic load and doesn't look up the handle.
+hipblasRoundingMode_t hipblasGetHandleRoundingMode(hipblasHandle_t handle);
+
+// Returns the seed of the random bits of the next stochastically rounded call of handle, a hash
+// of the seed of handle and the number of such calls since it was set, and counts the call.
+uint64_t hipblasNextStochasticSeed(hipblasHandle_t handle);
+
+// Sets the statistics mode of handle.
+void hipblasSetHandleStatisticsMode(hipblasHandle_t handle, hipblasStatisticsMode_t mode);
+
+// Returns the statistics mode of handle. While no handle is in another mode than
+// HIPBLAS_STATISTICS_NONE, this is a single atomic load and doesn't look up the handle.
+hipblasStatisticsMode_t hipblasGetHandleStatisticsMode(hipblasHandle_t handle);
@@ -0,0 +1,88 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+
+// The axpy, scal, dot, gemv and gemm of float, double, hipFloatComplex and hipDoubleComplex
+// computed on the host by hipblas_host_dispatch.cpp, which the functions of both backends try
+// first for handles in HIPBLAS_HOST_DISPATCH_SMALL mode (see hipblasSetHostDispatchMode).
+// dataType is the type of the matrices, vectors and scalars.
+//
+// Return HIPBLAS_STATUS_NOT_SUPPORTED, without waiting for the stream, for the calls they don't
+// take, which the caller then passes to the backend: handles not in the mode, sizes at or above
+// the threshold of the function, device memory, device pointer mode, empty problems and invalid
+// arguments, which the backend reports.
+
+hipblasStatus_t hipblasHostAxpy(hipblasHandle_t handle,
+                                int             n,
+                                const void*     alpha,
+                                const void*     x,
+                                int             incx,
+                                void*           y,
+                                int             incy,
+                                hipDataType     dataType);
+
+hipblasStatus_t hipblasHostScal(
+    hipblasHandle_t handle, int n, const void* alpha, void* x, int incx, hipDataType dataType);
+
+// conj(x) . y when conj, and x . y otherwise
+hipblasStatus_t hipblasHostDot(hipblasHandle_t handle,
+                               int             n,
+                               const void*     x,
+                               int             incx,
+                               const void*     y,
+                               int             incy,
+                               void*           result,
+                               hipDataType     dataType,
+                               bool            conj);
+
+hipblasStatus_t hipblasHostGemv(hipblasHandle_t    handle,
+                                hipblasOperation_t trans,
+                                int                m,
+                                int                n,
+                                const void*        alpha,
+                                const void*        A,
+                                int                lda,
+                                const void*        x,
+                                int                incx,
+                                const void*        beta,
+                                void*              y,
+                                int                incy,
+                                hipDataType        dataType);
+
+hipblasStatus_t hipblasHostGemm(hipblasHandle_t    handle,
+                                hipblasOperation_t transA,
+                                hipblasOperation_t transB,
+                                int                m,
+                                int                n,
+                                int                k,
+                                const void*        alpha,
+                                const void*        A,
+                                int                lda,
+                                const void*        B,
+                                int                ldb,
+                                const void*        beta,
+                                void*              C,
+                                int                ldc,
+                                hipDataType        dataType);
@@ -0,0 +1,109 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+
+#include <cstdint>
+
+// The strided batched functions of a handle in HIPBLAS_BATCH_LAYOUT_INTERLEAVED mode, computed
+// by the kernels of hipblas_interleaved_batch.cpp, as the backends only know the strided layout.
+// Element (i, j) of matrix b of X is X[b + (i + j * ldx) * strideX], and the pivot j of matrix b
+// is ipiv[b + j * strideP]. hipblasSmallGemm and hipblasSmallTrsm hand their strided batched
+// calls to these functions in this mode, and the getrf and getrs strided batched functions of
+// both backends call them directly, after their own checks for getrs.
+//
+// They take the types float, double, hipFloatComplex and hipDoubleComplex, with the compute type
+// of their precision for the gemm, and return HIPBLAS_STATUS_INVALID_VALUE for the others, which
+// the backends can't compute in this layout either, and for strides less than batchCount.
+hipblasStatus_t hipblasInterleavedGemm(hipblasHandle_t      handle,
+                                       hipblasOperation_t   transA,
+                                       hipblasOperation_t   transB,
+                                       int64_t              m,
+                                       int64_t              n,
+                                       int64_t              k,
+                                       const void*          alpha,
+                                       const void*          A,
+                                       hipDataType          aType,
+                                       int64_t              lda,
+                                       hipblasStride        strideA,
+                                       const void*          B,
+                                       hipDataType          bType,
+                                       int64_t              ldb,
+                                       hipblasStride        strideB,
+                                       const void*          beta,
+                                       void*                C,
+                                       hipDataType          cType,
+                                       int64_t              ldc,
+                                       hipblasStride        strideC,
+                                       int64_t              batchCount,
+                                       hipblasComputeType_t computeType);
+
+hipblasStatus_t hipblasInterleavedTrsm(hipblasHandle_t    handle,
+                                       hipblasSideMode_t  side,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const void*        alpha,
+                                       const void*        A,
+                                       hipDataType        dataType,
+                                       int64_t            lda,
+                                       hipblasStride      strideA,
+                                       void*              B,
+                                       int64_t            ldb,
+                                       hipblasStride      strideB,
+                                       int64_t            batchCount);
+
+// LU factorizations with partial pivoting, or without when ipiv is nullptr, and info[b] the
+// first zero pivot of matrix b, from 1, or 0 if it has none, as getrf
+hipblasStatus_t hipblasInterleavedGetrf(hipblasHandle_t handle,
+                                        int64_t         n,
+                                        void*           A,
+                                        hipDataType     dataType,
+                                        int64_t         lda,
+                                        hipblasStride   strideA,
+                                        int*            ipiv,
+                                        hipblasStride   strideP,
+                                        int*            info,
+                                        int64_t         batchCount);
+
+// The solves of getrs with the factorizations of hipblasInterleavedGetrf. The checks of the
+// arguments are written to the host info as by getrs, which returns
+// HIPBLAS_STATUS_INVALID_VALUE when one fails.
+hipblasStatus_t hipblasInterleavedGetrs(hipblasHandle_t    handle,
+                                        hipblasOperation_t trans,
+                                        int64_t            n,
+                                        int64_t            nrhs,
+                                        const void*        A,
+                                        hipDataType        dataType,
+                                        int64_t            lda,
+                                        hipblasStride      strideA,
+                                        const int*         ipiv,
+                                        hipblasStride      strideP,
+                                        void*              B,
+                                        int64_t            ldb,
+                                        hipblasStride      strideB,
+                                        int*               info,
+                                        int64_t            batchCount);
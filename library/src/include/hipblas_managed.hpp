@@ -0,0 +1,72 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// Prefetching of the operands in managed memory of the functions of both backends to the device
+// of the handle on its stream, by hipblas_managed.cpp, for handles in
+// HIPBLAS_MANAGED_PREFETCH_DEVICE mode (see hipblasSetManagedPrefetchMode). The functions do
+// nothing for other handles, for operands in other memory and for ranges the handle already
+// prefetched. A failed prefetch is ignored, as the kernels then migrate the memory themselves.
+
+// The A, B and C of a gemm, or of a strided batched gemm of batchCount gemms, of elements of
+// aSize, bSize and cSize bytes
+void hipblasPrefetchGemm(hipblasHandle_t    handle,
+                         hipblasOperation_t transA,
+                         hipblasOperation_t transB,
+                         int64_t            m,
+                         int64_t            n,
+                         int64_t            k,
+                         const void*        A,
+                         int64_t            lda,
+                         int64_t            strideA,
+                         const void*        B,
+                         int64_t            ldb,
+                         int64_t            strideB,
+                         const void*        C,
+                         int64_t            ldc,
+                         int64_t            strideC,
+                         int64_t            batchCount,
+                         size_t             aSize,
+                         size_t             bSize,
+                         size_t             cSize);
+
+// The A, x and y of a gemv of elements of elemSize bytes
+void hipblasPrefetchGemv(hipblasHandle_t    handle,
+                         hipblasOperation_t trans,
+                         int64_t            m,
+                         int64_t            n,
+                         const void*        A,
+                         int64_t            lda,
+                         const void*        x,
+                         int64_t            incx,
+                         const void*        y,
+                         int64_t            incy,
+                         size_t             elemSize);
+
+// The size of the elements of type, 0 for the types whose operands aren't prefetched
+size_t hipblasPrefetchTypeSize(hipDataType type);
@@ -0,0 +1,51 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+
+#include <cstdint>
+
+// The inverses of a batch of small general matrices, of order at most 32, by the kernel of
+// hipblas_matinv.cpp: a Gauss-Jordan elimination with partial pivoting of each matrix in shared
+// memory, so the factorization and the inversion are a single launch without pivot arrays. It
+// computes the matinvBatched and matinvStridedBatched functions of the rocBLAS backend, and the
+// matinvStridedBatched functions of the cuBLAS backend, which has no strided version of its own.
+//
+// A and Ainv are arrays of pointers when batched, and the first matrix of a strided batch
+// otherwise. info[b] is 0 when A_b is inverted, and j > 0 when the j-th pivot is zero, in which
+// case Ainv_b is undefined. Returns HIPBLAS_STATUS_INVALID_VALUE for n > 32, as cuBLAS does,
+// and HIPBLAS_STATUS_NOT_SUPPORTED for types other than float, double, hipFloatComplex and
+// hipDoubleComplex.
+hipblasStatus_t hipblasMatinv(hipblasHandle_t handle,
+                              int64_t         n,
+                              const void*     A,
+                              hipDataType     dataType,
+                              int64_t         lda,
+                              hipblasStride   strideA,
+                              void*           Ainv,
+                              int64_t         lda_inv,
+                              hipblasStride   strideAinv,
+                              int*            info,
+                              int64_t         batchCount,
+                              bool            batched);
@@ -0,0 +1,64 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+
+// Queues a gemv of a handle between hipblasPersistentStart and hipblasPersistentStop to its
+// resident kernel, for A and x of type HIP_R_16F, HIP_R_16BF or HIP_R_32F with a float compute
+// type, where y is of the type of A or HIP_R_32F, or all of type HIP_R_64F with a double
+// compute type. Returns HIPBLAS_STATUS_NOT_SUPPORTED when the handle isn't in persistent mode,
+// or, after waiting for the queued calls to be done, when the gemv isn't one of those or its
+// arguments are invalid, for the caller to run it as usual.
+hipblasStatus_t hipblasPersistentGemv(hipblasHandle_t      handle,
+                                      hipblasOperation_t   trans,
+                                      int                  m,
+                                      int                  n,
+                                      const void*          alpha,
+                                      const void*          A,
+                                      hipDataType          aType,
+                                      int                  lda,
+                                      const void*          x,
+                                      hipDataType          xType,
+                                      int                  incx,
+                                      const void*          beta,
+                                      void*                y,
+                                      hipDataType          yType,
+                                      int                  incy,
+                                      hipblasComputeType_t computeType);
+
+// The same for the gemv of type type, HIP_R_32F, HIP_R_64F, HIP_C_32F or HIP_C_64F, which is
+// queued for the real types
+hipblasStatus_t hipblasPersistentGemv(hipblasHandle_t    handle,
+                                      hipblasOperation_t trans,
+                                      int                m,
+                                      int                n,
+                                      const void*        alpha,
+                                      const void*        A,
+                                      int                lda,
+                                      const void*        x,
+                                      int                incx,
+                                      const void*        beta,
+                                      void*              y,
+                                      int                incy,
+                                      hipDataType        type);
@@ -0,0 +1,51 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+#include <cstdint>
+#include <string>
+
+// The shape of a traced call in the arguments of hipblas-bench, as used by the profile
+// written when HIPBLAS_PROFILE_FILE is set
+struct hipblasProfileShape
+{
+    std::string function; // the bench function, e.g. gemm_strided_batched_ex
+    std::string a_type;
+    std::string b_type;
+    std::string c_type;
+    std::string compute_type;
+    int64_t     M           = 0;
+    int64_t     N           = 0;
+    int64_t     K           = 0;
+    int64_t     KL          = 0;
+    int64_t     KU          = 0;
+    int64_t     batch_count = 1;
+    char        transA      = 'N';
+    char        side        = 'L';
+};
+
+// Sets the GFLOP and GB of a call of shape with the formulas used by hipblas-bench, including
+// all the problems of batched functions. Returns false if hipblas-bench has no formula for the
+// function, and sets gbyte to 0 if it only has one for the floating point operations.
+bool hipblasProfileCount(const hipblasProfileShape& shape, double& gflop, double& gbyte);
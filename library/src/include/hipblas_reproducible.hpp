@@ -0,0 +1,51 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+
+// The reductions of dot, dotc, asum, nrm2 and iamax on float, double, hipFloatComplex and
+// hipDoubleComplex vectors computed by hipBLAS in a fixed order, which the BLAS 1 functions of
+// both backends call instead of the backend for handles in HIPBLAS_REPRODUCIBILITY_BITWISE (see
+// hipblasSetReproducibilityMode). dataType is the type of the vectors, and the results are as
+// for the BLAS 1 functions they replace.
+
+// conj(x) . y when conj, and x . y otherwise
+hipblasStatus_t hipblasReproducibleDot(hipblasHandle_t handle,
+                                       int             n,
+                                       const void*     x,
+                                       int             incx,
+                                       const void*     y,
+                                       int             incy,
+                                       void*           result,
+                                       hipDataType     dataType,
+                                       bool            conj);
+
+hipblasStatus_t hipblasReproducibleAsum(
+    hipblasHandle_t handle, int n, const void* x, int incx, void* result, hipDataType dataType);
+
+hipblasStatus_t hipblasReproducibleNrm2(
+    hipblasHandle_t handle, int n, const void* x, int incx, void* result, hipDataType dataType);
+
+hipblasStatus_t hipblasReproducibleIamax(
+    hipblasHandle_t handle, int n, const void* x, int incx, int* result, hipDataType dataType);
@@ -0,0 +1,83 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+
+// The gemmEx, axpyEx and scalEx with half, bfloat16 or fp8 outputs computed in float, for
+// handles in the HIPBLAS_ROUND_TOWARD_ZERO or HIPBLAS_ROUND_STOCHASTIC rounding mode (see
+// hipblasSetRoundingMode), by hipblas_rounding.cpp, which the functions of both backends try
+// first. The output is computed in float in the memory of hipblasGetRoundingScratch and rounded
+// to its type in the mode of the handle by hipblasConvertStridedBatchedEx.
+//
+// Return HIPBLAS_STATUS_NOT_SUPPORTED, without any work queued, for the calls they don't take,
+// which the caller then passes to the backend: handles in HIPBLAS_ROUND_NEAREST_EVEN mode, other
+// types, empty problems and invalid arguments, which the backend reports.
+
+// The gemmEx of batchCount problems, with strides of 0 for a single one, of computeType
+// HIPBLAS_COMPUTE_32F
+hipblasStatus_t hipblasRoundedGemmEx(hipblasHandle_t      handle,
+                                     hipblasOperation_t   transA,
+                                     hipblasOperation_t   transB,
+                                     int                  m,
+                                     int                  n,
+                                     int                  k,
+                                     const void*          alpha,
+                                     const void*          A,
+                                     hipDataType          aType,
+                                     int                  lda,
+                                     hipblasStride        strideA,
+                                     const void*          B,
+                                     hipDataType          bType,
+                                     int                  ldb,
+                                     hipblasStride        strideB,
+                                     const void*          beta,
+                                     void*                C,
+                                     hipDataType          cType,
+                                     int                  ldc,
+                                     hipblasStride        strideC,
+                                     int                  batchCount,
+                                     hipblasComputeType_t computeType,
+                                     hipblasGemmAlgo_t    algo);
+
+// The axpyEx and scalEx of alphaType and executionType HIP_R_32F
+hipblasStatus_t hipblasRoundedAxpyEx(hipblasHandle_t handle,
+                                     int             n,
+                                     const void*     alpha,
+                                     hipDataType     alphaType,
+                                     const void*     x,
+                                     hipDataType     xType,
+                                     int             incx,
+                                     void*           y,
+                                     hipDataType     yType,
+                                     int             incy,
+                                     hipDataType     executionType);
+
+hipblasStatus_t hipblasRoundedScalEx(hipblasHandle_t handle,
+                                     int             n,
+                                     const void*     alpha,
+                                     hipDataType     alphaType,
+                                     void*           x,
+                                     hipDataType     xType,
+                                     int             incx,
+                                     hipDataType     executionType);
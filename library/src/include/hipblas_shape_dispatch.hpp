@@ -0,0 +1,80 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+
+#include <cstdint>
+
+// The rewrites of handles in HIPBLAS_SHAPE_DISPATCH_ALLOWED mode, see hipblasSetShapeDispatchMode,
+// which the gemmEx and gemv strided batched functions of both backends try first. Each returns
+// HIPBLAS_STATUS_NOT_SUPPORTED, without any work queued, for the calls it doesn't take, which the
+// caller then passes to the backend: any call of a handle in the default mode, other shapes and
+// types, and invalid arguments, which the backend reports. The two never take each other's calls,
+// as a skinny gemm is a batch of at most hipblas_shape_dispatch_max_columns gemvs, and a gemv
+// batch is rewritten only with more.
+
+constexpr int64_t hipblas_shape_dispatch_max_columns = 8;
+
+// C := alpha * op(A) * op(B) + beta * C with n from 1 to hipblas_shape_dispatch_max_columns, as
+// a strided batch of n gemvs of op(A) with a stride of 0
+hipblasStatus_t hipblasShapeDispatchGemm(hipblasHandle_t      handle,
+                                         hipblasOperation_t   transA,
+                                         hipblasOperation_t   transB,
+                                         int64_t              m,
+                                         int64_t              n,
+                                         int64_t              k,
+                                         const void*          alpha,
+                                         const void*          A,
+                                         hipDataType          aType,
+                                         int64_t              lda,
+                                         const void*          B,
+                                         hipDataType          bType,
+                                         int64_t              ldb,
+                                         const void*          beta,
+                                         void*                C,
+                                         hipDataType          cType,
+                                         int64_t              ldc,
+                                         hipblasComputeType_t computeType);
+
+// y_i := alpha * op(A) * x_i + beta * y_i for the batch of a single matrix, with strideA of 0, as
+// one gemm with the vectors y the columns of C and the vectors x those of B, or its rows. type is
+// that of A, x and y.
+hipblasStatus_t hipblasShapeDispatchGemvBatch(hipblasHandle_t      handle,
+                                              hipblasOperation_t   trans,
+                                              int64_t              m,
+                                              int64_t              n,
+                                              const void*          alpha,
+                                              const void*          A,
+                                              int64_t              lda,
+                                              hipblasStride        strideA,
+                                              const void*          x,
+                                              int64_t              incx,
+                                              hipblasStride        stridex,
+                                              const void*          beta,
+                                              void*                y,
+                                              int64_t              incy,
+                                              hipblasStride        stridey,
+                                              int64_t              batchCount,
+                                              hipDataType          type,
+                                              hipblasComputeType_t computeType);
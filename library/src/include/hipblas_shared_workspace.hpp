@@ -0,0 +1,71 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+#include <memory>
+
+// Handles created with hipblasCreateWithSharedWorkspace share one device workspace, set as
+// the workspace of each of them with hipblasSetWorkspace. HIPBLAS_ENTRY, at the start of every
+// hipBLAS function, holds the lock of the workspace for the call and orders the stream of the
+// call after the stream of the previous call on the workspace, so that two handles never use
+// it at the same time.
+
+struct hipblasSharedWorkspace;
+
+// Returns true if handle shares a workspace. While no handle does, this is a single atomic load
+// and doesn't look up the handle.
+bool hipblasHasSharedWorkspace(hipblasHandle_t handle);
+
+// Grows the workspace shared by handle to at least size bytes, and sets it as the workspace of
+// handle. The other handles take the new workspace at their next call. Called with the lock of
+// the workspace held, from hipblasDemandAllocRetry.
+hipblasStatus_t hipblasGrowSharedWorkspace(hipblasHandle_t handle, size_t size);
+
+// Removes handle from the handles sharing its workspace, freeing the workspace with the last
+// one. Called from hipblasDestroy.
+void hipblasLeaveSharedWorkspace(hipblasHandle_t handle);
+
+// Holds the lock of the workspace shared by handle, if any, for the lifetime of the scope, with
+// the workspace set on handle and the stream of handle ordered after its previous user
+class hipblasSharedWorkspaceScope
+{
+    std::shared_ptr<hipblasSharedWorkspace> m_workspace; // set while the lock is held
+
+    // While no handle shares a workspace, this is a single atomic load and doesn't look up the
+    // handle
+    void enter(hipblasHandle_t handle);
+
+public:
+    // The other arguments are those of HIPBLAS_ENTRY, which are ignored
+    template <typename... Args>
+    explicit hipblasSharedWorkspaceScope(hipblasHandle_t handle, const Args&...)
+    {
+        enter(handle);
+    }
+
+    ~hipblasSharedWorkspaceScope();
+
+    hipblasSharedWorkspaceScope(const hipblasSharedWorkspaceScope&) = delete;
+    hipblasSharedWorkspaceScope& operator=(const hipblasSharedWorkspaceScope&) = delete;
+};
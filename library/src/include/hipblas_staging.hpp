@@ -0,0 +1,87 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+
+#include <cstdint>
+
+// Copies a column major matrix between pageable host memory and the device through a ring of
+// pinned staging buffers of the current device, packing one buffer on the host while the copy
+// of the previous one runs. Returns false without copying when the copy is better left to the
+// backend: pinned host memory, copies too small to pipeline, or arguments the backend must
+// report. Otherwise returns true with the status of the copy in status.
+//
+// Copies to the device are queued on stream and, unless async, waited for. Copies to pageable
+// host memory are always finished on return, since the host unpacks them.
+bool hipblasStagedMatrixCopy(bool             to_device,
+                             int64_t          rows,
+                             int64_t          cols,
+                             int64_t          elemSize,
+                             const void*      src,
+                             int64_t          lds,
+                             void*            dst,
+                             int64_t          ldd,
+                             hipStream_t      stream,
+                             bool             async,
+                             hipblasStatus_t* status);
+
+// hipblasStagedMatrixCopy for vectors, which are staged when both increments are 1
+bool hipblasStagedVectorCopy(bool             to_device,
+                             int64_t          n,
+                             int64_t          elemSize,
+                             const void*      x,
+                             int64_t          incx,
+                             void*            y,
+                             int64_t          incy,
+                             hipStream_t      stream,
+                             bool             async,
+                             hipblasStatus_t* status);
+
+// The NUMA node the staging buffers of device are placed on, that closest to device, or -1 when
+// it isn't known or the buffers couldn't be placed
+int hipblasStagingNumaNode(int device);
+
+// The 64-bit set/get matrix functions. Copies that aren't staged go out as one
+// hipMemcpy2DAsync, however large, queued on stream and, unless async, waited for.
+hipblasStatus_t hipblasCopyMatrix64(bool        to_device,
+                                    int64_t     rows,
+                                    int64_t     cols,
+                                    int64_t     elemSize,
+                                    const void* src,
+                                    int64_t     lds,
+                                    void*       dst,
+                                    int64_t     ldd,
+                                    hipStream_t stream,
+                                    bool        async);
+
+// The 64-bit set/get vector functions, copying strided vectors as one 2D copy of n rows
+hipblasStatus_t hipblasCopyVector64(bool        to_device,
+                                    int64_t     n,
+                                    int64_t     elemSize,
+                                    const void* x,
+                                    int64_t     incx,
+                                    void*       y,
+                                    int64_t     incy,
+                                    hipStream_t stream,
+                                    bool        async);
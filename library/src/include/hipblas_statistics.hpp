@@ -0,0 +1,76 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+#include "hipblas_handle_state.hpp"
+#include <cstddef>
+
+// Statistics of the hipBLAS calls made with a handle in a statistics mode, set with
+// hipblasSetStatisticsMode. HIPBLAS_ENTRY counts each call with the handle it is made with,
+// before the handle is replaced by the handle of a stream bound to it for the calling thread.
+// The calls a counted call makes to other hipBLAS functions are part of it and aren't counted,
+// and the workspace allocations, host synchronizations and fallbacks below are counted in the
+// statistics of the counted call in progress on the calling thread.
+
+// Counts the hipBLAS call made in its scope, and in HIPBLAS_STATISTICS_TIMED mode times it with
+// events recorded on the stream of the handle before and after the call
+class hipblasStatisticsScope
+{
+    hipblasStatisticsCounters*                   m_counters = nullptr;
+    hipblasStatisticsCounters::routine_counters* m_routine  = nullptr;
+    hipEvent_t                                   m_start    = nullptr;
+    hipStream_t                                  m_stream   = nullptr;
+
+    void begin(hipblasHandle_t handle, hipblasStatisticsMode_t mode, const char* function) noexcept;
+    void end() noexcept;
+
+public:
+    // The arguments after handle are those of HIPBLAS_ENTRY, which are ignored
+    template <typename... Args>
+    hipblasStatisticsScope(const char* function, hipblasHandle_t handle, const Args&...)
+    {
+        hipblasStatisticsMode_t mode = hipblasGetHandleStatisticsMode(handle);
+        if(mode != HIPBLAS_STATISTICS_NONE)
+            begin(handle, mode, function);
+    }
+
+    ~hipblasStatisticsScope()
+    {
+        if(m_counters)
+            end();
+    }
+
+    hipblasStatisticsScope(const hipblasStatisticsScope&) = delete;
+    hipblasStatisticsScope& operator=(const hipblasStatisticsScope&) = delete;
+};
+
+// Counts an allocation of bytes growing the workspace of the backend or the scratch memory of
+// hipBLAS
+void hipblasStatisticsWorkspaceAllocation(size_t bytes) noexcept;
+
+// Counts a reduction waiting for its result if handle is in host pointer mode
+void hipblasStatisticsHostSync(hipblasHandle_t handle) noexcept;
+
+// Counts a call computed by a fallback of the backend
+void hipblasStatisticsFallback() noexcept;
@@ -0,0 +1,44 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+
+// Streams bound to a handle for one thread with hipblasSetStreamForThread. A binding gives the
+// thread a handle of its own on the bound stream, and HIPBLAS_ENTRY, at the start of every
+// hipBLAS function, replaces the handle of the call by it. Each thread then queues the calls it
+// makes with a shared handle on its own stream, without locking and without sharing a
+// workspace with the other threads.
+
+// Returns the handle bound to handle for the calling thread, or handle if there is none. While
+// no thread has a binding, this is a single atomic load and doesn't look up the handle.
+hipblasHandle_t hipblasThreadStreamHandle(hipblasHandle_t handle);
+
+// Removes the bindings of every thread to handle and destroys their handles. Called from
+// hipblasDestroy.
+void hipblasDestroyThreadStreams(hipblasHandle_t handle);
+
+// Gives to the modes, the host dispatch thresholds and the workspace pool and limit of from. Math
+// modes that the backend doesn't support are left as they are. Used for the handles of the
+// bindings, and by hipblasHandlePoolRelease to give a handle the defaults back.
+hipblasStatus_t hipblasCopyHandleModes(hipblasHandle_t from, hipblasHandle_t to);
@@ -0,0 +1,179 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+
+// Tracing of hipBLAS calls, enabled by setting HIPBLAS_TRACE_FILE to the path of the trace.
+// Each traced call records its handle, stream, scalar arguments and GPU time into a ring
+// buffer of the calling thread. A background thread drains the buffers into the trace as
+// hipblas-bench YAML, so the traced calls can be replayed with hipblas-bench --yaml <trace>.
+// When tracing is disabled a traced call only checks a flag.
+//
+// Setting HIPBLAS_PROFILE_FILE instead, or as well, aggregates the traced calls of each handle
+// by shape, and writes their count, GPU time and achieved GFLOP/s and GB/s to the profile when
+// the handle is destroyed.
+//
+// In a build with BUILD_WITH_ROCTX, setting HIPBLAS_ROCTX to a nonzero value also encloses each
+// traced call in a roctx range, or an NVTX range on the cuBLAS backend, named with the function
+// and its sizes, so that rocprofv3 or Nsight show which call launched each kernel. Without
+// BUILD_WITH_ROCTX the ranges are compiled out.
+
+// The largest number of scalar arguments of a hipBLAS function
+constexpr int hipblasTraceMaxArgs = 20;
+
+enum class hipblasTraceKind : uint8_t
+{
+    integer,
+    operation,
+    fill,
+    diag,
+    side,
+    datatype,
+    hip_datatype,
+    compute_type,
+    algo,
+    flags
+};
+
+struct hipblasTraceArg
+{
+    int64_t          value;
+    hipblasTraceKind kind;
+};
+
+template <typename T, std::enable_if_t<std::is_integral<T>{}, int> = 0>
+inline hipblasTraceArg hipblasTraceMakeArg(T value)
+{
+    return {int64_t(value), hipblasTraceKind::integer};
+}
+
+#define HIPBLAS_TRACE_ENUM_ARG(type_, kind_)                \
+    inline hipblasTraceArg hipblasTraceMakeArg(type_ value) \
+    {                                                       \
+        return {int64_t(value), hipblasTraceKind::kind_};   \
+    }
+
+HIPBLAS_TRACE_ENUM_ARG(hipblasOperation_t, operation)
+HIPBLAS_TRACE_ENUM_ARG(hipblasFillMode_t, fill)
+HIPBLAS_TRACE_ENUM_ARG(hipblasDiagType_t, diag)
+HIPBLAS_TRACE_ENUM_ARG(hipblasSideMode_t, side)
+HIPBLAS_TRACE_ENUM_ARG(hipDataType, hip_datatype)
+#ifndef HIPBLAS_V2
+HIPBLAS_TRACE_ENUM_ARG(hipblasDatatype_t, datatype)
+#endif
+HIPBLAS_TRACE_ENUM_ARG(hipblasComputeType_t, compute_type)
+HIPBLAS_TRACE_ENUM_ARG(hipblasGemmAlgo_t, algo)
+HIPBLAS_TRACE_ENUM_ARG(hipblasGemmFlags_t, flags)
+
+#undef HIPBLAS_TRACE_ENUM_ARG
+
+// A traced call, written by the calling thread and read by the trace thread once complete
+struct hipblasTraceRecord
+{
+    const char*      function;
+    const char*      arg_names; // the arguments of HIPBLAS_TRACE as spelled, starting with handle
+    hipblasHandle_t  handle;
+    hipStream_t      stream;
+    int              num_args;
+    bool             fallback; // set by hipblasTraceFallback
+    int64_t          values[hipblasTraceMaxArgs];
+    hipblasTraceKind kinds[hipblasTraceMaxArgs];
+};
+
+// Returns true if HIPBLAS_TRACE_FILE or HIPBLAS_PROFILE_FILE is set
+bool hipblasTraceEnabled();
+
+#ifdef HIPBLAS_ROCTX
+// Returns true if HIPBLAS_ROCTX is set to a nonzero value
+bool hipblasRangesEnabled();
+#endif
+
+// Writes the traced calls of handle and its profile. Called from hipblasDestroy.
+void hipblasTraceDestroyHandle(hipblasHandle_t handle);
+
+// Marks the call being traced by the calling thread as computed by a fallback of the backend
+// rather than by a native implementation, so that the trace and the profile show which
+// fallbacks are hot, and counts it in the statistics of its handle
+void hipblasTraceFallback() noexcept;
+
+struct hipblasTraceSlot;
+
+// Traces the hipBLAS call made in its scope. The GPU time of the call is measured with events
+// recorded on the handle's stream before and after the call.
+class hipblasTraceScope
+{
+    hipblasTraceSlot* m_slot = nullptr;
+#ifdef HIPBLAS_ROCTX
+    bool m_range = false;
+
+    void push_range(const char*                            function,
+                    const char*                            arg_names,
+                    std::initializer_list<hipblasTraceArg> args) noexcept;
+    void pop_range() noexcept;
+#endif
+
+    void begin(hipblasHandle_t                        handle,
+               const char*                            function,
+               const char*                            arg_names,
+               std::initializer_list<hipblasTraceArg> args) noexcept;
+    void end() noexcept;
+
+public:
+    template <typename... Args>
+    hipblasTraceScope(const char*     function,
+                      const char*     arg_names,
+                      hipblasHandle_t handle,
+                      Args...         args)
+    {
+        static_assert(sizeof...(Args) <= hipblasTraceMaxArgs, "increase hipblasTraceMaxArgs");
+#ifdef HIPBLAS_ROCTX
+        if(hipblasRangesEnabled())
+            push_range(function, arg_names, {hipblasTraceMakeArg(args)...});
+#endif
+        if(hipblasTraceEnabled())
+            begin(handle, function, arg_names, {hipblasTraceMakeArg(args)...});
+    }
+
+    ~hipblasTraceScope()
+    {
+        if(m_slot)
+            end();
+#ifdef HIPBLAS_ROCTX
+        if(m_range)
+            pop_range();
+#endif
+    }
+
+    hipblasTraceScope(const hipblasTraceScope&) = delete;
+    hipblasTraceScope& operator=(const hipblasTraceScope&) = delete;
+};
+
+// Traces the enclosing hipBLAS function. The arguments are the handle followed by the scalar
+// arguments of the function, which are written to the trace under their bench names. hipBLAS
+// functions are entered with HIPBLAS_ENTRY, which traces them with this macro.
+#define HIPBLAS_TRACE(...) \
+    hipblasTraceScope hipblas_trace_scope(__func__, #__VA_ARGS__, __VA_ARGS__)
@@ -0,0 +1,73 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+
+#include <cstdint>
+
+// Batched triangular solves of small systems, of order at most 64, computed by the kernels of
+// hipblas_trsm_small.cpp instead of the backend, which the batched and strided batched trsm and
+// trsv functions of both backends try first. The order is padded to 8, 16, 32 or 64, known at
+// compile time, and a block solves several systems at once with the triangle of each in shared
+// memory and a thread for each of its rows.
+//
+// Return HIPBLAS_STATUS_NOT_SUPPORTED, without any work queued, for the calls they don't take,
+// which the caller then passes to the backend: types other than float, double, hipFloatComplex
+// and hipDoubleComplex, larger orders, batches too small to be worth a kernel of their own,
+// invalid arguments, which the backend reports, and any call when HIPBLAS_SMALL_TRSM=0 is set.
+// A and B, or x, are arrays of pointers when batched, and the first matrix or vector of a
+// strided batch otherwise. The strided batches of hipblasSmallTrsm on a handle in
+// HIPBLAS_BATCH_LAYOUT_INTERLEAVED mode all go to hipblasInterleavedTrsm instead.
+hipblasStatus_t hipblasSmallTrsm(hipblasHandle_t    handle,
+                                 hipblasSideMode_t  side,
+                                 hipblasFillMode_t  uplo,
+                                 hipblasOperation_t transA,
+                                 hipblasDiagType_t  diag,
+                                 int64_t            m,
+                                 int64_t            n,
+                                 const void*        alpha,
+                                 const void*        A,
+                                 hipDataType        dataType,
+                                 int64_t            lda,
+                                 hipblasStride      strideA,
+                                 void*              B,
+                                 int64_t            ldb,
+                                 hipblasStride      strideB,
+                                 int64_t            batchCount,
+                                 bool               batched);
+
+hipblasStatus_t hipblasSmallTrsv(hipblasHandle_t    handle,
+                                 hipblasFillMode_t  uplo,
+                                 hipblasOperation_t transA,
+                                 hipblasDiagType_t  diag,
+                                 int64_t            n,
+                                 const void*        A,
+                                 hipDataType        dataType,
+                                 int64_t            lda,
+                                 hipblasStride      strideA,
+                                 void*              x,
+                                 int64_t            incx,
+                                 hipblasStride      stridex,
+                                 int64_t            batchCount,
+                                 bool               batched);
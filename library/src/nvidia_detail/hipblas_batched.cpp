@@ -0,0 +1,1204 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas_batched.hpp"
+#include "hipblas_handle_state.hpp"
+#include <algorithm>
+#include <cstring>
+#include <cublas_v2.h>
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    // threads per block of every kernel
+    constexpr int hipblas_batched_block = 256;
+
+    // The elementwise kernels loop over the problems of the batch and their elements as one
+    // range, with at most this many blocks
+    constexpr int64_t hipblas_batched_max_blocks = int64_t(1) << 16;
+
+    // The reductions are computed by groups of threads of this size in a block, one group per
+    // problem, or by the whole block for problems of more than hipblas_batched_block elements
+    constexpr int hipblas_batched_group = 32;
+
+    /****************************************************************************
+     * Arithmetic on the real and complex types
+     ***************************************************************************/
+    template <typename T>
+    struct hipblas_real_t
+    {
+        using type = T;
+    };
+
+    template <>
+    struct hipblas_real_t<hipFloatComplex>
+    {
+        using type = float;
+    };
+
+    template <>
+    struct hipblas_real_t<hipDoubleComplex>
+    {
+        using type = double;
+    };
+
+    template <typename T>
+    using hipblas_real = typename hipblas_real_t<T>::type;
+
+    template <typename T>
+    constexpr bool hipblas_is_complex = !std::is_same_v<T, hipblas_real<T>>;
+
+    template <typename T>
+    __host__ __device__ inline T hipblas_make(hipblas_real<T> re, hipblas_real<T> im = 0)
+    {
+        if constexpr(hipblas_is_complex<T>)
+            return T{re, im};
+        else
+            return re;
+    }
+
+    template <typename T>
+    __host__ __device__ inline hipblas_real<T> hipblas_re(T a)
+    {
+        if constexpr(hipblas_is_complex<T>)
+            return a.x;
+        else
+            return a;
+    }
+
+    template <typename T>
+    __host__ __device__ inline hipblas_real<T> hipblas_im(T a)
+    {
+        if constexpr(hipblas_is_complex<T>)
+            return a.y;
+        else
+            return 0;
+    }
+
+    template <typename T>
+    __host__ __device__ inline T hipblas_conj(T a)
+    {
+        return hipblas_make<T>(hipblas_re(a), -hipblas_im(a));
+    }
+
+    template <typename T>
+    __device__ inline T hipblas_add(T a, T b)
+    {
+        return hipblas_make<T>(hipblas_re(a) + hipblas_re(b), hipblas_im(a) + hipblas_im(b));
+    }
+
+    template <typename T>
+    __device__ inline T hipblas_sub(T a, T b)
+    {
+        return hipblas_make<T>(hipblas_re(a) - hipblas_re(b), hipblas_im(a) - hipblas_im(b));
+    }
+
+    // a is T or the real type of T
+    template <typename Ta, typename T>
+    __device__ inline T hipblas_mul(Ta a, T b)
+    {
+        if constexpr(hipblas_is_complex<Ta>)
+            return T{a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x};
+        else
+            return hipblas_make<T>(a * hipblas_re(b), a * hipblas_im(b));
+    }
+
+    template <typename T>
+    __device__ inline T hipblas_div(T a, T b)
+    {
+        if constexpr(hipblas_is_complex<T>)
+        {
+            if constexpr(std::is_same_v<T, hipFloatComplex>)
+                return hipCdivf(a, b);
+            else
+                return hipCdiv(a, b);
+        }
+        else
+            return a / b;
+    }
+
+    template <typename T>
+    __device__ inline hipblas_real<T> hipblas_abs1(T a)
+    {
+        return fabs(hipblas_re(a)) + fabs(hipblas_im(a));
+    }
+
+    template <typename T>
+    __host__ __device__ inline bool hipblas_is_zero(T a)
+    {
+        return hipblas_re(a) == 0 && hipblas_im(a) == 0;
+    }
+
+    template <typename T>
+    __host__ __device__ inline bool hipblas_is_one(T a)
+    {
+        return hipblas_re(a) == 1 && hipblas_im(a) == 0;
+    }
+
+    /****************************************************************************
+     * Batches and scalars
+     ***************************************************************************/
+    template <typename T>
+    __device__ inline T* hipblas_load_batch(T* p, int64_t b, hipblasStride stride)
+    {
+        return p + b * stride;
+    }
+
+    template <typename T>
+    __device__ inline T* hipblas_load_batch(T* const* p, int64_t b, hipblasStride)
+    {
+        return p[b];
+    }
+
+    // A scalar argument, which is read in the kernel in device pointer mode
+    template <typename T>
+    struct hipblas_scalar
+    {
+        T        value;
+        const T* device;
+
+        __device__ T get() const
+        {
+            return device ? *device : value;
+        }
+    };
+
+    template <typename T>
+    hipblas_scalar<T> hipblas_make_scalar(const T* p, bool host_mode)
+    {
+        hipblas_scalar<T> s{};
+        if(host_mode)
+            s.value = *p;
+        else
+            s.device = p;
+        return s;
+    }
+
+    // With a negative increment the vector starts with its last element
+    template <typename I>
+    int64_t hipblas_shift(I n, I inc)
+    {
+        return inc < 0 ? -int64_t(inc) * (n - 1) : 0;
+    }
+
+    int hipblas_blocks(int64_t threads)
+    {
+        return int(std::min((threads - 1) / hipblas_batched_block + 1, hipblas_batched_max_blocks));
+    }
+
+    // The stream and pointer mode of the cuBLAS handle
+    hipblasStatus_t hipblas_get_handle(hipblasHandle_t handle, hipStream_t* stream, bool* host_mode)
+    {
+        cudaStream_t        cuda_stream;
+        cublasPointerMode_t pointer_mode;
+        if(cublasGetStream((cublasHandle_t)handle, &cuda_stream) != CUBLAS_STATUS_SUCCESS
+           || cublasGetPointerMode((cublasHandle_t)handle, &pointer_mode) != CUBLAS_STATUS_SUCCESS)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        *stream    = cuda_stream;
+        *host_mode = pointer_mode == CUBLAS_POINTER_MODE_HOST;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasStatus_t hipblas_launch_status()
+    {
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    // Results of reductions are computed into device memory. In host pointer mode they are
+    // computed into a temporary buffer and copied to result, and the call is synchronous, as
+    // the reductions of cuBLAS are.
+    template <typename R, typename F>
+    hipblasStatus_t hipblas_reduction_result(hipblasHandle_t handle,
+                                             hipStream_t     stream,
+                                             bool            host_mode,
+                                             int64_t         batch_count,
+                                             R*              result,
+                                             F               launch)
+    {
+        if(!host_mode)
+        {
+            launch(result);
+            return hipblas_launch_status();
+        }
+
+        // the buffer can't be allocated while capturing a graph in HIPBLAS_GRAPH_CAPTURE_SAFE mode
+        if(hipblasIsGraphCaptureSafe(handle))
+        {
+            hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+            if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess
+               || capture_status != hipStreamCaptureStatusNone)
+                return HIPBLAS_STATUS_NOT_SUPPORTED;
+        }
+
+        R* device_result = nullptr;
+        if(hipMallocAsync((void**)&device_result, sizeof(R) * batch_count, stream) != hipSuccess)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        launch(device_result);
+        hipblasStatus_t status = hipblas_launch_status();
+        if(status == HIPBLAS_STATUS_SUCCESS
+           && hipMemcpyAsync(
+                  result, device_result, sizeof(R) * batch_count, hipMemcpyDeviceToHost, stream)
+                  != hipSuccess)
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+        if(hipFreeAsync(device_result, stream) != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess)
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+        return status;
+    }
+
+    // Sets the results of a batch of empty reductions to zero
+    template <typename R>
+    hipblasStatus_t hipblas_zero_result(hipStream_t stream,
+                                        bool        host_mode,
+                                        int64_t     batch_count,
+                                        R*          result)
+    {
+        if(host_mode)
+        {
+            memset(result, 0, sizeof(R) * batch_count);
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+        return hipMemsetAsync(result, 0, sizeof(R) * batch_count, stream) == hipSuccess
+                   ? HIPBLAS_STATUS_SUCCESS
+                   : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    /****************************************************************************
+     * Kernels
+     ***************************************************************************/
+    template <typename T, typename I, typename Ux, typename Uy>
+    __global__ __launch_bounds__(hipblas_batched_block) void hipblasAxpyBatchedKernel(
+        I                 n,
+        hipblas_scalar<T> alpha_arg,
+        Ux                x,
+        int64_t           shift_x,
+        I                 incx,
+        hipblasStride     stride_x,
+        Uy                y,
+        int64_t           shift_y,
+        I                 incy,
+        hipblasStride     stride_y,
+        I                 batch_count)
+    {
+        T alpha = alpha_arg.get();
+        if(hipblas_is_zero(alpha))
+            return;
+
+        int64_t total = int64_t(n) * batch_count;
+        for(int64_t t = int64_t(blockIdx.x) * blockDim.x + threadIdx.x; t < total;
+            t += int64_t(gridDim.x) * blockDim.x)
+        {
+            int64_t  b  = t / n;
+            int64_t  i  = t % n;
+            const T* xb = hipblas_load_batch(x, b, stride_x) + shift_x;
+            T*       yb = hipblas_load_batch(y, b, stride_y) + shift_y;
+            yb[i * incy] = hipblas_add(yb[i * incy], hipblas_mul(alpha, xb[i * incx]));
+        }
+    }
+
+    template <typename T, typename Ta, typename I, typename Ux>
+    __global__ __launch_bounds__(hipblas_batched_block) void hipblasScalBatchedKernel(
+        I n, hipblas_scalar<Ta> alpha_arg, Ux x, I incx, hipblasStride stride_x, I batch_count)
+    {
+        Ta      alpha = alpha_arg.get();
+        int64_t total = int64_t(n) * batch_count;
+        for(int64_t t = int64_t(blockIdx.x) * blockDim.x + threadIdx.x; t < total;
+            t += int64_t(gridDim.x) * blockDim.x)
+        {
+            T* xb = hipblas_load_batch(x, t / n, stride_x);
+            xb[(t % n) * incx] = hipblas_mul(alpha, xb[(t % n) * incx]);
+        }
+    }
+
+    // Each group of NB threads reduces one problem, and the groups of a block loop over the
+    // batch together so that they all reach the barriers
+    template <int NB, typename T, typename Tr, typename I, typename Ux>
+    __global__ __launch_bounds__(hipblas_batched_block) void hipblasAsumBatchedKernel(
+        I n, Ux x, I incx, hipblasStride stride_x, I batch_count, Tr* result)
+    {
+        constexpr int groups = hipblas_batched_block / NB;
+        __shared__ Tr partial[hipblas_batched_block];
+
+        int lane = threadIdx.x % NB;
+        for(int64_t first = int64_t(blockIdx.x) * groups; first < batch_count;
+            first += int64_t(gridDim.x) * groups)
+        {
+            int64_t b   = first + threadIdx.x / NB;
+            Tr      sum = 0;
+            if(b < batch_count)
+            {
+                const T* xb = hipblas_load_batch(x, b, stride_x);
+                for(int64_t i = lane; i < n; i += NB)
+                    sum += hipblas_abs1(xb[i * incx]);
+            }
+            partial[threadIdx.x] = sum;
+            __syncthreads();
+
+            for(int s = NB / 2; s > 0; s /= 2)
+            {
+                if(lane < s)
+                    partial[threadIdx.x] += partial[threadIdx.x + s];
+                __syncthreads();
+            }
+
+            if(lane == 0 && b < batch_count)
+                result[b] = partial[threadIdx.x];
+            __syncthreads();
+        }
+    }
+
+    // The index 0 marks a group that saw no element. Ties keep the smaller index, as the
+    // first index is returned.
+    template <bool IS_MAX, typename Tr, typename I>
+    __device__ inline void hipblas_iamax_iamin_update(Tr& value, I& index, Tr other, I other_index)
+    {
+        if(other_index == 0)
+            return;
+        if(index == 0 || (IS_MAX ? other > value : other < value)
+           || (other == value && other_index < index))
+        {
+            value = other;
+            index = other_index;
+        }
+    }
+
+    template <int NB, bool IS_MAX, typename T, typename I, typename Ux>
+    __global__ __launch_bounds__(hipblas_batched_block) void hipblasIamaxIaminBatchedKernel(
+        I n, Ux x, I incx, hipblasStride stride_x, I batch_count, I* result)
+    {
+        using Tr                = hipblas_real<T>;
+        constexpr int groups    = hipblas_batched_block / NB;
+        __shared__ Tr partial[hipblas_batched_block];
+        __shared__ I  partial_index[hipblas_batched_block];
+
+        int lane = threadIdx.x % NB;
+        for(int64_t first = int64_t(blockIdx.x) * groups; first < batch_count;
+            first += int64_t(gridDim.x) * groups)
+        {
+            int64_t b     = first + threadIdx.x / NB;
+            Tr      value = 0;
+            I       index = 0;
+            if(b < batch_count)
+            {
+                const T* xb = hipblas_load_batch(x, b, stride_x);
+                for(int64_t i = lane; i < n; i += NB)
+                    hipblas_iamax_iamin_update<IS_MAX>(
+                        value, index, hipblas_abs1(xb[i * incx]), I(i + 1));
+            }
+            partial[threadIdx.x]       = value;
+            partial_index[threadIdx.x] = index;
+            __syncthreads();
+
+            for(int s = NB / 2; s > 0; s /= 2)
+            {
+                if(lane < s)
+                    hipblas_iamax_iamin_update<IS_MAX>(partial[threadIdx.x],
+                                                       partial_index[threadIdx.x],
+                                                       partial[threadIdx.x + s],
+                                                       partial_index[threadIdx.x + s]);
+                __syncthreads();
+            }
+
+            if(lane == 0 && b < batch_count)
+                result[b] = partial_index[threadIdx.x];
+            __syncthreads();
+        }
+    }
+
+    // bfloat16 is the upper half of a float. Floats are rounded to the nearest even bfloat16,
+    // and NaNs stay quiet NaNs.
+    __device__ inline float hipblas_bfloat16_to_float(hipblasBfloat16 a)
+    {
+        uint16_t bits;
+        memcpy(&bits, &a, sizeof(bits));
+        return __uint_as_float(uint32_t(bits) << 16);
+    }
+
+    __device__ inline hipblasBfloat16 hipblas_float_to_bfloat16(float a)
+    {
+        uint32_t f    = __float_as_uint(a);
+        uint16_t bits = (f & 0x7fffffff) > 0x7f800000 ? (f >> 16) | 0x40
+                                                      : (f + 0x7fff + ((f >> 16) & 1)) >> 16;
+        hipblasBfloat16 r;
+        memcpy(&r, &bits, sizeof(bits));
+        return r;
+    }
+
+    // The products of bfloat16 elements are summed in float, as in rocBLAS, and only the
+    // result is rounded to bfloat16
+    template <int NB, typename I, typename Ux, typename Uy>
+    __global__ __launch_bounds__(hipblas_batched_block) void hipblasBfdotBatchedKernel(
+        I                n,
+        Ux               x,
+        int64_t          shift_x,
+        I                incx,
+        hipblasStride    stride_x,
+        Uy               y,
+        int64_t          shift_y,
+        I                incy,
+        hipblasStride    stride_y,
+        I                batch_count,
+        hipblasBfloat16* result)
+    {
+        constexpr int groups = hipblas_batched_block / NB;
+        __shared__ float partial[hipblas_batched_block];
+
+        int lane = threadIdx.x % NB;
+        for(int64_t first = int64_t(blockIdx.x) * groups; first < batch_count;
+            first += int64_t(gridDim.x) * groups)
+        {
+            int64_t b   = first + threadIdx.x / NB;
+            float   sum = 0;
+            if(b < batch_count)
+            {
+                const hipblasBfloat16* xb = hipblas_load_batch(x, b, stride_x) + shift_x;
+                const hipblasBfloat16* yb = hipblas_load_batch(y, b, stride_y) + shift_y;
+                for(int64_t i = lane; i < n; i += NB)
+                    sum += hipblas_bfloat16_to_float(xb[i * incx])
+                           * hipblas_bfloat16_to_float(yb[i * incy]);
+            }
+            partial[threadIdx.x] = sum;
+            __syncthreads();
+
+            for(int s = NB / 2; s > 0; s /= 2)
+            {
+                if(lane < s)
+                    partial[threadIdx.x] += partial[threadIdx.x + s];
+                __syncthreads();
+            }
+
+            if(lane == 0 && b < batch_count)
+                result[b] = hipblas_float_to_bfloat16(partial[threadIdx.x]);
+            __syncthreads();
+        }
+    }
+
+    template <bool CONJ, typename T, typename I, typename Ux, typename Uy, typename UA>
+    __global__ __launch_bounds__(hipblas_batched_block) void hipblasGerBatchedKernel(
+        I                 m,
+        I                 n,
+        hipblas_scalar<T> alpha_arg,
+        Ux                x,
+        int64_t           shift_x,
+        I                 incx,
+        hipblasStride     stride_x,
+        Uy                y,
+        int64_t           shift_y,
+        I                 incy,
+        hipblasStride     stride_y,
+        UA                A,
+        I                 lda,
+        hipblasStride     stride_A,
+        I                 batch_count)
+    {
+        T alpha = alpha_arg.get();
+        if(hipblas_is_zero(alpha))
+            return;
+
+        int64_t size  = int64_t(m) * n;
+        int64_t total = size * batch_count;
+        for(int64_t t = int64_t(blockIdx.x) * blockDim.x + threadIdx.x; t < total;
+            t += int64_t(gridDim.x) * blockDim.x)
+        {
+            int64_t  b  = t / size;
+            int64_t  i  = t % size % m;
+            int64_t  j  = t % size / m;
+            const T* xb = hipblas_load_batch(x, b, stride_x) + shift_x;
+            const T* yb = hipblas_load_batch(y, b, stride_y) + shift_y;
+            T*       Ab = hipblas_load_batch(A, b, stride_A);
+            T        yj = CONJ ? hipblas_conj(yb[j * incy]) : yb[j * incy];
+            T        xy = hipblas_mul(xb[i * incx], yj);
+            Ab[i + j * lda] = hipblas_add(Ab[i + j * lda], hipblas_mul(alpha, xy));
+        }
+    }
+
+    // One thread for each row of each problem
+    template <typename T, typename I, typename UA, typename Ux, typename Uy>
+    __global__ __launch_bounds__(hipblas_batched_block) void hipblasHemvBatchedKernel(
+        bool              upper,
+        I                 n,
+        hipblas_scalar<T> alpha_arg,
+        UA                A,
+        I                 lda,
+        hipblasStride     stride_A,
+        Ux                x,
+        int64_t           shift_x,
+        I                 incx,
+        hipblasStride     stride_x,
+        hipblas_scalar<T> beta_arg,
+        Uy                y,
+        int64_t           shift_y,
+        I                 incy,
+        hipblasStride     stride_y,
+        I                 batch_count)
+    {
+        T alpha = alpha_arg.get();
+        T beta  = beta_arg.get();
+        if(hipblas_is_zero(alpha) && hipblas_is_one(beta))
+            return;
+
+        int64_t total = int64_t(n) * batch_count;
+        for(int64_t t = int64_t(blockIdx.x) * blockDim.x + threadIdx.x; t < total;
+            t += int64_t(gridDim.x) * blockDim.x)
+        {
+            int64_t b   = t / n;
+            int64_t i   = t % n;
+            T       sum = hipblas_make<T>(0);
+            if(!hipblas_is_zero(alpha))
+            {
+                const T* Ab = hipblas_load_batch(A, b, stride_A);
+                const T* xb = hipblas_load_batch(x, b, stride_x) + shift_x;
+                for(int64_t j = 0; j < n; j++)
+                {
+                    // the triangle that isn't stored is the conjugate transpose of the other,
+                    // and the imaginary parts of the diagonal are taken to be zero
+                    T a;
+                    if(i == j)
+                        a = hipblas_make<T>(hipblas_re(Ab[i + i * lda]));
+                    else if(upper == (i < j))
+                        a = Ab[i + j * lda];
+                    else
+                        a = hipblas_conj(Ab[j + i * lda]);
+                    sum = hipblas_add(sum, hipblas_mul(a, xb[j * incx]));
+                }
+            }
+
+            T* yb = hipblas_load_batch(y, b, stride_y) + shift_y;
+            T  yi = hipblas_mul(alpha, sum);
+            if(!hipblas_is_zero(beta))
+                yi = hipblas_add(yi, hipblas_mul(beta, yb[i * incy]));
+            yb[i * incy] = yi;
+        }
+    }
+
+    // The solve is sequential, so each problem is solved by one thread, which is efficient for
+    // the large batches of small problems this is meant for
+    template <typename T, typename I, typename UA, typename Ux>
+    __global__ __launch_bounds__(hipblas_batched_block) void hipblasTbsvBatchedKernel(
+        bool          upper,
+        int           op,
+        bool          unit,
+        I             n,
+        I             k,
+        UA            A,
+        I             lda,
+        hipblasStride stride_A,
+        Ux            x,
+        int64_t       shift_x,
+        I             incx,
+        hipblasStride stride_x,
+        I             batch_count)
+    {
+        for(int64_t b = int64_t(blockIdx.x) * blockDim.x + threadIdx.x; b < batch_count;
+            b += int64_t(gridDim.x) * blockDim.x)
+        {
+            const T* Ab = hipblas_load_batch(A, b, stride_A);
+            T*       xb = hipblas_load_batch(x, b, stride_x) + shift_x;
+
+            // element (i, j) of the triangle, stored in column j of the band
+            auto a = [&](int64_t i, int64_t j) {
+                T aij = Ab[(upper ? k + i - j : i - j) + j * lda];
+                return op == 2 ? hipblas_conj(aij) : aij;
+            };
+            auto xi = [&](int64_t i) -> T& { return xb[i * incx]; };
+
+            if(op == 0)
+            {
+                // column oriented substitution
+                for(int64_t jj = 0; jj < n; jj++)
+                {
+                    int64_t j = upper ? n - 1 - jj : jj;
+                    if(!unit)
+                        xi(j) = hipblas_div(xi(j), a(j, j));
+                    T       xj    = xi(j);
+                    int64_t first = upper ? (j > k ? j - k : 0) : j + 1;
+                    int64_t last  = upper ? j : (n - j > k ? j + k + 1 : n);
+                    for(int64_t i = first; i < last; i++)
+                        xi(i) = hipblas_sub(xi(i), hipblas_mul(xj, a(i, j)));
+                }
+            }
+            else
+            {
+                // op(A) is lower for an upper A, and the dot products run down the columns of A
+                for(int64_t jj = 0; jj < n; jj++)
+                {
+                    int64_t j     = upper ? jj : n - 1 - jj;
+                    T       xj    = xi(j);
+                    int64_t first = upper ? (j > k ? j - k : 0) : j + 1;
+                    int64_t last  = upper ? j : (n - j > k ? j + k + 1 : n);
+                    for(int64_t i = first; i < last; i++)
+                        xj = hipblas_sub(xj, hipblas_mul(a(i, j), xi(i)));
+                    if(!unit)
+                        xj = hipblas_div(xj, a(j, j));
+                    xi(j) = xj;
+                }
+            }
+        }
+    }
+
+    bool hipblas_valid_fill(hipblasFillMode_t uplo)
+    {
+        return uplo == HIPBLAS_FILL_MODE_UPPER || uplo == HIPBLAS_FILL_MODE_LOWER;
+    }
+
+    // rocBLAS returns invalid_size for HIPBLAS_FILL_MODE_FULL, which is a valid enum
+    hipblasStatus_t hipblas_fill_status(hipblasFillMode_t uplo)
+    {
+        return uplo == HIPBLAS_FILL_MODE_FULL ? HIPBLAS_STATUS_INVALID_VALUE
+                                              : HIPBLAS_STATUS_INVALID_ENUM;
+    }
+}
+
+/****************************************************************************
+ * Argument checks and launches
+ ***************************************************************************/
+template <typename T, bool BATCHED, typename I>
+hipblasStatus_t hipblasBatchedAxpy(hipblasHandle_t                   handle,
+                                   I                                 n,
+                                   const T*                          alpha,
+                                   hipblasBatchPtr<const T, BATCHED> x,
+                                   I                                 incx,
+                                   hipblasStride                     stride_x,
+                                   hipblasBatchPtr<T, BATCHED>       y,
+                                   I                                 incy,
+                                   hipblasStride                     stride_y,
+                                   I                                 batch_count)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n <= 0 || batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t     stream;
+    bool            host_mode;
+    hipblasStatus_t status = hipblas_get_handle(handle, &stream, &host_mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(host_mode)
+    {
+        if(hipblas_is_zero(*alpha))
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!x || !y)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    hipblasAxpyBatchedKernel<T>
+        <<<hipblas_blocks(int64_t(n) * batch_count), hipblas_batched_block, 0, stream>>>(
+            n,
+            hipblas_make_scalar(alpha, host_mode),
+            x,
+            hipblas_shift(n, incx),
+            incx,
+            stride_x,
+            y,
+            hipblas_shift(n, incy),
+            incy,
+            stride_y,
+            batch_count);
+    return hipblas_launch_status();
+}
+
+template <typename T, typename Ta, bool BATCHED, typename I>
+hipblasStatus_t hipblasBatchedScal(hipblasHandle_t             handle,
+                                   I                           n,
+                                   const Ta*                   alpha,
+                                   hipblasBatchPtr<T, BATCHED> x,
+                                   I                           incx,
+                                   hipblasStride               stride_x,
+                                   I                           batch_count)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n <= 0 || incx <= 0 || batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !x)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t     stream;
+    bool            host_mode;
+    hipblasStatus_t status = hipblas_get_handle(handle, &stream, &host_mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(host_mode && hipblas_is_one(*alpha))
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasScalBatchedKernel<T>
+        <<<hipblas_blocks(int64_t(n) * batch_count), hipblas_batched_block, 0, stream>>>(
+            n, hipblas_make_scalar(alpha, host_mode), x, incx, stride_x, batch_count);
+    return hipblas_launch_status();
+}
+
+template <typename T, typename Tr, bool BATCHED, typename I>
+hipblasStatus_t hipblasBatchedAsum(hipblasHandle_t                   handle,
+                                   I                                 n,
+                                   hipblasBatchPtr<const T, BATCHED> x,
+                                   I                                 incx,
+                                   hipblasStride                     stride_x,
+                                   I                                 batch_count,
+                                   Tr*                               result)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!result)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t     stream;
+    bool            host_mode;
+    hipblasStatus_t status = hipblas_get_handle(handle, &stream, &host_mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(n <= 0 || incx <= 0)
+        return hipblas_zero_result(stream, host_mode, batch_count, result);
+    if(!x)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblas_reduction_result(
+        handle, stream, host_mode, batch_count, result, [&](Tr* device_result) {
+            if(n > hipblas_batched_block)
+                hipblasAsumBatchedKernel<hipblas_batched_block, T>
+                    <<<hipblas_blocks(int64_t(batch_count) * hipblas_batched_block),
+                       hipblas_batched_block,
+                       0,
+                       stream>>>(n, x, incx, stride_x, batch_count, device_result);
+            else
+                hipblasAsumBatchedKernel<hipblas_batched_group, T>
+                    <<<hipblas_blocks(int64_t(batch_count) * hipblas_batched_group),
+                       hipblas_batched_block,
+                       0,
+                       stream>>>(n, x, incx, stride_x, batch_count, device_result);
+        });
+}
+
+template <bool IS_MAX, typename T, bool BATCHED, typename I>
+hipblasStatus_t hipblasBatchedIamaxIamin(hipblasHandle_t                   handle,
+                                         I                                 n,
+                                         hipblasBatchPtr<const T, BATCHED> x,
+                                         I                                 incx,
+                                         hipblasStride                     stride_x,
+                                         I                                 batch_count,
+                                         I*                                result)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!result)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t     stream;
+    bool            host_mode;
+    hipblasStatus_t status = hipblas_get_handle(handle, &stream, &host_mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(n <= 0 || incx <= 0)
+        return hipblas_zero_result(stream, host_mode, batch_count, result);
+    if(!x)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblas_reduction_result(
+        handle, stream, host_mode, batch_count, result, [&](I* device_result) {
+            if(n > hipblas_batched_block)
+                hipblasIamaxIaminBatchedKernel<hipblas_batched_block, IS_MAX, T>
+                    <<<hipblas_blocks(int64_t(batch_count) * hipblas_batched_block),
+                       hipblas_batched_block,
+                       0,
+                       stream>>>(n, x, incx, stride_x, batch_count, device_result);
+            else
+                hipblasIamaxIaminBatchedKernel<hipblas_batched_group, IS_MAX, T>
+                    <<<hipblas_blocks(int64_t(batch_count) * hipblas_batched_group),
+                       hipblas_batched_block,
+                       0,
+                       stream>>>(n, x, incx, stride_x, batch_count, device_result);
+        });
+}
+
+template <bool BATCHED, typename I>
+hipblasStatus_t hipblasBatchedBfdot(hipblasHandle_t                                 handle,
+                                    I                                               n,
+                                    hipblasBatchPtr<const hipblasBfloat16, BATCHED> x,
+                                    I                                               incx,
+                                    hipblasStride                                   stride_x,
+                                    hipblasBatchPtr<const hipblasBfloat16, BATCHED> y,
+                                    I                                               incy,
+                                    hipblasStride                                   stride_y,
+                                    I                                               batch_count,
+                                    hipblasBfloat16*                                result)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!result)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t     stream;
+    bool            host_mode;
+    hipblasStatus_t status = hipblas_get_handle(handle, &stream, &host_mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(n <= 0)
+        return hipblas_zero_result(stream, host_mode, batch_count, result);
+    if(!x || !y)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int64_t shift_x = hipblas_shift(n, incx);
+    int64_t shift_y = hipblas_shift(n, incy);
+    return hipblas_reduction_result(
+        handle, stream, host_mode, batch_count, result, [&](hipblasBfloat16* device_result) {
+            if(n > hipblas_batched_block)
+                hipblasBfdotBatchedKernel<hipblas_batched_block>
+                    <<<hipblas_blocks(int64_t(batch_count) * hipblas_batched_block),
+                       hipblas_batched_block,
+                       0,
+                       stream>>>(n,
+                                 x,
+                                 shift_x,
+                                 incx,
+                                 stride_x,
+                                 y,
+                                 shift_y,
+                                 incy,
+                                 stride_y,
+                                 batch_count,
+                                 device_result);
+            else
+                hipblasBfdotBatchedKernel<hipblas_batched_group>
+                    <<<hipblas_blocks(int64_t(batch_count) * hipblas_batched_group),
+                       hipblas_batched_block,
+                       0,
+                       stream>>>(n,
+                                 x,
+                                 shift_x,
+                                 incx,
+                                 stride_x,
+                                 y,
+                                 shift_y,
+                                 incy,
+                                 stride_y,
+                                 batch_count,
+                                 device_result);
+        });
+}
+
+template <bool CONJ, typename T, bool BATCHED, typename I>
+hipblasStatus_t hipblasBatchedGer(hipblasHandle_t                   handle,
+                                  I                                 m,
+                                  I                                 n,
+                                  const T*                          alpha,
+                                  hipblasBatchPtr<const T, BATCHED> x,
+                                  I                                 incx,
+                                  hipblasStride                     stride_x,
+                                  hipblasBatchPtr<const T, BATCHED> y,
+                                  I                                 incy,
+                                  hipblasStride                     stride_y,
+                                  hipblasBatchPtr<T, BATCHED>       A,
+                                  I                                 lda,
+                                  hipblasStride                     stride_A,
+                                  I                                 batch_count)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(m < 0 || n < 0 || !incx || !incy || lda < m || lda < 1 || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t     stream;
+    bool            host_mode;
+    hipblasStatus_t status = hipblas_get_handle(handle, &stream, &host_mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(host_mode)
+    {
+        if(hipblas_is_zero(*alpha))
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!x || !y || !A)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    hipblasGerBatchedKernel<CONJ, T>
+        <<<hipblas_blocks(int64_t(m) * n * batch_count), hipblas_batched_block, 0, stream>>>(
+            m,
+            n,
+            hipblas_make_scalar(alpha, host_mode),
+            x,
+            hipblas_shift(m, incx),
+            incx,
+            stride_x,
+            y,
+            hipblas_shift(n, incy),
+            incy,
+            stride_y,
+            A,
+            lda,
+            stride_A,
+            batch_count);
+    return hipblas_launch_status();
+}
+
+template <typename T, bool BATCHED, typename I>
+hipblasStatus_t hipblasBatchedHemv(hipblasHandle_t                   handle,
+                                   hipblasFillMode_t                 uplo,
+                                   I                                 n,
+                                   const T*                          alpha,
+                                   hipblasBatchPtr<const T, BATCHED> A,
+                                   I                                 lda,
+                                   hipblasStride                     stride_A,
+                                   hipblasBatchPtr<const T, BATCHED> x,
+                                   I                                 incx,
+                                   hipblasStride                     stride_x,
+                                   const T*                          beta,
+                                   hipblasBatchPtr<T, BATCHED>       y,
+                                   I                                 incy,
+                                   hipblasStride                     stride_y,
+                                   I                                 batch_count)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!hipblas_valid_fill(uplo))
+        return hipblas_fill_status(uplo);
+    if(n < 0 || lda < n || lda < 1 || !incx || !incy || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t     stream;
+    bool            host_mode;
+    hipblasStatus_t status = hipblas_get_handle(handle, &stream, &host_mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(host_mode)
+    {
+        if(hipblas_is_zero(*alpha) && hipblas_is_one(*beta))
+            return HIPBLAS_STATUS_SUCCESS;
+        if((!hipblas_is_zero(*alpha) && (!A || !x)) || !y)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    hipblasHemvBatchedKernel<T>
+        <<<hipblas_blocks(int64_t(n) * batch_count), hipblas_batched_block, 0, stream>>>(
+            uplo == HIPBLAS_FILL_MODE_UPPER,
+            n,
+            hipblas_make_scalar(alpha, host_mode),
+            A,
+            lda,
+            stride_A,
+            x,
+            hipblas_shift(n, incx),
+            incx,
+            stride_x,
+            hipblas_make_scalar(beta, host_mode),
+            y,
+            hipblas_shift(n, incy),
+            incy,
+            stride_y,
+            batch_count);
+    return hipblas_launch_status();
+}
+
+template <typename T, bool BATCHED, typename I>
+hipblasStatus_t hipblasBatchedTbsv(hipblasHandle_t                   handle,
+                                   hipblasFillMode_t                 uplo,
+                                   hipblasOperation_t                transA,
+                                   hipblasDiagType_t                 diag,
+                                   I                                 n,
+                                   I                                 k,
+                                   hipblasBatchPtr<const T, BATCHED> A,
+                                   I                                 lda,
+                                   hipblasStride                     stride_A,
+                                   hipblasBatchPtr<T, BATCHED>       x,
+                                   I                                 incx,
+                                   hipblasStride                     stride_x,
+                                   I                                 batch_count)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!hipblas_valid_fill(uplo))
+        return hipblas_fill_status(uplo);
+    if(transA != HIPBLAS_OP_N && transA != HIPBLAS_OP_T && transA != HIPBLAS_OP_C)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(diag != HIPBLAS_DIAG_NON_UNIT && diag != HIPBLAS_DIAG_UNIT)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(n < 0 || k < 0 || lda < k + 1 || !incx || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!A || !x)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t     stream;
+    bool            host_mode;
+    hipblasStatus_t status = hipblas_get_handle(handle, &stream, &host_mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // the transpose of a real matrix is its conjugate transpose
+    int op = transA == HIPBLAS_OP_N ? 0 : transA == HIPBLAS_OP_C && hipblas_is_complex<T> ? 2 : 1;
+    hipblasTbsvBatchedKernel<T>
+        <<<hipblas_blocks(batch_count), hipblas_batched_block, 0, stream>>>(
+            uplo == HIPBLAS_FILL_MODE_UPPER,
+            op,
+            diag == HIPBLAS_DIAG_UNIT,
+            n,
+            k,
+            A,
+            lda,
+            stride_A,
+            x,
+            hipblas_shift(n, incx),
+            incx,
+            stride_x,
+            batch_count);
+    return hipblas_launch_status();
+}
+
+/****************************************************************************
+ * Instantiations
+ ***************************************************************************/
+#define INSTANTIATE_BATCHED(T_, Tr_, BATCHED_, I_)                                              \
+    template hipblasStatus_t hipblasBatchedAxpy<T_, BATCHED_, I_>(                              \
+        hipblasHandle_t,                                                                        \
+        I_,                                                                                     \
+        const T_*,                                                                              \
+        hipblasBatchPtr<const T_, BATCHED_>,                                                    \
+        I_,                                                                                     \
+        hipblasStride,                                                                          \
+        hipblasBatchPtr<T_, BATCHED_>,                                                          \
+        I_,                                                                                     \
+        hipblasStride,                                                                          \
+        I_);                                                                                    \
+    template hipblasStatus_t hipblasBatchedScal<T_, T_, BATCHED_, I_>(                          \
+        hipblasHandle_t, I_, const T_*, hipblasBatchPtr<T_, BATCHED_>, I_, hipblasStride, I_);  \
+    template hipblasStatus_t hipblasBatchedAsum<T_, Tr_, BATCHED_, I_>(                         \
+        hipblasHandle_t, I_, hipblasBatchPtr<const T_, BATCHED_>, I_, hipblasStride, I_, Tr_*); \
+    template hipblasStatus_t hipblasBatchedIamaxIamin<true, T_, BATCHED_, I_>(                  \
+        hipblasHandle_t, I_, hipblasBatchPtr<const T_, BATCHED_>, I_, hipblasStride, I_, I_*);  \
+    template hipblasStatus_t hipblasBatchedIamaxIamin<false, T_, BATCHED_, I_>(                 \
+        hipblasHandle_t, I_, hipblasBatchPtr<const T_, BATCHED_>, I_, hipblasStride, I_, I_*);  \
+    template hipblasStatus_t hipblasBatchedGer<false, T_, BATCHED_, I_>(                        \
+        hipblasHandle_t,                                                                        \
+        I_,                                                                                     \
+        I_,                                                                                     \
+        const T_*,                                                                              \
+        hipblasBatchPtr<const T_, BATCHED_>,                                                    \
+        I_,                                                                                     \
+        hipblasStride,                                                                          \
+        hipblasBatchPtr<const T_, BATCHED_>,                                                    \
+        I_,                                                                                     \
+        hipblasStride,                                                                          \
+        hipblasBatchPtr<T_, BATCHED_>,                                                          \
+        I_,                                                                                     \
+        hipblasStride,                                                                          \
+        I_);                                                                                    \
+    template hipblasStatus_t hipblasBatchedGer<true, T_, BATCHED_, I_>(                         \
+        hipblasHandle_t,                                                                        \
+        I_,                                                                                     \
+        I_,                                                                                     \
+        const T_*,                                                                              \
+        hipblasBatchPtr<const T_, BATCHED_>,                                                    \
+        I_,                                                                                     \
+        hipblasStride,                                                                          \
+        hipblasBatchPtr<const T_, BATCHED_>,                                                    \
+        I_,                                                                                     \
+        hipblasStride,                                                                          \
+        hipblasBatchPtr<T_, BATCHED_>,                                                          \
+        I_,                                                                                     \
+        hipblasStride,                                                                          \
+        I_);                                                                                    \
+    template hipblasStatus_t hipblasBatchedHemv<T_, BATCHED_, I_>(                              \
+        hipblasHandle_t,                                                                        \
+        hipblasFillMode_t,                                                                      \
+        I_,                                                                                     \
+        const T_*,                                                                              \
+        hipblasBatchPtr<const T_, BATCHED_>,                                                    \
+        I_,                                                                                     \
+        hipblasStride,                                                                          \
+        hipblasBatchPtr<const T_, BATCHED_>,                                                    \
+        I_,                                                                                     \
+        hipblasStride,                                                                          \
+        const T_*,                                                                              \
+        hipblasBatchPtr<T_, BATCHED_>,                                                          \
+        I_,                                                                                     \
+        hipblasStride,                                                                          \
+        I_);                                                                                    \
+    template hipblasStatus_t hipblasBatchedTbsv<T_, BATCHED_, I_>(                              \
+        hipblasHandle_t,                                                                        \
+        hipblasFillMode_t,                                                                      \
+        hipblasOperation_t,                                                                     \
+        hipblasDiagType_t,                                                                      \
+        I_,                                                                                     \
+        I_,                                                                                     \
+        hipblasBatchPtr<const T_, BATCHED_>,                                                    \
+        I_,                                                                                     \
+        hipblasStride,                                                                          \
+        hipblasBatchPtr<T_, BATCHED_>,                                                          \
+        I_,                                                                                     \
+        hipblasStride,                                                                          \
+        I_);
+
+// scal of a complex vector by a real alpha
+#define INSTANTIATE_BATCHED_REAL_SCAL(T_, Tr_, BATCHED_, I_)            \
+    template hipblasStatus_t hipblasBatchedScal<T_, Tr_, BATCHED_, I_>( \
+        hipblasHandle_t, I_, const Tr_*, hipblasBatchPtr<T_, BATCHED_>, I_, hipblasStride, I_);
+
+#define INSTANTIATE_BATCHED_BFDOT(BATCHED_, I_)                 \
+    template hipblasStatus_t hipblasBatchedBfdot<BATCHED_, I_>( \
+        hipblasHandle_t,                                        \
+        I_,                                                     \
+        hipblasBatchPtr<const hipblasBfloat16, BATCHED_>,       \
+        I_,                                                     \
+        hipblasStride,                                          \
+        hipblasBatchPtr<const hipblasBfloat16, BATCHED_>,       \
+        I_,                                                     \
+        hipblasStride,                                          \
+        I_,                                                     \
+        hipblasBfloat16*);
+
+#define INSTANTIATE_BATCHED_TYPES(BATCHED_, I_)                           \
+    INSTANTIATE_BATCHED(float, float, BATCHED_, I_)                       \
+    INSTANTIATE_BATCHED(double, double, BATCHED_, I_)                     \
+    INSTANTIATE_BATCHED(hipFloatComplex, float, BATCHED_, I_)             \
+    INSTANTIATE_BATCHED(hipDoubleComplex, double, BATCHED_, I_)           \
+    INSTANTIATE_BATCHED_REAL_SCAL(hipFloatComplex, float, BATCHED_, I_)   \
+    INSTANTIATE_BATCHED_REAL_SCAL(hipDoubleComplex, double, BATCHED_, I_) \
+    INSTANTIATE_BATCHED_BFDOT(BATCHED_, I_)
+
+INSTANTIATE_BATCHED_TYPES(true, int)
+INSTANTIATE_BATCHED_TYPES(false, int)
+INSTANTIATE_BATCHED_TYPES(true, int64_t)
+INSTANTIATE_BATCHED_TYPES(false, int64_t)
+
+#undef INSTANTIATE_BATCHED_TYPES
+#undef INSTANTIATE_BATCHED_BFDOT
+#undef INSTANTIATE_BATCHED_REAL_SCAL
+#undef INSTANTIATE_BATCHED
@@ -0,0 +1,150 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+#include <type_traits>
+
+// Batched level 1 and level 2 functions for the cuBLAS backend, which cuBLAS doesn't have.
+//
+// These are HIP kernels in hipblas_batched.cpp, compiled by nvcc. Each kernel computes all the
+// problems of a batch in one launch, so that a large batch of small problems fills the device
+// instead of launching one problem at a time. The arguments are checked as rocBLAS checks them,
+// so both backends return the same status for the same call.
+//
+// T is float, double, hipComplex or hipDoubleComplex and I is int or int64_t. The functions are
+// called with the stream and the pointer mode of the cuBLAS handle.
+
+// The vectors or matrices of a batch: an array of pointers with BATCHED, or else the first one
+// with the given stride between them
+template <typename T, bool BATCHED>
+using hipblasBatchPtr = std::conditional_t<BATCHED, T* const*, T*>;
+
+// y := alpha * x + y
+template <typename T, bool BATCHED, typename I>
+hipblasStatus_t hipblasBatchedAxpy(hipblasHandle_t                   handle,
+                                   I                                 n,
+                                   const T*                          alpha,
+                                   hipblasBatchPtr<const T, BATCHED> x,
+                                   I                                 incx,
+                                   hipblasStride                     stride_x,
+                                   hipblasBatchPtr<T, BATCHED>       y,
+                                   I                                 incy,
+                                   hipblasStride                     stride_y,
+                                   I                                 batch_count);
+
+// x := alpha * x, where alpha is T or the real type of T
+template <typename T, typename Ta, bool BATCHED, typename I>
+hipblasStatus_t hipblasBatchedScal(hipblasHandle_t             handle,
+                                   I                           n,
+                                   const Ta*                   alpha,
+                                   hipblasBatchPtr<T, BATCHED> x,
+                                   I                           incx,
+                                   hipblasStride               stride_x,
+                                   I                           batch_count);
+
+// result[b] := sum of |real(x_b[i])| + |imag(x_b[i])|, where Tr is the real type of T
+template <typename T, typename Tr, bool BATCHED, typename I>
+hipblasStatus_t hipblasBatchedAsum(hipblasHandle_t                   handle,
+                                   I                                 n,
+                                   hipblasBatchPtr<const T, BATCHED> x,
+                                   I                                 incx,
+                                   hipblasStride                     stride_x,
+                                   I                                 batch_count,
+                                   Tr*                               result);
+
+// result[b] := x_b**T * y_b, where x, y and result are bfloat16 and the sum is computed in float
+template <bool BATCHED, typename I>
+hipblasStatus_t hipblasBatchedBfdot(hipblasHandle_t                                 handle,
+                                    I                                               n,
+                                    hipblasBatchPtr<const hipblasBfloat16, BATCHED> x,
+                                    I                                               incx,
+                                    hipblasStride                                   stride_x,
+                                    hipblasBatchPtr<const hipblasBfloat16, BATCHED> y,
+                                    I                                               incy,
+                                    hipblasStride                                   stride_y,
+                                    I                                               batch_count,
+                                    hipblasBfloat16*                                result);
+
+// result[b] := the first one-based index of the largest (IS_MAX) or smallest
+// |real(x_b[i])| + |imag(x_b[i])|
+template <bool IS_MAX, typename T, bool BATCHED, typename I>
+hipblasStatus_t hipblasBatchedIamaxIamin(hipblasHandle_t                   handle,
+                                         I                                 n,
+                                         hipblasBatchPtr<const T, BATCHED> x,
+                                         I                                 incx,
+                                         hipblasStride                     stride_x,
+                                         I                                 batch_count,
+                                         I*                                result);
+
+// A := alpha * x * y**T + A, or alpha * x * y**H + A with CONJ
+template <bool CONJ, typename T, bool BATCHED, typename I>
+hipblasStatus_t hipblasBatchedGer(hipblasHandle_t                   handle,
+                                  I                                 m,
+                                  I                                 n,
+                                  const T*                          alpha,
+                                  hipblasBatchPtr<const T, BATCHED> x,
+                                  I                                 incx,
+                                  hipblasStride                     stride_x,
+                                  hipblasBatchPtr<const T, BATCHED> y,
+                                  I                                 incy,
+                                  hipblasStride                     stride_y,
+                                  hipblasBatchPtr<T, BATCHED>       A,
+                                  I                                 lda,
+                                  hipblasStride                     stride_A,
+                                  I                                 batch_count);
+
+// y := alpha * A * x + beta * y, where A is Hermitian
+template <typename T, bool BATCHED, typename I>
+hipblasStatus_t hipblasBatchedHemv(hipblasHandle_t                   handle,
+                                   hipblasFillMode_t                 uplo,
+                                   I                                 n,
+                                   const T*                          alpha,
+                                   hipblasBatchPtr<const T, BATCHED> A,
+                                   I                                 lda,
+                                   hipblasStride                     stride_A,
+                                   hipblasBatchPtr<const T, BATCHED> x,
+                                   I                                 incx,
+                                   hipblasStride                     stride_x,
+                                   const T*                          beta,
+                                   hipblasBatchPtr<T, BATCHED>       y,
+                                   I                                 incy,
+                                   hipblasStride                     stride_y,
+                                   I                                 batch_count);
+
+// Solves op(A) * x = b for x, where A is triangular and banded with k diagonals, and x
+// holds b on entry
+template <typename T, bool BATCHED, typename I>
+hipblasStatus_t hipblasBatchedTbsv(hipblasHandle_t                   handle,
+                                   hipblasFillMode_t                 uplo,
+                                   hipblasOperation_t                transA,
+                                   hipblasDiagType_t                 diag,
+                                   I                                 n,
+                                   I                                 k,
+                                   hipblasBatchPtr<const T, BATCHED> A,
+                                   I                                 lda,
+                                   hipblasStride                     stride_A,
+                                   hipblasBatchPtr<T, BATCHED>       x,
+                                   I                                 incx,
+                                   hipblasStride                     stride_x,
+                                   I                                 batch_count);
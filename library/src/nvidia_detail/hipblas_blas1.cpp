@@ -0,0 +1,10042 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas_internal.hpp"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// amax
+hipblasStatus_t hipblasIsamax(hipblasHandle_t handle, int n, const float* x, int incx, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleIamax(handle, n, x, incx, result, HIP_R_32F);
+    return hipblasConvertStatus(cublasIsamax((cublasHandle_t)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdamax(hipblasHandle_t handle, int n, const double* x, int incx, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleIamax(handle, n, x, incx, result, HIP_R_64F);
+    return hipblasConvertStatus(cublasIdamax((cublasHandle_t)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasIcamax(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleIamax(handle, n, x, incx, result, HIP_C_32F);
+    return hipblasConvertStatus(
+        cublasIcamax((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamax(
+    hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleIamax(handle, n, x, incx, result, HIP_C_64F);
+    return hipblasConvertStatus(
+        cublasIzamax((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasIcamax_v2(hipblasHandle_t handle, int n, const hipComplex* x, int incx, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleIamax(handle, n, x, incx, result, HIP_C_32F);
+    return hipblasConvertStatus(
+        cublasIcamax((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamax_v2(
+    hipblasHandle_t handle, int n, const hipDoubleComplex* x, int incx, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleIamax(handle, n, x, incx, result, HIP_C_64F);
+    return hipblasConvertStatus(
+        cublasIzamax((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// amax_64
+hipblasStatus_t hipblasIsamax_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasIsamax_64((cublasHandle_t)handle, n, x, incx, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdamax_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasIdamax_64((cublasHandle_t)handle, n, x, incx, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamax_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasIcamax_64((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamax_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasIzamax_64((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamax_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipComplex* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasIcamax_64((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamax_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipDoubleComplex* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasIzamax_64((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// amax_batched
+hipblasStatus_t hipblasIsamaxBatched(
+    hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<true, float, true>(handle, n, x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdamaxBatched(
+    hipblasHandle_t handle, int n, const double* const x[], int incx, int batchCount, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<true, double, true>(handle, n, x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamaxBatched(hipblasHandle_t             handle,
+                                     int                         n,
+                                     const hipblasComplex* const x[],
+                                     int                         incx,
+                                     int                         batchCount,
+                                     int*                        result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<true, hipComplex, true>(
+        handle, n, (const hipComplex* const*)x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamaxBatched(hipblasHandle_t                   handle,
+                                     int                               n,
+                                     const hipblasDoubleComplex* const x[],
+                                     int                               incx,
+                                     int                               batchCount,
+                                     int*                              result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<true, hipDoubleComplex, true>(
+        handle, n, (const hipDoubleComplex* const*)x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamaxBatched_v2(hipblasHandle_t         handle,
+                                        int                     n,
+                                        const hipComplex* const x[],
+                                        int                     incx,
+                                        int                     batchCount,
+                                        int*                    result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<true, hipComplex, true>(
+        handle, n, x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamaxBatched_v2(hipblasHandle_t               handle,
+                                        int                           n,
+                                        const hipDoubleComplex* const x[],
+                                        int                           incx,
+                                        int                           batchCount,
+                                        int*                          result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<true, hipDoubleComplex, true>(
+        handle, n, x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// amax_batched_64
+hipblasStatus_t hipblasIsamaxBatched_64(hipblasHandle_t    handle,
+                                        int64_t            n,
+                                        const float* const x[],
+                                        int64_t            incx,
+                                        int64_t            batchCount,
+                                        int64_t*           result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<true, float, true>(handle, n, x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdamaxBatched_64(hipblasHandle_t     handle,
+                                        int64_t             n,
+                                        const double* const x[],
+                                        int64_t             incx,
+                                        int64_t             batchCount,
+                                        int64_t*            result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<true, double, true>(handle, n, x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamaxBatched_64(hipblasHandle_t             handle,
+                                        int64_t                     n,
+                                        const hipblasComplex* const x[],
+                                        int64_t                     incx,
+                                        int64_t                     batchCount,
+                                        int64_t*                    result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<true, hipComplex, true>(
+        handle, n, (const hipComplex* const*)x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamaxBatched_64(hipblasHandle_t                   handle,
+                                        int64_t                           n,
+                                        const hipblasDoubleComplex* const x[],
+                                        int64_t                           incx,
+                                        int64_t                           batchCount,
+                                        int64_t*                          result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<true, hipDoubleComplex, true>(
+        handle, n, (const hipDoubleComplex* const*)x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamaxBatched_v2_64(hipblasHandle_t         handle,
+                                           int64_t                 n,
+                                           const hipComplex* const x[],
+                                           int64_t                 incx,
+                                           int64_t                 batchCount,
+                                           int64_t*                result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<true, hipComplex, true>(
+        handle, n, x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamaxBatched_v2_64(hipblasHandle_t               handle,
+                                           int64_t                       n,
+                                           const hipDoubleComplex* const x[],
+                                           int64_t                       incx,
+                                           int64_t                       batchCount,
+                                           int64_t*                      result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<true, hipDoubleComplex, true>(
+        handle, n, x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// amax_strided_batched
+hipblasStatus_t hipblasIsamaxStridedBatched(hipblasHandle_t handle,
+                                            int             n,
+                                            const float*    x,
+                                            int             incx,
+                                            hipblasStride   stridex,
+                                            int             batchCount,
+                                            int*            result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<true, float, false>(
+        handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdamaxStridedBatched(hipblasHandle_t handle,
+                                            int             n,
+                                            const double*   x,
+                                            int             incx,
+                                            hipblasStride   stridex,
+                                            int             batchCount,
+                                            int*            result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<true, double, false>(
+        handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamaxStridedBatched(hipblasHandle_t       handle,
+                                            int                   n,
+                                            const hipblasComplex* x,
+                                            int                   incx,
+                                            hipblasStride         stridex,
+                                            int                   batchCount,
+                                            int*                  result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<true, hipComplex, false>(
+        handle, n, (const hipComplex*)x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamaxStridedBatched(hipblasHandle_t             handle,
+                                            int                         n,
+                                            const hipblasDoubleComplex* x,
+                                            int                         incx,
+                                            hipblasStride               stridex,
+                                            int                         batchCount,
+                                            int*                        result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<true, hipDoubleComplex, false>(
+        handle, n, (const hipDoubleComplex*)x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamaxStridedBatched_v2(hipblasHandle_t   handle,
+                                               int               n,
+                                               const hipComplex* x,
+                                               int               incx,
+                                               hipblasStride     stridex,
+                                               int               batchCount,
+                                               int*              result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<true, hipComplex, false>(
+        handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamaxStridedBatched_v2(hipblasHandle_t         handle,
+                                               int                     n,
+                                               const hipDoubleComplex* x,
+                                               int                     incx,
+                                               hipblasStride           stridex,
+                                               int                     batchCount,
+                                               int*                    result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<true, hipDoubleComplex, false>(
+        handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// amax_strided_batched_64
+hipblasStatus_t hipblasIsamaxStridedBatched_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               const float*    x,
+                                               int64_t         incx,
+                                               hipblasStride   stridex,
+                                               int64_t         batchCount,
+                                               int64_t*        result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<true, float, false>(
+        handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdamaxStridedBatched_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               const double*   x,
+                                               int64_t         incx,
+                                               hipblasStride   stridex,
+                                               int64_t         batchCount,
+                                               int64_t*        result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<true, double, false>(
+        handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamaxStridedBatched_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasStride         stridex,
+                                               int64_t               batchCount,
+                                               int64_t*              result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<true, hipComplex, false>(
+        handle, n, (const hipComplex*)x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamaxStridedBatched_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               hipblasStride               stridex,
+                                               int64_t                     batchCount,
+                                               int64_t*                    result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<true, hipDoubleComplex, false>(
+        handle, n, (const hipDoubleComplex*)x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamaxStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                  int64_t           n,
+                                                  const hipComplex* x,
+                                                  int64_t           incx,
+                                                  hipblasStride     stridex,
+                                                  int64_t           batchCount,
+                                                  int64_t*          result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<true, hipComplex, false>(
+        handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamaxStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                  int64_t                 n,
+                                                  const hipDoubleComplex* x,
+                                                  int64_t                 incx,
+                                                  hipblasStride           stridex,
+                                                  int64_t                 batchCount,
+                                                  int64_t*                result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<true, hipDoubleComplex, false>(
+        handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// amin
+hipblasStatus_t hipblasIsamin(hipblasHandle_t handle, int n, const float* x, int incx, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(cublasIsamin((cublasHandle_t)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdamin(hipblasHandle_t handle, int n, const double* x, int incx, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(cublasIdamin((cublasHandle_t)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasIcamin(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    return hipblasConvertStatus(
+        cublasIcamin((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamin(
+    hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        cublasIzamin((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasIcamin_v2(hipblasHandle_t handle, int n, const hipComplex* x, int incx, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    return hipblasConvertStatus(
+        cublasIcamin((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamin_v2(
+    hipblasHandle_t handle, int n, const hipDoubleComplex* x, int incx, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(
+        cublasIzamin((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// amin_64
+hipblasStatus_t hipblasIsamin_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasIsamin_64((cublasHandle_t)handle, n, x, incx, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdamin_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasIdamin_64((cublasHandle_t)handle, n, x, incx, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamin_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasIcamin_64((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamin_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasIzamin_64((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamin_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipComplex* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasIcamin_64((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamin_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipDoubleComplex* x, int64_t incx, int64_t* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasIzamin_64((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// amin_batched
+hipblasStatus_t hipblasIsaminBatched(
+    hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<false, float, true>(handle, n, x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdaminBatched(
+    hipblasHandle_t handle, int n, const double* const x[], int incx, int batchCount, int* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<false, double, true>(handle, n, x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcaminBatched(hipblasHandle_t             handle,
+                                     int                         n,
+                                     const hipblasComplex* const x[],
+                                     int                         incx,
+                                     int                         batchCount,
+                                     int*                        result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<false, hipComplex, true>(
+        handle, n, (const hipComplex* const*)x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzaminBatched(hipblasHandle_t                   handle,
+                                     int                               n,
+                                     const hipblasDoubleComplex* const x[],
+                                     int                               incx,
+                                     int                               batchCount,
+                                     int*                              result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<false, hipDoubleComplex, true>(
+        handle, n, (const hipDoubleComplex* const*)x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcaminBatched_v2(hipblasHandle_t         handle,
+                                        int                     n,
+                                        const hipComplex* const x[],
+                                        int                     incx,
+                                        int                     batchCount,
+                                        int*                    result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<false, hipComplex, true>(
+        handle, n, x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzaminBatched_v2(hipblasHandle_t               handle,
+                                        int                           n,
+                                        const hipDoubleComplex* const x[],
+                                        int                           incx,
+                                        int                           batchCount,
+                                        int*                          result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<false, hipDoubleComplex, true>(
+        handle, n, x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// amin_batched_64
+hipblasStatus_t hipblasIsaminBatched_64(hipblasHandle_t    handle,
+                                        int64_t            n,
+                                        const float* const x[],
+                                        int64_t            incx,
+                                        int64_t            batchCount,
+                                        int64_t*           result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<false, float, true>(handle, n, x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdaminBatched_64(hipblasHandle_t     handle,
+                                        int64_t             n,
+                                        const double* const x[],
+                                        int64_t             incx,
+                                        int64_t             batchCount,
+                                        int64_t*            result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<false, double, true>(handle, n, x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcaminBatched_64(hipblasHandle_t             handle,
+                                        int64_t                     n,
+                                        const hipblasComplex* const x[],
+                                        int64_t                     incx,
+                                        int64_t                     batchCount,
+                                        int64_t*                    result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<false, hipComplex, true>(
+        handle, n, (const hipComplex* const*)x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzaminBatched_64(hipblasHandle_t                   handle,
+                                        int64_t                           n,
+                                        const hipblasDoubleComplex* const x[],
+                                        int64_t                           incx,
+                                        int64_t                           batchCount,
+                                        int64_t*                          result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<false, hipDoubleComplex, true>(
+        handle, n, (const hipDoubleComplex* const*)x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcaminBatched_v2_64(hipblasHandle_t         handle,
+                                           int64_t                 n,
+                                           const hipComplex* const x[],
+                                           int64_t                 incx,
+                                           int64_t                 batchCount,
+                                           int64_t*                result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<false, hipComplex, true>(
+        handle, n, x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzaminBatched_v2_64(hipblasHandle_t               handle,
+                                           int64_t                       n,
+                                           const hipDoubleComplex* const x[],
+                                           int64_t                       incx,
+                                           int64_t                       batchCount,
+                                           int64_t*                      result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<false, hipDoubleComplex, true>(
+        handle, n, x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// amin_strided_batched
+hipblasStatus_t hipblasIsaminStridedBatched(hipblasHandle_t handle,
+                                            int             n,
+                                            const float*    x,
+                                            int             incx,
+                                            hipblasStride   stridex,
+                                            int             batchCount,
+                                            int*            result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<false, float, false>(
+        handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdaminStridedBatched(hipblasHandle_t handle,
+                                            int             n,
+                                            const double*   x,
+                                            int             incx,
+                                            hipblasStride   stridex,
+                                            int             batchCount,
+                                            int*            result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<false, double, false>(
+        handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcaminStridedBatched(hipblasHandle_t       handle,
+                                            int                   n,
+                                            const hipblasComplex* x,
+                                            int                   incx,
+                                            hipblasStride         stridex,
+                                            int                   batchCount,
+                                            int*                  result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<false, hipComplex, false>(
+        handle, n, (const hipComplex*)x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzaminStridedBatched(hipblasHandle_t             handle,
+                                            int                         n,
+                                            const hipblasDoubleComplex* x,
+                                            int                         incx,
+                                            hipblasStride               stridex,
+                                            int                         batchCount,
+                                            int*                        result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<false, hipDoubleComplex, false>(
+        handle, n, (const hipDoubleComplex*)x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcaminStridedBatched_v2(hipblasHandle_t   handle,
+                                               int               n,
+                                               const hipComplex* x,
+                                               int               incx,
+                                               hipblasStride     stridex,
+                                               int               batchCount,
+                                               int*              result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<false, hipComplex, false>(
+        handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzaminStridedBatched_v2(hipblasHandle_t         handle,
+                                               int                     n,
+                                               const hipDoubleComplex* x,
+                                               int                     incx,
+                                               hipblasStride           stridex,
+                                               int                     batchCount,
+                                               int*                    result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<false, hipDoubleComplex, false>(
+        handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// amin_strided_batched_64
+hipblasStatus_t hipblasIsaminStridedBatched_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               const float*    x,
+                                               int64_t         incx,
+                                               hipblasStride   stridex,
+                                               int64_t         batchCount,
+                                               int64_t*        result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<false, float, false>(
+        handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdaminStridedBatched_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               const double*   x,
+                                               int64_t         incx,
+                                               hipblasStride   stridex,
+                                               int64_t         batchCount,
+                                               int64_t*        result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<false, double, false>(
+        handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcaminStridedBatched_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasStride         stridex,
+                                               int64_t               batchCount,
+                                               int64_t*              result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<false, hipComplex, false>(
+        handle, n, (const hipComplex*)x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzaminStridedBatched_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               hipblasStride               stridex,
+                                               int64_t                     batchCount,
+                                               int64_t*                    result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<false, hipDoubleComplex, false>(
+        handle, n, (const hipDoubleComplex*)x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcaminStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                  int64_t           n,
+                                                  const hipComplex* x,
+                                                  int64_t           incx,
+                                                  hipblasStride     stridex,
+                                                  int64_t           batchCount,
+                                                  int64_t*          result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<false, hipComplex, false>(
+        handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzaminStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                  int64_t                 n,
+                                                  const hipDoubleComplex* x,
+                                                  int64_t                 incx,
+                                                  hipblasStride           stridex,
+                                                  int64_t                 batchCount,
+                                                  int64_t*                result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedIamaxIamin<false, hipDoubleComplex, false>(
+        handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// asum
+hipblasStatus_t hipblasSasum(hipblasHandle_t handle, int n, const float* x, int incx, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleAsum(handle, n, x, incx, result, HIP_R_32F);
+    return hipblasConvertStatus(cublasSasum((cublasHandle_t)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasDasum(hipblasHandle_t handle, int n, const double* x, int incx, double* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleAsum(handle, n, x, incx, result, HIP_R_64F);
+    return hipblasConvertStatus(cublasDasum((cublasHandle_t)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasScasum(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleAsum(handle, n, x, incx, result, HIP_C_32F);
+    return hipblasConvertStatus(
+        cublasScasum((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDzasum(
+    hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleAsum(handle, n, x, incx, result, HIP_C_64F);
+    return hipblasConvertStatus(
+        cublasDzasum((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasScasum_v2(hipblasHandle_t handle, int n, const hipComplex* x, int incx, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleAsum(handle, n, x, incx, result, HIP_C_32F);
+    return hipblasConvertStatus(
+        cublasScasum((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDzasum_v2(
+    hipblasHandle_t handle, int n, const hipDoubleComplex* x, int incx, double* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleAsum(handle, n, x, incx, result, HIP_C_64F);
+    return hipblasConvertStatus(
+        cublasDzasum((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// asum_64
+hipblasStatus_t
+    hipblasSasum_64(hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasSasum_64((cublasHandle_t)handle, n, x, incx, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDasum_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasDasum_64((cublasHandle_t)handle, n, x, incx, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScasum_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasScasum_64((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDzasum_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasDzasum_64((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScasum_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipComplex* x, int64_t incx, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasScasum_64((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDzasum_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipDoubleComplex* x, int64_t incx, double* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasDzasum_64((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// asum_batched
+hipblasStatus_t hipblasSasumBatched(
+    hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedAsum<float, float, true>(handle, n, x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDasumBatched(hipblasHandle_t     handle,
+                                    int                 n,
+                                    const double* const x[],
+                                    int                 incx,
+                                    int                 batchCount,
+                                    double*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedAsum<double, double, true>(handle, n, x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScasumBatched(hipblasHandle_t             handle,
+                                     int                         n,
+                                     const hipblasComplex* const x[],
+                                     int                         incx,
+                                     int                         batchCount,
+                                     float*                      result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedAsum<hipComplex, float, true>(
+        handle, n, (const hipComplex* const*)x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDzasumBatched(hipblasHandle_t                   handle,
+                                     int                               n,
+                                     const hipblasDoubleComplex* const x[],
+                                     int                               incx,
+                                     int                               batchCount,
+                                     double*                           result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedAsum<hipDoubleComplex, double, true>(
+        handle, n, (const hipDoubleComplex* const*)x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScasumBatched_v2(hipblasHandle_t         handle,
+                                        int                     n,
+                                        const hipComplex* const x[],
+                                        int                     incx,
+                                        int                     batchCount,
+                                        float*                  result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedAsum<hipComplex, float, true>(handle, n, x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDzasumBatched_v2(hipblasHandle_t               handle,
+                                        int                           n,
+                                        const hipDoubleComplex* const x[],
+                                        int                           incx,
+                                        int                           batchCount,
+                                        double*                       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedAsum<hipDoubleComplex, double, true>(
+        handle, n, x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// asum_batched_64
+hipblasStatus_t hipblasSasumBatched_64(hipblasHandle_t    handle,
+                                       int64_t            n,
+                                       const float* const x[],
+                                       int64_t            incx,
+                                       int64_t            batchCount,
+                                       float*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedAsum<float, float, true>(handle, n, x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDasumBatched_64(hipblasHandle_t     handle,
+                                       int64_t             n,
+                                       const double* const x[],
+                                       int64_t             incx,
+                                       int64_t             batchCount,
+                                       double*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedAsum<double, double, true>(handle, n, x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScasumBatched_64(hipblasHandle_t             handle,
+                                        int64_t                     n,
+                                        const hipblasComplex* const x[],
+                                        int64_t                     incx,
+                                        int64_t                     batchCount,
+                                        float*                      result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedAsum<hipComplex, float, true>(
+        handle, n, (const hipComplex* const*)x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDzasumBatched_64(hipblasHandle_t                   handle,
+                                        int64_t                           n,
+                                        const hipblasDoubleComplex* const x[],
+                                        int64_t                           incx,
+                                        int64_t                           batchCount,
+                                        double*                           result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedAsum<hipDoubleComplex, double, true>(
+        handle, n, (const hipDoubleComplex* const*)x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScasumBatched_v2_64(hipblasHandle_t         handle,
+                                           int64_t                 n,
+                                           const hipComplex* const x[],
+                                           int64_t                 incx,
+                                           int64_t                 batchCount,
+                                           float*                  result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedAsum<hipComplex, float, true>(handle, n, x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDzasumBatched_v2_64(hipblasHandle_t               handle,
+                                           int64_t                       n,
+                                           const hipDoubleComplex* const x[],
+                                           int64_t                       incx,
+                                           int64_t                       batchCount,
+                                           double*                       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedAsum<hipDoubleComplex, double, true>(
+        handle, n, x, incx, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// asum_strided_batched
+hipblasStatus_t hipblasSasumStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           const float*    x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           int             batchCount,
+                                           float*          result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedAsum<float, float, false>(handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDasumStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           const double*   x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           int             batchCount,
+                                           double*         result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedAsum<double, double, false>(
+        handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScasumStridedBatched(hipblasHandle_t       handle,
+                                            int                   n,
+                                            const hipblasComplex* x,
+                                            int                   incx,
+                                            hipblasStride         stridex,
+                                            int                   batchCount,
+                                            float*                result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedAsum<hipComplex, float, false>(
+        handle, n, (const hipComplex*)x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDzasumStridedBatched(hipblasHandle_t             handle,
+                                            int                         n,
+                                            const hipblasDoubleComplex* x,
+                                            int                         incx,
+                                            hipblasStride               stridex,
+                                            int                         batchCount,
+                                            double*                     result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedAsum<hipDoubleComplex, double, false>(
+        handle, n, (const hipDoubleComplex*)x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScasumStridedBatched_v2(hipblasHandle_t   handle,
+                                               int               n,
+                                               const hipComplex* x,
+                                               int               incx,
+                                               hipblasStride     stridex,
+                                               int               batchCount,
+                                               float*            result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedAsum<hipComplex, float, false>(
+        handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDzasumStridedBatched_v2(hipblasHandle_t         handle,
+                                               int                     n,
+                                               const hipDoubleComplex* x,
+                                               int                     incx,
+                                               hipblasStride           stridex,
+                                               int                     batchCount,
+                                               double*                 result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedAsum<hipDoubleComplex, double, false>(
+        handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// asum_strided_batched_64
+hipblasStatus_t hipblasSasumStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const float*    x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              int64_t         batchCount,
+                                              float*          result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedAsum<float, float, false>(handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDasumStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const double*   x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              int64_t         batchCount,
+                                              double*         result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedAsum<double, double, false>(
+        handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScasumStridedBatched_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasStride         stridex,
+                                               int64_t               batchCount,
+                                               float*                result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedAsum<hipComplex, float, false>(
+        handle, n, (const hipComplex*)x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDzasumStridedBatched_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               hipblasStride               stridex,
+                                               int64_t                     batchCount,
+                                               double*                     result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedAsum<hipDoubleComplex, double, false>(
+        handle, n, (const hipDoubleComplex*)x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScasumStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                  int64_t           n,
+                                                  const hipComplex* x,
+                                                  int64_t           incx,
+                                                  hipblasStride     stridex,
+                                                  int64_t           batchCount,
+                                                  float*            result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedAsum<hipComplex, float, false>(
+        handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDzasumStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                  int64_t                 n,
+                                                  const hipDoubleComplex* x,
+                                                  int64_t                 incx,
+                                                  hipblasStride           stridex,
+                                                  int64_t                 batchCount,
+                                                  double*                 result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedAsum<hipDoubleComplex, double, false>(
+        handle, n, x, incx, stridex, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// axpy
+hipblasStatus_t hipblasHaxpy(hipblasHandle_t    handle,
+                             int                n,
+                             const hipblasHalf* alpha,
+                             const hipblasHalf* x,
+                             int                incx,
+                             hipblasHalf*       y,
+                             int                incy)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSaxpy(
+    hipblasHandle_t handle, int n, const float* alpha, const float* x, int incx, float* y, int incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t deferred = hipblasDeferVector(handle, n, alpha, x, incx, y, incy, HIP_R_32F);
+    if(deferred != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return deferred;
+    hipblasStatus_t host = hipblasHostAxpy(handle, n, alpha, x, incx, y, incy, HIP_R_32F);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    return hipblasConvertStatus(cublasSaxpy((cublasHandle_t)handle, n, alpha, x, incx, y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDaxpy(hipblasHandle_t handle,
+                             int             n,
+                             const double*   alpha,
+                             const double*   x,
+                             int             incx,
+                             double*         y,
+                             int             incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t deferred = hipblasDeferVector(handle, n, alpha, x, incx, y, incy, HIP_R_64F);
+    if(deferred != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return deferred;
+    hipblasStatus_t host = hipblasHostAxpy(handle, n, alpha, x, incx, y, incy, HIP_R_64F);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    return hipblasConvertStatus(cublasDaxpy((cublasHandle_t)handle, n, alpha, x, incx, y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCaxpy(hipblasHandle_t       handle,
+                             int                   n,
+                             const hipblasComplex* alpha,
+                             const hipblasComplex* x,
+                             int                   incx,
+                             hipblasComplex*       y,
+                             int                   incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostAxpy(handle, n, alpha, x, incx, y, incy, HIP_C_32F);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    return hipblasConvertStatus(cublasCaxpy(
+        (cublasHandle_t)handle, n, (cuComplex*)alpha, (cuComplex*)x, incx, (cuComplex*)y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZaxpy(hipblasHandle_t             handle,
+                             int                         n,
+                             const hipblasDoubleComplex* alpha,
+                             const hipblasDoubleComplex* x,
+                             int                         incx,
+                             hipblasDoubleComplex*       y,
+                             int                         incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostAxpy(handle, n, alpha, x, incx, y, incy, HIP_C_64F);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    return hipblasConvertStatus(cublasZaxpy((cublasHandle_t)handle,
+                                            n,
+                                            (cuDoubleComplex*)alpha,
+                                            (cuDoubleComplex*)x,
+                                            incx,
+                                            (cuDoubleComplex*)y,
+                                            incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCaxpy_v2(hipblasHandle_t   handle,
+                                int               n,
+                                const hipComplex* alpha,
+                                const hipComplex* x,
+                                int               incx,
+                                hipComplex*       y,
+                                int               incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostAxpy(handle, n, alpha, x, incx, y, incy, HIP_C_32F);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    return hipblasConvertStatus(cublasCaxpy(
+        (cublasHandle_t)handle, n, (cuComplex*)alpha, (cuComplex*)x, incx, (cuComplex*)y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZaxpy_v2(hipblasHandle_t         handle,
+                                int                     n,
+                                const hipDoubleComplex* alpha,
+                                const hipDoubleComplex* x,
+                                int                     incx,
+                                hipDoubleComplex*       y,
+                                int                     incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostAxpy(handle, n, alpha, x, incx, y, incy, HIP_C_64F);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    return hipblasConvertStatus(cublasZaxpy((cublasHandle_t)handle,
+                                            n,
+                                            (cuDoubleComplex*)alpha,
+                                            (cuDoubleComplex*)x,
+                                            incx,
+                                            (cuDoubleComplex*)y,
+                                            incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// 64-bit interface
+hipblasStatus_t hipblasHaxpy_64(hipblasHandle_t    handle,
+                                int64_t            n,
+                                const hipblasHalf* alpha,
+                                const hipblasHalf* x,
+                                int64_t            incx,
+                                hipblasHalf*       y,
+                                int64_t            incy)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSaxpy_64(hipblasHandle_t handle,
+                                int64_t         n,
+                                const float*    alpha,
+                                const float*    x,
+                                int64_t         incx,
+                                float*          y,
+                                int64_t         incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasSaxpy_64((cublasHandle_t)handle, n, alpha, x, incx, y, incy));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDaxpy_64(hipblasHandle_t handle,
+                                int64_t         n,
+                                const double*   alpha,
+                                const double*   x,
+                                int64_t         incx,
+                                double*         y,
+                                int64_t         incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasDaxpy_64((cublasHandle_t)handle, n, alpha, x, incx, y, incy));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCaxpy_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                hipblasComplex*       y,
+                                int64_t               incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasCaxpy_64(
+        (cublasHandle_t)handle, n, (cuComplex*)alpha, (cuComplex*)x, incx, (cuComplex*)y, incy));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZaxpy_64(hipblasHandle_t             handle,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                hipblasDoubleComplex*       y,
+                                int64_t                     incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasZaxpy_64((cublasHandle_t)handle,
+                                               n,
+                                               (cuDoubleComplex*)alpha,
+                                               (cuDoubleComplex*)x,
+                                               incx,
+                                               (cuDoubleComplex*)y,
+                                               incy));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCaxpy_v2_64(hipblasHandle_t   handle,
+                                   int64_t           n,
+                                   const hipComplex* alpha,
+                                   const hipComplex* x,
+                                   int64_t           incx,
+                                   hipComplex*       y,
+                                   int64_t           incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasCaxpy_64(
+        (cublasHandle_t)handle, n, (cuComplex*)alpha, (cuComplex*)x, incx, (cuComplex*)y, incy));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZaxpy_v2_64(hipblasHandle_t         handle,
+                                   int64_t                 n,
+                                   const hipDoubleComplex* alpha,
+                                   const hipDoubleComplex* x,
+                                   int64_t                 incx,
+                                   hipDoubleComplex*       y,
+                                   int64_t                 incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasZaxpy_64((cublasHandle_t)handle,
+                                               n,
+                                               (cuDoubleComplex*)alpha,
+                                               (cuDoubleComplex*)x,
+                                               incx,
+                                               (cuDoubleComplex*)y,
+                                               incy));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// axpy_batched
+hipblasStatus_t hipblasHaxpyBatched(hipblasHandle_t          handle,
+                                    int                      n,
+                                    const hipblasHalf*       alpha,
+                                    const hipblasHalf* const x[],
+                                    int                      incx,
+                                    hipblasHalf* const       y[],
+                                    int                      incy,
+                                    int                      batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSaxpyBatched(hipblasHandle_t    handle,
+                                    int                n,
+                                    const float*       alpha,
+                                    const float* const x[],
+                                    int                incx,
+                                    float* const       y[],
+                                    int                incy,
+                                    int                batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedAxpy<float, true>(handle, n, alpha, x, incx, 0, y, incy, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDaxpyBatched(hipblasHandle_t     handle,
+                                    int                 n,
+                                    const double*       alpha,
+                                    const double* const x[],
+                                    int                 incx,
+                                    double* const       y[],
+                                    int                 incy,
+                                    int                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedAxpy<double, true>(handle, n, alpha, x, incx, 0, y, incy, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCaxpyBatched(hipblasHandle_t             handle,
+                                    int                         n,
+                                    const hipblasComplex*       alpha,
+                                    const hipblasComplex* const x[],
+                                    int                         incx,
+                                    hipblasComplex* const       y[],
+                                    int                         incy,
+                                    int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedAxpy<hipComplex, true>(handle,
+                                                n,
+                                                (const hipComplex*)alpha,
+                                                (const hipComplex* const*)x,
+                                                incx,
+                                                0,
+                                                (hipComplex* const*)y,
+                                                incy,
+                                                0,
+                                                batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZaxpyBatched(hipblasHandle_t                   handle,
+                                    int                               n,
+                                    const hipblasDoubleComplex*       alpha,
+                                    const hipblasDoubleComplex* const x[],
+                                    int                               incx,
+                                    hipblasDoubleComplex* const       y[],
+                                    int                               incy,
+                                    int                               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedAxpy<hipDoubleComplex, true>(handle,
+                                                      n,
+                                                      (const hipDoubleComplex*)alpha,
+                                                      (const hipDoubleComplex* const*)x,
+                                                      incx,
+                                                      0,
+                                                      (hipDoubleComplex* const*)y,
+                                                      incy,
+                                                      0,
+                                                      batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCaxpyBatched_v2(hipblasHandle_t         handle,
+                                       int                     n,
+                                       const hipComplex*       alpha,
+                                       const hipComplex* const x[],
+                                       int                     incx,
+                                       hipComplex* const       y[],
+                                       int                     incy,
+                                       int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedAxpy<hipComplex, true>(
+        handle, n, alpha, x, incx, 0, y, incy, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZaxpyBatched_v2(hipblasHandle_t               handle,
+                                       int                           n,
+                                       const hipDoubleComplex*       alpha,
+                                       const hipDoubleComplex* const x[],
+                                       int                           incx,
+                                       hipDoubleComplex* const       y[],
+                                       int                           incy,
+                                       int                           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedAxpy<hipDoubleComplex, true>(
+        handle, n, alpha, x, incx, 0, y, incy, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// 64-bit interface
+hipblasStatus_t hipblasHaxpyBatched_64(hipblasHandle_t          handle,
+                                       int64_t                  n,
+                                       const hipblasHalf*       alpha,
+                                       const hipblasHalf* const x[],
+                                       int64_t                  incx,
+                                       hipblasHalf* const       y[],
+                                       int64_t                  incy,
+                                       int64_t                  batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSaxpyBatched_64(hipblasHandle_t    handle,
+                                       int64_t            n,
+                                       const float*       alpha,
+                                       const float* const x[],
+                                       int64_t            incx,
+                                       float* const       y[],
+                                       int64_t            incy,
+                                       int64_t            batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedAxpy<float, true>(handle, n, alpha, x, incx, 0, y, incy, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDaxpyBatched_64(hipblasHandle_t     handle,
+                                       int64_t             n,
+                                       const double*       alpha,
+                                       const double* const x[],
+                                       int64_t             incx,
+                                       double* const       y[],
+                                       int64_t             incy,
+                                       int64_t             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedAxpy<double, true>(handle, n, alpha, x, incx, 0, y, incy, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCaxpyBatched_64(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const x[],
+                                       int64_t                     incx,
+                                       hipblasComplex* const       y[],
+                                       int64_t                     incy,
+                                       int64_t                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedAxpy<hipComplex, true>(handle,
+                                                n,
+                                                (const hipComplex*)alpha,
+                                                (const hipComplex* const*)x,
+                                                incx,
+                                                0,
+                                                (hipComplex* const*)y,
+                                                incy,
+                                                0,
+                                                batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZaxpyBatched_64(hipblasHandle_t                   handle,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const x[],
+                                       int64_t                           incx,
+                                       hipblasDoubleComplex* const       y[],
+                                       int64_t                           incy,
+                                       int64_t                           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedAxpy<hipDoubleComplex, true>(handle,
+                                                      n,
+                                                      (const hipDoubleComplex*)alpha,
+                                                      (const hipDoubleComplex* const*)x,
+                                                      incx,
+                                                      0,
+                                                      (hipDoubleComplex* const*)y,
+                                                      incy,
+                                                      0,
+                                                      batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCaxpyBatched_v2_64(hipblasHandle_t         handle,
+                                          int64_t                 n,
+                                          const hipComplex*       alpha,
+                                          const hipComplex* const x[],
+                                          int64_t                 incx,
+                                          hipComplex* const       y[],
+                                          int64_t                 incy,
+                                          int64_t                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedAxpy<hipComplex, true>(
+        handle, n, alpha, x, incx, 0, y, incy, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZaxpyBatched_v2_64(hipblasHandle_t               handle,
+                                          int64_t                       n,
+                                          const hipDoubleComplex*       alpha,
+                                          const hipDoubleComplex* const x[],
+                                          int64_t                       incx,
+                                          hipDoubleComplex* const       y[],
+                                          int64_t                       incy,
+                                          int64_t                       batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedAxpy<hipDoubleComplex, true>(
+        handle, n, alpha, x, incx, 0, y, incy, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// axpy_strided_batched
+hipblasStatus_t hipblasHaxpyStridedBatched(hipblasHandle_t    handle,
+                                           int                n,
+                                           const hipblasHalf* alpha,
+                                           const hipblasHalf* x,
+                                           int                incx,
+                                           hipblasStride      stridex,
+                                           hipblasHalf*       y,
+                                           int                incy,
+                                           hipblasStride      stridey,
+                                           int                batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSaxpyStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           const float*    alpha,
+                                           const float*    x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           float*          y,
+                                           int             incy,
+                                           hipblasStride   stridey,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedAxpy<float, false>(
+        handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDaxpyStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           const double*   alpha,
+                                           const double*   x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           double*         y,
+                                           int             incy,
+                                           hipblasStride   stridey,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedAxpy<double, false>(
+        handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCaxpyStridedBatched(hipblasHandle_t       handle,
+                                           int                   n,
+                                           const hipblasComplex* alpha,
+                                           const hipblasComplex* x,
+                                           int                   incx,
+                                           hipblasStride         stridex,
+                                           hipblasComplex*       y,
+                                           int                   incy,
+                                           hipblasStride         stridey,
+                                           int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedAxpy<hipComplex, false>(handle,
+                                                 n,
+                                                 (const hipComplex*)alpha,
+                                                 (const hipComplex*)x,
+                                                 incx,
+                                                 stridex,
+                                                 (hipComplex*)y,
+                                                 incy,
+                                                 stridey,
+                                                 batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZaxpyStridedBatched(hipblasHandle_t             handle,
+                                           int                         n,
+                                           const hipblasDoubleComplex* alpha,
+                                           const hipblasDoubleComplex* x,
+                                           int                         incx,
+                                           hipblasStride               stridex,
+                                           hipblasDoubleComplex*       y,
+                                           int                         incy,
+                                           hipblasStride               stridey,
+                                           int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedAxpy<hipDoubleComplex, false>(handle,
+                                                       n,
+                                                       (const hipDoubleComplex*)alpha,
+                                                       (const hipDoubleComplex*)x,
+                                                       incx,
+                                                       stridex,
+                                                       (hipDoubleComplex*)y,
+                                                       incy,
+                                                       stridey,
+                                                       batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCaxpyStridedBatched_v2(hipblasHandle_t   handle,
+                                              int               n,
+                                              const hipComplex* alpha,
+                                              const hipComplex* x,
+                                              int               incx,
+                                              hipblasStride     stridex,
+                                              hipComplex*       y,
+                                              int               incy,
+                                              hipblasStride     stridey,
+                                              int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedAxpy<hipComplex, false>(
+        handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZaxpyStridedBatched_v2(hipblasHandle_t         handle,
+                                              int                     n,
+                                              const hipDoubleComplex* alpha,
+                                              const hipDoubleComplex* x,
+                                              int                     incx,
+                                              hipblasStride           stridex,
+                                              hipDoubleComplex*       y,
+                                              int                     incy,
+                                              hipblasStride           stridey,
+                                              int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedAxpy<hipDoubleComplex, false>(
+        handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// 64-bit interface
+hipblasStatus_t hipblasHaxpyStridedBatched_64(hipblasHandle_t    handle,
+                                              int64_t            n,
+                                              const hipblasHalf* alpha,
+                                              const hipblasHalf* x,
+                                              int64_t            incx,
+                                              hipblasStride      stridex,
+                                              hipblasHalf*       y,
+                                              int64_t            incy,
+                                              hipblasStride      stridey,
+                                              int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSaxpyStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const float*    alpha,
+                                              const float*    x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              float*          y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedAxpy<float, false>(
+        handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDaxpyStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const double*   alpha,
+                                              const double*   x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              double*         y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedAxpy<double, false>(
+        handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCaxpyStridedBatched_64(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              hipblasComplex*       y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedAxpy<hipComplex, false>(handle,
+                                                 n,
+                                                 (const hipComplex*)alpha,
+                                                 (const hipComplex*)x,
+                                                 incx,
+                                                 stridex,
+                                                 (hipComplex*)y,
+                                                 incy,
+                                                 stridey,
+                                                 batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZaxpyStridedBatched_64(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              hipblasDoubleComplex*       y,
+                                              int64_t                     incy,
+                                              hipblasStride               stridey,
+                                              int64_t                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedAxpy<hipDoubleComplex, false>(handle,
+                                                       n,
+                                                       (const hipDoubleComplex*)alpha,
+                                                       (const hipDoubleComplex*)x,
+                                                       incx,
+                                                       stridex,
+                                                       (hipDoubleComplex*)y,
+                                                       incy,
+                                                       stridey,
+                                                       batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCaxpyStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                 int64_t           n,
+                                                 const hipComplex* alpha,
+                                                 const hipComplex* x,
+                                                 int64_t           incx,
+                                                 hipblasStride     stridex,
+                                                 hipComplex*       y,
+                                                 int64_t           incy,
+                                                 hipblasStride     stridey,
+                                                 int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedAxpy<hipComplex, false>(
+        handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZaxpyStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                 int64_t                 n,
+                                                 const hipDoubleComplex* alpha,
+                                                 const hipDoubleComplex* x,
+                                                 int64_t                 incx,
+                                                 hipblasStride           stridex,
+                                                 hipDoubleComplex*       y,
+                                                 int64_t                 incy,
+                                                 hipblasStride           stridey,
+                                                 int64_t                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedAxpy<hipDoubleComplex, false>(
+        handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// copy
+hipblasStatus_t
+    hipblasScopy(hipblasHandle_t handle, int n, const float* x, int incx, float* y, int incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(cublasScopy((cublasHandle_t)handle, n, x, incx, y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasDcopy(hipblasHandle_t handle, int n, const double* x, int incx, double* y, int incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(cublasDcopy((cublasHandle_t)handle, n, x, incx, y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCcopy(
+    hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, hipblasComplex* y, int incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(
+        cublasCcopy((cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZcopy(hipblasHandle_t             handle,
+                             int                         n,
+                             const hipblasDoubleComplex* x,
+                             int                         incx,
+                             hipblasDoubleComplex*       y,
+                             int                         incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(cublasZcopy(
+        (cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, (cuDoubleComplex*)y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCcopy_v2(
+    hipblasHandle_t handle, int n, const hipComplex* x, int incx, hipComplex* y, int incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(
+        cublasCcopy((cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZcopy_v2(hipblasHandle_t         handle,
+                                int                     n,
+                                const hipDoubleComplex* x,
+                                int                     incx,
+                                hipDoubleComplex*       y,
+                                int                     incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(cublasZcopy(
+        (cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, (cuDoubleComplex*)y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// 64-bit interface
+hipblasStatus_t hipblasScopy_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* y, int64_t incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasScopy_64((cublasHandle_t)handle, n, x, incx, y, incy));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDcopy_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* y, int64_t incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasDcopy_64((cublasHandle_t)handle, n, x, incx, y, incy));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCcopy_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                hipblasComplex*       y,
+                                int64_t               incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasCcopy_64((cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZcopy_64(hipblasHandle_t             handle,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                hipblasDoubleComplex*       y,
+                                int64_t                     incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasZcopy_64(
+        (cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, (cuDoubleComplex*)y, incy));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCcopy_v2_64(hipblasHandle_t   handle,
+                                   int64_t           n,
+                                   const hipComplex* x,
+                                   int64_t           incx,
+                                   hipComplex*       y,
+                                   int64_t           incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasCcopy_64((cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZcopy_v2_64(hipblasHandle_t         handle,
+                                   int64_t                 n,
+                                   const hipDoubleComplex* x,
+                                   int64_t                 incx,
+                                   hipDoubleComplex*       y,
+                                   int64_t                 incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasZcopy_64(
+        (cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, (cuDoubleComplex*)y, incy));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// copy_batched
+hipblasStatus_t hipblasScopyBatched(hipblasHandle_t    handle,
+                                    int                n,
+                                    const float* const x[],
+                                    int                incx,
+                                    float* const       y[],
+                                    int                incy,
+                                    int                batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasScopy((cublasHandle_t)handle,
+                                                    n,
+                                                    p(x, b),
+                                                    incx,
+                                                    p(y, b),
+                                                    incy));
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDcopyBatched(hipblasHandle_t     handle,
+                                    int                 n,
+                                    const double* const x[],
+                                    int                 incx,
+                                    double* const       y[],
+                                    int                 incy,
+                                    int                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasDcopy((cublasHandle_t)handle,
+                                                    n,
+                                                    p(x, b),
+                                                    incx,
+                                                    p(y, b),
+                                                    incy));
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCcopyBatched(hipblasHandle_t             handle,
+                                    int                         n,
+                                    const hipblasComplex* const x[],
+                                    int                         incx,
+                                    hipblasComplex* const       y[],
+                                    int                         incy,
+                                    int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasCcopy((cublasHandle_t)handle,
+                                                    n,
+                                                    (cuComplex*)p(x, b),
+                                                    incx,
+                                                    (cuComplex*)p(y, b),
+                                                    incy));
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZcopyBatched(hipblasHandle_t                   handle,
+                                    int                               n,
+                                    const hipblasDoubleComplex* const x[],
+                                    int                               incx,
+                                    hipblasDoubleComplex* const       y[],
+                                    int                               incy,
+                                    int                               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasZcopy((cublasHandle_t)handle,
+                                                    n,
+                                                    (cuDoubleComplex*)p(x, b),
+                                                    incx,
+                                                    (cuDoubleComplex*)p(y, b),
+                                                    incy));
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCcopyBatched_v2(hipblasHandle_t         handle,
+                                       int                     n,
+                                       const hipComplex* const x[],
+                                       int                     incx,
+                                       hipComplex* const       y[],
+                                       int                     incy,
+                                       int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasCcopy((cublasHandle_t)handle,
+                                                    n,
+                                                    (cuComplex*)p(x, b),
+                                                    incx,
+                                                    (cuComplex*)p(y, b),
+                                                    incy));
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZcopyBatched_v2(hipblasHandle_t               handle,
+                                       int                           n,
+                                       const hipDoubleComplex* const x[],
+                                       int                           incx,
+                                       hipDoubleComplex* const       y[],
+                                       int                           incy,
+                                       int                           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasZcopy((cublasHandle_t)handle,
+                                                    n,
+                                                    (cuDoubleComplex*)p(x, b),
+                                                    incx,
+                                                    (cuDoubleComplex*)p(y, b),
+                                                    incy));
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// 64-bit interface
+hipblasStatus_t hipblasScopyBatched_64(hipblasHandle_t    handle,
+                                       int64_t            n,
+                                       const float* const x[],
+                                       int64_t            incx,
+                                       float* const       y[],
+                                       int64_t            incy,
+                                       int64_t            batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasScopy_64((cublasHandle_t)handle,
+                                                       n,
+                                                       p(x, b),
+                                                       incx,
+                                                       p(y, b),
+                                                       incy));
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDcopyBatched_64(hipblasHandle_t     handle,
+                                       int64_t             n,
+                                       const double* const x[],
+                                       int64_t             incx,
+                                       double* const       y[],
+                                       int64_t             incy,
+                                       int64_t             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasDcopy_64((cublasHandle_t)handle,
+                                                       n,
+                                                       p(x, b),
+                                                       incx,
+                                                       p(y, b),
+                                                       incy));
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCcopyBatched_64(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       const hipblasComplex* const x[],
+                                       int64_t                     incx,
+                                       hipblasComplex* const       y[],
+                                       int64_t                     incy,
+                                       int64_t                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasCcopy_64((cublasHandle_t)handle,
+                                                       n,
+                                                       (cuComplex*)p(x, b),
+                                                       incx,
+                                                       (cuComplex*)p(y, b),
+                                                       incy));
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZcopyBatched_64(hipblasHandle_t                   handle,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex* const x[],
+                                       int64_t                           incx,
+                                       hipblasDoubleComplex* const       y[],
+                                       int64_t                           incy,
+                                       int64_t                           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasZcopy_64((cublasHandle_t)handle,
+                                                       n,
+                                                       (cuDoubleComplex*)p(x, b),
+                                                       incx,
+                                                       (cuDoubleComplex*)p(y, b),
+                                                       incy));
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCcopyBatched_v2_64(hipblasHandle_t         handle,
+                                          int64_t                 n,
+                                          const hipComplex* const x[],
+                                          int64_t                 incx,
+                                          hipComplex* const       y[],
+                                          int64_t                 incy,
+                                          int64_t                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasCcopy_64((cublasHandle_t)handle,
+                                                       n,
+                                                       (cuComplex*)p(x, b),
+                                                       incx,
+                                                       (cuComplex*)p(y, b),
+                                                       incy));
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZcopyBatched_v2_64(hipblasHandle_t               handle,
+                                          int64_t                       n,
+                                          const hipDoubleComplex* const x[],
+                                          int64_t                       incx,
+                                          hipDoubleComplex* const       y[],
+                                          int64_t                       incy,
+                                          int64_t                       batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasZcopy_64((cublasHandle_t)handle,
+                                                       n,
+                                                       (cuDoubleComplex*)p(x, b),
+                                                       incx,
+                                                       (cuDoubleComplex*)p(y, b),
+                                                       incy));
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// copy_strided_batched
+hipblasStatus_t hipblasScopyStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           const float*    x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           float*          y,
+                                           int             incy,
+                                           hipblasStride   stridey,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasScopy((cublasHandle_t)handle,
+                                                n,
+                                                (x + b * stridex),
+                                                incx,
+                                                (y + b * stridey),
+                                                incy));
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDcopyStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           const double*   x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           double*         y,
+                                           int             incy,
+                                           hipblasStride   stridey,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasDcopy((cublasHandle_t)handle,
+                                                n,
+                                                (x + b * stridex),
+                                                incx,
+                                                (y + b * stridey),
+                                                incy));
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCcopyStridedBatched(hipblasHandle_t       handle,
+                                           int                   n,
+                                           const hipblasComplex* x,
+                                           int                   incx,
+                                           hipblasStride         stridex,
+                                           hipblasComplex*       y,
+                                           int                   incy,
+                                           hipblasStride         stridey,
+                                           int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasCcopy((cublasHandle_t)handle,
+                                                n,
+                                                (cuComplex*)(x + b * stridex),
+                                                incx,
+                                                (cuComplex*)(y + b * stridey),
+                                                incy));
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZcopyStridedBatched(hipblasHandle_t             handle,
+                                           int                         n,
+                                           const hipblasDoubleComplex* x,
+                                           int                         incx,
+                                           hipblasStride               stridex,
+                                           hipblasDoubleComplex*       y,
+                                           int                         incy,
+                                           hipblasStride               stridey,
+                                           int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasZcopy((cublasHandle_t)handle,
+                                                n,
+                                                (cuDoubleComplex*)(x + b * stridex),
+                                                incx,
+                                                (cuDoubleComplex*)(y + b * stridey),
+                                                incy));
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCcopyStridedBatched_v2(hipblasHandle_t   handle,
+                                              int               n,
+                                              const hipComplex* x,
+                                              int               incx,
+                                              hipblasStride     stridex,
+                                              hipComplex*       y,
+                                              int               incy,
+                                              hipblasStride     stridey,
+                                              int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasCcopy((cublasHandle_t)handle,
+                                                n,
+                                                (cuComplex*)(x + b * stridex),
+                                                incx,
+                                                (cuComplex*)(y + b * stridey),
+                                                incy));
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZcopyStridedBatched_v2(hipblasHandle_t         handle,
+                                              int                     n,
+                                              const hipDoubleComplex* x,
+                                              int                     incx,
+                                              hipblasStride           stridex,
+                                              hipDoubleComplex*       y,
+                                              int                     incy,
+                                              hipblasStride           stridey,
+                                              int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasZcopy((cublasHandle_t)handle,
+                                                n,
+                                                (cuDoubleComplex*)(x + b * stridex),
+                                                incx,
+                                                (cuDoubleComplex*)(y + b * stridey),
+                                                incy));
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// 64-bit interface
+hipblasStatus_t hipblasScopyStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const float*    x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              float*          y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasScopy_64((cublasHandle_t)handle,
+                                                   n,
+                                                   (x + b * stridex),
+                                                   incx,
+                                                   (y + b * stridey),
+                                                   incy));
+    });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDcopyStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const double*   x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              double*         y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasDcopy_64((cublasHandle_t)handle,
+                                                   n,
+                                                   (x + b * stridex),
+                                                   incx,
+                                                   (y + b * stridey),
+                                                   incy));
+    });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCcopyStridedBatched_64(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              hipblasComplex*       y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasCcopy_64((cublasHandle_t)handle,
+                                                   n,
+                                                   (cuComplex*)(x + b * stridex),
+                                                   incx,
+                                                   (cuComplex*)(y + b * stridey),
+                                                   incy));
+    });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZcopyStridedBatched_64(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              hipblasDoubleComplex*       y,
+                                              int64_t                     incy,
+                                              hipblasStride               stridey,
+                                              int64_t                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasZcopy_64((cublasHandle_t)handle,
+                                                   n,
+                                                   (cuDoubleComplex*)(x + b * stridex),
+                                                   incx,
+                                                   (cuDoubleComplex*)(y + b * stridey),
+                                                   incy));
+    });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCcopyStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                 int64_t           n,
+                                                 const hipComplex* x,
+                                                 int64_t           incx,
+                                                 hipblasStride     stridex,
+                                                 hipComplex*       y,
+                                                 int64_t           incy,
+                                                 hipblasStride     stridey,
+                                                 int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasCcopy_64((cublasHandle_t)handle,
+                                                   n,
+                                                   (cuComplex*)(x + b * stridex),
+                                                   incx,
+                                                   (cuComplex*)(y + b * stridey),
+                                                   incy));
+    });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZcopyStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                 int64_t                 n,
+                                                 const hipDoubleComplex* x,
+                                                 int64_t                 incx,
+                                                 hipblasStride           stridex,
+                                                 hipDoubleComplex*       y,
+                                                 int64_t                 incy,
+                                                 hipblasStride           stridey,
+                                                 int64_t                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasZcopy_64((cublasHandle_t)handle,
+                                                   n,
+                                                   (cuDoubleComplex*)(x + b * stridex),
+                                                   incx,
+                                                   (cuDoubleComplex*)(y + b * stridey),
+                                                   incy));
+    });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// dot
+hipblasStatus_t hipblasHdot(hipblasHandle_t    handle,
+                            int                n,
+                            const hipblasHalf* x,
+                            int                incx,
+                            const hipblasHalf* y,
+                            int                incy,
+                            hipblasHalf*       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasBfdot(hipblasHandle_t        handle,
+                             int                    n,
+                             const hipblasBfloat16* x,
+                             int                    incx,
+                             const hipblasBfloat16* y,
+                             int                    incy,
+                             hipblasBfloat16*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(cublasDotEx((cublasHandle_t)handle,
+                                            n,
+                                            x,
+                                            CUDA_R_16BF,
+                                            incx,
+                                            y,
+                                            CUDA_R_16BF,
+                                            incy,
+                                            result,
+                                            CUDA_R_16BF,
+                                            CUDA_R_32F));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSdot(hipblasHandle_t handle,
+                            int             n,
+                            const float*    x,
+                            int             incx,
+                            const float*    y,
+                            int             incy,
+                            float*          result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostDot(handle, n, x, incx, y, incy, result, HIP_R_32F, false);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleDot(handle, n, x, incx, y, incy, result, HIP_R_32F, false);
+    return hipblasConvertStatus(cublasSdot((cublasHandle_t)handle, n, x, incx, y, incy, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDdot(hipblasHandle_t handle,
+                            int             n,
+                            const double*   x,
+                            int             incx,
+                            const double*   y,
+                            int             incy,
+                            double*         result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostDot(handle, n, x, incx, y, incy, result, HIP_R_64F, false);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleDot(handle, n, x, incx, y, incy, result, HIP_R_64F, false);
+    return hipblasConvertStatus(cublasDdot((cublasHandle_t)handle, n, x, incx, y, incy, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotc(hipblasHandle_t       handle,
+                             int                   n,
+                             const hipblasComplex* x,
+                             int                   incx,
+                             const hipblasComplex* y,
+                             int                   incy,
+                             hipblasComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostDot(handle, n, x, incx, y, incy, result, HIP_C_32F, true);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleDot(handle, n, x, incx, y, incy, result, HIP_C_32F, true);
+    return hipblasConvertStatus(cublasCdotc(
+        (cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, (cuComplex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotu(hipblasHandle_t       handle,
+                             int                   n,
+                             const hipblasComplex* x,
+                             int                   incx,
+                             const hipblasComplex* y,
+                             int                   incy,
+                             hipblasComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostDot(handle, n, x, incx, y, incy, result, HIP_C_32F, false);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleDot(handle, n, x, incx, y, incy, result, HIP_C_32F, false);
+    return hipblasConvertStatus(cublasCdotu(
+        (cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, (cuComplex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotc(hipblasHandle_t             handle,
+                             int                         n,
+                             const hipblasDoubleComplex* x,
+                             int                         incx,
+                             const hipblasDoubleComplex* y,
+                             int                         incy,
+                             hipblasDoubleComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostDot(handle, n, x, incx, y, incy, result, HIP_C_64F, true);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleDot(handle, n, x, incx, y, incy, result, HIP_C_64F, true);
+    return hipblasConvertStatus(cublasZdotc((cublasHandle_t)handle,
+                                            n,
+                                            (cuDoubleComplex*)x,
+                                            incx,
+                                            (cuDoubleComplex*)y,
+                                            incy,
+                                            (cuDoubleComplex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotu(hipblasHandle_t             handle,
+                             int                         n,
+                             const hipblasDoubleComplex* x,
+                             int                         incx,
+                             const hipblasDoubleComplex* y,
+                             int                         incy,
+                             hipblasDoubleComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostDot(handle, n, x, incx, y, incy, result, HIP_C_64F, false);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleDot(handle, n, x, incx, y, incy, result, HIP_C_64F, false);
+    return hipblasConvertStatus(cublasZdotu((cublasHandle_t)handle,
+                                            n,
+                                            (cuDoubleComplex*)x,
+                                            incx,
+                                            (cuDoubleComplex*)y,
+                                            incy,
+                                            (cuDoubleComplex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotc_v2(hipblasHandle_t   handle,
+                                int               n,
+                                const hipComplex* x,
+                                int               incx,
+                                const hipComplex* y,
+                                int               incy,
+                                hipComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostDot(handle, n, x, incx, y, incy, result, HIP_C_32F, true);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleDot(handle, n, x, incx, y, incy, result, HIP_C_32F, true);
+    return hipblasConvertStatus(cublasCdotc(
+        (cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, (cuComplex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotu_v2(hipblasHandle_t   handle,
+                                int               n,
+                                const hipComplex* x,
+                                int               incx,
+                                const hipComplex* y,
+                                int               incy,
+                                hipComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostDot(handle, n, x, incx, y, incy, result, HIP_C_32F, false);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleDot(handle, n, x, incx, y, incy, result, HIP_C_32F, false);
+    return hipblasConvertStatus(cublasCdotu(
+        (cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, (cuComplex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotc_v2(hipblasHandle_t         handle,
+                                int                     n,
+                                const hipDoubleComplex* x,
+                                int                     incx,
+                                const hipDoubleComplex* y,
+                                int                     incy,
+                                hipDoubleComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostDot(handle, n, x, incx, y, incy, result, HIP_C_64F, true);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleDot(handle, n, x, incx, y, incy, result, HIP_C_64F, true);
+    return hipblasConvertStatus(cublasZdotc((cublasHandle_t)handle,
+                                            n,
+                                            (cuDoubleComplex*)x,
+                                            incx,
+                                            (cuDoubleComplex*)y,
+                                            incy,
+                                            (cuDoubleComplex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotu_v2(hipblasHandle_t         handle,
+                                int                     n,
+                                const hipDoubleComplex* x,
+                                int                     incx,
+                                const hipDoubleComplex* y,
+                                int                     incy,
+                                hipDoubleComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasStatus_t host = hipblasHostDot(handle, n, x, incx, y, incy, result, HIP_C_64F, false);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleDot(handle, n, x, incx, y, incy, result, HIP_C_64F, false);
+    return hipblasConvertStatus(cublasZdotu((cublasHandle_t)handle,
+                                            n,
+                                            (cuDoubleComplex*)x,
+                                            incx,
+                                            (cuDoubleComplex*)y,
+                                            incy,
+                                            (cuDoubleComplex*)result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// dot_64
+hipblasStatus_t hipblasHdot_64(hipblasHandle_t    handle,
+                               int64_t            n,
+                               const hipblasHalf* x,
+                               int64_t            incx,
+                               const hipblasHalf* y,
+                               int64_t            incy,
+                               hipblasHalf*       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasBfdot_64(hipblasHandle_t        handle,
+                                int64_t                n,
+                                const hipblasBfloat16* x,
+                                int64_t                incx,
+                                const hipblasBfloat16* y,
+                                int64_t                incy,
+                                hipblasBfloat16*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasDotEx_64((cublasHandle_t)handle,
+                                               n,
+                                               x,
+                                               CUDA_R_16BF,
+                                               incx,
+                                               y,
+                                               CUDA_R_16BF,
+                                               incy,
+                                               result,
+                                               CUDA_R_16BF,
+                                               CUDA_R_32F));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSdot_64(hipblasHandle_t handle,
+                               int64_t         n,
+                               const float*    x,
+                               int64_t         incx,
+                               const float*    y,
+                               int64_t         incy,
+                               float*          result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasSdot_64((cublasHandle_t)handle, n, x, incx, y, incy, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDdot_64(hipblasHandle_t handle,
+                               int64_t         n,
+                               const double*   x,
+                               int64_t         incx,
+                               const double*   y,
+                               int64_t         incy,
+                               double*         result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasDdot_64((cublasHandle_t)handle, n, x, incx, y, incy, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotc_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* y,
+                                int64_t               incy,
+                                hipblasComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasCdotc_64(
+        (cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, (cuComplex*)result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotu_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* y,
+                                int64_t               incy,
+                                hipblasComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasCdotu_64(
+        (cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, (cuComplex*)result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotc_64(hipblasHandle_t             handle,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* y,
+                                int64_t                     incy,
+                                hipblasDoubleComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasZdotc_64((cublasHandle_t)handle,
+                                               n,
+                                               (cuDoubleComplex*)x,
+                                               incx,
+                                               (cuDoubleComplex*)y,
+                                               incy,
+                                               (cuDoubleComplex*)result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotu_64(hipblasHandle_t             handle,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* y,
+                                int64_t                     incy,
+                                hipblasDoubleComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasZdotu_64((cublasHandle_t)handle,
+                                               n,
+                                               (cuDoubleComplex*)x,
+                                               incx,
+                                               (cuDoubleComplex*)y,
+                                               incy,
+                                               (cuDoubleComplex*)result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotc_v2_64(hipblasHandle_t   handle,
+                                   int64_t           n,
+                                   const hipComplex* x,
+                                   int64_t           incx,
+                                   const hipComplex* y,
+                                   int64_t           incy,
+                                   hipComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasCdotc_64(
+        (cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, (cuComplex*)result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCdotu_v2_64(hipblasHandle_t   handle,
+                                   int64_t           n,
+                                   const hipComplex* x,
+                                   int64_t           incx,
+                                   const hipComplex* y,
+                                   int64_t           incy,
+                                   hipComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasCdotu_64(
+        (cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, (cuComplex*)result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotc_v2_64(hipblasHandle_t         handle,
+                                   int64_t                 n,
+                                   const hipDoubleComplex* x,
+                                   int64_t                 incx,
+                                   const hipDoubleComplex* y,
+                                   int64_t                 incy,
+                                   hipDoubleComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasZdotc_64((cublasHandle_t)handle,
+                                               n,
+                                               (cuDoubleComplex*)x,
+                                               incx,
+                                               (cuDoubleComplex*)y,
+                                               incy,
+                                               (cuDoubleComplex*)result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdotu_v2_64(hipblasHandle_t         handle,
+                                   int64_t                 n,
+                                   const hipDoubleComplex* x,
+                                   int64_t                 incx,
+                                   const hipDoubleComplex* y,
+                                   int64_t                 incy,
+                                   hipDoubleComplex*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasZdotu_64((cublasHandle_t)handle,
+                                               n,
+                                               (cuDoubleComplex*)x,
+                                               incx,
+                                               (cuDoubleComplex*)y,
+                                               incy,
+                                               (cuDoubleComplex*)result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// dot_batched
+hipblasStatus_t hipblasHdotBatched(hipblasHandle_t          handle,
+                                   int                      n,
+                                   const hipblasHalf* const x[],
+                                   int                      incx,
+                                   const hipblasHalf* const y[],
+                                   int                      incy,
+                                   int                      batchCount,
+                                   hipblasHalf*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    // // TODO warn user that function was demoted to ignore batch
+    // return hipblasConvertStatus(
+    //     cublasSdot((cublasHandle_t)handle, n, x, incx, y, incy, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasBfdotBatched(hipblasHandle_t              handle,
+                                    int                          n,
+                                    const hipblasBfloat16* const x[],
+                                    int                          incx,
+                                    const hipblasBfloat16* const y[],
+                                    int                          incy,
+                                    int                          batchCount,
+                                    hipblasBfloat16*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedBfdot<true>(handle, n, x, incx, 0, y, incy, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSdotBatched(hipblasHandle_t    handle,
+                                   int                n,
+                                   const float* const x[],
+                                   int                incx,
+                                   const float* const y[],
+                                   int                incy,
+                                   int                batchCount,
+                                   float*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    // // TODO warn user that function was demoted to ignore batch
+    // return hipblasConvertStatus(
+    //     cublasSdot((cublasHandle_t)handle, n, x, incx, y, incy, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDdotBatched(hipblasHandle_t     handle,
+                                   int                 n,
+                                   const double* const x[],
+                                   int                 incx,
+                                   const double* const y[],
+                                   int                 incy,
+                                   int                 batchCount,
+                                   double*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCdotcBatched(hipblasHandle_t             handle,
+                                    int                         n,
+                                    const hipblasComplex* const x[],
+                                    int                         incx,
+                                    const hipblasComplex* const y[],
+                                    int                         incy,
+                                    int                         batchCount,
+                                    hipblasComplex*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCdotuBatched(hipblasHandle_t             handle,
+                                    int                         n,
+                                    const hipblasComplex* const x[],
+                                    int                         incx,
+                                    const hipblasComplex* const y[],
+                                    int                         incy,
+                                    int                         batchCount,
+                                    hipblasComplex*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdotcBatched(hipblasHandle_t                   handle,
+                                    int                               n,
+                                    const hipblasDoubleComplex* const x[],
+                                    int                               incx,
+                                    const hipblasDoubleComplex* const y[],
+                                    int                               incy,
+                                    int                               batchCount,
+                                    hipblasDoubleComplex*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdotuBatched(hipblasHandle_t                   handle,
+                                    int                               n,
+                                    const hipblasDoubleComplex* const x[],
+                                    int                               incx,
+                                    const hipblasDoubleComplex* const y[],
+                                    int                               incy,
+                                    int                               batchCount,
+                                    hipblasDoubleComplex*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCdotcBatched_v2(hipblasHandle_t         handle,
+                                       int                     n,
+                                       const hipComplex* const x[],
+                                       int                     incx,
+                                       const hipComplex* const y[],
+                                       int                     incy,
+                                       int                     batchCount,
+                                       hipComplex*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCdotuBatched_v2(hipblasHandle_t         handle,
+                                       int                     n,
+                                       const hipComplex* const x[],
+                                       int                     incx,
+                                       const hipComplex* const y[],
+                                       int                     incy,
+                                       int                     batchCount,
+                                       hipComplex*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdotcBatched_v2(hipblasHandle_t               handle,
+                                       int                           n,
+                                       const hipDoubleComplex* const x[],
+                                       int                           incx,
+                                       const hipDoubleComplex* const y[],
+                                       int                           incy,
+                                       int                           batchCount,
+                                       hipDoubleComplex*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdotuBatched_v2(hipblasHandle_t               handle,
+                                       int                           n,
+                                       const hipDoubleComplex* const x[],
+                                       int                           incx,
+                                       const hipDoubleComplex* const y[],
+                                       int                           incy,
+                                       int                           batchCount,
+                                       hipDoubleComplex*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// dot_batched_64
+hipblasStatus_t hipblasHdotBatched_64(hipblasHandle_t          handle,
+                                      int64_t                  n,
+                                      const hipblasHalf* const x[],
+                                      int64_t                  incx,
+                                      const hipblasHalf* const y[],
+                                      int64_t                  incy,
+                                      int64_t                  batchCount,
+                                      hipblasHalf*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasBfdotBatched_64(hipblasHandle_t              handle,
+                                       int64_t                      n,
+                                       const hipblasBfloat16* const x[],
+                                       int64_t                      incx,
+                                       const hipblasBfloat16* const y[],
+                                       int64_t                      incy,
+                                       int64_t                      batchCount,
+                                       hipblasBfloat16*             result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedBfdot<true>(handle, n, x, incx, 0, y, incy, 0, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSdotBatched_64(hipblasHandle_t    handle,
+                                      int64_t            n,
+                                      const float* const x[],
+                                      int64_t            incx,
+                                      const float* const y[],
+                                      int64_t            incy,
+                                      int64_t            batchCount,
+                                      float*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDdotBatched_64(hipblasHandle_t     handle,
+                                      int64_t             n,
+                                      const double* const x[],
+                                      int64_t             incx,
+                                      const double* const y[],
+                                      int64_t             incy,
+                                      int64_t             batchCount,
+                                      double*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCdotcBatched_64(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       const hipblasComplex* const x[],
+                                       int64_t                     incx,
+                                       const hipblasComplex* const y[],
+                                       int64_t                     incy,
+                                       int64_t                     batchCount,
+                                       hipblasComplex*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCdotuBatched_64(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       const hipblasComplex* const x[],
+                                       int64_t                     incx,
+                                       const hipblasComplex* const y[],
+                                       int64_t                     incy,
+                                       int64_t                     batchCount,
+                                       hipblasComplex*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdotcBatched_64(hipblasHandle_t                   handle,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex* const x[],
+                                       int64_t                           incx,
+                                       const hipblasDoubleComplex* const y[],
+                                       int64_t                           incy,
+                                       int64_t                           batchCount,
+                                       hipblasDoubleComplex*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdotuBatched_64(hipblasHandle_t                   handle,
+                                       int64_t                           n,
+                                       const hipblasDoubleComplex* const x[],
+                                       int64_t                           incx,
+                                       const hipblasDoubleComplex* const y[],
+                                       int64_t                           incy,
+                                       int64_t                           batchCount,
+                                       hipblasDoubleComplex*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCdotcBatched_v2_64(hipblasHandle_t         handle,
+                                          int64_t                 n,
+                                          const hipComplex* const x[],
+                                          int64_t                 incx,
+                                          const hipComplex* const y[],
+                                          int64_t                 incy,
+                                          int64_t                 batchCount,
+                                          hipComplex*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCdotuBatched_v2_64(hipblasHandle_t         handle,
+                                          int64_t                 n,
+                                          const hipComplex* const x[],
+                                          int64_t                 incx,
+                                          const hipComplex* const y[],
+                                          int64_t                 incy,
+                                          int64_t                 batchCount,
+                                          hipComplex*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdotcBatched_v2_64(hipblasHandle_t               handle,
+                                          int64_t                       n,
+                                          const hipDoubleComplex* const x[],
+                                          int64_t                       incx,
+                                          const hipDoubleComplex* const y[],
+                                          int64_t                       incy,
+                                          int64_t                       batchCount,
+                                          hipDoubleComplex*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdotuBatched_v2_64(hipblasHandle_t               handle,
+                                          int64_t                       n,
+                                          const hipDoubleComplex* const x[],
+                                          int64_t                       incx,
+                                          const hipDoubleComplex* const y[],
+                                          int64_t                       incy,
+                                          int64_t                       batchCount,
+                                          hipDoubleComplex*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// dot_strided_batched
+hipblasStatus_t hipblasHdotStridedBatched(hipblasHandle_t    handle,
+                                          int                n,
+                                          const hipblasHalf* x,
+                                          int                incx,
+                                          hipblasStride      stridex,
+                                          const hipblasHalf* y,
+                                          int                incy,
+                                          hipblasStride      stridey,
+                                          int                batchCount,
+                                          hipblasHalf*       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasBfdotStridedBatched(hipblasHandle_t        handle,
+                                           int                    n,
+                                           const hipblasBfloat16* x,
+                                           int                    incx,
+                                           hipblasStride          stridex,
+                                           const hipblasBfloat16* y,
+                                           int                    incy,
+                                           hipblasStride          stridey,
+                                           int                    batchCount,
+                                           hipblasBfloat16*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedBfdot<false>(
+        handle, n, x, incx, stridex, y, incy, stridey, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSdotStridedBatched(hipblasHandle_t handle,
+                                          int             n,
+                                          const float*    x,
+                                          int             incx,
+                                          hipblasStride   stridex,
+                                          const float*    y,
+                                          int             incy,
+                                          hipblasStride   stridey,
+                                          int             batchCount,
+                                          float*          result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDdotStridedBatched(hipblasHandle_t handle,
+                                          int             n,
+                                          const double*   x,
+                                          int             incx,
+                                          hipblasStride   stridex,
+                                          const double*   y,
+                                          int             incy,
+                                          hipblasStride   stridey,
+                                          int             batchCount,
+                                          double*         result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCdotcStridedBatched(hipblasHandle_t       handle,
+                                           int                   n,
+                                           const hipblasComplex* x,
+                                           int                   incx,
+                                           hipblasStride         stridex,
+                                           const hipblasComplex* y,
+                                           int                   incy,
+                                           hipblasStride         stridey,
+                                           int                   batchCount,
+                                           hipblasComplex*       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCdotuStridedBatched(hipblasHandle_t       handle,
+                                           int                   n,
+                                           const hipblasComplex* x,
+                                           int                   incx,
+                                           hipblasStride         stridex,
+                                           const hipblasComplex* y,
+                                           int                   incy,
+                                           hipblasStride         stridey,
+                                           int                   batchCount,
+                                           hipblasComplex*       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdotcStridedBatched(hipblasHandle_t             handle,
+                                           int                         n,
+                                           const hipblasDoubleComplex* x,
+                                           int                         incx,
+                                           hipblasStride               stridex,
+                                           const hipblasDoubleComplex* y,
+                                           int                         incy,
+                                           hipblasStride               stridey,
+                                           int                         batchCount,
+                                           hipblasDoubleComplex*       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdotuStridedBatched(hipblasHandle_t             handle,
+                                           int                         n,
+                                           const hipblasDoubleComplex* x,
+                                           int                         incx,
+                                           hipblasStride               stridex,
+                                           const hipblasDoubleComplex* y,
+                                           int                         incy,
+                                           hipblasStride               stridey,
+                                           int                         batchCount,
+                                           hipblasDoubleComplex*       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCdotcStridedBatched_v2(hipblasHandle_t   handle,
+                                              int               n,
+                                              const hipComplex* x,
+                                              int               incx,
+                                              hipblasStride     stridex,
+                                              const hipComplex* y,
+                                              int               incy,
+                                              hipblasStride     stridey,
+                                              int               batchCount,
+                                              hipComplex*       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCdotuStridedBatched_v2(hipblasHandle_t   handle,
+                                              int               n,
+                                              const hipComplex* x,
+                                              int               incx,
+                                              hipblasStride     stridex,
+                                              const hipComplex* y,
+                                              int               incy,
+                                              hipblasStride     stridey,
+                                              int               batchCount,
+                                              hipComplex*       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdotcStridedBatched_v2(hipblasHandle_t         handle,
+                                              int                     n,
+                                              const hipDoubleComplex* x,
+                                              int                     incx,
+                                              hipblasStride           stridex,
+                                              const hipDoubleComplex* y,
+                                              int                     incy,
+                                              hipblasStride           stridey,
+                                              int                     batchCount,
+                                              hipDoubleComplex*       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdotuStridedBatched_v2(hipblasHandle_t         handle,
+                                              int                     n,
+                                              const hipDoubleComplex* x,
+                                              int                     incx,
+                                              hipblasStride           stridex,
+                                              const hipDoubleComplex* y,
+                                              int                     incy,
+                                              hipblasStride           stridey,
+                                              int                     batchCount,
+                                              hipDoubleComplex*       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// dot_strided_batched_64
+hipblasStatus_t hipblasHdotStridedBatched_64(hipblasHandle_t    handle,
+                                             int64_t            n,
+                                             const hipblasHalf* x,
+                                             int64_t            incx,
+                                             hipblasStride      stridex,
+                                             const hipblasHalf* y,
+                                             int64_t            incy,
+                                             hipblasStride      stridey,
+                                             int64_t            batchCount,
+                                             hipblasHalf*       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasBfdotStridedBatched_64(hipblasHandle_t        handle,
+                                              int64_t                n,
+                                              const hipblasBfloat16* x,
+                                              int64_t                incx,
+                                              hipblasStride          stridex,
+                                              const hipblasBfloat16* y,
+                                              int64_t                incy,
+                                              hipblasStride          stridey,
+                                              int64_t                batchCount,
+                                              hipblasBfloat16*       result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasBatchedBfdot<false>(
+        handle, n, x, incx, stridex, y, incy, stridey, batchCount, result);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSdotStridedBatched_64(hipblasHandle_t handle,
+                                             int64_t         n,
+                                             const float*    x,
+                                             int64_t         incx,
+                                             hipblasStride   stridex,
+                                             const float*    y,
+                                             int64_t         incy,
+                                             hipblasStride   stridey,
+                                             int64_t         batchCount,
+                                             float*          result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDdotStridedBatched_64(hipblasHandle_t handle,
+                                             int64_t         n,
+                                             const double*   x,
+                                             int64_t         incx,
+                                             hipblasStride   stridex,
+                                             const double*   y,
+                                             int64_t         incy,
+                                             hipblasStride   stridey,
+                                             int64_t         batchCount,
+                                             double*         result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCdotcStridedBatched_64(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              const hipblasComplex* y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              int64_t               batchCount,
+                                              hipblasComplex*       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCdotuStridedBatched_64(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              const hipblasComplex* y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              int64_t               batchCount,
+                                              hipblasComplex*       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdotcStridedBatched_64(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              const hipblasDoubleComplex* y,
+                                              int64_t                     incy,
+                                              hipblasStride               stridey,
+                                              int64_t                     batchCount,
+                                              hipblasDoubleComplex*       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdotuStridedBatched_64(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              const hipblasDoubleComplex* y,
+                                              int64_t                     incy,
+                                              hipblasStride               stridey,
+                                              int64_t                     batchCount,
+                                              hipblasDoubleComplex*       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCdotcStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                 int64_t           n,
+                                                 const hipComplex* x,
+                                                 int64_t           incx,
+                                                 hipblasStride     stridex,
+                                                 const hipComplex* y,
+                                                 int64_t           incy,
+                                                 hipblasStride     stridey,
+                                                 int64_t           batchCount,
+                                                 hipComplex*       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCdotuStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                 int64_t           n,
+                                                 const hipComplex* x,
+                                                 int64_t           incx,
+                                                 hipblasStride     stridex,
+                                                 const hipComplex* y,
+                                                 int64_t           incy,
+                                                 hipblasStride     stridey,
+                                                 int64_t           batchCount,
+                                                 hipComplex*       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdotcStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                 int64_t                 n,
+                                                 const hipDoubleComplex* x,
+                                                 int64_t                 incx,
+                                                 hipblasStride           stridex,
+                                                 const hipDoubleComplex* y,
+                                                 int64_t                 incy,
+                                                 hipblasStride           stridey,
+                                                 int64_t                 batchCount,
+                                                 hipDoubleComplex*       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZdotuStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                 int64_t                 n,
+                                                 const hipDoubleComplex* x,
+                                                 int64_t                 incx,
+                                                 hipblasStride           stridex,
+                                                 const hipDoubleComplex* y,
+                                                 int64_t                 incy,
+                                                 hipblasStride           stridey,
+                                                 int64_t                 batchCount,
+                                                 hipDoubleComplex*       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// nrm2
+hipblasStatus_t hipblasSnrm2(hipblasHandle_t handle, int n, const float* x, int incx, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleNrm2(handle, n, x, incx, result, HIP_R_32F);
+    return hipblasConvertStatus(cublasSnrm2((cublasHandle_t)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasDnrm2(hipblasHandle_t handle, int n, const double* x, int incx, double* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleNrm2(handle, n, x, incx, result, HIP_R_64F);
+    return hipblasConvertStatus(cublasDnrm2((cublasHandle_t)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasScnrm2(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleNrm2(handle, n, x, incx, result, HIP_C_32F);
+    return hipblasConvertStatus(
+        cublasScnrm2((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDznrm2(
+    hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleNrm2(handle, n, x, incx, result, HIP_C_64F);
+    return hipblasConvertStatus(
+        cublasDznrm2((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasScnrm2_v2(hipblasHandle_t handle, int n, const hipComplex* x, int incx, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleNrm2(handle, n, x, incx, result, HIP_C_32F);
+    return hipblasConvertStatus(
+        cublasScnrm2((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDznrm2_v2(
+    hipblasHandle_t handle, int n, const hipDoubleComplex* x, int incx, double* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    if(hipblasIsReproducible(handle))
+        return hipblasReproducibleNrm2(handle, n, x, incx, result, HIP_C_64F);
+    return hipblasConvertStatus(
+        cublasDznrm2((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// nrm2_64
+hipblasStatus_t
+    hipblasSnrm2_64(hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasSnrm2_64((cublasHandle_t)handle, n, x, incx, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDnrm2_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasDnrm2_64((cublasHandle_t)handle, n, x, incx, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScnrm2_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasScnrm2_64((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDznrm2_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasDznrm2_64((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScnrm2_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipComplex* x, int64_t incx, float* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasScnrm2_64((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDznrm2_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipDoubleComplex* x, int64_t incx, double* result)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasDznrm2_64((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// nrm2_batched
+hipblasStatus_t hipblasSnrm2Batched(
+    hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, float* result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDnrm2Batched(hipblasHandle_t     handle,
+                                    int                 n,
+                                    const double* const x[],
+                                    int                 incx,
+                                    int                 batchCount,
+                                    double*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasScnrm2Batched(hipblasHandle_t             handle,
+                                     int                         n,
+                                     const hipblasComplex* const x[],
+                                     int                         incx,
+                                     int                         batchCount,
+                                     float*                      result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDznrm2Batched(hipblasHandle_t                   handle,
+                                     int                               n,
+                                     const hipblasDoubleComplex* const x[],
+                                     int                               incx,
+                                     int                               batchCount,
+                                     double*                           result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasScnrm2Batched_v2(hipblasHandle_t         handle,
+                                        int                     n,
+                                        const hipComplex* const x[],
+                                        int                     incx,
+                                        int                     batchCount,
+                                        float*                  result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDznrm2Batched_v2(hipblasHandle_t               handle,
+                                        int                           n,
+                                        const hipDoubleComplex* const x[],
+                                        int                           incx,
+                                        int                           batchCount,
+                                        double*                       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// nrm2_batched_64
+hipblasStatus_t hipblasSnrm2Batched_64(hipblasHandle_t    handle,
+                                       int64_t            n,
+                                       const float* const x[],
+                                       int64_t            incx,
+                                       int64_t            batchCount,
+                                       float*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDnrm2Batched_64(hipblasHandle_t     handle,
+                                       int64_t             n,
+                                       const double* const x[],
+                                       int64_t             incx,
+                                       int64_t             batchCount,
+                                       double*             result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasScnrm2Batched_64(hipblasHandle_t             handle,
+                                        int64_t                     n,
+                                        const hipblasComplex* const x[],
+                                        int64_t                     incx,
+                                        int64_t                     batchCount,
+                                        float*                      result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDznrm2Batched_64(hipblasHandle_t                   handle,
+                                        int64_t                           n,
+                                        const hipblasDoubleComplex* const x[],
+                                        int64_t                           incx,
+                                        int64_t                           batchCount,
+                                        double*                           result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasScnrm2Batched_v2_64(hipblasHandle_t         handle,
+                                           int64_t                 n,
+                                           const hipComplex* const x[],
+                                           int64_t                 incx,
+                                           int64_t                 batchCount,
+                                           float*                  result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDznrm2Batched_v2_64(hipblasHandle_t               handle,
+                                           int64_t                       n,
+                                           const hipDoubleComplex* const x[],
+                                           int64_t                       incx,
+                                           int64_t                       batchCount,
+                                           double*                       result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// nrm2_strided_batched
+hipblasStatus_t hipblasSnrm2StridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           const float*    x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           int             batchCount,
+                                           float*          result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDnrm2StridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           const double*   x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           int             batchCount,
+                                           double*         result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasScnrm2StridedBatched(hipblasHandle_t       handle,
+                                            int                   n,
+                                            const hipblasComplex* x,
+                                            int                   incx,
+                                            hipblasStride         stridex,
+                                            int                   batchCount,
+                                            float*                result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDznrm2StridedBatched(hipblasHandle_t             handle,
+                                            int                         n,
+                                            const hipblasDoubleComplex* x,
+                                            int                         incx,
+                                            hipblasStride               stridex,
+                                            int                         batchCount,
+                                            double*                     result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasScnrm2StridedBatched_v2(hipblasHandle_t   handle,
+                                               int               n,
+                                               const hipComplex* x,
+                                               int               incx,
+                                               hipblasStride     stridex,
+                                               int               batchCount,
+                                               float*            result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDznrm2StridedBatched_v2(hipblasHandle_t         handle,
+                                               int                     n,
+                                               const hipDoubleComplex* x,
+                                               int                     incx,
+                                               hipblasStride           stridex,
+                                               int                     batchCount,
+                                               double*                 result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// nrm2_strided_batched_64
+hipblasStatus_t hipblasSnrm2StridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const float*    x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              int64_t         batchCount,
+                                              float*          result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDnrm2StridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const double*   x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              int64_t         batchCount,
+                                              double*         result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasScnrm2StridedBatched_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasStride         stridex,
+                                               int64_t               batchCount,
+                                               float*                result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDznrm2StridedBatched_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               hipblasStride               stridex,
+                                               int64_t                     batchCount,
+                                               double*                     result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasScnrm2StridedBatched_v2_64(hipblasHandle_t   handle,
+                                                  int64_t           n,
+                                                  const hipComplex* x,
+                                                  int64_t           incx,
+                                                  hipblasStride     stridex,
+                                                  int64_t           batchCount,
+                                                  float*            result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDznrm2StridedBatched_v2_64(hipblasHandle_t         handle,
+                                                  int64_t                 n,
+                                                  const hipDoubleComplex* x,
+                                                  int64_t                 incx,
+                                                  hipblasStride           stridex,
+                                                  int64_t                 batchCount,
+                                                  double*                 result)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// rot
+hipblasStatus_t hipblasSrot(hipblasHandle_t handle,
+                            int             n,
+                            float*          x,
+                            int             incx,
+                            float*          y,
+                            int             incy,
+                            const float*    c,
+                            const float*    s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(cublasSrot((cublasHandle_t)handle, n, x, incx, y, incy, c, s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrot(hipblasHandle_t handle,
+                            int             n,
+                            double*         x,
+                            int             incx,
+                            double*         y,
+                            int             incy,
+                            const double*   c,
+                            const double*   s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(cublasDrot((cublasHandle_t)handle, n, x, incx, y, incy, c, s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrot(hipblasHandle_t       handle,
+                            int                   n,
+                            hipblasComplex*       x,
+                            int                   incx,
+                            hipblasComplex*       y,
+                            int                   incy,
+                            const float*          c,
+                            const hipblasComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(cublasCrot(
+        (cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, c, (cuComplex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsrot(hipblasHandle_t handle,
+                             int             n,
+                             hipblasComplex* x,
+                             int             incx,
+                             hipblasComplex* y,
+                             int             incy,
+                             const float*    c,
+                             const float*    s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(
+        cublasCsrot((cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, c, s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrot(hipblasHandle_t             handle,
+                            int                         n,
+                            hipblasDoubleComplex*       x,
+                            int                         incx,
+                            hipblasDoubleComplex*       y,
+                            int                         incy,
+                            const double*               c,
+                            const hipblasDoubleComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(cublasZrot((cublasHandle_t)handle,
+                                           n,
+                                           (cuDoubleComplex*)x,
+                                           incx,
+                                           (cuDoubleComplex*)y,
+                                           incy,
+                                           c,
+                                           (cuDoubleComplex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdrot(hipblasHandle_t       handle,
+                             int                   n,
+                             hipblasDoubleComplex* x,
+                             int                   incx,
+                             hipblasDoubleComplex* y,
+                             int                   incy,
+                             const double*         c,
+                             const double*         s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(cublasZdrot(
+        (cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, (cuDoubleComplex*)y, incy, c, s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrot_v2(hipblasHandle_t   handle,
+                               int               n,
+                               hipComplex*       x,
+                               int               incx,
+                               hipComplex*       y,
+                               int               incy,
+                               const float*      c,
+                               const hipComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(cublasCrot(
+        (cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, c, (cuComplex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsrot_v2(hipblasHandle_t handle,
+                                int             n,
+                                hipComplex*     x,
+                                int             incx,
+                                hipComplex*     y,
+                                int             incy,
+                                const float*    c,
+                                const float*    s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(
+        cublasCsrot((cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, c, s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrot_v2(hipblasHandle_t         handle,
+                               int                     n,
+                               hipDoubleComplex*       x,
+                               int                     incx,
+                               hipDoubleComplex*       y,
+                               int                     incy,
+                               const double*           c,
+                               const hipDoubleComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(cublasZrot((cublasHandle_t)handle,
+                                           n,
+                                           (cuDoubleComplex*)x,
+                                           incx,
+                                           (cuDoubleComplex*)y,
+                                           incy,
+                                           c,
+                                           (cuDoubleComplex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdrot_v2(hipblasHandle_t   handle,
+                                int               n,
+                                hipDoubleComplex* x,
+                                int               incx,
+                                hipDoubleComplex* y,
+                                int               incy,
+                                const double*     c,
+                                const double*     s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(cublasZdrot(
+        (cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, (cuDoubleComplex*)y, incy, c, s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rot_64
+hipblasStatus_t hipblasSrot_64(hipblasHandle_t handle,
+                               int64_t         n,
+                               float*          x,
+                               int64_t         incx,
+                               float*          y,
+                               int64_t         incy,
+                               const float*    c,
+                               const float*    s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasSrot_64((cublasHandle_t)handle, n, x, incx, y, incy, c, s));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrot_64(hipblasHandle_t handle,
+                               int64_t         n,
+                               double*         x,
+                               int64_t         incx,
+                               double*         y,
+                               int64_t         incy,
+                               const double*   c,
+                               const double*   s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasDrot_64((cublasHandle_t)handle, n, x, incx, y, incy, c, s));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrot_64(hipblasHandle_t       handle,
+                               int64_t               n,
+                               hipblasComplex*       x,
+                               int64_t               incx,
+                               hipblasComplex*       y,
+                               int64_t               incy,
+                               const float*          c,
+                               const hipblasComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasCrot_64(
+        (cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, c, (cuComplex*)s));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsrot_64(hipblasHandle_t handle,
+                                int64_t         n,
+                                hipblasComplex* x,
+                                int64_t         incx,
+                                hipblasComplex* y,
+                                int64_t         incy,
+                                const float*    c,
+                                const float*    s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasCsrot_64((cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, c, s));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrot_64(hipblasHandle_t             handle,
+                               int64_t                     n,
+                               hipblasDoubleComplex*       x,
+                               int64_t                     incx,
+                               hipblasDoubleComplex*       y,
+                               int64_t                     incy,
+                               const double*               c,
+                               const hipblasDoubleComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasZrot_64((cublasHandle_t)handle,
+                                              n,
+                                              (cuDoubleComplex*)x,
+                                              incx,
+                                              (cuDoubleComplex*)y,
+                                              incy,
+                                              c,
+                                              (cuDoubleComplex*)s));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdrot_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                hipblasDoubleComplex* x,
+                                int64_t               incx,
+                                hipblasDoubleComplex* y,
+                                int64_t               incy,
+                                const double*         c,
+                                const double*         s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasZdrot_64(
+        (cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, (cuDoubleComplex*)y, incy, c, s));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrot_v2_64(hipblasHandle_t   handle,
+                                  int64_t           n,
+                                  hipComplex*       x,
+                                  int64_t           incx,
+                                  hipComplex*       y,
+                                  int64_t           incy,
+                                  const float*      c,
+                                  const hipComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasCrot_64(
+        (cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, c, (cuComplex*)s));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsrot_v2_64(hipblasHandle_t handle,
+                                   int64_t         n,
+                                   hipComplex*     x,
+                                   int64_t         incx,
+                                   hipComplex*     y,
+                                   int64_t         incy,
+                                   const float*    c,
+                                   const float*    s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasCsrot_64((cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, c, s));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrot_v2_64(hipblasHandle_t         handle,
+                                  int64_t                 n,
+                                  hipDoubleComplex*       x,
+                                  int64_t                 incx,
+                                  hipDoubleComplex*       y,
+                                  int64_t                 incy,
+                                  const double*           c,
+                                  const hipDoubleComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasZrot_64((cublasHandle_t)handle,
+                                              n,
+                                              (cuDoubleComplex*)x,
+                                              incx,
+                                              (cuDoubleComplex*)y,
+                                              incy,
+                                              c,
+                                              (cuDoubleComplex*)s));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdrot_v2_64(hipblasHandle_t   handle,
+                                   int64_t           n,
+                                   hipDoubleComplex* x,
+                                   int64_t           incx,
+                                   hipDoubleComplex* y,
+                                   int64_t           incy,
+                                   const double*     c,
+                                   const double*     s)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasZdrot_64(
+        (cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, (cuDoubleComplex*)y, incy, c, s));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rot_batched
+hipblasStatus_t hipblasSrotBatched(hipblasHandle_t handle,
+                                   int             n,
+                                   float* const    x[],
+                                   int             incx,
+                                   float* const    y[],
+                                   int             incy,
+                                   const float*    c,
+                                   const float*    s,
+                                   int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasSrot((cublasHandle_t)handle,
+                                                   n,
+                                                   p(x, b),
+                                                   incx,
+                                                   p(y, b),
+                                                   incy,
+                                                   c,
+                                                   s));
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotBatched(hipblasHandle_t handle,
+                                   int             n,
+                                   double* const   x[],
+                                   int             incx,
+                                   double* const   y[],
+                                   int             incy,
+                                   const double*   c,
+                                   const double*   s,
+                                   int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasDrot((cublasHandle_t)handle,
+                                                   n,
+                                                   p(x, b),
+                                                   incx,
+                                                   p(y, b),
+                                                   incy,
+                                                   c,
+                                                   s));
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotBatched(hipblasHandle_t       handle,
+                                   int                   n,
+                                   hipblasComplex* const x[],
+                                   int                   incx,
+                                   hipblasComplex* const y[],
+                                   int                   incy,
+                                   const float*          c,
+                                   const hipblasComplex* s,
+                                   int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasCrot((cublasHandle_t)handle,
+                                                   n,
+                                                   (cuComplex*)p(x, b),
+                                                   incx,
+                                                   (cuComplex*)p(y, b),
+                                                   incy,
+                                                   c,
+                                                   (cuComplex*)s));
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsrotBatched(hipblasHandle_t       handle,
+                                    int                   n,
+                                    hipblasComplex* const x[],
+                                    int                   incx,
+                                    hipblasComplex* const y[],
+                                    int                   incy,
+                                    const float*          c,
+                                    const float*          s,
+                                    int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasCsrot((cublasHandle_t)handle,
+                                                    n,
+                                                    (cuComplex*)p(x, b),
+                                                    incx,
+                                                    (cuComplex*)p(y, b),
+                                                    incy,
+                                                    c,
+                                                    s));
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotBatched(hipblasHandle_t             handle,
+                                   int                         n,
+                                   hipblasDoubleComplex* const x[],
+                                   int                         incx,
+                                   hipblasDoubleComplex* const y[],
+                                   int                         incy,
+                                   const double*               c,
+                                   const hipblasDoubleComplex* s,
+                                   int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasZrot((cublasHandle_t)handle,
+                                                   n,
+                                                   (cuDoubleComplex*)p(x, b),
+                                                   incx,
+                                                   (cuDoubleComplex*)p(y, b),
+                                                   incy,
+                                                   c,
+                                                   (cuDoubleComplex*)s));
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdrotBatched(hipblasHandle_t             handle,
+                                    int                         n,
+                                    hipblasDoubleComplex* const x[],
+                                    int                         incx,
+                                    hipblasDoubleComplex* const y[],
+                                    int                         incy,
+                                    const double*               c,
+                                    const double*               s,
+                                    int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasZdrot((cublasHandle_t)handle,
+                                                    n,
+                                                    (cuDoubleComplex*)p(x, b),
+                                                    incx,
+                                                    (cuDoubleComplex*)p(y, b),
+                                                    incy,
+                                                    c,
+                                                    s));
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotBatched_v2(hipblasHandle_t   handle,
+                                      int               n,
+                                      hipComplex* const x[],
+                                      int               incx,
+                                      hipComplex* const y[],
+                                      int               incy,
+                                      const float*      c,
+                                      const hipComplex* s,
+                                      int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasCrot((cublasHandle_t)handle,
+                                                   n,
+                                                   (cuComplex*)p(x, b),
+                                                   incx,
+                                                   (cuComplex*)p(y, b),
+                                                   incy,
+                                                   c,
+                                                   (cuComplex*)s));
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsrotBatched_v2(hipblasHandle_t   handle,
+                                       int               n,
+                                       hipComplex* const x[],
+                                       int               incx,
+                                       hipComplex* const y[],
+                                       int               incy,
+                                       const float*      c,
+                                       const float*      s,
+                                       int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasCsrot((cublasHandle_t)handle,
+                                                    n,
+                                                    (cuComplex*)p(x, b),
+                                                    incx,
+                                                    (cuComplex*)p(y, b),
+                                                    incy,
+                                                    c,
+                                                    s));
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotBatched_v2(hipblasHandle_t         handle,
+                                      int                     n,
+                                      hipDoubleComplex* const x[],
+                                      int                     incx,
+                                      hipDoubleComplex* const y[],
+                                      int                     incy,
+                                      const double*           c,
+                                      const hipDoubleComplex* s,
+                                      int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasZrot((cublasHandle_t)handle,
+                                                   n,
+                                                   (cuDoubleComplex*)p(x, b),
+                                                   incx,
+                                                   (cuDoubleComplex*)p(y, b),
+                                                   incy,
+                                                   c,
+                                                   (cuDoubleComplex*)s));
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdrotBatched_v2(hipblasHandle_t         handle,
+                                       int                     n,
+                                       hipDoubleComplex* const x[],
+                                       int                     incx,
+                                       hipDoubleComplex* const y[],
+                                       int                     incy,
+                                       const double*           c,
+                                       const double*           s,
+                                       int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasZdrot((cublasHandle_t)handle,
+                                                    n,
+                                                    (cuDoubleComplex*)p(x, b),
+                                                    incx,
+                                                    (cuDoubleComplex*)p(y, b),
+                                                    incy,
+                                                    c,
+                                                    s));
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rot_batched_64
+hipblasStatus_t hipblasSrotBatched_64(hipblasHandle_t handle,
+                                      int64_t         n,
+                                      float* const    x[],
+                                      int64_t         incx,
+                                      float* const    y[],
+                                      int64_t         incy,
+                                      const float*    c,
+                                      const float*    s,
+                                      int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasSrot_64((cublasHandle_t)handle,
+                                                      n,
+                                                      p(x, b),
+                                                      incx,
+                                                      p(y, b),
+                                                      incy,
+                                                      c,
+                                                      s));
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotBatched_64(hipblasHandle_t handle,
+                                      int64_t         n,
+                                      double* const   x[],
+                                      int64_t         incx,
+                                      double* const   y[],
+                                      int64_t         incy,
+                                      const double*   c,
+                                      const double*   s,
+                                      int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasDrot_64((cublasHandle_t)handle,
+                                                      n,
+                                                      p(x, b),
+                                                      incx,
+                                                      p(y, b),
+                                                      incy,
+                                                      c,
+                                                      s));
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotBatched_64(hipblasHandle_t       handle,
+                                      int64_t               n,
+                                      hipblasComplex* const x[],
+                                      int64_t               incx,
+                                      hipblasComplex* const y[],
+                                      int64_t               incy,
+                                      const float*          c,
+                                      const hipblasComplex* s,
+                                      int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasCrot_64((cublasHandle_t)handle,
+                                                      n,
+                                                      (cuComplex*)p(x, b),
+                                                      incx,
+                                                      (cuComplex*)p(y, b),
+                                                      incy,
+                                                      c,
+                                                      (cuComplex*)s));
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsrotBatched_64(hipblasHandle_t       handle,
+                                       int64_t               n,
+                                       hipblasComplex* const x[],
+                                       int64_t               incx,
+                                       hipblasComplex* const y[],
+                                       int64_t               incy,
+                                       const float*          c,
+                                       const float*          s,
+                                       int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasCsrot_64((cublasHandle_t)handle,
+                                                       n,
+                                                       (cuComplex*)p(x, b),
+                                                       incx,
+                                                       (cuComplex*)p(y, b),
+                                                       incy,
+                                                       c,
+                                                       s));
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotBatched_64(hipblasHandle_t             handle,
+                                      int64_t                     n,
+                                      hipblasDoubleComplex* const x[],
+                                      int64_t                     incx,
+                                      hipblasDoubleComplex* const y[],
+                                      int64_t                     incy,
+                                      const double*               c,
+                                      const hipblasDoubleComplex* s,
+                                      int64_t                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasZrot_64((cublasHandle_t)handle,
+                                                      n,
+                                                      (cuDoubleComplex*)p(x, b),
+                                                      incx,
+                                                      (cuDoubleComplex*)p(y, b),
+                                                      incy,
+                                                      c,
+                                                      (cuDoubleComplex*)s));
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdrotBatched_64(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       hipblasDoubleComplex* const x[],
+                                       int64_t                     incx,
+                                       hipblasDoubleComplex* const y[],
+                                       int64_t                     incy,
+                                       const double*               c,
+                                       const double*               s,
+                                       int64_t                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasZdrot_64((cublasHandle_t)handle,
+                                                       n,
+                                                       (cuDoubleComplex*)p(x, b),
+                                                       incx,
+                                                       (cuDoubleComplex*)p(y, b),
+                                                       incy,
+                                                       c,
+                                                       s));
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotBatched_v2_64(hipblasHandle_t   handle,
+                                         int64_t           n,
+                                         hipComplex* const x[],
+                                         int64_t           incx,
+                                         hipComplex* const y[],
+                                         int64_t           incy,
+                                         const float*      c,
+                                         const hipComplex* s,
+                                         int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasCrot_64((cublasHandle_t)handle,
+                                                      n,
+                                                      (cuComplex*)p(x, b),
+                                                      incx,
+                                                      (cuComplex*)p(y, b),
+                                                      incy,
+                                                      c,
+                                                      (cuComplex*)s));
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsrotBatched_v2_64(hipblasHandle_t   handle,
+                                          int64_t           n,
+                                          hipComplex* const x[],
+                                          int64_t           incx,
+                                          hipComplex* const y[],
+                                          int64_t           incy,
+                                          const float*      c,
+                                          const float*      s,
+                                          int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasCsrot_64((cublasHandle_t)handle,
+                                                       n,
+                                                       (cuComplex*)p(x, b),
+                                                       incx,
+                                                       (cuComplex*)p(y, b),
+                                                       incy,
+                                                       c,
+                                                       s));
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotBatched_v2_64(hipblasHandle_t         handle,
+                                         int64_t                 n,
+                                         hipDoubleComplex* const x[],
+                                         int64_t                 incx,
+                                         hipDoubleComplex* const y[],
+                                         int64_t                 incy,
+                                         const double*           c,
+                                         const hipDoubleComplex* s,
+                                         int64_t                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasZrot_64((cublasHandle_t)handle,
+                                                      n,
+                                                      (cuDoubleComplex*)p(x, b),
+                                                      incx,
+                                                      (cuDoubleComplex*)p(y, b),
+                                                      incy,
+                                                      c,
+                                                      (cuDoubleComplex*)s));
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdrotBatched_v2_64(hipblasHandle_t         handle,
+                                          int64_t                 n,
+                                          hipDoubleComplex* const x[],
+                                          int64_t                 incx,
+                                          hipDoubleComplex* const y[],
+                                          int64_t                 incy,
+                                          const double*           c,
+                                          const double*           s,
+                                          int64_t                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasZdrot_64((cublasHandle_t)handle,
+                                                       n,
+                                                       (cuDoubleComplex*)p(x, b),
+                                                       incx,
+                                                       (cuDoubleComplex*)p(y, b),
+                                                       incy,
+                                                       c,
+                                                       s));
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rot_strided_batched
+hipblasStatus_t hipblasSrotStridedBatched(hipblasHandle_t handle,
+                                          int             n,
+                                          float*          x,
+                                          int             incx,
+                                          hipblasStride   stridex,
+                                          float*          y,
+                                          int             incy,
+                                          hipblasStride   stridey,
+                                          const float*    c,
+                                          const float*    s,
+                                          int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasSrot((cublasHandle_t)handle,
+                                               n,
+                                               (x + b * stridex),
+                                               incx,
+                                               (y + b * stridey),
+                                               incy,
+                                               c,
+                                               s));
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotStridedBatched(hipblasHandle_t handle,
+                                          int             n,
+                                          double*         x,
+                                          int             incx,
+                                          hipblasStride   stridex,
+                                          double*         y,
+                                          int             incy,
+                                          hipblasStride   stridey,
+                                          const double*   c,
+                                          const double*   s,
+                                          int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasDrot((cublasHandle_t)handle,
+                                               n,
+                                               (x + b * stridex),
+                                               incx,
+                                               (y + b * stridey),
+                                               incy,
+                                               c,
+                                               s));
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotStridedBatched(hipblasHandle_t       handle,
+                                          int                   n,
+                                          hipblasComplex*       x,
+                                          int                   incx,
+                                          hipblasStride         stridex,
+                                          hipblasComplex*       y,
+                                          int                   incy,
+                                          hipblasStride         stridey,
+                                          const float*          c,
+                                          const hipblasComplex* s,
+                                          int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasCrot((cublasHandle_t)handle,
+                                               n,
+                                               (cuComplex*)(x + b * stridex),
+                                               incx,
+                                               (cuComplex*)(y + b * stridey),
+                                               incy,
+                                               c,
+                                               (cuComplex*)s));
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsrotStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           hipblasComplex* x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           hipblasComplex* y,
+                                           int             incy,
+                                           hipblasStride   stridey,
+                                           const float*    c,
+                                           const float*    s,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasCsrot((cublasHandle_t)handle,
+                                                n,
+                                                (cuComplex*)(x + b * stridex),
+                                                incx,
+                                                (cuComplex*)(y + b * stridey),
+                                                incy,
+                                                c,
+                                                s));
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotStridedBatched(hipblasHandle_t             handle,
+                                          int                         n,
+                                          hipblasDoubleComplex*       x,
+                                          int                         incx,
+                                          hipblasStride               stridex,
+                                          hipblasDoubleComplex*       y,
+                                          int                         incy,
+                                          hipblasStride               stridey,
+                                          const double*               c,
+                                          const hipblasDoubleComplex* s,
+                                          int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasZrot((cublasHandle_t)handle,
+                                               n,
+                                               (cuDoubleComplex*)(x + b * stridex),
+                                               incx,
+                                               (cuDoubleComplex*)(y + b * stridey),
+                                               incy,
+                                               c,
+                                               (cuDoubleComplex*)s));
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdrotStridedBatched(hipblasHandle_t       handle,
+                                           int                   n,
+                                           hipblasDoubleComplex* x,
+                                           int                   incx,
+                                           hipblasStride         stridex,
+                                           hipblasDoubleComplex* y,
+                                           int                   incy,
+                                           hipblasStride         stridey,
+                                           const double*         c,
+                                           const double*         s,
+                                           int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasZdrot((cublasHandle_t)handle,
+                                                n,
+                                                (cuDoubleComplex*)(x + b * stridex),
+                                                incx,
+                                                (cuDoubleComplex*)(y + b * stridey),
+                                                incy,
+                                                c,
+                                                s));
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotStridedBatched_v2(hipblasHandle_t   handle,
+                                             int               n,
+                                             hipComplex*       x,
+                                             int               incx,
+                                             hipblasStride     stridex,
+                                             hipComplex*       y,
+                                             int               incy,
+                                             hipblasStride     stridey,
+                                             const float*      c,
+                                             const hipComplex* s,
+                                             int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasCrot((cublasHandle_t)handle,
+                                               n,
+                                               (cuComplex*)(x + b * stridex),
+                                               incx,
+                                               (cuComplex*)(y + b * stridey),
+                                               incy,
+                                               c,
+                                               (cuComplex*)s));
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsrotStridedBatched_v2(hipblasHandle_t handle,
+                                              int             n,
+                                              hipComplex*     x,
+                                              int             incx,
+                                              hipblasStride   stridex,
+                                              hipComplex*     y,
+                                              int             incy,
+                                              hipblasStride   stridey,
+                                              const float*    c,
+                                              const float*    s,
+                                              int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasCsrot((cublasHandle_t)handle,
+                                                n,
+                                                (cuComplex*)(x + b * stridex),
+                                                incx,
+                                                (cuComplex*)(y + b * stridey),
+                                                incy,
+                                                c,
+                                                s));
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotStridedBatched_v2(hipblasHandle_t         handle,
+                                             int                     n,
+                                             hipDoubleComplex*       x,
+                                             int                     incx,
+                                             hipblasStride           stridex,
+                                             hipDoubleComplex*       y,
+                                             int                     incy,
+                                             hipblasStride           stridey,
+                                             const double*           c,
+                                             const hipDoubleComplex* s,
+                                             int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasZrot((cublasHandle_t)handle,
+                                               n,
+                                               (cuDoubleComplex*)(x + b * stridex),
+                                               incx,
+                                               (cuDoubleComplex*)(y + b * stridey),
+                                               incy,
+                                               c,
+                                               (cuDoubleComplex*)s));
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdrotStridedBatched_v2(hipblasHandle_t   handle,
+                                              int               n,
+                                              hipDoubleComplex* x,
+                                              int               incx,
+                                              hipblasStride     stridex,
+                                              hipDoubleComplex* y,
+                                              int               incy,
+                                              hipblasStride     stridey,
+                                              const double*     c,
+                                              const double*     s,
+                                              int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasZdrot((cublasHandle_t)handle,
+                                                n,
+                                                (cuDoubleComplex*)(x + b * stridex),
+                                                incx,
+                                                (cuDoubleComplex*)(y + b * stridey),
+                                                incy,
+                                                c,
+                                                s));
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rot_strided_batched_64
+hipblasStatus_t hipblasSrotStridedBatched_64(hipblasHandle_t handle,
+                                             int64_t         n,
+                                             float*          x,
+                                             int64_t         incx,
+                                             hipblasStride   stridex,
+                                             float*          y,
+                                             int64_t         incy,
+                                             hipblasStride   stridey,
+                                             const float*    c,
+                                             const float*    s,
+                                             int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasSrot_64((cublasHandle_t)handle,
+                                                  n,
+                                                  (x + b * stridex),
+                                                  incx,
+                                                  (y + b * stridey),
+                                                  incy,
+                                                  c,
+                                                  s));
+    });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotStridedBatched_64(hipblasHandle_t handle,
+                                             int64_t         n,
+                                             double*         x,
+                                             int64_t         incx,
+                                             hipblasStride   stridex,
+                                             double*         y,
+                                             int64_t         incy,
+                                             hipblasStride   stridey,
+                                             const double*   c,
+                                             const double*   s,
+                                             int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasDrot_64((cublasHandle_t)handle,
+                                                  n,
+                                                  (x + b * stridex),
+                                                  incx,
+                                                  (y + b * stridey),
+                                                  incy,
+                                                  c,
+                                                  s));
+    });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotStridedBatched_64(hipblasHandle_t       handle,
+                                             int64_t               n,
+                                             hipblasComplex*       x,
+                                             int64_t               incx,
+                                             hipblasStride         stridex,
+                                             hipblasComplex*       y,
+                                             int64_t               incy,
+                                             hipblasStride         stridey,
+                                             const float*          c,
+                                             const hipblasComplex* s,
+                                             int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasCrot_64((cublasHandle_t)handle,
+                                                  n,
+                                                  (cuComplex*)(x + b * stridex),
+                                                  incx,
+                                                  (cuComplex*)(y + b * stridey),
+                                                  incy,
+                                                  c,
+                                                  (cuComplex*)s));
+    });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsrotStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              hipblasComplex* x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              hipblasComplex* y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              const float*    c,
+                                              const float*    s,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasCsrot_64((cublasHandle_t)handle,
+                                                   n,
+                                                   (cuComplex*)(x + b * stridex),
+                                                   incx,
+                                                   (cuComplex*)(y + b * stridey),
+                                                   incy,
+                                                   c,
+                                                   s));
+    });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotStridedBatched_64(hipblasHandle_t             handle,
+                                             int64_t                     n,
+                                             hipblasDoubleComplex*       x,
+                                             int64_t                     incx,
+                                             hipblasStride               stridex,
+                                             hipblasDoubleComplex*       y,
+                                             int64_t                     incy,
+                                             hipblasStride               stridey,
+                                             const double*               c,
+                                             const hipblasDoubleComplex* s,
+                                             int64_t                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasZrot_64((cublasHandle_t)handle,
+                                                  n,
+                                                  (cuDoubleComplex*)(x + b * stridex),
+                                                  incx,
+                                                  (cuDoubleComplex*)(y + b * stridey),
+                                                  incy,
+                                                  c,
+                                                  (cuDoubleComplex*)s));
+    });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdrotStridedBatched_64(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              hipblasDoubleComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              hipblasDoubleComplex* y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              const double*         c,
+                                              const double*         s,
+                                              int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasZdrot_64((cublasHandle_t)handle,
+                                                   n,
+                                                   (cuDoubleComplex*)(x + b * stridex),
+                                                   incx,
+                                                   (cuDoubleComplex*)(y + b * stridey),
+                                                   incy,
+                                                   c,
+                                                   s));
+    });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                int64_t           n,
+                                                hipComplex*       x,
+                                                int64_t           incx,
+                                                hipblasStride     stridex,
+                                                hipComplex*       y,
+                                                int64_t           incy,
+                                                hipblasStride     stridey,
+                                                const float*      c,
+                                                const hipComplex* s,
+                                                int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasCrot_64((cublasHandle_t)handle,
+                                                  n,
+                                                  (cuComplex*)(x + b * stridex),
+                                                  incx,
+                                                  (cuComplex*)(y + b * stridey),
+                                                  incy,
+                                                  c,
+                                                  (cuComplex*)s));
+    });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsrotStridedBatched_v2_64(hipblasHandle_t handle,
+                                                 int64_t         n,
+                                                 hipComplex*     x,
+                                                 int64_t         incx,
+                                                 hipblasStride   stridex,
+                                                 hipComplex*     y,
+                                                 int64_t         incy,
+                                                 hipblasStride   stridey,
+                                                 const float*    c,
+                                                 const float*    s,
+                                                 int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasCsrot_64((cublasHandle_t)handle,
+                                                   n,
+                                                   (cuComplex*)(x + b * stridex),
+                                                   incx,
+                                                   (cuComplex*)(y + b * stridey),
+                                                   incy,
+                                                   c,
+                                                   s));
+    });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                int64_t                 n,
+                                                hipDoubleComplex*       x,
+                                                int64_t                 incx,
+                                                hipblasStride           stridex,
+                                                hipDoubleComplex*       y,
+                                                int64_t                 incy,
+                                                hipblasStride           stridey,
+                                                const double*           c,
+                                                const hipDoubleComplex* s,
+                                                int64_t                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasZrot_64((cublasHandle_t)handle,
+                                                  n,
+                                                  (cuDoubleComplex*)(x + b * stridex),
+                                                  incx,
+                                                  (cuDoubleComplex*)(y + b * stridey),
+                                                  incy,
+                                                  c,
+                                                  (cuDoubleComplex*)s));
+    });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdrotStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                 int64_t           n,
+                                                 hipDoubleComplex* x,
+                                                 int64_t           incx,
+                                                 hipblasStride     stridex,
+                                                 hipDoubleComplex* y,
+                                                 int64_t           incy,
+                                                 hipblasStride     stridey,
+                                                 const double*     c,
+                                                 const double*     s,
+                                                 int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasZdrot_64((cublasHandle_t)handle,
+                                                   n,
+                                                   (cuDoubleComplex*)(x + b * stridex),
+                                                   incx,
+                                                   (cuDoubleComplex*)(y + b * stridey),
+                                                   incy,
+                                                   c,
+                                                   s));
+    });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotg
+hipblasStatus_t hipblasSrotg(hipblasHandle_t handle, float* a, float* b, float* c, float* s)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(cublasSrotg((cublasHandle_t)handle, a, b, c, s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotg(hipblasHandle_t handle, double* a, double* b, double* c, double* s)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(cublasDrotg((cublasHandle_t)handle, a, b, c, s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotg(
+    hipblasHandle_t handle, hipblasComplex* a, hipblasComplex* b, float* c, hipblasComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(
+        cublasCrotg((cublasHandle_t)handle, (cuComplex*)a, (cuComplex*)b, c, (cuComplex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotg(hipblasHandle_t       handle,
+                             hipblasDoubleComplex* a,
+                             hipblasDoubleComplex* b,
+                             double*               c,
+                             hipblasDoubleComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(cublasZrotg(
+        (cublasHandle_t)handle, (cuDoubleComplex*)a, (cuDoubleComplex*)b, c, (cuDoubleComplex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasCrotg_v2(hipblasHandle_t handle, hipComplex* a, hipComplex* b, float* c, hipComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(
+        cublasCrotg((cublasHandle_t)handle, (cuComplex*)a, (cuComplex*)b, c, (cuComplex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotg_v2(hipblasHandle_t   handle,
+                                hipDoubleComplex* a,
+                                hipDoubleComplex* b,
+                                double*           c,
+                                hipDoubleComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(cublasZrotg(
+        (cublasHandle_t)handle, (cuDoubleComplex*)a, (cuDoubleComplex*)b, c, (cuDoubleComplex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotg
+hipblasStatus_t hipblasSrotg_64(hipblasHandle_t handle, float* a, float* b, float* c, float* s)
+try
+{
+    HIPBLAS_ENTRY(handle);
+
+    // _64 interface is same as regular interface
+    return hipblasConvertStatus(cublasSrotg((cublasHandle_t)handle, a, b, c, s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotg_64(hipblasHandle_t handle, double* a, double* b, double* c, double* s)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(cublasDrotg((cublasHandle_t)handle, a, b, c, s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotg_64(
+    hipblasHandle_t handle, hipblasComplex* a, hipblasComplex* b, float* c, hipblasComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(
+        cublasCrotg((cublasHandle_t)handle, (cuComplex*)a, (cuComplex*)b, c, (cuComplex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotg_64(hipblasHandle_t       handle,
+                                hipblasDoubleComplex* a,
+                                hipblasDoubleComplex* b,
+                                double*               c,
+                                hipblasDoubleComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(cublasZrotg(
+        (cublasHandle_t)handle, (cuDoubleComplex*)a, (cuDoubleComplex*)b, c, (cuDoubleComplex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCrotg_v2_64(
+    hipblasHandle_t handle, hipComplex* a, hipComplex* b, float* c, hipComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(
+        cublasCrotg((cublasHandle_t)handle, (cuComplex*)a, (cuComplex*)b, c, (cuComplex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZrotg_v2_64(hipblasHandle_t   handle,
+                                   hipDoubleComplex* a,
+                                   hipDoubleComplex* b,
+                                   double*           c,
+                                   hipDoubleComplex* s)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(cublasZrotg(
+        (cublasHandle_t)handle, (cuDoubleComplex*)a, (cuDoubleComplex*)b, c, (cuDoubleComplex*)s));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotg_batchced
+hipblasStatus_t hipblasSrotgBatched(hipblasHandle_t handle,
+                                    float* const    a[],
+                                    float* const    b[],
+                                    float* const    c[],
+                                    float* const    s[],
+                                    int             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDrotgBatched(hipblasHandle_t handle,
+                                    double* const   a[],
+                                    double* const   b[],
+                                    double* const   c[],
+                                    double* const   s[],
+                                    int             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCrotgBatched(hipblasHandle_t       handle,
+                                    hipblasComplex* const a[],
+                                    hipblasComplex* const b[],
+                                    float* const          c[],
+                                    hipblasComplex* const s[],
+                                    int                   batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZrotgBatched(hipblasHandle_t             handle,
+                                    hipblasDoubleComplex* const a[],
+                                    hipblasDoubleComplex* const b[],
+                                    double* const               c[],
+                                    hipblasDoubleComplex* const s[],
+                                    int                         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCrotgBatched_v2(hipblasHandle_t   handle,
+                                       hipComplex* const a[],
+                                       hipComplex* const b[],
+                                       float* const      c[],
+                                       hipComplex* const s[],
+                                       int               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZrotgBatched_v2(hipblasHandle_t         handle,
+                                       hipDoubleComplex* const a[],
+                                       hipDoubleComplex* const b[],
+                                       double* const           c[],
+                                       hipDoubleComplex* const s[],
+                                       int                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// rotg_batchced_64
+hipblasStatus_t hipblasSrotgBatched_64(hipblasHandle_t handle,
+                                       float* const    a[],
+                                       float* const    b[],
+                                       float* const    c[],
+                                       float* const    s[],
+                                       int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDrotgBatched_64(hipblasHandle_t handle,
+                                       double* const   a[],
+                                       double* const   b[],
+                                       double* const   c[],
+                                       double* const   s[],
+                                       int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCrotgBatched_64(hipblasHandle_t       handle,
+                                       hipblasComplex* const a[],
+                                       hipblasComplex* const b[],
+                                       float* const          c[],
+                                       hipblasComplex* const s[],
+                                       int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZrotgBatched_64(hipblasHandle_t             handle,
+                                       hipblasDoubleComplex* const a[],
+                                       hipblasDoubleComplex* const b[],
+                                       double* const               c[],
+                                       hipblasDoubleComplex* const s[],
+                                       int64_t                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCrotgBatched_v2_64(hipblasHandle_t   handle,
+                                          hipComplex* const a[],
+                                          hipComplex* const b[],
+                                          float* const      c[],
+                                          hipComplex* const s[],
+                                          int64_t           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZrotgBatched_v2_64(hipblasHandle_t         handle,
+                                          hipDoubleComplex* const a[],
+                                          hipDoubleComplex* const b[],
+                                          double* const           c[],
+                                          hipDoubleComplex* const s[],
+                                          int64_t                 batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// rotg_strided_batched
+hipblasStatus_t hipblasSrotgStridedBatched(hipblasHandle_t handle,
+                                           float*          a,
+                                           hipblasStride   stride_a,
+                                           float*          b,
+                                           hipblasStride   stride_b,
+                                           float*          c,
+                                           hipblasStride   stride_c,
+                                           float*          s,
+                                           hipblasStride   stride_s,
+                                           int             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDrotgStridedBatched(hipblasHandle_t handle,
+                                           double*         a,
+                                           hipblasStride   stride_a,
+                                           double*         b,
+                                           hipblasStride   stride_b,
+                                           double*         c,
+                                           hipblasStride   stride_c,
+                                           double*         s,
+                                           hipblasStride   stride_s,
+                                           int             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCrotgStridedBatched(hipblasHandle_t handle,
+                                           hipblasComplex* a,
+                                           hipblasStride   stride_a,
+                                           hipblasComplex* b,
+                                           hipblasStride   stride_b,
+                                           float*          c,
+                                           hipblasStride   stride_c,
+                                           hipblasComplex* s,
+                                           hipblasStride   stride_s,
+                                           int             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZrotgStridedBatched(hipblasHandle_t       handle,
+                                           hipblasDoubleComplex* a,
+                                           hipblasStride         stride_a,
+                                           hipblasDoubleComplex* b,
+                                           hipblasStride         stride_b,
+                                           double*               c,
+                                           hipblasStride         stride_c,
+                                           hipblasDoubleComplex* s,
+                                           hipblasStride         stride_s,
+                                           int                   batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCrotgStridedBatched_v2(hipblasHandle_t handle,
+                                              hipComplex*     a,
+                                              hipblasStride   stride_a,
+                                              hipComplex*     b,
+                                              hipblasStride   stride_b,
+                                              float*          c,
+                                              hipblasStride   stride_c,
+                                              hipComplex*     s,
+                                              hipblasStride   stride_s,
+                                              int             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZrotgStridedBatched_v2(hipblasHandle_t   handle,
+                                              hipDoubleComplex* a,
+                                              hipblasStride     stride_a,
+                                              hipDoubleComplex* b,
+                                              hipblasStride     stride_b,
+                                              double*           c,
+                                              hipblasStride     stride_c,
+                                              hipDoubleComplex* s,
+                                              hipblasStride     stride_s,
+                                              int               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// rotg_strided_batched_64
+hipblasStatus_t hipblasSrotgStridedBatched_64(hipblasHandle_t handle,
+                                              float*          a,
+                                              hipblasStride   stride_a,
+                                              float*          b,
+                                              hipblasStride   stride_b,
+                                              float*          c,
+                                              hipblasStride   stride_c,
+                                              float*          s,
+                                              hipblasStride   stride_s,
+                                              int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDrotgStridedBatched_64(hipblasHandle_t handle,
+                                              double*         a,
+                                              hipblasStride   stride_a,
+                                              double*         b,
+                                              hipblasStride   stride_b,
+                                              double*         c,
+                                              hipblasStride   stride_c,
+                                              double*         s,
+                                              hipblasStride   stride_s,
+                                              int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCrotgStridedBatched_64(hipblasHandle_t handle,
+                                              hipblasComplex* a,
+                                              hipblasStride   stride_a,
+                                              hipblasComplex* b,
+                                              hipblasStride   stride_b,
+                                              float*          c,
+                                              hipblasStride   stride_c,
+                                              hipblasComplex* s,
+                                              hipblasStride   stride_s,
+                                              int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZrotgStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasDoubleComplex* a,
+                                              hipblasStride         stride_a,
+                                              hipblasDoubleComplex* b,
+                                              hipblasStride         stride_b,
+                                              double*               c,
+                                              hipblasStride         stride_c,
+                                              hipblasDoubleComplex* s,
+                                              hipblasStride         stride_s,
+                                              int64_t               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCrotgStridedBatched_v2_64(hipblasHandle_t handle,
+                                                 hipComplex*     a,
+                                                 hipblasStride   stride_a,
+                                                 hipComplex*     b,
+                                                 hipblasStride   stride_b,
+                                                 float*          c,
+                                                 hipblasStride   stride_c,
+                                                 hipComplex*     s,
+                                                 hipblasStride   stride_s,
+                                                 int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZrotgStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                 hipDoubleComplex* a,
+                                                 hipblasStride     stride_a,
+                                                 hipDoubleComplex* b,
+                                                 hipblasStride     stride_b,
+                                                 double*           c,
+                                                 hipblasStride     stride_c,
+                                                 hipDoubleComplex* s,
+                                                 hipblasStride     stride_s,
+                                                 int64_t           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// rotm
+hipblasStatus_t hipblasSrotm(
+    hipblasHandle_t handle, int n, float* x, int incx, float* y, int incy, const float* param)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(cublasSrotm((cublasHandle_t)handle, n, x, incx, y, incy, param));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotm(
+    hipblasHandle_t handle, int n, double* x, int incx, double* y, int incy, const double* param)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(cublasDrotm((cublasHandle_t)handle, n, x, incx, y, incy, param));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotm_64
+hipblasStatus_t hipblasSrotm_64(hipblasHandle_t handle,
+                                int64_t         n,
+                                float*          x,
+                                int64_t         incx,
+                                float*          y,
+                                int64_t         incy,
+                                const float*    param)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasSrotm_64((cublasHandle_t)handle, n, x, incx, y, incy, param));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotm_64(hipblasHandle_t handle,
+                                int64_t         n,
+                                double*         x,
+                                int64_t         incx,
+                                double*         y,
+                                int64_t         incy,
+                                const double*   param)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasDrotm_64((cublasHandle_t)handle, n, x, incx, y, incy, param));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotm_batched
+hipblasStatus_t hipblasSrotmBatched(hipblasHandle_t    handle,
+                                    int                n,
+                                    float* const       x[],
+                                    int                incx,
+                                    float* const       y[],
+                                    int                incy,
+                                    const float* const param[],
+                                    int                batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y, param}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasSrotm((cublasHandle_t)handle,
+                                                    n,
+                                                    p(x, b),
+                                                    incx,
+                                                    p(y, b),
+                                                    incy,
+                                                    p(param, b)));
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotmBatched(hipblasHandle_t     handle,
+                                    int                 n,
+                                    double* const       x[],
+                                    int                 incx,
+                                    double* const       y[],
+                                    int                 incy,
+                                    const double* const param[],
+                                    int                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y, param}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasDrotm((cublasHandle_t)handle,
+                                                    n,
+                                                    p(x, b),
+                                                    incx,
+                                                    p(y, b),
+                                                    incy,
+                                                    p(param, b)));
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotm_batched_64
+hipblasStatus_t hipblasSrotmBatched_64(hipblasHandle_t    handle,
+                                       int64_t            n,
+                                       float* const       x[],
+                                       int64_t            incx,
+                                       float* const       y[],
+                                       int64_t            incy,
+                                       const float* const param[],
+                                       int64_t            batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y, param}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasSrotm_64((cublasHandle_t)handle,
+                                                       n,
+                                                       p(x, b),
+                                                       incx,
+                                                       p(y, b),
+                                                       incy,
+                                                       p(param, b)));
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotmBatched_64(hipblasHandle_t     handle,
+                                       int64_t             n,
+                                       double* const       x[],
+                                       int64_t             incx,
+                                       double* const       y[],
+                                       int64_t             incy,
+                                       const double* const param[],
+                                       int64_t             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y, param}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasDrotm_64((cublasHandle_t)handle,
+                                                       n,
+                                                       p(x, b),
+                                                       incx,
+                                                       p(y, b),
+                                                       incy,
+                                                       p(param, b)));
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotm_strided_batched
+hipblasStatus_t hipblasSrotmStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           float*          x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           float*          y,
+                                           int             incy,
+                                           hipblasStride   stridey,
+                                           const float*    param,
+                                           hipblasStride   strideParam,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, strideParam, batchCount);
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasSrotm((cublasHandle_t)handle,
+                                                n,
+                                                (x + b * stridex),
+                                                incx,
+                                                (y + b * stridey),
+                                                incy,
+                                                (param + b * strideParam)));
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotmStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           double*         x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           double*         y,
+                                           int             incy,
+                                           hipblasStride   stridey,
+                                           const double*   param,
+                                           hipblasStride   strideParam,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, strideParam, batchCount);
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasDrotm((cublasHandle_t)handle,
+                                                n,
+                                                (x + b * stridex),
+                                                incx,
+                                                (y + b * stridey),
+                                                incy,
+                                                (param + b * strideParam)));
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotm_strided_batched_64
+hipblasStatus_t hipblasSrotmStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              float*          x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              float*          y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              const float*    param,
+                                              hipblasStride   strideParam,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, strideParam, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasSrotm_64((cublasHandle_t)handle,
+                                                   n,
+                                                   (x + b * stridex),
+                                                   incx,
+                                                   (y + b * stridey),
+                                                   incy,
+                                                   (param + b * strideParam)));
+    });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotmStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              double*         x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              double*         y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              const double*   param,
+                                              hipblasStride   strideParam,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, strideParam, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasDrotm_64((cublasHandle_t)handle,
+                                                   n,
+                                                   (x + b * stridex),
+                                                   incx,
+                                                   (y + b * stridey),
+                                                   incy,
+                                                   (param + b * strideParam)));
+    });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotmg
+hipblasStatus_t hipblasSrotmg(
+    hipblasHandle_t handle, float* d1, float* d2, float* x1, const float* y1, float* param)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(cublasSrotmg((cublasHandle_t)handle, d1, d2, x1, y1, param));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotmg(
+    hipblasHandle_t handle, double* d1, double* d2, double* x1, const double* y1, double* param)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(cublasDrotmg((cublasHandle_t)handle, d1, d2, x1, y1, param));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotmg_64
+hipblasStatus_t hipblasSrotmg_64(
+    hipblasHandle_t handle, float* d1, float* d2, float* x1, const float* y1, float* param)
+try
+{
+    HIPBLAS_ENTRY(handle);
+
+    // _64 interface is same as regular interface
+    return hipblasConvertStatus(cublasSrotmg((cublasHandle_t)handle, d1, d2, x1, y1, param));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDrotmg_64(
+    hipblasHandle_t handle, double* d1, double* d2, double* x1, const double* y1, double* param)
+try
+{
+    HIPBLAS_ENTRY(handle);
+    return hipblasConvertStatus(cublasDrotmg((cublasHandle_t)handle, d1, d2, x1, y1, param));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// rotmg_batched
+hipblasStatus_t hipblasSrotmgBatched(hipblasHandle_t    handle,
+                                     float* const       d1[],
+                                     float* const       d2[],
+                                     float* const       x1[],
+                                     const float* const y1[],
+                                     float* const       param[],
+                                     int                batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDrotmgBatched(hipblasHandle_t     handle,
+                                     double* const       d1[],
+                                     double* const       d2[],
+                                     double* const       x1[],
+                                     const double* const y1[],
+                                     double* const       param[],
+                                     int                 batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// rotmg_batched_64
+hipblasStatus_t hipblasSrotmgBatched_64(hipblasHandle_t    handle,
+                                        float* const       d1[],
+                                        float* const       d2[],
+                                        float* const       x1[],
+                                        const float* const y1[],
+                                        float* const       param[],
+                                        int64_t            batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDrotmgBatched_64(hipblasHandle_t     handle,
+                                        double* const       d1[],
+                                        double* const       d2[],
+                                        double* const       x1[],
+                                        const double* const y1[],
+                                        double* const       param[],
+                                        int64_t             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// rotmg_strided_batched
+hipblasStatus_t hipblasSrotmgStridedBatched(hipblasHandle_t handle,
+                                            float*          d1,
+                                            hipblasStride   stride_d1,
+                                            float*          d2,
+                                            hipblasStride   stride_d2,
+                                            float*          x1,
+                                            hipblasStride   stride_x1,
+                                            const float*    y1,
+                                            hipblasStride   stride_y1,
+                                            float*          param,
+                                            hipblasStride   strideParam,
+                                            int             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDrotmgStridedBatched(hipblasHandle_t handle,
+                                            double*         d1,
+                                            hipblasStride   stride_d1,
+                                            double*         d2,
+                                            hipblasStride   stride_d2,
+                                            double*         x1,
+                                            hipblasStride   stride_x1,
+                                            const double*   y1,
+                                            hipblasStride   stride_y1,
+                                            double*         param,
+                                            hipblasStride   strideParam,
+                                            int             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// rotmg_strided_batched_64
+hipblasStatus_t hipblasSrotmgStridedBatched_64(hipblasHandle_t handle,
+                                               float*          d1,
+                                               hipblasStride   stride_d1,
+                                               float*          d2,
+                                               hipblasStride   stride_d2,
+                                               float*          x1,
+                                               hipblasStride   stride_x1,
+                                               const float*    y1,
+                                               hipblasStride   stride_y1,
+                                               float*          param,
+                                               hipblasStride   strideParam,
+                                               int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDrotmgStridedBatched_64(hipblasHandle_t handle,
+                                               double*         d1,
+                                               hipblasStride   stride_d1,
+                                               double*         d2,
+                                               hipblasStride   stride_d2,
+                                               double*         x1,
+                                               hipblasStride   stride_x1,
+                                               const double*   y1,
+                                               hipblasStride   stride_y1,
+                                               double*         param,
+                                               hipblasStride   strideParam,
+                                               int64_t         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// scal
+hipblasStatus_t hipblasSscal(hipblasHandle_t handle, int n, const float* alpha, float* x, int incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasStatus_t deferred = hipblasDeferVector(handle, n, alpha, nullptr, 1, x, incx, HIP_R_32F);
+    if(deferred != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return deferred;
+    hipblasStatus_t host = hipblasHostScal(handle, n, alpha, x, incx, HIP_R_32F);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    return hipblasConvertStatus(cublasSscal((cublasHandle_t)handle, n, alpha, x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasDscal(hipblasHandle_t handle, int n, const double* alpha, double* x, int incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasStatus_t deferred = hipblasDeferVector(handle, n, alpha, nullptr, 1, x, incx, HIP_R_64F);
+    if(deferred != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return deferred;
+    hipblasStatus_t host = hipblasHostScal(handle, n, alpha, x, incx, HIP_R_64F);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    return hipblasConvertStatus(cublasDscal((cublasHandle_t)handle, n, alpha, x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCscal(
+    hipblasHandle_t handle, int n, const hipblasComplex* alpha, hipblasComplex* x, int incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasStatus_t host = hipblasHostScal(handle, n, alpha, x, incx, HIP_C_32F);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    return hipblasConvertStatus(
+        cublasCscal((cublasHandle_t)handle, n, (cuComplex*)alpha, (cuComplex*)x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasCsscal(hipblasHandle_t handle, int n, const float* alpha, hipblasComplex* x, int incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    return hipblasConvertStatus(
+        cublasCsscal((cublasHandle_t)handle, n, alpha, (cuComplex*)x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZscal(hipblasHandle_t             handle,
+                             int                         n,
+                             const hipblasDoubleComplex* alpha,
+                             hipblasDoubleComplex*       x,
+                             int                         incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasStatus_t host = hipblasHostScal(handle, n, alpha, x, incx, HIP_C_64F);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    return hipblasConvertStatus(
+        cublasZscal((cublasHandle_t)handle, n, (cuDoubleComplex*)alpha, (cuDoubleComplex*)x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdscal(
+    hipblasHandle_t handle, int n, const double* alpha, hipblasDoubleComplex* x, int incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    return hipblasConvertStatus(
+        cublasZdscal((cublasHandle_t)handle, n, alpha, (cuDoubleComplex*)x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasCscal_v2(hipblasHandle_t handle, int n, const hipComplex* alpha, hipComplex* x, int incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasStatus_t host = hipblasHostScal(handle, n, alpha, x, incx, HIP_C_32F);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    return hipblasConvertStatus(
+        cublasCscal((cublasHandle_t)handle, n, (cuComplex*)alpha, (cuComplex*)x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasCsscal_v2(hipblasHandle_t handle, int n, const float* alpha, hipComplex* x, int incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    return hipblasConvertStatus(
+        cublasCsscal((cublasHandle_t)handle, n, alpha, (cuComplex*)x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZscal_v2(
+    hipblasHandle_t handle, int n, const hipDoubleComplex* alpha, hipDoubleComplex* x, int incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    hipblasStatus_t host = hipblasHostScal(handle, n, alpha, x, incx, HIP_C_64F);
+    if(host != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return host;
+    return hipblasConvertStatus(
+        cublasZscal((cublasHandle_t)handle, n, (cuDoubleComplex*)alpha, (cuDoubleComplex*)x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdscal_v2(
+    hipblasHandle_t handle, int n, const double* alpha, hipDoubleComplex* x, int incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+    return hipblasConvertStatus(
+        cublasZdscal((cublasHandle_t)handle, n, alpha, (cuDoubleComplex*)x, incx));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// scal_64
+hipblasStatus_t
+    hipblasSscal_64(hipblasHandle_t handle, int64_t n, const float* alpha, float* x, int64_t incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasSscal_64((cublasHandle_t)handle, n, alpha, x, incx));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasDscal_64(hipblasHandle_t handle, int64_t n, const double* alpha, double* x, int64_t incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasDscal_64((cublasHandle_t)handle, n, alpha, x, incx));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCscal_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* alpha, hipblasComplex* x, int64_t incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasCscal_64((cublasHandle_t)handle, n, (cuComplex*)alpha, (cuComplex*)x, incx));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsscal_64(
+    hipblasHandle_t handle, int64_t n, const float* alpha, hipblasComplex* x, int64_t incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasCsscal_64((cublasHandle_t)handle, n, alpha, (cuComplex*)x, incx));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZscal_64(hipblasHandle_t             handle,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                hipblasDoubleComplex*       x,
+                                int64_t                     incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasZscal_64(
+        (cublasHandle_t)handle, n, (cuDoubleComplex*)alpha, (cuDoubleComplex*)x, incx));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdscal_64(
+    hipblasHandle_t handle, int64_t n, const double* alpha, hipblasDoubleComplex* x, int64_t incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasZdscal_64((cublasHandle_t)handle, n, alpha, (cuDoubleComplex*)x, incx));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCscal_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipComplex* alpha, hipComplex* x, int64_t incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasCscal_64((cublasHandle_t)handle, n, (cuComplex*)alpha, (cuComplex*)x, incx));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsscal_v2_64(
+    hipblasHandle_t handle, int64_t n, const float* alpha, hipComplex* x, int64_t incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasCsscal_64((cublasHandle_t)handle, n, alpha, (cuComplex*)x, incx));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZscal_v2_64(hipblasHandle_t         handle,
+                                   int64_t                 n,
+                                   const hipDoubleComplex* alpha,
+                                   hipDoubleComplex*       x,
+                                   int64_t                 incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasZscal_64(
+        (cublasHandle_t)handle, n, (cuDoubleComplex*)alpha, (cuDoubleComplex*)x, incx));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdscal_v2_64(
+    hipblasHandle_t handle, int64_t n, const double* alpha, hipDoubleComplex* x, int64_t incx)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasZdscal_64((cublasHandle_t)handle, n, alpha, (cuDoubleComplex*)x, incx));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// scal_batched
+hipblasStatus_t hipblasSscalBatched(
+    hipblasHandle_t handle, int n, const float* alpha, float* const x[], int incx, int batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasBatchedScal<float, float, true>(handle, n, alpha, x, incx, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+hipblasStatus_t hipblasDscalBatched(
+    hipblasHandle_t handle, int n, const double* alpha, double* const x[], int incx, int batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasBatchedScal<double, double, true>(handle, n, alpha, x, incx, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCscalBatched(hipblasHandle_t       handle,
+                                    int                   n,
+                                    const hipblasComplex* alpha,
+                                    hipblasComplex* const x[],
+                                    int                   incx,
+                                    int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasBatchedScal<hipComplex, hipComplex, true>(
+        handle, n, (const hipComplex*)alpha, (hipComplex* const*)x, incx, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZscalBatched(hipblasHandle_t             handle,
+                                    int                         n,
+                                    const hipblasDoubleComplex* alpha,
+                                    hipblasDoubleComplex* const x[],
+                                    int                         incx,
+                                    int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasBatchedScal<hipDoubleComplex, hipDoubleComplex, true>(
+        handle,
+        n,
+        (const hipDoubleComplex*)alpha,
+        (hipDoubleComplex* const*)x,
+        incx,
+        0,
+        batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsscalBatched(hipblasHandle_t       handle,
+                                     int                   n,
+                                     const float*          alpha,
+                                     hipblasComplex* const x[],
+                                     int                   incx,
+                                     int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasBatchedScal<hipComplex, float, true>(
+        handle, n, alpha, (hipComplex* const*)x, incx, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdscalBatched(hipblasHandle_t             handle,
+                                     int                         n,
+                                     const double*               alpha,
+                                     hipblasDoubleComplex* const x[],
+                                     int                         incx,
+                                     int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasBatchedScal<hipDoubleComplex, double, true>(
+        handle, n, alpha, (hipDoubleComplex* const*)x, incx, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCscalBatched_v2(hipblasHandle_t   handle,
+                                       int               n,
+                                       const hipComplex* alpha,
+                                       hipComplex* const x[],
+                                       int               incx,
+                                       int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasBatchedScal<hipComplex, hipComplex, true>(
+        handle, n, alpha, x, incx, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZscalBatched_v2(hipblasHandle_t         handle,
+                                       int                     n,
+                                       const hipDoubleComplex* alpha,
+                                       hipDoubleComplex* const x[],
+                                       int                     incx,
+                                       int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasBatchedScal<hipDoubleComplex, hipDoubleComplex, true>(
+        handle, n, alpha, x, incx, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsscalBatched_v2(hipblasHandle_t   handle,
+                                        int               n,
+                                        const float*      alpha,
+                                        hipComplex* const x[],
+                                        int               incx,
+                                        int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasBatchedScal<hipComplex, float, true>(handle, n, alpha, x, incx, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdscalBatched_v2(hipblasHandle_t         handle,
+                                        int                     n,
+                                        const double*           alpha,
+                                        hipDoubleComplex* const x[],
+                                        int                     incx,
+                                        int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasBatchedScal<hipDoubleComplex, double, true>(
+        handle, n, alpha, x, incx, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// scal_batched_64
+hipblasStatus_t hipblasSscalBatched_64(hipblasHandle_t handle,
+                                       int64_t         n,
+                                       const float*    alpha,
+                                       float* const    x[],
+                                       int64_t         incx,
+                                       int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasBatchedScal<float, float, true>(handle, n, alpha, x, incx, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+hipblasStatus_t hipblasDscalBatched_64(hipblasHandle_t handle,
+                                       int64_t         n,
+                                       const double*   alpha,
+                                       double* const   x[],
+                                       int64_t         incx,
+                                       int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasBatchedScal<double, double, true>(handle, n, alpha, x, incx, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCscalBatched_64(hipblasHandle_t       handle,
+                                       int64_t               n,
+                                       const hipblasComplex* alpha,
+                                       hipblasComplex* const x[],
+                                       int64_t               incx,
+                                       int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasBatchedScal<hipComplex, hipComplex, true>(
+        handle, n, (const hipComplex*)alpha, (hipComplex* const*)x, incx, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZscalBatched_64(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       const hipblasDoubleComplex* alpha,
+                                       hipblasDoubleComplex* const x[],
+                                       int64_t                     incx,
+                                       int64_t                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasBatchedScal<hipDoubleComplex, hipDoubleComplex, true>(
+        handle,
+        n,
+        (const hipDoubleComplex*)alpha,
+        (hipDoubleComplex* const*)x,
+        incx,
+        0,
+        batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsscalBatched_64(hipblasHandle_t       handle,
+                                        int64_t               n,
+                                        const float*          alpha,
+                                        hipblasComplex* const x[],
+                                        int64_t               incx,
+                                        int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasBatchedScal<hipComplex, float, true>(
+        handle, n, alpha, (hipComplex* const*)x, incx, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdscalBatched_64(hipblasHandle_t             handle,
+                                        int64_t                     n,
+                                        const double*               alpha,
+                                        hipblasDoubleComplex* const x[],
+                                        int64_t                     incx,
+                                        int64_t                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasBatchedScal<hipDoubleComplex, double, true>(
+        handle, n, alpha, (hipDoubleComplex* const*)x, incx, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCscalBatched_v2_64(hipblasHandle_t   handle,
+                                          int64_t           n,
+                                          const hipComplex* alpha,
+                                          hipComplex* const x[],
+                                          int64_t           incx,
+                                          int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasBatchedScal<hipComplex, hipComplex, true>(
+        handle, n, alpha, x, incx, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZscalBatched_v2_64(hipblasHandle_t         handle,
+                                          int64_t                 n,
+                                          const hipDoubleComplex* alpha,
+                                          hipDoubleComplex* const x[],
+                                          int64_t                 incx,
+                                          int64_t                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasBatchedScal<hipDoubleComplex, hipDoubleComplex, true>(
+        handle, n, alpha, x, incx, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsscalBatched_v2_64(hipblasHandle_t   handle,
+                                           int64_t           n,
+                                           const float*      alpha,
+                                           hipComplex* const x[],
+                                           int64_t           incx,
+                                           int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasBatchedScal<hipComplex, float, true>(handle, n, alpha, x, incx, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdscalBatched_v2_64(hipblasHandle_t         handle,
+                                           int64_t                 n,
+                                           const double*           alpha,
+                                           hipDoubleComplex* const x[],
+                                           int64_t                 incx,
+                                           int64_t                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, batchCount);
+    return hipblasBatchedScal<hipDoubleComplex, double, true>(
+        handle, n, alpha, x, incx, 0, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// scal_strided_batched
+hipblasStatus_t hipblasSscalStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           const float*    alpha,
+                                           float*          x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasBatchedScal<float, float, false>(handle, n, alpha, x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDscalStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           const double*   alpha,
+                                           double*         x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasBatchedScal<double, double, false>(
+        handle, n, alpha, x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCscalStridedBatched(hipblasHandle_t       handle,
+                                           int                   n,
+                                           const hipblasComplex* alpha,
+                                           hipblasComplex*       x,
+                                           int                   incx,
+                                           hipblasStride         stridex,
+                                           int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasBatchedScal<hipComplex, hipComplex, false>(
+        handle, n, (const hipComplex*)alpha, (hipComplex*)x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZscalStridedBatched(hipblasHandle_t             handle,
+                                           int                         n,
+                                           const hipblasDoubleComplex* alpha,
+                                           hipblasDoubleComplex*       x,
+                                           int                         incx,
+                                           hipblasStride               stridex,
+                                           int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasBatchedScal<hipDoubleComplex, hipDoubleComplex, false>(
+        handle, n, (const hipDoubleComplex*)alpha, (hipDoubleComplex*)x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsscalStridedBatched(hipblasHandle_t handle,
+                                            int             n,
+                                            const float*    alpha,
+                                            hipblasComplex* x,
+                                            int             incx,
+                                            hipblasStride   stridex,
+                                            int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasBatchedScal<hipComplex, float, false>(
+        handle, n, alpha, (hipComplex*)x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdscalStridedBatched(hipblasHandle_t       handle,
+                                            int                   n,
+                                            const double*         alpha,
+                                            hipblasDoubleComplex* x,
+                                            int                   incx,
+                                            hipblasStride         stridex,
+                                            int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasBatchedScal<hipDoubleComplex, double, false>(
+        handle, n, alpha, (hipDoubleComplex*)x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCscalStridedBatched_v2(hipblasHandle_t   handle,
+                                              int               n,
+                                              const hipComplex* alpha,
+                                              hipComplex*       x,
+                                              int               incx,
+                                              hipblasStride     stridex,
+                                              int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasBatchedScal<hipComplex, hipComplex, false>(
+        handle, n, alpha, x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZscalStridedBatched_v2(hipblasHandle_t         handle,
+                                              int                     n,
+                                              const hipDoubleComplex* alpha,
+                                              hipDoubleComplex*       x,
+                                              int                     incx,
+                                              hipblasStride           stridex,
+                                              int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasBatchedScal<hipDoubleComplex, hipDoubleComplex, false>(
+        handle, n, alpha, x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsscalStridedBatched_v2(hipblasHandle_t handle,
+                                               int             n,
+                                               const float*    alpha,
+                                               hipComplex*     x,
+                                               int             incx,
+                                               hipblasStride   stridex,
+                                               int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasBatchedScal<hipComplex, float, false>(
+        handle, n, alpha, x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdscalStridedBatched_v2(hipblasHandle_t   handle,
+                                               int               n,
+                                               const double*     alpha,
+                                               hipDoubleComplex* x,
+                                               int               incx,
+                                               hipblasStride     stridex,
+                                               int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasBatchedScal<hipDoubleComplex, double, false>(
+        handle, n, alpha, x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// scal_strided_batched_64
+hipblasStatus_t hipblasSscalStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const float*    alpha,
+                                              float*          x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasBatchedScal<float, float, false>(handle, n, alpha, x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDscalStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const double*   alpha,
+                                              double*         x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasBatchedScal<double, double, false>(
+        handle, n, alpha, x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCscalStridedBatched_64(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              hipblasComplex*       x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasBatchedScal<hipComplex, hipComplex, false>(
+        handle, n, (const hipComplex*)alpha, (hipComplex*)x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZscalStridedBatched_64(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              hipblasDoubleComplex*       x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              int64_t                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasBatchedScal<hipDoubleComplex, hipDoubleComplex, false>(
+        handle, n, (const hipDoubleComplex*)alpha, (hipDoubleComplex*)x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsscalStridedBatched_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               const float*    alpha,
+                                               hipblasComplex* x,
+                                               int64_t         incx,
+                                               hipblasStride   stridex,
+                                               int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasBatchedScal<hipComplex, float, false>(
+        handle, n, alpha, (hipComplex*)x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdscalStridedBatched_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const double*         alpha,
+                                               hipblasDoubleComplex* x,
+                                               int64_t               incx,
+                                               hipblasStride         stridex,
+                                               int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasBatchedScal<hipDoubleComplex, double, false>(
+        handle, n, alpha, (hipDoubleComplex*)x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCscalStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                 int64_t           n,
+                                                 const hipComplex* alpha,
+                                                 hipComplex*       x,
+                                                 int64_t           incx,
+                                                 hipblasStride     stridex,
+                                                 int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasBatchedScal<hipComplex, hipComplex, false>(
+        handle, n, alpha, x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZscalStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                 int64_t                 n,
+                                                 const hipDoubleComplex* alpha,
+                                                 hipDoubleComplex*       x,
+                                                 int64_t                 incx,
+                                                 hipblasStride           stridex,
+                                                 int64_t                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasBatchedScal<hipDoubleComplex, hipDoubleComplex, false>(
+        handle, n, alpha, x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCsscalStridedBatched_v2_64(hipblasHandle_t handle,
+                                                  int64_t         n,
+                                                  const float*    alpha,
+                                                  hipComplex*     x,
+                                                  int64_t         incx,
+                                                  hipblasStride   stridex,
+                                                  int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasBatchedScal<hipComplex, float, false>(
+        handle, n, alpha, x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZdscalStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                  int64_t           n,
+                                                  const double*     alpha,
+                                                  hipDoubleComplex* x,
+                                                  int64_t           incx,
+                                                  hipblasStride     stridex,
+                                                  int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, batchCount);
+    return hipblasBatchedScal<hipDoubleComplex, double, false>(
+        handle, n, alpha, x, incx, stridex, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// swap
+hipblasStatus_t hipblasSswap(hipblasHandle_t handle, int n, float* x, int incx, float* y, int incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(cublasSswap((cublasHandle_t)handle, n, x, incx, y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasDswap(hipblasHandle_t handle, int n, double* x, int incx, double* y, int incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(cublasDswap((cublasHandle_t)handle, n, x, incx, y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCswap(
+    hipblasHandle_t handle, int n, hipblasComplex* x, int incx, hipblasComplex* y, int incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(
+        cublasCswap((cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZswap(hipblasHandle_t       handle,
+                             int                   n,
+                             hipblasDoubleComplex* x,
+                             int                   incx,
+                             hipblasDoubleComplex* y,
+                             int                   incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(cublasZswap(
+        (cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, (cuDoubleComplex*)y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasCswap_v2(hipblasHandle_t handle, int n, hipComplex* x, int incx, hipComplex* y, int incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(
+        cublasCswap((cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZswap_v2(
+    hipblasHandle_t handle, int n, hipDoubleComplex* x, int incx, hipDoubleComplex* y, int incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+    return hipblasConvertStatus(cublasZswap(
+        (cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, (cuDoubleComplex*)y, incy));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// swap_64
+hipblasStatus_t hipblasSswap_64(
+    hipblasHandle_t handle, int64_t n, float* x, int64_t incx, float* y, int64_t incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasSswap_64((cublasHandle_t)handle, n, x, incx, y, incy));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDswap_64(
+    hipblasHandle_t handle, int64_t n, double* x, int64_t incx, double* y, int64_t incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasDswap_64((cublasHandle_t)handle, n, x, incx, y, incy));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCswap_64(hipblasHandle_t handle,
+                                int64_t         n,
+                                hipblasComplex* x,
+                                int64_t         incx,
+                                hipblasComplex* y,
+                                int64_t         incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasCswap_64((cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZswap_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                hipblasDoubleComplex* x,
+                                int64_t               incx,
+                                hipblasDoubleComplex* y,
+                                int64_t               incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasZswap_64(
+        (cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, (cuDoubleComplex*)y, incy));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCswap_v2_64(
+    hipblasHandle_t handle, int64_t n, hipComplex* x, int64_t incx, hipComplex* y, int64_t incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasCswap_64((cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZswap_v2_64(hipblasHandle_t   handle,
+                                   int64_t           n,
+                                   hipDoubleComplex* x,
+                                   int64_t           incx,
+                                   hipDoubleComplex* y,
+                                   int64_t           incy)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasZswap_64(
+        (cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, (cuDoubleComplex*)y, incy));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// swap_batched
+hipblasStatus_t hipblasSswapBatched(hipblasHandle_t handle,
+                                    int             n,
+                                    float* const    x[],
+                                    int             incx,
+                                    float* const    y[],
+                                    int             incy,
+                                    int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasSswap((cublasHandle_t)handle,
+                                                    n,
+                                                    p(x, b),
+                                                    incx,
+                                                    p(y, b),
+                                                    incy));
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDswapBatched(hipblasHandle_t handle,
+                                    int             n,
+                                    double* const   x[],
+                                    int             incx,
+                                    double* const   y[],
+                                    int             incy,
+                                    int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasDswap((cublasHandle_t)handle,
+                                                    n,
+                                                    p(x, b),
+                                                    incx,
+                                                    p(y, b),
+                                                    incy));
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCswapBatched(hipblasHandle_t       handle,
+                                    int                   n,
+                                    hipblasComplex* const x[],
+                                    int                   incx,
+                                    hipblasComplex* const y[],
+                                    int                   incy,
+                                    int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasCswap((cublasHandle_t)handle,
+                                                    n,
+                                                    (cuComplex*)p(x, b),
+                                                    incx,
+                                                    (cuComplex*)p(y, b),
+                                                    incy));
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZswapBatched(hipblasHandle_t             handle,
+                                    int                         n,
+                                    hipblasDoubleComplex* const x[],
+                                    int                         incx,
+                                    hipblasDoubleComplex* const y[],
+                                    int                         incy,
+                                    int                         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasZswap((cublasHandle_t)handle,
+                                                    n,
+                                                    (cuDoubleComplex*)p(x, b),
+                                                    incx,
+                                                    (cuDoubleComplex*)p(y, b),
+                                                    incy));
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCswapBatched_v2(hipblasHandle_t   handle,
+                                       int               n,
+                                       hipComplex* const x[],
+                                       int               incx,
+                                       hipComplex* const y[],
+                                       int               incy,
+                                       int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasCswap((cublasHandle_t)handle,
+                                                    n,
+                                                    (cuComplex*)p(x, b),
+                                                    incx,
+                                                    (cuComplex*)p(y, b),
+                                                    incy));
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZswapBatched_v2(hipblasHandle_t         handle,
+                                       int                     n,
+                                       hipDoubleComplex* const x[],
+                                       int                     incx,
+                                       hipDoubleComplex* const y[],
+                                       int                     incy,
+                                       int                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasZswap((cublasHandle_t)handle,
+                                                    n,
+                                                    (cuDoubleComplex*)p(x, b),
+                                                    incx,
+                                                    (cuDoubleComplex*)p(y, b),
+                                                    incy));
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// swap_batched_64
+hipblasStatus_t hipblasSswapBatched_64(hipblasHandle_t handle,
+                                       int64_t         n,
+                                       float* const    x[],
+                                       int64_t         incx,
+                                       float* const    y[],
+                                       int64_t         incy,
+                                       int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasSswap_64((cublasHandle_t)handle,
+                                                       n,
+                                                       p(x, b),
+                                                       incx,
+                                                       p(y, b),
+                                                       incy));
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDswapBatched_64(hipblasHandle_t handle,
+                                       int64_t         n,
+                                       double* const   x[],
+                                       int64_t         incx,
+                                       double* const   y[],
+                                       int64_t         incy,
+                                       int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasDswap_64((cublasHandle_t)handle,
+                                                       n,
+                                                       p(x, b),
+                                                       incx,
+                                                       p(y, b),
+                                                       incy));
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCswapBatched_64(hipblasHandle_t       handle,
+                                       int64_t               n,
+                                       hipblasComplex* const x[],
+                                       int64_t               incx,
+                                       hipblasComplex* const y[],
+                                       int64_t               incy,
+                                       int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasCswap_64((cublasHandle_t)handle,
+                                                       n,
+                                                       (cuComplex*)p(x, b),
+                                                       incx,
+                                                       (cuComplex*)p(y, b),
+                                                       incy));
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZswapBatched_64(hipblasHandle_t             handle,
+                                       int64_t                     n,
+                                       hipblasDoubleComplex* const x[],
+                                       int64_t                     incx,
+                                       hipblasDoubleComplex* const y[],
+                                       int64_t                     incy,
+                                       int64_t                     batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasZswap_64((cublasHandle_t)handle,
+                                                       n,
+                                                       (cuDoubleComplex*)p(x, b),
+                                                       incx,
+                                                       (cuDoubleComplex*)p(y, b),
+                                                       incy));
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCswapBatched_v2_64(hipblasHandle_t   handle,
+                                          int64_t           n,
+                                          hipComplex* const x[],
+                                          int64_t           incx,
+                                          hipComplex* const y[],
+                                          int64_t           incy,
+                                          int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasCswap_64((cublasHandle_t)handle,
+                                                       n,
+                                                       (cuComplex*)p(x, b),
+                                                       incx,
+                                                       (cuComplex*)p(y, b),
+                                                       incy));
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZswapBatched_v2_64(hipblasHandle_t         handle,
+                                          int64_t                 n,
+                                          hipDoubleComplex* const x[],
+                                          int64_t                 incx,
+                                          hipDoubleComplex* const y[],
+                                          int64_t                 incy,
+                                          int64_t                 batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, incy, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(
+        handle, batchCount, {x, y}, [&](int64_t b, const hipblasHostPointers& p) {
+            return hipblasConvertStatus(cublasZswap_64((cublasHandle_t)handle,
+                                                       n,
+                                                       (cuDoubleComplex*)p(x, b),
+                                                       incx,
+                                                       (cuDoubleComplex*)p(y, b),
+                                                       incy));
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// swap_strided_batched
+hipblasStatus_t hipblasSswapStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           float*          x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           float*          y,
+                                           int             incy,
+                                           hipblasStride   stridey,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasSswap((cublasHandle_t)handle,
+                                                n,
+                                                (x + b * stridex),
+                                                incx,
+                                                (y + b * stridey),
+                                                incy));
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDswapStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           double*         x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           double*         y,
+                                           int             incy,
+                                           hipblasStride   stridey,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasDswap((cublasHandle_t)handle,
+                                                n,
+                                                (x + b * stridex),
+                                                incx,
+                                                (y + b * stridey),
+                                                incy));
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCswapStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           hipblasComplex* x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           hipblasComplex* y,
+                                           int             incy,
+                                           hipblasStride   stridey,
+                                           int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasCswap((cublasHandle_t)handle,
+                                                n,
+                                                (cuComplex*)(x + b * stridex),
+                                                incx,
+                                                (cuComplex*)(y + b * stridey),
+                                                incy));
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZswapStridedBatched(hipblasHandle_t       handle,
+                                           int                   n,
+                                           hipblasDoubleComplex* x,
+                                           int                   incx,
+                                           hipblasStride         stridex,
+                                           hipblasDoubleComplex* y,
+                                           int                   incy,
+                                           hipblasStride         stridey,
+                                           int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasZswap((cublasHandle_t)handle,
+                                                n,
+                                                (cuDoubleComplex*)(x + b * stridex),
+                                                incx,
+                                                (cuDoubleComplex*)(y + b * stridey),
+                                                incy));
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCswapStridedBatched_v2(hipblasHandle_t handle,
+                                              int             n,
+                                              hipComplex*     x,
+                                              int             incx,
+                                              hipblasStride   stridex,
+                                              hipComplex*     y,
+                                              int             incy,
+                                              hipblasStride   stridey,
+                                              int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasCswap((cublasHandle_t)handle,
+                                                n,
+                                                (cuComplex*)(x + b * stridex),
+                                                incx,
+                                                (cuComplex*)(y + b * stridey),
+                                                incy));
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZswapStridedBatched_v2(hipblasHandle_t   handle,
+                                              int               n,
+                                              hipDoubleComplex* x,
+                                              int               incx,
+                                              hipblasStride     stridex,
+                                              hipDoubleComplex* y,
+                                              int               incy,
+                                              hipblasStride     stridey,
+                                              int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasZswap((cublasHandle_t)handle,
+                                                n,
+                                                (cuDoubleComplex*)(x + b * stridex),
+                                                incx,
+                                                (cuDoubleComplex*)(y + b * stridey),
+                                                incy));
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// swap_strided_batched_64
+hipblasStatus_t hipblasSswapStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              float*          x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              float*          y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasSswap_64((cublasHandle_t)handle,
+                                                   n,
+                                                   (x + b * stridex),
+                                                   incx,
+                                                   (y + b * stridey),
+                                                   incy));
+    });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDswapStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              double*         x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              double*         y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasDswap_64((cublasHandle_t)handle,
+                                                   n,
+                                                   (x + b * stridex),
+                                                   incx,
+                                                   (y + b * stridey),
+                                                   incy));
+    });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCswapStridedBatched_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              hipblasComplex* x,
+                                              int64_t         incx,
+                                              hipblasStride   stridex,
+                                              hipblasComplex* y,
+                                              int64_t         incy,
+                                              hipblasStride   stridey,
+                                              int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasCswap_64((cublasHandle_t)handle,
+                                                   n,
+                                                   (cuComplex*)(x + b * stridex),
+                                                   incx,
+                                                   (cuComplex*)(y + b * stridey),
+                                                   incy));
+    });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZswapStridedBatched_64(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              hipblasDoubleComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              hipblasDoubleComplex* y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              int64_t               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasZswap_64((cublasHandle_t)handle,
+                                                   n,
+                                                   (cuDoubleComplex*)(x + b * stridex),
+                                                   incx,
+                                                   (cuDoubleComplex*)(y + b * stridey),
+                                                   incy));
+    });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCswapStridedBatched_v2_64(hipblasHandle_t handle,
+                                                 int64_t         n,
+                                                 hipComplex*     x,
+                                                 int64_t         incx,
+                                                 hipblasStride   stridex,
+                                                 hipComplex*     y,
+                                                 int64_t         incy,
+                                                 hipblasStride   stridey,
+                                                 int64_t         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasCswap_64((cublasHandle_t)handle,
+                                                   n,
+                                                   (cuComplex*)(x + b * stridex),
+                                                   incx,
+                                                   (cuComplex*)(y + b * stridey),
+                                                   incy));
+    });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZswapStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                 int64_t           n,
+                                                 hipDoubleComplex* x,
+                                                 int64_t           incx,
+                                                 hipblasStride     stridex,
+                                                 hipDoubleComplex* y,
+                                                 int64_t           incy,
+                                                 hipblasStride     stridey,
+                                                 int64_t           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, incx, stridex, incy, stridey, batchCount);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasBatchedFallback(handle, batchCount, [&](int64_t b) {
+        return hipblasConvertStatus(cublasZswap_64((cublasHandle_t)handle,
+                                                   n,
+                                                   (cuDoubleComplex*)(x + b * stridex),
+                                                   incx,
+                                                   (cuDoubleComplex*)(y + b * stridey),
+                                                   incy));
+    });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,7383 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas_internal.hpp"
+
+// Size in bytes of an element of type
+static size_t hipblasDatatypeSize(cudaDataType_t type)
+{
+    switch(type)
+    {
+    case CUDA_R_8I:
+    case CUDA_R_8U:
+#ifdef HIP_R_8F_E4M3
+    case CUDA_R_8F_E4M3:
+    case CUDA_R_8F_E5M2:
+#endif
+        return 1;
+    case CUDA_R_16F:
+    case CUDA_R_16BF:
+    case CUDA_C_8I:
+    case CUDA_C_8U:
+        return 2;
+    case CUDA_R_32F:
+    case CUDA_R_32I:
+    case CUDA_C_16F:
+    case CUDA_C_16BF:
+        return 4;
+    case CUDA_R_64F:
+    case CUDA_C_32F:
+    case CUDA_C_32I:
+        return 8;
+    case CUDA_C_64F:
+        return 16;
+    default:
+        throw HIPBLAS_STATUS_INVALID_ENUM;
+    }
+}
+
+// Compute type of the gemmEx functions with a hipblasDatatype_t compute type, as chosen by
+// cuBLAS for the cudaDataType_t compute types of its 32-bit gemmEx functions
+static cublasComputeType_t hipblasConvertComputeDatatype(hipblasDatatype_t type)
+{
+    switch(type)
+    {
+    case HIPBLAS_R_16F:
+    case HIPBLAS_C_16F:
+        return CUBLAS_COMPUTE_16F;
+
+    case HIPBLAS_R_32F:
+    case HIPBLAS_C_32F:
+        return CUBLAS_COMPUTE_32F;
+
+    case HIPBLAS_R_64F:
+    case HIPBLAS_C_64F:
+        return CUBLAS_COMPUTE_64F;
+
+    case HIPBLAS_R_32I:
+    case HIPBLAS_C_32I:
+        return CUBLAS_COMPUTE_32I;
+
+    default:
+        throw HIPBLAS_STATUS_INVALID_ENUM;
+    }
+}
+
+// hipblasGemmEx and hipblasGemmStridedBatchedEx in HIPBLAS_GEMM_BACKEND_LT mode, defined with
+// hipblasCublasLtGemm below
+static hipblasStatus_t hipblasCublasLtRoutedGemmEx(hipblasHandle_t      handle,
+                                                   hipblasOperation_t   transa,
+                                                   hipblasOperation_t   transb,
+                                                   int                  m,
+                                                   int                  n,
+                                                   int                  k,
+                                                   const void*          alpha,
+                                                   const void*          A,
+                                                   hipDataType          a_type,
+                                                   int                  lda,
+                                                   hipblasStride        stride_a,
+                                                   const void*          B,
+                                                   hipDataType          b_type,
+                                                   int                  ldb,
+                                                   hipblasStride        stride_b,
+                                                   const void*          beta,
+                                                   void*                C,
+                                                   hipDataType          c_type,
+                                                   int                  ldc,
+                                                   hipblasStride        stride_c,
+                                                   int                  batch_count,
+                                                   hipblasComputeType_t compute_type);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// gemm_ex
+hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
+                              hipblasOperation_t transa,
+                              hipblasOperation_t transb,
+                              int                m,
+                              int                n,
+                              int                k,
+                              const void*        alpha,
+                              const void*        A,
+                              hipblasDatatype_t  a_type,
+                              int                lda,
+                              const void*        B,
+                              hipblasDatatype_t  b_type,
+                              int                ldb,
+                              const void*        beta,
+                              void*              C,
+                              hipblasDatatype_t  c_type,
+                              int                ldc,
+                              hipblasDatatype_t  compute_type,
+                              hipblasGemmAlgo_t  algo)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, transa, transb, m, n, k, a_type, lda, b_type, ldb, c_type, ldc, compute_type, algo);
+
+    return hipblasConvertStatus(cublasGemmEx((cublasHandle_t)handle,
+                                             hipblasConvertOperation(transa),
+                                             hipblasConvertOperation(transb),
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             hipblasConvertDatatype(a_type),
+                                             lda,
+                                             B,
+                                             hipblasConvertDatatype(b_type),
+                                             ldb,
+                                             beta,
+                                             C,
+                                             hipblasConvertDatatype(c_type),
+                                             ldc,
+                                             hipblasConvertDatatype(compute_type),
+                                             hipblasConvertGemmAlgo(algo)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmExWithFlags(hipblasHandle_t    handle,
+                                       hipblasOperation_t transa,
+                                       hipblasOperation_t transb,
+                                       int                m,
+                                       int                n,
+                                       int                k,
+                                       const void*        alpha,
+                                       const void*        A,
+                                       hipblasDatatype_t  a_type,
+                                       int                lda,
+                                       const void*        B,
+                                       hipblasDatatype_t  b_type,
+                                       int                ldb,
+                                       const void*        beta,
+                                       void*              C,
+                                       hipblasDatatype_t  c_type,
+                                       int                ldc,
+                                       hipblasDatatype_t  compute_type,
+                                       hipblasGemmAlgo_t  algo,
+                                       hipblasGemmFlags_t flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  compute_type,
+                  algo,
+                  flags);
+
+    // flags are ignored, call original function
+    return hipblasConvertStatus(cublasGemmEx((cublasHandle_t)handle,
+                                             hipblasConvertOperation(transa),
+                                             hipblasConvertOperation(transb),
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             hipblasConvertDatatype(a_type),
+                                             lda,
+                                             B,
+                                             hipblasConvertDatatype(b_type),
+                                             ldb,
+                                             beta,
+                                             C,
+                                             hipblasConvertDatatype(c_type),
+                                             ldc,
+                                             hipblasConvertDatatype(compute_type),
+                                             hipblasConvertGemmAlgo(algo)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmEx_v2(hipblasHandle_t      handle,
+                                 hipblasOperation_t   transa,
+                                 hipblasOperation_t   transb,
+                                 int                  m,
+                                 int                  n,
+                                 int                  k,
+                                 const void*          alpha,
+                                 const void*          A,
+                                 hipDataType          a_type,
+                                 int                  lda,
+                                 const void*          B,
+                                 hipDataType          b_type,
+                                 int                  ldb,
+                                 const void*          beta,
+                                 void*                C,
+                                 hipDataType          c_type,
+                                 int                  ldc,
+                                 hipblasComputeType_t compute_type,
+                                 hipblasGemmAlgo_t    algo)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, transa, transb, m, n, k, a_type, lda, b_type, ldb, c_type, ldc, compute_type, algo);
+    hipblasPrefetchGemm(handle,
+                        transa,
+                        transb,
+                        m,
+                        n,
+                        k,
+                        A,
+                        lda,
+                        0,
+                        B,
+                        ldb,
+                        0,
+                        C,
+                        ldc,
+                        0,
+                        1,
+                        hipblasPrefetchTypeSize(a_type),
+                        hipblasPrefetchTypeSize(b_type),
+                        hipblasPrefetchTypeSize(c_type));
+
+    hipblasStatus_t rounded = hipblasRoundedGemmEx(handle,
+                                                   transa,
+                                                   transb,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   A,
+                                                   a_type,
+                                                   lda,
+                                                   0,
+                                                   B,
+                                                   b_type,
+                                                   ldb,
+                                                   0,
+                                                   beta,
+                                                   C,
+                                                   c_type,
+                                                   ldc,
+                                                   0,
+                                                   1,
+                                                   compute_type,
+                                                   algo);
+    if(rounded != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return rounded;
+
+    hipblasStatus_t complex_half = hipblasComplexHalfGemmEx(handle,
+                                                            transa,
+                                                            transb,
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            alpha,
+                                                            A,
+                                                            a_type,
+                                                            lda,
+                                                            0,
+                                                            B,
+                                                            b_type,
+                                                            ldb,
+                                                            0,
+                                                            beta,
+                                                            C,
+                                                            c_type,
+                                                            ldc,
+                                                            0,
+                                                            1,
+                                                            compute_type);
+    if(complex_half != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return complex_half;
+
+    hipblasStatus_t shaped = hipblasShapeDispatchGemm(handle,
+                                                      transa,
+                                                      transb,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      alpha,
+                                                      A,
+                                                      a_type,
+                                                      lda,
+                                                      B,
+                                                      b_type,
+                                                      ldb,
+                                                      beta,
+                                                      C,
+                                                      c_type,
+                                                      ldc,
+                                                      compute_type);
+    if(shaped != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return shaped;
+
+    hipblasStatus_t lt = hipblasCublasLtRoutedGemmEx(handle,
+                                                     transa,
+                                                     transb,
+                                                     m,
+                                                     n,
+                                                     k,
+                                                     alpha,
+                                                     A,
+                                                     a_type,
+                                                     lda,
+                                                     0,
+                                                     B,
+                                                     b_type,
+                                                     ldb,
+                                                     0,
+                                                     beta,
+                                                     C,
+                                                     c_type,
+                                                     ldc,
+                                                     0,
+                                                     1,
+                                                     compute_type);
+    if(lt != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return lt;
+
+    return hipblasConvertStatus(cublasGemmEx((cublasHandle_t)handle,
+                                             hipblasConvertOperation(transa),
+                                             hipblasConvertOperation(transb),
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             hipblasConvertDatatype_v2(a_type),
+                                             lda,
+                                             B,
+                                             hipblasConvertDatatype_v2(b_type),
+                                             ldb,
+                                             beta,
+                                             C,
+                                             hipblasConvertDatatype_v2(c_type),
+                                             ldc,
+                                             hipblasConvertComputeType(compute_type),
+                                             hipblasConvertGemmAlgo(algo)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmExWithFlags_v2(hipblasHandle_t      handle,
+                                          hipblasOperation_t   transa,
+                                          hipblasOperation_t   transb,
+                                          int                  m,
+                                          int                  n,
+                                          int                  k,
+                                          const void*          alpha,
+                                          const void*          A,
+                                          hipDataType          a_type,
+                                          int                  lda,
+                                          const void*          B,
+                                          hipDataType          b_type,
+                                          int                  ldb,
+                                          const void*          beta,
+                                          void*                C,
+                                          hipDataType          c_type,
+                                          int                  ldc,
+                                          hipblasComputeType_t compute_type,
+                                          hipblasGemmAlgo_t    algo,
+                                          hipblasGemmFlags_t   flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  compute_type,
+                  algo,
+                  flags);
+
+    // flags are ignored, call original function
+    return hipblasConvertStatus(cublasGemmEx((cublasHandle_t)handle,
+                                             hipblasConvertOperation(transa),
+                                             hipblasConvertOperation(transb),
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             hipblasConvertDatatype_v2(a_type),
+                                             lda,
+                                             B,
+                                             hipblasConvertDatatype_v2(b_type),
+                                             ldb,
+                                             beta,
+                                             C,
+                                             hipblasConvertDatatype_v2(c_type),
+                                             ldc,
+                                             hipblasConvertComputeType(compute_type),
+                                             hipblasConvertGemmAlgo(algo)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t    handle,
+                                     hipblasOperation_t transa,
+                                     hipblasOperation_t transb,
+                                     int                m,
+                                     int                n,
+                                     int                k,
+                                     const void*        alpha,
+                                     const void*        A[],
+                                     hipblasDatatype_t  a_type,
+                                     int                lda,
+                                     const void*        B[],
+                                     hipblasDatatype_t  b_type,
+                                     int                ldb,
+                                     const void*        beta,
+                                     void*              C[],
+                                     hipblasDatatype_t  c_type,
+                                     int                ldc,
+                                     int                batch_count,
+                                     hipblasDatatype_t  compute_type,
+                                     hipblasGemmAlgo_t  algo)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  batch_count,
+                  compute_type,
+                  algo);
+
+    return hipblasConvertStatus(cublasGemmBatchedEx((cublasHandle_t)handle,
+                                                    hipblasConvertOperation(transa),
+                                                    hipblasConvertOperation(transb),
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    alpha,
+                                                    A,
+                                                    hipblasConvertDatatype(a_type),
+                                                    lda,
+                                                    B,
+                                                    hipblasConvertDatatype(b_type),
+                                                    ldb,
+                                                    beta,
+                                                    C,
+                                                    hipblasConvertDatatype(c_type),
+                                                    ldc,
+                                                    batch_count,
+                                                    hipblasConvertDatatype(compute_type),
+                                                    hipblasConvertGemmAlgo(algo)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedExWithFlags(hipblasHandle_t    handle,
+                                              hipblasOperation_t transa,
+                                              hipblasOperation_t transb,
+                                              int                m,
+                                              int                n,
+                                              int                k,
+                                              const void*        alpha,
+                                              const void*        A[],
+                                              hipblasDatatype_t  a_type,
+                                              int                lda,
+                                              const void*        B[],
+                                              hipblasDatatype_t  b_type,
+                                              int                ldb,
+                                              const void*        beta,
+                                              void*              C[],
+                                              hipblasDatatype_t  c_type,
+                                              int                ldc,
+                                              int                batch_count,
+                                              hipblasDatatype_t  compute_type,
+                                              hipblasGemmAlgo_t  algo,
+                                              hipblasGemmFlags_t flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  batch_count,
+                  compute_type,
+                  algo,
+                  flags);
+
+    // flags are ignored, call original function
+    return hipblasConvertStatus(cublasGemmBatchedEx((cublasHandle_t)handle,
+                                                    hipblasConvertOperation(transa),
+                                                    hipblasConvertOperation(transb),
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    alpha,
+                                                    A,
+                                                    hipblasConvertDatatype(a_type),
+                                                    lda,
+                                                    B,
+                                                    hipblasConvertDatatype(b_type),
+                                                    ldb,
+                                                    beta,
+                                                    C,
+                                                    hipblasConvertDatatype(c_type),
+                                                    ldc,
+                                                    batch_count,
+                                                    hipblasConvertDatatype(compute_type),
+                                                    hipblasConvertGemmAlgo(algo)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedEx_v2(hipblasHandle_t      handle,
+                                        hipblasOperation_t   transa,
+                                        hipblasOperation_t   transb,
+                                        int                  m,
+                                        int                  n,
+                                        int                  k,
+                                        const void*          alpha,
+                                        const void*          A[],
+                                        hipDataType          a_type,
+                                        int                  lda,
+                                        const void*          B[],
+                                        hipDataType          b_type,
+                                        int                  ldb,
+                                        const void*          beta,
+                                        void*                C[],
+                                        hipDataType          c_type,
+                                        int                  ldc,
+                                        int                  batch_count,
+                                        hipblasComputeType_t compute_type,
+                                        hipblasGemmAlgo_t    algo)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  batch_count,
+                  compute_type,
+                  algo);
+
+    hipblasStatus_t small = hipblasSmallGemm(handle,
+                                             transa,
+                                             transb,
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             a_type,
+                                             lda,
+                                             0,
+                                             B,
+                                             b_type,
+                                             ldb,
+                                             0,
+                                             beta,
+                                             C,
+                                             c_type,
+                                             ldc,
+                                             0,
+                                             batch_count,
+                                             compute_type,
+                                             true);
+    if(small != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return small;
+
+    return hipblasConvertStatus(cublasGemmBatchedEx((cublasHandle_t)handle,
+                                                    hipblasConvertOperation(transa),
+                                                    hipblasConvertOperation(transb),
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    alpha,
+                                                    A,
+                                                    hipblasConvertDatatype_v2(a_type),
+                                                    lda,
+                                                    B,
+                                                    hipblasConvertDatatype_v2(b_type),
+                                                    ldb,
+                                                    beta,
+                                                    C,
+                                                    hipblasConvertDatatype_v2(c_type),
+                                                    ldc,
+                                                    batch_count,
+                                                    hipblasConvertComputeType(compute_type),
+                                                    hipblasConvertGemmAlgo(algo)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedExWithFlags_v2(hipblasHandle_t      handle,
+                                                 hipblasOperation_t   transa,
+                                                 hipblasOperation_t   transb,
+                                                 int                  m,
+                                                 int                  n,
+                                                 int                  k,
+                                                 const void*          alpha,
+                                                 const void*          A[],
+                                                 hipDataType          a_type,
+                                                 int                  lda,
+                                                 const void*          B[],
+                                                 hipDataType          b_type,
+                                                 int                  ldb,
+                                                 const void*          beta,
+                                                 void*                C[],
+                                                 hipDataType          c_type,
+                                                 int                  ldc,
+                                                 int                  batch_count,
+                                                 hipblasComputeType_t compute_type,
+                                                 hipblasGemmAlgo_t    algo,
+                                                 hipblasGemmFlags_t   flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  batch_count,
+                  compute_type,
+                  algo,
+                  flags);
+
+    hipblasStatus_t small = hipblasSmallGemm(handle,
+                                             transa,
+                                             transb,
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             a_type,
+                                             lda,
+                                             0,
+                                             B,
+                                             b_type,
+                                             ldb,
+                                             0,
+                                             beta,
+                                             C,
+                                             c_type,
+                                             ldc,
+                                             0,
+                                             batch_count,
+                                             compute_type,
+                                             true);
+    if(small != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return small;
+
+    // flags are ignored, call original function
+    return hipblasConvertStatus(cublasGemmBatchedEx((cublasHandle_t)handle,
+                                                    hipblasConvertOperation(transa),
+                                                    hipblasConvertOperation(transb),
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    alpha,
+                                                    A,
+                                                    hipblasConvertDatatype_v2(a_type),
+                                                    lda,
+                                                    B,
+                                                    hipblasConvertDatatype_v2(b_type),
+                                                    ldb,
+                                                    beta,
+                                                    C,
+                                                    hipblasConvertDatatype_v2(c_type),
+                                                    ldc,
+                                                    batch_count,
+                                                    hipblasConvertComputeType(compute_type),
+                                                    hipblasConvertGemmAlgo(algo)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t    handle,
+                                            hipblasOperation_t transa,
+                                            hipblasOperation_t transb,
+                                            int                m,
+                                            int                n,
+                                            int                k,
+                                            const void*        alpha,
+                                            const void*        A,
+                                            hipblasDatatype_t  a_type,
+                                            int                lda,
+                                            hipblasStride      stride_A,
+                                            const void*        B,
+                                            hipblasDatatype_t  b_type,
+                                            int                ldb,
+                                            hipblasStride      stride_B,
+                                            const void*        beta,
+                                            void*              C,
+                                            hipblasDatatype_t  c_type,
+                                            int                ldc,
+                                            hipblasStride      stride_C,
+                                            int                batch_count,
+                                            hipblasDatatype_t  compute_type,
+                                            hipblasGemmAlgo_t  algo)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  stride_A,
+                  b_type,
+                  ldb,
+                  stride_B,
+                  c_type,
+                  ldc,
+                  stride_C,
+                  batch_count,
+                  compute_type,
+                  algo);
+
+    return hipblasConvertStatus(cublasGemmStridedBatchedEx((cublasHandle_t)handle,
+                                                           hipblasConvertOperation(transa),
+                                                           hipblasConvertOperation(transb),
+                                                           m,
+                                                           n,
+                                                           k,
+                                                           alpha,
+                                                           A,
+                                                           hipblasConvertDatatype(a_type),
+                                                           lda,
+                                                           stride_A,
+                                                           B,
+                                                           hipblasConvertDatatype(b_type),
+                                                           ldb,
+                                                           stride_B,
+                                                           beta,
+                                                           C,
+                                                           hipblasConvertDatatype(c_type),
+                                                           ldc,
+                                                           stride_C,
+                                                           batch_count,
+                                                           hipblasConvertDatatype(compute_type),
+                                                           hipblasConvertGemmAlgo(algo)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExWithFlags(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transa,
+                                                     hipblasOperation_t transb,
+                                                     int                m,
+                                                     int                n,
+                                                     int                k,
+                                                     const void*        alpha,
+                                                     const void*        A,
+                                                     hipblasDatatype_t  a_type,
+                                                     int                lda,
+                                                     hipblasStride      stride_A,
+                                                     const void*        B,
+                                                     hipblasDatatype_t  b_type,
+                                                     int                ldb,
+                                                     hipblasStride      stride_B,
+                                                     const void*        beta,
+                                                     void*              C,
+                                                     hipblasDatatype_t  c_type,
+                                                     int                ldc,
+                                                     hipblasStride      stride_C,
+                                                     int                batch_count,
+                                                     hipblasDatatype_t  compute_type,
+                                                     hipblasGemmAlgo_t  algo,
+                                                     hipblasGemmFlags_t flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  stride_A,
+                  b_type,
+                  ldb,
+                  stride_B,
+                  c_type,
+                  ldc,
+                  stride_C,
+                  batch_count,
+                  compute_type,
+                  algo,
+                  flags);
+
+    // flags are ignored, call original function
+    return hipblasConvertStatus(cublasGemmStridedBatchedEx((cublasHandle_t)handle,
+                                                           hipblasConvertOperation(transa),
+                                                           hipblasConvertOperation(transb),
+                                                           m,
+                                                           n,
+                                                           k,
+                                                           alpha,
+                                                           A,
+                                                           hipblasConvertDatatype(a_type),
+                                                           lda,
+                                                           stride_A,
+                                                           B,
+                                                           hipblasConvertDatatype(b_type),
+                                                           ldb,
+                                                           stride_B,
+                                                           beta,
+                                                           C,
+                                                           hipblasConvertDatatype(c_type),
+                                                           ldc,
+                                                           stride_C,
+                                                           batch_count,
+                                                           hipblasConvertDatatype(compute_type),
+                                                           hipblasConvertGemmAlgo(algo)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedEx_v2(hipblasHandle_t      handle,
+                                               hipblasOperation_t   transa,
+                                               hipblasOperation_t   transb,
+                                               int                  m,
+                                               int                  n,
+                                               int                  k,
+                                               const void*          alpha,
+                                               const void*          A,
+                                               hipDataType          a_type,
+                                               int                  lda,
+                                               hipblasStride        stride_A,
+                                               const void*          B,
+                                               hipDataType          b_type,
+                                               int                  ldb,
+                                               hipblasStride        stride_B,
+                                               const void*          beta,
+                                               void*                C,
+                                               hipDataType          c_type,
+                                               int                  ldc,
+                                               hipblasStride        stride_C,
+                                               int                  batch_count,
+                                               hipblasComputeType_t compute_type,
+                                               hipblasGemmAlgo_t    algo)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  stride_A,
+                  b_type,
+                  ldb,
+                  stride_B,
+                  c_type,
+                  ldc,
+                  stride_C,
+                  batch_count,
+                  compute_type,
+                  algo);
+    hipblasPrefetchGemm(handle,
+                        transa,
+                        transb,
+                        m,
+                        n,
+                        k,
+                        A,
+                        lda,
+                        stride_A,
+                        B,
+                        ldb,
+                        stride_B,
+                        C,
+                        ldc,
+                        stride_C,
+                        batch_count,
+                        hipblasPrefetchTypeSize(a_type),
+                        hipblasPrefetchTypeSize(b_type),
+                        hipblasPrefetchTypeSize(c_type));
+
+    hipblasStatus_t rounded = hipblasRoundedGemmEx(handle,
+                                                   transa,
+                                                   transb,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   A,
+                                                   a_type,
+                                                   lda,
+                                                   stride_A,
+                                                   B,
+                                                   b_type,
+                                                   ldb,
+                                                   stride_B,
+                                                   beta,
+                                                   C,
+                                                   c_type,
+                                                   ldc,
+                                                   stride_C,
+                                                   batch_count,
+                                                   compute_type,
+                                                   algo);
+    if(rounded != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return rounded;
+
+    hipblasStatus_t complex_half = hipblasComplexHalfGemmEx(handle,
+                                                            transa,
+                                                            transb,
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            alpha,
+                                                            A,
+                                                            a_type,
+                                                            lda,
+                                                            stride_A,
+                                                            B,
+                                                            b_type,
+                                                            ldb,
+                                                            stride_B,
+                                                            beta,
+                                                            C,
+                                                            c_type,
+                                                            ldc,
+                                                            stride_C,
+                                                            batch_count,
+                                                            compute_type);
+    if(complex_half != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return complex_half;
+
+    hipblasStatus_t broadcast = hipblasBroadcastGemm(handle,
+                                                     transa,
+                                                     transb,
+                                                     m,
+                                                     n,
+                                                     k,
+                                                     alpha,
+                                                     A,
+                                                     a_type,
+                                                     lda,
+                                                     stride_A,
+                                                     B,
+                                                     b_type,
+                                                     ldb,
+                                                     stride_B,
+                                                     beta,
+                                                     C,
+                                                     c_type,
+                                                     ldc,
+                                                     stride_C,
+                                                     batch_count,
+                                                     compute_type,
+                                                     algo,
+                                                     HIPBLAS_GEMM_FLAGS_NONE);
+    if(broadcast != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return broadcast;
+
+    hipblasStatus_t small = hipblasSmallGemm(handle,
+                                             transa,
+                                             transb,
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             a_type,
+                                             lda,
+                                             stride_A,
+                                             B,
+                                             b_type,
+                                             ldb,
+                                             stride_B,
+                                             beta,
+                                             C,
+                                             c_type,
+                                             ldc,
+                                             stride_C,
+                                             batch_count,
+                                             compute_type,
+                                             false);
+    if(small != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return small;
+
+    hipblasStatus_t lt = hipblasCublasLtRoutedGemmEx(handle,
+                                                     transa,
+                                                     transb,
+                                                     m,
+                                                     n,
+                                                     k,
+                                                     alpha,
+                                                     A,
+                                                     a_type,
+                                                     lda,
+                                                     stride_A,
+                                                     B,
+                                                     b_type,
+                                                     ldb,
+                                                     stride_B,
+                                                     beta,
+                                                     C,
+                                                     c_type,
+                                                     ldc,
+                                                     stride_C,
+                                                     batch_count,
+                                                     compute_type);
+    if(lt != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return lt;
+
+    return hipblasConvertStatus(cublasGemmStridedBatchedEx((cublasHandle_t)handle,
+                                                           hipblasConvertOperation(transa),
+                                                           hipblasConvertOperation(transb),
+                                                           m,
+                                                           n,
+                                                           k,
+                                                           alpha,
+                                                           A,
+                                                           hipblasConvertDatatype_v2(a_type),
+                                                           lda,
+                                                           stride_A,
+                                                           B,
+                                                           hipblasConvertDatatype_v2(b_type),
+                                                           ldb,
+                                                           stride_B,
+                                                           beta,
+                                                           C,
+                                                           hipblasConvertDatatype_v2(c_type),
+                                                           ldc,
+                                                           stride_C,
+                                                           batch_count,
+                                                           hipblasConvertComputeType(compute_type),
+                                                           hipblasConvertGemmAlgo(algo)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExWithFlags_v2(hipblasHandle_t      handle,
+                                                        hipblasOperation_t   transa,
+                                                        hipblasOperation_t   transb,
+                                                        int                  m,
+                                                        int                  n,
+                                                        int                  k,
+                                                        const void*          alpha,
+                                                        const void*          A,
+                                                        hipDataType          a_type,
+                                                        int                  lda,
+                                                        hipblasStride        stride_A,
+                                                        const void*          B,
+                                                        hipDataType          b_type,
+                                                        int                  ldb,
+                                                        hipblasStride        stride_B,
+                                                        const void*          beta,
+                                                        void*                C,
+                                                        hipDataType          c_type,
+                                                        int                  ldc,
+                                                        hipblasStride        stride_C,
+                                                        int                  batch_count,
+                                                        hipblasComputeType_t compute_type,
+                                                        hipblasGemmAlgo_t    algo,
+                                                        hipblasGemmFlags_t   flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  stride_A,
+                  b_type,
+                  ldb,
+                  stride_B,
+                  c_type,
+                  ldc,
+                  stride_C,
+                  batch_count,
+                  compute_type,
+                  algo,
+                  flags);
+
+    hipblasStatus_t broadcast = hipblasBroadcastGemm(handle,
+                                                     transa,
+                                                     transb,
+                                                     m,
+                                                     n,
+                                                     k,
+                                                     alpha,
+                                                     A,
+                                                     a_type,
+                                                     lda,
+                                                     stride_A,
+                                                     B,
+                                                     b_type,
+                                                     ldb,
+                                                     stride_B,
+                                                     beta,
+                                                     C,
+                                                     c_type,
+                                                     ldc,
+                                                     stride_C,
+                                                     batch_count,
+                                                     compute_type,
+                                                     algo,
+                                                     flags);
+    if(broadcast != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return broadcast;
+
+    hipblasStatus_t small = hipblasSmallGemm(handle,
+                                             transa,
+                                             transb,
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             a_type,
+                                             lda,
+                                             stride_A,
+                                             B,
+                                             b_type,
+                                             ldb,
+                                             stride_B,
+                                             beta,
+                                             C,
+                                             c_type,
+                                             ldc,
+                                             stride_C,
+                                             batch_count,
+                                             compute_type,
+                                             false);
+    if(small != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return small;
+
+    // flags are ignored, call original function
+    return hipblasConvertStatus(cublasGemmStridedBatchedEx((cublasHandle_t)handle,
+                                                           hipblasConvertOperation(transa),
+                                                           hipblasConvertOperation(transb),
+                                                           m,
+                                                           n,
+                                                           k,
+                                                           alpha,
+                                                           A,
+                                                           hipblasConvertDatatype_v2(a_type),
+                                                           lda,
+                                                           stride_A,
+                                                           B,
+                                                           hipblasConvertDatatype_v2(b_type),
+                                                           ldb,
+                                                           stride_B,
+                                                           beta,
+                                                           C,
+                                                           hipblasConvertDatatype_v2(c_type),
+                                                           ldc,
+                                                           stride_C,
+                                                           batch_count,
+                                                           hipblasConvertComputeType(compute_type),
+                                                           hipblasConvertGemmAlgo(algo)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+#if CUBLAS_VER_MAJOR < 12
+// cuBLAS 11 has no 64-bit functions, so the 64-bit gemmEx functions are computed by its 32-bit
+// functions on columns of C, slices of k and chunks of the batch of at most hipblas_tile_32. The
+// leading dimensions must fit in 32 bits, which also bounds m. The slices of k after the first
+// accumulate into C with a beta of one, so k can only exceed 32 bits in host pointer mode.
+static const int64_t hipblas_tile_32 = int64_t(1) << 30;
+
+static bool hipblasFitsInt32(int64_t x)
+{
+    return x >= std::numeric_limits<int>::min() && x <= std::numeric_limits<int>::max();
+}
+
+// Writes a one with the type of alpha and beta for compute_type to one, which is zeroed, so
+// that it is also a complex one
+static void hipblasGemmExOne(cublasComputeType_t compute_type, void* one)
+{
+    switch(compute_type)
+    {
+    case CUBLAS_COMPUTE_16F:
+    case CUBLAS_COMPUTE_16F_PEDANTIC:
+    {
+        uint16_t half_one = 0x3c00;
+        memcpy(one, &half_one, sizeof(half_one));
+        break;
+    }
+    case CUBLAS_COMPUTE_64F:
+    case CUBLAS_COMPUTE_64F_PEDANTIC:
+    {
+        double double_one = 1;
+        memcpy(one, &double_one, sizeof(double_one));
+        break;
+    }
+    case CUBLAS_COMPUTE_32I:
+    case CUBLAS_COMPUTE_32I_PEDANTIC:
+    {
+        int32_t int_one = 1;
+        memcpy(one, &int_one, sizeof(int_one));
+        break;
+    }
+    default:
+    {
+        float float_one = 1;
+        memcpy(one, &float_one, sizeof(float_one));
+        break;
+    }
+    }
+}
+
+// gemmEx and gemmStridedBatchedEx with 64-bit sizes, with cublasGemmEx for a batch_count of one
+static cublasStatus_t hipblasCublasGemmExTiled_64(cublasHandle_t      handle,
+                                                  cublasOperation_t   transa,
+                                                  cublasOperation_t   transb,
+                                                  int64_t             m,
+                                                  int64_t             n,
+                                                  int64_t             k,
+                                                  const void*         alpha,
+                                                  const void*         A,
+                                                  cudaDataType_t      a_type,
+                                                  int64_t             lda,
+                                                  long long           stride_A,
+                                                  const void*         B,
+                                                  cudaDataType_t      b_type,
+                                                  int64_t             ldb,
+                                                  long long           stride_B,
+                                                  const void*         beta,
+                                                  void*               C,
+                                                  cudaDataType_t      c_type,
+                                                  int64_t             ldc,
+                                                  long long           stride_C,
+                                                  int64_t             batch_count,
+                                                  cublasComputeType_t compute_type,
+                                                  cublasGemmAlgo_t    algo)
+{
+    auto gemm = [&](int64_t     n_tile,
+                    int64_t     k_tile,
+                    int64_t     batch_tile,
+                    const void* a_tile,
+                    const void* b_tile,
+                    const void* beta_tile,
+                    void*       c_tile) {
+        if(batch_count == 1)
+            return cublasGemmEx(handle,
+                                transa,
+                                transb,
+                                int(m),
+                                int(n_tile),
+                                int(k_tile),
+                                alpha,
+                                a_tile,
+                                a_type,
+                                int(lda),
+                                b_tile,
+                                b_type,
+                                int(ldb),
+                                beta_tile,
+                                c_tile,
+                                c_type,
+                                int(ldc),
+                                compute_type,
+                                algo);
+        return cublasGemmStridedBatchedEx(handle,
+                                          transa,
+                                          transb,
+                                          int(m),
+                                          int(n_tile),
+                                          int(k_tile),
+                                          alpha,
+                                          a_tile,
+                                          a_type,
+                                          int(lda),
+                                          stride_A,
+                                          b_tile,
+                                          b_type,
+                                          int(ldb),
+                                          stride_B,
+                                          beta_tile,
+                                          c_tile,
+                                          c_type,
+                                          int(ldc),
+                                          stride_C,
+                                          int(batch_tile),
+                                          compute_type,
+                                          algo);
+    };
+
+    if(hipblasFitsInt32(m) && hipblasFitsInt32(n) && hipblasFitsInt32(k)
+       && hipblasFitsInt32(lda) && hipblasFitsInt32(ldb) && hipblasFitsInt32(ldc)
+       && hipblasFitsInt32(batch_count))
+        return gemm(n, k, batch_count, A, B, beta, C);
+
+    if(m < 0 || n < 0 || k < 0 || lda < 0 || ldb < 0 || ldc < 0 || batch_count < 0)
+        return CUBLAS_STATUS_INVALID_VALUE;
+    if(!hipblasFitsInt32(m) || !hipblasFitsInt32(lda) || !hipblasFitsInt32(ldb)
+       || !hipblasFitsInt32(ldc))
+        return CUBLAS_STATUS_NOT_SUPPORTED;
+    if(m == 0 || n == 0 || batch_count == 0)
+        return CUBLAS_STATUS_SUCCESS;
+
+    alignas(16) char one[16] = {};
+    if(k > hipblas_tile_32)
+    {
+        cublasPointerMode_t pointer_mode;
+        cublasStatus_t      status = cublasGetPointerMode(handle, &pointer_mode);
+        if(status != CUBLAS_STATUS_SUCCESS)
+            return status;
+        if(pointer_mode != CUBLAS_POINTER_MODE_HOST)
+            return CUBLAS_STATUS_NOT_SUPPORTED;
+        hipblasGemmExOne(compute_type, one);
+    }
+
+    size_t a_size = hipblasDatatypeSize(a_type);
+    size_t b_size = hipblasDatatypeSize(b_type);
+    size_t c_size = hipblasDatatypeSize(c_type);
+    for(int64_t b = 0; b < batch_count; b += hipblas_tile_32)
+    {
+        int64_t batch_tile = std::min(batch_count - b, hipblas_tile_32);
+        for(int64_t j = 0; j < n; j += hipblas_tile_32)
+        {
+            int64_t n_tile = std::min(n - j, hipblas_tile_32);
+            // a k of zero still scales C by beta
+            for(int64_t p = 0; p == 0 || p < k; p += hipblas_tile_32)
+            {
+                int64_t k_tile   = std::min(k - p, hipblas_tile_32);
+                int64_t a_offset = b * stride_A + (transa == CUBLAS_OP_N ? p * lda : p);
+                int64_t b_offset
+                    = b * stride_B + (transb == CUBLAS_OP_N ? j * ldb + p : j + p * ldb);
+                int64_t        c_offset = b * stride_C + j * ldc;
+                cublasStatus_t status   = gemm(n_tile,
+                                             k_tile,
+                                             batch_tile,
+                                             (const char*)A + a_offset * a_size,
+                                             (const char*)B + b_offset * b_size,
+                                             p == 0 ? beta : one,
+                                             (char*)C + c_offset * c_size);
+                if(status != CUBLAS_STATUS_SUCCESS)
+                    return status;
+            }
+        }
+    }
+    return CUBLAS_STATUS_SUCCESS;
+}
+
+// gemmBatchedEx with 64-bit sizes. Only the batch can be split, as the matrices are in device
+// memory.
+static cublasStatus_t hipblasCublasGemmBatchedExChunked_64(cublasHandle_t      handle,
+                                                           cublasOperation_t   transa,
+                                                           cublasOperation_t   transb,
+                                                           int64_t             m,
+                                                           int64_t             n,
+                                                           int64_t             k,
+                                                           const void*         alpha,
+                                                           const void* const   A[],
+                                                           cudaDataType_t      a_type,
+                                                           int64_t             lda,
+                                                           const void* const   B[],
+                                                           cudaDataType_t      b_type,
+                                                           int64_t             ldb,
+                                                           const void*         beta,
+                                                           void* const         C[],
+                                                           cudaDataType_t      c_type,
+                                                           int64_t             ldc,
+                                                           int64_t             batch_count,
+                                                           cublasComputeType_t compute_type,
+                                                           cublasGemmAlgo_t    algo)
+{
+    if(!hipblasFitsInt32(m) || !hipblasFitsInt32(n) || !hipblasFitsInt32(k)
+       || !hipblasFitsInt32(lda) || !hipblasFitsInt32(ldb) || !hipblasFitsInt32(ldc))
+        return m < 0 || n < 0 || k < 0 || lda < 0 || ldb < 0 || ldc < 0
+                   ? CUBLAS_STATUS_INVALID_VALUE
+                   : CUBLAS_STATUS_NOT_SUPPORTED;
+    if(batch_count < 0)
+        return CUBLAS_STATUS_INVALID_VALUE;
+
+    // a batch_count of zero is still passed to cuBLAS, for its checks of the other arguments
+    for(int64_t b = 0; b == 0 || b < batch_count; b += hipblas_tile_32)
+    {
+        cublasStatus_t status = cublasGemmBatchedEx(handle,
+                                                    transa,
+                                                    transb,
+                                                    int(m),
+                                                    int(n),
+                                                    int(k),
+                                                    alpha,
+                                                    A + b,
+                                                    a_type,
+                                                    int(lda),
+                                                    B + b,
+                                                    b_type,
+                                                    int(ldb),
+                                                    beta,
+                                                    C + b,
+                                                    c_type,
+                                                    int(ldc),
+                                                    int(std::min(batch_count - b, hipblas_tile_32)),
+                                                    compute_type,
+                                                    algo);
+        if(status != CUBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    return CUBLAS_STATUS_SUCCESS;
+}
+#endif
+
+// gemm_ex
+hipblasStatus_t hipblasGemmEx_64(hipblasHandle_t    handle,
+                                 hipblasOperation_t transa,
+                                 hipblasOperation_t transb,
+                                 int64_t            m,
+                                 int64_t            n,
+                                 int64_t            k,
+                                 const void*        alpha,
+                                 const void*        A,
+                                 hipblasDatatype_t  a_type,
+                                 int64_t            lda,
+                                 const void*        B,
+                                 hipblasDatatype_t  b_type,
+                                 int64_t            ldb,
+                                 const void*        beta,
+                                 void*              C,
+                                 hipblasDatatype_t  c_type,
+                                 int64_t            ldc,
+                                 hipblasDatatype_t  compute_type,
+                                 hipblasGemmAlgo_t  algo)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, transa, transb, m, n, k, a_type, lda, b_type, ldb, c_type, ldc, compute_type, algo);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasGemmEx_64((cublasHandle_t)handle,
+                                                hipblasConvertOperation(transa),
+                                                hipblasConvertOperation(transb),
+                                                m,
+                                                n,
+                                                k,
+                                                alpha,
+                                                A,
+                                                hipblasConvertDatatype(a_type),
+                                                lda,
+                                                B,
+                                                hipblasConvertDatatype(b_type),
+                                                ldb,
+                                                beta,
+                                                C,
+                                                hipblasConvertDatatype(c_type),
+                                                ldc,
+                                                hipblasConvertComputeDatatype(compute_type),
+                                                hipblasConvertGemmAlgo(algo)));
+#else
+    return hipblasConvertStatus(
+        hipblasCublasGemmExTiled_64((cublasHandle_t)handle,
+                                    hipblasConvertOperation(transa),
+                                    hipblasConvertOperation(transb),
+                                    m,
+                                    n,
+                                    k,
+                                    alpha,
+                                    A,
+                                    hipblasConvertDatatype(a_type),
+                                    lda,
+                                    0,
+                                    B,
+                                    hipblasConvertDatatype(b_type),
+                                    ldb,
+                                    0,
+                                    beta,
+                                    C,
+                                    hipblasConvertDatatype(c_type),
+                                    ldc,
+                                    0,
+                                    1,
+                                    hipblasConvertComputeDatatype(compute_type),
+                                    hipblasConvertGemmAlgo(algo)));
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmExWithFlags_64(hipblasHandle_t    handle,
+                                          hipblasOperation_t transa,
+                                          hipblasOperation_t transb,
+                                          int64_t            m,
+                                          int64_t            n,
+                                          int64_t            k,
+                                          const void*        alpha,
+                                          const void*        A,
+                                          hipblasDatatype_t  a_type,
+                                          int64_t            lda,
+                                          const void*        B,
+                                          hipblasDatatype_t  b_type,
+                                          int64_t            ldb,
+                                          const void*        beta,
+                                          void*              C,
+                                          hipblasDatatype_t  c_type,
+                                          int64_t            ldc,
+                                          hipblasDatatype_t  compute_type,
+                                          hipblasGemmAlgo_t  algo,
+                                          hipblasGemmFlags_t flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  compute_type,
+                  algo,
+                  flags);
+
+#if CUBLAS_VER_MAJOR >= 12
+    // flags are ignored, call original function
+    return hipblasConvertStatus(cublasGemmEx_64((cublasHandle_t)handle,
+                                                hipblasConvertOperation(transa),
+                                                hipblasConvertOperation(transb),
+                                                m,
+                                                n,
+                                                k,
+                                                alpha,
+                                                A,
+                                                hipblasConvertDatatype(a_type),
+                                                lda,
+                                                B,
+                                                hipblasConvertDatatype(b_type),
+                                                ldb,
+                                                beta,
+                                                C,
+                                                hipblasConvertDatatype(c_type),
+                                                ldc,
+                                                hipblasConvertComputeDatatype(compute_type),
+                                                hipblasConvertGemmAlgo(algo)));
+#else
+    return hipblasConvertStatus(
+        hipblasCublasGemmExTiled_64((cublasHandle_t)handle,
+                                    hipblasConvertOperation(transa),
+                                    hipblasConvertOperation(transb),
+                                    m,
+                                    n,
+                                    k,
+                                    alpha,
+                                    A,
+                                    hipblasConvertDatatype(a_type),
+                                    lda,
+                                    0,
+                                    B,
+                                    hipblasConvertDatatype(b_type),
+                                    ldb,
+                                    0,
+                                    beta,
+                                    C,
+                                    hipblasConvertDatatype(c_type),
+                                    ldc,
+                                    0,
+                                    1,
+                                    hipblasConvertComputeDatatype(compute_type),
+                                    hipblasConvertGemmAlgo(algo)));
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmEx_v2_64(hipblasHandle_t      handle,
+                                    hipblasOperation_t   transa,
+                                    hipblasOperation_t   transb,
+                                    int64_t              m,
+                                    int64_t              n,
+                                    int64_t              k,
+                                    const void*          alpha,
+                                    const void*          A,
+                                    hipDataType          a_type,
+                                    int64_t              lda,
+                                    const void*          B,
+                                    hipDataType          b_type,
+                                    int64_t              ldb,
+                                    const void*          beta,
+                                    void*                C,
+                                    hipDataType          c_type,
+                                    int64_t              ldc,
+                                    hipblasComputeType_t compute_type,
+                                    hipblasGemmAlgo_t    algo)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, transa, transb, m, n, k, a_type, lda, b_type, ldb, c_type, ldc, compute_type, algo);
+    hipblasPrefetchGemm(handle,
+                        transa,
+                        transb,
+                        m,
+                        n,
+                        k,
+                        A,
+                        lda,
+                        0,
+                        B,
+                        ldb,
+                        0,
+                        C,
+                        ldc,
+                        0,
+                        1,
+                        hipblasPrefetchTypeSize(a_type),
+                        hipblasPrefetchTypeSize(b_type),
+                        hipblasPrefetchTypeSize(c_type));
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasGemmEx_64((cublasHandle_t)handle,
+                                                hipblasConvertOperation(transa),
+                                                hipblasConvertOperation(transb),
+                                                m,
+                                                n,
+                                                k,
+                                                alpha,
+                                                A,
+                                                hipblasConvertDatatype_v2(a_type),
+                                                lda,
+                                                B,
+                                                hipblasConvertDatatype_v2(b_type),
+                                                ldb,
+                                                beta,
+                                                C,
+                                                hipblasConvertDatatype_v2(c_type),
+                                                ldc,
+                                                hipblasConvertComputeType(compute_type),
+                                                hipblasConvertGemmAlgo(algo)));
+#else
+    return hipblasConvertStatus(hipblasCublasGemmExTiled_64((cublasHandle_t)handle,
+                                                            hipblasConvertOperation(transa),
+                                                            hipblasConvertOperation(transb),
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            alpha,
+                                                            A,
+                                                            hipblasConvertDatatype_v2(a_type),
+                                                            lda,
+                                                            0,
+                                                            B,
+                                                            hipblasConvertDatatype_v2(b_type),
+                                                            ldb,
+                                                            0,
+                                                            beta,
+                                                            C,
+                                                            hipblasConvertDatatype_v2(c_type),
+                                                            ldc,
+                                                            0,
+                                                            1,
+                                                            hipblasConvertComputeType(compute_type),
+                                                            hipblasConvertGemmAlgo(algo)));
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmExWithFlags_v2_64(hipblasHandle_t      handle,
+                                             hipblasOperation_t   transa,
+                                             hipblasOperation_t   transb,
+                                             int64_t              m,
+                                             int64_t              n,
+                                             int64_t              k,
+                                             const void*          alpha,
+                                             const void*          A,
+                                             hipDataType          a_type,
+                                             int64_t              lda,
+                                             const void*          B,
+                                             hipDataType          b_type,
+                                             int64_t              ldb,
+                                             const void*          beta,
+                                             void*                C,
+                                             hipDataType          c_type,
+                                             int64_t              ldc,
+                                             hipblasComputeType_t compute_type,
+                                             hipblasGemmAlgo_t    algo,
+                                             hipblasGemmFlags_t   flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  compute_type,
+                  algo,
+                  flags);
+
+#if CUBLAS_VER_MAJOR >= 12
+    // flags are ignored, call original function
+    return hipblasConvertStatus(cublasGemmEx_64((cublasHandle_t)handle,
+                                                hipblasConvertOperation(transa),
+                                                hipblasConvertOperation(transb),
+                                                m,
+                                                n,
+                                                k,
+                                                alpha,
+                                                A,
+                                                hipblasConvertDatatype_v2(a_type),
+                                                lda,
+                                                B,
+                                                hipblasConvertDatatype_v2(b_type),
+                                                ldb,
+                                                beta,
+                                                C,
+                                                hipblasConvertDatatype_v2(c_type),
+                                                ldc,
+                                                hipblasConvertComputeType(compute_type),
+                                                hipblasConvertGemmAlgo(algo)));
+#else
+    return hipblasConvertStatus(hipblasCublasGemmExTiled_64((cublasHandle_t)handle,
+                                                            hipblasConvertOperation(transa),
+                                                            hipblasConvertOperation(transb),
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            alpha,
+                                                            A,
+                                                            hipblasConvertDatatype_v2(a_type),
+                                                            lda,
+                                                            0,
+                                                            B,
+                                                            hipblasConvertDatatype_v2(b_type),
+                                                            ldb,
+                                                            0,
+                                                            beta,
+                                                            C,
+                                                            hipblasConvertDatatype_v2(c_type),
+                                                            ldc,
+                                                            0,
+                                                            1,
+                                                            hipblasConvertComputeType(compute_type),
+                                                            hipblasConvertGemmAlgo(algo)));
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedEx_64(hipblasHandle_t    handle,
+                                        hipblasOperation_t transa,
+                                        hipblasOperation_t transb,
+                                        int64_t            m,
+                                        int64_t            n,
+                                        int64_t            k,
+                                        const void*        alpha,
+                                        const void*        A[],
+                                        hipblasDatatype_t  a_type,
+                                        int64_t            lda,
+                                        const void*        B[],
+                                        hipblasDatatype_t  b_type,
+                                        int64_t            ldb,
+                                        const void*        beta,
+                                        void*              C[],
+                                        hipblasDatatype_t  c_type,
+                                        int64_t            ldc,
+                                        int64_t            batch_count,
+                                        hipblasDatatype_t  compute_type,
+                                        hipblasGemmAlgo_t  algo)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  batch_count,
+                  compute_type,
+                  algo);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasGemmBatchedEx_64((cublasHandle_t)handle,
+                                                       hipblasConvertOperation(transa),
+                                                       hipblasConvertOperation(transb),
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       A,
+                                                       hipblasConvertDatatype(a_type),
+                                                       lda,
+                                                       B,
+                                                       hipblasConvertDatatype(b_type),
+                                                       ldb,
+                                                       beta,
+                                                       C,
+                                                       hipblasConvertDatatype(c_type),
+                                                       ldc,
+                                                       batch_count,
+                                                       hipblasConvertComputeDatatype(compute_type),
+                                                       hipblasConvertGemmAlgo(algo)));
+#else
+    return hipblasConvertStatus(
+        hipblasCublasGemmBatchedExChunked_64((cublasHandle_t)handle,
+                                             hipblasConvertOperation(transa),
+                                             hipblasConvertOperation(transb),
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             hipblasConvertDatatype(a_type),
+                                             lda,
+                                             B,
+                                             hipblasConvertDatatype(b_type),
+                                             ldb,
+                                             beta,
+                                             C,
+                                             hipblasConvertDatatype(c_type),
+                                             ldc,
+                                             batch_count,
+                                             hipblasConvertComputeDatatype(compute_type),
+                                             hipblasConvertGemmAlgo(algo)));
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedExWithFlags_64(hipblasHandle_t    handle,
+                                                 hipblasOperation_t transa,
+                                                 hipblasOperation_t transb,
+                                                 int64_t            m,
+                                                 int64_t            n,
+                                                 int64_t            k,
+                                                 const void*        alpha,
+                                                 const void*        A[],
+                                                 hipblasDatatype_t  a_type,
+                                                 int64_t            lda,
+                                                 const void*        B[],
+                                                 hipblasDatatype_t  b_type,
+                                                 int64_t            ldb,
+                                                 const void*        beta,
+                                                 void*              C[],
+                                                 hipblasDatatype_t  c_type,
+                                                 int64_t            ldc,
+                                                 int64_t            batch_count,
+                                                 hipblasDatatype_t  compute_type,
+                                                 hipblasGemmAlgo_t  algo,
+                                                 hipblasGemmFlags_t flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  batch_count,
+                  compute_type,
+                  algo,
+                  flags);
+
+#if CUBLAS_VER_MAJOR >= 12
+    // flags are ignored, call original function
+    return hipblasConvertStatus(cublasGemmBatchedEx_64((cublasHandle_t)handle,
+                                                       hipblasConvertOperation(transa),
+                                                       hipblasConvertOperation(transb),
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       A,
+                                                       hipblasConvertDatatype(a_type),
+                                                       lda,
+                                                       B,
+                                                       hipblasConvertDatatype(b_type),
+                                                       ldb,
+                                                       beta,
+                                                       C,
+                                                       hipblasConvertDatatype(c_type),
+                                                       ldc,
+                                                       batch_count,
+                                                       hipblasConvertComputeDatatype(compute_type),
+                                                       hipblasConvertGemmAlgo(algo)));
+#else
+    return hipblasConvertStatus(
+        hipblasCublasGemmBatchedExChunked_64((cublasHandle_t)handle,
+                                             hipblasConvertOperation(transa),
+                                             hipblasConvertOperation(transb),
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             hipblasConvertDatatype(a_type),
+                                             lda,
+                                             B,
+                                             hipblasConvertDatatype(b_type),
+                                             ldb,
+                                             beta,
+                                             C,
+                                             hipblasConvertDatatype(c_type),
+                                             ldc,
+                                             batch_count,
+                                             hipblasConvertComputeDatatype(compute_type),
+                                             hipblasConvertGemmAlgo(algo)));
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedEx_v2_64(hipblasHandle_t      handle,
+                                           hipblasOperation_t   transa,
+                                           hipblasOperation_t   transb,
+                                           int64_t              m,
+                                           int64_t              n,
+                                           int64_t              k,
+                                           const void*          alpha,
+                                           const void*          A[],
+                                           hipDataType          a_type,
+                                           int64_t              lda,
+                                           const void*          B[],
+                                           hipDataType          b_type,
+                                           int64_t              ldb,
+                                           const void*          beta,
+                                           void*                C[],
+                                           hipDataType          c_type,
+                                           int64_t              ldc,
+                                           int64_t              batch_count,
+                                           hipblasComputeType_t compute_type,
+                                           hipblasGemmAlgo_t    algo)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  batch_count,
+                  compute_type,
+                  algo);
+
+    hipblasStatus_t small = hipblasSmallGemm(handle,
+                                             transa,
+                                             transb,
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             a_type,
+                                             lda,
+                                             0,
+                                             B,
+                                             b_type,
+                                             ldb,
+                                             0,
+                                             beta,
+                                             C,
+                                             c_type,
+                                             ldc,
+                                             0,
+                                             batch_count,
+                                             compute_type,
+                                             true);
+    if(small != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return small;
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasGemmBatchedEx_64((cublasHandle_t)handle,
+                                                       hipblasConvertOperation(transa),
+                                                       hipblasConvertOperation(transb),
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       A,
+                                                       hipblasConvertDatatype_v2(a_type),
+                                                       lda,
+                                                       B,
+                                                       hipblasConvertDatatype_v2(b_type),
+                                                       ldb,
+                                                       beta,
+                                                       C,
+                                                       hipblasConvertDatatype_v2(c_type),
+                                                       ldc,
+                                                       batch_count,
+                                                       hipblasConvertComputeType(compute_type),
+                                                       hipblasConvertGemmAlgo(algo)));
+#else
+    return hipblasConvertStatus(
+        hipblasCublasGemmBatchedExChunked_64((cublasHandle_t)handle,
+                                             hipblasConvertOperation(transa),
+                                             hipblasConvertOperation(transb),
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             hipblasConvertDatatype_v2(a_type),
+                                             lda,
+                                             B,
+                                             hipblasConvertDatatype_v2(b_type),
+                                             ldb,
+                                             beta,
+                                             C,
+                                             hipblasConvertDatatype_v2(c_type),
+                                             ldc,
+                                             batch_count,
+                                             hipblasConvertComputeType(compute_type),
+                                             hipblasConvertGemmAlgo(algo)));
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedExWithFlags_v2_64(hipblasHandle_t      handle,
+                                                    hipblasOperation_t   transa,
+                                                    hipblasOperation_t   transb,
+                                                    int64_t              m,
+                                                    int64_t              n,
+                                                    int64_t              k,
+                                                    const void*          alpha,
+                                                    const void*          A[],
+                                                    hipDataType          a_type,
+                                                    int64_t              lda,
+                                                    const void*          B[],
+                                                    hipDataType          b_type,
+                                                    int64_t              ldb,
+                                                    const void*          beta,
+                                                    void*                C[],
+                                                    hipDataType          c_type,
+                                                    int64_t              ldc,
+                                                    int64_t              batch_count,
+                                                    hipblasComputeType_t compute_type,
+                                                    hipblasGemmAlgo_t    algo,
+                                                    hipblasGemmFlags_t   flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  batch_count,
+                  compute_type,
+                  algo,
+                  flags);
+
+    hipblasStatus_t small = hipblasSmallGemm(handle,
+                                             transa,
+                                             transb,
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             a_type,
+                                             lda,
+                                             0,
+                                             B,
+                                             b_type,
+                                             ldb,
+                                             0,
+                                             beta,
+                                             C,
+                                             c_type,
+                                             ldc,
+                                             0,
+                                             batch_count,
+                                             compute_type,
+                                             true);
+    if(small != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return small;
+
+#if CUBLAS_VER_MAJOR >= 12
+    // flags are ignored, call original function
+    return hipblasConvertStatus(cublasGemmBatchedEx_64((cublasHandle_t)handle,
+                                                       hipblasConvertOperation(transa),
+                                                       hipblasConvertOperation(transb),
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       A,
+                                                       hipblasConvertDatatype_v2(a_type),
+                                                       lda,
+                                                       B,
+                                                       hipblasConvertDatatype_v2(b_type),
+                                                       ldb,
+                                                       beta,
+                                                       C,
+                                                       hipblasConvertDatatype_v2(c_type),
+                                                       ldc,
+                                                       batch_count,
+                                                       hipblasConvertComputeType(compute_type),
+                                                       hipblasConvertGemmAlgo(algo)));
+#else
+    return hipblasConvertStatus(
+        hipblasCublasGemmBatchedExChunked_64((cublasHandle_t)handle,
+                                             hipblasConvertOperation(transa),
+                                             hipblasConvertOperation(transb),
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             hipblasConvertDatatype_v2(a_type),
+                                             lda,
+                                             B,
+                                             hipblasConvertDatatype_v2(b_type),
+                                             ldb,
+                                             beta,
+                                             C,
+                                             hipblasConvertDatatype_v2(c_type),
+                                             ldc,
+                                             batch_count,
+                                             hipblasConvertComputeType(compute_type),
+                                             hipblasConvertGemmAlgo(algo)));
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedEx_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t transa,
+                                               hipblasOperation_t transb,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const void*        alpha,
+                                               const void*        A,
+                                               hipblasDatatype_t  a_type,
+                                               int64_t            lda,
+                                               hipblasStride      stride_A,
+                                               const void*        B,
+                                               hipblasDatatype_t  b_type,
+                                               int64_t            ldb,
+                                               hipblasStride      stride_B,
+                                               const void*        beta,
+                                               void*              C,
+                                               hipblasDatatype_t  c_type,
+                                               int64_t            ldc,
+                                               hipblasStride      stride_C,
+                                               int64_t            batch_count,
+                                               hipblasDatatype_t  compute_type,
+                                               hipblasGemmAlgo_t  algo)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  stride_A,
+                  b_type,
+                  ldb,
+                  stride_B,
+                  c_type,
+                  ldc,
+                  stride_C,
+                  batch_count,
+                  compute_type,
+                  algo);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasGemmStridedBatchedEx_64((cublasHandle_t)handle,
+                                      hipblasConvertOperation(transa),
+                                      hipblasConvertOperation(transb),
+                                      m,
+                                      n,
+                                      k,
+                                      alpha,
+                                      A,
+                                      hipblasConvertDatatype(a_type),
+                                      lda,
+                                      stride_A,
+                                      B,
+                                      hipblasConvertDatatype(b_type),
+                                      ldb,
+                                      stride_B,
+                                      beta,
+                                      C,
+                                      hipblasConvertDatatype(c_type),
+                                      ldc,
+                                      stride_C,
+                                      batch_count,
+                                      hipblasConvertComputeDatatype(compute_type),
+                                      hipblasConvertGemmAlgo(algo)));
+#else
+    return hipblasConvertStatus(
+        hipblasCublasGemmExTiled_64((cublasHandle_t)handle,
+                                    hipblasConvertOperation(transa),
+                                    hipblasConvertOperation(transb),
+                                    m,
+                                    n,
+                                    k,
+                                    alpha,
+                                    A,
+                                    hipblasConvertDatatype(a_type),
+                                    lda,
+                                    stride_A,
+                                    B,
+                                    hipblasConvertDatatype(b_type),
+                                    ldb,
+                                    stride_B,
+                                    beta,
+                                    C,
+                                    hipblasConvertDatatype(c_type),
+                                    ldc,
+                                    stride_C,
+                                    batch_count,
+                                    hipblasConvertComputeDatatype(compute_type),
+                                    hipblasConvertGemmAlgo(algo)));
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExWithFlags_64(hipblasHandle_t    handle,
+                                                        hipblasOperation_t transa,
+                                                        hipblasOperation_t transb,
+                                                        int64_t            m,
+                                                        int64_t            n,
+                                                        int64_t            k,
+                                                        const void*        alpha,
+                                                        const void*        A,
+                                                        hipblasDatatype_t  a_type,
+                                                        int64_t            lda,
+                                                        hipblasStride      stride_A,
+                                                        const void*        B,
+                                                        hipblasDatatype_t  b_type,
+                                                        int64_t            ldb,
+                                                        hipblasStride      stride_B,
+                                                        const void*        beta,
+                                                        void*              C,
+                                                        hipblasDatatype_t  c_type,
+                                                        int64_t            ldc,
+                                                        hipblasStride      stride_C,
+                                                        int64_t            batch_count,
+                                                        hipblasDatatype_t  compute_type,
+                                                        hipblasGemmAlgo_t  algo,
+                                                        hipblasGemmFlags_t flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  stride_A,
+                  b_type,
+                  ldb,
+                  stride_B,
+                  c_type,
+                  ldc,
+                  stride_C,
+                  batch_count,
+                  compute_type,
+                  algo,
+                  flags);
+
+#if CUBLAS_VER_MAJOR >= 12
+    // flags are ignored, call original function
+    return hipblasConvertStatus(
+        cublasGemmStridedBatchedEx_64((cublasHandle_t)handle,
+                                      hipblasConvertOperation(transa),
+                                      hipblasConvertOperation(transb),
+                                      m,
+                                      n,
+                                      k,
+                                      alpha,
+                                      A,
+                                      hipblasConvertDatatype(a_type),
+                                      lda,
+                                      stride_A,
+                                      B,
+                                      hipblasConvertDatatype(b_type),
+                                      ldb,
+                                      stride_B,
+                                      beta,
+                                      C,
+                                      hipblasConvertDatatype(c_type),
+                                      ldc,
+                                      stride_C,
+                                      batch_count,
+                                      hipblasConvertComputeDatatype(compute_type),
+                                      hipblasConvertGemmAlgo(algo)));
+#else
+    return hipblasConvertStatus(
+        hipblasCublasGemmExTiled_64((cublasHandle_t)handle,
+                                    hipblasConvertOperation(transa),
+                                    hipblasConvertOperation(transb),
+                                    m,
+                                    n,
+                                    k,
+                                    alpha,
+                                    A,
+                                    hipblasConvertDatatype(a_type),
+                                    lda,
+                                    stride_A,
+                                    B,
+                                    hipblasConvertDatatype(b_type),
+                                    ldb,
+                                    stride_B,
+                                    beta,
+                                    C,
+                                    hipblasConvertDatatype(c_type),
+                                    ldc,
+                                    stride_C,
+                                    batch_count,
+                                    hipblasConvertComputeDatatype(compute_type),
+                                    hipblasConvertGemmAlgo(algo)));
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedEx_v2_64(hipblasHandle_t      handle,
+                                                  hipblasOperation_t   transa,
+                                                  hipblasOperation_t   transb,
+                                                  int64_t              m,
+                                                  int64_t              n,
+                                                  int64_t              k,
+                                                  const void*          alpha,
+                                                  const void*          A,
+                                                  hipDataType          a_type,
+                                                  int64_t              lda,
+                                                  hipblasStride        stride_A,
+                                                  const void*          B,
+                                                  hipDataType          b_type,
+                                                  int64_t              ldb,
+                                                  hipblasStride        stride_B,
+                                                  const void*          beta,
+                                                  void*                C,
+                                                  hipDataType          c_type,
+                                                  int64_t              ldc,
+                                                  hipblasStride        stride_C,
+                                                  int64_t              batch_count,
+                                                  hipblasComputeType_t compute_type,
+                                                  hipblasGemmAlgo_t    algo)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  stride_A,
+                  b_type,
+                  ldb,
+                  stride_B,
+                  c_type,
+                  ldc,
+                  stride_C,
+                  batch_count,
+                  compute_type,
+                  algo);
+    hipblasPrefetchGemm(handle,
+                        transa,
+                        transb,
+                        m,
+                        n,
+                        k,
+                        A,
+                        lda,
+                        stride_A,
+                        B,
+                        ldb,
+                        stride_B,
+                        C,
+                        ldc,
+                        stride_C,
+                        batch_count,
+                        hipblasPrefetchTypeSize(a_type),
+                        hipblasPrefetchTypeSize(b_type),
+                        hipblasPrefetchTypeSize(c_type));
+
+    hipblasStatus_t broadcast = hipblasBroadcastGemm(handle,
+                                                     transa,
+                                                     transb,
+                                                     m,
+                                                     n,
+                                                     k,
+                                                     alpha,
+                                                     A,
+                                                     a_type,
+                                                     lda,
+                                                     stride_A,
+                                                     B,
+                                                     b_type,
+                                                     ldb,
+                                                     stride_B,
+                                                     beta,
+                                                     C,
+                                                     c_type,
+                                                     ldc,
+                                                     stride_C,
+                                                     batch_count,
+                                                     compute_type,
+                                                     algo,
+                                                     HIPBLAS_GEMM_FLAGS_NONE);
+    if(broadcast != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return broadcast;
+
+    hipblasStatus_t small = hipblasSmallGemm(handle,
+                                             transa,
+                                             transb,
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             a_type,
+                                             lda,
+                                             stride_A,
+                                             B,
+                                             b_type,
+                                             ldb,
+                                             stride_B,
+                                             beta,
+                                             C,
+                                             c_type,
+                                             ldc,
+                                             stride_C,
+                                             batch_count,
+                                             compute_type,
+                                             false);
+    if(small != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return small;
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(
+        cublasGemmStridedBatchedEx_64((cublasHandle_t)handle,
+                                      hipblasConvertOperation(transa),
+                                      hipblasConvertOperation(transb),
+                                      m,
+                                      n,
+                                      k,
+                                      alpha,
+                                      A,
+                                      hipblasConvertDatatype_v2(a_type),
+                                      lda,
+                                      stride_A,
+                                      B,
+                                      hipblasConvertDatatype_v2(b_type),
+                                      ldb,
+                                      stride_B,
+                                      beta,
+                                      C,
+                                      hipblasConvertDatatype_v2(c_type),
+                                      ldc,
+                                      stride_C,
+                                      batch_count,
+                                      hipblasConvertComputeType(compute_type),
+                                      hipblasConvertGemmAlgo(algo)));
+#else
+    return hipblasConvertStatus(hipblasCublasGemmExTiled_64((cublasHandle_t)handle,
+                                                            hipblasConvertOperation(transa),
+                                                            hipblasConvertOperation(transb),
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            alpha,
+                                                            A,
+                                                            hipblasConvertDatatype_v2(a_type),
+                                                            lda,
+                                                            stride_A,
+                                                            B,
+                                                            hipblasConvertDatatype_v2(b_type),
+                                                            ldb,
+                                                            stride_B,
+                                                            beta,
+                                                            C,
+                                                            hipblasConvertDatatype_v2(c_type),
+                                                            ldc,
+                                                            stride_C,
+                                                            batch_count,
+                                                            hipblasConvertComputeType(compute_type),
+                                                            hipblasConvertGemmAlgo(algo)));
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExWithFlags_v2_64(hipblasHandle_t      handle,
+                                                           hipblasOperation_t   transa,
+                                                           hipblasOperation_t   transb,
+                                                           int64_t              m,
+                                                           int64_t              n,
+                                                           int64_t              k,
+                                                           const void*          alpha,
+                                                           const void*          A,
+                                                           hipDataType          a_type,
+                                                           int64_t              lda,
+                                                           hipblasStride        stride_A,
+                                                           const void*          B,
+                                                           hipDataType          b_type,
+                                                           int64_t              ldb,
+                                                           hipblasStride        stride_B,
+                                                           const void*          beta,
+                                                           void*                C,
+                                                           hipDataType          c_type,
+                                                           int64_t              ldc,
+                                                           hipblasStride        stride_C,
+                                                           int64_t              batch_count,
+                                                           hipblasComputeType_t compute_type,
+                                                           hipblasGemmAlgo_t    algo,
+                                                           hipblasGemmFlags_t   flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  stride_A,
+                  b_type,
+                  ldb,
+                  stride_B,
+                  c_type,
+                  ldc,
+                  stride_C,
+                  batch_count,
+                  compute_type,
+                  algo,
+                  flags);
+
+    hipblasStatus_t broadcast = hipblasBroadcastGemm(handle,
+                                                     transa,
+                                                     transb,
+                                                     m,
+                                                     n,
+                                                     k,
+                                                     alpha,
+                                                     A,
+                                                     a_type,
+                                                     lda,
+                                                     stride_A,
+                                                     B,
+                                                     b_type,
+                                                     ldb,
+                                                     stride_B,
+                                                     beta,
+                                                     C,
+                                                     c_type,
+                                                     ldc,
+                                                     stride_C,
+                                                     batch_count,
+                                                     compute_type,
+                                                     algo,
+                                                     flags);
+    if(broadcast != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return broadcast;
+
+    hipblasStatus_t small = hipblasSmallGemm(handle,
+                                             transa,
+                                             transb,
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             a_type,
+                                             lda,
+                                             stride_A,
+                                             B,
+                                             b_type,
+                                             ldb,
+                                             stride_B,
+                                             beta,
+                                             C,
+                                             c_type,
+                                             ldc,
+                                             stride_C,
+                                             batch_count,
+                                             compute_type,
+                                             false);
+    if(small != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return small;
+
+#if CUBLAS_VER_MAJOR >= 12
+    // flags are ignored, call original function
+    return hipblasConvertStatus(
+        cublasGemmStridedBatchedEx_64((cublasHandle_t)handle,
+                                      hipblasConvertOperation(transa),
+                                      hipblasConvertOperation(transb),
+                                      m,
+                                      n,
+                                      k,
+                                      alpha,
+                                      A,
+                                      hipblasConvertDatatype_v2(a_type),
+                                      lda,
+                                      stride_A,
+                                      B,
+                                      hipblasConvertDatatype_v2(b_type),
+                                      ldb,
+                                      stride_B,
+                                      beta,
+                                      C,
+                                      hipblasConvertDatatype_v2(c_type),
+                                      ldc,
+                                      stride_C,
+                                      batch_count,
+                                      hipblasConvertComputeType(compute_type),
+                                      hipblasConvertGemmAlgo(algo)));
+#else
+    return hipblasConvertStatus(hipblasCublasGemmExTiled_64((cublasHandle_t)handle,
+                                                            hipblasConvertOperation(transa),
+                                                            hipblasConvertOperation(transb),
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            alpha,
+                                                            A,
+                                                            hipblasConvertDatatype_v2(a_type),
+                                                            lda,
+                                                            stride_A,
+                                                            B,
+                                                            hipblasConvertDatatype_v2(b_type),
+                                                            ldb,
+                                                            stride_B,
+                                                            beta,
+                                                            C,
+                                                            hipblasConvertDatatype_v2(c_type),
+                                                            ldc,
+                                                            stride_C,
+                                                            batch_count,
+                                                            hipblasConvertComputeType(compute_type),
+                                                            hipblasConvertGemmAlgo(algo)));
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// cublasGemmEx algorithms reported as solutions, default first
+static hipblasStatus_t hipblasGetCublasGemmAlgos(int* solution_list, int* solution_count)
+{
+    constexpr int num_algo        = 24;
+    constexpr int num_tensor_algo = 16;
+    constexpr int num_solutions   = 1 + num_algo + num_tensor_algo;
+
+    if(!solution_count)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    if(!solution_list)
+    {
+        *solution_count = num_solutions;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    if(*solution_count <= 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int count = *solution_count < num_solutions ? *solution_count : num_solutions;
+    for(int i = 0; i < count; i++)
+    {
+        if(i == 0)
+            solution_list[i] = CUBLAS_GEMM_DEFAULT;
+        else if(i <= num_algo)
+            solution_list[i] = CUBLAS_GEMM_ALGO0 + (i - 1);
+        else
+            solution_list[i] = CUBLAS_GEMM_ALGO0_TENSOR_OP + (i - 1 - num_algo);
+    }
+    *solution_count = count;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasGemmExGetSolutions(hipblasHandle_t      handle,
+                                          hipblasOperation_t   transa,
+                                          hipblasOperation_t   transb,
+                                          int                  m,
+                                          int                  n,
+                                          int                  k,
+                                          const void*          alpha,
+                                          const void*          A,
+                                          hipDataType          a_type,
+                                          int                  lda,
+                                          const void*          B,
+                                          hipDataType          b_type,
+                                          int                  ldb,
+                                          const void*          beta,
+                                          void*                C,
+                                          hipDataType          c_type,
+                                          int                  ldc,
+                                          hipblasComputeType_t compute_type,
+                                          hipblasGemmFlags_t   flags,
+                                          int*                 solution_list,
+                                          int*                 solution_count)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    // validate enums, the algorithm list itself doesn't depend on the problem
+    hipblasConvertOperation(transa);
+    hipblasConvertOperation(transb);
+    hipblasConvertDatatype_v2(a_type);
+    hipblasConvertDatatype_v2(b_type);
+    hipblasConvertDatatype_v2(c_type);
+    hipblasConvertComputeType(compute_type);
+
+    if(m < 0 || n < 0 || k < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGetCublasGemmAlgos(solution_list, solution_count);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmExWithSolution(hipblasHandle_t      handle,
+                                          hipblasOperation_t   transa,
+                                          hipblasOperation_t   transb,
+                                          int                  m,
+                                          int                  n,
+                                          int                  k,
+                                          const void*          alpha,
+                                          const void*          A,
+                                          hipDataType          a_type,
+                                          int                  lda,
+                                          const void*          B,
+                                          hipDataType          b_type,
+                                          int                  ldb,
+                                          const void*          beta,
+                                          void*                C,
+                                          hipDataType          c_type,
+                                          int                  ldc,
+                                          hipblasComputeType_t compute_type,
+                                          hipblasGemmFlags_t   flags,
+                                          int                  solution_index)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  compute_type,
+                  flags,
+                  solution_index);
+
+    return hipblasConvertStatus(cublasGemmEx((cublasHandle_t)handle,
+                                             hipblasConvertOperation(transa),
+                                             hipblasConvertOperation(transb),
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             hipblasConvertDatatype_v2(a_type),
+                                             lda,
+                                             B,
+                                             hipblasConvertDatatype_v2(b_type),
+                                             ldb,
+                                             beta,
+                                             C,
+                                             hipblasConvertDatatype_v2(c_type),
+                                             ldc,
+                                             hipblasConvertComputeType(compute_type),
+                                             cublasGemmAlgo_t(solution_index)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+#if CUBLAS_VER_MAJOR >= 12
+// Arguments of hipblasCublasLtGemm, the gemm computed with cuBLASLt by the epilogue and scaled
+// gemms. The batch_count and strides describe a strided batched gemm.
+struct hipblasCublasLtGemmArgs
+{
+    hipblasOperation_t   transa;
+    hipblasOperation_t   transb;
+    int64_t              m;
+    int64_t              n;
+    int64_t              k;
+    const void*          alpha;
+    const void*          A;
+    hipDataType          a_type;
+    int64_t              lda;
+    int64_t              stride_a = 0;
+    const void*          B;
+    hipDataType          b_type;
+    int64_t              ldb;
+    int64_t              stride_b = 0;
+    const void*          beta;
+    void*                C;
+    hipDataType          c_type;
+    int64_t              ldc;
+    int64_t              stride_c    = 0;
+    int32_t              batch_count = 1;
+    hipblasComputeType_t compute_type;
+
+    // hipblasGemmExWithEpilogue
+    hipblasEpilogue_t epilogue = HIPBLAS_EPILOGUE_DEFAULT;
+    const void*       bias     = nullptr;
+    void*             aux      = nullptr;
+    int64_t           ldaux    = 0;
+
+    // hipblasGemm*ExWithScales, device pointers to a float each
+    const float* scale_a = nullptr;
+    const float* scale_b = nullptr;
+    const float* scale_d = nullptr;
+    float*       amax_d  = nullptr;
+
+    // hipblasGemmExWithDiagonalScales: scale_a and scale_b are vectors of m and n floats, the
+    // scales of the rows of op(A) and the columns of op(B)
+    bool outer_vec_scales = false;
+
+    // hipblasGemmEx in HIPBLAS_GEMM_BACKEND_LT mode: device memory the algorithm may use, and
+    // whether the algorithm is cached by problem rather than queried on every call
+    void*  workspace      = nullptr;
+    size_t workspace_size = 0;
+    bool   cache_algo     = false;
+};
+
+// The problem of a gemm whose algorithm is cached: the device, the transposes, sizes, types,
+// leading dimensions and strides, the batch count, the compute type, the pointer mode and the
+// workspace size
+using hipblasCublasLtProblem = std::array<int64_t, 20>;
+
+struct hipblasCublasLtProblemHash
+{
+    size_t operator()(const hipblasCublasLtProblem& problem) const
+    {
+        size_t seed = 0;
+        for(int64_t v : problem)
+            seed ^= std::hash<int64_t>{}(v) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+        return seed;
+    }
+};
+
+// The heuristic result of each cached problem, with returned == 0 for the problems cuBLASLt has
+// no algorithm for
+struct hipblasCublasLtAlgo
+{
+    int                             returned;
+    cublasLtMatmulHeuristicResult_t heuristic;
+};
+
+static std::mutex& hipblasCublasLtAlgoMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+static std::unordered_map<hipblasCublasLtProblem, hipblasCublasLtAlgo, hipblasCublasLtProblemHash>&
+    hipblasCublasLtAlgoCache()
+{
+    static std::
+        unordered_map<hipblasCublasLtProblem, hipblasCublasLtAlgo, hipblasCublasLtProblemHash>
+            cache;
+    return cache;
+}
+
+static hipblasStatus_t hipblasCublasLtGemm(hipblasHandle_t                handle,
+                                           const hipblasCublasLtGemmArgs& args)
+{
+    // cublasLt takes the type of alpha and beta, which is the real or complex type of the
+    // compute type as with cublasGemmEx
+    bool complex_c
+        = args.c_type == HIP_C_16F || args.c_type == HIP_C_32F || args.c_type == HIP_C_64F;
+    cudaDataType scale_type;
+    switch(args.compute_type)
+    {
+    case HIPBLAS_COMPUTE_16F:
+    case HIPBLAS_COMPUTE_16F_PEDANTIC:
+        scale_type = CUDA_R_16F;
+        break;
+    case HIPBLAS_COMPUTE_64F:
+    case HIPBLAS_COMPUTE_64F_PEDANTIC:
+        scale_type = complex_c ? CUDA_C_64F : CUDA_R_64F;
+        break;
+    case HIPBLAS_COMPUTE_32I:
+    case HIPBLAS_COMPUTE_32I_PEDANTIC:
+        scale_type = CUDA_R_32I;
+        break;
+    default:
+        scale_type = complex_c ? CUDA_C_32F : CUDA_R_32F;
+        break;
+    }
+
+    cudaStream_t        stream;
+    cublasPointerMode_t pointer_mode;
+    cublasStatus_t      status = cublasGetStream((cublasHandle_t)handle, &stream);
+    if(status == CUBLAS_STATUS_SUCCESS)
+        status = cublasGetPointerMode((cublasHandle_t)handle, &pointer_mode);
+    if(status != CUBLAS_STATUS_SUCCESS)
+        return hipblasConvertStatus(status);
+
+    // a cuBLAS handle can be used as the cuBLASLt handle of its context
+    cublasLtHandle_t                lt_handle = (cublasLtHandle_t)handle;
+    cublasLtMatmulDesc_t            desc      = nullptr;
+    cublasLtMatrixLayout_t          A_layout  = nullptr;
+    cublasLtMatrixLayout_t          B_layout  = nullptr;
+    cublasLtMatrixLayout_t          C_layout  = nullptr;
+    cublasLtMatmulPreference_t      pref      = nullptr;
+    cublasOperation_t               op_a      = hipblasConvertOperation(args.transa);
+    cublasOperation_t               op_b      = hipblasConvertOperation(args.transb);
+    cublasLtEpilogue_t              lt_epi    = cublasLtEpilogue_t(args.epilogue);
+    cublasLtPointerMode_t           lt_mode   = pointer_mode == CUBLAS_POINTER_MODE_DEVICE
+                                                    ? CUBLASLT_POINTER_MODE_DEVICE
+                                                    : CUBLASLT_POINTER_MODE_HOST;
+    uint64_t                        max_work  = args.workspace_size;
+    int                             returned  = 0;
+    bool                            cached    = false;
+    cublasLtMatmulHeuristicResult_t heuristic;
+
+    int                    device = 0;
+    hipblasCublasLtProblem problem;
+    if(args.cache_algo)
+    {
+        if(cudaGetDevice(&device) != cudaSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        problem = {device,
+                   args.transa,
+                   args.transb,
+                   args.m,
+                   args.n,
+                   args.k,
+                   args.a_type,
+                   args.lda,
+                   args.stride_a,
+                   args.b_type,
+                   args.ldb,
+                   args.stride_b,
+                   args.c_type,
+                   args.ldc,
+                   args.stride_c,
+                   args.batch_count,
+                   args.compute_type,
+                   lt_mode,
+                   int64_t(args.workspace_size),
+                   args.epilogue};
+
+        std::lock_guard<std::mutex> lock(hipblasCublasLtAlgoMutex());
+
+        auto it = hipblasCublasLtAlgoCache().find(problem);
+        if(it != hipblasCublasLtAlgoCache().end())
+        {
+            returned  = it->second.returned;
+            heuristic = it->second.heuristic;
+            cached    = true;
+        }
+    }
+
+    status = cublasLtMatmulDescCreate(
+        &desc, hipblasConvertComputeType(args.compute_type), scale_type);
+
+    // the attributes of each epilogue are set whether the epilogue uses them or not, as cuBLASLt
+    // ignores those it doesn't use
+    auto set = [&](cublasLtMatmulDescAttributes_t attribute, const void* value, size_t size) {
+        if(status == CUBLAS_STATUS_SUCCESS)
+            status = cublasLtMatmulDescSetAttribute(desc, attribute, value, size);
+    };
+    set(CUBLASLT_MATMUL_DESC_TRANSA, &op_a, sizeof(op_a));
+    set(CUBLASLT_MATMUL_DESC_TRANSB, &op_b, sizeof(op_b));
+    set(CUBLASLT_MATMUL_DESC_POINTER_MODE, &lt_mode, sizeof(lt_mode));
+    set(CUBLASLT_MATMUL_DESC_EPILOGUE, &lt_epi, sizeof(lt_epi));
+    set(CUBLASLT_MATMUL_DESC_BIAS_POINTER, &args.bias, sizeof(args.bias));
+    set(CUBLASLT_MATMUL_DESC_EPILOGUE_AUX_POINTER, &args.aux, sizeof(args.aux));
+    set(CUBLASLT_MATMUL_DESC_EPILOGUE_AUX_LD, &args.ldaux, sizeof(args.ldaux));
+
+#if CUBLAS_VERSION >= 120900
+    if(args.outer_vec_scales)
+    {
+        cublasLtMatmulMatrixScale_t outer = CUBLASLT_MATMUL_MATRIX_SCALE_OUTER_VEC_32F;
+        if(args.scale_a)
+            set(CUBLASLT_MATMUL_DESC_A_SCALE_MODE, &outer, sizeof(outer));
+        if(args.scale_b)
+            set(CUBLASLT_MATMUL_DESC_B_SCALE_MODE, &outer, sizeof(outer));
+    }
+#endif
+
+    // the FP8 scaling factors are only set when they are given
+    if(args.scale_a)
+        set(CUBLASLT_MATMUL_DESC_A_SCALE_POINTER, &args.scale_a, sizeof(args.scale_a));
+    if(args.scale_b)
+        set(CUBLASLT_MATMUL_DESC_B_SCALE_POINTER, &args.scale_b, sizeof(args.scale_b));
+    if(args.scale_d)
+        set(CUBLASLT_MATMUL_DESC_D_SCALE_POINTER, &args.scale_d, sizeof(args.scale_d));
+    if(args.amax_d)
+        set(CUBLASLT_MATMUL_DESC_AMAX_D_POINTER, &args.amax_d, sizeof(args.amax_d));
+
+    auto layout = [&](cublasLtMatrixLayout_t* layout,
+                      hipDataType             type,
+                      int64_t                 rows,
+                      int64_t                 cols,
+                      int64_t                 ld,
+                      int64_t                 stride) {
+        if(status == CUBLAS_STATUS_SUCCESS)
+            status = cublasLtMatrixLayoutCreate(
+                layout, hipblasConvertDatatype_v2(type), rows, cols, ld);
+        if(status == CUBLAS_STATUS_SUCCESS && args.batch_count != 1)
+            status = cublasLtMatrixLayoutSetAttribute(*layout,
+                                                      CUBLASLT_MATRIX_LAYOUT_BATCH_COUNT,
+                                                      &args.batch_count,
+                                                      sizeof(args.batch_count));
+        if(status == CUBLAS_STATUS_SUCCESS && args.batch_count != 1)
+            status = cublasLtMatrixLayoutSetAttribute(
+                *layout, CUBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET, &stride, sizeof(stride));
+    };
+
+    // D is written in place of C, so both use the layout of C
+    bool a_n = args.transa == HIPBLAS_OP_N;
+    bool b_n = args.transb == HIPBLAS_OP_N;
+    layout(&A_layout,
+           args.a_type,
+           a_n ? args.m : args.k,
+           a_n ? args.k : args.m,
+           args.lda,
+           args.stride_a);
+    layout(&B_layout,
+           args.b_type,
+           b_n ? args.k : args.n,
+           b_n ? args.n : args.k,
+           args.ldb,
+           args.stride_b);
+    layout(&C_layout, args.c_type, args.m, args.n, args.ldc, args.stride_c);
+
+    if(status == CUBLAS_STATUS_SUCCESS && !cached)
+    {
+        status = cublasLtMatmulPreferenceCreate(&pref);
+        if(status == CUBLAS_STATUS_SUCCESS)
+            status = cublasLtMatmulPreferenceSetAttribute(
+                pref, CUBLASLT_MATMUL_PREF_MAX_WORKSPACE_BYTES, &max_work, sizeof(max_work));
+        if(status == CUBLAS_STATUS_SUCCESS)
+            status = cublasLtMatmulAlgoGetHeuristic(lt_handle,
+                                                    desc,
+                                                    A_layout,
+                                                    B_layout,
+                                                    C_layout,
+                                                    C_layout,
+                                                    pref,
+                                                    1,
+                                                    &heuristic,
+                                                    &returned);
+        if(status == CUBLAS_STATUS_SUCCESS && args.cache_algo)
+        {
+            std::lock_guard<std::mutex> lock(hipblasCublasLtAlgoMutex());
+            hipblasCublasLtAlgoCache()[problem] = {returned, heuristic};
+        }
+    }
+    if(status == CUBLAS_STATUS_SUCCESS && returned == 0)
+        status = CUBLAS_STATUS_NOT_SUPPORTED;
+    if(status == CUBLAS_STATUS_SUCCESS)
+        status = cublasLtMatmul(lt_handle,
+                                desc,
+                                args.alpha,
+                                args.A,
+                                A_layout,
+                                args.B,
+                                B_layout,
+                                args.beta,
+                                args.C,
+                                C_layout,
+                                args.C,
+                                C_layout,
+                                &heuristic.algo,
+                                heuristic.workspaceSize ? args.workspace : nullptr,
+                                heuristic.workspaceSize,
+                                stream);
+
+    if(pref)
+        cublasLtMatmulPreferenceDestroy(pref);
+    if(C_layout)
+        cublasLtMatrixLayoutDestroy(C_layout);
+    if(B_layout)
+        cublasLtMatrixLayoutDestroy(B_layout);
+    if(A_layout)
+        cublasLtMatrixLayoutDestroy(A_layout);
+    if(desc)
+        cublasLtMatmulDescDestroy(desc);
+
+    return hipblasConvertStatus(status);
+}
+#endif
+
+// The workspace of the gemms computed with cuBLASLt in HIPBLAS_GEMM_BACKEND_LT mode
+static constexpr size_t hipblas_cublaslt_workspace_size = size_t(4) << 20;
+
+// Computed with cuBLASLt when it has an algorithm for the problem. Returns
+// HIPBLAS_STATUS_NOT_SUPPORTED, for the call to go to cuBLAS, in the default mode, for invalid
+// arguments and empty problems, and for the problems cuBLASLt doesn't take.
+static hipblasStatus_t hipblasCublasLtRoutedGemmEx(hipblasHandle_t      handle,
+                                                   hipblasOperation_t   transa,
+                                                   hipblasOperation_t   transb,
+                                                   int                  m,
+                                                   int                  n,
+                                                   int                  k,
+                                                   const void*          alpha,
+                                                   const void*          A,
+                                                   hipDataType          a_type,
+                                                   int                  lda,
+                                                   hipblasStride        stride_a,
+                                                   const void*          B,
+                                                   hipDataType          b_type,
+                                                   int                  ldb,
+                                                   hipblasStride        stride_b,
+                                                   const void*          beta,
+                                                   void*                C,
+                                                   hipDataType          c_type,
+                                                   int                  ldc,
+                                                   hipblasStride        stride_c,
+                                                   int                  batch_count,
+                                                   hipblasComputeType_t compute_type)
+{
+    if(!hipblasIsGemmBackendLt(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+#if CUBLAS_VER_MAJOR >= 12
+    for(hipblasOperation_t trans : {transa, transb})
+    {
+        if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    int a_rows = transa == HIPBLAS_OP_N ? m : k;
+    int b_rows = transb == HIPBLAS_OP_N ? k : n;
+    if(m <= 0 || n <= 0 || k <= 0 || batch_count <= 0 || lda < a_rows || ldb < b_rows || ldc < m
+       || !alpha || !beta || !A || !B || !C)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    cudaStream_t stream;
+    if(cublasGetStream((cublasHandle_t)handle, &stream) != CUBLAS_STATUS_SUCCESS)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblasCublasLtGemmArgs args;
+    args.transa         = transa;
+    args.transb         = transb;
+    args.m              = m;
+    args.n              = n;
+    args.k              = k;
+    args.alpha          = alpha;
+    args.A              = A;
+    args.a_type         = a_type;
+    args.lda            = lda;
+    args.stride_a       = stride_a;
+    args.B              = B;
+    args.b_type         = b_type;
+    args.ldb            = ldb;
+    args.stride_b       = stride_b;
+    args.beta           = beta;
+    args.C              = C;
+    args.c_type         = c_type;
+    args.ldc            = ldc;
+    args.stride_c       = stride_c;
+    args.batch_count    = batch_count;
+    args.compute_type   = compute_type;
+    args.cache_algo     = true;
+    args.workspace      = hipblasGetScratch(handle, hipblas_cublaslt_workspace_size, stream);
+    args.workspace_size = args.workspace ? hipblas_cublaslt_workspace_size : 0;
+    return hipblasCublasLtGemm(handle, args);
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+hipblasStatus_t hipblasGemmExWithEpilogue(hipblasHandle_t      handle,
+                                          hipblasOperation_t   transa,
+                                          hipblasOperation_t   transb,
+                                          int                  m,
+                                          int                  n,
+                                          int                  k,
+                                          const void*          alpha,
+                                          const void*          A,
+                                          hipDataType          a_type,
+                                          int                  lda,
+                                          const void*          B,
+                                          hipDataType          b_type,
+                                          int                  ldb,
+                                          const void*          beta,
+                                          void*                C,
+                                          hipDataType          c_type,
+                                          int                  ldc,
+                                          hipblasComputeType_t compute_type,
+                                          hipblasEpilogue_t    epilogue,
+                                          const void*          bias,
+                                          void*                aux,
+                                          int                  ldaux)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, transa, transb, m, n, k, a_type, lda, b_type, ldb, c_type, ldc, compute_type);
+
+#if CUBLAS_VER_MAJOR >= 12
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasCublasLtGemmArgs args;
+    args.transa       = transa;
+    args.transb       = transb;
+    args.m            = m;
+    args.n            = n;
+    args.k            = k;
+    args.alpha        = alpha;
+    args.A            = A;
+    args.a_type       = a_type;
+    args.lda          = lda;
+    args.B            = B;
+    args.b_type       = b_type;
+    args.ldb          = ldb;
+    args.beta         = beta;
+    args.C            = C;
+    args.c_type       = c_type;
+    args.ldc          = ldc;
+    args.compute_type = compute_type;
+    args.epilogue     = epilogue;
+    args.bias         = bias;
+    args.aux          = aux;
+    args.ldaux        = ldaux;
+    return hipblasCublasLtGemm(handle, args);
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmExWithScales(hipblasHandle_t      handle,
+                                        hipblasOperation_t   transa,
+                                        hipblasOperation_t   transb,
+                                        int                  m,
+                                        int                  n,
+                                        int                  k,
+                                        const void*          alpha,
+                                        const void*          A,
+                                        hipDataType          a_type,
+                                        int                  lda,
+                                        const void*          B,
+                                        hipDataType          b_type,
+                                        int                  ldb,
+                                        const void*          beta,
+                                        void*                C,
+                                        hipDataType          c_type,
+                                        int                  ldc,
+                                        hipblasComputeType_t compute_type,
+                                        const float*         scale_a,
+                                        const float*         scale_b,
+                                        const float*         scale_d,
+                                        float*               amax_d)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, transa, transb, m, n, k, a_type, lda, b_type, ldb, c_type, ldc, compute_type);
+
+#if CUBLAS_VER_MAJOR >= 12
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasCublasLtGemmArgs args;
+    args.transa       = transa;
+    args.transb       = transb;
+    args.m            = m;
+    args.n            = n;
+    args.k            = k;
+    args.alpha        = alpha;
+    args.A            = A;
+    args.a_type       = a_type;
+    args.lda          = lda;
+    args.B            = B;
+    args.b_type       = b_type;
+    args.ldb          = ldb;
+    args.beta         = beta;
+    args.C            = C;
+    args.c_type       = c_type;
+    args.ldc          = ldc;
+    args.compute_type = compute_type;
+    args.scale_a      = scale_a;
+    args.scale_b      = scale_b;
+    args.scale_d      = scale_d;
+    args.amax_d       = amax_d;
+    return hipblasCublasLtGemm(handle, args);
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExWithScales(hipblasHandle_t      handle,
+                                                      hipblasOperation_t   transa,
+                                                      hipblasOperation_t   transb,
+                                                      int                  m,
+                                                      int                  n,
+                                                      int                  k,
+                                                      const void*          alpha,
+                                                      const void*          A,
+                                                      hipDataType          a_type,
+                                                      int                  lda,
+                                                      hipblasStride        stride_a,
+                                                      const void*          B,
+                                                      hipDataType          b_type,
+                                                      int                  ldb,
+                                                      hipblasStride        stride_b,
+                                                      const void*          beta,
+                                                      void*                C,
+                                                      hipDataType          c_type,
+                                                      int                  ldc,
+                                                      hipblasStride        stride_c,
+                                                      int                  batch_count,
+                                                      hipblasComputeType_t compute_type,
+                                                      const float*         scale_a,
+                                                      const float*         scale_b,
+                                                      const float*         scale_d,
+                                                      float*               amax_d)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  stride_a,
+                  b_type,
+                  ldb,
+                  stride_b,
+                  c_type,
+                  ldc,
+                  stride_c,
+                  batch_count,
+                  compute_type);
+
+#if CUBLAS_VER_MAJOR >= 12
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasCublasLtGemmArgs args;
+    args.transa       = transa;
+    args.transb       = transb;
+    args.m            = m;
+    args.n            = n;
+    args.k            = k;
+    args.alpha        = alpha;
+    args.A            = A;
+    args.a_type       = a_type;
+    args.lda          = lda;
+    args.stride_a     = stride_a;
+    args.B            = B;
+    args.b_type       = b_type;
+    args.ldb          = ldb;
+    args.stride_b     = stride_b;
+    args.beta         = beta;
+    args.C            = C;
+    args.c_type       = c_type;
+    args.ldc          = ldc;
+    args.stride_c     = stride_c;
+    args.batch_count  = batch_count;
+    args.compute_type = compute_type;
+    args.scale_a      = scale_a;
+    args.scale_b      = scale_b;
+    args.scale_d      = scale_d;
+    args.amax_d       = amax_d;
+    return hipblasCublasLtGemm(handle, args);
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// True if beta is a host scalar equal to zero, so that the gemm doesn't read C. beta has the
+// type of alpha and beta of cublasGemmEx for compute_type and c_type.
+static bool hipblasGemmExBetaIsZero(hipblasHandle_t      handle,
+                                    const void*          beta,
+                                    hipblasComputeType_t compute_type,
+                                    hipDataType          c_type)
+{
+    cublasPointerMode_t pointer_mode;
+    if(!beta || cublasGetPointerMode((cublasHandle_t)handle, &pointer_mode) != CUBLAS_STATUS_SUCCESS
+       || pointer_mode != CUBLAS_POINTER_MODE_HOST)
+        return false;
+
+    bool complex_c = c_type == HIP_C_16F || c_type == HIP_C_32F || c_type == HIP_C_64F;
+    switch(compute_type)
+    {
+    case HIPBLAS_COMPUTE_16F:
+    case HIPBLAS_COMPUTE_16F_PEDANTIC:
+        // +0 or -0
+        return (*static_cast<const uint16_t*>(beta) & 0x7fff) == 0;
+    case HIPBLAS_COMPUTE_64F:
+    case HIPBLAS_COMPUTE_64F_PEDANTIC:
+    {
+        const double* b = static_cast<const double*>(beta);
+        return b[0] == 0 && (!complex_c || b[1] == 0);
+    }
+    case HIPBLAS_COMPUTE_32I:
+    case HIPBLAS_COMPUTE_32I_PEDANTIC:
+        return *static_cast<const int32_t*>(beta) == 0;
+    default:
+    {
+        const float* b = static_cast<const float*>(beta);
+        return b[0] == 0 && (!complex_c || b[1] == 0);
+    }
+    }
+}
+
+// Prepares D for an out-of-place gemm computed in place on D, by copying C_i to D_i on the stream
+// of handle unless the gemm doesn't read C
+static hipblasStatus_t hipblasGemmExOutOfPlaceCopy(hipblasHandle_t      handle,
+                                                   int                  m,
+                                                   int                  n,
+                                                   const void*          beta,
+                                                   const void*          C,
+                                                   hipDataType          c_type,
+                                                   int                  ldc,
+                                                   hipblasStride        stride_C,
+                                                   void*                D,
+                                                   hipDataType          d_type,
+                                                   int                  ldd,
+                                                   hipblasStride        stride_D,
+                                                   int                  batch_count,
+                                                   hipblasComputeType_t compute_type)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    // cublasGemmEx writes D with the type of C
+    if(d_type != c_type)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    if(m < 0 || n < 0 || batch_count < 0 || ldc < m || ldd < m
+       || (D == C && (ldd != ldc || stride_D != stride_C)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    if(D == C || !m || !n || !batch_count
+       || hipblasGemmExBetaIsZero(handle, beta, compute_type, c_type))
+        return HIPBLAS_STATUS_SUCCESS;
+
+    if(!C || !D)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    cudaStream_t   stream;
+    cublasStatus_t status = cublasGetStream((cublasHandle_t)handle, &stream);
+    if(status != CUBLAS_STATUS_SUCCESS)
+        return hipblasConvertStatus(status);
+
+    // the columns of consecutive matrices of packed batches are copied as one matrix
+    size_t elem_size = hipblasDatatypeSize(hipblasConvertDatatype_v2(c_type));
+    int    copies    = batch_count;
+    int    columns   = n;
+    if(batch_count == 1
+       || (stride_C == hipblasStride(ldc) * n && stride_D == hipblasStride(ldd) * n))
+    {
+        copies  = 1;
+        columns = n * batch_count;
+    }
+
+    for(int b = 0; b < copies; b++)
+    {
+        if(cudaMemcpy2DAsync(static_cast<char*>(D) + b * stride_D * elem_size,
+                             ldd * elem_size,
+                             static_cast<const char*>(C) + b * stride_C * elem_size,
+                             ldc * elem_size,
+                             m * elem_size,
+                             columns,
+                             cudaMemcpyDeviceToDevice,
+                             stream)
+           != cudaSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasGemmExOutOfPlace(hipblasHandle_t      handle,
+                                        hipblasOperation_t   transa,
+                                        hipblasOperation_t   transb,
+                                        int                  m,
+                                        int                  n,
+                                        int                  k,
+                                        const void*          alpha,
+                                        const void*          A,
+                                        hipDataType          a_type,
+                                        int                  lda,
+                                        const void*          B,
+                                        hipDataType          b_type,
+                                        int                  ldb,
+                                        const void*          beta,
+                                        const void*          C,
+                                        hipDataType          c_type,
+                                        int                  ldc,
+                                        void*                D,
+                                        hipDataType          d_type,
+                                        int                  ldd,
+                                        hipblasComputeType_t compute_type,
+                                        hipblasGemmAlgo_t    algo,
+                                        hipblasGemmFlags_t   flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  compute_type,
+                  algo,
+                  flags);
+
+    hipblasStatus_t status = hipblasGemmExOutOfPlaceCopy(
+        handle, m, n, beta, C, c_type, ldc, 0, D, d_type, ldd, 0, 1, compute_type);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // flags are ignored, as with hipblasGemmExWithFlags
+    return hipblasConvertStatus(cublasGemmEx((cublasHandle_t)handle,
+                                             hipblasConvertOperation(transa),
+                                             hipblasConvertOperation(transb),
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             hipblasConvertDatatype_v2(a_type),
+                                             lda,
+                                             B,
+                                             hipblasConvertDatatype_v2(b_type),
+                                             ldb,
+                                             beta,
+                                             D,
+                                             hipblasConvertDatatype_v2(d_type),
+                                             ldd,
+                                             hipblasConvertComputeType(compute_type),
+                                             hipblasConvertGemmAlgo(algo)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExOutOfPlace(hipblasHandle_t      handle,
+                                                      hipblasOperation_t   transa,
+                                                      hipblasOperation_t   transb,
+                                                      int                  m,
+                                                      int                  n,
+                                                      int                  k,
+                                                      const void*          alpha,
+                                                      const void*          A,
+                                                      hipDataType          a_type,
+                                                      int                  lda,
+                                                      hipblasStride        stride_A,
+                                                      const void*          B,
+                                                      hipDataType          b_type,
+                                                      int                  ldb,
+                                                      hipblasStride        stride_B,
+                                                      const void*          beta,
+                                                      const void*          C,
+                                                      hipDataType          c_type,
+                                                      int                  ldc,
+                                                      hipblasStride        stride_C,
+                                                      void*                D,
+                                                      hipDataType          d_type,
+                                                      int                  ldd,
+                                                      hipblasStride        stride_D,
+                                                      int                  batch_count,
+                                                      hipblasComputeType_t compute_type,
+                                                      hipblasGemmAlgo_t    algo,
+                                                      hipblasGemmFlags_t   flags)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  stride_A,
+                  b_type,
+                  ldb,
+                  stride_B,
+                  c_type,
+                  ldc,
+                  stride_C,
+                  batch_count,
+                  compute_type,
+                  algo,
+                  flags);
+
+    hipblasStatus_t status = hipblasGemmExOutOfPlaceCopy(handle,
+                                                         m,
+                                                         n,
+                                                         beta,
+                                                         C,
+                                                         c_type,
+                                                         ldc,
+                                                         stride_C,
+                                                         D,
+                                                         d_type,
+                                                         ldd,
+                                                         stride_D,
+                                                         batch_count,
+                                                         compute_type);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // flags are ignored, as with hipblasGemmStridedBatchedExWithFlags
+    return hipblasConvertStatus(cublasGemmStridedBatchedEx((cublasHandle_t)handle,
+                                                           hipblasConvertOperation(transa),
+                                                           hipblasConvertOperation(transb),
+                                                           m,
+                                                           n,
+                                                           k,
+                                                           alpha,
+                                                           A,
+                                                           hipblasConvertDatatype_v2(a_type),
+                                                           lda,
+                                                           stride_A,
+                                                           B,
+                                                           hipblasConvertDatatype_v2(b_type),
+                                                           ldb,
+                                                           stride_B,
+                                                           beta,
+                                                           D,
+                                                           hipblasConvertDatatype_v2(d_type),
+                                                           ldd,
+                                                           stride_D,
+                                                           batch_count,
+                                                           hipblasConvertComputeType(compute_type),
+                                                           hipblasConvertGemmAlgo(algo)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedExGetSolutions(hipblasHandle_t      handle,
+                                                 hipblasOperation_t   transa,
+                                                 hipblasOperation_t   transb,
+                                                 int                  m,
+                                                 int                  n,
+                                                 int                  k,
+                                                 const void*          alpha,
+                                                 const void*          A[],
+                                                 hipDataType          a_type,
+                                                 int                  lda,
+                                                 const void*          B[],
+                                                 hipDataType          b_type,
+                                                 int                  ldb,
+                                                 const void*          beta,
+                                                 void*                C[],
+                                                 hipDataType          c_type,
+                                                 int                  ldc,
+                                                 int                  batch_count,
+                                                 hipblasComputeType_t compute_type,
+                                                 hipblasGemmFlags_t   flags,
+                                                 int*                 solution_list,
+                                                 int*                 solution_count)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasConvertOperation(transa);
+    hipblasConvertOperation(transb);
+    hipblasConvertDatatype_v2(a_type);
+    hipblasConvertDatatype_v2(b_type);
+    hipblasConvertDatatype_v2(c_type);
+    hipblasConvertComputeType(compute_type);
+
+    if(m < 0 || n < 0 || k < 0 || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGetCublasGemmAlgos(solution_list, solution_count);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedExWithSolution(hipblasHandle_t      handle,
+                                                 hipblasOperation_t   transa,
+                                                 hipblasOperation_t   transb,
+                                                 int                  m,
+                                                 int                  n,
+                                                 int                  k,
+                                                 const void*          alpha,
+                                                 const void*          A[],
+                                                 hipDataType          a_type,
+                                                 int                  lda,
+                                                 const void*          B[],
+                                                 hipDataType          b_type,
+                                                 int                  ldb,
+                                                 const void*          beta,
+                                                 void*                C[],
+                                                 hipDataType          c_type,
+                                                 int                  ldc,
+                                                 int                  batch_count,
+                                                 hipblasComputeType_t compute_type,
+                                                 hipblasGemmFlags_t   flags,
+                                                 int                  solution_index)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  b_type,
+                  ldb,
+                  c_type,
+                  ldc,
+                  batch_count,
+                  compute_type,
+                  flags,
+                  solution_index);
+
+    return hipblasConvertStatus(cublasGemmBatchedEx((cublasHandle_t)handle,
+                                                    hipblasConvertOperation(transa),
+                                                    hipblasConvertOperation(transb),
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    alpha,
+                                                    A,
+                                                    hipblasConvertDatatype_v2(a_type),
+                                                    lda,
+                                                    B,
+                                                    hipblasConvertDatatype_v2(b_type),
+                                                    ldb,
+                                                    beta,
+                                                    C,
+                                                    hipblasConvertDatatype_v2(c_type),
+                                                    ldc,
+                                                    batch_count,
+                                                    hipblasConvertComputeType(compute_type),
+                                                    cublasGemmAlgo_t(solution_index)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExGetSolutions(hipblasHandle_t      handle,
+                                                        hipblasOperation_t   transa,
+                                                        hipblasOperation_t   transb,
+                                                        int                  m,
+                                                        int                  n,
+                                                        int                  k,
+                                                        const void*          alpha,
+                                                        const void*          A,
+                                                        hipDataType          a_type,
+                                                        int                  lda,
+                                                        hipblasStride        stride_A,
+                                                        const void*          B,
+                                                        hipDataType          b_type,
+                                                        int                  ldb,
+                                                        hipblasStride        stride_B,
+                                                        const void*          beta,
+                                                        void*                C,
+                                                        hipDataType          c_type,
+                                                        int                  ldc,
+                                                        hipblasStride        stride_C,
+                                                        int                  batch_count,
+                                                        hipblasComputeType_t compute_type,
+                                                        hipblasGemmFlags_t   flags,
+                                                        int*                 solution_list,
+                                                        int*                 solution_count)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasConvertOperation(transa);
+    hipblasConvertOperation(transb);
+    hipblasConvertDatatype_v2(a_type);
+    hipblasConvertDatatype_v2(b_type);
+    hipblasConvertDatatype_v2(c_type);
+    hipblasConvertComputeType(compute_type);
+
+    if(m < 0 || n < 0 || k < 0 || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGetCublasGemmAlgos(solution_list, solution_count);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExWithSolution(hipblasHandle_t      handle,
+                                                        hipblasOperation_t   transa,
+                                                        hipblasOperation_t   transb,
+                                                        int                  m,
+                                                        int                  n,
+                                                        int                  k,
+                                                        const void*          alpha,
+                                                        const void*          A,
+                                                        hipDataType          a_type,
+                                                        int                  lda,
+                                                        hipblasStride        stride_A,
+                                                        const void*          B,
+                                                        hipDataType          b_type,
+                                                        int                  ldb,
+                                                        hipblasStride        stride_B,
+                                                        const void*          beta,
+                                                        void*                C,
+                                                        hipDataType          c_type,
+                                                        int                  ldc,
+                                                        hipblasStride        stride_C,
+                                                        int                  batch_count,
+                                                        hipblasComputeType_t compute_type,
+                                                        hipblasGemmFlags_t   flags,
+                                                        int                  solution_index)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  stride_A,
+                  b_type,
+                  ldb,
+                  stride_B,
+                  c_type,
+                  ldc,
+                  stride_C,
+                  batch_count,
+                  compute_type,
+                  flags,
+                  solution_index);
+
+    return hipblasConvertStatus(
+        cublasGemmStridedBatchedEx((cublasHandle_t)handle,
+                                   hipblasConvertOperation(transa),
+                                   hipblasConvertOperation(transb),
+                                   m,
+                                   n,
+                                   k,
+                                   alpha,
+                                   A,
+                                   hipblasConvertDatatype_v2(a_type),
+                                   lda,
+                                   stride_A,
+                                   B,
+                                   hipblasConvertDatatype_v2(b_type),
+                                   ldb,
+                                   stride_B,
+                                   beta,
+                                   C,
+                                   hipblasConvertDatatype_v2(c_type),
+                                   ldc,
+                                   stride_C,
+                                   batch_count,
+                                   hipblasConvertComputeType(compute_type),
+                                   cublasGemmAlgo_t(solution_index)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// gemm plans keep the gemmEx arguments converted to cuBLAS once, so executing one only
+// passes the pointers
+struct hipblasGemmPlan
+{
+    cublasOperation_t   transa, transb;
+    int                 m, n, k;
+    cudaDataType_t      a_type, b_type, c_type;
+    cublasComputeType_t compute_type;
+    int                 lda, ldb, ldc;
+    long long int       stride_A, stride_B, stride_C;
+    int                 batch_count;
+    cublasGemmAlgo_t    algo;
+};
+
+hipblasStatus_t hipblasGemmPlanCreate(hipblasHandle_t      handle,
+                                      hipblasGemmPlan_t*   plan,
+                                      hipblasOperation_t   transa,
+                                      hipblasOperation_t   transb,
+                                      int                  m,
+                                      int                  n,
+                                      int                  k,
+                                      hipDataType          a_type,
+                                      int                  lda,
+                                      hipblasStride        stride_A,
+                                      hipDataType          b_type,
+                                      int                  ldb,
+                                      hipblasStride        stride_B,
+                                      hipDataType          c_type,
+                                      int                  ldc,
+                                      hipblasStride        stride_C,
+                                      int                  batch_count,
+                                      hipblasComputeType_t compute_type,
+                                      hipblasGemmFlags_t   flags,
+                                      int                  solution_index)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  transa,
+                  transb,
+                  m,
+                  n,
+                  k,
+                  a_type,
+                  lda,
+                  stride_A,
+                  b_type,
+                  ldb,
+                  stride_B,
+                  c_type,
+                  ldc,
+                  stride_C,
+                  batch_count,
+                  compute_type,
+                  flags,
+                  solution_index);
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(plan == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *plan = nullptr;
+
+    cublasOperation_t trans_a = hipblasConvertOperation(transa);
+    cublasOperation_t trans_b = hipblasConvertOperation(transb);
+
+    int rows_A = trans_a == CUBLAS_OP_N ? m : k;
+    int rows_B = trans_b == CUBLAS_OP_N ? k : n;
+    if(m < 0 || n < 0 || k < 0 || lda < std::max(1, rows_A) || ldb < std::max(1, rows_B)
+       || ldc < std::max(1, m) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // solution_index is a cublasGemmAlgo_t, as returned by hipblasGemmExGetSolutions
+    *plan = new hipblasGemmPlan{trans_a,
+                                trans_b,
+                                m,
+                                n,
+                                k,
+                                hipblasConvertDatatype_v2(a_type),
+                                hipblasConvertDatatype_v2(b_type),
+                                hipblasConvertDatatype_v2(c_type),
+                                hipblasConvertComputeType(compute_type),
+                                lda,
+                                ldb,
+                                ldc,
+                                stride_A,
+                                stride_B,
+                                stride_C,
+                                batch_count,
+                                cublasGemmAlgo_t(solution_index)};
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmPlanDestroy(hipblasGemmPlan_t plan)
+try
+{
+    delete plan;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmPlanExecute(hipblasHandle_t   handle,
+                                       hipblasGemmPlan_t plan,
+                                       const void*       alpha,
+                                       const void*       A,
+                                       const void*       B,
+                                       const void*       beta,
+                                       void*             C)
+try
+{
+    HIPBLAS_ENTRY(handle);
+
+    if(plan == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    const hipblasGemmPlan& p = *plan;
+
+    if(p.batch_count == 1)
+        return hipblasConvertStatus(cublasGemmEx((cublasHandle_t)handle,
+                                                 p.transa,
+                                                 p.transb,
+                                                 p.m,
+                                                 p.n,
+                                                 p.k,
+                                                 alpha,
+                                                 A,
+                                                 p.a_type,
+                                                 p.lda,
+                                                 B,
+                                                 p.b_type,
+                                                 p.ldb,
+                                                 beta,
+                                                 C,
+                                                 p.c_type,
+                                                 p.ldc,
+                                                 p.compute_type,
+                                                 p.algo));
+
+    return hipblasConvertStatus(cublasGemmStridedBatchedEx((cublasHandle_t)handle,
+                                                           p.transa,
+                                                           p.transb,
+                                                           p.m,
+                                                           p.n,
+                                                           p.k,
+                                                           alpha,
+                                                           A,
+                                                           p.a_type,
+                                                           p.lda,
+                                                           p.stride_A,
+                                                           B,
+                                                           p.b_type,
+                                                           p.ldb,
+                                                           p.stride_B,
+                                                           beta,
+                                                           C,
+                                                           p.c_type,
+                                                           p.ldc,
+                                                           p.stride_C,
+                                                           p.batch_count,
+                                                           p.compute_type,
+                                                           p.algo));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmGroupedBatchedEx(hipblasHandle_t          handle,
+                                            const hipblasOperation_t transa_array[],
+                                            const hipblasOperation_t transb_array[],
+                                            const int                m_array[],
+                                            const int                n_array[],
+                                            const int                k_array[],
+                                            const void*              alpha_array,
+                                            const void* const        A_array[],
+                                            hipDataType              a_type,
+                                            const int                lda_array[],
+                                            const void* const        B_array[],
+                                            hipDataType              b_type,
+                                            const int                ldb_array[],
+                                            const void*              beta_array,
+                                            void* const              C_array[],
+                                            hipDataType              c_type,
+                                            const int                ldc_array[],
+                                            int                      group_count,
+                                            const int                group_size[],
+                                            hipblasComputeType_t     compute_type)
+try
+{
+    HIPBLAS_ENTRY(handle, a_type, b_type, c_type, group_count, compute_type);
+
+#if CUBLAS_VERSION >= 120500
+    // cuBLAS takes the operations of the groups as a host array of cublasOperation_t
+    if(group_count < 0 || (group_count > 0 && (!transa_array || !transb_array)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::vector<cublasOperation_t> transa(group_count);
+    std::vector<cublasOperation_t> transb(group_count);
+    for(int g = 0; g < group_count; g++)
+    {
+        transa[g] = hipblasConvertOperation(transa_array[g]);
+        transb[g] = hipblasConvertOperation(transb_array[g]);
+    }
+
+    return hipblasConvertStatus(
+        cublasGemmGroupedBatchedEx((cublasHandle_t)handle,
+                                   transa.data(),
+                                   transb.data(),
+                                   m_array,
+                                   n_array,
+                                   k_array,
+                                   alpha_array,
+                                   A_array,
+                                   hipblasConvertDatatype_v2(a_type),
+                                   lda_array,
+                                   B_array,
+                                   hipblasConvertDatatype_v2(b_type),
+                                   ldb_array,
+                                   beta_array,
+                                   C_array,
+                                   hipblasConvertDatatype_v2(c_type),
+                                   ldc_array,
+                                   group_count,
+                                   group_size,
+                                   hipblasConvertComputeType(compute_type)));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmGroupedBatchedEx_64(hipblasHandle_t          handle,
+                                               const hipblasOperation_t transa_array[],
+                                               const hipblasOperation_t transb_array[],
+                                               const int64_t            m_array[],
+                                               const int64_t            n_array[],
+                                               const int64_t            k_array[],
+                                               const void*              alpha_array,
+                                               const void* const        A_array[],
+                                               hipDataType              a_type,
+                                               const int64_t            lda_array[],
+                                               const void* const        B_array[],
+                                               hipDataType              b_type,
+                                               const int64_t            ldb_array[],
+                                               const void*              beta_array,
+                                               void* const              C_array[],
+                                               hipDataType              c_type,
+                                               const int64_t            ldc_array[],
+                                               int64_t                  group_count,
+                                               const int64_t            group_size[],
+                                               hipblasComputeType_t     compute_type)
+try
+{
+    HIPBLAS_ENTRY(handle, a_type, b_type, c_type, group_count, compute_type);
+
+#if CUBLAS_VERSION >= 120500
+    // cuBLAS takes the operations of the groups as a host array of cublasOperation_t
+    if(group_count < 0 || (group_count > 0 && (!transa_array || !transb_array)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::vector<cublasOperation_t> transa(group_count);
+    std::vector<cublasOperation_t> transb(group_count);
+    for(int64_t g = 0; g < group_count; g++)
+    {
+        transa[g] = hipblasConvertOperation(transa_array[g]);
+        transb[g] = hipblasConvertOperation(transb_array[g]);
+    }
+
+    return hipblasConvertStatus(
+        cublasGemmGroupedBatchedEx_64((cublasHandle_t)handle,
+                                      transa.data(),
+                                      transb.data(),
+                                      m_array,
+                                      n_array,
+                                      k_array,
+                                      alpha_array,
+                                      A_array,
+                                      hipblasConvertDatatype_v2(a_type),
+                                      lda_array,
+                                      B_array,
+                                      hipblasConvertDatatype_v2(b_type),
+                                      ldb_array,
+                                      beta_array,
+                                      C_array,
+                                      hipblasConvertDatatype_v2(c_type),
+                                      ldc_array,
+                                      group_count,
+                                      group_size,
+                                      hipblasConvertComputeType(compute_type)));
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// gemv_ex
+// The type combinations of gemv_ex, named as the cuBLAS functions after the types of A and x,
+// of the computation and of y
+enum hipblasGemvExTypes
+{
+    HIPBLAS_GEMV_EX_HSH,
+    HIPBLAS_GEMV_EX_HSS,
+    HIPBLAS_GEMV_EX_TST,
+    HIPBLAS_GEMV_EX_TSS,
+    HIPBLAS_GEMV_EX_S,
+    HIPBLAS_GEMV_EX_D,
+    HIPBLAS_GEMV_EX_C,
+    HIPBLAS_GEMV_EX_Z,
+};
+
+static hipblasStatus_t hipblasGetGemvExTypes(hipDataType          a_type,
+                                             hipDataType          x_type,
+                                             hipDataType          y_type,
+                                             hipblasComputeType_t compute_type,
+                                             hipblasGemvExTypes&  types)
+{
+    bool compute_32f
+        = compute_type == HIPBLAS_COMPUTE_32F || compute_type == HIPBLAS_COMPUTE_32F_PEDANTIC;
+    bool compute_64f
+        = compute_type == HIPBLAS_COMPUTE_64F || compute_type == HIPBLAS_COMPUTE_64F_PEDANTIC;
+
+    if(a_type != x_type)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    else if(a_type == HIP_R_16F && y_type == HIP_R_16F && compute_32f)
+        types = HIPBLAS_GEMV_EX_HSH;
+    else if(a_type == HIP_R_16F && y_type == HIP_R_32F && compute_32f)
+        types = HIPBLAS_GEMV_EX_HSS;
+    else if(a_type == HIP_R_16BF && y_type == HIP_R_16BF && compute_32f)
+        types = HIPBLAS_GEMV_EX_TST;
+    else if(a_type == HIP_R_16BF && y_type == HIP_R_32F && compute_32f)
+        types = HIPBLAS_GEMV_EX_TSS;
+    else if(a_type == HIP_R_32F && y_type == HIP_R_32F && compute_32f)
+        types = HIPBLAS_GEMV_EX_S;
+    else if(a_type == HIP_R_64F && y_type == HIP_R_64F && compute_64f)
+        types = HIPBLAS_GEMV_EX_D;
+    else if(a_type == HIP_C_32F && y_type == HIP_C_32F && compute_32f)
+        types = HIPBLAS_GEMV_EX_C;
+    else if(a_type == HIP_C_64F && y_type == HIP_C_64F && compute_64f)
+        types = HIPBLAS_GEMV_EX_Z;
+    else
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+static hipblasStatus_t hipblasGemvStridedBatchedExImpl(hipblasHandle_t      handle,
+                                                       hipblasOperation_t   trans,
+                                                       int                  m,
+                                                       int                  n,
+                                                       const void*          alpha,
+                                                       const void*          A,
+                                                       hipDataType          a_type,
+                                                       int                  lda,
+                                                       hipblasStride        stride_A,
+                                                       const void*          x,
+                                                       hipDataType          x_type,
+                                                       int                  incx,
+                                                       hipblasStride        stride_x,
+                                                       const void*          beta,
+                                                       void*                y,
+                                                       hipDataType          y_type,
+                                                       int                  incy,
+                                                       hipblasStride        stride_y,
+                                                       int                  batch_count,
+                                                       hipblasComputeType_t compute_type)
+{
+    hipblasGemvExTypes types;
+    hipblasStatus_t    status = hipblasGetGemvExTypes(a_type, x_type, y_type, compute_type, types);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // the mixed-precision gemvs were added in CUDA 11.6
+#if CUBLAS_VERSION >= 110800
+    switch(types)
+    {
+    case HIPBLAS_GEMV_EX_HSH:
+        return hipblasConvertStatus(cublasHSHgemvStridedBatched((cublasHandle_t)handle,
+                                                                hipblasConvertOperation(trans),
+                                                                m,
+                                                                n,
+                                                                (const float*)alpha,
+                                                                (const __half*)A,
+                                                                lda,
+                                                                stride_A,
+                                                                (const __half*)x,
+                                                                incx,
+                                                                stride_x,
+                                                                (const float*)beta,
+                                                                (__half*)y,
+                                                                incy,
+                                                                stride_y,
+                                                                batch_count));
+    case HIPBLAS_GEMV_EX_HSS:
+        return hipblasConvertStatus(cublasHSSgemvStridedBatched((cublasHandle_t)handle,
+                                                                hipblasConvertOperation(trans),
+                                                                m,
+                                                                n,
+                                                                (const float*)alpha,
+                                                                (const __half*)A,
+                                                                lda,
+                                                                stride_A,
+                                                                (const __half*)x,
+                                                                incx,
+                                                                stride_x,
+                                                                (const float*)beta,
+                                                                (float*)y,
+                                                                incy,
+                                                                stride_y,
+                                                                batch_count));
+    case HIPBLAS_GEMV_EX_TST:
+        return hipblasConvertStatus(cublasTSTgemvStridedBatched((cublasHandle_t)handle,
+                                                                hipblasConvertOperation(trans),
+                                                                m,
+                                                                n,
+                                                                (const float*)alpha,
+                                                                (const __nv_bfloat16*)A,
+                                                                lda,
+                                                                stride_A,
+                                                                (const __nv_bfloat16*)x,
+                                                                incx,
+                                                                stride_x,
+                                                                (const float*)beta,
+                                                                (__nv_bfloat16*)y,
+                                                                incy,
+                                                                stride_y,
+                                                                batch_count));
+    case HIPBLAS_GEMV_EX_TSS:
+        return hipblasConvertStatus(cublasTSSgemvStridedBatched((cublasHandle_t)handle,
+                                                                hipblasConvertOperation(trans),
+                                                                m,
+                                                                n,
+                                                                (const float*)alpha,
+                                                                (const __nv_bfloat16*)A,
+                                                                lda,
+                                                                stride_A,
+                                                                (const __nv_bfloat16*)x,
+                                                                incx,
+                                                                stride_x,
+                                                                (const float*)beta,
+                                                                (float*)y,
+                                                                incy,
+                                                                stride_y,
+                                                                batch_count));
+    case HIPBLAS_GEMV_EX_S:
+        return hipblasConvertStatus(cublasSgemvStridedBatched((cublasHandle_t)handle,
+                                                              hipblasConvertOperation(trans),
+                                                              m,
+                                                              n,
+                                                              (const float*)alpha,
+                                                              (const float*)A,
+                                                              lda,
+                                                              stride_A,
+                                                              (const float*)x,
+                                                              incx,
+                                                              stride_x,
+                                                              (const float*)beta,
+                                                              (float*)y,
+                                                              incy,
+                                                              stride_y,
+                                                              batch_count));
+    case HIPBLAS_GEMV_EX_D:
+        return hipblasConvertStatus(cublasDgemvStridedBatched((cublasHandle_t)handle,
+                                                              hipblasConvertOperation(trans),
+                                                              m,
+                                                              n,
+                                                              (const double*)alpha,
+                                                              (const double*)A,
+                                                              lda,
+                                                              stride_A,
+                                                              (const double*)x,
+                                                              incx,
+                                                              stride_x,
+                                                              (const double*)beta,
+                                                              (double*)y,
+                                                              incy,
+                                                              stride_y,
+                                                              batch_count));
+    case HIPBLAS_GEMV_EX_C:
+        return hipblasConvertStatus(cublasCgemvStridedBatched((cublasHandle_t)handle,
+                                                              hipblasConvertOperation(trans),
+                                                              m,
+                                                              n,
+                                                              (const cuComplex*)alpha,
+                                                              (const cuComplex*)A,
+                                                              lda,
+                                                              stride_A,
+                                                              (const cuComplex*)x,
+                                                              incx,
+                                                              stride_x,
+                                                              (const cuComplex*)beta,
+                                                              (cuComplex*)y,
+                                                              incy,
+                                                              stride_y,
+                                                              batch_count));
+    case HIPBLAS_GEMV_EX_Z:
+        return hipblasConvertStatus(cublasZgemvStridedBatched((cublasHandle_t)handle,
+                                                              hipblasConvertOperation(trans),
+                                                              m,
+                                                              n,
+                                                              (const cuDoubleComplex*)alpha,
+                                                              (const cuDoubleComplex*)A,
+                                                              lda,
+                                                              stride_A,
+                                                              (const cuDoubleComplex*)x,
+                                                              incx,
+                                                              stride_x,
+                                                              (const cuDoubleComplex*)beta,
+                                                              (cuDoubleComplex*)y,
+                                                              incy,
+                                                              stride_y,
+                                                              batch_count));
+    }
+#endif
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasGemvEx(hipblasHandle_t      handle,
+                              hipblasOperation_t   trans,
+                              int                  m,
+                              int                  n,
+                              const void*          alpha,
+                              const void*          A,
+                              hipDataType          aType,
+                              int                  lda,
+                              const void*          x,
+                              hipDataType          xType,
+                              int                  incx,
+                              const void*          beta,
+                              void*                y,
+                              hipDataType          yType,
+                              int                  incy,
+                              hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, aType, lda, xType, incx, yType, incy, computeType);
+    hipblasStatus_t persistent = hipblasPersistentGemv(handle,
+                                                       trans,
+                                                       m,
+                                                       n,
+                                                       alpha,
+                                                       A,
+                                                       aType,
+                                                       lda,
+                                                       x,
+                                                       xType,
+                                                       incx,
+                                                       beta,
+                                                       y,
+                                                       yType,
+                                                       incy,
+                                                       computeType);
+    if(persistent != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return persistent;
+
+    // cuBLAS has only batched mixed-precision gemvs, so this is a batch of one
+    return hipblasGemvStridedBatchedExImpl(handle,
+                                           trans,
+                                           m,
+                                           n,
+                                           alpha,
+                                           A,
+                                           aType,
+                                           lda,
+                                           0,
+                                           x,
+                                           xType,
+                                           incx,
+                                           0,
+                                           beta,
+                                           y,
+                                           yType,
+                                           incy,
+                                           0,
+                                           1,
+                                           computeType);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemvBatchedEx(hipblasHandle_t      handle,
+                                     hipblasOperation_t   trans,
+                                     int                  m,
+                                     int                  n,
+                                     const void*          alpha,
+                                     const void* const    A[],
+                                     hipDataType          aType,
+                                     int                  lda,
+                                     const void* const    x[],
+                                     hipDataType          xType,
+                                     int                  incx,
+                                     const void*          beta,
+                                     void* const          y[],
+                                     hipDataType          yType,
+                                     int                  incy,
+                                     int                  batchCount,
+                                     hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, trans, m, n, aType, lda, xType, incx, yType, incy, batchCount, computeType);
+
+    hipblasGemvExTypes types;
+    hipblasStatus_t    status = hipblasGetGemvExTypes(aType, xType, yType, computeType, types);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // the mixed-precision gemvs were added in CUDA 11.6
+#if CUBLAS_VERSION >= 110800
+    switch(types)
+    {
+    case HIPBLAS_GEMV_EX_HSH:
+        return hipblasConvertStatus(cublasHSHgemvBatched((cublasHandle_t)handle,
+                                                         hipblasConvertOperation(trans),
+                                                         m,
+                                                         n,
+                                                         (const float*)alpha,
+                                                         (const __half* const*)A,
+                                                         lda,
+                                                         (const __half* const*)x,
+                                                         incx,
+                                                         (const float*)beta,
+                                                         (__half* const*)y,
+                                                         incy,
+                                                         batchCount));
+    case HIPBLAS_GEMV_EX_HSS:
+        return hipblasConvertStatus(cublasHSSgemvBatched((cublasHandle_t)handle,
+                                                         hipblasConvertOperation(trans),
+                                                         m,
+                                                         n,
+                                                         (const float*)alpha,
+                                                         (const __half* const*)A,
+                                                         lda,
+                                                         (const __half* const*)x,
+                                                         incx,
+                                                         (const float*)beta,
+                                                         (float* const*)y,
+                                                         incy,
+                                                         batchCount));
+    case HIPBLAS_GEMV_EX_TST:
+        return hipblasConvertStatus(cublasTSTgemvBatched((cublasHandle_t)handle,
+                                                         hipblasConvertOperation(trans),
+                                                         m,
+                                                         n,
+                                                         (const float*)alpha,
+                                                         (const __nv_bfloat16* const*)A,
+                                                         lda,
+                                                         (const __nv_bfloat16* const*)x,
+                                                         incx,
+                                                         (const float*)beta,
+                                                         (__nv_bfloat16* const*)y,
+                                                         incy,
+                                                         batchCount));
+    case HIPBLAS_GEMV_EX_TSS:
+        return hipblasConvertStatus(cublasTSSgemvBatched((cublasHandle_t)handle,
+                                                         hipblasConvertOperation(trans),
+                                                         m,
+                                                         n,
+                                                         (const float*)alpha,
+                                                         (const __nv_bfloat16* const*)A,
+                                                         lda,
+                                                         (const __nv_bfloat16* const*)x,
+                                                         incx,
+                                                         (const float*)beta,
+                                                         (float* const*)y,
+                                                         incy,
+                                                         batchCount));
+    case HIPBLAS_GEMV_EX_S:
+        return hipblasConvertStatus(cublasSgemvBatched((cublasHandle_t)handle,
+                                                       hipblasConvertOperation(trans),
+                                                       m,
+                                                       n,
+                                                       (const float*)alpha,
+                                                       (const float* const*)A,
+                                                       lda,
+                                                       (const float* const*)x,
+                                                       incx,
+                                                       (const float*)beta,
+                                                       (float* const*)y,
+                                                       incy,
+                                                       batchCount));
+    case HIPBLAS_GEMV_EX_D:
+        return hipblasConvertStatus(cublasDgemvBatched((cublasHandle_t)handle,
+                                                       hipblasConvertOperation(trans),
+                                                       m,
+                                                       n,
+                                                       (const double*)alpha,
+                                                       (const double* const*)A,
+                                                       lda,
+                                                       (const double* const*)x,
+                                                       incx,
+                                                       (const double*)beta,
+                                                       (double* const*)y,
+                                                       incy,
+                                                       batchCount));
+    case HIPBLAS_GEMV_EX_C:
+        return hipblasConvertStatus(cublasCgemvBatched((cublasHandle_t)handle,
+                                                       hipblasConvertOperation(trans),
+                                                       m,
+                                                       n,
+                                                       (const cuComplex*)alpha,
+                                                       (const cuComplex* const*)A,
+                                                       lda,
+                                                       (const cuComplex* const*)x,
+                                                       incx,
+                                                       (const cuComplex*)beta,
+                                                       (cuComplex* const*)y,
+                                                       incy,
+                                                       batchCount));
+    case HIPBLAS_GEMV_EX_Z:
+        return hipblasConvertStatus(cublasZgemvBatched((cublasHandle_t)handle,
+                                                       hipblasConvertOperation(trans),
+                                                       m,
+                                                       n,
+                                                       (const cuDoubleComplex*)alpha,
+                                                       (const cuDoubleComplex* const*)A,
+                                                       lda,
+                                                       (const cuDoubleComplex* const*)x,
+                                                       incx,
+                                                       (const cuDoubleComplex*)beta,
+                                                       (cuDoubleComplex* const*)y,
+                                                       incy,
+                                                       batchCount));
+    }
+#endif
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemvStridedBatchedEx(hipblasHandle_t      handle,
+                                            hipblasOperation_t   trans,
+                                            int                  m,
+                                            int                  n,
+                                            const void*          alpha,
+                                            const void*          A,
+                                            hipDataType          aType,
+                                            int                  lda,
+                                            hipblasStride        strideA,
+                                            const void*          x,
+                                            hipDataType          xType,
+                                            int                  incx,
+                                            hipblasStride        stridex,
+                                            const void*          beta,
+                                            void*                y,
+                                            hipDataType          yType,
+                                            int                  incy,
+                                            hipblasStride        stridey,
+                                            int                  batchCount,
+                                            hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_ENTRY(handle,
+                  trans,
+                  m,
+                  n,
+                  aType,
+                  lda,
+                  strideA,
+                  xType,
+                  incx,
+                  stridex,
+                  yType,
+                  incy,
+                  stridey,
+                  batchCount,
+                  computeType);
+    if(xType == aType && yType == aType)
+    {
+        hipblasStatus_t shaped = hipblasShapeDispatchGemvBatch(handle,
+                                                               trans,
+                                                               m,
+                                                               n,
+                                                               alpha,
+                                                               A,
+                                                               lda,
+                                                               strideA,
+                                                               x,
+                                                               incx,
+                                                               stridex,
+                                                               beta,
+                                                               y,
+                                                               incy,
+                                                               stridey,
+                                                               batchCount,
+                                                               aType,
+                                                               computeType);
+        if(shaped != HIPBLAS_STATUS_NOT_SUPPORTED)
+            return shaped;
+    }
+
+    return hipblasGemvStridedBatchedExImpl(handle,
+                                           trans,
+                                           m,
+                                           n,
+                                           alpha,
+                                           A,
+                                           aType,
+                                           lda,
+                                           strideA,
+                                           x,
+                                           xType,
+                                           incx,
+                                           stridex,
+                                           beta,
+                                           y,
+                                           yType,
+                                           incy,
+                                           stridey,
+                                           batchCount,
+                                           computeType);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// trsm_ex
+static const int hipblas_trsm_ex_block = 128;
+
+// The arguments of the cublas?trsm and cublas?trmm calls of trsmEx other than the sizes, alpha
+// and the matrices
+struct hipblasTrsmExOp
+{
+    cublasHandle_t    handle;
+    cublasSideMode_t  side;
+    cublasFillMode_t  uplo;
+    cublasOperation_t trans;
+    cublasDiagType_t  diag;
+};
+
+template <typename T, typename Trmm, typename Trsm>
+static cublasStatus_t hipblasTrsmExCublas(Trmm                   trmm_fn,
+                                          Trsm                   trsm_fn,
+                                          bool                   trmm,
+                                          const hipblasTrsmExOp& op,
+                                          int                    m,
+                                          int                    n,
+                                          const void*            alpha,
+                                          const void*            A,
+                                          int                    lda,
+                                          void*                  B,
+                                          int                    ldb)
+{
+    const T* s = static_cast<const T*>(alpha);
+    const T* a = static_cast<const T*>(A);
+    T*       b = static_cast<T*>(B);
+    if(trmm)
+        return trmm_fn(
+            op.handle, op.side, op.uplo, op.trans, op.diag, m, n, s, a, lda, b, ldb, b, ldb);
+    return trsm_fn(op.handle, op.side, op.uplo, op.trans, op.diag, m, n, s, a, lda, b, ldb);
+}
+
+// cublas?trsm, or cublas?trmm in place on B when trmm, for the types of trsmEx
+static cublasStatus_t hipblasTrsmExCublas(cudaDataType_t         type,
+                                          bool                   trmm,
+                                          const hipblasTrsmExOp& op,
+                                          int                    m,
+                                          int                    n,
+                                          const void*            alpha,
+                                          const void*            A,
+                                          int                    lda,
+                                          void*                  B,
+                                          int                    ldb)
+{
+    switch(type)
+    {
+    case CUDA_R_32F:
+        return hipblasTrsmExCublas<float>(
+            cublasStrmm, cublasStrsm, trmm, op, m, n, alpha, A, lda, B, ldb);
+    case CUDA_R_64F:
+        return hipblasTrsmExCublas<double>(
+            cublasDtrmm, cublasDtrsm, trmm, op, m, n, alpha, A, lda, B, ldb);
+    case CUDA_C_32F:
+        return hipblasTrsmExCublas<cuComplex>(
+            cublasCtrmm, cublasCtrsm, trmm, op, m, n, alpha, A, lda, B, ldb);
+    case CUDA_C_64F:
+        return hipblasTrsmExCublas<cuDoubleComplex>(
+            cublasZtrmm, cublasZtrsm, trmm, op, m, n, alpha, A, lda, B, ldb);
+    default:
+        return CUBLAS_STATUS_NOT_SUPPORTED;
+    }
+}
+
+// op(A) * X = alpha * B or X * op(A) = alpha * B with invA, the packed inverses of the diagonal
+// blocks of A. The blocks of X are solved in the order in which op(A) is triangular: each is
+// the product of the inverse of its diagonal block with its block of B, by trmm in place, and
+// is then subtracted from the rest of B by a gemm, the first of which also scales the rest of B
+// by alpha. The scalars are on the host.
+static cublasStatus_t hipblasTrsmExInvA(cudaDataType_t         type,
+                                        const hipblasTrsmExOp& op,
+                                        int                    m,
+                                        int                    n,
+                                        const void*            alpha,
+                                        const void*            A,
+                                        int                    lda,
+                                        void*                  B,
+                                        int                    ldb,
+                                        const void*            invA)
+{
+    const int nb = hipblas_trsm_ex_block;
+
+    size_t              elem_size = hipblasDatatypeSize(type);
+    bool                single    = type == CUDA_R_32F || type == CUDA_C_32F;
+    cublasComputeType_t compute   = single ? CUBLAS_COMPUTE_32F : CUBLAS_COMPUTE_64F;
+
+    static const float  one_f[2] = {1, 0}, minus_one_f[2] = {-1, 0};
+    static const double one_d[2] = {1, 0}, minus_one_d[2] = {-1, 0};
+    const void*         one       = single ? static_cast<const void*>(one_f) : one_d;
+    const void*         minus_one = single ? static_cast<const void*>(minus_one_f) : minus_one_d;
+
+    auto at = [elem_size](const void* p, size_t offset) {
+        return static_cast<char*>(const_cast<void*>(p)) + offset * elem_size;
+    };
+
+    // op(A) is lower triangular when A is lower and op(A) = A, or A is upper and op transposes
+    bool left    = op.side == CUBLAS_SIDE_LEFT;
+    bool lower   = (op.uplo == CUBLAS_FILL_MODE_LOWER) == (op.trans == CUBLAS_OP_N);
+    bool forward = lower == left;
+    int  k       = left ? m : n;
+    int  blocks  = (k - 1) / nb + 1;
+
+    cublasStatus_t status = CUBLAS_STATUS_SUCCESS;
+    for(int s = 0; s < blocks && status == CUBLAS_STATUS_SUCCESS; s++)
+    {
+        int         r     = forward ? s : blocks - 1 - s;
+        int         j0    = r * nb;
+        int         jb    = std::min(nb, k - j0);
+        int         rest0 = forward ? j0 + jb : 0;
+        int         rest  = forward ? k - j0 - jb : j0;
+        const void* scale = s == 0 ? alpha : one;
+        void*       Bj    = at(B, left ? j0 : size_t(j0) * ldb);
+
+        status = hipblasTrsmExCublas(type,
+                                     true,
+                                     op,
+                                     left ? jb : m,
+                                     left ? n : jb,
+                                     scale,
+                                     at(invA, size_t(r) * nb * nb),
+                                     nb,
+                                     Bj,
+                                     ldb);
+        if(status != CUBLAS_STATUS_SUCCESS || !rest)
+            continue;
+
+        // the block of op(A) between block r and the rest, where op(A)(i, j) is A(j, i) when op
+        // transposes
+        const void* Ar = at(A, left == (op.trans == CUBLAS_OP_N) ? rest0 + size_t(j0) * lda
+                                                                  : j0 + size_t(rest0) * lda);
+        if(left)
+            status = cublasGemmEx(op.handle,
+                                  op.trans,
+                                  CUBLAS_OP_N,
+                                  rest,
+                                  n,
+                                  jb,
+                                  minus_one,
+                                  Ar,
+                                  type,
+                                  lda,
+                                  Bj,
+                                  type,
+                                  ldb,
+                                  scale,
+                                  at(B, rest0),
+                                  type,
+                                  ldb,
+                                  compute,
+                                  CUBLAS_GEMM_DEFAULT);
+        else
+            status = cublasGemmEx(op.handle,
+                                  CUBLAS_OP_N,
+                                  op.trans,
+                                  m,
+                                  rest,
+                                  jb,
+                                  minus_one,
+                                  Bj,
+                                  type,
+                                  ldb,
+                                  Ar,
+                                  type,
+                                  lda,
+                                  scale,
+                                  at(B, size_t(rest0) * ldb),
+                                  type,
+                                  ldb,
+                                  compute,
+                                  CUBLAS_GEMM_DEFAULT);
+    }
+    return status;
+}
+
+// The trsmEx functions. Problems with invA, with at least 128 by k elements for each, are solved
+// by hipblasTrsmExInvA, with alpha read to the host, and others by cublas?trsm. A, B and invA are
+// arrays of pointers when batched. As with rocBLAS, A isn't referenced when alpha is zero.
+static hipblasStatus_t hipblasTrsmExImpl(hipblasHandle_t    handle,
+                                         hipblasSideMode_t  side,
+                                         hipblasFillMode_t  uplo,
+                                         hipblasOperation_t transA,
+                                         hipblasDiagType_t  diag,
+                                         int                m,
+                                         int                n,
+                                         const void*        alpha,
+                                         const void*        A,
+                                         int                lda,
+                                         hipblasStride      stride_A,
+                                         void*              B,
+                                         int                ldb,
+                                         hipblasStride      stride_B,
+                                         int                batch_count,
+                                         const void*        invA,
+                                         int                invA_size,
+                                         hipblasStride      stride_invA,
+                                         cudaDataType_t     type,
+                                         bool               batched)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if((side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+       || (uplo != HIPBLAS_FILL_MODE_LOWER && uplo != HIPBLAS_FILL_MODE_UPPER))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if((transA != HIPBLAS_OP_N && transA != HIPBLAS_OP_T && transA != HIPBLAS_OP_C)
+       || (diag != HIPBLAS_DIAG_NON_UNIT && diag != HIPBLAS_DIAG_UNIT))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(type != CUDA_R_32F && type != CUDA_R_64F && type != CUDA_C_32F && type != CUDA_C_64F)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    int k = side == HIPBLAS_SIDE_LEFT ? m : n;
+    if(m < 0 || n < 0 || lda < std::max(k, 1) || ldb < std::max(m, 1) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !B)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    cublasHandle_t  cublas = (cublasHandle_t)handle;
+    hipblasTrsmExOp op{cublas,
+                       hipblasConvertSide(side),
+                       hipblasConvertFill(uplo),
+                       hipblasConvertOperation(transA),
+                       hipblasConvertDiag(diag)};
+
+    size_t elem_size = hipblasDatatypeSize(type);
+    bool   use_invA  = A && invA && int64_t(invA_size) >= int64_t(hipblas_trsm_ex_block) * k;
+
+    cudaStream_t        stream;
+    cublasPointerMode_t pointer_mode;
+    cublasStatus_t      cublas_status = cublasGetPointerMode(cublas, &pointer_mode);
+    if(cublas_status == CUBLAS_STATUS_SUCCESS)
+        cublas_status = cublasGetStream(cublas, &stream);
+    if(cublas_status != CUBLAS_STATUS_SUCCESS)
+        return hipblasConvertStatus(cublas_status);
+
+    double alpha_host[2] = {};
+    if(use_invA || !A)
+    {
+        if(pointer_mode == CUBLAS_POINTER_MODE_HOST)
+            memcpy(alpha_host, alpha, elem_size);
+        else if(cudaMemcpyAsync(alpha_host, alpha, elem_size, cudaMemcpyDeviceToHost, stream)
+                    != cudaSuccess
+                || cudaStreamSynchronize(stream) != cudaSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    // without A, B is set to zero when alpha is zero
+    if(!A)
+    {
+        const float* alpha_f = reinterpret_cast<const float*>(alpha_host);
+        bool         zero    = type == CUDA_R_32F || type == CUDA_C_32F
+                                   ? alpha_f[0] == 0 && alpha_f[1] == 0
+                                   : alpha_host[0] == 0 && alpha_host[1] == 0;
+        if(!zero)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    if(use_invA && pointer_mode != CUBLAS_POINTER_MODE_HOST)
+    {
+        cublas_status = cublasSetPointerMode(cublas, CUBLAS_POINTER_MODE_HOST);
+        if(cublas_status != CUBLAS_STATUS_SUCCESS)
+            return hipblasConvertStatus(cublas_status);
+    }
+    if(use_invA)
+        alpha = alpha_host;
+
+    auto solve = [&](const void* Ab, void* Bb, const void* invAb) {
+        if(!A)
+        {
+            cudaStream_t problem_stream;
+            if(cublasGetStream(cublas, &problem_stream) != CUBLAS_STATUS_SUCCESS
+               || cudaMemset2DAsync(Bb, ldb * elem_size, 0, m * elem_size, n, problem_stream)
+                      != cudaSuccess)
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+        return hipblasConvertStatus(
+            use_invA ? hipblasTrsmExInvA(type, op, m, n, alpha, Ab, lda, Bb, ldb, invAb)
+                     : hipblasTrsmExCublas(type, false, op, m, n, alpha, Ab, lda, Bb, ldb));
+    };
+    auto at = [elem_size](const void* p, int64_t b, hipblasStride stride) {
+        return p ? static_cast<char*>(const_cast<void*>(p)) + b * stride * elem_size : nullptr;
+    };
+
+    // the arrays of pointers of the batched functions, with B for those that aren't used
+    const void* A_array    = A ? A : B;
+    const void* invA_array = use_invA ? invA : B;
+
+    hipblasStatus_t status;
+    if(!batched && batch_count == 1)
+        status = solve(A, B, invA);
+    else if(!batched)
+        status = hipblasBatchedFallback(handle, batch_count, [&](int64_t b) {
+            return solve(at(A, b, stride_A), at(B, b, stride_B), at(invA, b, stride_invA));
+        });
+    else
+        status = hipblasBatchedFallback(
+            handle,
+            batch_count,
+            {A_array, B, invA_array},
+            [&](int64_t b, const hipblasHostPointers& pointers) {
+                return solve(pointers(static_cast<const void* const*>(A_array), b),
+                             pointers(static_cast<void* const*>(B), b),
+                             pointers(static_cast<const void* const*>(invA_array), b));
+            });
+
+    if(use_invA && pointer_mode != CUBLAS_POINTER_MODE_HOST)
+    {
+        cublas_status = cublasSetPointerMode(cublas, pointer_mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasConvertStatus(cublas_status);
+    }
+    return status;
+}
+
+hipblasStatus_t hipblasTrsmEx(hipblasHandle_t    handle,
+                              hipblasSideMode_t  side,
+                              hipblasFillMode_t  uplo,
+                              hipblasOperation_t transA,
+                              hipblasDiagType_t  diag,
+                              int                m,
+                              int                n,
+                              const void*        alpha,
+                              void*              A,
+                              int                lda,
+                              void*              B,
+                              int                ldb,
+                              const void*        invA,
+                              int                invA_size,
+                              hipblasDatatype_t  compute_type)
+try
+{
+    HIPBLAS_ENTRY(handle, side, uplo, transA, diag, m, n, lda, ldb, invA_size, compute_type);
+
+    return hipblasTrsmExImpl(handle,
+                             side,
+                             uplo,
+                             transA,
+                             diag,
+                             m,
+                             n,
+                             alpha,
+                             A,
+                             lda,
+                             0,
+                             B,
+                             ldb,
+                             0,
+                             1,
+                             invA,
+                             invA_size,
+                             0,
+                             hipblasConvertDatatype(compute_type),
+                             false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasTrsmEx_v2(hipblasHandle_t    handle,
+                                 hipblasSideMode_t  side,
+                                 hipblasFillMode_t  uplo,
+                                 hipblasOperation_t transA,
+                                 hipblasDiagType_t  diag,
+                                 int                m,
+                                 int                n,
+                                 const void*        alpha,
+                                 void*              A,
+                                 int                lda,
+                                 void*              B,
+                                 int                ldb,
+                                 const void*        invA,
+                                 int                invA_size,
+                                 hipDataType        compute_type)
+try
+{
+    HIPBLAS_ENTRY(handle, side, uplo, transA, diag, m, n, lda, ldb, invA_size, compute_type);
+
+    return hipblasTrsmExImpl(handle,
+                             side,
+                             uplo,
+                             transA,
+                             diag,
+                             m,
+                             n,
+                             alpha,
+                             A,
+                             lda,
+                             0,
+                             B,
+                             ldb,
+                             0,
+                             1,
+                             invA,
+                             invA_size,
+                             0,
+                             hipblasConvertDatatype_v2(compute_type),
+                             false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasTrsmBatchedEx(hipblasHandle_t    handle,
+                                     hipblasSideMode_t  side,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t transA,
+                                     hipblasDiagType_t  diag,
+                                     int                m,
+                                     int                n,
+                                     const void*        alpha,
+                                     void*              A,
+                                     int                lda,
+                                     void*              B,
+                                     int                ldb,
+                                     int                batch_count,
+                                     const void*        invA,
+                                     int                invA_size,
+                                     hipblasDatatype_t  compute_type)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, side, uplo, transA, diag, m, n, lda, ldb, batch_count, invA_size, compute_type);
+
+    return hipblasTrsmExImpl(handle,
+                             side,
+                             uplo,
+                             transA,
+                             diag,
+                             m,
+                             n,
+                             alpha,
+                             A,
+                             lda,
+                             0,
+                             B,
+                             ldb,
+                             0,
+                             batch_count,
+                             invA,
+                             invA_size,
+                             0,
+                             hipblasConvertDatatype(compute_type),
+                             true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasTrsmBatchedEx_v2(hipblasHandle_t    handle,
+                                        hipblasSideMode_t  side,
+                                        hipblasFillMode_t  uplo,
+                                        hipblasOperation_t transA,
+                                        hipblasDiagType_t  diag,
+                                        int                m,
+                                        int                n,
+                                        const void*        alpha,
+                                        void*              A,
+                                        int                lda,
+                                        void*              B,
+                                        int                ldb,
+                                        int                batch_count,
+                                        const void*        invA,
+                                        int                invA_size,
+                                        hipDataType        compute_type)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, side, uplo, transA, diag, m, n, lda, ldb, batch_count, invA_size, compute_type);
+
+    return hipblasTrsmExImpl(handle,
+                             side,
+                             uplo,
+                             transA,
+                             diag,
+                             m,
+                             n,
+                             alpha,
+                             A,
+                             lda,
+                             0,
+                             B,
+                             ldb,
+                             0,
+                             batch_count,
+                             invA,
+                             invA_size,
+                             0,
+                             hipblasConvertDatatype_v2(compute_type),
+                             true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasTrsmStridedBatchedEx(hipblasHandle_t    handle,
+                                            hipblasSideMode_t  side,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            hipblasDiagType_t  diag,
+                                            int                m,
+                                            int                n,
+                                            const void*        alpha,
+                                            void*              A,
+                                            int                lda,
+                                            hipblasStride      stride_A,
+                                            void*              B,
+                                            int                ldb,
+                                            hipblasStride      stride_B,
+                                            int                batch_count,
+                                            const void*        invA,
+                                            int                invA_size,
+                                            hipblasStride      stride_invA,
+                                            hipblasDatatype_t  compute_type)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, side, uplo, transA, diag, m, n, lda, ldb, batch_count, invA_size, compute_type);
+
+    return hipblasTrsmExImpl(handle,
+                             side,
+                             uplo,
+                             transA,
+                             diag,
+                             m,
+                             n,
+                             alpha,
+                             A,
+                             lda,
+                             stride_A,
+                             B,
+                             ldb,
+                             stride_B,
+                             batch_count,
+                             invA,
+                             invA_size,
+                             stride_invA,
+                             hipblasConvertDatatype(compute_type),
+                             false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasTrsmStridedBatchedEx_v2(hipblasHandle_t    handle,
+                                               hipblasSideMode_t  side,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int                m,
+                                               int                n,
+                                               const void*        alpha,
+                                               void*              A,
+                                               int                lda,
+                                               hipblasStride      stride_A,
+                                               void*              B,
+                                               int                ldb,
+                                               hipblasStride      stride_B,
+                                               int                batch_count,
+                                               const void*        invA,
+                                               int                invA_size,
+                                               hipblasStride      stride_invA,
+                                               hipDataType        compute_type)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, side, uplo, transA, diag, m, n, lda, ldb, batch_count, invA_size, compute_type);
+
+    return hipblasTrsmExImpl(handle,
+                             side,
+                             uplo,
+                             transA,
+                             diag,
+                             m,
+                             n,
+                             alpha,
+                             A,
+                             lda,
+                             stride_A,
+                             B,
+                             ldb,
+                             stride_B,
+                             batch_count,
+                             invA,
+                             invA_size,
+                             stride_invA,
+                             hipblasConvertDatatype_v2(compute_type),
+                             false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// // syrk_ex
+// hipblasStatus_t hipblasCsyrkEx(hipblasHandle_t       handle,
+//                                           hipblasFillMode_t     uplo,
+//                                           hipblasOperation_t    trans,
+//                                           int                   n,
+//                                           int                   k,
+//                                           const hipblasComplex* alpha,
+//                                           const void*           A,
+//                                           hipblasDatatype_t     Atype,
+//                                           int                   lda,
+//                                           const hipblasComplex* beta,
+//                                           hipblasComplex*       C,
+//                                           hipblasDatatype_t     Ctype,
+//                                           int                   ldc)
+// try
+//{
+//     return hipblasConvertStatus(cublasCsyrkEx((cublasHandle_t)handle,
+//                                                     hipblasConvertFill(uplo),
+//                                                     hipblasConvertOperation(trans),
+//                                                     n,
+//                                                     k,
+//                                                     (cuComplex*)alpha,
+//                                                     A,
+//                                                     hipblasConvertDatatype(Atype),
+//                                                     lda,
+//                                                     (cuComplex*)beta,
+//                                                     (cuComplex*)C,
+//                                                     hipblasConvertDatatype(Ctype),
+//                                                     ldc));
+// }
+// catch(...)
+// {
+//     return hipblas_exception_to_status();
+// }
+
+// // herk_ex
+// hipblasStatus_t hipblasCherkEx(hipblasHandle_t    handle,
+//                                           hipblasFillMode_t  uplo,
+//                                           hipblasOperation_t trans,
+//                                           int                n,
+//                                           int                k,
+//                                           const float*       alpha,
+//                                           const void*        A,
+//                                           hipblasDatatype_t  Atype,
+//                                           int                lda,
+//                                           const float*       beta,
+//                                           hipblasComplex*    C,
+//                                           hipblasDatatype_t  Ctype,
+//                                           int                ldc)
+// try
+// {
+//     return hipblasConvertStatus(cublasCherkEx((cublasHandle_t)handle,
+//                                                     hipblasConvertFill(uplo),
+//                                                     hipblasConvertOperation(trans),
+//                                                     n,
+//                                                     k,
+//                                                     alpha,
+//                                                     A,
+//                                                     hipblasConvertDatatype(Atype),
+//                                                     lda,
+//                                                     beta,
+//                                                     (cuComplex*)C,
+//                                                     hipblasConvertDatatype(Ctype),
+//                                                     ldc));
+// }
+// catch(...)
+// {
+//     return hipblas_exception_to_status();
+// }
+
+// axpy_ex
+hipblasStatus_t hipblasAxpyEx(hipblasHandle_t   handle,
+                              int               n,
+                              const void*       alpha,
+                              hipblasDatatype_t alphaType,
+                              const void*       x,
+                              hipblasDatatype_t xType,
+                              int               incx,
+                              void*             y,
+                              hipblasDatatype_t yType,
+                              int               incy,
+                              hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, yType, incy, executionType);
+    return hipblasConvertStatus(cublasAxpyEx((cublasHandle_t)handle,
+                                             n,
+                                             alpha,
+                                             hipblasConvertDatatype(alphaType),
+                                             x,
+                                             hipblasConvertDatatype(xType),
+                                             incx,
+                                             y,
+                                             hipblasConvertDatatype(yType),
+                                             incy,
+                                             hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasAxpyEx_v2(hipblasHandle_t handle,
+                                 int             n,
+                                 const void*     alpha,
+                                 hipDataType     alphaType,
+                                 const void*     x,
+                                 hipDataType     xType,
+                                 int             incx,
+                                 void*           y,
+                                 hipDataType     yType,
+                                 int             incy,
+                                 hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, yType, incy, executionType);
+    hipblasStatus_t rounded = hipblasRoundedAxpyEx(handle,
+                                                   n,
+                                                   alpha,
+                                                   alphaType,
+                                                   x,
+                                                   xType,
+                                                   incx,
+                                                   y,
+                                                   yType,
+                                                   incy,
+                                                   executionType);
+    if(rounded != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return rounded;
+    return hipblasConvertStatus(cublasAxpyEx((cublasHandle_t)handle,
+                                             n,
+                                             alpha,
+                                             hipblasConvertDatatype_v2(alphaType),
+                                             x,
+                                             hipblasConvertDatatype_v2(xType),
+                                             incx,
+                                             y,
+                                             hipblasConvertDatatype_v2(yType),
+                                             incy,
+                                             hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasAxpyBatchedEx(hipblasHandle_t   handle,
+                                     int               n,
+                                     const void*       alpha,
+                                     hipblasDatatype_t alphaType,
+                                     const void*       x,
+                                     hipblasDatatype_t xType,
+                                     int               incx,
+                                     void*             y,
+                                     hipblasDatatype_t yType,
+                                     int               incy,
+                                     int               batch_count,
+                                     hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasAxpyBatchedEx_v2(hipblasHandle_t handle,
+                                        int             n,
+                                        const void*     alpha,
+                                        hipDataType     alphaType,
+                                        const void*     x,
+                                        hipDataType     xType,
+                                        int             incx,
+                                        void*           y,
+                                        hipDataType     yType,
+                                        int             incy,
+                                        int             batch_count,
+                                        hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasAxpyStridedBatchedEx(hipblasHandle_t   handle,
+                                            int               n,
+                                            const void*       alpha,
+                                            hipblasDatatype_t alphaType,
+                                            const void*       x,
+                                            hipblasDatatype_t xType,
+                                            int               incx,
+                                            hipblasStride     stridex,
+                                            void*             y,
+                                            hipblasDatatype_t yType,
+                                            int               incy,
+                                            hipblasStride     stridey,
+                                            int               batch_count,
+                                            hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasAxpyStridedBatchedEx_v2(hipblasHandle_t handle,
+                                               int             n,
+                                               const void*     alpha,
+                                               hipDataType     alphaType,
+                                               const void*     x,
+                                               hipDataType     xType,
+                                               int             incx,
+                                               hipblasStride   stridex,
+                                               void*           y,
+                                               hipDataType     yType,
+                                               int             incy,
+                                               hipblasStride   stridey,
+                                               int             batch_count,
+                                               hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+#if CUBLAS_VER_MAJOR < 12
+// The elementwise 64-bit Ex functions are computed by calling the 32-bit functions of cuBLAS 11 on
+// chunks of at most hipblas_tile_32 elements, with the offsets in elements of the chunks in x and
+// y. With a negative increment cuBLAS starts with the last element of a vector, so the chunks of
+// that vector are counted from its end.
+using hipblasVectorExChunk
+    = std::function<cublasStatus_t(int n, int64_t x_offset, int64_t y_offset)>;
+
+static cublasStatus_t hipblasCublasVectorExChunked_64(int64_t                     n,
+                                                      int64_t                     incx,
+                                                      int64_t                     incy,
+                                                      const hipblasVectorExChunk& chunk)
+{
+    if(!hipblasFitsInt32(incx) || !hipblasFitsInt32(incy))
+        return CUBLAS_STATUS_NOT_SUPPORTED;
+    if(hipblasFitsInt32(n))
+        return chunk(int(n), 0, 0);
+    if(n < 0)
+        return CUBLAS_STATUS_SUCCESS;
+
+    for(int64_t i = 0; i < n; i += hipblas_tile_32)
+    {
+        int64_t        n_chunk  = std::min(n - i, hipblas_tile_32);
+        int64_t        x_offset = incx >= 0 ? i * incx : (n - i - n_chunk) * -incx;
+        int64_t        y_offset = incy >= 0 ? i * incy : (n - i - n_chunk) * -incy;
+        cublasStatus_t status   = chunk(int(n_chunk), x_offset, y_offset);
+        if(status != CUBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    return CUBLAS_STATUS_SUCCESS;
+}
+#endif
+
+// axpy_ex_64
+hipblasStatus_t hipblasAxpyEx_64(hipblasHandle_t   handle,
+                                 int64_t           n,
+                                 const void*       alpha,
+                                 hipblasDatatype_t alphaType,
+                                 const void*       x,
+                                 hipblasDatatype_t xType,
+                                 int64_t           incx,
+                                 void*             y,
+                                 hipblasDatatype_t yType,
+                                 int64_t           incy,
+                                 hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, yType, incy, executionType);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasAxpyEx_64((cublasHandle_t)handle,
+                                                n,
+                                                alpha,
+                                                hipblasConvertDatatype(alphaType),
+                                                x,
+                                                hipblasConvertDatatype(xType),
+                                                incx,
+                                                y,
+                                                hipblasConvertDatatype(yType),
+                                                incy,
+                                                hipblasConvertDatatype(executionType)));
+#else
+    cudaDataType_t x_type = hipblasConvertDatatype(xType);
+    cudaDataType_t y_type = hipblasConvertDatatype(yType);
+    auto           axpy   = [&](int n_chunk, int64_t x_offset, int64_t y_offset) {
+        return cublasAxpyEx((cublasHandle_t)handle,
+                            n_chunk,
+                            alpha,
+                            hipblasConvertDatatype(alphaType),
+                            (const char*)x + x_offset * hipblasDatatypeSize(x_type),
+                            x_type,
+                            int(incx),
+                            (char*)y + y_offset * hipblasDatatypeSize(y_type),
+                            y_type,
+                            int(incy),
+                            hipblasConvertDatatype(executionType));
+    };
+    return hipblasConvertStatus(hipblasCublasVectorExChunked_64(n, incx, incy, axpy));
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasAxpyEx_v2_64(hipblasHandle_t handle,
+                                    int64_t         n,
+                                    const void*     alpha,
+                                    hipDataType     alphaType,
+                                    const void*     x,
+                                    hipDataType     xType,
+                                    int64_t         incx,
+                                    void*           y,
+                                    hipDataType     yType,
+                                    int64_t         incy,
+                                    hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, yType, incy, executionType);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasAxpyEx_64((cublasHandle_t)handle,
+                                                n,
+                                                alpha,
+                                                hipblasConvertDatatype_v2(alphaType),
+                                                x,
+                                                hipblasConvertDatatype_v2(xType),
+                                                incx,
+                                                y,
+                                                hipblasConvertDatatype_v2(yType),
+                                                incy,
+                                                hipblasConvertDatatype_v2(executionType)));
+#else
+    cudaDataType_t x_type = hipblasConvertDatatype_v2(xType);
+    cudaDataType_t y_type = hipblasConvertDatatype_v2(yType);
+    auto           axpy   = [&](int n_chunk, int64_t x_offset, int64_t y_offset) {
+        return cublasAxpyEx((cublasHandle_t)handle,
+                            n_chunk,
+                            alpha,
+                            hipblasConvertDatatype_v2(alphaType),
+                            (const char*)x + x_offset * hipblasDatatypeSize(x_type),
+                            x_type,
+                            int(incx),
+                            (char*)y + y_offset * hipblasDatatypeSize(y_type),
+                            y_type,
+                            int(incy),
+                            hipblasConvertDatatype_v2(executionType));
+    };
+    return hipblasConvertStatus(hipblasCublasVectorExChunked_64(n, incx, incy, axpy));
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasAxpyBatchedEx_64(hipblasHandle_t   handle,
+                                        int64_t           n,
+                                        const void*       alpha,
+                                        hipblasDatatype_t alphaType,
+                                        const void*       x,
+                                        hipblasDatatype_t xType,
+                                        int64_t           incx,
+                                        void*             y,
+                                        hipblasDatatype_t yType,
+                                        int64_t           incy,
+                                        int64_t           batch_count,
+                                        hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasAxpyBatchedEx_v2_64(hipblasHandle_t handle,
+                                           int64_t         n,
+                                           const void*     alpha,
+                                           hipDataType     alphaType,
+                                           const void*     x,
+                                           hipDataType     xType,
+                                           int64_t         incx,
+                                           void*           y,
+                                           hipDataType     yType,
+                                           int64_t         incy,
+                                           int64_t         batch_count,
+                                           hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasAxpyStridedBatchedEx_64(hipblasHandle_t   handle,
+                                               int64_t           n,
+                                               const void*       alpha,
+                                               hipblasDatatype_t alphaType,
+                                               const void*       x,
+                                               hipblasDatatype_t xType,
+                                               int64_t           incx,
+                                               hipblasStride     stridex,
+                                               void*             y,
+                                               hipblasDatatype_t yType,
+                                               int64_t           incy,
+                                               hipblasStride     stridey,
+                                               int64_t           batch_count,
+                                               hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasAxpyStridedBatchedEx_v2_64(hipblasHandle_t handle,
+                                                  int64_t         n,
+                                                  const void*     alpha,
+                                                  hipDataType     alphaType,
+                                                  const void*     x,
+                                                  hipDataType     xType,
+                                                  int64_t         incx,
+                                                  hipblasStride   stridex,
+                                                  void*           y,
+                                                  hipDataType     yType,
+                                                  int64_t         incy,
+                                                  hipblasStride   stridey,
+                                                  int64_t         batch_count,
+                                                  hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// dot_ex
+hipblasStatus_t hipblasDotEx(hipblasHandle_t   handle,
+                             int               n,
+                             const void*       x,
+                             hipblasDatatype_t xType,
+                             int               incx,
+                             const void*       y,
+                             hipblasDatatype_t yType,
+                             int               incy,
+                             void*             result,
+                             hipblasDatatype_t resultType,
+                             hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(cublasDotEx((cublasHandle_t)handle,
+                                            n,
+                                            x,
+                                            hipblasConvertDatatype(xType),
+                                            incx,
+                                            y,
+                                            hipblasConvertDatatype(yType),
+                                            incy,
+                                            result,
+                                            hipblasConvertDatatype(resultType),
+                                            hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotEx_v2(hipblasHandle_t handle,
+                                int             n,
+                                const void*     x,
+                                hipDataType     xType,
+                                int             incx,
+                                const void*     y,
+                                hipDataType     yType,
+                                int             incy,
+                                void*           result,
+                                hipDataType     resultType,
+                                hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(cublasDotEx((cublasHandle_t)handle,
+                                            n,
+                                            x,
+                                            hipblasConvertDatatype_v2(xType),
+                                            incx,
+                                            y,
+                                            hipblasConvertDatatype_v2(yType),
+                                            incy,
+                                            result,
+                                            hipblasConvertDatatype_v2(resultType),
+                                            hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotcEx(hipblasHandle_t   handle,
+                              int               n,
+                              const void*       x,
+                              hipblasDatatype_t xType,
+                              int               incx,
+                              const void*       y,
+                              hipblasDatatype_t yType,
+                              int               incy,
+                              void*             result,
+                              hipblasDatatype_t resultType,
+                              hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(cublasDotcEx((cublasHandle_t)handle,
+                                             n,
+                                             x,
+                                             hipblasConvertDatatype(xType),
+                                             incx,
+                                             y,
+                                             hipblasConvertDatatype(yType),
+                                             incy,
+                                             result,
+                                             hipblasConvertDatatype(resultType),
+                                             hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotcEx_v2(hipblasHandle_t handle,
+                                 int             n,
+                                 const void*     x,
+                                 hipDataType     xType,
+                                 int             incx,
+                                 const void*     y,
+                                 hipDataType     yType,
+                                 int             incy,
+                                 void*           result,
+                                 hipDataType     resultType,
+                                 hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(cublasDotcEx((cublasHandle_t)handle,
+                                             n,
+                                             x,
+                                             hipblasConvertDatatype_v2(xType),
+                                             incx,
+                                             y,
+                                             hipblasConvertDatatype_v2(yType),
+                                             incy,
+                                             result,
+                                             hipblasConvertDatatype_v2(resultType),
+                                             hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotBatchedEx(hipblasHandle_t   handle,
+                                    int               n,
+                                    const void*       x,
+                                    hipblasDatatype_t xType,
+                                    int               incx,
+                                    const void*       y,
+                                    hipblasDatatype_t yType,
+                                    int               incy,
+                                    int               batch_count,
+                                    void*             result,
+                                    hipblasDatatype_t resultType,
+                                    hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDotBatchedEx_v2(hipblasHandle_t handle,
+                                       int             n,
+                                       const void*     x,
+                                       hipDataType     xType,
+                                       int             incx,
+                                       const void*     y,
+                                       hipDataType     yType,
+                                       int             incy,
+                                       int             batch_count,
+                                       void*           result,
+                                       hipDataType     resultType,
+                                       hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDotcBatchedEx(hipblasHandle_t   handle,
+                                     int               n,
+                                     const void*       x,
+                                     hipblasDatatype_t xType,
+                                     int               incx,
+                                     const void*       y,
+                                     hipblasDatatype_t yType,
+                                     int               incy,
+                                     int               batch_count,
+                                     void*             result,
+                                     hipblasDatatype_t resultType,
+                                     hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDotcBatchedEx_v2(hipblasHandle_t handle,
+                                        int             n,
+                                        const void*     x,
+                                        hipDataType     xType,
+                                        int             incx,
+                                        const void*     y,
+                                        hipDataType     yType,
+                                        int             incy,
+                                        int             batch_count,
+                                        void*           result,
+                                        hipDataType     resultType,
+                                        hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDotStridedBatchedEx(hipblasHandle_t   handle,
+                                           int               n,
+                                           const void*       x,
+                                           hipblasDatatype_t xType,
+                                           int               incx,
+                                           hipblasStride     stridex,
+                                           const void*       y,
+                                           hipblasDatatype_t yType,
+                                           int               incy,
+                                           hipblasStride     stridey,
+                                           int               batch_count,
+                                           void*             result,
+                                           hipblasDatatype_t resultType,
+                                           hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDotStridedBatchedEx_v2(hipblasHandle_t handle,
+                                              int             n,
+                                              const void*     x,
+                                              hipDataType     xType,
+                                              int             incx,
+                                              hipblasStride   stridex,
+                                              const void*     y,
+                                              hipDataType     yType,
+                                              int             incy,
+                                              hipblasStride   stridey,
+                                              int             batch_count,
+                                              void*           result,
+                                              hipDataType     resultType,
+                                              hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDotcStridedBatchedEx(hipblasHandle_t   handle,
+                                            int               n,
+                                            const void*       x,
+                                            hipblasDatatype_t xType,
+                                            int               incx,
+                                            hipblasStride     stridex,
+                                            const void*       y,
+                                            hipblasDatatype_t yType,
+                                            int               incy,
+                                            hipblasStride     stridey,
+                                            int               batch_count,
+                                            void*             result,
+                                            hipblasDatatype_t resultType,
+                                            hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDotcStridedBatchedEx_v2(hipblasHandle_t handle,
+                                               int             n,
+                                               const void*     x,
+                                               hipDataType     xType,
+                                               int             incx,
+                                               hipblasStride   stridex,
+                                               const void*     y,
+                                               hipDataType     yType,
+                                               int             incy,
+                                               hipblasStride   stridey,
+                                               int             batch_count,
+                                               void*           result,
+                                               hipDataType     resultType,
+                                               hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// dot_ex_64
+hipblasStatus_t hipblasDotEx_64(hipblasHandle_t   handle,
+                                int64_t           n,
+                                const void*       x,
+                                hipblasDatatype_t xType,
+                                int64_t           incx,
+                                const void*       y,
+                                hipblasDatatype_t yType,
+                                int64_t           incy,
+                                void*             result,
+                                hipblasDatatype_t resultType,
+                                hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasDotEx_64((cublasHandle_t)handle,
+                                               n,
+                                               x,
+                                               hipblasConvertDatatype(xType),
+                                               incx,
+                                               y,
+                                               hipblasConvertDatatype(yType),
+                                               incy,
+                                               result,
+                                               hipblasConvertDatatype(resultType),
+                                               hipblasConvertDatatype(executionType)));
+#else
+    // the results of chunks of n would have to be summed on the device
+    if(!hipblasFitsInt32(n) || !hipblasFitsInt32(incx) || !hipblasFitsInt32(incy))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasConvertStatus(cublasDotEx((cublasHandle_t)handle,
+                                            int(n),
+                                            x,
+                                            hipblasConvertDatatype(xType),
+                                            int(incx),
+                                            y,
+                                            hipblasConvertDatatype(yType),
+                                            int(incy),
+                                            result,
+                                            hipblasConvertDatatype(resultType),
+                                            hipblasConvertDatatype(executionType)));
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotEx_v2_64(hipblasHandle_t handle,
+                                   int64_t         n,
+                                   const void*     x,
+                                   hipDataType     xType,
+                                   int64_t         incx,
+                                   const void*     y,
+                                   hipDataType     yType,
+                                   int64_t         incy,
+                                   void*           result,
+                                   hipDataType     resultType,
+                                   hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasDotEx_64((cublasHandle_t)handle,
+                                               n,
+                                               x,
+                                               hipblasConvertDatatype_v2(xType),
+                                               incx,
+                                               y,
+                                               hipblasConvertDatatype_v2(yType),
+                                               incy,
+                                               result,
+                                               hipblasConvertDatatype_v2(resultType),
+                                               hipblasConvertDatatype_v2(executionType)));
+#else
+    // the results of chunks of n would have to be summed on the device
+    if(!hipblasFitsInt32(n) || !hipblasFitsInt32(incx) || !hipblasFitsInt32(incy))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasConvertStatus(cublasDotEx((cublasHandle_t)handle,
+                                            int(n),
+                                            x,
+                                            hipblasConvertDatatype_v2(xType),
+                                            int(incx),
+                                            y,
+                                            hipblasConvertDatatype_v2(yType),
+                                            int(incy),
+                                            result,
+                                            hipblasConvertDatatype_v2(resultType),
+                                            hipblasConvertDatatype_v2(executionType)));
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotcEx_64(hipblasHandle_t   handle,
+                                 int64_t           n,
+                                 const void*       x,
+                                 hipblasDatatype_t xType,
+                                 int64_t           incx,
+                                 const void*       y,
+                                 hipblasDatatype_t yType,
+                                 int64_t           incy,
+                                 void*             result,
+                                 hipblasDatatype_t resultType,
+                                 hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasDotcEx_64((cublasHandle_t)handle,
+                                                n,
+                                                x,
+                                                hipblasConvertDatatype(xType),
+                                                incx,
+                                                y,
+                                                hipblasConvertDatatype(yType),
+                                                incy,
+                                                result,
+                                                hipblasConvertDatatype(resultType),
+                                                hipblasConvertDatatype(executionType)));
+#else
+    // the results of chunks of n would have to be summed on the device
+    if(!hipblasFitsInt32(n) || !hipblasFitsInt32(incx) || !hipblasFitsInt32(incy))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasConvertStatus(cublasDotcEx((cublasHandle_t)handle,
+                                             int(n),
+                                             x,
+                                             hipblasConvertDatatype(xType),
+                                             int(incx),
+                                             y,
+                                             hipblasConvertDatatype(yType),
+                                             int(incy),
+                                             result,
+                                             hipblasConvertDatatype(resultType),
+                                             hipblasConvertDatatype(executionType)));
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotcEx_v2_64(hipblasHandle_t handle,
+                                    int64_t         n,
+                                    const void*     x,
+                                    hipDataType     xType,
+                                    int64_t         incx,
+                                    const void*     y,
+                                    hipDataType     yType,
+                                    int64_t         incy,
+                                    void*           result,
+                                    hipDataType     resultType,
+                                    hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasDotcEx_64((cublasHandle_t)handle,
+                                                n,
+                                                x,
+                                                hipblasConvertDatatype_v2(xType),
+                                                incx,
+                                                y,
+                                                hipblasConvertDatatype_v2(yType),
+                                                incy,
+                                                result,
+                                                hipblasConvertDatatype_v2(resultType),
+                                                hipblasConvertDatatype_v2(executionType)));
+#else
+    // the results of chunks of n would have to be summed on the device
+    if(!hipblasFitsInt32(n) || !hipblasFitsInt32(incx) || !hipblasFitsInt32(incy))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasConvertStatus(cublasDotcEx((cublasHandle_t)handle,
+                                             int(n),
+                                             x,
+                                             hipblasConvertDatatype_v2(xType),
+                                             int(incx),
+                                             y,
+                                             hipblasConvertDatatype_v2(yType),
+                                             int(incy),
+                                             result,
+                                             hipblasConvertDatatype_v2(resultType),
+                                             hipblasConvertDatatype_v2(executionType)));
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDotBatchedEx_64(hipblasHandle_t   handle,
+                                       int64_t           n,
+                                       const void*       x,
+                                       hipblasDatatype_t xType,
+                                       int64_t           incx,
+                                       const void*       y,
+                                       hipblasDatatype_t yType,
+                                       int64_t           incy,
+                                       int64_t           batch_count,
+                                       void*             result,
+                                       hipblasDatatype_t resultType,
+                                       hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDotBatchedEx_v2_64(hipblasHandle_t handle,
+                                          int64_t         n,
+                                          const void*     x,
+                                          hipDataType     xType,
+                                          int64_t         incx,
+                                          const void*     y,
+                                          hipDataType     yType,
+                                          int64_t         incy,
+                                          int64_t         batch_count,
+                                          void*           result,
+                                          hipDataType     resultType,
+                                          hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDotcBatchedEx_64(hipblasHandle_t   handle,
+                                        int64_t           n,
+                                        const void*       x,
+                                        hipblasDatatype_t xType,
+                                        int64_t           incx,
+                                        const void*       y,
+                                        hipblasDatatype_t yType,
+                                        int64_t           incy,
+                                        int64_t           batch_count,
+                                        void*             result,
+                                        hipblasDatatype_t resultType,
+                                        hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDotcBatchedEx_v2_64(hipblasHandle_t handle,
+                                           int64_t         n,
+                                           const void*     x,
+                                           hipDataType     xType,
+                                           int64_t         incx,
+                                           const void*     y,
+                                           hipDataType     yType,
+                                           int64_t         incy,
+                                           int64_t         batch_count,
+                                           void*           result,
+                                           hipDataType     resultType,
+                                           hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDotStridedBatchedEx_64(hipblasHandle_t   handle,
+                                              int64_t           n,
+                                              const void*       x,
+                                              hipblasDatatype_t xType,
+                                              int64_t           incx,
+                                              hipblasStride     stridex,
+                                              const void*       y,
+                                              hipblasDatatype_t yType,
+                                              int64_t           incy,
+                                              hipblasStride     stridey,
+                                              int64_t           batch_count,
+                                              void*             result,
+                                              hipblasDatatype_t resultType,
+                                              hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDotStridedBatchedEx_v2_64(hipblasHandle_t handle,
+                                                 int64_t         n,
+                                                 const void*     x,
+                                                 hipDataType     xType,
+                                                 int64_t         incx,
+                                                 hipblasStride   stridex,
+                                                 const void*     y,
+                                                 hipDataType     yType,
+                                                 int64_t         incy,
+                                                 hipblasStride   stridey,
+                                                 int64_t         batch_count,
+                                                 void*           result,
+                                                 hipDataType     resultType,
+                                                 hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDotcStridedBatchedEx_64(hipblasHandle_t   handle,
+                                               int64_t           n,
+                                               const void*       x,
+                                               hipblasDatatype_t xType,
+                                               int64_t           incx,
+                                               hipblasStride     stridex,
+                                               const void*       y,
+                                               hipblasDatatype_t yType,
+                                               int64_t           incy,
+                                               hipblasStride     stridey,
+                                               int64_t           batch_count,
+                                               void*             result,
+                                               hipblasDatatype_t resultType,
+                                               hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDotcStridedBatchedEx_v2_64(hipblasHandle_t handle,
+                                                  int64_t         n,
+                                                  const void*     x,
+                                                  hipDataType     xType,
+                                                  int64_t         incx,
+                                                  hipblasStride   stridex,
+                                                  const void*     y,
+                                                  hipDataType     yType,
+                                                  int64_t         incy,
+                                                  hipblasStride   stridey,
+                                                  int64_t         batch_count,
+                                                  void*           result,
+                                                  hipDataType     resultType,
+                                                  hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// nrm2_ex
+hipblasStatus_t hipblasNrm2Ex(hipblasHandle_t   handle,
+                              int               n,
+                              const void*       x,
+                              hipblasDatatype_t xType,
+                              int               incx,
+                              void*             result,
+                              hipblasDatatype_t resultType,
+                              hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(cublasNrm2Ex((cublasHandle_t)handle,
+                                             n,
+                                             x,
+                                             hipblasConvertDatatype(xType),
+                                             incx,
+                                             result,
+                                             hipblasConvertDatatype(resultType),
+                                             hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasNrm2Ex_v2(hipblasHandle_t handle,
+                                 int             n,
+                                 const void*     x,
+                                 hipDataType     xType,
+                                 int             incx,
+                                 void*           result,
+                                 hipDataType     resultType,
+                                 hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+    return hipblasConvertStatus(cublasNrm2Ex((cublasHandle_t)handle,
+                                             n,
+                                             x,
+                                             hipblasConvertDatatype_v2(xType),
+                                             incx,
+                                             result,
+                                             hipblasConvertDatatype_v2(resultType),
+                                             hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasNrm2BatchedEx(hipblasHandle_t   handle,
+                                     int               n,
+                                     const void*       x,
+                                     hipblasDatatype_t xType,
+                                     int               incx,
+                                     int               batch_count,
+                                     void*             result,
+                                     hipblasDatatype_t resultType,
+                                     hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasNrm2BatchedEx_v2(hipblasHandle_t handle,
+                                        int             n,
+                                        const void*     x,
+                                        hipDataType     xType,
+                                        int             incx,
+                                        int             batch_count,
+                                        void*           result,
+                                        hipDataType     resultType,
+                                        hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasNrm2StridedBatchedEx(hipblasHandle_t   handle,
+                                            int               n,
+                                            const void*       x,
+                                            hipblasDatatype_t xType,
+                                            int               incx,
+                                            hipblasStride     stridex,
+                                            int               batch_count,
+                                            void*             result,
+                                            hipblasDatatype_t resultType,
+                                            hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasNrm2StridedBatchedEx_v2(hipblasHandle_t handle,
+                                               int             n,
+                                               const void*     x,
+                                               hipDataType     xType,
+                                               int             incx,
+                                               hipblasStride   stridex,
+                                               int             batch_count,
+                                               void*           result,
+                                               hipDataType     resultType,
+                                               hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// nrm2_ex_64
+hipblasStatus_t hipblasNrm2Ex_64(hipblasHandle_t   handle,
+                                 int64_t           n,
+                                 const void*       x,
+                                 hipblasDatatype_t xType,
+                                 int64_t           incx,
+                                 void*             result,
+                                 hipblasDatatype_t resultType,
+                                 hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasNrm2Ex_64((cublasHandle_t)handle,
+                                                n,
+                                                x,
+                                                hipblasConvertDatatype(xType),
+                                                incx,
+                                                result,
+                                                hipblasConvertDatatype(resultType),
+                                                hipblasConvertDatatype(executionType)));
+#else
+    // the results of chunks of n would have to be combined on the device
+    if(!hipblasFitsInt32(n) || !hipblasFitsInt32(incx))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasConvertStatus(cublasNrm2Ex((cublasHandle_t)handle,
+                                             int(n),
+                                             x,
+                                             hipblasConvertDatatype(xType),
+                                             int(incx),
+                                             result,
+                                             hipblasConvertDatatype(resultType),
+                                             hipblasConvertDatatype(executionType)));
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasNrm2Ex_v2_64(hipblasHandle_t handle,
+                                    int64_t         n,
+                                    const void*     x,
+                                    hipDataType     xType,
+                                    int64_t         incx,
+                                    void*           result,
+                                    hipDataType     resultType,
+                                    hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, resultType, executionType);
+    hipblasPinnedHostResultScope pinned_host_result(handle);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasNrm2Ex_64((cublasHandle_t)handle,
+                                                n,
+                                                x,
+                                                hipblasConvertDatatype_v2(xType),
+                                                incx,
+                                                result,
+                                                hipblasConvertDatatype_v2(resultType),
+                                                hipblasConvertDatatype_v2(executionType)));
+#else
+    // the results of chunks of n would have to be combined on the device
+    if(!hipblasFitsInt32(n) || !hipblasFitsInt32(incx))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasConvertStatus(cublasNrm2Ex((cublasHandle_t)handle,
+                                             int(n),
+                                             x,
+                                             hipblasConvertDatatype_v2(xType),
+                                             int(incx),
+                                             result,
+                                             hipblasConvertDatatype_v2(resultType),
+                                             hipblasConvertDatatype_v2(executionType)));
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasNrm2BatchedEx_64(hipblasHandle_t   handle,
+                                        int64_t           n,
+                                        const void*       x,
+                                        hipblasDatatype_t xType,
+                                        int64_t           incx,
+                                        int64_t           batch_count,
+                                        void*             result,
+                                        hipblasDatatype_t resultType,
+                                        hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasNrm2BatchedEx_v2_64(hipblasHandle_t handle,
+                                           int64_t         n,
+                                           const void*     x,
+                                           hipDataType     xType,
+                                           int64_t         incx,
+                                           int64_t         batch_count,
+                                           void*           result,
+                                           hipDataType     resultType,
+                                           hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasNrm2StridedBatchedEx_64(hipblasHandle_t   handle,
+                                               int64_t           n,
+                                               const void*       x,
+                                               hipblasDatatype_t xType,
+                                               int64_t           incx,
+                                               hipblasStride     stridex,
+                                               int64_t           batch_count,
+                                               void*             result,
+                                               hipblasDatatype_t resultType,
+                                               hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasNrm2StridedBatchedEx_v2_64(hipblasHandle_t handle,
+                                                  int64_t         n,
+                                                  const void*     x,
+                                                  hipDataType     xType,
+                                                  int64_t         incx,
+                                                  hipblasStride   stridex,
+                                                  int64_t         batch_count,
+                                                  void*           result,
+                                                  hipDataType     resultType,
+                                                  hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// rot_ex
+hipblasStatus_t hipblasRotEx(hipblasHandle_t   handle,
+                             int               n,
+                             void*             x,
+                             hipblasDatatype_t xType,
+                             int               incx,
+                             void*             y,
+                             hipblasDatatype_t yType,
+                             int               incy,
+                             const void*       c,
+                             const void*       s,
+                             hipblasDatatype_t csType,
+                             hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, csType, executionType);
+    return hipblasConvertStatus(cublasRotEx((cublasHandle_t)handle,
+                                            n,
+                                            x,
+                                            hipblasConvertDatatype(xType),
+                                            incx,
+                                            y,
+                                            hipblasConvertDatatype(yType),
+                                            incy,
+                                            c,
+                                            s,
+                                            hipblasConvertDatatype(csType),
+                                            hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasRotEx_v2(hipblasHandle_t handle,
+                                int             n,
+                                void*           x,
+                                hipDataType     xType,
+                                int             incx,
+                                void*           y,
+                                hipDataType     yType,
+                                int             incy,
+                                const void*     c,
+                                const void*     s,
+                                hipDataType     csType,
+                                hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, csType, executionType);
+    return hipblasConvertStatus(cublasRotEx((cublasHandle_t)handle,
+                                            n,
+                                            x,
+                                            hipblasConvertDatatype_v2(xType),
+                                            incx,
+                                            y,
+                                            hipblasConvertDatatype_v2(yType),
+                                            incy,
+                                            c,
+                                            s,
+                                            hipblasConvertDatatype_v2(csType),
+                                            hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasRotBatchedEx(hipblasHandle_t   handle,
+                                    int               n,
+                                    void*             x,
+                                    hipblasDatatype_t xType,
+                                    int               incx,
+                                    void*             y,
+                                    hipblasDatatype_t yType,
+                                    int               incy,
+                                    const void*       c,
+                                    const void*       s,
+                                    hipblasDatatype_t csType,
+                                    int               batch_count,
+                                    hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRotBatchedEx_v2(hipblasHandle_t handle,
+                                       int             n,
+                                       void*           x,
+                                       hipDataType     xType,
+                                       int             incx,
+                                       void*           y,
+                                       hipDataType     yType,
+                                       int             incy,
+                                       const void*     c,
+                                       const void*     s,
+                                       hipDataType     csType,
+                                       int             batch_count,
+                                       hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRotStridedBatchedEx(hipblasHandle_t   handle,
+                                           int               n,
+                                           void*             x,
+                                           hipblasDatatype_t xType,
+                                           int               incx,
+                                           hipblasStride     stridex,
+                                           void*             y,
+                                           hipblasDatatype_t yType,
+                                           int               incy,
+                                           hipblasStride     stridey,
+                                           const void*       c,
+                                           const void*       s,
+                                           hipblasDatatype_t csType,
+                                           int               batch_count,
+                                           hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRotStridedBatchedEx_v2(hipblasHandle_t handle,
+                                              int             n,
+                                              void*           x,
+                                              hipDataType     xType,
+                                              int             incx,
+                                              hipblasStride   stridex,
+                                              void*           y,
+                                              hipDataType     yType,
+                                              int             incy,
+                                              hipblasStride   stridey,
+                                              const void*     c,
+                                              const void*     s,
+                                              hipDataType     csType,
+                                              int             batch_count,
+                                              hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// rot_ex_64
+hipblasStatus_t hipblasRotEx_64(hipblasHandle_t   handle,
+                                int64_t           n,
+                                void*             x,
+                                hipblasDatatype_t xType,
+                                int64_t           incx,
+                                void*             y,
+                                hipblasDatatype_t yType,
+                                int64_t           incy,
+                                const void*       c,
+                                const void*       s,
+                                hipblasDatatype_t csType,
+                                hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, csType, executionType);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasRotEx_64((cublasHandle_t)handle,
+                                               n,
+                                               x,
+                                               hipblasConvertDatatype(xType),
+                                               incx,
+                                               y,
+                                               hipblasConvertDatatype(yType),
+                                               incy,
+                                               c,
+                                               s,
+                                               hipblasConvertDatatype(csType),
+                                               hipblasConvertDatatype(executionType)));
+#else
+    cudaDataType_t x_type = hipblasConvertDatatype(xType);
+    cudaDataType_t y_type = hipblasConvertDatatype(yType);
+    auto           rot    = [&](int n_chunk, int64_t x_offset, int64_t y_offset) {
+        return cublasRotEx((cublasHandle_t)handle,
+                           n_chunk,
+                           (char*)x + x_offset * hipblasDatatypeSize(x_type),
+                           x_type,
+                           int(incx),
+                           (char*)y + y_offset * hipblasDatatypeSize(y_type),
+                           y_type,
+                           int(incy),
+                           c,
+                           s,
+                           hipblasConvertDatatype(csType),
+                           hipblasConvertDatatype(executionType));
+    };
+    return hipblasConvertStatus(hipblasCublasVectorExChunked_64(n, incx, incy, rot));
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasRotEx_v2_64(hipblasHandle_t handle,
+                                   int64_t         n,
+                                   void*           x,
+                                   hipDataType     xType,
+                                   int64_t         incx,
+                                   void*           y,
+                                   hipDataType     yType,
+                                   int64_t         incy,
+                                   const void*     c,
+                                   const void*     s,
+                                   hipDataType     csType,
+                                   hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, xType, incx, yType, incy, csType, executionType);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasRotEx_64((cublasHandle_t)handle,
+                                               n,
+                                               x,
+                                               hipblasConvertDatatype_v2(xType),
+                                               incx,
+                                               y,
+                                               hipblasConvertDatatype_v2(yType),
+                                               incy,
+                                               c,
+                                               s,
+                                               hipblasConvertDatatype_v2(csType),
+                                               hipblasConvertDatatype_v2(executionType)));
+#else
+    cudaDataType_t x_type = hipblasConvertDatatype_v2(xType);
+    cudaDataType_t y_type = hipblasConvertDatatype_v2(yType);
+    auto           rot    = [&](int n_chunk, int64_t x_offset, int64_t y_offset) {
+        return cublasRotEx((cublasHandle_t)handle,
+                           n_chunk,
+                           (char*)x + x_offset * hipblasDatatypeSize(x_type),
+                           x_type,
+                           int(incx),
+                           (char*)y + y_offset * hipblasDatatypeSize(y_type),
+                           y_type,
+                           int(incy),
+                           c,
+                           s,
+                           hipblasConvertDatatype_v2(csType),
+                           hipblasConvertDatatype_v2(executionType));
+    };
+    return hipblasConvertStatus(hipblasCublasVectorExChunked_64(n, incx, incy, rot));
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasRotBatchedEx_64(hipblasHandle_t   handle,
+                                       int64_t           n,
+                                       void*             x,
+                                       hipblasDatatype_t xType,
+                                       int64_t           incx,
+                                       void*             y,
+                                       hipblasDatatype_t yType,
+                                       int64_t           incy,
+                                       const void*       c,
+                                       const void*       s,
+                                       hipblasDatatype_t csType,
+                                       int64_t           batch_count,
+                                       hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRotBatchedEx_v2_64(hipblasHandle_t handle,
+                                          int64_t         n,
+                                          void*           x,
+                                          hipDataType     xType,
+                                          int64_t         incx,
+                                          void*           y,
+                                          hipDataType     yType,
+                                          int64_t         incy,
+                                          const void*     c,
+                                          const void*     s,
+                                          hipDataType     csType,
+                                          int64_t         batch_count,
+                                          hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRotStridedBatchedEx_64(hipblasHandle_t   handle,
+                                              int64_t           n,
+                                              void*             x,
+                                              hipblasDatatype_t xType,
+                                              int64_t           incx,
+                                              hipblasStride     stridex,
+                                              void*             y,
+                                              hipblasDatatype_t yType,
+                                              int64_t           incy,
+                                              hipblasStride     stridey,
+                                              const void*       c,
+                                              const void*       s,
+                                              hipblasDatatype_t csType,
+                                              int64_t           batch_count,
+                                              hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRotStridedBatchedEx_v2_64(hipblasHandle_t handle,
+                                                 int64_t         n,
+                                                 void*           x,
+                                                 hipDataType     xType,
+                                                 int64_t         incx,
+                                                 hipblasStride   stridex,
+                                                 void*           y,
+                                                 hipDataType     yType,
+                                                 int64_t         incy,
+                                                 hipblasStride   stridey,
+                                                 const void*     c,
+                                                 const void*     s,
+                                                 hipDataType     csType,
+                                                 int64_t         batch_count,
+                                                 hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// scal_ex
+hipblasStatus_t hipblasScalEx(hipblasHandle_t   handle,
+                              int               n,
+                              const void*       alpha,
+                              hipblasDatatype_t alphaType,
+                              void*             x,
+                              hipblasDatatype_t xType,
+                              int               incx,
+                              hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, executionType);
+    return hipblasConvertStatus(cublasScalEx((cublasHandle_t)handle,
+                                             n,
+                                             alpha,
+                                             hipblasConvertDatatype(alphaType),
+                                             x,
+                                             hipblasConvertDatatype(xType),
+                                             incx,
+                                             hipblasConvertDatatype(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScalEx_v2(hipblasHandle_t handle,
+                                 int             n,
+                                 const void*     alpha,
+                                 hipDataType     alphaType,
+                                 void*           x,
+                                 hipDataType     xType,
+                                 int             incx,
+                                 hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, executionType);
+    hipblasStatus_t rounded = hipblasRoundedScalEx(handle,
+                                                   n,
+                                                   alpha,
+                                                   alphaType,
+                                                   x,
+                                                   xType,
+                                                   incx,
+                                                   executionType);
+    if(rounded != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return rounded;
+    return hipblasConvertStatus(cublasScalEx((cublasHandle_t)handle,
+                                             n,
+                                             alpha,
+                                             hipblasConvertDatatype_v2(alphaType),
+                                             x,
+                                             hipblasConvertDatatype_v2(xType),
+                                             incx,
+                                             hipblasConvertDatatype_v2(executionType)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScalBatchedEx(hipblasHandle_t   handle,
+                                     int               n,
+                                     const void*       alpha,
+                                     hipblasDatatype_t alphaType,
+                                     void*             x,
+                                     hipblasDatatype_t xType,
+                                     int               incx,
+                                     int               batch_count,
+                                     hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasScalBatchedEx_v2(hipblasHandle_t handle,
+                                        int             n,
+                                        const void*     alpha,
+                                        hipDataType     alphaType,
+                                        void*           x,
+                                        hipDataType     xType,
+                                        int             incx,
+                                        int             batch_count,
+                                        hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasScalStridedBatchedEx(hipblasHandle_t   handle,
+                                            int               n,
+                                            const void*       alpha,
+                                            hipblasDatatype_t alphaType,
+                                            void*             x,
+                                            hipblasDatatype_t xType,
+                                            int               incx,
+                                            hipblasStride     stridex,
+                                            int               batch_count,
+                                            hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasScalStridedBatchedEx_v2(hipblasHandle_t handle,
+                                               int             n,
+                                               const void*     alpha,
+                                               hipDataType     alphaType,
+                                               void*           x,
+                                               hipDataType     xType,
+                                               int             incx,
+                                               hipblasStride   stridex,
+                                               int             batch_count,
+                                               hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// scal_ex_64
+hipblasStatus_t hipblasScalEx_64(hipblasHandle_t   handle,
+                                 int64_t           n,
+                                 const void*       alpha,
+                                 hipblasDatatype_t alphaType,
+                                 void*             x,
+                                 hipblasDatatype_t xType,
+                                 int64_t           incx,
+                                 hipblasDatatype_t executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, executionType);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasScalEx_64((cublasHandle_t)handle,
+                                                n,
+                                                alpha,
+                                                hipblasConvertDatatype(alphaType),
+                                                x,
+                                                hipblasConvertDatatype(xType),
+                                                incx,
+                                                hipblasConvertDatatype(executionType)));
+#else
+    cudaDataType_t x_type = hipblasConvertDatatype(xType);
+    auto           scal   = [&](int n_chunk, int64_t x_offset, int64_t) {
+        return cublasScalEx((cublasHandle_t)handle,
+                            n_chunk,
+                            alpha,
+                            hipblasConvertDatatype(alphaType),
+                            (char*)x + x_offset * hipblasDatatypeSize(x_type),
+                            x_type,
+                            int(incx),
+                            hipblasConvertDatatype(executionType));
+    };
+    return hipblasConvertStatus(hipblasCublasVectorExChunked_64(n, incx, 0, scal));
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScalEx_v2_64(hipblasHandle_t handle,
+                                    int64_t         n,
+                                    const void*     alpha,
+                                    hipDataType     alphaType,
+                                    void*           x,
+                                    hipDataType     xType,
+                                    int64_t         incx,
+                                    hipDataType     executionType)
+try
+{
+    HIPBLAS_ENTRY(handle, n, alphaType, xType, incx, executionType);
+
+#if CUBLAS_VER_MAJOR >= 12
+    return hipblasConvertStatus(cublasScalEx_64((cublasHandle_t)handle,
+                                                n,
+                                                alpha,
+                                                hipblasConvertDatatype_v2(alphaType),
+                                                x,
+                                                hipblasConvertDatatype_v2(xType),
+                                                incx,
+                                                hipblasConvertDatatype_v2(executionType)));
+#else
+    cudaDataType_t x_type = hipblasConvertDatatype_v2(xType);
+    auto           scal   = [&](int n_chunk, int64_t x_offset, int64_t) {
+        return cublasScalEx((cublasHandle_t)handle,
+                            n_chunk,
+                            alpha,
+                            hipblasConvertDatatype_v2(alphaType),
+                            (char*)x + x_offset * hipblasDatatypeSize(x_type),
+                            x_type,
+                            int(incx),
+                            hipblasConvertDatatype_v2(executionType));
+    };
+    return hipblasConvertStatus(hipblasCublasVectorExChunked_64(n, incx, 0, scal));
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasScalBatchedEx_64(hipblasHandle_t   handle,
+                                        int64_t           n,
+                                        const void*       alpha,
+                                        hipblasDatatype_t alphaType,
+                                        void*             x,
+                                        hipblasDatatype_t xType,
+                                        int64_t           incx,
+                                        int64_t           batch_count,
+                                        hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasScalBatchedEx_v2_64(hipblasHandle_t handle,
+                                           int64_t         n,
+                                           const void*     alpha,
+                                           hipDataType     alphaType,
+                                           void*           x,
+                                           hipDataType     xType,
+                                           int64_t         incx,
+                                           int64_t         batch_count,
+                                           hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasScalStridedBatchedEx_64(hipblasHandle_t   handle,
+                                               int64_t           n,
+                                               const void*       alpha,
+                                               hipblasDatatype_t alphaType,
+                                               void*             x,
+                                               hipblasDatatype_t xType,
+                                               int64_t           incx,
+                                               hipblasStride     stridex,
+                                               int64_t           batch_count,
+                                               hipblasDatatype_t executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasScalStridedBatchedEx_v2_64(hipblasHandle_t handle,
+                                                  int64_t         n,
+                                                  const void*     alpha,
+                                                  hipDataType     alphaType,
+                                                  void*           x,
+                                                  hipDataType     xType,
+                                                  int64_t         incx,
+                                                  hipblasStride   stridex,
+                                                  int64_t         batch_count,
+                                                  hipDataType     executionType)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+// hipblasGemmExWithDiagonalScales with cuBLASLt, see hipblas_gemm_diagonal_scales.hpp. The outer
+// vector scale modes are in cuBLASLt from CUDA 12.9.
+hipblasStatus_t hipblasLtGemmDiagonalScales(hipblasHandle_t      handle,
+                                            hipblasOperation_t   transa,
+                                            hipblasOperation_t   transb,
+                                            int                  m,
+                                            int                  n,
+                                            int                  k,
+                                            const void*          alpha,
+                                            const void*          A,
+                                            hipDataType          a_type,
+                                            int                  lda,
+                                            const void*          B,
+                                            hipDataType          b_type,
+                                            int                  ldb,
+                                            const void*          beta,
+                                            void*                C,
+                                            hipDataType          c_type,
+                                            int                  ldc,
+                                            hipblasComputeType_t compute_type,
+                                            const float*         row_scale,
+                                            const float*         col_scale)
+{
+#if CUBLAS_VERSION >= 120900
+    hipblasCublasLtGemmArgs args;
+    args.transa           = transa;
+    args.transb           = transb;
+    args.m                = m;
+    args.n                = n;
+    args.k                = k;
+    args.alpha            = alpha;
+    args.A                = A;
+    args.a_type           = a_type;
+    args.lda              = lda;
+    args.B                = B;
+    args.b_type           = b_type;
+    args.ldb              = ldb;
+    args.beta             = beta;
+    args.C                = C;
+    args.c_type           = c_type;
+    args.ldc              = ldc;
+    args.compute_type     = compute_type;
+    args.scale_a          = row_scale;
+    args.scale_b          = col_scale;
+    args.outer_vec_scales = true;
+
+    // cuBLASLt only takes outer vector scales with some types, the others are left to the
+    // fallback
+    hipblasStatus_t status = hipblasCublasLtGemm(handle, args);
+    return status == HIPBLAS_STATUS_INVALID_VALUE ? HIPBLAS_STATUS_NOT_SUPPORTED : status;
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
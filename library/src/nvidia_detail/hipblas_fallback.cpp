@@ -0,0 +1,150 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas_fallback.hpp"
+#include "hipblas_handle_state.hpp"
+#include <algorithm>
+#include <cublas_v2.h>
+#include <hip/hip_runtime.h>
+
+hipblasStatus_t hipblasHostPointers::copy(hipblasHandle_t                    handle,
+                                          int64_t                            batch_count,
+                                          std::initializer_list<const void*> arrays)
+{
+    if(arrays.size() == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    cudaStream_t stream;
+    if(cublasGetStream((cublasHandle_t)handle, &stream) != CUBLAS_STATUS_SUCCESS)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    // the copy has to complete before the problems are launched, which can't be captured
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess
+       || capture_status != hipStreamCaptureStatusNone)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    m_arrays.assign(arrays.begin(), arrays.end());
+    m_pointers.assign(m_arrays.size() * batch_count, nullptr);
+    m_batch_count = batch_count;
+    for(size_t i = 0; i < m_arrays.size(); i++)
+    {
+        // a null array is passed on as null pointers, which cuBLAS checks
+        if(m_arrays[i]
+           && hipMemcpyAsync(&m_pointers[i * batch_count],
+                             m_arrays[i],
+                             sizeof(void*) * batch_count,
+                             hipMemcpyDeviceToHost,
+                             stream)
+                  != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+    return hipStreamSynchronize(stream) == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                                      : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hipblasStatus_t hipblasForkedStreams::fork(hipblasHandle_t handle, int64_t batch_count)
+{
+    m_handle = handle;
+    if(cublasGetStream((cublasHandle_t)handle, &m_stream) != CUBLAS_STATUS_SUCCESS)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    // cublasSetStream replaces a user workspace with the default one, and the problems would
+    // share a workspace across streams
+    hipblasHandleState* state = hipblasGetHandleState(handle);
+    if(state->workspace_size != 0 || batch_count == 1)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    // streams can't be created while capturing in HIPBLAS_GRAPH_CAPTURE_SAFE mode, but a
+    // capture can fork into the streams of a pool created before
+    hipblasStreamPool& pool  = state->stream_pool;
+    int                count = int(std::min<int64_t>(batch_count, hipblasFallbackStreams));
+    if(int(pool.streams.size()) < count && hipblasIsGraphCaptureSafe(handle))
+    {
+        hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+        if(hipStreamIsCapturing(m_stream, &capture_status) != hipSuccess
+           || capture_status != hipStreamCaptureStatusNone)
+            count = int(pool.streams.size());
+    }
+
+    if(!pool.fork && hipEventCreateWithFlags(&pool.fork, hipEventDisableTiming) != hipSuccess)
+    {
+        pool.fork = nullptr;
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    while(int(pool.streams.size()) < count)
+    {
+        hipStream_t stream;
+        hipEvent_t  join;
+        if(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking) != hipSuccess)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        if(hipEventCreateWithFlags(&join, hipEventDisableTiming) != hipSuccess)
+        {
+            (void)hipStreamDestroy(stream);
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+        pool.streams.push_back(stream);
+        pool.joins.push_back(join);
+    }
+    if(count <= 1)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    // the forked streams start after the work already in the stream of the handle
+    if(hipEventRecord(pool.fork, m_stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    for(int i = 0; i < count; i++)
+        if(hipStreamWaitEvent(pool.streams[i], pool.fork, 0) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    m_forked = pool.streams.data();
+    m_count  = count;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasForkedStreams::select(int64_t b)
+{
+    if(m_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    return cublasSetStream((cublasHandle_t)m_handle, m_forked[b % m_count])
+                   == CUBLAS_STATUS_SUCCESS
+               ? HIPBLAS_STATUS_SUCCESS
+               : HIPBLAS_STATUS_INTERNAL_ERROR;
+}
+
+hipblasStatus_t hipblasForkedStreams::join()
+{
+    if(m_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    // the stream of the handle is set back even if a problem failed, and waits for all the
+    // forked streams so that the call is ordered in it as a native batched call is
+    hipblasStatus_t    status = HIPBLAS_STATUS_SUCCESS;
+    hipblasStreamPool& pool   = hipblasGetHandleState(m_handle)->stream_pool;
+    for(int i = 0; i < m_count; i++)
+        if(hipEventRecord(pool.joins[i], m_forked[i]) != hipSuccess
+           || hipStreamWaitEvent(m_stream, pool.joins[i], 0) != hipSuccess)
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+    if(cublasSetStream((cublasHandle_t)m_handle, m_stream) != CUBLAS_STATUS_SUCCESS)
+        status = HIPBLAS_STATUS_INTERNAL_ERROR;
+    return status;
+}
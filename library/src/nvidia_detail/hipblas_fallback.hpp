@@ -0,0 +1,135 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+#include "hipblas_trace.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+// Fallback for the batched functions of the cuBLAS backend that neither cuBLAS nor
+// hipblas_batched.hpp implement. The problems of the batch are run one at a time with the
+// non-batched cuBLAS function, round robin over a pool of streams forked from the stream of the
+// handle, so that small problems still overlap on the device. The pool is kept in the state of
+// the handle and reused by later calls.
+//
+// Calls that take the fallback are marked in the trace and the profile, to find the batched
+// functions worth a native implementation.
+
+// The number of streams of the pool of a handle
+constexpr int hipblasFallbackStreams = 4;
+
+// The pointers of the problems of batched functions, whose arrays of pointers are in device
+// memory, copied to the host once for the whole batch
+class hipblasHostPointers
+{
+    std::vector<const void*> m_arrays;
+    std::vector<const void*> m_pointers;
+    int64_t                  m_batch_count = 0;
+
+public:
+    // Copies the arrays of batch_count pointers on the stream of handle and waits for the copy.
+    // This can't be done while the stream is being captured.
+    hipblasStatus_t copy(hipblasHandle_t                    handle,
+                         int64_t                            batch_count,
+                         std::initializer_list<const void*> arrays);
+
+    // The pointer of problem b in array, which is one of the arrays copied
+    template <typename T>
+    T* operator()(T* const* array, int64_t b) const
+    {
+        for(size_t i = 0; i < m_arrays.size(); i++)
+            if(m_arrays[i] == (const void*)array)
+                return (T*)m_pointers[i * m_batch_count + b];
+        return nullptr;
+    }
+};
+
+// The streams a fallback runs on, forked from the stream of the handle by fork and joined back
+// into it by join. A user workspace set with hipblasSetWorkspace is tied to the stream of the
+// handle, so with one the problems run on the stream of the handle.
+class hipblasForkedStreams
+{
+    hipblasHandle_t m_handle = nullptr;
+    hipStream_t     m_stream = nullptr;
+    hipStream_t*    m_forked = nullptr;
+    int             m_count  = 0;
+
+public:
+    hipblasStatus_t fork(hipblasHandle_t handle, int64_t batch_count);
+
+    // Sets the stream of problem b as the stream of the handle
+    hipblasStatus_t select(int64_t b);
+
+    // Orders the stream of the handle after the forked streams and sets it back on the handle
+    hipblasStatus_t join();
+};
+
+// Runs call(b, pointers) for each problem b of the batch, where pointers are the problem
+// pointers of batch_arrays, the arrays of pointers of a batched function, and returns the first
+// status that isn't success
+template <typename F>
+hipblasStatus_t hipblasBatchedFallback(hipblasHandle_t                    handle,
+                                       int64_t                            batch_count,
+                                       std::initializer_list<const void*> batch_arrays,
+                                       F&&                                call)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(batch_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasTraceFallback();
+
+    hipblasHostPointers pointers;
+    hipblasStatus_t     status = pointers.copy(handle, batch_count, batch_arrays);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasForkedStreams streams;
+    status = streams.fork(handle, batch_count);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    for(int64_t b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+    {
+        status = streams.select(b);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = call(b, pointers);
+    }
+
+    hipblasStatus_t join_status = streams.join();
+    return status != HIPBLAS_STATUS_SUCCESS ? status : join_status;
+}
+
+// The fallback of strided batched functions, which have no arrays of pointers
+template <typename F>
+hipblasStatus_t hipblasBatchedFallback(hipblasHandle_t handle, int64_t batch_count, F&& call)
+{
+    return hipblasBatchedFallback(
+        handle, batch_count, {}, [&](int64_t b, const hipblasHostPointers&) { return call(b); });
+}
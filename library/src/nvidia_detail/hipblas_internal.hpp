@@ -0,0 +1,89 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+// Declarations shared by the translation units of the cuBLAS backend
+
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "hipblas_batch_split.hpp"
+#include "hipblas_batched.hpp"
+#include "hipblas_batched_blas3.hpp"
+#include "hipblas_fallback.hpp"
+#include "hipblas_deferred.hpp"
+#include "hipblas_entry.hpp"
+#include "hipblas_gemm_broadcast.hpp"
+#include "hipblas_gemm_complex_half.hpp"
+#include "hipblas_gemm_diagonal_scales.hpp"
+#include "hipblas_gemm_small.hpp"
+#include "hipblas_handle_state.hpp"
+#include "hipblas_host_dispatch.hpp"
+#include "hipblas_interleaved_batch.hpp"
+#include "hipblas_managed.hpp"
+#include "hipblas_persistent.hpp"
+#include "hipblas_reproducible.hpp"
+#include "hipblas_rounding.hpp"
+#include "hipblas_shape_dispatch.hpp"
+#include "hipblas_staging.hpp"
+#include "hipblas_solver.hpp"
+#include "hipblas_trace.hpp"
+#include "hipblas_trsm_small.hpp"
+#include "hipblas_matinv.hpp"
+#include <cublasLt.h>
+#include <cublas_v2.h>
+#include <cuda_runtime_api.h>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <functional>
+#include <hip/hip_runtime.h>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+cublasOperation_t hipblasConvertOperation(hipblasOperation_t op);
+cublasFillMode_t hipblasConvertFill(hipblasFillMode_t fill);
+cublasDiagType_t hipblasConvertDiag(hipblasDiagType_t diagonal);
+cublasSideMode_t hipblasConvertSide(hipblasSideMode_t side);
+cublasPointerMode_t hipblasGetCublasPointerMode(hipblasPointerMode_t mode);
+hipblasPointerMode_t hipblasConvertPointerMode(cublasPointerMode_t mode);
+cudaDataType_t hipblasConvertDatatype(hipblasDatatype_t type);
+cudaDataType_t hipblasConvertDatatype_v2(hipDataType type);
+cublasComputeType_t hipblasConvertComputeType(hipblasComputeType_t type);
+cublasGemmAlgo_t hipblasConvertGemmAlgo(hipblasGemmAlgo_t algo);
+cublasAtomicsMode_t hipblasConvertAtomicsMode(hipblasAtomicsMode_t mode);
+cublasMath_t hipblasGetCublasMathMode(hipblasMath_t mode);
+hipblasMath_t hipblasConvertMathMode(cublasMath_t mode);
+hipblasStatus_t hipblasConvertStatus(cublasStatus_t cuStatus);
+
+// the workspace size the cuBLAS documentation recommends for the current device
+hipblasStatus_t hipblasRecommendedWorkspaceSize(size_t* size);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,3006 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas_fallback.hpp"
+#include "hipblas_solver.hpp"
+#include <algorithm>
+#include <cublas_v2.h>
+#include <cusolverDn.h>
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+
+namespace
+{
+    // The workspace starts with the devInfo that cuSOLVER writes for getrs, potrs, geqrf and ormqr,
+    // which hipBLAS doesn't return, padded so that the rest of the workspace stays aligned
+    constexpr size_t hipblas_solver_scratch = 256;
+
+    size_t hipblas_solver_align(size_t bytes)
+    {
+        return (bytes + hipblas_solver_scratch - 1) / hipblas_solver_scratch
+               * hipblas_solver_scratch;
+    }
+
+    // Strided batches of at most this size are solved by the batched solvers of cuBLAS, which
+    // are meant for small matrices, in one call. Larger problems are solved one at a time by
+    // cuSOLVER.
+    constexpr int hipblas_solver_batched_max_size = 32;
+
+    // The cuSOLVER handle and the workspace of a hipBLAS handle, the buffer of the arrays of
+    // pointers passed to the batched solvers of cuBLAS, and the parameters of the Jacobi
+    // eigensolvers and singular value decompositions of cuSOLVER
+    struct hipblasSolverState
+    {
+        cusolverDnHandle_t handle            = nullptr;
+        void*              workspace         = nullptr;
+        size_t             workspace_size    = 0;
+        void*              batch_buffer      = nullptr;
+        size_t             batch_buffer_size = 0;
+        syevjInfo_t        syevj_params      = nullptr;
+        gesvdjInfo_t       gesvdj_params     = nullptr;
+
+        hipblasSolverState() = default;
+        ~hipblasSolverState()
+        {
+            if(workspace)
+                (void)hipFree(workspace);
+            if(batch_buffer)
+                (void)hipFree(batch_buffer);
+            if(syevj_params)
+                (void)cusolverDnDestroySyevjInfo(syevj_params);
+            if(gesvdj_params)
+                (void)cusolverDnDestroyGesvdjInfo(gesvdj_params);
+            if(handle)
+                (void)cusolverDnDestroy(handle);
+        }
+
+        hipblasSolverState(const hipblasSolverState&) = delete;
+        hipblasSolverState& operator=(const hipblasSolverState&) = delete;
+    };
+
+    std::mutex& solver_state_mutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    std::unordered_map<hipblasHandle_t, std::unique_ptr<hipblasSolverState>>& solver_state_map()
+    {
+        static std::unordered_map<hipblasHandle_t, std::unique_ptr<hipblasSolverState>> map;
+        return map;
+    }
+
+    hipblasStatus_t hipblas_convert_status(cusolverStatus_t status)
+    {
+        switch(status)
+        {
+        case CUSOLVER_STATUS_SUCCESS:
+            return HIPBLAS_STATUS_SUCCESS;
+        case CUSOLVER_STATUS_NOT_INITIALIZED:
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        case CUSOLVER_STATUS_ALLOC_FAILED:
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        case CUSOLVER_STATUS_INVALID_VALUE:
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        case CUSOLVER_STATUS_ARCH_MISMATCH:
+            return HIPBLAS_STATUS_ARCH_MISMATCH;
+        case CUSOLVER_STATUS_EXECUTION_FAILED:
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        case CUSOLVER_STATUS_INTERNAL_ERROR:
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        case CUSOLVER_STATUS_NOT_SUPPORTED:
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        default:
+            return HIPBLAS_STATUS_UNKNOWN;
+        }
+    }
+
+    hipblasStatus_t hipblas_convert_status(cublasStatus_t status)
+    {
+        switch(status)
+        {
+        case CUBLAS_STATUS_SUCCESS:
+            return HIPBLAS_STATUS_SUCCESS;
+        case CUBLAS_STATUS_NOT_INITIALIZED:
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        case CUBLAS_STATUS_ALLOC_FAILED:
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        case CUBLAS_STATUS_INVALID_VALUE:
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        case CUBLAS_STATUS_EXECUTION_FAILED:
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        case CUBLAS_STATUS_NOT_SUPPORTED:
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        default:
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+    }
+
+    template <typename T>
+    constexpr bool hipblas_is_complex
+        = std::is_same_v<T, hipFloatComplex> || std::is_same_v<T, hipDoubleComplex>;
+
+    // op(A) of the solvers on cuSOLVER, which takes HIPBLAS_OP_C as HIPBLAS_OP_T for real A
+    template <typename T>
+    cublasOperation_t hipblas_solver_operation(hipblasOperation_t trans)
+    {
+        if(trans == HIPBLAS_OP_N)
+            return CUBLAS_OP_N;
+        return hipblas_is_complex<T> ? CUBLAS_OP_C : CUBLAS_OP_T;
+    }
+
+    bool hipblas_solver_valid_fill(hipblasFillMode_t uplo)
+    {
+        return uplo == HIPBLAS_FILL_MODE_UPPER || uplo == HIPBLAS_FILL_MODE_LOWER;
+    }
+
+    cublasFillMode_t hipblas_solver_fill(hipblasFillMode_t uplo)
+    {
+        return uplo == HIPBLAS_FILL_MODE_UPPER ? CUBLAS_FILL_MODE_UPPER : CUBLAS_FILL_MODE_LOWER;
+    }
+
+    bool hipblas_solver_valid_evect(hipblasEvect_t evect)
+    {
+        return evect == HIPBLAS_EVECT_NONE || evect == HIPBLAS_EVECT_ORIGINAL;
+    }
+
+    cusolverEigMode_t hipblas_solver_eig_mode(hipblasEvect_t evect)
+    {
+        return evect == HIPBLAS_EVECT_ORIGINAL ? CUSOLVER_EIG_MODE_VECTOR
+                                               : CUSOLVER_EIG_MODE_NOVECTOR;
+    }
+
+    bool hipblas_solver_valid_svect(hipblasSvect_t svect)
+    {
+        return svect == HIPBLAS_SVECT_NONE || svect == HIPBLAS_SVECT_SINGULAR;
+    }
+
+    // cuSOLVER computes both or none of the singular vectors
+    cusolverEigMode_t hipblas_solver_svd_mode(hipblasSvect_t left_svect, hipblasSvect_t right_svect)
+    {
+        return left_svect == HIPBLAS_SVECT_SINGULAR || right_svect == HIPBLAS_SVECT_SINGULAR
+                   ? CUSOLVER_EIG_MODE_VECTOR
+                   : CUSOLVER_EIG_MODE_NOVECTOR;
+    }
+
+    hipblasSolverState* hipblas_solver_state(hipblasHandle_t handle)
+    {
+        std::lock_guard<std::mutex> lock(solver_state_mutex());
+
+        auto& state = solver_state_map()[handle];
+        if(!state)
+            state = std::make_unique<hipblasSolverState>();
+        return state.get();
+    }
+
+    bool hipblas_solver_capturing(hipStream_t stream)
+    {
+        hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+        return hipStreamIsCapturing(stream, &capture_status) != hipSuccess
+               || capture_status != hipStreamCaptureStatusNone;
+    }
+
+    // Returns the cuSOLVER handle of handle on the stream of handle, and a workspace of at
+    // least size bytes. Creating the handle or growing the workspace allocates device memory,
+    // which can't be done while the stream is being captured.
+    hipblasStatus_t hipblas_solver_begin(hipblasHandle_t     handle,
+                                         size_t              size,
+                                         cusolverDnHandle_t* solver,
+                                         void**              workspace,
+                                         hipStream_t*        stream)
+    {
+        cudaStream_t cuda_stream;
+        if(cublasGetStream((cublasHandle_t)handle, &cuda_stream) != CUBLAS_STATUS_SUCCESS)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        *stream = cuda_stream;
+
+        hipblasSolverState* state = hipblas_solver_state(handle);
+        if((!state->handle || state->workspace_size < size)
+           && hipblas_solver_capturing(cuda_stream))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        if(!state->handle && cusolverDnCreate(&state->handle) != CUSOLVER_STATUS_SUCCESS)
+        {
+            state->handle = nullptr;
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+        if(state->workspace_size < size)
+        {
+            // hipFree waits for the work that uses the old workspace
+            if(state->workspace)
+                (void)hipFree(state->workspace);
+            state->workspace_size = 0;
+            if(hipMalloc(&state->workspace, size) != hipSuccess)
+            {
+                state->workspace = nullptr;
+                return HIPBLAS_STATUS_ALLOC_FAILED;
+            }
+            state->workspace_size = size;
+        }
+
+        *solver    = state->handle;
+        *workspace = state->workspace;
+        return hipblas_convert_status(cusolverDnSetStream(state->handle, cuda_stream));
+    }
+
+    // Returns the batch buffer of handle with at least size bytes, and the stream of handle.
+    // The buffer grows geometrically, so that a sequence of growing batches reallocates it a
+    // few times only, and like the workspace it can't grow while the stream is being captured.
+    hipblasStatus_t hipblas_solver_batch_buffer(hipblasHandle_t handle,
+                                                size_t          size,
+                                                void**          buffer,
+                                                hipStream_t*    stream)
+    {
+        cudaStream_t cuda_stream;
+        if(cublasGetStream((cublasHandle_t)handle, &cuda_stream) != CUBLAS_STATUS_SUCCESS)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        *stream = cuda_stream;
+
+        hipblasSolverState* state = hipblas_solver_state(handle);
+        if(state->batch_buffer_size < size)
+        {
+            if(hipblas_solver_capturing(cuda_stream))
+                return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+            size_t new_size = std::max(size, 2 * state->batch_buffer_size);
+            if(state->batch_buffer)
+                (void)hipFree(state->batch_buffer);
+            state->batch_buffer_size = 0;
+            if(hipMalloc(&state->batch_buffer, new_size) != hipSuccess)
+            {
+                state->batch_buffer = nullptr;
+                return HIPBLAS_STATUS_ALLOC_FAILED;
+            }
+            state->batch_buffer_size = new_size;
+        }
+        *buffer = state->batch_buffer;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // pointers[b] := base + b * stride
+    template <typename T>
+    __global__ void
+        hipblasStridedPointersKernel(T* base, hipblasStride stride, int batch_count, T** pointers)
+    {
+        int b = blockIdx.x * blockDim.x + threadIdx.x;
+        if(b < batch_count)
+            pointers[b] = base + b * stride;
+    }
+
+    constexpr int hipblas_strided_pointers_block = 256;
+
+    template <typename T>
+    hipblasStatus_t hipblas_strided_pointers(
+        hipStream_t stream, T* base, hipblasStride stride, int batch_count, T** pointers)
+    {
+        int blocks = (batch_count - 1) / hipblas_strided_pointers_block + 1;
+        hipblasStridedPointersKernel<T><<<blocks, hipblas_strided_pointers_block, 0, stream>>>(
+            base, stride, batch_count, pointers);
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    // info[b] := 0 on the stream of handle, the device info of a batch of empty matrices
+    hipblasStatus_t hipblas_solver_zero_info(hipblasHandle_t handle, int* info, int batch_count)
+    {
+        cudaStream_t stream;
+        if(cublasGetStream((cublasHandle_t)handle, &stream) != CUBLAS_STATUS_SUCCESS)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        return hipMemsetAsync(info, 0, sizeof(int) * batch_count, stream) == hipSuccess
+                   ? HIPBLAS_STATUS_SUCCESS
+                   : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    // Returns the parameters of the Jacobi eigensolvers of handle, set to the tolerance and the
+    // maximum number of sweeps of a call. They are kept with the cuSOLVER handle rather than
+    // destroyed by the call, as the solvers run after the call returns. cuSOLVER takes a
+    // tolerance below the machine precision as the machine precision, like rocSOLVER takes
+    // abstol <= 0.
+    hipblasStatus_t hipblas_solver_syevj_params(hipblasHandle_t handle,
+                                                double          abstol,
+                                                int             max_sweeps,
+                                                syevjInfo_t*    params)
+    {
+        hipblasSolverState* state  = hipblas_solver_state(handle);
+        cusolverStatus_t    status = CUSOLVER_STATUS_SUCCESS;
+        if(!state->syevj_params)
+        {
+            status = cusolverDnCreateSyevjInfo(&state->syevj_params);
+            if(status != CUSOLVER_STATUS_SUCCESS)
+            {
+                state->syevj_params = nullptr;
+                return hipblas_convert_status(status);
+            }
+        }
+
+        status = cusolverDnXsyevjSetTolerance(state->syevj_params, std::max(abstol, 0.0));
+        if(status == CUSOLVER_STATUS_SUCCESS)
+            status = cusolverDnXsyevjSetMaxSweeps(state->syevj_params, max_sweeps);
+        if(status == CUSOLVER_STATUS_SUCCESS)
+            status = cusolverDnXsyevjSetSortEig(state->syevj_params, 1);
+
+        *params = state->syevj_params;
+        return hipblas_convert_status(status);
+    }
+
+    // Returns the parameters of the Jacobi singular value decompositions of handle, like
+    // hipblas_solver_syevj_params. The singular values are sorted in decreasing order.
+    hipblasStatus_t hipblas_solver_gesvdj_params(hipblasHandle_t handle,
+                                                 double          abstol,
+                                                 int             max_sweeps,
+                                                 gesvdjInfo_t*   params)
+    {
+        hipblasSolverState* state  = hipblas_solver_state(handle);
+        cusolverStatus_t    status = CUSOLVER_STATUS_SUCCESS;
+        if(!state->gesvdj_params)
+        {
+            status = cusolverDnCreateGesvdjInfo(&state->gesvdj_params);
+            if(status != CUSOLVER_STATUS_SUCCESS)
+            {
+                state->gesvdj_params = nullptr;
+                return hipblas_convert_status(status);
+            }
+        }
+
+        status = cusolverDnXgesvdjSetTolerance(state->gesvdj_params, std::max(abstol, 0.0));
+        if(status == CUSOLVER_STATUS_SUCCESS)
+            status = cusolverDnXgesvdjSetMaxSweeps(state->gesvdj_params, max_sweeps);
+        if(status == CUSOLVER_STATUS_SUCCESS)
+            status = cusolverDnXgesvdjSetSortEig(state->gesvdj_params, 1);
+
+        *params = state->gesvdj_params;
+        return hipblas_convert_status(status);
+    }
+
+    /****************************************************************************
+     * cuSOLVER and cuBLAS functions by type
+     ***************************************************************************/
+#define HIPBLAS_SOLVER_OVERLOADS(T_, S_, Q_)                                                    \
+    cusolverStatus_t hipblas_getrf_size(                                                        \
+        cusolverDnHandle_t h, int n, T_* A, int lda, int* lwork)                                \
+    {                                                                                           \
+        return cusolverDn##S_##getrf_bufferSize(h, n, n, A, lda, lwork);                        \
+    }                                                                                           \
+    cusolverStatus_t hipblas_getrf(                                                             \
+        cusolverDnHandle_t h, int n, T_* A, int lda, T_* work, int* ipiv, int* info)            \
+    {                                                                                           \
+        return cusolverDn##S_##getrf(h, n, n, A, lda, work, ipiv, info);                        \
+    }                                                                                           \
+    cusolverStatus_t hipblas_getrs(cusolverDnHandle_t h,                                        \
+                                   cublasOperation_t  trans,                                    \
+                                   int                n,                                        \
+                                   int                nrhs,                                     \
+                                   const T_*          A,                                        \
+                                   int                lda,                                      \
+                                   const int*         ipiv,                                     \
+                                   T_*                B,                                        \
+                                   int                ldb,                                      \
+                                   int*               info)                                     \
+    {                                                                                           \
+        return cusolverDn##S_##getrs(h, trans, n, nrhs, A, lda, ipiv, B, ldb, info);            \
+    }                                                                                           \
+    cusolverStatus_t hipblas_geqrf_size(                                                        \
+        cusolverDnHandle_t h, int m, int n, T_* A, int lda, int* lwork)                         \
+    {                                                                                           \
+        return cusolverDn##S_##geqrf_bufferSize(h, m, n, A, lda, lwork);                        \
+    }                                                                                           \
+    cusolverStatus_t hipblas_geqrf(cusolverDnHandle_t h,                                        \
+                                   int                m,                                        \
+                                   int                n,                                        \
+                                   T_*                A,                                        \
+                                   int                lda,                                      \
+                                   T_*                tau,                                      \
+                                   T_*                work,                                     \
+                                   int                lwork,                                    \
+                                   int*               info)                                     \
+    {                                                                                           \
+        return cusolverDn##S_##geqrf(h, m, n, A, lda, tau, work, lwork, info);                  \
+    }                                                                                           \
+    cusolverStatus_t hipblas_ormqr_size(cusolverDnHandle_t h,                                   \
+                                        cublasOperation_t  trans,                               \
+                                        int                m,                                   \
+                                        int                n,                                   \
+                                        int                k,                                   \
+                                        const T_*          A,                                   \
+                                        int                lda,                                 \
+                                        const T_*          tau,                                 \
+                                        const T_*          C,                                   \
+                                        int                ldc,                                 \
+                                        int*               lwork)                               \
+    {                                                                                           \
+        return cusolverDn##S_##Q_##mqr_bufferSize(                                              \
+            h, CUBLAS_SIDE_LEFT, trans, m, n, k, A, lda, tau, C, ldc, lwork);                   \
+    }                                                                                           \
+    cusolverStatus_t hipblas_ormqr(cusolverDnHandle_t h,                                        \
+                                   cublasOperation_t  trans,                                    \
+                                   int                m,                                        \
+                                   int                n,                                        \
+                                   int                k,                                        \
+                                   const T_*          A,                                        \
+                                   int                lda,                                      \
+                                   const T_*          tau,                                      \
+                                   T_*                C,                                        \
+                                   int                ldc,                                      \
+                                   T_*                work,                                     \
+                                   int                lwork,                                    \
+                                   int*               info)                                     \
+    {                                                                                           \
+        return cusolverDn##S_##Q_##mqr(                                                         \
+            h, CUBLAS_SIDE_LEFT, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info);       \
+    }                                                                                           \
+    cusolverStatus_t hipblas_potrf_size(                                                        \
+        cusolverDnHandle_t h, cublasFillMode_t uplo, int n, T_* A, int lda, int* lwork)         \
+    {                                                                                           \
+        return cusolverDn##S_##potrf_bufferSize(h, uplo, n, A, lda, lwork);                     \
+    }                                                                                           \
+    cusolverStatus_t hipblas_potrf(cusolverDnHandle_t h,                                        \
+                                   cublasFillMode_t   uplo,                                     \
+                                   int                n,                                        \
+                                   T_*                A,                                        \
+                                   int                lda,                                      \
+                                   T_*                work,                                     \
+                                   int                lwork,                                    \
+                                   int*               info)                                     \
+    {                                                                                           \
+        return cusolverDn##S_##potrf(h, uplo, n, A, lda, work, lwork, info);                    \
+    }                                                                                           \
+    cusolverStatus_t hipblas_potrf_batched(cusolverDnHandle_t h,                                \
+                                           cublasFillMode_t   uplo,                             \
+                                           int                n,                                \
+                                           T_*                A[],                              \
+                                           int                lda,                              \
+                                           int*               info,                             \
+                                           int                batch_count)                      \
+    {                                                                                           \
+        return cusolverDn##S_##potrfBatched(h, uplo, n, A, lda, info, batch_count);             \
+    }                                                                                           \
+    cusolverStatus_t hipblas_potrs(cusolverDnHandle_t h,                                        \
+                                   cublasFillMode_t   uplo,                                     \
+                                   int                n,                                        \
+                                   int                nrhs,                                     \
+                                   const T_*          A,                                        \
+                                   int                lda,                                      \
+                                   T_*                B,                                        \
+                                   int                ldb,                                      \
+                                   int*               info)                                     \
+    {                                                                                           \
+        return cusolverDn##S_##potrs(h, uplo, n, nrhs, A, lda, B, ldb, info);                   \
+    }                                                                                           \
+    cusolverStatus_t hipblas_potri_size(                                                        \
+        cusolverDnHandle_t h, cublasFillMode_t uplo, int n, T_* A, int lda, int* lwork)         \
+    {                                                                                           \
+        return cusolverDn##S_##potri_bufferSize(h, uplo, n, A, lda, lwork);                     \
+    }                                                                                           \
+    cusolverStatus_t hipblas_potri(cusolverDnHandle_t h,                                        \
+                                   cublasFillMode_t   uplo,                                     \
+                                   int                n,                                        \
+                                   T_*                A,                                        \
+                                   int                lda,                                      \
+                                   T_*                work,                                     \
+                                   int                lwork,                                    \
+                                   int*               info)                                     \
+    {                                                                                           \
+        return cusolverDn##S_##potri(h, uplo, n, A, lda, work, lwork, info);                    \
+    }                                                                                           \
+    cublasStatus_t hipblas_getrf_batched(                                                       \
+        cublasHandle_t h, int n, T_* const A[], int lda, int* ipiv, int* info, int batch_count) \
+    {                                                                                           \
+        return cublas##S_##getrfBatched(h, n, A, lda, ipiv, info, batch_count);                 \
+    }                                                                                           \
+    cublasStatus_t hipblas_getrs_batched(cublasHandle_t    h,                                   \
+                                         cublasOperation_t trans,                               \
+                                         int               n,                                   \
+                                         int               nrhs,                                \
+                                         const T_* const   A[],                                 \
+                                         int               lda,                                 \
+                                         const int*        ipiv,                                \
+                                         T_* const         B[],                                 \
+                                         int               ldb,                                 \
+                                         int*              info,                                \
+                                         int               batch_count)                         \
+    {                                                                                           \
+        return cublas##S_##getrsBatched(                                                        \
+            h, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);                        \
+    }                                                                                           \
+    cublasStatus_t hipblas_geqrf_batched(cublasHandle_t h,                                      \
+                                         int            m,                                      \
+                                         int            n,                                      \
+                                         T_* const      A[],                                    \
+                                         int            lda,                                    \
+                                         T_* const      tau[],                                  \
+                                         int*           info,                                   \
+                                         int            batch_count)                            \
+    {                                                                                           \
+        return cublas##S_##geqrfBatched(h, m, n, A, lda, tau, info, batch_count);               \
+    }                                                                                           \
+    cublasStatus_t hipblas_trsm(cublasHandle_t    h,                                            \
+                                cublasOperation_t trans,                                        \
+                                int               m,                                            \
+                                int               n,                                            \
+                                const T_*         alpha,                                        \
+                                const T_*         A,                                            \
+                                int               lda,                                          \
+                                T_*               B,                                            \
+                                int               ldb)                                          \
+    {                                                                                           \
+        return cublas##S_##trsm(h,                                                              \
+                                CUBLAS_SIDE_LEFT,                                               \
+                                CUBLAS_FILL_MODE_UPPER,                                         \
+                                trans,                                                          \
+                                CUBLAS_DIAG_NON_UNIT,                                           \
+                                m,                                                              \
+                                n,                                                              \
+                                alpha,                                                          \
+                                A,                                                              \
+                                lda,                                                            \
+                                B,                                                              \
+                                ldb);                                                           \
+    }                                                                                           \
+    cublasStatus_t hipblas_trsm_batched(cublasHandle_t    h,                                    \
+                                        cublasFillMode_t  uplo,                                 \
+                                        cublasOperation_t trans,                                \
+                                        int               m,                                    \
+                                        int               n,                                    \
+                                        const T_*         alpha,                                \
+                                        const T_* const   A[],                                  \
+                                        int               lda,                                  \
+                                        T_* const         B[],                                  \
+                                        int               ldb,                                  \
+                                        int               batch_count)                          \
+    {                                                                                           \
+        return cublas##S_##trsmBatched(h,                                                       \
+                                       CUBLAS_SIDE_LEFT,                                        \
+                                       uplo,                                                    \
+                                       trans,                                                   \
+                                       CUBLAS_DIAG_NON_UNIT,                                    \
+                                       m,                                                       \
+                                       n,                                                       \
+                                       alpha,                                                   \
+                                       A,                                                       \
+                                       lda,                                                     \
+                                       B,                                                       \
+                                       ldb,                                                     \
+                                       batch_count);                                            \
+    }
+
+    HIPBLAS_SOLVER_OVERLOADS(float, S, or)
+    HIPBLAS_SOLVER_OVERLOADS(double, D, or)
+    HIPBLAS_SOLVER_OVERLOADS(hipFloatComplex, C, un)
+    HIPBLAS_SOLVER_OVERLOADS(hipDoubleComplex, Z, un)
+
+#undef HIPBLAS_SOLVER_OVERLOADS
+
+#define HIPBLAS_SOLVER_EIG_OVERLOADS(T_, R_, S_, E_)                                            \
+    cusolverStatus_t hipblas_syevj_size(cusolverDnHandle_t h,                                   \
+                                        cusolverEigMode_t  jobz,                                \
+                                        cublasFillMode_t   uplo,                                \
+                                        int                n,                                   \
+                                        const T_*          A,                                   \
+                                        int                lda,                                 \
+                                        const R_*          W,                                   \
+                                        int*               lwork,                               \
+                                        syevjInfo_t        params)                              \
+    {                                                                                           \
+        return cusolverDn##S_##E_##evj_bufferSize(h, jobz, uplo, n, A, lda, W, lwork, params);  \
+    }                                                                                           \
+    cusolverStatus_t hipblas_syevj(cusolverDnHandle_t h,                                        \
+                                   cusolverEigMode_t  jobz,                                     \
+                                   cublasFillMode_t   uplo,                                     \
+                                   int                n,                                        \
+                                   T_*                A,                                        \
+                                   int                lda,                                      \
+                                   R_*                W,                                        \
+                                   T_*                work,                                     \
+                                   int                lwork,                                    \
+                                   int*               info,                                     \
+                                   syevjInfo_t        params)                                   \
+    {                                                                                           \
+        return cusolverDn##S_##E_##evj(h, jobz, uplo, n, A, lda, W, work, lwork, info, params); \
+    }                                                                                           \
+    cusolverStatus_t hipblas_syevj_batched_size(cusolverDnHandle_t h,                           \
+                                                cusolverEigMode_t  jobz,                        \
+                                                cublasFillMode_t   uplo,                        \
+                                                int                n,                           \
+                                                const T_*          A,                           \
+                                                int                lda,                         \
+                                                const R_*          W,                           \
+                                                int*               lwork,                       \
+                                                syevjInfo_t        params,                      \
+                                                int                batch_count)                 \
+    {                                                                                           \
+        return cusolverDn##S_##E_##evjBatched_bufferSize(                                       \
+            h, jobz, uplo, n, A, lda, W, lwork, params, batch_count);                           \
+    }                                                                                           \
+    cusolverStatus_t hipblas_syevj_batched(cusolverDnHandle_t h,                                \
+                                           cusolverEigMode_t  jobz,                             \
+                                           cublasFillMode_t   uplo,                             \
+                                           int                n,                                \
+                                           T_*                A,                                \
+                                           int                lda,                              \
+                                           R_*                W,                                \
+                                           T_*                work,                             \
+                                           int                lwork,                            \
+                                           int*               info,                             \
+                                           syevjInfo_t        params,                           \
+                                           int                batch_count)                      \
+    {                                                                                           \
+        return cusolverDn##S_##E_##evjBatched(                                                  \
+            h, jobz, uplo, n, A, lda, W, work, lwork, info, params, batch_count);               \
+    }                                                                                           \
+    cusolverStatus_t hipblas_syevd_size(cusolverDnHandle_t h,                                   \
+                                        cusolverEigMode_t  jobz,                                \
+                                        cublasFillMode_t   uplo,                                \
+                                        int                n,                                   \
+                                        const T_*          A,                                   \
+                                        int                lda,                                 \
+                                        const R_*          W,                                   \
+                                        int*               lwork)                               \
+    {                                                                                           \
+        return cusolverDn##S_##E_##evd_bufferSize(h, jobz, uplo, n, A, lda, W, lwork);          \
+    }                                                                                           \
+    cusolverStatus_t hipblas_syevd(cusolverDnHandle_t h,                                        \
+                                   cusolverEigMode_t  jobz,                                     \
+                                   cublasFillMode_t   uplo,                                     \
+                                   int                n,                                        \
+                                   T_*                A,                                        \
+                                   int                lda,                                      \
+                                   R_*                W,                                        \
+                                   T_*                work,                                     \
+                                   int                lwork,                                    \
+                                   int*               info)                                     \
+    {                                                                                           \
+        return cusolverDn##S_##E_##evd(h, jobz, uplo, n, A, lda, W, work, lwork, info);         \
+    }
+
+    HIPBLAS_SOLVER_EIG_OVERLOADS(float, float, S, sy)
+    HIPBLAS_SOLVER_EIG_OVERLOADS(double, double, D, sy)
+    HIPBLAS_SOLVER_EIG_OVERLOADS(hipFloatComplex, float, C, he)
+    HIPBLAS_SOLVER_EIG_OVERLOADS(hipDoubleComplex, double, Z, he)
+
+#undef HIPBLAS_SOLVER_EIG_OVERLOADS
+
+#define HIPBLAS_SOLVER_SVD_OVERLOADS(T_, R_, S_)                                                \
+    cusolverStatus_t hipblas_gesvdj_size(cusolverDnHandle_t h,                                  \
+                                         cusolverEigMode_t  jobz,                               \
+                                         int                econ,                               \
+                                         int                m,                                  \
+                                         int                n,                                  \
+                                         const T_*          A,                                  \
+                                         int                lda,                                \
+                                         const R_*          S,                                  \
+                                         const T_*          U,                                  \
+                                         int                ldu,                                \
+                                         const T_*          V,                                  \
+                                         int                ldv,                                \
+                                         int*               lwork,                              \
+                                         gesvdjInfo_t       params)                             \
+    {                                                                                           \
+        return cusolverDn##S_##gesvdj_bufferSize(                                               \
+            h, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, lwork, params);                     \
+    }                                                                                           \
+    cusolverStatus_t hipblas_gesvdj(cusolverDnHandle_t h,                                       \
+                                    cusolverEigMode_t  jobz,                                    \
+                                    int                econ,                                    \
+                                    int                m,                                       \
+                                    int                n,                                       \
+                                    T_*                A,                                       \
+                                    int                lda,                                     \
+                                    R_*                S,                                       \
+                                    T_*                U,                                       \
+                                    int                ldu,                                     \
+                                    T_*                V,                                       \
+                                    int                ldv,                                     \
+                                    T_*                work,                                    \
+                                    int                lwork,                                   \
+                                    int*               info,                                    \
+                                    gesvdjInfo_t       params)                                  \
+    {                                                                                           \
+        return cusolverDn##S_##gesvdj(                                                          \
+            h, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params);         \
+    }                                                                                           \
+    cusolverStatus_t hipblas_gesvdj_batched_size(cusolverDnHandle_t h,                          \
+                                                 cusolverEigMode_t  jobz,                       \
+                                                 int                m,                          \
+                                                 int                n,                          \
+                                                 const T_*          A,                          \
+                                                 int                lda,                        \
+                                                 const R_*          S,                          \
+                                                 const T_*          U,                          \
+                                                 int                ldu,                        \
+                                                 const T_*          V,                          \
+                                                 int                ldv,                        \
+                                                 int*               lwork,                      \
+                                                 gesvdjInfo_t       params,                     \
+                                                 int                batch_count)                \
+    {                                                                                           \
+        return cusolverDn##S_##gesvdjBatched_bufferSize(                                        \
+            h, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, params, batch_count);              \
+    }                                                                                           \
+    cusolverStatus_t hipblas_gesvdj_batched(cusolverDnHandle_t h,                               \
+                                            cusolverEigMode_t  jobz,                            \
+                                            int                m,                               \
+                                            int                n,                               \
+                                            T_*                A,                               \
+                                            int                lda,                             \
+                                            R_*                S,                               \
+                                            T_*                U,                               \
+                                            int                ldu,                             \
+                                            T_*                V,                               \
+                                            int                ldv,                             \
+                                            T_*                work,                            \
+                                            int                lwork,                           \
+                                            int*               info,                            \
+                                            gesvdjInfo_t       params,                          \
+                                            int                batch_count)                     \
+    {                                                                                           \
+        return cusolverDn##S_##gesvdjBatched(                                                   \
+            h, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params, batch_count);  \
+    }
+
+    HIPBLAS_SOLVER_SVD_OVERLOADS(float, float, S)
+    HIPBLAS_SOLVER_SVD_OVERLOADS(double, double, D)
+    HIPBLAS_SOLVER_SVD_OVERLOADS(hipFloatComplex, float, C)
+    HIPBLAS_SOLVER_SVD_OVERLOADS(hipDoubleComplex, double, Z)
+
+#undef HIPBLAS_SOLVER_SVD_OVERLOADS
+
+    template <typename T>
+    T hipblas_solver_one()
+    {
+        if constexpr(hipblas_is_complex<T>)
+            return T{1, 0};
+        else
+            return T(1);
+    }
+
+    // Returns call(cublas) run in host pointer mode, whatever the pointer mode of the handle,
+    // for the cuBLAS calls whose scalars are on the host
+    template <typename F>
+    hipblasStatus_t hipblas_host_pointer_mode(hipblasHandle_t handle, F&& call)
+    {
+        cublasHandle_t      cublas = (cublasHandle_t)handle;
+        cublasPointerMode_t pointer_mode;
+        if(cublasGetPointerMode(cublas, &pointer_mode) != CUBLAS_STATUS_SUCCESS
+           || cublasSetPointerMode(cublas, CUBLAS_POINTER_MODE_HOST) != CUBLAS_STATUS_SUCCESS)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+        cublasStatus_t status = call(cublas);
+        (void)cublasSetPointerMode(cublas, pointer_mode);
+        return hipblas_convert_status(status);
+    }
+
+    // Solves op(R) * X = B in place, where R is the upper triangle of A
+    template <typename T>
+    hipblasStatus_t hipblas_solver_trsm(hipblasHandle_t   handle,
+                                        cublasOperation_t trans,
+                                        int               n,
+                                        int               nrhs,
+                                        const T*          A,
+                                        int               lda,
+                                        T*                B,
+                                        int               ldb)
+    {
+        const T one = hipblas_solver_one<T>();
+        return hipblas_host_pointer_mode(handle, [&](cublasHandle_t cublas) {
+            return hipblas_trsm(cublas, trans, n, nrhs, &one, A, lda, B, ldb);
+        });
+    }
+
+    // Solves A_b * X_b = B_b in place for the batch, with the Cholesky factor of A_b in its uplo
+    // triangle: L * L^H * X = B as L * Y = B then L^H * X = Y, and U^H * U * X = B as
+    // U^H * Y = B then U * X = Y
+    template <typename T>
+    hipblasStatus_t hipblas_solver_potrs_batched(hipblasHandle_t   handle,
+                                                 hipblasFillMode_t uplo,
+                                                 int               n,
+                                                 int               nrhs,
+                                                 const T* const    A[],
+                                                 int               lda,
+                                                 T* const          B[],
+                                                 int               ldb,
+                                                 int               batch_count)
+    {
+        const cublasFillMode_t  fill    = hipblas_solver_fill(uplo);
+        const cublasOperation_t trans_h = hipblas_is_complex<T> ? CUBLAS_OP_C : CUBLAS_OP_T;
+        const cublasOperation_t first   = uplo == HIPBLAS_FILL_MODE_LOWER ? CUBLAS_OP_N : trans_h;
+        const cublasOperation_t second  = uplo == HIPBLAS_FILL_MODE_LOWER ? trans_h : CUBLAS_OP_N;
+
+        const T one = hipblas_solver_one<T>();
+        return hipblas_host_pointer_mode(handle, [&](cublasHandle_t cublas) {
+            cublasStatus_t status = hipblas_trsm_batched(
+                cublas, fill, first, n, nrhs, &one, A, lda, B, ldb, batch_count);
+            if(status == CUBLAS_STATUS_SUCCESS)
+                status = hipblas_trsm_batched(
+                    cublas, fill, second, n, nrhs, &one, A, lda, B, ldb, batch_count);
+            return status;
+        });
+    }
+
+    // Inverts the matrices matrix(b) of the batch from their Cholesky factors, one at a time
+    template <typename T, typename F>
+    hipblasStatus_t hipblas_solver_potri(hipblasHandle_t   handle,
+                                         hipblasFillMode_t uplo,
+                                         int               n,
+                                         int               lda,
+                                         int*              info,
+                                         int               batch_count,
+                                         F&&               matrix)
+    {
+        cusolverDnHandle_t solver;
+        void*              workspace;
+        hipStream_t        stream;
+        int                lwork = 0;
+
+        hipblasStatus_t status = hipblas_solver_begin(handle, 0, &solver, &workspace, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_convert_status(
+                hipblas_potri_size(solver, hipblas_solver_fill(uplo), n, matrix(0), lda, &lwork));
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_solver_begin(handle, sizeof(T) * lwork, &solver, &workspace, &stream);
+
+        for(int b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+            status = hipblas_convert_status(hipblas_potri(solver,
+                                                          hipblas_solver_fill(uplo),
+                                                          n,
+                                                          matrix(b),
+                                                          lda,
+                                                          (T*)workspace,
+                                                          lwork,
+                                                          info + b));
+        return status;
+    }
+
+    template <typename T>
+    __device__ bool hipblas_solver_is_zero(T a)
+    {
+        if constexpr(hipblas_is_complex<T>)
+            return a.x == 0 && a.y == 0;
+        else
+            return a == 0;
+    }
+
+    // info := the first one-based i such that R(i, i) is zero, or 0 if R has full rank
+    template <typename T>
+    __global__ void hipblasGelsInfoKernel(int n, const T* A, int lda, int* info)
+    {
+        __shared__ int first;
+        if(threadIdx.x == 0)
+            first = n;
+        __syncthreads();
+
+        for(int i = threadIdx.x; i < n; i += blockDim.x)
+            if(hipblas_solver_is_zero(A[i + int64_t(i) * lda]))
+                atomicMin(&first, i);
+        __syncthreads();
+
+        if(threadIdx.x == 0)
+            *info = first < n ? first + 1 : 0;
+    }
+
+    constexpr int hipblas_gels_info_block = 256;
+
+    // Copies the m x n matrices A[b] to the contiguous matrices B + b * m * n, with leading
+    // dimension m, or back if unpack
+    template <typename T>
+    __global__ void hipblasPackKernel(int m, int n, T* const A[], int lda, T* B, bool unpack)
+    {
+        T* Ab = A[blockIdx.x];
+        T* Bb = B + int64_t(blockIdx.x) * m * n;
+        for(int k = threadIdx.x; k < m * n; k += blockDim.x)
+        {
+            T* a = Ab + k % m + int64_t(k / m) * lda;
+            if(unpack)
+                *a = Bb[k];
+            else
+                Bb[k] = *a;
+        }
+    }
+
+    constexpr int hipblas_pack_block = 256;
+
+    // Copies the matrices of a batch, strided from A or in A_array, to the contiguous matrices
+    // of packed, or back if unpack. The m x n matrices of A_array are packed with leading
+    // dimension m and the strided ones with lda.
+    template <typename T>
+    hipblasStatus_t hipblas_solver_pack(hipStream_t   stream,
+                                        int           m,
+                                        int           n,
+                                        T*            A,
+                                        int           lda,
+                                        hipblasStride strideA,
+                                        T* const*     A_array,
+                                        T*            packed,
+                                        int           batch_count,
+                                        bool          unpack)
+    {
+        if(A_array)
+        {
+            hipblasPackKernel<T><<<batch_count, hipblas_pack_block, 0, stream>>>(
+                m, n, A_array, lda, packed, unpack);
+            return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                                   : HIPBLAS_STATUS_EXECUTION_FAILED;
+        }
+
+        const size_t width = sizeof(T) * lda * n;
+        hipError_t   error
+            = unpack ? hipMemcpy2DAsync(A,
+                                        sizeof(T) * strideA,
+                                        packed,
+                                        width,
+                                        width,
+                                        batch_count,
+                                        hipMemcpyDeviceToDevice,
+                                        stream)
+                     : hipMemcpy2DAsync(packed,
+                                        width,
+                                        A,
+                                        sizeof(T) * strideA,
+                                        width,
+                                        batch_count,
+                                        hipMemcpyDeviceToDevice,
+                                        stream);
+        return error == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    // Solves the eigenproblems of the matrices matrix(b) of the batch one at a time
+    template <typename T, typename F>
+    hipblasStatus_t hipblas_solver_syevj(hipblasHandle_t           handle,
+                                         hipblasEvect_t            evect,
+                                         hipblasFillMode_t         uplo,
+                                         int                       n,
+                                         int                       lda,
+                                         hipblas_solver_real_t<T>  abstol,
+                                         int                       max_sweeps,
+                                         hipblas_solver_real_t<T>* W,
+                                         hipblasStride             strideW,
+                                         int*                      info,
+                                         int                       batch_count,
+                                         F&&                       matrix)
+    {
+        const cusolverEigMode_t jobz = hipblas_solver_eig_mode(evect);
+        const cublasFillMode_t  fill = hipblas_solver_fill(uplo);
+
+        cusolverDnHandle_t solver;
+        void*              workspace;
+        hipStream_t        stream;
+        syevjInfo_t        params;
+        int                lwork = 0;
+
+        hipblasStatus_t status = hipblas_solver_begin(handle, 0, &solver, &workspace, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_solver_syevj_params(handle, abstol, max_sweeps, &params);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_convert_status(
+                hipblas_syevj_size(solver, jobz, fill, n, matrix(0), lda, W, &lwork, params));
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_solver_begin(handle, sizeof(T) * lwork, &solver, &workspace, &stream);
+
+        for(int b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+            status = hipblas_convert_status(hipblas_syevj(solver,
+                                                          jobz,
+                                                          fill,
+                                                          n,
+                                                          matrix(b),
+                                                          lda,
+                                                          W + b * strideW,
+                                                          (T*)workspace,
+                                                          lwork,
+                                                          info + b,
+                                                          params));
+        return status;
+    }
+
+    // Solves the eigenproblems of a batch of small matrices, strided from A or in A_array, in
+    // one call by the batched Jacobi solver of cuSOLVER. The solver takes contiguous matrices
+    // and eigenvalues, so the matrices and eigenvalues that aren't are copied to the workspace,
+    // ahead of the workspace of cuSOLVER.
+    template <typename T>
+    hipblasStatus_t hipblas_solver_syevj_batched(hipblasHandle_t           handle,
+                                                 hipblasEvect_t            evect,
+                                                 hipblasFillMode_t         uplo,
+                                                 int                       n,
+                                                 T*                        A,
+                                                 int                       lda,
+                                                 hipblasStride             strideA,
+                                                 T* const*                 A_array,
+                                                 hipblas_solver_real_t<T>  abstol,
+                                                 int                       max_sweeps,
+                                                 hipblas_solver_real_t<T>* W,
+                                                 hipblasStride             strideW,
+                                                 int*                      info,
+                                                 int                       batch_count)
+    {
+        using R = hipblas_solver_real_t<T>;
+
+        const cusolverEigMode_t jobz   = hipblas_solver_eig_mode(evect);
+        const cublasFillMode_t  fill   = hipblas_solver_fill(uplo);
+        const int               ld     = A_array ? n : lda;
+        const bool              copy_A = A_array || strideA != hipblasStride(lda) * n;
+        const bool              copy_W = strideW != n;
+        const size_t A_size = copy_A ? hipblas_solver_align(sizeof(T) * ld * n * batch_count) : 0;
+        const size_t W_size = copy_W ? hipblas_solver_align(sizeof(R) * n * batch_count) : 0;
+
+        cusolverDnHandle_t solver;
+        void*              workspace;
+        hipStream_t        stream;
+        syevjInfo_t        params;
+        int                lwork = 0;
+
+        hipblasStatus_t status
+            = hipblas_solver_begin(handle, A_size + W_size, &solver, &workspace, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_solver_syevj_params(handle, abstol, max_sweeps, &params);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_convert_status(
+                hipblas_syevj_batched_size(solver,
+                                           jobz,
+                                           fill,
+                                           n,
+                                           copy_A ? (const T*)workspace : A,
+                                           ld,
+                                           copy_W ? (const R*)((char*)workspace + A_size) : W,
+                                           &lwork,
+                                           params,
+                                           batch_count));
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_solver_begin(
+                handle, A_size + W_size + sizeof(T) * lwork, &solver, &workspace, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        T* matrices    = copy_A ? (T*)workspace : A;
+        R* eigenvalues = copy_W ? (R*)((char*)workspace + A_size) : W;
+        T* work        = (T*)((char*)workspace + A_size + W_size);
+
+        if(copy_A)
+            status = hipblas_solver_pack(
+                stream, n, n, A, lda, strideA, A_array, matrices, batch_count, false);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_convert_status(hipblas_syevj_batched(solver,
+                                                                  jobz,
+                                                                  fill,
+                                                                  n,
+                                                                  matrices,
+                                                                  ld,
+                                                                  eigenvalues,
+                                                                  work,
+                                                                  lwork,
+                                                                  info,
+                                                                  params,
+                                                                  batch_count));
+        if(status == HIPBLAS_STATUS_SUCCESS && copy_A && evect == HIPBLAS_EVECT_ORIGINAL)
+            status = hipblas_solver_pack(
+                stream, n, n, A, lda, strideA, A_array, matrices, batch_count, true);
+        if(status == HIPBLAS_STATUS_SUCCESS && copy_W
+           && hipMemcpy2DAsync(W,
+                               sizeof(R) * strideW,
+                               eigenvalues,
+                               sizeof(R) * n,
+                               sizeof(R) * n,
+                               batch_count,
+                               hipMemcpyDeviceToDevice,
+                               stream)
+                  != hipSuccess)
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+        return status;
+    }
+
+    template <typename T>
+    __device__ T hipblas_solver_conj(T a)
+    {
+        if constexpr(hipblas_is_complex<T>)
+            return T{a.x, -a.y};
+        else
+            return a;
+    }
+
+    // Copies the rows x cols matrices A + b * strideA to B + b * strideB, or their conjugate
+    // transposes if conj_transpose
+    template <typename T>
+    __global__ void hipblasSvdVectorsKernel(int           rows,
+                                            int           cols,
+                                            const T*      A,
+                                            int           lda,
+                                            hipblasStride strideA,
+                                            T*            B,
+                                            int           ldb,
+                                            hipblasStride strideB,
+                                            bool          conj_transpose)
+    {
+        const T* Ab = A + blockIdx.x * strideA;
+        T*       Bb = B + blockIdx.x * strideB;
+        for(int k = threadIdx.x; k < rows * cols; k += blockDim.x)
+        {
+            const int i = k % rows;
+            const int j = k / rows;
+            const T   a = Ab[i + int64_t(j) * lda];
+            if(conj_transpose)
+                Bb[j + int64_t(i) * ldb] = hipblas_solver_conj(a);
+            else
+                Bb[i + int64_t(j) * ldb] = a;
+        }
+    }
+
+    // Copies the singular vectors computed by cuSOLVER from the workspace to U, or to the rows
+    // of V if conj_transpose, as cuSOLVER returns the right singular vectors as columns
+    template <typename T>
+    hipblasStatus_t hipblas_solver_svd_vectors(hipStream_t   stream,
+                                               int           rows,
+                                               int           cols,
+                                               const T*      A,
+                                               int           lda,
+                                               hipblasStride strideA,
+                                               T*            B,
+                                               int           ldb,
+                                               hipblasStride strideB,
+                                               bool          conj_transpose,
+                                               int           batch_count)
+    {
+        hipblasSvdVectorsKernel<T><<<batch_count, hipblas_pack_block, 0, stream>>>(
+            rows, cols, A, lda, strideA, B, ldb, strideB, conj_transpose);
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    // Computes the singular value decompositions of the matrices matrix(b) of the batch one at
+    // a time. cuSOLVER computes both or none of the singular vectors, so the left ones go to the
+    // workspace unless they are requested, and the right ones always do.
+    template <typename T, typename F>
+    hipblasStatus_t hipblas_solver_gesvdj(hipblasHandle_t           handle,
+                                          hipblasSvect_t            left_svect,
+                                          hipblasSvect_t            right_svect,
+                                          int                       m,
+                                          int                       n,
+                                          int                       lda,
+                                          hipblas_solver_real_t<T>  abstol,
+                                          int                       max_sweeps,
+                                          hipblas_solver_real_t<T>* S,
+                                          hipblasStride             strideS,
+                                          T*                        U,
+                                          int                       ldu,
+                                          hipblasStride             strideU,
+                                          T*                        V,
+                                          int                       ldv,
+                                          hipblasStride             strideV,
+                                          int*                      info,
+                                          int                       batch_count,
+                                          F&&                       matrix)
+    {
+        const cusolverEigMode_t jobz   = hipblas_solver_svd_mode(left_svect, right_svect);
+        const int               k      = std::min(m, n);
+        const bool              left   = left_svect == HIPBLAS_SVECT_SINGULAR;
+        const bool              right  = right_svect == HIPBLAS_SVECT_SINGULAR;
+        const int               ld_U   = left ? ldu : m;
+        const size_t            U_size = left ? 0 : hipblas_solver_align(sizeof(T) * m * k);
+        const size_t            V_size = hipblas_solver_align(sizeof(T) * n * k);
+
+        cusolverDnHandle_t solver;
+        void*              workspace;
+        hipStream_t        stream;
+        gesvdjInfo_t       params;
+        int                lwork = 0;
+
+        hipblasStatus_t status
+            = hipblas_solver_begin(handle, U_size + V_size, &solver, &workspace, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_solver_gesvdj_params(handle, abstol, max_sweeps, &params);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_convert_status(
+                hipblas_gesvdj_size(solver,
+                                    jobz,
+                                    1,
+                                    m,
+                                    n,
+                                    matrix(0),
+                                    lda,
+                                    S,
+                                    left ? U : (const T*)workspace,
+                                    ld_U,
+                                    (const T*)((char*)workspace + U_size),
+                                    n,
+                                    &lwork,
+                                    params));
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_solver_begin(
+                handle, U_size + V_size + sizeof(T) * lwork, &solver, &workspace, &stream);
+
+        T* U_work = (T*)workspace;
+        T* V_work = (T*)((char*)workspace + U_size);
+        T* work   = (T*)((char*)workspace + U_size + V_size);
+        for(int b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+        {
+            status = hipblas_convert_status(hipblas_gesvdj(solver,
+                                                           jobz,
+                                                           1,
+                                                           m,
+                                                           n,
+                                                           matrix(b),
+                                                           lda,
+                                                           S + b * strideS,
+                                                           left ? U + b * strideU : U_work,
+                                                           ld_U,
+                                                           V_work,
+                                                           n,
+                                                           work,
+                                                           lwork,
+                                                           info + b,
+                                                           params));
+            if(status == HIPBLAS_STATUS_SUCCESS && right)
+                status = hipblas_solver_svd_vectors(
+                    stream, n, k, V_work, n, 0, V + b * strideV, ldv, 0, true, 1);
+        }
+        return status;
+    }
+
+    // Computes the singular value decompositions of a batch of small matrices, strided from A
+    // or in A_array, in one call by the batched Jacobi solver of cuSOLVER. As for
+    // hipblas_solver_syevj_batched, the matrices and singular values that aren't contiguous are
+    // copied to the workspace, followed by the m x m and n x n singular vectors computed by
+    // cuSOLVER and the workspace of cuSOLVER.
+    template <typename T>
+    hipblasStatus_t hipblas_solver_gesvdj_batched(hipblasHandle_t           handle,
+                                                  hipblasSvect_t            left_svect,
+                                                  hipblasSvect_t            right_svect,
+                                                  int                       m,
+                                                  int                       n,
+                                                  T*                        A,
+                                                  int                       lda,
+                                                  hipblasStride             strideA,
+                                                  T* const*                 A_array,
+                                                  hipblas_solver_real_t<T>  abstol,
+                                                  int                       max_sweeps,
+                                                  hipblas_solver_real_t<T>* S,
+                                                  hipblasStride             strideS,
+                                                  T*                        U,
+                                                  int                       ldu,
+                                                  hipblasStride             strideU,
+                                                  T*                        V,
+                                                  int                       ldv,
+                                                  hipblasStride             strideV,
+                                                  int*                      info,
+                                                  int                       batch_count)
+    {
+        using R = hipblas_solver_real_t<T>;
+
+        const cusolverEigMode_t jobz   = hipblas_solver_svd_mode(left_svect, right_svect);
+        const int               k      = std::min(m, n);
+        const int               ld     = A_array ? m : lda;
+        const bool              copy_A = A_array || strideA != hipblasStride(lda) * n;
+        const bool              copy_S = strideS != k;
+        const size_t A_size = copy_A ? hipblas_solver_align(sizeof(T) * ld * n * batch_count) : 0;
+        const size_t S_size = copy_S ? hipblas_solver_align(sizeof(R) * k * batch_count) : 0;
+        const size_t U_size = hipblas_solver_align(sizeof(T) * m * m * batch_count);
+        const size_t V_size = hipblas_solver_align(sizeof(T) * n * n * batch_count);
+        const size_t size   = A_size + S_size + U_size + V_size;
+
+        cusolverDnHandle_t solver;
+        void*              workspace;
+        hipStream_t        stream;
+        gesvdjInfo_t       params;
+        int                lwork = 0;
+
+        hipblasStatus_t status = hipblas_solver_begin(handle, size, &solver, &workspace, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_solver_gesvdj_params(handle, abstol, max_sweeps, &params);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        T* matrices = copy_A ? (T*)workspace : A;
+        R* values   = copy_S ? (R*)((char*)workspace + A_size) : S;
+        T* U_work   = (T*)((char*)workspace + A_size + S_size);
+        T* V_work   = (T*)((char*)workspace + A_size + S_size + U_size);
+
+        status = hipblas_convert_status(hipblas_gesvdj_batched_size(solver,
+                                                                    jobz,
+                                                                    m,
+                                                                    n,
+                                                                    matrices,
+                                                                    ld,
+                                                                    values,
+                                                                    U_work,
+                                                                    m,
+                                                                    V_work,
+                                                                    n,
+                                                                    &lwork,
+                                                                    params,
+                                                                    batch_count));
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_solver_begin(
+                handle, size + sizeof(T) * lwork, &solver, &workspace, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // the workspace may have moved while growing
+        matrices = copy_A ? (T*)workspace : A;
+        values   = copy_S ? (R*)((char*)workspace + A_size) : S;
+        U_work   = (T*)((char*)workspace + A_size + S_size);
+        V_work   = (T*)((char*)workspace + A_size + S_size + U_size);
+        T* work  = (T*)((char*)workspace + size);
+
+        if(copy_A)
+            status = hipblas_solver_pack(
+                stream, m, n, A, lda, strideA, A_array, matrices, batch_count, false);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_convert_status(hipblas_gesvdj_batched(solver,
+                                                                   jobz,
+                                                                   m,
+                                                                   n,
+                                                                   matrices,
+                                                                   ld,
+                                                                   values,
+                                                                   U_work,
+                                                                   m,
+                                                                   V_work,
+                                                                   n,
+                                                                   work,
+                                                                   lwork,
+                                                                   info,
+                                                                   params,
+                                                                   batch_count));
+        if(status == HIPBLAS_STATUS_SUCCESS && copy_S
+           && hipMemcpy2DAsync(S,
+                               sizeof(R) * strideS,
+                               values,
+                               sizeof(R) * k,
+                               sizeof(R) * k,
+                               batch_count,
+                               hipMemcpyDeviceToDevice,
+                               stream)
+                  != hipSuccess)
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+        if(status == HIPBLAS_STATUS_SUCCESS && left_svect == HIPBLAS_SVECT_SINGULAR)
+            status = hipblas_solver_svd_vectors(
+                stream, m, k, U_work, m, m * m, U, ldu, strideU, false, batch_count);
+        if(status == HIPBLAS_STATUS_SUCCESS && right_svect == HIPBLAS_SVECT_SINGULAR)
+            status = hipblas_solver_svd_vectors(
+                stream, n, k, V_work, n, n * n, V, ldv, strideV, true, batch_count);
+        return status;
+    }
+
+    template <typename T>
+    __device__ T hipblas_solver_mul(T a, T b)
+    {
+        if constexpr(std::is_same_v<T, hipFloatComplex>)
+            return hipCmulf(a, b);
+        else if constexpr(std::is_same_v<T, hipDoubleComplex>)
+            return hipCmul(a, b);
+        else
+            return a * b;
+    }
+
+    template <typename T>
+    __device__ T hipblas_solver_div(T a, T b)
+    {
+        if constexpr(std::is_same_v<T, hipFloatComplex>)
+            return hipCdivf(a, b);
+        else if constexpr(std::is_same_v<T, hipDoubleComplex>)
+            return hipCdiv(a, b);
+        else
+            return a / b;
+    }
+
+    template <typename T>
+    __device__ T hipblas_solver_sub(T a, T b)
+    {
+        if constexpr(std::is_same_v<T, hipFloatComplex>)
+            return hipCsubf(a, b);
+        else if constexpr(std::is_same_v<T, hipDoubleComplex>)
+            return hipCsub(a, b);
+        else
+            return a - b;
+    }
+
+    // |re(a)| + |im(a)|, the magnitude used by the partial pivoting of getrf
+    template <typename T>
+    __device__ auto hipblas_solver_abs1(T a)
+    {
+        if constexpr(hipblas_is_complex<T>)
+            return (a.x < 0 ? -a.x : a.x) + (a.y < 0 ? -a.y : a.y);
+        else
+            return a < 0 ? -a : a;
+    }
+
+    // Factors and solves one n x n system of the batch per block, n <= hipblas_gesv_max_size,
+    // with A strided from A or in A_array and B strided from B or in B_array. A is factored in
+    // shared memory like getf2, one column at a time, and then each thread solves columns of
+    // B with the factors still in shared memory, so that the batch takes a single launch.
+    constexpr int hipblas_gesv_max_size = 32;
+    constexpr int hipblas_gesv_block    = 64;
+
+    template <typename T>
+    __global__ void hipblasGesvKernel(int           n,
+                                      int           nrhs,
+                                      T*            A,
+                                      T* const*     A_array,
+                                      int           lda,
+                                      hipblasStride strideA,
+                                      int*          ipiv,
+                                      hipblasStride strideP,
+                                      T*            B,
+                                      T* const*     B_array,
+                                      int           ldb,
+                                      hipblasStride strideB,
+                                      int*          info)
+    {
+        constexpr int ld = hipblas_gesv_max_size;
+
+        __shared__ T   LU[ld * ld];
+        __shared__ int pivots[ld];
+        __shared__ int singular;
+
+        const int b  = blockIdx.x;
+        T*        Ab = A_array ? A_array[b] : A + b * strideA;
+        T*        Bb = B_array ? B_array[b] : B + b * strideB;
+
+        for(int k = threadIdx.x; k < n * n; k += blockDim.x)
+            LU[k % n + (k / n) * ld] = Ab[k % n + int64_t(k / n) * lda];
+        if(threadIdx.x == 0)
+            singular = 0;
+        __syncthreads();
+
+        for(int j = 0; j < n; j++)
+        {
+            // the first row of largest magnitude in column j is the pivot
+            if(threadIdx.x == 0)
+            {
+                int  p       = j;
+                auto largest = hipblas_solver_abs1(LU[j + j * ld]);
+                for(int i = j + 1; i < n; i++)
+                {
+                    auto a = hipblas_solver_abs1(LU[i + j * ld]);
+                    if(a > largest)
+                    {
+                        p       = i;
+                        largest = a;
+                    }
+                }
+                pivots[j] = p;
+                if(largest == 0 && singular == 0)
+                    singular = j + 1;
+            }
+            __syncthreads();
+
+            const int p = pivots[j];
+            if(p != j)
+                for(int k = threadIdx.x; k < n; k += blockDim.x)
+                {
+                    T t            = LU[j + k * ld];
+                    LU[j + k * ld] = LU[p + k * ld];
+                    LU[p + k * ld] = t;
+                }
+            __syncthreads();
+
+            // a zero pivot has a zero column below it, which is left unscaled
+            const T pivot = LU[j + j * ld];
+            if(!hipblas_solver_is_zero(pivot))
+                for(int i = j + 1 + threadIdx.x; i < n; i += blockDim.x)
+                    LU[i + j * ld] = hipblas_solver_div(LU[i + j * ld], pivot);
+            __syncthreads();
+
+            const int m = n - j - 1;
+            for(int k = threadIdx.x; k < m * m; k += blockDim.x)
+            {
+                const int r = j + 1 + k % m;
+                const int c = j + 1 + k / m;
+                LU[r + c * ld] = hipblas_solver_sub(
+                    LU[r + c * ld], hipblas_solver_mul(LU[r + j * ld], LU[j + c * ld]));
+            }
+            __syncthreads();
+        }
+
+        for(int k = threadIdx.x; k < n * n; k += blockDim.x)
+            Ab[k % n + int64_t(k / n) * lda] = LU[k % n + (k / n) * ld];
+        for(int j = threadIdx.x; j < n; j += blockDim.x)
+            ipiv[b * strideP + j] = pivots[j] + 1;
+        if(threadIdx.x == 0)
+            info[b] = singular;
+
+        // the solution of a singular system is not computed, as with rocSOLVER
+        if(singular)
+            return;
+
+        for(int c = threadIdx.x; c < nrhs; c += blockDim.x)
+        {
+            T* x = Bb + int64_t(c) * ldb;
+            for(int j = 0; j < n; j++)
+                if(pivots[j] != j)
+                {
+                    T t          = x[j];
+                    x[j]         = x[pivots[j]];
+                    x[pivots[j]] = t;
+                }
+            for(int j = 0; j < n; j++)
+                for(int i = j + 1; i < n; i++)
+                    x[i] = hipblas_solver_sub(x[i], hipblas_solver_mul(LU[i + j * ld], x[j]));
+            for(int j = n - 1; j >= 0; j--)
+            {
+                x[j] = hipblas_solver_div(x[j], LU[j + j * ld]);
+                for(int i = 0; i < j; i++)
+                    x[i] = hipblas_solver_sub(x[i], hipblas_solver_mul(LU[i + j * ld], x[j]));
+            }
+        }
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblas_solver_gesv(hipblasHandle_t handle,
+                                        int             n,
+                                        int             nrhs,
+                                        T*              A,
+                                        T* const*       A_array,
+                                        int             lda,
+                                        hipblasStride   strideA,
+                                        int*            ipiv,
+                                        hipblasStride   strideP,
+                                        T*              B,
+                                        T* const*       B_array,
+                                        int             ldb,
+                                        hipblasStride   strideB,
+                                        int*            info,
+                                        int             batch_count)
+    {
+        cudaStream_t stream;
+        if(cublasGetStream((cublasHandle_t)handle, &stream) != CUBLAS_STATUS_SUCCESS)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+        hipblasGesvKernel<T><<<batch_count, hipblas_gesv_block, 0, stream>>>(
+            n, nrhs, A, A_array, lda, strideA, ipiv, strideP, B, B_array, ldb, strideB, info);
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+}
+
+template <typename T, bool STRIDED>
+hipblasStatus_t hipblasSolverGetrf(hipblasHandle_t handle,
+                                   int             n,
+                                   T*              A,
+                                   int             lda,
+                                   hipblasStride   strideA,
+                                   int*            ipiv,
+                                   hipblasStride   strideP,
+                                   int*            info,
+                                   int             batch_count)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max(1, n) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if((A == nullptr && n && batch_count) || (info == nullptr && batch_count))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(batch_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    if(n == 0)
+        return hipblas_solver_zero_info(handle, info, batch_count);
+
+    if(STRIDED && batch_count > 1 && n <= hipblas_solver_batched_max_size)
+    {
+        // cuBLAS writes the pivots of problem b at b * n, so they are copied to ipiv with
+        // strideP unless the strides are the same
+        const bool   copy_ipiv = ipiv && strideP != n;
+        const size_t ptr_size  = hipblas_solver_align(sizeof(T*) * batch_count);
+        const size_t size      = ptr_size + (copy_ipiv ? sizeof(int) * n * batch_count : 0);
+
+        void*           buffer;
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblas_solver_batch_buffer(handle, size, &buffer, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        T**  pointers = (T**)buffer;
+        int* pivots   = copy_ipiv ? (int*)((char*)buffer + ptr_size) : ipiv;
+        status        = hipblas_strided_pointers(stream, A, strideA, batch_count, pointers);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_convert_status(hipblas_getrf_batched(
+                (cublasHandle_t)handle, n, pointers, lda, pivots, info, batch_count));
+        if(status == HIPBLAS_STATUS_SUCCESS && copy_ipiv
+           && hipMemcpy2DAsync(ipiv,
+                               sizeof(int) * strideP,
+                               pivots,
+                               sizeof(int) * n,
+                               sizeof(int) * n,
+                               batch_count,
+                               hipMemcpyDeviceToDevice,
+                               stream)
+                  != hipSuccess)
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+        return status;
+    }
+
+    cusolverDnHandle_t solver;
+    void*              workspace;
+    hipStream_t        stream;
+    int                lwork = 0;
+
+    // the workspace is queried with the handle, which is created by the first call
+    hipblasStatus_t status = hipblas_solver_begin(handle, 0, &solver, &workspace, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblas_convert_status(hipblas_getrf_size(solver, n, A, lda, &lwork));
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblas_solver_begin(handle, sizeof(T) * lwork, &solver, &workspace, &stream);
+
+    for(int b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+        status = hipblas_convert_status(hipblas_getrf(solver,
+                                                      n,
+                                                      A + b * strideA,
+                                                      lda,
+                                                      (T*)workspace,
+                                                      ipiv ? ipiv + b * strideP : nullptr,
+                                                      info + b));
+    return status;
+}
+
+template <typename T, bool STRIDED>
+hipblasStatus_t hipblasSolverGetrs(hipblasHandle_t    handle,
+                                   hipblasOperation_t trans,
+                                   int                n,
+                                   int                nrhs,
+                                   T*                 A,
+                                   int                lda,
+                                   hipblasStride      strideA,
+                                   const int*         ipiv,
+                                   hipblasStride      strideP,
+                                   T*                 B,
+                                   int                ldb,
+                                   hipblasStride      strideB,
+                                   int*               info,
+                                   int                batch_count)
+{
+    if(info == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == nullptr && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(ipiv == nullptr && n)
+        *info = STRIDED ? -7 : -6;
+    else if(B == nullptr && n * nrhs)
+        *info = STRIDED ? -9 : -7;
+    else if(ldb < std::max(1, n))
+        *info = STRIDED ? -10 : -8;
+    else if(STRIDED && batch_count < 0)
+        *info = -13;
+    else
+        *info = 0;
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    cusolverDnHandle_t solver;
+    void*              workspace;
+    hipStream_t        stream;
+    hipblasStatus_t    status
+        = hipblas_solver_begin(handle, hipblas_solver_scratch, &solver, &workspace, &stream);
+
+    for(int b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+        status = hipblas_convert_status(hipblas_getrs(solver,
+                                                      hipblas_solver_operation<T>(trans),
+                                                      n,
+                                                      nrhs,
+                                                      A + b * strideA,
+                                                      lda,
+                                                      ipiv + b * strideP,
+                                                      B + b * strideB,
+                                                      ldb,
+                                                      (int*)workspace));
+    return status;
+}
+
+template <typename T, bool STRIDED>
+hipblasStatus_t hipblasSolverGeqrf(hipblasHandle_t handle,
+                                   int             m,
+                                   int             n,
+                                   T*              A,
+                                   int             lda,
+                                   hipblasStride   strideA,
+                                   T*              tau,
+                                   hipblasStride   strideT,
+                                   int*            info,
+                                   int             batch_count)
+{
+    if(info == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == nullptr && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == nullptr && m * n)
+        *info = STRIDED ? -6 : -5;
+    else if(STRIDED && batch_count < 0)
+        *info = -9;
+    else
+        *info = 0;
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(m == 0 || n == 0 || batch_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    if(STRIDED && batch_count > 1 && m <= hipblas_solver_batched_max_size
+       && n <= hipblas_solver_batched_max_size)
+    {
+        void*           buffer;
+        hipStream_t     stream;
+        hipblasStatus_t status
+            = hipblas_solver_batch_buffer(handle, 2 * sizeof(T*) * batch_count, &buffer, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // the arguments are checked above, so the info of cuBLAS is always 0
+        T** pointers   = (T**)buffer;
+        T** tau_arrays = pointers + batch_count;
+        int batch_info = 0;
+        status         = hipblas_strided_pointers(stream, A, strideA, batch_count, pointers);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_strided_pointers(stream, tau, strideT, batch_count, tau_arrays);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_convert_status(hipblas_geqrf_batched((cublasHandle_t)handle,
+                                                                  m,
+                                                                  n,
+                                                                  pointers,
+                                                                  lda,
+                                                                  tau_arrays,
+                                                                  &batch_info,
+                                                                  batch_count));
+        return status;
+    }
+
+    cusolverDnHandle_t solver;
+    void*              workspace;
+    hipStream_t        stream;
+    int                lwork = 0;
+
+    hipblasStatus_t status
+        = hipblas_solver_begin(handle, hipblas_solver_scratch, &solver, &workspace, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblas_convert_status(hipblas_geqrf_size(solver, m, n, A, lda, &lwork));
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblas_solver_begin(handle,
+                                      hipblas_solver_scratch + sizeof(T) * lwork,
+                                      &solver,
+                                      &workspace,
+                                      &stream);
+
+    T* work = (T*)((char*)workspace + hipblas_solver_scratch);
+    for(int b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+        status = hipblas_convert_status(hipblas_geqrf(solver,
+                                                      m,
+                                                      n,
+                                                      A + b * strideA,
+                                                      lda,
+                                                      tau + b * strideT,
+                                                      work,
+                                                      lwork,
+                                                      (int*)workspace));
+    return status;
+}
+
+template <typename T>
+hipblasStatus_t hipblasSolverGeqrfBatchedStridedTau(hipblasHandle_t handle,
+                                                    int             m,
+                                                    int             n,
+                                                    T* const        A[],
+                                                    int             lda,
+                                                    T*              tau,
+                                                    hipblasStride   strideT,
+                                                    int*            info,
+                                                    int             batch_count)
+{
+    if(info == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == nullptr && m * n)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == nullptr && m * n)
+        *info = -5;
+    else if(batch_count < 0)
+        *info = -8;
+    else
+        *info = 0;
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(m == 0 || n == 0 || batch_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    void*           buffer;
+    hipStream_t     stream;
+    hipblasStatus_t status
+        = hipblas_solver_batch_buffer(handle, sizeof(T*) * batch_count, &buffer, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // the arguments are checked above, so the info of cuBLAS is always 0
+    T** tau_arrays = (T**)buffer;
+    int batch_info = 0;
+    status         = hipblas_strided_pointers(stream, tau, strideT, batch_count, tau_arrays);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblas_convert_status(hipblas_geqrf_batched(
+            (cublasHandle_t)handle, m, n, A, lda, tau_arrays, &batch_info, batch_count));
+    return status;
+}
+
+template <typename T, bool STRIDED>
+hipblasStatus_t hipblasSolverGels(hipblasHandle_t    handle,
+                                  hipblasOperation_t trans,
+                                  int                m,
+                                  int                n,
+                                  int                nrhs,
+                                  T*                 A,
+                                  int                lda,
+                                  hipblasStride      strideA,
+                                  T*                 B,
+                                  int                ldb,
+                                  hipblasStride      strideB,
+                                  int*               info,
+                                  int*               deviceInfo,
+                                  int                batch_count)
+{
+    const hipblasOperation_t trans_h = hipblas_is_complex<T> ? HIPBLAS_OP_C : HIPBLAS_OP_T;
+
+    if(info == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(trans != HIPBLAS_OP_N && trans != trans_h)
+        *info = -1;
+    else if(m < 0)
+        *info = -2;
+    else if(n < 0)
+        *info = -3;
+    else if(nrhs < 0)
+        *info = -4;
+    else if(A == nullptr && m * n)
+        *info = -5;
+    else if(lda < m)
+        *info = -6;
+    else if(B == nullptr && (m * nrhs || n * nrhs))
+        *info = STRIDED ? -8 : -7;
+    else if(ldb < m || ldb < n)
+        *info = STRIDED ? -9 : -8;
+    else if(deviceInfo == nullptr && (!STRIDED || batch_count))
+        *info = STRIDED ? -12 : -10;
+    else if(STRIDED && batch_count < 0)
+        *info = -13;
+    else
+        *info = 0;
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(m < n)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(batch_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    cusolverDnHandle_t solver;
+    void*              workspace;
+    hipStream_t        stream;
+    int                lwork = 0;
+
+    hipblasStatus_t status
+        = hipblas_solver_begin(handle, hipblas_solver_scratch, &solver, &workspace, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // a matrix without columns has full rank
+    if(n == 0)
+    {
+        if(hipMemsetAsync(deviceInfo, 0, sizeof(int) * batch_count, stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        if(trans == HIPBLAS_OP_N || m == 0 || nrhs == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // the workspace of geqrf and ormqr follows the Householder scalars of Q
+    const size_t tau_size = hipblas_solver_align(sizeof(T) * n);
+    if(n > 0)
+    {
+        int qr_lwork = 0;
+        int q_lwork  = 0;
+        status       = hipblas_convert_status(hipblas_geqrf_size(solver, m, n, A, lda, &qr_lwork));
+        if(status == HIPBLAS_STATUS_SUCCESS && nrhs > 0)
+            status = hipblas_convert_status(
+                hipblas_ormqr_size(solver,
+                                   trans == HIPBLAS_OP_N ? hipblas_solver_operation<T>(trans_h)
+                                                         : CUBLAS_OP_N,
+                                   m,
+                                   nrhs,
+                                   n,
+                                   A,
+                                   lda,
+                                   (const T*)workspace,
+                                   B,
+                                   ldb,
+                                   &q_lwork));
+        lwork = std::max(qr_lwork, q_lwork);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_solver_begin(handle,
+                                          hipblas_solver_scratch + tau_size + sizeof(T) * lwork,
+                                          &solver,
+                                          &workspace,
+                                          &stream);
+    }
+
+    int* scratch = (int*)workspace;
+    T*   tau     = (T*)((char*)workspace + hipblas_solver_scratch);
+    T*   work    = (T*)((char*)tau + tau_size);
+    for(int b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+    {
+        T* Ab = A + b * strideA;
+        T* Bb = B + b * strideB;
+
+        if(n > 0)
+        {
+            status = hipblas_convert_status(
+                hipblas_geqrf(solver, m, n, Ab, lda, tau, work, lwork, scratch));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                break;
+
+            // the solution of a rank deficient A is left to the caller to discard, as telling
+            // the host would synchronize with the device
+            hipblasGelsInfoKernel<T>
+                <<<1, hipblas_gels_info_block, 0, stream>>>(n, Ab, lda, deviceInfo + b);
+            if(hipGetLastError() != hipSuccess)
+                status = HIPBLAS_STATUS_EXECUTION_FAILED;
+        }
+        if(status != HIPBLAS_STATUS_SUCCESS || nrhs == 0)
+            continue;
+
+        if(trans == HIPBLAS_OP_N)
+        {
+            // X = R^-1 * Q^H * B, in the first n rows of B
+            status = hipblas_convert_status(hipblas_ormqr(solver,
+                                                          hipblas_solver_operation<T>(trans_h),
+                                                          m,
+                                                          nrhs,
+                                                          n,
+                                                          Ab,
+                                                          lda,
+                                                          tau,
+                                                          Bb,
+                                                          ldb,
+                                                          work,
+                                                          lwork,
+                                                          scratch));
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblas_solver_trsm(
+                    handle, CUBLAS_OP_N, n, nrhs, (const T*)Ab, lda, Bb, ldb);
+        }
+        else
+        {
+            // X = Q * [R^-H * B; 0], the solution of least norm
+            if(n > 0)
+                status = hipblas_solver_trsm(handle,
+                                             hipblas_solver_operation<T>(trans),
+                                             n,
+                                             nrhs,
+                                             (const T*)Ab,
+                                             lda,
+                                             Bb,
+                                             ldb);
+            if(status == HIPBLAS_STATUS_SUCCESS && m > n
+               && hipMemset2DAsync(
+                      Bb + n, sizeof(T) * ldb, 0, sizeof(T) * (m - n), nrhs, stream)
+                      != hipSuccess)
+                status = HIPBLAS_STATUS_EXECUTION_FAILED;
+            if(status == HIPBLAS_STATUS_SUCCESS && n > 0)
+                status = hipblas_convert_status(hipblas_ormqr(solver,
+                                                              CUBLAS_OP_N,
+                                                              m,
+                                                              nrhs,
+                                                              n,
+                                                              Ab,
+                                                              lda,
+                                                              tau,
+                                                              Bb,
+                                                              ldb,
+                                                              work,
+                                                              lwork,
+                                                              scratch));
+        }
+    }
+    return status;
+}
+
+template <typename T, bool STRIDED>
+hipblasStatus_t hipblasSolverPotrf(hipblasHandle_t   handle,
+                                   hipblasFillMode_t uplo,
+                                   int               n,
+                                   T*                A,
+                                   int               lda,
+                                   hipblasStride     strideA,
+                                   int*              info,
+                                   int               batch_count)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!hipblas_solver_valid_fill(uplo) || n < 0 || lda < std::max(1, n) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if((A == nullptr && n && batch_count) || (info == nullptr && batch_count))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(batch_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(n == 0)
+        return hipblas_solver_zero_info(handle, info, batch_count);
+
+    cusolverDnHandle_t solver;
+    void*              workspace;
+    hipStream_t        stream;
+    int                lwork = 0;
+
+    hipblasStatus_t status = hipblas_solver_begin(handle, 0, &solver, &workspace, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    if(STRIDED && batch_count > 1 && n <= hipblas_solver_batched_max_size)
+    {
+        void* buffer;
+        status = hipblas_solver_batch_buffer(handle, sizeof(T*) * batch_count, &buffer, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_strided_pointers(stream, A, strideA, batch_count, (T**)buffer);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_convert_status(hipblas_potrf_batched(
+                solver, hipblas_solver_fill(uplo), n, (T**)buffer, lda, info, batch_count));
+        return status;
+    }
+
+    status = hipblas_convert_status(
+        hipblas_potrf_size(solver, hipblas_solver_fill(uplo), n, A, lda, &lwork));
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblas_solver_begin(handle, sizeof(T) * lwork, &solver, &workspace, &stream);
+
+    for(int b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+        status = hipblas_convert_status(hipblas_potrf(solver,
+                                                      hipblas_solver_fill(uplo),
+                                                      n,
+                                                      A + b * strideA,
+                                                      lda,
+                                                      (T*)workspace,
+                                                      lwork,
+                                                      info + b));
+    return status;
+}
+
+template <typename T>
+hipblasStatus_t hipblasSolverPotrfBatched(hipblasHandle_t   handle,
+                                          hipblasFillMode_t uplo,
+                                          int               n,
+                                          T* const          A[],
+                                          int               lda,
+                                          int*              info,
+                                          int               batch_count)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!hipblas_solver_valid_fill(uplo) || n < 0 || lda < std::max(1, n) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if((A == nullptr && n && batch_count) || (info == nullptr && batch_count))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(batch_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(n == 0)
+        return hipblas_solver_zero_info(handle, info, batch_count);
+
+    cusolverDnHandle_t solver;
+    void*              workspace;
+    hipStream_t        stream;
+    hipblasStatus_t    status = hipblas_solver_begin(handle, 0, &solver, &workspace, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblas_convert_status(hipblas_potrf_batched(
+            solver, hipblas_solver_fill(uplo), n, (T**)A, lda, info, batch_count));
+    return status;
+}
+
+template <typename T, bool STRIDED>
+hipblasStatus_t hipblasSolverPotrs(hipblasHandle_t   handle,
+                                   hipblasFillMode_t uplo,
+                                   int               n,
+                                   int               nrhs,
+                                   T*                A,
+                                   int               lda,
+                                   hipblasStride     strideA,
+                                   T*                B,
+                                   int               ldb,
+                                   hipblasStride     strideB,
+                                   int*              info,
+                                   int               batch_count)
+{
+    if(info == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(!hipblas_solver_valid_fill(uplo))
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == nullptr && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(B == nullptr && n * nrhs)
+        *info = STRIDED ? -7 : -6;
+    else if(ldb < std::max(1, n))
+        *info = STRIDED ? -8 : -7;
+    else if(STRIDED && batch_count < 0)
+        *info = -11;
+    else
+        *info = 0;
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    if(STRIDED && batch_count > 1 && n <= hipblas_solver_batched_max_size)
+    {
+        void*           buffer;
+        hipStream_t     stream;
+        hipblasStatus_t status
+            = hipblas_solver_batch_buffer(handle, 2 * sizeof(T*) * batch_count, &buffer, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        T** A_arrays = (T**)buffer;
+        T** B_arrays = A_arrays + batch_count;
+        status       = hipblas_strided_pointers(stream, A, strideA, batch_count, A_arrays);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_strided_pointers(stream, B, strideB, batch_count, B_arrays);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_solver_potrs_batched(
+                handle, uplo, n, nrhs, (const T* const*)A_arrays, lda, B_arrays, ldb, batch_count);
+        return status;
+    }
+
+    cusolverDnHandle_t solver;
+    void*              workspace;
+    hipStream_t        stream;
+    hipblasStatus_t    status
+        = hipblas_solver_begin(handle, hipblas_solver_scratch, &solver, &workspace, &stream);
+
+    for(int b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+        status = hipblas_convert_status(hipblas_potrs(solver,
+                                                      hipblas_solver_fill(uplo),
+                                                      n,
+                                                      nrhs,
+                                                      A + b * strideA,
+                                                      lda,
+                                                      B + b * strideB,
+                                                      ldb,
+                                                      (int*)workspace));
+    return status;
+}
+
+template <typename T>
+hipblasStatus_t hipblasSolverPotrsBatched(hipblasHandle_t   handle,
+                                          hipblasFillMode_t uplo,
+                                          int               n,
+                                          int               nrhs,
+                                          T* const          A[],
+                                          int               lda,
+                                          T* const          B[],
+                                          int               ldb,
+                                          int*              info,
+                                          int               batch_count)
+{
+    if(info == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(!hipblas_solver_valid_fill(uplo))
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == nullptr && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(B == nullptr && n * nrhs)
+        *info = -6;
+    else if(ldb < std::max(1, n))
+        *info = -7;
+    else if(batch_count < 0)
+        *info = -9;
+    else
+        *info = 0;
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    return hipblas_solver_potrs_batched(
+        handle, uplo, n, nrhs, (const T* const*)A, lda, B, ldb, batch_count);
+}
+
+template <typename T, bool STRIDED>
+hipblasStatus_t hipblasSolverPotri(hipblasHandle_t   handle,
+                                   hipblasFillMode_t uplo,
+                                   int               n,
+                                   T*                A,
+                                   int               lda,
+                                   hipblasStride     strideA,
+                                   int*              info,
+                                   int               batch_count)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!hipblas_solver_valid_fill(uplo) || n < 0 || lda < std::max(1, n) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if((A == nullptr && n && batch_count) || (info == nullptr && batch_count))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(batch_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(n == 0)
+        return hipblas_solver_zero_info(handle, info, batch_count);
+
+    return hipblas_solver_potri<T>(
+        handle, uplo, n, lda, info, batch_count, [&](int b) { return A + b * strideA; });
+}
+
+template <typename T>
+hipblasStatus_t hipblasSolverPotriBatched(hipblasHandle_t   handle,
+                                          hipblasFillMode_t uplo,
+                                          int               n,
+                                          T* const          A[],
+                                          int               lda,
+                                          int*              info,
+                                          int               batch_count)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!hipblas_solver_valid_fill(uplo) || n < 0 || lda < std::max(1, n) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if((A == nullptr && n && batch_count) || (info == nullptr && batch_count))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(batch_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(n == 0)
+        return hipblas_solver_zero_info(handle, info, batch_count);
+
+    // neither cuSOLVER nor cuBLAS has a batched potri, so the matrices are inverted one at a
+    // time with their pointers copied to the host
+    hipblasHostPointers pointers;
+    hipblasStatus_t     status = pointers.copy(handle, batch_count, {A});
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return hipblas_solver_potri<T>(
+        handle, uplo, n, lda, info, batch_count, [&](int b) { return pointers(A, b); });
+}
+
+template <typename T, bool STRIDED>
+hipblasStatus_t hipblasSolverSyevj(hipblasHandle_t           handle,
+                                   hipblasEvect_t            evect,
+                                   hipblasFillMode_t         uplo,
+                                   int                       n,
+                                   T*                        A,
+                                   int                       lda,
+                                   hipblasStride             strideA,
+                                   hipblas_solver_real_t<T>  abstol,
+                                   hipblas_solver_real_t<T>* residual,
+                                   int                       max_sweeps,
+                                   int*                      n_sweeps,
+                                   hipblas_solver_real_t<T>* W,
+                                   hipblasStride             strideW,
+                                   int*                      info,
+                                   int                       batch_count)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!hipblas_solver_valid_evect(evect))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(!hipblas_solver_valid_fill(uplo) || n < 0 || lda < std::max(1, n) || max_sweeps <= 0
+       || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(((A == nullptr || W == nullptr) && n && batch_count)
+       || ((residual == nullptr || n_sweeps == nullptr || info == nullptr) && batch_count))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(batch_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(n == 0)
+        return hipblas_solver_zero_info(handle, info, batch_count);
+
+    // the matrices and eigenvalues that aren't contiguous are copied, unless they overlap
+    if(STRIDED && batch_count > 1 && n <= hipblas_solver_batched_max_size
+       && strideA >= hipblasStride(lda) * n && strideW >= n)
+        return hipblas_solver_syevj_batched<T>(handle,
+                                               evect,
+                                               uplo,
+                                               n,
+                                               A,
+                                               lda,
+                                               strideA,
+                                               nullptr,
+                                               abstol,
+                                               max_sweeps,
+                                               W,
+                                               strideW,
+                                               info,
+                                               batch_count);
+
+    return hipblas_solver_syevj<T>(handle,
+                                   evect,
+                                   uplo,
+                                   n,
+                                   lda,
+                                   abstol,
+                                   max_sweeps,
+                                   W,
+                                   strideW,
+                                   info,
+                                   batch_count,
+                                   [&](int b) { return A + b * strideA; });
+}
+
+template <typename T>
+hipblasStatus_t hipblasSolverSyevjBatched(hipblasHandle_t           handle,
+                                          hipblasEvect_t            evect,
+                                          hipblasFillMode_t         uplo,
+                                          int                       n,
+                                          T* const                  A[],
+                                          int                       lda,
+                                          hipblas_solver_real_t<T>  abstol,
+                                          hipblas_solver_real_t<T>* residual,
+                                          int                       max_sweeps,
+                                          int*                      n_sweeps,
+                                          hipblas_solver_real_t<T>* W,
+                                          hipblasStride             strideW,
+                                          int*                      info,
+                                          int                       batch_count)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!hipblas_solver_valid_evect(evect))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(!hipblas_solver_valid_fill(uplo) || n < 0 || lda < std::max(1, n) || max_sweeps <= 0
+       || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(((A == nullptr || W == nullptr) && n && batch_count)
+       || ((residual == nullptr || n_sweeps == nullptr || info == nullptr) && batch_count))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(batch_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(n == 0)
+        return hipblas_solver_zero_info(handle, info, batch_count);
+
+    if(n <= hipblas_solver_batched_max_size && strideW >= n)
+        return hipblas_solver_syevj_batched<T>(handle,
+                                               evect,
+                                               uplo,
+                                               n,
+                                               nullptr,
+                                               lda,
+                                               0,
+                                               A,
+                                               abstol,
+                                               max_sweeps,
+                                               W,
+                                               strideW,
+                                               info,
+                                               batch_count);
+
+    // larger matrices are solved one at a time with their pointers copied to the host
+    hipblasHostPointers pointers;
+    hipblasStatus_t     status = pointers.copy(handle, batch_count, {A});
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return hipblas_solver_syevj<T>(handle,
+                                   evect,
+                                   uplo,
+                                   n,
+                                   lda,
+                                   abstol,
+                                   max_sweeps,
+                                   W,
+                                   strideW,
+                                   info,
+                                   batch_count,
+                                   [&](int b) { return pointers(A, b); });
+}
+
+template <typename T>
+hipblasStatus_t hipblasSolverSyevd(hipblasHandle_t           handle,
+                                   hipblasEvect_t            evect,
+                                   hipblasFillMode_t         uplo,
+                                   int                       n,
+                                   T*                        A,
+                                   int                       lda,
+                                   hipblas_solver_real_t<T>* D,
+                                   hipblas_solver_real_t<T>* E,
+                                   int*                      info)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!hipblas_solver_valid_evect(evect))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(!hipblas_solver_valid_fill(uplo) || n < 0 || lda < std::max(1, n))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(((A == nullptr || D == nullptr || E == nullptr) && n) || info == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(n == 0)
+        return hipblas_solver_zero_info(handle, info, 1);
+
+    const cusolverEigMode_t jobz = hipblas_solver_eig_mode(evect);
+    const cublasFillMode_t  fill = hipblas_solver_fill(uplo);
+
+    cusolverDnHandle_t solver;
+    void*              workspace;
+    hipStream_t        stream;
+    int                lwork = 0;
+
+    hipblasStatus_t status = hipblas_solver_begin(handle, 0, &solver, &workspace, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status
+            = hipblas_convert_status(hipblas_syevd_size(solver, jobz, fill, n, A, lda, D, &lwork));
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblas_solver_begin(handle, sizeof(T) * lwork, &solver, &workspace, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblas_convert_status(
+            hipblas_syevd(solver, jobz, fill, n, A, lda, D, (T*)workspace, lwork, info));
+    return status;
+}
+
+template <typename T>
+hipblasStatus_t hipblasSolverGesvdjStridedBatched(hipblasHandle_t           handle,
+                                                  hipblasSvect_t            left_svect,
+                                                  hipblasSvect_t            right_svect,
+                                                  int                       m,
+                                                  int                       n,
+                                                  T*                        A,
+                                                  int                       lda,
+                                                  hipblasStride             strideA,
+                                                  hipblas_solver_real_t<T>  abstol,
+                                                  hipblas_solver_real_t<T>* residual,
+                                                  int                       max_sweeps,
+                                                  int*                      n_sweeps,
+                                                  hipblas_solver_real_t<T>* S,
+                                                  hipblasStride             strideS,
+                                                  T*                        U,
+                                                  int                       ldu,
+                                                  hipblasStride             strideU,
+                                                  T*                        V,
+                                                  int                       ldv,
+                                                  hipblasStride             strideV,
+                                                  int*                      info,
+                                                  int                       batch_count)
+{
+    const bool left  = left_svect == HIPBLAS_SVECT_SINGULAR;
+    const bool right = right_svect == HIPBLAS_SVECT_SINGULAR;
+    const int  k     = std::min(m, n);
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!hipblas_solver_valid_svect(left_svect) || !hipblas_solver_valid_svect(right_svect))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(m < 0 || n < 0 || lda < std::max(1, m) || ldu < (left ? std::max(1, m) : 1)
+       || ldv < (right ? std::max(1, k) : 1) || max_sweeps <= 0 || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(((A == nullptr || S == nullptr || (left && U == nullptr) || (right && V == nullptr)) && k
+        && batch_count)
+       || ((residual == nullptr || n_sweeps == nullptr || info == nullptr) && batch_count))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(batch_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(k == 0)
+        return hipblas_solver_zero_info(handle, info, batch_count);
+
+    // the matrices and singular values that aren't contiguous are copied, unless they overlap
+    if(batch_count > 1 && m <= hipblas_solver_batched_max_size
+       && n <= hipblas_solver_batched_max_size && strideA >= hipblasStride(lda) * n
+       && strideS >= k)
+        return hipblas_solver_gesvdj_batched<T>(handle,
+                                                left_svect,
+                                                right_svect,
+                                                m,
+                                                n,
+                                                A,
+                                                lda,
+                                                strideA,
+                                                nullptr,
+                                                abstol,
+                                                max_sweeps,
+                                                S,
+                                                strideS,
+                                                U,
+                                                ldu,
+                                                strideU,
+                                                V,
+                                                ldv,
+                                                strideV,
+                                                info,
+                                                batch_count);
+
+    return hipblas_solver_gesvdj<T>(handle,
+                                    left_svect,
+                                    right_svect,
+                                    m,
+                                    n,
+                                    lda,
+                                    abstol,
+                                    max_sweeps,
+                                    S,
+                                    strideS,
+                                    U,
+                                    ldu,
+                                    strideU,
+                                    V,
+                                    ldv,
+                                    strideV,
+                                    info,
+                                    batch_count,
+                                    [&](int b) { return A + b * strideA; });
+}
+
+template <typename T>
+hipblasStatus_t hipblasSolverGesvdjBatched(hipblasHandle_t           handle,
+                                           hipblasSvect_t            left_svect,
+                                           hipblasSvect_t            right_svect,
+                                           int                       m,
+                                           int                       n,
+                                           T* const                  A[],
+                                           int                       lda,
+                                           hipblas_solver_real_t<T>  abstol,
+                                           hipblas_solver_real_t<T>* residual,
+                                           int                       max_sweeps,
+                                           int*                      n_sweeps,
+                                           hipblas_solver_real_t<T>* S,
+                                           hipblasStride             strideS,
+                                           T*                        U,
+                                           int                       ldu,
+                                           hipblasStride             strideU,
+                                           T*                        V,
+                                           int                       ldv,
+                                           hipblasStride             strideV,
+                                           int*                      info,
+                                           int                       batch_count)
+{
+    const bool left  = left_svect == HIPBLAS_SVECT_SINGULAR;
+    const bool right = right_svect == HIPBLAS_SVECT_SINGULAR;
+    const int  k     = std::min(m, n);
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!hipblas_solver_valid_svect(left_svect) || !hipblas_solver_valid_svect(right_svect))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(m < 0 || n < 0 || lda < std::max(1, m) || ldu < (left ? std::max(1, m) : 1)
+       || ldv < (right ? std::max(1, k) : 1) || max_sweeps <= 0 || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(((A == nullptr || S == nullptr || (left && U == nullptr) || (right && V == nullptr)) && k
+        && batch_count)
+       || ((residual == nullptr || n_sweeps == nullptr || info == nullptr) && batch_count))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(batch_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(k == 0)
+        return hipblas_solver_zero_info(handle, info, batch_count);
+
+    if(m <= hipblas_solver_batched_max_size && n <= hipblas_solver_batched_max_size
+       && strideS >= k)
+        return hipblas_solver_gesvdj_batched<T>(handle,
+                                                left_svect,
+                                                right_svect,
+                                                m,
+                                                n,
+                                                nullptr,
+                                                lda,
+                                                0,
+                                                A,
+                                                abstol,
+                                                max_sweeps,
+                                                S,
+                                                strideS,
+                                                U,
+                                                ldu,
+                                                strideU,
+                                                V,
+                                                ldv,
+                                                strideV,
+                                                info,
+                                                batch_count);
+
+    // larger matrices are solved one at a time with their pointers copied to the host
+    hipblasHostPointers pointers;
+    hipblasStatus_t     status = pointers.copy(handle, batch_count, {A});
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return hipblas_solver_gesvdj<T>(handle,
+                                    left_svect,
+                                    right_svect,
+                                    m,
+                                    n,
+                                    lda,
+                                    abstol,
+                                    max_sweeps,
+                                    S,
+                                    strideS,
+                                    U,
+                                    ldu,
+                                    strideU,
+                                    V,
+                                    ldv,
+                                    strideV,
+                                    info,
+                                    batch_count,
+                                    [&](int b) { return pointers(A, b); });
+}
+
+template <typename T>
+hipblasStatus_t hipblasSolverGesvStridedBatched(hipblasHandle_t handle,
+                                                int             n,
+                                                int             nrhs,
+                                                T*              A,
+                                                int             lda,
+                                                hipblasStride   strideA,
+                                                int*            ipiv,
+                                                hipblasStride   strideP,
+                                                T*              B,
+                                                int             ldb,
+                                                hipblasStride   strideB,
+                                                int*            info,
+                                                int             batch_count)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || nrhs < 0 || lda < std::max(1, n) || ldb < std::max(1, n) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(((A == nullptr || ipiv == nullptr) && n && batch_count)
+       || (B == nullptr && n * nrhs && batch_count) || (info == nullptr && batch_count))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(batch_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(n == 0)
+        return hipblas_solver_zero_info(handle, info, batch_count);
+
+    if(n <= hipblas_gesv_max_size)
+        return hipblas_solver_gesv<T>(handle,
+                                      n,
+                                      nrhs,
+                                      A,
+                                      nullptr,
+                                      lda,
+                                      strideA,
+                                      ipiv,
+                                      strideP,
+                                      B,
+                                      nullptr,
+                                      ldb,
+                                      strideB,
+                                      info,
+                                      batch_count);
+
+    // larger systems are factored by getrf and solved by getrs, with the arguments checked above
+    int             host_info = 0;
+    hipblasStatus_t status    = hipblasSolverGetrf<T, true>(
+        handle, n, A, lda, strideA, ipiv, strideP, info, batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSolverGetrs<T, true>(handle,
+                                             HIPBLAS_OP_N,
+                                             n,
+                                             nrhs,
+                                             A,
+                                             lda,
+                                             strideA,
+                                             ipiv,
+                                             strideP,
+                                             B,
+                                             ldb,
+                                             strideB,
+                                             &host_info,
+                                             batch_count);
+    return status;
+}
+
+template <typename T>
+hipblasStatus_t hipblasSolverGesvBatched(hipblasHandle_t handle,
+                                         int             n,
+                                         int             nrhs,
+                                         T* const        A[],
+                                         int             lda,
+                                         int*            ipiv,
+                                         T* const        B[],
+                                         int             ldb,
+                                         int*            info,
+                                         int             batch_count)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || nrhs < 0 || lda < std::max(1, n) || ldb < std::max(1, n) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(((A == nullptr || ipiv == nullptr) && n && batch_count)
+       || (B == nullptr && n * nrhs && batch_count) || (info == nullptr && batch_count))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(batch_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(n == 0)
+        return hipblas_solver_zero_info(handle, info, batch_count);
+
+    // the pivots of system b are at b * n, as with getrfBatched
+    if(n <= hipblas_gesv_max_size)
+        return hipblas_solver_gesv<T>(
+            handle, n, nrhs, nullptr, A, lda, 0, ipiv, n, nullptr, B, ldb, 0, info, batch_count);
+
+    // larger systems are factored and solved by the batched getrf and getrs of cuBLAS
+    int             host_info = 0;
+    hipblasStatus_t status    = hipblas_convert_status(
+        hipblas_getrf_batched((cublasHandle_t)handle, n, A, lda, ipiv, info, batch_count));
+    if(status == HIPBLAS_STATUS_SUCCESS && nrhs > 0)
+        status = hipblas_convert_status(hipblas_getrs_batched((cublasHandle_t)handle,
+                                                              CUBLAS_OP_N,
+                                                              n,
+                                                              nrhs,
+                                                              A,
+                                                              lda,
+                                                              ipiv,
+                                                              B,
+                                                              ldb,
+                                                              &host_info,
+                                                              batch_count));
+    return status;
+}
+
+void hipblasDestroySolverState(hipblasHandle_t handle)
+{
+    std::lock_guard<std::mutex> lock(solver_state_mutex());
+    solver_state_map().erase(handle);
+}
+
+#define INSTANTIATE_SOLVER(T_, STRIDED_)                                                  \
+    template hipblasStatus_t hipblasSolverGetrf<T_, STRIDED_>(hipblasHandle_t,            \
+                                                              int,                        \
+                                                              T_*,                        \
+                                                              int,                        \
+                                                              hipblasStride,              \
+                                                              int*,                       \
+                                                              hipblasStride,              \
+                                                              int*,                       \
+                                                              int);                       \
+    template hipblasStatus_t hipblasSolverGetrs<T_, STRIDED_>(hipblasHandle_t,            \
+                                                              hipblasOperation_t,         \
+                                                              int,                        \
+                                                              int,                        \
+                                                              T_*,                        \
+                                                              int,                        \
+                                                              hipblasStride,              \
+                                                              const int*,                 \
+                                                              hipblasStride,              \
+                                                              T_*,                        \
+                                                              int,                        \
+                                                              hipblasStride,              \
+                                                              int*,                       \
+                                                              int);                       \
+    template hipblasStatus_t hipblasSolverGeqrf<T_, STRIDED_>(hipblasHandle_t,            \
+                                                              int,                        \
+                                                              int,                        \
+                                                              T_*,                        \
+                                                              int,                        \
+                                                              hipblasStride,              \
+                                                              T_*,                        \
+                                                              hipblasStride,              \
+                                                              int*,                       \
+                                                              int);                       \
+    template hipblasStatus_t hipblasSolverGels<T_, STRIDED_>(hipblasHandle_t,             \
+                                                             hipblasOperation_t,          \
+                                                             int,                         \
+                                                             int,                         \
+                                                             int,                         \
+                                                             T_*,                         \
+                                                             int,                         \
+                                                             hipblasStride,               \
+                                                             T_*,                         \
+                                                             int,                         \
+                                                             hipblasStride,               \
+                                                             int*,                        \
+                                                             int*,                        \
+                                                             int);                        \
+    template hipblasStatus_t hipblasSolverPotrf<T_, STRIDED_>(hipblasHandle_t,            \
+                                                              hipblasFillMode_t,          \
+                                                              int,                        \
+                                                              T_*,                        \
+                                                              int,                        \
+                                                              hipblasStride,              \
+                                                              int*,                       \
+                                                              int);                       \
+    template hipblasStatus_t hipblasSolverPotrs<T_, STRIDED_>(hipblasHandle_t,            \
+                                                              hipblasFillMode_t,          \
+                                                              int,                        \
+                                                              int,                        \
+                                                              T_*,                        \
+                                                              int,                        \
+                                                              hipblasStride,              \
+                                                              T_*,                        \
+                                                              int,                        \
+                                                              hipblasStride,              \
+                                                              int*,                       \
+                                                              int);                       \
+    template hipblasStatus_t hipblasSolverPotri<T_, STRIDED_>(hipblasHandle_t,            \
+                                                              hipblasFillMode_t,          \
+                                                              int,                        \
+                                                              T_*,                        \
+                                                              int,                        \
+                                                              hipblasStride,              \
+                                                              int*,                       \
+                                                              int);                       \
+    template hipblasStatus_t hipblasSolverSyevj<T_, STRIDED_>(hipblasHandle_t,            \
+                                                              hipblasEvect_t,             \
+                                                              hipblasFillMode_t,          \
+                                                              int,                        \
+                                                              T_*,                        \
+                                                              int,                        \
+                                                              hipblasStride,              \
+                                                              hipblas_solver_real_t<T_>,  \
+                                                              hipblas_solver_real_t<T_>*, \
+                                                              int,                        \
+                                                              int*,                       \
+                                                              hipblas_solver_real_t<T_>*, \
+                                                              hipblasStride,              \
+                                                              int*,                       \
+                                                              int);
+
+#define INSTANTIATE_SOLVER_BATCHED(T_)                                                         \
+    template hipblasStatus_t hipblasSolverGeqrfBatchedStridedTau<T_>(                          \
+        hipblasHandle_t, int, int, T_* const[], int, T_*, hipblasStride, int*, int);           \
+    template hipblasStatus_t hipblasSolverPotrfBatched<T_>(                                    \
+        hipblasHandle_t, hipblasFillMode_t, int, T_* const[], int, int*, int);                 \
+    template hipblasStatus_t hipblasSolverPotrsBatched<T_>(hipblasHandle_t,                    \
+                                                           hipblasFillMode_t,                  \
+                                                           int,                                \
+                                                           int,                                \
+                                                           T_* const[],                        \
+                                                           int,                                \
+                                                           T_* const[],                        \
+                                                           int,                                \
+                                                           int*,                               \
+                                                           int);                               \
+    template hipblasStatus_t hipblasSolverPotriBatched<T_>(                                    \
+        hipblasHandle_t, hipblasFillMode_t, int, T_* const[], int, int*, int);                 \
+    template hipblasStatus_t hipblasSolverSyevjBatched<T_>(hipblasHandle_t,                    \
+                                                           hipblasEvect_t,                     \
+                                                           hipblasFillMode_t,                  \
+                                                           int,                                \
+                                                           T_* const[],                        \
+                                                           int,                                \
+                                                           hipblas_solver_real_t<T_>,          \
+                                                           hipblas_solver_real_t<T_>*,         \
+                                                           int,                                \
+                                                           int*,                               \
+                                                           hipblas_solver_real_t<T_>*,         \
+                                                           hipblasStride,                      \
+                                                           int*,                               \
+                                                           int);                               \
+    template hipblasStatus_t hipblasSolverSyevd<T_>(hipblasHandle_t,                           \
+                                                    hipblasEvect_t,                            \
+                                                    hipblasFillMode_t,                         \
+                                                    int,                                       \
+                                                    T_*,                                       \
+                                                    int,                                       \
+                                                    hipblas_solver_real_t<T_>*,                \
+                                                    hipblas_solver_real_t<T_>*,                \
+                                                    int*);                                     \
+    template hipblasStatus_t hipblasSolverGesvdjStridedBatched<T_>(hipblasHandle_t,            \
+                                                                   hipblasSvect_t,             \
+                                                                   hipblasSvect_t,             \
+                                                                   int,                        \
+                                                                   int,                        \
+                                                                   T_*,                        \
+                                                                   int,                        \
+                                                                   hipblasStride,              \
+                                                                   hipblas_solver_real_t<T_>,  \
+                                                                   hipblas_solver_real_t<T_>*, \
+                                                                   int,                        \
+                                                                   int*,                       \
+                                                                   hipblas_solver_real_t<T_>*, \
+                                                                   hipblasStride,              \
+                                                                   T_*,                        \
+                                                                   int,                        \
+                                                                   hipblasStride,              \
+                                                                   T_*,                        \
+                                                                   int,                        \
+                                                                   hipblasStride,              \
+                                                                   int*,                       \
+                                                                   int);                       \
+    template hipblasStatus_t hipblasSolverGesvdjBatched<T_>(hipblasHandle_t,                   \
+                                                            hipblasSvect_t,                    \
+                                                            hipblasSvect_t,                    \
+                                                            int,                               \
+                                                            int,                               \
+                                                            T_* const[],                       \
+                                                            int,                               \
+                                                            hipblas_solver_real_t<T_>,         \
+                                                            hipblas_solver_real_t<T_>*,        \
+                                                            int,                               \
+                                                            int*,                              \
+                                                            hipblas_solver_real_t<T_>*,        \
+                                                            hipblasStride,                     \
+                                                            T_*,                               \
+                                                            int,                               \
+                                                            hipblasStride,                     \
+                                                            T_*,                               \
+                                                            int,                               \
+                                                            hipblasStride,                     \
+                                                            int*,                              \
+                                                            int);                              \
+    template hipblasStatus_t hipblasSolverGesvStridedBatched<T_>(hipblasHandle_t,              \
+                                                                 int,                          \
+                                                                 int,                          \
+                                                                 T_*,                          \
+                                                                 int,                          \
+                                                                 hipblasStride,                \
+                                                                 int*,                         \
+                                                                 hipblasStride,                \
+                                                                 T_*,                          \
+                                                                 int,                          \
+                                                                 hipblasStride,                \
+                                                                 int*,                         \
+                                                                 int);                         \
+    template hipblasStatus_t hipblasSolverGesvBatched<T_>(                                     \
+        hipblasHandle_t, int, int, T_* const[], int, int*, T_* const[], int, int*, int);
+
+#define INSTANTIATE_SOLVER_TYPES(STRIDED_)        \
+    INSTANTIATE_SOLVER(float, STRIDED_)           \
+    INSTANTIATE_SOLVER(double, STRIDED_)          \
+    INSTANTIATE_SOLVER(hipFloatComplex, STRIDED_) \
+    INSTANTIATE_SOLVER(hipDoubleComplex, STRIDED_)
+
+INSTANTIATE_SOLVER_TYPES(false)
+INSTANTIATE_SOLVER_TYPES(true)
+
+INSTANTIATE_SOLVER_BATCHED(float)
+INSTANTIATE_SOLVER_BATCHED(double)
+INSTANTIATE_SOLVER_BATCHED(hipFloatComplex)
+INSTANTIATE_SOLVER_BATCHED(hipDoubleComplex)
+
+#undef INSTANTIATE_SOLVER_TYPES
+#undef INSTANTIATE_SOLVER_BATCHED
+#undef INSTANTIATE_SOLVER
@@ -0,0 +1,353 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "hipblas.h"
+
+// The real type of the eigenvalues of T
+template <typename T>
+struct hipblas_solver_real
+{
+    using type = T;
+};
+
+template <>
+struct hipblas_solver_real<hipFloatComplex>
+{
+    using type = float;
+};
+
+template <>
+struct hipblas_solver_real<hipDoubleComplex>
+{
+    using type = double;
+};
+
+template <typename T>
+using hipblas_solver_real_t = typename hipblas_solver_real<T>::type;
+
+// The non-batched and strided batched solver functions of the cuBLAS backend, computed by
+// cuSOLVER when hipBLAS is built with BUILD_WITH_SOLVER. cuBLAS only has solvers for arrays of
+// pointers, which are meant for batches of small problems. The Cholesky functions, which cuBLAS
+// doesn't have, also have their batched variants here.
+//
+// Each hipBLAS handle gets a cuSOLVER handle and a device workspace on first use, which are kept
+// until hipblasDestroy. The workspace grows to the largest problem solved with the handle, and
+// growing it while the stream of the handle is being captured returns
+// HIPBLAS_STATUS_NOT_SUPPORTED. The problems of a strided batch are solved one after the other
+// on the stream of the handle, except for strided batches of small getrf, geqrf, potrf and
+// potrs problems, which are solved in one call by the batched solvers of cuBLAS and cuSOLVER.
+// Their arrays of pointers are computed on the device into a buffer kept with the workspace, so
+// that the call doesn't allocate or copy from the host.
+//
+// T is float, double, hipComplex or hipDoubleComplex. info is checked and written as on the
+// rocSOLVER backend, with the argument numbers of the strided batched functions if STRIDED; it
+// is a host pointer except for getrf, potrf, potri, the eigensolvers and gesvdj, whose info is
+// one device int per problem.
+
+// A = P * L * U, without pivoting if ipiv is nullptr
+template <typename T, bool STRIDED>
+hipblasStatus_t hipblasSolverGetrf(hipblasHandle_t handle,
+                                   int             n,
+                                   T*              A,
+                                   int             lda,
+                                   hipblasStride   strideA,
+                                   int*            ipiv,
+                                   hipblasStride   strideP,
+                                   int*            info,
+                                   int             batch_count);
+
+// Solves op(A) * X = B with the factorization of hipblasSolverGetrf
+template <typename T, bool STRIDED>
+hipblasStatus_t hipblasSolverGetrs(hipblasHandle_t    handle,
+                                   hipblasOperation_t trans,
+                                   int                n,
+                                   int                nrhs,
+                                   T*                 A,
+                                   int                lda,
+                                   hipblasStride      strideA,
+                                   const int*         ipiv,
+                                   hipblasStride      strideP,
+                                   T*                 B,
+                                   int                ldb,
+                                   hipblasStride      strideB,
+                                   int*               info,
+                                   int                batch_count);
+
+// A = Q * R, with the Householder scalars of Q in tau
+template <typename T, bool STRIDED>
+hipblasStatus_t hipblasSolverGeqrf(hipblasHandle_t handle,
+                                   int             m,
+                                   int             n,
+                                   T*              A,
+                                   int             lda,
+                                   hipblasStride   strideA,
+                                   T*              tau,
+                                   hipblasStride   strideT,
+                                   int*            info,
+                                   int             batch_count);
+
+// hipblasSolverGeqrf for an array of pointers to the matrices, with the Householder scalars in a
+// strided array. The array of pointers to tau is computed on the device into the batch buffer.
+template <typename T>
+hipblasStatus_t hipblasSolverGeqrfBatchedStridedTau(hipblasHandle_t handle,
+                                                    int             m,
+                                                    int             n,
+                                                    T* const        A[],
+                                                    int             lda,
+                                                    T*              tau,
+                                                    hipblasStride   strideT,
+                                                    int*            info,
+                                                    int             batch_count);
+
+// Least squares solutions of op(A) * X = B for m >= n through a QR factorization of A.
+// deviceInfo is one device int per problem, set to i if R(i, i) is zero. Underdetermined
+// problems, m < n, return HIPBLAS_STATUS_NOT_SUPPORTED.
+template <typename T, bool STRIDED>
+hipblasStatus_t hipblasSolverGels(hipblasHandle_t    handle,
+                                  hipblasOperation_t trans,
+                                  int                m,
+                                  int                n,
+                                  int                nrhs,
+                                  T*                 A,
+                                  int                lda,
+                                  hipblasStride      strideA,
+                                  T*                 B,
+                                  int                ldb,
+                                  hipblasStride      strideB,
+                                  int*               info,
+                                  int*               deviceInfo,
+                                  int                batch_count);
+
+// A = L * L^H or U^H * U for Hermitian positive definite A, with the factor in the uplo
+// triangle of A. info is set to i if the leading minor of order i is not positive definite.
+template <typename T, bool STRIDED>
+hipblasStatus_t hipblasSolverPotrf(hipblasHandle_t   handle,
+                                   hipblasFillMode_t uplo,
+                                   int               n,
+                                   T*                A,
+                                   int               lda,
+                                   hipblasStride     strideA,
+                                   int*              info,
+                                   int               batch_count);
+
+template <typename T>
+hipblasStatus_t hipblasSolverPotrfBatched(hipblasHandle_t   handle,
+                                          hipblasFillMode_t uplo,
+                                          int               n,
+                                          T* const          A[],
+                                          int               lda,
+                                          int*              info,
+                                          int               batch_count);
+
+// Solves A * X = B with the factorization of hipblasSolverPotrf
+template <typename T, bool STRIDED>
+hipblasStatus_t hipblasSolverPotrs(hipblasHandle_t   handle,
+                                   hipblasFillMode_t uplo,
+                                   int               n,
+                                   int               nrhs,
+                                   T*                A,
+                                   int               lda,
+                                   hipblasStride     strideA,
+                                   T*                B,
+                                   int               ldb,
+                                   hipblasStride     strideB,
+                                   int*              info,
+                                   int               batch_count);
+
+template <typename T>
+hipblasStatus_t hipblasSolverPotrsBatched(hipblasHandle_t   handle,
+                                          hipblasFillMode_t uplo,
+                                          int               n,
+                                          int               nrhs,
+                                          T* const          A[],
+                                          int               lda,
+                                          T* const          B[],
+                                          int               ldb,
+                                          int*              info,
+                                          int               batch_count);
+
+// A := A^-1 from the factorization of hipblasSolverPotrf. info is set to i if the factor has a
+// zero at (i, i). The batched variant copies the array of pointers to the host, so it can't be
+// captured.
+template <typename T, bool STRIDED>
+hipblasStatus_t hipblasSolverPotri(hipblasHandle_t   handle,
+                                   hipblasFillMode_t uplo,
+                                   int               n,
+                                   T*                A,
+                                   int               lda,
+                                   hipblasStride     strideA,
+                                   int*              info,
+                                   int               batch_count);
+
+template <typename T>
+hipblasStatus_t hipblasSolverPotriBatched(hipblasHandle_t   handle,
+                                          hipblasFillMode_t uplo,
+                                          int               n,
+                                          T* const          A[],
+                                          int               lda,
+                                          int*              info,
+                                          int               batch_count);
+
+// The eigenvalues W of Hermitian A in increasing order, and its eigenvectors in A if evect is
+// HIPBLAS_EVECT_ORIGINAL, by the Jacobi method of cuSOLVER. abstol is relative to the Frobenius
+// norm of A, and info is set to n + 1 if the method doesn't converge in max_sweeps sweeps.
+// residual and n_sweeps are checked but not written, as cuSOLVER only returns them to the host
+// and for one matrix at a time. Batches of small matrices are solved in one call by the batched
+// Jacobi solver of cuSOLVER, which takes contiguous matrices and eigenvalues, so the others are
+// copied to and from the workspace.
+template <typename T, bool STRIDED>
+hipblasStatus_t hipblasSolverSyevj(hipblasHandle_t           handle,
+                                   hipblasEvect_t            evect,
+                                   hipblasFillMode_t         uplo,
+                                   int                       n,
+                                   T*                        A,
+                                   int                       lda,
+                                   hipblasStride             strideA,
+                                   hipblas_solver_real_t<T>  abstol,
+                                   hipblas_solver_real_t<T>* residual,
+                                   int                       max_sweeps,
+                                   int*                      n_sweeps,
+                                   hipblas_solver_real_t<T>* W,
+                                   hipblasStride             strideW,
+                                   int*                      info,
+                                   int                       batch_count);
+
+template <typename T>
+hipblasStatus_t hipblasSolverSyevjBatched(hipblasHandle_t           handle,
+                                          hipblasEvect_t            evect,
+                                          hipblasFillMode_t         uplo,
+                                          int                       n,
+                                          T* const                  A[],
+                                          int                       lda,
+                                          hipblas_solver_real_t<T>  abstol,
+                                          hipblas_solver_real_t<T>* residual,
+                                          int                       max_sweeps,
+                                          int*                      n_sweeps,
+                                          hipblas_solver_real_t<T>* W,
+                                          hipblasStride             strideW,
+                                          int*                      info,
+                                          int                       batch_count);
+
+// The eigenvalues D of Hermitian A in increasing order, and its eigenvectors in A if evect is
+// HIPBLAS_EVECT_ORIGINAL, by the divide and conquer method of cuSOLVER. E is the workspace of
+// rocSOLVER, which is checked but not used.
+template <typename T>
+hipblasStatus_t hipblasSolverSyevd(hipblasHandle_t           handle,
+                                   hipblasEvect_t            evect,
+                                   hipblasFillMode_t         uplo,
+                                   int                       n,
+                                   T*                        A,
+                                   int                       lda,
+                                   hipblas_solver_real_t<T>* D,
+                                   hipblas_solver_real_t<T>* E,
+                                   int*                      info);
+
+// The singular values S of A in decreasing order, and its first min(m, n) left and right singular
+// vectors in the columns of U and the rows of V if left_svect and right_svect are
+// HIPBLAS_SVECT_SINGULAR, by the Jacobi method of cuSOLVER. cuSOLVER computes both or none of the
+// singular vectors and returns the right ones as the columns of V, so they are computed into the
+// workspace and copied to U and V. info, residual and n_sweeps are as for hipblasSolverSyevj,
+// with info set to min(m, n) + 1. Batches of small matrices are solved in one call by the batched
+// Jacobi solver of cuSOLVER, and the large matrices of the batched variant are solved from an
+// array of pointers copied to the host.
+template <typename T>
+hipblasStatus_t hipblasSolverGesvdjStridedBatched(hipblasHandle_t           handle,
+                                                  hipblasSvect_t            left_svect,
+                                                  hipblasSvect_t            right_svect,
+                                                  int                       m,
+                                                  int                       n,
+                                                  T*                        A,
+                                                  int                       lda,
+                                                  hipblasStride             strideA,
+                                                  hipblas_solver_real_t<T>  abstol,
+                                                  hipblas_solver_real_t<T>* residual,
+                                                  int                       max_sweeps,
+                                                  int*                      n_sweeps,
+                                                  hipblas_solver_real_t<T>* S,
+                                                  hipblasStride             strideS,
+                                                  T*                        U,
+                                                  int                       ldu,
+                                                  hipblasStride             strideU,
+                                                  T*                        V,
+                                                  int                       ldv,
+                                                  hipblasStride             strideV,
+                                                  int*                      info,
+                                                  int                       batch_count);
+
+template <typename T>
+hipblasStatus_t hipblasSolverGesvdjBatched(hipblasHandle_t           handle,
+                                           hipblasSvect_t            left_svect,
+                                           hipblasSvect_t            right_svect,
+                                           int                       m,
+                                           int                       n,
+                                           T* const                  A[],
+                                           int                       lda,
+                                           hipblas_solver_real_t<T>  abstol,
+                                           hipblas_solver_real_t<T>* residual,
+                                           int                       max_sweeps,
+                                           int*                      n_sweeps,
+                                           hipblas_solver_real_t<T>* S,
+                                           hipblasStride             strideS,
+                                           T*                        U,
+                                           int                       ldu,
+                                           hipblasStride             strideU,
+                                           T*                        V,
+                                           int                       ldv,
+                                           hipblasStride             strideV,
+                                           int*                      info,
+                                           int                       batch_count);
+
+// The solutions X of A * X = B for a batch of systems, with the LU factors of A and their pivots
+// returned in A and ipiv as for hipblasSolverGetrf. info is the device info of the factorization,
+// and B is unspecified for a singular A. Systems with n <= 32 are factored and solved by one
+// hipBLAS kernel that keeps A in shared memory, and larger ones by getrf and getrs.
+template <typename T>
+hipblasStatus_t hipblasSolverGesvStridedBatched(hipblasHandle_t handle,
+                                                int             n,
+                                                int             nrhs,
+                                                T*              A,
+                                                int             lda,
+                                                hipblasStride   strideA,
+                                                int*            ipiv,
+                                                hipblasStride   strideP,
+                                                T*              B,
+                                                int             ldb,
+                                                hipblasStride   strideB,
+                                                int*            info,
+                                                int             batch_count);
+
+template <typename T>
+hipblasStatus_t hipblasSolverGesvBatched(hipblasHandle_t handle,
+                                         int             n,
+                                         int             nrhs,
+                                         T* const        A[],
+                                         int             lda,
+                                         int*            ipiv,
+                                         T* const        B[],
+                                         int             ldb,
+                                         int*            info,
+                                         int             batch_count);
+
+// Destroys the cuSOLVER handle and the workspace of handle. Called from hipblasDestroy.
+void hipblasDestroySolverState(hipblasHandle_t handle);
@@ -0,0 +1,5881 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas_internal.hpp"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef __HIP_PLATFORM_SOLVER__
+
+// cuBLAS, and hipblas_solver.hpp for the functions computed by cuSOLVER, write the result of
+// the solver argument checks through a host info pointer. In HIPBLAS_INFO_MODE_DEVICE info is a
+// device pointer instead, so they write to a local value that store() then copies to info on the
+// handle's stream.
+class hipblasSolverInfo
+{
+    cublasHandle_t m_handle;
+    int*           m_device_info = nullptr;
+    int            m_value       = 0;
+
+public:
+    hipblasSolverInfo(cublasHandle_t handle, int*& info)
+        : m_handle(handle)
+    {
+        if(info && hipblasIsDeviceInfoMode(hipblasHandle_t(handle)))
+        {
+            m_device_info = info;
+            info          = &m_value;
+        }
+    }
+
+    // Returns status, or the status of the copy to the device info if status is a success
+    hipblasStatus_t store(hipblasStatus_t status) const
+    {
+        if(!m_device_info)
+            return status;
+
+        cudaStream_t stream;
+        if(cublasGetStream(m_handle, &stream) != CUBLAS_STATUS_SUCCESS)
+            return status == HIPBLAS_STATUS_SUCCESS ? HIPBLAS_STATUS_INTERNAL_ERROR : status;
+
+        // the copy from pageable memory is staged before cudaMemcpyAsync returns
+        cudaError_t err = m_value ? cudaMemcpyAsync(m_device_info,
+                                                    &m_value,
+                                                    sizeof(int),
+                                                    cudaMemcpyHostToDevice,
+                                                    stream)
+                                  : cudaMemsetAsync(m_device_info, 0, sizeof(int), stream);
+        if(err != cudaSuccess && status == HIPBLAS_STATUS_SUCCESS)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        return status;
+    }
+};
+
+// getrf
+hipblasStatus_t hipblasSgetrf(
+    hipblasHandle_t handle, const int n, float* A, const int lda, int* ipiv, int* info)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda);
+
+    return hipblasSolverGetrf<float, false>(handle, n, A, lda, 0, ipiv, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgetrf(
+    hipblasHandle_t handle, const int n, double* A, const int lda, int* ipiv, int* info)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda);
+
+    return hipblasSolverGetrf<double, false>(handle, n, A, lda, 0, ipiv, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrf(
+    hipblasHandle_t handle, const int n, hipblasComplex* A, const int lda, int* ipiv, int* info)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda);
+
+    return hipblasSolverGetrf<hipComplex, false>(
+        handle, n, (hipComplex*)A, lda, 0, ipiv, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrf(hipblasHandle_t       handle,
+                              const int             n,
+                              hipblasDoubleComplex* A,
+                              const int             lda,
+                              int*                  ipiv,
+                              int*                  info)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda);
+
+    return hipblasSolverGetrf<hipDoubleComplex, false>(handle,
+                                                       n,
+                                                       (hipDoubleComplex*)A,
+                                                       lda,
+                                                       0,
+                                                       ipiv,
+                                                       0,
+                                                       info,
+                                                       1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrf_v2(
+    hipblasHandle_t handle, const int n, hipComplex* A, const int lda, int* ipiv, int* info)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda);
+
+    return hipblasSolverGetrf<hipComplex, false>(handle, n, A, lda, 0, ipiv, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrf_v2(
+    hipblasHandle_t handle, const int n, hipDoubleComplex* A, const int lda, int* ipiv, int* info)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda);
+
+    return hipblasSolverGetrf<hipDoubleComplex, false>(handle, n, A, lda, 0, ipiv, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// getrf_batched
+hipblasStatus_t hipblasSgetrfBatched(hipblasHandle_t handle,
+                                     const int       n,
+                                     float* const    A[],
+                                     const int       lda,
+                                     int*            ipiv,
+                                     int*            info,
+                                     const int       batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, batch_count);
+    return hipblasConvertStatus(
+        cublasSgetrfBatched((cublasHandle_t)handle, n, A, lda, ipiv, info, batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgetrfBatched(hipblasHandle_t handle,
+                                     const int       n,
+                                     double* const   A[],
+                                     const int       lda,
+                                     int*            ipiv,
+                                     int*            info,
+                                     const int       batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, batch_count);
+    return hipblasConvertStatus(
+        cublasDgetrfBatched((cublasHandle_t)handle, n, A, lda, ipiv, info, batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrfBatched(hipblasHandle_t       handle,
+                                     const int             n,
+                                     hipblasComplex* const A[],
+                                     const int             lda,
+                                     int*                  ipiv,
+                                     int*                  info,
+                                     const int             batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, batch_count);
+    return hipblasConvertStatus(cublasCgetrfBatched(
+        (cublasHandle_t)handle, n, (cuComplex**)A, lda, ipiv, info, batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrfBatched(hipblasHandle_t             handle,
+                                     const int                   n,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     int*                        ipiv,
+                                     int*                        info,
+                                     const int                   batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, batch_count);
+    return hipblasConvertStatus(cublasZgetrfBatched(
+        (cublasHandle_t)handle, n, (cuDoubleComplex**)A, lda, ipiv, info, batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrfBatched_v2(hipblasHandle_t   handle,
+                                        const int         n,
+                                        hipComplex* const A[],
+                                        const int         lda,
+                                        int*              ipiv,
+                                        int*              info,
+                                        const int         batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, batch_count);
+    return hipblasConvertStatus(cublasCgetrfBatched(
+        (cublasHandle_t)handle, n, (cuComplex**)A, lda, ipiv, info, batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrfBatched_v2(hipblasHandle_t         handle,
+                                        const int               n,
+                                        hipDoubleComplex* const A[],
+                                        const int               lda,
+                                        int*                    ipiv,
+                                        int*                    info,
+                                        const int               batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, batch_count);
+    return hipblasConvertStatus(cublasZgetrfBatched(
+        (cublasHandle_t)handle, n, (cuDoubleComplex**)A, lda, ipiv, info, batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// getrf_strided_batched
+hipblasStatus_t hipblasSgetrfStridedBatched(hipblasHandle_t     handle,
+                                            const int           n,
+                                            float*              A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            int*                ipiv,
+                                            const hipblasStride strideP,
+                                            int*                info,
+                                            const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, strideA, strideP, batch_count);
+
+    if(hipblasIsInterleavedBatch(handle))
+        return hipblasInterleavedGetrf(
+            handle, n, A, HIP_R_32F, lda, strideA, ipiv, strideP, info, batch_count);
+
+    return hipblasSolverGetrf<float, true>(handle,
+                                           n,
+                                           A,
+                                           lda,
+                                           strideA,
+                                           ipiv,
+                                           strideP,
+                                           info,
+                                           batch_count);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgetrfStridedBatched(hipblasHandle_t     handle,
+                                            const int           n,
+                                            double*             A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            int*                ipiv,
+                                            const hipblasStride strideP,
+                                            int*                info,
+                                            const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, strideA, strideP, batch_count);
+
+    if(hipblasIsInterleavedBatch(handle))
+        return hipblasInterleavedGetrf(
+            handle, n, A, HIP_R_64F, lda, strideA, ipiv, strideP, info, batch_count);
+
+    return hipblasSolverGetrf<double, true>(handle,
+                                            n,
+                                            A,
+                                            lda,
+                                            strideA,
+                                            ipiv,
+                                            strideP,
+                                            info,
+                                            batch_count);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrfStridedBatched(hipblasHandle_t     handle,
+                                            const int           n,
+                                            hipblasComplex*     A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            int*                ipiv,
+                                            const hipblasStride strideP,
+                                            int*                info,
+                                            const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, strideA, strideP, batch_count);
+
+    if(hipblasIsInterleavedBatch(handle))
+        return hipblasInterleavedGetrf(
+            handle, n, A, HIP_C_32F, lda, strideA, ipiv, strideP, info, batch_count);
+
+    return hipblasSolverGetrf<hipComplex, true>(handle,
+                                                n,
+                                                (hipComplex*)A,
+                                                lda,
+                                                strideA,
+                                                ipiv,
+                                                strideP,
+                                                info,
+                                                batch_count);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrfStridedBatched(hipblasHandle_t       handle,
+                                            const int             n,
+                                            hipblasDoubleComplex* A,
+                                            const int             lda,
+                                            const hipblasStride   strideA,
+                                            int*                  ipiv,
+                                            const hipblasStride   strideP,
+                                            int*                  info,
+                                            const int             batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, strideA, strideP, batch_count);
+
+    if(hipblasIsInterleavedBatch(handle))
+        return hipblasInterleavedGetrf(
+            handle, n, A, HIP_C_64F, lda, strideA, ipiv, strideP, info, batch_count);
+
+    return hipblasSolverGetrf<hipDoubleComplex, true>(handle,
+                                                      n,
+                                                      (hipDoubleComplex*)A,
+                                                      lda,
+                                                      strideA,
+                                                      ipiv,
+                                                      strideP,
+                                                      info,
+                                                      batch_count);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrfStridedBatched_v2(hipblasHandle_t     handle,
+                                               const int           n,
+                                               hipComplex*         A,
+                                               const int           lda,
+                                               const hipblasStride strideA,
+                                               int*                ipiv,
+                                               const hipblasStride strideP,
+                                               int*                info,
+                                               const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, strideA, strideP, batch_count);
+
+    if(hipblasIsInterleavedBatch(handle))
+        return hipblasInterleavedGetrf(
+            handle, n, A, HIP_C_32F, lda, strideA, ipiv, strideP, info, batch_count);
+
+    return hipblasSolverGetrf<hipComplex, true>(handle,
+                                                n,
+                                                A,
+                                                lda,
+                                                strideA,
+                                                ipiv,
+                                                strideP,
+                                                info,
+                                                batch_count);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrfStridedBatched_v2(hipblasHandle_t     handle,
+                                               const int           n,
+                                               hipDoubleComplex*   A,
+                                               const int           lda,
+                                               const hipblasStride strideA,
+                                               int*                ipiv,
+                                               const hipblasStride strideP,
+                                               int*                info,
+                                               const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, strideA, strideP, batch_count);
+
+    if(hipblasIsInterleavedBatch(handle))
+        return hipblasInterleavedGetrf(
+            handle, n, A, HIP_C_64F, lda, strideA, ipiv, strideP, info, batch_count);
+
+    return hipblasSolverGetrf<hipDoubleComplex, true>(handle,
+                                                      n,
+                                                      A,
+                                                      lda,
+                                                      strideA,
+                                                      ipiv,
+                                                      strideP,
+                                                      info,
+                                                      batch_count);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// getrs
+hipblasStatus_t hipblasSgetrs(hipblasHandle_t          handle,
+                              const hipblasOperation_t trans,
+                              const int                n,
+                              const int                nrhs,
+                              float*                   A,
+                              const int                lda,
+                              const int*               ipiv,
+                              float*                   B,
+                              const int                ldb,
+                              int*                     info)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGetrs<float, false>(handle,
+                                                              trans,
+                                                              n,
+                                                              nrhs,
+                                                              A,
+                                                              lda,
+                                                              0,
+                                                              ipiv,
+                                                              0,
+                                                              B,
+                                                              ldb,
+                                                              0,
+                                                              info,
+                                                              1));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgetrs(hipblasHandle_t          handle,
+                              const hipblasOperation_t trans,
+                              const int                n,
+                              const int                nrhs,
+                              double*                  A,
+                              const int                lda,
+                              const int*               ipiv,
+                              double*                  B,
+                              const int                ldb,
+                              int*                     info)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGetrs<double, false>(handle,
+                                                               trans,
+                                                               n,
+                                                               nrhs,
+                                                               A,
+                                                               lda,
+                                                               0,
+                                                               ipiv,
+                                                               0,
+                                                               B,
+                                                               ldb,
+                                                               0,
+                                                               info,
+                                                               1));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrs(hipblasHandle_t          handle,
+                              const hipblasOperation_t trans,
+                              const int                n,
+                              const int                nrhs,
+                              hipblasComplex*          A,
+                              const int                lda,
+                              const int*               ipiv,
+                              hipblasComplex*          B,
+                              const int                ldb,
+                              int*                     info)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGetrs<hipComplex, false>(handle,
+                                                                   trans,
+                                                                   n,
+                                                                   nrhs,
+                                                                   (hipComplex*)A,
+                                                                   lda,
+                                                                   0,
+                                                                   ipiv,
+                                                                   0,
+                                                                   (hipComplex*)B,
+                                                                   ldb,
+                                                                   0,
+                                                                   info,
+                                                                   1));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrs(hipblasHandle_t          handle,
+                              const hipblasOperation_t trans,
+                              const int                n,
+                              const int                nrhs,
+                              hipblasDoubleComplex*    A,
+                              const int                lda,
+                              const int*               ipiv,
+                              hipblasDoubleComplex*    B,
+                              const int                ldb,
+                              int*                     info)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGetrs<hipDoubleComplex, false>(handle,
+                                                                         trans,
+                                                                         n,
+                                                                         nrhs,
+                                                                         (hipDoubleComplex*)A,
+                                                                         lda,
+                                                                         0,
+                                                                         ipiv,
+                                                                         0,
+                                                                         (hipDoubleComplex*)B,
+                                                                         ldb,
+                                                                         0,
+                                                                         info,
+                                                                         1));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrs_v2(hipblasHandle_t          handle,
+                                 const hipblasOperation_t trans,
+                                 const int                n,
+                                 const int                nrhs,
+                                 hipComplex*              A,
+                                 const int                lda,
+                                 const int*               ipiv,
+                                 hipComplex*              B,
+                                 const int                ldb,
+                                 int*                     info)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGetrs<hipComplex, false>(handle,
+                                                                   trans,
+                                                                   n,
+                                                                   nrhs,
+                                                                   A,
+                                                                   lda,
+                                                                   0,
+                                                                   ipiv,
+                                                                   0,
+                                                                   B,
+                                                                   ldb,
+                                                                   0,
+                                                                   info,
+                                                                   1));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrs_v2(hipblasHandle_t          handle,
+                                 const hipblasOperation_t trans,
+                                 const int                n,
+                                 const int                nrhs,
+                                 hipDoubleComplex*        A,
+                                 const int                lda,
+                                 const int*               ipiv,
+                                 hipDoubleComplex*        B,
+                                 const int                ldb,
+                                 int*                     info)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGetrs<hipDoubleComplex, false>(handle,
+                                                                         trans,
+                                                                         n,
+                                                                         nrhs,
+                                                                         A,
+                                                                         lda,
+                                                                         0,
+                                                                         ipiv,
+                                                                         0,
+                                                                         B,
+                                                                         ldb,
+                                                                         0,
+                                                                         info,
+                                                                         1));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// getrs_batched
+hipblasStatus_t hipblasSgetrsBatched(hipblasHandle_t          handle,
+                                     const hipblasOperation_t trans,
+                                     const int                n,
+                                     const int                nrhs,
+                                     float* const             A[],
+                                     const int                lda,
+                                     const int*               ipiv,
+                                     float* const             B[],
+                                     const int                ldb,
+                                     int*                     info,
+                                     const int                batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, ldb, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(
+        hipblasConvertStatus(cublasSgetrsBatched((cublasHandle_t)handle,
+                                                 hipblasConvertOperation(trans),
+                                                 n,
+                                                 nrhs,
+                                                 A,
+                                                 lda,
+                                                 ipiv,
+                                                 B,
+                                                 ldb,
+                                                 info,
+                                                 batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgetrsBatched(hipblasHandle_t          handle,
+                                     const hipblasOperation_t trans,
+                                     const int                n,
+                                     const int                nrhs,
+                                     double* const            A[],
+                                     const int                lda,
+                                     const int*               ipiv,
+                                     double* const            B[],
+                                     const int                ldb,
+                                     int*                     info,
+                                     const int                batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, ldb, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(
+        hipblasConvertStatus(cublasDgetrsBatched((cublasHandle_t)handle,
+                                                 hipblasConvertOperation(trans),
+                                                 n,
+                                                 nrhs,
+                                                 A,
+                                                 lda,
+                                                 ipiv,
+                                                 B,
+                                                 ldb,
+                                                 info,
+                                                 batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrsBatched(hipblasHandle_t          handle,
+                                     const hipblasOperation_t trans,
+                                     const int                n,
+                                     const int                nrhs,
+                                     hipblasComplex* const    A[],
+                                     const int                lda,
+                                     const int*               ipiv,
+                                     hipblasComplex* const    B[],
+                                     const int                ldb,
+                                     int*                     info,
+                                     const int                batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, ldb, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(
+        hipblasConvertStatus(cublasCgetrsBatched((cublasHandle_t)handle,
+                                                 hipblasConvertOperation(trans),
+                                                 n,
+                                                 nrhs,
+                                                 (cuComplex**)A,
+                                                 lda,
+                                                 ipiv,
+                                                 (cuComplex**)B,
+                                                 ldb,
+                                                 info,
+                                                 batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrsBatched(hipblasHandle_t             handle,
+                                     const hipblasOperation_t    trans,
+                                     const int                   n,
+                                     const int                   nrhs,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     const int*                  ipiv,
+                                     hipblasDoubleComplex* const B[],
+                                     const int                   ldb,
+                                     int*                        info,
+                                     const int                   batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, ldb, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(
+        hipblasConvertStatus(cublasZgetrsBatched((cublasHandle_t)handle,
+                                                 hipblasConvertOperation(trans),
+                                                 n,
+                                                 nrhs,
+                                                 (cuDoubleComplex**)A,
+                                                 lda,
+                                                 ipiv,
+                                                 (cuDoubleComplex**)B,
+                                                 ldb,
+                                                 info,
+                                                 batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrsBatched_v2(hipblasHandle_t          handle,
+                                        const hipblasOperation_t trans,
+                                        const int                n,
+                                        const int                nrhs,
+                                        hipComplex* const        A[],
+                                        const int                lda,
+                                        const int*               ipiv,
+                                        hipComplex* const        B[],
+                                        const int                ldb,
+                                        int*                     info,
+                                        const int                batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, ldb, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(
+        hipblasConvertStatus(cublasCgetrsBatched((cublasHandle_t)handle,
+                                                 hipblasConvertOperation(trans),
+                                                 n,
+                                                 nrhs,
+                                                 (cuComplex**)A,
+                                                 lda,
+                                                 ipiv,
+                                                 (cuComplex**)B,
+                                                 ldb,
+                                                 info,
+                                                 batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrsBatched_v2(hipblasHandle_t          handle,
+                                        const hipblasOperation_t trans,
+                                        const int                n,
+                                        const int                nrhs,
+                                        hipDoubleComplex* const  A[],
+                                        const int                lda,
+                                        const int*               ipiv,
+                                        hipDoubleComplex* const  B[],
+                                        const int                ldb,
+                                        int*                     info,
+                                        const int                batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, ldb, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(
+        hipblasConvertStatus(cublasZgetrsBatched((cublasHandle_t)handle,
+                                                 hipblasConvertOperation(trans),
+                                                 n,
+                                                 nrhs,
+                                                 (cuDoubleComplex**)A,
+                                                 lda,
+                                                 ipiv,
+                                                 (cuDoubleComplex**)B,
+                                                 ldb,
+                                                 info,
+                                                 batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// getrs_strided_batched
+hipblasStatus_t hipblasSgetrsStridedBatched(hipblasHandle_t          handle,
+                                            const hipblasOperation_t trans,
+                                            const int                n,
+                                            const int                nrhs,
+                                            float*                   A,
+                                            const int                lda,
+                                            const hipblasStride      strideA,
+                                            const int*               ipiv,
+                                            const hipblasStride      strideP,
+                                            float*                   B,
+                                            const int                ldb,
+                                            const hipblasStride      strideB,
+                                            int*                     info,
+                                            const int                batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, strideA, strideP, ldb, strideB, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    if(hipblasIsInterleavedBatch(handle))
+        return solver_info.store(hipblasInterleavedGetrs(handle,
+                                                         trans,
+                                                         n,
+                                                         nrhs,
+                                                         A,
+                                                         HIP_R_32F,
+                                                         lda,
+                                                         strideA,
+                                                         ipiv,
+                                                         strideP,
+                                                         B,
+                                                         ldb,
+                                                         strideB,
+                                                         info,
+                                                         batch_count));
+
+    return solver_info.store(hipblasSolverGetrs<float, true>(handle,
+                                                             trans,
+                                                             n,
+                                                             nrhs,
+                                                             A,
+                                                             lda,
+                                                             strideA,
+                                                             ipiv,
+                                                             strideP,
+                                                             B,
+                                                             ldb,
+                                                             strideB,
+                                                             info,
+                                                             batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgetrsStridedBatched(hipblasHandle_t          handle,
+                                            const hipblasOperation_t trans,
+                                            const int                n,
+                                            const int                nrhs,
+                                            double*                  A,
+                                            const int                lda,
+                                            const hipblasStride      strideA,
+                                            const int*               ipiv,
+                                            const hipblasStride      strideP,
+                                            double*                  B,
+                                            const int                ldb,
+                                            const hipblasStride      strideB,
+                                            int*                     info,
+                                            const int                batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, strideA, strideP, ldb, strideB, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    if(hipblasIsInterleavedBatch(handle))
+        return solver_info.store(hipblasInterleavedGetrs(handle,
+                                                         trans,
+                                                         n,
+                                                         nrhs,
+                                                         A,
+                                                         HIP_R_64F,
+                                                         lda,
+                                                         strideA,
+                                                         ipiv,
+                                                         strideP,
+                                                         B,
+                                                         ldb,
+                                                         strideB,
+                                                         info,
+                                                         batch_count));
+
+    return solver_info.store(hipblasSolverGetrs<double, true>(handle,
+                                                              trans,
+                                                              n,
+                                                              nrhs,
+                                                              A,
+                                                              lda,
+                                                              strideA,
+                                                              ipiv,
+                                                              strideP,
+                                                              B,
+                                                              ldb,
+                                                              strideB,
+                                                              info,
+                                                              batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrsStridedBatched(hipblasHandle_t          handle,
+                                            const hipblasOperation_t trans,
+                                            const int                n,
+                                            const int                nrhs,
+                                            hipblasComplex*          A,
+                                            const int                lda,
+                                            const hipblasStride      strideA,
+                                            const int*               ipiv,
+                                            const hipblasStride      strideP,
+                                            hipblasComplex*          B,
+                                            const int                ldb,
+                                            const hipblasStride      strideB,
+                                            int*                     info,
+                                            const int                batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, strideA, strideP, ldb, strideB, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    if(hipblasIsInterleavedBatch(handle))
+        return solver_info.store(hipblasInterleavedGetrs(handle,
+                                                         trans,
+                                                         n,
+                                                         nrhs,
+                                                         A,
+                                                         HIP_C_32F,
+                                                         lda,
+                                                         strideA,
+                                                         ipiv,
+                                                         strideP,
+                                                         B,
+                                                         ldb,
+                                                         strideB,
+                                                         info,
+                                                         batch_count));
+
+    return solver_info.store(hipblasSolverGetrs<hipComplex, true>(handle,
+                                                                  trans,
+                                                                  n,
+                                                                  nrhs,
+                                                                  (hipComplex*)A,
+                                                                  lda,
+                                                                  strideA,
+                                                                  ipiv,
+                                                                  strideP,
+                                                                  (hipComplex*)B,
+                                                                  ldb,
+                                                                  strideB,
+                                                                  info,
+                                                                  batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrsStridedBatched(hipblasHandle_t          handle,
+                                            const hipblasOperation_t trans,
+                                            const int                n,
+                                            const int                nrhs,
+                                            hipblasDoubleComplex*    A,
+                                            const int                lda,
+                                            const hipblasStride      strideA,
+                                            const int*               ipiv,
+                                            const hipblasStride      strideP,
+                                            hipblasDoubleComplex*    B,
+                                            const int                ldb,
+                                            const hipblasStride      strideB,
+                                            int*                     info,
+                                            const int                batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, strideA, strideP, ldb, strideB, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    if(hipblasIsInterleavedBatch(handle))
+        return solver_info.store(hipblasInterleavedGetrs(handle,
+                                                         trans,
+                                                         n,
+                                                         nrhs,
+                                                         A,
+                                                         HIP_C_64F,
+                                                         lda,
+                                                         strideA,
+                                                         ipiv,
+                                                         strideP,
+                                                         B,
+                                                         ldb,
+                                                         strideB,
+                                                         info,
+                                                         batch_count));
+
+    return solver_info.store(hipblasSolverGetrs<hipDoubleComplex, true>(handle,
+                                                                        trans,
+                                                                        n,
+                                                                        nrhs,
+                                                                        (hipDoubleComplex*)A,
+                                                                        lda,
+                                                                        strideA,
+                                                                        ipiv,
+                                                                        strideP,
+                                                                        (hipDoubleComplex*)B,
+                                                                        ldb,
+                                                                        strideB,
+                                                                        info,
+                                                                        batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrsStridedBatched_v2(hipblasHandle_t          handle,
+                                               const hipblasOperation_t trans,
+                                               const int                n,
+                                               const int                nrhs,
+                                               hipComplex*              A,
+                                               const int                lda,
+                                               const hipblasStride      strideA,
+                                               const int*               ipiv,
+                                               const hipblasStride      strideP,
+                                               hipComplex*              B,
+                                               const int                ldb,
+                                               const hipblasStride      strideB,
+                                               int*                     info,
+                                               const int                batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, strideA, strideP, ldb, strideB, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    if(hipblasIsInterleavedBatch(handle))
+        return solver_info.store(hipblasInterleavedGetrs(handle,
+                                                         trans,
+                                                         n,
+                                                         nrhs,
+                                                         A,
+                                                         HIP_C_32F,
+                                                         lda,
+                                                         strideA,
+                                                         ipiv,
+                                                         strideP,
+                                                         B,
+                                                         ldb,
+                                                         strideB,
+                                                         info,
+                                                         batch_count));
+
+    return solver_info.store(hipblasSolverGetrs<hipComplex, true>(handle,
+                                                                  trans,
+                                                                  n,
+                                                                  nrhs,
+                                                                  A,
+                                                                  lda,
+                                                                  strideA,
+                                                                  ipiv,
+                                                                  strideP,
+                                                                  B,
+                                                                  ldb,
+                                                                  strideB,
+                                                                  info,
+                                                                  batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrsStridedBatched_v2(hipblasHandle_t          handle,
+                                               const hipblasOperation_t trans,
+                                               const int                n,
+                                               const int                nrhs,
+                                               hipDoubleComplex*        A,
+                                               const int                lda,
+                                               const hipblasStride      strideA,
+                                               const int*               ipiv,
+                                               const hipblasStride      strideP,
+                                               hipDoubleComplex*        B,
+                                               const int                ldb,
+                                               const hipblasStride      strideB,
+                                               int*                     info,
+                                               const int                batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, n, nrhs, lda, strideA, strideP, ldb, strideB, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    if(hipblasIsInterleavedBatch(handle))
+        return solver_info.store(hipblasInterleavedGetrs(handle,
+                                                         trans,
+                                                         n,
+                                                         nrhs,
+                                                         A,
+                                                         HIP_C_64F,
+                                                         lda,
+                                                         strideA,
+                                                         ipiv,
+                                                         strideP,
+                                                         B,
+                                                         ldb,
+                                                         strideB,
+                                                         info,
+                                                         batch_count));
+
+    return solver_info.store(hipblasSolverGetrs<hipDoubleComplex, true>(handle,
+                                                                        trans,
+                                                                        n,
+                                                                        nrhs,
+                                                                        A,
+                                                                        lda,
+                                                                        strideA,
+                                                                        ipiv,
+                                                                        strideP,
+                                                                        B,
+                                                                        ldb,
+                                                                        strideB,
+                                                                        info,
+                                                                        batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// getri_batched
+hipblasStatus_t hipblasSgetriBatched(hipblasHandle_t handle,
+                                     const int       n,
+                                     float* const    A[],
+                                     const int       lda,
+                                     int*            ipiv,
+                                     float* const    C[],
+                                     const int       ldc,
+                                     int*            info,
+                                     const int       batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, ldc, batch_count);
+    return hipblasConvertStatus(
+        cublasSgetriBatched((cublasHandle_t)handle, n, A, lda, ipiv, C, ldc, info, batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgetriBatched(hipblasHandle_t handle,
+                                     const int       n,
+                                     double* const   A[],
+                                     const int       lda,
+                                     int*            ipiv,
+                                     double* const   C[],
+                                     const int       ldc,
+                                     int*            info,
+                                     const int       batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, ldc, batch_count);
+    return hipblasConvertStatus(
+        cublasDgetriBatched((cublasHandle_t)handle, n, A, lda, ipiv, C, ldc, info, batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetriBatched(hipblasHandle_t       handle,
+                                     const int             n,
+                                     hipblasComplex* const A[],
+                                     const int             lda,
+                                     int*                  ipiv,
+                                     hipblasComplex* const C[],
+                                     const int             ldc,
+                                     int*                  info,
+                                     const int             batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, ldc, batch_count);
+    return hipblasConvertStatus(cublasCgetriBatched((cublasHandle_t)handle,
+                                                    n,
+                                                    (cuComplex**)A,
+                                                    lda,
+                                                    ipiv,
+                                                    (cuComplex**)C,
+                                                    ldc,
+                                                    info,
+                                                    batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetriBatched(hipblasHandle_t             handle,
+                                     const int                   n,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     int*                        ipiv,
+                                     hipblasDoubleComplex* const C[],
+                                     const int                   ldc,
+                                     int*                        info,
+                                     const int                   batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, ldc, batch_count);
+    return hipblasConvertStatus(cublasZgetriBatched((cublasHandle_t)handle,
+                                                    n,
+                                                    (cuDoubleComplex**)A,
+                                                    lda,
+                                                    ipiv,
+                                                    (cuDoubleComplex**)C,
+                                                    ldc,
+                                                    info,
+                                                    batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetriBatched_v2(hipblasHandle_t   handle,
+                                        const int         n,
+                                        hipComplex* const A[],
+                                        const int         lda,
+                                        int*              ipiv,
+                                        hipComplex* const C[],
+                                        const int         ldc,
+                                        int*              info,
+                                        const int         batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, ldc, batch_count);
+    return hipblasConvertStatus(cublasCgetriBatched((cublasHandle_t)handle,
+                                                    n,
+                                                    (cuComplex**)A,
+                                                    lda,
+                                                    ipiv,
+                                                    (cuComplex**)C,
+                                                    ldc,
+                                                    info,
+                                                    batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetriBatched_v2(hipblasHandle_t         handle,
+                                        const int               n,
+                                        hipDoubleComplex* const A[],
+                                        const int               lda,
+                                        int*                    ipiv,
+                                        hipDoubleComplex* const C[],
+                                        const int               ldc,
+                                        int*                    info,
+                                        const int               batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, ldc, batch_count);
+    return hipblasConvertStatus(cublasZgetriBatched((cublasHandle_t)handle,
+                                                    n,
+                                                    (cuDoubleComplex**)A,
+                                                    lda,
+                                                    ipiv,
+                                                    (cuDoubleComplex**)C,
+                                                    ldc,
+                                                    info,
+                                                    batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// matinv_batched
+hipblasStatus_t hipblasSmatinvBatched(hipblasHandle_t    handle,
+                                      const int          n,
+                                      const float* const A[],
+                                      const int          lda,
+                                      float* const       Ainv[],
+                                      const int          lda_inv,
+                                      int*               info,
+                                      const int          batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, lda_inv, batch_count);
+    return hipblasConvertStatus(
+        cublasSmatinvBatched((cublasHandle_t)handle, n, A, lda, Ainv, lda_inv, info, batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDmatinvBatched(hipblasHandle_t     handle,
+                                      const int           n,
+                                      const double* const A[],
+                                      const int           lda,
+                                      double* const       Ainv[],
+                                      const int           lda_inv,
+                                      int*                info,
+                                      const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, lda_inv, batch_count);
+    return hipblasConvertStatus(
+        cublasDmatinvBatched((cublasHandle_t)handle, n, A, lda, Ainv, lda_inv, info, batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCmatinvBatched(hipblasHandle_t             handle,
+                                      const int                   n,
+                                      const hipblasComplex* const A[],
+                                      const int                   lda,
+                                      hipblasComplex* const       Ainv[],
+                                      const int                   lda_inv,
+                                      int*                        info,
+                                      const int                   batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, lda_inv, batch_count);
+    return hipblasConvertStatus(cublasCmatinvBatched((cublasHandle_t)handle,
+                                                     n,
+                                                     (const cuComplex* const*)A,
+                                                     lda,
+                                                     (cuComplex* const*)Ainv,
+                                                     lda_inv,
+                                                     info,
+                                                     batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZmatinvBatched(hipblasHandle_t                   handle,
+                                      const int                         n,
+                                      const hipblasDoubleComplex* const A[],
+                                      const int                         lda,
+                                      hipblasDoubleComplex* const       Ainv[],
+                                      const int                         lda_inv,
+                                      int*                              info,
+                                      const int                         batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, lda_inv, batch_count);
+    return hipblasConvertStatus(cublasZmatinvBatched((cublasHandle_t)handle,
+                                                     n,
+                                                     (const cuDoubleComplex* const*)A,
+                                                     lda,
+                                                     (cuDoubleComplex* const*)Ainv,
+                                                     lda_inv,
+                                                     info,
+                                                     batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCmatinvBatched_v2(hipblasHandle_t         handle,
+                                         const int               n,
+                                         const hipComplex* const A[],
+                                         const int               lda,
+                                         hipComplex* const       Ainv[],
+                                         const int               lda_inv,
+                                         int*                    info,
+                                         const int               batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, lda_inv, batch_count);
+    return hipblasConvertStatus(cublasCmatinvBatched((cublasHandle_t)handle,
+                                                     n,
+                                                     (const cuComplex* const*)A,
+                                                     lda,
+                                                     (cuComplex* const*)Ainv,
+                                                     lda_inv,
+                                                     info,
+                                                     batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZmatinvBatched_v2(hipblasHandle_t               handle,
+                                         const int                     n,
+                                         const hipDoubleComplex* const A[],
+                                         const int                     lda,
+                                         hipDoubleComplex* const       Ainv[],
+                                         const int                     lda_inv,
+                                         int*                          info,
+                                         const int                     batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, lda_inv, batch_count);
+    return hipblasConvertStatus(cublasZmatinvBatched((cublasHandle_t)handle,
+                                                     n,
+                                                     (const cuDoubleComplex* const*)A,
+                                                     lda,
+                                                     (cuDoubleComplex* const*)Ainv,
+                                                     lda_inv,
+                                                     info,
+                                                     batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// matinv_strided_batched
+hipblasStatus_t hipblasSmatinvStridedBatched(hipblasHandle_t     handle,
+                                             const int           n,
+                                             const float*        A,
+                                             const int           lda,
+                                             const hipblasStride strideA,
+                                             float*              Ainv,
+                                             const int           lda_inv,
+                                             const hipblasStride strideAinv,
+                                             int*                info,
+                                             const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, strideA, lda_inv, strideAinv, batch_count);
+    return hipblasMatinv(
+        handle, n, A, HIP_R_32F, lda, strideA, Ainv, lda_inv, strideAinv, info, batch_count, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDmatinvStridedBatched(hipblasHandle_t     handle,
+                                             const int           n,
+                                             const double*       A,
+                                             const int           lda,
+                                             const hipblasStride strideA,
+                                             double*             Ainv,
+                                             const int           lda_inv,
+                                             const hipblasStride strideAinv,
+                                             int*                info,
+                                             const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, strideA, lda_inv, strideAinv, batch_count);
+    return hipblasMatinv(
+        handle, n, A, HIP_R_64F, lda, strideA, Ainv, lda_inv, strideAinv, info, batch_count, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCmatinvStridedBatched(hipblasHandle_t       handle,
+                                             const int             n,
+                                             const hipblasComplex* A,
+                                             const int             lda,
+                                             const hipblasStride   strideA,
+                                             hipblasComplex*       Ainv,
+                                             const int             lda_inv,
+                                             const hipblasStride   strideAinv,
+                                             int*                  info,
+                                             const int             batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, strideA, lda_inv, strideAinv, batch_count);
+    return hipblasMatinv(
+        handle, n, A, HIP_C_32F, lda, strideA, Ainv, lda_inv, strideAinv, info, batch_count, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZmatinvStridedBatched(hipblasHandle_t             handle,
+                                             const int                   n,
+                                             const hipblasDoubleComplex* A,
+                                             const int                   lda,
+                                             const hipblasStride         strideA,
+                                             hipblasDoubleComplex*       Ainv,
+                                             const int                   lda_inv,
+                                             const hipblasStride         strideAinv,
+                                             int*                        info,
+                                             const int                   batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, strideA, lda_inv, strideAinv, batch_count);
+    return hipblasMatinv(
+        handle, n, A, HIP_C_64F, lda, strideA, Ainv, lda_inv, strideAinv, info, batch_count, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCmatinvStridedBatched_v2(hipblasHandle_t     handle,
+                                                const int           n,
+                                                const hipComplex*   A,
+                                                const int           lda,
+                                                const hipblasStride strideA,
+                                                hipComplex*         Ainv,
+                                                const int           lda_inv,
+                                                const hipblasStride strideAinv,
+                                                int*                info,
+                                                const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, strideA, lda_inv, strideAinv, batch_count);
+    return hipblasMatinv(
+        handle, n, A, HIP_C_32F, lda, strideA, Ainv, lda_inv, strideAinv, info, batch_count, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZmatinvStridedBatched_v2(hipblasHandle_t         handle,
+                                                const int               n,
+                                                const hipDoubleComplex* A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                hipDoubleComplex*       Ainv,
+                                                const int               lda_inv,
+                                                const hipblasStride     strideAinv,
+                                                int*                    info,
+                                                const int               batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, n, lda, strideA, lda_inv, strideAinv, batch_count);
+    return hipblasMatinv(
+        handle, n, A, HIP_C_64F, lda, strideA, Ainv, lda_inv, strideAinv, info, batch_count, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// geqrf
+hipblasStatus_t hipblasSgeqrf(hipblasHandle_t handle,
+                              const int       m,
+                              const int       n,
+                              float*          A,
+                              const int       lda,
+                              float*          ipiv,
+                              int*            info)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(
+        hipblasSolverGeqrf<float, false>(handle, m, n, A, lda, 0, ipiv, 0, info, 1));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgeqrf(hipblasHandle_t handle,
+                              const int       m,
+                              const int       n,
+                              double*         A,
+                              const int       lda,
+                              double*         ipiv,
+                              int*            info)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(
+        hipblasSolverGeqrf<double, false>(handle, m, n, A, lda, 0, ipiv, 0, info, 1));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgeqrf(hipblasHandle_t handle,
+                              const int       m,
+                              const int       n,
+                              hipblasComplex* A,
+                              const int       lda,
+                              hipblasComplex* ipiv,
+                              int*            info)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGeqrf<hipComplex, false>(handle,
+                                                                   m,
+                                                                   n,
+                                                                   (hipComplex*)A,
+                                                                   lda,
+                                                                   0,
+                                                                   (hipComplex*)ipiv,
+                                                                   0,
+                                                                   info,
+                                                                   1));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgeqrf(hipblasHandle_t       handle,
+                              const int             m,
+                              const int             n,
+                              hipblasDoubleComplex* A,
+                              const int             lda,
+                              hipblasDoubleComplex* ipiv,
+                              int*                  info)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGeqrf<hipDoubleComplex, false>(handle,
+                                                                         m,
+                                                                         n,
+                                                                         (hipDoubleComplex*)A,
+                                                                         lda,
+                                                                         0,
+                                                                         (hipDoubleComplex*)ipiv,
+                                                                         0,
+                                                                         info,
+                                                                         1));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgeqrf_v2(hipblasHandle_t handle,
+                                 const int       m,
+                                 const int       n,
+                                 hipComplex*     A,
+                                 const int       lda,
+                                 hipComplex*     ipiv,
+                                 int*            info)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(
+        hipblasSolverGeqrf<hipComplex, false>(handle, m, n, A, lda, 0, ipiv, 0, info, 1));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgeqrf_v2(hipblasHandle_t   handle,
+                                 const int         m,
+                                 const int         n,
+                                 hipDoubleComplex* A,
+                                 const int         lda,
+                                 hipDoubleComplex* ipiv,
+                                 int*              info)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(
+        hipblasSolverGeqrf<hipDoubleComplex, false>(handle, m, n, A, lda, 0, ipiv, 0, info, 1));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// geqrf_batched
+hipblasStatus_t hipblasSgeqrfBatched(hipblasHandle_t handle,
+                                     const int       m,
+                                     const int       n,
+                                     float* const    A[],
+                                     const int       lda,
+                                     float* const    ipiv[],
+                                     int*            info,
+                                     const int       batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasConvertStatus(cublasSgeqrfBatched((cublasHandle_t)handle,
+                                                                      m,
+                                                                      n,
+                                                                      A,
+                                                                      lda,
+                                                                      ipiv,
+                                                                      info,
+                                                                      batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgeqrfBatched(hipblasHandle_t handle,
+                                     const int       m,
+                                     const int       n,
+                                     double* const   A[],
+                                     const int       lda,
+                                     double* const   ipiv[],
+                                     int*            info,
+                                     const int       batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasConvertStatus(cublasDgeqrfBatched((cublasHandle_t)handle,
+                                                                      m,
+                                                                      n,
+                                                                      A,
+                                                                      lda,
+                                                                      ipiv,
+                                                                      info,
+                                                                      batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgeqrfBatched(hipblasHandle_t       handle,
+                                     const int             m,
+                                     const int             n,
+                                     hipblasComplex* const A[],
+                                     const int             lda,
+                                     hipblasComplex* const ipiv[],
+                                     int*                  info,
+                                     const int             batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasConvertStatus(cublasCgeqrfBatched((cublasHandle_t)handle,
+                                                                      m,
+                                                                      n,
+                                                                      (cuComplex**)A,
+                                                                      lda,
+                                                                      (cuComplex**)ipiv,
+                                                                      info,
+                                                                      batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgeqrfBatched(hipblasHandle_t             handle,
+                                     const int                   m,
+                                     const int                   n,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     hipblasDoubleComplex* const ipiv[],
+                                     int*                        info,
+                                     const int                   batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasConvertStatus(cublasZgeqrfBatched((cublasHandle_t)handle,
+                                                                      m,
+                                                                      n,
+                                                                      (cuDoubleComplex**)A,
+                                                                      lda,
+                                                                      (cuDoubleComplex**)ipiv,
+                                                                      info,
+                                                                      batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgeqrfBatched_v2(hipblasHandle_t   handle,
+                                        const int         m,
+                                        const int         n,
+                                        hipComplex* const A[],
+                                        const int         lda,
+                                        hipComplex* const ipiv[],
+                                        int*              info,
+                                        const int         batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasConvertStatus(cublasCgeqrfBatched((cublasHandle_t)handle,
+                                                                      m,
+                                                                      n,
+                                                                      (cuComplex**)A,
+                                                                      lda,
+                                                                      (cuComplex**)ipiv,
+                                                                      info,
+                                                                      batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgeqrfBatched_v2(hipblasHandle_t         handle,
+                                        const int               m,
+                                        const int               n,
+                                        hipDoubleComplex* const A[],
+                                        const int               lda,
+                                        hipDoubleComplex* const ipiv[],
+                                        int*                    info,
+                                        const int               batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasConvertStatus(cublasZgeqrfBatched((cublasHandle_t)handle,
+                                                                      m,
+                                                                      n,
+                                                                      (cuDoubleComplex**)A,
+                                                                      lda,
+                                                                      (cuDoubleComplex**)ipiv,
+                                                                      info,
+                                                                      batch_count)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// geqrf_batched_strided_tau
+hipblasStatus_t hipblasSgeqrfBatchedStridedTau(hipblasHandle_t     handle,
+                                               const int           m,
+                                               const int           n,
+                                               float* const        A[],
+                                               const int           lda,
+                                               float*              tau,
+                                               const hipblasStride strideT,
+                                               int*                info,
+                                               const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, strideT, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGeqrfBatchedStridedTau<float>(
+        handle, m, n, A, lda, tau, strideT, info, batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgeqrfBatchedStridedTau(hipblasHandle_t     handle,
+                                               const int           m,
+                                               const int           n,
+                                               double* const       A[],
+                                               const int           lda,
+                                               double*             tau,
+                                               const hipblasStride strideT,
+                                               int*                info,
+                                               const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, strideT, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGeqrfBatchedStridedTau<double>(
+        handle, m, n, A, lda, tau, strideT, info, batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgeqrfBatchedStridedTau(hipblasHandle_t       handle,
+                                               const int             m,
+                                               const int             n,
+                                               hipblasComplex* const A[],
+                                               const int             lda,
+                                               hipblasComplex*       tau,
+                                               const hipblasStride   strideT,
+                                               int*                  info,
+                                               const int             batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, strideT, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGeqrfBatchedStridedTau<hipComplex>(handle,
+                                                                             m,
+                                                                             n,
+                                                                             (hipComplex* const*)A,
+                                                                             lda,
+                                                                             (hipComplex*)tau,
+                                                                             strideT,
+                                                                             info,
+                                                                             batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgeqrfBatchedStridedTau(hipblasHandle_t             handle,
+                                               const int                   m,
+                                               const int                   n,
+                                               hipblasDoubleComplex* const A[],
+                                               const int                   lda,
+                                               hipblasDoubleComplex*       tau,
+                                               const hipblasStride         strideT,
+                                               int*                        info,
+                                               const int                   batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, strideT, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(
+        hipblasSolverGeqrfBatchedStridedTau<hipDoubleComplex>(handle,
+                                                              m,
+                                                              n,
+                                                              (hipDoubleComplex* const*)A,
+                                                              lda,
+                                                              (hipDoubleComplex*)tau,
+                                                              strideT,
+                                                              info,
+                                                              batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgeqrfBatchedStridedTau_v2(hipblasHandle_t     handle,
+                                                  const int           m,
+                                                  const int           n,
+                                                  hipComplex* const   A[],
+                                                  const int           lda,
+                                                  hipComplex*         tau,
+                                                  const hipblasStride strideT,
+                                                  int*                info,
+                                                  const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, strideT, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGeqrfBatchedStridedTau<hipComplex>(
+        handle, m, n, A, lda, tau, strideT, info, batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgeqrfBatchedStridedTau_v2(hipblasHandle_t         handle,
+                                                  const int               m,
+                                                  const int               n,
+                                                  hipDoubleComplex* const A[],
+                                                  const int               lda,
+                                                  hipDoubleComplex*       tau,
+                                                  const hipblasStride     strideT,
+                                                  int*                    info,
+                                                  const int               batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, strideT, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(
+        hipblasSolverGeqrfBatchedStridedTau<hipDoubleComplex>(handle,
+                                                              m,
+                                                              n,
+                                                              (hipDoubleComplex* const*)A,
+                                                              lda,
+                                                              (hipDoubleComplex*)tau,
+                                                              strideT,
+                                                              info,
+                                                              batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// geqrf_strided_batched
+hipblasStatus_t hipblasSgeqrfStridedBatched(hipblasHandle_t     handle,
+                                            const int           m,
+                                            const int           n,
+                                            float*              A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            float*              ipiv,
+                                            const hipblasStride strideP,
+                                            int*                info,
+                                            const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, strideA, strideP, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGeqrf<float, true>(handle,
+                                                             m,
+                                                             n,
+                                                             A,
+                                                             lda,
+                                                             strideA,
+                                                             ipiv,
+                                                             strideP,
+                                                             info,
+                                                             batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgeqrfStridedBatched(hipblasHandle_t     handle,
+                                            const int           m,
+                                            const int           n,
+                                            double*             A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            double*             ipiv,
+                                            const hipblasStride strideP,
+                                            int*                info,
+                                            const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, strideA, strideP, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGeqrf<double, true>(handle,
+                                                              m,
+                                                              n,
+                                                              A,
+                                                              lda,
+                                                              strideA,
+                                                              ipiv,
+                                                              strideP,
+                                                              info,
+                                                              batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgeqrfStridedBatched(hipblasHandle_t     handle,
+                                            const int           m,
+                                            const int           n,
+                                            hipblasComplex*     A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            hipblasComplex*     ipiv,
+                                            const hipblasStride strideP,
+                                            int*                info,
+                                            const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, strideA, strideP, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGeqrf<hipComplex, true>(handle,
+                                                                  m,
+                                                                  n,
+                                                                  (hipComplex*)A,
+                                                                  lda,
+                                                                  strideA,
+                                                                  (hipComplex*)ipiv,
+                                                                  strideP,
+                                                                  info,
+                                                                  batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgeqrfStridedBatched(hipblasHandle_t       handle,
+                                            const int             m,
+                                            const int             n,
+                                            hipblasDoubleComplex* A,
+                                            const int             lda,
+                                            const hipblasStride   strideA,
+                                            hipblasDoubleComplex* ipiv,
+                                            const hipblasStride   strideP,
+                                            int*                  info,
+                                            const int             batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, strideA, strideP, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGeqrf<hipDoubleComplex, true>(handle,
+                                                                        m,
+                                                                        n,
+                                                                        (hipDoubleComplex*)A,
+                                                                        lda,
+                                                                        strideA,
+                                                                        (hipDoubleComplex*)ipiv,
+                                                                        strideP,
+                                                                        info,
+                                                                        batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgeqrfStridedBatched_v2(hipblasHandle_t     handle,
+                                               const int           m,
+                                               const int           n,
+                                               hipComplex*         A,
+                                               const int           lda,
+                                               const hipblasStride strideA,
+                                               hipComplex*         ipiv,
+                                               const hipblasStride strideP,
+                                               int*                info,
+                                               const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, strideA, strideP, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGeqrf<hipComplex, true>(handle,
+                                                                  m,
+                                                                  n,
+                                                                  A,
+                                                                  lda,
+                                                                  strideA,
+                                                                  ipiv,
+                                                                  strideP,
+                                                                  info,
+                                                                  batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgeqrfStridedBatched_v2(hipblasHandle_t     handle,
+                                               const int           m,
+                                               const int           n,
+                                               hipDoubleComplex*   A,
+                                               const int           lda,
+                                               const hipblasStride strideA,
+                                               hipDoubleComplex*   ipiv,
+                                               const hipblasStride strideP,
+                                               int*                info,
+                                               const int           batch_count)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, strideA, strideP, batch_count);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGeqrf<hipDoubleComplex, true>(handle,
+                                                                        m,
+                                                                        n,
+                                                                        A,
+                                                                        lda,
+                                                                        strideA,
+                                                                        ipiv,
+                                                                        strideP,
+                                                                        info,
+                                                                        batch_count));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// gels
+hipblasStatus_t hipblasSgels(hipblasHandle_t    handle,
+                             hipblasOperation_t trans,
+                             const int          m,
+                             const int          n,
+                             const int          nrhs,
+                             float*             A,
+                             const int          lda,
+                             float*             B,
+                             const int          ldb,
+                             int*               info,
+                             int*               deviceInfo)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGels<float, false>(handle,
+                                                             trans,
+                                                             m,
+                                                             n,
+                                                             nrhs,
+                                                             A,
+                                                             lda,
+                                                             0,
+                                                             B,
+                                                             ldb,
+                                                             0,
+                                                             info,
+                                                             deviceInfo,
+                                                             1));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgels(hipblasHandle_t    handle,
+                             hipblasOperation_t trans,
+                             const int          m,
+                             const int          n,
+                             const int          nrhs,
+                             double*            A,
+                             const int          lda,
+                             double*            B,
+                             const int          ldb,
+                             int*               info,
+                             int*               deviceInfo)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGels<double, false>(handle,
+                                                              trans,
+                                                              m,
+                                                              n,
+                                                              nrhs,
+                                                              A,
+                                                              lda,
+                                                              0,
+                                                              B,
+                                                              ldb,
+                                                              0,
+                                                              info,
+                                                              deviceInfo,
+                                                              1));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgels(hipblasHandle_t    handle,
+                             hipblasOperation_t trans,
+                             const int          m,
+                             const int          n,
+                             const int          nrhs,
+                             hipblasComplex*    A,
+                             const int          lda,
+                             hipblasComplex*    B,
+                             const int          ldb,
+                             int*               info,
+                             int*               deviceInfo)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGels<hipComplex, false>(handle,
+                                                                  trans,
+                                                                  m,
+                                                                  n,
+                                                                  nrhs,
+                                                                  (hipComplex*)A,
+                                                                  lda,
+                                                                  0,
+                                                                  (hipComplex*)B,
+                                                                  ldb,
+                                                                  0,
+                                                                  info,
+                                                                  deviceInfo,
+                                                                  1));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgels(hipblasHandle_t       handle,
+                             hipblasOperation_t    trans,
+                             const int             m,
+                             const int             n,
+                             const int             nrhs,
+                             hipblasDoubleComplex* A,
+                             const int             lda,
+                             hipblasDoubleComplex* B,
+                             const int             ldb,
+                             int*                  info,
+                             int*                  deviceInfo)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGels<hipDoubleComplex, false>(handle,
+                                                                        trans,
+                                                                        m,
+                                                                        n,
+                                                                        nrhs,
+                                                                        (hipDoubleComplex*)A,
+                                                                        lda,
+                                                                        0,
+                                                                        (hipDoubleComplex*)B,
+                                                                        ldb,
+                                                                        0,
+                                                                        info,
+                                                                        deviceInfo,
+                                                                        1));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgels_v2(hipblasHandle_t    handle,
+                                hipblasOperation_t trans,
+                                const int          m,
+                                const int          n,
+                                const int          nrhs,
+                                hipComplex*        A,
+                                const int          lda,
+                                hipComplex*        B,
+                                const int          ldb,
+                                int*               info,
+                                int*               deviceInfo)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGels<hipComplex, false>(handle,
+                                                                  trans,
+                                                                  m,
+                                                                  n,
+                                                                  nrhs,
+                                                                  A,
+                                                                  lda,
+                                                                  0,
+                                                                  B,
+                                                                  ldb,
+                                                                  0,
+                                                                  info,
+                                                                  deviceInfo,
+                                                                  1));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgels_v2(hipblasHandle_t    handle,
+                                hipblasOperation_t trans,
+                                const int          m,
+                                const int          n,
+                                const int          nrhs,
+                                hipDoubleComplex*  A,
+                                const int          lda,
+                                hipDoubleComplex*  B,
+                                const int          ldb,
+                                int*               info,
+                                int*               deviceInfo)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGels<hipDoubleComplex, false>(handle,
+                                                                        trans,
+                                                                        m,
+                                                                        n,
+                                                                        nrhs,
+                                                                        A,
+                                                                        lda,
+                                                                        0,
+                                                                        B,
+                                                                        ldb,
+                                                                        0,
+                                                                        info,
+                                                                        deviceInfo,
+                                                                        1));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// gelsBatched
+hipblasStatus_t hipblasSgelsBatched(hipblasHandle_t    handle,
+                                    hipblasOperation_t trans,
+                                    const int          m,
+                                    const int          n,
+                                    const int          nrhs,
+                                    float* const       A[],
+                                    const int          lda,
+                                    float* const       B[],
+                                    const int          ldb,
+                                    int*               info,
+                                    int*               deviceInfo,
+                                    const int          batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, ldb, batchCount);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasConvertStatus(cublasSgelsBatched((cublasHandle_t)handle,
+                                                                     hipblasConvertOperation(trans),
+                                                                     m,
+                                                                     n,
+                                                                     nrhs,
+                                                                     A,
+                                                                     lda,
+                                                                     B,
+                                                                     ldb,
+                                                                     info,
+                                                                     deviceInfo,
+                                                                     batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgelsBatched(hipblasHandle_t    handle,
+                                    hipblasOperation_t trans,
+                                    const int          m,
+                                    const int          n,
+                                    const int          nrhs,
+                                    double* const      A[],
+                                    const int          lda,
+                                    double* const      B[],
+                                    const int          ldb,
+                                    int*               info,
+                                    int*               deviceInfo,
+                                    const int          batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, ldb, batchCount);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasConvertStatus(cublasDgelsBatched((cublasHandle_t)handle,
+                                                                     hipblasConvertOperation(trans),
+                                                                     m,
+                                                                     n,
+                                                                     nrhs,
+                                                                     A,
+                                                                     lda,
+                                                                     B,
+                                                                     ldb,
+                                                                     info,
+                                                                     deviceInfo,
+                                                                     batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgelsBatched(hipblasHandle_t       handle,
+                                    hipblasOperation_t    trans,
+                                    const int             m,
+                                    const int             n,
+                                    const int             nrhs,
+                                    hipblasComplex* const A[],
+                                    const int             lda,
+                                    hipblasComplex* const B[],
+                                    const int             ldb,
+                                    int*                  info,
+                                    int*                  deviceInfo,
+                                    const int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, ldb, batchCount);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasConvertStatus(cublasCgelsBatched((cublasHandle_t)handle,
+                                                                     hipblasConvertOperation(trans),
+                                                                     m,
+                                                                     n,
+                                                                     nrhs,
+                                                                     (cuComplex**)A,
+                                                                     lda,
+                                                                     (cuComplex**)B,
+                                                                     ldb,
+                                                                     info,
+                                                                     deviceInfo,
+                                                                     batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgelsBatched(hipblasHandle_t             handle,
+                                    hipblasOperation_t          trans,
+                                    const int                   m,
+                                    const int                   n,
+                                    const int                   nrhs,
+                                    hipblasDoubleComplex* const A[],
+                                    const int                   lda,
+                                    hipblasDoubleComplex* const B[],
+                                    const int                   ldb,
+                                    int*                        info,
+                                    int*                        deviceInfo,
+                                    const int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, ldb, batchCount);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasConvertStatus(cublasZgelsBatched((cublasHandle_t)handle,
+                                                                     hipblasConvertOperation(trans),
+                                                                     m,
+                                                                     n,
+                                                                     nrhs,
+                                                                     (cuDoubleComplex**)A,
+                                                                     lda,
+                                                                     (cuDoubleComplex**)B,
+                                                                     ldb,
+                                                                     info,
+                                                                     deviceInfo,
+                                                                     batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgelsBatched_v2(hipblasHandle_t    handle,
+                                       hipblasOperation_t trans,
+                                       const int          m,
+                                       const int          n,
+                                       const int          nrhs,
+                                       hipComplex* const  A[],
+                                       const int          lda,
+                                       hipComplex* const  B[],
+                                       const int          ldb,
+                                       int*               info,
+                                       int*               deviceInfo,
+                                       const int          batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, ldb, batchCount);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasConvertStatus(cublasCgelsBatched((cublasHandle_t)handle,
+                                                                     hipblasConvertOperation(trans),
+                                                                     m,
+                                                                     n,
+                                                                     nrhs,
+                                                                     (cuComplex**)A,
+                                                                     lda,
+                                                                     (cuComplex**)B,
+                                                                     ldb,
+                                                                     info,
+                                                                     deviceInfo,
+                                                                     batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgelsBatched_v2(hipblasHandle_t         handle,
+                                       hipblasOperation_t      trans,
+                                       const int               m,
+                                       const int               n,
+                                       const int               nrhs,
+                                       hipDoubleComplex* const A[],
+                                       const int               lda,
+                                       hipDoubleComplex* const B[],
+                                       const int               ldb,
+                                       int*                    info,
+                                       int*                    deviceInfo,
+                                       const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, ldb, batchCount);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasConvertStatus(cublasZgelsBatched((cublasHandle_t)handle,
+                                                                     hipblasConvertOperation(trans),
+                                                                     m,
+                                                                     n,
+                                                                     nrhs,
+                                                                     (cuDoubleComplex**)A,
+                                                                     lda,
+                                                                     (cuDoubleComplex**)B,
+                                                                     ldb,
+                                                                     info,
+                                                                     deviceInfo,
+                                                                     batchCount)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// gelsStridedBatched
+hipblasStatus_t hipblasSgelsStridedBatched(hipblasHandle_t     handle,
+                                           hipblasOperation_t  trans,
+                                           const int           m,
+                                           const int           n,
+                                           const int           nrhs,
+                                           float*              A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           float*              B,
+                                           const int           ldb,
+                                           const hipblasStride strideB,
+                                           int*                info,
+                                           int*                deviceInfo,
+                                           const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, strideA, ldb, strideB, batchCount);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGels<float, true>(handle,
+                                                            trans,
+                                                            m,
+                                                            n,
+                                                            nrhs,
+                                                            A,
+                                                            lda,
+                                                            strideA,
+                                                            B,
+                                                            ldb,
+                                                            strideB,
+                                                            info,
+                                                            deviceInfo,
+                                                            batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgelsStridedBatched(hipblasHandle_t     handle,
+                                           hipblasOperation_t  trans,
+                                           const int           m,
+                                           const int           n,
+                                           const int           nrhs,
+                                           double*             A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           double*             B,
+                                           const int           ldb,
+                                           const hipblasStride strideB,
+                                           int*                info,
+                                           int*                deviceInfo,
+                                           const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, strideA, ldb, strideB, batchCount);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGels<double, true>(handle,
+                                                             trans,
+                                                             m,
+                                                             n,
+                                                             nrhs,
+                                                             A,
+                                                             lda,
+                                                             strideA,
+                                                             B,
+                                                             ldb,
+                                                             strideB,
+                                                             info,
+                                                             deviceInfo,
+                                                             batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgelsStridedBatched(hipblasHandle_t     handle,
+                                           hipblasOperation_t  trans,
+                                           const int           m,
+                                           const int           n,
+                                           const int           nrhs,
+                                           hipblasComplex*     A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           hipblasComplex*     B,
+                                           const int           ldb,
+                                           const hipblasStride strideB,
+                                           int*                info,
+                                           int*                deviceInfo,
+                                           const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, strideA, ldb, strideB, batchCount);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGels<hipComplex, true>(handle,
+                                                                 trans,
+                                                                 m,
+                                                                 n,
+                                                                 nrhs,
+                                                                 (hipComplex*)A,
+                                                                 lda,
+                                                                 strideA,
+                                                                 (hipComplex*)B,
+                                                                 ldb,
+                                                                 strideB,
+                                                                 info,
+                                                                 deviceInfo,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgelsStridedBatched(hipblasHandle_t       handle,
+                                           hipblasOperation_t    trans,
+                                           const int             m,
+                                           const int             n,
+                                           const int             nrhs,
+                                           hipblasDoubleComplex* A,
+                                           const int             lda,
+                                           const hipblasStride   strideA,
+                                           hipblasDoubleComplex* B,
+                                           const int             ldb,
+                                           const hipblasStride   strideB,
+                                           int*                  info,
+                                           int*                  deviceInfo,
+                                           const int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, strideA, ldb, strideB, batchCount);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGels<hipDoubleComplex, true>(handle,
+                                                                       trans,
+                                                                       m,
+                                                                       n,
+                                                                       nrhs,
+                                                                       (hipDoubleComplex*)A,
+                                                                       lda,
+                                                                       strideA,
+                                                                       (hipDoubleComplex*)B,
+                                                                       ldb,
+                                                                       strideB,
+                                                                       info,
+                                                                       deviceInfo,
+                                                                       batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgelsStridedBatched_v2(hipblasHandle_t     handle,
+                                              hipblasOperation_t  trans,
+                                              const int           m,
+                                              const int           n,
+                                              const int           nrhs,
+                                              hipComplex*         A,
+                                              const int           lda,
+                                              const hipblasStride strideA,
+                                              hipComplex*         B,
+                                              const int           ldb,
+                                              const hipblasStride strideB,
+                                              int*                info,
+                                              int*                deviceInfo,
+                                              const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, strideA, ldb, strideB, batchCount);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGels<hipComplex, true>(handle,
+                                                                 trans,
+                                                                 m,
+                                                                 n,
+                                                                 nrhs,
+                                                                 A,
+                                                                 lda,
+                                                                 strideA,
+                                                                 B,
+                                                                 ldb,
+                                                                 strideB,
+                                                                 info,
+                                                                 deviceInfo,
+                                                                 batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgelsStridedBatched_v2(hipblasHandle_t     handle,
+                                              hipblasOperation_t  trans,
+                                              const int           m,
+                                              const int           n,
+                                              const int           nrhs,
+                                              hipDoubleComplex*   A,
+                                              const int           lda,
+                                              const hipblasStride strideA,
+                                              hipDoubleComplex*   B,
+                                              const int           ldb,
+                                              const hipblasStride strideB,
+                                              int*                info,
+                                              int*                deviceInfo,
+                                              const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, trans, m, n, nrhs, lda, strideA, ldb, strideB, batchCount);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverGels<hipDoubleComplex, true>(handle,
+                                                                       trans,
+                                                                       m,
+                                                                       n,
+                                                                       nrhs,
+                                                                       A,
+                                                                       lda,
+                                                                       strideA,
+                                                                       B,
+                                                                       ldb,
+                                                                       strideB,
+                                                                       info,
+                                                                       deviceInfo,
+                                                                       batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potrf
+hipblasStatus_t hipblasSpotrf(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              float*                  A,
+                              const int               lda,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return hipblasSolverPotrf<float, false>(handle, uplo, n, A, lda, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotrf(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              double*                 A,
+                              const int               lda,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return hipblasSolverPotrf<double, false>(handle, uplo, n, A, lda, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrf(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              hipblasComplex*         A,
+                              const int               lda,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return hipblasSolverPotrf<hipComplex, false>(handle, uplo, n, (hipComplex*)A, lda, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrf(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              hipblasDoubleComplex*   A,
+                              const int               lda,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return hipblasSolverPotrf<hipDoubleComplex, false>(
+        handle, uplo, n, (hipDoubleComplex*)A, lda, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrf_v2(hipblasHandle_t         handle,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 hipComplex*             A,
+                                 const int               lda,
+                                 int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return hipblasSolverPotrf<hipComplex, false>(handle, uplo, n, A, lda, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrf_v2(hipblasHandle_t         handle,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 hipDoubleComplex*       A,
+                                 const int               lda,
+                                 int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return hipblasSolverPotrf<hipDoubleComplex, false>(handle, uplo, n, A, lda, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potrf_batched
+hipblasStatus_t hipblasSpotrfBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     float* const            A[],
+                                     const int               lda,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, batchCount);
+
+    return hipblasSolverPotrfBatched<float>(handle, uplo, n, A, lda, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotrfBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     double* const           A[],
+                                     const int               lda,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, batchCount);
+
+    return hipblasSolverPotrfBatched<double>(handle, uplo, n, A, lda, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrfBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasComplex* const   A[],
+                                     const int               lda,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, batchCount);
+
+    return hipblasSolverPotrfBatched<hipComplex>(
+        handle, uplo, n, (hipComplex**)A, lda, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrfBatched(hipblasHandle_t             handle,
+                                     const hipblasFillMode_t     uplo,
+                                     const int                   n,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     int*                        info,
+                                     const int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, batchCount);
+
+    return hipblasSolverPotrfBatched<hipDoubleComplex>(
+        handle, uplo, n, (hipDoubleComplex**)A, lda, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrfBatched_v2(hipblasHandle_t         handle,
+                                        const hipblasFillMode_t uplo,
+                                        const int               n,
+                                        hipComplex* const       A[],
+                                        const int               lda,
+                                        int*                    info,
+                                        const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, batchCount);
+
+    return hipblasSolverPotrfBatched<hipComplex>(handle, uplo, n, A, lda, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrfBatched_v2(hipblasHandle_t         handle,
+                                        const hipblasFillMode_t uplo,
+                                        const int               n,
+                                        hipDoubleComplex* const A[],
+                                        const int               lda,
+                                        int*                    info,
+                                        const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, batchCount);
+
+    return hipblasSolverPotrfBatched<hipDoubleComplex>(handle, uplo, n, A, lda, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potrf_strided_batched
+hipblasStatus_t hipblasSpotrfStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            float*                  A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, batchCount);
+
+    return hipblasSolverPotrf<float, true>(handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotrfStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            double*                 A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, batchCount);
+
+    return hipblasSolverPotrf<double, true>(handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrfStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasComplex*         A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, batchCount);
+
+    return hipblasSolverPotrf<hipComplex, true>(
+        handle, uplo, n, (hipComplex*)A, lda, strideA, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrfStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasDoubleComplex*   A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, batchCount);
+
+    return hipblasSolverPotrf<hipDoubleComplex, true>(
+        handle, uplo, n, (hipDoubleComplex*)A, lda, strideA, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrfStridedBatched_v2(hipblasHandle_t         handle,
+                                               const hipblasFillMode_t uplo,
+                                               const int               n,
+                                               hipComplex*             A,
+                                               const int               lda,
+                                               const hipblasStride     strideA,
+                                               int*                    info,
+                                               const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, batchCount);
+
+    return hipblasSolverPotrf<hipComplex, true>(handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrfStridedBatched_v2(hipblasHandle_t         handle,
+                                               const hipblasFillMode_t uplo,
+                                               const int               n,
+                                               hipDoubleComplex*       A,
+                                               const int               lda,
+                                               const hipblasStride     strideA,
+                                               int*                    info,
+                                               const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, batchCount);
+
+    return hipblasSolverPotrf<hipDoubleComplex, true>(
+        handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potrs
+hipblasStatus_t hipblasSpotrs(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              const int               nrhs,
+                              float*                  A,
+                              const int               lda,
+                              float*                  B,
+                              const int               ldb,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverPotrs<float, false>(
+        handle, uplo, n, nrhs, A, lda, 0, B, ldb, 0, info, 1));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotrs(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              const int               nrhs,
+                              double*                 A,
+                              const int               lda,
+                              double*                 B,
+                              const int               ldb,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverPotrs<double, false>(
+        handle, uplo, n, nrhs, A, lda, 0, B, ldb, 0, info, 1));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrs(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              const int               nrhs,
+                              hipblasComplex*         A,
+                              const int               lda,
+                              hipblasComplex*         B,
+                              const int               ldb,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverPotrs<hipComplex, false>(
+        handle, uplo, n, nrhs, (hipComplex*)A, lda, 0, (hipComplex*)B, ldb, 0, info, 1));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrs(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              const int               nrhs,
+                              hipblasDoubleComplex*   A,
+                              const int               lda,
+                              hipblasDoubleComplex*   B,
+                              const int               ldb,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverPotrs<hipDoubleComplex, false>(handle,
+                                                                         uplo,
+                                                                         n,
+                                                                         nrhs,
+                                                                         (hipDoubleComplex*)A,
+                                                                         lda,
+                                                                         0,
+                                                                         (hipDoubleComplex*)B,
+                                                                         ldb,
+                                                                         0,
+                                                                         info,
+                                                                         1));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrs_v2(hipblasHandle_t         handle,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 const int               nrhs,
+                                 hipComplex*             A,
+                                 const int               lda,
+                                 hipComplex*             B,
+                                 const int               ldb,
+                                 int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverPotrs<hipComplex, false>(
+        handle, uplo, n, nrhs, A, lda, 0, B, ldb, 0, info, 1));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrs_v2(hipblasHandle_t         handle,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 const int               nrhs,
+                                 hipDoubleComplex*       A,
+                                 const int               lda,
+                                 hipDoubleComplex*       B,
+                                 const int               ldb,
+                                 int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, ldb);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverPotrs<hipDoubleComplex, false>(
+        handle, uplo, n, nrhs, A, lda, 0, B, ldb, 0, info, 1));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potrs_batched
+hipblasStatus_t hipblasSpotrsBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     float* const            A[],
+                                     const int               lda,
+                                     float* const            B[],
+                                     const int               ldb,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, ldb, batchCount);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverPotrsBatched<float>(
+        handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotrsBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     double* const           A[],
+                                     const int               lda,
+                                     double* const           B[],
+                                     const int               ldb,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, ldb, batchCount);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverPotrsBatched<double>(
+        handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrsBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     hipblasComplex* const   A[],
+                                     const int               lda,
+                                     hipblasComplex* const   B[],
+                                     const int               ldb,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, ldb, batchCount);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverPotrsBatched<hipComplex>(
+        handle, uplo, n, nrhs, (hipComplex**)A, lda, (hipComplex**)B, ldb, info, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrsBatched(hipblasHandle_t             handle,
+                                     const hipblasFillMode_t     uplo,
+                                     const int                   n,
+                                     const int                   nrhs,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     hipblasDoubleComplex* const B[],
+                                     const int                   ldb,
+                                     int*                        info,
+                                     const int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, ldb, batchCount);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverPotrsBatched<hipDoubleComplex>(handle,
+                                                                         uplo,
+                                                                         n,
+                                                                         nrhs,
+                                                                         (hipDoubleComplex**)A,
+                                                                         lda,
+                                                                         (hipDoubleComplex**)B,
+                                                                         ldb,
+                                                                         info,
+                                                                         batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrsBatched_v2(hipblasHandle_t         handle,
+                                        const hipblasFillMode_t uplo,
+                                        const int               n,
+                                        const int               nrhs,
+                                        hipComplex* const       A[],
+                                        const int               lda,
+                                        hipComplex* const       B[],
+                                        const int               ldb,
+                                        int*                    info,
+                                        const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, ldb, batchCount);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverPotrsBatched<hipComplex>(
+        handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrsBatched_v2(hipblasHandle_t         handle,
+                                        const hipblasFillMode_t uplo,
+                                        const int               n,
+                                        const int               nrhs,
+                                        hipDoubleComplex* const A[],
+                                        const int               lda,
+                                        hipDoubleComplex* const B[],
+                                        const int               ldb,
+                                        int*                    info,
+                                        const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, ldb, batchCount);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverPotrsBatched<hipDoubleComplex>(
+        handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potrs_strided_batched
+hipblasStatus_t hipblasSpotrsStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            float*                  A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            float*                  B,
+                                            const int               ldb,
+                                            const hipblasStride     strideB,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, strideA, ldb, strideB, batchCount);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverPotrs<float, true>(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotrsStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            double*                 A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            double*                 B,
+                                            const int               ldb,
+                                            const hipblasStride     strideB,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, strideA, ldb, strideB, batchCount);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverPotrs<double, true>(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrsStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            hipblasComplex*         A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            hipblasComplex*         B,
+                                            const int               ldb,
+                                            const hipblasStride     strideB,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, strideA, ldb, strideB, batchCount);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverPotrs<hipComplex, true>(handle,
+                                                                  uplo,
+                                                                  n,
+                                                                  nrhs,
+                                                                  (hipComplex*)A,
+                                                                  lda,
+                                                                  strideA,
+                                                                  (hipComplex*)B,
+                                                                  ldb,
+                                                                  strideB,
+                                                                  info,
+                                                                  batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrsStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            hipblasDoubleComplex*   A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            hipblasDoubleComplex*   B,
+                                            const int               ldb,
+                                            const hipblasStride     strideB,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, strideA, ldb, strideB, batchCount);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverPotrs<hipDoubleComplex, true>(handle,
+                                                                        uplo,
+                                                                        n,
+                                                                        nrhs,
+                                                                        (hipDoubleComplex*)A,
+                                                                        lda,
+                                                                        strideA,
+                                                                        (hipDoubleComplex*)B,
+                                                                        ldb,
+                                                                        strideB,
+                                                                        info,
+                                                                        batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrsStridedBatched_v2(hipblasHandle_t         handle,
+                                               const hipblasFillMode_t uplo,
+                                               const int               n,
+                                               const int               nrhs,
+                                               hipComplex*             A,
+                                               const int               lda,
+                                               const hipblasStride     strideA,
+                                               hipComplex*             B,
+                                               const int               ldb,
+                                               const hipblasStride     strideB,
+                                               int*                    info,
+                                               const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, strideA, ldb, strideB, batchCount);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverPotrs<hipComplex, true>(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrsStridedBatched_v2(hipblasHandle_t         handle,
+                                               const hipblasFillMode_t uplo,
+                                               const int               n,
+                                               const int               nrhs,
+                                               hipDoubleComplex*       A,
+                                               const int               lda,
+                                               const hipblasStride     strideA,
+                                               hipDoubleComplex*       B,
+                                               const int               ldb,
+                                               const hipblasStride     strideB,
+                                               int*                    info,
+                                               const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, nrhs, lda, strideA, ldb, strideB, batchCount);
+
+    hipblasSolverInfo solver_info((cublasHandle_t)handle, info);
+
+    return solver_info.store(hipblasSolverPotrs<hipDoubleComplex, true>(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batchCount));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potri
+hipblasStatus_t hipblasSpotri(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              float*                  A,
+                              const int               lda,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return hipblasSolverPotri<float, false>(handle, uplo, n, A, lda, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotri(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              double*                 A,
+                              const int               lda,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return hipblasSolverPotri<double, false>(handle, uplo, n, A, lda, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotri(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              hipblasComplex*         A,
+                              const int               lda,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return hipblasSolverPotri<hipComplex, false>(handle, uplo, n, (hipComplex*)A, lda, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotri(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              hipblasDoubleComplex*   A,
+                              const int               lda,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return hipblasSolverPotri<hipDoubleComplex, false>(
+        handle, uplo, n, (hipDoubleComplex*)A, lda, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotri_v2(hipblasHandle_t         handle,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 hipComplex*             A,
+                                 const int               lda,
+                                 int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return hipblasSolverPotri<hipComplex, false>(handle, uplo, n, A, lda, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotri_v2(hipblasHandle_t         handle,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 hipDoubleComplex*       A,
+                                 const int               lda,
+                                 int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return hipblasSolverPotri<hipDoubleComplex, false>(handle, uplo, n, A, lda, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potri_batched
+hipblasStatus_t hipblasSpotriBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     float* const            A[],
+                                     const int               lda,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, batchCount);
+
+    return hipblasSolverPotriBatched<float>(handle, uplo, n, A, lda, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotriBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     double* const           A[],
+                                     const int               lda,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, batchCount);
+
+    return hipblasSolverPotriBatched<double>(handle, uplo, n, A, lda, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotriBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasComplex* const   A[],
+                                     const int               lda,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, batchCount);
+
+    return hipblasSolverPotriBatched<hipComplex>(
+        handle, uplo, n, (hipComplex**)A, lda, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotriBatched(hipblasHandle_t             handle,
+                                     const hipblasFillMode_t     uplo,
+                                     const int                   n,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     int*                        info,
+                                     const int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, batchCount);
+
+    return hipblasSolverPotriBatched<hipDoubleComplex>(
+        handle, uplo, n, (hipDoubleComplex**)A, lda, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotriBatched_v2(hipblasHandle_t         handle,
+                                        const hipblasFillMode_t uplo,
+                                        const int               n,
+                                        hipComplex* const       A[],
+                                        const int               lda,
+                                        int*                    info,
+                                        const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, batchCount);
+
+    return hipblasSolverPotriBatched<hipComplex>(handle, uplo, n, A, lda, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotriBatched_v2(hipblasHandle_t         handle,
+                                        const hipblasFillMode_t uplo,
+                                        const int               n,
+                                        hipDoubleComplex* const A[],
+                                        const int               lda,
+                                        int*                    info,
+                                        const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, batchCount);
+
+    return hipblasSolverPotriBatched<hipDoubleComplex>(handle, uplo, n, A, lda, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potri_strided_batched
+hipblasStatus_t hipblasSpotriStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            float*                  A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, batchCount);
+
+    return hipblasSolverPotri<float, true>(handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotriStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            double*                 A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, batchCount);
+
+    return hipblasSolverPotri<double, true>(handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotriStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasComplex*         A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, batchCount);
+
+    return hipblasSolverPotri<hipComplex, true>(
+        handle, uplo, n, (hipComplex*)A, lda, strideA, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotriStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasDoubleComplex*   A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, batchCount);
+
+    return hipblasSolverPotri<hipDoubleComplex, true>(
+        handle, uplo, n, (hipDoubleComplex*)A, lda, strideA, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotriStridedBatched_v2(hipblasHandle_t         handle,
+                                               const hipblasFillMode_t uplo,
+                                               const int               n,
+                                               hipComplex*             A,
+                                               const int               lda,
+                                               const hipblasStride     strideA,
+                                               int*                    info,
+                                               const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, batchCount);
+
+    return hipblasSolverPotri<hipComplex, true>(handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotriStridedBatched_v2(hipblasHandle_t         handle,
+                                               const hipblasFillMode_t uplo,
+                                               const int               n,
+                                               hipDoubleComplex*       A,
+                                               const int               lda,
+                                               const hipblasStride     strideA,
+                                               int*                    info,
+                                               const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, batchCount);
+
+    return hipblasSolverPotri<hipDoubleComplex, true>(
+        handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// syevj
+hipblasStatus_t hipblasSsyevj(hipblasHandle_t         handle,
+                              const hipblasEvect_t    evect,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              float*                  A,
+                              const int               lda,
+                              const float             abstol,
+                              float*                  residual,
+                              const int               maxSweeps,
+                              int*                    nSweeps,
+                              float*                  W,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, maxSweeps);
+
+    return hipblasSolverSyevj<float, false>(
+        handle, evect, uplo, n, A, lda, 0, abstol, residual, maxSweeps, nSweeps, W, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDsyevj(hipblasHandle_t         handle,
+                              const hipblasEvect_t    evect,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              double*                 A,
+                              const int               lda,
+                              const double            abstol,
+                              double*                 residual,
+                              const int               maxSweeps,
+                              int*                    nSweeps,
+                              double*                 W,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, maxSweeps);
+
+    return hipblasSolverSyevj<double, false>(
+        handle, evect, uplo, n, A, lda, 0, abstol, residual, maxSweeps, nSweeps, W, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCheevj(hipblasHandle_t         handle,
+                              const hipblasEvect_t    evect,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              hipblasComplex*         A,
+                              const int               lda,
+                              const float             abstol,
+                              float*                  residual,
+                              const int               maxSweeps,
+                              int*                    nSweeps,
+                              float*                  W,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, maxSweeps);
+
+    return hipblasSolverSyevj<hipFloatComplex, false>(handle,
+                                                      evect,
+                                                      uplo,
+                                                      n,
+                                                      (hipFloatComplex*)A,
+                                                      lda,
+                                                      0,
+                                                      abstol,
+                                                      residual,
+                                                      maxSweeps,
+                                                      nSweeps,
+                                                      W,
+                                                      0,
+                                                      info,
+                                                      1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZheevj(hipblasHandle_t         handle,
+                              const hipblasEvect_t    evect,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              hipblasDoubleComplex*   A,
+                              const int               lda,
+                              const double            abstol,
+                              double*                 residual,
+                              const int               maxSweeps,
+                              int*                    nSweeps,
+                              double*                 W,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, maxSweeps);
+
+    return hipblasSolverSyevj<hipDoubleComplex, false>(handle,
+                                                       evect,
+                                                       uplo,
+                                                       n,
+                                                       (hipDoubleComplex*)A,
+                                                       lda,
+                                                       0,
+                                                       abstol,
+                                                       residual,
+                                                       maxSweeps,
+                                                       nSweeps,
+                                                       W,
+                                                       0,
+                                                       info,
+                                                       1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCheevj_v2(hipblasHandle_t         handle,
+                                 const hipblasEvect_t    evect,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 hipComplex*             A,
+                                 const int               lda,
+                                 const float             abstol,
+                                 float*                  residual,
+                                 const int               maxSweeps,
+                                 int*                    nSweeps,
+                                 float*                  W,
+                                 int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, maxSweeps);
+
+    return hipblasSolverSyevj<hipFloatComplex, false>(
+        handle, evect, uplo, n, A, lda, 0, abstol, residual, maxSweeps, nSweeps, W, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZheevj_v2(hipblasHandle_t         handle,
+                                 const hipblasEvect_t    evect,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 hipDoubleComplex*       A,
+                                 const int               lda,
+                                 const double            abstol,
+                                 double*                 residual,
+                                 const int               maxSweeps,
+                                 int*                    nSweeps,
+                                 double*                 W,
+                                 int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, maxSweeps);
+
+    return hipblasSolverSyevj<hipDoubleComplex, false>(
+        handle, evect, uplo, n, A, lda, 0, abstol, residual, maxSweeps, nSweeps, W, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// syevj_batched
+hipblasStatus_t hipblasSsyevjBatched(hipblasHandle_t         handle,
+                                     const hipblasEvect_t    evect,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     float* const            A[],
+                                     const int               lda,
+                                     const float             abstol,
+                                     float*                  residual,
+                                     const int               maxSweeps,
+                                     int*                    nSweeps,
+                                     float*                  W,
+                                     const hipblasStride     strideW,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, maxSweeps, strideW, batchCount);
+
+    return hipblasSolverSyevjBatched<float>(handle,
+                                            evect,
+                                            uplo,
+                                            n,
+                                            A,
+                                            lda,
+                                            abstol,
+                                            residual,
+                                            maxSweeps,
+                                            nSweeps,
+                                            W,
+                                            strideW,
+                                            info,
+                                            batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDsyevjBatched(hipblasHandle_t         handle,
+                                     const hipblasEvect_t    evect,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     double* const           A[],
+                                     const int               lda,
+                                     const double            abstol,
+                                     double*                 residual,
+                                     const int               maxSweeps,
+                                     int*                    nSweeps,
+                                     double*                 W,
+                                     const hipblasStride     strideW,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, maxSweeps, strideW, batchCount);
+
+    return hipblasSolverSyevjBatched<double>(handle,
+                                             evect,
+                                             uplo,
+                                             n,
+                                             A,
+                                             lda,
+                                             abstol,
+                                             residual,
+                                             maxSweeps,
+                                             nSweeps,
+                                             W,
+                                             strideW,
+                                             info,
+                                             batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCheevjBatched(hipblasHandle_t         handle,
+                                     const hipblasEvect_t    evect,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasComplex* const   A[],
+                                     const int               lda,
+                                     const float             abstol,
+                                     float*                  residual,
+                                     const int               maxSweeps,
+                                     int*                    nSweeps,
+                                     float*                  W,
+                                     const hipblasStride     strideW,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, maxSweeps, strideW, batchCount);
+
+    return hipblasSolverSyevjBatched<hipFloatComplex>(handle,
+                                                      evect,
+                                                      uplo,
+                                                      n,
+                                                      (hipFloatComplex**)A,
+                                                      lda,
+                                                      abstol,
+                                                      residual,
+                                                      maxSweeps,
+                                                      nSweeps,
+                                                      W,
+                                                      strideW,
+                                                      info,
+                                                      batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZheevjBatched(hipblasHandle_t             handle,
+                                     const hipblasEvect_t        evect,
+                                     const hipblasFillMode_t     uplo,
+                                     const int                   n,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     const double                abstol,
+                                     double*                     residual,
+                                     const int                   maxSweeps,
+                                     int*                        nSweeps,
+                                     double*                     W,
+                                     const hipblasStride         strideW,
+                                     int*                        info,
+                                     const int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, maxSweeps, strideW, batchCount);
+
+    return hipblasSolverSyevjBatched<hipDoubleComplex>(handle,
+                                                       evect,
+                                                       uplo,
+                                                       n,
+                                                       (hipDoubleComplex**)A,
+                                                       lda,
+                                                       abstol,
+                                                       residual,
+                                                       maxSweeps,
+                                                       nSweeps,
+                                                       W,
+                                                       strideW,
+                                                       info,
+                                                       batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCheevjBatched_v2(hipblasHandle_t         handle,
+                                        const hipblasEvect_t    evect,
+                                        const hipblasFillMode_t uplo,
+                                        const int               n,
+                                        hipComplex* const       A[],
+                                        const int               lda,
+                                        const float             abstol,
+                                        float*                  residual,
+                                        const int               maxSweeps,
+                                        int*                    nSweeps,
+                                        float*                  W,
+                                        const hipblasStride     strideW,
+                                        int*                    info,
+                                        const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, maxSweeps, strideW, batchCount);
+
+    return hipblasSolverSyevjBatched<hipFloatComplex>(handle,
+                                                      evect,
+                                                      uplo,
+                                                      n,
+                                                      A,
+                                                      lda,
+                                                      abstol,
+                                                      residual,
+                                                      maxSweeps,
+                                                      nSweeps,
+                                                      W,
+                                                      strideW,
+                                                      info,
+                                                      batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZheevjBatched_v2(hipblasHandle_t         handle,
+                                        const hipblasEvect_t    evect,
+                                        const hipblasFillMode_t uplo,
+                                        const int               n,
+                                        hipDoubleComplex* const A[],
+                                        const int               lda,
+                                        const double            abstol,
+                                        double*                 residual,
+                                        const int               maxSweeps,
+                                        int*                    nSweeps,
+                                        double*                 W,
+                                        const hipblasStride     strideW,
+                                        int*                    info,
+                                        const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, maxSweeps, strideW, batchCount);
+
+    return hipblasSolverSyevjBatched<hipDoubleComplex>(handle,
+                                                       evect,
+                                                       uplo,
+                                                       n,
+                                                       A,
+                                                       lda,
+                                                       abstol,
+                                                       residual,
+                                                       maxSweeps,
+                                                       nSweeps,
+                                                       W,
+                                                       strideW,
+                                                       info,
+                                                       batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// syevj_strided_batched
+hipblasStatus_t hipblasSsyevjStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasEvect_t    evect,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            float*                  A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            const float             abstol,
+                                            float*                  residual,
+                                            const int               maxSweeps,
+                                            int*                    nSweeps,
+                                            float*                  W,
+                                            const hipblasStride     strideW,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, maxSweeps, strideW, batchCount);
+
+    return hipblasSolverSyevj<float, true>(handle,
+                                           evect,
+                                           uplo,
+                                           n,
+                                           A,
+                                           lda,
+                                           strideA,
+                                           abstol,
+                                           residual,
+                                           maxSweeps,
+                                           nSweeps,
+                                           W,
+                                           strideW,
+                                           info,
+                                           batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDsyevjStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasEvect_t    evect,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            double*                 A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            const double            abstol,
+                                            double*                 residual,
+                                            const int               maxSweeps,
+                                            int*                    nSweeps,
+                                            double*                 W,
+                                            const hipblasStride     strideW,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, maxSweeps, strideW, batchCount);
+
+    return hipblasSolverSyevj<double, true>(handle,
+                                            evect,
+                                            uplo,
+                                            n,
+                                            A,
+                                            lda,
+                                            strideA,
+                                            abstol,
+                                            residual,
+                                            maxSweeps,
+                                            nSweeps,
+                                            W,
+                                            strideW,
+                                            info,
+                                            batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCheevjStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasEvect_t    evect,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasComplex*         A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            const float             abstol,
+                                            float*                  residual,
+                                            const int               maxSweeps,
+                                            int*                    nSweeps,
+                                            float*                  W,
+                                            const hipblasStride     strideW,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, maxSweeps, strideW, batchCount);
+
+    return hipblasSolverSyevj<hipFloatComplex, true>(handle,
+                                                     evect,
+                                                     uplo,
+                                                     n,
+                                                     (hipFloatComplex*)A,
+                                                     lda,
+                                                     strideA,
+                                                     abstol,
+                                                     residual,
+                                                     maxSweeps,
+                                                     nSweeps,
+                                                     W,
+                                                     strideW,
+                                                     info,
+                                                     batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZheevjStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasEvect_t    evect,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasDoubleComplex*   A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            const double            abstol,
+                                            double*                 residual,
+                                            const int               maxSweeps,
+                                            int*                    nSweeps,
+                                            double*                 W,
+                                            const hipblasStride     strideW,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, maxSweeps, strideW, batchCount);
+
+    return hipblasSolverSyevj<hipDoubleComplex, true>(handle,
+                                                      evect,
+                                                      uplo,
+                                                      n,
+                                                      (hipDoubleComplex*)A,
+                                                      lda,
+                                                      strideA,
+                                                      abstol,
+                                                      residual,
+                                                      maxSweeps,
+                                                      nSweeps,
+                                                      W,
+                                                      strideW,
+                                                      info,
+                                                      batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCheevjStridedBatched_v2(hipblasHandle_t         handle,
+                                               const hipblasEvect_t    evect,
+                                               const hipblasFillMode_t uplo,
+                                               const int               n,
+                                               hipComplex*             A,
+                                               const int               lda,
+                                               const hipblasStride     strideA,
+                                               const float             abstol,
+                                               float*                  residual,
+                                               const int               maxSweeps,
+                                               int*                    nSweeps,
+                                               float*                  W,
+                                               const hipblasStride     strideW,
+                                               int*                    info,
+                                               const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, maxSweeps, strideW, batchCount);
+
+    return hipblasSolverSyevj<hipFloatComplex, true>(handle,
+                                                     evect,
+                                                     uplo,
+                                                     n,
+                                                     A,
+                                                     lda,
+                                                     strideA,
+                                                     abstol,
+                                                     residual,
+                                                     maxSweeps,
+                                                     nSweeps,
+                                                     W,
+                                                     strideW,
+                                                     info,
+                                                     batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZheevjStridedBatched_v2(hipblasHandle_t         handle,
+                                               const hipblasEvect_t    evect,
+                                               const hipblasFillMode_t uplo,
+                                               const int               n,
+                                               hipDoubleComplex*       A,
+                                               const int               lda,
+                                               const hipblasStride     strideA,
+                                               const double            abstol,
+                                               double*                 residual,
+                                               const int               maxSweeps,
+                                               int*                    nSweeps,
+                                               double*                 W,
+                                               const hipblasStride     strideW,
+                                               int*                    info,
+                                               const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda, strideA, maxSweeps, strideW, batchCount);
+
+    return hipblasSolverSyevj<hipDoubleComplex, true>(handle,
+                                                      evect,
+                                                      uplo,
+                                                      n,
+                                                      A,
+                                                      lda,
+                                                      strideA,
+                                                      abstol,
+                                                      residual,
+                                                      maxSweeps,
+                                                      nSweeps,
+                                                      W,
+                                                      strideW,
+                                                      info,
+                                                      batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// syevd
+hipblasStatus_t hipblasSsyevd(hipblasHandle_t         handle,
+                              const hipblasEvect_t    evect,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              float*                  A,
+                              const int               lda,
+                              float*                  D,
+                              float*                  E,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return hipblasSolverSyevd<float>(handle, evect, uplo, n, A, lda, D, E, info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDsyevd(hipblasHandle_t         handle,
+                              const hipblasEvect_t    evect,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              double*                 A,
+                              const int               lda,
+                              double*                 D,
+                              double*                 E,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return hipblasSolverSyevd<double>(handle, evect, uplo, n, A, lda, D, E, info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCheevd(hipblasHandle_t         handle,
+                              const hipblasEvect_t    evect,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              hipblasComplex*         A,
+                              const int               lda,
+                              float*                  D,
+                              float*                  E,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return hipblasSolverSyevd<hipFloatComplex>(
+        handle, evect, uplo, n, (hipFloatComplex*)A, lda, D, E, info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZheevd(hipblasHandle_t         handle,
+                              const hipblasEvect_t    evect,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              hipblasDoubleComplex*   A,
+                              const int               lda,
+                              double*                 D,
+                              double*                 E,
+                              int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return hipblasSolverSyevd<hipDoubleComplex>(
+        handle, evect, uplo, n, (hipDoubleComplex*)A, lda, D, E, info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCheevd_v2(hipblasHandle_t         handle,
+                                 const hipblasEvect_t    evect,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 hipComplex*             A,
+                                 const int               lda,
+                                 float*                  D,
+                                 float*                  E,
+                                 int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return hipblasSolverSyevd<hipFloatComplex>(handle, evect, uplo, n, A, lda, D, E, info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZheevd_v2(hipblasHandle_t         handle,
+                                 const hipblasEvect_t    evect,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 hipDoubleComplex*       A,
+                                 const int               lda,
+                                 double*                 D,
+                                 double*                 E,
+                                 int*                    info)
+try
+{
+    HIPBLAS_ENTRY(handle, uplo, n, lda);
+
+    return hipblasSolverSyevd<hipDoubleComplex>(handle, evect, uplo, n, A, lda, D, E, info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// gesvdj_batched
+hipblasStatus_t hipblasSgesvdjBatched(hipblasHandle_t      handle,
+                                      const hipblasSvect_t leftSvect,
+                                      const hipblasSvect_t rightSvect,
+                                      const int            m,
+                                      const int            n,
+                                      float* const         A[],
+                                      const int            lda,
+                                      const float          abstol,
+                                      float*               residual,
+                                      const int            maxSweeps,
+                                      int*                 nSweeps,
+                                      float*               S,
+                                      const hipblasStride  strideS,
+                                      float*               U,
+                                      const int            ldu,
+                                      const hipblasStride  strideU,
+                                      float*               V,
+                                      const int            ldv,
+                                      const hipblasStride  strideV,
+                                      int*                 info,
+                                      const int            batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, maxSweeps, strideS, ldu, strideU, ldv, strideV, batchCount);
+
+    return hipblasSolverGesvdjBatched<float>(handle,
+                                             leftSvect,
+                                             rightSvect,
+                                             m,
+                                             n,
+                                             A,
+                                             lda,
+                                             abstol,
+                                             residual,
+                                             maxSweeps,
+                                             nSweeps,
+                                             S,
+                                             strideS,
+                                             U,
+                                             ldu,
+                                             strideU,
+                                             V,
+                                             ldv,
+                                             strideV,
+                                             info,
+                                             batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgesvdjBatched(hipblasHandle_t      handle,
+                                      const hipblasSvect_t leftSvect,
+                                      const hipblasSvect_t rightSvect,
+                                      const int            m,
+                                      const int            n,
+                                      double* const        A[],
+                                      const int            lda,
+                                      const double         abstol,
+                                      double*              residual,
+                                      const int            maxSweeps,
+                                      int*                 nSweeps,
+                                      double*              S,
+                                      const hipblasStride  strideS,
+                                      double*              U,
+                                      const int            ldu,
+                                      const hipblasStride  strideU,
+                                      double*              V,
+                                      const int            ldv,
+                                      const hipblasStride  strideV,
+                                      int*                 info,
+                                      const int            batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, maxSweeps, strideS, ldu, strideU, ldv, strideV, batchCount);
+
+    return hipblasSolverGesvdjBatched<double>(handle,
+                                              leftSvect,
+                                              rightSvect,
+                                              m,
+                                              n,
+                                              A,
+                                              lda,
+                                              abstol,
+                                              residual,
+                                              maxSweeps,
+                                              nSweeps,
+                                              S,
+                                              strideS,
+                                              U,
+                                              ldu,
+                                              strideU,
+                                              V,
+                                              ldv,
+                                              strideV,
+                                              info,
+                                              batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgesvdjBatched(hipblasHandle_t       handle,
+                                      const hipblasSvect_t  leftSvect,
+                                      const hipblasSvect_t  rightSvect,
+                                      const int             m,
+                                      const int             n,
+                                      hipblasComplex* const A[],
+                                      const int             lda,
+                                      const float           abstol,
+                                      float*                residual,
+                                      const int             maxSweeps,
+                                      int*                  nSweeps,
+                                      float*                S,
+                                      const hipblasStride   strideS,
+                                      hipblasComplex*       U,
+                                      const int             ldu,
+                                      const hipblasStride   strideU,
+                                      hipblasComplex*       V,
+                                      const int             ldv,
+                                      const hipblasStride   strideV,
+                                      int*                  info,
+                                      const int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, maxSweeps, strideS, ldu, strideU, ldv, strideV, batchCount);
+
+    return hipblasSolverGesvdjBatched<hipFloatComplex>(handle,
+                                                       leftSvect,
+                                                       rightSvect,
+                                                       m,
+                                                       n,
+                                                       (hipFloatComplex**)A,
+                                                       lda,
+                                                       abstol,
+                                                       residual,
+                                                       maxSweeps,
+                                                       nSweeps,
+                                                       S,
+                                                       strideS,
+                                                       (hipFloatComplex*)U,
+                                                       ldu,
+                                                       strideU,
+                                                       (hipFloatComplex*)V,
+                                                       ldv,
+                                                       strideV,
+                                                       info,
+                                                       batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgesvdjBatched(hipblasHandle_t             handle,
+                                      const hipblasSvect_t        leftSvect,
+                                      const hipblasSvect_t        rightSvect,
+                                      const int                   m,
+                                      const int                   n,
+                                      hipblasDoubleComplex* const A[],
+                                      const int                   lda,
+                                      const double                abstol,
+                                      double*                     residual,
+                                      const int                   maxSweeps,
+                                      int*                        nSweeps,
+                                      double*                     S,
+                                      const hipblasStride         strideS,
+                                      hipblasDoubleComplex*       U,
+                                      const int                   ldu,
+                                      const hipblasStride         strideU,
+                                      hipblasDoubleComplex*       V,
+                                      const int                   ldv,
+                                      const hipblasStride         strideV,
+                                      int*                        info,
+                                      const int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, maxSweeps, strideS, ldu, strideU, ldv, strideV, batchCount);
+
+    return hipblasSolverGesvdjBatched<hipDoubleComplex>(handle,
+                                                        leftSvect,
+                                                        rightSvect,
+                                                        m,
+                                                        n,
+                                                        (hipDoubleComplex**)A,
+                                                        lda,
+                                                        abstol,
+                                                        residual,
+                                                        maxSweeps,
+                                                        nSweeps,
+                                                        S,
+                                                        strideS,
+                                                        (hipDoubleComplex*)U,
+                                                        ldu,
+                                                        strideU,
+                                                        (hipDoubleComplex*)V,
+                                                        ldv,
+                                                        strideV,
+                                                        info,
+                                                        batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgesvdjBatched_v2(hipblasHandle_t      handle,
+                                         const hipblasSvect_t leftSvect,
+                                         const hipblasSvect_t rightSvect,
+                                         const int            m,
+                                         const int            n,
+                                         hipComplex* const    A[],
+                                         const int            lda,
+                                         const float          abstol,
+                                         float*               residual,
+                                         const int            maxSweeps,
+                                         int*                 nSweeps,
+                                         float*               S,
+                                         const hipblasStride  strideS,
+                                         hipComplex*          U,
+                                         const int            ldu,
+                                         const hipblasStride  strideU,
+                                         hipComplex*          V,
+                                         const int            ldv,
+                                         const hipblasStride  strideV,
+                                         int*                 info,
+                                         const int            batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, maxSweeps, strideS, ldu, strideU, ldv, strideV, batchCount);
+
+    return hipblasSolverGesvdjBatched<hipFloatComplex>(handle,
+                                                       leftSvect,
+                                                       rightSvect,
+                                                       m,
+                                                       n,
+                                                       A,
+                                                       lda,
+                                                       abstol,
+                                                       residual,
+                                                       maxSweeps,
+                                                       nSweeps,
+                                                       S,
+                                                       strideS,
+                                                       U,
+                                                       ldu,
+                                                       strideU,
+                                                       V,
+                                                       ldv,
+                                                       strideV,
+                                                       info,
+                                                       batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgesvdjBatched_v2(hipblasHandle_t         handle,
+                                         const hipblasSvect_t    leftSvect,
+                                         const hipblasSvect_t    rightSvect,
+                                         const int               m,
+                                         const int               n,
+                                         hipDoubleComplex* const A[],
+                                         const int               lda,
+                                         const double            abstol,
+                                         double*                 residual,
+                                         const int               maxSweeps,
+                                         int*                    nSweeps,
+                                         double*                 S,
+                                         const hipblasStride     strideS,
+                                         hipDoubleComplex*       U,
+                                         const int               ldu,
+                                         const hipblasStride     strideU,
+                                         hipDoubleComplex*       V,
+                                         const int               ldv,
+                                         const hipblasStride     strideV,
+                                         int*                    info,
+                                         const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, m, n, lda, maxSweeps, strideS, ldu, strideU, ldv, strideV, batchCount);
+
+    return hipblasSolverGesvdjBatched<hipDoubleComplex>(handle,
+                                                        leftSvect,
+                                                        rightSvect,
+                                                        m,
+                                                        n,
+                                                        A,
+                                                        lda,
+                                                        abstol,
+                                                        residual,
+                                                        maxSweeps,
+                                                        nSweeps,
+                                                        S,
+                                                        strideS,
+                                                        U,
+                                                        ldu,
+                                                        strideU,
+                                                        V,
+                                                        ldv,
+                                                        strideV,
+                                                        info,
+                                                        batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// gesvdj_strided_batched
+hipblasStatus_t hipblasSgesvdjStridedBatched(hipblasHandle_t      handle,
+                                             const hipblasSvect_t leftSvect,
+                                             const hipblasSvect_t rightSvect,
+                                             const int            m,
+                                             const int            n,
+                                             float*               A,
+                                             const int            lda,
+                                             const hipblasStride  strideA,
+                                             const float          abstol,
+                                             float*               residual,
+                                             const int            maxSweeps,
+                                             int*                 nSweeps,
+                                             float*               S,
+                                             const hipblasStride  strideS,
+                                             float*               U,
+                                             const int            ldu,
+                                             const hipblasStride  strideU,
+                                             float*               V,
+                                             const int            ldv,
+                                             const hipblasStride  strideV,
+                                             int*                 info,
+                                             const int            batchCount)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, m, n, lda, strideA, maxSweeps, strideS, ldu, strideU, ldv, strideV, batchCount);
+
+    return hipblasSolverGesvdjStridedBatched<float>(handle,
+                                                    leftSvect,
+                                                    rightSvect,
+                                                    m,
+                                                    n,
+                                                    A,
+                                                    lda,
+                                                    strideA,
+                                                    abstol,
+                                                    residual,
+                                                    maxSweeps,
+                                                    nSweeps,
+                                                    S,
+                                                    strideS,
+                                                    U,
+                                                    ldu,
+                                                    strideU,
+                                                    V,
+                                                    ldv,
+                                                    strideV,
+                                                    info,
+                                                    batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgesvdjStridedBatched(hipblasHandle_t      handle,
+                                             const hipblasSvect_t leftSvect,
+                                             const hipblasSvect_t rightSvect,
+                                             const int            m,
+                                             const int            n,
+                                             double*              A,
+                                             const int            lda,
+                                             const hipblasStride  strideA,
+                                             const double         abstol,
+                                             double*              residual,
+                                             const int            maxSweeps,
+                                             int*                 nSweeps,
+                                             double*              S,
+                                             const hipblasStride  strideS,
+                                             double*              U,
+                                             const int            ldu,
+                                             const hipblasStride  strideU,
+                                             double*              V,
+                                             const int            ldv,
+                                             const hipblasStride  strideV,
+                                             int*                 info,
+                                             const int            batchCount)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, m, n, lda, strideA, maxSweeps, strideS, ldu, strideU, ldv, strideV, batchCount);
+
+    return hipblasSolverGesvdjStridedBatched<double>(handle,
+                                                     leftSvect,
+                                                     rightSvect,
+                                                     m,
+                                                     n,
+                                                     A,
+                                                     lda,
+                                                     strideA,
+                                                     abstol,
+                                                     residual,
+                                                     maxSweeps,
+                                                     nSweeps,
+                                                     S,
+                                                     strideS,
+                                                     U,
+                                                     ldu,
+                                                     strideU,
+                                                     V,
+                                                     ldv,
+                                                     strideV,
+                                                     info,
+                                                     batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgesvdjStridedBatched(hipblasHandle_t      handle,
+                                             const hipblasSvect_t leftSvect,
+                                             const hipblasSvect_t rightSvect,
+                                             const int            m,
+                                             const int            n,
+                                             hipblasComplex*      A,
+                                             const int            lda,
+                                             const hipblasStride  strideA,
+                                             const float          abstol,
+                                             float*               residual,
+                                             const int            maxSweeps,
+                                             int*                 nSweeps,
+                                             float*               S,
+                                             const hipblasStride  strideS,
+                                             hipblasComplex*      U,
+                                             const int            ldu,
+                                             const hipblasStride  strideU,
+                                             hipblasComplex*      V,
+                                             const int            ldv,
+                                             const hipblasStride  strideV,
+                                             int*                 info,
+                                             const int            batchCount)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, m, n, lda, strideA, maxSweeps, strideS, ldu, strideU, ldv, strideV, batchCount);
+
+    return hipblasSolverGesvdjStridedBatched<hipFloatComplex>(handle,
+                                                              leftSvect,
+                                                              rightSvect,
+                                                              m,
+                                                              n,
+                                                              (hipFloatComplex*)A,
+                                                              lda,
+                                                              strideA,
+                                                              abstol,
+                                                              residual,
+                                                              maxSweeps,
+                                                              nSweeps,
+                                                              S,
+                                                              strideS,
+                                                              (hipFloatComplex*)U,
+                                                              ldu,
+                                                              strideU,
+                                                              (hipFloatComplex*)V,
+                                                              ldv,
+                                                              strideV,
+                                                              info,
+                                                              batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgesvdjStridedBatched(hipblasHandle_t       handle,
+                                             const hipblasSvect_t  leftSvect,
+                                             const hipblasSvect_t  rightSvect,
+                                             const int             m,
+                                             const int             n,
+                                             hipblasDoubleComplex* A,
+                                             const int             lda,
+                                             const hipblasStride   strideA,
+                                             const double          abstol,
+                                             double*               residual,
+                                             const int             maxSweeps,
+                                             int*                  nSweeps,
+                                             double*               S,
+                                             const hipblasStride   strideS,
+                                             hipblasDoubleComplex* U,
+                                             const int             ldu,
+                                             const hipblasStride   strideU,
+                                             hipblasDoubleComplex* V,
+                                             const int             ldv,
+                                             const hipblasStride   strideV,
+                                             int*                  info,
+                                             const int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, m, n, lda, strideA, maxSweeps, strideS, ldu, strideU, ldv, strideV, batchCount);
+
+    return hipblasSolverGesvdjStridedBatched<hipDoubleComplex>(handle,
+                                                               leftSvect,
+                                                               rightSvect,
+                                                               m,
+                                                               n,
+                                                               (hipDoubleComplex*)A,
+                                                               lda,
+                                                               strideA,
+                                                               abstol,
+                                                               residual,
+                                                               maxSweeps,
+                                                               nSweeps,
+                                                               S,
+                                                               strideS,
+                                                               (hipDoubleComplex*)U,
+                                                               ldu,
+                                                               strideU,
+                                                               (hipDoubleComplex*)V,
+                                                               ldv,
+                                                               strideV,
+                                                               info,
+                                                               batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgesvdjStridedBatched_v2(hipblasHandle_t      handle,
+                                                const hipblasSvect_t leftSvect,
+                                                const hipblasSvect_t rightSvect,
+                                                const int            m,
+                                                const int            n,
+                                                hipComplex*          A,
+                                                const int            lda,
+                                                const hipblasStride  strideA,
+                                                const float          abstol,
+                                                float*               residual,
+                                                const int            maxSweeps,
+                                                int*                 nSweeps,
+                                                float*               S,
+                                                const hipblasStride  strideS,
+                                                hipComplex*          U,
+                                                const int            ldu,
+                                                const hipblasStride  strideU,
+                                                hipComplex*          V,
+                                                const int            ldv,
+                                                const hipblasStride  strideV,
+                                                int*                 info,
+                                                const int            batchCount)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, m, n, lda, strideA, maxSweeps, strideS, ldu, strideU, ldv, strideV, batchCount);
+
+    return hipblasSolverGesvdjStridedBatched<hipFloatComplex>(handle,
+                                                              leftSvect,
+                                                              rightSvect,
+                                                              m,
+                                                              n,
+                                                              A,
+                                                              lda,
+                                                              strideA,
+                                                              abstol,
+                                                              residual,
+                                                              maxSweeps,
+                                                              nSweeps,
+                                                              S,
+                                                              strideS,
+                                                              U,
+                                                              ldu,
+                                                              strideU,
+                                                              V,
+                                                              ldv,
+                                                              strideV,
+                                                              info,
+                                                              batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgesvdjStridedBatched_v2(hipblasHandle_t      handle,
+                                                const hipblasSvect_t leftSvect,
+                                                const hipblasSvect_t rightSvect,
+                                                const int            m,
+                                                const int            n,
+                                                hipDoubleComplex*    A,
+                                                const int            lda,
+                                                const hipblasStride  strideA,
+                                                const double         abstol,
+                                                double*              residual,
+                                                const int            maxSweeps,
+                                                int*                 nSweeps,
+                                                double*              S,
+                                                const hipblasStride  strideS,
+                                                hipDoubleComplex*    U,
+                                                const int            ldu,
+                                                const hipblasStride  strideU,
+                                                hipDoubleComplex*    V,
+                                                const int            ldv,
+                                                const hipblasStride  strideV,
+                                                int*                 info,
+                                                const int            batchCount)
+try
+{
+    HIPBLAS_ENTRY(
+        handle, m, n, lda, strideA, maxSweeps, strideS, ldu, strideU, ldv, strideV, batchCount);
+
+    return hipblasSolverGesvdjStridedBatched<hipDoubleComplex>(handle,
+                                                               leftSvect,
+                                                               rightSvect,
+                                                               m,
+                                                               n,
+                                                               A,
+                                                               lda,
+                                                               strideA,
+                                                               abstol,
+                                                               residual,
+                                                               maxSweeps,
+                                                               nSweeps,
+                                                               S,
+                                                               strideS,
+                                                               U,
+                                                               ldu,
+                                                               strideU,
+                                                               V,
+                                                               ldv,
+                                                               strideV,
+                                                               info,
+                                                               batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// gesv_batched
+hipblasStatus_t hipblasSgesvBatched(hipblasHandle_t handle,
+                                    const int       n,
+                                    const int       nrhs,
+                                    float* const    A[],
+                                    const int       lda,
+                                    int*            ipiv,
+                                    float* const    B[],
+                                    const int       ldb,
+                                    int*            info,
+                                    const int       batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, ldb, batchCount);
+
+    return hipblasSolverGesvBatched<float>(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgesvBatched(hipblasHandle_t handle,
+                                    const int       n,
+                                    const int       nrhs,
+                                    double* const   A[],
+                                    const int       lda,
+                                    int*            ipiv,
+                                    double* const   B[],
+                                    const int       ldb,
+                                    int*            info,
+                                    const int       batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, ldb, batchCount);
+
+    return hipblasSolverGesvBatched<double>(
+        handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgesvBatched(hipblasHandle_t       handle,
+                                    const int             n,
+                                    const int             nrhs,
+                                    hipblasComplex* const A[],
+                                    const int             lda,
+                                    int*                  ipiv,
+                                    hipblasComplex* const B[],
+                                    const int             ldb,
+                                    int*                  info,
+                                    const int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, ldb, batchCount);
+
+    return hipblasSolverGesvBatched<hipFloatComplex>(handle,
+                                                     n,
+                                                     nrhs,
+                                                     (hipFloatComplex**)A,
+                                                     lda,
+                                                     ipiv,
+                                                     (hipFloatComplex**)B,
+                                                     ldb,
+                                                     info,
+                                                     batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgesvBatched(hipblasHandle_t             handle,
+                                    const int                   n,
+                                    const int                   nrhs,
+                                    hipblasDoubleComplex* const A[],
+                                    const int                   lda,
+                                    int*                        ipiv,
+                                    hipblasDoubleComplex* const B[],
+                                    const int                   ldb,
+                                    int*                        info,
+                                    const int                   batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, ldb, batchCount);
+
+    return hipblasSolverGesvBatched<hipDoubleComplex>(handle,
+                                                      n,
+                                                      nrhs,
+                                                      (hipDoubleComplex**)A,
+                                                      lda,
+                                                      ipiv,
+                                                      (hipDoubleComplex**)B,
+                                                      ldb,
+                                                      info,
+                                                      batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgesvBatched_v2(hipblasHandle_t   handle,
+                                       const int         n,
+                                       const int         nrhs,
+                                       hipComplex* const A[],
+                                       const int         lda,
+                                       int*              ipiv,
+                                       hipComplex* const B[],
+                                       const int         ldb,
+                                       int*              info,
+                                       const int         batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, ldb, batchCount);
+
+    return hipblasSolverGesvBatched<hipFloatComplex>(
+        handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgesvBatched_v2(hipblasHandle_t         handle,
+                                       const int               n,
+                                       const int               nrhs,
+                                       hipDoubleComplex* const A[],
+                                       const int               lda,
+                                       int*                    ipiv,
+                                       hipDoubleComplex* const B[],
+                                       const int               ldb,
+                                       int*                    info,
+                                       const int               batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, ldb, batchCount);
+
+    return hipblasSolverGesvBatched<hipDoubleComplex>(
+        handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// gesv_strided_batched
+hipblasStatus_t hipblasSgesvStridedBatched(hipblasHandle_t     handle,
+                                           const int           n,
+                                           const int           nrhs,
+                                           float*              A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           int*                ipiv,
+                                           const hipblasStride strideP,
+                                           float*              B,
+                                           const int           ldb,
+                                           const hipblasStride strideB,
+                                           int*                info,
+                                           const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, strideA, strideP, ldb, strideB, batchCount);
+
+    return hipblasSolverGesvStridedBatched<float>(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgesvStridedBatched(hipblasHandle_t     handle,
+                                           const int           n,
+                                           const int           nrhs,
+                                           double*             A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           int*                ipiv,
+                                           const hipblasStride strideP,
+                                           double*             B,
+                                           const int           ldb,
+                                           const hipblasStride strideB,
+                                           int*                info,
+                                           const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, strideA, strideP, ldb, strideB, batchCount);
+
+    return hipblasSolverGesvStridedBatched<double>(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgesvStridedBatched(hipblasHandle_t     handle,
+                                           const int           n,
+                                           const int           nrhs,
+                                           hipblasComplex*     A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           int*                ipiv,
+                                           const hipblasStride strideP,
+                                           hipblasComplex*     B,
+                                           const int           ldb,
+                                           const hipblasStride strideB,
+                                           int*                info,
+                                           const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, strideA, strideP, ldb, strideB, batchCount);
+
+    return hipblasSolverGesvStridedBatched<hipFloatComplex>(handle,
+                                                            n,
+                                                            nrhs,
+                                                            (hipFloatComplex*)A,
+                                                            lda,
+                                                            strideA,
+                                                            ipiv,
+                                                            strideP,
+                                                            (hipFloatComplex*)B,
+                                                            ldb,
+                                                            strideB,
+                                                            info,
+                                                            batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgesvStridedBatched(hipblasHandle_t       handle,
+                                           const int             n,
+                                           const int             nrhs,
+                                           hipblasDoubleComplex* A,
+                                           const int             lda,
+                                           const hipblasStride   strideA,
+                                           int*                  ipiv,
+                                           const hipblasStride   strideP,
+                                           hipblasDoubleComplex* B,
+                                           const int             ldb,
+                                           const hipblasStride   strideB,
+                                           int*                  info,
+                                           const int             batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, strideA, strideP, ldb, strideB, batchCount);
+
+    return hipblasSolverGesvStridedBatched<hipDoubleComplex>(handle,
+                                                             n,
+                                                             nrhs,
+                                                             (hipDoubleComplex*)A,
+                                                             lda,
+                                                             strideA,
+                                                             ipiv,
+                                                             strideP,
+                                                             (hipDoubleComplex*)B,
+                                                             ldb,
+                                                             strideB,
+                                                             info,
+                                                             batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgesvStridedBatched_v2(hipblasHandle_t     handle,
+                                              const int           n,
+                                              const int           nrhs,
+                                              hipComplex*         A,
+                                              const int           lda,
+                                              const hipblasStride strideA,
+                                              int*                ipiv,
+                                              const hipblasStride strideP,
+                                              hipComplex*         B,
+                                              const int           ldb,
+                                              const hipblasStride strideB,
+                                              int*                info,
+                                              const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, strideA, strideP, ldb, strideB, batchCount);
+
+    return hipblasSolverGesvStridedBatched<hipFloatComplex>(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgesvStridedBatched_v2(hipblasHandle_t     handle,
+                                              const int           n,
+                                              const int           nrhs,
+                                              hipDoubleComplex*   A,
+                                              const int           lda,
+                                              const hipblasStride strideA,
+                                              int*                ipiv,
+                                              const hipblasStride strideP,
+                                              hipDoubleComplex*   B,
+                                              const int           ldb,
+                                              const hipblasStride strideB,
+                                              int*                info,
+                                              const int           batchCount)
+try
+{
+    HIPBLAS_ENTRY(handle, n, nrhs, lda, strideA, strideP, ldb, strideB, batchCount);
+
+    return hipblasSolverGesvStridedBatched<hipDoubleComplex>(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -111,6 +111,9 @@ def parse_args():
     parser.add_argument('-s', '--static', required=False, default = False, dest='static_lib', action='store_true',
                         help='Build hipblas as a static library.(optional, default: False). hipblas must be built statically when the used companion rocblas is also static')
 
+    parser.add_argument(      '--lto', dest='lto', required=False, default=False, action='store_true',
+                        help='Build hipblas with ThinLTO (optional, default: False). With --static the library keeps the bitcode, for applications linked with LTO to inline its functions')
+
     parser.add_argument(      '--src_path', type=str, required=False, default="",
                         help='Source path. (optional, default: Current directory)')
 
@@ -276,6 +279,9 @@ def config_cmd():
     if args.static_lib:
         cmake_options.append( f"-DBUILD_SHARED_LIBS=OFF" )
 
+    if args.lto:
+        cmake_options.append( f"-DBUILD_WITH_LTO=ON" )
+
     if args.custom_target:
         cmake_options.append( f"-DCUSTOM_TARGET={args.custom_target}")
 